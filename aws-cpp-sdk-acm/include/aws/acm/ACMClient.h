@@ -27,6 +27,16 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/acm/model/DeleteCertificateRequest.h>
+#include <aws/acm/model/DescribeCertificateRequest.h>
+#include <aws/acm/model/GetCertificateRequest.h>
+#include <aws/acm/model/ListCertificatesRequest.h>
+#include <aws/acm/model/RequestCertificateRequest.h>
+#include <aws/acm/model/ResendValidationEmailRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -165,6 +175,11 @@ namespace Model
          */
         virtual Model::DeleteCertificateOutcomeCallable DeleteCertificateCallable(const Model::DeleteCertificateRequest& request) const;
 
+        /**
+         * Same as DeleteCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteCertificateOutcomeCallable DeleteCertificateCallable(Model::DeleteCertificateRequest&& request) const;
+
         /**
          * <p> Deletes an ACM Certificate and its associated private key. If this action
          * succeeds, the certificate no longer appears in the list of ACM Certificates that
@@ -178,6 +193,11 @@ namespace Model
          */
         virtual void DeleteCertificateAsync(const Model::DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteCertificateAsync(Model::DeleteCertificateRequest&& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of the fields contained in the specified ACM Certificate. For
          * example, this action returns the certificate status, a flag that indicates
@@ -198,6 +218,11 @@ namespace Model
          */
         virtual Model::DescribeCertificateOutcomeCallable DescribeCertificateCallable(const Model::DescribeCertificateRequest& request) const;
 
+        /**
+         * Same as DescribeCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCertificateOutcomeCallable DescribeCertificateCallable(Model::DescribeCertificateRequest&& request) const;
+
         /**
          * <p> Returns a list of the fields contained in the specified ACM Certificate. For
          * example, this action returns the certificate status, a flag that indicates
@@ -209,6 +234,11 @@ namespace Model
          */
         virtual void DescribeCertificateAsync(const Model::DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCertificateAsync(Model::DescribeCertificateRequest&& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Retrieves an ACM Certificate and certificate chain for the certificate
          * specified by an ARN. The chain is an ordered list of certificates that contains
@@ -233,6 +263,11 @@ namespace Model
          */
         virtual Model::GetCertificateOutcomeCallable GetCertificateCallable(const Model::GetCertificateRequest& request) const;
 
+        /**
+         * Same as GetCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetCertificateOutcomeCallable GetCertificateCallable(Model::GetCertificateRequest&& request) const;
+
         /**
          * <p> Retrieves an ACM Certificate and certificate chain for the certificate
          * specified by an ARN. The chain is an ordered list of certificates that contains
@@ -246,6 +281,11 @@ namespace Model
          */
         virtual void GetCertificateAsync(const Model::GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetCertificateAsync(Model::GetCertificateRequest&& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Retrieves a list of the ACM Certificate ARNs, and the domain name for each
          * ARN, owned by the calling account. You can filter the list based on the
@@ -270,6 +310,11 @@ namespace Model
          */
         virtual Model::ListCertificatesOutcomeCallable ListCertificatesCallable(const Model::ListCertificatesRequest& request) const;
 
+        /**
+         * Same as ListCertificatesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListCertificatesOutcomeCallable ListCertificatesCallable(Model::ListCertificatesRequest&& request) const;
+
         /**
          * <p> Retrieves a list of the ACM Certificate ARNs, and the domain name for each
          * ARN, owned by the calling account. You can filter the list based on the
@@ -283,6 +328,11 @@ namespace Model
          */
         virtual void ListCertificatesAsync(const Model::ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListCertificatesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListCertificatesAsync(Model::ListCertificatesRequest&& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Requests an ACM Certificate for use with other AWS services. To request an
          * ACM Certificate, you must specify the fully qualified domain name (FQDN) for
@@ -309,6 +359,11 @@ namespace Model
          */
         virtual Model::RequestCertificateOutcomeCallable RequestCertificateCallable(const Model::RequestCertificateRequest& request) const;
 
+        /**
+         * Same as RequestCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RequestCertificateOutcomeCallable RequestCertificateCallable(Model::RequestCertificateRequest&& request) const;
+
         /**
          * <p> Requests an ACM Certificate for use with other AWS services. To request an
          * ACM Certificate, you must specify the fully qualified domain name (FQDN) for
@@ -323,6 +378,11 @@ namespace Model
          */
         virtual void RequestCertificateAsync(const Model::RequestCertificateRequest& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RequestCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RequestCertificateAsync(Model::RequestCertificateRequest&& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Resends the email that requests domain ownership validation. The domain
          * owner or an authorized representative must approve the ACM Certificate before it
@@ -351,6 +411,11 @@ namespace Model
          */
         virtual Model::ResendValidationEmailOutcomeCallable ResendValidationEmailCallable(const Model::ResendValidationEmailRequest& request) const;
 
+        /**
+         * Same as ResendValidationEmailCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ResendValidationEmailOutcomeCallable ResendValidationEmailCallable(Model::ResendValidationEmailRequest&& request) const;
+
         /**
          * <p> Resends the email that requests domain ownership validation. The domain
          * owner or an authorized representative must approve the ACM Certificate before it
@@ -366,6 +431,30 @@ namespace Model
          */
         virtual void ResendValidationEmailAsync(const Model::ResendValidationEmailRequest& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResendValidationEmailAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ResendValidationEmailAsync(Model::ResendValidationEmailRequest&& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCertificateOutcome> DeleteCertificateAwaitable(const Model::DeleteCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ACMClient::DeleteCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCertificateOutcome> DeleteCertificateAwaitable(Model::DeleteCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ACMClient::DeleteCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCertificateOutcome> DescribeCertificateAwaitable(const Model::DescribeCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ACMClient::DescribeCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCertificateOutcome> DescribeCertificateAwaitable(Model::DescribeCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ACMClient::DescribeCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCertificateOutcome> GetCertificateAwaitable(const Model::GetCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ACMClient::GetCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCertificateOutcome> GetCertificateAwaitable(Model::GetCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ACMClient::GetCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListCertificatesOutcome> ListCertificatesAwaitable(const Model::ListCertificatesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ACMClient::ListCertificates, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListCertificatesOutcome> ListCertificatesAwaitable(Model::ListCertificatesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ACMClient::ListCertificates, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RequestCertificateOutcome> RequestCertificateAwaitable(const Model::RequestCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ACMClient::RequestCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RequestCertificateOutcome> RequestCertificateAwaitable(Model::RequestCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ACMClient::RequestCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResendValidationEmailOutcome> ResendValidationEmailAwaitable(const Model::ResendValidationEmailRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ACMClient::ResendValidationEmail, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResendValidationEmailOutcome> ResendValidationEmailAwaitable(Model::ResendValidationEmailRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ACMClient::ResendValidationEmail, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
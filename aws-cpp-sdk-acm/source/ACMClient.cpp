@@ -113,12 +113,22 @@ DeleteCertificateOutcome ACMClient::DeleteCertificate(const DeleteCertificateReq
 
 DeleteCertificateOutcomeCallable ACMClient::DeleteCertificateCallable(const DeleteCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::DeleteCertificate, this, request);
+  return m_executor->SubmitWithFuture(&ACMClient::DeleteCertificate, Aws::Client::RejectedCallOutcome<DeleteCertificateOutcome>(), this, request);
+}
+
+DeleteCertificateOutcomeCallable ACMClient::DeleteCertificateCallable(DeleteCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ACMClient::DeleteCertificate, Aws::Client::RejectedCallOutcome<DeleteCertificateOutcome>(), this, std::move(request));
 }
 
 void ACMClient::DeleteCertificateAsync(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::DeleteCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ACMClient::DeleteCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCertificateOutcome>(), this, request, handler, context);
+}
+
+void ACMClient::DeleteCertificateAsync(DeleteCertificateRequest&& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ACMClient::DeleteCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void ACMClient::DeleteCertificateAsyncHelper(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -144,12 +154,22 @@ DescribeCertificateOutcome ACMClient::DescribeCertificate(const DescribeCertific
 
 DescribeCertificateOutcomeCallable ACMClient::DescribeCertificateCallable(const DescribeCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::DescribeCertificate, this, request);
+  return m_executor->SubmitWithFuture(&ACMClient::DescribeCertificate, Aws::Client::RejectedCallOutcome<DescribeCertificateOutcome>(), this, request);
+}
+
+DescribeCertificateOutcomeCallable ACMClient::DescribeCertificateCallable(DescribeCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ACMClient::DescribeCertificate, Aws::Client::RejectedCallOutcome<DescribeCertificateOutcome>(), this, std::move(request));
 }
 
 void ACMClient::DescribeCertificateAsync(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::DescribeCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ACMClient::DescribeCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCertificateOutcome>(), this, request, handler, context);
+}
+
+void ACMClient::DescribeCertificateAsync(DescribeCertificateRequest&& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ACMClient::DescribeCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void ACMClient::DescribeCertificateAsyncHelper(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -175,12 +195,22 @@ GetCertificateOutcome ACMClient::GetCertificate(const GetCertificateRequest& req
 
 GetCertificateOutcomeCallable ACMClient::GetCertificateCallable(const GetCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::GetCertificate, this, request);
+  return m_executor->SubmitWithFuture(&ACMClient::GetCertificate, Aws::Client::RejectedCallOutcome<GetCertificateOutcome>(), this, request);
+}
+
+GetCertificateOutcomeCallable ACMClient::GetCertificateCallable(GetCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ACMClient::GetCertificate, Aws::Client::RejectedCallOutcome<GetCertificateOutcome>(), this, std::move(request));
 }
 
 void ACMClient::GetCertificateAsync(const GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::GetCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ACMClient::GetCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<GetCertificateOutcome>(), this, request, handler, context);
+}
+
+void ACMClient::GetCertificateAsync(GetCertificateRequest&& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ACMClient::GetCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<GetCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void ACMClient::GetCertificateAsyncHelper(const GetCertificateRequest& request, const GetCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -206,12 +236,22 @@ ListCertificatesOutcome ACMClient::ListCertificates(const ListCertificatesReques
 
 ListCertificatesOutcomeCallable ACMClient::ListCertificatesCallable(const ListCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::ListCertificates, this, request);
+  return m_executor->SubmitWithFuture(&ACMClient::ListCertificates, Aws::Client::RejectedCallOutcome<ListCertificatesOutcome>(), this, request);
+}
+
+ListCertificatesOutcomeCallable ACMClient::ListCertificatesCallable(ListCertificatesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ACMClient::ListCertificates, Aws::Client::RejectedCallOutcome<ListCertificatesOutcome>(), this, std::move(request));
 }
 
 void ACMClient::ListCertificatesAsync(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::ListCertificatesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ACMClient::ListCertificatesAsyncHelper, Aws::Client::RejectedAsyncCall<ListCertificatesOutcome>(), this, request, handler, context);
+}
+
+void ACMClient::ListCertificatesAsync(ListCertificatesRequest&& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ACMClient::ListCertificatesAsyncHelper, Aws::Client::RejectedAsyncCall<ListCertificatesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ACMClient::ListCertificatesAsyncHelper(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -237,12 +277,22 @@ RequestCertificateOutcome ACMClient::RequestCertificate(const RequestCertificate
 
 RequestCertificateOutcomeCallable ACMClient::RequestCertificateCallable(const RequestCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::RequestCertificate, this, request);
+  return m_executor->SubmitWithFuture(&ACMClient::RequestCertificate, Aws::Client::RejectedCallOutcome<RequestCertificateOutcome>(), this, request);
+}
+
+RequestCertificateOutcomeCallable ACMClient::RequestCertificateCallable(RequestCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ACMClient::RequestCertificate, Aws::Client::RejectedCallOutcome<RequestCertificateOutcome>(), this, std::move(request));
 }
 
 void ACMClient::RequestCertificateAsync(const RequestCertificateRequest& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::RequestCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ACMClient::RequestCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<RequestCertificateOutcome>(), this, request, handler, context);
+}
+
+void ACMClient::RequestCertificateAsync(RequestCertificateRequest&& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ACMClient::RequestCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<RequestCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void ACMClient::RequestCertificateAsyncHelper(const RequestCertificateRequest& request, const RequestCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -268,12 +318,22 @@ ResendValidationEmailOutcome ACMClient::ResendValidationEmail(const ResendValida
 
 ResendValidationEmailOutcomeCallable ACMClient::ResendValidationEmailCallable(const ResendValidationEmailRequest& request) const
 {
-  return std::async(std::launch::async, &ACMClient::ResendValidationEmail, this, request);
+  return m_executor->SubmitWithFuture(&ACMClient::ResendValidationEmail, Aws::Client::RejectedCallOutcome<ResendValidationEmailOutcome>(), this, request);
+}
+
+ResendValidationEmailOutcomeCallable ACMClient::ResendValidationEmailCallable(ResendValidationEmailRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ACMClient::ResendValidationEmail, Aws::Client::RejectedCallOutcome<ResendValidationEmailOutcome>(), this, std::move(request));
 }
 
 void ACMClient::ResendValidationEmailAsync(const ResendValidationEmailRequest& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ACMClient::ResendValidationEmailAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ACMClient::ResendValidationEmailAsyncHelper, Aws::Client::RejectedAsyncCall<ResendValidationEmailOutcome>(), this, request, handler, context);
+}
+
+void ACMClient::ResendValidationEmailAsync(ResendValidationEmailRequest&& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ACMClient::ResendValidationEmailAsyncHelper, Aws::Client::RejectedAsyncCall<ResendValidationEmailOutcome>(), this, std::move(request), handler, context);
 }
 
 void ACMClient::ResendValidationEmailAsyncHelper(const ResendValidationEmailRequest& request, const ResendValidationEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
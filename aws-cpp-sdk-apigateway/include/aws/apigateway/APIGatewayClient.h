@@ -82,6 +82,85 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/apigateway/model/CreateApiKeyRequest.h>
+#include <aws/apigateway/model/CreateAuthorizerRequest.h>
+#include <aws/apigateway/model/CreateBasePathMappingRequest.h>
+#include <aws/apigateway/model/CreateDeploymentRequest.h>
+#include <aws/apigateway/model/CreateDomainNameRequest.h>
+#include <aws/apigateway/model/CreateModelRequest.h>
+#include <aws/apigateway/model/CreateResourceRequest.h>
+#include <aws/apigateway/model/CreateRestApiRequest.h>
+#include <aws/apigateway/model/CreateStageRequest.h>
+#include <aws/apigateway/model/DeleteApiKeyRequest.h>
+#include <aws/apigateway/model/DeleteAuthorizerRequest.h>
+#include <aws/apigateway/model/DeleteBasePathMappingRequest.h>
+#include <aws/apigateway/model/DeleteClientCertificateRequest.h>
+#include <aws/apigateway/model/DeleteDeploymentRequest.h>
+#include <aws/apigateway/model/DeleteDomainNameRequest.h>
+#include <aws/apigateway/model/DeleteIntegrationRequest.h>
+#include <aws/apigateway/model/DeleteIntegrationResponseRequest.h>
+#include <aws/apigateway/model/DeleteMethodRequest.h>
+#include <aws/apigateway/model/DeleteMethodResponseRequest.h>
+#include <aws/apigateway/model/DeleteModelRequest.h>
+#include <aws/apigateway/model/DeleteResourceRequest.h>
+#include <aws/apigateway/model/DeleteRestApiRequest.h>
+#include <aws/apigateway/model/DeleteStageRequest.h>
+#include <aws/apigateway/model/FlushStageAuthorizersCacheRequest.h>
+#include <aws/apigateway/model/FlushStageCacheRequest.h>
+#include <aws/apigateway/model/GenerateClientCertificateRequest.h>
+#include <aws/apigateway/model/GetAccountRequest.h>
+#include <aws/apigateway/model/GetApiKeyRequest.h>
+#include <aws/apigateway/model/GetApiKeysRequest.h>
+#include <aws/apigateway/model/GetAuthorizerRequest.h>
+#include <aws/apigateway/model/GetAuthorizersRequest.h>
+#include <aws/apigateway/model/GetBasePathMappingRequest.h>
+#include <aws/apigateway/model/GetBasePathMappingsRequest.h>
+#include <aws/apigateway/model/GetClientCertificateRequest.h>
+#include <aws/apigateway/model/GetClientCertificatesRequest.h>
+#include <aws/apigateway/model/GetDeploymentRequest.h>
+#include <aws/apigateway/model/GetDeploymentsRequest.h>
+#include <aws/apigateway/model/GetDomainNameRequest.h>
+#include <aws/apigateway/model/GetDomainNamesRequest.h>
+#include <aws/apigateway/model/GetExportRequest.h>
+#include <aws/apigateway/model/GetIntegrationRequest.h>
+#include <aws/apigateway/model/GetIntegrationResponseRequest.h>
+#include <aws/apigateway/model/GetMethodRequest.h>
+#include <aws/apigateway/model/GetMethodResponseRequest.h>
+#include <aws/apigateway/model/GetModelRequest.h>
+#include <aws/apigateway/model/GetModelTemplateRequest.h>
+#include <aws/apigateway/model/GetModelsRequest.h>
+#include <aws/apigateway/model/GetResourceRequest.h>
+#include <aws/apigateway/model/GetResourcesRequest.h>
+#include <aws/apigateway/model/GetRestApiRequest.h>
+#include <aws/apigateway/model/GetRestApisRequest.h>
+#include <aws/apigateway/model/GetSdkRequest.h>
+#include <aws/apigateway/model/GetStageRequest.h>
+#include <aws/apigateway/model/GetStagesRequest.h>
+#include <aws/apigateway/model/PutIntegrationRequest.h>
+#include <aws/apigateway/model/PutIntegrationResponseRequest.h>
+#include <aws/apigateway/model/PutMethodRequest.h>
+#include <aws/apigateway/model/PutMethodResponseRequest.h>
+#include <aws/apigateway/model/TestInvokeAuthorizerRequest.h>
+#include <aws/apigateway/model/TestInvokeMethodRequest.h>
+#include <aws/apigateway/model/UpdateAccountRequest.h>
+#include <aws/apigateway/model/UpdateApiKeyRequest.h>
+#include <aws/apigateway/model/UpdateAuthorizerRequest.h>
+#include <aws/apigateway/model/UpdateBasePathMappingRequest.h>
+#include <aws/apigateway/model/UpdateClientCertificateRequest.h>
+#include <aws/apigateway/model/UpdateDeploymentRequest.h>
+#include <aws/apigateway/model/UpdateDomainNameRequest.h>
+#include <aws/apigateway/model/UpdateIntegrationRequest.h>
+#include <aws/apigateway/model/UpdateIntegrationResponseRequest.h>
+#include <aws/apigateway/model/UpdateMethodRequest.h>
+#include <aws/apigateway/model/UpdateMethodResponseRequest.h>
+#include <aws/apigateway/model/UpdateModelRequest.h>
+#include <aws/apigateway/model/UpdateResourceRequest.h>
+#include <aws/apigateway/model/UpdateRestApiRequest.h>
+#include <aws/apigateway/model/UpdateStageRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -478,6 +557,11 @@ namespace Model
          */
         virtual Model::CreateApiKeyOutcomeCallable CreateApiKeyCallable(const Model::CreateApiKeyRequest& request) const;
 
+        /**
+         * Same as CreateApiKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateApiKeyOutcomeCallable CreateApiKeyCallable(Model::CreateApiKeyRequest&& request) const;
+
         /**
          * 
          *
@@ -485,6 +569,11 @@ namespace Model
          */
         virtual void CreateApiKeyAsync(const Model::CreateApiKeyRequest& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateApiKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateApiKeyAsync(Model::CreateApiKeyRequest&& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -497,6 +586,11 @@ namespace Model
          */
         virtual Model::CreateAuthorizerOutcomeCallable CreateAuthorizerCallable(const Model::CreateAuthorizerRequest& request) const;
 
+        /**
+         * Same as CreateAuthorizerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateAuthorizerOutcomeCallable CreateAuthorizerCallable(Model::CreateAuthorizerRequest&& request) const;
+
         /**
          * 
          *
@@ -504,6 +598,11 @@ namespace Model
          */
         virtual void CreateAuthorizerAsync(const Model::CreateAuthorizerRequest& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAuthorizerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateAuthorizerAsync(Model::CreateAuthorizerRequest&& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new <a>BasePathMapping</a> resource.</p>
          */
@@ -516,6 +615,11 @@ namespace Model
          */
         virtual Model::CreateBasePathMappingOutcomeCallable CreateBasePathMappingCallable(const Model::CreateBasePathMappingRequest& request) const;
 
+        /**
+         * Same as CreateBasePathMappingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateBasePathMappingOutcomeCallable CreateBasePathMappingCallable(Model::CreateBasePathMappingRequest&& request) const;
+
         /**
          * <p>Creates a new <a>BasePathMapping</a> resource.</p>
          *
@@ -523,6 +627,11 @@ namespace Model
          */
         virtual void CreateBasePathMappingAsync(const Model::CreateBasePathMappingRequest& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateBasePathMappingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateBasePathMappingAsync(Model::CreateBasePathMappingRequest&& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <a>Deployment</a> resource, which makes a specified <a>RestApi</a>
          * callable over the internet.</p>
@@ -537,6 +646,11 @@ namespace Model
          */
         virtual Model::CreateDeploymentOutcomeCallable CreateDeploymentCallable(const Model::CreateDeploymentRequest& request) const;
 
+        /**
+         * Same as CreateDeploymentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDeploymentOutcomeCallable CreateDeploymentCallable(Model::CreateDeploymentRequest&& request) const;
+
         /**
          * <p>Creates a <a>Deployment</a> resource, which makes a specified <a>RestApi</a>
          * callable over the internet.</p>
@@ -545,6 +659,11 @@ namespace Model
          */
         virtual void CreateDeploymentAsync(const Model::CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDeploymentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDeploymentAsync(Model::CreateDeploymentRequest&& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new domain name.</p>
          */
@@ -557,6 +676,11 @@ namespace Model
          */
         virtual Model::CreateDomainNameOutcomeCallable CreateDomainNameCallable(const Model::CreateDomainNameRequest& request) const;
 
+        /**
+         * Same as CreateDomainNameCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDomainNameOutcomeCallable CreateDomainNameCallable(Model::CreateDomainNameRequest&& request) const;
+
         /**
          * <p>Creates a new domain name.</p>
          *
@@ -564,6 +688,11 @@ namespace Model
          */
         virtual void CreateDomainNameAsync(const Model::CreateDomainNameRequest& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDomainNameAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDomainNameAsync(Model::CreateDomainNameRequest&& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds a new <a>Model</a> resource to an existing <a>RestApi</a> resource.</p>
          */
@@ -576,6 +705,11 @@ namespace Model
          */
         virtual Model::CreateModelOutcomeCallable CreateModelCallable(const Model::CreateModelRequest& request) const;
 
+        /**
+         * Same as CreateModelCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateModelOutcomeCallable CreateModelCallable(Model::CreateModelRequest&& request) const;
+
         /**
          * <p>Adds a new <a>Model</a> resource to an existing <a>RestApi</a> resource.</p>
          *
@@ -583,6 +717,11 @@ namespace Model
          */
         virtual void CreateModelAsync(const Model::CreateModelRequest& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateModelAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateModelAsync(Model::CreateModelRequest&& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <a>Resource</a> resource.</p>
          */
@@ -595,6 +734,11 @@ namespace Model
          */
         virtual Model::CreateResourceOutcomeCallable CreateResourceCallable(const Model::CreateResourceRequest& request) const;
 
+        /**
+         * Same as CreateResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateResourceOutcomeCallable CreateResourceCallable(Model::CreateResourceRequest&& request) const;
+
         /**
          * <p>Creates a <a>Resource</a> resource.</p>
          *
@@ -602,6 +746,11 @@ namespace Model
          */
         virtual void CreateResourceAsync(const Model::CreateResourceRequest& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateResourceAsync(Model::CreateResourceRequest&& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new <a>RestApi</a> resource.</p>
          */
@@ -614,6 +763,11 @@ namespace Model
          */
         virtual Model::CreateRestApiOutcomeCallable CreateRestApiCallable(const Model::CreateRestApiRequest& request) const;
 
+        /**
+         * Same as CreateRestApiCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateRestApiOutcomeCallable CreateRestApiCallable(Model::CreateRestApiRequest&& request) const;
+
         /**
          * <p>Creates a new <a>RestApi</a> resource.</p>
          *
@@ -621,6 +775,11 @@ namespace Model
          */
         virtual void CreateRestApiAsync(const Model::CreateRestApiRequest& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRestApiAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateRestApiAsync(Model::CreateRestApiRequest&& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new <a>Stage</a> resource that references a pre-existing
          * <a>Deployment</a> for the API. </p>
@@ -635,6 +794,11 @@ namespace Model
          */
         virtual Model::CreateStageOutcomeCallable CreateStageCallable(const Model::CreateStageRequest& request) const;
 
+        /**
+         * Same as CreateStageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateStageOutcomeCallable CreateStageCallable(Model::CreateStageRequest&& request) const;
+
         /**
          * <p>Creates a new <a>Stage</a> resource that references a pre-existing
          * <a>Deployment</a> for the API. </p>
@@ -643,6 +807,11 @@ namespace Model
          */
         virtual void CreateStageAsync(const Model::CreateStageRequest& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateStageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateStageAsync(Model::CreateStageRequest&& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the <a>ApiKey</a> resource.</p>
          */
@@ -655,6 +824,11 @@ namespace Model
          */
         virtual Model::DeleteApiKeyOutcomeCallable DeleteApiKeyCallable(const Model::DeleteApiKeyRequest& request) const;
 
+        /**
+         * Same as DeleteApiKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteApiKeyOutcomeCallable DeleteApiKeyCallable(Model::DeleteApiKeyRequest&& request) const;
+
         /**
          * <p>Deletes the <a>ApiKey</a> resource.</p>
          *
@@ -662,6 +836,11 @@ namespace Model
          */
         virtual void DeleteApiKeyAsync(const Model::DeleteApiKeyRequest& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteApiKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteApiKeyAsync(Model::DeleteApiKeyRequest&& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an existing <a>Authorizer</a> resource.</p>
          */
@@ -674,6 +853,11 @@ namespace Model
          */
         virtual Model::DeleteAuthorizerOutcomeCallable DeleteAuthorizerCallable(const Model::DeleteAuthorizerRequest& request) const;
 
+        /**
+         * Same as DeleteAuthorizerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteAuthorizerOutcomeCallable DeleteAuthorizerCallable(Model::DeleteAuthorizerRequest&& request) const;
+
         /**
          * <p>Deletes an existing <a>Authorizer</a> resource.</p>
          *
@@ -681,6 +865,11 @@ namespace Model
          */
         virtual void DeleteAuthorizerAsync(const Model::DeleteAuthorizerRequest& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAuthorizerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteAuthorizerAsync(Model::DeleteAuthorizerRequest&& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the <a>BasePathMapping</a> resource.</p>
          */
@@ -693,6 +882,11 @@ namespace Model
          */
         virtual Model::DeleteBasePathMappingOutcomeCallable DeleteBasePathMappingCallable(const Model::DeleteBasePathMappingRequest& request) const;
 
+        /**
+         * Same as DeleteBasePathMappingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteBasePathMappingOutcomeCallable DeleteBasePathMappingCallable(Model::DeleteBasePathMappingRequest&& request) const;
+
         /**
          * <p>Deletes the <a>BasePathMapping</a> resource.</p>
          *
@@ -700,6 +894,11 @@ namespace Model
          */
         virtual void DeleteBasePathMappingAsync(const Model::DeleteBasePathMappingRequest& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBasePathMappingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteBasePathMappingAsync(Model::DeleteBasePathMappingRequest&& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -712,6 +911,11 @@ namespace Model
          */
         virtual Model::DeleteClientCertificateOutcomeCallable DeleteClientCertificateCallable(const Model::DeleteClientCertificateRequest& request) const;
 
+        /**
+         * Same as DeleteClientCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteClientCertificateOutcomeCallable DeleteClientCertificateCallable(Model::DeleteClientCertificateRequest&& request) const;
+
         /**
          * 
          *
@@ -719,6 +923,11 @@ namespace Model
          */
         virtual void DeleteClientCertificateAsync(const Model::DeleteClientCertificateRequest& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteClientCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteClientCertificateAsync(Model::DeleteClientCertificateRequest&& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a <a>Deployment</a> resource. Deleting a deployment will only succeed
          * if there are no <a>Stage</a> resources associated with it.</p>
@@ -733,6 +942,11 @@ namespace Model
          */
         virtual Model::DeleteDeploymentOutcomeCallable DeleteDeploymentCallable(const Model::DeleteDeploymentRequest& request) const;
 
+        /**
+         * Same as DeleteDeploymentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDeploymentOutcomeCallable DeleteDeploymentCallable(Model::DeleteDeploymentRequest&& request) const;
+
         /**
          * <p>Deletes a <a>Deployment</a> resource. Deleting a deployment will only succeed
          * if there are no <a>Stage</a> resources associated with it.</p>
@@ -741,6 +955,11 @@ namespace Model
          */
         virtual void DeleteDeploymentAsync(const Model::DeleteDeploymentRequest& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDeploymentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDeploymentAsync(Model::DeleteDeploymentRequest&& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the <a>DomainName</a> resource.</p>
          */
@@ -753,6 +972,11 @@ namespace Model
          */
         virtual Model::DeleteDomainNameOutcomeCallable DeleteDomainNameCallable(const Model::DeleteDomainNameRequest& request) const;
 
+        /**
+         * Same as DeleteDomainNameCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDomainNameOutcomeCallable DeleteDomainNameCallable(Model::DeleteDomainNameRequest&& request) const;
+
         /**
          * <p>Deletes the <a>DomainName</a> resource.</p>
          *
@@ -760,6 +984,11 @@ namespace Model
          */
         virtual void DeleteDomainNameAsync(const Model::DeleteDomainNameRequest& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDomainNameAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDomainNameAsync(Model::DeleteDomainNameRequest&& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a delete integration.</p>
          */
@@ -772,6 +1001,11 @@ namespace Model
          */
         virtual Model::DeleteIntegrationOutcomeCallable DeleteIntegrationCallable(const Model::DeleteIntegrationRequest& request) const;
 
+        /**
+         * Same as DeleteIntegrationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteIntegrationOutcomeCallable DeleteIntegrationCallable(Model::DeleteIntegrationRequest&& request) const;
+
         /**
          * <p>Represents a delete integration.</p>
          *
@@ -779,6 +1013,11 @@ namespace Model
          */
         virtual void DeleteIntegrationAsync(const Model::DeleteIntegrationRequest& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIntegrationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteIntegrationAsync(Model::DeleteIntegrationRequest&& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a delete integration response.</p>
          */
@@ -791,6 +1030,11 @@ namespace Model
          */
         virtual Model::DeleteIntegrationResponseOutcomeCallable DeleteIntegrationResponseCallable(const Model::DeleteIntegrationResponseRequest& request) const;
 
+        /**
+         * Same as DeleteIntegrationResponseCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteIntegrationResponseOutcomeCallable DeleteIntegrationResponseCallable(Model::DeleteIntegrationResponseRequest&& request) const;
+
         /**
          * <p>Represents a delete integration response.</p>
          *
@@ -798,6 +1042,11 @@ namespace Model
          */
         virtual void DeleteIntegrationResponseAsync(const Model::DeleteIntegrationResponseRequest& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIntegrationResponseAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteIntegrationResponseAsync(Model::DeleteIntegrationResponseRequest&& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an existing <a>Method</a> resource.</p>
          */
@@ -810,6 +1059,11 @@ namespace Model
          */
         virtual Model::DeleteMethodOutcomeCallable DeleteMethodCallable(const Model::DeleteMethodRequest& request) const;
 
+        /**
+         * Same as DeleteMethodCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteMethodOutcomeCallable DeleteMethodCallable(Model::DeleteMethodRequest&& request) const;
+
         /**
          * <p>Deletes an existing <a>Method</a> resource.</p>
          *
@@ -817,6 +1071,11 @@ namespace Model
          */
         virtual void DeleteMethodAsync(const Model::DeleteMethodRequest& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteMethodAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteMethodAsync(Model::DeleteMethodRequest&& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an existing <a>MethodResponse</a> resource.</p>
          */
@@ -829,6 +1088,11 @@ namespace Model
          */
         virtual Model::DeleteMethodResponseOutcomeCallable DeleteMethodResponseCallable(const Model::DeleteMethodResponseRequest& request) const;
 
+        /**
+         * Same as DeleteMethodResponseCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteMethodResponseOutcomeCallable DeleteMethodResponseCallable(Model::DeleteMethodResponseRequest&& request) const;
+
         /**
          * <p>Deletes an existing <a>MethodResponse</a> resource.</p>
          *
@@ -836,6 +1100,11 @@ namespace Model
          */
         virtual void DeleteMethodResponseAsync(const Model::DeleteMethodResponseRequest& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteMethodResponseAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteMethodResponseAsync(Model::DeleteMethodResponseRequest&& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a model.</p>
          */
@@ -848,6 +1117,11 @@ namespace Model
          */
         virtual Model::DeleteModelOutcomeCallable DeleteModelCallable(const Model::DeleteModelRequest& request) const;
 
+        /**
+         * Same as DeleteModelCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteModelOutcomeCallable DeleteModelCallable(Model::DeleteModelRequest&& request) const;
+
         /**
          * <p>Deletes a model.</p>
          *
@@ -855,6 +1129,11 @@ namespace Model
          */
         virtual void DeleteModelAsync(const Model::DeleteModelRequest& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteModelAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteModelAsync(Model::DeleteModelRequest&& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a <a>Resource</a> resource.</p>
          */
@@ -867,6 +1146,11 @@ namespace Model
          */
         virtual Model::DeleteResourceOutcomeCallable DeleteResourceCallable(const Model::DeleteResourceRequest& request) const;
 
+        /**
+         * Same as DeleteResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteResourceOutcomeCallable DeleteResourceCallable(Model::DeleteResourceRequest&& request) const;
+
         /**
          * <p>Deletes a <a>Resource</a> resource.</p>
          *
@@ -874,6 +1158,11 @@ namespace Model
          */
         virtual void DeleteResourceAsync(const Model::DeleteResourceRequest& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteResourceAsync(Model::DeleteResourceRequest&& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified API.</p>
          */
@@ -886,6 +1175,11 @@ namespace Model
          */
         virtual Model::DeleteRestApiOutcomeCallable DeleteRestApiCallable(const Model::DeleteRestApiRequest& request) const;
 
+        /**
+         * Same as DeleteRestApiCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteRestApiOutcomeCallable DeleteRestApiCallable(Model::DeleteRestApiRequest&& request) const;
+
         /**
          * <p>Deletes the specified API.</p>
          *
@@ -893,6 +1187,11 @@ namespace Model
          */
         virtual void DeleteRestApiAsync(const Model::DeleteRestApiRequest& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRestApiAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteRestApiAsync(Model::DeleteRestApiRequest&& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a <a>Stage</a> resource.</p>
          */
@@ -905,6 +1204,11 @@ namespace Model
          */
         virtual Model::DeleteStageOutcomeCallable DeleteStageCallable(const Model::DeleteStageRequest& request) const;
 
+        /**
+         * Same as DeleteStageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteStageOutcomeCallable DeleteStageCallable(Model::DeleteStageRequest&& request) const;
+
         /**
          * <p>Deletes a <a>Stage</a> resource.</p>
          *
@@ -912,6 +1216,11 @@ namespace Model
          */
         virtual void DeleteStageAsync(const Model::DeleteStageRequest& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteStageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteStageAsync(Model::DeleteStageRequest&& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Flushes all authorizer cache entries on a stage.</p>
          */
@@ -924,6 +1233,11 @@ namespace Model
          */
         virtual Model::FlushStageAuthorizersCacheOutcomeCallable FlushStageAuthorizersCacheCallable(const Model::FlushStageAuthorizersCacheRequest& request) const;
 
+        /**
+         * Same as FlushStageAuthorizersCacheCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::FlushStageAuthorizersCacheOutcomeCallable FlushStageAuthorizersCacheCallable(Model::FlushStageAuthorizersCacheRequest&& request) const;
+
         /**
          * <p>Flushes all authorizer cache entries on a stage.</p>
          *
@@ -931,6 +1245,11 @@ namespace Model
          */
         virtual void FlushStageAuthorizersCacheAsync(const Model::FlushStageAuthorizersCacheRequest& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as FlushStageAuthorizersCacheAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void FlushStageAuthorizersCacheAsync(Model::FlushStageAuthorizersCacheRequest&& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Flushes a stage's cache.</p>
          */
@@ -943,6 +1262,11 @@ namespace Model
          */
         virtual Model::FlushStageCacheOutcomeCallable FlushStageCacheCallable(const Model::FlushStageCacheRequest& request) const;
 
+        /**
+         * Same as FlushStageCacheCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::FlushStageCacheOutcomeCallable FlushStageCacheCallable(Model::FlushStageCacheRequest&& request) const;
+
         /**
          * <p>Flushes a stage's cache.</p>
          *
@@ -950,6 +1274,11 @@ namespace Model
          */
         virtual void FlushStageCacheAsync(const Model::FlushStageCacheRequest& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as FlushStageCacheAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void FlushStageCacheAsync(Model::FlushStageCacheRequest&& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -962,6 +1291,11 @@ namespace Model
          */
         virtual Model::GenerateClientCertificateOutcomeCallable GenerateClientCertificateCallable(const Model::GenerateClientCertificateRequest& request) const;
 
+        /**
+         * Same as GenerateClientCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GenerateClientCertificateOutcomeCallable GenerateClientCertificateCallable(Model::GenerateClientCertificateRequest&& request) const;
+
         /**
          * 
          *
@@ -969,6 +1303,11 @@ namespace Model
          */
         virtual void GenerateClientCertificateAsync(const Model::GenerateClientCertificateRequest& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GenerateClientCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GenerateClientCertificateAsync(Model::GenerateClientCertificateRequest&& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the current <a>Account</a> resource.</p>
          */
@@ -981,6 +1320,11 @@ namespace Model
          */
         virtual Model::GetAccountOutcomeCallable GetAccountCallable(const Model::GetAccountRequest& request) const;
 
+        /**
+         * Same as GetAccountCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetAccountOutcomeCallable GetAccountCallable(Model::GetAccountRequest&& request) const;
+
         /**
          * <p>Gets information about the current <a>Account</a> resource.</p>
          *
@@ -988,6 +1332,11 @@ namespace Model
          */
         virtual void GetAccountAsync(const Model::GetAccountRequest& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAccountAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetAccountAsync(Model::GetAccountRequest&& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the current <a>ApiKey</a> resource.</p>
          */
@@ -1000,6 +1349,11 @@ namespace Model
          */
         virtual Model::GetApiKeyOutcomeCallable GetApiKeyCallable(const Model::GetApiKeyRequest& request) const;
 
+        /**
+         * Same as GetApiKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetApiKeyOutcomeCallable GetApiKeyCallable(Model::GetApiKeyRequest&& request) const;
+
         /**
          * <p>Gets information about the current <a>ApiKey</a> resource.</p>
          *
@@ -1007,6 +1361,11 @@ namespace Model
          */
         virtual void GetApiKeyAsync(const Model::GetApiKeyRequest& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetApiKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetApiKeyAsync(Model::GetApiKeyRequest&& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the current <a>ApiKeys</a> resource.</p>
          */
@@ -1019,6 +1378,11 @@ namespace Model
          */
         virtual Model::GetApiKeysOutcomeCallable GetApiKeysCallable(const Model::GetApiKeysRequest& request) const;
 
+        /**
+         * Same as GetApiKeysCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetApiKeysOutcomeCallable GetApiKeysCallable(Model::GetApiKeysRequest&& request) const;
+
         /**
          * <p>Gets information about the current <a>ApiKeys</a> resource.</p>
          *
@@ -1026,6 +1390,11 @@ namespace Model
          */
         virtual void GetApiKeysAsync(const Model::GetApiKeysRequest& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetApiKeysAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetApiKeysAsync(Model::GetApiKeysRequest&& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describe an existing <a>Authorizer</a> resource.</p>
          */
@@ -1038,6 +1407,11 @@ namespace Model
          */
         virtual Model::GetAuthorizerOutcomeCallable GetAuthorizerCallable(const Model::GetAuthorizerRequest& request) const;
 
+        /**
+         * Same as GetAuthorizerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetAuthorizerOutcomeCallable GetAuthorizerCallable(Model::GetAuthorizerRequest&& request) const;
+
         /**
          * <p>Describe an existing <a>Authorizer</a> resource.</p>
          *
@@ -1045,6 +1419,11 @@ namespace Model
          */
         virtual void GetAuthorizerAsync(const Model::GetAuthorizerRequest& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAuthorizerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetAuthorizerAsync(Model::GetAuthorizerRequest&& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describe an existing <a>Authorizers</a> resource.</p>
          */
@@ -1057,6 +1436,11 @@ namespace Model
          */
         virtual Model::GetAuthorizersOutcomeCallable GetAuthorizersCallable(const Model::GetAuthorizersRequest& request) const;
 
+        /**
+         * Same as GetAuthorizersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetAuthorizersOutcomeCallable GetAuthorizersCallable(Model::GetAuthorizersRequest&& request) const;
+
         /**
          * <p>Describe an existing <a>Authorizers</a> resource.</p>
          *
@@ -1064,6 +1448,11 @@ namespace Model
          */
         virtual void GetAuthorizersAsync(const Model::GetAuthorizersRequest& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAuthorizersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetAuthorizersAsync(Model::GetAuthorizersRequest&& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describe a <a>BasePathMapping</a> resource.</p>
          */
@@ -1076,6 +1465,11 @@ namespace Model
          */
         virtual Model::GetBasePathMappingOutcomeCallable GetBasePathMappingCallable(const Model::GetBasePathMappingRequest& request) const;
 
+        /**
+         * Same as GetBasePathMappingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBasePathMappingOutcomeCallable GetBasePathMappingCallable(Model::GetBasePathMappingRequest&& request) const;
+
         /**
          * <p>Describe a <a>BasePathMapping</a> resource.</p>
          *
@@ -1083,6 +1477,11 @@ namespace Model
          */
         virtual void GetBasePathMappingAsync(const Model::GetBasePathMappingRequest& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBasePathMappingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBasePathMappingAsync(Model::GetBasePathMappingRequest&& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a collection of <a>BasePathMapping</a> resources.</p>
          */
@@ -1095,6 +1494,11 @@ namespace Model
          */
         virtual Model::GetBasePathMappingsOutcomeCallable GetBasePathMappingsCallable(const Model::GetBasePathMappingsRequest& request) const;
 
+        /**
+         * Same as GetBasePathMappingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBasePathMappingsOutcomeCallable GetBasePathMappingsCallable(Model::GetBasePathMappingsRequest&& request) const;
+
         /**
          * <p>Represents a collection of <a>BasePathMapping</a> resources.</p>
          *
@@ -1102,6 +1506,11 @@ namespace Model
          */
         virtual void GetBasePathMappingsAsync(const Model::GetBasePathMappingsRequest& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBasePathMappingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBasePathMappingsAsync(Model::GetBasePathMappingsRequest&& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -1114,6 +1523,11 @@ namespace Model
          */
         virtual Model::GetClientCertificateOutcomeCallable GetClientCertificateCallable(const Model::GetClientCertificateRequest& request) const;
 
+        /**
+         * Same as GetClientCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetClientCertificateOutcomeCallable GetClientCertificateCallable(Model::GetClientCertificateRequest&& request) const;
+
         /**
          * 
          *
@@ -1121,6 +1535,11 @@ namespace Model
          */
         virtual void GetClientCertificateAsync(const Model::GetClientCertificateRequest& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetClientCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetClientCertificateAsync(Model::GetClientCertificateRequest&& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -1133,6 +1552,11 @@ namespace Model
          */
         virtual Model::GetClientCertificatesOutcomeCallable GetClientCertificatesCallable(const Model::GetClientCertificatesRequest& request) const;
 
+        /**
+         * Same as GetClientCertificatesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetClientCertificatesOutcomeCallable GetClientCertificatesCallable(Model::GetClientCertificatesRequest&& request) const;
+
         /**
          * 
          *
@@ -1140,6 +1564,11 @@ namespace Model
          */
         virtual void GetClientCertificatesAsync(const Model::GetClientCertificatesRequest& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetClientCertificatesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetClientCertificatesAsync(Model::GetClientCertificatesRequest&& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a <a>Deployment</a> resource.</p>
          */
@@ -1152,6 +1581,11 @@ namespace Model
          */
         virtual Model::GetDeploymentOutcomeCallable GetDeploymentCallable(const Model::GetDeploymentRequest& request) const;
 
+        /**
+         * Same as GetDeploymentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDeploymentOutcomeCallable GetDeploymentCallable(Model::GetDeploymentRequest&& request) const;
+
         /**
          * <p>Gets information about a <a>Deployment</a> resource.</p>
          *
@@ -1159,6 +1593,11 @@ namespace Model
          */
         virtual void GetDeploymentAsync(const Model::GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeploymentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDeploymentAsync(Model::GetDeploymentRequest&& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a <a>Deployments</a> collection.</p>
          */
@@ -1171,6 +1610,11 @@ namespace Model
          */
         virtual Model::GetDeploymentsOutcomeCallable GetDeploymentsCallable(const Model::GetDeploymentsRequest& request) const;
 
+        /**
+         * Same as GetDeploymentsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDeploymentsOutcomeCallable GetDeploymentsCallable(Model::GetDeploymentsRequest&& request) const;
+
         /**
          * <p>Gets information about a <a>Deployments</a> collection.</p>
          *
@@ -1178,6 +1622,11 @@ namespace Model
          */
         virtual void GetDeploymentsAsync(const Model::GetDeploymentsRequest& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeploymentsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDeploymentsAsync(Model::GetDeploymentsRequest&& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a domain name that is contained in a simpler, more intuitive URL
          * that can be called.</p>
@@ -1192,6 +1641,11 @@ namespace Model
          */
         virtual Model::GetDomainNameOutcomeCallable GetDomainNameCallable(const Model::GetDomainNameRequest& request) const;
 
+        /**
+         * Same as GetDomainNameCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDomainNameOutcomeCallable GetDomainNameCallable(Model::GetDomainNameRequest&& request) const;
+
         /**
          * <p>Represents a domain name that is contained in a simpler, more intuitive URL
          * that can be called.</p>
@@ -1200,6 +1654,11 @@ namespace Model
          */
         virtual void GetDomainNameAsync(const Model::GetDomainNameRequest& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDomainNameAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDomainNameAsync(Model::GetDomainNameRequest&& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a collection of <a>DomainName</a> resources.</p>
          */
@@ -1212,6 +1671,11 @@ namespace Model
          */
         virtual Model::GetDomainNamesOutcomeCallable GetDomainNamesCallable(const Model::GetDomainNamesRequest& request) const;
 
+        /**
+         * Same as GetDomainNamesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDomainNamesOutcomeCallable GetDomainNamesCallable(Model::GetDomainNamesRequest&& request) const;
+
         /**
          * <p>Represents a collection of <a>DomainName</a> resources.</p>
          *
@@ -1219,6 +1683,11 @@ namespace Model
          */
         virtual void GetDomainNamesAsync(const Model::GetDomainNamesRequest& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDomainNamesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDomainNamesAsync(Model::GetDomainNamesRequest&& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -1231,6 +1700,11 @@ namespace Model
          */
         virtual Model::GetExportOutcomeCallable GetExportCallable(const Model::GetExportRequest& request) const;
 
+        /**
+         * Same as GetExportCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetExportOutcomeCallable GetExportCallable(Model::GetExportRequest&& request) const;
+
         /**
          * 
          *
@@ -1238,6 +1712,11 @@ namespace Model
          */
         virtual void GetExportAsync(const Model::GetExportRequest& request, const GetExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetExportAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetExportAsync(Model::GetExportRequest&& request, const GetExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a get integration.</p>
          */
@@ -1250,6 +1729,11 @@ namespace Model
          */
         virtual Model::GetIntegrationOutcomeCallable GetIntegrationCallable(const Model::GetIntegrationRequest& request) const;
 
+        /**
+         * Same as GetIntegrationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetIntegrationOutcomeCallable GetIntegrationCallable(Model::GetIntegrationRequest&& request) const;
+
         /**
          * <p>Represents a get integration.</p>
          *
@@ -1257,6 +1741,11 @@ namespace Model
          */
         virtual void GetIntegrationAsync(const Model::GetIntegrationRequest& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIntegrationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetIntegrationAsync(Model::GetIntegrationRequest&& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a get integration response.</p>
          */
@@ -1269,6 +1758,11 @@ namespace Model
          */
         virtual Model::GetIntegrationResponseOutcomeCallable GetIntegrationResponseCallable(const Model::GetIntegrationResponseRequest& request) const;
 
+        /**
+         * Same as GetIntegrationResponseCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetIntegrationResponseOutcomeCallable GetIntegrationResponseCallable(Model::GetIntegrationResponseRequest&& request) const;
+
         /**
          * <p>Represents a get integration response.</p>
          *
@@ -1276,6 +1770,11 @@ namespace Model
          */
         virtual void GetIntegrationResponseAsync(const Model::GetIntegrationResponseRequest& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIntegrationResponseAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetIntegrationResponseAsync(Model::GetIntegrationResponseRequest&& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describe an existing <a>Method</a> resource.</p>
          */
@@ -1288,6 +1787,11 @@ namespace Model
          */
         virtual Model::GetMethodOutcomeCallable GetMethodCallable(const Model::GetMethodRequest& request) const;
 
+        /**
+         * Same as GetMethodCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetMethodOutcomeCallable GetMethodCallable(Model::GetMethodRequest&& request) const;
+
         /**
          * <p>Describe an existing <a>Method</a> resource.</p>
          *
@@ -1295,6 +1799,11 @@ namespace Model
          */
         virtual void GetMethodAsync(const Model::GetMethodRequest& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetMethodAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetMethodAsync(Model::GetMethodRequest&& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes a <a>MethodResponse</a> resource.</p>
          */
@@ -1307,6 +1816,11 @@ namespace Model
          */
         virtual Model::GetMethodResponseOutcomeCallable GetMethodResponseCallable(const Model::GetMethodResponseRequest& request) const;
 
+        /**
+         * Same as GetMethodResponseCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetMethodResponseOutcomeCallable GetMethodResponseCallable(Model::GetMethodResponseRequest&& request) const;
+
         /**
          * <p>Describes a <a>MethodResponse</a> resource.</p>
          *
@@ -1314,6 +1828,11 @@ namespace Model
          */
         virtual void GetMethodResponseAsync(const Model::GetMethodResponseRequest& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetMethodResponseAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetMethodResponseAsync(Model::GetMethodResponseRequest&& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes an existing model defined for a <a>RestApi</a> resource.</p>
          */
@@ -1326,6 +1845,11 @@ namespace Model
          */
         virtual Model::GetModelOutcomeCallable GetModelCallable(const Model::GetModelRequest& request) const;
 
+        /**
+         * Same as GetModelCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetModelOutcomeCallable GetModelCallable(Model::GetModelRequest&& request) const;
+
         /**
          * <p>Describes an existing model defined for a <a>RestApi</a> resource.</p>
          *
@@ -1333,6 +1857,11 @@ namespace Model
          */
         virtual void GetModelAsync(const Model::GetModelRequest& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetModelAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetModelAsync(Model::GetModelRequest&& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates a sample mapping template that can be used to transform a payload
          * into the structure of a model.</p>
@@ -1347,6 +1876,11 @@ namespace Model
          */
         virtual Model::GetModelTemplateOutcomeCallable GetModelTemplateCallable(const Model::GetModelTemplateRequest& request) const;
 
+        /**
+         * Same as GetModelTemplateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetModelTemplateOutcomeCallable GetModelTemplateCallable(Model::GetModelTemplateRequest&& request) const;
+
         /**
          * <p>Generates a sample mapping template that can be used to transform a payload
          * into the structure of a model.</p>
@@ -1355,6 +1889,11 @@ namespace Model
          */
         virtual void GetModelTemplateAsync(const Model::GetModelTemplateRequest& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetModelTemplateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetModelTemplateAsync(Model::GetModelTemplateRequest&& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes existing <a>Models</a> defined for a <a>RestApi</a> resource.</p>
          */
@@ -1367,6 +1906,11 @@ namespace Model
          */
         virtual Model::GetModelsOutcomeCallable GetModelsCallable(const Model::GetModelsRequest& request) const;
 
+        /**
+         * Same as GetModelsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetModelsOutcomeCallable GetModelsCallable(Model::GetModelsRequest&& request) const;
+
         /**
          * <p>Describes existing <a>Models</a> defined for a <a>RestApi</a> resource.</p>
          *
@@ -1374,6 +1918,11 @@ namespace Model
          */
         virtual void GetModelsAsync(const Model::GetModelsRequest& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetModelsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetModelsAsync(Model::GetModelsRequest&& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists information about a resource.</p>
          */
@@ -1386,6 +1935,11 @@ namespace Model
          */
         virtual Model::GetResourceOutcomeCallable GetResourceCallable(const Model::GetResourceRequest& request) const;
 
+        /**
+         * Same as GetResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetResourceOutcomeCallable GetResourceCallable(Model::GetResourceRequest&& request) const;
+
         /**
          * <p>Lists information about a resource.</p>
          *
@@ -1393,6 +1947,11 @@ namespace Model
          */
         virtual void GetResourceAsync(const Model::GetResourceRequest& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetResourceAsync(Model::GetResourceRequest&& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists information about a collection of <a>Resource</a> resources.</p>
          */
@@ -1405,6 +1964,11 @@ namespace Model
          */
         virtual Model::GetResourcesOutcomeCallable GetResourcesCallable(const Model::GetResourcesRequest& request) const;
 
+        /**
+         * Same as GetResourcesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetResourcesOutcomeCallable GetResourcesCallable(Model::GetResourcesRequest&& request) const;
+
         /**
          * <p>Lists information about a collection of <a>Resource</a> resources.</p>
          *
@@ -1412,6 +1976,11 @@ namespace Model
          */
         virtual void GetResourcesAsync(const Model::GetResourcesRequest& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetResourcesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetResourcesAsync(Model::GetResourcesRequest&& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the <a>RestApi</a> resource in the collection.</p>
          */
@@ -1424,6 +1993,11 @@ namespace Model
          */
         virtual Model::GetRestApiOutcomeCallable GetRestApiCallable(const Model::GetRestApiRequest& request) const;
 
+        /**
+         * Same as GetRestApiCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetRestApiOutcomeCallable GetRestApiCallable(Model::GetRestApiRequest&& request) const;
+
         /**
          * <p>Lists the <a>RestApi</a> resource in the collection.</p>
          *
@@ -1431,6 +2005,11 @@ namespace Model
          */
         virtual void GetRestApiAsync(const Model::GetRestApiRequest& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRestApiAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetRestApiAsync(Model::GetRestApiRequest&& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the <a>RestApis</a> resources for your collection.</p>
          */
@@ -1443,6 +2022,11 @@ namespace Model
          */
         virtual Model::GetRestApisOutcomeCallable GetRestApisCallable(const Model::GetRestApisRequest& request) const;
 
+        /**
+         * Same as GetRestApisCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetRestApisOutcomeCallable GetRestApisCallable(Model::GetRestApisRequest&& request) const;
+
         /**
          * <p>Lists the <a>RestApis</a> resources for your collection.</p>
          *
@@ -1450,6 +2034,11 @@ namespace Model
          */
         virtual void GetRestApisAsync(const Model::GetRestApisRequest& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRestApisAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetRestApisAsync(Model::GetRestApisRequest&& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -1462,6 +2051,11 @@ namespace Model
          */
         virtual Model::GetSdkOutcomeCallable GetSdkCallable(const Model::GetSdkRequest& request) const;
 
+        /**
+         * Same as GetSdkCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetSdkOutcomeCallable GetSdkCallable(Model::GetSdkRequest&& request) const;
+
         /**
          * 
          *
@@ -1469,6 +2063,11 @@ namespace Model
          */
         virtual void GetSdkAsync(const Model::GetSdkRequest& request, const GetSdkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSdkAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetSdkAsync(Model::GetSdkRequest&& request, const GetSdkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a <a>Stage</a> resource.</p>
          */
@@ -1481,6 +2080,11 @@ namespace Model
          */
         virtual Model::GetStageOutcomeCallable GetStageCallable(const Model::GetStageRequest& request) const;
 
+        /**
+         * Same as GetStageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetStageOutcomeCallable GetStageCallable(Model::GetStageRequest&& request) const;
+
         /**
          * <p>Gets information about a <a>Stage</a> resource.</p>
          *
@@ -1488,6 +2092,11 @@ namespace Model
          */
         virtual void GetStageAsync(const Model::GetStageRequest& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetStageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetStageAsync(Model::GetStageRequest&& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more <a>Stage</a> resources.</p>
          */
@@ -1500,6 +2109,11 @@ namespace Model
          */
         virtual Model::GetStagesOutcomeCallable GetStagesCallable(const Model::GetStagesRequest& request) const;
 
+        /**
+         * Same as GetStagesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetStagesOutcomeCallable GetStagesCallable(Model::GetStagesRequest&& request) const;
+
         /**
          * <p>Gets information about one or more <a>Stage</a> resources.</p>
          *
@@ -1507,6 +2121,11 @@ namespace Model
          */
         virtual void GetStagesAsync(const Model::GetStagesRequest& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetStagesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetStagesAsync(Model::GetStagesRequest&& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a put integration.</p>
          */
@@ -1519,6 +2138,11 @@ namespace Model
          */
         virtual Model::PutIntegrationOutcomeCallable PutIntegrationCallable(const Model::PutIntegrationRequest& request) const;
 
+        /**
+         * Same as PutIntegrationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutIntegrationOutcomeCallable PutIntegrationCallable(Model::PutIntegrationRequest&& request) const;
+
         /**
          * <p>Represents a put integration.</p>
          *
@@ -1526,6 +2150,11 @@ namespace Model
          */
         virtual void PutIntegrationAsync(const Model::PutIntegrationRequest& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutIntegrationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutIntegrationAsync(Model::PutIntegrationRequest&& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents a put integration.</p>
          */
@@ -1538,6 +2167,11 @@ namespace Model
          */
         virtual Model::PutIntegrationResponseOutcomeCallable PutIntegrationResponseCallable(const Model::PutIntegrationResponseRequest& request) const;
 
+        /**
+         * Same as PutIntegrationResponseCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutIntegrationResponseOutcomeCallable PutIntegrationResponseCallable(Model::PutIntegrationResponseRequest&& request) const;
+
         /**
          * <p>Represents a put integration.</p>
          *
@@ -1545,6 +2179,11 @@ namespace Model
          */
         virtual void PutIntegrationResponseAsync(const Model::PutIntegrationResponseRequest& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutIntegrationResponseAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutIntegrationResponseAsync(Model::PutIntegrationResponseRequest&& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Add a method to an existing <a>Resource</a> resource.</p>
          */
@@ -1557,6 +2196,11 @@ namespace Model
          */
         virtual Model::PutMethodOutcomeCallable PutMethodCallable(const Model::PutMethodRequest& request) const;
 
+        /**
+         * Same as PutMethodCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutMethodOutcomeCallable PutMethodCallable(Model::PutMethodRequest&& request) const;
+
         /**
          * <p>Add a method to an existing <a>Resource</a> resource.</p>
          *
@@ -1564,6 +2208,11 @@ namespace Model
          */
         virtual void PutMethodAsync(const Model::PutMethodRequest& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutMethodAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutMethodAsync(Model::PutMethodRequest&& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds a <a>MethodResponse</a> to an existing <a>Method</a> resource.</p>
          */
@@ -1576,6 +2225,11 @@ namespace Model
          */
         virtual Model::PutMethodResponseOutcomeCallable PutMethodResponseCallable(const Model::PutMethodResponseRequest& request) const;
 
+        /**
+         * Same as PutMethodResponseCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutMethodResponseOutcomeCallable PutMethodResponseCallable(Model::PutMethodResponseRequest&& request) const;
+
         /**
          * <p>Adds a <a>MethodResponse</a> to an existing <a>Method</a> resource.</p>
          *
@@ -1583,6 +2237,11 @@ namespace Model
          */
         virtual void PutMethodResponseAsync(const Model::PutMethodResponseRequest& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutMethodResponseAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutMethodResponseAsync(Model::PutMethodResponseRequest&& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -1595,6 +2254,11 @@ namespace Model
          */
         virtual Model::TestInvokeAuthorizerOutcomeCallable TestInvokeAuthorizerCallable(const Model::TestInvokeAuthorizerRequest& request) const;
 
+        /**
+         * Same as TestInvokeAuthorizerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::TestInvokeAuthorizerOutcomeCallable TestInvokeAuthorizerCallable(Model::TestInvokeAuthorizerRequest&& request) const;
+
         /**
          * 
          *
@@ -1602,6 +2266,11 @@ namespace Model
          */
         virtual void TestInvokeAuthorizerAsync(const Model::TestInvokeAuthorizerRequest& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TestInvokeAuthorizerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void TestInvokeAuthorizerAsync(Model::TestInvokeAuthorizerRequest&& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -1614,6 +2283,11 @@ namespace Model
          */
         virtual Model::TestInvokeMethodOutcomeCallable TestInvokeMethodCallable(const Model::TestInvokeMethodRequest& request) const;
 
+        /**
+         * Same as TestInvokeMethodCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::TestInvokeMethodOutcomeCallable TestInvokeMethodCallable(Model::TestInvokeMethodRequest&& request) const;
+
         /**
          * 
          *
@@ -1621,6 +2295,11 @@ namespace Model
          */
         virtual void TestInvokeMethodAsync(const Model::TestInvokeMethodRequest& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TestInvokeMethodAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void TestInvokeMethodAsync(Model::TestInvokeMethodRequest&& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about the current <a>Account</a> resource.</p>
          */
@@ -1633,6 +2312,11 @@ namespace Model
          */
         virtual Model::UpdateAccountOutcomeCallable UpdateAccountCallable(const Model::UpdateAccountRequest& request) const;
 
+        /**
+         * Same as UpdateAccountCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateAccountOutcomeCallable UpdateAccountCallable(Model::UpdateAccountRequest&& request) const;
+
         /**
          * <p>Changes information about the current <a>Account</a> resource.</p>
          *
@@ -1640,6 +2324,11 @@ namespace Model
          */
         virtual void UpdateAccountAsync(const Model::UpdateAccountRequest& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAccountAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateAccountAsync(Model::UpdateAccountRequest&& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about an <a>ApiKey</a> resource.</p>
          */
@@ -1652,6 +2341,11 @@ namespace Model
          */
         virtual Model::UpdateApiKeyOutcomeCallable UpdateApiKeyCallable(const Model::UpdateApiKeyRequest& request) const;
 
+        /**
+         * Same as UpdateApiKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateApiKeyOutcomeCallable UpdateApiKeyCallable(Model::UpdateApiKeyRequest&& request) const;
+
         /**
          * <p>Changes information about an <a>ApiKey</a> resource.</p>
          *
@@ -1659,6 +2353,11 @@ namespace Model
          */
         virtual void UpdateApiKeyAsync(const Model::UpdateApiKeyRequest& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateApiKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateApiKeyAsync(Model::UpdateApiKeyRequest&& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates an existing <a>Authorizer</a> resource.</p>
          */
@@ -1671,6 +2370,11 @@ namespace Model
          */
         virtual Model::UpdateAuthorizerOutcomeCallable UpdateAuthorizerCallable(const Model::UpdateAuthorizerRequest& request) const;
 
+        /**
+         * Same as UpdateAuthorizerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateAuthorizerOutcomeCallable UpdateAuthorizerCallable(Model::UpdateAuthorizerRequest&& request) const;
+
         /**
          * <p>Updates an existing <a>Authorizer</a> resource.</p>
          *
@@ -1678,6 +2382,11 @@ namespace Model
          */
         virtual void UpdateAuthorizerAsync(const Model::UpdateAuthorizerRequest& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAuthorizerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateAuthorizerAsync(Model::UpdateAuthorizerRequest&& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about the <a>BasePathMapping</a> resource.</p>
          */
@@ -1690,6 +2399,11 @@ namespace Model
          */
         virtual Model::UpdateBasePathMappingOutcomeCallable UpdateBasePathMappingCallable(const Model::UpdateBasePathMappingRequest& request) const;
 
+        /**
+         * Same as UpdateBasePathMappingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateBasePathMappingOutcomeCallable UpdateBasePathMappingCallable(Model::UpdateBasePathMappingRequest&& request) const;
+
         /**
          * <p>Changes information about the <a>BasePathMapping</a> resource.</p>
          *
@@ -1697,6 +2411,11 @@ namespace Model
          */
         virtual void UpdateBasePathMappingAsync(const Model::UpdateBasePathMappingRequest& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateBasePathMappingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateBasePathMappingAsync(Model::UpdateBasePathMappingRequest&& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -1709,6 +2428,11 @@ namespace Model
          */
         virtual Model::UpdateClientCertificateOutcomeCallable UpdateClientCertificateCallable(const Model::UpdateClientCertificateRequest& request) const;
 
+        /**
+         * Same as UpdateClientCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateClientCertificateOutcomeCallable UpdateClientCertificateCallable(Model::UpdateClientCertificateRequest&& request) const;
+
         /**
          * 
          *
@@ -1716,6 +2440,11 @@ namespace Model
          */
         virtual void UpdateClientCertificateAsync(const Model::UpdateClientCertificateRequest& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateClientCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateClientCertificateAsync(Model::UpdateClientCertificateRequest&& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about a <a>Deployment</a> resource.</p>
          */
@@ -1728,6 +2457,11 @@ namespace Model
          */
         virtual Model::UpdateDeploymentOutcomeCallable UpdateDeploymentCallable(const Model::UpdateDeploymentRequest& request) const;
 
+        /**
+         * Same as UpdateDeploymentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateDeploymentOutcomeCallable UpdateDeploymentCallable(Model::UpdateDeploymentRequest&& request) const;
+
         /**
          * <p>Changes information about a <a>Deployment</a> resource.</p>
          *
@@ -1735,6 +2469,11 @@ namespace Model
          */
         virtual void UpdateDeploymentAsync(const Model::UpdateDeploymentRequest& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDeploymentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateDeploymentAsync(Model::UpdateDeploymentRequest&& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about the <a>DomainName</a> resource.</p>
          */
@@ -1747,6 +2486,11 @@ namespace Model
          */
         virtual Model::UpdateDomainNameOutcomeCallable UpdateDomainNameCallable(const Model::UpdateDomainNameRequest& request) const;
 
+        /**
+         * Same as UpdateDomainNameCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateDomainNameOutcomeCallable UpdateDomainNameCallable(Model::UpdateDomainNameRequest&& request) const;
+
         /**
          * <p>Changes information about the <a>DomainName</a> resource.</p>
          *
@@ -1754,6 +2498,11 @@ namespace Model
          */
         virtual void UpdateDomainNameAsync(const Model::UpdateDomainNameRequest& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDomainNameAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateDomainNameAsync(Model::UpdateDomainNameRequest&& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents an update integration.</p>
          */
@@ -1766,6 +2515,11 @@ namespace Model
          */
         virtual Model::UpdateIntegrationOutcomeCallable UpdateIntegrationCallable(const Model::UpdateIntegrationRequest& request) const;
 
+        /**
+         * Same as UpdateIntegrationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateIntegrationOutcomeCallable UpdateIntegrationCallable(Model::UpdateIntegrationRequest&& request) const;
+
         /**
          * <p>Represents an update integration.</p>
          *
@@ -1773,6 +2527,11 @@ namespace Model
          */
         virtual void UpdateIntegrationAsync(const Model::UpdateIntegrationRequest& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateIntegrationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateIntegrationAsync(Model::UpdateIntegrationRequest&& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents an update integration response.</p>
          */
@@ -1785,6 +2544,11 @@ namespace Model
          */
         virtual Model::UpdateIntegrationResponseOutcomeCallable UpdateIntegrationResponseCallable(const Model::UpdateIntegrationResponseRequest& request) const;
 
+        /**
+         * Same as UpdateIntegrationResponseCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateIntegrationResponseOutcomeCallable UpdateIntegrationResponseCallable(Model::UpdateIntegrationResponseRequest&& request) const;
+
         /**
          * <p>Represents an update integration response.</p>
          *
@@ -1792,6 +2556,11 @@ namespace Model
          */
         virtual void UpdateIntegrationResponseAsync(const Model::UpdateIntegrationResponseRequest& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateIntegrationResponseAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateIntegrationResponseAsync(Model::UpdateIntegrationResponseRequest&& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates an existing <a>Method</a> resource.</p>
          */
@@ -1804,6 +2573,11 @@ namespace Model
          */
         virtual Model::UpdateMethodOutcomeCallable UpdateMethodCallable(const Model::UpdateMethodRequest& request) const;
 
+        /**
+         * Same as UpdateMethodCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateMethodOutcomeCallable UpdateMethodCallable(Model::UpdateMethodRequest&& request) const;
+
         /**
          * <p>Updates an existing <a>Method</a> resource.</p>
          *
@@ -1811,6 +2585,11 @@ namespace Model
          */
         virtual void UpdateMethodAsync(const Model::UpdateMethodRequest& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateMethodAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateMethodAsync(Model::UpdateMethodRequest&& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates an existing <a>MethodResponse</a> resource.</p>
          */
@@ -1823,6 +2602,11 @@ namespace Model
          */
         virtual Model::UpdateMethodResponseOutcomeCallable UpdateMethodResponseCallable(const Model::UpdateMethodResponseRequest& request) const;
 
+        /**
+         * Same as UpdateMethodResponseCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateMethodResponseOutcomeCallable UpdateMethodResponseCallable(Model::UpdateMethodResponseRequest&& request) const;
+
         /**
          * <p>Updates an existing <a>MethodResponse</a> resource.</p>
          *
@@ -1830,6 +2614,11 @@ namespace Model
          */
         virtual void UpdateMethodResponseAsync(const Model::UpdateMethodResponseRequest& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateMethodResponseAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateMethodResponseAsync(Model::UpdateMethodResponseRequest&& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about a model.</p>
          */
@@ -1842,6 +2631,11 @@ namespace Model
          */
         virtual Model::UpdateModelOutcomeCallable UpdateModelCallable(const Model::UpdateModelRequest& request) const;
 
+        /**
+         * Same as UpdateModelCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateModelOutcomeCallable UpdateModelCallable(Model::UpdateModelRequest&& request) const;
+
         /**
          * <p>Changes information about a model.</p>
          *
@@ -1849,6 +2643,11 @@ namespace Model
          */
         virtual void UpdateModelAsync(const Model::UpdateModelRequest& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateModelAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateModelAsync(Model::UpdateModelRequest&& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about a <a>Resource</a> resource.</p>
          */
@@ -1861,6 +2660,11 @@ namespace Model
          */
         virtual Model::UpdateResourceOutcomeCallable UpdateResourceCallable(const Model::UpdateResourceRequest& request) const;
 
+        /**
+         * Same as UpdateResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateResourceOutcomeCallable UpdateResourceCallable(Model::UpdateResourceRequest&& request) const;
+
         /**
          * <p>Changes information about a <a>Resource</a> resource.</p>
          *
@@ -1868,6 +2672,11 @@ namespace Model
          */
         virtual void UpdateResourceAsync(const Model::UpdateResourceRequest& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateResourceAsync(Model::UpdateResourceRequest&& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about the specified API.</p>
          */
@@ -1880,6 +2689,11 @@ namespace Model
          */
         virtual Model::UpdateRestApiOutcomeCallable UpdateRestApiCallable(const Model::UpdateRestApiRequest& request) const;
 
+        /**
+         * Same as UpdateRestApiCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateRestApiOutcomeCallable UpdateRestApiCallable(Model::UpdateRestApiRequest&& request) const;
+
         /**
          * <p>Changes information about the specified API.</p>
          *
@@ -1887,6 +2701,11 @@ namespace Model
          */
         virtual void UpdateRestApiAsync(const Model::UpdateRestApiRequest& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRestApiAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateRestApiAsync(Model::UpdateRestApiRequest&& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about a <a>Stage</a> resource.</p>
          */
@@ -1899,6 +2718,11 @@ namespace Model
          */
         virtual Model::UpdateStageOutcomeCallable UpdateStageCallable(const Model::UpdateStageRequest& request) const;
 
+        /**
+         * Same as UpdateStageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateStageOutcomeCallable UpdateStageCallable(Model::UpdateStageRequest&& request) const;
+
         /**
          * <p>Changes information about a <a>Stage</a> resource.</p>
          *
@@ -1906,6 +2730,168 @@ namespace Model
          */
         virtual void UpdateStageAsync(const Model::UpdateStageRequest& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateStageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateStageAsync(Model::UpdateStageRequest&& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateApiKeyOutcome> CreateApiKeyAwaitable(const Model::CreateApiKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateApiKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateApiKeyOutcome> CreateApiKeyAwaitable(Model::CreateApiKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateApiKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAuthorizerOutcome> CreateAuthorizerAwaitable(const Model::CreateAuthorizerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateAuthorizer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAuthorizerOutcome> CreateAuthorizerAwaitable(Model::CreateAuthorizerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateAuthorizer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateBasePathMappingOutcome> CreateBasePathMappingAwaitable(const Model::CreateBasePathMappingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateBasePathMapping, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateBasePathMappingOutcome> CreateBasePathMappingAwaitable(Model::CreateBasePathMappingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateBasePathMapping, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDeploymentOutcome> CreateDeploymentAwaitable(const Model::CreateDeploymentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateDeployment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDeploymentOutcome> CreateDeploymentAwaitable(Model::CreateDeploymentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateDeployment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDomainNameOutcome> CreateDomainNameAwaitable(const Model::CreateDomainNameRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateDomainName, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDomainNameOutcome> CreateDomainNameAwaitable(Model::CreateDomainNameRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateDomainName, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateModelOutcome> CreateModelAwaitable(const Model::CreateModelRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateModel, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateModelOutcome> CreateModelAwaitable(Model::CreateModelRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateModel, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateResourceOutcome> CreateResourceAwaitable(const Model::CreateResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateResourceOutcome> CreateResourceAwaitable(Model::CreateResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRestApiOutcome> CreateRestApiAwaitable(const Model::CreateRestApiRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateRestApi, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRestApiOutcome> CreateRestApiAwaitable(Model::CreateRestApiRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateRestApi, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateStageOutcome> CreateStageAwaitable(const Model::CreateStageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateStage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateStageOutcome> CreateStageAwaitable(Model::CreateStageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::CreateStage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteApiKeyOutcome> DeleteApiKeyAwaitable(const Model::DeleteApiKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteApiKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteApiKeyOutcome> DeleteApiKeyAwaitable(Model::DeleteApiKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteApiKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAuthorizerOutcome> DeleteAuthorizerAwaitable(const Model::DeleteAuthorizerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteAuthorizer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAuthorizerOutcome> DeleteAuthorizerAwaitable(Model::DeleteAuthorizerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteAuthorizer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBasePathMappingOutcome> DeleteBasePathMappingAwaitable(const Model::DeleteBasePathMappingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteBasePathMapping, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBasePathMappingOutcome> DeleteBasePathMappingAwaitable(Model::DeleteBasePathMappingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteBasePathMapping, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteClientCertificateOutcome> DeleteClientCertificateAwaitable(const Model::DeleteClientCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteClientCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteClientCertificateOutcome> DeleteClientCertificateAwaitable(Model::DeleteClientCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteClientCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDeploymentOutcome> DeleteDeploymentAwaitable(const Model::DeleteDeploymentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteDeployment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDeploymentOutcome> DeleteDeploymentAwaitable(Model::DeleteDeploymentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteDeployment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDomainNameOutcome> DeleteDomainNameAwaitable(const Model::DeleteDomainNameRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteDomainName, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDomainNameOutcome> DeleteDomainNameAwaitable(Model::DeleteDomainNameRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteDomainName, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIntegrationOutcome> DeleteIntegrationAwaitable(const Model::DeleteIntegrationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteIntegration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIntegrationOutcome> DeleteIntegrationAwaitable(Model::DeleteIntegrationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteIntegration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIntegrationResponseOutcome> DeleteIntegrationResponseAwaitable(const Model::DeleteIntegrationResponseRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteIntegrationResponse, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIntegrationResponseOutcome> DeleteIntegrationResponseAwaitable(Model::DeleteIntegrationResponseRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteIntegrationResponse, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteMethodOutcome> DeleteMethodAwaitable(const Model::DeleteMethodRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteMethod, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteMethodOutcome> DeleteMethodAwaitable(Model::DeleteMethodRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteMethod, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteMethodResponseOutcome> DeleteMethodResponseAwaitable(const Model::DeleteMethodResponseRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteMethodResponse, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteMethodResponseOutcome> DeleteMethodResponseAwaitable(Model::DeleteMethodResponseRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteMethodResponse, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteModelOutcome> DeleteModelAwaitable(const Model::DeleteModelRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteModel, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteModelOutcome> DeleteModelAwaitable(Model::DeleteModelRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteModel, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteResourceOutcome> DeleteResourceAwaitable(const Model::DeleteResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteResourceOutcome> DeleteResourceAwaitable(Model::DeleteResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRestApiOutcome> DeleteRestApiAwaitable(const Model::DeleteRestApiRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteRestApi, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRestApiOutcome> DeleteRestApiAwaitable(Model::DeleteRestApiRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteRestApi, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteStageOutcome> DeleteStageAwaitable(const Model::DeleteStageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteStage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteStageOutcome> DeleteStageAwaitable(Model::DeleteStageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::DeleteStage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::FlushStageAuthorizersCacheOutcome> FlushStageAuthorizersCacheAwaitable(const Model::FlushStageAuthorizersCacheRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::FlushStageAuthorizersCache, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::FlushStageAuthorizersCacheOutcome> FlushStageAuthorizersCacheAwaitable(Model::FlushStageAuthorizersCacheRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::FlushStageAuthorizersCache, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::FlushStageCacheOutcome> FlushStageCacheAwaitable(const Model::FlushStageCacheRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::FlushStageCache, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::FlushStageCacheOutcome> FlushStageCacheAwaitable(Model::FlushStageCacheRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::FlushStageCache, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GenerateClientCertificateOutcome> GenerateClientCertificateAwaitable(const Model::GenerateClientCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GenerateClientCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GenerateClientCertificateOutcome> GenerateClientCertificateAwaitable(Model::GenerateClientCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GenerateClientCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAccountOutcome> GetAccountAwaitable(const Model::GetAccountRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetAccount, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAccountOutcome> GetAccountAwaitable(Model::GetAccountRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetAccount, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetApiKeyOutcome> GetApiKeyAwaitable(const Model::GetApiKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetApiKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetApiKeyOutcome> GetApiKeyAwaitable(Model::GetApiKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetApiKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetApiKeysOutcome> GetApiKeysAwaitable(const Model::GetApiKeysRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetApiKeys, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetApiKeysOutcome> GetApiKeysAwaitable(Model::GetApiKeysRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetApiKeys, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAuthorizerOutcome> GetAuthorizerAwaitable(const Model::GetAuthorizerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetAuthorizer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAuthorizerOutcome> GetAuthorizerAwaitable(Model::GetAuthorizerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetAuthorizer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAuthorizersOutcome> GetAuthorizersAwaitable(const Model::GetAuthorizersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetAuthorizers, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAuthorizersOutcome> GetAuthorizersAwaitable(Model::GetAuthorizersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetAuthorizers, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBasePathMappingOutcome> GetBasePathMappingAwaitable(const Model::GetBasePathMappingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetBasePathMapping, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBasePathMappingOutcome> GetBasePathMappingAwaitable(Model::GetBasePathMappingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetBasePathMapping, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBasePathMappingsOutcome> GetBasePathMappingsAwaitable(const Model::GetBasePathMappingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetBasePathMappings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBasePathMappingsOutcome> GetBasePathMappingsAwaitable(Model::GetBasePathMappingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetBasePathMappings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetClientCertificateOutcome> GetClientCertificateAwaitable(const Model::GetClientCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetClientCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetClientCertificateOutcome> GetClientCertificateAwaitable(Model::GetClientCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetClientCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetClientCertificatesOutcome> GetClientCertificatesAwaitable(const Model::GetClientCertificatesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetClientCertificates, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetClientCertificatesOutcome> GetClientCertificatesAwaitable(Model::GetClientCertificatesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetClientCertificates, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDeploymentOutcome> GetDeploymentAwaitable(const Model::GetDeploymentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetDeployment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDeploymentOutcome> GetDeploymentAwaitable(Model::GetDeploymentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetDeployment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDeploymentsOutcome> GetDeploymentsAwaitable(const Model::GetDeploymentsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetDeployments, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDeploymentsOutcome> GetDeploymentsAwaitable(Model::GetDeploymentsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetDeployments, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDomainNameOutcome> GetDomainNameAwaitable(const Model::GetDomainNameRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetDomainName, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDomainNameOutcome> GetDomainNameAwaitable(Model::GetDomainNameRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetDomainName, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDomainNamesOutcome> GetDomainNamesAwaitable(const Model::GetDomainNamesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetDomainNames, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDomainNamesOutcome> GetDomainNamesAwaitable(Model::GetDomainNamesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetDomainNames, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetExportOutcome> GetExportAwaitable(const Model::GetExportRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetExport, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetExportOutcome> GetExportAwaitable(Model::GetExportRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetExport, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIntegrationOutcome> GetIntegrationAwaitable(const Model::GetIntegrationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetIntegration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIntegrationOutcome> GetIntegrationAwaitable(Model::GetIntegrationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetIntegration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIntegrationResponseOutcome> GetIntegrationResponseAwaitable(const Model::GetIntegrationResponseRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetIntegrationResponse, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIntegrationResponseOutcome> GetIntegrationResponseAwaitable(Model::GetIntegrationResponseRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetIntegrationResponse, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetMethodOutcome> GetMethodAwaitable(const Model::GetMethodRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetMethod, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetMethodOutcome> GetMethodAwaitable(Model::GetMethodRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetMethod, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetMethodResponseOutcome> GetMethodResponseAwaitable(const Model::GetMethodResponseRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetMethodResponse, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetMethodResponseOutcome> GetMethodResponseAwaitable(Model::GetMethodResponseRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetMethodResponse, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetModelOutcome> GetModelAwaitable(const Model::GetModelRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetModel, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetModelOutcome> GetModelAwaitable(Model::GetModelRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetModel, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetModelTemplateOutcome> GetModelTemplateAwaitable(const Model::GetModelTemplateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetModelTemplate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetModelTemplateOutcome> GetModelTemplateAwaitable(Model::GetModelTemplateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetModelTemplate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetModelsOutcome> GetModelsAwaitable(const Model::GetModelsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetModels, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetModelsOutcome> GetModelsAwaitable(Model::GetModelsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetModels, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetResourceOutcome> GetResourceAwaitable(const Model::GetResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetResourceOutcome> GetResourceAwaitable(Model::GetResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetResourcesOutcome> GetResourcesAwaitable(const Model::GetResourcesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetResources, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetResourcesOutcome> GetResourcesAwaitable(Model::GetResourcesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetResources, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRestApiOutcome> GetRestApiAwaitable(const Model::GetRestApiRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetRestApi, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRestApiOutcome> GetRestApiAwaitable(Model::GetRestApiRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetRestApi, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRestApisOutcome> GetRestApisAwaitable(const Model::GetRestApisRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetRestApis, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRestApisOutcome> GetRestApisAwaitable(Model::GetRestApisRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetRestApis, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSdkOutcome> GetSdkAwaitable(const Model::GetSdkRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetSdk, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSdkOutcome> GetSdkAwaitable(Model::GetSdkRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetSdk, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetStageOutcome> GetStageAwaitable(const Model::GetStageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetStage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetStageOutcome> GetStageAwaitable(Model::GetStageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetStage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetStagesOutcome> GetStagesAwaitable(const Model::GetStagesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetStages, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetStagesOutcome> GetStagesAwaitable(Model::GetStagesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::GetStages, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutIntegrationOutcome> PutIntegrationAwaitable(const Model::PutIntegrationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::PutIntegration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutIntegrationOutcome> PutIntegrationAwaitable(Model::PutIntegrationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::PutIntegration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutIntegrationResponseOutcome> PutIntegrationResponseAwaitable(const Model::PutIntegrationResponseRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::PutIntegrationResponse, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutIntegrationResponseOutcome> PutIntegrationResponseAwaitable(Model::PutIntegrationResponseRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::PutIntegrationResponse, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutMethodOutcome> PutMethodAwaitable(const Model::PutMethodRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::PutMethod, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutMethodOutcome> PutMethodAwaitable(Model::PutMethodRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::PutMethod, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutMethodResponseOutcome> PutMethodResponseAwaitable(const Model::PutMethodResponseRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::PutMethodResponse, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutMethodResponseOutcome> PutMethodResponseAwaitable(Model::PutMethodResponseRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::PutMethodResponse, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TestInvokeAuthorizerOutcome> TestInvokeAuthorizerAwaitable(const Model::TestInvokeAuthorizerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::TestInvokeAuthorizer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TestInvokeAuthorizerOutcome> TestInvokeAuthorizerAwaitable(Model::TestInvokeAuthorizerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::TestInvokeAuthorizer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TestInvokeMethodOutcome> TestInvokeMethodAwaitable(const Model::TestInvokeMethodRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::TestInvokeMethod, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TestInvokeMethodOutcome> TestInvokeMethodAwaitable(Model::TestInvokeMethodRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::TestInvokeMethod, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAccountOutcome> UpdateAccountAwaitable(const Model::UpdateAccountRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateAccount, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAccountOutcome> UpdateAccountAwaitable(Model::UpdateAccountRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateAccount, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateApiKeyOutcome> UpdateApiKeyAwaitable(const Model::UpdateApiKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateApiKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateApiKeyOutcome> UpdateApiKeyAwaitable(Model::UpdateApiKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateApiKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAuthorizerOutcome> UpdateAuthorizerAwaitable(const Model::UpdateAuthorizerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateAuthorizer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAuthorizerOutcome> UpdateAuthorizerAwaitable(Model::UpdateAuthorizerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateAuthorizer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateBasePathMappingOutcome> UpdateBasePathMappingAwaitable(const Model::UpdateBasePathMappingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateBasePathMapping, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateBasePathMappingOutcome> UpdateBasePathMappingAwaitable(Model::UpdateBasePathMappingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateBasePathMapping, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateClientCertificateOutcome> UpdateClientCertificateAwaitable(const Model::UpdateClientCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateClientCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateClientCertificateOutcome> UpdateClientCertificateAwaitable(Model::UpdateClientCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateClientCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDeploymentOutcome> UpdateDeploymentAwaitable(const Model::UpdateDeploymentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateDeployment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDeploymentOutcome> UpdateDeploymentAwaitable(Model::UpdateDeploymentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateDeployment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDomainNameOutcome> UpdateDomainNameAwaitable(const Model::UpdateDomainNameRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateDomainName, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDomainNameOutcome> UpdateDomainNameAwaitable(Model::UpdateDomainNameRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateDomainName, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateIntegrationOutcome> UpdateIntegrationAwaitable(const Model::UpdateIntegrationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateIntegration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateIntegrationOutcome> UpdateIntegrationAwaitable(Model::UpdateIntegrationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateIntegration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateIntegrationResponseOutcome> UpdateIntegrationResponseAwaitable(const Model::UpdateIntegrationResponseRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateIntegrationResponse, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateIntegrationResponseOutcome> UpdateIntegrationResponseAwaitable(Model::UpdateIntegrationResponseRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateIntegrationResponse, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateMethodOutcome> UpdateMethodAwaitable(const Model::UpdateMethodRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateMethod, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateMethodOutcome> UpdateMethodAwaitable(Model::UpdateMethodRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateMethod, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateMethodResponseOutcome> UpdateMethodResponseAwaitable(const Model::UpdateMethodResponseRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateMethodResponse, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateMethodResponseOutcome> UpdateMethodResponseAwaitable(Model::UpdateMethodResponseRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateMethodResponse, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateModelOutcome> UpdateModelAwaitable(const Model::UpdateModelRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateModel, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateModelOutcome> UpdateModelAwaitable(Model::UpdateModelRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateModel, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateResourceOutcome> UpdateResourceAwaitable(const Model::UpdateResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateResourceOutcome> UpdateResourceAwaitable(Model::UpdateResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateRestApiOutcome> UpdateRestApiAwaitable(const Model::UpdateRestApiRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateRestApi, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateRestApiOutcome> UpdateRestApiAwaitable(Model::UpdateRestApiRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateRestApi, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateStageOutcome> UpdateStageAwaitable(const Model::UpdateStageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateStage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateStageOutcome> UpdateStageAwaitable(Model::UpdateStageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &APIGatewayClient::UpdateStage, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
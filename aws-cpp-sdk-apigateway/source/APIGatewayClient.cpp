@@ -182,12 +182,22 @@ CreateApiKeyOutcome APIGatewayClient::CreateApiKey(const CreateApiKeyRequest& re
 
 CreateApiKeyOutcomeCallable APIGatewayClient::CreateApiKeyCallable(const CreateApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateApiKey, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateApiKey, Aws::Client::RejectedCallOutcome<CreateApiKeyOutcome>(), this, request);
+}
+
+CreateApiKeyOutcomeCallable APIGatewayClient::CreateApiKeyCallable(CreateApiKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateApiKey, Aws::Client::RejectedCallOutcome<CreateApiKeyOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::CreateApiKeyAsync(const CreateApiKeyRequest& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateApiKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateApiKeyAsyncHelper, Aws::Client::RejectedAsyncCall<CreateApiKeyOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::CreateApiKeyAsync(CreateApiKeyRequest&& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateApiKeyAsyncHelper, Aws::Client::RejectedAsyncCall<CreateApiKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::CreateApiKeyAsyncHelper(const CreateApiKeyRequest& request, const CreateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -215,12 +225,22 @@ CreateAuthorizerOutcome APIGatewayClient::CreateAuthorizer(const CreateAuthorize
 
 CreateAuthorizerOutcomeCallable APIGatewayClient::CreateAuthorizerCallable(const CreateAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateAuthorizer, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateAuthorizer, Aws::Client::RejectedCallOutcome<CreateAuthorizerOutcome>(), this, request);
+}
+
+CreateAuthorizerOutcomeCallable APIGatewayClient::CreateAuthorizerCallable(CreateAuthorizerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateAuthorizer, Aws::Client::RejectedCallOutcome<CreateAuthorizerOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::CreateAuthorizerAsync(const CreateAuthorizerRequest& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateAuthorizerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateAuthorizerAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAuthorizerOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::CreateAuthorizerAsync(CreateAuthorizerRequest&& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateAuthorizerAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAuthorizerOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::CreateAuthorizerAsyncHelper(const CreateAuthorizerRequest& request, const CreateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -248,12 +268,22 @@ CreateBasePathMappingOutcome APIGatewayClient::CreateBasePathMapping(const Creat
 
 CreateBasePathMappingOutcomeCallable APIGatewayClient::CreateBasePathMappingCallable(const CreateBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateBasePathMapping, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateBasePathMapping, Aws::Client::RejectedCallOutcome<CreateBasePathMappingOutcome>(), this, request);
+}
+
+CreateBasePathMappingOutcomeCallable APIGatewayClient::CreateBasePathMappingCallable(CreateBasePathMappingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateBasePathMapping, Aws::Client::RejectedCallOutcome<CreateBasePathMappingOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::CreateBasePathMappingAsync(const CreateBasePathMappingRequest& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateBasePathMappingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateBasePathMappingAsyncHelper, Aws::Client::RejectedAsyncCall<CreateBasePathMappingOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::CreateBasePathMappingAsync(CreateBasePathMappingRequest&& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateBasePathMappingAsyncHelper, Aws::Client::RejectedAsyncCall<CreateBasePathMappingOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::CreateBasePathMappingAsyncHelper(const CreateBasePathMappingRequest& request, const CreateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -281,12 +311,22 @@ CreateDeploymentOutcome APIGatewayClient::CreateDeployment(const CreateDeploymen
 
 CreateDeploymentOutcomeCallable APIGatewayClient::CreateDeploymentCallable(const CreateDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateDeployment, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateDeployment, Aws::Client::RejectedCallOutcome<CreateDeploymentOutcome>(), this, request);
+}
+
+CreateDeploymentOutcomeCallable APIGatewayClient::CreateDeploymentCallable(CreateDeploymentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateDeployment, Aws::Client::RejectedCallOutcome<CreateDeploymentOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::CreateDeploymentAsync(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateDeploymentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDeploymentOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::CreateDeploymentAsync(CreateDeploymentRequest&& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDeploymentOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::CreateDeploymentAsyncHelper(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -312,12 +352,22 @@ CreateDomainNameOutcome APIGatewayClient::CreateDomainName(const CreateDomainNam
 
 CreateDomainNameOutcomeCallable APIGatewayClient::CreateDomainNameCallable(const CreateDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateDomainName, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateDomainName, Aws::Client::RejectedCallOutcome<CreateDomainNameOutcome>(), this, request);
+}
+
+CreateDomainNameOutcomeCallable APIGatewayClient::CreateDomainNameCallable(CreateDomainNameRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateDomainName, Aws::Client::RejectedCallOutcome<CreateDomainNameOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::CreateDomainNameAsync(const CreateDomainNameRequest& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateDomainNameAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateDomainNameAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDomainNameOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::CreateDomainNameAsync(CreateDomainNameRequest&& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateDomainNameAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDomainNameOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::CreateDomainNameAsyncHelper(const CreateDomainNameRequest& request, const CreateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -345,12 +395,22 @@ CreateModelOutcome APIGatewayClient::CreateModel(const CreateModelRequest& reque
 
 CreateModelOutcomeCallable APIGatewayClient::CreateModelCallable(const CreateModelRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateModel, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateModel, Aws::Client::RejectedCallOutcome<CreateModelOutcome>(), this, request);
+}
+
+CreateModelOutcomeCallable APIGatewayClient::CreateModelCallable(CreateModelRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateModel, Aws::Client::RejectedCallOutcome<CreateModelOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::CreateModelAsync(const CreateModelRequest& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateModelAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateModelAsyncHelper, Aws::Client::RejectedAsyncCall<CreateModelOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::CreateModelAsync(CreateModelRequest&& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateModelAsyncHelper, Aws::Client::RejectedAsyncCall<CreateModelOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::CreateModelAsyncHelper(const CreateModelRequest& request, const CreateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -379,12 +439,22 @@ CreateResourceOutcome APIGatewayClient::CreateResource(const CreateResourceReque
 
 CreateResourceOutcomeCallable APIGatewayClient::CreateResourceCallable(const CreateResourceRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateResource, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateResource, Aws::Client::RejectedCallOutcome<CreateResourceOutcome>(), this, request);
+}
+
+CreateResourceOutcomeCallable APIGatewayClient::CreateResourceCallable(CreateResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateResource, Aws::Client::RejectedCallOutcome<CreateResourceOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::CreateResourceAsync(const CreateResourceRequest& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateResourceAsyncHelper, Aws::Client::RejectedAsyncCall<CreateResourceOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::CreateResourceAsync(CreateResourceRequest&& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateResourceAsyncHelper, Aws::Client::RejectedAsyncCall<CreateResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::CreateResourceAsyncHelper(const CreateResourceRequest& request, const CreateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -410,12 +480,22 @@ CreateRestApiOutcome APIGatewayClient::CreateRestApi(const CreateRestApiRequest&
 
 CreateRestApiOutcomeCallable APIGatewayClient::CreateRestApiCallable(const CreateRestApiRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateRestApi, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateRestApi, Aws::Client::RejectedCallOutcome<CreateRestApiOutcome>(), this, request);
+}
+
+CreateRestApiOutcomeCallable APIGatewayClient::CreateRestApiCallable(CreateRestApiRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateRestApi, Aws::Client::RejectedCallOutcome<CreateRestApiOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::CreateRestApiAsync(const CreateRestApiRequest& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateRestApiAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateRestApiAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRestApiOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::CreateRestApiAsync(CreateRestApiRequest&& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateRestApiAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRestApiOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::CreateRestApiAsyncHelper(const CreateRestApiRequest& request, const CreateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -443,12 +523,22 @@ CreateStageOutcome APIGatewayClient::CreateStage(const CreateStageRequest& reque
 
 CreateStageOutcomeCallable APIGatewayClient::CreateStageCallable(const CreateStageRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::CreateStage, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateStage, Aws::Client::RejectedCallOutcome<CreateStageOutcome>(), this, request);
+}
+
+CreateStageOutcomeCallable APIGatewayClient::CreateStageCallable(CreateStageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::CreateStage, Aws::Client::RejectedCallOutcome<CreateStageOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::CreateStageAsync(const CreateStageRequest& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::CreateStageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateStageAsyncHelper, Aws::Client::RejectedAsyncCall<CreateStageOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::CreateStageAsync(CreateStageRequest&& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::CreateStageAsyncHelper, Aws::Client::RejectedAsyncCall<CreateStageOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::CreateStageAsyncHelper(const CreateStageRequest& request, const CreateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -475,12 +565,22 @@ DeleteApiKeyOutcome APIGatewayClient::DeleteApiKey(const DeleteApiKeyRequest& re
 
 DeleteApiKeyOutcomeCallable APIGatewayClient::DeleteApiKeyCallable(const DeleteApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteApiKey, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteApiKey, Aws::Client::RejectedCallOutcome<DeleteApiKeyOutcome>(), this, request);
+}
+
+DeleteApiKeyOutcomeCallable APIGatewayClient::DeleteApiKeyCallable(DeleteApiKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteApiKey, Aws::Client::RejectedCallOutcome<DeleteApiKeyOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::DeleteApiKeyAsync(const DeleteApiKeyRequest& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteApiKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteApiKeyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteApiKeyOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::DeleteApiKeyAsync(DeleteApiKeyRequest&& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteApiKeyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteApiKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::DeleteApiKeyAsyncHelper(const DeleteApiKeyRequest& request, const DeleteApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -509,12 +609,22 @@ DeleteAuthorizerOutcome APIGatewayClient::DeleteAuthorizer(const DeleteAuthorize
 
 DeleteAuthorizerOutcomeCallable APIGatewayClient::DeleteAuthorizerCallable(const DeleteAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteAuthorizer, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteAuthorizer, Aws::Client::RejectedCallOutcome<DeleteAuthorizerOutcome>(), this, request);
+}
+
+DeleteAuthorizerOutcomeCallable APIGatewayClient::DeleteAuthorizerCallable(DeleteAuthorizerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteAuthorizer, Aws::Client::RejectedCallOutcome<DeleteAuthorizerOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::DeleteAuthorizerAsync(const DeleteAuthorizerRequest& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteAuthorizerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteAuthorizerAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAuthorizerOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::DeleteAuthorizerAsync(DeleteAuthorizerRequest&& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteAuthorizerAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAuthorizerOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::DeleteAuthorizerAsyncHelper(const DeleteAuthorizerRequest& request, const DeleteAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -543,12 +653,22 @@ DeleteBasePathMappingOutcome APIGatewayClient::DeleteBasePathMapping(const Delet
 
 DeleteBasePathMappingOutcomeCallable APIGatewayClient::DeleteBasePathMappingCallable(const DeleteBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteBasePathMapping, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteBasePathMapping, Aws::Client::RejectedCallOutcome<DeleteBasePathMappingOutcome>(), this, request);
+}
+
+DeleteBasePathMappingOutcomeCallable APIGatewayClient::DeleteBasePathMappingCallable(DeleteBasePathMappingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteBasePathMapping, Aws::Client::RejectedCallOutcome<DeleteBasePathMappingOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::DeleteBasePathMappingAsync(const DeleteBasePathMappingRequest& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteBasePathMappingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteBasePathMappingAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBasePathMappingOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::DeleteBasePathMappingAsync(DeleteBasePathMappingRequest&& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteBasePathMappingAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBasePathMappingOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::DeleteBasePathMappingAsyncHelper(const DeleteBasePathMappingRequest& request, const DeleteBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -575,12 +695,22 @@ DeleteClientCertificateOutcome APIGatewayClient::DeleteClientCertificate(const D
 
 DeleteClientCertificateOutcomeCallable APIGatewayClient::DeleteClientCertificateCallable(const DeleteClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteClientCertificate, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteClientCertificate, Aws::Client::RejectedCallOutcome<DeleteClientCertificateOutcome>(), this, request);
+}
+
+DeleteClientCertificateOutcomeCallable APIGatewayClient::DeleteClientCertificateCallable(DeleteClientCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteClientCertificate, Aws::Client::RejectedCallOutcome<DeleteClientCertificateOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::DeleteClientCertificateAsync(const DeleteClientCertificateRequest& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteClientCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteClientCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteClientCertificateOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::DeleteClientCertificateAsync(DeleteClientCertificateRequest&& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteClientCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteClientCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::DeleteClientCertificateAsyncHelper(const DeleteClientCertificateRequest& request, const DeleteClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -609,12 +739,22 @@ DeleteDeploymentOutcome APIGatewayClient::DeleteDeployment(const DeleteDeploymen
 
 DeleteDeploymentOutcomeCallable APIGatewayClient::DeleteDeploymentCallable(const DeleteDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteDeployment, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteDeployment, Aws::Client::RejectedCallOutcome<DeleteDeploymentOutcome>(), this, request);
+}
+
+DeleteDeploymentOutcomeCallable APIGatewayClient::DeleteDeploymentCallable(DeleteDeploymentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteDeployment, Aws::Client::RejectedCallOutcome<DeleteDeploymentOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::DeleteDeploymentAsync(const DeleteDeploymentRequest& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteDeploymentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDeploymentOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::DeleteDeploymentAsync(DeleteDeploymentRequest&& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDeploymentOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::DeleteDeploymentAsyncHelper(const DeleteDeploymentRequest& request, const DeleteDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -641,12 +781,22 @@ DeleteDomainNameOutcome APIGatewayClient::DeleteDomainName(const DeleteDomainNam
 
 DeleteDomainNameOutcomeCallable APIGatewayClient::DeleteDomainNameCallable(const DeleteDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteDomainName, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteDomainName, Aws::Client::RejectedCallOutcome<DeleteDomainNameOutcome>(), this, request);
+}
+
+DeleteDomainNameOutcomeCallable APIGatewayClient::DeleteDomainNameCallable(DeleteDomainNameRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteDomainName, Aws::Client::RejectedCallOutcome<DeleteDomainNameOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::DeleteDomainNameAsync(const DeleteDomainNameRequest& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteDomainNameAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteDomainNameAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDomainNameOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::DeleteDomainNameAsync(DeleteDomainNameRequest&& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteDomainNameAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDomainNameOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::DeleteDomainNameAsyncHelper(const DeleteDomainNameRequest& request, const DeleteDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -678,12 +828,22 @@ DeleteIntegrationOutcome APIGatewayClient::DeleteIntegration(const DeleteIntegra
 
 DeleteIntegrationOutcomeCallable APIGatewayClient::DeleteIntegrationCallable(const DeleteIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteIntegration, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteIntegration, Aws::Client::RejectedCallOutcome<DeleteIntegrationOutcome>(), this, request);
+}
+
+DeleteIntegrationOutcomeCallable APIGatewayClient::DeleteIntegrationCallable(DeleteIntegrationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteIntegration, Aws::Client::RejectedCallOutcome<DeleteIntegrationOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::DeleteIntegrationAsync(const DeleteIntegrationRequest& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteIntegrationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteIntegrationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIntegrationOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::DeleteIntegrationAsync(DeleteIntegrationRequest&& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteIntegrationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIntegrationOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::DeleteIntegrationAsyncHelper(const DeleteIntegrationRequest& request, const DeleteIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -716,12 +876,22 @@ DeleteIntegrationResponseOutcome APIGatewayClient::DeleteIntegrationResponse(con
 
 DeleteIntegrationResponseOutcomeCallable APIGatewayClient::DeleteIntegrationResponseCallable(const DeleteIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteIntegrationResponse, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteIntegrationResponse, Aws::Client::RejectedCallOutcome<DeleteIntegrationResponseOutcome>(), this, request);
+}
+
+DeleteIntegrationResponseOutcomeCallable APIGatewayClient::DeleteIntegrationResponseCallable(DeleteIntegrationResponseRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteIntegrationResponse, Aws::Client::RejectedCallOutcome<DeleteIntegrationResponseOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::DeleteIntegrationResponseAsync(const DeleteIntegrationResponseRequest& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteIntegrationResponseAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteIntegrationResponseAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIntegrationResponseOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::DeleteIntegrationResponseAsync(DeleteIntegrationResponseRequest&& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteIntegrationResponseAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIntegrationResponseOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::DeleteIntegrationResponseAsyncHelper(const DeleteIntegrationResponseRequest& request, const DeleteIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -752,12 +922,22 @@ DeleteMethodOutcome APIGatewayClient::DeleteMethod(const DeleteMethodRequest& re
 
 DeleteMethodOutcomeCallable APIGatewayClient::DeleteMethodCallable(const DeleteMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteMethod, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteMethod, Aws::Client::RejectedCallOutcome<DeleteMethodOutcome>(), this, request);
+}
+
+DeleteMethodOutcomeCallable APIGatewayClient::DeleteMethodCallable(DeleteMethodRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteMethod, Aws::Client::RejectedCallOutcome<DeleteMethodOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::DeleteMethodAsync(const DeleteMethodRequest& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteMethodAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteMethodAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteMethodOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::DeleteMethodAsync(DeleteMethodRequest&& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteMethodAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteMethodOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::DeleteMethodAsyncHelper(const DeleteMethodRequest& request, const DeleteMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -790,12 +970,22 @@ DeleteMethodResponseOutcome APIGatewayClient::DeleteMethodResponse(const DeleteM
 
 DeleteMethodResponseOutcomeCallable APIGatewayClient::DeleteMethodResponseCallable(const DeleteMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteMethodResponse, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteMethodResponse, Aws::Client::RejectedCallOutcome<DeleteMethodResponseOutcome>(), this, request);
+}
+
+DeleteMethodResponseOutcomeCallable APIGatewayClient::DeleteMethodResponseCallable(DeleteMethodResponseRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteMethodResponse, Aws::Client::RejectedCallOutcome<DeleteMethodResponseOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::DeleteMethodResponseAsync(const DeleteMethodResponseRequest& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteMethodResponseAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteMethodResponseAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteMethodResponseOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::DeleteMethodResponseAsync(DeleteMethodResponseRequest&& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteMethodResponseAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteMethodResponseOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::DeleteMethodResponseAsyncHelper(const DeleteMethodResponseRequest& request, const DeleteMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -824,12 +1014,22 @@ DeleteModelOutcome APIGatewayClient::DeleteModel(const DeleteModelRequest& reque
 
 DeleteModelOutcomeCallable APIGatewayClient::DeleteModelCallable(const DeleteModelRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteModel, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteModel, Aws::Client::RejectedCallOutcome<DeleteModelOutcome>(), this, request);
+}
+
+DeleteModelOutcomeCallable APIGatewayClient::DeleteModelCallable(DeleteModelRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteModel, Aws::Client::RejectedCallOutcome<DeleteModelOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::DeleteModelAsync(const DeleteModelRequest& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteModelAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteModelAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteModelOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::DeleteModelAsync(DeleteModelRequest&& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteModelAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteModelOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::DeleteModelAsyncHelper(const DeleteModelRequest& request, const DeleteModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -858,12 +1058,22 @@ DeleteResourceOutcome APIGatewayClient::DeleteResource(const DeleteResourceReque
 
 DeleteResourceOutcomeCallable APIGatewayClient::DeleteResourceCallable(const DeleteResourceRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteResource, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteResource, Aws::Client::RejectedCallOutcome<DeleteResourceOutcome>(), this, request);
+}
+
+DeleteResourceOutcomeCallable APIGatewayClient::DeleteResourceCallable(DeleteResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteResource, Aws::Client::RejectedCallOutcome<DeleteResourceOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::DeleteResourceAsync(const DeleteResourceRequest& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteResourceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteResourceOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::DeleteResourceAsync(DeleteResourceRequest&& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteResourceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::DeleteResourceAsyncHelper(const DeleteResourceRequest& request, const DeleteResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -890,12 +1100,22 @@ DeleteRestApiOutcome APIGatewayClient::DeleteRestApi(const DeleteRestApiRequest&
 
 DeleteRestApiOutcomeCallable APIGatewayClient::DeleteRestApiCallable(const DeleteRestApiRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteRestApi, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteRestApi, Aws::Client::RejectedCallOutcome<DeleteRestApiOutcome>(), this, request);
+}
+
+DeleteRestApiOutcomeCallable APIGatewayClient::DeleteRestApiCallable(DeleteRestApiRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteRestApi, Aws::Client::RejectedCallOutcome<DeleteRestApiOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::DeleteRestApiAsync(const DeleteRestApiRequest& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteRestApiAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteRestApiAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRestApiOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::DeleteRestApiAsync(DeleteRestApiRequest&& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteRestApiAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRestApiOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::DeleteRestApiAsyncHelper(const DeleteRestApiRequest& request, const DeleteRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -924,12 +1144,22 @@ DeleteStageOutcome APIGatewayClient::DeleteStage(const DeleteStageRequest& reque
 
 DeleteStageOutcomeCallable APIGatewayClient::DeleteStageCallable(const DeleteStageRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::DeleteStage, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteStage, Aws::Client::RejectedCallOutcome<DeleteStageOutcome>(), this, request);
+}
+
+DeleteStageOutcomeCallable APIGatewayClient::DeleteStageCallable(DeleteStageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::DeleteStage, Aws::Client::RejectedCallOutcome<DeleteStageOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::DeleteStageAsync(const DeleteStageRequest& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::DeleteStageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteStageAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteStageOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::DeleteStageAsync(DeleteStageRequest&& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::DeleteStageAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteStageOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::DeleteStageAsyncHelper(const DeleteStageRequest& request, const DeleteStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -959,12 +1189,22 @@ FlushStageAuthorizersCacheOutcome APIGatewayClient::FlushStageAuthorizersCache(c
 
 FlushStageAuthorizersCacheOutcomeCallable APIGatewayClient::FlushStageAuthorizersCacheCallable(const FlushStageAuthorizersCacheRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::FlushStageAuthorizersCache, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::FlushStageAuthorizersCache, Aws::Client::RejectedCallOutcome<FlushStageAuthorizersCacheOutcome>(), this, request);
+}
+
+FlushStageAuthorizersCacheOutcomeCallable APIGatewayClient::FlushStageAuthorizersCacheCallable(FlushStageAuthorizersCacheRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::FlushStageAuthorizersCache, Aws::Client::RejectedCallOutcome<FlushStageAuthorizersCacheOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::FlushStageAuthorizersCacheAsync(const FlushStageAuthorizersCacheRequest& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::FlushStageAuthorizersCacheAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::FlushStageAuthorizersCacheAsyncHelper, Aws::Client::RejectedAsyncCall<FlushStageAuthorizersCacheOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::FlushStageAuthorizersCacheAsync(FlushStageAuthorizersCacheRequest&& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::FlushStageAuthorizersCacheAsyncHelper, Aws::Client::RejectedAsyncCall<FlushStageAuthorizersCacheOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::FlushStageAuthorizersCacheAsyncHelper(const FlushStageAuthorizersCacheRequest& request, const FlushStageAuthorizersCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -994,12 +1234,22 @@ FlushStageCacheOutcome APIGatewayClient::FlushStageCache(const FlushStageCacheRe
 
 FlushStageCacheOutcomeCallable APIGatewayClient::FlushStageCacheCallable(const FlushStageCacheRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::FlushStageCache, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::FlushStageCache, Aws::Client::RejectedCallOutcome<FlushStageCacheOutcome>(), this, request);
+}
+
+FlushStageCacheOutcomeCallable APIGatewayClient::FlushStageCacheCallable(FlushStageCacheRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::FlushStageCache, Aws::Client::RejectedCallOutcome<FlushStageCacheOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::FlushStageCacheAsync(const FlushStageCacheRequest& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::FlushStageCacheAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::FlushStageCacheAsyncHelper, Aws::Client::RejectedAsyncCall<FlushStageCacheOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::FlushStageCacheAsync(FlushStageCacheRequest&& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::FlushStageCacheAsyncHelper, Aws::Client::RejectedAsyncCall<FlushStageCacheOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::FlushStageCacheAsyncHelper(const FlushStageCacheRequest& request, const FlushStageCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1025,12 +1275,22 @@ GenerateClientCertificateOutcome APIGatewayClient::GenerateClientCertificate(con
 
 GenerateClientCertificateOutcomeCallable APIGatewayClient::GenerateClientCertificateCallable(const GenerateClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GenerateClientCertificate, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GenerateClientCertificate, Aws::Client::RejectedCallOutcome<GenerateClientCertificateOutcome>(), this, request);
+}
+
+GenerateClientCertificateOutcomeCallable APIGatewayClient::GenerateClientCertificateCallable(GenerateClientCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GenerateClientCertificate, Aws::Client::RejectedCallOutcome<GenerateClientCertificateOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GenerateClientCertificateAsync(const GenerateClientCertificateRequest& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GenerateClientCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GenerateClientCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<GenerateClientCertificateOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GenerateClientCertificateAsync(GenerateClientCertificateRequest&& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GenerateClientCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<GenerateClientCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GenerateClientCertificateAsyncHelper(const GenerateClientCertificateRequest& request, const GenerateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1056,12 +1316,22 @@ GetAccountOutcome APIGatewayClient::GetAccount(const GetAccountRequest& request)
 
 GetAccountOutcomeCallable APIGatewayClient::GetAccountCallable(const GetAccountRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetAccount, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetAccount, Aws::Client::RejectedCallOutcome<GetAccountOutcome>(), this, request);
+}
+
+GetAccountOutcomeCallable APIGatewayClient::GetAccountCallable(GetAccountRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetAccount, Aws::Client::RejectedCallOutcome<GetAccountOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetAccountAsync(const GetAccountRequest& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetAccountAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetAccountAsyncHelper, Aws::Client::RejectedAsyncCall<GetAccountOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetAccountAsync(GetAccountRequest&& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetAccountAsyncHelper, Aws::Client::RejectedAsyncCall<GetAccountOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetAccountAsyncHelper(const GetAccountRequest& request, const GetAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1088,12 +1358,22 @@ GetApiKeyOutcome APIGatewayClient::GetApiKey(const GetApiKeyRequest& request) co
 
 GetApiKeyOutcomeCallable APIGatewayClient::GetApiKeyCallable(const GetApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetApiKey, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetApiKey, Aws::Client::RejectedCallOutcome<GetApiKeyOutcome>(), this, request);
+}
+
+GetApiKeyOutcomeCallable APIGatewayClient::GetApiKeyCallable(GetApiKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetApiKey, Aws::Client::RejectedCallOutcome<GetApiKeyOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetApiKeyAsync(const GetApiKeyRequest& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetApiKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetApiKeyAsyncHelper, Aws::Client::RejectedAsyncCall<GetApiKeyOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetApiKeyAsync(GetApiKeyRequest&& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetApiKeyAsyncHelper, Aws::Client::RejectedAsyncCall<GetApiKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetApiKeyAsyncHelper(const GetApiKeyRequest& request, const GetApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1119,12 +1399,22 @@ GetApiKeysOutcome APIGatewayClient::GetApiKeys(const GetApiKeysRequest& request)
 
 GetApiKeysOutcomeCallable APIGatewayClient::GetApiKeysCallable(const GetApiKeysRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetApiKeys, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetApiKeys, Aws::Client::RejectedCallOutcome<GetApiKeysOutcome>(), this, request);
+}
+
+GetApiKeysOutcomeCallable APIGatewayClient::GetApiKeysCallable(GetApiKeysRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetApiKeys, Aws::Client::RejectedCallOutcome<GetApiKeysOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetApiKeysAsync(const GetApiKeysRequest& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetApiKeysAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetApiKeysAsyncHelper, Aws::Client::RejectedAsyncCall<GetApiKeysOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetApiKeysAsync(GetApiKeysRequest&& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetApiKeysAsyncHelper, Aws::Client::RejectedAsyncCall<GetApiKeysOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetApiKeysAsyncHelper(const GetApiKeysRequest& request, const GetApiKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1153,12 +1443,22 @@ GetAuthorizerOutcome APIGatewayClient::GetAuthorizer(const GetAuthorizerRequest&
 
 GetAuthorizerOutcomeCallable APIGatewayClient::GetAuthorizerCallable(const GetAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetAuthorizer, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetAuthorizer, Aws::Client::RejectedCallOutcome<GetAuthorizerOutcome>(), this, request);
+}
+
+GetAuthorizerOutcomeCallable APIGatewayClient::GetAuthorizerCallable(GetAuthorizerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetAuthorizer, Aws::Client::RejectedCallOutcome<GetAuthorizerOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetAuthorizerAsync(const GetAuthorizerRequest& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetAuthorizerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetAuthorizerAsyncHelper, Aws::Client::RejectedAsyncCall<GetAuthorizerOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetAuthorizerAsync(GetAuthorizerRequest&& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetAuthorizerAsyncHelper, Aws::Client::RejectedAsyncCall<GetAuthorizerOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetAuthorizerAsyncHelper(const GetAuthorizerRequest& request, const GetAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1186,12 +1486,22 @@ GetAuthorizersOutcome APIGatewayClient::GetAuthorizers(const GetAuthorizersReque
 
 GetAuthorizersOutcomeCallable APIGatewayClient::GetAuthorizersCallable(const GetAuthorizersRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetAuthorizers, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetAuthorizers, Aws::Client::RejectedCallOutcome<GetAuthorizersOutcome>(), this, request);
+}
+
+GetAuthorizersOutcomeCallable APIGatewayClient::GetAuthorizersCallable(GetAuthorizersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetAuthorizers, Aws::Client::RejectedCallOutcome<GetAuthorizersOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetAuthorizersAsync(const GetAuthorizersRequest& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetAuthorizersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetAuthorizersAsyncHelper, Aws::Client::RejectedAsyncCall<GetAuthorizersOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetAuthorizersAsync(GetAuthorizersRequest&& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetAuthorizersAsyncHelper, Aws::Client::RejectedAsyncCall<GetAuthorizersOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetAuthorizersAsyncHelper(const GetAuthorizersRequest& request, const GetAuthorizersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1220,12 +1530,22 @@ GetBasePathMappingOutcome APIGatewayClient::GetBasePathMapping(const GetBasePath
 
 GetBasePathMappingOutcomeCallable APIGatewayClient::GetBasePathMappingCallable(const GetBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetBasePathMapping, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetBasePathMapping, Aws::Client::RejectedCallOutcome<GetBasePathMappingOutcome>(), this, request);
+}
+
+GetBasePathMappingOutcomeCallable APIGatewayClient::GetBasePathMappingCallable(GetBasePathMappingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetBasePathMapping, Aws::Client::RejectedCallOutcome<GetBasePathMappingOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetBasePathMappingAsync(const GetBasePathMappingRequest& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetBasePathMappingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetBasePathMappingAsyncHelper, Aws::Client::RejectedAsyncCall<GetBasePathMappingOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetBasePathMappingAsync(GetBasePathMappingRequest&& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetBasePathMappingAsyncHelper, Aws::Client::RejectedAsyncCall<GetBasePathMappingOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetBasePathMappingAsyncHelper(const GetBasePathMappingRequest& request, const GetBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1253,12 +1573,22 @@ GetBasePathMappingsOutcome APIGatewayClient::GetBasePathMappings(const GetBasePa
 
 GetBasePathMappingsOutcomeCallable APIGatewayClient::GetBasePathMappingsCallable(const GetBasePathMappingsRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetBasePathMappings, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetBasePathMappings, Aws::Client::RejectedCallOutcome<GetBasePathMappingsOutcome>(), this, request);
+}
+
+GetBasePathMappingsOutcomeCallable APIGatewayClient::GetBasePathMappingsCallable(GetBasePathMappingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetBasePathMappings, Aws::Client::RejectedCallOutcome<GetBasePathMappingsOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetBasePathMappingsAsync(const GetBasePathMappingsRequest& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetBasePathMappingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetBasePathMappingsAsyncHelper, Aws::Client::RejectedAsyncCall<GetBasePathMappingsOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetBasePathMappingsAsync(GetBasePathMappingsRequest&& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetBasePathMappingsAsyncHelper, Aws::Client::RejectedAsyncCall<GetBasePathMappingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetBasePathMappingsAsyncHelper(const GetBasePathMappingsRequest& request, const GetBasePathMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1285,12 +1615,22 @@ GetClientCertificateOutcome APIGatewayClient::GetClientCertificate(const GetClie
 
 GetClientCertificateOutcomeCallable APIGatewayClient::GetClientCertificateCallable(const GetClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetClientCertificate, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetClientCertificate, Aws::Client::RejectedCallOutcome<GetClientCertificateOutcome>(), this, request);
+}
+
+GetClientCertificateOutcomeCallable APIGatewayClient::GetClientCertificateCallable(GetClientCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetClientCertificate, Aws::Client::RejectedCallOutcome<GetClientCertificateOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetClientCertificateAsync(const GetClientCertificateRequest& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetClientCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetClientCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<GetClientCertificateOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetClientCertificateAsync(GetClientCertificateRequest&& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetClientCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<GetClientCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetClientCertificateAsyncHelper(const GetClientCertificateRequest& request, const GetClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1316,12 +1656,22 @@ GetClientCertificatesOutcome APIGatewayClient::GetClientCertificates(const GetCl
 
 GetClientCertificatesOutcomeCallable APIGatewayClient::GetClientCertificatesCallable(const GetClientCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetClientCertificates, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetClientCertificates, Aws::Client::RejectedCallOutcome<GetClientCertificatesOutcome>(), this, request);
+}
+
+GetClientCertificatesOutcomeCallable APIGatewayClient::GetClientCertificatesCallable(GetClientCertificatesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetClientCertificates, Aws::Client::RejectedCallOutcome<GetClientCertificatesOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetClientCertificatesAsync(const GetClientCertificatesRequest& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetClientCertificatesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetClientCertificatesAsyncHelper, Aws::Client::RejectedAsyncCall<GetClientCertificatesOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetClientCertificatesAsync(GetClientCertificatesRequest&& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetClientCertificatesAsyncHelper, Aws::Client::RejectedAsyncCall<GetClientCertificatesOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetClientCertificatesAsyncHelper(const GetClientCertificatesRequest& request, const GetClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1350,12 +1700,22 @@ GetDeploymentOutcome APIGatewayClient::GetDeployment(const GetDeploymentRequest&
 
 GetDeploymentOutcomeCallable APIGatewayClient::GetDeploymentCallable(const GetDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetDeployment, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetDeployment, Aws::Client::RejectedCallOutcome<GetDeploymentOutcome>(), this, request);
+}
+
+GetDeploymentOutcomeCallable APIGatewayClient::GetDeploymentCallable(GetDeploymentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetDeployment, Aws::Client::RejectedCallOutcome<GetDeploymentOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetDeploymentAsync(const GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetDeploymentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<GetDeploymentOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetDeploymentAsync(GetDeploymentRequest&& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<GetDeploymentOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetDeploymentAsyncHelper(const GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1383,12 +1743,22 @@ GetDeploymentsOutcome APIGatewayClient::GetDeployments(const GetDeploymentsReque
 
 GetDeploymentsOutcomeCallable APIGatewayClient::GetDeploymentsCallable(const GetDeploymentsRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetDeployments, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetDeployments, Aws::Client::RejectedCallOutcome<GetDeploymentsOutcome>(), this, request);
+}
+
+GetDeploymentsOutcomeCallable APIGatewayClient::GetDeploymentsCallable(GetDeploymentsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetDeployments, Aws::Client::RejectedCallOutcome<GetDeploymentsOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetDeploymentsAsync(const GetDeploymentsRequest& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetDeploymentsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetDeploymentsAsyncHelper, Aws::Client::RejectedAsyncCall<GetDeploymentsOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetDeploymentsAsync(GetDeploymentsRequest&& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetDeploymentsAsyncHelper, Aws::Client::RejectedAsyncCall<GetDeploymentsOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetDeploymentsAsyncHelper(const GetDeploymentsRequest& request, const GetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1415,12 +1785,22 @@ GetDomainNameOutcome APIGatewayClient::GetDomainName(const GetDomainNameRequest&
 
 GetDomainNameOutcomeCallable APIGatewayClient::GetDomainNameCallable(const GetDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetDomainName, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetDomainName, Aws::Client::RejectedCallOutcome<GetDomainNameOutcome>(), this, request);
+}
+
+GetDomainNameOutcomeCallable APIGatewayClient::GetDomainNameCallable(GetDomainNameRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetDomainName, Aws::Client::RejectedCallOutcome<GetDomainNameOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetDomainNameAsync(const GetDomainNameRequest& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetDomainNameAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetDomainNameAsyncHelper, Aws::Client::RejectedAsyncCall<GetDomainNameOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetDomainNameAsync(GetDomainNameRequest&& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetDomainNameAsyncHelper, Aws::Client::RejectedAsyncCall<GetDomainNameOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetDomainNameAsyncHelper(const GetDomainNameRequest& request, const GetDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1446,12 +1826,22 @@ GetDomainNamesOutcome APIGatewayClient::GetDomainNames(const GetDomainNamesReque
 
 GetDomainNamesOutcomeCallable APIGatewayClient::GetDomainNamesCallable(const GetDomainNamesRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetDomainNames, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetDomainNames, Aws::Client::RejectedCallOutcome<GetDomainNamesOutcome>(), this, request);
+}
+
+GetDomainNamesOutcomeCallable APIGatewayClient::GetDomainNamesCallable(GetDomainNamesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetDomainNames, Aws::Client::RejectedCallOutcome<GetDomainNamesOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetDomainNamesAsync(const GetDomainNamesRequest& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetDomainNamesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetDomainNamesAsyncHelper, Aws::Client::RejectedAsyncCall<GetDomainNamesOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetDomainNamesAsync(GetDomainNamesRequest&& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetDomainNamesAsyncHelper, Aws::Client::RejectedAsyncCall<GetDomainNamesOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetDomainNamesAsyncHelper(const GetDomainNamesRequest& request, const GetDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1482,12 +1872,22 @@ GetExportOutcome APIGatewayClient::GetExport(const GetExportRequest& request) co
 
 GetExportOutcomeCallable APIGatewayClient::GetExportCallable(const GetExportRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetExport, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetExport, Aws::Client::RejectedCallOutcome<GetExportOutcome>(), this, request);
+}
+
+GetExportOutcomeCallable APIGatewayClient::GetExportCallable(GetExportRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetExport, Aws::Client::RejectedCallOutcome<GetExportOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetExportAsync(const GetExportRequest& request, const GetExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetExportAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetExportAsyncHelper, Aws::Client::RejectedAsyncCall<GetExportOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetExportAsync(GetExportRequest&& request, const GetExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetExportAsyncHelper, Aws::Client::RejectedAsyncCall<GetExportOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetExportAsyncHelper(const GetExportRequest& request, const GetExportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1519,12 +1919,22 @@ GetIntegrationOutcome APIGatewayClient::GetIntegration(const GetIntegrationReque
 
 GetIntegrationOutcomeCallable APIGatewayClient::GetIntegrationCallable(const GetIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetIntegration, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetIntegration, Aws::Client::RejectedCallOutcome<GetIntegrationOutcome>(), this, request);
+}
+
+GetIntegrationOutcomeCallable APIGatewayClient::GetIntegrationCallable(GetIntegrationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetIntegration, Aws::Client::RejectedCallOutcome<GetIntegrationOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetIntegrationAsync(const GetIntegrationRequest& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetIntegrationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetIntegrationAsyncHelper, Aws::Client::RejectedAsyncCall<GetIntegrationOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetIntegrationAsync(GetIntegrationRequest&& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetIntegrationAsyncHelper, Aws::Client::RejectedAsyncCall<GetIntegrationOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetIntegrationAsyncHelper(const GetIntegrationRequest& request, const GetIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1557,12 +1967,22 @@ GetIntegrationResponseOutcome APIGatewayClient::GetIntegrationResponse(const Get
 
 GetIntegrationResponseOutcomeCallable APIGatewayClient::GetIntegrationResponseCallable(const GetIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetIntegrationResponse, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetIntegrationResponse, Aws::Client::RejectedCallOutcome<GetIntegrationResponseOutcome>(), this, request);
+}
+
+GetIntegrationResponseOutcomeCallable APIGatewayClient::GetIntegrationResponseCallable(GetIntegrationResponseRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetIntegrationResponse, Aws::Client::RejectedCallOutcome<GetIntegrationResponseOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetIntegrationResponseAsync(const GetIntegrationResponseRequest& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetIntegrationResponseAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetIntegrationResponseAsyncHelper, Aws::Client::RejectedAsyncCall<GetIntegrationResponseOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetIntegrationResponseAsync(GetIntegrationResponseRequest&& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetIntegrationResponseAsyncHelper, Aws::Client::RejectedAsyncCall<GetIntegrationResponseOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetIntegrationResponseAsyncHelper(const GetIntegrationResponseRequest& request, const GetIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1593,12 +2013,22 @@ GetMethodOutcome APIGatewayClient::GetMethod(const GetMethodRequest& request) co
 
 GetMethodOutcomeCallable APIGatewayClient::GetMethodCallable(const GetMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetMethod, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetMethod, Aws::Client::RejectedCallOutcome<GetMethodOutcome>(), this, request);
+}
+
+GetMethodOutcomeCallable APIGatewayClient::GetMethodCallable(GetMethodRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetMethod, Aws::Client::RejectedCallOutcome<GetMethodOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetMethodAsync(const GetMethodRequest& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetMethodAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetMethodAsyncHelper, Aws::Client::RejectedAsyncCall<GetMethodOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetMethodAsync(GetMethodRequest&& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetMethodAsyncHelper, Aws::Client::RejectedAsyncCall<GetMethodOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetMethodAsyncHelper(const GetMethodRequest& request, const GetMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1631,12 +2061,22 @@ GetMethodResponseOutcome APIGatewayClient::GetMethodResponse(const GetMethodResp
 
 GetMethodResponseOutcomeCallable APIGatewayClient::GetMethodResponseCallable(const GetMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetMethodResponse, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetMethodResponse, Aws::Client::RejectedCallOutcome<GetMethodResponseOutcome>(), this, request);
+}
+
+GetMethodResponseOutcomeCallable APIGatewayClient::GetMethodResponseCallable(GetMethodResponseRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetMethodResponse, Aws::Client::RejectedCallOutcome<GetMethodResponseOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetMethodResponseAsync(const GetMethodResponseRequest& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetMethodResponseAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetMethodResponseAsyncHelper, Aws::Client::RejectedAsyncCall<GetMethodResponseOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetMethodResponseAsync(GetMethodResponseRequest&& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetMethodResponseAsyncHelper, Aws::Client::RejectedAsyncCall<GetMethodResponseOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetMethodResponseAsyncHelper(const GetMethodResponseRequest& request, const GetMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1665,12 +2105,22 @@ GetModelOutcome APIGatewayClient::GetModel(const GetModelRequest& request) const
 
 GetModelOutcomeCallable APIGatewayClient::GetModelCallable(const GetModelRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetModel, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetModel, Aws::Client::RejectedCallOutcome<GetModelOutcome>(), this, request);
+}
+
+GetModelOutcomeCallable APIGatewayClient::GetModelCallable(GetModelRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetModel, Aws::Client::RejectedCallOutcome<GetModelOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetModelAsync(const GetModelRequest& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetModelAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetModelAsyncHelper, Aws::Client::RejectedAsyncCall<GetModelOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetModelAsync(GetModelRequest&& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetModelAsyncHelper, Aws::Client::RejectedAsyncCall<GetModelOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetModelAsyncHelper(const GetModelRequest& request, const GetModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1700,12 +2150,22 @@ GetModelTemplateOutcome APIGatewayClient::GetModelTemplate(const GetModelTemplat
 
 GetModelTemplateOutcomeCallable APIGatewayClient::GetModelTemplateCallable(const GetModelTemplateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetModelTemplate, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetModelTemplate, Aws::Client::RejectedCallOutcome<GetModelTemplateOutcome>(), this, request);
+}
+
+GetModelTemplateOutcomeCallable APIGatewayClient::GetModelTemplateCallable(GetModelTemplateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetModelTemplate, Aws::Client::RejectedCallOutcome<GetModelTemplateOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetModelTemplateAsync(const GetModelTemplateRequest& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetModelTemplateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetModelTemplateAsyncHelper, Aws::Client::RejectedAsyncCall<GetModelTemplateOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetModelTemplateAsync(GetModelTemplateRequest&& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetModelTemplateAsyncHelper, Aws::Client::RejectedAsyncCall<GetModelTemplateOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetModelTemplateAsyncHelper(const GetModelTemplateRequest& request, const GetModelTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1733,12 +2193,22 @@ GetModelsOutcome APIGatewayClient::GetModels(const GetModelsRequest& request) co
 
 GetModelsOutcomeCallable APIGatewayClient::GetModelsCallable(const GetModelsRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetModels, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetModels, Aws::Client::RejectedCallOutcome<GetModelsOutcome>(), this, request);
+}
+
+GetModelsOutcomeCallable APIGatewayClient::GetModelsCallable(GetModelsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetModels, Aws::Client::RejectedCallOutcome<GetModelsOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetModelsAsync(const GetModelsRequest& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetModelsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetModelsAsyncHelper, Aws::Client::RejectedAsyncCall<GetModelsOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetModelsAsync(GetModelsRequest&& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetModelsAsyncHelper, Aws::Client::RejectedAsyncCall<GetModelsOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetModelsAsyncHelper(const GetModelsRequest& request, const GetModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1767,12 +2237,22 @@ GetResourceOutcome APIGatewayClient::GetResource(const GetResourceRequest& reque
 
 GetResourceOutcomeCallable APIGatewayClient::GetResourceCallable(const GetResourceRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetResource, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetResource, Aws::Client::RejectedCallOutcome<GetResourceOutcome>(), this, request);
+}
+
+GetResourceOutcomeCallable APIGatewayClient::GetResourceCallable(GetResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetResource, Aws::Client::RejectedCallOutcome<GetResourceOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetResourceAsync(const GetResourceRequest& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetResourceAsyncHelper, Aws::Client::RejectedAsyncCall<GetResourceOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetResourceAsync(GetResourceRequest&& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetResourceAsyncHelper, Aws::Client::RejectedAsyncCall<GetResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetResourceAsyncHelper(const GetResourceRequest& request, const GetResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1800,12 +2280,22 @@ GetResourcesOutcome APIGatewayClient::GetResources(const GetResourcesRequest& re
 
 GetResourcesOutcomeCallable APIGatewayClient::GetResourcesCallable(const GetResourcesRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetResources, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetResources, Aws::Client::RejectedCallOutcome<GetResourcesOutcome>(), this, request);
+}
+
+GetResourcesOutcomeCallable APIGatewayClient::GetResourcesCallable(GetResourcesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetResources, Aws::Client::RejectedCallOutcome<GetResourcesOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetResourcesAsync(const GetResourcesRequest& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetResourcesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetResourcesAsyncHelper, Aws::Client::RejectedAsyncCall<GetResourcesOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetResourcesAsync(GetResourcesRequest&& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetResourcesAsyncHelper, Aws::Client::RejectedAsyncCall<GetResourcesOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetResourcesAsyncHelper(const GetResourcesRequest& request, const GetResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1832,12 +2322,22 @@ GetRestApiOutcome APIGatewayClient::GetRestApi(const GetRestApiRequest& request)
 
 GetRestApiOutcomeCallable APIGatewayClient::GetRestApiCallable(const GetRestApiRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetRestApi, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetRestApi, Aws::Client::RejectedCallOutcome<GetRestApiOutcome>(), this, request);
+}
+
+GetRestApiOutcomeCallable APIGatewayClient::GetRestApiCallable(GetRestApiRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetRestApi, Aws::Client::RejectedCallOutcome<GetRestApiOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetRestApiAsync(const GetRestApiRequest& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetRestApiAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetRestApiAsyncHelper, Aws::Client::RejectedAsyncCall<GetRestApiOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetRestApiAsync(GetRestApiRequest&& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetRestApiAsyncHelper, Aws::Client::RejectedAsyncCall<GetRestApiOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetRestApiAsyncHelper(const GetRestApiRequest& request, const GetRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1863,12 +2363,22 @@ GetRestApisOutcome APIGatewayClient::GetRestApis(const GetRestApisRequest& reque
 
 GetRestApisOutcomeCallable APIGatewayClient::GetRestApisCallable(const GetRestApisRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetRestApis, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetRestApis, Aws::Client::RejectedCallOutcome<GetRestApisOutcome>(), this, request);
+}
+
+GetRestApisOutcomeCallable APIGatewayClient::GetRestApisCallable(GetRestApisRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetRestApis, Aws::Client::RejectedCallOutcome<GetRestApisOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetRestApisAsync(const GetRestApisRequest& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetRestApisAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetRestApisAsyncHelper, Aws::Client::RejectedAsyncCall<GetRestApisOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetRestApisAsync(GetRestApisRequest&& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetRestApisAsyncHelper, Aws::Client::RejectedAsyncCall<GetRestApisOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetRestApisAsyncHelper(const GetRestApisRequest& request, const GetRestApisResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1899,12 +2409,22 @@ GetSdkOutcome APIGatewayClient::GetSdk(const GetSdkRequest& request) const
 
 GetSdkOutcomeCallable APIGatewayClient::GetSdkCallable(const GetSdkRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetSdk, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetSdk, Aws::Client::RejectedCallOutcome<GetSdkOutcome>(), this, request);
+}
+
+GetSdkOutcomeCallable APIGatewayClient::GetSdkCallable(GetSdkRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetSdk, Aws::Client::RejectedCallOutcome<GetSdkOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetSdkAsync(const GetSdkRequest& request, const GetSdkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetSdkAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetSdkAsyncHelper, Aws::Client::RejectedAsyncCall<GetSdkOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetSdkAsync(GetSdkRequest&& request, const GetSdkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetSdkAsyncHelper, Aws::Client::RejectedAsyncCall<GetSdkOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetSdkAsyncHelper(const GetSdkRequest& request, const GetSdkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1933,12 +2453,22 @@ GetStageOutcome APIGatewayClient::GetStage(const GetStageRequest& request) const
 
 GetStageOutcomeCallable APIGatewayClient::GetStageCallable(const GetStageRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetStage, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetStage, Aws::Client::RejectedCallOutcome<GetStageOutcome>(), this, request);
+}
+
+GetStageOutcomeCallable APIGatewayClient::GetStageCallable(GetStageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetStage, Aws::Client::RejectedCallOutcome<GetStageOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetStageAsync(const GetStageRequest& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetStageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetStageAsyncHelper, Aws::Client::RejectedAsyncCall<GetStageOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetStageAsync(GetStageRequest&& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetStageAsyncHelper, Aws::Client::RejectedAsyncCall<GetStageOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetStageAsyncHelper(const GetStageRequest& request, const GetStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1966,12 +2496,22 @@ GetStagesOutcome APIGatewayClient::GetStages(const GetStagesRequest& request) co
 
 GetStagesOutcomeCallable APIGatewayClient::GetStagesCallable(const GetStagesRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::GetStages, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetStages, Aws::Client::RejectedCallOutcome<GetStagesOutcome>(), this, request);
+}
+
+GetStagesOutcomeCallable APIGatewayClient::GetStagesCallable(GetStagesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::GetStages, Aws::Client::RejectedCallOutcome<GetStagesOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::GetStagesAsync(const GetStagesRequest& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::GetStagesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::GetStagesAsyncHelper, Aws::Client::RejectedAsyncCall<GetStagesOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::GetStagesAsync(GetStagesRequest&& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::GetStagesAsyncHelper, Aws::Client::RejectedAsyncCall<GetStagesOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::GetStagesAsyncHelper(const GetStagesRequest& request, const GetStagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2003,12 +2543,22 @@ PutIntegrationOutcome APIGatewayClient::PutIntegration(const PutIntegrationReque
 
 PutIntegrationOutcomeCallable APIGatewayClient::PutIntegrationCallable(const PutIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::PutIntegration, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::PutIntegration, Aws::Client::RejectedCallOutcome<PutIntegrationOutcome>(), this, request);
+}
+
+PutIntegrationOutcomeCallable APIGatewayClient::PutIntegrationCallable(PutIntegrationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::PutIntegration, Aws::Client::RejectedCallOutcome<PutIntegrationOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::PutIntegrationAsync(const PutIntegrationRequest& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::PutIntegrationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::PutIntegrationAsyncHelper, Aws::Client::RejectedAsyncCall<PutIntegrationOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::PutIntegrationAsync(PutIntegrationRequest&& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::PutIntegrationAsyncHelper, Aws::Client::RejectedAsyncCall<PutIntegrationOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::PutIntegrationAsyncHelper(const PutIntegrationRequest& request, const PutIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2041,12 +2591,22 @@ PutIntegrationResponseOutcome APIGatewayClient::PutIntegrationResponse(const Put
 
 PutIntegrationResponseOutcomeCallable APIGatewayClient::PutIntegrationResponseCallable(const PutIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::PutIntegrationResponse, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::PutIntegrationResponse, Aws::Client::RejectedCallOutcome<PutIntegrationResponseOutcome>(), this, request);
+}
+
+PutIntegrationResponseOutcomeCallable APIGatewayClient::PutIntegrationResponseCallable(PutIntegrationResponseRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::PutIntegrationResponse, Aws::Client::RejectedCallOutcome<PutIntegrationResponseOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::PutIntegrationResponseAsync(const PutIntegrationResponseRequest& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::PutIntegrationResponseAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::PutIntegrationResponseAsyncHelper, Aws::Client::RejectedAsyncCall<PutIntegrationResponseOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::PutIntegrationResponseAsync(PutIntegrationResponseRequest&& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::PutIntegrationResponseAsyncHelper, Aws::Client::RejectedAsyncCall<PutIntegrationResponseOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::PutIntegrationResponseAsyncHelper(const PutIntegrationResponseRequest& request, const PutIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2077,12 +2637,22 @@ PutMethodOutcome APIGatewayClient::PutMethod(const PutMethodRequest& request) co
 
 PutMethodOutcomeCallable APIGatewayClient::PutMethodCallable(const PutMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::PutMethod, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::PutMethod, Aws::Client::RejectedCallOutcome<PutMethodOutcome>(), this, request);
+}
+
+PutMethodOutcomeCallable APIGatewayClient::PutMethodCallable(PutMethodRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::PutMethod, Aws::Client::RejectedCallOutcome<PutMethodOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::PutMethodAsync(const PutMethodRequest& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::PutMethodAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::PutMethodAsyncHelper, Aws::Client::RejectedAsyncCall<PutMethodOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::PutMethodAsync(PutMethodRequest&& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::PutMethodAsyncHelper, Aws::Client::RejectedAsyncCall<PutMethodOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::PutMethodAsyncHelper(const PutMethodRequest& request, const PutMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2115,12 +2685,22 @@ PutMethodResponseOutcome APIGatewayClient::PutMethodResponse(const PutMethodResp
 
 PutMethodResponseOutcomeCallable APIGatewayClient::PutMethodResponseCallable(const PutMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::PutMethodResponse, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::PutMethodResponse, Aws::Client::RejectedCallOutcome<PutMethodResponseOutcome>(), this, request);
+}
+
+PutMethodResponseOutcomeCallable APIGatewayClient::PutMethodResponseCallable(PutMethodResponseRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::PutMethodResponse, Aws::Client::RejectedCallOutcome<PutMethodResponseOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::PutMethodResponseAsync(const PutMethodResponseRequest& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::PutMethodResponseAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::PutMethodResponseAsyncHelper, Aws::Client::RejectedAsyncCall<PutMethodResponseOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::PutMethodResponseAsync(PutMethodResponseRequest&& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::PutMethodResponseAsyncHelper, Aws::Client::RejectedAsyncCall<PutMethodResponseOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::PutMethodResponseAsyncHelper(const PutMethodResponseRequest& request, const PutMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2149,12 +2729,22 @@ TestInvokeAuthorizerOutcome APIGatewayClient::TestInvokeAuthorizer(const TestInv
 
 TestInvokeAuthorizerOutcomeCallable APIGatewayClient::TestInvokeAuthorizerCallable(const TestInvokeAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::TestInvokeAuthorizer, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::TestInvokeAuthorizer, Aws::Client::RejectedCallOutcome<TestInvokeAuthorizerOutcome>(), this, request);
+}
+
+TestInvokeAuthorizerOutcomeCallable APIGatewayClient::TestInvokeAuthorizerCallable(TestInvokeAuthorizerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::TestInvokeAuthorizer, Aws::Client::RejectedCallOutcome<TestInvokeAuthorizerOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::TestInvokeAuthorizerAsync(const TestInvokeAuthorizerRequest& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::TestInvokeAuthorizerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::TestInvokeAuthorizerAsyncHelper, Aws::Client::RejectedAsyncCall<TestInvokeAuthorizerOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::TestInvokeAuthorizerAsync(TestInvokeAuthorizerRequest&& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::TestInvokeAuthorizerAsyncHelper, Aws::Client::RejectedAsyncCall<TestInvokeAuthorizerOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::TestInvokeAuthorizerAsyncHelper(const TestInvokeAuthorizerRequest& request, const TestInvokeAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2185,12 +2775,22 @@ TestInvokeMethodOutcome APIGatewayClient::TestInvokeMethod(const TestInvokeMetho
 
 TestInvokeMethodOutcomeCallable APIGatewayClient::TestInvokeMethodCallable(const TestInvokeMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::TestInvokeMethod, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::TestInvokeMethod, Aws::Client::RejectedCallOutcome<TestInvokeMethodOutcome>(), this, request);
+}
+
+TestInvokeMethodOutcomeCallable APIGatewayClient::TestInvokeMethodCallable(TestInvokeMethodRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::TestInvokeMethod, Aws::Client::RejectedCallOutcome<TestInvokeMethodOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::TestInvokeMethodAsync(const TestInvokeMethodRequest& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::TestInvokeMethodAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::TestInvokeMethodAsyncHelper, Aws::Client::RejectedAsyncCall<TestInvokeMethodOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::TestInvokeMethodAsync(TestInvokeMethodRequest&& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::TestInvokeMethodAsyncHelper, Aws::Client::RejectedAsyncCall<TestInvokeMethodOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::TestInvokeMethodAsyncHelper(const TestInvokeMethodRequest& request, const TestInvokeMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2216,12 +2816,22 @@ UpdateAccountOutcome APIGatewayClient::UpdateAccount(const UpdateAccountRequest&
 
 UpdateAccountOutcomeCallable APIGatewayClient::UpdateAccountCallable(const UpdateAccountRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateAccount, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateAccount, Aws::Client::RejectedCallOutcome<UpdateAccountOutcome>(), this, request);
+}
+
+UpdateAccountOutcomeCallable APIGatewayClient::UpdateAccountCallable(UpdateAccountRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateAccount, Aws::Client::RejectedCallOutcome<UpdateAccountOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateAccountAsync(const UpdateAccountRequest& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateAccountAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateAccountAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAccountOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateAccountAsync(UpdateAccountRequest&& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateAccountAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAccountOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateAccountAsyncHelper(const UpdateAccountRequest& request, const UpdateAccountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2248,12 +2858,22 @@ UpdateApiKeyOutcome APIGatewayClient::UpdateApiKey(const UpdateApiKeyRequest& re
 
 UpdateApiKeyOutcomeCallable APIGatewayClient::UpdateApiKeyCallable(const UpdateApiKeyRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateApiKey, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateApiKey, Aws::Client::RejectedCallOutcome<UpdateApiKeyOutcome>(), this, request);
+}
+
+UpdateApiKeyOutcomeCallable APIGatewayClient::UpdateApiKeyCallable(UpdateApiKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateApiKey, Aws::Client::RejectedCallOutcome<UpdateApiKeyOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateApiKeyAsync(const UpdateApiKeyRequest& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateApiKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateApiKeyAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateApiKeyOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateApiKeyAsync(UpdateApiKeyRequest&& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateApiKeyAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateApiKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateApiKeyAsyncHelper(const UpdateApiKeyRequest& request, const UpdateApiKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2282,12 +2902,22 @@ UpdateAuthorizerOutcome APIGatewayClient::UpdateAuthorizer(const UpdateAuthorize
 
 UpdateAuthorizerOutcomeCallable APIGatewayClient::UpdateAuthorizerCallable(const UpdateAuthorizerRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateAuthorizer, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateAuthorizer, Aws::Client::RejectedCallOutcome<UpdateAuthorizerOutcome>(), this, request);
+}
+
+UpdateAuthorizerOutcomeCallable APIGatewayClient::UpdateAuthorizerCallable(UpdateAuthorizerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateAuthorizer, Aws::Client::RejectedCallOutcome<UpdateAuthorizerOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateAuthorizerAsync(const UpdateAuthorizerRequest& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateAuthorizerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateAuthorizerAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAuthorizerOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateAuthorizerAsync(UpdateAuthorizerRequest&& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateAuthorizerAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAuthorizerOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateAuthorizerAsyncHelper(const UpdateAuthorizerRequest& request, const UpdateAuthorizerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2316,12 +2946,22 @@ UpdateBasePathMappingOutcome APIGatewayClient::UpdateBasePathMapping(const Updat
 
 UpdateBasePathMappingOutcomeCallable APIGatewayClient::UpdateBasePathMappingCallable(const UpdateBasePathMappingRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateBasePathMapping, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateBasePathMapping, Aws::Client::RejectedCallOutcome<UpdateBasePathMappingOutcome>(), this, request);
+}
+
+UpdateBasePathMappingOutcomeCallable APIGatewayClient::UpdateBasePathMappingCallable(UpdateBasePathMappingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateBasePathMapping, Aws::Client::RejectedCallOutcome<UpdateBasePathMappingOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateBasePathMappingAsync(const UpdateBasePathMappingRequest& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateBasePathMappingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateBasePathMappingAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateBasePathMappingOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateBasePathMappingAsync(UpdateBasePathMappingRequest&& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateBasePathMappingAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateBasePathMappingOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateBasePathMappingAsyncHelper(const UpdateBasePathMappingRequest& request, const UpdateBasePathMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2348,12 +2988,22 @@ UpdateClientCertificateOutcome APIGatewayClient::UpdateClientCertificate(const U
 
 UpdateClientCertificateOutcomeCallable APIGatewayClient::UpdateClientCertificateCallable(const UpdateClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateClientCertificate, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateClientCertificate, Aws::Client::RejectedCallOutcome<UpdateClientCertificateOutcome>(), this, request);
+}
+
+UpdateClientCertificateOutcomeCallable APIGatewayClient::UpdateClientCertificateCallable(UpdateClientCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateClientCertificate, Aws::Client::RejectedCallOutcome<UpdateClientCertificateOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateClientCertificateAsync(const UpdateClientCertificateRequest& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateClientCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateClientCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateClientCertificateOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateClientCertificateAsync(UpdateClientCertificateRequest&& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateClientCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateClientCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateClientCertificateAsyncHelper(const UpdateClientCertificateRequest& request, const UpdateClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2382,12 +3032,22 @@ UpdateDeploymentOutcome APIGatewayClient::UpdateDeployment(const UpdateDeploymen
 
 UpdateDeploymentOutcomeCallable APIGatewayClient::UpdateDeploymentCallable(const UpdateDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateDeployment, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateDeployment, Aws::Client::RejectedCallOutcome<UpdateDeploymentOutcome>(), this, request);
+}
+
+UpdateDeploymentOutcomeCallable APIGatewayClient::UpdateDeploymentCallable(UpdateDeploymentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateDeployment, Aws::Client::RejectedCallOutcome<UpdateDeploymentOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateDeploymentAsync(const UpdateDeploymentRequest& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateDeploymentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDeploymentOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateDeploymentAsync(UpdateDeploymentRequest&& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDeploymentOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateDeploymentAsyncHelper(const UpdateDeploymentRequest& request, const UpdateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2414,12 +3074,22 @@ UpdateDomainNameOutcome APIGatewayClient::UpdateDomainName(const UpdateDomainNam
 
 UpdateDomainNameOutcomeCallable APIGatewayClient::UpdateDomainNameCallable(const UpdateDomainNameRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateDomainName, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateDomainName, Aws::Client::RejectedCallOutcome<UpdateDomainNameOutcome>(), this, request);
+}
+
+UpdateDomainNameOutcomeCallable APIGatewayClient::UpdateDomainNameCallable(UpdateDomainNameRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateDomainName, Aws::Client::RejectedCallOutcome<UpdateDomainNameOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateDomainNameAsync(const UpdateDomainNameRequest& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateDomainNameAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateDomainNameAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDomainNameOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateDomainNameAsync(UpdateDomainNameRequest&& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateDomainNameAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDomainNameOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateDomainNameAsyncHelper(const UpdateDomainNameRequest& request, const UpdateDomainNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2451,12 +3121,22 @@ UpdateIntegrationOutcome APIGatewayClient::UpdateIntegration(const UpdateIntegra
 
 UpdateIntegrationOutcomeCallable APIGatewayClient::UpdateIntegrationCallable(const UpdateIntegrationRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateIntegration, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateIntegration, Aws::Client::RejectedCallOutcome<UpdateIntegrationOutcome>(), this, request);
+}
+
+UpdateIntegrationOutcomeCallable APIGatewayClient::UpdateIntegrationCallable(UpdateIntegrationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateIntegration, Aws::Client::RejectedCallOutcome<UpdateIntegrationOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateIntegrationAsync(const UpdateIntegrationRequest& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateIntegrationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateIntegrationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateIntegrationOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateIntegrationAsync(UpdateIntegrationRequest&& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateIntegrationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateIntegrationOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateIntegrationAsyncHelper(const UpdateIntegrationRequest& request, const UpdateIntegrationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2489,12 +3169,22 @@ UpdateIntegrationResponseOutcome APIGatewayClient::UpdateIntegrationResponse(con
 
 UpdateIntegrationResponseOutcomeCallable APIGatewayClient::UpdateIntegrationResponseCallable(const UpdateIntegrationResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateIntegrationResponse, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateIntegrationResponse, Aws::Client::RejectedCallOutcome<UpdateIntegrationResponseOutcome>(), this, request);
+}
+
+UpdateIntegrationResponseOutcomeCallable APIGatewayClient::UpdateIntegrationResponseCallable(UpdateIntegrationResponseRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateIntegrationResponse, Aws::Client::RejectedCallOutcome<UpdateIntegrationResponseOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateIntegrationResponseAsync(const UpdateIntegrationResponseRequest& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateIntegrationResponseAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateIntegrationResponseAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateIntegrationResponseOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateIntegrationResponseAsync(UpdateIntegrationResponseRequest&& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateIntegrationResponseAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateIntegrationResponseOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateIntegrationResponseAsyncHelper(const UpdateIntegrationResponseRequest& request, const UpdateIntegrationResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2525,12 +3215,22 @@ UpdateMethodOutcome APIGatewayClient::UpdateMethod(const UpdateMethodRequest& re
 
 UpdateMethodOutcomeCallable APIGatewayClient::UpdateMethodCallable(const UpdateMethodRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateMethod, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateMethod, Aws::Client::RejectedCallOutcome<UpdateMethodOutcome>(), this, request);
+}
+
+UpdateMethodOutcomeCallable APIGatewayClient::UpdateMethodCallable(UpdateMethodRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateMethod, Aws::Client::RejectedCallOutcome<UpdateMethodOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateMethodAsync(const UpdateMethodRequest& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateMethodAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateMethodAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateMethodOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateMethodAsync(UpdateMethodRequest&& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateMethodAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateMethodOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateMethodAsyncHelper(const UpdateMethodRequest& request, const UpdateMethodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2563,12 +3263,22 @@ UpdateMethodResponseOutcome APIGatewayClient::UpdateMethodResponse(const UpdateM
 
 UpdateMethodResponseOutcomeCallable APIGatewayClient::UpdateMethodResponseCallable(const UpdateMethodResponseRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateMethodResponse, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateMethodResponse, Aws::Client::RejectedCallOutcome<UpdateMethodResponseOutcome>(), this, request);
+}
+
+UpdateMethodResponseOutcomeCallable APIGatewayClient::UpdateMethodResponseCallable(UpdateMethodResponseRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateMethodResponse, Aws::Client::RejectedCallOutcome<UpdateMethodResponseOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateMethodResponseAsync(const UpdateMethodResponseRequest& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateMethodResponseAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateMethodResponseAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateMethodResponseOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateMethodResponseAsync(UpdateMethodResponseRequest&& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateMethodResponseAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateMethodResponseOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateMethodResponseAsyncHelper(const UpdateMethodResponseRequest& request, const UpdateMethodResponseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2597,12 +3307,22 @@ UpdateModelOutcome APIGatewayClient::UpdateModel(const UpdateModelRequest& reque
 
 UpdateModelOutcomeCallable APIGatewayClient::UpdateModelCallable(const UpdateModelRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateModel, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateModel, Aws::Client::RejectedCallOutcome<UpdateModelOutcome>(), this, request);
+}
+
+UpdateModelOutcomeCallable APIGatewayClient::UpdateModelCallable(UpdateModelRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateModel, Aws::Client::RejectedCallOutcome<UpdateModelOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateModelAsync(const UpdateModelRequest& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateModelAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateModelAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateModelOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateModelAsync(UpdateModelRequest&& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateModelAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateModelOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateModelAsyncHelper(const UpdateModelRequest& request, const UpdateModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2631,12 +3351,22 @@ UpdateResourceOutcome APIGatewayClient::UpdateResource(const UpdateResourceReque
 
 UpdateResourceOutcomeCallable APIGatewayClient::UpdateResourceCallable(const UpdateResourceRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateResource, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateResource, Aws::Client::RejectedCallOutcome<UpdateResourceOutcome>(), this, request);
+}
+
+UpdateResourceOutcomeCallable APIGatewayClient::UpdateResourceCallable(UpdateResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateResource, Aws::Client::RejectedCallOutcome<UpdateResourceOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateResourceAsync(const UpdateResourceRequest& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateResourceAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateResourceOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateResourceAsync(UpdateResourceRequest&& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateResourceAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateResourceAsyncHelper(const UpdateResourceRequest& request, const UpdateResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2663,12 +3393,22 @@ UpdateRestApiOutcome APIGatewayClient::UpdateRestApi(const UpdateRestApiRequest&
 
 UpdateRestApiOutcomeCallable APIGatewayClient::UpdateRestApiCallable(const UpdateRestApiRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateRestApi, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateRestApi, Aws::Client::RejectedCallOutcome<UpdateRestApiOutcome>(), this, request);
+}
+
+UpdateRestApiOutcomeCallable APIGatewayClient::UpdateRestApiCallable(UpdateRestApiRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateRestApi, Aws::Client::RejectedCallOutcome<UpdateRestApiOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateRestApiAsync(const UpdateRestApiRequest& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateRestApiAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateRestApiAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateRestApiOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateRestApiAsync(UpdateRestApiRequest&& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateRestApiAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateRestApiOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateRestApiAsyncHelper(const UpdateRestApiRequest& request, const UpdateRestApiResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2697,12 +3437,22 @@ UpdateStageOutcome APIGatewayClient::UpdateStage(const UpdateStageRequest& reque
 
 UpdateStageOutcomeCallable APIGatewayClient::UpdateStageCallable(const UpdateStageRequest& request) const
 {
-  return std::async(std::launch::async, &APIGatewayClient::UpdateStage, this, request);
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateStage, Aws::Client::RejectedCallOutcome<UpdateStageOutcome>(), this, request);
+}
+
+UpdateStageOutcomeCallable APIGatewayClient::UpdateStageCallable(UpdateStageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&APIGatewayClient::UpdateStage, Aws::Client::RejectedCallOutcome<UpdateStageOutcome>(), this, std::move(request));
 }
 
 void APIGatewayClient::UpdateStageAsync(const UpdateStageRequest& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&APIGatewayClient::UpdateStageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateStageAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateStageOutcome>(), this, request, handler, context);
+}
+
+void APIGatewayClient::UpdateStageAsync(UpdateStageRequest&& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&APIGatewayClient::UpdateStageAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateStageOutcome>(), this, std::move(request), handler, context);
 }
 
 void APIGatewayClient::UpdateStageAsyncHelper(const UpdateStageRequest& request, const UpdateStageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
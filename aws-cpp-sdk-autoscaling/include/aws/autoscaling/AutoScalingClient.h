@@ -52,6 +52,59 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/autoscaling/model/AttachInstancesRequest.h>
+#include <aws/autoscaling/model/AttachLoadBalancersRequest.h>
+#include <aws/autoscaling/model/CompleteLifecycleActionRequest.h>
+#include <aws/autoscaling/model/CreateAutoScalingGroupRequest.h>
+#include <aws/autoscaling/model/CreateLaunchConfigurationRequest.h>
+#include <aws/autoscaling/model/CreateOrUpdateTagsRequest.h>
+#include <aws/autoscaling/model/DeleteAutoScalingGroupRequest.h>
+#include <aws/autoscaling/model/DeleteLaunchConfigurationRequest.h>
+#include <aws/autoscaling/model/DeleteLifecycleHookRequest.h>
+#include <aws/autoscaling/model/DeleteNotificationConfigurationRequest.h>
+#include <aws/autoscaling/model/DeletePolicyRequest.h>
+#include <aws/autoscaling/model/DeleteScheduledActionRequest.h>
+#include <aws/autoscaling/model/DeleteTagsRequest.h>
+#include <aws/autoscaling/model/DescribeAccountLimitsRequest.h>
+#include <aws/autoscaling/model/DescribeAdjustmentTypesRequest.h>
+#include <aws/autoscaling/model/DescribeAutoScalingGroupsRequest.h>
+#include <aws/autoscaling/model/DescribeAutoScalingInstancesRequest.h>
+#include <aws/autoscaling/model/DescribeAutoScalingNotificationTypesRequest.h>
+#include <aws/autoscaling/model/DescribeLaunchConfigurationsRequest.h>
+#include <aws/autoscaling/model/DescribeLifecycleHookTypesRequest.h>
+#include <aws/autoscaling/model/DescribeLifecycleHooksRequest.h>
+#include <aws/autoscaling/model/DescribeLoadBalancersRequest.h>
+#include <aws/autoscaling/model/DescribeMetricCollectionTypesRequest.h>
+#include <aws/autoscaling/model/DescribeNotificationConfigurationsRequest.h>
+#include <aws/autoscaling/model/DescribePoliciesRequest.h>
+#include <aws/autoscaling/model/DescribeScalingActivitiesRequest.h>
+#include <aws/autoscaling/model/DescribeScalingProcessTypesRequest.h>
+#include <aws/autoscaling/model/DescribeScheduledActionsRequest.h>
+#include <aws/autoscaling/model/DescribeTagsRequest.h>
+#include <aws/autoscaling/model/DescribeTerminationPolicyTypesRequest.h>
+#include <aws/autoscaling/model/DetachInstancesRequest.h>
+#include <aws/autoscaling/model/DetachLoadBalancersRequest.h>
+#include <aws/autoscaling/model/DisableMetricsCollectionRequest.h>
+#include <aws/autoscaling/model/EnableMetricsCollectionRequest.h>
+#include <aws/autoscaling/model/EnterStandbyRequest.h>
+#include <aws/autoscaling/model/ExecutePolicyRequest.h>
+#include <aws/autoscaling/model/ExitStandbyRequest.h>
+#include <aws/autoscaling/model/PutLifecycleHookRequest.h>
+#include <aws/autoscaling/model/PutNotificationConfigurationRequest.h>
+#include <aws/autoscaling/model/PutScalingPolicyRequest.h>
+#include <aws/autoscaling/model/PutScheduledUpdateGroupActionRequest.h>
+#include <aws/autoscaling/model/RecordLifecycleActionHeartbeatRequest.h>
+#include <aws/autoscaling/model/ResumeProcessesRequest.h>
+#include <aws/autoscaling/model/SetDesiredCapacityRequest.h>
+#include <aws/autoscaling/model/SetInstanceHealthRequest.h>
+#include <aws/autoscaling/model/SetInstanceProtectionRequest.h>
+#include <aws/autoscaling/model/SuspendProcessesRequest.h>
+#include <aws/autoscaling/model/TerminateInstanceInAutoScalingGroupRequest.h>
+#include <aws/autoscaling/model/UpdateAutoScalingGroupRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -357,6 +410,11 @@ namespace Model
          */
         virtual Model::AttachInstancesOutcomeCallable AttachInstancesCallable(const Model::AttachInstancesRequest& request) const;
 
+        /**
+         * Same as AttachInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachInstancesOutcomeCallable AttachInstancesCallable(Model::AttachInstancesRequest&& request) const;
+
         /**
          * <p>Attaches one or more EC2 instances to the specified Auto Scaling group.</p>
          * <p>When you attach instances, Auto Scaling increases the desired capacity of the
@@ -371,6 +429,11 @@ namespace Model
          */
         virtual void AttachInstancesAsync(const Model::AttachInstancesRequest& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachInstancesAsync(Model::AttachInstancesRequest&& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches one or more load balancers to the specified Auto Scaling group.</p>
          * <p>To describe the load balancers for an Auto Scaling group, use
@@ -395,6 +458,11 @@ namespace Model
          */
         virtual Model::AttachLoadBalancersOutcomeCallable AttachLoadBalancersCallable(const Model::AttachLoadBalancersRequest& request) const;
 
+        /**
+         * Same as AttachLoadBalancersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachLoadBalancersOutcomeCallable AttachLoadBalancersCallable(Model::AttachLoadBalancersRequest&& request) const;
+
         /**
          * <p>Attaches one or more load balancers to the specified Auto Scaling group.</p>
          * <p>To describe the load balancers for an Auto Scaling group, use
@@ -408,6 +476,11 @@ namespace Model
          */
         virtual void AttachLoadBalancersAsync(const Model::AttachLoadBalancersRequest& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachLoadBalancersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachLoadBalancersAsync(Model::AttachLoadBalancersRequest&& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Completes the lifecycle action for the specified token or instance with the
          * specified result.</p> <p>This step is a part of the procedure for adding a
@@ -446,6 +519,11 @@ namespace Model
          */
         virtual Model::CompleteLifecycleActionOutcomeCallable CompleteLifecycleActionCallable(const Model::CompleteLifecycleActionRequest& request) const;
 
+        /**
+         * Same as CompleteLifecycleActionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CompleteLifecycleActionOutcomeCallable CompleteLifecycleActionCallable(Model::CompleteLifecycleActionRequest&& request) const;
+
         /**
          * <p>Completes the lifecycle action for the specified token or instance with the
          * specified result.</p> <p>This step is a part of the procedure for adding a
@@ -466,6 +544,11 @@ namespace Model
          */
         virtual void CompleteLifecycleActionAsync(const Model::CompleteLifecycleActionRequest& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CompleteLifecycleActionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CompleteLifecycleActionAsync(Model::CompleteLifecycleActionRequest&& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an Auto Scaling group with the specified name and attributes.</p>
          * <p>If you exceed your maximum limit of Auto Scaling groups, which by default is
@@ -488,6 +571,11 @@ namespace Model
          */
         virtual Model::CreateAutoScalingGroupOutcomeCallable CreateAutoScalingGroupCallable(const Model::CreateAutoScalingGroupRequest& request) const;
 
+        /**
+         * Same as CreateAutoScalingGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateAutoScalingGroupOutcomeCallable CreateAutoScalingGroupCallable(Model::CreateAutoScalingGroupRequest&& request) const;
+
         /**
          * <p>Creates an Auto Scaling group with the specified name and attributes.</p>
          * <p>If you exceed your maximum limit of Auto Scaling groups, which by default is
@@ -500,6 +588,11 @@ namespace Model
          */
         virtual void CreateAutoScalingGroupAsync(const Model::CreateAutoScalingGroupRequest& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAutoScalingGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateAutoScalingGroupAsync(Model::CreateAutoScalingGroupRequest&& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a launch configuration.</p> <p>If you exceed your maximum limit of
          * launch configurations, which by default is 100 per region, the call fails. For
@@ -522,6 +615,11 @@ namespace Model
          */
         virtual Model::CreateLaunchConfigurationOutcomeCallable CreateLaunchConfigurationCallable(const Model::CreateLaunchConfigurationRequest& request) const;
 
+        /**
+         * Same as CreateLaunchConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateLaunchConfigurationOutcomeCallable CreateLaunchConfigurationCallable(Model::CreateLaunchConfigurationRequest&& request) const;
+
         /**
          * <p>Creates a launch configuration.</p> <p>If you exceed your maximum limit of
          * launch configurations, which by default is 100 per region, the call fails. For
@@ -534,6 +632,11 @@ namespace Model
          */
         virtual void CreateLaunchConfigurationAsync(const Model::CreateLaunchConfigurationRequest& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLaunchConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateLaunchConfigurationAsync(Model::CreateLaunchConfigurationRequest&& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates tags for the specified Auto Scaling group.</p> <p>When you
          * specify a tag with a key that already exists, the operation overwrites the
@@ -558,6 +661,11 @@ namespace Model
          */
         virtual Model::CreateOrUpdateTagsOutcomeCallable CreateOrUpdateTagsCallable(const Model::CreateOrUpdateTagsRequest& request) const;
 
+        /**
+         * Same as CreateOrUpdateTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateOrUpdateTagsOutcomeCallable CreateOrUpdateTagsCallable(Model::CreateOrUpdateTagsRequest&& request) const;
+
         /**
          * <p>Creates or updates tags for the specified Auto Scaling group.</p> <p>When you
          * specify a tag with a key that already exists, the operation overwrites the
@@ -571,6 +679,11 @@ namespace Model
          */
         virtual void CreateOrUpdateTagsAsync(const Model::CreateOrUpdateTagsRequest& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateOrUpdateTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateOrUpdateTagsAsync(Model::CreateOrUpdateTagsRequest&& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified Auto Scaling group.</p> <p>If the group has instances
          * or scaling activities in progress, you must specify the option to force the
@@ -601,6 +714,11 @@ namespace Model
          */
         virtual Model::DeleteAutoScalingGroupOutcomeCallable DeleteAutoScalingGroupCallable(const Model::DeleteAutoScalingGroupRequest& request) const;
 
+        /**
+         * Same as DeleteAutoScalingGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteAutoScalingGroupOutcomeCallable DeleteAutoScalingGroupCallable(Model::DeleteAutoScalingGroupRequest&& request) const;
+
         /**
          * <p>Deletes the specified Auto Scaling group.</p> <p>If the group has instances
          * or scaling activities in progress, you must specify the option to force the
@@ -617,6 +735,11 @@ namespace Model
          */
         virtual void DeleteAutoScalingGroupAsync(const Model::DeleteAutoScalingGroupRequest& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAutoScalingGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteAutoScalingGroupAsync(Model::DeleteAutoScalingGroupRequest&& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified launch configuration.</p> <p>The launch configuration
          * must not be attached to an Auto Scaling group. When this call completes, the
@@ -633,6 +756,11 @@ namespace Model
          */
         virtual Model::DeleteLaunchConfigurationOutcomeCallable DeleteLaunchConfigurationCallable(const Model::DeleteLaunchConfigurationRequest& request) const;
 
+        /**
+         * Same as DeleteLaunchConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteLaunchConfigurationOutcomeCallable DeleteLaunchConfigurationCallable(Model::DeleteLaunchConfigurationRequest&& request) const;
+
         /**
          * <p>Deletes the specified launch configuration.</p> <p>The launch configuration
          * must not be attached to an Auto Scaling group. When this call completes, the
@@ -642,6 +770,11 @@ namespace Model
          */
         virtual void DeleteLaunchConfigurationAsync(const Model::DeleteLaunchConfigurationRequest& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLaunchConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteLaunchConfigurationAsync(Model::DeleteLaunchConfigurationRequest&& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified lifecycle hook.</p> <p>If there are any outstanding
          * lifecycle actions, they are completed first (<code>ABANDON</code> for launching
@@ -658,6 +791,11 @@ namespace Model
          */
         virtual Model::DeleteLifecycleHookOutcomeCallable DeleteLifecycleHookCallable(const Model::DeleteLifecycleHookRequest& request) const;
 
+        /**
+         * Same as DeleteLifecycleHookCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteLifecycleHookOutcomeCallable DeleteLifecycleHookCallable(Model::DeleteLifecycleHookRequest&& request) const;
+
         /**
          * <p>Deletes the specified lifecycle hook.</p> <p>If there are any outstanding
          * lifecycle actions, they are completed first (<code>ABANDON</code> for launching
@@ -667,6 +805,11 @@ namespace Model
          */
         virtual void DeleteLifecycleHookAsync(const Model::DeleteLifecycleHookRequest& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLifecycleHookAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteLifecycleHookAsync(Model::DeleteLifecycleHookRequest&& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified notification.</p>
          */
@@ -679,6 +822,11 @@ namespace Model
          */
         virtual Model::DeleteNotificationConfigurationOutcomeCallable DeleteNotificationConfigurationCallable(const Model::DeleteNotificationConfigurationRequest& request) const;
 
+        /**
+         * Same as DeleteNotificationConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteNotificationConfigurationOutcomeCallable DeleteNotificationConfigurationCallable(Model::DeleteNotificationConfigurationRequest&& request) const;
+
         /**
          * <p>Deletes the specified notification.</p>
          *
@@ -686,6 +834,11 @@ namespace Model
          */
         virtual void DeleteNotificationConfigurationAsync(const Model::DeleteNotificationConfigurationRequest& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteNotificationConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteNotificationConfigurationAsync(Model::DeleteNotificationConfigurationRequest&& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified Auto Scaling policy.</p> <p>Deleting a policy deletes
          * the underlying alarm action, but does not delete the alarm, even if it no longer
@@ -702,6 +855,11 @@ namespace Model
          */
         virtual Model::DeletePolicyOutcomeCallable DeletePolicyCallable(const Model::DeletePolicyRequest& request) const;
 
+        /**
+         * Same as DeletePolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeletePolicyOutcomeCallable DeletePolicyCallable(Model::DeletePolicyRequest&& request) const;
+
         /**
          * <p>Deletes the specified Auto Scaling policy.</p> <p>Deleting a policy deletes
          * the underlying alarm action, but does not delete the alarm, even if it no longer
@@ -711,6 +869,11 @@ namespace Model
          */
         virtual void DeletePolicyAsync(const Model::DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeletePolicyAsync(Model::DeletePolicyRequest&& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified scheduled action.</p>
          */
@@ -723,6 +886,11 @@ namespace Model
          */
         virtual Model::DeleteScheduledActionOutcomeCallable DeleteScheduledActionCallable(const Model::DeleteScheduledActionRequest& request) const;
 
+        /**
+         * Same as DeleteScheduledActionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteScheduledActionOutcomeCallable DeleteScheduledActionCallable(Model::DeleteScheduledActionRequest&& request) const;
+
         /**
          * <p>Deletes the specified scheduled action.</p>
          *
@@ -730,6 +898,11 @@ namespace Model
          */
         virtual void DeleteScheduledActionAsync(const Model::DeleteScheduledActionRequest& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteScheduledActionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteScheduledActionAsync(Model::DeleteScheduledActionRequest&& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified tags.</p>
          */
@@ -742,6 +915,11 @@ namespace Model
          */
         virtual Model::DeleteTagsOutcomeCallable DeleteTagsCallable(const Model::DeleteTagsRequest& request) const;
 
+        /**
+         * Same as DeleteTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteTagsOutcomeCallable DeleteTagsCallable(Model::DeleteTagsRequest&& request) const;
+
         /**
          * <p>Deletes the specified tags.</p>
          *
@@ -749,6 +927,11 @@ namespace Model
          */
         virtual void DeleteTagsAsync(const Model::DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteTagsAsync(Model::DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the current Auto Scaling resource limits for your AWS account.</p>
          * <p>For information about requesting an increase in these limits, see <a
@@ -767,6 +950,11 @@ namespace Model
          */
         virtual Model::DescribeAccountLimitsOutcomeCallable DescribeAccountLimitsCallable(const Model::DescribeAccountLimitsRequest& request) const;
 
+        /**
+         * Same as DescribeAccountLimitsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAccountLimitsOutcomeCallable DescribeAccountLimitsCallable(Model::DescribeAccountLimitsRequest&& request) const;
+
         /**
          * <p>Describes the current Auto Scaling resource limits for your AWS account.</p>
          * <p>For information about requesting an increase in these limits, see <a
@@ -777,6 +965,11 @@ namespace Model
          */
         virtual void DescribeAccountLimitsAsync(const Model::DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAccountLimitsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAccountLimitsAsync(Model::DescribeAccountLimitsRequest&& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the policy adjustment types for use with
          * <a>PutScalingPolicy</a>.</p>
@@ -791,6 +984,11 @@ namespace Model
          */
         virtual Model::DescribeAdjustmentTypesOutcomeCallable DescribeAdjustmentTypesCallable(const Model::DescribeAdjustmentTypesRequest& request) const;
 
+        /**
+         * Same as DescribeAdjustmentTypesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAdjustmentTypesOutcomeCallable DescribeAdjustmentTypesCallable(Model::DescribeAdjustmentTypesRequest&& request) const;
+
         /**
          * <p>Describes the policy adjustment types for use with
          * <a>PutScalingPolicy</a>.</p>
@@ -799,6 +997,11 @@ namespace Model
          */
         virtual void DescribeAdjustmentTypesAsync(const Model::DescribeAdjustmentTypesRequest& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAdjustmentTypesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAdjustmentTypesAsync(Model::DescribeAdjustmentTypesRequest&& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more Auto Scaling groups. If a list of names is not
          * provided, the call describes all Auto Scaling groups.</p>
@@ -813,6 +1016,11 @@ namespace Model
          */
         virtual Model::DescribeAutoScalingGroupsOutcomeCallable DescribeAutoScalingGroupsCallable(const Model::DescribeAutoScalingGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeAutoScalingGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAutoScalingGroupsOutcomeCallable DescribeAutoScalingGroupsCallable(Model::DescribeAutoScalingGroupsRequest&& request) const;
+
         /**
          * <p>Describes one or more Auto Scaling groups. If a list of names is not
          * provided, the call describes all Auto Scaling groups.</p>
@@ -821,6 +1029,11 @@ namespace Model
          */
         virtual void DescribeAutoScalingGroupsAsync(const Model::DescribeAutoScalingGroupsRequest& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAutoScalingGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAutoScalingGroupsAsync(Model::DescribeAutoScalingGroupsRequest&& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more Auto Scaling instances. If a list is not provided, the
          * call describes all instances.</p>
@@ -835,6 +1048,11 @@ namespace Model
          */
         virtual Model::DescribeAutoScalingInstancesOutcomeCallable DescribeAutoScalingInstancesCallable(const Model::DescribeAutoScalingInstancesRequest& request) const;
 
+        /**
+         * Same as DescribeAutoScalingInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAutoScalingInstancesOutcomeCallable DescribeAutoScalingInstancesCallable(Model::DescribeAutoScalingInstancesRequest&& request) const;
+
         /**
          * <p>Describes one or more Auto Scaling instances. If a list is not provided, the
          * call describes all instances.</p>
@@ -843,6 +1061,11 @@ namespace Model
          */
         virtual void DescribeAutoScalingInstancesAsync(const Model::DescribeAutoScalingInstancesRequest& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAutoScalingInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAutoScalingInstancesAsync(Model::DescribeAutoScalingInstancesRequest&& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the notification types that are supported by Auto Scaling.</p>
          */
@@ -855,6 +1078,11 @@ namespace Model
          */
         virtual Model::DescribeAutoScalingNotificationTypesOutcomeCallable DescribeAutoScalingNotificationTypesCallable(const Model::DescribeAutoScalingNotificationTypesRequest& request) const;
 
+        /**
+         * Same as DescribeAutoScalingNotificationTypesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAutoScalingNotificationTypesOutcomeCallable DescribeAutoScalingNotificationTypesCallable(Model::DescribeAutoScalingNotificationTypesRequest&& request) const;
+
         /**
          * <p>Describes the notification types that are supported by Auto Scaling.</p>
          *
@@ -862,6 +1090,11 @@ namespace Model
          */
         virtual void DescribeAutoScalingNotificationTypesAsync(const Model::DescribeAutoScalingNotificationTypesRequest& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAutoScalingNotificationTypesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAutoScalingNotificationTypesAsync(Model::DescribeAutoScalingNotificationTypesRequest&& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more launch configurations. If you omit the list of names,
          * then the call describes all launch configurations.</p>
@@ -876,6 +1109,11 @@ namespace Model
          */
         virtual Model::DescribeLaunchConfigurationsOutcomeCallable DescribeLaunchConfigurationsCallable(const Model::DescribeLaunchConfigurationsRequest& request) const;
 
+        /**
+         * Same as DescribeLaunchConfigurationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLaunchConfigurationsOutcomeCallable DescribeLaunchConfigurationsCallable(Model::DescribeLaunchConfigurationsRequest&& request) const;
+
         /**
          * <p>Describes one or more launch configurations. If you omit the list of names,
          * then the call describes all launch configurations.</p>
@@ -884,6 +1122,11 @@ namespace Model
          */
         virtual void DescribeLaunchConfigurationsAsync(const Model::DescribeLaunchConfigurationsRequest& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLaunchConfigurationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLaunchConfigurationsAsync(Model::DescribeLaunchConfigurationsRequest&& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the available types of lifecycle hooks.</p>
          */
@@ -896,6 +1139,11 @@ namespace Model
          */
         virtual Model::DescribeLifecycleHookTypesOutcomeCallable DescribeLifecycleHookTypesCallable(const Model::DescribeLifecycleHookTypesRequest& request) const;
 
+        /**
+         * Same as DescribeLifecycleHookTypesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLifecycleHookTypesOutcomeCallable DescribeLifecycleHookTypesCallable(Model::DescribeLifecycleHookTypesRequest&& request) const;
+
         /**
          * <p>Describes the available types of lifecycle hooks.</p>
          *
@@ -903,6 +1151,11 @@ namespace Model
          */
         virtual void DescribeLifecycleHookTypesAsync(const Model::DescribeLifecycleHookTypesRequest& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLifecycleHookTypesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLifecycleHookTypesAsync(Model::DescribeLifecycleHookTypesRequest&& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the lifecycle hooks for the specified Auto Scaling group.</p>
          */
@@ -915,6 +1168,11 @@ namespace Model
          */
         virtual Model::DescribeLifecycleHooksOutcomeCallable DescribeLifecycleHooksCallable(const Model::DescribeLifecycleHooksRequest& request) const;
 
+        /**
+         * Same as DescribeLifecycleHooksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLifecycleHooksOutcomeCallable DescribeLifecycleHooksCallable(Model::DescribeLifecycleHooksRequest&& request) const;
+
         /**
          * <p>Describes the lifecycle hooks for the specified Auto Scaling group.</p>
          *
@@ -922,6 +1180,11 @@ namespace Model
          */
         virtual void DescribeLifecycleHooksAsync(const Model::DescribeLifecycleHooksRequest& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLifecycleHooksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLifecycleHooksAsync(Model::DescribeLifecycleHooksRequest&& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the load balancers for the specified Auto Scaling group.</p>
          */
@@ -934,6 +1197,11 @@ namespace Model
          */
         virtual Model::DescribeLoadBalancersOutcomeCallable DescribeLoadBalancersCallable(const Model::DescribeLoadBalancersRequest& request) const;
 
+        /**
+         * Same as DescribeLoadBalancersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLoadBalancersOutcomeCallable DescribeLoadBalancersCallable(Model::DescribeLoadBalancersRequest&& request) const;
+
         /**
          * <p>Describes the load balancers for the specified Auto Scaling group.</p>
          *
@@ -941,6 +1209,11 @@ namespace Model
          */
         virtual void DescribeLoadBalancersAsync(const Model::DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBalancersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLoadBalancersAsync(Model::DescribeLoadBalancersRequest&& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the available CloudWatch metrics for Auto Scaling.</p> <p>Note that
          * the <code>GroupStandbyInstances</code> metric is not returned by default. You
@@ -959,6 +1232,11 @@ namespace Model
          */
         virtual Model::DescribeMetricCollectionTypesOutcomeCallable DescribeMetricCollectionTypesCallable(const Model::DescribeMetricCollectionTypesRequest& request) const;
 
+        /**
+         * Same as DescribeMetricCollectionTypesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeMetricCollectionTypesOutcomeCallable DescribeMetricCollectionTypesCallable(Model::DescribeMetricCollectionTypesRequest&& request) const;
+
         /**
          * <p>Describes the available CloudWatch metrics for Auto Scaling.</p> <p>Note that
          * the <code>GroupStandbyInstances</code> metric is not returned by default. You
@@ -969,6 +1247,11 @@ namespace Model
          */
         virtual void DescribeMetricCollectionTypesAsync(const Model::DescribeMetricCollectionTypesRequest& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeMetricCollectionTypesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeMetricCollectionTypesAsync(Model::DescribeMetricCollectionTypesRequest&& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the notification actions associated with the specified Auto Scaling
          * group.</p>
@@ -983,6 +1266,11 @@ namespace Model
          */
         virtual Model::DescribeNotificationConfigurationsOutcomeCallable DescribeNotificationConfigurationsCallable(const Model::DescribeNotificationConfigurationsRequest& request) const;
 
+        /**
+         * Same as DescribeNotificationConfigurationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeNotificationConfigurationsOutcomeCallable DescribeNotificationConfigurationsCallable(Model::DescribeNotificationConfigurationsRequest&& request) const;
+
         /**
          * <p>Describes the notification actions associated with the specified Auto Scaling
          * group.</p>
@@ -991,6 +1279,11 @@ namespace Model
          */
         virtual void DescribeNotificationConfigurationsAsync(const Model::DescribeNotificationConfigurationsRequest& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeNotificationConfigurationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeNotificationConfigurationsAsync(Model::DescribeNotificationConfigurationsRequest&& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the policies for the specified Auto Scaling group.</p>
          */
@@ -1003,6 +1296,11 @@ namespace Model
          */
         virtual Model::DescribePoliciesOutcomeCallable DescribePoliciesCallable(const Model::DescribePoliciesRequest& request) const;
 
+        /**
+         * Same as DescribePoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribePoliciesOutcomeCallable DescribePoliciesCallable(Model::DescribePoliciesRequest&& request) const;
+
         /**
          * <p>Describes the policies for the specified Auto Scaling group.</p>
          *
@@ -1010,6 +1308,11 @@ namespace Model
          */
         virtual void DescribePoliciesAsync(const Model::DescribePoliciesRequest& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribePoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribePoliciesAsync(Model::DescribePoliciesRequest&& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more scaling activities for the specified Auto Scaling
          * group. If you omit the <code>ActivityIds</code>, the call returns all activities
@@ -1028,6 +1331,11 @@ namespace Model
          */
         virtual Model::DescribeScalingActivitiesOutcomeCallable DescribeScalingActivitiesCallable(const Model::DescribeScalingActivitiesRequest& request) const;
 
+        /**
+         * Same as DescribeScalingActivitiesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeScalingActivitiesOutcomeCallable DescribeScalingActivitiesCallable(Model::DescribeScalingActivitiesRequest&& request) const;
+
         /**
          * <p>Describes one or more scaling activities for the specified Auto Scaling
          * group. If you omit the <code>ActivityIds</code>, the call returns all activities
@@ -1038,6 +1346,11 @@ namespace Model
          */
         virtual void DescribeScalingActivitiesAsync(const Model::DescribeScalingActivitiesRequest& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScalingActivitiesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeScalingActivitiesAsync(Model::DescribeScalingActivitiesRequest&& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the scaling process types for use with <a>ResumeProcesses</a> and
          * <a>SuspendProcesses</a>.</p>
@@ -1052,6 +1365,11 @@ namespace Model
          */
         virtual Model::DescribeScalingProcessTypesOutcomeCallable DescribeScalingProcessTypesCallable(const Model::DescribeScalingProcessTypesRequest& request) const;
 
+        /**
+         * Same as DescribeScalingProcessTypesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeScalingProcessTypesOutcomeCallable DescribeScalingProcessTypesCallable(Model::DescribeScalingProcessTypesRequest&& request) const;
+
         /**
          * <p>Describes the scaling process types for use with <a>ResumeProcesses</a> and
          * <a>SuspendProcesses</a>.</p>
@@ -1060,6 +1378,11 @@ namespace Model
          */
         virtual void DescribeScalingProcessTypesAsync(const Model::DescribeScalingProcessTypesRequest& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScalingProcessTypesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeScalingProcessTypesAsync(Model::DescribeScalingProcessTypesRequest&& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the actions scheduled for your Auto Scaling group that haven't run.
          * To describe the actions that have already run, use
@@ -1076,6 +1399,11 @@ namespace Model
          */
         virtual Model::DescribeScheduledActionsOutcomeCallable DescribeScheduledActionsCallable(const Model::DescribeScheduledActionsRequest& request) const;
 
+        /**
+         * Same as DescribeScheduledActionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeScheduledActionsOutcomeCallable DescribeScheduledActionsCallable(Model::DescribeScheduledActionsRequest&& request) const;
+
         /**
          * <p>Describes the actions scheduled for your Auto Scaling group that haven't run.
          * To describe the actions that have already run, use
@@ -1085,6 +1413,11 @@ namespace Model
          */
         virtual void DescribeScheduledActionsAsync(const Model::DescribeScheduledActionsRequest& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScheduledActionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeScheduledActionsAsync(Model::DescribeScheduledActionsRequest&& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified tags.</p> <p>You can use filters to limit the
          * results. For example, you can query for the tags for a specific Auto Scaling
@@ -1109,6 +1442,11 @@ namespace Model
          */
         virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(const Model::DescribeTagsRequest& request) const;
 
+        /**
+         * Same as DescribeTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(Model::DescribeTagsRequest&& request) const;
+
         /**
          * <p>Describes the specified tags.</p> <p>You can use filters to limit the
          * results. For example, you can query for the tags for a specific Auto Scaling
@@ -1122,6 +1460,11 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTagsAsync(Model::DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the termination policies supported by Auto Scaling.</p>
          */
@@ -1134,6 +1477,11 @@ namespace Model
          */
         virtual Model::DescribeTerminationPolicyTypesOutcomeCallable DescribeTerminationPolicyTypesCallable(const Model::DescribeTerminationPolicyTypesRequest& request) const;
 
+        /**
+         * Same as DescribeTerminationPolicyTypesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTerminationPolicyTypesOutcomeCallable DescribeTerminationPolicyTypesCallable(Model::DescribeTerminationPolicyTypesRequest&& request) const;
+
         /**
          * <p>Describes the termination policies supported by Auto Scaling.</p>
          *
@@ -1141,6 +1489,11 @@ namespace Model
          */
         virtual void DescribeTerminationPolicyTypesAsync(const Model::DescribeTerminationPolicyTypesRequest& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTerminationPolicyTypesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTerminationPolicyTypesAsync(Model::DescribeTerminationPolicyTypesRequest&& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes one or more instances from the specified Auto Scaling group.</p>
          * <p>After the instances are detached, you can manage them independently from the
@@ -1167,6 +1520,11 @@ namespace Model
          */
         virtual Model::DetachInstancesOutcomeCallable DetachInstancesCallable(const Model::DetachInstancesRequest& request) const;
 
+        /**
+         * Same as DetachInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachInstancesOutcomeCallable DetachInstancesCallable(Model::DetachInstancesRequest&& request) const;
+
         /**
          * <p>Removes one or more instances from the specified Auto Scaling group.</p>
          * <p>After the instances are detached, you can manage them independently from the
@@ -1181,6 +1539,11 @@ namespace Model
          */
         virtual void DetachInstancesAsync(const Model::DetachInstancesRequest& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachInstancesAsync(Model::DetachInstancesRequest&& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes one or more load balancers from the specified Auto Scaling group.</p>
          * <p>When you detach a load balancer, it enters the <code>Removing</code> state
@@ -1201,6 +1564,11 @@ namespace Model
          */
         virtual Model::DetachLoadBalancersOutcomeCallable DetachLoadBalancersCallable(const Model::DetachLoadBalancersRequest& request) const;
 
+        /**
+         * Same as DetachLoadBalancersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachLoadBalancersOutcomeCallable DetachLoadBalancersCallable(Model::DetachLoadBalancersRequest&& request) const;
+
         /**
          * <p>Removes one or more load balancers from the specified Auto Scaling group.</p>
          * <p>When you detach a load balancer, it enters the <code>Removing</code> state
@@ -1212,6 +1580,11 @@ namespace Model
          */
         virtual void DetachLoadBalancersAsync(const Model::DetachLoadBalancersRequest& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachLoadBalancersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachLoadBalancersAsync(Model::DetachLoadBalancersRequest&& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables monitoring of the specified metrics for the specified Auto Scaling
          * group.</p>
@@ -1226,6 +1599,11 @@ namespace Model
          */
         virtual Model::DisableMetricsCollectionOutcomeCallable DisableMetricsCollectionCallable(const Model::DisableMetricsCollectionRequest& request) const;
 
+        /**
+         * Same as DisableMetricsCollectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableMetricsCollectionOutcomeCallable DisableMetricsCollectionCallable(Model::DisableMetricsCollectionRequest&& request) const;
+
         /**
          * <p>Disables monitoring of the specified metrics for the specified Auto Scaling
          * group.</p>
@@ -1234,6 +1612,11 @@ namespace Model
          */
         virtual void DisableMetricsCollectionAsync(const Model::DisableMetricsCollectionRequest& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableMetricsCollectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableMetricsCollectionAsync(Model::DisableMetricsCollectionRequest&& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables monitoring of the specified metrics for the specified Auto Scaling
          * group.</p> <p>You can only enable metrics collection if
@@ -1252,6 +1635,11 @@ namespace Model
          */
         virtual Model::EnableMetricsCollectionOutcomeCallable EnableMetricsCollectionCallable(const Model::EnableMetricsCollectionRequest& request) const;
 
+        /**
+         * Same as EnableMetricsCollectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableMetricsCollectionOutcomeCallable EnableMetricsCollectionCallable(Model::EnableMetricsCollectionRequest&& request) const;
+
         /**
          * <p>Enables monitoring of the specified metrics for the specified Auto Scaling
          * group.</p> <p>You can only enable metrics collection if
@@ -1262,6 +1650,11 @@ namespace Model
          */
         virtual void EnableMetricsCollectionAsync(const Model::EnableMetricsCollectionRequest& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableMetricsCollectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableMetricsCollectionAsync(Model::EnableMetricsCollectionRequest&& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Moves the specified instances into <code>Standby</code> mode.</p> <p>For more
          * information, see <a
@@ -1280,6 +1673,11 @@ namespace Model
          */
         virtual Model::EnterStandbyOutcomeCallable EnterStandbyCallable(const Model::EnterStandbyRequest& request) const;
 
+        /**
+         * Same as EnterStandbyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnterStandbyOutcomeCallable EnterStandbyCallable(Model::EnterStandbyRequest&& request) const;
+
         /**
          * <p>Moves the specified instances into <code>Standby</code> mode.</p> <p>For more
          * information, see <a
@@ -1290,6 +1688,11 @@ namespace Model
          */
         virtual void EnterStandbyAsync(const Model::EnterStandbyRequest& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnterStandbyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnterStandbyAsync(Model::EnterStandbyRequest&& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Executes the specified policy.</p>
          */
@@ -1302,6 +1705,11 @@ namespace Model
          */
         virtual Model::ExecutePolicyOutcomeCallable ExecutePolicyCallable(const Model::ExecutePolicyRequest& request) const;
 
+        /**
+         * Same as ExecutePolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ExecutePolicyOutcomeCallable ExecutePolicyCallable(Model::ExecutePolicyRequest&& request) const;
+
         /**
          * <p>Executes the specified policy.</p>
          *
@@ -1309,6 +1717,11 @@ namespace Model
          */
         virtual void ExecutePolicyAsync(const Model::ExecutePolicyRequest& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ExecutePolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ExecutePolicyAsync(Model::ExecutePolicyRequest&& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Moves the specified instances out of <code>Standby</code> mode.</p> <p>For
          * more information, see <a
@@ -1327,6 +1740,11 @@ namespace Model
          */
         virtual Model::ExitStandbyOutcomeCallable ExitStandbyCallable(const Model::ExitStandbyRequest& request) const;
 
+        /**
+         * Same as ExitStandbyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ExitStandbyOutcomeCallable ExitStandbyCallable(Model::ExitStandbyRequest&& request) const;
+
         /**
          * <p>Moves the specified instances out of <code>Standby</code> mode.</p> <p>For
          * more information, see <a
@@ -1337,6 +1755,11 @@ namespace Model
          */
         virtual void ExitStandbyAsync(const Model::ExitStandbyRequest& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ExitStandbyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ExitStandbyAsync(Model::ExitStandbyRequest&& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates a lifecycle hook for the specified Auto Scaling Group.</p>
          * <p>A lifecycle hook tells Auto Scaling that you want to perform an action on an
@@ -1389,6 +1812,11 @@ namespace Model
          */
         virtual Model::PutLifecycleHookOutcomeCallable PutLifecycleHookCallable(const Model::PutLifecycleHookRequest& request) const;
 
+        /**
+         * Same as PutLifecycleHookCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutLifecycleHookOutcomeCallable PutLifecycleHookCallable(Model::PutLifecycleHookRequest&& request) const;
+
         /**
          * <p>Creates or updates a lifecycle hook for the specified Auto Scaling Group.</p>
          * <p>A lifecycle hook tells Auto Scaling that you want to perform an action on an
@@ -1416,6 +1844,11 @@ namespace Model
          */
         virtual void PutLifecycleHookAsync(const Model::PutLifecycleHookRequest& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutLifecycleHookAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutLifecycleHookAsync(Model::PutLifecycleHookRequest&& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Configures an Auto Scaling group to send notifications when specified events
          * take place. Subscribers to this topic can have messages for events delivered to
@@ -1442,6 +1875,11 @@ namespace Model
          */
         virtual Model::PutNotificationConfigurationOutcomeCallable PutNotificationConfigurationCallable(const Model::PutNotificationConfigurationRequest& request) const;
 
+        /**
+         * Same as PutNotificationConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutNotificationConfigurationOutcomeCallable PutNotificationConfigurationCallable(Model::PutNotificationConfigurationRequest&& request) const;
+
         /**
          * <p> Configures an Auto Scaling group to send notifications when specified events
          * take place. Subscribers to this topic can have messages for events delivered to
@@ -1456,6 +1894,11 @@ namespace Model
          */
         virtual void PutNotificationConfigurationAsync(const Model::PutNotificationConfigurationRequest& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutNotificationConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutNotificationConfigurationAsync(Model::PutNotificationConfigurationRequest&& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates a policy for an Auto Scaling group. To update an existing
          * policy, use the existing policy name and set the parameters you want to change.
@@ -1482,6 +1925,11 @@ namespace Model
          */
         virtual Model::PutScalingPolicyOutcomeCallable PutScalingPolicyCallable(const Model::PutScalingPolicyRequest& request) const;
 
+        /**
+         * Same as PutScalingPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutScalingPolicyOutcomeCallable PutScalingPolicyCallable(Model::PutScalingPolicyRequest&& request) const;
+
         /**
          * <p>Creates or updates a policy for an Auto Scaling group. To update an existing
          * policy, use the existing policy name and set the parameters you want to change.
@@ -1496,6 +1944,11 @@ namespace Model
          */
         virtual void PutScalingPolicyAsync(const Model::PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutScalingPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutScalingPolicyAsync(Model::PutScalingPolicyRequest&& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates or updates a scheduled scaling action for an Auto Scaling group.
          * When updating a scheduled scaling action, if you leave a parameter unspecified,
@@ -1518,6 +1971,11 @@ namespace Model
          */
         virtual Model::PutScheduledUpdateGroupActionOutcomeCallable PutScheduledUpdateGroupActionCallable(const Model::PutScheduledUpdateGroupActionRequest& request) const;
 
+        /**
+         * Same as PutScheduledUpdateGroupActionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutScheduledUpdateGroupActionOutcomeCallable PutScheduledUpdateGroupActionCallable(Model::PutScheduledUpdateGroupActionRequest&& request) const;
+
         /**
          * <p> Creates or updates a scheduled scaling action for an Auto Scaling group.
          * When updating a scheduled scaling action, if you leave a parameter unspecified,
@@ -1530,6 +1988,11 @@ namespace Model
          */
         virtual void PutScheduledUpdateGroupActionAsync(const Model::PutScheduledUpdateGroupActionRequest& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutScheduledUpdateGroupActionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutScheduledUpdateGroupActionAsync(Model::PutScheduledUpdateGroupActionRequest&& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Records a heartbeat for the lifecycle action associated with the specified
          * token or instance. This extends the timeout by the length of time defined using
@@ -1572,6 +2035,11 @@ namespace Model
          */
         virtual Model::RecordLifecycleActionHeartbeatOutcomeCallable RecordLifecycleActionHeartbeatCallable(const Model::RecordLifecycleActionHeartbeatRequest& request) const;
 
+        /**
+         * Same as RecordLifecycleActionHeartbeatCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RecordLifecycleActionHeartbeatOutcomeCallable RecordLifecycleActionHeartbeatCallable(Model::RecordLifecycleActionHeartbeatRequest&& request) const;
+
         /**
          * <p>Records a heartbeat for the lifecycle action associated with the specified
          * token or instance. This extends the timeout by the length of time defined using
@@ -1594,6 +2062,11 @@ namespace Model
          */
         virtual void RecordLifecycleActionHeartbeatAsync(const Model::RecordLifecycleActionHeartbeatRequest& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RecordLifecycleActionHeartbeatAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RecordLifecycleActionHeartbeatAsync(Model::RecordLifecycleActionHeartbeatRequest&& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Resumes the specified suspended Auto Scaling processes, or all suspended
          * process, for the specified Auto Scaling group.</p> <p>For more information, see
@@ -1616,6 +2089,11 @@ namespace Model
          */
         virtual Model::ResumeProcessesOutcomeCallable ResumeProcessesCallable(const Model::ResumeProcessesRequest& request) const;
 
+        /**
+         * Same as ResumeProcessesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ResumeProcessesOutcomeCallable ResumeProcessesCallable(Model::ResumeProcessesRequest&& request) const;
+
         /**
          * <p>Resumes the specified suspended Auto Scaling processes, or all suspended
          * process, for the specified Auto Scaling group.</p> <p>For more information, see
@@ -1628,6 +2106,11 @@ namespace Model
          */
         virtual void ResumeProcessesAsync(const Model::ResumeProcessesRequest& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResumeProcessesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ResumeProcessesAsync(Model::ResumeProcessesRequest&& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the size of the specified Auto Scaling group.</p> <p>For more
          * information about desired capacity, see <a
@@ -1646,6 +2129,11 @@ namespace Model
          */
         virtual Model::SetDesiredCapacityOutcomeCallable SetDesiredCapacityCallable(const Model::SetDesiredCapacityRequest& request) const;
 
+        /**
+         * Same as SetDesiredCapacityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetDesiredCapacityOutcomeCallable SetDesiredCapacityCallable(Model::SetDesiredCapacityRequest&& request) const;
+
         /**
          * <p>Sets the size of the specified Auto Scaling group.</p> <p>For more
          * information about desired capacity, see <a
@@ -1656,6 +2144,11 @@ namespace Model
          */
         virtual void SetDesiredCapacityAsync(const Model::SetDesiredCapacityRequest& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetDesiredCapacityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetDesiredCapacityAsync(Model::SetDesiredCapacityRequest&& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the health status of the specified instance.</p> <p>For more
          * information, see <a
@@ -1674,6 +2167,11 @@ namespace Model
          */
         virtual Model::SetInstanceHealthOutcomeCallable SetInstanceHealthCallable(const Model::SetInstanceHealthRequest& request) const;
 
+        /**
+         * Same as SetInstanceHealthCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetInstanceHealthOutcomeCallable SetInstanceHealthCallable(Model::SetInstanceHealthRequest&& request) const;
+
         /**
          * <p>Sets the health status of the specified instance.</p> <p>For more
          * information, see <a
@@ -1684,6 +2182,11 @@ namespace Model
          */
         virtual void SetInstanceHealthAsync(const Model::SetInstanceHealthRequest& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetInstanceHealthAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetInstanceHealthAsync(Model::SetInstanceHealthRequest&& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the instance protection settings of the specified instances.</p>
          * <p>For more information, see <a
@@ -1702,6 +2205,11 @@ namespace Model
          */
         virtual Model::SetInstanceProtectionOutcomeCallable SetInstanceProtectionCallable(const Model::SetInstanceProtectionRequest& request) const;
 
+        /**
+         * Same as SetInstanceProtectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetInstanceProtectionOutcomeCallable SetInstanceProtectionCallable(Model::SetInstanceProtectionRequest&& request) const;
+
         /**
          * <p>Updates the instance protection settings of the specified instances.</p>
          * <p>For more information, see <a
@@ -1712,6 +2220,11 @@ namespace Model
          */
         virtual void SetInstanceProtectionAsync(const Model::SetInstanceProtectionRequest& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetInstanceProtectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetInstanceProtectionAsync(Model::SetInstanceProtectionRequest&& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Suspends the specified Auto Scaling processes, or all processes, for the
          * specified Auto Scaling group.</p> <p>Note that if you suspend either the
@@ -1740,6 +2253,11 @@ namespace Model
          */
         virtual Model::SuspendProcessesOutcomeCallable SuspendProcessesCallable(const Model::SuspendProcessesRequest& request) const;
 
+        /**
+         * Same as SuspendProcessesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SuspendProcessesOutcomeCallable SuspendProcessesCallable(Model::SuspendProcessesRequest&& request) const;
+
         /**
          * <p>Suspends the specified Auto Scaling processes, or all processes, for the
          * specified Auto Scaling group.</p> <p>Note that if you suspend either the
@@ -1755,6 +2273,11 @@ namespace Model
          */
         virtual void SuspendProcessesAsync(const Model::SuspendProcessesRequest& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SuspendProcessesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SuspendProcessesAsync(Model::SuspendProcessesRequest&& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Terminates the specified instance and optionally adjusts the desired group
          * size.</p> <p>This call simply makes a termination request. The instance is not
@@ -1771,6 +2294,11 @@ namespace Model
          */
         virtual Model::TerminateInstanceInAutoScalingGroupOutcomeCallable TerminateInstanceInAutoScalingGroupCallable(const Model::TerminateInstanceInAutoScalingGroupRequest& request) const;
 
+        /**
+         * Same as TerminateInstanceInAutoScalingGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::TerminateInstanceInAutoScalingGroupOutcomeCallable TerminateInstanceInAutoScalingGroupCallable(Model::TerminateInstanceInAutoScalingGroupRequest&& request) const;
+
         /**
          * <p>Terminates the specified instance and optionally adjusts the desired group
          * size.</p> <p>This call simply makes a termination request. The instance is not
@@ -1780,6 +2308,11 @@ namespace Model
          */
         virtual void TerminateInstanceInAutoScalingGroupAsync(const Model::TerminateInstanceInAutoScalingGroupRequest& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TerminateInstanceInAutoScalingGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void TerminateInstanceInAutoScalingGroupAsync(Model::TerminateInstanceInAutoScalingGroupRequest&& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the configuration for the specified Auto Scaling group.</p> <p>To
          * update an Auto Scaling group with a launch configuration with
@@ -1828,6 +2361,11 @@ namespace Model
          */
         virtual Model::UpdateAutoScalingGroupOutcomeCallable UpdateAutoScalingGroupCallable(const Model::UpdateAutoScalingGroupRequest& request) const;
 
+        /**
+         * Same as UpdateAutoScalingGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateAutoScalingGroupOutcomeCallable UpdateAutoScalingGroupCallable(Model::UpdateAutoScalingGroupRequest&& request) const;
+
         /**
          * <p>Updates the configuration for the specified Auto Scaling group.</p> <p>To
          * update an Auto Scaling group with a launch configuration with
@@ -1853,6 +2391,116 @@ namespace Model
          */
         virtual void UpdateAutoScalingGroupAsync(const Model::UpdateAutoScalingGroupRequest& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAutoScalingGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateAutoScalingGroupAsync(Model::UpdateAutoScalingGroupRequest&& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachInstancesOutcome> AttachInstancesAwaitable(const Model::AttachInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::AttachInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachInstancesOutcome> AttachInstancesAwaitable(Model::AttachInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::AttachInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachLoadBalancersOutcome> AttachLoadBalancersAwaitable(const Model::AttachLoadBalancersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::AttachLoadBalancers, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachLoadBalancersOutcome> AttachLoadBalancersAwaitable(Model::AttachLoadBalancersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::AttachLoadBalancers, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CompleteLifecycleActionOutcome> CompleteLifecycleActionAwaitable(const Model::CompleteLifecycleActionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::CompleteLifecycleAction, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CompleteLifecycleActionOutcome> CompleteLifecycleActionAwaitable(Model::CompleteLifecycleActionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::CompleteLifecycleAction, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAutoScalingGroupOutcome> CreateAutoScalingGroupAwaitable(const Model::CreateAutoScalingGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::CreateAutoScalingGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAutoScalingGroupOutcome> CreateAutoScalingGroupAwaitable(Model::CreateAutoScalingGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::CreateAutoScalingGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLaunchConfigurationOutcome> CreateLaunchConfigurationAwaitable(const Model::CreateLaunchConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::CreateLaunchConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLaunchConfigurationOutcome> CreateLaunchConfigurationAwaitable(Model::CreateLaunchConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::CreateLaunchConfiguration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateOrUpdateTagsOutcome> CreateOrUpdateTagsAwaitable(const Model::CreateOrUpdateTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::CreateOrUpdateTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateOrUpdateTagsOutcome> CreateOrUpdateTagsAwaitable(Model::CreateOrUpdateTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::CreateOrUpdateTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAutoScalingGroupOutcome> DeleteAutoScalingGroupAwaitable(const Model::DeleteAutoScalingGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DeleteAutoScalingGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAutoScalingGroupOutcome> DeleteAutoScalingGroupAwaitable(Model::DeleteAutoScalingGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DeleteAutoScalingGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLaunchConfigurationOutcome> DeleteLaunchConfigurationAwaitable(const Model::DeleteLaunchConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DeleteLaunchConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLaunchConfigurationOutcome> DeleteLaunchConfigurationAwaitable(Model::DeleteLaunchConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DeleteLaunchConfiguration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLifecycleHookOutcome> DeleteLifecycleHookAwaitable(const Model::DeleteLifecycleHookRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DeleteLifecycleHook, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLifecycleHookOutcome> DeleteLifecycleHookAwaitable(Model::DeleteLifecycleHookRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DeleteLifecycleHook, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteNotificationConfigurationOutcome> DeleteNotificationConfigurationAwaitable(const Model::DeleteNotificationConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DeleteNotificationConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteNotificationConfigurationOutcome> DeleteNotificationConfigurationAwaitable(Model::DeleteNotificationConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DeleteNotificationConfiguration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePolicyOutcome> DeletePolicyAwaitable(const Model::DeletePolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DeletePolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePolicyOutcome> DeletePolicyAwaitable(Model::DeletePolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DeletePolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteScheduledActionOutcome> DeleteScheduledActionAwaitable(const Model::DeleteScheduledActionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DeleteScheduledAction, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteScheduledActionOutcome> DeleteScheduledActionAwaitable(Model::DeleteScheduledActionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DeleteScheduledAction, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTagsOutcome> DeleteTagsAwaitable(const Model::DeleteTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DeleteTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTagsOutcome> DeleteTagsAwaitable(Model::DeleteTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DeleteTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAccountLimitsOutcome> DescribeAccountLimitsAwaitable(const Model::DescribeAccountLimitsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeAccountLimits, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAccountLimitsOutcome> DescribeAccountLimitsAwaitable(Model::DescribeAccountLimitsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeAccountLimits, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAdjustmentTypesOutcome> DescribeAdjustmentTypesAwaitable(const Model::DescribeAdjustmentTypesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeAdjustmentTypes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAdjustmentTypesOutcome> DescribeAdjustmentTypesAwaitable(Model::DescribeAdjustmentTypesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeAdjustmentTypes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAutoScalingGroupsOutcome> DescribeAutoScalingGroupsAwaitable(const Model::DescribeAutoScalingGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeAutoScalingGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAutoScalingGroupsOutcome> DescribeAutoScalingGroupsAwaitable(Model::DescribeAutoScalingGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeAutoScalingGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAutoScalingInstancesOutcome> DescribeAutoScalingInstancesAwaitable(const Model::DescribeAutoScalingInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeAutoScalingInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAutoScalingInstancesOutcome> DescribeAutoScalingInstancesAwaitable(Model::DescribeAutoScalingInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeAutoScalingInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAutoScalingNotificationTypesOutcome> DescribeAutoScalingNotificationTypesAwaitable(const Model::DescribeAutoScalingNotificationTypesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeAutoScalingNotificationTypes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAutoScalingNotificationTypesOutcome> DescribeAutoScalingNotificationTypesAwaitable(Model::DescribeAutoScalingNotificationTypesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeAutoScalingNotificationTypes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLaunchConfigurationsOutcome> DescribeLaunchConfigurationsAwaitable(const Model::DescribeLaunchConfigurationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeLaunchConfigurations, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLaunchConfigurationsOutcome> DescribeLaunchConfigurationsAwaitable(Model::DescribeLaunchConfigurationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeLaunchConfigurations, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLifecycleHookTypesOutcome> DescribeLifecycleHookTypesAwaitable(const Model::DescribeLifecycleHookTypesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeLifecycleHookTypes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLifecycleHookTypesOutcome> DescribeLifecycleHookTypesAwaitable(Model::DescribeLifecycleHookTypesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeLifecycleHookTypes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLifecycleHooksOutcome> DescribeLifecycleHooksAwaitable(const Model::DescribeLifecycleHooksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeLifecycleHooks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLifecycleHooksOutcome> DescribeLifecycleHooksAwaitable(Model::DescribeLifecycleHooksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeLifecycleHooks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLoadBalancersOutcome> DescribeLoadBalancersAwaitable(const Model::DescribeLoadBalancersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeLoadBalancers, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLoadBalancersOutcome> DescribeLoadBalancersAwaitable(Model::DescribeLoadBalancersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeLoadBalancers, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMetricCollectionTypesOutcome> DescribeMetricCollectionTypesAwaitable(const Model::DescribeMetricCollectionTypesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeMetricCollectionTypes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMetricCollectionTypesOutcome> DescribeMetricCollectionTypesAwaitable(Model::DescribeMetricCollectionTypesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeMetricCollectionTypes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeNotificationConfigurationsOutcome> DescribeNotificationConfigurationsAwaitable(const Model::DescribeNotificationConfigurationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeNotificationConfigurations, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeNotificationConfigurationsOutcome> DescribeNotificationConfigurationsAwaitable(Model::DescribeNotificationConfigurationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeNotificationConfigurations, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribePoliciesOutcome> DescribePoliciesAwaitable(const Model::DescribePoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribePolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribePoliciesOutcome> DescribePoliciesAwaitable(Model::DescribePoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribePolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeScalingActivitiesOutcome> DescribeScalingActivitiesAwaitable(const Model::DescribeScalingActivitiesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeScalingActivities, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeScalingActivitiesOutcome> DescribeScalingActivitiesAwaitable(Model::DescribeScalingActivitiesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeScalingActivities, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeScalingProcessTypesOutcome> DescribeScalingProcessTypesAwaitable(const Model::DescribeScalingProcessTypesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeScalingProcessTypes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeScalingProcessTypesOutcome> DescribeScalingProcessTypesAwaitable(Model::DescribeScalingProcessTypesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeScalingProcessTypes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeScheduledActionsOutcome> DescribeScheduledActionsAwaitable(const Model::DescribeScheduledActionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeScheduledActions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeScheduledActionsOutcome> DescribeScheduledActionsAwaitable(Model::DescribeScheduledActionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeScheduledActions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTagsOutcome> DescribeTagsAwaitable(const Model::DescribeTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTagsOutcome> DescribeTagsAwaitable(Model::DescribeTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTerminationPolicyTypesOutcome> DescribeTerminationPolicyTypesAwaitable(const Model::DescribeTerminationPolicyTypesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeTerminationPolicyTypes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTerminationPolicyTypesOutcome> DescribeTerminationPolicyTypesAwaitable(Model::DescribeTerminationPolicyTypesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DescribeTerminationPolicyTypes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachInstancesOutcome> DetachInstancesAwaitable(const Model::DetachInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DetachInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachInstancesOutcome> DetachInstancesAwaitable(Model::DetachInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DetachInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachLoadBalancersOutcome> DetachLoadBalancersAwaitable(const Model::DetachLoadBalancersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DetachLoadBalancers, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachLoadBalancersOutcome> DetachLoadBalancersAwaitable(Model::DetachLoadBalancersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DetachLoadBalancers, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableMetricsCollectionOutcome> DisableMetricsCollectionAwaitable(const Model::DisableMetricsCollectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DisableMetricsCollection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableMetricsCollectionOutcome> DisableMetricsCollectionAwaitable(Model::DisableMetricsCollectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::DisableMetricsCollection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableMetricsCollectionOutcome> EnableMetricsCollectionAwaitable(const Model::EnableMetricsCollectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::EnableMetricsCollection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableMetricsCollectionOutcome> EnableMetricsCollectionAwaitable(Model::EnableMetricsCollectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::EnableMetricsCollection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnterStandbyOutcome> EnterStandbyAwaitable(const Model::EnterStandbyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::EnterStandby, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnterStandbyOutcome> EnterStandbyAwaitable(Model::EnterStandbyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::EnterStandby, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ExecutePolicyOutcome> ExecutePolicyAwaitable(const Model::ExecutePolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::ExecutePolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ExecutePolicyOutcome> ExecutePolicyAwaitable(Model::ExecutePolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::ExecutePolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ExitStandbyOutcome> ExitStandbyAwaitable(const Model::ExitStandbyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::ExitStandby, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ExitStandbyOutcome> ExitStandbyAwaitable(Model::ExitStandbyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::ExitStandby, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutLifecycleHookOutcome> PutLifecycleHookAwaitable(const Model::PutLifecycleHookRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::PutLifecycleHook, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutLifecycleHookOutcome> PutLifecycleHookAwaitable(Model::PutLifecycleHookRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::PutLifecycleHook, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutNotificationConfigurationOutcome> PutNotificationConfigurationAwaitable(const Model::PutNotificationConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::PutNotificationConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutNotificationConfigurationOutcome> PutNotificationConfigurationAwaitable(Model::PutNotificationConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::PutNotificationConfiguration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutScalingPolicyOutcome> PutScalingPolicyAwaitable(const Model::PutScalingPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::PutScalingPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutScalingPolicyOutcome> PutScalingPolicyAwaitable(Model::PutScalingPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::PutScalingPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutScheduledUpdateGroupActionOutcome> PutScheduledUpdateGroupActionAwaitable(const Model::PutScheduledUpdateGroupActionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::PutScheduledUpdateGroupAction, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutScheduledUpdateGroupActionOutcome> PutScheduledUpdateGroupActionAwaitable(Model::PutScheduledUpdateGroupActionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::PutScheduledUpdateGroupAction, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RecordLifecycleActionHeartbeatOutcome> RecordLifecycleActionHeartbeatAwaitable(const Model::RecordLifecycleActionHeartbeatRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::RecordLifecycleActionHeartbeat, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RecordLifecycleActionHeartbeatOutcome> RecordLifecycleActionHeartbeatAwaitable(Model::RecordLifecycleActionHeartbeatRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::RecordLifecycleActionHeartbeat, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResumeProcessesOutcome> ResumeProcessesAwaitable(const Model::ResumeProcessesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::ResumeProcesses, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResumeProcessesOutcome> ResumeProcessesAwaitable(Model::ResumeProcessesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::ResumeProcesses, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetDesiredCapacityOutcome> SetDesiredCapacityAwaitable(const Model::SetDesiredCapacityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::SetDesiredCapacity, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetDesiredCapacityOutcome> SetDesiredCapacityAwaitable(Model::SetDesiredCapacityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::SetDesiredCapacity, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetInstanceHealthOutcome> SetInstanceHealthAwaitable(const Model::SetInstanceHealthRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::SetInstanceHealth, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetInstanceHealthOutcome> SetInstanceHealthAwaitable(Model::SetInstanceHealthRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::SetInstanceHealth, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetInstanceProtectionOutcome> SetInstanceProtectionAwaitable(const Model::SetInstanceProtectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::SetInstanceProtection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetInstanceProtectionOutcome> SetInstanceProtectionAwaitable(Model::SetInstanceProtectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::SetInstanceProtection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SuspendProcessesOutcome> SuspendProcessesAwaitable(const Model::SuspendProcessesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::SuspendProcesses, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SuspendProcessesOutcome> SuspendProcessesAwaitable(Model::SuspendProcessesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::SuspendProcesses, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TerminateInstanceInAutoScalingGroupOutcome> TerminateInstanceInAutoScalingGroupAwaitable(const Model::TerminateInstanceInAutoScalingGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::TerminateInstanceInAutoScalingGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TerminateInstanceInAutoScalingGroupOutcome> TerminateInstanceInAutoScalingGroupAwaitable(Model::TerminateInstanceInAutoScalingGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::TerminateInstanceInAutoScalingGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAutoScalingGroupOutcome> UpdateAutoScalingGroupAwaitable(const Model::UpdateAutoScalingGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::UpdateAutoScalingGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAutoScalingGroupOutcome> UpdateAutoScalingGroupAwaitable(Model::UpdateAutoScalingGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &AutoScalingClient::UpdateAutoScalingGroup, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -156,12 +156,22 @@ AttachInstancesOutcome AutoScalingClient::AttachInstances(const AttachInstancesR
 
 AttachInstancesOutcomeCallable AutoScalingClient::AttachInstancesCallable(const AttachInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::AttachInstances, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::AttachInstances, Aws::Client::RejectedCallOutcome<AttachInstancesOutcome>(), this, request);
+}
+
+AttachInstancesOutcomeCallable AutoScalingClient::AttachInstancesCallable(AttachInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::AttachInstances, Aws::Client::RejectedCallOutcome<AttachInstancesOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::AttachInstancesAsync(const AttachInstancesRequest& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::AttachInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::AttachInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<AttachInstancesOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::AttachInstancesAsync(AttachInstancesRequest&& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::AttachInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<AttachInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::AttachInstancesAsyncHelper(const AttachInstancesRequest& request, const AttachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -186,12 +196,22 @@ AttachLoadBalancersOutcome AutoScalingClient::AttachLoadBalancers(const AttachLo
 
 AttachLoadBalancersOutcomeCallable AutoScalingClient::AttachLoadBalancersCallable(const AttachLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::AttachLoadBalancers, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::AttachLoadBalancers, Aws::Client::RejectedCallOutcome<AttachLoadBalancersOutcome>(), this, request);
+}
+
+AttachLoadBalancersOutcomeCallable AutoScalingClient::AttachLoadBalancersCallable(AttachLoadBalancersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::AttachLoadBalancers, Aws::Client::RejectedCallOutcome<AttachLoadBalancersOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::AttachLoadBalancersAsync(const AttachLoadBalancersRequest& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::AttachLoadBalancersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::AttachLoadBalancersAsyncHelper, Aws::Client::RejectedAsyncCall<AttachLoadBalancersOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::AttachLoadBalancersAsync(AttachLoadBalancersRequest&& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::AttachLoadBalancersAsyncHelper, Aws::Client::RejectedAsyncCall<AttachLoadBalancersOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::AttachLoadBalancersAsyncHelper(const AttachLoadBalancersRequest& request, const AttachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -216,12 +236,22 @@ CompleteLifecycleActionOutcome AutoScalingClient::CompleteLifecycleAction(const
 
 CompleteLifecycleActionOutcomeCallable AutoScalingClient::CompleteLifecycleActionCallable(const CompleteLifecycleActionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::CompleteLifecycleAction, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::CompleteLifecycleAction, Aws::Client::RejectedCallOutcome<CompleteLifecycleActionOutcome>(), this, request);
+}
+
+CompleteLifecycleActionOutcomeCallable AutoScalingClient::CompleteLifecycleActionCallable(CompleteLifecycleActionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::CompleteLifecycleAction, Aws::Client::RejectedCallOutcome<CompleteLifecycleActionOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::CompleteLifecycleActionAsync(const CompleteLifecycleActionRequest& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::CompleteLifecycleActionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::CompleteLifecycleActionAsyncHelper, Aws::Client::RejectedAsyncCall<CompleteLifecycleActionOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::CompleteLifecycleActionAsync(CompleteLifecycleActionRequest&& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::CompleteLifecycleActionAsyncHelper, Aws::Client::RejectedAsyncCall<CompleteLifecycleActionOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::CompleteLifecycleActionAsyncHelper(const CompleteLifecycleActionRequest& request, const CompleteLifecycleActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -246,12 +276,22 @@ CreateAutoScalingGroupOutcome AutoScalingClient::CreateAutoScalingGroup(const Cr
 
 CreateAutoScalingGroupOutcomeCallable AutoScalingClient::CreateAutoScalingGroupCallable(const CreateAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::CreateAutoScalingGroup, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::CreateAutoScalingGroup, Aws::Client::RejectedCallOutcome<CreateAutoScalingGroupOutcome>(), this, request);
+}
+
+CreateAutoScalingGroupOutcomeCallable AutoScalingClient::CreateAutoScalingGroupCallable(CreateAutoScalingGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::CreateAutoScalingGroup, Aws::Client::RejectedCallOutcome<CreateAutoScalingGroupOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::CreateAutoScalingGroupAsync(const CreateAutoScalingGroupRequest& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::CreateAutoScalingGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::CreateAutoScalingGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAutoScalingGroupOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::CreateAutoScalingGroupAsync(CreateAutoScalingGroupRequest&& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::CreateAutoScalingGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAutoScalingGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::CreateAutoScalingGroupAsyncHelper(const CreateAutoScalingGroupRequest& request, const CreateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -276,12 +316,22 @@ CreateLaunchConfigurationOutcome AutoScalingClient::CreateLaunchConfiguration(co
 
 CreateLaunchConfigurationOutcomeCallable AutoScalingClient::CreateLaunchConfigurationCallable(const CreateLaunchConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::CreateLaunchConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::CreateLaunchConfiguration, Aws::Client::RejectedCallOutcome<CreateLaunchConfigurationOutcome>(), this, request);
+}
+
+CreateLaunchConfigurationOutcomeCallable AutoScalingClient::CreateLaunchConfigurationCallable(CreateLaunchConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::CreateLaunchConfiguration, Aws::Client::RejectedCallOutcome<CreateLaunchConfigurationOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::CreateLaunchConfigurationAsync(const CreateLaunchConfigurationRequest& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::CreateLaunchConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::CreateLaunchConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLaunchConfigurationOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::CreateLaunchConfigurationAsync(CreateLaunchConfigurationRequest&& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::CreateLaunchConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLaunchConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::CreateLaunchConfigurationAsyncHelper(const CreateLaunchConfigurationRequest& request, const CreateLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -306,12 +356,22 @@ CreateOrUpdateTagsOutcome AutoScalingClient::CreateOrUpdateTags(const CreateOrUp
 
 CreateOrUpdateTagsOutcomeCallable AutoScalingClient::CreateOrUpdateTagsCallable(const CreateOrUpdateTagsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::CreateOrUpdateTags, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::CreateOrUpdateTags, Aws::Client::RejectedCallOutcome<CreateOrUpdateTagsOutcome>(), this, request);
+}
+
+CreateOrUpdateTagsOutcomeCallable AutoScalingClient::CreateOrUpdateTagsCallable(CreateOrUpdateTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::CreateOrUpdateTags, Aws::Client::RejectedCallOutcome<CreateOrUpdateTagsOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::CreateOrUpdateTagsAsync(const CreateOrUpdateTagsRequest& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::CreateOrUpdateTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::CreateOrUpdateTagsAsyncHelper, Aws::Client::RejectedAsyncCall<CreateOrUpdateTagsOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::CreateOrUpdateTagsAsync(CreateOrUpdateTagsRequest&& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::CreateOrUpdateTagsAsyncHelper, Aws::Client::RejectedAsyncCall<CreateOrUpdateTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::CreateOrUpdateTagsAsyncHelper(const CreateOrUpdateTagsRequest& request, const CreateOrUpdateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -336,12 +396,22 @@ DeleteAutoScalingGroupOutcome AutoScalingClient::DeleteAutoScalingGroup(const De
 
 DeleteAutoScalingGroupOutcomeCallable AutoScalingClient::DeleteAutoScalingGroupCallable(const DeleteAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteAutoScalingGroup, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DeleteAutoScalingGroup, Aws::Client::RejectedCallOutcome<DeleteAutoScalingGroupOutcome>(), this, request);
+}
+
+DeleteAutoScalingGroupOutcomeCallable AutoScalingClient::DeleteAutoScalingGroupCallable(DeleteAutoScalingGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DeleteAutoScalingGroup, Aws::Client::RejectedCallOutcome<DeleteAutoScalingGroupOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DeleteAutoScalingGroupAsync(const DeleteAutoScalingGroupRequest& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteAutoScalingGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DeleteAutoScalingGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAutoScalingGroupOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DeleteAutoScalingGroupAsync(DeleteAutoScalingGroupRequest&& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DeleteAutoScalingGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAutoScalingGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DeleteAutoScalingGroupAsyncHelper(const DeleteAutoScalingGroupRequest& request, const DeleteAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -366,12 +436,22 @@ DeleteLaunchConfigurationOutcome AutoScalingClient::DeleteLaunchConfiguration(co
 
 DeleteLaunchConfigurationOutcomeCallable AutoScalingClient::DeleteLaunchConfigurationCallable(const DeleteLaunchConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteLaunchConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DeleteLaunchConfiguration, Aws::Client::RejectedCallOutcome<DeleteLaunchConfigurationOutcome>(), this, request);
+}
+
+DeleteLaunchConfigurationOutcomeCallable AutoScalingClient::DeleteLaunchConfigurationCallable(DeleteLaunchConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DeleteLaunchConfiguration, Aws::Client::RejectedCallOutcome<DeleteLaunchConfigurationOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DeleteLaunchConfigurationAsync(const DeleteLaunchConfigurationRequest& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteLaunchConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DeleteLaunchConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLaunchConfigurationOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DeleteLaunchConfigurationAsync(DeleteLaunchConfigurationRequest&& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DeleteLaunchConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLaunchConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DeleteLaunchConfigurationAsyncHelper(const DeleteLaunchConfigurationRequest& request, const DeleteLaunchConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -396,12 +476,22 @@ DeleteLifecycleHookOutcome AutoScalingClient::DeleteLifecycleHook(const DeleteLi
 
 DeleteLifecycleHookOutcomeCallable AutoScalingClient::DeleteLifecycleHookCallable(const DeleteLifecycleHookRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteLifecycleHook, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DeleteLifecycleHook, Aws::Client::RejectedCallOutcome<DeleteLifecycleHookOutcome>(), this, request);
+}
+
+DeleteLifecycleHookOutcomeCallable AutoScalingClient::DeleteLifecycleHookCallable(DeleteLifecycleHookRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DeleteLifecycleHook, Aws::Client::RejectedCallOutcome<DeleteLifecycleHookOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DeleteLifecycleHookAsync(const DeleteLifecycleHookRequest& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteLifecycleHookAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DeleteLifecycleHookAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLifecycleHookOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DeleteLifecycleHookAsync(DeleteLifecycleHookRequest&& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DeleteLifecycleHookAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLifecycleHookOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DeleteLifecycleHookAsyncHelper(const DeleteLifecycleHookRequest& request, const DeleteLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -426,12 +516,22 @@ DeleteNotificationConfigurationOutcome AutoScalingClient::DeleteNotificationConf
 
 DeleteNotificationConfigurationOutcomeCallable AutoScalingClient::DeleteNotificationConfigurationCallable(const DeleteNotificationConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteNotificationConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DeleteNotificationConfiguration, Aws::Client::RejectedCallOutcome<DeleteNotificationConfigurationOutcome>(), this, request);
+}
+
+DeleteNotificationConfigurationOutcomeCallable AutoScalingClient::DeleteNotificationConfigurationCallable(DeleteNotificationConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DeleteNotificationConfiguration, Aws::Client::RejectedCallOutcome<DeleteNotificationConfigurationOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DeleteNotificationConfigurationAsync(const DeleteNotificationConfigurationRequest& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteNotificationConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DeleteNotificationConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteNotificationConfigurationOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DeleteNotificationConfigurationAsync(DeleteNotificationConfigurationRequest&& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DeleteNotificationConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteNotificationConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DeleteNotificationConfigurationAsyncHelper(const DeleteNotificationConfigurationRequest& request, const DeleteNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -456,12 +556,22 @@ DeletePolicyOutcome AutoScalingClient::DeletePolicy(const DeletePolicyRequest& r
 
 DeletePolicyOutcomeCallable AutoScalingClient::DeletePolicyCallable(const DeletePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeletePolicy, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DeletePolicy, Aws::Client::RejectedCallOutcome<DeletePolicyOutcome>(), this, request);
+}
+
+DeletePolicyOutcomeCallable AutoScalingClient::DeletePolicyCallable(DeletePolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DeletePolicy, Aws::Client::RejectedCallOutcome<DeletePolicyOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DeletePolicyAsync(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeletePolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DeletePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePolicyOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DeletePolicyAsync(DeletePolicyRequest&& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DeletePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DeletePolicyAsyncHelper(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -486,12 +596,22 @@ DeleteScheduledActionOutcome AutoScalingClient::DeleteScheduledAction(const Dele
 
 DeleteScheduledActionOutcomeCallable AutoScalingClient::DeleteScheduledActionCallable(const DeleteScheduledActionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteScheduledAction, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DeleteScheduledAction, Aws::Client::RejectedCallOutcome<DeleteScheduledActionOutcome>(), this, request);
+}
+
+DeleteScheduledActionOutcomeCallable AutoScalingClient::DeleteScheduledActionCallable(DeleteScheduledActionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DeleteScheduledAction, Aws::Client::RejectedCallOutcome<DeleteScheduledActionOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DeleteScheduledActionAsync(const DeleteScheduledActionRequest& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteScheduledActionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DeleteScheduledActionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteScheduledActionOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DeleteScheduledActionAsync(DeleteScheduledActionRequest&& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DeleteScheduledActionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteScheduledActionOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DeleteScheduledActionAsyncHelper(const DeleteScheduledActionRequest& request, const DeleteScheduledActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -516,12 +636,22 @@ DeleteTagsOutcome AutoScalingClient::DeleteTags(const DeleteTagsRequest& request
 
 DeleteTagsOutcomeCallable AutoScalingClient::DeleteTagsCallable(const DeleteTagsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DeleteTags, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DeleteTags, Aws::Client::RejectedCallOutcome<DeleteTagsOutcome>(), this, request);
+}
+
+DeleteTagsOutcomeCallable AutoScalingClient::DeleteTagsCallable(DeleteTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DeleteTags, Aws::Client::RejectedCallOutcome<DeleteTagsOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DeleteTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DeleteTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTagsOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DeleteTagsAsync(DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DeleteTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DeleteTagsAsyncHelper(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -546,12 +676,22 @@ DescribeAccountLimitsOutcome AutoScalingClient::DescribeAccountLimits(const Desc
 
 DescribeAccountLimitsOutcomeCallable AutoScalingClient::DescribeAccountLimitsCallable(const DescribeAccountLimitsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAccountLimits, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeAccountLimits, Aws::Client::RejectedCallOutcome<DescribeAccountLimitsOutcome>(), this, request);
+}
+
+DescribeAccountLimitsOutcomeCallable AutoScalingClient::DescribeAccountLimitsCallable(DescribeAccountLimitsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeAccountLimits, Aws::Client::RejectedCallOutcome<DescribeAccountLimitsOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeAccountLimitsAsync(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAccountLimitsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeAccountLimitsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAccountLimitsOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeAccountLimitsAsync(DescribeAccountLimitsRequest&& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeAccountLimitsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAccountLimitsOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeAccountLimitsAsyncHelper(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -576,12 +716,22 @@ DescribeAdjustmentTypesOutcome AutoScalingClient::DescribeAdjustmentTypes(const
 
 DescribeAdjustmentTypesOutcomeCallable AutoScalingClient::DescribeAdjustmentTypesCallable(const DescribeAdjustmentTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAdjustmentTypes, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeAdjustmentTypes, Aws::Client::RejectedCallOutcome<DescribeAdjustmentTypesOutcome>(), this, request);
+}
+
+DescribeAdjustmentTypesOutcomeCallable AutoScalingClient::DescribeAdjustmentTypesCallable(DescribeAdjustmentTypesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeAdjustmentTypes, Aws::Client::RejectedCallOutcome<DescribeAdjustmentTypesOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeAdjustmentTypesAsync(const DescribeAdjustmentTypesRequest& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAdjustmentTypesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeAdjustmentTypesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAdjustmentTypesOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeAdjustmentTypesAsync(DescribeAdjustmentTypesRequest&& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeAdjustmentTypesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAdjustmentTypesOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeAdjustmentTypesAsyncHelper(const DescribeAdjustmentTypesRequest& request, const DescribeAdjustmentTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -606,12 +756,22 @@ DescribeAutoScalingGroupsOutcome AutoScalingClient::DescribeAutoScalingGroups(co
 
 DescribeAutoScalingGroupsOutcomeCallable AutoScalingClient::DescribeAutoScalingGroupsCallable(const DescribeAutoScalingGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAutoScalingGroups, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeAutoScalingGroups, Aws::Client::RejectedCallOutcome<DescribeAutoScalingGroupsOutcome>(), this, request);
+}
+
+DescribeAutoScalingGroupsOutcomeCallable AutoScalingClient::DescribeAutoScalingGroupsCallable(DescribeAutoScalingGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeAutoScalingGroups, Aws::Client::RejectedCallOutcome<DescribeAutoScalingGroupsOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeAutoScalingGroupsAsync(const DescribeAutoScalingGroupsRequest& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAutoScalingGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeAutoScalingGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAutoScalingGroupsOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeAutoScalingGroupsAsync(DescribeAutoScalingGroupsRequest&& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeAutoScalingGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAutoScalingGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeAutoScalingGroupsAsyncHelper(const DescribeAutoScalingGroupsRequest& request, const DescribeAutoScalingGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -636,12 +796,22 @@ DescribeAutoScalingInstancesOutcome AutoScalingClient::DescribeAutoScalingInstan
 
 DescribeAutoScalingInstancesOutcomeCallable AutoScalingClient::DescribeAutoScalingInstancesCallable(const DescribeAutoScalingInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAutoScalingInstances, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeAutoScalingInstances, Aws::Client::RejectedCallOutcome<DescribeAutoScalingInstancesOutcome>(), this, request);
+}
+
+DescribeAutoScalingInstancesOutcomeCallable AutoScalingClient::DescribeAutoScalingInstancesCallable(DescribeAutoScalingInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeAutoScalingInstances, Aws::Client::RejectedCallOutcome<DescribeAutoScalingInstancesOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeAutoScalingInstancesAsync(const DescribeAutoScalingInstancesRequest& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAutoScalingInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeAutoScalingInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAutoScalingInstancesOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeAutoScalingInstancesAsync(DescribeAutoScalingInstancesRequest&& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeAutoScalingInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAutoScalingInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeAutoScalingInstancesAsyncHelper(const DescribeAutoScalingInstancesRequest& request, const DescribeAutoScalingInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -666,12 +836,22 @@ DescribeAutoScalingNotificationTypesOutcome AutoScalingClient::DescribeAutoScali
 
 DescribeAutoScalingNotificationTypesOutcomeCallable AutoScalingClient::DescribeAutoScalingNotificationTypesCallable(const DescribeAutoScalingNotificationTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeAutoScalingNotificationTypes, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeAutoScalingNotificationTypes, Aws::Client::RejectedCallOutcome<DescribeAutoScalingNotificationTypesOutcome>(), this, request);
+}
+
+DescribeAutoScalingNotificationTypesOutcomeCallable AutoScalingClient::DescribeAutoScalingNotificationTypesCallable(DescribeAutoScalingNotificationTypesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeAutoScalingNotificationTypes, Aws::Client::RejectedCallOutcome<DescribeAutoScalingNotificationTypesOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeAutoScalingNotificationTypesAsync(const DescribeAutoScalingNotificationTypesRequest& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeAutoScalingNotificationTypesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeAutoScalingNotificationTypesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAutoScalingNotificationTypesOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeAutoScalingNotificationTypesAsync(DescribeAutoScalingNotificationTypesRequest&& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeAutoScalingNotificationTypesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAutoScalingNotificationTypesOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeAutoScalingNotificationTypesAsyncHelper(const DescribeAutoScalingNotificationTypesRequest& request, const DescribeAutoScalingNotificationTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -696,12 +876,22 @@ DescribeLaunchConfigurationsOutcome AutoScalingClient::DescribeLaunchConfigurati
 
 DescribeLaunchConfigurationsOutcomeCallable AutoScalingClient::DescribeLaunchConfigurationsCallable(const DescribeLaunchConfigurationsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeLaunchConfigurations, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeLaunchConfigurations, Aws::Client::RejectedCallOutcome<DescribeLaunchConfigurationsOutcome>(), this, request);
+}
+
+DescribeLaunchConfigurationsOutcomeCallable AutoScalingClient::DescribeLaunchConfigurationsCallable(DescribeLaunchConfigurationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeLaunchConfigurations, Aws::Client::RejectedCallOutcome<DescribeLaunchConfigurationsOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeLaunchConfigurationsAsync(const DescribeLaunchConfigurationsRequest& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeLaunchConfigurationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeLaunchConfigurationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLaunchConfigurationsOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeLaunchConfigurationsAsync(DescribeLaunchConfigurationsRequest&& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeLaunchConfigurationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLaunchConfigurationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeLaunchConfigurationsAsyncHelper(const DescribeLaunchConfigurationsRequest& request, const DescribeLaunchConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -726,12 +916,22 @@ DescribeLifecycleHookTypesOutcome AutoScalingClient::DescribeLifecycleHookTypes(
 
 DescribeLifecycleHookTypesOutcomeCallable AutoScalingClient::DescribeLifecycleHookTypesCallable(const DescribeLifecycleHookTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeLifecycleHookTypes, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeLifecycleHookTypes, Aws::Client::RejectedCallOutcome<DescribeLifecycleHookTypesOutcome>(), this, request);
+}
+
+DescribeLifecycleHookTypesOutcomeCallable AutoScalingClient::DescribeLifecycleHookTypesCallable(DescribeLifecycleHookTypesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeLifecycleHookTypes, Aws::Client::RejectedCallOutcome<DescribeLifecycleHookTypesOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeLifecycleHookTypesAsync(const DescribeLifecycleHookTypesRequest& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeLifecycleHookTypesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeLifecycleHookTypesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLifecycleHookTypesOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeLifecycleHookTypesAsync(DescribeLifecycleHookTypesRequest&& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeLifecycleHookTypesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLifecycleHookTypesOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeLifecycleHookTypesAsyncHelper(const DescribeLifecycleHookTypesRequest& request, const DescribeLifecycleHookTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -756,12 +956,22 @@ DescribeLifecycleHooksOutcome AutoScalingClient::DescribeLifecycleHooks(const De
 
 DescribeLifecycleHooksOutcomeCallable AutoScalingClient::DescribeLifecycleHooksCallable(const DescribeLifecycleHooksRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeLifecycleHooks, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeLifecycleHooks, Aws::Client::RejectedCallOutcome<DescribeLifecycleHooksOutcome>(), this, request);
+}
+
+DescribeLifecycleHooksOutcomeCallable AutoScalingClient::DescribeLifecycleHooksCallable(DescribeLifecycleHooksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeLifecycleHooks, Aws::Client::RejectedCallOutcome<DescribeLifecycleHooksOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeLifecycleHooksAsync(const DescribeLifecycleHooksRequest& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeLifecycleHooksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeLifecycleHooksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLifecycleHooksOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeLifecycleHooksAsync(DescribeLifecycleHooksRequest&& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeLifecycleHooksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLifecycleHooksOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeLifecycleHooksAsyncHelper(const DescribeLifecycleHooksRequest& request, const DescribeLifecycleHooksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -786,12 +996,22 @@ DescribeLoadBalancersOutcome AutoScalingClient::DescribeLoadBalancers(const Desc
 
 DescribeLoadBalancersOutcomeCallable AutoScalingClient::DescribeLoadBalancersCallable(const DescribeLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeLoadBalancers, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeLoadBalancers, Aws::Client::RejectedCallOutcome<DescribeLoadBalancersOutcome>(), this, request);
+}
+
+DescribeLoadBalancersOutcomeCallable AutoScalingClient::DescribeLoadBalancersCallable(DescribeLoadBalancersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeLoadBalancers, Aws::Client::RejectedCallOutcome<DescribeLoadBalancersOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeLoadBalancersAsync(const DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeLoadBalancersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeLoadBalancersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLoadBalancersOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeLoadBalancersAsync(DescribeLoadBalancersRequest&& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeLoadBalancersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLoadBalancersOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeLoadBalancersAsyncHelper(const DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -816,12 +1036,22 @@ DescribeMetricCollectionTypesOutcome AutoScalingClient::DescribeMetricCollection
 
 DescribeMetricCollectionTypesOutcomeCallable AutoScalingClient::DescribeMetricCollectionTypesCallable(const DescribeMetricCollectionTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeMetricCollectionTypes, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeMetricCollectionTypes, Aws::Client::RejectedCallOutcome<DescribeMetricCollectionTypesOutcome>(), this, request);
+}
+
+DescribeMetricCollectionTypesOutcomeCallable AutoScalingClient::DescribeMetricCollectionTypesCallable(DescribeMetricCollectionTypesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeMetricCollectionTypes, Aws::Client::RejectedCallOutcome<DescribeMetricCollectionTypesOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeMetricCollectionTypesAsync(const DescribeMetricCollectionTypesRequest& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeMetricCollectionTypesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeMetricCollectionTypesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMetricCollectionTypesOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeMetricCollectionTypesAsync(DescribeMetricCollectionTypesRequest&& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeMetricCollectionTypesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMetricCollectionTypesOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeMetricCollectionTypesAsyncHelper(const DescribeMetricCollectionTypesRequest& request, const DescribeMetricCollectionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -846,12 +1076,22 @@ DescribeNotificationConfigurationsOutcome AutoScalingClient::DescribeNotificatio
 
 DescribeNotificationConfigurationsOutcomeCallable AutoScalingClient::DescribeNotificationConfigurationsCallable(const DescribeNotificationConfigurationsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeNotificationConfigurations, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeNotificationConfigurations, Aws::Client::RejectedCallOutcome<DescribeNotificationConfigurationsOutcome>(), this, request);
+}
+
+DescribeNotificationConfigurationsOutcomeCallable AutoScalingClient::DescribeNotificationConfigurationsCallable(DescribeNotificationConfigurationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeNotificationConfigurations, Aws::Client::RejectedCallOutcome<DescribeNotificationConfigurationsOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeNotificationConfigurationsAsync(const DescribeNotificationConfigurationsRequest& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeNotificationConfigurationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeNotificationConfigurationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeNotificationConfigurationsOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeNotificationConfigurationsAsync(DescribeNotificationConfigurationsRequest&& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeNotificationConfigurationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeNotificationConfigurationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeNotificationConfigurationsAsyncHelper(const DescribeNotificationConfigurationsRequest& request, const DescribeNotificationConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -876,12 +1116,22 @@ DescribePoliciesOutcome AutoScalingClient::DescribePolicies(const DescribePolici
 
 DescribePoliciesOutcomeCallable AutoScalingClient::DescribePoliciesCallable(const DescribePoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribePolicies, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribePolicies, Aws::Client::RejectedCallOutcome<DescribePoliciesOutcome>(), this, request);
+}
+
+DescribePoliciesOutcomeCallable AutoScalingClient::DescribePoliciesCallable(DescribePoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribePolicies, Aws::Client::RejectedCallOutcome<DescribePoliciesOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribePoliciesAsync(const DescribePoliciesRequest& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribePoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribePoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribePoliciesOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribePoliciesAsync(DescribePoliciesRequest&& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribePoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribePoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribePoliciesAsyncHelper(const DescribePoliciesRequest& request, const DescribePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -906,12 +1156,22 @@ DescribeScalingActivitiesOutcome AutoScalingClient::DescribeScalingActivities(co
 
 DescribeScalingActivitiesOutcomeCallable AutoScalingClient::DescribeScalingActivitiesCallable(const DescribeScalingActivitiesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeScalingActivities, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeScalingActivities, Aws::Client::RejectedCallOutcome<DescribeScalingActivitiesOutcome>(), this, request);
+}
+
+DescribeScalingActivitiesOutcomeCallable AutoScalingClient::DescribeScalingActivitiesCallable(DescribeScalingActivitiesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeScalingActivities, Aws::Client::RejectedCallOutcome<DescribeScalingActivitiesOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeScalingActivitiesAsync(const DescribeScalingActivitiesRequest& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeScalingActivitiesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeScalingActivitiesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeScalingActivitiesOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeScalingActivitiesAsync(DescribeScalingActivitiesRequest&& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeScalingActivitiesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeScalingActivitiesOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeScalingActivitiesAsyncHelper(const DescribeScalingActivitiesRequest& request, const DescribeScalingActivitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -936,12 +1196,22 @@ DescribeScalingProcessTypesOutcome AutoScalingClient::DescribeScalingProcessType
 
 DescribeScalingProcessTypesOutcomeCallable AutoScalingClient::DescribeScalingProcessTypesCallable(const DescribeScalingProcessTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeScalingProcessTypes, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeScalingProcessTypes, Aws::Client::RejectedCallOutcome<DescribeScalingProcessTypesOutcome>(), this, request);
+}
+
+DescribeScalingProcessTypesOutcomeCallable AutoScalingClient::DescribeScalingProcessTypesCallable(DescribeScalingProcessTypesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeScalingProcessTypes, Aws::Client::RejectedCallOutcome<DescribeScalingProcessTypesOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeScalingProcessTypesAsync(const DescribeScalingProcessTypesRequest& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeScalingProcessTypesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeScalingProcessTypesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeScalingProcessTypesOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeScalingProcessTypesAsync(DescribeScalingProcessTypesRequest&& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeScalingProcessTypesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeScalingProcessTypesOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeScalingProcessTypesAsyncHelper(const DescribeScalingProcessTypesRequest& request, const DescribeScalingProcessTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -966,12 +1236,22 @@ DescribeScheduledActionsOutcome AutoScalingClient::DescribeScheduledActions(cons
 
 DescribeScheduledActionsOutcomeCallable AutoScalingClient::DescribeScheduledActionsCallable(const DescribeScheduledActionsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeScheduledActions, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeScheduledActions, Aws::Client::RejectedCallOutcome<DescribeScheduledActionsOutcome>(), this, request);
+}
+
+DescribeScheduledActionsOutcomeCallable AutoScalingClient::DescribeScheduledActionsCallable(DescribeScheduledActionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeScheduledActions, Aws::Client::RejectedCallOutcome<DescribeScheduledActionsOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeScheduledActionsAsync(const DescribeScheduledActionsRequest& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeScheduledActionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeScheduledActionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeScheduledActionsOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeScheduledActionsAsync(DescribeScheduledActionsRequest&& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeScheduledActionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeScheduledActionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeScheduledActionsAsyncHelper(const DescribeScheduledActionsRequest& request, const DescribeScheduledActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -996,12 +1276,22 @@ DescribeTagsOutcome AutoScalingClient::DescribeTags(const DescribeTagsRequest& r
 
 DescribeTagsOutcomeCallable AutoScalingClient::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeTags, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeTags, Aws::Client::RejectedCallOutcome<DescribeTagsOutcome>(), this, request);
+}
+
+DescribeTagsOutcomeCallable AutoScalingClient::DescribeTagsCallable(DescribeTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeTags, Aws::Client::RejectedCallOutcome<DescribeTagsOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTagsOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeTagsAsync(DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1026,12 +1316,22 @@ DescribeTerminationPolicyTypesOutcome AutoScalingClient::DescribeTerminationPoli
 
 DescribeTerminationPolicyTypesOutcomeCallable AutoScalingClient::DescribeTerminationPolicyTypesCallable(const DescribeTerminationPolicyTypesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DescribeTerminationPolicyTypes, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeTerminationPolicyTypes, Aws::Client::RejectedCallOutcome<DescribeTerminationPolicyTypesOutcome>(), this, request);
+}
+
+DescribeTerminationPolicyTypesOutcomeCallable AutoScalingClient::DescribeTerminationPolicyTypesCallable(DescribeTerminationPolicyTypesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DescribeTerminationPolicyTypes, Aws::Client::RejectedCallOutcome<DescribeTerminationPolicyTypesOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DescribeTerminationPolicyTypesAsync(const DescribeTerminationPolicyTypesRequest& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DescribeTerminationPolicyTypesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeTerminationPolicyTypesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTerminationPolicyTypesOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DescribeTerminationPolicyTypesAsync(DescribeTerminationPolicyTypesRequest&& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DescribeTerminationPolicyTypesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTerminationPolicyTypesOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DescribeTerminationPolicyTypesAsyncHelper(const DescribeTerminationPolicyTypesRequest& request, const DescribeTerminationPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1056,12 +1356,22 @@ DetachInstancesOutcome AutoScalingClient::DetachInstances(const DetachInstancesR
 
 DetachInstancesOutcomeCallable AutoScalingClient::DetachInstancesCallable(const DetachInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DetachInstances, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DetachInstances, Aws::Client::RejectedCallOutcome<DetachInstancesOutcome>(), this, request);
+}
+
+DetachInstancesOutcomeCallable AutoScalingClient::DetachInstancesCallable(DetachInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DetachInstances, Aws::Client::RejectedCallOutcome<DetachInstancesOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DetachInstancesAsync(const DetachInstancesRequest& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DetachInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DetachInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DetachInstancesOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DetachInstancesAsync(DetachInstancesRequest&& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DetachInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DetachInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DetachInstancesAsyncHelper(const DetachInstancesRequest& request, const DetachInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1086,12 +1396,22 @@ DetachLoadBalancersOutcome AutoScalingClient::DetachLoadBalancers(const DetachLo
 
 DetachLoadBalancersOutcomeCallable AutoScalingClient::DetachLoadBalancersCallable(const DetachLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DetachLoadBalancers, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DetachLoadBalancers, Aws::Client::RejectedCallOutcome<DetachLoadBalancersOutcome>(), this, request);
+}
+
+DetachLoadBalancersOutcomeCallable AutoScalingClient::DetachLoadBalancersCallable(DetachLoadBalancersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DetachLoadBalancers, Aws::Client::RejectedCallOutcome<DetachLoadBalancersOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DetachLoadBalancersAsync(const DetachLoadBalancersRequest& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DetachLoadBalancersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DetachLoadBalancersAsyncHelper, Aws::Client::RejectedAsyncCall<DetachLoadBalancersOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DetachLoadBalancersAsync(DetachLoadBalancersRequest&& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DetachLoadBalancersAsyncHelper, Aws::Client::RejectedAsyncCall<DetachLoadBalancersOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DetachLoadBalancersAsyncHelper(const DetachLoadBalancersRequest& request, const DetachLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1116,12 +1436,22 @@ DisableMetricsCollectionOutcome AutoScalingClient::DisableMetricsCollection(cons
 
 DisableMetricsCollectionOutcomeCallable AutoScalingClient::DisableMetricsCollectionCallable(const DisableMetricsCollectionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::DisableMetricsCollection, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DisableMetricsCollection, Aws::Client::RejectedCallOutcome<DisableMetricsCollectionOutcome>(), this, request);
+}
+
+DisableMetricsCollectionOutcomeCallable AutoScalingClient::DisableMetricsCollectionCallable(DisableMetricsCollectionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::DisableMetricsCollection, Aws::Client::RejectedCallOutcome<DisableMetricsCollectionOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::DisableMetricsCollectionAsync(const DisableMetricsCollectionRequest& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::DisableMetricsCollectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::DisableMetricsCollectionAsyncHelper, Aws::Client::RejectedAsyncCall<DisableMetricsCollectionOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::DisableMetricsCollectionAsync(DisableMetricsCollectionRequest&& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::DisableMetricsCollectionAsyncHelper, Aws::Client::RejectedAsyncCall<DisableMetricsCollectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::DisableMetricsCollectionAsyncHelper(const DisableMetricsCollectionRequest& request, const DisableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1146,12 +1476,22 @@ EnableMetricsCollectionOutcome AutoScalingClient::EnableMetricsCollection(const
 
 EnableMetricsCollectionOutcomeCallable AutoScalingClient::EnableMetricsCollectionCallable(const EnableMetricsCollectionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::EnableMetricsCollection, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::EnableMetricsCollection, Aws::Client::RejectedCallOutcome<EnableMetricsCollectionOutcome>(), this, request);
+}
+
+EnableMetricsCollectionOutcomeCallable AutoScalingClient::EnableMetricsCollectionCallable(EnableMetricsCollectionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::EnableMetricsCollection, Aws::Client::RejectedCallOutcome<EnableMetricsCollectionOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::EnableMetricsCollectionAsync(const EnableMetricsCollectionRequest& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::EnableMetricsCollectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::EnableMetricsCollectionAsyncHelper, Aws::Client::RejectedAsyncCall<EnableMetricsCollectionOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::EnableMetricsCollectionAsync(EnableMetricsCollectionRequest&& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::EnableMetricsCollectionAsyncHelper, Aws::Client::RejectedAsyncCall<EnableMetricsCollectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::EnableMetricsCollectionAsyncHelper(const EnableMetricsCollectionRequest& request, const EnableMetricsCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1176,12 +1516,22 @@ EnterStandbyOutcome AutoScalingClient::EnterStandby(const EnterStandbyRequest& r
 
 EnterStandbyOutcomeCallable AutoScalingClient::EnterStandbyCallable(const EnterStandbyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::EnterStandby, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::EnterStandby, Aws::Client::RejectedCallOutcome<EnterStandbyOutcome>(), this, request);
+}
+
+EnterStandbyOutcomeCallable AutoScalingClient::EnterStandbyCallable(EnterStandbyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::EnterStandby, Aws::Client::RejectedCallOutcome<EnterStandbyOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::EnterStandbyAsync(const EnterStandbyRequest& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::EnterStandbyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::EnterStandbyAsyncHelper, Aws::Client::RejectedAsyncCall<EnterStandbyOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::EnterStandbyAsync(EnterStandbyRequest&& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::EnterStandbyAsyncHelper, Aws::Client::RejectedAsyncCall<EnterStandbyOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::EnterStandbyAsyncHelper(const EnterStandbyRequest& request, const EnterStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1206,12 +1556,22 @@ ExecutePolicyOutcome AutoScalingClient::ExecutePolicy(const ExecutePolicyRequest
 
 ExecutePolicyOutcomeCallable AutoScalingClient::ExecutePolicyCallable(const ExecutePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::ExecutePolicy, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::ExecutePolicy, Aws::Client::RejectedCallOutcome<ExecutePolicyOutcome>(), this, request);
+}
+
+ExecutePolicyOutcomeCallable AutoScalingClient::ExecutePolicyCallable(ExecutePolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::ExecutePolicy, Aws::Client::RejectedCallOutcome<ExecutePolicyOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::ExecutePolicyAsync(const ExecutePolicyRequest& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::ExecutePolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::ExecutePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<ExecutePolicyOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::ExecutePolicyAsync(ExecutePolicyRequest&& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::ExecutePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<ExecutePolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::ExecutePolicyAsyncHelper(const ExecutePolicyRequest& request, const ExecutePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1236,12 +1596,22 @@ ExitStandbyOutcome AutoScalingClient::ExitStandby(const ExitStandbyRequest& requ
 
 ExitStandbyOutcomeCallable AutoScalingClient::ExitStandbyCallable(const ExitStandbyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::ExitStandby, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::ExitStandby, Aws::Client::RejectedCallOutcome<ExitStandbyOutcome>(), this, request);
+}
+
+ExitStandbyOutcomeCallable AutoScalingClient::ExitStandbyCallable(ExitStandbyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::ExitStandby, Aws::Client::RejectedCallOutcome<ExitStandbyOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::ExitStandbyAsync(const ExitStandbyRequest& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::ExitStandbyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::ExitStandbyAsyncHelper, Aws::Client::RejectedAsyncCall<ExitStandbyOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::ExitStandbyAsync(ExitStandbyRequest&& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::ExitStandbyAsyncHelper, Aws::Client::RejectedAsyncCall<ExitStandbyOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::ExitStandbyAsyncHelper(const ExitStandbyRequest& request, const ExitStandbyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1266,12 +1636,22 @@ PutLifecycleHookOutcome AutoScalingClient::PutLifecycleHook(const PutLifecycleHo
 
 PutLifecycleHookOutcomeCallable AutoScalingClient::PutLifecycleHookCallable(const PutLifecycleHookRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::PutLifecycleHook, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::PutLifecycleHook, Aws::Client::RejectedCallOutcome<PutLifecycleHookOutcome>(), this, request);
+}
+
+PutLifecycleHookOutcomeCallable AutoScalingClient::PutLifecycleHookCallable(PutLifecycleHookRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::PutLifecycleHook, Aws::Client::RejectedCallOutcome<PutLifecycleHookOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::PutLifecycleHookAsync(const PutLifecycleHookRequest& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::PutLifecycleHookAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::PutLifecycleHookAsyncHelper, Aws::Client::RejectedAsyncCall<PutLifecycleHookOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::PutLifecycleHookAsync(PutLifecycleHookRequest&& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::PutLifecycleHookAsyncHelper, Aws::Client::RejectedAsyncCall<PutLifecycleHookOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::PutLifecycleHookAsyncHelper(const PutLifecycleHookRequest& request, const PutLifecycleHookResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1296,12 +1676,22 @@ PutNotificationConfigurationOutcome AutoScalingClient::PutNotificationConfigurat
 
 PutNotificationConfigurationOutcomeCallable AutoScalingClient::PutNotificationConfigurationCallable(const PutNotificationConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::PutNotificationConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::PutNotificationConfiguration, Aws::Client::RejectedCallOutcome<PutNotificationConfigurationOutcome>(), this, request);
+}
+
+PutNotificationConfigurationOutcomeCallable AutoScalingClient::PutNotificationConfigurationCallable(PutNotificationConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::PutNotificationConfiguration, Aws::Client::RejectedCallOutcome<PutNotificationConfigurationOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::PutNotificationConfigurationAsync(const PutNotificationConfigurationRequest& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::PutNotificationConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::PutNotificationConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<PutNotificationConfigurationOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::PutNotificationConfigurationAsync(PutNotificationConfigurationRequest&& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::PutNotificationConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<PutNotificationConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::PutNotificationConfigurationAsyncHelper(const PutNotificationConfigurationRequest& request, const PutNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1326,12 +1716,22 @@ PutScalingPolicyOutcome AutoScalingClient::PutScalingPolicy(const PutScalingPoli
 
 PutScalingPolicyOutcomeCallable AutoScalingClient::PutScalingPolicyCallable(const PutScalingPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::PutScalingPolicy, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::PutScalingPolicy, Aws::Client::RejectedCallOutcome<PutScalingPolicyOutcome>(), this, request);
+}
+
+PutScalingPolicyOutcomeCallable AutoScalingClient::PutScalingPolicyCallable(PutScalingPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::PutScalingPolicy, Aws::Client::RejectedCallOutcome<PutScalingPolicyOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::PutScalingPolicyAsync(const PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::PutScalingPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::PutScalingPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutScalingPolicyOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::PutScalingPolicyAsync(PutScalingPolicyRequest&& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::PutScalingPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutScalingPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::PutScalingPolicyAsyncHelper(const PutScalingPolicyRequest& request, const PutScalingPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1356,12 +1756,22 @@ PutScheduledUpdateGroupActionOutcome AutoScalingClient::PutScheduledUpdateGroupA
 
 PutScheduledUpdateGroupActionOutcomeCallable AutoScalingClient::PutScheduledUpdateGroupActionCallable(const PutScheduledUpdateGroupActionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::PutScheduledUpdateGroupAction, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::PutScheduledUpdateGroupAction, Aws::Client::RejectedCallOutcome<PutScheduledUpdateGroupActionOutcome>(), this, request);
+}
+
+PutScheduledUpdateGroupActionOutcomeCallable AutoScalingClient::PutScheduledUpdateGroupActionCallable(PutScheduledUpdateGroupActionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::PutScheduledUpdateGroupAction, Aws::Client::RejectedCallOutcome<PutScheduledUpdateGroupActionOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::PutScheduledUpdateGroupActionAsync(const PutScheduledUpdateGroupActionRequest& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::PutScheduledUpdateGroupActionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::PutScheduledUpdateGroupActionAsyncHelper, Aws::Client::RejectedAsyncCall<PutScheduledUpdateGroupActionOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::PutScheduledUpdateGroupActionAsync(PutScheduledUpdateGroupActionRequest&& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::PutScheduledUpdateGroupActionAsyncHelper, Aws::Client::RejectedAsyncCall<PutScheduledUpdateGroupActionOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::PutScheduledUpdateGroupActionAsyncHelper(const PutScheduledUpdateGroupActionRequest& request, const PutScheduledUpdateGroupActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1386,12 +1796,22 @@ RecordLifecycleActionHeartbeatOutcome AutoScalingClient::RecordLifecycleActionHe
 
 RecordLifecycleActionHeartbeatOutcomeCallable AutoScalingClient::RecordLifecycleActionHeartbeatCallable(const RecordLifecycleActionHeartbeatRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::RecordLifecycleActionHeartbeat, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::RecordLifecycleActionHeartbeat, Aws::Client::RejectedCallOutcome<RecordLifecycleActionHeartbeatOutcome>(), this, request);
+}
+
+RecordLifecycleActionHeartbeatOutcomeCallable AutoScalingClient::RecordLifecycleActionHeartbeatCallable(RecordLifecycleActionHeartbeatRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::RecordLifecycleActionHeartbeat, Aws::Client::RejectedCallOutcome<RecordLifecycleActionHeartbeatOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::RecordLifecycleActionHeartbeatAsync(const RecordLifecycleActionHeartbeatRequest& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::RecordLifecycleActionHeartbeatAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::RecordLifecycleActionHeartbeatAsyncHelper, Aws::Client::RejectedAsyncCall<RecordLifecycleActionHeartbeatOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::RecordLifecycleActionHeartbeatAsync(RecordLifecycleActionHeartbeatRequest&& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::RecordLifecycleActionHeartbeatAsyncHelper, Aws::Client::RejectedAsyncCall<RecordLifecycleActionHeartbeatOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::RecordLifecycleActionHeartbeatAsyncHelper(const RecordLifecycleActionHeartbeatRequest& request, const RecordLifecycleActionHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1416,12 +1836,22 @@ ResumeProcessesOutcome AutoScalingClient::ResumeProcesses(const ResumeProcessesR
 
 ResumeProcessesOutcomeCallable AutoScalingClient::ResumeProcessesCallable(const ResumeProcessesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::ResumeProcesses, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::ResumeProcesses, Aws::Client::RejectedCallOutcome<ResumeProcessesOutcome>(), this, request);
+}
+
+ResumeProcessesOutcomeCallable AutoScalingClient::ResumeProcessesCallable(ResumeProcessesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::ResumeProcesses, Aws::Client::RejectedCallOutcome<ResumeProcessesOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::ResumeProcessesAsync(const ResumeProcessesRequest& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::ResumeProcessesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::ResumeProcessesAsyncHelper, Aws::Client::RejectedAsyncCall<ResumeProcessesOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::ResumeProcessesAsync(ResumeProcessesRequest&& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::ResumeProcessesAsyncHelper, Aws::Client::RejectedAsyncCall<ResumeProcessesOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::ResumeProcessesAsyncHelper(const ResumeProcessesRequest& request, const ResumeProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1446,12 +1876,22 @@ SetDesiredCapacityOutcome AutoScalingClient::SetDesiredCapacity(const SetDesired
 
 SetDesiredCapacityOutcomeCallable AutoScalingClient::SetDesiredCapacityCallable(const SetDesiredCapacityRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::SetDesiredCapacity, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::SetDesiredCapacity, Aws::Client::RejectedCallOutcome<SetDesiredCapacityOutcome>(), this, request);
+}
+
+SetDesiredCapacityOutcomeCallable AutoScalingClient::SetDesiredCapacityCallable(SetDesiredCapacityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::SetDesiredCapacity, Aws::Client::RejectedCallOutcome<SetDesiredCapacityOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::SetDesiredCapacityAsync(const SetDesiredCapacityRequest& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::SetDesiredCapacityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::SetDesiredCapacityAsyncHelper, Aws::Client::RejectedAsyncCall<SetDesiredCapacityOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::SetDesiredCapacityAsync(SetDesiredCapacityRequest&& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::SetDesiredCapacityAsyncHelper, Aws::Client::RejectedAsyncCall<SetDesiredCapacityOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::SetDesiredCapacityAsyncHelper(const SetDesiredCapacityRequest& request, const SetDesiredCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1476,12 +1916,22 @@ SetInstanceHealthOutcome AutoScalingClient::SetInstanceHealth(const SetInstanceH
 
 SetInstanceHealthOutcomeCallable AutoScalingClient::SetInstanceHealthCallable(const SetInstanceHealthRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::SetInstanceHealth, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::SetInstanceHealth, Aws::Client::RejectedCallOutcome<SetInstanceHealthOutcome>(), this, request);
+}
+
+SetInstanceHealthOutcomeCallable AutoScalingClient::SetInstanceHealthCallable(SetInstanceHealthRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::SetInstanceHealth, Aws::Client::RejectedCallOutcome<SetInstanceHealthOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::SetInstanceHealthAsync(const SetInstanceHealthRequest& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::SetInstanceHealthAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::SetInstanceHealthAsyncHelper, Aws::Client::RejectedAsyncCall<SetInstanceHealthOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::SetInstanceHealthAsync(SetInstanceHealthRequest&& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::SetInstanceHealthAsyncHelper, Aws::Client::RejectedAsyncCall<SetInstanceHealthOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::SetInstanceHealthAsyncHelper(const SetInstanceHealthRequest& request, const SetInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1506,12 +1956,22 @@ SetInstanceProtectionOutcome AutoScalingClient::SetInstanceProtection(const SetI
 
 SetInstanceProtectionOutcomeCallable AutoScalingClient::SetInstanceProtectionCallable(const SetInstanceProtectionRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::SetInstanceProtection, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::SetInstanceProtection, Aws::Client::RejectedCallOutcome<SetInstanceProtectionOutcome>(), this, request);
+}
+
+SetInstanceProtectionOutcomeCallable AutoScalingClient::SetInstanceProtectionCallable(SetInstanceProtectionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::SetInstanceProtection, Aws::Client::RejectedCallOutcome<SetInstanceProtectionOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::SetInstanceProtectionAsync(const SetInstanceProtectionRequest& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::SetInstanceProtectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::SetInstanceProtectionAsyncHelper, Aws::Client::RejectedAsyncCall<SetInstanceProtectionOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::SetInstanceProtectionAsync(SetInstanceProtectionRequest&& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::SetInstanceProtectionAsyncHelper, Aws::Client::RejectedAsyncCall<SetInstanceProtectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::SetInstanceProtectionAsyncHelper(const SetInstanceProtectionRequest& request, const SetInstanceProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1536,12 +1996,22 @@ SuspendProcessesOutcome AutoScalingClient::SuspendProcesses(const SuspendProcess
 
 SuspendProcessesOutcomeCallable AutoScalingClient::SuspendProcessesCallable(const SuspendProcessesRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::SuspendProcesses, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::SuspendProcesses, Aws::Client::RejectedCallOutcome<SuspendProcessesOutcome>(), this, request);
+}
+
+SuspendProcessesOutcomeCallable AutoScalingClient::SuspendProcessesCallable(SuspendProcessesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::SuspendProcesses, Aws::Client::RejectedCallOutcome<SuspendProcessesOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::SuspendProcessesAsync(const SuspendProcessesRequest& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::SuspendProcessesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::SuspendProcessesAsyncHelper, Aws::Client::RejectedAsyncCall<SuspendProcessesOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::SuspendProcessesAsync(SuspendProcessesRequest&& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::SuspendProcessesAsyncHelper, Aws::Client::RejectedAsyncCall<SuspendProcessesOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::SuspendProcessesAsyncHelper(const SuspendProcessesRequest& request, const SuspendProcessesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1566,12 +2036,22 @@ TerminateInstanceInAutoScalingGroupOutcome AutoScalingClient::TerminateInstanceI
 
 TerminateInstanceInAutoScalingGroupOutcomeCallable AutoScalingClient::TerminateInstanceInAutoScalingGroupCallable(const TerminateInstanceInAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::TerminateInstanceInAutoScalingGroup, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::TerminateInstanceInAutoScalingGroup, Aws::Client::RejectedCallOutcome<TerminateInstanceInAutoScalingGroupOutcome>(), this, request);
+}
+
+TerminateInstanceInAutoScalingGroupOutcomeCallable AutoScalingClient::TerminateInstanceInAutoScalingGroupCallable(TerminateInstanceInAutoScalingGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::TerminateInstanceInAutoScalingGroup, Aws::Client::RejectedCallOutcome<TerminateInstanceInAutoScalingGroupOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::TerminateInstanceInAutoScalingGroupAsync(const TerminateInstanceInAutoScalingGroupRequest& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::TerminateInstanceInAutoScalingGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::TerminateInstanceInAutoScalingGroupAsyncHelper, Aws::Client::RejectedAsyncCall<TerminateInstanceInAutoScalingGroupOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::TerminateInstanceInAutoScalingGroupAsync(TerminateInstanceInAutoScalingGroupRequest&& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::TerminateInstanceInAutoScalingGroupAsyncHelper, Aws::Client::RejectedAsyncCall<TerminateInstanceInAutoScalingGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::TerminateInstanceInAutoScalingGroupAsyncHelper(const TerminateInstanceInAutoScalingGroupRequest& request, const TerminateInstanceInAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1596,12 +2076,22 @@ UpdateAutoScalingGroupOutcome AutoScalingClient::UpdateAutoScalingGroup(const Up
 
 UpdateAutoScalingGroupOutcomeCallable AutoScalingClient::UpdateAutoScalingGroupCallable(const UpdateAutoScalingGroupRequest& request) const
 {
-  return std::async(std::launch::async, &AutoScalingClient::UpdateAutoScalingGroup, this, request);
+  return m_executor->SubmitWithFuture(&AutoScalingClient::UpdateAutoScalingGroup, Aws::Client::RejectedCallOutcome<UpdateAutoScalingGroupOutcome>(), this, request);
+}
+
+UpdateAutoScalingGroupOutcomeCallable AutoScalingClient::UpdateAutoScalingGroupCallable(UpdateAutoScalingGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&AutoScalingClient::UpdateAutoScalingGroup, Aws::Client::RejectedCallOutcome<UpdateAutoScalingGroupOutcome>(), this, std::move(request));
 }
 
 void AutoScalingClient::UpdateAutoScalingGroupAsync(const UpdateAutoScalingGroupRequest& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&AutoScalingClient::UpdateAutoScalingGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&AutoScalingClient::UpdateAutoScalingGroupAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAutoScalingGroupOutcome>(), this, request, handler, context);
+}
+
+void AutoScalingClient::UpdateAutoScalingGroupAsync(UpdateAutoScalingGroupRequest&& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&AutoScalingClient::UpdateAutoScalingGroupAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAutoScalingGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void AutoScalingClient::UpdateAutoScalingGroupAsyncHelper(const UpdateAutoScalingGroupRequest& request, const UpdateAutoScalingGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -38,6 +38,29 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/cloudformation/model/CancelUpdateStackRequest.h>
+#include <aws/cloudformation/model/ContinueUpdateRollbackRequest.h>
+#include <aws/cloudformation/model/CreateStackRequest.h>
+#include <aws/cloudformation/model/DeleteStackRequest.h>
+#include <aws/cloudformation/model/DescribeAccountLimitsRequest.h>
+#include <aws/cloudformation/model/DescribeStackEventsRequest.h>
+#include <aws/cloudformation/model/DescribeStackResourceRequest.h>
+#include <aws/cloudformation/model/DescribeStackResourcesRequest.h>
+#include <aws/cloudformation/model/DescribeStacksRequest.h>
+#include <aws/cloudformation/model/EstimateTemplateCostRequest.h>
+#include <aws/cloudformation/model/GetStackPolicyRequest.h>
+#include <aws/cloudformation/model/GetTemplateRequest.h>
+#include <aws/cloudformation/model/GetTemplateSummaryRequest.h>
+#include <aws/cloudformation/model/ListStackResourcesRequest.h>
+#include <aws/cloudformation/model/ListStacksRequest.h>
+#include <aws/cloudformation/model/SetStackPolicyRequest.h>
+#include <aws/cloudformation/model/SignalResourceRequest.h>
+#include <aws/cloudformation/model/UpdateStackRequest.h>
+#include <aws/cloudformation/model/ValidateTemplateRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -227,6 +250,11 @@ namespace Model
          */
         virtual Model::CancelUpdateStackOutcomeCallable CancelUpdateStackCallable(const Model::CancelUpdateStackRequest& request) const;
 
+        /**
+         * Same as CancelUpdateStackCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelUpdateStackOutcomeCallable CancelUpdateStackCallable(Model::CancelUpdateStackRequest&& request) const;
+
         /**
          * <p>Cancels an update on the specified stack. If the call completes successfully,
          * the stack rolls back the update and reverts to the previous stack
@@ -237,6 +265,11 @@ namespace Model
          */
         virtual void CancelUpdateStackAsync(const Model::CancelUpdateStackRequest& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelUpdateStackAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelUpdateStackAsync(Model::CancelUpdateStackRequest&& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>For a specified stack that is in the <code>UPDATE_ROLLBACK_FAILED</code>
          * state, continues rolling it back to the <code>UPDATE_ROLLBACK_COMPLETE</code>
@@ -273,6 +306,11 @@ namespace Model
          */
         virtual Model::ContinueUpdateRollbackOutcomeCallable ContinueUpdateRollbackCallable(const Model::ContinueUpdateRollbackRequest& request) const;
 
+        /**
+         * Same as ContinueUpdateRollbackCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ContinueUpdateRollbackOutcomeCallable ContinueUpdateRollbackCallable(Model::ContinueUpdateRollbackRequest&& request) const;
+
         /**
          * <p>For a specified stack that is in the <code>UPDATE_ROLLBACK_FAILED</code>
          * state, continues rolling it back to the <code>UPDATE_ROLLBACK_COMPLETE</code>
@@ -292,6 +330,11 @@ namespace Model
          */
         virtual void ContinueUpdateRollbackAsync(const Model::ContinueUpdateRollbackRequest& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ContinueUpdateRollbackAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ContinueUpdateRollbackAsync(Model::ContinueUpdateRollbackRequest&& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a stack as specified in the template. After the call completes
          * successfully, the stack creation starts. You can check the status of the stack
@@ -308,6 +351,11 @@ namespace Model
          */
         virtual Model::CreateStackOutcomeCallable CreateStackCallable(const Model::CreateStackRequest& request) const;
 
+        /**
+         * Same as CreateStackCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateStackOutcomeCallable CreateStackCallable(Model::CreateStackRequest&& request) const;
+
         /**
          * <p>Creates a stack as specified in the template. After the call completes
          * successfully, the stack creation starts. You can check the status of the stack
@@ -317,6 +365,11 @@ namespace Model
          */
         virtual void CreateStackAsync(const Model::CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateStackAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateStackAsync(Model::CreateStackRequest&& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a specified stack. Once the call completes successfully, stack
          * deletion starts. Deleted stacks do not show up in the <a>DescribeStacks</a> API
@@ -333,6 +386,11 @@ namespace Model
          */
         virtual Model::DeleteStackOutcomeCallable DeleteStackCallable(const Model::DeleteStackRequest& request) const;
 
+        /**
+         * Same as DeleteStackCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteStackOutcomeCallable DeleteStackCallable(Model::DeleteStackRequest&& request) const;
+
         /**
          * <p>Deletes a specified stack. Once the call completes successfully, stack
          * deletion starts. Deleted stacks do not show up in the <a>DescribeStacks</a> API
@@ -342,6 +400,11 @@ namespace Model
          */
         virtual void DeleteStackAsync(const Model::DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteStackAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteStackAsync(Model::DeleteStackRequest&& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves your account's AWS CloudFormation limits, such as the maximum
          * number of stacks that you can create in your account.</p>
@@ -356,6 +419,11 @@ namespace Model
          */
         virtual Model::DescribeAccountLimitsOutcomeCallable DescribeAccountLimitsCallable(const Model::DescribeAccountLimitsRequest& request) const;
 
+        /**
+         * Same as DescribeAccountLimitsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAccountLimitsOutcomeCallable DescribeAccountLimitsCallable(Model::DescribeAccountLimitsRequest&& request) const;
+
         /**
          * <p>Retrieves your account's AWS CloudFormation limits, such as the maximum
          * number of stacks that you can create in your account.</p>
@@ -364,6 +432,11 @@ namespace Model
          */
         virtual void DescribeAccountLimitsAsync(const Model::DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAccountLimitsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAccountLimitsAsync(Model::DescribeAccountLimitsRequest&& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns all stack related events for a specified stack. For more information
          * about a stack's event history, go to <a
@@ -386,6 +459,11 @@ namespace Model
          */
         virtual Model::DescribeStackEventsOutcomeCallable DescribeStackEventsCallable(const Model::DescribeStackEventsRequest& request) const;
 
+        /**
+         * Same as DescribeStackEventsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeStackEventsOutcomeCallable DescribeStackEventsCallable(Model::DescribeStackEventsRequest&& request) const;
+
         /**
          * <p>Returns all stack related events for a specified stack. For more information
          * about a stack's event history, go to <a
@@ -398,6 +476,11 @@ namespace Model
          */
         virtual void DescribeStackEventsAsync(const Model::DescribeStackEventsRequest& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStackEventsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeStackEventsAsync(Model::DescribeStackEventsRequest&& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a description of the specified resource in the specified stack.</p>
          * <p>For deleted stacks, DescribeStackResource returns resource information for up
@@ -414,6 +497,11 @@ namespace Model
          */
         virtual Model::DescribeStackResourceOutcomeCallable DescribeStackResourceCallable(const Model::DescribeStackResourceRequest& request) const;
 
+        /**
+         * Same as DescribeStackResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeStackResourceOutcomeCallable DescribeStackResourceCallable(Model::DescribeStackResourceRequest&& request) const;
+
         /**
          * <p>Returns a description of the specified resource in the specified stack.</p>
          * <p>For deleted stacks, DescribeStackResource returns resource information for up
@@ -423,6 +511,11 @@ namespace Model
          */
         virtual void DescribeStackResourceAsync(const Model::DescribeStackResourceRequest& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStackResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeStackResourceAsync(Model::DescribeStackResourceRequest&& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns AWS resource descriptions for running and deleted stacks. If
          * <code>StackName</code> is specified, all the associated resources that are part
@@ -467,6 +560,11 @@ namespace Model
          */
         virtual Model::DescribeStackResourcesOutcomeCallable DescribeStackResourcesCallable(const Model::DescribeStackResourcesRequest& request) const;
 
+        /**
+         * Same as DescribeStackResourcesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeStackResourcesOutcomeCallable DescribeStackResourcesCallable(Model::DescribeStackResourcesRequest&& request) const;
+
         /**
          * <p>Returns AWS resource descriptions for running and deleted stacks. If
          * <code>StackName</code> is specified, all the associated resources that are part
@@ -490,6 +588,11 @@ namespace Model
          */
         virtual void DescribeStackResourcesAsync(const Model::DescribeStackResourcesRequest& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStackResourcesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeStackResourcesAsync(Model::DescribeStackResourcesRequest&& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the description for the specified stack; if no stack name was
          * specified, then it returns the description for all the stacks created.</p>
@@ -504,6 +607,11 @@ namespace Model
          */
         virtual Model::DescribeStacksOutcomeCallable DescribeStacksCallable(const Model::DescribeStacksRequest& request) const;
 
+        /**
+         * Same as DescribeStacksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeStacksOutcomeCallable DescribeStacksCallable(Model::DescribeStacksRequest&& request) const;
+
         /**
          * <p>Returns the description for the specified stack; if no stack name was
          * specified, then it returns the description for all the stacks created.</p>
@@ -512,6 +620,11 @@ namespace Model
          */
         virtual void DescribeStacksAsync(const Model::DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStacksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeStacksAsync(Model::DescribeStacksRequest&& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the estimated monthly cost of a template. The return value is an AWS
          * Simple Monthly Calculator URL with a query string that describes the resources
@@ -528,6 +641,11 @@ namespace Model
          */
         virtual Model::EstimateTemplateCostOutcomeCallable EstimateTemplateCostCallable(const Model::EstimateTemplateCostRequest& request) const;
 
+        /**
+         * Same as EstimateTemplateCostCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EstimateTemplateCostOutcomeCallable EstimateTemplateCostCallable(Model::EstimateTemplateCostRequest&& request) const;
+
         /**
          * <p>Returns the estimated monthly cost of a template. The return value is an AWS
          * Simple Monthly Calculator URL with a query string that describes the resources
@@ -537,6 +655,11 @@ namespace Model
          */
         virtual void EstimateTemplateCostAsync(const Model::EstimateTemplateCostRequest& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EstimateTemplateCostAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EstimateTemplateCostAsync(Model::EstimateTemplateCostRequest&& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the stack policy for a specified stack. If a stack doesn't have a
          * policy, a null value is returned.</p>
@@ -551,6 +674,11 @@ namespace Model
          */
         virtual Model::GetStackPolicyOutcomeCallable GetStackPolicyCallable(const Model::GetStackPolicyRequest& request) const;
 
+        /**
+         * Same as GetStackPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetStackPolicyOutcomeCallable GetStackPolicyCallable(Model::GetStackPolicyRequest&& request) const;
+
         /**
          * <p>Returns the stack policy for a specified stack. If a stack doesn't have a
          * policy, a null value is returned.</p>
@@ -559,6 +687,11 @@ namespace Model
          */
         virtual void GetStackPolicyAsync(const Model::GetStackPolicyRequest& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetStackPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetStackPolicyAsync(Model::GetStackPolicyRequest&& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the template body for a specified stack. You can get the template for
          * running or deleted stacks.</p> <p>For deleted stacks, GetTemplate returns the
@@ -577,6 +710,11 @@ namespace Model
          */
         virtual Model::GetTemplateOutcomeCallable GetTemplateCallable(const Model::GetTemplateRequest& request) const;
 
+        /**
+         * Same as GetTemplateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetTemplateOutcomeCallable GetTemplateCallable(Model::GetTemplateRequest&& request) const;
+
         /**
          * <p>Returns the template body for a specified stack. You can get the template for
          * running or deleted stacks.</p> <p>For deleted stacks, GetTemplate returns the
@@ -587,6 +725,11 @@ namespace Model
          */
         virtual void GetTemplateAsync(const Model::GetTemplateRequest& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTemplateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetTemplateAsync(Model::GetTemplateRequest&& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about a new or existing template. The
          * <code>GetTemplateSummary</code> action is useful for viewing parameter
@@ -615,6 +758,11 @@ namespace Model
          */
         virtual Model::GetTemplateSummaryOutcomeCallable GetTemplateSummaryCallable(const Model::GetTemplateSummaryRequest& request) const;
 
+        /**
+         * Same as GetTemplateSummaryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetTemplateSummaryOutcomeCallable GetTemplateSummaryCallable(Model::GetTemplateSummaryRequest&& request) const;
+
         /**
          * <p>Returns information about a new or existing template. The
          * <code>GetTemplateSummary</code> action is useful for viewing parameter
@@ -630,6 +778,11 @@ namespace Model
          */
         virtual void GetTemplateSummaryAsync(const Model::GetTemplateSummaryRequest& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTemplateSummaryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetTemplateSummaryAsync(Model::GetTemplateSummaryRequest&& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns descriptions of all resources of the specified stack.</p> <p>For
          * deleted stacks, ListStackResources returns resource information for up to 90
@@ -646,6 +799,11 @@ namespace Model
          */
         virtual Model::ListStackResourcesOutcomeCallable ListStackResourcesCallable(const Model::ListStackResourcesRequest& request) const;
 
+        /**
+         * Same as ListStackResourcesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListStackResourcesOutcomeCallable ListStackResourcesCallable(Model::ListStackResourcesRequest&& request) const;
+
         /**
          * <p>Returns descriptions of all resources of the specified stack.</p> <p>For
          * deleted stacks, ListStackResources returns resource information for up to 90
@@ -655,6 +813,11 @@ namespace Model
          */
         virtual void ListStackResourcesAsync(const Model::ListStackResourcesRequest& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListStackResourcesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListStackResourcesAsync(Model::ListStackResourcesRequest&& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the summary information for stacks whose status matches the specified
          * StackStatusFilter. Summary information for stacks that have been deleted is kept
@@ -675,6 +838,11 @@ namespace Model
          */
         virtual Model::ListStacksOutcomeCallable ListStacksCallable(const Model::ListStacksRequest& request) const;
 
+        /**
+         * Same as ListStacksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListStacksOutcomeCallable ListStacksCallable(Model::ListStacksRequest&& request) const;
+
         /**
          * <p>Returns the summary information for stacks whose status matches the specified
          * StackStatusFilter. Summary information for stacks that have been deleted is kept
@@ -686,6 +854,11 @@ namespace Model
          */
         virtual void ListStacksAsync(const Model::ListStacksRequest& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListStacksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListStacksAsync(Model::ListStacksRequest&& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets a stack policy for a specified stack.</p>
          */
@@ -698,6 +871,11 @@ namespace Model
          */
         virtual Model::SetStackPolicyOutcomeCallable SetStackPolicyCallable(const Model::SetStackPolicyRequest& request) const;
 
+        /**
+         * Same as SetStackPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetStackPolicyOutcomeCallable SetStackPolicyCallable(Model::SetStackPolicyRequest&& request) const;
+
         /**
          * <p>Sets a stack policy for a specified stack.</p>
          *
@@ -705,6 +883,11 @@ namespace Model
          */
         virtual void SetStackPolicyAsync(const Model::SetStackPolicyRequest& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetStackPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetStackPolicyAsync(Model::SetStackPolicyRequest&& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sends a signal to the specified resource with a success or failure status.
          * You can use the SignalResource API in conjunction with a creation policy or
@@ -727,6 +910,11 @@ namespace Model
          */
         virtual Model::SignalResourceOutcomeCallable SignalResourceCallable(const Model::SignalResourceRequest& request) const;
 
+        /**
+         * Same as SignalResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SignalResourceOutcomeCallable SignalResourceCallable(Model::SignalResourceRequest&& request) const;
+
         /**
          * <p>Sends a signal to the specified resource with a success or failure status.
          * You can use the SignalResource API in conjunction with a creation policy or
@@ -739,6 +927,11 @@ namespace Model
          */
         virtual void SignalResourceAsync(const Model::SignalResourceRequest& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SignalResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SignalResourceAsync(Model::SignalResourceRequest&& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a stack as specified in the template. After the call completes
          * successfully, the stack update starts. You can check the status of the stack via
@@ -765,6 +958,11 @@ namespace Model
          */
         virtual Model::UpdateStackOutcomeCallable UpdateStackCallable(const Model::UpdateStackRequest& request) const;
 
+        /**
+         * Same as UpdateStackCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateStackOutcomeCallable UpdateStackCallable(Model::UpdateStackRequest&& request) const;
+
         /**
          * <p>Updates a stack as specified in the template. After the call completes
          * successfully, the stack update starts. You can check the status of the stack via
@@ -779,6 +977,11 @@ namespace Model
          */
         virtual void UpdateStackAsync(const Model::UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateStackAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateStackAsync(Model::UpdateStackRequest&& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Validates a specified template.</p>
          */
@@ -791,6 +994,11 @@ namespace Model
          */
         virtual Model::ValidateTemplateOutcomeCallable ValidateTemplateCallable(const Model::ValidateTemplateRequest& request) const;
 
+        /**
+         * Same as ValidateTemplateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ValidateTemplateOutcomeCallable ValidateTemplateCallable(Model::ValidateTemplateRequest&& request) const;
+
         /**
          * <p>Validates a specified template.</p>
          *
@@ -798,6 +1006,56 @@ namespace Model
          */
         virtual void ValidateTemplateAsync(const Model::ValidateTemplateRequest& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ValidateTemplateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ValidateTemplateAsync(Model::ValidateTemplateRequest&& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelUpdateStackOutcome> CancelUpdateStackAwaitable(const Model::CancelUpdateStackRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::CancelUpdateStack, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelUpdateStackOutcome> CancelUpdateStackAwaitable(Model::CancelUpdateStackRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::CancelUpdateStack, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ContinueUpdateRollbackOutcome> ContinueUpdateRollbackAwaitable(const Model::ContinueUpdateRollbackRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::ContinueUpdateRollback, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ContinueUpdateRollbackOutcome> ContinueUpdateRollbackAwaitable(Model::ContinueUpdateRollbackRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::ContinueUpdateRollback, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateStackOutcome> CreateStackAwaitable(const Model::CreateStackRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::CreateStack, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateStackOutcome> CreateStackAwaitable(Model::CreateStackRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::CreateStack, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteStackOutcome> DeleteStackAwaitable(const Model::DeleteStackRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::DeleteStack, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteStackOutcome> DeleteStackAwaitable(Model::DeleteStackRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::DeleteStack, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAccountLimitsOutcome> DescribeAccountLimitsAwaitable(const Model::DescribeAccountLimitsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::DescribeAccountLimits, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAccountLimitsOutcome> DescribeAccountLimitsAwaitable(Model::DescribeAccountLimitsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::DescribeAccountLimits, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStackEventsOutcome> DescribeStackEventsAwaitable(const Model::DescribeStackEventsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::DescribeStackEvents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStackEventsOutcome> DescribeStackEventsAwaitable(Model::DescribeStackEventsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::DescribeStackEvents, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStackResourceOutcome> DescribeStackResourceAwaitable(const Model::DescribeStackResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::DescribeStackResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStackResourceOutcome> DescribeStackResourceAwaitable(Model::DescribeStackResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::DescribeStackResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStackResourcesOutcome> DescribeStackResourcesAwaitable(const Model::DescribeStackResourcesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::DescribeStackResources, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStackResourcesOutcome> DescribeStackResourcesAwaitable(Model::DescribeStackResourcesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::DescribeStackResources, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStacksOutcome> DescribeStacksAwaitable(const Model::DescribeStacksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::DescribeStacks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStacksOutcome> DescribeStacksAwaitable(Model::DescribeStacksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::DescribeStacks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EstimateTemplateCostOutcome> EstimateTemplateCostAwaitable(const Model::EstimateTemplateCostRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::EstimateTemplateCost, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EstimateTemplateCostOutcome> EstimateTemplateCostAwaitable(Model::EstimateTemplateCostRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::EstimateTemplateCost, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetStackPolicyOutcome> GetStackPolicyAwaitable(const Model::GetStackPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::GetStackPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetStackPolicyOutcome> GetStackPolicyAwaitable(Model::GetStackPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::GetStackPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTemplateOutcome> GetTemplateAwaitable(const Model::GetTemplateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::GetTemplate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTemplateOutcome> GetTemplateAwaitable(Model::GetTemplateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::GetTemplate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTemplateSummaryOutcome> GetTemplateSummaryAwaitable(const Model::GetTemplateSummaryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::GetTemplateSummary, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTemplateSummaryOutcome> GetTemplateSummaryAwaitable(Model::GetTemplateSummaryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::GetTemplateSummary, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListStackResourcesOutcome> ListStackResourcesAwaitable(const Model::ListStackResourcesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::ListStackResources, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListStackResourcesOutcome> ListStackResourcesAwaitable(Model::ListStackResourcesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::ListStackResources, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListStacksOutcome> ListStacksAwaitable(const Model::ListStacksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::ListStacks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListStacksOutcome> ListStacksAwaitable(Model::ListStacksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::ListStacks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetStackPolicyOutcome> SetStackPolicyAwaitable(const Model::SetStackPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::SetStackPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetStackPolicyOutcome> SetStackPolicyAwaitable(Model::SetStackPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::SetStackPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SignalResourceOutcome> SignalResourceAwaitable(const Model::SignalResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::SignalResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SignalResourceOutcome> SignalResourceAwaitable(Model::SignalResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::SignalResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateStackOutcome> UpdateStackAwaitable(const Model::UpdateStackRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::UpdateStack, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateStackOutcome> UpdateStackAwaitable(Model::UpdateStackRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::UpdateStack, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ValidateTemplateOutcome> ValidateTemplateAwaitable(const Model::ValidateTemplateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::ValidateTemplate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ValidateTemplateOutcome> ValidateTemplateAwaitable(Model::ValidateTemplateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFormationClient::ValidateTemplate, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
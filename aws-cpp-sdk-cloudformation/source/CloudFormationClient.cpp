@@ -126,12 +126,22 @@ CancelUpdateStackOutcome CloudFormationClient::CancelUpdateStack(const CancelUpd
 
 CancelUpdateStackOutcomeCallable CloudFormationClient::CancelUpdateStackCallable(const CancelUpdateStackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::CancelUpdateStack, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::CancelUpdateStack, Aws::Client::RejectedCallOutcome<CancelUpdateStackOutcome>(), this, request);
+}
+
+CancelUpdateStackOutcomeCallable CloudFormationClient::CancelUpdateStackCallable(CancelUpdateStackRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::CancelUpdateStack, Aws::Client::RejectedCallOutcome<CancelUpdateStackOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::CancelUpdateStackAsync(const CancelUpdateStackRequest& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::CancelUpdateStackAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::CancelUpdateStackAsyncHelper, Aws::Client::RejectedAsyncCall<CancelUpdateStackOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::CancelUpdateStackAsync(CancelUpdateStackRequest&& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::CancelUpdateStackAsyncHelper, Aws::Client::RejectedAsyncCall<CancelUpdateStackOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::CancelUpdateStackAsyncHelper(const CancelUpdateStackRequest& request, const CancelUpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -156,12 +166,22 @@ ContinueUpdateRollbackOutcome CloudFormationClient::ContinueUpdateRollback(const
 
 ContinueUpdateRollbackOutcomeCallable CloudFormationClient::ContinueUpdateRollbackCallable(const ContinueUpdateRollbackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::ContinueUpdateRollback, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::ContinueUpdateRollback, Aws::Client::RejectedCallOutcome<ContinueUpdateRollbackOutcome>(), this, request);
+}
+
+ContinueUpdateRollbackOutcomeCallable CloudFormationClient::ContinueUpdateRollbackCallable(ContinueUpdateRollbackRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::ContinueUpdateRollback, Aws::Client::RejectedCallOutcome<ContinueUpdateRollbackOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::ContinueUpdateRollbackAsync(const ContinueUpdateRollbackRequest& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::ContinueUpdateRollbackAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::ContinueUpdateRollbackAsyncHelper, Aws::Client::RejectedAsyncCall<ContinueUpdateRollbackOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::ContinueUpdateRollbackAsync(ContinueUpdateRollbackRequest&& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::ContinueUpdateRollbackAsyncHelper, Aws::Client::RejectedAsyncCall<ContinueUpdateRollbackOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::ContinueUpdateRollbackAsyncHelper(const ContinueUpdateRollbackRequest& request, const ContinueUpdateRollbackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -186,12 +206,22 @@ CreateStackOutcome CloudFormationClient::CreateStack(const CreateStackRequest& r
 
 CreateStackOutcomeCallable CloudFormationClient::CreateStackCallable(const CreateStackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::CreateStack, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::CreateStack, Aws::Client::RejectedCallOutcome<CreateStackOutcome>(), this, request);
+}
+
+CreateStackOutcomeCallable CloudFormationClient::CreateStackCallable(CreateStackRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::CreateStack, Aws::Client::RejectedCallOutcome<CreateStackOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::CreateStackAsync(const CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::CreateStackAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::CreateStackAsyncHelper, Aws::Client::RejectedAsyncCall<CreateStackOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::CreateStackAsync(CreateStackRequest&& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::CreateStackAsyncHelper, Aws::Client::RejectedAsyncCall<CreateStackOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::CreateStackAsyncHelper(const CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -216,12 +246,22 @@ DeleteStackOutcome CloudFormationClient::DeleteStack(const DeleteStackRequest& r
 
 DeleteStackOutcomeCallable CloudFormationClient::DeleteStackCallable(const DeleteStackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DeleteStack, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::DeleteStack, Aws::Client::RejectedCallOutcome<DeleteStackOutcome>(), this, request);
+}
+
+DeleteStackOutcomeCallable CloudFormationClient::DeleteStackCallable(DeleteStackRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::DeleteStack, Aws::Client::RejectedCallOutcome<DeleteStackOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::DeleteStackAsync(const DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DeleteStackAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::DeleteStackAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteStackOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::DeleteStackAsync(DeleteStackRequest&& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::DeleteStackAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteStackOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::DeleteStackAsyncHelper(const DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -246,12 +286,22 @@ DescribeAccountLimitsOutcome CloudFormationClient::DescribeAccountLimits(const D
 
 DescribeAccountLimitsOutcomeCallable CloudFormationClient::DescribeAccountLimitsCallable(const DescribeAccountLimitsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeAccountLimits, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::DescribeAccountLimits, Aws::Client::RejectedCallOutcome<DescribeAccountLimitsOutcome>(), this, request);
+}
+
+DescribeAccountLimitsOutcomeCallable CloudFormationClient::DescribeAccountLimitsCallable(DescribeAccountLimitsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::DescribeAccountLimits, Aws::Client::RejectedCallOutcome<DescribeAccountLimitsOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::DescribeAccountLimitsAsync(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeAccountLimitsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::DescribeAccountLimitsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAccountLimitsOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::DescribeAccountLimitsAsync(DescribeAccountLimitsRequest&& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::DescribeAccountLimitsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAccountLimitsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::DescribeAccountLimitsAsyncHelper(const DescribeAccountLimitsRequest& request, const DescribeAccountLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -276,12 +326,22 @@ DescribeStackEventsOutcome CloudFormationClient::DescribeStackEvents(const Descr
 
 DescribeStackEventsOutcomeCallable CloudFormationClient::DescribeStackEventsCallable(const DescribeStackEventsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeStackEvents, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::DescribeStackEvents, Aws::Client::RejectedCallOutcome<DescribeStackEventsOutcome>(), this, request);
+}
+
+DescribeStackEventsOutcomeCallable CloudFormationClient::DescribeStackEventsCallable(DescribeStackEventsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::DescribeStackEvents, Aws::Client::RejectedCallOutcome<DescribeStackEventsOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::DescribeStackEventsAsync(const DescribeStackEventsRequest& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeStackEventsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::DescribeStackEventsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStackEventsOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::DescribeStackEventsAsync(DescribeStackEventsRequest&& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::DescribeStackEventsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStackEventsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::DescribeStackEventsAsyncHelper(const DescribeStackEventsRequest& request, const DescribeStackEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -306,12 +366,22 @@ DescribeStackResourceOutcome CloudFormationClient::DescribeStackResource(const D
 
 DescribeStackResourceOutcomeCallable CloudFormationClient::DescribeStackResourceCallable(const DescribeStackResourceRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeStackResource, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::DescribeStackResource, Aws::Client::RejectedCallOutcome<DescribeStackResourceOutcome>(), this, request);
+}
+
+DescribeStackResourceOutcomeCallable CloudFormationClient::DescribeStackResourceCallable(DescribeStackResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::DescribeStackResource, Aws::Client::RejectedCallOutcome<DescribeStackResourceOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::DescribeStackResourceAsync(const DescribeStackResourceRequest& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeStackResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::DescribeStackResourceAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStackResourceOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::DescribeStackResourceAsync(DescribeStackResourceRequest&& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::DescribeStackResourceAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStackResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::DescribeStackResourceAsyncHelper(const DescribeStackResourceRequest& request, const DescribeStackResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -336,12 +406,22 @@ DescribeStackResourcesOutcome CloudFormationClient::DescribeStackResources(const
 
 DescribeStackResourcesOutcomeCallable CloudFormationClient::DescribeStackResourcesCallable(const DescribeStackResourcesRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeStackResources, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::DescribeStackResources, Aws::Client::RejectedCallOutcome<DescribeStackResourcesOutcome>(), this, request);
+}
+
+DescribeStackResourcesOutcomeCallable CloudFormationClient::DescribeStackResourcesCallable(DescribeStackResourcesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::DescribeStackResources, Aws::Client::RejectedCallOutcome<DescribeStackResourcesOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::DescribeStackResourcesAsync(const DescribeStackResourcesRequest& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeStackResourcesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::DescribeStackResourcesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStackResourcesOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::DescribeStackResourcesAsync(DescribeStackResourcesRequest&& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::DescribeStackResourcesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStackResourcesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::DescribeStackResourcesAsyncHelper(const DescribeStackResourcesRequest& request, const DescribeStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -366,12 +446,22 @@ DescribeStacksOutcome CloudFormationClient::DescribeStacks(const DescribeStacksR
 
 DescribeStacksOutcomeCallable CloudFormationClient::DescribeStacksCallable(const DescribeStacksRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::DescribeStacks, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::DescribeStacks, Aws::Client::RejectedCallOutcome<DescribeStacksOutcome>(), this, request);
+}
+
+DescribeStacksOutcomeCallable CloudFormationClient::DescribeStacksCallable(DescribeStacksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::DescribeStacks, Aws::Client::RejectedCallOutcome<DescribeStacksOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::DescribeStacksAsync(const DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::DescribeStacksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::DescribeStacksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStacksOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::DescribeStacksAsync(DescribeStacksRequest&& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::DescribeStacksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStacksOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::DescribeStacksAsyncHelper(const DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -396,12 +486,22 @@ EstimateTemplateCostOutcome CloudFormationClient::EstimateTemplateCost(const Est
 
 EstimateTemplateCostOutcomeCallable CloudFormationClient::EstimateTemplateCostCallable(const EstimateTemplateCostRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::EstimateTemplateCost, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::EstimateTemplateCost, Aws::Client::RejectedCallOutcome<EstimateTemplateCostOutcome>(), this, request);
+}
+
+EstimateTemplateCostOutcomeCallable CloudFormationClient::EstimateTemplateCostCallable(EstimateTemplateCostRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::EstimateTemplateCost, Aws::Client::RejectedCallOutcome<EstimateTemplateCostOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::EstimateTemplateCostAsync(const EstimateTemplateCostRequest& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::EstimateTemplateCostAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::EstimateTemplateCostAsyncHelper, Aws::Client::RejectedAsyncCall<EstimateTemplateCostOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::EstimateTemplateCostAsync(EstimateTemplateCostRequest&& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::EstimateTemplateCostAsyncHelper, Aws::Client::RejectedAsyncCall<EstimateTemplateCostOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::EstimateTemplateCostAsyncHelper(const EstimateTemplateCostRequest& request, const EstimateTemplateCostResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -426,12 +526,22 @@ GetStackPolicyOutcome CloudFormationClient::GetStackPolicy(const GetStackPolicyR
 
 GetStackPolicyOutcomeCallable CloudFormationClient::GetStackPolicyCallable(const GetStackPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::GetStackPolicy, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::GetStackPolicy, Aws::Client::RejectedCallOutcome<GetStackPolicyOutcome>(), this, request);
+}
+
+GetStackPolicyOutcomeCallable CloudFormationClient::GetStackPolicyCallable(GetStackPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::GetStackPolicy, Aws::Client::RejectedCallOutcome<GetStackPolicyOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::GetStackPolicyAsync(const GetStackPolicyRequest& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::GetStackPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::GetStackPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetStackPolicyOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::GetStackPolicyAsync(GetStackPolicyRequest&& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::GetStackPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetStackPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::GetStackPolicyAsyncHelper(const GetStackPolicyRequest& request, const GetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -456,12 +566,22 @@ GetTemplateOutcome CloudFormationClient::GetTemplate(const GetTemplateRequest& r
 
 GetTemplateOutcomeCallable CloudFormationClient::GetTemplateCallable(const GetTemplateRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::GetTemplate, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::GetTemplate, Aws::Client::RejectedCallOutcome<GetTemplateOutcome>(), this, request);
+}
+
+GetTemplateOutcomeCallable CloudFormationClient::GetTemplateCallable(GetTemplateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::GetTemplate, Aws::Client::RejectedCallOutcome<GetTemplateOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::GetTemplateAsync(const GetTemplateRequest& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::GetTemplateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::GetTemplateAsyncHelper, Aws::Client::RejectedAsyncCall<GetTemplateOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::GetTemplateAsync(GetTemplateRequest&& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::GetTemplateAsyncHelper, Aws::Client::RejectedAsyncCall<GetTemplateOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::GetTemplateAsyncHelper(const GetTemplateRequest& request, const GetTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -486,12 +606,22 @@ GetTemplateSummaryOutcome CloudFormationClient::GetTemplateSummary(const GetTemp
 
 GetTemplateSummaryOutcomeCallable CloudFormationClient::GetTemplateSummaryCallable(const GetTemplateSummaryRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::GetTemplateSummary, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::GetTemplateSummary, Aws::Client::RejectedCallOutcome<GetTemplateSummaryOutcome>(), this, request);
+}
+
+GetTemplateSummaryOutcomeCallable CloudFormationClient::GetTemplateSummaryCallable(GetTemplateSummaryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::GetTemplateSummary, Aws::Client::RejectedCallOutcome<GetTemplateSummaryOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::GetTemplateSummaryAsync(const GetTemplateSummaryRequest& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::GetTemplateSummaryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::GetTemplateSummaryAsyncHelper, Aws::Client::RejectedAsyncCall<GetTemplateSummaryOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::GetTemplateSummaryAsync(GetTemplateSummaryRequest&& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::GetTemplateSummaryAsyncHelper, Aws::Client::RejectedAsyncCall<GetTemplateSummaryOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::GetTemplateSummaryAsyncHelper(const GetTemplateSummaryRequest& request, const GetTemplateSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -516,12 +646,22 @@ ListStackResourcesOutcome CloudFormationClient::ListStackResources(const ListSta
 
 ListStackResourcesOutcomeCallable CloudFormationClient::ListStackResourcesCallable(const ListStackResourcesRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::ListStackResources, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::ListStackResources, Aws::Client::RejectedCallOutcome<ListStackResourcesOutcome>(), this, request);
+}
+
+ListStackResourcesOutcomeCallable CloudFormationClient::ListStackResourcesCallable(ListStackResourcesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::ListStackResources, Aws::Client::RejectedCallOutcome<ListStackResourcesOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::ListStackResourcesAsync(const ListStackResourcesRequest& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::ListStackResourcesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::ListStackResourcesAsyncHelper, Aws::Client::RejectedAsyncCall<ListStackResourcesOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::ListStackResourcesAsync(ListStackResourcesRequest&& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::ListStackResourcesAsyncHelper, Aws::Client::RejectedAsyncCall<ListStackResourcesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::ListStackResourcesAsyncHelper(const ListStackResourcesRequest& request, const ListStackResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -546,12 +686,22 @@ ListStacksOutcome CloudFormationClient::ListStacks(const ListStacksRequest& requ
 
 ListStacksOutcomeCallable CloudFormationClient::ListStacksCallable(const ListStacksRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::ListStacks, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::ListStacks, Aws::Client::RejectedCallOutcome<ListStacksOutcome>(), this, request);
+}
+
+ListStacksOutcomeCallable CloudFormationClient::ListStacksCallable(ListStacksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::ListStacks, Aws::Client::RejectedCallOutcome<ListStacksOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::ListStacksAsync(const ListStacksRequest& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::ListStacksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::ListStacksAsyncHelper, Aws::Client::RejectedAsyncCall<ListStacksOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::ListStacksAsync(ListStacksRequest&& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::ListStacksAsyncHelper, Aws::Client::RejectedAsyncCall<ListStacksOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::ListStacksAsyncHelper(const ListStacksRequest& request, const ListStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -576,12 +726,22 @@ SetStackPolicyOutcome CloudFormationClient::SetStackPolicy(const SetStackPolicyR
 
 SetStackPolicyOutcomeCallable CloudFormationClient::SetStackPolicyCallable(const SetStackPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::SetStackPolicy, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::SetStackPolicy, Aws::Client::RejectedCallOutcome<SetStackPolicyOutcome>(), this, request);
+}
+
+SetStackPolicyOutcomeCallable CloudFormationClient::SetStackPolicyCallable(SetStackPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::SetStackPolicy, Aws::Client::RejectedCallOutcome<SetStackPolicyOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::SetStackPolicyAsync(const SetStackPolicyRequest& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::SetStackPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::SetStackPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<SetStackPolicyOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::SetStackPolicyAsync(SetStackPolicyRequest&& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::SetStackPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<SetStackPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::SetStackPolicyAsyncHelper(const SetStackPolicyRequest& request, const SetStackPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -606,12 +766,22 @@ SignalResourceOutcome CloudFormationClient::SignalResource(const SignalResourceR
 
 SignalResourceOutcomeCallable CloudFormationClient::SignalResourceCallable(const SignalResourceRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::SignalResource, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::SignalResource, Aws::Client::RejectedCallOutcome<SignalResourceOutcome>(), this, request);
+}
+
+SignalResourceOutcomeCallable CloudFormationClient::SignalResourceCallable(SignalResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::SignalResource, Aws::Client::RejectedCallOutcome<SignalResourceOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::SignalResourceAsync(const SignalResourceRequest& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::SignalResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::SignalResourceAsyncHelper, Aws::Client::RejectedAsyncCall<SignalResourceOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::SignalResourceAsync(SignalResourceRequest&& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::SignalResourceAsyncHelper, Aws::Client::RejectedAsyncCall<SignalResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::SignalResourceAsyncHelper(const SignalResourceRequest& request, const SignalResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -636,12 +806,22 @@ UpdateStackOutcome CloudFormationClient::UpdateStack(const UpdateStackRequest& r
 
 UpdateStackOutcomeCallable CloudFormationClient::UpdateStackCallable(const UpdateStackRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::UpdateStack, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::UpdateStack, Aws::Client::RejectedCallOutcome<UpdateStackOutcome>(), this, request);
+}
+
+UpdateStackOutcomeCallable CloudFormationClient::UpdateStackCallable(UpdateStackRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::UpdateStack, Aws::Client::RejectedCallOutcome<UpdateStackOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::UpdateStackAsync(const UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::UpdateStackAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::UpdateStackAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateStackOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::UpdateStackAsync(UpdateStackRequest&& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::UpdateStackAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateStackOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::UpdateStackAsyncHelper(const UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -666,12 +846,22 @@ ValidateTemplateOutcome CloudFormationClient::ValidateTemplate(const ValidateTem
 
 ValidateTemplateOutcomeCallable CloudFormationClient::ValidateTemplateCallable(const ValidateTemplateRequest& request) const
 {
-  return std::async(std::launch::async, &CloudFormationClient::ValidateTemplate, this, request);
+  return m_executor->SubmitWithFuture(&CloudFormationClient::ValidateTemplate, Aws::Client::RejectedCallOutcome<ValidateTemplateOutcome>(), this, request);
+}
+
+ValidateTemplateOutcomeCallable CloudFormationClient::ValidateTemplateCallable(ValidateTemplateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFormationClient::ValidateTemplate, Aws::Client::RejectedCallOutcome<ValidateTemplateOutcome>(), this, std::move(request));
 }
 
 void CloudFormationClient::ValidateTemplateAsync(const ValidateTemplateRequest& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFormationClient::ValidateTemplateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFormationClient::ValidateTemplateAsyncHelper, Aws::Client::RejectedAsyncCall<ValidateTemplateOutcome>(), this, request, handler, context);
+}
+
+void CloudFormationClient::ValidateTemplateAsync(ValidateTemplateRequest&& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFormationClient::ValidateTemplateAsyncHelper, Aws::Client::RejectedAsyncCall<ValidateTemplateOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFormationClient::ValidateTemplateAsyncHelper(const ValidateTemplateRequest& request, const ValidateTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
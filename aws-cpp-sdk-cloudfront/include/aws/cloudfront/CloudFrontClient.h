@@ -42,6 +42,32 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/cloudfront/model/CreateCloudFrontOriginAccessIdentity2016_01_28Request.h>
+#include <aws/cloudfront/model/CreateDistribution2016_01_28Request.h>
+#include <aws/cloudfront/model/CreateInvalidation2016_01_28Request.h>
+#include <aws/cloudfront/model/CreateStreamingDistribution2016_01_28Request.h>
+#include <aws/cloudfront/model/DeleteCloudFrontOriginAccessIdentity2016_01_28Request.h>
+#include <aws/cloudfront/model/DeleteDistribution2016_01_28Request.h>
+#include <aws/cloudfront/model/DeleteStreamingDistribution2016_01_28Request.h>
+#include <aws/cloudfront/model/GetCloudFrontOriginAccessIdentity2016_01_28Request.h>
+#include <aws/cloudfront/model/GetCloudFrontOriginAccessIdentityConfig2016_01_28Request.h>
+#include <aws/cloudfront/model/GetDistribution2016_01_28Request.h>
+#include <aws/cloudfront/model/GetDistributionConfig2016_01_28Request.h>
+#include <aws/cloudfront/model/GetInvalidation2016_01_28Request.h>
+#include <aws/cloudfront/model/GetStreamingDistribution2016_01_28Request.h>
+#include <aws/cloudfront/model/GetStreamingDistributionConfig2016_01_28Request.h>
+#include <aws/cloudfront/model/ListCloudFrontOriginAccessIdentities2016_01_28Request.h>
+#include <aws/cloudfront/model/ListDistributions2016_01_28Request.h>
+#include <aws/cloudfront/model/ListDistributionsByWebACLId2016_01_28Request.h>
+#include <aws/cloudfront/model/ListInvalidations2016_01_28Request.h>
+#include <aws/cloudfront/model/ListStreamingDistributions2016_01_28Request.h>
+#include <aws/cloudfront/model/UpdateCloudFrontOriginAccessIdentity2016_01_28Request.h>
+#include <aws/cloudfront/model/UpdateDistribution2016_01_28Request.h>
+#include <aws/cloudfront/model/UpdateStreamingDistribution2016_01_28Request.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -219,6 +245,11 @@ namespace Model
          */
         virtual Model::CreateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CreateCloudFrontOriginAccessIdentity2016_01_28Callable(const Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request& request) const;
 
+        /**
+         * Same as CreateCloudFrontOriginAccessIdentity2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CreateCloudFrontOriginAccessIdentity2016_01_28Callable(Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request&& request) const;
+
         /**
          * Create a new origin access identity.
          *
@@ -226,6 +257,11 @@ namespace Model
          */
         virtual void CreateCloudFrontOriginAccessIdentity2016_01_28Async(const Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCloudFrontOriginAccessIdentity2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateCloudFrontOriginAccessIdentity2016_01_28Async(Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request&& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Create a new distribution.
          */
@@ -238,6 +274,11 @@ namespace Model
          */
         virtual Model::CreateDistribution2016_01_28OutcomeCallable CreateDistribution2016_01_28Callable(const Model::CreateDistribution2016_01_28Request& request) const;
 
+        /**
+         * Same as CreateDistribution2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDistribution2016_01_28OutcomeCallable CreateDistribution2016_01_28Callable(Model::CreateDistribution2016_01_28Request&& request) const;
+
         /**
          * Create a new distribution.
          *
@@ -245,6 +286,11 @@ namespace Model
          */
         virtual void CreateDistribution2016_01_28Async(const Model::CreateDistribution2016_01_28Request& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDistribution2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDistribution2016_01_28Async(Model::CreateDistribution2016_01_28Request&& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Create a new invalidation.
          */
@@ -257,6 +303,11 @@ namespace Model
          */
         virtual Model::CreateInvalidation2016_01_28OutcomeCallable CreateInvalidation2016_01_28Callable(const Model::CreateInvalidation2016_01_28Request& request) const;
 
+        /**
+         * Same as CreateInvalidation2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateInvalidation2016_01_28OutcomeCallable CreateInvalidation2016_01_28Callable(Model::CreateInvalidation2016_01_28Request&& request) const;
+
         /**
          * Create a new invalidation.
          *
@@ -264,6 +315,11 @@ namespace Model
          */
         virtual void CreateInvalidation2016_01_28Async(const Model::CreateInvalidation2016_01_28Request& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateInvalidation2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateInvalidation2016_01_28Async(Model::CreateInvalidation2016_01_28Request&& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Create a new streaming distribution.
          */
@@ -276,6 +332,11 @@ namespace Model
          */
         virtual Model::CreateStreamingDistribution2016_01_28OutcomeCallable CreateStreamingDistribution2016_01_28Callable(const Model::CreateStreamingDistribution2016_01_28Request& request) const;
 
+        /**
+         * Same as CreateStreamingDistribution2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateStreamingDistribution2016_01_28OutcomeCallable CreateStreamingDistribution2016_01_28Callable(Model::CreateStreamingDistribution2016_01_28Request&& request) const;
+
         /**
          * Create a new streaming distribution.
          *
@@ -283,6 +344,11 @@ namespace Model
          */
         virtual void CreateStreamingDistribution2016_01_28Async(const Model::CreateStreamingDistribution2016_01_28Request& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateStreamingDistribution2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateStreamingDistribution2016_01_28Async(Model::CreateStreamingDistribution2016_01_28Request&& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Delete an origin access identity.
          */
@@ -295,6 +361,11 @@ namespace Model
          */
         virtual Model::DeleteCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable DeleteCloudFrontOriginAccessIdentity2016_01_28Callable(const Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request) const;
 
+        /**
+         * Same as DeleteCloudFrontOriginAccessIdentity2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable DeleteCloudFrontOriginAccessIdentity2016_01_28Callable(Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request&& request) const;
+
         /**
          * Delete an origin access identity.
          *
@@ -302,6 +373,11 @@ namespace Model
          */
         virtual void DeleteCloudFrontOriginAccessIdentity2016_01_28Async(const Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCloudFrontOriginAccessIdentity2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteCloudFrontOriginAccessIdentity2016_01_28Async(Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request&& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Delete a distribution.
          */
@@ -314,6 +390,11 @@ namespace Model
          */
         virtual Model::DeleteDistribution2016_01_28OutcomeCallable DeleteDistribution2016_01_28Callable(const Model::DeleteDistribution2016_01_28Request& request) const;
 
+        /**
+         * Same as DeleteDistribution2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDistribution2016_01_28OutcomeCallable DeleteDistribution2016_01_28Callable(Model::DeleteDistribution2016_01_28Request&& request) const;
+
         /**
          * Delete a distribution.
          *
@@ -321,6 +402,11 @@ namespace Model
          */
         virtual void DeleteDistribution2016_01_28Async(const Model::DeleteDistribution2016_01_28Request& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDistribution2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDistribution2016_01_28Async(Model::DeleteDistribution2016_01_28Request&& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Delete a streaming distribution.
          */
@@ -333,6 +419,11 @@ namespace Model
          */
         virtual Model::DeleteStreamingDistribution2016_01_28OutcomeCallable DeleteStreamingDistribution2016_01_28Callable(const Model::DeleteStreamingDistribution2016_01_28Request& request) const;
 
+        /**
+         * Same as DeleteStreamingDistribution2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteStreamingDistribution2016_01_28OutcomeCallable DeleteStreamingDistribution2016_01_28Callable(Model::DeleteStreamingDistribution2016_01_28Request&& request) const;
+
         /**
          * Delete a streaming distribution.
          *
@@ -340,6 +431,11 @@ namespace Model
          */
         virtual void DeleteStreamingDistribution2016_01_28Async(const Model::DeleteStreamingDistribution2016_01_28Request& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteStreamingDistribution2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteStreamingDistribution2016_01_28Async(Model::DeleteStreamingDistribution2016_01_28Request&& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Get the information about an origin access identity.
          */
@@ -352,6 +448,11 @@ namespace Model
          */
         virtual Model::GetCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable GetCloudFrontOriginAccessIdentity2016_01_28Callable(const Model::GetCloudFrontOriginAccessIdentity2016_01_28Request& request) const;
 
+        /**
+         * Same as GetCloudFrontOriginAccessIdentity2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable GetCloudFrontOriginAccessIdentity2016_01_28Callable(Model::GetCloudFrontOriginAccessIdentity2016_01_28Request&& request) const;
+
         /**
          * Get the information about an origin access identity.
          *
@@ -359,6 +460,11 @@ namespace Model
          */
         virtual void GetCloudFrontOriginAccessIdentity2016_01_28Async(const Model::GetCloudFrontOriginAccessIdentity2016_01_28Request& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCloudFrontOriginAccessIdentity2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetCloudFrontOriginAccessIdentity2016_01_28Async(Model::GetCloudFrontOriginAccessIdentity2016_01_28Request&& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Get the configuration information about an origin access identity.
          */
@@ -371,6 +477,11 @@ namespace Model
          */
         virtual Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28OutcomeCallable GetCloudFrontOriginAccessIdentityConfig2016_01_28Callable(const Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request) const;
 
+        /**
+         * Same as GetCloudFrontOriginAccessIdentityConfig2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28OutcomeCallable GetCloudFrontOriginAccessIdentityConfig2016_01_28Callable(Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request&& request) const;
+
         /**
          * Get the configuration information about an origin access identity.
          *
@@ -378,6 +489,11 @@ namespace Model
          */
         virtual void GetCloudFrontOriginAccessIdentityConfig2016_01_28Async(const Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCloudFrontOriginAccessIdentityConfig2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetCloudFrontOriginAccessIdentityConfig2016_01_28Async(Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request&& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Get the information about a distribution.
          */
@@ -390,6 +506,11 @@ namespace Model
          */
         virtual Model::GetDistribution2016_01_28OutcomeCallable GetDistribution2016_01_28Callable(const Model::GetDistribution2016_01_28Request& request) const;
 
+        /**
+         * Same as GetDistribution2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDistribution2016_01_28OutcomeCallable GetDistribution2016_01_28Callable(Model::GetDistribution2016_01_28Request&& request) const;
+
         /**
          * Get the information about a distribution.
          *
@@ -397,6 +518,11 @@ namespace Model
          */
         virtual void GetDistribution2016_01_28Async(const Model::GetDistribution2016_01_28Request& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDistribution2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDistribution2016_01_28Async(Model::GetDistribution2016_01_28Request&& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Get the configuration information about a distribution.
          */
@@ -409,6 +535,11 @@ namespace Model
          */
         virtual Model::GetDistributionConfig2016_01_28OutcomeCallable GetDistributionConfig2016_01_28Callable(const Model::GetDistributionConfig2016_01_28Request& request) const;
 
+        /**
+         * Same as GetDistributionConfig2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDistributionConfig2016_01_28OutcomeCallable GetDistributionConfig2016_01_28Callable(Model::GetDistributionConfig2016_01_28Request&& request) const;
+
         /**
          * Get the configuration information about a distribution.
          *
@@ -416,6 +547,11 @@ namespace Model
          */
         virtual void GetDistributionConfig2016_01_28Async(const Model::GetDistributionConfig2016_01_28Request& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDistributionConfig2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDistributionConfig2016_01_28Async(Model::GetDistributionConfig2016_01_28Request&& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Get the information about an invalidation.
          */
@@ -428,6 +564,11 @@ namespace Model
          */
         virtual Model::GetInvalidation2016_01_28OutcomeCallable GetInvalidation2016_01_28Callable(const Model::GetInvalidation2016_01_28Request& request) const;
 
+        /**
+         * Same as GetInvalidation2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetInvalidation2016_01_28OutcomeCallable GetInvalidation2016_01_28Callable(Model::GetInvalidation2016_01_28Request&& request) const;
+
         /**
          * Get the information about an invalidation.
          *
@@ -435,6 +576,11 @@ namespace Model
          */
         virtual void GetInvalidation2016_01_28Async(const Model::GetInvalidation2016_01_28Request& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetInvalidation2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetInvalidation2016_01_28Async(Model::GetInvalidation2016_01_28Request&& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Get the information about a streaming distribution.
          */
@@ -447,6 +593,11 @@ namespace Model
          */
         virtual Model::GetStreamingDistribution2016_01_28OutcomeCallable GetStreamingDistribution2016_01_28Callable(const Model::GetStreamingDistribution2016_01_28Request& request) const;
 
+        /**
+         * Same as GetStreamingDistribution2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetStreamingDistribution2016_01_28OutcomeCallable GetStreamingDistribution2016_01_28Callable(Model::GetStreamingDistribution2016_01_28Request&& request) const;
+
         /**
          * Get the information about a streaming distribution.
          *
@@ -454,6 +605,11 @@ namespace Model
          */
         virtual void GetStreamingDistribution2016_01_28Async(const Model::GetStreamingDistribution2016_01_28Request& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetStreamingDistribution2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetStreamingDistribution2016_01_28Async(Model::GetStreamingDistribution2016_01_28Request&& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Get the configuration information about a streaming distribution.
          */
@@ -466,6 +622,11 @@ namespace Model
          */
         virtual Model::GetStreamingDistributionConfig2016_01_28OutcomeCallable GetStreamingDistributionConfig2016_01_28Callable(const Model::GetStreamingDistributionConfig2016_01_28Request& request) const;
 
+        /**
+         * Same as GetStreamingDistributionConfig2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetStreamingDistributionConfig2016_01_28OutcomeCallable GetStreamingDistributionConfig2016_01_28Callable(Model::GetStreamingDistributionConfig2016_01_28Request&& request) const;
+
         /**
          * Get the configuration information about a streaming distribution.
          *
@@ -473,6 +634,11 @@ namespace Model
          */
         virtual void GetStreamingDistributionConfig2016_01_28Async(const Model::GetStreamingDistributionConfig2016_01_28Request& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetStreamingDistributionConfig2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetStreamingDistributionConfig2016_01_28Async(Model::GetStreamingDistributionConfig2016_01_28Request&& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * List origin access identities.
          */
@@ -485,6 +651,11 @@ namespace Model
          */
         virtual Model::ListCloudFrontOriginAccessIdentities2016_01_28OutcomeCallable ListCloudFrontOriginAccessIdentities2016_01_28Callable(const Model::ListCloudFrontOriginAccessIdentities2016_01_28Request& request) const;
 
+        /**
+         * Same as ListCloudFrontOriginAccessIdentities2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListCloudFrontOriginAccessIdentities2016_01_28OutcomeCallable ListCloudFrontOriginAccessIdentities2016_01_28Callable(Model::ListCloudFrontOriginAccessIdentities2016_01_28Request&& request) const;
+
         /**
          * List origin access identities.
          *
@@ -492,6 +663,11 @@ namespace Model
          */
         virtual void ListCloudFrontOriginAccessIdentities2016_01_28Async(const Model::ListCloudFrontOriginAccessIdentities2016_01_28Request& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListCloudFrontOriginAccessIdentities2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListCloudFrontOriginAccessIdentities2016_01_28Async(Model::ListCloudFrontOriginAccessIdentities2016_01_28Request&& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * List distributions.
          */
@@ -504,6 +680,11 @@ namespace Model
          */
         virtual Model::ListDistributions2016_01_28OutcomeCallable ListDistributions2016_01_28Callable(const Model::ListDistributions2016_01_28Request& request) const;
 
+        /**
+         * Same as ListDistributions2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDistributions2016_01_28OutcomeCallable ListDistributions2016_01_28Callable(Model::ListDistributions2016_01_28Request&& request) const;
+
         /**
          * List distributions.
          *
@@ -511,6 +692,11 @@ namespace Model
          */
         virtual void ListDistributions2016_01_28Async(const Model::ListDistributions2016_01_28Request& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDistributions2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDistributions2016_01_28Async(Model::ListDistributions2016_01_28Request&& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * List the distributions that are associated with a specified AWS WAF web ACL.
          */
@@ -523,6 +709,11 @@ namespace Model
          */
         virtual Model::ListDistributionsByWebACLId2016_01_28OutcomeCallable ListDistributionsByWebACLId2016_01_28Callable(const Model::ListDistributionsByWebACLId2016_01_28Request& request) const;
 
+        /**
+         * Same as ListDistributionsByWebACLId2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDistributionsByWebACLId2016_01_28OutcomeCallable ListDistributionsByWebACLId2016_01_28Callable(Model::ListDistributionsByWebACLId2016_01_28Request&& request) const;
+
         /**
          * List the distributions that are associated with a specified AWS WAF web ACL.
          *
@@ -530,6 +721,11 @@ namespace Model
          */
         virtual void ListDistributionsByWebACLId2016_01_28Async(const Model::ListDistributionsByWebACLId2016_01_28Request& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDistributionsByWebACLId2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDistributionsByWebACLId2016_01_28Async(Model::ListDistributionsByWebACLId2016_01_28Request&& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * List invalidation batches.
          */
@@ -542,6 +738,11 @@ namespace Model
          */
         virtual Model::ListInvalidations2016_01_28OutcomeCallable ListInvalidations2016_01_28Callable(const Model::ListInvalidations2016_01_28Request& request) const;
 
+        /**
+         * Same as ListInvalidations2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListInvalidations2016_01_28OutcomeCallable ListInvalidations2016_01_28Callable(Model::ListInvalidations2016_01_28Request&& request) const;
+
         /**
          * List invalidation batches.
          *
@@ -549,6 +750,11 @@ namespace Model
          */
         virtual void ListInvalidations2016_01_28Async(const Model::ListInvalidations2016_01_28Request& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListInvalidations2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListInvalidations2016_01_28Async(Model::ListInvalidations2016_01_28Request&& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * List streaming distributions.
          */
@@ -561,6 +767,11 @@ namespace Model
          */
         virtual Model::ListStreamingDistributions2016_01_28OutcomeCallable ListStreamingDistributions2016_01_28Callable(const Model::ListStreamingDistributions2016_01_28Request& request) const;
 
+        /**
+         * Same as ListStreamingDistributions2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListStreamingDistributions2016_01_28OutcomeCallable ListStreamingDistributions2016_01_28Callable(Model::ListStreamingDistributions2016_01_28Request&& request) const;
+
         /**
          * List streaming distributions.
          *
@@ -568,6 +779,11 @@ namespace Model
          */
         virtual void ListStreamingDistributions2016_01_28Async(const Model::ListStreamingDistributions2016_01_28Request& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListStreamingDistributions2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListStreamingDistributions2016_01_28Async(Model::ListStreamingDistributions2016_01_28Request&& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Update an origin access identity.
          */
@@ -580,6 +796,11 @@ namespace Model
          */
         virtual Model::UpdateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable UpdateCloudFrontOriginAccessIdentity2016_01_28Callable(const Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request) const;
 
+        /**
+         * Same as UpdateCloudFrontOriginAccessIdentity2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable UpdateCloudFrontOriginAccessIdentity2016_01_28Callable(Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request&& request) const;
+
         /**
          * Update an origin access identity.
          *
@@ -587,6 +808,11 @@ namespace Model
          */
         virtual void UpdateCloudFrontOriginAccessIdentity2016_01_28Async(const Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateCloudFrontOriginAccessIdentity2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateCloudFrontOriginAccessIdentity2016_01_28Async(Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request&& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Update a distribution.
          */
@@ -599,6 +825,11 @@ namespace Model
          */
         virtual Model::UpdateDistribution2016_01_28OutcomeCallable UpdateDistribution2016_01_28Callable(const Model::UpdateDistribution2016_01_28Request& request) const;
 
+        /**
+         * Same as UpdateDistribution2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateDistribution2016_01_28OutcomeCallable UpdateDistribution2016_01_28Callable(Model::UpdateDistribution2016_01_28Request&& request) const;
+
         /**
          * Update a distribution.
          *
@@ -606,6 +837,11 @@ namespace Model
          */
         virtual void UpdateDistribution2016_01_28Async(const Model::UpdateDistribution2016_01_28Request& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDistribution2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateDistribution2016_01_28Async(Model::UpdateDistribution2016_01_28Request&& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Update a streaming distribution.
          */
@@ -618,6 +854,11 @@ namespace Model
          */
         virtual Model::UpdateStreamingDistribution2016_01_28OutcomeCallable UpdateStreamingDistribution2016_01_28Callable(const Model::UpdateStreamingDistribution2016_01_28Request& request) const;
 
+        /**
+         * Same as UpdateStreamingDistribution2016_01_28Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateStreamingDistribution2016_01_28OutcomeCallable UpdateStreamingDistribution2016_01_28Callable(Model::UpdateStreamingDistribution2016_01_28Request&& request) const;
+
         /**
          * Update a streaming distribution.
          *
@@ -625,6 +866,62 @@ namespace Model
          */
         virtual void UpdateStreamingDistribution2016_01_28Async(const Model::UpdateStreamingDistribution2016_01_28Request& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateStreamingDistribution2016_01_28Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateStreamingDistribution2016_01_28Async(Model::UpdateStreamingDistribution2016_01_28Request&& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCloudFrontOriginAccessIdentity2016_01_28Outcome> CreateCloudFrontOriginAccessIdentity2016_01_28Awaitable(const Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCloudFrontOriginAccessIdentity2016_01_28Outcome> CreateCloudFrontOriginAccessIdentity2016_01_28Awaitable(Model::CreateCloudFrontOriginAccessIdentity2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDistribution2016_01_28Outcome> CreateDistribution2016_01_28Awaitable(const Model::CreateDistribution2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::CreateDistribution2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDistribution2016_01_28Outcome> CreateDistribution2016_01_28Awaitable(Model::CreateDistribution2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::CreateDistribution2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateInvalidation2016_01_28Outcome> CreateInvalidation2016_01_28Awaitable(const Model::CreateInvalidation2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::CreateInvalidation2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateInvalidation2016_01_28Outcome> CreateInvalidation2016_01_28Awaitable(Model::CreateInvalidation2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::CreateInvalidation2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateStreamingDistribution2016_01_28Outcome> CreateStreamingDistribution2016_01_28Awaitable(const Model::CreateStreamingDistribution2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::CreateStreamingDistribution2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateStreamingDistribution2016_01_28Outcome> CreateStreamingDistribution2016_01_28Awaitable(Model::CreateStreamingDistribution2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::CreateStreamingDistribution2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome> DeleteCloudFrontOriginAccessIdentity2016_01_28Awaitable(const Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome> DeleteCloudFrontOriginAccessIdentity2016_01_28Awaitable(Model::DeleteCloudFrontOriginAccessIdentity2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDistribution2016_01_28Outcome> DeleteDistribution2016_01_28Awaitable(const Model::DeleteDistribution2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::DeleteDistribution2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDistribution2016_01_28Outcome> DeleteDistribution2016_01_28Awaitable(Model::DeleteDistribution2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::DeleteDistribution2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteStreamingDistribution2016_01_28Outcome> DeleteStreamingDistribution2016_01_28Awaitable(const Model::DeleteStreamingDistribution2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::DeleteStreamingDistribution2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteStreamingDistribution2016_01_28Outcome> DeleteStreamingDistribution2016_01_28Awaitable(Model::DeleteStreamingDistribution2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::DeleteStreamingDistribution2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCloudFrontOriginAccessIdentity2016_01_28Outcome> GetCloudFrontOriginAccessIdentity2016_01_28Awaitable(const Model::GetCloudFrontOriginAccessIdentity2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCloudFrontOriginAccessIdentity2016_01_28Outcome> GetCloudFrontOriginAccessIdentity2016_01_28Awaitable(Model::GetCloudFrontOriginAccessIdentity2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome> GetCloudFrontOriginAccessIdentityConfig2016_01_28Awaitable(const Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome> GetCloudFrontOriginAccessIdentityConfig2016_01_28Awaitable(Model::GetCloudFrontOriginAccessIdentityConfig2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDistribution2016_01_28Outcome> GetDistribution2016_01_28Awaitable(const Model::GetDistribution2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::GetDistribution2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDistribution2016_01_28Outcome> GetDistribution2016_01_28Awaitable(Model::GetDistribution2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::GetDistribution2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDistributionConfig2016_01_28Outcome> GetDistributionConfig2016_01_28Awaitable(const Model::GetDistributionConfig2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::GetDistributionConfig2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDistributionConfig2016_01_28Outcome> GetDistributionConfig2016_01_28Awaitable(Model::GetDistributionConfig2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::GetDistributionConfig2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetInvalidation2016_01_28Outcome> GetInvalidation2016_01_28Awaitable(const Model::GetInvalidation2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::GetInvalidation2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetInvalidation2016_01_28Outcome> GetInvalidation2016_01_28Awaitable(Model::GetInvalidation2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::GetInvalidation2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetStreamingDistribution2016_01_28Outcome> GetStreamingDistribution2016_01_28Awaitable(const Model::GetStreamingDistribution2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::GetStreamingDistribution2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetStreamingDistribution2016_01_28Outcome> GetStreamingDistribution2016_01_28Awaitable(Model::GetStreamingDistribution2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::GetStreamingDistribution2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetStreamingDistributionConfig2016_01_28Outcome> GetStreamingDistributionConfig2016_01_28Awaitable(const Model::GetStreamingDistributionConfig2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::GetStreamingDistributionConfig2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetStreamingDistributionConfig2016_01_28Outcome> GetStreamingDistributionConfig2016_01_28Awaitable(Model::GetStreamingDistributionConfig2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::GetStreamingDistributionConfig2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListCloudFrontOriginAccessIdentities2016_01_28Outcome> ListCloudFrontOriginAccessIdentities2016_01_28Awaitable(const Model::ListCloudFrontOriginAccessIdentities2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListCloudFrontOriginAccessIdentities2016_01_28Outcome> ListCloudFrontOriginAccessIdentities2016_01_28Awaitable(Model::ListCloudFrontOriginAccessIdentities2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDistributions2016_01_28Outcome> ListDistributions2016_01_28Awaitable(const Model::ListDistributions2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::ListDistributions2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDistributions2016_01_28Outcome> ListDistributions2016_01_28Awaitable(Model::ListDistributions2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::ListDistributions2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDistributionsByWebACLId2016_01_28Outcome> ListDistributionsByWebACLId2016_01_28Awaitable(const Model::ListDistributionsByWebACLId2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::ListDistributionsByWebACLId2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDistributionsByWebACLId2016_01_28Outcome> ListDistributionsByWebACLId2016_01_28Awaitable(Model::ListDistributionsByWebACLId2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::ListDistributionsByWebACLId2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListInvalidations2016_01_28Outcome> ListInvalidations2016_01_28Awaitable(const Model::ListInvalidations2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::ListInvalidations2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListInvalidations2016_01_28Outcome> ListInvalidations2016_01_28Awaitable(Model::ListInvalidations2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::ListInvalidations2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListStreamingDistributions2016_01_28Outcome> ListStreamingDistributions2016_01_28Awaitable(const Model::ListStreamingDistributions2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::ListStreamingDistributions2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListStreamingDistributions2016_01_28Outcome> ListStreamingDistributions2016_01_28Awaitable(Model::ListStreamingDistributions2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::ListStreamingDistributions2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome> UpdateCloudFrontOriginAccessIdentity2016_01_28Awaitable(const Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome> UpdateCloudFrontOriginAccessIdentity2016_01_28Awaitable(Model::UpdateCloudFrontOriginAccessIdentity2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDistribution2016_01_28Outcome> UpdateDistribution2016_01_28Awaitable(const Model::UpdateDistribution2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::UpdateDistribution2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDistribution2016_01_28Outcome> UpdateDistribution2016_01_28Awaitable(Model::UpdateDistribution2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::UpdateDistribution2016_01_28, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateStreamingDistribution2016_01_28Outcome> UpdateStreamingDistribution2016_01_28Awaitable(const Model::UpdateStreamingDistribution2016_01_28Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::UpdateStreamingDistribution2016_01_28, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateStreamingDistribution2016_01_28Outcome> UpdateStreamingDistribution2016_01_28Awaitable(Model::UpdateStreamingDistribution2016_01_28Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudFrontClient::UpdateStreamingDistribution2016_01_28, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
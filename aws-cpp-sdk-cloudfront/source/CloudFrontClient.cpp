@@ -22,6 +22,7 @@
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/StringBuilder.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/cloudfront/CloudFrontClient.h>
 #include <aws/cloudfront/CloudFrontEndpoint.h>
@@ -114,9 +115,9 @@ void CloudFrontClient::init(const ClientConfiguration& config)
 }
 CreateCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28(const CreateCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/origin-access-identity/cloudfront");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return CreateCloudFrontOriginAccessIdentity2016_01_28Outcome(CreateCloudFrontOriginAccessIdentity2016_01_28Result(outcome.GetResult()));
@@ -129,12 +130,22 @@ CreateCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::CreateCl
 
 CreateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28Callable(const CreateCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28, Aws::Client::RejectedCallOutcome<CreateCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, request);
+}
+
+CreateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28Callable(CreateCloudFrontOriginAccessIdentity2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28, Aws::Client::RejectedCallOutcome<CreateCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28Async(const CreateCloudFrontOriginAccessIdentity2016_01_28Request& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<CreateCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28Async(CreateCloudFrontOriginAccessIdentity2016_01_28Request&& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<CreateCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const CreateCloudFrontOriginAccessIdentity2016_01_28Request& request, const CreateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -144,9 +155,9 @@ void CloudFrontClient::CreateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper
 
 CreateDistribution2016_01_28Outcome CloudFrontClient::CreateDistribution2016_01_28(const CreateDistribution2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/distribution";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/distribution");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return CreateDistribution2016_01_28Outcome(CreateDistribution2016_01_28Result(outcome.GetResult()));
@@ -159,12 +170,22 @@ CreateDistribution2016_01_28Outcome CloudFrontClient::CreateDistribution2016_01_
 
 CreateDistribution2016_01_28OutcomeCallable CloudFrontClient::CreateDistribution2016_01_28Callable(const CreateDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::CreateDistribution2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::CreateDistribution2016_01_28, Aws::Client::RejectedCallOutcome<CreateDistribution2016_01_28Outcome>(), this, request);
+}
+
+CreateDistribution2016_01_28OutcomeCallable CloudFrontClient::CreateDistribution2016_01_28Callable(CreateDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::CreateDistribution2016_01_28, Aws::Client::RejectedCallOutcome<CreateDistribution2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::CreateDistribution2016_01_28Async(const CreateDistribution2016_01_28Request& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::CreateDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::CreateDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<CreateDistribution2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::CreateDistribution2016_01_28Async(CreateDistribution2016_01_28Request&& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::CreateDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<CreateDistribution2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::CreateDistribution2016_01_28AsyncHelper(const CreateDistribution2016_01_28Request& request, const CreateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -174,11 +195,11 @@ void CloudFrontClient::CreateDistribution2016_01_28AsyncHelper(const CreateDistr
 
 CreateInvalidation2016_01_28Outcome CloudFrontClient::CreateInvalidation2016_01_28(const CreateInvalidation2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/distribution/";
-  ss << request.GetDistributionId();
-  ss << "/invalidation";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/distribution/");
+  uri.Append(request.GetDistributionId());
+  uri.Append("/invalidation");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return CreateInvalidation2016_01_28Outcome(CreateInvalidation2016_01_28Result(outcome.GetResult()));
@@ -191,12 +212,22 @@ CreateInvalidation2016_01_28Outcome CloudFrontClient::CreateInvalidation2016_01_
 
 CreateInvalidation2016_01_28OutcomeCallable CloudFrontClient::CreateInvalidation2016_01_28Callable(const CreateInvalidation2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::CreateInvalidation2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::CreateInvalidation2016_01_28, Aws::Client::RejectedCallOutcome<CreateInvalidation2016_01_28Outcome>(), this, request);
+}
+
+CreateInvalidation2016_01_28OutcomeCallable CloudFrontClient::CreateInvalidation2016_01_28Callable(CreateInvalidation2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::CreateInvalidation2016_01_28, Aws::Client::RejectedCallOutcome<CreateInvalidation2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::CreateInvalidation2016_01_28Async(const CreateInvalidation2016_01_28Request& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::CreateInvalidation2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::CreateInvalidation2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<CreateInvalidation2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::CreateInvalidation2016_01_28Async(CreateInvalidation2016_01_28Request&& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::CreateInvalidation2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<CreateInvalidation2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::CreateInvalidation2016_01_28AsyncHelper(const CreateInvalidation2016_01_28Request& request, const CreateInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -206,9 +237,9 @@ void CloudFrontClient::CreateInvalidation2016_01_28AsyncHelper(const CreateInval
 
 CreateStreamingDistribution2016_01_28Outcome CloudFrontClient::CreateStreamingDistribution2016_01_28(const CreateStreamingDistribution2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/streaming-distribution";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/streaming-distribution");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return CreateStreamingDistribution2016_01_28Outcome(CreateStreamingDistribution2016_01_28Result(outcome.GetResult()));
@@ -221,12 +252,22 @@ CreateStreamingDistribution2016_01_28Outcome CloudFrontClient::CreateStreamingDi
 
 CreateStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::CreateStreamingDistribution2016_01_28Callable(const CreateStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::CreateStreamingDistribution2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::CreateStreamingDistribution2016_01_28, Aws::Client::RejectedCallOutcome<CreateStreamingDistribution2016_01_28Outcome>(), this, request);
+}
+
+CreateStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::CreateStreamingDistribution2016_01_28Callable(CreateStreamingDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::CreateStreamingDistribution2016_01_28, Aws::Client::RejectedCallOutcome<CreateStreamingDistribution2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::CreateStreamingDistribution2016_01_28Async(const CreateStreamingDistribution2016_01_28Request& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::CreateStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::CreateStreamingDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<CreateStreamingDistribution2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::CreateStreamingDistribution2016_01_28Async(CreateStreamingDistribution2016_01_28Request&& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::CreateStreamingDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<CreateStreamingDistribution2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::CreateStreamingDistribution2016_01_28AsyncHelper(const CreateStreamingDistribution2016_01_28Request& request, const CreateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -236,10 +277,10 @@ void CloudFrontClient::CreateStreamingDistribution2016_01_28AsyncHelper(const Cr
 
 DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/origin-access-identity/cloudfront/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome(NoResult());
@@ -252,12 +293,22 @@ DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::DeleteCl
 
 DeleteCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28Callable(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28, Aws::Client::RejectedCallOutcome<DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, request);
+}
+
+DeleteCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28Callable(DeleteCloudFrontOriginAccessIdentity2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28, Aws::Client::RejectedCallOutcome<DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28Async(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28Async(DeleteCloudFrontOriginAccessIdentity2016_01_28Request&& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const DeleteCloudFrontOriginAccessIdentity2016_01_28Request& request, const DeleteCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -267,10 +318,10 @@ void CloudFrontClient::DeleteCloudFrontOriginAccessIdentity2016_01_28AsyncHelper
 
 DeleteDistribution2016_01_28Outcome CloudFrontClient::DeleteDistribution2016_01_28(const DeleteDistribution2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/distribution/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/distribution/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteDistribution2016_01_28Outcome(NoResult());
@@ -283,12 +334,22 @@ DeleteDistribution2016_01_28Outcome CloudFrontClient::DeleteDistribution2016_01_
 
 DeleteDistribution2016_01_28OutcomeCallable CloudFrontClient::DeleteDistribution2016_01_28Callable(const DeleteDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::DeleteDistribution2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::DeleteDistribution2016_01_28, Aws::Client::RejectedCallOutcome<DeleteDistribution2016_01_28Outcome>(), this, request);
+}
+
+DeleteDistribution2016_01_28OutcomeCallable CloudFrontClient::DeleteDistribution2016_01_28Callable(DeleteDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::DeleteDistribution2016_01_28, Aws::Client::RejectedCallOutcome<DeleteDistribution2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::DeleteDistribution2016_01_28Async(const DeleteDistribution2016_01_28Request& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::DeleteDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::DeleteDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDistribution2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::DeleteDistribution2016_01_28Async(DeleteDistribution2016_01_28Request&& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::DeleteDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDistribution2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::DeleteDistribution2016_01_28AsyncHelper(const DeleteDistribution2016_01_28Request& request, const DeleteDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -298,10 +359,10 @@ void CloudFrontClient::DeleteDistribution2016_01_28AsyncHelper(const DeleteDistr
 
 DeleteStreamingDistribution2016_01_28Outcome CloudFrontClient::DeleteStreamingDistribution2016_01_28(const DeleteStreamingDistribution2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/streaming-distribution/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/streaming-distribution/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteStreamingDistribution2016_01_28Outcome(NoResult());
@@ -314,12 +375,22 @@ DeleteStreamingDistribution2016_01_28Outcome CloudFrontClient::DeleteStreamingDi
 
 DeleteStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::DeleteStreamingDistribution2016_01_28Callable(const DeleteStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::DeleteStreamingDistribution2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::DeleteStreamingDistribution2016_01_28, Aws::Client::RejectedCallOutcome<DeleteStreamingDistribution2016_01_28Outcome>(), this, request);
+}
+
+DeleteStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::DeleteStreamingDistribution2016_01_28Callable(DeleteStreamingDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::DeleteStreamingDistribution2016_01_28, Aws::Client::RejectedCallOutcome<DeleteStreamingDistribution2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::DeleteStreamingDistribution2016_01_28Async(const DeleteStreamingDistribution2016_01_28Request& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::DeleteStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::DeleteStreamingDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<DeleteStreamingDistribution2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::DeleteStreamingDistribution2016_01_28Async(DeleteStreamingDistribution2016_01_28Request&& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::DeleteStreamingDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<DeleteStreamingDistribution2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::DeleteStreamingDistribution2016_01_28AsyncHelper(const DeleteStreamingDistribution2016_01_28Request& request, const DeleteStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -329,10 +400,10 @@ void CloudFrontClient::DeleteStreamingDistribution2016_01_28AsyncHelper(const De
 
 GetCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/origin-access-identity/cloudfront/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetCloudFrontOriginAccessIdentity2016_01_28Outcome(GetCloudFrontOriginAccessIdentity2016_01_28Result(outcome.GetResult()));
@@ -345,12 +416,22 @@ GetCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::GetCloudFro
 
 GetCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28Callable(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28, Aws::Client::RejectedCallOutcome<GetCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, request);
+}
+
+GetCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28Callable(GetCloudFrontOriginAccessIdentity2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28, Aws::Client::RejectedCallOutcome<GetCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28Async(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<GetCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28Async(GetCloudFrontOriginAccessIdentity2016_01_28Request&& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<GetCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const GetCloudFrontOriginAccessIdentity2016_01_28Request& request, const GetCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -360,11 +441,11 @@ void CloudFrontClient::GetCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(co
 
 GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
-  ss << request.GetId();
-  ss << "/config";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/origin-access-identity/cloudfront/");
+  uri.Append(request.GetId());
+  uri.Append("/config");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome(GetCloudFrontOriginAccessIdentityConfig2016_01_28Result(outcome.GetResult()));
@@ -377,12 +458,22 @@ GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome CloudFrontClient::GetCl
 
 GetCloudFrontOriginAccessIdentityConfig2016_01_28OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28Callable(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28, Aws::Client::RejectedCallOutcome<GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome>(), this, request);
+}
+
+GetCloudFrontOriginAccessIdentityConfig2016_01_28OutcomeCallable CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28Callable(GetCloudFrontOriginAccessIdentityConfig2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28, Aws::Client::RejectedCallOutcome<GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28Async(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28Async(GetCloudFrontOriginAccessIdentityConfig2016_01_28Request&& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<GetCloudFrontOriginAccessIdentityConfig2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28AsyncHelper(const GetCloudFrontOriginAccessIdentityConfig2016_01_28Request& request, const GetCloudFrontOriginAccessIdentityConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -392,10 +483,10 @@ void CloudFrontClient::GetCloudFrontOriginAccessIdentityConfig2016_01_28AsyncHel
 
 GetDistribution2016_01_28Outcome CloudFrontClient::GetDistribution2016_01_28(const GetDistribution2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/distribution/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/distribution/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetDistribution2016_01_28Outcome(GetDistribution2016_01_28Result(outcome.GetResult()));
@@ -408,12 +499,22 @@ GetDistribution2016_01_28Outcome CloudFrontClient::GetDistribution2016_01_28(con
 
 GetDistribution2016_01_28OutcomeCallable CloudFrontClient::GetDistribution2016_01_28Callable(const GetDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetDistribution2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::GetDistribution2016_01_28, Aws::Client::RejectedCallOutcome<GetDistribution2016_01_28Outcome>(), this, request);
+}
+
+GetDistribution2016_01_28OutcomeCallable CloudFrontClient::GetDistribution2016_01_28Callable(GetDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::GetDistribution2016_01_28, Aws::Client::RejectedCallOutcome<GetDistribution2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::GetDistribution2016_01_28Async(const GetDistribution2016_01_28Request& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::GetDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<GetDistribution2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::GetDistribution2016_01_28Async(GetDistribution2016_01_28Request&& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::GetDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<GetDistribution2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::GetDistribution2016_01_28AsyncHelper(const GetDistribution2016_01_28Request& request, const GetDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -423,11 +524,11 @@ void CloudFrontClient::GetDistribution2016_01_28AsyncHelper(const GetDistributio
 
 GetDistributionConfig2016_01_28Outcome CloudFrontClient::GetDistributionConfig2016_01_28(const GetDistributionConfig2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/distribution/";
-  ss << request.GetId();
-  ss << "/config";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/distribution/");
+  uri.Append(request.GetId());
+  uri.Append("/config");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetDistributionConfig2016_01_28Outcome(GetDistributionConfig2016_01_28Result(outcome.GetResult()));
@@ -440,12 +541,22 @@ GetDistributionConfig2016_01_28Outcome CloudFrontClient::GetDistributionConfig20
 
 GetDistributionConfig2016_01_28OutcomeCallable CloudFrontClient::GetDistributionConfig2016_01_28Callable(const GetDistributionConfig2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetDistributionConfig2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::GetDistributionConfig2016_01_28, Aws::Client::RejectedCallOutcome<GetDistributionConfig2016_01_28Outcome>(), this, request);
+}
+
+GetDistributionConfig2016_01_28OutcomeCallable CloudFrontClient::GetDistributionConfig2016_01_28Callable(GetDistributionConfig2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::GetDistributionConfig2016_01_28, Aws::Client::RejectedCallOutcome<GetDistributionConfig2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::GetDistributionConfig2016_01_28Async(const GetDistributionConfig2016_01_28Request& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetDistributionConfig2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::GetDistributionConfig2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<GetDistributionConfig2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::GetDistributionConfig2016_01_28Async(GetDistributionConfig2016_01_28Request&& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::GetDistributionConfig2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<GetDistributionConfig2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::GetDistributionConfig2016_01_28AsyncHelper(const GetDistributionConfig2016_01_28Request& request, const GetDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -455,12 +566,12 @@ void CloudFrontClient::GetDistributionConfig2016_01_28AsyncHelper(const GetDistr
 
 GetInvalidation2016_01_28Outcome CloudFrontClient::GetInvalidation2016_01_28(const GetInvalidation2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/distribution/";
-  ss << request.GetDistributionId();
-  ss << "/invalidation/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/distribution/");
+  uri.Append(request.GetDistributionId());
+  uri.Append("/invalidation/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetInvalidation2016_01_28Outcome(GetInvalidation2016_01_28Result(outcome.GetResult()));
@@ -473,12 +584,22 @@ GetInvalidation2016_01_28Outcome CloudFrontClient::GetInvalidation2016_01_28(con
 
 GetInvalidation2016_01_28OutcomeCallable CloudFrontClient::GetInvalidation2016_01_28Callable(const GetInvalidation2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetInvalidation2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::GetInvalidation2016_01_28, Aws::Client::RejectedCallOutcome<GetInvalidation2016_01_28Outcome>(), this, request);
+}
+
+GetInvalidation2016_01_28OutcomeCallable CloudFrontClient::GetInvalidation2016_01_28Callable(GetInvalidation2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::GetInvalidation2016_01_28, Aws::Client::RejectedCallOutcome<GetInvalidation2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::GetInvalidation2016_01_28Async(const GetInvalidation2016_01_28Request& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetInvalidation2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::GetInvalidation2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<GetInvalidation2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::GetInvalidation2016_01_28Async(GetInvalidation2016_01_28Request&& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::GetInvalidation2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<GetInvalidation2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::GetInvalidation2016_01_28AsyncHelper(const GetInvalidation2016_01_28Request& request, const GetInvalidation2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -488,10 +609,10 @@ void CloudFrontClient::GetInvalidation2016_01_28AsyncHelper(const GetInvalidatio
 
 GetStreamingDistribution2016_01_28Outcome CloudFrontClient::GetStreamingDistribution2016_01_28(const GetStreamingDistribution2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/streaming-distribution/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/streaming-distribution/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetStreamingDistribution2016_01_28Outcome(GetStreamingDistribution2016_01_28Result(outcome.GetResult()));
@@ -504,12 +625,22 @@ GetStreamingDistribution2016_01_28Outcome CloudFrontClient::GetStreamingDistribu
 
 GetStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::GetStreamingDistribution2016_01_28Callable(const GetStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetStreamingDistribution2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::GetStreamingDistribution2016_01_28, Aws::Client::RejectedCallOutcome<GetStreamingDistribution2016_01_28Outcome>(), this, request);
+}
+
+GetStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::GetStreamingDistribution2016_01_28Callable(GetStreamingDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::GetStreamingDistribution2016_01_28, Aws::Client::RejectedCallOutcome<GetStreamingDistribution2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::GetStreamingDistribution2016_01_28Async(const GetStreamingDistribution2016_01_28Request& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::GetStreamingDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<GetStreamingDistribution2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::GetStreamingDistribution2016_01_28Async(GetStreamingDistribution2016_01_28Request&& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::GetStreamingDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<GetStreamingDistribution2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::GetStreamingDistribution2016_01_28AsyncHelper(const GetStreamingDistribution2016_01_28Request& request, const GetStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -519,11 +650,11 @@ void CloudFrontClient::GetStreamingDistribution2016_01_28AsyncHelper(const GetSt
 
 GetStreamingDistributionConfig2016_01_28Outcome CloudFrontClient::GetStreamingDistributionConfig2016_01_28(const GetStreamingDistributionConfig2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/streaming-distribution/";
-  ss << request.GetId();
-  ss << "/config";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/streaming-distribution/");
+  uri.Append(request.GetId());
+  uri.Append("/config");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetStreamingDistributionConfig2016_01_28Outcome(GetStreamingDistributionConfig2016_01_28Result(outcome.GetResult()));
@@ -536,12 +667,22 @@ GetStreamingDistributionConfig2016_01_28Outcome CloudFrontClient::GetStreamingDi
 
 GetStreamingDistributionConfig2016_01_28OutcomeCallable CloudFrontClient::GetStreamingDistributionConfig2016_01_28Callable(const GetStreamingDistributionConfig2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::GetStreamingDistributionConfig2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::GetStreamingDistributionConfig2016_01_28, Aws::Client::RejectedCallOutcome<GetStreamingDistributionConfig2016_01_28Outcome>(), this, request);
+}
+
+GetStreamingDistributionConfig2016_01_28OutcomeCallable CloudFrontClient::GetStreamingDistributionConfig2016_01_28Callable(GetStreamingDistributionConfig2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::GetStreamingDistributionConfig2016_01_28, Aws::Client::RejectedCallOutcome<GetStreamingDistributionConfig2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::GetStreamingDistributionConfig2016_01_28Async(const GetStreamingDistributionConfig2016_01_28Request& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::GetStreamingDistributionConfig2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::GetStreamingDistributionConfig2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<GetStreamingDistributionConfig2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::GetStreamingDistributionConfig2016_01_28Async(GetStreamingDistributionConfig2016_01_28Request&& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::GetStreamingDistributionConfig2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<GetStreamingDistributionConfig2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::GetStreamingDistributionConfig2016_01_28AsyncHelper(const GetStreamingDistributionConfig2016_01_28Request& request, const GetStreamingDistributionConfig2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -551,9 +692,9 @@ void CloudFrontClient::GetStreamingDistributionConfig2016_01_28AsyncHelper(const
 
 ListCloudFrontOriginAccessIdentities2016_01_28Outcome CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/origin-access-identity/cloudfront");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListCloudFrontOriginAccessIdentities2016_01_28Outcome(ListCloudFrontOriginAccessIdentities2016_01_28Result(outcome.GetResult()));
@@ -566,12 +707,22 @@ ListCloudFrontOriginAccessIdentities2016_01_28Outcome CloudFrontClient::ListClou
 
 ListCloudFrontOriginAccessIdentities2016_01_28OutcomeCallable CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28Callable(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28, Aws::Client::RejectedCallOutcome<ListCloudFrontOriginAccessIdentities2016_01_28Outcome>(), this, request);
+}
+
+ListCloudFrontOriginAccessIdentities2016_01_28OutcomeCallable CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28Callable(ListCloudFrontOriginAccessIdentities2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28, Aws::Client::RejectedCallOutcome<ListCloudFrontOriginAccessIdentities2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28Async(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<ListCloudFrontOriginAccessIdentities2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28Async(ListCloudFrontOriginAccessIdentities2016_01_28Request&& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<ListCloudFrontOriginAccessIdentities2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28AsyncHelper(const ListCloudFrontOriginAccessIdentities2016_01_28Request& request, const ListCloudFrontOriginAccessIdentities2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -581,9 +732,9 @@ void CloudFrontClient::ListCloudFrontOriginAccessIdentities2016_01_28AsyncHelper
 
 ListDistributions2016_01_28Outcome CloudFrontClient::ListDistributions2016_01_28(const ListDistributions2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/distribution";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/distribution");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListDistributions2016_01_28Outcome(ListDistributions2016_01_28Result(outcome.GetResult()));
@@ -596,12 +747,22 @@ ListDistributions2016_01_28Outcome CloudFrontClient::ListDistributions2016_01_28
 
 ListDistributions2016_01_28OutcomeCallable CloudFrontClient::ListDistributions2016_01_28Callable(const ListDistributions2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListDistributions2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::ListDistributions2016_01_28, Aws::Client::RejectedCallOutcome<ListDistributions2016_01_28Outcome>(), this, request);
+}
+
+ListDistributions2016_01_28OutcomeCallable CloudFrontClient::ListDistributions2016_01_28Callable(ListDistributions2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::ListDistributions2016_01_28, Aws::Client::RejectedCallOutcome<ListDistributions2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::ListDistributions2016_01_28Async(const ListDistributions2016_01_28Request& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListDistributions2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::ListDistributions2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<ListDistributions2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::ListDistributions2016_01_28Async(ListDistributions2016_01_28Request&& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::ListDistributions2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<ListDistributions2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::ListDistributions2016_01_28AsyncHelper(const ListDistributions2016_01_28Request& request, const ListDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -611,10 +772,10 @@ void CloudFrontClient::ListDistributions2016_01_28AsyncHelper(const ListDistribu
 
 ListDistributionsByWebACLId2016_01_28Outcome CloudFrontClient::ListDistributionsByWebACLId2016_01_28(const ListDistributionsByWebACLId2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/distributionsByWebACLId/";
-  ss << request.GetWebACLId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/distributionsByWebACLId/");
+  uri.Append(request.GetWebACLId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListDistributionsByWebACLId2016_01_28Outcome(ListDistributionsByWebACLId2016_01_28Result(outcome.GetResult()));
@@ -627,12 +788,22 @@ ListDistributionsByWebACLId2016_01_28Outcome CloudFrontClient::ListDistributions
 
 ListDistributionsByWebACLId2016_01_28OutcomeCallable CloudFrontClient::ListDistributionsByWebACLId2016_01_28Callable(const ListDistributionsByWebACLId2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListDistributionsByWebACLId2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::ListDistributionsByWebACLId2016_01_28, Aws::Client::RejectedCallOutcome<ListDistributionsByWebACLId2016_01_28Outcome>(), this, request);
+}
+
+ListDistributionsByWebACLId2016_01_28OutcomeCallable CloudFrontClient::ListDistributionsByWebACLId2016_01_28Callable(ListDistributionsByWebACLId2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::ListDistributionsByWebACLId2016_01_28, Aws::Client::RejectedCallOutcome<ListDistributionsByWebACLId2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::ListDistributionsByWebACLId2016_01_28Async(const ListDistributionsByWebACLId2016_01_28Request& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListDistributionsByWebACLId2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::ListDistributionsByWebACLId2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<ListDistributionsByWebACLId2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::ListDistributionsByWebACLId2016_01_28Async(ListDistributionsByWebACLId2016_01_28Request&& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::ListDistributionsByWebACLId2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<ListDistributionsByWebACLId2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::ListDistributionsByWebACLId2016_01_28AsyncHelper(const ListDistributionsByWebACLId2016_01_28Request& request, const ListDistributionsByWebACLId2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -642,11 +813,11 @@ void CloudFrontClient::ListDistributionsByWebACLId2016_01_28AsyncHelper(const Li
 
 ListInvalidations2016_01_28Outcome CloudFrontClient::ListInvalidations2016_01_28(const ListInvalidations2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/distribution/";
-  ss << request.GetDistributionId();
-  ss << "/invalidation";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/distribution/");
+  uri.Append(request.GetDistributionId());
+  uri.Append("/invalidation");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListInvalidations2016_01_28Outcome(ListInvalidations2016_01_28Result(outcome.GetResult()));
@@ -659,12 +830,22 @@ ListInvalidations2016_01_28Outcome CloudFrontClient::ListInvalidations2016_01_28
 
 ListInvalidations2016_01_28OutcomeCallable CloudFrontClient::ListInvalidations2016_01_28Callable(const ListInvalidations2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListInvalidations2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::ListInvalidations2016_01_28, Aws::Client::RejectedCallOutcome<ListInvalidations2016_01_28Outcome>(), this, request);
+}
+
+ListInvalidations2016_01_28OutcomeCallable CloudFrontClient::ListInvalidations2016_01_28Callable(ListInvalidations2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::ListInvalidations2016_01_28, Aws::Client::RejectedCallOutcome<ListInvalidations2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::ListInvalidations2016_01_28Async(const ListInvalidations2016_01_28Request& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListInvalidations2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::ListInvalidations2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<ListInvalidations2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::ListInvalidations2016_01_28Async(ListInvalidations2016_01_28Request&& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::ListInvalidations2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<ListInvalidations2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::ListInvalidations2016_01_28AsyncHelper(const ListInvalidations2016_01_28Request& request, const ListInvalidations2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -674,9 +855,9 @@ void CloudFrontClient::ListInvalidations2016_01_28AsyncHelper(const ListInvalida
 
 ListStreamingDistributions2016_01_28Outcome CloudFrontClient::ListStreamingDistributions2016_01_28(const ListStreamingDistributions2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/streaming-distribution";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/streaming-distribution");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListStreamingDistributions2016_01_28Outcome(ListStreamingDistributions2016_01_28Result(outcome.GetResult()));
@@ -689,12 +870,22 @@ ListStreamingDistributions2016_01_28Outcome CloudFrontClient::ListStreamingDistr
 
 ListStreamingDistributions2016_01_28OutcomeCallable CloudFrontClient::ListStreamingDistributions2016_01_28Callable(const ListStreamingDistributions2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::ListStreamingDistributions2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::ListStreamingDistributions2016_01_28, Aws::Client::RejectedCallOutcome<ListStreamingDistributions2016_01_28Outcome>(), this, request);
+}
+
+ListStreamingDistributions2016_01_28OutcomeCallable CloudFrontClient::ListStreamingDistributions2016_01_28Callable(ListStreamingDistributions2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::ListStreamingDistributions2016_01_28, Aws::Client::RejectedCallOutcome<ListStreamingDistributions2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::ListStreamingDistributions2016_01_28Async(const ListStreamingDistributions2016_01_28Request& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::ListStreamingDistributions2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::ListStreamingDistributions2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<ListStreamingDistributions2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::ListStreamingDistributions2016_01_28Async(ListStreamingDistributions2016_01_28Request&& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::ListStreamingDistributions2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<ListStreamingDistributions2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::ListStreamingDistributions2016_01_28AsyncHelper(const ListStreamingDistributions2016_01_28Request& request, const ListStreamingDistributions2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -704,11 +895,11 @@ void CloudFrontClient::ListStreamingDistributions2016_01_28AsyncHelper(const Lis
 
 UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/origin-access-identity/cloudfront/";
-  ss << request.GetId();
-  ss << "/config";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/origin-access-identity/cloudfront/");
+  uri.Append(request.GetId());
+  uri.Append("/config");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome(UpdateCloudFrontOriginAccessIdentity2016_01_28Result(outcome.GetResult()));
@@ -721,12 +912,22 @@ UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome CloudFrontClient::UpdateCl
 
 UpdateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28Callable(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28, Aws::Client::RejectedCallOutcome<UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, request);
+}
+
+UpdateCloudFrontOriginAccessIdentity2016_01_28OutcomeCallable CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28Callable(UpdateCloudFrontOriginAccessIdentity2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28, Aws::Client::RejectedCallOutcome<UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28Async(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28Async(UpdateCloudFrontOriginAccessIdentity2016_01_28Request&& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<UpdateCloudFrontOriginAccessIdentity2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper(const UpdateCloudFrontOriginAccessIdentity2016_01_28Request& request, const UpdateCloudFrontOriginAccessIdentity2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -736,11 +937,11 @@ void CloudFrontClient::UpdateCloudFrontOriginAccessIdentity2016_01_28AsyncHelper
 
 UpdateDistribution2016_01_28Outcome CloudFrontClient::UpdateDistribution2016_01_28(const UpdateDistribution2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/distribution/";
-  ss << request.GetId();
-  ss << "/config";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/distribution/");
+  uri.Append(request.GetId());
+  uri.Append("/config");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return UpdateDistribution2016_01_28Outcome(UpdateDistribution2016_01_28Result(outcome.GetResult()));
@@ -753,12 +954,22 @@ UpdateDistribution2016_01_28Outcome CloudFrontClient::UpdateDistribution2016_01_
 
 UpdateDistribution2016_01_28OutcomeCallable CloudFrontClient::UpdateDistribution2016_01_28Callable(const UpdateDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::UpdateDistribution2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::UpdateDistribution2016_01_28, Aws::Client::RejectedCallOutcome<UpdateDistribution2016_01_28Outcome>(), this, request);
+}
+
+UpdateDistribution2016_01_28OutcomeCallable CloudFrontClient::UpdateDistribution2016_01_28Callable(UpdateDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::UpdateDistribution2016_01_28, Aws::Client::RejectedCallOutcome<UpdateDistribution2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::UpdateDistribution2016_01_28Async(const UpdateDistribution2016_01_28Request& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::UpdateDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::UpdateDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDistribution2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::UpdateDistribution2016_01_28Async(UpdateDistribution2016_01_28Request&& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::UpdateDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDistribution2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::UpdateDistribution2016_01_28AsyncHelper(const UpdateDistribution2016_01_28Request& request, const UpdateDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -768,11 +979,11 @@ void CloudFrontClient::UpdateDistribution2016_01_28AsyncHelper(const UpdateDistr
 
 UpdateStreamingDistribution2016_01_28Outcome CloudFrontClient::UpdateStreamingDistribution2016_01_28(const UpdateStreamingDistribution2016_01_28Request& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2016-01-28/streaming-distribution/";
-  ss << request.GetId();
-  ss << "/config";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2016-01-28/streaming-distribution/");
+  uri.Append(request.GetId());
+  uri.Append("/config");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return UpdateStreamingDistribution2016_01_28Outcome(UpdateStreamingDistribution2016_01_28Result(outcome.GetResult()));
@@ -785,12 +996,22 @@ UpdateStreamingDistribution2016_01_28Outcome CloudFrontClient::UpdateStreamingDi
 
 UpdateStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::UpdateStreamingDistribution2016_01_28Callable(const UpdateStreamingDistribution2016_01_28Request& request) const
 {
-  return std::async(std::launch::async, &CloudFrontClient::UpdateStreamingDistribution2016_01_28, this, request);
+  return m_executor->SubmitWithFuture(&CloudFrontClient::UpdateStreamingDistribution2016_01_28, Aws::Client::RejectedCallOutcome<UpdateStreamingDistribution2016_01_28Outcome>(), this, request);
+}
+
+UpdateStreamingDistribution2016_01_28OutcomeCallable CloudFrontClient::UpdateStreamingDistribution2016_01_28Callable(UpdateStreamingDistribution2016_01_28Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudFrontClient::UpdateStreamingDistribution2016_01_28, Aws::Client::RejectedCallOutcome<UpdateStreamingDistribution2016_01_28Outcome>(), this, std::move(request));
 }
 
 void CloudFrontClient::UpdateStreamingDistribution2016_01_28Async(const UpdateStreamingDistribution2016_01_28Request& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudFrontClient::UpdateStreamingDistribution2016_01_28AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudFrontClient::UpdateStreamingDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<UpdateStreamingDistribution2016_01_28Outcome>(), this, request, handler, context);
+}
+
+void CloudFrontClient::UpdateStreamingDistribution2016_01_28Async(UpdateStreamingDistribution2016_01_28Request&& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudFrontClient::UpdateStreamingDistribution2016_01_28AsyncHelper, Aws::Client::RejectedAsyncCall<UpdateStreamingDistribution2016_01_28Outcome>(), this, std::move(request), handler, context);
 }
 
 void CloudFrontClient::UpdateStreamingDistribution2016_01_28AsyncHelper(const UpdateStreamingDistribution2016_01_28Request& request, const UpdateStreamingDistribution2016_01_28ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
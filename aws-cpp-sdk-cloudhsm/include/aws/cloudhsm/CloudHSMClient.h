@@ -39,6 +39,27 @@
 #include <aws/cloudhsm/model/ModifyLunaClientResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/cloudhsm/model/CreateHapgRequest.h>
+#include <aws/cloudhsm/model/CreateHsmRequest.h>
+#include <aws/cloudhsm/model/CreateLunaClientRequest.h>
+#include <aws/cloudhsm/model/DeleteHapgRequest.h>
+#include <aws/cloudhsm/model/DeleteHsmRequest.h>
+#include <aws/cloudhsm/model/DeleteLunaClientRequest.h>
+#include <aws/cloudhsm/model/DescribeHapgRequest.h>
+#include <aws/cloudhsm/model/DescribeHsmRequest.h>
+#include <aws/cloudhsm/model/DescribeLunaClientRequest.h>
+#include <aws/cloudhsm/model/GetConfigRequest.h>
+#include <aws/cloudhsm/model/ListAvailableZonesRequest.h>
+#include <aws/cloudhsm/model/ListHapgsRequest.h>
+#include <aws/cloudhsm/model/ListHsmsRequest.h>
+#include <aws/cloudhsm/model/ListLunaClientsRequest.h>
+#include <aws/cloudhsm/model/ModifyHapgRequest.h>
+#include <aws/cloudhsm/model/ModifyHsmRequest.h>
+#include <aws/cloudhsm/model/ModifyLunaClientRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -201,6 +222,11 @@ namespace Model
          */
         virtual Model::CreateHapgOutcomeCallable CreateHapgCallable(const Model::CreateHapgRequest& request) const;
 
+        /**
+         * Same as CreateHapgCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateHapgOutcomeCallable CreateHapgCallable(Model::CreateHapgRequest&& request) const;
+
         /**
          * <p>Creates a high-availability partition group. A high-availability partition
          * group is a group of partitions that spans multiple physical HSMs.</p>
@@ -209,6 +235,11 @@ namespace Model
          */
         virtual void CreateHapgAsync(const Model::CreateHapgRequest& request, const CreateHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateHapgAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateHapgAsync(Model::CreateHapgRequest&& request, const CreateHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an uninitialized HSM instance. Running this command provisions an HSM
          * appliance and will result in charges to your AWS account for the HSM.</p>
@@ -223,6 +254,11 @@ namespace Model
          */
         virtual Model::CreateHsmOutcomeCallable CreateHsmCallable(const Model::CreateHsmRequest& request) const;
 
+        /**
+         * Same as CreateHsmCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateHsmOutcomeCallable CreateHsmCallable(Model::CreateHsmRequest&& request) const;
+
         /**
          * <p>Creates an uninitialized HSM instance. Running this command provisions an HSM
          * appliance and will result in charges to your AWS account for the HSM.</p>
@@ -231,6 +267,11 @@ namespace Model
          */
         virtual void CreateHsmAsync(const Model::CreateHsmRequest& request, const CreateHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateHsmAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateHsmAsync(Model::CreateHsmRequest&& request, const CreateHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an HSM client.</p>
          */
@@ -243,6 +284,11 @@ namespace Model
          */
         virtual Model::CreateLunaClientOutcomeCallable CreateLunaClientCallable(const Model::CreateLunaClientRequest& request) const;
 
+        /**
+         * Same as CreateLunaClientCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateLunaClientOutcomeCallable CreateLunaClientCallable(Model::CreateLunaClientRequest&& request) const;
+
         /**
          * <p>Creates an HSM client.</p>
          *
@@ -250,6 +296,11 @@ namespace Model
          */
         virtual void CreateLunaClientAsync(const Model::CreateLunaClientRequest& request, const CreateLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLunaClientAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateLunaClientAsync(Model::CreateLunaClientRequest&& request, const CreateLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a high-availability partition group.</p>
          */
@@ -262,6 +313,11 @@ namespace Model
          */
         virtual Model::DeleteHapgOutcomeCallable DeleteHapgCallable(const Model::DeleteHapgRequest& request) const;
 
+        /**
+         * Same as DeleteHapgCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteHapgOutcomeCallable DeleteHapgCallable(Model::DeleteHapgRequest&& request) const;
+
         /**
          * <p>Deletes a high-availability partition group.</p>
          *
@@ -269,6 +325,11 @@ namespace Model
          */
         virtual void DeleteHapgAsync(const Model::DeleteHapgRequest& request, const DeleteHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteHapgAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteHapgAsync(Model::DeleteHapgRequest&& request, const DeleteHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an HSM. Once complete, this operation cannot be undone and your key
          * material cannot be recovered.</p>
@@ -283,6 +344,11 @@ namespace Model
          */
         virtual Model::DeleteHsmOutcomeCallable DeleteHsmCallable(const Model::DeleteHsmRequest& request) const;
 
+        /**
+         * Same as DeleteHsmCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteHsmOutcomeCallable DeleteHsmCallable(Model::DeleteHsmRequest&& request) const;
+
         /**
          * <p>Deletes an HSM. Once complete, this operation cannot be undone and your key
          * material cannot be recovered.</p>
@@ -291,6 +357,11 @@ namespace Model
          */
         virtual void DeleteHsmAsync(const Model::DeleteHsmRequest& request, const DeleteHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteHsmAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteHsmAsync(Model::DeleteHsmRequest&& request, const DeleteHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a client.</p>
          */
@@ -303,6 +374,11 @@ namespace Model
          */
         virtual Model::DeleteLunaClientOutcomeCallable DeleteLunaClientCallable(const Model::DeleteLunaClientRequest& request) const;
 
+        /**
+         * Same as DeleteLunaClientCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteLunaClientOutcomeCallable DeleteLunaClientCallable(Model::DeleteLunaClientRequest&& request) const;
+
         /**
          * <p>Deletes a client.</p>
          *
@@ -310,6 +386,11 @@ namespace Model
          */
         virtual void DeleteLunaClientAsync(const Model::DeleteLunaClientRequest& request, const DeleteLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLunaClientAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteLunaClientAsync(Model::DeleteLunaClientRequest&& request, const DeleteLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about a high-availability partition group.</p>
          */
@@ -322,6 +403,11 @@ namespace Model
          */
         virtual Model::DescribeHapgOutcomeCallable DescribeHapgCallable(const Model::DescribeHapgRequest& request) const;
 
+        /**
+         * Same as DescribeHapgCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeHapgOutcomeCallable DescribeHapgCallable(Model::DescribeHapgRequest&& request) const;
+
         /**
          * <p>Retrieves information about a high-availability partition group.</p>
          *
@@ -329,6 +415,11 @@ namespace Model
          */
         virtual void DescribeHapgAsync(const Model::DescribeHapgRequest& request, const DescribeHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeHapgAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeHapgAsync(Model::DescribeHapgRequest&& request, const DescribeHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about an HSM. You can identify the HSM by its ARN or
          * its serial number.</p>
@@ -343,6 +434,11 @@ namespace Model
          */
         virtual Model::DescribeHsmOutcomeCallable DescribeHsmCallable(const Model::DescribeHsmRequest& request) const;
 
+        /**
+         * Same as DescribeHsmCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeHsmOutcomeCallable DescribeHsmCallable(Model::DescribeHsmRequest&& request) const;
+
         /**
          * <p>Retrieves information about an HSM. You can identify the HSM by its ARN or
          * its serial number.</p>
@@ -351,6 +447,11 @@ namespace Model
          */
         virtual void DescribeHsmAsync(const Model::DescribeHsmRequest& request, const DescribeHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeHsmAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeHsmAsync(Model::DescribeHsmRequest&& request, const DescribeHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about an HSM client.</p>
          */
@@ -363,6 +464,11 @@ namespace Model
          */
         virtual Model::DescribeLunaClientOutcomeCallable DescribeLunaClientCallable(const Model::DescribeLunaClientRequest& request) const;
 
+        /**
+         * Same as DescribeLunaClientCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLunaClientOutcomeCallable DescribeLunaClientCallable(Model::DescribeLunaClientRequest&& request) const;
+
         /**
          * <p>Retrieves information about an HSM client.</p>
          *
@@ -370,6 +476,11 @@ namespace Model
          */
         virtual void DescribeLunaClientAsync(const Model::DescribeLunaClientRequest& request, const DescribeLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLunaClientAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLunaClientAsync(Model::DescribeLunaClientRequest&& request, const DescribeLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the configuration files necessary to connect to all high availability
          * partition groups the client is associated with.</p>
@@ -384,6 +495,11 @@ namespace Model
          */
         virtual Model::GetConfigOutcomeCallable GetConfigCallable(const Model::GetConfigRequest& request) const;
 
+        /**
+         * Same as GetConfigCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetConfigOutcomeCallable GetConfigCallable(Model::GetConfigRequest&& request) const;
+
         /**
          * <p>Gets the configuration files necessary to connect to all high availability
          * partition groups the client is associated with.</p>
@@ -392,6 +508,11 @@ namespace Model
          */
         virtual void GetConfigAsync(const Model::GetConfigRequest& request, const GetConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetConfigAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetConfigAsync(Model::GetConfigRequest&& request, const GetConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the Availability Zones that have available AWS CloudHSM capacity.</p>
          */
@@ -404,6 +525,11 @@ namespace Model
          */
         virtual Model::ListAvailableZonesOutcomeCallable ListAvailableZonesCallable(const Model::ListAvailableZonesRequest& request) const;
 
+        /**
+         * Same as ListAvailableZonesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAvailableZonesOutcomeCallable ListAvailableZonesCallable(Model::ListAvailableZonesRequest&& request) const;
+
         /**
          * <p>Lists the Availability Zones that have available AWS CloudHSM capacity.</p>
          *
@@ -411,6 +537,11 @@ namespace Model
          */
         virtual void ListAvailableZonesAsync(const Model::ListAvailableZonesRequest& request, const ListAvailableZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAvailableZonesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAvailableZonesAsync(Model::ListAvailableZonesRequest&& request, const ListAvailableZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the high-availability partition groups for the account.</p> <p>This
          * operation supports pagination with the use of the <i>NextToken</i> member. If
@@ -431,6 +562,11 @@ namespace Model
          */
         virtual Model::ListHapgsOutcomeCallable ListHapgsCallable(const Model::ListHapgsRequest& request) const;
 
+        /**
+         * Same as ListHapgsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListHapgsOutcomeCallable ListHapgsCallable(Model::ListHapgsRequest&& request) const;
+
         /**
          * <p>Lists the high-availability partition groups for the account.</p> <p>This
          * operation supports pagination with the use of the <i>NextToken</i> member. If
@@ -442,6 +578,11 @@ namespace Model
          */
         virtual void ListHapgsAsync(const Model::ListHapgsRequest& request, const ListHapgsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListHapgsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListHapgsAsync(Model::ListHapgsRequest&& request, const ListHapgsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the identifiers of all of the HSMs provisioned for the current
          * customer.</p> <p>This operation supports pagination with the use of the
@@ -462,6 +603,11 @@ namespace Model
          */
         virtual Model::ListHsmsOutcomeCallable ListHsmsCallable(const Model::ListHsmsRequest& request) const;
 
+        /**
+         * Same as ListHsmsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListHsmsOutcomeCallable ListHsmsCallable(Model::ListHsmsRequest&& request) const;
+
         /**
          * <p>Retrieves the identifiers of all of the HSMs provisioned for the current
          * customer.</p> <p>This operation supports pagination with the use of the
@@ -473,6 +619,11 @@ namespace Model
          */
         virtual void ListHsmsAsync(const Model::ListHsmsRequest& request, const ListHsmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListHsmsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListHsmsAsync(Model::ListHsmsRequest&& request, const ListHsmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all of the clients.</p> <p>This operation supports pagination with the
          * use of the <i>NextToken</i> member. If more results are available, the
@@ -491,6 +642,11 @@ namespace Model
          */
         virtual Model::ListLunaClientsOutcomeCallable ListLunaClientsCallable(const Model::ListLunaClientsRequest& request) const;
 
+        /**
+         * Same as ListLunaClientsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListLunaClientsOutcomeCallable ListLunaClientsCallable(Model::ListLunaClientsRequest&& request) const;
+
         /**
          * <p>Lists all of the clients.</p> <p>This operation supports pagination with the
          * use of the <i>NextToken</i> member. If more results are available, the
@@ -501,6 +657,11 @@ namespace Model
          */
         virtual void ListLunaClientsAsync(const Model::ListLunaClientsRequest& request, const ListLunaClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListLunaClientsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListLunaClientsAsync(Model::ListLunaClientsRequest&& request, const ListLunaClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies an existing high-availability partition group.</p>
          */
@@ -513,6 +674,11 @@ namespace Model
          */
         virtual Model::ModifyHapgOutcomeCallable ModifyHapgCallable(const Model::ModifyHapgRequest& request) const;
 
+        /**
+         * Same as ModifyHapgCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyHapgOutcomeCallable ModifyHapgCallable(Model::ModifyHapgRequest&& request) const;
+
         /**
          * <p>Modifies an existing high-availability partition group.</p>
          *
@@ -520,6 +686,11 @@ namespace Model
          */
         virtual void ModifyHapgAsync(const Model::ModifyHapgRequest& request, const ModifyHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyHapgAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyHapgAsync(Model::ModifyHapgRequest&& request, const ModifyHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies an HSM.</p>
          */
@@ -532,6 +703,11 @@ namespace Model
          */
         virtual Model::ModifyHsmOutcomeCallable ModifyHsmCallable(const Model::ModifyHsmRequest& request) const;
 
+        /**
+         * Same as ModifyHsmCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyHsmOutcomeCallable ModifyHsmCallable(Model::ModifyHsmRequest&& request) const;
+
         /**
          * <p>Modifies an HSM.</p>
          *
@@ -539,6 +715,11 @@ namespace Model
          */
         virtual void ModifyHsmAsync(const Model::ModifyHsmRequest& request, const ModifyHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyHsmAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyHsmAsync(Model::ModifyHsmRequest&& request, const ModifyHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the certificate used by the client.</p> <p>This action can
          * potentially start a workflow to install the new certificate on the client's
@@ -555,6 +736,11 @@ namespace Model
          */
         virtual Model::ModifyLunaClientOutcomeCallable ModifyLunaClientCallable(const Model::ModifyLunaClientRequest& request) const;
 
+        /**
+         * Same as ModifyLunaClientCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyLunaClientOutcomeCallable ModifyLunaClientCallable(Model::ModifyLunaClientRequest&& request) const;
+
         /**
          * <p>Modifies the certificate used by the client.</p> <p>This action can
          * potentially start a workflow to install the new certificate on the client's
@@ -564,6 +750,52 @@ namespace Model
          */
         virtual void ModifyLunaClientAsync(const Model::ModifyLunaClientRequest& request, const ModifyLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyLunaClientAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyLunaClientAsync(Model::ModifyLunaClientRequest&& request, const ModifyLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateHapgOutcome> CreateHapgAwaitable(const Model::CreateHapgRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::CreateHapg, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateHapgOutcome> CreateHapgAwaitable(Model::CreateHapgRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::CreateHapg, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateHsmOutcome> CreateHsmAwaitable(const Model::CreateHsmRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::CreateHsm, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateHsmOutcome> CreateHsmAwaitable(Model::CreateHsmRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::CreateHsm, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLunaClientOutcome> CreateLunaClientAwaitable(const Model::CreateLunaClientRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::CreateLunaClient, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLunaClientOutcome> CreateLunaClientAwaitable(Model::CreateLunaClientRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::CreateLunaClient, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteHapgOutcome> DeleteHapgAwaitable(const Model::DeleteHapgRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::DeleteHapg, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteHapgOutcome> DeleteHapgAwaitable(Model::DeleteHapgRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::DeleteHapg, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteHsmOutcome> DeleteHsmAwaitable(const Model::DeleteHsmRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::DeleteHsm, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteHsmOutcome> DeleteHsmAwaitable(Model::DeleteHsmRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::DeleteHsm, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLunaClientOutcome> DeleteLunaClientAwaitable(const Model::DeleteLunaClientRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::DeleteLunaClient, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLunaClientOutcome> DeleteLunaClientAwaitable(Model::DeleteLunaClientRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::DeleteLunaClient, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeHapgOutcome> DescribeHapgAwaitable(const Model::DescribeHapgRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::DescribeHapg, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeHapgOutcome> DescribeHapgAwaitable(Model::DescribeHapgRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::DescribeHapg, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeHsmOutcome> DescribeHsmAwaitable(const Model::DescribeHsmRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::DescribeHsm, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeHsmOutcome> DescribeHsmAwaitable(Model::DescribeHsmRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::DescribeHsm, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLunaClientOutcome> DescribeLunaClientAwaitable(const Model::DescribeLunaClientRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::DescribeLunaClient, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLunaClientOutcome> DescribeLunaClientAwaitable(Model::DescribeLunaClientRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::DescribeLunaClient, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetConfigOutcome> GetConfigAwaitable(const Model::GetConfigRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::GetConfig, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetConfigOutcome> GetConfigAwaitable(Model::GetConfigRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::GetConfig, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAvailableZonesOutcome> ListAvailableZonesAwaitable(const Model::ListAvailableZonesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::ListAvailableZones, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAvailableZonesOutcome> ListAvailableZonesAwaitable(Model::ListAvailableZonesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::ListAvailableZones, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListHapgsOutcome> ListHapgsAwaitable(const Model::ListHapgsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::ListHapgs, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListHapgsOutcome> ListHapgsAwaitable(Model::ListHapgsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::ListHapgs, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListHsmsOutcome> ListHsmsAwaitable(const Model::ListHsmsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::ListHsms, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListHsmsOutcome> ListHsmsAwaitable(Model::ListHsmsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::ListHsms, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListLunaClientsOutcome> ListLunaClientsAwaitable(const Model::ListLunaClientsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::ListLunaClients, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListLunaClientsOutcome> ListLunaClientsAwaitable(Model::ListLunaClientsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::ListLunaClients, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyHapgOutcome> ModifyHapgAwaitable(const Model::ModifyHapgRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::ModifyHapg, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyHapgOutcome> ModifyHapgAwaitable(Model::ModifyHapgRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::ModifyHapg, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyHsmOutcome> ModifyHsmAwaitable(const Model::ModifyHsmRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::ModifyHsm, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyHsmOutcome> ModifyHsmAwaitable(Model::ModifyHsmRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::ModifyHsm, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyLunaClientOutcome> ModifyLunaClientAwaitable(const Model::ModifyLunaClientRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::ModifyLunaClient, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyLunaClientOutcome> ModifyLunaClientAwaitable(Model::ModifyLunaClientRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudHSMClient::ModifyLunaClient, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -124,12 +124,22 @@ CreateHapgOutcome CloudHSMClient::CreateHapg(const CreateHapgRequest& request) c
 
 CreateHapgOutcomeCallable CloudHSMClient::CreateHapgCallable(const CreateHapgRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::CreateHapg, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::CreateHapg, Aws::Client::RejectedCallOutcome<CreateHapgOutcome>(), this, request);
+}
+
+CreateHapgOutcomeCallable CloudHSMClient::CreateHapgCallable(CreateHapgRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::CreateHapg, Aws::Client::RejectedCallOutcome<CreateHapgOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::CreateHapgAsync(const CreateHapgRequest& request, const CreateHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::CreateHapgAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::CreateHapgAsyncHelper, Aws::Client::RejectedAsyncCall<CreateHapgOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::CreateHapgAsync(CreateHapgRequest&& request, const CreateHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::CreateHapgAsyncHelper, Aws::Client::RejectedAsyncCall<CreateHapgOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::CreateHapgAsyncHelper(const CreateHapgRequest& request, const CreateHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -155,12 +165,22 @@ CreateHsmOutcome CloudHSMClient::CreateHsm(const CreateHsmRequest& request) cons
 
 CreateHsmOutcomeCallable CloudHSMClient::CreateHsmCallable(const CreateHsmRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::CreateHsm, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::CreateHsm, Aws::Client::RejectedCallOutcome<CreateHsmOutcome>(), this, request);
+}
+
+CreateHsmOutcomeCallable CloudHSMClient::CreateHsmCallable(CreateHsmRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::CreateHsm, Aws::Client::RejectedCallOutcome<CreateHsmOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::CreateHsmAsync(const CreateHsmRequest& request, const CreateHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::CreateHsmAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::CreateHsmAsyncHelper, Aws::Client::RejectedAsyncCall<CreateHsmOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::CreateHsmAsync(CreateHsmRequest&& request, const CreateHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::CreateHsmAsyncHelper, Aws::Client::RejectedAsyncCall<CreateHsmOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::CreateHsmAsyncHelper(const CreateHsmRequest& request, const CreateHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -186,12 +206,22 @@ CreateLunaClientOutcome CloudHSMClient::CreateLunaClient(const CreateLunaClientR
 
 CreateLunaClientOutcomeCallable CloudHSMClient::CreateLunaClientCallable(const CreateLunaClientRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::CreateLunaClient, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::CreateLunaClient, Aws::Client::RejectedCallOutcome<CreateLunaClientOutcome>(), this, request);
+}
+
+CreateLunaClientOutcomeCallable CloudHSMClient::CreateLunaClientCallable(CreateLunaClientRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::CreateLunaClient, Aws::Client::RejectedCallOutcome<CreateLunaClientOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::CreateLunaClientAsync(const CreateLunaClientRequest& request, const CreateLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::CreateLunaClientAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::CreateLunaClientAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLunaClientOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::CreateLunaClientAsync(CreateLunaClientRequest&& request, const CreateLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::CreateLunaClientAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLunaClientOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::CreateLunaClientAsyncHelper(const CreateLunaClientRequest& request, const CreateLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -217,12 +247,22 @@ DeleteHapgOutcome CloudHSMClient::DeleteHapg(const DeleteHapgRequest& request) c
 
 DeleteHapgOutcomeCallable CloudHSMClient::DeleteHapgCallable(const DeleteHapgRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::DeleteHapg, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::DeleteHapg, Aws::Client::RejectedCallOutcome<DeleteHapgOutcome>(), this, request);
+}
+
+DeleteHapgOutcomeCallable CloudHSMClient::DeleteHapgCallable(DeleteHapgRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::DeleteHapg, Aws::Client::RejectedCallOutcome<DeleteHapgOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::DeleteHapgAsync(const DeleteHapgRequest& request, const DeleteHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::DeleteHapgAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::DeleteHapgAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteHapgOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::DeleteHapgAsync(DeleteHapgRequest&& request, const DeleteHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::DeleteHapgAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteHapgOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::DeleteHapgAsyncHelper(const DeleteHapgRequest& request, const DeleteHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -248,12 +288,22 @@ DeleteHsmOutcome CloudHSMClient::DeleteHsm(const DeleteHsmRequest& request) cons
 
 DeleteHsmOutcomeCallable CloudHSMClient::DeleteHsmCallable(const DeleteHsmRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::DeleteHsm, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::DeleteHsm, Aws::Client::RejectedCallOutcome<DeleteHsmOutcome>(), this, request);
+}
+
+DeleteHsmOutcomeCallable CloudHSMClient::DeleteHsmCallable(DeleteHsmRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::DeleteHsm, Aws::Client::RejectedCallOutcome<DeleteHsmOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::DeleteHsmAsync(const DeleteHsmRequest& request, const DeleteHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::DeleteHsmAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::DeleteHsmAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteHsmOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::DeleteHsmAsync(DeleteHsmRequest&& request, const DeleteHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::DeleteHsmAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteHsmOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::DeleteHsmAsyncHelper(const DeleteHsmRequest& request, const DeleteHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -279,12 +329,22 @@ DeleteLunaClientOutcome CloudHSMClient::DeleteLunaClient(const DeleteLunaClientR
 
 DeleteLunaClientOutcomeCallable CloudHSMClient::DeleteLunaClientCallable(const DeleteLunaClientRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::DeleteLunaClient, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::DeleteLunaClient, Aws::Client::RejectedCallOutcome<DeleteLunaClientOutcome>(), this, request);
+}
+
+DeleteLunaClientOutcomeCallable CloudHSMClient::DeleteLunaClientCallable(DeleteLunaClientRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::DeleteLunaClient, Aws::Client::RejectedCallOutcome<DeleteLunaClientOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::DeleteLunaClientAsync(const DeleteLunaClientRequest& request, const DeleteLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::DeleteLunaClientAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::DeleteLunaClientAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLunaClientOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::DeleteLunaClientAsync(DeleteLunaClientRequest&& request, const DeleteLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::DeleteLunaClientAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLunaClientOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::DeleteLunaClientAsyncHelper(const DeleteLunaClientRequest& request, const DeleteLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -310,12 +370,22 @@ DescribeHapgOutcome CloudHSMClient::DescribeHapg(const DescribeHapgRequest& requ
 
 DescribeHapgOutcomeCallable CloudHSMClient::DescribeHapgCallable(const DescribeHapgRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::DescribeHapg, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::DescribeHapg, Aws::Client::RejectedCallOutcome<DescribeHapgOutcome>(), this, request);
+}
+
+DescribeHapgOutcomeCallable CloudHSMClient::DescribeHapgCallable(DescribeHapgRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::DescribeHapg, Aws::Client::RejectedCallOutcome<DescribeHapgOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::DescribeHapgAsync(const DescribeHapgRequest& request, const DescribeHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::DescribeHapgAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::DescribeHapgAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeHapgOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::DescribeHapgAsync(DescribeHapgRequest&& request, const DescribeHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::DescribeHapgAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeHapgOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::DescribeHapgAsyncHelper(const DescribeHapgRequest& request, const DescribeHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -341,12 +411,22 @@ DescribeHsmOutcome CloudHSMClient::DescribeHsm(const DescribeHsmRequest& request
 
 DescribeHsmOutcomeCallable CloudHSMClient::DescribeHsmCallable(const DescribeHsmRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::DescribeHsm, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::DescribeHsm, Aws::Client::RejectedCallOutcome<DescribeHsmOutcome>(), this, request);
+}
+
+DescribeHsmOutcomeCallable CloudHSMClient::DescribeHsmCallable(DescribeHsmRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::DescribeHsm, Aws::Client::RejectedCallOutcome<DescribeHsmOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::DescribeHsmAsync(const DescribeHsmRequest& request, const DescribeHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::DescribeHsmAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::DescribeHsmAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeHsmOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::DescribeHsmAsync(DescribeHsmRequest&& request, const DescribeHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::DescribeHsmAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeHsmOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::DescribeHsmAsyncHelper(const DescribeHsmRequest& request, const DescribeHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -372,12 +452,22 @@ DescribeLunaClientOutcome CloudHSMClient::DescribeLunaClient(const DescribeLunaC
 
 DescribeLunaClientOutcomeCallable CloudHSMClient::DescribeLunaClientCallable(const DescribeLunaClientRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::DescribeLunaClient, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::DescribeLunaClient, Aws::Client::RejectedCallOutcome<DescribeLunaClientOutcome>(), this, request);
+}
+
+DescribeLunaClientOutcomeCallable CloudHSMClient::DescribeLunaClientCallable(DescribeLunaClientRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::DescribeLunaClient, Aws::Client::RejectedCallOutcome<DescribeLunaClientOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::DescribeLunaClientAsync(const DescribeLunaClientRequest& request, const DescribeLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::DescribeLunaClientAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::DescribeLunaClientAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLunaClientOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::DescribeLunaClientAsync(DescribeLunaClientRequest&& request, const DescribeLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::DescribeLunaClientAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLunaClientOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::DescribeLunaClientAsyncHelper(const DescribeLunaClientRequest& request, const DescribeLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -403,12 +493,22 @@ GetConfigOutcome CloudHSMClient::GetConfig(const GetConfigRequest& request) cons
 
 GetConfigOutcomeCallable CloudHSMClient::GetConfigCallable(const GetConfigRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::GetConfig, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::GetConfig, Aws::Client::RejectedCallOutcome<GetConfigOutcome>(), this, request);
+}
+
+GetConfigOutcomeCallable CloudHSMClient::GetConfigCallable(GetConfigRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::GetConfig, Aws::Client::RejectedCallOutcome<GetConfigOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::GetConfigAsync(const GetConfigRequest& request, const GetConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::GetConfigAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::GetConfigAsyncHelper, Aws::Client::RejectedAsyncCall<GetConfigOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::GetConfigAsync(GetConfigRequest&& request, const GetConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::GetConfigAsyncHelper, Aws::Client::RejectedAsyncCall<GetConfigOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::GetConfigAsyncHelper(const GetConfigRequest& request, const GetConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -434,12 +534,22 @@ ListAvailableZonesOutcome CloudHSMClient::ListAvailableZones(const ListAvailable
 
 ListAvailableZonesOutcomeCallable CloudHSMClient::ListAvailableZonesCallable(const ListAvailableZonesRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::ListAvailableZones, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::ListAvailableZones, Aws::Client::RejectedCallOutcome<ListAvailableZonesOutcome>(), this, request);
+}
+
+ListAvailableZonesOutcomeCallable CloudHSMClient::ListAvailableZonesCallable(ListAvailableZonesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::ListAvailableZones, Aws::Client::RejectedCallOutcome<ListAvailableZonesOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::ListAvailableZonesAsync(const ListAvailableZonesRequest& request, const ListAvailableZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::ListAvailableZonesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::ListAvailableZonesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAvailableZonesOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::ListAvailableZonesAsync(ListAvailableZonesRequest&& request, const ListAvailableZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::ListAvailableZonesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAvailableZonesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::ListAvailableZonesAsyncHelper(const ListAvailableZonesRequest& request, const ListAvailableZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -465,12 +575,22 @@ ListHapgsOutcome CloudHSMClient::ListHapgs(const ListHapgsRequest& request) cons
 
 ListHapgsOutcomeCallable CloudHSMClient::ListHapgsCallable(const ListHapgsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::ListHapgs, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::ListHapgs, Aws::Client::RejectedCallOutcome<ListHapgsOutcome>(), this, request);
+}
+
+ListHapgsOutcomeCallable CloudHSMClient::ListHapgsCallable(ListHapgsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::ListHapgs, Aws::Client::RejectedCallOutcome<ListHapgsOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::ListHapgsAsync(const ListHapgsRequest& request, const ListHapgsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::ListHapgsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::ListHapgsAsyncHelper, Aws::Client::RejectedAsyncCall<ListHapgsOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::ListHapgsAsync(ListHapgsRequest&& request, const ListHapgsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::ListHapgsAsyncHelper, Aws::Client::RejectedAsyncCall<ListHapgsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::ListHapgsAsyncHelper(const ListHapgsRequest& request, const ListHapgsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -496,12 +616,22 @@ ListHsmsOutcome CloudHSMClient::ListHsms(const ListHsmsRequest& request) const
 
 ListHsmsOutcomeCallable CloudHSMClient::ListHsmsCallable(const ListHsmsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::ListHsms, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::ListHsms, Aws::Client::RejectedCallOutcome<ListHsmsOutcome>(), this, request);
+}
+
+ListHsmsOutcomeCallable CloudHSMClient::ListHsmsCallable(ListHsmsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::ListHsms, Aws::Client::RejectedCallOutcome<ListHsmsOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::ListHsmsAsync(const ListHsmsRequest& request, const ListHsmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::ListHsmsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::ListHsmsAsyncHelper, Aws::Client::RejectedAsyncCall<ListHsmsOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::ListHsmsAsync(ListHsmsRequest&& request, const ListHsmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::ListHsmsAsyncHelper, Aws::Client::RejectedAsyncCall<ListHsmsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::ListHsmsAsyncHelper(const ListHsmsRequest& request, const ListHsmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -527,12 +657,22 @@ ListLunaClientsOutcome CloudHSMClient::ListLunaClients(const ListLunaClientsRequ
 
 ListLunaClientsOutcomeCallable CloudHSMClient::ListLunaClientsCallable(const ListLunaClientsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::ListLunaClients, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::ListLunaClients, Aws::Client::RejectedCallOutcome<ListLunaClientsOutcome>(), this, request);
+}
+
+ListLunaClientsOutcomeCallable CloudHSMClient::ListLunaClientsCallable(ListLunaClientsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::ListLunaClients, Aws::Client::RejectedCallOutcome<ListLunaClientsOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::ListLunaClientsAsync(const ListLunaClientsRequest& request, const ListLunaClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::ListLunaClientsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::ListLunaClientsAsyncHelper, Aws::Client::RejectedAsyncCall<ListLunaClientsOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::ListLunaClientsAsync(ListLunaClientsRequest&& request, const ListLunaClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::ListLunaClientsAsyncHelper, Aws::Client::RejectedAsyncCall<ListLunaClientsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::ListLunaClientsAsyncHelper(const ListLunaClientsRequest& request, const ListLunaClientsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -558,12 +698,22 @@ ModifyHapgOutcome CloudHSMClient::ModifyHapg(const ModifyHapgRequest& request) c
 
 ModifyHapgOutcomeCallable CloudHSMClient::ModifyHapgCallable(const ModifyHapgRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::ModifyHapg, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::ModifyHapg, Aws::Client::RejectedCallOutcome<ModifyHapgOutcome>(), this, request);
+}
+
+ModifyHapgOutcomeCallable CloudHSMClient::ModifyHapgCallable(ModifyHapgRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::ModifyHapg, Aws::Client::RejectedCallOutcome<ModifyHapgOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::ModifyHapgAsync(const ModifyHapgRequest& request, const ModifyHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::ModifyHapgAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::ModifyHapgAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyHapgOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::ModifyHapgAsync(ModifyHapgRequest&& request, const ModifyHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::ModifyHapgAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyHapgOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::ModifyHapgAsyncHelper(const ModifyHapgRequest& request, const ModifyHapgResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -589,12 +739,22 @@ ModifyHsmOutcome CloudHSMClient::ModifyHsm(const ModifyHsmRequest& request) cons
 
 ModifyHsmOutcomeCallable CloudHSMClient::ModifyHsmCallable(const ModifyHsmRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::ModifyHsm, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::ModifyHsm, Aws::Client::RejectedCallOutcome<ModifyHsmOutcome>(), this, request);
+}
+
+ModifyHsmOutcomeCallable CloudHSMClient::ModifyHsmCallable(ModifyHsmRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::ModifyHsm, Aws::Client::RejectedCallOutcome<ModifyHsmOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::ModifyHsmAsync(const ModifyHsmRequest& request, const ModifyHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::ModifyHsmAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::ModifyHsmAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyHsmOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::ModifyHsmAsync(ModifyHsmRequest&& request, const ModifyHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::ModifyHsmAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyHsmOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::ModifyHsmAsyncHelper(const ModifyHsmRequest& request, const ModifyHsmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -620,12 +780,22 @@ ModifyLunaClientOutcome CloudHSMClient::ModifyLunaClient(const ModifyLunaClientR
 
 ModifyLunaClientOutcomeCallable CloudHSMClient::ModifyLunaClientCallable(const ModifyLunaClientRequest& request) const
 {
-  return std::async(std::launch::async, &CloudHSMClient::ModifyLunaClient, this, request);
+  return m_executor->SubmitWithFuture(&CloudHSMClient::ModifyLunaClient, Aws::Client::RejectedCallOutcome<ModifyLunaClientOutcome>(), this, request);
+}
+
+ModifyLunaClientOutcomeCallable CloudHSMClient::ModifyLunaClientCallable(ModifyLunaClientRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudHSMClient::ModifyLunaClient, Aws::Client::RejectedCallOutcome<ModifyLunaClientOutcome>(), this, std::move(request));
 }
 
 void CloudHSMClient::ModifyLunaClientAsync(const ModifyLunaClientRequest& request, const ModifyLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudHSMClient::ModifyLunaClientAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudHSMClient::ModifyLunaClientAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyLunaClientOutcome>(), this, request, handler, context);
+}
+
+void CloudHSMClient::ModifyLunaClientAsync(ModifyLunaClientRequest&& request, const ModifyLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudHSMClient::ModifyLunaClientAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyLunaClientOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudHSMClient::ModifyLunaClientAsyncHelper(const ModifyLunaClientRequest& request, const ModifyLunaClientResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -46,6 +46,34 @@
 #include <aws/cloudsearch/model/UpdateServiceAccessPoliciesResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/cloudsearch/model/BuildSuggestersRequest.h>
+#include <aws/cloudsearch/model/CreateDomainRequest.h>
+#include <aws/cloudsearch/model/DefineAnalysisSchemeRequest.h>
+#include <aws/cloudsearch/model/DefineExpressionRequest.h>
+#include <aws/cloudsearch/model/DefineIndexFieldRequest.h>
+#include <aws/cloudsearch/model/DefineSuggesterRequest.h>
+#include <aws/cloudsearch/model/DeleteAnalysisSchemeRequest.h>
+#include <aws/cloudsearch/model/DeleteDomainRequest.h>
+#include <aws/cloudsearch/model/DeleteExpressionRequest.h>
+#include <aws/cloudsearch/model/DeleteIndexFieldRequest.h>
+#include <aws/cloudsearch/model/DeleteSuggesterRequest.h>
+#include <aws/cloudsearch/model/DescribeAnalysisSchemesRequest.h>
+#include <aws/cloudsearch/model/DescribeAvailabilityOptionsRequest.h>
+#include <aws/cloudsearch/model/DescribeDomainsRequest.h>
+#include <aws/cloudsearch/model/DescribeExpressionsRequest.h>
+#include <aws/cloudsearch/model/DescribeIndexFieldsRequest.h>
+#include <aws/cloudsearch/model/DescribeScalingParametersRequest.h>
+#include <aws/cloudsearch/model/DescribeServiceAccessPoliciesRequest.h>
+#include <aws/cloudsearch/model/DescribeSuggestersRequest.h>
+#include <aws/cloudsearch/model/IndexDocumentsRequest.h>
+#include <aws/cloudsearch/model/ListDomainNamesRequest.h>
+#include <aws/cloudsearch/model/UpdateAvailabilityOptionsRequest.h>
+#include <aws/cloudsearch/model/UpdateScalingParametersRequest.h>
+#include <aws/cloudsearch/model/UpdateServiceAccessPoliciesRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -248,6 +276,11 @@ namespace Model
          */
         virtual Model::BuildSuggestersOutcomeCallable BuildSuggestersCallable(const Model::BuildSuggestersRequest& request) const;
 
+        /**
+         * Same as BuildSuggestersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BuildSuggestersOutcomeCallable BuildSuggestersCallable(Model::BuildSuggestersRequest&& request) const;
+
         /**
          * <p>Indexes the search suggestions. For more information, see <a
          * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/getting-suggestions.html#configuring-suggesters">Configuring
@@ -257,6 +290,11 @@ namespace Model
          */
         virtual void BuildSuggestersAsync(const Model::BuildSuggestersRequest& request, const BuildSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BuildSuggestersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BuildSuggestersAsync(Model::BuildSuggestersRequest&& request, const BuildSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new search domain. For more information, see <a
          * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/creating-domains.html"
@@ -275,6 +313,11 @@ namespace Model
          */
         virtual Model::CreateDomainOutcomeCallable CreateDomainCallable(const Model::CreateDomainRequest& request) const;
 
+        /**
+         * Same as CreateDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDomainOutcomeCallable CreateDomainCallable(Model::CreateDomainRequest&& request) const;
+
         /**
          * <p>Creates a new search domain. For more information, see <a
          * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/creating-domains.html"
@@ -285,6 +328,11 @@ namespace Model
          */
         virtual void CreateDomainAsync(const Model::CreateDomainRequest& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDomainAsync(Model::CreateDomainRequest&& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures an analysis scheme that can be applied to a <code>text</code> or
          * <code>text-array</code> field to define language-specific text processing
@@ -307,6 +355,11 @@ namespace Model
          */
         virtual Model::DefineAnalysisSchemeOutcomeCallable DefineAnalysisSchemeCallable(const Model::DefineAnalysisSchemeRequest& request) const;
 
+        /**
+         * Same as DefineAnalysisSchemeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DefineAnalysisSchemeOutcomeCallable DefineAnalysisSchemeCallable(Model::DefineAnalysisSchemeRequest&& request) const;
+
         /**
          * <p>Configures an analysis scheme that can be applied to a <code>text</code> or
          * <code>text-array</code> field to define language-specific text processing
@@ -319,6 +372,11 @@ namespace Model
          */
         virtual void DefineAnalysisSchemeAsync(const Model::DefineAnalysisSchemeRequest& request, const DefineAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DefineAnalysisSchemeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DefineAnalysisSchemeAsync(Model::DefineAnalysisSchemeRequest&& request, const DefineAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures an <code><a>Expression</a></code> for the search domain. Used to
          * create new expressions and modify existing ones. If the expression exists, the
@@ -341,6 +399,11 @@ namespace Model
          */
         virtual Model::DefineExpressionOutcomeCallable DefineExpressionCallable(const Model::DefineExpressionRequest& request) const;
 
+        /**
+         * Same as DefineExpressionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DefineExpressionOutcomeCallable DefineExpressionCallable(Model::DefineExpressionRequest&& request) const;
+
         /**
          * <p>Configures an <code><a>Expression</a></code> for the search domain. Used to
          * create new expressions and modify existing ones. If the expression exists, the
@@ -353,6 +416,11 @@ namespace Model
          */
         virtual void DefineExpressionAsync(const Model::DefineExpressionRequest& request, const DefineExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DefineExpressionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DefineExpressionAsync(Model::DefineExpressionRequest&& request, const DefineExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures an <code><a>IndexField</a></code> for the search domain. Used to
          * create new fields and modify existing ones. You must specify the name of the
@@ -383,6 +451,11 @@ namespace Model
          */
         virtual Model::DefineIndexFieldOutcomeCallable DefineIndexFieldCallable(const Model::DefineIndexFieldRequest& request) const;
 
+        /**
+         * Same as DefineIndexFieldCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DefineIndexFieldOutcomeCallable DefineIndexFieldCallable(Model::DefineIndexFieldRequest&& request) const;
+
         /**
          * <p>Configures an <code><a>IndexField</a></code> for the search domain. Used to
          * create new fields and modify existing ones. You must specify the name of the
@@ -399,6 +472,11 @@ namespace Model
          */
         virtual void DefineIndexFieldAsync(const Model::DefineIndexFieldRequest& request, const DefineIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DefineIndexFieldAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DefineIndexFieldAsync(Model::DefineIndexFieldRequest&& request, const DefineIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures a suggester for a domain. A suggester enables you to display
          * possible matches before users finish typing their queries. When you configure a
@@ -425,6 +503,11 @@ namespace Model
          */
         virtual Model::DefineSuggesterOutcomeCallable DefineSuggesterCallable(const Model::DefineSuggesterRequest& request) const;
 
+        /**
+         * Same as DefineSuggesterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DefineSuggesterOutcomeCallable DefineSuggesterCallable(Model::DefineSuggesterRequest&& request) const;
+
         /**
          * <p>Configures a suggester for a domain. A suggester enables you to display
          * possible matches before users finish typing their queries. When you configure a
@@ -439,6 +522,11 @@ namespace Model
          */
         virtual void DefineSuggesterAsync(const Model::DefineSuggesterRequest& request, const DefineSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DefineSuggesterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DefineSuggesterAsync(Model::DefineSuggesterRequest&& request, const DefineSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an analysis scheme. For more information, see <a
          * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-analysis-schemes.html"
@@ -457,6 +545,11 @@ namespace Model
          */
         virtual Model::DeleteAnalysisSchemeOutcomeCallable DeleteAnalysisSchemeCallable(const Model::DeleteAnalysisSchemeRequest& request) const;
 
+        /**
+         * Same as DeleteAnalysisSchemeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteAnalysisSchemeOutcomeCallable DeleteAnalysisSchemeCallable(Model::DeleteAnalysisSchemeRequest&& request) const;
+
         /**
          * <p>Deletes an analysis scheme. For more information, see <a
          * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/configuring-analysis-schemes.html"
@@ -467,6 +560,11 @@ namespace Model
          */
         virtual void DeleteAnalysisSchemeAsync(const Model::DeleteAnalysisSchemeRequest& request, const DeleteAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAnalysisSchemeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteAnalysisSchemeAsync(Model::DeleteAnalysisSchemeRequest&& request, const DeleteAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes a search domain and all of its data. Once a domain has
          * been deleted, it cannot be recovered. For more information, see <a
@@ -487,6 +585,11 @@ namespace Model
          */
         virtual Model::DeleteDomainOutcomeCallable DeleteDomainCallable(const Model::DeleteDomainRequest& request) const;
 
+        /**
+         * Same as DeleteDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDomainOutcomeCallable DeleteDomainCallable(Model::DeleteDomainRequest&& request) const;
+
         /**
          * <p>Permanently deletes a search domain and all of its data. Once a domain has
          * been deleted, it cannot be recovered. For more information, see <a
@@ -498,6 +601,11 @@ namespace Model
          */
         virtual void DeleteDomainAsync(const Model::DeleteDomainRequest& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDomainAsync(Model::DeleteDomainRequest&& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes an <code><a>Expression</a></code> from the search domain. For more
          * information, see <a
@@ -518,6 +626,11 @@ namespace Model
          */
         virtual Model::DeleteExpressionOutcomeCallable DeleteExpressionCallable(const Model::DeleteExpressionRequest& request) const;
 
+        /**
+         * Same as DeleteExpressionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteExpressionOutcomeCallable DeleteExpressionCallable(Model::DeleteExpressionRequest&& request) const;
+
         /**
          * <p>Removes an <code><a>Expression</a></code> from the search domain. For more
          * information, see <a
@@ -529,6 +642,11 @@ namespace Model
          */
         virtual void DeleteExpressionAsync(const Model::DeleteExpressionRequest& request, const DeleteExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteExpressionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteExpressionAsync(Model::DeleteExpressionRequest&& request, const DeleteExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes an <code><a>IndexField</a></code> from the search domain. For more
          * information, see <a
@@ -549,6 +667,11 @@ namespace Model
          */
         virtual Model::DeleteIndexFieldOutcomeCallable DeleteIndexFieldCallable(const Model::DeleteIndexFieldRequest& request) const;
 
+        /**
+         * Same as DeleteIndexFieldCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteIndexFieldOutcomeCallable DeleteIndexFieldCallable(Model::DeleteIndexFieldRequest&& request) const;
+
         /**
          * <p>Removes an <code><a>IndexField</a></code> from the search domain. For more
          * information, see <a
@@ -560,6 +683,11 @@ namespace Model
          */
         virtual void DeleteIndexFieldAsync(const Model::DeleteIndexFieldRequest& request, const DeleteIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIndexFieldAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteIndexFieldAsync(Model::DeleteIndexFieldRequest&& request, const DeleteIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a suggester. For more information, see <a
          * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/getting-suggestions.html"
@@ -578,6 +706,11 @@ namespace Model
          */
         virtual Model::DeleteSuggesterOutcomeCallable DeleteSuggesterCallable(const Model::DeleteSuggesterRequest& request) const;
 
+        /**
+         * Same as DeleteSuggesterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSuggesterOutcomeCallable DeleteSuggesterCallable(Model::DeleteSuggesterRequest&& request) const;
+
         /**
          * <p>Deletes a suggester. For more information, see <a
          * href="http://docs.aws.amazon.com/cloudsearch/latest/developerguide/getting-suggestions.html"
@@ -588,6 +721,11 @@ namespace Model
          */
         virtual void DeleteSuggesterAsync(const Model::DeleteSuggesterRequest& request, const DeleteSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSuggesterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSuggesterAsync(Model::DeleteSuggesterRequest&& request, const DeleteSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the analysis schemes configured for a domain. An analysis scheme defines
          * language-specific text processing options for a <code>text</code> field. Can be
@@ -616,6 +754,11 @@ namespace Model
          */
         virtual Model::DescribeAnalysisSchemesOutcomeCallable DescribeAnalysisSchemesCallable(const Model::DescribeAnalysisSchemesRequest& request) const;
 
+        /**
+         * Same as DescribeAnalysisSchemesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAnalysisSchemesOutcomeCallable DescribeAnalysisSchemesCallable(Model::DescribeAnalysisSchemesRequest&& request) const;
+
         /**
          * <p>Gets the analysis schemes configured for a domain. An analysis scheme defines
          * language-specific text processing options for a <code>text</code> field. Can be
@@ -631,6 +774,11 @@ namespace Model
          */
         virtual void DescribeAnalysisSchemesAsync(const Model::DescribeAnalysisSchemesRequest& request, const DescribeAnalysisSchemesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAnalysisSchemesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAnalysisSchemesAsync(Model::DescribeAnalysisSchemesRequest&& request, const DescribeAnalysisSchemesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the availability options configured for a domain. By default, shows the
          * configuration with any pending changes. Set the <code>Deployed</code> option to
@@ -655,6 +803,11 @@ namespace Model
          */
         virtual Model::DescribeAvailabilityOptionsOutcomeCallable DescribeAvailabilityOptionsCallable(const Model::DescribeAvailabilityOptionsRequest& request) const;
 
+        /**
+         * Same as DescribeAvailabilityOptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAvailabilityOptionsOutcomeCallable DescribeAvailabilityOptionsCallable(Model::DescribeAvailabilityOptionsRequest&& request) const;
+
         /**
          * <p>Gets the availability options configured for a domain. By default, shows the
          * configuration with any pending changes. Set the <code>Deployed</code> option to
@@ -668,6 +821,11 @@ namespace Model
          */
         virtual void DescribeAvailabilityOptionsAsync(const Model::DescribeAvailabilityOptionsRequest& request, const DescribeAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAvailabilityOptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAvailabilityOptionsAsync(Model::DescribeAvailabilityOptionsRequest&& request, const DescribeAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the search domains owned by this account. Can be
          * limited to specific domains. Shows all domains by default. To get the number of
@@ -696,6 +854,11 @@ namespace Model
          */
         virtual Model::DescribeDomainsOutcomeCallable DescribeDomainsCallable(const Model::DescribeDomainsRequest& request) const;
 
+        /**
+         * Same as DescribeDomainsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDomainsOutcomeCallable DescribeDomainsCallable(Model::DescribeDomainsRequest&& request) const;
+
         /**
          * <p>Gets information about the search domains owned by this account. Can be
          * limited to specific domains. Shows all domains by default. To get the number of
@@ -711,6 +874,11 @@ namespace Model
          */
         virtual void DescribeDomainsAsync(const Model::DescribeDomainsRequest& request, const DescribeDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDomainsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDomainsAsync(Model::DescribeDomainsRequest&& request, const DescribeDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the expressions configured for the search domain. Can be limited to
          * specific expressions by name. By default, shows all expressions and includes any
@@ -737,6 +905,11 @@ namespace Model
          */
         virtual Model::DescribeExpressionsOutcomeCallable DescribeExpressionsCallable(const Model::DescribeExpressionsRequest& request) const;
 
+        /**
+         * Same as DescribeExpressionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeExpressionsOutcomeCallable DescribeExpressionsCallable(Model::DescribeExpressionsRequest&& request) const;
+
         /**
          * <p>Gets the expressions configured for the search domain. Can be limited to
          * specific expressions by name. By default, shows all expressions and includes any
@@ -751,6 +924,11 @@ namespace Model
          */
         virtual void DescribeExpressionsAsync(const Model::DescribeExpressionsRequest& request, const DescribeExpressionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeExpressionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeExpressionsAsync(Model::DescribeExpressionsRequest&& request, const DescribeExpressionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the index fields configured for the search domain. Can
          * be limited to specific fields by name. By default, shows all fields and includes
@@ -777,6 +955,11 @@ namespace Model
          */
         virtual Model::DescribeIndexFieldsOutcomeCallable DescribeIndexFieldsCallable(const Model::DescribeIndexFieldsRequest& request) const;
 
+        /**
+         * Same as DescribeIndexFieldsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeIndexFieldsOutcomeCallable DescribeIndexFieldsCallable(Model::DescribeIndexFieldsRequest&& request) const;
+
         /**
          * <p>Gets information about the index fields configured for the search domain. Can
          * be limited to specific fields by name. By default, shows all fields and includes
@@ -791,6 +974,11 @@ namespace Model
          */
         virtual void DescribeIndexFieldsAsync(const Model::DescribeIndexFieldsRequest& request, const DescribeIndexFieldsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeIndexFieldsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeIndexFieldsAsync(Model::DescribeIndexFieldsRequest&& request, const DescribeIndexFieldsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the scaling parameters configured for a domain. A domain's scaling
          * parameters specify the desired search instance type and replication count. For
@@ -813,6 +1001,11 @@ namespace Model
          */
         virtual Model::DescribeScalingParametersOutcomeCallable DescribeScalingParametersCallable(const Model::DescribeScalingParametersRequest& request) const;
 
+        /**
+         * Same as DescribeScalingParametersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeScalingParametersOutcomeCallable DescribeScalingParametersCallable(Model::DescribeScalingParametersRequest&& request) const;
+
         /**
          * <p>Gets the scaling parameters configured for a domain. A domain's scaling
          * parameters specify the desired search instance type and replication count. For
@@ -825,6 +1018,11 @@ namespace Model
          */
         virtual void DescribeScalingParametersAsync(const Model::DescribeScalingParametersRequest& request, const DescribeScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScalingParametersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeScalingParametersAsync(Model::DescribeScalingParametersRequest&& request, const DescribeScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the access policies that control access to the
          * domain's document and search endpoints. By default, shows the configuration with
@@ -851,6 +1049,11 @@ namespace Model
          */
         virtual Model::DescribeServiceAccessPoliciesOutcomeCallable DescribeServiceAccessPoliciesCallable(const Model::DescribeServiceAccessPoliciesRequest& request) const;
 
+        /**
+         * Same as DescribeServiceAccessPoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeServiceAccessPoliciesOutcomeCallable DescribeServiceAccessPoliciesCallable(Model::DescribeServiceAccessPoliciesRequest&& request) const;
+
         /**
          * <p>Gets information about the access policies that control access to the
          * domain's document and search endpoints. By default, shows the configuration with
@@ -865,6 +1068,11 @@ namespace Model
          */
         virtual void DescribeServiceAccessPoliciesAsync(const Model::DescribeServiceAccessPoliciesRequest& request, const DescribeServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeServiceAccessPoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeServiceAccessPoliciesAsync(Model::DescribeServiceAccessPoliciesRequest&& request, const DescribeServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the suggesters configured for a domain. A suggester enables you to
          * display possible matches before users finish typing their queries. Can be
@@ -893,6 +1101,11 @@ namespace Model
          */
         virtual Model::DescribeSuggestersOutcomeCallable DescribeSuggestersCallable(const Model::DescribeSuggestersRequest& request) const;
 
+        /**
+         * Same as DescribeSuggestersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSuggestersOutcomeCallable DescribeSuggestersCallable(Model::DescribeSuggestersRequest&& request) const;
+
         /**
          * <p>Gets the suggesters configured for a domain. A suggester enables you to
          * display possible matches before users finish typing their queries. Can be
@@ -908,6 +1121,11 @@ namespace Model
          */
         virtual void DescribeSuggestersAsync(const Model::DescribeSuggestersRequest& request, const DescribeSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSuggestersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSuggestersAsync(Model::DescribeSuggestersRequest&& request, const DescribeSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Tells the search domain to start indexing its documents using the latest
          * indexing options. This operation must be invoked to activate options whose
@@ -924,6 +1142,11 @@ namespace Model
          */
         virtual Model::IndexDocumentsOutcomeCallable IndexDocumentsCallable(const Model::IndexDocumentsRequest& request) const;
 
+        /**
+         * Same as IndexDocumentsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::IndexDocumentsOutcomeCallable IndexDocumentsCallable(Model::IndexDocumentsRequest&& request) const;
+
         /**
          * <p>Tells the search domain to start indexing its documents using the latest
          * indexing options. This operation must be invoked to activate options whose
@@ -933,6 +1156,11 @@ namespace Model
          */
         virtual void IndexDocumentsAsync(const Model::IndexDocumentsRequest& request, const IndexDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as IndexDocumentsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void IndexDocumentsAsync(Model::IndexDocumentsRequest&& request, const IndexDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all search domains owned by an account.</p>
          */
@@ -945,6 +1173,11 @@ namespace Model
          */
         virtual Model::ListDomainNamesOutcomeCallable ListDomainNamesCallable(const Model::ListDomainNamesRequest& request) const;
 
+        /**
+         * Same as ListDomainNamesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDomainNamesOutcomeCallable ListDomainNamesCallable(Model::ListDomainNamesRequest&& request) const;
+
         /**
          * <p>Lists all search domains owned by an account.</p>
          *
@@ -952,6 +1185,11 @@ namespace Model
          */
         virtual void ListDomainNamesAsync(const Model::ListDomainNamesRequest& request, const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDomainNamesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDomainNamesAsync(Model::ListDomainNamesRequest&& request, const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures the availability options for a domain. Enabling the Multi-AZ
          * option expands an Amazon CloudSearch domain to an additional Availability Zone
@@ -978,6 +1216,11 @@ namespace Model
          */
         virtual Model::UpdateAvailabilityOptionsOutcomeCallable UpdateAvailabilityOptionsCallable(const Model::UpdateAvailabilityOptionsRequest& request) const;
 
+        /**
+         * Same as UpdateAvailabilityOptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateAvailabilityOptionsOutcomeCallable UpdateAvailabilityOptionsCallable(Model::UpdateAvailabilityOptionsRequest&& request) const;
+
         /**
          * <p>Configures the availability options for a domain. Enabling the Multi-AZ
          * option expands an Amazon CloudSearch domain to an additional Availability Zone
@@ -992,6 +1235,11 @@ namespace Model
          */
         virtual void UpdateAvailabilityOptionsAsync(const Model::UpdateAvailabilityOptionsRequest& request, const UpdateAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAvailabilityOptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateAvailabilityOptionsAsync(Model::UpdateAvailabilityOptionsRequest&& request, const UpdateAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures scaling parameters for a domain. A domain's scaling parameters
          * specify the desired search instance type and replication count. Amazon
@@ -1020,6 +1268,11 @@ namespace Model
          */
         virtual Model::UpdateScalingParametersOutcomeCallable UpdateScalingParametersCallable(const Model::UpdateScalingParametersRequest& request) const;
 
+        /**
+         * Same as UpdateScalingParametersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateScalingParametersOutcomeCallable UpdateScalingParametersCallable(Model::UpdateScalingParametersRequest&& request) const;
+
         /**
          * <p>Configures scaling parameters for a domain. A domain's scaling parameters
          * specify the desired search instance type and replication count. Amazon
@@ -1035,6 +1288,11 @@ namespace Model
          */
         virtual void UpdateScalingParametersAsync(const Model::UpdateScalingParametersRequest& request, const UpdateScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateScalingParametersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateScalingParametersAsync(Model::UpdateScalingParametersRequest&& request, const UpdateScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Configures the access rules that control access to the domain's document and
          * search endpoints. For more information, see <a
@@ -1053,6 +1311,11 @@ namespace Model
          */
         virtual Model::UpdateServiceAccessPoliciesOutcomeCallable UpdateServiceAccessPoliciesCallable(const Model::UpdateServiceAccessPoliciesRequest& request) const;
 
+        /**
+         * Same as UpdateServiceAccessPoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateServiceAccessPoliciesOutcomeCallable UpdateServiceAccessPoliciesCallable(Model::UpdateServiceAccessPoliciesRequest&& request) const;
+
         /**
          * <p>Configures the access rules that control access to the domain's document and
          * search endpoints. For more information, see <a
@@ -1063,6 +1326,66 @@ namespace Model
          */
         virtual void UpdateServiceAccessPoliciesAsync(const Model::UpdateServiceAccessPoliciesRequest& request, const UpdateServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateServiceAccessPoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateServiceAccessPoliciesAsync(Model::UpdateServiceAccessPoliciesRequest&& request, const UpdateServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::BuildSuggestersOutcome> BuildSuggestersAwaitable(const Model::BuildSuggestersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::BuildSuggesters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BuildSuggestersOutcome> BuildSuggestersAwaitable(Model::BuildSuggestersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::BuildSuggesters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDomainOutcome> CreateDomainAwaitable(const Model::CreateDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::CreateDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDomainOutcome> CreateDomainAwaitable(Model::CreateDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::CreateDomain, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DefineAnalysisSchemeOutcome> DefineAnalysisSchemeAwaitable(const Model::DefineAnalysisSchemeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DefineAnalysisScheme, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DefineAnalysisSchemeOutcome> DefineAnalysisSchemeAwaitable(Model::DefineAnalysisSchemeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DefineAnalysisScheme, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DefineExpressionOutcome> DefineExpressionAwaitable(const Model::DefineExpressionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DefineExpression, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DefineExpressionOutcome> DefineExpressionAwaitable(Model::DefineExpressionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DefineExpression, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DefineIndexFieldOutcome> DefineIndexFieldAwaitable(const Model::DefineIndexFieldRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DefineIndexField, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DefineIndexFieldOutcome> DefineIndexFieldAwaitable(Model::DefineIndexFieldRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DefineIndexField, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DefineSuggesterOutcome> DefineSuggesterAwaitable(const Model::DefineSuggesterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DefineSuggester, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DefineSuggesterOutcome> DefineSuggesterAwaitable(Model::DefineSuggesterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DefineSuggester, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAnalysisSchemeOutcome> DeleteAnalysisSchemeAwaitable(const Model::DeleteAnalysisSchemeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DeleteAnalysisScheme, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAnalysisSchemeOutcome> DeleteAnalysisSchemeAwaitable(Model::DeleteAnalysisSchemeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DeleteAnalysisScheme, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDomainOutcome> DeleteDomainAwaitable(const Model::DeleteDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DeleteDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDomainOutcome> DeleteDomainAwaitable(Model::DeleteDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DeleteDomain, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteExpressionOutcome> DeleteExpressionAwaitable(const Model::DeleteExpressionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DeleteExpression, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteExpressionOutcome> DeleteExpressionAwaitable(Model::DeleteExpressionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DeleteExpression, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIndexFieldOutcome> DeleteIndexFieldAwaitable(const Model::DeleteIndexFieldRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DeleteIndexField, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIndexFieldOutcome> DeleteIndexFieldAwaitable(Model::DeleteIndexFieldRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DeleteIndexField, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSuggesterOutcome> DeleteSuggesterAwaitable(const Model::DeleteSuggesterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DeleteSuggester, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSuggesterOutcome> DeleteSuggesterAwaitable(Model::DeleteSuggesterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DeleteSuggester, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAnalysisSchemesOutcome> DescribeAnalysisSchemesAwaitable(const Model::DescribeAnalysisSchemesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeAnalysisSchemes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAnalysisSchemesOutcome> DescribeAnalysisSchemesAwaitable(Model::DescribeAnalysisSchemesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeAnalysisSchemes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAvailabilityOptionsOutcome> DescribeAvailabilityOptionsAwaitable(const Model::DescribeAvailabilityOptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeAvailabilityOptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAvailabilityOptionsOutcome> DescribeAvailabilityOptionsAwaitable(Model::DescribeAvailabilityOptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeAvailabilityOptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDomainsOutcome> DescribeDomainsAwaitable(const Model::DescribeDomainsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeDomains, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDomainsOutcome> DescribeDomainsAwaitable(Model::DescribeDomainsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeDomains, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeExpressionsOutcome> DescribeExpressionsAwaitable(const Model::DescribeExpressionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeExpressions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeExpressionsOutcome> DescribeExpressionsAwaitable(Model::DescribeExpressionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeExpressions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeIndexFieldsOutcome> DescribeIndexFieldsAwaitable(const Model::DescribeIndexFieldsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeIndexFields, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeIndexFieldsOutcome> DescribeIndexFieldsAwaitable(Model::DescribeIndexFieldsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeIndexFields, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeScalingParametersOutcome> DescribeScalingParametersAwaitable(const Model::DescribeScalingParametersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeScalingParameters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeScalingParametersOutcome> DescribeScalingParametersAwaitable(Model::DescribeScalingParametersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeScalingParameters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeServiceAccessPoliciesOutcome> DescribeServiceAccessPoliciesAwaitable(const Model::DescribeServiceAccessPoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeServiceAccessPolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeServiceAccessPoliciesOutcome> DescribeServiceAccessPoliciesAwaitable(Model::DescribeServiceAccessPoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeServiceAccessPolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSuggestersOutcome> DescribeSuggestersAwaitable(const Model::DescribeSuggestersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeSuggesters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSuggestersOutcome> DescribeSuggestersAwaitable(Model::DescribeSuggestersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::DescribeSuggesters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::IndexDocumentsOutcome> IndexDocumentsAwaitable(const Model::IndexDocumentsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::IndexDocuments, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::IndexDocumentsOutcome> IndexDocumentsAwaitable(Model::IndexDocumentsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::IndexDocuments, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDomainNamesOutcome> ListDomainNamesAwaitable(const Model::ListDomainNamesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::ListDomainNames, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDomainNamesOutcome> ListDomainNamesAwaitable(Model::ListDomainNamesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::ListDomainNames, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAvailabilityOptionsOutcome> UpdateAvailabilityOptionsAwaitable(const Model::UpdateAvailabilityOptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::UpdateAvailabilityOptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAvailabilityOptionsOutcome> UpdateAvailabilityOptionsAwaitable(Model::UpdateAvailabilityOptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::UpdateAvailabilityOptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateScalingParametersOutcome> UpdateScalingParametersAwaitable(const Model::UpdateScalingParametersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::UpdateScalingParameters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateScalingParametersOutcome> UpdateScalingParametersAwaitable(Model::UpdateScalingParametersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::UpdateScalingParameters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateServiceAccessPoliciesOutcome> UpdateServiceAccessPoliciesAwaitable(const Model::UpdateServiceAccessPoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::UpdateServiceAccessPolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateServiceAccessPoliciesOutcome> UpdateServiceAccessPoliciesAwaitable(Model::UpdateServiceAccessPoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchClient::UpdateServiceAccessPolicies, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -131,12 +131,22 @@ BuildSuggestersOutcome CloudSearchClient::BuildSuggesters(const BuildSuggestersR
 
 BuildSuggestersOutcomeCallable CloudSearchClient::BuildSuggestersCallable(const BuildSuggestersRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::BuildSuggesters, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::BuildSuggesters, Aws::Client::RejectedCallOutcome<BuildSuggestersOutcome>(), this, request);
+}
+
+BuildSuggestersOutcomeCallable CloudSearchClient::BuildSuggestersCallable(BuildSuggestersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::BuildSuggesters, Aws::Client::RejectedCallOutcome<BuildSuggestersOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::BuildSuggestersAsync(const BuildSuggestersRequest& request, const BuildSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::BuildSuggestersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::BuildSuggestersAsyncHelper, Aws::Client::RejectedAsyncCall<BuildSuggestersOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::BuildSuggestersAsync(BuildSuggestersRequest&& request, const BuildSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::BuildSuggestersAsyncHelper, Aws::Client::RejectedAsyncCall<BuildSuggestersOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::BuildSuggestersAsyncHelper(const BuildSuggestersRequest& request, const BuildSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -161,12 +171,22 @@ CreateDomainOutcome CloudSearchClient::CreateDomain(const CreateDomainRequest& r
 
 CreateDomainOutcomeCallable CloudSearchClient::CreateDomainCallable(const CreateDomainRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::CreateDomain, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::CreateDomain, Aws::Client::RejectedCallOutcome<CreateDomainOutcome>(), this, request);
+}
+
+CreateDomainOutcomeCallable CloudSearchClient::CreateDomainCallable(CreateDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::CreateDomain, Aws::Client::RejectedCallOutcome<CreateDomainOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::CreateDomainAsync(const CreateDomainRequest& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::CreateDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::CreateDomainAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDomainOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::CreateDomainAsync(CreateDomainRequest&& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::CreateDomainAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::CreateDomainAsyncHelper(const CreateDomainRequest& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -191,12 +211,22 @@ DefineAnalysisSchemeOutcome CloudSearchClient::DefineAnalysisScheme(const Define
 
 DefineAnalysisSchemeOutcomeCallable CloudSearchClient::DefineAnalysisSchemeCallable(const DefineAnalysisSchemeRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DefineAnalysisScheme, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DefineAnalysisScheme, Aws::Client::RejectedCallOutcome<DefineAnalysisSchemeOutcome>(), this, request);
+}
+
+DefineAnalysisSchemeOutcomeCallable CloudSearchClient::DefineAnalysisSchemeCallable(DefineAnalysisSchemeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DefineAnalysisScheme, Aws::Client::RejectedCallOutcome<DefineAnalysisSchemeOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DefineAnalysisSchemeAsync(const DefineAnalysisSchemeRequest& request, const DefineAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DefineAnalysisSchemeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DefineAnalysisSchemeAsyncHelper, Aws::Client::RejectedAsyncCall<DefineAnalysisSchemeOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DefineAnalysisSchemeAsync(DefineAnalysisSchemeRequest&& request, const DefineAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DefineAnalysisSchemeAsyncHelper, Aws::Client::RejectedAsyncCall<DefineAnalysisSchemeOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DefineAnalysisSchemeAsyncHelper(const DefineAnalysisSchemeRequest& request, const DefineAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -221,12 +251,22 @@ DefineExpressionOutcome CloudSearchClient::DefineExpression(const DefineExpressi
 
 DefineExpressionOutcomeCallable CloudSearchClient::DefineExpressionCallable(const DefineExpressionRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DefineExpression, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DefineExpression, Aws::Client::RejectedCallOutcome<DefineExpressionOutcome>(), this, request);
+}
+
+DefineExpressionOutcomeCallable CloudSearchClient::DefineExpressionCallable(DefineExpressionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DefineExpression, Aws::Client::RejectedCallOutcome<DefineExpressionOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DefineExpressionAsync(const DefineExpressionRequest& request, const DefineExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DefineExpressionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DefineExpressionAsyncHelper, Aws::Client::RejectedAsyncCall<DefineExpressionOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DefineExpressionAsync(DefineExpressionRequest&& request, const DefineExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DefineExpressionAsyncHelper, Aws::Client::RejectedAsyncCall<DefineExpressionOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DefineExpressionAsyncHelper(const DefineExpressionRequest& request, const DefineExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -251,12 +291,22 @@ DefineIndexFieldOutcome CloudSearchClient::DefineIndexField(const DefineIndexFie
 
 DefineIndexFieldOutcomeCallable CloudSearchClient::DefineIndexFieldCallable(const DefineIndexFieldRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DefineIndexField, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DefineIndexField, Aws::Client::RejectedCallOutcome<DefineIndexFieldOutcome>(), this, request);
+}
+
+DefineIndexFieldOutcomeCallable CloudSearchClient::DefineIndexFieldCallable(DefineIndexFieldRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DefineIndexField, Aws::Client::RejectedCallOutcome<DefineIndexFieldOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DefineIndexFieldAsync(const DefineIndexFieldRequest& request, const DefineIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DefineIndexFieldAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DefineIndexFieldAsyncHelper, Aws::Client::RejectedAsyncCall<DefineIndexFieldOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DefineIndexFieldAsync(DefineIndexFieldRequest&& request, const DefineIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DefineIndexFieldAsyncHelper, Aws::Client::RejectedAsyncCall<DefineIndexFieldOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DefineIndexFieldAsyncHelper(const DefineIndexFieldRequest& request, const DefineIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -281,12 +331,22 @@ DefineSuggesterOutcome CloudSearchClient::DefineSuggester(const DefineSuggesterR
 
 DefineSuggesterOutcomeCallable CloudSearchClient::DefineSuggesterCallable(const DefineSuggesterRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DefineSuggester, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DefineSuggester, Aws::Client::RejectedCallOutcome<DefineSuggesterOutcome>(), this, request);
+}
+
+DefineSuggesterOutcomeCallable CloudSearchClient::DefineSuggesterCallable(DefineSuggesterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DefineSuggester, Aws::Client::RejectedCallOutcome<DefineSuggesterOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DefineSuggesterAsync(const DefineSuggesterRequest& request, const DefineSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DefineSuggesterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DefineSuggesterAsyncHelper, Aws::Client::RejectedAsyncCall<DefineSuggesterOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DefineSuggesterAsync(DefineSuggesterRequest&& request, const DefineSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DefineSuggesterAsyncHelper, Aws::Client::RejectedAsyncCall<DefineSuggesterOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DefineSuggesterAsyncHelper(const DefineSuggesterRequest& request, const DefineSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -311,12 +371,22 @@ DeleteAnalysisSchemeOutcome CloudSearchClient::DeleteAnalysisScheme(const Delete
 
 DeleteAnalysisSchemeOutcomeCallable CloudSearchClient::DeleteAnalysisSchemeCallable(const DeleteAnalysisSchemeRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DeleteAnalysisScheme, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DeleteAnalysisScheme, Aws::Client::RejectedCallOutcome<DeleteAnalysisSchemeOutcome>(), this, request);
+}
+
+DeleteAnalysisSchemeOutcomeCallable CloudSearchClient::DeleteAnalysisSchemeCallable(DeleteAnalysisSchemeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DeleteAnalysisScheme, Aws::Client::RejectedCallOutcome<DeleteAnalysisSchemeOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DeleteAnalysisSchemeAsync(const DeleteAnalysisSchemeRequest& request, const DeleteAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DeleteAnalysisSchemeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DeleteAnalysisSchemeAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAnalysisSchemeOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DeleteAnalysisSchemeAsync(DeleteAnalysisSchemeRequest&& request, const DeleteAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DeleteAnalysisSchemeAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAnalysisSchemeOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DeleteAnalysisSchemeAsyncHelper(const DeleteAnalysisSchemeRequest& request, const DeleteAnalysisSchemeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -341,12 +411,22 @@ DeleteDomainOutcome CloudSearchClient::DeleteDomain(const DeleteDomainRequest& r
 
 DeleteDomainOutcomeCallable CloudSearchClient::DeleteDomainCallable(const DeleteDomainRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DeleteDomain, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DeleteDomain, Aws::Client::RejectedCallOutcome<DeleteDomainOutcome>(), this, request);
+}
+
+DeleteDomainOutcomeCallable CloudSearchClient::DeleteDomainCallable(DeleteDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DeleteDomain, Aws::Client::RejectedCallOutcome<DeleteDomainOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DeleteDomainAsync(const DeleteDomainRequest& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DeleteDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DeleteDomainAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDomainOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DeleteDomainAsync(DeleteDomainRequest&& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DeleteDomainAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DeleteDomainAsyncHelper(const DeleteDomainRequest& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -371,12 +451,22 @@ DeleteExpressionOutcome CloudSearchClient::DeleteExpression(const DeleteExpressi
 
 DeleteExpressionOutcomeCallable CloudSearchClient::DeleteExpressionCallable(const DeleteExpressionRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DeleteExpression, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DeleteExpression, Aws::Client::RejectedCallOutcome<DeleteExpressionOutcome>(), this, request);
+}
+
+DeleteExpressionOutcomeCallable CloudSearchClient::DeleteExpressionCallable(DeleteExpressionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DeleteExpression, Aws::Client::RejectedCallOutcome<DeleteExpressionOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DeleteExpressionAsync(const DeleteExpressionRequest& request, const DeleteExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DeleteExpressionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DeleteExpressionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteExpressionOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DeleteExpressionAsync(DeleteExpressionRequest&& request, const DeleteExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DeleteExpressionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteExpressionOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DeleteExpressionAsyncHelper(const DeleteExpressionRequest& request, const DeleteExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -401,12 +491,22 @@ DeleteIndexFieldOutcome CloudSearchClient::DeleteIndexField(const DeleteIndexFie
 
 DeleteIndexFieldOutcomeCallable CloudSearchClient::DeleteIndexFieldCallable(const DeleteIndexFieldRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DeleteIndexField, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DeleteIndexField, Aws::Client::RejectedCallOutcome<DeleteIndexFieldOutcome>(), this, request);
+}
+
+DeleteIndexFieldOutcomeCallable CloudSearchClient::DeleteIndexFieldCallable(DeleteIndexFieldRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DeleteIndexField, Aws::Client::RejectedCallOutcome<DeleteIndexFieldOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DeleteIndexFieldAsync(const DeleteIndexFieldRequest& request, const DeleteIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DeleteIndexFieldAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DeleteIndexFieldAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIndexFieldOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DeleteIndexFieldAsync(DeleteIndexFieldRequest&& request, const DeleteIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DeleteIndexFieldAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIndexFieldOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DeleteIndexFieldAsyncHelper(const DeleteIndexFieldRequest& request, const DeleteIndexFieldResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -431,12 +531,22 @@ DeleteSuggesterOutcome CloudSearchClient::DeleteSuggester(const DeleteSuggesterR
 
 DeleteSuggesterOutcomeCallable CloudSearchClient::DeleteSuggesterCallable(const DeleteSuggesterRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DeleteSuggester, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DeleteSuggester, Aws::Client::RejectedCallOutcome<DeleteSuggesterOutcome>(), this, request);
+}
+
+DeleteSuggesterOutcomeCallable CloudSearchClient::DeleteSuggesterCallable(DeleteSuggesterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DeleteSuggester, Aws::Client::RejectedCallOutcome<DeleteSuggesterOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DeleteSuggesterAsync(const DeleteSuggesterRequest& request, const DeleteSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DeleteSuggesterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DeleteSuggesterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSuggesterOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DeleteSuggesterAsync(DeleteSuggesterRequest&& request, const DeleteSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DeleteSuggesterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSuggesterOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DeleteSuggesterAsyncHelper(const DeleteSuggesterRequest& request, const DeleteSuggesterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -461,12 +571,22 @@ DescribeAnalysisSchemesOutcome CloudSearchClient::DescribeAnalysisSchemes(const
 
 DescribeAnalysisSchemesOutcomeCallable CloudSearchClient::DescribeAnalysisSchemesCallable(const DescribeAnalysisSchemesRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DescribeAnalysisSchemes, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeAnalysisSchemes, Aws::Client::RejectedCallOutcome<DescribeAnalysisSchemesOutcome>(), this, request);
+}
+
+DescribeAnalysisSchemesOutcomeCallable CloudSearchClient::DescribeAnalysisSchemesCallable(DescribeAnalysisSchemesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeAnalysisSchemes, Aws::Client::RejectedCallOutcome<DescribeAnalysisSchemesOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DescribeAnalysisSchemesAsync(const DescribeAnalysisSchemesRequest& request, const DescribeAnalysisSchemesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DescribeAnalysisSchemesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeAnalysisSchemesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAnalysisSchemesOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DescribeAnalysisSchemesAsync(DescribeAnalysisSchemesRequest&& request, const DescribeAnalysisSchemesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeAnalysisSchemesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAnalysisSchemesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DescribeAnalysisSchemesAsyncHelper(const DescribeAnalysisSchemesRequest& request, const DescribeAnalysisSchemesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -491,12 +611,22 @@ DescribeAvailabilityOptionsOutcome CloudSearchClient::DescribeAvailabilityOption
 
 DescribeAvailabilityOptionsOutcomeCallable CloudSearchClient::DescribeAvailabilityOptionsCallable(const DescribeAvailabilityOptionsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DescribeAvailabilityOptions, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeAvailabilityOptions, Aws::Client::RejectedCallOutcome<DescribeAvailabilityOptionsOutcome>(), this, request);
+}
+
+DescribeAvailabilityOptionsOutcomeCallable CloudSearchClient::DescribeAvailabilityOptionsCallable(DescribeAvailabilityOptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeAvailabilityOptions, Aws::Client::RejectedCallOutcome<DescribeAvailabilityOptionsOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DescribeAvailabilityOptionsAsync(const DescribeAvailabilityOptionsRequest& request, const DescribeAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DescribeAvailabilityOptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeAvailabilityOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAvailabilityOptionsOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DescribeAvailabilityOptionsAsync(DescribeAvailabilityOptionsRequest&& request, const DescribeAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeAvailabilityOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAvailabilityOptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DescribeAvailabilityOptionsAsyncHelper(const DescribeAvailabilityOptionsRequest& request, const DescribeAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -521,12 +651,22 @@ DescribeDomainsOutcome CloudSearchClient::DescribeDomains(const DescribeDomainsR
 
 DescribeDomainsOutcomeCallable CloudSearchClient::DescribeDomainsCallable(const DescribeDomainsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DescribeDomains, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeDomains, Aws::Client::RejectedCallOutcome<DescribeDomainsOutcome>(), this, request);
+}
+
+DescribeDomainsOutcomeCallable CloudSearchClient::DescribeDomainsCallable(DescribeDomainsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeDomains, Aws::Client::RejectedCallOutcome<DescribeDomainsOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DescribeDomainsAsync(const DescribeDomainsRequest& request, const DescribeDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DescribeDomainsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeDomainsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDomainsOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DescribeDomainsAsync(DescribeDomainsRequest&& request, const DescribeDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeDomainsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDomainsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DescribeDomainsAsyncHelper(const DescribeDomainsRequest& request, const DescribeDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -551,12 +691,22 @@ DescribeExpressionsOutcome CloudSearchClient::DescribeExpressions(const Describe
 
 DescribeExpressionsOutcomeCallable CloudSearchClient::DescribeExpressionsCallable(const DescribeExpressionsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DescribeExpressions, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeExpressions, Aws::Client::RejectedCallOutcome<DescribeExpressionsOutcome>(), this, request);
+}
+
+DescribeExpressionsOutcomeCallable CloudSearchClient::DescribeExpressionsCallable(DescribeExpressionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeExpressions, Aws::Client::RejectedCallOutcome<DescribeExpressionsOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DescribeExpressionsAsync(const DescribeExpressionsRequest& request, const DescribeExpressionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DescribeExpressionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeExpressionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeExpressionsOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DescribeExpressionsAsync(DescribeExpressionsRequest&& request, const DescribeExpressionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeExpressionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeExpressionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DescribeExpressionsAsyncHelper(const DescribeExpressionsRequest& request, const DescribeExpressionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -581,12 +731,22 @@ DescribeIndexFieldsOutcome CloudSearchClient::DescribeIndexFields(const Describe
 
 DescribeIndexFieldsOutcomeCallable CloudSearchClient::DescribeIndexFieldsCallable(const DescribeIndexFieldsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DescribeIndexFields, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeIndexFields, Aws::Client::RejectedCallOutcome<DescribeIndexFieldsOutcome>(), this, request);
+}
+
+DescribeIndexFieldsOutcomeCallable CloudSearchClient::DescribeIndexFieldsCallable(DescribeIndexFieldsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeIndexFields, Aws::Client::RejectedCallOutcome<DescribeIndexFieldsOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DescribeIndexFieldsAsync(const DescribeIndexFieldsRequest& request, const DescribeIndexFieldsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DescribeIndexFieldsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeIndexFieldsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeIndexFieldsOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DescribeIndexFieldsAsync(DescribeIndexFieldsRequest&& request, const DescribeIndexFieldsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeIndexFieldsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeIndexFieldsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DescribeIndexFieldsAsyncHelper(const DescribeIndexFieldsRequest& request, const DescribeIndexFieldsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -611,12 +771,22 @@ DescribeScalingParametersOutcome CloudSearchClient::DescribeScalingParameters(co
 
 DescribeScalingParametersOutcomeCallable CloudSearchClient::DescribeScalingParametersCallable(const DescribeScalingParametersRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DescribeScalingParameters, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeScalingParameters, Aws::Client::RejectedCallOutcome<DescribeScalingParametersOutcome>(), this, request);
+}
+
+DescribeScalingParametersOutcomeCallable CloudSearchClient::DescribeScalingParametersCallable(DescribeScalingParametersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeScalingParameters, Aws::Client::RejectedCallOutcome<DescribeScalingParametersOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DescribeScalingParametersAsync(const DescribeScalingParametersRequest& request, const DescribeScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DescribeScalingParametersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeScalingParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeScalingParametersOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DescribeScalingParametersAsync(DescribeScalingParametersRequest&& request, const DescribeScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeScalingParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeScalingParametersOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DescribeScalingParametersAsyncHelper(const DescribeScalingParametersRequest& request, const DescribeScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -641,12 +811,22 @@ DescribeServiceAccessPoliciesOutcome CloudSearchClient::DescribeServiceAccessPol
 
 DescribeServiceAccessPoliciesOutcomeCallable CloudSearchClient::DescribeServiceAccessPoliciesCallable(const DescribeServiceAccessPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DescribeServiceAccessPolicies, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeServiceAccessPolicies, Aws::Client::RejectedCallOutcome<DescribeServiceAccessPoliciesOutcome>(), this, request);
+}
+
+DescribeServiceAccessPoliciesOutcomeCallable CloudSearchClient::DescribeServiceAccessPoliciesCallable(DescribeServiceAccessPoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeServiceAccessPolicies, Aws::Client::RejectedCallOutcome<DescribeServiceAccessPoliciesOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DescribeServiceAccessPoliciesAsync(const DescribeServiceAccessPoliciesRequest& request, const DescribeServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DescribeServiceAccessPoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeServiceAccessPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeServiceAccessPoliciesOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DescribeServiceAccessPoliciesAsync(DescribeServiceAccessPoliciesRequest&& request, const DescribeServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeServiceAccessPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeServiceAccessPoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DescribeServiceAccessPoliciesAsyncHelper(const DescribeServiceAccessPoliciesRequest& request, const DescribeServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -671,12 +851,22 @@ DescribeSuggestersOutcome CloudSearchClient::DescribeSuggesters(const DescribeSu
 
 DescribeSuggestersOutcomeCallable CloudSearchClient::DescribeSuggestersCallable(const DescribeSuggestersRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::DescribeSuggesters, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeSuggesters, Aws::Client::RejectedCallOutcome<DescribeSuggestersOutcome>(), this, request);
+}
+
+DescribeSuggestersOutcomeCallable CloudSearchClient::DescribeSuggestersCallable(DescribeSuggestersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::DescribeSuggesters, Aws::Client::RejectedCallOutcome<DescribeSuggestersOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::DescribeSuggestersAsync(const DescribeSuggestersRequest& request, const DescribeSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::DescribeSuggestersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeSuggestersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSuggestersOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::DescribeSuggestersAsync(DescribeSuggestersRequest&& request, const DescribeSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::DescribeSuggestersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSuggestersOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::DescribeSuggestersAsyncHelper(const DescribeSuggestersRequest& request, const DescribeSuggestersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -701,12 +891,22 @@ IndexDocumentsOutcome CloudSearchClient::IndexDocuments(const IndexDocumentsRequ
 
 IndexDocumentsOutcomeCallable CloudSearchClient::IndexDocumentsCallable(const IndexDocumentsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::IndexDocuments, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::IndexDocuments, Aws::Client::RejectedCallOutcome<IndexDocumentsOutcome>(), this, request);
+}
+
+IndexDocumentsOutcomeCallable CloudSearchClient::IndexDocumentsCallable(IndexDocumentsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::IndexDocuments, Aws::Client::RejectedCallOutcome<IndexDocumentsOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::IndexDocumentsAsync(const IndexDocumentsRequest& request, const IndexDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::IndexDocumentsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::IndexDocumentsAsyncHelper, Aws::Client::RejectedAsyncCall<IndexDocumentsOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::IndexDocumentsAsync(IndexDocumentsRequest&& request, const IndexDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::IndexDocumentsAsyncHelper, Aws::Client::RejectedAsyncCall<IndexDocumentsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::IndexDocumentsAsyncHelper(const IndexDocumentsRequest& request, const IndexDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -731,12 +931,22 @@ ListDomainNamesOutcome CloudSearchClient::ListDomainNames(const ListDomainNamesR
 
 ListDomainNamesOutcomeCallable CloudSearchClient::ListDomainNamesCallable(const ListDomainNamesRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::ListDomainNames, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::ListDomainNames, Aws::Client::RejectedCallOutcome<ListDomainNamesOutcome>(), this, request);
+}
+
+ListDomainNamesOutcomeCallable CloudSearchClient::ListDomainNamesCallable(ListDomainNamesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::ListDomainNames, Aws::Client::RejectedCallOutcome<ListDomainNamesOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::ListDomainNamesAsync(const ListDomainNamesRequest& request, const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::ListDomainNamesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::ListDomainNamesAsyncHelper, Aws::Client::RejectedAsyncCall<ListDomainNamesOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::ListDomainNamesAsync(ListDomainNamesRequest&& request, const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::ListDomainNamesAsyncHelper, Aws::Client::RejectedAsyncCall<ListDomainNamesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::ListDomainNamesAsyncHelper(const ListDomainNamesRequest& request, const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -761,12 +971,22 @@ UpdateAvailabilityOptionsOutcome CloudSearchClient::UpdateAvailabilityOptions(co
 
 UpdateAvailabilityOptionsOutcomeCallable CloudSearchClient::UpdateAvailabilityOptionsCallable(const UpdateAvailabilityOptionsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::UpdateAvailabilityOptions, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::UpdateAvailabilityOptions, Aws::Client::RejectedCallOutcome<UpdateAvailabilityOptionsOutcome>(), this, request);
+}
+
+UpdateAvailabilityOptionsOutcomeCallable CloudSearchClient::UpdateAvailabilityOptionsCallable(UpdateAvailabilityOptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::UpdateAvailabilityOptions, Aws::Client::RejectedCallOutcome<UpdateAvailabilityOptionsOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::UpdateAvailabilityOptionsAsync(const UpdateAvailabilityOptionsRequest& request, const UpdateAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::UpdateAvailabilityOptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::UpdateAvailabilityOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAvailabilityOptionsOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::UpdateAvailabilityOptionsAsync(UpdateAvailabilityOptionsRequest&& request, const UpdateAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::UpdateAvailabilityOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAvailabilityOptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::UpdateAvailabilityOptionsAsyncHelper(const UpdateAvailabilityOptionsRequest& request, const UpdateAvailabilityOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -791,12 +1011,22 @@ UpdateScalingParametersOutcome CloudSearchClient::UpdateScalingParameters(const
 
 UpdateScalingParametersOutcomeCallable CloudSearchClient::UpdateScalingParametersCallable(const UpdateScalingParametersRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::UpdateScalingParameters, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::UpdateScalingParameters, Aws::Client::RejectedCallOutcome<UpdateScalingParametersOutcome>(), this, request);
+}
+
+UpdateScalingParametersOutcomeCallable CloudSearchClient::UpdateScalingParametersCallable(UpdateScalingParametersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::UpdateScalingParameters, Aws::Client::RejectedCallOutcome<UpdateScalingParametersOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::UpdateScalingParametersAsync(const UpdateScalingParametersRequest& request, const UpdateScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::UpdateScalingParametersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::UpdateScalingParametersAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateScalingParametersOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::UpdateScalingParametersAsync(UpdateScalingParametersRequest&& request, const UpdateScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::UpdateScalingParametersAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateScalingParametersOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::UpdateScalingParametersAsyncHelper(const UpdateScalingParametersRequest& request, const UpdateScalingParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -821,12 +1051,22 @@ UpdateServiceAccessPoliciesOutcome CloudSearchClient::UpdateServiceAccessPolicie
 
 UpdateServiceAccessPoliciesOutcomeCallable CloudSearchClient::UpdateServiceAccessPoliciesCallable(const UpdateServiceAccessPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchClient::UpdateServiceAccessPolicies, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchClient::UpdateServiceAccessPolicies, Aws::Client::RejectedCallOutcome<UpdateServiceAccessPoliciesOutcome>(), this, request);
+}
+
+UpdateServiceAccessPoliciesOutcomeCallable CloudSearchClient::UpdateServiceAccessPoliciesCallable(UpdateServiceAccessPoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchClient::UpdateServiceAccessPolicies, Aws::Client::RejectedCallOutcome<UpdateServiceAccessPoliciesOutcome>(), this, std::move(request));
 }
 
 void CloudSearchClient::UpdateServiceAccessPoliciesAsync(const UpdateServiceAccessPoliciesRequest& request, const UpdateServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchClient::UpdateServiceAccessPoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchClient::UpdateServiceAccessPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateServiceAccessPoliciesOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchClient::UpdateServiceAccessPoliciesAsync(UpdateServiceAccessPoliciesRequest&& request, const UpdateServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchClient::UpdateServiceAccessPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateServiceAccessPoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchClient::UpdateServiceAccessPoliciesAsyncHelper(const UpdateServiceAccessPoliciesRequest& request, const UpdateServiceAccessPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -25,6 +25,13 @@
 #include <aws/cloudsearchdomain/model/UploadDocumentsResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/cloudsearchdomain/model/SearchRequest.h>
+#include <aws/cloudsearchdomain/model/SuggestRequest.h>
+#include <aws/cloudsearchdomain/model/UploadDocumentsRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -174,6 +181,11 @@ namespace Model
          */
         virtual Model::SearchOutcomeCallable SearchCallable(const Model::SearchRequest& request) const;
 
+        /**
+         * Same as SearchCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SearchOutcomeCallable SearchCallable(Model::SearchRequest&& request) const;
+
         /**
          * <p>Retrieves a list of documents that match the specified search criteria. How
          * you specify the search criteria depends on which query parser you use. Amazon
@@ -199,6 +211,11 @@ namespace Model
          */
         virtual void SearchAsync(const Model::SearchRequest& request, const SearchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SearchAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SearchAsync(Model::SearchRequest&& request, const SearchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves autocomplete suggestions for a partial query string. You can use
          * suggestions enable you to display likely matches before users finish typing. In
@@ -239,6 +256,11 @@ namespace Model
          */
         virtual Model::SuggestOutcomeCallable SuggestCallable(const Model::SuggestRequest& request) const;
 
+        /**
+         * Same as SuggestCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SuggestOutcomeCallable SuggestCallable(Model::SuggestRequest&& request) const;
+
         /**
          * <p>Retrieves autocomplete suggestions for a partial query string. You can use
          * suggestions enable you to display likely matches before users finish typing. In
@@ -260,6 +282,11 @@ namespace Model
          */
         virtual void SuggestAsync(const Model::SuggestRequest& request, const SuggestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SuggestAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SuggestAsync(Model::SuggestRequest&& request, const SuggestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Posts a batch of documents to a search domain for indexing. A document batch
          * is a collection of add and delete operations that represent the documents you
@@ -312,6 +339,11 @@ namespace Model
          */
         virtual Model::UploadDocumentsOutcomeCallable UploadDocumentsCallable(const Model::UploadDocumentsRequest& request) const;
 
+        /**
+         * Same as UploadDocumentsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UploadDocumentsOutcomeCallable UploadDocumentsCallable(Model::UploadDocumentsRequest&& request) const;
+
         /**
          * <p>Posts a batch of documents to a search domain for indexing. A document batch
          * is a collection of add and delete operations that represent the documents you
@@ -339,6 +371,24 @@ namespace Model
          */
         virtual void UploadDocumentsAsync(const Model::UploadDocumentsRequest& request, const UploadDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadDocumentsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UploadDocumentsAsync(Model::UploadDocumentsRequest&& request, const UploadDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::SearchOutcome> SearchAwaitable(const Model::SearchRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchDomainClient::Search, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SearchOutcome> SearchAwaitable(Model::SearchRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchDomainClient::Search, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SuggestOutcome> SuggestAwaitable(const Model::SuggestRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchDomainClient::Suggest, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SuggestOutcome> SuggestAwaitable(Model::SuggestRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchDomainClient::Suggest, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadDocumentsOutcome> UploadDocumentsAwaitable(const Model::UploadDocumentsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchDomainClient::UploadDocuments, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadDocumentsOutcome> UploadDocumentsAwaitable(Model::UploadDocumentsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudSearchDomainClient::UploadDocuments, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
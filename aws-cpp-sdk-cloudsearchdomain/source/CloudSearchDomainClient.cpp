@@ -110,12 +110,22 @@ SearchOutcome CloudSearchDomainClient::Search(const SearchRequest& request) cons
 
 SearchOutcomeCallable CloudSearchDomainClient::SearchCallable(const SearchRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchDomainClient::Search, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchDomainClient::Search, Aws::Client::RejectedCallOutcome<SearchOutcome>(), this, request);
+}
+
+SearchOutcomeCallable CloudSearchDomainClient::SearchCallable(SearchRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchDomainClient::Search, Aws::Client::RejectedCallOutcome<SearchOutcome>(), this, std::move(request));
 }
 
 void CloudSearchDomainClient::SearchAsync(const SearchRequest& request, const SearchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchDomainClient::SearchAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchDomainClient::SearchAsyncHelper, Aws::Client::RejectedAsyncCall<SearchOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchDomainClient::SearchAsync(SearchRequest&& request, const SearchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchDomainClient::SearchAsyncHelper, Aws::Client::RejectedAsyncCall<SearchOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchDomainClient::SearchAsyncHelper(const SearchRequest& request, const SearchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -141,12 +151,22 @@ SuggestOutcome CloudSearchDomainClient::Suggest(const SuggestRequest& request) c
 
 SuggestOutcomeCallable CloudSearchDomainClient::SuggestCallable(const SuggestRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchDomainClient::Suggest, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchDomainClient::Suggest, Aws::Client::RejectedCallOutcome<SuggestOutcome>(), this, request);
+}
+
+SuggestOutcomeCallable CloudSearchDomainClient::SuggestCallable(SuggestRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchDomainClient::Suggest, Aws::Client::RejectedCallOutcome<SuggestOutcome>(), this, std::move(request));
 }
 
 void CloudSearchDomainClient::SuggestAsync(const SuggestRequest& request, const SuggestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchDomainClient::SuggestAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchDomainClient::SuggestAsyncHelper, Aws::Client::RejectedAsyncCall<SuggestOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchDomainClient::SuggestAsync(SuggestRequest&& request, const SuggestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchDomainClient::SuggestAsyncHelper, Aws::Client::RejectedAsyncCall<SuggestOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchDomainClient::SuggestAsyncHelper(const SuggestRequest& request, const SuggestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -172,12 +192,22 @@ UploadDocumentsOutcome CloudSearchDomainClient::UploadDocuments(const UploadDocu
 
 UploadDocumentsOutcomeCallable CloudSearchDomainClient::UploadDocumentsCallable(const UploadDocumentsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudSearchDomainClient::UploadDocuments, this, request);
+  return m_executor->SubmitWithFuture(&CloudSearchDomainClient::UploadDocuments, Aws::Client::RejectedCallOutcome<UploadDocumentsOutcome>(), this, request);
+}
+
+UploadDocumentsOutcomeCallable CloudSearchDomainClient::UploadDocumentsCallable(UploadDocumentsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudSearchDomainClient::UploadDocuments, Aws::Client::RejectedCallOutcome<UploadDocumentsOutcome>(), this, std::move(request));
 }
 
 void CloudSearchDomainClient::UploadDocumentsAsync(const UploadDocumentsRequest& request, const UploadDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudSearchDomainClient::UploadDocumentsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudSearchDomainClient::UploadDocumentsAsyncHelper, Aws::Client::RejectedAsyncCall<UploadDocumentsOutcome>(), this, request, handler, context);
+}
+
+void CloudSearchDomainClient::UploadDocumentsAsync(UploadDocumentsRequest&& request, const UploadDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudSearchDomainClient::UploadDocumentsAsyncHelper, Aws::Client::RejectedAsyncCall<UploadDocumentsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudSearchDomainClient::UploadDocumentsAsyncHelper(const UploadDocumentsRequest& request, const UploadDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
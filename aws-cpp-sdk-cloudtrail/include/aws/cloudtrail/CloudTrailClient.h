@@ -34,6 +34,22 @@
 #include <aws/cloudtrail/model/UpdateTrailResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/cloudtrail/model/AddTagsRequest.h>
+#include <aws/cloudtrail/model/CreateTrailRequest.h>
+#include <aws/cloudtrail/model/DeleteTrailRequest.h>
+#include <aws/cloudtrail/model/DescribeTrailsRequest.h>
+#include <aws/cloudtrail/model/GetTrailStatusRequest.h>
+#include <aws/cloudtrail/model/ListPublicKeysRequest.h>
+#include <aws/cloudtrail/model/ListTagsRequest.h>
+#include <aws/cloudtrail/model/LookupEventsRequest.h>
+#include <aws/cloudtrail/model/RemoveTagsRequest.h>
+#include <aws/cloudtrail/model/StartLoggingRequest.h>
+#include <aws/cloudtrail/model/StopLoggingRequest.h>
+#include <aws/cloudtrail/model/UpdateTrailRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -199,6 +215,11 @@ namespace Model
          */
         virtual Model::AddTagsOutcomeCallable AddTagsCallable(const Model::AddTagsRequest& request) const;
 
+        /**
+         * Same as AddTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddTagsOutcomeCallable AddTagsCallable(Model::AddTagsRequest&& request) const;
+
         /**
          * <p>Adds one or more tags to a trail, up to a limit of 10. Tags must be unique
          * per trail. Overwrites an existing tag's value when a new value is specified for
@@ -211,6 +232,11 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddTagsAsync(Model::AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a trail that specifies the settings for delivery of log data to an
          * Amazon S3 bucket. A maximum of five trails can exist in a region, irrespective
@@ -227,6 +253,11 @@ namespace Model
          */
         virtual Model::CreateTrailOutcomeCallable CreateTrailCallable(const Model::CreateTrailRequest& request) const;
 
+        /**
+         * Same as CreateTrailCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateTrailOutcomeCallable CreateTrailCallable(Model::CreateTrailRequest&& request) const;
+
         /**
          * <p>Creates a trail that specifies the settings for delivery of log data to an
          * Amazon S3 bucket. A maximum of five trails can exist in a region, irrespective
@@ -236,6 +267,11 @@ namespace Model
          */
         virtual void CreateTrailAsync(const Model::CreateTrailRequest& request, const CreateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTrailAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateTrailAsync(Model::CreateTrailRequest&& request, const CreateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a trail. This operation must be called from the region in which the
          * trail was created. <code>DeleteTrail</code> cannot be called on the shadow
@@ -254,6 +290,11 @@ namespace Model
          */
         virtual Model::DeleteTrailOutcomeCallable DeleteTrailCallable(const Model::DeleteTrailRequest& request) const;
 
+        /**
+         * Same as DeleteTrailCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteTrailOutcomeCallable DeleteTrailCallable(Model::DeleteTrailRequest&& request) const;
+
         /**
          * <p>Deletes a trail. This operation must be called from the region in which the
          * trail was created. <code>DeleteTrail</code> cannot be called on the shadow
@@ -264,6 +305,11 @@ namespace Model
          */
         virtual void DeleteTrailAsync(const Model::DeleteTrailRequest& request, const DeleteTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTrailAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteTrailAsync(Model::DeleteTrailRequest&& request, const DeleteTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves settings for the trail associated with the current region for your
          * account.</p>
@@ -278,6 +324,11 @@ namespace Model
          */
         virtual Model::DescribeTrailsOutcomeCallable DescribeTrailsCallable(const Model::DescribeTrailsRequest& request) const;
 
+        /**
+         * Same as DescribeTrailsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTrailsOutcomeCallable DescribeTrailsCallable(Model::DescribeTrailsRequest&& request) const;
+
         /**
          * <p>Retrieves settings for the trail associated with the current region for your
          * account.</p>
@@ -286,6 +337,11 @@ namespace Model
          */
         virtual void DescribeTrailsAsync(const Model::DescribeTrailsRequest& request, const DescribeTrailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTrailsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTrailsAsync(Model::DescribeTrailsRequest&& request, const DescribeTrailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a JSON-formatted list of information about the specified trail.
          * Fields include information on delivery errors, Amazon SNS and Amazon S3 errors,
@@ -306,6 +362,11 @@ namespace Model
          */
         virtual Model::GetTrailStatusOutcomeCallable GetTrailStatusCallable(const Model::GetTrailStatusRequest& request) const;
 
+        /**
+         * Same as GetTrailStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetTrailStatusOutcomeCallable GetTrailStatusCallable(Model::GetTrailStatusRequest&& request) const;
+
         /**
          * <p>Returns a JSON-formatted list of information about the specified trail.
          * Fields include information on delivery errors, Amazon SNS and Amazon S3 errors,
@@ -317,6 +378,11 @@ namespace Model
          */
         virtual void GetTrailStatusAsync(const Model::GetTrailStatusRequest& request, const GetTrailStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTrailStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetTrailStatusAsync(Model::GetTrailStatusRequest&& request, const GetTrailStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns all public keys whose private keys were used to sign the digest files
          * within the specified time range. The public key is needed to validate digest
@@ -341,6 +407,11 @@ namespace Model
          */
         virtual Model::ListPublicKeysOutcomeCallable ListPublicKeysCallable(const Model::ListPublicKeysRequest& request) const;
 
+        /**
+         * Same as ListPublicKeysCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListPublicKeysOutcomeCallable ListPublicKeysCallable(Model::ListPublicKeysRequest&& request) const;
+
         /**
          * <p>Returns all public keys whose private keys were used to sign the digest files
          * within the specified time range. The public key is needed to validate digest
@@ -354,6 +425,11 @@ namespace Model
          */
         virtual void ListPublicKeysAsync(const Model::ListPublicKeysRequest& request, const ListPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPublicKeysAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListPublicKeysAsync(Model::ListPublicKeysRequest&& request, const ListPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the tags for the specified trail or trails in the current region.</p>
          * <p>Lists the tags for the trail in the current region.</p>
@@ -368,6 +444,11 @@ namespace Model
          */
         virtual Model::ListTagsOutcomeCallable ListTagsCallable(const Model::ListTagsRequest& request) const;
 
+        /**
+         * Same as ListTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTagsOutcomeCallable ListTagsCallable(Model::ListTagsRequest&& request) const;
+
         /**
          * <p>Lists the tags for the specified trail or trails in the current region.</p>
          * <p>Lists the tags for the trail in the current region.</p>
@@ -376,6 +457,11 @@ namespace Model
          */
         virtual void ListTagsAsync(const Model::ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTagsAsync(Model::ListTagsRequest&& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Looks up API activity events captured by CloudTrail that create, update, or
          * delete resources in your account. Events for a region can be looked up for the
@@ -414,6 +500,11 @@ namespace Model
          */
         virtual Model::LookupEventsOutcomeCallable LookupEventsCallable(const Model::LookupEventsRequest& request) const;
 
+        /**
+         * Same as LookupEventsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::LookupEventsOutcomeCallable LookupEventsCallable(Model::LookupEventsRequest&& request) const;
+
         /**
          * <p>Looks up API activity events captured by CloudTrail that create, update, or
          * delete resources in your account. Events for a region can be looked up for the
@@ -434,6 +525,11 @@ namespace Model
          */
         virtual void LookupEventsAsync(const Model::LookupEventsRequest& request, const LookupEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as LookupEventsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void LookupEventsAsync(Model::LookupEventsRequest&& request, const LookupEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified tags from a trail.</p>
          */
@@ -446,6 +542,11 @@ namespace Model
          */
         virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(const Model::RemoveTagsRequest& request) const;
 
+        /**
+         * Same as RemoveTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(Model::RemoveTagsRequest&& request) const;
+
         /**
          * <p>Removes the specified tags from a trail.</p>
          *
@@ -453,6 +554,11 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveTagsAsync(Model::RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts the recording of AWS API calls and log file delivery for a trail. For
          * a trail that is enabled in all regions, this operation must be called from the
@@ -473,6 +579,11 @@ namespace Model
          */
         virtual Model::StartLoggingOutcomeCallable StartLoggingCallable(const Model::StartLoggingRequest& request) const;
 
+        /**
+         * Same as StartLoggingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StartLoggingOutcomeCallable StartLoggingCallable(Model::StartLoggingRequest&& request) const;
+
         /**
          * <p>Starts the recording of AWS API calls and log file delivery for a trail. For
          * a trail that is enabled in all regions, this operation must be called from the
@@ -484,6 +595,11 @@ namespace Model
          */
         virtual void StartLoggingAsync(const Model::StartLoggingRequest& request, const StartLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartLoggingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StartLoggingAsync(Model::StartLoggingRequest&& request, const StartLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Suspends the recording of AWS API calls and log file delivery for the
          * specified trail. Under most circumstances, there is no need to use this action.
@@ -510,6 +626,11 @@ namespace Model
          */
         virtual Model::StopLoggingOutcomeCallable StopLoggingCallable(const Model::StopLoggingRequest& request) const;
 
+        /**
+         * Same as StopLoggingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StopLoggingOutcomeCallable StopLoggingCallable(Model::StopLoggingRequest&& request) const;
+
         /**
          * <p>Suspends the recording of AWS API calls and log file delivery for the
          * specified trail. Under most circumstances, there is no need to use this action.
@@ -524,6 +645,11 @@ namespace Model
          */
         virtual void StopLoggingAsync(const Model::StopLoggingRequest& request, const StopLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopLoggingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StopLoggingAsync(Model::StopLoggingRequest&& request, const StopLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the settings that specify delivery of log files. Changes to a trail
          * do not require stopping the CloudTrail service. Use this action to designate an
@@ -546,6 +672,11 @@ namespace Model
          */
         virtual Model::UpdateTrailOutcomeCallable UpdateTrailCallable(const Model::UpdateTrailRequest& request) const;
 
+        /**
+         * Same as UpdateTrailCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateTrailOutcomeCallable UpdateTrailCallable(Model::UpdateTrailRequest&& request) const;
+
         /**
          * <p>Updates the settings that specify delivery of log files. Changes to a trail
          * do not require stopping the CloudTrail service. Use this action to designate an
@@ -558,6 +689,42 @@ namespace Model
          */
         virtual void UpdateTrailAsync(const Model::UpdateTrailRequest& request, const UpdateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateTrailAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateTrailAsync(Model::UpdateTrailRequest&& request, const UpdateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsOutcome> AddTagsAwaitable(const Model::AddTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::AddTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsOutcome> AddTagsAwaitable(Model::AddTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::AddTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTrailOutcome> CreateTrailAwaitable(const Model::CreateTrailRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::CreateTrail, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTrailOutcome> CreateTrailAwaitable(Model::CreateTrailRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::CreateTrail, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTrailOutcome> DeleteTrailAwaitable(const Model::DeleteTrailRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::DeleteTrail, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTrailOutcome> DeleteTrailAwaitable(Model::DeleteTrailRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::DeleteTrail, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTrailsOutcome> DescribeTrailsAwaitable(const Model::DescribeTrailsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::DescribeTrails, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTrailsOutcome> DescribeTrailsAwaitable(Model::DescribeTrailsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::DescribeTrails, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTrailStatusOutcome> GetTrailStatusAwaitable(const Model::GetTrailStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::GetTrailStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTrailStatusOutcome> GetTrailStatusAwaitable(Model::GetTrailStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::GetTrailStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPublicKeysOutcome> ListPublicKeysAwaitable(const Model::ListPublicKeysRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::ListPublicKeys, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPublicKeysOutcome> ListPublicKeysAwaitable(Model::ListPublicKeysRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::ListPublicKeys, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsOutcome> ListTagsAwaitable(const Model::ListTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::ListTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsOutcome> ListTagsAwaitable(Model::ListTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::ListTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::LookupEventsOutcome> LookupEventsAwaitable(const Model::LookupEventsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::LookupEvents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::LookupEventsOutcome> LookupEventsAwaitable(Model::LookupEventsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::LookupEvents, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(const Model::RemoveTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::RemoveTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(Model::RemoveTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::RemoveTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartLoggingOutcome> StartLoggingAwaitable(const Model::StartLoggingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::StartLogging, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartLoggingOutcome> StartLoggingAwaitable(Model::StartLoggingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::StartLogging, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopLoggingOutcome> StopLoggingAwaitable(const Model::StopLoggingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::StopLogging, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopLoggingOutcome> StopLoggingAwaitable(Model::StopLoggingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::StopLogging, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateTrailOutcome> UpdateTrailAwaitable(const Model::UpdateTrailRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::UpdateTrail, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateTrailOutcome> UpdateTrailAwaitable(Model::UpdateTrailRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudTrailClient::UpdateTrail, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
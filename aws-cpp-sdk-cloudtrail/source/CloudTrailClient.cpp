@@ -119,12 +119,22 @@ AddTagsOutcome CloudTrailClient::AddTags(const AddTagsRequest& request) const
 
 AddTagsOutcomeCallable CloudTrailClient::AddTagsCallable(const AddTagsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudTrailClient::AddTags, this, request);
+  return m_executor->SubmitWithFuture(&CloudTrailClient::AddTags, Aws::Client::RejectedCallOutcome<AddTagsOutcome>(), this, request);
+}
+
+AddTagsOutcomeCallable CloudTrailClient::AddTagsCallable(AddTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudTrailClient::AddTags, Aws::Client::RejectedCallOutcome<AddTagsOutcome>(), this, std::move(request));
 }
 
 void CloudTrailClient::AddTagsAsync(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudTrailClient::AddTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudTrailClient::AddTagsAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsOutcome>(), this, request, handler, context);
+}
+
+void CloudTrailClient::AddTagsAsync(AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudTrailClient::AddTagsAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudTrailClient::AddTagsAsyncHelper(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -150,12 +160,22 @@ CreateTrailOutcome CloudTrailClient::CreateTrail(const CreateTrailRequest& reque
 
 CreateTrailOutcomeCallable CloudTrailClient::CreateTrailCallable(const CreateTrailRequest& request) const
 {
-  return std::async(std::launch::async, &CloudTrailClient::CreateTrail, this, request);
+  return m_executor->SubmitWithFuture(&CloudTrailClient::CreateTrail, Aws::Client::RejectedCallOutcome<CreateTrailOutcome>(), this, request);
+}
+
+CreateTrailOutcomeCallable CloudTrailClient::CreateTrailCallable(CreateTrailRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudTrailClient::CreateTrail, Aws::Client::RejectedCallOutcome<CreateTrailOutcome>(), this, std::move(request));
 }
 
 void CloudTrailClient::CreateTrailAsync(const CreateTrailRequest& request, const CreateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudTrailClient::CreateTrailAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudTrailClient::CreateTrailAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTrailOutcome>(), this, request, handler, context);
+}
+
+void CloudTrailClient::CreateTrailAsync(CreateTrailRequest&& request, const CreateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudTrailClient::CreateTrailAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTrailOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudTrailClient::CreateTrailAsyncHelper(const CreateTrailRequest& request, const CreateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -181,12 +201,22 @@ DeleteTrailOutcome CloudTrailClient::DeleteTrail(const DeleteTrailRequest& reque
 
 DeleteTrailOutcomeCallable CloudTrailClient::DeleteTrailCallable(const DeleteTrailRequest& request) const
 {
-  return std::async(std::launch::async, &CloudTrailClient::DeleteTrail, this, request);
+  return m_executor->SubmitWithFuture(&CloudTrailClient::DeleteTrail, Aws::Client::RejectedCallOutcome<DeleteTrailOutcome>(), this, request);
+}
+
+DeleteTrailOutcomeCallable CloudTrailClient::DeleteTrailCallable(DeleteTrailRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudTrailClient::DeleteTrail, Aws::Client::RejectedCallOutcome<DeleteTrailOutcome>(), this, std::move(request));
 }
 
 void CloudTrailClient::DeleteTrailAsync(const DeleteTrailRequest& request, const DeleteTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudTrailClient::DeleteTrailAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudTrailClient::DeleteTrailAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTrailOutcome>(), this, request, handler, context);
+}
+
+void CloudTrailClient::DeleteTrailAsync(DeleteTrailRequest&& request, const DeleteTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudTrailClient::DeleteTrailAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTrailOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudTrailClient::DeleteTrailAsyncHelper(const DeleteTrailRequest& request, const DeleteTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -212,12 +242,22 @@ DescribeTrailsOutcome CloudTrailClient::DescribeTrails(const DescribeTrailsReque
 
 DescribeTrailsOutcomeCallable CloudTrailClient::DescribeTrailsCallable(const DescribeTrailsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudTrailClient::DescribeTrails, this, request);
+  return m_executor->SubmitWithFuture(&CloudTrailClient::DescribeTrails, Aws::Client::RejectedCallOutcome<DescribeTrailsOutcome>(), this, request);
+}
+
+DescribeTrailsOutcomeCallable CloudTrailClient::DescribeTrailsCallable(DescribeTrailsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudTrailClient::DescribeTrails, Aws::Client::RejectedCallOutcome<DescribeTrailsOutcome>(), this, std::move(request));
 }
 
 void CloudTrailClient::DescribeTrailsAsync(const DescribeTrailsRequest& request, const DescribeTrailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudTrailClient::DescribeTrailsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudTrailClient::DescribeTrailsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTrailsOutcome>(), this, request, handler, context);
+}
+
+void CloudTrailClient::DescribeTrailsAsync(DescribeTrailsRequest&& request, const DescribeTrailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudTrailClient::DescribeTrailsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTrailsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudTrailClient::DescribeTrailsAsyncHelper(const DescribeTrailsRequest& request, const DescribeTrailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -243,12 +283,22 @@ GetTrailStatusOutcome CloudTrailClient::GetTrailStatus(const GetTrailStatusReque
 
 GetTrailStatusOutcomeCallable CloudTrailClient::GetTrailStatusCallable(const GetTrailStatusRequest& request) const
 {
-  return std::async(std::launch::async, &CloudTrailClient::GetTrailStatus, this, request);
+  return m_executor->SubmitWithFuture(&CloudTrailClient::GetTrailStatus, Aws::Client::RejectedCallOutcome<GetTrailStatusOutcome>(), this, request);
+}
+
+GetTrailStatusOutcomeCallable CloudTrailClient::GetTrailStatusCallable(GetTrailStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudTrailClient::GetTrailStatus, Aws::Client::RejectedCallOutcome<GetTrailStatusOutcome>(), this, std::move(request));
 }
 
 void CloudTrailClient::GetTrailStatusAsync(const GetTrailStatusRequest& request, const GetTrailStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudTrailClient::GetTrailStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudTrailClient::GetTrailStatusAsyncHelper, Aws::Client::RejectedAsyncCall<GetTrailStatusOutcome>(), this, request, handler, context);
+}
+
+void CloudTrailClient::GetTrailStatusAsync(GetTrailStatusRequest&& request, const GetTrailStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudTrailClient::GetTrailStatusAsyncHelper, Aws::Client::RejectedAsyncCall<GetTrailStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudTrailClient::GetTrailStatusAsyncHelper(const GetTrailStatusRequest& request, const GetTrailStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -274,12 +324,22 @@ ListPublicKeysOutcome CloudTrailClient::ListPublicKeys(const ListPublicKeysReque
 
 ListPublicKeysOutcomeCallable CloudTrailClient::ListPublicKeysCallable(const ListPublicKeysRequest& request) const
 {
-  return std::async(std::launch::async, &CloudTrailClient::ListPublicKeys, this, request);
+  return m_executor->SubmitWithFuture(&CloudTrailClient::ListPublicKeys, Aws::Client::RejectedCallOutcome<ListPublicKeysOutcome>(), this, request);
+}
+
+ListPublicKeysOutcomeCallable CloudTrailClient::ListPublicKeysCallable(ListPublicKeysRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudTrailClient::ListPublicKeys, Aws::Client::RejectedCallOutcome<ListPublicKeysOutcome>(), this, std::move(request));
 }
 
 void CloudTrailClient::ListPublicKeysAsync(const ListPublicKeysRequest& request, const ListPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudTrailClient::ListPublicKeysAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudTrailClient::ListPublicKeysAsyncHelper, Aws::Client::RejectedAsyncCall<ListPublicKeysOutcome>(), this, request, handler, context);
+}
+
+void CloudTrailClient::ListPublicKeysAsync(ListPublicKeysRequest&& request, const ListPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudTrailClient::ListPublicKeysAsyncHelper, Aws::Client::RejectedAsyncCall<ListPublicKeysOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudTrailClient::ListPublicKeysAsyncHelper(const ListPublicKeysRequest& request, const ListPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -305,12 +365,22 @@ ListTagsOutcome CloudTrailClient::ListTags(const ListTagsRequest& request) const
 
 ListTagsOutcomeCallable CloudTrailClient::ListTagsCallable(const ListTagsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudTrailClient::ListTags, this, request);
+  return m_executor->SubmitWithFuture(&CloudTrailClient::ListTags, Aws::Client::RejectedCallOutcome<ListTagsOutcome>(), this, request);
+}
+
+ListTagsOutcomeCallable CloudTrailClient::ListTagsCallable(ListTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudTrailClient::ListTags, Aws::Client::RejectedCallOutcome<ListTagsOutcome>(), this, std::move(request));
 }
 
 void CloudTrailClient::ListTagsAsync(const ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudTrailClient::ListTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudTrailClient::ListTagsAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsOutcome>(), this, request, handler, context);
+}
+
+void CloudTrailClient::ListTagsAsync(ListTagsRequest&& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudTrailClient::ListTagsAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudTrailClient::ListTagsAsyncHelper(const ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -336,12 +406,22 @@ LookupEventsOutcome CloudTrailClient::LookupEvents(const LookupEventsRequest& re
 
 LookupEventsOutcomeCallable CloudTrailClient::LookupEventsCallable(const LookupEventsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudTrailClient::LookupEvents, this, request);
+  return m_executor->SubmitWithFuture(&CloudTrailClient::LookupEvents, Aws::Client::RejectedCallOutcome<LookupEventsOutcome>(), this, request);
+}
+
+LookupEventsOutcomeCallable CloudTrailClient::LookupEventsCallable(LookupEventsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudTrailClient::LookupEvents, Aws::Client::RejectedCallOutcome<LookupEventsOutcome>(), this, std::move(request));
 }
 
 void CloudTrailClient::LookupEventsAsync(const LookupEventsRequest& request, const LookupEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudTrailClient::LookupEventsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudTrailClient::LookupEventsAsyncHelper, Aws::Client::RejectedAsyncCall<LookupEventsOutcome>(), this, request, handler, context);
+}
+
+void CloudTrailClient::LookupEventsAsync(LookupEventsRequest&& request, const LookupEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudTrailClient::LookupEventsAsyncHelper, Aws::Client::RejectedAsyncCall<LookupEventsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudTrailClient::LookupEventsAsyncHelper(const LookupEventsRequest& request, const LookupEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -367,12 +447,22 @@ RemoveTagsOutcome CloudTrailClient::RemoveTags(const RemoveTagsRequest& request)
 
 RemoveTagsOutcomeCallable CloudTrailClient::RemoveTagsCallable(const RemoveTagsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudTrailClient::RemoveTags, this, request);
+  return m_executor->SubmitWithFuture(&CloudTrailClient::RemoveTags, Aws::Client::RejectedCallOutcome<RemoveTagsOutcome>(), this, request);
+}
+
+RemoveTagsOutcomeCallable CloudTrailClient::RemoveTagsCallable(RemoveTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudTrailClient::RemoveTags, Aws::Client::RejectedCallOutcome<RemoveTagsOutcome>(), this, std::move(request));
 }
 
 void CloudTrailClient::RemoveTagsAsync(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudTrailClient::RemoveTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudTrailClient::RemoveTagsAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsOutcome>(), this, request, handler, context);
+}
+
+void CloudTrailClient::RemoveTagsAsync(RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudTrailClient::RemoveTagsAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudTrailClient::RemoveTagsAsyncHelper(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -398,12 +488,22 @@ StartLoggingOutcome CloudTrailClient::StartLogging(const StartLoggingRequest& re
 
 StartLoggingOutcomeCallable CloudTrailClient::StartLoggingCallable(const StartLoggingRequest& request) const
 {
-  return std::async(std::launch::async, &CloudTrailClient::StartLogging, this, request);
+  return m_executor->SubmitWithFuture(&CloudTrailClient::StartLogging, Aws::Client::RejectedCallOutcome<StartLoggingOutcome>(), this, request);
+}
+
+StartLoggingOutcomeCallable CloudTrailClient::StartLoggingCallable(StartLoggingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudTrailClient::StartLogging, Aws::Client::RejectedCallOutcome<StartLoggingOutcome>(), this, std::move(request));
 }
 
 void CloudTrailClient::StartLoggingAsync(const StartLoggingRequest& request, const StartLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudTrailClient::StartLoggingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudTrailClient::StartLoggingAsyncHelper, Aws::Client::RejectedAsyncCall<StartLoggingOutcome>(), this, request, handler, context);
+}
+
+void CloudTrailClient::StartLoggingAsync(StartLoggingRequest&& request, const StartLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudTrailClient::StartLoggingAsyncHelper, Aws::Client::RejectedAsyncCall<StartLoggingOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudTrailClient::StartLoggingAsyncHelper(const StartLoggingRequest& request, const StartLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -429,12 +529,22 @@ StopLoggingOutcome CloudTrailClient::StopLogging(const StopLoggingRequest& reque
 
 StopLoggingOutcomeCallable CloudTrailClient::StopLoggingCallable(const StopLoggingRequest& request) const
 {
-  return std::async(std::launch::async, &CloudTrailClient::StopLogging, this, request);
+  return m_executor->SubmitWithFuture(&CloudTrailClient::StopLogging, Aws::Client::RejectedCallOutcome<StopLoggingOutcome>(), this, request);
+}
+
+StopLoggingOutcomeCallable CloudTrailClient::StopLoggingCallable(StopLoggingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudTrailClient::StopLogging, Aws::Client::RejectedCallOutcome<StopLoggingOutcome>(), this, std::move(request));
 }
 
 void CloudTrailClient::StopLoggingAsync(const StopLoggingRequest& request, const StopLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudTrailClient::StopLoggingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudTrailClient::StopLoggingAsyncHelper, Aws::Client::RejectedAsyncCall<StopLoggingOutcome>(), this, request, handler, context);
+}
+
+void CloudTrailClient::StopLoggingAsync(StopLoggingRequest&& request, const StopLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudTrailClient::StopLoggingAsyncHelper, Aws::Client::RejectedAsyncCall<StopLoggingOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudTrailClient::StopLoggingAsyncHelper(const StopLoggingRequest& request, const StopLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -460,12 +570,22 @@ UpdateTrailOutcome CloudTrailClient::UpdateTrail(const UpdateTrailRequest& reque
 
 UpdateTrailOutcomeCallable CloudTrailClient::UpdateTrailCallable(const UpdateTrailRequest& request) const
 {
-  return std::async(std::launch::async, &CloudTrailClient::UpdateTrail, this, request);
+  return m_executor->SubmitWithFuture(&CloudTrailClient::UpdateTrail, Aws::Client::RejectedCallOutcome<UpdateTrailOutcome>(), this, request);
+}
+
+UpdateTrailOutcomeCallable CloudTrailClient::UpdateTrailCallable(UpdateTrailRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudTrailClient::UpdateTrail, Aws::Client::RejectedCallOutcome<UpdateTrailOutcome>(), this, std::move(request));
 }
 
 void CloudTrailClient::UpdateTrailAsync(const UpdateTrailRequest& request, const UpdateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudTrailClient::UpdateTrailAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudTrailClient::UpdateTrailAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateTrailOutcome>(), this, request, handler, context);
+}
+
+void CloudTrailClient::UpdateTrailAsync(UpdateTrailRequest&& request, const UpdateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudTrailClient::UpdateTrailAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateTrailOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudTrailClient::UpdateTrailAsyncHelper(const UpdateTrailRequest& request, const UpdateTrailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -34,6 +34,25 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/codecommit/model/BatchGetRepositoriesRequest.h>
+#include <aws/codecommit/model/CreateBranchRequest.h>
+#include <aws/codecommit/model/CreateRepositoryRequest.h>
+#include <aws/codecommit/model/DeleteRepositoryRequest.h>
+#include <aws/codecommit/model/GetBranchRequest.h>
+#include <aws/codecommit/model/GetCommitRequest.h>
+#include <aws/codecommit/model/GetRepositoryRequest.h>
+#include <aws/codecommit/model/GetRepositoryTriggersRequest.h>
+#include <aws/codecommit/model/ListBranchesRequest.h>
+#include <aws/codecommit/model/ListRepositoriesRequest.h>
+#include <aws/codecommit/model/PutRepositoryTriggersRequest.h>
+#include <aws/codecommit/model/TestRepositoryTriggersRequest.h>
+#include <aws/codecommit/model/UpdateDefaultBranchRequest.h>
+#include <aws/codecommit/model/UpdateRepositoryDescriptionRequest.h>
+#include <aws/codecommit/model/UpdateRepositoryNameRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -227,6 +246,11 @@ namespace Model
          */
         virtual Model::BatchGetRepositoriesOutcomeCallable BatchGetRepositoriesCallable(const Model::BatchGetRepositoriesRequest& request) const;
 
+        /**
+         * Same as BatchGetRepositoriesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BatchGetRepositoriesOutcomeCallable BatchGetRepositoriesCallable(Model::BatchGetRepositoriesRequest&& request) const;
+
         /**
          * <p>Returns information about one or more repositories.</p> <note><p>The
          * description field for a repository accepts all HTML characters and all valid
@@ -239,6 +263,11 @@ namespace Model
          */
         virtual void BatchGetRepositoriesAsync(const Model::BatchGetRepositoriesRequest& request, const BatchGetRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetRepositoriesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BatchGetRepositoriesAsync(Model::BatchGetRepositoriesRequest&& request, const BatchGetRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new branch in a repository and points the branch to a commit.</p>
          * <note><p>Calling the create branch operation does not set a repository's default
@@ -255,6 +284,11 @@ namespace Model
          */
         virtual Model::CreateBranchOutcomeCallable CreateBranchCallable(const Model::CreateBranchRequest& request) const;
 
+        /**
+         * Same as CreateBranchCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateBranchOutcomeCallable CreateBranchCallable(Model::CreateBranchRequest&& request) const;
+
         /**
          * <p>Creates a new branch in a repository and points the branch to a commit.</p>
          * <note><p>Calling the create branch operation does not set a repository's default
@@ -264,6 +298,11 @@ namespace Model
          */
         virtual void CreateBranchAsync(const Model::CreateBranchRequest& request, const CreateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateBranchAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateBranchAsync(Model::CreateBranchRequest&& request, const CreateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new, empty repository.</p>
          */
@@ -276,6 +315,11 @@ namespace Model
          */
         virtual Model::CreateRepositoryOutcomeCallable CreateRepositoryCallable(const Model::CreateRepositoryRequest& request) const;
 
+        /**
+         * Same as CreateRepositoryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateRepositoryOutcomeCallable CreateRepositoryCallable(Model::CreateRepositoryRequest&& request) const;
+
         /**
          * <p>Creates a new, empty repository.</p>
          *
@@ -283,6 +327,11 @@ namespace Model
          */
         virtual void CreateRepositoryAsync(const Model::CreateRepositoryRequest& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRepositoryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateRepositoryAsync(Model::CreateRepositoryRequest&& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a repository. If a specified repository was already deleted, a null
          * repository ID will be returned.</p> <important>Deleting a repository also
@@ -301,6 +350,11 @@ namespace Model
          */
         virtual Model::DeleteRepositoryOutcomeCallable DeleteRepositoryCallable(const Model::DeleteRepositoryRequest& request) const;
 
+        /**
+         * Same as DeleteRepositoryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteRepositoryOutcomeCallable DeleteRepositoryCallable(Model::DeleteRepositoryRequest&& request) const;
+
         /**
          * <p>Deletes a repository. If a specified repository was already deleted, a null
          * repository ID will be returned.</p> <important>Deleting a repository also
@@ -311,6 +365,11 @@ namespace Model
          */
         virtual void DeleteRepositoryAsync(const Model::DeleteRepositoryRequest& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRepositoryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteRepositoryAsync(Model::DeleteRepositoryRequest&& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about a repository branch, including its name and the
          * last commit ID.</p>
@@ -325,6 +384,11 @@ namespace Model
          */
         virtual Model::GetBranchOutcomeCallable GetBranchCallable(const Model::GetBranchRequest& request) const;
 
+        /**
+         * Same as GetBranchCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBranchOutcomeCallable GetBranchCallable(Model::GetBranchRequest&& request) const;
+
         /**
          * <p>Returns information about a repository branch, including its name and the
          * last commit ID.</p>
@@ -333,6 +397,11 @@ namespace Model
          */
         virtual void GetBranchAsync(const Model::GetBranchRequest& request, const GetBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBranchAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBranchAsync(Model::GetBranchRequest&& request, const GetBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about a commit, including commit message and committer
          * information.</p>
@@ -347,6 +416,11 @@ namespace Model
          */
         virtual Model::GetCommitOutcomeCallable GetCommitCallable(const Model::GetCommitRequest& request) const;
 
+        /**
+         * Same as GetCommitCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetCommitOutcomeCallable GetCommitCallable(Model::GetCommitRequest&& request) const;
+
         /**
          * <p>Returns information about a commit, including commit message and committer
          * information.</p>
@@ -355,6 +429,11 @@ namespace Model
          */
         virtual void GetCommitAsync(const Model::GetCommitRequest& request, const GetCommitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCommitAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetCommitAsync(Model::GetCommitRequest&& request, const GetCommitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about a repository.</p> <note><p>The description field
          * for a repository accepts all HTML characters and all valid Unicode characters.
@@ -377,6 +456,11 @@ namespace Model
          */
         virtual Model::GetRepositoryOutcomeCallable GetRepositoryCallable(const Model::GetRepositoryRequest& request) const;
 
+        /**
+         * Same as GetRepositoryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetRepositoryOutcomeCallable GetRepositoryCallable(Model::GetRepositoryRequest&& request) const;
+
         /**
          * <p>Returns information about a repository.</p> <note><p>The description field
          * for a repository accepts all HTML characters and all valid Unicode characters.
@@ -389,6 +473,11 @@ namespace Model
          */
         virtual void GetRepositoryAsync(const Model::GetRepositoryRequest& request, const GetRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRepositoryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetRepositoryAsync(Model::GetRepositoryRequest&& request, const GetRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about triggers configured for a repository.</p>
          */
@@ -401,6 +490,11 @@ namespace Model
          */
         virtual Model::GetRepositoryTriggersOutcomeCallable GetRepositoryTriggersCallable(const Model::GetRepositoryTriggersRequest& request) const;
 
+        /**
+         * Same as GetRepositoryTriggersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetRepositoryTriggersOutcomeCallable GetRepositoryTriggersCallable(Model::GetRepositoryTriggersRequest&& request) const;
+
         /**
          * <p>Gets information about triggers configured for a repository.</p>
          *
@@ -408,6 +502,11 @@ namespace Model
          */
         virtual void GetRepositoryTriggersAsync(const Model::GetRepositoryTriggersRequest& request, const GetRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRepositoryTriggersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetRepositoryTriggersAsync(Model::GetRepositoryTriggersRequest&& request, const GetRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more branches in a repository.</p>
          */
@@ -420,6 +519,11 @@ namespace Model
          */
         virtual Model::ListBranchesOutcomeCallable ListBranchesCallable(const Model::ListBranchesRequest& request) const;
 
+        /**
+         * Same as ListBranchesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListBranchesOutcomeCallable ListBranchesCallable(Model::ListBranchesRequest&& request) const;
+
         /**
          * <p>Gets information about one or more branches in a repository.</p>
          *
@@ -427,6 +531,11 @@ namespace Model
          */
         virtual void ListBranchesAsync(const Model::ListBranchesRequest& request, const ListBranchesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListBranchesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListBranchesAsync(Model::ListBranchesRequest&& request, const ListBranchesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more repositories.</p>
          */
@@ -439,6 +548,11 @@ namespace Model
          */
         virtual Model::ListRepositoriesOutcomeCallable ListRepositoriesCallable(const Model::ListRepositoriesRequest& request) const;
 
+        /**
+         * Same as ListRepositoriesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListRepositoriesOutcomeCallable ListRepositoriesCallable(Model::ListRepositoriesRequest&& request) const;
+
         /**
          * <p>Gets information about one or more repositories.</p>
          *
@@ -446,6 +560,11 @@ namespace Model
          */
         virtual void ListRepositoriesAsync(const Model::ListRepositoriesRequest& request, const ListRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRepositoriesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListRepositoriesAsync(Model::ListRepositoriesRequest&& request, const ListRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Replaces all triggers for a repository. This can be used to create or delete
          * triggers.</p>
@@ -460,6 +579,11 @@ namespace Model
          */
         virtual Model::PutRepositoryTriggersOutcomeCallable PutRepositoryTriggersCallable(const Model::PutRepositoryTriggersRequest& request) const;
 
+        /**
+         * Same as PutRepositoryTriggersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutRepositoryTriggersOutcomeCallable PutRepositoryTriggersCallable(Model::PutRepositoryTriggersRequest&& request) const;
+
         /**
          * <p>Replaces all triggers for a repository. This can be used to create or delete
          * triggers.</p>
@@ -468,6 +592,11 @@ namespace Model
          */
         virtual void PutRepositoryTriggersAsync(const Model::PutRepositoryTriggersRequest& request, const PutRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRepositoryTriggersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutRepositoryTriggersAsync(Model::PutRepositoryTriggersRequest&& request, const PutRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Tests the functionality of repository triggers by sending information to the
          * trigger target. If real data is available in the repository, the test will send
@@ -486,6 +615,11 @@ namespace Model
          */
         virtual Model::TestRepositoryTriggersOutcomeCallable TestRepositoryTriggersCallable(const Model::TestRepositoryTriggersRequest& request) const;
 
+        /**
+         * Same as TestRepositoryTriggersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::TestRepositoryTriggersOutcomeCallable TestRepositoryTriggersCallable(Model::TestRepositoryTriggersRequest&& request) const;
+
         /**
          * <p>Tests the functionality of repository triggers by sending information to the
          * trigger target. If real data is available in the repository, the test will send
@@ -496,6 +630,11 @@ namespace Model
          */
         virtual void TestRepositoryTriggersAsync(const Model::TestRepositoryTriggersRequest& request, const TestRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TestRepositoryTriggersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void TestRepositoryTriggersAsync(Model::TestRepositoryTriggersRequest&& request, const TestRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets or changes the default branch name for the specified repository.</p>
          * <note><p>If you use this operation to change the default branch name to the
@@ -514,6 +653,11 @@ namespace Model
          */
         virtual Model::UpdateDefaultBranchOutcomeCallable UpdateDefaultBranchCallable(const Model::UpdateDefaultBranchRequest& request) const;
 
+        /**
+         * Same as UpdateDefaultBranchCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateDefaultBranchOutcomeCallable UpdateDefaultBranchCallable(Model::UpdateDefaultBranchRequest&& request) const;
+
         /**
          * <p>Sets or changes the default branch name for the specified repository.</p>
          * <note><p>If you use this operation to change the default branch name to the
@@ -524,6 +668,11 @@ namespace Model
          */
         virtual void UpdateDefaultBranchAsync(const Model::UpdateDefaultBranchRequest& request, const UpdateDefaultBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDefaultBranchAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateDefaultBranchAsync(Model::UpdateDefaultBranchRequest&& request, const UpdateDefaultBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets or changes the comment or description for a repository.</p> <note><p>The
          * description field for a repository accepts all HTML characters and all valid
@@ -546,6 +695,11 @@ namespace Model
          */
         virtual Model::UpdateRepositoryDescriptionOutcomeCallable UpdateRepositoryDescriptionCallable(const Model::UpdateRepositoryDescriptionRequest& request) const;
 
+        /**
+         * Same as UpdateRepositoryDescriptionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateRepositoryDescriptionOutcomeCallable UpdateRepositoryDescriptionCallable(Model::UpdateRepositoryDescriptionRequest&& request) const;
+
         /**
          * <p>Sets or changes the comment or description for a repository.</p> <note><p>The
          * description field for a repository accepts all HTML characters and all valid
@@ -558,6 +712,11 @@ namespace Model
          */
         virtual void UpdateRepositoryDescriptionAsync(const Model::UpdateRepositoryDescriptionRequest& request, const UpdateRepositoryDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRepositoryDescriptionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateRepositoryDescriptionAsync(Model::UpdateRepositoryDescriptionRequest&& request, const UpdateRepositoryDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Renames a repository. The repository name must be unique across the calling
          * AWS account. In addition, repository names are limited to 100 alphanumeric,
@@ -582,6 +741,11 @@ namespace Model
          */
         virtual Model::UpdateRepositoryNameOutcomeCallable UpdateRepositoryNameCallable(const Model::UpdateRepositoryNameRequest& request) const;
 
+        /**
+         * Same as UpdateRepositoryNameCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateRepositoryNameOutcomeCallable UpdateRepositoryNameCallable(Model::UpdateRepositoryNameRequest&& request) const;
+
         /**
          * <p>Renames a repository. The repository name must be unique across the calling
          * AWS account. In addition, repository names are limited to 100 alphanumeric,
@@ -595,6 +759,48 @@ namespace Model
          */
         virtual void UpdateRepositoryNameAsync(const Model::UpdateRepositoryNameRequest& request, const UpdateRepositoryNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRepositoryNameAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateRepositoryNameAsync(Model::UpdateRepositoryNameRequest&& request, const UpdateRepositoryNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetRepositoriesOutcome> BatchGetRepositoriesAwaitable(const Model::BatchGetRepositoriesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::BatchGetRepositories, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetRepositoriesOutcome> BatchGetRepositoriesAwaitable(Model::BatchGetRepositoriesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::BatchGetRepositories, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateBranchOutcome> CreateBranchAwaitable(const Model::CreateBranchRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::CreateBranch, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateBranchOutcome> CreateBranchAwaitable(Model::CreateBranchRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::CreateBranch, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRepositoryOutcome> CreateRepositoryAwaitable(const Model::CreateRepositoryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::CreateRepository, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRepositoryOutcome> CreateRepositoryAwaitable(Model::CreateRepositoryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::CreateRepository, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRepositoryOutcome> DeleteRepositoryAwaitable(const Model::DeleteRepositoryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::DeleteRepository, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRepositoryOutcome> DeleteRepositoryAwaitable(Model::DeleteRepositoryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::DeleteRepository, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBranchOutcome> GetBranchAwaitable(const Model::GetBranchRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::GetBranch, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBranchOutcome> GetBranchAwaitable(Model::GetBranchRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::GetBranch, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCommitOutcome> GetCommitAwaitable(const Model::GetCommitRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::GetCommit, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCommitOutcome> GetCommitAwaitable(Model::GetCommitRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::GetCommit, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRepositoryOutcome> GetRepositoryAwaitable(const Model::GetRepositoryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::GetRepository, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRepositoryOutcome> GetRepositoryAwaitable(Model::GetRepositoryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::GetRepository, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRepositoryTriggersOutcome> GetRepositoryTriggersAwaitable(const Model::GetRepositoryTriggersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::GetRepositoryTriggers, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRepositoryTriggersOutcome> GetRepositoryTriggersAwaitable(Model::GetRepositoryTriggersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::GetRepositoryTriggers, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListBranchesOutcome> ListBranchesAwaitable(const Model::ListBranchesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::ListBranches, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListBranchesOutcome> ListBranchesAwaitable(Model::ListBranchesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::ListBranches, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRepositoriesOutcome> ListRepositoriesAwaitable(const Model::ListRepositoriesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::ListRepositories, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRepositoriesOutcome> ListRepositoriesAwaitable(Model::ListRepositoriesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::ListRepositories, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRepositoryTriggersOutcome> PutRepositoryTriggersAwaitable(const Model::PutRepositoryTriggersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::PutRepositoryTriggers, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRepositoryTriggersOutcome> PutRepositoryTriggersAwaitable(Model::PutRepositoryTriggersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::PutRepositoryTriggers, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TestRepositoryTriggersOutcome> TestRepositoryTriggersAwaitable(const Model::TestRepositoryTriggersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::TestRepositoryTriggers, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TestRepositoryTriggersOutcome> TestRepositoryTriggersAwaitable(Model::TestRepositoryTriggersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::TestRepositoryTriggers, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDefaultBranchOutcome> UpdateDefaultBranchAwaitable(const Model::UpdateDefaultBranchRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::UpdateDefaultBranch, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDefaultBranchOutcome> UpdateDefaultBranchAwaitable(Model::UpdateDefaultBranchRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::UpdateDefaultBranch, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateRepositoryDescriptionOutcome> UpdateRepositoryDescriptionAwaitable(const Model::UpdateRepositoryDescriptionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::UpdateRepositoryDescription, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateRepositoryDescriptionOutcome> UpdateRepositoryDescriptionAwaitable(Model::UpdateRepositoryDescriptionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::UpdateRepositoryDescription, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateRepositoryNameOutcome> UpdateRepositoryNameAwaitable(const Model::UpdateRepositoryNameRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::UpdateRepositoryName, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateRepositoryNameOutcome> UpdateRepositoryNameAwaitable(Model::UpdateRepositoryNameRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeCommitClient::UpdateRepositoryName, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -122,12 +122,22 @@ BatchGetRepositoriesOutcome CodeCommitClient::BatchGetRepositories(const BatchGe
 
 BatchGetRepositoriesOutcomeCallable CodeCommitClient::BatchGetRepositoriesCallable(const BatchGetRepositoriesRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::BatchGetRepositories, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::BatchGetRepositories, Aws::Client::RejectedCallOutcome<BatchGetRepositoriesOutcome>(), this, request);
+}
+
+BatchGetRepositoriesOutcomeCallable CodeCommitClient::BatchGetRepositoriesCallable(BatchGetRepositoriesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::BatchGetRepositories, Aws::Client::RejectedCallOutcome<BatchGetRepositoriesOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::BatchGetRepositoriesAsync(const BatchGetRepositoriesRequest& request, const BatchGetRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::BatchGetRepositoriesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::BatchGetRepositoriesAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetRepositoriesOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::BatchGetRepositoriesAsync(BatchGetRepositoriesRequest&& request, const BatchGetRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::BatchGetRepositoriesAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetRepositoriesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::BatchGetRepositoriesAsyncHelper(const BatchGetRepositoriesRequest& request, const BatchGetRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -153,12 +163,22 @@ CreateBranchOutcome CodeCommitClient::CreateBranch(const CreateBranchRequest& re
 
 CreateBranchOutcomeCallable CodeCommitClient::CreateBranchCallable(const CreateBranchRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::CreateBranch, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::CreateBranch, Aws::Client::RejectedCallOutcome<CreateBranchOutcome>(), this, request);
+}
+
+CreateBranchOutcomeCallable CodeCommitClient::CreateBranchCallable(CreateBranchRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::CreateBranch, Aws::Client::RejectedCallOutcome<CreateBranchOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::CreateBranchAsync(const CreateBranchRequest& request, const CreateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::CreateBranchAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::CreateBranchAsyncHelper, Aws::Client::RejectedAsyncCall<CreateBranchOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::CreateBranchAsync(CreateBranchRequest&& request, const CreateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::CreateBranchAsyncHelper, Aws::Client::RejectedAsyncCall<CreateBranchOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::CreateBranchAsyncHelper(const CreateBranchRequest& request, const CreateBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -184,12 +204,22 @@ CreateRepositoryOutcome CodeCommitClient::CreateRepository(const CreateRepositor
 
 CreateRepositoryOutcomeCallable CodeCommitClient::CreateRepositoryCallable(const CreateRepositoryRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::CreateRepository, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::CreateRepository, Aws::Client::RejectedCallOutcome<CreateRepositoryOutcome>(), this, request);
+}
+
+CreateRepositoryOutcomeCallable CodeCommitClient::CreateRepositoryCallable(CreateRepositoryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::CreateRepository, Aws::Client::RejectedCallOutcome<CreateRepositoryOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::CreateRepositoryAsync(const CreateRepositoryRequest& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::CreateRepositoryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::CreateRepositoryAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRepositoryOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::CreateRepositoryAsync(CreateRepositoryRequest&& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::CreateRepositoryAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRepositoryOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::CreateRepositoryAsyncHelper(const CreateRepositoryRequest& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -215,12 +245,22 @@ DeleteRepositoryOutcome CodeCommitClient::DeleteRepository(const DeleteRepositor
 
 DeleteRepositoryOutcomeCallable CodeCommitClient::DeleteRepositoryCallable(const DeleteRepositoryRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::DeleteRepository, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::DeleteRepository, Aws::Client::RejectedCallOutcome<DeleteRepositoryOutcome>(), this, request);
+}
+
+DeleteRepositoryOutcomeCallable CodeCommitClient::DeleteRepositoryCallable(DeleteRepositoryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::DeleteRepository, Aws::Client::RejectedCallOutcome<DeleteRepositoryOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::DeleteRepositoryAsync(const DeleteRepositoryRequest& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::DeleteRepositoryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::DeleteRepositoryAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRepositoryOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::DeleteRepositoryAsync(DeleteRepositoryRequest&& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::DeleteRepositoryAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRepositoryOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::DeleteRepositoryAsyncHelper(const DeleteRepositoryRequest& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -246,12 +286,22 @@ GetBranchOutcome CodeCommitClient::GetBranch(const GetBranchRequest& request) co
 
 GetBranchOutcomeCallable CodeCommitClient::GetBranchCallable(const GetBranchRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::GetBranch, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::GetBranch, Aws::Client::RejectedCallOutcome<GetBranchOutcome>(), this, request);
+}
+
+GetBranchOutcomeCallable CodeCommitClient::GetBranchCallable(GetBranchRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::GetBranch, Aws::Client::RejectedCallOutcome<GetBranchOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::GetBranchAsync(const GetBranchRequest& request, const GetBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::GetBranchAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::GetBranchAsyncHelper, Aws::Client::RejectedAsyncCall<GetBranchOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::GetBranchAsync(GetBranchRequest&& request, const GetBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::GetBranchAsyncHelper, Aws::Client::RejectedAsyncCall<GetBranchOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::GetBranchAsyncHelper(const GetBranchRequest& request, const GetBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -277,12 +327,22 @@ GetCommitOutcome CodeCommitClient::GetCommit(const GetCommitRequest& request) co
 
 GetCommitOutcomeCallable CodeCommitClient::GetCommitCallable(const GetCommitRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::GetCommit, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::GetCommit, Aws::Client::RejectedCallOutcome<GetCommitOutcome>(), this, request);
+}
+
+GetCommitOutcomeCallable CodeCommitClient::GetCommitCallable(GetCommitRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::GetCommit, Aws::Client::RejectedCallOutcome<GetCommitOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::GetCommitAsync(const GetCommitRequest& request, const GetCommitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::GetCommitAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::GetCommitAsyncHelper, Aws::Client::RejectedAsyncCall<GetCommitOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::GetCommitAsync(GetCommitRequest&& request, const GetCommitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::GetCommitAsyncHelper, Aws::Client::RejectedAsyncCall<GetCommitOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::GetCommitAsyncHelper(const GetCommitRequest& request, const GetCommitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -308,12 +368,22 @@ GetRepositoryOutcome CodeCommitClient::GetRepository(const GetRepositoryRequest&
 
 GetRepositoryOutcomeCallable CodeCommitClient::GetRepositoryCallable(const GetRepositoryRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::GetRepository, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::GetRepository, Aws::Client::RejectedCallOutcome<GetRepositoryOutcome>(), this, request);
+}
+
+GetRepositoryOutcomeCallable CodeCommitClient::GetRepositoryCallable(GetRepositoryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::GetRepository, Aws::Client::RejectedCallOutcome<GetRepositoryOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::GetRepositoryAsync(const GetRepositoryRequest& request, const GetRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::GetRepositoryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::GetRepositoryAsyncHelper, Aws::Client::RejectedAsyncCall<GetRepositoryOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::GetRepositoryAsync(GetRepositoryRequest&& request, const GetRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::GetRepositoryAsyncHelper, Aws::Client::RejectedAsyncCall<GetRepositoryOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::GetRepositoryAsyncHelper(const GetRepositoryRequest& request, const GetRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -339,12 +409,22 @@ GetRepositoryTriggersOutcome CodeCommitClient::GetRepositoryTriggers(const GetRe
 
 GetRepositoryTriggersOutcomeCallable CodeCommitClient::GetRepositoryTriggersCallable(const GetRepositoryTriggersRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::GetRepositoryTriggers, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::GetRepositoryTriggers, Aws::Client::RejectedCallOutcome<GetRepositoryTriggersOutcome>(), this, request);
+}
+
+GetRepositoryTriggersOutcomeCallable CodeCommitClient::GetRepositoryTriggersCallable(GetRepositoryTriggersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::GetRepositoryTriggers, Aws::Client::RejectedCallOutcome<GetRepositoryTriggersOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::GetRepositoryTriggersAsync(const GetRepositoryTriggersRequest& request, const GetRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::GetRepositoryTriggersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::GetRepositoryTriggersAsyncHelper, Aws::Client::RejectedAsyncCall<GetRepositoryTriggersOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::GetRepositoryTriggersAsync(GetRepositoryTriggersRequest&& request, const GetRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::GetRepositoryTriggersAsyncHelper, Aws::Client::RejectedAsyncCall<GetRepositoryTriggersOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::GetRepositoryTriggersAsyncHelper(const GetRepositoryTriggersRequest& request, const GetRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -370,12 +450,22 @@ ListBranchesOutcome CodeCommitClient::ListBranches(const ListBranchesRequest& re
 
 ListBranchesOutcomeCallable CodeCommitClient::ListBranchesCallable(const ListBranchesRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::ListBranches, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::ListBranches, Aws::Client::RejectedCallOutcome<ListBranchesOutcome>(), this, request);
+}
+
+ListBranchesOutcomeCallable CodeCommitClient::ListBranchesCallable(ListBranchesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::ListBranches, Aws::Client::RejectedCallOutcome<ListBranchesOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::ListBranchesAsync(const ListBranchesRequest& request, const ListBranchesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::ListBranchesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::ListBranchesAsyncHelper, Aws::Client::RejectedAsyncCall<ListBranchesOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::ListBranchesAsync(ListBranchesRequest&& request, const ListBranchesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::ListBranchesAsyncHelper, Aws::Client::RejectedAsyncCall<ListBranchesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::ListBranchesAsyncHelper(const ListBranchesRequest& request, const ListBranchesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -401,12 +491,22 @@ ListRepositoriesOutcome CodeCommitClient::ListRepositories(const ListRepositorie
 
 ListRepositoriesOutcomeCallable CodeCommitClient::ListRepositoriesCallable(const ListRepositoriesRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::ListRepositories, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::ListRepositories, Aws::Client::RejectedCallOutcome<ListRepositoriesOutcome>(), this, request);
+}
+
+ListRepositoriesOutcomeCallable CodeCommitClient::ListRepositoriesCallable(ListRepositoriesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::ListRepositories, Aws::Client::RejectedCallOutcome<ListRepositoriesOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::ListRepositoriesAsync(const ListRepositoriesRequest& request, const ListRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::ListRepositoriesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::ListRepositoriesAsyncHelper, Aws::Client::RejectedAsyncCall<ListRepositoriesOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::ListRepositoriesAsync(ListRepositoriesRequest&& request, const ListRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::ListRepositoriesAsyncHelper, Aws::Client::RejectedAsyncCall<ListRepositoriesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::ListRepositoriesAsyncHelper(const ListRepositoriesRequest& request, const ListRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -432,12 +532,22 @@ PutRepositoryTriggersOutcome CodeCommitClient::PutRepositoryTriggers(const PutRe
 
 PutRepositoryTriggersOutcomeCallable CodeCommitClient::PutRepositoryTriggersCallable(const PutRepositoryTriggersRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::PutRepositoryTriggers, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::PutRepositoryTriggers, Aws::Client::RejectedCallOutcome<PutRepositoryTriggersOutcome>(), this, request);
+}
+
+PutRepositoryTriggersOutcomeCallable CodeCommitClient::PutRepositoryTriggersCallable(PutRepositoryTriggersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::PutRepositoryTriggers, Aws::Client::RejectedCallOutcome<PutRepositoryTriggersOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::PutRepositoryTriggersAsync(const PutRepositoryTriggersRequest& request, const PutRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::PutRepositoryTriggersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::PutRepositoryTriggersAsyncHelper, Aws::Client::RejectedAsyncCall<PutRepositoryTriggersOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::PutRepositoryTriggersAsync(PutRepositoryTriggersRequest&& request, const PutRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::PutRepositoryTriggersAsyncHelper, Aws::Client::RejectedAsyncCall<PutRepositoryTriggersOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::PutRepositoryTriggersAsyncHelper(const PutRepositoryTriggersRequest& request, const PutRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -463,12 +573,22 @@ TestRepositoryTriggersOutcome CodeCommitClient::TestRepositoryTriggers(const Tes
 
 TestRepositoryTriggersOutcomeCallable CodeCommitClient::TestRepositoryTriggersCallable(const TestRepositoryTriggersRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::TestRepositoryTriggers, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::TestRepositoryTriggers, Aws::Client::RejectedCallOutcome<TestRepositoryTriggersOutcome>(), this, request);
+}
+
+TestRepositoryTriggersOutcomeCallable CodeCommitClient::TestRepositoryTriggersCallable(TestRepositoryTriggersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::TestRepositoryTriggers, Aws::Client::RejectedCallOutcome<TestRepositoryTriggersOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::TestRepositoryTriggersAsync(const TestRepositoryTriggersRequest& request, const TestRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::TestRepositoryTriggersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::TestRepositoryTriggersAsyncHelper, Aws::Client::RejectedAsyncCall<TestRepositoryTriggersOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::TestRepositoryTriggersAsync(TestRepositoryTriggersRequest&& request, const TestRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::TestRepositoryTriggersAsyncHelper, Aws::Client::RejectedAsyncCall<TestRepositoryTriggersOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::TestRepositoryTriggersAsyncHelper(const TestRepositoryTriggersRequest& request, const TestRepositoryTriggersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -494,12 +614,22 @@ UpdateDefaultBranchOutcome CodeCommitClient::UpdateDefaultBranch(const UpdateDef
 
 UpdateDefaultBranchOutcomeCallable CodeCommitClient::UpdateDefaultBranchCallable(const UpdateDefaultBranchRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::UpdateDefaultBranch, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::UpdateDefaultBranch, Aws::Client::RejectedCallOutcome<UpdateDefaultBranchOutcome>(), this, request);
+}
+
+UpdateDefaultBranchOutcomeCallable CodeCommitClient::UpdateDefaultBranchCallable(UpdateDefaultBranchRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::UpdateDefaultBranch, Aws::Client::RejectedCallOutcome<UpdateDefaultBranchOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::UpdateDefaultBranchAsync(const UpdateDefaultBranchRequest& request, const UpdateDefaultBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::UpdateDefaultBranchAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::UpdateDefaultBranchAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDefaultBranchOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::UpdateDefaultBranchAsync(UpdateDefaultBranchRequest&& request, const UpdateDefaultBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::UpdateDefaultBranchAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDefaultBranchOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::UpdateDefaultBranchAsyncHelper(const UpdateDefaultBranchRequest& request, const UpdateDefaultBranchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -525,12 +655,22 @@ UpdateRepositoryDescriptionOutcome CodeCommitClient::UpdateRepositoryDescription
 
 UpdateRepositoryDescriptionOutcomeCallable CodeCommitClient::UpdateRepositoryDescriptionCallable(const UpdateRepositoryDescriptionRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::UpdateRepositoryDescription, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::UpdateRepositoryDescription, Aws::Client::RejectedCallOutcome<UpdateRepositoryDescriptionOutcome>(), this, request);
+}
+
+UpdateRepositoryDescriptionOutcomeCallable CodeCommitClient::UpdateRepositoryDescriptionCallable(UpdateRepositoryDescriptionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::UpdateRepositoryDescription, Aws::Client::RejectedCallOutcome<UpdateRepositoryDescriptionOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::UpdateRepositoryDescriptionAsync(const UpdateRepositoryDescriptionRequest& request, const UpdateRepositoryDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::UpdateRepositoryDescriptionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::UpdateRepositoryDescriptionAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateRepositoryDescriptionOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::UpdateRepositoryDescriptionAsync(UpdateRepositoryDescriptionRequest&& request, const UpdateRepositoryDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::UpdateRepositoryDescriptionAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateRepositoryDescriptionOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::UpdateRepositoryDescriptionAsyncHelper(const UpdateRepositoryDescriptionRequest& request, const UpdateRepositoryDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -556,12 +696,22 @@ UpdateRepositoryNameOutcome CodeCommitClient::UpdateRepositoryName(const UpdateR
 
 UpdateRepositoryNameOutcomeCallable CodeCommitClient::UpdateRepositoryNameCallable(const UpdateRepositoryNameRequest& request) const
 {
-  return std::async(std::launch::async, &CodeCommitClient::UpdateRepositoryName, this, request);
+  return m_executor->SubmitWithFuture(&CodeCommitClient::UpdateRepositoryName, Aws::Client::RejectedCallOutcome<UpdateRepositoryNameOutcome>(), this, request);
+}
+
+UpdateRepositoryNameOutcomeCallable CodeCommitClient::UpdateRepositoryNameCallable(UpdateRepositoryNameRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeCommitClient::UpdateRepositoryName, Aws::Client::RejectedCallOutcome<UpdateRepositoryNameOutcome>(), this, std::move(request));
 }
 
 void CodeCommitClient::UpdateRepositoryNameAsync(const UpdateRepositoryNameRequest& request, const UpdateRepositoryNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeCommitClient::UpdateRepositoryNameAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeCommitClient::UpdateRepositoryNameAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateRepositoryNameOutcome>(), this, request, handler, context);
+}
+
+void CodeCommitClient::UpdateRepositoryNameAsync(UpdateRepositoryNameRequest&& request, const UpdateRepositoryNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeCommitClient::UpdateRepositoryNameAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateRepositoryNameOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeCommitClient::UpdateRepositoryNameAsyncHelper(const UpdateRepositoryNameRequest& request, const UpdateRepositoryNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -49,6 +49,44 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/codedeploy/model/AddTagsToOnPremisesInstancesRequest.h>
+#include <aws/codedeploy/model/BatchGetApplicationRevisionsRequest.h>
+#include <aws/codedeploy/model/BatchGetApplicationsRequest.h>
+#include <aws/codedeploy/model/BatchGetDeploymentInstancesRequest.h>
+#include <aws/codedeploy/model/BatchGetDeploymentsRequest.h>
+#include <aws/codedeploy/model/BatchGetOnPremisesInstancesRequest.h>
+#include <aws/codedeploy/model/CreateApplicationRequest.h>
+#include <aws/codedeploy/model/CreateDeploymentRequest.h>
+#include <aws/codedeploy/model/CreateDeploymentConfigRequest.h>
+#include <aws/codedeploy/model/CreateDeploymentGroupRequest.h>
+#include <aws/codedeploy/model/DeleteApplicationRequest.h>
+#include <aws/codedeploy/model/DeleteDeploymentConfigRequest.h>
+#include <aws/codedeploy/model/DeleteDeploymentGroupRequest.h>
+#include <aws/codedeploy/model/DeregisterOnPremisesInstanceRequest.h>
+#include <aws/codedeploy/model/GetApplicationRequest.h>
+#include <aws/codedeploy/model/GetApplicationRevisionRequest.h>
+#include <aws/codedeploy/model/GetDeploymentRequest.h>
+#include <aws/codedeploy/model/GetDeploymentConfigRequest.h>
+#include <aws/codedeploy/model/GetDeploymentGroupRequest.h>
+#include <aws/codedeploy/model/GetDeploymentInstanceRequest.h>
+#include <aws/codedeploy/model/GetOnPremisesInstanceRequest.h>
+#include <aws/codedeploy/model/ListApplicationRevisionsRequest.h>
+#include <aws/codedeploy/model/ListApplicationsRequest.h>
+#include <aws/codedeploy/model/ListDeploymentConfigsRequest.h>
+#include <aws/codedeploy/model/ListDeploymentGroupsRequest.h>
+#include <aws/codedeploy/model/ListDeploymentInstancesRequest.h>
+#include <aws/codedeploy/model/ListDeploymentsRequest.h>
+#include <aws/codedeploy/model/ListOnPremisesInstancesRequest.h>
+#include <aws/codedeploy/model/RegisterApplicationRevisionRequest.h>
+#include <aws/codedeploy/model/RegisterOnPremisesInstanceRequest.h>
+#include <aws/codedeploy/model/RemoveTagsFromOnPremisesInstancesRequest.h>
+#include <aws/codedeploy/model/StopDeploymentRequest.h>
+#include <aws/codedeploy/model/UpdateApplicationRequest.h>
+#include <aws/codedeploy/model/UpdateDeploymentGroupRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -310,6 +348,11 @@ namespace Model
          */
         virtual Model::AddTagsToOnPremisesInstancesOutcomeCallable AddTagsToOnPremisesInstancesCallable(const Model::AddTagsToOnPremisesInstancesRequest& request) const;
 
+        /**
+         * Same as AddTagsToOnPremisesInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddTagsToOnPremisesInstancesOutcomeCallable AddTagsToOnPremisesInstancesCallable(Model::AddTagsToOnPremisesInstancesRequest&& request) const;
+
         /**
          * <p>Adds tags to on-premises instances.</p>
          *
@@ -317,6 +360,11 @@ namespace Model
          */
         virtual void AddTagsToOnPremisesInstancesAsync(const Model::AddTagsToOnPremisesInstancesRequest& request, const AddTagsToOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToOnPremisesInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddTagsToOnPremisesInstancesAsync(Model::AddTagsToOnPremisesInstancesRequest&& request, const AddTagsToOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more application revisions.</p>
          */
@@ -329,6 +377,11 @@ namespace Model
          */
         virtual Model::BatchGetApplicationRevisionsOutcomeCallable BatchGetApplicationRevisionsCallable(const Model::BatchGetApplicationRevisionsRequest& request) const;
 
+        /**
+         * Same as BatchGetApplicationRevisionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BatchGetApplicationRevisionsOutcomeCallable BatchGetApplicationRevisionsCallable(Model::BatchGetApplicationRevisionsRequest&& request) const;
+
         /**
          * <p>Gets information about one or more application revisions.</p>
          *
@@ -336,6 +389,11 @@ namespace Model
          */
         virtual void BatchGetApplicationRevisionsAsync(const Model::BatchGetApplicationRevisionsRequest& request, const BatchGetApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetApplicationRevisionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BatchGetApplicationRevisionsAsync(Model::BatchGetApplicationRevisionsRequest&& request, const BatchGetApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more applications.</p>
          */
@@ -348,6 +406,11 @@ namespace Model
          */
         virtual Model::BatchGetApplicationsOutcomeCallable BatchGetApplicationsCallable(const Model::BatchGetApplicationsRequest& request) const;
 
+        /**
+         * Same as BatchGetApplicationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BatchGetApplicationsOutcomeCallable BatchGetApplicationsCallable(Model::BatchGetApplicationsRequest&& request) const;
+
         /**
          * <p>Gets information about one or more applications.</p>
          *
@@ -355,6 +418,11 @@ namespace Model
          */
         virtual void BatchGetApplicationsAsync(const Model::BatchGetApplicationsRequest& request, const BatchGetApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetApplicationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BatchGetApplicationsAsync(Model::BatchGetApplicationsRequest&& request, const BatchGetApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more instances that are part of a deployment
          * group.</p>
@@ -369,6 +437,11 @@ namespace Model
          */
         virtual Model::BatchGetDeploymentInstancesOutcomeCallable BatchGetDeploymentInstancesCallable(const Model::BatchGetDeploymentInstancesRequest& request) const;
 
+        /**
+         * Same as BatchGetDeploymentInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BatchGetDeploymentInstancesOutcomeCallable BatchGetDeploymentInstancesCallable(Model::BatchGetDeploymentInstancesRequest&& request) const;
+
         /**
          * <p>Gets information about one or more instances that are part of a deployment
          * group.</p>
@@ -377,6 +450,11 @@ namespace Model
          */
         virtual void BatchGetDeploymentInstancesAsync(const Model::BatchGetDeploymentInstancesRequest& request, const BatchGetDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetDeploymentInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BatchGetDeploymentInstancesAsync(Model::BatchGetDeploymentInstancesRequest&& request, const BatchGetDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more deployments.</p>
          */
@@ -389,6 +467,11 @@ namespace Model
          */
         virtual Model::BatchGetDeploymentsOutcomeCallable BatchGetDeploymentsCallable(const Model::BatchGetDeploymentsRequest& request) const;
 
+        /**
+         * Same as BatchGetDeploymentsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BatchGetDeploymentsOutcomeCallable BatchGetDeploymentsCallable(Model::BatchGetDeploymentsRequest&& request) const;
+
         /**
          * <p>Gets information about one or more deployments.</p>
          *
@@ -396,6 +479,11 @@ namespace Model
          */
         virtual void BatchGetDeploymentsAsync(const Model::BatchGetDeploymentsRequest& request, const BatchGetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetDeploymentsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BatchGetDeploymentsAsync(Model::BatchGetDeploymentsRequest&& request, const BatchGetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about one or more on-premises instances.</p>
          */
@@ -408,6 +496,11 @@ namespace Model
          */
         virtual Model::BatchGetOnPremisesInstancesOutcomeCallable BatchGetOnPremisesInstancesCallable(const Model::BatchGetOnPremisesInstancesRequest& request) const;
 
+        /**
+         * Same as BatchGetOnPremisesInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BatchGetOnPremisesInstancesOutcomeCallable BatchGetOnPremisesInstancesCallable(Model::BatchGetOnPremisesInstancesRequest&& request) const;
+
         /**
          * <p>Gets information about one or more on-premises instances.</p>
          *
@@ -415,6 +508,11 @@ namespace Model
          */
         virtual void BatchGetOnPremisesInstancesAsync(const Model::BatchGetOnPremisesInstancesRequest& request, const BatchGetOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetOnPremisesInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BatchGetOnPremisesInstancesAsync(Model::BatchGetOnPremisesInstancesRequest&& request, const BatchGetOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new application.</p>
          */
@@ -427,6 +525,11 @@ namespace Model
          */
         virtual Model::CreateApplicationOutcomeCallable CreateApplicationCallable(const Model::CreateApplicationRequest& request) const;
 
+        /**
+         * Same as CreateApplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateApplicationOutcomeCallable CreateApplicationCallable(Model::CreateApplicationRequest&& request) const;
+
         /**
          * <p>Creates a new application.</p>
          *
@@ -434,6 +537,11 @@ namespace Model
          */
         virtual void CreateApplicationAsync(const Model::CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateApplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateApplicationAsync(Model::CreateApplicationRequest&& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deploys an application revision through the specified deployment group.</p>
          */
@@ -446,6 +554,11 @@ namespace Model
          */
         virtual Model::CreateDeploymentOutcomeCallable CreateDeploymentCallable(const Model::CreateDeploymentRequest& request) const;
 
+        /**
+         * Same as CreateDeploymentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDeploymentOutcomeCallable CreateDeploymentCallable(Model::CreateDeploymentRequest&& request) const;
+
         /**
          * <p>Deploys an application revision through the specified deployment group.</p>
          *
@@ -453,6 +566,11 @@ namespace Model
          */
         virtual void CreateDeploymentAsync(const Model::CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDeploymentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDeploymentAsync(Model::CreateDeploymentRequest&& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new deployment configuration.</p>
          */
@@ -465,6 +583,11 @@ namespace Model
          */
         virtual Model::CreateDeploymentConfigOutcomeCallable CreateDeploymentConfigCallable(const Model::CreateDeploymentConfigRequest& request) const;
 
+        /**
+         * Same as CreateDeploymentConfigCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDeploymentConfigOutcomeCallable CreateDeploymentConfigCallable(Model::CreateDeploymentConfigRequest&& request) const;
+
         /**
          * <p>Creates a new deployment configuration.</p>
          *
@@ -472,6 +595,11 @@ namespace Model
          */
         virtual void CreateDeploymentConfigAsync(const Model::CreateDeploymentConfigRequest& request, const CreateDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDeploymentConfigAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDeploymentConfigAsync(Model::CreateDeploymentConfigRequest&& request, const CreateDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new deployment group for application revisions to be deployed
          * to.</p>
@@ -486,6 +614,11 @@ namespace Model
          */
         virtual Model::CreateDeploymentGroupOutcomeCallable CreateDeploymentGroupCallable(const Model::CreateDeploymentGroupRequest& request) const;
 
+        /**
+         * Same as CreateDeploymentGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDeploymentGroupOutcomeCallable CreateDeploymentGroupCallable(Model::CreateDeploymentGroupRequest&& request) const;
+
         /**
          * <p>Creates a new deployment group for application revisions to be deployed
          * to.</p>
@@ -494,6 +627,11 @@ namespace Model
          */
         virtual void CreateDeploymentGroupAsync(const Model::CreateDeploymentGroupRequest& request, const CreateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDeploymentGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDeploymentGroupAsync(Model::CreateDeploymentGroupRequest&& request, const CreateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an application.</p>
          */
@@ -506,6 +644,11 @@ namespace Model
          */
         virtual Model::DeleteApplicationOutcomeCallable DeleteApplicationCallable(const Model::DeleteApplicationRequest& request) const;
 
+        /**
+         * Same as DeleteApplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteApplicationOutcomeCallable DeleteApplicationCallable(Model::DeleteApplicationRequest&& request) const;
+
         /**
          * <p>Deletes an application.</p>
          *
@@ -513,6 +656,11 @@ namespace Model
          */
         virtual void DeleteApplicationAsync(const Model::DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteApplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteApplicationAsync(Model::DeleteApplicationRequest&& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a deployment configuration.</p> <note>A deployment configuration
          * cannot be deleted if it is currently in use. Also, predefined configurations
@@ -529,6 +677,11 @@ namespace Model
          */
         virtual Model::DeleteDeploymentConfigOutcomeCallable DeleteDeploymentConfigCallable(const Model::DeleteDeploymentConfigRequest& request) const;
 
+        /**
+         * Same as DeleteDeploymentConfigCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDeploymentConfigOutcomeCallable DeleteDeploymentConfigCallable(Model::DeleteDeploymentConfigRequest&& request) const;
+
         /**
          * <p>Deletes a deployment configuration.</p> <note>A deployment configuration
          * cannot be deleted if it is currently in use. Also, predefined configurations
@@ -538,6 +691,11 @@ namespace Model
          */
         virtual void DeleteDeploymentConfigAsync(const Model::DeleteDeploymentConfigRequest& request, const DeleteDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDeploymentConfigAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDeploymentConfigAsync(Model::DeleteDeploymentConfigRequest&& request, const DeleteDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a deployment group.</p>
          */
@@ -550,6 +708,11 @@ namespace Model
          */
         virtual Model::DeleteDeploymentGroupOutcomeCallable DeleteDeploymentGroupCallable(const Model::DeleteDeploymentGroupRequest& request) const;
 
+        /**
+         * Same as DeleteDeploymentGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDeploymentGroupOutcomeCallable DeleteDeploymentGroupCallable(Model::DeleteDeploymentGroupRequest&& request) const;
+
         /**
          * <p>Deletes a deployment group.</p>
          *
@@ -557,6 +720,11 @@ namespace Model
          */
         virtual void DeleteDeploymentGroupAsync(const Model::DeleteDeploymentGroupRequest& request, const DeleteDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDeploymentGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDeploymentGroupAsync(Model::DeleteDeploymentGroupRequest&& request, const DeleteDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters an on-premises instance.</p>
          */
@@ -569,6 +737,11 @@ namespace Model
          */
         virtual Model::DeregisterOnPremisesInstanceOutcomeCallable DeregisterOnPremisesInstanceCallable(const Model::DeregisterOnPremisesInstanceRequest& request) const;
 
+        /**
+         * Same as DeregisterOnPremisesInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeregisterOnPremisesInstanceOutcomeCallable DeregisterOnPremisesInstanceCallable(Model::DeregisterOnPremisesInstanceRequest&& request) const;
+
         /**
          * <p>Deregisters an on-premises instance.</p>
          *
@@ -576,6 +749,11 @@ namespace Model
          */
         virtual void DeregisterOnPremisesInstanceAsync(const Model::DeregisterOnPremisesInstanceRequest& request, const DeregisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterOnPremisesInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeregisterOnPremisesInstanceAsync(Model::DeregisterOnPremisesInstanceRequest&& request, const DeregisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about an application.</p>
          */
@@ -588,6 +766,11 @@ namespace Model
          */
         virtual Model::GetApplicationOutcomeCallable GetApplicationCallable(const Model::GetApplicationRequest& request) const;
 
+        /**
+         * Same as GetApplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetApplicationOutcomeCallable GetApplicationCallable(Model::GetApplicationRequest&& request) const;
+
         /**
          * <p>Gets information about an application.</p>
          *
@@ -595,6 +778,11 @@ namespace Model
          */
         virtual void GetApplicationAsync(const Model::GetApplicationRequest& request, const GetApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetApplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetApplicationAsync(Model::GetApplicationRequest&& request, const GetApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about an application revision.</p>
          */
@@ -607,6 +795,11 @@ namespace Model
          */
         virtual Model::GetApplicationRevisionOutcomeCallable GetApplicationRevisionCallable(const Model::GetApplicationRevisionRequest& request) const;
 
+        /**
+         * Same as GetApplicationRevisionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetApplicationRevisionOutcomeCallable GetApplicationRevisionCallable(Model::GetApplicationRevisionRequest&& request) const;
+
         /**
          * <p>Gets information about an application revision.</p>
          *
@@ -614,6 +807,11 @@ namespace Model
          */
         virtual void GetApplicationRevisionAsync(const Model::GetApplicationRevisionRequest& request, const GetApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetApplicationRevisionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetApplicationRevisionAsync(Model::GetApplicationRevisionRequest&& request, const GetApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a deployment.</p>
          */
@@ -626,6 +824,11 @@ namespace Model
          */
         virtual Model::GetDeploymentOutcomeCallable GetDeploymentCallable(const Model::GetDeploymentRequest& request) const;
 
+        /**
+         * Same as GetDeploymentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDeploymentOutcomeCallable GetDeploymentCallable(Model::GetDeploymentRequest&& request) const;
+
         /**
          * <p>Gets information about a deployment.</p>
          *
@@ -633,6 +836,11 @@ namespace Model
          */
         virtual void GetDeploymentAsync(const Model::GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeploymentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDeploymentAsync(Model::GetDeploymentRequest&& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a deployment configuration.</p>
          */
@@ -645,6 +853,11 @@ namespace Model
          */
         virtual Model::GetDeploymentConfigOutcomeCallable GetDeploymentConfigCallable(const Model::GetDeploymentConfigRequest& request) const;
 
+        /**
+         * Same as GetDeploymentConfigCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDeploymentConfigOutcomeCallable GetDeploymentConfigCallable(Model::GetDeploymentConfigRequest&& request) const;
+
         /**
          * <p>Gets information about a deployment configuration.</p>
          *
@@ -652,6 +865,11 @@ namespace Model
          */
         virtual void GetDeploymentConfigAsync(const Model::GetDeploymentConfigRequest& request, const GetDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeploymentConfigAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDeploymentConfigAsync(Model::GetDeploymentConfigRequest&& request, const GetDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a deployment group.</p>
          */
@@ -664,6 +882,11 @@ namespace Model
          */
         virtual Model::GetDeploymentGroupOutcomeCallable GetDeploymentGroupCallable(const Model::GetDeploymentGroupRequest& request) const;
 
+        /**
+         * Same as GetDeploymentGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDeploymentGroupOutcomeCallable GetDeploymentGroupCallable(Model::GetDeploymentGroupRequest&& request) const;
+
         /**
          * <p>Gets information about a deployment group.</p>
          *
@@ -671,6 +894,11 @@ namespace Model
          */
         virtual void GetDeploymentGroupAsync(const Model::GetDeploymentGroupRequest& request, const GetDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeploymentGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDeploymentGroupAsync(Model::GetDeploymentGroupRequest&& request, const GetDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about an instance as part of a deployment.</p>
          */
@@ -683,6 +911,11 @@ namespace Model
          */
         virtual Model::GetDeploymentInstanceOutcomeCallable GetDeploymentInstanceCallable(const Model::GetDeploymentInstanceRequest& request) const;
 
+        /**
+         * Same as GetDeploymentInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDeploymentInstanceOutcomeCallable GetDeploymentInstanceCallable(Model::GetDeploymentInstanceRequest&& request) const;
+
         /**
          * <p>Gets information about an instance as part of a deployment.</p>
          *
@@ -690,6 +923,11 @@ namespace Model
          */
         virtual void GetDeploymentInstanceAsync(const Model::GetDeploymentInstanceRequest& request, const GetDeploymentInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeploymentInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDeploymentInstanceAsync(Model::GetDeploymentInstanceRequest&& request, const GetDeploymentInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about an on-premises instance.</p>
          */
@@ -702,6 +940,11 @@ namespace Model
          */
         virtual Model::GetOnPremisesInstanceOutcomeCallable GetOnPremisesInstanceCallable(const Model::GetOnPremisesInstanceRequest& request) const;
 
+        /**
+         * Same as GetOnPremisesInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetOnPremisesInstanceOutcomeCallable GetOnPremisesInstanceCallable(Model::GetOnPremisesInstanceRequest&& request) const;
+
         /**
          * <p>Gets information about an on-premises instance.</p>
          *
@@ -709,6 +952,11 @@ namespace Model
          */
         virtual void GetOnPremisesInstanceAsync(const Model::GetOnPremisesInstanceRequest& request, const GetOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetOnPremisesInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetOnPremisesInstanceAsync(Model::GetOnPremisesInstanceRequest&& request, const GetOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists information about revisions for an application.</p>
          */
@@ -721,6 +969,11 @@ namespace Model
          */
         virtual Model::ListApplicationRevisionsOutcomeCallable ListApplicationRevisionsCallable(const Model::ListApplicationRevisionsRequest& request) const;
 
+        /**
+         * Same as ListApplicationRevisionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListApplicationRevisionsOutcomeCallable ListApplicationRevisionsCallable(Model::ListApplicationRevisionsRequest&& request) const;
+
         /**
          * <p>Lists information about revisions for an application.</p>
          *
@@ -728,6 +981,11 @@ namespace Model
          */
         virtual void ListApplicationRevisionsAsync(const Model::ListApplicationRevisionsRequest& request, const ListApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListApplicationRevisionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListApplicationRevisionsAsync(Model::ListApplicationRevisionsRequest&& request, const ListApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the applications registered with the applicable IAM user or AWS
          * account.</p>
@@ -742,6 +1000,11 @@ namespace Model
          */
         virtual Model::ListApplicationsOutcomeCallable ListApplicationsCallable(const Model::ListApplicationsRequest& request) const;
 
+        /**
+         * Same as ListApplicationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListApplicationsOutcomeCallable ListApplicationsCallable(Model::ListApplicationsRequest&& request) const;
+
         /**
          * <p>Lists the applications registered with the applicable IAM user or AWS
          * account.</p>
@@ -750,6 +1013,11 @@ namespace Model
          */
         virtual void ListApplicationsAsync(const Model::ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListApplicationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListApplicationsAsync(Model::ListApplicationsRequest&& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the deployment configurations with the applicable IAM user or AWS
          * account.</p>
@@ -764,6 +1032,11 @@ namespace Model
          */
         virtual Model::ListDeploymentConfigsOutcomeCallable ListDeploymentConfigsCallable(const Model::ListDeploymentConfigsRequest& request) const;
 
+        /**
+         * Same as ListDeploymentConfigsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDeploymentConfigsOutcomeCallable ListDeploymentConfigsCallable(Model::ListDeploymentConfigsRequest&& request) const;
+
         /**
          * <p>Lists the deployment configurations with the applicable IAM user or AWS
          * account.</p>
@@ -772,6 +1045,11 @@ namespace Model
          */
         virtual void ListDeploymentConfigsAsync(const Model::ListDeploymentConfigsRequest& request, const ListDeploymentConfigsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDeploymentConfigsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDeploymentConfigsAsync(Model::ListDeploymentConfigsRequest&& request, const ListDeploymentConfigsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the deployment groups for an application registered with the applicable
          * IAM user or AWS account.</p>
@@ -786,6 +1064,11 @@ namespace Model
          */
         virtual Model::ListDeploymentGroupsOutcomeCallable ListDeploymentGroupsCallable(const Model::ListDeploymentGroupsRequest& request) const;
 
+        /**
+         * Same as ListDeploymentGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDeploymentGroupsOutcomeCallable ListDeploymentGroupsCallable(Model::ListDeploymentGroupsRequest&& request) const;
+
         /**
          * <p>Lists the deployment groups for an application registered with the applicable
          * IAM user or AWS account.</p>
@@ -794,6 +1077,11 @@ namespace Model
          */
         virtual void ListDeploymentGroupsAsync(const Model::ListDeploymentGroupsRequest& request, const ListDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDeploymentGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDeploymentGroupsAsync(Model::ListDeploymentGroupsRequest&& request, const ListDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the instances for a deployment associated with the applicable IAM user
          * or AWS account.</p>
@@ -808,6 +1096,11 @@ namespace Model
          */
         virtual Model::ListDeploymentInstancesOutcomeCallable ListDeploymentInstancesCallable(const Model::ListDeploymentInstancesRequest& request) const;
 
+        /**
+         * Same as ListDeploymentInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDeploymentInstancesOutcomeCallable ListDeploymentInstancesCallable(Model::ListDeploymentInstancesRequest&& request) const;
+
         /**
          * <p>Lists the instances for a deployment associated with the applicable IAM user
          * or AWS account.</p>
@@ -816,6 +1109,11 @@ namespace Model
          */
         virtual void ListDeploymentInstancesAsync(const Model::ListDeploymentInstancesRequest& request, const ListDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDeploymentInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDeploymentInstancesAsync(Model::ListDeploymentInstancesRequest&& request, const ListDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the deployments within a deployment group for an application registered
          * with the applicable IAM user or AWS account.</p>
@@ -830,6 +1128,11 @@ namespace Model
          */
         virtual Model::ListDeploymentsOutcomeCallable ListDeploymentsCallable(const Model::ListDeploymentsRequest& request) const;
 
+        /**
+         * Same as ListDeploymentsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDeploymentsOutcomeCallable ListDeploymentsCallable(Model::ListDeploymentsRequest&& request) const;
+
         /**
          * <p>Lists the deployments within a deployment group for an application registered
          * with the applicable IAM user or AWS account.</p>
@@ -838,6 +1141,11 @@ namespace Model
          */
         virtual void ListDeploymentsAsync(const Model::ListDeploymentsRequest& request, const ListDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDeploymentsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDeploymentsAsync(Model::ListDeploymentsRequest&& request, const ListDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a list of one or more on-premises instance names.</p> <p>Unless
          * otherwise specified, both registered and deregistered on-premises instance names
@@ -856,6 +1164,11 @@ namespace Model
          */
         virtual Model::ListOnPremisesInstancesOutcomeCallable ListOnPremisesInstancesCallable(const Model::ListOnPremisesInstancesRequest& request) const;
 
+        /**
+         * Same as ListOnPremisesInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListOnPremisesInstancesOutcomeCallable ListOnPremisesInstancesCallable(Model::ListOnPremisesInstancesRequest&& request) const;
+
         /**
          * <p>Gets a list of one or more on-premises instance names.</p> <p>Unless
          * otherwise specified, both registered and deregistered on-premises instance names
@@ -866,6 +1179,11 @@ namespace Model
          */
         virtual void ListOnPremisesInstancesAsync(const Model::ListOnPremisesInstancesRequest& request, const ListOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListOnPremisesInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListOnPremisesInstancesAsync(Model::ListOnPremisesInstancesRequest&& request, const ListOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers with AWS CodeDeploy a revision for the specified application.</p>
          */
@@ -878,6 +1196,11 @@ namespace Model
          */
         virtual Model::RegisterApplicationRevisionOutcomeCallable RegisterApplicationRevisionCallable(const Model::RegisterApplicationRevisionRequest& request) const;
 
+        /**
+         * Same as RegisterApplicationRevisionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterApplicationRevisionOutcomeCallable RegisterApplicationRevisionCallable(Model::RegisterApplicationRevisionRequest&& request) const;
+
         /**
          * <p>Registers with AWS CodeDeploy a revision for the specified application.</p>
          *
@@ -885,6 +1208,11 @@ namespace Model
          */
         virtual void RegisterApplicationRevisionAsync(const Model::RegisterApplicationRevisionRequest& request, const RegisterApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterApplicationRevisionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterApplicationRevisionAsync(Model::RegisterApplicationRevisionRequest&& request, const RegisterApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers an on-premises instance.</p>
          */
@@ -897,6 +1225,11 @@ namespace Model
          */
         virtual Model::RegisterOnPremisesInstanceOutcomeCallable RegisterOnPremisesInstanceCallable(const Model::RegisterOnPremisesInstanceRequest& request) const;
 
+        /**
+         * Same as RegisterOnPremisesInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterOnPremisesInstanceOutcomeCallable RegisterOnPremisesInstanceCallable(Model::RegisterOnPremisesInstanceRequest&& request) const;
+
         /**
          * <p>Registers an on-premises instance.</p>
          *
@@ -904,6 +1237,11 @@ namespace Model
          */
         virtual void RegisterOnPremisesInstanceAsync(const Model::RegisterOnPremisesInstanceRequest& request, const RegisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterOnPremisesInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterOnPremisesInstanceAsync(Model::RegisterOnPremisesInstanceRequest&& request, const RegisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes one or more tags from one or more on-premises instances.</p>
          */
@@ -916,6 +1254,11 @@ namespace Model
          */
         virtual Model::RemoveTagsFromOnPremisesInstancesOutcomeCallable RemoveTagsFromOnPremisesInstancesCallable(const Model::RemoveTagsFromOnPremisesInstancesRequest& request) const;
 
+        /**
+         * Same as RemoveTagsFromOnPremisesInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveTagsFromOnPremisesInstancesOutcomeCallable RemoveTagsFromOnPremisesInstancesCallable(Model::RemoveTagsFromOnPremisesInstancesRequest&& request) const;
+
         /**
          * <p>Removes one or more tags from one or more on-premises instances.</p>
          *
@@ -923,6 +1266,11 @@ namespace Model
          */
         virtual void RemoveTagsFromOnPremisesInstancesAsync(const Model::RemoveTagsFromOnPremisesInstancesRequest& request, const RemoveTagsFromOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromOnPremisesInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveTagsFromOnPremisesInstancesAsync(Model::RemoveTagsFromOnPremisesInstancesRequest&& request, const RemoveTagsFromOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attempts to stop an ongoing deployment.</p>
          */
@@ -935,6 +1283,11 @@ namespace Model
          */
         virtual Model::StopDeploymentOutcomeCallable StopDeploymentCallable(const Model::StopDeploymentRequest& request) const;
 
+        /**
+         * Same as StopDeploymentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StopDeploymentOutcomeCallable StopDeploymentCallable(Model::StopDeploymentRequest&& request) const;
+
         /**
          * <p>Attempts to stop an ongoing deployment.</p>
          *
@@ -942,6 +1295,11 @@ namespace Model
          */
         virtual void StopDeploymentAsync(const Model::StopDeploymentRequest& request, const StopDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopDeploymentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StopDeploymentAsync(Model::StopDeploymentRequest&& request, const StopDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes an existing application's name.</p>
          */
@@ -954,6 +1312,11 @@ namespace Model
          */
         virtual Model::UpdateApplicationOutcomeCallable UpdateApplicationCallable(const Model::UpdateApplicationRequest& request) const;
 
+        /**
+         * Same as UpdateApplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateApplicationOutcomeCallable UpdateApplicationCallable(Model::UpdateApplicationRequest&& request) const;
+
         /**
          * <p>Changes an existing application's name.</p>
          *
@@ -961,6 +1324,11 @@ namespace Model
          */
         virtual void UpdateApplicationAsync(const Model::UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateApplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateApplicationAsync(Model::UpdateApplicationRequest&& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes information about an existing deployment group.</p>
          */
@@ -973,6 +1341,11 @@ namespace Model
          */
         virtual Model::UpdateDeploymentGroupOutcomeCallable UpdateDeploymentGroupCallable(const Model::UpdateDeploymentGroupRequest& request) const;
 
+        /**
+         * Same as UpdateDeploymentGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateDeploymentGroupOutcomeCallable UpdateDeploymentGroupCallable(Model::UpdateDeploymentGroupRequest&& request) const;
+
         /**
          * <p>Changes information about an existing deployment group.</p>
          *
@@ -980,6 +1353,86 @@ namespace Model
          */
         virtual void UpdateDeploymentGroupAsync(const Model::UpdateDeploymentGroupRequest& request, const UpdateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDeploymentGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateDeploymentGroupAsync(Model::UpdateDeploymentGroupRequest&& request, const UpdateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsToOnPremisesInstancesOutcome> AddTagsToOnPremisesInstancesAwaitable(const Model::AddTagsToOnPremisesInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::AddTagsToOnPremisesInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsToOnPremisesInstancesOutcome> AddTagsToOnPremisesInstancesAwaitable(Model::AddTagsToOnPremisesInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::AddTagsToOnPremisesInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetApplicationRevisionsOutcome> BatchGetApplicationRevisionsAwaitable(const Model::BatchGetApplicationRevisionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::BatchGetApplicationRevisions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetApplicationRevisionsOutcome> BatchGetApplicationRevisionsAwaitable(Model::BatchGetApplicationRevisionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::BatchGetApplicationRevisions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetApplicationsOutcome> BatchGetApplicationsAwaitable(const Model::BatchGetApplicationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::BatchGetApplications, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetApplicationsOutcome> BatchGetApplicationsAwaitable(Model::BatchGetApplicationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::BatchGetApplications, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetDeploymentInstancesOutcome> BatchGetDeploymentInstancesAwaitable(const Model::BatchGetDeploymentInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::BatchGetDeploymentInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetDeploymentInstancesOutcome> BatchGetDeploymentInstancesAwaitable(Model::BatchGetDeploymentInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::BatchGetDeploymentInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetDeploymentsOutcome> BatchGetDeploymentsAwaitable(const Model::BatchGetDeploymentsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::BatchGetDeployments, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetDeploymentsOutcome> BatchGetDeploymentsAwaitable(Model::BatchGetDeploymentsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::BatchGetDeployments, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetOnPremisesInstancesOutcome> BatchGetOnPremisesInstancesAwaitable(const Model::BatchGetOnPremisesInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::BatchGetOnPremisesInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetOnPremisesInstancesOutcome> BatchGetOnPremisesInstancesAwaitable(Model::BatchGetOnPremisesInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::BatchGetOnPremisesInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateApplicationOutcome> CreateApplicationAwaitable(const Model::CreateApplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::CreateApplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateApplicationOutcome> CreateApplicationAwaitable(Model::CreateApplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::CreateApplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDeploymentOutcome> CreateDeploymentAwaitable(const Model::CreateDeploymentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::CreateDeployment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDeploymentOutcome> CreateDeploymentAwaitable(Model::CreateDeploymentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::CreateDeployment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDeploymentConfigOutcome> CreateDeploymentConfigAwaitable(const Model::CreateDeploymentConfigRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::CreateDeploymentConfig, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDeploymentConfigOutcome> CreateDeploymentConfigAwaitable(Model::CreateDeploymentConfigRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::CreateDeploymentConfig, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDeploymentGroupOutcome> CreateDeploymentGroupAwaitable(const Model::CreateDeploymentGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::CreateDeploymentGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDeploymentGroupOutcome> CreateDeploymentGroupAwaitable(Model::CreateDeploymentGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::CreateDeploymentGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteApplicationOutcome> DeleteApplicationAwaitable(const Model::DeleteApplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::DeleteApplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteApplicationOutcome> DeleteApplicationAwaitable(Model::DeleteApplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::DeleteApplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDeploymentConfigOutcome> DeleteDeploymentConfigAwaitable(const Model::DeleteDeploymentConfigRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::DeleteDeploymentConfig, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDeploymentConfigOutcome> DeleteDeploymentConfigAwaitable(Model::DeleteDeploymentConfigRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::DeleteDeploymentConfig, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDeploymentGroupOutcome> DeleteDeploymentGroupAwaitable(const Model::DeleteDeploymentGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::DeleteDeploymentGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDeploymentGroupOutcome> DeleteDeploymentGroupAwaitable(Model::DeleteDeploymentGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::DeleteDeploymentGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterOnPremisesInstanceOutcome> DeregisterOnPremisesInstanceAwaitable(const Model::DeregisterOnPremisesInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::DeregisterOnPremisesInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterOnPremisesInstanceOutcome> DeregisterOnPremisesInstanceAwaitable(Model::DeregisterOnPremisesInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::DeregisterOnPremisesInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetApplicationOutcome> GetApplicationAwaitable(const Model::GetApplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::GetApplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetApplicationOutcome> GetApplicationAwaitable(Model::GetApplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::GetApplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetApplicationRevisionOutcome> GetApplicationRevisionAwaitable(const Model::GetApplicationRevisionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::GetApplicationRevision, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetApplicationRevisionOutcome> GetApplicationRevisionAwaitable(Model::GetApplicationRevisionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::GetApplicationRevision, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDeploymentOutcome> GetDeploymentAwaitable(const Model::GetDeploymentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::GetDeployment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDeploymentOutcome> GetDeploymentAwaitable(Model::GetDeploymentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::GetDeployment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDeploymentConfigOutcome> GetDeploymentConfigAwaitable(const Model::GetDeploymentConfigRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::GetDeploymentConfig, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDeploymentConfigOutcome> GetDeploymentConfigAwaitable(Model::GetDeploymentConfigRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::GetDeploymentConfig, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDeploymentGroupOutcome> GetDeploymentGroupAwaitable(const Model::GetDeploymentGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::GetDeploymentGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDeploymentGroupOutcome> GetDeploymentGroupAwaitable(Model::GetDeploymentGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::GetDeploymentGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDeploymentInstanceOutcome> GetDeploymentInstanceAwaitable(const Model::GetDeploymentInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::GetDeploymentInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDeploymentInstanceOutcome> GetDeploymentInstanceAwaitable(Model::GetDeploymentInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::GetDeploymentInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetOnPremisesInstanceOutcome> GetOnPremisesInstanceAwaitable(const Model::GetOnPremisesInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::GetOnPremisesInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetOnPremisesInstanceOutcome> GetOnPremisesInstanceAwaitable(Model::GetOnPremisesInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::GetOnPremisesInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListApplicationRevisionsOutcome> ListApplicationRevisionsAwaitable(const Model::ListApplicationRevisionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::ListApplicationRevisions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListApplicationRevisionsOutcome> ListApplicationRevisionsAwaitable(Model::ListApplicationRevisionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::ListApplicationRevisions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListApplicationsOutcome> ListApplicationsAwaitable(const Model::ListApplicationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::ListApplications, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListApplicationsOutcome> ListApplicationsAwaitable(Model::ListApplicationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::ListApplications, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDeploymentConfigsOutcome> ListDeploymentConfigsAwaitable(const Model::ListDeploymentConfigsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::ListDeploymentConfigs, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDeploymentConfigsOutcome> ListDeploymentConfigsAwaitable(Model::ListDeploymentConfigsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::ListDeploymentConfigs, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDeploymentGroupsOutcome> ListDeploymentGroupsAwaitable(const Model::ListDeploymentGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::ListDeploymentGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDeploymentGroupsOutcome> ListDeploymentGroupsAwaitable(Model::ListDeploymentGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::ListDeploymentGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDeploymentInstancesOutcome> ListDeploymentInstancesAwaitable(const Model::ListDeploymentInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::ListDeploymentInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDeploymentInstancesOutcome> ListDeploymentInstancesAwaitable(Model::ListDeploymentInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::ListDeploymentInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDeploymentsOutcome> ListDeploymentsAwaitable(const Model::ListDeploymentsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::ListDeployments, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDeploymentsOutcome> ListDeploymentsAwaitable(Model::ListDeploymentsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::ListDeployments, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListOnPremisesInstancesOutcome> ListOnPremisesInstancesAwaitable(const Model::ListOnPremisesInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::ListOnPremisesInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListOnPremisesInstancesOutcome> ListOnPremisesInstancesAwaitable(Model::ListOnPremisesInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::ListOnPremisesInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterApplicationRevisionOutcome> RegisterApplicationRevisionAwaitable(const Model::RegisterApplicationRevisionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::RegisterApplicationRevision, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterApplicationRevisionOutcome> RegisterApplicationRevisionAwaitable(Model::RegisterApplicationRevisionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::RegisterApplicationRevision, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterOnPremisesInstanceOutcome> RegisterOnPremisesInstanceAwaitable(const Model::RegisterOnPremisesInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::RegisterOnPremisesInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterOnPremisesInstanceOutcome> RegisterOnPremisesInstanceAwaitable(Model::RegisterOnPremisesInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::RegisterOnPremisesInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsFromOnPremisesInstancesOutcome> RemoveTagsFromOnPremisesInstancesAwaitable(const Model::RemoveTagsFromOnPremisesInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::RemoveTagsFromOnPremisesInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsFromOnPremisesInstancesOutcome> RemoveTagsFromOnPremisesInstancesAwaitable(Model::RemoveTagsFromOnPremisesInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::RemoveTagsFromOnPremisesInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopDeploymentOutcome> StopDeploymentAwaitable(const Model::StopDeploymentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::StopDeployment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopDeploymentOutcome> StopDeploymentAwaitable(Model::StopDeploymentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::StopDeployment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateApplicationOutcome> UpdateApplicationAwaitable(const Model::UpdateApplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::UpdateApplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateApplicationOutcome> UpdateApplicationAwaitable(Model::UpdateApplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::UpdateApplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDeploymentGroupOutcome> UpdateDeploymentGroupAwaitable(const Model::UpdateDeploymentGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::UpdateDeploymentGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDeploymentGroupOutcome> UpdateDeploymentGroupAwaitable(Model::UpdateDeploymentGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodeDeployClient::UpdateDeploymentGroup, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
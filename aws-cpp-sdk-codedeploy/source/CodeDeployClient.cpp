@@ -141,12 +141,22 @@ AddTagsToOnPremisesInstancesOutcome CodeDeployClient::AddTagsToOnPremisesInstanc
 
 AddTagsToOnPremisesInstancesOutcomeCallable CodeDeployClient::AddTagsToOnPremisesInstancesCallable(const AddTagsToOnPremisesInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::AddTagsToOnPremisesInstances, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::AddTagsToOnPremisesInstances, Aws::Client::RejectedCallOutcome<AddTagsToOnPremisesInstancesOutcome>(), this, request);
+}
+
+AddTagsToOnPremisesInstancesOutcomeCallable CodeDeployClient::AddTagsToOnPremisesInstancesCallable(AddTagsToOnPremisesInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::AddTagsToOnPremisesInstances, Aws::Client::RejectedCallOutcome<AddTagsToOnPremisesInstancesOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::AddTagsToOnPremisesInstancesAsync(const AddTagsToOnPremisesInstancesRequest& request, const AddTagsToOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::AddTagsToOnPremisesInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::AddTagsToOnPremisesInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsToOnPremisesInstancesOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::AddTagsToOnPremisesInstancesAsync(AddTagsToOnPremisesInstancesRequest&& request, const AddTagsToOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::AddTagsToOnPremisesInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsToOnPremisesInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::AddTagsToOnPremisesInstancesAsyncHelper(const AddTagsToOnPremisesInstancesRequest& request, const AddTagsToOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -172,12 +182,22 @@ BatchGetApplicationRevisionsOutcome CodeDeployClient::BatchGetApplicationRevisio
 
 BatchGetApplicationRevisionsOutcomeCallable CodeDeployClient::BatchGetApplicationRevisionsCallable(const BatchGetApplicationRevisionsRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::BatchGetApplicationRevisions, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::BatchGetApplicationRevisions, Aws::Client::RejectedCallOutcome<BatchGetApplicationRevisionsOutcome>(), this, request);
+}
+
+BatchGetApplicationRevisionsOutcomeCallable CodeDeployClient::BatchGetApplicationRevisionsCallable(BatchGetApplicationRevisionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::BatchGetApplicationRevisions, Aws::Client::RejectedCallOutcome<BatchGetApplicationRevisionsOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::BatchGetApplicationRevisionsAsync(const BatchGetApplicationRevisionsRequest& request, const BatchGetApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::BatchGetApplicationRevisionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::BatchGetApplicationRevisionsAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetApplicationRevisionsOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::BatchGetApplicationRevisionsAsync(BatchGetApplicationRevisionsRequest&& request, const BatchGetApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::BatchGetApplicationRevisionsAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetApplicationRevisionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::BatchGetApplicationRevisionsAsyncHelper(const BatchGetApplicationRevisionsRequest& request, const BatchGetApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -203,12 +223,22 @@ BatchGetApplicationsOutcome CodeDeployClient::BatchGetApplications(const BatchGe
 
 BatchGetApplicationsOutcomeCallable CodeDeployClient::BatchGetApplicationsCallable(const BatchGetApplicationsRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::BatchGetApplications, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::BatchGetApplications, Aws::Client::RejectedCallOutcome<BatchGetApplicationsOutcome>(), this, request);
+}
+
+BatchGetApplicationsOutcomeCallable CodeDeployClient::BatchGetApplicationsCallable(BatchGetApplicationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::BatchGetApplications, Aws::Client::RejectedCallOutcome<BatchGetApplicationsOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::BatchGetApplicationsAsync(const BatchGetApplicationsRequest& request, const BatchGetApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::BatchGetApplicationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::BatchGetApplicationsAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetApplicationsOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::BatchGetApplicationsAsync(BatchGetApplicationsRequest&& request, const BatchGetApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::BatchGetApplicationsAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetApplicationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::BatchGetApplicationsAsyncHelper(const BatchGetApplicationsRequest& request, const BatchGetApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -234,12 +264,22 @@ BatchGetDeploymentInstancesOutcome CodeDeployClient::BatchGetDeploymentInstances
 
 BatchGetDeploymentInstancesOutcomeCallable CodeDeployClient::BatchGetDeploymentInstancesCallable(const BatchGetDeploymentInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::BatchGetDeploymentInstances, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::BatchGetDeploymentInstances, Aws::Client::RejectedCallOutcome<BatchGetDeploymentInstancesOutcome>(), this, request);
+}
+
+BatchGetDeploymentInstancesOutcomeCallable CodeDeployClient::BatchGetDeploymentInstancesCallable(BatchGetDeploymentInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::BatchGetDeploymentInstances, Aws::Client::RejectedCallOutcome<BatchGetDeploymentInstancesOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::BatchGetDeploymentInstancesAsync(const BatchGetDeploymentInstancesRequest& request, const BatchGetDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::BatchGetDeploymentInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::BatchGetDeploymentInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetDeploymentInstancesOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::BatchGetDeploymentInstancesAsync(BatchGetDeploymentInstancesRequest&& request, const BatchGetDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::BatchGetDeploymentInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetDeploymentInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::BatchGetDeploymentInstancesAsyncHelper(const BatchGetDeploymentInstancesRequest& request, const BatchGetDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -265,12 +305,22 @@ BatchGetDeploymentsOutcome CodeDeployClient::BatchGetDeployments(const BatchGetD
 
 BatchGetDeploymentsOutcomeCallable CodeDeployClient::BatchGetDeploymentsCallable(const BatchGetDeploymentsRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::BatchGetDeployments, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::BatchGetDeployments, Aws::Client::RejectedCallOutcome<BatchGetDeploymentsOutcome>(), this, request);
+}
+
+BatchGetDeploymentsOutcomeCallable CodeDeployClient::BatchGetDeploymentsCallable(BatchGetDeploymentsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::BatchGetDeployments, Aws::Client::RejectedCallOutcome<BatchGetDeploymentsOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::BatchGetDeploymentsAsync(const BatchGetDeploymentsRequest& request, const BatchGetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::BatchGetDeploymentsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::BatchGetDeploymentsAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetDeploymentsOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::BatchGetDeploymentsAsync(BatchGetDeploymentsRequest&& request, const BatchGetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::BatchGetDeploymentsAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetDeploymentsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::BatchGetDeploymentsAsyncHelper(const BatchGetDeploymentsRequest& request, const BatchGetDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -296,12 +346,22 @@ BatchGetOnPremisesInstancesOutcome CodeDeployClient::BatchGetOnPremisesInstances
 
 BatchGetOnPremisesInstancesOutcomeCallable CodeDeployClient::BatchGetOnPremisesInstancesCallable(const BatchGetOnPremisesInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::BatchGetOnPremisesInstances, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::BatchGetOnPremisesInstances, Aws::Client::RejectedCallOutcome<BatchGetOnPremisesInstancesOutcome>(), this, request);
+}
+
+BatchGetOnPremisesInstancesOutcomeCallable CodeDeployClient::BatchGetOnPremisesInstancesCallable(BatchGetOnPremisesInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::BatchGetOnPremisesInstances, Aws::Client::RejectedCallOutcome<BatchGetOnPremisesInstancesOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::BatchGetOnPremisesInstancesAsync(const BatchGetOnPremisesInstancesRequest& request, const BatchGetOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::BatchGetOnPremisesInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::BatchGetOnPremisesInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetOnPremisesInstancesOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::BatchGetOnPremisesInstancesAsync(BatchGetOnPremisesInstancesRequest&& request, const BatchGetOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::BatchGetOnPremisesInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetOnPremisesInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::BatchGetOnPremisesInstancesAsyncHelper(const BatchGetOnPremisesInstancesRequest& request, const BatchGetOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -327,12 +387,22 @@ CreateApplicationOutcome CodeDeployClient::CreateApplication(const CreateApplica
 
 CreateApplicationOutcomeCallable CodeDeployClient::CreateApplicationCallable(const CreateApplicationRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::CreateApplication, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::CreateApplication, Aws::Client::RejectedCallOutcome<CreateApplicationOutcome>(), this, request);
+}
+
+CreateApplicationOutcomeCallable CodeDeployClient::CreateApplicationCallable(CreateApplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::CreateApplication, Aws::Client::RejectedCallOutcome<CreateApplicationOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::CreateApplicationAsync(const CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::CreateApplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::CreateApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateApplicationOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::CreateApplicationAsync(CreateApplicationRequest&& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::CreateApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateApplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::CreateApplicationAsyncHelper(const CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -358,12 +428,22 @@ CreateDeploymentOutcome CodeDeployClient::CreateDeployment(const CreateDeploymen
 
 CreateDeploymentOutcomeCallable CodeDeployClient::CreateDeploymentCallable(const CreateDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::CreateDeployment, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::CreateDeployment, Aws::Client::RejectedCallOutcome<CreateDeploymentOutcome>(), this, request);
+}
+
+CreateDeploymentOutcomeCallable CodeDeployClient::CreateDeploymentCallable(CreateDeploymentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::CreateDeployment, Aws::Client::RejectedCallOutcome<CreateDeploymentOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::CreateDeploymentAsync(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::CreateDeploymentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::CreateDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDeploymentOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::CreateDeploymentAsync(CreateDeploymentRequest&& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::CreateDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDeploymentOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::CreateDeploymentAsyncHelper(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -389,12 +469,22 @@ CreateDeploymentConfigOutcome CodeDeployClient::CreateDeploymentConfig(const Cre
 
 CreateDeploymentConfigOutcomeCallable CodeDeployClient::CreateDeploymentConfigCallable(const CreateDeploymentConfigRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::CreateDeploymentConfig, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::CreateDeploymentConfig, Aws::Client::RejectedCallOutcome<CreateDeploymentConfigOutcome>(), this, request);
+}
+
+CreateDeploymentConfigOutcomeCallable CodeDeployClient::CreateDeploymentConfigCallable(CreateDeploymentConfigRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::CreateDeploymentConfig, Aws::Client::RejectedCallOutcome<CreateDeploymentConfigOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::CreateDeploymentConfigAsync(const CreateDeploymentConfigRequest& request, const CreateDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::CreateDeploymentConfigAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::CreateDeploymentConfigAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDeploymentConfigOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::CreateDeploymentConfigAsync(CreateDeploymentConfigRequest&& request, const CreateDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::CreateDeploymentConfigAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDeploymentConfigOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::CreateDeploymentConfigAsyncHelper(const CreateDeploymentConfigRequest& request, const CreateDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -420,12 +510,22 @@ CreateDeploymentGroupOutcome CodeDeployClient::CreateDeploymentGroup(const Creat
 
 CreateDeploymentGroupOutcomeCallable CodeDeployClient::CreateDeploymentGroupCallable(const CreateDeploymentGroupRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::CreateDeploymentGroup, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::CreateDeploymentGroup, Aws::Client::RejectedCallOutcome<CreateDeploymentGroupOutcome>(), this, request);
+}
+
+CreateDeploymentGroupOutcomeCallable CodeDeployClient::CreateDeploymentGroupCallable(CreateDeploymentGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::CreateDeploymentGroup, Aws::Client::RejectedCallOutcome<CreateDeploymentGroupOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::CreateDeploymentGroupAsync(const CreateDeploymentGroupRequest& request, const CreateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::CreateDeploymentGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::CreateDeploymentGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDeploymentGroupOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::CreateDeploymentGroupAsync(CreateDeploymentGroupRequest&& request, const CreateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::CreateDeploymentGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDeploymentGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::CreateDeploymentGroupAsyncHelper(const CreateDeploymentGroupRequest& request, const CreateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -451,12 +551,22 @@ DeleteApplicationOutcome CodeDeployClient::DeleteApplication(const DeleteApplica
 
 DeleteApplicationOutcomeCallable CodeDeployClient::DeleteApplicationCallable(const DeleteApplicationRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::DeleteApplication, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::DeleteApplication, Aws::Client::RejectedCallOutcome<DeleteApplicationOutcome>(), this, request);
+}
+
+DeleteApplicationOutcomeCallable CodeDeployClient::DeleteApplicationCallable(DeleteApplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::DeleteApplication, Aws::Client::RejectedCallOutcome<DeleteApplicationOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::DeleteApplicationAsync(const DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::DeleteApplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::DeleteApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteApplicationOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::DeleteApplicationAsync(DeleteApplicationRequest&& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::DeleteApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteApplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::DeleteApplicationAsyncHelper(const DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -482,12 +592,22 @@ DeleteDeploymentConfigOutcome CodeDeployClient::DeleteDeploymentConfig(const Del
 
 DeleteDeploymentConfigOutcomeCallable CodeDeployClient::DeleteDeploymentConfigCallable(const DeleteDeploymentConfigRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::DeleteDeploymentConfig, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::DeleteDeploymentConfig, Aws::Client::RejectedCallOutcome<DeleteDeploymentConfigOutcome>(), this, request);
+}
+
+DeleteDeploymentConfigOutcomeCallable CodeDeployClient::DeleteDeploymentConfigCallable(DeleteDeploymentConfigRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::DeleteDeploymentConfig, Aws::Client::RejectedCallOutcome<DeleteDeploymentConfigOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::DeleteDeploymentConfigAsync(const DeleteDeploymentConfigRequest& request, const DeleteDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::DeleteDeploymentConfigAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::DeleteDeploymentConfigAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDeploymentConfigOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::DeleteDeploymentConfigAsync(DeleteDeploymentConfigRequest&& request, const DeleteDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::DeleteDeploymentConfigAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDeploymentConfigOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::DeleteDeploymentConfigAsyncHelper(const DeleteDeploymentConfigRequest& request, const DeleteDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -513,12 +633,22 @@ DeleteDeploymentGroupOutcome CodeDeployClient::DeleteDeploymentGroup(const Delet
 
 DeleteDeploymentGroupOutcomeCallable CodeDeployClient::DeleteDeploymentGroupCallable(const DeleteDeploymentGroupRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::DeleteDeploymentGroup, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::DeleteDeploymentGroup, Aws::Client::RejectedCallOutcome<DeleteDeploymentGroupOutcome>(), this, request);
+}
+
+DeleteDeploymentGroupOutcomeCallable CodeDeployClient::DeleteDeploymentGroupCallable(DeleteDeploymentGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::DeleteDeploymentGroup, Aws::Client::RejectedCallOutcome<DeleteDeploymentGroupOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::DeleteDeploymentGroupAsync(const DeleteDeploymentGroupRequest& request, const DeleteDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::DeleteDeploymentGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::DeleteDeploymentGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDeploymentGroupOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::DeleteDeploymentGroupAsync(DeleteDeploymentGroupRequest&& request, const DeleteDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::DeleteDeploymentGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDeploymentGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::DeleteDeploymentGroupAsyncHelper(const DeleteDeploymentGroupRequest& request, const DeleteDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -544,12 +674,22 @@ DeregisterOnPremisesInstanceOutcome CodeDeployClient::DeregisterOnPremisesInstan
 
 DeregisterOnPremisesInstanceOutcomeCallable CodeDeployClient::DeregisterOnPremisesInstanceCallable(const DeregisterOnPremisesInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::DeregisterOnPremisesInstance, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::DeregisterOnPremisesInstance, Aws::Client::RejectedCallOutcome<DeregisterOnPremisesInstanceOutcome>(), this, request);
+}
+
+DeregisterOnPremisesInstanceOutcomeCallable CodeDeployClient::DeregisterOnPremisesInstanceCallable(DeregisterOnPremisesInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::DeregisterOnPremisesInstance, Aws::Client::RejectedCallOutcome<DeregisterOnPremisesInstanceOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::DeregisterOnPremisesInstanceAsync(const DeregisterOnPremisesInstanceRequest& request, const DeregisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::DeregisterOnPremisesInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::DeregisterOnPremisesInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterOnPremisesInstanceOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::DeregisterOnPremisesInstanceAsync(DeregisterOnPremisesInstanceRequest&& request, const DeregisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::DeregisterOnPremisesInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterOnPremisesInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::DeregisterOnPremisesInstanceAsyncHelper(const DeregisterOnPremisesInstanceRequest& request, const DeregisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -575,12 +715,22 @@ GetApplicationOutcome CodeDeployClient::GetApplication(const GetApplicationReque
 
 GetApplicationOutcomeCallable CodeDeployClient::GetApplicationCallable(const GetApplicationRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::GetApplication, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::GetApplication, Aws::Client::RejectedCallOutcome<GetApplicationOutcome>(), this, request);
+}
+
+GetApplicationOutcomeCallable CodeDeployClient::GetApplicationCallable(GetApplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::GetApplication, Aws::Client::RejectedCallOutcome<GetApplicationOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::GetApplicationAsync(const GetApplicationRequest& request, const GetApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::GetApplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::GetApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<GetApplicationOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::GetApplicationAsync(GetApplicationRequest&& request, const GetApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::GetApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<GetApplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::GetApplicationAsyncHelper(const GetApplicationRequest& request, const GetApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -606,12 +756,22 @@ GetApplicationRevisionOutcome CodeDeployClient::GetApplicationRevision(const Get
 
 GetApplicationRevisionOutcomeCallable CodeDeployClient::GetApplicationRevisionCallable(const GetApplicationRevisionRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::GetApplicationRevision, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::GetApplicationRevision, Aws::Client::RejectedCallOutcome<GetApplicationRevisionOutcome>(), this, request);
+}
+
+GetApplicationRevisionOutcomeCallable CodeDeployClient::GetApplicationRevisionCallable(GetApplicationRevisionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::GetApplicationRevision, Aws::Client::RejectedCallOutcome<GetApplicationRevisionOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::GetApplicationRevisionAsync(const GetApplicationRevisionRequest& request, const GetApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::GetApplicationRevisionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::GetApplicationRevisionAsyncHelper, Aws::Client::RejectedAsyncCall<GetApplicationRevisionOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::GetApplicationRevisionAsync(GetApplicationRevisionRequest&& request, const GetApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::GetApplicationRevisionAsyncHelper, Aws::Client::RejectedAsyncCall<GetApplicationRevisionOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::GetApplicationRevisionAsyncHelper(const GetApplicationRevisionRequest& request, const GetApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -637,12 +797,22 @@ GetDeploymentOutcome CodeDeployClient::GetDeployment(const GetDeploymentRequest&
 
 GetDeploymentOutcomeCallable CodeDeployClient::GetDeploymentCallable(const GetDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::GetDeployment, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::GetDeployment, Aws::Client::RejectedCallOutcome<GetDeploymentOutcome>(), this, request);
+}
+
+GetDeploymentOutcomeCallable CodeDeployClient::GetDeploymentCallable(GetDeploymentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::GetDeployment, Aws::Client::RejectedCallOutcome<GetDeploymentOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::GetDeploymentAsync(const GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::GetDeploymentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::GetDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<GetDeploymentOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::GetDeploymentAsync(GetDeploymentRequest&& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::GetDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<GetDeploymentOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::GetDeploymentAsyncHelper(const GetDeploymentRequest& request, const GetDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -668,12 +838,22 @@ GetDeploymentConfigOutcome CodeDeployClient::GetDeploymentConfig(const GetDeploy
 
 GetDeploymentConfigOutcomeCallable CodeDeployClient::GetDeploymentConfigCallable(const GetDeploymentConfigRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::GetDeploymentConfig, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::GetDeploymentConfig, Aws::Client::RejectedCallOutcome<GetDeploymentConfigOutcome>(), this, request);
+}
+
+GetDeploymentConfigOutcomeCallable CodeDeployClient::GetDeploymentConfigCallable(GetDeploymentConfigRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::GetDeploymentConfig, Aws::Client::RejectedCallOutcome<GetDeploymentConfigOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::GetDeploymentConfigAsync(const GetDeploymentConfigRequest& request, const GetDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::GetDeploymentConfigAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::GetDeploymentConfigAsyncHelper, Aws::Client::RejectedAsyncCall<GetDeploymentConfigOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::GetDeploymentConfigAsync(GetDeploymentConfigRequest&& request, const GetDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::GetDeploymentConfigAsyncHelper, Aws::Client::RejectedAsyncCall<GetDeploymentConfigOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::GetDeploymentConfigAsyncHelper(const GetDeploymentConfigRequest& request, const GetDeploymentConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -699,12 +879,22 @@ GetDeploymentGroupOutcome CodeDeployClient::GetDeploymentGroup(const GetDeployme
 
 GetDeploymentGroupOutcomeCallable CodeDeployClient::GetDeploymentGroupCallable(const GetDeploymentGroupRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::GetDeploymentGroup, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::GetDeploymentGroup, Aws::Client::RejectedCallOutcome<GetDeploymentGroupOutcome>(), this, request);
+}
+
+GetDeploymentGroupOutcomeCallable CodeDeployClient::GetDeploymentGroupCallable(GetDeploymentGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::GetDeploymentGroup, Aws::Client::RejectedCallOutcome<GetDeploymentGroupOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::GetDeploymentGroupAsync(const GetDeploymentGroupRequest& request, const GetDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::GetDeploymentGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::GetDeploymentGroupAsyncHelper, Aws::Client::RejectedAsyncCall<GetDeploymentGroupOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::GetDeploymentGroupAsync(GetDeploymentGroupRequest&& request, const GetDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::GetDeploymentGroupAsyncHelper, Aws::Client::RejectedAsyncCall<GetDeploymentGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::GetDeploymentGroupAsyncHelper(const GetDeploymentGroupRequest& request, const GetDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -730,12 +920,22 @@ GetDeploymentInstanceOutcome CodeDeployClient::GetDeploymentInstance(const GetDe
 
 GetDeploymentInstanceOutcomeCallable CodeDeployClient::GetDeploymentInstanceCallable(const GetDeploymentInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::GetDeploymentInstance, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::GetDeploymentInstance, Aws::Client::RejectedCallOutcome<GetDeploymentInstanceOutcome>(), this, request);
+}
+
+GetDeploymentInstanceOutcomeCallable CodeDeployClient::GetDeploymentInstanceCallable(GetDeploymentInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::GetDeploymentInstance, Aws::Client::RejectedCallOutcome<GetDeploymentInstanceOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::GetDeploymentInstanceAsync(const GetDeploymentInstanceRequest& request, const GetDeploymentInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::GetDeploymentInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::GetDeploymentInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<GetDeploymentInstanceOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::GetDeploymentInstanceAsync(GetDeploymentInstanceRequest&& request, const GetDeploymentInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::GetDeploymentInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<GetDeploymentInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::GetDeploymentInstanceAsyncHelper(const GetDeploymentInstanceRequest& request, const GetDeploymentInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -761,12 +961,22 @@ GetOnPremisesInstanceOutcome CodeDeployClient::GetOnPremisesInstance(const GetOn
 
 GetOnPremisesInstanceOutcomeCallable CodeDeployClient::GetOnPremisesInstanceCallable(const GetOnPremisesInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::GetOnPremisesInstance, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::GetOnPremisesInstance, Aws::Client::RejectedCallOutcome<GetOnPremisesInstanceOutcome>(), this, request);
+}
+
+GetOnPremisesInstanceOutcomeCallable CodeDeployClient::GetOnPremisesInstanceCallable(GetOnPremisesInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::GetOnPremisesInstance, Aws::Client::RejectedCallOutcome<GetOnPremisesInstanceOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::GetOnPremisesInstanceAsync(const GetOnPremisesInstanceRequest& request, const GetOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::GetOnPremisesInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::GetOnPremisesInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<GetOnPremisesInstanceOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::GetOnPremisesInstanceAsync(GetOnPremisesInstanceRequest&& request, const GetOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::GetOnPremisesInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<GetOnPremisesInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::GetOnPremisesInstanceAsyncHelper(const GetOnPremisesInstanceRequest& request, const GetOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -792,12 +1002,22 @@ ListApplicationRevisionsOutcome CodeDeployClient::ListApplicationRevisions(const
 
 ListApplicationRevisionsOutcomeCallable CodeDeployClient::ListApplicationRevisionsCallable(const ListApplicationRevisionsRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::ListApplicationRevisions, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::ListApplicationRevisions, Aws::Client::RejectedCallOutcome<ListApplicationRevisionsOutcome>(), this, request);
+}
+
+ListApplicationRevisionsOutcomeCallable CodeDeployClient::ListApplicationRevisionsCallable(ListApplicationRevisionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::ListApplicationRevisions, Aws::Client::RejectedCallOutcome<ListApplicationRevisionsOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::ListApplicationRevisionsAsync(const ListApplicationRevisionsRequest& request, const ListApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::ListApplicationRevisionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::ListApplicationRevisionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListApplicationRevisionsOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::ListApplicationRevisionsAsync(ListApplicationRevisionsRequest&& request, const ListApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::ListApplicationRevisionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListApplicationRevisionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::ListApplicationRevisionsAsyncHelper(const ListApplicationRevisionsRequest& request, const ListApplicationRevisionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -823,12 +1043,22 @@ ListApplicationsOutcome CodeDeployClient::ListApplications(const ListApplication
 
 ListApplicationsOutcomeCallable CodeDeployClient::ListApplicationsCallable(const ListApplicationsRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::ListApplications, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::ListApplications, Aws::Client::RejectedCallOutcome<ListApplicationsOutcome>(), this, request);
+}
+
+ListApplicationsOutcomeCallable CodeDeployClient::ListApplicationsCallable(ListApplicationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::ListApplications, Aws::Client::RejectedCallOutcome<ListApplicationsOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::ListApplicationsAsync(const ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::ListApplicationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::ListApplicationsAsyncHelper, Aws::Client::RejectedAsyncCall<ListApplicationsOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::ListApplicationsAsync(ListApplicationsRequest&& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::ListApplicationsAsyncHelper, Aws::Client::RejectedAsyncCall<ListApplicationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::ListApplicationsAsyncHelper(const ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -854,12 +1084,22 @@ ListDeploymentConfigsOutcome CodeDeployClient::ListDeploymentConfigs(const ListD
 
 ListDeploymentConfigsOutcomeCallable CodeDeployClient::ListDeploymentConfigsCallable(const ListDeploymentConfigsRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::ListDeploymentConfigs, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::ListDeploymentConfigs, Aws::Client::RejectedCallOutcome<ListDeploymentConfigsOutcome>(), this, request);
+}
+
+ListDeploymentConfigsOutcomeCallable CodeDeployClient::ListDeploymentConfigsCallable(ListDeploymentConfigsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::ListDeploymentConfigs, Aws::Client::RejectedCallOutcome<ListDeploymentConfigsOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::ListDeploymentConfigsAsync(const ListDeploymentConfigsRequest& request, const ListDeploymentConfigsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::ListDeploymentConfigsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::ListDeploymentConfigsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDeploymentConfigsOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::ListDeploymentConfigsAsync(ListDeploymentConfigsRequest&& request, const ListDeploymentConfigsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::ListDeploymentConfigsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDeploymentConfigsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::ListDeploymentConfigsAsyncHelper(const ListDeploymentConfigsRequest& request, const ListDeploymentConfigsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -885,12 +1125,22 @@ ListDeploymentGroupsOutcome CodeDeployClient::ListDeploymentGroups(const ListDep
 
 ListDeploymentGroupsOutcomeCallable CodeDeployClient::ListDeploymentGroupsCallable(const ListDeploymentGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::ListDeploymentGroups, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::ListDeploymentGroups, Aws::Client::RejectedCallOutcome<ListDeploymentGroupsOutcome>(), this, request);
+}
+
+ListDeploymentGroupsOutcomeCallable CodeDeployClient::ListDeploymentGroupsCallable(ListDeploymentGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::ListDeploymentGroups, Aws::Client::RejectedCallOutcome<ListDeploymentGroupsOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::ListDeploymentGroupsAsync(const ListDeploymentGroupsRequest& request, const ListDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::ListDeploymentGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::ListDeploymentGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDeploymentGroupsOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::ListDeploymentGroupsAsync(ListDeploymentGroupsRequest&& request, const ListDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::ListDeploymentGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDeploymentGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::ListDeploymentGroupsAsyncHelper(const ListDeploymentGroupsRequest& request, const ListDeploymentGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -916,12 +1166,22 @@ ListDeploymentInstancesOutcome CodeDeployClient::ListDeploymentInstances(const L
 
 ListDeploymentInstancesOutcomeCallable CodeDeployClient::ListDeploymentInstancesCallable(const ListDeploymentInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::ListDeploymentInstances, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::ListDeploymentInstances, Aws::Client::RejectedCallOutcome<ListDeploymentInstancesOutcome>(), this, request);
+}
+
+ListDeploymentInstancesOutcomeCallable CodeDeployClient::ListDeploymentInstancesCallable(ListDeploymentInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::ListDeploymentInstances, Aws::Client::RejectedCallOutcome<ListDeploymentInstancesOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::ListDeploymentInstancesAsync(const ListDeploymentInstancesRequest& request, const ListDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::ListDeploymentInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::ListDeploymentInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<ListDeploymentInstancesOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::ListDeploymentInstancesAsync(ListDeploymentInstancesRequest&& request, const ListDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::ListDeploymentInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<ListDeploymentInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::ListDeploymentInstancesAsyncHelper(const ListDeploymentInstancesRequest& request, const ListDeploymentInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -947,12 +1207,22 @@ ListDeploymentsOutcome CodeDeployClient::ListDeployments(const ListDeploymentsRe
 
 ListDeploymentsOutcomeCallable CodeDeployClient::ListDeploymentsCallable(const ListDeploymentsRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::ListDeployments, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::ListDeployments, Aws::Client::RejectedCallOutcome<ListDeploymentsOutcome>(), this, request);
+}
+
+ListDeploymentsOutcomeCallable CodeDeployClient::ListDeploymentsCallable(ListDeploymentsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::ListDeployments, Aws::Client::RejectedCallOutcome<ListDeploymentsOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::ListDeploymentsAsync(const ListDeploymentsRequest& request, const ListDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::ListDeploymentsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::ListDeploymentsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDeploymentsOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::ListDeploymentsAsync(ListDeploymentsRequest&& request, const ListDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::ListDeploymentsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDeploymentsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::ListDeploymentsAsyncHelper(const ListDeploymentsRequest& request, const ListDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -978,12 +1248,22 @@ ListOnPremisesInstancesOutcome CodeDeployClient::ListOnPremisesInstances(const L
 
 ListOnPremisesInstancesOutcomeCallable CodeDeployClient::ListOnPremisesInstancesCallable(const ListOnPremisesInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::ListOnPremisesInstances, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::ListOnPremisesInstances, Aws::Client::RejectedCallOutcome<ListOnPremisesInstancesOutcome>(), this, request);
+}
+
+ListOnPremisesInstancesOutcomeCallable CodeDeployClient::ListOnPremisesInstancesCallable(ListOnPremisesInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::ListOnPremisesInstances, Aws::Client::RejectedCallOutcome<ListOnPremisesInstancesOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::ListOnPremisesInstancesAsync(const ListOnPremisesInstancesRequest& request, const ListOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::ListOnPremisesInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::ListOnPremisesInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<ListOnPremisesInstancesOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::ListOnPremisesInstancesAsync(ListOnPremisesInstancesRequest&& request, const ListOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::ListOnPremisesInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<ListOnPremisesInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::ListOnPremisesInstancesAsyncHelper(const ListOnPremisesInstancesRequest& request, const ListOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1009,12 +1289,22 @@ RegisterApplicationRevisionOutcome CodeDeployClient::RegisterApplicationRevision
 
 RegisterApplicationRevisionOutcomeCallable CodeDeployClient::RegisterApplicationRevisionCallable(const RegisterApplicationRevisionRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::RegisterApplicationRevision, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::RegisterApplicationRevision, Aws::Client::RejectedCallOutcome<RegisterApplicationRevisionOutcome>(), this, request);
+}
+
+RegisterApplicationRevisionOutcomeCallable CodeDeployClient::RegisterApplicationRevisionCallable(RegisterApplicationRevisionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::RegisterApplicationRevision, Aws::Client::RejectedCallOutcome<RegisterApplicationRevisionOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::RegisterApplicationRevisionAsync(const RegisterApplicationRevisionRequest& request, const RegisterApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::RegisterApplicationRevisionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::RegisterApplicationRevisionAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterApplicationRevisionOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::RegisterApplicationRevisionAsync(RegisterApplicationRevisionRequest&& request, const RegisterApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::RegisterApplicationRevisionAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterApplicationRevisionOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::RegisterApplicationRevisionAsyncHelper(const RegisterApplicationRevisionRequest& request, const RegisterApplicationRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1040,12 +1330,22 @@ RegisterOnPremisesInstanceOutcome CodeDeployClient::RegisterOnPremisesInstance(c
 
 RegisterOnPremisesInstanceOutcomeCallable CodeDeployClient::RegisterOnPremisesInstanceCallable(const RegisterOnPremisesInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::RegisterOnPremisesInstance, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::RegisterOnPremisesInstance, Aws::Client::RejectedCallOutcome<RegisterOnPremisesInstanceOutcome>(), this, request);
+}
+
+RegisterOnPremisesInstanceOutcomeCallable CodeDeployClient::RegisterOnPremisesInstanceCallable(RegisterOnPremisesInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::RegisterOnPremisesInstance, Aws::Client::RejectedCallOutcome<RegisterOnPremisesInstanceOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::RegisterOnPremisesInstanceAsync(const RegisterOnPremisesInstanceRequest& request, const RegisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::RegisterOnPremisesInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::RegisterOnPremisesInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterOnPremisesInstanceOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::RegisterOnPremisesInstanceAsync(RegisterOnPremisesInstanceRequest&& request, const RegisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::RegisterOnPremisesInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterOnPremisesInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::RegisterOnPremisesInstanceAsyncHelper(const RegisterOnPremisesInstanceRequest& request, const RegisterOnPremisesInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1071,12 +1371,22 @@ RemoveTagsFromOnPremisesInstancesOutcome CodeDeployClient::RemoveTagsFromOnPremi
 
 RemoveTagsFromOnPremisesInstancesOutcomeCallable CodeDeployClient::RemoveTagsFromOnPremisesInstancesCallable(const RemoveTagsFromOnPremisesInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::RemoveTagsFromOnPremisesInstances, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::RemoveTagsFromOnPremisesInstances, Aws::Client::RejectedCallOutcome<RemoveTagsFromOnPremisesInstancesOutcome>(), this, request);
+}
+
+RemoveTagsFromOnPremisesInstancesOutcomeCallable CodeDeployClient::RemoveTagsFromOnPremisesInstancesCallable(RemoveTagsFromOnPremisesInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::RemoveTagsFromOnPremisesInstances, Aws::Client::RejectedCallOutcome<RemoveTagsFromOnPremisesInstancesOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::RemoveTagsFromOnPremisesInstancesAsync(const RemoveTagsFromOnPremisesInstancesRequest& request, const RemoveTagsFromOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::RemoveTagsFromOnPremisesInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::RemoveTagsFromOnPremisesInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsFromOnPremisesInstancesOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::RemoveTagsFromOnPremisesInstancesAsync(RemoveTagsFromOnPremisesInstancesRequest&& request, const RemoveTagsFromOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::RemoveTagsFromOnPremisesInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsFromOnPremisesInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::RemoveTagsFromOnPremisesInstancesAsyncHelper(const RemoveTagsFromOnPremisesInstancesRequest& request, const RemoveTagsFromOnPremisesInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1102,12 +1412,22 @@ StopDeploymentOutcome CodeDeployClient::StopDeployment(const StopDeploymentReque
 
 StopDeploymentOutcomeCallable CodeDeployClient::StopDeploymentCallable(const StopDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::StopDeployment, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::StopDeployment, Aws::Client::RejectedCallOutcome<StopDeploymentOutcome>(), this, request);
+}
+
+StopDeploymentOutcomeCallable CodeDeployClient::StopDeploymentCallable(StopDeploymentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::StopDeployment, Aws::Client::RejectedCallOutcome<StopDeploymentOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::StopDeploymentAsync(const StopDeploymentRequest& request, const StopDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::StopDeploymentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::StopDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<StopDeploymentOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::StopDeploymentAsync(StopDeploymentRequest&& request, const StopDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::StopDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<StopDeploymentOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::StopDeploymentAsyncHelper(const StopDeploymentRequest& request, const StopDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1133,12 +1453,22 @@ UpdateApplicationOutcome CodeDeployClient::UpdateApplication(const UpdateApplica
 
 UpdateApplicationOutcomeCallable CodeDeployClient::UpdateApplicationCallable(const UpdateApplicationRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::UpdateApplication, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::UpdateApplication, Aws::Client::RejectedCallOutcome<UpdateApplicationOutcome>(), this, request);
+}
+
+UpdateApplicationOutcomeCallable CodeDeployClient::UpdateApplicationCallable(UpdateApplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::UpdateApplication, Aws::Client::RejectedCallOutcome<UpdateApplicationOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::UpdateApplicationAsync(const UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::UpdateApplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::UpdateApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateApplicationOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::UpdateApplicationAsync(UpdateApplicationRequest&& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::UpdateApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateApplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::UpdateApplicationAsyncHelper(const UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1164,12 +1494,22 @@ UpdateDeploymentGroupOutcome CodeDeployClient::UpdateDeploymentGroup(const Updat
 
 UpdateDeploymentGroupOutcomeCallable CodeDeployClient::UpdateDeploymentGroupCallable(const UpdateDeploymentGroupRequest& request) const
 {
-  return std::async(std::launch::async, &CodeDeployClient::UpdateDeploymentGroup, this, request);
+  return m_executor->SubmitWithFuture(&CodeDeployClient::UpdateDeploymentGroup, Aws::Client::RejectedCallOutcome<UpdateDeploymentGroupOutcome>(), this, request);
+}
+
+UpdateDeploymentGroupOutcomeCallable CodeDeployClient::UpdateDeploymentGroupCallable(UpdateDeploymentGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodeDeployClient::UpdateDeploymentGroup, Aws::Client::RejectedCallOutcome<UpdateDeploymentGroupOutcome>(), this, std::move(request));
 }
 
 void CodeDeployClient::UpdateDeploymentGroupAsync(const UpdateDeploymentGroupRequest& request, const UpdateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodeDeployClient::UpdateDeploymentGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodeDeployClient::UpdateDeploymentGroupAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDeploymentGroupOutcome>(), this, request, handler, context);
+}
+
+void CodeDeployClient::UpdateDeploymentGroupAsync(UpdateDeploymentGroupRequest&& request, const UpdateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodeDeployClient::UpdateDeploymentGroupAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDeploymentGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodeDeployClient::UpdateDeploymentGroupAsyncHelper(const UpdateDeploymentGroupRequest& request, const UpdateDeploymentGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
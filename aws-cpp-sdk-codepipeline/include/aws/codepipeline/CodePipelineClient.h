@@ -38,6 +38,33 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/codepipeline/model/AcknowledgeJobRequest.h>
+#include <aws/codepipeline/model/AcknowledgeThirdPartyJobRequest.h>
+#include <aws/codepipeline/model/CreateCustomActionTypeRequest.h>
+#include <aws/codepipeline/model/CreatePipelineRequest.h>
+#include <aws/codepipeline/model/DeleteCustomActionTypeRequest.h>
+#include <aws/codepipeline/model/DeletePipelineRequest.h>
+#include <aws/codepipeline/model/DisableStageTransitionRequest.h>
+#include <aws/codepipeline/model/EnableStageTransitionRequest.h>
+#include <aws/codepipeline/model/GetJobDetailsRequest.h>
+#include <aws/codepipeline/model/GetPipelineRequest.h>
+#include <aws/codepipeline/model/GetPipelineStateRequest.h>
+#include <aws/codepipeline/model/GetThirdPartyJobDetailsRequest.h>
+#include <aws/codepipeline/model/ListActionTypesRequest.h>
+#include <aws/codepipeline/model/ListPipelinesRequest.h>
+#include <aws/codepipeline/model/PollForJobsRequest.h>
+#include <aws/codepipeline/model/PollForThirdPartyJobsRequest.h>
+#include <aws/codepipeline/model/PutActionRevisionRequest.h>
+#include <aws/codepipeline/model/PutJobFailureResultRequest.h>
+#include <aws/codepipeline/model/PutJobSuccessResultRequest.h>
+#include <aws/codepipeline/model/PutThirdPartyJobFailureResultRequest.h>
+#include <aws/codepipeline/model/PutThirdPartyJobSuccessResultRequest.h>
+#include <aws/codepipeline/model/StartPipelineExecutionRequest.h>
+#include <aws/codepipeline/model/UpdatePipelineRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -290,6 +317,11 @@ namespace Model
          */
         virtual Model::AcknowledgeJobOutcomeCallable AcknowledgeJobCallable(const Model::AcknowledgeJobRequest& request) const;
 
+        /**
+         * Same as AcknowledgeJobCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AcknowledgeJobOutcomeCallable AcknowledgeJobCallable(Model::AcknowledgeJobRequest&& request) const;
+
         /**
          * <p>Returns information about a specified job and whether that job has been
          * received by the job worker. Only used for custom actions.</p>
@@ -298,6 +330,11 @@ namespace Model
          */
         virtual void AcknowledgeJobAsync(const Model::AcknowledgeJobRequest& request, const AcknowledgeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AcknowledgeJobAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AcknowledgeJobAsync(Model::AcknowledgeJobRequest&& request, const AcknowledgeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Confirms a job worker has received the specified job. Only used for partner
          * actions.</p>
@@ -312,6 +349,11 @@ namespace Model
          */
         virtual Model::AcknowledgeThirdPartyJobOutcomeCallable AcknowledgeThirdPartyJobCallable(const Model::AcknowledgeThirdPartyJobRequest& request) const;
 
+        /**
+         * Same as AcknowledgeThirdPartyJobCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AcknowledgeThirdPartyJobOutcomeCallable AcknowledgeThirdPartyJobCallable(Model::AcknowledgeThirdPartyJobRequest&& request) const;
+
         /**
          * <p>Confirms a job worker has received the specified job. Only used for partner
          * actions.</p>
@@ -320,6 +362,11 @@ namespace Model
          */
         virtual void AcknowledgeThirdPartyJobAsync(const Model::AcknowledgeThirdPartyJobRequest& request, const AcknowledgeThirdPartyJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AcknowledgeThirdPartyJobAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AcknowledgeThirdPartyJobAsync(Model::AcknowledgeThirdPartyJobRequest&& request, const AcknowledgeThirdPartyJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new custom action that can be used in all pipelines associated with
          * the AWS account. Only used for custom actions.</p>
@@ -334,6 +381,11 @@ namespace Model
          */
         virtual Model::CreateCustomActionTypeOutcomeCallable CreateCustomActionTypeCallable(const Model::CreateCustomActionTypeRequest& request) const;
 
+        /**
+         * Same as CreateCustomActionTypeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateCustomActionTypeOutcomeCallable CreateCustomActionTypeCallable(Model::CreateCustomActionTypeRequest&& request) const;
+
         /**
          * <p>Creates a new custom action that can be used in all pipelines associated with
          * the AWS account. Only used for custom actions.</p>
@@ -342,6 +394,11 @@ namespace Model
          */
         virtual void CreateCustomActionTypeAsync(const Model::CreateCustomActionTypeRequest& request, const CreateCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCustomActionTypeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateCustomActionTypeAsync(Model::CreateCustomActionTypeRequest&& request, const CreateCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a pipeline.</p>
          */
@@ -354,6 +411,11 @@ namespace Model
          */
         virtual Model::CreatePipelineOutcomeCallable CreatePipelineCallable(const Model::CreatePipelineRequest& request) const;
 
+        /**
+         * Same as CreatePipelineCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePipelineOutcomeCallable CreatePipelineCallable(Model::CreatePipelineRequest&& request) const;
+
         /**
          * <p>Creates a pipeline.</p>
          *
@@ -361,6 +423,11 @@ namespace Model
          */
         virtual void CreatePipelineAsync(const Model::CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePipelineAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePipelineAsync(Model::CreatePipelineRequest&& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Marks a custom action as deleted. PollForJobs for the custom action will fail
          * after the action is marked for deletion. Only used for custom actions.</p>
@@ -379,6 +446,11 @@ namespace Model
          */
         virtual Model::DeleteCustomActionTypeOutcomeCallable DeleteCustomActionTypeCallable(const Model::DeleteCustomActionTypeRequest& request) const;
 
+        /**
+         * Same as DeleteCustomActionTypeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteCustomActionTypeOutcomeCallable DeleteCustomActionTypeCallable(Model::DeleteCustomActionTypeRequest&& request) const;
+
         /**
          * <p>Marks a custom action as deleted. PollForJobs for the custom action will fail
          * after the action is marked for deletion. Only used for custom actions.</p>
@@ -389,6 +461,11 @@ namespace Model
          */
         virtual void DeleteCustomActionTypeAsync(const Model::DeleteCustomActionTypeRequest& request, const DeleteCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCustomActionTypeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteCustomActionTypeAsync(Model::DeleteCustomActionTypeRequest&& request, const DeleteCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified pipeline.</p>
          */
@@ -401,6 +478,11 @@ namespace Model
          */
         virtual Model::DeletePipelineOutcomeCallable DeletePipelineCallable(const Model::DeletePipelineRequest& request) const;
 
+        /**
+         * Same as DeletePipelineCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeletePipelineOutcomeCallable DeletePipelineCallable(Model::DeletePipelineRequest&& request) const;
+
         /**
          * <p>Deletes the specified pipeline.</p>
          *
@@ -408,6 +490,11 @@ namespace Model
          */
         virtual void DeletePipelineAsync(const Model::DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePipelineAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeletePipelineAsync(Model::DeletePipelineRequest&& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Prevents artifacts in a pipeline from transitioning to the next stage in the
          * pipeline. </p>
@@ -422,6 +509,11 @@ namespace Model
          */
         virtual Model::DisableStageTransitionOutcomeCallable DisableStageTransitionCallable(const Model::DisableStageTransitionRequest& request) const;
 
+        /**
+         * Same as DisableStageTransitionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableStageTransitionOutcomeCallable DisableStageTransitionCallable(Model::DisableStageTransitionRequest&& request) const;
+
         /**
          * <p>Prevents artifacts in a pipeline from transitioning to the next stage in the
          * pipeline. </p>
@@ -430,6 +522,11 @@ namespace Model
          */
         virtual void DisableStageTransitionAsync(const Model::DisableStageTransitionRequest& request, const DisableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableStageTransitionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableStageTransitionAsync(Model::DisableStageTransitionRequest&& request, const DisableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables artifacts in a pipeline to transition to a stage in a pipeline.</p>
          */
@@ -442,6 +539,11 @@ namespace Model
          */
         virtual Model::EnableStageTransitionOutcomeCallable EnableStageTransitionCallable(const Model::EnableStageTransitionRequest& request) const;
 
+        /**
+         * Same as EnableStageTransitionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableStageTransitionOutcomeCallable EnableStageTransitionCallable(Model::EnableStageTransitionRequest&& request) const;
+
         /**
          * <p>Enables artifacts in a pipeline to transition to a stage in a pipeline.</p>
          *
@@ -449,6 +551,11 @@ namespace Model
          */
         virtual void EnableStageTransitionAsync(const Model::EnableStageTransitionRequest& request, const EnableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableStageTransitionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableStageTransitionAsync(Model::EnableStageTransitionRequest&& request, const EnableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about a job. Only used for custom actions.</p>
          * <important><p>When this API is called, AWS CodePipeline returns temporary
@@ -471,6 +578,11 @@ namespace Model
          */
         virtual Model::GetJobDetailsOutcomeCallable GetJobDetailsCallable(const Model::GetJobDetailsRequest& request) const;
 
+        /**
+         * Same as GetJobDetailsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetJobDetailsOutcomeCallable GetJobDetailsCallable(Model::GetJobDetailsRequest&& request) const;
+
         /**
          * <p>Returns information about a job. Only used for custom actions.</p>
          * <important><p>When this API is called, AWS CodePipeline returns temporary
@@ -483,6 +595,11 @@ namespace Model
          */
         virtual void GetJobDetailsAsync(const Model::GetJobDetailsRequest& request, const GetJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetJobDetailsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetJobDetailsAsync(Model::GetJobDetailsRequest&& request, const GetJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the metadata, structure, stages, and actions of a pipeline. Can be
          * used to return the entire structure of a pipeline in JSON format, which can then
@@ -501,6 +618,11 @@ namespace Model
          */
         virtual Model::GetPipelineOutcomeCallable GetPipelineCallable(const Model::GetPipelineRequest& request) const;
 
+        /**
+         * Same as GetPipelineCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetPipelineOutcomeCallable GetPipelineCallable(Model::GetPipelineRequest&& request) const;
+
         /**
          * <p>Returns the metadata, structure, stages, and actions of a pipeline. Can be
          * used to return the entire structure of a pipeline in JSON format, which can then
@@ -511,6 +633,11 @@ namespace Model
          */
         virtual void GetPipelineAsync(const Model::GetPipelineRequest& request, const GetPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPipelineAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetPipelineAsync(Model::GetPipelineRequest&& request, const GetPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the state of a pipeline, including the stages,
          * actions, and details about the last run of the pipeline.</p>
@@ -525,6 +652,11 @@ namespace Model
          */
         virtual Model::GetPipelineStateOutcomeCallable GetPipelineStateCallable(const Model::GetPipelineStateRequest& request) const;
 
+        /**
+         * Same as GetPipelineStateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetPipelineStateOutcomeCallable GetPipelineStateCallable(Model::GetPipelineStateRequest&& request) const;
+
         /**
          * <p>Returns information about the state of a pipeline, including the stages,
          * actions, and details about the last run of the pipeline.</p>
@@ -533,6 +665,11 @@ namespace Model
          */
         virtual void GetPipelineStateAsync(const Model::GetPipelineStateRequest& request, const GetPipelineStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPipelineStateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetPipelineStateAsync(Model::GetPipelineStateRequest&& request, const GetPipelineStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests the details of a job for a third party action. Only used for partner
          * actions.</p> <important><p>When this API is called, AWS CodePipeline returns
@@ -555,6 +692,11 @@ namespace Model
          */
         virtual Model::GetThirdPartyJobDetailsOutcomeCallable GetThirdPartyJobDetailsCallable(const Model::GetThirdPartyJobDetailsRequest& request) const;
 
+        /**
+         * Same as GetThirdPartyJobDetailsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetThirdPartyJobDetailsOutcomeCallable GetThirdPartyJobDetailsCallable(Model::GetThirdPartyJobDetailsRequest&& request) const;
+
         /**
          * <p>Requests the details of a job for a third party action. Only used for partner
          * actions.</p> <important><p>When this API is called, AWS CodePipeline returns
@@ -567,6 +709,11 @@ namespace Model
          */
         virtual void GetThirdPartyJobDetailsAsync(const Model::GetThirdPartyJobDetailsRequest& request, const GetThirdPartyJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetThirdPartyJobDetailsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetThirdPartyJobDetailsAsync(Model::GetThirdPartyJobDetailsRequest&& request, const GetThirdPartyJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a summary of all AWS CodePipeline action types associated with your
          * account.</p>
@@ -581,6 +728,11 @@ namespace Model
          */
         virtual Model::ListActionTypesOutcomeCallable ListActionTypesCallable(const Model::ListActionTypesRequest& request) const;
 
+        /**
+         * Same as ListActionTypesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListActionTypesOutcomeCallable ListActionTypesCallable(Model::ListActionTypesRequest&& request) const;
+
         /**
          * <p>Gets a summary of all AWS CodePipeline action types associated with your
          * account.</p>
@@ -589,6 +741,11 @@ namespace Model
          */
         virtual void ListActionTypesAsync(const Model::ListActionTypesRequest& request, const ListActionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListActionTypesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListActionTypesAsync(Model::ListActionTypesRequest&& request, const ListActionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a summary of all of the pipelines associated with your account.</p>
          */
@@ -601,6 +758,11 @@ namespace Model
          */
         virtual Model::ListPipelinesOutcomeCallable ListPipelinesCallable(const Model::ListPipelinesRequest& request) const;
 
+        /**
+         * Same as ListPipelinesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListPipelinesOutcomeCallable ListPipelinesCallable(Model::ListPipelinesRequest&& request) const;
+
         /**
          * <p>Gets a summary of all of the pipelines associated with your account.</p>
          *
@@ -608,6 +770,11 @@ namespace Model
          */
         virtual void ListPipelinesAsync(const Model::ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPipelinesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListPipelinesAsync(Model::ListPipelinesRequest&& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about any jobs for AWS CodePipeline to act upon.</p>
          * <important><p>When this API is called, AWS CodePipeline returns temporary
@@ -630,6 +797,11 @@ namespace Model
          */
         virtual Model::PollForJobsOutcomeCallable PollForJobsCallable(const Model::PollForJobsRequest& request) const;
 
+        /**
+         * Same as PollForJobsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PollForJobsOutcomeCallable PollForJobsCallable(Model::PollForJobsRequest&& request) const;
+
         /**
          * <p>Returns information about any jobs for AWS CodePipeline to act upon.</p>
          * <important><p>When this API is called, AWS CodePipeline returns temporary
@@ -642,6 +814,11 @@ namespace Model
          */
         virtual void PollForJobsAsync(const Model::PollForJobsRequest& request, const PollForJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PollForJobsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PollForJobsAsync(Model::PollForJobsRequest&& request, const PollForJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Determines whether there are any third party jobs for a job worker to act on.
          * Only used for partner actions.</p> <important><p>When this API is called, AWS
@@ -662,6 +839,11 @@ namespace Model
          */
         virtual Model::PollForThirdPartyJobsOutcomeCallable PollForThirdPartyJobsCallable(const Model::PollForThirdPartyJobsRequest& request) const;
 
+        /**
+         * Same as PollForThirdPartyJobsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PollForThirdPartyJobsOutcomeCallable PollForThirdPartyJobsCallable(Model::PollForThirdPartyJobsRequest&& request) const;
+
         /**
          * <p>Determines whether there are any third party jobs for a job worker to act on.
          * Only used for partner actions.</p> <important><p>When this API is called, AWS
@@ -673,6 +855,11 @@ namespace Model
          */
         virtual void PollForThirdPartyJobsAsync(const Model::PollForThirdPartyJobsRequest& request, const PollForThirdPartyJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PollForThirdPartyJobsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PollForThirdPartyJobsAsync(Model::PollForThirdPartyJobsRequest&& request, const PollForThirdPartyJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides information to AWS CodePipeline about new revisions to a source.</p>
          */
@@ -685,6 +872,11 @@ namespace Model
          */
         virtual Model::PutActionRevisionOutcomeCallable PutActionRevisionCallable(const Model::PutActionRevisionRequest& request) const;
 
+        /**
+         * Same as PutActionRevisionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutActionRevisionOutcomeCallable PutActionRevisionCallable(Model::PutActionRevisionRequest&& request) const;
+
         /**
          * <p>Provides information to AWS CodePipeline about new revisions to a source.</p>
          *
@@ -692,6 +884,11 @@ namespace Model
          */
         virtual void PutActionRevisionAsync(const Model::PutActionRevisionRequest& request, const PutActionRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutActionRevisionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutActionRevisionAsync(Model::PutActionRevisionRequest&& request, const PutActionRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents the failure of a job as returned to the pipeline by a job worker.
          * Only used for custom actions.</p>
@@ -706,6 +903,11 @@ namespace Model
          */
         virtual Model::PutJobFailureResultOutcomeCallable PutJobFailureResultCallable(const Model::PutJobFailureResultRequest& request) const;
 
+        /**
+         * Same as PutJobFailureResultCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutJobFailureResultOutcomeCallable PutJobFailureResultCallable(Model::PutJobFailureResultRequest&& request) const;
+
         /**
          * <p>Represents the failure of a job as returned to the pipeline by a job worker.
          * Only used for custom actions.</p>
@@ -714,6 +916,11 @@ namespace Model
          */
         virtual void PutJobFailureResultAsync(const Model::PutJobFailureResultRequest& request, const PutJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutJobFailureResultAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutJobFailureResultAsync(Model::PutJobFailureResultRequest&& request, const PutJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents the success of a job as returned to the pipeline by a job worker.
          * Only used for custom actions.</p>
@@ -728,6 +935,11 @@ namespace Model
          */
         virtual Model::PutJobSuccessResultOutcomeCallable PutJobSuccessResultCallable(const Model::PutJobSuccessResultRequest& request) const;
 
+        /**
+         * Same as PutJobSuccessResultCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutJobSuccessResultOutcomeCallable PutJobSuccessResultCallable(Model::PutJobSuccessResultRequest&& request) const;
+
         /**
          * <p>Represents the success of a job as returned to the pipeline by a job worker.
          * Only used for custom actions.</p>
@@ -736,6 +948,11 @@ namespace Model
          */
         virtual void PutJobSuccessResultAsync(const Model::PutJobSuccessResultRequest& request, const PutJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutJobSuccessResultAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutJobSuccessResultAsync(Model::PutJobSuccessResultRequest&& request, const PutJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents the failure of a third party job as returned to the pipeline by a
          * job worker. Only used for partner actions.</p>
@@ -750,6 +967,11 @@ namespace Model
          */
         virtual Model::PutThirdPartyJobFailureResultOutcomeCallable PutThirdPartyJobFailureResultCallable(const Model::PutThirdPartyJobFailureResultRequest& request) const;
 
+        /**
+         * Same as PutThirdPartyJobFailureResultCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutThirdPartyJobFailureResultOutcomeCallable PutThirdPartyJobFailureResultCallable(Model::PutThirdPartyJobFailureResultRequest&& request) const;
+
         /**
          * <p>Represents the failure of a third party job as returned to the pipeline by a
          * job worker. Only used for partner actions.</p>
@@ -758,6 +980,11 @@ namespace Model
          */
         virtual void PutThirdPartyJobFailureResultAsync(const Model::PutThirdPartyJobFailureResultRequest& request, const PutThirdPartyJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutThirdPartyJobFailureResultAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutThirdPartyJobFailureResultAsync(Model::PutThirdPartyJobFailureResultRequest&& request, const PutThirdPartyJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Represents the success of a third party job as returned to the pipeline by a
          * job worker. Only used for partner actions.</p>
@@ -772,6 +999,11 @@ namespace Model
          */
         virtual Model::PutThirdPartyJobSuccessResultOutcomeCallable PutThirdPartyJobSuccessResultCallable(const Model::PutThirdPartyJobSuccessResultRequest& request) const;
 
+        /**
+         * Same as PutThirdPartyJobSuccessResultCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutThirdPartyJobSuccessResultOutcomeCallable PutThirdPartyJobSuccessResultCallable(Model::PutThirdPartyJobSuccessResultRequest&& request) const;
+
         /**
          * <p>Represents the success of a third party job as returned to the pipeline by a
          * job worker. Only used for partner actions.</p>
@@ -780,6 +1012,11 @@ namespace Model
          */
         virtual void PutThirdPartyJobSuccessResultAsync(const Model::PutThirdPartyJobSuccessResultRequest& request, const PutThirdPartyJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutThirdPartyJobSuccessResultAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutThirdPartyJobSuccessResultAsync(Model::PutThirdPartyJobSuccessResultRequest&& request, const PutThirdPartyJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts the specified pipeline. Specifically, it begins processing the latest
          * commit to the source location specified as part of the pipeline.</p>
@@ -794,6 +1031,11 @@ namespace Model
          */
         virtual Model::StartPipelineExecutionOutcomeCallable StartPipelineExecutionCallable(const Model::StartPipelineExecutionRequest& request) const;
 
+        /**
+         * Same as StartPipelineExecutionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StartPipelineExecutionOutcomeCallable StartPipelineExecutionCallable(Model::StartPipelineExecutionRequest&& request) const;
+
         /**
          * <p>Starts the specified pipeline. Specifically, it begins processing the latest
          * commit to the source location specified as part of the pipeline.</p>
@@ -802,6 +1044,11 @@ namespace Model
          */
         virtual void StartPipelineExecutionAsync(const Model::StartPipelineExecutionRequest& request, const StartPipelineExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartPipelineExecutionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StartPipelineExecutionAsync(Model::StartPipelineExecutionRequest&& request, const StartPipelineExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a specified pipeline with edits or changes to its structure. Use a
          * JSON file with the pipeline structure in conjunction with UpdatePipeline to
@@ -820,6 +1067,11 @@ namespace Model
          */
         virtual Model::UpdatePipelineOutcomeCallable UpdatePipelineCallable(const Model::UpdatePipelineRequest& request) const;
 
+        /**
+         * Same as UpdatePipelineCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdatePipelineOutcomeCallable UpdatePipelineCallable(Model::UpdatePipelineRequest&& request) const;
+
         /**
          * <p>Updates a specified pipeline with edits or changes to its structure. Use a
          * JSON file with the pipeline structure in conjunction with UpdatePipeline to
@@ -830,6 +1082,64 @@ namespace Model
          */
         virtual void UpdatePipelineAsync(const Model::UpdatePipelineRequest& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdatePipelineAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdatePipelineAsync(Model::UpdatePipelineRequest&& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AcknowledgeJobOutcome> AcknowledgeJobAwaitable(const Model::AcknowledgeJobRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::AcknowledgeJob, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AcknowledgeJobOutcome> AcknowledgeJobAwaitable(Model::AcknowledgeJobRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::AcknowledgeJob, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AcknowledgeThirdPartyJobOutcome> AcknowledgeThirdPartyJobAwaitable(const Model::AcknowledgeThirdPartyJobRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::AcknowledgeThirdPartyJob, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AcknowledgeThirdPartyJobOutcome> AcknowledgeThirdPartyJobAwaitable(Model::AcknowledgeThirdPartyJobRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::AcknowledgeThirdPartyJob, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCustomActionTypeOutcome> CreateCustomActionTypeAwaitable(const Model::CreateCustomActionTypeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::CreateCustomActionType, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCustomActionTypeOutcome> CreateCustomActionTypeAwaitable(Model::CreateCustomActionTypeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::CreateCustomActionType, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePipelineOutcome> CreatePipelineAwaitable(const Model::CreatePipelineRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::CreatePipeline, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePipelineOutcome> CreatePipelineAwaitable(Model::CreatePipelineRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::CreatePipeline, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCustomActionTypeOutcome> DeleteCustomActionTypeAwaitable(const Model::DeleteCustomActionTypeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::DeleteCustomActionType, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCustomActionTypeOutcome> DeleteCustomActionTypeAwaitable(Model::DeleteCustomActionTypeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::DeleteCustomActionType, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePipelineOutcome> DeletePipelineAwaitable(const Model::DeletePipelineRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::DeletePipeline, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePipelineOutcome> DeletePipelineAwaitable(Model::DeletePipelineRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::DeletePipeline, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableStageTransitionOutcome> DisableStageTransitionAwaitable(const Model::DisableStageTransitionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::DisableStageTransition, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableStageTransitionOutcome> DisableStageTransitionAwaitable(Model::DisableStageTransitionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::DisableStageTransition, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableStageTransitionOutcome> EnableStageTransitionAwaitable(const Model::EnableStageTransitionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::EnableStageTransition, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableStageTransitionOutcome> EnableStageTransitionAwaitable(Model::EnableStageTransitionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::EnableStageTransition, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetJobDetailsOutcome> GetJobDetailsAwaitable(const Model::GetJobDetailsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::GetJobDetails, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetJobDetailsOutcome> GetJobDetailsAwaitable(Model::GetJobDetailsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::GetJobDetails, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPipelineOutcome> GetPipelineAwaitable(const Model::GetPipelineRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::GetPipeline, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPipelineOutcome> GetPipelineAwaitable(Model::GetPipelineRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::GetPipeline, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPipelineStateOutcome> GetPipelineStateAwaitable(const Model::GetPipelineStateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::GetPipelineState, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPipelineStateOutcome> GetPipelineStateAwaitable(Model::GetPipelineStateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::GetPipelineState, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetThirdPartyJobDetailsOutcome> GetThirdPartyJobDetailsAwaitable(const Model::GetThirdPartyJobDetailsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::GetThirdPartyJobDetails, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetThirdPartyJobDetailsOutcome> GetThirdPartyJobDetailsAwaitable(Model::GetThirdPartyJobDetailsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::GetThirdPartyJobDetails, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListActionTypesOutcome> ListActionTypesAwaitable(const Model::ListActionTypesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::ListActionTypes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListActionTypesOutcome> ListActionTypesAwaitable(Model::ListActionTypesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::ListActionTypes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPipelinesOutcome> ListPipelinesAwaitable(const Model::ListPipelinesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::ListPipelines, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPipelinesOutcome> ListPipelinesAwaitable(Model::ListPipelinesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::ListPipelines, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PollForJobsOutcome> PollForJobsAwaitable(const Model::PollForJobsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::PollForJobs, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PollForJobsOutcome> PollForJobsAwaitable(Model::PollForJobsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::PollForJobs, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PollForThirdPartyJobsOutcome> PollForThirdPartyJobsAwaitable(const Model::PollForThirdPartyJobsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::PollForThirdPartyJobs, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PollForThirdPartyJobsOutcome> PollForThirdPartyJobsAwaitable(Model::PollForThirdPartyJobsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::PollForThirdPartyJobs, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutActionRevisionOutcome> PutActionRevisionAwaitable(const Model::PutActionRevisionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::PutActionRevision, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutActionRevisionOutcome> PutActionRevisionAwaitable(Model::PutActionRevisionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::PutActionRevision, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutJobFailureResultOutcome> PutJobFailureResultAwaitable(const Model::PutJobFailureResultRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::PutJobFailureResult, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutJobFailureResultOutcome> PutJobFailureResultAwaitable(Model::PutJobFailureResultRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::PutJobFailureResult, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutJobSuccessResultOutcome> PutJobSuccessResultAwaitable(const Model::PutJobSuccessResultRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::PutJobSuccessResult, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutJobSuccessResultOutcome> PutJobSuccessResultAwaitable(Model::PutJobSuccessResultRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::PutJobSuccessResult, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutThirdPartyJobFailureResultOutcome> PutThirdPartyJobFailureResultAwaitable(const Model::PutThirdPartyJobFailureResultRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::PutThirdPartyJobFailureResult, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutThirdPartyJobFailureResultOutcome> PutThirdPartyJobFailureResultAwaitable(Model::PutThirdPartyJobFailureResultRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::PutThirdPartyJobFailureResult, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutThirdPartyJobSuccessResultOutcome> PutThirdPartyJobSuccessResultAwaitable(const Model::PutThirdPartyJobSuccessResultRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::PutThirdPartyJobSuccessResult, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutThirdPartyJobSuccessResultOutcome> PutThirdPartyJobSuccessResultAwaitable(Model::PutThirdPartyJobSuccessResultRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::PutThirdPartyJobSuccessResult, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartPipelineExecutionOutcome> StartPipelineExecutionAwaitable(const Model::StartPipelineExecutionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::StartPipelineExecution, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartPipelineExecutionOutcome> StartPipelineExecutionAwaitable(Model::StartPipelineExecutionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::StartPipelineExecution, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdatePipelineOutcome> UpdatePipelineAwaitable(const Model::UpdatePipelineRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::UpdatePipeline, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdatePipelineOutcome> UpdatePipelineAwaitable(Model::UpdatePipelineRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CodePipelineClient::UpdatePipeline, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -130,12 +130,22 @@ AcknowledgeJobOutcome CodePipelineClient::AcknowledgeJob(const AcknowledgeJobReq
 
 AcknowledgeJobOutcomeCallable CodePipelineClient::AcknowledgeJobCallable(const AcknowledgeJobRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::AcknowledgeJob, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::AcknowledgeJob, Aws::Client::RejectedCallOutcome<AcknowledgeJobOutcome>(), this, request);
+}
+
+AcknowledgeJobOutcomeCallable CodePipelineClient::AcknowledgeJobCallable(AcknowledgeJobRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::AcknowledgeJob, Aws::Client::RejectedCallOutcome<AcknowledgeJobOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::AcknowledgeJobAsync(const AcknowledgeJobRequest& request, const AcknowledgeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::AcknowledgeJobAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::AcknowledgeJobAsyncHelper, Aws::Client::RejectedAsyncCall<AcknowledgeJobOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::AcknowledgeJobAsync(AcknowledgeJobRequest&& request, const AcknowledgeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::AcknowledgeJobAsyncHelper, Aws::Client::RejectedAsyncCall<AcknowledgeJobOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::AcknowledgeJobAsyncHelper(const AcknowledgeJobRequest& request, const AcknowledgeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -161,12 +171,22 @@ AcknowledgeThirdPartyJobOutcome CodePipelineClient::AcknowledgeThirdPartyJob(con
 
 AcknowledgeThirdPartyJobOutcomeCallable CodePipelineClient::AcknowledgeThirdPartyJobCallable(const AcknowledgeThirdPartyJobRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::AcknowledgeThirdPartyJob, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::AcknowledgeThirdPartyJob, Aws::Client::RejectedCallOutcome<AcknowledgeThirdPartyJobOutcome>(), this, request);
+}
+
+AcknowledgeThirdPartyJobOutcomeCallable CodePipelineClient::AcknowledgeThirdPartyJobCallable(AcknowledgeThirdPartyJobRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::AcknowledgeThirdPartyJob, Aws::Client::RejectedCallOutcome<AcknowledgeThirdPartyJobOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::AcknowledgeThirdPartyJobAsync(const AcknowledgeThirdPartyJobRequest& request, const AcknowledgeThirdPartyJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::AcknowledgeThirdPartyJobAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::AcknowledgeThirdPartyJobAsyncHelper, Aws::Client::RejectedAsyncCall<AcknowledgeThirdPartyJobOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::AcknowledgeThirdPartyJobAsync(AcknowledgeThirdPartyJobRequest&& request, const AcknowledgeThirdPartyJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::AcknowledgeThirdPartyJobAsyncHelper, Aws::Client::RejectedAsyncCall<AcknowledgeThirdPartyJobOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::AcknowledgeThirdPartyJobAsyncHelper(const AcknowledgeThirdPartyJobRequest& request, const AcknowledgeThirdPartyJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -192,12 +212,22 @@ CreateCustomActionTypeOutcome CodePipelineClient::CreateCustomActionType(const C
 
 CreateCustomActionTypeOutcomeCallable CodePipelineClient::CreateCustomActionTypeCallable(const CreateCustomActionTypeRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::CreateCustomActionType, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::CreateCustomActionType, Aws::Client::RejectedCallOutcome<CreateCustomActionTypeOutcome>(), this, request);
+}
+
+CreateCustomActionTypeOutcomeCallable CodePipelineClient::CreateCustomActionTypeCallable(CreateCustomActionTypeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::CreateCustomActionType, Aws::Client::RejectedCallOutcome<CreateCustomActionTypeOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::CreateCustomActionTypeAsync(const CreateCustomActionTypeRequest& request, const CreateCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::CreateCustomActionTypeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::CreateCustomActionTypeAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCustomActionTypeOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::CreateCustomActionTypeAsync(CreateCustomActionTypeRequest&& request, const CreateCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::CreateCustomActionTypeAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCustomActionTypeOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::CreateCustomActionTypeAsyncHelper(const CreateCustomActionTypeRequest& request, const CreateCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -223,12 +253,22 @@ CreatePipelineOutcome CodePipelineClient::CreatePipeline(const CreatePipelineReq
 
 CreatePipelineOutcomeCallable CodePipelineClient::CreatePipelineCallable(const CreatePipelineRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::CreatePipeline, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::CreatePipeline, Aws::Client::RejectedCallOutcome<CreatePipelineOutcome>(), this, request);
+}
+
+CreatePipelineOutcomeCallable CodePipelineClient::CreatePipelineCallable(CreatePipelineRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::CreatePipeline, Aws::Client::RejectedCallOutcome<CreatePipelineOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::CreatePipelineAsync(const CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::CreatePipelineAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::CreatePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePipelineOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::CreatePipelineAsync(CreatePipelineRequest&& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::CreatePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePipelineOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::CreatePipelineAsyncHelper(const CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -254,12 +294,22 @@ DeleteCustomActionTypeOutcome CodePipelineClient::DeleteCustomActionType(const D
 
 DeleteCustomActionTypeOutcomeCallable CodePipelineClient::DeleteCustomActionTypeCallable(const DeleteCustomActionTypeRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::DeleteCustomActionType, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::DeleteCustomActionType, Aws::Client::RejectedCallOutcome<DeleteCustomActionTypeOutcome>(), this, request);
+}
+
+DeleteCustomActionTypeOutcomeCallable CodePipelineClient::DeleteCustomActionTypeCallable(DeleteCustomActionTypeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::DeleteCustomActionType, Aws::Client::RejectedCallOutcome<DeleteCustomActionTypeOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::DeleteCustomActionTypeAsync(const DeleteCustomActionTypeRequest& request, const DeleteCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::DeleteCustomActionTypeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::DeleteCustomActionTypeAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCustomActionTypeOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::DeleteCustomActionTypeAsync(DeleteCustomActionTypeRequest&& request, const DeleteCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::DeleteCustomActionTypeAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCustomActionTypeOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::DeleteCustomActionTypeAsyncHelper(const DeleteCustomActionTypeRequest& request, const DeleteCustomActionTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -285,12 +335,22 @@ DeletePipelineOutcome CodePipelineClient::DeletePipeline(const DeletePipelineReq
 
 DeletePipelineOutcomeCallable CodePipelineClient::DeletePipelineCallable(const DeletePipelineRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::DeletePipeline, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::DeletePipeline, Aws::Client::RejectedCallOutcome<DeletePipelineOutcome>(), this, request);
+}
+
+DeletePipelineOutcomeCallable CodePipelineClient::DeletePipelineCallable(DeletePipelineRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::DeletePipeline, Aws::Client::RejectedCallOutcome<DeletePipelineOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::DeletePipelineAsync(const DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::DeletePipelineAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::DeletePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePipelineOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::DeletePipelineAsync(DeletePipelineRequest&& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::DeletePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePipelineOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::DeletePipelineAsyncHelper(const DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -316,12 +376,22 @@ DisableStageTransitionOutcome CodePipelineClient::DisableStageTransition(const D
 
 DisableStageTransitionOutcomeCallable CodePipelineClient::DisableStageTransitionCallable(const DisableStageTransitionRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::DisableStageTransition, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::DisableStageTransition, Aws::Client::RejectedCallOutcome<DisableStageTransitionOutcome>(), this, request);
+}
+
+DisableStageTransitionOutcomeCallable CodePipelineClient::DisableStageTransitionCallable(DisableStageTransitionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::DisableStageTransition, Aws::Client::RejectedCallOutcome<DisableStageTransitionOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::DisableStageTransitionAsync(const DisableStageTransitionRequest& request, const DisableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::DisableStageTransitionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::DisableStageTransitionAsyncHelper, Aws::Client::RejectedAsyncCall<DisableStageTransitionOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::DisableStageTransitionAsync(DisableStageTransitionRequest&& request, const DisableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::DisableStageTransitionAsyncHelper, Aws::Client::RejectedAsyncCall<DisableStageTransitionOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::DisableStageTransitionAsyncHelper(const DisableStageTransitionRequest& request, const DisableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -347,12 +417,22 @@ EnableStageTransitionOutcome CodePipelineClient::EnableStageTransition(const Ena
 
 EnableStageTransitionOutcomeCallable CodePipelineClient::EnableStageTransitionCallable(const EnableStageTransitionRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::EnableStageTransition, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::EnableStageTransition, Aws::Client::RejectedCallOutcome<EnableStageTransitionOutcome>(), this, request);
+}
+
+EnableStageTransitionOutcomeCallable CodePipelineClient::EnableStageTransitionCallable(EnableStageTransitionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::EnableStageTransition, Aws::Client::RejectedCallOutcome<EnableStageTransitionOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::EnableStageTransitionAsync(const EnableStageTransitionRequest& request, const EnableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::EnableStageTransitionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::EnableStageTransitionAsyncHelper, Aws::Client::RejectedAsyncCall<EnableStageTransitionOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::EnableStageTransitionAsync(EnableStageTransitionRequest&& request, const EnableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::EnableStageTransitionAsyncHelper, Aws::Client::RejectedAsyncCall<EnableStageTransitionOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::EnableStageTransitionAsyncHelper(const EnableStageTransitionRequest& request, const EnableStageTransitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -378,12 +458,22 @@ GetJobDetailsOutcome CodePipelineClient::GetJobDetails(const GetJobDetailsReques
 
 GetJobDetailsOutcomeCallable CodePipelineClient::GetJobDetailsCallable(const GetJobDetailsRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::GetJobDetails, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::GetJobDetails, Aws::Client::RejectedCallOutcome<GetJobDetailsOutcome>(), this, request);
+}
+
+GetJobDetailsOutcomeCallable CodePipelineClient::GetJobDetailsCallable(GetJobDetailsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::GetJobDetails, Aws::Client::RejectedCallOutcome<GetJobDetailsOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::GetJobDetailsAsync(const GetJobDetailsRequest& request, const GetJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::GetJobDetailsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::GetJobDetailsAsyncHelper, Aws::Client::RejectedAsyncCall<GetJobDetailsOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::GetJobDetailsAsync(GetJobDetailsRequest&& request, const GetJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::GetJobDetailsAsyncHelper, Aws::Client::RejectedAsyncCall<GetJobDetailsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::GetJobDetailsAsyncHelper(const GetJobDetailsRequest& request, const GetJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -409,12 +499,22 @@ GetPipelineOutcome CodePipelineClient::GetPipeline(const GetPipelineRequest& req
 
 GetPipelineOutcomeCallable CodePipelineClient::GetPipelineCallable(const GetPipelineRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::GetPipeline, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::GetPipeline, Aws::Client::RejectedCallOutcome<GetPipelineOutcome>(), this, request);
+}
+
+GetPipelineOutcomeCallable CodePipelineClient::GetPipelineCallable(GetPipelineRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::GetPipeline, Aws::Client::RejectedCallOutcome<GetPipelineOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::GetPipelineAsync(const GetPipelineRequest& request, const GetPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::GetPipelineAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::GetPipelineAsyncHelper, Aws::Client::RejectedAsyncCall<GetPipelineOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::GetPipelineAsync(GetPipelineRequest&& request, const GetPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::GetPipelineAsyncHelper, Aws::Client::RejectedAsyncCall<GetPipelineOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::GetPipelineAsyncHelper(const GetPipelineRequest& request, const GetPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -440,12 +540,22 @@ GetPipelineStateOutcome CodePipelineClient::GetPipelineState(const GetPipelineSt
 
 GetPipelineStateOutcomeCallable CodePipelineClient::GetPipelineStateCallable(const GetPipelineStateRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::GetPipelineState, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::GetPipelineState, Aws::Client::RejectedCallOutcome<GetPipelineStateOutcome>(), this, request);
+}
+
+GetPipelineStateOutcomeCallable CodePipelineClient::GetPipelineStateCallable(GetPipelineStateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::GetPipelineState, Aws::Client::RejectedCallOutcome<GetPipelineStateOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::GetPipelineStateAsync(const GetPipelineStateRequest& request, const GetPipelineStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::GetPipelineStateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::GetPipelineStateAsyncHelper, Aws::Client::RejectedAsyncCall<GetPipelineStateOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::GetPipelineStateAsync(GetPipelineStateRequest&& request, const GetPipelineStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::GetPipelineStateAsyncHelper, Aws::Client::RejectedAsyncCall<GetPipelineStateOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::GetPipelineStateAsyncHelper(const GetPipelineStateRequest& request, const GetPipelineStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -471,12 +581,22 @@ GetThirdPartyJobDetailsOutcome CodePipelineClient::GetThirdPartyJobDetails(const
 
 GetThirdPartyJobDetailsOutcomeCallable CodePipelineClient::GetThirdPartyJobDetailsCallable(const GetThirdPartyJobDetailsRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::GetThirdPartyJobDetails, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::GetThirdPartyJobDetails, Aws::Client::RejectedCallOutcome<GetThirdPartyJobDetailsOutcome>(), this, request);
+}
+
+GetThirdPartyJobDetailsOutcomeCallable CodePipelineClient::GetThirdPartyJobDetailsCallable(GetThirdPartyJobDetailsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::GetThirdPartyJobDetails, Aws::Client::RejectedCallOutcome<GetThirdPartyJobDetailsOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::GetThirdPartyJobDetailsAsync(const GetThirdPartyJobDetailsRequest& request, const GetThirdPartyJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::GetThirdPartyJobDetailsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::GetThirdPartyJobDetailsAsyncHelper, Aws::Client::RejectedAsyncCall<GetThirdPartyJobDetailsOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::GetThirdPartyJobDetailsAsync(GetThirdPartyJobDetailsRequest&& request, const GetThirdPartyJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::GetThirdPartyJobDetailsAsyncHelper, Aws::Client::RejectedAsyncCall<GetThirdPartyJobDetailsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::GetThirdPartyJobDetailsAsyncHelper(const GetThirdPartyJobDetailsRequest& request, const GetThirdPartyJobDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -502,12 +622,22 @@ ListActionTypesOutcome CodePipelineClient::ListActionTypes(const ListActionTypes
 
 ListActionTypesOutcomeCallable CodePipelineClient::ListActionTypesCallable(const ListActionTypesRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::ListActionTypes, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::ListActionTypes, Aws::Client::RejectedCallOutcome<ListActionTypesOutcome>(), this, request);
+}
+
+ListActionTypesOutcomeCallable CodePipelineClient::ListActionTypesCallable(ListActionTypesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::ListActionTypes, Aws::Client::RejectedCallOutcome<ListActionTypesOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::ListActionTypesAsync(const ListActionTypesRequest& request, const ListActionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::ListActionTypesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::ListActionTypesAsyncHelper, Aws::Client::RejectedAsyncCall<ListActionTypesOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::ListActionTypesAsync(ListActionTypesRequest&& request, const ListActionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::ListActionTypesAsyncHelper, Aws::Client::RejectedAsyncCall<ListActionTypesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::ListActionTypesAsyncHelper(const ListActionTypesRequest& request, const ListActionTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -533,12 +663,22 @@ ListPipelinesOutcome CodePipelineClient::ListPipelines(const ListPipelinesReques
 
 ListPipelinesOutcomeCallable CodePipelineClient::ListPipelinesCallable(const ListPipelinesRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::ListPipelines, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::ListPipelines, Aws::Client::RejectedCallOutcome<ListPipelinesOutcome>(), this, request);
+}
+
+ListPipelinesOutcomeCallable CodePipelineClient::ListPipelinesCallable(ListPipelinesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::ListPipelines, Aws::Client::RejectedCallOutcome<ListPipelinesOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::ListPipelinesAsync(const ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::ListPipelinesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::ListPipelinesAsyncHelper, Aws::Client::RejectedAsyncCall<ListPipelinesOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::ListPipelinesAsync(ListPipelinesRequest&& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::ListPipelinesAsyncHelper, Aws::Client::RejectedAsyncCall<ListPipelinesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::ListPipelinesAsyncHelper(const ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -564,12 +704,22 @@ PollForJobsOutcome CodePipelineClient::PollForJobs(const PollForJobsRequest& req
 
 PollForJobsOutcomeCallable CodePipelineClient::PollForJobsCallable(const PollForJobsRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::PollForJobs, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::PollForJobs, Aws::Client::RejectedCallOutcome<PollForJobsOutcome>(), this, request);
+}
+
+PollForJobsOutcomeCallable CodePipelineClient::PollForJobsCallable(PollForJobsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::PollForJobs, Aws::Client::RejectedCallOutcome<PollForJobsOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::PollForJobsAsync(const PollForJobsRequest& request, const PollForJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::PollForJobsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::PollForJobsAsyncHelper, Aws::Client::RejectedAsyncCall<PollForJobsOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::PollForJobsAsync(PollForJobsRequest&& request, const PollForJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::PollForJobsAsyncHelper, Aws::Client::RejectedAsyncCall<PollForJobsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::PollForJobsAsyncHelper(const PollForJobsRequest& request, const PollForJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -595,12 +745,22 @@ PollForThirdPartyJobsOutcome CodePipelineClient::PollForThirdPartyJobs(const Pol
 
 PollForThirdPartyJobsOutcomeCallable CodePipelineClient::PollForThirdPartyJobsCallable(const PollForThirdPartyJobsRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::PollForThirdPartyJobs, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::PollForThirdPartyJobs, Aws::Client::RejectedCallOutcome<PollForThirdPartyJobsOutcome>(), this, request);
+}
+
+PollForThirdPartyJobsOutcomeCallable CodePipelineClient::PollForThirdPartyJobsCallable(PollForThirdPartyJobsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::PollForThirdPartyJobs, Aws::Client::RejectedCallOutcome<PollForThirdPartyJobsOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::PollForThirdPartyJobsAsync(const PollForThirdPartyJobsRequest& request, const PollForThirdPartyJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::PollForThirdPartyJobsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::PollForThirdPartyJobsAsyncHelper, Aws::Client::RejectedAsyncCall<PollForThirdPartyJobsOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::PollForThirdPartyJobsAsync(PollForThirdPartyJobsRequest&& request, const PollForThirdPartyJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::PollForThirdPartyJobsAsyncHelper, Aws::Client::RejectedAsyncCall<PollForThirdPartyJobsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::PollForThirdPartyJobsAsyncHelper(const PollForThirdPartyJobsRequest& request, const PollForThirdPartyJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -626,12 +786,22 @@ PutActionRevisionOutcome CodePipelineClient::PutActionRevision(const PutActionRe
 
 PutActionRevisionOutcomeCallable CodePipelineClient::PutActionRevisionCallable(const PutActionRevisionRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::PutActionRevision, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::PutActionRevision, Aws::Client::RejectedCallOutcome<PutActionRevisionOutcome>(), this, request);
+}
+
+PutActionRevisionOutcomeCallable CodePipelineClient::PutActionRevisionCallable(PutActionRevisionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::PutActionRevision, Aws::Client::RejectedCallOutcome<PutActionRevisionOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::PutActionRevisionAsync(const PutActionRevisionRequest& request, const PutActionRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::PutActionRevisionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::PutActionRevisionAsyncHelper, Aws::Client::RejectedAsyncCall<PutActionRevisionOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::PutActionRevisionAsync(PutActionRevisionRequest&& request, const PutActionRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::PutActionRevisionAsyncHelper, Aws::Client::RejectedAsyncCall<PutActionRevisionOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::PutActionRevisionAsyncHelper(const PutActionRevisionRequest& request, const PutActionRevisionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -657,12 +827,22 @@ PutJobFailureResultOutcome CodePipelineClient::PutJobFailureResult(const PutJobF
 
 PutJobFailureResultOutcomeCallable CodePipelineClient::PutJobFailureResultCallable(const PutJobFailureResultRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::PutJobFailureResult, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::PutJobFailureResult, Aws::Client::RejectedCallOutcome<PutJobFailureResultOutcome>(), this, request);
+}
+
+PutJobFailureResultOutcomeCallable CodePipelineClient::PutJobFailureResultCallable(PutJobFailureResultRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::PutJobFailureResult, Aws::Client::RejectedCallOutcome<PutJobFailureResultOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::PutJobFailureResultAsync(const PutJobFailureResultRequest& request, const PutJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::PutJobFailureResultAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::PutJobFailureResultAsyncHelper, Aws::Client::RejectedAsyncCall<PutJobFailureResultOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::PutJobFailureResultAsync(PutJobFailureResultRequest&& request, const PutJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::PutJobFailureResultAsyncHelper, Aws::Client::RejectedAsyncCall<PutJobFailureResultOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::PutJobFailureResultAsyncHelper(const PutJobFailureResultRequest& request, const PutJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -688,12 +868,22 @@ PutJobSuccessResultOutcome CodePipelineClient::PutJobSuccessResult(const PutJobS
 
 PutJobSuccessResultOutcomeCallable CodePipelineClient::PutJobSuccessResultCallable(const PutJobSuccessResultRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::PutJobSuccessResult, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::PutJobSuccessResult, Aws::Client::RejectedCallOutcome<PutJobSuccessResultOutcome>(), this, request);
+}
+
+PutJobSuccessResultOutcomeCallable CodePipelineClient::PutJobSuccessResultCallable(PutJobSuccessResultRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::PutJobSuccessResult, Aws::Client::RejectedCallOutcome<PutJobSuccessResultOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::PutJobSuccessResultAsync(const PutJobSuccessResultRequest& request, const PutJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::PutJobSuccessResultAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::PutJobSuccessResultAsyncHelper, Aws::Client::RejectedAsyncCall<PutJobSuccessResultOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::PutJobSuccessResultAsync(PutJobSuccessResultRequest&& request, const PutJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::PutJobSuccessResultAsyncHelper, Aws::Client::RejectedAsyncCall<PutJobSuccessResultOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::PutJobSuccessResultAsyncHelper(const PutJobSuccessResultRequest& request, const PutJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -719,12 +909,22 @@ PutThirdPartyJobFailureResultOutcome CodePipelineClient::PutThirdPartyJobFailure
 
 PutThirdPartyJobFailureResultOutcomeCallable CodePipelineClient::PutThirdPartyJobFailureResultCallable(const PutThirdPartyJobFailureResultRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::PutThirdPartyJobFailureResult, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::PutThirdPartyJobFailureResult, Aws::Client::RejectedCallOutcome<PutThirdPartyJobFailureResultOutcome>(), this, request);
+}
+
+PutThirdPartyJobFailureResultOutcomeCallable CodePipelineClient::PutThirdPartyJobFailureResultCallable(PutThirdPartyJobFailureResultRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::PutThirdPartyJobFailureResult, Aws::Client::RejectedCallOutcome<PutThirdPartyJobFailureResultOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::PutThirdPartyJobFailureResultAsync(const PutThirdPartyJobFailureResultRequest& request, const PutThirdPartyJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::PutThirdPartyJobFailureResultAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::PutThirdPartyJobFailureResultAsyncHelper, Aws::Client::RejectedAsyncCall<PutThirdPartyJobFailureResultOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::PutThirdPartyJobFailureResultAsync(PutThirdPartyJobFailureResultRequest&& request, const PutThirdPartyJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::PutThirdPartyJobFailureResultAsyncHelper, Aws::Client::RejectedAsyncCall<PutThirdPartyJobFailureResultOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::PutThirdPartyJobFailureResultAsyncHelper(const PutThirdPartyJobFailureResultRequest& request, const PutThirdPartyJobFailureResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -750,12 +950,22 @@ PutThirdPartyJobSuccessResultOutcome CodePipelineClient::PutThirdPartyJobSuccess
 
 PutThirdPartyJobSuccessResultOutcomeCallable CodePipelineClient::PutThirdPartyJobSuccessResultCallable(const PutThirdPartyJobSuccessResultRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::PutThirdPartyJobSuccessResult, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::PutThirdPartyJobSuccessResult, Aws::Client::RejectedCallOutcome<PutThirdPartyJobSuccessResultOutcome>(), this, request);
+}
+
+PutThirdPartyJobSuccessResultOutcomeCallable CodePipelineClient::PutThirdPartyJobSuccessResultCallable(PutThirdPartyJobSuccessResultRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::PutThirdPartyJobSuccessResult, Aws::Client::RejectedCallOutcome<PutThirdPartyJobSuccessResultOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::PutThirdPartyJobSuccessResultAsync(const PutThirdPartyJobSuccessResultRequest& request, const PutThirdPartyJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::PutThirdPartyJobSuccessResultAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::PutThirdPartyJobSuccessResultAsyncHelper, Aws::Client::RejectedAsyncCall<PutThirdPartyJobSuccessResultOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::PutThirdPartyJobSuccessResultAsync(PutThirdPartyJobSuccessResultRequest&& request, const PutThirdPartyJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::PutThirdPartyJobSuccessResultAsyncHelper, Aws::Client::RejectedAsyncCall<PutThirdPartyJobSuccessResultOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::PutThirdPartyJobSuccessResultAsyncHelper(const PutThirdPartyJobSuccessResultRequest& request, const PutThirdPartyJobSuccessResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -781,12 +991,22 @@ StartPipelineExecutionOutcome CodePipelineClient::StartPipelineExecution(const S
 
 StartPipelineExecutionOutcomeCallable CodePipelineClient::StartPipelineExecutionCallable(const StartPipelineExecutionRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::StartPipelineExecution, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::StartPipelineExecution, Aws::Client::RejectedCallOutcome<StartPipelineExecutionOutcome>(), this, request);
+}
+
+StartPipelineExecutionOutcomeCallable CodePipelineClient::StartPipelineExecutionCallable(StartPipelineExecutionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::StartPipelineExecution, Aws::Client::RejectedCallOutcome<StartPipelineExecutionOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::StartPipelineExecutionAsync(const StartPipelineExecutionRequest& request, const StartPipelineExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::StartPipelineExecutionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::StartPipelineExecutionAsyncHelper, Aws::Client::RejectedAsyncCall<StartPipelineExecutionOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::StartPipelineExecutionAsync(StartPipelineExecutionRequest&& request, const StartPipelineExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::StartPipelineExecutionAsyncHelper, Aws::Client::RejectedAsyncCall<StartPipelineExecutionOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::StartPipelineExecutionAsyncHelper(const StartPipelineExecutionRequest& request, const StartPipelineExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -812,12 +1032,22 @@ UpdatePipelineOutcome CodePipelineClient::UpdatePipeline(const UpdatePipelineReq
 
 UpdatePipelineOutcomeCallable CodePipelineClient::UpdatePipelineCallable(const UpdatePipelineRequest& request) const
 {
-  return std::async(std::launch::async, &CodePipelineClient::UpdatePipeline, this, request);
+  return m_executor->SubmitWithFuture(&CodePipelineClient::UpdatePipeline, Aws::Client::RejectedCallOutcome<UpdatePipelineOutcome>(), this, request);
+}
+
+UpdatePipelineOutcomeCallable CodePipelineClient::UpdatePipelineCallable(UpdatePipelineRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CodePipelineClient::UpdatePipeline, Aws::Client::RejectedCallOutcome<UpdatePipelineOutcome>(), this, std::move(request));
 }
 
 void CodePipelineClient::UpdatePipelineAsync(const UpdatePipelineRequest& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CodePipelineClient::UpdatePipelineAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CodePipelineClient::UpdatePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<UpdatePipelineOutcome>(), this, request, handler, context);
+}
+
+void CodePipelineClient::UpdatePipelineAsync(UpdatePipelineRequest&& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CodePipelineClient::UpdatePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<UpdatePipelineOutcome>(), this, std::move(request), handler, context);
 }
 
 void CodePipelineClient::UpdatePipelineAsyncHelper(const UpdatePipelineRequest& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -37,6 +37,28 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/cognito-identity/model/CreateIdentityPoolRequest.h>
+#include <aws/cognito-identity/model/DeleteIdentitiesRequest.h>
+#include <aws/cognito-identity/model/DeleteIdentityPoolRequest.h>
+#include <aws/cognito-identity/model/DescribeIdentityRequest.h>
+#include <aws/cognito-identity/model/DescribeIdentityPoolRequest.h>
+#include <aws/cognito-identity/model/GetCredentialsForIdentityRequest.h>
+#include <aws/cognito-identity/model/GetIdRequest.h>
+#include <aws/cognito-identity/model/GetIdentityPoolRolesRequest.h>
+#include <aws/cognito-identity/model/GetOpenIdTokenRequest.h>
+#include <aws/cognito-identity/model/GetOpenIdTokenForDeveloperIdentityRequest.h>
+#include <aws/cognito-identity/model/ListIdentitiesRequest.h>
+#include <aws/cognito-identity/model/ListIdentityPoolsRequest.h>
+#include <aws/cognito-identity/model/LookupDeveloperIdentityRequest.h>
+#include <aws/cognito-identity/model/MergeDeveloperIdentitiesRequest.h>
+#include <aws/cognito-identity/model/SetIdentityPoolRolesRequest.h>
+#include <aws/cognito-identity/model/UnlinkDeveloperIdentityRequest.h>
+#include <aws/cognito-identity/model/UnlinkIdentityRequest.h>
+#include <aws/cognito-identity/model/UpdateIdentityPoolRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -245,6 +267,11 @@ namespace Model
          */
         virtual Model::CreateIdentityPoolOutcomeCallable CreateIdentityPoolCallable(const Model::CreateIdentityPoolRequest& request) const;
 
+        /**
+         * Same as CreateIdentityPoolCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateIdentityPoolOutcomeCallable CreateIdentityPoolCallable(Model::CreateIdentityPoolRequest&& request) const;
+
         /**
          * <p>Creates a new identity pool. The identity pool is a store of user identity
          * information that is specific to your AWS account. The limit on identity pools is
@@ -259,6 +286,11 @@ namespace Model
          */
         virtual void CreateIdentityPoolAsync(const Model::CreateIdentityPoolRequest& request, const CreateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateIdentityPoolAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateIdentityPoolAsync(Model::CreateIdentityPoolRequest&& request, const CreateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes identities from an identity pool. You can specify a list of 1-60
          * identities that you want to delete.</p> <p>You must use AWS Developer
@@ -275,6 +307,11 @@ namespace Model
          */
         virtual Model::DeleteIdentitiesOutcomeCallable DeleteIdentitiesCallable(const Model::DeleteIdentitiesRequest& request) const;
 
+        /**
+         * Same as DeleteIdentitiesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteIdentitiesOutcomeCallable DeleteIdentitiesCallable(Model::DeleteIdentitiesRequest&& request) const;
+
         /**
          * <p>Deletes identities from an identity pool. You can specify a list of 1-60
          * identities that you want to delete.</p> <p>You must use AWS Developer
@@ -284,6 +321,11 @@ namespace Model
          */
         virtual void DeleteIdentitiesAsync(const Model::DeleteIdentitiesRequest& request, const DeleteIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIdentitiesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteIdentitiesAsync(Model::DeleteIdentitiesRequest&& request, const DeleteIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a user pool. Once a pool is deleted, users will not be able to
          * authenticate with the pool.</p> <p>You must use AWS Developer credentials to
@@ -300,6 +342,11 @@ namespace Model
          */
         virtual Model::DeleteIdentityPoolOutcomeCallable DeleteIdentityPoolCallable(const Model::DeleteIdentityPoolRequest& request) const;
 
+        /**
+         * Same as DeleteIdentityPoolCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteIdentityPoolOutcomeCallable DeleteIdentityPoolCallable(Model::DeleteIdentityPoolRequest&& request) const;
+
         /**
          * <p>Deletes a user pool. Once a pool is deleted, users will not be able to
          * authenticate with the pool.</p> <p>You must use AWS Developer credentials to
@@ -309,6 +356,11 @@ namespace Model
          */
         virtual void DeleteIdentityPoolAsync(const Model::DeleteIdentityPoolRequest& request, const DeleteIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIdentityPoolAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteIdentityPoolAsync(Model::DeleteIdentityPoolRequest&& request, const DeleteIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns metadata related to the given identity, including when the identity
          * was created and any associated linked logins.</p> <p>You must use AWS Developer
@@ -325,6 +377,11 @@ namespace Model
          */
         virtual Model::DescribeIdentityOutcomeCallable DescribeIdentityCallable(const Model::DescribeIdentityRequest& request) const;
 
+        /**
+         * Same as DescribeIdentityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeIdentityOutcomeCallable DescribeIdentityCallable(Model::DescribeIdentityRequest&& request) const;
+
         /**
          * <p>Returns metadata related to the given identity, including when the identity
          * was created and any associated linked logins.</p> <p>You must use AWS Developer
@@ -334,6 +391,11 @@ namespace Model
          */
         virtual void DescribeIdentityAsync(const Model::DescribeIdentityRequest& request, const DescribeIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeIdentityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeIdentityAsync(Model::DescribeIdentityRequest&& request, const DescribeIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets details about a particular identity pool, including the pool name, ID
          * description, creation date, and current number of users.</p> <p>You must use AWS
@@ -350,6 +412,11 @@ namespace Model
          */
         virtual Model::DescribeIdentityPoolOutcomeCallable DescribeIdentityPoolCallable(const Model::DescribeIdentityPoolRequest& request) const;
 
+        /**
+         * Same as DescribeIdentityPoolCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeIdentityPoolOutcomeCallable DescribeIdentityPoolCallable(Model::DescribeIdentityPoolRequest&& request) const;
+
         /**
          * <p>Gets details about a particular identity pool, including the pool name, ID
          * description, creation date, and current number of users.</p> <p>You must use AWS
@@ -359,6 +426,11 @@ namespace Model
          */
         virtual void DescribeIdentityPoolAsync(const Model::DescribeIdentityPoolRequest& request, const DescribeIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeIdentityPoolAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeIdentityPoolAsync(Model::DescribeIdentityPoolRequest&& request, const DescribeIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns credentials for the provided identity ID. Any provided logins will be
          * validated against supported login providers. If the token is for
@@ -379,6 +451,11 @@ namespace Model
          */
         virtual Model::GetCredentialsForIdentityOutcomeCallable GetCredentialsForIdentityCallable(const Model::GetCredentialsForIdentityRequest& request) const;
 
+        /**
+         * Same as GetCredentialsForIdentityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetCredentialsForIdentityOutcomeCallable GetCredentialsForIdentityCallable(Model::GetCredentialsForIdentityRequest&& request) const;
+
         /**
          * <p>Returns credentials for the provided identity ID. Any provided logins will be
          * validated against supported login providers. If the token is for
@@ -390,6 +467,11 @@ namespace Model
          */
         virtual void GetCredentialsForIdentityAsync(const Model::GetCredentialsForIdentityRequest& request, const GetCredentialsForIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCredentialsForIdentityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetCredentialsForIdentityAsync(Model::GetCredentialsForIdentityRequest&& request, const GetCredentialsForIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates (or retrieves) a Cognito ID. Supplying multiple logins will create
          * an implicit linked account.</p> <p>This is a public API. You do not need any
@@ -406,6 +488,11 @@ namespace Model
          */
         virtual Model::GetIdOutcomeCallable GetIdCallable(const Model::GetIdRequest& request) const;
 
+        /**
+         * Same as GetIdCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetIdOutcomeCallable GetIdCallable(Model::GetIdRequest&& request) const;
+
         /**
          * <p>Generates (or retrieves) a Cognito ID. Supplying multiple logins will create
          * an implicit linked account.</p> <p>This is a public API. You do not need any
@@ -415,6 +502,11 @@ namespace Model
          */
         virtual void GetIdAsync(const Model::GetIdRequest& request, const GetIdResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetIdAsync(Model::GetIdRequest&& request, const GetIdResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the roles for an identity pool.</p> <p>You must use AWS Developer
          * credentials to call this API.</p>
@@ -429,6 +521,11 @@ namespace Model
          */
         virtual Model::GetIdentityPoolRolesOutcomeCallable GetIdentityPoolRolesCallable(const Model::GetIdentityPoolRolesRequest& request) const;
 
+        /**
+         * Same as GetIdentityPoolRolesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetIdentityPoolRolesOutcomeCallable GetIdentityPoolRolesCallable(Model::GetIdentityPoolRolesRequest&& request) const;
+
         /**
          * <p>Gets the roles for an identity pool.</p> <p>You must use AWS Developer
          * credentials to call this API.</p>
@@ -437,6 +534,11 @@ namespace Model
          */
         virtual void GetIdentityPoolRolesAsync(const Model::GetIdentityPoolRolesRequest& request, const GetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdentityPoolRolesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetIdentityPoolRolesAsync(Model::GetIdentityPoolRolesRequest&& request, const GetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets an OpenID token, using a known Cognito ID. This known Cognito ID is
          * returned by <a>GetId</a>. You can optionally add additional logins for the
@@ -457,6 +559,11 @@ namespace Model
          */
         virtual Model::GetOpenIdTokenOutcomeCallable GetOpenIdTokenCallable(const Model::GetOpenIdTokenRequest& request) const;
 
+        /**
+         * Same as GetOpenIdTokenCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetOpenIdTokenOutcomeCallable GetOpenIdTokenCallable(Model::GetOpenIdTokenRequest&& request) const;
+
         /**
          * <p>Gets an OpenID token, using a known Cognito ID. This known Cognito ID is
          * returned by <a>GetId</a>. You can optionally add additional logins for the
@@ -468,6 +575,11 @@ namespace Model
          */
         virtual void GetOpenIdTokenAsync(const Model::GetOpenIdTokenRequest& request, const GetOpenIdTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetOpenIdTokenAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetOpenIdTokenAsync(Model::GetOpenIdTokenRequest&& request, const GetOpenIdTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers (or retrieves) a Cognito <code>IdentityId</code> and an OpenID
          * Connect token for a user authenticated by your backend authentication process.
@@ -506,6 +618,11 @@ namespace Model
          */
         virtual Model::GetOpenIdTokenForDeveloperIdentityOutcomeCallable GetOpenIdTokenForDeveloperIdentityCallable(const Model::GetOpenIdTokenForDeveloperIdentityRequest& request) const;
 
+        /**
+         * Same as GetOpenIdTokenForDeveloperIdentityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetOpenIdTokenForDeveloperIdentityOutcomeCallable GetOpenIdTokenForDeveloperIdentityCallable(Model::GetOpenIdTokenForDeveloperIdentityRequest&& request) const;
+
         /**
          * <p>Registers (or retrieves) a Cognito <code>IdentityId</code> and an OpenID
          * Connect token for a user authenticated by your backend authentication process.
@@ -526,6 +643,11 @@ namespace Model
          */
         virtual void GetOpenIdTokenForDeveloperIdentityAsync(const Model::GetOpenIdTokenForDeveloperIdentityRequest& request, const GetOpenIdTokenForDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetOpenIdTokenForDeveloperIdentityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetOpenIdTokenForDeveloperIdentityAsync(Model::GetOpenIdTokenForDeveloperIdentityRequest&& request, const GetOpenIdTokenForDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the identities in a pool.</p> <p>You must use AWS Developer credentials
          * to call this API.</p>
@@ -540,6 +662,11 @@ namespace Model
          */
         virtual Model::ListIdentitiesOutcomeCallable ListIdentitiesCallable(const Model::ListIdentitiesRequest& request) const;
 
+        /**
+         * Same as ListIdentitiesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListIdentitiesOutcomeCallable ListIdentitiesCallable(Model::ListIdentitiesRequest&& request) const;
+
         /**
          * <p>Lists the identities in a pool.</p> <p>You must use AWS Developer credentials
          * to call this API.</p>
@@ -548,6 +675,11 @@ namespace Model
          */
         virtual void ListIdentitiesAsync(const Model::ListIdentitiesRequest& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListIdentitiesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListIdentitiesAsync(Model::ListIdentitiesRequest&& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all of the Cognito identity pools registered for your account.</p>
          * <p>You must use AWS Developer credentials to call this API.</p>
@@ -562,6 +694,11 @@ namespace Model
          */
         virtual Model::ListIdentityPoolsOutcomeCallable ListIdentityPoolsCallable(const Model::ListIdentityPoolsRequest& request) const;
 
+        /**
+         * Same as ListIdentityPoolsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListIdentityPoolsOutcomeCallable ListIdentityPoolsCallable(Model::ListIdentityPoolsRequest&& request) const;
+
         /**
          * <p>Lists all of the Cognito identity pools registered for your account.</p>
          * <p>You must use AWS Developer credentials to call this API.</p>
@@ -570,6 +707,11 @@ namespace Model
          */
         virtual void ListIdentityPoolsAsync(const Model::ListIdentityPoolsRequest& request, const ListIdentityPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListIdentityPoolsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListIdentityPoolsAsync(Model::ListIdentityPoolsRequest&& request, const ListIdentityPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the <code>IdentityID</code> associated with a
          * <code>DeveloperUserIdentifier</code> or the list of
@@ -602,6 +744,11 @@ namespace Model
          */
         virtual Model::LookupDeveloperIdentityOutcomeCallable LookupDeveloperIdentityCallable(const Model::LookupDeveloperIdentityRequest& request) const;
 
+        /**
+         * Same as LookupDeveloperIdentityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::LookupDeveloperIdentityOutcomeCallable LookupDeveloperIdentityCallable(Model::LookupDeveloperIdentityRequest&& request) const;
+
         /**
          * <p>Retrieves the <code>IdentityID</code> associated with a
          * <code>DeveloperUserIdentifier</code> or the list of
@@ -619,6 +766,11 @@ namespace Model
          */
         virtual void LookupDeveloperIdentityAsync(const Model::LookupDeveloperIdentityRequest& request, const LookupDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as LookupDeveloperIdentityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void LookupDeveloperIdentityAsync(Model::LookupDeveloperIdentityRequest&& request, const LookupDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Merges two users having different <code>IdentityId</code>s, existing in the
          * same identity pool, and identified by the same developer provider. You can use
@@ -647,6 +799,11 @@ namespace Model
          */
         virtual Model::MergeDeveloperIdentitiesOutcomeCallable MergeDeveloperIdentitiesCallable(const Model::MergeDeveloperIdentitiesRequest& request) const;
 
+        /**
+         * Same as MergeDeveloperIdentitiesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::MergeDeveloperIdentitiesOutcomeCallable MergeDeveloperIdentitiesCallable(Model::MergeDeveloperIdentitiesRequest&& request) const;
+
         /**
          * <p>Merges two users having different <code>IdentityId</code>s, existing in the
          * same identity pool, and identified by the same developer provider. You can use
@@ -662,6 +819,11 @@ namespace Model
          */
         virtual void MergeDeveloperIdentitiesAsync(const Model::MergeDeveloperIdentitiesRequest& request, const MergeDeveloperIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as MergeDeveloperIdentitiesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void MergeDeveloperIdentitiesAsync(Model::MergeDeveloperIdentitiesRequest&& request, const MergeDeveloperIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the roles for an identity pool. These roles are used when making calls
          * to <code>GetCredentialsForIdentity</code> action.</p> <p>You must use AWS
@@ -678,6 +840,11 @@ namespace Model
          */
         virtual Model::SetIdentityPoolRolesOutcomeCallable SetIdentityPoolRolesCallable(const Model::SetIdentityPoolRolesRequest& request) const;
 
+        /**
+         * Same as SetIdentityPoolRolesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetIdentityPoolRolesOutcomeCallable SetIdentityPoolRolesCallable(Model::SetIdentityPoolRolesRequest&& request) const;
+
         /**
          * <p>Sets the roles for an identity pool. These roles are used when making calls
          * to <code>GetCredentialsForIdentity</code> action.</p> <p>You must use AWS
@@ -687,6 +854,11 @@ namespace Model
          */
         virtual void SetIdentityPoolRolesAsync(const Model::SetIdentityPoolRolesRequest& request, const SetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetIdentityPoolRolesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetIdentityPoolRolesAsync(Model::SetIdentityPoolRolesRequest&& request, const SetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Unlinks a <code>DeveloperUserIdentifier</code> from an existing identity.
          * Unlinked developer users will be considered new identities next time they are
@@ -709,6 +881,11 @@ namespace Model
          */
         virtual Model::UnlinkDeveloperIdentityOutcomeCallable UnlinkDeveloperIdentityCallable(const Model::UnlinkDeveloperIdentityRequest& request) const;
 
+        /**
+         * Same as UnlinkDeveloperIdentityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UnlinkDeveloperIdentityOutcomeCallable UnlinkDeveloperIdentityCallable(Model::UnlinkDeveloperIdentityRequest&& request) const;
+
         /**
          * <p>Unlinks a <code>DeveloperUserIdentifier</code> from an existing identity.
          * Unlinked developer users will be considered new identities next time they are
@@ -721,6 +898,11 @@ namespace Model
          */
         virtual void UnlinkDeveloperIdentityAsync(const Model::UnlinkDeveloperIdentityRequest& request, const UnlinkDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnlinkDeveloperIdentityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UnlinkDeveloperIdentityAsync(Model::UnlinkDeveloperIdentityRequest&& request, const UnlinkDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Unlinks a federated identity from an existing account. Unlinked logins will
          * be considered new identities next time they are seen. Removing the last linked
@@ -739,6 +921,11 @@ namespace Model
          */
         virtual Model::UnlinkIdentityOutcomeCallable UnlinkIdentityCallable(const Model::UnlinkIdentityRequest& request) const;
 
+        /**
+         * Same as UnlinkIdentityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UnlinkIdentityOutcomeCallable UnlinkIdentityCallable(Model::UnlinkIdentityRequest&& request) const;
+
         /**
          * <p>Unlinks a federated identity from an existing account. Unlinked logins will
          * be considered new identities next time they are seen. Removing the last linked
@@ -749,6 +936,11 @@ namespace Model
          */
         virtual void UnlinkIdentityAsync(const Model::UnlinkIdentityRequest& request, const UnlinkIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnlinkIdentityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UnlinkIdentityAsync(Model::UnlinkIdentityRequest&& request, const UnlinkIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a user pool.</p> <p>You must use AWS Developer credentials to call
          * this API.</p>
@@ -763,6 +955,11 @@ namespace Model
          */
         virtual Model::UpdateIdentityPoolOutcomeCallable UpdateIdentityPoolCallable(const Model::UpdateIdentityPoolRequest& request) const;
 
+        /**
+         * Same as UpdateIdentityPoolCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateIdentityPoolOutcomeCallable UpdateIdentityPoolCallable(Model::UpdateIdentityPoolRequest&& request) const;
+
         /**
          * <p>Updates a user pool.</p> <p>You must use AWS Developer credentials to call
          * this API.</p>
@@ -771,6 +968,54 @@ namespace Model
          */
         virtual void UpdateIdentityPoolAsync(const Model::UpdateIdentityPoolRequest& request, const UpdateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateIdentityPoolAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateIdentityPoolAsync(Model::UpdateIdentityPoolRequest&& request, const UpdateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateIdentityPoolOutcome> CreateIdentityPoolAwaitable(const Model::CreateIdentityPoolRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::CreateIdentityPool, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateIdentityPoolOutcome> CreateIdentityPoolAwaitable(Model::CreateIdentityPoolRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::CreateIdentityPool, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIdentitiesOutcome> DeleteIdentitiesAwaitable(const Model::DeleteIdentitiesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::DeleteIdentities, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIdentitiesOutcome> DeleteIdentitiesAwaitable(Model::DeleteIdentitiesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::DeleteIdentities, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIdentityPoolOutcome> DeleteIdentityPoolAwaitable(const Model::DeleteIdentityPoolRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::DeleteIdentityPool, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIdentityPoolOutcome> DeleteIdentityPoolAwaitable(Model::DeleteIdentityPoolRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::DeleteIdentityPool, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeIdentityOutcome> DescribeIdentityAwaitable(const Model::DescribeIdentityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::DescribeIdentity, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeIdentityOutcome> DescribeIdentityAwaitable(Model::DescribeIdentityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::DescribeIdentity, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeIdentityPoolOutcome> DescribeIdentityPoolAwaitable(const Model::DescribeIdentityPoolRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::DescribeIdentityPool, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeIdentityPoolOutcome> DescribeIdentityPoolAwaitable(Model::DescribeIdentityPoolRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::DescribeIdentityPool, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCredentialsForIdentityOutcome> GetCredentialsForIdentityAwaitable(const Model::GetCredentialsForIdentityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::GetCredentialsForIdentity, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCredentialsForIdentityOutcome> GetCredentialsForIdentityAwaitable(Model::GetCredentialsForIdentityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::GetCredentialsForIdentity, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIdOutcome> GetIdAwaitable(const Model::GetIdRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::GetId, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIdOutcome> GetIdAwaitable(Model::GetIdRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::GetId, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIdentityPoolRolesOutcome> GetIdentityPoolRolesAwaitable(const Model::GetIdentityPoolRolesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::GetIdentityPoolRoles, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIdentityPoolRolesOutcome> GetIdentityPoolRolesAwaitable(Model::GetIdentityPoolRolesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::GetIdentityPoolRoles, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetOpenIdTokenOutcome> GetOpenIdTokenAwaitable(const Model::GetOpenIdTokenRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::GetOpenIdToken, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetOpenIdTokenOutcome> GetOpenIdTokenAwaitable(Model::GetOpenIdTokenRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::GetOpenIdToken, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetOpenIdTokenForDeveloperIdentityOutcome> GetOpenIdTokenForDeveloperIdentityAwaitable(const Model::GetOpenIdTokenForDeveloperIdentityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentity, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetOpenIdTokenForDeveloperIdentityOutcome> GetOpenIdTokenForDeveloperIdentityAwaitable(Model::GetOpenIdTokenForDeveloperIdentityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentity, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListIdentitiesOutcome> ListIdentitiesAwaitable(const Model::ListIdentitiesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::ListIdentities, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListIdentitiesOutcome> ListIdentitiesAwaitable(Model::ListIdentitiesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::ListIdentities, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListIdentityPoolsOutcome> ListIdentityPoolsAwaitable(const Model::ListIdentityPoolsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::ListIdentityPools, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListIdentityPoolsOutcome> ListIdentityPoolsAwaitable(Model::ListIdentityPoolsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::ListIdentityPools, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::LookupDeveloperIdentityOutcome> LookupDeveloperIdentityAwaitable(const Model::LookupDeveloperIdentityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::LookupDeveloperIdentity, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::LookupDeveloperIdentityOutcome> LookupDeveloperIdentityAwaitable(Model::LookupDeveloperIdentityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::LookupDeveloperIdentity, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::MergeDeveloperIdentitiesOutcome> MergeDeveloperIdentitiesAwaitable(const Model::MergeDeveloperIdentitiesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::MergeDeveloperIdentities, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::MergeDeveloperIdentitiesOutcome> MergeDeveloperIdentitiesAwaitable(Model::MergeDeveloperIdentitiesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::MergeDeveloperIdentities, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetIdentityPoolRolesOutcome> SetIdentityPoolRolesAwaitable(const Model::SetIdentityPoolRolesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::SetIdentityPoolRoles, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetIdentityPoolRolesOutcome> SetIdentityPoolRolesAwaitable(Model::SetIdentityPoolRolesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::SetIdentityPoolRoles, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnlinkDeveloperIdentityOutcome> UnlinkDeveloperIdentityAwaitable(const Model::UnlinkDeveloperIdentityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::UnlinkDeveloperIdentity, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnlinkDeveloperIdentityOutcome> UnlinkDeveloperIdentityAwaitable(Model::UnlinkDeveloperIdentityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::UnlinkDeveloperIdentity, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnlinkIdentityOutcome> UnlinkIdentityAwaitable(const Model::UnlinkIdentityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::UnlinkIdentity, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnlinkIdentityOutcome> UnlinkIdentityAwaitable(Model::UnlinkIdentityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::UnlinkIdentity, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateIdentityPoolOutcome> UpdateIdentityPoolAwaitable(const Model::UpdateIdentityPoolRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::UpdateIdentityPool, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateIdentityPoolOutcome> UpdateIdentityPoolAwaitable(Model::UpdateIdentityPoolRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoIdentityClient::UpdateIdentityPool, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -125,12 +125,22 @@ CreateIdentityPoolOutcome CognitoIdentityClient::CreateIdentityPool(const Create
 
 CreateIdentityPoolOutcomeCallable CognitoIdentityClient::CreateIdentityPoolCallable(const CreateIdentityPoolRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::CreateIdentityPool, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::CreateIdentityPool, Aws::Client::RejectedCallOutcome<CreateIdentityPoolOutcome>(), this, request);
+}
+
+CreateIdentityPoolOutcomeCallable CognitoIdentityClient::CreateIdentityPoolCallable(CreateIdentityPoolRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::CreateIdentityPool, Aws::Client::RejectedCallOutcome<CreateIdentityPoolOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::CreateIdentityPoolAsync(const CreateIdentityPoolRequest& request, const CreateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::CreateIdentityPoolAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::CreateIdentityPoolAsyncHelper, Aws::Client::RejectedAsyncCall<CreateIdentityPoolOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::CreateIdentityPoolAsync(CreateIdentityPoolRequest&& request, const CreateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::CreateIdentityPoolAsyncHelper, Aws::Client::RejectedAsyncCall<CreateIdentityPoolOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::CreateIdentityPoolAsyncHelper(const CreateIdentityPoolRequest& request, const CreateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -156,12 +166,22 @@ DeleteIdentitiesOutcome CognitoIdentityClient::DeleteIdentities(const DeleteIden
 
 DeleteIdentitiesOutcomeCallable CognitoIdentityClient::DeleteIdentitiesCallable(const DeleteIdentitiesRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::DeleteIdentities, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::DeleteIdentities, Aws::Client::RejectedCallOutcome<DeleteIdentitiesOutcome>(), this, request);
+}
+
+DeleteIdentitiesOutcomeCallable CognitoIdentityClient::DeleteIdentitiesCallable(DeleteIdentitiesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::DeleteIdentities, Aws::Client::RejectedCallOutcome<DeleteIdentitiesOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::DeleteIdentitiesAsync(const DeleteIdentitiesRequest& request, const DeleteIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::DeleteIdentitiesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::DeleteIdentitiesAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIdentitiesOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::DeleteIdentitiesAsync(DeleteIdentitiesRequest&& request, const DeleteIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::DeleteIdentitiesAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIdentitiesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::DeleteIdentitiesAsyncHelper(const DeleteIdentitiesRequest& request, const DeleteIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -187,12 +207,22 @@ DeleteIdentityPoolOutcome CognitoIdentityClient::DeleteIdentityPool(const Delete
 
 DeleteIdentityPoolOutcomeCallable CognitoIdentityClient::DeleteIdentityPoolCallable(const DeleteIdentityPoolRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::DeleteIdentityPool, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::DeleteIdentityPool, Aws::Client::RejectedCallOutcome<DeleteIdentityPoolOutcome>(), this, request);
+}
+
+DeleteIdentityPoolOutcomeCallable CognitoIdentityClient::DeleteIdentityPoolCallable(DeleteIdentityPoolRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::DeleteIdentityPool, Aws::Client::RejectedCallOutcome<DeleteIdentityPoolOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::DeleteIdentityPoolAsync(const DeleteIdentityPoolRequest& request, const DeleteIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::DeleteIdentityPoolAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::DeleteIdentityPoolAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIdentityPoolOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::DeleteIdentityPoolAsync(DeleteIdentityPoolRequest&& request, const DeleteIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::DeleteIdentityPoolAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIdentityPoolOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::DeleteIdentityPoolAsyncHelper(const DeleteIdentityPoolRequest& request, const DeleteIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -218,12 +248,22 @@ DescribeIdentityOutcome CognitoIdentityClient::DescribeIdentity(const DescribeId
 
 DescribeIdentityOutcomeCallable CognitoIdentityClient::DescribeIdentityCallable(const DescribeIdentityRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::DescribeIdentity, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::DescribeIdentity, Aws::Client::RejectedCallOutcome<DescribeIdentityOutcome>(), this, request);
+}
+
+DescribeIdentityOutcomeCallable CognitoIdentityClient::DescribeIdentityCallable(DescribeIdentityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::DescribeIdentity, Aws::Client::RejectedCallOutcome<DescribeIdentityOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::DescribeIdentityAsync(const DescribeIdentityRequest& request, const DescribeIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::DescribeIdentityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::DescribeIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeIdentityOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::DescribeIdentityAsync(DescribeIdentityRequest&& request, const DescribeIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::DescribeIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeIdentityOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::DescribeIdentityAsyncHelper(const DescribeIdentityRequest& request, const DescribeIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -249,12 +289,22 @@ DescribeIdentityPoolOutcome CognitoIdentityClient::DescribeIdentityPool(const De
 
 DescribeIdentityPoolOutcomeCallable CognitoIdentityClient::DescribeIdentityPoolCallable(const DescribeIdentityPoolRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::DescribeIdentityPool, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::DescribeIdentityPool, Aws::Client::RejectedCallOutcome<DescribeIdentityPoolOutcome>(), this, request);
+}
+
+DescribeIdentityPoolOutcomeCallable CognitoIdentityClient::DescribeIdentityPoolCallable(DescribeIdentityPoolRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::DescribeIdentityPool, Aws::Client::RejectedCallOutcome<DescribeIdentityPoolOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::DescribeIdentityPoolAsync(const DescribeIdentityPoolRequest& request, const DescribeIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::DescribeIdentityPoolAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::DescribeIdentityPoolAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeIdentityPoolOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::DescribeIdentityPoolAsync(DescribeIdentityPoolRequest&& request, const DescribeIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::DescribeIdentityPoolAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeIdentityPoolOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::DescribeIdentityPoolAsyncHelper(const DescribeIdentityPoolRequest& request, const DescribeIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -280,12 +330,22 @@ GetCredentialsForIdentityOutcome CognitoIdentityClient::GetCredentialsForIdentit
 
 GetCredentialsForIdentityOutcomeCallable CognitoIdentityClient::GetCredentialsForIdentityCallable(const GetCredentialsForIdentityRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::GetCredentialsForIdentity, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::GetCredentialsForIdentity, Aws::Client::RejectedCallOutcome<GetCredentialsForIdentityOutcome>(), this, request);
+}
+
+GetCredentialsForIdentityOutcomeCallable CognitoIdentityClient::GetCredentialsForIdentityCallable(GetCredentialsForIdentityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::GetCredentialsForIdentity, Aws::Client::RejectedCallOutcome<GetCredentialsForIdentityOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::GetCredentialsForIdentityAsync(const GetCredentialsForIdentityRequest& request, const GetCredentialsForIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::GetCredentialsForIdentityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::GetCredentialsForIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<GetCredentialsForIdentityOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::GetCredentialsForIdentityAsync(GetCredentialsForIdentityRequest&& request, const GetCredentialsForIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::GetCredentialsForIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<GetCredentialsForIdentityOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::GetCredentialsForIdentityAsyncHelper(const GetCredentialsForIdentityRequest& request, const GetCredentialsForIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -311,12 +371,22 @@ GetIdOutcome CognitoIdentityClient::GetId(const GetIdRequest& request) const
 
 GetIdOutcomeCallable CognitoIdentityClient::GetIdCallable(const GetIdRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::GetId, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::GetId, Aws::Client::RejectedCallOutcome<GetIdOutcome>(), this, request);
+}
+
+GetIdOutcomeCallable CognitoIdentityClient::GetIdCallable(GetIdRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::GetId, Aws::Client::RejectedCallOutcome<GetIdOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::GetIdAsync(const GetIdRequest& request, const GetIdResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::GetIdAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::GetIdAsyncHelper, Aws::Client::RejectedAsyncCall<GetIdOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::GetIdAsync(GetIdRequest&& request, const GetIdResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::GetIdAsyncHelper, Aws::Client::RejectedAsyncCall<GetIdOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::GetIdAsyncHelper(const GetIdRequest& request, const GetIdResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -342,12 +412,22 @@ GetIdentityPoolRolesOutcome CognitoIdentityClient::GetIdentityPoolRoles(const Ge
 
 GetIdentityPoolRolesOutcomeCallable CognitoIdentityClient::GetIdentityPoolRolesCallable(const GetIdentityPoolRolesRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::GetIdentityPoolRoles, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::GetIdentityPoolRoles, Aws::Client::RejectedCallOutcome<GetIdentityPoolRolesOutcome>(), this, request);
+}
+
+GetIdentityPoolRolesOutcomeCallable CognitoIdentityClient::GetIdentityPoolRolesCallable(GetIdentityPoolRolesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::GetIdentityPoolRoles, Aws::Client::RejectedCallOutcome<GetIdentityPoolRolesOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::GetIdentityPoolRolesAsync(const GetIdentityPoolRolesRequest& request, const GetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::GetIdentityPoolRolesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::GetIdentityPoolRolesAsyncHelper, Aws::Client::RejectedAsyncCall<GetIdentityPoolRolesOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::GetIdentityPoolRolesAsync(GetIdentityPoolRolesRequest&& request, const GetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::GetIdentityPoolRolesAsyncHelper, Aws::Client::RejectedAsyncCall<GetIdentityPoolRolesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::GetIdentityPoolRolesAsyncHelper(const GetIdentityPoolRolesRequest& request, const GetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -373,12 +453,22 @@ GetOpenIdTokenOutcome CognitoIdentityClient::GetOpenIdToken(const GetOpenIdToken
 
 GetOpenIdTokenOutcomeCallable CognitoIdentityClient::GetOpenIdTokenCallable(const GetOpenIdTokenRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::GetOpenIdToken, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::GetOpenIdToken, Aws::Client::RejectedCallOutcome<GetOpenIdTokenOutcome>(), this, request);
+}
+
+GetOpenIdTokenOutcomeCallable CognitoIdentityClient::GetOpenIdTokenCallable(GetOpenIdTokenRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::GetOpenIdToken, Aws::Client::RejectedCallOutcome<GetOpenIdTokenOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::GetOpenIdTokenAsync(const GetOpenIdTokenRequest& request, const GetOpenIdTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::GetOpenIdTokenAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::GetOpenIdTokenAsyncHelper, Aws::Client::RejectedAsyncCall<GetOpenIdTokenOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::GetOpenIdTokenAsync(GetOpenIdTokenRequest&& request, const GetOpenIdTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::GetOpenIdTokenAsyncHelper, Aws::Client::RejectedAsyncCall<GetOpenIdTokenOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::GetOpenIdTokenAsyncHelper(const GetOpenIdTokenRequest& request, const GetOpenIdTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -404,12 +494,22 @@ GetOpenIdTokenForDeveloperIdentityOutcome CognitoIdentityClient::GetOpenIdTokenF
 
 GetOpenIdTokenForDeveloperIdentityOutcomeCallable CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityCallable(const GetOpenIdTokenForDeveloperIdentityRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentity, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentity, Aws::Client::RejectedCallOutcome<GetOpenIdTokenForDeveloperIdentityOutcome>(), this, request);
+}
+
+GetOpenIdTokenForDeveloperIdentityOutcomeCallable CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityCallable(GetOpenIdTokenForDeveloperIdentityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentity, Aws::Client::RejectedCallOutcome<GetOpenIdTokenForDeveloperIdentityOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityAsync(const GetOpenIdTokenForDeveloperIdentityRequest& request, const GetOpenIdTokenForDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<GetOpenIdTokenForDeveloperIdentityOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityAsync(GetOpenIdTokenForDeveloperIdentityRequest&& request, const GetOpenIdTokenForDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<GetOpenIdTokenForDeveloperIdentityOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::GetOpenIdTokenForDeveloperIdentityAsyncHelper(const GetOpenIdTokenForDeveloperIdentityRequest& request, const GetOpenIdTokenForDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -435,12 +535,22 @@ ListIdentitiesOutcome CognitoIdentityClient::ListIdentities(const ListIdentities
 
 ListIdentitiesOutcomeCallable CognitoIdentityClient::ListIdentitiesCallable(const ListIdentitiesRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::ListIdentities, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::ListIdentities, Aws::Client::RejectedCallOutcome<ListIdentitiesOutcome>(), this, request);
+}
+
+ListIdentitiesOutcomeCallable CognitoIdentityClient::ListIdentitiesCallable(ListIdentitiesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::ListIdentities, Aws::Client::RejectedCallOutcome<ListIdentitiesOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::ListIdentitiesAsync(const ListIdentitiesRequest& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::ListIdentitiesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::ListIdentitiesAsyncHelper, Aws::Client::RejectedAsyncCall<ListIdentitiesOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::ListIdentitiesAsync(ListIdentitiesRequest&& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::ListIdentitiesAsyncHelper, Aws::Client::RejectedAsyncCall<ListIdentitiesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::ListIdentitiesAsyncHelper(const ListIdentitiesRequest& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -466,12 +576,22 @@ ListIdentityPoolsOutcome CognitoIdentityClient::ListIdentityPools(const ListIden
 
 ListIdentityPoolsOutcomeCallable CognitoIdentityClient::ListIdentityPoolsCallable(const ListIdentityPoolsRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::ListIdentityPools, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::ListIdentityPools, Aws::Client::RejectedCallOutcome<ListIdentityPoolsOutcome>(), this, request);
+}
+
+ListIdentityPoolsOutcomeCallable CognitoIdentityClient::ListIdentityPoolsCallable(ListIdentityPoolsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::ListIdentityPools, Aws::Client::RejectedCallOutcome<ListIdentityPoolsOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::ListIdentityPoolsAsync(const ListIdentityPoolsRequest& request, const ListIdentityPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::ListIdentityPoolsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::ListIdentityPoolsAsyncHelper, Aws::Client::RejectedAsyncCall<ListIdentityPoolsOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::ListIdentityPoolsAsync(ListIdentityPoolsRequest&& request, const ListIdentityPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::ListIdentityPoolsAsyncHelper, Aws::Client::RejectedAsyncCall<ListIdentityPoolsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::ListIdentityPoolsAsyncHelper(const ListIdentityPoolsRequest& request, const ListIdentityPoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -497,12 +617,22 @@ LookupDeveloperIdentityOutcome CognitoIdentityClient::LookupDeveloperIdentity(co
 
 LookupDeveloperIdentityOutcomeCallable CognitoIdentityClient::LookupDeveloperIdentityCallable(const LookupDeveloperIdentityRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::LookupDeveloperIdentity, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::LookupDeveloperIdentity, Aws::Client::RejectedCallOutcome<LookupDeveloperIdentityOutcome>(), this, request);
+}
+
+LookupDeveloperIdentityOutcomeCallable CognitoIdentityClient::LookupDeveloperIdentityCallable(LookupDeveloperIdentityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::LookupDeveloperIdentity, Aws::Client::RejectedCallOutcome<LookupDeveloperIdentityOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::LookupDeveloperIdentityAsync(const LookupDeveloperIdentityRequest& request, const LookupDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::LookupDeveloperIdentityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::LookupDeveloperIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<LookupDeveloperIdentityOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::LookupDeveloperIdentityAsync(LookupDeveloperIdentityRequest&& request, const LookupDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::LookupDeveloperIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<LookupDeveloperIdentityOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::LookupDeveloperIdentityAsyncHelper(const LookupDeveloperIdentityRequest& request, const LookupDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -528,12 +658,22 @@ MergeDeveloperIdentitiesOutcome CognitoIdentityClient::MergeDeveloperIdentities(
 
 MergeDeveloperIdentitiesOutcomeCallable CognitoIdentityClient::MergeDeveloperIdentitiesCallable(const MergeDeveloperIdentitiesRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::MergeDeveloperIdentities, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::MergeDeveloperIdentities, Aws::Client::RejectedCallOutcome<MergeDeveloperIdentitiesOutcome>(), this, request);
+}
+
+MergeDeveloperIdentitiesOutcomeCallable CognitoIdentityClient::MergeDeveloperIdentitiesCallable(MergeDeveloperIdentitiesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::MergeDeveloperIdentities, Aws::Client::RejectedCallOutcome<MergeDeveloperIdentitiesOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::MergeDeveloperIdentitiesAsync(const MergeDeveloperIdentitiesRequest& request, const MergeDeveloperIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::MergeDeveloperIdentitiesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::MergeDeveloperIdentitiesAsyncHelper, Aws::Client::RejectedAsyncCall<MergeDeveloperIdentitiesOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::MergeDeveloperIdentitiesAsync(MergeDeveloperIdentitiesRequest&& request, const MergeDeveloperIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::MergeDeveloperIdentitiesAsyncHelper, Aws::Client::RejectedAsyncCall<MergeDeveloperIdentitiesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::MergeDeveloperIdentitiesAsyncHelper(const MergeDeveloperIdentitiesRequest& request, const MergeDeveloperIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -559,12 +699,22 @@ SetIdentityPoolRolesOutcome CognitoIdentityClient::SetIdentityPoolRoles(const Se
 
 SetIdentityPoolRolesOutcomeCallable CognitoIdentityClient::SetIdentityPoolRolesCallable(const SetIdentityPoolRolesRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::SetIdentityPoolRoles, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::SetIdentityPoolRoles, Aws::Client::RejectedCallOutcome<SetIdentityPoolRolesOutcome>(), this, request);
+}
+
+SetIdentityPoolRolesOutcomeCallable CognitoIdentityClient::SetIdentityPoolRolesCallable(SetIdentityPoolRolesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::SetIdentityPoolRoles, Aws::Client::RejectedCallOutcome<SetIdentityPoolRolesOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::SetIdentityPoolRolesAsync(const SetIdentityPoolRolesRequest& request, const SetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::SetIdentityPoolRolesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::SetIdentityPoolRolesAsyncHelper, Aws::Client::RejectedAsyncCall<SetIdentityPoolRolesOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::SetIdentityPoolRolesAsync(SetIdentityPoolRolesRequest&& request, const SetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::SetIdentityPoolRolesAsyncHelper, Aws::Client::RejectedAsyncCall<SetIdentityPoolRolesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::SetIdentityPoolRolesAsyncHelper(const SetIdentityPoolRolesRequest& request, const SetIdentityPoolRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -590,12 +740,22 @@ UnlinkDeveloperIdentityOutcome CognitoIdentityClient::UnlinkDeveloperIdentity(co
 
 UnlinkDeveloperIdentityOutcomeCallable CognitoIdentityClient::UnlinkDeveloperIdentityCallable(const UnlinkDeveloperIdentityRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::UnlinkDeveloperIdentity, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::UnlinkDeveloperIdentity, Aws::Client::RejectedCallOutcome<UnlinkDeveloperIdentityOutcome>(), this, request);
+}
+
+UnlinkDeveloperIdentityOutcomeCallable CognitoIdentityClient::UnlinkDeveloperIdentityCallable(UnlinkDeveloperIdentityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::UnlinkDeveloperIdentity, Aws::Client::RejectedCallOutcome<UnlinkDeveloperIdentityOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::UnlinkDeveloperIdentityAsync(const UnlinkDeveloperIdentityRequest& request, const UnlinkDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::UnlinkDeveloperIdentityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::UnlinkDeveloperIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<UnlinkDeveloperIdentityOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::UnlinkDeveloperIdentityAsync(UnlinkDeveloperIdentityRequest&& request, const UnlinkDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::UnlinkDeveloperIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<UnlinkDeveloperIdentityOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::UnlinkDeveloperIdentityAsyncHelper(const UnlinkDeveloperIdentityRequest& request, const UnlinkDeveloperIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -621,12 +781,22 @@ UnlinkIdentityOutcome CognitoIdentityClient::UnlinkIdentity(const UnlinkIdentity
 
 UnlinkIdentityOutcomeCallable CognitoIdentityClient::UnlinkIdentityCallable(const UnlinkIdentityRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::UnlinkIdentity, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::UnlinkIdentity, Aws::Client::RejectedCallOutcome<UnlinkIdentityOutcome>(), this, request);
+}
+
+UnlinkIdentityOutcomeCallable CognitoIdentityClient::UnlinkIdentityCallable(UnlinkIdentityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::UnlinkIdentity, Aws::Client::RejectedCallOutcome<UnlinkIdentityOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::UnlinkIdentityAsync(const UnlinkIdentityRequest& request, const UnlinkIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::UnlinkIdentityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::UnlinkIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<UnlinkIdentityOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::UnlinkIdentityAsync(UnlinkIdentityRequest&& request, const UnlinkIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::UnlinkIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<UnlinkIdentityOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::UnlinkIdentityAsyncHelper(const UnlinkIdentityRequest& request, const UnlinkIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -652,12 +822,22 @@ UpdateIdentityPoolOutcome CognitoIdentityClient::UpdateIdentityPool(const Update
 
 UpdateIdentityPoolOutcomeCallable CognitoIdentityClient::UpdateIdentityPoolCallable(const UpdateIdentityPoolRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoIdentityClient::UpdateIdentityPool, this, request);
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::UpdateIdentityPool, Aws::Client::RejectedCallOutcome<UpdateIdentityPoolOutcome>(), this, request);
+}
+
+UpdateIdentityPoolOutcomeCallable CognitoIdentityClient::UpdateIdentityPoolCallable(UpdateIdentityPoolRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoIdentityClient::UpdateIdentityPool, Aws::Client::RejectedCallOutcome<UpdateIdentityPoolOutcome>(), this, std::move(request));
 }
 
 void CognitoIdentityClient::UpdateIdentityPoolAsync(const UpdateIdentityPoolRequest& request, const UpdateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoIdentityClient::UpdateIdentityPoolAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoIdentityClient::UpdateIdentityPoolAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateIdentityPoolOutcome>(), this, request, handler, context);
+}
+
+void CognitoIdentityClient::UpdateIdentityPoolAsync(UpdateIdentityPoolRequest&& request, const UpdateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoIdentityClient::UpdateIdentityPoolAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateIdentityPoolOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoIdentityClient::UpdateIdentityPoolAsyncHelper(const UpdateIdentityPoolRequest& request, const UpdateIdentityPoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
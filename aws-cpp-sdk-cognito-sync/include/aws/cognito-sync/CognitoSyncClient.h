@@ -39,6 +39,27 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/cognito-sync/model/BulkPublishRequest.h>
+#include <aws/cognito-sync/model/DeleteDatasetRequest.h>
+#include <aws/cognito-sync/model/DescribeDatasetRequest.h>
+#include <aws/cognito-sync/model/DescribeIdentityPoolUsageRequest.h>
+#include <aws/cognito-sync/model/DescribeIdentityUsageRequest.h>
+#include <aws/cognito-sync/model/GetBulkPublishDetailsRequest.h>
+#include <aws/cognito-sync/model/GetCognitoEventsRequest.h>
+#include <aws/cognito-sync/model/GetIdentityPoolConfigurationRequest.h>
+#include <aws/cognito-sync/model/ListDatasetsRequest.h>
+#include <aws/cognito-sync/model/ListIdentityPoolUsageRequest.h>
+#include <aws/cognito-sync/model/ListRecordsRequest.h>
+#include <aws/cognito-sync/model/RegisterDeviceRequest.h>
+#include <aws/cognito-sync/model/SetCognitoEventsRequest.h>
+#include <aws/cognito-sync/model/SetIdentityPoolConfigurationRequest.h>
+#include <aws/cognito-sync/model/SubscribeToDatasetRequest.h>
+#include <aws/cognito-sync/model/UnsubscribeFromDatasetRequest.h>
+#include <aws/cognito-sync/model/UpdateRecordsRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -228,6 +249,11 @@ namespace Model
          */
         virtual Model::BulkPublishOutcomeCallable BulkPublishCallable(const Model::BulkPublishRequest& request) const;
 
+        /**
+         * Same as BulkPublishCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BulkPublishOutcomeCallable BulkPublishCallable(Model::BulkPublishRequest&& request) const;
+
         /**
          * <p>Initiates a bulk publish of all existing datasets for an Identity Pool to the
          * configured stream. Customers are limited to one successful bulk publish per 24
@@ -240,6 +266,11 @@ namespace Model
          */
         virtual void BulkPublishAsync(const Model::BulkPublishRequest& request, const BulkPublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BulkPublishAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BulkPublishAsync(Model::BulkPublishRequest&& request, const BulkPublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specific dataset. The dataset will be deleted permanently, and
          * the action can't be undone. Datasets that this dataset was merged with will no
@@ -260,6 +291,11 @@ namespace Model
          */
         virtual Model::DeleteDatasetOutcomeCallable DeleteDatasetCallable(const Model::DeleteDatasetRequest& request) const;
 
+        /**
+         * Same as DeleteDatasetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDatasetOutcomeCallable DeleteDatasetCallable(Model::DeleteDatasetRequest&& request) const;
+
         /**
          * <p>Deletes the specific dataset. The dataset will be deleted permanently, and
          * the action can't be undone. Datasets that this dataset was merged with will no
@@ -271,6 +307,11 @@ namespace Model
          */
         virtual void DeleteDatasetAsync(const Model::DeleteDatasetRequest& request, const DeleteDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDatasetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDatasetAsync(Model::DeleteDatasetRequest&& request, const DeleteDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets meta data about a dataset by identity and dataset name. With Amazon
          * Cognito Sync, each identity has access only to its own data. Thus, the
@@ -293,6 +334,11 @@ namespace Model
          */
         virtual Model::DescribeDatasetOutcomeCallable DescribeDatasetCallable(const Model::DescribeDatasetRequest& request) const;
 
+        /**
+         * Same as DescribeDatasetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDatasetOutcomeCallable DescribeDatasetCallable(Model::DescribeDatasetRequest&& request) const;
+
         /**
          * <p>Gets meta data about a dataset by identity and dataset name. With Amazon
          * Cognito Sync, each identity has access only to its own data. Thus, the
@@ -305,6 +351,11 @@ namespace Model
          */
         virtual void DescribeDatasetAsync(const Model::DescribeDatasetRequest& request, const DescribeDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDatasetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDatasetAsync(Model::DescribeDatasetRequest&& request, const DescribeDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets usage details (for example, data storage) about a particular identity
          * pool.</p> <p>This API can only be called with developer credentials. You cannot
@@ -323,6 +374,11 @@ namespace Model
          */
         virtual Model::DescribeIdentityPoolUsageOutcomeCallable DescribeIdentityPoolUsageCallable(const Model::DescribeIdentityPoolUsageRequest& request) const;
 
+        /**
+         * Same as DescribeIdentityPoolUsageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeIdentityPoolUsageOutcomeCallable DescribeIdentityPoolUsageCallable(Model::DescribeIdentityPoolUsageRequest&& request) const;
+
         /**
          * <p>Gets usage details (for example, data storage) about a particular identity
          * pool.</p> <p>This API can only be called with developer credentials. You cannot
@@ -333,6 +389,11 @@ namespace Model
          */
         virtual void DescribeIdentityPoolUsageAsync(const Model::DescribeIdentityPoolUsageRequest& request, const DescribeIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeIdentityPoolUsageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeIdentityPoolUsageAsync(Model::DescribeIdentityPoolUsageRequest&& request, const DescribeIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets usage information for an identity, including number of datasets and data
          * usage.</p> <p>This API can be called with temporary user credentials provided by
@@ -349,6 +410,11 @@ namespace Model
          */
         virtual Model::DescribeIdentityUsageOutcomeCallable DescribeIdentityUsageCallable(const Model::DescribeIdentityUsageRequest& request) const;
 
+        /**
+         * Same as DescribeIdentityUsageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeIdentityUsageOutcomeCallable DescribeIdentityUsageCallable(Model::DescribeIdentityUsageRequest&& request) const;
+
         /**
          * <p>Gets usage information for an identity, including number of datasets and data
          * usage.</p> <p>This API can be called with temporary user credentials provided by
@@ -358,6 +424,11 @@ namespace Model
          */
         virtual void DescribeIdentityUsageAsync(const Model::DescribeIdentityUsageRequest& request, const DescribeIdentityUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeIdentityUsageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeIdentityUsageAsync(Model::DescribeIdentityUsageRequest&& request, const DescribeIdentityUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Get the status of the last BulkPublish operation for an identity pool.</p>
          * <p>This API can only be called with developer credentials. You cannot call this
@@ -374,6 +445,11 @@ namespace Model
          */
         virtual Model::GetBulkPublishDetailsOutcomeCallable GetBulkPublishDetailsCallable(const Model::GetBulkPublishDetailsRequest& request) const;
 
+        /**
+         * Same as GetBulkPublishDetailsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBulkPublishDetailsOutcomeCallable GetBulkPublishDetailsCallable(Model::GetBulkPublishDetailsRequest&& request) const;
+
         /**
          * <p>Get the status of the last BulkPublish operation for an identity pool.</p>
          * <p>This API can only be called with developer credentials. You cannot call this
@@ -383,6 +459,11 @@ namespace Model
          */
         virtual void GetBulkPublishDetailsAsync(const Model::GetBulkPublishDetailsRequest& request, const GetBulkPublishDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBulkPublishDetailsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBulkPublishDetailsAsync(Model::GetBulkPublishDetailsRequest&& request, const GetBulkPublishDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the events and the corresponding Lambda functions associated with an
          * identity pool.</p> <p>This API can only be called with developer credentials.
@@ -401,6 +482,11 @@ namespace Model
          */
         virtual Model::GetCognitoEventsOutcomeCallable GetCognitoEventsCallable(const Model::GetCognitoEventsRequest& request) const;
 
+        /**
+         * Same as GetCognitoEventsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetCognitoEventsOutcomeCallable GetCognitoEventsCallable(Model::GetCognitoEventsRequest&& request) const;
+
         /**
          * <p>Gets the events and the corresponding Lambda functions associated with an
          * identity pool.</p> <p>This API can only be called with developer credentials.
@@ -411,6 +497,11 @@ namespace Model
          */
         virtual void GetCognitoEventsAsync(const Model::GetCognitoEventsRequest& request, const GetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCognitoEventsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetCognitoEventsAsync(Model::GetCognitoEventsRequest&& request, const GetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the configuration settings of an identity pool.</p> <p>This API can only
          * be called with developer credentials. You cannot call this API with the
@@ -427,6 +518,11 @@ namespace Model
          */
         virtual Model::GetIdentityPoolConfigurationOutcomeCallable GetIdentityPoolConfigurationCallable(const Model::GetIdentityPoolConfigurationRequest& request) const;
 
+        /**
+         * Same as GetIdentityPoolConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetIdentityPoolConfigurationOutcomeCallable GetIdentityPoolConfigurationCallable(Model::GetIdentityPoolConfigurationRequest&& request) const;
+
         /**
          * <p>Gets the configuration settings of an identity pool.</p> <p>This API can only
          * be called with developer credentials. You cannot call this API with the
@@ -436,6 +532,11 @@ namespace Model
          */
         virtual void GetIdentityPoolConfigurationAsync(const Model::GetIdentityPoolConfigurationRequest& request, const GetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdentityPoolConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetIdentityPoolConfigurationAsync(Model::GetIdentityPoolConfigurationRequest&& request, const GetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists datasets for an identity. With Amazon Cognito Sync, each identity has
          * access only to its own data. Thus, the credentials used to make this API call
@@ -458,6 +559,11 @@ namespace Model
          */
         virtual Model::ListDatasetsOutcomeCallable ListDatasetsCallable(const Model::ListDatasetsRequest& request) const;
 
+        /**
+         * Same as ListDatasetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDatasetsOutcomeCallable ListDatasetsCallable(Model::ListDatasetsRequest&& request) const;
+
         /**
          * <p>Lists datasets for an identity. With Amazon Cognito Sync, each identity has
          * access only to its own data. Thus, the credentials used to make this API call
@@ -470,6 +576,11 @@ namespace Model
          */
         virtual void ListDatasetsAsync(const Model::ListDatasetsRequest& request, const ListDatasetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDatasetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDatasetsAsync(Model::ListDatasetsRequest&& request, const ListDatasetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a list of identity pools registered with Cognito.</p>
          * <p>ListIdentityPoolUsage can only be called with developer credentials. You
@@ -488,6 +599,11 @@ namespace Model
          */
         virtual Model::ListIdentityPoolUsageOutcomeCallable ListIdentityPoolUsageCallable(const Model::ListIdentityPoolUsageRequest& request) const;
 
+        /**
+         * Same as ListIdentityPoolUsageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListIdentityPoolUsageOutcomeCallable ListIdentityPoolUsageCallable(Model::ListIdentityPoolUsageRequest&& request) const;
+
         /**
          * <p>Gets a list of identity pools registered with Cognito.</p>
          * <p>ListIdentityPoolUsage can only be called with developer credentials. You
@@ -498,6 +614,11 @@ namespace Model
          */
         virtual void ListIdentityPoolUsageAsync(const Model::ListIdentityPoolUsageRequest& request, const ListIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListIdentityPoolUsageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListIdentityPoolUsageAsync(Model::ListIdentityPoolUsageRequest&& request, const ListIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets paginated records, optionally changed after a particular sync count for
          * a dataset and identity. With Amazon Cognito Sync, each identity has access only
@@ -520,6 +641,11 @@ namespace Model
          */
         virtual Model::ListRecordsOutcomeCallable ListRecordsCallable(const Model::ListRecordsRequest& request) const;
 
+        /**
+         * Same as ListRecordsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListRecordsOutcomeCallable ListRecordsCallable(Model::ListRecordsRequest&& request) const;
+
         /**
          * <p>Gets paginated records, optionally changed after a particular sync count for
          * a dataset and identity. With Amazon Cognito Sync, each identity has access only
@@ -532,6 +658,11 @@ namespace Model
          */
         virtual void ListRecordsAsync(const Model::ListRecordsRequest& request, const ListRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRecordsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListRecordsAsync(Model::ListRecordsRequest&& request, const ListRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers a device to receive push sync notifications.</p> <p>This API can
          * only be called with temporary credentials provided by Cognito Identity. You
@@ -548,6 +679,11 @@ namespace Model
          */
         virtual Model::RegisterDeviceOutcomeCallable RegisterDeviceCallable(const Model::RegisterDeviceRequest& request) const;
 
+        /**
+         * Same as RegisterDeviceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterDeviceOutcomeCallable RegisterDeviceCallable(Model::RegisterDeviceRequest&& request) const;
+
         /**
          * <p>Registers a device to receive push sync notifications.</p> <p>This API can
          * only be called with temporary credentials provided by Cognito Identity. You
@@ -557,6 +693,11 @@ namespace Model
          */
         virtual void RegisterDeviceAsync(const Model::RegisterDeviceRequest& request, const RegisterDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterDeviceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterDeviceAsync(Model::RegisterDeviceRequest&& request, const RegisterDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the AWS Lambda function for a given event type for an identity pool.
          * This request only updates the key/value pair specified. Other key/values pairs
@@ -579,6 +720,11 @@ namespace Model
          */
         virtual Model::SetCognitoEventsOutcomeCallable SetCognitoEventsCallable(const Model::SetCognitoEventsRequest& request) const;
 
+        /**
+         * Same as SetCognitoEventsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetCognitoEventsOutcomeCallable SetCognitoEventsCallable(Model::SetCognitoEventsRequest&& request) const;
+
         /**
          * <p>Sets the AWS Lambda function for a given event type for an identity pool.
          * This request only updates the key/value pair specified. Other key/values pairs
@@ -591,6 +737,11 @@ namespace Model
          */
         virtual void SetCognitoEventsAsync(const Model::SetCognitoEventsRequest& request, const SetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetCognitoEventsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetCognitoEventsAsync(Model::SetCognitoEventsRequest&& request, const SetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the necessary configuration for push sync.</p> <p>This API can only be
          * called with developer credentials. You cannot call this API with the temporary
@@ -607,6 +758,11 @@ namespace Model
          */
         virtual Model::SetIdentityPoolConfigurationOutcomeCallable SetIdentityPoolConfigurationCallable(const Model::SetIdentityPoolConfigurationRequest& request) const;
 
+        /**
+         * Same as SetIdentityPoolConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetIdentityPoolConfigurationOutcomeCallable SetIdentityPoolConfigurationCallable(Model::SetIdentityPoolConfigurationRequest&& request) const;
+
         /**
          * <p>Sets the necessary configuration for push sync.</p> <p>This API can only be
          * called with developer credentials. You cannot call this API with the temporary
@@ -616,6 +772,11 @@ namespace Model
          */
         virtual void SetIdentityPoolConfigurationAsync(const Model::SetIdentityPoolConfigurationRequest& request, const SetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetIdentityPoolConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetIdentityPoolConfigurationAsync(Model::SetIdentityPoolConfigurationRequest&& request, const SetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Subscribes to receive notifications when a dataset is modified by another
          * device.</p> <p>This API can only be called with temporary credentials provided
@@ -632,6 +793,11 @@ namespace Model
          */
         virtual Model::SubscribeToDatasetOutcomeCallable SubscribeToDatasetCallable(const Model::SubscribeToDatasetRequest& request) const;
 
+        /**
+         * Same as SubscribeToDatasetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SubscribeToDatasetOutcomeCallable SubscribeToDatasetCallable(Model::SubscribeToDatasetRequest&& request) const;
+
         /**
          * <p>Subscribes to receive notifications when a dataset is modified by another
          * device.</p> <p>This API can only be called with temporary credentials provided
@@ -641,6 +807,11 @@ namespace Model
          */
         virtual void SubscribeToDatasetAsync(const Model::SubscribeToDatasetRequest& request, const SubscribeToDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SubscribeToDatasetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SubscribeToDatasetAsync(Model::SubscribeToDatasetRequest&& request, const SubscribeToDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Unsubscribes from receiving notifications when a dataset is modified by
          * another device.</p> <p>This API can only be called with temporary credentials
@@ -659,6 +830,11 @@ namespace Model
          */
         virtual Model::UnsubscribeFromDatasetOutcomeCallable UnsubscribeFromDatasetCallable(const Model::UnsubscribeFromDatasetRequest& request) const;
 
+        /**
+         * Same as UnsubscribeFromDatasetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UnsubscribeFromDatasetOutcomeCallable UnsubscribeFromDatasetCallable(Model::UnsubscribeFromDatasetRequest&& request) const;
+
         /**
          * <p>Unsubscribes from receiving notifications when a dataset is modified by
          * another device.</p> <p>This API can only be called with temporary credentials
@@ -669,6 +845,11 @@ namespace Model
          */
         virtual void UnsubscribeFromDatasetAsync(const Model::UnsubscribeFromDatasetRequest& request, const UnsubscribeFromDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnsubscribeFromDatasetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UnsubscribeFromDatasetAsync(Model::UnsubscribeFromDatasetRequest&& request, const UnsubscribeFromDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Posts updates to records and adds and deletes records for a dataset and
          * user.</p> <p>The sync count in the record patch is your last known sync count
@@ -703,6 +884,11 @@ namespace Model
          */
         virtual Model::UpdateRecordsOutcomeCallable UpdateRecordsCallable(const Model::UpdateRecordsRequest& request) const;
 
+        /**
+         * Same as UpdateRecordsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateRecordsOutcomeCallable UpdateRecordsCallable(Model::UpdateRecordsRequest&& request) const;
+
         /**
          * <p>Posts updates to records and adds and deletes records for a dataset and
          * user.</p> <p>The sync count in the record patch is your last known sync count
@@ -721,6 +907,52 @@ namespace Model
          */
         virtual void UpdateRecordsAsync(const Model::UpdateRecordsRequest& request, const UpdateRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRecordsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateRecordsAsync(Model::UpdateRecordsRequest&& request, const UpdateRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::BulkPublishOutcome> BulkPublishAwaitable(const Model::BulkPublishRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::BulkPublish, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BulkPublishOutcome> BulkPublishAwaitable(Model::BulkPublishRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::BulkPublish, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDatasetOutcome> DeleteDatasetAwaitable(const Model::DeleteDatasetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::DeleteDataset, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDatasetOutcome> DeleteDatasetAwaitable(Model::DeleteDatasetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::DeleteDataset, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDatasetOutcome> DescribeDatasetAwaitable(const Model::DescribeDatasetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::DescribeDataset, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDatasetOutcome> DescribeDatasetAwaitable(Model::DescribeDatasetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::DescribeDataset, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeIdentityPoolUsageOutcome> DescribeIdentityPoolUsageAwaitable(const Model::DescribeIdentityPoolUsageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::DescribeIdentityPoolUsage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeIdentityPoolUsageOutcome> DescribeIdentityPoolUsageAwaitable(Model::DescribeIdentityPoolUsageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::DescribeIdentityPoolUsage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeIdentityUsageOutcome> DescribeIdentityUsageAwaitable(const Model::DescribeIdentityUsageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::DescribeIdentityUsage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeIdentityUsageOutcome> DescribeIdentityUsageAwaitable(Model::DescribeIdentityUsageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::DescribeIdentityUsage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBulkPublishDetailsOutcome> GetBulkPublishDetailsAwaitable(const Model::GetBulkPublishDetailsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::GetBulkPublishDetails, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBulkPublishDetailsOutcome> GetBulkPublishDetailsAwaitable(Model::GetBulkPublishDetailsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::GetBulkPublishDetails, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCognitoEventsOutcome> GetCognitoEventsAwaitable(const Model::GetCognitoEventsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::GetCognitoEvents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCognitoEventsOutcome> GetCognitoEventsAwaitable(Model::GetCognitoEventsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::GetCognitoEvents, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIdentityPoolConfigurationOutcome> GetIdentityPoolConfigurationAwaitable(const Model::GetIdentityPoolConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::GetIdentityPoolConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIdentityPoolConfigurationOutcome> GetIdentityPoolConfigurationAwaitable(Model::GetIdentityPoolConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::GetIdentityPoolConfiguration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDatasetsOutcome> ListDatasetsAwaitable(const Model::ListDatasetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::ListDatasets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDatasetsOutcome> ListDatasetsAwaitable(Model::ListDatasetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::ListDatasets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListIdentityPoolUsageOutcome> ListIdentityPoolUsageAwaitable(const Model::ListIdentityPoolUsageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::ListIdentityPoolUsage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListIdentityPoolUsageOutcome> ListIdentityPoolUsageAwaitable(Model::ListIdentityPoolUsageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::ListIdentityPoolUsage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRecordsOutcome> ListRecordsAwaitable(const Model::ListRecordsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::ListRecords, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRecordsOutcome> ListRecordsAwaitable(Model::ListRecordsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::ListRecords, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterDeviceOutcome> RegisterDeviceAwaitable(const Model::RegisterDeviceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::RegisterDevice, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterDeviceOutcome> RegisterDeviceAwaitable(Model::RegisterDeviceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::RegisterDevice, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetCognitoEventsOutcome> SetCognitoEventsAwaitable(const Model::SetCognitoEventsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::SetCognitoEvents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetCognitoEventsOutcome> SetCognitoEventsAwaitable(Model::SetCognitoEventsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::SetCognitoEvents, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetIdentityPoolConfigurationOutcome> SetIdentityPoolConfigurationAwaitable(const Model::SetIdentityPoolConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::SetIdentityPoolConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetIdentityPoolConfigurationOutcome> SetIdentityPoolConfigurationAwaitable(Model::SetIdentityPoolConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::SetIdentityPoolConfiguration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SubscribeToDatasetOutcome> SubscribeToDatasetAwaitable(const Model::SubscribeToDatasetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::SubscribeToDataset, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SubscribeToDatasetOutcome> SubscribeToDatasetAwaitable(Model::SubscribeToDatasetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::SubscribeToDataset, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnsubscribeFromDatasetOutcome> UnsubscribeFromDatasetAwaitable(const Model::UnsubscribeFromDatasetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::UnsubscribeFromDataset, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnsubscribeFromDatasetOutcome> UnsubscribeFromDatasetAwaitable(Model::UnsubscribeFromDatasetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::UnsubscribeFromDataset, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateRecordsOutcome> UpdateRecordsAwaitable(const Model::UpdateRecordsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::UpdateRecords, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateRecordsOutcome> UpdateRecordsAwaitable(Model::UpdateRecordsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CognitoSyncClient::UpdateRecords, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -126,12 +126,22 @@ BulkPublishOutcome CognitoSyncClient::BulkPublish(const BulkPublishRequest& requ
 
 BulkPublishOutcomeCallable CognitoSyncClient::BulkPublishCallable(const BulkPublishRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::BulkPublish, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::BulkPublish, Aws::Client::RejectedCallOutcome<BulkPublishOutcome>(), this, request);
+}
+
+BulkPublishOutcomeCallable CognitoSyncClient::BulkPublishCallable(BulkPublishRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::BulkPublish, Aws::Client::RejectedCallOutcome<BulkPublishOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::BulkPublishAsync(const BulkPublishRequest& request, const BulkPublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::BulkPublishAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::BulkPublishAsyncHelper, Aws::Client::RejectedAsyncCall<BulkPublishOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::BulkPublishAsync(BulkPublishRequest&& request, const BulkPublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::BulkPublishAsyncHelper, Aws::Client::RejectedAsyncCall<BulkPublishOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::BulkPublishAsyncHelper(const BulkPublishRequest& request, const BulkPublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -162,12 +172,22 @@ DeleteDatasetOutcome CognitoSyncClient::DeleteDataset(const DeleteDatasetRequest
 
 DeleteDatasetOutcomeCallable CognitoSyncClient::DeleteDatasetCallable(const DeleteDatasetRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::DeleteDataset, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::DeleteDataset, Aws::Client::RejectedCallOutcome<DeleteDatasetOutcome>(), this, request);
+}
+
+DeleteDatasetOutcomeCallable CognitoSyncClient::DeleteDatasetCallable(DeleteDatasetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::DeleteDataset, Aws::Client::RejectedCallOutcome<DeleteDatasetOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::DeleteDatasetAsync(const DeleteDatasetRequest& request, const DeleteDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::DeleteDatasetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::DeleteDatasetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDatasetOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::DeleteDatasetAsync(DeleteDatasetRequest&& request, const DeleteDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::DeleteDatasetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDatasetOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::DeleteDatasetAsyncHelper(const DeleteDatasetRequest& request, const DeleteDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -198,12 +218,22 @@ DescribeDatasetOutcome CognitoSyncClient::DescribeDataset(const DescribeDatasetR
 
 DescribeDatasetOutcomeCallable CognitoSyncClient::DescribeDatasetCallable(const DescribeDatasetRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::DescribeDataset, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::DescribeDataset, Aws::Client::RejectedCallOutcome<DescribeDatasetOutcome>(), this, request);
+}
+
+DescribeDatasetOutcomeCallable CognitoSyncClient::DescribeDatasetCallable(DescribeDatasetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::DescribeDataset, Aws::Client::RejectedCallOutcome<DescribeDatasetOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::DescribeDatasetAsync(const DescribeDatasetRequest& request, const DescribeDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::DescribeDatasetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::DescribeDatasetAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDatasetOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::DescribeDatasetAsync(DescribeDatasetRequest&& request, const DescribeDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::DescribeDatasetAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDatasetOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::DescribeDatasetAsyncHelper(const DescribeDatasetRequest& request, const DescribeDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -230,12 +260,22 @@ DescribeIdentityPoolUsageOutcome CognitoSyncClient::DescribeIdentityPoolUsage(co
 
 DescribeIdentityPoolUsageOutcomeCallable CognitoSyncClient::DescribeIdentityPoolUsageCallable(const DescribeIdentityPoolUsageRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::DescribeIdentityPoolUsage, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::DescribeIdentityPoolUsage, Aws::Client::RejectedCallOutcome<DescribeIdentityPoolUsageOutcome>(), this, request);
+}
+
+DescribeIdentityPoolUsageOutcomeCallable CognitoSyncClient::DescribeIdentityPoolUsageCallable(DescribeIdentityPoolUsageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::DescribeIdentityPoolUsage, Aws::Client::RejectedCallOutcome<DescribeIdentityPoolUsageOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::DescribeIdentityPoolUsageAsync(const DescribeIdentityPoolUsageRequest& request, const DescribeIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::DescribeIdentityPoolUsageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::DescribeIdentityPoolUsageAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeIdentityPoolUsageOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::DescribeIdentityPoolUsageAsync(DescribeIdentityPoolUsageRequest&& request, const DescribeIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::DescribeIdentityPoolUsageAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeIdentityPoolUsageOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::DescribeIdentityPoolUsageAsyncHelper(const DescribeIdentityPoolUsageRequest& request, const DescribeIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -264,12 +304,22 @@ DescribeIdentityUsageOutcome CognitoSyncClient::DescribeIdentityUsage(const Desc
 
 DescribeIdentityUsageOutcomeCallable CognitoSyncClient::DescribeIdentityUsageCallable(const DescribeIdentityUsageRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::DescribeIdentityUsage, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::DescribeIdentityUsage, Aws::Client::RejectedCallOutcome<DescribeIdentityUsageOutcome>(), this, request);
+}
+
+DescribeIdentityUsageOutcomeCallable CognitoSyncClient::DescribeIdentityUsageCallable(DescribeIdentityUsageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::DescribeIdentityUsage, Aws::Client::RejectedCallOutcome<DescribeIdentityUsageOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::DescribeIdentityUsageAsync(const DescribeIdentityUsageRequest& request, const DescribeIdentityUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::DescribeIdentityUsageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::DescribeIdentityUsageAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeIdentityUsageOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::DescribeIdentityUsageAsync(DescribeIdentityUsageRequest&& request, const DescribeIdentityUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::DescribeIdentityUsageAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeIdentityUsageOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::DescribeIdentityUsageAsyncHelper(const DescribeIdentityUsageRequest& request, const DescribeIdentityUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -297,12 +347,22 @@ GetBulkPublishDetailsOutcome CognitoSyncClient::GetBulkPublishDetails(const GetB
 
 GetBulkPublishDetailsOutcomeCallable CognitoSyncClient::GetBulkPublishDetailsCallable(const GetBulkPublishDetailsRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::GetBulkPublishDetails, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::GetBulkPublishDetails, Aws::Client::RejectedCallOutcome<GetBulkPublishDetailsOutcome>(), this, request);
+}
+
+GetBulkPublishDetailsOutcomeCallable CognitoSyncClient::GetBulkPublishDetailsCallable(GetBulkPublishDetailsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::GetBulkPublishDetails, Aws::Client::RejectedCallOutcome<GetBulkPublishDetailsOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::GetBulkPublishDetailsAsync(const GetBulkPublishDetailsRequest& request, const GetBulkPublishDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::GetBulkPublishDetailsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::GetBulkPublishDetailsAsyncHelper, Aws::Client::RejectedAsyncCall<GetBulkPublishDetailsOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::GetBulkPublishDetailsAsync(GetBulkPublishDetailsRequest&& request, const GetBulkPublishDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::GetBulkPublishDetailsAsyncHelper, Aws::Client::RejectedAsyncCall<GetBulkPublishDetailsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::GetBulkPublishDetailsAsyncHelper(const GetBulkPublishDetailsRequest& request, const GetBulkPublishDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -330,12 +390,22 @@ GetCognitoEventsOutcome CognitoSyncClient::GetCognitoEvents(const GetCognitoEven
 
 GetCognitoEventsOutcomeCallable CognitoSyncClient::GetCognitoEventsCallable(const GetCognitoEventsRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::GetCognitoEvents, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::GetCognitoEvents, Aws::Client::RejectedCallOutcome<GetCognitoEventsOutcome>(), this, request);
+}
+
+GetCognitoEventsOutcomeCallable CognitoSyncClient::GetCognitoEventsCallable(GetCognitoEventsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::GetCognitoEvents, Aws::Client::RejectedCallOutcome<GetCognitoEventsOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::GetCognitoEventsAsync(const GetCognitoEventsRequest& request, const GetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::GetCognitoEventsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::GetCognitoEventsAsyncHelper, Aws::Client::RejectedAsyncCall<GetCognitoEventsOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::GetCognitoEventsAsync(GetCognitoEventsRequest&& request, const GetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::GetCognitoEventsAsyncHelper, Aws::Client::RejectedAsyncCall<GetCognitoEventsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::GetCognitoEventsAsyncHelper(const GetCognitoEventsRequest& request, const GetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -363,12 +433,22 @@ GetIdentityPoolConfigurationOutcome CognitoSyncClient::GetIdentityPoolConfigurat
 
 GetIdentityPoolConfigurationOutcomeCallable CognitoSyncClient::GetIdentityPoolConfigurationCallable(const GetIdentityPoolConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::GetIdentityPoolConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::GetIdentityPoolConfiguration, Aws::Client::RejectedCallOutcome<GetIdentityPoolConfigurationOutcome>(), this, request);
+}
+
+GetIdentityPoolConfigurationOutcomeCallable CognitoSyncClient::GetIdentityPoolConfigurationCallable(GetIdentityPoolConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::GetIdentityPoolConfiguration, Aws::Client::RejectedCallOutcome<GetIdentityPoolConfigurationOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::GetIdentityPoolConfigurationAsync(const GetIdentityPoolConfigurationRequest& request, const GetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::GetIdentityPoolConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::GetIdentityPoolConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<GetIdentityPoolConfigurationOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::GetIdentityPoolConfigurationAsync(GetIdentityPoolConfigurationRequest&& request, const GetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::GetIdentityPoolConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<GetIdentityPoolConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::GetIdentityPoolConfigurationAsyncHelper(const GetIdentityPoolConfigurationRequest& request, const GetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -398,12 +478,22 @@ ListDatasetsOutcome CognitoSyncClient::ListDatasets(const ListDatasetsRequest& r
 
 ListDatasetsOutcomeCallable CognitoSyncClient::ListDatasetsCallable(const ListDatasetsRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::ListDatasets, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::ListDatasets, Aws::Client::RejectedCallOutcome<ListDatasetsOutcome>(), this, request);
+}
+
+ListDatasetsOutcomeCallable CognitoSyncClient::ListDatasetsCallable(ListDatasetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::ListDatasets, Aws::Client::RejectedCallOutcome<ListDatasetsOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::ListDatasetsAsync(const ListDatasetsRequest& request, const ListDatasetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::ListDatasetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::ListDatasetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDatasetsOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::ListDatasetsAsync(ListDatasetsRequest&& request, const ListDatasetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::ListDatasetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDatasetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::ListDatasetsAsyncHelper(const ListDatasetsRequest& request, const ListDatasetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -429,12 +519,22 @@ ListIdentityPoolUsageOutcome CognitoSyncClient::ListIdentityPoolUsage(const List
 
 ListIdentityPoolUsageOutcomeCallable CognitoSyncClient::ListIdentityPoolUsageCallable(const ListIdentityPoolUsageRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::ListIdentityPoolUsage, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::ListIdentityPoolUsage, Aws::Client::RejectedCallOutcome<ListIdentityPoolUsageOutcome>(), this, request);
+}
+
+ListIdentityPoolUsageOutcomeCallable CognitoSyncClient::ListIdentityPoolUsageCallable(ListIdentityPoolUsageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::ListIdentityPoolUsage, Aws::Client::RejectedCallOutcome<ListIdentityPoolUsageOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::ListIdentityPoolUsageAsync(const ListIdentityPoolUsageRequest& request, const ListIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::ListIdentityPoolUsageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::ListIdentityPoolUsageAsyncHelper, Aws::Client::RejectedAsyncCall<ListIdentityPoolUsageOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::ListIdentityPoolUsageAsync(ListIdentityPoolUsageRequest&& request, const ListIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::ListIdentityPoolUsageAsyncHelper, Aws::Client::RejectedAsyncCall<ListIdentityPoolUsageOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::ListIdentityPoolUsageAsyncHelper(const ListIdentityPoolUsageRequest& request, const ListIdentityPoolUsageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -466,12 +566,22 @@ ListRecordsOutcome CognitoSyncClient::ListRecords(const ListRecordsRequest& requ
 
 ListRecordsOutcomeCallable CognitoSyncClient::ListRecordsCallable(const ListRecordsRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::ListRecords, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::ListRecords, Aws::Client::RejectedCallOutcome<ListRecordsOutcome>(), this, request);
+}
+
+ListRecordsOutcomeCallable CognitoSyncClient::ListRecordsCallable(ListRecordsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::ListRecords, Aws::Client::RejectedCallOutcome<ListRecordsOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::ListRecordsAsync(const ListRecordsRequest& request, const ListRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::ListRecordsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::ListRecordsAsyncHelper, Aws::Client::RejectedAsyncCall<ListRecordsOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::ListRecordsAsync(ListRecordsRequest&& request, const ListRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::ListRecordsAsyncHelper, Aws::Client::RejectedAsyncCall<ListRecordsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::ListRecordsAsyncHelper(const ListRecordsRequest& request, const ListRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -501,12 +611,22 @@ RegisterDeviceOutcome CognitoSyncClient::RegisterDevice(const RegisterDeviceRequ
 
 RegisterDeviceOutcomeCallable CognitoSyncClient::RegisterDeviceCallable(const RegisterDeviceRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::RegisterDevice, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::RegisterDevice, Aws::Client::RejectedCallOutcome<RegisterDeviceOutcome>(), this, request);
+}
+
+RegisterDeviceOutcomeCallable CognitoSyncClient::RegisterDeviceCallable(RegisterDeviceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::RegisterDevice, Aws::Client::RejectedCallOutcome<RegisterDeviceOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::RegisterDeviceAsync(const RegisterDeviceRequest& request, const RegisterDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::RegisterDeviceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::RegisterDeviceAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterDeviceOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::RegisterDeviceAsync(RegisterDeviceRequest&& request, const RegisterDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::RegisterDeviceAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterDeviceOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::RegisterDeviceAsyncHelper(const RegisterDeviceRequest& request, const RegisterDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -534,12 +654,22 @@ SetCognitoEventsOutcome CognitoSyncClient::SetCognitoEvents(const SetCognitoEven
 
 SetCognitoEventsOutcomeCallable CognitoSyncClient::SetCognitoEventsCallable(const SetCognitoEventsRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::SetCognitoEvents, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::SetCognitoEvents, Aws::Client::RejectedCallOutcome<SetCognitoEventsOutcome>(), this, request);
+}
+
+SetCognitoEventsOutcomeCallable CognitoSyncClient::SetCognitoEventsCallable(SetCognitoEventsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::SetCognitoEvents, Aws::Client::RejectedCallOutcome<SetCognitoEventsOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::SetCognitoEventsAsync(const SetCognitoEventsRequest& request, const SetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::SetCognitoEventsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::SetCognitoEventsAsyncHelper, Aws::Client::RejectedAsyncCall<SetCognitoEventsOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::SetCognitoEventsAsync(SetCognitoEventsRequest&& request, const SetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::SetCognitoEventsAsyncHelper, Aws::Client::RejectedAsyncCall<SetCognitoEventsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::SetCognitoEventsAsyncHelper(const SetCognitoEventsRequest& request, const SetCognitoEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -567,12 +697,22 @@ SetIdentityPoolConfigurationOutcome CognitoSyncClient::SetIdentityPoolConfigurat
 
 SetIdentityPoolConfigurationOutcomeCallable CognitoSyncClient::SetIdentityPoolConfigurationCallable(const SetIdentityPoolConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::SetIdentityPoolConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::SetIdentityPoolConfiguration, Aws::Client::RejectedCallOutcome<SetIdentityPoolConfigurationOutcome>(), this, request);
+}
+
+SetIdentityPoolConfigurationOutcomeCallable CognitoSyncClient::SetIdentityPoolConfigurationCallable(SetIdentityPoolConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::SetIdentityPoolConfiguration, Aws::Client::RejectedCallOutcome<SetIdentityPoolConfigurationOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::SetIdentityPoolConfigurationAsync(const SetIdentityPoolConfigurationRequest& request, const SetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::SetIdentityPoolConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::SetIdentityPoolConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<SetIdentityPoolConfigurationOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::SetIdentityPoolConfigurationAsync(SetIdentityPoolConfigurationRequest&& request, const SetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::SetIdentityPoolConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<SetIdentityPoolConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::SetIdentityPoolConfigurationAsyncHelper(const SetIdentityPoolConfigurationRequest& request, const SetIdentityPoolConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -605,12 +745,22 @@ SubscribeToDatasetOutcome CognitoSyncClient::SubscribeToDataset(const SubscribeT
 
 SubscribeToDatasetOutcomeCallable CognitoSyncClient::SubscribeToDatasetCallable(const SubscribeToDatasetRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::SubscribeToDataset, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::SubscribeToDataset, Aws::Client::RejectedCallOutcome<SubscribeToDatasetOutcome>(), this, request);
+}
+
+SubscribeToDatasetOutcomeCallable CognitoSyncClient::SubscribeToDatasetCallable(SubscribeToDatasetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::SubscribeToDataset, Aws::Client::RejectedCallOutcome<SubscribeToDatasetOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::SubscribeToDatasetAsync(const SubscribeToDatasetRequest& request, const SubscribeToDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::SubscribeToDatasetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::SubscribeToDatasetAsyncHelper, Aws::Client::RejectedAsyncCall<SubscribeToDatasetOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::SubscribeToDatasetAsync(SubscribeToDatasetRequest&& request, const SubscribeToDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::SubscribeToDatasetAsyncHelper, Aws::Client::RejectedAsyncCall<SubscribeToDatasetOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::SubscribeToDatasetAsyncHelper(const SubscribeToDatasetRequest& request, const SubscribeToDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -643,12 +793,22 @@ UnsubscribeFromDatasetOutcome CognitoSyncClient::UnsubscribeFromDataset(const Un
 
 UnsubscribeFromDatasetOutcomeCallable CognitoSyncClient::UnsubscribeFromDatasetCallable(const UnsubscribeFromDatasetRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::UnsubscribeFromDataset, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::UnsubscribeFromDataset, Aws::Client::RejectedCallOutcome<UnsubscribeFromDatasetOutcome>(), this, request);
+}
+
+UnsubscribeFromDatasetOutcomeCallable CognitoSyncClient::UnsubscribeFromDatasetCallable(UnsubscribeFromDatasetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::UnsubscribeFromDataset, Aws::Client::RejectedCallOutcome<UnsubscribeFromDatasetOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::UnsubscribeFromDatasetAsync(const UnsubscribeFromDatasetRequest& request, const UnsubscribeFromDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::UnsubscribeFromDatasetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::UnsubscribeFromDatasetAsyncHelper, Aws::Client::RejectedAsyncCall<UnsubscribeFromDatasetOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::UnsubscribeFromDatasetAsync(UnsubscribeFromDatasetRequest&& request, const UnsubscribeFromDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::UnsubscribeFromDatasetAsyncHelper, Aws::Client::RejectedAsyncCall<UnsubscribeFromDatasetOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::UnsubscribeFromDatasetAsyncHelper(const UnsubscribeFromDatasetRequest& request, const UnsubscribeFromDatasetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -679,12 +839,22 @@ UpdateRecordsOutcome CognitoSyncClient::UpdateRecords(const UpdateRecordsRequest
 
 UpdateRecordsOutcomeCallable CognitoSyncClient::UpdateRecordsCallable(const UpdateRecordsRequest& request) const
 {
-  return std::async(std::launch::async, &CognitoSyncClient::UpdateRecords, this, request);
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::UpdateRecords, Aws::Client::RejectedCallOutcome<UpdateRecordsOutcome>(), this, request);
+}
+
+UpdateRecordsOutcomeCallable CognitoSyncClient::UpdateRecordsCallable(UpdateRecordsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CognitoSyncClient::UpdateRecords, Aws::Client::RejectedCallOutcome<UpdateRecordsOutcome>(), this, std::move(request));
 }
 
 void CognitoSyncClient::UpdateRecordsAsync(const UpdateRecordsRequest& request, const UpdateRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CognitoSyncClient::UpdateRecordsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CognitoSyncClient::UpdateRecordsAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateRecordsOutcome>(), this, request, handler, context);
+}
+
+void CognitoSyncClient::UpdateRecordsAsync(UpdateRecordsRequest&& request, const UpdateRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CognitoSyncClient::UpdateRecordsAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateRecordsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CognitoSyncClient::UpdateRecordsAsyncHelper(const UpdateRecordsRequest& request, const UpdateRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
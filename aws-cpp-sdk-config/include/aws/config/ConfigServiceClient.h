@@ -39,6 +39,32 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/config/model/DeleteConfigRuleRequest.h>
+#include <aws/config/model/DeleteDeliveryChannelRequest.h>
+#include <aws/config/model/DeliverConfigSnapshotRequest.h>
+#include <aws/config/model/DescribeComplianceByConfigRuleRequest.h>
+#include <aws/config/model/DescribeComplianceByResourceRequest.h>
+#include <aws/config/model/DescribeConfigRuleEvaluationStatusRequest.h>
+#include <aws/config/model/DescribeConfigRulesRequest.h>
+#include <aws/config/model/DescribeConfigurationRecorderStatusRequest.h>
+#include <aws/config/model/DescribeConfigurationRecordersRequest.h>
+#include <aws/config/model/DescribeDeliveryChannelStatusRequest.h>
+#include <aws/config/model/DescribeDeliveryChannelsRequest.h>
+#include <aws/config/model/GetComplianceDetailsByConfigRuleRequest.h>
+#include <aws/config/model/GetComplianceDetailsByResourceRequest.h>
+#include <aws/config/model/GetComplianceSummaryByResourceTypeRequest.h>
+#include <aws/config/model/GetResourceConfigHistoryRequest.h>
+#include <aws/config/model/ListDiscoveredResourcesRequest.h>
+#include <aws/config/model/PutConfigRuleRequest.h>
+#include <aws/config/model/PutConfigurationRecorderRequest.h>
+#include <aws/config/model/PutDeliveryChannelRequest.h>
+#include <aws/config/model/PutEvaluationsRequest.h>
+#include <aws/config/model/StartConfigurationRecorderRequest.h>
+#include <aws/config/model/StopConfigurationRecorderRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -255,6 +281,11 @@ namespace Model
          */
         virtual Model::DeleteConfigRuleOutcomeCallable DeleteConfigRuleCallable(const Model::DeleteConfigRuleRequest& request) const;
 
+        /**
+         * Same as DeleteConfigRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteConfigRuleOutcomeCallable DeleteConfigRuleCallable(Model::DeleteConfigRuleRequest&& request) const;
+
         /**
          * <p>Deletes the specified AWS Config rule and all of its evaluation results.</p>
          * <p>AWS Config sets the state of a rule to <code>DELETING</code> until the
@@ -268,6 +299,11 @@ namespace Model
          */
         virtual void DeleteConfigRuleAsync(const Model::DeleteConfigRuleRequest& request, const DeleteConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteConfigRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteConfigRuleAsync(Model::DeleteConfigRuleRequest&& request, const DeleteConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified delivery channel.</p> <p>The delivery channel cannot be
          * deleted if it is the only delivery channel and the configuration recorder is
@@ -286,6 +322,11 @@ namespace Model
          */
         virtual Model::DeleteDeliveryChannelOutcomeCallable DeleteDeliveryChannelCallable(const Model::DeleteDeliveryChannelRequest& request) const;
 
+        /**
+         * Same as DeleteDeliveryChannelCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDeliveryChannelOutcomeCallable DeleteDeliveryChannelCallable(Model::DeleteDeliveryChannelRequest&& request) const;
+
         /**
          * <p>Deletes the specified delivery channel.</p> <p>The delivery channel cannot be
          * deleted if it is the only delivery channel and the configuration recorder is
@@ -296,6 +337,11 @@ namespace Model
          */
         virtual void DeleteDeliveryChannelAsync(const Model::DeleteDeliveryChannelRequest& request, const DeleteDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDeliveryChannelAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDeliveryChannelAsync(Model::DeleteDeliveryChannelRequest&& request, const DeleteDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Schedules delivery of a configuration snapshot to the Amazon S3 bucket in the
          * specified delivery channel. After the delivery has started, AWS Config sends
@@ -320,6 +366,11 @@ namespace Model
          */
         virtual Model::DeliverConfigSnapshotOutcomeCallable DeliverConfigSnapshotCallable(const Model::DeliverConfigSnapshotRequest& request) const;
 
+        /**
+         * Same as DeliverConfigSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeliverConfigSnapshotOutcomeCallable DeliverConfigSnapshotCallable(Model::DeliverConfigSnapshotRequest&& request) const;
+
         /**
          * <p>Schedules delivery of a configuration snapshot to the Amazon S3 bucket in the
          * specified delivery channel. After the delivery has started, AWS Config sends
@@ -333,6 +384,11 @@ namespace Model
          */
         virtual void DeliverConfigSnapshotAsync(const Model::DeliverConfigSnapshotRequest& request, const DeliverConfigSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeliverConfigSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeliverConfigSnapshotAsync(Model::DeliverConfigSnapshotRequest&& request, const DeliverConfigSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Indicates whether the specified AWS Config rules are compliant. If a rule is
          * noncompliant, this action returns the number of AWS resources that do not comply
@@ -379,6 +435,11 @@ namespace Model
          */
         virtual Model::DescribeComplianceByConfigRuleOutcomeCallable DescribeComplianceByConfigRuleCallable(const Model::DescribeComplianceByConfigRuleRequest& request) const;
 
+        /**
+         * Same as DescribeComplianceByConfigRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeComplianceByConfigRuleOutcomeCallable DescribeComplianceByConfigRuleCallable(Model::DescribeComplianceByConfigRuleRequest&& request) const;
+
         /**
          * <p>Indicates whether the specified AWS Config rules are compliant. If a rule is
          * noncompliant, this action returns the number of AWS resources that do not comply
@@ -403,6 +464,11 @@ namespace Model
          */
         virtual void DescribeComplianceByConfigRuleAsync(const Model::DescribeComplianceByConfigRuleRequest& request, const DescribeComplianceByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeComplianceByConfigRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeComplianceByConfigRuleAsync(Model::DescribeComplianceByConfigRuleRequest&& request, const DescribeComplianceByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Indicates whether the specified AWS resources are compliant. If a resource is
          * noncompliant, this action returns the number of AWS Config rules that the
@@ -453,6 +519,11 @@ namespace Model
          */
         virtual Model::DescribeComplianceByResourceOutcomeCallable DescribeComplianceByResourceCallable(const Model::DescribeComplianceByResourceRequest& request) const;
 
+        /**
+         * Same as DescribeComplianceByResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeComplianceByResourceOutcomeCallable DescribeComplianceByResourceCallable(Model::DescribeComplianceByResourceRequest&& request) const;
+
         /**
          * <p>Indicates whether the specified AWS resources are compliant. If a resource is
          * noncompliant, this action returns the number of AWS Config rules that the
@@ -479,6 +550,11 @@ namespace Model
          */
         virtual void DescribeComplianceByResourceAsync(const Model::DescribeComplianceByResourceRequest& request, const DescribeComplianceByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeComplianceByResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeComplianceByResourceAsync(Model::DescribeComplianceByResourceRequest&& request, const DescribeComplianceByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns status information for each of your AWS managed Config rules. The
          * status includes information such as the last time AWS Config invoked the rule,
@@ -497,6 +573,11 @@ namespace Model
          */
         virtual Model::DescribeConfigRuleEvaluationStatusOutcomeCallable DescribeConfigRuleEvaluationStatusCallable(const Model::DescribeConfigRuleEvaluationStatusRequest& request) const;
 
+        /**
+         * Same as DescribeConfigRuleEvaluationStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeConfigRuleEvaluationStatusOutcomeCallable DescribeConfigRuleEvaluationStatusCallable(Model::DescribeConfigRuleEvaluationStatusRequest&& request) const;
+
         /**
          * <p>Returns status information for each of your AWS managed Config rules. The
          * status includes information such as the last time AWS Config invoked the rule,
@@ -507,6 +588,11 @@ namespace Model
          */
         virtual void DescribeConfigRuleEvaluationStatusAsync(const Model::DescribeConfigRuleEvaluationStatusRequest& request, const DescribeConfigRuleEvaluationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConfigRuleEvaluationStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeConfigRuleEvaluationStatusAsync(Model::DescribeConfigRuleEvaluationStatusRequest&& request, const DescribeConfigRuleEvaluationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns details about your AWS Config rules.</p>
          */
@@ -519,6 +605,11 @@ namespace Model
          */
         virtual Model::DescribeConfigRulesOutcomeCallable DescribeConfigRulesCallable(const Model::DescribeConfigRulesRequest& request) const;
 
+        /**
+         * Same as DescribeConfigRulesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeConfigRulesOutcomeCallable DescribeConfigRulesCallable(Model::DescribeConfigRulesRequest&& request) const;
+
         /**
          * <p>Returns details about your AWS Config rules.</p>
          *
@@ -526,6 +617,11 @@ namespace Model
          */
         virtual void DescribeConfigRulesAsync(const Model::DescribeConfigRulesRequest& request, const DescribeConfigRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConfigRulesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeConfigRulesAsync(Model::DescribeConfigRulesRequest&& request, const DescribeConfigRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the current status of the specified configuration recorder. If a
          * configuration recorder is not specified, this action returns the status of all
@@ -544,6 +640,11 @@ namespace Model
          */
         virtual Model::DescribeConfigurationRecorderStatusOutcomeCallable DescribeConfigurationRecorderStatusCallable(const Model::DescribeConfigurationRecorderStatusRequest& request) const;
 
+        /**
+         * Same as DescribeConfigurationRecorderStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeConfigurationRecorderStatusOutcomeCallable DescribeConfigurationRecorderStatusCallable(Model::DescribeConfigurationRecorderStatusRequest&& request) const;
+
         /**
          * <p>Returns the current status of the specified configuration recorder. If a
          * configuration recorder is not specified, this action returns the status of all
@@ -554,6 +655,11 @@ namespace Model
          */
         virtual void DescribeConfigurationRecorderStatusAsync(const Model::DescribeConfigurationRecorderStatusRequest& request, const DescribeConfigurationRecorderStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConfigurationRecorderStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeConfigurationRecorderStatusAsync(Model::DescribeConfigurationRecorderStatusRequest&& request, const DescribeConfigurationRecorderStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the name of one or more specified configuration recorders. If the
          * recorder name is not specified, this action returns the names of all the
@@ -572,6 +678,11 @@ namespace Model
          */
         virtual Model::DescribeConfigurationRecordersOutcomeCallable DescribeConfigurationRecordersCallable(const Model::DescribeConfigurationRecordersRequest& request) const;
 
+        /**
+         * Same as DescribeConfigurationRecordersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeConfigurationRecordersOutcomeCallable DescribeConfigurationRecordersCallable(Model::DescribeConfigurationRecordersRequest&& request) const;
+
         /**
          * <p>Returns the name of one or more specified configuration recorders. If the
          * recorder name is not specified, this action returns the names of all the
@@ -582,6 +693,11 @@ namespace Model
          */
         virtual void DescribeConfigurationRecordersAsync(const Model::DescribeConfigurationRecordersRequest& request, const DescribeConfigurationRecordersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConfigurationRecordersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeConfigurationRecordersAsync(Model::DescribeConfigurationRecordersRequest&& request, const DescribeConfigurationRecordersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the current status of the specified delivery channel. If a delivery
          * channel is not specified, this action returns the current status of all delivery
@@ -600,6 +716,11 @@ namespace Model
          */
         virtual Model::DescribeDeliveryChannelStatusOutcomeCallable DescribeDeliveryChannelStatusCallable(const Model::DescribeDeliveryChannelStatusRequest& request) const;
 
+        /**
+         * Same as DescribeDeliveryChannelStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDeliveryChannelStatusOutcomeCallable DescribeDeliveryChannelStatusCallable(Model::DescribeDeliveryChannelStatusRequest&& request) const;
+
         /**
          * <p>Returns the current status of the specified delivery channel. If a delivery
          * channel is not specified, this action returns the current status of all delivery
@@ -610,6 +731,11 @@ namespace Model
          */
         virtual void DescribeDeliveryChannelStatusAsync(const Model::DescribeDeliveryChannelStatusRequest& request, const DescribeDeliveryChannelStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDeliveryChannelStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDeliveryChannelStatusAsync(Model::DescribeDeliveryChannelStatusRequest&& request, const DescribeDeliveryChannelStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns details about the specified delivery channel. If a delivery channel
          * is not specified, this action returns the details of all delivery channels
@@ -628,6 +754,11 @@ namespace Model
          */
         virtual Model::DescribeDeliveryChannelsOutcomeCallable DescribeDeliveryChannelsCallable(const Model::DescribeDeliveryChannelsRequest& request) const;
 
+        /**
+         * Same as DescribeDeliveryChannelsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDeliveryChannelsOutcomeCallable DescribeDeliveryChannelsCallable(Model::DescribeDeliveryChannelsRequest&& request) const;
+
         /**
          * <p>Returns details about the specified delivery channel. If a delivery channel
          * is not specified, this action returns the details of all delivery channels
@@ -638,6 +769,11 @@ namespace Model
          */
         virtual void DescribeDeliveryChannelsAsync(const Model::DescribeDeliveryChannelsRequest& request, const DescribeDeliveryChannelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDeliveryChannelsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDeliveryChannelsAsync(Model::DescribeDeliveryChannelsRequest&& request, const DescribeDeliveryChannelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the evaluation results for the specified AWS Config rule. The results
          * indicate which AWS resources were evaluated by the rule, when each resource was
@@ -654,6 +790,11 @@ namespace Model
          */
         virtual Model::GetComplianceDetailsByConfigRuleOutcomeCallable GetComplianceDetailsByConfigRuleCallable(const Model::GetComplianceDetailsByConfigRuleRequest& request) const;
 
+        /**
+         * Same as GetComplianceDetailsByConfigRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetComplianceDetailsByConfigRuleOutcomeCallable GetComplianceDetailsByConfigRuleCallable(Model::GetComplianceDetailsByConfigRuleRequest&& request) const;
+
         /**
          * <p>Returns the evaluation results for the specified AWS Config rule. The results
          * indicate which AWS resources were evaluated by the rule, when each resource was
@@ -663,6 +804,11 @@ namespace Model
          */
         virtual void GetComplianceDetailsByConfigRuleAsync(const Model::GetComplianceDetailsByConfigRuleRequest& request, const GetComplianceDetailsByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetComplianceDetailsByConfigRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetComplianceDetailsByConfigRuleAsync(Model::GetComplianceDetailsByConfigRuleRequest&& request, const GetComplianceDetailsByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the evaluation results for the specified AWS resource. The results
          * indicate which AWS Config rules were used to evaluate the resource, when each
@@ -679,6 +825,11 @@ namespace Model
          */
         virtual Model::GetComplianceDetailsByResourceOutcomeCallable GetComplianceDetailsByResourceCallable(const Model::GetComplianceDetailsByResourceRequest& request) const;
 
+        /**
+         * Same as GetComplianceDetailsByResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetComplianceDetailsByResourceOutcomeCallable GetComplianceDetailsByResourceCallable(Model::GetComplianceDetailsByResourceRequest&& request) const;
+
         /**
          * <p>Returns the evaluation results for the specified AWS resource. The results
          * indicate which AWS Config rules were used to evaluate the resource, when each
@@ -688,6 +839,11 @@ namespace Model
          */
         virtual void GetComplianceDetailsByResourceAsync(const Model::GetComplianceDetailsByResourceRequest& request, const GetComplianceDetailsByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetComplianceDetailsByResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetComplianceDetailsByResourceAsync(Model::GetComplianceDetailsByResourceRequest&& request, const GetComplianceDetailsByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the number of AWS Config rules that are compliant and noncompliant,
          * up to a maximum of 25 for each.</p>
@@ -725,6 +881,11 @@ namespace Model
          */
         virtual Model::GetComplianceSummaryByResourceTypeOutcomeCallable GetComplianceSummaryByResourceTypeCallable(const Model::GetComplianceSummaryByResourceTypeRequest& request) const;
 
+        /**
+         * Same as GetComplianceSummaryByResourceTypeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetComplianceSummaryByResourceTypeOutcomeCallable GetComplianceSummaryByResourceTypeCallable(Model::GetComplianceSummaryByResourceTypeRequest&& request) const;
+
         /**
          * <p>Returns the number of resources that are compliant and the number that are
          * noncompliant. You can specify one or more resource types to get these numbers
@@ -734,6 +895,11 @@ namespace Model
          */
         virtual void GetComplianceSummaryByResourceTypeAsync(const Model::GetComplianceSummaryByResourceTypeRequest& request, const GetComplianceSummaryByResourceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetComplianceSummaryByResourceTypeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetComplianceSummaryByResourceTypeAsync(Model::GetComplianceSummaryByResourceTypeRequest&& request, const GetComplianceSummaryByResourceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of configuration items for the specified resource. The list
          * contains details about each state of the resource during the specified time
@@ -766,6 +932,11 @@ namespace Model
          */
         virtual Model::GetResourceConfigHistoryOutcomeCallable GetResourceConfigHistoryCallable(const Model::GetResourceConfigHistoryRequest& request) const;
 
+        /**
+         * Same as GetResourceConfigHistoryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetResourceConfigHistoryOutcomeCallable GetResourceConfigHistoryCallable(Model::GetResourceConfigHistoryRequest&& request) const;
+
         /**
          * <p>Returns a list of configuration items for the specified resource. The list
          * contains details about each state of the resource during the specified time
@@ -783,6 +954,11 @@ namespace Model
          */
         virtual void GetResourceConfigHistoryAsync(const Model::GetResourceConfigHistoryRequest& request, const GetResourceConfigHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetResourceConfigHistoryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetResourceConfigHistoryAsync(Model::GetResourceConfigHistoryRequest&& request, const GetResourceConfigHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Accepts a resource type and returns a list of resource identifiers for the
          * resources of that type. A resource identifier includes the resource type, ID,
@@ -817,6 +993,11 @@ namespace Model
          */
         virtual Model::ListDiscoveredResourcesOutcomeCallable ListDiscoveredResourcesCallable(const Model::ListDiscoveredResourcesRequest& request) const;
 
+        /**
+         * Same as ListDiscoveredResourcesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDiscoveredResourcesOutcomeCallable ListDiscoveredResourcesCallable(Model::ListDiscoveredResourcesRequest&& request) const;
+
         /**
          * <p>Accepts a resource type and returns a list of resource identifiers for the
          * resources of that type. A resource identifier includes the resource type, ID,
@@ -835,6 +1016,11 @@ namespace Model
          */
         virtual void ListDiscoveredResourcesAsync(const Model::ListDiscoveredResourcesRequest& request, const ListDiscoveredResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDiscoveredResourcesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDiscoveredResourcesAsync(Model::ListDiscoveredResourcesRequest&& request, const ListDiscoveredResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds or updates an AWS Config rule for evaluating whether your AWS resources
          * comply with your desired configurations. </p> <p>You can use this action for
@@ -901,6 +1087,11 @@ namespace Model
          */
         virtual Model::PutConfigRuleOutcomeCallable PutConfigRuleCallable(const Model::PutConfigRuleRequest& request) const;
 
+        /**
+         * Same as PutConfigRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutConfigRuleOutcomeCallable PutConfigRuleCallable(Model::PutConfigRuleRequest&& request) const;
+
         /**
          * <p>Adds or updates an AWS Config rule for evaluating whether your AWS resources
          * comply with your desired configurations. </p> <p>You can use this action for
@@ -935,6 +1126,11 @@ namespace Model
          */
         virtual void PutConfigRuleAsync(const Model::PutConfigRuleRequest& request, const PutConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutConfigRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutConfigRuleAsync(Model::PutConfigRuleRequest&& request, const PutConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new configuration recorder to record the selected resource
          * configurations.</p> <p>You can use this action to change the role
@@ -961,6 +1157,11 @@ namespace Model
          */
         virtual Model::PutConfigurationRecorderOutcomeCallable PutConfigurationRecorderCallable(const Model::PutConfigurationRecorderRequest& request) const;
 
+        /**
+         * Same as PutConfigurationRecorderCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutConfigurationRecorderOutcomeCallable PutConfigurationRecorderCallable(Model::PutConfigurationRecorderRequest&& request) const;
+
         /**
          * <p>Creates a new configuration recorder to record the selected resource
          * configurations.</p> <p>You can use this action to change the role
@@ -975,6 +1176,11 @@ namespace Model
          */
         virtual void PutConfigurationRecorderAsync(const Model::PutConfigurationRecorderRequest& request, const PutConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutConfigurationRecorderAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutConfigurationRecorderAsync(Model::PutConfigurationRecorderRequest&& request, const PutConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new delivery channel object to deliver the configuration
          * information to an Amazon S3 bucket, and to an Amazon SNS topic. </p> <p>You can
@@ -1003,6 +1209,11 @@ namespace Model
          */
         virtual Model::PutDeliveryChannelOutcomeCallable PutDeliveryChannelCallable(const Model::PutDeliveryChannelRequest& request) const;
 
+        /**
+         * Same as PutDeliveryChannelCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutDeliveryChannelOutcomeCallable PutDeliveryChannelCallable(Model::PutDeliveryChannelRequest&& request) const;
+
         /**
          * <p>Creates a new delivery channel object to deliver the configuration
          * information to an Amazon S3 bucket, and to an Amazon SNS topic. </p> <p>You can
@@ -1018,6 +1229,11 @@ namespace Model
          */
         virtual void PutDeliveryChannelAsync(const Model::PutDeliveryChannelRequest& request, const PutDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutDeliveryChannelAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutDeliveryChannelAsync(Model::PutDeliveryChannelRequest&& request, const PutDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by an AWS Lambda function to deliver evaluation results to AWS Config.
          * This action is required in every AWS Lambda function that is invoked by an AWS
@@ -1034,6 +1250,11 @@ namespace Model
          */
         virtual Model::PutEvaluationsOutcomeCallable PutEvaluationsCallable(const Model::PutEvaluationsRequest& request) const;
 
+        /**
+         * Same as PutEvaluationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutEvaluationsOutcomeCallable PutEvaluationsCallable(Model::PutEvaluationsRequest&& request) const;
+
         /**
          * <p>Used by an AWS Lambda function to deliver evaluation results to AWS Config.
          * This action is required in every AWS Lambda function that is invoked by an AWS
@@ -1043,6 +1264,11 @@ namespace Model
          */
         virtual void PutEvaluationsAsync(const Model::PutEvaluationsRequest& request, const PutEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutEvaluationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutEvaluationsAsync(Model::PutEvaluationsRequest&& request, const PutEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts recording configurations of the AWS resources you have selected to
          * record in your AWS account.</p> <p>You must have created at least one delivery
@@ -1059,6 +1285,11 @@ namespace Model
          */
         virtual Model::StartConfigurationRecorderOutcomeCallable StartConfigurationRecorderCallable(const Model::StartConfigurationRecorderRequest& request) const;
 
+        /**
+         * Same as StartConfigurationRecorderCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StartConfigurationRecorderOutcomeCallable StartConfigurationRecorderCallable(Model::StartConfigurationRecorderRequest&& request) const;
+
         /**
          * <p>Starts recording configurations of the AWS resources you have selected to
          * record in your AWS account.</p> <p>You must have created at least one delivery
@@ -1068,6 +1299,11 @@ namespace Model
          */
         virtual void StartConfigurationRecorderAsync(const Model::StartConfigurationRecorderRequest& request, const StartConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartConfigurationRecorderAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StartConfigurationRecorderAsync(Model::StartConfigurationRecorderRequest&& request, const StartConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stops recording configurations of the AWS resources you have selected to
          * record in your AWS account.</p>
@@ -1082,6 +1318,11 @@ namespace Model
          */
         virtual Model::StopConfigurationRecorderOutcomeCallable StopConfigurationRecorderCallable(const Model::StopConfigurationRecorderRequest& request) const;
 
+        /**
+         * Same as StopConfigurationRecorderCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StopConfigurationRecorderOutcomeCallable StopConfigurationRecorderCallable(Model::StopConfigurationRecorderRequest&& request) const;
+
         /**
          * <p>Stops recording configurations of the AWS resources you have selected to
          * record in your AWS account.</p>
@@ -1090,6 +1331,63 @@ namespace Model
          */
         virtual void StopConfigurationRecorderAsync(const Model::StopConfigurationRecorderRequest& request, const StopConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopConfigurationRecorderAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StopConfigurationRecorderAsync(Model::StopConfigurationRecorderRequest&& request, const StopConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteConfigRuleOutcome> DeleteConfigRuleAwaitable(const Model::DeleteConfigRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DeleteConfigRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteConfigRuleOutcome> DeleteConfigRuleAwaitable(Model::DeleteConfigRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DeleteConfigRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDeliveryChannelOutcome> DeleteDeliveryChannelAwaitable(const Model::DeleteDeliveryChannelRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DeleteDeliveryChannel, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDeliveryChannelOutcome> DeleteDeliveryChannelAwaitable(Model::DeleteDeliveryChannelRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DeleteDeliveryChannel, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeliverConfigSnapshotOutcome> DeliverConfigSnapshotAwaitable(const Model::DeliverConfigSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DeliverConfigSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeliverConfigSnapshotOutcome> DeliverConfigSnapshotAwaitable(Model::DeliverConfigSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DeliverConfigSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeComplianceByConfigRuleOutcome> DescribeComplianceByConfigRuleAwaitable(const Model::DescribeComplianceByConfigRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeComplianceByConfigRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeComplianceByConfigRuleOutcome> DescribeComplianceByConfigRuleAwaitable(Model::DescribeComplianceByConfigRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeComplianceByConfigRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeComplianceByResourceOutcome> DescribeComplianceByResourceAwaitable(const Model::DescribeComplianceByResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeComplianceByResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeComplianceByResourceOutcome> DescribeComplianceByResourceAwaitable(Model::DescribeComplianceByResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeComplianceByResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConfigRuleEvaluationStatusOutcome> DescribeConfigRuleEvaluationStatusAwaitable(const Model::DescribeConfigRuleEvaluationStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeConfigRuleEvaluationStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConfigRuleEvaluationStatusOutcome> DescribeConfigRuleEvaluationStatusAwaitable(Model::DescribeConfigRuleEvaluationStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeConfigRuleEvaluationStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConfigRulesOutcome> DescribeConfigRulesAwaitable(const Model::DescribeConfigRulesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeConfigRules, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConfigRulesOutcome> DescribeConfigRulesAwaitable(Model::DescribeConfigRulesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeConfigRules, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConfigurationRecorderStatusOutcome> DescribeConfigurationRecorderStatusAwaitable(const Model::DescribeConfigurationRecorderStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeConfigurationRecorderStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConfigurationRecorderStatusOutcome> DescribeConfigurationRecorderStatusAwaitable(Model::DescribeConfigurationRecorderStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeConfigurationRecorderStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConfigurationRecordersOutcome> DescribeConfigurationRecordersAwaitable(const Model::DescribeConfigurationRecordersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeConfigurationRecorders, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConfigurationRecordersOutcome> DescribeConfigurationRecordersAwaitable(Model::DescribeConfigurationRecordersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeConfigurationRecorders, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDeliveryChannelStatusOutcome> DescribeDeliveryChannelStatusAwaitable(const Model::DescribeDeliveryChannelStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeDeliveryChannelStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDeliveryChannelStatusOutcome> DescribeDeliveryChannelStatusAwaitable(Model::DescribeDeliveryChannelStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeDeliveryChannelStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDeliveryChannelsOutcome> DescribeDeliveryChannelsAwaitable(const Model::DescribeDeliveryChannelsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeDeliveryChannels, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDeliveryChannelsOutcome> DescribeDeliveryChannelsAwaitable(Model::DescribeDeliveryChannelsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::DescribeDeliveryChannels, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetComplianceDetailsByConfigRuleOutcome> GetComplianceDetailsByConfigRuleAwaitable(const Model::GetComplianceDetailsByConfigRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::GetComplianceDetailsByConfigRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetComplianceDetailsByConfigRuleOutcome> GetComplianceDetailsByConfigRuleAwaitable(Model::GetComplianceDetailsByConfigRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::GetComplianceDetailsByConfigRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetComplianceDetailsByResourceOutcome> GetComplianceDetailsByResourceAwaitable(const Model::GetComplianceDetailsByResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::GetComplianceDetailsByResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetComplianceDetailsByResourceOutcome> GetComplianceDetailsByResourceAwaitable(Model::GetComplianceDetailsByResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::GetComplianceDetailsByResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetComplianceSummaryByConfigRuleOutcome> GetComplianceSummaryByConfigRuleAwaitable() const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::GetComplianceSummaryByConfigRule, this); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetComplianceSummaryByResourceTypeOutcome> GetComplianceSummaryByResourceTypeAwaitable(const Model::GetComplianceSummaryByResourceTypeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::GetComplianceSummaryByResourceType, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetComplianceSummaryByResourceTypeOutcome> GetComplianceSummaryByResourceTypeAwaitable(Model::GetComplianceSummaryByResourceTypeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::GetComplianceSummaryByResourceType, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetResourceConfigHistoryOutcome> GetResourceConfigHistoryAwaitable(const Model::GetResourceConfigHistoryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::GetResourceConfigHistory, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetResourceConfigHistoryOutcome> GetResourceConfigHistoryAwaitable(Model::GetResourceConfigHistoryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::GetResourceConfigHistory, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDiscoveredResourcesOutcome> ListDiscoveredResourcesAwaitable(const Model::ListDiscoveredResourcesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::ListDiscoveredResources, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDiscoveredResourcesOutcome> ListDiscoveredResourcesAwaitable(Model::ListDiscoveredResourcesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::ListDiscoveredResources, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutConfigRuleOutcome> PutConfigRuleAwaitable(const Model::PutConfigRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::PutConfigRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutConfigRuleOutcome> PutConfigRuleAwaitable(Model::PutConfigRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::PutConfigRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutConfigurationRecorderOutcome> PutConfigurationRecorderAwaitable(const Model::PutConfigurationRecorderRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::PutConfigurationRecorder, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutConfigurationRecorderOutcome> PutConfigurationRecorderAwaitable(Model::PutConfigurationRecorderRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::PutConfigurationRecorder, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutDeliveryChannelOutcome> PutDeliveryChannelAwaitable(const Model::PutDeliveryChannelRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::PutDeliveryChannel, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutDeliveryChannelOutcome> PutDeliveryChannelAwaitable(Model::PutDeliveryChannelRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::PutDeliveryChannel, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutEvaluationsOutcome> PutEvaluationsAwaitable(const Model::PutEvaluationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::PutEvaluations, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutEvaluationsOutcome> PutEvaluationsAwaitable(Model::PutEvaluationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::PutEvaluations, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartConfigurationRecorderOutcome> StartConfigurationRecorderAwaitable(const Model::StartConfigurationRecorderRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::StartConfigurationRecorder, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartConfigurationRecorderOutcome> StartConfigurationRecorderAwaitable(Model::StartConfigurationRecorderRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::StartConfigurationRecorder, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopConfigurationRecorderOutcome> StopConfigurationRecorderAwaitable(const Model::StopConfigurationRecorderRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::StopConfigurationRecorder, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopConfigurationRecorderOutcome> StopConfigurationRecorderAwaitable(Model::StopConfigurationRecorderRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ConfigServiceClient::StopConfigurationRecorder, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -129,12 +129,22 @@ DeleteConfigRuleOutcome ConfigServiceClient::DeleteConfigRule(const DeleteConfig
 
 DeleteConfigRuleOutcomeCallable ConfigServiceClient::DeleteConfigRuleCallable(const DeleteConfigRuleRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::DeleteConfigRule, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DeleteConfigRule, Aws::Client::RejectedCallOutcome<DeleteConfigRuleOutcome>(), this, request);
+}
+
+DeleteConfigRuleOutcomeCallable ConfigServiceClient::DeleteConfigRuleCallable(DeleteConfigRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DeleteConfigRule, Aws::Client::RejectedCallOutcome<DeleteConfigRuleOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::DeleteConfigRuleAsync(const DeleteConfigRuleRequest& request, const DeleteConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::DeleteConfigRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::DeleteConfigRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteConfigRuleOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::DeleteConfigRuleAsync(DeleteConfigRuleRequest&& request, const DeleteConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::DeleteConfigRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteConfigRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::DeleteConfigRuleAsyncHelper(const DeleteConfigRuleRequest& request, const DeleteConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -160,12 +170,22 @@ DeleteDeliveryChannelOutcome ConfigServiceClient::DeleteDeliveryChannel(const De
 
 DeleteDeliveryChannelOutcomeCallable ConfigServiceClient::DeleteDeliveryChannelCallable(const DeleteDeliveryChannelRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::DeleteDeliveryChannel, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DeleteDeliveryChannel, Aws::Client::RejectedCallOutcome<DeleteDeliveryChannelOutcome>(), this, request);
+}
+
+DeleteDeliveryChannelOutcomeCallable ConfigServiceClient::DeleteDeliveryChannelCallable(DeleteDeliveryChannelRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DeleteDeliveryChannel, Aws::Client::RejectedCallOutcome<DeleteDeliveryChannelOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::DeleteDeliveryChannelAsync(const DeleteDeliveryChannelRequest& request, const DeleteDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::DeleteDeliveryChannelAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::DeleteDeliveryChannelAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDeliveryChannelOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::DeleteDeliveryChannelAsync(DeleteDeliveryChannelRequest&& request, const DeleteDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::DeleteDeliveryChannelAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDeliveryChannelOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::DeleteDeliveryChannelAsyncHelper(const DeleteDeliveryChannelRequest& request, const DeleteDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -191,12 +211,22 @@ DeliverConfigSnapshotOutcome ConfigServiceClient::DeliverConfigSnapshot(const De
 
 DeliverConfigSnapshotOutcomeCallable ConfigServiceClient::DeliverConfigSnapshotCallable(const DeliverConfigSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::DeliverConfigSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DeliverConfigSnapshot, Aws::Client::RejectedCallOutcome<DeliverConfigSnapshotOutcome>(), this, request);
+}
+
+DeliverConfigSnapshotOutcomeCallable ConfigServiceClient::DeliverConfigSnapshotCallable(DeliverConfigSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DeliverConfigSnapshot, Aws::Client::RejectedCallOutcome<DeliverConfigSnapshotOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::DeliverConfigSnapshotAsync(const DeliverConfigSnapshotRequest& request, const DeliverConfigSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::DeliverConfigSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::DeliverConfigSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<DeliverConfigSnapshotOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::DeliverConfigSnapshotAsync(DeliverConfigSnapshotRequest&& request, const DeliverConfigSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::DeliverConfigSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<DeliverConfigSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::DeliverConfigSnapshotAsyncHelper(const DeliverConfigSnapshotRequest& request, const DeliverConfigSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -222,12 +252,22 @@ DescribeComplianceByConfigRuleOutcome ConfigServiceClient::DescribeComplianceByC
 
 DescribeComplianceByConfigRuleOutcomeCallable ConfigServiceClient::DescribeComplianceByConfigRuleCallable(const DescribeComplianceByConfigRuleRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::DescribeComplianceByConfigRule, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeComplianceByConfigRule, Aws::Client::RejectedCallOutcome<DescribeComplianceByConfigRuleOutcome>(), this, request);
+}
+
+DescribeComplianceByConfigRuleOutcomeCallable ConfigServiceClient::DescribeComplianceByConfigRuleCallable(DescribeComplianceByConfigRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeComplianceByConfigRule, Aws::Client::RejectedCallOutcome<DescribeComplianceByConfigRuleOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::DescribeComplianceByConfigRuleAsync(const DescribeComplianceByConfigRuleRequest& request, const DescribeComplianceByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::DescribeComplianceByConfigRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeComplianceByConfigRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeComplianceByConfigRuleOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::DescribeComplianceByConfigRuleAsync(DescribeComplianceByConfigRuleRequest&& request, const DescribeComplianceByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeComplianceByConfigRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeComplianceByConfigRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::DescribeComplianceByConfigRuleAsyncHelper(const DescribeComplianceByConfigRuleRequest& request, const DescribeComplianceByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -253,12 +293,22 @@ DescribeComplianceByResourceOutcome ConfigServiceClient::DescribeComplianceByRes
 
 DescribeComplianceByResourceOutcomeCallable ConfigServiceClient::DescribeComplianceByResourceCallable(const DescribeComplianceByResourceRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::DescribeComplianceByResource, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeComplianceByResource, Aws::Client::RejectedCallOutcome<DescribeComplianceByResourceOutcome>(), this, request);
+}
+
+DescribeComplianceByResourceOutcomeCallable ConfigServiceClient::DescribeComplianceByResourceCallable(DescribeComplianceByResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeComplianceByResource, Aws::Client::RejectedCallOutcome<DescribeComplianceByResourceOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::DescribeComplianceByResourceAsync(const DescribeComplianceByResourceRequest& request, const DescribeComplianceByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::DescribeComplianceByResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeComplianceByResourceAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeComplianceByResourceOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::DescribeComplianceByResourceAsync(DescribeComplianceByResourceRequest&& request, const DescribeComplianceByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeComplianceByResourceAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeComplianceByResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::DescribeComplianceByResourceAsyncHelper(const DescribeComplianceByResourceRequest& request, const DescribeComplianceByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -284,12 +334,22 @@ DescribeConfigRuleEvaluationStatusOutcome ConfigServiceClient::DescribeConfigRul
 
 DescribeConfigRuleEvaluationStatusOutcomeCallable ConfigServiceClient::DescribeConfigRuleEvaluationStatusCallable(const DescribeConfigRuleEvaluationStatusRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::DescribeConfigRuleEvaluationStatus, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeConfigRuleEvaluationStatus, Aws::Client::RejectedCallOutcome<DescribeConfigRuleEvaluationStatusOutcome>(), this, request);
+}
+
+DescribeConfigRuleEvaluationStatusOutcomeCallable ConfigServiceClient::DescribeConfigRuleEvaluationStatusCallable(DescribeConfigRuleEvaluationStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeConfigRuleEvaluationStatus, Aws::Client::RejectedCallOutcome<DescribeConfigRuleEvaluationStatusOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::DescribeConfigRuleEvaluationStatusAsync(const DescribeConfigRuleEvaluationStatusRequest& request, const DescribeConfigRuleEvaluationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::DescribeConfigRuleEvaluationStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeConfigRuleEvaluationStatusAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConfigRuleEvaluationStatusOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::DescribeConfigRuleEvaluationStatusAsync(DescribeConfigRuleEvaluationStatusRequest&& request, const DescribeConfigRuleEvaluationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeConfigRuleEvaluationStatusAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConfigRuleEvaluationStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::DescribeConfigRuleEvaluationStatusAsyncHelper(const DescribeConfigRuleEvaluationStatusRequest& request, const DescribeConfigRuleEvaluationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -315,12 +375,22 @@ DescribeConfigRulesOutcome ConfigServiceClient::DescribeConfigRules(const Descri
 
 DescribeConfigRulesOutcomeCallable ConfigServiceClient::DescribeConfigRulesCallable(const DescribeConfigRulesRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::DescribeConfigRules, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeConfigRules, Aws::Client::RejectedCallOutcome<DescribeConfigRulesOutcome>(), this, request);
+}
+
+DescribeConfigRulesOutcomeCallable ConfigServiceClient::DescribeConfigRulesCallable(DescribeConfigRulesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeConfigRules, Aws::Client::RejectedCallOutcome<DescribeConfigRulesOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::DescribeConfigRulesAsync(const DescribeConfigRulesRequest& request, const DescribeConfigRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::DescribeConfigRulesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeConfigRulesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConfigRulesOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::DescribeConfigRulesAsync(DescribeConfigRulesRequest&& request, const DescribeConfigRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeConfigRulesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConfigRulesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::DescribeConfigRulesAsyncHelper(const DescribeConfigRulesRequest& request, const DescribeConfigRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -346,12 +416,22 @@ DescribeConfigurationRecorderStatusOutcome ConfigServiceClient::DescribeConfigur
 
 DescribeConfigurationRecorderStatusOutcomeCallable ConfigServiceClient::DescribeConfigurationRecorderStatusCallable(const DescribeConfigurationRecorderStatusRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::DescribeConfigurationRecorderStatus, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeConfigurationRecorderStatus, Aws::Client::RejectedCallOutcome<DescribeConfigurationRecorderStatusOutcome>(), this, request);
+}
+
+DescribeConfigurationRecorderStatusOutcomeCallable ConfigServiceClient::DescribeConfigurationRecorderStatusCallable(DescribeConfigurationRecorderStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeConfigurationRecorderStatus, Aws::Client::RejectedCallOutcome<DescribeConfigurationRecorderStatusOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::DescribeConfigurationRecorderStatusAsync(const DescribeConfigurationRecorderStatusRequest& request, const DescribeConfigurationRecorderStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::DescribeConfigurationRecorderStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeConfigurationRecorderStatusAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConfigurationRecorderStatusOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::DescribeConfigurationRecorderStatusAsync(DescribeConfigurationRecorderStatusRequest&& request, const DescribeConfigurationRecorderStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeConfigurationRecorderStatusAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConfigurationRecorderStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::DescribeConfigurationRecorderStatusAsyncHelper(const DescribeConfigurationRecorderStatusRequest& request, const DescribeConfigurationRecorderStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -377,12 +457,22 @@ DescribeConfigurationRecordersOutcome ConfigServiceClient::DescribeConfiguration
 
 DescribeConfigurationRecordersOutcomeCallable ConfigServiceClient::DescribeConfigurationRecordersCallable(const DescribeConfigurationRecordersRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::DescribeConfigurationRecorders, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeConfigurationRecorders, Aws::Client::RejectedCallOutcome<DescribeConfigurationRecordersOutcome>(), this, request);
+}
+
+DescribeConfigurationRecordersOutcomeCallable ConfigServiceClient::DescribeConfigurationRecordersCallable(DescribeConfigurationRecordersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeConfigurationRecorders, Aws::Client::RejectedCallOutcome<DescribeConfigurationRecordersOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::DescribeConfigurationRecordersAsync(const DescribeConfigurationRecordersRequest& request, const DescribeConfigurationRecordersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::DescribeConfigurationRecordersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeConfigurationRecordersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConfigurationRecordersOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::DescribeConfigurationRecordersAsync(DescribeConfigurationRecordersRequest&& request, const DescribeConfigurationRecordersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeConfigurationRecordersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConfigurationRecordersOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::DescribeConfigurationRecordersAsyncHelper(const DescribeConfigurationRecordersRequest& request, const DescribeConfigurationRecordersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -408,12 +498,22 @@ DescribeDeliveryChannelStatusOutcome ConfigServiceClient::DescribeDeliveryChanne
 
 DescribeDeliveryChannelStatusOutcomeCallable ConfigServiceClient::DescribeDeliveryChannelStatusCallable(const DescribeDeliveryChannelStatusRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::DescribeDeliveryChannelStatus, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeDeliveryChannelStatus, Aws::Client::RejectedCallOutcome<DescribeDeliveryChannelStatusOutcome>(), this, request);
+}
+
+DescribeDeliveryChannelStatusOutcomeCallable ConfigServiceClient::DescribeDeliveryChannelStatusCallable(DescribeDeliveryChannelStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeDeliveryChannelStatus, Aws::Client::RejectedCallOutcome<DescribeDeliveryChannelStatusOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::DescribeDeliveryChannelStatusAsync(const DescribeDeliveryChannelStatusRequest& request, const DescribeDeliveryChannelStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::DescribeDeliveryChannelStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeDeliveryChannelStatusAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDeliveryChannelStatusOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::DescribeDeliveryChannelStatusAsync(DescribeDeliveryChannelStatusRequest&& request, const DescribeDeliveryChannelStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeDeliveryChannelStatusAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDeliveryChannelStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::DescribeDeliveryChannelStatusAsyncHelper(const DescribeDeliveryChannelStatusRequest& request, const DescribeDeliveryChannelStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -439,12 +539,22 @@ DescribeDeliveryChannelsOutcome ConfigServiceClient::DescribeDeliveryChannels(co
 
 DescribeDeliveryChannelsOutcomeCallable ConfigServiceClient::DescribeDeliveryChannelsCallable(const DescribeDeliveryChannelsRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::DescribeDeliveryChannels, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeDeliveryChannels, Aws::Client::RejectedCallOutcome<DescribeDeliveryChannelsOutcome>(), this, request);
+}
+
+DescribeDeliveryChannelsOutcomeCallable ConfigServiceClient::DescribeDeliveryChannelsCallable(DescribeDeliveryChannelsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::DescribeDeliveryChannels, Aws::Client::RejectedCallOutcome<DescribeDeliveryChannelsOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::DescribeDeliveryChannelsAsync(const DescribeDeliveryChannelsRequest& request, const DescribeDeliveryChannelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::DescribeDeliveryChannelsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeDeliveryChannelsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDeliveryChannelsOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::DescribeDeliveryChannelsAsync(DescribeDeliveryChannelsRequest&& request, const DescribeDeliveryChannelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::DescribeDeliveryChannelsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDeliveryChannelsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::DescribeDeliveryChannelsAsyncHelper(const DescribeDeliveryChannelsRequest& request, const DescribeDeliveryChannelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -470,12 +580,22 @@ GetComplianceDetailsByConfigRuleOutcome ConfigServiceClient::GetComplianceDetail
 
 GetComplianceDetailsByConfigRuleOutcomeCallable ConfigServiceClient::GetComplianceDetailsByConfigRuleCallable(const GetComplianceDetailsByConfigRuleRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::GetComplianceDetailsByConfigRule, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::GetComplianceDetailsByConfigRule, Aws::Client::RejectedCallOutcome<GetComplianceDetailsByConfigRuleOutcome>(), this, request);
+}
+
+GetComplianceDetailsByConfigRuleOutcomeCallable ConfigServiceClient::GetComplianceDetailsByConfigRuleCallable(GetComplianceDetailsByConfigRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::GetComplianceDetailsByConfigRule, Aws::Client::RejectedCallOutcome<GetComplianceDetailsByConfigRuleOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::GetComplianceDetailsByConfigRuleAsync(const GetComplianceDetailsByConfigRuleRequest& request, const GetComplianceDetailsByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::GetComplianceDetailsByConfigRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::GetComplianceDetailsByConfigRuleAsyncHelper, Aws::Client::RejectedAsyncCall<GetComplianceDetailsByConfigRuleOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::GetComplianceDetailsByConfigRuleAsync(GetComplianceDetailsByConfigRuleRequest&& request, const GetComplianceDetailsByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::GetComplianceDetailsByConfigRuleAsyncHelper, Aws::Client::RejectedAsyncCall<GetComplianceDetailsByConfigRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::GetComplianceDetailsByConfigRuleAsyncHelper(const GetComplianceDetailsByConfigRuleRequest& request, const GetComplianceDetailsByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -501,12 +621,22 @@ GetComplianceDetailsByResourceOutcome ConfigServiceClient::GetComplianceDetailsB
 
 GetComplianceDetailsByResourceOutcomeCallable ConfigServiceClient::GetComplianceDetailsByResourceCallable(const GetComplianceDetailsByResourceRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::GetComplianceDetailsByResource, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::GetComplianceDetailsByResource, Aws::Client::RejectedCallOutcome<GetComplianceDetailsByResourceOutcome>(), this, request);
+}
+
+GetComplianceDetailsByResourceOutcomeCallable ConfigServiceClient::GetComplianceDetailsByResourceCallable(GetComplianceDetailsByResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::GetComplianceDetailsByResource, Aws::Client::RejectedCallOutcome<GetComplianceDetailsByResourceOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::GetComplianceDetailsByResourceAsync(const GetComplianceDetailsByResourceRequest& request, const GetComplianceDetailsByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::GetComplianceDetailsByResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::GetComplianceDetailsByResourceAsyncHelper, Aws::Client::RejectedAsyncCall<GetComplianceDetailsByResourceOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::GetComplianceDetailsByResourceAsync(GetComplianceDetailsByResourceRequest&& request, const GetComplianceDetailsByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::GetComplianceDetailsByResourceAsyncHelper, Aws::Client::RejectedAsyncCall<GetComplianceDetailsByResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::GetComplianceDetailsByResourceAsyncHelper(const GetComplianceDetailsByResourceRequest& request, const GetComplianceDetailsByResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -532,12 +662,12 @@ GetComplianceSummaryByConfigRuleOutcome ConfigServiceClient::GetComplianceSummar
 
 GetComplianceSummaryByConfigRuleOutcomeCallable ConfigServiceClient::GetComplianceSummaryByConfigRuleCallable() const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::GetComplianceSummaryByConfigRule, this);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::GetComplianceSummaryByConfigRule, Aws::Client::RejectedCallOutcome<GetComplianceSummaryByConfigRuleOutcome>(), this);
 }
 
 void ConfigServiceClient::GetComplianceSummaryByConfigRuleAsync(const GetComplianceSummaryByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::GetComplianceSummaryByConfigRuleAsyncHelper, this, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::GetComplianceSummaryByConfigRuleAsyncHelper, Aws::Client::RejectedAsyncCall<GetComplianceSummaryByConfigRuleOutcome>(), this, handler, context);
 }
 
 void ConfigServiceClient::GetComplianceSummaryByConfigRuleAsyncHelper(const GetComplianceSummaryByConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -563,12 +693,22 @@ GetComplianceSummaryByResourceTypeOutcome ConfigServiceClient::GetComplianceSumm
 
 GetComplianceSummaryByResourceTypeOutcomeCallable ConfigServiceClient::GetComplianceSummaryByResourceTypeCallable(const GetComplianceSummaryByResourceTypeRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::GetComplianceSummaryByResourceType, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::GetComplianceSummaryByResourceType, Aws::Client::RejectedCallOutcome<GetComplianceSummaryByResourceTypeOutcome>(), this, request);
+}
+
+GetComplianceSummaryByResourceTypeOutcomeCallable ConfigServiceClient::GetComplianceSummaryByResourceTypeCallable(GetComplianceSummaryByResourceTypeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::GetComplianceSummaryByResourceType, Aws::Client::RejectedCallOutcome<GetComplianceSummaryByResourceTypeOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::GetComplianceSummaryByResourceTypeAsync(const GetComplianceSummaryByResourceTypeRequest& request, const GetComplianceSummaryByResourceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::GetComplianceSummaryByResourceTypeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::GetComplianceSummaryByResourceTypeAsyncHelper, Aws::Client::RejectedAsyncCall<GetComplianceSummaryByResourceTypeOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::GetComplianceSummaryByResourceTypeAsync(GetComplianceSummaryByResourceTypeRequest&& request, const GetComplianceSummaryByResourceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::GetComplianceSummaryByResourceTypeAsyncHelper, Aws::Client::RejectedAsyncCall<GetComplianceSummaryByResourceTypeOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::GetComplianceSummaryByResourceTypeAsyncHelper(const GetComplianceSummaryByResourceTypeRequest& request, const GetComplianceSummaryByResourceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -594,12 +734,22 @@ GetResourceConfigHistoryOutcome ConfigServiceClient::GetResourceConfigHistory(co
 
 GetResourceConfigHistoryOutcomeCallable ConfigServiceClient::GetResourceConfigHistoryCallable(const GetResourceConfigHistoryRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::GetResourceConfigHistory, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::GetResourceConfigHistory, Aws::Client::RejectedCallOutcome<GetResourceConfigHistoryOutcome>(), this, request);
+}
+
+GetResourceConfigHistoryOutcomeCallable ConfigServiceClient::GetResourceConfigHistoryCallable(GetResourceConfigHistoryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::GetResourceConfigHistory, Aws::Client::RejectedCallOutcome<GetResourceConfigHistoryOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::GetResourceConfigHistoryAsync(const GetResourceConfigHistoryRequest& request, const GetResourceConfigHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::GetResourceConfigHistoryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::GetResourceConfigHistoryAsyncHelper, Aws::Client::RejectedAsyncCall<GetResourceConfigHistoryOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::GetResourceConfigHistoryAsync(GetResourceConfigHistoryRequest&& request, const GetResourceConfigHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::GetResourceConfigHistoryAsyncHelper, Aws::Client::RejectedAsyncCall<GetResourceConfigHistoryOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::GetResourceConfigHistoryAsyncHelper(const GetResourceConfigHistoryRequest& request, const GetResourceConfigHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -625,12 +775,22 @@ ListDiscoveredResourcesOutcome ConfigServiceClient::ListDiscoveredResources(cons
 
 ListDiscoveredResourcesOutcomeCallable ConfigServiceClient::ListDiscoveredResourcesCallable(const ListDiscoveredResourcesRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::ListDiscoveredResources, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::ListDiscoveredResources, Aws::Client::RejectedCallOutcome<ListDiscoveredResourcesOutcome>(), this, request);
+}
+
+ListDiscoveredResourcesOutcomeCallable ConfigServiceClient::ListDiscoveredResourcesCallable(ListDiscoveredResourcesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::ListDiscoveredResources, Aws::Client::RejectedCallOutcome<ListDiscoveredResourcesOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::ListDiscoveredResourcesAsync(const ListDiscoveredResourcesRequest& request, const ListDiscoveredResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::ListDiscoveredResourcesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::ListDiscoveredResourcesAsyncHelper, Aws::Client::RejectedAsyncCall<ListDiscoveredResourcesOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::ListDiscoveredResourcesAsync(ListDiscoveredResourcesRequest&& request, const ListDiscoveredResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::ListDiscoveredResourcesAsyncHelper, Aws::Client::RejectedAsyncCall<ListDiscoveredResourcesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::ListDiscoveredResourcesAsyncHelper(const ListDiscoveredResourcesRequest& request, const ListDiscoveredResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -656,12 +816,22 @@ PutConfigRuleOutcome ConfigServiceClient::PutConfigRule(const PutConfigRuleReque
 
 PutConfigRuleOutcomeCallable ConfigServiceClient::PutConfigRuleCallable(const PutConfigRuleRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::PutConfigRule, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::PutConfigRule, Aws::Client::RejectedCallOutcome<PutConfigRuleOutcome>(), this, request);
+}
+
+PutConfigRuleOutcomeCallable ConfigServiceClient::PutConfigRuleCallable(PutConfigRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::PutConfigRule, Aws::Client::RejectedCallOutcome<PutConfigRuleOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::PutConfigRuleAsync(const PutConfigRuleRequest& request, const PutConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::PutConfigRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::PutConfigRuleAsyncHelper, Aws::Client::RejectedAsyncCall<PutConfigRuleOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::PutConfigRuleAsync(PutConfigRuleRequest&& request, const PutConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::PutConfigRuleAsyncHelper, Aws::Client::RejectedAsyncCall<PutConfigRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::PutConfigRuleAsyncHelper(const PutConfigRuleRequest& request, const PutConfigRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -687,12 +857,22 @@ PutConfigurationRecorderOutcome ConfigServiceClient::PutConfigurationRecorder(co
 
 PutConfigurationRecorderOutcomeCallable ConfigServiceClient::PutConfigurationRecorderCallable(const PutConfigurationRecorderRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::PutConfigurationRecorder, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::PutConfigurationRecorder, Aws::Client::RejectedCallOutcome<PutConfigurationRecorderOutcome>(), this, request);
+}
+
+PutConfigurationRecorderOutcomeCallable ConfigServiceClient::PutConfigurationRecorderCallable(PutConfigurationRecorderRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::PutConfigurationRecorder, Aws::Client::RejectedCallOutcome<PutConfigurationRecorderOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::PutConfigurationRecorderAsync(const PutConfigurationRecorderRequest& request, const PutConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::PutConfigurationRecorderAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::PutConfigurationRecorderAsyncHelper, Aws::Client::RejectedAsyncCall<PutConfigurationRecorderOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::PutConfigurationRecorderAsync(PutConfigurationRecorderRequest&& request, const PutConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::PutConfigurationRecorderAsyncHelper, Aws::Client::RejectedAsyncCall<PutConfigurationRecorderOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::PutConfigurationRecorderAsyncHelper(const PutConfigurationRecorderRequest& request, const PutConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -718,12 +898,22 @@ PutDeliveryChannelOutcome ConfigServiceClient::PutDeliveryChannel(const PutDeliv
 
 PutDeliveryChannelOutcomeCallable ConfigServiceClient::PutDeliveryChannelCallable(const PutDeliveryChannelRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::PutDeliveryChannel, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::PutDeliveryChannel, Aws::Client::RejectedCallOutcome<PutDeliveryChannelOutcome>(), this, request);
+}
+
+PutDeliveryChannelOutcomeCallable ConfigServiceClient::PutDeliveryChannelCallable(PutDeliveryChannelRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::PutDeliveryChannel, Aws::Client::RejectedCallOutcome<PutDeliveryChannelOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::PutDeliveryChannelAsync(const PutDeliveryChannelRequest& request, const PutDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::PutDeliveryChannelAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::PutDeliveryChannelAsyncHelper, Aws::Client::RejectedAsyncCall<PutDeliveryChannelOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::PutDeliveryChannelAsync(PutDeliveryChannelRequest&& request, const PutDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::PutDeliveryChannelAsyncHelper, Aws::Client::RejectedAsyncCall<PutDeliveryChannelOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::PutDeliveryChannelAsyncHelper(const PutDeliveryChannelRequest& request, const PutDeliveryChannelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -749,12 +939,22 @@ PutEvaluationsOutcome ConfigServiceClient::PutEvaluations(const PutEvaluationsRe
 
 PutEvaluationsOutcomeCallable ConfigServiceClient::PutEvaluationsCallable(const PutEvaluationsRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::PutEvaluations, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::PutEvaluations, Aws::Client::RejectedCallOutcome<PutEvaluationsOutcome>(), this, request);
+}
+
+PutEvaluationsOutcomeCallable ConfigServiceClient::PutEvaluationsCallable(PutEvaluationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::PutEvaluations, Aws::Client::RejectedCallOutcome<PutEvaluationsOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::PutEvaluationsAsync(const PutEvaluationsRequest& request, const PutEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::PutEvaluationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::PutEvaluationsAsyncHelper, Aws::Client::RejectedAsyncCall<PutEvaluationsOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::PutEvaluationsAsync(PutEvaluationsRequest&& request, const PutEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::PutEvaluationsAsyncHelper, Aws::Client::RejectedAsyncCall<PutEvaluationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::PutEvaluationsAsyncHelper(const PutEvaluationsRequest& request, const PutEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -780,12 +980,22 @@ StartConfigurationRecorderOutcome ConfigServiceClient::StartConfigurationRecorde
 
 StartConfigurationRecorderOutcomeCallable ConfigServiceClient::StartConfigurationRecorderCallable(const StartConfigurationRecorderRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::StartConfigurationRecorder, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::StartConfigurationRecorder, Aws::Client::RejectedCallOutcome<StartConfigurationRecorderOutcome>(), this, request);
+}
+
+StartConfigurationRecorderOutcomeCallable ConfigServiceClient::StartConfigurationRecorderCallable(StartConfigurationRecorderRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::StartConfigurationRecorder, Aws::Client::RejectedCallOutcome<StartConfigurationRecorderOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::StartConfigurationRecorderAsync(const StartConfigurationRecorderRequest& request, const StartConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::StartConfigurationRecorderAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::StartConfigurationRecorderAsyncHelper, Aws::Client::RejectedAsyncCall<StartConfigurationRecorderOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::StartConfigurationRecorderAsync(StartConfigurationRecorderRequest&& request, const StartConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::StartConfigurationRecorderAsyncHelper, Aws::Client::RejectedAsyncCall<StartConfigurationRecorderOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::StartConfigurationRecorderAsyncHelper(const StartConfigurationRecorderRequest& request, const StartConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -811,12 +1021,22 @@ StopConfigurationRecorderOutcome ConfigServiceClient::StopConfigurationRecorder(
 
 StopConfigurationRecorderOutcomeCallable ConfigServiceClient::StopConfigurationRecorderCallable(const StopConfigurationRecorderRequest& request) const
 {
-  return std::async(std::launch::async, &ConfigServiceClient::StopConfigurationRecorder, this, request);
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::StopConfigurationRecorder, Aws::Client::RejectedCallOutcome<StopConfigurationRecorderOutcome>(), this, request);
+}
+
+StopConfigurationRecorderOutcomeCallable ConfigServiceClient::StopConfigurationRecorderCallable(StopConfigurationRecorderRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ConfigServiceClient::StopConfigurationRecorder, Aws::Client::RejectedCallOutcome<StopConfigurationRecorderOutcome>(), this, std::move(request));
 }
 
 void ConfigServiceClient::StopConfigurationRecorderAsync(const StopConfigurationRecorderRequest& request, const StopConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ConfigServiceClient::StopConfigurationRecorderAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ConfigServiceClient::StopConfigurationRecorderAsyncHelper, Aws::Client::RejectedAsyncCall<StopConfigurationRecorderOutcome>(), this, request, handler, context);
+}
+
+void ConfigServiceClient::StopConfigurationRecorderAsync(StopConfigurationRecorderRequest&& request, const StopConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ConfigServiceClient::StopConfigurationRecorderAsyncHelper, Aws::Client::RejectedAsyncCall<StopConfigurationRecorderOutcome>(), this, std::move(request), handler, context);
 }
 
 void ConfigServiceClient::StopConfigurationRecorderAsyncHelper(const StopConfigurationRecorderRequest& request, const StopConfigurationRecorderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
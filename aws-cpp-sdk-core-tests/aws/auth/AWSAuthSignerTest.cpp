@@ -0,0 +1,622 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/auth/ChunkSigningRequestBody.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpRequestBody.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Auth;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Utils;
+
+static const char* ALLOCATION_TAG = "AWSAuthSignerTest";
+static const char* ACCESS_KEY_ID = "AKIDEXAMPLE";
+static const char* SECRET_KEY = "wJalrXUtnFEMI/K7MDENG+bPxRfiCYEXAMPLEKEY";
+
+static std::shared_ptr<HttpRequest> CreateRequest(const char* uri, HttpMethod method)
+{
+    return HttpClientFactory().CreateHttpRequest(Aws::String(uri), method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+}
+
+//straight transcription of the sigv4 documentation, kept independent of the signer's own string building.
+static ByteBuffer ReferenceSigningKey(const char* secretKey, const Aws::String& simpleDate, const char* region, const char* service)
+{
+    Aws::String secret = Aws::String("AWS4") + secretKey;
+    ByteBuffer key = HashingUtils::CalculateSHA256HMAC(ByteBuffer((unsigned char*)simpleDate.c_str(), simpleDate.length()),
+        ByteBuffer((unsigned char*)secret.c_str(), secret.length()));
+    key = HashingUtils::CalculateSHA256HMAC(ByteBuffer((unsigned char*)region, strlen(region)), key);
+    key = HashingUtils::CalculateSHA256HMAC(ByteBuffer((unsigned char*)service, strlen(service)), key);
+    return HashingUtils::CalculateSHA256HMAC(ByteBuffer((unsigned char*)"aws4_request", 12), key);
+}
+
+static Aws::String ReferenceSignature(const Aws::String& canonicalRequest, const Aws::String& longDate, const char* region, const char* service,
+    const char* secretKey = SECRET_KEY)
+{
+    Aws::String simpleDate = longDate.substr(0, 8);
+    Aws::StringStream stringToSign;
+    stringToSign << "AWS4-HMAC-SHA256\n" << longDate << "\n" << simpleDate << "/" << region << "/" << service << "/aws4_request\n"
+        << HashingUtils::HexEncode(HashingUtils::CalculateSHA256(canonicalRequest));
+
+    ByteBuffer key = ReferenceSigningKey(secretKey, simpleDate, region, service);
+
+    Aws::String finalString = stringToSign.str();
+    return HashingUtils::HexEncode(HashingUtils::CalculateSHA256HMAC(ByteBuffer((unsigned char*)finalString.c_str(), finalString.length()), key));
+}
+
+TEST(AWSAuthSignerTest, TestSignRequestMatchesReference)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto credentialsProvider = Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, ACCESS_KEY_ID, SECRET_KEY);
+    AWSAuthV4Signer signer(credentialsProvider, "s3", "us-east-1");
+
+    auto request = CreateRequest("https://examplebucket.s3.amazonaws.com/photos/my photo.jpg?versionId=1&prefix=a", HttpMethod::HTTP_PUT);
+    request->SetHeaderValue("x-amz-meta-owner", "  someone ");
+    auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *body << "hello";
+    request->AddContentBody(body);
+
+    ASSERT_TRUE(signer.SignRequest(*request));
+
+    const Aws::String& longDate = request->GetHeaderValue("x-amz-date");
+    Aws::String payloadHash = HashingUtils::HexEncode(HashingUtils::CalculateSHA256("hello"));
+    ASSERT_EQ(payloadHash, request->GetHeaderValue("x-amz-content-sha256"));
+
+    Aws::StringStream canonicalRequest;
+    canonicalRequest << "PUT\n/photos/my%20photo.jpg\nprefix=a&versionId=1\n"
+        << "host:examplebucket.s3.amazonaws.com\n"
+        << "x-amz-content-sha256:" << payloadHash << "\n"
+        << "x-amz-date:" << longDate << "\n"
+        << "x-amz-meta-owner:someone\n"
+        << "\nhost;x-amz-content-sha256;x-amz-date;x-amz-meta-owner\n" << payloadHash;
+
+    Aws::StringStream expectedAuthorization;
+    expectedAuthorization << "AWS4-HMAC-SHA256 Credential=" << ACCESS_KEY_ID << "/" << longDate.substr(0, 8) << "/us-east-1/s3/aws4_request, "
+        << "SignedHeaders=host;x-amz-content-sha256;x-amz-date;x-amz-meta-owner, "
+        << "Signature=" << ReferenceSignature(canonicalRequest.str(), longDate, "us-east-1", "s3");
+    ASSERT_EQ(expectedAuthorization.str(), request->GetAwsAuthorization());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSAuthSignerTest, TestSignRequestWithValuelessQueryParameter)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto credentialsProvider = Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, ACCESS_KEY_ID, SECRET_KEY);
+    AWSAuthV4Signer signer(credentialsProvider, "s3", "us-west-2");
+
+    auto request = CreateRequest("https://examplebucket.s3.amazonaws.com/?acl", HttpMethod::HTTP_GET);
+    ASSERT_TRUE(signer.SignRequest(*request));
+
+    const Aws::String& longDate = request->GetHeaderValue("x-amz-date");
+    Aws::String payloadHash = HashingUtils::HexEncode(HashingUtils::CalculateSHA256(""));
+
+    Aws::StringStream canonicalRequest;
+    canonicalRequest << "GET\n/\nacl=\n"
+        << "host:examplebucket.s3.amazonaws.com\n"
+        << "x-amz-content-sha256:" << payloadHash << "\n"
+        << "x-amz-date:" << longDate << "\n"
+        << "\nhost;x-amz-content-sha256;x-amz-date\n" << payloadHash;
+
+    Aws::String expectedSignature = ReferenceSignature(canonicalRequest.str(), longDate, "us-west-2", "s3");
+    const Aws::String& authorization = request->GetAwsAuthorization();
+    ASSERT_EQ(expectedSignature, authorization.substr(authorization.rfind('=') + 1));
+
+    AWS_END_MEMORY_TEST
+}
+
+//hands out whatever secret it was last given, like a provider picking up rotated credentials.
+class RotatingCredentialsProvider : public AWSCredentialsProvider
+{
+public:
+    RotatingCredentialsProvider(const char* secretKey) : m_secretKey(secretKey) {}
+
+    AWSCredentials GetAWSCredentials() override { return AWSCredentials(ACCESS_KEY_ID, m_secretKey); }
+    void Rotate(const char* secretKey) { m_secretKey = secretKey; }
+
+private:
+    Aws::String m_secretKey;
+};
+
+static Aws::String SignAndGetSignature(const AWSAuthV4Signer& signer, Aws::String& longDate)
+{
+    auto request = CreateRequest("https://examplebucket.s3.amazonaws.com/?acl", HttpMethod::HTTP_GET);
+    if (!signer.SignRequest(*request))
+    {
+        return "";
+    }
+
+    longDate = request->GetHeaderValue("x-amz-date");
+    const Aws::String& authorization = request->GetAwsAuthorization();
+    return authorization.substr(authorization.rfind('=') + 1);
+}
+
+static Aws::String ExpectedAclSignature(const Aws::String& longDate, const char* secretKey)
+{
+    Aws::String payloadHash = HashingUtils::HexEncode(HashingUtils::CalculateSHA256(""));
+    Aws::StringStream canonicalRequest;
+    canonicalRequest << "GET\n/\nacl=\n"
+        << "host:examplebucket.s3.amazonaws.com\n"
+        << "x-amz-content-sha256:" << payloadHash << "\n"
+        << "x-amz-date:" << longDate << "\n"
+        << "\nhost;x-amz-content-sha256;x-amz-date\n" << payloadHash;
+    return ReferenceSignature(canonicalRequest.str(), longDate, "us-west-2", "s3", secretKey);
+}
+
+TEST(AWSAuthSignerTest, TestCachedSigningKeyFollowsSecretRotation)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    static const char* ROTATED_SECRET_KEY = "rotatedSecretKeyEXAMPLEKEYwJalrXUtnFEMI/K7";
+    auto credentialsProvider = Aws::MakeShared<RotatingCredentialsProvider>(ALLOCATION_TAG, SECRET_KEY);
+    AWSAuthV4Signer signer(credentialsProvider, "s3", "us-west-2");
+
+    //the second round is served from the cache and has to come out the same as a fresh derivation.
+    for (int i = 0; i < 2; ++i)
+    {
+        Aws::String longDate;
+        Aws::String signature = SignAndGetSignature(signer, longDate);
+        ASSERT_EQ(ExpectedAclSignature(longDate, SECRET_KEY), signature);
+    }
+
+    credentialsProvider->Rotate(ROTATED_SECRET_KEY);
+    for (int i = 0; i < 2; ++i)
+    {
+        Aws::String longDate;
+        Aws::String signature = SignAndGetSignature(signer, longDate);
+        ASSERT_EQ(ExpectedAclSignature(longDate, ROTATED_SECRET_KEY), signature);
+    }
+
+    credentialsProvider->Rotate(SECRET_KEY);
+    Aws::String longDate;
+    Aws::String signature = SignAndGetSignature(signer, longDate);
+    ASSERT_EQ(ExpectedAclSignature(longDate, SECRET_KEY), signature);
+
+    AWS_END_MEMORY_TEST
+}
+
+struct SignedAcl
+{
+    Aws::String longDate;
+    Aws::String signature;
+};
+
+//signs SIGNINGS_PER_THREAD requests on each of threadCount threads sharing one signer and returns signatures per second.
+static double RunConcurrentSigning(const AWSAuthV4Signer& signer, unsigned threadCount, Aws::Vector<SignedAcl>& results)
+{
+    static const unsigned SIGNINGS_PER_THREAD = 500;
+    results.resize(threadCount * SIGNINGS_PER_THREAD);
+
+    auto start = std::chrono::steady_clock::now();
+    Aws::Vector<std::thread> threads;
+    for (unsigned i = 0; i < threadCount; ++i)
+    {
+        threads.push_back(std::thread([&signer, &results, i]
+        {
+            for (unsigned j = 0; j < SIGNINGS_PER_THREAD; ++j)
+            {
+                SignedAcl& result = results[i * SIGNINGS_PER_THREAD + j];
+                result.signature = SignAndGetSignature(signer, result.longDate);
+            }
+        }));
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return results.size() / elapsed.count();
+}
+
+TEST(AWSAuthSignerTest, TestConcurrentSigning)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto credentialsProvider = Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, ACCESS_KEY_ID, SECRET_KEY);
+    AWSAuthV4Signer signer(credentialsProvider, "s3", "us-west-2");
+
+    unsigned threadCount = std::max(2u, std::thread::hardware_concurrency());
+    Aws::Vector<SignedAcl> results;
+    RunConcurrentSigning(signer, threadCount, results);
+
+    //every signature has to stay valid when the signer is hammered from many threads at once.
+    for (const auto& result : results)
+    {
+        ASSERT_EQ(ExpectedAclSignature(result.longDate, SECRET_KEY), result.signature);
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSAuthSignerTest, DISABLED_BenchmarkConcurrentSigning)
+{
+    auto credentialsProvider = Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, ACCESS_KEY_ID, SECRET_KEY);
+    AWSAuthV4Signer signer(credentialsProvider, "s3", "us-west-2");
+
+    unsigned threadCount = std::max(2u, std::thread::hardware_concurrency());
+    Aws::Vector<SignedAcl> singleThreadResults;
+    Aws::Vector<SignedAcl> multiThreadResults;
+    double singleThreadRate = RunConcurrentSigning(signer, 1, singleThreadResults);
+    double multiThreadRate = RunConcurrentSigning(signer, threadCount, multiThreadResults);
+
+    printf("[ BENCH    ] SigV4 signing: %.0f/s on 1 thread, %.0f/s on %u threads (%.2fx)\n",
+        singleThreadRate, multiThreadRate, threadCount, multiThreadRate / singleThreadRate);
+}
+
+TEST(AWSAuthSignerTest, TestPresignRequestMatchesReference)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto credentialsProvider = Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, ACCESS_KEY_ID, SECRET_KEY);
+    AWSAuthV4Signer signer(credentialsProvider, "s3", "us-east-1");
+
+    auto request = CreateRequest("https://examplebucket.s3.amazonaws.com/test.txt", HttpMethod::HTTP_GET);
+    ASSERT_TRUE(signer.PresignRequest(*request, 86400));
+
+    auto parameters = request->GetQueryStringParameters();
+    ASSERT_EQ("86400", parameters.find("X-Amz-Expires")->second);
+    ASSERT_EQ("host", parameters.find("X-Amz-SignedHeaders")->second);
+    ASSERT_EQ("AWS4-HMAC-SHA256", parameters.find("X-Amz-Algorithm")->second);
+    Aws::String longDate = parameters.find("X-Amz-Date")->second;
+    ASSERT_EQ(Aws::String(ACCESS_KEY_ID) + "/" + longDate.substr(0, 8) + "/us-east-1/s3/aws4_request", parameters.find("X-Amz-Credential")->second);
+
+    //the query string is canonicalized before signing and the signature is appended last.
+    const Aws::String& queryString = request->GetQueryString();
+    Aws::String signedQueryString = queryString.substr(1, queryString.rfind("&X-Amz-Signature=") - 1);
+
+    Aws::StringStream canonicalRequest;
+    canonicalRequest << "GET\n/test.txt\n" << signedQueryString << "\nhost:examplebucket.s3.amazonaws.com\n\nhost\nUNSIGNED-PAYLOAD";
+    ASSERT_EQ(ReferenceSignature(canonicalRequest.str(), longDate, "us-east-1", "s3"), parameters.find("X-Amz-Signature")->second);
+
+    AWS_END_MEMORY_TEST
+}
+
+static Aws::String ReadAll(HttpRequestBody& body, size_t readSize)
+{
+    Aws::String encoded;
+    Aws::Vector<char> buffer(readSize);
+    size_t bytesRead = 0;
+    while ((bytesRead = body.Read(buffer.data(), buffer.size())) > 0)
+    {
+        encoded.append(buffer.data(), bytesRead);
+    }
+    return encoded;
+}
+
+//the example from http://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-streaming.html
+TEST(AWSAuthSignerTest, TestChunkSigningMatchesS3Example)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto payload = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *payload << Aws::String(66560, 'a');
+    ByteBuffer signingKey = ReferenceSigningKey("wJalrXUtnFEMI/K7MDENG/bPxRfiCYEXAMPLEKEY", "20130524", "us-east-1", "s3");
+
+    ChunkSigningRequestBody body(HttpRequestBody::Create(payload), signingKey, "20130524T000000Z", "20130524/us-east-1/s3/aws4_request",
+        "4f232c4386841ef735655705268965c44a0e4690baa4adea153f7db9fa80a0a9", 65536);
+    ASSERT_EQ(66824, body.GetLength());
+    ASSERT_EQ(66824, ChunkSigningRequestBody::CalculateEncodedLength(66560, 65536));
+
+    //odd sized reads, so frames get split across calls.
+    Aws::String encoded = ReadAll(body, 1000);
+    ASSERT_EQ(66824u, encoded.size());
+
+    Aws::String firstHeader("10000;chunk-signature=ad80c730a21e5b8d04586a2213dd63b9a0e99e0e2307b0ade35a65485a288648\r\n");
+    ASSERT_EQ(firstHeader, encoded.substr(0, firstHeader.size()));
+    size_t secondFrame = firstHeader.size() + 65536 + 2;
+    ASSERT_EQ("\r\n", encoded.substr(secondFrame - 2, 2));
+
+    Aws::String secondHeader("400;chunk-signature=0055627c9e194cb4542bae2aa5492e3c1575bbb81b612b7d234b86a503ef5497\r\n");
+    ASSERT_EQ(secondHeader, encoded.substr(secondFrame, secondHeader.size()));
+    ASSERT_EQ(Aws::String(1024, 'a'), encoded.substr(secondFrame + secondHeader.size(), 1024));
+
+    Aws::String finalFrame("0;chunk-signature=b6c6ea8a5354eaf15b3cb7646744f4275b71ea724fed81ceb9323e279d449df9\r\n\r\n");
+    ASSERT_EQ(finalFrame, encoded.substr(encoded.size() - finalFrame.size()));
+    ASSERT_EQ("b6c6ea8a5354eaf15b3cb7646744f4275b71ea724fed81ceb9323e279d449df9", body.GetLastSignature());
+    ASSERT_EQ(0u, body.Read(&encoded[0], 1));
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSAuthSignerTest, TestStreamingSignRequestSignsHeadersAndChunks)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto credentialsProvider = Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, ACCESS_KEY_ID, SECRET_KEY);
+    AWSAuthV4Signer signer(credentialsProvider, "s3", "us-east-1");
+
+    auto request = CreateRequest("https://examplebucket.s3.amazonaws.com/chunked", HttpMethod::HTTP_PUT);
+    auto payload = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *payload << "hello";
+    request->AddContentBody(payload);
+    request->SetContentLength("5");
+    request->SetPayloadSigningMode(PayloadSigningMode::STREAMING_SIGNED);
+
+    ASSERT_TRUE(signer.SignRequest(*request));
+
+    //nothing may have been read to sign the headers.
+    ASSERT_EQ(0, static_cast<long long>(payload->tellg()));
+
+    const Aws::String& longDate = request->GetHeaderValue("x-amz-date");
+    Aws::String encodedLength = StringUtils::to_string(ChunkSigningRequestBody::CalculateEncodedLength(5));
+    ASSERT_EQ("STREAMING-AWS4-HMAC-SHA256-PAYLOAD", request->GetHeaderValue("x-amz-content-sha256"));
+    ASSERT_EQ("aws-chunked", request->GetHeaderValue("content-encoding"));
+    ASSERT_EQ("5", request->GetHeaderValue("x-amz-decoded-content-length"));
+    ASSERT_EQ(encodedLength, request->GetContentLength());
+
+    Aws::StringStream canonicalRequest;
+    canonicalRequest << "PUT\n/chunked\n\n"
+        << "content-encoding:aws-chunked\n"
+        << "content-length:" << encodedLength << "\n"
+        << "host:examplebucket.s3.amazonaws.com\n"
+        << "x-amz-content-sha256:STREAMING-AWS4-HMAC-SHA256-PAYLOAD\n"
+        << "x-amz-date:" << longDate << "\n"
+        << "x-amz-decoded-content-length:5\n"
+        << "\ncontent-encoding;content-length;host;x-amz-content-sha256;x-amz-date;x-amz-decoded-content-length\n"
+        << "STREAMING-AWS4-HMAC-SHA256-PAYLOAD";
+    Aws::String seedSignature = ReferenceSignature(canonicalRequest.str(), longDate, "us-east-1", "s3");
+    const Aws::String& authorization = request->GetAwsAuthorization();
+    ASSERT_EQ(seedSignature, authorization.substr(authorization.rfind('=') + 1));
+
+    //the body the client sends is chained to the seed signature.
+    Aws::String simpleDate = longDate.substr(0, 8);
+    Aws::String scope = simpleDate + "/us-east-1/s3/aws4_request";
+    auto referencePayload = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *referencePayload << "hello";
+    ChunkSigningRequestBody referenceBody(HttpRequestBody::Create(referencePayload), ReferenceSigningKey(SECRET_KEY, simpleDate, "us-east-1", "s3"),
+        longDate, scope, seedSignature);
+
+    Aws::String encoded = ReadAll(*request->GetRequestBody(), 4096);
+    ASSERT_EQ(ReadAll(referenceBody, 4096), encoded);
+    ASSERT_EQ(static_cast<size_t>(ChunkSigningRequestBody::CalculateEncodedLength(5)), encoded.size());
+    ASSERT_EQ(0u, encoded.find("5;chunk-signature="));
+    ASSERT_EQ(payload, request->GetContentBody());
+
+    AWS_END_MEMORY_TEST
+}
+
+/**
+ * Hands out its data once and, like a pipe, can't seek, so a body over it has no length.
+ */
+class UnseekableStreamBuf : public std::streambuf
+{
+public:
+    UnseekableStreamBuf(char* data) { setg(data, data, data + strlen(data)); }
+};
+
+TEST(AWSAuthSignerTest, TestStreamingSignRequestFailsForUnknownLength)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto credentialsProvider = Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, ACCESS_KEY_ID, SECRET_KEY);
+    AWSAuthV4Signer signer(credentialsProvider, "s3", "us-east-1");
+
+    char data[] = "hello";
+    UnseekableStreamBuf streamBuf(data);
+    auto request = CreateRequest("https://examplebucket.s3.amazonaws.com/chunked", HttpMethod::HTTP_PUT);
+    auto payload = Aws::MakeShared<Aws::IOStream>(ALLOCATION_TAG, &streamBuf);
+    request->AddContentBody(payload);
+    request->SetPayloadSigningMode(PayloadSigningMode::STREAMING_SIGNED);
+    ASSERT_GT(0, request->GetRequestBody()->GetLength());
+
+    //without a length the request could only go out with neither content-length nor chunked transfer encoding.
+    ASSERT_FALSE(signer.SignRequest(*request));
+    ASSERT_FALSE(request->HasHeader("content-encoding"));
+    ASSERT_FALSE(request->HasHeader("content-length"));
+    ASSERT_EQ(payload, request->GetContentBody());
+
+    //a declared length is all it takes.
+    request->SetContentLength("5");
+    ASSERT_TRUE(signer.SignRequest(*request));
+    ASSERT_EQ("5", request->GetHeaderValue("x-amz-decoded-content-length"));
+    Aws::String encoded = ReadAll(*request->GetRequestBody(), 4096);
+    ASSERT_EQ(0u, encoded.find("5;chunk-signature="));
+    ASSERT_NE(Aws::String::npos, encoded.find("\r\nhello\r\n"));
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSAuthSignerTest, TestUnsignedPayloadOnlyOverHttps)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto credentialsProvider = Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, ACCESS_KEY_ID, SECRET_KEY);
+    AWSAuthV4Signer signer(credentialsProvider, "s3", "us-east-1");
+
+    auto request = CreateRequest("https://examplebucket.s3.amazonaws.com/unsigned", HttpMethod::HTTP_PUT);
+    auto payload = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *payload << "hello";
+    request->AddContentBody(payload);
+    request->SetPayloadSigningMode(PayloadSigningMode::UNSIGNED_OVER_HTTPS);
+    //the body must not even be looked at, not even to fill the digest cache.
+    auto payloadDigests = Aws::MakeShared<Aws::Utils::Crypto::PayloadDigests>(ALLOCATION_TAG);
+    request->SetPayloadDigests(payloadDigests);
+
+    ASSERT_TRUE(signer.SignRequest(*request));
+    ASSERT_EQ("UNSIGNED-PAYLOAD", request->GetHeaderValue("x-amz-content-sha256"));
+    ASSERT_FALSE(payloadDigests->Has(Aws::Utils::Crypto::PayloadDigests::SHA256_DIGEST));
+
+    const Aws::String& longDate = request->GetHeaderValue("x-amz-date");
+    Aws::StringStream canonicalRequest;
+    canonicalRequest << "PUT\n/unsigned\n\n"
+        << "host:examplebucket.s3.amazonaws.com\n"
+        << "x-amz-content-sha256:UNSIGNED-PAYLOAD\n"
+        << "x-amz-date:" << longDate << "\n"
+        << "\nhost;x-amz-content-sha256;x-amz-date\n"
+        << "UNSIGNED-PAYLOAD";
+    const Aws::String& authorization = request->GetAwsAuthorization();
+    ASSERT_EQ(ReferenceSignature(canonicalRequest.str(), longDate, "us-east-1", "s3"), authorization.substr(authorization.rfind('=') + 1));
+
+    //nothing but tls would protect the body, so plain http still signs it.
+    auto plainRequest = CreateRequest("http://examplebucket.s3.amazonaws.com/unsigned", HttpMethod::HTTP_PUT);
+    plainRequest->AddContentBody(payload);
+    plainRequest->SetPayloadSigningMode(PayloadSigningMode::UNSIGNED_OVER_HTTPS);
+    ASSERT_TRUE(signer.SignRequest(*plainRequest));
+    ASSERT_EQ(HashingUtils::HexEncode(HashingUtils::CalculateSHA256("hello")), plainRequest->GetHeaderValue("x-amz-content-sha256"));
+
+    AWS_END_MEMORY_TEST
+}
+
+//runs every task on its own thread and joins them all when it goes away, so nothing outlives a memory test.
+class JoiningExecutor : public Aws::Utils::Threading::Executor
+{
+public:
+    ~JoiningExecutor()
+    {
+        for (auto& thread : m_threads)
+        {
+            thread.join();
+        }
+    }
+
+protected:
+    bool SubmitToThread(std::function<void()>&& task) override
+    {
+        std::lock_guard<std::mutex> locker(m_threadsMutex);
+        m_threads.push_back(std::thread(std::move(task)));
+        return true;
+    }
+
+private:
+    std::mutex m_threadsMutex;
+    Aws::Vector<std::thread> m_threads;
+};
+
+static Aws::Vector<Aws::String> MakeObjectPaths(size_t count)
+{
+    Aws::Vector<Aws::String> paths;
+    for (size_t i = 0; i < count; ++i)
+    {
+        paths.push_back("/examplebucket/photos/img-" + StringUtils::to_string(i) + ".jpg");
+    }
+    return paths;
+}
+
+static Aws::String PresignOne(const AWSAuthV4Signer& signer, const Aws::String& path)
+{
+    auto request = CreateRequest("https://s3.amazonaws.com", HttpMethod::HTTP_GET);
+    request->GetUri().SetPath(path);
+    return signer.PresignRequest(*request, 3600) ? request->GetURIString() : "";
+}
+
+static Aws::String GetDateParameter(const Aws::String& url)
+{
+    size_t dateStart = url.find("X-Amz-Date=") + 11;
+    return url.substr(dateStart, url.find('&', dateStart) - dateStart);
+}
+
+TEST(AWSAuthSignerTest, TestPresignUrlsMatchesPresignRequest)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto credentialsProvider = Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, ACCESS_KEY_ID, SECRET_KEY, "session");
+    AWSAuthV4Signer signer(credentialsProvider, "s3", "us-east-1");
+
+    //enough paths for several slices, some of which go to the executor.
+    Aws::Vector<Aws::String> paths = MakeObjectPaths(1000);
+    paths.push_back("/examplebucket/my photo.jpg");
+
+    //retried if the clock ticks over between the batch and the one by one urls.
+    for (int attempt = 0; attempt < 3; ++attempt)
+    {
+        Aws::Vector<Aws::String> urls;
+        {
+            JoiningExecutor executor;
+            ASSERT_TRUE(signer.PresignUrls(URI("https://s3.amazonaws.com"), HttpMethod::HTTP_GET, paths, urls, 3600, &executor));
+        }
+        ASSERT_EQ(paths.size(), urls.size());
+
+        Aws::Vector<Aws::String> expected;
+        for (const auto& path : paths)
+        {
+            expected.push_back(PresignOne(signer, path));
+        }
+        if (GetDateParameter(expected.front()) != GetDateParameter(urls.front()) || GetDateParameter(expected.back()) != GetDateParameter(urls.front()))
+        {
+            continue;
+        }
+
+        for (size_t i = 0; i + 1 < paths.size(); ++i)
+        {
+            ASSERT_EQ(expected[i], urls[i]);
+        }
+
+        //the signature always covered the encoded path, the batch puts the encoded path in the url too.
+        Aws::String encodedExpected = expected.back();
+        encodedExpected.replace(encodedExpected.find(' '), 1, "%20");
+        ASSERT_EQ(encodedExpected, urls.back());
+        ASSERT_NE(Aws::String::npos, urls.back().find("X-Amz-Security-Token=session"));
+        break;
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSAuthSignerTest, DISABLED_BenchmarkPresignUrls)
+{
+    auto credentialsProvider = Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, ACCESS_KEY_ID, SECRET_KEY);
+    AWSAuthV4Signer signer(credentialsProvider, "s3", "us-east-1");
+    Aws::Vector<Aws::String> paths = MakeObjectPaths(4000);
+
+    auto start = std::chrono::steady_clock::now();
+    size_t oneByOneCount = 0;
+    for (const auto& path : paths)
+    {
+        oneByOneCount += PresignOne(signer, path).empty() ? 0 : 1;
+    }
+    std::chrono::duration<double> oneByOneTime = std::chrono::steady_clock::now() - start;
+
+    Aws::Vector<Aws::String> urls;
+    start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(signer.PresignUrls(URI("https://s3.amazonaws.com"), HttpMethod::HTTP_GET, paths, urls, 3600));
+    std::chrono::duration<double> batchTime = std::chrono::steady_clock::now() - start;
+    ASSERT_EQ(paths.size(), urls.size());
+
+    std::chrono::duration<double> parallelTime;
+    {
+        JoiningExecutor executor;
+        start = std::chrono::steady_clock::now();
+        ASSERT_TRUE(signer.PresignUrls(URI("https://s3.amazonaws.com"), HttpMethod::HTTP_GET, paths, urls, 3600, &executor));
+        parallelTime = std::chrono::steady_clock::now() - start;
+    }
+    ASSERT_EQ(paths.size(), urls.size());
+    ASSERT_EQ(paths.size(), oneByOneCount);
+
+    double count = static_cast<double>(paths.size());
+    printf("[ BENCH    ] Presigned urls: %.0f/s one by one, %.0f/s batched, %.0f/s batched on an executor (%.2fx)\n",
+        count / oneByOneTime.count(), count / batchTime.count(), count / parallelTime.count(), oneByOneTime.count() / batchTime.count());
+}
@@ -18,13 +18,21 @@
 #include <aws/testing/MemoryTesting.h>
 
 #include <aws/testing/mocks/aws/auth/MockEC2MetadataClient.h>
+#include <aws/testing/mocks/http/MockHttpServer.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/auth/AWSCredentialsProviderChain.h>
+#include <aws/core/internal/EC2MetadataClient.h>
+#include <aws/core/utils/DateTime.h>
 #include <aws/core/utils/UnreferencedParam.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/FileSystemUtils.h>
 
 #include <stdlib.h>
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <future>
 #include <thread>
 #include <fstream>
 
@@ -221,6 +229,55 @@ TEST(ProfileConfigFileAWSCredentialsProviderTest, TestWithEnvVarsButSpecifiedPro
     AWS_END_MEMORY_TEST
 }
 
+TEST(ProfileConfigFileAWSCredentialsProviderTest, TestOnlyReparsesChangedFile)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    FileSystemUtils::CreateDirectoryIfNotExists(ProfileConfigFileAWSCredentialsProvider::GetProfileDirectory().c_str());
+
+    Aws::String configFileName = ProfileConfigFileAWSCredentialsProvider::GetProfileFilename() + "_stamped";
+
+    Aws::String oldValue = GetEnv("AWS_SHARED_CREDENTIALS_FILE");
+    setenv("AWS_SHARED_CREDENTIALS_FILE", configFileName.c_str(), 1);
+
+    {
+        Aws::OFStream configFile(configFileName.c_str(), Aws::OFStream::out | Aws::OFStream::trunc);
+        configFile << "[default]" << std::endl;
+        configFile << "aws_access_key_id = FirstAccessKey" << std::endl;
+        configFile << "aws_secret_access_key = FirstSecretKey" << std::endl;
+    }
+
+    ProfileConfigFileAWSCredentialsProvider provider("default", 10);
+    if (!oldValue.empty())
+        setenv("AWS_SHARED_CREDENTIALS_FILE", oldValue.c_str(), 1);
+    else
+        unsetenv("AWS_SHARED_CREDENTIALS_FILE");
+
+    auto firstSnapshot = provider.GetAWSCredentialsSnapshot();
+    ASSERT_EQ("FirstAccessKey", firstSnapshot->GetAWSAccessKeyId());
+
+    //the check interval passes, but the file didn't change so the very same snapshot is handed out.
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_EQ(firstSnapshot, provider.GetAWSCredentialsSnapshot());
+
+    {
+        Aws::OFStream configFile(configFileName.c_str(), Aws::OFStream::out | Aws::OFStream::trunc);
+        configFile << "[default]" << std::endl;
+        configFile << "aws_access_key_id = RotatedAccessKey" << std::endl;
+        configFile << "aws_secret_access_key = RotatedSecretKey" << std::endl;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    auto rotatedSnapshot = provider.GetAWSCredentialsSnapshot();
+    ASSERT_EQ("RotatedAccessKey", rotatedSnapshot->GetAWSAccessKeyId());
+    ASSERT_EQ("RotatedSecretKey", rotatedSnapshot->GetAWSSecretKey());
+    ASSERT_EQ("FirstAccessKey", firstSnapshot->GetAWSAccessKeyId());
+
+    FileSystemUtils::RemoveFileIfExists(configFileName.c_str());
+
+    AWS_END_MEMORY_TEST
+}
+
 
 TEST(ProfileConfigFileAWSCredentialsProviderTest, TestNotSetup)
 {
@@ -363,4 +420,225 @@ TEST(InstanceProfileCredentialsProviderTest, TestEC2MetadataClientReturnsBadData
     AWS_END_MEMORY_TEST
 }
 
+TEST(InstanceProfileCredentialsProviderTest, TestKeepsLastGoodCredentialsWhenRefreshFails)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto mockClient = Aws::MakeShared<MockEC2MetadataClient>(AllocationTag);
+
+    const char* validCredentials = "{ \"AccessKeyId\": \"goodAccessKey\", \"SecretAccessKey\": \"goodSecretKey\", \"Token\": \"goodToken\" }";
+    mockClient->SetMockedCredentialsValue(validCredentials);
+
+    InstanceProfileCredentialsProvider provider(mockClient, 10);
+    auto snapshot = provider.GetAWSCredentialsSnapshot();
+    ASSERT_EQ("goodAccessKey", snapshot->GetAWSAccessKeyId());
+    ASSERT_EQ(snapshot, provider.GetAWSCredentialsSnapshot());
+
+    mockClient->SetMockedCredentialsValue("");
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ("goodAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+    ASSERT_EQ("goodSecretKey", provider.GetAWSCredentials().GetAWSSecretKey());
+
+    AWS_END_MEMORY_TEST
+}
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+/**
+ * Answers for an instance role, and can be told to hold the credentials request until it is released.
+ */
+class MetadataServiceStub
+{
+public:
+    MetadataServiceStub() : m_hang(false), m_hungRequests(0) {}
+
+    Aws::String Handle(const MockHttpServer::Request& request)
+    {
+        if (request.uri == "/latest/meta-data/iam/security-credentials/")
+        {
+            return MockHttpServer::MakeResponse(200, "test-role\n");
+        }
+        if (request.uri != "/latest/meta-data/iam/security-credentials/test-role")
+        {
+            return MockHttpServer::MakeResponse(404, "");
+        }
+
+        std::unique_lock<std::mutex> locker(m_mutex);
+        if (m_hang)
+        {
+            ++m_hungRequests;
+            m_signal.wait(locker, [this] { return !m_hang; });
+        }
+
+        Aws::StringStream body;
+        body << "{ \"Code\": \"Success\", \"AccessKeyId\": \"" << m_accessKey << "\", \"SecretAccessKey\": \"secretKey\", "
+             << "\"Token\": \"token\", \"Expiration\": \"" << m_expiration << "\" }";
+        return MockHttpServer::MakeResponse(200, body.str());
+    }
+
+    void SetCredentials(const Aws::String& accessKey, std::time_t expiresIn)
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_accessKey = accessKey;
+        m_expiration = DateTime::CalculateGmtTimestampAsString(std::time(nullptr) + expiresIn, "%Y-%m-%dT%H:%M:%SZ");
+    }
+
+    void SetHang(bool hang)
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_mutex);
+            m_hang = hang;
+        }
+        m_signal.notify_all();
+    }
+
+    unsigned GetHungRequests() const { return m_hungRequests; }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_signal;
+    bool m_hang;
+    std::atomic<unsigned> m_hungRequests;
+    Aws::String m_accessKey;
+    Aws::String m_expiration;
+};
+
+static bool WaitForAccessKey(InstanceProfileCredentialsProvider& provider, const Aws::String& accessKey)
+{
+    for (int i = 0; i < 500; ++i)
+    {
+        if (provider.GetAWSCredentialsSnapshot()->GetAWSAccessKeyId() == accessKey)
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+TEST(InstanceProfileCredentialsProviderTest, TestRefreshesAheadOfExpiration)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    MetadataServiceStub metadataService;
+    MockHttpServer server([&metadataService](const MockHttpServer::Request& request) { return metadataService.Handle(request); });
+    ASSERT_TRUE(server.IsRunning());
+
+    //already inside the window where the metadata service has rotated, so the 15 minute refresh rate must not be what we wait for.
+    metadataService.SetCredentials("expiringAccessKey", 60);
+    {
+        auto metadataClient = Aws::MakeShared<Aws::Internal::EC2MetadataClient>(AllocationTag, ("http://" + server.GetEndpoint()).c_str());
+        InstanceProfileCredentialsProvider provider(metadataClient, 1000 * 60 * 15);
+        ASSERT_EQ("expiringAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+        metadataService.SetCredentials("rotatedAccessKey", 60 * 60 * 6);
+        ASSERT_TRUE(WaitForAccessKey(provider, "rotatedAccessKey"));
+        ASSERT_EQ("secretKey", provider.GetAWSCredentials().GetAWSSecretKey());
+        ASSERT_EQ("token", provider.GetAWSCredentials().GetSessionToken());
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(InstanceProfileCredentialsProviderTest, TestServesLastGoodCredentialsWhileMetadataServiceHangs)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    MetadataServiceStub metadataService;
+    MockHttpServer server([&metadataService](const MockHttpServer::Request& request) { return metadataService.Handle(request); });
+    ASSERT_TRUE(server.IsRunning());
+
+    metadataService.SetCredentials("firstAccessKey", 60 * 60 * 6);
+    {
+        auto metadataClient = Aws::MakeShared<Aws::Internal::EC2MetadataClient>(AllocationTag, ("http://" + server.GetEndpoint()).c_str());
+        InstanceProfileCredentialsProvider provider(metadataClient, 50);
+        ASSERT_EQ("firstAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+        metadataService.SetCredentials("secondAccessKey", 60 * 60 * 6);
+        metadataService.SetHang(true);
+        for (int i = 0; i < 500 && metadataService.GetHungRequests() == 0; ++i)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        }
+
+        //the background refresh is stuck on the metadata service; signing threads must not be.
+        auto readers = std::async(std::launch::async, [&provider]
+        {
+            bool allFirst = true;
+            for (int i = 0; i < 10000; ++i)
+            {
+                allFirst = allFirst && provider.GetAWSCredentialsSnapshot()->GetAWSAccessKeyId() == "firstAccessKey";
+            }
+            return allFirst;
+        });
+        bool readersFinished = readers.wait_for(std::chrono::seconds(2)) == std::future_status::ready;
+        unsigned hungRequests = metadataService.GetHungRequests();
+
+        metadataService.SetHang(false);
+        ASSERT_EQ(1u, hungRequests);
+        ASSERT_TRUE(readersFinished);
+        ASSERT_TRUE(readers.get());
+        ASSERT_TRUE(WaitForAccessKey(provider, "secondAccessKey"));
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+/**
+ * Hands out fixed credentials and counts how often it was asked.
+ */
+class CountingCredentialsProvider : public AWSCredentialsProvider
+{
+public:
+    CountingCredentialsProvider(const Aws::String& accessKey) : m_accessKey(accessKey), m_calls(0) {}
+
+    AWSCredentials GetAWSCredentials() override
+    {
+        ++m_calls;
+        return AWSCredentials(m_accessKey, m_accessKey.empty() ? "" : "secretKey");
+    }
+
+    void SetAccessKey(const Aws::String& accessKey) { m_accessKey = accessKey; }
+    unsigned GetCalls() const { return m_calls; }
+
+private:
+    Aws::String m_accessKey;
+    unsigned m_calls;
+};
+
+class TestCredentialsProviderChain : public AWSCredentialsProviderChain
+{
+public:
+    using AWSCredentialsProviderChain::AddProvider;
+};
+
+TEST(AWSCredentialsProviderChainTest, TestRemembersProviderThatSucceeded)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto emptyProvider = Aws::MakeShared<CountingCredentialsProvider>(AllocationTag, "");
+    auto goodProvider = Aws::MakeShared<CountingCredentialsProvider>(AllocationTag, "goodAccessKey");
+    TestCredentialsProviderChain chain;
+    chain.AddProvider(emptyProvider);
+    chain.AddProvider(goodProvider);
+
+    for (int i = 0; i < 5; ++i)
+    {
+        ASSERT_EQ("goodAccessKey", chain.GetAWSCredentials().GetAWSAccessKeyId());
+    }
+    ASSERT_EQ(1u, emptyProvider->GetCalls());
+    ASSERT_EQ(5u, goodProvider->GetCalls());
+
+    //once the remembered provider comes back empty the whole chain is walked again.
+    goodProvider->SetAccessKey("");
+    emptyProvider->SetAccessKey("fallbackAccessKey");
+    ASSERT_EQ("fallbackAccessKey", chain.GetAWSCredentialsSnapshot()->GetAWSAccessKeyId());
+    ASSERT_EQ("fallbackAccessKey", chain.GetAWSCredentialsSnapshot()->GetAWSAccessKeyId());
+    ASSERT_EQ(3u, emptyProvider->GetCalls());
+    ASSERT_EQ(6u, goodProvider->GetCalls());
+
+    AWS_END_MEMORY_TEST
+}
 
@@ -17,6 +17,7 @@
 #include <aws/testing/MemoryTesting.h>
 #include <aws/core/client/AWSClient.h>
 #include <aws/core/client/AWSError.h>
+#include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/AmazonWebServiceRequest.h>
 #include <aws/core/http/standard/StandardHttpRequest.h>
@@ -24,6 +25,17 @@
 #include <aws/core/utils/memory/stl/AWSAllocator.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+#include <aws/core/utils/threading/PooledThreadExecutor.h>
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/client/DefaultRetryStrategy.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/testing/mocks/http/MockHttpServer.h>
+
+#include <atomic>
+#include <mutex>
 
 using namespace Aws::Client;
 using namespace Aws::Http;
@@ -39,36 +51,50 @@ public:
     {
     }
 
+    AccessViolatingAWSClient(const ClientConfiguration& configuration, const std::shared_ptr<AWSAuthSigner>& signer = nullptr) :
+        AWSClient(MakeShared<HttpClientFactory>(ALLOCATION_TAG), configuration, signer, nullptr)
+    {
+    }
+
     void InvokeBuildHttpRequest(const AmazonWebServiceRequest& request,
         const std::shared_ptr<HttpRequest>& httpRequest) const
     {
         BuildHttpRequest(request, httpRequest);
     }
 
+    HttpResponseOutcome InvokeAttemptExhaustively(const Aws::String& uri, const AmazonWebServiceRequest& request, HttpMethod method) const
+    {
+        return AttemptExhaustively(uri, request, method);
+    }
+
 protected:
-    //we don't actually need this for anything, it's just here so we can compile.
+    //server errors are retryable so the retry tests can drive a few attempts.
     AWSError<CoreErrors> BuildAWSError(const std::shared_ptr<Aws::Http::HttpResponse>& response) const override
     {
-        AWS_UNREFERENCED_PARAM(response);
-        return AWSError<CoreErrors>(CoreErrors::INVALID_ACTION, false);
+        bool serverError = response && static_cast<int>(response->GetResponseCode()) >= 500;
+        return AWSError<CoreErrors>(CoreErrors::INVALID_ACTION, serverError);
     }
 };
  
 class AmazonWebServiceRequestMock : public AmazonWebServiceRequest
 {
 public:
-    AmazonWebServiceRequestMock() : m_shouldComputeMd5(false) { }
-    std::shared_ptr<Aws::IOStream> GetBody() const override { return m_body; }
+    AmazonWebServiceRequestMock() : m_shouldComputeMd5(false), m_getBodyCount(0), m_getHeadersCount(0) { }
+    std::shared_ptr<Aws::IOStream> GetBody() const override { ++m_getBodyCount; return m_body; }
     void SetBody(const std::shared_ptr<Aws::IOStream>& body) { m_body = body; }
-    HeaderValueCollection GetHeaders() const override { return m_headers; }
+    HeaderValueCollection GetHeaders() const override { ++m_getHeadersCount; return m_headers; }
     void SetHeaders(const HeaderValueCollection& value) { m_headers = value; }
     bool ShouldComputeContentMd5() const override { return m_shouldComputeMd5; }
     void SetComputeContentMd5(bool value) { m_shouldComputeMd5 = value; }
+    int GetBodyCount() const { return m_getBodyCount; }
+    int GetHeadersCount() const { return m_getHeadersCount; }
 
 private:
     std::shared_ptr<Aws::IOStream> m_body;
     HeaderValueCollection m_headers;
     bool m_shouldComputeMd5;
+    mutable std::atomic<int> m_getBodyCount;
+    mutable std::atomic<int> m_getHeadersCount;
 };
 
 TEST(AWSClientTest, TestBuildHttpRequestWithHeadersOnly)
@@ -171,6 +197,77 @@ TEST(AWSClientTest, TestBuildHttpRequestWithHeadersAndBody)
     AWS_END_MEMORY_TEST
 }
 
+TEST(AWSClientTest, TestContentMd5ComesFromTheSharedPayloadDigests)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10);
+
+    AmazonWebServiceRequestMock amazonWebServiceRequest;
+    amazonWebServiceRequest.SetComputeContentMd5(true);
+    std::shared_ptr<Aws::StringStream> ss = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *ss << "test";
+    amazonWebServiceRequest.SetBody(ss);
+
+    auto payloadDigests = Aws::MakeShared<Utils::Crypto::PayloadDigests>(ALLOCATION_TAG);
+    auto credentialsProvider = Aws::MakeShared<Auth::SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "accessKey", "secretKey");
+    AccessViolatingAWSClient awsClient(ClientConfiguration(), Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, credentialsProvider, "service", "us-east-1"));
+
+    //two attempts of the same logical request share the digests, the second one finds them already computed.
+    for (int attempt = 0; attempt < 2; ++attempt)
+    {
+        URI uri("http://www.uri.com");
+        auto httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, uri, HttpMethod::HTTP_PUT);
+        httpRequest->SetPayloadDigests(payloadDigests);
+        awsClient.InvokeBuildHttpRequest(amazonWebServiceRequest, httpRequest);
+
+        ASSERT_EQ(Utils::HashingUtils::Base64Encode(Utils::HashingUtils::CalculateMD5("test")), httpRequest->GetHeaderValue(Http::CONTENT_MD5_HEADER));
+        //the signer's sha256 came out of the same read of the body.
+        ASSERT_TRUE(payloadDigests->Has(Utils::Crypto::PayloadDigests::SHA256_DIGEST));
+        ASSERT_EQ(Utils::HashingUtils::CalculateSHA256("test"), payloadDigests->GetSHA256());
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(AWSClientTest, TestPayloadIsOnlyHashedWhenTheSignerSignsTheHash)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10);
+
+    auto credentialsProvider = Aws::MakeShared<Auth::SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "accessKey", "secretKey");
+    ClientConfiguration configuration;
+    configuration.payloadSigningMode = PayloadSigningMode::UNSIGNED_OVER_HTTPS;
+    AccessViolatingAWSClient awsClient(configuration, Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, credentialsProvider, "service", "us-east-1"));
+
+    AmazonWebServiceRequestMock amazonWebServiceRequest;
+    amazonWebServiceRequest.SetComputeContentMd5(true);
+    std::shared_ptr<Aws::StringStream> ss = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *ss << "test";
+    amazonWebServiceRequest.SetBody(ss);
+
+    //UNSIGNED-PAYLOAD over https, STREAMING-AWS4-HMAC-SHA256-PAYLOAD anywhere: nothing reads the sha256.
+    const PayloadSigningMode modes[] = { PayloadSigningMode::UNSIGNED_OVER_HTTPS, PayloadSigningMode::STREAMING_SIGNED };
+    for (auto mode : modes)
+    {
+        amazonWebServiceRequest.SetPayloadSigningMode(mode);
+        auto payloadDigests = Aws::MakeShared<Utils::Crypto::PayloadDigests>(ALLOCATION_TAG);
+        auto httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, URI("https://www.uri.com"), HttpMethod::HTTP_PUT);
+        httpRequest->SetPayloadDigests(payloadDigests);
+        awsClient.InvokeBuildHttpRequest(amazonWebServiceRequest, httpRequest);
+
+        ASSERT_EQ(Utils::HashingUtils::Base64Encode(Utils::HashingUtils::CalculateMD5("test")), httpRequest->GetHeaderValue(Http::CONTENT_MD5_HEADER));
+        ASSERT_FALSE(payloadDigests->Has(Utils::Crypto::PayloadDigests::SHA256_DIGEST));
+    }
+
+    //without tls the body is signed after all.
+    amazonWebServiceRequest.SetPayloadSigningMode(PayloadSigningMode::UNSIGNED_OVER_HTTPS);
+    auto payloadDigests = Aws::MakeShared<Utils::Crypto::PayloadDigests>(ALLOCATION_TAG);
+    auto httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, URI("http://www.uri.com"), HttpMethod::HTTP_PUT);
+    httpRequest->SetPayloadDigests(payloadDigests);
+    awsClient.InvokeBuildHttpRequest(amazonWebServiceRequest, httpRequest);
+    ASSERT_TRUE(payloadDigests->Has(Utils::Crypto::PayloadDigests::SHA256_DIGEST));
+
+    AWS_END_MEMORY_TEST
+}
+
 TEST(AWSClientTest, TestHostHeaderOverride)
 {
     AWS_BEGIN_MEMORY_TEST(16, 10);
@@ -192,3 +289,218 @@ TEST(AWSClientTest, TestHostHeaderOverride)
 
     AWS_END_MEMORY_TEST
 }
+
+TEST(AWSClientTest, TestRequestPayloadSigningModeOverridesClient)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10);
+
+    ClientConfiguration configuration;
+    configuration.payloadSigningMode = PayloadSigningMode::UNSIGNED_OVER_HTTPS;
+    AccessViolatingAWSClient awsClient(configuration);
+
+    AmazonWebServiceRequestMock amazonWebServiceRequest;
+    URI uri("https://www.uri.com");
+    auto httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, uri, HttpMethod::HTTP_PUT);
+    awsClient.InvokeBuildHttpRequest(amazonWebServiceRequest, httpRequest);
+    ASSERT_EQ(PayloadSigningMode::UNSIGNED_OVER_HTTPS, httpRequest->GetPayloadSigningMode());
+
+    amazonWebServiceRequest.SetPayloadSigningMode(PayloadSigningMode::SIGNED);
+    httpRequest = Aws::MakeShared<Standard::StandardHttpRequest>(ALLOCATION_TAG, uri, HttpMethod::HTTP_PUT);
+    awsClient.InvokeBuildHttpRequest(amazonWebServiceRequest, httpRequest);
+    ASSERT_EQ(PayloadSigningMode::SIGNED, httpRequest->GetPayloadSigningMode());
+
+    AWS_END_MEMORY_TEST
+}
+
+/**
+ * Submits its one operation the way the generated clients do.
+ */
+class ExecutorBackedClient
+{
+public:
+    typedef Aws::Utils::Outcome<Aws::String, AWSError<CoreErrors>> EchoOutcome;
+    typedef std::function<void(const ExecutorBackedClient*, const Aws::String&, const EchoOutcome&,
+        const std::shared_ptr<const AsyncCallerContext>&)> EchoResponseReceivedHandler;
+
+    ExecutorBackedClient(Aws::Utils::Threading::Executor& executor) : m_executor(&executor) {}
+
+    EchoOutcome Echo(const Aws::String& request) const { return EchoOutcome(request); }
+
+    std::future<EchoOutcome> EchoCallable(Aws::String&& request) const
+    {
+        return m_executor->SubmitWithFuture(&ExecutorBackedClient::Echo, Aws::Client::RejectedCallOutcome<EchoOutcome>(), this, std::move(request));
+    }
+
+    void EchoAsync(Aws::String&& request, const EchoResponseReceivedHandler& handler, const std::shared_ptr<const AsyncCallerContext>& context) const
+    {
+        m_executor->SubmitOrReject(&ExecutorBackedClient::EchoAsyncHelper, Aws::Client::RejectedAsyncCall<EchoOutcome>(), this, std::move(request), handler, context);
+    }
+
+private:
+    void EchoAsyncHelper(const Aws::String& request, const EchoResponseReceivedHandler& handler, const std::shared_ptr<const AsyncCallerContext>& context) const
+    {
+        handler(this, request, Echo(request), context);
+    }
+
+    Aws::Utils::Threading::Executor* m_executor;
+};
+
+TEST(AWSClientTest, TestCallsRejectedByTheExecutorCompleteWithAnError)
+{
+    Aws::Utils::Threading::PooledThreadExecutor executor(1);
+    executor.Shutdown();
+    ExecutorBackedClient client(executor);
+
+    auto outcome = client.EchoCallable("hello").get();
+    ASSERT_FALSE(outcome.IsSuccess());
+    ASSERT_EQ(ExecutorRejectedError().GetExceptionName(), outcome.GetError().GetExceptionName());
+
+    unsigned calls = 0;
+    auto context = Aws::MakeShared<AsyncCallerContext>(ALLOCATION_TAG, "rejected");
+    client.EchoAsync("hello", [&](const ExecutorBackedClient* caller, const Aws::String& request, const ExecutorBackedClient::EchoOutcome& asyncOutcome,
+        const std::shared_ptr<const AsyncCallerContext>& callerContext)
+    {
+        ++calls;
+        ASSERT_EQ(&client, caller);
+        //the handler still gets the request it was called with, moved in or not.
+        ASSERT_EQ("hello", request);
+        ASSERT_FALSE(asyncOutcome.IsSuccess());
+        ASSERT_EQ(CoreErrors::INTERNAL_FAILURE, asyncOutcome.GetError().GetErrorType());
+        ASSERT_EQ(context, callerContext);
+    }, context);
+    //on the calling thread, before EchoAsync returned.
+    ASSERT_EQ(1u, calls);
+}
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+class HookedAWSClient : public AccessViolatingAWSClient
+{
+public:
+    HookedAWSClient(const ClientConfiguration& configuration, const std::shared_ptr<AWSAuthSigner>& signer) :
+        AccessViolatingAWSClient(configuration, signer)
+    {
+    }
+
+protected:
+    using AWSClient::BuildHttpRequest;
+
+    void BuildHttpRequest(const AmazonWebServiceRequest& request, const PreparedRequest& preparedRequest,
+        const std::shared_ptr<HttpRequest>& httpRequest) const override
+    {
+        AWSClient::BuildHttpRequest(request, preparedRequest, httpRequest);
+        httpRequest->SetHeaderValue("x-amz-hooked", "true");
+    }
+};
+
+TEST(AWSClientTest, TestAttemptsAreBuiltThroughTheVirtualHook)
+{
+    MockHttpServer server([](const MockHttpServer::Request& request)
+    {
+        return MockHttpServer::MakeResponse(request.headers.count("x-amz-hooked") ? 200 : 400, "");
+    });
+    ASSERT_TRUE(server.IsRunning());
+
+    ClientConfiguration configuration;
+    configuration.scheme = Scheme::HTTP;
+    configuration.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(ALLOCATION_TAG, 0, 1);
+    auto credentialsProvider = Aws::MakeShared<Auth::SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "accessKey", "secretKey");
+    HookedAWSClient awsClient(configuration, Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, credentialsProvider, "service", "us-east-1"));
+
+    AmazonWebServiceRequestMock amazonWebServiceRequest;
+    auto outcome = awsClient.InvokeAttemptExhaustively("http://" + server.GetEndpoint() + "/hook", amazonWebServiceRequest, HttpMethod::HTTP_POST);
+    ASSERT_TRUE(outcome.IsSuccess());
+}
+
+TEST(AWSClientTest, TestRetriesReuseThePreparedBody)
+{
+    std::mutex receivedMutex;
+    Aws::Vector<MockHttpServer::Request> received;
+    MockHttpServer server([&](const MockHttpServer::Request& request)
+    {
+        std::lock_guard<std::mutex> locker(receivedMutex);
+        received.push_back(request);
+        return MockHttpServer::MakeResponse(received.size() < 3 ? 503 : 200, "");
+    });
+    ASSERT_TRUE(server.IsRunning());
+
+    ClientConfiguration configuration;
+    configuration.scheme = Scheme::HTTP;
+    configuration.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(ALLOCATION_TAG, 3, 1);
+    auto credentialsProvider = Aws::MakeShared<Auth::SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "accessKey", "secretKey");
+    auto signer = Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, credentialsProvider, "service", "us-east-1");
+    AccessViolatingAWSClient awsClient(configuration, signer);
+
+    AmazonWebServiceRequestMock amazonWebServiceRequest;
+    amazonWebServiceRequest.SetComputeContentMd5(true);
+    HeaderValueCollection headerValues;
+    headerValues.emplace("x-amz-test", "value");
+    amazonWebServiceRequest.SetHeaders(headerValues);
+    auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *body << "test payload";
+    amazonWebServiceRequest.SetBody(body);
+
+    auto outcome = awsClient.InvokeAttemptExhaustively("http://" + server.GetEndpoint() + "/retry", amazonWebServiceRequest, HttpMethod::HTTP_POST);
+    ASSERT_TRUE(outcome.IsSuccess());
+
+    //three attempts, but the body and headers were only taken from the request once.
+    ASSERT_EQ(3u, received.size());
+    ASSERT_EQ(1, amazonWebServiceRequest.GetBodyCount());
+    ASSERT_EQ(1, amazonWebServiceRequest.GetHeadersCount());
+
+    //every attempt sent the whole body again.
+    Aws::String contentMd5 = Utils::HashingUtils::Base64Encode(Utils::HashingUtils::CalculateMD5("test payload"));
+    for (const auto& request : received)
+    {
+        ASSERT_EQ("test payload", request.body);
+        ASSERT_EQ("12", request.headers.at("content-length"));
+        ASSERT_EQ(contentMd5, request.headers.at("content-md5"));
+        ASSERT_EQ("value", request.headers.at("x-amz-test"));
+        ASSERT_EQ(0u, request.headers.at("authorization").find("AWS4-HMAC-SHA256"));
+    }
+}
+
+TEST(AWSClientTest, TestPartUploadIsSentFromItsBuffer)
+{
+    static const size_t PART_SIZE = 5 * 1024 * 1024;
+
+    std::mutex receivedMutex;
+    Aws::Vector<MockHttpServer::Request> received;
+    MockHttpServer server([&](const MockHttpServer::Request& request)
+    {
+        std::lock_guard<std::mutex> locker(receivedMutex);
+        received.push_back(request);
+        return MockHttpServer::MakeResponse(200, "");
+    });
+    ASSERT_TRUE(server.IsRunning());
+
+    ClientConfiguration configuration;
+    configuration.scheme = Scheme::HTTP;
+    auto credentialsProvider = Aws::MakeShared<Auth::SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "accessKey", "secretKey");
+    AccessViolatingAWSClient awsClient(configuration, Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG, credentialsProvider, "s3", "us-east-1"));
+
+    //the way the transfer manager uploads a part: the stream is a view of the buffer the part was read into.
+    Aws::Vector<char> part(PART_SIZE);
+    for (size_t i = 0; i < part.size(); ++i)
+    {
+        part[i] = static_cast<char>('a' + i % 26);
+    }
+    AmazonWebServiceRequestMock amazonWebServiceRequest;
+    amazonWebServiceRequest.SetComputeContentMd5(true);
+    amazonWebServiceRequest.SetBody(Aws::MakeShared<Utils::Stream::PreallocatedIOStream>(ALLOCATION_TAG, part.data(), part.size()));
+
+    auto outcome = awsClient.InvokeAttemptExhaustively("http://" + server.GetEndpoint() + "/bucket/key?partNumber=1&uploadId=upload",
+        amazonWebServiceRequest, HttpMethod::HTTP_PUT);
+    ASSERT_TRUE(outcome.IsSuccess());
+
+    ASSERT_EQ(1u, received.size());
+    const auto& request = received.front();
+    ASSERT_EQ("PUT", request.method);
+    ASSERT_EQ("5242880", request.headers.at("content-length"));
+    ASSERT_EQ(0u, request.headers.count("transfer-encoding"));
+    ASSERT_EQ(Utils::HashingUtils::Base64Encode(Utils::HashingUtils::CalculateMD5(Aws::String(part.data(), part.size()))),
+        request.headers.at("content-md5"));
+    ASSERT_TRUE(request.body == Aws::String(part.data(), part.size()));
+}
+
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
@@ -0,0 +1,91 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/threading/Coroutines.h>
+
+//the sdk builds as C++11, these are built by runCoreCoroutineTests only when the compiler supports coroutines.
+#ifndef AWS_CORE_COROUTINES
+#error "the coroutine tests have to be built as C++20"
+#endif
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/threading/PooledThreadExecutor.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+static int SlowSquare(int value)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    return value * value;
+}
+
+static Task<int> SumOfSquares(Executor& executor, int first, int second)
+{
+    //both are in flight before either is awaited.
+    auto firstSquare = MakeAwaitable(executor, &SlowSquare, first);
+    auto secondSquare = MakeAwaitable(executor, &SlowSquare, second);
+    int sum = co_await firstSquare;
+    sum += co_await secondSquare;
+    co_return sum;
+}
+
+TEST(CoroutinesTest, TestAwaitOperationsStartedTogether)
+{
+    PooledThreadExecutor executor(2);
+    ASSERT_EQ(25, SumOfSquares(executor, 3, 4).Get());
+}
+
+static Task<> ResumeOnExecutor(Executor& executor, Executor& resumeExecutor, std::thread::id* resumedOn, std::thread::id* resumeExecutorThread)
+{
+    *resumeExecutorThread = co_await MakeAwaitable(resumeExecutor, []() { return std::this_thread::get_id(); });
+    co_await MakeAwaitable(executor, &SlowSquare, 2).ResumeOn(resumeExecutor);
+    *resumedOn = std::this_thread::get_id();
+}
+
+TEST(CoroutinesTest, TestResumeOnPicksTheResumingExecutor)
+{
+    //the operation's worker hands the coroutine to resumeExecutor, so resumeExecutor has to be torn down last.
+    PooledThreadExecutor resumeExecutor(1);
+    PooledThreadExecutor executor(1);
+    std::thread::id resumedOn;
+    std::thread::id resumeExecutorThread;
+    ResumeOnExecutor(executor, resumeExecutor, &resumedOn, &resumeExecutorThread).Get();
+    ASSERT_EQ(resumeExecutorThread, resumedOn);
+}
+
+static Task<int> Nested(Executor& executor)
+{
+    int sum = co_await SumOfSquares(executor, 1, 2);
+    co_return sum + co_await SumOfSquares(executor, 2, 3);
+}
+
+TEST(CoroutinesTest, TestTasksAwaitOtherTasks)
+{
+    PooledThreadExecutor executor(2);
+    ASSERT_EQ(18, Nested(executor).Get());
+}
+
+TEST(CoroutinesTest, TestRejectedOperationRunsOnTheCaller)
+{
+    PooledThreadExecutor executor(1);
+    executor.Shutdown();
+
+    auto awaitable = MakeAwaitable(executor, &SlowSquare, 5);
+    ASSERT_TRUE(awaitable.await_ready());
+    ASSERT_EQ(25, awaitable.await_resume());
+}
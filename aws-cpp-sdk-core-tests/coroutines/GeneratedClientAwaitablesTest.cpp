@@ -0,0 +1,38 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/sts/STSClient.h>
+
+//a generated client header, built with the awaitable operations its templates emit under C++20.
+#ifndef AWS_CORE_COROUTINES
+#error "the coroutine tests have to be built as C++20"
+#endif
+
+#include <aws/external/gtest.h>
+
+#include <type_traits>
+#include <utility>
+
+using namespace Aws::STS;
+using namespace Aws::Utils::Threading;
+
+TEST(GeneratedClientAwaitablesTest, TestOperationsHaveAwaitableForms)
+{
+    typedef decltype(std::declval<const STSClient&>().AssumeRoleAwaitable(std::declval<const Model::AssumeRoleRequest&>())) CopyingAwaitable;
+    typedef decltype(std::declval<const STSClient&>().AssumeRoleAwaitable(std::declval<Model::AssumeRoleRequest>())) MovingAwaitable;
+    static_assert(std::is_same<OperationAwaitable<Model::AssumeRoleOutcome>, CopyingAwaitable>::value, "awaits the operation's outcome");
+    static_assert(std::is_same<OperationAwaitable<Model::AssumeRoleOutcome>, MovingAwaitable>::value, "awaits the operation's outcome");
+    SUCCEED();
+}
@@ -0,0 +1,209 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+#include <aws/external/gtest.h>
+#include <aws/testing/mocks/http/MockHttpServer.h>
+
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/curl/CurlHandleContainer.h>
+#include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+
+#include <future>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+
+static const char* ENDPOINT_A = "https://a.example.com:443";
+static const char* ENDPOINT_B = "https://b.example.com:443";
+
+TEST(CurlHandleContainerTest, TestHandlesArePooledPerEndpoint)
+{
+    CurlHandleContainer container(4);
+
+    CURL* handleA = container.AcquireCurlHandle(ENDPOINT_A);
+    ASSERT_NE(nullptr, handleA);
+    container.ReleaseCurlHandle(handleA, ENDPOINT_A);
+
+    CURL* handleB = container.AcquireCurlHandle(ENDPOINT_B);
+    ASSERT_NE(handleA, handleB);
+
+    ASSERT_EQ(handleA, container.AcquireCurlHandle(ENDPOINT_A));
+
+    CurlHandlePoolStats stats = container.GetStats();
+    ASSERT_EQ(1u, stats.hits);
+    ASSERT_EQ(2u, stats.misses);
+    ASSERT_EQ(2u, stats.poolSize);
+
+    container.ReleaseCurlHandle(handleA, ENDPOINT_A);
+    container.ReleaseCurlHandle(handleB, ENDPOINT_B);
+}
+
+TEST(CurlHandleContainerTest, TestFullPoolTakesIdleHandleFromOtherEndpoint)
+{
+    CurlHandleContainer container(1);
+
+    CURL* handle = container.AcquireCurlHandle(ENDPOINT_A);
+    container.ReleaseCurlHandle(handle, ENDPOINT_A);
+
+    ASSERT_EQ(handle, container.AcquireCurlHandle(ENDPOINT_B));
+    ASSERT_EQ(1u, container.GetStats().poolSize);
+    container.ReleaseCurlHandle(handle, ENDPOINT_B);
+}
+
+TEST(CurlHandleContainerTest, TestAcquireBlocksUntilRelease)
+{
+    CurlHandleContainer container(1);
+    CURL* handle = container.AcquireCurlHandle(ENDPOINT_A);
+
+    std::future<CURL*> waiter = std::async(std::launch::async, [&container] { return container.AcquireCurlHandle(ENDPOINT_A); });
+    ASSERT_EQ(std::future_status::timeout, waiter.wait_for(std::chrono::milliseconds(100)));
+
+    container.ReleaseCurlHandle(handle, ENDPOINT_A);
+    ASSERT_EQ(handle, waiter.get());
+
+    CurlHandlePoolStats stats = container.GetStats();
+    ASSERT_EQ(1u, stats.waits);
+    ASSERT_LT(0u, stats.waitTimeMicroseconds);
+    container.ReleaseCurlHandle(handle, ENDPOINT_A);
+}
+
+TEST(CurlHandleContainerTest, TestIdleHandlesAreReaped)
+{
+    CurlHandleContainer container(4, 3000, 1000, 50);
+    container.ReleaseCurlHandle(container.AcquireCurlHandle(ENDPOINT_A), ENDPOINT_A);
+    ASSERT_EQ(1u, container.GetStats().poolSize);
+
+    for (unsigned i = 0; i < 100 && container.GetStats().poolSize > 0; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    }
+
+    CurlHandlePoolStats stats = container.GetStats();
+    ASSERT_EQ(0u, stats.poolSize);
+    ASSERT_EQ(1u, stats.reaped);
+}
+
+TEST(CurlHandleContainerTest, TestShareHandleIsProcessWide)
+{
+    CurlHandleContainer first;
+    CurlHandleContainer second;
+
+    CURLSH* share = CurlHandleContainer::AcquireShareHandle();
+    ASSERT_NE(nullptr, share);
+    ASSERT_EQ(share, CurlHandleContainer::AcquireShareHandle());
+    CurlHandleContainer::ReleaseShareHandle();
+    CurlHandleContainer::ReleaseShareHandle();
+}
+
+static size_t DiscardBody(char*, size_t size, size_t nmemb, void*)
+{
+    return size * nmemb;
+}
+
+static CURLcode PerformGet(CURL* handle, const Aws::String& url, struct curl_slist* resolve)
+{
+    curl_easy_setopt(handle, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, &DiscardBody);
+    curl_easy_setopt(handle, CURLOPT_RESOLVE, resolve);
+    return curl_easy_perform(handle);
+}
+
+TEST(CurlHandleContainerTest, TestDnsLookupsAreSharedAcrossContainers)
+{
+    MockHttpServer server([](const MockHttpServer::Request&) { return MockHttpServer::MakeResponse(200, "ok"); });
+    ASSERT_TRUE(server.IsRunning());
+
+    //the name only resolves through the entry the first handle puts into the dns cache, so the second handle,
+    //from another container, can only reach the server if that cache is shared.
+    Aws::StringStream hostAndPort;
+    hostAndPort << "shared-dns.invalid:" << server.GetPort();
+    Aws::String url = "http://" + hostAndPort.str() + "/";
+    struct curl_slist* resolve = curl_slist_append(nullptr, (hostAndPort.str() + ":127.0.0.1").c_str());
+
+    CurlHandleContainer first;
+    CurlHandleContainer second;
+    CURL* firstHandle = first.AcquireCurlHandle(ENDPOINT_A);
+    CURL* secondHandle = second.AcquireCurlHandle(ENDPOINT_A);
+
+    ASSERT_EQ(CURLE_OK, PerformGet(firstHandle, url, resolve));
+    ASSERT_EQ(CURLE_OK, PerformGet(secondHandle, url, nullptr));
+    ASSERT_EQ(2u, server.GetRequestCount());
+
+    first.ReleaseCurlHandle(firstHandle, ENDPOINT_A);
+    second.ReleaseCurlHandle(secondHandle, ENDPOINT_A);
+    curl_slist_free_all(resolve);
+}
+
+TEST(CurlHandleContainerTest, TestClientsSharingCachesTalkToSameHost)
+{
+    MockHttpServer server([](const MockHttpServer::Request&) { return MockHttpServer::MakeResponse(200, "ok"); });
+    ASSERT_TRUE(server.IsRunning());
+
+    ClientConfiguration config;
+    CurlHttpClient firstClient(config);
+    CurlHttpClient secondClient(config);
+
+    Aws::StringStream uri;
+    uri << "http://localhost:" << server.GetPort();
+    for (const CurlHttpClient* client : { &firstClient, &secondClient })
+    {
+        auto request = HttpClientFactory().CreateHttpRequest(uri.str(), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        auto response = client->MakeRequest(*request);
+        ASSERT_NE(nullptr, response);
+        ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+    }
+}
+
+TEST(CurlHandleContainerTest, TestPrewarmedConnectionsAreReused)
+{
+    //no body on HEAD, or curl can't keep the connection.
+    MockHttpServer server([](const MockHttpServer::Request& request) { return MockHttpServer::MakeResponse(200, request.method == "HEAD" ? "" : "ok"); });
+    ASSERT_TRUE(server.IsRunning());
+
+    ClientConfiguration config;
+    config.maxConnections = 4;
+    CurlHttpClient client(config);
+
+    URI endpoint("http://" + server.GetEndpoint());
+    ASSERT_EQ(2u, client.Prewarm(endpoint, 2));
+    ASSERT_EQ(2u, server.GetRequestCount());
+    ASSERT_EQ(2u, server.GetConnectionCount());
+
+    for (unsigned i = 0; i < 2; ++i)
+    {
+        auto request = HttpClientFactory().CreateHttpRequest(endpoint, HttpMethod::HTTP_POST, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+        auto body = Aws::MakeShared<Aws::StringStream>("CurlHandleContainerTest");
+        *body << "payload";
+        request->AddContentBody(body);
+        request->SetContentLength("7");
+        auto response = client.MakeRequest(*request);
+        ASSERT_NE(nullptr, response);
+        ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+    }
+
+    //both requests went out over a prewarmed connection, and the POST left nothing behind that broke the following request.
+    ASSERT_EQ(2u, server.GetConnectionCount());
+    CurlHandlePoolStats stats = client.GetConnectionPoolStats();
+    ASSERT_EQ(2u, stats.hits);
+    ASSERT_EQ(2u, stats.poolSize);
+}
+
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
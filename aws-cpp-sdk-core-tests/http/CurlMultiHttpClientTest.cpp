@@ -0,0 +1,173 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+#include <aws/external/gtest.h>
+#include <aws/testing/mocks/http/MockHttpServer.h>
+
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+
+#include <condition_variable>
+#include <future>
+#include <mutex>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+
+static const char* ALLOCATION_TAG = "CurlMultiHttpClientTest";
+
+static Aws::String EchoHandler(const MockHttpServer::Request& request)
+{
+    return MockHttpServer::MakeResponse(200, request.method + " " + request.uri + " " + request.body);
+}
+
+static std::shared_ptr<HttpRequest> CreateRequest(const MockHttpServer& server, const Aws::String& path, HttpMethod method = HttpMethod::HTTP_GET)
+{
+    Aws::String uri = "http://" + server.GetEndpoint() + path;
+    return HttpClientFactory().CreateHttpRequest(uri, method, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+}
+
+static Aws::String ReadBody(const std::shared_ptr<HttpResponse>& response)
+{
+    Aws::StringStream ss;
+    ss << response->GetResponseBody().rdbuf();
+    return ss.str();
+}
+
+//some platforms build without rtti, so tell the clients apart by whether completion handlers run off the calling thread.
+static bool CompletesOnIoThread(const HttpClient& client, const MockHttpServer& server)
+{
+    std::promise<std::thread::id> completionThread;
+    client.MakeRequestAsync(CreateRequest(server, "/thread"), [&completionThread](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>&)
+    {
+        completionThread.set_value(std::this_thread::get_id());
+    });
+    return completionThread.get_future().get() != std::this_thread::get_id();
+}
+
+TEST(CurlMultiHttpClientTest, TestFactoryReturnsMultiClient)
+{
+    MockHttpServer server(EchoHandler);
+    ASSERT_TRUE(server.IsRunning());
+
+    ClientConfiguration config;
+    ASSERT_FALSE(CompletesOnIoThread(*HttpClientFactory().CreateHttpClient(config), server));
+
+    config.httpLibOverride = TransferLibType::CURL_MULTI_CLIENT;
+    ASSERT_TRUE(CompletesOnIoThread(*HttpClientFactory().CreateHttpClient(config), server));
+}
+
+TEST(CurlMultiHttpClientTest, TestSynchronousRequest)
+{
+    MockHttpServer server(EchoHandler);
+    ASSERT_TRUE(server.IsRunning());
+
+    ClientConfiguration config;
+    CurlMultiHttpClient client(config);
+
+    auto request = CreateRequest(server, "/sync", HttpMethod::HTTP_POST);
+    auto body = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *body << "payload";
+    request->AddContentBody(body);
+    request->SetContentLength("7");
+
+    auto response = client.MakeRequest(*request);
+    ASSERT_NE(nullptr, response);
+    ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+    ASSERT_EQ("POST /sync payload", ReadBody(response));
+}
+
+static unsigned RunConcurrentAsyncRequests(const HttpClient& client, const MockHttpServer& server, unsigned requestCount)
+{
+    std::mutex completionMutex;
+    std::condition_variable completionSignal;
+    unsigned completed = 0;
+    unsigned succeeded = 0;
+
+    for (unsigned i = 0; i < requestCount; ++i)
+    {
+        Aws::StringStream path;
+        path << "/async/" << i;
+        auto request = CreateRequest(server, path.str());
+        Aws::String expected = "GET " + path.str() + " ";
+
+        client.MakeRequestAsync(request, [&, expected](const std::shared_ptr<HttpRequest>& completedRequest, const std::shared_ptr<HttpResponse>& response)
+        {
+            bool matched = completedRequest && response && response->GetResponseCode() == HttpResponseCode::OK && ReadBody(response) == expected;
+
+            std::lock_guard<std::mutex> locker(completionMutex);
+            ++completed;
+            succeeded += matched ? 1 : 0;
+            completionSignal.notify_all();
+        });
+    }
+
+    std::unique_lock<std::mutex> locker(completionMutex);
+    completionSignal.wait_for(locker, std::chrono::seconds(30), [&] { return completed == requestCount; });
+    return succeeded;
+}
+
+TEST(CurlMultiHttpClientTest, TestManyConcurrentAsyncRequests)
+{
+    MockHttpServer server(EchoHandler);
+    ASSERT_TRUE(server.IsRunning());
+
+    ClientConfiguration config;
+    config.ioThreads = 2;
+    config.maxConnections = 4;
+    CurlMultiHttpClient client(config);
+
+    ASSERT_EQ(50u, RunConcurrentAsyncRequests(client, server, 50));
+}
+
+TEST(CurlMultiHttpClientTest, TestHttp2MultiplexingFallsBackToHttp11)
+{
+    MockHttpServer server(EchoHandler);
+    ASSERT_TRUE(server.IsRunning());
+
+    ClientConfiguration config;
+    config.enableHttp2Multiplexing = true;
+    config.maxStreamsPerConnection = 10;
+    auto client = HttpClientFactory().CreateHttpClient(config);
+    ASSERT_TRUE(CompletesOnIoThread(*client, server));
+
+    //the mock server only speaks http/1.1 in clear text, so every request has to come back over the fallback path.
+    ASSERT_EQ(20u, RunConcurrentAsyncRequests(*client, server, 20));
+}
+
+TEST(CurlMultiHttpClientTest, TestConnectionFailureCompletesWithNullResponse)
+{
+    unsigned short closedPort = 0;
+    {
+        MockHttpServer server(EchoHandler);
+        closedPort = server.GetPort();
+    }
+
+    ClientConfiguration config;
+    CurlMultiHttpClient client(config);
+
+    Aws::StringStream uri;
+    uri << "http://127.0.0.1:" << closedPort << "/refused";
+    auto request = HttpClientFactory().CreateHttpRequest(uri.str(), HttpMethod::HTTP_GET, Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    ASSERT_EQ(nullptr, client.MakeRequest(*request));
+}
+
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
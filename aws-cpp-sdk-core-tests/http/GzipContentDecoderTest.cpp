@@ -0,0 +1,304 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#ifdef ENABLE_ZLIB
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/http/GzipContentDecoder.h>
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+#include <aws/testing/mocks/http/MockHttpServer.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/StreamingResponseConsumer.h>
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+#include <aws/core/utils/crypto/CRC32.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+#include <zlib.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace Aws::Http;
+
+static Aws::String Compress(const Aws::String& input, int windowBits)
+{
+    z_stream stream;
+    memset(&stream, 0, sizeof(stream));
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, windowBits, 8, Z_DEFAULT_STRATEGY);
+
+    Aws::String output(deflateBound(&stream, static_cast<uLong>(input.size())) + 32, '\0');
+    stream.next_in = reinterpret_cast<Bytef*>(const_cast<char*>(input.data()));
+    stream.avail_in = static_cast<uInt>(input.size());
+    stream.next_out = reinterpret_cast<Bytef*>(&output[0]);
+    stream.avail_out = static_cast<uInt>(output.size());
+    deflate(&stream, Z_FINISH);
+    output.resize(stream.total_out);
+    deflateEnd(&stream);
+    return output;
+}
+
+static Aws::String Gzip(const Aws::String& input)
+{
+    //16 on top of the window bits asks for a gzip wrapper instead of a zlib one.
+    return Compress(input, 15 + 16);
+}
+
+static Aws::String MakeJsonPage(size_t items)
+{
+    Aws::String page = "{\"Items\":[";
+    for (size_t i = 0; i < items; ++i)
+    {
+        page += i ? "," : "";
+        page += "{\"id\":{\"S\":\"item-" + Aws::Utils::StringUtils::to_string(i) + "\"},\"status\":{\"S\":\"ACTIVE\"}}";
+    }
+    return page + "]}";
+}
+
+TEST(GzipContentDecoderTest, TestDecodeInSmallChunks)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    {
+        Aws::String original = MakeJsonPage(2000);
+        Aws::String compressed = Gzip(original);
+        ASSERT_LT(compressed.size() * 4, original.size());
+
+        GzipContentDecoder decoder;
+        Aws::String decoded;
+        for (size_t offset = 0; offset < compressed.size(); offset += 7)
+        {
+            size_t length = compressed.size() - offset < 7 ? compressed.size() - offset : 7;
+            ASSERT_TRUE(decoder.Decode(compressed.data() + offset, length, decoded));
+        }
+
+        ASSERT_TRUE(decoder.IsComplete());
+        ASSERT_EQ(original, decoded);
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(GzipContentDecoderTest, TestDeflateAndConcatenatedMembers)
+{
+    Aws::String original = MakeJsonPage(50);
+
+    GzipContentDecoder zlibDecoder;
+    Aws::String decoded;
+    Aws::String zlibWrapped = Compress(original, 15);
+    ASSERT_TRUE(zlibDecoder.Decode(zlibWrapped.data(), zlibWrapped.size(), decoded));
+    ASSERT_EQ(original, decoded);
+
+    GzipContentDecoder gzipDecoder;
+    decoded.clear();
+    Aws::String twoMembers = Gzip("first,") + Gzip("second");
+    ASSERT_TRUE(gzipDecoder.Decode(twoMembers.data(), twoMembers.size(), decoded));
+    ASSERT_EQ("first,second", decoded);
+}
+
+TEST(GzipContentDecoderTest, TestCorruptInputFails)
+{
+    Aws::String compressed = Gzip(MakeJsonPage(50));
+    compressed[compressed.size() / 2] ^= 0x5a;
+    compressed[compressed.size() / 2 + 1] ^= 0xa5;
+
+    GzipContentDecoder decoder;
+    Aws::String decoded;
+    ASSERT_FALSE(decoder.Decode(compressed.data(), compressed.size(), decoded) && decoder.IsComplete());
+
+    ASSERT_TRUE(GzipContentDecoder::CanDecode(" GZIP "));
+    ASSERT_TRUE(GzipContentDecoder::CanDecode("deflate"));
+    ASSERT_FALSE(GzipContentDecoder::CanDecode("br"));
+}
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+static Aws::String GzipWhenAccepted(const MockHttpServer::Request& request, const Aws::String& body)
+{
+    auto acceptEncoding = request.headers.find("accept-encoding");
+    if (acceptEncoding == request.headers.end() || acceptEncoding->second.find("gzip") == Aws::String::npos)
+    {
+        return MockHttpServer::MakeResponse(200, body);
+    }
+
+    Aws::Map<Aws::String, Aws::String> headers;
+    headers["Content-Encoding"] = "gzip";
+    return MockHttpServer::MakeResponse(200, Gzip(body), headers);
+}
+
+static Aws::String ReadBody(const std::shared_ptr<HttpResponse>& response)
+{
+    Aws::StringStream ss;
+    ss << response->GetResponseBody().rdbuf();
+    return ss.str();
+}
+
+static void VerifyCompressedResponse(const HttpClient& client, const MockHttpServer& server, const Aws::String& expected)
+{
+    auto request = HttpClientFactory().CreateHttpRequest("http://" + server.GetEndpoint() + "/query", HttpMethod::HTTP_POST,
+        Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    auto response = client.MakeRequest(*request);
+    ASSERT_NE(nullptr, response);
+    ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+    ASSERT_EQ("gzip", response->GetHeader("content-encoding"));
+    ASSERT_EQ(expected, ReadBody(response));
+}
+
+TEST(GzipContentDecoderTest, TestCurlClientsInflateWhenEnabled)
+{
+    Aws::String body = MakeJsonPage(5000);
+    MockHttpServer server([&body](const MockHttpServer::Request& request) { return GzipWhenAccepted(request, body); });
+    ASSERT_TRUE(server.IsRunning());
+
+    Aws::Client::ClientConfiguration config;
+    config.enableResponseCompression = true;
+    VerifyCompressedResponse(*HttpClientFactory().CreateHttpClient(config), server, body);
+    CurlMultiHttpClient multiClient(config);
+    VerifyCompressedResponse(multiClient, server, body);
+}
+
+TEST(GzipContentDecoderTest, TestCurlClientDoesNotAskForCompressionByDefault)
+{
+    Aws::String body = MakeJsonPage(10);
+    MockHttpServer server([&body](const MockHttpServer::Request& request) { return GzipWhenAccepted(request, body); });
+    ASSERT_TRUE(server.IsRunning());
+
+    Aws::Client::ClientConfiguration config;
+    auto request = HttpClientFactory().CreateHttpRequest("http://" + server.GetEndpoint() + "/query", HttpMethod::HTTP_POST,
+        Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    auto response = HttpClientFactory().CreateHttpClient(config)->MakeRequest(*request);
+    ASSERT_NE(nullptr, response);
+    ASSERT_FALSE(response->HasHeader("content-encoding"));
+    ASSERT_EQ(body, ReadBody(response));
+}
+
+/**
+ * Pauses on every other chunk; the paused chunk has to come back exactly once, already inflated.
+ */
+class AlternatelyPausingConsumer : public StreamingResponseConsumer
+{
+public:
+    AlternatelyPausingConsumer() : m_pauseNext(true) {}
+
+    StreamingConsumerAction OnDataReceived(const HttpResponse&, const char* data, std::size_t length) override
+    {
+        m_pauseNext = !m_pauseNext;
+        if (!m_pauseNext)
+        {
+            return StreamingConsumerAction::PAUSE;
+        }
+        m_body.append(data, length);
+        return StreamingConsumerAction::CONTINUE;
+    }
+
+    Aws::String m_body;
+
+private:
+    bool m_pauseNext;
+};
+
+TEST(GzipContentDecoderTest, TestPausedConsumerSeesInflatedBodyOnce)
+{
+    Aws::String body = MakeJsonPage(20000);
+    MockHttpServer server([&body](const MockHttpServer::Request& request) { return GzipWhenAccepted(request, body); });
+    ASSERT_TRUE(server.IsRunning());
+
+    Aws::Client::ClientConfiguration config;
+    config.enableResponseCompression = true;
+    config.requestTimeoutMs = 30000;
+    auto client = HttpClientFactory().CreateHttpClient(config);
+
+    auto consumer = Aws::MakeShared<AlternatelyPausingConsumer>("GzipContentDecoderTest");
+    auto request = HttpClientFactory().CreateHttpRequest("http://" + server.GetEndpoint() + "/query", HttpMethod::HTTP_POST,
+        Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    request->SetStreamingResponseConsumer(consumer);
+
+    std::atomic<bool> done(false);
+    std::thread resumer([&]()
+    {
+        while (!done)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if (consumer->IsPaused())
+            {
+                consumer->Resume();
+            }
+        }
+    });
+    auto response = client->MakeRequest(*request);
+    done = true;
+    resumer.join();
+
+    ASSERT_NE(nullptr, response);
+    ASSERT_EQ(body, consumer->m_body);
+}
+
+TEST(GzipContentDecoderTest, TestCrc32CoversCompressedBytes)
+{
+    Aws::String body = MakeJsonPage(20000);
+    Aws::String compressed = Gzip(body);
+    MockHttpServer server([&compressed](const MockHttpServer::Request&)
+    {
+        //like DynamoDB, the checksum is over the bytes sent, which are the compressed ones.
+        Aws::Map<Aws::String, Aws::String> headers;
+        headers["Content-Encoding"] = "gzip";
+        headers["x-amz-crc32"] = Aws::Utils::StringUtils::to_string(
+            Aws::Utils::Crypto::CRC32::Extend(0, reinterpret_cast<const unsigned char*>(compressed.data()), compressed.size()));
+        return MockHttpServer::MakeResponse(200, compressed, headers);
+    });
+    ASSERT_TRUE(server.IsRunning());
+
+    Aws::Client::ClientConfiguration config;
+    config.enableResponseCompression = true;
+    config.requestTimeoutMs = 30000;
+    auto client = HttpClientFactory().CreateHttpClient(config);
+    VerifyCompressedResponse(*client, server, body);
+
+    //a paused chunk comes back from curl a second time, it must not be checksummed twice.
+    auto consumer = Aws::MakeShared<AlternatelyPausingConsumer>("GzipContentDecoderTest");
+    auto request = HttpClientFactory().CreateHttpRequest("http://" + server.GetEndpoint() + "/query", HttpMethod::HTTP_POST,
+        Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    request->SetStreamingResponseConsumer(consumer);
+
+    std::atomic<bool> done(false);
+    std::thread resumer([&]()
+    {
+        while (!done)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if (consumer->IsPaused())
+            {
+                consumer->Resume();
+            }
+        }
+    });
+    auto response = client->MakeRequest(*request);
+    done = true;
+    resumer.join();
+
+    ASSERT_NE(nullptr, response);
+    ASSERT_EQ(body, consumer->m_body);
+    ASSERT_FALSE(response->HasChecksumMismatch());
+}
+
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+#endif // ENABLE_ZLIB
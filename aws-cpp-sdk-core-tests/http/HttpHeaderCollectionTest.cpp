@@ -0,0 +1,105 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpHeaderCollection.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+
+using namespace Aws::Http;
+
+TEST(HttpHeaderCollectionTest, TestCaseInsensitiveLookup)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    HttpHeaderCollection headers;
+    headers.Set("Content-Type", "application/xml");
+    headers.Set("X-Amz-Date", "20160101T000000Z");
+
+    ASSERT_EQ(2u, headers.size());
+    ASSERT_EQ("application/xml", *headers.Find("content-type"));
+    ASSERT_EQ("application/xml", *headers.Find("CONTENT-TYPE"));
+    ASSERT_EQ("20160101T000000Z", headers.GetValue("x-amz-date"));
+    ASSERT_TRUE(headers.Contains("X-AMZ-DATE"));
+    ASSERT_EQ(nullptr, headers.Find("content-length"));
+    ASSERT_EQ("", headers.GetValue("content-length"));
+    //a name that is a prefix of a stored one must not match it.
+    ASSERT_EQ(nullptr, headers.Find("content"));
+
+    headers.Set("CONTENT-type", "text/plain");
+    ASSERT_EQ(2u, headers.size());
+    ASSERT_EQ("text/plain", headers.GetValue("Content-Type"));
+
+    ASSERT_TRUE(headers.Erase("Content-TYPE"));
+    ASSERT_FALSE(headers.Erase("content-type"));
+    ASSERT_EQ(1u, headers.size());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(HttpHeaderCollectionTest, TestIteratesInSignedOrder)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    HttpHeaderCollection headers;
+    headers.Set("X-Amz-Meta-Zeta", "3");
+    headers.Set("host", "examplebucket.s3.amazonaws.com");
+    headers.Set("Content-MD5", "1");
+    headers.Set("x-amz-content-sha256", "2");
+
+    const char* expectedOrder[] = { "content-md5", "host", "x-amz-content-sha256", "x-amz-meta-zeta" };
+    size_t i = 0;
+    for (const auto& header : headers)
+    {
+        ASSERT_EQ(expectedOrder[i++], header.first);
+    }
+    ASSERT_EQ(4u, i);
+
+    HeaderValueCollection map = headers.ToMap();
+    ASSERT_EQ(4u, map.size());
+    ASSERT_EQ("3", map["x-amz-meta-zeta"]);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(HttpHeaderCollectionTest, TestRequestHeaderAccessDoesNotAllocate)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto request = HttpClientFactory().CreateHttpRequest(Aws::String("https://examplebucket.s3.amazonaws.com/key"), HttpMethod::HTTP_PUT,
+        Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    request->SetHeaderValue("Content-Type", "  binary/octet-stream ");
+    request->SetContentLength("1024");
+    ASSERT_EQ("binary/octet-stream", request->GetHeaderValue("content-type"));
+
+    bool hasHeader = false;
+    AWS_EXPECT_ALLOCATION_COUNT(0, hasHeader = request->HasHeader("CONTENT-LENGTH"));
+    ASSERT_TRUE(hasHeader);
+
+    size_t headerCount = 0;
+    AWS_EXPECT_ALLOCATION_COUNT(0, for (const auto& header : request->GetHeaderCollection()) { headerCount += header.first.empty() ? 0 : 1; });
+    ASSERT_EQ(3u, headerCount);
+
+    //replacing a value that fits in the existing string reuses it.
+    AWS_EXPECT_ALLOCATION_COUNT(0, request->SetContentLength("2048"));
+    AWS_EXPECT_ALLOCATION_COUNT(0, request->DeleteHeader("Content-Type"));
+    ASSERT_FALSE(request->HasHeader("content-type"));
+    ASSERT_EQ("2048", request->GetHeaderValue("Content-Length"));
+
+    AWS_END_MEMORY_TEST
+}
@@ -0,0 +1,167 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/http/HttpRequestBody.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+
+#include <cstring>
+
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils::Stream;
+
+static const char* ALLOCATION_TAG = "HttpRequestBodyTest";
+
+TEST(HttpRequestBodyTest, TestNullStreamHasNoBody)
+{
+    ASSERT_EQ(nullptr, HttpRequestBody::Create(nullptr));
+}
+
+TEST(HttpRequestBodyTest, TestPreallocatedStreamIsReadFromMemory)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    char data[] = "0123456789";
+    auto stream = Aws::MakeShared<PreallocatedIOStream>(ALLOCATION_TAG, data, 10);
+    stream->seekg(2);
+
+    auto body = HttpRequestBody::Create(stream);
+    ASSERT_EQ(8, body->GetLength());
+
+    //reads come straight from the caller's memory, nothing was copied when the body was created.
+    data[2] = 'X';
+    char buffer[5];
+    ASSERT_EQ(5u, body->Read(buffer, sizeof(buffer)));
+    ASSERT_EQ(0, memcmp("X3456", buffer, 5));
+    ASSERT_EQ(3u, body->Read(buffer, sizeof(buffer)));
+    ASSERT_EQ(0, memcmp("789", buffer, 3));
+    ASSERT_EQ(0u, body->Read(buffer, sizeof(buffer)));
+
+    //the length is fixed when first measured, not recomputed as the body is consumed.
+    ASSERT_EQ(8, body->GetLength());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(HttpRequestBodyTest, TestPreallocatedStreamSeeksLikeAStream)
+{
+    char data[] = "abcdef";
+    PreallocatedIOStream stream(data, 6);
+
+    stream.seekg(0, stream.end);
+    ASSERT_EQ(6, stream.tellg());
+    stream.seekg(-2, stream.cur);
+    ASSERT_EQ('e', stream.get());
+    stream.seekg(10);
+    ASSERT_TRUE(stream.fail());
+    stream.clear();
+
+    stream.seekp(1);
+    stream << "XY";
+    stream.seekg(0);
+    Aws::String content;
+    stream >> content;
+    ASSERT_EQ("aXYdef", content);
+}
+
+TEST(HttpRequestBodyTest, TestGenericStreamIsMeasuredOnce)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    auto stream = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *stream << "hello world";
+    stream->seekg(6);
+
+    auto body = HttpRequestBody::Create(stream);
+    ASSERT_EQ(5, body->GetLength());
+    ASSERT_EQ(6, stream->tellg());
+
+    char buffer[16];
+    ASSERT_EQ(5u, body->Read(buffer, sizeof(buffer)));
+    ASSERT_EQ(0, memcmp("world", buffer, 5));
+    ASSERT_EQ(5, body->GetLength());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(HttpRequestBodyTest, TestRequestSizeDoesNotMoveTheStream)
+{
+    auto stream = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *stream << "payload";
+    stream->seekg(3);
+
+    StandardHttpRequest request(URI("http://example.com/"), HttpMethod::HTTP_PUT);
+    request.AddContentBody(stream);
+    ASSERT_EQ(stream, request.GetRequestBody()->GetStream());
+
+    int64_t headerSize = Aws::String(HOST_HEADER).size() + Aws::String("example.com").size();
+    ASSERT_EQ(headerSize + 4, request.GetSize());
+    ASSERT_EQ(3, stream->tellg());
+}
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+#include <aws/testing/mocks/http/MockHttpServer.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpResponse.h>
+
+TEST(HttpRequestBodyTest, TestCurlUploadsBodiesWithKnownLength)
+{
+    MockHttpServer server([](const MockHttpServer::Request& request)
+    {
+        return MockHttpServer::MakeResponse(200, request.method + " " + request.body);
+    });
+    ASSERT_TRUE(server.IsRunning());
+
+    Aws::Client::ClientConfiguration config;
+    auto client = HttpClientFactory().CreateHttpClient(config);
+
+    char data[] = "contiguous body";
+    auto contiguous = Aws::MakeShared<PreallocatedIOStream>(ALLOCATION_TAG, data, strlen(data));
+    auto generic = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
+    *generic << "generic body";
+
+    for (auto method : { HttpMethod::HTTP_PUT, HttpMethod::HTTP_POST })
+    {
+        for (const std::shared_ptr<Aws::IOStream>& stream : { std::shared_ptr<Aws::IOStream>(contiguous), std::shared_ptr<Aws::IOStream>(generic) })
+        {
+            stream->seekg(0);
+            auto request = HttpClientFactory().CreateHttpRequest("http://" + server.GetEndpoint() + "/upload", method,
+                                                                 Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+            request->AddContentBody(stream);
+            Aws::StringStream contentLength;
+            contentLength << request->GetRequestBody()->GetLength();
+            request->SetContentLength(contentLength.str());
+
+            auto response = client->MakeRequest(*request);
+            ASSERT_NE(nullptr, response);
+
+            Aws::StringStream expected;
+            expected << HttpMethodMapper::GetNameForHttpMethod(method) << " " << (stream == generic ? "generic body" : data);
+            Aws::StringStream received;
+            received << response->GetResponseBody().rdbuf();
+            ASSERT_EQ(expected.str(), received.str());
+        }
+    }
+}
+
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
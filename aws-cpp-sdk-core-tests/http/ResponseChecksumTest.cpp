@@ -0,0 +1,166 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+#include <aws/testing/mocks/http/MockHttpServer.h>
+
+#include <aws/core/auth/AWSAuthSigner.h>
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/client/AWSClient.h>
+#include <aws/core/client/AWSError.h>
+#include <aws/core/client/AWSErrorMarshaller.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/client/CoreErrors.h>
+#include <aws/core/client/DefaultRetryStrategy.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/crypto/CRC32.h>
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+
+#include <atomic>
+
+using namespace Aws::Auth;
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Utils::Crypto;
+
+static const char* ALLOCATION_TAG = "ResponseChecksumTest";
+
+static Aws::String Crc32Of(const Aws::String& body)
+{
+    return Aws::Utils::StringUtils::to_string(CRC32::Extend(0, reinterpret_cast<const unsigned char*>(body.data()), body.size()));
+}
+
+static Aws::String RespondWithCrc32(const Aws::String& body, const Aws::String& crc32)
+{
+    Aws::Map<Aws::String, Aws::String> headers;
+    headers["x-amz-crc32"] = crc32;
+    return MockHttpServer::MakeResponse(200, body, headers);
+}
+
+static Aws::String MakeItems(size_t count)
+{
+    Aws::String items = "{\"Items\":[";
+    for (size_t i = 0; i < count; ++i)
+    {
+        items += i ? "," : "";
+        items += "{\"id\":{\"N\":\"" + Aws::Utils::StringUtils::to_string(i) + "\"}}";
+    }
+    return items + "]}";
+}
+
+static std::shared_ptr<HttpResponse> Get(const HttpClient& client, const MockHttpServer& server)
+{
+    auto request = HttpClientFactory().CreateHttpRequest("http://" + server.GetEndpoint() + "/", HttpMethod::HTTP_POST,
+        Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    return client.MakeRequest(*request);
+}
+
+TEST(ResponseChecksumTest, TestCurlClientsVerifyCrc32Header)
+{
+    Aws::String body = MakeItems(5000);
+    Aws::String crc32 = Crc32Of(body);
+    std::atomic<bool> corrupt(false);
+    MockHttpServer server([&](const MockHttpServer::Request&)
+    {
+        return RespondWithCrc32(body, corrupt ? Crc32Of(body + " ") : crc32);
+    });
+    ASSERT_TRUE(server.IsRunning());
+
+    ClientConfiguration config;
+    auto easyClient = HttpClientFactory().CreateHttpClient(config);
+    CurlMultiHttpClient multiClient(config);
+    const HttpClient* clients[] = { easyClient.get(), &multiClient };
+    for (const HttpClient* client : clients)
+    {
+        corrupt = false;
+        auto response = Get(*client, server);
+        ASSERT_NE(nullptr, response);
+        ASSERT_FALSE(response->HasChecksumMismatch());
+
+        corrupt = true;
+        response = Get(*client, server);
+        ASSERT_NE(nullptr, response);
+        ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+        ASSERT_TRUE(response->HasChecksumMismatch());
+    }
+}
+
+TEST(ResponseChecksumTest, TestResponsesWithoutCrc32AreNotChecked)
+{
+    MockHttpServer server([](const MockHttpServer::Request&) { return MockHttpServer::MakeResponse(200, "{}"); });
+    ASSERT_TRUE(server.IsRunning());
+
+    auto response = Get(*HttpClientFactory().CreateHttpClient(ClientConfiguration()), server);
+    ASSERT_NE(nullptr, response);
+    ASSERT_FALSE(response->HasChecksumMismatch());
+}
+
+/**
+ * Json client for a service that checksums its responses the way DynamoDB does.
+ */
+class ChecksummedJsonClient : public AWSJsonClient
+{
+public:
+    ChecksummedJsonClient(const ClientConfiguration& configuration) : AWSJsonClient(Aws::MakeShared<HttpClientFactory>(ALLOCATION_TAG),
+        configuration, Aws::MakeShared<AWSAuthV4Signer>(ALLOCATION_TAG,
+            Aws::MakeShared<SimpleAWSCredentialsProvider>(ALLOCATION_TAG, "akid", "secret"), "dynamodb", "us-east-1"),
+        Aws::MakeShared<AWSErrorMarshaller>(ALLOCATION_TAG))
+    {
+    }
+
+    JsonOutcome Invoke(const Aws::String& uri) const
+    {
+        return MakeRequest(uri);
+    }
+};
+
+TEST(ResponseChecksumTest, TestMismatchIsRetried)
+{
+    Aws::String body = "{\"Count\":1}";
+    std::atomic<int> corruptResponses(1);
+    MockHttpServer server([&](const MockHttpServer::Request&)
+    {
+        return RespondWithCrc32(body, corruptResponses-- > 0 ? "1" : Crc32Of(body));
+    });
+    ASSERT_TRUE(server.IsRunning());
+
+    ClientConfiguration config;
+    config.retryStrategy = Aws::MakeShared<DefaultRetryStrategy>(ALLOCATION_TAG, 2, 1);
+    ChecksummedJsonClient client(config);
+
+    //the first response is damaged, the retry gets a good one.
+    auto outcome = client.Invoke("http://" + server.GetEndpoint() + "/");
+    ASSERT_TRUE(outcome.IsSuccess());
+    ASSERT_EQ(1, outcome.GetResult().GetPayload().GetInteger("Count"));
+    ASSERT_EQ(2u, server.GetRequestCount());
+
+    //every response damaged: the retries run out and the error says why.
+    corruptResponses = 100;
+    auto failedOutcome = client.Invoke("http://" + server.GetEndpoint() + "/");
+    ASSERT_FALSE(failedOutcome.IsSuccess());
+    ASSERT_TRUE(failedOutcome.GetError().ShouldRetry());
+    ASSERT_EQ(CoreErrors::NETWORK_CONNECTION, failedOutcome.GetError().GetErrorType());
+    ASSERT_EQ("CRC32CheckFailed", failedOutcome.GetError().GetExceptionName());
+    ASSERT_EQ(5u, server.GetRequestCount());
+}
+
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
@@ -0,0 +1,187 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+#include <aws/external/gtest.h>
+#include <aws/testing/mocks/http/MockHttpServer.h>
+
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/StreamingResponseConsumer.h>
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+
+static const char* ALLOCATION_TAG = "StreamingResponseConsumerTest";
+
+/**
+ * Collects the body and pauses after every pauseEvery chunks, leaving it to a separate thread to resume.
+ */
+class CollectingConsumer : public StreamingResponseConsumer
+{
+public:
+    CollectingConsumer(unsigned pauseEvery) : m_pauseEvery(pauseEvery), m_chunks(0), m_pauses(0), m_starts(0) {}
+
+    void OnBodyStarted(const HttpResponse&) override
+    {
+        ++m_starts;
+        m_body.clear();
+    }
+
+    StreamingConsumerAction OnDataReceived(const HttpResponse&, const char* data, std::size_t length) override
+    {
+        //a paused chunk is offered again after the resume, so only count it once it is consumed.
+        if (m_pauseEvery && !m_pausedOnThisChunk && (m_chunks + 1) % m_pauseEvery == 0)
+        {
+            m_pausedOnThisChunk = true;
+            ++m_pauses;
+            return StreamingConsumerAction::PAUSE;
+        }
+
+        m_pausedOnThisChunk = false;
+        ++m_chunks;
+        m_body.append(data, length);
+        return StreamingConsumerAction::CONTINUE;
+    }
+
+    const Aws::String& GetBody() const { return m_body; }
+    unsigned GetPauses() const { return m_pauses; }
+    unsigned GetStarts() const { return m_starts; }
+
+private:
+    unsigned m_pauseEvery;
+    bool m_pausedOnThisChunk = false;
+    unsigned m_chunks;
+    std::atomic<unsigned> m_pauses;
+    unsigned m_starts;
+    Aws::String m_body;
+};
+
+static Aws::String MakeBody(size_t length)
+{
+    Aws::String body(length, 'a');
+    for (size_t i = 0; i < length; ++i)
+    {
+        body[i] = static_cast<char>('a' + i % 26);
+    }
+    return body;
+}
+
+static std::shared_ptr<HttpResponse> RunWithResumer(const HttpClient& client, const MockHttpServer& server, const std::shared_ptr<CollectingConsumer>& consumer)
+{
+    auto request = HttpClientFactory().CreateHttpRequest("http://" + server.GetEndpoint() + "/object", HttpMethod::HTTP_GET,
+        Aws::Utils::Stream::DefaultResponseStreamFactoryMethod);
+    request->SetStreamingResponseConsumer(consumer);
+
+    std::atomic<bool> done(false);
+    std::thread resumer([&]()
+    {
+        while (!done)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            if (consumer->IsPaused())
+            {
+                consumer->Resume();
+            }
+        }
+    });
+
+    auto response = client.MakeRequest(*request);
+    done = true;
+    resumer.join();
+    return response;
+}
+
+static void VerifyPausedTransfer(const HttpClient& client, size_t bodyLength)
+{
+    Aws::String body = MakeBody(bodyLength);
+    MockHttpServer server([&body](const MockHttpServer::Request&) { return MockHttpServer::MakeResponse(200, body); });
+    ASSERT_TRUE(server.IsRunning());
+
+    auto consumer = Aws::MakeShared<CollectingConsumer>(ALLOCATION_TAG, 3);
+    auto response = RunWithResumer(client, server, consumer);
+
+    ASSERT_NE(nullptr, response);
+    ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+    ASSERT_EQ(1u, consumer->GetStarts());
+    ASSERT_LT(0u, consumer->GetPauses());
+    ASSERT_EQ(body, consumer->GetBody());
+    //the body went to the consumer, not into memory.
+    ASSERT_EQ(0, response->GetResponseBody().tellp());
+}
+
+TEST(StreamingResponseConsumerTest, TestPauseAndResumeWithBlockingClient)
+{
+    ClientConfiguration config;
+    config.requestTimeoutMs = 30000;
+    //the blocking client resumes at its next progress tick, so keep the number of pauses small.
+    VerifyPausedTransfer(*HttpClientFactory().CreateHttpClient(config), 64 * 1024);
+}
+
+TEST(StreamingResponseConsumerTest, TestPausedDownloadsReuseThePooledConnection)
+{
+    Aws::String body = MakeBody(64 * 1024);
+    MockHttpServer server([&body](const MockHttpServer::Request&) { return MockHttpServer::MakeResponse(200, body); });
+    ASSERT_TRUE(server.IsRunning());
+
+    ClientConfiguration config;
+    config.requestTimeoutMs = 30000;
+    config.maxConnections = 1;
+    auto client = HttpClientFactory().CreateHttpClient(config);
+    for (int i = 0; i < 2; ++i)
+    {
+        auto consumer = Aws::MakeShared<CollectingConsumer>(ALLOCATION_TAG, 3);
+        auto response = RunWithResumer(*client, server, consumer);
+        ASSERT_NE(nullptr, response);
+        ASSERT_EQ(HttpResponseCode::OK, response->GetResponseCode());
+        ASSERT_EQ(body, consumer->GetBody());
+    }
+
+    //every download ran over the keep-alive connection of the one pooled handle.
+    ASSERT_EQ(1u, server.GetConnectionCount());
+}
+
+TEST(StreamingResponseConsumerTest, TestPauseAndResumeWithMultiClient)
+{
+    ClientConfiguration config;
+    config.requestTimeoutMs = 30000;
+    CurlMultiHttpClient client(config);
+    VerifyPausedTransfer(client, 512 * 1024);
+}
+
+TEST(StreamingResponseConsumerTest, TestErrorBodyStaysInResponseStream)
+{
+    MockHttpServer server([](const MockHttpServer::Request&) { return MockHttpServer::MakeResponse(404, "<Error><Code>NoSuchKey</Code></Error>"); });
+    ASSERT_TRUE(server.IsRunning());
+
+    ClientConfiguration config;
+    auto consumer = Aws::MakeShared<CollectingConsumer>(ALLOCATION_TAG, 0);
+    auto response = RunWithResumer(*HttpClientFactory().CreateHttpClient(config), server, consumer);
+
+    ASSERT_NE(nullptr, response);
+    ASSERT_EQ(HttpResponseCode::NOT_FOUND, response->GetResponseCode());
+    ASSERT_EQ(0u, consumer->GetStarts());
+    ASSERT_TRUE(consumer->GetBody().empty());
+    ASSERT_LT(0, response->GetResponseBody().tellp());
+}
+
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
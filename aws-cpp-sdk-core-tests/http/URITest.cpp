@@ -132,6 +132,23 @@ TEST(URITest, TestCanonicalizeQueryStringParameters)
     AWS_END_MEMORY_TEST
 }
 
+TEST(URITest, TestCanonicalizeQueryStringKeepsRepeatedAndEmptyParameters)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    URI uri("www.test.com/path?prefix=b&acl&prefix=a&&max-keys=10&Upper=%20");
+    uri.CanonicalizeQueryString();
+
+    //byte order puts upper case first; repeated keys are ordered by value and a bare key gets an empty value.
+    EXPECT_EQ("?Upper=%20&acl=&max-keys=10&prefix=a&prefix=b", uri.GetQueryString());
+
+    //canonicalizing twice changes nothing.
+    uri.CanonicalizeQueryString();
+    EXPECT_EQ("?Upper=%20&acl=&max-keys=10&prefix=a&prefix=b", uri.GetQueryString());
+
+    AWS_END_MEMORY_TEST
+}
+
 TEST(URITest, TestPort)
 {
     AWS_BEGIN_MEMORY_TEST(16, 10)
@@ -216,3 +233,32 @@ TEST(URITest, TestParseWithColon)
     AWS_END_MEMORY_TEST
 }
 
+
+TEST(URITest, TestURLEncodePath)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    EXPECT_EQ("/bucket/key%20with%20spaces/%E2%82%AC", URI::URLEncodePath("/bucket/key with spaces/\xe2\x82\xac"));
+    //empty segments collapse and a trailing slash is kept.
+    EXPECT_EQ("/a/b/", URI::URLEncodePath("a//b/"));
+    EXPECT_EQ("/", URI::URLEncodePath("/"));
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(URITest, TestBuildingStringsOnlyAllocatesTheResult)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    URI uri("https://examplebucket.s3.amazonaws.com:8443/photos/2016/some object.jpg?versionId=3");
+
+    Aws::String uriString;
+    AWS_EXPECT_ALLOCATION_COUNT(1, uriString = uri.GetURIString());
+    EXPECT_EQ("https://examplebucket.s3.amazonaws.com:8443/photos/2016/some object.jpg?versionId=3", uriString);
+
+    Aws::String encodedPath;
+    AWS_EXPECT_ALLOCATION_COUNT(1, encodedPath = URI::URLEncodePath(uri.GetPath()));
+    EXPECT_EQ("/photos/2016/some%20object.jpg", encodedPath);
+
+    AWS_END_MEMORY_TEST
+}
@@ -0,0 +1,44 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/core/utils/DateTime.h>
+
+using namespace Aws::Utils;
+
+TEST(DateTimeTest, TestConvertISO8601ToMillis)
+{
+    ASSERT_EQ(0ll, DateTime::ConvertISO8601ToMillis("1970-01-01T00:00:00Z"));
+    ASSERT_EQ(1464782400000ll, DateTime::ConvertISO8601ToMillis("2016-06-01T12:00:00Z"));
+    ASSERT_EQ(1464782400250ll, DateTime::ConvertISO8601ToMillis("2016-06-01T12:00:00.250Z"));
+    ASSERT_EQ(1464782400000ll, DateTime::ConvertISO8601ToMillis("2016-06-01T14:30:00+02:30"));
+    ASSERT_EQ(951782400000ll, DateTime::ConvertISO8601ToMillis("2000-02-29T00:00:00Z"));
+}
+
+TEST(DateTimeTest, TestConvertISO8601ToMillisRejectsMalformedInput)
+{
+    ASSERT_EQ(0ll, DateTime::ConvertISO8601ToMillis(nullptr));
+    ASSERT_EQ(0ll, DateTime::ConvertISO8601ToMillis(""));
+    ASSERT_EQ(0ll, DateTime::ConvertISO8601ToMillis("2016-06-01"));
+    ASSERT_EQ(0ll, DateTime::ConvertISO8601ToMillis("2016-13-01T12:00:00Z"));
+    ASSERT_EQ(0ll, DateTime::ConvertISO8601ToMillis("2016-06-01T12:00:00Zjunk"));
+}
+
+TEST(DateTimeTest, TestRoundTripsCurrentTimestamp)
+{
+    std::time_t now = std::time(nullptr);
+    Aws::String timestamp = DateTime::CalculateGmtTimestampAsString(now, "%Y-%m-%dT%H:%M:%SZ");
+    ASSERT_EQ(static_cast<long long>(now) * 1000, DateTime::ConvertISO8601ToMillis(timestamp.c_str()));
+}
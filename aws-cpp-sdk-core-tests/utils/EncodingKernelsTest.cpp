@@ -0,0 +1,287 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/EncodingKernels.h>
+#include <aws/core/utils/base64/Base64.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+
+using namespace Aws::Utils;
+
+static const SimdLevel SIMD_LEVELS[] = { SimdLevel::SSSE3, SimdLevel::AVX2 };
+static const char BASE64_CHARS[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+static Aws::Vector<unsigned char> RandomBytes(std::mt19937& generator, size_t length)
+{
+    std::uniform_int_distribution<int> distribution(0, 255);
+    Aws::Vector<unsigned char> bytes(length);
+    for (auto& byte : bytes)
+    {
+        byte = static_cast<unsigned char>(distribution(generator));
+    }
+    return bytes;
+}
+
+TEST(EncodingKernelsTest, TestScalarMatchesKnownValues)
+{
+    char encoded[8];
+    EncodingKernels::Base64Encode(reinterpret_cast<const unsigned char*>("foob"), 4, encoded, SimdLevel::SCALAR);
+    ASSERT_EQ("Zm9vYg==", Aws::String(encoded, 8));
+
+    const unsigned char bytes[] = { 0x00, 0x7f, 0xab, 0xff };
+    EncodingKernels::HexEncode(bytes, sizeof(bytes), encoded, SimdLevel::SCALAR);
+    ASSERT_EQ("007fabff", Aws::String(encoded, 8));
+
+    unsigned char decoded[18];
+    ASSERT_EQ(0u, EncodingKernels::Base64DecodeBlocks("Zm9vYmFyYmF6Zm9vYmFyYmF6", 24, decoded, SimdLevel::SCALAR));
+}
+
+TEST(EncodingKernelsTest, TestVectorEncodersMatchScalar)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    std::mt19937 generator(20161018);
+    for (SimdLevel level : SIMD_LEVELS)
+    {
+        if (!CpuFeatures::IsSupported(level))
+        {
+            continue;
+        }
+
+        //every length up to a few vectors covers each tail, then some longer random ones.
+        for (size_t length = 0; length < 300; length += (length < 130 ? 1 : 17))
+        {
+            auto bytes = RandomBytes(generator, length);
+            const unsigned char* data = bytes.empty() ? nullptr : bytes.data();
+
+            Aws::String expected(4 * ((length + 2) / 3), '\0');
+            Aws::String actual(expected.size(), '\0');
+            if (length > 0)
+            {
+                EncodingKernels::Base64Encode(data, length, &expected[0], SimdLevel::SCALAR);
+                EncodingKernels::Base64Encode(data, length, &actual[0], level);
+            }
+            ASSERT_EQ(expected, actual) << "base64 level " << static_cast<int>(level) << " length " << length;
+
+            Aws::String expectedHex(length * 2, '\0');
+            Aws::String actualHex(length * 2, '\0');
+            if (length > 0)
+            {
+                EncodingKernels::HexEncode(data, length, &expectedHex[0], SimdLevel::SCALAR);
+                EncodingKernels::HexEncode(data, length, &actualHex[0], level);
+            }
+            ASSERT_EQ(expectedHex, actualHex) << "hex level " << static_cast<int>(level) << " length " << length;
+        }
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(EncodingKernelsTest, TestVectorDecoderMatchesScalar)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Base64::Base64 base64;
+    std::mt19937 generator(20161018);
+    std::uniform_int_distribution<int> charDistribution(0, 63);
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+
+    for (SimdLevel level : SIMD_LEVELS)
+    {
+        if (!CpuFeatures::IsSupported(level))
+        {
+            continue;
+        }
+
+        for (size_t length = 4; length < 400; length += 4)
+        {
+            Aws::String encoded(length, '\0');
+            for (auto& c : encoded)
+            {
+                c = BASE64_CHARS[charDistribution(generator)];
+            }
+            //now and then drop in an arbitrary byte, so blocks holding chars outside the alphabet get exercised too.
+            if (length % 3 == 0)
+            {
+                encoded[byteDistribution(generator) % length] = static_cast<char>(byteDistribution(generator));
+            }
+
+            ByteBuffer expected = base64.Decode(encoded);
+            Aws::Vector<unsigned char> actual(length * 3 / 4 + 1, 0xcd);
+            size_t consumed = EncodingKernels::Base64DecodeBlocks(encoded.c_str(), length, actual.data(), level);
+
+            ASSERT_EQ(0u, consumed % 4);
+            ASSERT_LE(consumed, length);
+            ASSERT_EQ(0xcd, actual[consumed * 3 / 4]) << "wrote past the decoded blocks";
+            for (size_t i = 0; i < consumed * 3 / 4 && i < expected.GetLength(); ++i)
+            {
+                ASSERT_EQ(expected[i], actual[i]) << "level " << static_cast<int>(level) << " length " << length << " byte " << i;
+            }
+        }
+
+        //valid input is decoded for as many whole vectors as there are.
+        Aws::String valid(256, 'A');
+        Aws::Vector<unsigned char> decoded(192);
+        ASSERT_EQ(256u, EncodingKernels::Base64DecodeBlocks(valid.c_str(), valid.size(), decoded.data(), level));
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(EncodingKernelsTest, TestBase64RoundTripsThroughKernels)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Base64::Base64 base64;
+    Base64::Base64 urlSafe("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
+    std::mt19937 generator(42);
+    for (size_t length = 0; length < 200; ++length)
+    {
+        auto bytes = RandomBytes(generator, length);
+        ByteBuffer buffer(bytes.data(), length);
+
+        ByteBuffer decoded = base64.Decode(base64.Encode(buffer));
+        ASSERT_EQ(buffer, decoded);
+
+        Aws::String urlSafeEncoded = urlSafe.Encode(buffer);
+        ASSERT_EQ(Aws::String::npos, urlSafeEncoded.find_first_of("+/"));
+        ASSERT_EQ(buffer, urlSafe.Decode(urlSafeEncoded));
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(EncodingKernelsTest, TestUnreservedScanMatchesScalar)
+{
+    std::mt19937 generator(1018);
+    std::uniform_int_distribution<int> byteDistribution(0, 255);
+    const char unreserved[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_.~";
+
+    for (SimdLevel level : SIMD_LEVELS)
+    {
+        if (!CpuFeatures::IsSupported(level))
+        {
+            continue;
+        }
+
+        //every byte value has to be classified the same way at every position of a vector.
+        for (int value = 0; value < 256; ++value)
+        {
+            for (size_t position = 0; position < 40; position += 3)
+            {
+                Aws::String text(48, 'a');
+                text[position] = static_cast<char>(value);
+                ASSERT_EQ(EncodingKernels::CountUnreservedPrefix(text.c_str(), text.size(), SimdLevel::SCALAR),
+                    EncodingKernels::CountUnreservedPrefix(text.c_str(), text.size(), level)) << "byte " << value << " at " << position;
+            }
+        }
+
+        for (size_t length = 0; length < 200; ++length)
+        {
+            Aws::String text(length, 'a');
+            for (auto& c : text)
+            {
+                c = unreserved[byteDistribution(generator) % (sizeof(unreserved) - 1)];
+            }
+            if (length > 0 && length % 2 == 0)
+            {
+                text[byteDistribution(generator) % length] = static_cast<char>(byteDistribution(generator));
+            }
+            ASSERT_EQ(EncodingKernels::CountUnreservedPrefix(text.c_str(), length, SimdLevel::SCALAR),
+                EncodingKernels::CountUnreservedPrefix(text.c_str(), length, level)) << "length " << length;
+        }
+    }
+}
+
+template<typename Kernel>
+static double MeasureMegabytesPerSecond(const Aws::Vector<unsigned char>& bytes, Kernel kernel)
+{
+    static const unsigned ITERATIONS = 200;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < ITERATIONS; ++i)
+    {
+        kernel(bytes.data(), bytes.size());
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return bytes.size() * static_cast<double>(ITERATIONS) / elapsed.count() / (1024 * 1024);
+}
+
+TEST(EncodingKernelsTest, DISABLED_BenchmarkEncoding)
+{
+    std::mt19937 generator(7);
+    auto bytes = RandomBytes(generator, 256 * 1024);
+    Aws::String base64(4 * ((bytes.size() + 2) / 3), '\0');
+    Aws::String hex(bytes.size() * 2, '\0');
+    Aws::String scalarBase64(base64.size(), '\0');
+    Aws::String scalarHex(hex.size(), '\0');
+    SimdLevel best = CpuFeatures::GetBestSimdLevel();
+
+    double scalarBase64Rate = MeasureMegabytesPerSecond(bytes, [&](const unsigned char* data, size_t length)
+        { EncodingKernels::Base64Encode(data, length, &scalarBase64[0], SimdLevel::SCALAR); });
+    double bestBase64Rate = MeasureMegabytesPerSecond(bytes, [&](const unsigned char* data, size_t length)
+        { EncodingKernels::Base64Encode(data, length, &base64[0], best); });
+    double scalarHexRate = MeasureMegabytesPerSecond(bytes, [&](const unsigned char* data, size_t length)
+        { EncodingKernels::HexEncode(data, length, &scalarHex[0], SimdLevel::SCALAR); });
+    double bestHexRate = MeasureMegabytesPerSecond(bytes, [&](const unsigned char* data, size_t length)
+        { EncodingKernels::HexEncode(data, length, &hex[0], best); });
+
+    printf("[ BENCH    ] Base64 encode: %.0f MB/s scalar, %.0f MB/s at level %d (%.2fx); hex encode: %.0f MB/s scalar, %.0f MB/s (%.2fx)\n",
+        scalarBase64Rate, bestBase64Rate, static_cast<int>(best), bestBase64Rate / scalarBase64Rate,
+        scalarHexRate, bestHexRate, bestHexRate / scalarHexRate);
+
+    ASSERT_EQ(scalarBase64, base64);
+    ASSERT_EQ(scalarHex, hex);
+}
+
+TEST(EncodingKernelsTest, DISABLED_BenchmarkUnreservedScan)
+{
+    //a long token that is mostly unreserved, the way security tokens and object keys tend to be.
+    std::mt19937 generator(11);
+    std::uniform_int_distribution<int> distribution(0, 63);
+    Aws::Vector<unsigned char> text(64 * 1024);
+    for (size_t i = 0; i < text.size(); ++i)
+    {
+        text[i] = static_cast<unsigned char>(i % 97 == 96 ? '/' : BASE64_CHARS[distribution(generator) % 62]);
+    }
+    SimdLevel best = CpuFeatures::GetBestSimdLevel();
+    size_t scalarRuns = 0;
+    size_t bestRuns = 0;
+
+    auto scanWith = [](SimdLevel level, size_t& runs)
+    {
+        return [level, &runs](const unsigned char* data, size_t length)
+        {
+            const char* chars = reinterpret_cast<const char*>(data);
+            runs = 0;
+            for (size_t i = 0; i < length; ++runs)
+            {
+                i += EncodingKernels::CountUnreservedPrefix(chars + i, length - i, level) + 1;
+            }
+        };
+    };
+    double scalarRate = MeasureMegabytesPerSecond(text, scanWith(SimdLevel::SCALAR, scalarRuns));
+    double bestRate = MeasureMegabytesPerSecond(text, scanWith(best, bestRuns));
+
+    printf("[ BENCH    ] Unreserved char scan: %.0f MB/s scalar, %.0f MB/s at level %d (%.2fx)\n",
+        scalarRate, bestRate, static_cast<int>(best), bestRate / scalarRate);
+
+    ASSERT_EQ(scalarRuns, bestRuns);
+}
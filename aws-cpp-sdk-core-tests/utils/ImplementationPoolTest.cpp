@@ -0,0 +1,137 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/crypto/ImplementationPool.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const char* ALLOCATION_TAG = "ImplementationPoolTest";
+
+static std::atomic<int> s_createdHashes(0);
+
+//keeps its digest in a member the way the bcrypt implementations do, so sharing one instance across threads corrupts results.
+class StatefulHash : public Hash
+{
+public:
+    HashResult Calculate(const Aws::String& str) override
+    {
+        m_state = str;
+        std::this_thread::yield();
+        return HashingUtils::CalculateSHA256(m_state);
+    }
+
+    HashResult Calculate(Aws::IStream&) override
+    {
+        return HashResult();
+    }
+
+private:
+    Aws::String m_state;
+};
+
+static std::shared_ptr<Hash> CreateStatefulHash()
+{
+    ++s_createdHashes;
+    return Aws::MakeShared<StatefulHash>(ALLOCATION_TAG);
+}
+
+TEST(ImplementationPoolTest, TestReleasedImplementationIsReused)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    s_createdHashes = 0;
+    HashPool pool(CreateStatefulHash);
+
+    Hash* first = nullptr;
+    {
+        auto lease = pool.Acquire();
+        ASSERT_TRUE(static_cast<bool>(lease));
+        first = &*lease;
+    }
+
+    auto lease = pool.Acquire();
+    ASSERT_EQ(first, &*lease);
+    ASSERT_EQ(1, s_createdHashes.load());
+
+    auto second = pool.Acquire();
+    ASSERT_NE(first, &*second);
+    ASSERT_EQ(2, s_createdHashes.load());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(ImplementationPoolTest, TestConcurrentLeasesDoNotShareState)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    s_createdHashes = 0;
+    HashPool pool(CreateStatefulHash);
+    std::atomic<int> mismatches(0);
+
+    Aws::Vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+        threads.push_back(std::thread([&pool, &mismatches, i]
+        {
+            Aws::String input(64, static_cast<char>('a' + i));
+            ByteBuffer expected = HashingUtils::CalculateSHA256(input);
+            for (int j = 0; j < 200; ++j)
+            {
+                if (pool.Acquire()->Calculate(input).GetResult() != expected)
+                {
+                    ++mismatches;
+                }
+            }
+        }));
+    }
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    ASSERT_EQ(0, mismatches.load());
+    ASSERT_LE(s_createdHashes.load(), 4);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(ImplementationPoolTest, TestPooledPlatformImplementations)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    HashPool sha256Pool(CreateSha256Implementation);
+    ASSERT_EQ(HashingUtils::CalculateSHA256("abc"), sha256Pool.Acquire()->Calculate("abc").GetResult());
+
+    HashPool md5Pool(CreateMD5Implementation);
+    ASSERT_EQ(HashingUtils::CalculateMD5("abc"), md5Pool.Acquire()->Calculate("abc").GetResult());
+
+    HMACPool hmacPool(CreateSha256HMACImplementation);
+    ByteBuffer secret((unsigned char*)"key", 3);
+    ByteBuffer toSign((unsigned char*)"abc", 3);
+    ASSERT_EQ(HashingUtils::CalculateSHA256HMAC(toSign, secret), hmacPool.Acquire()->Calculate(toSign, secret).GetResult());
+
+    AWS_END_MEMORY_TEST
+}
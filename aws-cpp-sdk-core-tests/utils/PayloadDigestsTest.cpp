@@ -0,0 +1,232 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/crypto/CRC32.h>
+#include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/crypto/PayloadDigests.h>
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+
+#include <chrono>
+#include <cstdio>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const char* ALLOCATION_TAG = "PayloadDigestsTest";
+
+static Aws::String MakePayload(size_t length)
+{
+    Aws::String payload(length, 'x');
+    for (size_t i = 0; i < length; ++i)
+    {
+        payload[i] = static_cast<char>('a' + (i * 7) % 26);
+    }
+    return payload;
+}
+
+TEST(CRC32Test, TestCheckValue)
+{
+    CRC32 crc;
+    ASSERT_EQ(0xCBF43926u, CRC32::ToValue(crc.Calculate("123456789").GetResult()));
+    ASSERT_EQ(0u, CRC32::ToValue(crc.Calculate("").GetResult()));
+
+    crc.Update(reinterpret_cast<const unsigned char*>("1234"), 4);
+    crc.Update(reinterpret_cast<const unsigned char*>("56789"), 5);
+    ASSERT_EQ(0xCBF43926u, CRC32::ToValue(crc.GetHash().GetResult()));
+
+    //GetHash starts the next checksum from scratch.
+    crc.Update(reinterpret_cast<const unsigned char*>("123456789"), 9);
+    ByteBuffer digest = crc.GetHash().GetResult();
+    ASSERT_EQ(4u, digest.GetLength());
+    ASSERT_EQ(0xCB, digest[0]);
+    ASSERT_EQ(0x26, digest[3]);
+}
+
+//bit at a time, straight from the definition.
+static uint32_t ReferenceCRC32(uint32_t crc, const unsigned char* buffer, size_t length)
+{
+    crc = ~crc;
+    for (size_t i = 0; i < length; ++i)
+    {
+        crc ^= buffer[i];
+        for (int bit = 0; bit < 8; ++bit)
+        {
+            crc = (crc >> 1) ^ ((crc & 1) ? 0xEDB88320u : 0);
+        }
+    }
+    return ~crc;
+}
+
+TEST(CRC32Test, TestKernelsMatchReference)
+{
+    Aws::String payload = MakePayload(1500);
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(payload.data());
+    const CRC32::Kernel kernels[] = { CRC32::Kernel::SLICE_BY_8, CRC32::Kernel::PCLMUL };
+    for (CRC32::Kernel kernel : kernels)
+    {
+        if (!CRC32::IsSupported(kernel))
+        {
+            continue;
+        }
+
+        //every length around the 16 and 64 byte folding steps, at unaligned offsets, continuing a checksum that was already running.
+        for (size_t length = 0; length < 300; ++length)
+        {
+            for (size_t offset = 0; offset < 4; ++offset)
+            {
+                ASSERT_EQ(ReferenceCRC32(0x12345678u, data + offset, length), CRC32::Extend(0x12345678u, data + offset, length, kernel))
+                    << "kernel " << static_cast<int>(kernel) << " length " << length << " offset " << offset;
+            }
+        }
+        ASSERT_EQ(ReferenceCRC32(0, data, payload.size()), CRC32::Extend(0, data, payload.size(), kernel));
+    }
+}
+
+TEST(CRC32Test, DISABLED_BenchmarkKernels)
+{
+    Aws::String payload = MakePayload(1024 * 1024);
+    const unsigned char* data = reinterpret_cast<const unsigned char*>(payload.data());
+    static const unsigned ITERATIONS = 20;
+
+    double rates[2] = { 0, 0 };
+    uint32_t results[2] = { 0, 0 };
+    const CRC32::Kernel kernels[] = { CRC32::Kernel::SLICE_BY_8, CRC32::Kernel::PCLMUL };
+    for (size_t k = 0; k < 2; ++k)
+    {
+        if (!CRC32::IsSupported(kernels[k]))
+        {
+            continue;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (unsigned i = 0; i < ITERATIONS; ++i)
+        {
+            results[k] = CRC32::Extend(0, data, payload.size(), kernels[k]);
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        rates[k] = ITERATIONS * payload.size() / elapsed.count() / (1024 * 1024);
+    }
+
+    printf("[ BENCH    ] CRC32: %.0f MB/s slice-by-8, %.0f MB/s pclmul\n", rates[0], rates[1]);
+
+    ASSERT_EQ(ReferenceCRC32(0, data, payload.size()), results[0]);
+    if (CRC32::IsSupported(CRC32::Kernel::PCLMUL))
+    {
+        ASSERT_EQ(results[0], results[1]);
+    }
+}
+
+TEST(PayloadDigestsTest, TestSinglePassMatchesSeparateDigests)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    //spans several internal read blocks with a partial one at the end.
+    Aws::String payload = MakePayload(3 * Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE + 123);
+    Aws::StringStream stream(payload);
+    stream.seekg(17);
+
+    PayloadDigests digests;
+    ASSERT_TRUE(digests.Compute(stream, PayloadDigests::MD5_DIGEST | PayloadDigests::SHA256_DIGEST | PayloadDigests::CRC32_DIGEST));
+    ASSERT_EQ(17, stream.tellg());
+
+    ASSERT_TRUE(digests.Has(PayloadDigests::MD5_DIGEST | PayloadDigests::SHA256_DIGEST | PayloadDigests::CRC32_DIGEST));
+    ASSERT_EQ(HashingUtils::CalculateMD5(payload), digests.GetMD5());
+    ASSERT_EQ(HashingUtils::CalculateSHA256(payload), digests.GetSHA256());
+    ASSERT_EQ(CRC32::ToValue(CRC32().Calculate(payload).GetResult()), digests.GetCRC32());
+
+    PayloadDigests bufferDigests;
+    ASSERT_TRUE(bufferDigests.Compute(reinterpret_cast<const unsigned char*>(payload.c_str()), payload.size(), PayloadDigests::SHA256_DIGEST));
+    ASSERT_TRUE(bufferDigests.Has(PayloadDigests::SHA256_DIGEST));
+    ASSERT_FALSE(bufferDigests.Has(PayloadDigests::MD5_DIGEST));
+    ASSERT_EQ(digests.GetSHA256(), bufferDigests.GetSHA256());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(PayloadDigestsTest, TestEmptyPayload)
+{
+    Aws::StringStream stream;
+    PayloadDigests digests;
+    ASSERT_TRUE(digests.Compute(stream, PayloadDigests::MD5_DIGEST | PayloadDigests::SHA256_DIGEST));
+    ASSERT_EQ(HashingUtils::CalculateMD5(""), digests.GetMD5());
+    ASSERT_EQ(HashingUtils::CalculateSHA256(""), digests.GetSHA256());
+}
+
+static int s_sha256Calculations = 0;
+
+//only supports one-shot hashing, like a custom implementation written against the original interface.
+class OneShotSha256 : public Hash
+{
+public:
+    OneShotSha256(const std::shared_ptr<Hash>& impl) : m_impl(impl) {}
+
+    HashResult Calculate(const Aws::String& str) override
+    {
+        ++s_sha256Calculations;
+        return m_impl->Calculate(str);
+    }
+
+    HashResult Calculate(Aws::IStream& stream) override
+    {
+        ++s_sha256Calculations;
+        return m_impl->Calculate(stream);
+    }
+
+private:
+    std::shared_ptr<Hash> m_impl;
+};
+
+class OneShotSha256Factory : public HashFactory
+{
+public:
+    //the platform implementation has to be created up front, once the factory is installed it would create another OneShotSha256.
+    OneShotSha256Factory() : m_impl(CreateSha256Implementation()) {}
+
+    std::shared_ptr<Hash> CreateImplementation() const override
+    {
+        return Aws::MakeShared<OneShotSha256>(ALLOCATION_TAG, m_impl);
+    }
+
+private:
+    std::shared_ptr<Hash> m_impl;
+};
+
+TEST(PayloadDigestsTest, TestKnownDigestsAreNotRecomputedAndOneShotImplementationsStillWork)
+{
+    SetSha256Factory(Aws::MakeShared<OneShotSha256Factory>(ALLOCATION_TAG));
+    s_sha256Calculations = 0;
+
+    Aws::String payload = MakePayload(1000);
+    Aws::StringStream stream(payload);
+
+    PayloadDigests digests;
+    bool computed = digests.Compute(stream, PayloadDigests::MD5_DIGEST | PayloadDigests::SHA256_DIGEST);
+    computed = computed && digests.Compute(stream, PayloadDigests::SHA256_DIGEST);
+    computed = computed && digests.Compute(stream, PayloadDigests::MD5_DIGEST | PayloadDigests::SHA256_DIGEST);
+    SetSha256Factory(nullptr);
+
+    ASSERT_TRUE(computed);
+    ASSERT_EQ(1, s_sha256Calculations);
+    ASSERT_EQ(HashingUtils::CalculateMD5(payload), digests.GetMD5());
+    ASSERT_EQ(HashingUtils::CalculateSHA256(payload), digests.GetSHA256());
+
+    digests.Reset();
+    ASSERT_FALSE(digests.Has(PayloadDigests::SHA256_DIGEST));
+}
@@ -0,0 +1,142 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/StringBuilder.h>
+#include <aws/core/utils/StringUtils.h>
+
+#include <climits>
+
+using namespace Aws::Utils;
+
+TEST(StringBuilderTest, TestFormatDecimal)
+{
+    char buffer[IntegerFormat::MAX_DECIMAL_LENGTH];
+
+    ASSERT_EQ("0", Aws::String(buffer, IntegerFormat::FormatDecimal(0LL, buffer)));
+    ASSERT_EQ("443", Aws::String(buffer, IntegerFormat::FormatDecimal(443LL, buffer)));
+    ASSERT_EQ("-1", Aws::String(buffer, IntegerFormat::FormatDecimal(-1LL, buffer)));
+    ASSERT_EQ("9223372036854775807", Aws::String(buffer, IntegerFormat::FormatDecimal(LLONG_MAX, buffer)));
+    ASSERT_EQ("-9223372036854775808", Aws::String(buffer, IntegerFormat::FormatDecimal(LLONG_MIN, buffer)));
+    ASSERT_EQ("18446744073709551615", Aws::String(buffer, IntegerFormat::FormatDecimal(ULLONG_MAX, buffer)));
+}
+
+TEST(StringBuilderTest, TestFormatHex)
+{
+    char buffer[IntegerFormat::MAX_HEX_LENGTH];
+
+    ASSERT_EQ("0", Aws::String(buffer, IntegerFormat::FormatHex(0, buffer)));
+    ASSERT_EQ("ff", Aws::String(buffer, IntegerFormat::FormatHex(255, buffer)));
+    ASSERT_EQ("00FF", Aws::String(buffer, IntegerFormat::FormatHex(255, buffer, 4, true)));
+    ASSERT_EQ("ffffffffffffffff", Aws::String(buffer, IntegerFormat::FormatHex(ULLONG_MAX, buffer, 32)));
+}
+
+TEST(StringBuilderTest, TestAppend)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    StringBuilder<> builder;
+    ASSERT_TRUE(builder.IsEmpty());
+    ASSERT_STREQ("", builder.c_str());
+
+    Aws::String bucket("bucket");
+    builder.Append("https://s3.amazonaws.com").Append('/').Append(bucket).Append(":").AppendDecimal(-42LL)
+        .Append('/').AppendHex(0xbeef, 8);
+    ASSERT_EQ("https://s3.amazonaws.com/bucket:-42/0000beef", builder.ToString());
+    ASSERT_EQ(strlen(builder.c_str()), builder.GetLength());
+
+    builder.Truncate(25);
+    ASSERT_STREQ("https://s3.amazonaws.com/", builder.c_str());
+    builder.Clear();
+    ASSERT_TRUE(builder.IsEmpty());
+    ASSERT_STREQ("", builder.c_str());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(StringBuilderTest, TestEncodingMatchesStringUtils)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    const char* unsafe = "a b/c?d=e&f+~._-\xe2\x82\xac";
+    StringBuilder<> builder;
+    builder.AppendURLEncoded(unsafe, strlen(unsafe));
+    ASSERT_EQ("a%20b%2Fc%3Fd%3De%26f%2B~._-%E2%82%AC", builder.ToString());
+
+    const unsigned char digest[] = { 0x00, 0x0f, 0xa5, 0xff };
+    builder.Clear();
+    builder.AppendHexEncoded(digest, sizeof(digest));
+    ASSERT_EQ("000fa5ff", builder.ToString());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(StringBuilderTest, TestURLDecoding)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    StringBuilder<> builder;
+    builder.Append("prefix:");
+    const char* encoded = "a%20b%2fc%3F%E2%82%AC~";
+    builder.AppendURLDecoded(encoded, strlen(encoded));
+    ASSERT_EQ("prefix:a b/c?\xe2\x82\xac~", builder.ToString());
+    ASSERT_EQ(strlen(builder.c_str()), builder.GetLength());
+
+    //malformed escapes decode like strtol would have read them, and a truncated one at the end stays as it is.
+    builder.Clear();
+    const char* malformed = "%4z%zz%4";
+    builder.AppendURLDecoded(malformed, strlen(malformed));
+    ASSERT_EQ(Aws::String("\x04\0%4", 4), builder.ToString());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(StringBuilderTest, TestInlineBufferDoesNotAllocate)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    StringBuilder<64> builder;
+    AWS_EXPECT_ALLOCATION_COUNT(0, builder.Append("GET\n/some/object/key\n").AppendDecimal(1234567890LL).Append('\n'));
+    ASSERT_FALSE(builder.IsOnHeap());
+
+    Aws::String result;
+    AWS_EXPECT_ALLOCATION_COUNT(1, result = builder.ToString());
+    ASSERT_EQ("GET\n/some/object/key\n1234567890\n", result);
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(StringBuilderTest, TestGrowsOntoTheHeap)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Aws::String longSegment(100, 'x');
+    StringBuilder<16> builder;
+    builder.Append("prefix/");
+
+    //the first overflow moves to the heap once; later appends double it instead of allocating per append.
+    AWS_EXPECT_ALLOCATION_COUNT(1, builder.Append(longSegment));
+    ASSERT_TRUE(builder.IsOnHeap());
+    AWS_EXPECT_ALLOCATION_COUNT(1, for (int i = 0; i < 8; ++i) { builder.Append('y'); } builder.Append(longSegment));
+    ASSERT_EQ("prefix/" + longSegment + "yyyyyyyy" + longSegment, builder.ToString());
+
+    StringBuilder<16> reserved;
+    AWS_EXPECT_ALLOCATION_COUNT(1, reserved.Reserve(512); reserved.Append(longSegment).Append(longSegment).Append(longSegment));
+    ASSERT_EQ(300u, reserved.GetLength());
+
+    AWS_END_MEMORY_TEST
+}
@@ -0,0 +1,179 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/ContiguousStreamBuf.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+#include <aws/core/utils/xml/XmlSerializer.h>
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+#include <aws/testing/mocks/http/MockHttpServer.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/http/HttpClientFactory.h>
+#include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/curl/CurlHttpClient.h>
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+#include <cstring>
+
+using namespace Aws::Utils::Stream;
+
+TEST(ContiguousStreamBufTest, TestWriteThenReadBack)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    {
+        DefaultUnderlyingStream stream;
+        ASSERT_EQ(0, stream.tellp());
+
+        stream << "hello";
+        stream.write(" world", 6);
+        stream.put('!');
+        ASSERT_EQ(12, stream.tellp());
+
+        Aws::String word;
+        stream >> word;
+        ASSERT_EQ("hello", word);
+        ASSERT_EQ(5, stream.tellg());
+
+        stream.seekg(0);
+        Aws::StringStream copy;
+        copy << stream.rdbuf();
+        ASSERT_EQ("hello world!", copy.str());
+
+        //writes after a backwards seekp overwrite in place and the content keeps its length.
+        stream.clear();
+        stream.seekp(0);
+        stream << "HELLO";
+        ContiguousStreamBuf* buf = DefaultUnderlyingStream::GetContiguousStreamBuf(stream);
+        ASSERT_NE(nullptr, buf);
+        ASSERT_EQ(12u, buf->GetSize());
+        ASSERT_EQ(0, std::memcmp("HELLO world!", buf->GetData(), 12));
+
+        stream.seekg(0, std::ios_base::end);
+        ASSERT_EQ(12, stream.tellg());
+        ASSERT_EQ(-1, stream.rdbuf()->pubseekpos(13, std::ios_base::in));
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(ContiguousStreamBufTest, TestReserveAvoidsReallocation)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    {
+        DefaultUnderlyingStream stream;
+        ContiguousStreamBuf* buf = DefaultUnderlyingStream::GetContiguousStreamBuf(stream);
+        ASSERT_NE(nullptr, buf);
+        ASSERT_EQ(nullptr, buf->GetData());
+
+        buf->Reserve(100000);
+        ASSERT_EQ(100000u, buf->GetCapacity());
+        const char* reserved = buf->GetData();
+
+        char chunk[1000];
+        std::memset(chunk, 'x', sizeof(chunk));
+        for (int i = 0; i < 100; ++i)
+        {
+            stream.write(chunk, sizeof(chunk));
+        }
+
+        ASSERT_EQ(reserved, buf->GetData());
+        ASSERT_EQ(100000u, buf->GetSize());
+
+        //reserving less than is already there is a no-op, and the buffer still grows past the reservation on demand.
+        buf->Reserve(10);
+        ASSERT_EQ(100000u, buf->GetCapacity());
+        stream.put('y');
+        ASSERT_EQ(100001u, buf->GetSize());
+        ASSERT_EQ('y', buf->GetData()[100000]);
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(ContiguousStreamBufTest, TestOnlyDefaultStreamIsContiguous)
+{
+    Aws::StringStream stringStream;
+    ASSERT_EQ(nullptr, DefaultUnderlyingStream::GetContiguousStreamBuf(stringStream));
+
+    DefaultUnderlyingStream stream;
+    ASSERT_NE(nullptr, DefaultUnderlyingStream::GetContiguousStreamBuf(stream));
+
+    Aws::StringBuf otherBuf;
+    std::streambuf* original = stream.rdbuf(&otherBuf);
+    ASSERT_EQ(nullptr, DefaultUnderlyingStream::GetContiguousStreamBuf(stream));
+    stream.rdbuf(original);
+}
+
+TEST(ContiguousStreamBufTest, TestParsersReadInPlace)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    {
+        DefaultUnderlyingStream jsonStream;
+        jsonStream << "{\"Count\":3,\"Items\":[\"a\",\"b\",\"c\"]}";
+        Aws::Utils::Json::JsonValue json(jsonStream);
+        ASSERT_TRUE(json.WasParseSuccessful());
+        ASSERT_EQ(3, json.GetInteger("Count"));
+        ASSERT_EQ(3u, json.GetArray("Items").GetLength());
+
+        DefaultUnderlyingStream badJsonStream;
+        badJsonStream << "{\"Count\":";
+        ASSERT_FALSE(Aws::Utils::Json::JsonValue(badJsonStream).WasParseSuccessful());
+
+        DefaultUnderlyingStream xmlStream;
+        xmlStream << "<Response><Name>value</Name></Response>";
+        auto xml = Aws::Utils::Xml::XmlDocument::CreateFromXmlStream(xmlStream);
+        ASSERT_TRUE(xml.WasParseSuccessful());
+        ASSERT_EQ("value", xml.GetRootElement().FirstChild("Name").GetText());
+        ASSERT_EQ(xmlStream.tellp(), xmlStream.tellg());
+
+        DefaultUnderlyingStream emptyStream;
+        ASSERT_FALSE(Aws::Utils::Xml::XmlDocument::CreateFromXmlStream(emptyStream).WasParseSuccessful());
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+TEST(ContiguousStreamBufTest, TestCurlReservesFromContentLength)
+{
+    Aws::String body(300000, 'z');
+    MockHttpServer server([&body](const MockHttpServer::Request&) { return MockHttpServer::MakeResponse(200, body); });
+    ASSERT_TRUE(server.IsRunning());
+
+    Aws::Client::ClientConfiguration config;
+    Aws::Http::CurlHttpClient client(config);
+
+    auto request = Aws::Http::HttpClientFactory().CreateHttpRequest("http://" + server.GetEndpoint() + "/large", Aws::Http::HttpMethod::HTTP_GET,
+        DefaultResponseStreamFactoryMethod);
+    auto response = client.MakeRequest(*request);
+    ASSERT_NE(nullptr, response);
+
+    ContiguousStreamBuf* buf = DefaultUnderlyingStream::GetContiguousStreamBuf(response->GetResponseBody());
+    ASSERT_NE(nullptr, buf);
+    ASSERT_EQ(body.size(), buf->GetSize());
+    ASSERT_EQ(body.size(), buf->GetCapacity());
+    ASSERT_EQ(0, std::memcmp(body.c_str(), buf->GetData(), body.size()));
+}
+
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
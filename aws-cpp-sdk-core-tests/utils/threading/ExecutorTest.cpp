@@ -0,0 +1,117 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/threading/PooledThreadExecutor.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <chrono>
+#include <future>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+//stands in for a large request: counts how often it gets deep copied on its way into the task.
+class CopyCountingRequest
+{
+public:
+    CopyCountingRequest(const Aws::String& payload, int* copies) : m_payload(payload), m_copies(copies) {}
+    CopyCountingRequest(const CopyCountingRequest& other) : m_payload(other.m_payload), m_copies(other.m_copies) { ++*m_copies; }
+    CopyCountingRequest(CopyCountingRequest&& other) : m_payload(std::move(other.m_payload)), m_copies(other.m_copies) {}
+
+    const Aws::String& GetPayload() const { return m_payload; }
+
+private:
+    CopyCountingRequest& operator = (const CopyCountingRequest&) = delete;
+
+    Aws::String m_payload;
+    int* m_copies;
+};
+
+class FakeClient
+{
+public:
+    size_t Operation(const CopyCountingRequest& request) const { return request.GetPayload().size(); }
+};
+
+static size_t RejectOperation(const FakeClient*, const CopyCountingRequest&)
+{
+    return 0;
+}
+
+TEST(ExecutorTest, TestSubmitWithFutureMovesRvalueArguments)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    FakeClient client;
+    int copies = 0;
+    {
+        PooledThreadExecutor executor(1);
+        std::future<size_t> result = executor.SubmitWithFuture(&FakeClient::Operation, &RejectOperation, &client, CopyCountingRequest("payload", &copies));
+        ASSERT_EQ(7u, result.get());
+        ASSERT_EQ(0, copies);
+
+        //lvalues are copied once, the caller keeps its request.
+        CopyCountingRequest request("payload!", &copies);
+        result = executor.SubmitWithFuture(&FakeClient::Operation, &RejectOperation, &client, request);
+        ASSERT_EQ(8u, result.get());
+        ASSERT_EQ(1, copies);
+    }
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(ExecutorTest, TestRejectedSubmitWithFutureHoldsTheRejectionResult)
+{
+    PooledThreadExecutor executor(1);
+    executor.Shutdown();
+
+    bool ran = false;
+    std::future<int> result = executor.SubmitWithFuture([&ran] { ran = true; return 42; }, [] { return -1; });
+    ASSERT_TRUE(result.valid());
+    ASSERT_EQ(std::future_status::ready, result.wait_for(std::chrono::seconds(0)));
+    ASSERT_EQ(-1, result.get());
+    //work submitted after shutdown must not run, not even on the caller.
+    ASSERT_FALSE(ran);
+}
+
+TEST(ExecutorTest, TestRejectedSubmitOrRejectHandsTheArgumentsToOnRejected)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    int copies = 0;
+    {
+        PooledThreadExecutor executor(1);
+        executor.Shutdown();
+
+        bool ran = false;
+        Aws::String rejectedPayload;
+        std::thread::id rejectedOn;
+        ASSERT_FALSE(executor.SubmitOrReject([&ran](const CopyCountingRequest&) { ran = true; },
+            [&](const CopyCountingRequest& request) { rejectedPayload = request.GetPayload(); rejectedOn = std::this_thread::get_id(); },
+            CopyCountingRequest("payload", &copies)));
+
+        ASSERT_FALSE(ran);
+        //the moved in request survived the rejection.
+        ASSERT_EQ("payload", rejectedPayload);
+        ASSERT_EQ(std::this_thread::get_id(), rejectedOn);
+    }
+    ASSERT_EQ(0, copies);
+
+    AWS_END_MEMORY_TEST
+}
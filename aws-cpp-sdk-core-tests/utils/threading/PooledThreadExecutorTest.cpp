@@ -0,0 +1,285 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/external/gtest.h>
+#include <aws/testing/MemoryTesting.h>
+
+#include <aws/core/utils/threading/PooledThreadExecutor.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+static const char* ALLOCATION_TAG = "PooledThreadExecutorTest";
+
+//lets the test hold tasks inside the pool and release them all at once.
+class Gate
+{
+public:
+    Gate() : m_open(false), m_waiting(0) {}
+
+    void Wait()
+    {
+        std::unique_lock<std::mutex> locker(m_mutex);
+        ++m_waiting;
+        m_signal.notify_all();
+        //bounded, so a failed assertion that never opens the gate can't hang the executor's shutdown.
+        m_signal.wait_for(locker, std::chrono::seconds(10), [this] { return m_open; });
+    }
+
+    bool WaitForWaiters(unsigned count)
+    {
+        std::unique_lock<std::mutex> locker(m_mutex);
+        return m_signal.wait_for(locker, std::chrono::seconds(10), [this, count] { return m_waiting >= count; });
+    }
+
+    void Open()
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_open = true;
+        m_signal.notify_all();
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_signal;
+    bool m_open;
+    unsigned m_waiting;
+};
+
+class CompletionCounter
+{
+public:
+    CompletionCounter() : m_count(0) {}
+
+    void Increment()
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        ++m_count;
+        m_signal.notify_all();
+    }
+
+    bool WaitFor(unsigned count)
+    {
+        std::unique_lock<std::mutex> locker(m_mutex);
+        return m_signal.wait_for(locker, std::chrono::seconds(30), [this, count] { return m_count >= count; });
+    }
+
+    unsigned Get()
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        return m_count;
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_signal;
+    unsigned m_count;
+};
+
+TEST(PooledThreadExecutorTest, TestRunsEverySubmittedTask)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    CompletionCounter completed;
+    {
+        PooledThreadExecutor executor(4);
+        for (unsigned i = 0; i < 1000; ++i)
+        {
+            ASSERT_TRUE(executor.Submit([&completed] { completed.Increment(); }));
+        }
+        ASSERT_TRUE(completed.WaitFor(1000));
+        ASSERT_EQ(4u, executor.GetPoolSize());
+    }
+    ASSERT_EQ(1000u, completed.Get());
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(PooledThreadExecutorTest, TestIdleWorkerStealsFromBusyWorker)
+{
+    Gate gate;
+    CompletionCounter completed;
+    PooledThreadExecutor executor(2);
+
+    //the first task parks the first worker; half of what follows is dealt to its deque and can only run if the other worker steals it.
+    executor.Submit([&gate] { gate.Wait(); });
+    ASSERT_TRUE(gate.WaitForWaiters(1));
+    for (unsigned i = 0; i < 10; ++i)
+    {
+        executor.Submit([&completed] { completed.Increment(); });
+    }
+
+    ASSERT_TRUE(completed.WaitFor(10));
+    gate.Open();
+}
+
+TEST(PooledThreadExecutorTest, TestRejectPolicy)
+{
+    Gate gate;
+    PooledThreadExecutor executor(1, 2, OverflowPolicy::REJECT);
+
+    executor.Submit([&gate] { gate.Wait(); });
+    ASSERT_TRUE(gate.WaitForWaiters(1));
+    ASSERT_TRUE(executor.Submit([] {}));
+    ASSERT_TRUE(executor.Submit([] {}));
+    ASSERT_EQ(2u, executor.GetQueuedTaskCount());
+
+    bool ran = false;
+    ASSERT_FALSE(executor.Submit([&ran] { ran = true; }));
+    //a rejected SubmitWithFuture yields the rejection result rather than a broken promise, without running the task.
+    ASSERT_EQ(-1, executor.SubmitWithFuture([&ran] { ran = true; return 7; }, [] { return -1; }).get());
+    gate.Open();
+    executor.Shutdown();
+    ASSERT_FALSE(ran);
+}
+
+TEST(PooledThreadExecutorTest, TestRunOnCallerPolicy)
+{
+    Gate gate;
+    PooledThreadExecutor executor(1, 1, OverflowPolicy::RUN_ON_CALLER);
+
+    executor.Submit([&gate] { gate.Wait(); });
+    ASSERT_TRUE(gate.WaitForWaiters(1));
+    ASSERT_TRUE(executor.Submit([] {}));
+
+    std::thread::id ranOn;
+    ASSERT_TRUE(executor.Submit([&ranOn] { ranOn = std::this_thread::get_id(); }));
+    ASSERT_EQ(std::this_thread::get_id(), ranOn);
+    gate.Open();
+}
+
+TEST(PooledThreadExecutorTest, TestBlockPolicy)
+{
+    Gate gate;
+    CompletionCounter completed;
+    PooledThreadExecutor executor(1, 1, OverflowPolicy::BLOCK);
+
+    executor.Submit([&gate] { gate.Wait(); });
+    ASSERT_TRUE(gate.WaitForWaiters(1));
+    ASSERT_TRUE(executor.Submit([&completed] { completed.Increment(); }));
+
+    std::atomic<bool> submitted(false);
+    std::thread producer([&] {
+        executor.Submit([&completed] { completed.Increment(); });
+        submitted = true;
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_FALSE(submitted);
+
+    gate.Open();
+    producer.join();
+    ASSERT_TRUE(submitted);
+    ASSERT_TRUE(completed.WaitFor(2));
+}
+
+TEST(PooledThreadExecutorTest, TestShutdownDrainsQueuedTasks)
+{
+    AWS_BEGIN_MEMORY_TEST(16, 10)
+
+    Gate gate;
+    CompletionCounter completed;
+    PooledThreadExecutor executor(1);
+
+    executor.Submit([&gate] { gate.Wait(); });
+    ASSERT_TRUE(gate.WaitForWaiters(1));
+    for (unsigned i = 0; i < 100; ++i)
+    {
+        executor.Submit([&completed] { completed.Increment(); });
+    }
+
+    gate.Open();
+    executor.Shutdown();
+    ASSERT_EQ(100u, completed.Get());
+    ASSERT_FALSE(executor.Submit([] {}));
+
+    AWS_END_MEMORY_TEST
+}
+
+TEST(PooledThreadExecutorTest, TestElasticPoolGrowsAndShrinks)
+{
+    Gate gate;
+    PooledThreadExecutor executor(1, 4, std::chrono::milliseconds(20));
+
+    //four tasks that only finish together need four workers at once.
+    for (unsigned i = 0; i < 4; ++i)
+    {
+        executor.Submit([&gate] { gate.Wait(); });
+    }
+    ASSERT_TRUE(gate.WaitForWaiters(4));
+    ASSERT_EQ(4u, executor.GetPoolSize());
+    gate.Open();
+
+    for (unsigned i = 0; i < 500 && executor.GetPoolSize() > 1; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    ASSERT_EQ(1u, executor.GetPoolSize());
+
+    //the pool grows again after shrinking.
+    Gate secondGate;
+    for (unsigned i = 0; i < 3; ++i)
+    {
+        executor.Submit([&secondGate] { secondGate.Wait(); });
+    }
+    ASSERT_TRUE(secondGate.WaitForWaiters(3));
+    secondGate.Open();
+}
+
+TEST(PooledThreadExecutorTest, TestWorksAsClientExecutor)
+{
+    std::shared_ptr<Executor> executor = Aws::MakeShared<PooledThreadExecutor>(ALLOCATION_TAG, 2);
+    CompletionCounter completed;
+    ASSERT_TRUE(executor->Submit([&completed](unsigned value) { if (value == 42) completed.Increment(); }, 42u));
+    ASSERT_TRUE(completed.WaitFor(1));
+}
+
+static void RunSubmitBenchmark(const char* name, Executor& executor, unsigned taskCount)
+{
+    CompletionCounter completed;
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < taskCount; ++i)
+    {
+        executor.Submit([&completed] { completed.Increment(); });
+    }
+    auto submitted = std::chrono::steady_clock::now();
+    ASSERT_TRUE(completed.WaitFor(taskCount));
+    auto finished = std::chrono::steady_clock::now();
+
+    double submitNs = static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(submitted - start).count()) / taskCount;
+    double seconds = std::chrono::duration_cast<std::chrono::duration<double>>(finished - start).count();
+    printf("[ BENCH    ] %s: %.0f ns per submit, %.0f tasks/s\n", name, submitNs, taskCount / seconds);
+}
+
+TEST(PooledThreadExecutorTest, DISABLED_BenchmarkAgainstDefaultExecutor)
+{
+    static const unsigned TASK_COUNT = 5000;
+
+    DefaultExecutor defaultExecutor;
+    RunSubmitBenchmark("DefaultExecutor", defaultExecutor, TASK_COUNT);
+
+    PooledThreadExecutor pooledExecutor(4);
+    RunSubmitBenchmark("PooledThreadExecutor", pooledExecutor, TASK_COUNT);
+
+    PooledThreadExecutor boundedExecutor(4, 64, OverflowPolicy::BLOCK);
+    RunSubmitBenchmark("PooledThreadExecutor (64 queued, block)", boundedExecutor, TASK_COUNT);
+}
@@ -88,10 +88,40 @@ namespace Aws
         * get closure for data sent event
         */
         inline virtual const Aws::Http::DataSentEventHandler& GetDataSentEventHandler() const { return m_onDataSent; }
+        /**
+         * Push the body of a successful response to consumer chunk by chunk as it arrives, instead of writing it into the
+         * response stream. The consumer can pause the transfer to keep memory flat while it catches up.
+         */
+        inline void SetStreamingResponseConsumer(const std::shared_ptr<Aws::Http::StreamingResponseConsumer>& consumer) { m_streamingConsumer = consumer; }
+        /**
+         * get the consumer successful response bodies are pushed to, nullptr if they go to the response stream.
+         */
+        inline const std::shared_ptr<Aws::Http::StreamingResponseConsumer>& GetStreamingResponseConsumer() const { return m_streamingConsumer; }
         /**
          * If this is set to true, content-md5 needs to be computed and set on the request
          */
         inline virtual bool ShouldComputeContentMd5() const { return false; }
+        /**
+         * Hands the client digests that were already computed over the body, e.g. by a caller that had to read it anyway,
+         * so it doesn't have to read the body again. They are trusted as they are and must describe exactly the bytes GetBody() returns.
+         */
+        inline void SetPayloadDigests(const std::shared_ptr<Aws::Utils::Crypto::PayloadDigests>& digests) { m_payloadDigests = digests; }
+        /**
+         * get the digests set by SetPayloadDigests, nullptr if there are none.
+         */
+        inline const std::shared_ptr<Aws::Utils::Crypto::PayloadDigests>& GetPayloadDigests() const { return m_payloadDigests; }
+        /**
+         * Overrides ClientConfiguration::payloadSigningMode for this request, e.g. to skip hashing one large upload over https.
+         */
+        inline void SetPayloadSigningMode(Aws::Http::PayloadSigningMode mode) { m_payloadSigningMode = mode; m_payloadSigningModeHasBeenSet = true; }
+        /**
+         * get the payload signing mode set by SetPayloadSigningMode.
+         */
+        inline Aws::Http::PayloadSigningMode GetPayloadSigningMode() const { return m_payloadSigningMode; }
+        /**
+         * true if SetPayloadSigningMode was called, otherwise the client's mode applies.
+         */
+        inline bool PayloadSigningModeHasBeenSet() const { return m_payloadSigningModeHasBeenSet; }
 
 
     private:
@@ -100,6 +130,10 @@ namespace Aws
 
         Aws::Http::DataReceivedEventHandler m_onDataReceived;
         Aws::Http::DataSentEventHandler m_onDataSent;
+        std::shared_ptr<Aws::Http::StreamingResponseConsumer> m_streamingConsumer;
+        std::shared_ptr<Aws::Utils::Crypto::PayloadDigests> m_payloadDigests;
+        Aws::Http::PayloadSigningMode m_payloadSigningMode;
+        bool m_payloadSigningModeHasBeenSet;
     };
 
 } // namespace Aws
@@ -18,9 +18,16 @@
 #include <aws/core/Core_EXPORTS.h>
 
 #include <aws/core/Region.h>
+#include <aws/core/http/HttpTypes.h>
+#include <aws/core/http/Scheme.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/crypto/ImplementationPool.h>
 #include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
+#include <ctime>
 #include <memory>
+#include <mutex>
 
 namespace Aws
 {
@@ -28,15 +35,17 @@ namespace Aws
     {
         class HttpClientFactory;
         class HttpRequest;
+        class URI;
     } // namespace Http
 
     namespace Utils
     {
-        namespace Crypto
+        class StringBuilderBase;
+
+        namespace Threading
         {
-            class Sha256;
-            class Sha256HMAC;
-        } // namespace Crypto
+            class Executor;
+        } // namespace Threading
     } // namespace Utils
 
     namespace Auth
@@ -67,11 +76,35 @@ namespace Aws
              * The URI can then be used in a normal HTTP call until expiration.
              */
             virtual bool PresignRequest(Aws::Http::HttpRequest& request, long long expirationInSeconds) const = 0;
+
+            /**
+             * Presigns one URI per entry of paths: uri with its path replaced by that entry, signed as PresignRequest would.
+             * urls receives them in the order of paths, or is left empty if signing failed. executor, if not nullptr, may be used
+             * to sign parts of the batch in parallel. The default presigns the URIs one at a time.
+             */
+            virtual bool PresignUrls(const Aws::Http::URI& uri, Aws::Http::HttpMethod method, const Aws::Vector<Aws::String>& paths,
+                Aws::Vector<Aws::String>& urls, long long expirationInSeconds = 0, Aws::Utils::Threading::Executor* executor = nullptr) const;
+
+            /**
+             * Whether SignRequest reads the body of a request sent with payloadSigningMode over scheme to hash it with sha256.
+             * Clients only compute that hash up front, along with the body's md5, when this is true. The default is false.
+             */
+            virtual bool SignsPayloadHash(Aws::Http::PayloadSigningMode payloadSigningMode, Aws::Http::Scheme scheme) const;
         };
 
         /**
          * AWS Auth v4 Signer implementation of the AWSAuthSigner interface. More information on AWS Auth v4 Can be found here:
          * http://docs.aws.amazon.com/AmazonS3/latest/API/sig-v4-authenticating-requests.html
+         *
+         * The derived signing key only changes with the day and the secret key, so it is cached per (secret, date) and a request
+         * costs one HMAC for the signature instead of five. The timestamp is likewise formatted at most once per second.
+         * Region and service are fixed for a signer, so they don't need to be part of the cache key.
+         *
+         * Requests whose payload signing mode is Aws::Http::PayloadSigningMode::STREAMING_SIGNED are signed without reading the body:
+         * the headers are signed as STREAMING-AWS4-HMAC-SHA256-PAYLOAD and the body is swapped for a ChunkSigningRequestBody that
+         * signs each chunk on its way out. The body's length must be known up front, from the content-length header or by seeking
+         * its stream, otherwise signing fails. With Aws::Http::PayloadSigningMode::UNSIGNED_OVER_HTTPS, https requests sign UNSIGNED-PAYLOAD
+         * and the body isn't hashed at all.
          */
         class AWS_CORE_API AWSAuthV4Signer : public AWSAuthSigner
         {
@@ -99,16 +132,59 @@ namespace Aws
             */
             bool PresignRequest(Aws::Http::HttpRequest& request, long long expirationInSeconds = 0) const override;
 
+            /**
+            * Presigns a batch of URIs that only differ by path. The credentials, timestamp, signing key and every part of the
+            * canonical request but the path are worked out once for the whole batch, so each URI costs one sha256 and one hmac.
+            * The paths are URL encoded in the returned URIs. With an executor, batches of more than a few hundred paths are split
+            * between the calling thread and tasks on the executor; the calling thread signs whatever the executor doesn't get to.
+            */
+            bool PresignUrls(const Aws::Http::URI& uri, Aws::Http::HttpMethod method, const Aws::Vector<Aws::String>& paths,
+                Aws::Vector<Aws::String>& urls, long long expirationInSeconds = 0, Aws::Utils::Threading::Executor* executor = nullptr) const override;
+
+            /**
+            * True unless the body is streamed with chunk signatures or left unsigned over https.
+            */
+            bool SignsPayloadHash(Aws::Http::PayloadSigningMode payloadSigningMode, Aws::Http::Scheme scheme) const override;
+
         private:
+            struct PresignedUrlTemplate;
+
+            struct SigningKeyCacheEntry
+            {
+                uint64_t secretFingerprint;
+                Aws::String simpleDate;
+                Aws::Utils::ByteBuffer signingKey;
+            };
+
+            //enough for a credentials rotation straddling a day boundary.
+            static const size_t MAX_CACHED_SIGNING_KEYS = 4;
+
             Aws::String GenerateSignature(const Aws::Auth::AWSCredentials& credentials, const Aws::String& stringToSign, const Aws::String& simpleDate) const;
+            Aws::Utils::ByteBuffer GetSigningKey(const Aws::String& secretKey, const Aws::String& simpleDate) const;
+            Aws::Utils::ByteBuffer ComputeSigningKey(const Aws::String& secretKey, const Aws::String& simpleDate) const;
+            void GetSigningDates(Aws::String& longDate, Aws::String& simpleDate) const;
             Aws::String ComputePayloadHash(Aws::Http::HttpRequest&) const;
+            bool PrepareStreamingPayloadHeaders(Aws::Http::HttpRequest& request) const;
             Aws::String GenerateStringToSign(const Aws::String& dateValue, const Aws::String& simpleDate, const Aws::String& canonicalRequestHash) const;
+            void AppendCredentialScope(Aws::Utils::StringBuilderBase& builder, const Aws::String& simpleDate) const;
+            void AddPresignQueryParameters(Aws::Http::URI& uri, const Aws::Auth::AWSCredentials& credentials, const Aws::String& longDate,
+                const Aws::String& simpleDate, long long expirationInSeconds) const;
+            bool PresignUrlRange(const PresignedUrlTemplate& urlTemplate, const Aws::Vector<Aws::String>& paths, Aws::Vector<Aws::String>& urls,
+                size_t begin, size_t end) const;
 
             std::shared_ptr<Auth::AWSCredentialsProvider> m_credentialsProvider;
             Aws::String m_serviceName;
             Aws::String m_region;
-            Aws::UniquePtr<Aws::Utils::Crypto::Sha256> m_hash;
-            Aws::UniquePtr<Aws::Utils::Crypto::Sha256HMAC> m_HMAC;
+            //requests are signed concurrently from the executor threads, so every computation leases its own implementation.
+            Aws::Utils::Crypto::HashPool m_hashPool;
+            Aws::Utils::Crypto::HMACPool m_HMACPool;
+
+            mutable std::mutex m_signingKeyMutex;
+            mutable Aws::Vector<SigningKeyCacheEntry> m_signingKeys;
+
+            mutable std::mutex m_dateMutex;
+            mutable std::time_t m_cachedDateSecond;
+            mutable Aws::String m_cachedLongDate;
         };
 
     } // namespace Client
@@ -18,12 +18,16 @@
 
 #include <aws/core/Core_EXPORTS.h>
 
+#include <aws/core/utils/FileSystemUtils.h>
 #include <aws/core/utils/UnreferencedParam.h>
 #include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
+#include <atomic>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <thread>
 
 namespace Aws
 {
@@ -149,6 +153,13 @@ namespace Aws
              */
             virtual AWSCredentials GetAWSCredentials() = 0;
 
+            /**
+             * Returns the current credentials as an immutable snapshot. Signers call this for every request, so providers that cache
+             * credentials should override it to hand out the cached snapshot without taking a lock or copying strings.
+             * The default implementation wraps the result of GetAWSCredentials().
+             */
+            virtual std::shared_ptr<const AWSCredentials> GetAWSCredentialsSnapshot();
+
         protected:
             /**
              * The default implementation keeps up with the cache times and lets you know if it's time to refresh your internal caching
@@ -184,30 +195,31 @@ namespace Aws
             /**
              * Initializes object from awsAccessKeyId, awsSecretAccessKey, and sessionToken parameters. sessionToken parameter is defaulted to empty.
              */
-            inline SimpleAWSCredentialsProvider(const Aws::String& awsAccessKeyId, const Aws::String& awsSecretAccessKey, const Aws::String& sessionToken = "")
-                : m_accessKeyId(awsAccessKeyId), m_secretAccessKey(awsSecretAccessKey), m_sessionToken(sessionToken)
-            { }
+            SimpleAWSCredentialsProvider(const Aws::String& awsAccessKeyId, const Aws::String& awsSecretAccessKey, const Aws::String& sessionToken = "");
 
             /**
             * Initializes object from credentials object. everything is copied.
             */
-            inline SimpleAWSCredentialsProvider(const AWSCredentials& credentials)
-                : m_accessKeyId(credentials.GetAWSAccessKeyId()), m_secretAccessKey(credentials.GetAWSSecretKey()),
-                m_sessionToken(credentials.GetSessionToken())
-            { }
+            SimpleAWSCredentialsProvider(const AWSCredentials& credentials);
 
             /**
              * Returns the credentials this object was initialized with as an AWSCredentials object.
              */
             inline AWSCredentials GetAWSCredentials() override
             {
-                return AWSCredentials(m_accessKeyId, m_secretAccessKey, m_sessionToken);
+                return *m_credentials;
+            }
+
+            /**
+             * Returns the snapshot built at construction.
+             */
+            inline std::shared_ptr<const AWSCredentials> GetAWSCredentialsSnapshot() override
+            {
+                return m_credentials;
             }
 
         private:
-            Aws::String m_accessKeyId;
-            Aws::String m_secretAccessKey;
-            Aws::String m_sessionToken;
+            std::shared_ptr<const AWSCredentials> m_credentials;
         };
 
         /**
@@ -225,7 +237,8 @@ namespace Aws
         };
 
         /**
-        * Reads credentials profile from the default Profile Config File. Refreshes at set interval for credential rotation.
+        * Reads credentials profile from the default Profile Config File. At the set interval the file is stat'ed for credential rotation,
+        * and it is only reparsed when its modification time, inode or size changed.
         * Looks for environment variables AWS_SHARED_CREDENTIALS_FILE and AWS_PROFILE. If they aren't found, then it defaults
         * to ~/.aws/credentials and default. Optionally a user can specify the profile and it will override the environment variable
         * and defaults. To alter the file this pulls from, then the user should alter the AWS_SHARED_CREDENTIALS_FILE variable.
@@ -235,13 +248,13 @@ namespace Aws
         public:
 
             /**
-            * Initializes with refreshRateMs as the frequency at which the file is reparsed in milliseconds. Defaults to 1 minute.
+            * Initializes with refreshRateMs as the frequency at which the file is checked for changes in milliseconds. Defaults to 15 minutes.
             */
             ProfileConfigFileAWSCredentialsProvider(long refreshRateMs = REFRESH_THRESHOLD);
 
             /**
             * Initializes with a profile override and
-            * refreshRateMs as the frequency at which the file is reparsed in milliseconds. Defaults to 1 minute.
+            * refreshRateMs as the frequency at which the file is checked for changes in milliseconds. Defaults to 15 minutes.
             */
             ProfileConfigFileAWSCredentialsProvider(const char* profile, long refreshRateMs = REFRESH_THRESHOLD);
 
@@ -250,6 +263,11 @@ namespace Aws
             */
             AWSCredentials GetAWSCredentials() override;
 
+            /**
+            * Returns the cached credentials. Outside of the periodic file check this takes no lock.
+            */
+            std::shared_ptr<const AWSCredentials> GetAWSCredentialsSnapshot() override;
+
             /**
              * Returns the fullpath of the calculated profile file
              */
@@ -268,21 +286,28 @@ namespace Aws
         private:
 
             /**
-            * Checks to see if the refresh interval has expired and reparses the file if it has.
+            * Reparses the file if it changed since it was last read, or if nothing has been read yet.
             */
-            void RefreshIfExpired();
+            void RefreshIfChanged();
             static Aws::Map<Aws::String, Aws::String> ParseProfileConfigFile(const Aws::String& filename);
 
             Aws::String m_fileName;
             Aws::String m_profileToUse;
-            std::shared_ptr<AWSCredentials> m_credentials;
+            //only ever replaced as a whole with std::atomic_store, readers go through std::atomic_load.
+            std::shared_ptr<const AWSCredentials> m_credentials;
+            Aws::Utils::FileStamp m_fileStamp;
             mutable std::mutex m_reloadMutex;
             long m_loadFrequencyMs;
+            std::atomic<long long> m_lastCheckedMs;
         };
 
         /**
         * Credentials provider implementation that loads credentials from the Amazon
         * EC2 Instance Metadata Service.
+        *
+        * Only the very first call blocks on the metadata service. After that a background thread refreshes the credentials
+        * every refreshRateMs, or earlier when the Expiration reported by the service is getting close, and callers keep getting
+        * the last good credentials while a refresh is in flight or if it fails.
         */
         class AWS_CORE_API InstanceProfileCredentialsProvider : public AWSCredentialsProvider
         {
@@ -299,18 +324,41 @@ namespace Aws
              */
             InstanceProfileCredentialsProvider(const std::shared_ptr<Internal::EC2MetadataClient>&, long refreshRateMs = REFRESH_THRESHOLD);
 
+            /**
+            * Stops the background refresh. If a request to the metadata service is in flight, this waits for it to finish or time out.
+            */
+            ~InstanceProfileCredentialsProvider();
+
             /**
             * Retrieves the credentials if found, otherwise returns empty credential set.
             */
             AWSCredentials GetAWSCredentials() override;
 
+            /**
+            * Returns the cached credentials without taking a lock, once the first load has completed.
+            */
+            std::shared_ptr<const AWSCredentials> GetAWSCredentialsSnapshot() override;
+
         private:
-            void RefreshIfExpired();
+            /**
+            * Pulls credentials from the metadata service and publishes them. Keeps the previous credentials if the pull fails.
+            * Callers must hold m_reloadMutex.
+            */
+            void Reload();
+            void RefreshLoop();
+            long long ComputeRefreshDelayMs() const;
 
             std::shared_ptr<Internal::EC2MetadataClient> m_metadataClient;
-            std::shared_ptr<AWSCredentials> m_credentials;
+            //only ever replaced as a whole with std::atomic_store, readers go through std::atomic_load.
+            std::shared_ptr<const AWSCredentials> m_credentials;
+            long long m_expirationMs;
             long m_loadFrequencyMs;
             mutable std::mutex m_reloadMutex;
+
+            std::mutex m_refreshMutex;
+            std::condition_variable m_refreshSignal;
+            bool m_stopRefreshing;
+            std::thread m_refreshThread;
         };
     } // namespace Auth
 } // namespace Aws
@@ -18,6 +18,7 @@
 #include <aws/core/Core_EXPORTS.h>
 #include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <atomic>
 #include <memory>
 
 namespace Aws
@@ -27,6 +28,7 @@ namespace Aws
         /**
          * Abstract class for providing chains of credentials providers. When a credentials provider in the chain returns empty credentials,
          * We go on to the next provider until we have either exhausted the installed providers in the chain or something returns non-empty credentials.
+         * The provider that succeeded is remembered and asked first from then on; the whole chain is only walked again once it comes back empty.
          */
         class AWS_CORE_API AWSCredentialsProviderChain : public AWSCredentialsProvider
         {
@@ -39,11 +41,16 @@ namespace Aws
              */
             virtual AWSCredentials GetAWSCredentials();
 
+            /**
+             * Same as GetAWSCredentials(), but hands out the snapshot of whichever provider answered.
+             */
+            std::shared_ptr<const AWSCredentials> GetAWSCredentialsSnapshot() override;
+
         protected:
             /**
              * This class is only allowed to be initialized by subclasses.
              */
-            AWSCredentialsProviderChain() = default;
+            AWSCredentialsProviderChain() : m_lastUsedProvider(-1) {}
 
             /**
              * Adds a provider to the back of the chain.
@@ -52,6 +59,8 @@ namespace Aws
 
         private:            
             Aws::Vector<std::shared_ptr<AWSCredentialsProvider> > m_providerChain;
+            //index of the provider that returned credentials last time, -1 until one has.
+            std::atomic<int> m_lastUsedProvider;
         };
 
         /**
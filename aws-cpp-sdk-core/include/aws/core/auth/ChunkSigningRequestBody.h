@@ -0,0 +1,100 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/http/HttpRequestBody.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <memory>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            class Hash;
+            class HMAC;
+        } // namespace Crypto
+    } // namespace Utils
+
+    namespace Client
+    {
+        /**
+         * Sends a request body aws-chunked (STREAMING-AWS4-HMAC-SHA256-PAYLOAD), signing every chunk as the http client reads it.
+         * Each chunk goes out as hex(size);chunk-signature=signature\r\n data \r\n, where the signature covers the chunk's sha256
+         * and the signature of the chunk before it, starting from the seed signature of the request headers. An empty chunk ends the body.
+         * More information can be found here: http://docs.aws.amazon.com/AmazonS3/latest/API/sigv4-streaming.html
+         */
+        class AWS_CORE_API ChunkSigningRequestBody : public Aws::Http::HttpRequestBody
+        {
+        public:
+            static const size_t DEFAULT_CHUNK_SIZE = 64 * 1024;
+
+            /**
+             * payload is the body to send, signingKey the derived SigV4 key, longDate and credentialScope the ones the seed signature
+             * was computed with. Every chunk but the last carries chunkSize bytes of payload.
+             */
+            ChunkSigningRequestBody(const std::shared_ptr<Aws::Http::HttpRequestBody>& payload, const Aws::Utils::ByteBuffer& signingKey,
+                const Aws::String& longDate, const Aws::String& credentialScope, const Aws::String& seedSignature,
+                size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+            ~ChunkSigningRequestBody();
+
+            /**
+             * Length of the encoded body for decodedLength bytes of payload, which is what Content-Length has to be set to.
+             * Returns -1 if decodedLength is -1.
+             */
+            static int64_t CalculateEncodedLength(int64_t decodedLength, size_t chunkSize = DEFAULT_CHUNK_SIZE);
+
+            /**
+             * Length of the encoded body, -1 if the payload can't tell its length.
+             */
+            int64_t GetLength() const override;
+            /**
+             * Copies up to size bytes of encoded body into buffer. Returns 0 at the end of the body, or if a chunk couldn't be signed.
+             */
+            std::size_t Read(char* buffer, std::size_t size) override;
+
+            /**
+             * Signature of the last chunk encoded so far, the seed signature before the first one.
+             */
+            inline const Aws::String& GetLastSignature() const { return m_previousSignature; }
+
+        private:
+            ChunkSigningRequestBody(const ChunkSigningRequestBody&) = delete;
+            ChunkSigningRequestBody& operator=(const ChunkSigningRequestBody&) = delete;
+
+            bool EncodeNextChunk();
+
+            std::shared_ptr<Aws::Http::HttpRequestBody> m_payload;
+            Aws::Utils::ByteBuffer m_signingKey;
+            Aws::String m_stringToSignPrefix;
+            Aws::String m_previousSignature;
+            size_t m_chunkSize;
+            std::shared_ptr<Aws::Utils::Crypto::Hash> m_hash;
+            std::shared_ptr<Aws::Utils::Crypto::HMAC> m_HMAC;
+            Aws::String m_chunk;
+            Aws::String m_frame;
+            size_t m_frameOffset;
+            bool m_finished;
+        };
+
+    } // namespace Client
+} // namespace Aws
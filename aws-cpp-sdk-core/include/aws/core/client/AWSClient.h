@@ -16,10 +16,15 @@
 #pragma once
 
 #include <aws/core/Core_EXPORTS.h>
+#include <aws/core/client/AWSError.h>
 #include <aws/core/client/CoreErrors.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/http/HttpHeaderCollection.h>
+#include <aws/core/http/Scheme.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 #include <aws/core/AmazonWebServiceResult.h>
+#include <aws/core/utils/crypto/ImplementationPool.h>
 #include <memory>
 #include <atomic>
 
@@ -47,8 +52,13 @@ namespace Aws
 
         namespace Crypto
         {
-            class MD5;
+            class PayloadDigests;
         } // namespace Crypto
+
+        namespace Threading
+        {
+            class Executor;
+        } // namespace Threading
     } // namespace Utils
 
     namespace Http
@@ -67,8 +77,6 @@ namespace Aws
     namespace Client
     {
 
-        template<typename ERROR_TYPE>
-        class AWSError;
         class AWSErrorMarshaller;
         class AWSRestfulJsonErrorMarshaller;
         class AWSAuthSigner;
@@ -78,6 +86,57 @@ namespace Aws
         typedef Utils::Outcome<std::shared_ptr<Aws::Http::HttpResponse>, AWSError<CoreErrors>> HttpResponseOutcome;
         typedef Utils::Outcome<AmazonWebServiceResult<Utils::Stream::ResponseStream>, AWSError<CoreErrors>> StreamOutcome;
 
+        /**
+         * The error a generated *Callable or *Async call completes with when the client's executor doesn't accept it.
+         */
+        AWS_CORE_API AWSError<CoreErrors> ExecutorRejectedError();
+
+        /**
+         * What generated *Callable methods hand Executor::SubmitWithFuture for a rejected call: the future holds an error outcome.
+         */
+        template<typename OutcomeT>
+        struct RejectedCallOutcome
+        {
+            template<typename ... Args>
+            OutcomeT operator()(const Args& ...) const { return OutcomeT(ExecutorRejectedError()); }
+        };
+
+        /**
+         * What generated *Async methods hand Executor::SubmitOrReject for a rejected call: the handler still gets called, on the
+         * calling thread, with an error outcome.
+         */
+        template<typename OutcomeT>
+        struct RejectedAsyncCall
+        {
+            template<typename ClientT, typename RequestT, typename HandlerT, typename ContextT>
+            void operator()(const ClientT* client, const RequestT& request, const HandlerT& handler, const ContextT& context) const
+            {
+                handler(client, request, OutcomeT(ExecutorRejectedError()), context);
+            }
+
+            template<typename ClientT, typename HandlerT, typename ContextT>
+            void operator()(const ClientT* client, const HandlerT& handler, const ContextT& context) const
+            {
+                handler(client, OutcomeT(ExecutorRejectedError()), context);
+            }
+        };
+
+        /**
+         * The parts of an http request that only depend on the AmazonWebServiceRequest: its headers, including content-length and
+         * content-md5, and its serialized body along with the body's digests. They are built once per logical request and reused by
+         * every attempt, so a retry only dates and signs a new http request instead of serializing and hashing the payload again.
+         */
+        struct AWS_CORE_API PreparedRequest
+        {
+            PreparedRequest() : bodyStart(-1) {}
+
+            Http::HttpHeaderCollection headers;
+            std::shared_ptr<Aws::IOStream> body;
+            //where each attempt starts reading the body from, -1 if the body can't be rewound.
+            long long bodyStart;
+            std::shared_ptr<Aws::Utils::Crypto::PayloadDigests> payloadDigests;
+        };
+
         /**
          * Abstract AWS Client. Contains most of the functionality necessary to build an http request, get it signed, and send it accross the wire.
          */
@@ -105,6 +164,14 @@ namespace Aws
              */
             Aws::String GeneratePresignedUrl(Aws::Http::URI& uri, Aws::Http::HttpMethod method, long long expirationInSeconds = 0);
 
+            /**
+             * Generates a signed Uri for each of paths, each being uri with its path replaced, in the order of paths. The signer
+             * shares the work that is the same for every path, and may spread the batch over executor. Returns an empty
+             * vector if signing failed.
+             */
+            Aws::Vector<Aws::String> GeneratePresignedUrls(const Aws::Http::URI& uri, const Aws::Vector<Aws::String>& paths,
+                Aws::Http::HttpMethod method, long long expirationInSeconds = 0, Aws::Utils::Threading::Executor* executor = nullptr);
+
             /**
              * Stop all requests immediately.
              * In flight requests will likely fail.
@@ -116,6 +183,12 @@ namespace Aws
              */
             void EnableRequestProcessing();
 
+            /**
+             * Whether the signer hashes the body of request with sha256 when it is sent to an endpoint of this client's
+             * configured scheme. Callers digesting the body anyway can compute that hash in the same read.
+             */
+            bool SignsPayloadHash(const Aws::AmazonWebServiceRequest& request) const;
+
         protected:
             /**
              * Calls AttemptOnRequest until it either, succeeds, runs out of retries from the retry strategy,
@@ -132,11 +205,12 @@ namespace Aws
             HttpResponseOutcome AttemptExhaustively(const Aws::String& uri, Http::HttpMethod httpMethod) const;
 
             /**
-             * Constructs and Http Request from the uri and AmazonWebServiceRequest object. Signs the request, sends it accross the wire
-             * then reports the http response.
+             * Constructs and Http Request from the uri, the AmazonWebServiceRequest object and the headers and body prepared from it.
+             * Signs the request, sends it accross the wire then reports the http response.
              */
             HttpResponseOutcome AttemptOneRequest(const Aws::String& uri,
                 const Aws::AmazonWebServiceRequest& request,
+                const PreparedRequest& preparedRequest,
                 Http::HttpMethod httpMethod) const;
 
             /**
@@ -160,10 +234,27 @@ namespace Aws
 
             /**
              * Transforms the AmazonWebServicesResult object into an HttpRequest.
+             * \deprecated Requests are no longer built through this overload: it prepares request and calls the overload
+             * taking a PreparedRequest, which is the one to override.
              */
             virtual void BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
                 const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest) const;
 
+            /**
+             * Serializes the headers and body of request, and works out the body's content-length and content-md5.
+             * payloadDigests, if any, receives the body's digests, including its sha256 if the signer will hash the body
+             * of a request sent over scheme.
+             */
+            PreparedRequest PrepareRequest(const Aws::AmazonWebServiceRequest& request, Aws::Http::Scheme scheme,
+                const std::shared_ptr<Aws::Utils::Crypto::PayloadDigests>& payloadDigests) const;
+
+            /**
+             * Transforms a request prepared by PrepareRequest into an HttpRequest, rewinding the body for another attempt.
+             * Called for every attempt at sending request, subclassing clients can override it to adjust the HttpRequest.
+             */
+            virtual void BuildHttpRequest(const Aws::AmazonWebServiceRequest& request, const PreparedRequest& preparedRequest,
+                const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest) const;
+
             /**
              *  Gets the underlying ErrorMarshaller for subclasses to use.
              */
@@ -173,9 +264,10 @@ namespace Aws
             }
 
         private:
-            void AddHeadersToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest, const Http::HeaderValueCollection& headerValues) const;
-            void AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest,
-                                         const std::shared_ptr<Aws::IOStream>& body, bool needsContentMd5 = false) const;
+            void AddHeadersToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest, const Http::HttpHeaderCollection& headerValues) const;
+            void PrepareContentBody(PreparedRequest& preparedRequest, bool needsContentMd5, bool needsPayloadHash) const;
+            Aws::Http::PayloadSigningMode GetPayloadSigningMode(const Aws::AmazonWebServiceRequest& request) const;
+            bool SignsPayloadHash(const Aws::AmazonWebServiceRequest& request, Aws::Http::Scheme scheme) const;
             void AddCommonHeaders(Aws::Http::HttpRequest& httpRequest) const;
             void InitializeGlobalStatics();
             void CleanupGlobalStatics();
@@ -189,7 +281,9 @@ namespace Aws
             std::shared_ptr<Aws::Utils::RateLimits::RateLimiterInterface> m_readRateLimiter;
             Aws::String m_userAgent;
             const char* m_hostHeaderOverride;
-            Aws::UniquePtr<Aws::Utils::Crypto::MD5> m_hash;
+            Aws::Http::PayloadSigningMode m_payloadSigningMode;
+            Aws::Http::Scheme m_scheme;
+            Aws::Utils::Crypto::HashPool m_md5Pool;
             static std::atomic<int> s_refCount;
         };
 
@@ -103,6 +103,7 @@ namespace Aws
             Aws::String proxyPassword;
             /**
             * Threading Executor implementation. Default uses std::thread::detach()
+            * Set a PooledThreadExecutor to run async calls on a bounded pool of threads instead.
             */
             std::shared_ptr<Aws::Utils::Threading::Executor> executor;
             /**
@@ -131,6 +132,37 @@ namespace Aws
              * If set to true the http stack will follow 300 redirect codes.
              */
             bool followRedirects;
+            /**
+             * Number of event loop threads used by multiplexing http clients such as TransferLibType::CURL_MULTI_CLIENT.
+             * Each thread can drive many connections at once. Default is 1.
+             */
+            unsigned ioThreads;
+            /**
+             * Pooled connections that have been idle for longer than this are closed. 0 keeps them open indefinitely. Default is 60000.
+             */
+            unsigned long idleConnectionTimeoutMs;
+            /**
+             * If set to true, curl clients negotiate HTTP/2 over ALPN and multiplex concurrent requests as streams over a few
+             * connections per endpoint. maxConnections then limits concurrent streams rather than sockets.
+             * Servers that only speak HTTP/1.1 still work, but get fewer connections. Default is false.
+             */
+            bool enableHttp2Multiplexing;
+            /**
+             * Number of concurrent streams to run over one HTTP/2 connection when enableHttp2Multiplexing is set. Default is 100.
+             */
+            unsigned maxStreamsPerConnection;
+            /**
+             * If set to true, curl clients send Accept-Encoding: gzip and inflate response bodies marked Content-Encoding gzip or
+             * deflate as they stream in, so the response stream and any StreamingResponseConsumer see the decoded bytes.
+             * Only available in builds with zlib. Default is false.
+             */
+            bool enableResponseCompression;
+            /**
+             * How requests with a content body are signed. PayloadSigningMode::STREAMING_SIGNED and PayloadSigningMode::UNSIGNED_OVER_HTTPS
+             * save hashing the body before sending it, but only S3 accepts them. Requests can override it with
+             * AmazonWebServiceRequest::SetPayloadSigningMode. Default is PayloadSigningMode::SIGNED.
+             */
+            Aws::Http::PayloadSigningMode payloadSigningMode;
         };
 
     } // namespace Client
@@ -0,0 +1,63 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+namespace Aws
+{
+    namespace Http
+    {
+        /**
+         * Streaming inflater for response bodies sent with Content-Encoding gzip or deflate. Compressed bytes are fed in as they
+         * come off the socket and decoded bytes come out right away, so nothing waits for the whole body.
+         */
+        class AWS_CORE_API GzipContentDecoder
+        {
+        public:
+            GzipContentDecoder();
+            ~GzipContentDecoder();
+
+            GzipContentDecoder(const GzipContentDecoder&) = delete;
+            GzipContentDecoder& operator=(const GzipContentDecoder&) = delete;
+
+            /**
+             * True if this build can inflate at all. Without zlib, Decode always fails.
+             */
+            static bool IsSupported();
+            /**
+             * True if contentEncoding (the value of a Content-Encoding header) is one this class decodes.
+             */
+            static bool CanDecode(const Aws::String& contentEncoding);
+
+            /**
+             * Inflates length bytes of data and appends the result to decoded. Returns false if the data is corrupt.
+             */
+            bool Decode(const char* data, std::size_t length, Aws::String& decoded);
+            /**
+             * True once the end of the compressed stream has been seen.
+             */
+            inline bool IsComplete() const { return m_complete; }
+
+        private:
+            //z_stream, kept opaque so zlib.h stays out of the public headers.
+            void* m_stream;
+            bool m_complete;
+        };
+
+    } // namespace Http
+} // namespace Aws
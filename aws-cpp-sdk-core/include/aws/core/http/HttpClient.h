@@ -21,6 +21,7 @@
 #include <atomic>
 #include <mutex>
 #include <condition_variable>
+#include <functional>
 
 namespace Aws
 {
@@ -37,6 +38,11 @@ namespace Aws
         class HttpRequest;
         class HttpResponse;
 
+        /**
+         * closure type for receiving the response (or nullptr on a connection failure) for a request submitted through MakeRequestAsync.
+         */
+        typedef std::function<void(const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>&)> HttpRequestCompletedHandler;
+
         /**
           * Abstract HttpClient. All it does is make HttpRequests and return their response.
           */
@@ -53,6 +59,16 @@ namespace Aws
                 Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
                 Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const = 0;
 
+            /**
+             * Takes an http request, makes it, and invokes onCompleted with the newly allocated HttpResponse.
+             * The default implementation simply calls MakeRequest on the calling thread. Event driven implementations
+             * return immediately and invoke onCompleted from one of their own threads.
+             */
+            virtual void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request,
+                const HttpRequestCompletedHandler& onCompleted,
+                Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+                Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const;
+
             /**
              * Stops all requests in progress and prevents any others from initiating.
              */
@@ -0,0 +1,98 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <cstring>
+
+namespace Aws
+{
+    namespace Http
+    {
+        /**
+         * Header storage for http requests and responses. Names are stored lower cased in one flat array kept sorted by name,
+         * which is also the order SigV4 signs them in. Lookups compare case insensitively against the stored names, so unlike
+         * a map keyed on lower cased copies, finding or replacing a header doesn't allocate.
+         * A request rarely carries more than a dozen headers, so the whole collection costs one allocation and a lookup is a
+         * short binary search over contiguous memory instead of a walk through tree nodes.
+         */
+        class AWS_CORE_API HttpHeaderCollection
+        {
+        public:
+            typedef Aws::Vector<HeaderValuePair> Storage;
+            typedef Storage::const_iterator const_iterator;
+
+            /**
+             * Capacity reserved on the first insert; enough for a typical signed request.
+             */
+            static const size_t INITIAL_CAPACITY = 16;
+
+            inline const_iterator begin() const { return m_headers.begin(); }
+            inline const_iterator end() const { return m_headers.end(); }
+            inline size_t size() const { return m_headers.size(); }
+            inline bool empty() const { return m_headers.empty(); }
+
+            /**
+             * Returns the value of the header with this name (any case), or nullptr if it isn't set.
+             */
+            const Aws::String* Find(const char* name, size_t nameLength) const;
+
+            inline const Aws::String* Find(const char* name) const { return Find(name, strlen(name)); }
+
+            inline const Aws::String* Find(const Aws::String& name) const { return Find(name.c_str(), name.length()); }
+
+            inline bool Contains(const char* name) const { return Find(name) != nullptr; }
+
+            /**
+             * Returns the value of the header with this name (any case), or an empty string if it isn't set.
+             */
+            const Aws::String& GetValue(const char* name) const;
+
+            /**
+             * Adds the header, or replaces its value if it is already set. Only adding a new name copies it.
+             */
+            void Set(const char* name, size_t nameLength, const char* value, size_t valueLength);
+
+            inline void Set(const char* name, const Aws::String& value) { Set(name, strlen(name), value.c_str(), value.length()); }
+
+            inline void Set(const Aws::String& name, const Aws::String& value) { Set(name.c_str(), name.length(), value.c_str(), value.length()); }
+
+            /**
+             * Removes the header with this name (any case). Returns false if it wasn't set.
+             */
+            bool Erase(const char* name);
+
+            inline void Clear() { m_headers.clear(); }
+
+            /**
+             * Copies the headers into a HeaderValueCollection, the map type result objects expose.
+             */
+            HeaderValueCollection ToMap() const;
+
+        private:
+            Storage::iterator LowerBound(const char* name, size_t nameLength);
+            Storage::const_iterator LowerBound(const char* name, size_t nameLength) const;
+
+            Storage m_headers;
+        };
+
+    } // namespace Http
+} // namespace Aws
@@ -19,6 +19,8 @@
 
 #include <aws/core/http/URI.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/http/HttpHeaderCollection.h>
+#include <aws/core/utils/crypto/PayloadDigests.h>
 #include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSStreamFwd.h>
 #include <aws/core/utils/stream/ResponseStream.h>
@@ -39,6 +41,7 @@ namespace Aws
         extern AWS_CORE_API const char* AWS_AUTHORIZATION_HEADER;
         extern AWS_CORE_API const char* COOKIE_HEADER;
         extern AWS_CORE_API const char* CONTENT_LENGTH_HEADER;
+        extern AWS_CORE_API const char* CONTENT_ENCODING_HEADER;
         extern AWS_CORE_API const char* CONTENT_TYPE_HEADER;
         extern AWS_CORE_API const char* USER_AGENT_HEADER;
         extern AWS_CORE_API const char* VIA_HEADER;
@@ -46,9 +49,12 @@ namespace Aws
         extern AWS_CORE_API const char* AMZ_TARGET_HEADER;
         extern AWS_CORE_API const char* X_AMZ_EXPIRES_HEADER;
         extern AWS_CORE_API const char* CONTENT_MD5_HEADER;
+        extern AWS_CORE_API const char* X_AMZ_CRC32_HEADER;
 
         class HttpRequest;
         class HttpResponse;
+        class HttpRequestBody;
+        class StreamingResponseConsumer;
 
         /**
          * closure type for recieving notifications that data has been recieved.
@@ -69,15 +75,19 @@ namespace Aws
              * Initializes an HttpRequest object with uri and http method.
              */
             HttpRequest(const URI& uri, HttpMethod method) :
-                m_uri(uri), m_method(method)
+                m_uri(uri), m_method(method), m_payloadSigningMode(PayloadSigningMode::SIGNED)
             {}
 
             virtual ~HttpRequest() {}
 
             /**
-             * Get All headers for this request.
+             * Get All headers for this request. This copies them into a map; prefer GetHeaderCollection.
              */
             virtual HeaderValueCollection GetHeaders() const = 0;
+            /**
+             * Get All headers for this request without copying them, sorted by (lower cased) name.
+             */
+            virtual const HttpHeaderCollection& GetHeaderCollection() const = 0;
             /**
              * Get the value for a Header based on its name.
              */
@@ -102,6 +112,16 @@ namespace Aws
              * Gets the content body stream that will be used for this request.
              */
             virtual const std::shared_ptr<Aws::IOStream>& GetContentBody() const = 0;
+            /**
+             * Gets the content body wrapped with its length and a seek free read interface, or nullptr if there is no body.
+             * This is what http clients should send from.
+             */
+            virtual const std::shared_ptr<HttpRequestBody>& GetRequestBody() const = 0;
+            /**
+             * Replaces what the http client sends with body, leaving the content body stream alone. Signers use this to
+             * wrap the body in a framing of their own.
+             */
+            virtual void SetRequestBody(const std::shared_ptr<HttpRequestBody>& body) = 0;
             /**
              * Returns true if a header exists in the request with name
              */
@@ -365,12 +385,40 @@ namespace Aws
              * Gets the closure for receiving events when data is sent to the server.
              */
             inline const DataSentEventHandler& GetDataSentEventHandler() const { return onDataSent; }
+            /**
+             * Sets the consumer that successful response bodies are pushed to as they arrive, instead of the response stream.
+             */
+            inline void SetStreamingResponseConsumer(const std::shared_ptr<StreamingResponseConsumer>& consumer) { m_streamingConsumer = consumer; }
+            /**
+             * Gets the consumer that successful response bodies are pushed to, nullptr if the body goes to the response stream.
+             */
+            inline const std::shared_ptr<StreamingResponseConsumer>& GetStreamingResponseConsumer() const { return m_streamingConsumer; }
+            /**
+             * Sets the digest cache for the content body. It is shared by every attempt of the same logical request, so digests
+             * computed by the client or the signer on the first attempt are reused by the retries.
+             */
+            inline void SetPayloadDigests(const std::shared_ptr<Aws::Utils::Crypto::PayloadDigests>& digests) { m_payloadDigests = digests; }
+            /**
+             * Gets the digest cache for the content body, nullptr if digests aren't cached for this request.
+             */
+            inline const std::shared_ptr<Aws::Utils::Crypto::PayloadDigests>& GetPayloadDigests() const { return m_payloadDigests; }
+            /**
+             * Sets how the signer should cover the content body. Defaults to PayloadSigningMode::SIGNED.
+             */
+            inline void SetPayloadSigningMode(PayloadSigningMode mode) { m_payloadSigningMode = mode; }
+            /**
+             * Gets how the signer should cover the content body.
+             */
+            inline PayloadSigningMode GetPayloadSigningMode() const { return m_payloadSigningMode; }
 
         private:
             URI m_uri;
             HttpMethod m_method;
             DataReceivedEventHandler onDataReceived;
             DataSentEventHandler onDataSent;
+            std::shared_ptr<StreamingResponseConsumer> m_streamingConsumer;
+            std::shared_ptr<Aws::Utils::Crypto::PayloadDigests> m_payloadDigests;
+            PayloadSigningMode m_payloadSigningMode;
 
         };
 
@@ -0,0 +1,64 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <memory>
+
+namespace Aws
+{
+    namespace Http
+    {
+        /**
+         * The content body of a request as the http layer sends it. Wraps the stream handed to HttpRequest::AddContentBody,
+         * measures its length once, and reads it without seeking. Bodies held in an Aws::Utils::Stream::PreallocatedIOStream
+         * are read straight from memory; files and every other stream go through their stream buffer.
+         */
+        class AWS_CORE_API HttpRequestBody
+        {
+        public:
+            virtual ~HttpRequestBody() = default;
+
+            /**
+             * Picks the cheapest implementation for stream. Returns nullptr if stream is nullptr.
+             */
+            static std::shared_ptr<HttpRequestBody> Create(const std::shared_ptr<Aws::IOStream>& stream);
+
+            /**
+             * Number of bytes left to send, measured from the stream position at the first call and cached from then on.
+             * Returns -1 if the stream cannot tell.
+             */
+            virtual int64_t GetLength() const = 0;
+            /**
+             * Copies up to size bytes of unread body into buffer and returns how many were copied, 0 at the end of the body.
+             */
+            virtual std::size_t Read(char* buffer, std::size_t size) = 0;
+
+            /**
+             * The stream this body reads from.
+             */
+            inline const std::shared_ptr<Aws::IOStream>& GetStream() const { return m_stream; }
+
+        protected:
+            HttpRequestBody(const std::shared_ptr<Aws::IOStream>& stream) : m_stream(stream) {}
+
+            std::shared_ptr<Aws::IOStream> m_stream;
+        };
+
+    } // namespace Http
+} // namespace Aws
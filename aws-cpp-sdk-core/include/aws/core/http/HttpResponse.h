@@ -125,7 +125,8 @@ namespace Aws
              */
             HttpResponse(const HttpRequest&  originatingRequest) :
                 httpRequest(originatingRequest),
-                responseCode(REQUEST_NOT_MADE)
+                responseCode(REQUEST_NOT_MADE),
+                checksumMismatch(false)
             {}
 
             virtual ~HttpResponse() = default;
@@ -136,9 +137,13 @@ namespace Aws
             virtual inline const HttpRequest& GetOriginatingRequest() const { return httpRequest; }
 
             /**
-             * Get the headers from this response
+             * Get the headers from this response. This copies them into a map; prefer GetHeaderCollection.
              */
             virtual HeaderValueCollection GetHeaders() const = 0;
+            /**
+             * Get the headers from this response without copying them, sorted by (lower cased) name.
+             */
+            virtual const HttpHeaderCollection& GetHeaderCollection() const = 0;
             /**
              * Returns true if the response contains a header by headerName
              */
@@ -176,6 +181,15 @@ namespace Aws
              * Sets the content type header on the http response object.
              */
             virtual void SetContentType(const Aws::String& contentType) { AddHeader("content-type", contentType); };
+            /**
+             * Marks the body as not matching the checksum the service sent with it (x-amz-crc32). The http client checks that
+             * while the body arrives; AWSClient turns such a response into a retryable error.
+             */
+            inline void SetChecksumMismatch(bool mismatch) { checksumMismatch = mismatch; }
+            /**
+             * True if the body did not match the checksum the service sent with it.
+             */
+            inline bool HasChecksumMismatch() const { return checksumMismatch; }
 
         private:
             HttpResponse(const HttpResponse&);
@@ -183,6 +197,7 @@ namespace Aws
 
             const HttpRequest& httpRequest;
             HttpResponseCode responseCode;
+            bool checksumMismatch;
         };
 
 
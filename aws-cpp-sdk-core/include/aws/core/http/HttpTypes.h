@@ -48,7 +48,24 @@ namespace Aws
             DEFAULT_CLIENT,
             CURL_CLIENT,
             WIN_INET_CLIENT,
-            WIN_HTTP_CLIENT
+            WIN_HTTP_CLIENT,
+            CURL_MULTI_CLIENT
+        };
+
+        /**
+         * How AWSAuthV4Signer covers the content body of a request.
+         * SIGNED hashes the whole body before the request is sent.
+         * STREAMING_SIGNED sends the body aws-chunked: the headers carry a seed signature and every chunk is signed as it is
+         * sent, chained to the signature before it, so the body is read once and sending starts right away. Only S3 accepts
+         * it, and the http client has to send from HttpRequest::GetRequestBody.
+         * UNSIGNED_OVER_HTTPS signs UNSIGNED-PAYLOAD in place of the body's hash when the request goes over https, leaving the
+         * integrity of the body to TLS and to Content-MD5 where the request carries one. Over http it falls back to SIGNED.
+         */
+        enum class AWS_CORE_API PayloadSigningMode
+        {
+            SIGNED,
+            STREAMING_SIGNED,
+            UNSIGNED_OVER_HTTPS
         };
 
         namespace HttpMethodMapper
@@ -0,0 +1,104 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/UnreferencedParam.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Http
+    {
+        class HttpResponse;
+
+        /**
+         * What a StreamingResponseConsumer wants done after looking at a chunk.
+         */
+        enum class StreamingConsumerAction
+        {
+            CONTINUE,
+            PAUSE
+        };
+
+        /**
+         * Receives the body of a successful (2xx) response chunk by chunk as it comes off the socket, instead of it being written
+         * into the response stream. Error responses are still buffered so the client can parse them into an AWSError.
+         *
+         * Returning PAUSE from OnDataReceived stops reading from the socket: the chunk counts as unconsumed and is offered again,
+         * in full, once Resume() has been called. The transfer's request timeout keeps running while it is paused. The blocking
+         * curl client keeps a paused transfer on its pooled connection and only notices a Resume() at its next progress tick, so
+         * it can take up to a second to pick up again; the multi client resumes right away.
+         *
+         * If a request is retried after part of the body was delivered, OnBodyStarted is called again and delivery starts over
+         * from the first byte.
+         */
+        class AWS_CORE_API StreamingResponseConsumer
+        {
+        public:
+            StreamingResponseConsumer();
+            virtual ~StreamingResponseConsumer() = default;
+
+            /**
+             * Called once per attempt, before the first chunk of a successful response body.
+             */
+            virtual void OnBodyStarted(const HttpResponse& response) { AWS_UNREFERENCED_PARAM(response); }
+            /**
+             * Called on the http client's thread with each chunk of the body. Must not block for long on the async clients,
+             * since other transfers share the thread; return PAUSE instead.
+             */
+            virtual StreamingConsumerAction OnDataReceived(const HttpResponse& response, const char* data, std::size_t length) = 0;
+
+            /**
+             * Lets a paused transfer continue. Safe to call from any thread, including from inside OnDataReceived.
+             */
+            void Resume();
+            /**
+             * True between OnDataReceived returning PAUSE and the next Resume().
+             */
+            inline bool IsPaused() const { return m_paused; }
+
+            /**
+             * Used by http clients: hands a chunk to OnDataReceived and records whether the consumer paused.
+             */
+            StreamingConsumerAction Deliver(const HttpResponse& response, const char* data, std::size_t length);
+            /**
+             * Used by http clients whose transfers are driven from a thread of their own. handler is invoked from Resume() so the
+             * client can unpause the transfer on that thread. Pass nullptr once the transfer is finished.
+             */
+            void SetResumeHandler(const std::function<void()>& handler);
+            /**
+             * Used by blocking http clients: waits until Resume() is called or timeout expires. Returns true if no longer paused.
+             */
+            bool WaitForResume(std::chrono::milliseconds timeout);
+
+        private:
+            StreamingResponseConsumer(const StreamingResponseConsumer&) = delete;
+            StreamingResponseConsumer& operator=(const StreamingResponseConsumer&) = delete;
+
+            std::atomic<bool> m_paused;
+            std::mutex m_resumeMutex;
+            std::condition_variable m_resumeSignal;
+            std::function<void()> m_resumeHandler;
+        };
+
+    } // namespace Http
+} // namespace Aws
@@ -25,6 +25,11 @@
 
 namespace Aws
 {
+    namespace Utils
+    {
+        class StringBuilderBase;
+    } // namespace Utils
+
     namespace Http
     {
         extern AWS_CORE_API const char* SEPARATOR;
@@ -117,7 +122,8 @@ namespace Aws
             Aws::String GetFormParameters() const;
 
             /**
-            * Cannonicalizes the query string.
+            * Cannonicalizes the query string: parameters are sorted by key and then value, and a parameter without a value
+            * gets an empty one ("acl" becomes "acl="). A query string without any '=' is left alone.
             */
             void CanonicalizeQueryString();
 
@@ -141,6 +147,10 @@ namespace Aws
              * URLEncodes the path portions of path (doesn't encode the "/" portion)
              */
             static Aws::String URLEncodePath(const Aws::String& path);
+            /**
+             * Same as URLEncodePath, but appends the encoded path to builder instead of returning a new string.
+             */
+            static void AppendURLEncodedPath(Aws::Utils::StringBuilderBase& builder, const char* path, size_t length);
 
         private:
             void ParseURIParts(const Aws::String& uri);
@@ -15,11 +15,15 @@
 
 #pragma once
 
-#include <aws/core/utils/memory/stl/AWSStack.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
+#include <atomic>
 #include <utility>
 #include <mutex>
 #include <condition_variable>
+#include <functional>
+#include <thread>
 #include <curl/curl.h>
 
 namespace Aws
@@ -28,30 +32,70 @@ namespace Http
 {
 
 /**
-  * Simple Connection pool manager for Curl. It maintains connections in a thread safe manner. You
-  * can call into acquire a handle, then put it back when finished. It is assumed that reusing an already
-  * initialized handle is preferable (especially for synchronous clients). The pool doubles in capacity as
-  * needed up to the maximum amount of connections.
+  * Snapshot of the counters kept by CurlHandleContainer.
+  */
+struct CurlHandlePoolStats
+{
+    //acquires served by an idle handle that was last used against the same endpoint.
+    uint64_t hits;
+    //acquires that had to create a handle or take one last used against another endpoint.
+    uint64_t misses;
+    //acquires that found the pool at its max size and had to block.
+    uint64_t waits;
+    //total time spent blocked in those acquires.
+    uint64_t waitTimeMicroseconds;
+    //idle handles closed by the reaper.
+    uint64_t reaped;
+    //handles currently owned by the pool, idle or in use.
+    unsigned poolSize;
+};
+
+/**
+  * Connection pool manager for Curl. Idle handles are kept per endpoint (scheme, host and port) so that a reused
+  * handle almost always still has a live keep-alive connection to the right host. Acquire and release are lock-free
+  * unless the pool is at its max size and every handle is in use, in which case acquire blocks until one is released.
+  * Handles idle for longer than the idle timeout are closed by a background reaper.
   */
 class CurlHandleContainer
 {
 public:
     /**
-      * Initializes an empty stack of CURL handles. If you are only making synchronous calls via your http client
-      * then a small size is best. For async support, a good value would be 6 * number of Processors.   *
+      * Initializes an empty pool of CURL handles. If you are only making synchronous calls via your http client
+      * then a small size is best. For async support, a good value would be 6 * number of Processors.
+      * idleTimeout is in milliseconds, 0 keeps idle handles forever.
       */
-    CurlHandleContainer(unsigned maxSize = 50, long requestTimeout = 3000, long connectTimeout = 1000);
+    CurlHandleContainer(unsigned maxSize = 50, long requestTimeout = 3000, long connectTimeout = 1000, unsigned long idleTimeout = 0);
     ~CurlHandleContainer();
 
     /**
-      * Blocks until a curl handle from the pool is available for use.
+      * Blocks until a curl handle from the pool is available for use. Handles previously released for endpoint are preferred.
       */
-    CURL* AcquireCurlHandle();
+    CURL* AcquireCurlHandle(const Aws::String& endpoint = "");
     /**
-      * Returns a handle to the pool for reuse. It is imperative that this is called
+      * Returns a handle to the pool for reuse against endpoint. It is imperative that this is called
       * after you are finished with the handle.
       */
-    void ReleaseCurlHandle(CURL* handle);
+    void ReleaseCurlHandle(CURL* handle, const Aws::String& endpoint = "");
+
+    /**
+      * Opens up to count new connections to endpoint ahead of traffic, without blocking on handles that are in use.
+      * setOptions must set the url and whatever tls/proxy options a real request would use. Each handle performs that request
+      * on its own thread, so the connections are made concurrently and stay open in the handles, which are then released
+      * into endpoint's idle list. Blocks until every connection attempt finished. Returns the number of handles added.
+      */
+    unsigned Prewarm(const Aws::String& endpoint, unsigned count, const std::function<void(CURL*)>& setOptions);
+
+    CurlHandlePoolStats GetStats() const;
+
+    /**
+      * Returns the process-wide share object that lets every curl handle reuse dns lookups and tls sessions, creating it
+      * on first use. Each call must be paired with ReleaseShareHandle once all handles using the share have been cleaned up.
+      */
+    static CURLSH* AcquireShareHandle();
+    /**
+      * Drops a reference taken by AcquireShareHandle. The share is destroyed with the last reference.
+      */
+    static void ReleaseShareHandle();
 
 private:
     CurlHandleContainer(const CurlHandleContainer&) = delete;
@@ -59,19 +103,61 @@ private:
     CurlHandleContainer(const CurlHandleContainer&&) = delete;
     const CurlHandleContainer& operator = (const CurlHandleContainer&&) = delete;
 
-    bool CheckAndGrowPool();
+    struct IdleSlot
+    {
+        std::atomic<CURL*> handle;
+        std::atomic<long long> releasedAt;
+    };
+
+    /**
+      * Idle handles for one endpoint. Every bucket has one slot per handle the pool may own, so a release never runs out of room.
+      */
+    struct EndpointBucket
+    {
+        EndpointBucket(const Aws::String& endpointKey, unsigned slotCount) : endpoint(endpointKey), slots(slotCount) {}
+
+        const Aws::String endpoint;
+        Aws::Vector<IdleSlot> slots;
+    };
+
+    EndpointBucket* FindOrCreateBucket(const Aws::String& endpoint);
+    CURL* TryPop(EndpointBucket* bucket);
+    void Push(EndpointBucket* bucket, CURL* handle);
+    CURL* TryCreateHandle();
+    CURL* TryStealHandle(EndpointBucket* exclude);
+    void NotifyWaiters();
+    void ReapIdleHandles();
     void SetDefaultOptionsOnHandle(void* handle);
+    void ResetRequestOptions(CURL* handle);
+
+    //fixed size open addressed table, buckets are published once and only freed by the destructor.
+    Aws::Vector<std::atomic<EndpointBucket*>> m_buckets;
+    std::mutex m_bucketCreationMutex;
 
-    Aws::Stack<CURL*> m_handleContainer;
     std::mutex m_handleContainerMutex;
     std::condition_variable m_conditionVariable;
+    std::atomic<unsigned> m_waiters;
+
     unsigned m_maxPoolSize;
     unsigned long m_requestTimeout;
     unsigned long m_connectTimeout;
-    unsigned m_poolSize;
+    unsigned long m_idleTimeout;
+    std::atomic<unsigned> m_poolSize;
+
+    std::atomic<uint64_t> m_hits;
+    std::atomic<uint64_t> m_misses;
+    std::atomic<uint64_t> m_waits;
+    std::atomic<uint64_t> m_waitTimeMicroseconds;
+    std::atomic<uint64_t> m_reaped;
+
+    std::mutex m_reaperMutex;
+    std::condition_variable m_reaperSignal;
+    bool m_stopReaper;
+    std::thread m_reaperThread;
+    CURLSH* m_shareHandle;
+
     static bool isInit;
 };
 
 } // namespace Http
 } // namespace Aws
-
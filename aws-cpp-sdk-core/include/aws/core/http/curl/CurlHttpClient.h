@@ -17,6 +17,8 @@
 #pragma once
 
 #include <aws/core/http/HttpClient.h>
+#include <aws/core/http/GzipContentDecoder.h>
+#include <aws/core/http/URI.h>
 #include <aws/core/http/curl/CurlHandleContainer.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
@@ -26,6 +28,66 @@ namespace Aws
 namespace Http
 {
 
+/**
+ * State handed to the libcurl write and header callbacks for a single transfer.
+ */
+struct CurlWriteCallbackContext
+{
+    CurlWriteCallbackContext(const HttpClient* client,
+                             HttpRequest* request,
+                             HttpResponse* response,
+                             Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter) :
+        m_client(client),
+        m_request(request),
+        m_response(response),
+        m_rateLimiter(rateLimiter),
+        m_curlHandle(nullptr),
+        m_bodyStarted(false),
+        m_paused(false),
+        m_decodeResponse(false),
+        m_processedChunkSize(0),
+        m_verifyCrc32(false),
+        m_expectedCrc32(0),
+        m_crc32(0)
+    {}
+
+    const HttpClient* m_client;
+    HttpRequest* m_request;
+    HttpResponse* m_response;
+    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
+    //the rest is only used when the request has a StreamingResponseConsumer.
+    CURL* m_curlHandle;
+    bool m_bodyStarted;
+    //true while curl holds the transfer paused on behalf of the consumer.
+    bool m_paused;
+    //the rest is only used when the client asked for compressed responses.
+    bool m_decodeResponse;
+    //set once the response turns out to be compressed.
+    Aws::UniquePtr<GzipContentDecoder> m_decoder;
+    //inflated bytes that have not been handed on yet.
+    Aws::String m_decoded;
+    //bytes curl is holding for a paused consumer that have already been checksummed and inflated into m_decoded.
+    size_t m_processedChunkSize;
+    //set once the response carries an x-amz-crc32 header; the checksum runs over the body as it came off the wire.
+    bool m_verifyCrc32;
+    uint32_t m_expectedCrc32;
+    uint32_t m_crc32;
+};
+
+/**
+ * State handed to the libcurl read callback for a single transfer.
+ */
+struct CurlReadCallbackContext
+{
+    CurlReadCallbackContext(const HttpClient* client, HttpRequest* request) :
+        m_client(client),
+        m_request(request)
+    {}
+
+    const HttpClient* m_client;
+    HttpRequest* m_request;
+};
+
 //Curl implementation of an http client. Right now it is only synchronous.
 class CurlHttpClient: public HttpClient
 {
@@ -37,7 +99,43 @@ public:
     CurlHttpClient(const Aws::Client::ClientConfiguration& clientConfig);
     //Makes request and receives response synchronously
     std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
-            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const;
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    //Opens up to count connections to the scheme, host and port of endpoint before traffic arrives. Returns how many were opened.
+    unsigned Prewarm(const URI& endpoint, unsigned count) const;
+    //Hit, miss and wait counters of the connection pool.
+    CurlHandlePoolStats GetConnectionPoolStats() const { return m_curlHandleContainer.GetStats(); }
+
+protected:
+    //Key the connection pool uses to keep handles for the same scheme, host and port together.
+    static Aws::String ComputeEndpointKey(const URI& uri);
+    //Computes the url to hand to curl. The path is url encoded here so that the signer and the http layer agree.
+    static Aws::String ComputeRequestUrl(const HttpRequest& request);
+    //Builds the header list for request. The caller owns the list and must free it with curl_slist_free_all.
+    static struct curl_slist* BuildHeaderList(const HttpRequest& request);
+    //Sets the tls, proxy and protocol options that every connection made by this client shares.
+    void SetConnectionOptionsOnHandle(CURL* connectionHandle) const;
+    //Sets the per request options (method, url, headers, callbacks, tls and proxy settings) on connectionHandle.
+    //url, headers and both contexts must outlive the transfer.
+    void SetRequestOptionsOnHandle(CURL* connectionHandle, HttpRequest& request, const Aws::String& url, struct curl_slist* headers,
+            CurlWriteCallbackContext& writeContext, CurlReadCallbackContext& readContext) const;
+    //Copies the response code and content type of a successfully finished transfer into response.
+    static void ReadResponseInfoFromHandle(CURL* connectionHandle, HttpResponse& response);
+    //Flags the response if its body did not match the x-amz-crc32 header. Call once the transfer has finished.
+    static void VerifyResponseChecksum(const CurlWriteCallbackContext& context);
+
+    //Callback to read the content from the content body of the request
+    static size_t ReadBody(char* ptr, size_t size, size_t nmemb, void* userdata);
+    //callback to write the content from the response to the response object
+    static size_t WriteData(char* ptr, size_t size, size_t nmemb, void* userdata);
+    //callback to write the headers from the response to the response
+    static size_t WriteHeader(char* ptr, size_t size, size_t nmemb, void* userdata);
+    //Unpauses a transfer paused by its StreamingResponseConsumer once the consumer has resumed. Only call on the thread driving the transfer.
+    static void ResumeIfConsumerResumed(CurlWriteCallbackContext& context);
+#if LIBCURL_VERSION_NUM >= 0x072000
+    //progress callback installed for requests with a StreamingResponseConsumer, it is how a paused curl_easy_perform notices a resume.
+    static int OnTransferProgress(void* userdata, curl_off_t downloadTotal, curl_off_t downloaded, curl_off_t uploadTotal, curl_off_t uploaded);
+#endif //LIBCURL_VERSION_NUM
 
 private:
     mutable CurlHandleContainer m_curlHandleContainer;
@@ -49,14 +147,8 @@ private:
     bool m_verifySSL;
     Aws::String m_caPath;
     bool m_allowRedirects;
-
-    //Callback to read the content from the content body of the request
-    static size_t ReadBody(char* ptr, size_t size, size_t nmemb, void* userdata);
-    //callback to write the content from the response to the response object
-    static size_t WriteData(char* ptr, size_t size, size_t nmemb, void* userdata);
-    //callback to write the headers from the response to the response
-    static size_t WriteHeader(char* ptr, size_t size, size_t nmemb, void* userdata);
-
+    bool m_enableHttp2;
+    bool m_enableResponseCompression;
 };
 
 using PlatformHttpClient = CurlHttpClient;
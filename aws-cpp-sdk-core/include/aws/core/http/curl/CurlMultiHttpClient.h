@@ -0,0 +1,78 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/http/curl/CurlHttpClient.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+
+namespace Aws
+{
+namespace Http
+{
+
+struct CurlMultiTransfer;
+
+/**
+ * Event driven curl implementation of an http client. Requests are multiplexed with curl_multi_socket_action
+ * over a small, fixed number of I/O threads (ClientConfiguration::ioThreads) instead of blocking one thread
+ * per request in curl_easy_perform. Requests beyond maxConnections are queued inside curl rather than
+ * blocking the caller.
+ *
+ * MakeRequestAsync returns immediately; its completion handler runs on one of the I/O threads and should not block.
+ * MakeRequest is kept for compatibility and simply waits for the asynchronous request to finish, so it must not
+ * be called from inside a completion handler.
+ */
+class CurlMultiHttpClient: public CurlHttpClient
+{
+public:
+
+    using Base = CurlHttpClient;
+
+    //Creates client and starts its I/O threads.
+    CurlMultiHttpClient(const Aws::Client::ClientConfiguration& clientConfig);
+    //Stops the I/O threads. Requests still in flight complete with a null response.
+    ~CurlMultiHttpClient();
+
+    //Makes request and waits for the response.
+    std::shared_ptr<HttpResponse> MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+    //Queues request on one of the I/O threads and returns immediately. onCompleted is invoked from that I/O thread.
+    void MakeRequestAsync(const std::shared_ptr<HttpRequest>& request, const HttpRequestCompletedHandler& onCompleted,
+            Aws::Utils::RateLimits::RateLimiterInterface* readLimiter = nullptr,
+            Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter = nullptr) const override;
+
+private:
+    class EventLoop;
+
+    CurlMultiHttpClient(const CurlMultiHttpClient&) = delete;
+    CurlMultiHttpClient& operator = (const CurlMultiHttpClient&) = delete;
+
+    void SubmitTransfer(CurlMultiTransfer* transfer) const;
+
+    //we need control over the order in which these get cleaned up
+    //that's why I'm not using unique_ptr here.
+    Aws::Vector<EventLoop*> m_eventLoops;
+    mutable std::atomic<unsigned> m_nextEventLoop;
+    long m_requestTimeout;
+    long m_connectTimeout;
+};
+
+} // namespace Http
+} // namespace Aws
+
@@ -42,6 +42,10 @@ namespace Aws
                  * Get All headers for this request.
                  */
                 virtual HeaderValueCollection GetHeaders() const override;
+                /**
+                 * Get All headers for this request without copying them.
+                 */
+                virtual inline const HttpHeaderCollection& GetHeaderCollection() const override { return headerMap; }
                 /**
                  * Get the value for a Header based on its name.
                  */                
@@ -61,11 +65,19 @@ namespace Aws
                 /**                 
                  * Adds a content body stream to the request. This stream will be used to send the body to the endpoint.
                  */               
-                virtual inline void AddContentBody(const std::shared_ptr<Aws::IOStream>& strContent) override { bodyStream = strContent; }
+                virtual void AddContentBody(const std::shared_ptr<Aws::IOStream>& strContent) override;
                 /**
                  * Gets the content body stream that will be used for this request.
                  */
                 virtual inline const std::shared_ptr<Aws::IOStream>& GetContentBody() const override { return bodyStream; }
+                /**
+                 * Gets the content body wrapped with its length and a seek free read interface.
+                 */
+                virtual inline const std::shared_ptr<HttpRequestBody>& GetRequestBody() const override { return m_requestBody; }
+                /**
+                 * Replaces the body the http client sends, leaving the content body stream alone.
+                 */
+                virtual inline void SetRequestBody(const std::shared_ptr<HttpRequestBody>& body) override { m_requestBody = body; }
                 /**
                  * Returns true if a header exists in the request with name
                  */
@@ -84,8 +96,9 @@ namespace Aws
                 virtual void SetResponseStreamFactory(const Aws::IOStreamFactory& factory) override;
 
             private:
-                HeaderValueCollection headerMap;
+                HttpHeaderCollection headerMap;
                 std::shared_ptr<Aws::IOStream> bodyStream;
+                std::shared_ptr<HttpRequestBody> m_requestBody;
                 Aws::IOStreamFactory m_responseStreamFactory;
             };
 
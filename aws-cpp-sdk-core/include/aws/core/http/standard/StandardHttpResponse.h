@@ -18,7 +18,6 @@
 #include <aws/core/Core_EXPORTS.h>
 
 #include <aws/core/http/HttpResponse.h>
-#include <aws/core/utils/memory/stl/AWSMap.h>
 #include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/utils/memory/stl/AWSString.h>
 
@@ -50,6 +49,10 @@ namespace Aws
                  * Get the headers from this response
                  */
                 HeaderValueCollection GetHeaders() const;
+                /**
+                 * Get the headers from this response without copying them
+                 */
+                inline const HttpHeaderCollection& GetHeaderCollection() const { return headerMap; }
                 /**
                  * Returns true if the response contains a header by headerName
                  */
@@ -75,7 +78,7 @@ namespace Aws
             private:
                 StandardHttpResponse(const StandardHttpResponse&);                
 
-                Aws::Map<Aws::String, Aws::String> headerMap;
+                HttpHeaderCollection headerMap;
                 Utils::Stream::ResponseStream bodyStream;
             };
 
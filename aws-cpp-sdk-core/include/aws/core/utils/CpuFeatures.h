@@ -0,0 +1,71 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+//kernels with vector versions build them under AWS_SIMD_X86 and mark each with the target of its instruction set, so they need no
+//-m flags; they are only called once CpuFeatures says the cpu has that instruction set.
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#define AWS_SIMD_X86
+#define AWS_SIMD_TARGET_SSSE3
+#define AWS_SIMD_TARGET_AVX2
+#define AWS_SIMD_TARGET_PCLMUL
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define AWS_SIMD_X86
+#define AWS_SIMD_TARGET_SSSE3 __attribute__((target("ssse3")))
+#define AWS_SIMD_TARGET_AVX2 __attribute__((target("avx2")))
+#define AWS_SIMD_TARGET_PCLMUL __attribute__((target("pclmul")))
+#endif
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * Vector instruction sets the kernels in this library come in, from slowest to fastest.
+         */
+        enum class SimdLevel
+        {
+            SCALAR,
+            SSSE3,
+            AVX2
+        };
+
+        /**
+         * Instruction set extensions of the cpu the process is running on. They are detected once, on first use, and are all
+         * false on builds for other architectures than x86, where the kernels are scalar only.
+         */
+        namespace CpuFeatures
+        {
+            AWS_CORE_API bool HasSSSE3();
+            AWS_CORE_API bool HasAVX2();
+            /**
+             * Carry-less multiplication, which the CRC32 kernel folds with. It isn't a SimdLevel, cpus have it independently of the vector width.
+             */
+            AWS_CORE_API bool HasPCLMUL();
+
+            /**
+             * The fastest level both this build and the running cpu support.
+             */
+            AWS_CORE_API SimdLevel GetBestSimdLevel();
+            /**
+             * true if kernels of level can run here.
+             */
+            AWS_CORE_API bool IsSupported(SimdLevel level);
+        } // namespace CpuFeatures
+    } // namespace Utils
+} // namespace Aws
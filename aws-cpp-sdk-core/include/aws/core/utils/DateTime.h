@@ -19,6 +19,7 @@
 
 #include <aws/core/utils/memory/stl/AWSString.h>
 
+#include <ctime>
 #include <mutex>
 
 namespace Aws
@@ -42,6 +43,11 @@ namespace Aws
             */
             static Aws::String CalculateGmtTimestampAsString(const char* formatStr);
 
+            /**
+            * Formats the given time (seconds since the epoch) as gmt and returns it as a string
+            */
+            static Aws::String CalculateGmtTimestampAsString(std::time_t time, const char* formatStr);
+
             /**
             * Calculates the current hour of the day in localtime.
             */
@@ -62,6 +68,12 @@ namespace Aws
             */
             static Aws::String ComputeCurrentDateInISO8601Format();
 
+            /**
+            * Parses an ISO-8601 timestamp such as 2016-06-01T12:00:00Z (fractional seconds and +hh:mm offsets are accepted)
+            * and returns milliseconds since the epoch. Returns 0 if the string can't be parsed.
+            */
+            static long long ConvertISO8601ToMillis(const char* timestamp);
+
         private:
             static std::mutex timeMutex;
         };
@@ -0,0 +1,62 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/CpuFeatures.h>
+
+#include <cstddef>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * Base64 (standard alphabet), hex and url encoding kernels with SSSE3 and AVX2 versions next to the scalar one. Each function takes
+         * the level to run at, which defaults to the fastest the cpu supports; asking for a level the cpu doesn't support is undefined.
+         * Base64::Base64, StringBuilderBase::AppendHexEncoded and StringBuilderBase::AppendURLEncoded go through these.
+         */
+        namespace EncodingKernels
+        {
+            /**
+             * Writes length bytes from data to out as padded base64, 4 * ((length + 2) / 3) chars.
+             */
+            AWS_CORE_API void Base64Encode(const unsigned char* data, size_t length, char* out,
+                SimdLevel level = CpuFeatures::GetBestSimdLevel());
+
+            /**
+             * Decodes base64 from in to out in whole vector-sized blocks, for as long as the blocks only hold chars of the alphabet,
+             * and returns the number of chars decoded, a multiple of 4 that 3 / 4 as many bytes were written for. The caller decodes
+             * the rest, which includes padding and anything invalid. The scalar level decodes nothing.
+             */
+            AWS_CORE_API size_t Base64DecodeBlocks(const char* in, size_t length, unsigned char* out,
+                SimdLevel level = CpuFeatures::GetBestSimdLevel());
+
+            /**
+             * Writes length bytes from data to out as lower case hex, 2 * length chars.
+             */
+            AWS_CORE_API void HexEncode(const unsigned char* data, size_t length, char* out,
+                SimdLevel level = CpuFeatures::GetBestSimdLevel());
+
+            /**
+             * Returns how many chars at the start of data are unreserved in the sense of RFC 3986 (A-Z, a-z, 0-9, '-', '_', '.', '~'),
+             * i.e. the index of the first char that has to be percent encoded, or length if there is none.
+             */
+            AWS_CORE_API size_t CountUnreservedPrefix(const char* data, size_t length,
+                SimdLevel level = CpuFeatures::GetBestSimdLevel());
+        } // namespace EncodingKernels
+    } // namespace Utils
+} // namespace Aws
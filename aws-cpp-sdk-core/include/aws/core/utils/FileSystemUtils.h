@@ -26,6 +26,27 @@ namespace Aws
 #else
         static const char PATH_DELIM = '/';
 #endif
+        /**
+         * Enough of a file's metadata to tell whether it has been rewritten, replaced or removed since it was last looked at.
+         */
+        struct AWS_CORE_API FileStamp
+        {
+            FileStamp() : exists(false), modifiedTimeNs(0), inode(0), size(0) {}
+
+            bool operator==(const FileStamp& other) const
+            {
+                return exists == other.exists && modifiedTimeNs == other.modifiedTimeNs && inode == other.inode && size == other.size;
+            }
+
+            bool operator!=(const FileStamp& other) const { return !(*this == other); }
+
+            bool exists;
+            long long modifiedTimeNs;
+            //always 0 on windows, where the modified time and size have to do.
+            unsigned long long inode;
+            long long size;
+        };
+
         /**
          * Various utilities for working with a file system.
          */ 
@@ -53,6 +74,11 @@ namespace Aws
              */
             static bool RelocateFileOrDirectory(const char* from, const char* to);
 
+            /**
+             * Stats the file without opening it. Returns a stamp with exists set to false if the file can't be found.
+             */
+            static FileStamp GetFileStamp(const char* fileName);
+
             /**
              * Gets path delimiter for the current platform
              */
@@ -0,0 +1,183 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <aws/core/utils/memory/stl/AWSString.h>
+
+#include <cstring>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        /**
+         * Integer to text conversions that write into a caller supplied buffer instead of going through a stream.
+         * None of these null terminate; they return the number of characters written.
+         */
+        class AWS_CORE_API IntegerFormat
+        {
+        public:
+            /**
+             * Large enough for any 64 bit integer in decimal, including the sign.
+             */
+            static const size_t MAX_DECIMAL_LENGTH = 20;
+
+            /**
+             * Large enough for any 64 bit integer in hex.
+             */
+            static const size_t MAX_HEX_LENGTH = 16;
+
+            /**
+             * Writes value in decimal to buffer, which must hold at least MAX_DECIMAL_LENGTH characters.
+             */
+            static size_t FormatDecimal(long long value, char* buffer);
+
+            /**
+             * Writes value in decimal to buffer, which must hold at least MAX_DECIMAL_LENGTH characters.
+             */
+            static size_t FormatDecimal(unsigned long long value, char* buffer);
+
+            /**
+             * Writes value in hex to buffer, left padded with zeros to minDigits (at most MAX_HEX_LENGTH).
+             * buffer must hold at least MAX_HEX_LENGTH characters.
+             */
+            static size_t FormatHex(unsigned long long value, char* buffer, size_t minDigits = 1, bool upperCase = false);
+
+            /**
+             * Writes the two hex digits of value to buffer.
+             */
+            static inline void FormatHexByte(unsigned char value, char* buffer, bool upperCase = false)
+            {
+                const char* digits = upperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+                buffer[0] = digits[value >> 4];
+                buffer[1] = digits[value & 0x0F];
+            }
+        };
+
+        /**
+         * Append only string builder. Text is written into a buffer owned by the caller (normally the inline buffer of
+         * StringBuilder below, on the stack) and only moves to the heap if it outgrows that buffer, so building a uri
+         * or a signing string costs at most the one allocation for the final Aws::String.
+         * Use StringBuilder<N>; this base only exists so the formatting code isn't instantiated once per size.
+         */
+        class AWS_CORE_API StringBuilderBase
+        {
+        public:
+            ~StringBuilderBase();
+
+            StringBuilderBase& Append(const char* data, size_t length);
+
+            inline StringBuilderBase& Append(const char* str) { return Append(str, strlen(str)); }
+
+            inline StringBuilderBase& Append(const Aws::String& str) { return Append(str.c_str(), str.length()); }
+
+            StringBuilderBase& Append(char c);
+
+            StringBuilderBase& AppendDecimal(long long value);
+
+            StringBuilderBase& AppendDecimal(unsigned long long value);
+
+            StringBuilderBase& AppendHex(unsigned long long value, size_t minDigits = 1, bool upperCase = false);
+
+            /**
+             * Appends two lower case hex digits per byte, the same encoding HashingUtils::HexEncode produces.
+             */
+            StringBuilderBase& AppendHexEncoded(const unsigned char* data, size_t length);
+
+            /**
+             * Appends data percent encoded the same way StringUtils::URLEncode does (%20 for spaces, upper case hex).
+             */
+            StringBuilderBase& AppendURLEncoded(const char* data, size_t length);
+
+            /**
+             * Appends data with every %XX escape replaced by the byte it encodes; everything else is copied as is.
+             */
+            StringBuilderBase& AppendURLDecoded(const char* data, size_t length);
+
+            /**
+             * Makes sure at least capacity characters fit before anything moves to the heap.
+             */
+            void Reserve(size_t capacity);
+
+            /**
+             * Drops trailing characters so that length characters remain.
+             */
+            void Truncate(size_t length);
+
+            inline void Clear() { Truncate(0); }
+
+            inline const char* c_str() const { return m_data; }
+
+            inline const char* GetData() const { return m_data; }
+
+            inline size_t GetLength() const { return m_length; }
+
+            inline bool IsEmpty() const { return m_length == 0; }
+
+            /**
+             * True once the text has outgrown the inline buffer.
+             */
+            inline bool IsOnHeap() const { return m_data != m_inlineBuffer; }
+
+            inline Aws::String ToString() const { return Aws::String(m_data, m_length); }
+
+        protected:
+            StringBuilderBase(char* inlineBuffer, size_t inlineCapacity);
+
+        private:
+            StringBuilderBase(const StringBuilderBase&) = delete;
+            StringBuilderBase& operator=(const StringBuilderBase&) = delete;
+
+            inline char* Extend(size_t count)
+            {
+                if (m_length + count >= m_capacity)
+                {
+                    Grow(m_length + count + 1);
+                }
+                char* dest = m_data + m_length;
+                m_length += count;
+                m_data[m_length] = '\0';
+                return dest;
+            }
+
+            void Grow(size_t requiredCapacity);
+
+            char* m_inlineBuffer;
+            char* m_data;
+            size_t m_length;
+            size_t m_capacity;
+        };
+
+        /**
+         * StringBuilderBase with InlineCapacity characters (including the terminator) of storage inside the object.
+         */
+        template<size_t InlineCapacity = 256>
+        class StringBuilder : public StringBuilderBase
+        {
+        public:
+            StringBuilder() : StringBuilderBase(m_buffer, InlineCapacity)
+            {
+                m_buffer[0] = '\0';
+            }
+
+        private:
+            char m_buffer[InlineCapacity];
+        };
+
+    } // namespace Utils
+} // namespace Aws
@@ -71,6 +71,8 @@ namespace Aws
             private:
                 char m_mimeBase64EncodingTable[64];
                 uint8_t m_mimeBase64DecodingTable[256];
+                //the vectorized kernels only know the standard alphabet.
+                bool m_isStandardTable;
 
             };
 
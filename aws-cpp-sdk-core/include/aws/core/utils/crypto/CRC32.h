@@ -0,0 +1,97 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/crypto/Hash.h>
+
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            /**
+             * CRC-32 with the IEEE 802.3 polynomial (the one zlib and gzip use, and the one behind DynamoDB's x-amz-crc32 header).
+             * It is computed in software on every platform, so unlike MD5 and Sha256 it doesn't go through the factories:
+             * with carry-less multiplication where the cpu has it, slice-by-8 tables otherwise.
+             * The digest is the checksum as 4 big endian bytes.
+             */
+            class AWS_CORE_API CRC32 : public Hash
+            {
+            public:
+                /**
+                 * The ways Extend can compute the checksum. PCLMUL folds 64 bytes per step and needs CpuFeatures::HasPCLMUL();
+                 * SLICE_BY_8 looks up 8 bytes per step and runs anywhere.
+                 */
+                enum class Kernel
+                {
+                    SLICE_BY_8,
+                    PCLMUL
+                };
+
+                CRC32();
+                virtual ~CRC32() {}
+
+                /**
+                * Calculates the checksum of str
+                */
+                virtual HashResult Calculate(const Aws::String& str) override;
+
+                /**
+                * Calculates the checksum of a stream (the entire stream is read)
+                */
+                virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                /**
+                * Feeds the next piece of a message into the running checksum
+                */
+                virtual bool Update(const unsigned char* buffer, size_t bufferSize) override;
+
+                /**
+                * Finishes the running checksum fed through Update
+                */
+                virtual HashResult GetHash() override;
+
+                /**
+                 * Extends crc, the checksum of everything before buffer, by bufferSize bytes. Start a new checksum from 0.
+                 */
+                static uint32_t Extend(uint32_t crc, const unsigned char* buffer, size_t bufferSize);
+
+                /**
+                 * Same as Extend above, with kernel instead of the fastest one this cpu supports.
+                 */
+                static uint32_t Extend(uint32_t crc, const unsigned char* buffer, size_t bufferSize, Kernel kernel);
+
+                /**
+                 * true if kernel can run on this cpu.
+                 */
+                static bool IsSupported(Kernel kernel);
+
+                /**
+                 * Converts a digest returned by this class back to the checksum value.
+                 */
+                static uint32_t ToValue(const ByteBuffer& digest);
+
+            private:
+                uint32_t m_runningCrc;
+            };
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
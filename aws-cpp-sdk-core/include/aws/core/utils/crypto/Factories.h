@@ -31,6 +31,8 @@ namespace Aws
 
             /**
              * Create an MD5 Hash provider
+             * Implementations may keep state between calls, so threads that hash concurrently should each lease one from an
+             * ImplementationPool (see ImplementationPool.h) rather than share a single instance.
              */
             AWS_CORE_API std::shared_ptr<Hash> CreateMD5Implementation();
             /**
@@ -46,6 +46,18 @@ namespace Aws
                 */
                 virtual HashResult Calculate(Aws::IStream& stream) = 0;
 
+                /**
+                * Feeds the next piece of a message into a running digest. The digest is started by the first call after construction
+                * or after GetHash(), and must not be interleaved with Calculate on the same instance.
+                * Returns false if this implementation only supports one-shot hashing through Calculate.
+                */
+                virtual bool Update(const unsigned char* buffer, size_t bufferSize);
+
+                /**
+                * Finishes the running digest fed through Update and resets the instance for the next one.
+                */
+                virtual HashResult GetHash();
+
                 // when hashing streams, this is the size of our internal buffer we read the stream into
                 static const uint32_t INTERNAL_HASH_STREAM_BUFFER_SIZE = 8192;
             };
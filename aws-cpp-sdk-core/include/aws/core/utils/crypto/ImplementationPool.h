@@ -0,0 +1,118 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/crypto/Hash.h>
+#include <aws/core/utils/crypto/HMAC.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <memory>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            /**
+             * Pool of hash or hmac implementations handed out by the factories in Factories.h.
+             * Some platform implementations (e.g. bcrypt) keep their digest state in the object, so one instance can't be shared
+             * by threads hashing at the same time. Instead of serializing on a single instance, each caller leases its own for the
+             * duration of the computation; the lock is only held to pop or push an idle instance, never while hashing.
+             * The pool grows to the peak number of concurrent callers and keeps those instances around until it is destroyed.
+             * It must outlive every lease taken from it.
+             */
+            template<typename T>
+            class ImplementationPool
+            {
+            public:
+                typedef std::shared_ptr<T> (*CreateFunction)();
+
+                /**
+                 * Exclusive use of one implementation, returned to the pool on destruction.
+                 */
+                class Lease
+                {
+                public:
+                    Lease(const ImplementationPool* pool, std::shared_ptr<T>&& impl) : m_pool(pool), m_impl(std::move(impl)) {}
+                    Lease(Lease&& other) : m_pool(other.m_pool), m_impl(std::move(other.m_impl)) {}
+                    ~Lease()
+                    {
+                        if (m_impl)
+                        {
+                            m_pool->Release(std::move(m_impl));
+                        }
+                    }
+
+                    T* operator->() const { return m_impl.get(); }
+                    T& operator*() const { return *m_impl; }
+                    explicit operator bool() const { return m_impl != nullptr; }
+
+                private:
+                    Lease(const Lease&) = delete;
+                    Lease& operator=(const Lease&) = delete;
+                    Lease& operator=(Lease&&) = delete;
+
+                    const ImplementationPool* m_pool;
+                    std::shared_ptr<T> m_impl;
+                };
+
+                /**
+                 * createFunction is called whenever no idle implementation is available, e.g. CreateSha256Implementation.
+                 */
+                ImplementationPool(CreateFunction createFunction) : m_createFunction(createFunction) {}
+
+                /**
+                 * Hands out an idle implementation, or a new one if all of them are in use.
+                 */
+                Lease Acquire() const
+                {
+                    {
+                        std::lock_guard<std::mutex> locker(m_idleMutex);
+                        if (!m_idle.empty())
+                        {
+                            std::shared_ptr<T> impl(std::move(m_idle.back()));
+                            m_idle.pop_back();
+                            return Lease(this, std::move(impl));
+                        }
+                    }
+
+                    return Lease(this, m_createFunction());
+                }
+
+            private:
+                ImplementationPool(const ImplementationPool&) = delete;
+                ImplementationPool& operator=(const ImplementationPool&) = delete;
+
+                void Release(std::shared_ptr<T>&& impl) const
+                {
+                    std::lock_guard<std::mutex> locker(m_idleMutex);
+                    m_idle.push_back(std::move(impl));
+                }
+
+                CreateFunction m_createFunction;
+                mutable std::mutex m_idleMutex;
+                mutable Aws::Vector<std::shared_ptr<T>> m_idle;
+            };
+
+            typedef ImplementationPool<Hash> HashPool;
+            typedef ImplementationPool<HMAC> HMACPool;
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
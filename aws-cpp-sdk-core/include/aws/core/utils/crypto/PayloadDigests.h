@@ -0,0 +1,98 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/Array.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <cstdint>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Crypto
+        {
+            /**
+             * The digests of one request payload, computed together in a single pass over the body and kept for reuse.
+             * Every block of the body is fed to each of the requested digests while it is still in cache, so asking for
+             * MD5 and SHA256 at once reads a multi megabyte part once instead of twice. Digests already known are never recomputed,
+             * which lets the client compute them once per logical request and carry them over to every retry.
+             */
+            class AWS_CORE_API PayloadDigests
+            {
+            public:
+                /**
+                 * Digest flags, combined into the mask passed to Compute.
+                 */
+                static const unsigned MD5_DIGEST = 0x1;
+                static const unsigned SHA256_DIGEST = 0x2;
+                static const unsigned CRC32_DIGEST = 0x4;
+
+                PayloadDigests();
+
+                /**
+                 * Computes whichever of the digests in mask aren't known yet, in one pass over the entire stream.
+                 * The stream position is restored afterwards. Returns false if any of them could not be computed.
+                 */
+                bool Compute(Aws::IStream& stream, unsigned mask);
+
+                /**
+                 * Computes whichever of the digests in mask aren't known yet, in one pass over buffer.
+                 */
+                bool Compute(const unsigned char* buffer, size_t bufferSize, unsigned mask);
+
+                /**
+                 * True if every digest in mask is known.
+                 */
+                inline bool Has(unsigned mask) const { return (m_known & mask) == mask; }
+
+                /**
+                 * MD5 of the payload (not encoded), empty unless Has(MD5_DIGEST).
+                 */
+                inline const ByteBuffer& GetMD5() const { return m_md5; }
+
+                /**
+                 * SHA256 of the payload (not encoded), empty unless Has(SHA256_DIGEST).
+                 */
+                inline const ByteBuffer& GetSHA256() const { return m_sha256; }
+
+                /**
+                 * CRC32 of the payload, 0 unless Has(CRC32_DIGEST).
+                 */
+                inline uint32_t GetCRC32() const { return m_crc32; }
+
+                /**
+                 * Forgets every digest, e.g. after the payload changed.
+                 */
+                void Reset();
+
+            private:
+                class Pass;
+
+                //finishes the digests pass ran incrementally and computes the rest from stream, or from buffer if stream is null.
+                bool Finish(Pass& pass, Aws::IStream* stream, const unsigned char* buffer, size_t bufferSize);
+
+                unsigned m_known;
+                ByteBuffer m_md5;
+                ByteBuffer m_sha256;
+                uint32_t m_crc32;
+            };
+
+        } // namespace Crypto
+    } // namespace Utils
+} // namespace Aws
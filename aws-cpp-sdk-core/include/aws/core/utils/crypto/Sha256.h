@@ -64,6 +64,16 @@ namespace Aws
                 */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                /**
+                * Feeds the next piece of a message into a running digest
+                */
+                virtual bool Update(const unsigned char* buffer, size_t bufferSize) override;
+
+                /**
+                * Finishes the running digest fed through Update
+                */
+                virtual HashResult GetHash() override;
+
             private:
 
                 std::shared_ptr< Hash > m_hashImpl;
@@ -59,6 +59,14 @@ namespace Aws
                  * Calculates a Hash on the stream without loading the entire stream into memory at once.
                  */
                 HashResult Calculate(Aws::IStream& stream);
+                /**
+                 * Feeds the next piece of a message into a running hash. It shares the hash object with Calculate, so the two can't be interleaved.
+                 */
+                bool Update(const unsigned char* buffer, size_t bufferSize);
+                /**
+                 * Finishes the running hash fed through Update.
+                 */
+                HashResult GetHash();
 
             private:
 
@@ -75,6 +83,9 @@ namespace Aws
                 DWORD m_hashObjectLength;
                 PBYTE m_hashObject;
 
+                //open between the first Update and GetHash.
+                BCryptHashContext* m_runningContext;
+
                 //I'm 99% sure the algorithm handle for windows is not thread safe, but I can't 
                 //prove or disprove that theory. Therefore, we have to lock to be safe.
                 std::mutex m_algorithmMutex;
@@ -100,6 +111,14 @@ namespace Aws
                  * Calculates a md5 hash on the stream without loading the entire stream into memory at once.
                  */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
+                /**
+                 * Feeds the next piece of a message into a running md5 hash.
+                 */
+                virtual bool Update(const unsigned char* buffer, size_t bufferSize) override;
+                /**
+                 * Finishes the running md5 hash fed through Update.
+                 */
+                virtual HashResult GetHash() override;
 
             private:
                 BCryptHashImpl m_impl;
@@ -125,6 +144,14 @@ namespace Aws
                  * Calculates a sha256 hash on the stream without loading the entire stream into memory at once.
                  */
                 virtual HashResult Calculate(Aws::IStream& stream) override;
+                /**
+                 * Feeds the next piece of a message into a running sha256 hash.
+                 */
+                virtual bool Update(const unsigned char* buffer, size_t bufferSize) override;
+                /**
+                 * Finishes the running sha256 hash fed through Update.
+                 */
+                virtual HashResult GetHash() override;
 
             private:
                 BCryptHashImpl m_impl;
@@ -3,6 +3,9 @@
 #include <aws/core/utils/crypto/Hash.h>
 #include <aws/core/utils/crypto/HMAC.h>
 
+struct CC_MD5state_st;
+struct CC_SHA256state_st;
+
 namespace Aws
 {
     namespace Utils
@@ -14,25 +17,39 @@ namespace Aws
             {
             public:
 
-                MD5CommonCryptoImpl() {}
-                virtual ~MD5CommonCryptoImpl() {}
+                MD5CommonCryptoImpl();
+                virtual ~MD5CommonCryptoImpl();
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                virtual bool Update(const unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+                CC_MD5state_st* m_runningContext;
+
             };
 
             class Sha256CommonCryptoImpl : public Hash
             {
             public:
 
-                Sha256CommonCryptoImpl() {}
-                virtual ~Sha256CommonCryptoImpl() {}
+                Sha256CommonCryptoImpl();
+                virtual ~Sha256CommonCryptoImpl();
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                virtual bool Update(const unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+                CC_SHA256state_st* m_runningContext;
             };
 
             class Sha256HMACCommonCryptoImpl : public HMAC
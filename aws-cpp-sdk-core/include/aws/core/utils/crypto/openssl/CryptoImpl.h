@@ -3,6 +3,9 @@
 #include <aws/core/utils/crypto/Hash.h>
 #include <aws/core/utils/crypto/HMAC.h>
 
+struct MD5state_st;
+struct SHA256state_st;
+
 namespace Aws
 {
     namespace Utils
@@ -14,25 +17,39 @@ namespace Aws
             {
             public:
 
-                MD5OpenSSLImpl() {}
-                virtual ~MD5OpenSSLImpl() {}
+                MD5OpenSSLImpl();
+                virtual ~MD5OpenSSLImpl();
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
 
+                virtual bool Update(const unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+                MD5state_st* m_runningContext;
+
             };
 
             class Sha256OpenSSLImpl : public Hash
             {
             public:
 
-                Sha256OpenSSLImpl() {}
-                virtual ~Sha256OpenSSLImpl() {}
+                Sha256OpenSSLImpl();
+                virtual ~Sha256OpenSSLImpl();
 
                 virtual HashResult Calculate(const Aws::String& str) override;
 
                 virtual HashResult Calculate(Aws::IStream& stream) override;
+
+                virtual bool Update(const unsigned char* buffer, size_t bufferSize) override;
+
+                virtual HashResult GetHash() override;
+
+            private:
+                SHA256state_st* m_runningContext;
             };
 
             class Sha256HMACOpenSSLImpl : public HMAC
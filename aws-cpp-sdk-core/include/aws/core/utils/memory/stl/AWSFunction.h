@@ -41,7 +41,7 @@ std::function< F > BuildFunction(const std::function< F >& f)
 template<typename F>
 std::function< F > BuildFunction(std::function< F >&& f) 
 {
-    return std::function< F >( std::allocator_arg_t(), Aws::Allocator<void>(), f );
+    return std::function< F >( std::allocator_arg_t(), Aws::Allocator<void>(), std::move(f) );
 }
 
 } // namespace Aws
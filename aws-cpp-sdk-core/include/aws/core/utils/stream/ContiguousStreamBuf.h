@@ -0,0 +1,86 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+
+#include <streambuf>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * A seekable, growable stream buffer that keeps everything written to it in one block of memory. Unlike a stringbuf it
+             * can be told up front how much is coming, and the written content can be read in place through GetData()/GetSize()
+             * without copying it out first.
+             */
+            class AWS_CORE_API ContiguousStreamBuf : public std::streambuf
+            {
+            public:
+                ContiguousStreamBuf();
+                ~ContiguousStreamBuf();
+
+                ContiguousStreamBuf(const ContiguousStreamBuf&) = delete;
+                ContiguousStreamBuf& operator=(const ContiguousStreamBuf&) = delete;
+
+                /**
+                 * Makes sure at least capacity bytes can be written in total without reallocating. Never shrinks the buffer.
+                 */
+                void Reserve(std::size_t capacity);
+
+                /**
+                 * Start of the written content. May be nullptr while nothing has been written or reserved.
+                 */
+                inline const char* GetData() const { return m_buffer; }
+                /**
+                 * Number of bytes written so far, regardless of where the read or write positions are.
+                 */
+                std::size_t GetSize() const;
+                /**
+                 * Current read position, as an offset from GetData().
+                 */
+                inline std::size_t GetReadOffset() const { return static_cast<std::size_t>(gptr() - eback()); }
+                /**
+                 * Number of bytes that fit before the next reallocation.
+                 */
+                inline std::size_t GetCapacity() const { return m_capacity; }
+
+            protected:
+                int_type overflow(int_type ch) override;
+                int_type underflow() override;
+                std::streamsize xsputn(const char_type* s, std::streamsize n) override;
+                std::streamsize xsgetn(char_type* s, std::streamsize n) override;
+                std::streamsize showmanyc() override;
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+
+            private:
+                void Reallocate(std::size_t newCapacity);
+                void SetPutOffset(std::size_t offset);
+                void ExtendReadArea();
+
+                char* m_buffer;
+                std::size_t m_capacity;
+                //high water mark of the put pointer as of the last time it moved backwards or the buffer was reallocated.
+                std::size_t m_size;
+            };
+
+        } //namespace Stream
+    } //namespace Utils
+} //namespace Aws
@@ -0,0 +1,85 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+
+#include <streambuf>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Stream
+        {
+            /**
+             * A seekable stream buffer over a block of memory the caller already owns. Nothing is copied and the buffer never grows,
+             * so the memory must outlive the stream.
+             */
+            class AWS_CORE_API PreallocatedStreamBuf : public std::streambuf
+            {
+            public:
+                /**
+                 * buffer holds length bytes; they are both the readable content and the space writes go to.
+                 */
+                PreallocatedStreamBuf(char* buffer, std::size_t length);
+
+                PreallocatedStreamBuf(const PreallocatedStreamBuf&) = delete;
+                PreallocatedStreamBuf& operator=(const PreallocatedStreamBuf&) = delete;
+
+                /**
+                 * Start of the underlying memory.
+                 */
+                inline const char* GetBuffer() const { return eback(); }
+                /**
+                 * Size of the underlying memory.
+                 */
+                inline std::size_t GetLength() const { return static_cast<std::size_t>(egptr() - eback()); }
+                /**
+                 * Current read position, as an offset from GetBuffer().
+                 */
+                inline std::size_t GetReadOffset() const { return static_cast<std::size_t>(gptr() - eback()); }
+
+            protected:
+                pos_type seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                pos_type seekpos(pos_type pos, std::ios_base::openmode which = std::ios_base::in | std::ios_base::out) override;
+                std::streamsize xsgetn(char_type* s, std::streamsize n) override;
+            };
+
+            /**
+             * IOStream over a PreallocatedStreamBuf. Because the data is known to be contiguous, the http layer reads request
+             * bodies held in this stream straight from memory and knows their length without seeking.
+             */
+            class AWS_CORE_API PreallocatedIOStream : public Aws::IOStream
+            {
+            public:
+                using Base = Aws::IOStream;
+
+                PreallocatedIOStream(char* buffer, std::size_t length);
+
+                /**
+                 * Returns the buffer behind stream if stream is a PreallocatedIOStream, nullptr otherwise. Works without rtti.
+                 */
+                static PreallocatedStreamBuf* GetPreallocatedStreamBuf(Aws::IOStream& stream);
+
+            private:
+                PreallocatedStreamBuf m_streamBuf;
+            };
+
+        } //namespace Stream
+    } //namespace Utils
+} //namespace Aws
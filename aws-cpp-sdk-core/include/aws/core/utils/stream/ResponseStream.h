@@ -24,6 +24,8 @@ namespace Aws
     {
         namespace Stream
         {
+            class ContiguousStreamBuf;
+
             /**
              * Encapsulates and manages ownership of custom response streams. This is a move only type.
              */
@@ -62,6 +64,10 @@ namespace Aws
                 Aws::IOStream* m_underlyingStream;
             };
 
+            /**
+             * Response stream used unless a request asks for something else. The body is kept in one ContiguousStreamBuf, which the
+             * http client sizes from Content-Length as soon as the headers arrive and which the xml and json parsers read in place.
+             */
             class AWS_CORE_API DefaultUnderlyingStream : public Aws::IOStream
             {
             public:
@@ -69,6 +75,11 @@ namespace Aws
 
                 DefaultUnderlyingStream();
                 virtual ~DefaultUnderlyingStream();
+
+                /**
+                 * Returns the buffer behind stream if stream is a DefaultUnderlyingStream, nullptr otherwise. Works without rtti.
+                 */
+                static ContiguousStreamBuf* GetContiguousStreamBuf(Aws::IStream& stream);
             };
 
             AWS_CORE_API Aws::IOStream* DefaultResponseStreamFactoryMethod();
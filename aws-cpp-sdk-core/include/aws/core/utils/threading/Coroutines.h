@@ -0,0 +1,309 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+/**
+ * Awaitable wrappers over the asynchronous operation plumbing, for code built with C++20 coroutines.
+ * The SDK itself builds as C++11, so everything here is compiled out unless the including translation unit
+ * has coroutine support, in which case AWS_CORE_COROUTINES is defined.
+ */
+#if defined(__has_include)
+#if __has_include(<coroutine>) && defined(__cpp_impl_coroutine)
+#define AWS_CORE_COROUTINES 1
+#endif
+#endif
+
+#ifdef AWS_CORE_COROUTINES
+
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <utility>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+             * Result of an operation running on an Executor, which a coroutine can co_await.
+             * The operation is submitted as soon as the awaitable is created, so several of them can be started before
+             * any is awaited. The awaiting coroutine is resumed through the executor given to ResumeOn(), or on the thread
+             * that finished the operation if none was given. If an executor rejects a task, it is run on the calling thread instead.
+             */
+            template<typename R>
+            class OperationAwaitable
+            {
+            public:
+                OperationAwaitable(Executor& executor, std::function<R()>&& call) :
+                    m_state(Aws::MakeShared<State>("OperationAwaitable"))
+                {
+                    m_state->call = std::move(call);
+                    auto state = m_state;
+                    if (!executor.Submit([state]() { state->Complete(); }))
+                    {
+                        state->Complete();
+                    }
+                }
+
+                /**
+                 * Resume the awaiting coroutine on executor once the operation completes.
+                 * executor is handed the coroutine from the thread that ran the operation, so it has to outlive that thread's executor.
+                 */
+                OperationAwaitable& ResumeOn(Executor& executor)
+                {
+                    std::lock_guard<std::mutex> locker(m_state->mutex);
+                    m_state->resumeExecutor = &executor;
+                    return *this;
+                }
+
+                bool await_ready() const
+                {
+                    std::lock_guard<std::mutex> locker(m_state->mutex);
+                    return m_state->result.has_value();
+                }
+
+                bool await_suspend(std::coroutine_handle<> continuation)
+                {
+                    std::lock_guard<std::mutex> locker(m_state->mutex);
+                    if (m_state->result.has_value())
+                    {
+                        return false;
+                    }
+                    m_state->continuation = continuation;
+                    return true;
+                }
+
+                R await_resume()
+                {
+                    std::lock_guard<std::mutex> locker(m_state->mutex);
+                    return std::move(*m_state->result);
+                }
+
+            private:
+                struct State
+                {
+                    void Complete()
+                    {
+                        R value = call();
+                        call = nullptr;
+
+                        std::coroutine_handle<> resume;
+                        Executor* executor = nullptr;
+                        {
+                            std::lock_guard<std::mutex> locker(mutex);
+                            result.emplace(std::move(value));
+                            resume = continuation;
+                            executor = resumeExecutor;
+                        }
+
+                        if (resume && !(executor && executor->Submit([resume]() { resume.resume(); })))
+                        {
+                            resume.resume();
+                        }
+                    }
+
+                    std::mutex mutex;
+                    std::function<R()> call;
+                    std::optional<R> result;
+                    std::coroutine_handle<> continuation;
+                    Executor* resumeExecutor = nullptr;
+                };
+
+                std::shared_ptr<State> m_state;
+            };
+
+            /**
+             * Start fn with its arguments on executor and return an awaitable for its result.
+             * Arguments passed as rvalues are moved into the queued task rather than copied.
+             */
+            template<class Fn, class ... Args>
+            auto MakeAwaitable(Executor& executor, Fn&& fn, Args&& ... args) -> OperationAwaitable<decltype(std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...)())>
+            {
+                typedef decltype(std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...)()) ResultType;
+                return OperationAwaitable<ResultType>(executor, std::function<ResultType()>(std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...)));
+            }
+
+            template<typename T>
+            class Task;
+
+            namespace Detail
+            {
+                class TaskPromiseBase
+                {
+                public:
+                    std::suspend_always initial_suspend() noexcept { return {}; }
+
+                    struct FinalAwaiter
+                    {
+                        bool await_ready() noexcept { return false; }
+                        void await_resume() noexcept {}
+
+                        template<typename Promise>
+                        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> handle) noexcept
+                        {
+                            TaskPromiseBase& promise = handle.promise();
+                            if (promise.m_continuation)
+                            {
+                                return promise.m_continuation;
+                            }
+
+                            std::lock_guard<std::mutex> locker(promise.m_mutex);
+                            promise.m_finished = true;
+                            promise.m_signal.notify_all();
+                            return std::noop_coroutine();
+                        }
+                    };
+
+                    FinalAwaiter final_suspend() noexcept { return {}; }
+
+                    //the SDK builds without exceptions, there is nothing to carry one to the awaiter with.
+                    void unhandled_exception() noexcept { std::terminate(); }
+
+                    void SetContinuation(std::coroutine_handle<> continuation) { m_continuation = continuation; }
+
+                    void WaitForCompletion()
+                    {
+                        std::unique_lock<std::mutex> locker(m_mutex);
+                        m_signal.wait(locker, [this]() { return m_finished; });
+                    }
+
+                private:
+                    std::coroutine_handle<> m_continuation;
+                    std::mutex m_mutex;
+                    std::condition_variable m_signal;
+                    bool m_finished = false;
+                };
+
+                template<typename T>
+                class TaskPromise : public TaskPromiseBase
+                {
+                public:
+                    Task<T> get_return_object();
+
+                    template<typename U>
+                    void return_value(U&& value) { m_value.emplace(std::forward<U>(value)); }
+
+                    T TakeValue() { return std::move(*m_value); }
+
+                private:
+                    std::optional<T> m_value;
+                };
+
+                template<>
+                class TaskPromise<void> : public TaskPromiseBase
+                {
+                public:
+                    Task<void> get_return_object();
+
+                    void return_void() {}
+
+                    void TakeValue() {}
+                };
+            } // namespace Detail
+
+            /**
+             * Minimal lazily started coroutine task. The body runs when the task is first awaited from another coroutine,
+             * or when Get() is called from plain code, which blocks until the coroutine finishes and returns its value.
+             * A task can be awaited or waited on once.
+             */
+            template<typename T = void>
+            class Task
+            {
+            public:
+                typedef Detail::TaskPromise<T> promise_type;
+
+                Task(Task&& other) noexcept : m_handle(other.m_handle) { other.m_handle = nullptr; }
+
+                Task& operator = (Task&& other) noexcept
+                {
+                    if (this != &other)
+                    {
+                        if (m_handle)
+                        {
+                            m_handle.destroy();
+                        }
+                        m_handle = other.m_handle;
+                        other.m_handle = nullptr;
+                    }
+                    return *this;
+                }
+
+                ~Task()
+                {
+                    if (m_handle)
+                    {
+                        m_handle.destroy();
+                    }
+                }
+
+                bool await_ready() const noexcept { return false; }
+
+                std::coroutine_handle<> await_suspend(std::coroutine_handle<> continuation) noexcept
+                {
+                    m_handle.promise().SetContinuation(continuation);
+                    return m_handle;
+                }
+
+                T await_resume() { return m_handle.promise().TakeValue(); }
+
+                /**
+                 * Run the task to completion on the calling thread, and whichever executors it awaits on, then return its value.
+                 */
+                T Get()
+                {
+                    m_handle.resume();
+                    m_handle.promise().WaitForCompletion();
+                    return m_handle.promise().TakeValue();
+                }
+
+            private:
+                friend class Detail::TaskPromise<T>;
+
+                explicit Task(std::coroutine_handle<promise_type> handle) : m_handle(handle) {}
+
+                Task(const Task&) = delete;
+                Task& operator = (const Task&) = delete;
+
+                std::coroutine_handle<promise_type> m_handle;
+            };
+
+            namespace Detail
+            {
+                template<typename T>
+                Task<T> TaskPromise<T>::get_return_object()
+                {
+                    return Task<T>(std::coroutine_handle<TaskPromise<T>>::from_promise(*this));
+                }
+
+                inline Task<void> TaskPromise<void>::get_return_object()
+                {
+                    return Task<void>(std::coroutine_handle<TaskPromise<void>>::from_promise(*this));
+                }
+            } // namespace Detail
+
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
+
+#endif // AWS_CORE_COROUTINES
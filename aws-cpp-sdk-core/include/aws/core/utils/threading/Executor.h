@@ -20,6 +20,9 @@
 
 
 #include <functional>
+#include <future>
+#include <type_traits>
+#include <aws/core/utils/memory/AWSMemory.h>
 #include <aws/core/utils/memory/stl/AWSFunction.h>
 
 namespace Aws
@@ -28,6 +31,58 @@ namespace Aws
     {
         namespace Threading
         {
+            /**
+             * The task Executor::SubmitOrReject queues: called with true it runs fn, with false onRejected, on the same arguments.
+             */
+            template<class Fn, class OnRejected>
+            class AcceptOrRejectTask
+            {
+            public:
+                AcceptOrRejectTask(Fn fn, OnRejected onRejected) : m_fn(std::move(fn)), m_onRejected(std::move(onRejected)) {}
+
+                template<class ... Args>
+                void operator()(bool accepted, Args& ... args)
+                {
+                    if (accepted)
+                    {
+                        std::bind(m_fn, std::ref(args)...)();
+                    }
+                    else
+                    {
+                        std::bind(m_onRejected, std::ref(args)...)();
+                    }
+                }
+
+            private:
+                Fn m_fn;
+                OnRejected m_onRejected;
+            };
+
+            /**
+             * Makes a promise ready with what fn returns for the arguments it is called with.
+             */
+            template<class R, class Fn>
+            class FulfillPromiseTask
+            {
+            public:
+                FulfillPromiseTask(const std::shared_ptr<std::promise<R>>& promise, Fn fn) : m_promise(promise), m_fn(std::move(fn)) {}
+
+                template<class ... Args>
+                void operator()(Args& ... args)
+                {
+                    SetValue(*m_promise, std::bind(m_fn, std::ref(args)...));
+                }
+
+            private:
+                template<class T, class Call>
+                static void SetValue(std::promise<T>& promise, Call&& call) { promise.set_value(call()); }
+                template<class Call>
+                static void SetValue(std::promise<void>& promise, Call&& call) { call(); promise.set_value(); }
+
+                std::shared_ptr<std::promise<R>> m_promise;
+                Fn m_fn;
+            };
+
             /**
             * Interface for implementing an Executor, to implement a custom thread execution strategy, inherit from this class
             * and override SubmitToThread().
@@ -46,6 +101,47 @@ namespace Aws
                     return SubmitToThread(AWS_BUILD_TYPED_FUNCTION(std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...), void()));
                 }
 
+                /**
+                 * Send function and its arguments to the SubmitToThread function. If the executor doesn't accept the task, fn never
+                 * runs and onRejected is called with the arguments on the calling thread instead, before this returns false.
+                 * Arguments passed as rvalues are moved into the queued task rather than copied, and still reach onRejected.
+                 */
+                template<class Fn, class OnRejected, class ... Args>
+                bool SubmitOrReject(Fn&& fn, OnRejected&& onRejected, Args&& ... args)
+                {
+                    typedef AcceptOrRejectTask<typename std::decay<Fn>::type, typename std::decay<OnRejected>::type> TaskType;
+
+                    auto boundTask = std::bind(TaskType(std::forward<Fn>(fn), std::forward<OnRejected>(onRejected)), std::placeholders::_1, std::forward<Args>(args)...);
+                    //shared so the arguments are still here to hand to onRejected after the executor turned the task down.
+                    auto task = Aws::MakeShared<decltype(boundTask)>("Executor", std::move(boundTask));
+                    if (Submit([task]() { (*task)(true); }))
+                    {
+                        return true;
+                    }
+
+                    (*task)(false);
+                    return false;
+                }
+
+                /**
+                 * Send function and its arguments to the SubmitToThread function, and return a future to its result.
+                 * Arguments passed as rvalues are moved into the queued task rather than copied.
+                 * If the executor doesn't accept the task, fn never runs and the future holds what onRejected returns for the same
+                 * arguments instead, since a broken promise can't be reported without exceptions.
+                 */
+                template<class Fn, class OnRejected, class ... Args>
+                auto SubmitWithFuture(Fn&& fn, OnRejected&& onRejected, Args&& ... args) -> std::future<decltype(std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...)())>
+                {
+                    typedef decltype(std::bind(std::forward<Fn>(fn), std::forward<Args>(args)...)()) ResultType;
+
+                    auto promise = Aws::MakeShared<std::promise<ResultType>>("Executor");
+                    auto future = promise->get_future();
+                    SubmitOrReject(FulfillPromiseTask<ResultType, typename std::decay<Fn>::type>(promise, std::forward<Fn>(fn)),
+                        FulfillPromiseTask<ResultType, typename std::decay<OnRejected>::type>(promise, std::forward<OnRejected>(onRejected)),
+                        std::forward<Args>(args)...);
+                    return future;
+                }
+
 
             protected:
                 /**
@@ -0,0 +1,140 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/Core_EXPORTS.h>
+#include <aws/core/utils/threading/Executor.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace Aws
+{
+    namespace Utils
+    {
+        namespace Threading
+        {
+            /**
+             * What PooledThreadExecutor::Submit does when the pool already holds maxQueuedTasks tasks that haven't started.
+             */
+            enum class OverflowPolicy
+            {
+                //wait until a worker takes a task off the queue.
+                BLOCK,
+                //don't queue the task, Submit returns false.
+                REJECT,
+                //run the task on the submitting thread before Submit returns, which also slows the producer down.
+                RUN_ON_CALLER
+            };
+
+            /**
+             * Executor that runs tasks on a pool of long lived worker threads instead of spawning a thread per task.
+             * Every worker owns a deque, and submitted tasks are dealt round robin over the workers' deques so producers rarely
+             * contend on the same lock. A worker runs the tasks of its own deque in submission order and, once that is empty,
+             * steals from the back of the others' before going to sleep, so a worker stuck in a long task doesn't hold up the
+             * ones queued behind it.
+             *
+             * The pool is either fixed, or elastic: it starts with poolSize workers and adds workers up to maxPoolSize while every
+             * worker is busy; the extra workers exit again after idleTimeout without work.
+             *
+             * The number of tasks waiting to start can be bounded by maxQueuedTasks (0 means unbounded), overflowPolicy decides
+             * what happens to the tasks beyond it. Generated clients ignore the result of Submit, so REJECT is only meant for
+             * callers that check it.
+             *
+             * Shutdown(), which the destructor calls, stops accepting tasks, runs every task already queued, then joins the workers.
+             * It must not be called from one of the pool's own tasks.
+             */
+            class AWS_CORE_API PooledThreadExecutor : public Executor
+            {
+            public:
+                /**
+                 * Fixed pool of poolSize workers.
+                 */
+                PooledThreadExecutor(size_t poolSize, size_t maxQueuedTasks = 0, OverflowPolicy overflowPolicy = OverflowPolicy::BLOCK);
+
+                /**
+                 * Elastic pool of poolSize to maxPoolSize workers.
+                 */
+                PooledThreadExecutor(size_t poolSize, size_t maxPoolSize, std::chrono::milliseconds idleTimeout,
+                    size_t maxQueuedTasks = 0, OverflowPolicy overflowPolicy = OverflowPolicy::BLOCK);
+
+                ~PooledThreadExecutor();
+
+                /**
+                 * Stops accepting tasks, waits for the queued ones to finish and joins the workers.
+                 */
+                void Shutdown();
+
+                /**
+                 * Number of workers currently running.
+                 */
+                inline size_t GetPoolSize() const { return m_activeWorkers; }
+
+                /**
+                 * Number of tasks submitted but not yet picked up by a worker.
+                 */
+                inline size_t GetQueuedTaskCount() const { return m_queuedTasks; }
+
+            protected:
+                bool SubmitToThread(std::function<void()>&& fx) override;
+
+            private:
+                class Worker;
+
+                PooledThreadExecutor(const PooledThreadExecutor&) = delete;
+                PooledThreadExecutor& operator = (const PooledThreadExecutor&) = delete;
+
+                void Start();
+                //reserves a place in the queue according to the overflow policy. false if the task must not be queued.
+                bool ReserveQueueSlot();
+                void ReleaseQueueSlot();
+                bool TakeTask(size_t workerIndex, std::function<void()>& task);
+                //hands a queued task to a sleeping worker, false if none is asleep.
+                bool WakeSleepingWorker();
+                void SpawnWorker();
+                void WorkerLoop(size_t workerIndex);
+
+                size_t m_poolSize;
+                size_t m_maxPoolSize;
+                std::chrono::milliseconds m_idleTimeout;
+                size_t m_maxQueuedTasks;
+                OverflowPolicy m_overflowPolicy;
+
+                //one slot per possible worker, allocated up front so workers can steal from every slot without locking the vector.
+                //we need control over the order in which these get cleaned up
+                //that's why I'm not using unique_ptr here.
+                Aws::Vector<Worker*> m_workers;
+                std::mutex m_workersMutex;
+                std::atomic<size_t> m_activeWorkers;
+                std::atomic<size_t> m_nextWorker;
+
+                std::atomic<size_t> m_queuedTasks;
+                //sleeping workers not yet claimed by a submission, and the claims they haven't woken up for.
+                std::atomic<size_t> m_sleepingWorkers;
+                size_t m_wakeups;
+                std::atomic<size_t> m_blockedSubmitters;
+                std::atomic<bool> m_stopping;
+                std::mutex m_stateMutex;
+                std::condition_variable m_workAvailable;
+                std::condition_variable m_spaceAvailable;
+            };
+
+        } // namespace Threading
+    } // namespace Utils
+} // namespace Aws
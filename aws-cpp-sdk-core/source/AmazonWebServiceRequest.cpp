@@ -22,7 +22,9 @@ using namespace Aws;
 AmazonWebServiceRequest::AmazonWebServiceRequest() :
     m_responseStreamFactory(AWS_BUILD_FUNCTION(Aws::Utils::Stream::DefaultResponseStreamFactoryMethod)),
     m_onDataReceived(nullptr),
-    m_onDataSent(nullptr)
+    m_onDataSent(nullptr),
+    m_payloadSigningMode(Aws::Http::PayloadSigningMode::SIGNED),
+    m_payloadSigningModeHasBeenSet(false)
 {
 }
 
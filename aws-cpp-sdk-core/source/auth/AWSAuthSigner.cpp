@@ -16,22 +16,31 @@
 #include <aws/core/auth/AWSAuthSigner.h>
 
 #include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/core/auth/ChunkSigningRequestBody.h>
 #include <aws/core/client/ClientConfiguration.h>
 #include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpRequestBody.h>
 #include <aws/core/http/HttpResponse.h>
+#include <aws/core/http/standard/StandardHttpRequest.h>
 #include <aws/core/utils/DateTime.h>
 #include <aws/core/utils/HashingUtils.h>
 #include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringBuilder.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/UnreferencedParam.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/memory/AWSMemory.h>
-#include <aws/core/utils/crypto/Sha256.h>
-#include <aws/core/utils/crypto/Sha256HMAC.h>
+#include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/threading/Executor.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdio>
 #include <iomanip>
 #include <math.h>
 #include <string.h>
+#include <thread>
 
 using namespace Aws;
 using namespace Aws::Client;
@@ -51,35 +60,36 @@ static const char* X_AMZ_SIGNED_HEADERS = "X-Amz-SignedHeaders";
 static const char* X_AMZ_ALGORITHM = "X-Amz-Algorithm";
 static const char* X_AMZ_CREDENTIAL = "X-Amz-Credential";
 static const char* UNSIGNED_PAYLOAD = "UNSIGNED-PAYLOAD";
+static const char* STREAMING_SIGNED_PAYLOAD = "STREAMING-AWS4-HMAC-SHA256-PAYLOAD";
+static const char* AWS_CHUNKED = "aws-chunked";
+static const char* X_AMZ_CONTENT_SHA256 = "x-amz-content-sha256";
+static const char* X_AMZ_DECODED_CONTENT_LENGTH = "x-amz-decoded-content-length";
 static const char* X_AMZ_SIGNATURE = "X-Amz-Signature";
 static const char* SIGNING_KEY = "AWS4";
 static const char* LONG_DATE_FORMAT_STR = "%Y%m%dT%H%M%SZ";
-static const char* SIMPLE_DATE_FORMAT_STR = "%Y%m%d";
 
 static const char* v4LogTag = "AWSAuthV4Signer";
 
-Aws::String CanonicalizeRequestSigningString(HttpRequest& request)
+//most canonical requests fit without spilling to the heap; the ones that don't still only allocate on growth.
+static const size_t CANONICAL_REQUEST_INLINE_SIZE = 1024;
+
+//appends method, path and query string lines of the canonical request; the caller appends headers and payload hash.
+static void AppendCanonicalRequestPrefix(HttpRequest& request, StringBuilderBase& canonicalRequest)
 {
     request.CanonicalizeRequest();
-    Aws::StringStream signingStringStream;
-    signingStringStream << HttpMethodMapper::GetNameForHttpMethod(request.GetMethod());
-
-    signingStringStream << NEWLINE << request.GetUri().GetURLEncodedPath() << NEWLINE;
+    canonicalRequest.Append(HttpMethodMapper::GetNameForHttpMethod(request.GetMethod()));
+    canonicalRequest.Append(NEWLINE).Append(request.GetUri().GetURLEncodedPath()).Append(NEWLINE);
 
-    if (request.GetQueryString().size() > 1 && request.GetQueryString().find("=") != std::string::npos)
-    {
-        signingStringStream << request.GetQueryString().substr(1) << NEWLINE;
-    }
-    else if (request.GetQueryString().size() > 1)
+    const Aws::String& queryString = request.GetQueryString();
+    if (queryString.size() > 1)
     {
-        signingStringStream << request.GetQueryString().substr(1) << "=" << NEWLINE;
+        canonicalRequest.Append(queryString.c_str() + 1, queryString.size() - 1);
+        if (queryString.find('=') == Aws::String::npos)
+        {
+            canonicalRequest.Append(EQ);
+        }
     }
-    else
-    {
-        signingStringStream << NEWLINE;
-    }
-
-    return signingStringStream.str();
+    canonicalRequest.Append(NEWLINE);
 }
 
 AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvider>& credentialsProvider,
@@ -88,74 +98,92 @@ AWSAuthV4Signer::AWSAuthV4Signer(const std::shared_ptr<Auth::AWSCredentialsProvi
     m_credentialsProvider(credentialsProvider),
     m_serviceName(serviceName),
     m_region(region),
-    m_hash(Aws::MakeUnique<Aws::Utils::Crypto::Sha256>(v4LogTag)),
-    m_HMAC(Aws::MakeUnique<Aws::Utils::Crypto::Sha256HMAC>(v4LogTag))
+    m_hashPool(Aws::Utils::Crypto::CreateSha256Implementation),
+    m_HMACPool(Aws::Utils::Crypto::CreateSha256HMACImplementation),
+    m_cachedDateSecond(0)
 {
+    m_signingKeys.reserve(MAX_CACHED_SIGNING_KEYS);
 }
 
 AWSAuthV4Signer::~AWSAuthV4Signer()
 {
-    // empty destructor in .cpp file to keep from needing the implementation of (AWSCredentialsProvider, Sha256, Sha256HMAC) in the header file 
+    // empty destructor in .cpp file to keep from needing the implementation of AWSCredentialsProvider in the header file 
 }
 
 bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
 {
-    AWSCredentials credentials = m_credentialsProvider->GetAWSCredentials();
+    auto credentials = m_credentialsProvider->GetAWSCredentialsSnapshot();
 
     //don't sign anonymous requests
-    if (credentials.GetAWSAccessKeyId().empty() || credentials.GetAWSSecretKey().empty())
+    if (credentials->GetAWSAccessKeyId().empty() || credentials->GetAWSSecretKey().empty())
     {
         return true;
     }
 
-    if (!credentials.GetSessionToken().empty())
+    if (!credentials->GetSessionToken().empty())
     {
-        request.SetAwsSessionToken(credentials.GetSessionToken());
+        request.SetAwsSessionToken(credentials->GetSessionToken());
     }
 
     //calculate date header to use in internal signature (this also goes into date header).
-    Aws::String dateHeaderValue = DateTime::CalculateGmtTimestampAsString(LONG_DATE_FORMAT_STR);
+    Aws::String dateHeaderValue;
+    Aws::String simpleDate;
+    GetSigningDates(dateHeaderValue, simpleDate);
     request.SetHeaderValue(AWS_DATE_HEADER, dateHeaderValue);
 
-    Aws::String payloadHash(ComputePayloadHash(request));
-    if (payloadHash.empty())
+    //streamed bodies are signed chunk by chunk as they are sent, so nothing has to read them up front.
+    bool streamingPayload = request.GetPayloadSigningMode() == PayloadSigningMode::STREAMING_SIGNED && request.GetRequestBody();
+    //without tls nothing else protects the body, so it is only left unsigned over https.
+    bool unsignedPayload = request.GetPayloadSigningMode() == PayloadSigningMode::UNSIGNED_OVER_HTTPS && request.GetUri().GetScheme() == Scheme::HTTPS;
+    Aws::String payloadHash;
+    if (streamingPayload)
     {
-        return false;
+        payloadHash = STREAMING_SIGNED_PAYLOAD;
+        if (!PrepareStreamingPayloadHeaders(request))
+        {
+            return false;
+        }
     }
-
-    request.SetHeaderValue("x-amz-content-sha256", payloadHash);
-
-    Aws::StringStream headersStream;
-    Aws::StringStream signedHeadersStream;
-
-    for (const auto& header : request.GetHeaders())
+    else if (unsignedPayload)
+    {
+        payloadHash = UNSIGNED_PAYLOAD;
+    }
+    else
     {
-        headersStream << header.first << ":" << header.second << NEWLINE;
-        signedHeadersStream << header.first << ";";
+        payloadHash = ComputePayloadHash(request);
+        if (payloadHash.empty())
+        {
+            return false;
+        }
     }
 
-    Aws::String canonicalHeadersString = headersStream.str();
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
+    request.SetHeaderValue(X_AMZ_CONTENT_SHA256, payloadHash);
 
-    //calculate signed headers parameter
-    Aws::String signedHeadersValue = signedHeadersStream.str();
-    //remove that last semi-colon
-    signedHeadersValue.erase(signedHeadersValue.length() - 1);
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeadersValue);
+    StringBuilder<CANONICAL_REQUEST_INLINE_SIZE> canonicalRequest;
+    StringBuilder<> signedHeaders;
 
     //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request);
+    AppendCanonicalRequestPrefix(request, canonicalRequest);
 
     //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(signedHeadersValue);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(payloadHash);
+    for (const auto& header : request.GetHeaderCollection())
+    {
+        canonicalRequest.Append(header.first).Append(':').Append(header.second).Append(NEWLINE);
+        if (!signedHeaders.IsEmpty())
+        {
+            signedHeaders.Append(';');
+        }
+        signedHeaders.Append(header.first);
+    }
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value:" << signedHeaders.c_str());
+
+    canonicalRequest.Append(NEWLINE).Append(signedHeaders.GetData(), signedHeaders.GetLength());
+    canonicalRequest.Append(NEWLINE).Append(payloadHash);
+    Aws::String canonicalRequestString = canonicalRequest.ToString();
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequestString);
 
     //now compute sha256 on that request string
-    auto hashResult = m_hash->Calculate(canonicalRequestString);
+    auto hashResult = m_hashPool.Acquire()->Calculate(canonicalRequestString);
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string \"" << canonicalRequestString << "\"");
@@ -164,80 +192,68 @@ bool AWSAuthV4Signer::SignRequest(Aws::Http::HttpRequest& request) const
 
     auto sha256Digest = hashResult.GetResult();
     Aws::String cannonicalRequestHash = HashingUtils::HexEncode(sha256Digest);
-    Aws::String simpleDate = DateTime::CalculateGmtTimestampAsString(SIMPLE_DATE_FORMAT_STR);
 
     Aws::String stringToSign = GenerateStringToSign(dateHeaderValue, simpleDate, cannonicalRequestHash);
-    auto finalSignature = GenerateSignature(credentials, stringToSign, simpleDate);
+    auto finalSignature = GenerateSignature(*credentials, stringToSign, simpleDate);
+    if (finalSignature.empty())
+    {
+        return false;
+    }
 
-    Aws::StringStream ss;
-    ss << AWS_HMAC_SHA256 << " " << CREDENTIAL << EQ << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << m_region << "/" << m_serviceName << "/" << AWS4_REQUEST << ", " << SIGNED_HEADERS << EQ
-        << signedHeadersValue << ", " << SIGNATURE << EQ << finalSignature;
+    StringBuilder<> authString;
+    authString.Append(AWS_HMAC_SHA256).Append(' ').Append(CREDENTIAL).Append(EQ);
+    authString.Append(credentials->GetAWSAccessKeyId()).Append('/');
+    AppendCredentialScope(authString, simpleDate);
+    authString.Append(", ").Append(SIGNED_HEADERS).Append(EQ).Append(signedHeaders.GetData(), signedHeaders.GetLength())
+        .Append(", ").Append(SIGNATURE).Append(EQ).Append(finalSignature);
 
-    auto awsAuthString = ss.str();
+    auto awsAuthString = authString.ToString();
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Signing request with: " << awsAuthString);
     request.SetAwsAuthorization(awsAuthString);
 
+    if (streamingPayload)
+    {
+        //the seed signature starts the chain of chunk signatures.
+        StringBuilder<> credentialScope;
+        AppendCredentialScope(credentialScope, simpleDate);
+        request.SetRequestBody(Aws::MakeShared<ChunkSigningRequestBody>(v4LogTag, request.GetRequestBody(),
+            GetSigningKey(credentials->GetAWSSecretKey(), simpleDate), dateHeaderValue, credentialScope.ToString(), finalSignature));
+    }
+
     return true;
 }
 
 bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, long long expirationTimeInSeconds) const
 {
-    AWSCredentials credentials = m_credentialsProvider->GetAWSCredentials();
+    auto credentials = m_credentialsProvider->GetAWSCredentialsSnapshot();
 
     //don't sign anonymous requests
-    if (credentials.GetAWSAccessKeyId().empty() || credentials.GetAWSSecretKey().empty())
+    if (credentials->GetAWSAccessKeyId().empty() || credentials->GetAWSSecretKey().empty())
     {
         return true;
     }
 
-    Aws::StringStream intConversionStream;
-    intConversionStream << expirationTimeInSeconds;
-    request.AddQueryStringParameter(Http::X_AMZ_EXPIRES_HEADER, intConversionStream.str());   
-
-    if (!credentials.GetSessionToken().empty())
-    {
-        request.AddQueryStringParameter(Http::AWS_SECURITY_TOKEN, credentials.GetSessionToken());       
-    }
-
     //calculate date header to use in internal signature (this also goes into date header).
-    Aws::String dateQueryValue = DateTime::CalculateGmtTimestampAsString(LONG_DATE_FORMAT_STR);
-    request.AddQueryStringParameter(Http::AWS_DATE_HEADER, dateQueryValue);
-
-    Aws::StringStream ss;
-    ss << Http::HOST_HEADER << ":" << request.GetHeaderValue(Http::HOST_HEADER) << NEWLINE;
-    Aws::String canonicalHeadersString(ss.str());
-    ss.str("");
-
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Header String: " << canonicalHeadersString);
+    Aws::String dateQueryValue;
+    Aws::String simpleDate;
+    GetSigningDates(dateQueryValue, simpleDate);
+    AddPresignQueryParameters(request.GetUri(), *credentials, dateQueryValue, simpleDate, expirationTimeInSeconds);
 
-    //calculate signed headers parameter
     Aws::String signedHeadersValue(Http::HOST_HEADER);
-    request.AddQueryStringParameter(X_AMZ_SIGNED_HEADERS, signedHeadersValue);
-    
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Signed Headers value: " << signedHeadersValue);
-
-    Aws::String simpleDate = DateTime::CalculateGmtTimestampAsString(SIMPLE_DATE_FORMAT_STR);
-    ss << credentials.GetAWSAccessKeyId() << "/" << simpleDate
-        << "/" << m_region << "/" << m_serviceName << "/" << AWS4_REQUEST;
-
-    request.AddQueryStringParameter(X_AMZ_ALGORITHM, AWS_HMAC_SHA256);
-    request.AddQueryStringParameter(X_AMZ_CREDENTIAL, ss.str());
-    ss.str("");
+    StringBuilder<CANONICAL_REQUEST_INLINE_SIZE> canonicalRequest;
 
     //generate generalized canonicalized request string.
-    Aws::String canonicalRequestString = CanonicalizeRequestSigningString(request);
+    AppendCanonicalRequestPrefix(request, canonicalRequest);
 
     //append v4 stuff to the canonical request string.
-    canonicalRequestString.append(canonicalHeadersString);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(signedHeadersValue);
-    canonicalRequestString.append(NEWLINE);
-    canonicalRequestString.append(UNSIGNED_PAYLOAD);
+    canonicalRequest.Append(Http::HOST_HEADER).Append(':').Append(request.GetHeaderValue(Http::HOST_HEADER)).Append(NEWLINE);
+    canonicalRequest.Append(NEWLINE).Append(signedHeadersValue);
+    canonicalRequest.Append(NEWLINE).Append(UNSIGNED_PAYLOAD);
+    Aws::String canonicalRequestString = canonicalRequest.ToString();
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Canonical Request String: " << canonicalRequestString);
 
     //now compute sha256 on that request string
-    auto hashResult = m_hash->Calculate(canonicalRequestString);
+    auto hashResult = m_hashPool.Acquire()->Calculate(canonicalRequestString);
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string \"" << canonicalRequestString << "\"");
@@ -249,7 +265,7 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, long long
 
     auto stringToSign = GenerateStringToSign(dateQueryValue, simpleDate, cannonicalRequestHash);
 
-    auto finalSigningHash = GenerateSignature(credentials, stringToSign, simpleDate);
+    auto finalSigningHash = GenerateSignature(*credentials, stringToSign, simpleDate);
     if (finalSigningHash.empty())
     {
         return false;
@@ -261,71 +277,422 @@ bool AWSAuthV4Signer::PresignRequest(Aws::Http::HttpRequest& request, long long
     return true;
 }
 
+//a presigned url is the same for every path of a batch except for the path and the signature.
+struct AWSAuthV4Signer::PresignedUrlTemplate
+{
+    //scheme, authority and port.
+    Aws::String urlPrefix;
+    //canonical query string, starting with '?'.
+    Aws::String queryString;
+    const char* methodName;
+    //everything in the canonical request after the path.
+    Aws::String canonicalRequestSuffix;
+    Aws::String stringToSignPrefix;
+    ByteBuffer signingKey;
+    bool isSigned;
+};
+
+//batches are cut into slices of this many paths, an executor task only pays off if it gets at least one.
+static const size_t PRESIGNED_URLS_PER_SLICE = 256;
+
+namespace
+{
+    //shared with the executor tasks by pointer, a task that only starts after the batch is done finds no slice left and touches nothing else.
+    struct PresignUrlsProgress
+    {
+        PresignUrlsProgress(size_t slices) : nextSlice(0), sliceCount(slices), finishedSlices(0), failed(false) {}
+
+        std::atomic<size_t> nextSlice;
+        const size_t sliceCount;
+        std::mutex finishedMutex;
+        std::condition_variable finishedSignal;
+        size_t finishedSlices;
+        bool failed;
+    };
+}
+
+bool AWSAuthSigner::PresignUrls(const URI& uri, HttpMethod method, const Aws::Vector<Aws::String>& paths,
+    Aws::Vector<Aws::String>& urls, long long expirationInSeconds, Aws::Utils::Threading::Executor* executor) const
+{
+    AWS_UNREFERENCED_PARAM(executor);
+
+    urls.clear();
+    urls.reserve(paths.size());
+    for (const auto& path : paths)
+    {
+        URI pathUri(uri);
+        pathUri.SetPath(path);
+        Standard::StandardHttpRequest request(pathUri, method);
+        if (!PresignRequest(request, expirationInSeconds))
+        {
+            urls.clear();
+            return false;
+        }
+        urls.push_back(request.GetURIString());
+    }
+    return true;
+}
+
+bool AWSAuthSigner::SignsPayloadHash(PayloadSigningMode payloadSigningMode, Scheme scheme) const
+{
+    AWS_UNREFERENCED_PARAM(payloadSigningMode);
+    AWS_UNREFERENCED_PARAM(scheme);
+    return false;
+}
+
+bool AWSAuthV4Signer::SignsPayloadHash(PayloadSigningMode payloadSigningMode, Scheme scheme) const
+{
+    //mirrors the choice SignRequest makes for a request with a body.
+    return payloadSigningMode == PayloadSigningMode::SIGNED ||
+        (payloadSigningMode == PayloadSigningMode::UNSIGNED_OVER_HTTPS && scheme != Scheme::HTTPS);
+}
+
+bool AWSAuthV4Signer::PresignUrls(const URI& uri, HttpMethod method, const Aws::Vector<Aws::String>& paths,
+    Aws::Vector<Aws::String>& urls, long long expirationInSeconds, Aws::Utils::Threading::Executor* executor) const
+{
+    urls.clear();
+
+    PresignedUrlTemplate urlTemplate;
+    urlTemplate.methodName = HttpMethodMapper::GetNameForHttpMethod(method);
+    URI presignedUri(uri);
+    presignedUri.SetPath("/");
+
+    auto credentials = m_credentialsProvider->GetAWSCredentialsSnapshot();
+
+    //don't sign anonymous requests
+    urlTemplate.isSigned = !credentials->GetAWSAccessKeyId().empty() && !credentials->GetAWSSecretKey().empty();
+    if (urlTemplate.isSigned)
+    {
+        Aws::String longDate;
+        Aws::String simpleDate;
+        GetSigningDates(longDate, simpleDate);
+        urlTemplate.signingKey = GetSigningKey(credentials->GetAWSSecretKey(), simpleDate);
+        if (urlTemplate.signingKey.GetLength() == 0)
+        {
+            return false;
+        }
+
+        AddPresignQueryParameters(presignedUri, *credentials, longDate, simpleDate, expirationInSeconds);
+        presignedUri.CanonicalizeQueryString();
+
+        StringBuilder<CANONICAL_REQUEST_INLINE_SIZE> suffix;
+        suffix.Append(NEWLINE).Append(presignedUri.GetQueryString().c_str() + 1).Append(NEWLINE);
+        suffix.Append(Http::HOST_HEADER).Append(':').Append(presignedUri.GetAuthority()).Append(NEWLINE);
+        suffix.Append(NEWLINE).Append(Http::HOST_HEADER);
+        suffix.Append(NEWLINE).Append(UNSIGNED_PAYLOAD);
+        urlTemplate.canonicalRequestSuffix = suffix.ToString();
+
+        suffix.Clear();
+        suffix.Append(AWS_HMAC_SHA256).Append(NEWLINE).Append(longDate).Append(NEWLINE);
+        AppendCredentialScope(suffix, simpleDate);
+        suffix.Append(NEWLINE);
+        urlTemplate.stringToSignPrefix = suffix.ToString();
+    }
+
+    urlTemplate.urlPrefix = presignedUri.GetURIString(false);
+    urlTemplate.queryString = presignedUri.GetQueryString();
+    urls.resize(paths.size());
+
+    size_t sliceCount = (paths.size() + PRESIGNED_URLS_PER_SLICE - 1) / PRESIGNED_URLS_PER_SLICE;
+    size_t helperCount = 0;
+    if (executor && sliceCount > 1)
+    {
+        size_t threadCount = (std::max)(std::thread::hardware_concurrency(), 1u);
+        helperCount = (std::min)(threadCount, sliceCount) - 1;
+    }
+
+    if (helperCount == 0)
+    {
+        if (!PresignUrlRange(urlTemplate, paths, urls, 0, paths.size()))
+        {
+            urls.clear();
+            return false;
+        }
+        return true;
+    }
+
+    auto progress = Aws::MakeShared<PresignUrlsProgress>(v4LogTag, sliceCount);
+    const PresignedUrlTemplate* templatePtr = &urlTemplate;
+    const Aws::Vector<Aws::String>* pathsPtr = &paths;
+    Aws::Vector<Aws::String>* urlsPtr = &urls;
+    auto signSlices = [this, progress, templatePtr, pathsPtr, urlsPtr]()
+    {
+        for (size_t slice = progress->nextSlice++; slice < progress->sliceCount; slice = progress->nextSlice++)
+        {
+            size_t begin = slice * PRESIGNED_URLS_PER_SLICE;
+            size_t end = (std::min)(begin + PRESIGNED_URLS_PER_SLICE, pathsPtr->size());
+            bool signedSlice = PresignUrlRange(*templatePtr, *pathsPtr, *urlsPtr, begin, end);
+
+            std::lock_guard<std::mutex> locker(progress->finishedMutex);
+            progress->failed = progress->failed || !signedSlice;
+            if (++progress->finishedSlices == progress->sliceCount)
+            {
+                progress->finishedSignal.notify_all();
+            }
+        }
+    };
+
+    for (size_t i = 0; i < helperCount; ++i)
+    {
+        if (!executor->Submit(signSlices))
+        {
+            break;
+        }
+    }
+
+    //the calling thread signs too, and takes over every slice the executor hasn't started, so it never waits on a queued task.
+    signSlices();
+
+    std::unique_lock<std::mutex> locker(progress->finishedMutex);
+    progress->finishedSignal.wait(locker, [&progress] { return progress->finishedSlices == progress->sliceCount; });
+    if (progress->failed)
+    {
+        urls.clear();
+        return false;
+    }
+    return true;
+}
+
+bool AWSAuthV4Signer::PresignUrlRange(const PresignedUrlTemplate& urlTemplate, const Aws::Vector<Aws::String>& paths,
+    Aws::Vector<Aws::String>& urls, size_t begin, size_t end) const
+{
+    StringBuilder<CANONICAL_REQUEST_INLINE_SIZE> canonicalRequest;
+    StringBuilder<> stringToSign;
+    StringBuilder<CANONICAL_REQUEST_INLINE_SIZE> url;
+    size_t pathOffset = strlen(urlTemplate.methodName) + 1;
+
+    auto hash = m_hashPool.Acquire();
+    auto hmac = m_HMACPool.Acquire();
+    //implementations without incremental hashing get the canonical request as a string.
+    bool incrementalHash = hash->Update(nullptr, 0);
+
+    for (size_t i = begin; i < end; ++i)
+    {
+        const Aws::String& path = paths[i];
+        canonicalRequest.Clear();
+        canonicalRequest.Append(urlTemplate.methodName).Append(NEWLINE);
+        URI::AppendURLEncodedPath(canonicalRequest, path.c_str(), path.length());
+        size_t pathLength = canonicalRequest.GetLength() - pathOffset;
+
+        url.Clear();
+        url.Append(urlTemplate.urlPrefix).Append(canonicalRequest.GetData() + pathOffset, pathLength).Append(urlTemplate.queryString);
+
+        if (urlTemplate.isSigned)
+        {
+            canonicalRequest.Append(urlTemplate.canonicalRequestSuffix);
+
+            Crypto::HashResult hashResult;
+            if (incrementalHash)
+            {
+                hash->Update(reinterpret_cast<const unsigned char*>(canonicalRequest.GetData()), canonicalRequest.GetLength());
+                hashResult = hash->GetHash();
+            }
+            else
+            {
+                hashResult = hash->Calculate(canonicalRequest.ToString());
+            }
+            if (!hashResult.IsSuccess())
+            {
+                AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hash (sha256) request string for path \"" << path << "\"");
+                return false;
+            }
+
+            stringToSign.Clear();
+            stringToSign.Append(urlTemplate.stringToSignPrefix)
+                .AppendHexEncoded(hashResult.GetResult().GetUnderlyingData(), hashResult.GetResult().GetLength());
+            auto signatureResult = hmac->Calculate(ByteBuffer(reinterpret_cast<const unsigned char*>(stringToSign.GetData()), stringToSign.GetLength()),
+                urlTemplate.signingKey);
+            if (!signatureResult.IsSuccess())
+            {
+                AWS_LOGSTREAM_ERROR(v4LogTag, "Unable to hmac (sha256) final string for path \"" << path << "\"");
+                return false;
+            }
+
+            url.Append('&').Append(X_AMZ_SIGNATURE).Append(EQ)
+                .AppendHexEncoded(signatureResult.GetResult().GetUnderlyingData(), signatureResult.GetResult().GetLength());
+        }
+
+        urls[i] = url.ToString();
+    }
+    return true;
+}
+
+void AWSAuthV4Signer::AddPresignQueryParameters(URI& uri, const AWSCredentials& credentials, const Aws::String& longDate,
+    const Aws::String& simpleDate, long long expirationInSeconds) const
+{
+    StringBuilder<> scratch;
+    scratch.AppendDecimal(expirationInSeconds);
+    uri.AddQueryStringParameter(Http::X_AMZ_EXPIRES_HEADER, scratch.ToString());
+
+    if (!credentials.GetSessionToken().empty())
+    {
+        uri.AddQueryStringParameter(Http::AWS_SECURITY_TOKEN, credentials.GetSessionToken());
+    }
+
+    uri.AddQueryStringParameter(Http::AWS_DATE_HEADER, longDate);
+
+    //only the host header is signed.
+    uri.AddQueryStringParameter(X_AMZ_SIGNED_HEADERS, Http::HOST_HEADER);
+
+    scratch.Clear();
+    scratch.Append(credentials.GetAWSAccessKeyId()).Append('/');
+    AppendCredentialScope(scratch, simpleDate);
+
+    uri.AddQueryStringParameter(X_AMZ_ALGORITHM, AWS_HMAC_SHA256);
+    uri.AddQueryStringParameter(X_AMZ_CREDENTIAL, scratch.ToString());
+}
+
 Aws::String AWSAuthV4Signer::GenerateSignature(const AWSCredentials& credentials, const Aws::String& stringToSign, const Aws::String& simpleDate) const
 {
     AWS_LOGSTREAM_DEBUG(v4LogTag, "Final String to sign: " << stringToSign);
 
-    Aws::StringStream ss;
+    auto kSigning = GetSigningKey(credentials.GetAWSSecretKey(), simpleDate);
+    if (kSigning.GetLength() == 0)
+    {
+        return "";
+    }
+
+    auto hashResult = m_HMACPool.Acquire()->Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), kSigning);
+    if (!hashResult.IsSuccess())
+    {
+        AWS_LOGSTREAM_ERROR(v4LogTag, "Unable to hmac (sha256) final string \"" << stringToSign << "\"");
+        return "";
+    }
+
+    //now we finally sign our request string with our hex encoded derived hash.
+    auto finalSigningDigest = hashResult.GetResult();
+
+    auto finalSigningHash = HashingUtils::HexEncode(finalSigningDigest);
+    AWS_LOGSTREAM_DEBUG(v4LogTag, "Final computed signing hash: " << finalSigningHash);
+
+    return finalSigningHash;
+}
 
+//FNV-1a, so the cache never has to hold on to a copy of the secret itself.
+static uint64_t FingerprintSecret(const Aws::String& secretKey)
+{
+    uint64_t fingerprint = 14695981039346656037ULL;
+    for (char c : secretKey)
+    {
+        fingerprint ^= static_cast<unsigned char>(c);
+        fingerprint *= 1099511628211ULL;
+    }
+    return fingerprint;
+}
+
+ByteBuffer AWSAuthV4Signer::GetSigningKey(const Aws::String& secretKey, const Aws::String& simpleDate) const
+{
+    uint64_t fingerprint = FingerprintSecret(secretKey);
+    {
+        std::lock_guard<std::mutex> locker(m_signingKeyMutex);
+        for (const auto& entry : m_signingKeys)
+        {
+            if (entry.secretFingerprint == fingerprint && entry.simpleDate == simpleDate)
+            {
+                return entry.signingKey;
+            }
+        }
+    }
+
+    auto signingKey = ComputeSigningKey(secretKey, simpleDate);
+    if (signingKey.GetLength() == 0)
+    {
+        return signingKey;
+    }
+
+    std::lock_guard<std::mutex> locker(m_signingKeyMutex);
+    if (m_signingKeys.size() >= MAX_CACHED_SIGNING_KEYS)
+    {
+        m_signingKeys.erase(m_signingKeys.begin());
+    }
+    SigningKeyCacheEntry entry;
+    entry.secretFingerprint = fingerprint;
+    entry.simpleDate = simpleDate;
+    entry.signingKey = signingKey;
+    m_signingKeys.push_back(std::move(entry));
+    return signingKey;
+}
+
+ByteBuffer AWSAuthV4Signer::ComputeSigningKey(const Aws::String& secretKey, const Aws::String& simpleDate) const
+{
     //now we do the complicated part of deriving a signing key.
     Aws::String signingKey(SIGNING_KEY);
-    signingKey.append(credentials.GetAWSSecretKey());
+    signingKey.append(secretKey);
 
     //we use digest only for the derivation process.
-    auto hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)simpleDate.c_str(), simpleDate.length()),
+    auto hmac = m_HMACPool.Acquire();
+    auto hashResult = hmac->Calculate(ByteBuffer((unsigned char*)simpleDate.c_str(), simpleDate.length()),
         ByteBuffer((unsigned char*)signingKey.c_str(), signingKey.length()));
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hmac (sha256) date string \"" << simpleDate << "\"");
-        return "";
+        return ByteBuffer();
     }
 
     auto kDate = hashResult.GetResult();
-    hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)m_region.c_str(), m_region.length()), kDate);
+    hashResult = hmac->Calculate(ByteBuffer((unsigned char*)m_region.c_str(), m_region.length()), kDate);
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hmac (sha256) region string \"" << m_region << "\"");
-        return "";
+        return ByteBuffer();
     }
 
     auto kRegion = hashResult.GetResult();
-    hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)m_serviceName.c_str(), m_serviceName.length()), kRegion);
+    hashResult = hmac->Calculate(ByteBuffer((unsigned char*)m_serviceName.c_str(), m_serviceName.length()), kRegion);
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Failed to hmac (sha256) service string \"" << m_serviceName << "\"");
-        return "";
+        return ByteBuffer();
     }
 
     auto kService = hashResult.GetResult();
-    hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)AWS4_REQUEST, strlen(AWS4_REQUEST)), kService);
+    hashResult = hmac->Calculate(ByteBuffer((unsigned char*)AWS4_REQUEST, strlen(AWS4_REQUEST)), kService);
     if (!hashResult.IsSuccess())
     {
         AWS_LOGSTREAM_ERROR(v4LogTag, "Unable to hmac (sha256) request string \"" << AWS4_REQUEST << "\"");
-        return "";
+        return ByteBuffer();
     }
 
-    auto kSigning = hashResult.GetResult();
-    hashResult = m_HMAC->Calculate(ByteBuffer((unsigned char*)stringToSign.c_str(), stringToSign.length()), kSigning);
-    if (!hashResult.IsSuccess())
+    return hashResult.GetResult();
+}
+
+void AWSAuthV4Signer::GetSigningDates(Aws::String& longDate, Aws::String& simpleDate) const
+{
+    std::time_t now = std::time(nullptr);
     {
-        AWS_LOGSTREAM_ERROR(v4LogTag, "Unable to hmac (sha256) final string \"" << stringToSign << "\"");
-        return "";
+        std::lock_guard<std::mutex> locker(m_dateMutex);
+        if (now != m_cachedDateSecond || m_cachedLongDate.empty())
+        {
+            m_cachedLongDate = DateTime::CalculateGmtTimestampAsString(now, LONG_DATE_FORMAT_STR);
+            m_cachedDateSecond = now;
+        }
+        longDate = m_cachedLongDate;
     }
 
-    //now we finally sign our request string with our hex encoded derived hash.
-    auto finalSigningDigest = hashResult.GetResult();
-
-    auto finalSigningHash = HashingUtils::HexEncode(finalSigningDigest);
-    AWS_LOGSTREAM_DEBUG(v4LogTag, "Final computed signing hash: " << finalSigningHash);
-
-    return finalSigningHash;
+    //the long date starts with the simple date, deriving one from the other keeps them on the same day at midnight.
+    simpleDate = longDate.substr(0, 8);
 }
 
 Aws::String AWSAuthV4Signer::ComputePayloadHash(Aws::Http::HttpRequest& request) const
 {
+    //the client caches digests across retries, and may already have hashed the body along with its md5.
+    const auto& payloadDigests = request.GetPayloadDigests();
+    if (payloadDigests && request.GetContentBody())
+    {
+        if (!payloadDigests->Compute(*request.GetContentBody(), Aws::Utils::Crypto::PayloadDigests::SHA256_DIGEST))
+        {
+            AWS_LOG_ERROR(v4LogTag, "Unable to hash (sha256) request body");
+            return "";
+        }
+
+        Aws::String payloadHash(HashingUtils::HexEncode(payloadDigests->GetSHA256()));
+        AWS_LOGSTREAM_DEBUG(v4LogTag, "Using sha256 " << payloadHash << " for payload.");
+        return payloadHash;
+    }
+
     //compute hash on payload if it exists.
-    auto hashResult = request.GetContentBody() ? m_hash->Calculate(*request.GetContentBody())
-        : m_hash->Calculate("");
+    auto hashResult = request.GetContentBody() ? m_hashPool.Acquire()->Calculate(*request.GetContentBody())
+        : m_hashPool.Acquire()->Calculate("");
     if (!hashResult.IsSuccess())
     {
         AWS_LOG_ERROR(v4LogTag, "Unable to hash (sha256) request body");
@@ -339,13 +706,47 @@ Aws::String AWSAuthV4Signer::ComputePayloadHash(Aws::Http::HttpRequest& request)
     return payloadHash;
 }
 
+bool AWSAuthV4Signer::PrepareStreamingPayloadHeaders(Aws::Http::HttpRequest& request) const
+{
+    //the declared content length, if there is one, is the payload's; on the wire it grows by the chunk framing.
+    int64_t decodedLength = request.HasHeader(CONTENT_LENGTH_HEADER) ?
+        StringUtils::ConvertToInt64(request.GetContentLength().c_str()) : request.GetRequestBody()->GetLength();
+    if (decodedLength < 0)
+    {
+        //the request would go out with neither a content length nor chunked transfer encoding. Hashing the body instead
+        //is no way out either: a stream that can't report its length can't be rewound to be sent after it was read.
+        AWS_LOG_ERROR(v4LogTag, "Unable to stream a payload of unknown length, set its content length.");
+        return false;
+    }
+
+    Aws::String contentEncoding(AWS_CHUNKED);
+    if (request.HasHeader(CONTENT_ENCODING_HEADER))
+    {
+        contentEncoding.append(",").append(request.GetHeaderValue(CONTENT_ENCODING_HEADER));
+    }
+    request.SetHeaderValue(CONTENT_ENCODING_HEADER, contentEncoding);
+
+    StringBuilder<> scratch;
+    scratch.AppendDecimal(static_cast<long long>(decodedLength));
+    request.SetHeaderValue(X_AMZ_DECODED_CONTENT_LENGTH, scratch.ToString());
+    scratch.Clear();
+    scratch.AppendDecimal(static_cast<long long>(ChunkSigningRequestBody::CalculateEncodedLength(decodedLength)));
+    request.SetContentLength(scratch.ToString());
+    return true;
+}
+
+void AWSAuthV4Signer::AppendCredentialScope(StringBuilderBase& builder, const Aws::String& simpleDate) const
+{
+    builder.Append(simpleDate).Append('/').Append(m_region).Append('/').Append(m_serviceName).Append('/').Append(AWS4_REQUEST);
+}
+
 Aws::String AWSAuthV4Signer::GenerateStringToSign(const Aws::String& dateValue, const Aws::String& simpleDate, const Aws::String& canonicalRequestHash) const
 {
     //generate the actual string we will use in signing the final request.
-    Aws::StringStream ss;
-
-    ss << AWS_HMAC_SHA256 << NEWLINE << dateValue << NEWLINE << simpleDate << "/" << m_region << "/"
-        << m_serviceName << "/" << AWS4_REQUEST << NEWLINE << canonicalRequestHash;
+    StringBuilder<> stringToSign;
+    stringToSign.Append(AWS_HMAC_SHA256).Append(NEWLINE).Append(dateValue).Append(NEWLINE);
+    AppendCredentialScope(stringToSign, simpleDate);
+    stringToSign.Append(NEWLINE).Append(canonicalRequestHash);
 
-    return ss.str();
+    return stringToSign.ToString();
 }
@@ -18,11 +18,13 @@
 
 
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/DateTime.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/json/JsonSerializer.h>
 #include <aws/core/internal/EC2MetadataClient.h>
 #include <aws/core/utils/FileSystemUtils.h>
 
+#include <algorithm>
 #include <cstdlib>
 #include <chrono>
 #include <fstream>
@@ -64,20 +66,42 @@ static const char* DIRECTORY_JOIN = "/";
 #endif // _WIN32
 
 
-bool AWSCredentialsProvider::IsTimeToRefresh(long reloadFrequency)
+static long long GetCurrentTimeMs()
 {
     using namespace std::chrono;
-    milliseconds now = duration_cast<milliseconds>(system_clock::now().time_since_epoch());
+    return duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+}
+
+bool AWSCredentialsProvider::IsTimeToRefresh(long reloadFrequency)
+{
+    long long now = GetCurrentTimeMs();
 
-    if (now.count() - m_lastLoadedMs > reloadFrequency)
+    if (now - m_lastLoadedMs > reloadFrequency)
     {
-        m_lastLoadedMs = now.count();
+        m_lastLoadedMs = now;
         return true;
     }
 
     return false;
 }
 
+static const char* providerLogTag = "AWSCredentialsProvider";
+
+std::shared_ptr<const AWSCredentials> AWSCredentialsProvider::GetAWSCredentialsSnapshot()
+{
+    return Aws::MakeShared<AWSCredentials>(providerLogTag, GetAWSCredentials());
+}
+
+SimpleAWSCredentialsProvider::SimpleAWSCredentialsProvider(const Aws::String& awsAccessKeyId, const Aws::String& awsSecretAccessKey, const Aws::String& sessionToken) :
+    m_credentials(Aws::MakeShared<AWSCredentials>(providerLogTag, awsAccessKeyId, awsSecretAccessKey, sessionToken))
+{
+}
+
+SimpleAWSCredentialsProvider::SimpleAWSCredentialsProvider(const AWSCredentials& credentials) :
+    m_credentials(Aws::MakeShared<AWSCredentials>(providerLogTag, credentials))
+{
+}
+
 
 static const char* environmentLogTag = "EnvironmentAWSCredentialsProvider";
 
@@ -169,7 +193,8 @@ static const char* profileLogTag = "ProfileConfigFileAWSCredentialsProvider";
 ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider(long refreshRateMs) :
         m_fileName(GetProfileFilename()),
         m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        m_loadFrequencyMs(refreshRateMs),
+        m_lastCheckedMs(0)
 {
     char* profileFromVar = std::getenv(AWS_PROFILE_ENVIRONMENT_VARIABLE);
     if (profileFromVar)
@@ -190,7 +215,8 @@ ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider
         m_fileName(GetProfileFilename()),
         m_profileToUse(profile),
         m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        m_loadFrequencyMs(refreshRateMs),
+        m_lastCheckedMs(0)
 {
     AWS_LOGSTREAM_INFO(profileLogTag, "Setting provider to read credentials from " << m_fileName
                                       << ", for use with profile " << m_profileToUse);
@@ -198,16 +224,35 @@ ProfileConfigFileAWSCredentialsProvider::ProfileConfigFileAWSCredentialsProvider
 
 AWSCredentials ProfileConfigFileAWSCredentialsProvider::GetAWSCredentials()
 {
-    RefreshIfExpired();
-    assert(m_credentials != nullptr);
-    return *m_credentials;
+    return *GetAWSCredentialsSnapshot();
+}
+
+std::shared_ptr<const AWSCredentials> ProfileConfigFileAWSCredentialsProvider::GetAWSCredentialsSnapshot()
+{
+    auto credentials = std::atomic_load(&m_credentials);
+
+    //only the thread that wins the exchange stats the file, everybody else keeps using what is cached.
+    long long now = GetCurrentTimeMs();
+    long long lastChecked = m_lastCheckedMs.load();
+    bool timeToCheck = now - lastChecked > m_loadFrequencyMs && m_lastCheckedMs.compare_exchange_strong(lastChecked, now);
+
+    if (!credentials || timeToCheck)
+    {
+        RefreshIfChanged();
+        credentials = std::atomic_load(&m_credentials);
+    }
+
+    assert(credentials != nullptr);
+    return credentials;
 }
 
 
-void ProfileConfigFileAWSCredentialsProvider::RefreshIfExpired()
+void ProfileConfigFileAWSCredentialsProvider::RefreshIfChanged()
 {
     std::lock_guard<std::mutex> locker(m_reloadMutex);
-    if (!m_credentials || IsTimeToRefresh(m_loadFrequencyMs))
+
+    FileStamp fileStamp = FileSystemUtils::GetFileStamp(m_fileName.c_str());
+    if (!std::atomic_load(&m_credentials) || fileStamp != m_fileStamp)
     {
         AWS_LOG_DEBUG(profileLogTag, "Refreshing credentials.");
 
@@ -233,7 +278,12 @@ void ProfileConfigFileAWSCredentialsProvider::RefreshIfExpired()
         else
         AWS_LOG_INFO(profileLogTag, "Optional session token for profile not found.");
 
-        m_credentials = Aws::MakeShared<AWSCredentials>(profileLogTag, accessKey, secretKey, sessionToken);
+        m_fileStamp = fileStamp;
+        std::atomic_store(&m_credentials, std::shared_ptr<const AWSCredentials>(Aws::MakeShared<AWSCredentials>(profileLogTag, accessKey, secretKey, sessionToken)));
+    }
+    else
+    {
+        AWS_LOG_TRACE(profileLogTag, "Profile file is unchanged, keeping cached credentials.");
     }
 }
 
@@ -285,9 +335,16 @@ Aws::Map<Aws::String, Aws::String> ProfileConfigFileAWSCredentialsProvider::Pars
 
 static const char* instanceLogTag = "InstanceProfileCredentialsProvider";
 
+//the metadata service rotates credentials well ahead of their expiration, start asking for the new ones this long before.
+static const long long EXPIRATION_GRACE_PERIOD_MS = 1000 * 60 * 5;
+//keeps a refresh inside the grace period (or a short refresh rate) from turning into a busy loop against the metadata service.
+static const long long MINIMUM_REFRESH_DELAY_MS = 1000;
+
 InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(long refreshRateMs) :
         m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        m_expirationMs(0),
+        m_loadFrequencyMs(refreshRateMs),
+        m_stopRefreshing(false)
 {
     AWS_LOGSTREAM_INFO(instanceLogTag, "Creating Instance with default EC2MetadataClient and refresh rate " << refreshRateMs);
 
@@ -299,40 +356,97 @@ InstanceProfileCredentialsProvider::InstanceProfileCredentialsProvider(const std
                                                                        long refreshRateMs) :
         m_metadataClient(mdClient),
         m_credentials(nullptr),
-        m_loadFrequencyMs(refreshRateMs)
+        m_expirationMs(0),
+        m_loadFrequencyMs(refreshRateMs),
+        m_stopRefreshing(false)
 {
     AWS_LOGSTREAM_INFO(instanceLogTag, "Creating Instance with injected EC2MetadataClient and refresh rate " << refreshRateMs);
 }
 
+InstanceProfileCredentialsProvider::~InstanceProfileCredentialsProvider()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_refreshMutex);
+        m_stopRefreshing = true;
+    }
+    m_refreshSignal.notify_all();
+
+    if (m_refreshThread.joinable())
+    {
+        m_refreshThread.join();
+    }
+}
+
 
 AWSCredentials InstanceProfileCredentialsProvider::GetAWSCredentials()
 {
-    RefreshIfExpired();
-    return *m_credentials;
+    return *GetAWSCredentialsSnapshot();
 }
 
-
-void InstanceProfileCredentialsProvider::RefreshIfExpired()
+std::shared_ptr<const AWSCredentials> InstanceProfileCredentialsProvider::GetAWSCredentialsSnapshot()
 {
-    AWS_LOG_DEBUG(instanceLogTag, "Checking if latest credential pull has expired.");
+    auto credentials = std::atomic_load(&m_credentials);
+    if (credentials)
+    {
+        return credentials;
+    }
 
+    //nothing has been loaded yet, so there is nothing to serve in the meantime. The first callers wait for the metadata service,
+    //and from then on the background thread owns refreshing.
     std::lock_guard<std::mutex> locker(m_reloadMutex);
-    if (!m_credentials || IsTimeToRefresh(m_loadFrequencyMs))
+    credentials = std::atomic_load(&m_credentials);
+    if (!credentials)
     {
-        AWS_LOG_INFO(instanceLogTag, "Credentials have expired attempting to repull from EC2 Metadata Service.");
-        Aws::String mdRet = m_metadataClient->GetDefaultCredentials();
+        Reload();
+        m_refreshThread = std::thread(&InstanceProfileCredentialsProvider::RefreshLoop, this);
+        credentials = std::atomic_load(&m_credentials);
+    }
 
-        if (mdRet.empty())
+    return credentials;
+}
+
+void InstanceProfileCredentialsProvider::RefreshLoop()
+{
+    std::unique_lock<std::mutex> locker(m_refreshMutex);
+    while (!m_refreshSignal.wait_for(locker, std::chrono::milliseconds(ComputeRefreshDelayMs()), [this] { return m_stopRefreshing; }))
+    {
+        //don't hold m_refreshMutex across the http calls, or the destructor couldn't signal us.
+        locker.unlock();
         {
-            AWS_LOG_WARN(instanceLogTag, "Not able to pull credentials from the metadata service, returning empty credentials.");
-            m_credentials = Aws::MakeShared<AWSCredentials>(instanceLogTag, "", "");
-            return;
+            std::lock_guard<std::mutex> reloadLocker(m_reloadMutex);
+            Reload();
         }
+        locker.lock();
+    }
+}
+
+long long InstanceProfileCredentialsProvider::ComputeRefreshDelayMs() const
+{
+    long long delay = m_loadFrequencyMs;
+    if (m_expirationMs > 0)
+    {
+        delay = (std::min)(delay, m_expirationMs - EXPIRATION_GRACE_PERIOD_MS - GetCurrentTimeMs());
+    }
+
+    return (std::max)(delay, (std::min)(static_cast<long long>(m_loadFrequencyMs), MINIMUM_REFRESH_DELAY_MS));
+}
+
+void InstanceProfileCredentialsProvider::Reload()
+{
+    AWS_LOG_INFO(instanceLogTag, "Pulling credentials from EC2 Metadata Service.");
+    Aws::String mdRet = m_metadataClient->GetDefaultCredentials();
 
-        const char* accessKeyId = "AccessKeyId";
-        const char* secretAccessKey = "SecretAccessKey";
-        Aws::String accessKey, secretKey, token;
+    const char* accessKeyId = "AccessKeyId";
+    const char* secretAccessKey = "SecretAccessKey";
+    Aws::String accessKey, secretKey, token;
+    long long expirationMs = 0;
 
+    if (mdRet.empty())
+    {
+        AWS_LOG_WARN(instanceLogTag, "Not able to pull credentials from the metadata service.");
+    }
+    else
+    {
         using namespace Aws::Utils::Json;
         JsonValue jsonValue(mdRet);
 
@@ -343,14 +457,33 @@ void InstanceProfileCredentialsProvider::RefreshIfExpired()
 
             secretKey = jsonValue.GetString(secretAccessKey);
             token = jsonValue.GetString("Token");
+            if (jsonValue.ValueExists("Expiration"))
+            {
+                expirationMs = DateTime::ConvertISO8601ToMillis(jsonValue.GetString("Expiration").c_str());
+                AWS_LOGSTREAM_DEBUG(instanceLogTag, "Credentials expire at " << jsonValue.GetString("Expiration"));
+            }
         }
         else
         {
             AWS_LOGSTREAM_ERROR(instanceLogTag, "Failed to parse output from Ec2MetadataService with error " << jsonValue.GetErrorMessage());
         }
+    }
 
-        m_credentials = Aws::MakeShared<AWSCredentials>(instanceLogTag, accessKey, secretKey, token);
+    auto previous = std::atomic_load(&m_credentials);
+    if (accessKey.empty() || secretKey.empty())
+    {
+        if (previous && !previous->GetAWSAccessKeyId().empty())
+        {
+            AWS_LOG_WARN(instanceLogTag, "Keeping the last good credentials until the metadata service returns new ones.");
+            return;
+        }
+        if (!previous)
+        {
+            AWS_LOG_WARN(instanceLogTag, "No credentials available from the metadata service, returning empty credentials.");
+        }
     }
-}
 
+    m_expirationMs = expirationMs;
+    std::atomic_store(&m_credentials, std::shared_ptr<const AWSCredentials>(Aws::MakeShared<AWSCredentials>(instanceLogTag, accessKey, secretKey, token)));
+}
 
@@ -19,21 +19,47 @@
 
 using namespace Aws::Auth;
 
+static const char* DefaultCredentialsProviderChainTag = "DefaultAWSCredentialsProviderChain";
+
+static bool HasCredentials(const AWSCredentials& credentials)
+{
+    return !credentials.GetAWSAccessKeyId().empty() && !credentials.GetAWSSecretKey().empty();
+}
+
 AWSCredentials AWSCredentialsProviderChain::GetAWSCredentials()
 {
-    for (auto credentialsProvider : m_providerChain)
+    return *GetAWSCredentialsSnapshot();
+}
+
+std::shared_ptr<const AWSCredentials> AWSCredentialsProviderChain::GetAWSCredentialsSnapshot()
+{
+    int lastUsed = m_lastUsedProvider.load(std::memory_order_relaxed);
+    if (lastUsed >= 0)
     {
-        AWSCredentials credentials = credentialsProvider->GetAWSCredentials();
-        if (!credentials.GetAWSAccessKeyId().empty() && !credentials.GetAWSSecretKey().empty())
+        auto credentials = m_providerChain[lastUsed]->GetAWSCredentialsSnapshot();
+        if (HasCredentials(*credentials))
         {
             return credentials;
         }
     }
 
-    return AWSCredentials("", "");
-}
+    for (size_t i = 0; i < m_providerChain.size(); ++i)
+    {
+        if (static_cast<int>(i) == lastUsed)
+        {
+            continue;
+        }
 
-static const char* DefaultCredentialsProviderChainTag = "DefaultAWSCredentialsProviderChain";
+        auto credentials = m_providerChain[i]->GetAWSCredentialsSnapshot();
+        if (HasCredentials(*credentials))
+        {
+            m_lastUsedProvider.store(static_cast<int>(i), std::memory_order_relaxed);
+            return credentials;
+        }
+    }
+
+    return Aws::MakeShared<AWSCredentials>(DefaultCredentialsProviderChainTag, "", "");
+}
 
 DefaultAWSCredentialsProviderChain::DefaultAWSCredentialsProviderChain() : AWSCredentialsProviderChain()
 {
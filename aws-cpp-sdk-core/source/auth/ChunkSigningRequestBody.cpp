@@ -0,0 +1,170 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/auth/ChunkSigningRequestBody.h>
+
+#include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/StringBuilder.h>
+#include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/crypto/Hash.h>
+#include <aws/core/utils/crypto/HMAC.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+#include <cstring>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Utils;
+
+static const char* CHUNK_SIGNING_LOG_TAG = "ChunkSigningRequestBody";
+static const char* STREAMING_PAYLOAD_ALGORITHM = "AWS4-HMAC-SHA256-PAYLOAD";
+static const char* CHUNK_SIGNATURE = ";chunk-signature=";
+static const char* CRLF = "\r\n";
+//hex(sha256("")), chunk signatures sign an empty chunk header.
+static const char* EMPTY_STRING_SHA256 = "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855";
+static const size_t SIGNATURE_LENGTH = 64;
+
+const size_t ChunkSigningRequestBody::DEFAULT_CHUNK_SIZE;
+
+static size_t CountHexDigits(uint64_t value)
+{
+    size_t digits = 1;
+    while (value >>= 4)
+    {
+        ++digits;
+    }
+    return digits;
+}
+
+static size_t FramingLength(size_t chunkLength)
+{
+    return CountHexDigits(chunkLength) + strlen(CHUNK_SIGNATURE) + SIGNATURE_LENGTH + 2 * strlen(CRLF);
+}
+
+ChunkSigningRequestBody::ChunkSigningRequestBody(const std::shared_ptr<HttpRequestBody>& payload, const ByteBuffer& signingKey,
+    const Aws::String& longDate, const Aws::String& credentialScope, const Aws::String& seedSignature, size_t chunkSize) :
+    HttpRequestBody(payload->GetStream()),
+    m_payload(payload),
+    m_signingKey(signingKey),
+    m_previousSignature(seedSignature),
+    m_chunkSize(chunkSize > 0 ? chunkSize : DEFAULT_CHUNK_SIZE),
+    m_hash(Aws::Utils::Crypto::CreateSha256Implementation()),
+    m_HMAC(Aws::Utils::Crypto::CreateSha256HMACImplementation()),
+    m_frameOffset(0),
+    m_finished(false)
+{
+    StringBuilder<> prefix;
+    prefix.Append(STREAMING_PAYLOAD_ALGORITHM).Append('\n').Append(longDate).Append('\n').Append(credentialScope).Append('\n');
+    m_stringToSignPrefix = prefix.ToString();
+}
+
+ChunkSigningRequestBody::~ChunkSigningRequestBody()
+{
+    // empty destructor in .cpp file to keep from needing the implementation of Hash and HMAC in the header file
+}
+
+int64_t ChunkSigningRequestBody::CalculateEncodedLength(int64_t decodedLength, size_t chunkSize)
+{
+    if (decodedLength < 0)
+    {
+        return -1;
+    }
+
+    uint64_t fullChunks = static_cast<uint64_t>(decodedLength) / chunkSize;
+    size_t remainder = static_cast<size_t>(static_cast<uint64_t>(decodedLength) % chunkSize);
+
+    int64_t encodedLength = decodedLength + static_cast<int64_t>(fullChunks * FramingLength(chunkSize));
+    if (remainder > 0)
+    {
+        encodedLength += static_cast<int64_t>(FramingLength(remainder));
+    }
+    return encodedLength + static_cast<int64_t>(FramingLength(0));
+}
+
+int64_t ChunkSigningRequestBody::GetLength() const
+{
+    return CalculateEncodedLength(m_payload->GetLength(), m_chunkSize);
+}
+
+std::size_t ChunkSigningRequestBody::Read(char* buffer, std::size_t size)
+{
+    std::size_t copied = 0;
+    while (copied < size)
+    {
+        if (m_frameOffset == m_frame.size())
+        {
+            if (m_finished || !EncodeNextChunk())
+            {
+                break;
+            }
+        }
+
+        std::size_t toCopy = (std::min)(size - copied, m_frame.size() - m_frameOffset);
+        memcpy(buffer + copied, m_frame.c_str() + m_frameOffset, toCopy);
+        m_frameOffset += toCopy;
+        copied += toCopy;
+    }
+    return copied;
+}
+
+bool ChunkSigningRequestBody::EncodeNextChunk()
+{
+    //fill a whole chunk, the payload may hand it over in smaller reads.
+    m_chunk.resize(m_chunkSize);
+    size_t chunkLength = 0;
+    while (chunkLength < m_chunkSize)
+    {
+        size_t bytesRead = m_payload->Read(&m_chunk[chunkLength], m_chunkSize - chunkLength);
+        if (bytesRead == 0)
+        {
+            break;
+        }
+        chunkLength += bytesRead;
+    }
+    m_chunk.resize(chunkLength);
+    m_finished = chunkLength == 0;
+
+    auto hashResult = m_hash->Calculate(m_chunk);
+    if (!hashResult.IsSuccess())
+    {
+        AWS_LOG_ERROR(CHUNK_SIGNING_LOG_TAG, "Unable to hash (sha256) chunk");
+        m_finished = true;
+        return false;
+    }
+
+    StringBuilder<256> stringToSign;
+    stringToSign.Append(m_stringToSignPrefix).Append(m_previousSignature).Append('\n').Append(EMPTY_STRING_SHA256).Append('\n')
+        .AppendHexEncoded(hashResult.GetResult().GetUnderlyingData(), hashResult.GetResult().GetLength());
+
+    auto signatureResult = m_HMAC->Calculate(ByteBuffer(reinterpret_cast<const unsigned char*>(stringToSign.GetData()), stringToSign.GetLength()), m_signingKey);
+    if (!signatureResult.IsSuccess())
+    {
+        AWS_LOG_ERROR(CHUNK_SIGNING_LOG_TAG, "Unable to hmac (sha256) chunk string to sign");
+        m_finished = true;
+        return false;
+    }
+    m_previousSignature = HashingUtils::HexEncode(signatureResult.GetResult());
+
+    StringBuilder<> header;
+    header.AppendHex(chunkLength);
+    m_frame.clear();
+    m_frame.reserve(FramingLength(chunkLength) + chunkLength);
+    m_frame.append(header.GetData(), header.GetLength());
+    m_frame.append(CHUNK_SIGNATURE).append(m_previousSignature).append(CRLF).append(m_chunk).append(CRLF);
+    m_frameOffset = 0;
+    return true;
+}
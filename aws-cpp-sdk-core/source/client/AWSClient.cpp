@@ -33,7 +33,8 @@
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/Globals.h>
 #include <aws/core/utils/EnumParseOverflowContainer.h>
-#include <aws/core/utils/crypto/MD5.h>
+#include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/crypto/PayloadDigests.h>
 #include <thread>
 #include <aws/core/utils/HashingUtils.h>
 
@@ -44,11 +45,18 @@ using namespace Aws::Http;
 using namespace Aws::Utils;
 using namespace Aws::Utils::Json;
 using namespace Aws::Utils::Xml;
+using Aws::Utils::Crypto::PayloadDigests;
 
 static const int SUCCESS_RESPONSE_MIN = 200;
 static const int SUCCESS_RESPONSE_MAX = 299;
 static const char* LOG_TAG = "AWSClient";
 
+AWSError<CoreErrors> Aws::Client::ExecutorRejectedError()
+{
+    //the executor is either full or shut down; nothing was sent, so the caller may try again once it has room.
+    return AWSError<CoreErrors>(CoreErrors::INTERNAL_FAILURE, "ExecutorRejected", "The client's executor did not accept the call.", true);
+}
+
 std::atomic<int> AWSClient::s_refCount(0);
 
 void AWSClient::InitializeGlobalStatics()
@@ -102,7 +110,9 @@ AWSClient::AWSClient(const std::shared_ptr<Aws::Http::HttpClientFactory const>&
     m_readRateLimiter(configuration.readRateLimiter),
     m_userAgent(configuration.userAgent),
     m_hostHeaderOverride(hostHeaderOverride),
-    m_hash(Aws::MakeUnique<Aws::Utils::Crypto::MD5>(LOG_TAG))
+    m_payloadSigningMode(configuration.payloadSigningMode),
+    m_scheme(configuration.scheme),
+    m_md5Pool(Aws::Utils::Crypto::CreateMD5Implementation)
 {
     InitializeGlobalStatics();
 }
@@ -126,9 +136,15 @@ HttpResponseOutcome AWSClient::AttemptExhaustively(const Aws::String& uri,
     const Aws::AmazonWebServiceRequest& request,
     HttpMethod method) const
 {
+    //the body is the same on every attempt, so it is serialized, measured and hashed once and reused by the retries.
+    //digests the caller already had are copied, the request may be in use by other threads.
+    auto payloadDigests = request.GetPayloadDigests() ? Aws::MakeShared<PayloadDigests>(LOG_TAG, *request.GetPayloadDigests())
+        : Aws::MakeShared<PayloadDigests>(LOG_TAG);
+    PreparedRequest preparedRequest = PrepareRequest(request, URI(uri).GetScheme(), payloadDigests);
+
     for (long retries = 0;; retries++)
     {
-        HttpResponseOutcome outcome = AttemptOneRequest(uri, request, method);
+        HttpResponseOutcome outcome = AttemptOneRequest(uri, request, preparedRequest, method);
         if (outcome.IsSuccess() || !m_retryStrategy->ShouldRetry(outcome.GetError(), retries))
         {
             AWS_LOG_TRACE(LOG_TAG, "Request was either successful, or we are now out of retries.");
@@ -174,13 +190,21 @@ static bool DoesResponseGenerateError(const std::shared_ptr<HttpResponse>& respo
 
 }
 
+//the body was damaged on its way here, which another attempt will most likely not repeat.
+static AWSError<CoreErrors> BuildChecksumMismatchError()
+{
+    AWS_LOG_WARN(LOG_TAG, "Response body did not match its x-amz-crc32 header.");
+    return AWSError<CoreErrors>(CoreErrors::NETWORK_CONNECTION, "CRC32CheckFailed", "Response body did not match its x-amz-crc32 header", true);
+}
+
 
 HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri,
     const Aws::AmazonWebServiceRequest& request,
+    const PreparedRequest& preparedRequest,
     HttpMethod method) const
 {
     std::shared_ptr<HttpRequest> httpRequest(m_clientFactory->CreateHttpRequest(uri, method, request.GetResponseStreamFactory()));
-    BuildHttpRequest(request, httpRequest);
+    BuildHttpRequest(request, preparedRequest, httpRequest);
 
     if (!m_signer->SignRequest(*httpRequest))
     {
@@ -198,6 +222,11 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri,
         return HttpResponseOutcome(BuildAWSError(httpResponse));
     }
 
+    if (httpResponse->HasChecksumMismatch())
+    {
+        return HttpResponseOutcome(BuildChecksumMismatchError());
+    }
+
     AWS_LOG_DEBUG(LOG_TAG, "Request returned successful response.");
 
     return HttpResponseOutcome(httpResponse);
@@ -224,6 +253,11 @@ HttpResponseOutcome AWSClient::AttemptOneRequest(const Aws::String& uri, HttpMet
         return HttpResponseOutcome(BuildAWSError(httpResponse));
     }
 
+    if (httpResponse->HasChecksumMismatch())
+    {
+        return HttpResponseOutcome(BuildChecksumMismatchError());
+    }
+
     AWS_LOG_DEBUG(LOG_TAG, "Request returned successful response.");
 
     return HttpResponseOutcome(httpResponse);
@@ -245,7 +279,7 @@ StreamOutcome AWSClient::MakeRequestWithUnparsedResponse(const Aws::String& uri,
 }
 
 void AWSClient::AddHeadersToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest,
-    const Http::HeaderValueCollection& headerValues) const
+    const Http::HttpHeaderCollection& headerValues) const
 {
     for (auto const& headerValue : headerValues)
     {
@@ -256,21 +290,22 @@ void AWSClient::AddHeadersToRequest(const std::shared_ptr<Aws::Http::HttpRequest
 
 }
 
-void AWSClient::AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpRequest>& httpRequest,
-    const std::shared_ptr<Aws::IOStream>& body, bool needsContentMd5) const
+void AWSClient::PrepareContentBody(PreparedRequest& preparedRequest, bool needsContentMd5, bool needsPayloadHash) const
 {
-    httpRequest->AddContentBody(body);
+    auto& headers = preparedRequest.headers;
+    const auto& body = preparedRequest.body;
 
     //If there is no body, we have a content length of 0
     if (!body)
     {
         AWS_LOG_TRACE(LOG_TAG, "No content body, removing content-type and content-length headers");
-        httpRequest->DeleteHeader(Http::CONTENT_LENGTH_HEADER);
-        httpRequest->DeleteHeader(Http::CONTENT_TYPE_HEADER);
+        headers.Erase(Http::CONTENT_LENGTH_HEADER);
+        headers.Erase(Http::CONTENT_TYPE_HEADER);
+        return;
     }
     //in the scenario where we are adding a content body as a stream, the request object likely already
     //has a content-length header set and we don't want to seek the stream just to find this information.
-    if (body && !httpRequest->HasHeader(Http::CONTENT_LENGTH_HEADER))
+    if (!headers.Contains(Http::CONTENT_LENGTH_HEADER))
     {
         AWS_LOG_TRACE(LOG_TAG, "Found body, but content-length has not been set, attempting to compute content-length");
         body->seekg(0, body->end);
@@ -280,37 +315,99 @@ void AWSClient::AddContentBodyToRequest(const std::shared_ptr<Aws::Http::HttpReq
         {
             Aws::StringStream ss;
             ss << streamSize;
-            httpRequest->SetContentLength(ss.str());
+            headers.Set(Http::CONTENT_LENGTH_HEADER, ss.str());
         }
     }
+    preparedRequest.bodyStart = static_cast<long long>(body->tellg());
 
-    if (needsContentMd5 && body && !httpRequest->HasHeader(Http::CONTENT_MD5_HEADER))
+    if (needsContentMd5 && !headers.Contains(Http::CONTENT_MD5_HEADER))
     {
         AWS_LOGSTREAM_TRACE(LOG_TAG, "Found body, and content-md5 needs to be set" <<
            ", attempting to compute content-md5");
 
-        //changing the internal state of the hash computation is not a logical state
-        //change as far as constness goes for this class. Due to the platform specificness
-        //of hash computations, we can't control the fact that computing a hash mutates
-        //state on some platforms such as windows (but that isn't a concern of this class.
-        auto md5HashResult = const_cast<AWSClient*>(this)->m_hash->Calculate(*body);
+        const auto& payloadDigests = preparedRequest.payloadDigests;
+        if (payloadDigests)
+        {
+            //when the signer is going to hash the same body, both digests come out of a single read of it.
+            unsigned digestMask = PayloadDigests::MD5_DIGEST;
+            if (needsPayloadHash)
+            {
+                digestMask |= PayloadDigests::SHA256_DIGEST;
+            }
+            payloadDigests->Compute(*body, digestMask);
+            if (payloadDigests->Has(PayloadDigests::MD5_DIGEST))
+            {
+                headers.Set(Http::CONTENT_MD5_HEADER, HashingUtils::Base64Encode(payloadDigests->GetMD5()));
+            }
+            return;
+        }
+
+        //computing a hash mutates the implementation's state on some platforms such as windows,
+        //so concurrent requests each lease their own from the pool.
+        auto md5HashResult = m_md5Pool.Acquire()->Calculate(*body);
         if(md5HashResult.IsSuccess())
         {
-            httpRequest->SetHeaderValue(Http::CONTENT_MD5_HEADER, HashingUtils::Base64Encode(md5HashResult.GetResult()));
+            headers.Set(Http::CONTENT_MD5_HEADER, HashingUtils::Base64Encode(md5HashResult.GetResult()));
         }
     }
 }
 
+PreparedRequest AWSClient::PrepareRequest(const Aws::AmazonWebServiceRequest& request, Scheme scheme,
+    const std::shared_ptr<PayloadDigests>& payloadDigests) const
+{
+    PreparedRequest preparedRequest;
+    //do headers first since the request likely will set content-length as it's own header.
+    for (const auto& header : request.GetHeaders())
+    {
+        preparedRequest.headers.Set(header.first, header.second);
+    }
+    preparedRequest.body = request.GetBody();
+    preparedRequest.payloadDigests = payloadDigests;
+    PrepareContentBody(preparedRequest, request.ShouldComputeContentMd5(), SignsPayloadHash(request, scheme));
+    return preparedRequest;
+}
+
+PayloadSigningMode AWSClient::GetPayloadSigningMode(const Aws::AmazonWebServiceRequest& request) const
+{
+    return request.PayloadSigningModeHasBeenSet() ? request.GetPayloadSigningMode() : m_payloadSigningMode;
+}
+
+bool AWSClient::SignsPayloadHash(const Aws::AmazonWebServiceRequest& request) const
+{
+    return SignsPayloadHash(request, m_scheme);
+}
+
+bool AWSClient::SignsPayloadHash(const Aws::AmazonWebServiceRequest& request, Scheme scheme) const
+{
+    return m_signer && m_signer->SignsPayloadHash(GetPayloadSigningMode(request), scheme);
+}
+
 void AWSClient::BuildHttpRequest(const Aws::AmazonWebServiceRequest& request,
     const std::shared_ptr<HttpRequest>& httpRequest) const
 {
-    //do headers first since the request likely will set content-length as it's own header.
-    AddHeadersToRequest(httpRequest, request.GetHeaders());
-    AddContentBodyToRequest(httpRequest, request.GetBody(), request.ShouldComputeContentMd5());
+    BuildHttpRequest(request, PrepareRequest(request, httpRequest->GetUri().GetScheme(), httpRequest->GetPayloadDigests()), httpRequest);
+}
+
+void AWSClient::BuildHttpRequest(const Aws::AmazonWebServiceRequest& request, const PreparedRequest& preparedRequest,
+    const std::shared_ptr<HttpRequest>& httpRequest) const
+{
+    AddHeadersToRequest(httpRequest, preparedRequest.headers);
+
+    //an earlier attempt may have sent the body up to its end.
+    const auto& body = preparedRequest.body;
+    if (body && preparedRequest.bodyStart >= 0)
+    {
+        body->clear();
+        body->seekg(preparedRequest.bodyStart, body->beg);
+    }
+    httpRequest->AddContentBody(body);
+    httpRequest->SetPayloadDigests(preparedRequest.payloadDigests);
 
     // Pass along handlers for processing data sent/received in bytes
     httpRequest->SetDataReceivedEventHandler(request.GetDataReceivedEventHandler());
     httpRequest->SetDataSentEventHandler(request.GetDataSentEventHandler());
+    httpRequest->SetStreamingResponseConsumer(request.GetStreamingResponseConsumer());
+    httpRequest->SetPayloadSigningMode(GetPayloadSigningMode(request));
 
     request.AddQueryStringParameters(httpRequest->GetUri());
 }
@@ -336,6 +433,14 @@ Aws::String AWSClient::GeneratePresignedUrl(URI& uri, HttpMethod method, long lo
     return "";
 }
 
+Aws::Vector<Aws::String> AWSClient::GeneratePresignedUrls(const URI& uri, const Aws::Vector<Aws::String>& paths, HttpMethod method,
+    long long expirationInSeconds, Aws::Utils::Threading::Executor* executor)
+{
+    Aws::Vector<Aws::String> urls;
+    m_signer->PresignUrls(uri, method, paths, urls, expirationInSeconds, executor);
+    return urls;
+}
+
 ////////////////////////////////////////////////////////////////////////////
 AWSJsonClient::AWSJsonClient(const std::shared_ptr<Aws::Http::HttpClientFactory const>& clientFactory,
     const Aws::Client::ClientConfiguration& configuration,
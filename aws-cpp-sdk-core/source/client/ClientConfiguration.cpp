@@ -51,7 +51,13 @@ ClientConfiguration::ClientConfiguration() :
     writeRateLimiter(nullptr),
     readRateLimiter(nullptr),
     httpLibOverride(Aws::Http::TransferLibType::DEFAULT_CLIENT),
-    followRedirects(true)
+    followRedirects(true),
+    ioThreads(1),
+    idleConnectionTimeoutMs(60000),
+    enableHttp2Multiplexing(false),
+    maxStreamsPerConnection(100),
+    enableResponseCompression(false),
+    payloadSigningMode(Aws::Http::PayloadSigningMode::SIGNED)
 {
 }
 
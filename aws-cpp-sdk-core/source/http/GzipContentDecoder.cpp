@@ -0,0 +1,155 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/GzipContentDecoder.h>
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/UnreferencedParam.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#ifdef ENABLE_ZLIB
+#include <zlib.h>
+#endif // ENABLE_ZLIB
+
+using namespace Aws::Http;
+using namespace Aws::Utils;
+
+#ifdef ENABLE_ZLIB
+
+static const char* GZIP_DECODER_TAG = "GzipContentDecoder";
+//add 32 to the maximum window size so zlib detects gzip and zlib headers on its own.
+static const int AUTO_DETECT_WINDOW_BITS = 15 + 32;
+
+static voidpf ZlibAlloc(voidpf opaque, uInt items, uInt size)
+{
+    AWS_UNREFERENCED_PARAM(opaque);
+    return Aws::Malloc(GZIP_DECODER_TAG, static_cast<size_t>(items) * size);
+}
+
+static void ZlibFree(voidpf opaque, voidpf address)
+{
+    AWS_UNREFERENCED_PARAM(opaque);
+    Aws::Free(address);
+}
+
+GzipContentDecoder::GzipContentDecoder() :
+    m_stream(nullptr),
+    m_complete(false)
+{
+    z_stream* stream = Aws::New<z_stream>(GZIP_DECODER_TAG);
+    stream->zalloc = &ZlibAlloc;
+    stream->zfree = &ZlibFree;
+    stream->opaque = Z_NULL;
+    stream->next_in = Z_NULL;
+    stream->avail_in = 0;
+
+    if (inflateInit2(stream, AUTO_DETECT_WINDOW_BITS) == Z_OK)
+    {
+        m_stream = stream;
+    }
+    else
+    {
+        Aws::Delete(stream);
+    }
+}
+
+GzipContentDecoder::~GzipContentDecoder()
+{
+    if (m_stream)
+    {
+        z_stream* stream = static_cast<z_stream*>(m_stream);
+        inflateEnd(stream);
+        Aws::Delete(stream);
+    }
+}
+
+bool GzipContentDecoder::IsSupported()
+{
+    return true;
+}
+
+bool GzipContentDecoder::Decode(const char* data, std::size_t length, Aws::String& decoded)
+{
+    z_stream* stream = static_cast<z_stream*>(m_stream);
+    if (!stream)
+    {
+        return false;
+    }
+
+    //callers feed socket sized chunks, far below what avail_in can hold.
+    stream->next_in = reinterpret_cast<Bytef*>(const_cast<char*>(data));
+    stream->avail_in = static_cast<uInt>(length);
+
+    char output[16384];
+    //keep going while input is left, or while a full output buffer means inflate may still be holding decoded bytes back.
+    do
+    {
+        stream->next_out = reinterpret_cast<Bytef*>(output);
+        stream->avail_out = sizeof(output);
+
+        int result = inflate(stream, Z_NO_FLUSH);
+        if (result == Z_STREAM_END)
+        {
+            m_complete = true;
+        }
+        else if (result != Z_OK && result != Z_BUF_ERROR)
+        {
+            return false;
+        }
+
+        decoded.append(output, sizeof(output) - stream->avail_out);
+
+        if (m_complete && stream->avail_in > 0)
+        {
+            //another gzip member follows the one that just ended.
+            inflateReset(stream);
+            m_complete = false;
+        }
+    } while (stream->avail_in > 0 || stream->avail_out == 0);
+
+    return true;
+}
+
+#else
+
+GzipContentDecoder::GzipContentDecoder() :
+    m_stream(nullptr),
+    m_complete(false)
+{
+}
+
+GzipContentDecoder::~GzipContentDecoder()
+{
+}
+
+bool GzipContentDecoder::IsSupported()
+{
+    return false;
+}
+
+bool GzipContentDecoder::Decode(const char* data, std::size_t length, Aws::String& decoded)
+{
+    AWS_UNREFERENCED_PARAM(data);
+    AWS_UNREFERENCED_PARAM(length);
+    AWS_UNREFERENCED_PARAM(decoded);
+    return false;
+}
+
+#endif // ENABLE_ZLIB
+
+bool GzipContentDecoder::CanDecode(const Aws::String& contentEncoding)
+{
+    Aws::String encoding = StringUtils::ToLower(StringUtils::Trim(contentEncoding.c_str()).c_str());
+    return encoding == "gzip" || encoding == "x-gzip" || encoding == "deflate";
+}
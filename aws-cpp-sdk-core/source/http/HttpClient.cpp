@@ -14,6 +14,8 @@
   */
 
 #include <aws/core/http/HttpClient.h>
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpResponse.h>
 
 using namespace Aws;
 using namespace Aws::Http;
@@ -25,6 +27,16 @@ HttpClient::HttpClient() :
 {
 }
 
+void HttpClient::MakeRequestAsync(const std::shared_ptr<HttpRequest>& request, const HttpRequestCompletedHandler& onCompleted,
+    Aws::Utils::RateLimits::RateLimiterInterface* readLimiter, Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    std::shared_ptr<HttpResponse> response = MakeRequest(*request, readLimiter, writeLimiter);
+    if (onCompleted)
+    {
+        onCompleted(request, response);
+    }
+}
+
 void HttpClient::DisableRequestProcessing() 
 { 
     m_disableRequestProcessing = true;
@@ -17,6 +17,7 @@
 
 #if ENABLE_CURL_CLIENT
     #include <aws/core/http/curl/CurlHttpClient.h>
+    #include <aws/core/http/curl/CurlMultiHttpClient.h>
 #elif ENABLE_WINDOWS_CLIENT
     #include <aws/core/http/windows/WinINetSyncHttpClient.h>
     #include <aws/core/http/windows/WinHttpSyncHttpClient.h>
@@ -48,6 +49,14 @@ std::shared_ptr<HttpClient> HttpClientFactory::CreateHttpClient(const ClientConf
             return Aws::MakeShared<WinHttpSyncHttpClient>(allocationTag, clientConfiguration);
     }
 #elif ENABLE_CURL_CLIENT
+#ifndef _WIN32
+    //multiplexing needs the multi interface, an explicit CURL_CLIENT override still gets HTTP/2 but one stream per connection.
+    if (clientConfiguration.httpLibOverride == TransferLibType::CURL_MULTI_CLIENT ||
+        (clientConfiguration.enableHttp2Multiplexing && clientConfiguration.httpLibOverride != TransferLibType::CURL_CLIENT))
+    {
+        return Aws::MakeShared<CurlMultiHttpClient>(allocationTag, clientConfiguration);
+    }
+#endif
     return Aws::MakeShared<CurlHttpClient>(allocationTag, clientConfiguration);
 #else
     return nullptr;
@@ -0,0 +1,120 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/HttpHeaderCollection.h>
+
+#include <algorithm>
+
+using namespace Aws::Http;
+
+const size_t HttpHeaderCollection::INITIAL_CAPACITY;
+
+static inline unsigned char ToLowerAscii(char c)
+{
+    return static_cast<unsigned char>(c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c);
+}
+
+//orders a stored (lower cased) name against a name of any case, the way strcmp would order the lower cased form of both.
+static inline int CompareName(const Aws::String& storedName, const char* name, size_t nameLength)
+{
+    size_t commonLength = std::min(storedName.length(), nameLength);
+    for (size_t i = 0; i < commonLength; ++i)
+    {
+        unsigned char stored = static_cast<unsigned char>(storedName[i]);
+        unsigned char other = ToLowerAscii(name[i]);
+        if (stored != other)
+        {
+            return stored < other ? -1 : 1;
+        }
+    }
+    return storedName.length() == nameLength ? 0 : (storedName.length() < nameLength ? -1 : 1);
+}
+
+HttpHeaderCollection::Storage::const_iterator HttpHeaderCollection::LowerBound(const char* name, size_t nameLength) const
+{
+    return std::lower_bound(m_headers.begin(), m_headers.end(), name, [nameLength](const HeaderValuePair& header, const char* key)
+    {
+        return CompareName(header.first, key, nameLength) < 0;
+    });
+}
+
+HttpHeaderCollection::Storage::iterator HttpHeaderCollection::LowerBound(const char* name, size_t nameLength)
+{
+    return std::lower_bound(m_headers.begin(), m_headers.end(), name, [nameLength](const HeaderValuePair& header, const char* key)
+    {
+        return CompareName(header.first, key, nameLength) < 0;
+    });
+}
+
+const Aws::String* HttpHeaderCollection::Find(const char* name, size_t nameLength) const
+{
+    auto iter = LowerBound(name, nameLength);
+    if (iter != m_headers.end() && CompareName(iter->first, name, nameLength) == 0)
+    {
+        return &iter->second;
+    }
+    return nullptr;
+}
+
+const Aws::String& HttpHeaderCollection::GetValue(const char* name) const
+{
+    static const Aws::String emptyValue;
+    const Aws::String* value = Find(name);
+    return value ? *value : emptyValue;
+}
+
+void HttpHeaderCollection::Set(const char* name, size_t nameLength, const char* value, size_t valueLength)
+{
+    auto iter = LowerBound(name, nameLength);
+    if (iter != m_headers.end() && CompareName(iter->first, name, nameLength) == 0)
+    {
+        iter->second.assign(value, valueLength);
+        return;
+    }
+
+    if (m_headers.capacity() == 0)
+    {
+        m_headers.reserve(INITIAL_CAPACITY);
+        iter = m_headers.end();
+    }
+
+    iter = m_headers.emplace(iter, HeaderValuePair(Aws::String(name, nameLength), Aws::String(value, valueLength)));
+    for (auto& c : iter->first)
+    {
+        c = static_cast<char>(ToLowerAscii(c));
+    }
+}
+
+bool HttpHeaderCollection::Erase(const char* name)
+{
+    size_t nameLength = strlen(name);
+    auto iter = LowerBound(name, nameLength);
+    if (iter != m_headers.end() && CompareName(iter->first, name, nameLength) == 0)
+    {
+        m_headers.erase(iter);
+        return true;
+    }
+    return false;
+}
+
+HeaderValueCollection HttpHeaderCollection::ToMap() const
+{
+    HeaderValueCollection headers;
+    for (const auto& header : m_headers)
+    {
+        headers.emplace_hint(headers.end(), header);
+    }
+    return headers;
+}
@@ -30,6 +30,7 @@ const char* AUTHORIZATION_HEADER = "authorization";
 const char* AWS_AUTHORIZATION_HEADER = "authorization";
 const char* COOKIE_HEADER = "cookie";
 const char* CONTENT_LENGTH_HEADER = "content-length";
+const char* CONTENT_ENCODING_HEADER = "content-encoding";
 const char* CONTENT_TYPE_HEADER = "content-type";
 const char* USER_AGENT_HEADER = "user-agent";
 const char* VIA_HEADER = "via";
@@ -37,6 +38,7 @@ const char* HOST_HEADER = "host";
 const char* AMZ_TARGET_HEADER = "x-amz-target";
 const char* X_AMZ_EXPIRES_HEADER = "X-Amz-Expires";
 const char* CONTENT_MD5_HEADER = "content-md5";
+const char* X_AMZ_CRC32_HEADER = "x-amz-crc32";
 
 } // Http
 } // Aws
@@ -0,0 +1,115 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/HttpRequestBody.h>
+#include <aws/core/utils/memory/stl/AWSAllocator.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+
+#include <iostream>
+
+using namespace Aws::Http;
+using namespace Aws::Utils::Stream;
+
+static const char* REQUEST_BODY_TAG = "HttpRequestBody";
+
+namespace
+{
+    /**
+     * Body over a PreallocatedStreamBuf: the length is just pointer arithmetic and reads are a memcpy.
+     */
+    class ContiguousRequestBody : public HttpRequestBody
+    {
+    public:
+        ContiguousRequestBody(const std::shared_ptr<Aws::IOStream>& stream, PreallocatedStreamBuf* streamBuf) :
+            HttpRequestBody(stream), m_streamBuf(streamBuf), m_length(-1)
+        {}
+
+        int64_t GetLength() const override
+        {
+            if (m_length < 0)
+            {
+                m_length = static_cast<int64_t>(m_streamBuf->GetLength() - m_streamBuf->GetReadOffset());
+            }
+            return m_length;
+        }
+
+        std::size_t Read(char* buffer, std::size_t size) override
+        {
+            GetLength();
+            return static_cast<std::size_t>(m_streamBuf->sgetn(buffer, static_cast<std::streamsize>(size)));
+        }
+
+    private:
+        PreallocatedStreamBuf* m_streamBuf;
+        mutable int64_t m_length;
+    };
+
+    /**
+     * Body over any other stream, files included. The length costs one pair of seeks the first time it is asked for,
+     * after that the stream buffer is only ever read forward.
+     */
+    class StreamRequestBody : public HttpRequestBody
+    {
+    public:
+        StreamRequestBody(const std::shared_ptr<Aws::IOStream>& stream) :
+            HttpRequestBody(stream), m_length(-1), m_measured(false)
+        {}
+
+        int64_t GetLength() const override
+        {
+            if (!m_measured)
+            {
+                m_measured = true;
+                std::streambuf* streamBuf = m_stream->rdbuf();
+                auto start = streamBuf->pubseekoff(0, std::ios_base::cur, std::ios_base::in);
+                auto end = streamBuf->pubseekoff(0, std::ios_base::end, std::ios_base::in);
+                if (start != std::streampos(-1) && end != std::streampos(-1))
+                {
+                    m_length = static_cast<int64_t>(end - start);
+                    streamBuf->pubseekpos(start, std::ios_base::in);
+                }
+            }
+            return m_length;
+        }
+
+        std::size_t Read(char* buffer, std::size_t size) override
+        {
+            //the start position has to be captured before the first read moves it.
+            GetLength();
+            std::streamsize bytesRead = m_stream->rdbuf()->sgetn(buffer, static_cast<std::streamsize>(size));
+            return bytesRead > 0 ? static_cast<std::size_t>(bytesRead) : 0;
+        }
+
+    private:
+        mutable int64_t m_length;
+        mutable bool m_measured;
+    };
+}
+
+std::shared_ptr<HttpRequestBody> HttpRequestBody::Create(const std::shared_ptr<Aws::IOStream>& stream)
+{
+    if (!stream)
+    {
+        return nullptr;
+    }
+
+    PreallocatedStreamBuf* preallocatedBuf = PreallocatedIOStream::GetPreallocatedStreamBuf(*stream);
+    if (preallocatedBuf)
+    {
+        return Aws::MakeShared<ContiguousRequestBody>(REQUEST_BODY_TAG, stream, preallocatedBuf);
+    }
+
+    return Aws::MakeShared<StreamRequestBody>(REQUEST_BODY_TAG, stream);
+}
@@ -0,0 +1,58 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/http/StreamingResponseConsumer.h>
+
+using namespace Aws::Http;
+
+StreamingResponseConsumer::StreamingResponseConsumer() :
+    m_paused(false)
+{
+}
+
+StreamingConsumerAction StreamingResponseConsumer::Deliver(const HttpResponse& response, const char* data, std::size_t length)
+{
+    //mark paused before handing the chunk over, so a Resume() that races with a PAUSE return is never lost.
+    m_paused = true;
+    StreamingConsumerAction action = OnDataReceived(response, data, length);
+    if (action == StreamingConsumerAction::CONTINUE)
+    {
+        m_paused = false;
+    }
+    return action;
+}
+
+void StreamingResponseConsumer::Resume()
+{
+    std::lock_guard<std::mutex> locker(m_resumeMutex);
+    m_paused = false;
+    if (m_resumeHandler)
+    {
+        m_resumeHandler();
+    }
+    m_resumeSignal.notify_all();
+}
+
+void StreamingResponseConsumer::SetResumeHandler(const std::function<void()>& handler)
+{
+    std::lock_guard<std::mutex> locker(m_resumeMutex);
+    m_resumeHandler = handler;
+}
+
+bool StreamingResponseConsumer::WaitForResume(std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> locker(m_resumeMutex);
+    return m_resumeSignal.wait_for(locker, timeout, [this] { return !m_paused; });
+}
@@ -15,10 +15,12 @@
 
 #include <aws/core/http/URI.h>
 
+#include <aws/core/utils/StringBuilder.h>
 #include <aws/core/utils/StringUtils.h>
-#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
 
 #include <stdlib.h>
+#include <string.h>
 #include <cctype>
 #include <cassert>
 #include <algorithm>
@@ -110,21 +112,34 @@ void URI::SetScheme(Scheme value)
 
 Aws::String URI::URLEncodePath(const Aws::String& path)
 {
-    Aws::Vector<Aws::String> pathParts = StringUtils::Split(path, '/');
-    Aws::StringStream ss;
+    StringBuilder<> encoded;
+    encoded.Reserve(path.length() + 1);
+    AppendURLEncodedPath(encoded, path.c_str(), path.length());
+    return encoded.ToString();
+}
 
-    for (Aws::Vector<Aws::String>::iterator iter = pathParts.begin(); iter != pathParts.end(); ++iter)
+void URI::AppendURLEncodedPath(StringBuilderBase& builder, const char* path, size_t length)
+{
+    //encode each non empty segment between slashes; empty segments collapse the same way a split on '/' would.
+    size_t segmentStart = 0;
+    while (segmentStart < length)
     {
-        ss << '/' << StringUtils::URLEncode(iter->c_str());
+        const char* slash = static_cast<const char*>(memchr(path + segmentStart, '/', length - segmentStart));
+        size_t segmentEnd = slash ? static_cast<size_t>(slash - path) : length;
+
+        if (segmentEnd > segmentStart)
+        {
+            builder.Append('/');
+            builder.AppendURLEncoded(path + segmentStart, segmentEnd - segmentStart);
+        }
+        segmentStart = segmentEnd + 1;
     }
 
     //if the last character was also a slash, then add that back here.
-    if (path[path.length() - 1] == '/')
+    if (length > 0 && path[length - 1] == '/')
     {
-        ss << '/';
+        builder.Append('/');
     }
-
-    return ss.str();
 }
 
 void URI::SetPath(const Aws::String& value)
@@ -182,75 +197,113 @@ QueryStringParameterCollection URI::GetQueryStringParameters(bool decode) const
     return parameterCollection;
 }
 
-void URI::CanonicalizeQueryString()
+namespace
 {
-    QueryStringParameterCollection sortedParameters = GetQueryStringParameters(false);
-    Aws::StringStream queryStringStream;
+    //one key=value pair of the query string, by position, so sorting moves three numbers instead of two strings.
+    struct QueryParameterSpan
+    {
+        size_t offset;
+        size_t keyLength;
+        size_t valueOffset;
+        size_t valueLength;
+    };
 
-    bool first = true;
+    inline int CompareRanges(const char* left, size_t leftLength, const char* right, size_t rightLength)
+    {
+        int result = memcmp(left, right, std::min(leftLength, rightLength));
+        if (result != 0)
+        {
+            return result;
+        }
+        return leftLength < rightLength ? -1 : (leftLength > rightLength ? 1 : 0);
+    }
+}
 
-    if(sortedParameters.size() > 0)
+void URI::CanonicalizeQueryString()
+{
+    if(m_queryString.find('=') == Aws::String::npos)
     {
-        queryStringStream << "?";
+        return;
     }
 
-    if(m_queryString.find("=") != std::string::npos)
+    //the parameters are encoded already, so they only need sorting; do that on spans of the query string instead of splitting it up.
+    const char* query = m_queryString.c_str();
+    size_t queryLength = m_queryString.size();
+    Aws::Vector<QueryParameterSpan> parameters;
+    size_t position = query[0] == '?' ? 1 : 0;
+    while (position < queryLength)
     {
-        for (QueryStringParameterCollection::iterator iter = sortedParameters.begin();
-             iter != sortedParameters.end(); ++iter)
+        const char* ampersand = static_cast<const char*>(memchr(query + position, '&', queryLength - position));
+        size_t end = ampersand ? static_cast<size_t>(ampersand - query) : queryLength;
+        if (end > position)
         {
-            if (!first)
-            {
-                queryStringStream << "&";
-            }
+            const char* equals = static_cast<const char*>(memchr(query + position, '=', end - position));
+            QueryParameterSpan parameter;
+            parameter.offset = position;
+            parameter.keyLength = equals ? static_cast<size_t>(equals - query) - position : end - position;
+            parameter.valueOffset = equals ? static_cast<size_t>(equals - query) + 1 : end;
+            parameter.valueLength = end - parameter.valueOffset;
+            parameters.push_back(parameter);
+        }
+        position = end + 1;
+    }
 
-            first = false;
-            queryStringStream << iter->first << "=" << iter->second;
+    //sigv4 orders by key and then by value, so repeated keys all stay in.
+    std::sort(parameters.begin(), parameters.end(), [query](const QueryParameterSpan& left, const QueryParameterSpan& right)
+    {
+        int byKey = CompareRanges(query + left.offset, left.keyLength, query + right.offset, right.keyLength);
+        if (byKey != 0)
+        {
+            return byKey < 0;
         }
+        return CompareRanges(query + left.valueOffset, left.valueLength, query + right.valueOffset, right.valueLength) < 0;
+    });
 
-        m_queryString = queryStringStream.str();
+    StringBuilder<> canonical;
+    canonical.Reserve(queryLength + parameters.size() + 2);
+    for (const auto& parameter : parameters)
+    {
+        canonical.Append(canonical.IsEmpty() ? '?' : '&');
+        canonical.Append(query + parameter.offset, parameter.keyLength).Append('=');
+        canonical.Append(query + parameter.valueOffset, parameter.valueLength);
     }
+
+    m_queryString.assign(canonical.GetData(), canonical.GetLength());
 }
 
 void URI::AddQueryStringParameter(const char* key, const Aws::String& value)
 {
-    if (m_queryString.size() <= 0)
-    {
-        m_queryString.append("?");
-    }
-    else
-    {
-        m_queryString.append("&");
-    }
-
-    m_queryString.append(StringUtils::URLEncode(key) + "=" + StringUtils::URLEncode(value.c_str()));
+    StringBuilder<> parameter;
+    parameter.Append(m_queryString.empty() ? '?' : '&');
+    parameter.AppendURLEncoded(key, strlen(key)).Append('=').AppendURLEncoded(value.c_str(), value.length());
+    m_queryString.append(parameter.GetData(), parameter.GetLength());
 }
 
 Aws::String URI::GetURIString(bool includeQueryString) const
 {
     assert(m_authority.size() > 0);
 
-    Aws::StringStream ss;
-    ss << SchemeMapper::ToString(m_scheme) << SEPARATOR << m_authority;
+    StringBuilder<> uriString;
+    uriString.Append(SchemeMapper::ToString(m_scheme)).Append(SEPARATOR).Append(m_authority);
 
     if (m_scheme == Scheme::HTTP && m_port != HTTP_DEFAULT_PORT)
     {
-        ss << ":" << m_port;
+        uriString.Append(':').AppendDecimal(static_cast<unsigned long long>(m_port));
     }
     else if (m_scheme == Scheme::HTTPS && m_port != HTTPS_DEFAULT_PORT)
     {
-        ss << ":" << m_port;
+        uriString.Append(':').AppendDecimal(static_cast<unsigned long long>(m_port));
     }
 
     if(m_path != "/")
     {
-        ss << m_path;
+        uriString.Append(m_path);
     }
 
     if(includeQueryString)
-        ss << m_queryString;
+        uriString.Append(m_queryString);
 
-    return ss.str();
+    return uriString.ToString();
 }
 
 void URI::ParseURIParts(const Aws::String& uri)
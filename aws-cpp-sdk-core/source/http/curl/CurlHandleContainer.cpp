@@ -15,6 +15,9 @@
 
 #include <aws/core/http/curl/CurlHandleContainer.h>
 #include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/UnreferencedParam.h>
+
+#include <chrono>
 
 #undef min
 
@@ -127,9 +130,55 @@ static char* strdup_callback(const char* str)
 
 
 
-CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout, long connectTimeout) :
-                m_maxPoolSize(maxSize), m_requestTimeout(requestTimeout), m_connectTimeout(connectTimeout),
-                m_poolSize(0)
+static const size_t MAX_ENDPOINTS = 64;
+
+static std::mutex s_shareHandleMutex;
+static CURLSH* s_shareHandle = nullptr;
+static unsigned s_shareHandleRefCount = 0;
+static std::mutex s_shareDataLocks[CURL_LOCK_DATA_LAST];
+
+static void LockShareData(CURL* handle, curl_lock_data data, curl_lock_access access, void* userptr)
+{
+    AWS_UNREFERENCED_PARAM(handle);
+    AWS_UNREFERENCED_PARAM(access);
+    AWS_UNREFERENCED_PARAM(userptr);
+    s_shareDataLocks[data].lock();
+}
+
+static void UnlockShareData(CURL* handle, curl_lock_data data, void* userptr)
+{
+    AWS_UNREFERENCED_PARAM(handle);
+    AWS_UNREFERENCED_PARAM(userptr);
+    s_shareDataLocks[data].unlock();
+}
+
+static long long NowMs()
+{
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+static size_t HashEndpoint(const Aws::String& endpoint)
+{
+    //FNV-1a, we only need a cheap, stable spread over a handful of endpoints.
+    size_t hash = 2166136261u;
+    for (char c : endpoint)
+    {
+        hash = (hash ^ static_cast<unsigned char>(c)) * 16777619u;
+    }
+    return hash;
+}
+
+static size_t ThreadSlotHint()
+{
+    //start each thread's slot scan at a different place to keep threads off each other's cache lines.
+    return std::hash<std::thread::id>()(std::this_thread::get_id());
+}
+
+CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout, long connectTimeout, unsigned long idleTimeout) :
+                m_buckets(MAX_ENDPOINTS), m_waiters(0),
+                m_maxPoolSize(maxSize > 0 ? maxSize : 1), m_requestTimeout(requestTimeout), m_connectTimeout(connectTimeout),
+                m_idleTimeout(idleTimeout), m_poolSize(0), m_hits(0), m_misses(0), m_waits(0), m_waitTimeMicroseconds(0), m_reaped(0),
+                m_stopReaper(false), m_shareHandle(nullptr)
 {
     AWS_LOGSTREAM_INFO(CurlTag, "Initializing CurlHandleContainer with size " << maxSize);
     if (!isInit)
@@ -142,90 +191,389 @@ CurlHandleContainer::CurlHandleContainer(unsigned maxSize, long requestTimeout,
         curl_global_init(CURL_GLOBAL_ALL);
 #endif
     }
+
+    m_shareHandle = AcquireShareHandle();
+
+    if (m_idleTimeout > 0)
+    {
+        m_reaperThread = std::thread([this]
+        {
+            std::unique_lock<std::mutex> locker(m_reaperMutex);
+            //check twice per timeout so a handle is never kept much longer than asked for.
+            auto interval = std::chrono::milliseconds(m_idleTimeout / 2 > 0 ? m_idleTimeout / 2 : 1);
+            while (!m_reaperSignal.wait_for(locker, interval, [this] { return m_stopReaper; }))
+            {
+                locker.unlock();
+                ReapIdleHandles();
+                locker.lock();
+            }
+        });
+    }
 }
 
 CurlHandleContainer::~CurlHandleContainer()
 {
     AWS_LOG_INFO(CurlTag, "Cleaning up CurlHandleContainer.");
-    while (m_handleContainer.size() > 0)
+    if (m_reaperThread.joinable())
     {
-        AWS_LOG_DEBUG(CurlTag, "Cleaning up %p.", m_handleContainer.top());
-        curl_easy_cleanup(m_handleContainer.top());
-        m_handleContainer.pop();
+        {
+            std::lock_guard<std::mutex> locker(m_reaperMutex);
+            m_stopReaper = true;
+        }
+        m_reaperSignal.notify_one();
+        m_reaperThread.join();
     }
+
+    for (auto& bucketPtr : m_buckets)
+    {
+        EndpointBucket* bucket = bucketPtr.load();
+        if (!bucket)
+        {
+            continue;
+        }
+
+        for (auto& slot : bucket->slots)
+        {
+            CURL* handle = slot.handle.exchange(nullptr);
+            if (handle)
+            {
+                AWS_LOG_DEBUG(CurlTag, "Cleaning up %p.", handle);
+                curl_easy_cleanup(handle);
+            }
+        }
+        Aws::Delete(bucket);
+    }
+
+    //every handle that pointed at the share is gone now.
+    ReleaseShareHandle();
 }
 
-CURL* CurlHandleContainer::AcquireCurlHandle()
+CURL* CurlHandleContainer::AcquireCurlHandle(const Aws::String& endpoint)
 {
-    AWS_LOG_DEBUG(CurlTag, "Attempting to acquire curl connection.");
-    std::unique_lock<std::mutex> locker(m_handleContainerMutex);
+    AWS_LOGSTREAM_DEBUG(CurlTag, "Attempting to acquire curl connection for " << endpoint);
+    EndpointBucket* bucket = FindOrCreateBucket(endpoint);
+
+    CURL* handle = TryPop(bucket);
+    if (handle)
+    {
+        ++m_hits;
+        AWS_LOGSTREAM_DEBUG(CurlTag, "Returning connection handle " << handle);
+        return handle;
+    }
+
+    ++m_misses;
+    handle = TryCreateHandle();
+    if (!handle)
+    {
+        handle = TryStealHandle(bucket);
+    }
 
-    while (m_handleContainer.size() == 0)
+    if (!handle)
     {
-        AWS_LOG_DEBUG(CurlTag, "No current connections available in pool. Attempting to create new connections.");
-        if (!CheckAndGrowPool())
+        AWS_LOG_INFO(CurlTag, "Connection pool has reached its max size. Waiting on connection to be freed.");
+        ++m_waits;
+        auto waitStart = std::chrono::steady_clock::now();
+
+        std::unique_lock<std::mutex> locker(m_handleContainerMutex);
+        //registering before the re-check guarantees a concurrent release either shows up in the re-check or notifies us.
+        ++m_waiters;
+        while (!(handle = TryPop(bucket)) && !(handle = TryCreateHandle()) && !(handle = TryStealHandle(bucket)))
         {
-            AWS_LOG_INFO(CurlTag, "Connection pool has reached its max size. Waiting on connection to be freed.");
-            m_conditionVariable.wait(locker);
-            AWS_LOG_INFO(CurlTag, "Connection has been released. Continuing.");
+            m_conditionVariable.wait_for(locker, std::chrono::milliseconds(100));
         }
+        --m_waiters;
+
+        m_waitTimeMicroseconds += static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - waitStart).count());
+        AWS_LOG_INFO(CurlTag, "Connection has been released. Continuing.");
     }
 
-    CURL* handle = m_handleContainer.top();
     AWS_LOGSTREAM_DEBUG(CurlTag, "Returning connection handle " << handle);
-    m_handleContainer.pop();
     return handle;
 }
 
-void CurlHandleContainer::ReleaseCurlHandle(CURL* handle)
+void CurlHandleContainer::ReleaseCurlHandle(CURL* handle, const Aws::String& endpoint)
 {
     if (handle)
     {
-        curl_easy_reset(handle);
-        SetDefaultOptionsOnHandle(handle);
+        ResetRequestOptions(handle);
         AWS_LOGSTREAM_DEBUG(CurlTag, "Releasing curl handle " << handle);
-        std::unique_lock<std::mutex> locker(m_handleContainerMutex);
-        m_handleContainer.push(handle);
-        locker.unlock();
-        AWS_LOG_DEBUG(CurlTag, "Notifying waiting threads.");
-        m_conditionVariable.notify_one();
+        Push(FindOrCreateBucket(endpoint), handle);
+        NotifyWaiters();
     }
 }
 
-bool CurlHandleContainer::CheckAndGrowPool()
+unsigned CurlHandleContainer::Prewarm(const Aws::String& endpoint, unsigned count, const std::function<void(CURL*)>& setOptions)
 {
-    if (m_poolSize < m_maxPoolSize)
+    AWS_LOGSTREAM_INFO(CurlTag, "Prewarming up to " << count << " connections to " << endpoint);
+    Aws::Vector<CURL*> handles;
+    for (unsigned i = 0; i < count; ++i)
+    {
+        CURL* handle = TryCreateHandle();
+        if (!handle)
+        {
+            break;
+        }
+        handles.push_back(handle);
+    }
+
+    if (handles.empty())
     {
-        unsigned multiplier = m_poolSize > 0 ? m_poolSize : 1;
-        unsigned amountToAdd = std::min(multiplier * 2, m_maxPoolSize - m_poolSize);
-        AWS_LOGSTREAM_DEBUG(CurlTag, "attempting to grow pool size by " << amountToAdd);
+        return 0;
+    }
 
-        unsigned actuallyAdded = 0;
-        for (unsigned i = 0; i < amountToAdd; ++i)
+    //every handle runs its own transfer on its own thread, so the handshakes overlap and each handle keeps its connection
+    //in its own cache. Driving them through a temporary multi handle would leave the connections in that multi's cache,
+    //which closes them on cleanup.
+    Aws::Vector<std::thread> transfers;
+    for (CURL* handle : handles)
+    {
+        setOptions(handle);
+        transfers.push_back(std::thread([handle, &endpoint]
         {
-            CURL* curlHandle = curl_easy_init();
+            CURLcode result = curl_easy_perform(handle);
+            if (result != CURLE_OK)
+            {
+                AWS_LOGSTREAM_WARN(CurlTag, "Prewarming a connection to " << endpoint << " failed with curl error " << result);
+            }
+        }));
+    }
+
+    for (auto& transfer : transfers)
+    {
+        transfer.join();
+    }
+
+    for (CURL* handle : handles)
+    {
+        ReleaseCurlHandle(handle, endpoint);
+    }
+
+    return static_cast<unsigned>(handles.size());
+}
+
+CurlHandlePoolStats CurlHandleContainer::GetStats() const
+{
+    CurlHandlePoolStats stats;
+    stats.hits = m_hits;
+    stats.misses = m_misses;
+    stats.waits = m_waits;
+    stats.waitTimeMicroseconds = m_waitTimeMicroseconds;
+    stats.reaped = m_reaped;
+    stats.poolSize = m_poolSize;
+    return stats;
+}
+
+CurlHandleContainer::EndpointBucket* CurlHandleContainer::FindOrCreateBucket(const Aws::String& endpoint)
+{
+    size_t start = HashEndpoint(endpoint) % m_buckets.size();
+    for (size_t i = 0; i < m_buckets.size(); ++i)
+    {
+        EndpointBucket* bucket = m_buckets[(start + i) % m_buckets.size()].load(std::memory_order_acquire);
+        if (!bucket)
+        {
+            break;
+        }
+        if (bucket->endpoint == endpoint)
+        {
+            return bucket;
+        }
+    }
+
+    std::lock_guard<std::mutex> locker(m_bucketCreationMutex);
+    for (size_t i = 0; i < m_buckets.size(); ++i)
+    {
+        auto& bucketPtr = m_buckets[(start + i) % m_buckets.size()];
+        EndpointBucket* bucket = bucketPtr.load(std::memory_order_acquire);
+        if (!bucket)
+        {
+            bucket = Aws::New<EndpointBucket>(CurlTag, endpoint, m_maxPoolSize);
+            bucketPtr.store(bucket, std::memory_order_release);
+            return bucket;
+        }
+        if (bucket->endpoint == endpoint)
+        {
+            return bucket;
+        }
+    }
+
+    //the table is full; a process talking to this many endpoints just shares the first bucket we probed.
+    AWS_LOGSTREAM_DEBUG(CurlTag, "Endpoint table is full, pooling " << endpoint << " with another endpoint.");
+    return m_buckets[start].load(std::memory_order_acquire);
+}
+
+CURL* CurlHandleContainer::TryPop(EndpointBucket* bucket)
+{
+    size_t slotCount = bucket->slots.size();
+    size_t start = ThreadSlotHint() % slotCount;
+    for (size_t i = 0; i < slotCount; ++i)
+    {
+        auto& slot = bucket->slots[(start + i) % slotCount];
+        if (slot.handle.load())
+        {
+            CURL* handle = slot.handle.exchange(nullptr);
+            if (handle)
+            {
+                return handle;
+            }
+        }
+    }
+    return nullptr;
+}
 
+void CurlHandleContainer::Push(EndpointBucket* bucket, CURL* handle)
+{
+    size_t slotCount = bucket->slots.size();
+    size_t start = ThreadSlotHint() % slotCount;
+    //there is a slot per handle the pool may own, so this terminates even under contention.
+    for (size_t i = 0; ; ++i)
+    {
+        auto& slot = bucket->slots[(start + i) % slotCount];
+        CURL* expected = nullptr;
+        if (!slot.handle.load(std::memory_order_relaxed))
+        {
+            slot.releasedAt.store(NowMs(), std::memory_order_relaxed);
+            if (slot.handle.compare_exchange_strong(expected, handle))
+            {
+                return;
+            }
+        }
+    }
+}
+
+CURL* CurlHandleContainer::TryCreateHandle()
+{
+    unsigned poolSize = m_poolSize.load();
+    while (poolSize < m_maxPoolSize)
+    {
+        if (m_poolSize.compare_exchange_weak(poolSize, poolSize + 1))
+        {
+            CURL* curlHandle = curl_easy_init();
             if (curlHandle)
             {
                 SetDefaultOptionsOnHandle(curlHandle);
-                m_handleContainer.push(curlHandle);
-                ++actuallyAdded;
+                AWS_LOGSTREAM_INFO(CurlTag, "Pool grown to " << poolSize + 1);
+                return curlHandle;
+            }
+
+            AWS_LOG_ERROR(CurlTag, "curl_easy_init failed to allocate.");
+            --m_poolSize;
+            return nullptr;
+        }
+    }
+
+    return nullptr;
+}
+
+CURL* CurlHandleContainer::TryStealHandle(EndpointBucket* exclude)
+{
+    for (auto& bucketPtr : m_buckets)
+    {
+        EndpointBucket* bucket = bucketPtr.load(std::memory_order_acquire);
+        if (bucket && bucket != exclude)
+        {
+            CURL* handle = TryPop(bucket);
+            if (handle)
+            {
+                return handle;
+            }
+        }
+    }
+    return nullptr;
+}
+
+void CurlHandleContainer::NotifyWaiters()
+{
+    if (m_waiters.load() > 0)
+    {
+        std::lock_guard<std::mutex> locker(m_handleContainerMutex);
+        AWS_LOG_DEBUG(CurlTag, "Notifying waiting threads.");
+        m_conditionVariable.notify_one();
+    }
+}
+
+void CurlHandleContainer::ReapIdleHandles()
+{
+    long long cutoff = NowMs() - static_cast<long long>(m_idleTimeout);
+    unsigned reaped = 0;
+
+    for (auto& bucketPtr : m_buckets)
+    {
+        EndpointBucket* bucket = bucketPtr.load(std::memory_order_acquire);
+        if (!bucket)
+        {
+            continue;
+        }
+
+        for (auto& slot : bucket->slots)
+        {
+            if (!slot.handle.load(std::memory_order_relaxed) || slot.releasedAt.load(std::memory_order_relaxed) > cutoff)
+            {
+                continue;
+            }
+
+            CURL* handle = slot.handle.exchange(nullptr);
+            if (!handle)
+            {
+                continue;
+            }
+
+            if (slot.releasedAt.load(std::memory_order_relaxed) <= cutoff)
+            {
+                curl_easy_cleanup(handle);
+                --m_poolSize;
+                ++reaped;
             }
             else
             {
-                AWS_LOG_ERROR(CurlTag, "curl_easy_init failed to allocate. Will continue retrying until amount to add has exhausted.");
+                //released again between our check and the exchange, it is not idle after all.
+                Push(bucket, handle);
             }
         }
+    }
 
-        AWS_LOGSTREAM_INFO(CurlTag, "Pool successfully grown by " << actuallyAdded);
-        m_poolSize += actuallyAdded;
+    if (reaped > 0)
+    {
+        m_reaped += reaped;
+        AWS_LOGSTREAM_INFO(CurlTag, "Closed " << reaped << " idle connections.");
+        //shrinking the pool makes room for blocked acquires to create handles.
+        NotifyWaiters();
+    }
+}
 
-        return actuallyAdded > 0;
+CURLSH* CurlHandleContainer::AcquireShareHandle()
+{
+    std::lock_guard<std::mutex> locker(s_shareHandleMutex);
+    if (!s_shareHandle)
+    {
+        s_shareHandle = curl_share_init();
+        if (!s_shareHandle)
+        {
+            AWS_LOG_ERROR(CurlTag, "curl_share_init failed, dns and tls session caches will not be shared.");
+            return nullptr;
+        }
+
+        curl_share_setopt(s_shareHandle, CURLSHOPT_LOCKFUNC, &LockShareData);
+        curl_share_setopt(s_shareHandle, CURLSHOPT_UNLOCKFUNC, &UnlockShareData);
+        curl_share_setopt(s_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+        curl_share_setopt(s_shareHandle, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+        //CURL_LOCK_DATA_CONNECT is left out on purpose: libcurl does not support using a shared connection cache from
+        //concurrent threads, which is exactly how the pooled handles are used. The per endpoint pool keeps connections warm instead.
+        AWS_LOG_INFO(CurlTag, "Created process wide curl share for dns and tls sessions.");
     }
 
-    AWS_LOG_INFO(CurlTag, "Pool cannot be grown any further, already at max size.");
+    ++s_shareHandleRefCount;
+    return s_shareHandle;
+}
 
-    return false;
+void CurlHandleContainer::ReleaseShareHandle()
+{
+    std::lock_guard<std::mutex> locker(s_shareHandleMutex);
+    if (s_shareHandleRefCount > 0 && --s_shareHandleRefCount == 0)
+    {
+        curl_share_cleanup(s_shareHandle);
+        s_shareHandle = nullptr;
+        AWS_LOG_INFO(CurlTag, "Cleaned up process wide curl share.");
+    }
 }
 
 void CurlHandleContainer::SetDefaultOptionsOnHandle(void* handle)
@@ -236,4 +584,32 @@ void CurlHandleContainer::SetDefaultOptionsOnHandle(void* handle)
     curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
     curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, m_requestTimeout);
     curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT_MS, m_connectTimeout);
+    //resolved addresses and tls sessions are shared with every other handle in the process, so a new connection
+    //to a host any client has already talked to skips the dns lookup and gets an abbreviated handshake.
+    if (m_shareHandle)
+    {
+        curl_easy_setopt(handle, CURLOPT_SHARE, m_shareHandle);
+    }
+}
+
+void CurlHandleContainer::ResetRequestOptions(CURL* handle)
+{
+    //undo only what a single request sets. curl_easy_reset would also drop the options that stay the same for every
+    //request a client makes, which then have to be set again on the next acquire.
+    curl_easy_setopt(handle, CURLOPT_HTTPGET, 1L);
+    curl_easy_setopt(handle, CURLOPT_CUSTOMREQUEST, nullptr);
+    curl_easy_setopt(handle, CURLOPT_HTTPHEADER, nullptr);
+    curl_easy_setopt(handle, CURLOPT_WRITEFUNCTION, nullptr);
+    curl_easy_setopt(handle, CURLOPT_WRITEDATA, nullptr);
+    curl_easy_setopt(handle, CURLOPT_HEADERFUNCTION, nullptr);
+    curl_easy_setopt(handle, CURLOPT_HEADERDATA, nullptr);
+    curl_easy_setopt(handle, CURLOPT_READFUNCTION, nullptr);
+    curl_easy_setopt(handle, CURLOPT_READDATA, nullptr);
+    curl_easy_setopt(handle, CURLOPT_XFERINFOFUNCTION, nullptr);
+    curl_easy_setopt(handle, CURLOPT_XFERINFODATA, nullptr);
+    curl_easy_setopt(handle, CURLOPT_NOPROGRESS, 1L);
+    curl_easy_setopt(handle, CURLOPT_INFILESIZE_LARGE, static_cast<curl_off_t>(-1));
+    curl_easy_setopt(handle, CURLOPT_POSTFIELDSIZE_LARGE, static_cast<curl_off_t>(-1));
+    curl_easy_setopt(handle, CURLOPT_ACCEPT_ENCODING, nullptr);
+    curl_easy_setopt(handle, CURLOPT_HTTP_CONTENT_DECODING, 1L);
 }
@@ -17,11 +17,21 @@
 
 
 #include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/HttpRequestBody.h>
+#include <aws/core/http/StreamingResponseConsumer.h>
 #include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/StringBuilder.h>
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/UnreferencedParam.h>
+#include <aws/core/utils/crypto/CRC32.h>
 #include <aws/core/utils/logging/LogMacros.h>
 #include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+#include <aws/core/utils/stream/ContiguousStreamBuf.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 #include <cassert>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
 #include <algorithm>
 
 
@@ -32,38 +42,9 @@ using namespace Aws::Utils;
 using namespace Aws::Utils::Logging;
 
 
-struct CurlWriteCallbackContext
-{
-    CurlWriteCallbackContext(const CurlHttpClient* client,
-                             HttpRequest* request, 
-                             HttpResponse* response, 
-                             Aws::Utils::RateLimits::RateLimiterInterface* rateLimiter) :
-        m_client(client),
-        m_request(request),
-        m_response(response),
-        m_rateLimiter(rateLimiter)
-    {}
-
-    const CurlHttpClient* m_client;
-    HttpRequest* m_request;
-    HttpResponse* m_response;
-    Aws::Utils::RateLimits::RateLimiterInterface* m_rateLimiter;
-};
-
-struct CurlReadCallbackContext
-{
-    CurlReadCallbackContext(const CurlHttpClient* client, HttpRequest* request) :
-        m_client(client),
-        m_request(request)
-    {}
-
-    const CurlHttpClient* m_client;
-    HttpRequest* m_request;
-};
-
 static const char* CurlTag = "CurlHttpClient";
 
-void SetOptCodeForHttpMethod(CURL* requestHandle, const HttpRequest& request)
+static void SetOptCodeForHttpMethod(CURL* requestHandle, const HttpRequest& request)
 {
     switch (request.GetMethod())
     {
@@ -111,10 +92,12 @@ void SetOptCodeForHttpMethod(CURL* requestHandle, const HttpRequest& request)
 
 CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
     Base(),   
-    m_curlHandleContainer(clientConfig.maxConnections, clientConfig.requestTimeoutMs, clientConfig.connectTimeoutMs),
+    m_curlHandleContainer(clientConfig.maxConnections, clientConfig.requestTimeoutMs, clientConfig.connectTimeoutMs, clientConfig.idleConnectionTimeoutMs),
     m_isUsingProxy(!clientConfig.proxyHost.empty()), m_proxyUserName(clientConfig.proxyUserName),
     m_proxyPassword(clientConfig.proxyPassword), m_proxyHost(clientConfig.proxyHost),
-    m_proxyPort(clientConfig.proxyPort), m_verifySSL(clientConfig.verifySSL), m_caPath(clientConfig.caPath), m_allowRedirects(clientConfig.followRedirects)
+    m_proxyPort(clientConfig.proxyPort), m_verifySSL(clientConfig.verifySSL), m_caPath(clientConfig.caPath), m_allowRedirects(clientConfig.followRedirects),
+    m_enableHttp2(clientConfig.enableHttp2Multiplexing),
+    m_enableResponseCompression(clientConfig.enableResponseCompression && GzipContentDecoder::IsSupported())
 {
 }
 
@@ -122,29 +105,110 @@ CurlHttpClient::CurlHttpClient(const ClientConfiguration& clientConfig) :
 std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
                                                           Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
 {
-    //handle uri encoding at last second. Otherwise, the signer and the http layer will mismatch.
-    URI uri = request.GetUri();
-    uri.SetPath(URI::URLEncodePath(uri.GetPath()));
-    Aws::String url = uri.GetURIString();
-
+    Aws::String url = ComputeRequestUrl(request);
     AWS_LOGSTREAM_TRACE(CurlTag, "Making request to " << url);
-    struct curl_slist* headers = NULL;
 
     if (writeLimiter != nullptr)
     {
         writeLimiter->ApplyAndPayForCost(request.GetSize());
     }
 
-    Aws::StringStream headerStream;
-    HeaderValueCollection requestHeaders = request.GetHeaders();
+    struct curl_slist* headers = BuildHeaderList(request);
+
+    std::shared_ptr<HttpResponse> response(nullptr);
+    Aws::String endpoint = ComputeEndpointKey(request.GetUri());
+    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle(endpoint);
+
+    if (connectionHandle)
+    {
+        AWS_LOGSTREAM_DEBUG(CurlTag, "Obtained connection handle " << connectionHandle);
+
+        response = Aws::MakeShared<StandardHttpResponse>(CurlTag, request);
+        CurlWriteCallbackContext writeContext(this, &request, response.get(), readLimiter);
+        CurlReadCallbackContext readContext(this, &request);
+
+        SetRequestOptionsOnHandle(connectionHandle, request, url, headers, writeContext, readContext);
+
+        //a transfer paused by a StreamingResponseConsumer stays on this handle and its pooled connection; OnTransferProgress unpauses it.
+        CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
+        if (curlResponseCode != CURLE_OK)
+        {
+            response = nullptr;
+            AWS_LOGSTREAM_ERROR(CurlTag, "Curl returned error code " << curlResponseCode);
+        }
+        else
+        {
+            ReadResponseInfoFromHandle(connectionHandle, *response);
+            VerifyResponseChecksum(writeContext);
+            AWS_LOGSTREAM_DEBUG(CurlTag, "Releasing curl handle " << connectionHandle);
+        }
+
+        m_curlHandleContainer.ReleaseCurlHandle(connectionHandle, endpoint);
+        //go ahead and flush the response body stream
+        if(response)
+        {
+            response->GetResponseBody().flush();
+        }
+    }
+
+    if (headers)
+    {
+        curl_slist_free_all(headers);
+    }
+
+    return response;
+}
+
+static size_t DiscardData(char* ptr, size_t size, size_t nmemb, void* userdata)
+{
+    AWS_UNREFERENCED_PARAM(ptr);
+    AWS_UNREFERENCED_PARAM(userdata);
+    return size * nmemb;
+}
+
+unsigned CurlHttpClient::Prewarm(const URI& endpoint, unsigned count) const
+{
+    Aws::String endpointKey = ComputeEndpointKey(endpoint);
+    Aws::String url = endpointKey + "/";
+
+    //a HEAD to the root is enough to finish the tcp and tls handshakes, whatever status code comes back.
+    return m_curlHandleContainer.Prewarm(endpointKey, count, [this, &url](CURL* connectionHandle)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
+        curl_easy_setopt(connectionHandle, CURLOPT_NOBODY, 1L);
+        curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, &DiscardData);
+        curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, &DiscardData);
+        SetConnectionOptionsOnHandle(connectionHandle);
+    });
+}
+
+Aws::String CurlHttpClient::ComputeEndpointKey(const URI& uri)
+{
+    StringBuilder<> endpointKey;
+    endpointKey.Append(SchemeMapper::ToString(uri.GetScheme())).Append("://", 3).Append(uri.GetAuthority())
+        .Append(':').AppendDecimal(static_cast<unsigned long long>(uri.GetPort()));
+    return endpointKey.ToString();
+}
+
+Aws::String CurlHttpClient::ComputeRequestUrl(const HttpRequest& request)
+{
+    //handle uri encoding at last second. Otherwise, the signer and the http layer will mismatch.
+    URI uri = request.GetUri();
+    uri.SetPath(URI::URLEncodePath(uri.GetPath()));
+    return uri.GetURIString();
+}
+
+struct curl_slist* CurlHttpClient::BuildHeaderList(const HttpRequest& request)
+{
+    struct curl_slist* headers = NULL;
 
+    StringBuilder<> headerString;
     AWS_LOG_TRACE(CurlTag, "Including headers:");
-    for (auto& requestHeader : requestHeaders)
+    for (const auto& requestHeader : request.GetHeaderCollection())
     {
-        headerStream.str("");
-        headerStream << requestHeader.first << ": " << requestHeader.second;
-        Aws::String headerString = headerStream.str();
-        AWS_LOGSTREAM_TRACE(CurlTag, headerString);
+        headerString.Clear();
+        headerString.Append(requestHeader.first).Append(": ", 2).Append(requestHeader.second);
+        AWS_LOGSTREAM_TRACE(CurlTag, headerString.c_str());
         headers = curl_slist_append(headers, headerString.c_str());
     }
     headers = curl_slist_append(headers, "transfer-encoding:");
@@ -159,122 +223,153 @@ std::shared_ptr<HttpResponse> CurlHttpClient::MakeRequest(HttpRequest& request,
         headers = curl_slist_append(headers, "content-type:");
     }
 
-    std::shared_ptr<HttpResponse> response(nullptr);
-    CURL* connectionHandle = m_curlHandleContainer.AcquireCurlHandle();
+    return headers;
+}
 
-    if (connectionHandle)
+void CurlHttpClient::SetRequestOptionsOnHandle(CURL* connectionHandle, HttpRequest& request, const Aws::String& url, struct curl_slist* headers,
+                                               CurlWriteCallbackContext& writeContext, CurlReadCallbackContext& readContext) const
+{
+    if (headers)
     {
-        AWS_LOGSTREAM_DEBUG(CurlTag, "Obtained connection handle " << connectionHandle);
+        curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
+    }
 
-        if (headers)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_HTTPHEADER, headers);
-        }
+    SetOptCodeForHttpMethod(connectionHandle, request);
 
-        response = Aws::MakeShared<StandardHttpResponse>(CurlTag, request);
-        CurlWriteCallbackContext writeContext(this, &request, response.get(), readLimiter);
-        CurlReadCallbackContext readContext(this, &request);
+    curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, &CurlHttpClient::WriteData);
+    curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, &CurlHttpClient::WriteHeader);
+    curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, &writeContext);
+    writeContext.m_curlHandle = connectionHandle;
 
-        SetOptCodeForHttpMethod(connectionHandle, request);
+#if LIBCURL_VERSION_NUM >= 0x071506
+    if (m_enableResponseCompression && !request.HasHeader(ACCEPT_ENCODING_HEADER))
+    {
+        //curl only advertises the encodings; it hands the body over as is and WriteData inflates it, so anything that
+        //checks the body against a header (x-amz-crc32) can still see the bytes that were actually sent.
+        curl_easy_setopt(connectionHandle, CURLOPT_ACCEPT_ENCODING, "gzip, deflate");
+        curl_easy_setopt(connectionHandle, CURLOPT_HTTP_CONTENT_DECODING, 0L);
+        writeContext.m_decodeResponse = true;
+    }
+#endif //LIBCURL_VERSION_NUM
 
-        curl_easy_setopt(connectionHandle, CURLOPT_URL, url.c_str());
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEFUNCTION, &CurlHttpClient::WriteData);
-        curl_easy_setopt(connectionHandle, CURLOPT_WRITEDATA, &writeContext);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERFUNCTION, &CurlHttpClient::WriteHeader);
-        curl_easy_setopt(connectionHandle, CURLOPT_HEADERDATA, response.get());
+#if LIBCURL_VERSION_NUM >= 0x072000
+    if (request.GetStreamingResponseConsumer())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_XFERINFOFUNCTION, &CurlHttpClient::OnTransferProgress);
+        curl_easy_setopt(connectionHandle, CURLOPT_XFERINFODATA, &writeContext);
+        curl_easy_setopt(connectionHandle, CURLOPT_NOPROGRESS, 0L);
+    }
+#endif //LIBCURL_VERSION_NUM
+
+    SetConnectionOptionsOnHandle(connectionHandle);
+
+    const std::shared_ptr<HttpRequestBody>& body = request.GetRequestBody();
+    if (body)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, &CurlHttpClient::ReadBody);
+        curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
 
-        //we only want to override the default path if someone has explicitly told us to.
-        if(!m_caPath.empty())
+        //tell curl exactly how much is coming so it never has to work it out from the read callback.
+        curl_off_t bodyLength = static_cast<curl_off_t>(body->GetLength());
+        if (bodyLength >= 0 && request.HasHeader(Aws::Http::CONTENT_LENGTH_HEADER))
         {
-            curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, m_caPath.c_str());
+            if (request.GetMethod() == HttpMethod::HTTP_PUT)
+            {
+                curl_easy_setopt(connectionHandle, CURLOPT_INFILESIZE_LARGE, bodyLength);
+            }
+            else if (request.GetMethod() == HttpMethod::HTTP_POST)
+            {
+                curl_easy_setopt(connectionHandle, CURLOPT_POSTFIELDSIZE_LARGE, bodyLength);
+            }
         }
+    }
+}
+
+void CurlHttpClient::SetConnectionOptionsOnHandle(CURL* connectionHandle) const
+{
+    //we only want to override the default path if someone has explicitly told us to.
+    if(!m_caPath.empty())
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, m_caPath.c_str());
+    }
 
-	// only set by android test builds because the emulator is missing a cert needed for aws services
+// only set by android test builds because the emulator is missing a cert needed for aws services
 #ifdef TEST_CERT_PATH
-	curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
+    curl_easy_setopt(connectionHandle, CURLOPT_CAPATH, TEST_CERT_PATH);
 #endif // TEST_CERT_PATH
 
-        if (m_verifySSL)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
+    if (m_verifySSL)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 1L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 2L);
 
 #if LIBCURL_VERSION_MAJOR >= 7
 #if LIBCURL_VERSION_MINOR >= 34
-            curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSLVERSION, CURL_SSLVERSION_TLSv1);
 #endif //LIBCURL_VERSION_MINOR
 #endif //LIBCURL_VERSION_MAJOR
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
-            curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
-        }
-
-        if (m_allowRedirects)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
-        }
-        else
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
-        }
-        //curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
-
-        if (m_isUsingProxy)
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXY, m_proxyHost.c_str());
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
-            curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
-        }
-
-        if (request.GetContentBody())
-        {
-            curl_easy_setopt(connectionHandle, CURLOPT_READFUNCTION, &CurlHttpClient::ReadBody);
-            curl_easy_setopt(connectionHandle, CURLOPT_READDATA, &readContext);
-        }
-
-        CURLcode curlResponseCode = curl_easy_perform(connectionHandle);
-        if (curlResponseCode != CURLE_OK)
-        {
-            response = nullptr;
-            AWS_LOGSTREAM_ERROR(CurlTag, "Curl returned error code " << curlResponseCode);
-        }
-        else
-        {
-            long responseCode;
-            curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
-            response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
-            AWS_LOGSTREAM_DEBUG(CurlTag, "Returned http response code " << responseCode);
-
-            char* contentType = nullptr;
-            curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
-            if (contentType)
-            {
-                response->SetContentType(contentType);
-                AWS_LOGSTREAM_DEBUG(CurlTag, "Returned content type " << contentType);
-            }
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYPEER, 0L);
+        curl_easy_setopt(connectionHandle, CURLOPT_SSL_VERIFYHOST, 0L);
+    }
 
-            AWS_LOGSTREAM_DEBUG(CurlTag, "Releasing curl handle " << connectionHandle);
-        }
+    if (m_allowRedirects)
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 1L);
+    }
+    else
+    {
+        curl_easy_setopt(connectionHandle, CURLOPT_FOLLOWLOCATION, 0L);
+    }
+    //curl_easy_setopt(connectionHandle, CURLOPT_VERBOSE, 1);
 
-        m_curlHandleContainer.ReleaseCurlHandle(connectionHandle);
-        //go ahead and flush the response body stream
-        if(response)
-        {
-            response->GetResponseBody().flush();
-        }
+#if LIBCURL_VERSION_NUM >= 0x072f00
+    if (m_enableHttp2)
+    {
+        //h2 is only negotiated over tls, plain http requests stay on http/1.1.
+        curl_easy_setopt(connectionHandle, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+        //prefer waiting for a stream on an existing connection over opening a new one.
+        curl_easy_setopt(connectionHandle, CURLOPT_PIPEWAIT, 1L);
     }
+#endif //LIBCURL_VERSION_NUM
 
-    if (headers)
+    if (m_isUsingProxy)
     {
-        curl_slist_free_all(headers);
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXY, m_proxyHost.c_str());
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYPORT, (long) m_proxyPort);
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYUSERNAME, m_proxyUserName.c_str());
+        curl_easy_setopt(connectionHandle, CURLOPT_PROXYPASSWORD, m_proxyPassword.c_str());
     }
+}
 
-    return response;
+void CurlHttpClient::ReadResponseInfoFromHandle(CURL* connectionHandle, HttpResponse& response)
+{
+    long responseCode;
+    curl_easy_getinfo(connectionHandle, CURLINFO_RESPONSE_CODE, &responseCode);
+    response.SetResponseCode(static_cast<HttpResponseCode>(responseCode));
+    AWS_LOGSTREAM_DEBUG(CurlTag, "Returned http response code " << responseCode);
+
+    char* contentType = nullptr;
+    curl_easy_getinfo(connectionHandle, CURLINFO_CONTENT_TYPE, &contentType);
+    if (contentType)
+    {
+        response.SetContentType(contentType);
+        AWS_LOGSTREAM_DEBUG(CurlTag, "Returned content type " << contentType);
+    }
 }
 
+void CurlHttpClient::VerifyResponseChecksum(const CurlWriteCallbackContext& context)
+{
+    if (context.m_verifyCrc32 && context.m_crc32 != context.m_expectedCrc32)
+    {
+        AWS_LOGSTREAM_WARN(CurlTag, "Response body has crc32 " << context.m_crc32 << " but " << X_AMZ_CRC32_HEADER << " says " << context.m_expectedCrc32);
+        context.m_response->SetChecksumMismatch(true);
+    }
+}
 
 size_t CurlHttpClient::WriteData(char* ptr, size_t size, size_t nmemb, void* userdata)
 {
@@ -282,7 +377,7 @@ size_t CurlHttpClient::WriteData(char* ptr, size_t size, size_t nmemb, void* use
     {
         CurlWriteCallbackContext* context = reinterpret_cast<CurlWriteCallbackContext*>(userdata);
 
-        const CurlHttpClient* client = context->m_client;
+        const HttpClient* client = context->m_client;
         if(!client->IsRequestProcessingEnabled())
         {
             return 0;
@@ -290,12 +385,75 @@ size_t CurlHttpClient::WriteData(char* ptr, size_t size, size_t nmemb, void* use
 
         HttpResponse* response = context->m_response;
         size_t sizeToWrite = size * nmemb;
+
+        //data curl hands back after a pause was already checksummed and inflated the first time round. curl may replay it
+        //over several calls, so only the part replayed here is struck off.
+        size_t alreadyProcessed = context->m_processedChunkSize < sizeToWrite ? context->m_processedChunkSize : sizeToWrite;
+        context->m_processedChunkSize -= alreadyProcessed;
+        if (context->m_verifyCrc32)
+        {
+            //x-amz-crc32 covers the bytes as sent, so this runs before any inflating.
+            context->m_crc32 = Crypto::CRC32::Extend(context->m_crc32, reinterpret_cast<const unsigned char*>(ptr) + alreadyProcessed,
+                sizeToWrite - alreadyProcessed);
+        }
+
+        const char* body = ptr;
+        size_t bodyLength = sizeToWrite;
+        if (context->m_decoder)
+        {
+            if (!context->m_decoder->Decode(ptr + alreadyProcessed, sizeToWrite - alreadyProcessed, context->m_decoded))
+            {
+                AWS_LOG_ERROR(CurlTag, "Failed to inflate compressed response body.");
+                return 0;
+            }
+            body = context->m_decoded.data();
+            bodyLength = context->m_decoded.size();
+        }
+
+        //error bodies still go to the response stream, the client needs them to build the AWSError.
+        const std::shared_ptr<StreamingResponseConsumer>& consumer = context->m_request->GetStreamingResponseConsumer();
+        int responseCode = static_cast<int>(response->GetResponseCode());
+        bool pushToConsumer = consumer && responseCode >= 200 && responseCode < 300;
+        if (pushToConsumer)
+        {
+            if (!context->m_bodyStarted)
+            {
+                context->m_bodyStarted = true;
+                consumer->OnBodyStarted(*response);
+            }
+
+            while (bodyLength > 0 && consumer->Deliver(*response, body, bodyLength) == StreamingConsumerAction::PAUSE)
+            {
+#if LIBCURL_VERSION_NUM >= 0x072000
+                //curl keeps the chunk and hands it back to us once OnTransferProgress or the event loop unpauses the handle.
+                context->m_paused = true;
+                //curl now holds this call's data in front of whatever processed data it had not replayed yet.
+                context->m_processedChunkSize += sizeToWrite;
+                return CURL_WRITEFUNC_PAUSE;
+#else
+                //no progress callback to unpause from, so hold the socket by not returning until the consumer resumes.
+                while (!consumer->WaitForResume(std::chrono::milliseconds(100)))
+                {
+                    if (!client->IsRequestProcessingEnabled())
+                    {
+                        return 0;
+                    }
+                }
+#endif //LIBCURL_VERSION_NUM
+            }
+        }
+
         if (context->m_rateLimiter)
         {
             context->m_rateLimiter->ApplyAndPayForCost(static_cast<int64_t>(sizeToWrite));
         }
 
-        response->GetResponseBody().write(ptr, static_cast<std::streamsize>(sizeToWrite));
+        if (!pushToConsumer)
+        {
+            response->GetResponseBody().write(body, static_cast<std::streamsize>(bodyLength));
+        }
+        context->m_decoded.clear();
+
         auto& receivedHandler = context->m_request->GetDataReceivedEventHandler();
         if (receivedHandler)
         {
@@ -308,29 +466,132 @@ size_t CurlHttpClient::WriteData(char* ptr, size_t size, size_t nmemb, void* use
     return 0;
 }
 
+void CurlHttpClient::ResumeIfConsumerResumed(CurlWriteCallbackContext& context)
+{
+    const std::shared_ptr<StreamingResponseConsumer>& consumer = context.m_request->GetStreamingResponseConsumer();
+    if (context.m_paused && consumer && !consumer->IsPaused())
+    {
+        context.m_paused = false;
+        curl_easy_pause(context.m_curlHandle, CURLPAUSE_CONT);
+    }
+}
+
+#if LIBCURL_VERSION_NUM >= 0x072000
+int CurlHttpClient::OnTransferProgress(void* userdata, curl_off_t downloadTotal, curl_off_t downloaded, curl_off_t uploadTotal, curl_off_t uploaded)
+{
+    AWS_UNREFERENCED_PARAM(downloadTotal);
+    AWS_UNREFERENCED_PARAM(downloaded);
+    AWS_UNREFERENCED_PARAM(uploadTotal);
+    AWS_UNREFERENCED_PARAM(uploaded);
+
+    CurlWriteCallbackContext* context = reinterpret_cast<CurlWriteCallbackContext*>(userdata);
+    if (!context->m_client->IsRequestProcessingEnabled())
+    {
+        //a paused transfer never reaches WriteData again, so this is where it gets cancelled.
+        return 1;
+    }
+
+    ResumeIfConsumerResumed(*context);
+    return 0;
+}
+#endif //LIBCURL_VERSION_NUM
+
+//a Content-Length beyond this is still honoured, the body buffer just grows into it instead of being reserved up front.
+static const long long MAX_RESPONSE_BODY_RESERVATION = 64 * 1024 * 1024;
+
+static void ReserveResponseBody(HttpResponse* response, const Aws::String& contentLength)
+{
+    if (response->GetOriginatingRequest().GetMethod() == HttpMethod::HTTP_HEAD)
+    {
+        return;
+    }
+
+    Stream::ContiguousStreamBuf* body = Stream::DefaultUnderlyingStream::GetContiguousStreamBuf(response->GetResponseBody());
+    long long length = StringUtils::ConvertToInt64(contentLength.c_str());
+    if (body && length > 0)
+    {
+        body->Reserve(static_cast<size_t>(length < MAX_RESPONSE_BODY_RESERVATION ? length : MAX_RESPONSE_BODY_RESERVATION));
+    }
+}
+
+//trims [begin, end) of a header line in place by moving the bounds.
+static void TrimHeaderField(const char* line, size_t& begin, size_t& end)
+{
+    while (begin < end && ::isspace(static_cast<unsigned char>(line[begin])))
+    {
+        ++begin;
+    }
+    while (end > begin && ::isspace(static_cast<unsigned char>(line[end - 1])))
+    {
+        --end;
+    }
+}
+
 size_t CurlHttpClient::WriteHeader(char* ptr, size_t size, size_t nmemb, void* userdata)
 {
     if (ptr)
     {
         AWS_LOGSTREAM_TRACE(CurlTag, ptr);
-        HttpResponse* response = (HttpResponse*) userdata;
-        Aws::String headerLine(ptr);
-        Aws::Vector<Aws::String> keyValuePair = StringUtils::Split(headerLine, ':');
-
+        CurlWriteCallbackContext* context = reinterpret_cast<CurlWriteCallbackContext*>(userdata);
+        HttpResponse* response = context->m_response;
+        const size_t lineLength = size * nmemb;
 
-        if (keyValuePair.size() > 1)
+        //the status line comes first, so the response code is already known by the time the body is written.
+        if (lineLength >= 5 && strncmp(ptr, "HTTP/", 5) == 0)
         {
-            Aws::String headerName = keyValuePair[0];
-            headerName = StringUtils::Trim(headerName.c_str());
-
-
-            Aws::String headerValue = headerLine.substr(headerName.length() + 1).c_str();
-            headerValue = StringUtils::Trim(headerValue.c_str());
+            const char* codeStart = static_cast<const char*>(memchr(ptr, ' ', lineLength));
+            if (codeStart)
+            {
+                int responseCode = 0;
+                for (++codeStart; codeStart < ptr + lineLength && *codeStart >= '0' && *codeStart <= '9'; ++codeStart)
+                {
+                    responseCode = responseCode * 10 + (*codeStart - '0');
+                }
+                response->SetResponseCode(static_cast<HttpResponseCode>(responseCode));
+            }
+            //headers of an interim or redirect response don't describe the body that follows.
+            context->m_decoder.reset();
+            context->m_verifyCrc32 = false;
+            context->m_crc32 = 0;
+            return lineLength;
+        }
 
+        //split on the first colon only, values (dates, urls) can contain more of them.
+        const char* colon = static_cast<const char*>(memchr(ptr, ':', lineLength));
+        if (colon && colon > ptr && static_cast<size_t>(colon - ptr) + 1 < lineLength)
+        {
+            size_t nameBegin = 0, nameEnd = static_cast<size_t>(colon - ptr);
+            size_t valueBegin = nameEnd + 1, valueEnd = lineLength;
+            TrimHeaderField(ptr, nameBegin, nameEnd);
+            TrimHeaderField(ptr, valueBegin, valueEnd);
+            if (nameBegin == nameEnd)
+            {
+                return lineLength;
+            }
 
+            Aws::String headerName(ptr + nameBegin, nameEnd - nameBegin);
+            Aws::String headerValue(ptr + valueBegin, valueEnd - valueBegin);
             response->AddHeader(headerName, headerValue);
+
+            //size the body sink once, now, instead of letting it double its way up through WriteData.
+            if (StringUtils::CaselessCompare(headerName.c_str(), CONTENT_LENGTH_HEADER))
+            {
+                ReserveResponseBody(response, headerValue);
+            }
+            else if (context->m_decodeResponse && StringUtils::CaselessCompare(headerName.c_str(), CONTENT_ENCODING_HEADER) &&
+                     GzipContentDecoder::CanDecode(headerValue))
+            {
+                context->m_decoder = Aws::MakeUnique<GzipContentDecoder>(CurlTag);
+            }
+            else if (StringUtils::CaselessCompare(headerName.c_str(), X_AMZ_CRC32_HEADER))
+            {
+                char* end = nullptr;
+                unsigned long long expected = strtoull(headerValue.c_str(), &end, 10);
+                context->m_verifyCrc32 = !headerValue.empty() && end && *end == '\0' && expected <= 0xFFFFFFFFULL;
+                context->m_expectedCrc32 = static_cast<uint32_t>(expected);
+            }
         }
-        return size * nmemb;
+        return lineLength;
     }
     return 0;
 }
@@ -344,24 +605,18 @@ size_t CurlHttpClient::ReadBody(char* ptr, size_t size, size_t nmemb, void* user
 	    return 0;
     }
 
-    const CurlHttpClient* client = context->m_client;
+    const HttpClient* client = context->m_client;
     if(!client->IsRequestProcessingEnabled())
     {
         return 0;
     }
 
     HttpRequest* request = context->m_request;
-    std::shared_ptr<Aws::IOStream> ioStream = request->GetContentBody();
+    const std::shared_ptr<HttpRequestBody>& body = request->GetRequestBody();
 
-    if (ioStream != nullptr && size * nmemb)
+    if (body != nullptr && size * nmemb)
     {
-        auto currentPos = ioStream->tellg();
-        ioStream->seekg(0, ioStream->end);
-        auto length = ioStream->tellg();
-        ioStream->seekg(currentPos, ioStream->beg);
-        size_t amountToRead = static_cast< size_t >(std::min<decltype(length)>(length - currentPos, size * nmemb));
-
-        ioStream->read(ptr, amountToRead);
+        size_t amountToRead = body->Read(ptr, size * nmemb);
         auto& sentHandler = request->GetDataSentEventHandler();
         if (sentHandler)
         {
@@ -0,0 +1,702 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+//socket event handling below is POSIX only, the factory never selects this client on windows.
+#ifndef _WIN32
+
+#include <aws/core/http/curl/CurlMultiHttpClient.h>
+
+#include <aws/core/http/HttpRequest.h>
+#include <aws/core/http/StreamingResponseConsumer.h>
+#include <aws/core/http/standard/StandardHttpResponse.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/ratelimiter/RateLimiterInterface.h>
+#include <aws/core/utils/memory/stl/AWSQueue.h>
+#include <aws/core/utils/memory/stl/AWSSet.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+
+#include <chrono>
+#include <future>
+#include <mutex>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#else
+#include <poll.h>
+#include <fcntl.h>
+#endif
+#include <unistd.h>
+
+using namespace Aws::Client;
+using namespace Aws::Http;
+using namespace Aws::Http::Standard;
+using namespace Aws::Utils;
+using namespace Aws::Utils::Logging;
+
+static const char* CurlMultiTag = "CurlMultiHttpClient";
+
+namespace Aws
+{
+namespace Http
+{
+
+/**
+ * Everything that has to stay alive while a single request is owned by an event loop.
+ */
+struct CurlMultiTransfer
+{
+    CurlMultiTransfer(const CurlMultiHttpClient* client, HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter) :
+        m_request(request),
+        m_response(Aws::MakeShared<StandardHttpResponse>(CurlMultiTag, request)),
+        m_headers(nullptr),
+        m_handle(nullptr),
+        m_writeContext(client, &request, m_response.get(), readLimiter),
+        m_readContext(client, &request)
+    {}
+
+    ~CurlMultiTransfer()
+    {
+        if (m_headers)
+        {
+            curl_slist_free_all(m_headers);
+        }
+    }
+
+    HttpRequest& m_request;
+    //only set for requests submitted through MakeRequestAsync, keeps the request alive until completion.
+    std::shared_ptr<HttpRequest> m_ownedRequest;
+    std::shared_ptr<HttpResponse> m_response;
+    Aws::String m_url;
+    struct curl_slist* m_headers;
+    CURL* m_handle;
+    CurlWriteCallbackContext m_writeContext;
+    CurlReadCallbackContext m_readContext;
+    HttpRequestCompletedHandler m_onCompleted;
+};
+
+/**
+ * One curl multi handle driven by one I/O thread. Sockets are watched with epoll on linux/android and poll elsewhere.
+ * Except for Submit and Wakeup, everything here runs on the loop's own thread.
+ */
+class CurlMultiHttpClient::EventLoop
+{
+public:
+    //maxStreams is the number of transfers this loop runs at once. Without multiplexing every stream needs its own connection.
+    EventLoop(const CurlMultiHttpClient* client, long maxStreams, bool multiplex, long maxStreamsPerConnection);
+    ~EventLoop();
+
+    void Submit(CurlMultiTransfer* transfer);
+
+private:
+    void Run();
+    void Wakeup();
+    void DrainWakeup();
+    void AddPendingTransfers();
+    void ResumeTransfers();
+    void ProcessCompletedTransfers();
+    void CompleteTransfer(CurlMultiTransfer* transfer, bool succeeded);
+    void FailOutstandingTransfers();
+    void WaitForEvents();
+    int ComputeWaitTimeout() const;
+    CURL* AcquireHandle();
+    void ReleaseHandle(CURL* handle);
+
+    static int SocketCallback(CURL* easy, curl_socket_t socket, int what, void* userp, void* socketp);
+    static int TimerCallback(CURLM* multi, long timeoutMs, void* userp);
+
+    const CurlMultiHttpClient* m_client;
+    CURLM* m_multiHandle;
+#ifdef __linux__
+    int m_epollFd;
+    int m_wakeupFd;
+#else
+    int m_wakeupPipe[2];
+    Aws::Map<curl_socket_t, short> m_watchedSockets;
+#endif
+    std::mutex m_pendingMutex;
+    Aws::Queue<CurlMultiTransfer*> m_pendingTransfers;
+    Aws::Set<CurlMultiTransfer*> m_activeTransfers;
+    Aws::Vector<CURL*> m_idleHandles;
+    size_t m_maxIdleHandles;
+    CURLSH* m_shareHandle;
+    std::atomic<bool> m_running;
+    //set by StreamingResponseConsumer::Resume from any thread, the unpause itself has to happen on the loop's thread.
+    std::atomic<bool> m_resumeRequested;
+    bool m_timerArmed;
+    std::chrono::steady_clock::time_point m_timerDeadline;
+    std::thread m_thread;
+};
+
+} // namespace Http
+} // namespace Aws
+
+CurlMultiHttpClient::EventLoop::EventLoop(const CurlMultiHttpClient* client, long maxStreams, bool multiplex, long maxStreamsPerConnection) :
+    m_client(client),
+    m_multiHandle(curl_multi_init()),
+    m_maxIdleHandles(static_cast<size_t>(maxStreams)),
+    m_shareHandle(CurlHandleContainer::AcquireShareHandle()),
+    m_running(true),
+    m_resumeRequested(false),
+    m_timerArmed(false)
+{
+#ifdef __linux__
+    m_epollFd = epoll_create1(EPOLL_CLOEXEC);
+    m_wakeupFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+
+    struct epoll_event wakeupEvent;
+    wakeupEvent.events = EPOLLIN;
+    wakeupEvent.data.fd = m_wakeupFd;
+    epoll_ctl(m_epollFd, EPOLL_CTL_ADD, m_wakeupFd, &wakeupEvent);
+#else
+    if (pipe(m_wakeupPipe) == 0)
+    {
+        fcntl(m_wakeupPipe[0], F_SETFL, O_NONBLOCK);
+        fcntl(m_wakeupPipe[1], F_SETFL, O_NONBLOCK);
+    }
+#endif
+
+    curl_multi_setopt(m_multiHandle, CURLMOPT_SOCKETFUNCTION, &EventLoop::SocketCallback);
+    curl_multi_setopt(m_multiHandle, CURLMOPT_SOCKETDATA, this);
+    curl_multi_setopt(m_multiHandle, CURLMOPT_TIMERFUNCTION, &EventLoop::TimerCallback);
+    curl_multi_setopt(m_multiHandle, CURLMOPT_TIMERDATA, this);
+
+    long maxConnections = maxStreams;
+#if LIBCURL_VERSION_NUM >= 0x072b00
+    if (multiplex)
+    {
+        //with multiplexing the budget is counted in streams, so we only need enough sockets to carry them.
+        curl_multi_setopt(m_multiHandle, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+        maxConnections = (maxStreams + maxStreamsPerConnection - 1) / maxStreamsPerConnection;
+#if LIBCURL_VERSION_NUM >= 0x074300
+        curl_multi_setopt(m_multiHandle, CURLMOPT_MAX_CONCURRENT_STREAMS, maxStreamsPerConnection);
+#endif
+    }
+#else
+    AWS_UNREFERENCED_PARAM(multiplex);
+    AWS_UNREFERENCED_PARAM(maxStreamsPerConnection);
+#endif
+
+#if LIBCURL_VERSION_NUM >= 0x071e00
+    curl_multi_setopt(m_multiHandle, CURLMOPT_MAX_TOTAL_CONNECTIONS, maxConnections);
+#else
+    AWS_UNREFERENCED_PARAM(maxConnections);
+#endif
+
+    m_thread = std::thread(&EventLoop::Run, this);
+}
+
+CurlMultiHttpClient::EventLoop::~EventLoop()
+{
+    m_running = false;
+    Wakeup();
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+
+    for (CURL* handle : m_idleHandles)
+    {
+        curl_easy_cleanup(handle);
+    }
+
+    curl_multi_cleanup(m_multiHandle);
+    CurlHandleContainer::ReleaseShareHandle();
+#ifdef __linux__
+    close(m_wakeupFd);
+    close(m_epollFd);
+#else
+    close(m_wakeupPipe[0]);
+    close(m_wakeupPipe[1]);
+#endif
+}
+
+void CurlMultiHttpClient::EventLoop::Submit(CurlMultiTransfer* transfer)
+{
+    {
+        std::lock_guard<std::mutex> locker(m_pendingMutex);
+        m_pendingTransfers.push(transfer);
+    }
+    Wakeup();
+}
+
+void CurlMultiHttpClient::EventLoop::Wakeup()
+{
+#ifdef __linux__
+    uint64_t one = 1;
+    ssize_t written = write(m_wakeupFd, &one, sizeof(one));
+#else
+    char one = 1;
+    ssize_t written = write(m_wakeupPipe[1], &one, sizeof(one));
+#endif
+    //a full wakeup channel already guarantees the loop will wake up.
+    AWS_UNREFERENCED_PARAM(written);
+}
+
+void CurlMultiHttpClient::EventLoop::DrainWakeup()
+{
+#ifdef __linux__
+    uint64_t count = 0;
+    while (read(m_wakeupFd, &count, sizeof(count)) > 0) {}
+#else
+    char buffer[64];
+    while (read(m_wakeupPipe[0], buffer, sizeof(buffer)) > 0) {}
+#endif
+}
+
+void CurlMultiHttpClient::EventLoop::Run()
+{
+    AWS_LOG_DEBUG(CurlMultiTag, "Event loop started.");
+    while (m_running)
+    {
+        AddPendingTransfers();
+        WaitForEvents();
+        ResumeTransfers();
+
+        if (m_timerArmed && std::chrono::steady_clock::now() >= m_timerDeadline)
+        {
+            m_timerArmed = false;
+            int runningHandles = 0;
+            curl_multi_socket_action(m_multiHandle, CURL_SOCKET_TIMEOUT, 0, &runningHandles);
+        }
+
+        ProcessCompletedTransfers();
+    }
+
+    FailOutstandingTransfers();
+    AWS_LOG_DEBUG(CurlMultiTag, "Event loop stopped.");
+}
+
+#ifdef __linux__
+
+void CurlMultiHttpClient::EventLoop::WaitForEvents()
+{
+    static const int MAX_EVENTS = 64;
+    struct epoll_event events[MAX_EVENTS];
+
+    int eventCount = epoll_wait(m_epollFd, events, MAX_EVENTS, ComputeWaitTimeout());
+    for (int i = 0; i < eventCount; ++i)
+    {
+        if (events[i].data.fd == m_wakeupFd)
+        {
+            DrainWakeup();
+            continue;
+        }
+
+        int action = 0;
+        action |= (events[i].events & EPOLLIN) ? CURL_CSELECT_IN : 0;
+        action |= (events[i].events & EPOLLOUT) ? CURL_CSELECT_OUT : 0;
+        action |= (events[i].events & (EPOLLERR | EPOLLHUP)) ? CURL_CSELECT_ERR : 0;
+
+        int runningHandles = 0;
+        curl_multi_socket_action(m_multiHandle, events[i].data.fd, action, &runningHandles);
+    }
+}
+
+int CurlMultiHttpClient::EventLoop::SocketCallback(CURL* easy, curl_socket_t socket, int what, void* userp, void* socketp)
+{
+    AWS_UNREFERENCED_PARAM(easy);
+    EventLoop* loop = static_cast<EventLoop*>(userp);
+
+    if (what == CURL_POLL_REMOVE)
+    {
+        epoll_ctl(loop->m_epollFd, EPOLL_CTL_DEL, socket, nullptr);
+        return 0;
+    }
+
+    struct epoll_event socketEvent;
+    socketEvent.events = 0;
+    socketEvent.events |= (what & CURL_POLL_IN) ? static_cast<uint32_t>(EPOLLIN) : 0u;
+    socketEvent.events |= (what & CURL_POLL_OUT) ? static_cast<uint32_t>(EPOLLOUT) : 0u;
+    socketEvent.data.fd = socket;
+
+    if (socketp)
+    {
+        epoll_ctl(loop->m_epollFd, EPOLL_CTL_MOD, socket, &socketEvent);
+    }
+    else
+    {
+        epoll_ctl(loop->m_epollFd, EPOLL_CTL_ADD, socket, &socketEvent);
+        //any non null value marks the socket as already registered.
+        curl_multi_assign(loop->m_multiHandle, socket, loop);
+    }
+
+    return 0;
+}
+
+#else
+
+void CurlMultiHttpClient::EventLoop::WaitForEvents()
+{
+    Aws::Vector<struct pollfd> pollFds;
+    pollFds.reserve(m_watchedSockets.size() + 1);
+
+    struct pollfd wakeupPollFd;
+    wakeupPollFd.fd = m_wakeupPipe[0];
+    wakeupPollFd.events = POLLIN;
+    wakeupPollFd.revents = 0;
+    pollFds.push_back(wakeupPollFd);
+
+    for (const auto& watchedSocket : m_watchedSockets)
+    {
+        struct pollfd socketPollFd;
+        socketPollFd.fd = watchedSocket.first;
+        socketPollFd.events = watchedSocket.second;
+        socketPollFd.revents = 0;
+        pollFds.push_back(socketPollFd);
+    }
+
+    if (poll(pollFds.data(), static_cast<nfds_t>(pollFds.size()), ComputeWaitTimeout()) <= 0)
+    {
+        return;
+    }
+
+    if (pollFds[0].revents)
+    {
+        DrainWakeup();
+    }
+
+    for (size_t i = 1; i < pollFds.size(); ++i)
+    {
+        if (!pollFds[i].revents)
+        {
+            continue;
+        }
+
+        int action = 0;
+        action |= (pollFds[i].revents & POLLIN) ? CURL_CSELECT_IN : 0;
+        action |= (pollFds[i].revents & POLLOUT) ? CURL_CSELECT_OUT : 0;
+        action |= (pollFds[i].revents & (POLLERR | POLLHUP)) ? CURL_CSELECT_ERR : 0;
+
+        int runningHandles = 0;
+        curl_multi_socket_action(m_multiHandle, pollFds[i].fd, action, &runningHandles);
+    }
+}
+
+int CurlMultiHttpClient::EventLoop::SocketCallback(CURL* easy, curl_socket_t socket, int what, void* userp, void* socketp)
+{
+    AWS_UNREFERENCED_PARAM(easy);
+    AWS_UNREFERENCED_PARAM(socketp);
+    EventLoop* loop = static_cast<EventLoop*>(userp);
+
+    if (what == CURL_POLL_REMOVE)
+    {
+        loop->m_watchedSockets.erase(socket);
+        return 0;
+    }
+
+    loop->m_watchedSockets[socket] = static_cast<short>(((what & CURL_POLL_IN) ? POLLIN : 0) | ((what & CURL_POLL_OUT) ? POLLOUT : 0));
+    return 0;
+}
+
+#endif
+
+int CurlMultiHttpClient::EventLoop::TimerCallback(CURLM* multi, long timeoutMs, void* userp)
+{
+    AWS_UNREFERENCED_PARAM(multi);
+    EventLoop* loop = static_cast<EventLoop*>(userp);
+
+    if (timeoutMs < 0)
+    {
+        loop->m_timerArmed = false;
+    }
+    else
+    {
+        loop->m_timerArmed = true;
+        loop->m_timerDeadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeoutMs);
+    }
+
+    return 0;
+}
+
+int CurlMultiHttpClient::EventLoop::ComputeWaitTimeout() const
+{
+    if (!m_timerArmed)
+    {
+        return -1;
+    }
+
+    auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(m_timerDeadline - std::chrono::steady_clock::now()).count();
+    return remaining > 0 ? static_cast<int>(remaining) : 0;
+}
+
+void CurlMultiHttpClient::EventLoop::AddPendingTransfers()
+{
+    Aws::Queue<CurlMultiTransfer*> toAdd;
+    {
+        std::lock_guard<std::mutex> locker(m_pendingMutex);
+        std::swap(toAdd, m_pendingTransfers);
+    }
+
+    while (!toAdd.empty())
+    {
+        CurlMultiTransfer* transfer = toAdd.front();
+        toAdd.pop();
+
+        transfer->m_handle = AcquireHandle();
+        if (!transfer->m_handle)
+        {
+            AWS_LOG_ERROR(CurlMultiTag, "curl_easy_init failed to allocate a handle for the request.");
+            CompleteTransfer(transfer, false);
+            continue;
+        }
+
+        m_client->SetRequestOptionsOnHandle(transfer->m_handle, transfer->m_request, transfer->m_url, transfer->m_headers,
+                                            transfer->m_writeContext, transfer->m_readContext);
+        curl_easy_setopt(transfer->m_handle, CURLOPT_PRIVATE, transfer);
+
+        const std::shared_ptr<StreamingResponseConsumer>& consumer = transfer->m_request.GetStreamingResponseConsumer();
+        if (consumer)
+        {
+            consumer->SetResumeHandler([this]()
+            {
+                m_resumeRequested = true;
+                Wakeup();
+            });
+        }
+
+        m_activeTransfers.insert(transfer);
+        CURLMcode addResult = curl_multi_add_handle(m_multiHandle, transfer->m_handle);
+        if (addResult != CURLM_OK)
+        {
+            AWS_LOGSTREAM_ERROR(CurlMultiTag, "curl_multi_add_handle returned error code " << addResult);
+            CompleteTransfer(transfer, false);
+        }
+    }
+}
+
+void CurlMultiHttpClient::EventLoop::ResumeTransfers()
+{
+    if (!m_resumeRequested.exchange(false))
+    {
+        return;
+    }
+
+    //unpausing can complete or fail a transfer right away, so walk a copy.
+    Aws::Vector<CurlMultiTransfer*> activeTransfers(m_activeTransfers.begin(), m_activeTransfers.end());
+    for (CurlMultiTransfer* transfer : activeTransfers)
+    {
+        ResumeIfConsumerResumed(transfer->m_writeContext);
+    }
+}
+
+void CurlMultiHttpClient::EventLoop::ProcessCompletedTransfers()
+{
+    int messagesInQueue = 0;
+    CURLMsg* message = nullptr;
+
+    while ((message = curl_multi_info_read(m_multiHandle, &messagesInQueue)) != nullptr)
+    {
+        if (message->msg != CURLMSG_DONE)
+        {
+            continue;
+        }
+
+        //the message is invalidated by curl_multi_remove_handle, so copy out what we need first.
+        CURL* handle = message->easy_handle;
+        CURLcode result = message->data.result;
+
+        char* privateData = nullptr;
+        curl_easy_getinfo(handle, CURLINFO_PRIVATE, &privateData);
+        CurlMultiTransfer* transfer = reinterpret_cast<CurlMultiTransfer*>(privateData);
+        curl_multi_remove_handle(m_multiHandle, handle);
+
+        if (result != CURLE_OK)
+        {
+            AWS_LOGSTREAM_ERROR(CurlMultiTag, "Curl returned error code " << result);
+        }
+        else
+        {
+            ReadResponseInfoFromHandle(handle, *transfer->m_response);
+            VerifyResponseChecksum(transfer->m_writeContext);
+        }
+
+        CompleteTransfer(transfer, result == CURLE_OK);
+    }
+}
+
+void CurlMultiHttpClient::EventLoop::CompleteTransfer(CurlMultiTransfer* transfer, bool succeeded)
+{
+    if (transfer->m_handle)
+    {
+        ReleaseHandle(transfer->m_handle);
+        transfer->m_handle = nullptr;
+    }
+    m_activeTransfers.erase(transfer);
+
+    const std::shared_ptr<StreamingResponseConsumer>& consumer = transfer->m_request.GetStreamingResponseConsumer();
+    if (consumer)
+    {
+        consumer->SetResumeHandler(nullptr);
+    }
+
+    std::shared_ptr<HttpResponse> response;
+    if (succeeded)
+    {
+        response = transfer->m_response;
+        //go ahead and flush the response body stream
+        response->GetResponseBody().flush();
+    }
+
+    if (transfer->m_onCompleted)
+    {
+        transfer->m_onCompleted(transfer->m_ownedRequest, response);
+    }
+
+    Aws::Delete(transfer);
+}
+
+void CurlMultiHttpClient::EventLoop::FailOutstandingTransfers()
+{
+    while (!m_activeTransfers.empty())
+    {
+        CurlMultiTransfer* transfer = *m_activeTransfers.begin();
+        curl_multi_remove_handle(m_multiHandle, transfer->m_handle);
+        CompleteTransfer(transfer, false);
+    }
+
+    Aws::Queue<CurlMultiTransfer*> pending;
+    {
+        std::lock_guard<std::mutex> locker(m_pendingMutex);
+        std::swap(pending, m_pendingTransfers);
+    }
+
+    while (!pending.empty())
+    {
+        CompleteTransfer(pending.front(), false);
+        pending.pop();
+    }
+}
+
+CURL* CurlMultiHttpClient::EventLoop::AcquireHandle()
+{
+    CURL* handle = nullptr;
+    if (!m_idleHandles.empty())
+    {
+        handle = m_idleHandles.back();
+        m_idleHandles.pop_back();
+    }
+    else
+    {
+        handle = curl_easy_init();
+    }
+
+    if (handle)
+    {
+        //for timeouts to work in a multi-threaded context,
+        //always turn signals off.
+        curl_easy_setopt(handle, CURLOPT_NOSIGNAL, 1L);
+        curl_easy_setopt(handle, CURLOPT_TIMEOUT_MS, m_client->m_requestTimeout);
+        curl_easy_setopt(handle, CURLOPT_CONNECTTIMEOUT_MS, m_client->m_connectTimeout);
+        if (m_shareHandle)
+        {
+            curl_easy_setopt(handle, CURLOPT_SHARE, m_shareHandle);
+        }
+    }
+
+    return handle;
+}
+
+void CurlMultiHttpClient::EventLoop::ReleaseHandle(CURL* handle)
+{
+    if (m_idleHandles.size() < m_maxIdleHandles)
+    {
+        curl_easy_reset(handle);
+        m_idleHandles.push_back(handle);
+    }
+    else
+    {
+        curl_easy_cleanup(handle);
+    }
+}
+
+CurlMultiHttpClient::CurlMultiHttpClient(const ClientConfiguration& clientConfig) :
+    Base(clientConfig),
+    m_nextEventLoop(0),
+    m_requestTimeout(clientConfig.requestTimeoutMs),
+    m_connectTimeout(clientConfig.connectTimeoutMs)
+{
+    unsigned loopCount = clientConfig.ioThreads > 0 ? clientConfig.ioThreads : 1;
+    long streamsPerLoop = static_cast<long>((clientConfig.maxConnections + loopCount - 1) / loopCount);
+    streamsPerLoop = streamsPerLoop > 0 ? streamsPerLoop : 1;
+    long streamsPerConnection = clientConfig.maxStreamsPerConnection > 0 ? static_cast<long>(clientConfig.maxStreamsPerConnection) : 1;
+    AWS_LOGSTREAM_INFO(CurlMultiTag, "Starting " << loopCount << " event loops with " << streamsPerLoop << " concurrent requests each"
+        << (clientConfig.enableHttp2Multiplexing ? ", multiplexed over HTTP/2." : "."));
+
+    for (unsigned i = 0; i < loopCount; ++i)
+    {
+        m_eventLoops.push_back(Aws::New<EventLoop>(CurlMultiTag, this, streamsPerLoop, clientConfig.enableHttp2Multiplexing, streamsPerConnection));
+    }
+}
+
+CurlMultiHttpClient::~CurlMultiHttpClient()
+{
+    for (EventLoop* eventLoop : m_eventLoops)
+    {
+        Aws::Delete(eventLoop);
+    }
+    m_eventLoops.clear();
+}
+
+std::shared_ptr<HttpResponse> CurlMultiHttpClient::MakeRequest(HttpRequest& request, Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+                                                               Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    if (writeLimiter != nullptr)
+    {
+        writeLimiter->ApplyAndPayForCost(request.GetSize());
+    }
+
+    std::promise<std::shared_ptr<HttpResponse>> responsePromise;
+    std::future<std::shared_ptr<HttpResponse>> responseFuture = responsePromise.get_future();
+
+    CurlMultiTransfer* transfer = Aws::New<CurlMultiTransfer>(CurlMultiTag, this, request, readLimiter);
+    transfer->m_onCompleted = [&responsePromise](const std::shared_ptr<HttpRequest>&, const std::shared_ptr<HttpResponse>& response)
+    {
+        responsePromise.set_value(response);
+    };
+
+    SubmitTransfer(transfer);
+    return responseFuture.get();
+}
+
+void CurlMultiHttpClient::MakeRequestAsync(const std::shared_ptr<HttpRequest>& request, const HttpRequestCompletedHandler& onCompleted,
+                                           Aws::Utils::RateLimits::RateLimiterInterface* readLimiter,
+                                           Aws::Utils::RateLimits::RateLimiterInterface* writeLimiter) const
+{
+    if (writeLimiter != nullptr)
+    {
+        writeLimiter->ApplyAndPayForCost(request->GetSize());
+    }
+
+    CurlMultiTransfer* transfer = Aws::New<CurlMultiTransfer>(CurlMultiTag, this, *request, readLimiter);
+    transfer->m_ownedRequest = request;
+    transfer->m_onCompleted = onCompleted;
+
+    SubmitTransfer(transfer);
+}
+
+void CurlMultiHttpClient::SubmitTransfer(CurlMultiTransfer* transfer) const
+{
+    //url and header formatting happen on the calling thread to keep the I/O threads free for socket work.
+    transfer->m_url = ComputeRequestUrl(transfer->m_request);
+    transfer->m_headers = BuildHeaderList(transfer->m_request);
+    AWS_LOGSTREAM_TRACE(CurlMultiTag, "Queueing request to " << transfer->m_url);
+
+    unsigned loopIndex = m_nextEventLoop++ % static_cast<unsigned>(m_eventLoops.size());
+    m_eventLoops[loopIndex]->Submit(transfer);
+}
+
+#endif // _WIN32
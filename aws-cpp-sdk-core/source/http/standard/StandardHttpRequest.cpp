@@ -15,10 +15,13 @@
 
 #include <aws/core/http/standard/StandardHttpRequest.h>
 
+#include <aws/core/http/HttpRequestBody.h>
 #include <aws/core/utils/StringUtils.h>
 
 #include <iostream>
 #include <algorithm>
+#include <cctype>
+#include <cstring>
 
 using namespace Aws::Http;
 using namespace Aws::Http::Standard;
@@ -27,59 +30,74 @@ using namespace Aws::Utils;
 StandardHttpRequest::StandardHttpRequest(const URI& uri, HttpMethod method) :
     HttpRequest(uri, method), 
     bodyStream(nullptr),
+    m_requestBody(nullptr),
     m_responseStreamFactory()
 {
     SetHeaderValue(HOST_HEADER, uri.GetAuthority());
 }
 
-HeaderValueCollection StandardHttpRequest::GetHeaders() const
+//trims the value by moving the bounds instead of building a trimmed copy first.
+static void SetTrimmedHeaderValue(HttpHeaderCollection& headers, const char* headerName, size_t headerNameLength, const Aws::String& headerValue)
 {
-    HeaderValueCollection headers;
-
-    for (HeaderValueCollection::const_iterator iter = headerMap.begin(); iter != headerMap.end(); ++iter)
+    const char* valueBegin = headerValue.c_str();
+    const char* valueEnd = valueBegin + headerValue.length();
+    while (valueBegin < valueEnd && ::isspace(static_cast<unsigned char>(*valueBegin)))
     {
-        headers.emplace(HeaderValuePair(iter->first, iter->second));
+        ++valueBegin;
     }
+    while (valueEnd > valueBegin && ::isspace(static_cast<unsigned char>(*(valueEnd - 1))))
+    {
+        --valueEnd;
+    }
+    headers.Set(headerName, headerNameLength, valueBegin, static_cast<size_t>(valueEnd - valueBegin));
+}
 
-    return headers;
+HeaderValueCollection StandardHttpRequest::GetHeaders() const
+{
+    return headerMap.ToMap();
 }
 
 const Aws::String& StandardHttpRequest::GetHeaderValue(const char* headerName) const
 {
-    return headerMap.find(headerName)->second;
+    return headerMap.GetValue(headerName);
 }
 
 void StandardHttpRequest::SetHeaderValue(const char* headerName, const Aws::String& headerValue)
 {
-    headerMap[StringUtils::ToLower(headerName)] = StringUtils::Trim(headerValue.c_str());
+    SetTrimmedHeaderValue(headerMap, headerName, strlen(headerName), headerValue);
 }
 
 void StandardHttpRequest::SetHeaderValue(const Aws::String& headerName, const Aws::String& headerValue)
 {
-    headerMap[StringUtils::ToLower(headerName.c_str())] = StringUtils::Trim(headerValue.c_str());
+    SetTrimmedHeaderValue(headerMap, headerName.c_str(), headerName.length(), headerValue);
 }
 
 void StandardHttpRequest::DeleteHeader(const char* headerName)
 {
-    headerMap.erase(StringUtils::ToLower(headerName));
+    headerMap.Erase(headerName);
+}
+
+void StandardHttpRequest::AddContentBody(const std::shared_ptr<Aws::IOStream>& strContent)
+{
+    bodyStream = strContent;
+    m_requestBody = HttpRequestBody::Create(strContent);
 }
 
 bool StandardHttpRequest::HasHeader(const char* headerName) const
 {
-    return headerMap.find(StringUtils::ToLower(headerName)) != headerMap.end();
+    return headerMap.Contains(headerName);
 }
 
 int64_t StandardHttpRequest::GetSize() const
 {
     int64_t size = 0;
-    if(bodyStream)
+    //the body measures itself once, so this no longer seeks the stream on every call.
+    if(m_requestBody && m_requestBody->GetLength() > 0)
     {
-        bodyStream->seekg(0, bodyStream->end);
-        size += bodyStream->tellg();
-        bodyStream->seekg(0, bodyStream->beg);
+        size += m_requestBody->GetLength();
     }
 
-    std::for_each(headerMap.cbegin(), headerMap.cend(), [&](const HeaderValueCollection::value_type& kvPair){ size += kvPair.first.length(); size += kvPair.second.length(); });
+    std::for_each(headerMap.begin(), headerMap.end(), [&](const HeaderValuePair& kvPair){ size += kvPair.first.length(); size += kvPair.second.length(); });
 
     return size;
 }
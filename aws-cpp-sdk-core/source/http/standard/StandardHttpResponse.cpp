@@ -27,30 +27,20 @@ using namespace Aws::Utils;
 
 HeaderValueCollection StandardHttpResponse::GetHeaders() const
 {
-    HeaderValueCollection headerValueCollection;
-
-    for (Aws::Map<Aws::String, Aws::String>::const_iterator iter = headerMap.begin(); iter != headerMap.end(); ++iter)
-    {
-        headerValueCollection.emplace(HeaderValuePair(iter->first, iter->second));
-    }
-
-    return headerValueCollection;
+    return headerMap.ToMap();
 }
 
 bool StandardHttpResponse::HasHeader(const char* headerName) const
 {
-    return headerMap.find(StringUtils::ToLower(headerName)) != headerMap.end();
+    return headerMap.Contains(headerName);
 }
 
 const Aws::String& StandardHttpResponse::GetHeader(const Aws::String& headerName) const
 {
-    Aws::Map<Aws::String, Aws::String>::const_iterator foundValue = headerMap.find(StringUtils::ToLower(headerName.c_str()));
-    return foundValue->second;
+    return headerMap.GetValue(headerName.c_str());
 }
 
 void StandardHttpResponse::AddHeader(const Aws::String& headerName, const Aws::String& headerValue)
 {
-    headerMap[StringUtils::ToLower(headerName.c_str())] = headerValue;
+    headerMap.Set(headerName, headerValue);
 }
-
-
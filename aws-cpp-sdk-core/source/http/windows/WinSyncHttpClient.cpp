@@ -15,6 +15,7 @@
 
 #include <aws/core/http/windows/WinSyncHttpClient.h>
 #include <aws/core/Http/HttpRequest.h>
+#include <aws/core/http/StreamingResponseConsumer.h>
 #include <aws/core/http/standard/StandardHttpResponse.h>
 #include <aws/core/utils/StringUtils.h>
 #include <aws/core/utils/logging/LogMacros.h>
@@ -75,11 +76,12 @@ void* WinSyncHttpClient::AllocateWindowsHttpRequest(const Aws::Http::HttpRequest
 
 void WinSyncHttpClient::AddHeadersToRequest(const HttpRequest& request, void* hHttpRequest) const
 {
-    if(request.GetHeaders().size() > 0)
+    const HttpHeaderCollection& headers = request.GetHeaderCollection();
+    if(headers.size() > 0)
     {
         Aws::StringStream ss;
         AWS_LOG_DEBUG(GetLogTag(), "with headers:");
-        for (auto& header : request.GetHeaders())
+        for (auto& header : headers)
         {
             ss << header.first << ": " << header.second << "\r\n";
         }
@@ -209,9 +211,30 @@ std::shared_ptr<HttpResponse> WinSyncHttpClient::BuildSuccessResponse(const Aws:
         read = 0;
         bool success = true;
 
+        //error bodies still go to the response stream, the client needs them to build the AWSError.
+        const std::shared_ptr<StreamingResponseConsumer>& consumer = request.GetStreamingResponseConsumer();
+        int responseCode = static_cast<int>(response->GetResponseCode());
+        bool pushToConsumer = consumer && responseCode >= 200 && responseCode < 300;
+        if (pushToConsumer)
+        {
+            consumer->OnBodyStarted(*response);
+        }
+
         while (DoReadData(hHttpRequest, body, bodySize, read) && read > 0 && success)
         {
-            response->GetResponseBody().write(body, read);
+            if (pushToConsumer)
+            {
+                //not reading from the handle while the consumer is paused is what holds the socket back.
+                while (success && consumer->Deliver(*response, body, static_cast<size_t>(read)) == StreamingConsumerAction::PAUSE)
+                {
+                    while (!consumer->WaitForResume(std::chrono::milliseconds(100)) && (success = IsRequestProcessingEnabled())) {}
+                }
+            }
+            else
+            {
+                response->GetResponseBody().write(body, read);
+            }
+
             if (read > 0)
             {
                 if (readLimiter != nullptr)
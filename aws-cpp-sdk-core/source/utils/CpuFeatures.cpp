@@ -0,0 +1,103 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/CpuFeatures.h>
+
+#if defined(AWS_SIMD_X86) && defined(_MSC_VER)
+#include <intrin.h>
+#define AWS_CPU_FEATURES_CPUID
+#elif defined(AWS_SIMD_X86)
+#include <cpuid.h>
+#define AWS_CPU_FEATURES_BUILTIN
+#endif
+
+using namespace Aws::Utils;
+
+namespace
+{
+    struct DetectedFeatures
+    {
+        DetectedFeatures() : ssse3(false), avx2(false), pclmul(false)
+        {
+#if defined(AWS_CPU_FEATURES_CPUID)
+            int info[4];
+            __cpuid(info, 0);
+            int maxLeaf = info[0];
+
+            __cpuid(info, 1);
+            ssse3 = (info[2] & (1 << 9)) != 0;
+            pclmul = (info[2] & (1 << 1)) != 0;
+            //avx registers are only usable if the os saves them on context switches.
+            bool osSavesYmm = (info[2] & (1 << 27)) != 0 && (info[2] & (1 << 28)) != 0 && (_xgetbv(0) & 6) == 6;
+            if (maxLeaf >= 7 && osSavesYmm)
+            {
+                __cpuidex(info, 7, 0);
+                avx2 = (info[1] & (1 << 5)) != 0;
+            }
+#elif defined(AWS_CPU_FEATURES_BUILTIN)
+            __builtin_cpu_init();
+            ssse3 = __builtin_cpu_supports("ssse3") != 0;
+            avx2 = __builtin_cpu_supports("avx2") != 0;
+            //older compilers don't know "pclmul" as a __builtin_cpu_supports feature, so ask cpuid directly.
+            unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+            pclmul = __get_cpuid(1, &eax, &ebx, &ecx, &edx) && (ecx & (1 << 1)) != 0;
+#endif
+        }
+
+        bool ssse3;
+        bool avx2;
+        bool pclmul;
+    };
+
+    const DetectedFeatures& GetDetectedFeatures()
+    {
+        static DetectedFeatures features;
+        return features;
+    }
+}
+
+bool CpuFeatures::HasSSSE3()
+{
+    return GetDetectedFeatures().ssse3;
+}
+
+bool CpuFeatures::HasAVX2()
+{
+    return GetDetectedFeatures().avx2;
+}
+
+bool CpuFeatures::HasPCLMUL()
+{
+    return GetDetectedFeatures().pclmul;
+}
+
+SimdLevel CpuFeatures::GetBestSimdLevel()
+{
+    static const SimdLevel bestLevel = HasAVX2() ? SimdLevel::AVX2 : (HasSSSE3() ? SimdLevel::SSSE3 : SimdLevel::SCALAR);
+    return bestLevel;
+}
+
+bool CpuFeatures::IsSupported(SimdLevel level)
+{
+    switch (level)
+    {
+        case SimdLevel::AVX2:
+            return HasAVX2();
+        case SimdLevel::SSSE3:
+            return HasSSSE3();
+        default:
+            return true;
+    }
+}
@@ -47,9 +47,13 @@ Aws::String DateTime::CalculateLocalTimestampAsString(const char* formatStr)
 }
 
 Aws::String DateTime::CalculateGmtTimestampAsString(const char* formatStr)
+{
+    return CalculateGmtTimestampAsString(std::time(nullptr), formatStr);
+}
+
+Aws::String DateTime::CalculateGmtTimestampAsString(std::time_t time, const char* formatStr)
 {
     std::lock_guard<std::mutex> locker(timeMutex);
-    std::time_t time = std::time(nullptr);
     struct tm* timestamp = std::gmtime(&time);
 
     if(timestamp)
@@ -90,3 +94,87 @@ Aws::String DateTime::ComputeCurrentDateInISO8601Format()
 {
     return CalculateGmtTimestampAsString(ISO_8601_SIMPLE_DATE_FORMAT_STR);
 }
+
+//reads exactly digitCount digits, the timestamp formats we deal with are all fixed width.
+static bool ReadDigits(const char*& cursor, int digitCount, int& value)
+{
+    value = 0;
+    for (int i = 0; i < digitCount; ++i, ++cursor)
+    {
+        if (*cursor < '0' || *cursor > '9')
+        {
+            return false;
+        }
+        value = value * 10 + (*cursor - '0');
+    }
+    return true;
+}
+
+//days since 1970-01-01 for a proleptic gregorian date. timegm isn't portable and mktime works in local time.
+static long long DaysFromCivil(int year, int month, int day)
+{
+    year -= month <= 2 ? 1 : 0;
+    long long era = (year >= 0 ? year : year - 399) / 400;
+    long long yearOfEra = year - era * 400;
+    long long dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    long long dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+long long DateTime::ConvertISO8601ToMillis(const char* timestamp)
+{
+    if (!timestamp)
+    {
+        return 0;
+    }
+
+    const char* cursor = timestamp;
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+    if (!ReadDigits(cursor, 4, year) || *cursor++ != '-' || !ReadDigits(cursor, 2, month) || *cursor++ != '-' ||
+        !ReadDigits(cursor, 2, day) || (*cursor != 'T' && *cursor != 't') || !ReadDigits(++cursor, 2, hour) ||
+        *cursor++ != ':' || !ReadDigits(cursor, 2, minute) || *cursor++ != ':' || !ReadDigits(cursor, 2, second))
+    {
+        return 0;
+    }
+
+    if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60)
+    {
+        return 0;
+    }
+
+    long long millis = 0;
+    if (*cursor == '.')
+    {
+        ++cursor;
+        long long scale = 100;
+        for (; *cursor >= '0' && *cursor <= '9'; ++cursor)
+        {
+            millis += (*cursor - '0') * scale;
+            scale /= 10;
+        }
+    }
+
+    long long offsetSeconds = 0;
+    if (*cursor == '+' || *cursor == '-')
+    {
+        int sign = *cursor++ == '-' ? -1 : 1;
+        int offsetHours = 0, offsetMinutes = 0;
+        if (!ReadDigits(cursor, 2, offsetHours) || *cursor++ != ':' || !ReadDigits(cursor, 2, offsetMinutes))
+        {
+            return 0;
+        }
+        offsetSeconds = sign * (offsetHours * 3600 + offsetMinutes * 60);
+    }
+    else if (*cursor == 'Z' || *cursor == 'z')
+    {
+        ++cursor;
+    }
+
+    if (*cursor != '\0')
+    {
+        return 0;
+    }
+
+    long long seconds = DaysFromCivil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second - offsetSeconds;
+    return seconds * 1000 + millis;
+}
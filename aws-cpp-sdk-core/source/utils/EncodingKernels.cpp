@@ -0,0 +1,393 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/EncodingKernels.h>
+#include <aws/core/utils/UnreferencedParam.h>
+
+#include <cstring>
+#include <stdint.h>
+
+#ifdef AWS_SIMD_X86
+#include <immintrin.h>
+#endif
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace Aws::Utils;
+
+static const char BASE64_ALPHABET[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+static const char HEX_DIGITS[] = "0123456789abcdef";
+
+static void Base64EncodeScalar(const unsigned char* data, size_t length, char* out)
+{
+    size_t i = 0;
+    for (; i + 3 <= length; i += 3, out += 4)
+    {
+        uint32_t block = (static_cast<uint32_t>(data[i]) << 16) | (static_cast<uint32_t>(data[i + 1]) << 8) | data[i + 2];
+        out[0] = BASE64_ALPHABET[(block >> 18) & 0x3F];
+        out[1] = BASE64_ALPHABET[(block >> 12) & 0x3F];
+        out[2] = BASE64_ALPHABET[(block >> 6) & 0x3F];
+        out[3] = BASE64_ALPHABET[block & 0x3F];
+    }
+
+    size_t remainder = length - i;
+    if (remainder > 0)
+    {
+        uint32_t block = static_cast<uint32_t>(data[i]) << 16;
+        if (remainder == 2)
+        {
+            block |= static_cast<uint32_t>(data[i + 1]) << 8;
+        }
+        out[0] = BASE64_ALPHABET[(block >> 18) & 0x3F];
+        out[1] = BASE64_ALPHABET[(block >> 12) & 0x3F];
+        out[2] = remainder == 2 ? BASE64_ALPHABET[(block >> 6) & 0x3F] : '=';
+        out[3] = '=';
+    }
+}
+
+static void HexEncodeScalar(const unsigned char* data, size_t length, char* out)
+{
+    for (size_t i = 0; i < length; ++i, out += 2)
+    {
+        out[0] = HEX_DIGITS[data[i] >> 4];
+        out[1] = HEX_DIGITS[data[i] & 0x0F];
+    }
+}
+
+static inline bool IsUnreservedChar(char c)
+{
+    return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') ||
+        c == '-' || c == '_' || c == '.' || c == '~';
+}
+
+static size_t CountUnreservedPrefixScalar(const char* data, size_t length)
+{
+    size_t i = 0;
+    while (i < length && IsUnreservedChar(data[i]))
+    {
+        ++i;
+    }
+    return i;
+}
+
+#ifdef AWS_SIMD_X86
+
+static inline unsigned CountTrailingZeros(uint32_t value)
+{
+#ifdef _MSC_VER
+    unsigned long index = 0;
+    _BitScanForward(&index, value);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctz(value));
+#endif
+}
+
+/*
+ * The base64 kernels follow Wojciech Mula and Daniel Lemire, "Faster Base64 Encoding and Decoding Using AVX2 Instructions".
+ * Encoding spreads 3 bytes over 4 lanes with a shuffle, cuts out the 6 bit indices with two multiplies, and turns indices into
+ * chars by adding an offset looked up from the index range. Decoding classifies every char by its nibbles to validate it and
+ * find its offset, then packs four 6 bit values back into 3 bytes with two multiply-adds.
+ */
+
+AWS_SIMD_TARGET_SSSE3 static inline __m128i Base64EncodeLanesSSSE3(__m128i input)
+{
+    input = _mm_shuffle_epi8(input, _mm_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10));
+    __m128i highBits = _mm_mulhi_epu16(_mm_and_si128(input, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+    __m128i lowBits = _mm_mullo_epi16(_mm_and_si128(input, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+    __m128i indices = _mm_or_si128(highBits, lowBits);
+
+    //0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12, which picks the offset from index to char.
+    __m128i range = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    range = _mm_or_si128(range, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), indices), _mm_set1_epi8(13)));
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, range), indices);
+}
+
+//reads 16 bytes to encode 12, so it stops 4 bytes short of the end.
+AWS_SIMD_TARGET_SSSE3 static size_t Base64EncodeSSSE3(const unsigned char* data, size_t length, char* out)
+{
+    size_t consumed = 0;
+    for (; consumed + 16 <= length; consumed += 12, out += 16)
+    {
+        __m128i input = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + consumed));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), Base64EncodeLanesSSSE3(input));
+    }
+    return consumed;
+}
+
+AWS_SIMD_TARGET_AVX2 static size_t Base64EncodeAVX2(const unsigned char* data, size_t length, char* out)
+{
+    const __m256i spread = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+        1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+    const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+
+    //each lane takes 12 bytes, the upper one loaded from 12 bytes in, so 28 bytes are read to encode 24.
+    size_t consumed = 0;
+    for (; consumed + 28 <= length; consumed += 24, out += 32)
+    {
+        __m128i lower = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + consumed));
+        __m128i upper = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + consumed + 12));
+        __m256i input = _mm256_inserti128_si256(_mm256_castsi128_si256(lower), upper, 1);
+
+        input = _mm256_shuffle_epi8(input, spread);
+        __m256i highBits = _mm256_mulhi_epu16(_mm256_and_si256(input, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+        __m256i lowBits = _mm256_mullo_epi16(_mm256_and_si256(input, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+        __m256i indices = _mm256_or_si256(highBits, lowBits);
+
+        __m256i range = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+        range = _mm256_or_si256(range, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_add_epi8(_mm256_shuffle_epi8(offsets, range), indices));
+    }
+
+    return consumed + Base64EncodeSSSE3(data + consumed, length - consumed, out);
+}
+
+AWS_SIMD_TARGET_SSSE3 static size_t Base64DecodeSSSE3(const char* in, size_t length, unsigned char* out)
+{
+    //a char is valid if its low nibble class and high nibble class share no bit.
+    const __m128i lowNibbleClasses = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i highNibbleClasses = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m128i offsets = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i slash = _mm_set1_epi8(0x2F);
+    const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+    size_t consumed = 0;
+    for (; consumed + 16 <= length; consumed += 16, out += 12)
+    {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + consumed));
+        __m128i highNibbles = _mm_and_si128(_mm_srli_epi32(chars, 4), slash);
+        __m128i lowClass = _mm_shuffle_epi8(lowNibbleClasses, _mm_and_si128(chars, slash));
+        __m128i highClass = _mm_shuffle_epi8(highNibbleClasses, highNibbles);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_and_si128(lowClass, highClass), _mm_setzero_si128())) != 0xFFFF)
+        {
+            break;
+        }
+
+        __m128i values = _mm_add_epi8(chars, _mm_shuffle_epi8(offsets, _mm_add_epi8(_mm_cmpeq_epi8(chars, slash), highNibbles)));
+        __m128i merged = _mm_madd_epi16(_mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140)), _mm_set1_epi32(0x00011000));
+        merged = _mm_shuffle_epi8(merged, pack);
+
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out), merged);
+        uint32_t tail = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(merged, 8)));
+        memcpy(out + 8, &tail, sizeof(tail));
+    }
+    return consumed;
+}
+
+AWS_SIMD_TARGET_AVX2 static size_t Base64DecodeAVX2(const char* in, size_t length, unsigned char* out)
+{
+    const __m256i lowNibbleClasses = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+        0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i highNibbleClasses = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+        0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    const __m256i offsets = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+        0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m256i slash = _mm256_set1_epi8(0x2F);
+    const __m256i pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+    const __m256i joinLanes = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+
+    size_t consumed = 0;
+    for (; consumed + 32 <= length; consumed += 32, out += 24)
+    {
+        __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + consumed));
+        __m256i highNibbles = _mm256_and_si256(_mm256_srli_epi32(chars, 4), slash);
+        __m256i lowClass = _mm256_shuffle_epi8(lowNibbleClasses, _mm256_and_si256(chars, slash));
+        __m256i highClass = _mm256_shuffle_epi8(highNibbleClasses, highNibbles);
+        if (!_mm256_testz_si256(lowClass, highClass))
+        {
+            break;
+        }
+
+        __m256i values = _mm256_add_epi8(chars, _mm256_shuffle_epi8(offsets, _mm256_add_epi8(_mm256_cmpeq_epi8(chars, slash), highNibbles)));
+        __m256i merged = _mm256_madd_epi16(_mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140)), _mm256_set1_epi32(0x00011000));
+        merged = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(merged, pack), joinLanes);
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm256_castsi256_si128(merged));
+        _mm_storel_epi64(reinterpret_cast<__m128i*>(out + 16), _mm256_extracti128_si256(merged, 1));
+    }
+
+    return consumed + Base64DecodeSSSE3(in + consumed, length - consumed, out);
+}
+
+AWS_SIMD_TARGET_SSSE3 static size_t HexEncodeSSSE3(const unsigned char* data, size_t length, char* out)
+{
+    const __m128i digits = _mm_loadu_si128(reinterpret_cast<const __m128i*>(HEX_DIGITS));
+    const __m128i lowNibble = _mm_set1_epi8(0x0F);
+
+    size_t consumed = 0;
+    for (; consumed + 16 <= length; consumed += 16, out += 32)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + consumed));
+        __m128i high = _mm_shuffle_epi8(digits, _mm_and_si128(_mm_srli_epi16(bytes, 4), lowNibble));
+        __m128i low = _mm_shuffle_epi8(digits, _mm_and_si128(bytes, lowNibble));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi8(high, low));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 16), _mm_unpackhi_epi8(high, low));
+    }
+    return consumed;
+}
+
+AWS_SIMD_TARGET_AVX2 static size_t HexEncodeAVX2(const unsigned char* data, size_t length, char* out)
+{
+    const __m256i digits = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(HEX_DIGITS)));
+    const __m256i lowNibble = _mm256_set1_epi8(0x0F);
+
+    size_t consumed = 0;
+    for (; consumed + 32 <= length; consumed += 32, out += 64)
+    {
+        __m256i bytes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + consumed));
+        __m256i high = _mm256_shuffle_epi8(digits, _mm256_and_si256(_mm256_srli_epi16(bytes, 4), lowNibble));
+        __m256i low = _mm256_shuffle_epi8(digits, _mm256_and_si256(bytes, lowNibble));
+        //unpacking works within 128 bit lanes, so the halves come out interleaved and get swapped back in place.
+        __m256i first = _mm256_unpacklo_epi8(high, low);
+        __m256i second = _mm256_unpackhi_epi8(high, low);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 32), _mm256_permute2x128_si256(first, second, 0x31));
+    }
+
+    return consumed + HexEncodeSSSE3(data + consumed, length - consumed, out);
+}
+
+/*
+ * The url scan compares every char against the unreserved ranges with signed compares, so chars from 0x80 up never pass.
+ * Folding with 0x20 maps upper case onto lower case, which turns the two letter ranges into one.
+ */
+
+AWS_SIMD_TARGET_SSSE3 static inline __m128i UnreservedLanesSSSE3(__m128i chars)
+{
+    __m128i folded = _mm_or_si128(chars, _mm_set1_epi8(0x20));
+    __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(folded, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('z' + 1), folded));
+    __m128i digits = _mm_and_si128(_mm_cmpgt_epi8(chars, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), chars));
+    __m128i marks = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('-')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('_'))),
+        _mm_or_si128(_mm_cmpeq_epi8(chars, _mm_set1_epi8('.')), _mm_cmpeq_epi8(chars, _mm_set1_epi8('~'))));
+    return _mm_or_si128(_mm_or_si128(letters, digits), marks);
+}
+
+AWS_SIMD_TARGET_SSSE3 static size_t CountUnreservedPrefixSSSE3(const char* data, size_t length)
+{
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16)
+    {
+        __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        uint32_t reserved = ~static_cast<uint32_t>(_mm_movemask_epi8(UnreservedLanesSSSE3(chars))) & 0xFFFF;
+        if (reserved)
+        {
+            return i + CountTrailingZeros(reserved);
+        }
+    }
+    return i + CountUnreservedPrefixScalar(data + i, length - i);
+}
+
+AWS_SIMD_TARGET_AVX2 static size_t CountUnreservedPrefixAVX2(const char* data, size_t length)
+{
+    size_t i = 0;
+    for (; i + 32 <= length; i += 32)
+    {
+        __m256i chars = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(data + i));
+        __m256i folded = _mm256_or_si256(chars, _mm256_set1_epi8(0x20));
+        __m256i letters = _mm256_and_si256(_mm256_cmpgt_epi8(folded, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), folded));
+        __m256i digits = _mm256_and_si256(_mm256_cmpgt_epi8(chars, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), chars));
+        __m256i marks = _mm256_or_si256(_mm256_or_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('-')), _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('_'))),
+            _mm256_or_si256(_mm256_cmpeq_epi8(chars, _mm256_set1_epi8('.')), _mm256_cmpeq_epi8(chars, _mm256_set1_epi8('~'))));
+        uint32_t reserved = ~static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(_mm256_or_si256(letters, digits), marks)));
+        if (reserved)
+        {
+            return i + CountTrailingZeros(reserved);
+        }
+    }
+    return i + CountUnreservedPrefixSSSE3(data + i, length - i);
+}
+
+#endif // AWS_SIMD_X86
+
+void EncodingKernels::Base64Encode(const unsigned char* data, size_t length, char* out, SimdLevel level)
+{
+    size_t consumed = 0;
+#ifdef AWS_SIMD_X86
+    if (level == SimdLevel::AVX2)
+    {
+        consumed = Base64EncodeAVX2(data, length, out);
+    }
+    else if (level == SimdLevel::SSSE3)
+    {
+        consumed = Base64EncodeSSSE3(data, length, out);
+    }
+#else
+    AWS_UNREFERENCED_PARAM(level);
+#endif
+    Base64EncodeScalar(data + consumed, length - consumed, out + consumed / 3 * 4);
+}
+
+size_t EncodingKernels::Base64DecodeBlocks(const char* in, size_t length, unsigned char* out, SimdLevel level)
+{
+#ifdef AWS_SIMD_X86
+    if (level == SimdLevel::AVX2)
+    {
+        return Base64DecodeAVX2(in, length, out);
+    }
+    else if (level == SimdLevel::SSSE3)
+    {
+        return Base64DecodeSSSE3(in, length, out);
+    }
+#else
+    AWS_UNREFERENCED_PARAM(in);
+    AWS_UNREFERENCED_PARAM(length);
+    AWS_UNREFERENCED_PARAM(out);
+    AWS_UNREFERENCED_PARAM(level);
+#endif
+    return 0;
+}
+
+void EncodingKernels::HexEncode(const unsigned char* data, size_t length, char* out, SimdLevel level)
+{
+    size_t consumed = 0;
+#ifdef AWS_SIMD_X86
+    if (level == SimdLevel::AVX2)
+    {
+        consumed = HexEncodeAVX2(data, length, out);
+    }
+    else if (level == SimdLevel::SSSE3)
+    {
+        consumed = HexEncodeSSSE3(data, length, out);
+    }
+#else
+    AWS_UNREFERENCED_PARAM(level);
+#endif
+    HexEncodeScalar(data + consumed, length - consumed, out + consumed * 2);
+}
+
+size_t EncodingKernels::CountUnreservedPrefix(const char* data, size_t length, SimdLevel level)
+{
+#ifdef AWS_SIMD_X86
+    if (level == SimdLevel::AVX2)
+    {
+        return CountUnreservedPrefixAVX2(data, length);
+    }
+    else if (level == SimdLevel::SSSE3)
+    {
+        return CountUnreservedPrefixSSSE3(data, length);
+    }
+#else
+    AWS_UNREFERENCED_PARAM(level);
+#endif
+    return CountUnreservedPrefixScalar(data, length);
+}
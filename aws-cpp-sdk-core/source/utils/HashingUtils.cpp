@@ -19,9 +19,8 @@
 #include <aws/core/utils/crypto/Sha256HMAC.h>
 #include <aws/core/utils/crypto/MD5.h>
 #include <aws/core/utils/Outcome.h>
-#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/StringBuilder.h>
 
-#include <iomanip>
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Base64;
@@ -60,15 +59,9 @@ ByteBuffer HashingUtils::CalculateSHA256(Aws::IOStream& stream)
 
 Aws::String HashingUtils::HexEncode(const ByteBuffer& message)
 {
-    Aws::StringStream ss;
-
-    for (unsigned i = 0; i < message.GetLength(); ++i)
-    {
-        ss << std::hex << std::setw(2) << std::setfill('0')
-            << (unsigned int) message[i];
-    }
-
-    return ss.str();
+    StringBuilder<> encoded;
+    encoded.AppendHexEncoded(message.GetUnderlyingData(), message.GetLength());
+    return encoded.ToString();
 }
 
 ByteBuffer HashingUtils::CalculateMD5(const Aws::String& str)
@@ -0,0 +1,250 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/StringBuilder.h>
+#include <aws/core/utils/EncodingKernels.h>
+
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <cassert>
+
+using namespace Aws::Utils;
+
+static const char* STRING_BUILDER_ALLOCATION_TAG = "StringBuilder";
+
+const size_t IntegerFormat::MAX_DECIMAL_LENGTH;
+const size_t IntegerFormat::MAX_HEX_LENGTH;
+
+size_t IntegerFormat::FormatDecimal(unsigned long long value, char* buffer)
+{
+    char digits[MAX_DECIMAL_LENGTH];
+    size_t count = 0;
+    do
+    {
+        digits[count++] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value);
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        buffer[i] = digits[count - i - 1];
+    }
+    return count;
+}
+
+size_t IntegerFormat::FormatDecimal(long long value, char* buffer)
+{
+    if (value < 0)
+    {
+        buffer[0] = '-';
+        //negate in unsigned arithmetic so LLONG_MIN doesn't overflow.
+        return 1 + FormatDecimal(0ULL - static_cast<unsigned long long>(value), buffer + 1);
+    }
+    return FormatDecimal(static_cast<unsigned long long>(value), buffer);
+}
+
+size_t IntegerFormat::FormatHex(unsigned long long value, char* buffer, size_t minDigits, bool upperCase)
+{
+    const char* hexDigits = upperCase ? "0123456789ABCDEF" : "0123456789abcdef";
+    char digits[MAX_HEX_LENGTH];
+    size_t count = 0;
+    do
+    {
+        digits[count++] = hexDigits[value & 0x0F];
+        value >>= 4;
+    } while (value);
+
+    minDigits = minDigits > MAX_HEX_LENGTH ? MAX_HEX_LENGTH : minDigits;
+    size_t padding = minDigits > count ? minDigits - count : 0;
+    memset(buffer, '0', padding);
+    for (size_t i = 0; i < count; ++i)
+    {
+        buffer[padding + i] = digits[count - i - 1];
+    }
+    return padding + count;
+}
+
+StringBuilderBase::StringBuilderBase(char* inlineBuffer, size_t inlineCapacity) :
+    m_inlineBuffer(inlineBuffer),
+    m_data(inlineBuffer),
+    m_length(0),
+    m_capacity(inlineCapacity)
+{
+    assert(inlineCapacity > 0);
+}
+
+StringBuilderBase::~StringBuilderBase()
+{
+    if (IsOnHeap())
+    {
+        Aws::Free(m_data);
+    }
+}
+
+void StringBuilderBase::Grow(size_t requiredCapacity)
+{
+    size_t newCapacity = m_capacity * 2;
+    if (newCapacity < requiredCapacity)
+    {
+        newCapacity = requiredCapacity;
+    }
+
+    char* newData = reinterpret_cast<char*>(Aws::Malloc(STRING_BUILDER_ALLOCATION_TAG, newCapacity));
+    memcpy(newData, m_data, m_length + 1);
+    if (IsOnHeap())
+    {
+        Aws::Free(m_data);
+    }
+    m_data = newData;
+    m_capacity = newCapacity;
+}
+
+void StringBuilderBase::Reserve(size_t capacity)
+{
+    if (capacity >= m_capacity)
+    {
+        Grow(capacity + 1);
+    }
+}
+
+void StringBuilderBase::Truncate(size_t length)
+{
+    if (length < m_length)
+    {
+        m_length = length;
+        m_data[m_length] = '\0';
+    }
+}
+
+StringBuilderBase& StringBuilderBase::Append(const char* data, size_t length)
+{
+    if (length)
+    {
+        memcpy(Extend(length), data, length);
+    }
+    return *this;
+}
+
+StringBuilderBase& StringBuilderBase::Append(char c)
+{
+    *Extend(1) = c;
+    return *this;
+}
+
+StringBuilderBase& StringBuilderBase::AppendDecimal(long long value)
+{
+    char digits[IntegerFormat::MAX_DECIMAL_LENGTH];
+    return Append(digits, IntegerFormat::FormatDecimal(value, digits));
+}
+
+StringBuilderBase& StringBuilderBase::AppendDecimal(unsigned long long value)
+{
+    char digits[IntegerFormat::MAX_DECIMAL_LENGTH];
+    return Append(digits, IntegerFormat::FormatDecimal(value, digits));
+}
+
+StringBuilderBase& StringBuilderBase::AppendHex(unsigned long long value, size_t minDigits, bool upperCase)
+{
+    char digits[IntegerFormat::MAX_HEX_LENGTH];
+    return Append(digits, IntegerFormat::FormatHex(value, digits, minDigits, upperCase));
+}
+
+StringBuilderBase& StringBuilderBase::AppendHexEncoded(const unsigned char* data, size_t length)
+{
+    EncodingKernels::HexEncode(data, length, Extend(length * 2));
+    return *this;
+}
+
+StringBuilderBase& StringBuilderBase::AppendURLEncoded(const char* data, size_t length)
+{
+    //copy each run of unreserved chars in one go; only the chars between runs get encoded one at a time.
+    size_t i = 0;
+    while (i < length)
+    {
+        size_t unreserved = EncodingKernels::CountUnreservedPrefix(data + i, length - i);
+        Append(data + i, unreserved);
+        i += unreserved;
+
+        if (i < length)
+        {
+            char* dest = Extend(3);
+            dest[0] = '%';
+            IntegerFormat::FormatHexByte(static_cast<unsigned char>(data[i++]), dest + 1, true);
+        }
+    }
+    return *this;
+}
+
+static inline int HexDigitValue(char c)
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+StringBuilderBase& StringBuilderBase::AppendURLDecoded(const char* data, size_t length)
+{
+    //decoding never grows the text, so extend once and give back what wasn't needed at the end.
+    size_t start = m_length;
+    char* dest = Extend(length);
+    size_t written = 0;
+
+    size_t i = 0;
+    while (i < length)
+    {
+        const char* percent = static_cast<const char*>(memchr(data + i, '%', length - i));
+        size_t runEnd = percent ? static_cast<size_t>(percent - data) : length;
+        memcpy(dest + written, data + i, runEnd - i);
+        written += runEnd - i;
+        i = runEnd;
+
+        if (percent)
+        {
+            if (length - i < 3)
+            {
+                //a truncated escape at the very end is kept as it is.
+                memcpy(dest + written, data + i, length - i);
+                written += length - i;
+                break;
+            }
+
+            int high = HexDigitValue(data[i + 1]);
+            int low = HexDigitValue(data[i + 2]);
+            if (high >= 0 && low >= 0)
+            {
+                dest[written++] = static_cast<char>((high << 4) | low);
+            }
+            else
+            {
+                //same as the strtol based decoding used to do: take the leading hex digit if there is one, else 0.
+                dest[written++] = static_cast<char>(high >= 0 ? high : 0);
+            }
+            i += 3;
+        }
+    }
+
+    Truncate(start + written);
+    return *this;
+}
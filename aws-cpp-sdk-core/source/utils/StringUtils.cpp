@@ -15,6 +15,7 @@
 
 
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/StringBuilder.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
 #include <algorithm>
 #include <iomanip>
@@ -115,28 +116,9 @@ Aws::Vector<Aws::String> StringUtils::SplitOnLine(const Aws::String& toSplit)
 
 Aws::String StringUtils::URLEncode(const char* unsafe)
 {
-    Aws::StringStream escaped;
-    escaped.fill('0');
-    escaped << std::hex << std::uppercase;
-
-    size_t unsafeLength = strlen(unsafe);
-    for (auto i = unsafe, n = unsafe + unsafeLength; i != n; ++i)
-    {
-        char c = *i;
-		//MSVC 2015 has an assertion that c is positive in isalnum(). This breaks unicode support.
-		//bypass that with the first check.
-        if (c >= 0 && (isalnum(c) || c == '-' || c == '_' || c == '.' || c == '~'))
-        {
-            escaped << c;
-        }
-        else
-        {
-            //this unsigned char cast allows us to handle unicode characters.
-            escaped << '%' << std::setw(2) << int((unsigned char)c) << std::setw(0);
-        }
-    }
-
-    return escaped.str();
+    StringBuilder<> escaped;
+    escaped.AppendURLEncoded(unsafe, strlen(unsafe));
+    return escaped.ToString();
 }
 
 Aws::String StringUtils::URLEncode(double unsafe)
@@ -154,31 +136,9 @@ Aws::String StringUtils::URLEncode(double unsafe)
 
 Aws::String StringUtils::URLDecode(const char* safe)
 {
-    Aws::StringStream unescaped;
-    unescaped.fill('0');
-    unescaped << std::hex;
-
-    size_t safeLength = strlen(safe);
-    for (auto i = safe, n = safe + safeLength; i != n; ++i)
-    {
-        char c = *i;
-        if(c == '%')
-        {
-            char hex[3];
-            hex[0] = *(i + 1);
-            hex[1] = *(i + 2);
-            hex[2] = 0;
-            i += 2;
-            int hexAsInteger = strtol(hex, nullptr, 16);
-            unescaped << (char)hexAsInteger;
-        }
-        else
-        {
-            unescaped << *i;
-        }
-    }
-
-    return unescaped.str();
+    StringBuilder<> unescaped;
+    unescaped.AppendURLDecoded(safe, strlen(safe));
+    return unescaped.ToString();
 }
 
 Aws::String StringUtils::LTrim(const char* source)
@@ -14,6 +14,7 @@
   */
 
 #include <aws/core/utils/base64/Base64.h>
+#include <aws/core/utils/EncodingKernels.h>
 #include <cstring>
 
 using namespace Aws::Utils::Base64;
@@ -36,12 +37,13 @@ Base64::Base64(const char *encodingTable)
     }
 
     memcpy(m_mimeBase64EncodingTable, encodingTable, encodingTableLength);
+    m_isStandardTable = memcmp(m_mimeBase64EncodingTable, BASE64_ENCODING_TABLE_MIME, encodingTableLength) == 0;
 
     memset((void *)m_mimeBase64DecodingTable, 0, 256);
 
     for(uint32_t i = 0; i < encodingTableLength; ++i)
     {
-        uint32_t index = static_cast<uint32_t>(m_mimeBase64EncodingTable[i]);
+        uint32_t index = static_cast<unsigned char>(m_mimeBase64EncodingTable[i]);
         m_mimeBase64DecodingTable[index] = static_cast<uint8_t>(i);
     }
 
@@ -55,6 +57,16 @@ Aws::String Base64::Encode(const Aws::Utils::ByteBuffer& buffer) const
     size_t remainderCount = (bufferLength % 3);
 
     Aws::String outputString;
+    if(m_isStandardTable)
+    {
+        outputString.resize(CalculateBase64EncodedLength(buffer));
+        if(bufferLength > 0)
+        {
+            Aws::Utils::EncodingKernels::Base64Encode(buffer.GetUnderlyingData(), bufferLength, &outputString[0]);
+        }
+        return outputString;
+    }
+
     outputString.reserve(CalculateBase64EncodedLength(buffer));
 
     for(size_t i = 0; i < bufferLength; i += 3 )
@@ -99,14 +111,21 @@ Aws::Utils::ByteBuffer Base64::Decode(const Aws::String& str) const
 
     const char* rawString = str.c_str();
     size_t blockCount = str.length() / 4;
-    for(size_t i = 0; i < blockCount; ++i)
+    size_t firstBlock = 0;
+    //the last block may carry padding, so it is always left to the loop below.
+    if(m_isStandardTable && blockCount > 1)
+    {
+        firstBlock = Aws::Utils::EncodingKernels::Base64DecodeBlocks(rawString, (blockCount - 1) * 4, buffer.GetUnderlyingData()) / 4;
+    }
+
+    for(size_t i = firstBlock; i < blockCount; ++i)
     {
         size_t stringIndex = i * 4;
 
-        uint32_t value1 = m_mimeBase64DecodingTable[uint32_t(rawString[stringIndex])];
-        uint32_t value2 = m_mimeBase64DecodingTable[uint32_t(rawString[++stringIndex])];
-        uint32_t value3 = m_mimeBase64DecodingTable[uint32_t(rawString[++stringIndex])];
-        uint32_t value4 = m_mimeBase64DecodingTable[uint32_t(rawString[++stringIndex])];
+        uint32_t value1 = m_mimeBase64DecodingTable[static_cast<unsigned char>(rawString[stringIndex])];
+        uint32_t value2 = m_mimeBase64DecodingTable[static_cast<unsigned char>(rawString[++stringIndex])];
+        uint32_t value3 = m_mimeBase64DecodingTable[static_cast<unsigned char>(rawString[++stringIndex])];
+        uint32_t value4 = m_mimeBase64DecodingTable[static_cast<unsigned char>(rawString[++stringIndex])];
 
         size_t bufferIndex = i * 3;
         buffer[bufferIndex] = static_cast<uint8_t>((value1 << 2) | ((value2 >> 4) & 0x03));
@@ -0,0 +1,265 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/CRC32.h>
+#include <aws/core/utils/CpuFeatures.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/UnreferencedParam.h>
+
+#ifdef AWS_SIMD_X86
+#include <immintrin.h>
+#endif
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const uint32_t CRC32_POLYNOMIAL = 0xEDB88320;
+static const size_t CRC32_DIGEST_LENGTH = 4;
+
+namespace
+{
+    //entries[0] is the classic byte at a time table; entries[k] advances a byte through k more zero bytes, which lets
+    //slice-by-8 look up all 8 bytes of a word independently and xor the results.
+    struct CRC32Table
+    {
+        CRC32Table()
+        {
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                uint32_t crc = i;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc >> 1) ^ ((crc & 1) ? CRC32_POLYNOMIAL : 0);
+                }
+                entries[0][i] = crc;
+            }
+
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                for (int slice = 1; slice < 8; ++slice)
+                {
+                    uint32_t previous = entries[slice - 1][i];
+                    entries[slice][i] = (previous >> 8) ^ entries[0][previous & 0xFF];
+                }
+            }
+        }
+
+        uint32_t entries[8][256];
+    };
+}
+
+static const CRC32Table& GetTable()
+{
+    static const CRC32Table table;
+    return table;
+}
+
+static inline uint32_t LoadLittleEndian32(const unsigned char* buffer)
+{
+    return static_cast<uint32_t>(buffer[0]) | (static_cast<uint32_t>(buffer[1]) << 8) |
+        (static_cast<uint32_t>(buffer[2]) << 16) | (static_cast<uint32_t>(buffer[3]) << 24);
+}
+
+//state is the inverted crc, the way the kernels work on it.
+static uint32_t ExtendSliceBy8(uint32_t state, const unsigned char* buffer, size_t bufferSize)
+{
+    const CRC32Table& table = GetTable();
+    for (; bufferSize >= 8; buffer += 8, bufferSize -= 8)
+    {
+        uint32_t low = LoadLittleEndian32(buffer) ^ state;
+        uint32_t high = LoadLittleEndian32(buffer + 4);
+        state = table.entries[7][low & 0xFF] ^ table.entries[6][(low >> 8) & 0xFF] ^
+            table.entries[5][(low >> 16) & 0xFF] ^ table.entries[4][low >> 24] ^
+            table.entries[3][high & 0xFF] ^ table.entries[2][(high >> 8) & 0xFF] ^
+            table.entries[1][(high >> 16) & 0xFF] ^ table.entries[0][high >> 24];
+    }
+
+    for (size_t i = 0; i < bufferSize; ++i)
+    {
+        state = table.entries[0][(state ^ buffer[i]) & 0xFF] ^ (state >> 8);
+    }
+    return state;
+}
+
+#ifdef AWS_SIMD_X86
+
+/*
+ * Folding with carry-less multiplication, from Gopal et al., "Fast CRC Computation for Generic Polynomials Using PCLMULQDQ
+ * Instruction" (Intel, 2009). Four 128 bit accumulators are folded forward 64 bytes per step, then into one, which is folded
+ * 16 bytes per step and finally Barrett reduced to 32 bits. The constants are the bit reflected ones for the IEEE polynomial.
+ * bufferSize has to be a multiple of 16 and at least 64.
+ */
+AWS_SIMD_TARGET_PCLMUL static uint32_t ExtendPCLMUL(uint32_t state, const unsigned char* buffer, size_t bufferSize)
+{
+    const __m128i foldBy4 = _mm_set_epi64x(0x01c6e41596LL, 0x0154442bd4LL);
+    const __m128i foldBy1 = _mm_set_epi64x(0x00ccaa009eLL, 0x01751997d0LL);
+    const __m128i foldTo64 = _mm_set_epi64x(0, 0x0163cd6124LL);
+    const __m128i barrett = _mm_set_epi64x(0x01f7011641LL, 0x01db710641LL);
+    const __m128i low32 = _mm_setr_epi32(~0, 0, ~0, 0);
+
+    __m128i x1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer));
+    __m128i x2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + 16));
+    __m128i x3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + 32));
+    __m128i x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + 48));
+    x1 = _mm_xor_si128(x1, _mm_cvtsi32_si128(static_cast<int>(state)));
+    buffer += 64;
+    bufferSize -= 64;
+
+    for (; bufferSize >= 64; buffer += 64, bufferSize -= 64)
+    {
+        __m128i x5 = _mm_clmulepi64_si128(x1, foldBy4, 0x00);
+        __m128i x6 = _mm_clmulepi64_si128(x2, foldBy4, 0x00);
+        __m128i x7 = _mm_clmulepi64_si128(x3, foldBy4, 0x00);
+        __m128i x8 = _mm_clmulepi64_si128(x4, foldBy4, 0x00);
+
+        x1 = _mm_clmulepi64_si128(x1, foldBy4, 0x11);
+        x2 = _mm_clmulepi64_si128(x2, foldBy4, 0x11);
+        x3 = _mm_clmulepi64_si128(x3, foldBy4, 0x11);
+        x4 = _mm_clmulepi64_si128(x4, foldBy4, 0x11);
+
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer)));
+        x2 = _mm_xor_si128(_mm_xor_si128(x2, x6), _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + 16)));
+        x3 = _mm_xor_si128(_mm_xor_si128(x3, x7), _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + 32)));
+        x4 = _mm_xor_si128(_mm_xor_si128(x4, x8), _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer + 48)));
+    }
+
+    __m128i x5 = _mm_clmulepi64_si128(x1, foldBy1, 0x00);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, foldBy1, 0x11), x2), x5);
+    x5 = _mm_clmulepi64_si128(x1, foldBy1, 0x00);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, foldBy1, 0x11), x3), x5);
+    x5 = _mm_clmulepi64_si128(x1, foldBy1, 0x00);
+    x1 = _mm_xor_si128(_mm_xor_si128(_mm_clmulepi64_si128(x1, foldBy1, 0x11), x4), x5);
+
+    for (; bufferSize >= 16; buffer += 16, bufferSize -= 16)
+    {
+        x5 = _mm_clmulepi64_si128(x1, foldBy1, 0x00);
+        x1 = _mm_clmulepi64_si128(x1, foldBy1, 0x11);
+        x1 = _mm_xor_si128(_mm_xor_si128(x1, x5), _mm_loadu_si128(reinterpret_cast<const __m128i*>(buffer)));
+    }
+
+    //128 bits down to 64.
+    x2 = _mm_clmulepi64_si128(x1, foldBy1, 0x10);
+    x1 = _mm_xor_si128(_mm_srli_si128(x1, 8), x2);
+    x2 = _mm_srli_si128(x1, 4);
+    x1 = _mm_xor_si128(_mm_clmulepi64_si128(_mm_and_si128(x1, low32), foldTo64, 0x00), x2);
+
+    //and 64 down to 32.
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x1, low32), barrett, 0x10);
+    x2 = _mm_clmulepi64_si128(_mm_and_si128(x2, low32), barrett, 0x00);
+    x1 = _mm_xor_si128(x1, x2);
+    return static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(x1, 4)));
+}
+
+#endif // AWS_SIMD_X86
+
+static ByteBuffer ToDigest(uint32_t crc)
+{
+    ByteBuffer digest(CRC32_DIGEST_LENGTH);
+    digest[0] = static_cast<unsigned char>(crc >> 24);
+    digest[1] = static_cast<unsigned char>(crc >> 16);
+    digest[2] = static_cast<unsigned char>(crc >> 8);
+    digest[3] = static_cast<unsigned char>(crc);
+    return digest;
+}
+
+CRC32::CRC32() :
+    m_runningCrc(0)
+{
+}
+
+bool CRC32::IsSupported(Kernel kernel)
+{
+#ifdef AWS_SIMD_X86
+    return kernel == Kernel::SLICE_BY_8 || CpuFeatures::HasPCLMUL();
+#else
+    return kernel == Kernel::SLICE_BY_8;
+#endif
+}
+
+uint32_t CRC32::Extend(uint32_t crc, const unsigned char* buffer, size_t bufferSize)
+{
+    static const Kernel bestKernel = IsSupported(Kernel::PCLMUL) ? Kernel::PCLMUL : Kernel::SLICE_BY_8;
+    return Extend(crc, buffer, bufferSize, bestKernel);
+}
+
+uint32_t CRC32::Extend(uint32_t crc, const unsigned char* buffer, size_t bufferSize, Kernel kernel)
+{
+    uint32_t state = ~crc;
+#ifdef AWS_SIMD_X86
+    if (kernel == Kernel::PCLMUL && bufferSize >= 64)
+    {
+        size_t folded = bufferSize & ~static_cast<size_t>(15);
+        state = ExtendPCLMUL(state, buffer, folded);
+        buffer += folded;
+        bufferSize -= folded;
+    }
+#else
+    AWS_UNREFERENCED_PARAM(kernel);
+#endif
+    return ~ExtendSliceBy8(state, buffer, bufferSize);
+}
+
+uint32_t CRC32::ToValue(const ByteBuffer& digest)
+{
+    if (digest.GetLength() != CRC32_DIGEST_LENGTH)
+    {
+        return 0;
+    }
+
+    return (static_cast<uint32_t>(digest[0]) << 24) | (static_cast<uint32_t>(digest[1]) << 16) |
+        (static_cast<uint32_t>(digest[2]) << 8) | static_cast<uint32_t>(digest[3]);
+}
+
+HashResult CRC32::Calculate(const Aws::String& str)
+{
+    return HashResult(ToDigest(Extend(0, reinterpret_cast<const unsigned char*>(str.c_str()), str.size())));
+}
+
+HashResult CRC32::Calculate(Aws::IStream& stream)
+{
+    uint32_t crc = 0;
+
+    auto currentPos = stream.tellg();
+    stream.seekg(0, stream.beg);
+
+    char streamBuffer[Aws::Utils::Crypto::Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE];
+    while (stream.good())
+    {
+        stream.read(streamBuffer, Aws::Utils::Crypto::Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE);
+        auto bytesRead = stream.gcount();
+        if (bytesRead > 0)
+        {
+            crc = Extend(crc, reinterpret_cast<const unsigned char*>(streamBuffer), static_cast<size_t>(bytesRead));
+        }
+    }
+
+    stream.clear();
+    stream.seekg(currentPos, stream.beg);
+
+    return HashResult(ToDigest(crc));
+}
+
+bool CRC32::Update(const unsigned char* buffer, size_t bufferSize)
+{
+    m_runningCrc = Extend(m_runningCrc, buffer, bufferSize);
+    return true;
+}
+
+HashResult CRC32::GetHash()
+{
+    uint32_t crc = m_runningCrc;
+    m_runningCrc = 0;
+    return HashResult(ToDigest(crc));
+}
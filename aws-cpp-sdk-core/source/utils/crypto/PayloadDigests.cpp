@@ -0,0 +1,191 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/crypto/PayloadDigests.h>
+#include <aws/core/utils/crypto/CRC32.h>
+#include <aws/core/utils/crypto/Factories.h>
+#include <aws/core/utils/crypto/Hash.h>
+#include <aws/core/utils/logging/LogMacros.h>
+#include <aws/core/utils/memory/stl/AWSStreamFwd.h>
+#include <aws/core/utils/Outcome.h>
+
+#include <istream>
+
+using namespace Aws::Utils;
+using namespace Aws::Utils::Crypto;
+
+static const char* LOG_TAG = "PayloadDigests";
+
+/**
+ * One pass over a payload, feeding every block to each running digest in turn.
+ * Implementations that only support one-shot hashing are left for a separate pass afterwards.
+ */
+class PayloadDigests::Pass
+{
+public:
+    Pass(unsigned mask) : m_mask(mask), m_incremental(0), m_crc32(0)
+    {
+        if (mask & MD5_DIGEST)
+        {
+            m_md5 = CreateMD5Implementation();
+        }
+        if (mask & SHA256_DIGEST)
+        {
+            m_sha256 = CreateSha256Implementation();
+        }
+
+        //the first Update tells whether an implementation can take the payload piecewise.
+        m_incremental = mask & CRC32_DIGEST;
+        m_incremental |= (m_md5 && m_md5->Update(nullptr, 0)) ? MD5_DIGEST : 0;
+        m_incremental |= (m_sha256 && m_sha256->Update(nullptr, 0)) ? SHA256_DIGEST : 0;
+    }
+
+    void Feed(const unsigned char* buffer, size_t bufferSize)
+    {
+        if (m_incremental & MD5_DIGEST)
+        {
+            m_md5->Update(buffer, bufferSize);
+        }
+        if (m_incremental & SHA256_DIGEST)
+        {
+            m_sha256->Update(buffer, bufferSize);
+        }
+        if (m_incremental & CRC32_DIGEST)
+        {
+            m_crc32 = Aws::Utils::Crypto::CRC32::Extend(m_crc32, buffer, bufferSize);
+        }
+    }
+
+    unsigned GetMask() const { return m_mask; }
+    unsigned GetIncremental() const { return m_incremental; }
+    const std::shared_ptr<Hash>& GetHash(unsigned digest) const { return digest == MD5_DIGEST ? m_md5 : m_sha256; }
+    uint32_t GetCRC32() const { return m_crc32; }
+
+private:
+    unsigned m_mask;
+    unsigned m_incremental;
+    std::shared_ptr<Hash> m_md5;
+    std::shared_ptr<Hash> m_sha256;
+    uint32_t m_crc32;
+};
+
+const unsigned PayloadDigests::MD5_DIGEST;
+const unsigned PayloadDigests::SHA256_DIGEST;
+const unsigned PayloadDigests::CRC32_DIGEST;
+
+PayloadDigests::PayloadDigests() :
+    m_known(0),
+    m_crc32(0)
+{
+}
+
+void PayloadDigests::Reset()
+{
+    m_known = 0;
+    m_md5 = ByteBuffer();
+    m_sha256 = ByteBuffer();
+    m_crc32 = 0;
+}
+
+bool PayloadDigests::Compute(const unsigned char* buffer, size_t bufferSize, unsigned mask)
+{
+    Pass pass(mask & ~m_known);
+    if (pass.GetMask() == 0)
+    {
+        return true;
+    }
+
+    pass.Feed(buffer, bufferSize);
+    return Finish(pass, nullptr, buffer, bufferSize);
+}
+
+bool PayloadDigests::Compute(Aws::IStream& stream, unsigned mask)
+{
+    Pass pass(mask & ~m_known);
+    if (pass.GetMask() == 0)
+    {
+        return true;
+    }
+
+    if (pass.GetIncremental())
+    {
+        auto currentPos = stream.tellg();
+        stream.seekg(0, stream.beg);
+
+        char streamBuffer[Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE];
+        while (stream.good())
+        {
+            stream.read(streamBuffer, Hash::INTERNAL_HASH_STREAM_BUFFER_SIZE);
+            auto bytesRead = stream.gcount();
+            if (bytesRead > 0)
+            {
+                pass.Feed(reinterpret_cast<const unsigned char*>(streamBuffer), static_cast<size_t>(bytesRead));
+            }
+        }
+
+        bool readWholeStream = stream.eof();
+        stream.clear();
+        stream.seekg(currentPos, stream.beg);
+
+        if (!readWholeStream)
+        {
+            AWS_LOG_ERROR(LOG_TAG, "Failed to read the payload to hash it");
+            return false;
+        }
+    }
+
+    return Finish(pass, &stream, nullptr, 0);
+}
+
+bool PayloadDigests::Finish(Pass& pass, Aws::IStream* stream, const unsigned char* buffer, size_t bufferSize)
+{
+    static const unsigned HASHES[] = { MD5_DIGEST, SHA256_DIGEST };
+
+    bool success = true;
+    for (unsigned digest : HASHES)
+    {
+        if (!(pass.GetMask() & digest))
+        {
+            continue;
+        }
+
+        Hash* hash = pass.GetHash(digest).get();
+        if (!hash)
+        {
+            success = false;
+            continue;
+        }
+
+        HashResult result = (pass.GetIncremental() & digest) ? hash->GetHash() :
+            stream ? hash->Calculate(*stream) : hash->Calculate(Aws::String(reinterpret_cast<const char*>(buffer), bufferSize));
+        if (!result.IsSuccess())
+        {
+            AWS_LOGSTREAM_ERROR(LOG_TAG, "Failed to compute the payload " << (digest == MD5_DIGEST ? "md5" : "sha256"));
+            success = false;
+            continue;
+        }
+
+        (digest == MD5_DIGEST ? m_md5 : m_sha256) = result.GetResult();
+        m_known |= digest;
+    }
+
+    if (pass.GetMask() & CRC32_DIGEST)
+    {
+        m_crc32 = pass.GetCRC32();
+        m_known |= CRC32_DIGEST;
+    }
+
+    return success;
+}
@@ -24,6 +24,7 @@
 #include <bcrypt.h> 
 #include <winternl.h> 
 #include <winerror.h> 
+#include <climits>
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Crypto;
@@ -79,6 +80,7 @@ BCryptHashImpl::BCryptHashImpl(LPCWSTR algorithmName, bool isHMAC) :
     m_hashBuffer(nullptr),
     m_hashObjectLength(0),
     m_hashObject(nullptr),
+    m_runningContext(nullptr),
     m_algorithmMutex()
 {
     NTSTATUS status = BCryptOpenAlgorithmProvider(&m_algorithmHandle, algorithmName, MS_PRIMITIVE_PROVIDER, isHMAC ? BCRYPT_ALG_HANDLE_HMAC_FLAG : 0);
@@ -121,6 +123,7 @@ BCryptHashImpl::BCryptHashImpl(LPCWSTR algorithmName, bool isHMAC) :
 
 BCryptHashImpl::~BCryptHashImpl()
 {
+    Aws::Delete(m_runningContext);
     Aws::DeleteArray(m_hashObject);
     Aws::DeleteArray(m_hashBuffer);
 
@@ -261,6 +264,65 @@ HashResult BCryptHashImpl::Calculate(Aws::IStream& stream)
     return HashResult(ByteBuffer(m_hashBuffer, m_hashBufferLength));
 }
 
+bool BCryptHashImpl::Update(const unsigned char* buffer, size_t bufferSize)
+{
+    if(!IsValid())
+    {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> locker(m_algorithmMutex);
+
+    if (!m_runningContext)
+    {
+        m_runningContext = Aws::New<BCryptHashContext>(logTag, m_algorithmHandle, m_hashObject, m_hashObjectLength);
+        if (!m_runningContext->IsValid())
+        {
+            AWS_LOG_ERROR(logTag, "Error creating hash handle.");
+            Aws::Delete(m_runningContext);
+            m_runningContext = nullptr;
+            return false;
+        }
+    }
+
+    while (bufferSize > 0)
+    {
+        ULONG length = bufferSize < ULONG_MAX ? static_cast<ULONG>(bufferSize) : ULONG_MAX;
+        NTSTATUS status = BCryptHashData(m_runningContext->m_hashHandle, const_cast<PBYTE>(buffer), length, 0);
+        if (!NT_SUCCESS(status))
+        {
+            AWS_LOG_ERROR(logTag, "Error computing hash.");
+            return false;
+        }
+        buffer += length;
+        bufferSize -= length;
+    }
+
+    return true;
+}
+
+HashResult BCryptHashImpl::GetHash()
+{
+    if (!m_runningContext)
+    {
+        //nothing was fed in, which is the digest of an empty message.
+        return Calculate("");
+    }
+
+    std::lock_guard<std::mutex> locker(m_algorithmMutex);
+
+    NTSTATUS status = BCryptFinishHash(m_runningContext->m_hashHandle, m_hashBuffer, m_hashBufferLength, 0);
+    Aws::Delete(m_runningContext);
+    m_runningContext = nullptr;
+    if (!NT_SUCCESS(status))
+    {
+        AWS_LOG_ERROR(logTag, "Error obtaining computed hash");
+        return HashResult();
+    }
+
+    return HashResult(ByteBuffer(m_hashBuffer, m_hashBufferLength));
+}
+
 MD5BcryptImpl::MD5BcryptImpl() :
     m_impl(BCRYPT_MD5_ALGORITHM, false)
 {
@@ -276,6 +338,16 @@ HashResult MD5BcryptImpl::Calculate(Aws::IStream& stream)
     return m_impl.Calculate(stream); 
 }
 
+bool MD5BcryptImpl::Update(const unsigned char* buffer, size_t bufferSize)
+{
+    return m_impl.Update(buffer, bufferSize);
+}
+
+HashResult MD5BcryptImpl::GetHash()
+{
+    return m_impl.GetHash();
+}
+
 Sha256BcryptImpl::Sha256BcryptImpl() :
     m_impl(BCRYPT_SHA256_ALGORITHM, false)
 {
@@ -291,6 +363,16 @@ HashResult Sha256BcryptImpl::Calculate(Aws::IStream& stream)
     return m_impl.Calculate(stream); 
 }
 
+bool Sha256BcryptImpl::Update(const unsigned char* buffer, size_t bufferSize)
+{
+    return m_impl.Update(buffer, bufferSize);
+}
+
+HashResult Sha256BcryptImpl::GetHash()
+{
+    return m_impl.GetHash();
+}
+
 Sha256HMACBcryptImpl::Sha256HMACBcryptImpl() :
     m_impl(BCRYPT_SHA256_ALGORITHM, true)
 {
@@ -15,6 +15,7 @@
 
 #include <aws/core/utils/crypto/commoncrypto/CryptoImpl.h>
 #include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/AWSMemory.h>
 #include <CommonCrypto/CommonDigest.h>
 #include <CommonCrypto/CommonHMAC.h>
 #include <CommonCrypto/CommonCrypto.h>
@@ -23,6 +24,21 @@
 using namespace Aws::Utils;
 using namespace Aws::Utils::Crypto;
 
+static const char* logTag = "CommonCryptoImpl";
+
+//the CommonCrypto update functions take a 32 bit length.
+static const size_t MAX_UPDATE_LENGTH = 0x7FFFFFFF;
+
+MD5CommonCryptoImpl::MD5CommonCryptoImpl() :
+    m_runningContext(nullptr)
+{
+}
+
+MD5CommonCryptoImpl::~MD5CommonCryptoImpl()
+{
+    Aws::Delete(m_runningContext);
+}
+
 HashResult MD5CommonCryptoImpl::Calculate(const Aws::String& str)
 {
     ByteBuffer hash(CC_MD5_DIGEST_LENGTH);
@@ -60,6 +76,49 @@ HashResult MD5CommonCryptoImpl::Calculate(Aws::IStream& stream)
     return HashResult(std::move(hash));
 }
 
+bool MD5CommonCryptoImpl::Update(const unsigned char* buffer, size_t bufferSize)
+{
+    if (!m_runningContext)
+    {
+        m_runningContext = Aws::New<CC_MD5_CTX>(logTag);
+        CC_MD5_Init(m_runningContext);
+    }
+
+    while (bufferSize > 0)
+    {
+        size_t length = bufferSize < MAX_UPDATE_LENGTH ? bufferSize : MAX_UPDATE_LENGTH;
+        CC_MD5_Update(m_runningContext, buffer, static_cast<CC_LONG>(length));
+        buffer += length;
+        bufferSize -= length;
+    }
+    return true;
+}
+
+HashResult MD5CommonCryptoImpl::GetHash()
+{
+    if (!m_runningContext)
+    {
+        //nothing was fed in, which is the digest of an empty message.
+        return Calculate("");
+    }
+
+    ByteBuffer hash(CC_MD5_DIGEST_LENGTH);
+    CC_MD5_Final(hash.GetUnderlyingData(), m_runningContext);
+    CC_MD5_Init(m_runningContext);
+
+    return HashResult(std::move(hash));
+}
+
+Sha256CommonCryptoImpl::Sha256CommonCryptoImpl() :
+    m_runningContext(nullptr)
+{
+}
+
+Sha256CommonCryptoImpl::~Sha256CommonCryptoImpl()
+{
+    Aws::Delete(m_runningContext);
+}
+
 HashResult Sha256CommonCryptoImpl::Calculate(const Aws::String& str)
 {
     ByteBuffer hash(CC_SHA256_DIGEST_LENGTH);
@@ -97,6 +156,39 @@ HashResult Sha256CommonCryptoImpl::Calculate(Aws::IStream& stream)
     return HashResult(std::move(hash));
 }
 
+bool Sha256CommonCryptoImpl::Update(const unsigned char* buffer, size_t bufferSize)
+{
+    if (!m_runningContext)
+    {
+        m_runningContext = Aws::New<CC_SHA256_CTX>(logTag);
+        CC_SHA256_Init(m_runningContext);
+    }
+
+    while (bufferSize > 0)
+    {
+        size_t length = bufferSize < MAX_UPDATE_LENGTH ? bufferSize : MAX_UPDATE_LENGTH;
+        CC_SHA256_Update(m_runningContext, buffer, static_cast<CC_LONG>(length));
+        buffer += length;
+        bufferSize -= length;
+    }
+    return true;
+}
+
+HashResult Sha256CommonCryptoImpl::GetHash()
+{
+    if (!m_runningContext)
+    {
+        //nothing was fed in, which is the digest of an empty message.
+        return Calculate("");
+    }
+
+    ByteBuffer hash(CC_SHA256_DIGEST_LENGTH);
+    CC_SHA256_Final(hash.GetUnderlyingData(), m_runningContext);
+    CC_SHA256_Init(m_runningContext);
+
+    return HashResult(std::move(hash));
+}
+
 HashResult Sha256HMACCommonCryptoImpl::Calculate(const ByteBuffer& toSign, const ByteBuffer& secret)
 {
     unsigned int length = CC_SHA256_DIGEST_LENGTH;
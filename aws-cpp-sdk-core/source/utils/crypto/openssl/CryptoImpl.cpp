@@ -17,6 +17,7 @@
 
 #include <aws/core/utils/crypto/openssl/CryptoImpl.h>
 #include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/memory/AWSMemory.h>
 #include <openssl/md5.h>
 #include <openssl/sha.h>
 #include <openssl/hmac.h>
@@ -24,6 +25,18 @@
 using namespace Aws::Utils;
 using namespace Aws::Utils::Crypto;
 
+static const char* logTag = "OpenSSLCryptoImpl";
+
+MD5OpenSSLImpl::MD5OpenSSLImpl() :
+    m_runningContext(nullptr)
+{
+}
+
+MD5OpenSSLImpl::~MD5OpenSSLImpl()
+{
+    Aws::Delete(m_runningContext);
+}
+
 HashResult MD5OpenSSLImpl::Calculate(const Aws::String& str)
 {
     MD5_CTX md5;
@@ -65,6 +78,42 @@ HashResult MD5OpenSSLImpl::Calculate(Aws::IStream& stream)
     return HashResult(std::move(hash));
 }
 
+bool MD5OpenSSLImpl::Update(const unsigned char* buffer, size_t bufferSize)
+{
+    if (!m_runningContext)
+    {
+        m_runningContext = Aws::New<MD5_CTX>(logTag);
+        MD5_Init(m_runningContext);
+    }
+
+    return MD5_Update(m_runningContext, buffer, bufferSize) == 1;
+}
+
+HashResult MD5OpenSSLImpl::GetHash()
+{
+    if (!m_runningContext)
+    {
+        //nothing was fed in, which is the digest of an empty message.
+        return Calculate("");
+    }
+
+    ByteBuffer hash(MD5_DIGEST_LENGTH);
+    MD5_Final(hash.GetUnderlyingData(), m_runningContext);
+    MD5_Init(m_runningContext);
+
+    return HashResult(std::move(hash));
+}
+
+Sha256OpenSSLImpl::Sha256OpenSSLImpl() :
+    m_runningContext(nullptr)
+{
+}
+
+Sha256OpenSSLImpl::~Sha256OpenSSLImpl()
+{
+    Aws::Delete(m_runningContext);
+}
+
 HashResult Sha256OpenSSLImpl::Calculate(const Aws::String& str)
 {
     SHA256_CTX sha256;
@@ -106,6 +155,32 @@ HashResult Sha256OpenSSLImpl::Calculate(Aws::IStream& stream)
     return HashResult(std::move(hash));
 }
 
+bool Sha256OpenSSLImpl::Update(const unsigned char* buffer, size_t bufferSize)
+{
+    if (!m_runningContext)
+    {
+        m_runningContext = Aws::New<SHA256_CTX>(logTag);
+        SHA256_Init(m_runningContext);
+    }
+
+    return SHA256_Update(m_runningContext, buffer, bufferSize) == 1;
+}
+
+HashResult Sha256OpenSSLImpl::GetHash()
+{
+    if (!m_runningContext)
+    {
+        //nothing was fed in, which is the digest of an empty message.
+        return Calculate("");
+    }
+
+    ByteBuffer hash(SHA256_DIGEST_LENGTH);
+    SHA256_Final(hash.GetUnderlyingData(), m_runningContext);
+    SHA256_Init(m_runningContext);
+
+    return HashResult(std::move(hash));
+}
+
 HashResult Sha256HMACOpenSSLImpl::Calculate(const ByteBuffer& toSign, const ByteBuffer& secret)
 {
     unsigned int length = SHA256_DIGEST_LENGTH;
@@ -14,6 +14,10 @@
   */
 
 #include <aws/core/utils/json/JsonSerializer.h>
+#include <aws/core/utils/stream/ContiguousStreamBuf.h>
+#include <aws/core/utils/stream/ResponseStream.h>
+
+#include <iostream>
 
 using namespace Aws::Utils;
 using namespace Aws::Utils::Json;
@@ -37,7 +41,21 @@ JsonValue::JsonValue(Aws::IStream& istream) : m_wasParseSuccessful(true)
 {
     Aws::External::Json::Reader reader;
 
-    if (!reader.parse(istream, m_value))
+    bool parsed = false;
+    Stream::ContiguousStreamBuf* contiguousBuf = Stream::DefaultUnderlyingStream::GetContiguousStreamBuf(istream);
+    if (contiguousBuf && contiguousBuf->GetData())
+    {
+        //parse straight out of the response buffer instead of copying the body into a string first.
+        const char* begin = contiguousBuf->GetData() + contiguousBuf->GetReadOffset();
+        parsed = reader.parse(begin, contiguousBuf->GetData() + contiguousBuf->GetSize(), m_value);
+        istream.seekg(0, std::ios_base::end);
+    }
+    else
+    {
+        parsed = reader.parse(istream, m_value);
+    }
+
+    if (!parsed)
     {
         m_wasParseSuccessful = false;
         m_errorMessage = reader.getFormattedErrorMessages();
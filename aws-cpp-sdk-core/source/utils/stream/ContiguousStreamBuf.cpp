@@ -0,0 +1,192 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/ContiguousStreamBuf.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <climits>
+#include <cstring>
+
+using namespace Aws::Utils::Stream;
+
+static const char* CONTIGUOUS_STREAM_BUF_TAG = "ContiguousStreamBuf";
+//first allocation for streams that were never reserved, so tiny bodies don't reallocate on every write.
+static const std::size_t MINIMUM_CAPACITY = 1024;
+
+ContiguousStreamBuf::ContiguousStreamBuf() :
+    m_buffer(nullptr),
+    m_capacity(0),
+    m_size(0)
+{
+    setg(nullptr, nullptr, nullptr);
+    setp(nullptr, nullptr);
+}
+
+ContiguousStreamBuf::~ContiguousStreamBuf()
+{
+    if (m_buffer)
+    {
+        Aws::Free(m_buffer);
+    }
+}
+
+std::size_t ContiguousStreamBuf::GetSize() const
+{
+    std::size_t putOffset = static_cast<std::size_t>(pptr() - pbase());
+    return putOffset > m_size ? putOffset : m_size;
+}
+
+void ContiguousStreamBuf::Reserve(std::size_t capacity)
+{
+    if (capacity > m_capacity)
+    {
+        Reallocate(capacity);
+    }
+}
+
+void ContiguousStreamBuf::Reallocate(std::size_t newCapacity)
+{
+    std::size_t readOffset = GetReadOffset();
+    std::size_t putOffset = static_cast<std::size_t>(pptr() - pbase());
+    m_size = GetSize();
+
+    char* newBuffer = reinterpret_cast<char*>(Aws::Malloc(CONTIGUOUS_STREAM_BUF_TAG, newCapacity));
+    if (m_buffer)
+    {
+        std::memcpy(newBuffer, m_buffer, m_size);
+        Aws::Free(m_buffer);
+    }
+
+    m_buffer = newBuffer;
+    m_capacity = newCapacity;
+    setg(m_buffer, m_buffer + readOffset, m_buffer + m_size);
+    SetPutOffset(putOffset);
+}
+
+void ContiguousStreamBuf::SetPutOffset(std::size_t offset)
+{
+    setp(m_buffer, m_buffer + m_capacity);
+    //pbump only takes an int, so walk there in steps for buffers over 2GB.
+    while (offset > 0)
+    {
+        int step = offset > INT_MAX ? INT_MAX : static_cast<int>(offset);
+        pbump(step);
+        offset -= static_cast<std::size_t>(step);
+    }
+}
+
+void ContiguousStreamBuf::ExtendReadArea()
+{
+    m_size = GetSize();
+    setg(m_buffer, gptr(), m_buffer + m_size);
+}
+
+ContiguousStreamBuf::int_type ContiguousStreamBuf::overflow(int_type ch)
+{
+    if (traits_type::eq_int_type(ch, traits_type::eof()))
+    {
+        return traits_type::not_eof(ch);
+    }
+
+    Reallocate(m_capacity < MINIMUM_CAPACITY / 2 ? MINIMUM_CAPACITY : m_capacity * 2);
+    *pptr() = traits_type::to_char_type(ch);
+    pbump(1);
+    return ch;
+}
+
+ContiguousStreamBuf::int_type ContiguousStreamBuf::underflow()
+{
+    ExtendReadArea();
+    return gptr() < egptr() ? traits_type::to_int_type(*gptr()) : traits_type::eof();
+}
+
+std::streamsize ContiguousStreamBuf::xsputn(const char_type* s, std::streamsize n)
+{
+    if (n <= 0)
+    {
+        return 0;
+    }
+
+    std::size_t putOffset = static_cast<std::size_t>(pptr() - pbase());
+    std::size_t required = putOffset + static_cast<std::size_t>(n);
+    if (required > m_capacity)
+    {
+        std::size_t doubled = m_capacity < MINIMUM_CAPACITY / 2 ? MINIMUM_CAPACITY : m_capacity * 2;
+        Reallocate(required > doubled ? required : doubled);
+    }
+
+    std::memcpy(pptr(), s, static_cast<std::size_t>(n));
+    SetPutOffset(required);
+    return n;
+}
+
+std::streamsize ContiguousStreamBuf::xsgetn(char_type* s, std::streamsize n)
+{
+    ExtendReadArea();
+    std::streamsize available = egptr() - gptr();
+    std::streamsize toCopy = n < available ? n : available;
+    if (toCopy > 0)
+    {
+        std::memcpy(s, gptr(), static_cast<std::size_t>(toCopy));
+        setg(eback(), gptr() + toCopy, egptr());
+    }
+    return toCopy;
+}
+
+std::streamsize ContiguousStreamBuf::showmanyc()
+{
+    ExtendReadArea();
+    std::streamsize available = egptr() - gptr();
+    return available > 0 ? available : -1;
+}
+
+ContiguousStreamBuf::pos_type ContiguousStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+    off_type base = 0;
+    if (dir == std::ios_base::cur)
+    {
+        base = (which & std::ios_base::in) ? gptr() - eback() : pptr() - pbase();
+    }
+    else if (dir == std::ios_base::end)
+    {
+        base = static_cast<off_type>(GetSize());
+    }
+
+    return seekpos(pos_type(base + off), which);
+}
+
+ContiguousStreamBuf::pos_type ContiguousStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    //remember how far writes got before the put pointer possibly moves backwards.
+    ExtendReadArea();
+
+    off_type offset = static_cast<off_type>(pos);
+    if (offset < 0 || offset > static_cast<off_type>(m_size))
+    {
+        return pos_type(off_type(-1));
+    }
+
+    if (which & std::ios_base::in)
+    {
+        setg(m_buffer, m_buffer + offset, m_buffer + m_size);
+    }
+
+    if (which & std::ios_base::out)
+    {
+        SetPutOffset(static_cast<std::size_t>(offset));
+    }
+
+    return pos;
+}
@@ -0,0 +1,100 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
+
+#include <climits>
+#include <cstring>
+#include <iostream>
+
+using namespace Aws::Utils::Stream;
+
+//slot in every stream's pword array that a PreallocatedIOStream points at its own buffer.
+static const int PREALLOCATED_STREAM_BUF_INDEX = std::ios_base::xalloc();
+
+PreallocatedStreamBuf::PreallocatedStreamBuf(char* buffer, std::size_t length)
+{
+    setg(buffer, buffer, buffer + length);
+    setp(buffer, buffer + length);
+}
+
+PreallocatedStreamBuf::pos_type PreallocatedStreamBuf::seekoff(off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which)
+{
+    off_type base = 0;
+    if (dir == std::ios_base::cur)
+    {
+        base = (which & std::ios_base::in) ? gptr() - eback() : pptr() - pbase();
+    }
+    else if (dir == std::ios_base::end)
+    {
+        base = egptr() - eback();
+    }
+
+    return seekpos(pos_type(base + off), which);
+}
+
+PreallocatedStreamBuf::pos_type PreallocatedStreamBuf::seekpos(pos_type pos, std::ios_base::openmode which)
+{
+    off_type offset = static_cast<off_type>(pos);
+    if (offset < 0 || offset > egptr() - eback())
+    {
+        return pos_type(off_type(-1));
+    }
+
+    if (which & std::ios_base::in)
+    {
+        setg(eback(), eback() + offset, egptr());
+    }
+
+    if (which & std::ios_base::out)
+    {
+        setp(pbase(), epptr());
+        //pbump only takes an int, so walk there in steps for buffers over 2GB.
+        while (offset > 0)
+        {
+            int step = offset > INT_MAX ? INT_MAX : static_cast<int>(offset);
+            pbump(step);
+            offset -= step;
+        }
+    }
+
+    return pos;
+}
+
+std::streamsize PreallocatedStreamBuf::xsgetn(char_type* s, std::streamsize n)
+{
+    std::streamsize available = egptr() - gptr();
+    std::streamsize toCopy = n < available ? n : available;
+    if (toCopy > 0)
+    {
+        std::memcpy(s, gptr(), static_cast<std::size_t>(toCopy));
+        setg(eback(), gptr() + toCopy, egptr());
+    }
+    return toCopy;
+}
+
+PreallocatedIOStream::PreallocatedIOStream(char* buffer, std::size_t length) :
+    Base(&m_streamBuf),
+    m_streamBuf(buffer, length)
+{
+    pword(PREALLOCATED_STREAM_BUF_INDEX) = &m_streamBuf;
+}
+
+PreallocatedStreamBuf* PreallocatedIOStream::GetPreallocatedStreamBuf(Aws::IOStream& stream)
+{
+    //rdbuf() can be swapped out after construction, so only trust the tag while it still names the current buffer.
+    void* tagged = stream.pword(PREALLOCATED_STREAM_BUF_INDEX);
+    return tagged && tagged == static_cast<void*>(stream.rdbuf()) ? static_cast<PreallocatedStreamBuf*>(tagged) : nullptr;
+}
@@ -14,7 +14,10 @@
   */
 
 #include <aws/core/utils/stream/ResponseStream.h>
-#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/stream/ContiguousStreamBuf.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+
+#include <iostream>
 
 using namespace Aws::Utils::Stream;
 
@@ -65,9 +68,14 @@ void ResponseStream::ReleaseStream()
 
 static const char *DEFAULT_STREAM_TAG = "DefaultUnderlyingStream";
 
+//slot in every stream's pword array that a DefaultUnderlyingStream points at its own buffer.
+static const int CONTIGUOUS_STREAM_BUF_INDEX = std::ios_base::xalloc();
+
 DefaultUnderlyingStream::DefaultUnderlyingStream() :
-    Base( Aws::New< Aws::StringBuf >( DEFAULT_STREAM_TAG ) )
-{}
+    Base( Aws::New< ContiguousStreamBuf >( DEFAULT_STREAM_TAG ) )
+{
+    pword(CONTIGUOUS_STREAM_BUF_INDEX) = static_cast<ContiguousStreamBuf*>(rdbuf());
+}
 
 DefaultUnderlyingStream::~DefaultUnderlyingStream()
 {
@@ -77,6 +85,13 @@ DefaultUnderlyingStream::~DefaultUnderlyingStream()
     }
 }
 
+ContiguousStreamBuf* DefaultUnderlyingStream::GetContiguousStreamBuf(Aws::IStream& stream)
+{
+    //rdbuf() can be swapped out after construction, so only trust the tag while it still names the current buffer.
+    void* tagged = stream.pword(CONTIGUOUS_STREAM_BUF_INDEX);
+    return tagged && tagged == static_cast<void*>(stream.rdbuf()) ? static_cast<ContiguousStreamBuf*>(tagged) : nullptr;
+}
+
 static const char* RESPONSE_STREAM_FACTORY_TAG = "ResponseStreamFactory";
 
 Aws::IOStream* Aws::Utils::Stream::DefaultResponseStreamFactoryMethod() 
@@ -22,7 +22,7 @@ using namespace Aws::Utils::Threading;
 
 bool DefaultExecutor::SubmitToThread(std::function<void()>&&  fx)
 {
-    std::thread t(fx);
+    std::thread t(std::move(fx));
     t.detach();
     return true;
 }
\ No newline at end of file
@@ -0,0 +1,327 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/core/utils/threading/PooledThreadExecutor.h>
+#include <aws/core/utils/memory/AWSMemory.h>
+#include <aws/core/utils/memory/stl/AWSDeque.h>
+
+#include <algorithm>
+#include <thread>
+
+using namespace Aws::Utils::Threading;
+
+static const char* POOLED_THREAD_EXECUTOR_TAG = "PooledThreadExecutor";
+
+class PooledThreadExecutor::Worker
+{
+public:
+    Worker() : active(false) {}
+
+    std::mutex tasksMutex;
+    Aws::Deque<std::function<void()>> tasks;
+    std::thread thread;
+    std::atomic<bool> active;
+};
+
+PooledThreadExecutor::PooledThreadExecutor(size_t poolSize, size_t maxQueuedTasks, OverflowPolicy overflowPolicy) :
+    m_poolSize((std::max)(poolSize, static_cast<size_t>(1))),
+    m_maxPoolSize(m_poolSize),
+    m_idleTimeout(0),
+    m_maxQueuedTasks(maxQueuedTasks),
+    m_overflowPolicy(overflowPolicy),
+    m_activeWorkers(0),
+    m_nextWorker(0),
+    m_queuedTasks(0),
+    m_sleepingWorkers(0),
+    m_wakeups(0),
+    m_blockedSubmitters(0),
+    m_stopping(false)
+{
+    Start();
+}
+
+PooledThreadExecutor::PooledThreadExecutor(size_t poolSize, size_t maxPoolSize, std::chrono::milliseconds idleTimeout,
+    size_t maxQueuedTasks, OverflowPolicy overflowPolicy) :
+    m_poolSize((std::max)(poolSize, static_cast<size_t>(1))),
+    m_maxPoolSize((std::max)(maxPoolSize, m_poolSize)),
+    m_idleTimeout(idleTimeout),
+    m_maxQueuedTasks(maxQueuedTasks),
+    m_overflowPolicy(overflowPolicy),
+    m_activeWorkers(0),
+    m_nextWorker(0),
+    m_queuedTasks(0),
+    m_sleepingWorkers(0),
+    m_wakeups(0),
+    m_blockedSubmitters(0),
+    m_stopping(false)
+{
+    Start();
+}
+
+PooledThreadExecutor::~PooledThreadExecutor()
+{
+    Shutdown();
+
+    for (auto worker : m_workers)
+    {
+        Aws::Delete(worker);
+    }
+}
+
+void PooledThreadExecutor::Start()
+{
+    m_workers.reserve(m_maxPoolSize);
+    for (size_t i = 0; i < m_maxPoolSize; ++i)
+    {
+        m_workers.push_back(Aws::New<Worker>(POOLED_THREAD_EXECUTOR_TAG));
+    }
+
+    for (size_t i = 0; i < m_poolSize; ++i)
+    {
+        SpawnWorker();
+    }
+}
+
+void PooledThreadExecutor::Shutdown()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_stateMutex);
+        m_stopping = true;
+    }
+    m_workAvailable.notify_all();
+    m_spaceAvailable.notify_all();
+
+    //no worker is spawned once m_stopping is set, and retiring workers don't take this lock, so joining under it is safe.
+    std::lock_guard<std::mutex> locker(m_workersMutex);
+    for (auto worker : m_workers)
+    {
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+}
+
+bool PooledThreadExecutor::SubmitToThread(std::function<void()>&& fx)
+{
+    if (!ReserveQueueSlot())
+    {
+        if (m_overflowPolicy == OverflowPolicy::RUN_ON_CALLER && !m_stopping)
+        {
+            fx();
+            return true;
+        }
+        return false;
+    }
+
+    Worker& worker = *m_workers[m_nextWorker++ % (std::max)(m_activeWorkers.load(), static_cast<size_t>(1))];
+    {
+        std::lock_guard<std::mutex> locker(worker.tasksMutex);
+        worker.tasks.push_back(std::move(fx));
+    }
+
+    if (!WakeSleepingWorker() && m_activeWorkers < m_maxPoolSize)
+    {
+        SpawnWorker();
+    }
+
+    return true;
+}
+
+bool PooledThreadExecutor::WakeSleepingWorker()
+{
+    //a worker counts itself as sleeping before it looks at m_queuedTasks one last time, and the task was counted before getting here,
+    //so either that worker sees the task or this sees the worker.
+    if (m_sleepingWorkers == 0)
+    {
+        return false;
+    }
+
+    {
+        std::lock_guard<std::mutex> locker(m_stateMutex);
+        if (m_sleepingWorkers == 0)
+        {
+            return false;
+        }
+        //the sleeper is claimed here rather than when it wakes up, so the next submission doesn't count on the same worker.
+        --m_sleepingWorkers;
+        ++m_wakeups;
+    }
+    m_workAvailable.notify_one();
+    return true;
+}
+
+bool PooledThreadExecutor::ReserveQueueSlot()
+{
+    for (;;)
+    {
+        //the slot is taken before looking at m_stopping; a worker only exits once the queue is empty, so it can't leave a task behind.
+        size_t queued = m_queuedTasks.load();
+        if (m_maxQueuedTasks == 0 || queued < m_maxQueuedTasks)
+        {
+            if (!m_queuedTasks.compare_exchange_weak(queued, queued + 1))
+            {
+                continue;
+            }
+            if (m_stopping)
+            {
+                ReleaseQueueSlot();
+                return false;
+            }
+            return true;
+        }
+
+        if (m_stopping || m_overflowPolicy != OverflowPolicy::BLOCK)
+        {
+            return false;
+        }
+
+        std::unique_lock<std::mutex> locker(m_stateMutex);
+        ++m_blockedSubmitters;
+        m_spaceAvailable.wait(locker, [this] { return m_queuedTasks < m_maxQueuedTasks || m_stopping; });
+        --m_blockedSubmitters;
+    }
+}
+
+void PooledThreadExecutor::ReleaseQueueSlot()
+{
+    --m_queuedTasks;
+
+    if (m_blockedSubmitters > 0)
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_stateMutex);
+        }
+        m_spaceAvailable.notify_one();
+    }
+}
+
+bool PooledThreadExecutor::TakeTask(size_t workerIndex, std::function<void()>& task)
+{
+    //own deque from the front, in submission order.
+    {
+        Worker& self = *m_workers[workerIndex];
+        std::lock_guard<std::mutex> locker(self.tasksMutex);
+        if (!self.tasks.empty())
+        {
+            task = std::move(self.tasks.front());
+            self.tasks.pop_front();
+            ReleaseQueueSlot();
+            return true;
+        }
+    }
+
+    //then steal from the back of the others', which includes slots whose worker has retired since the task was dealt to it.
+    for (size_t i = 1; i < m_workers.size(); ++i)
+    {
+        Worker& victim = *m_workers[(workerIndex + i) % m_workers.size()];
+        std::lock_guard<std::mutex> locker(victim.tasksMutex);
+        if (!victim.tasks.empty())
+        {
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+            ReleaseQueueSlot();
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void PooledThreadExecutor::SpawnWorker()
+{
+    std::lock_guard<std::mutex> locker(m_workersMutex);
+    if (m_stopping || m_activeWorkers >= m_maxPoolSize)
+    {
+        return;
+    }
+
+    //the lowest free slot, so the busy slots stay packed at the front where submissions are dealt.
+    for (size_t i = 0; i < m_workers.size(); ++i)
+    {
+        Worker& worker = *m_workers[i];
+        if (!worker.active)
+        {
+            //a retired worker only has to return from WorkerLoop, so this doesn't wait long.
+            if (worker.thread.joinable())
+            {
+                worker.thread.join();
+            }
+            worker.active = true;
+            ++m_activeWorkers;
+            worker.thread = std::thread(&PooledThreadExecutor::WorkerLoop, this, i);
+            return;
+        }
+    }
+}
+
+void PooledThreadExecutor::WorkerLoop(size_t workerIndex)
+{
+    //only the workers beyond the core pool size time out.
+    bool elastic = workerIndex >= m_poolSize;
+    std::function<void()> task;
+
+    for (;;)
+    {
+        if (TakeTask(workerIndex, task))
+        {
+            task();
+            task = nullptr;
+            continue;
+        }
+
+        std::unique_lock<std::mutex> locker(m_stateMutex);
+        ++m_sleepingWorkers;
+        //a task counted but not pushed yet, or one that was pushed after TakeTask looked.
+        if (m_queuedTasks > 0)
+        {
+            --m_sleepingWorkers;
+            continue;
+        }
+
+        auto woken = [this] { return m_wakeups > 0 || m_stopping; };
+        bool claimed = true;
+        if (elastic)
+        {
+            claimed = m_workAvailable.wait_for(locker, m_idleTimeout, woken);
+        }
+        else
+        {
+            m_workAvailable.wait(locker, woken);
+        }
+
+        if (m_wakeups > 0)
+        {
+            --m_wakeups;
+        }
+        else
+        {
+            --m_sleepingWorkers;
+        }
+
+        //draining: a reserved task may still be on its way into a deque, so keep going until the count drops to zero.
+        if (m_stopping && m_queuedTasks == 0)
+        {
+            break;
+        }
+
+        if (!claimed)
+        {
+            m_workers[workerIndex]->active = false;
+            --m_activeWorkers;
+            break;
+        }
+    }
+}
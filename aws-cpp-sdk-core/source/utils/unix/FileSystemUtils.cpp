@@ -91,3 +91,22 @@ bool FileSystemUtils::RelocateFileOrDirectory(const char* from, const char* to)
     AWS_LOGSTREAM_DEBUG(LOG_TAG,  "The moving operation of file at " << from << " to " << to << " Returned error code of " << errno);
     return errorCode == 0;
 }
+
+FileStamp FileSystemUtils::GetFileStamp(const char* fileName)
+{
+    FileStamp stamp;
+    struct stat fileInfo;
+    if (stat(fileName, &fileInfo) == 0)
+    {
+        stamp.exists = true;
+#if defined(__APPLE__)
+        stamp.modifiedTimeNs = static_cast<long long>(fileInfo.st_mtimespec.tv_sec) * 1000000000LL + fileInfo.st_mtimespec.tv_nsec;
+#else
+        stamp.modifiedTimeNs = static_cast<long long>(fileInfo.st_mtim.tv_sec) * 1000000000LL + fileInfo.st_mtim.tv_nsec;
+#endif // __APPLE__
+        stamp.inode = static_cast<unsigned long long>(fileInfo.st_ino);
+        stamp.size = static_cast<long long>(fileInfo.st_size);
+    }
+
+    return stamp;
+}
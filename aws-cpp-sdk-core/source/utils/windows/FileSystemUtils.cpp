@@ -17,6 +17,8 @@
 #include <aws/core/utils/StringUtils.h>
 
 #include <Userenv.h>
+#include <sys/types.h>
+#include <sys/stat.h>
 
 #pragma warning( disable : 4996)
 
@@ -112,4 +114,18 @@ bool FileSystemUtils::RelocateFileOrDirectory(const char* from, const char* to)
         AWS_LOGSTREAM_DEBUG(LOG_TAG,  "The moving operation of file at " << from << " to " << to << " Returned error code of " << errorCode);
         return false;
     }
-}
\ No newline at end of file
+}
+
+FileStamp FileSystemUtils::GetFileStamp(const char* fileName)
+{
+    FileStamp stamp;
+    struct _stat64 fileInfo;
+    if (_stat64(fileName, &fileInfo) == 0)
+    {
+        stamp.exists = true;
+        stamp.modifiedTimeNs = static_cast<long long>(fileInfo.st_mtime) * 1000000000LL;
+        stamp.size = static_cast<long long>(fileInfo.st_size);
+    }
+
+    return stamp;
+}
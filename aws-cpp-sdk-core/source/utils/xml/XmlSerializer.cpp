@@ -16,6 +16,8 @@
 #include <aws/core/utils/xml/XmlSerializer.h>
 
 #include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/stream/ContiguousStreamBuf.h>
+#include <aws/core/utils/stream/ResponseStream.h>
 #include <aws/core/external/tinyxml2/tinyxml2.h>
 
 #include <utility>
@@ -206,6 +208,17 @@ Aws::String XmlDocument::ConvertToString() const
 
 XmlDocument XmlDocument::CreateFromXmlStream(Aws::IOStream& xmlStream)
 {
+    Stream::ContiguousStreamBuf* contiguousBuf = Stream::DefaultUnderlyingStream::GetContiguousStreamBuf(xmlStream);
+    if (contiguousBuf && contiguousBuf->GetData())
+    {
+        //parse straight out of the response buffer instead of copying the body into a string first.
+        XmlDocument xmlDocument;
+        std::size_t readOffset = contiguousBuf->GetReadOffset();
+        xmlDocument.m_doc->Parse(contiguousBuf->GetData() + readOffset, contiguousBuf->GetSize() - readOffset);
+        xmlStream.seekg(0, std::ios_base::end);
+        return xmlDocument;
+    }
+
     Aws::String xmlString((Aws::IStreamBufIterator(xmlStream)), Aws::IStreamBufIterator());
     return CreateFromXmlString(xmlString);
 }
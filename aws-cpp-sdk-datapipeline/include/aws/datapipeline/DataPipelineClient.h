@@ -40,6 +40,29 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/datapipeline/model/ActivatePipelineRequest.h>
+#include <aws/datapipeline/model/AddTagsRequest.h>
+#include <aws/datapipeline/model/CreatePipelineRequest.h>
+#include <aws/datapipeline/model/DeactivatePipelineRequest.h>
+#include <aws/datapipeline/model/DeletePipelineRequest.h>
+#include <aws/datapipeline/model/DescribeObjectsRequest.h>
+#include <aws/datapipeline/model/DescribePipelinesRequest.h>
+#include <aws/datapipeline/model/EvaluateExpressionRequest.h>
+#include <aws/datapipeline/model/GetPipelineDefinitionRequest.h>
+#include <aws/datapipeline/model/ListPipelinesRequest.h>
+#include <aws/datapipeline/model/PollForTaskRequest.h>
+#include <aws/datapipeline/model/PutPipelineDefinitionRequest.h>
+#include <aws/datapipeline/model/QueryObjectsRequest.h>
+#include <aws/datapipeline/model/RemoveTagsRequest.h>
+#include <aws/datapipeline/model/ReportTaskProgressRequest.h>
+#include <aws/datapipeline/model/ReportTaskRunnerHeartbeatRequest.h>
+#include <aws/datapipeline/model/SetStatusRequest.h>
+#include <aws/datapipeline/model/SetTaskStatusRequest.h>
+#include <aws/datapipeline/model/ValidatePipelineDefinitionRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -233,6 +256,11 @@ namespace Model
          */
         virtual Model::ActivatePipelineOutcomeCallable ActivatePipelineCallable(const Model::ActivatePipelineRequest& request) const;
 
+        /**
+         * Same as ActivatePipelineCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ActivatePipelineOutcomeCallable ActivatePipelineCallable(Model::ActivatePipelineRequest&& request) const;
+
         /**
          * <p>Validates the specified pipeline and starts processing pipeline tasks. If the
          * pipeline does not pass validation, activation fails.</p> <p>If you need to pause
@@ -244,6 +272,11 @@ namespace Model
          */
         virtual void ActivatePipelineAsync(const Model::ActivatePipelineRequest& request, const ActivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ActivatePipelineAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ActivatePipelineAsync(Model::ActivatePipelineRequest&& request, const ActivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds or modifies tags for the specified pipeline.</p>
          */
@@ -256,6 +289,11 @@ namespace Model
          */
         virtual Model::AddTagsOutcomeCallable AddTagsCallable(const Model::AddTagsRequest& request) const;
 
+        /**
+         * Same as AddTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddTagsOutcomeCallable AddTagsCallable(Model::AddTagsRequest&& request) const;
+
         /**
          * <p>Adds or modifies tags for the specified pipeline.</p>
          *
@@ -263,6 +301,11 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddTagsAsync(Model::AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new, empty pipeline. Use <a>PutPipelineDefinition</a> to populate
          * the pipeline.</p>
@@ -277,6 +320,11 @@ namespace Model
          */
         virtual Model::CreatePipelineOutcomeCallable CreatePipelineCallable(const Model::CreatePipelineRequest& request) const;
 
+        /**
+         * Same as CreatePipelineCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePipelineOutcomeCallable CreatePipelineCallable(Model::CreatePipelineRequest&& request) const;
+
         /**
          * <p>Creates a new, empty pipeline. Use <a>PutPipelineDefinition</a> to populate
          * the pipeline.</p>
@@ -285,6 +333,11 @@ namespace Model
          */
         virtual void CreatePipelineAsync(const Model::CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePipelineAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePipelineAsync(Model::CreatePipelineRequest&& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deactivates the specified running pipeline. The pipeline is set to the
          * <code>DEACTIVATING</code> state until the deactivation process completes.</p>
@@ -305,6 +358,11 @@ namespace Model
          */
         virtual Model::DeactivatePipelineOutcomeCallable DeactivatePipelineCallable(const Model::DeactivatePipelineRequest& request) const;
 
+        /**
+         * Same as DeactivatePipelineCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeactivatePipelineOutcomeCallable DeactivatePipelineCallable(Model::DeactivatePipelineRequest&& request) const;
+
         /**
          * <p>Deactivates the specified running pipeline. The pipeline is set to the
          * <code>DEACTIVATING</code> state until the deactivation process completes.</p>
@@ -316,6 +374,11 @@ namespace Model
          */
         virtual void DeactivatePipelineAsync(const Model::DeactivatePipelineRequest& request, const DeactivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeactivatePipelineAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeactivatePipelineAsync(Model::DeactivatePipelineRequest&& request, const DeactivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a pipeline, its pipeline definition, and its run history. AWS Data
          * Pipeline attempts to cancel instances associated with the pipeline that are
@@ -340,6 +403,11 @@ namespace Model
          */
         virtual Model::DeletePipelineOutcomeCallable DeletePipelineCallable(const Model::DeletePipelineRequest& request) const;
 
+        /**
+         * Same as DeletePipelineCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeletePipelineOutcomeCallable DeletePipelineCallable(Model::DeletePipelineRequest&& request) const;
+
         /**
          * <p>Deletes a pipeline, its pipeline definition, and its run history. AWS Data
          * Pipeline attempts to cancel instances associated with the pipeline that are
@@ -353,6 +421,11 @@ namespace Model
          */
         virtual void DeletePipelineAsync(const Model::DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePipelineAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeletePipelineAsync(Model::DeletePipelineRequest&& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the object definitions for a set of objects associated with the
          * pipeline. Object definitions are composed of a set of fields that define the
@@ -369,6 +442,11 @@ namespace Model
          */
         virtual Model::DescribeObjectsOutcomeCallable DescribeObjectsCallable(const Model::DescribeObjectsRequest& request) const;
 
+        /**
+         * Same as DescribeObjectsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeObjectsOutcomeCallable DescribeObjectsCallable(Model::DescribeObjectsRequest&& request) const;
+
         /**
          * <p>Gets the object definitions for a set of objects associated with the
          * pipeline. Object definitions are composed of a set of fields that define the
@@ -378,6 +456,11 @@ namespace Model
          */
         virtual void DescribeObjectsAsync(const Model::DescribeObjectsRequest& request, const DescribeObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeObjectsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeObjectsAsync(Model::DescribeObjectsRequest&& request, const DescribeObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves metadata about one or more pipelines. The information retrieved
          * includes the name of the pipeline, the pipeline identifier, its current state,
@@ -404,6 +487,11 @@ namespace Model
          */
         virtual Model::DescribePipelinesOutcomeCallable DescribePipelinesCallable(const Model::DescribePipelinesRequest& request) const;
 
+        /**
+         * Same as DescribePipelinesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribePipelinesOutcomeCallable DescribePipelinesCallable(Model::DescribePipelinesRequest&& request) const;
+
         /**
          * <p>Retrieves metadata about one or more pipelines. The information retrieved
          * includes the name of the pipeline, the pipeline identifier, its current state,
@@ -418,6 +506,11 @@ namespace Model
          */
         virtual void DescribePipelinesAsync(const Model::DescribePipelinesRequest& request, const DescribePipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribePipelinesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribePipelinesAsync(Model::DescribePipelinesRequest&& request, const DescribePipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Task runners call <code>EvaluateExpression</code> to evaluate a string in the
          * context of the specified object. For example, a task runner can evaluate SQL
@@ -434,6 +527,11 @@ namespace Model
          */
         virtual Model::EvaluateExpressionOutcomeCallable EvaluateExpressionCallable(const Model::EvaluateExpressionRequest& request) const;
 
+        /**
+         * Same as EvaluateExpressionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EvaluateExpressionOutcomeCallable EvaluateExpressionCallable(Model::EvaluateExpressionRequest&& request) const;
+
         /**
          * <p>Task runners call <code>EvaluateExpression</code> to evaluate a string in the
          * context of the specified object. For example, a task runner can evaluate SQL
@@ -443,6 +541,11 @@ namespace Model
          */
         virtual void EvaluateExpressionAsync(const Model::EvaluateExpressionRequest& request, const EvaluateExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EvaluateExpressionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EvaluateExpressionAsync(Model::EvaluateExpressionRequest&& request, const EvaluateExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the definition of the specified pipeline. You can call
          * <code>GetPipelineDefinition</code> to retrieve the pipeline definition that you
@@ -459,6 +562,11 @@ namespace Model
          */
         virtual Model::GetPipelineDefinitionOutcomeCallable GetPipelineDefinitionCallable(const Model::GetPipelineDefinitionRequest& request) const;
 
+        /**
+         * Same as GetPipelineDefinitionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetPipelineDefinitionOutcomeCallable GetPipelineDefinitionCallable(Model::GetPipelineDefinitionRequest&& request) const;
+
         /**
          * <p>Gets the definition of the specified pipeline. You can call
          * <code>GetPipelineDefinition</code> to retrieve the pipeline definition that you
@@ -468,6 +576,11 @@ namespace Model
          */
         virtual void GetPipelineDefinitionAsync(const Model::GetPipelineDefinitionRequest& request, const GetPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPipelineDefinitionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetPipelineDefinitionAsync(Model::GetPipelineDefinitionRequest&& request, const GetPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the pipeline identifiers for all active pipelines that you have
          * permission to access.</p>
@@ -482,6 +595,11 @@ namespace Model
          */
         virtual Model::ListPipelinesOutcomeCallable ListPipelinesCallable(const Model::ListPipelinesRequest& request) const;
 
+        /**
+         * Same as ListPipelinesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListPipelinesOutcomeCallable ListPipelinesCallable(Model::ListPipelinesRequest&& request) const;
+
         /**
          * <p>Lists the pipeline identifiers for all active pipelines that you have
          * permission to access.</p>
@@ -490,6 +608,11 @@ namespace Model
          */
         virtual void ListPipelinesAsync(const Model::ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPipelinesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListPipelinesAsync(Model::ListPipelinesRequest&& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Task runners call <code>PollForTask</code> to receive a task to perform from
          * AWS Data Pipeline. The task runner specifies which tasks it can perform by
@@ -526,6 +649,11 @@ namespace Model
          */
         virtual Model::PollForTaskOutcomeCallable PollForTaskCallable(const Model::PollForTaskRequest& request) const;
 
+        /**
+         * Same as PollForTaskCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PollForTaskOutcomeCallable PollForTaskCallable(Model::PollForTaskRequest&& request) const;
+
         /**
          * <p>Task runners call <code>PollForTask</code> to receive a task to perform from
          * AWS Data Pipeline. The task runner specifies which tasks it can perform by
@@ -545,6 +673,11 @@ namespace Model
          */
         virtual void PollForTaskAsync(const Model::PollForTaskRequest& request, const PollForTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PollForTaskAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PollForTaskAsync(Model::PollForTaskRequest&& request, const PollForTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds tasks, schedules, and preconditions to the specified pipeline. You can
          * use <code>PutPipelineDefinition</code> to populate a new pipeline.</p> <p>
@@ -577,6 +710,11 @@ namespace Model
          */
         virtual Model::PutPipelineDefinitionOutcomeCallable PutPipelineDefinitionCallable(const Model::PutPipelineDefinitionRequest& request) const;
 
+        /**
+         * Same as PutPipelineDefinitionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutPipelineDefinitionOutcomeCallable PutPipelineDefinitionCallable(Model::PutPipelineDefinitionRequest&& request) const;
+
         /**
          * <p>Adds tasks, schedules, and preconditions to the specified pipeline. You can
          * use <code>PutPipelineDefinition</code> to populate a new pipeline.</p> <p>
@@ -594,6 +732,11 @@ namespace Model
          */
         virtual void PutPipelineDefinitionAsync(const Model::PutPipelineDefinitionRequest& request, const PutPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutPipelineDefinitionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutPipelineDefinitionAsync(Model::PutPipelineDefinitionRequest&& request, const PutPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Queries the specified pipeline for the names of objects that match the
          * specified set of conditions.</p>
@@ -608,6 +751,11 @@ namespace Model
          */
         virtual Model::QueryObjectsOutcomeCallable QueryObjectsCallable(const Model::QueryObjectsRequest& request) const;
 
+        /**
+         * Same as QueryObjectsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::QueryObjectsOutcomeCallable QueryObjectsCallable(Model::QueryObjectsRequest&& request) const;
+
         /**
          * <p>Queries the specified pipeline for the names of objects that match the
          * specified set of conditions.</p>
@@ -616,6 +764,11 @@ namespace Model
          */
         virtual void QueryObjectsAsync(const Model::QueryObjectsRequest& request, const QueryObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as QueryObjectsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void QueryObjectsAsync(Model::QueryObjectsRequest&& request, const QueryObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes existing tags from the specified pipeline.</p>
          */
@@ -628,6 +781,11 @@ namespace Model
          */
         virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(const Model::RemoveTagsRequest& request) const;
 
+        /**
+         * Same as RemoveTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(Model::RemoveTagsRequest&& request) const;
+
         /**
          * <p>Removes existing tags from the specified pipeline.</p>
          *
@@ -635,6 +793,11 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveTagsAsync(Model::RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Task runners call <code>ReportTaskProgress</code> when assigned a task to
          * acknowledge that it has the task. If the web service does not receive this
@@ -667,6 +830,11 @@ namespace Model
          */
         virtual Model::ReportTaskProgressOutcomeCallable ReportTaskProgressCallable(const Model::ReportTaskProgressRequest& request) const;
 
+        /**
+         * Same as ReportTaskProgressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReportTaskProgressOutcomeCallable ReportTaskProgressCallable(Model::ReportTaskProgressRequest&& request) const;
+
         /**
          * <p>Task runners call <code>ReportTaskProgress</code> when assigned a task to
          * acknowledge that it has the task. If the web service does not receive this
@@ -684,6 +852,11 @@ namespace Model
          */
         virtual void ReportTaskProgressAsync(const Model::ReportTaskProgressRequest& request, const ReportTaskProgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReportTaskProgressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReportTaskProgressAsync(Model::ReportTaskProgressRequest&& request, const ReportTaskProgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Task runners call <code>ReportTaskRunnerHeartbeat</code> every 15 minutes to
          * indicate that they are operational. If the AWS Data Pipeline Task Runner is
@@ -704,6 +877,11 @@ namespace Model
          */
         virtual Model::ReportTaskRunnerHeartbeatOutcomeCallable ReportTaskRunnerHeartbeatCallable(const Model::ReportTaskRunnerHeartbeatRequest& request) const;
 
+        /**
+         * Same as ReportTaskRunnerHeartbeatCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReportTaskRunnerHeartbeatOutcomeCallable ReportTaskRunnerHeartbeatCallable(Model::ReportTaskRunnerHeartbeatRequest&& request) const;
+
         /**
          * <p>Task runners call <code>ReportTaskRunnerHeartbeat</code> every 15 minutes to
          * indicate that they are operational. If the AWS Data Pipeline Task Runner is
@@ -715,6 +893,11 @@ namespace Model
          */
         virtual void ReportTaskRunnerHeartbeatAsync(const Model::ReportTaskRunnerHeartbeatRequest& request, const ReportTaskRunnerHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReportTaskRunnerHeartbeatAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReportTaskRunnerHeartbeatAsync(Model::ReportTaskRunnerHeartbeatRequest&& request, const ReportTaskRunnerHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests that the status of the specified physical or logical pipeline
          * objects be updated in the specified pipeline. This update might not occur
@@ -737,6 +920,11 @@ namespace Model
          */
         virtual Model::SetStatusOutcomeCallable SetStatusCallable(const Model::SetStatusRequest& request) const;
 
+        /**
+         * Same as SetStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetStatusOutcomeCallable SetStatusCallable(Model::SetStatusRequest&& request) const;
+
         /**
          * <p>Requests that the status of the specified physical or logical pipeline
          * objects be updated in the specified pipeline. This update might not occur
@@ -749,6 +937,11 @@ namespace Model
          */
         virtual void SetStatusAsync(const Model::SetStatusRequest& request, const SetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetStatusAsync(Model::SetStatusRequest&& request, const SetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Task runners call <code>SetTaskStatus</code> to notify AWS Data Pipeline that
          * a task is completed and provide information about the final status. A task
@@ -769,6 +962,11 @@ namespace Model
          */
         virtual Model::SetTaskStatusOutcomeCallable SetTaskStatusCallable(const Model::SetTaskStatusRequest& request) const;
 
+        /**
+         * Same as SetTaskStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetTaskStatusOutcomeCallable SetTaskStatusCallable(Model::SetTaskStatusRequest&& request) const;
+
         /**
          * <p>Task runners call <code>SetTaskStatus</code> to notify AWS Data Pipeline that
          * a task is completed and provide information about the final status. A task
@@ -780,6 +978,11 @@ namespace Model
          */
         virtual void SetTaskStatusAsync(const Model::SetTaskStatusRequest& request, const SetTaskStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetTaskStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetTaskStatusAsync(Model::SetTaskStatusRequest&& request, const SetTaskStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Validates the specified pipeline definition to ensure that it is well formed
          * and can be run without error.</p>
@@ -794,6 +997,11 @@ namespace Model
          */
         virtual Model::ValidatePipelineDefinitionOutcomeCallable ValidatePipelineDefinitionCallable(const Model::ValidatePipelineDefinitionRequest& request) const;
 
+        /**
+         * Same as ValidatePipelineDefinitionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ValidatePipelineDefinitionOutcomeCallable ValidatePipelineDefinitionCallable(Model::ValidatePipelineDefinitionRequest&& request) const;
+
         /**
          * <p>Validates the specified pipeline definition to ensure that it is well formed
          * and can be run without error.</p>
@@ -802,6 +1010,56 @@ namespace Model
          */
         virtual void ValidatePipelineDefinitionAsync(const Model::ValidatePipelineDefinitionRequest& request, const ValidatePipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ValidatePipelineDefinitionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ValidatePipelineDefinitionAsync(Model::ValidatePipelineDefinitionRequest&& request, const ValidatePipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::ActivatePipelineOutcome> ActivatePipelineAwaitable(const Model::ActivatePipelineRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::ActivatePipeline, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ActivatePipelineOutcome> ActivatePipelineAwaitable(Model::ActivatePipelineRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::ActivatePipeline, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsOutcome> AddTagsAwaitable(const Model::AddTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::AddTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsOutcome> AddTagsAwaitable(Model::AddTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::AddTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePipelineOutcome> CreatePipelineAwaitable(const Model::CreatePipelineRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::CreatePipeline, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePipelineOutcome> CreatePipelineAwaitable(Model::CreatePipelineRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::CreatePipeline, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeactivatePipelineOutcome> DeactivatePipelineAwaitable(const Model::DeactivatePipelineRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::DeactivatePipeline, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeactivatePipelineOutcome> DeactivatePipelineAwaitable(Model::DeactivatePipelineRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::DeactivatePipeline, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePipelineOutcome> DeletePipelineAwaitable(const Model::DeletePipelineRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::DeletePipeline, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePipelineOutcome> DeletePipelineAwaitable(Model::DeletePipelineRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::DeletePipeline, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeObjectsOutcome> DescribeObjectsAwaitable(const Model::DescribeObjectsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::DescribeObjects, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeObjectsOutcome> DescribeObjectsAwaitable(Model::DescribeObjectsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::DescribeObjects, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribePipelinesOutcome> DescribePipelinesAwaitable(const Model::DescribePipelinesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::DescribePipelines, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribePipelinesOutcome> DescribePipelinesAwaitable(Model::DescribePipelinesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::DescribePipelines, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EvaluateExpressionOutcome> EvaluateExpressionAwaitable(const Model::EvaluateExpressionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::EvaluateExpression, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EvaluateExpressionOutcome> EvaluateExpressionAwaitable(Model::EvaluateExpressionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::EvaluateExpression, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPipelineDefinitionOutcome> GetPipelineDefinitionAwaitable(const Model::GetPipelineDefinitionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::GetPipelineDefinition, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPipelineDefinitionOutcome> GetPipelineDefinitionAwaitable(Model::GetPipelineDefinitionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::GetPipelineDefinition, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPipelinesOutcome> ListPipelinesAwaitable(const Model::ListPipelinesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::ListPipelines, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPipelinesOutcome> ListPipelinesAwaitable(Model::ListPipelinesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::ListPipelines, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PollForTaskOutcome> PollForTaskAwaitable(const Model::PollForTaskRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::PollForTask, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PollForTaskOutcome> PollForTaskAwaitable(Model::PollForTaskRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::PollForTask, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutPipelineDefinitionOutcome> PutPipelineDefinitionAwaitable(const Model::PutPipelineDefinitionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::PutPipelineDefinition, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutPipelineDefinitionOutcome> PutPipelineDefinitionAwaitable(Model::PutPipelineDefinitionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::PutPipelineDefinition, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::QueryObjectsOutcome> QueryObjectsAwaitable(const Model::QueryObjectsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::QueryObjects, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::QueryObjectsOutcome> QueryObjectsAwaitable(Model::QueryObjectsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::QueryObjects, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(const Model::RemoveTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::RemoveTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(Model::RemoveTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::RemoveTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReportTaskProgressOutcome> ReportTaskProgressAwaitable(const Model::ReportTaskProgressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::ReportTaskProgress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReportTaskProgressOutcome> ReportTaskProgressAwaitable(Model::ReportTaskProgressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::ReportTaskProgress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReportTaskRunnerHeartbeatOutcome> ReportTaskRunnerHeartbeatAwaitable(const Model::ReportTaskRunnerHeartbeatRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::ReportTaskRunnerHeartbeat, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReportTaskRunnerHeartbeatOutcome> ReportTaskRunnerHeartbeatAwaitable(Model::ReportTaskRunnerHeartbeatRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::ReportTaskRunnerHeartbeat, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetStatusOutcome> SetStatusAwaitable(const Model::SetStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::SetStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetStatusOutcome> SetStatusAwaitable(Model::SetStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::SetStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetTaskStatusOutcome> SetTaskStatusAwaitable(const Model::SetTaskStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::SetTaskStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetTaskStatusOutcome> SetTaskStatusAwaitable(Model::SetTaskStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::SetTaskStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ValidatePipelineDefinitionOutcome> ValidatePipelineDefinitionAwaitable(const Model::ValidatePipelineDefinitionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::ValidatePipelineDefinition, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ValidatePipelineDefinitionOutcome> ValidatePipelineDefinitionAwaitable(Model::ValidatePipelineDefinitionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DataPipelineClient::ValidatePipelineDefinition, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -126,12 +126,22 @@ ActivatePipelineOutcome DataPipelineClient::ActivatePipeline(const ActivatePipel
 
 ActivatePipelineOutcomeCallable DataPipelineClient::ActivatePipelineCallable(const ActivatePipelineRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::ActivatePipeline, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::ActivatePipeline, Aws::Client::RejectedCallOutcome<ActivatePipelineOutcome>(), this, request);
+}
+
+ActivatePipelineOutcomeCallable DataPipelineClient::ActivatePipelineCallable(ActivatePipelineRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::ActivatePipeline, Aws::Client::RejectedCallOutcome<ActivatePipelineOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::ActivatePipelineAsync(const ActivatePipelineRequest& request, const ActivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::ActivatePipelineAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::ActivatePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<ActivatePipelineOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::ActivatePipelineAsync(ActivatePipelineRequest&& request, const ActivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::ActivatePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<ActivatePipelineOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::ActivatePipelineAsyncHelper(const ActivatePipelineRequest& request, const ActivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -157,12 +167,22 @@ AddTagsOutcome DataPipelineClient::AddTags(const AddTagsRequest& request) const
 
 AddTagsOutcomeCallable DataPipelineClient::AddTagsCallable(const AddTagsRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::AddTags, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::AddTags, Aws::Client::RejectedCallOutcome<AddTagsOutcome>(), this, request);
+}
+
+AddTagsOutcomeCallable DataPipelineClient::AddTagsCallable(AddTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::AddTags, Aws::Client::RejectedCallOutcome<AddTagsOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::AddTagsAsync(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::AddTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::AddTagsAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::AddTagsAsync(AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::AddTagsAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::AddTagsAsyncHelper(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -188,12 +208,22 @@ CreatePipelineOutcome DataPipelineClient::CreatePipeline(const CreatePipelineReq
 
 CreatePipelineOutcomeCallable DataPipelineClient::CreatePipelineCallable(const CreatePipelineRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::CreatePipeline, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::CreatePipeline, Aws::Client::RejectedCallOutcome<CreatePipelineOutcome>(), this, request);
+}
+
+CreatePipelineOutcomeCallable DataPipelineClient::CreatePipelineCallable(CreatePipelineRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::CreatePipeline, Aws::Client::RejectedCallOutcome<CreatePipelineOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::CreatePipelineAsync(const CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::CreatePipelineAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::CreatePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePipelineOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::CreatePipelineAsync(CreatePipelineRequest&& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::CreatePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePipelineOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::CreatePipelineAsyncHelper(const CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -219,12 +249,22 @@ DeactivatePipelineOutcome DataPipelineClient::DeactivatePipeline(const Deactivat
 
 DeactivatePipelineOutcomeCallable DataPipelineClient::DeactivatePipelineCallable(const DeactivatePipelineRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::DeactivatePipeline, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::DeactivatePipeline, Aws::Client::RejectedCallOutcome<DeactivatePipelineOutcome>(), this, request);
+}
+
+DeactivatePipelineOutcomeCallable DataPipelineClient::DeactivatePipelineCallable(DeactivatePipelineRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::DeactivatePipeline, Aws::Client::RejectedCallOutcome<DeactivatePipelineOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::DeactivatePipelineAsync(const DeactivatePipelineRequest& request, const DeactivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::DeactivatePipelineAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::DeactivatePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<DeactivatePipelineOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::DeactivatePipelineAsync(DeactivatePipelineRequest&& request, const DeactivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::DeactivatePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<DeactivatePipelineOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::DeactivatePipelineAsyncHelper(const DeactivatePipelineRequest& request, const DeactivatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -250,12 +290,22 @@ DeletePipelineOutcome DataPipelineClient::DeletePipeline(const DeletePipelineReq
 
 DeletePipelineOutcomeCallable DataPipelineClient::DeletePipelineCallable(const DeletePipelineRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::DeletePipeline, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::DeletePipeline, Aws::Client::RejectedCallOutcome<DeletePipelineOutcome>(), this, request);
+}
+
+DeletePipelineOutcomeCallable DataPipelineClient::DeletePipelineCallable(DeletePipelineRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::DeletePipeline, Aws::Client::RejectedCallOutcome<DeletePipelineOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::DeletePipelineAsync(const DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::DeletePipelineAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::DeletePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePipelineOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::DeletePipelineAsync(DeletePipelineRequest&& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::DeletePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePipelineOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::DeletePipelineAsyncHelper(const DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -281,12 +331,22 @@ DescribeObjectsOutcome DataPipelineClient::DescribeObjects(const DescribeObjects
 
 DescribeObjectsOutcomeCallable DataPipelineClient::DescribeObjectsCallable(const DescribeObjectsRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::DescribeObjects, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::DescribeObjects, Aws::Client::RejectedCallOutcome<DescribeObjectsOutcome>(), this, request);
+}
+
+DescribeObjectsOutcomeCallable DataPipelineClient::DescribeObjectsCallable(DescribeObjectsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::DescribeObjects, Aws::Client::RejectedCallOutcome<DescribeObjectsOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::DescribeObjectsAsync(const DescribeObjectsRequest& request, const DescribeObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::DescribeObjectsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::DescribeObjectsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeObjectsOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::DescribeObjectsAsync(DescribeObjectsRequest&& request, const DescribeObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::DescribeObjectsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeObjectsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::DescribeObjectsAsyncHelper(const DescribeObjectsRequest& request, const DescribeObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -312,12 +372,22 @@ DescribePipelinesOutcome DataPipelineClient::DescribePipelines(const DescribePip
 
 DescribePipelinesOutcomeCallable DataPipelineClient::DescribePipelinesCallable(const DescribePipelinesRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::DescribePipelines, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::DescribePipelines, Aws::Client::RejectedCallOutcome<DescribePipelinesOutcome>(), this, request);
+}
+
+DescribePipelinesOutcomeCallable DataPipelineClient::DescribePipelinesCallable(DescribePipelinesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::DescribePipelines, Aws::Client::RejectedCallOutcome<DescribePipelinesOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::DescribePipelinesAsync(const DescribePipelinesRequest& request, const DescribePipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::DescribePipelinesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::DescribePipelinesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribePipelinesOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::DescribePipelinesAsync(DescribePipelinesRequest&& request, const DescribePipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::DescribePipelinesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribePipelinesOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::DescribePipelinesAsyncHelper(const DescribePipelinesRequest& request, const DescribePipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -343,12 +413,22 @@ EvaluateExpressionOutcome DataPipelineClient::EvaluateExpression(const EvaluateE
 
 EvaluateExpressionOutcomeCallable DataPipelineClient::EvaluateExpressionCallable(const EvaluateExpressionRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::EvaluateExpression, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::EvaluateExpression, Aws::Client::RejectedCallOutcome<EvaluateExpressionOutcome>(), this, request);
+}
+
+EvaluateExpressionOutcomeCallable DataPipelineClient::EvaluateExpressionCallable(EvaluateExpressionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::EvaluateExpression, Aws::Client::RejectedCallOutcome<EvaluateExpressionOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::EvaluateExpressionAsync(const EvaluateExpressionRequest& request, const EvaluateExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::EvaluateExpressionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::EvaluateExpressionAsyncHelper, Aws::Client::RejectedAsyncCall<EvaluateExpressionOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::EvaluateExpressionAsync(EvaluateExpressionRequest&& request, const EvaluateExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::EvaluateExpressionAsyncHelper, Aws::Client::RejectedAsyncCall<EvaluateExpressionOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::EvaluateExpressionAsyncHelper(const EvaluateExpressionRequest& request, const EvaluateExpressionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -374,12 +454,22 @@ GetPipelineDefinitionOutcome DataPipelineClient::GetPipelineDefinition(const Get
 
 GetPipelineDefinitionOutcomeCallable DataPipelineClient::GetPipelineDefinitionCallable(const GetPipelineDefinitionRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::GetPipelineDefinition, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::GetPipelineDefinition, Aws::Client::RejectedCallOutcome<GetPipelineDefinitionOutcome>(), this, request);
+}
+
+GetPipelineDefinitionOutcomeCallable DataPipelineClient::GetPipelineDefinitionCallable(GetPipelineDefinitionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::GetPipelineDefinition, Aws::Client::RejectedCallOutcome<GetPipelineDefinitionOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::GetPipelineDefinitionAsync(const GetPipelineDefinitionRequest& request, const GetPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::GetPipelineDefinitionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::GetPipelineDefinitionAsyncHelper, Aws::Client::RejectedAsyncCall<GetPipelineDefinitionOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::GetPipelineDefinitionAsync(GetPipelineDefinitionRequest&& request, const GetPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::GetPipelineDefinitionAsyncHelper, Aws::Client::RejectedAsyncCall<GetPipelineDefinitionOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::GetPipelineDefinitionAsyncHelper(const GetPipelineDefinitionRequest& request, const GetPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -405,12 +495,22 @@ ListPipelinesOutcome DataPipelineClient::ListPipelines(const ListPipelinesReques
 
 ListPipelinesOutcomeCallable DataPipelineClient::ListPipelinesCallable(const ListPipelinesRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::ListPipelines, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::ListPipelines, Aws::Client::RejectedCallOutcome<ListPipelinesOutcome>(), this, request);
+}
+
+ListPipelinesOutcomeCallable DataPipelineClient::ListPipelinesCallable(ListPipelinesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::ListPipelines, Aws::Client::RejectedCallOutcome<ListPipelinesOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::ListPipelinesAsync(const ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::ListPipelinesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::ListPipelinesAsyncHelper, Aws::Client::RejectedAsyncCall<ListPipelinesOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::ListPipelinesAsync(ListPipelinesRequest&& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::ListPipelinesAsyncHelper, Aws::Client::RejectedAsyncCall<ListPipelinesOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::ListPipelinesAsyncHelper(const ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -436,12 +536,22 @@ PollForTaskOutcome DataPipelineClient::PollForTask(const PollForTaskRequest& req
 
 PollForTaskOutcomeCallable DataPipelineClient::PollForTaskCallable(const PollForTaskRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::PollForTask, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::PollForTask, Aws::Client::RejectedCallOutcome<PollForTaskOutcome>(), this, request);
+}
+
+PollForTaskOutcomeCallable DataPipelineClient::PollForTaskCallable(PollForTaskRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::PollForTask, Aws::Client::RejectedCallOutcome<PollForTaskOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::PollForTaskAsync(const PollForTaskRequest& request, const PollForTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::PollForTaskAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::PollForTaskAsyncHelper, Aws::Client::RejectedAsyncCall<PollForTaskOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::PollForTaskAsync(PollForTaskRequest&& request, const PollForTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::PollForTaskAsyncHelper, Aws::Client::RejectedAsyncCall<PollForTaskOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::PollForTaskAsyncHelper(const PollForTaskRequest& request, const PollForTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -467,12 +577,22 @@ PutPipelineDefinitionOutcome DataPipelineClient::PutPipelineDefinition(const Put
 
 PutPipelineDefinitionOutcomeCallable DataPipelineClient::PutPipelineDefinitionCallable(const PutPipelineDefinitionRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::PutPipelineDefinition, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::PutPipelineDefinition, Aws::Client::RejectedCallOutcome<PutPipelineDefinitionOutcome>(), this, request);
+}
+
+PutPipelineDefinitionOutcomeCallable DataPipelineClient::PutPipelineDefinitionCallable(PutPipelineDefinitionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::PutPipelineDefinition, Aws::Client::RejectedCallOutcome<PutPipelineDefinitionOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::PutPipelineDefinitionAsync(const PutPipelineDefinitionRequest& request, const PutPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::PutPipelineDefinitionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::PutPipelineDefinitionAsyncHelper, Aws::Client::RejectedAsyncCall<PutPipelineDefinitionOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::PutPipelineDefinitionAsync(PutPipelineDefinitionRequest&& request, const PutPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::PutPipelineDefinitionAsyncHelper, Aws::Client::RejectedAsyncCall<PutPipelineDefinitionOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::PutPipelineDefinitionAsyncHelper(const PutPipelineDefinitionRequest& request, const PutPipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -498,12 +618,22 @@ QueryObjectsOutcome DataPipelineClient::QueryObjects(const QueryObjectsRequest&
 
 QueryObjectsOutcomeCallable DataPipelineClient::QueryObjectsCallable(const QueryObjectsRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::QueryObjects, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::QueryObjects, Aws::Client::RejectedCallOutcome<QueryObjectsOutcome>(), this, request);
+}
+
+QueryObjectsOutcomeCallable DataPipelineClient::QueryObjectsCallable(QueryObjectsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::QueryObjects, Aws::Client::RejectedCallOutcome<QueryObjectsOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::QueryObjectsAsync(const QueryObjectsRequest& request, const QueryObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::QueryObjectsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::QueryObjectsAsyncHelper, Aws::Client::RejectedAsyncCall<QueryObjectsOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::QueryObjectsAsync(QueryObjectsRequest&& request, const QueryObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::QueryObjectsAsyncHelper, Aws::Client::RejectedAsyncCall<QueryObjectsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::QueryObjectsAsyncHelper(const QueryObjectsRequest& request, const QueryObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -529,12 +659,22 @@ RemoveTagsOutcome DataPipelineClient::RemoveTags(const RemoveTagsRequest& reques
 
 RemoveTagsOutcomeCallable DataPipelineClient::RemoveTagsCallable(const RemoveTagsRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::RemoveTags, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::RemoveTags, Aws::Client::RejectedCallOutcome<RemoveTagsOutcome>(), this, request);
+}
+
+RemoveTagsOutcomeCallable DataPipelineClient::RemoveTagsCallable(RemoveTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::RemoveTags, Aws::Client::RejectedCallOutcome<RemoveTagsOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::RemoveTagsAsync(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::RemoveTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::RemoveTagsAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::RemoveTagsAsync(RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::RemoveTagsAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::RemoveTagsAsyncHelper(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -560,12 +700,22 @@ ReportTaskProgressOutcome DataPipelineClient::ReportTaskProgress(const ReportTas
 
 ReportTaskProgressOutcomeCallable DataPipelineClient::ReportTaskProgressCallable(const ReportTaskProgressRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::ReportTaskProgress, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::ReportTaskProgress, Aws::Client::RejectedCallOutcome<ReportTaskProgressOutcome>(), this, request);
+}
+
+ReportTaskProgressOutcomeCallable DataPipelineClient::ReportTaskProgressCallable(ReportTaskProgressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::ReportTaskProgress, Aws::Client::RejectedCallOutcome<ReportTaskProgressOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::ReportTaskProgressAsync(const ReportTaskProgressRequest& request, const ReportTaskProgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::ReportTaskProgressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::ReportTaskProgressAsyncHelper, Aws::Client::RejectedAsyncCall<ReportTaskProgressOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::ReportTaskProgressAsync(ReportTaskProgressRequest&& request, const ReportTaskProgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::ReportTaskProgressAsyncHelper, Aws::Client::RejectedAsyncCall<ReportTaskProgressOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::ReportTaskProgressAsyncHelper(const ReportTaskProgressRequest& request, const ReportTaskProgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -591,12 +741,22 @@ ReportTaskRunnerHeartbeatOutcome DataPipelineClient::ReportTaskRunnerHeartbeat(c
 
 ReportTaskRunnerHeartbeatOutcomeCallable DataPipelineClient::ReportTaskRunnerHeartbeatCallable(const ReportTaskRunnerHeartbeatRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::ReportTaskRunnerHeartbeat, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::ReportTaskRunnerHeartbeat, Aws::Client::RejectedCallOutcome<ReportTaskRunnerHeartbeatOutcome>(), this, request);
+}
+
+ReportTaskRunnerHeartbeatOutcomeCallable DataPipelineClient::ReportTaskRunnerHeartbeatCallable(ReportTaskRunnerHeartbeatRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::ReportTaskRunnerHeartbeat, Aws::Client::RejectedCallOutcome<ReportTaskRunnerHeartbeatOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::ReportTaskRunnerHeartbeatAsync(const ReportTaskRunnerHeartbeatRequest& request, const ReportTaskRunnerHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::ReportTaskRunnerHeartbeatAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::ReportTaskRunnerHeartbeatAsyncHelper, Aws::Client::RejectedAsyncCall<ReportTaskRunnerHeartbeatOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::ReportTaskRunnerHeartbeatAsync(ReportTaskRunnerHeartbeatRequest&& request, const ReportTaskRunnerHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::ReportTaskRunnerHeartbeatAsyncHelper, Aws::Client::RejectedAsyncCall<ReportTaskRunnerHeartbeatOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::ReportTaskRunnerHeartbeatAsyncHelper(const ReportTaskRunnerHeartbeatRequest& request, const ReportTaskRunnerHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -622,12 +782,22 @@ SetStatusOutcome DataPipelineClient::SetStatus(const SetStatusRequest& request)
 
 SetStatusOutcomeCallable DataPipelineClient::SetStatusCallable(const SetStatusRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::SetStatus, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::SetStatus, Aws::Client::RejectedCallOutcome<SetStatusOutcome>(), this, request);
+}
+
+SetStatusOutcomeCallable DataPipelineClient::SetStatusCallable(SetStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::SetStatus, Aws::Client::RejectedCallOutcome<SetStatusOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::SetStatusAsync(const SetStatusRequest& request, const SetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::SetStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::SetStatusAsyncHelper, Aws::Client::RejectedAsyncCall<SetStatusOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::SetStatusAsync(SetStatusRequest&& request, const SetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::SetStatusAsyncHelper, Aws::Client::RejectedAsyncCall<SetStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::SetStatusAsyncHelper(const SetStatusRequest& request, const SetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -653,12 +823,22 @@ SetTaskStatusOutcome DataPipelineClient::SetTaskStatus(const SetTaskStatusReques
 
 SetTaskStatusOutcomeCallable DataPipelineClient::SetTaskStatusCallable(const SetTaskStatusRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::SetTaskStatus, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::SetTaskStatus, Aws::Client::RejectedCallOutcome<SetTaskStatusOutcome>(), this, request);
+}
+
+SetTaskStatusOutcomeCallable DataPipelineClient::SetTaskStatusCallable(SetTaskStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::SetTaskStatus, Aws::Client::RejectedCallOutcome<SetTaskStatusOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::SetTaskStatusAsync(const SetTaskStatusRequest& request, const SetTaskStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::SetTaskStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::SetTaskStatusAsyncHelper, Aws::Client::RejectedAsyncCall<SetTaskStatusOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::SetTaskStatusAsync(SetTaskStatusRequest&& request, const SetTaskStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::SetTaskStatusAsyncHelper, Aws::Client::RejectedAsyncCall<SetTaskStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::SetTaskStatusAsyncHelper(const SetTaskStatusRequest& request, const SetTaskStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -684,12 +864,22 @@ ValidatePipelineDefinitionOutcome DataPipelineClient::ValidatePipelineDefinition
 
 ValidatePipelineDefinitionOutcomeCallable DataPipelineClient::ValidatePipelineDefinitionCallable(const ValidatePipelineDefinitionRequest& request) const
 {
-  return std::async(std::launch::async, &DataPipelineClient::ValidatePipelineDefinition, this, request);
+  return m_executor->SubmitWithFuture(&DataPipelineClient::ValidatePipelineDefinition, Aws::Client::RejectedCallOutcome<ValidatePipelineDefinitionOutcome>(), this, request);
+}
+
+ValidatePipelineDefinitionOutcomeCallable DataPipelineClient::ValidatePipelineDefinitionCallable(ValidatePipelineDefinitionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DataPipelineClient::ValidatePipelineDefinition, Aws::Client::RejectedCallOutcome<ValidatePipelineDefinitionOutcome>(), this, std::move(request));
 }
 
 void DataPipelineClient::ValidatePipelineDefinitionAsync(const ValidatePipelineDefinitionRequest& request, const ValidatePipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DataPipelineClient::ValidatePipelineDefinitionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DataPipelineClient::ValidatePipelineDefinitionAsyncHelper, Aws::Client::RejectedAsyncCall<ValidatePipelineDefinitionOutcome>(), this, request, handler, context);
+}
+
+void DataPipelineClient::ValidatePipelineDefinitionAsync(ValidatePipelineDefinitionRequest&& request, const ValidatePipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DataPipelineClient::ValidatePipelineDefinitionAsyncHelper, Aws::Client::RejectedAsyncCall<ValidatePipelineDefinitionOutcome>(), this, std::move(request), handler, context);
 }
 
 void DataPipelineClient::ValidatePipelineDefinitionAsyncHelper(const ValidatePipelineDefinitionRequest& request, const ValidatePipelineDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
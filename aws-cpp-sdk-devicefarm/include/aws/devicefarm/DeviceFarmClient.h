@@ -53,6 +53,41 @@
 #include <aws/devicefarm/model/UpdateProjectResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/devicefarm/model/CreateDevicePoolRequest.h>
+#include <aws/devicefarm/model/CreateProjectRequest.h>
+#include <aws/devicefarm/model/CreateUploadRequest.h>
+#include <aws/devicefarm/model/DeleteDevicePoolRequest.h>
+#include <aws/devicefarm/model/DeleteProjectRequest.h>
+#include <aws/devicefarm/model/DeleteRunRequest.h>
+#include <aws/devicefarm/model/DeleteUploadRequest.h>
+#include <aws/devicefarm/model/GetAccountSettingsRequest.h>
+#include <aws/devicefarm/model/GetDeviceRequest.h>
+#include <aws/devicefarm/model/GetDevicePoolRequest.h>
+#include <aws/devicefarm/model/GetDevicePoolCompatibilityRequest.h>
+#include <aws/devicefarm/model/GetJobRequest.h>
+#include <aws/devicefarm/model/GetProjectRequest.h>
+#include <aws/devicefarm/model/GetRunRequest.h>
+#include <aws/devicefarm/model/GetSuiteRequest.h>
+#include <aws/devicefarm/model/GetTestRequest.h>
+#include <aws/devicefarm/model/GetUploadRequest.h>
+#include <aws/devicefarm/model/ListArtifactsRequest.h>
+#include <aws/devicefarm/model/ListDevicePoolsRequest.h>
+#include <aws/devicefarm/model/ListDevicesRequest.h>
+#include <aws/devicefarm/model/ListJobsRequest.h>
+#include <aws/devicefarm/model/ListProjectsRequest.h>
+#include <aws/devicefarm/model/ListRunsRequest.h>
+#include <aws/devicefarm/model/ListSamplesRequest.h>
+#include <aws/devicefarm/model/ListSuitesRequest.h>
+#include <aws/devicefarm/model/ListTestsRequest.h>
+#include <aws/devicefarm/model/ListUniqueProblemsRequest.h>
+#include <aws/devicefarm/model/ListUploadsRequest.h>
+#include <aws/devicefarm/model/ScheduleRunRequest.h>
+#include <aws/devicefarm/model/UpdateDevicePoolRequest.h>
+#include <aws/devicefarm/model/UpdateProjectRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -271,6 +306,11 @@ namespace Model
          */
         virtual Model::CreateDevicePoolOutcomeCallable CreateDevicePoolCallable(const Model::CreateDevicePoolRequest& request) const;
 
+        /**
+         * Same as CreateDevicePoolCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDevicePoolOutcomeCallable CreateDevicePoolCallable(Model::CreateDevicePoolRequest&& request) const;
+
         /**
          * <p>Creates a device pool.</p>
          *
@@ -278,6 +318,11 @@ namespace Model
          */
         virtual void CreateDevicePoolAsync(const Model::CreateDevicePoolRequest& request, const CreateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDevicePoolAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDevicePoolAsync(Model::CreateDevicePoolRequest&& request, const CreateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new project.</p>
          */
@@ -290,6 +335,11 @@ namespace Model
          */
         virtual Model::CreateProjectOutcomeCallable CreateProjectCallable(const Model::CreateProjectRequest& request) const;
 
+        /**
+         * Same as CreateProjectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateProjectOutcomeCallable CreateProjectCallable(Model::CreateProjectRequest&& request) const;
+
         /**
          * <p>Creates a new project.</p>
          *
@@ -297,6 +347,11 @@ namespace Model
          */
         virtual void CreateProjectAsync(const Model::CreateProjectRequest& request, const CreateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateProjectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateProjectAsync(Model::CreateProjectRequest&& request, const CreateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Uploads an app or test scripts.</p>
          */
@@ -309,6 +364,11 @@ namespace Model
          */
         virtual Model::CreateUploadOutcomeCallable CreateUploadCallable(const Model::CreateUploadRequest& request) const;
 
+        /**
+         * Same as CreateUploadCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateUploadOutcomeCallable CreateUploadCallable(Model::CreateUploadRequest&& request) const;
+
         /**
          * <p>Uploads an app or test scripts.</p>
          *
@@ -316,6 +376,11 @@ namespace Model
          */
         virtual void CreateUploadAsync(const Model::CreateUploadRequest& request, const CreateUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateUploadAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateUploadAsync(Model::CreateUploadRequest&& request, const CreateUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a device pool given the pool ARN. Does not allow deletion of curated
          * pools owned by the system.</p>
@@ -330,6 +395,11 @@ namespace Model
          */
         virtual Model::DeleteDevicePoolOutcomeCallable DeleteDevicePoolCallable(const Model::DeleteDevicePoolRequest& request) const;
 
+        /**
+         * Same as DeleteDevicePoolCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDevicePoolOutcomeCallable DeleteDevicePoolCallable(Model::DeleteDevicePoolRequest&& request) const;
+
         /**
          * <p>Deletes a device pool given the pool ARN. Does not allow deletion of curated
          * pools owned by the system.</p>
@@ -338,6 +408,11 @@ namespace Model
          */
         virtual void DeleteDevicePoolAsync(const Model::DeleteDevicePoolRequest& request, const DeleteDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDevicePoolAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDevicePoolAsync(Model::DeleteDevicePoolRequest&& request, const DeleteDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an AWS Device Farm project, given the project ARN.</p> <p><b>Note</b>
          * Deleting this resource does not stop an in-progress run.</p>
@@ -352,6 +427,11 @@ namespace Model
          */
         virtual Model::DeleteProjectOutcomeCallable DeleteProjectCallable(const Model::DeleteProjectRequest& request) const;
 
+        /**
+         * Same as DeleteProjectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteProjectOutcomeCallable DeleteProjectCallable(Model::DeleteProjectRequest&& request) const;
+
         /**
          * <p>Deletes an AWS Device Farm project, given the project ARN.</p> <p><b>Note</b>
          * Deleting this resource does not stop an in-progress run.</p>
@@ -360,6 +440,11 @@ namespace Model
          */
         virtual void DeleteProjectAsync(const Model::DeleteProjectRequest& request, const DeleteProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteProjectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteProjectAsync(Model::DeleteProjectRequest&& request, const DeleteProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the run, given the run ARN.</p> <p><b>Note</b> Deleting this resource
          * does not stop an in-progress run.</p>
@@ -374,6 +459,11 @@ namespace Model
          */
         virtual Model::DeleteRunOutcomeCallable DeleteRunCallable(const Model::DeleteRunRequest& request) const;
 
+        /**
+         * Same as DeleteRunCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteRunOutcomeCallable DeleteRunCallable(Model::DeleteRunRequest&& request) const;
+
         /**
          * <p>Deletes the run, given the run ARN.</p> <p><b>Note</b> Deleting this resource
          * does not stop an in-progress run.</p>
@@ -382,6 +472,11 @@ namespace Model
          */
         virtual void DeleteRunAsync(const Model::DeleteRunRequest& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRunAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteRunAsync(Model::DeleteRunRequest&& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an upload given the upload ARN.</p>
          */
@@ -394,6 +489,11 @@ namespace Model
          */
         virtual Model::DeleteUploadOutcomeCallable DeleteUploadCallable(const Model::DeleteUploadRequest& request) const;
 
+        /**
+         * Same as DeleteUploadCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteUploadOutcomeCallable DeleteUploadCallable(Model::DeleteUploadRequest&& request) const;
+
         /**
          * <p>Deletes an upload given the upload ARN.</p>
          *
@@ -401,6 +501,11 @@ namespace Model
          */
         virtual void DeleteUploadAsync(const Model::DeleteUploadRequest& request, const DeleteUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteUploadAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteUploadAsync(Model::DeleteUploadRequest&& request, const DeleteUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the number of unmetered iOS and/or unmetered Android devices that
          * have been purchased by the account.</p>
@@ -415,6 +520,11 @@ namespace Model
          */
         virtual Model::GetAccountSettingsOutcomeCallable GetAccountSettingsCallable(const Model::GetAccountSettingsRequest& request) const;
 
+        /**
+         * Same as GetAccountSettingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetAccountSettingsOutcomeCallable GetAccountSettingsCallable(Model::GetAccountSettingsRequest&& request) const;
+
         /**
          * <p>Returns the number of unmetered iOS and/or unmetered Android devices that
          * have been purchased by the account.</p>
@@ -423,6 +533,11 @@ namespace Model
          */
         virtual void GetAccountSettingsAsync(const Model::GetAccountSettingsRequest& request, const GetAccountSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAccountSettingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetAccountSettingsAsync(Model::GetAccountSettingsRequest&& request, const GetAccountSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a unique device type.</p>
          */
@@ -435,6 +550,11 @@ namespace Model
          */
         virtual Model::GetDeviceOutcomeCallable GetDeviceCallable(const Model::GetDeviceRequest& request) const;
 
+        /**
+         * Same as GetDeviceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDeviceOutcomeCallable GetDeviceCallable(Model::GetDeviceRequest&& request) const;
+
         /**
          * <p>Gets information about a unique device type.</p>
          *
@@ -442,6 +562,11 @@ namespace Model
          */
         virtual void GetDeviceAsync(const Model::GetDeviceRequest& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDeviceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDeviceAsync(Model::GetDeviceRequest&& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a device pool.</p>
          */
@@ -454,6 +579,11 @@ namespace Model
          */
         virtual Model::GetDevicePoolOutcomeCallable GetDevicePoolCallable(const Model::GetDevicePoolRequest& request) const;
 
+        /**
+         * Same as GetDevicePoolCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDevicePoolOutcomeCallable GetDevicePoolCallable(Model::GetDevicePoolRequest&& request) const;
+
         /**
          * <p>Gets information about a device pool.</p>
          *
@@ -461,6 +591,11 @@ namespace Model
          */
         virtual void GetDevicePoolAsync(const Model::GetDevicePoolRequest& request, const GetDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDevicePoolAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDevicePoolAsync(Model::GetDevicePoolRequest&& request, const GetDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about compatibility with a device pool.</p>
          */
@@ -473,6 +608,11 @@ namespace Model
          */
         virtual Model::GetDevicePoolCompatibilityOutcomeCallable GetDevicePoolCompatibilityCallable(const Model::GetDevicePoolCompatibilityRequest& request) const;
 
+        /**
+         * Same as GetDevicePoolCompatibilityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDevicePoolCompatibilityOutcomeCallable GetDevicePoolCompatibilityCallable(Model::GetDevicePoolCompatibilityRequest&& request) const;
+
         /**
          * <p>Gets information about compatibility with a device pool.</p>
          *
@@ -480,6 +620,11 @@ namespace Model
          */
         virtual void GetDevicePoolCompatibilityAsync(const Model::GetDevicePoolCompatibilityRequest& request, const GetDevicePoolCompatibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDevicePoolCompatibilityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDevicePoolCompatibilityAsync(Model::GetDevicePoolCompatibilityRequest&& request, const GetDevicePoolCompatibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a job.</p>
          */
@@ -492,6 +637,11 @@ namespace Model
          */
         virtual Model::GetJobOutcomeCallable GetJobCallable(const Model::GetJobRequest& request) const;
 
+        /**
+         * Same as GetJobCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetJobOutcomeCallable GetJobCallable(Model::GetJobRequest&& request) const;
+
         /**
          * <p>Gets information about a job.</p>
          *
@@ -499,6 +649,11 @@ namespace Model
          */
         virtual void GetJobAsync(const Model::GetJobRequest& request, const GetJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetJobAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetJobAsync(Model::GetJobRequest&& request, const GetJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a project.</p>
          */
@@ -511,6 +666,11 @@ namespace Model
          */
         virtual Model::GetProjectOutcomeCallable GetProjectCallable(const Model::GetProjectRequest& request) const;
 
+        /**
+         * Same as GetProjectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetProjectOutcomeCallable GetProjectCallable(Model::GetProjectRequest&& request) const;
+
         /**
          * <p>Gets information about a project.</p>
          *
@@ -518,6 +678,11 @@ namespace Model
          */
         virtual void GetProjectAsync(const Model::GetProjectRequest& request, const GetProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetProjectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetProjectAsync(Model::GetProjectRequest&& request, const GetProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a run.</p>
          */
@@ -530,6 +695,11 @@ namespace Model
          */
         virtual Model::GetRunOutcomeCallable GetRunCallable(const Model::GetRunRequest& request) const;
 
+        /**
+         * Same as GetRunCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetRunOutcomeCallable GetRunCallable(Model::GetRunRequest&& request) const;
+
         /**
          * <p>Gets information about a run.</p>
          *
@@ -537,6 +707,11 @@ namespace Model
          */
         virtual void GetRunAsync(const Model::GetRunRequest& request, const GetRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRunAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetRunAsync(Model::GetRunRequest&& request, const GetRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a suite.</p>
          */
@@ -549,6 +724,11 @@ namespace Model
          */
         virtual Model::GetSuiteOutcomeCallable GetSuiteCallable(const Model::GetSuiteRequest& request) const;
 
+        /**
+         * Same as GetSuiteCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetSuiteOutcomeCallable GetSuiteCallable(Model::GetSuiteRequest&& request) const;
+
         /**
          * <p>Gets information about a suite.</p>
          *
@@ -556,6 +736,11 @@ namespace Model
          */
         virtual void GetSuiteAsync(const Model::GetSuiteRequest& request, const GetSuiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSuiteAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetSuiteAsync(Model::GetSuiteRequest&& request, const GetSuiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a test.</p>
          */
@@ -568,6 +753,11 @@ namespace Model
          */
         virtual Model::GetTestOutcomeCallable GetTestCallable(const Model::GetTestRequest& request) const;
 
+        /**
+         * Same as GetTestCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetTestOutcomeCallable GetTestCallable(Model::GetTestRequest&& request) const;
+
         /**
          * <p>Gets information about a test.</p>
          *
@@ -575,6 +765,11 @@ namespace Model
          */
         virtual void GetTestAsync(const Model::GetTestRequest& request, const GetTestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTestAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetTestAsync(Model::GetTestRequest&& request, const GetTestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about an upload.</p>
          */
@@ -587,6 +782,11 @@ namespace Model
          */
         virtual Model::GetUploadOutcomeCallable GetUploadCallable(const Model::GetUploadRequest& request) const;
 
+        /**
+         * Same as GetUploadCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetUploadOutcomeCallable GetUploadCallable(Model::GetUploadRequest&& request) const;
+
         /**
          * <p>Gets information about an upload.</p>
          *
@@ -594,6 +794,11 @@ namespace Model
          */
         virtual void GetUploadAsync(const Model::GetUploadRequest& request, const GetUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetUploadAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetUploadAsync(Model::GetUploadRequest&& request, const GetUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about artifacts.</p>
          */
@@ -606,6 +811,11 @@ namespace Model
          */
         virtual Model::ListArtifactsOutcomeCallable ListArtifactsCallable(const Model::ListArtifactsRequest& request) const;
 
+        /**
+         * Same as ListArtifactsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListArtifactsOutcomeCallable ListArtifactsCallable(Model::ListArtifactsRequest&& request) const;
+
         /**
          * <p>Gets information about artifacts.</p>
          *
@@ -613,6 +823,11 @@ namespace Model
          */
         virtual void ListArtifactsAsync(const Model::ListArtifactsRequest& request, const ListArtifactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListArtifactsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListArtifactsAsync(Model::ListArtifactsRequest&& request, const ListArtifactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about device pools.</p>
          */
@@ -625,6 +840,11 @@ namespace Model
          */
         virtual Model::ListDevicePoolsOutcomeCallable ListDevicePoolsCallable(const Model::ListDevicePoolsRequest& request) const;
 
+        /**
+         * Same as ListDevicePoolsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDevicePoolsOutcomeCallable ListDevicePoolsCallable(Model::ListDevicePoolsRequest&& request) const;
+
         /**
          * <p>Gets information about device pools.</p>
          *
@@ -632,6 +852,11 @@ namespace Model
          */
         virtual void ListDevicePoolsAsync(const Model::ListDevicePoolsRequest& request, const ListDevicePoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDevicePoolsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDevicePoolsAsync(Model::ListDevicePoolsRequest&& request, const ListDevicePoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about unique device types.</p>
          */
@@ -644,6 +869,11 @@ namespace Model
          */
         virtual Model::ListDevicesOutcomeCallable ListDevicesCallable(const Model::ListDevicesRequest& request) const;
 
+        /**
+         * Same as ListDevicesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDevicesOutcomeCallable ListDevicesCallable(Model::ListDevicesRequest&& request) const;
+
         /**
          * <p>Gets information about unique device types.</p>
          *
@@ -651,6 +881,11 @@ namespace Model
          */
         virtual void ListDevicesAsync(const Model::ListDevicesRequest& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDevicesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDevicesAsync(Model::ListDevicesRequest&& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about jobs.</p>
          */
@@ -663,6 +898,11 @@ namespace Model
          */
         virtual Model::ListJobsOutcomeCallable ListJobsCallable(const Model::ListJobsRequest& request) const;
 
+        /**
+         * Same as ListJobsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListJobsOutcomeCallable ListJobsCallable(Model::ListJobsRequest&& request) const;
+
         /**
          * <p>Gets information about jobs.</p>
          *
@@ -670,6 +910,11 @@ namespace Model
          */
         virtual void ListJobsAsync(const Model::ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListJobsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListJobsAsync(Model::ListJobsRequest&& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about projects.</p>
          */
@@ -682,6 +927,11 @@ namespace Model
          */
         virtual Model::ListProjectsOutcomeCallable ListProjectsCallable(const Model::ListProjectsRequest& request) const;
 
+        /**
+         * Same as ListProjectsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListProjectsOutcomeCallable ListProjectsCallable(Model::ListProjectsRequest&& request) const;
+
         /**
          * <p>Gets information about projects.</p>
          *
@@ -689,6 +939,11 @@ namespace Model
          */
         virtual void ListProjectsAsync(const Model::ListProjectsRequest& request, const ListProjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListProjectsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListProjectsAsync(Model::ListProjectsRequest&& request, const ListProjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about runs.</p>
          */
@@ -701,6 +956,11 @@ namespace Model
          */
         virtual Model::ListRunsOutcomeCallable ListRunsCallable(const Model::ListRunsRequest& request) const;
 
+        /**
+         * Same as ListRunsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListRunsOutcomeCallable ListRunsCallable(Model::ListRunsRequest&& request) const;
+
         /**
          * <p>Gets information about runs.</p>
          *
@@ -708,6 +968,11 @@ namespace Model
          */
         virtual void ListRunsAsync(const Model::ListRunsRequest& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRunsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListRunsAsync(Model::ListRunsRequest&& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about samples.</p>
          */
@@ -720,6 +985,11 @@ namespace Model
          */
         virtual Model::ListSamplesOutcomeCallable ListSamplesCallable(const Model::ListSamplesRequest& request) const;
 
+        /**
+         * Same as ListSamplesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListSamplesOutcomeCallable ListSamplesCallable(Model::ListSamplesRequest&& request) const;
+
         /**
          * <p>Gets information about samples.</p>
          *
@@ -727,6 +997,11 @@ namespace Model
          */
         virtual void ListSamplesAsync(const Model::ListSamplesRequest& request, const ListSamplesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSamplesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListSamplesAsync(Model::ListSamplesRequest&& request, const ListSamplesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about suites.</p>
          */
@@ -739,6 +1014,11 @@ namespace Model
          */
         virtual Model::ListSuitesOutcomeCallable ListSuitesCallable(const Model::ListSuitesRequest& request) const;
 
+        /**
+         * Same as ListSuitesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListSuitesOutcomeCallable ListSuitesCallable(Model::ListSuitesRequest&& request) const;
+
         /**
          * <p>Gets information about suites.</p>
          *
@@ -746,6 +1026,11 @@ namespace Model
          */
         virtual void ListSuitesAsync(const Model::ListSuitesRequest& request, const ListSuitesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSuitesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListSuitesAsync(Model::ListSuitesRequest&& request, const ListSuitesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about tests.</p>
          */
@@ -758,6 +1043,11 @@ namespace Model
          */
         virtual Model::ListTestsOutcomeCallable ListTestsCallable(const Model::ListTestsRequest& request) const;
 
+        /**
+         * Same as ListTestsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTestsOutcomeCallable ListTestsCallable(Model::ListTestsRequest&& request) const;
+
         /**
          * <p>Gets information about tests.</p>
          *
@@ -765,6 +1055,11 @@ namespace Model
          */
         virtual void ListTestsAsync(const Model::ListTestsRequest& request, const ListTestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTestsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTestsAsync(Model::ListTestsRequest&& request, const ListTestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about unique problems.</p>
          */
@@ -777,6 +1072,11 @@ namespace Model
          */
         virtual Model::ListUniqueProblemsOutcomeCallable ListUniqueProblemsCallable(const Model::ListUniqueProblemsRequest& request) const;
 
+        /**
+         * Same as ListUniqueProblemsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListUniqueProblemsOutcomeCallable ListUniqueProblemsCallable(Model::ListUniqueProblemsRequest&& request) const;
+
         /**
          * <p>Gets information about unique problems.</p>
          *
@@ -784,6 +1084,11 @@ namespace Model
          */
         virtual void ListUniqueProblemsAsync(const Model::ListUniqueProblemsRequest& request, const ListUniqueProblemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListUniqueProblemsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListUniqueProblemsAsync(Model::ListUniqueProblemsRequest&& request, const ListUniqueProblemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about uploads.</p>
          */
@@ -796,6 +1101,11 @@ namespace Model
          */
         virtual Model::ListUploadsOutcomeCallable ListUploadsCallable(const Model::ListUploadsRequest& request) const;
 
+        /**
+         * Same as ListUploadsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListUploadsOutcomeCallable ListUploadsCallable(Model::ListUploadsRequest&& request) const;
+
         /**
          * <p>Gets information about uploads.</p>
          *
@@ -803,6 +1113,11 @@ namespace Model
          */
         virtual void ListUploadsAsync(const Model::ListUploadsRequest& request, const ListUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListUploadsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListUploadsAsync(Model::ListUploadsRequest&& request, const ListUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Schedules a run.</p>
          */
@@ -815,6 +1130,11 @@ namespace Model
          */
         virtual Model::ScheduleRunOutcomeCallable ScheduleRunCallable(const Model::ScheduleRunRequest& request) const;
 
+        /**
+         * Same as ScheduleRunCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ScheduleRunOutcomeCallable ScheduleRunCallable(Model::ScheduleRunRequest&& request) const;
+
         /**
          * <p>Schedules a run.</p>
          *
@@ -822,6 +1142,11 @@ namespace Model
          */
         virtual void ScheduleRunAsync(const Model::ScheduleRunRequest& request, const ScheduleRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ScheduleRunAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ScheduleRunAsync(Model::ScheduleRunRequest&& request, const ScheduleRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the name, description, and rules in a device pool given the
          * attributes and the pool ARN. Rule updates are all-or-nothing, meaning they can
@@ -838,6 +1163,11 @@ namespace Model
          */
         virtual Model::UpdateDevicePoolOutcomeCallable UpdateDevicePoolCallable(const Model::UpdateDevicePoolRequest& request) const;
 
+        /**
+         * Same as UpdateDevicePoolCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateDevicePoolOutcomeCallable UpdateDevicePoolCallable(Model::UpdateDevicePoolRequest&& request) const;
+
         /**
          * <p>Modifies the name, description, and rules in a device pool given the
          * attributes and the pool ARN. Rule updates are all-or-nothing, meaning they can
@@ -847,6 +1177,11 @@ namespace Model
          */
         virtual void UpdateDevicePoolAsync(const Model::UpdateDevicePoolRequest& request, const UpdateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDevicePoolAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateDevicePoolAsync(Model::UpdateDevicePoolRequest&& request, const UpdateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified project name, given the project ARN and a new
          * name.</p>
@@ -861,6 +1196,11 @@ namespace Model
          */
         virtual Model::UpdateProjectOutcomeCallable UpdateProjectCallable(const Model::UpdateProjectRequest& request) const;
 
+        /**
+         * Same as UpdateProjectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateProjectOutcomeCallable UpdateProjectCallable(Model::UpdateProjectRequest&& request) const;
+
         /**
          * <p>Modifies the specified project name, given the project ARN and a new
          * name.</p>
@@ -869,6 +1209,80 @@ namespace Model
          */
         virtual void UpdateProjectAsync(const Model::UpdateProjectRequest& request, const UpdateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateProjectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateProjectAsync(Model::UpdateProjectRequest&& request, const UpdateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDevicePoolOutcome> CreateDevicePoolAwaitable(const Model::CreateDevicePoolRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::CreateDevicePool, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDevicePoolOutcome> CreateDevicePoolAwaitable(Model::CreateDevicePoolRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::CreateDevicePool, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateProjectOutcome> CreateProjectAwaitable(const Model::CreateProjectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::CreateProject, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateProjectOutcome> CreateProjectAwaitable(Model::CreateProjectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::CreateProject, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateUploadOutcome> CreateUploadAwaitable(const Model::CreateUploadRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::CreateUpload, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateUploadOutcome> CreateUploadAwaitable(Model::CreateUploadRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::CreateUpload, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDevicePoolOutcome> DeleteDevicePoolAwaitable(const Model::DeleteDevicePoolRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::DeleteDevicePool, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDevicePoolOutcome> DeleteDevicePoolAwaitable(Model::DeleteDevicePoolRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::DeleteDevicePool, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteProjectOutcome> DeleteProjectAwaitable(const Model::DeleteProjectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::DeleteProject, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteProjectOutcome> DeleteProjectAwaitable(Model::DeleteProjectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::DeleteProject, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRunOutcome> DeleteRunAwaitable(const Model::DeleteRunRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::DeleteRun, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRunOutcome> DeleteRunAwaitable(Model::DeleteRunRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::DeleteRun, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteUploadOutcome> DeleteUploadAwaitable(const Model::DeleteUploadRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::DeleteUpload, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteUploadOutcome> DeleteUploadAwaitable(Model::DeleteUploadRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::DeleteUpload, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAccountSettingsOutcome> GetAccountSettingsAwaitable(const Model::GetAccountSettingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetAccountSettings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAccountSettingsOutcome> GetAccountSettingsAwaitable(Model::GetAccountSettingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetAccountSettings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDeviceOutcome> GetDeviceAwaitable(const Model::GetDeviceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetDevice, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDeviceOutcome> GetDeviceAwaitable(Model::GetDeviceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetDevice, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDevicePoolOutcome> GetDevicePoolAwaitable(const Model::GetDevicePoolRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetDevicePool, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDevicePoolOutcome> GetDevicePoolAwaitable(Model::GetDevicePoolRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetDevicePool, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDevicePoolCompatibilityOutcome> GetDevicePoolCompatibilityAwaitable(const Model::GetDevicePoolCompatibilityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetDevicePoolCompatibility, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDevicePoolCompatibilityOutcome> GetDevicePoolCompatibilityAwaitable(Model::GetDevicePoolCompatibilityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetDevicePoolCompatibility, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetJobOutcome> GetJobAwaitable(const Model::GetJobRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetJob, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetJobOutcome> GetJobAwaitable(Model::GetJobRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetJob, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetProjectOutcome> GetProjectAwaitable(const Model::GetProjectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetProject, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetProjectOutcome> GetProjectAwaitable(Model::GetProjectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetProject, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRunOutcome> GetRunAwaitable(const Model::GetRunRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetRun, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRunOutcome> GetRunAwaitable(Model::GetRunRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetRun, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSuiteOutcome> GetSuiteAwaitable(const Model::GetSuiteRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetSuite, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSuiteOutcome> GetSuiteAwaitable(Model::GetSuiteRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetSuite, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTestOutcome> GetTestAwaitable(const Model::GetTestRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetTest, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTestOutcome> GetTestAwaitable(Model::GetTestRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetTest, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetUploadOutcome> GetUploadAwaitable(const Model::GetUploadRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetUpload, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetUploadOutcome> GetUploadAwaitable(Model::GetUploadRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::GetUpload, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListArtifactsOutcome> ListArtifactsAwaitable(const Model::ListArtifactsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListArtifacts, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListArtifactsOutcome> ListArtifactsAwaitable(Model::ListArtifactsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListArtifacts, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDevicePoolsOutcome> ListDevicePoolsAwaitable(const Model::ListDevicePoolsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListDevicePools, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDevicePoolsOutcome> ListDevicePoolsAwaitable(Model::ListDevicePoolsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListDevicePools, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDevicesOutcome> ListDevicesAwaitable(const Model::ListDevicesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListDevices, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDevicesOutcome> ListDevicesAwaitable(Model::ListDevicesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListDevices, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListJobsOutcome> ListJobsAwaitable(const Model::ListJobsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListJobs, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListJobsOutcome> ListJobsAwaitable(Model::ListJobsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListJobs, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListProjectsOutcome> ListProjectsAwaitable(const Model::ListProjectsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListProjects, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListProjectsOutcome> ListProjectsAwaitable(Model::ListProjectsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListProjects, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRunsOutcome> ListRunsAwaitable(const Model::ListRunsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListRuns, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRunsOutcome> ListRunsAwaitable(Model::ListRunsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListRuns, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSamplesOutcome> ListSamplesAwaitable(const Model::ListSamplesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListSamples, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSamplesOutcome> ListSamplesAwaitable(Model::ListSamplesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListSamples, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSuitesOutcome> ListSuitesAwaitable(const Model::ListSuitesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListSuites, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSuitesOutcome> ListSuitesAwaitable(Model::ListSuitesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListSuites, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTestsOutcome> ListTestsAwaitable(const Model::ListTestsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListTests, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTestsOutcome> ListTestsAwaitable(Model::ListTestsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListTests, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListUniqueProblemsOutcome> ListUniqueProblemsAwaitable(const Model::ListUniqueProblemsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListUniqueProblems, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListUniqueProblemsOutcome> ListUniqueProblemsAwaitable(Model::ListUniqueProblemsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListUniqueProblems, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListUploadsOutcome> ListUploadsAwaitable(const Model::ListUploadsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListUploads, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListUploadsOutcome> ListUploadsAwaitable(Model::ListUploadsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ListUploads, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ScheduleRunOutcome> ScheduleRunAwaitable(const Model::ScheduleRunRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ScheduleRun, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ScheduleRunOutcome> ScheduleRunAwaitable(Model::ScheduleRunRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::ScheduleRun, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDevicePoolOutcome> UpdateDevicePoolAwaitable(const Model::UpdateDevicePoolRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::UpdateDevicePool, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDevicePoolOutcome> UpdateDevicePoolAwaitable(Model::UpdateDevicePoolRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::UpdateDevicePool, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateProjectOutcome> UpdateProjectAwaitable(const Model::UpdateProjectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::UpdateProject, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateProjectOutcome> UpdateProjectAwaitable(Model::UpdateProjectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DeviceFarmClient::UpdateProject, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
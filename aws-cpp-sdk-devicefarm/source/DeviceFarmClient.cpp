@@ -138,12 +138,22 @@ CreateDevicePoolOutcome DeviceFarmClient::CreateDevicePool(const CreateDevicePoo
 
 CreateDevicePoolOutcomeCallable DeviceFarmClient::CreateDevicePoolCallable(const CreateDevicePoolRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::CreateDevicePool, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::CreateDevicePool, Aws::Client::RejectedCallOutcome<CreateDevicePoolOutcome>(), this, request);
+}
+
+CreateDevicePoolOutcomeCallable DeviceFarmClient::CreateDevicePoolCallable(CreateDevicePoolRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::CreateDevicePool, Aws::Client::RejectedCallOutcome<CreateDevicePoolOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::CreateDevicePoolAsync(const CreateDevicePoolRequest& request, const CreateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::CreateDevicePoolAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::CreateDevicePoolAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDevicePoolOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::CreateDevicePoolAsync(CreateDevicePoolRequest&& request, const CreateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::CreateDevicePoolAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDevicePoolOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::CreateDevicePoolAsyncHelper(const CreateDevicePoolRequest& request, const CreateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -169,12 +179,22 @@ CreateProjectOutcome DeviceFarmClient::CreateProject(const CreateProjectRequest&
 
 CreateProjectOutcomeCallable DeviceFarmClient::CreateProjectCallable(const CreateProjectRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::CreateProject, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::CreateProject, Aws::Client::RejectedCallOutcome<CreateProjectOutcome>(), this, request);
+}
+
+CreateProjectOutcomeCallable DeviceFarmClient::CreateProjectCallable(CreateProjectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::CreateProject, Aws::Client::RejectedCallOutcome<CreateProjectOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::CreateProjectAsync(const CreateProjectRequest& request, const CreateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::CreateProjectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::CreateProjectAsyncHelper, Aws::Client::RejectedAsyncCall<CreateProjectOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::CreateProjectAsync(CreateProjectRequest&& request, const CreateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::CreateProjectAsyncHelper, Aws::Client::RejectedAsyncCall<CreateProjectOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::CreateProjectAsyncHelper(const CreateProjectRequest& request, const CreateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -200,12 +220,22 @@ CreateUploadOutcome DeviceFarmClient::CreateUpload(const CreateUploadRequest& re
 
 CreateUploadOutcomeCallable DeviceFarmClient::CreateUploadCallable(const CreateUploadRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::CreateUpload, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::CreateUpload, Aws::Client::RejectedCallOutcome<CreateUploadOutcome>(), this, request);
+}
+
+CreateUploadOutcomeCallable DeviceFarmClient::CreateUploadCallable(CreateUploadRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::CreateUpload, Aws::Client::RejectedCallOutcome<CreateUploadOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::CreateUploadAsync(const CreateUploadRequest& request, const CreateUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::CreateUploadAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::CreateUploadAsyncHelper, Aws::Client::RejectedAsyncCall<CreateUploadOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::CreateUploadAsync(CreateUploadRequest&& request, const CreateUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::CreateUploadAsyncHelper, Aws::Client::RejectedAsyncCall<CreateUploadOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::CreateUploadAsyncHelper(const CreateUploadRequest& request, const CreateUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -231,12 +261,22 @@ DeleteDevicePoolOutcome DeviceFarmClient::DeleteDevicePool(const DeleteDevicePoo
 
 DeleteDevicePoolOutcomeCallable DeviceFarmClient::DeleteDevicePoolCallable(const DeleteDevicePoolRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::DeleteDevicePool, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::DeleteDevicePool, Aws::Client::RejectedCallOutcome<DeleteDevicePoolOutcome>(), this, request);
+}
+
+DeleteDevicePoolOutcomeCallable DeviceFarmClient::DeleteDevicePoolCallable(DeleteDevicePoolRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::DeleteDevicePool, Aws::Client::RejectedCallOutcome<DeleteDevicePoolOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::DeleteDevicePoolAsync(const DeleteDevicePoolRequest& request, const DeleteDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::DeleteDevicePoolAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::DeleteDevicePoolAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDevicePoolOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::DeleteDevicePoolAsync(DeleteDevicePoolRequest&& request, const DeleteDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::DeleteDevicePoolAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDevicePoolOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::DeleteDevicePoolAsyncHelper(const DeleteDevicePoolRequest& request, const DeleteDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -262,12 +302,22 @@ DeleteProjectOutcome DeviceFarmClient::DeleteProject(const DeleteProjectRequest&
 
 DeleteProjectOutcomeCallable DeviceFarmClient::DeleteProjectCallable(const DeleteProjectRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::DeleteProject, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::DeleteProject, Aws::Client::RejectedCallOutcome<DeleteProjectOutcome>(), this, request);
+}
+
+DeleteProjectOutcomeCallable DeviceFarmClient::DeleteProjectCallable(DeleteProjectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::DeleteProject, Aws::Client::RejectedCallOutcome<DeleteProjectOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::DeleteProjectAsync(const DeleteProjectRequest& request, const DeleteProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::DeleteProjectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::DeleteProjectAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteProjectOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::DeleteProjectAsync(DeleteProjectRequest&& request, const DeleteProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::DeleteProjectAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteProjectOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::DeleteProjectAsyncHelper(const DeleteProjectRequest& request, const DeleteProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -293,12 +343,22 @@ DeleteRunOutcome DeviceFarmClient::DeleteRun(const DeleteRunRequest& request) co
 
 DeleteRunOutcomeCallable DeviceFarmClient::DeleteRunCallable(const DeleteRunRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::DeleteRun, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::DeleteRun, Aws::Client::RejectedCallOutcome<DeleteRunOutcome>(), this, request);
+}
+
+DeleteRunOutcomeCallable DeviceFarmClient::DeleteRunCallable(DeleteRunRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::DeleteRun, Aws::Client::RejectedCallOutcome<DeleteRunOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::DeleteRunAsync(const DeleteRunRequest& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::DeleteRunAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::DeleteRunAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRunOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::DeleteRunAsync(DeleteRunRequest&& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::DeleteRunAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRunOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::DeleteRunAsyncHelper(const DeleteRunRequest& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -324,12 +384,22 @@ DeleteUploadOutcome DeviceFarmClient::DeleteUpload(const DeleteUploadRequest& re
 
 DeleteUploadOutcomeCallable DeviceFarmClient::DeleteUploadCallable(const DeleteUploadRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::DeleteUpload, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::DeleteUpload, Aws::Client::RejectedCallOutcome<DeleteUploadOutcome>(), this, request);
+}
+
+DeleteUploadOutcomeCallable DeviceFarmClient::DeleteUploadCallable(DeleteUploadRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::DeleteUpload, Aws::Client::RejectedCallOutcome<DeleteUploadOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::DeleteUploadAsync(const DeleteUploadRequest& request, const DeleteUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::DeleteUploadAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::DeleteUploadAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteUploadOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::DeleteUploadAsync(DeleteUploadRequest&& request, const DeleteUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::DeleteUploadAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteUploadOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::DeleteUploadAsyncHelper(const DeleteUploadRequest& request, const DeleteUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -355,12 +425,22 @@ GetAccountSettingsOutcome DeviceFarmClient::GetAccountSettings(const GetAccountS
 
 GetAccountSettingsOutcomeCallable DeviceFarmClient::GetAccountSettingsCallable(const GetAccountSettingsRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::GetAccountSettings, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetAccountSettings, Aws::Client::RejectedCallOutcome<GetAccountSettingsOutcome>(), this, request);
+}
+
+GetAccountSettingsOutcomeCallable DeviceFarmClient::GetAccountSettingsCallable(GetAccountSettingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetAccountSettings, Aws::Client::RejectedCallOutcome<GetAccountSettingsOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::GetAccountSettingsAsync(const GetAccountSettingsRequest& request, const GetAccountSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::GetAccountSettingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetAccountSettingsAsyncHelper, Aws::Client::RejectedAsyncCall<GetAccountSettingsOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::GetAccountSettingsAsync(GetAccountSettingsRequest&& request, const GetAccountSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetAccountSettingsAsyncHelper, Aws::Client::RejectedAsyncCall<GetAccountSettingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::GetAccountSettingsAsyncHelper(const GetAccountSettingsRequest& request, const GetAccountSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -386,12 +466,22 @@ GetDeviceOutcome DeviceFarmClient::GetDevice(const GetDeviceRequest& request) co
 
 GetDeviceOutcomeCallable DeviceFarmClient::GetDeviceCallable(const GetDeviceRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::GetDevice, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetDevice, Aws::Client::RejectedCallOutcome<GetDeviceOutcome>(), this, request);
+}
+
+GetDeviceOutcomeCallable DeviceFarmClient::GetDeviceCallable(GetDeviceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetDevice, Aws::Client::RejectedCallOutcome<GetDeviceOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::GetDeviceAsync(const GetDeviceRequest& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::GetDeviceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetDeviceAsyncHelper, Aws::Client::RejectedAsyncCall<GetDeviceOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::GetDeviceAsync(GetDeviceRequest&& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetDeviceAsyncHelper, Aws::Client::RejectedAsyncCall<GetDeviceOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::GetDeviceAsyncHelper(const GetDeviceRequest& request, const GetDeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -417,12 +507,22 @@ GetDevicePoolOutcome DeviceFarmClient::GetDevicePool(const GetDevicePoolRequest&
 
 GetDevicePoolOutcomeCallable DeviceFarmClient::GetDevicePoolCallable(const GetDevicePoolRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::GetDevicePool, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetDevicePool, Aws::Client::RejectedCallOutcome<GetDevicePoolOutcome>(), this, request);
+}
+
+GetDevicePoolOutcomeCallable DeviceFarmClient::GetDevicePoolCallable(GetDevicePoolRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetDevicePool, Aws::Client::RejectedCallOutcome<GetDevicePoolOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::GetDevicePoolAsync(const GetDevicePoolRequest& request, const GetDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::GetDevicePoolAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetDevicePoolAsyncHelper, Aws::Client::RejectedAsyncCall<GetDevicePoolOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::GetDevicePoolAsync(GetDevicePoolRequest&& request, const GetDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetDevicePoolAsyncHelper, Aws::Client::RejectedAsyncCall<GetDevicePoolOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::GetDevicePoolAsyncHelper(const GetDevicePoolRequest& request, const GetDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -448,12 +548,22 @@ GetDevicePoolCompatibilityOutcome DeviceFarmClient::GetDevicePoolCompatibility(c
 
 GetDevicePoolCompatibilityOutcomeCallable DeviceFarmClient::GetDevicePoolCompatibilityCallable(const GetDevicePoolCompatibilityRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::GetDevicePoolCompatibility, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetDevicePoolCompatibility, Aws::Client::RejectedCallOutcome<GetDevicePoolCompatibilityOutcome>(), this, request);
+}
+
+GetDevicePoolCompatibilityOutcomeCallable DeviceFarmClient::GetDevicePoolCompatibilityCallable(GetDevicePoolCompatibilityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetDevicePoolCompatibility, Aws::Client::RejectedCallOutcome<GetDevicePoolCompatibilityOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::GetDevicePoolCompatibilityAsync(const GetDevicePoolCompatibilityRequest& request, const GetDevicePoolCompatibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::GetDevicePoolCompatibilityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetDevicePoolCompatibilityAsyncHelper, Aws::Client::RejectedAsyncCall<GetDevicePoolCompatibilityOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::GetDevicePoolCompatibilityAsync(GetDevicePoolCompatibilityRequest&& request, const GetDevicePoolCompatibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetDevicePoolCompatibilityAsyncHelper, Aws::Client::RejectedAsyncCall<GetDevicePoolCompatibilityOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::GetDevicePoolCompatibilityAsyncHelper(const GetDevicePoolCompatibilityRequest& request, const GetDevicePoolCompatibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -479,12 +589,22 @@ GetJobOutcome DeviceFarmClient::GetJob(const GetJobRequest& request) const
 
 GetJobOutcomeCallable DeviceFarmClient::GetJobCallable(const GetJobRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::GetJob, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetJob, Aws::Client::RejectedCallOutcome<GetJobOutcome>(), this, request);
+}
+
+GetJobOutcomeCallable DeviceFarmClient::GetJobCallable(GetJobRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetJob, Aws::Client::RejectedCallOutcome<GetJobOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::GetJobAsync(const GetJobRequest& request, const GetJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::GetJobAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetJobAsyncHelper, Aws::Client::RejectedAsyncCall<GetJobOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::GetJobAsync(GetJobRequest&& request, const GetJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetJobAsyncHelper, Aws::Client::RejectedAsyncCall<GetJobOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::GetJobAsyncHelper(const GetJobRequest& request, const GetJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -510,12 +630,22 @@ GetProjectOutcome DeviceFarmClient::GetProject(const GetProjectRequest& request)
 
 GetProjectOutcomeCallable DeviceFarmClient::GetProjectCallable(const GetProjectRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::GetProject, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetProject, Aws::Client::RejectedCallOutcome<GetProjectOutcome>(), this, request);
+}
+
+GetProjectOutcomeCallable DeviceFarmClient::GetProjectCallable(GetProjectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetProject, Aws::Client::RejectedCallOutcome<GetProjectOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::GetProjectAsync(const GetProjectRequest& request, const GetProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::GetProjectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetProjectAsyncHelper, Aws::Client::RejectedAsyncCall<GetProjectOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::GetProjectAsync(GetProjectRequest&& request, const GetProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetProjectAsyncHelper, Aws::Client::RejectedAsyncCall<GetProjectOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::GetProjectAsyncHelper(const GetProjectRequest& request, const GetProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -541,12 +671,22 @@ GetRunOutcome DeviceFarmClient::GetRun(const GetRunRequest& request) const
 
 GetRunOutcomeCallable DeviceFarmClient::GetRunCallable(const GetRunRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::GetRun, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetRun, Aws::Client::RejectedCallOutcome<GetRunOutcome>(), this, request);
+}
+
+GetRunOutcomeCallable DeviceFarmClient::GetRunCallable(GetRunRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetRun, Aws::Client::RejectedCallOutcome<GetRunOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::GetRunAsync(const GetRunRequest& request, const GetRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::GetRunAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetRunAsyncHelper, Aws::Client::RejectedAsyncCall<GetRunOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::GetRunAsync(GetRunRequest&& request, const GetRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetRunAsyncHelper, Aws::Client::RejectedAsyncCall<GetRunOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::GetRunAsyncHelper(const GetRunRequest& request, const GetRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -572,12 +712,22 @@ GetSuiteOutcome DeviceFarmClient::GetSuite(const GetSuiteRequest& request) const
 
 GetSuiteOutcomeCallable DeviceFarmClient::GetSuiteCallable(const GetSuiteRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::GetSuite, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetSuite, Aws::Client::RejectedCallOutcome<GetSuiteOutcome>(), this, request);
+}
+
+GetSuiteOutcomeCallable DeviceFarmClient::GetSuiteCallable(GetSuiteRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetSuite, Aws::Client::RejectedCallOutcome<GetSuiteOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::GetSuiteAsync(const GetSuiteRequest& request, const GetSuiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::GetSuiteAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetSuiteAsyncHelper, Aws::Client::RejectedAsyncCall<GetSuiteOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::GetSuiteAsync(GetSuiteRequest&& request, const GetSuiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetSuiteAsyncHelper, Aws::Client::RejectedAsyncCall<GetSuiteOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::GetSuiteAsyncHelper(const GetSuiteRequest& request, const GetSuiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -603,12 +753,22 @@ GetTestOutcome DeviceFarmClient::GetTest(const GetTestRequest& request) const
 
 GetTestOutcomeCallable DeviceFarmClient::GetTestCallable(const GetTestRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::GetTest, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetTest, Aws::Client::RejectedCallOutcome<GetTestOutcome>(), this, request);
+}
+
+GetTestOutcomeCallable DeviceFarmClient::GetTestCallable(GetTestRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetTest, Aws::Client::RejectedCallOutcome<GetTestOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::GetTestAsync(const GetTestRequest& request, const GetTestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::GetTestAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetTestAsyncHelper, Aws::Client::RejectedAsyncCall<GetTestOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::GetTestAsync(GetTestRequest&& request, const GetTestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetTestAsyncHelper, Aws::Client::RejectedAsyncCall<GetTestOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::GetTestAsyncHelper(const GetTestRequest& request, const GetTestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -634,12 +794,22 @@ GetUploadOutcome DeviceFarmClient::GetUpload(const GetUploadRequest& request) co
 
 GetUploadOutcomeCallable DeviceFarmClient::GetUploadCallable(const GetUploadRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::GetUpload, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetUpload, Aws::Client::RejectedCallOutcome<GetUploadOutcome>(), this, request);
+}
+
+GetUploadOutcomeCallable DeviceFarmClient::GetUploadCallable(GetUploadRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::GetUpload, Aws::Client::RejectedCallOutcome<GetUploadOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::GetUploadAsync(const GetUploadRequest& request, const GetUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::GetUploadAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetUploadAsyncHelper, Aws::Client::RejectedAsyncCall<GetUploadOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::GetUploadAsync(GetUploadRequest&& request, const GetUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::GetUploadAsyncHelper, Aws::Client::RejectedAsyncCall<GetUploadOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::GetUploadAsyncHelper(const GetUploadRequest& request, const GetUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -665,12 +835,22 @@ ListArtifactsOutcome DeviceFarmClient::ListArtifacts(const ListArtifactsRequest&
 
 ListArtifactsOutcomeCallable DeviceFarmClient::ListArtifactsCallable(const ListArtifactsRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::ListArtifacts, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListArtifacts, Aws::Client::RejectedCallOutcome<ListArtifactsOutcome>(), this, request);
+}
+
+ListArtifactsOutcomeCallable DeviceFarmClient::ListArtifactsCallable(ListArtifactsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListArtifacts, Aws::Client::RejectedCallOutcome<ListArtifactsOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::ListArtifactsAsync(const ListArtifactsRequest& request, const ListArtifactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::ListArtifactsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListArtifactsAsyncHelper, Aws::Client::RejectedAsyncCall<ListArtifactsOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::ListArtifactsAsync(ListArtifactsRequest&& request, const ListArtifactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListArtifactsAsyncHelper, Aws::Client::RejectedAsyncCall<ListArtifactsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::ListArtifactsAsyncHelper(const ListArtifactsRequest& request, const ListArtifactsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -696,12 +876,22 @@ ListDevicePoolsOutcome DeviceFarmClient::ListDevicePools(const ListDevicePoolsRe
 
 ListDevicePoolsOutcomeCallable DeviceFarmClient::ListDevicePoolsCallable(const ListDevicePoolsRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::ListDevicePools, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListDevicePools, Aws::Client::RejectedCallOutcome<ListDevicePoolsOutcome>(), this, request);
+}
+
+ListDevicePoolsOutcomeCallable DeviceFarmClient::ListDevicePoolsCallable(ListDevicePoolsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListDevicePools, Aws::Client::RejectedCallOutcome<ListDevicePoolsOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::ListDevicePoolsAsync(const ListDevicePoolsRequest& request, const ListDevicePoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::ListDevicePoolsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListDevicePoolsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDevicePoolsOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::ListDevicePoolsAsync(ListDevicePoolsRequest&& request, const ListDevicePoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListDevicePoolsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDevicePoolsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::ListDevicePoolsAsyncHelper(const ListDevicePoolsRequest& request, const ListDevicePoolsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -727,12 +917,22 @@ ListDevicesOutcome DeviceFarmClient::ListDevices(const ListDevicesRequest& reque
 
 ListDevicesOutcomeCallable DeviceFarmClient::ListDevicesCallable(const ListDevicesRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::ListDevices, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListDevices, Aws::Client::RejectedCallOutcome<ListDevicesOutcome>(), this, request);
+}
+
+ListDevicesOutcomeCallable DeviceFarmClient::ListDevicesCallable(ListDevicesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListDevices, Aws::Client::RejectedCallOutcome<ListDevicesOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::ListDevicesAsync(const ListDevicesRequest& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::ListDevicesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListDevicesAsyncHelper, Aws::Client::RejectedAsyncCall<ListDevicesOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::ListDevicesAsync(ListDevicesRequest&& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListDevicesAsyncHelper, Aws::Client::RejectedAsyncCall<ListDevicesOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::ListDevicesAsyncHelper(const ListDevicesRequest& request, const ListDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -758,12 +958,22 @@ ListJobsOutcome DeviceFarmClient::ListJobs(const ListJobsRequest& request) const
 
 ListJobsOutcomeCallable DeviceFarmClient::ListJobsCallable(const ListJobsRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::ListJobs, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListJobs, Aws::Client::RejectedCallOutcome<ListJobsOutcome>(), this, request);
+}
+
+ListJobsOutcomeCallable DeviceFarmClient::ListJobsCallable(ListJobsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListJobs, Aws::Client::RejectedCallOutcome<ListJobsOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::ListJobsAsync(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::ListJobsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListJobsAsyncHelper, Aws::Client::RejectedAsyncCall<ListJobsOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::ListJobsAsync(ListJobsRequest&& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListJobsAsyncHelper, Aws::Client::RejectedAsyncCall<ListJobsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::ListJobsAsyncHelper(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -789,12 +999,22 @@ ListProjectsOutcome DeviceFarmClient::ListProjects(const ListProjectsRequest& re
 
 ListProjectsOutcomeCallable DeviceFarmClient::ListProjectsCallable(const ListProjectsRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::ListProjects, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListProjects, Aws::Client::RejectedCallOutcome<ListProjectsOutcome>(), this, request);
+}
+
+ListProjectsOutcomeCallable DeviceFarmClient::ListProjectsCallable(ListProjectsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListProjects, Aws::Client::RejectedCallOutcome<ListProjectsOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::ListProjectsAsync(const ListProjectsRequest& request, const ListProjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::ListProjectsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListProjectsAsyncHelper, Aws::Client::RejectedAsyncCall<ListProjectsOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::ListProjectsAsync(ListProjectsRequest&& request, const ListProjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListProjectsAsyncHelper, Aws::Client::RejectedAsyncCall<ListProjectsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::ListProjectsAsyncHelper(const ListProjectsRequest& request, const ListProjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -820,12 +1040,22 @@ ListRunsOutcome DeviceFarmClient::ListRuns(const ListRunsRequest& request) const
 
 ListRunsOutcomeCallable DeviceFarmClient::ListRunsCallable(const ListRunsRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::ListRuns, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListRuns, Aws::Client::RejectedCallOutcome<ListRunsOutcome>(), this, request);
+}
+
+ListRunsOutcomeCallable DeviceFarmClient::ListRunsCallable(ListRunsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListRuns, Aws::Client::RejectedCallOutcome<ListRunsOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::ListRunsAsync(const ListRunsRequest& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::ListRunsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListRunsAsyncHelper, Aws::Client::RejectedAsyncCall<ListRunsOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::ListRunsAsync(ListRunsRequest&& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListRunsAsyncHelper, Aws::Client::RejectedAsyncCall<ListRunsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::ListRunsAsyncHelper(const ListRunsRequest& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -851,12 +1081,22 @@ ListSamplesOutcome DeviceFarmClient::ListSamples(const ListSamplesRequest& reque
 
 ListSamplesOutcomeCallable DeviceFarmClient::ListSamplesCallable(const ListSamplesRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::ListSamples, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListSamples, Aws::Client::RejectedCallOutcome<ListSamplesOutcome>(), this, request);
+}
+
+ListSamplesOutcomeCallable DeviceFarmClient::ListSamplesCallable(ListSamplesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListSamples, Aws::Client::RejectedCallOutcome<ListSamplesOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::ListSamplesAsync(const ListSamplesRequest& request, const ListSamplesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::ListSamplesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListSamplesAsyncHelper, Aws::Client::RejectedAsyncCall<ListSamplesOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::ListSamplesAsync(ListSamplesRequest&& request, const ListSamplesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListSamplesAsyncHelper, Aws::Client::RejectedAsyncCall<ListSamplesOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::ListSamplesAsyncHelper(const ListSamplesRequest& request, const ListSamplesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -882,12 +1122,22 @@ ListSuitesOutcome DeviceFarmClient::ListSuites(const ListSuitesRequest& request)
 
 ListSuitesOutcomeCallable DeviceFarmClient::ListSuitesCallable(const ListSuitesRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::ListSuites, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListSuites, Aws::Client::RejectedCallOutcome<ListSuitesOutcome>(), this, request);
+}
+
+ListSuitesOutcomeCallable DeviceFarmClient::ListSuitesCallable(ListSuitesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListSuites, Aws::Client::RejectedCallOutcome<ListSuitesOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::ListSuitesAsync(const ListSuitesRequest& request, const ListSuitesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::ListSuitesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListSuitesAsyncHelper, Aws::Client::RejectedAsyncCall<ListSuitesOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::ListSuitesAsync(ListSuitesRequest&& request, const ListSuitesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListSuitesAsyncHelper, Aws::Client::RejectedAsyncCall<ListSuitesOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::ListSuitesAsyncHelper(const ListSuitesRequest& request, const ListSuitesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -913,12 +1163,22 @@ ListTestsOutcome DeviceFarmClient::ListTests(const ListTestsRequest& request) co
 
 ListTestsOutcomeCallable DeviceFarmClient::ListTestsCallable(const ListTestsRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::ListTests, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListTests, Aws::Client::RejectedCallOutcome<ListTestsOutcome>(), this, request);
+}
+
+ListTestsOutcomeCallable DeviceFarmClient::ListTestsCallable(ListTestsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListTests, Aws::Client::RejectedCallOutcome<ListTestsOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::ListTestsAsync(const ListTestsRequest& request, const ListTestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::ListTestsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListTestsAsyncHelper, Aws::Client::RejectedAsyncCall<ListTestsOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::ListTestsAsync(ListTestsRequest&& request, const ListTestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListTestsAsyncHelper, Aws::Client::RejectedAsyncCall<ListTestsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::ListTestsAsyncHelper(const ListTestsRequest& request, const ListTestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -944,12 +1204,22 @@ ListUniqueProblemsOutcome DeviceFarmClient::ListUniqueProblems(const ListUniqueP
 
 ListUniqueProblemsOutcomeCallable DeviceFarmClient::ListUniqueProblemsCallable(const ListUniqueProblemsRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::ListUniqueProblems, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListUniqueProblems, Aws::Client::RejectedCallOutcome<ListUniqueProblemsOutcome>(), this, request);
+}
+
+ListUniqueProblemsOutcomeCallable DeviceFarmClient::ListUniqueProblemsCallable(ListUniqueProblemsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListUniqueProblems, Aws::Client::RejectedCallOutcome<ListUniqueProblemsOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::ListUniqueProblemsAsync(const ListUniqueProblemsRequest& request, const ListUniqueProblemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::ListUniqueProblemsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListUniqueProblemsAsyncHelper, Aws::Client::RejectedAsyncCall<ListUniqueProblemsOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::ListUniqueProblemsAsync(ListUniqueProblemsRequest&& request, const ListUniqueProblemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListUniqueProblemsAsyncHelper, Aws::Client::RejectedAsyncCall<ListUniqueProblemsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::ListUniqueProblemsAsyncHelper(const ListUniqueProblemsRequest& request, const ListUniqueProblemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -975,12 +1245,22 @@ ListUploadsOutcome DeviceFarmClient::ListUploads(const ListUploadsRequest& reque
 
 ListUploadsOutcomeCallable DeviceFarmClient::ListUploadsCallable(const ListUploadsRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::ListUploads, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListUploads, Aws::Client::RejectedCallOutcome<ListUploadsOutcome>(), this, request);
+}
+
+ListUploadsOutcomeCallable DeviceFarmClient::ListUploadsCallable(ListUploadsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ListUploads, Aws::Client::RejectedCallOutcome<ListUploadsOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::ListUploadsAsync(const ListUploadsRequest& request, const ListUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::ListUploadsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListUploadsAsyncHelper, Aws::Client::RejectedAsyncCall<ListUploadsOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::ListUploadsAsync(ListUploadsRequest&& request, const ListUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::ListUploadsAsyncHelper, Aws::Client::RejectedAsyncCall<ListUploadsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::ListUploadsAsyncHelper(const ListUploadsRequest& request, const ListUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1006,12 +1286,22 @@ ScheduleRunOutcome DeviceFarmClient::ScheduleRun(const ScheduleRunRequest& reque
 
 ScheduleRunOutcomeCallable DeviceFarmClient::ScheduleRunCallable(const ScheduleRunRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::ScheduleRun, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ScheduleRun, Aws::Client::RejectedCallOutcome<ScheduleRunOutcome>(), this, request);
+}
+
+ScheduleRunOutcomeCallable DeviceFarmClient::ScheduleRunCallable(ScheduleRunRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::ScheduleRun, Aws::Client::RejectedCallOutcome<ScheduleRunOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::ScheduleRunAsync(const ScheduleRunRequest& request, const ScheduleRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::ScheduleRunAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::ScheduleRunAsyncHelper, Aws::Client::RejectedAsyncCall<ScheduleRunOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::ScheduleRunAsync(ScheduleRunRequest&& request, const ScheduleRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::ScheduleRunAsyncHelper, Aws::Client::RejectedAsyncCall<ScheduleRunOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::ScheduleRunAsyncHelper(const ScheduleRunRequest& request, const ScheduleRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1037,12 +1327,22 @@ UpdateDevicePoolOutcome DeviceFarmClient::UpdateDevicePool(const UpdateDevicePoo
 
 UpdateDevicePoolOutcomeCallable DeviceFarmClient::UpdateDevicePoolCallable(const UpdateDevicePoolRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::UpdateDevicePool, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::UpdateDevicePool, Aws::Client::RejectedCallOutcome<UpdateDevicePoolOutcome>(), this, request);
+}
+
+UpdateDevicePoolOutcomeCallable DeviceFarmClient::UpdateDevicePoolCallable(UpdateDevicePoolRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::UpdateDevicePool, Aws::Client::RejectedCallOutcome<UpdateDevicePoolOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::UpdateDevicePoolAsync(const UpdateDevicePoolRequest& request, const UpdateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::UpdateDevicePoolAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::UpdateDevicePoolAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDevicePoolOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::UpdateDevicePoolAsync(UpdateDevicePoolRequest&& request, const UpdateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::UpdateDevicePoolAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDevicePoolOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::UpdateDevicePoolAsyncHelper(const UpdateDevicePoolRequest& request, const UpdateDevicePoolResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1068,12 +1368,22 @@ UpdateProjectOutcome DeviceFarmClient::UpdateProject(const UpdateProjectRequest&
 
 UpdateProjectOutcomeCallable DeviceFarmClient::UpdateProjectCallable(const UpdateProjectRequest& request) const
 {
-  return std::async(std::launch::async, &DeviceFarmClient::UpdateProject, this, request);
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::UpdateProject, Aws::Client::RejectedCallOutcome<UpdateProjectOutcome>(), this, request);
+}
+
+UpdateProjectOutcomeCallable DeviceFarmClient::UpdateProjectCallable(UpdateProjectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DeviceFarmClient::UpdateProject, Aws::Client::RejectedCallOutcome<UpdateProjectOutcome>(), this, std::move(request));
 }
 
 void DeviceFarmClient::UpdateProjectAsync(const UpdateProjectRequest& request, const UpdateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DeviceFarmClient::UpdateProjectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DeviceFarmClient::UpdateProjectAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateProjectOutcome>(), this, request, handler, context);
+}
+
+void DeviceFarmClient::UpdateProjectAsync(UpdateProjectRequest&& request, const UpdateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DeviceFarmClient::UpdateProjectAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateProjectOutcome>(), this, std::move(request), handler, context);
 }
 
 void DeviceFarmClient::UpdateProjectAsyncHelper(const UpdateProjectRequest& request, const UpdateProjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -41,6 +41,27 @@
 #include <aws/directconnect/model/DescribeVirtualInterfacesResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/directconnect/model/AllocateConnectionOnInterconnectRequest.h>
+#include <aws/directconnect/model/AllocatePrivateVirtualInterfaceRequest.h>
+#include <aws/directconnect/model/AllocatePublicVirtualInterfaceRequest.h>
+#include <aws/directconnect/model/ConfirmConnectionRequest.h>
+#include <aws/directconnect/model/ConfirmPrivateVirtualInterfaceRequest.h>
+#include <aws/directconnect/model/ConfirmPublicVirtualInterfaceRequest.h>
+#include <aws/directconnect/model/CreateConnectionRequest.h>
+#include <aws/directconnect/model/CreateInterconnectRequest.h>
+#include <aws/directconnect/model/CreatePrivateVirtualInterfaceRequest.h>
+#include <aws/directconnect/model/CreatePublicVirtualInterfaceRequest.h>
+#include <aws/directconnect/model/DeleteConnectionRequest.h>
+#include <aws/directconnect/model/DeleteInterconnectRequest.h>
+#include <aws/directconnect/model/DeleteVirtualInterfaceRequest.h>
+#include <aws/directconnect/model/DescribeConnectionsRequest.h>
+#include <aws/directconnect/model/DescribeConnectionsOnInterconnectRequest.h>
+#include <aws/directconnect/model/DescribeInterconnectsRequest.h>
+#include <aws/directconnect/model/DescribeVirtualInterfacesRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -222,6 +243,11 @@ namespace Model
          */
         virtual Model::AllocateConnectionOnInterconnectOutcomeCallable AllocateConnectionOnInterconnectCallable(const Model::AllocateConnectionOnInterconnectRequest& request) const;
 
+        /**
+         * Same as AllocateConnectionOnInterconnectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AllocateConnectionOnInterconnectOutcomeCallable AllocateConnectionOnInterconnectCallable(Model::AllocateConnectionOnInterconnectRequest&& request) const;
+
         /**
          * <p>Creates a hosted connection on an interconnect.</p> <p>Allocates a VLAN
          * number and a specified amount of bandwidth for use by a hosted connection on the
@@ -231,6 +257,11 @@ namespace Model
          */
         virtual void AllocateConnectionOnInterconnectAsync(const Model::AllocateConnectionOnInterconnectRequest& request, const AllocateConnectionOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AllocateConnectionOnInterconnectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AllocateConnectionOnInterconnectAsync(Model::AllocateConnectionOnInterconnectRequest&& request, const AllocateConnectionOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provisions a private virtual interface to be owned by a different
          * customer.</p> <p>The owner of a connection calls this function to provision a
@@ -255,6 +286,11 @@ namespace Model
          */
         virtual Model::AllocatePrivateVirtualInterfaceOutcomeCallable AllocatePrivateVirtualInterfaceCallable(const Model::AllocatePrivateVirtualInterfaceRequest& request) const;
 
+        /**
+         * Same as AllocatePrivateVirtualInterfaceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AllocatePrivateVirtualInterfaceOutcomeCallable AllocatePrivateVirtualInterfaceCallable(Model::AllocatePrivateVirtualInterfaceRequest&& request) const;
+
         /**
          * <p>Provisions a private virtual interface to be owned by a different
          * customer.</p> <p>The owner of a connection calls this function to provision a
@@ -268,6 +304,11 @@ namespace Model
          */
         virtual void AllocatePrivateVirtualInterfaceAsync(const Model::AllocatePrivateVirtualInterfaceRequest& request, const AllocatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AllocatePrivateVirtualInterfaceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AllocatePrivateVirtualInterfaceAsync(Model::AllocatePrivateVirtualInterfaceRequest&& request, const AllocatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provisions a public virtual interface to be owned by a different
          * customer.</p> <p>The owner of a connection calls this function to provision a
@@ -292,6 +333,11 @@ namespace Model
          */
         virtual Model::AllocatePublicVirtualInterfaceOutcomeCallable AllocatePublicVirtualInterfaceCallable(const Model::AllocatePublicVirtualInterfaceRequest& request) const;
 
+        /**
+         * Same as AllocatePublicVirtualInterfaceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AllocatePublicVirtualInterfaceOutcomeCallable AllocatePublicVirtualInterfaceCallable(Model::AllocatePublicVirtualInterfaceRequest&& request) const;
+
         /**
          * <p>Provisions a public virtual interface to be owned by a different
          * customer.</p> <p>The owner of a connection calls this function to provision a
@@ -305,6 +351,11 @@ namespace Model
          */
         virtual void AllocatePublicVirtualInterfaceAsync(const Model::AllocatePublicVirtualInterfaceRequest& request, const AllocatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AllocatePublicVirtualInterfaceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AllocatePublicVirtualInterfaceAsync(Model::AllocatePublicVirtualInterfaceRequest&& request, const AllocatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Confirm the creation of a hosted connection on an interconnect.</p> <p>Upon
          * creation, the hosted connection is initially in the 'Ordering' state, and will
@@ -323,6 +374,11 @@ namespace Model
          */
         virtual Model::ConfirmConnectionOutcomeCallable ConfirmConnectionCallable(const Model::ConfirmConnectionRequest& request) const;
 
+        /**
+         * Same as ConfirmConnectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ConfirmConnectionOutcomeCallable ConfirmConnectionCallable(Model::ConfirmConnectionRequest&& request) const;
+
         /**
          * <p>Confirm the creation of a hosted connection on an interconnect.</p> <p>Upon
          * creation, the hosted connection is initially in the 'Ordering' state, and will
@@ -333,6 +389,11 @@ namespace Model
          */
         virtual void ConfirmConnectionAsync(const Model::ConfirmConnectionRequest& request, const ConfirmConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfirmConnectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ConfirmConnectionAsync(Model::ConfirmConnectionRequest&& request, const ConfirmConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Accept ownership of a private virtual interface created by another
          * customer.</p> <p>After the virtual interface owner calls this function, the
@@ -351,6 +412,11 @@ namespace Model
          */
         virtual Model::ConfirmPrivateVirtualInterfaceOutcomeCallable ConfirmPrivateVirtualInterfaceCallable(const Model::ConfirmPrivateVirtualInterfaceRequest& request) const;
 
+        /**
+         * Same as ConfirmPrivateVirtualInterfaceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ConfirmPrivateVirtualInterfaceOutcomeCallable ConfirmPrivateVirtualInterfaceCallable(Model::ConfirmPrivateVirtualInterfaceRequest&& request) const;
+
         /**
          * <p>Accept ownership of a private virtual interface created by another
          * customer.</p> <p>After the virtual interface owner calls this function, the
@@ -361,6 +427,11 @@ namespace Model
          */
         virtual void ConfirmPrivateVirtualInterfaceAsync(const Model::ConfirmPrivateVirtualInterfaceRequest& request, const ConfirmPrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfirmPrivateVirtualInterfaceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ConfirmPrivateVirtualInterfaceAsync(Model::ConfirmPrivateVirtualInterfaceRequest&& request, const ConfirmPrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Accept ownership of a public virtual interface created by another
          * customer.</p> <p>After the virtual interface owner calls this function, the
@@ -379,6 +450,11 @@ namespace Model
          */
         virtual Model::ConfirmPublicVirtualInterfaceOutcomeCallable ConfirmPublicVirtualInterfaceCallable(const Model::ConfirmPublicVirtualInterfaceRequest& request) const;
 
+        /**
+         * Same as ConfirmPublicVirtualInterfaceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ConfirmPublicVirtualInterfaceOutcomeCallable ConfirmPublicVirtualInterfaceCallable(Model::ConfirmPublicVirtualInterfaceRequest&& request) const;
+
         /**
          * <p>Accept ownership of a public virtual interface created by another
          * customer.</p> <p>After the virtual interface owner calls this function, the
@@ -389,6 +465,11 @@ namespace Model
          */
         virtual void ConfirmPublicVirtualInterfaceAsync(const Model::ConfirmPublicVirtualInterfaceRequest& request, const ConfirmPublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfirmPublicVirtualInterfaceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ConfirmPublicVirtualInterfaceAsync(Model::ConfirmPublicVirtualInterfaceRequest&& request, const ConfirmPublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new connection between the customer network and a specific AWS
          * Direct Connect location.</p> <p>A connection links your internal network to an
@@ -415,6 +496,11 @@ namespace Model
          */
         virtual Model::CreateConnectionOutcomeCallable CreateConnectionCallable(const Model::CreateConnectionRequest& request) const;
 
+        /**
+         * Same as CreateConnectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateConnectionOutcomeCallable CreateConnectionCallable(Model::CreateConnectionRequest&& request) const;
+
         /**
          * <p>Creates a new connection between the customer network and a specific AWS
          * Direct Connect location.</p> <p>A connection links your internal network to an
@@ -429,6 +515,11 @@ namespace Model
          */
         virtual void CreateConnectionAsync(const Model::CreateConnectionRequest& request, const CreateConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateConnectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateConnectionAsync(Model::CreateConnectionRequest&& request, const CreateConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new interconnect between a AWS Direct Connect partner's network and
          * a specific AWS Direct Connect location.</p> <p>An interconnect is a connection
@@ -465,6 +556,11 @@ namespace Model
          */
         virtual Model::CreateInterconnectOutcomeCallable CreateInterconnectCallable(const Model::CreateInterconnectRequest& request) const;
 
+        /**
+         * Same as CreateInterconnectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateInterconnectOutcomeCallable CreateInterconnectCallable(Model::CreateInterconnectRequest&& request) const;
+
         /**
          * <p>Creates a new interconnect between a AWS Direct Connect partner's network and
          * a specific AWS Direct Connect location.</p> <p>An interconnect is a connection
@@ -484,6 +580,11 @@ namespace Model
          */
         virtual void CreateInterconnectAsync(const Model::CreateInterconnectRequest& request, const CreateInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateInterconnectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateInterconnectAsync(Model::CreateInterconnectRequest&& request, const CreateInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new private virtual interface. A virtual interface is the VLAN that
          * transports AWS Direct Connect traffic. A private virtual interface supports
@@ -500,6 +601,11 @@ namespace Model
          */
         virtual Model::CreatePrivateVirtualInterfaceOutcomeCallable CreatePrivateVirtualInterfaceCallable(const Model::CreatePrivateVirtualInterfaceRequest& request) const;
 
+        /**
+         * Same as CreatePrivateVirtualInterfaceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePrivateVirtualInterfaceOutcomeCallable CreatePrivateVirtualInterfaceCallable(Model::CreatePrivateVirtualInterfaceRequest&& request) const;
+
         /**
          * <p>Creates a new private virtual interface. A virtual interface is the VLAN that
          * transports AWS Direct Connect traffic. A private virtual interface supports
@@ -509,6 +615,11 @@ namespace Model
          */
         virtual void CreatePrivateVirtualInterfaceAsync(const Model::CreatePrivateVirtualInterfaceRequest& request, const CreatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePrivateVirtualInterfaceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePrivateVirtualInterfaceAsync(Model::CreatePrivateVirtualInterfaceRequest&& request, const CreatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new public virtual interface. A virtual interface is the VLAN that
          * transports AWS Direct Connect traffic. A public virtual interface supports
@@ -527,6 +638,11 @@ namespace Model
          */
         virtual Model::CreatePublicVirtualInterfaceOutcomeCallable CreatePublicVirtualInterfaceCallable(const Model::CreatePublicVirtualInterfaceRequest& request) const;
 
+        /**
+         * Same as CreatePublicVirtualInterfaceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePublicVirtualInterfaceOutcomeCallable CreatePublicVirtualInterfaceCallable(Model::CreatePublicVirtualInterfaceRequest&& request) const;
+
         /**
          * <p>Creates a new public virtual interface. A virtual interface is the VLAN that
          * transports AWS Direct Connect traffic. A public virtual interface supports
@@ -537,6 +653,11 @@ namespace Model
          */
         virtual void CreatePublicVirtualInterfaceAsync(const Model::CreatePublicVirtualInterfaceRequest& request, const CreatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePublicVirtualInterfaceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePublicVirtualInterfaceAsync(Model::CreatePublicVirtualInterfaceRequest&& request, const CreatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the connection.</p> <p>Deleting a connection only stops the AWS
          * Direct Connect port hour and data transfer charges. You need to cancel
@@ -555,6 +676,11 @@ namespace Model
          */
         virtual Model::DeleteConnectionOutcomeCallable DeleteConnectionCallable(const Model::DeleteConnectionRequest& request) const;
 
+        /**
+         * Same as DeleteConnectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteConnectionOutcomeCallable DeleteConnectionCallable(Model::DeleteConnectionRequest&& request) const;
+
         /**
          * <p>Deletes the connection.</p> <p>Deleting a connection only stops the AWS
          * Direct Connect port hour and data transfer charges. You need to cancel
@@ -565,6 +691,11 @@ namespace Model
          */
         virtual void DeleteConnectionAsync(const Model::DeleteConnectionRequest& request, const DeleteConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteConnectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteConnectionAsync(Model::DeleteConnectionRequest&& request, const DeleteConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified interconnect.</p>
          */
@@ -577,6 +708,11 @@ namespace Model
          */
         virtual Model::DeleteInterconnectOutcomeCallable DeleteInterconnectCallable(const Model::DeleteInterconnectRequest& request) const;
 
+        /**
+         * Same as DeleteInterconnectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteInterconnectOutcomeCallable DeleteInterconnectCallable(Model::DeleteInterconnectRequest&& request) const;
+
         /**
          * <p>Deletes the specified interconnect.</p>
          *
@@ -584,6 +720,11 @@ namespace Model
          */
         virtual void DeleteInterconnectAsync(const Model::DeleteInterconnectRequest& request, const DeleteInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteInterconnectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteInterconnectAsync(Model::DeleteInterconnectRequest&& request, const DeleteInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a virtual interface.</p>
          */
@@ -596,6 +737,11 @@ namespace Model
          */
         virtual Model::DeleteVirtualInterfaceOutcomeCallable DeleteVirtualInterfaceCallable(const Model::DeleteVirtualInterfaceRequest& request) const;
 
+        /**
+         * Same as DeleteVirtualInterfaceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteVirtualInterfaceOutcomeCallable DeleteVirtualInterfaceCallable(Model::DeleteVirtualInterfaceRequest&& request) const;
+
         /**
          * <p>Deletes a virtual interface.</p>
          *
@@ -603,6 +749,11 @@ namespace Model
          */
         virtual void DeleteVirtualInterfaceAsync(const Model::DeleteVirtualInterfaceRequest& request, const DeleteVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVirtualInterfaceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteVirtualInterfaceAsync(Model::DeleteVirtualInterfaceRequest&& request, const DeleteVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Displays all connections in this region.</p> <p>If a connection ID is
          * provided, the call returns only that particular connection.</p>
@@ -617,6 +768,11 @@ namespace Model
          */
         virtual Model::DescribeConnectionsOutcomeCallable DescribeConnectionsCallable(const Model::DescribeConnectionsRequest& request) const;
 
+        /**
+         * Same as DescribeConnectionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeConnectionsOutcomeCallable DescribeConnectionsCallable(Model::DescribeConnectionsRequest&& request) const;
+
         /**
          * <p>Displays all connections in this region.</p> <p>If a connection ID is
          * provided, the call returns only that particular connection.</p>
@@ -625,6 +781,11 @@ namespace Model
          */
         virtual void DescribeConnectionsAsync(const Model::DescribeConnectionsRequest& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConnectionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeConnectionsAsync(Model::DescribeConnectionsRequest&& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Return a list of connections that have been provisioned on the given
          * interconnect.</p>
@@ -639,6 +800,11 @@ namespace Model
          */
         virtual Model::DescribeConnectionsOnInterconnectOutcomeCallable DescribeConnectionsOnInterconnectCallable(const Model::DescribeConnectionsOnInterconnectRequest& request) const;
 
+        /**
+         * Same as DescribeConnectionsOnInterconnectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeConnectionsOnInterconnectOutcomeCallable DescribeConnectionsOnInterconnectCallable(Model::DescribeConnectionsOnInterconnectRequest&& request) const;
+
         /**
          * <p>Return a list of connections that have been provisioned on the given
          * interconnect.</p>
@@ -647,6 +813,11 @@ namespace Model
          */
         virtual void DescribeConnectionsOnInterconnectAsync(const Model::DescribeConnectionsOnInterconnectRequest& request, const DescribeConnectionsOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConnectionsOnInterconnectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeConnectionsOnInterconnectAsync(Model::DescribeConnectionsOnInterconnectRequest&& request, const DescribeConnectionsOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of interconnects owned by the AWS account.</p> <p>If an
          * interconnect ID is provided, it will only return this particular
@@ -663,6 +834,11 @@ namespace Model
          */
         virtual Model::DescribeInterconnectsOutcomeCallable DescribeInterconnectsCallable(const Model::DescribeInterconnectsRequest& request) const;
 
+        /**
+         * Same as DescribeInterconnectsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeInterconnectsOutcomeCallable DescribeInterconnectsCallable(Model::DescribeInterconnectsRequest&& request) const;
+
         /**
          * <p>Returns a list of interconnects owned by the AWS account.</p> <p>If an
          * interconnect ID is provided, it will only return this particular
@@ -672,6 +848,11 @@ namespace Model
          */
         virtual void DescribeInterconnectsAsync(const Model::DescribeInterconnectsRequest& request, const DescribeInterconnectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInterconnectsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeInterconnectsAsync(Model::DescribeInterconnectsRequest&& request, const DescribeInterconnectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the list of AWS Direct Connect locations in the current AWS region.
          * These are the locations that may be selected when calling CreateConnection or
@@ -757,6 +938,11 @@ namespace Model
          */
         virtual Model::DescribeVirtualInterfacesOutcomeCallable DescribeVirtualInterfacesCallable(const Model::DescribeVirtualInterfacesRequest& request) const;
 
+        /**
+         * Same as DescribeVirtualInterfacesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVirtualInterfacesOutcomeCallable DescribeVirtualInterfacesCallable(Model::DescribeVirtualInterfacesRequest&& request) const;
+
         /**
          * <p>Displays all virtual interfaces for an AWS account. Virtual interfaces
          * deleted fewer than 15 minutes before DescribeVirtualInterfaces is called are
@@ -772,6 +958,54 @@ namespace Model
          */
         virtual void DescribeVirtualInterfacesAsync(const Model::DescribeVirtualInterfacesRequest& request, const DescribeVirtualInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVirtualInterfacesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVirtualInterfacesAsync(Model::DescribeVirtualInterfacesRequest&& request, const DescribeVirtualInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AllocateConnectionOnInterconnectOutcome> AllocateConnectionOnInterconnectAwaitable(const Model::AllocateConnectionOnInterconnectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::AllocateConnectionOnInterconnect, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AllocateConnectionOnInterconnectOutcome> AllocateConnectionOnInterconnectAwaitable(Model::AllocateConnectionOnInterconnectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::AllocateConnectionOnInterconnect, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AllocatePrivateVirtualInterfaceOutcome> AllocatePrivateVirtualInterfaceAwaitable(const Model::AllocatePrivateVirtualInterfaceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::AllocatePrivateVirtualInterface, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AllocatePrivateVirtualInterfaceOutcome> AllocatePrivateVirtualInterfaceAwaitable(Model::AllocatePrivateVirtualInterfaceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::AllocatePrivateVirtualInterface, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AllocatePublicVirtualInterfaceOutcome> AllocatePublicVirtualInterfaceAwaitable(const Model::AllocatePublicVirtualInterfaceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::AllocatePublicVirtualInterface, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AllocatePublicVirtualInterfaceOutcome> AllocatePublicVirtualInterfaceAwaitable(Model::AllocatePublicVirtualInterfaceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::AllocatePublicVirtualInterface, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ConfirmConnectionOutcome> ConfirmConnectionAwaitable(const Model::ConfirmConnectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::ConfirmConnection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ConfirmConnectionOutcome> ConfirmConnectionAwaitable(Model::ConfirmConnectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::ConfirmConnection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ConfirmPrivateVirtualInterfaceOutcome> ConfirmPrivateVirtualInterfaceAwaitable(const Model::ConfirmPrivateVirtualInterfaceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::ConfirmPrivateVirtualInterface, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ConfirmPrivateVirtualInterfaceOutcome> ConfirmPrivateVirtualInterfaceAwaitable(Model::ConfirmPrivateVirtualInterfaceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::ConfirmPrivateVirtualInterface, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ConfirmPublicVirtualInterfaceOutcome> ConfirmPublicVirtualInterfaceAwaitable(const Model::ConfirmPublicVirtualInterfaceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::ConfirmPublicVirtualInterface, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ConfirmPublicVirtualInterfaceOutcome> ConfirmPublicVirtualInterfaceAwaitable(Model::ConfirmPublicVirtualInterfaceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::ConfirmPublicVirtualInterface, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateConnectionOutcome> CreateConnectionAwaitable(const Model::CreateConnectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::CreateConnection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateConnectionOutcome> CreateConnectionAwaitable(Model::CreateConnectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::CreateConnection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateInterconnectOutcome> CreateInterconnectAwaitable(const Model::CreateInterconnectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::CreateInterconnect, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateInterconnectOutcome> CreateInterconnectAwaitable(Model::CreateInterconnectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::CreateInterconnect, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePrivateVirtualInterfaceOutcome> CreatePrivateVirtualInterfaceAwaitable(const Model::CreatePrivateVirtualInterfaceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::CreatePrivateVirtualInterface, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePrivateVirtualInterfaceOutcome> CreatePrivateVirtualInterfaceAwaitable(Model::CreatePrivateVirtualInterfaceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::CreatePrivateVirtualInterface, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePublicVirtualInterfaceOutcome> CreatePublicVirtualInterfaceAwaitable(const Model::CreatePublicVirtualInterfaceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::CreatePublicVirtualInterface, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePublicVirtualInterfaceOutcome> CreatePublicVirtualInterfaceAwaitable(Model::CreatePublicVirtualInterfaceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::CreatePublicVirtualInterface, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteConnectionOutcome> DeleteConnectionAwaitable(const Model::DeleteConnectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DeleteConnection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteConnectionOutcome> DeleteConnectionAwaitable(Model::DeleteConnectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DeleteConnection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteInterconnectOutcome> DeleteInterconnectAwaitable(const Model::DeleteInterconnectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DeleteInterconnect, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteInterconnectOutcome> DeleteInterconnectAwaitable(Model::DeleteInterconnectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DeleteInterconnect, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVirtualInterfaceOutcome> DeleteVirtualInterfaceAwaitable(const Model::DeleteVirtualInterfaceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DeleteVirtualInterface, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVirtualInterfaceOutcome> DeleteVirtualInterfaceAwaitable(Model::DeleteVirtualInterfaceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DeleteVirtualInterface, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConnectionsOutcome> DescribeConnectionsAwaitable(const Model::DescribeConnectionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DescribeConnections, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConnectionsOutcome> DescribeConnectionsAwaitable(Model::DescribeConnectionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DescribeConnections, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConnectionsOnInterconnectOutcome> DescribeConnectionsOnInterconnectAwaitable(const Model::DescribeConnectionsOnInterconnectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DescribeConnectionsOnInterconnect, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConnectionsOnInterconnectOutcome> DescribeConnectionsOnInterconnectAwaitable(Model::DescribeConnectionsOnInterconnectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DescribeConnectionsOnInterconnect, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInterconnectsOutcome> DescribeInterconnectsAwaitable(const Model::DescribeInterconnectsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DescribeInterconnects, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInterconnectsOutcome> DescribeInterconnectsAwaitable(Model::DescribeInterconnectsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DescribeInterconnects, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLocationsOutcome> DescribeLocationsAwaitable() const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DescribeLocations, this); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVirtualGatewaysOutcome> DescribeVirtualGatewaysAwaitable() const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DescribeVirtualGateways, this); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVirtualInterfacesOutcome> DescribeVirtualInterfacesAwaitable(const Model::DescribeVirtualInterfacesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DescribeVirtualInterfaces, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVirtualInterfacesOutcome> DescribeVirtualInterfacesAwaitable(Model::DescribeVirtualInterfacesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectConnectClient::DescribeVirtualInterfaces, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
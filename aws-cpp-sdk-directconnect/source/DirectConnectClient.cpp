@@ -124,12 +124,22 @@ AllocateConnectionOnInterconnectOutcome DirectConnectClient::AllocateConnectionO
 
 AllocateConnectionOnInterconnectOutcomeCallable DirectConnectClient::AllocateConnectionOnInterconnectCallable(const AllocateConnectionOnInterconnectRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::AllocateConnectionOnInterconnect, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::AllocateConnectionOnInterconnect, Aws::Client::RejectedCallOutcome<AllocateConnectionOnInterconnectOutcome>(), this, request);
+}
+
+AllocateConnectionOnInterconnectOutcomeCallable DirectConnectClient::AllocateConnectionOnInterconnectCallable(AllocateConnectionOnInterconnectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::AllocateConnectionOnInterconnect, Aws::Client::RejectedCallOutcome<AllocateConnectionOnInterconnectOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::AllocateConnectionOnInterconnectAsync(const AllocateConnectionOnInterconnectRequest& request, const AllocateConnectionOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::AllocateConnectionOnInterconnectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::AllocateConnectionOnInterconnectAsyncHelper, Aws::Client::RejectedAsyncCall<AllocateConnectionOnInterconnectOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::AllocateConnectionOnInterconnectAsync(AllocateConnectionOnInterconnectRequest&& request, const AllocateConnectionOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::AllocateConnectionOnInterconnectAsyncHelper, Aws::Client::RejectedAsyncCall<AllocateConnectionOnInterconnectOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::AllocateConnectionOnInterconnectAsyncHelper(const AllocateConnectionOnInterconnectRequest& request, const AllocateConnectionOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -155,12 +165,22 @@ AllocatePrivateVirtualInterfaceOutcome DirectConnectClient::AllocatePrivateVirtu
 
 AllocatePrivateVirtualInterfaceOutcomeCallable DirectConnectClient::AllocatePrivateVirtualInterfaceCallable(const AllocatePrivateVirtualInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::AllocatePrivateVirtualInterface, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::AllocatePrivateVirtualInterface, Aws::Client::RejectedCallOutcome<AllocatePrivateVirtualInterfaceOutcome>(), this, request);
+}
+
+AllocatePrivateVirtualInterfaceOutcomeCallable DirectConnectClient::AllocatePrivateVirtualInterfaceCallable(AllocatePrivateVirtualInterfaceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::AllocatePrivateVirtualInterface, Aws::Client::RejectedCallOutcome<AllocatePrivateVirtualInterfaceOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::AllocatePrivateVirtualInterfaceAsync(const AllocatePrivateVirtualInterfaceRequest& request, const AllocatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::AllocatePrivateVirtualInterfaceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::AllocatePrivateVirtualInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<AllocatePrivateVirtualInterfaceOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::AllocatePrivateVirtualInterfaceAsync(AllocatePrivateVirtualInterfaceRequest&& request, const AllocatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::AllocatePrivateVirtualInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<AllocatePrivateVirtualInterfaceOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::AllocatePrivateVirtualInterfaceAsyncHelper(const AllocatePrivateVirtualInterfaceRequest& request, const AllocatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -186,12 +206,22 @@ AllocatePublicVirtualInterfaceOutcome DirectConnectClient::AllocatePublicVirtual
 
 AllocatePublicVirtualInterfaceOutcomeCallable DirectConnectClient::AllocatePublicVirtualInterfaceCallable(const AllocatePublicVirtualInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::AllocatePublicVirtualInterface, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::AllocatePublicVirtualInterface, Aws::Client::RejectedCallOutcome<AllocatePublicVirtualInterfaceOutcome>(), this, request);
+}
+
+AllocatePublicVirtualInterfaceOutcomeCallable DirectConnectClient::AllocatePublicVirtualInterfaceCallable(AllocatePublicVirtualInterfaceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::AllocatePublicVirtualInterface, Aws::Client::RejectedCallOutcome<AllocatePublicVirtualInterfaceOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::AllocatePublicVirtualInterfaceAsync(const AllocatePublicVirtualInterfaceRequest& request, const AllocatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::AllocatePublicVirtualInterfaceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::AllocatePublicVirtualInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<AllocatePublicVirtualInterfaceOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::AllocatePublicVirtualInterfaceAsync(AllocatePublicVirtualInterfaceRequest&& request, const AllocatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::AllocatePublicVirtualInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<AllocatePublicVirtualInterfaceOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::AllocatePublicVirtualInterfaceAsyncHelper(const AllocatePublicVirtualInterfaceRequest& request, const AllocatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -217,12 +247,22 @@ ConfirmConnectionOutcome DirectConnectClient::ConfirmConnection(const ConfirmCon
 
 ConfirmConnectionOutcomeCallable DirectConnectClient::ConfirmConnectionCallable(const ConfirmConnectionRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::ConfirmConnection, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::ConfirmConnection, Aws::Client::RejectedCallOutcome<ConfirmConnectionOutcome>(), this, request);
+}
+
+ConfirmConnectionOutcomeCallable DirectConnectClient::ConfirmConnectionCallable(ConfirmConnectionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::ConfirmConnection, Aws::Client::RejectedCallOutcome<ConfirmConnectionOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::ConfirmConnectionAsync(const ConfirmConnectionRequest& request, const ConfirmConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::ConfirmConnectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::ConfirmConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<ConfirmConnectionOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::ConfirmConnectionAsync(ConfirmConnectionRequest&& request, const ConfirmConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::ConfirmConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<ConfirmConnectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::ConfirmConnectionAsyncHelper(const ConfirmConnectionRequest& request, const ConfirmConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -248,12 +288,22 @@ ConfirmPrivateVirtualInterfaceOutcome DirectConnectClient::ConfirmPrivateVirtual
 
 ConfirmPrivateVirtualInterfaceOutcomeCallable DirectConnectClient::ConfirmPrivateVirtualInterfaceCallable(const ConfirmPrivateVirtualInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::ConfirmPrivateVirtualInterface, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::ConfirmPrivateVirtualInterface, Aws::Client::RejectedCallOutcome<ConfirmPrivateVirtualInterfaceOutcome>(), this, request);
+}
+
+ConfirmPrivateVirtualInterfaceOutcomeCallable DirectConnectClient::ConfirmPrivateVirtualInterfaceCallable(ConfirmPrivateVirtualInterfaceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::ConfirmPrivateVirtualInterface, Aws::Client::RejectedCallOutcome<ConfirmPrivateVirtualInterfaceOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::ConfirmPrivateVirtualInterfaceAsync(const ConfirmPrivateVirtualInterfaceRequest& request, const ConfirmPrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::ConfirmPrivateVirtualInterfaceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::ConfirmPrivateVirtualInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<ConfirmPrivateVirtualInterfaceOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::ConfirmPrivateVirtualInterfaceAsync(ConfirmPrivateVirtualInterfaceRequest&& request, const ConfirmPrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::ConfirmPrivateVirtualInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<ConfirmPrivateVirtualInterfaceOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::ConfirmPrivateVirtualInterfaceAsyncHelper(const ConfirmPrivateVirtualInterfaceRequest& request, const ConfirmPrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -279,12 +329,22 @@ ConfirmPublicVirtualInterfaceOutcome DirectConnectClient::ConfirmPublicVirtualIn
 
 ConfirmPublicVirtualInterfaceOutcomeCallable DirectConnectClient::ConfirmPublicVirtualInterfaceCallable(const ConfirmPublicVirtualInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::ConfirmPublicVirtualInterface, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::ConfirmPublicVirtualInterface, Aws::Client::RejectedCallOutcome<ConfirmPublicVirtualInterfaceOutcome>(), this, request);
+}
+
+ConfirmPublicVirtualInterfaceOutcomeCallable DirectConnectClient::ConfirmPublicVirtualInterfaceCallable(ConfirmPublicVirtualInterfaceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::ConfirmPublicVirtualInterface, Aws::Client::RejectedCallOutcome<ConfirmPublicVirtualInterfaceOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::ConfirmPublicVirtualInterfaceAsync(const ConfirmPublicVirtualInterfaceRequest& request, const ConfirmPublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::ConfirmPublicVirtualInterfaceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::ConfirmPublicVirtualInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<ConfirmPublicVirtualInterfaceOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::ConfirmPublicVirtualInterfaceAsync(ConfirmPublicVirtualInterfaceRequest&& request, const ConfirmPublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::ConfirmPublicVirtualInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<ConfirmPublicVirtualInterfaceOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::ConfirmPublicVirtualInterfaceAsyncHelper(const ConfirmPublicVirtualInterfaceRequest& request, const ConfirmPublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -310,12 +370,22 @@ CreateConnectionOutcome DirectConnectClient::CreateConnection(const CreateConnec
 
 CreateConnectionOutcomeCallable DirectConnectClient::CreateConnectionCallable(const CreateConnectionRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::CreateConnection, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::CreateConnection, Aws::Client::RejectedCallOutcome<CreateConnectionOutcome>(), this, request);
+}
+
+CreateConnectionOutcomeCallable DirectConnectClient::CreateConnectionCallable(CreateConnectionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::CreateConnection, Aws::Client::RejectedCallOutcome<CreateConnectionOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::CreateConnectionAsync(const CreateConnectionRequest& request, const CreateConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::CreateConnectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::CreateConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateConnectionOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::CreateConnectionAsync(CreateConnectionRequest&& request, const CreateConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::CreateConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateConnectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::CreateConnectionAsyncHelper(const CreateConnectionRequest& request, const CreateConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -341,12 +411,22 @@ CreateInterconnectOutcome DirectConnectClient::CreateInterconnect(const CreateIn
 
 CreateInterconnectOutcomeCallable DirectConnectClient::CreateInterconnectCallable(const CreateInterconnectRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::CreateInterconnect, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::CreateInterconnect, Aws::Client::RejectedCallOutcome<CreateInterconnectOutcome>(), this, request);
+}
+
+CreateInterconnectOutcomeCallable DirectConnectClient::CreateInterconnectCallable(CreateInterconnectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::CreateInterconnect, Aws::Client::RejectedCallOutcome<CreateInterconnectOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::CreateInterconnectAsync(const CreateInterconnectRequest& request, const CreateInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::CreateInterconnectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::CreateInterconnectAsyncHelper, Aws::Client::RejectedAsyncCall<CreateInterconnectOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::CreateInterconnectAsync(CreateInterconnectRequest&& request, const CreateInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::CreateInterconnectAsyncHelper, Aws::Client::RejectedAsyncCall<CreateInterconnectOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::CreateInterconnectAsyncHelper(const CreateInterconnectRequest& request, const CreateInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -372,12 +452,22 @@ CreatePrivateVirtualInterfaceOutcome DirectConnectClient::CreatePrivateVirtualIn
 
 CreatePrivateVirtualInterfaceOutcomeCallable DirectConnectClient::CreatePrivateVirtualInterfaceCallable(const CreatePrivateVirtualInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::CreatePrivateVirtualInterface, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::CreatePrivateVirtualInterface, Aws::Client::RejectedCallOutcome<CreatePrivateVirtualInterfaceOutcome>(), this, request);
+}
+
+CreatePrivateVirtualInterfaceOutcomeCallable DirectConnectClient::CreatePrivateVirtualInterfaceCallable(CreatePrivateVirtualInterfaceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::CreatePrivateVirtualInterface, Aws::Client::RejectedCallOutcome<CreatePrivateVirtualInterfaceOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::CreatePrivateVirtualInterfaceAsync(const CreatePrivateVirtualInterfaceRequest& request, const CreatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::CreatePrivateVirtualInterfaceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::CreatePrivateVirtualInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePrivateVirtualInterfaceOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::CreatePrivateVirtualInterfaceAsync(CreatePrivateVirtualInterfaceRequest&& request, const CreatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::CreatePrivateVirtualInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePrivateVirtualInterfaceOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::CreatePrivateVirtualInterfaceAsyncHelper(const CreatePrivateVirtualInterfaceRequest& request, const CreatePrivateVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -403,12 +493,22 @@ CreatePublicVirtualInterfaceOutcome DirectConnectClient::CreatePublicVirtualInte
 
 CreatePublicVirtualInterfaceOutcomeCallable DirectConnectClient::CreatePublicVirtualInterfaceCallable(const CreatePublicVirtualInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::CreatePublicVirtualInterface, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::CreatePublicVirtualInterface, Aws::Client::RejectedCallOutcome<CreatePublicVirtualInterfaceOutcome>(), this, request);
+}
+
+CreatePublicVirtualInterfaceOutcomeCallable DirectConnectClient::CreatePublicVirtualInterfaceCallable(CreatePublicVirtualInterfaceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::CreatePublicVirtualInterface, Aws::Client::RejectedCallOutcome<CreatePublicVirtualInterfaceOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::CreatePublicVirtualInterfaceAsync(const CreatePublicVirtualInterfaceRequest& request, const CreatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::CreatePublicVirtualInterfaceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::CreatePublicVirtualInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePublicVirtualInterfaceOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::CreatePublicVirtualInterfaceAsync(CreatePublicVirtualInterfaceRequest&& request, const CreatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::CreatePublicVirtualInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePublicVirtualInterfaceOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::CreatePublicVirtualInterfaceAsyncHelper(const CreatePublicVirtualInterfaceRequest& request, const CreatePublicVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -434,12 +534,22 @@ DeleteConnectionOutcome DirectConnectClient::DeleteConnection(const DeleteConnec
 
 DeleteConnectionOutcomeCallable DirectConnectClient::DeleteConnectionCallable(const DeleteConnectionRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::DeleteConnection, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DeleteConnection, Aws::Client::RejectedCallOutcome<DeleteConnectionOutcome>(), this, request);
+}
+
+DeleteConnectionOutcomeCallable DirectConnectClient::DeleteConnectionCallable(DeleteConnectionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DeleteConnection, Aws::Client::RejectedCallOutcome<DeleteConnectionOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::DeleteConnectionAsync(const DeleteConnectionRequest& request, const DeleteConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::DeleteConnectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::DeleteConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteConnectionOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::DeleteConnectionAsync(DeleteConnectionRequest&& request, const DeleteConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::DeleteConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteConnectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::DeleteConnectionAsyncHelper(const DeleteConnectionRequest& request, const DeleteConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -465,12 +575,22 @@ DeleteInterconnectOutcome DirectConnectClient::DeleteInterconnect(const DeleteIn
 
 DeleteInterconnectOutcomeCallable DirectConnectClient::DeleteInterconnectCallable(const DeleteInterconnectRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::DeleteInterconnect, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DeleteInterconnect, Aws::Client::RejectedCallOutcome<DeleteInterconnectOutcome>(), this, request);
+}
+
+DeleteInterconnectOutcomeCallable DirectConnectClient::DeleteInterconnectCallable(DeleteInterconnectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DeleteInterconnect, Aws::Client::RejectedCallOutcome<DeleteInterconnectOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::DeleteInterconnectAsync(const DeleteInterconnectRequest& request, const DeleteInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::DeleteInterconnectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::DeleteInterconnectAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteInterconnectOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::DeleteInterconnectAsync(DeleteInterconnectRequest&& request, const DeleteInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::DeleteInterconnectAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteInterconnectOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::DeleteInterconnectAsyncHelper(const DeleteInterconnectRequest& request, const DeleteInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -496,12 +616,22 @@ DeleteVirtualInterfaceOutcome DirectConnectClient::DeleteVirtualInterface(const
 
 DeleteVirtualInterfaceOutcomeCallable DirectConnectClient::DeleteVirtualInterfaceCallable(const DeleteVirtualInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::DeleteVirtualInterface, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DeleteVirtualInterface, Aws::Client::RejectedCallOutcome<DeleteVirtualInterfaceOutcome>(), this, request);
+}
+
+DeleteVirtualInterfaceOutcomeCallable DirectConnectClient::DeleteVirtualInterfaceCallable(DeleteVirtualInterfaceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DeleteVirtualInterface, Aws::Client::RejectedCallOutcome<DeleteVirtualInterfaceOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::DeleteVirtualInterfaceAsync(const DeleteVirtualInterfaceRequest& request, const DeleteVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::DeleteVirtualInterfaceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::DeleteVirtualInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVirtualInterfaceOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::DeleteVirtualInterfaceAsync(DeleteVirtualInterfaceRequest&& request, const DeleteVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::DeleteVirtualInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVirtualInterfaceOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::DeleteVirtualInterfaceAsyncHelper(const DeleteVirtualInterfaceRequest& request, const DeleteVirtualInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -527,12 +657,22 @@ DescribeConnectionsOutcome DirectConnectClient::DescribeConnections(const Descri
 
 DescribeConnectionsOutcomeCallable DirectConnectClient::DescribeConnectionsCallable(const DescribeConnectionsRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::DescribeConnections, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DescribeConnections, Aws::Client::RejectedCallOutcome<DescribeConnectionsOutcome>(), this, request);
+}
+
+DescribeConnectionsOutcomeCallable DirectConnectClient::DescribeConnectionsCallable(DescribeConnectionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DescribeConnections, Aws::Client::RejectedCallOutcome<DescribeConnectionsOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::DescribeConnectionsAsync(const DescribeConnectionsRequest& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::DescribeConnectionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::DescribeConnectionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConnectionsOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::DescribeConnectionsAsync(DescribeConnectionsRequest&& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::DescribeConnectionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConnectionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::DescribeConnectionsAsyncHelper(const DescribeConnectionsRequest& request, const DescribeConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -558,12 +698,22 @@ DescribeConnectionsOnInterconnectOutcome DirectConnectClient::DescribeConnection
 
 DescribeConnectionsOnInterconnectOutcomeCallable DirectConnectClient::DescribeConnectionsOnInterconnectCallable(const DescribeConnectionsOnInterconnectRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::DescribeConnectionsOnInterconnect, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DescribeConnectionsOnInterconnect, Aws::Client::RejectedCallOutcome<DescribeConnectionsOnInterconnectOutcome>(), this, request);
+}
+
+DescribeConnectionsOnInterconnectOutcomeCallable DirectConnectClient::DescribeConnectionsOnInterconnectCallable(DescribeConnectionsOnInterconnectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DescribeConnectionsOnInterconnect, Aws::Client::RejectedCallOutcome<DescribeConnectionsOnInterconnectOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::DescribeConnectionsOnInterconnectAsync(const DescribeConnectionsOnInterconnectRequest& request, const DescribeConnectionsOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::DescribeConnectionsOnInterconnectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::DescribeConnectionsOnInterconnectAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConnectionsOnInterconnectOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::DescribeConnectionsOnInterconnectAsync(DescribeConnectionsOnInterconnectRequest&& request, const DescribeConnectionsOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::DescribeConnectionsOnInterconnectAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConnectionsOnInterconnectOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::DescribeConnectionsOnInterconnectAsyncHelper(const DescribeConnectionsOnInterconnectRequest& request, const DescribeConnectionsOnInterconnectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -589,12 +739,22 @@ DescribeInterconnectsOutcome DirectConnectClient::DescribeInterconnects(const De
 
 DescribeInterconnectsOutcomeCallable DirectConnectClient::DescribeInterconnectsCallable(const DescribeInterconnectsRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::DescribeInterconnects, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DescribeInterconnects, Aws::Client::RejectedCallOutcome<DescribeInterconnectsOutcome>(), this, request);
+}
+
+DescribeInterconnectsOutcomeCallable DirectConnectClient::DescribeInterconnectsCallable(DescribeInterconnectsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DescribeInterconnects, Aws::Client::RejectedCallOutcome<DescribeInterconnectsOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::DescribeInterconnectsAsync(const DescribeInterconnectsRequest& request, const DescribeInterconnectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::DescribeInterconnectsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::DescribeInterconnectsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInterconnectsOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::DescribeInterconnectsAsync(DescribeInterconnectsRequest&& request, const DescribeInterconnectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::DescribeInterconnectsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInterconnectsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::DescribeInterconnectsAsyncHelper(const DescribeInterconnectsRequest& request, const DescribeInterconnectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -620,12 +780,12 @@ DescribeLocationsOutcome DirectConnectClient::DescribeLocations() const
 
 DescribeLocationsOutcomeCallable DirectConnectClient::DescribeLocationsCallable() const
 {
-  return std::async(std::launch::async, &DirectConnectClient::DescribeLocations, this);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DescribeLocations, Aws::Client::RejectedCallOutcome<DescribeLocationsOutcome>(), this);
 }
 
 void DirectConnectClient::DescribeLocationsAsync(const DescribeLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::DescribeLocationsAsyncHelper, this, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::DescribeLocationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLocationsOutcome>(), this, handler, context);
 }
 
 void DirectConnectClient::DescribeLocationsAsyncHelper(const DescribeLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -651,12 +811,12 @@ DescribeVirtualGatewaysOutcome DirectConnectClient::DescribeVirtualGateways() co
 
 DescribeVirtualGatewaysOutcomeCallable DirectConnectClient::DescribeVirtualGatewaysCallable() const
 {
-  return std::async(std::launch::async, &DirectConnectClient::DescribeVirtualGateways, this);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DescribeVirtualGateways, Aws::Client::RejectedCallOutcome<DescribeVirtualGatewaysOutcome>(), this);
 }
 
 void DirectConnectClient::DescribeVirtualGatewaysAsync(const DescribeVirtualGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::DescribeVirtualGatewaysAsyncHelper, this, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::DescribeVirtualGatewaysAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVirtualGatewaysOutcome>(), this, handler, context);
 }
 
 void DirectConnectClient::DescribeVirtualGatewaysAsyncHelper(const DescribeVirtualGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -682,12 +842,22 @@ DescribeVirtualInterfacesOutcome DirectConnectClient::DescribeVirtualInterfaces(
 
 DescribeVirtualInterfacesOutcomeCallable DirectConnectClient::DescribeVirtualInterfacesCallable(const DescribeVirtualInterfacesRequest& request) const
 {
-  return std::async(std::launch::async, &DirectConnectClient::DescribeVirtualInterfaces, this, request);
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DescribeVirtualInterfaces, Aws::Client::RejectedCallOutcome<DescribeVirtualInterfacesOutcome>(), this, request);
+}
+
+DescribeVirtualInterfacesOutcomeCallable DirectConnectClient::DescribeVirtualInterfacesCallable(DescribeVirtualInterfacesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectConnectClient::DescribeVirtualInterfaces, Aws::Client::RejectedCallOutcome<DescribeVirtualInterfacesOutcome>(), this, std::move(request));
 }
 
 void DirectConnectClient::DescribeVirtualInterfacesAsync(const DescribeVirtualInterfacesRequest& request, const DescribeVirtualInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectConnectClient::DescribeVirtualInterfacesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectConnectClient::DescribeVirtualInterfacesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVirtualInterfacesOutcome>(), this, request, handler, context);
+}
+
+void DirectConnectClient::DescribeVirtualInterfacesAsync(DescribeVirtualInterfacesRequest&& request, const DescribeVirtualInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectConnectClient::DescribeVirtualInterfacesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVirtualInterfacesOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectConnectClient::DescribeVirtualInterfacesAsyncHelper(const DescribeVirtualInterfacesRequest& request, const DescribeVirtualInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -47,6 +47,35 @@
 #include <aws/ds/model/VerifyTrustResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/ds/model/ConnectDirectoryRequest.h>
+#include <aws/ds/model/CreateAliasRequest.h>
+#include <aws/ds/model/CreateComputerRequest.h>
+#include <aws/ds/model/CreateDirectoryRequest.h>
+#include <aws/ds/model/CreateMicrosoftADRequest.h>
+#include <aws/ds/model/CreateSnapshotRequest.h>
+#include <aws/ds/model/CreateTrustRequest.h>
+#include <aws/ds/model/DeleteDirectoryRequest.h>
+#include <aws/ds/model/DeleteSnapshotRequest.h>
+#include <aws/ds/model/DeleteTrustRequest.h>
+#include <aws/ds/model/DeregisterEventTopicRequest.h>
+#include <aws/ds/model/DescribeDirectoriesRequest.h>
+#include <aws/ds/model/DescribeEventTopicsRequest.h>
+#include <aws/ds/model/DescribeSnapshotsRequest.h>
+#include <aws/ds/model/DescribeTrustsRequest.h>
+#include <aws/ds/model/DisableRadiusRequest.h>
+#include <aws/ds/model/DisableSsoRequest.h>
+#include <aws/ds/model/EnableRadiusRequest.h>
+#include <aws/ds/model/EnableSsoRequest.h>
+#include <aws/ds/model/GetDirectoryLimitsRequest.h>
+#include <aws/ds/model/GetSnapshotLimitsRequest.h>
+#include <aws/ds/model/RegisterEventTopicRequest.h>
+#include <aws/ds/model/RestoreFromSnapshotRequest.h>
+#include <aws/ds/model/UpdateRadiusRequest.h>
+#include <aws/ds/model/VerifyTrustRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -241,6 +270,11 @@ namespace Model
          */
         virtual Model::ConnectDirectoryOutcomeCallable ConnectDirectoryCallable(const Model::ConnectDirectoryRequest& request) const;
 
+        /**
+         * Same as ConnectDirectoryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ConnectDirectoryOutcomeCallable ConnectDirectoryCallable(Model::ConnectDirectoryRequest&& request) const;
+
         /**
          * <p>Creates an AD Connector to connect to an on-premises directory.</p>
          *
@@ -248,6 +282,11 @@ namespace Model
          */
         virtual void ConnectDirectoryAsync(const Model::ConnectDirectoryRequest& request, const ConnectDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConnectDirectoryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ConnectDirectoryAsync(Model::ConnectDirectoryRequest&& request, const ConnectDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an alias for a directory and assigns the alias to the directory. The
          * alias is used to construct the access URL for the directory, such as
@@ -270,6 +309,11 @@ namespace Model
          */
         virtual Model::CreateAliasOutcomeCallable CreateAliasCallable(const Model::CreateAliasRequest& request) const;
 
+        /**
+         * Same as CreateAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateAliasOutcomeCallable CreateAliasCallable(Model::CreateAliasRequest&& request) const;
+
         /**
          * <p>Creates an alias for a directory and assigns the alias to the directory. The
          * alias is used to construct the access URL for the directory, such as
@@ -282,6 +326,11 @@ namespace Model
          */
         virtual void CreateAliasAsync(const Model::CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateAliasAsync(Model::CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a computer account in the specified directory, and joins the computer
          * to the directory.</p>
@@ -296,6 +345,11 @@ namespace Model
          */
         virtual Model::CreateComputerOutcomeCallable CreateComputerCallable(const Model::CreateComputerRequest& request) const;
 
+        /**
+         * Same as CreateComputerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateComputerOutcomeCallable CreateComputerCallable(Model::CreateComputerRequest&& request) const;
+
         /**
          * <p>Creates a computer account in the specified directory, and joins the computer
          * to the directory.</p>
@@ -304,6 +358,11 @@ namespace Model
          */
         virtual void CreateComputerAsync(const Model::CreateComputerRequest& request, const CreateComputerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateComputerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateComputerAsync(Model::CreateComputerRequest&& request, const CreateComputerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a Simple AD directory.</p>
          */
@@ -316,6 +375,11 @@ namespace Model
          */
         virtual Model::CreateDirectoryOutcomeCallable CreateDirectoryCallable(const Model::CreateDirectoryRequest& request) const;
 
+        /**
+         * Same as CreateDirectoryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDirectoryOutcomeCallable CreateDirectoryCallable(Model::CreateDirectoryRequest&& request) const;
+
         /**
          * <p>Creates a Simple AD directory.</p>
          *
@@ -323,6 +387,11 @@ namespace Model
          */
         virtual void CreateDirectoryAsync(const Model::CreateDirectoryRequest& request, const CreateDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDirectoryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDirectoryAsync(Model::CreateDirectoryRequest&& request, const CreateDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Creates a Microsoft AD in the AWS cloud.
          */
@@ -335,6 +404,11 @@ namespace Model
          */
         virtual Model::CreateMicrosoftADOutcomeCallable CreateMicrosoftADCallable(const Model::CreateMicrosoftADRequest& request) const;
 
+        /**
+         * Same as CreateMicrosoftADCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateMicrosoftADOutcomeCallable CreateMicrosoftADCallable(Model::CreateMicrosoftADRequest&& request) const;
+
         /**
          * Creates a Microsoft AD in the AWS cloud.
          *
@@ -342,6 +416,11 @@ namespace Model
          */
         virtual void CreateMicrosoftADAsync(const Model::CreateMicrosoftADRequest& request, const CreateMicrosoftADResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateMicrosoftADAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateMicrosoftADAsync(Model::CreateMicrosoftADRequest&& request, const CreateMicrosoftADResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a snapshot of a Simple AD or Microsoft AD directory in the AWS
          * cloud.</p> <note> <p>You cannot take snapshots of AD Connector directories.</p>
@@ -358,6 +437,11 @@ namespace Model
          */
         virtual Model::CreateSnapshotOutcomeCallable CreateSnapshotCallable(const Model::CreateSnapshotRequest& request) const;
 
+        /**
+         * Same as CreateSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateSnapshotOutcomeCallable CreateSnapshotCallable(Model::CreateSnapshotRequest&& request) const;
+
         /**
          * <p>Creates a snapshot of a Simple AD or Microsoft AD directory in the AWS
          * cloud.</p> <note> <p>You cannot take snapshots of AD Connector directories.</p>
@@ -367,6 +451,11 @@ namespace Model
          */
         virtual void CreateSnapshotAsync(const Model::CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateSnapshotAsync(Model::CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>AWS Directory Service for Microsoft Active Directory allows you to configure
          * trust relationships. For example, you can establish a trust between your
@@ -391,6 +480,11 @@ namespace Model
          */
         virtual Model::CreateTrustOutcomeCallable CreateTrustCallable(const Model::CreateTrustRequest& request) const;
 
+        /**
+         * Same as CreateTrustCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateTrustOutcomeCallable CreateTrustCallable(Model::CreateTrustRequest&& request) const;
+
         /**
          * <p>AWS Directory Service for Microsoft Active Directory allows you to configure
          * trust relationships. For example, you can establish a trust between your
@@ -404,6 +498,11 @@ namespace Model
          */
         virtual void CreateTrustAsync(const Model::CreateTrustRequest& request, const CreateTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTrustAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateTrustAsync(Model::CreateTrustRequest&& request, const CreateTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an AWS Directory Service directory.</p>
          */
@@ -416,6 +515,11 @@ namespace Model
          */
         virtual Model::DeleteDirectoryOutcomeCallable DeleteDirectoryCallable(const Model::DeleteDirectoryRequest& request) const;
 
+        /**
+         * Same as DeleteDirectoryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDirectoryOutcomeCallable DeleteDirectoryCallable(Model::DeleteDirectoryRequest&& request) const;
+
         /**
          * <p>Deletes an AWS Directory Service directory.</p>
          *
@@ -423,6 +527,11 @@ namespace Model
          */
         virtual void DeleteDirectoryAsync(const Model::DeleteDirectoryRequest& request, const DeleteDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDirectoryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDirectoryAsync(Model::DeleteDirectoryRequest&& request, const DeleteDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a directory snapshot.</p>
          */
@@ -435,6 +544,11 @@ namespace Model
          */
         virtual Model::DeleteSnapshotOutcomeCallable DeleteSnapshotCallable(const Model::DeleteSnapshotRequest& request) const;
 
+        /**
+         * Same as DeleteSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSnapshotOutcomeCallable DeleteSnapshotCallable(Model::DeleteSnapshotRequest&& request) const;
+
         /**
          * <p>Deletes a directory snapshot.</p>
          *
@@ -442,6 +556,11 @@ namespace Model
          */
         virtual void DeleteSnapshotAsync(const Model::DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSnapshotAsync(Model::DeleteSnapshotRequest&& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Deletes an existing trust relationship between your Microsoft AD in the AWS
          * cloud and an external domain.
@@ -456,6 +575,11 @@ namespace Model
          */
         virtual Model::DeleteTrustOutcomeCallable DeleteTrustCallable(const Model::DeleteTrustRequest& request) const;
 
+        /**
+         * Same as DeleteTrustCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteTrustOutcomeCallable DeleteTrustCallable(Model::DeleteTrustRequest&& request) const;
+
         /**
          * Deletes an existing trust relationship between your Microsoft AD in the AWS
          * cloud and an external domain.
@@ -464,6 +588,11 @@ namespace Model
          */
         virtual void DeleteTrustAsync(const Model::DeleteTrustRequest& request, const DeleteTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTrustAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteTrustAsync(Model::DeleteTrustRequest&& request, const DeleteTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified directory as a publisher to the specified SNS
          * topic.</p>
@@ -478,6 +607,11 @@ namespace Model
          */
         virtual Model::DeregisterEventTopicOutcomeCallable DeregisterEventTopicCallable(const Model::DeregisterEventTopicRequest& request) const;
 
+        /**
+         * Same as DeregisterEventTopicCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeregisterEventTopicOutcomeCallable DeregisterEventTopicCallable(Model::DeregisterEventTopicRequest&& request) const;
+
         /**
          * <p>Removes the specified directory as a publisher to the specified SNS
          * topic.</p>
@@ -486,6 +620,11 @@ namespace Model
          */
         virtual void DeregisterEventTopicAsync(const Model::DeregisterEventTopicRequest& request, const DeregisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterEventTopicAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeregisterEventTopicAsync(Model::DeregisterEventTopicRequest&& request, const DeregisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains information about the directories that belong to this account.</p>
          * <p>You can retrieve information about specific directories by passing the
@@ -516,6 +655,11 @@ namespace Model
          */
         virtual Model::DescribeDirectoriesOutcomeCallable DescribeDirectoriesCallable(const Model::DescribeDirectoriesRequest& request) const;
 
+        /**
+         * Same as DescribeDirectoriesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDirectoriesOutcomeCallable DescribeDirectoriesCallable(Model::DescribeDirectoriesRequest&& request) const;
+
         /**
          * <p>Obtains information about the directories that belong to this account.</p>
          * <p>You can retrieve information about specific directories by passing the
@@ -532,6 +676,11 @@ namespace Model
          */
         virtual void DescribeDirectoriesAsync(const Model::DescribeDirectoriesRequest& request, const DescribeDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDirectoriesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDirectoriesAsync(Model::DescribeDirectoriesRequest&& request, const DescribeDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains information about which SNS topics receive status messages from the
          * specified directory.</p> <p>If no input parameters are provided, such as
@@ -550,6 +699,11 @@ namespace Model
          */
         virtual Model::DescribeEventTopicsOutcomeCallable DescribeEventTopicsCallable(const Model::DescribeEventTopicsRequest& request) const;
 
+        /**
+         * Same as DescribeEventTopicsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEventTopicsOutcomeCallable DescribeEventTopicsCallable(Model::DescribeEventTopicsRequest&& request) const;
+
         /**
          * <p>Obtains information about which SNS topics receive status messages from the
          * specified directory.</p> <p>If no input parameters are provided, such as
@@ -560,6 +714,11 @@ namespace Model
          */
         virtual void DescribeEventTopicsAsync(const Model::DescribeEventTopicsRequest& request, const DescribeEventTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventTopicsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEventTopicsAsync(Model::DescribeEventTopicsRequest&& request, const DescribeEventTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains information about the directory snapshots that belong to this
          * account.</p> <p>This operation supports pagination with the use of the
@@ -584,6 +743,11 @@ namespace Model
          */
         virtual Model::DescribeSnapshotsOutcomeCallable DescribeSnapshotsCallable(const Model::DescribeSnapshotsRequest& request) const;
 
+        /**
+         * Same as DescribeSnapshotsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSnapshotsOutcomeCallable DescribeSnapshotsCallable(Model::DescribeSnapshotsRequest&& request) const;
+
         /**
          * <p>Obtains information about the directory snapshots that belong to this
          * account.</p> <p>This operation supports pagination with the use of the
@@ -597,6 +761,11 @@ namespace Model
          */
         virtual void DescribeSnapshotsAsync(const Model::DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSnapshotsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSnapshotsAsync(Model::DescribeSnapshotsRequest&& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains information about the trust relationships for this account.</p> <p>If
          * no input parameters are provided, such as DirectoryId or TrustIds, this request
@@ -613,6 +782,11 @@ namespace Model
          */
         virtual Model::DescribeTrustsOutcomeCallable DescribeTrustsCallable(const Model::DescribeTrustsRequest& request) const;
 
+        /**
+         * Same as DescribeTrustsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTrustsOutcomeCallable DescribeTrustsCallable(Model::DescribeTrustsRequest&& request) const;
+
         /**
          * <p>Obtains information about the trust relationships for this account.</p> <p>If
          * no input parameters are provided, such as DirectoryId or TrustIds, this request
@@ -622,6 +796,11 @@ namespace Model
          */
         virtual void DescribeTrustsAsync(const Model::DescribeTrustsRequest& request, const DescribeTrustsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTrustsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTrustsAsync(Model::DescribeTrustsRequest&& request, const DescribeTrustsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables multi-factor authentication (MFA) with the Remote Authentication
          * Dial In User Service (RADIUS) server for an AD Connector directory.</p>
@@ -636,6 +815,11 @@ namespace Model
          */
         virtual Model::DisableRadiusOutcomeCallable DisableRadiusCallable(const Model::DisableRadiusRequest& request) const;
 
+        /**
+         * Same as DisableRadiusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableRadiusOutcomeCallable DisableRadiusCallable(Model::DisableRadiusRequest&& request) const;
+
         /**
          * <p>Disables multi-factor authentication (MFA) with the Remote Authentication
          * Dial In User Service (RADIUS) server for an AD Connector directory.</p>
@@ -644,6 +828,11 @@ namespace Model
          */
         virtual void DisableRadiusAsync(const Model::DisableRadiusRequest& request, const DisableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableRadiusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableRadiusAsync(Model::DisableRadiusRequest&& request, const DisableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables single-sign on for a directory.</p>
          */
@@ -656,6 +845,11 @@ namespace Model
          */
         virtual Model::DisableSsoOutcomeCallable DisableSsoCallable(const Model::DisableSsoRequest& request) const;
 
+        /**
+         * Same as DisableSsoCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableSsoOutcomeCallable DisableSsoCallable(Model::DisableSsoRequest&& request) const;
+
         /**
          * <p>Disables single-sign on for a directory.</p>
          *
@@ -663,6 +857,11 @@ namespace Model
          */
         virtual void DisableSsoAsync(const Model::DisableSsoRequest& request, const DisableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableSsoAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableSsoAsync(Model::DisableSsoRequest&& request, const DisableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables multi-factor authentication (MFA) with the Remote Authentication Dial
          * In User Service (RADIUS) server for an AD Connector directory.</p>
@@ -677,6 +876,11 @@ namespace Model
          */
         virtual Model::EnableRadiusOutcomeCallable EnableRadiusCallable(const Model::EnableRadiusRequest& request) const;
 
+        /**
+         * Same as EnableRadiusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableRadiusOutcomeCallable EnableRadiusCallable(Model::EnableRadiusRequest&& request) const;
+
         /**
          * <p>Enables multi-factor authentication (MFA) with the Remote Authentication Dial
          * In User Service (RADIUS) server for an AD Connector directory.</p>
@@ -685,6 +889,11 @@ namespace Model
          */
         virtual void EnableRadiusAsync(const Model::EnableRadiusRequest& request, const EnableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableRadiusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableRadiusAsync(Model::EnableRadiusRequest&& request, const EnableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables single-sign on for a directory.</p>
          */
@@ -697,6 +906,11 @@ namespace Model
          */
         virtual Model::EnableSsoOutcomeCallable EnableSsoCallable(const Model::EnableSsoRequest& request) const;
 
+        /**
+         * Same as EnableSsoCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableSsoOutcomeCallable EnableSsoCallable(Model::EnableSsoRequest&& request) const;
+
         /**
          * <p>Enables single-sign on for a directory.</p>
          *
@@ -704,6 +918,11 @@ namespace Model
          */
         virtual void EnableSsoAsync(const Model::EnableSsoRequest& request, const EnableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableSsoAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableSsoAsync(Model::EnableSsoRequest&& request, const EnableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains directory limit information for the current region.</p>
          */
@@ -716,6 +935,11 @@ namespace Model
          */
         virtual Model::GetDirectoryLimitsOutcomeCallable GetDirectoryLimitsCallable(const Model::GetDirectoryLimitsRequest& request) const;
 
+        /**
+         * Same as GetDirectoryLimitsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDirectoryLimitsOutcomeCallable GetDirectoryLimitsCallable(Model::GetDirectoryLimitsRequest&& request) const;
+
         /**
          * <p>Obtains directory limit information for the current region.</p>
          *
@@ -723,6 +947,11 @@ namespace Model
          */
         virtual void GetDirectoryLimitsAsync(const Model::GetDirectoryLimitsRequest& request, const GetDirectoryLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDirectoryLimitsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDirectoryLimitsAsync(Model::GetDirectoryLimitsRequest&& request, const GetDirectoryLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains the manual snapshot limits for a directory.</p>
          */
@@ -735,6 +964,11 @@ namespace Model
          */
         virtual Model::GetSnapshotLimitsOutcomeCallable GetSnapshotLimitsCallable(const Model::GetSnapshotLimitsRequest& request) const;
 
+        /**
+         * Same as GetSnapshotLimitsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetSnapshotLimitsOutcomeCallable GetSnapshotLimitsCallable(Model::GetSnapshotLimitsRequest&& request) const;
+
         /**
          * <p>Obtains the manual snapshot limits for a directory.</p>
          *
@@ -742,6 +976,11 @@ namespace Model
          */
         virtual void GetSnapshotLimitsAsync(const Model::GetSnapshotLimitsRequest& request, const GetSnapshotLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSnapshotLimitsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetSnapshotLimitsAsync(Model::GetSnapshotLimitsRequest&& request, const GetSnapshotLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates a directory with an SNS topic. This establishes the directory as a
          * publisher to the specified SNS topic. You can then receive email or text (SMS)
@@ -762,6 +1001,11 @@ namespace Model
          */
         virtual Model::RegisterEventTopicOutcomeCallable RegisterEventTopicCallable(const Model::RegisterEventTopicRequest& request) const;
 
+        /**
+         * Same as RegisterEventTopicCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterEventTopicOutcomeCallable RegisterEventTopicCallable(Model::RegisterEventTopicRequest&& request) const;
+
         /**
          * <p>Associates a directory with an SNS topic. This establishes the directory as a
          * publisher to the specified SNS topic. You can then receive email or text (SMS)
@@ -773,6 +1017,11 @@ namespace Model
          */
         virtual void RegisterEventTopicAsync(const Model::RegisterEventTopicRequest& request, const RegisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterEventTopicAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterEventTopicAsync(Model::RegisterEventTopicRequest&& request, const RegisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Restores a directory using an existing directory snapshot.</p> <p>When you
          * restore a directory from a snapshot, any changes made to the directory after the
@@ -797,6 +1046,11 @@ namespace Model
          */
         virtual Model::RestoreFromSnapshotOutcomeCallable RestoreFromSnapshotCallable(const Model::RestoreFromSnapshotRequest& request) const;
 
+        /**
+         * Same as RestoreFromSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RestoreFromSnapshotOutcomeCallable RestoreFromSnapshotCallable(Model::RestoreFromSnapshotRequest&& request) const;
+
         /**
          * <p>Restores a directory using an existing directory snapshot.</p> <p>When you
          * restore a directory from a snapshot, any changes made to the directory after the
@@ -810,6 +1064,11 @@ namespace Model
          */
         virtual void RestoreFromSnapshotAsync(const Model::RestoreFromSnapshotRequest& request, const RestoreFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreFromSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RestoreFromSnapshotAsync(Model::RestoreFromSnapshotRequest&& request, const RestoreFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the Remote Authentication Dial In User Service (RADIUS) server
          * information for an AD Connector directory.</p>
@@ -824,6 +1083,11 @@ namespace Model
          */
         virtual Model::UpdateRadiusOutcomeCallable UpdateRadiusCallable(const Model::UpdateRadiusRequest& request) const;
 
+        /**
+         * Same as UpdateRadiusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateRadiusOutcomeCallable UpdateRadiusCallable(Model::UpdateRadiusRequest&& request) const;
+
         /**
          * <p>Updates the Remote Authentication Dial In User Service (RADIUS) server
          * information for an AD Connector directory.</p>
@@ -832,6 +1096,11 @@ namespace Model
          */
         virtual void UpdateRadiusAsync(const Model::UpdateRadiusRequest& request, const UpdateRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRadiusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateRadiusAsync(Model::UpdateRadiusRequest&& request, const UpdateRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>AWS Directory Service for Microsoft Active Directory allows you to configure
          * and verify trust relationships. </p><p>This action verifies a trust relationship
@@ -848,6 +1117,11 @@ namespace Model
          */
         virtual Model::VerifyTrustOutcomeCallable VerifyTrustCallable(const Model::VerifyTrustRequest& request) const;
 
+        /**
+         * Same as VerifyTrustCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::VerifyTrustOutcomeCallable VerifyTrustCallable(Model::VerifyTrustRequest&& request) const;
+
         /**
          * <p>AWS Directory Service for Microsoft Active Directory allows you to configure
          * and verify trust relationships. </p><p>This action verifies a trust relationship
@@ -857,6 +1131,68 @@ namespace Model
          */
         virtual void VerifyTrustAsync(const Model::VerifyTrustRequest& request, const VerifyTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as VerifyTrustAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void VerifyTrustAsync(Model::VerifyTrustRequest&& request, const VerifyTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::ConnectDirectoryOutcome> ConnectDirectoryAwaitable(const Model::ConnectDirectoryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::ConnectDirectory, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ConnectDirectoryOutcome> ConnectDirectoryAwaitable(Model::ConnectDirectoryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::ConnectDirectory, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAliasOutcome> CreateAliasAwaitable(const Model::CreateAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::CreateAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAliasOutcome> CreateAliasAwaitable(Model::CreateAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::CreateAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateComputerOutcome> CreateComputerAwaitable(const Model::CreateComputerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::CreateComputer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateComputerOutcome> CreateComputerAwaitable(Model::CreateComputerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::CreateComputer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDirectoryOutcome> CreateDirectoryAwaitable(const Model::CreateDirectoryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::CreateDirectory, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDirectoryOutcome> CreateDirectoryAwaitable(Model::CreateDirectoryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::CreateDirectory, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateMicrosoftADOutcome> CreateMicrosoftADAwaitable(const Model::CreateMicrosoftADRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::CreateMicrosoftAD, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateMicrosoftADOutcome> CreateMicrosoftADAwaitable(Model::CreateMicrosoftADRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::CreateMicrosoftAD, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(const Model::CreateSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::CreateSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(Model::CreateSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::CreateSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTrustOutcome> CreateTrustAwaitable(const Model::CreateTrustRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::CreateTrust, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTrustOutcome> CreateTrustAwaitable(Model::CreateTrustRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::CreateTrust, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDirectoryOutcome> DeleteDirectoryAwaitable(const Model::DeleteDirectoryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DeleteDirectory, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDirectoryOutcome> DeleteDirectoryAwaitable(Model::DeleteDirectoryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DeleteDirectory, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSnapshotOutcome> DeleteSnapshotAwaitable(const Model::DeleteSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DeleteSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSnapshotOutcome> DeleteSnapshotAwaitable(Model::DeleteSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DeleteSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTrustOutcome> DeleteTrustAwaitable(const Model::DeleteTrustRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DeleteTrust, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTrustOutcome> DeleteTrustAwaitable(Model::DeleteTrustRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DeleteTrust, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterEventTopicOutcome> DeregisterEventTopicAwaitable(const Model::DeregisterEventTopicRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DeregisterEventTopic, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterEventTopicOutcome> DeregisterEventTopicAwaitable(Model::DeregisterEventTopicRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DeregisterEventTopic, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDirectoriesOutcome> DescribeDirectoriesAwaitable(const Model::DescribeDirectoriesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DescribeDirectories, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDirectoriesOutcome> DescribeDirectoriesAwaitable(Model::DescribeDirectoriesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DescribeDirectories, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventTopicsOutcome> DescribeEventTopicsAwaitable(const Model::DescribeEventTopicsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DescribeEventTopics, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventTopicsOutcome> DescribeEventTopicsAwaitable(Model::DescribeEventTopicsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DescribeEventTopics, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSnapshotsOutcome> DescribeSnapshotsAwaitable(const Model::DescribeSnapshotsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DescribeSnapshots, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSnapshotsOutcome> DescribeSnapshotsAwaitable(Model::DescribeSnapshotsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DescribeSnapshots, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTrustsOutcome> DescribeTrustsAwaitable(const Model::DescribeTrustsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DescribeTrusts, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTrustsOutcome> DescribeTrustsAwaitable(Model::DescribeTrustsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DescribeTrusts, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableRadiusOutcome> DisableRadiusAwaitable(const Model::DisableRadiusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DisableRadius, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableRadiusOutcome> DisableRadiusAwaitable(Model::DisableRadiusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DisableRadius, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableSsoOutcome> DisableSsoAwaitable(const Model::DisableSsoRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DisableSso, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableSsoOutcome> DisableSsoAwaitable(Model::DisableSsoRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::DisableSso, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableRadiusOutcome> EnableRadiusAwaitable(const Model::EnableRadiusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::EnableRadius, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableRadiusOutcome> EnableRadiusAwaitable(Model::EnableRadiusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::EnableRadius, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableSsoOutcome> EnableSsoAwaitable(const Model::EnableSsoRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::EnableSso, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableSsoOutcome> EnableSsoAwaitable(Model::EnableSsoRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::EnableSso, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDirectoryLimitsOutcome> GetDirectoryLimitsAwaitable(const Model::GetDirectoryLimitsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::GetDirectoryLimits, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDirectoryLimitsOutcome> GetDirectoryLimitsAwaitable(Model::GetDirectoryLimitsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::GetDirectoryLimits, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSnapshotLimitsOutcome> GetSnapshotLimitsAwaitable(const Model::GetSnapshotLimitsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::GetSnapshotLimits, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSnapshotLimitsOutcome> GetSnapshotLimitsAwaitable(Model::GetSnapshotLimitsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::GetSnapshotLimits, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterEventTopicOutcome> RegisterEventTopicAwaitable(const Model::RegisterEventTopicRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::RegisterEventTopic, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterEventTopicOutcome> RegisterEventTopicAwaitable(Model::RegisterEventTopicRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::RegisterEventTopic, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreFromSnapshotOutcome> RestoreFromSnapshotAwaitable(const Model::RestoreFromSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::RestoreFromSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreFromSnapshotOutcome> RestoreFromSnapshotAwaitable(Model::RestoreFromSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::RestoreFromSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateRadiusOutcome> UpdateRadiusAwaitable(const Model::UpdateRadiusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::UpdateRadius, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateRadiusOutcome> UpdateRadiusAwaitable(Model::UpdateRadiusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::UpdateRadius, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::VerifyTrustOutcome> VerifyTrustAwaitable(const Model::VerifyTrustRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::VerifyTrust, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::VerifyTrustOutcome> VerifyTrustAwaitable(Model::VerifyTrustRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DirectoryServiceClient::VerifyTrust, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
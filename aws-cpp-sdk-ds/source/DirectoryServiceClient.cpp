@@ -132,12 +132,22 @@ ConnectDirectoryOutcome DirectoryServiceClient::ConnectDirectory(const ConnectDi
 
 ConnectDirectoryOutcomeCallable DirectoryServiceClient::ConnectDirectoryCallable(const ConnectDirectoryRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::ConnectDirectory, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::ConnectDirectory, Aws::Client::RejectedCallOutcome<ConnectDirectoryOutcome>(), this, request);
+}
+
+ConnectDirectoryOutcomeCallable DirectoryServiceClient::ConnectDirectoryCallable(ConnectDirectoryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::ConnectDirectory, Aws::Client::RejectedCallOutcome<ConnectDirectoryOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::ConnectDirectoryAsync(const ConnectDirectoryRequest& request, const ConnectDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::ConnectDirectoryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::ConnectDirectoryAsyncHelper, Aws::Client::RejectedAsyncCall<ConnectDirectoryOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::ConnectDirectoryAsync(ConnectDirectoryRequest&& request, const ConnectDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::ConnectDirectoryAsyncHelper, Aws::Client::RejectedAsyncCall<ConnectDirectoryOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::ConnectDirectoryAsyncHelper(const ConnectDirectoryRequest& request, const ConnectDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -163,12 +173,22 @@ CreateAliasOutcome DirectoryServiceClient::CreateAlias(const CreateAliasRequest&
 
 CreateAliasOutcomeCallable DirectoryServiceClient::CreateAliasCallable(const CreateAliasRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::CreateAlias, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::CreateAlias, Aws::Client::RejectedCallOutcome<CreateAliasOutcome>(), this, request);
+}
+
+CreateAliasOutcomeCallable DirectoryServiceClient::CreateAliasCallable(CreateAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::CreateAlias, Aws::Client::RejectedCallOutcome<CreateAliasOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::CreateAliasAsync(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::CreateAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::CreateAliasAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAliasOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::CreateAliasAsync(CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::CreateAliasAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::CreateAliasAsyncHelper(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -194,12 +214,22 @@ CreateComputerOutcome DirectoryServiceClient::CreateComputer(const CreateCompute
 
 CreateComputerOutcomeCallable DirectoryServiceClient::CreateComputerCallable(const CreateComputerRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::CreateComputer, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::CreateComputer, Aws::Client::RejectedCallOutcome<CreateComputerOutcome>(), this, request);
+}
+
+CreateComputerOutcomeCallable DirectoryServiceClient::CreateComputerCallable(CreateComputerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::CreateComputer, Aws::Client::RejectedCallOutcome<CreateComputerOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::CreateComputerAsync(const CreateComputerRequest& request, const CreateComputerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::CreateComputerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::CreateComputerAsyncHelper, Aws::Client::RejectedAsyncCall<CreateComputerOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::CreateComputerAsync(CreateComputerRequest&& request, const CreateComputerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::CreateComputerAsyncHelper, Aws::Client::RejectedAsyncCall<CreateComputerOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::CreateComputerAsyncHelper(const CreateComputerRequest& request, const CreateComputerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -225,12 +255,22 @@ CreateDirectoryOutcome DirectoryServiceClient::CreateDirectory(const CreateDirec
 
 CreateDirectoryOutcomeCallable DirectoryServiceClient::CreateDirectoryCallable(const CreateDirectoryRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::CreateDirectory, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::CreateDirectory, Aws::Client::RejectedCallOutcome<CreateDirectoryOutcome>(), this, request);
+}
+
+CreateDirectoryOutcomeCallable DirectoryServiceClient::CreateDirectoryCallable(CreateDirectoryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::CreateDirectory, Aws::Client::RejectedCallOutcome<CreateDirectoryOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::CreateDirectoryAsync(const CreateDirectoryRequest& request, const CreateDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::CreateDirectoryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::CreateDirectoryAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDirectoryOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::CreateDirectoryAsync(CreateDirectoryRequest&& request, const CreateDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::CreateDirectoryAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDirectoryOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::CreateDirectoryAsyncHelper(const CreateDirectoryRequest& request, const CreateDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -256,12 +296,22 @@ CreateMicrosoftADOutcome DirectoryServiceClient::CreateMicrosoftAD(const CreateM
 
 CreateMicrosoftADOutcomeCallable DirectoryServiceClient::CreateMicrosoftADCallable(const CreateMicrosoftADRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::CreateMicrosoftAD, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::CreateMicrosoftAD, Aws::Client::RejectedCallOutcome<CreateMicrosoftADOutcome>(), this, request);
+}
+
+CreateMicrosoftADOutcomeCallable DirectoryServiceClient::CreateMicrosoftADCallable(CreateMicrosoftADRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::CreateMicrosoftAD, Aws::Client::RejectedCallOutcome<CreateMicrosoftADOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::CreateMicrosoftADAsync(const CreateMicrosoftADRequest& request, const CreateMicrosoftADResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::CreateMicrosoftADAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::CreateMicrosoftADAsyncHelper, Aws::Client::RejectedAsyncCall<CreateMicrosoftADOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::CreateMicrosoftADAsync(CreateMicrosoftADRequest&& request, const CreateMicrosoftADResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::CreateMicrosoftADAsyncHelper, Aws::Client::RejectedAsyncCall<CreateMicrosoftADOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::CreateMicrosoftADAsyncHelper(const CreateMicrosoftADRequest& request, const CreateMicrosoftADResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -287,12 +337,22 @@ CreateSnapshotOutcome DirectoryServiceClient::CreateSnapshot(const CreateSnapsho
 
 CreateSnapshotOutcomeCallable DirectoryServiceClient::CreateSnapshotCallable(const CreateSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::CreateSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::CreateSnapshot, Aws::Client::RejectedCallOutcome<CreateSnapshotOutcome>(), this, request);
+}
+
+CreateSnapshotOutcomeCallable DirectoryServiceClient::CreateSnapshotCallable(CreateSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::CreateSnapshot, Aws::Client::RejectedCallOutcome<CreateSnapshotOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::CreateSnapshotAsync(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::CreateSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::CreateSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSnapshotOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::CreateSnapshotAsync(CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::CreateSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::CreateSnapshotAsyncHelper(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -318,12 +378,22 @@ CreateTrustOutcome DirectoryServiceClient::CreateTrust(const CreateTrustRequest&
 
 CreateTrustOutcomeCallable DirectoryServiceClient::CreateTrustCallable(const CreateTrustRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::CreateTrust, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::CreateTrust, Aws::Client::RejectedCallOutcome<CreateTrustOutcome>(), this, request);
+}
+
+CreateTrustOutcomeCallable DirectoryServiceClient::CreateTrustCallable(CreateTrustRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::CreateTrust, Aws::Client::RejectedCallOutcome<CreateTrustOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::CreateTrustAsync(const CreateTrustRequest& request, const CreateTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::CreateTrustAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::CreateTrustAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTrustOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::CreateTrustAsync(CreateTrustRequest&& request, const CreateTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::CreateTrustAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTrustOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::CreateTrustAsyncHelper(const CreateTrustRequest& request, const CreateTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -349,12 +419,22 @@ DeleteDirectoryOutcome DirectoryServiceClient::DeleteDirectory(const DeleteDirec
 
 DeleteDirectoryOutcomeCallable DirectoryServiceClient::DeleteDirectoryCallable(const DeleteDirectoryRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::DeleteDirectory, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DeleteDirectory, Aws::Client::RejectedCallOutcome<DeleteDirectoryOutcome>(), this, request);
+}
+
+DeleteDirectoryOutcomeCallable DirectoryServiceClient::DeleteDirectoryCallable(DeleteDirectoryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DeleteDirectory, Aws::Client::RejectedCallOutcome<DeleteDirectoryOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::DeleteDirectoryAsync(const DeleteDirectoryRequest& request, const DeleteDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::DeleteDirectoryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DeleteDirectoryAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDirectoryOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::DeleteDirectoryAsync(DeleteDirectoryRequest&& request, const DeleteDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DeleteDirectoryAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDirectoryOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::DeleteDirectoryAsyncHelper(const DeleteDirectoryRequest& request, const DeleteDirectoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -380,12 +460,22 @@ DeleteSnapshotOutcome DirectoryServiceClient::DeleteSnapshot(const DeleteSnapsho
 
 DeleteSnapshotOutcomeCallable DirectoryServiceClient::DeleteSnapshotCallable(const DeleteSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::DeleteSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DeleteSnapshot, Aws::Client::RejectedCallOutcome<DeleteSnapshotOutcome>(), this, request);
+}
+
+DeleteSnapshotOutcomeCallable DirectoryServiceClient::DeleteSnapshotCallable(DeleteSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DeleteSnapshot, Aws::Client::RejectedCallOutcome<DeleteSnapshotOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::DeleteSnapshotAsync(const DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::DeleteSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DeleteSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSnapshotOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::DeleteSnapshotAsync(DeleteSnapshotRequest&& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DeleteSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::DeleteSnapshotAsyncHelper(const DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -411,12 +501,22 @@ DeleteTrustOutcome DirectoryServiceClient::DeleteTrust(const DeleteTrustRequest&
 
 DeleteTrustOutcomeCallable DirectoryServiceClient::DeleteTrustCallable(const DeleteTrustRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::DeleteTrust, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DeleteTrust, Aws::Client::RejectedCallOutcome<DeleteTrustOutcome>(), this, request);
+}
+
+DeleteTrustOutcomeCallable DirectoryServiceClient::DeleteTrustCallable(DeleteTrustRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DeleteTrust, Aws::Client::RejectedCallOutcome<DeleteTrustOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::DeleteTrustAsync(const DeleteTrustRequest& request, const DeleteTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::DeleteTrustAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DeleteTrustAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTrustOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::DeleteTrustAsync(DeleteTrustRequest&& request, const DeleteTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DeleteTrustAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTrustOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::DeleteTrustAsyncHelper(const DeleteTrustRequest& request, const DeleteTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -442,12 +542,22 @@ DeregisterEventTopicOutcome DirectoryServiceClient::DeregisterEventTopic(const D
 
 DeregisterEventTopicOutcomeCallable DirectoryServiceClient::DeregisterEventTopicCallable(const DeregisterEventTopicRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::DeregisterEventTopic, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DeregisterEventTopic, Aws::Client::RejectedCallOutcome<DeregisterEventTopicOutcome>(), this, request);
+}
+
+DeregisterEventTopicOutcomeCallable DirectoryServiceClient::DeregisterEventTopicCallable(DeregisterEventTopicRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DeregisterEventTopic, Aws::Client::RejectedCallOutcome<DeregisterEventTopicOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::DeregisterEventTopicAsync(const DeregisterEventTopicRequest& request, const DeregisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::DeregisterEventTopicAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DeregisterEventTopicAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterEventTopicOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::DeregisterEventTopicAsync(DeregisterEventTopicRequest&& request, const DeregisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DeregisterEventTopicAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterEventTopicOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::DeregisterEventTopicAsyncHelper(const DeregisterEventTopicRequest& request, const DeregisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -473,12 +583,22 @@ DescribeDirectoriesOutcome DirectoryServiceClient::DescribeDirectories(const Des
 
 DescribeDirectoriesOutcomeCallable DirectoryServiceClient::DescribeDirectoriesCallable(const DescribeDirectoriesRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::DescribeDirectories, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DescribeDirectories, Aws::Client::RejectedCallOutcome<DescribeDirectoriesOutcome>(), this, request);
+}
+
+DescribeDirectoriesOutcomeCallable DirectoryServiceClient::DescribeDirectoriesCallable(DescribeDirectoriesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DescribeDirectories, Aws::Client::RejectedCallOutcome<DescribeDirectoriesOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::DescribeDirectoriesAsync(const DescribeDirectoriesRequest& request, const DescribeDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::DescribeDirectoriesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DescribeDirectoriesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDirectoriesOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::DescribeDirectoriesAsync(DescribeDirectoriesRequest&& request, const DescribeDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DescribeDirectoriesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDirectoriesOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::DescribeDirectoriesAsyncHelper(const DescribeDirectoriesRequest& request, const DescribeDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -504,12 +624,22 @@ DescribeEventTopicsOutcome DirectoryServiceClient::DescribeEventTopics(const Des
 
 DescribeEventTopicsOutcomeCallable DirectoryServiceClient::DescribeEventTopicsCallable(const DescribeEventTopicsRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::DescribeEventTopics, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DescribeEventTopics, Aws::Client::RejectedCallOutcome<DescribeEventTopicsOutcome>(), this, request);
+}
+
+DescribeEventTopicsOutcomeCallable DirectoryServiceClient::DescribeEventTopicsCallable(DescribeEventTopicsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DescribeEventTopics, Aws::Client::RejectedCallOutcome<DescribeEventTopicsOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::DescribeEventTopicsAsync(const DescribeEventTopicsRequest& request, const DescribeEventTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::DescribeEventTopicsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DescribeEventTopicsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventTopicsOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::DescribeEventTopicsAsync(DescribeEventTopicsRequest&& request, const DescribeEventTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DescribeEventTopicsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventTopicsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::DescribeEventTopicsAsyncHelper(const DescribeEventTopicsRequest& request, const DescribeEventTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -535,12 +665,22 @@ DescribeSnapshotsOutcome DirectoryServiceClient::DescribeSnapshots(const Describ
 
 DescribeSnapshotsOutcomeCallable DirectoryServiceClient::DescribeSnapshotsCallable(const DescribeSnapshotsRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::DescribeSnapshots, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DescribeSnapshots, Aws::Client::RejectedCallOutcome<DescribeSnapshotsOutcome>(), this, request);
+}
+
+DescribeSnapshotsOutcomeCallable DirectoryServiceClient::DescribeSnapshotsCallable(DescribeSnapshotsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DescribeSnapshots, Aws::Client::RejectedCallOutcome<DescribeSnapshotsOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::DescribeSnapshotsAsync(const DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::DescribeSnapshotsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DescribeSnapshotsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSnapshotsOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::DescribeSnapshotsAsync(DescribeSnapshotsRequest&& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DescribeSnapshotsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSnapshotsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::DescribeSnapshotsAsyncHelper(const DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -566,12 +706,22 @@ DescribeTrustsOutcome DirectoryServiceClient::DescribeTrusts(const DescribeTrust
 
 DescribeTrustsOutcomeCallable DirectoryServiceClient::DescribeTrustsCallable(const DescribeTrustsRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::DescribeTrusts, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DescribeTrusts, Aws::Client::RejectedCallOutcome<DescribeTrustsOutcome>(), this, request);
+}
+
+DescribeTrustsOutcomeCallable DirectoryServiceClient::DescribeTrustsCallable(DescribeTrustsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DescribeTrusts, Aws::Client::RejectedCallOutcome<DescribeTrustsOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::DescribeTrustsAsync(const DescribeTrustsRequest& request, const DescribeTrustsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::DescribeTrustsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DescribeTrustsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTrustsOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::DescribeTrustsAsync(DescribeTrustsRequest&& request, const DescribeTrustsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DescribeTrustsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTrustsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::DescribeTrustsAsyncHelper(const DescribeTrustsRequest& request, const DescribeTrustsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -597,12 +747,22 @@ DisableRadiusOutcome DirectoryServiceClient::DisableRadius(const DisableRadiusRe
 
 DisableRadiusOutcomeCallable DirectoryServiceClient::DisableRadiusCallable(const DisableRadiusRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::DisableRadius, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DisableRadius, Aws::Client::RejectedCallOutcome<DisableRadiusOutcome>(), this, request);
+}
+
+DisableRadiusOutcomeCallable DirectoryServiceClient::DisableRadiusCallable(DisableRadiusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DisableRadius, Aws::Client::RejectedCallOutcome<DisableRadiusOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::DisableRadiusAsync(const DisableRadiusRequest& request, const DisableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::DisableRadiusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DisableRadiusAsyncHelper, Aws::Client::RejectedAsyncCall<DisableRadiusOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::DisableRadiusAsync(DisableRadiusRequest&& request, const DisableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DisableRadiusAsyncHelper, Aws::Client::RejectedAsyncCall<DisableRadiusOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::DisableRadiusAsyncHelper(const DisableRadiusRequest& request, const DisableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -628,12 +788,22 @@ DisableSsoOutcome DirectoryServiceClient::DisableSso(const DisableSsoRequest& re
 
 DisableSsoOutcomeCallable DirectoryServiceClient::DisableSsoCallable(const DisableSsoRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::DisableSso, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DisableSso, Aws::Client::RejectedCallOutcome<DisableSsoOutcome>(), this, request);
+}
+
+DisableSsoOutcomeCallable DirectoryServiceClient::DisableSsoCallable(DisableSsoRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::DisableSso, Aws::Client::RejectedCallOutcome<DisableSsoOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::DisableSsoAsync(const DisableSsoRequest& request, const DisableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::DisableSsoAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DisableSsoAsyncHelper, Aws::Client::RejectedAsyncCall<DisableSsoOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::DisableSsoAsync(DisableSsoRequest&& request, const DisableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::DisableSsoAsyncHelper, Aws::Client::RejectedAsyncCall<DisableSsoOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::DisableSsoAsyncHelper(const DisableSsoRequest& request, const DisableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -659,12 +829,22 @@ EnableRadiusOutcome DirectoryServiceClient::EnableRadius(const EnableRadiusReque
 
 EnableRadiusOutcomeCallable DirectoryServiceClient::EnableRadiusCallable(const EnableRadiusRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::EnableRadius, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::EnableRadius, Aws::Client::RejectedCallOutcome<EnableRadiusOutcome>(), this, request);
+}
+
+EnableRadiusOutcomeCallable DirectoryServiceClient::EnableRadiusCallable(EnableRadiusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::EnableRadius, Aws::Client::RejectedCallOutcome<EnableRadiusOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::EnableRadiusAsync(const EnableRadiusRequest& request, const EnableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::EnableRadiusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::EnableRadiusAsyncHelper, Aws::Client::RejectedAsyncCall<EnableRadiusOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::EnableRadiusAsync(EnableRadiusRequest&& request, const EnableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::EnableRadiusAsyncHelper, Aws::Client::RejectedAsyncCall<EnableRadiusOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::EnableRadiusAsyncHelper(const EnableRadiusRequest& request, const EnableRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -690,12 +870,22 @@ EnableSsoOutcome DirectoryServiceClient::EnableSso(const EnableSsoRequest& reque
 
 EnableSsoOutcomeCallable DirectoryServiceClient::EnableSsoCallable(const EnableSsoRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::EnableSso, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::EnableSso, Aws::Client::RejectedCallOutcome<EnableSsoOutcome>(), this, request);
+}
+
+EnableSsoOutcomeCallable DirectoryServiceClient::EnableSsoCallable(EnableSsoRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::EnableSso, Aws::Client::RejectedCallOutcome<EnableSsoOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::EnableSsoAsync(const EnableSsoRequest& request, const EnableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::EnableSsoAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::EnableSsoAsyncHelper, Aws::Client::RejectedAsyncCall<EnableSsoOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::EnableSsoAsync(EnableSsoRequest&& request, const EnableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::EnableSsoAsyncHelper, Aws::Client::RejectedAsyncCall<EnableSsoOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::EnableSsoAsyncHelper(const EnableSsoRequest& request, const EnableSsoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -721,12 +911,22 @@ GetDirectoryLimitsOutcome DirectoryServiceClient::GetDirectoryLimits(const GetDi
 
 GetDirectoryLimitsOutcomeCallable DirectoryServiceClient::GetDirectoryLimitsCallable(const GetDirectoryLimitsRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::GetDirectoryLimits, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::GetDirectoryLimits, Aws::Client::RejectedCallOutcome<GetDirectoryLimitsOutcome>(), this, request);
+}
+
+GetDirectoryLimitsOutcomeCallable DirectoryServiceClient::GetDirectoryLimitsCallable(GetDirectoryLimitsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::GetDirectoryLimits, Aws::Client::RejectedCallOutcome<GetDirectoryLimitsOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::GetDirectoryLimitsAsync(const GetDirectoryLimitsRequest& request, const GetDirectoryLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::GetDirectoryLimitsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::GetDirectoryLimitsAsyncHelper, Aws::Client::RejectedAsyncCall<GetDirectoryLimitsOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::GetDirectoryLimitsAsync(GetDirectoryLimitsRequest&& request, const GetDirectoryLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::GetDirectoryLimitsAsyncHelper, Aws::Client::RejectedAsyncCall<GetDirectoryLimitsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::GetDirectoryLimitsAsyncHelper(const GetDirectoryLimitsRequest& request, const GetDirectoryLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -752,12 +952,22 @@ GetSnapshotLimitsOutcome DirectoryServiceClient::GetSnapshotLimits(const GetSnap
 
 GetSnapshotLimitsOutcomeCallable DirectoryServiceClient::GetSnapshotLimitsCallable(const GetSnapshotLimitsRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::GetSnapshotLimits, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::GetSnapshotLimits, Aws::Client::RejectedCallOutcome<GetSnapshotLimitsOutcome>(), this, request);
+}
+
+GetSnapshotLimitsOutcomeCallable DirectoryServiceClient::GetSnapshotLimitsCallable(GetSnapshotLimitsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::GetSnapshotLimits, Aws::Client::RejectedCallOutcome<GetSnapshotLimitsOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::GetSnapshotLimitsAsync(const GetSnapshotLimitsRequest& request, const GetSnapshotLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::GetSnapshotLimitsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::GetSnapshotLimitsAsyncHelper, Aws::Client::RejectedAsyncCall<GetSnapshotLimitsOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::GetSnapshotLimitsAsync(GetSnapshotLimitsRequest&& request, const GetSnapshotLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::GetSnapshotLimitsAsyncHelper, Aws::Client::RejectedAsyncCall<GetSnapshotLimitsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::GetSnapshotLimitsAsyncHelper(const GetSnapshotLimitsRequest& request, const GetSnapshotLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -783,12 +993,22 @@ RegisterEventTopicOutcome DirectoryServiceClient::RegisterEventTopic(const Regis
 
 RegisterEventTopicOutcomeCallable DirectoryServiceClient::RegisterEventTopicCallable(const RegisterEventTopicRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::RegisterEventTopic, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::RegisterEventTopic, Aws::Client::RejectedCallOutcome<RegisterEventTopicOutcome>(), this, request);
+}
+
+RegisterEventTopicOutcomeCallable DirectoryServiceClient::RegisterEventTopicCallable(RegisterEventTopicRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::RegisterEventTopic, Aws::Client::RejectedCallOutcome<RegisterEventTopicOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::RegisterEventTopicAsync(const RegisterEventTopicRequest& request, const RegisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::RegisterEventTopicAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::RegisterEventTopicAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterEventTopicOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::RegisterEventTopicAsync(RegisterEventTopicRequest&& request, const RegisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::RegisterEventTopicAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterEventTopicOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::RegisterEventTopicAsyncHelper(const RegisterEventTopicRequest& request, const RegisterEventTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -814,12 +1034,22 @@ RestoreFromSnapshotOutcome DirectoryServiceClient::RestoreFromSnapshot(const Res
 
 RestoreFromSnapshotOutcomeCallable DirectoryServiceClient::RestoreFromSnapshotCallable(const RestoreFromSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::RestoreFromSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::RestoreFromSnapshot, Aws::Client::RejectedCallOutcome<RestoreFromSnapshotOutcome>(), this, request);
+}
+
+RestoreFromSnapshotOutcomeCallable DirectoryServiceClient::RestoreFromSnapshotCallable(RestoreFromSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::RestoreFromSnapshot, Aws::Client::RejectedCallOutcome<RestoreFromSnapshotOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::RestoreFromSnapshotAsync(const RestoreFromSnapshotRequest& request, const RestoreFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::RestoreFromSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::RestoreFromSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreFromSnapshotOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::RestoreFromSnapshotAsync(RestoreFromSnapshotRequest&& request, const RestoreFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::RestoreFromSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreFromSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::RestoreFromSnapshotAsyncHelper(const RestoreFromSnapshotRequest& request, const RestoreFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -845,12 +1075,22 @@ UpdateRadiusOutcome DirectoryServiceClient::UpdateRadius(const UpdateRadiusReque
 
 UpdateRadiusOutcomeCallable DirectoryServiceClient::UpdateRadiusCallable(const UpdateRadiusRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::UpdateRadius, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::UpdateRadius, Aws::Client::RejectedCallOutcome<UpdateRadiusOutcome>(), this, request);
+}
+
+UpdateRadiusOutcomeCallable DirectoryServiceClient::UpdateRadiusCallable(UpdateRadiusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::UpdateRadius, Aws::Client::RejectedCallOutcome<UpdateRadiusOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::UpdateRadiusAsync(const UpdateRadiusRequest& request, const UpdateRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::UpdateRadiusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::UpdateRadiusAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateRadiusOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::UpdateRadiusAsync(UpdateRadiusRequest&& request, const UpdateRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::UpdateRadiusAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateRadiusOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::UpdateRadiusAsyncHelper(const UpdateRadiusRequest& request, const UpdateRadiusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -876,12 +1116,22 @@ VerifyTrustOutcome DirectoryServiceClient::VerifyTrust(const VerifyTrustRequest&
 
 VerifyTrustOutcomeCallable DirectoryServiceClient::VerifyTrustCallable(const VerifyTrustRequest& request) const
 {
-  return std::async(std::launch::async, &DirectoryServiceClient::VerifyTrust, this, request);
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::VerifyTrust, Aws::Client::RejectedCallOutcome<VerifyTrustOutcome>(), this, request);
+}
+
+VerifyTrustOutcomeCallable DirectoryServiceClient::VerifyTrustCallable(VerifyTrustRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DirectoryServiceClient::VerifyTrust, Aws::Client::RejectedCallOutcome<VerifyTrustOutcome>(), this, std::move(request));
 }
 
 void DirectoryServiceClient::VerifyTrustAsync(const VerifyTrustRequest& request, const VerifyTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DirectoryServiceClient::VerifyTrustAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DirectoryServiceClient::VerifyTrustAsyncHelper, Aws::Client::RejectedAsyncCall<VerifyTrustOutcome>(), this, request, handler, context);
+}
+
+void DirectoryServiceClient::VerifyTrustAsync(VerifyTrustRequest&& request, const VerifyTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DirectoryServiceClient::VerifyTrustAsyncHelper, Aws::Client::RejectedAsyncCall<VerifyTrustOutcome>(), this, std::move(request), handler, context);
 }
 
 void DirectoryServiceClient::VerifyTrustAsyncHelper(const VerifyTrustRequest& request, const VerifyTrustResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
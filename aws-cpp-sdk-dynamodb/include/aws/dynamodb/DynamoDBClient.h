@@ -36,6 +36,24 @@
 #include <aws/dynamodb/model/UpdateTableResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/dynamodb/model/BatchGetItemRequest.h>
+#include <aws/dynamodb/model/BatchWriteItemRequest.h>
+#include <aws/dynamodb/model/CreateTableRequest.h>
+#include <aws/dynamodb/model/DeleteItemRequest.h>
+#include <aws/dynamodb/model/DeleteTableRequest.h>
+#include <aws/dynamodb/model/DescribeLimitsRequest.h>
+#include <aws/dynamodb/model/DescribeTableRequest.h>
+#include <aws/dynamodb/model/GetItemRequest.h>
+#include <aws/dynamodb/model/ListTablesRequest.h>
+#include <aws/dynamodb/model/PutItemRequest.h>
+#include <aws/dynamodb/model/QueryRequest.h>
+#include <aws/dynamodb/model/ScanRequest.h>
+#include <aws/dynamodb/model/UpdateItemRequest.h>
+#include <aws/dynamodb/model/UpdateTableRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -358,6 +376,11 @@ namespace Model
          */
         virtual Model::BatchGetItemOutcomeCallable BatchGetItemCallable(const Model::BatchGetItemRequest& request) const;
 
+        /**
+         * Same as BatchGetItemCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BatchGetItemOutcomeCallable BatchGetItemCallable(Model::BatchGetItemRequest&& request) const;
+
         /**
          * <p>The <i>BatchGetItem</i> operation returns the attributes of one or more items
          * from one or more tables. You identify requested items by primary key.</p> <p>A
@@ -407,6 +430,11 @@ namespace Model
          */
         virtual void BatchGetItemAsync(const Model::BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetItemAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BatchGetItemAsync(Model::BatchGetItemRequest&& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>BatchWriteItem</i> operation puts or deletes multiple items in one or
          * more tables. A single call to <i>BatchWriteItem</i> can write up to 16 MB of
@@ -525,6 +553,11 @@ namespace Model
          */
         virtual Model::BatchWriteItemOutcomeCallable BatchWriteItemCallable(const Model::BatchWriteItemRequest& request) const;
 
+        /**
+         * Same as BatchWriteItemCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BatchWriteItemOutcomeCallable BatchWriteItemCallable(Model::BatchWriteItemRequest&& request) const;
+
         /**
          * <p>The <i>BatchWriteItem</i> operation puts or deletes multiple items in one or
          * more tables. A single call to <i>BatchWriteItem</i> can write up to 16 MB of
@@ -585,6 +618,11 @@ namespace Model
          */
         virtual void BatchWriteItemAsync(const Model::BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchWriteItemAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BatchWriteItemAsync(Model::BatchWriteItemRequest&& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CreateTable</i> operation adds a new table to your account. In an AWS
          * account, table names must be unique within each region. That is, you can have
@@ -623,6 +661,11 @@ namespace Model
          */
         virtual Model::CreateTableOutcomeCallable CreateTableCallable(const Model::CreateTableRequest& request) const;
 
+        /**
+         * Same as CreateTableCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateTableOutcomeCallable CreateTableCallable(Model::CreateTableRequest&& request) const;
+
         /**
          * <p>The <i>CreateTable</i> operation adds a new table to your account. In an AWS
          * account, table names must be unique within each region. That is, you can have
@@ -643,6 +686,11 @@ namespace Model
          */
         virtual void CreateTableAsync(const Model::CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTableAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateTableAsync(Model::CreateTableRequest&& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a single item in a table by primary key. You can perform a
          * conditional delete operation that deletes the item if it exists, or if it has an
@@ -673,6 +721,11 @@ namespace Model
          */
         virtual Model::DeleteItemOutcomeCallable DeleteItemCallable(const Model::DeleteItemRequest& request) const;
 
+        /**
+         * Same as DeleteItemCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteItemOutcomeCallable DeleteItemCallable(Model::DeleteItemRequest&& request) const;
+
         /**
          * <p>Deletes a single item in a table by primary key. You can perform a
          * conditional delete operation that deletes the item if it exists, or if it has an
@@ -689,6 +742,11 @@ namespace Model
          */
         virtual void DeleteItemAsync(const Model::DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteItemAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteItemAsync(Model::DeleteItemRequest&& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DeleteTable</i> operation deletes a table and all of its items. After
          * a <i>DeleteTable</i> request, the specified table is in the
@@ -731,6 +789,11 @@ namespace Model
          */
         virtual Model::DeleteTableOutcomeCallable DeleteTableCallable(const Model::DeleteTableRequest& request) const;
 
+        /**
+         * Same as DeleteTableCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteTableOutcomeCallable DeleteTableCallable(Model::DeleteTableRequest&& request) const;
+
         /**
          * <p>The <i>DeleteTable</i> operation deletes a table and all of its items. After
          * a <i>DeleteTable</i> request, the specified table is in the
@@ -753,6 +816,11 @@ namespace Model
          */
         virtual void DeleteTableAsync(const Model::DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTableAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteTableAsync(Model::DeleteTableRequest&& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the current provisioned-capacity limits for your AWS account in a
          * region, both for the region as a whole and for any one DynamoDB table that you
@@ -841,6 +909,11 @@ namespace Model
          */
         virtual Model::DescribeLimitsOutcomeCallable DescribeLimitsCallable(const Model::DescribeLimitsRequest& request) const;
 
+        /**
+         * Same as DescribeLimitsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLimitsOutcomeCallable DescribeLimitsCallable(Model::DescribeLimitsRequest&& request) const;
+
         /**
          * <p>Returns the current provisioned-capacity limits for your AWS account in a
          * region, both for the region as a whole and for any one DynamoDB table that you
@@ -886,6 +959,11 @@ namespace Model
          */
         virtual void DescribeLimitsAsync(const Model::DescribeLimitsRequest& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLimitsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLimitsAsync(Model::DescribeLimitsRequest&& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the table, including the current status of the
          * table, when it was created, the primary key schema, and any indexes on the
@@ -912,6 +990,11 @@ namespace Model
          */
         virtual Model::DescribeTableOutcomeCallable DescribeTableCallable(const Model::DescribeTableRequest& request) const;
 
+        /**
+         * Same as DescribeTableCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTableOutcomeCallable DescribeTableCallable(Model::DescribeTableRequest&& request) const;
+
         /**
          * <p>Returns information about the table, including the current status of the
          * table, when it was created, the primary key schema, and any indexes on the
@@ -926,6 +1009,11 @@ namespace Model
          */
         virtual void DescribeTableAsync(const Model::DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTableAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTableAsync(Model::DescribeTableRequest&& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>GetItem</i> operation returns a set of attributes for the item with
          * the given primary key. If there is no matching item, <i>GetItem</i> does not
@@ -950,6 +1038,11 @@ namespace Model
          */
         virtual Model::GetItemOutcomeCallable GetItemCallable(const Model::GetItemRequest& request) const;
 
+        /**
+         * Same as GetItemCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetItemOutcomeCallable GetItemCallable(Model::GetItemRequest&& request) const;
+
         /**
          * <p>The <i>GetItem</i> operation returns a set of attributes for the item with
          * the given primary key. If there is no matching item, <i>GetItem</i> does not
@@ -963,6 +1056,11 @@ namespace Model
          */
         virtual void GetItemAsync(const Model::GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetItemAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetItemAsync(Model::GetItemRequest&& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of table names associated with the current account and
          * endpoint. The output from <i>ListTables</i> is paginated, with each page
@@ -979,6 +1077,11 @@ namespace Model
          */
         virtual Model::ListTablesOutcomeCallable ListTablesCallable(const Model::ListTablesRequest& request) const;
 
+        /**
+         * Same as ListTablesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTablesOutcomeCallable ListTablesCallable(Model::ListTablesRequest&& request) const;
+
         /**
          * <p>Returns an array of table names associated with the current account and
          * endpoint. The output from <i>ListTables</i> is paginated, with each page
@@ -988,6 +1091,11 @@ namespace Model
          */
         virtual void ListTablesAsync(const Model::ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTablesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTablesAsync(Model::ListTablesRequest&& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new item, or replaces an old item with a new item. If an item that
          * has the same primary key as the new item already exists in the specified table,
@@ -1042,6 +1150,11 @@ namespace Model
          */
         virtual Model::PutItemOutcomeCallable PutItemCallable(const Model::PutItemRequest& request) const;
 
+        /**
+         * Same as PutItemCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutItemOutcomeCallable PutItemCallable(Model::PutItemRequest&& request) const;
+
         /**
          * <p>Creates a new item, or replaces an old item with a new item. If an item that
          * has the same primary key as the new item already exists in the specified table,
@@ -1070,6 +1183,11 @@ namespace Model
          */
         virtual void PutItemAsync(const Model::PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutItemAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutItemAsync(Model::PutItemRequest&& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>A <i>Query</i> operation uses the primary key of a table or a secondary index
          * to directly access items from that table or index.</p> <p>Use the
@@ -1124,6 +1242,11 @@ namespace Model
          */
         virtual Model::QueryOutcomeCallable QueryCallable(const Model::QueryRequest& request) const;
 
+        /**
+         * Same as QueryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::QueryOutcomeCallable QueryCallable(Model::QueryRequest&& request) const;
+
         /**
          * <p>A <i>Query</i> operation uses the primary key of a table or a secondary index
          * to directly access items from that table or index.</p> <p>Use the
@@ -1152,6 +1275,11 @@ namespace Model
          */
         virtual void QueryAsync(const Model::QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as QueryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void QueryAsync(Model::QueryRequest&& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>Scan</i> operation returns one or more items and item attributes by
          * accessing every item in a table or a secondary index. To have DynamoDB return
@@ -1200,6 +1328,11 @@ namespace Model
          */
         virtual Model::ScanOutcomeCallable ScanCallable(const Model::ScanRequest& request) const;
 
+        /**
+         * Same as ScanCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ScanOutcomeCallable ScanCallable(Model::ScanRequest&& request) const;
+
         /**
          * <p>The <i>Scan</i> operation returns one or more items and item attributes by
          * accessing every item in a table or a secondary index. To have DynamoDB return
@@ -1225,6 +1358,11 @@ namespace Model
          */
         virtual void ScanAsync(const Model::ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ScanAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ScanAsync(Model::ScanRequest&& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Edits an existing item's attributes, or adds a new item to the table if it
          * does not already exist. You can put, delete, or add attribute values. You can
@@ -1249,6 +1387,11 @@ namespace Model
          */
         virtual Model::UpdateItemOutcomeCallable UpdateItemCallable(const Model::UpdateItemRequest& request) const;
 
+        /**
+         * Same as UpdateItemCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateItemOutcomeCallable UpdateItemCallable(Model::UpdateItemRequest&& request) const;
+
         /**
          * <p> Edits an existing item's attributes, or adds a new item to the table if it
          * does not already exist. You can put, delete, or add attribute values. You can
@@ -1262,6 +1405,11 @@ namespace Model
          */
         virtual void UpdateItemAsync(const Model::UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateItemAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateItemAsync(Model::UpdateItemRequest&& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the provisioned throughput settings, global secondary indexes, or
          * DynamoDB Streams settings for a given table.</p> <p>You can only perform one of
@@ -1296,6 +1444,11 @@ namespace Model
          */
         virtual Model::UpdateTableOutcomeCallable UpdateTableCallable(const Model::UpdateTableRequest& request) const;
 
+        /**
+         * Same as UpdateTableCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateTableOutcomeCallable UpdateTableCallable(Model::UpdateTableRequest&& request) const;
+
         /**
          * <p>Modifies the provisioned throughput settings, global secondary indexes, or
          * DynamoDB Streams settings for a given table.</p> <p>You can only perform one of
@@ -1314,6 +1467,46 @@ namespace Model
          */
         virtual void UpdateTableAsync(const Model::UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateTableAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateTableAsync(Model::UpdateTableRequest&& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetItemOutcome> BatchGetItemAwaitable(const Model::BatchGetItemRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::BatchGetItem, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetItemOutcome> BatchGetItemAwaitable(Model::BatchGetItemRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::BatchGetItem, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchWriteItemOutcome> BatchWriteItemAwaitable(const Model::BatchWriteItemRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::BatchWriteItem, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchWriteItemOutcome> BatchWriteItemAwaitable(Model::BatchWriteItemRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::BatchWriteItem, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTableOutcome> CreateTableAwaitable(const Model::CreateTableRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::CreateTable, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTableOutcome> CreateTableAwaitable(Model::CreateTableRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::CreateTable, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteItemOutcome> DeleteItemAwaitable(const Model::DeleteItemRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::DeleteItem, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteItemOutcome> DeleteItemAwaitable(Model::DeleteItemRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::DeleteItem, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTableOutcome> DeleteTableAwaitable(const Model::DeleteTableRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::DeleteTable, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTableOutcome> DeleteTableAwaitable(Model::DeleteTableRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::DeleteTable, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLimitsOutcome> DescribeLimitsAwaitable(const Model::DescribeLimitsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::DescribeLimits, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLimitsOutcome> DescribeLimitsAwaitable(Model::DescribeLimitsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::DescribeLimits, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTableOutcome> DescribeTableAwaitable(const Model::DescribeTableRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::DescribeTable, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTableOutcome> DescribeTableAwaitable(Model::DescribeTableRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::DescribeTable, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetItemOutcome> GetItemAwaitable(const Model::GetItemRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::GetItem, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetItemOutcome> GetItemAwaitable(Model::GetItemRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::GetItem, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTablesOutcome> ListTablesAwaitable(const Model::ListTablesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::ListTables, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTablesOutcome> ListTablesAwaitable(Model::ListTablesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::ListTables, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutItemOutcome> PutItemAwaitable(const Model::PutItemRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::PutItem, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutItemOutcome> PutItemAwaitable(Model::PutItemRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::PutItem, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::QueryOutcome> QueryAwaitable(const Model::QueryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::Query, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::QueryOutcome> QueryAwaitable(Model::QueryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::Query, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ScanOutcome> ScanAwaitable(const Model::ScanRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::Scan, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ScanOutcome> ScanAwaitable(Model::ScanRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::Scan, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateItemOutcome> UpdateItemAwaitable(const Model::UpdateItemRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::UpdateItem, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateItemOutcome> UpdateItemAwaitable(Model::UpdateItemRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::UpdateItem, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateTableOutcome> UpdateTableAwaitable(const Model::UpdateTableRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::UpdateTable, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateTableOutcome> UpdateTableAwaitable(Model::UpdateTableRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &DynamoDBClient::UpdateTable, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -121,12 +121,22 @@ BatchGetItemOutcome DynamoDBClient::BatchGetItem(const BatchGetItemRequest& requ
 
 BatchGetItemOutcomeCallable DynamoDBClient::BatchGetItemCallable(const BatchGetItemRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::BatchGetItem, this, request);
+  return m_executor->SubmitWithFuture(&DynamoDBClient::BatchGetItem, Aws::Client::RejectedCallOutcome<BatchGetItemOutcome>(), this, request);
+}
+
+BatchGetItemOutcomeCallable DynamoDBClient::BatchGetItemCallable(BatchGetItemRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DynamoDBClient::BatchGetItem, Aws::Client::RejectedCallOutcome<BatchGetItemOutcome>(), this, std::move(request));
 }
 
 void DynamoDBClient::BatchGetItemAsync(const BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::BatchGetItemAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DynamoDBClient::BatchGetItemAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetItemOutcome>(), this, request, handler, context);
+}
+
+void DynamoDBClient::BatchGetItemAsync(BatchGetItemRequest&& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DynamoDBClient::BatchGetItemAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetItemOutcome>(), this, std::move(request), handler, context);
 }
 
 void DynamoDBClient::BatchGetItemAsyncHelper(const BatchGetItemRequest& request, const BatchGetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -152,12 +162,22 @@ BatchWriteItemOutcome DynamoDBClient::BatchWriteItem(const BatchWriteItemRequest
 
 BatchWriteItemOutcomeCallable DynamoDBClient::BatchWriteItemCallable(const BatchWriteItemRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::BatchWriteItem, this, request);
+  return m_executor->SubmitWithFuture(&DynamoDBClient::BatchWriteItem, Aws::Client::RejectedCallOutcome<BatchWriteItemOutcome>(), this, request);
+}
+
+BatchWriteItemOutcomeCallable DynamoDBClient::BatchWriteItemCallable(BatchWriteItemRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DynamoDBClient::BatchWriteItem, Aws::Client::RejectedCallOutcome<BatchWriteItemOutcome>(), this, std::move(request));
 }
 
 void DynamoDBClient::BatchWriteItemAsync(const BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::BatchWriteItemAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DynamoDBClient::BatchWriteItemAsyncHelper, Aws::Client::RejectedAsyncCall<BatchWriteItemOutcome>(), this, request, handler, context);
+}
+
+void DynamoDBClient::BatchWriteItemAsync(BatchWriteItemRequest&& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DynamoDBClient::BatchWriteItemAsyncHelper, Aws::Client::RejectedAsyncCall<BatchWriteItemOutcome>(), this, std::move(request), handler, context);
 }
 
 void DynamoDBClient::BatchWriteItemAsyncHelper(const BatchWriteItemRequest& request, const BatchWriteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -183,12 +203,22 @@ CreateTableOutcome DynamoDBClient::CreateTable(const CreateTableRequest& request
 
 CreateTableOutcomeCallable DynamoDBClient::CreateTableCallable(const CreateTableRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::CreateTable, this, request);
+  return m_executor->SubmitWithFuture(&DynamoDBClient::CreateTable, Aws::Client::RejectedCallOutcome<CreateTableOutcome>(), this, request);
+}
+
+CreateTableOutcomeCallable DynamoDBClient::CreateTableCallable(CreateTableRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DynamoDBClient::CreateTable, Aws::Client::RejectedCallOutcome<CreateTableOutcome>(), this, std::move(request));
 }
 
 void DynamoDBClient::CreateTableAsync(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::CreateTableAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DynamoDBClient::CreateTableAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTableOutcome>(), this, request, handler, context);
+}
+
+void DynamoDBClient::CreateTableAsync(CreateTableRequest&& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DynamoDBClient::CreateTableAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTableOutcome>(), this, std::move(request), handler, context);
 }
 
 void DynamoDBClient::CreateTableAsyncHelper(const CreateTableRequest& request, const CreateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -214,12 +244,22 @@ DeleteItemOutcome DynamoDBClient::DeleteItem(const DeleteItemRequest& request) c
 
 DeleteItemOutcomeCallable DynamoDBClient::DeleteItemCallable(const DeleteItemRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::DeleteItem, this, request);
+  return m_executor->SubmitWithFuture(&DynamoDBClient::DeleteItem, Aws::Client::RejectedCallOutcome<DeleteItemOutcome>(), this, request);
+}
+
+DeleteItemOutcomeCallable DynamoDBClient::DeleteItemCallable(DeleteItemRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DynamoDBClient::DeleteItem, Aws::Client::RejectedCallOutcome<DeleteItemOutcome>(), this, std::move(request));
 }
 
 void DynamoDBClient::DeleteItemAsync(const DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::DeleteItemAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DynamoDBClient::DeleteItemAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteItemOutcome>(), this, request, handler, context);
+}
+
+void DynamoDBClient::DeleteItemAsync(DeleteItemRequest&& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DynamoDBClient::DeleteItemAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteItemOutcome>(), this, std::move(request), handler, context);
 }
 
 void DynamoDBClient::DeleteItemAsyncHelper(const DeleteItemRequest& request, const DeleteItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -245,12 +285,22 @@ DeleteTableOutcome DynamoDBClient::DeleteTable(const DeleteTableRequest& request
 
 DeleteTableOutcomeCallable DynamoDBClient::DeleteTableCallable(const DeleteTableRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::DeleteTable, this, request);
+  return m_executor->SubmitWithFuture(&DynamoDBClient::DeleteTable, Aws::Client::RejectedCallOutcome<DeleteTableOutcome>(), this, request);
+}
+
+DeleteTableOutcomeCallable DynamoDBClient::DeleteTableCallable(DeleteTableRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DynamoDBClient::DeleteTable, Aws::Client::RejectedCallOutcome<DeleteTableOutcome>(), this, std::move(request));
 }
 
 void DynamoDBClient::DeleteTableAsync(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::DeleteTableAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DynamoDBClient::DeleteTableAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTableOutcome>(), this, request, handler, context);
+}
+
+void DynamoDBClient::DeleteTableAsync(DeleteTableRequest&& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DynamoDBClient::DeleteTableAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTableOutcome>(), this, std::move(request), handler, context);
 }
 
 void DynamoDBClient::DeleteTableAsyncHelper(const DeleteTableRequest& request, const DeleteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -276,12 +326,22 @@ DescribeLimitsOutcome DynamoDBClient::DescribeLimits(const DescribeLimitsRequest
 
 DescribeLimitsOutcomeCallable DynamoDBClient::DescribeLimitsCallable(const DescribeLimitsRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::DescribeLimits, this, request);
+  return m_executor->SubmitWithFuture(&DynamoDBClient::DescribeLimits, Aws::Client::RejectedCallOutcome<DescribeLimitsOutcome>(), this, request);
+}
+
+DescribeLimitsOutcomeCallable DynamoDBClient::DescribeLimitsCallable(DescribeLimitsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DynamoDBClient::DescribeLimits, Aws::Client::RejectedCallOutcome<DescribeLimitsOutcome>(), this, std::move(request));
 }
 
 void DynamoDBClient::DescribeLimitsAsync(const DescribeLimitsRequest& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::DescribeLimitsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DynamoDBClient::DescribeLimitsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLimitsOutcome>(), this, request, handler, context);
+}
+
+void DynamoDBClient::DescribeLimitsAsync(DescribeLimitsRequest&& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DynamoDBClient::DescribeLimitsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLimitsOutcome>(), this, std::move(request), handler, context);
 }
 
 void DynamoDBClient::DescribeLimitsAsyncHelper(const DescribeLimitsRequest& request, const DescribeLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -307,12 +367,22 @@ DescribeTableOutcome DynamoDBClient::DescribeTable(const DescribeTableRequest& r
 
 DescribeTableOutcomeCallable DynamoDBClient::DescribeTableCallable(const DescribeTableRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::DescribeTable, this, request);
+  return m_executor->SubmitWithFuture(&DynamoDBClient::DescribeTable, Aws::Client::RejectedCallOutcome<DescribeTableOutcome>(), this, request);
+}
+
+DescribeTableOutcomeCallable DynamoDBClient::DescribeTableCallable(DescribeTableRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DynamoDBClient::DescribeTable, Aws::Client::RejectedCallOutcome<DescribeTableOutcome>(), this, std::move(request));
 }
 
 void DynamoDBClient::DescribeTableAsync(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::DescribeTableAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DynamoDBClient::DescribeTableAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTableOutcome>(), this, request, handler, context);
+}
+
+void DynamoDBClient::DescribeTableAsync(DescribeTableRequest&& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DynamoDBClient::DescribeTableAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTableOutcome>(), this, std::move(request), handler, context);
 }
 
 void DynamoDBClient::DescribeTableAsyncHelper(const DescribeTableRequest& request, const DescribeTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -338,12 +408,22 @@ GetItemOutcome DynamoDBClient::GetItem(const GetItemRequest& request) const
 
 GetItemOutcomeCallable DynamoDBClient::GetItemCallable(const GetItemRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::GetItem, this, request);
+  return m_executor->SubmitWithFuture(&DynamoDBClient::GetItem, Aws::Client::RejectedCallOutcome<GetItemOutcome>(), this, request);
+}
+
+GetItemOutcomeCallable DynamoDBClient::GetItemCallable(GetItemRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DynamoDBClient::GetItem, Aws::Client::RejectedCallOutcome<GetItemOutcome>(), this, std::move(request));
 }
 
 void DynamoDBClient::GetItemAsync(const GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::GetItemAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DynamoDBClient::GetItemAsyncHelper, Aws::Client::RejectedAsyncCall<GetItemOutcome>(), this, request, handler, context);
+}
+
+void DynamoDBClient::GetItemAsync(GetItemRequest&& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DynamoDBClient::GetItemAsyncHelper, Aws::Client::RejectedAsyncCall<GetItemOutcome>(), this, std::move(request), handler, context);
 }
 
 void DynamoDBClient::GetItemAsyncHelper(const GetItemRequest& request, const GetItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -369,12 +449,22 @@ ListTablesOutcome DynamoDBClient::ListTables(const ListTablesRequest& request) c
 
 ListTablesOutcomeCallable DynamoDBClient::ListTablesCallable(const ListTablesRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::ListTables, this, request);
+  return m_executor->SubmitWithFuture(&DynamoDBClient::ListTables, Aws::Client::RejectedCallOutcome<ListTablesOutcome>(), this, request);
+}
+
+ListTablesOutcomeCallable DynamoDBClient::ListTablesCallable(ListTablesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DynamoDBClient::ListTables, Aws::Client::RejectedCallOutcome<ListTablesOutcome>(), this, std::move(request));
 }
 
 void DynamoDBClient::ListTablesAsync(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::ListTablesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DynamoDBClient::ListTablesAsyncHelper, Aws::Client::RejectedAsyncCall<ListTablesOutcome>(), this, request, handler, context);
+}
+
+void DynamoDBClient::ListTablesAsync(ListTablesRequest&& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DynamoDBClient::ListTablesAsyncHelper, Aws::Client::RejectedAsyncCall<ListTablesOutcome>(), this, std::move(request), handler, context);
 }
 
 void DynamoDBClient::ListTablesAsyncHelper(const ListTablesRequest& request, const ListTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -400,12 +490,22 @@ PutItemOutcome DynamoDBClient::PutItem(const PutItemRequest& request) const
 
 PutItemOutcomeCallable DynamoDBClient::PutItemCallable(const PutItemRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::PutItem, this, request);
+  return m_executor->SubmitWithFuture(&DynamoDBClient::PutItem, Aws::Client::RejectedCallOutcome<PutItemOutcome>(), this, request);
+}
+
+PutItemOutcomeCallable DynamoDBClient::PutItemCallable(PutItemRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DynamoDBClient::PutItem, Aws::Client::RejectedCallOutcome<PutItemOutcome>(), this, std::move(request));
 }
 
 void DynamoDBClient::PutItemAsync(const PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::PutItemAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DynamoDBClient::PutItemAsyncHelper, Aws::Client::RejectedAsyncCall<PutItemOutcome>(), this, request, handler, context);
+}
+
+void DynamoDBClient::PutItemAsync(PutItemRequest&& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DynamoDBClient::PutItemAsyncHelper, Aws::Client::RejectedAsyncCall<PutItemOutcome>(), this, std::move(request), handler, context);
 }
 
 void DynamoDBClient::PutItemAsyncHelper(const PutItemRequest& request, const PutItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -431,12 +531,22 @@ QueryOutcome DynamoDBClient::Query(const QueryRequest& request) const
 
 QueryOutcomeCallable DynamoDBClient::QueryCallable(const QueryRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::Query, this, request);
+  return m_executor->SubmitWithFuture(&DynamoDBClient::Query, Aws::Client::RejectedCallOutcome<QueryOutcome>(), this, request);
+}
+
+QueryOutcomeCallable DynamoDBClient::QueryCallable(QueryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DynamoDBClient::Query, Aws::Client::RejectedCallOutcome<QueryOutcome>(), this, std::move(request));
 }
 
 void DynamoDBClient::QueryAsync(const QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::QueryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DynamoDBClient::QueryAsyncHelper, Aws::Client::RejectedAsyncCall<QueryOutcome>(), this, request, handler, context);
+}
+
+void DynamoDBClient::QueryAsync(QueryRequest&& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DynamoDBClient::QueryAsyncHelper, Aws::Client::RejectedAsyncCall<QueryOutcome>(), this, std::move(request), handler, context);
 }
 
 void DynamoDBClient::QueryAsyncHelper(const QueryRequest& request, const QueryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -462,12 +572,22 @@ ScanOutcome DynamoDBClient::Scan(const ScanRequest& request) const
 
 ScanOutcomeCallable DynamoDBClient::ScanCallable(const ScanRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::Scan, this, request);
+  return m_executor->SubmitWithFuture(&DynamoDBClient::Scan, Aws::Client::RejectedCallOutcome<ScanOutcome>(), this, request);
+}
+
+ScanOutcomeCallable DynamoDBClient::ScanCallable(ScanRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DynamoDBClient::Scan, Aws::Client::RejectedCallOutcome<ScanOutcome>(), this, std::move(request));
 }
 
 void DynamoDBClient::ScanAsync(const ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::ScanAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DynamoDBClient::ScanAsyncHelper, Aws::Client::RejectedAsyncCall<ScanOutcome>(), this, request, handler, context);
+}
+
+void DynamoDBClient::ScanAsync(ScanRequest&& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DynamoDBClient::ScanAsyncHelper, Aws::Client::RejectedAsyncCall<ScanOutcome>(), this, std::move(request), handler, context);
 }
 
 void DynamoDBClient::ScanAsyncHelper(const ScanRequest& request, const ScanResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -493,12 +613,22 @@ UpdateItemOutcome DynamoDBClient::UpdateItem(const UpdateItemRequest& request) c
 
 UpdateItemOutcomeCallable DynamoDBClient::UpdateItemCallable(const UpdateItemRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::UpdateItem, this, request);
+  return m_executor->SubmitWithFuture(&DynamoDBClient::UpdateItem, Aws::Client::RejectedCallOutcome<UpdateItemOutcome>(), this, request);
+}
+
+UpdateItemOutcomeCallable DynamoDBClient::UpdateItemCallable(UpdateItemRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DynamoDBClient::UpdateItem, Aws::Client::RejectedCallOutcome<UpdateItemOutcome>(), this, std::move(request));
 }
 
 void DynamoDBClient::UpdateItemAsync(const UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::UpdateItemAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DynamoDBClient::UpdateItemAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateItemOutcome>(), this, request, handler, context);
+}
+
+void DynamoDBClient::UpdateItemAsync(UpdateItemRequest&& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DynamoDBClient::UpdateItemAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateItemOutcome>(), this, std::move(request), handler, context);
 }
 
 void DynamoDBClient::UpdateItemAsyncHelper(const UpdateItemRequest& request, const UpdateItemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -524,12 +654,22 @@ UpdateTableOutcome DynamoDBClient::UpdateTable(const UpdateTableRequest& request
 
 UpdateTableOutcomeCallable DynamoDBClient::UpdateTableCallable(const UpdateTableRequest& request) const
 {
-  return std::async(std::launch::async, &DynamoDBClient::UpdateTable, this, request);
+  return m_executor->SubmitWithFuture(&DynamoDBClient::UpdateTable, Aws::Client::RejectedCallOutcome<UpdateTableOutcome>(), this, request);
+}
+
+UpdateTableOutcomeCallable DynamoDBClient::UpdateTableCallable(UpdateTableRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&DynamoDBClient::UpdateTable, Aws::Client::RejectedCallOutcome<UpdateTableOutcome>(), this, std::move(request));
 }
 
 void DynamoDBClient::UpdateTableAsync(const UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&DynamoDBClient::UpdateTableAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&DynamoDBClient::UpdateTableAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateTableOutcome>(), this, request, handler, context);
+}
+
+void DynamoDBClient::UpdateTableAsync(UpdateTableRequest&& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&DynamoDBClient::UpdateTableAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateTableOutcome>(), this, std::move(request), handler, context);
 }
 
 void DynamoDBClient::UpdateTableAsyncHelper(const UpdateTableRequest& request, const UpdateTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -163,6 +163,210 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/ec2/model/AcceptVpcPeeringConnectionRequest.h>
+#include <aws/ec2/model/AllocateAddressRequest.h>
+#include <aws/ec2/model/AllocateHostsRequest.h>
+#include <aws/ec2/model/AssignPrivateIpAddressesRequest.h>
+#include <aws/ec2/model/AssociateAddressRequest.h>
+#include <aws/ec2/model/AssociateDhcpOptionsRequest.h>
+#include <aws/ec2/model/AssociateRouteTableRequest.h>
+#include <aws/ec2/model/AttachClassicLinkVpcRequest.h>
+#include <aws/ec2/model/AttachInternetGatewayRequest.h>
+#include <aws/ec2/model/AttachNetworkInterfaceRequest.h>
+#include <aws/ec2/model/AttachVolumeRequest.h>
+#include <aws/ec2/model/AttachVpnGatewayRequest.h>
+#include <aws/ec2/model/AuthorizeSecurityGroupEgressRequest.h>
+#include <aws/ec2/model/AuthorizeSecurityGroupIngressRequest.h>
+#include <aws/ec2/model/BundleInstanceRequest.h>
+#include <aws/ec2/model/CancelBundleTaskRequest.h>
+#include <aws/ec2/model/CancelConversionTaskRequest.h>
+#include <aws/ec2/model/CancelExportTaskRequest.h>
+#include <aws/ec2/model/CancelImportTaskRequest.h>
+#include <aws/ec2/model/CancelReservedInstancesListingRequest.h>
+#include <aws/ec2/model/CancelSpotFleetRequestsRequest.h>
+#include <aws/ec2/model/CancelSpotInstanceRequestsRequest.h>
+#include <aws/ec2/model/ConfirmProductInstanceRequest.h>
+#include <aws/ec2/model/CopyImageRequest.h>
+#include <aws/ec2/model/CopySnapshotRequest.h>
+#include <aws/ec2/model/CreateCustomerGatewayRequest.h>
+#include <aws/ec2/model/CreateDhcpOptionsRequest.h>
+#include <aws/ec2/model/CreateFlowLogsRequest.h>
+#include <aws/ec2/model/CreateImageRequest.h>
+#include <aws/ec2/model/CreateInstanceExportTaskRequest.h>
+#include <aws/ec2/model/CreateInternetGatewayRequest.h>
+#include <aws/ec2/model/CreateKeyPairRequest.h>
+#include <aws/ec2/model/CreateNatGatewayRequest.h>
+#include <aws/ec2/model/CreateNetworkAclRequest.h>
+#include <aws/ec2/model/CreateNetworkAclEntryRequest.h>
+#include <aws/ec2/model/CreateNetworkInterfaceRequest.h>
+#include <aws/ec2/model/CreatePlacementGroupRequest.h>
+#include <aws/ec2/model/CreateReservedInstancesListingRequest.h>
+#include <aws/ec2/model/CreateRouteRequest.h>
+#include <aws/ec2/model/CreateRouteTableRequest.h>
+#include <aws/ec2/model/CreateSecurityGroupRequest.h>
+#include <aws/ec2/model/CreateSnapshotRequest.h>
+#include <aws/ec2/model/CreateSpotDatafeedSubscriptionRequest.h>
+#include <aws/ec2/model/CreateSubnetRequest.h>
+#include <aws/ec2/model/CreateTagsRequest.h>
+#include <aws/ec2/model/CreateVolumeRequest.h>
+#include <aws/ec2/model/CreateVpcRequest.h>
+#include <aws/ec2/model/CreateVpcEndpointRequest.h>
+#include <aws/ec2/model/CreateVpcPeeringConnectionRequest.h>
+#include <aws/ec2/model/CreateVpnConnectionRequest.h>
+#include <aws/ec2/model/CreateVpnConnectionRouteRequest.h>
+#include <aws/ec2/model/CreateVpnGatewayRequest.h>
+#include <aws/ec2/model/DeleteCustomerGatewayRequest.h>
+#include <aws/ec2/model/DeleteDhcpOptionsRequest.h>
+#include <aws/ec2/model/DeleteFlowLogsRequest.h>
+#include <aws/ec2/model/DeleteInternetGatewayRequest.h>
+#include <aws/ec2/model/DeleteKeyPairRequest.h>
+#include <aws/ec2/model/DeleteNatGatewayRequest.h>
+#include <aws/ec2/model/DeleteNetworkAclRequest.h>
+#include <aws/ec2/model/DeleteNetworkAclEntryRequest.h>
+#include <aws/ec2/model/DeleteNetworkInterfaceRequest.h>
+#include <aws/ec2/model/DeletePlacementGroupRequest.h>
+#include <aws/ec2/model/DeleteRouteRequest.h>
+#include <aws/ec2/model/DeleteRouteTableRequest.h>
+#include <aws/ec2/model/DeleteSecurityGroupRequest.h>
+#include <aws/ec2/model/DeleteSnapshotRequest.h>
+#include <aws/ec2/model/DeleteSpotDatafeedSubscriptionRequest.h>
+#include <aws/ec2/model/DeleteSubnetRequest.h>
+#include <aws/ec2/model/DeleteTagsRequest.h>
+#include <aws/ec2/model/DeleteVolumeRequest.h>
+#include <aws/ec2/model/DeleteVpcRequest.h>
+#include <aws/ec2/model/DeleteVpcEndpointsRequest.h>
+#include <aws/ec2/model/DeleteVpcPeeringConnectionRequest.h>
+#include <aws/ec2/model/DeleteVpnConnectionRequest.h>
+#include <aws/ec2/model/DeleteVpnConnectionRouteRequest.h>
+#include <aws/ec2/model/DeleteVpnGatewayRequest.h>
+#include <aws/ec2/model/DeregisterImageRequest.h>
+#include <aws/ec2/model/DescribeAccountAttributesRequest.h>
+#include <aws/ec2/model/DescribeAddressesRequest.h>
+#include <aws/ec2/model/DescribeAvailabilityZonesRequest.h>
+#include <aws/ec2/model/DescribeBundleTasksRequest.h>
+#include <aws/ec2/model/DescribeClassicLinkInstancesRequest.h>
+#include <aws/ec2/model/DescribeConversionTasksRequest.h>
+#include <aws/ec2/model/DescribeCustomerGatewaysRequest.h>
+#include <aws/ec2/model/DescribeDhcpOptionsRequest.h>
+#include <aws/ec2/model/DescribeExportTasksRequest.h>
+#include <aws/ec2/model/DescribeFlowLogsRequest.h>
+#include <aws/ec2/model/DescribeHostsRequest.h>
+#include <aws/ec2/model/DescribeIdFormatRequest.h>
+#include <aws/ec2/model/DescribeImageAttributeRequest.h>
+#include <aws/ec2/model/DescribeImagesRequest.h>
+#include <aws/ec2/model/DescribeImportImageTasksRequest.h>
+#include <aws/ec2/model/DescribeImportSnapshotTasksRequest.h>
+#include <aws/ec2/model/DescribeInstanceAttributeRequest.h>
+#include <aws/ec2/model/DescribeInstanceStatusRequest.h>
+#include <aws/ec2/model/DescribeInstancesRequest.h>
+#include <aws/ec2/model/DescribeInternetGatewaysRequest.h>
+#include <aws/ec2/model/DescribeKeyPairsRequest.h>
+#include <aws/ec2/model/DescribeMovingAddressesRequest.h>
+#include <aws/ec2/model/DescribeNatGatewaysRequest.h>
+#include <aws/ec2/model/DescribeNetworkAclsRequest.h>
+#include <aws/ec2/model/DescribeNetworkInterfaceAttributeRequest.h>
+#include <aws/ec2/model/DescribeNetworkInterfacesRequest.h>
+#include <aws/ec2/model/DescribePlacementGroupsRequest.h>
+#include <aws/ec2/model/DescribePrefixListsRequest.h>
+#include <aws/ec2/model/DescribeRegionsRequest.h>
+#include <aws/ec2/model/DescribeReservedInstancesRequest.h>
+#include <aws/ec2/model/DescribeReservedInstancesListingsRequest.h>
+#include <aws/ec2/model/DescribeReservedInstancesModificationsRequest.h>
+#include <aws/ec2/model/DescribeReservedInstancesOfferingsRequest.h>
+#include <aws/ec2/model/DescribeRouteTablesRequest.h>
+#include <aws/ec2/model/DescribeScheduledInstanceAvailabilityRequest.h>
+#include <aws/ec2/model/DescribeScheduledInstancesRequest.h>
+#include <aws/ec2/model/DescribeSecurityGroupsRequest.h>
+#include <aws/ec2/model/DescribeSnapshotAttributeRequest.h>
+#include <aws/ec2/model/DescribeSnapshotsRequest.h>
+#include <aws/ec2/model/DescribeSpotDatafeedSubscriptionRequest.h>
+#include <aws/ec2/model/DescribeSpotFleetInstancesRequest.h>
+#include <aws/ec2/model/DescribeSpotFleetRequestHistoryRequest.h>
+#include <aws/ec2/model/DescribeSpotFleetRequestsRequest.h>
+#include <aws/ec2/model/DescribeSpotInstanceRequestsRequest.h>
+#include <aws/ec2/model/DescribeSpotPriceHistoryRequest.h>
+#include <aws/ec2/model/DescribeSubnetsRequest.h>
+#include <aws/ec2/model/DescribeTagsRequest.h>
+#include <aws/ec2/model/DescribeVolumeAttributeRequest.h>
+#include <aws/ec2/model/DescribeVolumeStatusRequest.h>
+#include <aws/ec2/model/DescribeVolumesRequest.h>
+#include <aws/ec2/model/DescribeVpcAttributeRequest.h>
+#include <aws/ec2/model/DescribeVpcClassicLinkRequest.h>
+#include <aws/ec2/model/DescribeVpcClassicLinkDnsSupportRequest.h>
+#include <aws/ec2/model/DescribeVpcEndpointServicesRequest.h>
+#include <aws/ec2/model/DescribeVpcEndpointsRequest.h>
+#include <aws/ec2/model/DescribeVpcPeeringConnectionsRequest.h>
+#include <aws/ec2/model/DescribeVpcsRequest.h>
+#include <aws/ec2/model/DescribeVpnConnectionsRequest.h>
+#include <aws/ec2/model/DescribeVpnGatewaysRequest.h>
+#include <aws/ec2/model/DetachClassicLinkVpcRequest.h>
+#include <aws/ec2/model/DetachInternetGatewayRequest.h>
+#include <aws/ec2/model/DetachNetworkInterfaceRequest.h>
+#include <aws/ec2/model/DetachVolumeRequest.h>
+#include <aws/ec2/model/DetachVpnGatewayRequest.h>
+#include <aws/ec2/model/DisableVgwRoutePropagationRequest.h>
+#include <aws/ec2/model/DisableVpcClassicLinkRequest.h>
+#include <aws/ec2/model/DisableVpcClassicLinkDnsSupportRequest.h>
+#include <aws/ec2/model/DisassociateAddressRequest.h>
+#include <aws/ec2/model/DisassociateRouteTableRequest.h>
+#include <aws/ec2/model/EnableVgwRoutePropagationRequest.h>
+#include <aws/ec2/model/EnableVolumeIORequest.h>
+#include <aws/ec2/model/EnableVpcClassicLinkRequest.h>
+#include <aws/ec2/model/EnableVpcClassicLinkDnsSupportRequest.h>
+#include <aws/ec2/model/GetConsoleOutputRequest.h>
+#include <aws/ec2/model/GetPasswordDataRequest.h>
+#include <aws/ec2/model/ImportImageRequest.h>
+#include <aws/ec2/model/ImportInstanceRequest.h>
+#include <aws/ec2/model/ImportKeyPairRequest.h>
+#include <aws/ec2/model/ImportSnapshotRequest.h>
+#include <aws/ec2/model/ImportVolumeRequest.h>
+#include <aws/ec2/model/ModifyHostsRequest.h>
+#include <aws/ec2/model/ModifyIdFormatRequest.h>
+#include <aws/ec2/model/ModifyImageAttributeRequest.h>
+#include <aws/ec2/model/ModifyInstanceAttributeRequest.h>
+#include <aws/ec2/model/ModifyInstancePlacementRequest.h>
+#include <aws/ec2/model/ModifyNetworkInterfaceAttributeRequest.h>
+#include <aws/ec2/model/ModifyReservedInstancesRequest.h>
+#include <aws/ec2/model/ModifySnapshotAttributeRequest.h>
+#include <aws/ec2/model/ModifySpotFleetRequestRequest.h>
+#include <aws/ec2/model/ModifySubnetAttributeRequest.h>
+#include <aws/ec2/model/ModifyVolumeAttributeRequest.h>
+#include <aws/ec2/model/ModifyVpcAttributeRequest.h>
+#include <aws/ec2/model/ModifyVpcEndpointRequest.h>
+#include <aws/ec2/model/MonitorInstancesRequest.h>
+#include <aws/ec2/model/MoveAddressToVpcRequest.h>
+#include <aws/ec2/model/PurchaseReservedInstancesOfferingRequest.h>
+#include <aws/ec2/model/PurchaseScheduledInstancesRequest.h>
+#include <aws/ec2/model/RebootInstancesRequest.h>
+#include <aws/ec2/model/RegisterImageRequest.h>
+#include <aws/ec2/model/RejectVpcPeeringConnectionRequest.h>
+#include <aws/ec2/model/ReleaseAddressRequest.h>
+#include <aws/ec2/model/ReleaseHostsRequest.h>
+#include <aws/ec2/model/ReplaceNetworkAclAssociationRequest.h>
+#include <aws/ec2/model/ReplaceNetworkAclEntryRequest.h>
+#include <aws/ec2/model/ReplaceRouteRequest.h>
+#include <aws/ec2/model/ReplaceRouteTableAssociationRequest.h>
+#include <aws/ec2/model/ReportInstanceStatusRequest.h>
+#include <aws/ec2/model/RequestSpotFleetRequest.h>
+#include <aws/ec2/model/RequestSpotInstancesRequest.h>
+#include <aws/ec2/model/ResetImageAttributeRequest.h>
+#include <aws/ec2/model/ResetInstanceAttributeRequest.h>
+#include <aws/ec2/model/ResetNetworkInterfaceAttributeRequest.h>
+#include <aws/ec2/model/ResetSnapshotAttributeRequest.h>
+#include <aws/ec2/model/RestoreAddressToClassicRequest.h>
+#include <aws/ec2/model/RevokeSecurityGroupEgressRequest.h>
+#include <aws/ec2/model/RevokeSecurityGroupIngressRequest.h>
+#include <aws/ec2/model/RunInstancesRequest.h>
+#include <aws/ec2/model/RunScheduledInstancesRequest.h>
+#include <aws/ec2/model/StartInstancesRequest.h>
+#include <aws/ec2/model/StopInstancesRequest.h>
+#include <aws/ec2/model/TerminateInstancesRequest.h>
+#include <aws/ec2/model/UnassignPrivateIpAddressesRequest.h>
+#include <aws/ec2/model/UnmonitorInstancesRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -1064,6 +1268,11 @@ namespace Model
          */
         virtual Model::AcceptVpcPeeringConnectionOutcomeCallable AcceptVpcPeeringConnectionCallable(const Model::AcceptVpcPeeringConnectionRequest& request) const;
 
+        /**
+         * Same as AcceptVpcPeeringConnectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AcceptVpcPeeringConnectionOutcomeCallable AcceptVpcPeeringConnectionCallable(Model::AcceptVpcPeeringConnectionRequest&& request) const;
+
         /**
          * <p>Accept a VPC peering connection request. To accept a request, the VPC peering
          * connection must be in the <code>pending-acceptance</code> state, and you must be
@@ -1074,6 +1283,11 @@ namespace Model
          */
         virtual void AcceptVpcPeeringConnectionAsync(const Model::AcceptVpcPeeringConnectionRequest& request, const AcceptVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AcceptVpcPeeringConnectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AcceptVpcPeeringConnectionAsync(Model::AcceptVpcPeeringConnectionRequest&& request, const AcceptVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Acquires an Elastic IP address.</p> <p>An Elastic IP address is for use
          * either in the EC2-Classic platform or in a VPC. For more information, see <a
@@ -1092,6 +1306,11 @@ namespace Model
          */
         virtual Model::AllocateAddressOutcomeCallable AllocateAddressCallable(const Model::AllocateAddressRequest& request) const;
 
+        /**
+         * Same as AllocateAddressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AllocateAddressOutcomeCallable AllocateAddressCallable(Model::AllocateAddressRequest&& request) const;
+
         /**
          * <p>Acquires an Elastic IP address.</p> <p>An Elastic IP address is for use
          * either in the EC2-Classic platform or in a VPC. For more information, see <a
@@ -1102,6 +1321,11 @@ namespace Model
          */
         virtual void AllocateAddressAsync(const Model::AllocateAddressRequest& request, const AllocateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AllocateAddressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AllocateAddressAsync(Model::AllocateAddressRequest&& request, const AllocateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Allocates a Dedicated host to your account. At minimum you need to specify
          * the instance size type, Availability Zone, and quantity of hosts you want to
@@ -1118,6 +1342,11 @@ namespace Model
          */
         virtual Model::AllocateHostsOutcomeCallable AllocateHostsCallable(const Model::AllocateHostsRequest& request) const;
 
+        /**
+         * Same as AllocateHostsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AllocateHostsOutcomeCallable AllocateHostsCallable(Model::AllocateHostsRequest&& request) const;
+
         /**
          * <p>Allocates a Dedicated host to your account. At minimum you need to specify
          * the instance size type, Availability Zone, and quantity of hosts you want to
@@ -1127,6 +1356,11 @@ namespace Model
          */
         virtual void AllocateHostsAsync(const Model::AllocateHostsRequest& request, const AllocateHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AllocateHostsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AllocateHostsAsync(Model::AllocateHostsRequest&& request, const AllocateHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Assigns one or more secondary private IP addresses to the specified network
          * interface. You can specify one or more specific secondary IP addresses, or you
@@ -1161,6 +1395,11 @@ namespace Model
          */
         virtual Model::AssignPrivateIpAddressesOutcomeCallable AssignPrivateIpAddressesCallable(const Model::AssignPrivateIpAddressesRequest& request) const;
 
+        /**
+         * Same as AssignPrivateIpAddressesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AssignPrivateIpAddressesOutcomeCallable AssignPrivateIpAddressesCallable(Model::AssignPrivateIpAddressesRequest&& request) const;
+
         /**
          * <p>Assigns one or more secondary private IP addresses to the specified network
          * interface. You can specify one or more specific secondary IP addresses, or you
@@ -1179,6 +1418,11 @@ namespace Model
          */
         virtual void AssignPrivateIpAddressesAsync(const Model::AssignPrivateIpAddressesRequest& request, const AssignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssignPrivateIpAddressesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AssignPrivateIpAddressesAsync(Model::AssignPrivateIpAddressesRequest&& request, const AssignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates an Elastic IP address with an instance or a network interface.</p>
          * <p>An Elastic IP address is for use in either the EC2-Classic platform or in a
@@ -1217,6 +1461,11 @@ namespace Model
          */
         virtual Model::AssociateAddressOutcomeCallable AssociateAddressCallable(const Model::AssociateAddressRequest& request) const;
 
+        /**
+         * Same as AssociateAddressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AssociateAddressOutcomeCallable AssociateAddressCallable(Model::AssociateAddressRequest&& request) const;
+
         /**
          * <p>Associates an Elastic IP address with an instance or a network interface.</p>
          * <p>An Elastic IP address is for use in either the EC2-Classic platform or in a
@@ -1237,6 +1486,11 @@ namespace Model
          */
         virtual void AssociateAddressAsync(const Model::AssociateAddressRequest& request, const AssociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssociateAddressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AssociateAddressAsync(Model::AssociateAddressRequest&& request, const AssociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates a set of DHCP options (that you've previously created) with the
          * specified VPC, or associates no DHCP options with the VPC.</p> <p>After you
@@ -1267,6 +1521,11 @@ namespace Model
          */
         virtual Model::AssociateDhcpOptionsOutcomeCallable AssociateDhcpOptionsCallable(const Model::AssociateDhcpOptionsRequest& request) const;
 
+        /**
+         * Same as AssociateDhcpOptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AssociateDhcpOptionsOutcomeCallable AssociateDhcpOptionsCallable(Model::AssociateDhcpOptionsRequest&& request) const;
+
         /**
          * <p>Associates a set of DHCP options (that you've previously created) with the
          * specified VPC, or associates no DHCP options with the VPC.</p> <p>After you
@@ -1283,6 +1542,11 @@ namespace Model
          */
         virtual void AssociateDhcpOptionsAsync(const Model::AssociateDhcpOptionsRequest& request, const AssociateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssociateDhcpOptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AssociateDhcpOptionsAsync(Model::AssociateDhcpOptionsRequest&& request, const AssociateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates a subnet with a route table. The subnet and route table must be in
          * the same VPC. This association causes traffic originating from the subnet to be
@@ -1309,6 +1573,11 @@ namespace Model
          */
         virtual Model::AssociateRouteTableOutcomeCallable AssociateRouteTableCallable(const Model::AssociateRouteTableRequest& request) const;
 
+        /**
+         * Same as AssociateRouteTableCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AssociateRouteTableOutcomeCallable AssociateRouteTableCallable(Model::AssociateRouteTableRequest&& request) const;
+
         /**
          * <p>Associates a subnet with a route table. The subnet and route table must be in
          * the same VPC. This association causes traffic originating from the subnet to be
@@ -1323,6 +1592,11 @@ namespace Model
          */
         virtual void AssociateRouteTableAsync(const Model::AssociateRouteTableRequest& request, const AssociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssociateRouteTableAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AssociateRouteTableAsync(Model::AssociateRouteTableRequest&& request, const AssociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Links an EC2-Classic instance to a ClassicLink-enabled VPC through one or
          * more of the VPC's security groups. You cannot link an EC2-Classic instance to
@@ -1351,6 +1625,11 @@ namespace Model
          */
         virtual Model::AttachClassicLinkVpcOutcomeCallable AttachClassicLinkVpcCallable(const Model::AttachClassicLinkVpcRequest& request) const;
 
+        /**
+         * Same as AttachClassicLinkVpcCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachClassicLinkVpcOutcomeCallable AttachClassicLinkVpcCallable(Model::AttachClassicLinkVpcRequest&& request) const;
+
         /**
          * <p>Links an EC2-Classic instance to a ClassicLink-enabled VPC through one or
          * more of the VPC's security groups. You cannot link an EC2-Classic instance to
@@ -1366,6 +1645,11 @@ namespace Model
          */
         virtual void AttachClassicLinkVpcAsync(const Model::AttachClassicLinkVpcRequest& request, const AttachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachClassicLinkVpcAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachClassicLinkVpcAsync(Model::AttachClassicLinkVpcRequest&& request, const AttachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches an Internet gateway to a VPC, enabling connectivity between the
          * Internet and the VPC. For more information about your VPC and Internet gateway,
@@ -1384,6 +1668,11 @@ namespace Model
          */
         virtual Model::AttachInternetGatewayOutcomeCallable AttachInternetGatewayCallable(const Model::AttachInternetGatewayRequest& request) const;
 
+        /**
+         * Same as AttachInternetGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachInternetGatewayOutcomeCallable AttachInternetGatewayCallable(Model::AttachInternetGatewayRequest&& request) const;
+
         /**
          * <p>Attaches an Internet gateway to a VPC, enabling connectivity between the
          * Internet and the VPC. For more information about your VPC and Internet gateway,
@@ -1394,6 +1683,11 @@ namespace Model
          */
         virtual void AttachInternetGatewayAsync(const Model::AttachInternetGatewayRequest& request, const AttachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachInternetGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachInternetGatewayAsync(Model::AttachInternetGatewayRequest&& request, const AttachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches a network interface to an instance.</p>
          */
@@ -1406,6 +1700,11 @@ namespace Model
          */
         virtual Model::AttachNetworkInterfaceOutcomeCallable AttachNetworkInterfaceCallable(const Model::AttachNetworkInterfaceRequest& request) const;
 
+        /**
+         * Same as AttachNetworkInterfaceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachNetworkInterfaceOutcomeCallable AttachNetworkInterfaceCallable(Model::AttachNetworkInterfaceRequest&& request) const;
+
         /**
          * <p>Attaches a network interface to an instance.</p>
          *
@@ -1413,6 +1712,11 @@ namespace Model
          */
         virtual void AttachNetworkInterfaceAsync(const Model::AttachNetworkInterfaceRequest& request, const AttachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachNetworkInterfaceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachNetworkInterfaceAsync(Model::AttachNetworkInterfaceRequest&& request, const AttachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches an EBS volume to a running or stopped instance and exposes it to the
          * instance with the specified device name.</p> <p>Encrypted EBS volumes may only
@@ -1471,6 +1775,11 @@ namespace Model
          */
         virtual Model::AttachVolumeOutcomeCallable AttachVolumeCallable(const Model::AttachVolumeRequest& request) const;
 
+        /**
+         * Same as AttachVolumeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachVolumeOutcomeCallable AttachVolumeCallable(Model::AttachVolumeRequest&& request) const;
+
         /**
          * <p>Attaches an EBS volume to a running or stopped instance and exposes it to the
          * instance with the specified device name.</p> <p>Encrypted EBS volumes may only
@@ -1501,6 +1810,11 @@ namespace Model
          */
         virtual void AttachVolumeAsync(const Model::AttachVolumeRequest& request, const AttachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachVolumeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachVolumeAsync(Model::AttachVolumeRequest&& request, const AttachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches a virtual private gateway to a VPC. For more information, see <a
          * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_VPN.html">Adding
@@ -1519,6 +1833,11 @@ namespace Model
          */
         virtual Model::AttachVpnGatewayOutcomeCallable AttachVpnGatewayCallable(const Model::AttachVpnGatewayRequest& request) const;
 
+        /**
+         * Same as AttachVpnGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachVpnGatewayOutcomeCallable AttachVpnGatewayCallable(Model::AttachVpnGatewayRequest&& request) const;
+
         /**
          * <p>Attaches a virtual private gateway to a VPC. For more information, see <a
          * href="http://docs.aws.amazon.com/AmazonVPC/latest/UserGuide/VPC_VPN.html">Adding
@@ -1529,6 +1848,11 @@ namespace Model
          */
         virtual void AttachVpnGatewayAsync(const Model::AttachVpnGatewayRequest& request, const AttachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachVpnGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachVpnGatewayAsync(Model::AttachVpnGatewayRequest&& request, const AttachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>[EC2-VPC only] Adds one or more egress rules to a security group for use with
          * a VPC. Specifically, this action permits instances to send traffic to one or
@@ -1569,6 +1893,11 @@ namespace Model
          */
         virtual Model::AuthorizeSecurityGroupEgressOutcomeCallable AuthorizeSecurityGroupEgressCallable(const Model::AuthorizeSecurityGroupEgressRequest& request) const;
 
+        /**
+         * Same as AuthorizeSecurityGroupEgressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AuthorizeSecurityGroupEgressOutcomeCallable AuthorizeSecurityGroupEgressCallable(Model::AuthorizeSecurityGroupEgressRequest&& request) const;
+
         /**
          * <p>[EC2-VPC only] Adds one or more egress rules to a security group for use with
          * a VPC. Specifically, this action permits instances to send traffic to one or
@@ -1590,6 +1919,11 @@ namespace Model
          */
         virtual void AuthorizeSecurityGroupEgressAsync(const Model::AuthorizeSecurityGroupEgressRequest& request, const AuthorizeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AuthorizeSecurityGroupEgressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AuthorizeSecurityGroupEgressAsync(Model::AuthorizeSecurityGroupEgressRequest&& request, const AuthorizeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds one or more ingress rules to a security group.</p> <important>
          * <p>EC2-Classic: You can have up to 100 rules per group.</p> <p>EC2-VPC: You can
@@ -1626,6 +1960,11 @@ namespace Model
          */
         virtual Model::AuthorizeSecurityGroupIngressOutcomeCallable AuthorizeSecurityGroupIngressCallable(const Model::AuthorizeSecurityGroupIngressRequest& request) const;
 
+        /**
+         * Same as AuthorizeSecurityGroupIngressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AuthorizeSecurityGroupIngressOutcomeCallable AuthorizeSecurityGroupIngressCallable(Model::AuthorizeSecurityGroupIngressRequest&& request) const;
+
         /**
          * <p>Adds one or more ingress rules to a security group.</p> <important>
          * <p>EC2-Classic: You can have up to 100 rules per group.</p> <p>EC2-VPC: You can
@@ -1645,6 +1984,11 @@ namespace Model
          */
         virtual void AuthorizeSecurityGroupIngressAsync(const Model::AuthorizeSecurityGroupIngressRequest& request, const AuthorizeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AuthorizeSecurityGroupIngressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AuthorizeSecurityGroupIngressAsync(Model::AuthorizeSecurityGroupIngressRequest&& request, const AuthorizeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Bundles an Amazon instance store-backed Windows instance.</p> <p>During
          * bundling, only the root device volume (C:\) is bundled. Data on other instance
@@ -1669,6 +2013,11 @@ namespace Model
          */
         virtual Model::BundleInstanceOutcomeCallable BundleInstanceCallable(const Model::BundleInstanceRequest& request) const;
 
+        /**
+         * Same as BundleInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BundleInstanceOutcomeCallable BundleInstanceCallable(Model::BundleInstanceRequest&& request) const;
+
         /**
          * <p>Bundles an Amazon instance store-backed Windows instance.</p> <p>During
          * bundling, only the root device volume (C:\) is bundled. Data on other instance
@@ -1682,6 +2031,11 @@ namespace Model
          */
         virtual void BundleInstanceAsync(const Model::BundleInstanceRequest& request, const BundleInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BundleInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BundleInstanceAsync(Model::BundleInstanceRequest&& request, const BundleInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels a bundling operation for an instance store-backed Windows
          * instance.</p>
@@ -1696,6 +2050,11 @@ namespace Model
          */
         virtual Model::CancelBundleTaskOutcomeCallable CancelBundleTaskCallable(const Model::CancelBundleTaskRequest& request) const;
 
+        /**
+         * Same as CancelBundleTaskCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelBundleTaskOutcomeCallable CancelBundleTaskCallable(Model::CancelBundleTaskRequest&& request) const;
+
         /**
          * <p>Cancels a bundling operation for an instance store-backed Windows
          * instance.</p>
@@ -1704,6 +2063,11 @@ namespace Model
          */
         virtual void CancelBundleTaskAsync(const Model::CancelBundleTaskRequest& request, const CancelBundleTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelBundleTaskAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelBundleTaskAsync(Model::CancelBundleTaskRequest&& request, const CancelBundleTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels an active conversion task. The task can be the import of an instance
          * or volume. The action removes all artifacts of the conversion, including a
@@ -1730,6 +2094,11 @@ namespace Model
          */
         virtual Model::CancelConversionTaskOutcomeCallable CancelConversionTaskCallable(const Model::CancelConversionTaskRequest& request) const;
 
+        /**
+         * Same as CancelConversionTaskCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelConversionTaskOutcomeCallable CancelConversionTaskCallable(Model::CancelConversionTaskRequest&& request) const;
+
         /**
          * <p>Cancels an active conversion task. The task can be the import of an instance
          * or volume. The action removes all artifacts of the conversion, including a
@@ -1744,6 +2113,11 @@ namespace Model
          */
         virtual void CancelConversionTaskAsync(const Model::CancelConversionTaskRequest& request, const CancelConversionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelConversionTaskAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelConversionTaskAsync(Model::CancelConversionTaskRequest&& request, const CancelConversionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels an active export task. The request removes all artifacts of the
          * export, including any partially-created Amazon S3 objects. If the export task is
@@ -1762,6 +2136,11 @@ namespace Model
          */
         virtual Model::CancelExportTaskOutcomeCallable CancelExportTaskCallable(const Model::CancelExportTaskRequest& request) const;
 
+        /**
+         * Same as CancelExportTaskCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelExportTaskOutcomeCallable CancelExportTaskCallable(Model::CancelExportTaskRequest&& request) const;
+
         /**
          * <p>Cancels an active export task. The request removes all artifacts of the
          * export, including any partially-created Amazon S3 objects. If the export task is
@@ -1772,6 +2151,11 @@ namespace Model
          */
         virtual void CancelExportTaskAsync(const Model::CancelExportTaskRequest& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelExportTaskAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelExportTaskAsync(Model::CancelExportTaskRequest&& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels an in-process import virtual machine or import snapshot task.</p>
          */
@@ -1784,6 +2168,11 @@ namespace Model
          */
         virtual Model::CancelImportTaskOutcomeCallable CancelImportTaskCallable(const Model::CancelImportTaskRequest& request) const;
 
+        /**
+         * Same as CancelImportTaskCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelImportTaskOutcomeCallable CancelImportTaskCallable(Model::CancelImportTaskRequest&& request) const;
+
         /**
          * <p>Cancels an in-process import virtual machine or import snapshot task.</p>
          *
@@ -1791,6 +2180,11 @@ namespace Model
          */
         virtual void CancelImportTaskAsync(const Model::CancelImportTaskRequest& request, const CancelImportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelImportTaskAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelImportTaskAsync(Model::CancelImportTaskRequest&& request, const CancelImportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels the specified Reserved Instance listing in the Reserved Instance
          * Marketplace.</p> <p>For more information, see <a
@@ -1811,6 +2205,11 @@ namespace Model
          */
         virtual Model::CancelReservedInstancesListingOutcomeCallable CancelReservedInstancesListingCallable(const Model::CancelReservedInstancesListingRequest& request) const;
 
+        /**
+         * Same as CancelReservedInstancesListingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelReservedInstancesListingOutcomeCallable CancelReservedInstancesListingCallable(Model::CancelReservedInstancesListingRequest&& request) const;
+
         /**
          * <p>Cancels the specified Reserved Instance listing in the Reserved Instance
          * Marketplace.</p> <p>For more information, see <a
@@ -1822,6 +2221,11 @@ namespace Model
          */
         virtual void CancelReservedInstancesListingAsync(const Model::CancelReservedInstancesListingRequest& request, const CancelReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelReservedInstancesListingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelReservedInstancesListingAsync(Model::CancelReservedInstancesListingRequest&& request, const CancelReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels the specified Spot fleet requests.</p> <p>After you cancel a Spot
          * fleet request, the Spot fleet launches no new Spot instances. You must specify
@@ -1846,6 +2250,11 @@ namespace Model
          */
         virtual Model::CancelSpotFleetRequestsOutcomeCallable CancelSpotFleetRequestsCallable(const Model::CancelSpotFleetRequestsRequest& request) const;
 
+        /**
+         * Same as CancelSpotFleetRequestsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelSpotFleetRequestsOutcomeCallable CancelSpotFleetRequestsCallable(Model::CancelSpotFleetRequestsRequest&& request) const;
+
         /**
          * <p>Cancels the specified Spot fleet requests.</p> <p>After you cancel a Spot
          * fleet request, the Spot fleet launches no new Spot instances. You must specify
@@ -1859,6 +2268,11 @@ namespace Model
          */
         virtual void CancelSpotFleetRequestsAsync(const Model::CancelSpotFleetRequestsRequest& request, const CancelSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelSpotFleetRequestsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelSpotFleetRequestsAsync(Model::CancelSpotFleetRequestsRequest&& request, const CancelSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels one or more Spot instance requests. Spot instances are instances that
          * Amazon EC2 starts on your behalf when the bid price that you specify exceeds the
@@ -1887,6 +2301,11 @@ namespace Model
          */
         virtual Model::CancelSpotInstanceRequestsOutcomeCallable CancelSpotInstanceRequestsCallable(const Model::CancelSpotInstanceRequestsRequest& request) const;
 
+        /**
+         * Same as CancelSpotInstanceRequestsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelSpotInstanceRequestsOutcomeCallable CancelSpotInstanceRequestsCallable(Model::CancelSpotInstanceRequestsRequest&& request) const;
+
         /**
          * <p>Cancels one or more Spot instance requests. Spot instances are instances that
          * Amazon EC2 starts on your behalf when the bid price that you specify exceeds the
@@ -1902,6 +2321,11 @@ namespace Model
          */
         virtual void CancelSpotInstanceRequestsAsync(const Model::CancelSpotInstanceRequestsRequest& request, const CancelSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelSpotInstanceRequestsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelSpotInstanceRequestsAsync(Model::CancelSpotInstanceRequestsRequest&& request, const CancelSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Determines whether a product code is associated with an instance. This action
          * can only be used by the owner of the product code. It is useful when a product
@@ -1920,6 +2344,11 @@ namespace Model
          */
         virtual Model::ConfirmProductInstanceOutcomeCallable ConfirmProductInstanceCallable(const Model::ConfirmProductInstanceRequest& request) const;
 
+        /**
+         * Same as ConfirmProductInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ConfirmProductInstanceOutcomeCallable ConfirmProductInstanceCallable(Model::ConfirmProductInstanceRequest&& request) const;
+
         /**
          * <p>Determines whether a product code is associated with an instance. This action
          * can only be used by the owner of the product code. It is useful when a product
@@ -1930,6 +2359,11 @@ namespace Model
          */
         virtual void ConfirmProductInstanceAsync(const Model::ConfirmProductInstanceRequest& request, const ConfirmProductInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfirmProductInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ConfirmProductInstanceAsync(Model::ConfirmProductInstanceRequest&& request, const ConfirmProductInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Initiates the copy of an AMI from the specified source region to the current
          * region. You specify the destination region by using its endpoint when making the
@@ -1950,6 +2384,11 @@ namespace Model
          */
         virtual Model::CopyImageOutcomeCallable CopyImageCallable(const Model::CopyImageRequest& request) const;
 
+        /**
+         * Same as CopyImageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CopyImageOutcomeCallable CopyImageCallable(Model::CopyImageRequest&& request) const;
+
         /**
          * <p>Initiates the copy of an AMI from the specified source region to the current
          * region. You specify the destination region by using its endpoint when making the
@@ -1961,6 +2400,11 @@ namespace Model
          */
         virtual void CopyImageAsync(const Model::CopyImageRequest& request, const CopyImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyImageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CopyImageAsync(Model::CopyImageRequest&& request, const CopyImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Copies a point-in-time snapshot of an EBS volume and stores it in Amazon S3.
          * You can copy the snapshot within the same region or from one region to another.
@@ -1997,6 +2441,11 @@ namespace Model
          */
         virtual Model::CopySnapshotOutcomeCallable CopySnapshotCallable(const Model::CopySnapshotRequest& request) const;
 
+        /**
+         * Same as CopySnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CopySnapshotOutcomeCallable CopySnapshotCallable(Model::CopySnapshotRequest&& request) const;
+
         /**
          * <p>Copies a point-in-time snapshot of an EBS volume and stores it in Amazon S3.
          * You can copy the snapshot within the same region or from one region to another.
@@ -2016,6 +2465,11 @@ namespace Model
          */
         virtual void CopySnapshotAsync(const Model::CopySnapshotRequest& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopySnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CopySnapshotAsync(Model::CopySnapshotRequest&& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides information to AWS about your VPN customer gateway device. The
          * customer gateway is the appliance at your end of the VPN connection. (The device
@@ -2068,6 +2522,11 @@ namespace Model
          */
         virtual Model::CreateCustomerGatewayOutcomeCallable CreateCustomerGatewayCallable(const Model::CreateCustomerGatewayRequest& request) const;
 
+        /**
+         * Same as CreateCustomerGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateCustomerGatewayOutcomeCallable CreateCustomerGatewayCallable(Model::CreateCustomerGatewayRequest&& request) const;
+
         /**
          * <p>Provides information to AWS about your VPN customer gateway device. The
          * customer gateway is the appliance at your end of the VPN connection. (The device
@@ -2095,6 +2554,11 @@ namespace Model
          */
         virtual void CreateCustomerGatewayAsync(const Model::CreateCustomerGatewayRequest& request, const CreateCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCustomerGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateCustomerGatewayAsync(Model::CreateCustomerGatewayRequest&& request, const CreateCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a set of DHCP options for your VPC. After creating the set, you must
          * associate it with the VPC, causing all existing and new instances that you
@@ -2173,6 +2637,11 @@ namespace Model
          */
         virtual Model::CreateDhcpOptionsOutcomeCallable CreateDhcpOptionsCallable(const Model::CreateDhcpOptionsRequest& request) const;
 
+        /**
+         * Same as CreateDhcpOptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDhcpOptionsOutcomeCallable CreateDhcpOptionsCallable(Model::CreateDhcpOptionsRequest&& request) const;
+
         /**
          * <p>Creates a set of DHCP options for your VPC. After creating the set, you must
          * associate it with the VPC, causing all existing and new instances that you
@@ -2213,6 +2682,11 @@ namespace Model
          */
         virtual void CreateDhcpOptionsAsync(const Model::CreateDhcpOptionsRequest& request, const CreateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDhcpOptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDhcpOptionsAsync(Model::CreateDhcpOptionsRequest&& request, const CreateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates one or more flow logs to capture IP traffic for a specific network
          * interface, subnet, or VPC. Flow logs are delivered to a specified log group in
@@ -2239,6 +2713,11 @@ namespace Model
          */
         virtual Model::CreateFlowLogsOutcomeCallable CreateFlowLogsCallable(const Model::CreateFlowLogsRequest& request) const;
 
+        /**
+         * Same as CreateFlowLogsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateFlowLogsOutcomeCallable CreateFlowLogsCallable(Model::CreateFlowLogsRequest&& request) const;
+
         /**
          * <p>Creates one or more flow logs to capture IP traffic for a specific network
          * interface, subnet, or VPC. Flow logs are delivered to a specified log group in
@@ -2253,6 +2732,11 @@ namespace Model
          */
         virtual void CreateFlowLogsAsync(const Model::CreateFlowLogsRequest& request, const CreateFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateFlowLogsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateFlowLogsAsync(Model::CreateFlowLogsRequest&& request, const CreateFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an Amazon EBS-backed AMI from an Amazon EBS-backed instance that is
          * either running or stopped.</p> <p>If you customized your instance with instance
@@ -2281,6 +2765,11 @@ namespace Model
          */
         virtual Model::CreateImageOutcomeCallable CreateImageCallable(const Model::CreateImageRequest& request) const;
 
+        /**
+         * Same as CreateImageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateImageOutcomeCallable CreateImageCallable(Model::CreateImageRequest&& request) const;
+
         /**
          * <p>Creates an Amazon EBS-backed AMI from an Amazon EBS-backed instance that is
          * either running or stopped.</p> <p>If you customized your instance with instance
@@ -2296,6 +2785,11 @@ namespace Model
          */
         virtual void CreateImageAsync(const Model::CreateImageRequest& request, const CreateImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateImageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateImageAsync(Model::CreateImageRequest&& request, const CreateImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Exports a running or stopped instance to an S3 bucket.</p> <p>For information
          * about the supported operating systems, image formats, and known limitations for
@@ -2316,6 +2810,11 @@ namespace Model
          */
         virtual Model::CreateInstanceExportTaskOutcomeCallable CreateInstanceExportTaskCallable(const Model::CreateInstanceExportTaskRequest& request) const;
 
+        /**
+         * Same as CreateInstanceExportTaskCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateInstanceExportTaskOutcomeCallable CreateInstanceExportTaskCallable(Model::CreateInstanceExportTaskRequest&& request) const;
+
         /**
          * <p>Exports a running or stopped instance to an S3 bucket.</p> <p>For information
          * about the supported operating systems, image formats, and known limitations for
@@ -2327,6 +2826,11 @@ namespace Model
          */
         virtual void CreateInstanceExportTaskAsync(const Model::CreateInstanceExportTaskRequest& request, const CreateInstanceExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateInstanceExportTaskAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateInstanceExportTaskAsync(Model::CreateInstanceExportTaskRequest&& request, const CreateInstanceExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an Internet gateway for use with a VPC. After creating the Internet
          * gateway, you attach it to a VPC using <a>AttachInternetGateway</a>.</p> <p>For
@@ -2347,6 +2851,11 @@ namespace Model
          */
         virtual Model::CreateInternetGatewayOutcomeCallable CreateInternetGatewayCallable(const Model::CreateInternetGatewayRequest& request) const;
 
+        /**
+         * Same as CreateInternetGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateInternetGatewayOutcomeCallable CreateInternetGatewayCallable(Model::CreateInternetGatewayRequest&& request) const;
+
         /**
          * <p>Creates an Internet gateway for use with a VPC. After creating the Internet
          * gateway, you attach it to a VPC using <a>AttachInternetGateway</a>.</p> <p>For
@@ -2358,6 +2867,11 @@ namespace Model
          */
         virtual void CreateInternetGatewayAsync(const Model::CreateInternetGatewayRequest& request, const CreateInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateInternetGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateInternetGatewayAsync(Model::CreateInternetGatewayRequest&& request, const CreateInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a 2048-bit RSA key pair with the specified name. Amazon EC2 stores
          * the public key and displays the private key for you to save to a file. The
@@ -2388,6 +2902,11 @@ namespace Model
          */
         virtual Model::CreateKeyPairOutcomeCallable CreateKeyPairCallable(const Model::CreateKeyPairRequest& request) const;
 
+        /**
+         * Same as CreateKeyPairCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateKeyPairOutcomeCallable CreateKeyPairCallable(Model::CreateKeyPairRequest&& request) const;
+
         /**
          * <p>Creates a 2048-bit RSA key pair with the specified name. Amazon EC2 stores
          * the public key and displays the private key for you to save to a file. The
@@ -2404,6 +2923,11 @@ namespace Model
          */
         virtual void CreateKeyPairAsync(const Model::CreateKeyPairRequest& request, const CreateKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateKeyPairAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateKeyPairAsync(Model::CreateKeyPairRequest&& request, const CreateKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a NAT gateway in the specified subnet. A NAT gateway can be used to
          * enable instances in a private subnet to connect to the Internet. This action
@@ -2426,6 +2950,11 @@ namespace Model
          */
         virtual Model::CreateNatGatewayOutcomeCallable CreateNatGatewayCallable(const Model::CreateNatGatewayRequest& request) const;
 
+        /**
+         * Same as CreateNatGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateNatGatewayOutcomeCallable CreateNatGatewayCallable(Model::CreateNatGatewayRequest&& request) const;
+
         /**
          * <p>Creates a NAT gateway in the specified subnet. A NAT gateway can be used to
          * enable instances in a private subnet to connect to the Internet. This action
@@ -2438,6 +2967,11 @@ namespace Model
          */
         virtual void CreateNatGatewayAsync(const Model::CreateNatGatewayRequest& request, const CreateNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateNatGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateNatGatewayAsync(Model::CreateNatGatewayRequest&& request, const CreateNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a network ACL in a VPC. Network ACLs provide an optional layer of
          * security (in addition to security groups) for the instances in your VPC.</p>
@@ -2458,6 +2992,11 @@ namespace Model
          */
         virtual Model::CreateNetworkAclOutcomeCallable CreateNetworkAclCallable(const Model::CreateNetworkAclRequest& request) const;
 
+        /**
+         * Same as CreateNetworkAclCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateNetworkAclOutcomeCallable CreateNetworkAclCallable(Model::CreateNetworkAclRequest&& request) const;
+
         /**
          * <p>Creates a network ACL in a VPC. Network ACLs provide an optional layer of
          * security (in addition to security groups) for the instances in your VPC.</p>
@@ -2469,6 +3008,11 @@ namespace Model
          */
         virtual void CreateNetworkAclAsync(const Model::CreateNetworkAclRequest& request, const CreateNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateNetworkAclAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateNetworkAclAsync(Model::CreateNetworkAclRequest&& request, const CreateNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an entry (a rule) in a network ACL with the specified rule number.
          * Each network ACL has a set of numbered ingress rules and a separate set of
@@ -2507,6 +3051,11 @@ namespace Model
          */
         virtual Model::CreateNetworkAclEntryOutcomeCallable CreateNetworkAclEntryCallable(const Model::CreateNetworkAclEntryRequest& request) const;
 
+        /**
+         * Same as CreateNetworkAclEntryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateNetworkAclEntryOutcomeCallable CreateNetworkAclEntryCallable(Model::CreateNetworkAclEntryRequest&& request) const;
+
         /**
          * <p>Creates an entry (a rule) in a network ACL with the specified rule number.
          * Each network ACL has a set of numbered ingress rules and a separate set of
@@ -2527,6 +3076,11 @@ namespace Model
          */
         virtual void CreateNetworkAclEntryAsync(const Model::CreateNetworkAclEntryRequest& request, const CreateNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateNetworkAclEntryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateNetworkAclEntryAsync(Model::CreateNetworkAclEntryRequest&& request, const CreateNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a network interface in the specified subnet.</p> <p>For more
          * information about network interfaces, see <a
@@ -2547,6 +3101,11 @@ namespace Model
          */
         virtual Model::CreateNetworkInterfaceOutcomeCallable CreateNetworkInterfaceCallable(const Model::CreateNetworkInterfaceRequest& request) const;
 
+        /**
+         * Same as CreateNetworkInterfaceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateNetworkInterfaceOutcomeCallable CreateNetworkInterfaceCallable(Model::CreateNetworkInterfaceRequest&& request) const;
+
         /**
          * <p>Creates a network interface in the specified subnet.</p> <p>For more
          * information about network interfaces, see <a
@@ -2558,6 +3117,11 @@ namespace Model
          */
         virtual void CreateNetworkInterfaceAsync(const Model::CreateNetworkInterfaceRequest& request, const CreateNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateNetworkInterfaceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateNetworkInterfaceAsync(Model::CreateNetworkInterfaceRequest&& request, const CreateNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a placement group that you launch cluster instances into. You must
          * give the group a name that's unique within the scope of your account.</p> <p>For
@@ -2578,6 +3142,11 @@ namespace Model
          */
         virtual Model::CreatePlacementGroupOutcomeCallable CreatePlacementGroupCallable(const Model::CreatePlacementGroupRequest& request) const;
 
+        /**
+         * Same as CreatePlacementGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePlacementGroupOutcomeCallable CreatePlacementGroupCallable(Model::CreatePlacementGroupRequest&& request) const;
+
         /**
          * <p>Creates a placement group that you launch cluster instances into. You must
          * give the group a name that's unique within the scope of your account.</p> <p>For
@@ -2589,6 +3158,11 @@ namespace Model
          */
         virtual void CreatePlacementGroupAsync(const Model::CreatePlacementGroupRequest& request, const CreatePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePlacementGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePlacementGroupAsync(Model::CreatePlacementGroupRequest&& request, const CreatePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a listing for Amazon EC2 Reserved Instances to be sold in the
          * Reserved Instance Marketplace. You can submit one Reserved Instance listing at a
@@ -2635,6 +3209,11 @@ namespace Model
          */
         virtual Model::CreateReservedInstancesListingOutcomeCallable CreateReservedInstancesListingCallable(const Model::CreateReservedInstancesListingRequest& request) const;
 
+        /**
+         * Same as CreateReservedInstancesListingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateReservedInstancesListingOutcomeCallable CreateReservedInstancesListingCallable(Model::CreateReservedInstancesListingRequest&& request) const;
+
         /**
          * <p>Creates a listing for Amazon EC2 Reserved Instances to be sold in the
          * Reserved Instance Marketplace. You can submit one Reserved Instance listing at a
@@ -2659,6 +3238,11 @@ namespace Model
          */
         virtual void CreateReservedInstancesListingAsync(const Model::CreateReservedInstancesListingRequest& request, const CreateReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReservedInstancesListingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateReservedInstancesListingAsync(Model::CreateReservedInstancesListingRequest&& request, const CreateReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a route in a route table within a VPC.</p> <p>You must specify one of
          * the following targets: Internet gateway or virtual private gateway, NAT
@@ -2697,6 +3281,11 @@ namespace Model
          */
         virtual Model::CreateRouteOutcomeCallable CreateRouteCallable(const Model::CreateRouteRequest& request) const;
 
+        /**
+         * Same as CreateRouteCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateRouteOutcomeCallable CreateRouteCallable(Model::CreateRouteRequest&& request) const;
+
         /**
          * <p>Creates a route in a route table within a VPC.</p> <p>You must specify one of
          * the following targets: Internet gateway or virtual private gateway, NAT
@@ -2717,6 +3306,11 @@ namespace Model
          */
         virtual void CreateRouteAsync(const Model::CreateRouteRequest& request, const CreateRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRouteAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateRouteAsync(Model::CreateRouteRequest&& request, const CreateRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a route table for the specified VPC. After you create a route table,
          * you can add routes and associate the table with a subnet.</p> <p>For more
@@ -2737,6 +3331,11 @@ namespace Model
          */
         virtual Model::CreateRouteTableOutcomeCallable CreateRouteTableCallable(const Model::CreateRouteTableRequest& request) const;
 
+        /**
+         * Same as CreateRouteTableCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateRouteTableOutcomeCallable CreateRouteTableCallable(Model::CreateRouteTableRequest&& request) const;
+
         /**
          * <p>Creates a route table for the specified VPC. After you create a route table,
          * you can add routes and associate the table with a subnet.</p> <p>For more
@@ -2748,6 +3347,11 @@ namespace Model
          */
         virtual void CreateRouteTableAsync(const Model::CreateRouteTableRequest& request, const CreateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRouteTableAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateRouteTableAsync(Model::CreateRouteTableRequest&& request, const CreateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a security group.</p> <p>A security group is for use with instances
          * either in the EC2-Classic platform or in a specific VPC. For more information,
@@ -2802,6 +3406,11 @@ namespace Model
          */
         virtual Model::CreateSecurityGroupOutcomeCallable CreateSecurityGroupCallable(const Model::CreateSecurityGroupRequest& request) const;
 
+        /**
+         * Same as CreateSecurityGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateSecurityGroupOutcomeCallable CreateSecurityGroupCallable(Model::CreateSecurityGroupRequest&& request) const;
+
         /**
          * <p>Creates a security group.</p> <p>A security group is for use with instances
          * either in the EC2-Classic platform or in a specific VPC. For more information,
@@ -2830,6 +3439,11 @@ namespace Model
          */
         virtual void CreateSecurityGroupAsync(const Model::CreateSecurityGroupRequest& request, const CreateSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSecurityGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateSecurityGroupAsync(Model::CreateSecurityGroupRequest&& request, const CreateSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a snapshot of an EBS volume and stores it in Amazon S3. You can use
          * snapshots for backups, to make copies of EBS volumes, and to save data before
@@ -2886,6 +3500,11 @@ namespace Model
          */
         virtual Model::CreateSnapshotOutcomeCallable CreateSnapshotCallable(const Model::CreateSnapshotRequest& request) const;
 
+        /**
+         * Same as CreateSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateSnapshotOutcomeCallable CreateSnapshotCallable(Model::CreateSnapshotRequest&& request) const;
+
         /**
          * <p>Creates a snapshot of an EBS volume and stores it in Amazon S3. You can use
          * snapshots for backups, to make copies of EBS volumes, and to save data before
@@ -2915,6 +3534,11 @@ namespace Model
          */
         virtual void CreateSnapshotAsync(const Model::CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateSnapshotAsync(Model::CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a data feed for Spot instances, enabling you to view Spot instance
          * usage logs. You can create one data feed per AWS account. For more information,
@@ -2937,6 +3561,11 @@ namespace Model
          */
         virtual Model::CreateSpotDatafeedSubscriptionOutcomeCallable CreateSpotDatafeedSubscriptionCallable(const Model::CreateSpotDatafeedSubscriptionRequest& request) const;
 
+        /**
+         * Same as CreateSpotDatafeedSubscriptionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateSpotDatafeedSubscriptionOutcomeCallable CreateSpotDatafeedSubscriptionCallable(Model::CreateSpotDatafeedSubscriptionRequest&& request) const;
+
         /**
          * <p>Creates a data feed for Spot instances, enabling you to view Spot instance
          * usage logs. You can create one data feed per AWS account. For more information,
@@ -2950,7 +3579,12 @@ namespace Model
         virtual void CreateSpotDatafeedSubscriptionAsync(const Model::CreateSpotDatafeedSubscriptionRequest& request, const CreateSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
         /**
-         * <p>Creates a subnet in an existing VPC.</p> <p>When you create each subnet, you
+         * Same as CreateSpotDatafeedSubscriptionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateSpotDatafeedSubscriptionAsync(Model::CreateSpotDatafeedSubscriptionRequest&& request, const CreateSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+        /**
+         * <p>Creates a subnet in an existing VPC.</p> <p>When you create each subnet, you
          * provide the VPC ID and the CIDR block you want for the subnet. After you create
          * a subnet, you can't change its CIDR block. The subnet's CIDR block can be the
          * same as the VPC's CIDR block (assuming you want only a single subnet in the
@@ -2997,6 +3631,11 @@ namespace Model
          */
         virtual Model::CreateSubnetOutcomeCallable CreateSubnetCallable(const Model::CreateSubnetRequest& request) const;
 
+        /**
+         * Same as CreateSubnetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateSubnetOutcomeCallable CreateSubnetCallable(Model::CreateSubnetRequest&& request) const;
+
         /**
          * <p>Creates a subnet in an existing VPC.</p> <p>When you create each subnet, you
          * provide the VPC ID and the CIDR block you want for the subnet. After you create
@@ -3022,6 +3661,11 @@ namespace Model
          */
         virtual void CreateSubnetAsync(const Model::CreateSubnetRequest& request, const CreateSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSubnetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateSubnetAsync(Model::CreateSubnetRequest&& request, const CreateSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds or overwrites one or more tags for the specified Amazon EC2 resource or
          * resources. Each resource can have a maximum of 10 tags. Each tag consists of a
@@ -3054,6 +3698,11 @@ namespace Model
          */
         virtual Model::CreateTagsOutcomeCallable CreateTagsCallable(const Model::CreateTagsRequest& request) const;
 
+        /**
+         * Same as CreateTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateTagsOutcomeCallable CreateTagsCallable(Model::CreateTagsRequest&& request) const;
+
         /**
          * <p>Adds or overwrites one or more tags for the specified Amazon EC2 resource or
          * resources. Each resource can have a maximum of 10 tags. Each tag consists of a
@@ -3071,6 +3720,11 @@ namespace Model
          */
         virtual void CreateTagsAsync(const Model::CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateTagsAsync(Model::CreateTagsRequest&& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an EBS volume that can be attached to an instance in the same
          * Availability Zone. The volume is created in the regional endpoint that you send
@@ -3115,6 +3769,11 @@ namespace Model
          */
         virtual Model::CreateVolumeOutcomeCallable CreateVolumeCallable(const Model::CreateVolumeRequest& request) const;
 
+        /**
+         * Same as CreateVolumeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateVolumeOutcomeCallable CreateVolumeCallable(Model::CreateVolumeRequest&& request) const;
+
         /**
          * <p>Creates an EBS volume that can be attached to an instance in the same
          * Availability Zone. The volume is created in the regional endpoint that you send
@@ -3138,6 +3797,11 @@ namespace Model
          */
         virtual void CreateVolumeAsync(const Model::CreateVolumeRequest& request, const CreateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVolumeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateVolumeAsync(Model::CreateVolumeRequest&& request, const CreateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a VPC with the specified CIDR block.</p> <p>The smallest VPC you can
          * create uses a /28 netmask (16 IP addresses), and the largest uses a /16 netmask
@@ -3168,6 +3832,11 @@ namespace Model
          */
         virtual Model::CreateVpcOutcomeCallable CreateVpcCallable(const Model::CreateVpcRequest& request) const;
 
+        /**
+         * Same as CreateVpcCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateVpcOutcomeCallable CreateVpcCallable(Model::CreateVpcRequest&& request) const;
+
         /**
          * <p>Creates a VPC with the specified CIDR block.</p> <p>The smallest VPC you can
          * create uses a /28 netmask (16 IP addresses), and the largest uses a /16 netmask
@@ -3184,6 +3853,11 @@ namespace Model
          */
         virtual void CreateVpcAsync(const Model::CreateVpcRequest& request, const CreateVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVpcAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateVpcAsync(Model::CreateVpcRequest&& request, const CreateVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a VPC endpoint for a specified AWS service. An endpoint enables you
          * to create a private connection between your VPC and another AWS service in your
@@ -3206,6 +3880,11 @@ namespace Model
          */
         virtual Model::CreateVpcEndpointOutcomeCallable CreateVpcEndpointCallable(const Model::CreateVpcEndpointRequest& request) const;
 
+        /**
+         * Same as CreateVpcEndpointCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateVpcEndpointOutcomeCallable CreateVpcEndpointCallable(Model::CreateVpcEndpointRequest&& request) const;
+
         /**
          * <p>Creates a VPC endpoint for a specified AWS service. An endpoint enables you
          * to create a private connection between your VPC and another AWS service in your
@@ -3218,6 +3897,11 @@ namespace Model
          */
         virtual void CreateVpcEndpointAsync(const Model::CreateVpcEndpointRequest& request, const CreateVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVpcEndpointAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateVpcEndpointAsync(Model::CreateVpcEndpointRequest&& request, const CreateVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a VPC peering connection between two VPCs: a requester VPC that you
          * own and a peer VPC with which to create the connection. The peer VPC can belong
@@ -3246,6 +3930,11 @@ namespace Model
          */
         virtual Model::CreateVpcPeeringConnectionOutcomeCallable CreateVpcPeeringConnectionCallable(const Model::CreateVpcPeeringConnectionRequest& request) const;
 
+        /**
+         * Same as CreateVpcPeeringConnectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateVpcPeeringConnectionOutcomeCallable CreateVpcPeeringConnectionCallable(Model::CreateVpcPeeringConnectionRequest&& request) const;
+
         /**
          * <p>Requests a VPC peering connection between two VPCs: a requester VPC that you
          * own and a peer VPC with which to create the connection. The peer VPC can belong
@@ -3261,6 +3950,11 @@ namespace Model
          */
         virtual void CreateVpcPeeringConnectionAsync(const Model::CreateVpcPeeringConnectionRequest& request, const CreateVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVpcPeeringConnectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateVpcPeeringConnectionAsync(Model::CreateVpcPeeringConnectionRequest&& request, const CreateVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a VPN connection between an existing virtual private gateway and a
          * VPN customer gateway. The only supported connection type is
@@ -3297,6 +3991,11 @@ namespace Model
          */
         virtual Model::CreateVpnConnectionOutcomeCallable CreateVpnConnectionCallable(const Model::CreateVpnConnectionRequest& request) const;
 
+        /**
+         * Same as CreateVpnConnectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateVpnConnectionOutcomeCallable CreateVpnConnectionCallable(Model::CreateVpnConnectionRequest&& request) const;
+
         /**
          * <p>Creates a VPN connection between an existing virtual private gateway and a
          * VPN customer gateway. The only supported connection type is
@@ -3316,6 +4015,11 @@ namespace Model
          */
         virtual void CreateVpnConnectionAsync(const Model::CreateVpnConnectionRequest& request, const CreateVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVpnConnectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateVpnConnectionAsync(Model::CreateVpnConnectionRequest&& request, const CreateVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a static route associated with a VPN connection between an existing
          * virtual private gateway and a VPN customer gateway. The static route allows
@@ -3340,6 +4044,11 @@ namespace Model
          */
         virtual Model::CreateVpnConnectionRouteOutcomeCallable CreateVpnConnectionRouteCallable(const Model::CreateVpnConnectionRouteRequest& request) const;
 
+        /**
+         * Same as CreateVpnConnectionRouteCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateVpnConnectionRouteOutcomeCallable CreateVpnConnectionRouteCallable(Model::CreateVpnConnectionRouteRequest&& request) const;
+
         /**
          * <p>Creates a static route associated with a VPN connection between an existing
          * virtual private gateway and a VPN customer gateway. The static route allows
@@ -3353,6 +4062,11 @@ namespace Model
          */
         virtual void CreateVpnConnectionRouteAsync(const Model::CreateVpnConnectionRouteRequest& request, const CreateVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVpnConnectionRouteAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateVpnConnectionRouteAsync(Model::CreateVpnConnectionRouteRequest&& request, const CreateVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a virtual private gateway. A virtual private gateway is the endpoint
          * on the VPC side of your VPN connection. You can create a virtual private gateway
@@ -3377,6 +4091,11 @@ namespace Model
          */
         virtual Model::CreateVpnGatewayOutcomeCallable CreateVpnGatewayCallable(const Model::CreateVpnGatewayRequest& request) const;
 
+        /**
+         * Same as CreateVpnGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateVpnGatewayOutcomeCallable CreateVpnGatewayCallable(Model::CreateVpnGatewayRequest&& request) const;
+
         /**
          * <p>Creates a virtual private gateway. A virtual private gateway is the endpoint
          * on the VPC side of your VPN connection. You can create a virtual private gateway
@@ -3390,6 +4109,11 @@ namespace Model
          */
         virtual void CreateVpnGatewayAsync(const Model::CreateVpnGatewayRequest& request, const CreateVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVpnGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateVpnGatewayAsync(Model::CreateVpnGatewayRequest&& request, const CreateVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified customer gateway. You must delete the VPN connection
          * before you can delete the customer gateway.</p>
@@ -3404,6 +4128,11 @@ namespace Model
          */
         virtual Model::DeleteCustomerGatewayOutcomeCallable DeleteCustomerGatewayCallable(const Model::DeleteCustomerGatewayRequest& request) const;
 
+        /**
+         * Same as DeleteCustomerGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteCustomerGatewayOutcomeCallable DeleteCustomerGatewayCallable(Model::DeleteCustomerGatewayRequest&& request) const;
+
         /**
          * <p>Deletes the specified customer gateway. You must delete the VPN connection
          * before you can delete the customer gateway.</p>
@@ -3412,6 +4141,11 @@ namespace Model
          */
         virtual void DeleteCustomerGatewayAsync(const Model::DeleteCustomerGatewayRequest& request, const DeleteCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCustomerGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteCustomerGatewayAsync(Model::DeleteCustomerGatewayRequest&& request, const DeleteCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified set of DHCP options. You must disassociate the set of
          * DHCP options before you can delete it. You can disassociate the set of DHCP
@@ -3430,6 +4164,11 @@ namespace Model
          */
         virtual Model::DeleteDhcpOptionsOutcomeCallable DeleteDhcpOptionsCallable(const Model::DeleteDhcpOptionsRequest& request) const;
 
+        /**
+         * Same as DeleteDhcpOptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDhcpOptionsOutcomeCallable DeleteDhcpOptionsCallable(Model::DeleteDhcpOptionsRequest&& request) const;
+
         /**
          * <p>Deletes the specified set of DHCP options. You must disassociate the set of
          * DHCP options before you can delete it. You can disassociate the set of DHCP
@@ -3440,6 +4179,11 @@ namespace Model
          */
         virtual void DeleteDhcpOptionsAsync(const Model::DeleteDhcpOptionsRequest& request, const DeleteDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDhcpOptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDhcpOptionsAsync(Model::DeleteDhcpOptionsRequest&& request, const DeleteDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes one or more flow logs.</p>
          */
@@ -3452,6 +4196,11 @@ namespace Model
          */
         virtual Model::DeleteFlowLogsOutcomeCallable DeleteFlowLogsCallable(const Model::DeleteFlowLogsRequest& request) const;
 
+        /**
+         * Same as DeleteFlowLogsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteFlowLogsOutcomeCallable DeleteFlowLogsCallable(Model::DeleteFlowLogsRequest&& request) const;
+
         /**
          * <p>Deletes one or more flow logs.</p>
          *
@@ -3459,6 +4208,11 @@ namespace Model
          */
         virtual void DeleteFlowLogsAsync(const Model::DeleteFlowLogsRequest& request, const DeleteFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteFlowLogsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteFlowLogsAsync(Model::DeleteFlowLogsRequest&& request, const DeleteFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified Internet gateway. You must detach the Internet gateway
          * from the VPC before you can delete it.</p>
@@ -3473,6 +4227,11 @@ namespace Model
          */
         virtual Model::DeleteInternetGatewayOutcomeCallable DeleteInternetGatewayCallable(const Model::DeleteInternetGatewayRequest& request) const;
 
+        /**
+         * Same as DeleteInternetGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteInternetGatewayOutcomeCallable DeleteInternetGatewayCallable(Model::DeleteInternetGatewayRequest&& request) const;
+
         /**
          * <p>Deletes the specified Internet gateway. You must detach the Internet gateway
          * from the VPC before you can delete it.</p>
@@ -3481,6 +4240,11 @@ namespace Model
          */
         virtual void DeleteInternetGatewayAsync(const Model::DeleteInternetGatewayRequest& request, const DeleteInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteInternetGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteInternetGatewayAsync(Model::DeleteInternetGatewayRequest&& request, const DeleteInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified key pair, by removing the public key from Amazon
          * EC2.</p>
@@ -3495,6 +4259,11 @@ namespace Model
          */
         virtual Model::DeleteKeyPairOutcomeCallable DeleteKeyPairCallable(const Model::DeleteKeyPairRequest& request) const;
 
+        /**
+         * Same as DeleteKeyPairCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteKeyPairOutcomeCallable DeleteKeyPairCallable(Model::DeleteKeyPairRequest&& request) const;
+
         /**
          * <p>Deletes the specified key pair, by removing the public key from Amazon
          * EC2.</p>
@@ -3503,6 +4272,11 @@ namespace Model
          */
         virtual void DeleteKeyPairAsync(const Model::DeleteKeyPairRequest& request, const DeleteKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteKeyPairAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteKeyPairAsync(Model::DeleteKeyPairRequest&& request, const DeleteKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified NAT gateway. Deleting a NAT gateway disassociates its
          * Elastic IP address, but does not release the address from your account. Deleting
@@ -3519,6 +4293,11 @@ namespace Model
          */
         virtual Model::DeleteNatGatewayOutcomeCallable DeleteNatGatewayCallable(const Model::DeleteNatGatewayRequest& request) const;
 
+        /**
+         * Same as DeleteNatGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteNatGatewayOutcomeCallable DeleteNatGatewayCallable(Model::DeleteNatGatewayRequest&& request) const;
+
         /**
          * <p>Deletes the specified NAT gateway. Deleting a NAT gateway disassociates its
          * Elastic IP address, but does not release the address from your account. Deleting
@@ -3528,6 +4307,11 @@ namespace Model
          */
         virtual void DeleteNatGatewayAsync(const Model::DeleteNatGatewayRequest& request, const DeleteNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteNatGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteNatGatewayAsync(Model::DeleteNatGatewayRequest&& request, const DeleteNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified network ACL. You can't delete the ACL if it's
          * associated with any subnets. You can't delete the default network ACL.</p>
@@ -3542,6 +4326,11 @@ namespace Model
          */
         virtual Model::DeleteNetworkAclOutcomeCallable DeleteNetworkAclCallable(const Model::DeleteNetworkAclRequest& request) const;
 
+        /**
+         * Same as DeleteNetworkAclCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteNetworkAclOutcomeCallable DeleteNetworkAclCallable(Model::DeleteNetworkAclRequest&& request) const;
+
         /**
          * <p>Deletes the specified network ACL. You can't delete the ACL if it's
          * associated with any subnets. You can't delete the default network ACL.</p>
@@ -3550,6 +4339,11 @@ namespace Model
          */
         virtual void DeleteNetworkAclAsync(const Model::DeleteNetworkAclRequest& request, const DeleteNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteNetworkAclAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteNetworkAclAsync(Model::DeleteNetworkAclRequest&& request, const DeleteNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified ingress or egress entry (rule) from the specified
          * network ACL.</p>
@@ -3564,6 +4358,11 @@ namespace Model
          */
         virtual Model::DeleteNetworkAclEntryOutcomeCallable DeleteNetworkAclEntryCallable(const Model::DeleteNetworkAclEntryRequest& request) const;
 
+        /**
+         * Same as DeleteNetworkAclEntryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteNetworkAclEntryOutcomeCallable DeleteNetworkAclEntryCallable(Model::DeleteNetworkAclEntryRequest&& request) const;
+
         /**
          * <p>Deletes the specified ingress or egress entry (rule) from the specified
          * network ACL.</p>
@@ -3572,6 +4371,11 @@ namespace Model
          */
         virtual void DeleteNetworkAclEntryAsync(const Model::DeleteNetworkAclEntryRequest& request, const DeleteNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteNetworkAclEntryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteNetworkAclEntryAsync(Model::DeleteNetworkAclEntryRequest&& request, const DeleteNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified network interface. You must detach the network
          * interface before you can delete it.</p>
@@ -3586,6 +4390,11 @@ namespace Model
          */
         virtual Model::DeleteNetworkInterfaceOutcomeCallable DeleteNetworkInterfaceCallable(const Model::DeleteNetworkInterfaceRequest& request) const;
 
+        /**
+         * Same as DeleteNetworkInterfaceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteNetworkInterfaceOutcomeCallable DeleteNetworkInterfaceCallable(Model::DeleteNetworkInterfaceRequest&& request) const;
+
         /**
          * <p>Deletes the specified network interface. You must detach the network
          * interface before you can delete it.</p>
@@ -3594,6 +4403,11 @@ namespace Model
          */
         virtual void DeleteNetworkInterfaceAsync(const Model::DeleteNetworkInterfaceRequest& request, const DeleteNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteNetworkInterfaceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteNetworkInterfaceAsync(Model::DeleteNetworkInterfaceRequest&& request, const DeleteNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified placement group. You must terminate all instances in
          * the placement group before you can delete the placement group. For more
@@ -3614,6 +4428,11 @@ namespace Model
          */
         virtual Model::DeletePlacementGroupOutcomeCallable DeletePlacementGroupCallable(const Model::DeletePlacementGroupRequest& request) const;
 
+        /**
+         * Same as DeletePlacementGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeletePlacementGroupOutcomeCallable DeletePlacementGroupCallable(Model::DeletePlacementGroupRequest&& request) const;
+
         /**
          * <p>Deletes the specified placement group. You must terminate all instances in
          * the placement group before you can delete the placement group. For more
@@ -3625,6 +4444,11 @@ namespace Model
          */
         virtual void DeletePlacementGroupAsync(const Model::DeletePlacementGroupRequest& request, const DeletePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePlacementGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeletePlacementGroupAsync(Model::DeletePlacementGroupRequest&& request, const DeletePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified route from the specified route table.</p>
          */
@@ -3637,6 +4461,11 @@ namespace Model
          */
         virtual Model::DeleteRouteOutcomeCallable DeleteRouteCallable(const Model::DeleteRouteRequest& request) const;
 
+        /**
+         * Same as DeleteRouteCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteRouteOutcomeCallable DeleteRouteCallable(Model::DeleteRouteRequest&& request) const;
+
         /**
          * <p>Deletes the specified route from the specified route table.</p>
          *
@@ -3644,6 +4473,11 @@ namespace Model
          */
         virtual void DeleteRouteAsync(const Model::DeleteRouteRequest& request, const DeleteRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRouteAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteRouteAsync(Model::DeleteRouteRequest&& request, const DeleteRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified route table. You must disassociate the route table from
          * any subnets before you can delete it. You can't delete the main route table.</p>
@@ -3658,6 +4492,11 @@ namespace Model
          */
         virtual Model::DeleteRouteTableOutcomeCallable DeleteRouteTableCallable(const Model::DeleteRouteTableRequest& request) const;
 
+        /**
+         * Same as DeleteRouteTableCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteRouteTableOutcomeCallable DeleteRouteTableCallable(Model::DeleteRouteTableRequest&& request) const;
+
         /**
          * <p>Deletes the specified route table. You must disassociate the route table from
          * any subnets before you can delete it. You can't delete the main route table.</p>
@@ -3666,6 +4505,11 @@ namespace Model
          */
         virtual void DeleteRouteTableAsync(const Model::DeleteRouteTableRequest& request, const DeleteRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRouteTableAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteRouteTableAsync(Model::DeleteRouteTableRequest&& request, const DeleteRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a security group.</p> <p>If you attempt to delete a security group
          * that is associated with an instance, or is referenced by another security group,
@@ -3684,6 +4528,11 @@ namespace Model
          */
         virtual Model::DeleteSecurityGroupOutcomeCallable DeleteSecurityGroupCallable(const Model::DeleteSecurityGroupRequest& request) const;
 
+        /**
+         * Same as DeleteSecurityGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSecurityGroupOutcomeCallable DeleteSecurityGroupCallable(Model::DeleteSecurityGroupRequest&& request) const;
+
         /**
          * <p>Deletes a security group.</p> <p>If you attempt to delete a security group
          * that is associated with an instance, or is referenced by another security group,
@@ -3694,6 +4543,11 @@ namespace Model
          */
         virtual void DeleteSecurityGroupAsync(const Model::DeleteSecurityGroupRequest& request, const DeleteSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSecurityGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSecurityGroupAsync(Model::DeleteSecurityGroupRequest&& request, const DeleteSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified snapshot.</p> <p>When you make periodic snapshots of a
          * volume, the snapshots are incremental, and only the blocks on the device that
@@ -3728,6 +4582,11 @@ namespace Model
          */
         virtual Model::DeleteSnapshotOutcomeCallable DeleteSnapshotCallable(const Model::DeleteSnapshotRequest& request) const;
 
+        /**
+         * Same as DeleteSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSnapshotOutcomeCallable DeleteSnapshotCallable(Model::DeleteSnapshotRequest&& request) const;
+
         /**
          * <p>Deletes the specified snapshot.</p> <p>When you make periodic snapshots of a
          * volume, the snapshots are incremental, and only the blocks on the device that
@@ -3746,6 +4605,11 @@ namespace Model
          */
         virtual void DeleteSnapshotAsync(const Model::DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSnapshotAsync(Model::DeleteSnapshotRequest&& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the data feed for Spot instances.</p>
          */
@@ -3758,6 +4622,11 @@ namespace Model
          */
         virtual Model::DeleteSpotDatafeedSubscriptionOutcomeCallable DeleteSpotDatafeedSubscriptionCallable(const Model::DeleteSpotDatafeedSubscriptionRequest& request) const;
 
+        /**
+         * Same as DeleteSpotDatafeedSubscriptionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSpotDatafeedSubscriptionOutcomeCallable DeleteSpotDatafeedSubscriptionCallable(Model::DeleteSpotDatafeedSubscriptionRequest&& request) const;
+
         /**
          * <p>Deletes the data feed for Spot instances.</p>
          *
@@ -3765,6 +4634,11 @@ namespace Model
          */
         virtual void DeleteSpotDatafeedSubscriptionAsync(const Model::DeleteSpotDatafeedSubscriptionRequest& request, const DeleteSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSpotDatafeedSubscriptionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSpotDatafeedSubscriptionAsync(Model::DeleteSpotDatafeedSubscriptionRequest&& request, const DeleteSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified subnet. You must terminate all running instances in the
          * subnet before you can delete the subnet.</p>
@@ -3779,6 +4653,11 @@ namespace Model
          */
         virtual Model::DeleteSubnetOutcomeCallable DeleteSubnetCallable(const Model::DeleteSubnetRequest& request) const;
 
+        /**
+         * Same as DeleteSubnetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSubnetOutcomeCallable DeleteSubnetCallable(Model::DeleteSubnetRequest&& request) const;
+
         /**
          * <p>Deletes the specified subnet. You must terminate all running instances in the
          * subnet before you can delete the subnet.</p>
@@ -3787,6 +4666,11 @@ namespace Model
          */
         virtual void DeleteSubnetAsync(const Model::DeleteSubnetRequest& request, const DeleteSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSubnetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSubnetAsync(Model::DeleteSubnetRequest&& request, const DeleteSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified set of tags from the specified set of resources. This
          * call is designed to follow a <code>DescribeTags</code> request.</p> <p>For more
@@ -3807,6 +4691,11 @@ namespace Model
          */
         virtual Model::DeleteTagsOutcomeCallable DeleteTagsCallable(const Model::DeleteTagsRequest& request) const;
 
+        /**
+         * Same as DeleteTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteTagsOutcomeCallable DeleteTagsCallable(Model::DeleteTagsRequest&& request) const;
+
         /**
          * <p>Deletes the specified set of tags from the specified set of resources. This
          * call is designed to follow a <code>DescribeTags</code> request.</p> <p>For more
@@ -3818,6 +4707,11 @@ namespace Model
          */
         virtual void DeleteTagsAsync(const Model::DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteTagsAsync(Model::DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified EBS volume. The volume must be in the
          * <code>available</code> state (not attached to an instance).</p> <note> <p>The
@@ -3842,6 +4736,11 @@ namespace Model
          */
         virtual Model::DeleteVolumeOutcomeCallable DeleteVolumeCallable(const Model::DeleteVolumeRequest& request) const;
 
+        /**
+         * Same as DeleteVolumeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteVolumeOutcomeCallable DeleteVolumeCallable(Model::DeleteVolumeRequest&& request) const;
+
         /**
          * <p>Deletes the specified EBS volume. The volume must be in the
          * <code>available</code> state (not attached to an instance).</p> <note> <p>The
@@ -3855,6 +4754,11 @@ namespace Model
          */
         virtual void DeleteVolumeAsync(const Model::DeleteVolumeRequest& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVolumeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteVolumeAsync(Model::DeleteVolumeRequest&& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified VPC. You must detach or delete all gateways and
          * resources that are associated with the VPC before you can delete it. For
@@ -3875,6 +4779,11 @@ namespace Model
          */
         virtual Model::DeleteVpcOutcomeCallable DeleteVpcCallable(const Model::DeleteVpcRequest& request) const;
 
+        /**
+         * Same as DeleteVpcCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteVpcOutcomeCallable DeleteVpcCallable(Model::DeleteVpcRequest&& request) const;
+
         /**
          * <p>Deletes the specified VPC. You must detach or delete all gateways and
          * resources that are associated with the VPC before you can delete it. For
@@ -3886,6 +4795,11 @@ namespace Model
          */
         virtual void DeleteVpcAsync(const Model::DeleteVpcRequest& request, const DeleteVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVpcAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteVpcAsync(Model::DeleteVpcRequest&& request, const DeleteVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes one or more specified VPC endpoints. Deleting the endpoint also
          * deletes the endpoint routes in the route tables that were associated with the
@@ -3902,6 +4816,11 @@ namespace Model
          */
         virtual Model::DeleteVpcEndpointsOutcomeCallable DeleteVpcEndpointsCallable(const Model::DeleteVpcEndpointsRequest& request) const;
 
+        /**
+         * Same as DeleteVpcEndpointsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteVpcEndpointsOutcomeCallable DeleteVpcEndpointsCallable(Model::DeleteVpcEndpointsRequest&& request) const;
+
         /**
          * <p>Deletes one or more specified VPC endpoints. Deleting the endpoint also
          * deletes the endpoint routes in the route tables that were associated with the
@@ -3911,6 +4830,11 @@ namespace Model
          */
         virtual void DeleteVpcEndpointsAsync(const Model::DeleteVpcEndpointsRequest& request, const DeleteVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVpcEndpointsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteVpcEndpointsAsync(Model::DeleteVpcEndpointsRequest&& request, const DeleteVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a VPC peering connection. Either the owner of the requester VPC or
          * the owner of the peer VPC can delete the VPC peering connection if it's in the
@@ -3929,6 +4853,11 @@ namespace Model
          */
         virtual Model::DeleteVpcPeeringConnectionOutcomeCallable DeleteVpcPeeringConnectionCallable(const Model::DeleteVpcPeeringConnectionRequest& request) const;
 
+        /**
+         * Same as DeleteVpcPeeringConnectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteVpcPeeringConnectionOutcomeCallable DeleteVpcPeeringConnectionCallable(Model::DeleteVpcPeeringConnectionRequest&& request) const;
+
         /**
          * <p>Deletes a VPC peering connection. Either the owner of the requester VPC or
          * the owner of the peer VPC can delete the VPC peering connection if it's in the
@@ -3939,6 +4868,11 @@ namespace Model
          */
         virtual void DeleteVpcPeeringConnectionAsync(const Model::DeleteVpcPeeringConnectionRequest& request, const DeleteVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVpcPeeringConnectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteVpcPeeringConnectionAsync(Model::DeleteVpcPeeringConnectionRequest&& request, const DeleteVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified VPN connection.</p> <p>If you're deleting the VPC and
          * its associated components, we recommend that you detach the virtual private
@@ -3965,6 +4899,11 @@ namespace Model
          */
         virtual Model::DeleteVpnConnectionOutcomeCallable DeleteVpnConnectionCallable(const Model::DeleteVpnConnectionRequest& request) const;
 
+        /**
+         * Same as DeleteVpnConnectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteVpnConnectionOutcomeCallable DeleteVpnConnectionCallable(Model::DeleteVpnConnectionRequest&& request) const;
+
         /**
          * <p>Deletes the specified VPN connection.</p> <p>If you're deleting the VPC and
          * its associated components, we recommend that you detach the virtual private
@@ -3979,6 +4918,11 @@ namespace Model
          */
         virtual void DeleteVpnConnectionAsync(const Model::DeleteVpnConnectionRequest& request, const DeleteVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVpnConnectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteVpnConnectionAsync(Model::DeleteVpnConnectionRequest&& request, const DeleteVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified static route associated with a VPN connection between
          * an existing virtual private gateway and a VPN customer gateway. The static route
@@ -3997,6 +4941,11 @@ namespace Model
          */
         virtual Model::DeleteVpnConnectionRouteOutcomeCallable DeleteVpnConnectionRouteCallable(const Model::DeleteVpnConnectionRouteRequest& request) const;
 
+        /**
+         * Same as DeleteVpnConnectionRouteCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteVpnConnectionRouteOutcomeCallable DeleteVpnConnectionRouteCallable(Model::DeleteVpnConnectionRouteRequest&& request) const;
+
         /**
          * <p>Deletes the specified static route associated with a VPN connection between
          * an existing virtual private gateway and a VPN customer gateway. The static route
@@ -4007,6 +4956,11 @@ namespace Model
          */
         virtual void DeleteVpnConnectionRouteAsync(const Model::DeleteVpnConnectionRouteRequest& request, const DeleteVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVpnConnectionRouteAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteVpnConnectionRouteAsync(Model::DeleteVpnConnectionRouteRequest&& request, const DeleteVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified virtual private gateway. We recommend that before you
          * delete a virtual private gateway, you detach it from the VPC and delete the VPN
@@ -4027,6 +4981,11 @@ namespace Model
          */
         virtual Model::DeleteVpnGatewayOutcomeCallable DeleteVpnGatewayCallable(const Model::DeleteVpnGatewayRequest& request) const;
 
+        /**
+         * Same as DeleteVpnGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteVpnGatewayOutcomeCallable DeleteVpnGatewayCallable(Model::DeleteVpnGatewayRequest&& request) const;
+
         /**
          * <p>Deletes the specified virtual private gateway. We recommend that before you
          * delete a virtual private gateway, you detach it from the VPC and delete the VPN
@@ -4038,6 +4997,11 @@ namespace Model
          */
         virtual void DeleteVpnGatewayAsync(const Model::DeleteVpnGatewayRequest& request, const DeleteVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVpnGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteVpnGatewayAsync(Model::DeleteVpnGatewayRequest&& request, const DeleteVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters the specified AMI. After you deregister an AMI, it can't be used
          * to launch new instances.</p> <p>This command does not delete the AMI.</p>
@@ -4052,6 +5016,11 @@ namespace Model
          */
         virtual Model::DeregisterImageOutcomeCallable DeregisterImageCallable(const Model::DeregisterImageRequest& request) const;
 
+        /**
+         * Same as DeregisterImageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeregisterImageOutcomeCallable DeregisterImageCallable(Model::DeregisterImageRequest&& request) const;
+
         /**
          * <p>Deregisters the specified AMI. After you deregister an AMI, it can't be used
          * to launch new instances.</p> <p>This command does not delete the AMI.</p>
@@ -4060,6 +5029,11 @@ namespace Model
          */
         virtual void DeregisterImageAsync(const Model::DeregisterImageRequest& request, const DeregisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterImageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeregisterImageAsync(Model::DeregisterImageRequest&& request, const DeregisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes attributes of your AWS account. The following are the supported
          * account attributes:</p> <ul> <li> <p><code>supported-platforms</code>: Indicates
@@ -4096,6 +5070,11 @@ namespace Model
          */
         virtual Model::DescribeAccountAttributesOutcomeCallable DescribeAccountAttributesCallable(const Model::DescribeAccountAttributesRequest& request) const;
 
+        /**
+         * Same as DescribeAccountAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAccountAttributesOutcomeCallable DescribeAccountAttributesCallable(Model::DescribeAccountAttributesRequest&& request) const;
+
         /**
          * <p>Describes attributes of your AWS account. The following are the supported
          * account attributes:</p> <ul> <li> <p><code>supported-platforms</code>: Indicates
@@ -4115,6 +5094,11 @@ namespace Model
          */
         virtual void DescribeAccountAttributesAsync(const Model::DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAccountAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAccountAttributesAsync(Model::DescribeAccountAttributesRequest&& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your Elastic IP addresses.</p> <p>An Elastic IP
          * address is for use in either the EC2-Classic platform or in a VPC. For more
@@ -4135,6 +5119,11 @@ namespace Model
          */
         virtual Model::DescribeAddressesOutcomeCallable DescribeAddressesCallable(const Model::DescribeAddressesRequest& request) const;
 
+        /**
+         * Same as DescribeAddressesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAddressesOutcomeCallable DescribeAddressesCallable(Model::DescribeAddressesRequest&& request) const;
+
         /**
          * <p>Describes one or more of your Elastic IP addresses.</p> <p>An Elastic IP
          * address is for use in either the EC2-Classic platform or in a VPC. For more
@@ -4146,6 +5135,11 @@ namespace Model
          */
         virtual void DescribeAddressesAsync(const Model::DescribeAddressesRequest& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAddressesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAddressesAsync(Model::DescribeAddressesRequest&& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of the Availability Zones that are available to you.
          * The results include zones only for the region you're currently using. If there
@@ -4172,6 +5166,11 @@ namespace Model
          */
         virtual Model::DescribeAvailabilityZonesOutcomeCallable DescribeAvailabilityZonesCallable(const Model::DescribeAvailabilityZonesRequest& request) const;
 
+        /**
+         * Same as DescribeAvailabilityZonesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAvailabilityZonesOutcomeCallable DescribeAvailabilityZonesCallable(Model::DescribeAvailabilityZonesRequest&& request) const;
+
         /**
          * <p>Describes one or more of the Availability Zones that are available to you.
          * The results include zones only for the region you're currently using. If there
@@ -4186,6 +5185,11 @@ namespace Model
          */
         virtual void DescribeAvailabilityZonesAsync(const Model::DescribeAvailabilityZonesRequest& request, const DescribeAvailabilityZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAvailabilityZonesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAvailabilityZonesAsync(Model::DescribeAvailabilityZonesRequest&& request, const DescribeAvailabilityZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your bundling tasks.</p> <note><p>Completed bundle
          * tasks are listed for only a limited time. If your bundle task is no longer in
@@ -4206,6 +5210,11 @@ namespace Model
          */
         virtual Model::DescribeBundleTasksOutcomeCallable DescribeBundleTasksCallable(const Model::DescribeBundleTasksRequest& request) const;
 
+        /**
+         * Same as DescribeBundleTasksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeBundleTasksOutcomeCallable DescribeBundleTasksCallable(Model::DescribeBundleTasksRequest&& request) const;
+
         /**
          * <p>Describes one or more of your bundling tasks.</p> <note><p>Completed bundle
          * tasks are listed for only a limited time. If your bundle task is no longer in
@@ -4217,6 +5226,11 @@ namespace Model
          */
         virtual void DescribeBundleTasksAsync(const Model::DescribeBundleTasksRequest& request, const DescribeBundleTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeBundleTasksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeBundleTasksAsync(Model::DescribeBundleTasksRequest&& request, const DescribeBundleTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your linked EC2-Classic instances. This request only
          * returns information about EC2-Classic instances linked to a VPC through
@@ -4235,6 +5249,11 @@ namespace Model
          */
         virtual Model::DescribeClassicLinkInstancesOutcomeCallable DescribeClassicLinkInstancesCallable(const Model::DescribeClassicLinkInstancesRequest& request) const;
 
+        /**
+         * Same as DescribeClassicLinkInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeClassicLinkInstancesOutcomeCallable DescribeClassicLinkInstancesCallable(Model::DescribeClassicLinkInstancesRequest&& request) const;
+
         /**
          * <p>Describes one or more of your linked EC2-Classic instances. This request only
          * returns information about EC2-Classic instances linked to a VPC through
@@ -4245,6 +5264,11 @@ namespace Model
          */
         virtual void DescribeClassicLinkInstancesAsync(const Model::DescribeClassicLinkInstancesRequest& request, const DescribeClassicLinkInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClassicLinkInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeClassicLinkInstancesAsync(Model::DescribeClassicLinkInstancesRequest&& request, const DescribeClassicLinkInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your conversion tasks. For more information, see <a
          * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/UploadingYourInstancesandVolumes.html">Using
@@ -4269,6 +5293,11 @@ namespace Model
          */
         virtual Model::DescribeConversionTasksOutcomeCallable DescribeConversionTasksCallable(const Model::DescribeConversionTasksRequest& request) const;
 
+        /**
+         * Same as DescribeConversionTasksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeConversionTasksOutcomeCallable DescribeConversionTasksCallable(Model::DescribeConversionTasksRequest&& request) const;
+
         /**
          * <p>Describes one or more of your conversion tasks. For more information, see <a
          * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/UploadingYourInstancesandVolumes.html">Using
@@ -4282,6 +5311,11 @@ namespace Model
          */
         virtual void DescribeConversionTasksAsync(const Model::DescribeConversionTasksRequest& request, const DescribeConversionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConversionTasksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeConversionTasksAsync(Model::DescribeConversionTasksRequest&& request, const DescribeConversionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your VPN customer gateways.</p> <p>For more
          * information about VPN customer gateways, see <a
@@ -4302,6 +5336,11 @@ namespace Model
          */
         virtual Model::DescribeCustomerGatewaysOutcomeCallable DescribeCustomerGatewaysCallable(const Model::DescribeCustomerGatewaysRequest& request) const;
 
+        /**
+         * Same as DescribeCustomerGatewaysCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCustomerGatewaysOutcomeCallable DescribeCustomerGatewaysCallable(Model::DescribeCustomerGatewaysRequest&& request) const;
+
         /**
          * <p>Describes one or more of your VPN customer gateways.</p> <p>For more
          * information about VPN customer gateways, see <a
@@ -4313,6 +5352,11 @@ namespace Model
          */
         virtual void DescribeCustomerGatewaysAsync(const Model::DescribeCustomerGatewaysRequest& request, const DescribeCustomerGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCustomerGatewaysAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCustomerGatewaysAsync(Model::DescribeCustomerGatewaysRequest&& request, const DescribeCustomerGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your DHCP options sets.</p> <p>For more information
          * about DHCP options sets, see <a
@@ -4331,6 +5375,11 @@ namespace Model
          */
         virtual Model::DescribeDhcpOptionsOutcomeCallable DescribeDhcpOptionsCallable(const Model::DescribeDhcpOptionsRequest& request) const;
 
+        /**
+         * Same as DescribeDhcpOptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDhcpOptionsOutcomeCallable DescribeDhcpOptionsCallable(Model::DescribeDhcpOptionsRequest&& request) const;
+
         /**
          * <p>Describes one or more of your DHCP options sets.</p> <p>For more information
          * about DHCP options sets, see <a
@@ -4341,6 +5390,11 @@ namespace Model
          */
         virtual void DescribeDhcpOptionsAsync(const Model::DescribeDhcpOptionsRequest& request, const DescribeDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDhcpOptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDhcpOptionsAsync(Model::DescribeDhcpOptionsRequest&& request, const DescribeDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your export tasks.</p>
          */
@@ -4353,6 +5407,11 @@ namespace Model
          */
         virtual Model::DescribeExportTasksOutcomeCallable DescribeExportTasksCallable(const Model::DescribeExportTasksRequest& request) const;
 
+        /**
+         * Same as DescribeExportTasksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeExportTasksOutcomeCallable DescribeExportTasksCallable(Model::DescribeExportTasksRequest&& request) const;
+
         /**
          * <p>Describes one or more of your export tasks.</p>
          *
@@ -4360,6 +5419,11 @@ namespace Model
          */
         virtual void DescribeExportTasksAsync(const Model::DescribeExportTasksRequest& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeExportTasksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeExportTasksAsync(Model::DescribeExportTasksRequest&& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more flow logs. To view the information in your flow logs
          * (the log streams for the network interfaces), you must use the CloudWatch Logs
@@ -4376,6 +5440,11 @@ namespace Model
          */
         virtual Model::DescribeFlowLogsOutcomeCallable DescribeFlowLogsCallable(const Model::DescribeFlowLogsRequest& request) const;
 
+        /**
+         * Same as DescribeFlowLogsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeFlowLogsOutcomeCallable DescribeFlowLogsCallable(Model::DescribeFlowLogsRequest&& request) const;
+
         /**
          * <p>Describes one or more flow logs. To view the information in your flow logs
          * (the log streams for the network interfaces), you must use the CloudWatch Logs
@@ -4385,6 +5454,11 @@ namespace Model
          */
         virtual void DescribeFlowLogsAsync(const Model::DescribeFlowLogsRequest& request, const DescribeFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFlowLogsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeFlowLogsAsync(Model::DescribeFlowLogsRequest&& request, const DescribeFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your Dedicated hosts.</p> <p>The results describe
          * only the Dedicated hosts in the region you're currently using. All listed
@@ -4403,6 +5477,11 @@ namespace Model
          */
         virtual Model::DescribeHostsOutcomeCallable DescribeHostsCallable(const Model::DescribeHostsRequest& request) const;
 
+        /**
+         * Same as DescribeHostsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeHostsOutcomeCallable DescribeHostsCallable(Model::DescribeHostsRequest&& request) const;
+
         /**
          * <p>Describes one or more of your Dedicated hosts.</p> <p>The results describe
          * only the Dedicated hosts in the region you're currently using. All listed
@@ -4413,6 +5492,11 @@ namespace Model
          */
         virtual void DescribeHostsAsync(const Model::DescribeHostsRequest& request, const DescribeHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeHostsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeHostsAsync(Model::DescribeHostsRequest&& request, const DescribeHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the ID format settings for your resources on a per-region basis,
          * for example, to view which resource types are enabled for longer IDs. This
@@ -4447,6 +5531,11 @@ namespace Model
          */
         virtual Model::DescribeIdFormatOutcomeCallable DescribeIdFormatCallable(const Model::DescribeIdFormatRequest& request) const;
 
+        /**
+         * Same as DescribeIdFormatCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeIdFormatOutcomeCallable DescribeIdFormatCallable(Model::DescribeIdFormatRequest&& request) const;
+
         /**
          * <p>Describes the ID format settings for your resources on a per-region basis,
          * for example, to view which resource types are enabled for longer IDs. This
@@ -4465,6 +5554,11 @@ namespace Model
          */
         virtual void DescribeIdFormatAsync(const Model::DescribeIdFormatRequest& request, const DescribeIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeIdFormatAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeIdFormatAsync(Model::DescribeIdFormatRequest&& request, const DescribeIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified attribute of the specified AMI. You can specify only
          * one attribute at a time.</p>
@@ -4479,6 +5573,11 @@ namespace Model
          */
         virtual Model::DescribeImageAttributeOutcomeCallable DescribeImageAttributeCallable(const Model::DescribeImageAttributeRequest& request) const;
 
+        /**
+         * Same as DescribeImageAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeImageAttributeOutcomeCallable DescribeImageAttributeCallable(Model::DescribeImageAttributeRequest&& request) const;
+
         /**
          * <p>Describes the specified attribute of the specified AMI. You can specify only
          * one attribute at a time.</p>
@@ -4487,6 +5586,11 @@ namespace Model
          */
         virtual void DescribeImageAttributeAsync(const Model::DescribeImageAttributeRequest& request, const DescribeImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeImageAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeImageAttributeAsync(Model::DescribeImageAttributeRequest&& request, const DescribeImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of the images (AMIs, AKIs, and ARIs) available to you.
          * Images available to you include public images, private images that you own, and
@@ -4507,6 +5611,11 @@ namespace Model
          */
         virtual Model::DescribeImagesOutcomeCallable DescribeImagesCallable(const Model::DescribeImagesRequest& request) const;
 
+        /**
+         * Same as DescribeImagesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeImagesOutcomeCallable DescribeImagesCallable(Model::DescribeImagesRequest&& request) const;
+
         /**
          * <p>Describes one or more of the images (AMIs, AKIs, and ARIs) available to you.
          * Images available to you include public images, private images that you own, and
@@ -4518,6 +5627,11 @@ namespace Model
          */
         virtual void DescribeImagesAsync(const Model::DescribeImagesRequest& request, const DescribeImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeImagesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeImagesAsync(Model::DescribeImagesRequest&& request, const DescribeImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Displays details about an import virtual machine or import snapshot tasks
          * that are already created.</p>
@@ -4532,6 +5646,11 @@ namespace Model
          */
         virtual Model::DescribeImportImageTasksOutcomeCallable DescribeImportImageTasksCallable(const Model::DescribeImportImageTasksRequest& request) const;
 
+        /**
+         * Same as DescribeImportImageTasksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeImportImageTasksOutcomeCallable DescribeImportImageTasksCallable(Model::DescribeImportImageTasksRequest&& request) const;
+
         /**
          * <p>Displays details about an import virtual machine or import snapshot tasks
          * that are already created.</p>
@@ -4540,6 +5659,11 @@ namespace Model
          */
         virtual void DescribeImportImageTasksAsync(const Model::DescribeImportImageTasksRequest& request, const DescribeImportImageTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeImportImageTasksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeImportImageTasksAsync(Model::DescribeImportImageTasksRequest&& request, const DescribeImportImageTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes your import snapshot tasks.</p>
          */
@@ -4552,6 +5676,11 @@ namespace Model
          */
         virtual Model::DescribeImportSnapshotTasksOutcomeCallable DescribeImportSnapshotTasksCallable(const Model::DescribeImportSnapshotTasksRequest& request) const;
 
+        /**
+         * Same as DescribeImportSnapshotTasksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeImportSnapshotTasksOutcomeCallable DescribeImportSnapshotTasksCallable(Model::DescribeImportSnapshotTasksRequest&& request) const;
+
         /**
          * <p>Describes your import snapshot tasks.</p>
          *
@@ -4559,6 +5688,11 @@ namespace Model
          */
         virtual void DescribeImportSnapshotTasksAsync(const Model::DescribeImportSnapshotTasksRequest& request, const DescribeImportSnapshotTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeImportSnapshotTasksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeImportSnapshotTasksAsync(Model::DescribeImportSnapshotTasksRequest&& request, const DescribeImportSnapshotTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified attribute of the specified instance. You can specify
          * only one attribute at a time. Valid attribute values are:
@@ -4585,6 +5719,11 @@ namespace Model
          */
         virtual Model::DescribeInstanceAttributeOutcomeCallable DescribeInstanceAttributeCallable(const Model::DescribeInstanceAttributeRequest& request) const;
 
+        /**
+         * Same as DescribeInstanceAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeInstanceAttributeOutcomeCallable DescribeInstanceAttributeCallable(Model::DescribeInstanceAttributeRequest&& request) const;
+
         /**
          * <p>Describes the specified attribute of the specified instance. You can specify
          * only one attribute at a time. Valid attribute values are:
@@ -4599,6 +5738,11 @@ namespace Model
          */
         virtual void DescribeInstanceAttributeAsync(const Model::DescribeInstanceAttributeRequest& request, const DescribeInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInstanceAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeInstanceAttributeAsync(Model::DescribeInstanceAttributeRequest&& request, const DescribeInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the status of one or more instances.</p> <p>Instance status
          * includes the following components:</p> <ul> <li> <p><b>Status checks</b> -
@@ -4649,6 +5793,11 @@ namespace Model
          */
         virtual Model::DescribeInstanceStatusOutcomeCallable DescribeInstanceStatusCallable(const Model::DescribeInstanceStatusRequest& request) const;
 
+        /**
+         * Same as DescribeInstanceStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeInstanceStatusOutcomeCallable DescribeInstanceStatusCallable(Model::DescribeInstanceStatusRequest&& request) const;
+
         /**
          * <p>Describes the status of one or more instances.</p> <p>Instance status
          * includes the following components:</p> <ul> <li> <p><b>Status checks</b> -
@@ -4675,6 +5824,11 @@ namespace Model
          */
         virtual void DescribeInstanceStatusAsync(const Model::DescribeInstanceStatusRequest& request, const DescribeInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInstanceStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeInstanceStatusAsync(Model::DescribeInstanceStatusRequest&& request, const DescribeInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your instances.</p> <p>If you specify one or more
          * instance IDs, Amazon EC2 returns information for those instances. If you do not
@@ -4699,6 +5853,11 @@ namespace Model
          */
         virtual Model::DescribeInstancesOutcomeCallable DescribeInstancesCallable(const Model::DescribeInstancesRequest& request) const;
 
+        /**
+         * Same as DescribeInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeInstancesOutcomeCallable DescribeInstancesCallable(Model::DescribeInstancesRequest&& request) const;
+
         /**
          * <p>Describes one or more of your instances.</p> <p>If you specify one or more
          * instance IDs, Amazon EC2 returns information for those instances. If you do not
@@ -4712,6 +5871,11 @@ namespace Model
          */
         virtual void DescribeInstancesAsync(const Model::DescribeInstancesRequest& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeInstancesAsync(Model::DescribeInstancesRequest&& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your Internet gateways.</p>
          */
@@ -4724,6 +5888,11 @@ namespace Model
          */
         virtual Model::DescribeInternetGatewaysOutcomeCallable DescribeInternetGatewaysCallable(const Model::DescribeInternetGatewaysRequest& request) const;
 
+        /**
+         * Same as DescribeInternetGatewaysCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeInternetGatewaysOutcomeCallable DescribeInternetGatewaysCallable(Model::DescribeInternetGatewaysRequest&& request) const;
+
         /**
          * <p>Describes one or more of your Internet gateways.</p>
          *
@@ -4731,6 +5900,11 @@ namespace Model
          */
         virtual void DescribeInternetGatewaysAsync(const Model::DescribeInternetGatewaysRequest& request, const DescribeInternetGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInternetGatewaysAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeInternetGatewaysAsync(Model::DescribeInternetGatewaysRequest&& request, const DescribeInternetGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your key pairs.</p> <p>For more information about
          * key pairs, see <a
@@ -4749,6 +5923,11 @@ namespace Model
          */
         virtual Model::DescribeKeyPairsOutcomeCallable DescribeKeyPairsCallable(const Model::DescribeKeyPairsRequest& request) const;
 
+        /**
+         * Same as DescribeKeyPairsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeKeyPairsOutcomeCallable DescribeKeyPairsCallable(Model::DescribeKeyPairsRequest&& request) const;
+
         /**
          * <p>Describes one or more of your key pairs.</p> <p>For more information about
          * key pairs, see <a
@@ -4759,6 +5938,11 @@ namespace Model
          */
         virtual void DescribeKeyPairsAsync(const Model::DescribeKeyPairsRequest& request, const DescribeKeyPairsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeKeyPairsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeKeyPairsAsync(Model::DescribeKeyPairsRequest&& request, const DescribeKeyPairsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes your Elastic IP addresses that are being moved to the EC2-VPC
          * platform, or that are being restored to the EC2-Classic platform. This request
@@ -4777,6 +5961,11 @@ namespace Model
          */
         virtual Model::DescribeMovingAddressesOutcomeCallable DescribeMovingAddressesCallable(const Model::DescribeMovingAddressesRequest& request) const;
 
+        /**
+         * Same as DescribeMovingAddressesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeMovingAddressesOutcomeCallable DescribeMovingAddressesCallable(Model::DescribeMovingAddressesRequest&& request) const;
+
         /**
          * <p>Describes your Elastic IP addresses that are being moved to the EC2-VPC
          * platform, or that are being restored to the EC2-Classic platform. This request
@@ -4787,6 +5976,11 @@ namespace Model
          */
         virtual void DescribeMovingAddressesAsync(const Model::DescribeMovingAddressesRequest& request, const DescribeMovingAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeMovingAddressesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeMovingAddressesAsync(Model::DescribeMovingAddressesRequest&& request, const DescribeMovingAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of the your NAT gateways.</p>
          */
@@ -4799,6 +5993,11 @@ namespace Model
          */
         virtual Model::DescribeNatGatewaysOutcomeCallable DescribeNatGatewaysCallable(const Model::DescribeNatGatewaysRequest& request) const;
 
+        /**
+         * Same as DescribeNatGatewaysCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeNatGatewaysOutcomeCallable DescribeNatGatewaysCallable(Model::DescribeNatGatewaysRequest&& request) const;
+
         /**
          * <p>Describes one or more of the your NAT gateways.</p>
          *
@@ -4806,6 +6005,11 @@ namespace Model
          */
         virtual void DescribeNatGatewaysAsync(const Model::DescribeNatGatewaysRequest& request, const DescribeNatGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeNatGatewaysAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeNatGatewaysAsync(Model::DescribeNatGatewaysRequest&& request, const DescribeNatGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your network ACLs.</p> <p>For more information about
          * network ACLs, see <a
@@ -4824,6 +6028,11 @@ namespace Model
          */
         virtual Model::DescribeNetworkAclsOutcomeCallable DescribeNetworkAclsCallable(const Model::DescribeNetworkAclsRequest& request) const;
 
+        /**
+         * Same as DescribeNetworkAclsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeNetworkAclsOutcomeCallable DescribeNetworkAclsCallable(Model::DescribeNetworkAclsRequest&& request) const;
+
         /**
          * <p>Describes one or more of your network ACLs.</p> <p>For more information about
          * network ACLs, see <a
@@ -4834,6 +6043,11 @@ namespace Model
          */
         virtual void DescribeNetworkAclsAsync(const Model::DescribeNetworkAclsRequest& request, const DescribeNetworkAclsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeNetworkAclsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeNetworkAclsAsync(Model::DescribeNetworkAclsRequest&& request, const DescribeNetworkAclsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes a network interface attribute. You can specify only one attribute
          * at a time.</p>
@@ -4848,6 +6062,11 @@ namespace Model
          */
         virtual Model::DescribeNetworkInterfaceAttributeOutcomeCallable DescribeNetworkInterfaceAttributeCallable(const Model::DescribeNetworkInterfaceAttributeRequest& request) const;
 
+        /**
+         * Same as DescribeNetworkInterfaceAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeNetworkInterfaceAttributeOutcomeCallable DescribeNetworkInterfaceAttributeCallable(Model::DescribeNetworkInterfaceAttributeRequest&& request) const;
+
         /**
          * <p>Describes a network interface attribute. You can specify only one attribute
          * at a time.</p>
@@ -4856,6 +6075,11 @@ namespace Model
          */
         virtual void DescribeNetworkInterfaceAttributeAsync(const Model::DescribeNetworkInterfaceAttributeRequest& request, const DescribeNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeNetworkInterfaceAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeNetworkInterfaceAttributeAsync(Model::DescribeNetworkInterfaceAttributeRequest&& request, const DescribeNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your network interfaces.</p>
          */
@@ -4868,6 +6092,11 @@ namespace Model
          */
         virtual Model::DescribeNetworkInterfacesOutcomeCallable DescribeNetworkInterfacesCallable(const Model::DescribeNetworkInterfacesRequest& request) const;
 
+        /**
+         * Same as DescribeNetworkInterfacesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeNetworkInterfacesOutcomeCallable DescribeNetworkInterfacesCallable(Model::DescribeNetworkInterfacesRequest&& request) const;
+
         /**
          * <p>Describes one or more of your network interfaces.</p>
          *
@@ -4875,6 +6104,11 @@ namespace Model
          */
         virtual void DescribeNetworkInterfacesAsync(const Model::DescribeNetworkInterfacesRequest& request, const DescribeNetworkInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeNetworkInterfacesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeNetworkInterfacesAsync(Model::DescribeNetworkInterfacesRequest&& request, const DescribeNetworkInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your placement groups. For more information about
          * placement groups and cluster instances, see <a
@@ -4893,6 +6127,11 @@ namespace Model
          */
         virtual Model::DescribePlacementGroupsOutcomeCallable DescribePlacementGroupsCallable(const Model::DescribePlacementGroupsRequest& request) const;
 
+        /**
+         * Same as DescribePlacementGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribePlacementGroupsOutcomeCallable DescribePlacementGroupsCallable(Model::DescribePlacementGroupsRequest&& request) const;
+
         /**
          * <p>Describes one or more of your placement groups. For more information about
          * placement groups and cluster instances, see <a
@@ -4903,6 +6142,11 @@ namespace Model
          */
         virtual void DescribePlacementGroupsAsync(const Model::DescribePlacementGroupsRequest& request, const DescribePlacementGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribePlacementGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribePlacementGroupsAsync(Model::DescribePlacementGroupsRequest&& request, const DescribePlacementGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes available AWS services in a prefix list format, which includes the
          * prefix list name and prefix list ID of the service and the IP address range for
@@ -4923,6 +6167,11 @@ namespace Model
          */
         virtual Model::DescribePrefixListsOutcomeCallable DescribePrefixListsCallable(const Model::DescribePrefixListsRequest& request) const;
 
+        /**
+         * Same as DescribePrefixListsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribePrefixListsOutcomeCallable DescribePrefixListsCallable(Model::DescribePrefixListsRequest&& request) const;
+
         /**
          * <p>Describes available AWS services in a prefix list format, which includes the
          * prefix list name and prefix list ID of the service and the IP address range for
@@ -4934,6 +6183,11 @@ namespace Model
          */
         virtual void DescribePrefixListsAsync(const Model::DescribePrefixListsRequest& request, const DescribePrefixListsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribePrefixListsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribePrefixListsAsync(Model::DescribePrefixListsRequest&& request, const DescribePrefixListsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more regions that are currently available to you.</p> <p>For
          * a list of the regions supported by Amazon EC2, see <a
@@ -4952,6 +6206,11 @@ namespace Model
          */
         virtual Model::DescribeRegionsOutcomeCallable DescribeRegionsCallable(const Model::DescribeRegionsRequest& request) const;
 
+        /**
+         * Same as DescribeRegionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeRegionsOutcomeCallable DescribeRegionsCallable(Model::DescribeRegionsRequest&& request) const;
+
         /**
          * <p>Describes one or more regions that are currently available to you.</p> <p>For
          * a list of the regions supported by Amazon EC2, see <a
@@ -4962,6 +6221,11 @@ namespace Model
          */
         virtual void DescribeRegionsAsync(const Model::DescribeRegionsRequest& request, const DescribeRegionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRegionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeRegionsAsync(Model::DescribeRegionsRequest&& request, const DescribeRegionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of the Reserved Instances that you purchased.</p>
          * <p>For more information about Reserved Instances, see <a
@@ -4980,6 +6244,11 @@ namespace Model
          */
         virtual Model::DescribeReservedInstancesOutcomeCallable DescribeReservedInstancesCallable(const Model::DescribeReservedInstancesRequest& request) const;
 
+        /**
+         * Same as DescribeReservedInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeReservedInstancesOutcomeCallable DescribeReservedInstancesCallable(Model::DescribeReservedInstancesRequest&& request) const;
+
         /**
          * <p>Describes one or more of the Reserved Instances that you purchased.</p>
          * <p>For more information about Reserved Instances, see <a
@@ -4990,6 +6259,11 @@ namespace Model
          */
         virtual void DescribeReservedInstancesAsync(const Model::DescribeReservedInstancesRequest& request, const DescribeReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeReservedInstancesAsync(Model::DescribeReservedInstancesRequest&& request, const DescribeReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes your account's Reserved Instance listings in the Reserved Instance
          * Marketplace.</p> <p>The Reserved Instance Marketplace matches sellers who want
@@ -5034,6 +6308,11 @@ namespace Model
          */
         virtual Model::DescribeReservedInstancesListingsOutcomeCallable DescribeReservedInstancesListingsCallable(const Model::DescribeReservedInstancesListingsRequest& request) const;
 
+        /**
+         * Same as DescribeReservedInstancesListingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeReservedInstancesListingsOutcomeCallable DescribeReservedInstancesListingsCallable(Model::DescribeReservedInstancesListingsRequest&& request) const;
+
         /**
          * <p>Describes your account's Reserved Instance listings in the Reserved Instance
          * Marketplace.</p> <p>The Reserved Instance Marketplace matches sellers who want
@@ -5057,6 +6336,11 @@ namespace Model
          */
         virtual void DescribeReservedInstancesListingsAsync(const Model::DescribeReservedInstancesListingsRequest& request, const DescribeReservedInstancesListingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedInstancesListingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeReservedInstancesListingsAsync(Model::DescribeReservedInstancesListingsRequest&& request, const DescribeReservedInstancesListingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the modifications made to your Reserved Instances. If no parameter
          * is specified, information about all your Reserved Instances modification
@@ -5079,6 +6363,11 @@ namespace Model
          */
         virtual Model::DescribeReservedInstancesModificationsOutcomeCallable DescribeReservedInstancesModificationsCallable(const Model::DescribeReservedInstancesModificationsRequest& request) const;
 
+        /**
+         * Same as DescribeReservedInstancesModificationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeReservedInstancesModificationsOutcomeCallable DescribeReservedInstancesModificationsCallable(Model::DescribeReservedInstancesModificationsRequest&& request) const;
+
         /**
          * <p>Describes the modifications made to your Reserved Instances. If no parameter
          * is specified, information about all your Reserved Instances modification
@@ -5091,6 +6380,11 @@ namespace Model
          */
         virtual void DescribeReservedInstancesModificationsAsync(const Model::DescribeReservedInstancesModificationsRequest& request, const DescribeReservedInstancesModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedInstancesModificationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeReservedInstancesModificationsAsync(Model::DescribeReservedInstancesModificationsRequest&& request, const DescribeReservedInstancesModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes Reserved Instance offerings that are available for purchase. With
          * Reserved Instances, you purchase the right to launch instances for a period of
@@ -5123,6 +6417,11 @@ namespace Model
          */
         virtual Model::DescribeReservedInstancesOfferingsOutcomeCallable DescribeReservedInstancesOfferingsCallable(const Model::DescribeReservedInstancesOfferingsRequest& request) const;
 
+        /**
+         * Same as DescribeReservedInstancesOfferingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeReservedInstancesOfferingsOutcomeCallable DescribeReservedInstancesOfferingsCallable(Model::DescribeReservedInstancesOfferingsRequest&& request) const;
+
         /**
          * <p>Describes Reserved Instance offerings that are available for purchase. With
          * Reserved Instances, you purchase the right to launch instances for a period of
@@ -5140,6 +6439,11 @@ namespace Model
          */
         virtual void DescribeReservedInstancesOfferingsAsync(const Model::DescribeReservedInstancesOfferingsRequest& request, const DescribeReservedInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedInstancesOfferingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeReservedInstancesOfferingsAsync(Model::DescribeReservedInstancesOfferingsRequest&& request, const DescribeReservedInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your route tables. </p> <p>Each subnet in your VPC
          * must be associated with a route table. If a subnet is not explicitly associated
@@ -5164,6 +6468,11 @@ namespace Model
          */
         virtual Model::DescribeRouteTablesOutcomeCallable DescribeRouteTablesCallable(const Model::DescribeRouteTablesRequest& request) const;
 
+        /**
+         * Same as DescribeRouteTablesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeRouteTablesOutcomeCallable DescribeRouteTablesCallable(Model::DescribeRouteTablesRequest&& request) const;
+
         /**
          * <p>Describes one or more of your route tables. </p> <p>Each subnet in your VPC
          * must be associated with a route table. If a subnet is not explicitly associated
@@ -5177,6 +6486,11 @@ namespace Model
          */
         virtual void DescribeRouteTablesAsync(const Model::DescribeRouteTablesRequest& request, const DescribeRouteTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRouteTablesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeRouteTablesAsync(Model::DescribeRouteTablesRequest&& request, const DescribeRouteTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Finds available schedules that meet the specified criteria.</p> <p>You can
          * search for an available schedule no more than 3 months in advance. You must meet
@@ -5201,6 +6515,11 @@ namespace Model
          */
         virtual Model::DescribeScheduledInstanceAvailabilityOutcomeCallable DescribeScheduledInstanceAvailabilityCallable(const Model::DescribeScheduledInstanceAvailabilityRequest& request) const;
 
+        /**
+         * Same as DescribeScheduledInstanceAvailabilityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeScheduledInstanceAvailabilityOutcomeCallable DescribeScheduledInstanceAvailabilityCallable(Model::DescribeScheduledInstanceAvailabilityRequest&& request) const;
+
         /**
          * <p>Finds available schedules that meet the specified criteria.</p> <p>You can
          * search for an available schedule no more than 3 months in advance. You must meet
@@ -5214,6 +6533,11 @@ namespace Model
          */
         virtual void DescribeScheduledInstanceAvailabilityAsync(const Model::DescribeScheduledInstanceAvailabilityRequest& request, const DescribeScheduledInstanceAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScheduledInstanceAvailabilityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeScheduledInstanceAvailabilityAsync(Model::DescribeScheduledInstanceAvailabilityRequest&& request, const DescribeScheduledInstanceAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your Scheduled Instances.</p>
          */
@@ -5226,6 +6550,11 @@ namespace Model
          */
         virtual Model::DescribeScheduledInstancesOutcomeCallable DescribeScheduledInstancesCallable(const Model::DescribeScheduledInstancesRequest& request) const;
 
+        /**
+         * Same as DescribeScheduledInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeScheduledInstancesOutcomeCallable DescribeScheduledInstancesCallable(Model::DescribeScheduledInstancesRequest&& request) const;
+
         /**
          * <p>Describes one or more of your Scheduled Instances.</p>
          *
@@ -5233,6 +6562,11 @@ namespace Model
          */
         virtual void DescribeScheduledInstancesAsync(const Model::DescribeScheduledInstancesRequest& request, const DescribeScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeScheduledInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeScheduledInstancesAsync(Model::DescribeScheduledInstancesRequest&& request, const DescribeScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your security groups.</p> <p>A security group is for
          * use with instances either in the EC2-Classic platform or in a specific VPC. For
@@ -5261,6 +6595,11 @@ namespace Model
          */
         virtual Model::DescribeSecurityGroupsOutcomeCallable DescribeSecurityGroupsCallable(const Model::DescribeSecurityGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeSecurityGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSecurityGroupsOutcomeCallable DescribeSecurityGroupsCallable(Model::DescribeSecurityGroupsRequest&& request) const;
+
         /**
          * <p>Describes one or more of your security groups.</p> <p>A security group is for
          * use with instances either in the EC2-Classic platform or in a specific VPC. For
@@ -5276,6 +6615,11 @@ namespace Model
          */
         virtual void DescribeSecurityGroupsAsync(const Model::DescribeSecurityGroupsRequest& request, const DescribeSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSecurityGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSecurityGroupsAsync(Model::DescribeSecurityGroupsRequest&& request, const DescribeSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified attribute of the specified snapshot. You can specify
          * only one attribute at a time.</p> <p>For more information about EBS snapshots,
@@ -5294,7 +6638,12 @@ namespace Model
          *
          * returns a future to the operation so that it can be executed in parallel to other requests.
          */
-        virtual Model::DescribeSnapshotAttributeOutcomeCallable DescribeSnapshotAttributeCallable(const Model::DescribeSnapshotAttributeRequest& request) const;
+        virtual Model::DescribeSnapshotAttributeOutcomeCallable DescribeSnapshotAttributeCallable(const Model::DescribeSnapshotAttributeRequest& request) const;
+
+        /**
+         * Same as DescribeSnapshotAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSnapshotAttributeOutcomeCallable DescribeSnapshotAttributeCallable(Model::DescribeSnapshotAttributeRequest&& request) const;
 
         /**
          * <p>Describes the specified attribute of the specified snapshot. You can specify
@@ -5307,6 +6656,11 @@ namespace Model
          */
         virtual void DescribeSnapshotAttributeAsync(const Model::DescribeSnapshotAttributeRequest& request, const DescribeSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSnapshotAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSnapshotAttributeAsync(Model::DescribeSnapshotAttributeRequest&& request, const DescribeSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of the EBS snapshots available to you. Available
          * snapshots include public snapshots available for any AWS account to launch,
@@ -5387,6 +6741,11 @@ namespace Model
          */
         virtual Model::DescribeSnapshotsOutcomeCallable DescribeSnapshotsCallable(const Model::DescribeSnapshotsRequest& request) const;
 
+        /**
+         * Same as DescribeSnapshotsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSnapshotsOutcomeCallable DescribeSnapshotsCallable(Model::DescribeSnapshotsRequest&& request) const;
+
         /**
          * <p>Describes one or more of the EBS snapshots available to you. Available
          * snapshots include public snapshots available for any AWS account to launch,
@@ -5428,6 +6787,11 @@ namespace Model
          */
         virtual void DescribeSnapshotsAsync(const Model::DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSnapshotsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSnapshotsAsync(Model::DescribeSnapshotsRequest&& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the data feed for Spot instances. For more information, see <a
          * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/spot-data-feeds.html">Spot
@@ -5446,6 +6810,11 @@ namespace Model
          */
         virtual Model::DescribeSpotDatafeedSubscriptionOutcomeCallable DescribeSpotDatafeedSubscriptionCallable(const Model::DescribeSpotDatafeedSubscriptionRequest& request) const;
 
+        /**
+         * Same as DescribeSpotDatafeedSubscriptionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSpotDatafeedSubscriptionOutcomeCallable DescribeSpotDatafeedSubscriptionCallable(Model::DescribeSpotDatafeedSubscriptionRequest&& request) const;
+
         /**
          * <p>Describes the data feed for Spot instances. For more information, see <a
          * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/spot-data-feeds.html">Spot
@@ -5456,6 +6825,11 @@ namespace Model
          */
         virtual void DescribeSpotDatafeedSubscriptionAsync(const Model::DescribeSpotDatafeedSubscriptionRequest& request, const DescribeSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSpotDatafeedSubscriptionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSpotDatafeedSubscriptionAsync(Model::DescribeSpotDatafeedSubscriptionRequest&& request, const DescribeSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the running instances for the specified Spot fleet.</p>
          */
@@ -5468,6 +6842,11 @@ namespace Model
          */
         virtual Model::DescribeSpotFleetInstancesOutcomeCallable DescribeSpotFleetInstancesCallable(const Model::DescribeSpotFleetInstancesRequest& request) const;
 
+        /**
+         * Same as DescribeSpotFleetInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSpotFleetInstancesOutcomeCallable DescribeSpotFleetInstancesCallable(Model::DescribeSpotFleetInstancesRequest&& request) const;
+
         /**
          * <p>Describes the running instances for the specified Spot fleet.</p>
          *
@@ -5475,6 +6854,11 @@ namespace Model
          */
         virtual void DescribeSpotFleetInstancesAsync(const Model::DescribeSpotFleetInstancesRequest& request, const DescribeSpotFleetInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSpotFleetInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSpotFleetInstancesAsync(Model::DescribeSpotFleetInstancesRequest&& request, const DescribeSpotFleetInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the events for the specified Spot fleet request during the
          * specified time.</p> <p>Spot fleet events are delayed by up to 30 seconds before
@@ -5493,6 +6877,11 @@ namespace Model
          */
         virtual Model::DescribeSpotFleetRequestHistoryOutcomeCallable DescribeSpotFleetRequestHistoryCallable(const Model::DescribeSpotFleetRequestHistoryRequest& request) const;
 
+        /**
+         * Same as DescribeSpotFleetRequestHistoryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSpotFleetRequestHistoryOutcomeCallable DescribeSpotFleetRequestHistoryCallable(Model::DescribeSpotFleetRequestHistoryRequest&& request) const;
+
         /**
          * <p>Describes the events for the specified Spot fleet request during the
          * specified time.</p> <p>Spot fleet events are delayed by up to 30 seconds before
@@ -5503,6 +6892,11 @@ namespace Model
          */
         virtual void DescribeSpotFleetRequestHistoryAsync(const Model::DescribeSpotFleetRequestHistoryRequest& request, const DescribeSpotFleetRequestHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSpotFleetRequestHistoryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSpotFleetRequestHistoryAsync(Model::DescribeSpotFleetRequestHistoryRequest&& request, const DescribeSpotFleetRequestHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes your Spot fleet requests.</p>
          */
@@ -5515,6 +6909,11 @@ namespace Model
          */
         virtual Model::DescribeSpotFleetRequestsOutcomeCallable DescribeSpotFleetRequestsCallable(const Model::DescribeSpotFleetRequestsRequest& request) const;
 
+        /**
+         * Same as DescribeSpotFleetRequestsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSpotFleetRequestsOutcomeCallable DescribeSpotFleetRequestsCallable(Model::DescribeSpotFleetRequestsRequest&& request) const;
+
         /**
          * <p>Describes your Spot fleet requests.</p>
          *
@@ -5522,6 +6921,11 @@ namespace Model
          */
         virtual void DescribeSpotFleetRequestsAsync(const Model::DescribeSpotFleetRequestsRequest& request, const DescribeSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSpotFleetRequestsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSpotFleetRequestsAsync(Model::DescribeSpotFleetRequestsRequest&& request, const DescribeSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the Spot instance requests that belong to your account. Spot
          * instances are instances that Amazon EC2 launches when the bid price that you
@@ -5558,6 +6962,11 @@ namespace Model
          */
         virtual Model::DescribeSpotInstanceRequestsOutcomeCallable DescribeSpotInstanceRequestsCallable(const Model::DescribeSpotInstanceRequestsRequest& request) const;
 
+        /**
+         * Same as DescribeSpotInstanceRequestsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSpotInstanceRequestsOutcomeCallable DescribeSpotInstanceRequestsCallable(Model::DescribeSpotInstanceRequestsRequest&& request) const;
+
         /**
          * <p>Describes the Spot instance requests that belong to your account. Spot
          * instances are instances that Amazon EC2 launches when the bid price that you
@@ -5577,6 +6986,11 @@ namespace Model
          */
         virtual void DescribeSpotInstanceRequestsAsync(const Model::DescribeSpotInstanceRequestsRequest& request, const DescribeSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSpotInstanceRequestsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSpotInstanceRequestsAsync(Model::DescribeSpotInstanceRequestsRequest&& request, const DescribeSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the Spot price history. The prices returned are listed in
          * chronological order, from the oldest to the most recent, for up to the past 90
@@ -5607,6 +7021,11 @@ namespace Model
          */
         virtual Model::DescribeSpotPriceHistoryOutcomeCallable DescribeSpotPriceHistoryCallable(const Model::DescribeSpotPriceHistoryRequest& request) const;
 
+        /**
+         * Same as DescribeSpotPriceHistoryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSpotPriceHistoryOutcomeCallable DescribeSpotPriceHistoryCallable(Model::DescribeSpotPriceHistoryRequest&& request) const;
+
         /**
          * <p>Describes the Spot price history. The prices returned are listed in
          * chronological order, from the oldest to the most recent, for up to the past 90
@@ -5623,6 +7042,11 @@ namespace Model
          */
         virtual void DescribeSpotPriceHistoryAsync(const Model::DescribeSpotPriceHistoryRequest& request, const DescribeSpotPriceHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSpotPriceHistoryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSpotPriceHistoryAsync(Model::DescribeSpotPriceHistoryRequest&& request, const DescribeSpotPriceHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your subnets.</p> <p>For more information about
          * subnets, see <a
@@ -5641,6 +7065,11 @@ namespace Model
          */
         virtual Model::DescribeSubnetsOutcomeCallable DescribeSubnetsCallable(const Model::DescribeSubnetsRequest& request) const;
 
+        /**
+         * Same as DescribeSubnetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSubnetsOutcomeCallable DescribeSubnetsCallable(Model::DescribeSubnetsRequest&& request) const;
+
         /**
          * <p>Describes one or more of your subnets.</p> <p>For more information about
          * subnets, see <a
@@ -5651,6 +7080,11 @@ namespace Model
          */
         virtual void DescribeSubnetsAsync(const Model::DescribeSubnetsRequest& request, const DescribeSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSubnetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSubnetsAsync(Model::DescribeSubnetsRequest&& request, const DescribeSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of the tags for your EC2 resources.</p> <p>For more
          * information about tags, see <a
@@ -5669,6 +7103,11 @@ namespace Model
          */
         virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(const Model::DescribeTagsRequest& request) const;
 
+        /**
+         * Same as DescribeTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(Model::DescribeTagsRequest&& request) const;
+
         /**
          * <p>Describes one or more of the tags for your EC2 resources.</p> <p>For more
          * information about tags, see <a
@@ -5679,6 +7118,11 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTagsAsync(Model::DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified attribute of the specified volume. You can specify
          * only one attribute at a time.</p> <p>For more information about EBS volumes, see
@@ -5699,6 +7143,11 @@ namespace Model
          */
         virtual Model::DescribeVolumeAttributeOutcomeCallable DescribeVolumeAttributeCallable(const Model::DescribeVolumeAttributeRequest& request) const;
 
+        /**
+         * Same as DescribeVolumeAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVolumeAttributeOutcomeCallable DescribeVolumeAttributeCallable(Model::DescribeVolumeAttributeRequest&& request) const;
+
         /**
          * <p>Describes the specified attribute of the specified volume. You can specify
          * only one attribute at a time.</p> <p>For more information about EBS volumes, see
@@ -5710,6 +7159,11 @@ namespace Model
          */
         virtual void DescribeVolumeAttributeAsync(const Model::DescribeVolumeAttributeRequest& request, const DescribeVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVolumeAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVolumeAttributeAsync(Model::DescribeVolumeAttributeRequest&& request, const DescribeVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the status of the specified volumes. Volume status provides the
          * result of the checks performed on your volumes to determine events that can
@@ -5784,6 +7238,11 @@ namespace Model
          */
         virtual Model::DescribeVolumeStatusOutcomeCallable DescribeVolumeStatusCallable(const Model::DescribeVolumeStatusRequest& request) const;
 
+        /**
+         * Same as DescribeVolumeStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVolumeStatusOutcomeCallable DescribeVolumeStatusCallable(Model::DescribeVolumeStatusRequest&& request) const;
+
         /**
          * <p>Describes the status of the specified volumes. Volume status provides the
          * result of the checks performed on your volumes to determine events that can
@@ -5822,6 +7281,11 @@ namespace Model
          */
         virtual void DescribeVolumeStatusAsync(const Model::DescribeVolumeStatusRequest& request, const DescribeVolumeStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVolumeStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVolumeStatusAsync(Model::DescribeVolumeStatusRequest&& request, const DescribeVolumeStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified EBS volumes.</p> <p>If you are describing a long list
          * of volumes, you can paginate the output to make the list more manageable. The
@@ -5852,6 +7316,11 @@ namespace Model
          */
         virtual Model::DescribeVolumesOutcomeCallable DescribeVolumesCallable(const Model::DescribeVolumesRequest& request) const;
 
+        /**
+         * Same as DescribeVolumesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVolumesOutcomeCallable DescribeVolumesCallable(Model::DescribeVolumesRequest&& request) const;
+
         /**
          * <p>Describes the specified EBS volumes.</p> <p>If you are describing a long list
          * of volumes, you can paginate the output to make the list more manageable. The
@@ -5868,6 +7337,11 @@ namespace Model
          */
         virtual void DescribeVolumesAsync(const Model::DescribeVolumesRequest& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVolumesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVolumesAsync(Model::DescribeVolumesRequest&& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified attribute of the specified VPC. You can specify only
          * one attribute at a time.</p>
@@ -5882,6 +7356,11 @@ namespace Model
          */
         virtual Model::DescribeVpcAttributeOutcomeCallable DescribeVpcAttributeCallable(const Model::DescribeVpcAttributeRequest& request) const;
 
+        /**
+         * Same as DescribeVpcAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVpcAttributeOutcomeCallable DescribeVpcAttributeCallable(Model::DescribeVpcAttributeRequest&& request) const;
+
         /**
          * <p>Describes the specified attribute of the specified VPC. You can specify only
          * one attribute at a time.</p>
@@ -5890,6 +7369,11 @@ namespace Model
          */
         virtual void DescribeVpcAttributeAsync(const Model::DescribeVpcAttributeRequest& request, const DescribeVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpcAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVpcAttributeAsync(Model::DescribeVpcAttributeRequest&& request, const DescribeVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the ClassicLink status of one or more VPCs. </p>
          */
@@ -5902,6 +7386,11 @@ namespace Model
          */
         virtual Model::DescribeVpcClassicLinkOutcomeCallable DescribeVpcClassicLinkCallable(const Model::DescribeVpcClassicLinkRequest& request) const;
 
+        /**
+         * Same as DescribeVpcClassicLinkCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVpcClassicLinkOutcomeCallable DescribeVpcClassicLinkCallable(Model::DescribeVpcClassicLinkRequest&& request) const;
+
         /**
          * <p>Describes the ClassicLink status of one or more VPCs. </p>
          *
@@ -5909,6 +7398,11 @@ namespace Model
          */
         virtual void DescribeVpcClassicLinkAsync(const Model::DescribeVpcClassicLinkRequest& request, const DescribeVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpcClassicLinkAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVpcClassicLinkAsync(Model::DescribeVpcClassicLinkRequest&& request, const DescribeVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the ClassicLink DNS support status of one or more VPCs. If enabled,
          * the DNS hostname of a linked EC2-Classic instance resolves to its private IP
@@ -5935,6 +7429,11 @@ namespace Model
          */
         virtual Model::DescribeVpcClassicLinkDnsSupportOutcomeCallable DescribeVpcClassicLinkDnsSupportCallable(const Model::DescribeVpcClassicLinkDnsSupportRequest& request) const;
 
+        /**
+         * Same as DescribeVpcClassicLinkDnsSupportCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVpcClassicLinkDnsSupportOutcomeCallable DescribeVpcClassicLinkDnsSupportCallable(Model::DescribeVpcClassicLinkDnsSupportRequest&& request) const;
+
         /**
          * <p>Describes the ClassicLink DNS support status of one or more VPCs. If enabled,
          * the DNS hostname of a linked EC2-Classic instance resolves to its private IP
@@ -5949,6 +7448,11 @@ namespace Model
          */
         virtual void DescribeVpcClassicLinkDnsSupportAsync(const Model::DescribeVpcClassicLinkDnsSupportRequest& request, const DescribeVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpcClassicLinkDnsSupportAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVpcClassicLinkDnsSupportAsync(Model::DescribeVpcClassicLinkDnsSupportRequest&& request, const DescribeVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes all supported AWS services that can be specified when creating a
          * VPC endpoint.</p>
@@ -5963,6 +7467,11 @@ namespace Model
          */
         virtual Model::DescribeVpcEndpointServicesOutcomeCallable DescribeVpcEndpointServicesCallable(const Model::DescribeVpcEndpointServicesRequest& request) const;
 
+        /**
+         * Same as DescribeVpcEndpointServicesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVpcEndpointServicesOutcomeCallable DescribeVpcEndpointServicesCallable(Model::DescribeVpcEndpointServicesRequest&& request) const;
+
         /**
          * <p>Describes all supported AWS services that can be specified when creating a
          * VPC endpoint.</p>
@@ -5971,6 +7480,11 @@ namespace Model
          */
         virtual void DescribeVpcEndpointServicesAsync(const Model::DescribeVpcEndpointServicesRequest& request, const DescribeVpcEndpointServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpcEndpointServicesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVpcEndpointServicesAsync(Model::DescribeVpcEndpointServicesRequest&& request, const DescribeVpcEndpointServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your VPC endpoints.</p>
          */
@@ -5983,6 +7497,11 @@ namespace Model
          */
         virtual Model::DescribeVpcEndpointsOutcomeCallable DescribeVpcEndpointsCallable(const Model::DescribeVpcEndpointsRequest& request) const;
 
+        /**
+         * Same as DescribeVpcEndpointsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVpcEndpointsOutcomeCallable DescribeVpcEndpointsCallable(Model::DescribeVpcEndpointsRequest&& request) const;
+
         /**
          * <p>Describes one or more of your VPC endpoints.</p>
          *
@@ -5990,6 +7509,11 @@ namespace Model
          */
         virtual void DescribeVpcEndpointsAsync(const Model::DescribeVpcEndpointsRequest& request, const DescribeVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpcEndpointsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVpcEndpointsAsync(Model::DescribeVpcEndpointsRequest&& request, const DescribeVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your VPC peering connections.</p>
          */
@@ -6002,6 +7526,11 @@ namespace Model
          */
         virtual Model::DescribeVpcPeeringConnectionsOutcomeCallable DescribeVpcPeeringConnectionsCallable(const Model::DescribeVpcPeeringConnectionsRequest& request) const;
 
+        /**
+         * Same as DescribeVpcPeeringConnectionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVpcPeeringConnectionsOutcomeCallable DescribeVpcPeeringConnectionsCallable(Model::DescribeVpcPeeringConnectionsRequest&& request) const;
+
         /**
          * <p>Describes one or more of your VPC peering connections.</p>
          *
@@ -6009,6 +7538,11 @@ namespace Model
          */
         virtual void DescribeVpcPeeringConnectionsAsync(const Model::DescribeVpcPeeringConnectionsRequest& request, const DescribeVpcPeeringConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpcPeeringConnectionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVpcPeeringConnectionsAsync(Model::DescribeVpcPeeringConnectionsRequest&& request, const DescribeVpcPeeringConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your VPCs.</p>
          */
@@ -6021,6 +7555,11 @@ namespace Model
          */
         virtual Model::DescribeVpcsOutcomeCallable DescribeVpcsCallable(const Model::DescribeVpcsRequest& request) const;
 
+        /**
+         * Same as DescribeVpcsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVpcsOutcomeCallable DescribeVpcsCallable(Model::DescribeVpcsRequest&& request) const;
+
         /**
          * <p>Describes one or more of your VPCs.</p>
          *
@@ -6028,6 +7567,11 @@ namespace Model
          */
         virtual void DescribeVpcsAsync(const Model::DescribeVpcsRequest& request, const DescribeVpcsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpcsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVpcsAsync(Model::DescribeVpcsRequest&& request, const DescribeVpcsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your VPN connections.</p> <p>For more information
          * about VPN connections, see <a
@@ -6048,6 +7592,11 @@ namespace Model
          */
         virtual Model::DescribeVpnConnectionsOutcomeCallable DescribeVpnConnectionsCallable(const Model::DescribeVpnConnectionsRequest& request) const;
 
+        /**
+         * Same as DescribeVpnConnectionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVpnConnectionsOutcomeCallable DescribeVpnConnectionsCallable(Model::DescribeVpnConnectionsRequest&& request) const;
+
         /**
          * <p>Describes one or more of your VPN connections.</p> <p>For more information
          * about VPN connections, see <a
@@ -6059,6 +7608,11 @@ namespace Model
          */
         virtual void DescribeVpnConnectionsAsync(const Model::DescribeVpnConnectionsRequest& request, const DescribeVpnConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpnConnectionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVpnConnectionsAsync(Model::DescribeVpnConnectionsRequest&& request, const DescribeVpnConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your virtual private gateways.</p> <p>For more
          * information about virtual private gateways, see <a
@@ -6079,6 +7633,11 @@ namespace Model
          */
         virtual Model::DescribeVpnGatewaysOutcomeCallable DescribeVpnGatewaysCallable(const Model::DescribeVpnGatewaysRequest& request) const;
 
+        /**
+         * Same as DescribeVpnGatewaysCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVpnGatewaysOutcomeCallable DescribeVpnGatewaysCallable(Model::DescribeVpnGatewaysRequest&& request) const;
+
         /**
          * <p>Describes one or more of your virtual private gateways.</p> <p>For more
          * information about virtual private gateways, see <a
@@ -6090,6 +7649,11 @@ namespace Model
          */
         virtual void DescribeVpnGatewaysAsync(const Model::DescribeVpnGatewaysRequest& request, const DescribeVpnGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVpnGatewaysAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVpnGatewaysAsync(Model::DescribeVpnGatewaysRequest&& request, const DescribeVpnGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Unlinks (detaches) a linked EC2-Classic instance from a VPC. After the
          * instance has been unlinked, the VPC security groups are no longer associated
@@ -6106,6 +7670,11 @@ namespace Model
          */
         virtual Model::DetachClassicLinkVpcOutcomeCallable DetachClassicLinkVpcCallable(const Model::DetachClassicLinkVpcRequest& request) const;
 
+        /**
+         * Same as DetachClassicLinkVpcCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachClassicLinkVpcOutcomeCallable DetachClassicLinkVpcCallable(Model::DetachClassicLinkVpcRequest&& request) const;
+
         /**
          * <p>Unlinks (detaches) a linked EC2-Classic instance from a VPC. After the
          * instance has been unlinked, the VPC security groups are no longer associated
@@ -6115,6 +7684,11 @@ namespace Model
          */
         virtual void DetachClassicLinkVpcAsync(const Model::DetachClassicLinkVpcRequest& request, const DetachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachClassicLinkVpcAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachClassicLinkVpcAsync(Model::DetachClassicLinkVpcRequest&& request, const DetachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches an Internet gateway from a VPC, disabling connectivity between the
          * Internet and the VPC. The VPC must not contain any running instances with
@@ -6131,6 +7705,11 @@ namespace Model
          */
         virtual Model::DetachInternetGatewayOutcomeCallable DetachInternetGatewayCallable(const Model::DetachInternetGatewayRequest& request) const;
 
+        /**
+         * Same as DetachInternetGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachInternetGatewayOutcomeCallable DetachInternetGatewayCallable(Model::DetachInternetGatewayRequest&& request) const;
+
         /**
          * <p>Detaches an Internet gateway from a VPC, disabling connectivity between the
          * Internet and the VPC. The VPC must not contain any running instances with
@@ -6140,6 +7719,11 @@ namespace Model
          */
         virtual void DetachInternetGatewayAsync(const Model::DetachInternetGatewayRequest& request, const DetachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachInternetGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachInternetGatewayAsync(Model::DetachInternetGatewayRequest&& request, const DetachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches a network interface from an instance.</p>
          */
@@ -6152,6 +7736,11 @@ namespace Model
          */
         virtual Model::DetachNetworkInterfaceOutcomeCallable DetachNetworkInterfaceCallable(const Model::DetachNetworkInterfaceRequest& request) const;
 
+        /**
+         * Same as DetachNetworkInterfaceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachNetworkInterfaceOutcomeCallable DetachNetworkInterfaceCallable(Model::DetachNetworkInterfaceRequest&& request) const;
+
         /**
          * <p>Detaches a network interface from an instance.</p>
          *
@@ -6159,6 +7748,11 @@ namespace Model
          */
         virtual void DetachNetworkInterfaceAsync(const Model::DetachNetworkInterfaceRequest& request, const DetachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachNetworkInterfaceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachNetworkInterfaceAsync(Model::DetachNetworkInterfaceRequest&& request, const DetachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches an EBS volume from an instance. Make sure to unmount any file
          * systems on the device within your operating system before detaching the volume.
@@ -6191,6 +7785,11 @@ namespace Model
          */
         virtual Model::DetachVolumeOutcomeCallable DetachVolumeCallable(const Model::DetachVolumeRequest& request) const;
 
+        /**
+         * Same as DetachVolumeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachVolumeOutcomeCallable DetachVolumeCallable(Model::DetachVolumeRequest&& request) const;
+
         /**
          * <p>Detaches an EBS volume from an instance. Make sure to unmount any file
          * systems on the device within your operating system before detaching the volume.
@@ -6208,6 +7807,11 @@ namespace Model
          */
         virtual void DetachVolumeAsync(const Model::DetachVolumeRequest& request, const DetachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachVolumeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachVolumeAsync(Model::DetachVolumeRequest&& request, const DetachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches a virtual private gateway from a VPC. You do this if you're planning
          * to turn off the VPC and not use it anymore. You can confirm a virtual private
@@ -6232,6 +7836,11 @@ namespace Model
          */
         virtual Model::DetachVpnGatewayOutcomeCallable DetachVpnGatewayCallable(const Model::DetachVpnGatewayRequest& request) const;
 
+        /**
+         * Same as DetachVpnGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachVpnGatewayOutcomeCallable DetachVpnGatewayCallable(Model::DetachVpnGatewayRequest&& request) const;
+
         /**
          * <p>Detaches a virtual private gateway from a VPC. You do this if you're planning
          * to turn off the VPC and not use it anymore. You can confirm a virtual private
@@ -6245,6 +7854,11 @@ namespace Model
          */
         virtual void DetachVpnGatewayAsync(const Model::DetachVpnGatewayRequest& request, const DetachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachVpnGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachVpnGatewayAsync(Model::DetachVpnGatewayRequest&& request, const DetachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables a virtual private gateway (VGW) from propagating routes to a
          * specified route table of a VPC.</p>
@@ -6259,6 +7873,11 @@ namespace Model
          */
         virtual Model::DisableVgwRoutePropagationOutcomeCallable DisableVgwRoutePropagationCallable(const Model::DisableVgwRoutePropagationRequest& request) const;
 
+        /**
+         * Same as DisableVgwRoutePropagationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableVgwRoutePropagationOutcomeCallable DisableVgwRoutePropagationCallable(Model::DisableVgwRoutePropagationRequest&& request) const;
+
         /**
          * <p>Disables a virtual private gateway (VGW) from propagating routes to a
          * specified route table of a VPC.</p>
@@ -6267,6 +7886,11 @@ namespace Model
          */
         virtual void DisableVgwRoutePropagationAsync(const Model::DisableVgwRoutePropagationRequest& request, const DisableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableVgwRoutePropagationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableVgwRoutePropagationAsync(Model::DisableVgwRoutePropagationRequest&& request, const DisableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables ClassicLink for a VPC. You cannot disable ClassicLink for a VPC that
          * has EC2-Classic instances linked to it.</p>
@@ -6281,6 +7905,11 @@ namespace Model
          */
         virtual Model::DisableVpcClassicLinkOutcomeCallable DisableVpcClassicLinkCallable(const Model::DisableVpcClassicLinkRequest& request) const;
 
+        /**
+         * Same as DisableVpcClassicLinkCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableVpcClassicLinkOutcomeCallable DisableVpcClassicLinkCallable(Model::DisableVpcClassicLinkRequest&& request) const;
+
         /**
          * <p>Disables ClassicLink for a VPC. You cannot disable ClassicLink for a VPC that
          * has EC2-Classic instances linked to it.</p>
@@ -6289,6 +7918,11 @@ namespace Model
          */
         virtual void DisableVpcClassicLinkAsync(const Model::DisableVpcClassicLinkRequest& request, const DisableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableVpcClassicLinkAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableVpcClassicLinkAsync(Model::DisableVpcClassicLinkRequest&& request, const DisableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables ClassicLink DNS support for a VPC. If disabled, DNS hostnames
          * resolve to public IP addresses when addressed between a linked EC2-Classic
@@ -6311,6 +7945,11 @@ namespace Model
          */
         virtual Model::DisableVpcClassicLinkDnsSupportOutcomeCallable DisableVpcClassicLinkDnsSupportCallable(const Model::DisableVpcClassicLinkDnsSupportRequest& request) const;
 
+        /**
+         * Same as DisableVpcClassicLinkDnsSupportCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableVpcClassicLinkDnsSupportOutcomeCallable DisableVpcClassicLinkDnsSupportCallable(Model::DisableVpcClassicLinkDnsSupportRequest&& request) const;
+
         /**
          * <p>Disables ClassicLink DNS support for a VPC. If disabled, DNS hostnames
          * resolve to public IP addresses when addressed between a linked EC2-Classic
@@ -6323,6 +7962,11 @@ namespace Model
          */
         virtual void DisableVpcClassicLinkDnsSupportAsync(const Model::DisableVpcClassicLinkDnsSupportRequest& request, const DisableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableVpcClassicLinkDnsSupportAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableVpcClassicLinkDnsSupportAsync(Model::DisableVpcClassicLinkDnsSupportRequest&& request, const DisableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disassociates an Elastic IP address from the instance or network interface
          * it's associated with.</p> <p>An Elastic IP address is for use in either the
@@ -6347,6 +7991,11 @@ namespace Model
          */
         virtual Model::DisassociateAddressOutcomeCallable DisassociateAddressCallable(const Model::DisassociateAddressRequest& request) const;
 
+        /**
+         * Same as DisassociateAddressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisassociateAddressOutcomeCallable DisassociateAddressCallable(Model::DisassociateAddressRequest&& request) const;
+
         /**
          * <p>Disassociates an Elastic IP address from the instance or network interface
          * it's associated with.</p> <p>An Elastic IP address is for use in either the
@@ -6360,6 +8009,11 @@ namespace Model
          */
         virtual void DisassociateAddressAsync(const Model::DisassociateAddressRequest& request, const DisassociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisassociateAddressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisassociateAddressAsync(Model::DisassociateAddressRequest&& request, const DisassociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disassociates a subnet from a route table.</p> <p>After you perform this
          * action, the subnet no longer uses the routes in the route table. Instead, it
@@ -6382,6 +8036,11 @@ namespace Model
          */
         virtual Model::DisassociateRouteTableOutcomeCallable DisassociateRouteTableCallable(const Model::DisassociateRouteTableRequest& request) const;
 
+        /**
+         * Same as DisassociateRouteTableCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisassociateRouteTableOutcomeCallable DisassociateRouteTableCallable(Model::DisassociateRouteTableRequest&& request) const;
+
         /**
          * <p>Disassociates a subnet from a route table.</p> <p>After you perform this
          * action, the subnet no longer uses the routes in the route table. Instead, it
@@ -6394,6 +8053,11 @@ namespace Model
          */
         virtual void DisassociateRouteTableAsync(const Model::DisassociateRouteTableRequest& request, const DisassociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisassociateRouteTableAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisassociateRouteTableAsync(Model::DisassociateRouteTableRequest&& request, const DisassociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables a virtual private gateway (VGW) to propagate routes to the specified
          * route table of a VPC.</p>
@@ -6408,6 +8072,11 @@ namespace Model
          */
         virtual Model::EnableVgwRoutePropagationOutcomeCallable EnableVgwRoutePropagationCallable(const Model::EnableVgwRoutePropagationRequest& request) const;
 
+        /**
+         * Same as EnableVgwRoutePropagationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableVgwRoutePropagationOutcomeCallable EnableVgwRoutePropagationCallable(Model::EnableVgwRoutePropagationRequest&& request) const;
+
         /**
          * <p>Enables a virtual private gateway (VGW) to propagate routes to the specified
          * route table of a VPC.</p>
@@ -6416,6 +8085,11 @@ namespace Model
          */
         virtual void EnableVgwRoutePropagationAsync(const Model::EnableVgwRoutePropagationRequest& request, const EnableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableVgwRoutePropagationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableVgwRoutePropagationAsync(Model::EnableVgwRoutePropagationRequest&& request, const EnableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables I/O operations for a volume that had I/O operations disabled because
          * the data on the volume was potentially inconsistent.</p>
@@ -6430,6 +8104,11 @@ namespace Model
          */
         virtual Model::EnableVolumeIOOutcomeCallable EnableVolumeIOCallable(const Model::EnableVolumeIORequest& request) const;
 
+        /**
+         * Same as EnableVolumeIOCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableVolumeIOOutcomeCallable EnableVolumeIOCallable(Model::EnableVolumeIORequest&& request) const;
+
         /**
          * <p>Enables I/O operations for a volume that had I/O operations disabled because
          * the data on the volume was potentially inconsistent.</p>
@@ -6438,6 +8117,11 @@ namespace Model
          */
         virtual void EnableVolumeIOAsync(const Model::EnableVolumeIORequest& request, const EnableVolumeIOResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableVolumeIOAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableVolumeIOAsync(Model::EnableVolumeIORequest&& request, const EnableVolumeIOResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables a VPC for ClassicLink. You can then link EC2-Classic instances to
          * your ClassicLink-enabled VPC to allow communication over private IP addresses.
@@ -6464,6 +8148,11 @@ namespace Model
          */
         virtual Model::EnableVpcClassicLinkOutcomeCallable EnableVpcClassicLinkCallable(const Model::EnableVpcClassicLinkRequest& request) const;
 
+        /**
+         * Same as EnableVpcClassicLinkCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableVpcClassicLinkOutcomeCallable EnableVpcClassicLinkCallable(Model::EnableVpcClassicLinkRequest&& request) const;
+
         /**
          * <p>Enables a VPC for ClassicLink. You can then link EC2-Classic instances to
          * your ClassicLink-enabled VPC to allow communication over private IP addresses.
@@ -6478,6 +8167,11 @@ namespace Model
          */
         virtual void EnableVpcClassicLinkAsync(const Model::EnableVpcClassicLinkRequest& request, const EnableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableVpcClassicLinkAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableVpcClassicLinkAsync(Model::EnableVpcClassicLinkRequest&& request, const EnableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables a VPC to support DNS hostname resolution for ClassicLink. If enabled,
          * the DNS hostname of a linked EC2-Classic instance resolves to its private IP
@@ -6504,6 +8198,11 @@ namespace Model
          */
         virtual Model::EnableVpcClassicLinkDnsSupportOutcomeCallable EnableVpcClassicLinkDnsSupportCallable(const Model::EnableVpcClassicLinkDnsSupportRequest& request) const;
 
+        /**
+         * Same as EnableVpcClassicLinkDnsSupportCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableVpcClassicLinkDnsSupportOutcomeCallable EnableVpcClassicLinkDnsSupportCallable(Model::EnableVpcClassicLinkDnsSupportRequest&& request) const;
+
         /**
          * <p>Enables a VPC to support DNS hostname resolution for ClassicLink. If enabled,
          * the DNS hostname of a linked EC2-Classic instance resolves to its private IP
@@ -6518,6 +8217,11 @@ namespace Model
          */
         virtual void EnableVpcClassicLinkDnsSupportAsync(const Model::EnableVpcClassicLinkDnsSupportRequest& request, const EnableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableVpcClassicLinkDnsSupportAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableVpcClassicLinkDnsSupportAsync(Model::EnableVpcClassicLinkDnsSupportRequest&& request, const EnableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the console output for the specified instance.</p> <p>Instances do not
          * have a physical monitor through which you can view their console output. They
@@ -6554,6 +8258,11 @@ namespace Model
          */
         virtual Model::GetConsoleOutputOutcomeCallable GetConsoleOutputCallable(const Model::GetConsoleOutputRequest& request) const;
 
+        /**
+         * Same as GetConsoleOutputCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetConsoleOutputOutcomeCallable GetConsoleOutputCallable(Model::GetConsoleOutputRequest&& request) const;
+
         /**
          * <p>Gets the console output for the specified instance.</p> <p>Instances do not
          * have a physical monitor through which you can view their console output. They
@@ -6573,6 +8282,11 @@ namespace Model
          */
         virtual void GetConsoleOutputAsync(const Model::GetConsoleOutputRequest& request, const GetConsoleOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetConsoleOutputAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetConsoleOutputAsync(Model::GetConsoleOutputRequest&& request, const GetConsoleOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the encrypted administrator password for an instance running
          * Windows.</p> <p>The Windows password is generated at boot if the
@@ -6605,6 +8319,11 @@ namespace Model
          */
         virtual Model::GetPasswordDataOutcomeCallable GetPasswordDataCallable(const Model::GetPasswordDataRequest& request) const;
 
+        /**
+         * Same as GetPasswordDataCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetPasswordDataOutcomeCallable GetPasswordDataCallable(Model::GetPasswordDataRequest&& request) const;
+
         /**
          * <p>Retrieves the encrypted administrator password for an instance running
          * Windows.</p> <p>The Windows password is generated at boot if the
@@ -6622,6 +8341,11 @@ namespace Model
          */
         virtual void GetPasswordDataAsync(const Model::GetPasswordDataRequest& request, const GetPasswordDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPasswordDataAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetPasswordDataAsync(Model::GetPasswordDataRequest&& request, const GetPasswordDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Import single or multi-volume disk images or EBS snapshots into an Amazon
          * Machine Image (AMI).</p>
@@ -6636,6 +8360,11 @@ namespace Model
          */
         virtual Model::ImportImageOutcomeCallable ImportImageCallable(const Model::ImportImageRequest& request) const;
 
+        /**
+         * Same as ImportImageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ImportImageOutcomeCallable ImportImageCallable(Model::ImportImageRequest&& request) const;
+
         /**
          * <p>Import single or multi-volume disk images or EBS snapshots into an Amazon
          * Machine Image (AMI).</p>
@@ -6644,6 +8373,11 @@ namespace Model
          */
         virtual void ImportImageAsync(const Model::ImportImageRequest& request, const ImportImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ImportImageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ImportImageAsync(Model::ImportImageRequest&& request, const ImportImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an import instance task using metadata from the specified disk image.
          * <code>ImportInstance</code> only supports single-volume VMs. To import
@@ -6676,6 +8410,11 @@ namespace Model
          */
         virtual Model::ImportInstanceOutcomeCallable ImportInstanceCallable(const Model::ImportInstanceRequest& request) const;
 
+        /**
+         * Same as ImportInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ImportInstanceOutcomeCallable ImportInstanceCallable(Model::ImportInstanceRequest&& request) const;
+
         /**
          * <p>Creates an import instance task using metadata from the specified disk image.
          * <code>ImportInstance</code> only supports single-volume VMs. To import
@@ -6693,6 +8432,11 @@ namespace Model
          */
         virtual void ImportInstanceAsync(const Model::ImportInstanceRequest& request, const ImportInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ImportInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ImportInstanceAsync(Model::ImportInstanceRequest&& request, const ImportInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Imports the public key from an RSA key pair that you created with a
          * third-party tool. Compare this with <a>CreateKeyPair</a>, in which AWS creates
@@ -6719,6 +8463,11 @@ namespace Model
          */
         virtual Model::ImportKeyPairOutcomeCallable ImportKeyPairCallable(const Model::ImportKeyPairRequest& request) const;
 
+        /**
+         * Same as ImportKeyPairCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ImportKeyPairOutcomeCallable ImportKeyPairCallable(Model::ImportKeyPairRequest&& request) const;
+
         /**
          * <p>Imports the public key from an RSA key pair that you created with a
          * third-party tool. Compare this with <a>CreateKeyPair</a>, in which AWS creates
@@ -6733,6 +8482,11 @@ namespace Model
          */
         virtual void ImportKeyPairAsync(const Model::ImportKeyPairRequest& request, const ImportKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ImportKeyPairAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ImportKeyPairAsync(Model::ImportKeyPairRequest&& request, const ImportKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Imports a disk into an EBS snapshot.</p>
          */
@@ -6745,6 +8499,11 @@ namespace Model
          */
         virtual Model::ImportSnapshotOutcomeCallable ImportSnapshotCallable(const Model::ImportSnapshotRequest& request) const;
 
+        /**
+         * Same as ImportSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ImportSnapshotOutcomeCallable ImportSnapshotCallable(Model::ImportSnapshotRequest&& request) const;
+
         /**
          * <p>Imports a disk into an EBS snapshot.</p>
          *
@@ -6752,6 +8511,11 @@ namespace Model
          */
         virtual void ImportSnapshotAsync(const Model::ImportSnapshotRequest& request, const ImportSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ImportSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ImportSnapshotAsync(Model::ImportSnapshotRequest&& request, const ImportSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an import volume task using metadata from the specified disk image.
          * After importing the image, you then upload it using the
@@ -6782,6 +8546,11 @@ namespace Model
          */
         virtual Model::ImportVolumeOutcomeCallable ImportVolumeCallable(const Model::ImportVolumeRequest& request) const;
 
+        /**
+         * Same as ImportVolumeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ImportVolumeOutcomeCallable ImportVolumeCallable(Model::ImportVolumeRequest&& request) const;
+
         /**
          * <p>Creates an import volume task using metadata from the specified disk image.
          * After importing the image, you then upload it using the
@@ -6798,6 +8567,11 @@ namespace Model
          */
         virtual void ImportVolumeAsync(const Model::ImportVolumeRequest& request, const ImportVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ImportVolumeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ImportVolumeAsync(Model::ImportVolumeRequest&& request, const ImportVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modify the auto-placement setting of a Dedicated host. When auto-placement is
          * enabled, AWS will place instances that you launch with a tenancy of
@@ -6822,6 +8596,11 @@ namespace Model
          */
         virtual Model::ModifyHostsOutcomeCallable ModifyHostsCallable(const Model::ModifyHostsRequest& request) const;
 
+        /**
+         * Same as ModifyHostsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyHostsOutcomeCallable ModifyHostsCallable(Model::ModifyHostsRequest&& request) const;
+
         /**
          * <p>Modify the auto-placement setting of a Dedicated host. When auto-placement is
          * enabled, AWS will place instances that you launch with a tenancy of
@@ -6835,6 +8614,11 @@ namespace Model
          */
         virtual void ModifyHostsAsync(const Model::ModifyHostsRequest& request, const ModifyHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyHostsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyHostsAsync(Model::ModifyHostsRequest&& request, const ModifyHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the ID format for the specified resource on a per-region basis. You
          * can specify that resources should receive longer IDs (17-character IDs) when
@@ -6875,6 +8659,11 @@ namespace Model
          */
         virtual Model::ModifyIdFormatOutcomeCallable ModifyIdFormatCallable(const Model::ModifyIdFormatRequest& request) const;
 
+        /**
+         * Same as ModifyIdFormatCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyIdFormatOutcomeCallable ModifyIdFormatCallable(Model::ModifyIdFormatRequest&& request) const;
+
         /**
          * <p>Modifies the ID format for the specified resource on a per-region basis. You
          * can specify that resources should receive longer IDs (17-character IDs) when
@@ -6896,6 +8685,11 @@ namespace Model
          */
         virtual void ModifyIdFormatAsync(const Model::ModifyIdFormatRequest& request, const ModifyIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyIdFormatAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyIdFormatAsync(Model::ModifyIdFormatRequest&& request, const ModifyIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified attribute of the specified AMI. You can specify only
          * one attribute at a time.</p> <note><p>AWS Marketplace product codes cannot be
@@ -6914,6 +8708,11 @@ namespace Model
          */
         virtual Model::ModifyImageAttributeOutcomeCallable ModifyImageAttributeCallable(const Model::ModifyImageAttributeRequest& request) const;
 
+        /**
+         * Same as ModifyImageAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyImageAttributeOutcomeCallable ModifyImageAttributeCallable(Model::ModifyImageAttributeRequest&& request) const;
+
         /**
          * <p>Modifies the specified attribute of the specified AMI. You can specify only
          * one attribute at a time.</p> <note><p>AWS Marketplace product codes cannot be
@@ -6924,6 +8723,11 @@ namespace Model
          */
         virtual void ModifyImageAttributeAsync(const Model::ModifyImageAttributeRequest& request, const ModifyImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyImageAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyImageAttributeAsync(Model::ModifyImageAttributeRequest&& request, const ModifyImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified attribute of the specified instance. You can specify
          * only one attribute at a time.</p> <p>To modify some attributes, the instance
@@ -6946,6 +8750,11 @@ namespace Model
          */
         virtual Model::ModifyInstanceAttributeOutcomeCallable ModifyInstanceAttributeCallable(const Model::ModifyInstanceAttributeRequest& request) const;
 
+        /**
+         * Same as ModifyInstanceAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyInstanceAttributeOutcomeCallable ModifyInstanceAttributeCallable(Model::ModifyInstanceAttributeRequest&& request) const;
+
         /**
          * <p>Modifies the specified attribute of the specified instance. You can specify
          * only one attribute at a time.</p> <p>To modify some attributes, the instance
@@ -6958,6 +8767,11 @@ namespace Model
          */
         virtual void ModifyInstanceAttributeAsync(const Model::ModifyInstanceAttributeRequest& request, const ModifyInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyInstanceAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyInstanceAttributeAsync(Model::ModifyInstanceAttributeRequest&& request, const ModifyInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Set the instance affinity value for a specific stopped instance and modify
          * the instance tenancy setting.</p> <p>Instance affinity is disabled by default.
@@ -6994,6 +8808,11 @@ namespace Model
          */
         virtual Model::ModifyInstancePlacementOutcomeCallable ModifyInstancePlacementCallable(const Model::ModifyInstancePlacementRequest& request) const;
 
+        /**
+         * Same as ModifyInstancePlacementCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyInstancePlacementOutcomeCallable ModifyInstancePlacementCallable(Model::ModifyInstancePlacementRequest&& request) const;
+
         /**
          * <p>Set the instance affinity value for a specific stopped instance and modify
          * the instance tenancy setting.</p> <p>Instance affinity is disabled by default.
@@ -7013,6 +8832,11 @@ namespace Model
          */
         virtual void ModifyInstancePlacementAsync(const Model::ModifyInstancePlacementRequest& request, const ModifyInstancePlacementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyInstancePlacementAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyInstancePlacementAsync(Model::ModifyInstancePlacementRequest&& request, const ModifyInstancePlacementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified network interface attribute. You can specify only one
          * attribute at a time.</p>
@@ -7027,6 +8851,11 @@ namespace Model
          */
         virtual Model::ModifyNetworkInterfaceAttributeOutcomeCallable ModifyNetworkInterfaceAttributeCallable(const Model::ModifyNetworkInterfaceAttributeRequest& request) const;
 
+        /**
+         * Same as ModifyNetworkInterfaceAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyNetworkInterfaceAttributeOutcomeCallable ModifyNetworkInterfaceAttributeCallable(Model::ModifyNetworkInterfaceAttributeRequest&& request) const;
+
         /**
          * <p>Modifies the specified network interface attribute. You can specify only one
          * attribute at a time.</p>
@@ -7035,6 +8864,11 @@ namespace Model
          */
         virtual void ModifyNetworkInterfaceAttributeAsync(const Model::ModifyNetworkInterfaceAttributeRequest& request, const ModifyNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyNetworkInterfaceAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyNetworkInterfaceAttributeAsync(Model::ModifyNetworkInterfaceAttributeRequest&& request, const ModifyNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the Availability Zone, instance count, instance type, or network
          * platform (EC2-Classic or EC2-VPC) of your Reserved Instances. The Reserved
@@ -7057,6 +8891,11 @@ namespace Model
          */
         virtual Model::ModifyReservedInstancesOutcomeCallable ModifyReservedInstancesCallable(const Model::ModifyReservedInstancesRequest& request) const;
 
+        /**
+         * Same as ModifyReservedInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyReservedInstancesOutcomeCallable ModifyReservedInstancesCallable(Model::ModifyReservedInstancesRequest&& request) const;
+
         /**
          * <p>Modifies the Availability Zone, instance count, instance type, or network
          * platform (EC2-Classic or EC2-VPC) of your Reserved Instances. The Reserved
@@ -7069,6 +8908,11 @@ namespace Model
          */
         virtual void ModifyReservedInstancesAsync(const Model::ModifyReservedInstancesRequest& request, const ModifyReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyReservedInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyReservedInstancesAsync(Model::ModifyReservedInstancesRequest&& request, const ModifyReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds or removes permission settings for the specified snapshot. You may add
          * or remove specified AWS account IDs from a snapshot's list of create volume
@@ -7097,6 +8941,11 @@ namespace Model
          */
         virtual Model::ModifySnapshotAttributeOutcomeCallable ModifySnapshotAttributeCallable(const Model::ModifySnapshotAttributeRequest& request) const;
 
+        /**
+         * Same as ModifySnapshotAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifySnapshotAttributeOutcomeCallable ModifySnapshotAttributeCallable(Model::ModifySnapshotAttributeRequest&& request) const;
+
         /**
          * <p>Adds or removes permission settings for the specified snapshot. You may add
          * or remove specified AWS account IDs from a snapshot's list of create volume
@@ -7112,6 +8961,11 @@ namespace Model
          */
         virtual void ModifySnapshotAttributeAsync(const Model::ModifySnapshotAttributeRequest& request, const ModifySnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifySnapshotAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifySnapshotAttributeAsync(Model::ModifySnapshotAttributeRequest&& request, const ModifySnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified Spot fleet request.</p> <p>While the Spot fleet
          * request is being modified, it is in the <code>modifying</code> state.</p> <p>To
@@ -7156,6 +9010,11 @@ namespace Model
          */
         virtual Model::ModifySpotFleetRequestOutcomeCallable ModifySpotFleetRequestCallable(const Model::ModifySpotFleetRequestRequest& request) const;
 
+        /**
+         * Same as ModifySpotFleetRequestCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifySpotFleetRequestOutcomeCallable ModifySpotFleetRequestCallable(Model::ModifySpotFleetRequestRequest&& request) const;
+
         /**
          * <p>Modifies the specified Spot fleet request.</p> <p>While the Spot fleet
          * request is being modified, it is in the <code>modifying</code> state.</p> <p>To
@@ -7179,6 +9038,11 @@ namespace Model
          */
         virtual void ModifySpotFleetRequestAsync(const Model::ModifySpotFleetRequestRequest& request, const ModifySpotFleetRequestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifySpotFleetRequestAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifySpotFleetRequestAsync(Model::ModifySpotFleetRequestRequest&& request, const ModifySpotFleetRequestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies a subnet attribute.</p>
          */
@@ -7191,6 +9055,11 @@ namespace Model
          */
         virtual Model::ModifySubnetAttributeOutcomeCallable ModifySubnetAttributeCallable(const Model::ModifySubnetAttributeRequest& request) const;
 
+        /**
+         * Same as ModifySubnetAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifySubnetAttributeOutcomeCallable ModifySubnetAttributeCallable(Model::ModifySubnetAttributeRequest&& request) const;
+
         /**
          * <p>Modifies a subnet attribute.</p>
          *
@@ -7198,6 +9067,11 @@ namespace Model
          */
         virtual void ModifySubnetAttributeAsync(const Model::ModifySubnetAttributeRequest& request, const ModifySubnetAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifySubnetAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifySubnetAttributeAsync(Model::ModifySubnetAttributeRequest&& request, const ModifySubnetAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies a volume attribute.</p> <p>By default, all I/O operations for the
          * volume are suspended when the data on the volume is determined to be potentially
@@ -7222,6 +9096,11 @@ namespace Model
          */
         virtual Model::ModifyVolumeAttributeOutcomeCallable ModifyVolumeAttributeCallable(const Model::ModifyVolumeAttributeRequest& request) const;
 
+        /**
+         * Same as ModifyVolumeAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyVolumeAttributeOutcomeCallable ModifyVolumeAttributeCallable(Model::ModifyVolumeAttributeRequest&& request) const;
+
         /**
          * <p>Modifies a volume attribute.</p> <p>By default, all I/O operations for the
          * volume are suspended when the data on the volume is determined to be potentially
@@ -7235,6 +9114,11 @@ namespace Model
          */
         virtual void ModifyVolumeAttributeAsync(const Model::ModifyVolumeAttributeRequest& request, const ModifyVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyVolumeAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyVolumeAttributeAsync(Model::ModifyVolumeAttributeRequest&& request, const ModifyVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the specified attribute of the specified VPC.</p>
          */
@@ -7247,6 +9131,11 @@ namespace Model
          */
         virtual Model::ModifyVpcAttributeOutcomeCallable ModifyVpcAttributeCallable(const Model::ModifyVpcAttributeRequest& request) const;
 
+        /**
+         * Same as ModifyVpcAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyVpcAttributeOutcomeCallable ModifyVpcAttributeCallable(Model::ModifyVpcAttributeRequest&& request) const;
+
         /**
          * <p>Modifies the specified attribute of the specified VPC.</p>
          *
@@ -7254,6 +9143,11 @@ namespace Model
          */
         virtual void ModifyVpcAttributeAsync(const Model::ModifyVpcAttributeRequest& request, const ModifyVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyVpcAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyVpcAttributeAsync(Model::ModifyVpcAttributeRequest&& request, const ModifyVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies attributes of a specified VPC endpoint. You can modify the policy
          * associated with the endpoint, and you can add and remove route tables associated
@@ -7270,6 +9164,11 @@ namespace Model
          */
         virtual Model::ModifyVpcEndpointOutcomeCallable ModifyVpcEndpointCallable(const Model::ModifyVpcEndpointRequest& request) const;
 
+        /**
+         * Same as ModifyVpcEndpointCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyVpcEndpointOutcomeCallable ModifyVpcEndpointCallable(Model::ModifyVpcEndpointRequest&& request) const;
+
         /**
          * <p>Modifies attributes of a specified VPC endpoint. You can modify the policy
          * associated with the endpoint, and you can add and remove route tables associated
@@ -7279,6 +9178,11 @@ namespace Model
          */
         virtual void ModifyVpcEndpointAsync(const Model::ModifyVpcEndpointRequest& request, const ModifyVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyVpcEndpointAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyVpcEndpointAsync(Model::ModifyVpcEndpointRequest&& request, const ModifyVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables monitoring for a running instance. For more information about
          * monitoring instances, see <a
@@ -7299,6 +9203,11 @@ namespace Model
          */
         virtual Model::MonitorInstancesOutcomeCallable MonitorInstancesCallable(const Model::MonitorInstancesRequest& request) const;
 
+        /**
+         * Same as MonitorInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::MonitorInstancesOutcomeCallable MonitorInstancesCallable(Model::MonitorInstancesRequest&& request) const;
+
         /**
          * <p>Enables monitoring for a running instance. For more information about
          * monitoring instances, see <a
@@ -7310,6 +9219,11 @@ namespace Model
          */
         virtual void MonitorInstancesAsync(const Model::MonitorInstancesRequest& request, const MonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as MonitorInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void MonitorInstancesAsync(Model::MonitorInstancesRequest&& request, const MonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Moves an Elastic IP address from the EC2-Classic platform to the EC2-VPC
          * platform. The Elastic IP address must be allocated to your account for more than
@@ -7338,6 +9252,11 @@ namespace Model
          */
         virtual Model::MoveAddressToVpcOutcomeCallable MoveAddressToVpcCallable(const Model::MoveAddressToVpcRequest& request) const;
 
+        /**
+         * Same as MoveAddressToVpcCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::MoveAddressToVpcOutcomeCallable MoveAddressToVpcCallable(Model::MoveAddressToVpcRequest&& request) const;
+
         /**
          * <p>Moves an Elastic IP address from the EC2-Classic platform to the EC2-VPC
          * platform. The Elastic IP address must be allocated to your account for more than
@@ -7353,6 +9272,11 @@ namespace Model
          */
         virtual void MoveAddressToVpcAsync(const Model::MoveAddressToVpcRequest& request, const MoveAddressToVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as MoveAddressToVpcAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void MoveAddressToVpcAsync(Model::MoveAddressToVpcRequest&& request, const MoveAddressToVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Purchases a Reserved Instance for use with your account. With Reserved
          * Instances, you obtain a capacity reservation for a certain instance
@@ -7389,6 +9313,11 @@ namespace Model
          */
         virtual Model::PurchaseReservedInstancesOfferingOutcomeCallable PurchaseReservedInstancesOfferingCallable(const Model::PurchaseReservedInstancesOfferingRequest& request) const;
 
+        /**
+         * Same as PurchaseReservedInstancesOfferingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PurchaseReservedInstancesOfferingOutcomeCallable PurchaseReservedInstancesOfferingCallable(Model::PurchaseReservedInstancesOfferingRequest&& request) const;
+
         /**
          * <p>Purchases a Reserved Instance for use with your account. With Reserved
          * Instances, you obtain a capacity reservation for a certain instance
@@ -7408,6 +9337,11 @@ namespace Model
          */
         virtual void PurchaseReservedInstancesOfferingAsync(const Model::PurchaseReservedInstancesOfferingRequest& request, const PurchaseReservedInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PurchaseReservedInstancesOfferingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PurchaseReservedInstancesOfferingAsync(Model::PurchaseReservedInstancesOfferingRequest&& request, const PurchaseReservedInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Purchases one or more Scheduled Instances with the specified schedule.</p>
          * <p>Scheduled Instances enable you to purchase Amazon EC2 compute capacity by the
@@ -7428,6 +9362,11 @@ namespace Model
          */
         virtual Model::PurchaseScheduledInstancesOutcomeCallable PurchaseScheduledInstancesCallable(const Model::PurchaseScheduledInstancesRequest& request) const;
 
+        /**
+         * Same as PurchaseScheduledInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PurchaseScheduledInstancesOutcomeCallable PurchaseScheduledInstancesCallable(Model::PurchaseScheduledInstancesRequest&& request) const;
+
         /**
          * <p>Purchases one or more Scheduled Instances with the specified schedule.</p>
          * <p>Scheduled Instances enable you to purchase Amazon EC2 compute capacity by the
@@ -7439,6 +9378,11 @@ namespace Model
          */
         virtual void PurchaseScheduledInstancesAsync(const Model::PurchaseScheduledInstancesRequest& request, const PurchaseScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PurchaseScheduledInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PurchaseScheduledInstancesAsync(Model::PurchaseScheduledInstancesRequest&& request, const PurchaseScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a reboot of one or more instances. This operation is asynchronous;
          * it only queues a request to reboot the specified instances. The operation
@@ -7467,6 +9411,11 @@ namespace Model
          */
         virtual Model::RebootInstancesOutcomeCallable RebootInstancesCallable(const Model::RebootInstancesRequest& request) const;
 
+        /**
+         * Same as RebootInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RebootInstancesOutcomeCallable RebootInstancesCallable(Model::RebootInstancesRequest&& request) const;
+
         /**
          * <p>Requests a reboot of one or more instances. This operation is asynchronous;
          * it only queues a request to reboot the specified instances. The operation
@@ -7482,6 +9431,11 @@ namespace Model
          */
         virtual void RebootInstancesAsync(const Model::RebootInstancesRequest& request, const RebootInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebootInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RebootInstancesAsync(Model::RebootInstancesRequest&& request, const RebootInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers an AMI. When you're creating an AMI, this is the final step you
          * must complete before you can launch an instance from the AMI. For more
@@ -7546,6 +9500,11 @@ namespace Model
          */
         virtual Model::RegisterImageOutcomeCallable RegisterImageCallable(const Model::RegisterImageRequest& request) const;
 
+        /**
+         * Same as RegisterImageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterImageOutcomeCallable RegisterImageCallable(Model::RegisterImageRequest&& request) const;
+
         /**
          * <p>Registers an AMI. When you're creating an AMI, this is the final step you
          * must complete before you can launch an instance from the AMI. For more
@@ -7579,6 +9538,11 @@ namespace Model
          */
         virtual void RegisterImageAsync(const Model::RegisterImageRequest& request, const RegisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterImageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterImageAsync(Model::RegisterImageRequest&& request, const RegisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Rejects a VPC peering connection request. The VPC peering connection must be
          * in the <code>pending-acceptance</code> state. Use the
@@ -7601,6 +9565,11 @@ namespace Model
          */
         virtual Model::RejectVpcPeeringConnectionOutcomeCallable RejectVpcPeeringConnectionCallable(const Model::RejectVpcPeeringConnectionRequest& request) const;
 
+        /**
+         * Same as RejectVpcPeeringConnectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RejectVpcPeeringConnectionOutcomeCallable RejectVpcPeeringConnectionCallable(Model::RejectVpcPeeringConnectionRequest&& request) const;
+
         /**
          * <p>Rejects a VPC peering connection request. The VPC peering connection must be
          * in the <code>pending-acceptance</code> state. Use the
@@ -7613,6 +9582,11 @@ namespace Model
          */
         virtual void RejectVpcPeeringConnectionAsync(const Model::RejectVpcPeeringConnectionRequest& request, const RejectVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RejectVpcPeeringConnectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RejectVpcPeeringConnectionAsync(Model::RejectVpcPeeringConnectionRequest&& request, const RejectVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Releases the specified Elastic IP address.</p> <p>After releasing an Elastic
          * IP address, it is released to the IP address pool and might be unavailable to
@@ -7647,6 +9621,11 @@ namespace Model
          */
         virtual Model::ReleaseAddressOutcomeCallable ReleaseAddressCallable(const Model::ReleaseAddressRequest& request) const;
 
+        /**
+         * Same as ReleaseAddressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReleaseAddressOutcomeCallable ReleaseAddressCallable(Model::ReleaseAddressRequest&& request) const;
+
         /**
          * <p>Releases the specified Elastic IP address.</p> <p>After releasing an Elastic
          * IP address, it is released to the IP address pool and might be unavailable to
@@ -7665,6 +9644,11 @@ namespace Model
          */
         virtual void ReleaseAddressAsync(const Model::ReleaseAddressRequest& request, const ReleaseAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReleaseAddressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReleaseAddressAsync(Model::ReleaseAddressRequest&& request, const ReleaseAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>When you no longer want to use a Dedicated host it can be released. On-Demand
          * billing is stopped and the host goes into <code>released</code> state. The host
@@ -7693,6 +9677,11 @@ namespace Model
          */
         virtual Model::ReleaseHostsOutcomeCallable ReleaseHostsCallable(const Model::ReleaseHostsRequest& request) const;
 
+        /**
+         * Same as ReleaseHostsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReleaseHostsOutcomeCallable ReleaseHostsCallable(Model::ReleaseHostsRequest&& request) const;
+
         /**
          * <p>When you no longer want to use a Dedicated host it can be released. On-Demand
          * billing is stopped and the host goes into <code>released</code> state. The host
@@ -7708,6 +9697,11 @@ namespace Model
          */
         virtual void ReleaseHostsAsync(const Model::ReleaseHostsRequest& request, const ReleaseHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReleaseHostsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReleaseHostsAsync(Model::ReleaseHostsRequest&& request, const ReleaseHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes which network ACL a subnet is associated with. By default when you
          * create a subnet, it's automatically associated with the default network ACL. For
@@ -7728,6 +9722,11 @@ namespace Model
          */
         virtual Model::ReplaceNetworkAclAssociationOutcomeCallable ReplaceNetworkAclAssociationCallable(const Model::ReplaceNetworkAclAssociationRequest& request) const;
 
+        /**
+         * Same as ReplaceNetworkAclAssociationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReplaceNetworkAclAssociationOutcomeCallable ReplaceNetworkAclAssociationCallable(Model::ReplaceNetworkAclAssociationRequest&& request) const;
+
         /**
          * <p>Changes which network ACL a subnet is associated with. By default when you
          * create a subnet, it's automatically associated with the default network ACL. For
@@ -7739,6 +9738,11 @@ namespace Model
          */
         virtual void ReplaceNetworkAclAssociationAsync(const Model::ReplaceNetworkAclAssociationRequest& request, const ReplaceNetworkAclAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReplaceNetworkAclAssociationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReplaceNetworkAclAssociationAsync(Model::ReplaceNetworkAclAssociationRequest&& request, const ReplaceNetworkAclAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Replaces an entry (rule) in a network ACL. For more information about network
          * ACLs, see <a
@@ -7757,6 +9761,11 @@ namespace Model
          */
         virtual Model::ReplaceNetworkAclEntryOutcomeCallable ReplaceNetworkAclEntryCallable(const Model::ReplaceNetworkAclEntryRequest& request) const;
 
+        /**
+         * Same as ReplaceNetworkAclEntryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReplaceNetworkAclEntryOutcomeCallable ReplaceNetworkAclEntryCallable(Model::ReplaceNetworkAclEntryRequest&& request) const;
+
         /**
          * <p>Replaces an entry (rule) in a network ACL. For more information about network
          * ACLs, see <a
@@ -7767,6 +9776,11 @@ namespace Model
          */
         virtual void ReplaceNetworkAclEntryAsync(const Model::ReplaceNetworkAclEntryRequest& request, const ReplaceNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReplaceNetworkAclEntryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReplaceNetworkAclEntryAsync(Model::ReplaceNetworkAclEntryRequest&& request, const ReplaceNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Replaces an existing route within a route table in a VPC. You must provide
          * only one of the following: Internet gateway or virtual private gateway, NAT
@@ -7789,6 +9803,11 @@ namespace Model
          */
         virtual Model::ReplaceRouteOutcomeCallable ReplaceRouteCallable(const Model::ReplaceRouteRequest& request) const;
 
+        /**
+         * Same as ReplaceRouteCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReplaceRouteOutcomeCallable ReplaceRouteCallable(Model::ReplaceRouteRequest&& request) const;
+
         /**
          * <p>Replaces an existing route within a route table in a VPC. You must provide
          * only one of the following: Internet gateway or virtual private gateway, NAT
@@ -7801,6 +9820,11 @@ namespace Model
          */
         virtual void ReplaceRouteAsync(const Model::ReplaceRouteRequest& request, const ReplaceRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReplaceRouteAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReplaceRouteAsync(Model::ReplaceRouteRequest&& request, const ReplaceRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the route table associated with a given subnet in a VPC. After the
          * operation completes, the subnet uses the routes in the new route table it's
@@ -7827,6 +9851,11 @@ namespace Model
          */
         virtual Model::ReplaceRouteTableAssociationOutcomeCallable ReplaceRouteTableAssociationCallable(const Model::ReplaceRouteTableAssociationRequest& request) const;
 
+        /**
+         * Same as ReplaceRouteTableAssociationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReplaceRouteTableAssociationOutcomeCallable ReplaceRouteTableAssociationCallable(Model::ReplaceRouteTableAssociationRequest&& request) const;
+
         /**
          * <p>Changes the route table associated with a given subnet in a VPC. After the
          * operation completes, the subnet uses the routes in the new route table it's
@@ -7841,6 +9870,11 @@ namespace Model
          */
         virtual void ReplaceRouteTableAssociationAsync(const Model::ReplaceRouteTableAssociationRequest& request, const ReplaceRouteTableAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReplaceRouteTableAssociationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReplaceRouteTableAssociationAsync(Model::ReplaceRouteTableAssociationRequest&& request, const ReplaceRouteTableAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Submits feedback about the status of an instance. The instance must be in the
          * <code>running</code> state. If your experience with the instance differs from
@@ -7865,6 +9899,11 @@ namespace Model
          */
         virtual Model::ReportInstanceStatusOutcomeCallable ReportInstanceStatusCallable(const Model::ReportInstanceStatusRequest& request) const;
 
+        /**
+         * Same as ReportInstanceStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReportInstanceStatusOutcomeCallable ReportInstanceStatusCallable(Model::ReportInstanceStatusRequest&& request) const;
+
         /**
          * <p>Submits feedback about the status of an instance. The instance must be in the
          * <code>running</code> state. If your experience with the instance differs from
@@ -7878,6 +9917,11 @@ namespace Model
          */
         virtual void ReportInstanceStatusAsync(const Model::ReportInstanceStatusRequest& request, const ReportInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReportInstanceStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReportInstanceStatusAsync(Model::ReportInstanceStatusRequest&& request, const ReportInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a Spot fleet request.</p> <p>You can submit a single request that
          * includes multiple launch specifications that vary by instance type, AMI,
@@ -7912,6 +9956,11 @@ namespace Model
          */
         virtual Model::RequestSpotFleetOutcomeCallable RequestSpotFleetCallable(const Model::RequestSpotFleetRequest& request) const;
 
+        /**
+         * Same as RequestSpotFleetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RequestSpotFleetOutcomeCallable RequestSpotFleetCallable(Model::RequestSpotFleetRequest&& request) const;
+
         /**
          * <p>Creates a Spot fleet request.</p> <p>You can submit a single request that
          * includes multiple launch specifications that vary by instance type, AMI,
@@ -7930,6 +9979,11 @@ namespace Model
          */
         virtual void RequestSpotFleetAsync(const Model::RequestSpotFleetRequest& request, const RequestSpotFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RequestSpotFleetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RequestSpotFleetAsync(Model::RequestSpotFleetRequest&& request, const RequestSpotFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a Spot instance request. Spot instances are instances that Amazon EC2
          * launches when the bid price that you specify exceeds the current Spot price.
@@ -7952,6 +10006,11 @@ namespace Model
          */
         virtual Model::RequestSpotInstancesOutcomeCallable RequestSpotInstancesCallable(const Model::RequestSpotInstancesRequest& request) const;
 
+        /**
+         * Same as RequestSpotInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RequestSpotInstancesOutcomeCallable RequestSpotInstancesCallable(Model::RequestSpotInstancesRequest&& request) const;
+
         /**
          * <p>Creates a Spot instance request. Spot instances are instances that Amazon EC2
          * launches when the bid price that you specify exceeds the current Spot price.
@@ -7964,6 +10023,11 @@ namespace Model
          */
         virtual void RequestSpotInstancesAsync(const Model::RequestSpotInstancesRequest& request, const RequestSpotInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RequestSpotInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RequestSpotInstancesAsync(Model::RequestSpotInstancesRequest&& request, const RequestSpotInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Resets an attribute of an AMI to its default value.</p> <note><p> The
          * productCodes attribute can't be reset. </p></note>
@@ -7978,6 +10042,11 @@ namespace Model
          */
         virtual Model::ResetImageAttributeOutcomeCallable ResetImageAttributeCallable(const Model::ResetImageAttributeRequest& request) const;
 
+        /**
+         * Same as ResetImageAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ResetImageAttributeOutcomeCallable ResetImageAttributeCallable(Model::ResetImageAttributeRequest&& request) const;
+
         /**
          * <p>Resets an attribute of an AMI to its default value.</p> <note><p> The
          * productCodes attribute can't be reset. </p></note>
@@ -7986,6 +10055,11 @@ namespace Model
          */
         virtual void ResetImageAttributeAsync(const Model::ResetImageAttributeRequest& request, const ResetImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetImageAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ResetImageAttributeAsync(Model::ResetImageAttributeRequest&& request, const ResetImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Resets an attribute of an instance to its default value. To reset the
          * <code>kernel</code> or <code>ramdisk</code>, the instance must be in a stopped
@@ -8016,6 +10090,11 @@ namespace Model
          */
         virtual Model::ResetInstanceAttributeOutcomeCallable ResetInstanceAttributeCallable(const Model::ResetInstanceAttributeRequest& request) const;
 
+        /**
+         * Same as ResetInstanceAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ResetInstanceAttributeOutcomeCallable ResetInstanceAttributeCallable(Model::ResetInstanceAttributeRequest&& request) const;
+
         /**
          * <p>Resets an attribute of an instance to its default value. To reset the
          * <code>kernel</code> or <code>ramdisk</code>, the instance must be in a stopped
@@ -8032,6 +10111,11 @@ namespace Model
          */
         virtual void ResetInstanceAttributeAsync(const Model::ResetInstanceAttributeRequest& request, const ResetInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetInstanceAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ResetInstanceAttributeAsync(Model::ResetInstanceAttributeRequest&& request, const ResetInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Resets a network interface attribute. You can specify only one attribute at a
          * time.</p>
@@ -8046,6 +10130,11 @@ namespace Model
          */
         virtual Model::ResetNetworkInterfaceAttributeOutcomeCallable ResetNetworkInterfaceAttributeCallable(const Model::ResetNetworkInterfaceAttributeRequest& request) const;
 
+        /**
+         * Same as ResetNetworkInterfaceAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ResetNetworkInterfaceAttributeOutcomeCallable ResetNetworkInterfaceAttributeCallable(Model::ResetNetworkInterfaceAttributeRequest&& request) const;
+
         /**
          * <p>Resets a network interface attribute. You can specify only one attribute at a
          * time.</p>
@@ -8054,6 +10143,11 @@ namespace Model
          */
         virtual void ResetNetworkInterfaceAttributeAsync(const Model::ResetNetworkInterfaceAttributeRequest& request, const ResetNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetNetworkInterfaceAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ResetNetworkInterfaceAttributeAsync(Model::ResetNetworkInterfaceAttributeRequest&& request, const ResetNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Resets permission settings for the specified snapshot.</p> <p>For more
          * information on modifying snapshot permissions, see <a
@@ -8072,6 +10166,11 @@ namespace Model
          */
         virtual Model::ResetSnapshotAttributeOutcomeCallable ResetSnapshotAttributeCallable(const Model::ResetSnapshotAttributeRequest& request) const;
 
+        /**
+         * Same as ResetSnapshotAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ResetSnapshotAttributeOutcomeCallable ResetSnapshotAttributeCallable(Model::ResetSnapshotAttributeRequest&& request) const;
+
         /**
          * <p>Resets permission settings for the specified snapshot.</p> <p>For more
          * information on modifying snapshot permissions, see <a
@@ -8082,6 +10181,11 @@ namespace Model
          */
         virtual void ResetSnapshotAttributeAsync(const Model::ResetSnapshotAttributeRequest& request, const ResetSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetSnapshotAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ResetSnapshotAttributeAsync(Model::ResetSnapshotAttributeRequest&& request, const ResetSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Restores an Elastic IP address that was previously moved to the EC2-VPC
          * platform back to the EC2-Classic platform. You cannot move an Elastic IP address
@@ -8104,6 +10208,11 @@ namespace Model
          */
         virtual Model::RestoreAddressToClassicOutcomeCallable RestoreAddressToClassicCallable(const Model::RestoreAddressToClassicRequest& request) const;
 
+        /**
+         * Same as RestoreAddressToClassicCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RestoreAddressToClassicOutcomeCallable RestoreAddressToClassicCallable(Model::RestoreAddressToClassicRequest&& request) const;
+
         /**
          * <p>Restores an Elastic IP address that was previously moved to the EC2-VPC
          * platform back to the EC2-Classic platform. You cannot move an Elastic IP address
@@ -8116,6 +10225,11 @@ namespace Model
          */
         virtual void RestoreAddressToClassicAsync(const Model::RestoreAddressToClassicRequest& request, const RestoreAddressToClassicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreAddressToClassicAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RestoreAddressToClassicAsync(Model::RestoreAddressToClassicRequest&& request, const RestoreAddressToClassicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>[EC2-VPC only] Removes one or more egress rules from a security group for
          * EC2-VPC. This action doesn't apply to security groups for use in EC2-Classic.
@@ -8144,6 +10258,11 @@ namespace Model
          */
         virtual Model::RevokeSecurityGroupEgressOutcomeCallable RevokeSecurityGroupEgressCallable(const Model::RevokeSecurityGroupEgressRequest& request) const;
 
+        /**
+         * Same as RevokeSecurityGroupEgressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RevokeSecurityGroupEgressOutcomeCallable RevokeSecurityGroupEgressCallable(Model::RevokeSecurityGroupEgressRequest&& request) const;
+
         /**
          * <p>[EC2-VPC only] Removes one or more egress rules from a security group for
          * EC2-VPC. This action doesn't apply to security groups for use in EC2-Classic.
@@ -8159,6 +10278,11 @@ namespace Model
          */
         virtual void RevokeSecurityGroupEgressAsync(const Model::RevokeSecurityGroupEgressRequest& request, const RevokeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RevokeSecurityGroupEgressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RevokeSecurityGroupEgressAsync(Model::RevokeSecurityGroupEgressRequest&& request, const RevokeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes one or more ingress rules from a security group. The values that you
          * specify in the revoke request (for example, ports) must match the existing
@@ -8185,6 +10309,11 @@ namespace Model
          */
         virtual Model::RevokeSecurityGroupIngressOutcomeCallable RevokeSecurityGroupIngressCallable(const Model::RevokeSecurityGroupIngressRequest& request) const;
 
+        /**
+         * Same as RevokeSecurityGroupIngressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RevokeSecurityGroupIngressOutcomeCallable RevokeSecurityGroupIngressCallable(Model::RevokeSecurityGroupIngressRequest&& request) const;
+
         /**
          * <p>Removes one or more ingress rules from a security group. The values that you
          * specify in the revoke request (for example, ports) must match the existing
@@ -8199,6 +10328,11 @@ namespace Model
          */
         virtual void RevokeSecurityGroupIngressAsync(const Model::RevokeSecurityGroupIngressRequest& request, const RevokeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RevokeSecurityGroupIngressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RevokeSecurityGroupIngressAsync(Model::RevokeSecurityGroupIngressRequest&& request, const RevokeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Launches the specified number of instances using an AMI for which you have
          * permissions.</p> <p>When you launch an instance, it enters the
@@ -8285,6 +10419,11 @@ namespace Model
          */
         virtual Model::RunInstancesOutcomeCallable RunInstancesCallable(const Model::RunInstancesRequest& request) const;
 
+        /**
+         * Same as RunInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RunInstancesOutcomeCallable RunInstancesCallable(Model::RunInstancesRequest&& request) const;
+
         /**
          * <p>Launches the specified number of instances using an AMI for which you have
          * permissions.</p> <p>When you launch an instance, it enters the
@@ -8329,6 +10468,11 @@ namespace Model
          */
         virtual void RunInstancesAsync(const Model::RunInstancesRequest& request, const RunInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RunInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RunInstancesAsync(Model::RunInstancesRequest&& request, const RunInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Launches the specified Scheduled Instances.</p> <p>Before you can launch a
          * Scheduled Instance, you must purchase it and obtain an identifier using
@@ -8353,6 +10497,11 @@ namespace Model
          */
         virtual Model::RunScheduledInstancesOutcomeCallable RunScheduledInstancesCallable(const Model::RunScheduledInstancesRequest& request) const;
 
+        /**
+         * Same as RunScheduledInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RunScheduledInstancesOutcomeCallable RunScheduledInstancesCallable(Model::RunScheduledInstancesRequest&& request) const;
+
         /**
          * <p>Launches the specified Scheduled Instances.</p> <p>Before you can launch a
          * Scheduled Instance, you must purchase it and obtain an identifier using
@@ -8366,6 +10515,11 @@ namespace Model
          */
         virtual void RunScheduledInstancesAsync(const Model::RunScheduledInstancesRequest& request, const RunScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RunScheduledInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RunScheduledInstancesAsync(Model::RunScheduledInstancesRequest&& request, const RunScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts an Amazon EBS-backed AMI that you've previously stopped.</p>
          * <p>Instances that use Amazon EBS volumes as their root devices can be quickly
@@ -8404,6 +10558,11 @@ namespace Model
          */
         virtual Model::StartInstancesOutcomeCallable StartInstancesCallable(const Model::StartInstancesRequest& request) const;
 
+        /**
+         * Same as StartInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StartInstancesOutcomeCallable StartInstancesCallable(Model::StartInstancesRequest&& request) const;
+
         /**
          * <p>Starts an Amazon EBS-backed AMI that you've previously stopped.</p>
          * <p>Instances that use Amazon EBS volumes as their root devices can be quickly
@@ -8424,6 +10583,11 @@ namespace Model
          */
         virtual void StartInstancesAsync(const Model::StartInstancesRequest& request, const StartInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StartInstancesAsync(Model::StartInstancesRequest&& request, const StartInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stops an Amazon EBS-backed instance. Each time you transition an instance
          * from stopped to started, Amazon EC2 charges a full instance hour, even if
@@ -8484,6 +10648,11 @@ namespace Model
          */
         virtual Model::StopInstancesOutcomeCallable StopInstancesCallable(const Model::StopInstancesRequest& request) const;
 
+        /**
+         * Same as StopInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StopInstancesOutcomeCallable StopInstancesCallable(Model::StopInstancesRequest&& request) const;
+
         /**
          * <p>Stops an Amazon EBS-backed instance. Each time you transition an instance
          * from stopped to started, Amazon EC2 charges a full instance hour, even if
@@ -8515,6 +10684,11 @@ namespace Model
          */
         virtual void StopInstancesAsync(const Model::StopInstancesRequest& request, const StopInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StopInstancesAsync(Model::StopInstancesRequest&& request, const StopInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Shuts down one or more instances. This operation is idempotent; if you
          * terminate an instance more than once, each call succeeds.</p> <p>Terminated
@@ -8563,6 +10737,11 @@ namespace Model
          */
         virtual Model::TerminateInstancesOutcomeCallable TerminateInstancesCallable(const Model::TerminateInstancesRequest& request) const;
 
+        /**
+         * Same as TerminateInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::TerminateInstancesOutcomeCallable TerminateInstancesCallable(Model::TerminateInstancesRequest&& request) const;
+
         /**
          * <p>Shuts down one or more instances. This operation is idempotent; if you
          * terminate an instance more than once, each call succeeds.</p> <p>Terminated
@@ -8588,6 +10767,11 @@ namespace Model
          */
         virtual void TerminateInstancesAsync(const Model::TerminateInstancesRequest& request, const TerminateInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TerminateInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void TerminateInstancesAsync(Model::TerminateInstancesRequest&& request, const TerminateInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Unassigns one or more secondary private IP addresses from a network
          * interface.</p>
@@ -8602,6 +10786,11 @@ namespace Model
          */
         virtual Model::UnassignPrivateIpAddressesOutcomeCallable UnassignPrivateIpAddressesCallable(const Model::UnassignPrivateIpAddressesRequest& request) const;
 
+        /**
+         * Same as UnassignPrivateIpAddressesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UnassignPrivateIpAddressesOutcomeCallable UnassignPrivateIpAddressesCallable(Model::UnassignPrivateIpAddressesRequest&& request) const;
+
         /**
          * <p>Unassigns one or more secondary private IP addresses from a network
          * interface.</p>
@@ -8610,6 +10799,11 @@ namespace Model
          */
         virtual void UnassignPrivateIpAddressesAsync(const Model::UnassignPrivateIpAddressesRequest& request, const UnassignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnassignPrivateIpAddressesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UnassignPrivateIpAddressesAsync(Model::UnassignPrivateIpAddressesRequest&& request, const UnassignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables monitoring for a running instance. For more information about
          * monitoring instances, see <a
@@ -8630,6 +10824,11 @@ namespace Model
          */
         virtual Model::UnmonitorInstancesOutcomeCallable UnmonitorInstancesCallable(const Model::UnmonitorInstancesRequest& request) const;
 
+        /**
+         * Same as UnmonitorInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UnmonitorInstancesOutcomeCallable UnmonitorInstancesCallable(Model::UnmonitorInstancesRequest&& request) const;
+
         /**
          * <p>Disables monitoring for a running instance. For more information about
          * monitoring instances, see <a
@@ -8641,6 +10840,418 @@ namespace Model
          */
         virtual void UnmonitorInstancesAsync(const Model::UnmonitorInstancesRequest& request, const UnmonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnmonitorInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UnmonitorInstancesAsync(Model::UnmonitorInstancesRequest&& request, const UnmonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AcceptVpcPeeringConnectionOutcome> AcceptVpcPeeringConnectionAwaitable(const Model::AcceptVpcPeeringConnectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AcceptVpcPeeringConnection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AcceptVpcPeeringConnectionOutcome> AcceptVpcPeeringConnectionAwaitable(Model::AcceptVpcPeeringConnectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AcceptVpcPeeringConnection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AllocateAddressOutcome> AllocateAddressAwaitable(const Model::AllocateAddressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AllocateAddress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AllocateAddressOutcome> AllocateAddressAwaitable(Model::AllocateAddressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AllocateAddress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AllocateHostsOutcome> AllocateHostsAwaitable(const Model::AllocateHostsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AllocateHosts, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AllocateHostsOutcome> AllocateHostsAwaitable(Model::AllocateHostsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AllocateHosts, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssignPrivateIpAddressesOutcome> AssignPrivateIpAddressesAwaitable(const Model::AssignPrivateIpAddressesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AssignPrivateIpAddresses, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssignPrivateIpAddressesOutcome> AssignPrivateIpAddressesAwaitable(Model::AssignPrivateIpAddressesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AssignPrivateIpAddresses, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssociateAddressOutcome> AssociateAddressAwaitable(const Model::AssociateAddressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AssociateAddress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssociateAddressOutcome> AssociateAddressAwaitable(Model::AssociateAddressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AssociateAddress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssociateDhcpOptionsOutcome> AssociateDhcpOptionsAwaitable(const Model::AssociateDhcpOptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AssociateDhcpOptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssociateDhcpOptionsOutcome> AssociateDhcpOptionsAwaitable(Model::AssociateDhcpOptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AssociateDhcpOptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssociateRouteTableOutcome> AssociateRouteTableAwaitable(const Model::AssociateRouteTableRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AssociateRouteTable, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssociateRouteTableOutcome> AssociateRouteTableAwaitable(Model::AssociateRouteTableRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AssociateRouteTable, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachClassicLinkVpcOutcome> AttachClassicLinkVpcAwaitable(const Model::AttachClassicLinkVpcRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AttachClassicLinkVpc, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachClassicLinkVpcOutcome> AttachClassicLinkVpcAwaitable(Model::AttachClassicLinkVpcRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AttachClassicLinkVpc, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachInternetGatewayOutcome> AttachInternetGatewayAwaitable(const Model::AttachInternetGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AttachInternetGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachInternetGatewayOutcome> AttachInternetGatewayAwaitable(Model::AttachInternetGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AttachInternetGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachNetworkInterfaceOutcome> AttachNetworkInterfaceAwaitable(const Model::AttachNetworkInterfaceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AttachNetworkInterface, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachNetworkInterfaceOutcome> AttachNetworkInterfaceAwaitable(Model::AttachNetworkInterfaceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AttachNetworkInterface, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachVolumeOutcome> AttachVolumeAwaitable(const Model::AttachVolumeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AttachVolume, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachVolumeOutcome> AttachVolumeAwaitable(Model::AttachVolumeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AttachVolume, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachVpnGatewayOutcome> AttachVpnGatewayAwaitable(const Model::AttachVpnGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AttachVpnGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachVpnGatewayOutcome> AttachVpnGatewayAwaitable(Model::AttachVpnGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AttachVpnGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AuthorizeSecurityGroupEgressOutcome> AuthorizeSecurityGroupEgressAwaitable(const Model::AuthorizeSecurityGroupEgressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AuthorizeSecurityGroupEgress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AuthorizeSecurityGroupEgressOutcome> AuthorizeSecurityGroupEgressAwaitable(Model::AuthorizeSecurityGroupEgressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AuthorizeSecurityGroupEgress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AuthorizeSecurityGroupIngressOutcome> AuthorizeSecurityGroupIngressAwaitable(const Model::AuthorizeSecurityGroupIngressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AuthorizeSecurityGroupIngress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AuthorizeSecurityGroupIngressOutcome> AuthorizeSecurityGroupIngressAwaitable(Model::AuthorizeSecurityGroupIngressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::AuthorizeSecurityGroupIngress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BundleInstanceOutcome> BundleInstanceAwaitable(const Model::BundleInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::BundleInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BundleInstanceOutcome> BundleInstanceAwaitable(Model::BundleInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::BundleInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelBundleTaskOutcome> CancelBundleTaskAwaitable(const Model::CancelBundleTaskRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CancelBundleTask, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelBundleTaskOutcome> CancelBundleTaskAwaitable(Model::CancelBundleTaskRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CancelBundleTask, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelConversionTaskOutcome> CancelConversionTaskAwaitable(const Model::CancelConversionTaskRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CancelConversionTask, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelConversionTaskOutcome> CancelConversionTaskAwaitable(Model::CancelConversionTaskRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CancelConversionTask, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelExportTaskOutcome> CancelExportTaskAwaitable(const Model::CancelExportTaskRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CancelExportTask, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelExportTaskOutcome> CancelExportTaskAwaitable(Model::CancelExportTaskRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CancelExportTask, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelImportTaskOutcome> CancelImportTaskAwaitable(const Model::CancelImportTaskRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CancelImportTask, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelImportTaskOutcome> CancelImportTaskAwaitable(Model::CancelImportTaskRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CancelImportTask, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelReservedInstancesListingOutcome> CancelReservedInstancesListingAwaitable(const Model::CancelReservedInstancesListingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CancelReservedInstancesListing, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelReservedInstancesListingOutcome> CancelReservedInstancesListingAwaitable(Model::CancelReservedInstancesListingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CancelReservedInstancesListing, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelSpotFleetRequestsOutcome> CancelSpotFleetRequestsAwaitable(const Model::CancelSpotFleetRequestsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CancelSpotFleetRequests, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelSpotFleetRequestsOutcome> CancelSpotFleetRequestsAwaitable(Model::CancelSpotFleetRequestsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CancelSpotFleetRequests, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelSpotInstanceRequestsOutcome> CancelSpotInstanceRequestsAwaitable(const Model::CancelSpotInstanceRequestsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CancelSpotInstanceRequests, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelSpotInstanceRequestsOutcome> CancelSpotInstanceRequestsAwaitable(Model::CancelSpotInstanceRequestsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CancelSpotInstanceRequests, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ConfirmProductInstanceOutcome> ConfirmProductInstanceAwaitable(const Model::ConfirmProductInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ConfirmProductInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ConfirmProductInstanceOutcome> ConfirmProductInstanceAwaitable(Model::ConfirmProductInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ConfirmProductInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopyImageOutcome> CopyImageAwaitable(const Model::CopyImageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CopyImage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopyImageOutcome> CopyImageAwaitable(Model::CopyImageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CopyImage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopySnapshotOutcome> CopySnapshotAwaitable(const Model::CopySnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CopySnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopySnapshotOutcome> CopySnapshotAwaitable(Model::CopySnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CopySnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCustomerGatewayOutcome> CreateCustomerGatewayAwaitable(const Model::CreateCustomerGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateCustomerGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCustomerGatewayOutcome> CreateCustomerGatewayAwaitable(Model::CreateCustomerGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateCustomerGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDhcpOptionsOutcome> CreateDhcpOptionsAwaitable(const Model::CreateDhcpOptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateDhcpOptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDhcpOptionsOutcome> CreateDhcpOptionsAwaitable(Model::CreateDhcpOptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateDhcpOptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateFlowLogsOutcome> CreateFlowLogsAwaitable(const Model::CreateFlowLogsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateFlowLogs, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateFlowLogsOutcome> CreateFlowLogsAwaitable(Model::CreateFlowLogsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateFlowLogs, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateImageOutcome> CreateImageAwaitable(const Model::CreateImageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateImage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateImageOutcome> CreateImageAwaitable(Model::CreateImageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateImage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateInstanceExportTaskOutcome> CreateInstanceExportTaskAwaitable(const Model::CreateInstanceExportTaskRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateInstanceExportTask, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateInstanceExportTaskOutcome> CreateInstanceExportTaskAwaitable(Model::CreateInstanceExportTaskRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateInstanceExportTask, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateInternetGatewayOutcome> CreateInternetGatewayAwaitable(const Model::CreateInternetGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateInternetGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateInternetGatewayOutcome> CreateInternetGatewayAwaitable(Model::CreateInternetGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateInternetGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateKeyPairOutcome> CreateKeyPairAwaitable(const Model::CreateKeyPairRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateKeyPair, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateKeyPairOutcome> CreateKeyPairAwaitable(Model::CreateKeyPairRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateKeyPair, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateNatGatewayOutcome> CreateNatGatewayAwaitable(const Model::CreateNatGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateNatGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateNatGatewayOutcome> CreateNatGatewayAwaitable(Model::CreateNatGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateNatGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateNetworkAclOutcome> CreateNetworkAclAwaitable(const Model::CreateNetworkAclRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateNetworkAcl, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateNetworkAclOutcome> CreateNetworkAclAwaitable(Model::CreateNetworkAclRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateNetworkAcl, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateNetworkAclEntryOutcome> CreateNetworkAclEntryAwaitable(const Model::CreateNetworkAclEntryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateNetworkAclEntry, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateNetworkAclEntryOutcome> CreateNetworkAclEntryAwaitable(Model::CreateNetworkAclEntryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateNetworkAclEntry, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateNetworkInterfaceOutcome> CreateNetworkInterfaceAwaitable(const Model::CreateNetworkInterfaceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateNetworkInterface, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateNetworkInterfaceOutcome> CreateNetworkInterfaceAwaitable(Model::CreateNetworkInterfaceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateNetworkInterface, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePlacementGroupOutcome> CreatePlacementGroupAwaitable(const Model::CreatePlacementGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreatePlacementGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePlacementGroupOutcome> CreatePlacementGroupAwaitable(Model::CreatePlacementGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreatePlacementGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateReservedInstancesListingOutcome> CreateReservedInstancesListingAwaitable(const Model::CreateReservedInstancesListingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateReservedInstancesListing, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateReservedInstancesListingOutcome> CreateReservedInstancesListingAwaitable(Model::CreateReservedInstancesListingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateReservedInstancesListing, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRouteOutcome> CreateRouteAwaitable(const Model::CreateRouteRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateRoute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRouteOutcome> CreateRouteAwaitable(Model::CreateRouteRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateRoute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRouteTableOutcome> CreateRouteTableAwaitable(const Model::CreateRouteTableRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateRouteTable, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRouteTableOutcome> CreateRouteTableAwaitable(Model::CreateRouteTableRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateRouteTable, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSecurityGroupOutcome> CreateSecurityGroupAwaitable(const Model::CreateSecurityGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateSecurityGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSecurityGroupOutcome> CreateSecurityGroupAwaitable(Model::CreateSecurityGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateSecurityGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(const Model::CreateSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(Model::CreateSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSpotDatafeedSubscriptionOutcome> CreateSpotDatafeedSubscriptionAwaitable(const Model::CreateSpotDatafeedSubscriptionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateSpotDatafeedSubscription, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSpotDatafeedSubscriptionOutcome> CreateSpotDatafeedSubscriptionAwaitable(Model::CreateSpotDatafeedSubscriptionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateSpotDatafeedSubscription, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSubnetOutcome> CreateSubnetAwaitable(const Model::CreateSubnetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateSubnet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSubnetOutcome> CreateSubnetAwaitable(Model::CreateSubnetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateSubnet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTagsOutcome> CreateTagsAwaitable(const Model::CreateTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTagsOutcome> CreateTagsAwaitable(Model::CreateTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVolumeOutcome> CreateVolumeAwaitable(const Model::CreateVolumeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateVolume, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVolumeOutcome> CreateVolumeAwaitable(Model::CreateVolumeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateVolume, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVpcOutcome> CreateVpcAwaitable(const Model::CreateVpcRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateVpc, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVpcOutcome> CreateVpcAwaitable(Model::CreateVpcRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateVpc, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVpcEndpointOutcome> CreateVpcEndpointAwaitable(const Model::CreateVpcEndpointRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateVpcEndpoint, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVpcEndpointOutcome> CreateVpcEndpointAwaitable(Model::CreateVpcEndpointRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateVpcEndpoint, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVpcPeeringConnectionOutcome> CreateVpcPeeringConnectionAwaitable(const Model::CreateVpcPeeringConnectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateVpcPeeringConnection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVpcPeeringConnectionOutcome> CreateVpcPeeringConnectionAwaitable(Model::CreateVpcPeeringConnectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateVpcPeeringConnection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVpnConnectionOutcome> CreateVpnConnectionAwaitable(const Model::CreateVpnConnectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateVpnConnection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVpnConnectionOutcome> CreateVpnConnectionAwaitable(Model::CreateVpnConnectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateVpnConnection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVpnConnectionRouteOutcome> CreateVpnConnectionRouteAwaitable(const Model::CreateVpnConnectionRouteRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateVpnConnectionRoute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVpnConnectionRouteOutcome> CreateVpnConnectionRouteAwaitable(Model::CreateVpnConnectionRouteRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateVpnConnectionRoute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVpnGatewayOutcome> CreateVpnGatewayAwaitable(const Model::CreateVpnGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateVpnGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVpnGatewayOutcome> CreateVpnGatewayAwaitable(Model::CreateVpnGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::CreateVpnGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCustomerGatewayOutcome> DeleteCustomerGatewayAwaitable(const Model::DeleteCustomerGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteCustomerGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCustomerGatewayOutcome> DeleteCustomerGatewayAwaitable(Model::DeleteCustomerGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteCustomerGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDhcpOptionsOutcome> DeleteDhcpOptionsAwaitable(const Model::DeleteDhcpOptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteDhcpOptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDhcpOptionsOutcome> DeleteDhcpOptionsAwaitable(Model::DeleteDhcpOptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteDhcpOptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteFlowLogsOutcome> DeleteFlowLogsAwaitable(const Model::DeleteFlowLogsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteFlowLogs, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteFlowLogsOutcome> DeleteFlowLogsAwaitable(Model::DeleteFlowLogsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteFlowLogs, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteInternetGatewayOutcome> DeleteInternetGatewayAwaitable(const Model::DeleteInternetGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteInternetGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteInternetGatewayOutcome> DeleteInternetGatewayAwaitable(Model::DeleteInternetGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteInternetGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteKeyPairOutcome> DeleteKeyPairAwaitable(const Model::DeleteKeyPairRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteKeyPair, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteKeyPairOutcome> DeleteKeyPairAwaitable(Model::DeleteKeyPairRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteKeyPair, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteNatGatewayOutcome> DeleteNatGatewayAwaitable(const Model::DeleteNatGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteNatGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteNatGatewayOutcome> DeleteNatGatewayAwaitable(Model::DeleteNatGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteNatGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteNetworkAclOutcome> DeleteNetworkAclAwaitable(const Model::DeleteNetworkAclRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteNetworkAcl, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteNetworkAclOutcome> DeleteNetworkAclAwaitable(Model::DeleteNetworkAclRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteNetworkAcl, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteNetworkAclEntryOutcome> DeleteNetworkAclEntryAwaitable(const Model::DeleteNetworkAclEntryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteNetworkAclEntry, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteNetworkAclEntryOutcome> DeleteNetworkAclEntryAwaitable(Model::DeleteNetworkAclEntryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteNetworkAclEntry, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteNetworkInterfaceOutcome> DeleteNetworkInterfaceAwaitable(const Model::DeleteNetworkInterfaceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteNetworkInterface, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteNetworkInterfaceOutcome> DeleteNetworkInterfaceAwaitable(Model::DeleteNetworkInterfaceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteNetworkInterface, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePlacementGroupOutcome> DeletePlacementGroupAwaitable(const Model::DeletePlacementGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeletePlacementGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePlacementGroupOutcome> DeletePlacementGroupAwaitable(Model::DeletePlacementGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeletePlacementGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRouteOutcome> DeleteRouteAwaitable(const Model::DeleteRouteRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteRoute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRouteOutcome> DeleteRouteAwaitable(Model::DeleteRouteRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteRoute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRouteTableOutcome> DeleteRouteTableAwaitable(const Model::DeleteRouteTableRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteRouteTable, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRouteTableOutcome> DeleteRouteTableAwaitable(Model::DeleteRouteTableRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteRouteTable, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSecurityGroupOutcome> DeleteSecurityGroupAwaitable(const Model::DeleteSecurityGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteSecurityGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSecurityGroupOutcome> DeleteSecurityGroupAwaitable(Model::DeleteSecurityGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteSecurityGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSnapshotOutcome> DeleteSnapshotAwaitable(const Model::DeleteSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSnapshotOutcome> DeleteSnapshotAwaitable(Model::DeleteSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSpotDatafeedSubscriptionOutcome> DeleteSpotDatafeedSubscriptionAwaitable(const Model::DeleteSpotDatafeedSubscriptionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteSpotDatafeedSubscription, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSpotDatafeedSubscriptionOutcome> DeleteSpotDatafeedSubscriptionAwaitable(Model::DeleteSpotDatafeedSubscriptionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteSpotDatafeedSubscription, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSubnetOutcome> DeleteSubnetAwaitable(const Model::DeleteSubnetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteSubnet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSubnetOutcome> DeleteSubnetAwaitable(Model::DeleteSubnetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteSubnet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTagsOutcome> DeleteTagsAwaitable(const Model::DeleteTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTagsOutcome> DeleteTagsAwaitable(Model::DeleteTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVolumeOutcome> DeleteVolumeAwaitable(const Model::DeleteVolumeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteVolume, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVolumeOutcome> DeleteVolumeAwaitable(Model::DeleteVolumeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteVolume, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVpcOutcome> DeleteVpcAwaitable(const Model::DeleteVpcRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteVpc, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVpcOutcome> DeleteVpcAwaitable(Model::DeleteVpcRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteVpc, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVpcEndpointsOutcome> DeleteVpcEndpointsAwaitable(const Model::DeleteVpcEndpointsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteVpcEndpoints, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVpcEndpointsOutcome> DeleteVpcEndpointsAwaitable(Model::DeleteVpcEndpointsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteVpcEndpoints, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVpcPeeringConnectionOutcome> DeleteVpcPeeringConnectionAwaitable(const Model::DeleteVpcPeeringConnectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteVpcPeeringConnection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVpcPeeringConnectionOutcome> DeleteVpcPeeringConnectionAwaitable(Model::DeleteVpcPeeringConnectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteVpcPeeringConnection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVpnConnectionOutcome> DeleteVpnConnectionAwaitable(const Model::DeleteVpnConnectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteVpnConnection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVpnConnectionOutcome> DeleteVpnConnectionAwaitable(Model::DeleteVpnConnectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteVpnConnection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVpnConnectionRouteOutcome> DeleteVpnConnectionRouteAwaitable(const Model::DeleteVpnConnectionRouteRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteVpnConnectionRoute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVpnConnectionRouteOutcome> DeleteVpnConnectionRouteAwaitable(Model::DeleteVpnConnectionRouteRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteVpnConnectionRoute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVpnGatewayOutcome> DeleteVpnGatewayAwaitable(const Model::DeleteVpnGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteVpnGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVpnGatewayOutcome> DeleteVpnGatewayAwaitable(Model::DeleteVpnGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeleteVpnGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterImageOutcome> DeregisterImageAwaitable(const Model::DeregisterImageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeregisterImage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterImageOutcome> DeregisterImageAwaitable(Model::DeregisterImageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DeregisterImage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAccountAttributesOutcome> DescribeAccountAttributesAwaitable(const Model::DescribeAccountAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeAccountAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAccountAttributesOutcome> DescribeAccountAttributesAwaitable(Model::DescribeAccountAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeAccountAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAddressesOutcome> DescribeAddressesAwaitable(const Model::DescribeAddressesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeAddresses, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAddressesOutcome> DescribeAddressesAwaitable(Model::DescribeAddressesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeAddresses, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAvailabilityZonesOutcome> DescribeAvailabilityZonesAwaitable(const Model::DescribeAvailabilityZonesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeAvailabilityZones, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAvailabilityZonesOutcome> DescribeAvailabilityZonesAwaitable(Model::DescribeAvailabilityZonesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeAvailabilityZones, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeBundleTasksOutcome> DescribeBundleTasksAwaitable(const Model::DescribeBundleTasksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeBundleTasks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeBundleTasksOutcome> DescribeBundleTasksAwaitable(Model::DescribeBundleTasksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeBundleTasks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClassicLinkInstancesOutcome> DescribeClassicLinkInstancesAwaitable(const Model::DescribeClassicLinkInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeClassicLinkInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClassicLinkInstancesOutcome> DescribeClassicLinkInstancesAwaitable(Model::DescribeClassicLinkInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeClassicLinkInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConversionTasksOutcome> DescribeConversionTasksAwaitable(const Model::DescribeConversionTasksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeConversionTasks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConversionTasksOutcome> DescribeConversionTasksAwaitable(Model::DescribeConversionTasksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeConversionTasks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCustomerGatewaysOutcome> DescribeCustomerGatewaysAwaitable(const Model::DescribeCustomerGatewaysRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeCustomerGateways, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCustomerGatewaysOutcome> DescribeCustomerGatewaysAwaitable(Model::DescribeCustomerGatewaysRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeCustomerGateways, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDhcpOptionsOutcome> DescribeDhcpOptionsAwaitable(const Model::DescribeDhcpOptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeDhcpOptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDhcpOptionsOutcome> DescribeDhcpOptionsAwaitable(Model::DescribeDhcpOptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeDhcpOptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeExportTasksOutcome> DescribeExportTasksAwaitable(const Model::DescribeExportTasksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeExportTasks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeExportTasksOutcome> DescribeExportTasksAwaitable(Model::DescribeExportTasksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeExportTasks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFlowLogsOutcome> DescribeFlowLogsAwaitable(const Model::DescribeFlowLogsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeFlowLogs, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFlowLogsOutcome> DescribeFlowLogsAwaitable(Model::DescribeFlowLogsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeFlowLogs, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeHostsOutcome> DescribeHostsAwaitable(const Model::DescribeHostsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeHosts, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeHostsOutcome> DescribeHostsAwaitable(Model::DescribeHostsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeHosts, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeIdFormatOutcome> DescribeIdFormatAwaitable(const Model::DescribeIdFormatRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeIdFormat, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeIdFormatOutcome> DescribeIdFormatAwaitable(Model::DescribeIdFormatRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeIdFormat, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeImageAttributeOutcome> DescribeImageAttributeAwaitable(const Model::DescribeImageAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeImageAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeImageAttributeOutcome> DescribeImageAttributeAwaitable(Model::DescribeImageAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeImageAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeImagesOutcome> DescribeImagesAwaitable(const Model::DescribeImagesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeImages, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeImagesOutcome> DescribeImagesAwaitable(Model::DescribeImagesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeImages, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeImportImageTasksOutcome> DescribeImportImageTasksAwaitable(const Model::DescribeImportImageTasksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeImportImageTasks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeImportImageTasksOutcome> DescribeImportImageTasksAwaitable(Model::DescribeImportImageTasksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeImportImageTasks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeImportSnapshotTasksOutcome> DescribeImportSnapshotTasksAwaitable(const Model::DescribeImportSnapshotTasksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeImportSnapshotTasks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeImportSnapshotTasksOutcome> DescribeImportSnapshotTasksAwaitable(Model::DescribeImportSnapshotTasksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeImportSnapshotTasks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInstanceAttributeOutcome> DescribeInstanceAttributeAwaitable(const Model::DescribeInstanceAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeInstanceAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInstanceAttributeOutcome> DescribeInstanceAttributeAwaitable(Model::DescribeInstanceAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeInstanceAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInstanceStatusOutcome> DescribeInstanceStatusAwaitable(const Model::DescribeInstanceStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeInstanceStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInstanceStatusOutcome> DescribeInstanceStatusAwaitable(Model::DescribeInstanceStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeInstanceStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInstancesOutcome> DescribeInstancesAwaitable(const Model::DescribeInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInstancesOutcome> DescribeInstancesAwaitable(Model::DescribeInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInternetGatewaysOutcome> DescribeInternetGatewaysAwaitable(const Model::DescribeInternetGatewaysRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeInternetGateways, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInternetGatewaysOutcome> DescribeInternetGatewaysAwaitable(Model::DescribeInternetGatewaysRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeInternetGateways, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeKeyPairsOutcome> DescribeKeyPairsAwaitable(const Model::DescribeKeyPairsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeKeyPairs, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeKeyPairsOutcome> DescribeKeyPairsAwaitable(Model::DescribeKeyPairsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeKeyPairs, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMovingAddressesOutcome> DescribeMovingAddressesAwaitable(const Model::DescribeMovingAddressesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeMovingAddresses, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMovingAddressesOutcome> DescribeMovingAddressesAwaitable(Model::DescribeMovingAddressesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeMovingAddresses, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeNatGatewaysOutcome> DescribeNatGatewaysAwaitable(const Model::DescribeNatGatewaysRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeNatGateways, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeNatGatewaysOutcome> DescribeNatGatewaysAwaitable(Model::DescribeNatGatewaysRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeNatGateways, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeNetworkAclsOutcome> DescribeNetworkAclsAwaitable(const Model::DescribeNetworkAclsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeNetworkAcls, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeNetworkAclsOutcome> DescribeNetworkAclsAwaitable(Model::DescribeNetworkAclsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeNetworkAcls, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeNetworkInterfaceAttributeOutcome> DescribeNetworkInterfaceAttributeAwaitable(const Model::DescribeNetworkInterfaceAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeNetworkInterfaceAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeNetworkInterfaceAttributeOutcome> DescribeNetworkInterfaceAttributeAwaitable(Model::DescribeNetworkInterfaceAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeNetworkInterfaceAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeNetworkInterfacesOutcome> DescribeNetworkInterfacesAwaitable(const Model::DescribeNetworkInterfacesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeNetworkInterfaces, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeNetworkInterfacesOutcome> DescribeNetworkInterfacesAwaitable(Model::DescribeNetworkInterfacesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeNetworkInterfaces, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribePlacementGroupsOutcome> DescribePlacementGroupsAwaitable(const Model::DescribePlacementGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribePlacementGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribePlacementGroupsOutcome> DescribePlacementGroupsAwaitable(Model::DescribePlacementGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribePlacementGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribePrefixListsOutcome> DescribePrefixListsAwaitable(const Model::DescribePrefixListsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribePrefixLists, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribePrefixListsOutcome> DescribePrefixListsAwaitable(Model::DescribePrefixListsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribePrefixLists, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRegionsOutcome> DescribeRegionsAwaitable(const Model::DescribeRegionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeRegions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRegionsOutcome> DescribeRegionsAwaitable(Model::DescribeRegionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeRegions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedInstancesOutcome> DescribeReservedInstancesAwaitable(const Model::DescribeReservedInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeReservedInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedInstancesOutcome> DescribeReservedInstancesAwaitable(Model::DescribeReservedInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeReservedInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedInstancesListingsOutcome> DescribeReservedInstancesListingsAwaitable(const Model::DescribeReservedInstancesListingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeReservedInstancesListings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedInstancesListingsOutcome> DescribeReservedInstancesListingsAwaitable(Model::DescribeReservedInstancesListingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeReservedInstancesListings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedInstancesModificationsOutcome> DescribeReservedInstancesModificationsAwaitable(const Model::DescribeReservedInstancesModificationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeReservedInstancesModifications, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedInstancesModificationsOutcome> DescribeReservedInstancesModificationsAwaitable(Model::DescribeReservedInstancesModificationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeReservedInstancesModifications, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedInstancesOfferingsOutcome> DescribeReservedInstancesOfferingsAwaitable(const Model::DescribeReservedInstancesOfferingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeReservedInstancesOfferings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedInstancesOfferingsOutcome> DescribeReservedInstancesOfferingsAwaitable(Model::DescribeReservedInstancesOfferingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeReservedInstancesOfferings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRouteTablesOutcome> DescribeRouteTablesAwaitable(const Model::DescribeRouteTablesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeRouteTables, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRouteTablesOutcome> DescribeRouteTablesAwaitable(Model::DescribeRouteTablesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeRouteTables, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeScheduledInstanceAvailabilityOutcome> DescribeScheduledInstanceAvailabilityAwaitable(const Model::DescribeScheduledInstanceAvailabilityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeScheduledInstanceAvailability, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeScheduledInstanceAvailabilityOutcome> DescribeScheduledInstanceAvailabilityAwaitable(Model::DescribeScheduledInstanceAvailabilityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeScheduledInstanceAvailability, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeScheduledInstancesOutcome> DescribeScheduledInstancesAwaitable(const Model::DescribeScheduledInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeScheduledInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeScheduledInstancesOutcome> DescribeScheduledInstancesAwaitable(Model::DescribeScheduledInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeScheduledInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSecurityGroupsOutcome> DescribeSecurityGroupsAwaitable(const Model::DescribeSecurityGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSecurityGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSecurityGroupsOutcome> DescribeSecurityGroupsAwaitable(Model::DescribeSecurityGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSecurityGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSnapshotAttributeOutcome> DescribeSnapshotAttributeAwaitable(const Model::DescribeSnapshotAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSnapshotAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSnapshotAttributeOutcome> DescribeSnapshotAttributeAwaitable(Model::DescribeSnapshotAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSnapshotAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSnapshotsOutcome> DescribeSnapshotsAwaitable(const Model::DescribeSnapshotsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSnapshots, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSnapshotsOutcome> DescribeSnapshotsAwaitable(Model::DescribeSnapshotsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSnapshots, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSpotDatafeedSubscriptionOutcome> DescribeSpotDatafeedSubscriptionAwaitable(const Model::DescribeSpotDatafeedSubscriptionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSpotDatafeedSubscription, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSpotDatafeedSubscriptionOutcome> DescribeSpotDatafeedSubscriptionAwaitable(Model::DescribeSpotDatafeedSubscriptionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSpotDatafeedSubscription, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSpotFleetInstancesOutcome> DescribeSpotFleetInstancesAwaitable(const Model::DescribeSpotFleetInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSpotFleetInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSpotFleetInstancesOutcome> DescribeSpotFleetInstancesAwaitable(Model::DescribeSpotFleetInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSpotFleetInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSpotFleetRequestHistoryOutcome> DescribeSpotFleetRequestHistoryAwaitable(const Model::DescribeSpotFleetRequestHistoryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSpotFleetRequestHistory, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSpotFleetRequestHistoryOutcome> DescribeSpotFleetRequestHistoryAwaitable(Model::DescribeSpotFleetRequestHistoryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSpotFleetRequestHistory, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSpotFleetRequestsOutcome> DescribeSpotFleetRequestsAwaitable(const Model::DescribeSpotFleetRequestsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSpotFleetRequests, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSpotFleetRequestsOutcome> DescribeSpotFleetRequestsAwaitable(Model::DescribeSpotFleetRequestsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSpotFleetRequests, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSpotInstanceRequestsOutcome> DescribeSpotInstanceRequestsAwaitable(const Model::DescribeSpotInstanceRequestsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSpotInstanceRequests, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSpotInstanceRequestsOutcome> DescribeSpotInstanceRequestsAwaitable(Model::DescribeSpotInstanceRequestsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSpotInstanceRequests, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSpotPriceHistoryOutcome> DescribeSpotPriceHistoryAwaitable(const Model::DescribeSpotPriceHistoryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSpotPriceHistory, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSpotPriceHistoryOutcome> DescribeSpotPriceHistoryAwaitable(Model::DescribeSpotPriceHistoryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSpotPriceHistory, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSubnetsOutcome> DescribeSubnetsAwaitable(const Model::DescribeSubnetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSubnets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSubnetsOutcome> DescribeSubnetsAwaitable(Model::DescribeSubnetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeSubnets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTagsOutcome> DescribeTagsAwaitable(const Model::DescribeTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTagsOutcome> DescribeTagsAwaitable(Model::DescribeTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVolumeAttributeOutcome> DescribeVolumeAttributeAwaitable(const Model::DescribeVolumeAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVolumeAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVolumeAttributeOutcome> DescribeVolumeAttributeAwaitable(Model::DescribeVolumeAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVolumeAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVolumeStatusOutcome> DescribeVolumeStatusAwaitable(const Model::DescribeVolumeStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVolumeStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVolumeStatusOutcome> DescribeVolumeStatusAwaitable(Model::DescribeVolumeStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVolumeStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVolumesOutcome> DescribeVolumesAwaitable(const Model::DescribeVolumesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVolumes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVolumesOutcome> DescribeVolumesAwaitable(Model::DescribeVolumesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVolumes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpcAttributeOutcome> DescribeVpcAttributeAwaitable(const Model::DescribeVpcAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpcAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpcAttributeOutcome> DescribeVpcAttributeAwaitable(Model::DescribeVpcAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpcAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpcClassicLinkOutcome> DescribeVpcClassicLinkAwaitable(const Model::DescribeVpcClassicLinkRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpcClassicLink, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpcClassicLinkOutcome> DescribeVpcClassicLinkAwaitable(Model::DescribeVpcClassicLinkRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpcClassicLink, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpcClassicLinkDnsSupportOutcome> DescribeVpcClassicLinkDnsSupportAwaitable(const Model::DescribeVpcClassicLinkDnsSupportRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpcClassicLinkDnsSupport, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpcClassicLinkDnsSupportOutcome> DescribeVpcClassicLinkDnsSupportAwaitable(Model::DescribeVpcClassicLinkDnsSupportRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpcClassicLinkDnsSupport, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpcEndpointServicesOutcome> DescribeVpcEndpointServicesAwaitable(const Model::DescribeVpcEndpointServicesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpcEndpointServices, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpcEndpointServicesOutcome> DescribeVpcEndpointServicesAwaitable(Model::DescribeVpcEndpointServicesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpcEndpointServices, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpcEndpointsOutcome> DescribeVpcEndpointsAwaitable(const Model::DescribeVpcEndpointsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpcEndpoints, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpcEndpointsOutcome> DescribeVpcEndpointsAwaitable(Model::DescribeVpcEndpointsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpcEndpoints, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpcPeeringConnectionsOutcome> DescribeVpcPeeringConnectionsAwaitable(const Model::DescribeVpcPeeringConnectionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpcPeeringConnections, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpcPeeringConnectionsOutcome> DescribeVpcPeeringConnectionsAwaitable(Model::DescribeVpcPeeringConnectionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpcPeeringConnections, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpcsOutcome> DescribeVpcsAwaitable(const Model::DescribeVpcsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpcs, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpcsOutcome> DescribeVpcsAwaitable(Model::DescribeVpcsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpcs, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpnConnectionsOutcome> DescribeVpnConnectionsAwaitable(const Model::DescribeVpnConnectionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpnConnections, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpnConnectionsOutcome> DescribeVpnConnectionsAwaitable(Model::DescribeVpnConnectionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpnConnections, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpnGatewaysOutcome> DescribeVpnGatewaysAwaitable(const Model::DescribeVpnGatewaysRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpnGateways, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVpnGatewaysOutcome> DescribeVpnGatewaysAwaitable(Model::DescribeVpnGatewaysRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DescribeVpnGateways, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachClassicLinkVpcOutcome> DetachClassicLinkVpcAwaitable(const Model::DetachClassicLinkVpcRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DetachClassicLinkVpc, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachClassicLinkVpcOutcome> DetachClassicLinkVpcAwaitable(Model::DetachClassicLinkVpcRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DetachClassicLinkVpc, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachInternetGatewayOutcome> DetachInternetGatewayAwaitable(const Model::DetachInternetGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DetachInternetGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachInternetGatewayOutcome> DetachInternetGatewayAwaitable(Model::DetachInternetGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DetachInternetGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachNetworkInterfaceOutcome> DetachNetworkInterfaceAwaitable(const Model::DetachNetworkInterfaceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DetachNetworkInterface, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachNetworkInterfaceOutcome> DetachNetworkInterfaceAwaitable(Model::DetachNetworkInterfaceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DetachNetworkInterface, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachVolumeOutcome> DetachVolumeAwaitable(const Model::DetachVolumeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DetachVolume, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachVolumeOutcome> DetachVolumeAwaitable(Model::DetachVolumeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DetachVolume, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachVpnGatewayOutcome> DetachVpnGatewayAwaitable(const Model::DetachVpnGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DetachVpnGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachVpnGatewayOutcome> DetachVpnGatewayAwaitable(Model::DetachVpnGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DetachVpnGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableVgwRoutePropagationOutcome> DisableVgwRoutePropagationAwaitable(const Model::DisableVgwRoutePropagationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DisableVgwRoutePropagation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableVgwRoutePropagationOutcome> DisableVgwRoutePropagationAwaitable(Model::DisableVgwRoutePropagationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DisableVgwRoutePropagation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableVpcClassicLinkOutcome> DisableVpcClassicLinkAwaitable(const Model::DisableVpcClassicLinkRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DisableVpcClassicLink, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableVpcClassicLinkOutcome> DisableVpcClassicLinkAwaitable(Model::DisableVpcClassicLinkRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DisableVpcClassicLink, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableVpcClassicLinkDnsSupportOutcome> DisableVpcClassicLinkDnsSupportAwaitable(const Model::DisableVpcClassicLinkDnsSupportRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DisableVpcClassicLinkDnsSupport, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableVpcClassicLinkDnsSupportOutcome> DisableVpcClassicLinkDnsSupportAwaitable(Model::DisableVpcClassicLinkDnsSupportRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DisableVpcClassicLinkDnsSupport, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisassociateAddressOutcome> DisassociateAddressAwaitable(const Model::DisassociateAddressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DisassociateAddress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisassociateAddressOutcome> DisassociateAddressAwaitable(Model::DisassociateAddressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DisassociateAddress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisassociateRouteTableOutcome> DisassociateRouteTableAwaitable(const Model::DisassociateRouteTableRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DisassociateRouteTable, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisassociateRouteTableOutcome> DisassociateRouteTableAwaitable(Model::DisassociateRouteTableRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::DisassociateRouteTable, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableVgwRoutePropagationOutcome> EnableVgwRoutePropagationAwaitable(const Model::EnableVgwRoutePropagationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::EnableVgwRoutePropagation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableVgwRoutePropagationOutcome> EnableVgwRoutePropagationAwaitable(Model::EnableVgwRoutePropagationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::EnableVgwRoutePropagation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableVolumeIOOutcome> EnableVolumeIOAwaitable(const Model::EnableVolumeIORequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::EnableVolumeIO, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableVolumeIOOutcome> EnableVolumeIOAwaitable(Model::EnableVolumeIORequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::EnableVolumeIO, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableVpcClassicLinkOutcome> EnableVpcClassicLinkAwaitable(const Model::EnableVpcClassicLinkRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::EnableVpcClassicLink, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableVpcClassicLinkOutcome> EnableVpcClassicLinkAwaitable(Model::EnableVpcClassicLinkRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::EnableVpcClassicLink, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableVpcClassicLinkDnsSupportOutcome> EnableVpcClassicLinkDnsSupportAwaitable(const Model::EnableVpcClassicLinkDnsSupportRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::EnableVpcClassicLinkDnsSupport, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableVpcClassicLinkDnsSupportOutcome> EnableVpcClassicLinkDnsSupportAwaitable(Model::EnableVpcClassicLinkDnsSupportRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::EnableVpcClassicLinkDnsSupport, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetConsoleOutputOutcome> GetConsoleOutputAwaitable(const Model::GetConsoleOutputRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::GetConsoleOutput, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetConsoleOutputOutcome> GetConsoleOutputAwaitable(Model::GetConsoleOutputRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::GetConsoleOutput, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPasswordDataOutcome> GetPasswordDataAwaitable(const Model::GetPasswordDataRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::GetPasswordData, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPasswordDataOutcome> GetPasswordDataAwaitable(Model::GetPasswordDataRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::GetPasswordData, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ImportImageOutcome> ImportImageAwaitable(const Model::ImportImageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ImportImage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ImportImageOutcome> ImportImageAwaitable(Model::ImportImageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ImportImage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ImportInstanceOutcome> ImportInstanceAwaitable(const Model::ImportInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ImportInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ImportInstanceOutcome> ImportInstanceAwaitable(Model::ImportInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ImportInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ImportKeyPairOutcome> ImportKeyPairAwaitable(const Model::ImportKeyPairRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ImportKeyPair, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ImportKeyPairOutcome> ImportKeyPairAwaitable(Model::ImportKeyPairRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ImportKeyPair, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ImportSnapshotOutcome> ImportSnapshotAwaitable(const Model::ImportSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ImportSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ImportSnapshotOutcome> ImportSnapshotAwaitable(Model::ImportSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ImportSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ImportVolumeOutcome> ImportVolumeAwaitable(const Model::ImportVolumeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ImportVolume, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ImportVolumeOutcome> ImportVolumeAwaitable(Model::ImportVolumeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ImportVolume, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyHostsOutcome> ModifyHostsAwaitable(const Model::ModifyHostsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyHosts, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyHostsOutcome> ModifyHostsAwaitable(Model::ModifyHostsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyHosts, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyIdFormatOutcome> ModifyIdFormatAwaitable(const Model::ModifyIdFormatRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyIdFormat, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyIdFormatOutcome> ModifyIdFormatAwaitable(Model::ModifyIdFormatRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyIdFormat, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyImageAttributeOutcome> ModifyImageAttributeAwaitable(const Model::ModifyImageAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyImageAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyImageAttributeOutcome> ModifyImageAttributeAwaitable(Model::ModifyImageAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyImageAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyInstanceAttributeOutcome> ModifyInstanceAttributeAwaitable(const Model::ModifyInstanceAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyInstanceAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyInstanceAttributeOutcome> ModifyInstanceAttributeAwaitable(Model::ModifyInstanceAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyInstanceAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyInstancePlacementOutcome> ModifyInstancePlacementAwaitable(const Model::ModifyInstancePlacementRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyInstancePlacement, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyInstancePlacementOutcome> ModifyInstancePlacementAwaitable(Model::ModifyInstancePlacementRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyInstancePlacement, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyNetworkInterfaceAttributeOutcome> ModifyNetworkInterfaceAttributeAwaitable(const Model::ModifyNetworkInterfaceAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyNetworkInterfaceAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyNetworkInterfaceAttributeOutcome> ModifyNetworkInterfaceAttributeAwaitable(Model::ModifyNetworkInterfaceAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyNetworkInterfaceAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyReservedInstancesOutcome> ModifyReservedInstancesAwaitable(const Model::ModifyReservedInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyReservedInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyReservedInstancesOutcome> ModifyReservedInstancesAwaitable(Model::ModifyReservedInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyReservedInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifySnapshotAttributeOutcome> ModifySnapshotAttributeAwaitable(const Model::ModifySnapshotAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifySnapshotAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifySnapshotAttributeOutcome> ModifySnapshotAttributeAwaitable(Model::ModifySnapshotAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifySnapshotAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifySpotFleetRequestOutcome> ModifySpotFleetRequestAwaitable(const Model::ModifySpotFleetRequestRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifySpotFleetRequest, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifySpotFleetRequestOutcome> ModifySpotFleetRequestAwaitable(Model::ModifySpotFleetRequestRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifySpotFleetRequest, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifySubnetAttributeOutcome> ModifySubnetAttributeAwaitable(const Model::ModifySubnetAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifySubnetAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifySubnetAttributeOutcome> ModifySubnetAttributeAwaitable(Model::ModifySubnetAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifySubnetAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyVolumeAttributeOutcome> ModifyVolumeAttributeAwaitable(const Model::ModifyVolumeAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyVolumeAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyVolumeAttributeOutcome> ModifyVolumeAttributeAwaitable(Model::ModifyVolumeAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyVolumeAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyVpcAttributeOutcome> ModifyVpcAttributeAwaitable(const Model::ModifyVpcAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyVpcAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyVpcAttributeOutcome> ModifyVpcAttributeAwaitable(Model::ModifyVpcAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyVpcAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyVpcEndpointOutcome> ModifyVpcEndpointAwaitable(const Model::ModifyVpcEndpointRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyVpcEndpoint, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyVpcEndpointOutcome> ModifyVpcEndpointAwaitable(Model::ModifyVpcEndpointRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ModifyVpcEndpoint, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::MonitorInstancesOutcome> MonitorInstancesAwaitable(const Model::MonitorInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::MonitorInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::MonitorInstancesOutcome> MonitorInstancesAwaitable(Model::MonitorInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::MonitorInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::MoveAddressToVpcOutcome> MoveAddressToVpcAwaitable(const Model::MoveAddressToVpcRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::MoveAddressToVpc, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::MoveAddressToVpcOutcome> MoveAddressToVpcAwaitable(Model::MoveAddressToVpcRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::MoveAddressToVpc, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PurchaseReservedInstancesOfferingOutcome> PurchaseReservedInstancesOfferingAwaitable(const Model::PurchaseReservedInstancesOfferingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::PurchaseReservedInstancesOffering, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PurchaseReservedInstancesOfferingOutcome> PurchaseReservedInstancesOfferingAwaitable(Model::PurchaseReservedInstancesOfferingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::PurchaseReservedInstancesOffering, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PurchaseScheduledInstancesOutcome> PurchaseScheduledInstancesAwaitable(const Model::PurchaseScheduledInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::PurchaseScheduledInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PurchaseScheduledInstancesOutcome> PurchaseScheduledInstancesAwaitable(Model::PurchaseScheduledInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::PurchaseScheduledInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebootInstancesOutcome> RebootInstancesAwaitable(const Model::RebootInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RebootInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebootInstancesOutcome> RebootInstancesAwaitable(Model::RebootInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RebootInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterImageOutcome> RegisterImageAwaitable(const Model::RegisterImageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RegisterImage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterImageOutcome> RegisterImageAwaitable(Model::RegisterImageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RegisterImage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RejectVpcPeeringConnectionOutcome> RejectVpcPeeringConnectionAwaitable(const Model::RejectVpcPeeringConnectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RejectVpcPeeringConnection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RejectVpcPeeringConnectionOutcome> RejectVpcPeeringConnectionAwaitable(Model::RejectVpcPeeringConnectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RejectVpcPeeringConnection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReleaseAddressOutcome> ReleaseAddressAwaitable(const Model::ReleaseAddressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ReleaseAddress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReleaseAddressOutcome> ReleaseAddressAwaitable(Model::ReleaseAddressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ReleaseAddress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReleaseHostsOutcome> ReleaseHostsAwaitable(const Model::ReleaseHostsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ReleaseHosts, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReleaseHostsOutcome> ReleaseHostsAwaitable(Model::ReleaseHostsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ReleaseHosts, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReplaceNetworkAclAssociationOutcome> ReplaceNetworkAclAssociationAwaitable(const Model::ReplaceNetworkAclAssociationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ReplaceNetworkAclAssociation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReplaceNetworkAclAssociationOutcome> ReplaceNetworkAclAssociationAwaitable(Model::ReplaceNetworkAclAssociationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ReplaceNetworkAclAssociation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReplaceNetworkAclEntryOutcome> ReplaceNetworkAclEntryAwaitable(const Model::ReplaceNetworkAclEntryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ReplaceNetworkAclEntry, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReplaceNetworkAclEntryOutcome> ReplaceNetworkAclEntryAwaitable(Model::ReplaceNetworkAclEntryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ReplaceNetworkAclEntry, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReplaceRouteOutcome> ReplaceRouteAwaitable(const Model::ReplaceRouteRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ReplaceRoute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReplaceRouteOutcome> ReplaceRouteAwaitable(Model::ReplaceRouteRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ReplaceRoute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReplaceRouteTableAssociationOutcome> ReplaceRouteTableAssociationAwaitable(const Model::ReplaceRouteTableAssociationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ReplaceRouteTableAssociation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReplaceRouteTableAssociationOutcome> ReplaceRouteTableAssociationAwaitable(Model::ReplaceRouteTableAssociationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ReplaceRouteTableAssociation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReportInstanceStatusOutcome> ReportInstanceStatusAwaitable(const Model::ReportInstanceStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ReportInstanceStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReportInstanceStatusOutcome> ReportInstanceStatusAwaitable(Model::ReportInstanceStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ReportInstanceStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RequestSpotFleetOutcome> RequestSpotFleetAwaitable(const Model::RequestSpotFleetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RequestSpotFleet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RequestSpotFleetOutcome> RequestSpotFleetAwaitable(Model::RequestSpotFleetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RequestSpotFleet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RequestSpotInstancesOutcome> RequestSpotInstancesAwaitable(const Model::RequestSpotInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RequestSpotInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RequestSpotInstancesOutcome> RequestSpotInstancesAwaitable(Model::RequestSpotInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RequestSpotInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetImageAttributeOutcome> ResetImageAttributeAwaitable(const Model::ResetImageAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ResetImageAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetImageAttributeOutcome> ResetImageAttributeAwaitable(Model::ResetImageAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ResetImageAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetInstanceAttributeOutcome> ResetInstanceAttributeAwaitable(const Model::ResetInstanceAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ResetInstanceAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetInstanceAttributeOutcome> ResetInstanceAttributeAwaitable(Model::ResetInstanceAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ResetInstanceAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetNetworkInterfaceAttributeOutcome> ResetNetworkInterfaceAttributeAwaitable(const Model::ResetNetworkInterfaceAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ResetNetworkInterfaceAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetNetworkInterfaceAttributeOutcome> ResetNetworkInterfaceAttributeAwaitable(Model::ResetNetworkInterfaceAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ResetNetworkInterfaceAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetSnapshotAttributeOutcome> ResetSnapshotAttributeAwaitable(const Model::ResetSnapshotAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ResetSnapshotAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetSnapshotAttributeOutcome> ResetSnapshotAttributeAwaitable(Model::ResetSnapshotAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::ResetSnapshotAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreAddressToClassicOutcome> RestoreAddressToClassicAwaitable(const Model::RestoreAddressToClassicRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RestoreAddressToClassic, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreAddressToClassicOutcome> RestoreAddressToClassicAwaitable(Model::RestoreAddressToClassicRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RestoreAddressToClassic, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RevokeSecurityGroupEgressOutcome> RevokeSecurityGroupEgressAwaitable(const Model::RevokeSecurityGroupEgressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RevokeSecurityGroupEgress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RevokeSecurityGroupEgressOutcome> RevokeSecurityGroupEgressAwaitable(Model::RevokeSecurityGroupEgressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RevokeSecurityGroupEgress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RevokeSecurityGroupIngressOutcome> RevokeSecurityGroupIngressAwaitable(const Model::RevokeSecurityGroupIngressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RevokeSecurityGroupIngress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RevokeSecurityGroupIngressOutcome> RevokeSecurityGroupIngressAwaitable(Model::RevokeSecurityGroupIngressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RevokeSecurityGroupIngress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RunInstancesOutcome> RunInstancesAwaitable(const Model::RunInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RunInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RunInstancesOutcome> RunInstancesAwaitable(Model::RunInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RunInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RunScheduledInstancesOutcome> RunScheduledInstancesAwaitable(const Model::RunScheduledInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RunScheduledInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RunScheduledInstancesOutcome> RunScheduledInstancesAwaitable(Model::RunScheduledInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::RunScheduledInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartInstancesOutcome> StartInstancesAwaitable(const Model::StartInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::StartInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartInstancesOutcome> StartInstancesAwaitable(Model::StartInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::StartInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopInstancesOutcome> StopInstancesAwaitable(const Model::StopInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::StopInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopInstancesOutcome> StopInstancesAwaitable(Model::StopInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::StopInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TerminateInstancesOutcome> TerminateInstancesAwaitable(const Model::TerminateInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::TerminateInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TerminateInstancesOutcome> TerminateInstancesAwaitable(Model::TerminateInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::TerminateInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnassignPrivateIpAddressesOutcome> UnassignPrivateIpAddressesAwaitable(const Model::UnassignPrivateIpAddressesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::UnassignPrivateIpAddresses, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnassignPrivateIpAddressesOutcome> UnassignPrivateIpAddressesAwaitable(Model::UnassignPrivateIpAddressesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::UnassignPrivateIpAddresses, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnmonitorInstancesOutcome> UnmonitorInstancesAwaitable(const Model::UnmonitorInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::UnmonitorInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnmonitorInstancesOutcome> UnmonitorInstancesAwaitable(Model::UnmonitorInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EC2Client::UnmonitorInstances, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
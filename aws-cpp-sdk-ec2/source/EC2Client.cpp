@@ -307,12 +307,22 @@ AcceptVpcPeeringConnectionOutcome EC2Client::AcceptVpcPeeringConnection(const Ac
 
 AcceptVpcPeeringConnectionOutcomeCallable EC2Client::AcceptVpcPeeringConnectionCallable(const AcceptVpcPeeringConnectionRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::AcceptVpcPeeringConnection, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::AcceptVpcPeeringConnection, Aws::Client::RejectedCallOutcome<AcceptVpcPeeringConnectionOutcome>(), this, request);
+}
+
+AcceptVpcPeeringConnectionOutcomeCallable EC2Client::AcceptVpcPeeringConnectionCallable(AcceptVpcPeeringConnectionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::AcceptVpcPeeringConnection, Aws::Client::RejectedCallOutcome<AcceptVpcPeeringConnectionOutcome>(), this, std::move(request));
 }
 
 void EC2Client::AcceptVpcPeeringConnectionAsync(const AcceptVpcPeeringConnectionRequest& request, const AcceptVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::AcceptVpcPeeringConnectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::AcceptVpcPeeringConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<AcceptVpcPeeringConnectionOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::AcceptVpcPeeringConnectionAsync(AcceptVpcPeeringConnectionRequest&& request, const AcceptVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::AcceptVpcPeeringConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<AcceptVpcPeeringConnectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::AcceptVpcPeeringConnectionAsyncHelper(const AcceptVpcPeeringConnectionRequest& request, const AcceptVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -337,12 +347,22 @@ AllocateAddressOutcome EC2Client::AllocateAddress(const AllocateAddressRequest&
 
 AllocateAddressOutcomeCallable EC2Client::AllocateAddressCallable(const AllocateAddressRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::AllocateAddress, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::AllocateAddress, Aws::Client::RejectedCallOutcome<AllocateAddressOutcome>(), this, request);
+}
+
+AllocateAddressOutcomeCallable EC2Client::AllocateAddressCallable(AllocateAddressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::AllocateAddress, Aws::Client::RejectedCallOutcome<AllocateAddressOutcome>(), this, std::move(request));
 }
 
 void EC2Client::AllocateAddressAsync(const AllocateAddressRequest& request, const AllocateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::AllocateAddressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::AllocateAddressAsyncHelper, Aws::Client::RejectedAsyncCall<AllocateAddressOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::AllocateAddressAsync(AllocateAddressRequest&& request, const AllocateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::AllocateAddressAsyncHelper, Aws::Client::RejectedAsyncCall<AllocateAddressOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::AllocateAddressAsyncHelper(const AllocateAddressRequest& request, const AllocateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -367,12 +387,22 @@ AllocateHostsOutcome EC2Client::AllocateHosts(const AllocateHostsRequest& reques
 
 AllocateHostsOutcomeCallable EC2Client::AllocateHostsCallable(const AllocateHostsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::AllocateHosts, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::AllocateHosts, Aws::Client::RejectedCallOutcome<AllocateHostsOutcome>(), this, request);
+}
+
+AllocateHostsOutcomeCallable EC2Client::AllocateHostsCallable(AllocateHostsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::AllocateHosts, Aws::Client::RejectedCallOutcome<AllocateHostsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::AllocateHostsAsync(const AllocateHostsRequest& request, const AllocateHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::AllocateHostsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::AllocateHostsAsyncHelper, Aws::Client::RejectedAsyncCall<AllocateHostsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::AllocateHostsAsync(AllocateHostsRequest&& request, const AllocateHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::AllocateHostsAsyncHelper, Aws::Client::RejectedAsyncCall<AllocateHostsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::AllocateHostsAsyncHelper(const AllocateHostsRequest& request, const AllocateHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -397,12 +427,22 @@ AssignPrivateIpAddressesOutcome EC2Client::AssignPrivateIpAddresses(const Assign
 
 AssignPrivateIpAddressesOutcomeCallable EC2Client::AssignPrivateIpAddressesCallable(const AssignPrivateIpAddressesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::AssignPrivateIpAddresses, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::AssignPrivateIpAddresses, Aws::Client::RejectedCallOutcome<AssignPrivateIpAddressesOutcome>(), this, request);
+}
+
+AssignPrivateIpAddressesOutcomeCallable EC2Client::AssignPrivateIpAddressesCallable(AssignPrivateIpAddressesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::AssignPrivateIpAddresses, Aws::Client::RejectedCallOutcome<AssignPrivateIpAddressesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::AssignPrivateIpAddressesAsync(const AssignPrivateIpAddressesRequest& request, const AssignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::AssignPrivateIpAddressesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::AssignPrivateIpAddressesAsyncHelper, Aws::Client::RejectedAsyncCall<AssignPrivateIpAddressesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::AssignPrivateIpAddressesAsync(AssignPrivateIpAddressesRequest&& request, const AssignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::AssignPrivateIpAddressesAsyncHelper, Aws::Client::RejectedAsyncCall<AssignPrivateIpAddressesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::AssignPrivateIpAddressesAsyncHelper(const AssignPrivateIpAddressesRequest& request, const AssignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -427,12 +467,22 @@ AssociateAddressOutcome EC2Client::AssociateAddress(const AssociateAddressReques
 
 AssociateAddressOutcomeCallable EC2Client::AssociateAddressCallable(const AssociateAddressRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::AssociateAddress, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::AssociateAddress, Aws::Client::RejectedCallOutcome<AssociateAddressOutcome>(), this, request);
+}
+
+AssociateAddressOutcomeCallable EC2Client::AssociateAddressCallable(AssociateAddressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::AssociateAddress, Aws::Client::RejectedCallOutcome<AssociateAddressOutcome>(), this, std::move(request));
 }
 
 void EC2Client::AssociateAddressAsync(const AssociateAddressRequest& request, const AssociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::AssociateAddressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::AssociateAddressAsyncHelper, Aws::Client::RejectedAsyncCall<AssociateAddressOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::AssociateAddressAsync(AssociateAddressRequest&& request, const AssociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::AssociateAddressAsyncHelper, Aws::Client::RejectedAsyncCall<AssociateAddressOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::AssociateAddressAsyncHelper(const AssociateAddressRequest& request, const AssociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -457,12 +507,22 @@ AssociateDhcpOptionsOutcome EC2Client::AssociateDhcpOptions(const AssociateDhcpO
 
 AssociateDhcpOptionsOutcomeCallable EC2Client::AssociateDhcpOptionsCallable(const AssociateDhcpOptionsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::AssociateDhcpOptions, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::AssociateDhcpOptions, Aws::Client::RejectedCallOutcome<AssociateDhcpOptionsOutcome>(), this, request);
+}
+
+AssociateDhcpOptionsOutcomeCallable EC2Client::AssociateDhcpOptionsCallable(AssociateDhcpOptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::AssociateDhcpOptions, Aws::Client::RejectedCallOutcome<AssociateDhcpOptionsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::AssociateDhcpOptionsAsync(const AssociateDhcpOptionsRequest& request, const AssociateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::AssociateDhcpOptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::AssociateDhcpOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<AssociateDhcpOptionsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::AssociateDhcpOptionsAsync(AssociateDhcpOptionsRequest&& request, const AssociateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::AssociateDhcpOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<AssociateDhcpOptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::AssociateDhcpOptionsAsyncHelper(const AssociateDhcpOptionsRequest& request, const AssociateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -487,12 +547,22 @@ AssociateRouteTableOutcome EC2Client::AssociateRouteTable(const AssociateRouteTa
 
 AssociateRouteTableOutcomeCallable EC2Client::AssociateRouteTableCallable(const AssociateRouteTableRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::AssociateRouteTable, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::AssociateRouteTable, Aws::Client::RejectedCallOutcome<AssociateRouteTableOutcome>(), this, request);
+}
+
+AssociateRouteTableOutcomeCallable EC2Client::AssociateRouteTableCallable(AssociateRouteTableRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::AssociateRouteTable, Aws::Client::RejectedCallOutcome<AssociateRouteTableOutcome>(), this, std::move(request));
 }
 
 void EC2Client::AssociateRouteTableAsync(const AssociateRouteTableRequest& request, const AssociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::AssociateRouteTableAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::AssociateRouteTableAsyncHelper, Aws::Client::RejectedAsyncCall<AssociateRouteTableOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::AssociateRouteTableAsync(AssociateRouteTableRequest&& request, const AssociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::AssociateRouteTableAsyncHelper, Aws::Client::RejectedAsyncCall<AssociateRouteTableOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::AssociateRouteTableAsyncHelper(const AssociateRouteTableRequest& request, const AssociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -517,12 +587,22 @@ AttachClassicLinkVpcOutcome EC2Client::AttachClassicLinkVpc(const AttachClassicL
 
 AttachClassicLinkVpcOutcomeCallable EC2Client::AttachClassicLinkVpcCallable(const AttachClassicLinkVpcRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::AttachClassicLinkVpc, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::AttachClassicLinkVpc, Aws::Client::RejectedCallOutcome<AttachClassicLinkVpcOutcome>(), this, request);
+}
+
+AttachClassicLinkVpcOutcomeCallable EC2Client::AttachClassicLinkVpcCallable(AttachClassicLinkVpcRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::AttachClassicLinkVpc, Aws::Client::RejectedCallOutcome<AttachClassicLinkVpcOutcome>(), this, std::move(request));
 }
 
 void EC2Client::AttachClassicLinkVpcAsync(const AttachClassicLinkVpcRequest& request, const AttachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::AttachClassicLinkVpcAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::AttachClassicLinkVpcAsyncHelper, Aws::Client::RejectedAsyncCall<AttachClassicLinkVpcOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::AttachClassicLinkVpcAsync(AttachClassicLinkVpcRequest&& request, const AttachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::AttachClassicLinkVpcAsyncHelper, Aws::Client::RejectedAsyncCall<AttachClassicLinkVpcOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::AttachClassicLinkVpcAsyncHelper(const AttachClassicLinkVpcRequest& request, const AttachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -547,12 +627,22 @@ AttachInternetGatewayOutcome EC2Client::AttachInternetGateway(const AttachIntern
 
 AttachInternetGatewayOutcomeCallable EC2Client::AttachInternetGatewayCallable(const AttachInternetGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::AttachInternetGateway, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::AttachInternetGateway, Aws::Client::RejectedCallOutcome<AttachInternetGatewayOutcome>(), this, request);
+}
+
+AttachInternetGatewayOutcomeCallable EC2Client::AttachInternetGatewayCallable(AttachInternetGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::AttachInternetGateway, Aws::Client::RejectedCallOutcome<AttachInternetGatewayOutcome>(), this, std::move(request));
 }
 
 void EC2Client::AttachInternetGatewayAsync(const AttachInternetGatewayRequest& request, const AttachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::AttachInternetGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::AttachInternetGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<AttachInternetGatewayOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::AttachInternetGatewayAsync(AttachInternetGatewayRequest&& request, const AttachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::AttachInternetGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<AttachInternetGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::AttachInternetGatewayAsyncHelper(const AttachInternetGatewayRequest& request, const AttachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -577,12 +667,22 @@ AttachNetworkInterfaceOutcome EC2Client::AttachNetworkInterface(const AttachNetw
 
 AttachNetworkInterfaceOutcomeCallable EC2Client::AttachNetworkInterfaceCallable(const AttachNetworkInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::AttachNetworkInterface, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::AttachNetworkInterface, Aws::Client::RejectedCallOutcome<AttachNetworkInterfaceOutcome>(), this, request);
+}
+
+AttachNetworkInterfaceOutcomeCallable EC2Client::AttachNetworkInterfaceCallable(AttachNetworkInterfaceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::AttachNetworkInterface, Aws::Client::RejectedCallOutcome<AttachNetworkInterfaceOutcome>(), this, std::move(request));
 }
 
 void EC2Client::AttachNetworkInterfaceAsync(const AttachNetworkInterfaceRequest& request, const AttachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::AttachNetworkInterfaceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::AttachNetworkInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<AttachNetworkInterfaceOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::AttachNetworkInterfaceAsync(AttachNetworkInterfaceRequest&& request, const AttachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::AttachNetworkInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<AttachNetworkInterfaceOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::AttachNetworkInterfaceAsyncHelper(const AttachNetworkInterfaceRequest& request, const AttachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -607,12 +707,22 @@ AttachVolumeOutcome EC2Client::AttachVolume(const AttachVolumeRequest& request)
 
 AttachVolumeOutcomeCallable EC2Client::AttachVolumeCallable(const AttachVolumeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::AttachVolume, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::AttachVolume, Aws::Client::RejectedCallOutcome<AttachVolumeOutcome>(), this, request);
+}
+
+AttachVolumeOutcomeCallable EC2Client::AttachVolumeCallable(AttachVolumeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::AttachVolume, Aws::Client::RejectedCallOutcome<AttachVolumeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::AttachVolumeAsync(const AttachVolumeRequest& request, const AttachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::AttachVolumeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::AttachVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<AttachVolumeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::AttachVolumeAsync(AttachVolumeRequest&& request, const AttachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::AttachVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<AttachVolumeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::AttachVolumeAsyncHelper(const AttachVolumeRequest& request, const AttachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -637,12 +747,22 @@ AttachVpnGatewayOutcome EC2Client::AttachVpnGateway(const AttachVpnGatewayReques
 
 AttachVpnGatewayOutcomeCallable EC2Client::AttachVpnGatewayCallable(const AttachVpnGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::AttachVpnGateway, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::AttachVpnGateway, Aws::Client::RejectedCallOutcome<AttachVpnGatewayOutcome>(), this, request);
+}
+
+AttachVpnGatewayOutcomeCallable EC2Client::AttachVpnGatewayCallable(AttachVpnGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::AttachVpnGateway, Aws::Client::RejectedCallOutcome<AttachVpnGatewayOutcome>(), this, std::move(request));
 }
 
 void EC2Client::AttachVpnGatewayAsync(const AttachVpnGatewayRequest& request, const AttachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::AttachVpnGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::AttachVpnGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<AttachVpnGatewayOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::AttachVpnGatewayAsync(AttachVpnGatewayRequest&& request, const AttachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::AttachVpnGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<AttachVpnGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::AttachVpnGatewayAsyncHelper(const AttachVpnGatewayRequest& request, const AttachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -667,12 +787,22 @@ AuthorizeSecurityGroupEgressOutcome EC2Client::AuthorizeSecurityGroupEgress(cons
 
 AuthorizeSecurityGroupEgressOutcomeCallable EC2Client::AuthorizeSecurityGroupEgressCallable(const AuthorizeSecurityGroupEgressRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::AuthorizeSecurityGroupEgress, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::AuthorizeSecurityGroupEgress, Aws::Client::RejectedCallOutcome<AuthorizeSecurityGroupEgressOutcome>(), this, request);
+}
+
+AuthorizeSecurityGroupEgressOutcomeCallable EC2Client::AuthorizeSecurityGroupEgressCallable(AuthorizeSecurityGroupEgressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::AuthorizeSecurityGroupEgress, Aws::Client::RejectedCallOutcome<AuthorizeSecurityGroupEgressOutcome>(), this, std::move(request));
 }
 
 void EC2Client::AuthorizeSecurityGroupEgressAsync(const AuthorizeSecurityGroupEgressRequest& request, const AuthorizeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::AuthorizeSecurityGroupEgressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::AuthorizeSecurityGroupEgressAsyncHelper, Aws::Client::RejectedAsyncCall<AuthorizeSecurityGroupEgressOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::AuthorizeSecurityGroupEgressAsync(AuthorizeSecurityGroupEgressRequest&& request, const AuthorizeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::AuthorizeSecurityGroupEgressAsyncHelper, Aws::Client::RejectedAsyncCall<AuthorizeSecurityGroupEgressOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::AuthorizeSecurityGroupEgressAsyncHelper(const AuthorizeSecurityGroupEgressRequest& request, const AuthorizeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -697,12 +827,22 @@ AuthorizeSecurityGroupIngressOutcome EC2Client::AuthorizeSecurityGroupIngress(co
 
 AuthorizeSecurityGroupIngressOutcomeCallable EC2Client::AuthorizeSecurityGroupIngressCallable(const AuthorizeSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::AuthorizeSecurityGroupIngress, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::AuthorizeSecurityGroupIngress, Aws::Client::RejectedCallOutcome<AuthorizeSecurityGroupIngressOutcome>(), this, request);
+}
+
+AuthorizeSecurityGroupIngressOutcomeCallable EC2Client::AuthorizeSecurityGroupIngressCallable(AuthorizeSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::AuthorizeSecurityGroupIngress, Aws::Client::RejectedCallOutcome<AuthorizeSecurityGroupIngressOutcome>(), this, std::move(request));
 }
 
 void EC2Client::AuthorizeSecurityGroupIngressAsync(const AuthorizeSecurityGroupIngressRequest& request, const AuthorizeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::AuthorizeSecurityGroupIngressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::AuthorizeSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<AuthorizeSecurityGroupIngressOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::AuthorizeSecurityGroupIngressAsync(AuthorizeSecurityGroupIngressRequest&& request, const AuthorizeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::AuthorizeSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<AuthorizeSecurityGroupIngressOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::AuthorizeSecurityGroupIngressAsyncHelper(const AuthorizeSecurityGroupIngressRequest& request, const AuthorizeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -727,12 +867,22 @@ BundleInstanceOutcome EC2Client::BundleInstance(const BundleInstanceRequest& req
 
 BundleInstanceOutcomeCallable EC2Client::BundleInstanceCallable(const BundleInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::BundleInstance, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::BundleInstance, Aws::Client::RejectedCallOutcome<BundleInstanceOutcome>(), this, request);
+}
+
+BundleInstanceOutcomeCallable EC2Client::BundleInstanceCallable(BundleInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::BundleInstance, Aws::Client::RejectedCallOutcome<BundleInstanceOutcome>(), this, std::move(request));
 }
 
 void EC2Client::BundleInstanceAsync(const BundleInstanceRequest& request, const BundleInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::BundleInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::BundleInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<BundleInstanceOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::BundleInstanceAsync(BundleInstanceRequest&& request, const BundleInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::BundleInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<BundleInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::BundleInstanceAsyncHelper(const BundleInstanceRequest& request, const BundleInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -757,12 +907,22 @@ CancelBundleTaskOutcome EC2Client::CancelBundleTask(const CancelBundleTaskReques
 
 CancelBundleTaskOutcomeCallable EC2Client::CancelBundleTaskCallable(const CancelBundleTaskRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CancelBundleTask, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CancelBundleTask, Aws::Client::RejectedCallOutcome<CancelBundleTaskOutcome>(), this, request);
+}
+
+CancelBundleTaskOutcomeCallable EC2Client::CancelBundleTaskCallable(CancelBundleTaskRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CancelBundleTask, Aws::Client::RejectedCallOutcome<CancelBundleTaskOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CancelBundleTaskAsync(const CancelBundleTaskRequest& request, const CancelBundleTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CancelBundleTaskAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CancelBundleTaskAsyncHelper, Aws::Client::RejectedAsyncCall<CancelBundleTaskOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CancelBundleTaskAsync(CancelBundleTaskRequest&& request, const CancelBundleTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CancelBundleTaskAsyncHelper, Aws::Client::RejectedAsyncCall<CancelBundleTaskOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CancelBundleTaskAsyncHelper(const CancelBundleTaskRequest& request, const CancelBundleTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -787,12 +947,22 @@ CancelConversionTaskOutcome EC2Client::CancelConversionTask(const CancelConversi
 
 CancelConversionTaskOutcomeCallable EC2Client::CancelConversionTaskCallable(const CancelConversionTaskRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CancelConversionTask, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CancelConversionTask, Aws::Client::RejectedCallOutcome<CancelConversionTaskOutcome>(), this, request);
+}
+
+CancelConversionTaskOutcomeCallable EC2Client::CancelConversionTaskCallable(CancelConversionTaskRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CancelConversionTask, Aws::Client::RejectedCallOutcome<CancelConversionTaskOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CancelConversionTaskAsync(const CancelConversionTaskRequest& request, const CancelConversionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CancelConversionTaskAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CancelConversionTaskAsyncHelper, Aws::Client::RejectedAsyncCall<CancelConversionTaskOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CancelConversionTaskAsync(CancelConversionTaskRequest&& request, const CancelConversionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CancelConversionTaskAsyncHelper, Aws::Client::RejectedAsyncCall<CancelConversionTaskOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CancelConversionTaskAsyncHelper(const CancelConversionTaskRequest& request, const CancelConversionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -817,12 +987,22 @@ CancelExportTaskOutcome EC2Client::CancelExportTask(const CancelExportTaskReques
 
 CancelExportTaskOutcomeCallable EC2Client::CancelExportTaskCallable(const CancelExportTaskRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CancelExportTask, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CancelExportTask, Aws::Client::RejectedCallOutcome<CancelExportTaskOutcome>(), this, request);
+}
+
+CancelExportTaskOutcomeCallable EC2Client::CancelExportTaskCallable(CancelExportTaskRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CancelExportTask, Aws::Client::RejectedCallOutcome<CancelExportTaskOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CancelExportTaskAsync(const CancelExportTaskRequest& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CancelExportTaskAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CancelExportTaskAsyncHelper, Aws::Client::RejectedAsyncCall<CancelExportTaskOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CancelExportTaskAsync(CancelExportTaskRequest&& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CancelExportTaskAsyncHelper, Aws::Client::RejectedAsyncCall<CancelExportTaskOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CancelExportTaskAsyncHelper(const CancelExportTaskRequest& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -847,12 +1027,22 @@ CancelImportTaskOutcome EC2Client::CancelImportTask(const CancelImportTaskReques
 
 CancelImportTaskOutcomeCallable EC2Client::CancelImportTaskCallable(const CancelImportTaskRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CancelImportTask, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CancelImportTask, Aws::Client::RejectedCallOutcome<CancelImportTaskOutcome>(), this, request);
+}
+
+CancelImportTaskOutcomeCallable EC2Client::CancelImportTaskCallable(CancelImportTaskRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CancelImportTask, Aws::Client::RejectedCallOutcome<CancelImportTaskOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CancelImportTaskAsync(const CancelImportTaskRequest& request, const CancelImportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CancelImportTaskAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CancelImportTaskAsyncHelper, Aws::Client::RejectedAsyncCall<CancelImportTaskOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CancelImportTaskAsync(CancelImportTaskRequest&& request, const CancelImportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CancelImportTaskAsyncHelper, Aws::Client::RejectedAsyncCall<CancelImportTaskOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CancelImportTaskAsyncHelper(const CancelImportTaskRequest& request, const CancelImportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -877,12 +1067,22 @@ CancelReservedInstancesListingOutcome EC2Client::CancelReservedInstancesListing(
 
 CancelReservedInstancesListingOutcomeCallable EC2Client::CancelReservedInstancesListingCallable(const CancelReservedInstancesListingRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CancelReservedInstancesListing, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CancelReservedInstancesListing, Aws::Client::RejectedCallOutcome<CancelReservedInstancesListingOutcome>(), this, request);
+}
+
+CancelReservedInstancesListingOutcomeCallable EC2Client::CancelReservedInstancesListingCallable(CancelReservedInstancesListingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CancelReservedInstancesListing, Aws::Client::RejectedCallOutcome<CancelReservedInstancesListingOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CancelReservedInstancesListingAsync(const CancelReservedInstancesListingRequest& request, const CancelReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CancelReservedInstancesListingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CancelReservedInstancesListingAsyncHelper, Aws::Client::RejectedAsyncCall<CancelReservedInstancesListingOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CancelReservedInstancesListingAsync(CancelReservedInstancesListingRequest&& request, const CancelReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CancelReservedInstancesListingAsyncHelper, Aws::Client::RejectedAsyncCall<CancelReservedInstancesListingOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CancelReservedInstancesListingAsyncHelper(const CancelReservedInstancesListingRequest& request, const CancelReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -907,12 +1107,22 @@ CancelSpotFleetRequestsOutcome EC2Client::CancelSpotFleetRequests(const CancelSp
 
 CancelSpotFleetRequestsOutcomeCallable EC2Client::CancelSpotFleetRequestsCallable(const CancelSpotFleetRequestsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CancelSpotFleetRequests, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CancelSpotFleetRequests, Aws::Client::RejectedCallOutcome<CancelSpotFleetRequestsOutcome>(), this, request);
+}
+
+CancelSpotFleetRequestsOutcomeCallable EC2Client::CancelSpotFleetRequestsCallable(CancelSpotFleetRequestsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CancelSpotFleetRequests, Aws::Client::RejectedCallOutcome<CancelSpotFleetRequestsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CancelSpotFleetRequestsAsync(const CancelSpotFleetRequestsRequest& request, const CancelSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CancelSpotFleetRequestsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CancelSpotFleetRequestsAsyncHelper, Aws::Client::RejectedAsyncCall<CancelSpotFleetRequestsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CancelSpotFleetRequestsAsync(CancelSpotFleetRequestsRequest&& request, const CancelSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CancelSpotFleetRequestsAsyncHelper, Aws::Client::RejectedAsyncCall<CancelSpotFleetRequestsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CancelSpotFleetRequestsAsyncHelper(const CancelSpotFleetRequestsRequest& request, const CancelSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -937,12 +1147,22 @@ CancelSpotInstanceRequestsOutcome EC2Client::CancelSpotInstanceRequests(const Ca
 
 CancelSpotInstanceRequestsOutcomeCallable EC2Client::CancelSpotInstanceRequestsCallable(const CancelSpotInstanceRequestsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CancelSpotInstanceRequests, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CancelSpotInstanceRequests, Aws::Client::RejectedCallOutcome<CancelSpotInstanceRequestsOutcome>(), this, request);
+}
+
+CancelSpotInstanceRequestsOutcomeCallable EC2Client::CancelSpotInstanceRequestsCallable(CancelSpotInstanceRequestsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CancelSpotInstanceRequests, Aws::Client::RejectedCallOutcome<CancelSpotInstanceRequestsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CancelSpotInstanceRequestsAsync(const CancelSpotInstanceRequestsRequest& request, const CancelSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CancelSpotInstanceRequestsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CancelSpotInstanceRequestsAsyncHelper, Aws::Client::RejectedAsyncCall<CancelSpotInstanceRequestsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CancelSpotInstanceRequestsAsync(CancelSpotInstanceRequestsRequest&& request, const CancelSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CancelSpotInstanceRequestsAsyncHelper, Aws::Client::RejectedAsyncCall<CancelSpotInstanceRequestsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CancelSpotInstanceRequestsAsyncHelper(const CancelSpotInstanceRequestsRequest& request, const CancelSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -967,12 +1187,22 @@ ConfirmProductInstanceOutcome EC2Client::ConfirmProductInstance(const ConfirmPro
 
 ConfirmProductInstanceOutcomeCallable EC2Client::ConfirmProductInstanceCallable(const ConfirmProductInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ConfirmProductInstance, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ConfirmProductInstance, Aws::Client::RejectedCallOutcome<ConfirmProductInstanceOutcome>(), this, request);
+}
+
+ConfirmProductInstanceOutcomeCallable EC2Client::ConfirmProductInstanceCallable(ConfirmProductInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ConfirmProductInstance, Aws::Client::RejectedCallOutcome<ConfirmProductInstanceOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ConfirmProductInstanceAsync(const ConfirmProductInstanceRequest& request, const ConfirmProductInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ConfirmProductInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ConfirmProductInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<ConfirmProductInstanceOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ConfirmProductInstanceAsync(ConfirmProductInstanceRequest&& request, const ConfirmProductInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ConfirmProductInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<ConfirmProductInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ConfirmProductInstanceAsyncHelper(const ConfirmProductInstanceRequest& request, const ConfirmProductInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -997,12 +1227,22 @@ CopyImageOutcome EC2Client::CopyImage(const CopyImageRequest& request) const
 
 CopyImageOutcomeCallable EC2Client::CopyImageCallable(const CopyImageRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CopyImage, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CopyImage, Aws::Client::RejectedCallOutcome<CopyImageOutcome>(), this, request);
+}
+
+CopyImageOutcomeCallable EC2Client::CopyImageCallable(CopyImageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CopyImage, Aws::Client::RejectedCallOutcome<CopyImageOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CopyImageAsync(const CopyImageRequest& request, const CopyImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CopyImageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CopyImageAsyncHelper, Aws::Client::RejectedAsyncCall<CopyImageOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CopyImageAsync(CopyImageRequest&& request, const CopyImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CopyImageAsyncHelper, Aws::Client::RejectedAsyncCall<CopyImageOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CopyImageAsyncHelper(const CopyImageRequest& request, const CopyImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1027,12 +1267,22 @@ CopySnapshotOutcome EC2Client::CopySnapshot(const CopySnapshotRequest& request)
 
 CopySnapshotOutcomeCallable EC2Client::CopySnapshotCallable(const CopySnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CopySnapshot, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CopySnapshot, Aws::Client::RejectedCallOutcome<CopySnapshotOutcome>(), this, request);
+}
+
+CopySnapshotOutcomeCallable EC2Client::CopySnapshotCallable(CopySnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CopySnapshot, Aws::Client::RejectedCallOutcome<CopySnapshotOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CopySnapshotAsync(const CopySnapshotRequest& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CopySnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CopySnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CopySnapshotOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CopySnapshotAsync(CopySnapshotRequest&& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CopySnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CopySnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CopySnapshotAsyncHelper(const CopySnapshotRequest& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1057,12 +1307,22 @@ CreateCustomerGatewayOutcome EC2Client::CreateCustomerGateway(const CreateCustom
 
 CreateCustomerGatewayOutcomeCallable EC2Client::CreateCustomerGatewayCallable(const CreateCustomerGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateCustomerGateway, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateCustomerGateway, Aws::Client::RejectedCallOutcome<CreateCustomerGatewayOutcome>(), this, request);
+}
+
+CreateCustomerGatewayOutcomeCallable EC2Client::CreateCustomerGatewayCallable(CreateCustomerGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateCustomerGateway, Aws::Client::RejectedCallOutcome<CreateCustomerGatewayOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateCustomerGatewayAsync(const CreateCustomerGatewayRequest& request, const CreateCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateCustomerGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateCustomerGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCustomerGatewayOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateCustomerGatewayAsync(CreateCustomerGatewayRequest&& request, const CreateCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateCustomerGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCustomerGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateCustomerGatewayAsyncHelper(const CreateCustomerGatewayRequest& request, const CreateCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1087,12 +1347,22 @@ CreateDhcpOptionsOutcome EC2Client::CreateDhcpOptions(const CreateDhcpOptionsReq
 
 CreateDhcpOptionsOutcomeCallable EC2Client::CreateDhcpOptionsCallable(const CreateDhcpOptionsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateDhcpOptions, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateDhcpOptions, Aws::Client::RejectedCallOutcome<CreateDhcpOptionsOutcome>(), this, request);
+}
+
+CreateDhcpOptionsOutcomeCallable EC2Client::CreateDhcpOptionsCallable(CreateDhcpOptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateDhcpOptions, Aws::Client::RejectedCallOutcome<CreateDhcpOptionsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateDhcpOptionsAsync(const CreateDhcpOptionsRequest& request, const CreateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateDhcpOptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateDhcpOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDhcpOptionsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateDhcpOptionsAsync(CreateDhcpOptionsRequest&& request, const CreateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateDhcpOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDhcpOptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateDhcpOptionsAsyncHelper(const CreateDhcpOptionsRequest& request, const CreateDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1117,12 +1387,22 @@ CreateFlowLogsOutcome EC2Client::CreateFlowLogs(const CreateFlowLogsRequest& req
 
 CreateFlowLogsOutcomeCallable EC2Client::CreateFlowLogsCallable(const CreateFlowLogsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateFlowLogs, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateFlowLogs, Aws::Client::RejectedCallOutcome<CreateFlowLogsOutcome>(), this, request);
+}
+
+CreateFlowLogsOutcomeCallable EC2Client::CreateFlowLogsCallable(CreateFlowLogsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateFlowLogs, Aws::Client::RejectedCallOutcome<CreateFlowLogsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateFlowLogsAsync(const CreateFlowLogsRequest& request, const CreateFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateFlowLogsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateFlowLogsAsyncHelper, Aws::Client::RejectedAsyncCall<CreateFlowLogsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateFlowLogsAsync(CreateFlowLogsRequest&& request, const CreateFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateFlowLogsAsyncHelper, Aws::Client::RejectedAsyncCall<CreateFlowLogsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateFlowLogsAsyncHelper(const CreateFlowLogsRequest& request, const CreateFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1147,12 +1427,22 @@ CreateImageOutcome EC2Client::CreateImage(const CreateImageRequest& request) con
 
 CreateImageOutcomeCallable EC2Client::CreateImageCallable(const CreateImageRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateImage, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateImage, Aws::Client::RejectedCallOutcome<CreateImageOutcome>(), this, request);
+}
+
+CreateImageOutcomeCallable EC2Client::CreateImageCallable(CreateImageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateImage, Aws::Client::RejectedCallOutcome<CreateImageOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateImageAsync(const CreateImageRequest& request, const CreateImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateImageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateImageAsyncHelper, Aws::Client::RejectedAsyncCall<CreateImageOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateImageAsync(CreateImageRequest&& request, const CreateImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateImageAsyncHelper, Aws::Client::RejectedAsyncCall<CreateImageOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateImageAsyncHelper(const CreateImageRequest& request, const CreateImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1177,12 +1467,22 @@ CreateInstanceExportTaskOutcome EC2Client::CreateInstanceExportTask(const Create
 
 CreateInstanceExportTaskOutcomeCallable EC2Client::CreateInstanceExportTaskCallable(const CreateInstanceExportTaskRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateInstanceExportTask, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateInstanceExportTask, Aws::Client::RejectedCallOutcome<CreateInstanceExportTaskOutcome>(), this, request);
+}
+
+CreateInstanceExportTaskOutcomeCallable EC2Client::CreateInstanceExportTaskCallable(CreateInstanceExportTaskRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateInstanceExportTask, Aws::Client::RejectedCallOutcome<CreateInstanceExportTaskOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateInstanceExportTaskAsync(const CreateInstanceExportTaskRequest& request, const CreateInstanceExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateInstanceExportTaskAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateInstanceExportTaskAsyncHelper, Aws::Client::RejectedAsyncCall<CreateInstanceExportTaskOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateInstanceExportTaskAsync(CreateInstanceExportTaskRequest&& request, const CreateInstanceExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateInstanceExportTaskAsyncHelper, Aws::Client::RejectedAsyncCall<CreateInstanceExportTaskOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateInstanceExportTaskAsyncHelper(const CreateInstanceExportTaskRequest& request, const CreateInstanceExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1207,12 +1507,22 @@ CreateInternetGatewayOutcome EC2Client::CreateInternetGateway(const CreateIntern
 
 CreateInternetGatewayOutcomeCallable EC2Client::CreateInternetGatewayCallable(const CreateInternetGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateInternetGateway, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateInternetGateway, Aws::Client::RejectedCallOutcome<CreateInternetGatewayOutcome>(), this, request);
+}
+
+CreateInternetGatewayOutcomeCallable EC2Client::CreateInternetGatewayCallable(CreateInternetGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateInternetGateway, Aws::Client::RejectedCallOutcome<CreateInternetGatewayOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateInternetGatewayAsync(const CreateInternetGatewayRequest& request, const CreateInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateInternetGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateInternetGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<CreateInternetGatewayOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateInternetGatewayAsync(CreateInternetGatewayRequest&& request, const CreateInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateInternetGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<CreateInternetGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateInternetGatewayAsyncHelper(const CreateInternetGatewayRequest& request, const CreateInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1237,12 +1547,22 @@ CreateKeyPairOutcome EC2Client::CreateKeyPair(const CreateKeyPairRequest& reques
 
 CreateKeyPairOutcomeCallable EC2Client::CreateKeyPairCallable(const CreateKeyPairRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateKeyPair, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateKeyPair, Aws::Client::RejectedCallOutcome<CreateKeyPairOutcome>(), this, request);
+}
+
+CreateKeyPairOutcomeCallable EC2Client::CreateKeyPairCallable(CreateKeyPairRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateKeyPair, Aws::Client::RejectedCallOutcome<CreateKeyPairOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateKeyPairAsync(const CreateKeyPairRequest& request, const CreateKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateKeyPairAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateKeyPairAsyncHelper, Aws::Client::RejectedAsyncCall<CreateKeyPairOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateKeyPairAsync(CreateKeyPairRequest&& request, const CreateKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateKeyPairAsyncHelper, Aws::Client::RejectedAsyncCall<CreateKeyPairOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateKeyPairAsyncHelper(const CreateKeyPairRequest& request, const CreateKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1267,12 +1587,22 @@ CreateNatGatewayOutcome EC2Client::CreateNatGateway(const CreateNatGatewayReques
 
 CreateNatGatewayOutcomeCallable EC2Client::CreateNatGatewayCallable(const CreateNatGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateNatGateway, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateNatGateway, Aws::Client::RejectedCallOutcome<CreateNatGatewayOutcome>(), this, request);
+}
+
+CreateNatGatewayOutcomeCallable EC2Client::CreateNatGatewayCallable(CreateNatGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateNatGateway, Aws::Client::RejectedCallOutcome<CreateNatGatewayOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateNatGatewayAsync(const CreateNatGatewayRequest& request, const CreateNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateNatGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateNatGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<CreateNatGatewayOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateNatGatewayAsync(CreateNatGatewayRequest&& request, const CreateNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateNatGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<CreateNatGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateNatGatewayAsyncHelper(const CreateNatGatewayRequest& request, const CreateNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1297,12 +1627,22 @@ CreateNetworkAclOutcome EC2Client::CreateNetworkAcl(const CreateNetworkAclReques
 
 CreateNetworkAclOutcomeCallable EC2Client::CreateNetworkAclCallable(const CreateNetworkAclRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateNetworkAcl, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateNetworkAcl, Aws::Client::RejectedCallOutcome<CreateNetworkAclOutcome>(), this, request);
+}
+
+CreateNetworkAclOutcomeCallable EC2Client::CreateNetworkAclCallable(CreateNetworkAclRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateNetworkAcl, Aws::Client::RejectedCallOutcome<CreateNetworkAclOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateNetworkAclAsync(const CreateNetworkAclRequest& request, const CreateNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateNetworkAclAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateNetworkAclAsyncHelper, Aws::Client::RejectedAsyncCall<CreateNetworkAclOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateNetworkAclAsync(CreateNetworkAclRequest&& request, const CreateNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateNetworkAclAsyncHelper, Aws::Client::RejectedAsyncCall<CreateNetworkAclOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateNetworkAclAsyncHelper(const CreateNetworkAclRequest& request, const CreateNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1327,12 +1667,22 @@ CreateNetworkAclEntryOutcome EC2Client::CreateNetworkAclEntry(const CreateNetwor
 
 CreateNetworkAclEntryOutcomeCallable EC2Client::CreateNetworkAclEntryCallable(const CreateNetworkAclEntryRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateNetworkAclEntry, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateNetworkAclEntry, Aws::Client::RejectedCallOutcome<CreateNetworkAclEntryOutcome>(), this, request);
+}
+
+CreateNetworkAclEntryOutcomeCallable EC2Client::CreateNetworkAclEntryCallable(CreateNetworkAclEntryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateNetworkAclEntry, Aws::Client::RejectedCallOutcome<CreateNetworkAclEntryOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateNetworkAclEntryAsync(const CreateNetworkAclEntryRequest& request, const CreateNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateNetworkAclEntryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateNetworkAclEntryAsyncHelper, Aws::Client::RejectedAsyncCall<CreateNetworkAclEntryOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateNetworkAclEntryAsync(CreateNetworkAclEntryRequest&& request, const CreateNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateNetworkAclEntryAsyncHelper, Aws::Client::RejectedAsyncCall<CreateNetworkAclEntryOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateNetworkAclEntryAsyncHelper(const CreateNetworkAclEntryRequest& request, const CreateNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1357,12 +1707,22 @@ CreateNetworkInterfaceOutcome EC2Client::CreateNetworkInterface(const CreateNetw
 
 CreateNetworkInterfaceOutcomeCallable EC2Client::CreateNetworkInterfaceCallable(const CreateNetworkInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateNetworkInterface, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateNetworkInterface, Aws::Client::RejectedCallOutcome<CreateNetworkInterfaceOutcome>(), this, request);
+}
+
+CreateNetworkInterfaceOutcomeCallable EC2Client::CreateNetworkInterfaceCallable(CreateNetworkInterfaceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateNetworkInterface, Aws::Client::RejectedCallOutcome<CreateNetworkInterfaceOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateNetworkInterfaceAsync(const CreateNetworkInterfaceRequest& request, const CreateNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateNetworkInterfaceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateNetworkInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<CreateNetworkInterfaceOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateNetworkInterfaceAsync(CreateNetworkInterfaceRequest&& request, const CreateNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateNetworkInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<CreateNetworkInterfaceOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateNetworkInterfaceAsyncHelper(const CreateNetworkInterfaceRequest& request, const CreateNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1387,12 +1747,22 @@ CreatePlacementGroupOutcome EC2Client::CreatePlacementGroup(const CreatePlacemen
 
 CreatePlacementGroupOutcomeCallable EC2Client::CreatePlacementGroupCallable(const CreatePlacementGroupRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreatePlacementGroup, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreatePlacementGroup, Aws::Client::RejectedCallOutcome<CreatePlacementGroupOutcome>(), this, request);
+}
+
+CreatePlacementGroupOutcomeCallable EC2Client::CreatePlacementGroupCallable(CreatePlacementGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreatePlacementGroup, Aws::Client::RejectedCallOutcome<CreatePlacementGroupOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreatePlacementGroupAsync(const CreatePlacementGroupRequest& request, const CreatePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreatePlacementGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreatePlacementGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePlacementGroupOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreatePlacementGroupAsync(CreatePlacementGroupRequest&& request, const CreatePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreatePlacementGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePlacementGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreatePlacementGroupAsyncHelper(const CreatePlacementGroupRequest& request, const CreatePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1417,12 +1787,22 @@ CreateReservedInstancesListingOutcome EC2Client::CreateReservedInstancesListing(
 
 CreateReservedInstancesListingOutcomeCallable EC2Client::CreateReservedInstancesListingCallable(const CreateReservedInstancesListingRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateReservedInstancesListing, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateReservedInstancesListing, Aws::Client::RejectedCallOutcome<CreateReservedInstancesListingOutcome>(), this, request);
+}
+
+CreateReservedInstancesListingOutcomeCallable EC2Client::CreateReservedInstancesListingCallable(CreateReservedInstancesListingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateReservedInstancesListing, Aws::Client::RejectedCallOutcome<CreateReservedInstancesListingOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateReservedInstancesListingAsync(const CreateReservedInstancesListingRequest& request, const CreateReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateReservedInstancesListingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateReservedInstancesListingAsyncHelper, Aws::Client::RejectedAsyncCall<CreateReservedInstancesListingOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateReservedInstancesListingAsync(CreateReservedInstancesListingRequest&& request, const CreateReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateReservedInstancesListingAsyncHelper, Aws::Client::RejectedAsyncCall<CreateReservedInstancesListingOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateReservedInstancesListingAsyncHelper(const CreateReservedInstancesListingRequest& request, const CreateReservedInstancesListingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1447,12 +1827,22 @@ CreateRouteOutcome EC2Client::CreateRoute(const CreateRouteRequest& request) con
 
 CreateRouteOutcomeCallable EC2Client::CreateRouteCallable(const CreateRouteRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateRoute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateRoute, Aws::Client::RejectedCallOutcome<CreateRouteOutcome>(), this, request);
+}
+
+CreateRouteOutcomeCallable EC2Client::CreateRouteCallable(CreateRouteRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateRoute, Aws::Client::RejectedCallOutcome<CreateRouteOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateRouteAsync(const CreateRouteRequest& request, const CreateRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateRouteAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateRouteAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRouteOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateRouteAsync(CreateRouteRequest&& request, const CreateRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateRouteAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRouteOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateRouteAsyncHelper(const CreateRouteRequest& request, const CreateRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1477,12 +1867,22 @@ CreateRouteTableOutcome EC2Client::CreateRouteTable(const CreateRouteTableReques
 
 CreateRouteTableOutcomeCallable EC2Client::CreateRouteTableCallable(const CreateRouteTableRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateRouteTable, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateRouteTable, Aws::Client::RejectedCallOutcome<CreateRouteTableOutcome>(), this, request);
+}
+
+CreateRouteTableOutcomeCallable EC2Client::CreateRouteTableCallable(CreateRouteTableRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateRouteTable, Aws::Client::RejectedCallOutcome<CreateRouteTableOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateRouteTableAsync(const CreateRouteTableRequest& request, const CreateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateRouteTableAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateRouteTableAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRouteTableOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateRouteTableAsync(CreateRouteTableRequest&& request, const CreateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateRouteTableAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRouteTableOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateRouteTableAsyncHelper(const CreateRouteTableRequest& request, const CreateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1507,12 +1907,22 @@ CreateSecurityGroupOutcome EC2Client::CreateSecurityGroup(const CreateSecurityGr
 
 CreateSecurityGroupOutcomeCallable EC2Client::CreateSecurityGroupCallable(const CreateSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateSecurityGroup, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateSecurityGroup, Aws::Client::RejectedCallOutcome<CreateSecurityGroupOutcome>(), this, request);
+}
+
+CreateSecurityGroupOutcomeCallable EC2Client::CreateSecurityGroupCallable(CreateSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateSecurityGroup, Aws::Client::RejectedCallOutcome<CreateSecurityGroupOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateSecurityGroupAsync(const CreateSecurityGroupRequest& request, const CreateSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateSecurityGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSecurityGroupOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateSecurityGroupAsync(CreateSecurityGroupRequest&& request, const CreateSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSecurityGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateSecurityGroupAsyncHelper(const CreateSecurityGroupRequest& request, const CreateSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1537,12 +1947,22 @@ CreateSnapshotOutcome EC2Client::CreateSnapshot(const CreateSnapshotRequest& req
 
 CreateSnapshotOutcomeCallable EC2Client::CreateSnapshotCallable(const CreateSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateSnapshot, Aws::Client::RejectedCallOutcome<CreateSnapshotOutcome>(), this, request);
+}
+
+CreateSnapshotOutcomeCallable EC2Client::CreateSnapshotCallable(CreateSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateSnapshot, Aws::Client::RejectedCallOutcome<CreateSnapshotOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateSnapshotAsync(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSnapshotOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateSnapshotAsync(CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateSnapshotAsyncHelper(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1567,12 +1987,22 @@ CreateSpotDatafeedSubscriptionOutcome EC2Client::CreateSpotDatafeedSubscription(
 
 CreateSpotDatafeedSubscriptionOutcomeCallable EC2Client::CreateSpotDatafeedSubscriptionCallable(const CreateSpotDatafeedSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateSpotDatafeedSubscription, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateSpotDatafeedSubscription, Aws::Client::RejectedCallOutcome<CreateSpotDatafeedSubscriptionOutcome>(), this, request);
+}
+
+CreateSpotDatafeedSubscriptionOutcomeCallable EC2Client::CreateSpotDatafeedSubscriptionCallable(CreateSpotDatafeedSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateSpotDatafeedSubscription, Aws::Client::RejectedCallOutcome<CreateSpotDatafeedSubscriptionOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateSpotDatafeedSubscriptionAsync(const CreateSpotDatafeedSubscriptionRequest& request, const CreateSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateSpotDatafeedSubscriptionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateSpotDatafeedSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSpotDatafeedSubscriptionOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateSpotDatafeedSubscriptionAsync(CreateSpotDatafeedSubscriptionRequest&& request, const CreateSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateSpotDatafeedSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSpotDatafeedSubscriptionOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateSpotDatafeedSubscriptionAsyncHelper(const CreateSpotDatafeedSubscriptionRequest& request, const CreateSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1597,12 +2027,22 @@ CreateSubnetOutcome EC2Client::CreateSubnet(const CreateSubnetRequest& request)
 
 CreateSubnetOutcomeCallable EC2Client::CreateSubnetCallable(const CreateSubnetRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateSubnet, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateSubnet, Aws::Client::RejectedCallOutcome<CreateSubnetOutcome>(), this, request);
+}
+
+CreateSubnetOutcomeCallable EC2Client::CreateSubnetCallable(CreateSubnetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateSubnet, Aws::Client::RejectedCallOutcome<CreateSubnetOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateSubnetAsync(const CreateSubnetRequest& request, const CreateSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateSubnetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateSubnetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSubnetOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateSubnetAsync(CreateSubnetRequest&& request, const CreateSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateSubnetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSubnetOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateSubnetAsyncHelper(const CreateSubnetRequest& request, const CreateSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1627,12 +2067,22 @@ CreateTagsOutcome EC2Client::CreateTags(const CreateTagsRequest& request) const
 
 CreateTagsOutcomeCallable EC2Client::CreateTagsCallable(const CreateTagsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateTags, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateTags, Aws::Client::RejectedCallOutcome<CreateTagsOutcome>(), this, request);
+}
+
+CreateTagsOutcomeCallable EC2Client::CreateTagsCallable(CreateTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateTags, Aws::Client::RejectedCallOutcome<CreateTagsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateTagsAsync(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateTagsAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTagsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateTagsAsync(CreateTagsRequest&& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateTagsAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateTagsAsyncHelper(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1657,12 +2107,22 @@ CreateVolumeOutcome EC2Client::CreateVolume(const CreateVolumeRequest& request)
 
 CreateVolumeOutcomeCallable EC2Client::CreateVolumeCallable(const CreateVolumeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateVolume, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateVolume, Aws::Client::RejectedCallOutcome<CreateVolumeOutcome>(), this, request);
+}
+
+CreateVolumeOutcomeCallable EC2Client::CreateVolumeCallable(CreateVolumeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateVolume, Aws::Client::RejectedCallOutcome<CreateVolumeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateVolumeAsync(const CreateVolumeRequest& request, const CreateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateVolumeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVolumeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateVolumeAsync(CreateVolumeRequest&& request, const CreateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVolumeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateVolumeAsyncHelper(const CreateVolumeRequest& request, const CreateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1687,12 +2147,22 @@ CreateVpcOutcome EC2Client::CreateVpc(const CreateVpcRequest& request) const
 
 CreateVpcOutcomeCallable EC2Client::CreateVpcCallable(const CreateVpcRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateVpc, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateVpc, Aws::Client::RejectedCallOutcome<CreateVpcOutcome>(), this, request);
+}
+
+CreateVpcOutcomeCallable EC2Client::CreateVpcCallable(CreateVpcRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateVpc, Aws::Client::RejectedCallOutcome<CreateVpcOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateVpcAsync(const CreateVpcRequest& request, const CreateVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateVpcAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateVpcAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVpcOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateVpcAsync(CreateVpcRequest&& request, const CreateVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateVpcAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVpcOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateVpcAsyncHelper(const CreateVpcRequest& request, const CreateVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1717,12 +2187,22 @@ CreateVpcEndpointOutcome EC2Client::CreateVpcEndpoint(const CreateVpcEndpointReq
 
 CreateVpcEndpointOutcomeCallable EC2Client::CreateVpcEndpointCallable(const CreateVpcEndpointRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateVpcEndpoint, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateVpcEndpoint, Aws::Client::RejectedCallOutcome<CreateVpcEndpointOutcome>(), this, request);
+}
+
+CreateVpcEndpointOutcomeCallable EC2Client::CreateVpcEndpointCallable(CreateVpcEndpointRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateVpcEndpoint, Aws::Client::RejectedCallOutcome<CreateVpcEndpointOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateVpcEndpointAsync(const CreateVpcEndpointRequest& request, const CreateVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateVpcEndpointAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateVpcEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVpcEndpointOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateVpcEndpointAsync(CreateVpcEndpointRequest&& request, const CreateVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateVpcEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVpcEndpointOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateVpcEndpointAsyncHelper(const CreateVpcEndpointRequest& request, const CreateVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1747,12 +2227,22 @@ CreateVpcPeeringConnectionOutcome EC2Client::CreateVpcPeeringConnection(const Cr
 
 CreateVpcPeeringConnectionOutcomeCallable EC2Client::CreateVpcPeeringConnectionCallable(const CreateVpcPeeringConnectionRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateVpcPeeringConnection, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateVpcPeeringConnection, Aws::Client::RejectedCallOutcome<CreateVpcPeeringConnectionOutcome>(), this, request);
+}
+
+CreateVpcPeeringConnectionOutcomeCallable EC2Client::CreateVpcPeeringConnectionCallable(CreateVpcPeeringConnectionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateVpcPeeringConnection, Aws::Client::RejectedCallOutcome<CreateVpcPeeringConnectionOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateVpcPeeringConnectionAsync(const CreateVpcPeeringConnectionRequest& request, const CreateVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateVpcPeeringConnectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateVpcPeeringConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVpcPeeringConnectionOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateVpcPeeringConnectionAsync(CreateVpcPeeringConnectionRequest&& request, const CreateVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateVpcPeeringConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVpcPeeringConnectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateVpcPeeringConnectionAsyncHelper(const CreateVpcPeeringConnectionRequest& request, const CreateVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1777,12 +2267,22 @@ CreateVpnConnectionOutcome EC2Client::CreateVpnConnection(const CreateVpnConnect
 
 CreateVpnConnectionOutcomeCallable EC2Client::CreateVpnConnectionCallable(const CreateVpnConnectionRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateVpnConnection, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateVpnConnection, Aws::Client::RejectedCallOutcome<CreateVpnConnectionOutcome>(), this, request);
+}
+
+CreateVpnConnectionOutcomeCallable EC2Client::CreateVpnConnectionCallable(CreateVpnConnectionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateVpnConnection, Aws::Client::RejectedCallOutcome<CreateVpnConnectionOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateVpnConnectionAsync(const CreateVpnConnectionRequest& request, const CreateVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateVpnConnectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateVpnConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVpnConnectionOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateVpnConnectionAsync(CreateVpnConnectionRequest&& request, const CreateVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateVpnConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVpnConnectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateVpnConnectionAsyncHelper(const CreateVpnConnectionRequest& request, const CreateVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1807,12 +2307,22 @@ CreateVpnConnectionRouteOutcome EC2Client::CreateVpnConnectionRoute(const Create
 
 CreateVpnConnectionRouteOutcomeCallable EC2Client::CreateVpnConnectionRouteCallable(const CreateVpnConnectionRouteRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateVpnConnectionRoute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateVpnConnectionRoute, Aws::Client::RejectedCallOutcome<CreateVpnConnectionRouteOutcome>(), this, request);
+}
+
+CreateVpnConnectionRouteOutcomeCallable EC2Client::CreateVpnConnectionRouteCallable(CreateVpnConnectionRouteRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateVpnConnectionRoute, Aws::Client::RejectedCallOutcome<CreateVpnConnectionRouteOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateVpnConnectionRouteAsync(const CreateVpnConnectionRouteRequest& request, const CreateVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateVpnConnectionRouteAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateVpnConnectionRouteAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVpnConnectionRouteOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateVpnConnectionRouteAsync(CreateVpnConnectionRouteRequest&& request, const CreateVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateVpnConnectionRouteAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVpnConnectionRouteOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateVpnConnectionRouteAsyncHelper(const CreateVpnConnectionRouteRequest& request, const CreateVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1837,12 +2347,22 @@ CreateVpnGatewayOutcome EC2Client::CreateVpnGateway(const CreateVpnGatewayReques
 
 CreateVpnGatewayOutcomeCallable EC2Client::CreateVpnGatewayCallable(const CreateVpnGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::CreateVpnGateway, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::CreateVpnGateway, Aws::Client::RejectedCallOutcome<CreateVpnGatewayOutcome>(), this, request);
+}
+
+CreateVpnGatewayOutcomeCallable EC2Client::CreateVpnGatewayCallable(CreateVpnGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::CreateVpnGateway, Aws::Client::RejectedCallOutcome<CreateVpnGatewayOutcome>(), this, std::move(request));
 }
 
 void EC2Client::CreateVpnGatewayAsync(const CreateVpnGatewayRequest& request, const CreateVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::CreateVpnGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::CreateVpnGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVpnGatewayOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::CreateVpnGatewayAsync(CreateVpnGatewayRequest&& request, const CreateVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::CreateVpnGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVpnGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::CreateVpnGatewayAsyncHelper(const CreateVpnGatewayRequest& request, const CreateVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1867,12 +2387,22 @@ DeleteCustomerGatewayOutcome EC2Client::DeleteCustomerGateway(const DeleteCustom
 
 DeleteCustomerGatewayOutcomeCallable EC2Client::DeleteCustomerGatewayCallable(const DeleteCustomerGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteCustomerGateway, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteCustomerGateway, Aws::Client::RejectedCallOutcome<DeleteCustomerGatewayOutcome>(), this, request);
+}
+
+DeleteCustomerGatewayOutcomeCallable EC2Client::DeleteCustomerGatewayCallable(DeleteCustomerGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteCustomerGateway, Aws::Client::RejectedCallOutcome<DeleteCustomerGatewayOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteCustomerGatewayAsync(const DeleteCustomerGatewayRequest& request, const DeleteCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteCustomerGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteCustomerGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCustomerGatewayOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteCustomerGatewayAsync(DeleteCustomerGatewayRequest&& request, const DeleteCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteCustomerGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCustomerGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteCustomerGatewayAsyncHelper(const DeleteCustomerGatewayRequest& request, const DeleteCustomerGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1897,12 +2427,22 @@ DeleteDhcpOptionsOutcome EC2Client::DeleteDhcpOptions(const DeleteDhcpOptionsReq
 
 DeleteDhcpOptionsOutcomeCallable EC2Client::DeleteDhcpOptionsCallable(const DeleteDhcpOptionsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteDhcpOptions, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteDhcpOptions, Aws::Client::RejectedCallOutcome<DeleteDhcpOptionsOutcome>(), this, request);
+}
+
+DeleteDhcpOptionsOutcomeCallable EC2Client::DeleteDhcpOptionsCallable(DeleteDhcpOptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteDhcpOptions, Aws::Client::RejectedCallOutcome<DeleteDhcpOptionsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteDhcpOptionsAsync(const DeleteDhcpOptionsRequest& request, const DeleteDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteDhcpOptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteDhcpOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDhcpOptionsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteDhcpOptionsAsync(DeleteDhcpOptionsRequest&& request, const DeleteDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteDhcpOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDhcpOptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteDhcpOptionsAsyncHelper(const DeleteDhcpOptionsRequest& request, const DeleteDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1927,12 +2467,22 @@ DeleteFlowLogsOutcome EC2Client::DeleteFlowLogs(const DeleteFlowLogsRequest& req
 
 DeleteFlowLogsOutcomeCallable EC2Client::DeleteFlowLogsCallable(const DeleteFlowLogsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteFlowLogs, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteFlowLogs, Aws::Client::RejectedCallOutcome<DeleteFlowLogsOutcome>(), this, request);
+}
+
+DeleteFlowLogsOutcomeCallable EC2Client::DeleteFlowLogsCallable(DeleteFlowLogsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteFlowLogs, Aws::Client::RejectedCallOutcome<DeleteFlowLogsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteFlowLogsAsync(const DeleteFlowLogsRequest& request, const DeleteFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteFlowLogsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteFlowLogsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteFlowLogsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteFlowLogsAsync(DeleteFlowLogsRequest&& request, const DeleteFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteFlowLogsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteFlowLogsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteFlowLogsAsyncHelper(const DeleteFlowLogsRequest& request, const DeleteFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1957,12 +2507,22 @@ DeleteInternetGatewayOutcome EC2Client::DeleteInternetGateway(const DeleteIntern
 
 DeleteInternetGatewayOutcomeCallable EC2Client::DeleteInternetGatewayCallable(const DeleteInternetGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteInternetGateway, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteInternetGateway, Aws::Client::RejectedCallOutcome<DeleteInternetGatewayOutcome>(), this, request);
+}
+
+DeleteInternetGatewayOutcomeCallable EC2Client::DeleteInternetGatewayCallable(DeleteInternetGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteInternetGateway, Aws::Client::RejectedCallOutcome<DeleteInternetGatewayOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteInternetGatewayAsync(const DeleteInternetGatewayRequest& request, const DeleteInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteInternetGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteInternetGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteInternetGatewayOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteInternetGatewayAsync(DeleteInternetGatewayRequest&& request, const DeleteInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteInternetGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteInternetGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteInternetGatewayAsyncHelper(const DeleteInternetGatewayRequest& request, const DeleteInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1987,12 +2547,22 @@ DeleteKeyPairOutcome EC2Client::DeleteKeyPair(const DeleteKeyPairRequest& reques
 
 DeleteKeyPairOutcomeCallable EC2Client::DeleteKeyPairCallable(const DeleteKeyPairRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteKeyPair, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteKeyPair, Aws::Client::RejectedCallOutcome<DeleteKeyPairOutcome>(), this, request);
+}
+
+DeleteKeyPairOutcomeCallable EC2Client::DeleteKeyPairCallable(DeleteKeyPairRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteKeyPair, Aws::Client::RejectedCallOutcome<DeleteKeyPairOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteKeyPairAsync(const DeleteKeyPairRequest& request, const DeleteKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteKeyPairAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteKeyPairAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteKeyPairOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteKeyPairAsync(DeleteKeyPairRequest&& request, const DeleteKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteKeyPairAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteKeyPairOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteKeyPairAsyncHelper(const DeleteKeyPairRequest& request, const DeleteKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2017,12 +2587,22 @@ DeleteNatGatewayOutcome EC2Client::DeleteNatGateway(const DeleteNatGatewayReques
 
 DeleteNatGatewayOutcomeCallable EC2Client::DeleteNatGatewayCallable(const DeleteNatGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteNatGateway, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteNatGateway, Aws::Client::RejectedCallOutcome<DeleteNatGatewayOutcome>(), this, request);
+}
+
+DeleteNatGatewayOutcomeCallable EC2Client::DeleteNatGatewayCallable(DeleteNatGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteNatGateway, Aws::Client::RejectedCallOutcome<DeleteNatGatewayOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteNatGatewayAsync(const DeleteNatGatewayRequest& request, const DeleteNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteNatGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteNatGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteNatGatewayOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteNatGatewayAsync(DeleteNatGatewayRequest&& request, const DeleteNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteNatGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteNatGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteNatGatewayAsyncHelper(const DeleteNatGatewayRequest& request, const DeleteNatGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2047,12 +2627,22 @@ DeleteNetworkAclOutcome EC2Client::DeleteNetworkAcl(const DeleteNetworkAclReques
 
 DeleteNetworkAclOutcomeCallable EC2Client::DeleteNetworkAclCallable(const DeleteNetworkAclRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteNetworkAcl, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteNetworkAcl, Aws::Client::RejectedCallOutcome<DeleteNetworkAclOutcome>(), this, request);
+}
+
+DeleteNetworkAclOutcomeCallable EC2Client::DeleteNetworkAclCallable(DeleteNetworkAclRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteNetworkAcl, Aws::Client::RejectedCallOutcome<DeleteNetworkAclOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteNetworkAclAsync(const DeleteNetworkAclRequest& request, const DeleteNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteNetworkAclAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteNetworkAclAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteNetworkAclOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteNetworkAclAsync(DeleteNetworkAclRequest&& request, const DeleteNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteNetworkAclAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteNetworkAclOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteNetworkAclAsyncHelper(const DeleteNetworkAclRequest& request, const DeleteNetworkAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2077,12 +2667,22 @@ DeleteNetworkAclEntryOutcome EC2Client::DeleteNetworkAclEntry(const DeleteNetwor
 
 DeleteNetworkAclEntryOutcomeCallable EC2Client::DeleteNetworkAclEntryCallable(const DeleteNetworkAclEntryRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteNetworkAclEntry, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteNetworkAclEntry, Aws::Client::RejectedCallOutcome<DeleteNetworkAclEntryOutcome>(), this, request);
+}
+
+DeleteNetworkAclEntryOutcomeCallable EC2Client::DeleteNetworkAclEntryCallable(DeleteNetworkAclEntryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteNetworkAclEntry, Aws::Client::RejectedCallOutcome<DeleteNetworkAclEntryOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteNetworkAclEntryAsync(const DeleteNetworkAclEntryRequest& request, const DeleteNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteNetworkAclEntryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteNetworkAclEntryAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteNetworkAclEntryOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteNetworkAclEntryAsync(DeleteNetworkAclEntryRequest&& request, const DeleteNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteNetworkAclEntryAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteNetworkAclEntryOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteNetworkAclEntryAsyncHelper(const DeleteNetworkAclEntryRequest& request, const DeleteNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2107,12 +2707,22 @@ DeleteNetworkInterfaceOutcome EC2Client::DeleteNetworkInterface(const DeleteNetw
 
 DeleteNetworkInterfaceOutcomeCallable EC2Client::DeleteNetworkInterfaceCallable(const DeleteNetworkInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteNetworkInterface, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteNetworkInterface, Aws::Client::RejectedCallOutcome<DeleteNetworkInterfaceOutcome>(), this, request);
+}
+
+DeleteNetworkInterfaceOutcomeCallable EC2Client::DeleteNetworkInterfaceCallable(DeleteNetworkInterfaceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteNetworkInterface, Aws::Client::RejectedCallOutcome<DeleteNetworkInterfaceOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteNetworkInterfaceAsync(const DeleteNetworkInterfaceRequest& request, const DeleteNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteNetworkInterfaceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteNetworkInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteNetworkInterfaceOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteNetworkInterfaceAsync(DeleteNetworkInterfaceRequest&& request, const DeleteNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteNetworkInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteNetworkInterfaceOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteNetworkInterfaceAsyncHelper(const DeleteNetworkInterfaceRequest& request, const DeleteNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2137,12 +2747,22 @@ DeletePlacementGroupOutcome EC2Client::DeletePlacementGroup(const DeletePlacemen
 
 DeletePlacementGroupOutcomeCallable EC2Client::DeletePlacementGroupCallable(const DeletePlacementGroupRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeletePlacementGroup, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeletePlacementGroup, Aws::Client::RejectedCallOutcome<DeletePlacementGroupOutcome>(), this, request);
+}
+
+DeletePlacementGroupOutcomeCallable EC2Client::DeletePlacementGroupCallable(DeletePlacementGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeletePlacementGroup, Aws::Client::RejectedCallOutcome<DeletePlacementGroupOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeletePlacementGroupAsync(const DeletePlacementGroupRequest& request, const DeletePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeletePlacementGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeletePlacementGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePlacementGroupOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeletePlacementGroupAsync(DeletePlacementGroupRequest&& request, const DeletePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeletePlacementGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePlacementGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeletePlacementGroupAsyncHelper(const DeletePlacementGroupRequest& request, const DeletePlacementGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2167,12 +2787,22 @@ DeleteRouteOutcome EC2Client::DeleteRoute(const DeleteRouteRequest& request) con
 
 DeleteRouteOutcomeCallable EC2Client::DeleteRouteCallable(const DeleteRouteRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteRoute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteRoute, Aws::Client::RejectedCallOutcome<DeleteRouteOutcome>(), this, request);
+}
+
+DeleteRouteOutcomeCallable EC2Client::DeleteRouteCallable(DeleteRouteRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteRoute, Aws::Client::RejectedCallOutcome<DeleteRouteOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteRouteAsync(const DeleteRouteRequest& request, const DeleteRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteRouteAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteRouteAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRouteOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteRouteAsync(DeleteRouteRequest&& request, const DeleteRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteRouteAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRouteOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteRouteAsyncHelper(const DeleteRouteRequest& request, const DeleteRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2197,12 +2827,22 @@ DeleteRouteTableOutcome EC2Client::DeleteRouteTable(const DeleteRouteTableReques
 
 DeleteRouteTableOutcomeCallable EC2Client::DeleteRouteTableCallable(const DeleteRouteTableRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteRouteTable, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteRouteTable, Aws::Client::RejectedCallOutcome<DeleteRouteTableOutcome>(), this, request);
+}
+
+DeleteRouteTableOutcomeCallable EC2Client::DeleteRouteTableCallable(DeleteRouteTableRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteRouteTable, Aws::Client::RejectedCallOutcome<DeleteRouteTableOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteRouteTableAsync(const DeleteRouteTableRequest& request, const DeleteRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteRouteTableAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteRouteTableAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRouteTableOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteRouteTableAsync(DeleteRouteTableRequest&& request, const DeleteRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteRouteTableAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRouteTableOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteRouteTableAsyncHelper(const DeleteRouteTableRequest& request, const DeleteRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2227,12 +2867,22 @@ DeleteSecurityGroupOutcome EC2Client::DeleteSecurityGroup(const DeleteSecurityGr
 
 DeleteSecurityGroupOutcomeCallable EC2Client::DeleteSecurityGroupCallable(const DeleteSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteSecurityGroup, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteSecurityGroup, Aws::Client::RejectedCallOutcome<DeleteSecurityGroupOutcome>(), this, request);
+}
+
+DeleteSecurityGroupOutcomeCallable EC2Client::DeleteSecurityGroupCallable(DeleteSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteSecurityGroup, Aws::Client::RejectedCallOutcome<DeleteSecurityGroupOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteSecurityGroupAsync(const DeleteSecurityGroupRequest& request, const DeleteSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteSecurityGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSecurityGroupOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteSecurityGroupAsync(DeleteSecurityGroupRequest&& request, const DeleteSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSecurityGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteSecurityGroupAsyncHelper(const DeleteSecurityGroupRequest& request, const DeleteSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2257,12 +2907,22 @@ DeleteSnapshotOutcome EC2Client::DeleteSnapshot(const DeleteSnapshotRequest& req
 
 DeleteSnapshotOutcomeCallable EC2Client::DeleteSnapshotCallable(const DeleteSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteSnapshot, Aws::Client::RejectedCallOutcome<DeleteSnapshotOutcome>(), this, request);
+}
+
+DeleteSnapshotOutcomeCallable EC2Client::DeleteSnapshotCallable(DeleteSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteSnapshot, Aws::Client::RejectedCallOutcome<DeleteSnapshotOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteSnapshotAsync(const DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSnapshotOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteSnapshotAsync(DeleteSnapshotRequest&& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteSnapshotAsyncHelper(const DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2287,12 +2947,22 @@ DeleteSpotDatafeedSubscriptionOutcome EC2Client::DeleteSpotDatafeedSubscription(
 
 DeleteSpotDatafeedSubscriptionOutcomeCallable EC2Client::DeleteSpotDatafeedSubscriptionCallable(const DeleteSpotDatafeedSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteSpotDatafeedSubscription, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteSpotDatafeedSubscription, Aws::Client::RejectedCallOutcome<DeleteSpotDatafeedSubscriptionOutcome>(), this, request);
+}
+
+DeleteSpotDatafeedSubscriptionOutcomeCallable EC2Client::DeleteSpotDatafeedSubscriptionCallable(DeleteSpotDatafeedSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteSpotDatafeedSubscription, Aws::Client::RejectedCallOutcome<DeleteSpotDatafeedSubscriptionOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteSpotDatafeedSubscriptionAsync(const DeleteSpotDatafeedSubscriptionRequest& request, const DeleteSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteSpotDatafeedSubscriptionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteSpotDatafeedSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSpotDatafeedSubscriptionOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteSpotDatafeedSubscriptionAsync(DeleteSpotDatafeedSubscriptionRequest&& request, const DeleteSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteSpotDatafeedSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSpotDatafeedSubscriptionOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteSpotDatafeedSubscriptionAsyncHelper(const DeleteSpotDatafeedSubscriptionRequest& request, const DeleteSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2317,12 +2987,22 @@ DeleteSubnetOutcome EC2Client::DeleteSubnet(const DeleteSubnetRequest& request)
 
 DeleteSubnetOutcomeCallable EC2Client::DeleteSubnetCallable(const DeleteSubnetRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteSubnet, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteSubnet, Aws::Client::RejectedCallOutcome<DeleteSubnetOutcome>(), this, request);
+}
+
+DeleteSubnetOutcomeCallable EC2Client::DeleteSubnetCallable(DeleteSubnetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteSubnet, Aws::Client::RejectedCallOutcome<DeleteSubnetOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteSubnetAsync(const DeleteSubnetRequest& request, const DeleteSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteSubnetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteSubnetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSubnetOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteSubnetAsync(DeleteSubnetRequest&& request, const DeleteSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteSubnetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSubnetOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteSubnetAsyncHelper(const DeleteSubnetRequest& request, const DeleteSubnetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2347,12 +3027,22 @@ DeleteTagsOutcome EC2Client::DeleteTags(const DeleteTagsRequest& request) const
 
 DeleteTagsOutcomeCallable EC2Client::DeleteTagsCallable(const DeleteTagsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteTags, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteTags, Aws::Client::RejectedCallOutcome<DeleteTagsOutcome>(), this, request);
+}
+
+DeleteTagsOutcomeCallable EC2Client::DeleteTagsCallable(DeleteTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteTags, Aws::Client::RejectedCallOutcome<DeleteTagsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTagsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteTagsAsync(DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteTagsAsyncHelper(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2377,12 +3067,22 @@ DeleteVolumeOutcome EC2Client::DeleteVolume(const DeleteVolumeRequest& request)
 
 DeleteVolumeOutcomeCallable EC2Client::DeleteVolumeCallable(const DeleteVolumeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteVolume, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteVolume, Aws::Client::RejectedCallOutcome<DeleteVolumeOutcome>(), this, request);
+}
+
+DeleteVolumeOutcomeCallable EC2Client::DeleteVolumeCallable(DeleteVolumeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteVolume, Aws::Client::RejectedCallOutcome<DeleteVolumeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteVolumeAsync(const DeleteVolumeRequest& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteVolumeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVolumeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteVolumeAsync(DeleteVolumeRequest&& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVolumeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteVolumeAsyncHelper(const DeleteVolumeRequest& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2407,12 +3107,22 @@ DeleteVpcOutcome EC2Client::DeleteVpc(const DeleteVpcRequest& request) const
 
 DeleteVpcOutcomeCallable EC2Client::DeleteVpcCallable(const DeleteVpcRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteVpc, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteVpc, Aws::Client::RejectedCallOutcome<DeleteVpcOutcome>(), this, request);
+}
+
+DeleteVpcOutcomeCallable EC2Client::DeleteVpcCallable(DeleteVpcRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteVpc, Aws::Client::RejectedCallOutcome<DeleteVpcOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteVpcAsync(const DeleteVpcRequest& request, const DeleteVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteVpcAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteVpcAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVpcOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteVpcAsync(DeleteVpcRequest&& request, const DeleteVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteVpcAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVpcOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteVpcAsyncHelper(const DeleteVpcRequest& request, const DeleteVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2437,12 +3147,22 @@ DeleteVpcEndpointsOutcome EC2Client::DeleteVpcEndpoints(const DeleteVpcEndpoints
 
 DeleteVpcEndpointsOutcomeCallable EC2Client::DeleteVpcEndpointsCallable(const DeleteVpcEndpointsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteVpcEndpoints, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteVpcEndpoints, Aws::Client::RejectedCallOutcome<DeleteVpcEndpointsOutcome>(), this, request);
+}
+
+DeleteVpcEndpointsOutcomeCallable EC2Client::DeleteVpcEndpointsCallable(DeleteVpcEndpointsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteVpcEndpoints, Aws::Client::RejectedCallOutcome<DeleteVpcEndpointsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteVpcEndpointsAsync(const DeleteVpcEndpointsRequest& request, const DeleteVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteVpcEndpointsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteVpcEndpointsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVpcEndpointsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteVpcEndpointsAsync(DeleteVpcEndpointsRequest&& request, const DeleteVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteVpcEndpointsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVpcEndpointsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteVpcEndpointsAsyncHelper(const DeleteVpcEndpointsRequest& request, const DeleteVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2465,14 +3185,24 @@ DeleteVpcPeeringConnectionOutcome EC2Client::DeleteVpcPeeringConnection(const De
   }
 }
 
-DeleteVpcPeeringConnectionOutcomeCallable EC2Client::DeleteVpcPeeringConnectionCallable(const DeleteVpcPeeringConnectionRequest& request) const
+DeleteVpcPeeringConnectionOutcomeCallable EC2Client::DeleteVpcPeeringConnectionCallable(const DeleteVpcPeeringConnectionRequest& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteVpcPeeringConnection, Aws::Client::RejectedCallOutcome<DeleteVpcPeeringConnectionOutcome>(), this, request);
+}
+
+DeleteVpcPeeringConnectionOutcomeCallable EC2Client::DeleteVpcPeeringConnectionCallable(DeleteVpcPeeringConnectionRequest&& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteVpcPeeringConnection, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteVpcPeeringConnection, Aws::Client::RejectedCallOutcome<DeleteVpcPeeringConnectionOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteVpcPeeringConnectionAsync(const DeleteVpcPeeringConnectionRequest& request, const DeleteVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteVpcPeeringConnectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteVpcPeeringConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVpcPeeringConnectionOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteVpcPeeringConnectionAsync(DeleteVpcPeeringConnectionRequest&& request, const DeleteVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteVpcPeeringConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVpcPeeringConnectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteVpcPeeringConnectionAsyncHelper(const DeleteVpcPeeringConnectionRequest& request, const DeleteVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2497,12 +3227,22 @@ DeleteVpnConnectionOutcome EC2Client::DeleteVpnConnection(const DeleteVpnConnect
 
 DeleteVpnConnectionOutcomeCallable EC2Client::DeleteVpnConnectionCallable(const DeleteVpnConnectionRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteVpnConnection, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteVpnConnection, Aws::Client::RejectedCallOutcome<DeleteVpnConnectionOutcome>(), this, request);
+}
+
+DeleteVpnConnectionOutcomeCallable EC2Client::DeleteVpnConnectionCallable(DeleteVpnConnectionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteVpnConnection, Aws::Client::RejectedCallOutcome<DeleteVpnConnectionOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteVpnConnectionAsync(const DeleteVpnConnectionRequest& request, const DeleteVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteVpnConnectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteVpnConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVpnConnectionOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteVpnConnectionAsync(DeleteVpnConnectionRequest&& request, const DeleteVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteVpnConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVpnConnectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteVpnConnectionAsyncHelper(const DeleteVpnConnectionRequest& request, const DeleteVpnConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2527,12 +3267,22 @@ DeleteVpnConnectionRouteOutcome EC2Client::DeleteVpnConnectionRoute(const Delete
 
 DeleteVpnConnectionRouteOutcomeCallable EC2Client::DeleteVpnConnectionRouteCallable(const DeleteVpnConnectionRouteRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteVpnConnectionRoute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteVpnConnectionRoute, Aws::Client::RejectedCallOutcome<DeleteVpnConnectionRouteOutcome>(), this, request);
+}
+
+DeleteVpnConnectionRouteOutcomeCallable EC2Client::DeleteVpnConnectionRouteCallable(DeleteVpnConnectionRouteRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteVpnConnectionRoute, Aws::Client::RejectedCallOutcome<DeleteVpnConnectionRouteOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteVpnConnectionRouteAsync(const DeleteVpnConnectionRouteRequest& request, const DeleteVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteVpnConnectionRouteAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteVpnConnectionRouteAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVpnConnectionRouteOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteVpnConnectionRouteAsync(DeleteVpnConnectionRouteRequest&& request, const DeleteVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteVpnConnectionRouteAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVpnConnectionRouteOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteVpnConnectionRouteAsyncHelper(const DeleteVpnConnectionRouteRequest& request, const DeleteVpnConnectionRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2557,12 +3307,22 @@ DeleteVpnGatewayOutcome EC2Client::DeleteVpnGateway(const DeleteVpnGatewayReques
 
 DeleteVpnGatewayOutcomeCallable EC2Client::DeleteVpnGatewayCallable(const DeleteVpnGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeleteVpnGateway, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteVpnGateway, Aws::Client::RejectedCallOutcome<DeleteVpnGatewayOutcome>(), this, request);
+}
+
+DeleteVpnGatewayOutcomeCallable EC2Client::DeleteVpnGatewayCallable(DeleteVpnGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeleteVpnGateway, Aws::Client::RejectedCallOutcome<DeleteVpnGatewayOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeleteVpnGatewayAsync(const DeleteVpnGatewayRequest& request, const DeleteVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeleteVpnGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeleteVpnGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVpnGatewayOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeleteVpnGatewayAsync(DeleteVpnGatewayRequest&& request, const DeleteVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeleteVpnGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVpnGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeleteVpnGatewayAsyncHelper(const DeleteVpnGatewayRequest& request, const DeleteVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2587,12 +3347,22 @@ DeregisterImageOutcome EC2Client::DeregisterImage(const DeregisterImageRequest&
 
 DeregisterImageOutcomeCallable EC2Client::DeregisterImageCallable(const DeregisterImageRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DeregisterImage, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DeregisterImage, Aws::Client::RejectedCallOutcome<DeregisterImageOutcome>(), this, request);
+}
+
+DeregisterImageOutcomeCallable EC2Client::DeregisterImageCallable(DeregisterImageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DeregisterImage, Aws::Client::RejectedCallOutcome<DeregisterImageOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DeregisterImageAsync(const DeregisterImageRequest& request, const DeregisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DeregisterImageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DeregisterImageAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterImageOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DeregisterImageAsync(DeregisterImageRequest&& request, const DeregisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DeregisterImageAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterImageOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DeregisterImageAsyncHelper(const DeregisterImageRequest& request, const DeregisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2617,12 +3387,22 @@ DescribeAccountAttributesOutcome EC2Client::DescribeAccountAttributes(const Desc
 
 DescribeAccountAttributesOutcomeCallable EC2Client::DescribeAccountAttributesCallable(const DescribeAccountAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeAccountAttributes, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeAccountAttributes, Aws::Client::RejectedCallOutcome<DescribeAccountAttributesOutcome>(), this, request);
+}
+
+DescribeAccountAttributesOutcomeCallable EC2Client::DescribeAccountAttributesCallable(DescribeAccountAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeAccountAttributes, Aws::Client::RejectedCallOutcome<DescribeAccountAttributesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeAccountAttributesAsync(const DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeAccountAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeAccountAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAccountAttributesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeAccountAttributesAsync(DescribeAccountAttributesRequest&& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeAccountAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAccountAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeAccountAttributesAsyncHelper(const DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2647,12 +3427,22 @@ DescribeAddressesOutcome EC2Client::DescribeAddresses(const DescribeAddressesReq
 
 DescribeAddressesOutcomeCallable EC2Client::DescribeAddressesCallable(const DescribeAddressesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeAddresses, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeAddresses, Aws::Client::RejectedCallOutcome<DescribeAddressesOutcome>(), this, request);
+}
+
+DescribeAddressesOutcomeCallable EC2Client::DescribeAddressesCallable(DescribeAddressesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeAddresses, Aws::Client::RejectedCallOutcome<DescribeAddressesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeAddressesAsync(const DescribeAddressesRequest& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeAddressesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeAddressesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAddressesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeAddressesAsync(DescribeAddressesRequest&& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeAddressesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAddressesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeAddressesAsyncHelper(const DescribeAddressesRequest& request, const DescribeAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2677,12 +3467,22 @@ DescribeAvailabilityZonesOutcome EC2Client::DescribeAvailabilityZones(const Desc
 
 DescribeAvailabilityZonesOutcomeCallable EC2Client::DescribeAvailabilityZonesCallable(const DescribeAvailabilityZonesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeAvailabilityZones, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeAvailabilityZones, Aws::Client::RejectedCallOutcome<DescribeAvailabilityZonesOutcome>(), this, request);
+}
+
+DescribeAvailabilityZonesOutcomeCallable EC2Client::DescribeAvailabilityZonesCallable(DescribeAvailabilityZonesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeAvailabilityZones, Aws::Client::RejectedCallOutcome<DescribeAvailabilityZonesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeAvailabilityZonesAsync(const DescribeAvailabilityZonesRequest& request, const DescribeAvailabilityZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeAvailabilityZonesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeAvailabilityZonesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAvailabilityZonesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeAvailabilityZonesAsync(DescribeAvailabilityZonesRequest&& request, const DescribeAvailabilityZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeAvailabilityZonesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAvailabilityZonesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeAvailabilityZonesAsyncHelper(const DescribeAvailabilityZonesRequest& request, const DescribeAvailabilityZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2707,12 +3507,22 @@ DescribeBundleTasksOutcome EC2Client::DescribeBundleTasks(const DescribeBundleTa
 
 DescribeBundleTasksOutcomeCallable EC2Client::DescribeBundleTasksCallable(const DescribeBundleTasksRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeBundleTasks, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeBundleTasks, Aws::Client::RejectedCallOutcome<DescribeBundleTasksOutcome>(), this, request);
+}
+
+DescribeBundleTasksOutcomeCallable EC2Client::DescribeBundleTasksCallable(DescribeBundleTasksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeBundleTasks, Aws::Client::RejectedCallOutcome<DescribeBundleTasksOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeBundleTasksAsync(const DescribeBundleTasksRequest& request, const DescribeBundleTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeBundleTasksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeBundleTasksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeBundleTasksOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeBundleTasksAsync(DescribeBundleTasksRequest&& request, const DescribeBundleTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeBundleTasksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeBundleTasksOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeBundleTasksAsyncHelper(const DescribeBundleTasksRequest& request, const DescribeBundleTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2737,12 +3547,22 @@ DescribeClassicLinkInstancesOutcome EC2Client::DescribeClassicLinkInstances(cons
 
 DescribeClassicLinkInstancesOutcomeCallable EC2Client::DescribeClassicLinkInstancesCallable(const DescribeClassicLinkInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeClassicLinkInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeClassicLinkInstances, Aws::Client::RejectedCallOutcome<DescribeClassicLinkInstancesOutcome>(), this, request);
+}
+
+DescribeClassicLinkInstancesOutcomeCallable EC2Client::DescribeClassicLinkInstancesCallable(DescribeClassicLinkInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeClassicLinkInstances, Aws::Client::RejectedCallOutcome<DescribeClassicLinkInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeClassicLinkInstancesAsync(const DescribeClassicLinkInstancesRequest& request, const DescribeClassicLinkInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeClassicLinkInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeClassicLinkInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClassicLinkInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeClassicLinkInstancesAsync(DescribeClassicLinkInstancesRequest&& request, const DescribeClassicLinkInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeClassicLinkInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClassicLinkInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeClassicLinkInstancesAsyncHelper(const DescribeClassicLinkInstancesRequest& request, const DescribeClassicLinkInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2767,12 +3587,22 @@ DescribeConversionTasksOutcome EC2Client::DescribeConversionTasks(const Describe
 
 DescribeConversionTasksOutcomeCallable EC2Client::DescribeConversionTasksCallable(const DescribeConversionTasksRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeConversionTasks, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeConversionTasks, Aws::Client::RejectedCallOutcome<DescribeConversionTasksOutcome>(), this, request);
+}
+
+DescribeConversionTasksOutcomeCallable EC2Client::DescribeConversionTasksCallable(DescribeConversionTasksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeConversionTasks, Aws::Client::RejectedCallOutcome<DescribeConversionTasksOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeConversionTasksAsync(const DescribeConversionTasksRequest& request, const DescribeConversionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeConversionTasksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeConversionTasksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConversionTasksOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeConversionTasksAsync(DescribeConversionTasksRequest&& request, const DescribeConversionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeConversionTasksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConversionTasksOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeConversionTasksAsyncHelper(const DescribeConversionTasksRequest& request, const DescribeConversionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2797,12 +3627,22 @@ DescribeCustomerGatewaysOutcome EC2Client::DescribeCustomerGateways(const Descri
 
 DescribeCustomerGatewaysOutcomeCallable EC2Client::DescribeCustomerGatewaysCallable(const DescribeCustomerGatewaysRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeCustomerGateways, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeCustomerGateways, Aws::Client::RejectedCallOutcome<DescribeCustomerGatewaysOutcome>(), this, request);
+}
+
+DescribeCustomerGatewaysOutcomeCallable EC2Client::DescribeCustomerGatewaysCallable(DescribeCustomerGatewaysRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeCustomerGateways, Aws::Client::RejectedCallOutcome<DescribeCustomerGatewaysOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeCustomerGatewaysAsync(const DescribeCustomerGatewaysRequest& request, const DescribeCustomerGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeCustomerGatewaysAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeCustomerGatewaysAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCustomerGatewaysOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeCustomerGatewaysAsync(DescribeCustomerGatewaysRequest&& request, const DescribeCustomerGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeCustomerGatewaysAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCustomerGatewaysOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeCustomerGatewaysAsyncHelper(const DescribeCustomerGatewaysRequest& request, const DescribeCustomerGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2827,12 +3667,22 @@ DescribeDhcpOptionsOutcome EC2Client::DescribeDhcpOptions(const DescribeDhcpOpti
 
 DescribeDhcpOptionsOutcomeCallable EC2Client::DescribeDhcpOptionsCallable(const DescribeDhcpOptionsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeDhcpOptions, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeDhcpOptions, Aws::Client::RejectedCallOutcome<DescribeDhcpOptionsOutcome>(), this, request);
+}
+
+DescribeDhcpOptionsOutcomeCallable EC2Client::DescribeDhcpOptionsCallable(DescribeDhcpOptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeDhcpOptions, Aws::Client::RejectedCallOutcome<DescribeDhcpOptionsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeDhcpOptionsAsync(const DescribeDhcpOptionsRequest& request, const DescribeDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeDhcpOptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeDhcpOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDhcpOptionsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeDhcpOptionsAsync(DescribeDhcpOptionsRequest&& request, const DescribeDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeDhcpOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDhcpOptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeDhcpOptionsAsyncHelper(const DescribeDhcpOptionsRequest& request, const DescribeDhcpOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2857,12 +3707,22 @@ DescribeExportTasksOutcome EC2Client::DescribeExportTasks(const DescribeExportTa
 
 DescribeExportTasksOutcomeCallable EC2Client::DescribeExportTasksCallable(const DescribeExportTasksRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeExportTasks, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeExportTasks, Aws::Client::RejectedCallOutcome<DescribeExportTasksOutcome>(), this, request);
+}
+
+DescribeExportTasksOutcomeCallable EC2Client::DescribeExportTasksCallable(DescribeExportTasksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeExportTasks, Aws::Client::RejectedCallOutcome<DescribeExportTasksOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeExportTasksAsync(const DescribeExportTasksRequest& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeExportTasksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeExportTasksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeExportTasksOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeExportTasksAsync(DescribeExportTasksRequest&& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeExportTasksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeExportTasksOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeExportTasksAsyncHelper(const DescribeExportTasksRequest& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2887,12 +3747,22 @@ DescribeFlowLogsOutcome EC2Client::DescribeFlowLogs(const DescribeFlowLogsReques
 
 DescribeFlowLogsOutcomeCallable EC2Client::DescribeFlowLogsCallable(const DescribeFlowLogsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeFlowLogs, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeFlowLogs, Aws::Client::RejectedCallOutcome<DescribeFlowLogsOutcome>(), this, request);
+}
+
+DescribeFlowLogsOutcomeCallable EC2Client::DescribeFlowLogsCallable(DescribeFlowLogsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeFlowLogs, Aws::Client::RejectedCallOutcome<DescribeFlowLogsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeFlowLogsAsync(const DescribeFlowLogsRequest& request, const DescribeFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeFlowLogsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeFlowLogsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFlowLogsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeFlowLogsAsync(DescribeFlowLogsRequest&& request, const DescribeFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeFlowLogsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFlowLogsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeFlowLogsAsyncHelper(const DescribeFlowLogsRequest& request, const DescribeFlowLogsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2917,12 +3787,22 @@ DescribeHostsOutcome EC2Client::DescribeHosts(const DescribeHostsRequest& reques
 
 DescribeHostsOutcomeCallable EC2Client::DescribeHostsCallable(const DescribeHostsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeHosts, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeHosts, Aws::Client::RejectedCallOutcome<DescribeHostsOutcome>(), this, request);
+}
+
+DescribeHostsOutcomeCallable EC2Client::DescribeHostsCallable(DescribeHostsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeHosts, Aws::Client::RejectedCallOutcome<DescribeHostsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeHostsAsync(const DescribeHostsRequest& request, const DescribeHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeHostsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeHostsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeHostsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeHostsAsync(DescribeHostsRequest&& request, const DescribeHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeHostsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeHostsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeHostsAsyncHelper(const DescribeHostsRequest& request, const DescribeHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2947,12 +3827,22 @@ DescribeIdFormatOutcome EC2Client::DescribeIdFormat(const DescribeIdFormatReques
 
 DescribeIdFormatOutcomeCallable EC2Client::DescribeIdFormatCallable(const DescribeIdFormatRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeIdFormat, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeIdFormat, Aws::Client::RejectedCallOutcome<DescribeIdFormatOutcome>(), this, request);
+}
+
+DescribeIdFormatOutcomeCallable EC2Client::DescribeIdFormatCallable(DescribeIdFormatRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeIdFormat, Aws::Client::RejectedCallOutcome<DescribeIdFormatOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeIdFormatAsync(const DescribeIdFormatRequest& request, const DescribeIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeIdFormatAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeIdFormatAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeIdFormatOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeIdFormatAsync(DescribeIdFormatRequest&& request, const DescribeIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeIdFormatAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeIdFormatOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeIdFormatAsyncHelper(const DescribeIdFormatRequest& request, const DescribeIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2977,12 +3867,22 @@ DescribeImageAttributeOutcome EC2Client::DescribeImageAttribute(const DescribeIm
 
 DescribeImageAttributeOutcomeCallable EC2Client::DescribeImageAttributeCallable(const DescribeImageAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeImageAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeImageAttribute, Aws::Client::RejectedCallOutcome<DescribeImageAttributeOutcome>(), this, request);
+}
+
+DescribeImageAttributeOutcomeCallable EC2Client::DescribeImageAttributeCallable(DescribeImageAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeImageAttribute, Aws::Client::RejectedCallOutcome<DescribeImageAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeImageAttributeAsync(const DescribeImageAttributeRequest& request, const DescribeImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeImageAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeImageAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeImageAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeImageAttributeAsync(DescribeImageAttributeRequest&& request, const DescribeImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeImageAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeImageAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeImageAttributeAsyncHelper(const DescribeImageAttributeRequest& request, const DescribeImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3007,12 +3907,22 @@ DescribeImagesOutcome EC2Client::DescribeImages(const DescribeImagesRequest& req
 
 DescribeImagesOutcomeCallable EC2Client::DescribeImagesCallable(const DescribeImagesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeImages, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeImages, Aws::Client::RejectedCallOutcome<DescribeImagesOutcome>(), this, request);
+}
+
+DescribeImagesOutcomeCallable EC2Client::DescribeImagesCallable(DescribeImagesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeImages, Aws::Client::RejectedCallOutcome<DescribeImagesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeImagesAsync(const DescribeImagesRequest& request, const DescribeImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeImagesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeImagesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeImagesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeImagesAsync(DescribeImagesRequest&& request, const DescribeImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeImagesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeImagesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeImagesAsyncHelper(const DescribeImagesRequest& request, const DescribeImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3037,12 +3947,22 @@ DescribeImportImageTasksOutcome EC2Client::DescribeImportImageTasks(const Descri
 
 DescribeImportImageTasksOutcomeCallable EC2Client::DescribeImportImageTasksCallable(const DescribeImportImageTasksRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeImportImageTasks, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeImportImageTasks, Aws::Client::RejectedCallOutcome<DescribeImportImageTasksOutcome>(), this, request);
+}
+
+DescribeImportImageTasksOutcomeCallable EC2Client::DescribeImportImageTasksCallable(DescribeImportImageTasksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeImportImageTasks, Aws::Client::RejectedCallOutcome<DescribeImportImageTasksOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeImportImageTasksAsync(const DescribeImportImageTasksRequest& request, const DescribeImportImageTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeImportImageTasksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeImportImageTasksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeImportImageTasksOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeImportImageTasksAsync(DescribeImportImageTasksRequest&& request, const DescribeImportImageTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeImportImageTasksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeImportImageTasksOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeImportImageTasksAsyncHelper(const DescribeImportImageTasksRequest& request, const DescribeImportImageTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3067,12 +3987,22 @@ DescribeImportSnapshotTasksOutcome EC2Client::DescribeImportSnapshotTasks(const
 
 DescribeImportSnapshotTasksOutcomeCallable EC2Client::DescribeImportSnapshotTasksCallable(const DescribeImportSnapshotTasksRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeImportSnapshotTasks, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeImportSnapshotTasks, Aws::Client::RejectedCallOutcome<DescribeImportSnapshotTasksOutcome>(), this, request);
+}
+
+DescribeImportSnapshotTasksOutcomeCallable EC2Client::DescribeImportSnapshotTasksCallable(DescribeImportSnapshotTasksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeImportSnapshotTasks, Aws::Client::RejectedCallOutcome<DescribeImportSnapshotTasksOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeImportSnapshotTasksAsync(const DescribeImportSnapshotTasksRequest& request, const DescribeImportSnapshotTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeImportSnapshotTasksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeImportSnapshotTasksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeImportSnapshotTasksOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeImportSnapshotTasksAsync(DescribeImportSnapshotTasksRequest&& request, const DescribeImportSnapshotTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeImportSnapshotTasksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeImportSnapshotTasksOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeImportSnapshotTasksAsyncHelper(const DescribeImportSnapshotTasksRequest& request, const DescribeImportSnapshotTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3097,12 +4027,22 @@ DescribeInstanceAttributeOutcome EC2Client::DescribeInstanceAttribute(const Desc
 
 DescribeInstanceAttributeOutcomeCallable EC2Client::DescribeInstanceAttributeCallable(const DescribeInstanceAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeInstanceAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeInstanceAttribute, Aws::Client::RejectedCallOutcome<DescribeInstanceAttributeOutcome>(), this, request);
+}
+
+DescribeInstanceAttributeOutcomeCallable EC2Client::DescribeInstanceAttributeCallable(DescribeInstanceAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeInstanceAttribute, Aws::Client::RejectedCallOutcome<DescribeInstanceAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeInstanceAttributeAsync(const DescribeInstanceAttributeRequest& request, const DescribeInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeInstanceAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeInstanceAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInstanceAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeInstanceAttributeAsync(DescribeInstanceAttributeRequest&& request, const DescribeInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeInstanceAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInstanceAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeInstanceAttributeAsyncHelper(const DescribeInstanceAttributeRequest& request, const DescribeInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3127,12 +4067,22 @@ DescribeInstanceStatusOutcome EC2Client::DescribeInstanceStatus(const DescribeIn
 
 DescribeInstanceStatusOutcomeCallable EC2Client::DescribeInstanceStatusCallable(const DescribeInstanceStatusRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeInstanceStatus, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeInstanceStatus, Aws::Client::RejectedCallOutcome<DescribeInstanceStatusOutcome>(), this, request);
+}
+
+DescribeInstanceStatusOutcomeCallable EC2Client::DescribeInstanceStatusCallable(DescribeInstanceStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeInstanceStatus, Aws::Client::RejectedCallOutcome<DescribeInstanceStatusOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeInstanceStatusAsync(const DescribeInstanceStatusRequest& request, const DescribeInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeInstanceStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeInstanceStatusAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInstanceStatusOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeInstanceStatusAsync(DescribeInstanceStatusRequest&& request, const DescribeInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeInstanceStatusAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInstanceStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeInstanceStatusAsyncHelper(const DescribeInstanceStatusRequest& request, const DescribeInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3157,12 +4107,22 @@ DescribeInstancesOutcome EC2Client::DescribeInstances(const DescribeInstancesReq
 
 DescribeInstancesOutcomeCallable EC2Client::DescribeInstancesCallable(const DescribeInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeInstances, Aws::Client::RejectedCallOutcome<DescribeInstancesOutcome>(), this, request);
+}
+
+DescribeInstancesOutcomeCallable EC2Client::DescribeInstancesCallable(DescribeInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeInstances, Aws::Client::RejectedCallOutcome<DescribeInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeInstancesAsync(const DescribeInstancesRequest& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeInstancesAsync(DescribeInstancesRequest&& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeInstancesAsyncHelper(const DescribeInstancesRequest& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3187,12 +4147,22 @@ DescribeInternetGatewaysOutcome EC2Client::DescribeInternetGateways(const Descri
 
 DescribeInternetGatewaysOutcomeCallable EC2Client::DescribeInternetGatewaysCallable(const DescribeInternetGatewaysRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeInternetGateways, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeInternetGateways, Aws::Client::RejectedCallOutcome<DescribeInternetGatewaysOutcome>(), this, request);
+}
+
+DescribeInternetGatewaysOutcomeCallable EC2Client::DescribeInternetGatewaysCallable(DescribeInternetGatewaysRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeInternetGateways, Aws::Client::RejectedCallOutcome<DescribeInternetGatewaysOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeInternetGatewaysAsync(const DescribeInternetGatewaysRequest& request, const DescribeInternetGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeInternetGatewaysAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeInternetGatewaysAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInternetGatewaysOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeInternetGatewaysAsync(DescribeInternetGatewaysRequest&& request, const DescribeInternetGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeInternetGatewaysAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInternetGatewaysOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeInternetGatewaysAsyncHelper(const DescribeInternetGatewaysRequest& request, const DescribeInternetGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3217,12 +4187,22 @@ DescribeKeyPairsOutcome EC2Client::DescribeKeyPairs(const DescribeKeyPairsReques
 
 DescribeKeyPairsOutcomeCallable EC2Client::DescribeKeyPairsCallable(const DescribeKeyPairsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeKeyPairs, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeKeyPairs, Aws::Client::RejectedCallOutcome<DescribeKeyPairsOutcome>(), this, request);
+}
+
+DescribeKeyPairsOutcomeCallable EC2Client::DescribeKeyPairsCallable(DescribeKeyPairsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeKeyPairs, Aws::Client::RejectedCallOutcome<DescribeKeyPairsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeKeyPairsAsync(const DescribeKeyPairsRequest& request, const DescribeKeyPairsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeKeyPairsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeKeyPairsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeKeyPairsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeKeyPairsAsync(DescribeKeyPairsRequest&& request, const DescribeKeyPairsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeKeyPairsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeKeyPairsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeKeyPairsAsyncHelper(const DescribeKeyPairsRequest& request, const DescribeKeyPairsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3247,12 +4227,22 @@ DescribeMovingAddressesOutcome EC2Client::DescribeMovingAddresses(const Describe
 
 DescribeMovingAddressesOutcomeCallable EC2Client::DescribeMovingAddressesCallable(const DescribeMovingAddressesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeMovingAddresses, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeMovingAddresses, Aws::Client::RejectedCallOutcome<DescribeMovingAddressesOutcome>(), this, request);
+}
+
+DescribeMovingAddressesOutcomeCallable EC2Client::DescribeMovingAddressesCallable(DescribeMovingAddressesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeMovingAddresses, Aws::Client::RejectedCallOutcome<DescribeMovingAddressesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeMovingAddressesAsync(const DescribeMovingAddressesRequest& request, const DescribeMovingAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeMovingAddressesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeMovingAddressesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMovingAddressesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeMovingAddressesAsync(DescribeMovingAddressesRequest&& request, const DescribeMovingAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeMovingAddressesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMovingAddressesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeMovingAddressesAsyncHelper(const DescribeMovingAddressesRequest& request, const DescribeMovingAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3277,12 +4267,22 @@ DescribeNatGatewaysOutcome EC2Client::DescribeNatGateways(const DescribeNatGatew
 
 DescribeNatGatewaysOutcomeCallable EC2Client::DescribeNatGatewaysCallable(const DescribeNatGatewaysRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeNatGateways, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeNatGateways, Aws::Client::RejectedCallOutcome<DescribeNatGatewaysOutcome>(), this, request);
+}
+
+DescribeNatGatewaysOutcomeCallable EC2Client::DescribeNatGatewaysCallable(DescribeNatGatewaysRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeNatGateways, Aws::Client::RejectedCallOutcome<DescribeNatGatewaysOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeNatGatewaysAsync(const DescribeNatGatewaysRequest& request, const DescribeNatGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeNatGatewaysAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeNatGatewaysAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeNatGatewaysOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeNatGatewaysAsync(DescribeNatGatewaysRequest&& request, const DescribeNatGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeNatGatewaysAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeNatGatewaysOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeNatGatewaysAsyncHelper(const DescribeNatGatewaysRequest& request, const DescribeNatGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3307,12 +4307,22 @@ DescribeNetworkAclsOutcome EC2Client::DescribeNetworkAcls(const DescribeNetworkA
 
 DescribeNetworkAclsOutcomeCallable EC2Client::DescribeNetworkAclsCallable(const DescribeNetworkAclsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeNetworkAcls, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeNetworkAcls, Aws::Client::RejectedCallOutcome<DescribeNetworkAclsOutcome>(), this, request);
+}
+
+DescribeNetworkAclsOutcomeCallable EC2Client::DescribeNetworkAclsCallable(DescribeNetworkAclsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeNetworkAcls, Aws::Client::RejectedCallOutcome<DescribeNetworkAclsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeNetworkAclsAsync(const DescribeNetworkAclsRequest& request, const DescribeNetworkAclsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeNetworkAclsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeNetworkAclsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeNetworkAclsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeNetworkAclsAsync(DescribeNetworkAclsRequest&& request, const DescribeNetworkAclsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeNetworkAclsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeNetworkAclsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeNetworkAclsAsyncHelper(const DescribeNetworkAclsRequest& request, const DescribeNetworkAclsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3337,12 +4347,22 @@ DescribeNetworkInterfaceAttributeOutcome EC2Client::DescribeNetworkInterfaceAttr
 
 DescribeNetworkInterfaceAttributeOutcomeCallable EC2Client::DescribeNetworkInterfaceAttributeCallable(const DescribeNetworkInterfaceAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeNetworkInterfaceAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeNetworkInterfaceAttribute, Aws::Client::RejectedCallOutcome<DescribeNetworkInterfaceAttributeOutcome>(), this, request);
+}
+
+DescribeNetworkInterfaceAttributeOutcomeCallable EC2Client::DescribeNetworkInterfaceAttributeCallable(DescribeNetworkInterfaceAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeNetworkInterfaceAttribute, Aws::Client::RejectedCallOutcome<DescribeNetworkInterfaceAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeNetworkInterfaceAttributeAsync(const DescribeNetworkInterfaceAttributeRequest& request, const DescribeNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeNetworkInterfaceAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeNetworkInterfaceAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeNetworkInterfaceAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeNetworkInterfaceAttributeAsync(DescribeNetworkInterfaceAttributeRequest&& request, const DescribeNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeNetworkInterfaceAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeNetworkInterfaceAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeNetworkInterfaceAttributeAsyncHelper(const DescribeNetworkInterfaceAttributeRequest& request, const DescribeNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3367,12 +4387,22 @@ DescribeNetworkInterfacesOutcome EC2Client::DescribeNetworkInterfaces(const Desc
 
 DescribeNetworkInterfacesOutcomeCallable EC2Client::DescribeNetworkInterfacesCallable(const DescribeNetworkInterfacesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeNetworkInterfaces, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeNetworkInterfaces, Aws::Client::RejectedCallOutcome<DescribeNetworkInterfacesOutcome>(), this, request);
+}
+
+DescribeNetworkInterfacesOutcomeCallable EC2Client::DescribeNetworkInterfacesCallable(DescribeNetworkInterfacesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeNetworkInterfaces, Aws::Client::RejectedCallOutcome<DescribeNetworkInterfacesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeNetworkInterfacesAsync(const DescribeNetworkInterfacesRequest& request, const DescribeNetworkInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeNetworkInterfacesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeNetworkInterfacesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeNetworkInterfacesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeNetworkInterfacesAsync(DescribeNetworkInterfacesRequest&& request, const DescribeNetworkInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeNetworkInterfacesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeNetworkInterfacesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeNetworkInterfacesAsyncHelper(const DescribeNetworkInterfacesRequest& request, const DescribeNetworkInterfacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3397,12 +4427,22 @@ DescribePlacementGroupsOutcome EC2Client::DescribePlacementGroups(const Describe
 
 DescribePlacementGroupsOutcomeCallable EC2Client::DescribePlacementGroupsCallable(const DescribePlacementGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribePlacementGroups, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribePlacementGroups, Aws::Client::RejectedCallOutcome<DescribePlacementGroupsOutcome>(), this, request);
+}
+
+DescribePlacementGroupsOutcomeCallable EC2Client::DescribePlacementGroupsCallable(DescribePlacementGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribePlacementGroups, Aws::Client::RejectedCallOutcome<DescribePlacementGroupsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribePlacementGroupsAsync(const DescribePlacementGroupsRequest& request, const DescribePlacementGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribePlacementGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribePlacementGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribePlacementGroupsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribePlacementGroupsAsync(DescribePlacementGroupsRequest&& request, const DescribePlacementGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribePlacementGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribePlacementGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribePlacementGroupsAsyncHelper(const DescribePlacementGroupsRequest& request, const DescribePlacementGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3427,12 +4467,22 @@ DescribePrefixListsOutcome EC2Client::DescribePrefixLists(const DescribePrefixLi
 
 DescribePrefixListsOutcomeCallable EC2Client::DescribePrefixListsCallable(const DescribePrefixListsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribePrefixLists, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribePrefixLists, Aws::Client::RejectedCallOutcome<DescribePrefixListsOutcome>(), this, request);
+}
+
+DescribePrefixListsOutcomeCallable EC2Client::DescribePrefixListsCallable(DescribePrefixListsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribePrefixLists, Aws::Client::RejectedCallOutcome<DescribePrefixListsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribePrefixListsAsync(const DescribePrefixListsRequest& request, const DescribePrefixListsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribePrefixListsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribePrefixListsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribePrefixListsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribePrefixListsAsync(DescribePrefixListsRequest&& request, const DescribePrefixListsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribePrefixListsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribePrefixListsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribePrefixListsAsyncHelper(const DescribePrefixListsRequest& request, const DescribePrefixListsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3457,12 +4507,22 @@ DescribeRegionsOutcome EC2Client::DescribeRegions(const DescribeRegionsRequest&
 
 DescribeRegionsOutcomeCallable EC2Client::DescribeRegionsCallable(const DescribeRegionsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeRegions, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeRegions, Aws::Client::RejectedCallOutcome<DescribeRegionsOutcome>(), this, request);
+}
+
+DescribeRegionsOutcomeCallable EC2Client::DescribeRegionsCallable(DescribeRegionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeRegions, Aws::Client::RejectedCallOutcome<DescribeRegionsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeRegionsAsync(const DescribeRegionsRequest& request, const DescribeRegionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeRegionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeRegionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRegionsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeRegionsAsync(DescribeRegionsRequest&& request, const DescribeRegionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeRegionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRegionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeRegionsAsyncHelper(const DescribeRegionsRequest& request, const DescribeRegionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3487,12 +4547,22 @@ DescribeReservedInstancesOutcome EC2Client::DescribeReservedInstances(const Desc
 
 DescribeReservedInstancesOutcomeCallable EC2Client::DescribeReservedInstancesCallable(const DescribeReservedInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeReservedInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeReservedInstances, Aws::Client::RejectedCallOutcome<DescribeReservedInstancesOutcome>(), this, request);
+}
+
+DescribeReservedInstancesOutcomeCallable EC2Client::DescribeReservedInstancesCallable(DescribeReservedInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeReservedInstances, Aws::Client::RejectedCallOutcome<DescribeReservedInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeReservedInstancesAsync(const DescribeReservedInstancesRequest& request, const DescribeReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeReservedInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeReservedInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeReservedInstancesAsync(DescribeReservedInstancesRequest&& request, const DescribeReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeReservedInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeReservedInstancesAsyncHelper(const DescribeReservedInstancesRequest& request, const DescribeReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3517,12 +4587,22 @@ DescribeReservedInstancesListingsOutcome EC2Client::DescribeReservedInstancesLis
 
 DescribeReservedInstancesListingsOutcomeCallable EC2Client::DescribeReservedInstancesListingsCallable(const DescribeReservedInstancesListingsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeReservedInstancesListings, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeReservedInstancesListings, Aws::Client::RejectedCallOutcome<DescribeReservedInstancesListingsOutcome>(), this, request);
+}
+
+DescribeReservedInstancesListingsOutcomeCallable EC2Client::DescribeReservedInstancesListingsCallable(DescribeReservedInstancesListingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeReservedInstancesListings, Aws::Client::RejectedCallOutcome<DescribeReservedInstancesListingsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeReservedInstancesListingsAsync(const DescribeReservedInstancesListingsRequest& request, const DescribeReservedInstancesListingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeReservedInstancesListingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeReservedInstancesListingsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedInstancesListingsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeReservedInstancesListingsAsync(DescribeReservedInstancesListingsRequest&& request, const DescribeReservedInstancesListingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeReservedInstancesListingsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedInstancesListingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeReservedInstancesListingsAsyncHelper(const DescribeReservedInstancesListingsRequest& request, const DescribeReservedInstancesListingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3547,12 +4627,22 @@ DescribeReservedInstancesModificationsOutcome EC2Client::DescribeReservedInstanc
 
 DescribeReservedInstancesModificationsOutcomeCallable EC2Client::DescribeReservedInstancesModificationsCallable(const DescribeReservedInstancesModificationsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeReservedInstancesModifications, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeReservedInstancesModifications, Aws::Client::RejectedCallOutcome<DescribeReservedInstancesModificationsOutcome>(), this, request);
+}
+
+DescribeReservedInstancesModificationsOutcomeCallable EC2Client::DescribeReservedInstancesModificationsCallable(DescribeReservedInstancesModificationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeReservedInstancesModifications, Aws::Client::RejectedCallOutcome<DescribeReservedInstancesModificationsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeReservedInstancesModificationsAsync(const DescribeReservedInstancesModificationsRequest& request, const DescribeReservedInstancesModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeReservedInstancesModificationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeReservedInstancesModificationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedInstancesModificationsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeReservedInstancesModificationsAsync(DescribeReservedInstancesModificationsRequest&& request, const DescribeReservedInstancesModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeReservedInstancesModificationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedInstancesModificationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeReservedInstancesModificationsAsyncHelper(const DescribeReservedInstancesModificationsRequest& request, const DescribeReservedInstancesModificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3577,12 +4667,22 @@ DescribeReservedInstancesOfferingsOutcome EC2Client::DescribeReservedInstancesOf
 
 DescribeReservedInstancesOfferingsOutcomeCallable EC2Client::DescribeReservedInstancesOfferingsCallable(const DescribeReservedInstancesOfferingsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeReservedInstancesOfferings, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeReservedInstancesOfferings, Aws::Client::RejectedCallOutcome<DescribeReservedInstancesOfferingsOutcome>(), this, request);
+}
+
+DescribeReservedInstancesOfferingsOutcomeCallable EC2Client::DescribeReservedInstancesOfferingsCallable(DescribeReservedInstancesOfferingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeReservedInstancesOfferings, Aws::Client::RejectedCallOutcome<DescribeReservedInstancesOfferingsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeReservedInstancesOfferingsAsync(const DescribeReservedInstancesOfferingsRequest& request, const DescribeReservedInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeReservedInstancesOfferingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeReservedInstancesOfferingsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedInstancesOfferingsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeReservedInstancesOfferingsAsync(DescribeReservedInstancesOfferingsRequest&& request, const DescribeReservedInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeReservedInstancesOfferingsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedInstancesOfferingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeReservedInstancesOfferingsAsyncHelper(const DescribeReservedInstancesOfferingsRequest& request, const DescribeReservedInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3607,12 +4707,22 @@ DescribeRouteTablesOutcome EC2Client::DescribeRouteTables(const DescribeRouteTab
 
 DescribeRouteTablesOutcomeCallable EC2Client::DescribeRouteTablesCallable(const DescribeRouteTablesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeRouteTables, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeRouteTables, Aws::Client::RejectedCallOutcome<DescribeRouteTablesOutcome>(), this, request);
+}
+
+DescribeRouteTablesOutcomeCallable EC2Client::DescribeRouteTablesCallable(DescribeRouteTablesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeRouteTables, Aws::Client::RejectedCallOutcome<DescribeRouteTablesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeRouteTablesAsync(const DescribeRouteTablesRequest& request, const DescribeRouteTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeRouteTablesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeRouteTablesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRouteTablesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeRouteTablesAsync(DescribeRouteTablesRequest&& request, const DescribeRouteTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeRouteTablesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRouteTablesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeRouteTablesAsyncHelper(const DescribeRouteTablesRequest& request, const DescribeRouteTablesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3637,12 +4747,22 @@ DescribeScheduledInstanceAvailabilityOutcome EC2Client::DescribeScheduledInstanc
 
 DescribeScheduledInstanceAvailabilityOutcomeCallable EC2Client::DescribeScheduledInstanceAvailabilityCallable(const DescribeScheduledInstanceAvailabilityRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeScheduledInstanceAvailability, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeScheduledInstanceAvailability, Aws::Client::RejectedCallOutcome<DescribeScheduledInstanceAvailabilityOutcome>(), this, request);
+}
+
+DescribeScheduledInstanceAvailabilityOutcomeCallable EC2Client::DescribeScheduledInstanceAvailabilityCallable(DescribeScheduledInstanceAvailabilityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeScheduledInstanceAvailability, Aws::Client::RejectedCallOutcome<DescribeScheduledInstanceAvailabilityOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeScheduledInstanceAvailabilityAsync(const DescribeScheduledInstanceAvailabilityRequest& request, const DescribeScheduledInstanceAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeScheduledInstanceAvailabilityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeScheduledInstanceAvailabilityAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeScheduledInstanceAvailabilityOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeScheduledInstanceAvailabilityAsync(DescribeScheduledInstanceAvailabilityRequest&& request, const DescribeScheduledInstanceAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeScheduledInstanceAvailabilityAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeScheduledInstanceAvailabilityOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeScheduledInstanceAvailabilityAsyncHelper(const DescribeScheduledInstanceAvailabilityRequest& request, const DescribeScheduledInstanceAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3667,12 +4787,22 @@ DescribeScheduledInstancesOutcome EC2Client::DescribeScheduledInstances(const De
 
 DescribeScheduledInstancesOutcomeCallable EC2Client::DescribeScheduledInstancesCallable(const DescribeScheduledInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeScheduledInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeScheduledInstances, Aws::Client::RejectedCallOutcome<DescribeScheduledInstancesOutcome>(), this, request);
+}
+
+DescribeScheduledInstancesOutcomeCallable EC2Client::DescribeScheduledInstancesCallable(DescribeScheduledInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeScheduledInstances, Aws::Client::RejectedCallOutcome<DescribeScheduledInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeScheduledInstancesAsync(const DescribeScheduledInstancesRequest& request, const DescribeScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeScheduledInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeScheduledInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeScheduledInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeScheduledInstancesAsync(DescribeScheduledInstancesRequest&& request, const DescribeScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeScheduledInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeScheduledInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeScheduledInstancesAsyncHelper(const DescribeScheduledInstancesRequest& request, const DescribeScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3697,12 +4827,22 @@ DescribeSecurityGroupsOutcome EC2Client::DescribeSecurityGroups(const DescribeSe
 
 DescribeSecurityGroupsOutcomeCallable EC2Client::DescribeSecurityGroupsCallable(const DescribeSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeSecurityGroups, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSecurityGroups, Aws::Client::RejectedCallOutcome<DescribeSecurityGroupsOutcome>(), this, request);
+}
+
+DescribeSecurityGroupsOutcomeCallable EC2Client::DescribeSecurityGroupsCallable(DescribeSecurityGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSecurityGroups, Aws::Client::RejectedCallOutcome<DescribeSecurityGroupsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeSecurityGroupsAsync(const DescribeSecurityGroupsRequest& request, const DescribeSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeSecurityGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeSecurityGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSecurityGroupsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeSecurityGroupsAsync(DescribeSecurityGroupsRequest&& request, const DescribeSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeSecurityGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSecurityGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeSecurityGroupsAsyncHelper(const DescribeSecurityGroupsRequest& request, const DescribeSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3727,12 +4867,22 @@ DescribeSnapshotAttributeOutcome EC2Client::DescribeSnapshotAttribute(const Desc
 
 DescribeSnapshotAttributeOutcomeCallable EC2Client::DescribeSnapshotAttributeCallable(const DescribeSnapshotAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeSnapshotAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSnapshotAttribute, Aws::Client::RejectedCallOutcome<DescribeSnapshotAttributeOutcome>(), this, request);
+}
+
+DescribeSnapshotAttributeOutcomeCallable EC2Client::DescribeSnapshotAttributeCallable(DescribeSnapshotAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSnapshotAttribute, Aws::Client::RejectedCallOutcome<DescribeSnapshotAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeSnapshotAttributeAsync(const DescribeSnapshotAttributeRequest& request, const DescribeSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeSnapshotAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeSnapshotAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSnapshotAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeSnapshotAttributeAsync(DescribeSnapshotAttributeRequest&& request, const DescribeSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeSnapshotAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSnapshotAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeSnapshotAttributeAsyncHelper(const DescribeSnapshotAttributeRequest& request, const DescribeSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3757,12 +4907,22 @@ DescribeSnapshotsOutcome EC2Client::DescribeSnapshots(const DescribeSnapshotsReq
 
 DescribeSnapshotsOutcomeCallable EC2Client::DescribeSnapshotsCallable(const DescribeSnapshotsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeSnapshots, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSnapshots, Aws::Client::RejectedCallOutcome<DescribeSnapshotsOutcome>(), this, request);
+}
+
+DescribeSnapshotsOutcomeCallable EC2Client::DescribeSnapshotsCallable(DescribeSnapshotsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSnapshots, Aws::Client::RejectedCallOutcome<DescribeSnapshotsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeSnapshotsAsync(const DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeSnapshotsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeSnapshotsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSnapshotsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeSnapshotsAsync(DescribeSnapshotsRequest&& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeSnapshotsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSnapshotsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeSnapshotsAsyncHelper(const DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3787,12 +4947,22 @@ DescribeSpotDatafeedSubscriptionOutcome EC2Client::DescribeSpotDatafeedSubscript
 
 DescribeSpotDatafeedSubscriptionOutcomeCallable EC2Client::DescribeSpotDatafeedSubscriptionCallable(const DescribeSpotDatafeedSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeSpotDatafeedSubscription, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSpotDatafeedSubscription, Aws::Client::RejectedCallOutcome<DescribeSpotDatafeedSubscriptionOutcome>(), this, request);
+}
+
+DescribeSpotDatafeedSubscriptionOutcomeCallable EC2Client::DescribeSpotDatafeedSubscriptionCallable(DescribeSpotDatafeedSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSpotDatafeedSubscription, Aws::Client::RejectedCallOutcome<DescribeSpotDatafeedSubscriptionOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeSpotDatafeedSubscriptionAsync(const DescribeSpotDatafeedSubscriptionRequest& request, const DescribeSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeSpotDatafeedSubscriptionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeSpotDatafeedSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSpotDatafeedSubscriptionOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeSpotDatafeedSubscriptionAsync(DescribeSpotDatafeedSubscriptionRequest&& request, const DescribeSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeSpotDatafeedSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSpotDatafeedSubscriptionOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeSpotDatafeedSubscriptionAsyncHelper(const DescribeSpotDatafeedSubscriptionRequest& request, const DescribeSpotDatafeedSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3817,12 +4987,22 @@ DescribeSpotFleetInstancesOutcome EC2Client::DescribeSpotFleetInstances(const De
 
 DescribeSpotFleetInstancesOutcomeCallable EC2Client::DescribeSpotFleetInstancesCallable(const DescribeSpotFleetInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeSpotFleetInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSpotFleetInstances, Aws::Client::RejectedCallOutcome<DescribeSpotFleetInstancesOutcome>(), this, request);
+}
+
+DescribeSpotFleetInstancesOutcomeCallable EC2Client::DescribeSpotFleetInstancesCallable(DescribeSpotFleetInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSpotFleetInstances, Aws::Client::RejectedCallOutcome<DescribeSpotFleetInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeSpotFleetInstancesAsync(const DescribeSpotFleetInstancesRequest& request, const DescribeSpotFleetInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeSpotFleetInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeSpotFleetInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSpotFleetInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeSpotFleetInstancesAsync(DescribeSpotFleetInstancesRequest&& request, const DescribeSpotFleetInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeSpotFleetInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSpotFleetInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeSpotFleetInstancesAsyncHelper(const DescribeSpotFleetInstancesRequest& request, const DescribeSpotFleetInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3847,12 +5027,22 @@ DescribeSpotFleetRequestHistoryOutcome EC2Client::DescribeSpotFleetRequestHistor
 
 DescribeSpotFleetRequestHistoryOutcomeCallable EC2Client::DescribeSpotFleetRequestHistoryCallable(const DescribeSpotFleetRequestHistoryRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeSpotFleetRequestHistory, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSpotFleetRequestHistory, Aws::Client::RejectedCallOutcome<DescribeSpotFleetRequestHistoryOutcome>(), this, request);
+}
+
+DescribeSpotFleetRequestHistoryOutcomeCallable EC2Client::DescribeSpotFleetRequestHistoryCallable(DescribeSpotFleetRequestHistoryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSpotFleetRequestHistory, Aws::Client::RejectedCallOutcome<DescribeSpotFleetRequestHistoryOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeSpotFleetRequestHistoryAsync(const DescribeSpotFleetRequestHistoryRequest& request, const DescribeSpotFleetRequestHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeSpotFleetRequestHistoryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeSpotFleetRequestHistoryAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSpotFleetRequestHistoryOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeSpotFleetRequestHistoryAsync(DescribeSpotFleetRequestHistoryRequest&& request, const DescribeSpotFleetRequestHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeSpotFleetRequestHistoryAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSpotFleetRequestHistoryOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeSpotFleetRequestHistoryAsyncHelper(const DescribeSpotFleetRequestHistoryRequest& request, const DescribeSpotFleetRequestHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3877,12 +5067,22 @@ DescribeSpotFleetRequestsOutcome EC2Client::DescribeSpotFleetRequests(const Desc
 
 DescribeSpotFleetRequestsOutcomeCallable EC2Client::DescribeSpotFleetRequestsCallable(const DescribeSpotFleetRequestsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeSpotFleetRequests, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSpotFleetRequests, Aws::Client::RejectedCallOutcome<DescribeSpotFleetRequestsOutcome>(), this, request);
+}
+
+DescribeSpotFleetRequestsOutcomeCallable EC2Client::DescribeSpotFleetRequestsCallable(DescribeSpotFleetRequestsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSpotFleetRequests, Aws::Client::RejectedCallOutcome<DescribeSpotFleetRequestsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeSpotFleetRequestsAsync(const DescribeSpotFleetRequestsRequest& request, const DescribeSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeSpotFleetRequestsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeSpotFleetRequestsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSpotFleetRequestsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeSpotFleetRequestsAsync(DescribeSpotFleetRequestsRequest&& request, const DescribeSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeSpotFleetRequestsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSpotFleetRequestsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeSpotFleetRequestsAsyncHelper(const DescribeSpotFleetRequestsRequest& request, const DescribeSpotFleetRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3907,12 +5107,22 @@ DescribeSpotInstanceRequestsOutcome EC2Client::DescribeSpotInstanceRequests(cons
 
 DescribeSpotInstanceRequestsOutcomeCallable EC2Client::DescribeSpotInstanceRequestsCallable(const DescribeSpotInstanceRequestsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeSpotInstanceRequests, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSpotInstanceRequests, Aws::Client::RejectedCallOutcome<DescribeSpotInstanceRequestsOutcome>(), this, request);
+}
+
+DescribeSpotInstanceRequestsOutcomeCallable EC2Client::DescribeSpotInstanceRequestsCallable(DescribeSpotInstanceRequestsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSpotInstanceRequests, Aws::Client::RejectedCallOutcome<DescribeSpotInstanceRequestsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeSpotInstanceRequestsAsync(const DescribeSpotInstanceRequestsRequest& request, const DescribeSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeSpotInstanceRequestsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeSpotInstanceRequestsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSpotInstanceRequestsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeSpotInstanceRequestsAsync(DescribeSpotInstanceRequestsRequest&& request, const DescribeSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeSpotInstanceRequestsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSpotInstanceRequestsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeSpotInstanceRequestsAsyncHelper(const DescribeSpotInstanceRequestsRequest& request, const DescribeSpotInstanceRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3937,12 +5147,22 @@ DescribeSpotPriceHistoryOutcome EC2Client::DescribeSpotPriceHistory(const Descri
 
 DescribeSpotPriceHistoryOutcomeCallable EC2Client::DescribeSpotPriceHistoryCallable(const DescribeSpotPriceHistoryRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeSpotPriceHistory, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSpotPriceHistory, Aws::Client::RejectedCallOutcome<DescribeSpotPriceHistoryOutcome>(), this, request);
+}
+
+DescribeSpotPriceHistoryOutcomeCallable EC2Client::DescribeSpotPriceHistoryCallable(DescribeSpotPriceHistoryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSpotPriceHistory, Aws::Client::RejectedCallOutcome<DescribeSpotPriceHistoryOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeSpotPriceHistoryAsync(const DescribeSpotPriceHistoryRequest& request, const DescribeSpotPriceHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeSpotPriceHistoryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeSpotPriceHistoryAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSpotPriceHistoryOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeSpotPriceHistoryAsync(DescribeSpotPriceHistoryRequest&& request, const DescribeSpotPriceHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeSpotPriceHistoryAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSpotPriceHistoryOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeSpotPriceHistoryAsyncHelper(const DescribeSpotPriceHistoryRequest& request, const DescribeSpotPriceHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3967,12 +5187,22 @@ DescribeSubnetsOutcome EC2Client::DescribeSubnets(const DescribeSubnetsRequest&
 
 DescribeSubnetsOutcomeCallable EC2Client::DescribeSubnetsCallable(const DescribeSubnetsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeSubnets, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSubnets, Aws::Client::RejectedCallOutcome<DescribeSubnetsOutcome>(), this, request);
+}
+
+DescribeSubnetsOutcomeCallable EC2Client::DescribeSubnetsCallable(DescribeSubnetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeSubnets, Aws::Client::RejectedCallOutcome<DescribeSubnetsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeSubnetsAsync(const DescribeSubnetsRequest& request, const DescribeSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeSubnetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeSubnetsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSubnetsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeSubnetsAsync(DescribeSubnetsRequest&& request, const DescribeSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeSubnetsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSubnetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeSubnetsAsyncHelper(const DescribeSubnetsRequest& request, const DescribeSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3997,12 +5227,22 @@ DescribeTagsOutcome EC2Client::DescribeTags(const DescribeTagsRequest& request)
 
 DescribeTagsOutcomeCallable EC2Client::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeTags, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeTags, Aws::Client::RejectedCallOutcome<DescribeTagsOutcome>(), this, request);
+}
+
+DescribeTagsOutcomeCallable EC2Client::DescribeTagsCallable(DescribeTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeTags, Aws::Client::RejectedCallOutcome<DescribeTagsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTagsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeTagsAsync(DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4027,12 +5267,22 @@ DescribeVolumeAttributeOutcome EC2Client::DescribeVolumeAttribute(const Describe
 
 DescribeVolumeAttributeOutcomeCallable EC2Client::DescribeVolumeAttributeCallable(const DescribeVolumeAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeVolumeAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVolumeAttribute, Aws::Client::RejectedCallOutcome<DescribeVolumeAttributeOutcome>(), this, request);
+}
+
+DescribeVolumeAttributeOutcomeCallable EC2Client::DescribeVolumeAttributeCallable(DescribeVolumeAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVolumeAttribute, Aws::Client::RejectedCallOutcome<DescribeVolumeAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeVolumeAttributeAsync(const DescribeVolumeAttributeRequest& request, const DescribeVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeVolumeAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeVolumeAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVolumeAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeVolumeAttributeAsync(DescribeVolumeAttributeRequest&& request, const DescribeVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeVolumeAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVolumeAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeVolumeAttributeAsyncHelper(const DescribeVolumeAttributeRequest& request, const DescribeVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4057,12 +5307,22 @@ DescribeVolumeStatusOutcome EC2Client::DescribeVolumeStatus(const DescribeVolume
 
 DescribeVolumeStatusOutcomeCallable EC2Client::DescribeVolumeStatusCallable(const DescribeVolumeStatusRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeVolumeStatus, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVolumeStatus, Aws::Client::RejectedCallOutcome<DescribeVolumeStatusOutcome>(), this, request);
+}
+
+DescribeVolumeStatusOutcomeCallable EC2Client::DescribeVolumeStatusCallable(DescribeVolumeStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVolumeStatus, Aws::Client::RejectedCallOutcome<DescribeVolumeStatusOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeVolumeStatusAsync(const DescribeVolumeStatusRequest& request, const DescribeVolumeStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeVolumeStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeVolumeStatusAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVolumeStatusOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeVolumeStatusAsync(DescribeVolumeStatusRequest&& request, const DescribeVolumeStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeVolumeStatusAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVolumeStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeVolumeStatusAsyncHelper(const DescribeVolumeStatusRequest& request, const DescribeVolumeStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4087,12 +5347,22 @@ DescribeVolumesOutcome EC2Client::DescribeVolumes(const DescribeVolumesRequest&
 
 DescribeVolumesOutcomeCallable EC2Client::DescribeVolumesCallable(const DescribeVolumesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeVolumes, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVolumes, Aws::Client::RejectedCallOutcome<DescribeVolumesOutcome>(), this, request);
+}
+
+DescribeVolumesOutcomeCallable EC2Client::DescribeVolumesCallable(DescribeVolumesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVolumes, Aws::Client::RejectedCallOutcome<DescribeVolumesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeVolumesAsync(const DescribeVolumesRequest& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeVolumesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeVolumesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVolumesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeVolumesAsync(DescribeVolumesRequest&& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeVolumesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVolumesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeVolumesAsyncHelper(const DescribeVolumesRequest& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4117,12 +5387,22 @@ DescribeVpcAttributeOutcome EC2Client::DescribeVpcAttribute(const DescribeVpcAtt
 
 DescribeVpcAttributeOutcomeCallable EC2Client::DescribeVpcAttributeCallable(const DescribeVpcAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeVpcAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpcAttribute, Aws::Client::RejectedCallOutcome<DescribeVpcAttributeOutcome>(), this, request);
+}
+
+DescribeVpcAttributeOutcomeCallable EC2Client::DescribeVpcAttributeCallable(DescribeVpcAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpcAttribute, Aws::Client::RejectedCallOutcome<DescribeVpcAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeVpcAttributeAsync(const DescribeVpcAttributeRequest& request, const DescribeVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeVpcAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpcAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpcAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeVpcAttributeAsync(DescribeVpcAttributeRequest&& request, const DescribeVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpcAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpcAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeVpcAttributeAsyncHelper(const DescribeVpcAttributeRequest& request, const DescribeVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4147,12 +5427,22 @@ DescribeVpcClassicLinkOutcome EC2Client::DescribeVpcClassicLink(const DescribeVp
 
 DescribeVpcClassicLinkOutcomeCallable EC2Client::DescribeVpcClassicLinkCallable(const DescribeVpcClassicLinkRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeVpcClassicLink, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpcClassicLink, Aws::Client::RejectedCallOutcome<DescribeVpcClassicLinkOutcome>(), this, request);
+}
+
+DescribeVpcClassicLinkOutcomeCallable EC2Client::DescribeVpcClassicLinkCallable(DescribeVpcClassicLinkRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpcClassicLink, Aws::Client::RejectedCallOutcome<DescribeVpcClassicLinkOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeVpcClassicLinkAsync(const DescribeVpcClassicLinkRequest& request, const DescribeVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeVpcClassicLinkAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpcClassicLinkAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpcClassicLinkOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeVpcClassicLinkAsync(DescribeVpcClassicLinkRequest&& request, const DescribeVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpcClassicLinkAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpcClassicLinkOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeVpcClassicLinkAsyncHelper(const DescribeVpcClassicLinkRequest& request, const DescribeVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4177,12 +5467,22 @@ DescribeVpcClassicLinkDnsSupportOutcome EC2Client::DescribeVpcClassicLinkDnsSupp
 
 DescribeVpcClassicLinkDnsSupportOutcomeCallable EC2Client::DescribeVpcClassicLinkDnsSupportCallable(const DescribeVpcClassicLinkDnsSupportRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeVpcClassicLinkDnsSupport, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpcClassicLinkDnsSupport, Aws::Client::RejectedCallOutcome<DescribeVpcClassicLinkDnsSupportOutcome>(), this, request);
+}
+
+DescribeVpcClassicLinkDnsSupportOutcomeCallable EC2Client::DescribeVpcClassicLinkDnsSupportCallable(DescribeVpcClassicLinkDnsSupportRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpcClassicLinkDnsSupport, Aws::Client::RejectedCallOutcome<DescribeVpcClassicLinkDnsSupportOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeVpcClassicLinkDnsSupportAsync(const DescribeVpcClassicLinkDnsSupportRequest& request, const DescribeVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeVpcClassicLinkDnsSupportAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpcClassicLinkDnsSupportAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpcClassicLinkDnsSupportOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeVpcClassicLinkDnsSupportAsync(DescribeVpcClassicLinkDnsSupportRequest&& request, const DescribeVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpcClassicLinkDnsSupportAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpcClassicLinkDnsSupportOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeVpcClassicLinkDnsSupportAsyncHelper(const DescribeVpcClassicLinkDnsSupportRequest& request, const DescribeVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4207,12 +5507,22 @@ DescribeVpcEndpointServicesOutcome EC2Client::DescribeVpcEndpointServices(const
 
 DescribeVpcEndpointServicesOutcomeCallable EC2Client::DescribeVpcEndpointServicesCallable(const DescribeVpcEndpointServicesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeVpcEndpointServices, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpcEndpointServices, Aws::Client::RejectedCallOutcome<DescribeVpcEndpointServicesOutcome>(), this, request);
+}
+
+DescribeVpcEndpointServicesOutcomeCallable EC2Client::DescribeVpcEndpointServicesCallable(DescribeVpcEndpointServicesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpcEndpointServices, Aws::Client::RejectedCallOutcome<DescribeVpcEndpointServicesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeVpcEndpointServicesAsync(const DescribeVpcEndpointServicesRequest& request, const DescribeVpcEndpointServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeVpcEndpointServicesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpcEndpointServicesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpcEndpointServicesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeVpcEndpointServicesAsync(DescribeVpcEndpointServicesRequest&& request, const DescribeVpcEndpointServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpcEndpointServicesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpcEndpointServicesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeVpcEndpointServicesAsyncHelper(const DescribeVpcEndpointServicesRequest& request, const DescribeVpcEndpointServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4237,12 +5547,22 @@ DescribeVpcEndpointsOutcome EC2Client::DescribeVpcEndpoints(const DescribeVpcEnd
 
 DescribeVpcEndpointsOutcomeCallable EC2Client::DescribeVpcEndpointsCallable(const DescribeVpcEndpointsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeVpcEndpoints, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpcEndpoints, Aws::Client::RejectedCallOutcome<DescribeVpcEndpointsOutcome>(), this, request);
+}
+
+DescribeVpcEndpointsOutcomeCallable EC2Client::DescribeVpcEndpointsCallable(DescribeVpcEndpointsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpcEndpoints, Aws::Client::RejectedCallOutcome<DescribeVpcEndpointsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeVpcEndpointsAsync(const DescribeVpcEndpointsRequest& request, const DescribeVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeVpcEndpointsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpcEndpointsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpcEndpointsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeVpcEndpointsAsync(DescribeVpcEndpointsRequest&& request, const DescribeVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpcEndpointsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpcEndpointsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeVpcEndpointsAsyncHelper(const DescribeVpcEndpointsRequest& request, const DescribeVpcEndpointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4267,12 +5587,22 @@ DescribeVpcPeeringConnectionsOutcome EC2Client::DescribeVpcPeeringConnections(co
 
 DescribeVpcPeeringConnectionsOutcomeCallable EC2Client::DescribeVpcPeeringConnectionsCallable(const DescribeVpcPeeringConnectionsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeVpcPeeringConnections, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpcPeeringConnections, Aws::Client::RejectedCallOutcome<DescribeVpcPeeringConnectionsOutcome>(), this, request);
+}
+
+DescribeVpcPeeringConnectionsOutcomeCallable EC2Client::DescribeVpcPeeringConnectionsCallable(DescribeVpcPeeringConnectionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpcPeeringConnections, Aws::Client::RejectedCallOutcome<DescribeVpcPeeringConnectionsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeVpcPeeringConnectionsAsync(const DescribeVpcPeeringConnectionsRequest& request, const DescribeVpcPeeringConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeVpcPeeringConnectionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpcPeeringConnectionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpcPeeringConnectionsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeVpcPeeringConnectionsAsync(DescribeVpcPeeringConnectionsRequest&& request, const DescribeVpcPeeringConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpcPeeringConnectionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpcPeeringConnectionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeVpcPeeringConnectionsAsyncHelper(const DescribeVpcPeeringConnectionsRequest& request, const DescribeVpcPeeringConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4297,12 +5627,22 @@ DescribeVpcsOutcome EC2Client::DescribeVpcs(const DescribeVpcsRequest& request)
 
 DescribeVpcsOutcomeCallable EC2Client::DescribeVpcsCallable(const DescribeVpcsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeVpcs, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpcs, Aws::Client::RejectedCallOutcome<DescribeVpcsOutcome>(), this, request);
+}
+
+DescribeVpcsOutcomeCallable EC2Client::DescribeVpcsCallable(DescribeVpcsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpcs, Aws::Client::RejectedCallOutcome<DescribeVpcsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeVpcsAsync(const DescribeVpcsRequest& request, const DescribeVpcsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeVpcsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpcsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpcsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeVpcsAsync(DescribeVpcsRequest&& request, const DescribeVpcsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpcsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpcsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeVpcsAsyncHelper(const DescribeVpcsRequest& request, const DescribeVpcsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4327,12 +5667,22 @@ DescribeVpnConnectionsOutcome EC2Client::DescribeVpnConnections(const DescribeVp
 
 DescribeVpnConnectionsOutcomeCallable EC2Client::DescribeVpnConnectionsCallable(const DescribeVpnConnectionsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeVpnConnections, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpnConnections, Aws::Client::RejectedCallOutcome<DescribeVpnConnectionsOutcome>(), this, request);
+}
+
+DescribeVpnConnectionsOutcomeCallable EC2Client::DescribeVpnConnectionsCallable(DescribeVpnConnectionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpnConnections, Aws::Client::RejectedCallOutcome<DescribeVpnConnectionsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeVpnConnectionsAsync(const DescribeVpnConnectionsRequest& request, const DescribeVpnConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeVpnConnectionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpnConnectionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpnConnectionsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeVpnConnectionsAsync(DescribeVpnConnectionsRequest&& request, const DescribeVpnConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpnConnectionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpnConnectionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeVpnConnectionsAsyncHelper(const DescribeVpnConnectionsRequest& request, const DescribeVpnConnectionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4357,12 +5707,22 @@ DescribeVpnGatewaysOutcome EC2Client::DescribeVpnGateways(const DescribeVpnGatew
 
 DescribeVpnGatewaysOutcomeCallable EC2Client::DescribeVpnGatewaysCallable(const DescribeVpnGatewaysRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DescribeVpnGateways, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpnGateways, Aws::Client::RejectedCallOutcome<DescribeVpnGatewaysOutcome>(), this, request);
+}
+
+DescribeVpnGatewaysOutcomeCallable EC2Client::DescribeVpnGatewaysCallable(DescribeVpnGatewaysRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DescribeVpnGateways, Aws::Client::RejectedCallOutcome<DescribeVpnGatewaysOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DescribeVpnGatewaysAsync(const DescribeVpnGatewaysRequest& request, const DescribeVpnGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DescribeVpnGatewaysAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpnGatewaysAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpnGatewaysOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DescribeVpnGatewaysAsync(DescribeVpnGatewaysRequest&& request, const DescribeVpnGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DescribeVpnGatewaysAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVpnGatewaysOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DescribeVpnGatewaysAsyncHelper(const DescribeVpnGatewaysRequest& request, const DescribeVpnGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4387,12 +5747,22 @@ DetachClassicLinkVpcOutcome EC2Client::DetachClassicLinkVpc(const DetachClassicL
 
 DetachClassicLinkVpcOutcomeCallable EC2Client::DetachClassicLinkVpcCallable(const DetachClassicLinkVpcRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DetachClassicLinkVpc, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DetachClassicLinkVpc, Aws::Client::RejectedCallOutcome<DetachClassicLinkVpcOutcome>(), this, request);
+}
+
+DetachClassicLinkVpcOutcomeCallable EC2Client::DetachClassicLinkVpcCallable(DetachClassicLinkVpcRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DetachClassicLinkVpc, Aws::Client::RejectedCallOutcome<DetachClassicLinkVpcOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DetachClassicLinkVpcAsync(const DetachClassicLinkVpcRequest& request, const DetachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DetachClassicLinkVpcAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DetachClassicLinkVpcAsyncHelper, Aws::Client::RejectedAsyncCall<DetachClassicLinkVpcOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DetachClassicLinkVpcAsync(DetachClassicLinkVpcRequest&& request, const DetachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DetachClassicLinkVpcAsyncHelper, Aws::Client::RejectedAsyncCall<DetachClassicLinkVpcOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DetachClassicLinkVpcAsyncHelper(const DetachClassicLinkVpcRequest& request, const DetachClassicLinkVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4417,12 +5787,22 @@ DetachInternetGatewayOutcome EC2Client::DetachInternetGateway(const DetachIntern
 
 DetachInternetGatewayOutcomeCallable EC2Client::DetachInternetGatewayCallable(const DetachInternetGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DetachInternetGateway, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DetachInternetGateway, Aws::Client::RejectedCallOutcome<DetachInternetGatewayOutcome>(), this, request);
+}
+
+DetachInternetGatewayOutcomeCallable EC2Client::DetachInternetGatewayCallable(DetachInternetGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DetachInternetGateway, Aws::Client::RejectedCallOutcome<DetachInternetGatewayOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DetachInternetGatewayAsync(const DetachInternetGatewayRequest& request, const DetachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DetachInternetGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DetachInternetGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DetachInternetGatewayOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DetachInternetGatewayAsync(DetachInternetGatewayRequest&& request, const DetachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DetachInternetGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DetachInternetGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DetachInternetGatewayAsyncHelper(const DetachInternetGatewayRequest& request, const DetachInternetGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4447,12 +5827,22 @@ DetachNetworkInterfaceOutcome EC2Client::DetachNetworkInterface(const DetachNetw
 
 DetachNetworkInterfaceOutcomeCallable EC2Client::DetachNetworkInterfaceCallable(const DetachNetworkInterfaceRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DetachNetworkInterface, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DetachNetworkInterface, Aws::Client::RejectedCallOutcome<DetachNetworkInterfaceOutcome>(), this, request);
+}
+
+DetachNetworkInterfaceOutcomeCallable EC2Client::DetachNetworkInterfaceCallable(DetachNetworkInterfaceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DetachNetworkInterface, Aws::Client::RejectedCallOutcome<DetachNetworkInterfaceOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DetachNetworkInterfaceAsync(const DetachNetworkInterfaceRequest& request, const DetachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DetachNetworkInterfaceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DetachNetworkInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<DetachNetworkInterfaceOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DetachNetworkInterfaceAsync(DetachNetworkInterfaceRequest&& request, const DetachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DetachNetworkInterfaceAsyncHelper, Aws::Client::RejectedAsyncCall<DetachNetworkInterfaceOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DetachNetworkInterfaceAsyncHelper(const DetachNetworkInterfaceRequest& request, const DetachNetworkInterfaceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4477,12 +5867,22 @@ DetachVolumeOutcome EC2Client::DetachVolume(const DetachVolumeRequest& request)
 
 DetachVolumeOutcomeCallable EC2Client::DetachVolumeCallable(const DetachVolumeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DetachVolume, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DetachVolume, Aws::Client::RejectedCallOutcome<DetachVolumeOutcome>(), this, request);
+}
+
+DetachVolumeOutcomeCallable EC2Client::DetachVolumeCallable(DetachVolumeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DetachVolume, Aws::Client::RejectedCallOutcome<DetachVolumeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DetachVolumeAsync(const DetachVolumeRequest& request, const DetachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DetachVolumeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DetachVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<DetachVolumeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DetachVolumeAsync(DetachVolumeRequest&& request, const DetachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DetachVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<DetachVolumeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DetachVolumeAsyncHelper(const DetachVolumeRequest& request, const DetachVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4507,12 +5907,22 @@ DetachVpnGatewayOutcome EC2Client::DetachVpnGateway(const DetachVpnGatewayReques
 
 DetachVpnGatewayOutcomeCallable EC2Client::DetachVpnGatewayCallable(const DetachVpnGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DetachVpnGateway, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DetachVpnGateway, Aws::Client::RejectedCallOutcome<DetachVpnGatewayOutcome>(), this, request);
+}
+
+DetachVpnGatewayOutcomeCallable EC2Client::DetachVpnGatewayCallable(DetachVpnGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DetachVpnGateway, Aws::Client::RejectedCallOutcome<DetachVpnGatewayOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DetachVpnGatewayAsync(const DetachVpnGatewayRequest& request, const DetachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DetachVpnGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DetachVpnGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DetachVpnGatewayOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DetachVpnGatewayAsync(DetachVpnGatewayRequest&& request, const DetachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DetachVpnGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DetachVpnGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DetachVpnGatewayAsyncHelper(const DetachVpnGatewayRequest& request, const DetachVpnGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4537,12 +5947,22 @@ DisableVgwRoutePropagationOutcome EC2Client::DisableVgwRoutePropagation(const Di
 
 DisableVgwRoutePropagationOutcomeCallable EC2Client::DisableVgwRoutePropagationCallable(const DisableVgwRoutePropagationRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DisableVgwRoutePropagation, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DisableVgwRoutePropagation, Aws::Client::RejectedCallOutcome<DisableVgwRoutePropagationOutcome>(), this, request);
+}
+
+DisableVgwRoutePropagationOutcomeCallable EC2Client::DisableVgwRoutePropagationCallable(DisableVgwRoutePropagationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DisableVgwRoutePropagation, Aws::Client::RejectedCallOutcome<DisableVgwRoutePropagationOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DisableVgwRoutePropagationAsync(const DisableVgwRoutePropagationRequest& request, const DisableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DisableVgwRoutePropagationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DisableVgwRoutePropagationAsyncHelper, Aws::Client::RejectedAsyncCall<DisableVgwRoutePropagationOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DisableVgwRoutePropagationAsync(DisableVgwRoutePropagationRequest&& request, const DisableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DisableVgwRoutePropagationAsyncHelper, Aws::Client::RejectedAsyncCall<DisableVgwRoutePropagationOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DisableVgwRoutePropagationAsyncHelper(const DisableVgwRoutePropagationRequest& request, const DisableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4567,12 +5987,22 @@ DisableVpcClassicLinkOutcome EC2Client::DisableVpcClassicLink(const DisableVpcCl
 
 DisableVpcClassicLinkOutcomeCallable EC2Client::DisableVpcClassicLinkCallable(const DisableVpcClassicLinkRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DisableVpcClassicLink, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DisableVpcClassicLink, Aws::Client::RejectedCallOutcome<DisableVpcClassicLinkOutcome>(), this, request);
+}
+
+DisableVpcClassicLinkOutcomeCallable EC2Client::DisableVpcClassicLinkCallable(DisableVpcClassicLinkRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DisableVpcClassicLink, Aws::Client::RejectedCallOutcome<DisableVpcClassicLinkOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DisableVpcClassicLinkAsync(const DisableVpcClassicLinkRequest& request, const DisableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DisableVpcClassicLinkAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DisableVpcClassicLinkAsyncHelper, Aws::Client::RejectedAsyncCall<DisableVpcClassicLinkOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DisableVpcClassicLinkAsync(DisableVpcClassicLinkRequest&& request, const DisableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DisableVpcClassicLinkAsyncHelper, Aws::Client::RejectedAsyncCall<DisableVpcClassicLinkOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DisableVpcClassicLinkAsyncHelper(const DisableVpcClassicLinkRequest& request, const DisableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4597,12 +6027,22 @@ DisableVpcClassicLinkDnsSupportOutcome EC2Client::DisableVpcClassicLinkDnsSuppor
 
 DisableVpcClassicLinkDnsSupportOutcomeCallable EC2Client::DisableVpcClassicLinkDnsSupportCallable(const DisableVpcClassicLinkDnsSupportRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DisableVpcClassicLinkDnsSupport, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DisableVpcClassicLinkDnsSupport, Aws::Client::RejectedCallOutcome<DisableVpcClassicLinkDnsSupportOutcome>(), this, request);
+}
+
+DisableVpcClassicLinkDnsSupportOutcomeCallable EC2Client::DisableVpcClassicLinkDnsSupportCallable(DisableVpcClassicLinkDnsSupportRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DisableVpcClassicLinkDnsSupport, Aws::Client::RejectedCallOutcome<DisableVpcClassicLinkDnsSupportOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DisableVpcClassicLinkDnsSupportAsync(const DisableVpcClassicLinkDnsSupportRequest& request, const DisableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DisableVpcClassicLinkDnsSupportAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DisableVpcClassicLinkDnsSupportAsyncHelper, Aws::Client::RejectedAsyncCall<DisableVpcClassicLinkDnsSupportOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DisableVpcClassicLinkDnsSupportAsync(DisableVpcClassicLinkDnsSupportRequest&& request, const DisableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DisableVpcClassicLinkDnsSupportAsyncHelper, Aws::Client::RejectedAsyncCall<DisableVpcClassicLinkDnsSupportOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DisableVpcClassicLinkDnsSupportAsyncHelper(const DisableVpcClassicLinkDnsSupportRequest& request, const DisableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4627,12 +6067,22 @@ DisassociateAddressOutcome EC2Client::DisassociateAddress(const DisassociateAddr
 
 DisassociateAddressOutcomeCallable EC2Client::DisassociateAddressCallable(const DisassociateAddressRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DisassociateAddress, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DisassociateAddress, Aws::Client::RejectedCallOutcome<DisassociateAddressOutcome>(), this, request);
+}
+
+DisassociateAddressOutcomeCallable EC2Client::DisassociateAddressCallable(DisassociateAddressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DisassociateAddress, Aws::Client::RejectedCallOutcome<DisassociateAddressOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DisassociateAddressAsync(const DisassociateAddressRequest& request, const DisassociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DisassociateAddressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DisassociateAddressAsyncHelper, Aws::Client::RejectedAsyncCall<DisassociateAddressOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DisassociateAddressAsync(DisassociateAddressRequest&& request, const DisassociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DisassociateAddressAsyncHelper, Aws::Client::RejectedAsyncCall<DisassociateAddressOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DisassociateAddressAsyncHelper(const DisassociateAddressRequest& request, const DisassociateAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4657,12 +6107,22 @@ DisassociateRouteTableOutcome EC2Client::DisassociateRouteTable(const Disassocia
 
 DisassociateRouteTableOutcomeCallable EC2Client::DisassociateRouteTableCallable(const DisassociateRouteTableRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::DisassociateRouteTable, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::DisassociateRouteTable, Aws::Client::RejectedCallOutcome<DisassociateRouteTableOutcome>(), this, request);
+}
+
+DisassociateRouteTableOutcomeCallable EC2Client::DisassociateRouteTableCallable(DisassociateRouteTableRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::DisassociateRouteTable, Aws::Client::RejectedCallOutcome<DisassociateRouteTableOutcome>(), this, std::move(request));
 }
 
 void EC2Client::DisassociateRouteTableAsync(const DisassociateRouteTableRequest& request, const DisassociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::DisassociateRouteTableAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::DisassociateRouteTableAsyncHelper, Aws::Client::RejectedAsyncCall<DisassociateRouteTableOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::DisassociateRouteTableAsync(DisassociateRouteTableRequest&& request, const DisassociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::DisassociateRouteTableAsyncHelper, Aws::Client::RejectedAsyncCall<DisassociateRouteTableOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::DisassociateRouteTableAsyncHelper(const DisassociateRouteTableRequest& request, const DisassociateRouteTableResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4687,12 +6147,22 @@ EnableVgwRoutePropagationOutcome EC2Client::EnableVgwRoutePropagation(const Enab
 
 EnableVgwRoutePropagationOutcomeCallable EC2Client::EnableVgwRoutePropagationCallable(const EnableVgwRoutePropagationRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::EnableVgwRoutePropagation, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::EnableVgwRoutePropagation, Aws::Client::RejectedCallOutcome<EnableVgwRoutePropagationOutcome>(), this, request);
+}
+
+EnableVgwRoutePropagationOutcomeCallable EC2Client::EnableVgwRoutePropagationCallable(EnableVgwRoutePropagationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::EnableVgwRoutePropagation, Aws::Client::RejectedCallOutcome<EnableVgwRoutePropagationOutcome>(), this, std::move(request));
 }
 
 void EC2Client::EnableVgwRoutePropagationAsync(const EnableVgwRoutePropagationRequest& request, const EnableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::EnableVgwRoutePropagationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::EnableVgwRoutePropagationAsyncHelper, Aws::Client::RejectedAsyncCall<EnableVgwRoutePropagationOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::EnableVgwRoutePropagationAsync(EnableVgwRoutePropagationRequest&& request, const EnableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::EnableVgwRoutePropagationAsyncHelper, Aws::Client::RejectedAsyncCall<EnableVgwRoutePropagationOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::EnableVgwRoutePropagationAsyncHelper(const EnableVgwRoutePropagationRequest& request, const EnableVgwRoutePropagationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4717,12 +6187,22 @@ EnableVolumeIOOutcome EC2Client::EnableVolumeIO(const EnableVolumeIORequest& req
 
 EnableVolumeIOOutcomeCallable EC2Client::EnableVolumeIOCallable(const EnableVolumeIORequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::EnableVolumeIO, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::EnableVolumeIO, Aws::Client::RejectedCallOutcome<EnableVolumeIOOutcome>(), this, request);
+}
+
+EnableVolumeIOOutcomeCallable EC2Client::EnableVolumeIOCallable(EnableVolumeIORequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::EnableVolumeIO, Aws::Client::RejectedCallOutcome<EnableVolumeIOOutcome>(), this, std::move(request));
 }
 
 void EC2Client::EnableVolumeIOAsync(const EnableVolumeIORequest& request, const EnableVolumeIOResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::EnableVolumeIOAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::EnableVolumeIOAsyncHelper, Aws::Client::RejectedAsyncCall<EnableVolumeIOOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::EnableVolumeIOAsync(EnableVolumeIORequest&& request, const EnableVolumeIOResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::EnableVolumeIOAsyncHelper, Aws::Client::RejectedAsyncCall<EnableVolumeIOOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::EnableVolumeIOAsyncHelper(const EnableVolumeIORequest& request, const EnableVolumeIOResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4747,12 +6227,22 @@ EnableVpcClassicLinkOutcome EC2Client::EnableVpcClassicLink(const EnableVpcClass
 
 EnableVpcClassicLinkOutcomeCallable EC2Client::EnableVpcClassicLinkCallable(const EnableVpcClassicLinkRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::EnableVpcClassicLink, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::EnableVpcClassicLink, Aws::Client::RejectedCallOutcome<EnableVpcClassicLinkOutcome>(), this, request);
+}
+
+EnableVpcClassicLinkOutcomeCallable EC2Client::EnableVpcClassicLinkCallable(EnableVpcClassicLinkRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::EnableVpcClassicLink, Aws::Client::RejectedCallOutcome<EnableVpcClassicLinkOutcome>(), this, std::move(request));
 }
 
 void EC2Client::EnableVpcClassicLinkAsync(const EnableVpcClassicLinkRequest& request, const EnableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::EnableVpcClassicLinkAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::EnableVpcClassicLinkAsyncHelper, Aws::Client::RejectedAsyncCall<EnableVpcClassicLinkOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::EnableVpcClassicLinkAsync(EnableVpcClassicLinkRequest&& request, const EnableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::EnableVpcClassicLinkAsyncHelper, Aws::Client::RejectedAsyncCall<EnableVpcClassicLinkOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::EnableVpcClassicLinkAsyncHelper(const EnableVpcClassicLinkRequest& request, const EnableVpcClassicLinkResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4777,12 +6267,22 @@ EnableVpcClassicLinkDnsSupportOutcome EC2Client::EnableVpcClassicLinkDnsSupport(
 
 EnableVpcClassicLinkDnsSupportOutcomeCallable EC2Client::EnableVpcClassicLinkDnsSupportCallable(const EnableVpcClassicLinkDnsSupportRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::EnableVpcClassicLinkDnsSupport, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::EnableVpcClassicLinkDnsSupport, Aws::Client::RejectedCallOutcome<EnableVpcClassicLinkDnsSupportOutcome>(), this, request);
+}
+
+EnableVpcClassicLinkDnsSupportOutcomeCallable EC2Client::EnableVpcClassicLinkDnsSupportCallable(EnableVpcClassicLinkDnsSupportRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::EnableVpcClassicLinkDnsSupport, Aws::Client::RejectedCallOutcome<EnableVpcClassicLinkDnsSupportOutcome>(), this, std::move(request));
 }
 
 void EC2Client::EnableVpcClassicLinkDnsSupportAsync(const EnableVpcClassicLinkDnsSupportRequest& request, const EnableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::EnableVpcClassicLinkDnsSupportAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::EnableVpcClassicLinkDnsSupportAsyncHelper, Aws::Client::RejectedAsyncCall<EnableVpcClassicLinkDnsSupportOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::EnableVpcClassicLinkDnsSupportAsync(EnableVpcClassicLinkDnsSupportRequest&& request, const EnableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::EnableVpcClassicLinkDnsSupportAsyncHelper, Aws::Client::RejectedAsyncCall<EnableVpcClassicLinkDnsSupportOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::EnableVpcClassicLinkDnsSupportAsyncHelper(const EnableVpcClassicLinkDnsSupportRequest& request, const EnableVpcClassicLinkDnsSupportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4807,12 +6307,22 @@ GetConsoleOutputOutcome EC2Client::GetConsoleOutput(const GetConsoleOutputReques
 
 GetConsoleOutputOutcomeCallable EC2Client::GetConsoleOutputCallable(const GetConsoleOutputRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::GetConsoleOutput, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::GetConsoleOutput, Aws::Client::RejectedCallOutcome<GetConsoleOutputOutcome>(), this, request);
+}
+
+GetConsoleOutputOutcomeCallable EC2Client::GetConsoleOutputCallable(GetConsoleOutputRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::GetConsoleOutput, Aws::Client::RejectedCallOutcome<GetConsoleOutputOutcome>(), this, std::move(request));
 }
 
 void EC2Client::GetConsoleOutputAsync(const GetConsoleOutputRequest& request, const GetConsoleOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::GetConsoleOutputAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::GetConsoleOutputAsyncHelper, Aws::Client::RejectedAsyncCall<GetConsoleOutputOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::GetConsoleOutputAsync(GetConsoleOutputRequest&& request, const GetConsoleOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::GetConsoleOutputAsyncHelper, Aws::Client::RejectedAsyncCall<GetConsoleOutputOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::GetConsoleOutputAsyncHelper(const GetConsoleOutputRequest& request, const GetConsoleOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4837,12 +6347,22 @@ GetPasswordDataOutcome EC2Client::GetPasswordData(const GetPasswordDataRequest&
 
 GetPasswordDataOutcomeCallable EC2Client::GetPasswordDataCallable(const GetPasswordDataRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::GetPasswordData, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::GetPasswordData, Aws::Client::RejectedCallOutcome<GetPasswordDataOutcome>(), this, request);
+}
+
+GetPasswordDataOutcomeCallable EC2Client::GetPasswordDataCallable(GetPasswordDataRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::GetPasswordData, Aws::Client::RejectedCallOutcome<GetPasswordDataOutcome>(), this, std::move(request));
 }
 
 void EC2Client::GetPasswordDataAsync(const GetPasswordDataRequest& request, const GetPasswordDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::GetPasswordDataAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::GetPasswordDataAsyncHelper, Aws::Client::RejectedAsyncCall<GetPasswordDataOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::GetPasswordDataAsync(GetPasswordDataRequest&& request, const GetPasswordDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::GetPasswordDataAsyncHelper, Aws::Client::RejectedAsyncCall<GetPasswordDataOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::GetPasswordDataAsyncHelper(const GetPasswordDataRequest& request, const GetPasswordDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4867,12 +6387,22 @@ ImportImageOutcome EC2Client::ImportImage(const ImportImageRequest& request) con
 
 ImportImageOutcomeCallable EC2Client::ImportImageCallable(const ImportImageRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ImportImage, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ImportImage, Aws::Client::RejectedCallOutcome<ImportImageOutcome>(), this, request);
+}
+
+ImportImageOutcomeCallable EC2Client::ImportImageCallable(ImportImageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ImportImage, Aws::Client::RejectedCallOutcome<ImportImageOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ImportImageAsync(const ImportImageRequest& request, const ImportImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ImportImageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ImportImageAsyncHelper, Aws::Client::RejectedAsyncCall<ImportImageOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ImportImageAsync(ImportImageRequest&& request, const ImportImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ImportImageAsyncHelper, Aws::Client::RejectedAsyncCall<ImportImageOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ImportImageAsyncHelper(const ImportImageRequest& request, const ImportImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4897,12 +6427,22 @@ ImportInstanceOutcome EC2Client::ImportInstance(const ImportInstanceRequest& req
 
 ImportInstanceOutcomeCallable EC2Client::ImportInstanceCallable(const ImportInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ImportInstance, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ImportInstance, Aws::Client::RejectedCallOutcome<ImportInstanceOutcome>(), this, request);
+}
+
+ImportInstanceOutcomeCallable EC2Client::ImportInstanceCallable(ImportInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ImportInstance, Aws::Client::RejectedCallOutcome<ImportInstanceOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ImportInstanceAsync(const ImportInstanceRequest& request, const ImportInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ImportInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ImportInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<ImportInstanceOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ImportInstanceAsync(ImportInstanceRequest&& request, const ImportInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ImportInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<ImportInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ImportInstanceAsyncHelper(const ImportInstanceRequest& request, const ImportInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4927,12 +6467,22 @@ ImportKeyPairOutcome EC2Client::ImportKeyPair(const ImportKeyPairRequest& reques
 
 ImportKeyPairOutcomeCallable EC2Client::ImportKeyPairCallable(const ImportKeyPairRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ImportKeyPair, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ImportKeyPair, Aws::Client::RejectedCallOutcome<ImportKeyPairOutcome>(), this, request);
+}
+
+ImportKeyPairOutcomeCallable EC2Client::ImportKeyPairCallable(ImportKeyPairRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ImportKeyPair, Aws::Client::RejectedCallOutcome<ImportKeyPairOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ImportKeyPairAsync(const ImportKeyPairRequest& request, const ImportKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ImportKeyPairAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ImportKeyPairAsyncHelper, Aws::Client::RejectedAsyncCall<ImportKeyPairOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ImportKeyPairAsync(ImportKeyPairRequest&& request, const ImportKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ImportKeyPairAsyncHelper, Aws::Client::RejectedAsyncCall<ImportKeyPairOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ImportKeyPairAsyncHelper(const ImportKeyPairRequest& request, const ImportKeyPairResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4957,12 +6507,22 @@ ImportSnapshotOutcome EC2Client::ImportSnapshot(const ImportSnapshotRequest& req
 
 ImportSnapshotOutcomeCallable EC2Client::ImportSnapshotCallable(const ImportSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ImportSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ImportSnapshot, Aws::Client::RejectedCallOutcome<ImportSnapshotOutcome>(), this, request);
+}
+
+ImportSnapshotOutcomeCallable EC2Client::ImportSnapshotCallable(ImportSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ImportSnapshot, Aws::Client::RejectedCallOutcome<ImportSnapshotOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ImportSnapshotAsync(const ImportSnapshotRequest& request, const ImportSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ImportSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ImportSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<ImportSnapshotOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ImportSnapshotAsync(ImportSnapshotRequest&& request, const ImportSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ImportSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<ImportSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ImportSnapshotAsyncHelper(const ImportSnapshotRequest& request, const ImportSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -4987,12 +6547,22 @@ ImportVolumeOutcome EC2Client::ImportVolume(const ImportVolumeRequest& request)
 
 ImportVolumeOutcomeCallable EC2Client::ImportVolumeCallable(const ImportVolumeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ImportVolume, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ImportVolume, Aws::Client::RejectedCallOutcome<ImportVolumeOutcome>(), this, request);
+}
+
+ImportVolumeOutcomeCallable EC2Client::ImportVolumeCallable(ImportVolumeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ImportVolume, Aws::Client::RejectedCallOutcome<ImportVolumeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ImportVolumeAsync(const ImportVolumeRequest& request, const ImportVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ImportVolumeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ImportVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<ImportVolumeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ImportVolumeAsync(ImportVolumeRequest&& request, const ImportVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ImportVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<ImportVolumeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ImportVolumeAsyncHelper(const ImportVolumeRequest& request, const ImportVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5015,14 +6585,24 @@ ModifyHostsOutcome EC2Client::ModifyHosts(const ModifyHostsRequest& request) con
   }
 }
 
-ModifyHostsOutcomeCallable EC2Client::ModifyHostsCallable(const ModifyHostsRequest& request) const
+ModifyHostsOutcomeCallable EC2Client::ModifyHostsCallable(const ModifyHostsRequest& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyHosts, Aws::Client::RejectedCallOutcome<ModifyHostsOutcome>(), this, request);
+}
+
+ModifyHostsOutcomeCallable EC2Client::ModifyHostsCallable(ModifyHostsRequest&& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ModifyHosts, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyHosts, Aws::Client::RejectedCallOutcome<ModifyHostsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ModifyHostsAsync(const ModifyHostsRequest& request, const ModifyHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ModifyHostsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ModifyHostsAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyHostsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ModifyHostsAsync(ModifyHostsRequest&& request, const ModifyHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ModifyHostsAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyHostsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ModifyHostsAsyncHelper(const ModifyHostsRequest& request, const ModifyHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5047,12 +6627,22 @@ ModifyIdFormatOutcome EC2Client::ModifyIdFormat(const ModifyIdFormatRequest& req
 
 ModifyIdFormatOutcomeCallable EC2Client::ModifyIdFormatCallable(const ModifyIdFormatRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ModifyIdFormat, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyIdFormat, Aws::Client::RejectedCallOutcome<ModifyIdFormatOutcome>(), this, request);
+}
+
+ModifyIdFormatOutcomeCallable EC2Client::ModifyIdFormatCallable(ModifyIdFormatRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyIdFormat, Aws::Client::RejectedCallOutcome<ModifyIdFormatOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ModifyIdFormatAsync(const ModifyIdFormatRequest& request, const ModifyIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ModifyIdFormatAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ModifyIdFormatAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyIdFormatOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ModifyIdFormatAsync(ModifyIdFormatRequest&& request, const ModifyIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ModifyIdFormatAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyIdFormatOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ModifyIdFormatAsyncHelper(const ModifyIdFormatRequest& request, const ModifyIdFormatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5077,12 +6667,22 @@ ModifyImageAttributeOutcome EC2Client::ModifyImageAttribute(const ModifyImageAtt
 
 ModifyImageAttributeOutcomeCallable EC2Client::ModifyImageAttributeCallable(const ModifyImageAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ModifyImageAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyImageAttribute, Aws::Client::RejectedCallOutcome<ModifyImageAttributeOutcome>(), this, request);
+}
+
+ModifyImageAttributeOutcomeCallable EC2Client::ModifyImageAttributeCallable(ModifyImageAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyImageAttribute, Aws::Client::RejectedCallOutcome<ModifyImageAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ModifyImageAttributeAsync(const ModifyImageAttributeRequest& request, const ModifyImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ModifyImageAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ModifyImageAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyImageAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ModifyImageAttributeAsync(ModifyImageAttributeRequest&& request, const ModifyImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ModifyImageAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyImageAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ModifyImageAttributeAsyncHelper(const ModifyImageAttributeRequest& request, const ModifyImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5107,12 +6707,22 @@ ModifyInstanceAttributeOutcome EC2Client::ModifyInstanceAttribute(const ModifyIn
 
 ModifyInstanceAttributeOutcomeCallable EC2Client::ModifyInstanceAttributeCallable(const ModifyInstanceAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ModifyInstanceAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyInstanceAttribute, Aws::Client::RejectedCallOutcome<ModifyInstanceAttributeOutcome>(), this, request);
+}
+
+ModifyInstanceAttributeOutcomeCallable EC2Client::ModifyInstanceAttributeCallable(ModifyInstanceAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyInstanceAttribute, Aws::Client::RejectedCallOutcome<ModifyInstanceAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ModifyInstanceAttributeAsync(const ModifyInstanceAttributeRequest& request, const ModifyInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ModifyInstanceAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ModifyInstanceAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyInstanceAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ModifyInstanceAttributeAsync(ModifyInstanceAttributeRequest&& request, const ModifyInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ModifyInstanceAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyInstanceAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ModifyInstanceAttributeAsyncHelper(const ModifyInstanceAttributeRequest& request, const ModifyInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5137,12 +6747,22 @@ ModifyInstancePlacementOutcome EC2Client::ModifyInstancePlacement(const ModifyIn
 
 ModifyInstancePlacementOutcomeCallable EC2Client::ModifyInstancePlacementCallable(const ModifyInstancePlacementRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ModifyInstancePlacement, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyInstancePlacement, Aws::Client::RejectedCallOutcome<ModifyInstancePlacementOutcome>(), this, request);
+}
+
+ModifyInstancePlacementOutcomeCallable EC2Client::ModifyInstancePlacementCallable(ModifyInstancePlacementRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyInstancePlacement, Aws::Client::RejectedCallOutcome<ModifyInstancePlacementOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ModifyInstancePlacementAsync(const ModifyInstancePlacementRequest& request, const ModifyInstancePlacementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ModifyInstancePlacementAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ModifyInstancePlacementAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyInstancePlacementOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ModifyInstancePlacementAsync(ModifyInstancePlacementRequest&& request, const ModifyInstancePlacementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ModifyInstancePlacementAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyInstancePlacementOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ModifyInstancePlacementAsyncHelper(const ModifyInstancePlacementRequest& request, const ModifyInstancePlacementResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5167,12 +6787,22 @@ ModifyNetworkInterfaceAttributeOutcome EC2Client::ModifyNetworkInterfaceAttribut
 
 ModifyNetworkInterfaceAttributeOutcomeCallable EC2Client::ModifyNetworkInterfaceAttributeCallable(const ModifyNetworkInterfaceAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ModifyNetworkInterfaceAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyNetworkInterfaceAttribute, Aws::Client::RejectedCallOutcome<ModifyNetworkInterfaceAttributeOutcome>(), this, request);
+}
+
+ModifyNetworkInterfaceAttributeOutcomeCallable EC2Client::ModifyNetworkInterfaceAttributeCallable(ModifyNetworkInterfaceAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyNetworkInterfaceAttribute, Aws::Client::RejectedCallOutcome<ModifyNetworkInterfaceAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ModifyNetworkInterfaceAttributeAsync(const ModifyNetworkInterfaceAttributeRequest& request, const ModifyNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ModifyNetworkInterfaceAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ModifyNetworkInterfaceAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyNetworkInterfaceAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ModifyNetworkInterfaceAttributeAsync(ModifyNetworkInterfaceAttributeRequest&& request, const ModifyNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ModifyNetworkInterfaceAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyNetworkInterfaceAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ModifyNetworkInterfaceAttributeAsyncHelper(const ModifyNetworkInterfaceAttributeRequest& request, const ModifyNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5197,12 +6827,22 @@ ModifyReservedInstancesOutcome EC2Client::ModifyReservedInstances(const ModifyRe
 
 ModifyReservedInstancesOutcomeCallable EC2Client::ModifyReservedInstancesCallable(const ModifyReservedInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ModifyReservedInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyReservedInstances, Aws::Client::RejectedCallOutcome<ModifyReservedInstancesOutcome>(), this, request);
+}
+
+ModifyReservedInstancesOutcomeCallable EC2Client::ModifyReservedInstancesCallable(ModifyReservedInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyReservedInstances, Aws::Client::RejectedCallOutcome<ModifyReservedInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ModifyReservedInstancesAsync(const ModifyReservedInstancesRequest& request, const ModifyReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ModifyReservedInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ModifyReservedInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyReservedInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ModifyReservedInstancesAsync(ModifyReservedInstancesRequest&& request, const ModifyReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ModifyReservedInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyReservedInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ModifyReservedInstancesAsyncHelper(const ModifyReservedInstancesRequest& request, const ModifyReservedInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5227,12 +6867,22 @@ ModifySnapshotAttributeOutcome EC2Client::ModifySnapshotAttribute(const ModifySn
 
 ModifySnapshotAttributeOutcomeCallable EC2Client::ModifySnapshotAttributeCallable(const ModifySnapshotAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ModifySnapshotAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ModifySnapshotAttribute, Aws::Client::RejectedCallOutcome<ModifySnapshotAttributeOutcome>(), this, request);
+}
+
+ModifySnapshotAttributeOutcomeCallable EC2Client::ModifySnapshotAttributeCallable(ModifySnapshotAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ModifySnapshotAttribute, Aws::Client::RejectedCallOutcome<ModifySnapshotAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ModifySnapshotAttributeAsync(const ModifySnapshotAttributeRequest& request, const ModifySnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ModifySnapshotAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ModifySnapshotAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifySnapshotAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ModifySnapshotAttributeAsync(ModifySnapshotAttributeRequest&& request, const ModifySnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ModifySnapshotAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifySnapshotAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ModifySnapshotAttributeAsyncHelper(const ModifySnapshotAttributeRequest& request, const ModifySnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5257,12 +6907,22 @@ ModifySpotFleetRequestOutcome EC2Client::ModifySpotFleetRequest(const ModifySpot
 
 ModifySpotFleetRequestOutcomeCallable EC2Client::ModifySpotFleetRequestCallable(const ModifySpotFleetRequestRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ModifySpotFleetRequest, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ModifySpotFleetRequest, Aws::Client::RejectedCallOutcome<ModifySpotFleetRequestOutcome>(), this, request);
+}
+
+ModifySpotFleetRequestOutcomeCallable EC2Client::ModifySpotFleetRequestCallable(ModifySpotFleetRequestRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ModifySpotFleetRequest, Aws::Client::RejectedCallOutcome<ModifySpotFleetRequestOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ModifySpotFleetRequestAsync(const ModifySpotFleetRequestRequest& request, const ModifySpotFleetRequestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ModifySpotFleetRequestAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ModifySpotFleetRequestAsyncHelper, Aws::Client::RejectedAsyncCall<ModifySpotFleetRequestOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ModifySpotFleetRequestAsync(ModifySpotFleetRequestRequest&& request, const ModifySpotFleetRequestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ModifySpotFleetRequestAsyncHelper, Aws::Client::RejectedAsyncCall<ModifySpotFleetRequestOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ModifySpotFleetRequestAsyncHelper(const ModifySpotFleetRequestRequest& request, const ModifySpotFleetRequestResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5287,12 +6947,22 @@ ModifySubnetAttributeOutcome EC2Client::ModifySubnetAttribute(const ModifySubnet
 
 ModifySubnetAttributeOutcomeCallable EC2Client::ModifySubnetAttributeCallable(const ModifySubnetAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ModifySubnetAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ModifySubnetAttribute, Aws::Client::RejectedCallOutcome<ModifySubnetAttributeOutcome>(), this, request);
+}
+
+ModifySubnetAttributeOutcomeCallable EC2Client::ModifySubnetAttributeCallable(ModifySubnetAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ModifySubnetAttribute, Aws::Client::RejectedCallOutcome<ModifySubnetAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ModifySubnetAttributeAsync(const ModifySubnetAttributeRequest& request, const ModifySubnetAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ModifySubnetAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ModifySubnetAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifySubnetAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ModifySubnetAttributeAsync(ModifySubnetAttributeRequest&& request, const ModifySubnetAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ModifySubnetAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifySubnetAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ModifySubnetAttributeAsyncHelper(const ModifySubnetAttributeRequest& request, const ModifySubnetAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5317,12 +6987,22 @@ ModifyVolumeAttributeOutcome EC2Client::ModifyVolumeAttribute(const ModifyVolume
 
 ModifyVolumeAttributeOutcomeCallable EC2Client::ModifyVolumeAttributeCallable(const ModifyVolumeAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ModifyVolumeAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyVolumeAttribute, Aws::Client::RejectedCallOutcome<ModifyVolumeAttributeOutcome>(), this, request);
+}
+
+ModifyVolumeAttributeOutcomeCallable EC2Client::ModifyVolumeAttributeCallable(ModifyVolumeAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyVolumeAttribute, Aws::Client::RejectedCallOutcome<ModifyVolumeAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ModifyVolumeAttributeAsync(const ModifyVolumeAttributeRequest& request, const ModifyVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ModifyVolumeAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ModifyVolumeAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyVolumeAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ModifyVolumeAttributeAsync(ModifyVolumeAttributeRequest&& request, const ModifyVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ModifyVolumeAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyVolumeAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ModifyVolumeAttributeAsyncHelper(const ModifyVolumeAttributeRequest& request, const ModifyVolumeAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5347,12 +7027,22 @@ ModifyVpcAttributeOutcome EC2Client::ModifyVpcAttribute(const ModifyVpcAttribute
 
 ModifyVpcAttributeOutcomeCallable EC2Client::ModifyVpcAttributeCallable(const ModifyVpcAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ModifyVpcAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyVpcAttribute, Aws::Client::RejectedCallOutcome<ModifyVpcAttributeOutcome>(), this, request);
+}
+
+ModifyVpcAttributeOutcomeCallable EC2Client::ModifyVpcAttributeCallable(ModifyVpcAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyVpcAttribute, Aws::Client::RejectedCallOutcome<ModifyVpcAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ModifyVpcAttributeAsync(const ModifyVpcAttributeRequest& request, const ModifyVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ModifyVpcAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ModifyVpcAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyVpcAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ModifyVpcAttributeAsync(ModifyVpcAttributeRequest&& request, const ModifyVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ModifyVpcAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyVpcAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ModifyVpcAttributeAsyncHelper(const ModifyVpcAttributeRequest& request, const ModifyVpcAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5377,12 +7067,22 @@ ModifyVpcEndpointOutcome EC2Client::ModifyVpcEndpoint(const ModifyVpcEndpointReq
 
 ModifyVpcEndpointOutcomeCallable EC2Client::ModifyVpcEndpointCallable(const ModifyVpcEndpointRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ModifyVpcEndpoint, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyVpcEndpoint, Aws::Client::RejectedCallOutcome<ModifyVpcEndpointOutcome>(), this, request);
+}
+
+ModifyVpcEndpointOutcomeCallable EC2Client::ModifyVpcEndpointCallable(ModifyVpcEndpointRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ModifyVpcEndpoint, Aws::Client::RejectedCallOutcome<ModifyVpcEndpointOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ModifyVpcEndpointAsync(const ModifyVpcEndpointRequest& request, const ModifyVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ModifyVpcEndpointAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ModifyVpcEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyVpcEndpointOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ModifyVpcEndpointAsync(ModifyVpcEndpointRequest&& request, const ModifyVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ModifyVpcEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyVpcEndpointOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ModifyVpcEndpointAsyncHelper(const ModifyVpcEndpointRequest& request, const ModifyVpcEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5407,12 +7107,22 @@ MonitorInstancesOutcome EC2Client::MonitorInstances(const MonitorInstancesReques
 
 MonitorInstancesOutcomeCallable EC2Client::MonitorInstancesCallable(const MonitorInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::MonitorInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::MonitorInstances, Aws::Client::RejectedCallOutcome<MonitorInstancesOutcome>(), this, request);
+}
+
+MonitorInstancesOutcomeCallable EC2Client::MonitorInstancesCallable(MonitorInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::MonitorInstances, Aws::Client::RejectedCallOutcome<MonitorInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::MonitorInstancesAsync(const MonitorInstancesRequest& request, const MonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::MonitorInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::MonitorInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<MonitorInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::MonitorInstancesAsync(MonitorInstancesRequest&& request, const MonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::MonitorInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<MonitorInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::MonitorInstancesAsyncHelper(const MonitorInstancesRequest& request, const MonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5437,12 +7147,22 @@ MoveAddressToVpcOutcome EC2Client::MoveAddressToVpc(const MoveAddressToVpcReques
 
 MoveAddressToVpcOutcomeCallable EC2Client::MoveAddressToVpcCallable(const MoveAddressToVpcRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::MoveAddressToVpc, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::MoveAddressToVpc, Aws::Client::RejectedCallOutcome<MoveAddressToVpcOutcome>(), this, request);
+}
+
+MoveAddressToVpcOutcomeCallable EC2Client::MoveAddressToVpcCallable(MoveAddressToVpcRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::MoveAddressToVpc, Aws::Client::RejectedCallOutcome<MoveAddressToVpcOutcome>(), this, std::move(request));
 }
 
 void EC2Client::MoveAddressToVpcAsync(const MoveAddressToVpcRequest& request, const MoveAddressToVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::MoveAddressToVpcAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::MoveAddressToVpcAsyncHelper, Aws::Client::RejectedAsyncCall<MoveAddressToVpcOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::MoveAddressToVpcAsync(MoveAddressToVpcRequest&& request, const MoveAddressToVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::MoveAddressToVpcAsyncHelper, Aws::Client::RejectedAsyncCall<MoveAddressToVpcOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::MoveAddressToVpcAsyncHelper(const MoveAddressToVpcRequest& request, const MoveAddressToVpcResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5467,12 +7187,22 @@ PurchaseReservedInstancesOfferingOutcome EC2Client::PurchaseReservedInstancesOff
 
 PurchaseReservedInstancesOfferingOutcomeCallable EC2Client::PurchaseReservedInstancesOfferingCallable(const PurchaseReservedInstancesOfferingRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::PurchaseReservedInstancesOffering, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::PurchaseReservedInstancesOffering, Aws::Client::RejectedCallOutcome<PurchaseReservedInstancesOfferingOutcome>(), this, request);
+}
+
+PurchaseReservedInstancesOfferingOutcomeCallable EC2Client::PurchaseReservedInstancesOfferingCallable(PurchaseReservedInstancesOfferingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::PurchaseReservedInstancesOffering, Aws::Client::RejectedCallOutcome<PurchaseReservedInstancesOfferingOutcome>(), this, std::move(request));
 }
 
 void EC2Client::PurchaseReservedInstancesOfferingAsync(const PurchaseReservedInstancesOfferingRequest& request, const PurchaseReservedInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::PurchaseReservedInstancesOfferingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::PurchaseReservedInstancesOfferingAsyncHelper, Aws::Client::RejectedAsyncCall<PurchaseReservedInstancesOfferingOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::PurchaseReservedInstancesOfferingAsync(PurchaseReservedInstancesOfferingRequest&& request, const PurchaseReservedInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::PurchaseReservedInstancesOfferingAsyncHelper, Aws::Client::RejectedAsyncCall<PurchaseReservedInstancesOfferingOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::PurchaseReservedInstancesOfferingAsyncHelper(const PurchaseReservedInstancesOfferingRequest& request, const PurchaseReservedInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5497,12 +7227,22 @@ PurchaseScheduledInstancesOutcome EC2Client::PurchaseScheduledInstances(const Pu
 
 PurchaseScheduledInstancesOutcomeCallable EC2Client::PurchaseScheduledInstancesCallable(const PurchaseScheduledInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::PurchaseScheduledInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::PurchaseScheduledInstances, Aws::Client::RejectedCallOutcome<PurchaseScheduledInstancesOutcome>(), this, request);
+}
+
+PurchaseScheduledInstancesOutcomeCallable EC2Client::PurchaseScheduledInstancesCallable(PurchaseScheduledInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::PurchaseScheduledInstances, Aws::Client::RejectedCallOutcome<PurchaseScheduledInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::PurchaseScheduledInstancesAsync(const PurchaseScheduledInstancesRequest& request, const PurchaseScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::PurchaseScheduledInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::PurchaseScheduledInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<PurchaseScheduledInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::PurchaseScheduledInstancesAsync(PurchaseScheduledInstancesRequest&& request, const PurchaseScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::PurchaseScheduledInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<PurchaseScheduledInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::PurchaseScheduledInstancesAsyncHelper(const PurchaseScheduledInstancesRequest& request, const PurchaseScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5527,12 +7267,22 @@ RebootInstancesOutcome EC2Client::RebootInstances(const RebootInstancesRequest&
 
 RebootInstancesOutcomeCallable EC2Client::RebootInstancesCallable(const RebootInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::RebootInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::RebootInstances, Aws::Client::RejectedCallOutcome<RebootInstancesOutcome>(), this, request);
+}
+
+RebootInstancesOutcomeCallable EC2Client::RebootInstancesCallable(RebootInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::RebootInstances, Aws::Client::RejectedCallOutcome<RebootInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::RebootInstancesAsync(const RebootInstancesRequest& request, const RebootInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::RebootInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::RebootInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<RebootInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::RebootInstancesAsync(RebootInstancesRequest&& request, const RebootInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::RebootInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<RebootInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::RebootInstancesAsyncHelper(const RebootInstancesRequest& request, const RebootInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5557,12 +7307,22 @@ RegisterImageOutcome EC2Client::RegisterImage(const RegisterImageRequest& reques
 
 RegisterImageOutcomeCallable EC2Client::RegisterImageCallable(const RegisterImageRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::RegisterImage, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::RegisterImage, Aws::Client::RejectedCallOutcome<RegisterImageOutcome>(), this, request);
+}
+
+RegisterImageOutcomeCallable EC2Client::RegisterImageCallable(RegisterImageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::RegisterImage, Aws::Client::RejectedCallOutcome<RegisterImageOutcome>(), this, std::move(request));
 }
 
 void EC2Client::RegisterImageAsync(const RegisterImageRequest& request, const RegisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::RegisterImageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::RegisterImageAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterImageOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::RegisterImageAsync(RegisterImageRequest&& request, const RegisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::RegisterImageAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterImageOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::RegisterImageAsyncHelper(const RegisterImageRequest& request, const RegisterImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5587,12 +7347,22 @@ RejectVpcPeeringConnectionOutcome EC2Client::RejectVpcPeeringConnection(const Re
 
 RejectVpcPeeringConnectionOutcomeCallable EC2Client::RejectVpcPeeringConnectionCallable(const RejectVpcPeeringConnectionRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::RejectVpcPeeringConnection, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::RejectVpcPeeringConnection, Aws::Client::RejectedCallOutcome<RejectVpcPeeringConnectionOutcome>(), this, request);
+}
+
+RejectVpcPeeringConnectionOutcomeCallable EC2Client::RejectVpcPeeringConnectionCallable(RejectVpcPeeringConnectionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::RejectVpcPeeringConnection, Aws::Client::RejectedCallOutcome<RejectVpcPeeringConnectionOutcome>(), this, std::move(request));
 }
 
 void EC2Client::RejectVpcPeeringConnectionAsync(const RejectVpcPeeringConnectionRequest& request, const RejectVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::RejectVpcPeeringConnectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::RejectVpcPeeringConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<RejectVpcPeeringConnectionOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::RejectVpcPeeringConnectionAsync(RejectVpcPeeringConnectionRequest&& request, const RejectVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::RejectVpcPeeringConnectionAsyncHelper, Aws::Client::RejectedAsyncCall<RejectVpcPeeringConnectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::RejectVpcPeeringConnectionAsyncHelper(const RejectVpcPeeringConnectionRequest& request, const RejectVpcPeeringConnectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5617,12 +7387,22 @@ ReleaseAddressOutcome EC2Client::ReleaseAddress(const ReleaseAddressRequest& req
 
 ReleaseAddressOutcomeCallable EC2Client::ReleaseAddressCallable(const ReleaseAddressRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ReleaseAddress, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ReleaseAddress, Aws::Client::RejectedCallOutcome<ReleaseAddressOutcome>(), this, request);
+}
+
+ReleaseAddressOutcomeCallable EC2Client::ReleaseAddressCallable(ReleaseAddressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ReleaseAddress, Aws::Client::RejectedCallOutcome<ReleaseAddressOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ReleaseAddressAsync(const ReleaseAddressRequest& request, const ReleaseAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ReleaseAddressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ReleaseAddressAsyncHelper, Aws::Client::RejectedAsyncCall<ReleaseAddressOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ReleaseAddressAsync(ReleaseAddressRequest&& request, const ReleaseAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ReleaseAddressAsyncHelper, Aws::Client::RejectedAsyncCall<ReleaseAddressOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ReleaseAddressAsyncHelper(const ReleaseAddressRequest& request, const ReleaseAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5647,12 +7427,22 @@ ReleaseHostsOutcome EC2Client::ReleaseHosts(const ReleaseHostsRequest& request)
 
 ReleaseHostsOutcomeCallable EC2Client::ReleaseHostsCallable(const ReleaseHostsRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ReleaseHosts, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ReleaseHosts, Aws::Client::RejectedCallOutcome<ReleaseHostsOutcome>(), this, request);
+}
+
+ReleaseHostsOutcomeCallable EC2Client::ReleaseHostsCallable(ReleaseHostsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ReleaseHosts, Aws::Client::RejectedCallOutcome<ReleaseHostsOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ReleaseHostsAsync(const ReleaseHostsRequest& request, const ReleaseHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ReleaseHostsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ReleaseHostsAsyncHelper, Aws::Client::RejectedAsyncCall<ReleaseHostsOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ReleaseHostsAsync(ReleaseHostsRequest&& request, const ReleaseHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ReleaseHostsAsyncHelper, Aws::Client::RejectedAsyncCall<ReleaseHostsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ReleaseHostsAsyncHelper(const ReleaseHostsRequest& request, const ReleaseHostsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5677,12 +7467,22 @@ ReplaceNetworkAclAssociationOutcome EC2Client::ReplaceNetworkAclAssociation(cons
 
 ReplaceNetworkAclAssociationOutcomeCallable EC2Client::ReplaceNetworkAclAssociationCallable(const ReplaceNetworkAclAssociationRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ReplaceNetworkAclAssociation, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ReplaceNetworkAclAssociation, Aws::Client::RejectedCallOutcome<ReplaceNetworkAclAssociationOutcome>(), this, request);
+}
+
+ReplaceNetworkAclAssociationOutcomeCallable EC2Client::ReplaceNetworkAclAssociationCallable(ReplaceNetworkAclAssociationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ReplaceNetworkAclAssociation, Aws::Client::RejectedCallOutcome<ReplaceNetworkAclAssociationOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ReplaceNetworkAclAssociationAsync(const ReplaceNetworkAclAssociationRequest& request, const ReplaceNetworkAclAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ReplaceNetworkAclAssociationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ReplaceNetworkAclAssociationAsyncHelper, Aws::Client::RejectedAsyncCall<ReplaceNetworkAclAssociationOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ReplaceNetworkAclAssociationAsync(ReplaceNetworkAclAssociationRequest&& request, const ReplaceNetworkAclAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ReplaceNetworkAclAssociationAsyncHelper, Aws::Client::RejectedAsyncCall<ReplaceNetworkAclAssociationOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ReplaceNetworkAclAssociationAsyncHelper(const ReplaceNetworkAclAssociationRequest& request, const ReplaceNetworkAclAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5707,12 +7507,22 @@ ReplaceNetworkAclEntryOutcome EC2Client::ReplaceNetworkAclEntry(const ReplaceNet
 
 ReplaceNetworkAclEntryOutcomeCallable EC2Client::ReplaceNetworkAclEntryCallable(const ReplaceNetworkAclEntryRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ReplaceNetworkAclEntry, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ReplaceNetworkAclEntry, Aws::Client::RejectedCallOutcome<ReplaceNetworkAclEntryOutcome>(), this, request);
+}
+
+ReplaceNetworkAclEntryOutcomeCallable EC2Client::ReplaceNetworkAclEntryCallable(ReplaceNetworkAclEntryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ReplaceNetworkAclEntry, Aws::Client::RejectedCallOutcome<ReplaceNetworkAclEntryOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ReplaceNetworkAclEntryAsync(const ReplaceNetworkAclEntryRequest& request, const ReplaceNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ReplaceNetworkAclEntryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ReplaceNetworkAclEntryAsyncHelper, Aws::Client::RejectedAsyncCall<ReplaceNetworkAclEntryOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ReplaceNetworkAclEntryAsync(ReplaceNetworkAclEntryRequest&& request, const ReplaceNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ReplaceNetworkAclEntryAsyncHelper, Aws::Client::RejectedAsyncCall<ReplaceNetworkAclEntryOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ReplaceNetworkAclEntryAsyncHelper(const ReplaceNetworkAclEntryRequest& request, const ReplaceNetworkAclEntryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5737,12 +7547,22 @@ ReplaceRouteOutcome EC2Client::ReplaceRoute(const ReplaceRouteRequest& request)
 
 ReplaceRouteOutcomeCallable EC2Client::ReplaceRouteCallable(const ReplaceRouteRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ReplaceRoute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ReplaceRoute, Aws::Client::RejectedCallOutcome<ReplaceRouteOutcome>(), this, request);
+}
+
+ReplaceRouteOutcomeCallable EC2Client::ReplaceRouteCallable(ReplaceRouteRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ReplaceRoute, Aws::Client::RejectedCallOutcome<ReplaceRouteOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ReplaceRouteAsync(const ReplaceRouteRequest& request, const ReplaceRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ReplaceRouteAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ReplaceRouteAsyncHelper, Aws::Client::RejectedAsyncCall<ReplaceRouteOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ReplaceRouteAsync(ReplaceRouteRequest&& request, const ReplaceRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ReplaceRouteAsyncHelper, Aws::Client::RejectedAsyncCall<ReplaceRouteOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ReplaceRouteAsyncHelper(const ReplaceRouteRequest& request, const ReplaceRouteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5767,12 +7587,22 @@ ReplaceRouteTableAssociationOutcome EC2Client::ReplaceRouteTableAssociation(cons
 
 ReplaceRouteTableAssociationOutcomeCallable EC2Client::ReplaceRouteTableAssociationCallable(const ReplaceRouteTableAssociationRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ReplaceRouteTableAssociation, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ReplaceRouteTableAssociation, Aws::Client::RejectedCallOutcome<ReplaceRouteTableAssociationOutcome>(), this, request);
+}
+
+ReplaceRouteTableAssociationOutcomeCallable EC2Client::ReplaceRouteTableAssociationCallable(ReplaceRouteTableAssociationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ReplaceRouteTableAssociation, Aws::Client::RejectedCallOutcome<ReplaceRouteTableAssociationOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ReplaceRouteTableAssociationAsync(const ReplaceRouteTableAssociationRequest& request, const ReplaceRouteTableAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ReplaceRouteTableAssociationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ReplaceRouteTableAssociationAsyncHelper, Aws::Client::RejectedAsyncCall<ReplaceRouteTableAssociationOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ReplaceRouteTableAssociationAsync(ReplaceRouteTableAssociationRequest&& request, const ReplaceRouteTableAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ReplaceRouteTableAssociationAsyncHelper, Aws::Client::RejectedAsyncCall<ReplaceRouteTableAssociationOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ReplaceRouteTableAssociationAsyncHelper(const ReplaceRouteTableAssociationRequest& request, const ReplaceRouteTableAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5797,12 +7627,22 @@ ReportInstanceStatusOutcome EC2Client::ReportInstanceStatus(const ReportInstance
 
 ReportInstanceStatusOutcomeCallable EC2Client::ReportInstanceStatusCallable(const ReportInstanceStatusRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ReportInstanceStatus, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ReportInstanceStatus, Aws::Client::RejectedCallOutcome<ReportInstanceStatusOutcome>(), this, request);
+}
+
+ReportInstanceStatusOutcomeCallable EC2Client::ReportInstanceStatusCallable(ReportInstanceStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ReportInstanceStatus, Aws::Client::RejectedCallOutcome<ReportInstanceStatusOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ReportInstanceStatusAsync(const ReportInstanceStatusRequest& request, const ReportInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ReportInstanceStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ReportInstanceStatusAsyncHelper, Aws::Client::RejectedAsyncCall<ReportInstanceStatusOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ReportInstanceStatusAsync(ReportInstanceStatusRequest&& request, const ReportInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ReportInstanceStatusAsyncHelper, Aws::Client::RejectedAsyncCall<ReportInstanceStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ReportInstanceStatusAsyncHelper(const ReportInstanceStatusRequest& request, const ReportInstanceStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5827,12 +7667,22 @@ RequestSpotFleetOutcome EC2Client::RequestSpotFleet(const RequestSpotFleetReques
 
 RequestSpotFleetOutcomeCallable EC2Client::RequestSpotFleetCallable(const RequestSpotFleetRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::RequestSpotFleet, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::RequestSpotFleet, Aws::Client::RejectedCallOutcome<RequestSpotFleetOutcome>(), this, request);
+}
+
+RequestSpotFleetOutcomeCallable EC2Client::RequestSpotFleetCallable(RequestSpotFleetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::RequestSpotFleet, Aws::Client::RejectedCallOutcome<RequestSpotFleetOutcome>(), this, std::move(request));
 }
 
 void EC2Client::RequestSpotFleetAsync(const RequestSpotFleetRequest& request, const RequestSpotFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::RequestSpotFleetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::RequestSpotFleetAsyncHelper, Aws::Client::RejectedAsyncCall<RequestSpotFleetOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::RequestSpotFleetAsync(RequestSpotFleetRequest&& request, const RequestSpotFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::RequestSpotFleetAsyncHelper, Aws::Client::RejectedAsyncCall<RequestSpotFleetOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::RequestSpotFleetAsyncHelper(const RequestSpotFleetRequest& request, const RequestSpotFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5857,12 +7707,22 @@ RequestSpotInstancesOutcome EC2Client::RequestSpotInstances(const RequestSpotIns
 
 RequestSpotInstancesOutcomeCallable EC2Client::RequestSpotInstancesCallable(const RequestSpotInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::RequestSpotInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::RequestSpotInstances, Aws::Client::RejectedCallOutcome<RequestSpotInstancesOutcome>(), this, request);
+}
+
+RequestSpotInstancesOutcomeCallable EC2Client::RequestSpotInstancesCallable(RequestSpotInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::RequestSpotInstances, Aws::Client::RejectedCallOutcome<RequestSpotInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::RequestSpotInstancesAsync(const RequestSpotInstancesRequest& request, const RequestSpotInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::RequestSpotInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::RequestSpotInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<RequestSpotInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::RequestSpotInstancesAsync(RequestSpotInstancesRequest&& request, const RequestSpotInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::RequestSpotInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<RequestSpotInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::RequestSpotInstancesAsyncHelper(const RequestSpotInstancesRequest& request, const RequestSpotInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5887,12 +7747,22 @@ ResetImageAttributeOutcome EC2Client::ResetImageAttribute(const ResetImageAttrib
 
 ResetImageAttributeOutcomeCallable EC2Client::ResetImageAttributeCallable(const ResetImageAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ResetImageAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ResetImageAttribute, Aws::Client::RejectedCallOutcome<ResetImageAttributeOutcome>(), this, request);
+}
+
+ResetImageAttributeOutcomeCallable EC2Client::ResetImageAttributeCallable(ResetImageAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ResetImageAttribute, Aws::Client::RejectedCallOutcome<ResetImageAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ResetImageAttributeAsync(const ResetImageAttributeRequest& request, const ResetImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ResetImageAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ResetImageAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ResetImageAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ResetImageAttributeAsync(ResetImageAttributeRequest&& request, const ResetImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ResetImageAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ResetImageAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ResetImageAttributeAsyncHelper(const ResetImageAttributeRequest& request, const ResetImageAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5917,12 +7787,22 @@ ResetInstanceAttributeOutcome EC2Client::ResetInstanceAttribute(const ResetInsta
 
 ResetInstanceAttributeOutcomeCallable EC2Client::ResetInstanceAttributeCallable(const ResetInstanceAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ResetInstanceAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ResetInstanceAttribute, Aws::Client::RejectedCallOutcome<ResetInstanceAttributeOutcome>(), this, request);
+}
+
+ResetInstanceAttributeOutcomeCallable EC2Client::ResetInstanceAttributeCallable(ResetInstanceAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ResetInstanceAttribute, Aws::Client::RejectedCallOutcome<ResetInstanceAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ResetInstanceAttributeAsync(const ResetInstanceAttributeRequest& request, const ResetInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ResetInstanceAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ResetInstanceAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ResetInstanceAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ResetInstanceAttributeAsync(ResetInstanceAttributeRequest&& request, const ResetInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ResetInstanceAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ResetInstanceAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ResetInstanceAttributeAsyncHelper(const ResetInstanceAttributeRequest& request, const ResetInstanceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5947,12 +7827,22 @@ ResetNetworkInterfaceAttributeOutcome EC2Client::ResetNetworkInterfaceAttribute(
 
 ResetNetworkInterfaceAttributeOutcomeCallable EC2Client::ResetNetworkInterfaceAttributeCallable(const ResetNetworkInterfaceAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ResetNetworkInterfaceAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ResetNetworkInterfaceAttribute, Aws::Client::RejectedCallOutcome<ResetNetworkInterfaceAttributeOutcome>(), this, request);
+}
+
+ResetNetworkInterfaceAttributeOutcomeCallable EC2Client::ResetNetworkInterfaceAttributeCallable(ResetNetworkInterfaceAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ResetNetworkInterfaceAttribute, Aws::Client::RejectedCallOutcome<ResetNetworkInterfaceAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ResetNetworkInterfaceAttributeAsync(const ResetNetworkInterfaceAttributeRequest& request, const ResetNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ResetNetworkInterfaceAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ResetNetworkInterfaceAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ResetNetworkInterfaceAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ResetNetworkInterfaceAttributeAsync(ResetNetworkInterfaceAttributeRequest&& request, const ResetNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ResetNetworkInterfaceAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ResetNetworkInterfaceAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ResetNetworkInterfaceAttributeAsyncHelper(const ResetNetworkInterfaceAttributeRequest& request, const ResetNetworkInterfaceAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -5977,12 +7867,22 @@ ResetSnapshotAttributeOutcome EC2Client::ResetSnapshotAttribute(const ResetSnaps
 
 ResetSnapshotAttributeOutcomeCallable EC2Client::ResetSnapshotAttributeCallable(const ResetSnapshotAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::ResetSnapshotAttribute, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::ResetSnapshotAttribute, Aws::Client::RejectedCallOutcome<ResetSnapshotAttributeOutcome>(), this, request);
+}
+
+ResetSnapshotAttributeOutcomeCallable EC2Client::ResetSnapshotAttributeCallable(ResetSnapshotAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::ResetSnapshotAttribute, Aws::Client::RejectedCallOutcome<ResetSnapshotAttributeOutcome>(), this, std::move(request));
 }
 
 void EC2Client::ResetSnapshotAttributeAsync(const ResetSnapshotAttributeRequest& request, const ResetSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::ResetSnapshotAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::ResetSnapshotAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ResetSnapshotAttributeOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::ResetSnapshotAttributeAsync(ResetSnapshotAttributeRequest&& request, const ResetSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::ResetSnapshotAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ResetSnapshotAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::ResetSnapshotAttributeAsyncHelper(const ResetSnapshotAttributeRequest& request, const ResetSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6007,12 +7907,22 @@ RestoreAddressToClassicOutcome EC2Client::RestoreAddressToClassic(const RestoreA
 
 RestoreAddressToClassicOutcomeCallable EC2Client::RestoreAddressToClassicCallable(const RestoreAddressToClassicRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::RestoreAddressToClassic, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::RestoreAddressToClassic, Aws::Client::RejectedCallOutcome<RestoreAddressToClassicOutcome>(), this, request);
+}
+
+RestoreAddressToClassicOutcomeCallable EC2Client::RestoreAddressToClassicCallable(RestoreAddressToClassicRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::RestoreAddressToClassic, Aws::Client::RejectedCallOutcome<RestoreAddressToClassicOutcome>(), this, std::move(request));
 }
 
 void EC2Client::RestoreAddressToClassicAsync(const RestoreAddressToClassicRequest& request, const RestoreAddressToClassicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::RestoreAddressToClassicAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::RestoreAddressToClassicAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreAddressToClassicOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::RestoreAddressToClassicAsync(RestoreAddressToClassicRequest&& request, const RestoreAddressToClassicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::RestoreAddressToClassicAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreAddressToClassicOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::RestoreAddressToClassicAsyncHelper(const RestoreAddressToClassicRequest& request, const RestoreAddressToClassicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6037,12 +7947,22 @@ RevokeSecurityGroupEgressOutcome EC2Client::RevokeSecurityGroupEgress(const Revo
 
 RevokeSecurityGroupEgressOutcomeCallable EC2Client::RevokeSecurityGroupEgressCallable(const RevokeSecurityGroupEgressRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::RevokeSecurityGroupEgress, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::RevokeSecurityGroupEgress, Aws::Client::RejectedCallOutcome<RevokeSecurityGroupEgressOutcome>(), this, request);
+}
+
+RevokeSecurityGroupEgressOutcomeCallable EC2Client::RevokeSecurityGroupEgressCallable(RevokeSecurityGroupEgressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::RevokeSecurityGroupEgress, Aws::Client::RejectedCallOutcome<RevokeSecurityGroupEgressOutcome>(), this, std::move(request));
 }
 
 void EC2Client::RevokeSecurityGroupEgressAsync(const RevokeSecurityGroupEgressRequest& request, const RevokeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::RevokeSecurityGroupEgressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::RevokeSecurityGroupEgressAsyncHelper, Aws::Client::RejectedAsyncCall<RevokeSecurityGroupEgressOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::RevokeSecurityGroupEgressAsync(RevokeSecurityGroupEgressRequest&& request, const RevokeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::RevokeSecurityGroupEgressAsyncHelper, Aws::Client::RejectedAsyncCall<RevokeSecurityGroupEgressOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::RevokeSecurityGroupEgressAsyncHelper(const RevokeSecurityGroupEgressRequest& request, const RevokeSecurityGroupEgressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6067,12 +7987,22 @@ RevokeSecurityGroupIngressOutcome EC2Client::RevokeSecurityGroupIngress(const Re
 
 RevokeSecurityGroupIngressOutcomeCallable EC2Client::RevokeSecurityGroupIngressCallable(const RevokeSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::RevokeSecurityGroupIngress, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::RevokeSecurityGroupIngress, Aws::Client::RejectedCallOutcome<RevokeSecurityGroupIngressOutcome>(), this, request);
+}
+
+RevokeSecurityGroupIngressOutcomeCallable EC2Client::RevokeSecurityGroupIngressCallable(RevokeSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::RevokeSecurityGroupIngress, Aws::Client::RejectedCallOutcome<RevokeSecurityGroupIngressOutcome>(), this, std::move(request));
 }
 
 void EC2Client::RevokeSecurityGroupIngressAsync(const RevokeSecurityGroupIngressRequest& request, const RevokeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::RevokeSecurityGroupIngressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::RevokeSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<RevokeSecurityGroupIngressOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::RevokeSecurityGroupIngressAsync(RevokeSecurityGroupIngressRequest&& request, const RevokeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::RevokeSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<RevokeSecurityGroupIngressOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::RevokeSecurityGroupIngressAsyncHelper(const RevokeSecurityGroupIngressRequest& request, const RevokeSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6097,12 +8027,22 @@ RunInstancesOutcome EC2Client::RunInstances(const RunInstancesRequest& request)
 
 RunInstancesOutcomeCallable EC2Client::RunInstancesCallable(const RunInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::RunInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::RunInstances, Aws::Client::RejectedCallOutcome<RunInstancesOutcome>(), this, request);
+}
+
+RunInstancesOutcomeCallable EC2Client::RunInstancesCallable(RunInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::RunInstances, Aws::Client::RejectedCallOutcome<RunInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::RunInstancesAsync(const RunInstancesRequest& request, const RunInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::RunInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::RunInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<RunInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::RunInstancesAsync(RunInstancesRequest&& request, const RunInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::RunInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<RunInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::RunInstancesAsyncHelper(const RunInstancesRequest& request, const RunInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6127,12 +8067,22 @@ RunScheduledInstancesOutcome EC2Client::RunScheduledInstances(const RunScheduled
 
 RunScheduledInstancesOutcomeCallable EC2Client::RunScheduledInstancesCallable(const RunScheduledInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::RunScheduledInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::RunScheduledInstances, Aws::Client::RejectedCallOutcome<RunScheduledInstancesOutcome>(), this, request);
+}
+
+RunScheduledInstancesOutcomeCallable EC2Client::RunScheduledInstancesCallable(RunScheduledInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::RunScheduledInstances, Aws::Client::RejectedCallOutcome<RunScheduledInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::RunScheduledInstancesAsync(const RunScheduledInstancesRequest& request, const RunScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::RunScheduledInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::RunScheduledInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<RunScheduledInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::RunScheduledInstancesAsync(RunScheduledInstancesRequest&& request, const RunScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::RunScheduledInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<RunScheduledInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::RunScheduledInstancesAsyncHelper(const RunScheduledInstancesRequest& request, const RunScheduledInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6157,12 +8107,22 @@ StartInstancesOutcome EC2Client::StartInstances(const StartInstancesRequest& req
 
 StartInstancesOutcomeCallable EC2Client::StartInstancesCallable(const StartInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::StartInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::StartInstances, Aws::Client::RejectedCallOutcome<StartInstancesOutcome>(), this, request);
+}
+
+StartInstancesOutcomeCallable EC2Client::StartInstancesCallable(StartInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::StartInstances, Aws::Client::RejectedCallOutcome<StartInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::StartInstancesAsync(const StartInstancesRequest& request, const StartInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::StartInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::StartInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<StartInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::StartInstancesAsync(StartInstancesRequest&& request, const StartInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::StartInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<StartInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::StartInstancesAsyncHelper(const StartInstancesRequest& request, const StartInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6187,12 +8147,22 @@ StopInstancesOutcome EC2Client::StopInstances(const StopInstancesRequest& reques
 
 StopInstancesOutcomeCallable EC2Client::StopInstancesCallable(const StopInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::StopInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::StopInstances, Aws::Client::RejectedCallOutcome<StopInstancesOutcome>(), this, request);
+}
+
+StopInstancesOutcomeCallable EC2Client::StopInstancesCallable(StopInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::StopInstances, Aws::Client::RejectedCallOutcome<StopInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::StopInstancesAsync(const StopInstancesRequest& request, const StopInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::StopInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::StopInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<StopInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::StopInstancesAsync(StopInstancesRequest&& request, const StopInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::StopInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<StopInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::StopInstancesAsyncHelper(const StopInstancesRequest& request, const StopInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6217,12 +8187,22 @@ TerminateInstancesOutcome EC2Client::TerminateInstances(const TerminateInstances
 
 TerminateInstancesOutcomeCallable EC2Client::TerminateInstancesCallable(const TerminateInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::TerminateInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::TerminateInstances, Aws::Client::RejectedCallOutcome<TerminateInstancesOutcome>(), this, request);
+}
+
+TerminateInstancesOutcomeCallable EC2Client::TerminateInstancesCallable(TerminateInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::TerminateInstances, Aws::Client::RejectedCallOutcome<TerminateInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::TerminateInstancesAsync(const TerminateInstancesRequest& request, const TerminateInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::TerminateInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::TerminateInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<TerminateInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::TerminateInstancesAsync(TerminateInstancesRequest&& request, const TerminateInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::TerminateInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<TerminateInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::TerminateInstancesAsyncHelper(const TerminateInstancesRequest& request, const TerminateInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6247,12 +8227,22 @@ UnassignPrivateIpAddressesOutcome EC2Client::UnassignPrivateIpAddresses(const Un
 
 UnassignPrivateIpAddressesOutcomeCallable EC2Client::UnassignPrivateIpAddressesCallable(const UnassignPrivateIpAddressesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::UnassignPrivateIpAddresses, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::UnassignPrivateIpAddresses, Aws::Client::RejectedCallOutcome<UnassignPrivateIpAddressesOutcome>(), this, request);
+}
+
+UnassignPrivateIpAddressesOutcomeCallable EC2Client::UnassignPrivateIpAddressesCallable(UnassignPrivateIpAddressesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::UnassignPrivateIpAddresses, Aws::Client::RejectedCallOutcome<UnassignPrivateIpAddressesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::UnassignPrivateIpAddressesAsync(const UnassignPrivateIpAddressesRequest& request, const UnassignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::UnassignPrivateIpAddressesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::UnassignPrivateIpAddressesAsyncHelper, Aws::Client::RejectedAsyncCall<UnassignPrivateIpAddressesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::UnassignPrivateIpAddressesAsync(UnassignPrivateIpAddressesRequest&& request, const UnassignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::UnassignPrivateIpAddressesAsyncHelper, Aws::Client::RejectedAsyncCall<UnassignPrivateIpAddressesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::UnassignPrivateIpAddressesAsyncHelper(const UnassignPrivateIpAddressesRequest& request, const UnassignPrivateIpAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -6277,12 +8267,22 @@ UnmonitorInstancesOutcome EC2Client::UnmonitorInstances(const UnmonitorInstances
 
 UnmonitorInstancesOutcomeCallable EC2Client::UnmonitorInstancesCallable(const UnmonitorInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EC2Client::UnmonitorInstances, this, request);
+  return m_executor->SubmitWithFuture(&EC2Client::UnmonitorInstances, Aws::Client::RejectedCallOutcome<UnmonitorInstancesOutcome>(), this, request);
+}
+
+UnmonitorInstancesOutcomeCallable EC2Client::UnmonitorInstancesCallable(UnmonitorInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EC2Client::UnmonitorInstances, Aws::Client::RejectedCallOutcome<UnmonitorInstancesOutcome>(), this, std::move(request));
 }
 
 void EC2Client::UnmonitorInstancesAsync(const UnmonitorInstancesRequest& request, const UnmonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EC2Client::UnmonitorInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EC2Client::UnmonitorInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<UnmonitorInstancesOutcome>(), this, request, handler, context);
+}
+
+void EC2Client::UnmonitorInstancesAsync(UnmonitorInstancesRequest&& request, const UnmonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EC2Client::UnmonitorInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<UnmonitorInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EC2Client::UnmonitorInstancesAsyncHelper(const UnmonitorInstancesRequest& request, const UnmonitorInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -38,6 +38,26 @@
 #include <aws/ecr/model/UploadLayerPartResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/ecr/model/BatchCheckLayerAvailabilityRequest.h>
+#include <aws/ecr/model/BatchDeleteImageRequest.h>
+#include <aws/ecr/model/BatchGetImageRequest.h>
+#include <aws/ecr/model/CompleteLayerUploadRequest.h>
+#include <aws/ecr/model/CreateRepositoryRequest.h>
+#include <aws/ecr/model/DeleteRepositoryRequest.h>
+#include <aws/ecr/model/DeleteRepositoryPolicyRequest.h>
+#include <aws/ecr/model/DescribeRepositoriesRequest.h>
+#include <aws/ecr/model/GetAuthorizationTokenRequest.h>
+#include <aws/ecr/model/GetDownloadUrlForLayerRequest.h>
+#include <aws/ecr/model/GetRepositoryPolicyRequest.h>
+#include <aws/ecr/model/InitiateLayerUploadRequest.h>
+#include <aws/ecr/model/ListImagesRequest.h>
+#include <aws/ecr/model/PutImageRequest.h>
+#include <aws/ecr/model/SetRepositoryPolicyRequest.h>
+#include <aws/ecr/model/UploadLayerPartRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -205,6 +225,11 @@ namespace Model
          */
         virtual Model::BatchCheckLayerAvailabilityOutcomeCallable BatchCheckLayerAvailabilityCallable(const Model::BatchCheckLayerAvailabilityRequest& request) const;
 
+        /**
+         * Same as BatchCheckLayerAvailabilityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BatchCheckLayerAvailabilityOutcomeCallable BatchCheckLayerAvailabilityCallable(Model::BatchCheckLayerAvailabilityRequest&& request) const;
+
         /**
          * <p>Check the availability of multiple image layers in a specified registry and
          * repository.</p> <note> <p>This operation is used by the Amazon ECR proxy, and it
@@ -215,6 +240,11 @@ namespace Model
          */
         virtual void BatchCheckLayerAvailabilityAsync(const Model::BatchCheckLayerAvailabilityRequest& request, const BatchCheckLayerAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchCheckLayerAvailabilityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BatchCheckLayerAvailabilityAsync(Model::BatchCheckLayerAvailabilityRequest&& request, const BatchCheckLayerAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a list of specified images within a specified repository. Images are
          * specified with either <code>imageTag</code> or <code>imageDigest</code>.</p>
@@ -229,6 +259,11 @@ namespace Model
          */
         virtual Model::BatchDeleteImageOutcomeCallable BatchDeleteImageCallable(const Model::BatchDeleteImageRequest& request) const;
 
+        /**
+         * Same as BatchDeleteImageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BatchDeleteImageOutcomeCallable BatchDeleteImageCallable(Model::BatchDeleteImageRequest&& request) const;
+
         /**
          * <p>Deletes a list of specified images within a specified repository. Images are
          * specified with either <code>imageTag</code> or <code>imageDigest</code>.</p>
@@ -237,6 +272,11 @@ namespace Model
          */
         virtual void BatchDeleteImageAsync(const Model::BatchDeleteImageRequest& request, const BatchDeleteImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchDeleteImageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BatchDeleteImageAsync(Model::BatchDeleteImageRequest&& request, const BatchDeleteImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets detailed information for specified images within a specified repository.
          * Images are specified with either <code>imageTag</code> or
@@ -253,6 +293,11 @@ namespace Model
          */
         virtual Model::BatchGetImageOutcomeCallable BatchGetImageCallable(const Model::BatchGetImageRequest& request) const;
 
+        /**
+         * Same as BatchGetImageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BatchGetImageOutcomeCallable BatchGetImageCallable(Model::BatchGetImageRequest&& request) const;
+
         /**
          * <p>Gets detailed information for specified images within a specified repository.
          * Images are specified with either <code>imageTag</code> or
@@ -262,6 +307,11 @@ namespace Model
          */
         virtual void BatchGetImageAsync(const Model::BatchGetImageRequest& request, const BatchGetImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchGetImageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BatchGetImageAsync(Model::BatchGetImageRequest&& request, const BatchGetImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inform Amazon ECR that the image layer upload for a specified registry,
          * repository name, and upload ID, has completed. You can optionally provide a
@@ -284,6 +334,11 @@ namespace Model
          */
         virtual Model::CompleteLayerUploadOutcomeCallable CompleteLayerUploadCallable(const Model::CompleteLayerUploadRequest& request) const;
 
+        /**
+         * Same as CompleteLayerUploadCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CompleteLayerUploadOutcomeCallable CompleteLayerUploadCallable(Model::CompleteLayerUploadRequest&& request) const;
+
         /**
          * <p>Inform Amazon ECR that the image layer upload for a specified registry,
          * repository name, and upload ID, has completed. You can optionally provide a
@@ -296,6 +351,11 @@ namespace Model
          */
         virtual void CompleteLayerUploadAsync(const Model::CompleteLayerUploadRequest& request, const CompleteLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CompleteLayerUploadAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CompleteLayerUploadAsync(Model::CompleteLayerUploadRequest&& request, const CompleteLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an image repository.</p>
          */
@@ -308,6 +368,11 @@ namespace Model
          */
         virtual Model::CreateRepositoryOutcomeCallable CreateRepositoryCallable(const Model::CreateRepositoryRequest& request) const;
 
+        /**
+         * Same as CreateRepositoryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateRepositoryOutcomeCallable CreateRepositoryCallable(Model::CreateRepositoryRequest&& request) const;
+
         /**
          * <p>Creates an image repository.</p>
          *
@@ -315,6 +380,11 @@ namespace Model
          */
         virtual void CreateRepositoryAsync(const Model::CreateRepositoryRequest& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRepositoryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateRepositoryAsync(Model::CreateRepositoryRequest&& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an existing image repository. If a repository contains images, you
          * must use the <code>force</code> option to delete it.</p>
@@ -329,6 +399,11 @@ namespace Model
          */
         virtual Model::DeleteRepositoryOutcomeCallable DeleteRepositoryCallable(const Model::DeleteRepositoryRequest& request) const;
 
+        /**
+         * Same as DeleteRepositoryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteRepositoryOutcomeCallable DeleteRepositoryCallable(Model::DeleteRepositoryRequest&& request) const;
+
         /**
          * <p>Deletes an existing image repository. If a repository contains images, you
          * must use the <code>force</code> option to delete it.</p>
@@ -337,6 +412,11 @@ namespace Model
          */
         virtual void DeleteRepositoryAsync(const Model::DeleteRepositoryRequest& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRepositoryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteRepositoryAsync(Model::DeleteRepositoryRequest&& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the repository policy from a specified repository.</p>
          */
@@ -349,6 +429,11 @@ namespace Model
          */
         virtual Model::DeleteRepositoryPolicyOutcomeCallable DeleteRepositoryPolicyCallable(const Model::DeleteRepositoryPolicyRequest& request) const;
 
+        /**
+         * Same as DeleteRepositoryPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteRepositoryPolicyOutcomeCallable DeleteRepositoryPolicyCallable(Model::DeleteRepositoryPolicyRequest&& request) const;
+
         /**
          * <p>Deletes the repository policy from a specified repository.</p>
          *
@@ -356,6 +441,11 @@ namespace Model
          */
         virtual void DeleteRepositoryPolicyAsync(const Model::DeleteRepositoryPolicyRequest& request, const DeleteRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRepositoryPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteRepositoryPolicyAsync(Model::DeleteRepositoryPolicyRequest&& request, const DeleteRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes image repositories in a registry.</p>
          */
@@ -368,6 +458,11 @@ namespace Model
          */
         virtual Model::DescribeRepositoriesOutcomeCallable DescribeRepositoriesCallable(const Model::DescribeRepositoriesRequest& request) const;
 
+        /**
+         * Same as DescribeRepositoriesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeRepositoriesOutcomeCallable DescribeRepositoriesCallable(Model::DescribeRepositoriesRequest&& request) const;
+
         /**
          * <p>Describes image repositories in a registry.</p>
          *
@@ -375,6 +470,11 @@ namespace Model
          */
         virtual void DescribeRepositoriesAsync(const Model::DescribeRepositoriesRequest& request, const DescribeRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRepositoriesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeRepositoriesAsync(Model::DescribeRepositoriesRequest&& request, const DescribeRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a token that is valid for a specified registry for 12 hours. This
          * command allows you to use the <code>docker</code> CLI to push and pull images
@@ -401,6 +501,11 @@ namespace Model
          */
         virtual Model::GetAuthorizationTokenOutcomeCallable GetAuthorizationTokenCallable(const Model::GetAuthorizationTokenRequest& request) const;
 
+        /**
+         * Same as GetAuthorizationTokenCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetAuthorizationTokenOutcomeCallable GetAuthorizationTokenCallable(Model::GetAuthorizationTokenRequest&& request) const;
+
         /**
          * <p>Retrieves a token that is valid for a specified registry for 12 hours. This
          * command allows you to use the <code>docker</code> CLI to push and pull images
@@ -415,6 +520,11 @@ namespace Model
          */
         virtual void GetAuthorizationTokenAsync(const Model::GetAuthorizationTokenRequest& request, const GetAuthorizationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAuthorizationTokenAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetAuthorizationTokenAsync(Model::GetAuthorizationTokenRequest&& request, const GetAuthorizationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the pre-signed Amazon S3 download URL corresponding to an image
          * layer. You can only get URLs for image layers that are referenced in an
@@ -435,6 +545,11 @@ namespace Model
          */
         virtual Model::GetDownloadUrlForLayerOutcomeCallable GetDownloadUrlForLayerCallable(const Model::GetDownloadUrlForLayerRequest& request) const;
 
+        /**
+         * Same as GetDownloadUrlForLayerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDownloadUrlForLayerOutcomeCallable GetDownloadUrlForLayerCallable(Model::GetDownloadUrlForLayerRequest&& request) const;
+
         /**
          * <p>Retrieves the pre-signed Amazon S3 download URL corresponding to an image
          * layer. You can only get URLs for image layers that are referenced in an
@@ -446,6 +561,11 @@ namespace Model
          */
         virtual void GetDownloadUrlForLayerAsync(const Model::GetDownloadUrlForLayerRequest& request, const GetDownloadUrlForLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDownloadUrlForLayerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDownloadUrlForLayerAsync(Model::GetDownloadUrlForLayerRequest&& request, const GetDownloadUrlForLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the repository policy for a specified repository.</p>
          */
@@ -458,6 +578,11 @@ namespace Model
          */
         virtual Model::GetRepositoryPolicyOutcomeCallable GetRepositoryPolicyCallable(const Model::GetRepositoryPolicyRequest& request) const;
 
+        /**
+         * Same as GetRepositoryPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetRepositoryPolicyOutcomeCallable GetRepositoryPolicyCallable(Model::GetRepositoryPolicyRequest&& request) const;
+
         /**
          * <p>Retrieves the repository policy for a specified repository.</p>
          *
@@ -465,6 +590,11 @@ namespace Model
          */
         virtual void GetRepositoryPolicyAsync(const Model::GetRepositoryPolicyRequest& request, const GetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRepositoryPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetRepositoryPolicyAsync(Model::GetRepositoryPolicyRequest&& request, const GetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Notify Amazon ECR that you intend to upload an image layer. </p> <note>
          * <p>This operation is used by the Amazon ECR proxy, and it is not intended for
@@ -483,6 +613,11 @@ namespace Model
          */
         virtual Model::InitiateLayerUploadOutcomeCallable InitiateLayerUploadCallable(const Model::InitiateLayerUploadRequest& request) const;
 
+        /**
+         * Same as InitiateLayerUploadCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::InitiateLayerUploadOutcomeCallable InitiateLayerUploadCallable(Model::InitiateLayerUploadRequest&& request) const;
+
         /**
          * <p>Notify Amazon ECR that you intend to upload an image layer. </p> <note>
          * <p>This operation is used by the Amazon ECR proxy, and it is not intended for
@@ -493,6 +628,11 @@ namespace Model
          */
         virtual void InitiateLayerUploadAsync(const Model::InitiateLayerUploadRequest& request, const InitiateLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as InitiateLayerUploadAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void InitiateLayerUploadAsync(Model::InitiateLayerUploadRequest&& request, const InitiateLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all the image IDs for a given repository.</p>
          */
@@ -505,6 +645,11 @@ namespace Model
          */
         virtual Model::ListImagesOutcomeCallable ListImagesCallable(const Model::ListImagesRequest& request) const;
 
+        /**
+         * Same as ListImagesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListImagesOutcomeCallable ListImagesCallable(Model::ListImagesRequest&& request) const;
+
         /**
          * <p>Lists all the image IDs for a given repository.</p>
          *
@@ -512,6 +657,11 @@ namespace Model
          */
         virtual void ListImagesAsync(const Model::ListImagesRequest& request, const ListImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListImagesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListImagesAsync(Model::ListImagesRequest&& request, const ListImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates the image manifest associated with an image.</p> <note>
          * <p>This operation is used by the Amazon ECR proxy, and it is not intended for
@@ -530,6 +680,11 @@ namespace Model
          */
         virtual Model::PutImageOutcomeCallable PutImageCallable(const Model::PutImageRequest& request) const;
 
+        /**
+         * Same as PutImageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutImageOutcomeCallable PutImageCallable(Model::PutImageRequest&& request) const;
+
         /**
          * <p>Creates or updates the image manifest associated with an image.</p> <note>
          * <p>This operation is used by the Amazon ECR proxy, and it is not intended for
@@ -540,6 +695,11 @@ namespace Model
          */
         virtual void PutImageAsync(const Model::PutImageRequest& request, const PutImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutImageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutImageAsync(Model::PutImageRequest&& request, const PutImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Applies a repository policy on a specified repository to control access
          * permissions.</p>
@@ -554,6 +714,11 @@ namespace Model
          */
         virtual Model::SetRepositoryPolicyOutcomeCallable SetRepositoryPolicyCallable(const Model::SetRepositoryPolicyRequest& request) const;
 
+        /**
+         * Same as SetRepositoryPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetRepositoryPolicyOutcomeCallable SetRepositoryPolicyCallable(Model::SetRepositoryPolicyRequest&& request) const;
+
         /**
          * <p>Applies a repository policy on a specified repository to control access
          * permissions.</p>
@@ -562,6 +727,11 @@ namespace Model
          */
         virtual void SetRepositoryPolicyAsync(const Model::SetRepositoryPolicyRequest& request, const SetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetRepositoryPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetRepositoryPolicyAsync(Model::SetRepositoryPolicyRequest&& request, const SetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Uploads an image layer part to Amazon ECR.</p> <note> <p>This operation is
          * used by the Amazon ECR proxy, and it is not intended for general use by
@@ -580,6 +750,11 @@ namespace Model
          */
         virtual Model::UploadLayerPartOutcomeCallable UploadLayerPartCallable(const Model::UploadLayerPartRequest& request) const;
 
+        /**
+         * Same as UploadLayerPartCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UploadLayerPartOutcomeCallable UploadLayerPartCallable(Model::UploadLayerPartRequest&& request) const;
+
         /**
          * <p>Uploads an image layer part to Amazon ECR.</p> <note> <p>This operation is
          * used by the Amazon ECR proxy, and it is not intended for general use by
@@ -590,6 +765,50 @@ namespace Model
          */
         virtual void UploadLayerPartAsync(const Model::UploadLayerPartRequest& request, const UploadLayerPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadLayerPartAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UploadLayerPartAsync(Model::UploadLayerPartRequest&& request, const UploadLayerPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchCheckLayerAvailabilityOutcome> BatchCheckLayerAvailabilityAwaitable(const Model::BatchCheckLayerAvailabilityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::BatchCheckLayerAvailability, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchCheckLayerAvailabilityOutcome> BatchCheckLayerAvailabilityAwaitable(Model::BatchCheckLayerAvailabilityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::BatchCheckLayerAvailability, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchDeleteImageOutcome> BatchDeleteImageAwaitable(const Model::BatchDeleteImageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::BatchDeleteImage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchDeleteImageOutcome> BatchDeleteImageAwaitable(Model::BatchDeleteImageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::BatchDeleteImage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetImageOutcome> BatchGetImageAwaitable(const Model::BatchGetImageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::BatchGetImage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchGetImageOutcome> BatchGetImageAwaitable(Model::BatchGetImageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::BatchGetImage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CompleteLayerUploadOutcome> CompleteLayerUploadAwaitable(const Model::CompleteLayerUploadRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::CompleteLayerUpload, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CompleteLayerUploadOutcome> CompleteLayerUploadAwaitable(Model::CompleteLayerUploadRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::CompleteLayerUpload, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRepositoryOutcome> CreateRepositoryAwaitable(const Model::CreateRepositoryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::CreateRepository, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRepositoryOutcome> CreateRepositoryAwaitable(Model::CreateRepositoryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::CreateRepository, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRepositoryOutcome> DeleteRepositoryAwaitable(const Model::DeleteRepositoryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::DeleteRepository, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRepositoryOutcome> DeleteRepositoryAwaitable(Model::DeleteRepositoryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::DeleteRepository, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRepositoryPolicyOutcome> DeleteRepositoryPolicyAwaitable(const Model::DeleteRepositoryPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::DeleteRepositoryPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRepositoryPolicyOutcome> DeleteRepositoryPolicyAwaitable(Model::DeleteRepositoryPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::DeleteRepositoryPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRepositoriesOutcome> DescribeRepositoriesAwaitable(const Model::DescribeRepositoriesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::DescribeRepositories, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRepositoriesOutcome> DescribeRepositoriesAwaitable(Model::DescribeRepositoriesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::DescribeRepositories, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAuthorizationTokenOutcome> GetAuthorizationTokenAwaitable(const Model::GetAuthorizationTokenRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::GetAuthorizationToken, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAuthorizationTokenOutcome> GetAuthorizationTokenAwaitable(Model::GetAuthorizationTokenRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::GetAuthorizationToken, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDownloadUrlForLayerOutcome> GetDownloadUrlForLayerAwaitable(const Model::GetDownloadUrlForLayerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::GetDownloadUrlForLayer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDownloadUrlForLayerOutcome> GetDownloadUrlForLayerAwaitable(Model::GetDownloadUrlForLayerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::GetDownloadUrlForLayer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRepositoryPolicyOutcome> GetRepositoryPolicyAwaitable(const Model::GetRepositoryPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::GetRepositoryPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRepositoryPolicyOutcome> GetRepositoryPolicyAwaitable(Model::GetRepositoryPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::GetRepositoryPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::InitiateLayerUploadOutcome> InitiateLayerUploadAwaitable(const Model::InitiateLayerUploadRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::InitiateLayerUpload, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::InitiateLayerUploadOutcome> InitiateLayerUploadAwaitable(Model::InitiateLayerUploadRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::InitiateLayerUpload, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListImagesOutcome> ListImagesAwaitable(const Model::ListImagesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::ListImages, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListImagesOutcome> ListImagesAwaitable(Model::ListImagesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::ListImages, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutImageOutcome> PutImageAwaitable(const Model::PutImageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::PutImage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutImageOutcome> PutImageAwaitable(Model::PutImageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::PutImage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetRepositoryPolicyOutcome> SetRepositoryPolicyAwaitable(const Model::SetRepositoryPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::SetRepositoryPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetRepositoryPolicyOutcome> SetRepositoryPolicyAwaitable(Model::SetRepositoryPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::SetRepositoryPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadLayerPartOutcome> UploadLayerPartAwaitable(const Model::UploadLayerPartRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::UploadLayerPart, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadLayerPartOutcome> UploadLayerPartAwaitable(Model::UploadLayerPartRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECRClient::UploadLayerPart, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -123,12 +123,22 @@ BatchCheckLayerAvailabilityOutcome ECRClient::BatchCheckLayerAvailability(const
 
 BatchCheckLayerAvailabilityOutcomeCallable ECRClient::BatchCheckLayerAvailabilityCallable(const BatchCheckLayerAvailabilityRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::BatchCheckLayerAvailability, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::BatchCheckLayerAvailability, Aws::Client::RejectedCallOutcome<BatchCheckLayerAvailabilityOutcome>(), this, request);
+}
+
+BatchCheckLayerAvailabilityOutcomeCallable ECRClient::BatchCheckLayerAvailabilityCallable(BatchCheckLayerAvailabilityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::BatchCheckLayerAvailability, Aws::Client::RejectedCallOutcome<BatchCheckLayerAvailabilityOutcome>(), this, std::move(request));
 }
 
 void ECRClient::BatchCheckLayerAvailabilityAsync(const BatchCheckLayerAvailabilityRequest& request, const BatchCheckLayerAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::BatchCheckLayerAvailabilityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::BatchCheckLayerAvailabilityAsyncHelper, Aws::Client::RejectedAsyncCall<BatchCheckLayerAvailabilityOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::BatchCheckLayerAvailabilityAsync(BatchCheckLayerAvailabilityRequest&& request, const BatchCheckLayerAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::BatchCheckLayerAvailabilityAsyncHelper, Aws::Client::RejectedAsyncCall<BatchCheckLayerAvailabilityOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::BatchCheckLayerAvailabilityAsyncHelper(const BatchCheckLayerAvailabilityRequest& request, const BatchCheckLayerAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -154,12 +164,22 @@ BatchDeleteImageOutcome ECRClient::BatchDeleteImage(const BatchDeleteImageReques
 
 BatchDeleteImageOutcomeCallable ECRClient::BatchDeleteImageCallable(const BatchDeleteImageRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::BatchDeleteImage, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::BatchDeleteImage, Aws::Client::RejectedCallOutcome<BatchDeleteImageOutcome>(), this, request);
+}
+
+BatchDeleteImageOutcomeCallable ECRClient::BatchDeleteImageCallable(BatchDeleteImageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::BatchDeleteImage, Aws::Client::RejectedCallOutcome<BatchDeleteImageOutcome>(), this, std::move(request));
 }
 
 void ECRClient::BatchDeleteImageAsync(const BatchDeleteImageRequest& request, const BatchDeleteImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::BatchDeleteImageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::BatchDeleteImageAsyncHelper, Aws::Client::RejectedAsyncCall<BatchDeleteImageOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::BatchDeleteImageAsync(BatchDeleteImageRequest&& request, const BatchDeleteImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::BatchDeleteImageAsyncHelper, Aws::Client::RejectedAsyncCall<BatchDeleteImageOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::BatchDeleteImageAsyncHelper(const BatchDeleteImageRequest& request, const BatchDeleteImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -185,12 +205,22 @@ BatchGetImageOutcome ECRClient::BatchGetImage(const BatchGetImageRequest& reques
 
 BatchGetImageOutcomeCallable ECRClient::BatchGetImageCallable(const BatchGetImageRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::BatchGetImage, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::BatchGetImage, Aws::Client::RejectedCallOutcome<BatchGetImageOutcome>(), this, request);
+}
+
+BatchGetImageOutcomeCallable ECRClient::BatchGetImageCallable(BatchGetImageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::BatchGetImage, Aws::Client::RejectedCallOutcome<BatchGetImageOutcome>(), this, std::move(request));
 }
 
 void ECRClient::BatchGetImageAsync(const BatchGetImageRequest& request, const BatchGetImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::BatchGetImageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::BatchGetImageAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetImageOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::BatchGetImageAsync(BatchGetImageRequest&& request, const BatchGetImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::BatchGetImageAsyncHelper, Aws::Client::RejectedAsyncCall<BatchGetImageOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::BatchGetImageAsyncHelper(const BatchGetImageRequest& request, const BatchGetImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -216,12 +246,22 @@ CompleteLayerUploadOutcome ECRClient::CompleteLayerUpload(const CompleteLayerUpl
 
 CompleteLayerUploadOutcomeCallable ECRClient::CompleteLayerUploadCallable(const CompleteLayerUploadRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::CompleteLayerUpload, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::CompleteLayerUpload, Aws::Client::RejectedCallOutcome<CompleteLayerUploadOutcome>(), this, request);
+}
+
+CompleteLayerUploadOutcomeCallable ECRClient::CompleteLayerUploadCallable(CompleteLayerUploadRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::CompleteLayerUpload, Aws::Client::RejectedCallOutcome<CompleteLayerUploadOutcome>(), this, std::move(request));
 }
 
 void ECRClient::CompleteLayerUploadAsync(const CompleteLayerUploadRequest& request, const CompleteLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::CompleteLayerUploadAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::CompleteLayerUploadAsyncHelper, Aws::Client::RejectedAsyncCall<CompleteLayerUploadOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::CompleteLayerUploadAsync(CompleteLayerUploadRequest&& request, const CompleteLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::CompleteLayerUploadAsyncHelper, Aws::Client::RejectedAsyncCall<CompleteLayerUploadOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::CompleteLayerUploadAsyncHelper(const CompleteLayerUploadRequest& request, const CompleteLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -247,12 +287,22 @@ CreateRepositoryOutcome ECRClient::CreateRepository(const CreateRepositoryReques
 
 CreateRepositoryOutcomeCallable ECRClient::CreateRepositoryCallable(const CreateRepositoryRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::CreateRepository, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::CreateRepository, Aws::Client::RejectedCallOutcome<CreateRepositoryOutcome>(), this, request);
+}
+
+CreateRepositoryOutcomeCallable ECRClient::CreateRepositoryCallable(CreateRepositoryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::CreateRepository, Aws::Client::RejectedCallOutcome<CreateRepositoryOutcome>(), this, std::move(request));
 }
 
 void ECRClient::CreateRepositoryAsync(const CreateRepositoryRequest& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::CreateRepositoryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::CreateRepositoryAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRepositoryOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::CreateRepositoryAsync(CreateRepositoryRequest&& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::CreateRepositoryAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRepositoryOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::CreateRepositoryAsyncHelper(const CreateRepositoryRequest& request, const CreateRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -278,12 +328,22 @@ DeleteRepositoryOutcome ECRClient::DeleteRepository(const DeleteRepositoryReques
 
 DeleteRepositoryOutcomeCallable ECRClient::DeleteRepositoryCallable(const DeleteRepositoryRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::DeleteRepository, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::DeleteRepository, Aws::Client::RejectedCallOutcome<DeleteRepositoryOutcome>(), this, request);
+}
+
+DeleteRepositoryOutcomeCallable ECRClient::DeleteRepositoryCallable(DeleteRepositoryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::DeleteRepository, Aws::Client::RejectedCallOutcome<DeleteRepositoryOutcome>(), this, std::move(request));
 }
 
 void ECRClient::DeleteRepositoryAsync(const DeleteRepositoryRequest& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::DeleteRepositoryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::DeleteRepositoryAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRepositoryOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::DeleteRepositoryAsync(DeleteRepositoryRequest&& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::DeleteRepositoryAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRepositoryOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::DeleteRepositoryAsyncHelper(const DeleteRepositoryRequest& request, const DeleteRepositoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -309,12 +369,22 @@ DeleteRepositoryPolicyOutcome ECRClient::DeleteRepositoryPolicy(const DeleteRepo
 
 DeleteRepositoryPolicyOutcomeCallable ECRClient::DeleteRepositoryPolicyCallable(const DeleteRepositoryPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::DeleteRepositoryPolicy, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::DeleteRepositoryPolicy, Aws::Client::RejectedCallOutcome<DeleteRepositoryPolicyOutcome>(), this, request);
+}
+
+DeleteRepositoryPolicyOutcomeCallable ECRClient::DeleteRepositoryPolicyCallable(DeleteRepositoryPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::DeleteRepositoryPolicy, Aws::Client::RejectedCallOutcome<DeleteRepositoryPolicyOutcome>(), this, std::move(request));
 }
 
 void ECRClient::DeleteRepositoryPolicyAsync(const DeleteRepositoryPolicyRequest& request, const DeleteRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::DeleteRepositoryPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::DeleteRepositoryPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRepositoryPolicyOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::DeleteRepositoryPolicyAsync(DeleteRepositoryPolicyRequest&& request, const DeleteRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::DeleteRepositoryPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRepositoryPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::DeleteRepositoryPolicyAsyncHelper(const DeleteRepositoryPolicyRequest& request, const DeleteRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -340,12 +410,22 @@ DescribeRepositoriesOutcome ECRClient::DescribeRepositories(const DescribeReposi
 
 DescribeRepositoriesOutcomeCallable ECRClient::DescribeRepositoriesCallable(const DescribeRepositoriesRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::DescribeRepositories, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::DescribeRepositories, Aws::Client::RejectedCallOutcome<DescribeRepositoriesOutcome>(), this, request);
+}
+
+DescribeRepositoriesOutcomeCallable ECRClient::DescribeRepositoriesCallable(DescribeRepositoriesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::DescribeRepositories, Aws::Client::RejectedCallOutcome<DescribeRepositoriesOutcome>(), this, std::move(request));
 }
 
 void ECRClient::DescribeRepositoriesAsync(const DescribeRepositoriesRequest& request, const DescribeRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::DescribeRepositoriesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::DescribeRepositoriesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRepositoriesOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::DescribeRepositoriesAsync(DescribeRepositoriesRequest&& request, const DescribeRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::DescribeRepositoriesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRepositoriesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::DescribeRepositoriesAsyncHelper(const DescribeRepositoriesRequest& request, const DescribeRepositoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -371,12 +451,22 @@ GetAuthorizationTokenOutcome ECRClient::GetAuthorizationToken(const GetAuthoriza
 
 GetAuthorizationTokenOutcomeCallable ECRClient::GetAuthorizationTokenCallable(const GetAuthorizationTokenRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::GetAuthorizationToken, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::GetAuthorizationToken, Aws::Client::RejectedCallOutcome<GetAuthorizationTokenOutcome>(), this, request);
+}
+
+GetAuthorizationTokenOutcomeCallable ECRClient::GetAuthorizationTokenCallable(GetAuthorizationTokenRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::GetAuthorizationToken, Aws::Client::RejectedCallOutcome<GetAuthorizationTokenOutcome>(), this, std::move(request));
 }
 
 void ECRClient::GetAuthorizationTokenAsync(const GetAuthorizationTokenRequest& request, const GetAuthorizationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::GetAuthorizationTokenAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::GetAuthorizationTokenAsyncHelper, Aws::Client::RejectedAsyncCall<GetAuthorizationTokenOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::GetAuthorizationTokenAsync(GetAuthorizationTokenRequest&& request, const GetAuthorizationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::GetAuthorizationTokenAsyncHelper, Aws::Client::RejectedAsyncCall<GetAuthorizationTokenOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::GetAuthorizationTokenAsyncHelper(const GetAuthorizationTokenRequest& request, const GetAuthorizationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -402,12 +492,22 @@ GetDownloadUrlForLayerOutcome ECRClient::GetDownloadUrlForLayer(const GetDownloa
 
 GetDownloadUrlForLayerOutcomeCallable ECRClient::GetDownloadUrlForLayerCallable(const GetDownloadUrlForLayerRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::GetDownloadUrlForLayer, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::GetDownloadUrlForLayer, Aws::Client::RejectedCallOutcome<GetDownloadUrlForLayerOutcome>(), this, request);
+}
+
+GetDownloadUrlForLayerOutcomeCallable ECRClient::GetDownloadUrlForLayerCallable(GetDownloadUrlForLayerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::GetDownloadUrlForLayer, Aws::Client::RejectedCallOutcome<GetDownloadUrlForLayerOutcome>(), this, std::move(request));
 }
 
 void ECRClient::GetDownloadUrlForLayerAsync(const GetDownloadUrlForLayerRequest& request, const GetDownloadUrlForLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::GetDownloadUrlForLayerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::GetDownloadUrlForLayerAsyncHelper, Aws::Client::RejectedAsyncCall<GetDownloadUrlForLayerOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::GetDownloadUrlForLayerAsync(GetDownloadUrlForLayerRequest&& request, const GetDownloadUrlForLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::GetDownloadUrlForLayerAsyncHelper, Aws::Client::RejectedAsyncCall<GetDownloadUrlForLayerOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::GetDownloadUrlForLayerAsyncHelper(const GetDownloadUrlForLayerRequest& request, const GetDownloadUrlForLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -433,12 +533,22 @@ GetRepositoryPolicyOutcome ECRClient::GetRepositoryPolicy(const GetRepositoryPol
 
 GetRepositoryPolicyOutcomeCallable ECRClient::GetRepositoryPolicyCallable(const GetRepositoryPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::GetRepositoryPolicy, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::GetRepositoryPolicy, Aws::Client::RejectedCallOutcome<GetRepositoryPolicyOutcome>(), this, request);
+}
+
+GetRepositoryPolicyOutcomeCallable ECRClient::GetRepositoryPolicyCallable(GetRepositoryPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::GetRepositoryPolicy, Aws::Client::RejectedCallOutcome<GetRepositoryPolicyOutcome>(), this, std::move(request));
 }
 
 void ECRClient::GetRepositoryPolicyAsync(const GetRepositoryPolicyRequest& request, const GetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::GetRepositoryPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::GetRepositoryPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetRepositoryPolicyOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::GetRepositoryPolicyAsync(GetRepositoryPolicyRequest&& request, const GetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::GetRepositoryPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetRepositoryPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::GetRepositoryPolicyAsyncHelper(const GetRepositoryPolicyRequest& request, const GetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -464,12 +574,22 @@ InitiateLayerUploadOutcome ECRClient::InitiateLayerUpload(const InitiateLayerUpl
 
 InitiateLayerUploadOutcomeCallable ECRClient::InitiateLayerUploadCallable(const InitiateLayerUploadRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::InitiateLayerUpload, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::InitiateLayerUpload, Aws::Client::RejectedCallOutcome<InitiateLayerUploadOutcome>(), this, request);
+}
+
+InitiateLayerUploadOutcomeCallable ECRClient::InitiateLayerUploadCallable(InitiateLayerUploadRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::InitiateLayerUpload, Aws::Client::RejectedCallOutcome<InitiateLayerUploadOutcome>(), this, std::move(request));
 }
 
 void ECRClient::InitiateLayerUploadAsync(const InitiateLayerUploadRequest& request, const InitiateLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::InitiateLayerUploadAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::InitiateLayerUploadAsyncHelper, Aws::Client::RejectedAsyncCall<InitiateLayerUploadOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::InitiateLayerUploadAsync(InitiateLayerUploadRequest&& request, const InitiateLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::InitiateLayerUploadAsyncHelper, Aws::Client::RejectedAsyncCall<InitiateLayerUploadOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::InitiateLayerUploadAsyncHelper(const InitiateLayerUploadRequest& request, const InitiateLayerUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -495,12 +615,22 @@ ListImagesOutcome ECRClient::ListImages(const ListImagesRequest& request) const
 
 ListImagesOutcomeCallable ECRClient::ListImagesCallable(const ListImagesRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::ListImages, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::ListImages, Aws::Client::RejectedCallOutcome<ListImagesOutcome>(), this, request);
+}
+
+ListImagesOutcomeCallable ECRClient::ListImagesCallable(ListImagesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::ListImages, Aws::Client::RejectedCallOutcome<ListImagesOutcome>(), this, std::move(request));
 }
 
 void ECRClient::ListImagesAsync(const ListImagesRequest& request, const ListImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::ListImagesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::ListImagesAsyncHelper, Aws::Client::RejectedAsyncCall<ListImagesOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::ListImagesAsync(ListImagesRequest&& request, const ListImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::ListImagesAsyncHelper, Aws::Client::RejectedAsyncCall<ListImagesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::ListImagesAsyncHelper(const ListImagesRequest& request, const ListImagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -526,12 +656,22 @@ PutImageOutcome ECRClient::PutImage(const PutImageRequest& request) const
 
 PutImageOutcomeCallable ECRClient::PutImageCallable(const PutImageRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::PutImage, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::PutImage, Aws::Client::RejectedCallOutcome<PutImageOutcome>(), this, request);
+}
+
+PutImageOutcomeCallable ECRClient::PutImageCallable(PutImageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::PutImage, Aws::Client::RejectedCallOutcome<PutImageOutcome>(), this, std::move(request));
 }
 
 void ECRClient::PutImageAsync(const PutImageRequest& request, const PutImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::PutImageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::PutImageAsyncHelper, Aws::Client::RejectedAsyncCall<PutImageOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::PutImageAsync(PutImageRequest&& request, const PutImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::PutImageAsyncHelper, Aws::Client::RejectedAsyncCall<PutImageOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::PutImageAsyncHelper(const PutImageRequest& request, const PutImageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -557,12 +697,22 @@ SetRepositoryPolicyOutcome ECRClient::SetRepositoryPolicy(const SetRepositoryPol
 
 SetRepositoryPolicyOutcomeCallable ECRClient::SetRepositoryPolicyCallable(const SetRepositoryPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::SetRepositoryPolicy, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::SetRepositoryPolicy, Aws::Client::RejectedCallOutcome<SetRepositoryPolicyOutcome>(), this, request);
+}
+
+SetRepositoryPolicyOutcomeCallable ECRClient::SetRepositoryPolicyCallable(SetRepositoryPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::SetRepositoryPolicy, Aws::Client::RejectedCallOutcome<SetRepositoryPolicyOutcome>(), this, std::move(request));
 }
 
 void ECRClient::SetRepositoryPolicyAsync(const SetRepositoryPolicyRequest& request, const SetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::SetRepositoryPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::SetRepositoryPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<SetRepositoryPolicyOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::SetRepositoryPolicyAsync(SetRepositoryPolicyRequest&& request, const SetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::SetRepositoryPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<SetRepositoryPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::SetRepositoryPolicyAsyncHelper(const SetRepositoryPolicyRequest& request, const SetRepositoryPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -588,12 +738,22 @@ UploadLayerPartOutcome ECRClient::UploadLayerPart(const UploadLayerPartRequest&
 
 UploadLayerPartOutcomeCallable ECRClient::UploadLayerPartCallable(const UploadLayerPartRequest& request) const
 {
-  return std::async(std::launch::async, &ECRClient::UploadLayerPart, this, request);
+  return m_executor->SubmitWithFuture(&ECRClient::UploadLayerPart, Aws::Client::RejectedCallOutcome<UploadLayerPartOutcome>(), this, request);
+}
+
+UploadLayerPartOutcomeCallable ECRClient::UploadLayerPartCallable(UploadLayerPartRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECRClient::UploadLayerPart, Aws::Client::RejectedCallOutcome<UploadLayerPartOutcome>(), this, std::move(request));
 }
 
 void ECRClient::UploadLayerPartAsync(const UploadLayerPartRequest& request, const UploadLayerPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECRClient::UploadLayerPartAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECRClient::UploadLayerPartAsyncHelper, Aws::Client::RejectedAsyncCall<UploadLayerPartOutcome>(), this, request, handler, context);
+}
+
+void ECRClient::UploadLayerPartAsync(UploadLayerPartRequest&& request, const UploadLayerPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECRClient::UploadLayerPartAsyncHelper, Aws::Client::RejectedAsyncCall<UploadLayerPartOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECRClient::UploadLayerPartAsyncHelper(const UploadLayerPartRequest& request, const UploadLayerPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
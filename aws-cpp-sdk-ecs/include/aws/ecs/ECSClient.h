@@ -49,6 +49,37 @@
 #include <aws/ecs/model/UpdateServiceResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/ecs/model/CreateClusterRequest.h>
+#include <aws/ecs/model/CreateServiceRequest.h>
+#include <aws/ecs/model/DeleteClusterRequest.h>
+#include <aws/ecs/model/DeleteServiceRequest.h>
+#include <aws/ecs/model/DeregisterContainerInstanceRequest.h>
+#include <aws/ecs/model/DeregisterTaskDefinitionRequest.h>
+#include <aws/ecs/model/DescribeClustersRequest.h>
+#include <aws/ecs/model/DescribeContainerInstancesRequest.h>
+#include <aws/ecs/model/DescribeServicesRequest.h>
+#include <aws/ecs/model/DescribeTaskDefinitionRequest.h>
+#include <aws/ecs/model/DescribeTasksRequest.h>
+#include <aws/ecs/model/DiscoverPollEndpointRequest.h>
+#include <aws/ecs/model/ListClustersRequest.h>
+#include <aws/ecs/model/ListContainerInstancesRequest.h>
+#include <aws/ecs/model/ListServicesRequest.h>
+#include <aws/ecs/model/ListTaskDefinitionFamiliesRequest.h>
+#include <aws/ecs/model/ListTaskDefinitionsRequest.h>
+#include <aws/ecs/model/ListTasksRequest.h>
+#include <aws/ecs/model/RegisterContainerInstanceRequest.h>
+#include <aws/ecs/model/RegisterTaskDefinitionRequest.h>
+#include <aws/ecs/model/RunTaskRequest.h>
+#include <aws/ecs/model/StartTaskRequest.h>
+#include <aws/ecs/model/StopTaskRequest.h>
+#include <aws/ecs/model/SubmitContainerStateChangeRequest.h>
+#include <aws/ecs/model/SubmitTaskStateChangeRequest.h>
+#include <aws/ecs/model/UpdateContainerAgentRequest.h>
+#include <aws/ecs/model/UpdateServiceRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -265,6 +296,11 @@ namespace Model
          */
         virtual Model::CreateClusterOutcomeCallable CreateClusterCallable(const Model::CreateClusterRequest& request) const;
 
+        /**
+         * Same as CreateClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateClusterOutcomeCallable CreateClusterCallable(Model::CreateClusterRequest&& request) const;
+
         /**
          * <p>Creates a new Amazon ECS cluster. By default, your account receives a
          * <code>default</code> cluster when you launch your first container instance.
@@ -275,6 +311,11 @@ namespace Model
          */
         virtual void CreateClusterAsync(const Model::CreateClusterRequest& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateClusterAsync(Model::CreateClusterRequest&& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Runs and maintains a desired number of tasks from a specified task
          * definition. If the number of tasks running in a service drops below
@@ -361,6 +402,11 @@ namespace Model
          */
         virtual Model::CreateServiceOutcomeCallable CreateServiceCallable(const Model::CreateServiceRequest& request) const;
 
+        /**
+         * Same as CreateServiceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateServiceOutcomeCallable CreateServiceCallable(Model::CreateServiceRequest&& request) const;
+
         /**
          * <p>Runs and maintains a desired number of tasks from a specified task
          * definition. If the number of tasks running in a service drops below
@@ -405,6 +451,11 @@ namespace Model
          */
         virtual void CreateServiceAsync(const Model::CreateServiceRequest& request, const CreateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateServiceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateServiceAsync(Model::CreateServiceRequest&& request, const CreateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified cluster. You must deregister all container instances
          * from this cluster before you may delete it. You can list the container instances
@@ -423,6 +474,11 @@ namespace Model
          */
         virtual Model::DeleteClusterOutcomeCallable DeleteClusterCallable(const Model::DeleteClusterRequest& request) const;
 
+        /**
+         * Same as DeleteClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteClusterOutcomeCallable DeleteClusterCallable(Model::DeleteClusterRequest&& request) const;
+
         /**
          * <p>Deletes the specified cluster. You must deregister all container instances
          * from this cluster before you may delete it. You can list the container instances
@@ -433,6 +489,11 @@ namespace Model
          */
         virtual void DeleteClusterAsync(const Model::DeleteClusterRequest& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteClusterAsync(Model::DeleteClusterRequest&& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a specified service within a cluster. You can delete a service if you
          * have no running tasks in it and the desired task count is zero. If the service
@@ -473,6 +534,11 @@ namespace Model
          */
         virtual Model::DeleteServiceOutcomeCallable DeleteServiceCallable(const Model::DeleteServiceRequest& request) const;
 
+        /**
+         * Same as DeleteServiceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteServiceOutcomeCallable DeleteServiceCallable(Model::DeleteServiceRequest&& request) const;
+
         /**
          * <p>Deletes a specified service within a cluster. You can delete a service if you
          * have no running tasks in it and the desired task count is zero. If the service
@@ -494,6 +560,11 @@ namespace Model
          */
         virtual void DeleteServiceAsync(const Model::DeleteServiceRequest& request, const DeleteServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteServiceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteServiceAsync(Model::DeleteServiceRequest&& request, const DeleteServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters an Amazon ECS container instance from the specified cluster. This
          * instance is no longer available to run tasks.</p> <p>If you intend to use the
@@ -524,6 +595,11 @@ namespace Model
          */
         virtual Model::DeregisterContainerInstanceOutcomeCallable DeregisterContainerInstanceCallable(const Model::DeregisterContainerInstanceRequest& request) const;
 
+        /**
+         * Same as DeregisterContainerInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeregisterContainerInstanceOutcomeCallable DeregisterContainerInstanceCallable(Model::DeregisterContainerInstanceRequest&& request) const;
+
         /**
          * <p>Deregisters an Amazon ECS container instance from the specified cluster. This
          * instance is no longer available to run tasks.</p> <p>If you intend to use the
@@ -540,6 +616,11 @@ namespace Model
          */
         virtual void DeregisterContainerInstanceAsync(const Model::DeregisterContainerInstanceRequest& request, const DeregisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterContainerInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeregisterContainerInstanceAsync(Model::DeregisterContainerInstanceRequest&& request, const DeregisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters the specified task definition by family and revision. Upon
          * deregistration, the task definition is marked as <code>INACTIVE</code>. Existing
@@ -570,6 +651,11 @@ namespace Model
          */
         virtual Model::DeregisterTaskDefinitionOutcomeCallable DeregisterTaskDefinitionCallable(const Model::DeregisterTaskDefinitionRequest& request) const;
 
+        /**
+         * Same as DeregisterTaskDefinitionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeregisterTaskDefinitionOutcomeCallable DeregisterTaskDefinitionCallable(Model::DeregisterTaskDefinitionRequest&& request) const;
+
         /**
          * <p>Deregisters the specified task definition by family and revision. Upon
          * deregistration, the task definition is marked as <code>INACTIVE</code>. Existing
@@ -586,6 +672,11 @@ namespace Model
          */
         virtual void DeregisterTaskDefinitionAsync(const Model::DeregisterTaskDefinitionRequest& request, const DeregisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterTaskDefinitionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeregisterTaskDefinitionAsync(Model::DeregisterTaskDefinitionRequest&& request, const DeregisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your clusters.</p>
          */
@@ -598,6 +689,11 @@ namespace Model
          */
         virtual Model::DescribeClustersOutcomeCallable DescribeClustersCallable(const Model::DescribeClustersRequest& request) const;
 
+        /**
+         * Same as DescribeClustersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeClustersOutcomeCallable DescribeClustersCallable(Model::DescribeClustersRequest&& request) const;
+
         /**
          * <p>Describes one or more of your clusters.</p>
          *
@@ -605,6 +701,11 @@ namespace Model
          */
         virtual void DescribeClustersAsync(const Model::DescribeClustersRequest& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClustersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeClustersAsync(Model::DescribeClustersRequest&& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes Amazon EC2 Container Service container instances. Returns metadata
          * about registered and remaining resources on each container instance
@@ -621,6 +722,11 @@ namespace Model
          */
         virtual Model::DescribeContainerInstancesOutcomeCallable DescribeContainerInstancesCallable(const Model::DescribeContainerInstancesRequest& request) const;
 
+        /**
+         * Same as DescribeContainerInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeContainerInstancesOutcomeCallable DescribeContainerInstancesCallable(Model::DescribeContainerInstancesRequest&& request) const;
+
         /**
          * <p>Describes Amazon EC2 Container Service container instances. Returns metadata
          * about registered and remaining resources on each container instance
@@ -630,6 +736,11 @@ namespace Model
          */
         virtual void DescribeContainerInstancesAsync(const Model::DescribeContainerInstancesRequest& request, const DescribeContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeContainerInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeContainerInstancesAsync(Model::DescribeContainerInstancesRequest&& request, const DescribeContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified services running in your cluster.</p>
          */
@@ -642,6 +753,11 @@ namespace Model
          */
         virtual Model::DescribeServicesOutcomeCallable DescribeServicesCallable(const Model::DescribeServicesRequest& request) const;
 
+        /**
+         * Same as DescribeServicesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeServicesOutcomeCallable DescribeServicesCallable(Model::DescribeServicesRequest&& request) const;
+
         /**
          * <p>Describes the specified services running in your cluster.</p>
          *
@@ -649,6 +765,11 @@ namespace Model
          */
         virtual void DescribeServicesAsync(const Model::DescribeServicesRequest& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeServicesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeServicesAsync(Model::DescribeServicesRequest&& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes a task definition. You can specify a <code>family</code> and
          * <code>revision</code> to find information about a specific task definition, or
@@ -671,6 +792,11 @@ namespace Model
          */
         virtual Model::DescribeTaskDefinitionOutcomeCallable DescribeTaskDefinitionCallable(const Model::DescribeTaskDefinitionRequest& request) const;
 
+        /**
+         * Same as DescribeTaskDefinitionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTaskDefinitionOutcomeCallable DescribeTaskDefinitionCallable(Model::DescribeTaskDefinitionRequest&& request) const;
+
         /**
          * <p>Describes a task definition. You can specify a <code>family</code> and
          * <code>revision</code> to find information about a specific task definition, or
@@ -683,6 +809,11 @@ namespace Model
          */
         virtual void DescribeTaskDefinitionAsync(const Model::DescribeTaskDefinitionRequest& request, const DescribeTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTaskDefinitionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTaskDefinitionAsync(Model::DescribeTaskDefinitionRequest&& request, const DescribeTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes a specified task or tasks.</p>
          */
@@ -695,6 +826,11 @@ namespace Model
          */
         virtual Model::DescribeTasksOutcomeCallable DescribeTasksCallable(const Model::DescribeTasksRequest& request) const;
 
+        /**
+         * Same as DescribeTasksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTasksOutcomeCallable DescribeTasksCallable(Model::DescribeTasksRequest&& request) const;
+
         /**
          * <p>Describes a specified task or tasks.</p>
          *
@@ -702,6 +838,11 @@ namespace Model
          */
         virtual void DescribeTasksAsync(const Model::DescribeTasksRequest& request, const DescribeTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTasksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTasksAsync(Model::DescribeTasksRequest&& request, const DescribeTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
          * it is not intended for use outside of the agent.</p></note> <p>Returns an
@@ -718,6 +859,11 @@ namespace Model
          */
         virtual Model::DiscoverPollEndpointOutcomeCallable DiscoverPollEndpointCallable(const Model::DiscoverPollEndpointRequest& request) const;
 
+        /**
+         * Same as DiscoverPollEndpointCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DiscoverPollEndpointOutcomeCallable DiscoverPollEndpointCallable(Model::DiscoverPollEndpointRequest&& request) const;
+
         /**
          * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
          * it is not intended for use outside of the agent.</p></note> <p>Returns an
@@ -727,6 +873,11 @@ namespace Model
          */
         virtual void DiscoverPollEndpointAsync(const Model::DiscoverPollEndpointRequest& request, const DiscoverPollEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DiscoverPollEndpointAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DiscoverPollEndpointAsync(Model::DiscoverPollEndpointRequest&& request, const DiscoverPollEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of existing clusters.</p>
          */
@@ -739,6 +890,11 @@ namespace Model
          */
         virtual Model::ListClustersOutcomeCallable ListClustersCallable(const Model::ListClustersRequest& request) const;
 
+        /**
+         * Same as ListClustersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListClustersOutcomeCallable ListClustersCallable(Model::ListClustersRequest&& request) const;
+
         /**
          * <p>Returns a list of existing clusters.</p>
          *
@@ -746,6 +902,11 @@ namespace Model
          */
         virtual void ListClustersAsync(const Model::ListClustersRequest& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListClustersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListClustersAsync(Model::ListClustersRequest&& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of container instances in a specified cluster.</p>
          */
@@ -758,6 +919,11 @@ namespace Model
          */
         virtual Model::ListContainerInstancesOutcomeCallable ListContainerInstancesCallable(const Model::ListContainerInstancesRequest& request) const;
 
+        /**
+         * Same as ListContainerInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListContainerInstancesOutcomeCallable ListContainerInstancesCallable(Model::ListContainerInstancesRequest&& request) const;
+
         /**
          * <p>Returns a list of container instances in a specified cluster.</p>
          *
@@ -765,6 +931,11 @@ namespace Model
          */
         virtual void ListContainerInstancesAsync(const Model::ListContainerInstancesRequest& request, const ListContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListContainerInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListContainerInstancesAsync(Model::ListContainerInstancesRequest&& request, const ListContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the services that are running in a specified cluster.</p>
          */
@@ -777,6 +948,11 @@ namespace Model
          */
         virtual Model::ListServicesOutcomeCallable ListServicesCallable(const Model::ListServicesRequest& request) const;
 
+        /**
+         * Same as ListServicesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListServicesOutcomeCallable ListServicesCallable(Model::ListServicesRequest&& request) const;
+
         /**
          * <p>Lists the services that are running in a specified cluster.</p>
          *
@@ -784,6 +960,11 @@ namespace Model
          */
         virtual void ListServicesAsync(const Model::ListServicesRequest& request, const ListServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListServicesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListServicesAsync(Model::ListServicesRequest&& request, const ListServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of task definition families that are registered to your
          * account (which may include task definition families that no longer have any
@@ -802,6 +983,11 @@ namespace Model
          */
         virtual Model::ListTaskDefinitionFamiliesOutcomeCallable ListTaskDefinitionFamiliesCallable(const Model::ListTaskDefinitionFamiliesRequest& request) const;
 
+        /**
+         * Same as ListTaskDefinitionFamiliesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTaskDefinitionFamiliesOutcomeCallable ListTaskDefinitionFamiliesCallable(Model::ListTaskDefinitionFamiliesRequest&& request) const;
+
         /**
          * <p>Returns a list of task definition families that are registered to your
          * account (which may include task definition families that no longer have any
@@ -812,6 +998,11 @@ namespace Model
          */
         virtual void ListTaskDefinitionFamiliesAsync(const Model::ListTaskDefinitionFamiliesRequest& request, const ListTaskDefinitionFamiliesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTaskDefinitionFamiliesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTaskDefinitionFamiliesAsync(Model::ListTaskDefinitionFamiliesRequest&& request, const ListTaskDefinitionFamiliesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of task definitions that are registered to your account. You
          * can filter the results by family name with the <code>familyPrefix</code>
@@ -828,6 +1019,11 @@ namespace Model
          */
         virtual Model::ListTaskDefinitionsOutcomeCallable ListTaskDefinitionsCallable(const Model::ListTaskDefinitionsRequest& request) const;
 
+        /**
+         * Same as ListTaskDefinitionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTaskDefinitionsOutcomeCallable ListTaskDefinitionsCallable(Model::ListTaskDefinitionsRequest&& request) const;
+
         /**
          * <p>Returns a list of task definitions that are registered to your account. You
          * can filter the results by family name with the <code>familyPrefix</code>
@@ -837,6 +1033,11 @@ namespace Model
          */
         virtual void ListTaskDefinitionsAsync(const Model::ListTaskDefinitionsRequest& request, const ListTaskDefinitionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTaskDefinitionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTaskDefinitionsAsync(Model::ListTaskDefinitionsRequest&& request, const ListTaskDefinitionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of tasks for a specified cluster. You can filter the results
          * by family name, by a particular container instance, or by the desired status of
@@ -855,6 +1056,11 @@ namespace Model
          */
         virtual Model::ListTasksOutcomeCallable ListTasksCallable(const Model::ListTasksRequest& request) const;
 
+        /**
+         * Same as ListTasksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTasksOutcomeCallable ListTasksCallable(Model::ListTasksRequest&& request) const;
+
         /**
          * <p>Returns a list of tasks for a specified cluster. You can filter the results
          * by family name, by a particular container instance, or by the desired status of
@@ -865,6 +1071,11 @@ namespace Model
          */
         virtual void ListTasksAsync(const Model::ListTasksRequest& request, const ListTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTasksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTasksAsync(Model::ListTasksRequest&& request, const ListTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
          * it is not intended for use outside of the agent.</p></note> <p>Registers an EC2
@@ -883,6 +1094,11 @@ namespace Model
          */
         virtual Model::RegisterContainerInstanceOutcomeCallable RegisterContainerInstanceCallable(const Model::RegisterContainerInstanceRequest& request) const;
 
+        /**
+         * Same as RegisterContainerInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterContainerInstanceOutcomeCallable RegisterContainerInstanceCallable(Model::RegisterContainerInstanceRequest&& request) const;
+
         /**
          * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
          * it is not intended for use outside of the agent.</p></note> <p>Registers an EC2
@@ -893,6 +1109,11 @@ namespace Model
          */
         virtual void RegisterContainerInstanceAsync(const Model::RegisterContainerInstanceRequest& request, const RegisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterContainerInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterContainerInstanceAsync(Model::RegisterContainerInstanceRequest&& request, const RegisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers a new task definition from the supplied <code>family</code> and
          * <code>containerDefinitions</code>. Optionally, you can add data volumes to your
@@ -917,6 +1138,11 @@ namespace Model
          */
         virtual Model::RegisterTaskDefinitionOutcomeCallable RegisterTaskDefinitionCallable(const Model::RegisterTaskDefinitionRequest& request) const;
 
+        /**
+         * Same as RegisterTaskDefinitionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterTaskDefinitionOutcomeCallable RegisterTaskDefinitionCallable(Model::RegisterTaskDefinitionRequest&& request) const;
+
         /**
          * <p>Registers a new task definition from the supplied <code>family</code> and
          * <code>containerDefinitions</code>. Optionally, you can add data volumes to your
@@ -930,6 +1156,11 @@ namespace Model
          */
         virtual void RegisterTaskDefinitionAsync(const Model::RegisterTaskDefinitionRequest& request, const RegisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterTaskDefinitionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterTaskDefinitionAsync(Model::RegisterTaskDefinitionRequest&& request, const RegisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Start a task using random placement and the default Amazon ECS scheduler. To
          * use your own scheduler or place a task on a specific container instance, use
@@ -948,6 +1179,11 @@ namespace Model
          */
         virtual Model::RunTaskOutcomeCallable RunTaskCallable(const Model::RunTaskRequest& request) const;
 
+        /**
+         * Same as RunTaskCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RunTaskOutcomeCallable RunTaskCallable(Model::RunTaskRequest&& request) const;
+
         /**
          * <p>Start a task using random placement and the default Amazon ECS scheduler. To
          * use your own scheduler or place a task on a specific container instance, use
@@ -958,6 +1194,11 @@ namespace Model
          */
         virtual void RunTaskAsync(const Model::RunTaskRequest& request, const RunTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RunTaskAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RunTaskAsync(Model::RunTaskRequest&& request, const RunTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts a new task from the specified task definition on the specified
          * container instance or instances. To use the default Amazon ECS scheduler to
@@ -976,6 +1217,11 @@ namespace Model
          */
         virtual Model::StartTaskOutcomeCallable StartTaskCallable(const Model::StartTaskRequest& request) const;
 
+        /**
+         * Same as StartTaskCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StartTaskOutcomeCallable StartTaskCallable(Model::StartTaskRequest&& request) const;
+
         /**
          * <p>Starts a new task from the specified task definition on the specified
          * container instance or instances. To use the default Amazon ECS scheduler to
@@ -986,6 +1232,11 @@ namespace Model
          */
         virtual void StartTaskAsync(const Model::StartTaskRequest& request, const StartTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartTaskAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StartTaskAsync(Model::StartTaskRequest&& request, const StartTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stops a running task.</p> <p>When <a>StopTask</a> is called on a task, the
          * equivalent of <code>docker stop</code> is issued to the containers running in
@@ -1008,6 +1259,11 @@ namespace Model
          */
         virtual Model::StopTaskOutcomeCallable StopTaskCallable(const Model::StopTaskRequest& request) const;
 
+        /**
+         * Same as StopTaskCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StopTaskOutcomeCallable StopTaskCallable(Model::StopTaskRequest&& request) const;
+
         /**
          * <p>Stops a running task.</p> <p>When <a>StopTask</a> is called on a task, the
          * equivalent of <code>docker stop</code> is issued to the containers running in
@@ -1020,6 +1276,11 @@ namespace Model
          */
         virtual void StopTaskAsync(const Model::StopTaskRequest& request, const StopTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopTaskAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StopTaskAsync(Model::StopTaskRequest&& request, const StopTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
          * it is not intended for use outside of the agent.</p></note> <p>Sent to
@@ -1036,6 +1297,11 @@ namespace Model
          */
         virtual Model::SubmitContainerStateChangeOutcomeCallable SubmitContainerStateChangeCallable(const Model::SubmitContainerStateChangeRequest& request) const;
 
+        /**
+         * Same as SubmitContainerStateChangeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SubmitContainerStateChangeOutcomeCallable SubmitContainerStateChangeCallable(Model::SubmitContainerStateChangeRequest&& request) const;
+
         /**
          * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
          * it is not intended for use outside of the agent.</p></note> <p>Sent to
@@ -1045,6 +1311,11 @@ namespace Model
          */
         virtual void SubmitContainerStateChangeAsync(const Model::SubmitContainerStateChangeRequest& request, const SubmitContainerStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SubmitContainerStateChangeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SubmitContainerStateChangeAsync(Model::SubmitContainerStateChangeRequest&& request, const SubmitContainerStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
          * it is not intended for use outside of the agent.</p></note> <p>Sent to
@@ -1061,6 +1332,11 @@ namespace Model
          */
         virtual Model::SubmitTaskStateChangeOutcomeCallable SubmitTaskStateChangeCallable(const Model::SubmitTaskStateChangeRequest& request) const;
 
+        /**
+         * Same as SubmitTaskStateChangeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SubmitTaskStateChangeOutcomeCallable SubmitTaskStateChangeCallable(Model::SubmitTaskStateChangeRequest&& request) const;
+
         /**
          * <note><p>This action is only used by the Amazon EC2 Container Service agent, and
          * it is not intended for use outside of the agent.</p></note> <p>Sent to
@@ -1070,6 +1346,11 @@ namespace Model
          */
         virtual void SubmitTaskStateChangeAsync(const Model::SubmitTaskStateChangeRequest& request, const SubmitTaskStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SubmitTaskStateChangeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SubmitTaskStateChangeAsync(Model::SubmitTaskStateChangeRequest&& request, const SubmitTaskStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the Amazon ECS container agent on a specified container instance.
          * Updating the Amazon ECS container agent does not interrupt running tasks or
@@ -1102,6 +1383,11 @@ namespace Model
          */
         virtual Model::UpdateContainerAgentOutcomeCallable UpdateContainerAgentCallable(const Model::UpdateContainerAgentRequest& request) const;
 
+        /**
+         * Same as UpdateContainerAgentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateContainerAgentOutcomeCallable UpdateContainerAgentCallable(Model::UpdateContainerAgentRequest&& request) const;
+
         /**
          * <p>Updates the Amazon ECS container agent on a specified container instance.
          * Updating the Amazon ECS container agent does not interrupt running tasks or
@@ -1119,6 +1405,11 @@ namespace Model
          */
         virtual void UpdateContainerAgentAsync(const Model::UpdateContainerAgentRequest& request, const UpdateContainerAgentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateContainerAgentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateContainerAgentAsync(Model::UpdateContainerAgentRequest&& request, const UpdateContainerAgentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the desired count, deployment configuration, or task definition used
          * in a service.</p> <p>You can add to or subtract from the number of
@@ -1215,6 +1506,11 @@ namespace Model
          */
         virtual Model::UpdateServiceOutcomeCallable UpdateServiceCallable(const Model::UpdateServiceRequest& request) const;
 
+        /**
+         * Same as UpdateServiceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateServiceOutcomeCallable UpdateServiceCallable(Model::UpdateServiceRequest&& request) const;
+
         /**
          * <p>Modifies the desired count, deployment configuration, or task definition used
          * in a service.</p> <p>You can add to or subtract from the number of
@@ -1264,6 +1560,72 @@ namespace Model
          */
         virtual void UpdateServiceAsync(const Model::UpdateServiceRequest& request, const UpdateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateServiceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateServiceAsync(Model::UpdateServiceRequest&& request, const UpdateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateClusterOutcome> CreateClusterAwaitable(const Model::CreateClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::CreateCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateClusterOutcome> CreateClusterAwaitable(Model::CreateClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::CreateCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateServiceOutcome> CreateServiceAwaitable(const Model::CreateServiceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::CreateService, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateServiceOutcome> CreateServiceAwaitable(Model::CreateServiceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::CreateService, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteClusterOutcome> DeleteClusterAwaitable(const Model::DeleteClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DeleteCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteClusterOutcome> DeleteClusterAwaitable(Model::DeleteClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DeleteCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteServiceOutcome> DeleteServiceAwaitable(const Model::DeleteServiceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DeleteService, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteServiceOutcome> DeleteServiceAwaitable(Model::DeleteServiceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DeleteService, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterContainerInstanceOutcome> DeregisterContainerInstanceAwaitable(const Model::DeregisterContainerInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DeregisterContainerInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterContainerInstanceOutcome> DeregisterContainerInstanceAwaitable(Model::DeregisterContainerInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DeregisterContainerInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterTaskDefinitionOutcome> DeregisterTaskDefinitionAwaitable(const Model::DeregisterTaskDefinitionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DeregisterTaskDefinition, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterTaskDefinitionOutcome> DeregisterTaskDefinitionAwaitable(Model::DeregisterTaskDefinitionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DeregisterTaskDefinition, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClustersOutcome> DescribeClustersAwaitable(const Model::DescribeClustersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DescribeClusters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClustersOutcome> DescribeClustersAwaitable(Model::DescribeClustersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DescribeClusters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeContainerInstancesOutcome> DescribeContainerInstancesAwaitable(const Model::DescribeContainerInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DescribeContainerInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeContainerInstancesOutcome> DescribeContainerInstancesAwaitable(Model::DescribeContainerInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DescribeContainerInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeServicesOutcome> DescribeServicesAwaitable(const Model::DescribeServicesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DescribeServices, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeServicesOutcome> DescribeServicesAwaitable(Model::DescribeServicesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DescribeServices, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTaskDefinitionOutcome> DescribeTaskDefinitionAwaitable(const Model::DescribeTaskDefinitionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DescribeTaskDefinition, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTaskDefinitionOutcome> DescribeTaskDefinitionAwaitable(Model::DescribeTaskDefinitionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DescribeTaskDefinition, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTasksOutcome> DescribeTasksAwaitable(const Model::DescribeTasksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DescribeTasks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTasksOutcome> DescribeTasksAwaitable(Model::DescribeTasksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DescribeTasks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DiscoverPollEndpointOutcome> DiscoverPollEndpointAwaitable(const Model::DiscoverPollEndpointRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DiscoverPollEndpoint, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DiscoverPollEndpointOutcome> DiscoverPollEndpointAwaitable(Model::DiscoverPollEndpointRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::DiscoverPollEndpoint, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListClustersOutcome> ListClustersAwaitable(const Model::ListClustersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::ListClusters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListClustersOutcome> ListClustersAwaitable(Model::ListClustersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::ListClusters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListContainerInstancesOutcome> ListContainerInstancesAwaitable(const Model::ListContainerInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::ListContainerInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListContainerInstancesOutcome> ListContainerInstancesAwaitable(Model::ListContainerInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::ListContainerInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListServicesOutcome> ListServicesAwaitable(const Model::ListServicesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::ListServices, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListServicesOutcome> ListServicesAwaitable(Model::ListServicesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::ListServices, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTaskDefinitionFamiliesOutcome> ListTaskDefinitionFamiliesAwaitable(const Model::ListTaskDefinitionFamiliesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::ListTaskDefinitionFamilies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTaskDefinitionFamiliesOutcome> ListTaskDefinitionFamiliesAwaitable(Model::ListTaskDefinitionFamiliesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::ListTaskDefinitionFamilies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTaskDefinitionsOutcome> ListTaskDefinitionsAwaitable(const Model::ListTaskDefinitionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::ListTaskDefinitions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTaskDefinitionsOutcome> ListTaskDefinitionsAwaitable(Model::ListTaskDefinitionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::ListTaskDefinitions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTasksOutcome> ListTasksAwaitable(const Model::ListTasksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::ListTasks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTasksOutcome> ListTasksAwaitable(Model::ListTasksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::ListTasks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterContainerInstanceOutcome> RegisterContainerInstanceAwaitable(const Model::RegisterContainerInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::RegisterContainerInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterContainerInstanceOutcome> RegisterContainerInstanceAwaitable(Model::RegisterContainerInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::RegisterContainerInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterTaskDefinitionOutcome> RegisterTaskDefinitionAwaitable(const Model::RegisterTaskDefinitionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::RegisterTaskDefinition, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterTaskDefinitionOutcome> RegisterTaskDefinitionAwaitable(Model::RegisterTaskDefinitionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::RegisterTaskDefinition, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RunTaskOutcome> RunTaskAwaitable(const Model::RunTaskRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::RunTask, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RunTaskOutcome> RunTaskAwaitable(Model::RunTaskRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::RunTask, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartTaskOutcome> StartTaskAwaitable(const Model::StartTaskRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::StartTask, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartTaskOutcome> StartTaskAwaitable(Model::StartTaskRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::StartTask, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopTaskOutcome> StopTaskAwaitable(const Model::StopTaskRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::StopTask, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopTaskOutcome> StopTaskAwaitable(Model::StopTaskRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::StopTask, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SubmitContainerStateChangeOutcome> SubmitContainerStateChangeAwaitable(const Model::SubmitContainerStateChangeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::SubmitContainerStateChange, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SubmitContainerStateChangeOutcome> SubmitContainerStateChangeAwaitable(Model::SubmitContainerStateChangeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::SubmitContainerStateChange, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SubmitTaskStateChangeOutcome> SubmitTaskStateChangeAwaitable(const Model::SubmitTaskStateChangeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::SubmitTaskStateChange, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SubmitTaskStateChangeOutcome> SubmitTaskStateChangeAwaitable(Model::SubmitTaskStateChangeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::SubmitTaskStateChange, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateContainerAgentOutcome> UpdateContainerAgentAwaitable(const Model::UpdateContainerAgentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::UpdateContainerAgent, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateContainerAgentOutcome> UpdateContainerAgentAwaitable(Model::UpdateContainerAgentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::UpdateContainerAgent, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateServiceOutcome> UpdateServiceAwaitable(const Model::UpdateServiceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::UpdateService, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateServiceOutcome> UpdateServiceAwaitable(Model::UpdateServiceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ECSClient::UpdateService, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -134,12 +134,22 @@ CreateClusterOutcome ECSClient::CreateCluster(const CreateClusterRequest& reques
 
 CreateClusterOutcomeCallable ECSClient::CreateClusterCallable(const CreateClusterRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::CreateCluster, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::CreateCluster, Aws::Client::RejectedCallOutcome<CreateClusterOutcome>(), this, request);
+}
+
+CreateClusterOutcomeCallable ECSClient::CreateClusterCallable(CreateClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::CreateCluster, Aws::Client::RejectedCallOutcome<CreateClusterOutcome>(), this, std::move(request));
 }
 
 void ECSClient::CreateClusterAsync(const CreateClusterRequest& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::CreateClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::CreateClusterAsyncHelper, Aws::Client::RejectedAsyncCall<CreateClusterOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::CreateClusterAsync(CreateClusterRequest&& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::CreateClusterAsyncHelper, Aws::Client::RejectedAsyncCall<CreateClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::CreateClusterAsyncHelper(const CreateClusterRequest& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -165,12 +175,22 @@ CreateServiceOutcome ECSClient::CreateService(const CreateServiceRequest& reques
 
 CreateServiceOutcomeCallable ECSClient::CreateServiceCallable(const CreateServiceRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::CreateService, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::CreateService, Aws::Client::RejectedCallOutcome<CreateServiceOutcome>(), this, request);
+}
+
+CreateServiceOutcomeCallable ECSClient::CreateServiceCallable(CreateServiceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::CreateService, Aws::Client::RejectedCallOutcome<CreateServiceOutcome>(), this, std::move(request));
 }
 
 void ECSClient::CreateServiceAsync(const CreateServiceRequest& request, const CreateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::CreateServiceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::CreateServiceAsyncHelper, Aws::Client::RejectedAsyncCall<CreateServiceOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::CreateServiceAsync(CreateServiceRequest&& request, const CreateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::CreateServiceAsyncHelper, Aws::Client::RejectedAsyncCall<CreateServiceOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::CreateServiceAsyncHelper(const CreateServiceRequest& request, const CreateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -196,12 +216,22 @@ DeleteClusterOutcome ECSClient::DeleteCluster(const DeleteClusterRequest& reques
 
 DeleteClusterOutcomeCallable ECSClient::DeleteClusterCallable(const DeleteClusterRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::DeleteCluster, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::DeleteCluster, Aws::Client::RejectedCallOutcome<DeleteClusterOutcome>(), this, request);
+}
+
+DeleteClusterOutcomeCallable ECSClient::DeleteClusterCallable(DeleteClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::DeleteCluster, Aws::Client::RejectedCallOutcome<DeleteClusterOutcome>(), this, std::move(request));
 }
 
 void ECSClient::DeleteClusterAsync(const DeleteClusterRequest& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::DeleteClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::DeleteClusterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteClusterOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::DeleteClusterAsync(DeleteClusterRequest&& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::DeleteClusterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::DeleteClusterAsyncHelper(const DeleteClusterRequest& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -227,12 +257,22 @@ DeleteServiceOutcome ECSClient::DeleteService(const DeleteServiceRequest& reques
 
 DeleteServiceOutcomeCallable ECSClient::DeleteServiceCallable(const DeleteServiceRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::DeleteService, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::DeleteService, Aws::Client::RejectedCallOutcome<DeleteServiceOutcome>(), this, request);
+}
+
+DeleteServiceOutcomeCallable ECSClient::DeleteServiceCallable(DeleteServiceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::DeleteService, Aws::Client::RejectedCallOutcome<DeleteServiceOutcome>(), this, std::move(request));
 }
 
 void ECSClient::DeleteServiceAsync(const DeleteServiceRequest& request, const DeleteServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::DeleteServiceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::DeleteServiceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteServiceOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::DeleteServiceAsync(DeleteServiceRequest&& request, const DeleteServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::DeleteServiceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteServiceOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::DeleteServiceAsyncHelper(const DeleteServiceRequest& request, const DeleteServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -258,12 +298,22 @@ DeregisterContainerInstanceOutcome ECSClient::DeregisterContainerInstance(const
 
 DeregisterContainerInstanceOutcomeCallable ECSClient::DeregisterContainerInstanceCallable(const DeregisterContainerInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::DeregisterContainerInstance, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::DeregisterContainerInstance, Aws::Client::RejectedCallOutcome<DeregisterContainerInstanceOutcome>(), this, request);
+}
+
+DeregisterContainerInstanceOutcomeCallable ECSClient::DeregisterContainerInstanceCallable(DeregisterContainerInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::DeregisterContainerInstance, Aws::Client::RejectedCallOutcome<DeregisterContainerInstanceOutcome>(), this, std::move(request));
 }
 
 void ECSClient::DeregisterContainerInstanceAsync(const DeregisterContainerInstanceRequest& request, const DeregisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::DeregisterContainerInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::DeregisterContainerInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterContainerInstanceOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::DeregisterContainerInstanceAsync(DeregisterContainerInstanceRequest&& request, const DeregisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::DeregisterContainerInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterContainerInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::DeregisterContainerInstanceAsyncHelper(const DeregisterContainerInstanceRequest& request, const DeregisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -289,12 +339,22 @@ DeregisterTaskDefinitionOutcome ECSClient::DeregisterTaskDefinition(const Deregi
 
 DeregisterTaskDefinitionOutcomeCallable ECSClient::DeregisterTaskDefinitionCallable(const DeregisterTaskDefinitionRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::DeregisterTaskDefinition, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::DeregisterTaskDefinition, Aws::Client::RejectedCallOutcome<DeregisterTaskDefinitionOutcome>(), this, request);
+}
+
+DeregisterTaskDefinitionOutcomeCallable ECSClient::DeregisterTaskDefinitionCallable(DeregisterTaskDefinitionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::DeregisterTaskDefinition, Aws::Client::RejectedCallOutcome<DeregisterTaskDefinitionOutcome>(), this, std::move(request));
 }
 
 void ECSClient::DeregisterTaskDefinitionAsync(const DeregisterTaskDefinitionRequest& request, const DeregisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::DeregisterTaskDefinitionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::DeregisterTaskDefinitionAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterTaskDefinitionOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::DeregisterTaskDefinitionAsync(DeregisterTaskDefinitionRequest&& request, const DeregisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::DeregisterTaskDefinitionAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterTaskDefinitionOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::DeregisterTaskDefinitionAsyncHelper(const DeregisterTaskDefinitionRequest& request, const DeregisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -320,12 +380,22 @@ DescribeClustersOutcome ECSClient::DescribeClusters(const DescribeClustersReques
 
 DescribeClustersOutcomeCallable ECSClient::DescribeClustersCallable(const DescribeClustersRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::DescribeClusters, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::DescribeClusters, Aws::Client::RejectedCallOutcome<DescribeClustersOutcome>(), this, request);
+}
+
+DescribeClustersOutcomeCallable ECSClient::DescribeClustersCallable(DescribeClustersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::DescribeClusters, Aws::Client::RejectedCallOutcome<DescribeClustersOutcome>(), this, std::move(request));
 }
 
 void ECSClient::DescribeClustersAsync(const DescribeClustersRequest& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::DescribeClustersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::DescribeClustersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClustersOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::DescribeClustersAsync(DescribeClustersRequest&& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::DescribeClustersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClustersOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::DescribeClustersAsyncHelper(const DescribeClustersRequest& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -351,12 +421,22 @@ DescribeContainerInstancesOutcome ECSClient::DescribeContainerInstances(const De
 
 DescribeContainerInstancesOutcomeCallable ECSClient::DescribeContainerInstancesCallable(const DescribeContainerInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::DescribeContainerInstances, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::DescribeContainerInstances, Aws::Client::RejectedCallOutcome<DescribeContainerInstancesOutcome>(), this, request);
+}
+
+DescribeContainerInstancesOutcomeCallable ECSClient::DescribeContainerInstancesCallable(DescribeContainerInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::DescribeContainerInstances, Aws::Client::RejectedCallOutcome<DescribeContainerInstancesOutcome>(), this, std::move(request));
 }
 
 void ECSClient::DescribeContainerInstancesAsync(const DescribeContainerInstancesRequest& request, const DescribeContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::DescribeContainerInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::DescribeContainerInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeContainerInstancesOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::DescribeContainerInstancesAsync(DescribeContainerInstancesRequest&& request, const DescribeContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::DescribeContainerInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeContainerInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::DescribeContainerInstancesAsyncHelper(const DescribeContainerInstancesRequest& request, const DescribeContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -382,12 +462,22 @@ DescribeServicesOutcome ECSClient::DescribeServices(const DescribeServicesReques
 
 DescribeServicesOutcomeCallable ECSClient::DescribeServicesCallable(const DescribeServicesRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::DescribeServices, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::DescribeServices, Aws::Client::RejectedCallOutcome<DescribeServicesOutcome>(), this, request);
+}
+
+DescribeServicesOutcomeCallable ECSClient::DescribeServicesCallable(DescribeServicesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::DescribeServices, Aws::Client::RejectedCallOutcome<DescribeServicesOutcome>(), this, std::move(request));
 }
 
 void ECSClient::DescribeServicesAsync(const DescribeServicesRequest& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::DescribeServicesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::DescribeServicesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeServicesOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::DescribeServicesAsync(DescribeServicesRequest&& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::DescribeServicesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeServicesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::DescribeServicesAsyncHelper(const DescribeServicesRequest& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -413,12 +503,22 @@ DescribeTaskDefinitionOutcome ECSClient::DescribeTaskDefinition(const DescribeTa
 
 DescribeTaskDefinitionOutcomeCallable ECSClient::DescribeTaskDefinitionCallable(const DescribeTaskDefinitionRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::DescribeTaskDefinition, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::DescribeTaskDefinition, Aws::Client::RejectedCallOutcome<DescribeTaskDefinitionOutcome>(), this, request);
+}
+
+DescribeTaskDefinitionOutcomeCallable ECSClient::DescribeTaskDefinitionCallable(DescribeTaskDefinitionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::DescribeTaskDefinition, Aws::Client::RejectedCallOutcome<DescribeTaskDefinitionOutcome>(), this, std::move(request));
 }
 
 void ECSClient::DescribeTaskDefinitionAsync(const DescribeTaskDefinitionRequest& request, const DescribeTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::DescribeTaskDefinitionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::DescribeTaskDefinitionAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTaskDefinitionOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::DescribeTaskDefinitionAsync(DescribeTaskDefinitionRequest&& request, const DescribeTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::DescribeTaskDefinitionAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTaskDefinitionOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::DescribeTaskDefinitionAsyncHelper(const DescribeTaskDefinitionRequest& request, const DescribeTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -444,12 +544,22 @@ DescribeTasksOutcome ECSClient::DescribeTasks(const DescribeTasksRequest& reques
 
 DescribeTasksOutcomeCallable ECSClient::DescribeTasksCallable(const DescribeTasksRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::DescribeTasks, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::DescribeTasks, Aws::Client::RejectedCallOutcome<DescribeTasksOutcome>(), this, request);
+}
+
+DescribeTasksOutcomeCallable ECSClient::DescribeTasksCallable(DescribeTasksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::DescribeTasks, Aws::Client::RejectedCallOutcome<DescribeTasksOutcome>(), this, std::move(request));
 }
 
 void ECSClient::DescribeTasksAsync(const DescribeTasksRequest& request, const DescribeTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::DescribeTasksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::DescribeTasksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTasksOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::DescribeTasksAsync(DescribeTasksRequest&& request, const DescribeTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::DescribeTasksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTasksOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::DescribeTasksAsyncHelper(const DescribeTasksRequest& request, const DescribeTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -475,12 +585,22 @@ DiscoverPollEndpointOutcome ECSClient::DiscoverPollEndpoint(const DiscoverPollEn
 
 DiscoverPollEndpointOutcomeCallable ECSClient::DiscoverPollEndpointCallable(const DiscoverPollEndpointRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::DiscoverPollEndpoint, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::DiscoverPollEndpoint, Aws::Client::RejectedCallOutcome<DiscoverPollEndpointOutcome>(), this, request);
+}
+
+DiscoverPollEndpointOutcomeCallable ECSClient::DiscoverPollEndpointCallable(DiscoverPollEndpointRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::DiscoverPollEndpoint, Aws::Client::RejectedCallOutcome<DiscoverPollEndpointOutcome>(), this, std::move(request));
 }
 
 void ECSClient::DiscoverPollEndpointAsync(const DiscoverPollEndpointRequest& request, const DiscoverPollEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::DiscoverPollEndpointAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::DiscoverPollEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<DiscoverPollEndpointOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::DiscoverPollEndpointAsync(DiscoverPollEndpointRequest&& request, const DiscoverPollEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::DiscoverPollEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<DiscoverPollEndpointOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::DiscoverPollEndpointAsyncHelper(const DiscoverPollEndpointRequest& request, const DiscoverPollEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -506,12 +626,22 @@ ListClustersOutcome ECSClient::ListClusters(const ListClustersRequest& request)
 
 ListClustersOutcomeCallable ECSClient::ListClustersCallable(const ListClustersRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::ListClusters, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::ListClusters, Aws::Client::RejectedCallOutcome<ListClustersOutcome>(), this, request);
+}
+
+ListClustersOutcomeCallable ECSClient::ListClustersCallable(ListClustersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::ListClusters, Aws::Client::RejectedCallOutcome<ListClustersOutcome>(), this, std::move(request));
 }
 
 void ECSClient::ListClustersAsync(const ListClustersRequest& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::ListClustersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::ListClustersAsyncHelper, Aws::Client::RejectedAsyncCall<ListClustersOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::ListClustersAsync(ListClustersRequest&& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::ListClustersAsyncHelper, Aws::Client::RejectedAsyncCall<ListClustersOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::ListClustersAsyncHelper(const ListClustersRequest& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -537,12 +667,22 @@ ListContainerInstancesOutcome ECSClient::ListContainerInstances(const ListContai
 
 ListContainerInstancesOutcomeCallable ECSClient::ListContainerInstancesCallable(const ListContainerInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::ListContainerInstances, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::ListContainerInstances, Aws::Client::RejectedCallOutcome<ListContainerInstancesOutcome>(), this, request);
+}
+
+ListContainerInstancesOutcomeCallable ECSClient::ListContainerInstancesCallable(ListContainerInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::ListContainerInstances, Aws::Client::RejectedCallOutcome<ListContainerInstancesOutcome>(), this, std::move(request));
 }
 
 void ECSClient::ListContainerInstancesAsync(const ListContainerInstancesRequest& request, const ListContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::ListContainerInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::ListContainerInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<ListContainerInstancesOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::ListContainerInstancesAsync(ListContainerInstancesRequest&& request, const ListContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::ListContainerInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<ListContainerInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::ListContainerInstancesAsyncHelper(const ListContainerInstancesRequest& request, const ListContainerInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -568,12 +708,22 @@ ListServicesOutcome ECSClient::ListServices(const ListServicesRequest& request)
 
 ListServicesOutcomeCallable ECSClient::ListServicesCallable(const ListServicesRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::ListServices, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::ListServices, Aws::Client::RejectedCallOutcome<ListServicesOutcome>(), this, request);
+}
+
+ListServicesOutcomeCallable ECSClient::ListServicesCallable(ListServicesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::ListServices, Aws::Client::RejectedCallOutcome<ListServicesOutcome>(), this, std::move(request));
 }
 
 void ECSClient::ListServicesAsync(const ListServicesRequest& request, const ListServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::ListServicesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::ListServicesAsyncHelper, Aws::Client::RejectedAsyncCall<ListServicesOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::ListServicesAsync(ListServicesRequest&& request, const ListServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::ListServicesAsyncHelper, Aws::Client::RejectedAsyncCall<ListServicesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::ListServicesAsyncHelper(const ListServicesRequest& request, const ListServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -599,12 +749,22 @@ ListTaskDefinitionFamiliesOutcome ECSClient::ListTaskDefinitionFamilies(const Li
 
 ListTaskDefinitionFamiliesOutcomeCallable ECSClient::ListTaskDefinitionFamiliesCallable(const ListTaskDefinitionFamiliesRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::ListTaskDefinitionFamilies, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::ListTaskDefinitionFamilies, Aws::Client::RejectedCallOutcome<ListTaskDefinitionFamiliesOutcome>(), this, request);
+}
+
+ListTaskDefinitionFamiliesOutcomeCallable ECSClient::ListTaskDefinitionFamiliesCallable(ListTaskDefinitionFamiliesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::ListTaskDefinitionFamilies, Aws::Client::RejectedCallOutcome<ListTaskDefinitionFamiliesOutcome>(), this, std::move(request));
 }
 
 void ECSClient::ListTaskDefinitionFamiliesAsync(const ListTaskDefinitionFamiliesRequest& request, const ListTaskDefinitionFamiliesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::ListTaskDefinitionFamiliesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::ListTaskDefinitionFamiliesAsyncHelper, Aws::Client::RejectedAsyncCall<ListTaskDefinitionFamiliesOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::ListTaskDefinitionFamiliesAsync(ListTaskDefinitionFamiliesRequest&& request, const ListTaskDefinitionFamiliesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::ListTaskDefinitionFamiliesAsyncHelper, Aws::Client::RejectedAsyncCall<ListTaskDefinitionFamiliesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::ListTaskDefinitionFamiliesAsyncHelper(const ListTaskDefinitionFamiliesRequest& request, const ListTaskDefinitionFamiliesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -630,12 +790,22 @@ ListTaskDefinitionsOutcome ECSClient::ListTaskDefinitions(const ListTaskDefiniti
 
 ListTaskDefinitionsOutcomeCallable ECSClient::ListTaskDefinitionsCallable(const ListTaskDefinitionsRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::ListTaskDefinitions, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::ListTaskDefinitions, Aws::Client::RejectedCallOutcome<ListTaskDefinitionsOutcome>(), this, request);
+}
+
+ListTaskDefinitionsOutcomeCallable ECSClient::ListTaskDefinitionsCallable(ListTaskDefinitionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::ListTaskDefinitions, Aws::Client::RejectedCallOutcome<ListTaskDefinitionsOutcome>(), this, std::move(request));
 }
 
 void ECSClient::ListTaskDefinitionsAsync(const ListTaskDefinitionsRequest& request, const ListTaskDefinitionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::ListTaskDefinitionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::ListTaskDefinitionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListTaskDefinitionsOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::ListTaskDefinitionsAsync(ListTaskDefinitionsRequest&& request, const ListTaskDefinitionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::ListTaskDefinitionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListTaskDefinitionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::ListTaskDefinitionsAsyncHelper(const ListTaskDefinitionsRequest& request, const ListTaskDefinitionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -661,12 +831,22 @@ ListTasksOutcome ECSClient::ListTasks(const ListTasksRequest& request) const
 
 ListTasksOutcomeCallable ECSClient::ListTasksCallable(const ListTasksRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::ListTasks, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::ListTasks, Aws::Client::RejectedCallOutcome<ListTasksOutcome>(), this, request);
+}
+
+ListTasksOutcomeCallable ECSClient::ListTasksCallable(ListTasksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::ListTasks, Aws::Client::RejectedCallOutcome<ListTasksOutcome>(), this, std::move(request));
 }
 
 void ECSClient::ListTasksAsync(const ListTasksRequest& request, const ListTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::ListTasksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::ListTasksAsyncHelper, Aws::Client::RejectedAsyncCall<ListTasksOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::ListTasksAsync(ListTasksRequest&& request, const ListTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::ListTasksAsyncHelper, Aws::Client::RejectedAsyncCall<ListTasksOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::ListTasksAsyncHelper(const ListTasksRequest& request, const ListTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -692,12 +872,22 @@ RegisterContainerInstanceOutcome ECSClient::RegisterContainerInstance(const Regi
 
 RegisterContainerInstanceOutcomeCallable ECSClient::RegisterContainerInstanceCallable(const RegisterContainerInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::RegisterContainerInstance, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::RegisterContainerInstance, Aws::Client::RejectedCallOutcome<RegisterContainerInstanceOutcome>(), this, request);
+}
+
+RegisterContainerInstanceOutcomeCallable ECSClient::RegisterContainerInstanceCallable(RegisterContainerInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::RegisterContainerInstance, Aws::Client::RejectedCallOutcome<RegisterContainerInstanceOutcome>(), this, std::move(request));
 }
 
 void ECSClient::RegisterContainerInstanceAsync(const RegisterContainerInstanceRequest& request, const RegisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::RegisterContainerInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::RegisterContainerInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterContainerInstanceOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::RegisterContainerInstanceAsync(RegisterContainerInstanceRequest&& request, const RegisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::RegisterContainerInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterContainerInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::RegisterContainerInstanceAsyncHelper(const RegisterContainerInstanceRequest& request, const RegisterContainerInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -723,12 +913,22 @@ RegisterTaskDefinitionOutcome ECSClient::RegisterTaskDefinition(const RegisterTa
 
 RegisterTaskDefinitionOutcomeCallable ECSClient::RegisterTaskDefinitionCallable(const RegisterTaskDefinitionRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::RegisterTaskDefinition, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::RegisterTaskDefinition, Aws::Client::RejectedCallOutcome<RegisterTaskDefinitionOutcome>(), this, request);
+}
+
+RegisterTaskDefinitionOutcomeCallable ECSClient::RegisterTaskDefinitionCallable(RegisterTaskDefinitionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::RegisterTaskDefinition, Aws::Client::RejectedCallOutcome<RegisterTaskDefinitionOutcome>(), this, std::move(request));
 }
 
 void ECSClient::RegisterTaskDefinitionAsync(const RegisterTaskDefinitionRequest& request, const RegisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::RegisterTaskDefinitionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::RegisterTaskDefinitionAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterTaskDefinitionOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::RegisterTaskDefinitionAsync(RegisterTaskDefinitionRequest&& request, const RegisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::RegisterTaskDefinitionAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterTaskDefinitionOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::RegisterTaskDefinitionAsyncHelper(const RegisterTaskDefinitionRequest& request, const RegisterTaskDefinitionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -754,12 +954,22 @@ RunTaskOutcome ECSClient::RunTask(const RunTaskRequest& request) const
 
 RunTaskOutcomeCallable ECSClient::RunTaskCallable(const RunTaskRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::RunTask, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::RunTask, Aws::Client::RejectedCallOutcome<RunTaskOutcome>(), this, request);
+}
+
+RunTaskOutcomeCallable ECSClient::RunTaskCallable(RunTaskRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::RunTask, Aws::Client::RejectedCallOutcome<RunTaskOutcome>(), this, std::move(request));
 }
 
 void ECSClient::RunTaskAsync(const RunTaskRequest& request, const RunTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::RunTaskAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::RunTaskAsyncHelper, Aws::Client::RejectedAsyncCall<RunTaskOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::RunTaskAsync(RunTaskRequest&& request, const RunTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::RunTaskAsyncHelper, Aws::Client::RejectedAsyncCall<RunTaskOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::RunTaskAsyncHelper(const RunTaskRequest& request, const RunTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -785,12 +995,22 @@ StartTaskOutcome ECSClient::StartTask(const StartTaskRequest& request) const
 
 StartTaskOutcomeCallable ECSClient::StartTaskCallable(const StartTaskRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::StartTask, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::StartTask, Aws::Client::RejectedCallOutcome<StartTaskOutcome>(), this, request);
+}
+
+StartTaskOutcomeCallable ECSClient::StartTaskCallable(StartTaskRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::StartTask, Aws::Client::RejectedCallOutcome<StartTaskOutcome>(), this, std::move(request));
 }
 
 void ECSClient::StartTaskAsync(const StartTaskRequest& request, const StartTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::StartTaskAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::StartTaskAsyncHelper, Aws::Client::RejectedAsyncCall<StartTaskOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::StartTaskAsync(StartTaskRequest&& request, const StartTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::StartTaskAsyncHelper, Aws::Client::RejectedAsyncCall<StartTaskOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::StartTaskAsyncHelper(const StartTaskRequest& request, const StartTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -816,12 +1036,22 @@ StopTaskOutcome ECSClient::StopTask(const StopTaskRequest& request) const
 
 StopTaskOutcomeCallable ECSClient::StopTaskCallable(const StopTaskRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::StopTask, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::StopTask, Aws::Client::RejectedCallOutcome<StopTaskOutcome>(), this, request);
+}
+
+StopTaskOutcomeCallable ECSClient::StopTaskCallable(StopTaskRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::StopTask, Aws::Client::RejectedCallOutcome<StopTaskOutcome>(), this, std::move(request));
 }
 
 void ECSClient::StopTaskAsync(const StopTaskRequest& request, const StopTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::StopTaskAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::StopTaskAsyncHelper, Aws::Client::RejectedAsyncCall<StopTaskOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::StopTaskAsync(StopTaskRequest&& request, const StopTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::StopTaskAsyncHelper, Aws::Client::RejectedAsyncCall<StopTaskOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::StopTaskAsyncHelper(const StopTaskRequest& request, const StopTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -847,12 +1077,22 @@ SubmitContainerStateChangeOutcome ECSClient::SubmitContainerStateChange(const Su
 
 SubmitContainerStateChangeOutcomeCallable ECSClient::SubmitContainerStateChangeCallable(const SubmitContainerStateChangeRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::SubmitContainerStateChange, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::SubmitContainerStateChange, Aws::Client::RejectedCallOutcome<SubmitContainerStateChangeOutcome>(), this, request);
+}
+
+SubmitContainerStateChangeOutcomeCallable ECSClient::SubmitContainerStateChangeCallable(SubmitContainerStateChangeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::SubmitContainerStateChange, Aws::Client::RejectedCallOutcome<SubmitContainerStateChangeOutcome>(), this, std::move(request));
 }
 
 void ECSClient::SubmitContainerStateChangeAsync(const SubmitContainerStateChangeRequest& request, const SubmitContainerStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::SubmitContainerStateChangeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::SubmitContainerStateChangeAsyncHelper, Aws::Client::RejectedAsyncCall<SubmitContainerStateChangeOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::SubmitContainerStateChangeAsync(SubmitContainerStateChangeRequest&& request, const SubmitContainerStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::SubmitContainerStateChangeAsyncHelper, Aws::Client::RejectedAsyncCall<SubmitContainerStateChangeOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::SubmitContainerStateChangeAsyncHelper(const SubmitContainerStateChangeRequest& request, const SubmitContainerStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -878,12 +1118,22 @@ SubmitTaskStateChangeOutcome ECSClient::SubmitTaskStateChange(const SubmitTaskSt
 
 SubmitTaskStateChangeOutcomeCallable ECSClient::SubmitTaskStateChangeCallable(const SubmitTaskStateChangeRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::SubmitTaskStateChange, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::SubmitTaskStateChange, Aws::Client::RejectedCallOutcome<SubmitTaskStateChangeOutcome>(), this, request);
+}
+
+SubmitTaskStateChangeOutcomeCallable ECSClient::SubmitTaskStateChangeCallable(SubmitTaskStateChangeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::SubmitTaskStateChange, Aws::Client::RejectedCallOutcome<SubmitTaskStateChangeOutcome>(), this, std::move(request));
 }
 
 void ECSClient::SubmitTaskStateChangeAsync(const SubmitTaskStateChangeRequest& request, const SubmitTaskStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::SubmitTaskStateChangeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::SubmitTaskStateChangeAsyncHelper, Aws::Client::RejectedAsyncCall<SubmitTaskStateChangeOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::SubmitTaskStateChangeAsync(SubmitTaskStateChangeRequest&& request, const SubmitTaskStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::SubmitTaskStateChangeAsyncHelper, Aws::Client::RejectedAsyncCall<SubmitTaskStateChangeOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::SubmitTaskStateChangeAsyncHelper(const SubmitTaskStateChangeRequest& request, const SubmitTaskStateChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -909,12 +1159,22 @@ UpdateContainerAgentOutcome ECSClient::UpdateContainerAgent(const UpdateContaine
 
 UpdateContainerAgentOutcomeCallable ECSClient::UpdateContainerAgentCallable(const UpdateContainerAgentRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::UpdateContainerAgent, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::UpdateContainerAgent, Aws::Client::RejectedCallOutcome<UpdateContainerAgentOutcome>(), this, request);
+}
+
+UpdateContainerAgentOutcomeCallable ECSClient::UpdateContainerAgentCallable(UpdateContainerAgentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::UpdateContainerAgent, Aws::Client::RejectedCallOutcome<UpdateContainerAgentOutcome>(), this, std::move(request));
 }
 
 void ECSClient::UpdateContainerAgentAsync(const UpdateContainerAgentRequest& request, const UpdateContainerAgentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::UpdateContainerAgentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::UpdateContainerAgentAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateContainerAgentOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::UpdateContainerAgentAsync(UpdateContainerAgentRequest&& request, const UpdateContainerAgentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::UpdateContainerAgentAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateContainerAgentOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::UpdateContainerAgentAsyncHelper(const UpdateContainerAgentRequest& request, const UpdateContainerAgentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -940,12 +1200,22 @@ UpdateServiceOutcome ECSClient::UpdateService(const UpdateServiceRequest& reques
 
 UpdateServiceOutcomeCallable ECSClient::UpdateServiceCallable(const UpdateServiceRequest& request) const
 {
-  return std::async(std::launch::async, &ECSClient::UpdateService, this, request);
+  return m_executor->SubmitWithFuture(&ECSClient::UpdateService, Aws::Client::RejectedCallOutcome<UpdateServiceOutcome>(), this, request);
+}
+
+UpdateServiceOutcomeCallable ECSClient::UpdateServiceCallable(UpdateServiceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ECSClient::UpdateService, Aws::Client::RejectedCallOutcome<UpdateServiceOutcome>(), this, std::move(request));
 }
 
 void ECSClient::UpdateServiceAsync(const UpdateServiceRequest& request, const UpdateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ECSClient::UpdateServiceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ECSClient::UpdateServiceAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateServiceOutcome>(), this, request, handler, context);
+}
+
+void ECSClient::UpdateServiceAsync(UpdateServiceRequest&& request, const UpdateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ECSClient::UpdateServiceAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateServiceOutcome>(), this, std::move(request), handler, context);
 }
 
 void ECSClient::UpdateServiceAsyncHelper(const UpdateServiceRequest& request, const UpdateServiceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
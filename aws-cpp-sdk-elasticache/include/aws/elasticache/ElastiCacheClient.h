@@ -57,6 +57,47 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/elasticache/model/AddTagsToResourceRequest.h>
+#include <aws/elasticache/model/AuthorizeCacheSecurityGroupIngressRequest.h>
+#include <aws/elasticache/model/CopySnapshotRequest.h>
+#include <aws/elasticache/model/CreateCacheClusterRequest.h>
+#include <aws/elasticache/model/CreateCacheParameterGroupRequest.h>
+#include <aws/elasticache/model/CreateCacheSecurityGroupRequest.h>
+#include <aws/elasticache/model/CreateCacheSubnetGroupRequest.h>
+#include <aws/elasticache/model/CreateReplicationGroupRequest.h>
+#include <aws/elasticache/model/CreateSnapshotRequest.h>
+#include <aws/elasticache/model/DeleteCacheClusterRequest.h>
+#include <aws/elasticache/model/DeleteCacheParameterGroupRequest.h>
+#include <aws/elasticache/model/DeleteCacheSecurityGroupRequest.h>
+#include <aws/elasticache/model/DeleteCacheSubnetGroupRequest.h>
+#include <aws/elasticache/model/DeleteReplicationGroupRequest.h>
+#include <aws/elasticache/model/DeleteSnapshotRequest.h>
+#include <aws/elasticache/model/DescribeCacheClustersRequest.h>
+#include <aws/elasticache/model/DescribeCacheEngineVersionsRequest.h>
+#include <aws/elasticache/model/DescribeCacheParameterGroupsRequest.h>
+#include <aws/elasticache/model/DescribeCacheParametersRequest.h>
+#include <aws/elasticache/model/DescribeCacheSecurityGroupsRequest.h>
+#include <aws/elasticache/model/DescribeCacheSubnetGroupsRequest.h>
+#include <aws/elasticache/model/DescribeEngineDefaultParametersRequest.h>
+#include <aws/elasticache/model/DescribeEventsRequest.h>
+#include <aws/elasticache/model/DescribeReplicationGroupsRequest.h>
+#include <aws/elasticache/model/DescribeReservedCacheNodesRequest.h>
+#include <aws/elasticache/model/DescribeReservedCacheNodesOfferingsRequest.h>
+#include <aws/elasticache/model/DescribeSnapshotsRequest.h>
+#include <aws/elasticache/model/ListTagsForResourceRequest.h>
+#include <aws/elasticache/model/ModifyCacheClusterRequest.h>
+#include <aws/elasticache/model/ModifyCacheParameterGroupRequest.h>
+#include <aws/elasticache/model/ModifyCacheSubnetGroupRequest.h>
+#include <aws/elasticache/model/ModifyReplicationGroupRequest.h>
+#include <aws/elasticache/model/PurchaseReservedCacheNodesOfferingRequest.h>
+#include <aws/elasticache/model/RebootCacheClusterRequest.h>
+#include <aws/elasticache/model/RemoveTagsFromResourceRequest.h>
+#include <aws/elasticache/model/ResetCacheParameterGroupRequest.h>
+#include <aws/elasticache/model/RevokeCacheSecurityGroupIngressRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -325,6 +366,11 @@ namespace Model
          */
         virtual Model::AddTagsToResourceOutcomeCallable AddTagsToResourceCallable(const Model::AddTagsToResourceRequest& request) const;
 
+        /**
+         * Same as AddTagsToResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddTagsToResourceOutcomeCallable AddTagsToResourceCallable(Model::AddTagsToResourceRequest&& request) const;
+
         /**
          * <p>The <i>AddTagsToResource</i> action adds up to 10 cost allocation tags to the
          * named resource. A <i>cost allocation tag</i> is a key-value pair where the key
@@ -342,6 +388,11 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddTagsToResourceAsync(Model::AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>AuthorizeCacheSecurityGroupIngress</i> action allows network ingress
          * to a cache security group. Applications using ElastiCache must be running on
@@ -362,6 +413,11 @@ namespace Model
          */
         virtual Model::AuthorizeCacheSecurityGroupIngressOutcomeCallable AuthorizeCacheSecurityGroupIngressCallable(const Model::AuthorizeCacheSecurityGroupIngressRequest& request) const;
 
+        /**
+         * Same as AuthorizeCacheSecurityGroupIngressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AuthorizeCacheSecurityGroupIngressOutcomeCallable AuthorizeCacheSecurityGroupIngressCallable(Model::AuthorizeCacheSecurityGroupIngressRequest&& request) const;
+
         /**
          * <p>The <i>AuthorizeCacheSecurityGroupIngress</i> action allows network ingress
          * to a cache security group. Applications using ElastiCache must be running on
@@ -373,6 +429,11 @@ namespace Model
          */
         virtual void AuthorizeCacheSecurityGroupIngressAsync(const Model::AuthorizeCacheSecurityGroupIngressRequest& request, const AuthorizeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AuthorizeCacheSecurityGroupIngressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AuthorizeCacheSecurityGroupIngressAsync(Model::AuthorizeCacheSecurityGroupIngressRequest&& request, const AuthorizeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CopySnapshot</i> action makes a copy of an existing snapshot.</p>
          */
@@ -385,6 +446,11 @@ namespace Model
          */
         virtual Model::CopySnapshotOutcomeCallable CopySnapshotCallable(const Model::CopySnapshotRequest& request) const;
 
+        /**
+         * Same as CopySnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CopySnapshotOutcomeCallable CopySnapshotCallable(Model::CopySnapshotRequest&& request) const;
+
         /**
          * <p>The <i>CopySnapshot</i> action makes a copy of an existing snapshot.</p>
          *
@@ -392,6 +458,11 @@ namespace Model
          */
         virtual void CopySnapshotAsync(const Model::CopySnapshotRequest& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopySnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CopySnapshotAsync(Model::CopySnapshotRequest&& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CreateCacheCluster</i> action creates a cache cluster. All nodes in
          * the cache cluster run the same protocol-compliant cache engine software, either
@@ -408,6 +479,11 @@ namespace Model
          */
         virtual Model::CreateCacheClusterOutcomeCallable CreateCacheClusterCallable(const Model::CreateCacheClusterRequest& request) const;
 
+        /**
+         * Same as CreateCacheClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateCacheClusterOutcomeCallable CreateCacheClusterCallable(Model::CreateCacheClusterRequest&& request) const;
+
         /**
          * <p>The <i>CreateCacheCluster</i> action creates a cache cluster. All nodes in
          * the cache cluster run the same protocol-compliant cache engine software, either
@@ -417,6 +493,11 @@ namespace Model
          */
         virtual void CreateCacheClusterAsync(const Model::CreateCacheClusterRequest& request, const CreateCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCacheClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateCacheClusterAsync(Model::CreateCacheClusterRequest&& request, const CreateCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CreateCacheParameterGroup</i> action creates a new cache parameter
          * group. A cache parameter group is a collection of parameters that you apply to
@@ -433,6 +514,11 @@ namespace Model
          */
         virtual Model::CreateCacheParameterGroupOutcomeCallable CreateCacheParameterGroupCallable(const Model::CreateCacheParameterGroupRequest& request) const;
 
+        /**
+         * Same as CreateCacheParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateCacheParameterGroupOutcomeCallable CreateCacheParameterGroupCallable(Model::CreateCacheParameterGroupRequest&& request) const;
+
         /**
          * <p>The <i>CreateCacheParameterGroup</i> action creates a new cache parameter
          * group. A cache parameter group is a collection of parameters that you apply to
@@ -442,6 +528,11 @@ namespace Model
          */
         virtual void CreateCacheParameterGroupAsync(const Model::CreateCacheParameterGroupRequest& request, const CreateCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCacheParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateCacheParameterGroupAsync(Model::CreateCacheParameterGroupRequest&& request, const CreateCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CreateCacheSecurityGroup</i> action creates a new cache security
          * group. Use a cache security group to control access to one or more cache
@@ -466,6 +557,11 @@ namespace Model
          */
         virtual Model::CreateCacheSecurityGroupOutcomeCallable CreateCacheSecurityGroupCallable(const Model::CreateCacheSecurityGroupRequest& request) const;
 
+        /**
+         * Same as CreateCacheSecurityGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateCacheSecurityGroupOutcomeCallable CreateCacheSecurityGroupCallable(Model::CreateCacheSecurityGroupRequest&& request) const;
+
         /**
          * <p>The <i>CreateCacheSecurityGroup</i> action creates a new cache security
          * group. Use a cache security group to control access to one or more cache
@@ -479,6 +575,11 @@ namespace Model
          */
         virtual void CreateCacheSecurityGroupAsync(const Model::CreateCacheSecurityGroupRequest& request, const CreateCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCacheSecurityGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateCacheSecurityGroupAsync(Model::CreateCacheSecurityGroupRequest&& request, const CreateCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CreateCacheSubnetGroup</i> action creates a new cache subnet
          * group.</p> <p>Use this parameter only when you are creating a cluster in an
@@ -495,6 +596,11 @@ namespace Model
          */
         virtual Model::CreateCacheSubnetGroupOutcomeCallable CreateCacheSubnetGroupCallable(const Model::CreateCacheSubnetGroupRequest& request) const;
 
+        /**
+         * Same as CreateCacheSubnetGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateCacheSubnetGroupOutcomeCallable CreateCacheSubnetGroupCallable(Model::CreateCacheSubnetGroupRequest&& request) const;
+
         /**
          * <p>The <i>CreateCacheSubnetGroup</i> action creates a new cache subnet
          * group.</p> <p>Use this parameter only when you are creating a cluster in an
@@ -504,6 +610,11 @@ namespace Model
          */
         virtual void CreateCacheSubnetGroupAsync(const Model::CreateCacheSubnetGroupRequest& request, const CreateCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCacheSubnetGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateCacheSubnetGroupAsync(Model::CreateCacheSubnetGroupRequest&& request, const CreateCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CreateReplicationGroup</i> action creates a replication group. A
          * replication group is a collection of cache clusters, where one of the cache
@@ -530,6 +641,11 @@ namespace Model
          */
         virtual Model::CreateReplicationGroupOutcomeCallable CreateReplicationGroupCallable(const Model::CreateReplicationGroupRequest& request) const;
 
+        /**
+         * Same as CreateReplicationGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateReplicationGroupOutcomeCallable CreateReplicationGroupCallable(Model::CreateReplicationGroupRequest&& request) const;
+
         /**
          * <p>The <i>CreateReplicationGroup</i> action creates a replication group. A
          * replication group is a collection of cache clusters, where one of the cache
@@ -544,6 +660,11 @@ namespace Model
          */
         virtual void CreateReplicationGroupAsync(const Model::CreateReplicationGroupRequest& request, const CreateReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReplicationGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateReplicationGroupAsync(Model::CreateReplicationGroupRequest&& request, const CreateReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>CreateSnapshot</i> action creates a copy of an entire cache cluster at
          * a specific moment in time.</p>
@@ -558,6 +679,11 @@ namespace Model
          */
         virtual Model::CreateSnapshotOutcomeCallable CreateSnapshotCallable(const Model::CreateSnapshotRequest& request) const;
 
+        /**
+         * Same as CreateSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateSnapshotOutcomeCallable CreateSnapshotCallable(Model::CreateSnapshotRequest&& request) const;
+
         /**
          * <p>The <i>CreateSnapshot</i> action creates a copy of an entire cache cluster at
          * a specific moment in time.</p>
@@ -566,6 +692,11 @@ namespace Model
          */
         virtual void CreateSnapshotAsync(const Model::CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateSnapshotAsync(Model::CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DeleteCacheCluster</i> action deletes a previously provisioned cache
          * cluster. <i>DeleteCacheCluster</i> deletes all associated cache nodes, node
@@ -590,6 +721,11 @@ namespace Model
          */
         virtual Model::DeleteCacheClusterOutcomeCallable DeleteCacheClusterCallable(const Model::DeleteCacheClusterRequest& request) const;
 
+        /**
+         * Same as DeleteCacheClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteCacheClusterOutcomeCallable DeleteCacheClusterCallable(Model::DeleteCacheClusterRequest&& request) const;
+
         /**
          * <p>The <i>DeleteCacheCluster</i> action deletes a previously provisioned cache
          * cluster. <i>DeleteCacheCluster</i> deletes all associated cache nodes, node
@@ -603,6 +739,11 @@ namespace Model
          */
         virtual void DeleteCacheClusterAsync(const Model::DeleteCacheClusterRequest& request, const DeleteCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCacheClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteCacheClusterAsync(Model::DeleteCacheClusterRequest&& request, const DeleteCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DeleteCacheParameterGroup</i> action deletes the specified cache
          * parameter group. You cannot delete a cache parameter group if it is associated
@@ -619,6 +760,11 @@ namespace Model
          */
         virtual Model::DeleteCacheParameterGroupOutcomeCallable DeleteCacheParameterGroupCallable(const Model::DeleteCacheParameterGroupRequest& request) const;
 
+        /**
+         * Same as DeleteCacheParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteCacheParameterGroupOutcomeCallable DeleteCacheParameterGroupCallable(Model::DeleteCacheParameterGroupRequest&& request) const;
+
         /**
          * <p>The <i>DeleteCacheParameterGroup</i> action deletes the specified cache
          * parameter group. You cannot delete a cache parameter group if it is associated
@@ -628,6 +774,11 @@ namespace Model
          */
         virtual void DeleteCacheParameterGroupAsync(const Model::DeleteCacheParameterGroupRequest& request, const DeleteCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCacheParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteCacheParameterGroupAsync(Model::DeleteCacheParameterGroupRequest&& request, const DeleteCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DeleteCacheSecurityGroup</i> action deletes a cache security
          * group.</p> <note>You cannot delete a cache security group if it is associated
@@ -644,6 +795,11 @@ namespace Model
          */
         virtual Model::DeleteCacheSecurityGroupOutcomeCallable DeleteCacheSecurityGroupCallable(const Model::DeleteCacheSecurityGroupRequest& request) const;
 
+        /**
+         * Same as DeleteCacheSecurityGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteCacheSecurityGroupOutcomeCallable DeleteCacheSecurityGroupCallable(Model::DeleteCacheSecurityGroupRequest&& request) const;
+
         /**
          * <p>The <i>DeleteCacheSecurityGroup</i> action deletes a cache security
          * group.</p> <note>You cannot delete a cache security group if it is associated
@@ -653,6 +809,11 @@ namespace Model
          */
         virtual void DeleteCacheSecurityGroupAsync(const Model::DeleteCacheSecurityGroupRequest& request, const DeleteCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCacheSecurityGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteCacheSecurityGroupAsync(Model::DeleteCacheSecurityGroupRequest&& request, const DeleteCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DeleteCacheSubnetGroup</i> action deletes a cache subnet group.</p>
          * <note>You cannot delete a cache subnet group if it is associated with any cache
@@ -669,6 +830,11 @@ namespace Model
          */
         virtual Model::DeleteCacheSubnetGroupOutcomeCallable DeleteCacheSubnetGroupCallable(const Model::DeleteCacheSubnetGroupRequest& request) const;
 
+        /**
+         * Same as DeleteCacheSubnetGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteCacheSubnetGroupOutcomeCallable DeleteCacheSubnetGroupCallable(Model::DeleteCacheSubnetGroupRequest&& request) const;
+
         /**
          * <p>The <i>DeleteCacheSubnetGroup</i> action deletes a cache subnet group.</p>
          * <note>You cannot delete a cache subnet group if it is associated with any cache
@@ -678,6 +844,11 @@ namespace Model
          */
         virtual void DeleteCacheSubnetGroupAsync(const Model::DeleteCacheSubnetGroupRequest& request, const DeleteCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCacheSubnetGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteCacheSubnetGroupAsync(Model::DeleteCacheSubnetGroupRequest&& request, const DeleteCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DeleteReplicationGroup</i> action deletes an existing replication
          * group. By default, this action deletes the entire replication group, including
@@ -700,6 +871,11 @@ namespace Model
          */
         virtual Model::DeleteReplicationGroupOutcomeCallable DeleteReplicationGroupCallable(const Model::DeleteReplicationGroupRequest& request) const;
 
+        /**
+         * Same as DeleteReplicationGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteReplicationGroupOutcomeCallable DeleteReplicationGroupCallable(Model::DeleteReplicationGroupRequest&& request) const;
+
         /**
          * <p>The <i>DeleteReplicationGroup</i> action deletes an existing replication
          * group. By default, this action deletes the entire replication group, including
@@ -712,6 +888,11 @@ namespace Model
          */
         virtual void DeleteReplicationGroupAsync(const Model::DeleteReplicationGroupRequest& request, const DeleteReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteReplicationGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteReplicationGroupAsync(Model::DeleteReplicationGroupRequest&& request, const DeleteReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DeleteSnapshot</i> action deletes an existing snapshot. When you
          * receive a successful response from this action, ElastiCache immediately begins
@@ -728,6 +909,11 @@ namespace Model
          */
         virtual Model::DeleteSnapshotOutcomeCallable DeleteSnapshotCallable(const Model::DeleteSnapshotRequest& request) const;
 
+        /**
+         * Same as DeleteSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSnapshotOutcomeCallable DeleteSnapshotCallable(Model::DeleteSnapshotRequest&& request) const;
+
         /**
          * <p>The <i>DeleteSnapshot</i> action deletes an existing snapshot. When you
          * receive a successful response from this action, ElastiCache immediately begins
@@ -737,6 +923,11 @@ namespace Model
          */
         virtual void DeleteSnapshotAsync(const Model::DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSnapshotAsync(Model::DeleteSnapshotRequest&& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeCacheClusters</i> action returns information about all
          * provisioned cache clusters if no cache cluster identifier is specified, or about
@@ -779,6 +970,11 @@ namespace Model
          */
         virtual Model::DescribeCacheClustersOutcomeCallable DescribeCacheClustersCallable(const Model::DescribeCacheClustersRequest& request) const;
 
+        /**
+         * Same as DescribeCacheClustersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCacheClustersOutcomeCallable DescribeCacheClustersCallable(Model::DescribeCacheClustersRequest&& request) const;
+
         /**
          * <p>The <i>DescribeCacheClusters</i> action returns information about all
          * provisioned cache clusters if no cache cluster identifier is specified, or about
@@ -801,6 +997,11 @@ namespace Model
          */
         virtual void DescribeCacheClustersAsync(const Model::DescribeCacheClustersRequest& request, const DescribeCacheClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCacheClustersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCacheClustersAsync(Model::DescribeCacheClustersRequest&& request, const DescribeCacheClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeCacheEngineVersions</i> action returns a list of the available
          * cache engines and their versions.</p>
@@ -815,6 +1016,11 @@ namespace Model
          */
         virtual Model::DescribeCacheEngineVersionsOutcomeCallable DescribeCacheEngineVersionsCallable(const Model::DescribeCacheEngineVersionsRequest& request) const;
 
+        /**
+         * Same as DescribeCacheEngineVersionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCacheEngineVersionsOutcomeCallable DescribeCacheEngineVersionsCallable(Model::DescribeCacheEngineVersionsRequest&& request) const;
+
         /**
          * <p>The <i>DescribeCacheEngineVersions</i> action returns a list of the available
          * cache engines and their versions.</p>
@@ -823,6 +1029,11 @@ namespace Model
          */
         virtual void DescribeCacheEngineVersionsAsync(const Model::DescribeCacheEngineVersionsRequest& request, const DescribeCacheEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCacheEngineVersionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCacheEngineVersionsAsync(Model::DescribeCacheEngineVersionsRequest&& request, const DescribeCacheEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeCacheParameterGroups</i> action returns a list of cache
          * parameter group descriptions. If a cache parameter group name is specified, the
@@ -839,6 +1050,11 @@ namespace Model
          */
         virtual Model::DescribeCacheParameterGroupsOutcomeCallable DescribeCacheParameterGroupsCallable(const Model::DescribeCacheParameterGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeCacheParameterGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCacheParameterGroupsOutcomeCallable DescribeCacheParameterGroupsCallable(Model::DescribeCacheParameterGroupsRequest&& request) const;
+
         /**
          * <p>The <i>DescribeCacheParameterGroups</i> action returns a list of cache
          * parameter group descriptions. If a cache parameter group name is specified, the
@@ -848,6 +1064,11 @@ namespace Model
          */
         virtual void DescribeCacheParameterGroupsAsync(const Model::DescribeCacheParameterGroupsRequest& request, const DescribeCacheParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCacheParameterGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCacheParameterGroupsAsync(Model::DescribeCacheParameterGroupsRequest&& request, const DescribeCacheParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeCacheParameters</i> action returns the detailed parameter list
          * for a particular cache parameter group.</p>
@@ -862,6 +1083,11 @@ namespace Model
          */
         virtual Model::DescribeCacheParametersOutcomeCallable DescribeCacheParametersCallable(const Model::DescribeCacheParametersRequest& request) const;
 
+        /**
+         * Same as DescribeCacheParametersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCacheParametersOutcomeCallable DescribeCacheParametersCallable(Model::DescribeCacheParametersRequest&& request) const;
+
         /**
          * <p>The <i>DescribeCacheParameters</i> action returns the detailed parameter list
          * for a particular cache parameter group.</p>
@@ -870,6 +1096,11 @@ namespace Model
          */
         virtual void DescribeCacheParametersAsync(const Model::DescribeCacheParametersRequest& request, const DescribeCacheParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCacheParametersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCacheParametersAsync(Model::DescribeCacheParametersRequest&& request, const DescribeCacheParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeCacheSecurityGroups</i> action returns a list of cache
          * security group descriptions. If a cache security group name is specified, the
@@ -886,6 +1117,11 @@ namespace Model
          */
         virtual Model::DescribeCacheSecurityGroupsOutcomeCallable DescribeCacheSecurityGroupsCallable(const Model::DescribeCacheSecurityGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeCacheSecurityGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCacheSecurityGroupsOutcomeCallable DescribeCacheSecurityGroupsCallable(Model::DescribeCacheSecurityGroupsRequest&& request) const;
+
         /**
          * <p>The <i>DescribeCacheSecurityGroups</i> action returns a list of cache
          * security group descriptions. If a cache security group name is specified, the
@@ -895,6 +1131,11 @@ namespace Model
          */
         virtual void DescribeCacheSecurityGroupsAsync(const Model::DescribeCacheSecurityGroupsRequest& request, const DescribeCacheSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCacheSecurityGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCacheSecurityGroupsAsync(Model::DescribeCacheSecurityGroupsRequest&& request, const DescribeCacheSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeCacheSubnetGroups</i> action returns a list of cache subnet
          * group descriptions. If a subnet group name is specified, the list will contain
@@ -911,6 +1152,11 @@ namespace Model
          */
         virtual Model::DescribeCacheSubnetGroupsOutcomeCallable DescribeCacheSubnetGroupsCallable(const Model::DescribeCacheSubnetGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeCacheSubnetGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCacheSubnetGroupsOutcomeCallable DescribeCacheSubnetGroupsCallable(Model::DescribeCacheSubnetGroupsRequest&& request) const;
+
         /**
          * <p>The <i>DescribeCacheSubnetGroups</i> action returns a list of cache subnet
          * group descriptions. If a subnet group name is specified, the list will contain
@@ -920,6 +1166,11 @@ namespace Model
          */
         virtual void DescribeCacheSubnetGroupsAsync(const Model::DescribeCacheSubnetGroupsRequest& request, const DescribeCacheSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCacheSubnetGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCacheSubnetGroupsAsync(Model::DescribeCacheSubnetGroupsRequest&& request, const DescribeCacheSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeEngineDefaultParameters</i> action returns the default engine
          * and system parameter information for the specified cache engine.</p>
@@ -934,6 +1185,11 @@ namespace Model
          */
         virtual Model::DescribeEngineDefaultParametersOutcomeCallable DescribeEngineDefaultParametersCallable(const Model::DescribeEngineDefaultParametersRequest& request) const;
 
+        /**
+         * Same as DescribeEngineDefaultParametersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEngineDefaultParametersOutcomeCallable DescribeEngineDefaultParametersCallable(Model::DescribeEngineDefaultParametersRequest&& request) const;
+
         /**
          * <p>The <i>DescribeEngineDefaultParameters</i> action returns the default engine
          * and system parameter information for the specified cache engine.</p>
@@ -942,6 +1198,11 @@ namespace Model
          */
         virtual void DescribeEngineDefaultParametersAsync(const Model::DescribeEngineDefaultParametersRequest& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEngineDefaultParametersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEngineDefaultParametersAsync(Model::DescribeEngineDefaultParametersRequest&& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeEvents</i> action returns events related to cache clusters,
          * cache security groups, and cache parameter groups. You can obtain events
@@ -964,6 +1225,11 @@ namespace Model
          */
         virtual Model::DescribeEventsOutcomeCallable DescribeEventsCallable(const Model::DescribeEventsRequest& request) const;
 
+        /**
+         * Same as DescribeEventsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEventsOutcomeCallable DescribeEventsCallable(Model::DescribeEventsRequest&& request) const;
+
         /**
          * <p>The <i>DescribeEvents</i> action returns events related to cache clusters,
          * cache security groups, and cache parameter groups. You can obtain events
@@ -976,6 +1242,11 @@ namespace Model
          */
         virtual void DescribeEventsAsync(const Model::DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEventsAsync(Model::DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeReplicationGroups</i> action returns information about a
          * particular replication group. If no identifier is specified,
@@ -994,6 +1265,11 @@ namespace Model
          */
         virtual Model::DescribeReplicationGroupsOutcomeCallable DescribeReplicationGroupsCallable(const Model::DescribeReplicationGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeReplicationGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeReplicationGroupsOutcomeCallable DescribeReplicationGroupsCallable(Model::DescribeReplicationGroupsRequest&& request) const;
+
         /**
          * <p>The <i>DescribeReplicationGroups</i> action returns information about a
          * particular replication group. If no identifier is specified,
@@ -1004,6 +1280,11 @@ namespace Model
          */
         virtual void DescribeReplicationGroupsAsync(const Model::DescribeReplicationGroupsRequest& request, const DescribeReplicationGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReplicationGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeReplicationGroupsAsync(Model::DescribeReplicationGroupsRequest&& request, const DescribeReplicationGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeReservedCacheNodes</i> action returns information about
          * reserved cache nodes for this account, or about a specified reserved cache
@@ -1020,6 +1301,11 @@ namespace Model
          */
         virtual Model::DescribeReservedCacheNodesOutcomeCallable DescribeReservedCacheNodesCallable(const Model::DescribeReservedCacheNodesRequest& request) const;
 
+        /**
+         * Same as DescribeReservedCacheNodesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeReservedCacheNodesOutcomeCallable DescribeReservedCacheNodesCallable(Model::DescribeReservedCacheNodesRequest&& request) const;
+
         /**
          * <p>The <i>DescribeReservedCacheNodes</i> action returns information about
          * reserved cache nodes for this account, or about a specified reserved cache
@@ -1029,6 +1315,11 @@ namespace Model
          */
         virtual void DescribeReservedCacheNodesAsync(const Model::DescribeReservedCacheNodesRequest& request, const DescribeReservedCacheNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedCacheNodesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeReservedCacheNodesAsync(Model::DescribeReservedCacheNodesRequest&& request, const DescribeReservedCacheNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeReservedCacheNodesOfferings</i> action lists available
          * reserved cache node offerings.</p>
@@ -1043,6 +1334,11 @@ namespace Model
          */
         virtual Model::DescribeReservedCacheNodesOfferingsOutcomeCallable DescribeReservedCacheNodesOfferingsCallable(const Model::DescribeReservedCacheNodesOfferingsRequest& request) const;
 
+        /**
+         * Same as DescribeReservedCacheNodesOfferingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeReservedCacheNodesOfferingsOutcomeCallable DescribeReservedCacheNodesOfferingsCallable(Model::DescribeReservedCacheNodesOfferingsRequest&& request) const;
+
         /**
          * <p>The <i>DescribeReservedCacheNodesOfferings</i> action lists available
          * reserved cache node offerings.</p>
@@ -1051,6 +1347,11 @@ namespace Model
          */
         virtual void DescribeReservedCacheNodesOfferingsAsync(const Model::DescribeReservedCacheNodesOfferingsRequest& request, const DescribeReservedCacheNodesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedCacheNodesOfferingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeReservedCacheNodesOfferingsAsync(Model::DescribeReservedCacheNodesOfferingsRequest&& request, const DescribeReservedCacheNodesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>DescribeSnapshots</i> action returns information about cache cluster
          * snapshots. By default, <i>DescribeSnapshots</i> lists all of your snapshots; it
@@ -1069,6 +1370,11 @@ namespace Model
          */
         virtual Model::DescribeSnapshotsOutcomeCallable DescribeSnapshotsCallable(const Model::DescribeSnapshotsRequest& request) const;
 
+        /**
+         * Same as DescribeSnapshotsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSnapshotsOutcomeCallable DescribeSnapshotsCallable(Model::DescribeSnapshotsRequest&& request) const;
+
         /**
          * <p>The <i>DescribeSnapshots</i> action returns information about cache cluster
          * snapshots. By default, <i>DescribeSnapshots</i> lists all of your snapshots; it
@@ -1079,6 +1385,11 @@ namespace Model
          */
         virtual void DescribeSnapshotsAsync(const Model::DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSnapshotsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSnapshotsAsync(Model::DescribeSnapshotsRequest&& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>ListTagsForResource</i> action lists all cost allocation tags
          * currently on the named resource. A <i>cost allocation tag</i> is a key-value
@@ -1105,6 +1416,11 @@ namespace Model
          */
         virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(const Model::ListTagsForResourceRequest& request) const;
 
+        /**
+         * Same as ListTagsForResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(Model::ListTagsForResourceRequest&& request) const;
+
         /**
          * <p>The <i>ListTagsForResource</i> action lists all cost allocation tags
          * currently on the named resource. A <i>cost allocation tag</i> is a key-value
@@ -1119,6 +1435,11 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTagsForResourceAsync(Model::ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>ModifyCacheCluster</i> action modifies the settings for a cache
          * cluster. You can use this action to change one or more cluster configuration
@@ -1135,6 +1456,11 @@ namespace Model
          */
         virtual Model::ModifyCacheClusterOutcomeCallable ModifyCacheClusterCallable(const Model::ModifyCacheClusterRequest& request) const;
 
+        /**
+         * Same as ModifyCacheClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyCacheClusterOutcomeCallable ModifyCacheClusterCallable(Model::ModifyCacheClusterRequest&& request) const;
+
         /**
          * <p>The <i>ModifyCacheCluster</i> action modifies the settings for a cache
          * cluster. You can use this action to change one or more cluster configuration
@@ -1144,6 +1470,11 @@ namespace Model
          */
         virtual void ModifyCacheClusterAsync(const Model::ModifyCacheClusterRequest& request, const ModifyCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyCacheClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyCacheClusterAsync(Model::ModifyCacheClusterRequest&& request, const ModifyCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>ModifyCacheParameterGroup</i> action modifies the parameters of a
          * cache parameter group. You can modify up to 20 parameters in a single request by
@@ -1160,6 +1491,11 @@ namespace Model
          */
         virtual Model::ModifyCacheParameterGroupOutcomeCallable ModifyCacheParameterGroupCallable(const Model::ModifyCacheParameterGroupRequest& request) const;
 
+        /**
+         * Same as ModifyCacheParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyCacheParameterGroupOutcomeCallable ModifyCacheParameterGroupCallable(Model::ModifyCacheParameterGroupRequest&& request) const;
+
         /**
          * <p>The <i>ModifyCacheParameterGroup</i> action modifies the parameters of a
          * cache parameter group. You can modify up to 20 parameters in a single request by
@@ -1169,6 +1505,11 @@ namespace Model
          */
         virtual void ModifyCacheParameterGroupAsync(const Model::ModifyCacheParameterGroupRequest& request, const ModifyCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyCacheParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyCacheParameterGroupAsync(Model::ModifyCacheParameterGroupRequest&& request, const ModifyCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>ModifyCacheSubnetGroup</i> action modifies an existing cache subnet
          * group.</p>
@@ -1183,6 +1524,11 @@ namespace Model
          */
         virtual Model::ModifyCacheSubnetGroupOutcomeCallable ModifyCacheSubnetGroupCallable(const Model::ModifyCacheSubnetGroupRequest& request) const;
 
+        /**
+         * Same as ModifyCacheSubnetGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyCacheSubnetGroupOutcomeCallable ModifyCacheSubnetGroupCallable(Model::ModifyCacheSubnetGroupRequest&& request) const;
+
         /**
          * <p>The <i>ModifyCacheSubnetGroup</i> action modifies an existing cache subnet
          * group.</p>
@@ -1191,6 +1537,11 @@ namespace Model
          */
         virtual void ModifyCacheSubnetGroupAsync(const Model::ModifyCacheSubnetGroupRequest& request, const ModifyCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyCacheSubnetGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyCacheSubnetGroupAsync(Model::ModifyCacheSubnetGroupRequest&& request, const ModifyCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>ModifyReplicationGroup</i> action modifies the settings for a
          * replication group.</p>
@@ -1205,6 +1556,11 @@ namespace Model
          */
         virtual Model::ModifyReplicationGroupOutcomeCallable ModifyReplicationGroupCallable(const Model::ModifyReplicationGroupRequest& request) const;
 
+        /**
+         * Same as ModifyReplicationGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyReplicationGroupOutcomeCallable ModifyReplicationGroupCallable(Model::ModifyReplicationGroupRequest&& request) const;
+
         /**
          * <p>The <i>ModifyReplicationGroup</i> action modifies the settings for a
          * replication group.</p>
@@ -1213,6 +1569,11 @@ namespace Model
          */
         virtual void ModifyReplicationGroupAsync(const Model::ModifyReplicationGroupRequest& request, const ModifyReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyReplicationGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyReplicationGroupAsync(Model::ModifyReplicationGroupRequest&& request, const ModifyReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>PurchaseReservedCacheNodesOffering</i> action allows you to purchase a
          * reserved cache node offering.</p>
@@ -1227,6 +1588,11 @@ namespace Model
          */
         virtual Model::PurchaseReservedCacheNodesOfferingOutcomeCallable PurchaseReservedCacheNodesOfferingCallable(const Model::PurchaseReservedCacheNodesOfferingRequest& request) const;
 
+        /**
+         * Same as PurchaseReservedCacheNodesOfferingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PurchaseReservedCacheNodesOfferingOutcomeCallable PurchaseReservedCacheNodesOfferingCallable(Model::PurchaseReservedCacheNodesOfferingRequest&& request) const;
+
         /**
          * <p>The <i>PurchaseReservedCacheNodesOffering</i> action allows you to purchase a
          * reserved cache node offering.</p>
@@ -1235,6 +1601,11 @@ namespace Model
          */
         virtual void PurchaseReservedCacheNodesOfferingAsync(const Model::PurchaseReservedCacheNodesOfferingRequest& request, const PurchaseReservedCacheNodesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PurchaseReservedCacheNodesOfferingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PurchaseReservedCacheNodesOfferingAsync(Model::PurchaseReservedCacheNodesOfferingRequest&& request, const PurchaseReservedCacheNodesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>RebootCacheCluster</i> action reboots some, or all, of the cache nodes
          * within a provisioned cache cluster. This API will apply any modified cache
@@ -1259,6 +1630,11 @@ namespace Model
          */
         virtual Model::RebootCacheClusterOutcomeCallable RebootCacheClusterCallable(const Model::RebootCacheClusterRequest& request) const;
 
+        /**
+         * Same as RebootCacheClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RebootCacheClusterOutcomeCallable RebootCacheClusterCallable(Model::RebootCacheClusterRequest&& request) const;
+
         /**
          * <p>The <i>RebootCacheCluster</i> action reboots some, or all, of the cache nodes
          * within a provisioned cache cluster. This API will apply any modified cache
@@ -1272,6 +1648,11 @@ namespace Model
          */
         virtual void RebootCacheClusterAsync(const Model::RebootCacheClusterRequest& request, const RebootCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebootCacheClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RebootCacheClusterAsync(Model::RebootCacheClusterRequest&& request, const RebootCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>RemoveTagsFromResource</i> action removes the tags identified by the
          * <code>TagKeys</code> list from the named resource.</p>
@@ -1286,6 +1667,11 @@ namespace Model
          */
         virtual Model::RemoveTagsFromResourceOutcomeCallable RemoveTagsFromResourceCallable(const Model::RemoveTagsFromResourceRequest& request) const;
 
+        /**
+         * Same as RemoveTagsFromResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveTagsFromResourceOutcomeCallable RemoveTagsFromResourceCallable(Model::RemoveTagsFromResourceRequest&& request) const;
+
         /**
          * <p>The <i>RemoveTagsFromResource</i> action removes the tags identified by the
          * <code>TagKeys</code> list from the named resource.</p>
@@ -1294,6 +1680,11 @@ namespace Model
          */
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveTagsFromResourceAsync(Model::RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>ResetCacheParameterGroup</i> action modifies the parameters of a cache
          * parameter group to the engine or system default value. You can reset specific
@@ -1314,6 +1705,11 @@ namespace Model
          */
         virtual Model::ResetCacheParameterGroupOutcomeCallable ResetCacheParameterGroupCallable(const Model::ResetCacheParameterGroupRequest& request) const;
 
+        /**
+         * Same as ResetCacheParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ResetCacheParameterGroupOutcomeCallable ResetCacheParameterGroupCallable(Model::ResetCacheParameterGroupRequest&& request) const;
+
         /**
          * <p>The <i>ResetCacheParameterGroup</i> action modifies the parameters of a cache
          * parameter group to the engine or system default value. You can reset specific
@@ -1325,6 +1721,11 @@ namespace Model
          */
         virtual void ResetCacheParameterGroupAsync(const Model::ResetCacheParameterGroupRequest& request, const ResetCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetCacheParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ResetCacheParameterGroupAsync(Model::ResetCacheParameterGroupRequest&& request, const ResetCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The <i>RevokeCacheSecurityGroupIngress</i> action revokes ingress from a
          * cache security group. Use this action to disallow access from an Amazon EC2
@@ -1341,6 +1742,11 @@ namespace Model
          */
         virtual Model::RevokeCacheSecurityGroupIngressOutcomeCallable RevokeCacheSecurityGroupIngressCallable(const Model::RevokeCacheSecurityGroupIngressRequest& request) const;
 
+        /**
+         * Same as RevokeCacheSecurityGroupIngressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RevokeCacheSecurityGroupIngressOutcomeCallable RevokeCacheSecurityGroupIngressCallable(Model::RevokeCacheSecurityGroupIngressRequest&& request) const;
+
         /**
          * <p>The <i>RevokeCacheSecurityGroupIngress</i> action revokes ingress from a
          * cache security group. Use this action to disallow access from an Amazon EC2
@@ -1350,6 +1756,92 @@ namespace Model
          */
         virtual void RevokeCacheSecurityGroupIngressAsync(const Model::RevokeCacheSecurityGroupIngressRequest& request, const RevokeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RevokeCacheSecurityGroupIngressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RevokeCacheSecurityGroupIngressAsync(Model::RevokeCacheSecurityGroupIngressRequest&& request, const RevokeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(const Model::AddTagsToResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::AddTagsToResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(Model::AddTagsToResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::AddTagsToResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AuthorizeCacheSecurityGroupIngressOutcome> AuthorizeCacheSecurityGroupIngressAwaitable(const Model::AuthorizeCacheSecurityGroupIngressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::AuthorizeCacheSecurityGroupIngress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AuthorizeCacheSecurityGroupIngressOutcome> AuthorizeCacheSecurityGroupIngressAwaitable(Model::AuthorizeCacheSecurityGroupIngressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::AuthorizeCacheSecurityGroupIngress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopySnapshotOutcome> CopySnapshotAwaitable(const Model::CopySnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::CopySnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopySnapshotOutcome> CopySnapshotAwaitable(Model::CopySnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::CopySnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCacheClusterOutcome> CreateCacheClusterAwaitable(const Model::CreateCacheClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::CreateCacheCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCacheClusterOutcome> CreateCacheClusterAwaitable(Model::CreateCacheClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::CreateCacheCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCacheParameterGroupOutcome> CreateCacheParameterGroupAwaitable(const Model::CreateCacheParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::CreateCacheParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCacheParameterGroupOutcome> CreateCacheParameterGroupAwaitable(Model::CreateCacheParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::CreateCacheParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCacheSecurityGroupOutcome> CreateCacheSecurityGroupAwaitable(const Model::CreateCacheSecurityGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::CreateCacheSecurityGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCacheSecurityGroupOutcome> CreateCacheSecurityGroupAwaitable(Model::CreateCacheSecurityGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::CreateCacheSecurityGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCacheSubnetGroupOutcome> CreateCacheSubnetGroupAwaitable(const Model::CreateCacheSubnetGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::CreateCacheSubnetGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCacheSubnetGroupOutcome> CreateCacheSubnetGroupAwaitable(Model::CreateCacheSubnetGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::CreateCacheSubnetGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateReplicationGroupOutcome> CreateReplicationGroupAwaitable(const Model::CreateReplicationGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::CreateReplicationGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateReplicationGroupOutcome> CreateReplicationGroupAwaitable(Model::CreateReplicationGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::CreateReplicationGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(const Model::CreateSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::CreateSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(Model::CreateSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::CreateSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCacheClusterOutcome> DeleteCacheClusterAwaitable(const Model::DeleteCacheClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DeleteCacheCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCacheClusterOutcome> DeleteCacheClusterAwaitable(Model::DeleteCacheClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DeleteCacheCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCacheParameterGroupOutcome> DeleteCacheParameterGroupAwaitable(const Model::DeleteCacheParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DeleteCacheParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCacheParameterGroupOutcome> DeleteCacheParameterGroupAwaitable(Model::DeleteCacheParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DeleteCacheParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCacheSecurityGroupOutcome> DeleteCacheSecurityGroupAwaitable(const Model::DeleteCacheSecurityGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DeleteCacheSecurityGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCacheSecurityGroupOutcome> DeleteCacheSecurityGroupAwaitable(Model::DeleteCacheSecurityGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DeleteCacheSecurityGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCacheSubnetGroupOutcome> DeleteCacheSubnetGroupAwaitable(const Model::DeleteCacheSubnetGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DeleteCacheSubnetGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCacheSubnetGroupOutcome> DeleteCacheSubnetGroupAwaitable(Model::DeleteCacheSubnetGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DeleteCacheSubnetGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteReplicationGroupOutcome> DeleteReplicationGroupAwaitable(const Model::DeleteReplicationGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DeleteReplicationGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteReplicationGroupOutcome> DeleteReplicationGroupAwaitable(Model::DeleteReplicationGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DeleteReplicationGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSnapshotOutcome> DeleteSnapshotAwaitable(const Model::DeleteSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DeleteSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSnapshotOutcome> DeleteSnapshotAwaitable(Model::DeleteSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DeleteSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCacheClustersOutcome> DescribeCacheClustersAwaitable(const Model::DescribeCacheClustersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeCacheClusters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCacheClustersOutcome> DescribeCacheClustersAwaitable(Model::DescribeCacheClustersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeCacheClusters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCacheEngineVersionsOutcome> DescribeCacheEngineVersionsAwaitable(const Model::DescribeCacheEngineVersionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeCacheEngineVersions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCacheEngineVersionsOutcome> DescribeCacheEngineVersionsAwaitable(Model::DescribeCacheEngineVersionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeCacheEngineVersions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCacheParameterGroupsOutcome> DescribeCacheParameterGroupsAwaitable(const Model::DescribeCacheParameterGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeCacheParameterGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCacheParameterGroupsOutcome> DescribeCacheParameterGroupsAwaitable(Model::DescribeCacheParameterGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeCacheParameterGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCacheParametersOutcome> DescribeCacheParametersAwaitable(const Model::DescribeCacheParametersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeCacheParameters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCacheParametersOutcome> DescribeCacheParametersAwaitable(Model::DescribeCacheParametersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeCacheParameters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCacheSecurityGroupsOutcome> DescribeCacheSecurityGroupsAwaitable(const Model::DescribeCacheSecurityGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeCacheSecurityGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCacheSecurityGroupsOutcome> DescribeCacheSecurityGroupsAwaitable(Model::DescribeCacheSecurityGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeCacheSecurityGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCacheSubnetGroupsOutcome> DescribeCacheSubnetGroupsAwaitable(const Model::DescribeCacheSubnetGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeCacheSubnetGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCacheSubnetGroupsOutcome> DescribeCacheSubnetGroupsAwaitable(Model::DescribeCacheSubnetGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeCacheSubnetGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEngineDefaultParametersOutcome> DescribeEngineDefaultParametersAwaitable(const Model::DescribeEngineDefaultParametersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeEngineDefaultParameters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEngineDefaultParametersOutcome> DescribeEngineDefaultParametersAwaitable(Model::DescribeEngineDefaultParametersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeEngineDefaultParameters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventsOutcome> DescribeEventsAwaitable(const Model::DescribeEventsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeEvents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventsOutcome> DescribeEventsAwaitable(Model::DescribeEventsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeEvents, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReplicationGroupsOutcome> DescribeReplicationGroupsAwaitable(const Model::DescribeReplicationGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeReplicationGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReplicationGroupsOutcome> DescribeReplicationGroupsAwaitable(Model::DescribeReplicationGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeReplicationGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedCacheNodesOutcome> DescribeReservedCacheNodesAwaitable(const Model::DescribeReservedCacheNodesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeReservedCacheNodes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedCacheNodesOutcome> DescribeReservedCacheNodesAwaitable(Model::DescribeReservedCacheNodesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeReservedCacheNodes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedCacheNodesOfferingsOutcome> DescribeReservedCacheNodesOfferingsAwaitable(const Model::DescribeReservedCacheNodesOfferingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeReservedCacheNodesOfferings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedCacheNodesOfferingsOutcome> DescribeReservedCacheNodesOfferingsAwaitable(Model::DescribeReservedCacheNodesOfferingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeReservedCacheNodesOfferings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSnapshotsOutcome> DescribeSnapshotsAwaitable(const Model::DescribeSnapshotsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeSnapshots, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSnapshotsOutcome> DescribeSnapshotsAwaitable(Model::DescribeSnapshotsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::DescribeSnapshots, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(const Model::ListTagsForResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::ListTagsForResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(Model::ListTagsForResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::ListTagsForResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyCacheClusterOutcome> ModifyCacheClusterAwaitable(const Model::ModifyCacheClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::ModifyCacheCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyCacheClusterOutcome> ModifyCacheClusterAwaitable(Model::ModifyCacheClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::ModifyCacheCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyCacheParameterGroupOutcome> ModifyCacheParameterGroupAwaitable(const Model::ModifyCacheParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::ModifyCacheParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyCacheParameterGroupOutcome> ModifyCacheParameterGroupAwaitable(Model::ModifyCacheParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::ModifyCacheParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyCacheSubnetGroupOutcome> ModifyCacheSubnetGroupAwaitable(const Model::ModifyCacheSubnetGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::ModifyCacheSubnetGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyCacheSubnetGroupOutcome> ModifyCacheSubnetGroupAwaitable(Model::ModifyCacheSubnetGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::ModifyCacheSubnetGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyReplicationGroupOutcome> ModifyReplicationGroupAwaitable(const Model::ModifyReplicationGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::ModifyReplicationGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyReplicationGroupOutcome> ModifyReplicationGroupAwaitable(Model::ModifyReplicationGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::ModifyReplicationGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PurchaseReservedCacheNodesOfferingOutcome> PurchaseReservedCacheNodesOfferingAwaitable(const Model::PurchaseReservedCacheNodesOfferingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::PurchaseReservedCacheNodesOffering, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PurchaseReservedCacheNodesOfferingOutcome> PurchaseReservedCacheNodesOfferingAwaitable(Model::PurchaseReservedCacheNodesOfferingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::PurchaseReservedCacheNodesOffering, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebootCacheClusterOutcome> RebootCacheClusterAwaitable(const Model::RebootCacheClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::RebootCacheCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebootCacheClusterOutcome> RebootCacheClusterAwaitable(Model::RebootCacheClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::RebootCacheCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(const Model::RemoveTagsFromResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::RemoveTagsFromResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(Model::RemoveTagsFromResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::RemoveTagsFromResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetCacheParameterGroupOutcome> ResetCacheParameterGroupAwaitable(const Model::ResetCacheParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::ResetCacheParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetCacheParameterGroupOutcome> ResetCacheParameterGroupAwaitable(Model::ResetCacheParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::ResetCacheParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RevokeCacheSecurityGroupIngressOutcome> RevokeCacheSecurityGroupIngressAwaitable(const Model::RevokeCacheSecurityGroupIngressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::RevokeCacheSecurityGroupIngress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RevokeCacheSecurityGroupIngressOutcome> RevokeCacheSecurityGroupIngressAwaitable(Model::RevokeCacheSecurityGroupIngressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElastiCacheClient::RevokeCacheSecurityGroupIngress, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -144,12 +144,22 @@ AddTagsToResourceOutcome ElastiCacheClient::AddTagsToResource(const AddTagsToRes
 
 AddTagsToResourceOutcomeCallable ElastiCacheClient::AddTagsToResourceCallable(const AddTagsToResourceRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::AddTagsToResource, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::AddTagsToResource, Aws::Client::RejectedCallOutcome<AddTagsToResourceOutcome>(), this, request);
+}
+
+AddTagsToResourceOutcomeCallable ElastiCacheClient::AddTagsToResourceCallable(AddTagsToResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::AddTagsToResource, Aws::Client::RejectedCallOutcome<AddTagsToResourceOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::AddTagsToResourceAsync(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::AddTagsToResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::AddTagsToResourceAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsToResourceOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::AddTagsToResourceAsync(AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::AddTagsToResourceAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsToResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::AddTagsToResourceAsyncHelper(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -174,12 +184,22 @@ AuthorizeCacheSecurityGroupIngressOutcome ElastiCacheClient::AuthorizeCacheSecur
 
 AuthorizeCacheSecurityGroupIngressOutcomeCallable ElastiCacheClient::AuthorizeCacheSecurityGroupIngressCallable(const AuthorizeCacheSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::AuthorizeCacheSecurityGroupIngress, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::AuthorizeCacheSecurityGroupIngress, Aws::Client::RejectedCallOutcome<AuthorizeCacheSecurityGroupIngressOutcome>(), this, request);
+}
+
+AuthorizeCacheSecurityGroupIngressOutcomeCallable ElastiCacheClient::AuthorizeCacheSecurityGroupIngressCallable(AuthorizeCacheSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::AuthorizeCacheSecurityGroupIngress, Aws::Client::RejectedCallOutcome<AuthorizeCacheSecurityGroupIngressOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::AuthorizeCacheSecurityGroupIngressAsync(const AuthorizeCacheSecurityGroupIngressRequest& request, const AuthorizeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::AuthorizeCacheSecurityGroupIngressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::AuthorizeCacheSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<AuthorizeCacheSecurityGroupIngressOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::AuthorizeCacheSecurityGroupIngressAsync(AuthorizeCacheSecurityGroupIngressRequest&& request, const AuthorizeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::AuthorizeCacheSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<AuthorizeCacheSecurityGroupIngressOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::AuthorizeCacheSecurityGroupIngressAsyncHelper(const AuthorizeCacheSecurityGroupIngressRequest& request, const AuthorizeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -204,12 +224,22 @@ CopySnapshotOutcome ElastiCacheClient::CopySnapshot(const CopySnapshotRequest& r
 
 CopySnapshotOutcomeCallable ElastiCacheClient::CopySnapshotCallable(const CopySnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::CopySnapshot, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::CopySnapshot, Aws::Client::RejectedCallOutcome<CopySnapshotOutcome>(), this, request);
+}
+
+CopySnapshotOutcomeCallable ElastiCacheClient::CopySnapshotCallable(CopySnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::CopySnapshot, Aws::Client::RejectedCallOutcome<CopySnapshotOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::CopySnapshotAsync(const CopySnapshotRequest& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::CopySnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::CopySnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CopySnapshotOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::CopySnapshotAsync(CopySnapshotRequest&& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::CopySnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CopySnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::CopySnapshotAsyncHelper(const CopySnapshotRequest& request, const CopySnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -234,12 +264,22 @@ CreateCacheClusterOutcome ElastiCacheClient::CreateCacheCluster(const CreateCach
 
 CreateCacheClusterOutcomeCallable ElastiCacheClient::CreateCacheClusterCallable(const CreateCacheClusterRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::CreateCacheCluster, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::CreateCacheCluster, Aws::Client::RejectedCallOutcome<CreateCacheClusterOutcome>(), this, request);
+}
+
+CreateCacheClusterOutcomeCallable ElastiCacheClient::CreateCacheClusterCallable(CreateCacheClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::CreateCacheCluster, Aws::Client::RejectedCallOutcome<CreateCacheClusterOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::CreateCacheClusterAsync(const CreateCacheClusterRequest& request, const CreateCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::CreateCacheClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::CreateCacheClusterAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCacheClusterOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::CreateCacheClusterAsync(CreateCacheClusterRequest&& request, const CreateCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::CreateCacheClusterAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCacheClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::CreateCacheClusterAsyncHelper(const CreateCacheClusterRequest& request, const CreateCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -264,12 +304,22 @@ CreateCacheParameterGroupOutcome ElastiCacheClient::CreateCacheParameterGroup(co
 
 CreateCacheParameterGroupOutcomeCallable ElastiCacheClient::CreateCacheParameterGroupCallable(const CreateCacheParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::CreateCacheParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::CreateCacheParameterGroup, Aws::Client::RejectedCallOutcome<CreateCacheParameterGroupOutcome>(), this, request);
+}
+
+CreateCacheParameterGroupOutcomeCallable ElastiCacheClient::CreateCacheParameterGroupCallable(CreateCacheParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::CreateCacheParameterGroup, Aws::Client::RejectedCallOutcome<CreateCacheParameterGroupOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::CreateCacheParameterGroupAsync(const CreateCacheParameterGroupRequest& request, const CreateCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::CreateCacheParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::CreateCacheParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCacheParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::CreateCacheParameterGroupAsync(CreateCacheParameterGroupRequest&& request, const CreateCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::CreateCacheParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCacheParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::CreateCacheParameterGroupAsyncHelper(const CreateCacheParameterGroupRequest& request, const CreateCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -294,12 +344,22 @@ CreateCacheSecurityGroupOutcome ElastiCacheClient::CreateCacheSecurityGroup(cons
 
 CreateCacheSecurityGroupOutcomeCallable ElastiCacheClient::CreateCacheSecurityGroupCallable(const CreateCacheSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::CreateCacheSecurityGroup, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::CreateCacheSecurityGroup, Aws::Client::RejectedCallOutcome<CreateCacheSecurityGroupOutcome>(), this, request);
+}
+
+CreateCacheSecurityGroupOutcomeCallable ElastiCacheClient::CreateCacheSecurityGroupCallable(CreateCacheSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::CreateCacheSecurityGroup, Aws::Client::RejectedCallOutcome<CreateCacheSecurityGroupOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::CreateCacheSecurityGroupAsync(const CreateCacheSecurityGroupRequest& request, const CreateCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::CreateCacheSecurityGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::CreateCacheSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCacheSecurityGroupOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::CreateCacheSecurityGroupAsync(CreateCacheSecurityGroupRequest&& request, const CreateCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::CreateCacheSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCacheSecurityGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::CreateCacheSecurityGroupAsyncHelper(const CreateCacheSecurityGroupRequest& request, const CreateCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -324,12 +384,22 @@ CreateCacheSubnetGroupOutcome ElastiCacheClient::CreateCacheSubnetGroup(const Cr
 
 CreateCacheSubnetGroupOutcomeCallable ElastiCacheClient::CreateCacheSubnetGroupCallable(const CreateCacheSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::CreateCacheSubnetGroup, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::CreateCacheSubnetGroup, Aws::Client::RejectedCallOutcome<CreateCacheSubnetGroupOutcome>(), this, request);
+}
+
+CreateCacheSubnetGroupOutcomeCallable ElastiCacheClient::CreateCacheSubnetGroupCallable(CreateCacheSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::CreateCacheSubnetGroup, Aws::Client::RejectedCallOutcome<CreateCacheSubnetGroupOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::CreateCacheSubnetGroupAsync(const CreateCacheSubnetGroupRequest& request, const CreateCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::CreateCacheSubnetGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::CreateCacheSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCacheSubnetGroupOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::CreateCacheSubnetGroupAsync(CreateCacheSubnetGroupRequest&& request, const CreateCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::CreateCacheSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCacheSubnetGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::CreateCacheSubnetGroupAsyncHelper(const CreateCacheSubnetGroupRequest& request, const CreateCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -354,12 +424,22 @@ CreateReplicationGroupOutcome ElastiCacheClient::CreateReplicationGroup(const Cr
 
 CreateReplicationGroupOutcomeCallable ElastiCacheClient::CreateReplicationGroupCallable(const CreateReplicationGroupRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::CreateReplicationGroup, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::CreateReplicationGroup, Aws::Client::RejectedCallOutcome<CreateReplicationGroupOutcome>(), this, request);
+}
+
+CreateReplicationGroupOutcomeCallable ElastiCacheClient::CreateReplicationGroupCallable(CreateReplicationGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::CreateReplicationGroup, Aws::Client::RejectedCallOutcome<CreateReplicationGroupOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::CreateReplicationGroupAsync(const CreateReplicationGroupRequest& request, const CreateReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::CreateReplicationGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::CreateReplicationGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateReplicationGroupOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::CreateReplicationGroupAsync(CreateReplicationGroupRequest&& request, const CreateReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::CreateReplicationGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateReplicationGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::CreateReplicationGroupAsyncHelper(const CreateReplicationGroupRequest& request, const CreateReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -384,12 +464,22 @@ CreateSnapshotOutcome ElastiCacheClient::CreateSnapshot(const CreateSnapshotRequ
 
 CreateSnapshotOutcomeCallable ElastiCacheClient::CreateSnapshotCallable(const CreateSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::CreateSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::CreateSnapshot, Aws::Client::RejectedCallOutcome<CreateSnapshotOutcome>(), this, request);
+}
+
+CreateSnapshotOutcomeCallable ElastiCacheClient::CreateSnapshotCallable(CreateSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::CreateSnapshot, Aws::Client::RejectedCallOutcome<CreateSnapshotOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::CreateSnapshotAsync(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::CreateSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::CreateSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSnapshotOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::CreateSnapshotAsync(CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::CreateSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::CreateSnapshotAsyncHelper(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -414,12 +504,22 @@ DeleteCacheClusterOutcome ElastiCacheClient::DeleteCacheCluster(const DeleteCach
 
 DeleteCacheClusterOutcomeCallable ElastiCacheClient::DeleteCacheClusterCallable(const DeleteCacheClusterRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DeleteCacheCluster, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DeleteCacheCluster, Aws::Client::RejectedCallOutcome<DeleteCacheClusterOutcome>(), this, request);
+}
+
+DeleteCacheClusterOutcomeCallable ElastiCacheClient::DeleteCacheClusterCallable(DeleteCacheClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DeleteCacheCluster, Aws::Client::RejectedCallOutcome<DeleteCacheClusterOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DeleteCacheClusterAsync(const DeleteCacheClusterRequest& request, const DeleteCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DeleteCacheClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DeleteCacheClusterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCacheClusterOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DeleteCacheClusterAsync(DeleteCacheClusterRequest&& request, const DeleteCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DeleteCacheClusterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCacheClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DeleteCacheClusterAsyncHelper(const DeleteCacheClusterRequest& request, const DeleteCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -444,12 +544,22 @@ DeleteCacheParameterGroupOutcome ElastiCacheClient::DeleteCacheParameterGroup(co
 
 DeleteCacheParameterGroupOutcomeCallable ElastiCacheClient::DeleteCacheParameterGroupCallable(const DeleteCacheParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DeleteCacheParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DeleteCacheParameterGroup, Aws::Client::RejectedCallOutcome<DeleteCacheParameterGroupOutcome>(), this, request);
+}
+
+DeleteCacheParameterGroupOutcomeCallable ElastiCacheClient::DeleteCacheParameterGroupCallable(DeleteCacheParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DeleteCacheParameterGroup, Aws::Client::RejectedCallOutcome<DeleteCacheParameterGroupOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DeleteCacheParameterGroupAsync(const DeleteCacheParameterGroupRequest& request, const DeleteCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DeleteCacheParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DeleteCacheParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCacheParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DeleteCacheParameterGroupAsync(DeleteCacheParameterGroupRequest&& request, const DeleteCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DeleteCacheParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCacheParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DeleteCacheParameterGroupAsyncHelper(const DeleteCacheParameterGroupRequest& request, const DeleteCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -474,12 +584,22 @@ DeleteCacheSecurityGroupOutcome ElastiCacheClient::DeleteCacheSecurityGroup(cons
 
 DeleteCacheSecurityGroupOutcomeCallable ElastiCacheClient::DeleteCacheSecurityGroupCallable(const DeleteCacheSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DeleteCacheSecurityGroup, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DeleteCacheSecurityGroup, Aws::Client::RejectedCallOutcome<DeleteCacheSecurityGroupOutcome>(), this, request);
+}
+
+DeleteCacheSecurityGroupOutcomeCallable ElastiCacheClient::DeleteCacheSecurityGroupCallable(DeleteCacheSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DeleteCacheSecurityGroup, Aws::Client::RejectedCallOutcome<DeleteCacheSecurityGroupOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DeleteCacheSecurityGroupAsync(const DeleteCacheSecurityGroupRequest& request, const DeleteCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DeleteCacheSecurityGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DeleteCacheSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCacheSecurityGroupOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DeleteCacheSecurityGroupAsync(DeleteCacheSecurityGroupRequest&& request, const DeleteCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DeleteCacheSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCacheSecurityGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DeleteCacheSecurityGroupAsyncHelper(const DeleteCacheSecurityGroupRequest& request, const DeleteCacheSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -504,12 +624,22 @@ DeleteCacheSubnetGroupOutcome ElastiCacheClient::DeleteCacheSubnetGroup(const De
 
 DeleteCacheSubnetGroupOutcomeCallable ElastiCacheClient::DeleteCacheSubnetGroupCallable(const DeleteCacheSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DeleteCacheSubnetGroup, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DeleteCacheSubnetGroup, Aws::Client::RejectedCallOutcome<DeleteCacheSubnetGroupOutcome>(), this, request);
+}
+
+DeleteCacheSubnetGroupOutcomeCallable ElastiCacheClient::DeleteCacheSubnetGroupCallable(DeleteCacheSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DeleteCacheSubnetGroup, Aws::Client::RejectedCallOutcome<DeleteCacheSubnetGroupOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DeleteCacheSubnetGroupAsync(const DeleteCacheSubnetGroupRequest& request, const DeleteCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DeleteCacheSubnetGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DeleteCacheSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCacheSubnetGroupOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DeleteCacheSubnetGroupAsync(DeleteCacheSubnetGroupRequest&& request, const DeleteCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DeleteCacheSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCacheSubnetGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DeleteCacheSubnetGroupAsyncHelper(const DeleteCacheSubnetGroupRequest& request, const DeleteCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -534,12 +664,22 @@ DeleteReplicationGroupOutcome ElastiCacheClient::DeleteReplicationGroup(const De
 
 DeleteReplicationGroupOutcomeCallable ElastiCacheClient::DeleteReplicationGroupCallable(const DeleteReplicationGroupRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DeleteReplicationGroup, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DeleteReplicationGroup, Aws::Client::RejectedCallOutcome<DeleteReplicationGroupOutcome>(), this, request);
+}
+
+DeleteReplicationGroupOutcomeCallable ElastiCacheClient::DeleteReplicationGroupCallable(DeleteReplicationGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DeleteReplicationGroup, Aws::Client::RejectedCallOutcome<DeleteReplicationGroupOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DeleteReplicationGroupAsync(const DeleteReplicationGroupRequest& request, const DeleteReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DeleteReplicationGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DeleteReplicationGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteReplicationGroupOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DeleteReplicationGroupAsync(DeleteReplicationGroupRequest&& request, const DeleteReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DeleteReplicationGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteReplicationGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DeleteReplicationGroupAsyncHelper(const DeleteReplicationGroupRequest& request, const DeleteReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -564,12 +704,22 @@ DeleteSnapshotOutcome ElastiCacheClient::DeleteSnapshot(const DeleteSnapshotRequ
 
 DeleteSnapshotOutcomeCallable ElastiCacheClient::DeleteSnapshotCallable(const DeleteSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DeleteSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DeleteSnapshot, Aws::Client::RejectedCallOutcome<DeleteSnapshotOutcome>(), this, request);
+}
+
+DeleteSnapshotOutcomeCallable ElastiCacheClient::DeleteSnapshotCallable(DeleteSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DeleteSnapshot, Aws::Client::RejectedCallOutcome<DeleteSnapshotOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DeleteSnapshotAsync(const DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DeleteSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DeleteSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSnapshotOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DeleteSnapshotAsync(DeleteSnapshotRequest&& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DeleteSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DeleteSnapshotAsyncHelper(const DeleteSnapshotRequest& request, const DeleteSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -594,12 +744,22 @@ DescribeCacheClustersOutcome ElastiCacheClient::DescribeCacheClusters(const Desc
 
 DescribeCacheClustersOutcomeCallable ElastiCacheClient::DescribeCacheClustersCallable(const DescribeCacheClustersRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DescribeCacheClusters, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeCacheClusters, Aws::Client::RejectedCallOutcome<DescribeCacheClustersOutcome>(), this, request);
+}
+
+DescribeCacheClustersOutcomeCallable ElastiCacheClient::DescribeCacheClustersCallable(DescribeCacheClustersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeCacheClusters, Aws::Client::RejectedCallOutcome<DescribeCacheClustersOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DescribeCacheClustersAsync(const DescribeCacheClustersRequest& request, const DescribeCacheClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DescribeCacheClustersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeCacheClustersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCacheClustersOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DescribeCacheClustersAsync(DescribeCacheClustersRequest&& request, const DescribeCacheClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeCacheClustersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCacheClustersOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DescribeCacheClustersAsyncHelper(const DescribeCacheClustersRequest& request, const DescribeCacheClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -624,12 +784,22 @@ DescribeCacheEngineVersionsOutcome ElastiCacheClient::DescribeCacheEngineVersion
 
 DescribeCacheEngineVersionsOutcomeCallable ElastiCacheClient::DescribeCacheEngineVersionsCallable(const DescribeCacheEngineVersionsRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DescribeCacheEngineVersions, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeCacheEngineVersions, Aws::Client::RejectedCallOutcome<DescribeCacheEngineVersionsOutcome>(), this, request);
+}
+
+DescribeCacheEngineVersionsOutcomeCallable ElastiCacheClient::DescribeCacheEngineVersionsCallable(DescribeCacheEngineVersionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeCacheEngineVersions, Aws::Client::RejectedCallOutcome<DescribeCacheEngineVersionsOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DescribeCacheEngineVersionsAsync(const DescribeCacheEngineVersionsRequest& request, const DescribeCacheEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DescribeCacheEngineVersionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeCacheEngineVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCacheEngineVersionsOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DescribeCacheEngineVersionsAsync(DescribeCacheEngineVersionsRequest&& request, const DescribeCacheEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeCacheEngineVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCacheEngineVersionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DescribeCacheEngineVersionsAsyncHelper(const DescribeCacheEngineVersionsRequest& request, const DescribeCacheEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -654,12 +824,22 @@ DescribeCacheParameterGroupsOutcome ElastiCacheClient::DescribeCacheParameterGro
 
 DescribeCacheParameterGroupsOutcomeCallable ElastiCacheClient::DescribeCacheParameterGroupsCallable(const DescribeCacheParameterGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DescribeCacheParameterGroups, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeCacheParameterGroups, Aws::Client::RejectedCallOutcome<DescribeCacheParameterGroupsOutcome>(), this, request);
+}
+
+DescribeCacheParameterGroupsOutcomeCallable ElastiCacheClient::DescribeCacheParameterGroupsCallable(DescribeCacheParameterGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeCacheParameterGroups, Aws::Client::RejectedCallOutcome<DescribeCacheParameterGroupsOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DescribeCacheParameterGroupsAsync(const DescribeCacheParameterGroupsRequest& request, const DescribeCacheParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DescribeCacheParameterGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeCacheParameterGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCacheParameterGroupsOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DescribeCacheParameterGroupsAsync(DescribeCacheParameterGroupsRequest&& request, const DescribeCacheParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeCacheParameterGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCacheParameterGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DescribeCacheParameterGroupsAsyncHelper(const DescribeCacheParameterGroupsRequest& request, const DescribeCacheParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -684,12 +864,22 @@ DescribeCacheParametersOutcome ElastiCacheClient::DescribeCacheParameters(const
 
 DescribeCacheParametersOutcomeCallable ElastiCacheClient::DescribeCacheParametersCallable(const DescribeCacheParametersRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DescribeCacheParameters, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeCacheParameters, Aws::Client::RejectedCallOutcome<DescribeCacheParametersOutcome>(), this, request);
+}
+
+DescribeCacheParametersOutcomeCallable ElastiCacheClient::DescribeCacheParametersCallable(DescribeCacheParametersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeCacheParameters, Aws::Client::RejectedCallOutcome<DescribeCacheParametersOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DescribeCacheParametersAsync(const DescribeCacheParametersRequest& request, const DescribeCacheParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DescribeCacheParametersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeCacheParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCacheParametersOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DescribeCacheParametersAsync(DescribeCacheParametersRequest&& request, const DescribeCacheParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeCacheParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCacheParametersOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DescribeCacheParametersAsyncHelper(const DescribeCacheParametersRequest& request, const DescribeCacheParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -714,12 +904,22 @@ DescribeCacheSecurityGroupsOutcome ElastiCacheClient::DescribeCacheSecurityGroup
 
 DescribeCacheSecurityGroupsOutcomeCallable ElastiCacheClient::DescribeCacheSecurityGroupsCallable(const DescribeCacheSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DescribeCacheSecurityGroups, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeCacheSecurityGroups, Aws::Client::RejectedCallOutcome<DescribeCacheSecurityGroupsOutcome>(), this, request);
+}
+
+DescribeCacheSecurityGroupsOutcomeCallable ElastiCacheClient::DescribeCacheSecurityGroupsCallable(DescribeCacheSecurityGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeCacheSecurityGroups, Aws::Client::RejectedCallOutcome<DescribeCacheSecurityGroupsOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DescribeCacheSecurityGroupsAsync(const DescribeCacheSecurityGroupsRequest& request, const DescribeCacheSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DescribeCacheSecurityGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeCacheSecurityGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCacheSecurityGroupsOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DescribeCacheSecurityGroupsAsync(DescribeCacheSecurityGroupsRequest&& request, const DescribeCacheSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeCacheSecurityGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCacheSecurityGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DescribeCacheSecurityGroupsAsyncHelper(const DescribeCacheSecurityGroupsRequest& request, const DescribeCacheSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -744,12 +944,22 @@ DescribeCacheSubnetGroupsOutcome ElastiCacheClient::DescribeCacheSubnetGroups(co
 
 DescribeCacheSubnetGroupsOutcomeCallable ElastiCacheClient::DescribeCacheSubnetGroupsCallable(const DescribeCacheSubnetGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DescribeCacheSubnetGroups, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeCacheSubnetGroups, Aws::Client::RejectedCallOutcome<DescribeCacheSubnetGroupsOutcome>(), this, request);
+}
+
+DescribeCacheSubnetGroupsOutcomeCallable ElastiCacheClient::DescribeCacheSubnetGroupsCallable(DescribeCacheSubnetGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeCacheSubnetGroups, Aws::Client::RejectedCallOutcome<DescribeCacheSubnetGroupsOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DescribeCacheSubnetGroupsAsync(const DescribeCacheSubnetGroupsRequest& request, const DescribeCacheSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DescribeCacheSubnetGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeCacheSubnetGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCacheSubnetGroupsOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DescribeCacheSubnetGroupsAsync(DescribeCacheSubnetGroupsRequest&& request, const DescribeCacheSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeCacheSubnetGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCacheSubnetGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DescribeCacheSubnetGroupsAsyncHelper(const DescribeCacheSubnetGroupsRequest& request, const DescribeCacheSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -774,12 +984,22 @@ DescribeEngineDefaultParametersOutcome ElastiCacheClient::DescribeEngineDefaultP
 
 DescribeEngineDefaultParametersOutcomeCallable ElastiCacheClient::DescribeEngineDefaultParametersCallable(const DescribeEngineDefaultParametersRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DescribeEngineDefaultParameters, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeEngineDefaultParameters, Aws::Client::RejectedCallOutcome<DescribeEngineDefaultParametersOutcome>(), this, request);
+}
+
+DescribeEngineDefaultParametersOutcomeCallable ElastiCacheClient::DescribeEngineDefaultParametersCallable(DescribeEngineDefaultParametersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeEngineDefaultParameters, Aws::Client::RejectedCallOutcome<DescribeEngineDefaultParametersOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DescribeEngineDefaultParametersAsync(const DescribeEngineDefaultParametersRequest& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DescribeEngineDefaultParametersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeEngineDefaultParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEngineDefaultParametersOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DescribeEngineDefaultParametersAsync(DescribeEngineDefaultParametersRequest&& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeEngineDefaultParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEngineDefaultParametersOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DescribeEngineDefaultParametersAsyncHelper(const DescribeEngineDefaultParametersRequest& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -804,12 +1024,22 @@ DescribeEventsOutcome ElastiCacheClient::DescribeEvents(const DescribeEventsRequ
 
 DescribeEventsOutcomeCallable ElastiCacheClient::DescribeEventsCallable(const DescribeEventsRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DescribeEvents, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeEvents, Aws::Client::RejectedCallOutcome<DescribeEventsOutcome>(), this, request);
+}
+
+DescribeEventsOutcomeCallable ElastiCacheClient::DescribeEventsCallable(DescribeEventsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeEvents, Aws::Client::RejectedCallOutcome<DescribeEventsOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DescribeEventsAsync(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DescribeEventsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeEventsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventsOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DescribeEventsAsync(DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeEventsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DescribeEventsAsyncHelper(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -834,12 +1064,22 @@ DescribeReplicationGroupsOutcome ElastiCacheClient::DescribeReplicationGroups(co
 
 DescribeReplicationGroupsOutcomeCallable ElastiCacheClient::DescribeReplicationGroupsCallable(const DescribeReplicationGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DescribeReplicationGroups, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeReplicationGroups, Aws::Client::RejectedCallOutcome<DescribeReplicationGroupsOutcome>(), this, request);
+}
+
+DescribeReplicationGroupsOutcomeCallable ElastiCacheClient::DescribeReplicationGroupsCallable(DescribeReplicationGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeReplicationGroups, Aws::Client::RejectedCallOutcome<DescribeReplicationGroupsOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DescribeReplicationGroupsAsync(const DescribeReplicationGroupsRequest& request, const DescribeReplicationGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DescribeReplicationGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeReplicationGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReplicationGroupsOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DescribeReplicationGroupsAsync(DescribeReplicationGroupsRequest&& request, const DescribeReplicationGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeReplicationGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReplicationGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DescribeReplicationGroupsAsyncHelper(const DescribeReplicationGroupsRequest& request, const DescribeReplicationGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -864,12 +1104,22 @@ DescribeReservedCacheNodesOutcome ElastiCacheClient::DescribeReservedCacheNodes(
 
 DescribeReservedCacheNodesOutcomeCallable ElastiCacheClient::DescribeReservedCacheNodesCallable(const DescribeReservedCacheNodesRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DescribeReservedCacheNodes, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeReservedCacheNodes, Aws::Client::RejectedCallOutcome<DescribeReservedCacheNodesOutcome>(), this, request);
+}
+
+DescribeReservedCacheNodesOutcomeCallable ElastiCacheClient::DescribeReservedCacheNodesCallable(DescribeReservedCacheNodesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeReservedCacheNodes, Aws::Client::RejectedCallOutcome<DescribeReservedCacheNodesOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DescribeReservedCacheNodesAsync(const DescribeReservedCacheNodesRequest& request, const DescribeReservedCacheNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DescribeReservedCacheNodesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeReservedCacheNodesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedCacheNodesOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DescribeReservedCacheNodesAsync(DescribeReservedCacheNodesRequest&& request, const DescribeReservedCacheNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeReservedCacheNodesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedCacheNodesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DescribeReservedCacheNodesAsyncHelper(const DescribeReservedCacheNodesRequest& request, const DescribeReservedCacheNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -894,12 +1144,22 @@ DescribeReservedCacheNodesOfferingsOutcome ElastiCacheClient::DescribeReservedCa
 
 DescribeReservedCacheNodesOfferingsOutcomeCallable ElastiCacheClient::DescribeReservedCacheNodesOfferingsCallable(const DescribeReservedCacheNodesOfferingsRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DescribeReservedCacheNodesOfferings, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeReservedCacheNodesOfferings, Aws::Client::RejectedCallOutcome<DescribeReservedCacheNodesOfferingsOutcome>(), this, request);
+}
+
+DescribeReservedCacheNodesOfferingsOutcomeCallable ElastiCacheClient::DescribeReservedCacheNodesOfferingsCallable(DescribeReservedCacheNodesOfferingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeReservedCacheNodesOfferings, Aws::Client::RejectedCallOutcome<DescribeReservedCacheNodesOfferingsOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DescribeReservedCacheNodesOfferingsAsync(const DescribeReservedCacheNodesOfferingsRequest& request, const DescribeReservedCacheNodesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DescribeReservedCacheNodesOfferingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeReservedCacheNodesOfferingsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedCacheNodesOfferingsOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DescribeReservedCacheNodesOfferingsAsync(DescribeReservedCacheNodesOfferingsRequest&& request, const DescribeReservedCacheNodesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeReservedCacheNodesOfferingsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedCacheNodesOfferingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DescribeReservedCacheNodesOfferingsAsyncHelper(const DescribeReservedCacheNodesOfferingsRequest& request, const DescribeReservedCacheNodesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -924,12 +1184,22 @@ DescribeSnapshotsOutcome ElastiCacheClient::DescribeSnapshots(const DescribeSnap
 
 DescribeSnapshotsOutcomeCallable ElastiCacheClient::DescribeSnapshotsCallable(const DescribeSnapshotsRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::DescribeSnapshots, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeSnapshots, Aws::Client::RejectedCallOutcome<DescribeSnapshotsOutcome>(), this, request);
+}
+
+DescribeSnapshotsOutcomeCallable ElastiCacheClient::DescribeSnapshotsCallable(DescribeSnapshotsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::DescribeSnapshots, Aws::Client::RejectedCallOutcome<DescribeSnapshotsOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::DescribeSnapshotsAsync(const DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::DescribeSnapshotsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeSnapshotsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSnapshotsOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::DescribeSnapshotsAsync(DescribeSnapshotsRequest&& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::DescribeSnapshotsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSnapshotsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::DescribeSnapshotsAsyncHelper(const DescribeSnapshotsRequest& request, const DescribeSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -954,12 +1224,22 @@ ListTagsForResourceOutcome ElastiCacheClient::ListTagsForResource(const ListTags
 
 ListTagsForResourceOutcomeCallable ElastiCacheClient::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::ListTagsForResource, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::ListTagsForResource, Aws::Client::RejectedCallOutcome<ListTagsForResourceOutcome>(), this, request);
+}
+
+ListTagsForResourceOutcomeCallable ElastiCacheClient::ListTagsForResourceCallable(ListTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::ListTagsForResource, Aws::Client::RejectedCallOutcome<ListTagsForResourceOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::ListTagsForResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::ListTagsForResourceAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForResourceOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::ListTagsForResourceAsync(ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::ListTagsForResourceAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -984,12 +1264,22 @@ ModifyCacheClusterOutcome ElastiCacheClient::ModifyCacheCluster(const ModifyCach
 
 ModifyCacheClusterOutcomeCallable ElastiCacheClient::ModifyCacheClusterCallable(const ModifyCacheClusterRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::ModifyCacheCluster, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::ModifyCacheCluster, Aws::Client::RejectedCallOutcome<ModifyCacheClusterOutcome>(), this, request);
+}
+
+ModifyCacheClusterOutcomeCallable ElastiCacheClient::ModifyCacheClusterCallable(ModifyCacheClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::ModifyCacheCluster, Aws::Client::RejectedCallOutcome<ModifyCacheClusterOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::ModifyCacheClusterAsync(const ModifyCacheClusterRequest& request, const ModifyCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::ModifyCacheClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::ModifyCacheClusterAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyCacheClusterOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::ModifyCacheClusterAsync(ModifyCacheClusterRequest&& request, const ModifyCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::ModifyCacheClusterAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyCacheClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::ModifyCacheClusterAsyncHelper(const ModifyCacheClusterRequest& request, const ModifyCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1014,12 +1304,22 @@ ModifyCacheParameterGroupOutcome ElastiCacheClient::ModifyCacheParameterGroup(co
 
 ModifyCacheParameterGroupOutcomeCallable ElastiCacheClient::ModifyCacheParameterGroupCallable(const ModifyCacheParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::ModifyCacheParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::ModifyCacheParameterGroup, Aws::Client::RejectedCallOutcome<ModifyCacheParameterGroupOutcome>(), this, request);
+}
+
+ModifyCacheParameterGroupOutcomeCallable ElastiCacheClient::ModifyCacheParameterGroupCallable(ModifyCacheParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::ModifyCacheParameterGroup, Aws::Client::RejectedCallOutcome<ModifyCacheParameterGroupOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::ModifyCacheParameterGroupAsync(const ModifyCacheParameterGroupRequest& request, const ModifyCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::ModifyCacheParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::ModifyCacheParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyCacheParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::ModifyCacheParameterGroupAsync(ModifyCacheParameterGroupRequest&& request, const ModifyCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::ModifyCacheParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyCacheParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::ModifyCacheParameterGroupAsyncHelper(const ModifyCacheParameterGroupRequest& request, const ModifyCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1044,12 +1344,22 @@ ModifyCacheSubnetGroupOutcome ElastiCacheClient::ModifyCacheSubnetGroup(const Mo
 
 ModifyCacheSubnetGroupOutcomeCallable ElastiCacheClient::ModifyCacheSubnetGroupCallable(const ModifyCacheSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::ModifyCacheSubnetGroup, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::ModifyCacheSubnetGroup, Aws::Client::RejectedCallOutcome<ModifyCacheSubnetGroupOutcome>(), this, request);
+}
+
+ModifyCacheSubnetGroupOutcomeCallable ElastiCacheClient::ModifyCacheSubnetGroupCallable(ModifyCacheSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::ModifyCacheSubnetGroup, Aws::Client::RejectedCallOutcome<ModifyCacheSubnetGroupOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::ModifyCacheSubnetGroupAsync(const ModifyCacheSubnetGroupRequest& request, const ModifyCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::ModifyCacheSubnetGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::ModifyCacheSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyCacheSubnetGroupOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::ModifyCacheSubnetGroupAsync(ModifyCacheSubnetGroupRequest&& request, const ModifyCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::ModifyCacheSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyCacheSubnetGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::ModifyCacheSubnetGroupAsyncHelper(const ModifyCacheSubnetGroupRequest& request, const ModifyCacheSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1074,12 +1384,22 @@ ModifyReplicationGroupOutcome ElastiCacheClient::ModifyReplicationGroup(const Mo
 
 ModifyReplicationGroupOutcomeCallable ElastiCacheClient::ModifyReplicationGroupCallable(const ModifyReplicationGroupRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::ModifyReplicationGroup, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::ModifyReplicationGroup, Aws::Client::RejectedCallOutcome<ModifyReplicationGroupOutcome>(), this, request);
+}
+
+ModifyReplicationGroupOutcomeCallable ElastiCacheClient::ModifyReplicationGroupCallable(ModifyReplicationGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::ModifyReplicationGroup, Aws::Client::RejectedCallOutcome<ModifyReplicationGroupOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::ModifyReplicationGroupAsync(const ModifyReplicationGroupRequest& request, const ModifyReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::ModifyReplicationGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::ModifyReplicationGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyReplicationGroupOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::ModifyReplicationGroupAsync(ModifyReplicationGroupRequest&& request, const ModifyReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::ModifyReplicationGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyReplicationGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::ModifyReplicationGroupAsyncHelper(const ModifyReplicationGroupRequest& request, const ModifyReplicationGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1104,12 +1424,22 @@ PurchaseReservedCacheNodesOfferingOutcome ElastiCacheClient::PurchaseReservedCac
 
 PurchaseReservedCacheNodesOfferingOutcomeCallable ElastiCacheClient::PurchaseReservedCacheNodesOfferingCallable(const PurchaseReservedCacheNodesOfferingRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::PurchaseReservedCacheNodesOffering, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::PurchaseReservedCacheNodesOffering, Aws::Client::RejectedCallOutcome<PurchaseReservedCacheNodesOfferingOutcome>(), this, request);
+}
+
+PurchaseReservedCacheNodesOfferingOutcomeCallable ElastiCacheClient::PurchaseReservedCacheNodesOfferingCallable(PurchaseReservedCacheNodesOfferingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::PurchaseReservedCacheNodesOffering, Aws::Client::RejectedCallOutcome<PurchaseReservedCacheNodesOfferingOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::PurchaseReservedCacheNodesOfferingAsync(const PurchaseReservedCacheNodesOfferingRequest& request, const PurchaseReservedCacheNodesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::PurchaseReservedCacheNodesOfferingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::PurchaseReservedCacheNodesOfferingAsyncHelper, Aws::Client::RejectedAsyncCall<PurchaseReservedCacheNodesOfferingOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::PurchaseReservedCacheNodesOfferingAsync(PurchaseReservedCacheNodesOfferingRequest&& request, const PurchaseReservedCacheNodesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::PurchaseReservedCacheNodesOfferingAsyncHelper, Aws::Client::RejectedAsyncCall<PurchaseReservedCacheNodesOfferingOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::PurchaseReservedCacheNodesOfferingAsyncHelper(const PurchaseReservedCacheNodesOfferingRequest& request, const PurchaseReservedCacheNodesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1134,12 +1464,22 @@ RebootCacheClusterOutcome ElastiCacheClient::RebootCacheCluster(const RebootCach
 
 RebootCacheClusterOutcomeCallable ElastiCacheClient::RebootCacheClusterCallable(const RebootCacheClusterRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::RebootCacheCluster, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::RebootCacheCluster, Aws::Client::RejectedCallOutcome<RebootCacheClusterOutcome>(), this, request);
+}
+
+RebootCacheClusterOutcomeCallable ElastiCacheClient::RebootCacheClusterCallable(RebootCacheClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::RebootCacheCluster, Aws::Client::RejectedCallOutcome<RebootCacheClusterOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::RebootCacheClusterAsync(const RebootCacheClusterRequest& request, const RebootCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::RebootCacheClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::RebootCacheClusterAsyncHelper, Aws::Client::RejectedAsyncCall<RebootCacheClusterOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::RebootCacheClusterAsync(RebootCacheClusterRequest&& request, const RebootCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::RebootCacheClusterAsyncHelper, Aws::Client::RejectedAsyncCall<RebootCacheClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::RebootCacheClusterAsyncHelper(const RebootCacheClusterRequest& request, const RebootCacheClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1164,12 +1504,22 @@ RemoveTagsFromResourceOutcome ElastiCacheClient::RemoveTagsFromResource(const Re
 
 RemoveTagsFromResourceOutcomeCallable ElastiCacheClient::RemoveTagsFromResourceCallable(const RemoveTagsFromResourceRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::RemoveTagsFromResource, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::RemoveTagsFromResource, Aws::Client::RejectedCallOutcome<RemoveTagsFromResourceOutcome>(), this, request);
+}
+
+RemoveTagsFromResourceOutcomeCallable ElastiCacheClient::RemoveTagsFromResourceCallable(RemoveTagsFromResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::RemoveTagsFromResource, Aws::Client::RejectedCallOutcome<RemoveTagsFromResourceOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::RemoveTagsFromResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::RemoveTagsFromResourceAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsFromResourceOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::RemoveTagsFromResourceAsync(RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::RemoveTagsFromResourceAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsFromResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::RemoveTagsFromResourceAsyncHelper(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1194,12 +1544,22 @@ ResetCacheParameterGroupOutcome ElastiCacheClient::ResetCacheParameterGroup(cons
 
 ResetCacheParameterGroupOutcomeCallable ElastiCacheClient::ResetCacheParameterGroupCallable(const ResetCacheParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::ResetCacheParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::ResetCacheParameterGroup, Aws::Client::RejectedCallOutcome<ResetCacheParameterGroupOutcome>(), this, request);
+}
+
+ResetCacheParameterGroupOutcomeCallable ElastiCacheClient::ResetCacheParameterGroupCallable(ResetCacheParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::ResetCacheParameterGroup, Aws::Client::RejectedCallOutcome<ResetCacheParameterGroupOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::ResetCacheParameterGroupAsync(const ResetCacheParameterGroupRequest& request, const ResetCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::ResetCacheParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::ResetCacheParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ResetCacheParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::ResetCacheParameterGroupAsync(ResetCacheParameterGroupRequest&& request, const ResetCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::ResetCacheParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ResetCacheParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::ResetCacheParameterGroupAsyncHelper(const ResetCacheParameterGroupRequest& request, const ResetCacheParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1224,12 +1584,22 @@ RevokeCacheSecurityGroupIngressOutcome ElastiCacheClient::RevokeCacheSecurityGro
 
 RevokeCacheSecurityGroupIngressOutcomeCallable ElastiCacheClient::RevokeCacheSecurityGroupIngressCallable(const RevokeCacheSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, &ElastiCacheClient::RevokeCacheSecurityGroupIngress, this, request);
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::RevokeCacheSecurityGroupIngress, Aws::Client::RejectedCallOutcome<RevokeCacheSecurityGroupIngressOutcome>(), this, request);
+}
+
+RevokeCacheSecurityGroupIngressOutcomeCallable ElastiCacheClient::RevokeCacheSecurityGroupIngressCallable(RevokeCacheSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElastiCacheClient::RevokeCacheSecurityGroupIngress, Aws::Client::RejectedCallOutcome<RevokeCacheSecurityGroupIngressOutcome>(), this, std::move(request));
 }
 
 void ElastiCacheClient::RevokeCacheSecurityGroupIngressAsync(const RevokeCacheSecurityGroupIngressRequest& request, const RevokeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElastiCacheClient::RevokeCacheSecurityGroupIngressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElastiCacheClient::RevokeCacheSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<RevokeCacheSecurityGroupIngressOutcome>(), this, request, handler, context);
+}
+
+void ElastiCacheClient::RevokeCacheSecurityGroupIngressAsync(RevokeCacheSecurityGroupIngressRequest&& request, const RevokeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElastiCacheClient::RevokeCacheSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<RevokeCacheSecurityGroupIngressOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElastiCacheClient::RevokeCacheSecurityGroupIngressAsyncHelper(const RevokeCacheSecurityGroupIngressRequest& request, const RevokeCacheSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -47,6 +47,43 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/elasticbeanstalk/model/AbortEnvironmentUpdateRequest.h>
+#include <aws/elasticbeanstalk/model/CheckDNSAvailabilityRequest.h>
+#include <aws/elasticbeanstalk/model/ComposeEnvironmentsRequest.h>
+#include <aws/elasticbeanstalk/model/CreateApplicationRequest.h>
+#include <aws/elasticbeanstalk/model/CreateApplicationVersionRequest.h>
+#include <aws/elasticbeanstalk/model/CreateConfigurationTemplateRequest.h>
+#include <aws/elasticbeanstalk/model/CreateEnvironmentRequest.h>
+#include <aws/elasticbeanstalk/model/CreateStorageLocationRequest.h>
+#include <aws/elasticbeanstalk/model/DeleteApplicationRequest.h>
+#include <aws/elasticbeanstalk/model/DeleteApplicationVersionRequest.h>
+#include <aws/elasticbeanstalk/model/DeleteConfigurationTemplateRequest.h>
+#include <aws/elasticbeanstalk/model/DeleteEnvironmentConfigurationRequest.h>
+#include <aws/elasticbeanstalk/model/DescribeApplicationVersionsRequest.h>
+#include <aws/elasticbeanstalk/model/DescribeApplicationsRequest.h>
+#include <aws/elasticbeanstalk/model/DescribeConfigurationOptionsRequest.h>
+#include <aws/elasticbeanstalk/model/DescribeConfigurationSettingsRequest.h>
+#include <aws/elasticbeanstalk/model/DescribeEnvironmentHealthRequest.h>
+#include <aws/elasticbeanstalk/model/DescribeEnvironmentResourcesRequest.h>
+#include <aws/elasticbeanstalk/model/DescribeEnvironmentsRequest.h>
+#include <aws/elasticbeanstalk/model/DescribeEventsRequest.h>
+#include <aws/elasticbeanstalk/model/DescribeInstancesHealthRequest.h>
+#include <aws/elasticbeanstalk/model/ListAvailableSolutionStacksRequest.h>
+#include <aws/elasticbeanstalk/model/RebuildEnvironmentRequest.h>
+#include <aws/elasticbeanstalk/model/RequestEnvironmentInfoRequest.h>
+#include <aws/elasticbeanstalk/model/RestartAppServerRequest.h>
+#include <aws/elasticbeanstalk/model/RetrieveEnvironmentInfoRequest.h>
+#include <aws/elasticbeanstalk/model/SwapEnvironmentCNAMEsRequest.h>
+#include <aws/elasticbeanstalk/model/TerminateEnvironmentRequest.h>
+#include <aws/elasticbeanstalk/model/UpdateApplicationRequest.h>
+#include <aws/elasticbeanstalk/model/UpdateApplicationVersionRequest.h>
+#include <aws/elasticbeanstalk/model/UpdateConfigurationTemplateRequest.h>
+#include <aws/elasticbeanstalk/model/UpdateEnvironmentRequest.h>
+#include <aws/elasticbeanstalk/model/ValidateConfigurationSettingsRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -288,6 +325,11 @@ namespace Model
          */
         virtual Model::AbortEnvironmentUpdateOutcomeCallable AbortEnvironmentUpdateCallable(const Model::AbortEnvironmentUpdateRequest& request) const;
 
+        /**
+         * Same as AbortEnvironmentUpdateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AbortEnvironmentUpdateOutcomeCallable AbortEnvironmentUpdateCallable(Model::AbortEnvironmentUpdateRequest&& request) const;
+
         /**
          * <p>Cancels in-progress environment configuration update or application version
          * deployment.</p>
@@ -296,6 +338,11 @@ namespace Model
          */
         virtual void AbortEnvironmentUpdateAsync(const Model::AbortEnvironmentUpdateRequest& request, const AbortEnvironmentUpdateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AbortEnvironmentUpdateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AbortEnvironmentUpdateAsync(Model::AbortEnvironmentUpdateRequest&& request, const AbortEnvironmentUpdateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Checks if the specified CNAME is available. </p>
          */
@@ -308,6 +355,11 @@ namespace Model
          */
         virtual Model::CheckDNSAvailabilityOutcomeCallable CheckDNSAvailabilityCallable(const Model::CheckDNSAvailabilityRequest& request) const;
 
+        /**
+         * Same as CheckDNSAvailabilityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CheckDNSAvailabilityOutcomeCallable CheckDNSAvailabilityCallable(Model::CheckDNSAvailabilityRequest&& request) const;
+
         /**
          * <p> Checks if the specified CNAME is available. </p>
          *
@@ -315,6 +367,11 @@ namespace Model
          */
         virtual void CheckDNSAvailabilityAsync(const Model::CheckDNSAvailabilityRequest& request, const CheckDNSAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CheckDNSAvailabilityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CheckDNSAvailabilityAsync(Model::CheckDNSAvailabilityRequest&& request, const CheckDNSAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Create or update a group of environments that each run a separate component
          * of a single application. Takes a list of version labels that specify application
@@ -339,6 +396,11 @@ namespace Model
          */
         virtual Model::ComposeEnvironmentsOutcomeCallable ComposeEnvironmentsCallable(const Model::ComposeEnvironmentsRequest& request) const;
 
+        /**
+         * Same as ComposeEnvironmentsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ComposeEnvironmentsOutcomeCallable ComposeEnvironmentsCallable(Model::ComposeEnvironmentsRequest&& request) const;
+
         /**
          * <p>Create or update a group of environments that each run a separate component
          * of a single application. Takes a list of version labels that specify application
@@ -352,6 +414,11 @@ namespace Model
          */
         virtual void ComposeEnvironmentsAsync(const Model::ComposeEnvironmentsRequest& request, const ComposeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ComposeEnvironmentsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ComposeEnvironmentsAsync(Model::ComposeEnvironmentsRequest&& request, const ComposeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates an application that has one configuration template named
          * <code>default</code> and no application versions. </p>
@@ -366,6 +433,11 @@ namespace Model
          */
         virtual Model::CreateApplicationOutcomeCallable CreateApplicationCallable(const Model::CreateApplicationRequest& request) const;
 
+        /**
+         * Same as CreateApplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateApplicationOutcomeCallable CreateApplicationCallable(Model::CreateApplicationRequest&& request) const;
+
         /**
          * <p> Creates an application that has one configuration template named
          * <code>default</code> and no application versions. </p>
@@ -374,6 +446,11 @@ namespace Model
          */
         virtual void CreateApplicationAsync(const Model::CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateApplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateApplicationAsync(Model::CreateApplicationRequest&& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an application version for the specified application.</p> <note>Once
          * you create an application version with a specified Amazon S3 bucket and key
@@ -394,6 +471,11 @@ namespace Model
          */
         virtual Model::CreateApplicationVersionOutcomeCallable CreateApplicationVersionCallable(const Model::CreateApplicationVersionRequest& request) const;
 
+        /**
+         * Same as CreateApplicationVersionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateApplicationVersionOutcomeCallable CreateApplicationVersionCallable(Model::CreateApplicationVersionRequest&& request) const;
+
         /**
          * <p>Creates an application version for the specified application.</p> <note>Once
          * you create an application version with a specified Amazon S3 bucket and key
@@ -405,6 +487,11 @@ namespace Model
          */
         virtual void CreateApplicationVersionAsync(const Model::CreateApplicationVersionRequest& request, const CreateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateApplicationVersionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateApplicationVersionAsync(Model::CreateApplicationVersionRequest&& request, const CreateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a configuration template. Templates are associated with a specific
          * application and are used to deploy different versions of the application with
@@ -427,6 +514,11 @@ namespace Model
          */
         virtual Model::CreateConfigurationTemplateOutcomeCallable CreateConfigurationTemplateCallable(const Model::CreateConfigurationTemplateRequest& request) const;
 
+        /**
+         * Same as CreateConfigurationTemplateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateConfigurationTemplateOutcomeCallable CreateConfigurationTemplateCallable(Model::CreateConfigurationTemplateRequest&& request) const;
+
         /**
          * <p>Creates a configuration template. Templates are associated with a specific
          * application and are used to deploy different versions of the application with
@@ -439,6 +531,11 @@ namespace Model
          */
         virtual void CreateConfigurationTemplateAsync(const Model::CreateConfigurationTemplateRequest& request, const CreateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateConfigurationTemplateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateConfigurationTemplateAsync(Model::CreateConfigurationTemplateRequest&& request, const CreateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Launches an environment for the specified application using the specified
          * configuration. </p>
@@ -453,6 +550,11 @@ namespace Model
          */
         virtual Model::CreateEnvironmentOutcomeCallable CreateEnvironmentCallable(const Model::CreateEnvironmentRequest& request) const;
 
+        /**
+         * Same as CreateEnvironmentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateEnvironmentOutcomeCallable CreateEnvironmentCallable(Model::CreateEnvironmentRequest&& request) const;
+
         /**
          * <p> Launches an environment for the specified application using the specified
          * configuration. </p>
@@ -461,6 +563,11 @@ namespace Model
          */
         virtual void CreateEnvironmentAsync(const Model::CreateEnvironmentRequest& request, const CreateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateEnvironmentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateEnvironmentAsync(Model::CreateEnvironmentRequest&& request, const CreateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates the Amazon S3 storage location for the account. </p> <p> This
          * location is used to store user log files. </p>
@@ -475,6 +582,11 @@ namespace Model
          */
         virtual Model::CreateStorageLocationOutcomeCallable CreateStorageLocationCallable(const Model::CreateStorageLocationRequest& request) const;
 
+        /**
+         * Same as CreateStorageLocationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateStorageLocationOutcomeCallable CreateStorageLocationCallable(Model::CreateStorageLocationRequest&& request) const;
+
         /**
          * <p> Creates the Amazon S3 storage location for the account. </p> <p> This
          * location is used to store user log files. </p>
@@ -483,6 +595,11 @@ namespace Model
          */
         virtual void CreateStorageLocationAsync(const Model::CreateStorageLocationRequest& request, const CreateStorageLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateStorageLocationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateStorageLocationAsync(Model::CreateStorageLocationRequest&& request, const CreateStorageLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the specified application along with all associated versions and
          * configurations. The application versions will not be deleted from your Amazon S3
@@ -501,6 +618,11 @@ namespace Model
          */
         virtual Model::DeleteApplicationOutcomeCallable DeleteApplicationCallable(const Model::DeleteApplicationRequest& request) const;
 
+        /**
+         * Same as DeleteApplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteApplicationOutcomeCallable DeleteApplicationCallable(Model::DeleteApplicationRequest&& request) const;
+
         /**
          * <p> Deletes the specified application along with all associated versions and
          * configurations. The application versions will not be deleted from your Amazon S3
@@ -511,6 +633,11 @@ namespace Model
          */
         virtual void DeleteApplicationAsync(const Model::DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteApplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteApplicationAsync(Model::DeleteApplicationRequest&& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the specified version from the specified application. </p> <note>You
          * cannot delete an application version that is associated with a running
@@ -527,6 +654,11 @@ namespace Model
          */
         virtual Model::DeleteApplicationVersionOutcomeCallable DeleteApplicationVersionCallable(const Model::DeleteApplicationVersionRequest& request) const;
 
+        /**
+         * Same as DeleteApplicationVersionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteApplicationVersionOutcomeCallable DeleteApplicationVersionCallable(Model::DeleteApplicationVersionRequest&& request) const;
+
         /**
          * <p> Deletes the specified version from the specified application. </p> <note>You
          * cannot delete an application version that is associated with a running
@@ -536,6 +668,11 @@ namespace Model
          */
         virtual void DeleteApplicationVersionAsync(const Model::DeleteApplicationVersionRequest& request, const DeleteApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteApplicationVersionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteApplicationVersionAsync(Model::DeleteApplicationVersionRequest&& request, const DeleteApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified configuration template.</p> <note>When you launch an
          * environment using a configuration template, the environment gets a copy of the
@@ -554,6 +691,11 @@ namespace Model
          */
         virtual Model::DeleteConfigurationTemplateOutcomeCallable DeleteConfigurationTemplateCallable(const Model::DeleteConfigurationTemplateRequest& request) const;
 
+        /**
+         * Same as DeleteConfigurationTemplateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteConfigurationTemplateOutcomeCallable DeleteConfigurationTemplateCallable(Model::DeleteConfigurationTemplateRequest&& request) const;
+
         /**
          * <p>Deletes the specified configuration template.</p> <note>When you launch an
          * environment using a configuration template, the environment gets a copy of the
@@ -564,6 +706,11 @@ namespace Model
          */
         virtual void DeleteConfigurationTemplateAsync(const Model::DeleteConfigurationTemplateRequest& request, const DeleteConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteConfigurationTemplateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteConfigurationTemplateAsync(Model::DeleteConfigurationTemplateRequest&& request, const DeleteConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the draft configuration associated with the running environment.
          * </p> <p> Updating a running environment with any configuration changes creates a
@@ -588,6 +735,11 @@ namespace Model
          */
         virtual Model::DeleteEnvironmentConfigurationOutcomeCallable DeleteEnvironmentConfigurationCallable(const Model::DeleteEnvironmentConfigurationRequest& request) const;
 
+        /**
+         * Same as DeleteEnvironmentConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteEnvironmentConfigurationOutcomeCallable DeleteEnvironmentConfigurationCallable(Model::DeleteEnvironmentConfigurationRequest&& request) const;
+
         /**
          * <p> Deletes the draft configuration associated with the running environment.
          * </p> <p> Updating a running environment with any configuration changes creates a
@@ -601,6 +753,11 @@ namespace Model
          */
         virtual void DeleteEnvironmentConfigurationAsync(const Model::DeleteEnvironmentConfigurationRequest& request, const DeleteEnvironmentConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteEnvironmentConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteEnvironmentConfigurationAsync(Model::DeleteEnvironmentConfigurationRequest&& request, const DeleteEnvironmentConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieve a list of application versions stored in your AWS Elastic Beanstalk
          * storage bucket.</p>
@@ -615,6 +772,11 @@ namespace Model
          */
         virtual Model::DescribeApplicationVersionsOutcomeCallable DescribeApplicationVersionsCallable(const Model::DescribeApplicationVersionsRequest& request) const;
 
+        /**
+         * Same as DescribeApplicationVersionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeApplicationVersionsOutcomeCallable DescribeApplicationVersionsCallable(Model::DescribeApplicationVersionsRequest&& request) const;
+
         /**
          * <p>Retrieve a list of application versions stored in your AWS Elastic Beanstalk
          * storage bucket.</p>
@@ -623,6 +785,11 @@ namespace Model
          */
         virtual void DescribeApplicationVersionsAsync(const Model::DescribeApplicationVersionsRequest& request, const DescribeApplicationVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeApplicationVersionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeApplicationVersionsAsync(Model::DescribeApplicationVersionsRequest&& request, const DescribeApplicationVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the descriptions of existing applications.</p>
          */
@@ -635,6 +802,11 @@ namespace Model
          */
         virtual Model::DescribeApplicationsOutcomeCallable DescribeApplicationsCallable(const Model::DescribeApplicationsRequest& request) const;
 
+        /**
+         * Same as DescribeApplicationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeApplicationsOutcomeCallable DescribeApplicationsCallable(Model::DescribeApplicationsRequest&& request) const;
+
         /**
          * <p>Returns the descriptions of existing applications.</p>
          *
@@ -642,6 +814,11 @@ namespace Model
          */
         virtual void DescribeApplicationsAsync(const Model::DescribeApplicationsRequest& request, const DescribeApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeApplicationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeApplicationsAsync(Model::DescribeApplicationsRequest&& request, const DescribeApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Describes the configuration options that are used in a particular
          * configuration template or environment, or that a specified solution stack
@@ -662,6 +839,11 @@ namespace Model
          */
         virtual Model::DescribeConfigurationOptionsOutcomeCallable DescribeConfigurationOptionsCallable(const Model::DescribeConfigurationOptionsRequest& request) const;
 
+        /**
+         * Same as DescribeConfigurationOptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeConfigurationOptionsOutcomeCallable DescribeConfigurationOptionsCallable(Model::DescribeConfigurationOptionsRequest&& request) const;
+
         /**
          * <p> Describes the configuration options that are used in a particular
          * configuration template or environment, or that a specified solution stack
@@ -673,6 +855,11 @@ namespace Model
          */
         virtual void DescribeConfigurationOptionsAsync(const Model::DescribeConfigurationOptionsRequest& request, const DescribeConfigurationOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConfigurationOptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeConfigurationOptionsAsync(Model::DescribeConfigurationOptionsRequest&& request, const DescribeConfigurationOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a description of the settings for the specified configuration set,
          * that is, either a configuration template or the configuration set associated
@@ -699,6 +886,11 @@ namespace Model
          */
         virtual Model::DescribeConfigurationSettingsOutcomeCallable DescribeConfigurationSettingsCallable(const Model::DescribeConfigurationSettingsRequest& request) const;
 
+        /**
+         * Same as DescribeConfigurationSettingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeConfigurationSettingsOutcomeCallable DescribeConfigurationSettingsCallable(Model::DescribeConfigurationSettingsRequest&& request) const;
+
         /**
          * <p> Returns a description of the settings for the specified configuration set,
          * that is, either a configuration template or the configuration set associated
@@ -713,6 +905,11 @@ namespace Model
          */
         virtual void DescribeConfigurationSettingsAsync(const Model::DescribeConfigurationSettingsRequest& request, const DescribeConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeConfigurationSettingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeConfigurationSettingsAsync(Model::DescribeConfigurationSettingsRequest&& request, const DescribeConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the overall health of the specified environment.
          * The <b>DescribeEnvironmentHealth</b> operation is only available with AWS
@@ -729,6 +926,11 @@ namespace Model
          */
         virtual Model::DescribeEnvironmentHealthOutcomeCallable DescribeEnvironmentHealthCallable(const Model::DescribeEnvironmentHealthRequest& request) const;
 
+        /**
+         * Same as DescribeEnvironmentHealthCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEnvironmentHealthOutcomeCallable DescribeEnvironmentHealthCallable(Model::DescribeEnvironmentHealthRequest&& request) const;
+
         /**
          * <p>Returns information about the overall health of the specified environment.
          * The <b>DescribeEnvironmentHealth</b> operation is only available with AWS
@@ -738,6 +940,11 @@ namespace Model
          */
         virtual void DescribeEnvironmentHealthAsync(const Model::DescribeEnvironmentHealthRequest& request, const DescribeEnvironmentHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEnvironmentHealthAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEnvironmentHealthAsync(Model::DescribeEnvironmentHealthRequest&& request, const DescribeEnvironmentHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns AWS resources for this environment.</p>
          */
@@ -750,6 +957,11 @@ namespace Model
          */
         virtual Model::DescribeEnvironmentResourcesOutcomeCallable DescribeEnvironmentResourcesCallable(const Model::DescribeEnvironmentResourcesRequest& request) const;
 
+        /**
+         * Same as DescribeEnvironmentResourcesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEnvironmentResourcesOutcomeCallable DescribeEnvironmentResourcesCallable(Model::DescribeEnvironmentResourcesRequest&& request) const;
+
         /**
          * <p>Returns AWS resources for this environment.</p>
          *
@@ -757,6 +969,11 @@ namespace Model
          */
         virtual void DescribeEnvironmentResourcesAsync(const Model::DescribeEnvironmentResourcesRequest& request, const DescribeEnvironmentResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEnvironmentResourcesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEnvironmentResourcesAsync(Model::DescribeEnvironmentResourcesRequest&& request, const DescribeEnvironmentResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns descriptions for existing environments.</p>
          */
@@ -769,6 +986,11 @@ namespace Model
          */
         virtual Model::DescribeEnvironmentsOutcomeCallable DescribeEnvironmentsCallable(const Model::DescribeEnvironmentsRequest& request) const;
 
+        /**
+         * Same as DescribeEnvironmentsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEnvironmentsOutcomeCallable DescribeEnvironmentsCallable(Model::DescribeEnvironmentsRequest&& request) const;
+
         /**
          * <p>Returns descriptions for existing environments.</p>
          *
@@ -776,6 +998,11 @@ namespace Model
          */
         virtual void DescribeEnvironmentsAsync(const Model::DescribeEnvironmentsRequest& request, const DescribeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEnvironmentsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEnvironmentsAsync(Model::DescribeEnvironmentsRequest&& request, const DescribeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns list of event descriptions matching criteria up to the last 6
          * weeks.</p> <note> This action returns the most recent 1,000 events from the
@@ -792,6 +1019,11 @@ namespace Model
          */
         virtual Model::DescribeEventsOutcomeCallable DescribeEventsCallable(const Model::DescribeEventsRequest& request) const;
 
+        /**
+         * Same as DescribeEventsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEventsOutcomeCallable DescribeEventsCallable(Model::DescribeEventsRequest&& request) const;
+
         /**
          * <p>Returns list of event descriptions matching criteria up to the last 6
          * weeks.</p> <note> This action returns the most recent 1,000 events from the
@@ -801,6 +1033,11 @@ namespace Model
          */
         virtual void DescribeEventsAsync(const Model::DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEventsAsync(Model::DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns more detailed information about the health of the specified instances
          * (for example, CPU utilization, load average, and causes). The
@@ -819,6 +1056,11 @@ namespace Model
          */
         virtual Model::DescribeInstancesHealthOutcomeCallable DescribeInstancesHealthCallable(const Model::DescribeInstancesHealthRequest& request) const;
 
+        /**
+         * Same as DescribeInstancesHealthCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeInstancesHealthOutcomeCallable DescribeInstancesHealthCallable(Model::DescribeInstancesHealthRequest&& request) const;
+
         /**
          * <p>Returns more detailed information about the health of the specified instances
          * (for example, CPU utilization, load average, and causes). The
@@ -829,6 +1071,11 @@ namespace Model
          */
         virtual void DescribeInstancesHealthAsync(const Model::DescribeInstancesHealthRequest& request, const DescribeInstancesHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInstancesHealthAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeInstancesHealthAsync(Model::DescribeInstancesHealthRequest&& request, const DescribeInstancesHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of the available solution stack names. </p>
          */
@@ -841,6 +1088,11 @@ namespace Model
          */
         virtual Model::ListAvailableSolutionStacksOutcomeCallable ListAvailableSolutionStacksCallable(const Model::ListAvailableSolutionStacksRequest& request) const;
 
+        /**
+         * Same as ListAvailableSolutionStacksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAvailableSolutionStacksOutcomeCallable ListAvailableSolutionStacksCallable(Model::ListAvailableSolutionStacksRequest&& request) const;
+
         /**
          * <p> Returns a list of the available solution stack names. </p>
          *
@@ -848,6 +1100,11 @@ namespace Model
          */
         virtual void ListAvailableSolutionStacksAsync(const Model::ListAvailableSolutionStacksRequest& request, const ListAvailableSolutionStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAvailableSolutionStacksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAvailableSolutionStacksAsync(Model::ListAvailableSolutionStacksRequest&& request, const ListAvailableSolutionStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes and recreates all of the AWS resources (for example: the Auto
          * Scaling group, load balancer, etc.) for a specified environment and forces a
@@ -864,6 +1121,11 @@ namespace Model
          */
         virtual Model::RebuildEnvironmentOutcomeCallable RebuildEnvironmentCallable(const Model::RebuildEnvironmentRequest& request) const;
 
+        /**
+         * Same as RebuildEnvironmentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RebuildEnvironmentOutcomeCallable RebuildEnvironmentCallable(Model::RebuildEnvironmentRequest&& request) const;
+
         /**
          * <p> Deletes and recreates all of the AWS resources (for example: the Auto
          * Scaling group, load balancer, etc.) for a specified environment and forces a
@@ -873,6 +1135,11 @@ namespace Model
          */
         virtual void RebuildEnvironmentAsync(const Model::RebuildEnvironmentRequest& request, const RebuildEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebuildEnvironmentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RebuildEnvironmentAsync(Model::RebuildEnvironmentRequest&& request, const RebuildEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Initiates a request to compile the specified type of information of the
          * deployed environment. </p> <p> Setting the <code>InfoType</code> to
@@ -901,6 +1168,11 @@ namespace Model
          */
         virtual Model::RequestEnvironmentInfoOutcomeCallable RequestEnvironmentInfoCallable(const Model::RequestEnvironmentInfoRequest& request) const;
 
+        /**
+         * Same as RequestEnvironmentInfoCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RequestEnvironmentInfoOutcomeCallable RequestEnvironmentInfoCallable(Model::RequestEnvironmentInfoRequest&& request) const;
+
         /**
          * <p> Initiates a request to compile the specified type of information of the
          * deployed environment. </p> <p> Setting the <code>InfoType</code> to
@@ -916,6 +1188,11 @@ namespace Model
          */
         virtual void RequestEnvironmentInfoAsync(const Model::RequestEnvironmentInfoRequest& request, const RequestEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RequestEnvironmentInfoAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RequestEnvironmentInfoAsync(Model::RequestEnvironmentInfoRequest&& request, const RequestEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Causes the environment to restart the application container server running
          * on each Amazon EC2 instance. </p>
@@ -930,6 +1207,11 @@ namespace Model
          */
         virtual Model::RestartAppServerOutcomeCallable RestartAppServerCallable(const Model::RestartAppServerRequest& request) const;
 
+        /**
+         * Same as RestartAppServerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RestartAppServerOutcomeCallable RestartAppServerCallable(Model::RestartAppServerRequest&& request) const;
+
         /**
          * <p> Causes the environment to restart the application container server running
          * on each Amazon EC2 instance. </p>
@@ -938,6 +1220,11 @@ namespace Model
          */
         virtual void RestartAppServerAsync(const Model::RestartAppServerRequest& request, const RestartAppServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestartAppServerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RestartAppServerAsync(Model::RestartAppServerRequest&& request, const RestartAppServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Retrieves the compiled information from a <a>RequestEnvironmentInfo</a>
          * request. </p> <p>Related Topics</p> <ul> <li> <a>RequestEnvironmentInfo</a>
@@ -954,6 +1241,11 @@ namespace Model
          */
         virtual Model::RetrieveEnvironmentInfoOutcomeCallable RetrieveEnvironmentInfoCallable(const Model::RetrieveEnvironmentInfoRequest& request) const;
 
+        /**
+         * Same as RetrieveEnvironmentInfoCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RetrieveEnvironmentInfoOutcomeCallable RetrieveEnvironmentInfoCallable(Model::RetrieveEnvironmentInfoRequest&& request) const;
+
         /**
          * <p> Retrieves the compiled information from a <a>RequestEnvironmentInfo</a>
          * request. </p> <p>Related Topics</p> <ul> <li> <a>RequestEnvironmentInfo</a>
@@ -963,6 +1255,11 @@ namespace Model
          */
         virtual void RetrieveEnvironmentInfoAsync(const Model::RetrieveEnvironmentInfoRequest& request, const RetrieveEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RetrieveEnvironmentInfoAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RetrieveEnvironmentInfoAsync(Model::RetrieveEnvironmentInfoRequest&& request, const RetrieveEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Swaps the CNAMEs of two environments. </p>
          */
@@ -975,6 +1272,11 @@ namespace Model
          */
         virtual Model::SwapEnvironmentCNAMEsOutcomeCallable SwapEnvironmentCNAMEsCallable(const Model::SwapEnvironmentCNAMEsRequest& request) const;
 
+        /**
+         * Same as SwapEnvironmentCNAMEsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SwapEnvironmentCNAMEsOutcomeCallable SwapEnvironmentCNAMEsCallable(Model::SwapEnvironmentCNAMEsRequest&& request) const;
+
         /**
          * <p> Swaps the CNAMEs of two environments. </p>
          *
@@ -982,6 +1284,11 @@ namespace Model
          */
         virtual void SwapEnvironmentCNAMEsAsync(const Model::SwapEnvironmentCNAMEsRequest& request, const SwapEnvironmentCNAMEsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SwapEnvironmentCNAMEsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SwapEnvironmentCNAMEsAsync(Model::SwapEnvironmentCNAMEsRequest&& request, const SwapEnvironmentCNAMEsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Terminates the specified environment. </p>
          */
@@ -994,6 +1301,11 @@ namespace Model
          */
         virtual Model::TerminateEnvironmentOutcomeCallable TerminateEnvironmentCallable(const Model::TerminateEnvironmentRequest& request) const;
 
+        /**
+         * Same as TerminateEnvironmentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::TerminateEnvironmentOutcomeCallable TerminateEnvironmentCallable(Model::TerminateEnvironmentRequest&& request) const;
+
         /**
          * <p> Terminates the specified environment. </p>
          *
@@ -1001,6 +1313,11 @@ namespace Model
          */
         virtual void TerminateEnvironmentAsync(const Model::TerminateEnvironmentRequest& request, const TerminateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TerminateEnvironmentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void TerminateEnvironmentAsync(Model::TerminateEnvironmentRequest&& request, const TerminateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the specified application to have the specified properties. </p>
          * <note> If a property (for example, <code>description</code>) is not provided,
@@ -1019,6 +1336,11 @@ namespace Model
          */
         virtual Model::UpdateApplicationOutcomeCallable UpdateApplicationCallable(const Model::UpdateApplicationRequest& request) const;
 
+        /**
+         * Same as UpdateApplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateApplicationOutcomeCallable UpdateApplicationCallable(Model::UpdateApplicationRequest&& request) const;
+
         /**
          * <p>Updates the specified application to have the specified properties. </p>
          * <note> If a property (for example, <code>description</code>) is not provided,
@@ -1029,6 +1351,11 @@ namespace Model
          */
         virtual void UpdateApplicationAsync(const Model::UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateApplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateApplicationAsync(Model::UpdateApplicationRequest&& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Updates the specified application version to have the specified properties.
          * </p> <note> If a property (for example, <code>description</code>) is not
@@ -1047,6 +1374,11 @@ namespace Model
          */
         virtual Model::UpdateApplicationVersionOutcomeCallable UpdateApplicationVersionCallable(const Model::UpdateApplicationVersionRequest& request) const;
 
+        /**
+         * Same as UpdateApplicationVersionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateApplicationVersionOutcomeCallable UpdateApplicationVersionCallable(Model::UpdateApplicationVersionRequest&& request) const;
+
         /**
          * <p> Updates the specified application version to have the specified properties.
          * </p> <note> If a property (for example, <code>description</code>) is not
@@ -1057,6 +1389,11 @@ namespace Model
          */
         virtual void UpdateApplicationVersionAsync(const Model::UpdateApplicationVersionRequest& request, const UpdateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateApplicationVersionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateApplicationVersionAsync(Model::UpdateApplicationVersionRequest&& request, const UpdateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Updates the specified configuration template to have the specified
          * properties or configuration option values. </p> <note> If a property (for
@@ -1077,6 +1414,11 @@ namespace Model
          */
         virtual Model::UpdateConfigurationTemplateOutcomeCallable UpdateConfigurationTemplateCallable(const Model::UpdateConfigurationTemplateRequest& request) const;
 
+        /**
+         * Same as UpdateConfigurationTemplateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateConfigurationTemplateOutcomeCallable UpdateConfigurationTemplateCallable(Model::UpdateConfigurationTemplateRequest&& request) const;
+
         /**
          * <p> Updates the specified configuration template to have the specified
          * properties or configuration option values. </p> <note> If a property (for
@@ -1088,6 +1430,11 @@ namespace Model
          */
         virtual void UpdateConfigurationTemplateAsync(const Model::UpdateConfigurationTemplateRequest& request, const UpdateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateConfigurationTemplateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateConfigurationTemplateAsync(Model::UpdateConfigurationTemplateRequest&& request, const UpdateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Updates the environment description, deploys a new application version,
          * updates the configuration settings to an entirely new configuration template, or
@@ -1116,6 +1463,11 @@ namespace Model
          */
         virtual Model::UpdateEnvironmentOutcomeCallable UpdateEnvironmentCallable(const Model::UpdateEnvironmentRequest& request) const;
 
+        /**
+         * Same as UpdateEnvironmentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateEnvironmentOutcomeCallable UpdateEnvironmentCallable(Model::UpdateEnvironmentRequest&& request) const;
+
         /**
          * <p> Updates the environment description, deploys a new application version,
          * updates the configuration settings to an entirely new configuration template, or
@@ -1131,6 +1483,11 @@ namespace Model
          */
         virtual void UpdateEnvironmentAsync(const Model::UpdateEnvironmentRequest& request, const UpdateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateEnvironmentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateEnvironmentAsync(Model::UpdateEnvironmentRequest&& request, const UpdateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Takes a set of configuration settings and either a configuration template or
          * environment, and determines whether those values are valid. </p> <p> This action
@@ -1149,6 +1506,11 @@ namespace Model
          */
         virtual Model::ValidateConfigurationSettingsOutcomeCallable ValidateConfigurationSettingsCallable(const Model::ValidateConfigurationSettingsRequest& request) const;
 
+        /**
+         * Same as ValidateConfigurationSettingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ValidateConfigurationSettingsOutcomeCallable ValidateConfigurationSettingsCallable(Model::ValidateConfigurationSettingsRequest&& request) const;
+
         /**
          * <p> Takes a set of configuration settings and either a configuration template or
          * environment, and determines whether those values are valid. </p> <p> This action
@@ -1159,6 +1521,84 @@ namespace Model
          */
         virtual void ValidateConfigurationSettingsAsync(const Model::ValidateConfigurationSettingsRequest& request, const ValidateConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ValidateConfigurationSettingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ValidateConfigurationSettingsAsync(Model::ValidateConfigurationSettingsRequest&& request, const ValidateConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AbortEnvironmentUpdateOutcome> AbortEnvironmentUpdateAwaitable(const Model::AbortEnvironmentUpdateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::AbortEnvironmentUpdate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AbortEnvironmentUpdateOutcome> AbortEnvironmentUpdateAwaitable(Model::AbortEnvironmentUpdateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::AbortEnvironmentUpdate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CheckDNSAvailabilityOutcome> CheckDNSAvailabilityAwaitable(const Model::CheckDNSAvailabilityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::CheckDNSAvailability, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CheckDNSAvailabilityOutcome> CheckDNSAvailabilityAwaitable(Model::CheckDNSAvailabilityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::CheckDNSAvailability, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ComposeEnvironmentsOutcome> ComposeEnvironmentsAwaitable(const Model::ComposeEnvironmentsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::ComposeEnvironments, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ComposeEnvironmentsOutcome> ComposeEnvironmentsAwaitable(Model::ComposeEnvironmentsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::ComposeEnvironments, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateApplicationOutcome> CreateApplicationAwaitable(const Model::CreateApplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::CreateApplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateApplicationOutcome> CreateApplicationAwaitable(Model::CreateApplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::CreateApplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateApplicationVersionOutcome> CreateApplicationVersionAwaitable(const Model::CreateApplicationVersionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::CreateApplicationVersion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateApplicationVersionOutcome> CreateApplicationVersionAwaitable(Model::CreateApplicationVersionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::CreateApplicationVersion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateConfigurationTemplateOutcome> CreateConfigurationTemplateAwaitable(const Model::CreateConfigurationTemplateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::CreateConfigurationTemplate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateConfigurationTemplateOutcome> CreateConfigurationTemplateAwaitable(Model::CreateConfigurationTemplateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::CreateConfigurationTemplate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateEnvironmentOutcome> CreateEnvironmentAwaitable(const Model::CreateEnvironmentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::CreateEnvironment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateEnvironmentOutcome> CreateEnvironmentAwaitable(Model::CreateEnvironmentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::CreateEnvironment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateStorageLocationOutcome> CreateStorageLocationAwaitable(const Model::CreateStorageLocationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::CreateStorageLocation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateStorageLocationOutcome> CreateStorageLocationAwaitable(Model::CreateStorageLocationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::CreateStorageLocation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteApplicationOutcome> DeleteApplicationAwaitable(const Model::DeleteApplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DeleteApplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteApplicationOutcome> DeleteApplicationAwaitable(Model::DeleteApplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DeleteApplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteApplicationVersionOutcome> DeleteApplicationVersionAwaitable(const Model::DeleteApplicationVersionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DeleteApplicationVersion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteApplicationVersionOutcome> DeleteApplicationVersionAwaitable(Model::DeleteApplicationVersionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DeleteApplicationVersion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteConfigurationTemplateOutcome> DeleteConfigurationTemplateAwaitable(const Model::DeleteConfigurationTemplateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DeleteConfigurationTemplate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteConfigurationTemplateOutcome> DeleteConfigurationTemplateAwaitable(Model::DeleteConfigurationTemplateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DeleteConfigurationTemplate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteEnvironmentConfigurationOutcome> DeleteEnvironmentConfigurationAwaitable(const Model::DeleteEnvironmentConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DeleteEnvironmentConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteEnvironmentConfigurationOutcome> DeleteEnvironmentConfigurationAwaitable(Model::DeleteEnvironmentConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DeleteEnvironmentConfiguration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeApplicationVersionsOutcome> DescribeApplicationVersionsAwaitable(const Model::DescribeApplicationVersionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeApplicationVersions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeApplicationVersionsOutcome> DescribeApplicationVersionsAwaitable(Model::DescribeApplicationVersionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeApplicationVersions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeApplicationsOutcome> DescribeApplicationsAwaitable(const Model::DescribeApplicationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeApplications, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeApplicationsOutcome> DescribeApplicationsAwaitable(Model::DescribeApplicationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeApplications, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConfigurationOptionsOutcome> DescribeConfigurationOptionsAwaitable(const Model::DescribeConfigurationOptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeConfigurationOptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConfigurationOptionsOutcome> DescribeConfigurationOptionsAwaitable(Model::DescribeConfigurationOptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeConfigurationOptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConfigurationSettingsOutcome> DescribeConfigurationSettingsAwaitable(const Model::DescribeConfigurationSettingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeConfigurationSettings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeConfigurationSettingsOutcome> DescribeConfigurationSettingsAwaitable(Model::DescribeConfigurationSettingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeConfigurationSettings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEnvironmentHealthOutcome> DescribeEnvironmentHealthAwaitable(const Model::DescribeEnvironmentHealthRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeEnvironmentHealth, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEnvironmentHealthOutcome> DescribeEnvironmentHealthAwaitable(Model::DescribeEnvironmentHealthRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeEnvironmentHealth, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEnvironmentResourcesOutcome> DescribeEnvironmentResourcesAwaitable(const Model::DescribeEnvironmentResourcesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeEnvironmentResources, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEnvironmentResourcesOutcome> DescribeEnvironmentResourcesAwaitable(Model::DescribeEnvironmentResourcesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeEnvironmentResources, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEnvironmentsOutcome> DescribeEnvironmentsAwaitable(const Model::DescribeEnvironmentsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeEnvironments, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEnvironmentsOutcome> DescribeEnvironmentsAwaitable(Model::DescribeEnvironmentsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeEnvironments, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventsOutcome> DescribeEventsAwaitable(const Model::DescribeEventsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeEvents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventsOutcome> DescribeEventsAwaitable(Model::DescribeEventsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeEvents, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInstancesHealthOutcome> DescribeInstancesHealthAwaitable(const Model::DescribeInstancesHealthRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeInstancesHealth, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInstancesHealthOutcome> DescribeInstancesHealthAwaitable(Model::DescribeInstancesHealthRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::DescribeInstancesHealth, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAvailableSolutionStacksOutcome> ListAvailableSolutionStacksAwaitable(const Model::ListAvailableSolutionStacksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::ListAvailableSolutionStacks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAvailableSolutionStacksOutcome> ListAvailableSolutionStacksAwaitable(Model::ListAvailableSolutionStacksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::ListAvailableSolutionStacks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebuildEnvironmentOutcome> RebuildEnvironmentAwaitable(const Model::RebuildEnvironmentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::RebuildEnvironment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebuildEnvironmentOutcome> RebuildEnvironmentAwaitable(Model::RebuildEnvironmentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::RebuildEnvironment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RequestEnvironmentInfoOutcome> RequestEnvironmentInfoAwaitable(const Model::RequestEnvironmentInfoRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::RequestEnvironmentInfo, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RequestEnvironmentInfoOutcome> RequestEnvironmentInfoAwaitable(Model::RequestEnvironmentInfoRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::RequestEnvironmentInfo, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestartAppServerOutcome> RestartAppServerAwaitable(const Model::RestartAppServerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::RestartAppServer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestartAppServerOutcome> RestartAppServerAwaitable(Model::RestartAppServerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::RestartAppServer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RetrieveEnvironmentInfoOutcome> RetrieveEnvironmentInfoAwaitable(const Model::RetrieveEnvironmentInfoRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::RetrieveEnvironmentInfo, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RetrieveEnvironmentInfoOutcome> RetrieveEnvironmentInfoAwaitable(Model::RetrieveEnvironmentInfoRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::RetrieveEnvironmentInfo, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SwapEnvironmentCNAMEsOutcome> SwapEnvironmentCNAMEsAwaitable(const Model::SwapEnvironmentCNAMEsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::SwapEnvironmentCNAMEs, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SwapEnvironmentCNAMEsOutcome> SwapEnvironmentCNAMEsAwaitable(Model::SwapEnvironmentCNAMEsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::SwapEnvironmentCNAMEs, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TerminateEnvironmentOutcome> TerminateEnvironmentAwaitable(const Model::TerminateEnvironmentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::TerminateEnvironment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TerminateEnvironmentOutcome> TerminateEnvironmentAwaitable(Model::TerminateEnvironmentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::TerminateEnvironment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateApplicationOutcome> UpdateApplicationAwaitable(const Model::UpdateApplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::UpdateApplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateApplicationOutcome> UpdateApplicationAwaitable(Model::UpdateApplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::UpdateApplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateApplicationVersionOutcome> UpdateApplicationVersionAwaitable(const Model::UpdateApplicationVersionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::UpdateApplicationVersion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateApplicationVersionOutcome> UpdateApplicationVersionAwaitable(Model::UpdateApplicationVersionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::UpdateApplicationVersion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateConfigurationTemplateOutcome> UpdateConfigurationTemplateAwaitable(const Model::UpdateConfigurationTemplateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::UpdateConfigurationTemplate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateConfigurationTemplateOutcome> UpdateConfigurationTemplateAwaitable(Model::UpdateConfigurationTemplateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::UpdateConfigurationTemplate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateEnvironmentOutcome> UpdateEnvironmentAwaitable(const Model::UpdateEnvironmentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::UpdateEnvironment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateEnvironmentOutcome> UpdateEnvironmentAwaitable(Model::UpdateEnvironmentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::UpdateEnvironment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ValidateConfigurationSettingsOutcome> ValidateConfigurationSettingsAwaitable(const Model::ValidateConfigurationSettingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::ValidateConfigurationSettings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ValidateConfigurationSettingsOutcome> ValidateConfigurationSettingsAwaitable(Model::ValidateConfigurationSettingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticBeanstalkClient::ValidateConfigurationSettings, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
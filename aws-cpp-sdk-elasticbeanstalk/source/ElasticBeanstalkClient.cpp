@@ -140,12 +140,22 @@ AbortEnvironmentUpdateOutcome ElasticBeanstalkClient::AbortEnvironmentUpdate(con
 
 AbortEnvironmentUpdateOutcomeCallable ElasticBeanstalkClient::AbortEnvironmentUpdateCallable(const AbortEnvironmentUpdateRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::AbortEnvironmentUpdate, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::AbortEnvironmentUpdate, Aws::Client::RejectedCallOutcome<AbortEnvironmentUpdateOutcome>(), this, request);
+}
+
+AbortEnvironmentUpdateOutcomeCallable ElasticBeanstalkClient::AbortEnvironmentUpdateCallable(AbortEnvironmentUpdateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::AbortEnvironmentUpdate, Aws::Client::RejectedCallOutcome<AbortEnvironmentUpdateOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::AbortEnvironmentUpdateAsync(const AbortEnvironmentUpdateRequest& request, const AbortEnvironmentUpdateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::AbortEnvironmentUpdateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::AbortEnvironmentUpdateAsyncHelper, Aws::Client::RejectedAsyncCall<AbortEnvironmentUpdateOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::AbortEnvironmentUpdateAsync(AbortEnvironmentUpdateRequest&& request, const AbortEnvironmentUpdateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::AbortEnvironmentUpdateAsyncHelper, Aws::Client::RejectedAsyncCall<AbortEnvironmentUpdateOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::AbortEnvironmentUpdateAsyncHelper(const AbortEnvironmentUpdateRequest& request, const AbortEnvironmentUpdateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -170,12 +180,22 @@ CheckDNSAvailabilityOutcome ElasticBeanstalkClient::CheckDNSAvailability(const C
 
 CheckDNSAvailabilityOutcomeCallable ElasticBeanstalkClient::CheckDNSAvailabilityCallable(const CheckDNSAvailabilityRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::CheckDNSAvailability, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::CheckDNSAvailability, Aws::Client::RejectedCallOutcome<CheckDNSAvailabilityOutcome>(), this, request);
+}
+
+CheckDNSAvailabilityOutcomeCallable ElasticBeanstalkClient::CheckDNSAvailabilityCallable(CheckDNSAvailabilityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::CheckDNSAvailability, Aws::Client::RejectedCallOutcome<CheckDNSAvailabilityOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::CheckDNSAvailabilityAsync(const CheckDNSAvailabilityRequest& request, const CheckDNSAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::CheckDNSAvailabilityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::CheckDNSAvailabilityAsyncHelper, Aws::Client::RejectedAsyncCall<CheckDNSAvailabilityOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::CheckDNSAvailabilityAsync(CheckDNSAvailabilityRequest&& request, const CheckDNSAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::CheckDNSAvailabilityAsyncHelper, Aws::Client::RejectedAsyncCall<CheckDNSAvailabilityOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::CheckDNSAvailabilityAsyncHelper(const CheckDNSAvailabilityRequest& request, const CheckDNSAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -200,12 +220,22 @@ ComposeEnvironmentsOutcome ElasticBeanstalkClient::ComposeEnvironments(const Com
 
 ComposeEnvironmentsOutcomeCallable ElasticBeanstalkClient::ComposeEnvironmentsCallable(const ComposeEnvironmentsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::ComposeEnvironments, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::ComposeEnvironments, Aws::Client::RejectedCallOutcome<ComposeEnvironmentsOutcome>(), this, request);
+}
+
+ComposeEnvironmentsOutcomeCallable ElasticBeanstalkClient::ComposeEnvironmentsCallable(ComposeEnvironmentsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::ComposeEnvironments, Aws::Client::RejectedCallOutcome<ComposeEnvironmentsOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::ComposeEnvironmentsAsync(const ComposeEnvironmentsRequest& request, const ComposeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::ComposeEnvironmentsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::ComposeEnvironmentsAsyncHelper, Aws::Client::RejectedAsyncCall<ComposeEnvironmentsOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::ComposeEnvironmentsAsync(ComposeEnvironmentsRequest&& request, const ComposeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::ComposeEnvironmentsAsyncHelper, Aws::Client::RejectedAsyncCall<ComposeEnvironmentsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::ComposeEnvironmentsAsyncHelper(const ComposeEnvironmentsRequest& request, const ComposeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -230,12 +260,22 @@ CreateApplicationOutcome ElasticBeanstalkClient::CreateApplication(const CreateA
 
 CreateApplicationOutcomeCallable ElasticBeanstalkClient::CreateApplicationCallable(const CreateApplicationRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::CreateApplication, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::CreateApplication, Aws::Client::RejectedCallOutcome<CreateApplicationOutcome>(), this, request);
+}
+
+CreateApplicationOutcomeCallable ElasticBeanstalkClient::CreateApplicationCallable(CreateApplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::CreateApplication, Aws::Client::RejectedCallOutcome<CreateApplicationOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::CreateApplicationAsync(const CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::CreateApplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::CreateApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateApplicationOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::CreateApplicationAsync(CreateApplicationRequest&& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::CreateApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateApplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::CreateApplicationAsyncHelper(const CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -260,12 +300,22 @@ CreateApplicationVersionOutcome ElasticBeanstalkClient::CreateApplicationVersion
 
 CreateApplicationVersionOutcomeCallable ElasticBeanstalkClient::CreateApplicationVersionCallable(const CreateApplicationVersionRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::CreateApplicationVersion, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::CreateApplicationVersion, Aws::Client::RejectedCallOutcome<CreateApplicationVersionOutcome>(), this, request);
+}
+
+CreateApplicationVersionOutcomeCallable ElasticBeanstalkClient::CreateApplicationVersionCallable(CreateApplicationVersionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::CreateApplicationVersion, Aws::Client::RejectedCallOutcome<CreateApplicationVersionOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::CreateApplicationVersionAsync(const CreateApplicationVersionRequest& request, const CreateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::CreateApplicationVersionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::CreateApplicationVersionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateApplicationVersionOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::CreateApplicationVersionAsync(CreateApplicationVersionRequest&& request, const CreateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::CreateApplicationVersionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateApplicationVersionOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::CreateApplicationVersionAsyncHelper(const CreateApplicationVersionRequest& request, const CreateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -290,12 +340,22 @@ CreateConfigurationTemplateOutcome ElasticBeanstalkClient::CreateConfigurationTe
 
 CreateConfigurationTemplateOutcomeCallable ElasticBeanstalkClient::CreateConfigurationTemplateCallable(const CreateConfigurationTemplateRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::CreateConfigurationTemplate, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::CreateConfigurationTemplate, Aws::Client::RejectedCallOutcome<CreateConfigurationTemplateOutcome>(), this, request);
+}
+
+CreateConfigurationTemplateOutcomeCallable ElasticBeanstalkClient::CreateConfigurationTemplateCallable(CreateConfigurationTemplateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::CreateConfigurationTemplate, Aws::Client::RejectedCallOutcome<CreateConfigurationTemplateOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::CreateConfigurationTemplateAsync(const CreateConfigurationTemplateRequest& request, const CreateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::CreateConfigurationTemplateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::CreateConfigurationTemplateAsyncHelper, Aws::Client::RejectedAsyncCall<CreateConfigurationTemplateOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::CreateConfigurationTemplateAsync(CreateConfigurationTemplateRequest&& request, const CreateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::CreateConfigurationTemplateAsyncHelper, Aws::Client::RejectedAsyncCall<CreateConfigurationTemplateOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::CreateConfigurationTemplateAsyncHelper(const CreateConfigurationTemplateRequest& request, const CreateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -320,12 +380,22 @@ CreateEnvironmentOutcome ElasticBeanstalkClient::CreateEnvironment(const CreateE
 
 CreateEnvironmentOutcomeCallable ElasticBeanstalkClient::CreateEnvironmentCallable(const CreateEnvironmentRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::CreateEnvironment, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::CreateEnvironment, Aws::Client::RejectedCallOutcome<CreateEnvironmentOutcome>(), this, request);
+}
+
+CreateEnvironmentOutcomeCallable ElasticBeanstalkClient::CreateEnvironmentCallable(CreateEnvironmentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::CreateEnvironment, Aws::Client::RejectedCallOutcome<CreateEnvironmentOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::CreateEnvironmentAsync(const CreateEnvironmentRequest& request, const CreateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::CreateEnvironmentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::CreateEnvironmentAsyncHelper, Aws::Client::RejectedAsyncCall<CreateEnvironmentOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::CreateEnvironmentAsync(CreateEnvironmentRequest&& request, const CreateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::CreateEnvironmentAsyncHelper, Aws::Client::RejectedAsyncCall<CreateEnvironmentOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::CreateEnvironmentAsyncHelper(const CreateEnvironmentRequest& request, const CreateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -350,12 +420,22 @@ CreateStorageLocationOutcome ElasticBeanstalkClient::CreateStorageLocation(const
 
 CreateStorageLocationOutcomeCallable ElasticBeanstalkClient::CreateStorageLocationCallable(const CreateStorageLocationRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::CreateStorageLocation, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::CreateStorageLocation, Aws::Client::RejectedCallOutcome<CreateStorageLocationOutcome>(), this, request);
+}
+
+CreateStorageLocationOutcomeCallable ElasticBeanstalkClient::CreateStorageLocationCallable(CreateStorageLocationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::CreateStorageLocation, Aws::Client::RejectedCallOutcome<CreateStorageLocationOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::CreateStorageLocationAsync(const CreateStorageLocationRequest& request, const CreateStorageLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::CreateStorageLocationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::CreateStorageLocationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateStorageLocationOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::CreateStorageLocationAsync(CreateStorageLocationRequest&& request, const CreateStorageLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::CreateStorageLocationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateStorageLocationOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::CreateStorageLocationAsyncHelper(const CreateStorageLocationRequest& request, const CreateStorageLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -380,12 +460,22 @@ DeleteApplicationOutcome ElasticBeanstalkClient::DeleteApplication(const DeleteA
 
 DeleteApplicationOutcomeCallable ElasticBeanstalkClient::DeleteApplicationCallable(const DeleteApplicationRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::DeleteApplication, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DeleteApplication, Aws::Client::RejectedCallOutcome<DeleteApplicationOutcome>(), this, request);
+}
+
+DeleteApplicationOutcomeCallable ElasticBeanstalkClient::DeleteApplicationCallable(DeleteApplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DeleteApplication, Aws::Client::RejectedCallOutcome<DeleteApplicationOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::DeleteApplicationAsync(const DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::DeleteApplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DeleteApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteApplicationOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::DeleteApplicationAsync(DeleteApplicationRequest&& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DeleteApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteApplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::DeleteApplicationAsyncHelper(const DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -410,12 +500,22 @@ DeleteApplicationVersionOutcome ElasticBeanstalkClient::DeleteApplicationVersion
 
 DeleteApplicationVersionOutcomeCallable ElasticBeanstalkClient::DeleteApplicationVersionCallable(const DeleteApplicationVersionRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::DeleteApplicationVersion, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DeleteApplicationVersion, Aws::Client::RejectedCallOutcome<DeleteApplicationVersionOutcome>(), this, request);
+}
+
+DeleteApplicationVersionOutcomeCallable ElasticBeanstalkClient::DeleteApplicationVersionCallable(DeleteApplicationVersionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DeleteApplicationVersion, Aws::Client::RejectedCallOutcome<DeleteApplicationVersionOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::DeleteApplicationVersionAsync(const DeleteApplicationVersionRequest& request, const DeleteApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::DeleteApplicationVersionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DeleteApplicationVersionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteApplicationVersionOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::DeleteApplicationVersionAsync(DeleteApplicationVersionRequest&& request, const DeleteApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DeleteApplicationVersionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteApplicationVersionOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::DeleteApplicationVersionAsyncHelper(const DeleteApplicationVersionRequest& request, const DeleteApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -440,12 +540,22 @@ DeleteConfigurationTemplateOutcome ElasticBeanstalkClient::DeleteConfigurationTe
 
 DeleteConfigurationTemplateOutcomeCallable ElasticBeanstalkClient::DeleteConfigurationTemplateCallable(const DeleteConfigurationTemplateRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::DeleteConfigurationTemplate, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DeleteConfigurationTemplate, Aws::Client::RejectedCallOutcome<DeleteConfigurationTemplateOutcome>(), this, request);
+}
+
+DeleteConfigurationTemplateOutcomeCallable ElasticBeanstalkClient::DeleteConfigurationTemplateCallable(DeleteConfigurationTemplateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DeleteConfigurationTemplate, Aws::Client::RejectedCallOutcome<DeleteConfigurationTemplateOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::DeleteConfigurationTemplateAsync(const DeleteConfigurationTemplateRequest& request, const DeleteConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::DeleteConfigurationTemplateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DeleteConfigurationTemplateAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteConfigurationTemplateOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::DeleteConfigurationTemplateAsync(DeleteConfigurationTemplateRequest&& request, const DeleteConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DeleteConfigurationTemplateAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteConfigurationTemplateOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::DeleteConfigurationTemplateAsyncHelper(const DeleteConfigurationTemplateRequest& request, const DeleteConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -470,12 +580,22 @@ DeleteEnvironmentConfigurationOutcome ElasticBeanstalkClient::DeleteEnvironmentC
 
 DeleteEnvironmentConfigurationOutcomeCallable ElasticBeanstalkClient::DeleteEnvironmentConfigurationCallable(const DeleteEnvironmentConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::DeleteEnvironmentConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DeleteEnvironmentConfiguration, Aws::Client::RejectedCallOutcome<DeleteEnvironmentConfigurationOutcome>(), this, request);
+}
+
+DeleteEnvironmentConfigurationOutcomeCallable ElasticBeanstalkClient::DeleteEnvironmentConfigurationCallable(DeleteEnvironmentConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DeleteEnvironmentConfiguration, Aws::Client::RejectedCallOutcome<DeleteEnvironmentConfigurationOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::DeleteEnvironmentConfigurationAsync(const DeleteEnvironmentConfigurationRequest& request, const DeleteEnvironmentConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::DeleteEnvironmentConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DeleteEnvironmentConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteEnvironmentConfigurationOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::DeleteEnvironmentConfigurationAsync(DeleteEnvironmentConfigurationRequest&& request, const DeleteEnvironmentConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DeleteEnvironmentConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteEnvironmentConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::DeleteEnvironmentConfigurationAsyncHelper(const DeleteEnvironmentConfigurationRequest& request, const DeleteEnvironmentConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -500,12 +620,22 @@ DescribeApplicationVersionsOutcome ElasticBeanstalkClient::DescribeApplicationVe
 
 DescribeApplicationVersionsOutcomeCallable ElasticBeanstalkClient::DescribeApplicationVersionsCallable(const DescribeApplicationVersionsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::DescribeApplicationVersions, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeApplicationVersions, Aws::Client::RejectedCallOutcome<DescribeApplicationVersionsOutcome>(), this, request);
+}
+
+DescribeApplicationVersionsOutcomeCallable ElasticBeanstalkClient::DescribeApplicationVersionsCallable(DescribeApplicationVersionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeApplicationVersions, Aws::Client::RejectedCallOutcome<DescribeApplicationVersionsOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::DescribeApplicationVersionsAsync(const DescribeApplicationVersionsRequest& request, const DescribeApplicationVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::DescribeApplicationVersionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeApplicationVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeApplicationVersionsOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::DescribeApplicationVersionsAsync(DescribeApplicationVersionsRequest&& request, const DescribeApplicationVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeApplicationVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeApplicationVersionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::DescribeApplicationVersionsAsyncHelper(const DescribeApplicationVersionsRequest& request, const DescribeApplicationVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -530,12 +660,22 @@ DescribeApplicationsOutcome ElasticBeanstalkClient::DescribeApplications(const D
 
 DescribeApplicationsOutcomeCallable ElasticBeanstalkClient::DescribeApplicationsCallable(const DescribeApplicationsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::DescribeApplications, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeApplications, Aws::Client::RejectedCallOutcome<DescribeApplicationsOutcome>(), this, request);
+}
+
+DescribeApplicationsOutcomeCallable ElasticBeanstalkClient::DescribeApplicationsCallable(DescribeApplicationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeApplications, Aws::Client::RejectedCallOutcome<DescribeApplicationsOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::DescribeApplicationsAsync(const DescribeApplicationsRequest& request, const DescribeApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::DescribeApplicationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeApplicationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeApplicationsOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::DescribeApplicationsAsync(DescribeApplicationsRequest&& request, const DescribeApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeApplicationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeApplicationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::DescribeApplicationsAsyncHelper(const DescribeApplicationsRequest& request, const DescribeApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -560,12 +700,22 @@ DescribeConfigurationOptionsOutcome ElasticBeanstalkClient::DescribeConfiguratio
 
 DescribeConfigurationOptionsOutcomeCallable ElasticBeanstalkClient::DescribeConfigurationOptionsCallable(const DescribeConfigurationOptionsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::DescribeConfigurationOptions, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeConfigurationOptions, Aws::Client::RejectedCallOutcome<DescribeConfigurationOptionsOutcome>(), this, request);
+}
+
+DescribeConfigurationOptionsOutcomeCallable ElasticBeanstalkClient::DescribeConfigurationOptionsCallable(DescribeConfigurationOptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeConfigurationOptions, Aws::Client::RejectedCallOutcome<DescribeConfigurationOptionsOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::DescribeConfigurationOptionsAsync(const DescribeConfigurationOptionsRequest& request, const DescribeConfigurationOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::DescribeConfigurationOptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeConfigurationOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConfigurationOptionsOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::DescribeConfigurationOptionsAsync(DescribeConfigurationOptionsRequest&& request, const DescribeConfigurationOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeConfigurationOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConfigurationOptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::DescribeConfigurationOptionsAsyncHelper(const DescribeConfigurationOptionsRequest& request, const DescribeConfigurationOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -590,12 +740,22 @@ DescribeConfigurationSettingsOutcome ElasticBeanstalkClient::DescribeConfigurati
 
 DescribeConfigurationSettingsOutcomeCallable ElasticBeanstalkClient::DescribeConfigurationSettingsCallable(const DescribeConfigurationSettingsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::DescribeConfigurationSettings, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeConfigurationSettings, Aws::Client::RejectedCallOutcome<DescribeConfigurationSettingsOutcome>(), this, request);
+}
+
+DescribeConfigurationSettingsOutcomeCallable ElasticBeanstalkClient::DescribeConfigurationSettingsCallable(DescribeConfigurationSettingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeConfigurationSettings, Aws::Client::RejectedCallOutcome<DescribeConfigurationSettingsOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::DescribeConfigurationSettingsAsync(const DescribeConfigurationSettingsRequest& request, const DescribeConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::DescribeConfigurationSettingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeConfigurationSettingsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConfigurationSettingsOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::DescribeConfigurationSettingsAsync(DescribeConfigurationSettingsRequest&& request, const DescribeConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeConfigurationSettingsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeConfigurationSettingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::DescribeConfigurationSettingsAsyncHelper(const DescribeConfigurationSettingsRequest& request, const DescribeConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -620,12 +780,22 @@ DescribeEnvironmentHealthOutcome ElasticBeanstalkClient::DescribeEnvironmentHeal
 
 DescribeEnvironmentHealthOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentHealthCallable(const DescribeEnvironmentHealthRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::DescribeEnvironmentHealth, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeEnvironmentHealth, Aws::Client::RejectedCallOutcome<DescribeEnvironmentHealthOutcome>(), this, request);
+}
+
+DescribeEnvironmentHealthOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentHealthCallable(DescribeEnvironmentHealthRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeEnvironmentHealth, Aws::Client::RejectedCallOutcome<DescribeEnvironmentHealthOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::DescribeEnvironmentHealthAsync(const DescribeEnvironmentHealthRequest& request, const DescribeEnvironmentHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::DescribeEnvironmentHealthAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeEnvironmentHealthAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEnvironmentHealthOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::DescribeEnvironmentHealthAsync(DescribeEnvironmentHealthRequest&& request, const DescribeEnvironmentHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeEnvironmentHealthAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEnvironmentHealthOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::DescribeEnvironmentHealthAsyncHelper(const DescribeEnvironmentHealthRequest& request, const DescribeEnvironmentHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -650,12 +820,22 @@ DescribeEnvironmentResourcesOutcome ElasticBeanstalkClient::DescribeEnvironmentR
 
 DescribeEnvironmentResourcesOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentResourcesCallable(const DescribeEnvironmentResourcesRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::DescribeEnvironmentResources, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeEnvironmentResources, Aws::Client::RejectedCallOutcome<DescribeEnvironmentResourcesOutcome>(), this, request);
+}
+
+DescribeEnvironmentResourcesOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentResourcesCallable(DescribeEnvironmentResourcesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeEnvironmentResources, Aws::Client::RejectedCallOutcome<DescribeEnvironmentResourcesOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::DescribeEnvironmentResourcesAsync(const DescribeEnvironmentResourcesRequest& request, const DescribeEnvironmentResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::DescribeEnvironmentResourcesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeEnvironmentResourcesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEnvironmentResourcesOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::DescribeEnvironmentResourcesAsync(DescribeEnvironmentResourcesRequest&& request, const DescribeEnvironmentResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeEnvironmentResourcesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEnvironmentResourcesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::DescribeEnvironmentResourcesAsyncHelper(const DescribeEnvironmentResourcesRequest& request, const DescribeEnvironmentResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -680,12 +860,22 @@ DescribeEnvironmentsOutcome ElasticBeanstalkClient::DescribeEnvironments(const D
 
 DescribeEnvironmentsOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentsCallable(const DescribeEnvironmentsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::DescribeEnvironments, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeEnvironments, Aws::Client::RejectedCallOutcome<DescribeEnvironmentsOutcome>(), this, request);
+}
+
+DescribeEnvironmentsOutcomeCallable ElasticBeanstalkClient::DescribeEnvironmentsCallable(DescribeEnvironmentsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeEnvironments, Aws::Client::RejectedCallOutcome<DescribeEnvironmentsOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::DescribeEnvironmentsAsync(const DescribeEnvironmentsRequest& request, const DescribeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::DescribeEnvironmentsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeEnvironmentsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEnvironmentsOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::DescribeEnvironmentsAsync(DescribeEnvironmentsRequest&& request, const DescribeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeEnvironmentsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEnvironmentsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::DescribeEnvironmentsAsyncHelper(const DescribeEnvironmentsRequest& request, const DescribeEnvironmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -710,12 +900,22 @@ DescribeEventsOutcome ElasticBeanstalkClient::DescribeEvents(const DescribeEvent
 
 DescribeEventsOutcomeCallable ElasticBeanstalkClient::DescribeEventsCallable(const DescribeEventsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::DescribeEvents, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeEvents, Aws::Client::RejectedCallOutcome<DescribeEventsOutcome>(), this, request);
+}
+
+DescribeEventsOutcomeCallable ElasticBeanstalkClient::DescribeEventsCallable(DescribeEventsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeEvents, Aws::Client::RejectedCallOutcome<DescribeEventsOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::DescribeEventsAsync(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::DescribeEventsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeEventsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventsOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::DescribeEventsAsync(DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeEventsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::DescribeEventsAsyncHelper(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -740,12 +940,22 @@ DescribeInstancesHealthOutcome ElasticBeanstalkClient::DescribeInstancesHealth(c
 
 DescribeInstancesHealthOutcomeCallable ElasticBeanstalkClient::DescribeInstancesHealthCallable(const DescribeInstancesHealthRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::DescribeInstancesHealth, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeInstancesHealth, Aws::Client::RejectedCallOutcome<DescribeInstancesHealthOutcome>(), this, request);
+}
+
+DescribeInstancesHealthOutcomeCallable ElasticBeanstalkClient::DescribeInstancesHealthCallable(DescribeInstancesHealthRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::DescribeInstancesHealth, Aws::Client::RejectedCallOutcome<DescribeInstancesHealthOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::DescribeInstancesHealthAsync(const DescribeInstancesHealthRequest& request, const DescribeInstancesHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::DescribeInstancesHealthAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeInstancesHealthAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInstancesHealthOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::DescribeInstancesHealthAsync(DescribeInstancesHealthRequest&& request, const DescribeInstancesHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::DescribeInstancesHealthAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInstancesHealthOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::DescribeInstancesHealthAsyncHelper(const DescribeInstancesHealthRequest& request, const DescribeInstancesHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -770,12 +980,22 @@ ListAvailableSolutionStacksOutcome ElasticBeanstalkClient::ListAvailableSolution
 
 ListAvailableSolutionStacksOutcomeCallable ElasticBeanstalkClient::ListAvailableSolutionStacksCallable(const ListAvailableSolutionStacksRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::ListAvailableSolutionStacks, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::ListAvailableSolutionStacks, Aws::Client::RejectedCallOutcome<ListAvailableSolutionStacksOutcome>(), this, request);
+}
+
+ListAvailableSolutionStacksOutcomeCallable ElasticBeanstalkClient::ListAvailableSolutionStacksCallable(ListAvailableSolutionStacksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::ListAvailableSolutionStacks, Aws::Client::RejectedCallOutcome<ListAvailableSolutionStacksOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::ListAvailableSolutionStacksAsync(const ListAvailableSolutionStacksRequest& request, const ListAvailableSolutionStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::ListAvailableSolutionStacksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::ListAvailableSolutionStacksAsyncHelper, Aws::Client::RejectedAsyncCall<ListAvailableSolutionStacksOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::ListAvailableSolutionStacksAsync(ListAvailableSolutionStacksRequest&& request, const ListAvailableSolutionStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::ListAvailableSolutionStacksAsyncHelper, Aws::Client::RejectedAsyncCall<ListAvailableSolutionStacksOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::ListAvailableSolutionStacksAsyncHelper(const ListAvailableSolutionStacksRequest& request, const ListAvailableSolutionStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -800,12 +1020,22 @@ RebuildEnvironmentOutcome ElasticBeanstalkClient::RebuildEnvironment(const Rebui
 
 RebuildEnvironmentOutcomeCallable ElasticBeanstalkClient::RebuildEnvironmentCallable(const RebuildEnvironmentRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::RebuildEnvironment, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::RebuildEnvironment, Aws::Client::RejectedCallOutcome<RebuildEnvironmentOutcome>(), this, request);
+}
+
+RebuildEnvironmentOutcomeCallable ElasticBeanstalkClient::RebuildEnvironmentCallable(RebuildEnvironmentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::RebuildEnvironment, Aws::Client::RejectedCallOutcome<RebuildEnvironmentOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::RebuildEnvironmentAsync(const RebuildEnvironmentRequest& request, const RebuildEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::RebuildEnvironmentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::RebuildEnvironmentAsyncHelper, Aws::Client::RejectedAsyncCall<RebuildEnvironmentOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::RebuildEnvironmentAsync(RebuildEnvironmentRequest&& request, const RebuildEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::RebuildEnvironmentAsyncHelper, Aws::Client::RejectedAsyncCall<RebuildEnvironmentOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::RebuildEnvironmentAsyncHelper(const RebuildEnvironmentRequest& request, const RebuildEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -830,12 +1060,22 @@ RequestEnvironmentInfoOutcome ElasticBeanstalkClient::RequestEnvironmentInfo(con
 
 RequestEnvironmentInfoOutcomeCallable ElasticBeanstalkClient::RequestEnvironmentInfoCallable(const RequestEnvironmentInfoRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::RequestEnvironmentInfo, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::RequestEnvironmentInfo, Aws::Client::RejectedCallOutcome<RequestEnvironmentInfoOutcome>(), this, request);
+}
+
+RequestEnvironmentInfoOutcomeCallable ElasticBeanstalkClient::RequestEnvironmentInfoCallable(RequestEnvironmentInfoRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::RequestEnvironmentInfo, Aws::Client::RejectedCallOutcome<RequestEnvironmentInfoOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::RequestEnvironmentInfoAsync(const RequestEnvironmentInfoRequest& request, const RequestEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::RequestEnvironmentInfoAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::RequestEnvironmentInfoAsyncHelper, Aws::Client::RejectedAsyncCall<RequestEnvironmentInfoOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::RequestEnvironmentInfoAsync(RequestEnvironmentInfoRequest&& request, const RequestEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::RequestEnvironmentInfoAsyncHelper, Aws::Client::RejectedAsyncCall<RequestEnvironmentInfoOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::RequestEnvironmentInfoAsyncHelper(const RequestEnvironmentInfoRequest& request, const RequestEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -860,12 +1100,22 @@ RestartAppServerOutcome ElasticBeanstalkClient::RestartAppServer(const RestartAp
 
 RestartAppServerOutcomeCallable ElasticBeanstalkClient::RestartAppServerCallable(const RestartAppServerRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::RestartAppServer, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::RestartAppServer, Aws::Client::RejectedCallOutcome<RestartAppServerOutcome>(), this, request);
+}
+
+RestartAppServerOutcomeCallable ElasticBeanstalkClient::RestartAppServerCallable(RestartAppServerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::RestartAppServer, Aws::Client::RejectedCallOutcome<RestartAppServerOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::RestartAppServerAsync(const RestartAppServerRequest& request, const RestartAppServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::RestartAppServerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::RestartAppServerAsyncHelper, Aws::Client::RejectedAsyncCall<RestartAppServerOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::RestartAppServerAsync(RestartAppServerRequest&& request, const RestartAppServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::RestartAppServerAsyncHelper, Aws::Client::RejectedAsyncCall<RestartAppServerOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::RestartAppServerAsyncHelper(const RestartAppServerRequest& request, const RestartAppServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -890,12 +1140,22 @@ RetrieveEnvironmentInfoOutcome ElasticBeanstalkClient::RetrieveEnvironmentInfo(c
 
 RetrieveEnvironmentInfoOutcomeCallable ElasticBeanstalkClient::RetrieveEnvironmentInfoCallable(const RetrieveEnvironmentInfoRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::RetrieveEnvironmentInfo, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::RetrieveEnvironmentInfo, Aws::Client::RejectedCallOutcome<RetrieveEnvironmentInfoOutcome>(), this, request);
+}
+
+RetrieveEnvironmentInfoOutcomeCallable ElasticBeanstalkClient::RetrieveEnvironmentInfoCallable(RetrieveEnvironmentInfoRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::RetrieveEnvironmentInfo, Aws::Client::RejectedCallOutcome<RetrieveEnvironmentInfoOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::RetrieveEnvironmentInfoAsync(const RetrieveEnvironmentInfoRequest& request, const RetrieveEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::RetrieveEnvironmentInfoAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::RetrieveEnvironmentInfoAsyncHelper, Aws::Client::RejectedAsyncCall<RetrieveEnvironmentInfoOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::RetrieveEnvironmentInfoAsync(RetrieveEnvironmentInfoRequest&& request, const RetrieveEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::RetrieveEnvironmentInfoAsyncHelper, Aws::Client::RejectedAsyncCall<RetrieveEnvironmentInfoOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::RetrieveEnvironmentInfoAsyncHelper(const RetrieveEnvironmentInfoRequest& request, const RetrieveEnvironmentInfoResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -920,12 +1180,22 @@ SwapEnvironmentCNAMEsOutcome ElasticBeanstalkClient::SwapEnvironmentCNAMEs(const
 
 SwapEnvironmentCNAMEsOutcomeCallable ElasticBeanstalkClient::SwapEnvironmentCNAMEsCallable(const SwapEnvironmentCNAMEsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::SwapEnvironmentCNAMEs, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::SwapEnvironmentCNAMEs, Aws::Client::RejectedCallOutcome<SwapEnvironmentCNAMEsOutcome>(), this, request);
+}
+
+SwapEnvironmentCNAMEsOutcomeCallable ElasticBeanstalkClient::SwapEnvironmentCNAMEsCallable(SwapEnvironmentCNAMEsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::SwapEnvironmentCNAMEs, Aws::Client::RejectedCallOutcome<SwapEnvironmentCNAMEsOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::SwapEnvironmentCNAMEsAsync(const SwapEnvironmentCNAMEsRequest& request, const SwapEnvironmentCNAMEsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::SwapEnvironmentCNAMEsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::SwapEnvironmentCNAMEsAsyncHelper, Aws::Client::RejectedAsyncCall<SwapEnvironmentCNAMEsOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::SwapEnvironmentCNAMEsAsync(SwapEnvironmentCNAMEsRequest&& request, const SwapEnvironmentCNAMEsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::SwapEnvironmentCNAMEsAsyncHelper, Aws::Client::RejectedAsyncCall<SwapEnvironmentCNAMEsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::SwapEnvironmentCNAMEsAsyncHelper(const SwapEnvironmentCNAMEsRequest& request, const SwapEnvironmentCNAMEsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -950,12 +1220,22 @@ TerminateEnvironmentOutcome ElasticBeanstalkClient::TerminateEnvironment(const T
 
 TerminateEnvironmentOutcomeCallable ElasticBeanstalkClient::TerminateEnvironmentCallable(const TerminateEnvironmentRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::TerminateEnvironment, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::TerminateEnvironment, Aws::Client::RejectedCallOutcome<TerminateEnvironmentOutcome>(), this, request);
+}
+
+TerminateEnvironmentOutcomeCallable ElasticBeanstalkClient::TerminateEnvironmentCallable(TerminateEnvironmentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::TerminateEnvironment, Aws::Client::RejectedCallOutcome<TerminateEnvironmentOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::TerminateEnvironmentAsync(const TerminateEnvironmentRequest& request, const TerminateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::TerminateEnvironmentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::TerminateEnvironmentAsyncHelper, Aws::Client::RejectedAsyncCall<TerminateEnvironmentOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::TerminateEnvironmentAsync(TerminateEnvironmentRequest&& request, const TerminateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::TerminateEnvironmentAsyncHelper, Aws::Client::RejectedAsyncCall<TerminateEnvironmentOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::TerminateEnvironmentAsyncHelper(const TerminateEnvironmentRequest& request, const TerminateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -980,12 +1260,22 @@ UpdateApplicationOutcome ElasticBeanstalkClient::UpdateApplication(const UpdateA
 
 UpdateApplicationOutcomeCallable ElasticBeanstalkClient::UpdateApplicationCallable(const UpdateApplicationRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::UpdateApplication, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::UpdateApplication, Aws::Client::RejectedCallOutcome<UpdateApplicationOutcome>(), this, request);
+}
+
+UpdateApplicationOutcomeCallable ElasticBeanstalkClient::UpdateApplicationCallable(UpdateApplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::UpdateApplication, Aws::Client::RejectedCallOutcome<UpdateApplicationOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::UpdateApplicationAsync(const UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::UpdateApplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::UpdateApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateApplicationOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::UpdateApplicationAsync(UpdateApplicationRequest&& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::UpdateApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateApplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::UpdateApplicationAsyncHelper(const UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1010,12 +1300,22 @@ UpdateApplicationVersionOutcome ElasticBeanstalkClient::UpdateApplicationVersion
 
 UpdateApplicationVersionOutcomeCallable ElasticBeanstalkClient::UpdateApplicationVersionCallable(const UpdateApplicationVersionRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::UpdateApplicationVersion, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::UpdateApplicationVersion, Aws::Client::RejectedCallOutcome<UpdateApplicationVersionOutcome>(), this, request);
+}
+
+UpdateApplicationVersionOutcomeCallable ElasticBeanstalkClient::UpdateApplicationVersionCallable(UpdateApplicationVersionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::UpdateApplicationVersion, Aws::Client::RejectedCallOutcome<UpdateApplicationVersionOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::UpdateApplicationVersionAsync(const UpdateApplicationVersionRequest& request, const UpdateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::UpdateApplicationVersionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::UpdateApplicationVersionAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateApplicationVersionOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::UpdateApplicationVersionAsync(UpdateApplicationVersionRequest&& request, const UpdateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::UpdateApplicationVersionAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateApplicationVersionOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::UpdateApplicationVersionAsyncHelper(const UpdateApplicationVersionRequest& request, const UpdateApplicationVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1040,12 +1340,22 @@ UpdateConfigurationTemplateOutcome ElasticBeanstalkClient::UpdateConfigurationTe
 
 UpdateConfigurationTemplateOutcomeCallable ElasticBeanstalkClient::UpdateConfigurationTemplateCallable(const UpdateConfigurationTemplateRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::UpdateConfigurationTemplate, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::UpdateConfigurationTemplate, Aws::Client::RejectedCallOutcome<UpdateConfigurationTemplateOutcome>(), this, request);
+}
+
+UpdateConfigurationTemplateOutcomeCallable ElasticBeanstalkClient::UpdateConfigurationTemplateCallable(UpdateConfigurationTemplateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::UpdateConfigurationTemplate, Aws::Client::RejectedCallOutcome<UpdateConfigurationTemplateOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::UpdateConfigurationTemplateAsync(const UpdateConfigurationTemplateRequest& request, const UpdateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::UpdateConfigurationTemplateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::UpdateConfigurationTemplateAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateConfigurationTemplateOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::UpdateConfigurationTemplateAsync(UpdateConfigurationTemplateRequest&& request, const UpdateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::UpdateConfigurationTemplateAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateConfigurationTemplateOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::UpdateConfigurationTemplateAsyncHelper(const UpdateConfigurationTemplateRequest& request, const UpdateConfigurationTemplateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1070,12 +1380,22 @@ UpdateEnvironmentOutcome ElasticBeanstalkClient::UpdateEnvironment(const UpdateE
 
 UpdateEnvironmentOutcomeCallable ElasticBeanstalkClient::UpdateEnvironmentCallable(const UpdateEnvironmentRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::UpdateEnvironment, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::UpdateEnvironment, Aws::Client::RejectedCallOutcome<UpdateEnvironmentOutcome>(), this, request);
+}
+
+UpdateEnvironmentOutcomeCallable ElasticBeanstalkClient::UpdateEnvironmentCallable(UpdateEnvironmentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::UpdateEnvironment, Aws::Client::RejectedCallOutcome<UpdateEnvironmentOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::UpdateEnvironmentAsync(const UpdateEnvironmentRequest& request, const UpdateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::UpdateEnvironmentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::UpdateEnvironmentAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateEnvironmentOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::UpdateEnvironmentAsync(UpdateEnvironmentRequest&& request, const UpdateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::UpdateEnvironmentAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateEnvironmentOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::UpdateEnvironmentAsyncHelper(const UpdateEnvironmentRequest& request, const UpdateEnvironmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1100,12 +1420,22 @@ ValidateConfigurationSettingsOutcome ElasticBeanstalkClient::ValidateConfigurati
 
 ValidateConfigurationSettingsOutcomeCallable ElasticBeanstalkClient::ValidateConfigurationSettingsCallable(const ValidateConfigurationSettingsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticBeanstalkClient::ValidateConfigurationSettings, this, request);
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::ValidateConfigurationSettings, Aws::Client::RejectedCallOutcome<ValidateConfigurationSettingsOutcome>(), this, request);
+}
+
+ValidateConfigurationSettingsOutcomeCallable ElasticBeanstalkClient::ValidateConfigurationSettingsCallable(ValidateConfigurationSettingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticBeanstalkClient::ValidateConfigurationSettings, Aws::Client::RejectedCallOutcome<ValidateConfigurationSettingsOutcome>(), this, std::move(request));
 }
 
 void ElasticBeanstalkClient::ValidateConfigurationSettingsAsync(const ValidateConfigurationSettingsRequest& request, const ValidateConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticBeanstalkClient::ValidateConfigurationSettingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::ValidateConfigurationSettingsAsyncHelper, Aws::Client::RejectedAsyncCall<ValidateConfigurationSettingsOutcome>(), this, request, handler, context);
+}
+
+void ElasticBeanstalkClient::ValidateConfigurationSettingsAsync(ValidateConfigurationSettingsRequest&& request, const ValidateConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticBeanstalkClient::ValidateConfigurationSettingsAsyncHelper, Aws::Client::RejectedAsyncCall<ValidateConfigurationSettingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticBeanstalkClient::ValidateConfigurationSettingsAsyncHelper(const ValidateConfigurationSettingsRequest& request, const ValidateConfigurationSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
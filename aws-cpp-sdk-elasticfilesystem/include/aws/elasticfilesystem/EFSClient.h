@@ -29,6 +29,21 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/elasticfilesystem/model/CreateFileSystemRequest.h>
+#include <aws/elasticfilesystem/model/CreateMountTargetRequest.h>
+#include <aws/elasticfilesystem/model/CreateTagsRequest.h>
+#include <aws/elasticfilesystem/model/DeleteFileSystemRequest.h>
+#include <aws/elasticfilesystem/model/DeleteMountTargetRequest.h>
+#include <aws/elasticfilesystem/model/DeleteTagsRequest.h>
+#include <aws/elasticfilesystem/model/DescribeFileSystemsRequest.h>
+#include <aws/elasticfilesystem/model/DescribeMountTargetSecurityGroupsRequest.h>
+#include <aws/elasticfilesystem/model/DescribeMountTargetsRequest.h>
+#include <aws/elasticfilesystem/model/DescribeTagsRequest.h>
+#include <aws/elasticfilesystem/model/ModifyMountTargetSecurityGroupsRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -221,6 +236,11 @@ namespace Model
          */
         virtual Model::CreateFileSystemOutcomeCallable CreateFileSystemCallable(const Model::CreateFileSystemRequest& request) const;
 
+        /**
+         * Same as CreateFileSystemCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateFileSystemOutcomeCallable CreateFileSystemCallable(Model::CreateFileSystemRequest&& request) const;
+
         /**
          * <p> Creates a new, empty file system. The operation requires a creation token in
          * the request that Amazon EFS uses to ensure idempotent creation (calling the
@@ -256,6 +276,11 @@ namespace Model
          */
         virtual void CreateFileSystemAsync(const Model::CreateFileSystemRequest& request, const CreateFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateFileSystemAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateFileSystemAsync(Model::CreateFileSystemRequest&& request, const CreateFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a mount target for a file system. You can then mount the file system
          * on EC2 instances via the mount target. </p> <p>You can create one mount target
@@ -408,6 +433,11 @@ namespace Model
          */
         virtual Model::CreateMountTargetOutcomeCallable CreateMountTargetCallable(const Model::CreateMountTargetRequest& request) const;
 
+        /**
+         * Same as CreateMountTargetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateMountTargetOutcomeCallable CreateMountTargetCallable(Model::CreateMountTargetRequest&& request) const;
+
         /**
          * <p>Creates a mount target for a file system. You can then mount the file system
          * on EC2 instances via the mount target. </p> <p>You can create one mount target
@@ -485,6 +515,11 @@ namespace Model
          */
         virtual void CreateMountTargetAsync(const Model::CreateMountTargetRequest& request, const CreateMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateMountTargetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateMountTargetAsync(Model::CreateMountTargetRequest&& request, const CreateMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or overwrites tags associated with a file system. Each tag is a
          * key-value pair. If a tag key specified in the request already exists on the file
@@ -509,6 +544,11 @@ namespace Model
          */
         virtual Model::CreateTagsOutcomeCallable CreateTagsCallable(const Model::CreateTagsRequest& request) const;
 
+        /**
+         * Same as CreateTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateTagsOutcomeCallable CreateTagsCallable(Model::CreateTagsRequest&& request) const;
+
         /**
          * <p>Creates or overwrites tags associated with a file system. Each tag is a
          * key-value pair. If a tag key specified in the request already exists on the file
@@ -522,6 +562,11 @@ namespace Model
          */
         virtual void CreateTagsAsync(const Model::CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateTagsAsync(Model::CreateTagsRequest&& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a file system, permanently severing access to its contents. Upon
          * return, the file system no longer exists and you will not be able to access any
@@ -556,6 +601,11 @@ namespace Model
          */
         virtual Model::DeleteFileSystemOutcomeCallable DeleteFileSystemCallable(const Model::DeleteFileSystemRequest& request) const;
 
+        /**
+         * Same as DeleteFileSystemCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteFileSystemOutcomeCallable DeleteFileSystemCallable(Model::DeleteFileSystemRequest&& request) const;
+
         /**
          * <p> Deletes a file system, permanently severing access to its contents. Upon
          * return, the file system no longer exists and you will not be able to access any
@@ -574,6 +624,11 @@ namespace Model
          */
         virtual void DeleteFileSystemAsync(const Model::DeleteFileSystemRequest& request, const DeleteFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteFileSystemAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteFileSystemAsync(Model::DeleteFileSystemRequest&& request, const DeleteFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified mount target. </p> <p> This operation forcibly breaks
          * any mounts of the file system via the mount target being deleted, which might
@@ -618,6 +673,11 @@ namespace Model
          */
         virtual Model::DeleteMountTargetOutcomeCallable DeleteMountTargetCallable(const Model::DeleteMountTargetRequest& request) const;
 
+        /**
+         * Same as DeleteMountTargetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteMountTargetOutcomeCallable DeleteMountTargetCallable(Model::DeleteMountTargetRequest&& request) const;
+
         /**
          * <p>Deletes the specified mount target. </p> <p> This operation forcibly breaks
          * any mounts of the file system via the mount target being deleted, which might
@@ -641,6 +701,11 @@ namespace Model
          */
         virtual void DeleteMountTargetAsync(const Model::DeleteMountTargetRequest& request, const DeleteMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteMountTargetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteMountTargetAsync(Model::DeleteMountTargetRequest&& request, const DeleteMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified tags from a file system. If the <code>DeleteTags</code>
          * request includes a tag key that does not exist, Amazon EFS ignores it; it is not
@@ -665,6 +730,11 @@ namespace Model
          */
         virtual Model::DeleteTagsOutcomeCallable DeleteTagsCallable(const Model::DeleteTagsRequest& request) const;
 
+        /**
+         * Same as DeleteTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteTagsOutcomeCallable DeleteTagsCallable(Model::DeleteTagsRequest&& request) const;
+
         /**
          * <p>Deletes the specified tags from a file system. If the <code>DeleteTags</code>
          * request includes a tag key that does not exist, Amazon EFS ignores it; it is not
@@ -678,6 +748,11 @@ namespace Model
          */
         virtual void DeleteTagsAsync(const Model::DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteTagsAsync(Model::DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the description of a specific Amazon EFS file system if either the
          * file system <code>CreationToken</code> or the <code>FileSystemId</code> is
@@ -732,6 +807,11 @@ namespace Model
          */
         virtual Model::DescribeFileSystemsOutcomeCallable DescribeFileSystemsCallable(const Model::DescribeFileSystemsRequest& request) const;
 
+        /**
+         * Same as DescribeFileSystemsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeFileSystemsOutcomeCallable DescribeFileSystemsCallable(Model::DescribeFileSystemsRequest&& request) const;
+
         /**
          * <p>Returns the description of a specific Amazon EFS file system if either the
          * file system <code>CreationToken</code> or the <code>FileSystemId</code> is
@@ -760,6 +840,11 @@ namespace Model
          */
         virtual void DescribeFileSystemsAsync(const Model::DescribeFileSystemsRequest& request, const DescribeFileSystemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFileSystemsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeFileSystemsAsync(Model::DescribeFileSystemsRequest&& request, const DescribeFileSystemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the security groups currently in effect for a mount target. This
          * operation requires that the network interface of the mount target has been
@@ -786,6 +871,11 @@ namespace Model
          */
         virtual Model::DescribeMountTargetSecurityGroupsOutcomeCallable DescribeMountTargetSecurityGroupsCallable(const Model::DescribeMountTargetSecurityGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeMountTargetSecurityGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeMountTargetSecurityGroupsOutcomeCallable DescribeMountTargetSecurityGroupsCallable(Model::DescribeMountTargetSecurityGroupsRequest&& request) const;
+
         /**
          * <p>Returns the security groups currently in effect for a mount target. This
          * operation requires that the network interface of the mount target has been
@@ -800,6 +890,11 @@ namespace Model
          */
         virtual void DescribeMountTargetSecurityGroupsAsync(const Model::DescribeMountTargetSecurityGroupsRequest& request, const DescribeMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeMountTargetSecurityGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeMountTargetSecurityGroupsAsync(Model::DescribeMountTargetSecurityGroupsRequest&& request, const DescribeMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the descriptions of all the current mount targets, or a specific
          * mount target, for a file system. When requesting all of the current mount
@@ -824,6 +919,11 @@ namespace Model
          */
         virtual Model::DescribeMountTargetsOutcomeCallable DescribeMountTargetsCallable(const Model::DescribeMountTargetsRequest& request) const;
 
+        /**
+         * Same as DescribeMountTargetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeMountTargetsOutcomeCallable DescribeMountTargetsCallable(Model::DescribeMountTargetsRequest&& request) const;
+
         /**
          * <p>Returns the descriptions of all the current mount targets, or a specific
          * mount target, for a file system. When requesting all of the current mount
@@ -837,6 +937,11 @@ namespace Model
          */
         virtual void DescribeMountTargetsAsync(const Model::DescribeMountTargetsRequest& request, const DescribeMountTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeMountTargetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeMountTargetsAsync(Model::DescribeMountTargetsRequest&& request, const DescribeMountTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the tags associated with a file system. The order of tags returned in
          * the response of one <code>DescribeTags</code> call, and the order of tags
@@ -857,6 +962,11 @@ namespace Model
          */
         virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(const Model::DescribeTagsRequest& request) const;
 
+        /**
+         * Same as DescribeTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(Model::DescribeTagsRequest&& request) const;
+
         /**
          * <p>Returns the tags associated with a file system. The order of tags returned in
          * the response of one <code>DescribeTags</code> call, and the order of tags
@@ -868,6 +978,11 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTagsAsync(Model::DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the set of security groups in effect for a mount target.</p> <p>When
          * you create a mount target, Amazon EFS also creates a new network interface (see
@@ -902,6 +1017,11 @@ namespace Model
          */
         virtual Model::ModifyMountTargetSecurityGroupsOutcomeCallable ModifyMountTargetSecurityGroupsCallable(const Model::ModifyMountTargetSecurityGroupsRequest& request) const;
 
+        /**
+         * Same as ModifyMountTargetSecurityGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyMountTargetSecurityGroupsOutcomeCallable ModifyMountTargetSecurityGroupsCallable(Model::ModifyMountTargetSecurityGroupsRequest&& request) const;
+
         /**
          * <p>Modifies the set of security groups in effect for a mount target.</p> <p>When
          * you create a mount target, Amazon EFS also creates a new network interface (see
@@ -920,6 +1040,40 @@ namespace Model
          */
         virtual void ModifyMountTargetSecurityGroupsAsync(const Model::ModifyMountTargetSecurityGroupsRequest& request, const ModifyMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyMountTargetSecurityGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyMountTargetSecurityGroupsAsync(Model::ModifyMountTargetSecurityGroupsRequest&& request, const ModifyMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateFileSystemOutcome> CreateFileSystemAwaitable(const Model::CreateFileSystemRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::CreateFileSystem, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateFileSystemOutcome> CreateFileSystemAwaitable(Model::CreateFileSystemRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::CreateFileSystem, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateMountTargetOutcome> CreateMountTargetAwaitable(const Model::CreateMountTargetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::CreateMountTarget, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateMountTargetOutcome> CreateMountTargetAwaitable(Model::CreateMountTargetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::CreateMountTarget, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTagsOutcome> CreateTagsAwaitable(const Model::CreateTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::CreateTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTagsOutcome> CreateTagsAwaitable(Model::CreateTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::CreateTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteFileSystemOutcome> DeleteFileSystemAwaitable(const Model::DeleteFileSystemRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::DeleteFileSystem, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteFileSystemOutcome> DeleteFileSystemAwaitable(Model::DeleteFileSystemRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::DeleteFileSystem, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteMountTargetOutcome> DeleteMountTargetAwaitable(const Model::DeleteMountTargetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::DeleteMountTarget, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteMountTargetOutcome> DeleteMountTargetAwaitable(Model::DeleteMountTargetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::DeleteMountTarget, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTagsOutcome> DeleteTagsAwaitable(const Model::DeleteTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::DeleteTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTagsOutcome> DeleteTagsAwaitable(Model::DeleteTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::DeleteTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFileSystemsOutcome> DescribeFileSystemsAwaitable(const Model::DescribeFileSystemsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::DescribeFileSystems, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFileSystemsOutcome> DescribeFileSystemsAwaitable(Model::DescribeFileSystemsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::DescribeFileSystems, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMountTargetSecurityGroupsOutcome> DescribeMountTargetSecurityGroupsAwaitable(const Model::DescribeMountTargetSecurityGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::DescribeMountTargetSecurityGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMountTargetSecurityGroupsOutcome> DescribeMountTargetSecurityGroupsAwaitable(Model::DescribeMountTargetSecurityGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::DescribeMountTargetSecurityGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMountTargetsOutcome> DescribeMountTargetsAwaitable(const Model::DescribeMountTargetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::DescribeMountTargets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMountTargetsOutcome> DescribeMountTargetsAwaitable(Model::DescribeMountTargetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::DescribeMountTargets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTagsOutcome> DescribeTagsAwaitable(const Model::DescribeTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::DescribeTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTagsOutcome> DescribeTagsAwaitable(Model::DescribeTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::DescribeTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyMountTargetSecurityGroupsOutcome> ModifyMountTargetSecurityGroupsAwaitable(const Model::ModifyMountTargetSecurityGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::ModifyMountTargetSecurityGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyMountTargetSecurityGroupsOutcome> ModifyMountTargetSecurityGroupsAwaitable(Model::ModifyMountTargetSecurityGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EFSClient::ModifyMountTargetSecurityGroups, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
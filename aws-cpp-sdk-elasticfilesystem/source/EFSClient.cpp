@@ -118,12 +118,22 @@ CreateFileSystemOutcome EFSClient::CreateFileSystem(const CreateFileSystemReques
 
 CreateFileSystemOutcomeCallable EFSClient::CreateFileSystemCallable(const CreateFileSystemRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::CreateFileSystem, this, request);
+  return m_executor->SubmitWithFuture(&EFSClient::CreateFileSystem, Aws::Client::RejectedCallOutcome<CreateFileSystemOutcome>(), this, request);
+}
+
+CreateFileSystemOutcomeCallable EFSClient::CreateFileSystemCallable(CreateFileSystemRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EFSClient::CreateFileSystem, Aws::Client::RejectedCallOutcome<CreateFileSystemOutcome>(), this, std::move(request));
 }
 
 void EFSClient::CreateFileSystemAsync(const CreateFileSystemRequest& request, const CreateFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::CreateFileSystemAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EFSClient::CreateFileSystemAsyncHelper, Aws::Client::RejectedAsyncCall<CreateFileSystemOutcome>(), this, request, handler, context);
+}
+
+void EFSClient::CreateFileSystemAsync(CreateFileSystemRequest&& request, const CreateFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EFSClient::CreateFileSystemAsyncHelper, Aws::Client::RejectedAsyncCall<CreateFileSystemOutcome>(), this, std::move(request), handler, context);
 }
 
 void EFSClient::CreateFileSystemAsyncHelper(const CreateFileSystemRequest& request, const CreateFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -149,12 +159,22 @@ CreateMountTargetOutcome EFSClient::CreateMountTarget(const CreateMountTargetReq
 
 CreateMountTargetOutcomeCallable EFSClient::CreateMountTargetCallable(const CreateMountTargetRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::CreateMountTarget, this, request);
+  return m_executor->SubmitWithFuture(&EFSClient::CreateMountTarget, Aws::Client::RejectedCallOutcome<CreateMountTargetOutcome>(), this, request);
+}
+
+CreateMountTargetOutcomeCallable EFSClient::CreateMountTargetCallable(CreateMountTargetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EFSClient::CreateMountTarget, Aws::Client::RejectedCallOutcome<CreateMountTargetOutcome>(), this, std::move(request));
 }
 
 void EFSClient::CreateMountTargetAsync(const CreateMountTargetRequest& request, const CreateMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::CreateMountTargetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EFSClient::CreateMountTargetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateMountTargetOutcome>(), this, request, handler, context);
+}
+
+void EFSClient::CreateMountTargetAsync(CreateMountTargetRequest&& request, const CreateMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EFSClient::CreateMountTargetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateMountTargetOutcome>(), this, std::move(request), handler, context);
 }
 
 void EFSClient::CreateMountTargetAsyncHelper(const CreateMountTargetRequest& request, const CreateMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -181,12 +201,22 @@ CreateTagsOutcome EFSClient::CreateTags(const CreateTagsRequest& request) const
 
 CreateTagsOutcomeCallable EFSClient::CreateTagsCallable(const CreateTagsRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::CreateTags, this, request);
+  return m_executor->SubmitWithFuture(&EFSClient::CreateTags, Aws::Client::RejectedCallOutcome<CreateTagsOutcome>(), this, request);
+}
+
+CreateTagsOutcomeCallable EFSClient::CreateTagsCallable(CreateTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EFSClient::CreateTags, Aws::Client::RejectedCallOutcome<CreateTagsOutcome>(), this, std::move(request));
 }
 
 void EFSClient::CreateTagsAsync(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::CreateTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EFSClient::CreateTagsAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTagsOutcome>(), this, request, handler, context);
+}
+
+void EFSClient::CreateTagsAsync(CreateTagsRequest&& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EFSClient::CreateTagsAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EFSClient::CreateTagsAsyncHelper(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -213,12 +243,22 @@ DeleteFileSystemOutcome EFSClient::DeleteFileSystem(const DeleteFileSystemReques
 
 DeleteFileSystemOutcomeCallable EFSClient::DeleteFileSystemCallable(const DeleteFileSystemRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::DeleteFileSystem, this, request);
+  return m_executor->SubmitWithFuture(&EFSClient::DeleteFileSystem, Aws::Client::RejectedCallOutcome<DeleteFileSystemOutcome>(), this, request);
+}
+
+DeleteFileSystemOutcomeCallable EFSClient::DeleteFileSystemCallable(DeleteFileSystemRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EFSClient::DeleteFileSystem, Aws::Client::RejectedCallOutcome<DeleteFileSystemOutcome>(), this, std::move(request));
 }
 
 void EFSClient::DeleteFileSystemAsync(const DeleteFileSystemRequest& request, const DeleteFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::DeleteFileSystemAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EFSClient::DeleteFileSystemAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteFileSystemOutcome>(), this, request, handler, context);
+}
+
+void EFSClient::DeleteFileSystemAsync(DeleteFileSystemRequest&& request, const DeleteFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EFSClient::DeleteFileSystemAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteFileSystemOutcome>(), this, std::move(request), handler, context);
 }
 
 void EFSClient::DeleteFileSystemAsyncHelper(const DeleteFileSystemRequest& request, const DeleteFileSystemResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -245,12 +285,22 @@ DeleteMountTargetOutcome EFSClient::DeleteMountTarget(const DeleteMountTargetReq
 
 DeleteMountTargetOutcomeCallable EFSClient::DeleteMountTargetCallable(const DeleteMountTargetRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::DeleteMountTarget, this, request);
+  return m_executor->SubmitWithFuture(&EFSClient::DeleteMountTarget, Aws::Client::RejectedCallOutcome<DeleteMountTargetOutcome>(), this, request);
+}
+
+DeleteMountTargetOutcomeCallable EFSClient::DeleteMountTargetCallable(DeleteMountTargetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EFSClient::DeleteMountTarget, Aws::Client::RejectedCallOutcome<DeleteMountTargetOutcome>(), this, std::move(request));
 }
 
 void EFSClient::DeleteMountTargetAsync(const DeleteMountTargetRequest& request, const DeleteMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::DeleteMountTargetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EFSClient::DeleteMountTargetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteMountTargetOutcome>(), this, request, handler, context);
+}
+
+void EFSClient::DeleteMountTargetAsync(DeleteMountTargetRequest&& request, const DeleteMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EFSClient::DeleteMountTargetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteMountTargetOutcome>(), this, std::move(request), handler, context);
 }
 
 void EFSClient::DeleteMountTargetAsyncHelper(const DeleteMountTargetRequest& request, const DeleteMountTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -277,12 +327,22 @@ DeleteTagsOutcome EFSClient::DeleteTags(const DeleteTagsRequest& request) const
 
 DeleteTagsOutcomeCallable EFSClient::DeleteTagsCallable(const DeleteTagsRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::DeleteTags, this, request);
+  return m_executor->SubmitWithFuture(&EFSClient::DeleteTags, Aws::Client::RejectedCallOutcome<DeleteTagsOutcome>(), this, request);
+}
+
+DeleteTagsOutcomeCallable EFSClient::DeleteTagsCallable(DeleteTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EFSClient::DeleteTags, Aws::Client::RejectedCallOutcome<DeleteTagsOutcome>(), this, std::move(request));
 }
 
 void EFSClient::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::DeleteTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EFSClient::DeleteTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTagsOutcome>(), this, request, handler, context);
+}
+
+void EFSClient::DeleteTagsAsync(DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EFSClient::DeleteTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EFSClient::DeleteTagsAsyncHelper(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -308,12 +368,22 @@ DescribeFileSystemsOutcome EFSClient::DescribeFileSystems(const DescribeFileSyst
 
 DescribeFileSystemsOutcomeCallable EFSClient::DescribeFileSystemsCallable(const DescribeFileSystemsRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::DescribeFileSystems, this, request);
+  return m_executor->SubmitWithFuture(&EFSClient::DescribeFileSystems, Aws::Client::RejectedCallOutcome<DescribeFileSystemsOutcome>(), this, request);
+}
+
+DescribeFileSystemsOutcomeCallable EFSClient::DescribeFileSystemsCallable(DescribeFileSystemsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EFSClient::DescribeFileSystems, Aws::Client::RejectedCallOutcome<DescribeFileSystemsOutcome>(), this, std::move(request));
 }
 
 void EFSClient::DescribeFileSystemsAsync(const DescribeFileSystemsRequest& request, const DescribeFileSystemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::DescribeFileSystemsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EFSClient::DescribeFileSystemsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFileSystemsOutcome>(), this, request, handler, context);
+}
+
+void EFSClient::DescribeFileSystemsAsync(DescribeFileSystemsRequest&& request, const DescribeFileSystemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EFSClient::DescribeFileSystemsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFileSystemsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EFSClient::DescribeFileSystemsAsyncHelper(const DescribeFileSystemsRequest& request, const DescribeFileSystemsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -341,12 +411,22 @@ DescribeMountTargetSecurityGroupsOutcome EFSClient::DescribeMountTargetSecurityG
 
 DescribeMountTargetSecurityGroupsOutcomeCallable EFSClient::DescribeMountTargetSecurityGroupsCallable(const DescribeMountTargetSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::DescribeMountTargetSecurityGroups, this, request);
+  return m_executor->SubmitWithFuture(&EFSClient::DescribeMountTargetSecurityGroups, Aws::Client::RejectedCallOutcome<DescribeMountTargetSecurityGroupsOutcome>(), this, request);
+}
+
+DescribeMountTargetSecurityGroupsOutcomeCallable EFSClient::DescribeMountTargetSecurityGroupsCallable(DescribeMountTargetSecurityGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EFSClient::DescribeMountTargetSecurityGroups, Aws::Client::RejectedCallOutcome<DescribeMountTargetSecurityGroupsOutcome>(), this, std::move(request));
 }
 
 void EFSClient::DescribeMountTargetSecurityGroupsAsync(const DescribeMountTargetSecurityGroupsRequest& request, const DescribeMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::DescribeMountTargetSecurityGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EFSClient::DescribeMountTargetSecurityGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMountTargetSecurityGroupsOutcome>(), this, request, handler, context);
+}
+
+void EFSClient::DescribeMountTargetSecurityGroupsAsync(DescribeMountTargetSecurityGroupsRequest&& request, const DescribeMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EFSClient::DescribeMountTargetSecurityGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMountTargetSecurityGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EFSClient::DescribeMountTargetSecurityGroupsAsyncHelper(const DescribeMountTargetSecurityGroupsRequest& request, const DescribeMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -372,12 +452,22 @@ DescribeMountTargetsOutcome EFSClient::DescribeMountTargets(const DescribeMountT
 
 DescribeMountTargetsOutcomeCallable EFSClient::DescribeMountTargetsCallable(const DescribeMountTargetsRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::DescribeMountTargets, this, request);
+  return m_executor->SubmitWithFuture(&EFSClient::DescribeMountTargets, Aws::Client::RejectedCallOutcome<DescribeMountTargetsOutcome>(), this, request);
+}
+
+DescribeMountTargetsOutcomeCallable EFSClient::DescribeMountTargetsCallable(DescribeMountTargetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EFSClient::DescribeMountTargets, Aws::Client::RejectedCallOutcome<DescribeMountTargetsOutcome>(), this, std::move(request));
 }
 
 void EFSClient::DescribeMountTargetsAsync(const DescribeMountTargetsRequest& request, const DescribeMountTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::DescribeMountTargetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EFSClient::DescribeMountTargetsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMountTargetsOutcome>(), this, request, handler, context);
+}
+
+void EFSClient::DescribeMountTargetsAsync(DescribeMountTargetsRequest&& request, const DescribeMountTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EFSClient::DescribeMountTargetsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMountTargetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EFSClient::DescribeMountTargetsAsyncHelper(const DescribeMountTargetsRequest& request, const DescribeMountTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -405,12 +495,22 @@ DescribeTagsOutcome EFSClient::DescribeTags(const DescribeTagsRequest& request)
 
 DescribeTagsOutcomeCallable EFSClient::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::DescribeTags, this, request);
+  return m_executor->SubmitWithFuture(&EFSClient::DescribeTags, Aws::Client::RejectedCallOutcome<DescribeTagsOutcome>(), this, request);
+}
+
+DescribeTagsOutcomeCallable EFSClient::DescribeTagsCallable(DescribeTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EFSClient::DescribeTags, Aws::Client::RejectedCallOutcome<DescribeTagsOutcome>(), this, std::move(request));
 }
 
 void EFSClient::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::DescribeTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EFSClient::DescribeTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTagsOutcome>(), this, request, handler, context);
+}
+
+void EFSClient::DescribeTagsAsync(DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EFSClient::DescribeTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EFSClient::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -438,12 +538,22 @@ ModifyMountTargetSecurityGroupsOutcome EFSClient::ModifyMountTargetSecurityGroup
 
 ModifyMountTargetSecurityGroupsOutcomeCallable EFSClient::ModifyMountTargetSecurityGroupsCallable(const ModifyMountTargetSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &EFSClient::ModifyMountTargetSecurityGroups, this, request);
+  return m_executor->SubmitWithFuture(&EFSClient::ModifyMountTargetSecurityGroups, Aws::Client::RejectedCallOutcome<ModifyMountTargetSecurityGroupsOutcome>(), this, request);
+}
+
+ModifyMountTargetSecurityGroupsOutcomeCallable EFSClient::ModifyMountTargetSecurityGroupsCallable(ModifyMountTargetSecurityGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EFSClient::ModifyMountTargetSecurityGroups, Aws::Client::RejectedCallOutcome<ModifyMountTargetSecurityGroupsOutcome>(), this, std::move(request));
 }
 
 void EFSClient::ModifyMountTargetSecurityGroupsAsync(const ModifyMountTargetSecurityGroupsRequest& request, const ModifyMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EFSClient::ModifyMountTargetSecurityGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EFSClient::ModifyMountTargetSecurityGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyMountTargetSecurityGroupsOutcome>(), this, request, handler, context);
+}
+
+void EFSClient::ModifyMountTargetSecurityGroupsAsync(ModifyMountTargetSecurityGroupsRequest&& request, const ModifyMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EFSClient::ModifyMountTargetSecurityGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyMountTargetSecurityGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EFSClient::ModifyMountTargetSecurityGroupsAsyncHelper(const ModifyMountTargetSecurityGroupsRequest& request, const ModifyMountTargetSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -50,6 +50,38 @@
 #include <aws/elasticloadbalancing/model/SetLoadBalancerPoliciesOfListenerResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/elasticloadbalancing/model/AddTagsRequest.h>
+#include <aws/elasticloadbalancing/model/ApplySecurityGroupsToLoadBalancerRequest.h>
+#include <aws/elasticloadbalancing/model/AttachLoadBalancerToSubnetsRequest.h>
+#include <aws/elasticloadbalancing/model/ConfigureHealthCheckRequest.h>
+#include <aws/elasticloadbalancing/model/CreateAppCookieStickinessPolicyRequest.h>
+#include <aws/elasticloadbalancing/model/CreateLBCookieStickinessPolicyRequest.h>
+#include <aws/elasticloadbalancing/model/CreateLoadBalancerRequest.h>
+#include <aws/elasticloadbalancing/model/CreateLoadBalancerListenersRequest.h>
+#include <aws/elasticloadbalancing/model/CreateLoadBalancerPolicyRequest.h>
+#include <aws/elasticloadbalancing/model/DeleteLoadBalancerRequest.h>
+#include <aws/elasticloadbalancing/model/DeleteLoadBalancerListenersRequest.h>
+#include <aws/elasticloadbalancing/model/DeleteLoadBalancerPolicyRequest.h>
+#include <aws/elasticloadbalancing/model/DeregisterInstancesFromLoadBalancerRequest.h>
+#include <aws/elasticloadbalancing/model/DescribeInstanceHealthRequest.h>
+#include <aws/elasticloadbalancing/model/DescribeLoadBalancerAttributesRequest.h>
+#include <aws/elasticloadbalancing/model/DescribeLoadBalancerPoliciesRequest.h>
+#include <aws/elasticloadbalancing/model/DescribeLoadBalancerPolicyTypesRequest.h>
+#include <aws/elasticloadbalancing/model/DescribeLoadBalancersRequest.h>
+#include <aws/elasticloadbalancing/model/DescribeTagsRequest.h>
+#include <aws/elasticloadbalancing/model/DetachLoadBalancerFromSubnetsRequest.h>
+#include <aws/elasticloadbalancing/model/DisableAvailabilityZonesForLoadBalancerRequest.h>
+#include <aws/elasticloadbalancing/model/EnableAvailabilityZonesForLoadBalancerRequest.h>
+#include <aws/elasticloadbalancing/model/ModifyLoadBalancerAttributesRequest.h>
+#include <aws/elasticloadbalancing/model/RegisterInstancesWithLoadBalancerRequest.h>
+#include <aws/elasticloadbalancing/model/RemoveTagsRequest.h>
+#include <aws/elasticloadbalancing/model/SetLoadBalancerListenerSSLCertificateRequest.h>
+#include <aws/elasticloadbalancing/model/SetLoadBalancerPoliciesForBackendServerRequest.h>
+#include <aws/elasticloadbalancing/model/SetLoadBalancerPoliciesOfListenerRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -275,6 +307,11 @@ namespace Model
          */
         virtual Model::AddTagsOutcomeCallable AddTagsCallable(const Model::AddTagsRequest& request) const;
 
+        /**
+         * Same as AddTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddTagsOutcomeCallable AddTagsCallable(Model::AddTagsRequest&& request) const;
+
         /**
          * <p>Adds the specified tags to the specified load balancer. Each load balancer
          * can have a maximum of 10 tags.</p> <p>Each tag consists of a key and an optional
@@ -287,6 +324,11 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddTagsAsync(Model::AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates one or more security groups with your load balancer in a virtual
          * private cloud (VPC). The specified security groups override the previously
@@ -309,6 +351,11 @@ namespace Model
          */
         virtual Model::ApplySecurityGroupsToLoadBalancerOutcomeCallable ApplySecurityGroupsToLoadBalancerCallable(const Model::ApplySecurityGroupsToLoadBalancerRequest& request) const;
 
+        /**
+         * Same as ApplySecurityGroupsToLoadBalancerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ApplySecurityGroupsToLoadBalancerOutcomeCallable ApplySecurityGroupsToLoadBalancerCallable(Model::ApplySecurityGroupsToLoadBalancerRequest&& request) const;
+
         /**
          * <p>Associates one or more security groups with your load balancer in a virtual
          * private cloud (VPC). The specified security groups override the previously
@@ -321,6 +368,11 @@ namespace Model
          */
         virtual void ApplySecurityGroupsToLoadBalancerAsync(const Model::ApplySecurityGroupsToLoadBalancerRequest& request, const ApplySecurityGroupsToLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ApplySecurityGroupsToLoadBalancerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ApplySecurityGroupsToLoadBalancerAsync(Model::ApplySecurityGroupsToLoadBalancerRequest&& request, const ApplySecurityGroupsToLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds one or more subnets to the set of configured subnets for the specified
          * load balancer.</p> <p>The load balancer evenly distributes requests across all
@@ -343,6 +395,11 @@ namespace Model
          */
         virtual Model::AttachLoadBalancerToSubnetsOutcomeCallable AttachLoadBalancerToSubnetsCallable(const Model::AttachLoadBalancerToSubnetsRequest& request) const;
 
+        /**
+         * Same as AttachLoadBalancerToSubnetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachLoadBalancerToSubnetsOutcomeCallable AttachLoadBalancerToSubnetsCallable(Model::AttachLoadBalancerToSubnetsRequest&& request) const;
+
         /**
          * <p>Adds one or more subnets to the set of configured subnets for the specified
          * load balancer.</p> <p>The load balancer evenly distributes requests across all
@@ -355,6 +412,11 @@ namespace Model
          */
         virtual void AttachLoadBalancerToSubnetsAsync(const Model::AttachLoadBalancerToSubnetsRequest& request, const AttachLoadBalancerToSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachLoadBalancerToSubnetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachLoadBalancerToSubnetsAsync(Model::AttachLoadBalancerToSubnetsRequest&& request, const AttachLoadBalancerToSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Specifies the health check settings to use when evaluating the health state
          * of your back-end instances.</p> <p>For more information, see <a
@@ -373,6 +435,11 @@ namespace Model
          */
         virtual Model::ConfigureHealthCheckOutcomeCallable ConfigureHealthCheckCallable(const Model::ConfigureHealthCheckRequest& request) const;
 
+        /**
+         * Same as ConfigureHealthCheckCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ConfigureHealthCheckOutcomeCallable ConfigureHealthCheckCallable(Model::ConfigureHealthCheckRequest&& request) const;
+
         /**
          * <p>Specifies the health check settings to use when evaluating the health state
          * of your back-end instances.</p> <p>For more information, see <a
@@ -383,6 +450,11 @@ namespace Model
          */
         virtual void ConfigureHealthCheckAsync(const Model::ConfigureHealthCheckRequest& request, const ConfigureHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfigureHealthCheckAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ConfigureHealthCheckAsync(Model::ConfigureHealthCheckRequest&& request, const ConfigureHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates a stickiness policy with sticky session lifetimes that follow that
          * of an application-generated cookie. This policy can be associated only with
@@ -417,6 +489,11 @@ namespace Model
          */
         virtual Model::CreateAppCookieStickinessPolicyOutcomeCallable CreateAppCookieStickinessPolicyCallable(const Model::CreateAppCookieStickinessPolicyRequest& request) const;
 
+        /**
+         * Same as CreateAppCookieStickinessPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateAppCookieStickinessPolicyOutcomeCallable CreateAppCookieStickinessPolicyCallable(Model::CreateAppCookieStickinessPolicyRequest&& request) const;
+
         /**
          * <p>Generates a stickiness policy with sticky session lifetimes that follow that
          * of an application-generated cookie. This policy can be associated only with
@@ -435,6 +512,11 @@ namespace Model
          */
         virtual void CreateAppCookieStickinessPolicyAsync(const Model::CreateAppCookieStickinessPolicyRequest& request, const CreateAppCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAppCookieStickinessPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateAppCookieStickinessPolicyAsync(Model::CreateAppCookieStickinessPolicyRequest&& request, const CreateAppCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates a stickiness policy with sticky session lifetimes controlled by the
          * lifetime of the browser (user-agent) or a specified expiration period. This
@@ -475,6 +557,11 @@ namespace Model
          */
         virtual Model::CreateLBCookieStickinessPolicyOutcomeCallable CreateLBCookieStickinessPolicyCallable(const Model::CreateLBCookieStickinessPolicyRequest& request) const;
 
+        /**
+         * Same as CreateLBCookieStickinessPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateLBCookieStickinessPolicyOutcomeCallable CreateLBCookieStickinessPolicyCallable(Model::CreateLBCookieStickinessPolicyRequest&& request) const;
+
         /**
          * <p>Generates a stickiness policy with sticky session lifetimes controlled by the
          * lifetime of the browser (user-agent) or a specified expiration period. This
@@ -496,6 +583,11 @@ namespace Model
          */
         virtual void CreateLBCookieStickinessPolicyAsync(const Model::CreateLBCookieStickinessPolicyRequest& request, const CreateLBCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLBCookieStickinessPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateLBCookieStickinessPolicyAsync(Model::CreateLBCookieStickinessPolicyRequest&& request, const CreateLBCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a load balancer.</p> <p>If the call completes successfully, a new
          * load balancer is created with a unique Domain Name Service (DNS) name. The load
@@ -530,6 +622,11 @@ namespace Model
          */
         virtual Model::CreateLoadBalancerOutcomeCallable CreateLoadBalancerCallable(const Model::CreateLoadBalancerRequest& request) const;
 
+        /**
+         * Same as CreateLoadBalancerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateLoadBalancerOutcomeCallable CreateLoadBalancerCallable(Model::CreateLoadBalancerRequest&& request) const;
+
         /**
          * <p>Creates a load balancer.</p> <p>If the call completes successfully, a new
          * load balancer is created with a unique Domain Name Service (DNS) name. The load
@@ -548,6 +645,11 @@ namespace Model
          */
         virtual void CreateLoadBalancerAsync(const Model::CreateLoadBalancerRequest& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLoadBalancerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateLoadBalancerAsync(Model::CreateLoadBalancerRequest&& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates one or more listeners for the specified load balancer. If a listener
          * with the specified port does not already exist, it is created; otherwise, the
@@ -572,6 +674,11 @@ namespace Model
          */
         virtual Model::CreateLoadBalancerListenersOutcomeCallable CreateLoadBalancerListenersCallable(const Model::CreateLoadBalancerListenersRequest& request) const;
 
+        /**
+         * Same as CreateLoadBalancerListenersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateLoadBalancerListenersOutcomeCallable CreateLoadBalancerListenersCallable(Model::CreateLoadBalancerListenersRequest&& request) const;
+
         /**
          * <p>Creates one or more listeners for the specified load balancer. If a listener
          * with the specified port does not already exist, it is created; otherwise, the
@@ -585,6 +692,11 @@ namespace Model
          */
         virtual void CreateLoadBalancerListenersAsync(const Model::CreateLoadBalancerListenersRequest& request, const CreateLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLoadBalancerListenersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateLoadBalancerListenersAsync(Model::CreateLoadBalancerListenersRequest&& request, const CreateLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a policy with the specified attributes for the specified load
          * balancer.</p> <p>Policies are settings that are saved for your load balancer and
@@ -603,6 +715,11 @@ namespace Model
          */
         virtual Model::CreateLoadBalancerPolicyOutcomeCallable CreateLoadBalancerPolicyCallable(const Model::CreateLoadBalancerPolicyRequest& request) const;
 
+        /**
+         * Same as CreateLoadBalancerPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateLoadBalancerPolicyOutcomeCallable CreateLoadBalancerPolicyCallable(Model::CreateLoadBalancerPolicyRequest&& request) const;
+
         /**
          * <p>Creates a policy with the specified attributes for the specified load
          * balancer.</p> <p>Policies are settings that are saved for your load balancer and
@@ -613,6 +730,11 @@ namespace Model
          */
         virtual void CreateLoadBalancerPolicyAsync(const Model::CreateLoadBalancerPolicyRequest& request, const CreateLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLoadBalancerPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateLoadBalancerPolicyAsync(Model::CreateLoadBalancerPolicyRequest&& request, const CreateLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified load balancer.</p> <p>If you are attempting to recreate
          * a load balancer, you must reconfigure all settings. The DNS name associated with
@@ -637,6 +759,11 @@ namespace Model
          */
         virtual Model::DeleteLoadBalancerOutcomeCallable DeleteLoadBalancerCallable(const Model::DeleteLoadBalancerRequest& request) const;
 
+        /**
+         * Same as DeleteLoadBalancerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteLoadBalancerOutcomeCallable DeleteLoadBalancerCallable(Model::DeleteLoadBalancerRequest&& request) const;
+
         /**
          * <p>Deletes the specified load balancer.</p> <p>If you are attempting to recreate
          * a load balancer, you must reconfigure all settings. The DNS name associated with
@@ -650,6 +777,11 @@ namespace Model
          */
         virtual void DeleteLoadBalancerAsync(const Model::DeleteLoadBalancerRequest& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLoadBalancerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteLoadBalancerAsync(Model::DeleteLoadBalancerRequest&& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified listeners from the specified load balancer.</p>
          */
@@ -662,6 +794,11 @@ namespace Model
          */
         virtual Model::DeleteLoadBalancerListenersOutcomeCallable DeleteLoadBalancerListenersCallable(const Model::DeleteLoadBalancerListenersRequest& request) const;
 
+        /**
+         * Same as DeleteLoadBalancerListenersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteLoadBalancerListenersOutcomeCallable DeleteLoadBalancerListenersCallable(Model::DeleteLoadBalancerListenersRequest&& request) const;
+
         /**
          * <p>Deletes the specified listeners from the specified load balancer.</p>
          *
@@ -669,6 +806,11 @@ namespace Model
          */
         virtual void DeleteLoadBalancerListenersAsync(const Model::DeleteLoadBalancerListenersRequest& request, const DeleteLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLoadBalancerListenersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteLoadBalancerListenersAsync(Model::DeleteLoadBalancerListenersRequest&& request, const DeleteLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified policy from the specified load balancer. This policy
          * must not be enabled for any listeners.</p>
@@ -683,6 +825,11 @@ namespace Model
          */
         virtual Model::DeleteLoadBalancerPolicyOutcomeCallable DeleteLoadBalancerPolicyCallable(const Model::DeleteLoadBalancerPolicyRequest& request) const;
 
+        /**
+         * Same as DeleteLoadBalancerPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteLoadBalancerPolicyOutcomeCallable DeleteLoadBalancerPolicyCallable(Model::DeleteLoadBalancerPolicyRequest&& request) const;
+
         /**
          * <p>Deletes the specified policy from the specified load balancer. This policy
          * must not be enabled for any listeners.</p>
@@ -691,6 +838,11 @@ namespace Model
          */
         virtual void DeleteLoadBalancerPolicyAsync(const Model::DeleteLoadBalancerPolicyRequest& request, const DeleteLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLoadBalancerPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteLoadBalancerPolicyAsync(Model::DeleteLoadBalancerPolicyRequest&& request, const DeleteLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters the specified instances from the specified load balancer. After
          * the instance is deregistered, it no longer receives traffic from the load
@@ -717,6 +869,11 @@ namespace Model
          */
         virtual Model::DeregisterInstancesFromLoadBalancerOutcomeCallable DeregisterInstancesFromLoadBalancerCallable(const Model::DeregisterInstancesFromLoadBalancerRequest& request) const;
 
+        /**
+         * Same as DeregisterInstancesFromLoadBalancerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeregisterInstancesFromLoadBalancerOutcomeCallable DeregisterInstancesFromLoadBalancerCallable(Model::DeregisterInstancesFromLoadBalancerRequest&& request) const;
+
         /**
          * <p>Deregisters the specified instances from the specified load balancer. After
          * the instance is deregistered, it no longer receives traffic from the load
@@ -731,6 +888,11 @@ namespace Model
          */
         virtual void DeregisterInstancesFromLoadBalancerAsync(const Model::DeregisterInstancesFromLoadBalancerRequest& request, const DeregisterInstancesFromLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterInstancesFromLoadBalancerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeregisterInstancesFromLoadBalancerAsync(Model::DeregisterInstancesFromLoadBalancerRequest&& request, const DeregisterInstancesFromLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the state of the specified instances with respect to the specified
          * load balancer. If no instances are specified, the call describes the state of
@@ -751,6 +913,11 @@ namespace Model
          */
         virtual Model::DescribeInstanceHealthOutcomeCallable DescribeInstanceHealthCallable(const Model::DescribeInstanceHealthRequest& request) const;
 
+        /**
+         * Same as DescribeInstanceHealthCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeInstanceHealthOutcomeCallable DescribeInstanceHealthCallable(Model::DescribeInstanceHealthRequest&& request) const;
+
         /**
          * <p>Describes the state of the specified instances with respect to the specified
          * load balancer. If no instances are specified, the call describes the state of
@@ -762,6 +929,11 @@ namespace Model
          */
         virtual void DescribeInstanceHealthAsync(const Model::DescribeInstanceHealthRequest& request, const DescribeInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInstanceHealthAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeInstanceHealthAsync(Model::DescribeInstanceHealthRequest&& request, const DescribeInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the attributes for the specified load balancer.</p>
          */
@@ -774,6 +946,11 @@ namespace Model
          */
         virtual Model::DescribeLoadBalancerAttributesOutcomeCallable DescribeLoadBalancerAttributesCallable(const Model::DescribeLoadBalancerAttributesRequest& request) const;
 
+        /**
+         * Same as DescribeLoadBalancerAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLoadBalancerAttributesOutcomeCallable DescribeLoadBalancerAttributesCallable(Model::DescribeLoadBalancerAttributesRequest&& request) const;
+
         /**
          * <p>Describes the attributes for the specified load balancer.</p>
          *
@@ -781,6 +958,11 @@ namespace Model
          */
         virtual void DescribeLoadBalancerAttributesAsync(const Model::DescribeLoadBalancerAttributesRequest& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBalancerAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLoadBalancerAttributesAsync(Model::DescribeLoadBalancerAttributesRequest&& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified policies.</p> <p>If you specify a load balancer name,
          * the action returns the descriptions of all policies created for the load
@@ -805,6 +987,11 @@ namespace Model
          */
         virtual Model::DescribeLoadBalancerPoliciesOutcomeCallable DescribeLoadBalancerPoliciesCallable(const Model::DescribeLoadBalancerPoliciesRequest& request) const;
 
+        /**
+         * Same as DescribeLoadBalancerPoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLoadBalancerPoliciesOutcomeCallable DescribeLoadBalancerPoliciesCallable(Model::DescribeLoadBalancerPoliciesRequest&& request) const;
+
         /**
          * <p>Describes the specified policies.</p> <p>If you specify a load balancer name,
          * the action returns the descriptions of all policies created for the load
@@ -818,6 +1005,11 @@ namespace Model
          */
         virtual void DescribeLoadBalancerPoliciesAsync(const Model::DescribeLoadBalancerPoliciesRequest& request, const DescribeLoadBalancerPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBalancerPoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLoadBalancerPoliciesAsync(Model::DescribeLoadBalancerPoliciesRequest&& request, const DescribeLoadBalancerPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified load balancer policy types.</p> <p>You can use these
          * policy types with <a>CreateLoadBalancerPolicy</a> to create policy
@@ -834,6 +1026,11 @@ namespace Model
          */
         virtual Model::DescribeLoadBalancerPolicyTypesOutcomeCallable DescribeLoadBalancerPolicyTypesCallable(const Model::DescribeLoadBalancerPolicyTypesRequest& request) const;
 
+        /**
+         * Same as DescribeLoadBalancerPolicyTypesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLoadBalancerPolicyTypesOutcomeCallable DescribeLoadBalancerPolicyTypesCallable(Model::DescribeLoadBalancerPolicyTypesRequest&& request) const;
+
         /**
          * <p>Describes the specified load balancer policy types.</p> <p>You can use these
          * policy types with <a>CreateLoadBalancerPolicy</a> to create policy
@@ -843,6 +1040,11 @@ namespace Model
          */
         virtual void DescribeLoadBalancerPolicyTypesAsync(const Model::DescribeLoadBalancerPolicyTypesRequest& request, const DescribeLoadBalancerPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBalancerPolicyTypesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLoadBalancerPolicyTypesAsync(Model::DescribeLoadBalancerPolicyTypesRequest&& request, const DescribeLoadBalancerPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified the load balancers. If no load balancers are
          * specified, the call describes all of your load balancers.</p>
@@ -857,6 +1059,11 @@ namespace Model
          */
         virtual Model::DescribeLoadBalancersOutcomeCallable DescribeLoadBalancersCallable(const Model::DescribeLoadBalancersRequest& request) const;
 
+        /**
+         * Same as DescribeLoadBalancersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLoadBalancersOutcomeCallable DescribeLoadBalancersCallable(Model::DescribeLoadBalancersRequest&& request) const;
+
         /**
          * <p>Describes the specified the load balancers. If no load balancers are
          * specified, the call describes all of your load balancers.</p>
@@ -865,6 +1072,11 @@ namespace Model
          */
         virtual void DescribeLoadBalancersAsync(const Model::DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBalancersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLoadBalancersAsync(Model::DescribeLoadBalancersRequest&& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the tags associated with the specified load balancers.</p>
          */
@@ -877,6 +1089,11 @@ namespace Model
          */
         virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(const Model::DescribeTagsRequest& request) const;
 
+        /**
+         * Same as DescribeTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(Model::DescribeTagsRequest&& request) const;
+
         /**
          * <p>Describes the tags associated with the specified load balancers.</p>
          *
@@ -884,6 +1101,11 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTagsAsync(Model::DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified subnets from the set of configured subnets for the load
          * balancer.</p> <p>After a subnet is removed, all EC2 instances registered with
@@ -904,6 +1126,11 @@ namespace Model
          */
         virtual Model::DetachLoadBalancerFromSubnetsOutcomeCallable DetachLoadBalancerFromSubnetsCallable(const Model::DetachLoadBalancerFromSubnetsRequest& request) const;
 
+        /**
+         * Same as DetachLoadBalancerFromSubnetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachLoadBalancerFromSubnetsOutcomeCallable DetachLoadBalancerFromSubnetsCallable(Model::DetachLoadBalancerFromSubnetsRequest&& request) const;
+
         /**
          * <p>Removes the specified subnets from the set of configured subnets for the load
          * balancer.</p> <p>After a subnet is removed, all EC2 instances registered with
@@ -915,6 +1142,11 @@ namespace Model
          */
         virtual void DetachLoadBalancerFromSubnetsAsync(const Model::DetachLoadBalancerFromSubnetsRequest& request, const DetachLoadBalancerFromSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachLoadBalancerFromSubnetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachLoadBalancerFromSubnetsAsync(Model::DetachLoadBalancerFromSubnetsRequest&& request, const DetachLoadBalancerFromSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified Availability Zones from the set of Availability Zones
          * for the specified load balancer.</p> <p>There must be at least one Availability
@@ -945,6 +1177,11 @@ namespace Model
          */
         virtual Model::DisableAvailabilityZonesForLoadBalancerOutcomeCallable DisableAvailabilityZonesForLoadBalancerCallable(const Model::DisableAvailabilityZonesForLoadBalancerRequest& request) const;
 
+        /**
+         * Same as DisableAvailabilityZonesForLoadBalancerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableAvailabilityZonesForLoadBalancerOutcomeCallable DisableAvailabilityZonesForLoadBalancerCallable(Model::DisableAvailabilityZonesForLoadBalancerRequest&& request) const;
+
         /**
          * <p>Removes the specified Availability Zones from the set of Availability Zones
          * for the specified load balancer.</p> <p>There must be at least one Availability
@@ -961,6 +1198,11 @@ namespace Model
          */
         virtual void DisableAvailabilityZonesForLoadBalancerAsync(const Model::DisableAvailabilityZonesForLoadBalancerRequest& request, const DisableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableAvailabilityZonesForLoadBalancerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableAvailabilityZonesForLoadBalancerAsync(Model::DisableAvailabilityZonesForLoadBalancerRequest&& request, const DisableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds the specified Availability Zones to the set of Availability Zones for
          * the specified load balancer.</p> <p>The load balancer evenly distributes
@@ -983,6 +1225,11 @@ namespace Model
          */
         virtual Model::EnableAvailabilityZonesForLoadBalancerOutcomeCallable EnableAvailabilityZonesForLoadBalancerCallable(const Model::EnableAvailabilityZonesForLoadBalancerRequest& request) const;
 
+        /**
+         * Same as EnableAvailabilityZonesForLoadBalancerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableAvailabilityZonesForLoadBalancerOutcomeCallable EnableAvailabilityZonesForLoadBalancerCallable(Model::EnableAvailabilityZonesForLoadBalancerRequest&& request) const;
+
         /**
          * <p>Adds the specified Availability Zones to the set of Availability Zones for
          * the specified load balancer.</p> <p>The load balancer evenly distributes
@@ -995,6 +1242,11 @@ namespace Model
          */
         virtual void EnableAvailabilityZonesForLoadBalancerAsync(const Model::EnableAvailabilityZonesForLoadBalancerRequest& request, const EnableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableAvailabilityZonesForLoadBalancerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableAvailabilityZonesForLoadBalancerAsync(Model::EnableAvailabilityZonesForLoadBalancerRequest&& request, const EnableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the attributes of the specified load balancer.</p> <p>You can modify
          * the load balancer attributes, such as <code>AccessLogs</code>,
@@ -1035,6 +1287,11 @@ namespace Model
          */
         virtual Model::ModifyLoadBalancerAttributesOutcomeCallable ModifyLoadBalancerAttributesCallable(const Model::ModifyLoadBalancerAttributesRequest& request) const;
 
+        /**
+         * Same as ModifyLoadBalancerAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyLoadBalancerAttributesOutcomeCallable ModifyLoadBalancerAttributesCallable(Model::ModifyLoadBalancerAttributesRequest&& request) const;
+
         /**
          * <p>Modifies the attributes of the specified load balancer.</p> <p>You can modify
          * the load balancer attributes, such as <code>AccessLogs</code>,
@@ -1056,6 +1313,11 @@ namespace Model
          */
         virtual void ModifyLoadBalancerAttributesAsync(const Model::ModifyLoadBalancerAttributesRequest& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyLoadBalancerAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyLoadBalancerAttributesAsync(Model::ModifyLoadBalancerAttributesRequest&& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds the specified instances to the specified load balancer.</p> <p>The
          * instance must be a running instance in the same network as the load balancer
@@ -1116,6 +1378,11 @@ namespace Model
          */
         virtual Model::RegisterInstancesWithLoadBalancerOutcomeCallable RegisterInstancesWithLoadBalancerCallable(const Model::RegisterInstancesWithLoadBalancerRequest& request) const;
 
+        /**
+         * Same as RegisterInstancesWithLoadBalancerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterInstancesWithLoadBalancerOutcomeCallable RegisterInstancesWithLoadBalancerCallable(Model::RegisterInstancesWithLoadBalancerRequest&& request) const;
+
         /**
          * <p>Adds the specified instances to the specified load balancer.</p> <p>The
          * instance must be a running instance in the same network as the load balancer
@@ -1147,6 +1414,11 @@ namespace Model
          */
         virtual void RegisterInstancesWithLoadBalancerAsync(const Model::RegisterInstancesWithLoadBalancerRequest& request, const RegisterInstancesWithLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterInstancesWithLoadBalancerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterInstancesWithLoadBalancerAsync(Model::RegisterInstancesWithLoadBalancerRequest&& request, const RegisterInstancesWithLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes one or more tags from the specified load balancer.</p>
          */
@@ -1159,6 +1431,11 @@ namespace Model
          */
         virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(const Model::RemoveTagsRequest& request) const;
 
+        /**
+         * Same as RemoveTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(Model::RemoveTagsRequest&& request) const;
+
         /**
          * <p>Removes one or more tags from the specified load balancer.</p>
          *
@@ -1166,6 +1443,11 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveTagsAsync(Model::RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the certificate that terminates the specified listener's SSL
          * connections. The specified certificate replaces any prior certificate that was
@@ -1190,6 +1472,11 @@ namespace Model
          */
         virtual Model::SetLoadBalancerListenerSSLCertificateOutcomeCallable SetLoadBalancerListenerSSLCertificateCallable(const Model::SetLoadBalancerListenerSSLCertificateRequest& request) const;
 
+        /**
+         * Same as SetLoadBalancerListenerSSLCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetLoadBalancerListenerSSLCertificateOutcomeCallable SetLoadBalancerListenerSSLCertificateCallable(Model::SetLoadBalancerListenerSSLCertificateRequest&& request) const;
+
         /**
          * <p>Sets the certificate that terminates the specified listener's SSL
          * connections. The specified certificate replaces any prior certificate that was
@@ -1203,6 +1490,11 @@ namespace Model
          */
         virtual void SetLoadBalancerListenerSSLCertificateAsync(const Model::SetLoadBalancerListenerSSLCertificateRequest& request, const SetLoadBalancerListenerSSLCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetLoadBalancerListenerSSLCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetLoadBalancerListenerSSLCertificateAsync(Model::SetLoadBalancerListenerSSLCertificateRequest&& request, const SetLoadBalancerListenerSSLCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Replaces the set of policies associated with the specified port on which the
          * back-end server is listening with a new set of policies. At this time, only the
@@ -1231,6 +1523,11 @@ namespace Model
          */
         virtual Model::SetLoadBalancerPoliciesForBackendServerOutcomeCallable SetLoadBalancerPoliciesForBackendServerCallable(const Model::SetLoadBalancerPoliciesForBackendServerRequest& request) const;
 
+        /**
+         * Same as SetLoadBalancerPoliciesForBackendServerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetLoadBalancerPoliciesForBackendServerOutcomeCallable SetLoadBalancerPoliciesForBackendServerCallable(Model::SetLoadBalancerPoliciesForBackendServerRequest&& request) const;
+
         /**
          * <p>Replaces the set of policies associated with the specified port on which the
          * back-end server is listening with a new set of policies. At this time, only the
@@ -1246,6 +1543,11 @@ namespace Model
          */
         virtual void SetLoadBalancerPoliciesForBackendServerAsync(const Model::SetLoadBalancerPoliciesForBackendServerRequest& request, const SetLoadBalancerPoliciesForBackendServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetLoadBalancerPoliciesForBackendServerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetLoadBalancerPoliciesForBackendServerAsync(Model::SetLoadBalancerPoliciesForBackendServerRequest&& request, const SetLoadBalancerPoliciesForBackendServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates, updates, or disables a policy with a listener for the specified
          * load balancer. You can associate multiple policies with a listener.</p>
@@ -1260,6 +1562,11 @@ namespace Model
          */
         virtual Model::SetLoadBalancerPoliciesOfListenerOutcomeCallable SetLoadBalancerPoliciesOfListenerCallable(const Model::SetLoadBalancerPoliciesOfListenerRequest& request) const;
 
+        /**
+         * Same as SetLoadBalancerPoliciesOfListenerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetLoadBalancerPoliciesOfListenerOutcomeCallable SetLoadBalancerPoliciesOfListenerCallable(Model::SetLoadBalancerPoliciesOfListenerRequest&& request) const;
+
         /**
          * <p>Associates, updates, or disables a policy with a listener for the specified
          * load balancer. You can associate multiple policies with a listener.</p>
@@ -1268,6 +1575,74 @@ namespace Model
          */
         virtual void SetLoadBalancerPoliciesOfListenerAsync(const Model::SetLoadBalancerPoliciesOfListenerRequest& request, const SetLoadBalancerPoliciesOfListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetLoadBalancerPoliciesOfListenerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetLoadBalancerPoliciesOfListenerAsync(Model::SetLoadBalancerPoliciesOfListenerRequest&& request, const SetLoadBalancerPoliciesOfListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsOutcome> AddTagsAwaitable(const Model::AddTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::AddTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsOutcome> AddTagsAwaitable(Model::AddTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::AddTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ApplySecurityGroupsToLoadBalancerOutcome> ApplySecurityGroupsToLoadBalancerAwaitable(const Model::ApplySecurityGroupsToLoadBalancerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ApplySecurityGroupsToLoadBalancerOutcome> ApplySecurityGroupsToLoadBalancerAwaitable(Model::ApplySecurityGroupsToLoadBalancerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachLoadBalancerToSubnetsOutcome> AttachLoadBalancerToSubnetsAwaitable(const Model::AttachLoadBalancerToSubnetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::AttachLoadBalancerToSubnets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachLoadBalancerToSubnetsOutcome> AttachLoadBalancerToSubnetsAwaitable(Model::AttachLoadBalancerToSubnetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::AttachLoadBalancerToSubnets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ConfigureHealthCheckOutcome> ConfigureHealthCheckAwaitable(const Model::ConfigureHealthCheckRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::ConfigureHealthCheck, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ConfigureHealthCheckOutcome> ConfigureHealthCheckAwaitable(Model::ConfigureHealthCheckRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::ConfigureHealthCheck, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAppCookieStickinessPolicyOutcome> CreateAppCookieStickinessPolicyAwaitable(const Model::CreateAppCookieStickinessPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::CreateAppCookieStickinessPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAppCookieStickinessPolicyOutcome> CreateAppCookieStickinessPolicyAwaitable(Model::CreateAppCookieStickinessPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::CreateAppCookieStickinessPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLBCookieStickinessPolicyOutcome> CreateLBCookieStickinessPolicyAwaitable(const Model::CreateLBCookieStickinessPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::CreateLBCookieStickinessPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLBCookieStickinessPolicyOutcome> CreateLBCookieStickinessPolicyAwaitable(Model::CreateLBCookieStickinessPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::CreateLBCookieStickinessPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLoadBalancerOutcome> CreateLoadBalancerAwaitable(const Model::CreateLoadBalancerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::CreateLoadBalancer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLoadBalancerOutcome> CreateLoadBalancerAwaitable(Model::CreateLoadBalancerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::CreateLoadBalancer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLoadBalancerListenersOutcome> CreateLoadBalancerListenersAwaitable(const Model::CreateLoadBalancerListenersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::CreateLoadBalancerListeners, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLoadBalancerListenersOutcome> CreateLoadBalancerListenersAwaitable(Model::CreateLoadBalancerListenersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::CreateLoadBalancerListeners, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLoadBalancerPolicyOutcome> CreateLoadBalancerPolicyAwaitable(const Model::CreateLoadBalancerPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::CreateLoadBalancerPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLoadBalancerPolicyOutcome> CreateLoadBalancerPolicyAwaitable(Model::CreateLoadBalancerPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::CreateLoadBalancerPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLoadBalancerOutcome> DeleteLoadBalancerAwaitable(const Model::DeleteLoadBalancerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DeleteLoadBalancer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLoadBalancerOutcome> DeleteLoadBalancerAwaitable(Model::DeleteLoadBalancerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DeleteLoadBalancer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLoadBalancerListenersOutcome> DeleteLoadBalancerListenersAwaitable(const Model::DeleteLoadBalancerListenersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DeleteLoadBalancerListeners, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLoadBalancerListenersOutcome> DeleteLoadBalancerListenersAwaitable(Model::DeleteLoadBalancerListenersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DeleteLoadBalancerListeners, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLoadBalancerPolicyOutcome> DeleteLoadBalancerPolicyAwaitable(const Model::DeleteLoadBalancerPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DeleteLoadBalancerPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLoadBalancerPolicyOutcome> DeleteLoadBalancerPolicyAwaitable(Model::DeleteLoadBalancerPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DeleteLoadBalancerPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterInstancesFromLoadBalancerOutcome> DeregisterInstancesFromLoadBalancerAwaitable(const Model::DeregisterInstancesFromLoadBalancerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterInstancesFromLoadBalancerOutcome> DeregisterInstancesFromLoadBalancerAwaitable(Model::DeregisterInstancesFromLoadBalancerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInstanceHealthOutcome> DescribeInstanceHealthAwaitable(const Model::DescribeInstanceHealthRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DescribeInstanceHealth, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInstanceHealthOutcome> DescribeInstanceHealthAwaitable(Model::DescribeInstanceHealthRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DescribeInstanceHealth, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLoadBalancerAttributesOutcome> DescribeLoadBalancerAttributesAwaitable(const Model::DescribeLoadBalancerAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DescribeLoadBalancerAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLoadBalancerAttributesOutcome> DescribeLoadBalancerAttributesAwaitable(Model::DescribeLoadBalancerAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DescribeLoadBalancerAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLoadBalancerPoliciesOutcome> DescribeLoadBalancerPoliciesAwaitable(const Model::DescribeLoadBalancerPoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DescribeLoadBalancerPolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLoadBalancerPoliciesOutcome> DescribeLoadBalancerPoliciesAwaitable(Model::DescribeLoadBalancerPoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DescribeLoadBalancerPolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLoadBalancerPolicyTypesOutcome> DescribeLoadBalancerPolicyTypesAwaitable(const Model::DescribeLoadBalancerPolicyTypesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLoadBalancerPolicyTypesOutcome> DescribeLoadBalancerPolicyTypesAwaitable(Model::DescribeLoadBalancerPolicyTypesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLoadBalancersOutcome> DescribeLoadBalancersAwaitable(const Model::DescribeLoadBalancersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DescribeLoadBalancers, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLoadBalancersOutcome> DescribeLoadBalancersAwaitable(Model::DescribeLoadBalancersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DescribeLoadBalancers, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTagsOutcome> DescribeTagsAwaitable(const Model::DescribeTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DescribeTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTagsOutcome> DescribeTagsAwaitable(Model::DescribeTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DescribeTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachLoadBalancerFromSubnetsOutcome> DetachLoadBalancerFromSubnetsAwaitable(const Model::DetachLoadBalancerFromSubnetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DetachLoadBalancerFromSubnets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachLoadBalancerFromSubnetsOutcome> DetachLoadBalancerFromSubnetsAwaitable(Model::DetachLoadBalancerFromSubnetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DetachLoadBalancerFromSubnets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableAvailabilityZonesForLoadBalancerOutcome> DisableAvailabilityZonesForLoadBalancerAwaitable(const Model::DisableAvailabilityZonesForLoadBalancerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableAvailabilityZonesForLoadBalancerOutcome> DisableAvailabilityZonesForLoadBalancerAwaitable(Model::DisableAvailabilityZonesForLoadBalancerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableAvailabilityZonesForLoadBalancerOutcome> EnableAvailabilityZonesForLoadBalancerAwaitable(const Model::EnableAvailabilityZonesForLoadBalancerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableAvailabilityZonesForLoadBalancerOutcome> EnableAvailabilityZonesForLoadBalancerAwaitable(Model::EnableAvailabilityZonesForLoadBalancerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyLoadBalancerAttributesOutcome> ModifyLoadBalancerAttributesAwaitable(const Model::ModifyLoadBalancerAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::ModifyLoadBalancerAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyLoadBalancerAttributesOutcome> ModifyLoadBalancerAttributesAwaitable(Model::ModifyLoadBalancerAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::ModifyLoadBalancerAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterInstancesWithLoadBalancerOutcome> RegisterInstancesWithLoadBalancerAwaitable(const Model::RegisterInstancesWithLoadBalancerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterInstancesWithLoadBalancerOutcome> RegisterInstancesWithLoadBalancerAwaitable(Model::RegisterInstancesWithLoadBalancerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(const Model::RemoveTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::RemoveTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(Model::RemoveTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::RemoveTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetLoadBalancerListenerSSLCertificateOutcome> SetLoadBalancerListenerSSLCertificateAwaitable(const Model::SetLoadBalancerListenerSSLCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetLoadBalancerListenerSSLCertificateOutcome> SetLoadBalancerListenerSSLCertificateAwaitable(Model::SetLoadBalancerListenerSSLCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetLoadBalancerPoliciesForBackendServerOutcome> SetLoadBalancerPoliciesForBackendServerAwaitable(const Model::SetLoadBalancerPoliciesForBackendServerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetLoadBalancerPoliciesForBackendServerOutcome> SetLoadBalancerPoliciesForBackendServerAwaitable(Model::SetLoadBalancerPoliciesForBackendServerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetLoadBalancerPoliciesOfListenerOutcome> SetLoadBalancerPoliciesOfListenerAwaitable(const Model::SetLoadBalancerPoliciesOfListenerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListener, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetLoadBalancerPoliciesOfListenerOutcome> SetLoadBalancerPoliciesOfListenerAwaitable(Model::SetLoadBalancerPoliciesOfListenerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListener, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
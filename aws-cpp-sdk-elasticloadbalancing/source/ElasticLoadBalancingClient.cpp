@@ -135,12 +135,22 @@ AddTagsOutcome ElasticLoadBalancingClient::AddTags(const AddTagsRequest& request
 
 AddTagsOutcomeCallable ElasticLoadBalancingClient::AddTagsCallable(const AddTagsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::AddTags, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::AddTags, Aws::Client::RejectedCallOutcome<AddTagsOutcome>(), this, request);
+}
+
+AddTagsOutcomeCallable ElasticLoadBalancingClient::AddTagsCallable(AddTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::AddTags, Aws::Client::RejectedCallOutcome<AddTagsOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::AddTagsAsync(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::AddTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::AddTagsAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::AddTagsAsync(AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::AddTagsAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::AddTagsAsyncHelper(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -165,12 +175,22 @@ ApplySecurityGroupsToLoadBalancerOutcome ElasticLoadBalancingClient::ApplySecuri
 
 ApplySecurityGroupsToLoadBalancerOutcomeCallable ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerCallable(const ApplySecurityGroupsToLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancer, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancer, Aws::Client::RejectedCallOutcome<ApplySecurityGroupsToLoadBalancerOutcome>(), this, request);
+}
+
+ApplySecurityGroupsToLoadBalancerOutcomeCallable ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerCallable(ApplySecurityGroupsToLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancer, Aws::Client::RejectedCallOutcome<ApplySecurityGroupsToLoadBalancerOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerAsync(const ApplySecurityGroupsToLoadBalancerRequest& request, const ApplySecurityGroupsToLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<ApplySecurityGroupsToLoadBalancerOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerAsync(ApplySecurityGroupsToLoadBalancerRequest&& request, const ApplySecurityGroupsToLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<ApplySecurityGroupsToLoadBalancerOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::ApplySecurityGroupsToLoadBalancerAsyncHelper(const ApplySecurityGroupsToLoadBalancerRequest& request, const ApplySecurityGroupsToLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -195,12 +215,22 @@ AttachLoadBalancerToSubnetsOutcome ElasticLoadBalancingClient::AttachLoadBalance
 
 AttachLoadBalancerToSubnetsOutcomeCallable ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsCallable(const AttachLoadBalancerToSubnetsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::AttachLoadBalancerToSubnets, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::AttachLoadBalancerToSubnets, Aws::Client::RejectedCallOutcome<AttachLoadBalancerToSubnetsOutcome>(), this, request);
+}
+
+AttachLoadBalancerToSubnetsOutcomeCallable ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsCallable(AttachLoadBalancerToSubnetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::AttachLoadBalancerToSubnets, Aws::Client::RejectedCallOutcome<AttachLoadBalancerToSubnetsOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsAsync(const AttachLoadBalancerToSubnetsRequest& request, const AttachLoadBalancerToSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsAsyncHelper, Aws::Client::RejectedAsyncCall<AttachLoadBalancerToSubnetsOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsAsync(AttachLoadBalancerToSubnetsRequest&& request, const AttachLoadBalancerToSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsAsyncHelper, Aws::Client::RejectedAsyncCall<AttachLoadBalancerToSubnetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::AttachLoadBalancerToSubnetsAsyncHelper(const AttachLoadBalancerToSubnetsRequest& request, const AttachLoadBalancerToSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -225,12 +255,22 @@ ConfigureHealthCheckOutcome ElasticLoadBalancingClient::ConfigureHealthCheck(con
 
 ConfigureHealthCheckOutcomeCallable ElasticLoadBalancingClient::ConfigureHealthCheckCallable(const ConfigureHealthCheckRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::ConfigureHealthCheck, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::ConfigureHealthCheck, Aws::Client::RejectedCallOutcome<ConfigureHealthCheckOutcome>(), this, request);
+}
+
+ConfigureHealthCheckOutcomeCallable ElasticLoadBalancingClient::ConfigureHealthCheckCallable(ConfigureHealthCheckRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::ConfigureHealthCheck, Aws::Client::RejectedCallOutcome<ConfigureHealthCheckOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::ConfigureHealthCheckAsync(const ConfigureHealthCheckRequest& request, const ConfigureHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::ConfigureHealthCheckAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::ConfigureHealthCheckAsyncHelper, Aws::Client::RejectedAsyncCall<ConfigureHealthCheckOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::ConfigureHealthCheckAsync(ConfigureHealthCheckRequest&& request, const ConfigureHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::ConfigureHealthCheckAsyncHelper, Aws::Client::RejectedAsyncCall<ConfigureHealthCheckOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::ConfigureHealthCheckAsyncHelper(const ConfigureHealthCheckRequest& request, const ConfigureHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -255,12 +295,22 @@ CreateAppCookieStickinessPolicyOutcome ElasticLoadBalancingClient::CreateAppCook
 
 CreateAppCookieStickinessPolicyOutcomeCallable ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyCallable(const CreateAppCookieStickinessPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::CreateAppCookieStickinessPolicy, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::CreateAppCookieStickinessPolicy, Aws::Client::RejectedCallOutcome<CreateAppCookieStickinessPolicyOutcome>(), this, request);
+}
+
+CreateAppCookieStickinessPolicyOutcomeCallable ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyCallable(CreateAppCookieStickinessPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::CreateAppCookieStickinessPolicy, Aws::Client::RejectedCallOutcome<CreateAppCookieStickinessPolicyOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyAsync(const CreateAppCookieStickinessPolicyRequest& request, const CreateAppCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAppCookieStickinessPolicyOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyAsync(CreateAppCookieStickinessPolicyRequest&& request, const CreateAppCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAppCookieStickinessPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::CreateAppCookieStickinessPolicyAsyncHelper(const CreateAppCookieStickinessPolicyRequest& request, const CreateAppCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -285,12 +335,22 @@ CreateLBCookieStickinessPolicyOutcome ElasticLoadBalancingClient::CreateLBCookie
 
 CreateLBCookieStickinessPolicyOutcomeCallable ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyCallable(const CreateLBCookieStickinessPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::CreateLBCookieStickinessPolicy, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::CreateLBCookieStickinessPolicy, Aws::Client::RejectedCallOutcome<CreateLBCookieStickinessPolicyOutcome>(), this, request);
+}
+
+CreateLBCookieStickinessPolicyOutcomeCallable ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyCallable(CreateLBCookieStickinessPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::CreateLBCookieStickinessPolicy, Aws::Client::RejectedCallOutcome<CreateLBCookieStickinessPolicyOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyAsync(const CreateLBCookieStickinessPolicyRequest& request, const CreateLBCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLBCookieStickinessPolicyOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyAsync(CreateLBCookieStickinessPolicyRequest&& request, const CreateLBCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLBCookieStickinessPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::CreateLBCookieStickinessPolicyAsyncHelper(const CreateLBCookieStickinessPolicyRequest& request, const CreateLBCookieStickinessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -315,12 +375,22 @@ CreateLoadBalancerOutcome ElasticLoadBalancingClient::CreateLoadBalancer(const C
 
 CreateLoadBalancerOutcomeCallable ElasticLoadBalancingClient::CreateLoadBalancerCallable(const CreateLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::CreateLoadBalancer, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::CreateLoadBalancer, Aws::Client::RejectedCallOutcome<CreateLoadBalancerOutcome>(), this, request);
+}
+
+CreateLoadBalancerOutcomeCallable ElasticLoadBalancingClient::CreateLoadBalancerCallable(CreateLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::CreateLoadBalancer, Aws::Client::RejectedCallOutcome<CreateLoadBalancerOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::CreateLoadBalancerAsync(const CreateLoadBalancerRequest& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::CreateLoadBalancerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::CreateLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLoadBalancerOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::CreateLoadBalancerAsync(CreateLoadBalancerRequest&& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::CreateLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLoadBalancerOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::CreateLoadBalancerAsyncHelper(const CreateLoadBalancerRequest& request, const CreateLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -345,12 +415,22 @@ CreateLoadBalancerListenersOutcome ElasticLoadBalancingClient::CreateLoadBalance
 
 CreateLoadBalancerListenersOutcomeCallable ElasticLoadBalancingClient::CreateLoadBalancerListenersCallable(const CreateLoadBalancerListenersRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::CreateLoadBalancerListeners, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::CreateLoadBalancerListeners, Aws::Client::RejectedCallOutcome<CreateLoadBalancerListenersOutcome>(), this, request);
+}
+
+CreateLoadBalancerListenersOutcomeCallable ElasticLoadBalancingClient::CreateLoadBalancerListenersCallable(CreateLoadBalancerListenersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::CreateLoadBalancerListeners, Aws::Client::RejectedCallOutcome<CreateLoadBalancerListenersOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::CreateLoadBalancerListenersAsync(const CreateLoadBalancerListenersRequest& request, const CreateLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::CreateLoadBalancerListenersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::CreateLoadBalancerListenersAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLoadBalancerListenersOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::CreateLoadBalancerListenersAsync(CreateLoadBalancerListenersRequest&& request, const CreateLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::CreateLoadBalancerListenersAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLoadBalancerListenersOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::CreateLoadBalancerListenersAsyncHelper(const CreateLoadBalancerListenersRequest& request, const CreateLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -375,12 +455,22 @@ CreateLoadBalancerPolicyOutcome ElasticLoadBalancingClient::CreateLoadBalancerPo
 
 CreateLoadBalancerPolicyOutcomeCallable ElasticLoadBalancingClient::CreateLoadBalancerPolicyCallable(const CreateLoadBalancerPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::CreateLoadBalancerPolicy, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::CreateLoadBalancerPolicy, Aws::Client::RejectedCallOutcome<CreateLoadBalancerPolicyOutcome>(), this, request);
+}
+
+CreateLoadBalancerPolicyOutcomeCallable ElasticLoadBalancingClient::CreateLoadBalancerPolicyCallable(CreateLoadBalancerPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::CreateLoadBalancerPolicy, Aws::Client::RejectedCallOutcome<CreateLoadBalancerPolicyOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::CreateLoadBalancerPolicyAsync(const CreateLoadBalancerPolicyRequest& request, const CreateLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::CreateLoadBalancerPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::CreateLoadBalancerPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLoadBalancerPolicyOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::CreateLoadBalancerPolicyAsync(CreateLoadBalancerPolicyRequest&& request, const CreateLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::CreateLoadBalancerPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLoadBalancerPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::CreateLoadBalancerPolicyAsyncHelper(const CreateLoadBalancerPolicyRequest& request, const CreateLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -405,12 +495,22 @@ DeleteLoadBalancerOutcome ElasticLoadBalancingClient::DeleteLoadBalancer(const D
 
 DeleteLoadBalancerOutcomeCallable ElasticLoadBalancingClient::DeleteLoadBalancerCallable(const DeleteLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::DeleteLoadBalancer, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DeleteLoadBalancer, Aws::Client::RejectedCallOutcome<DeleteLoadBalancerOutcome>(), this, request);
+}
+
+DeleteLoadBalancerOutcomeCallable ElasticLoadBalancingClient::DeleteLoadBalancerCallable(DeleteLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DeleteLoadBalancer, Aws::Client::RejectedCallOutcome<DeleteLoadBalancerOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::DeleteLoadBalancerAsync(const DeleteLoadBalancerRequest& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::DeleteLoadBalancerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DeleteLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLoadBalancerOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::DeleteLoadBalancerAsync(DeleteLoadBalancerRequest&& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DeleteLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLoadBalancerOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::DeleteLoadBalancerAsyncHelper(const DeleteLoadBalancerRequest& request, const DeleteLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -435,12 +535,22 @@ DeleteLoadBalancerListenersOutcome ElasticLoadBalancingClient::DeleteLoadBalance
 
 DeleteLoadBalancerListenersOutcomeCallable ElasticLoadBalancingClient::DeleteLoadBalancerListenersCallable(const DeleteLoadBalancerListenersRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::DeleteLoadBalancerListeners, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DeleteLoadBalancerListeners, Aws::Client::RejectedCallOutcome<DeleteLoadBalancerListenersOutcome>(), this, request);
+}
+
+DeleteLoadBalancerListenersOutcomeCallable ElasticLoadBalancingClient::DeleteLoadBalancerListenersCallable(DeleteLoadBalancerListenersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DeleteLoadBalancerListeners, Aws::Client::RejectedCallOutcome<DeleteLoadBalancerListenersOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::DeleteLoadBalancerListenersAsync(const DeleteLoadBalancerListenersRequest& request, const DeleteLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::DeleteLoadBalancerListenersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DeleteLoadBalancerListenersAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLoadBalancerListenersOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::DeleteLoadBalancerListenersAsync(DeleteLoadBalancerListenersRequest&& request, const DeleteLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DeleteLoadBalancerListenersAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLoadBalancerListenersOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::DeleteLoadBalancerListenersAsyncHelper(const DeleteLoadBalancerListenersRequest& request, const DeleteLoadBalancerListenersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -465,12 +575,22 @@ DeleteLoadBalancerPolicyOutcome ElasticLoadBalancingClient::DeleteLoadBalancerPo
 
 DeleteLoadBalancerPolicyOutcomeCallable ElasticLoadBalancingClient::DeleteLoadBalancerPolicyCallable(const DeleteLoadBalancerPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::DeleteLoadBalancerPolicy, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DeleteLoadBalancerPolicy, Aws::Client::RejectedCallOutcome<DeleteLoadBalancerPolicyOutcome>(), this, request);
+}
+
+DeleteLoadBalancerPolicyOutcomeCallable ElasticLoadBalancingClient::DeleteLoadBalancerPolicyCallable(DeleteLoadBalancerPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DeleteLoadBalancerPolicy, Aws::Client::RejectedCallOutcome<DeleteLoadBalancerPolicyOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::DeleteLoadBalancerPolicyAsync(const DeleteLoadBalancerPolicyRequest& request, const DeleteLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::DeleteLoadBalancerPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DeleteLoadBalancerPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLoadBalancerPolicyOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::DeleteLoadBalancerPolicyAsync(DeleteLoadBalancerPolicyRequest&& request, const DeleteLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DeleteLoadBalancerPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLoadBalancerPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::DeleteLoadBalancerPolicyAsyncHelper(const DeleteLoadBalancerPolicyRequest& request, const DeleteLoadBalancerPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -495,12 +615,22 @@ DeregisterInstancesFromLoadBalancerOutcome ElasticLoadBalancingClient::Deregiste
 
 DeregisterInstancesFromLoadBalancerOutcomeCallable ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerCallable(const DeregisterInstancesFromLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancer, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancer, Aws::Client::RejectedCallOutcome<DeregisterInstancesFromLoadBalancerOutcome>(), this, request);
+}
+
+DeregisterInstancesFromLoadBalancerOutcomeCallable ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerCallable(DeregisterInstancesFromLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancer, Aws::Client::RejectedCallOutcome<DeregisterInstancesFromLoadBalancerOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerAsync(const DeregisterInstancesFromLoadBalancerRequest& request, const DeregisterInstancesFromLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterInstancesFromLoadBalancerOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerAsync(DeregisterInstancesFromLoadBalancerRequest&& request, const DeregisterInstancesFromLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterInstancesFromLoadBalancerOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::DeregisterInstancesFromLoadBalancerAsyncHelper(const DeregisterInstancesFromLoadBalancerRequest& request, const DeregisterInstancesFromLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -525,12 +655,22 @@ DescribeInstanceHealthOutcome ElasticLoadBalancingClient::DescribeInstanceHealth
 
 DescribeInstanceHealthOutcomeCallable ElasticLoadBalancingClient::DescribeInstanceHealthCallable(const DescribeInstanceHealthRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::DescribeInstanceHealth, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DescribeInstanceHealth, Aws::Client::RejectedCallOutcome<DescribeInstanceHealthOutcome>(), this, request);
+}
+
+DescribeInstanceHealthOutcomeCallable ElasticLoadBalancingClient::DescribeInstanceHealthCallable(DescribeInstanceHealthRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DescribeInstanceHealth, Aws::Client::RejectedCallOutcome<DescribeInstanceHealthOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::DescribeInstanceHealthAsync(const DescribeInstanceHealthRequest& request, const DescribeInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::DescribeInstanceHealthAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DescribeInstanceHealthAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInstanceHealthOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::DescribeInstanceHealthAsync(DescribeInstanceHealthRequest&& request, const DescribeInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DescribeInstanceHealthAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInstanceHealthOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::DescribeInstanceHealthAsyncHelper(const DescribeInstanceHealthRequest& request, const DescribeInstanceHealthResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -555,12 +695,22 @@ DescribeLoadBalancerAttributesOutcome ElasticLoadBalancingClient::DescribeLoadBa
 
 DescribeLoadBalancerAttributesOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancerAttributesCallable(const DescribeLoadBalancerAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::DescribeLoadBalancerAttributes, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DescribeLoadBalancerAttributes, Aws::Client::RejectedCallOutcome<DescribeLoadBalancerAttributesOutcome>(), this, request);
+}
+
+DescribeLoadBalancerAttributesOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancerAttributesCallable(DescribeLoadBalancerAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DescribeLoadBalancerAttributes, Aws::Client::RejectedCallOutcome<DescribeLoadBalancerAttributesOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::DescribeLoadBalancerAttributesAsync(const DescribeLoadBalancerAttributesRequest& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::DescribeLoadBalancerAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DescribeLoadBalancerAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLoadBalancerAttributesOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::DescribeLoadBalancerAttributesAsync(DescribeLoadBalancerAttributesRequest&& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DescribeLoadBalancerAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLoadBalancerAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::DescribeLoadBalancerAttributesAsyncHelper(const DescribeLoadBalancerAttributesRequest& request, const DescribeLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -585,12 +735,22 @@ DescribeLoadBalancerPoliciesOutcome ElasticLoadBalancingClient::DescribeLoadBala
 
 DescribeLoadBalancerPoliciesOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesCallable(const DescribeLoadBalancerPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::DescribeLoadBalancerPolicies, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DescribeLoadBalancerPolicies, Aws::Client::RejectedCallOutcome<DescribeLoadBalancerPoliciesOutcome>(), this, request);
+}
+
+DescribeLoadBalancerPoliciesOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesCallable(DescribeLoadBalancerPoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DescribeLoadBalancerPolicies, Aws::Client::RejectedCallOutcome<DescribeLoadBalancerPoliciesOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesAsync(const DescribeLoadBalancerPoliciesRequest& request, const DescribeLoadBalancerPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLoadBalancerPoliciesOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesAsync(DescribeLoadBalancerPoliciesRequest&& request, const DescribeLoadBalancerPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLoadBalancerPoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::DescribeLoadBalancerPoliciesAsyncHelper(const DescribeLoadBalancerPoliciesRequest& request, const DescribeLoadBalancerPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -615,12 +775,22 @@ DescribeLoadBalancerPolicyTypesOutcome ElasticLoadBalancingClient::DescribeLoadB
 
 DescribeLoadBalancerPolicyTypesOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesCallable(const DescribeLoadBalancerPolicyTypesRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypes, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypes, Aws::Client::RejectedCallOutcome<DescribeLoadBalancerPolicyTypesOutcome>(), this, request);
+}
+
+DescribeLoadBalancerPolicyTypesOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesCallable(DescribeLoadBalancerPolicyTypesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypes, Aws::Client::RejectedCallOutcome<DescribeLoadBalancerPolicyTypesOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesAsync(const DescribeLoadBalancerPolicyTypesRequest& request, const DescribeLoadBalancerPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLoadBalancerPolicyTypesOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesAsync(DescribeLoadBalancerPolicyTypesRequest&& request, const DescribeLoadBalancerPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLoadBalancerPolicyTypesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::DescribeLoadBalancerPolicyTypesAsyncHelper(const DescribeLoadBalancerPolicyTypesRequest& request, const DescribeLoadBalancerPolicyTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -645,12 +815,22 @@ DescribeLoadBalancersOutcome ElasticLoadBalancingClient::DescribeLoadBalancers(c
 
 DescribeLoadBalancersOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancersCallable(const DescribeLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::DescribeLoadBalancers, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DescribeLoadBalancers, Aws::Client::RejectedCallOutcome<DescribeLoadBalancersOutcome>(), this, request);
+}
+
+DescribeLoadBalancersOutcomeCallable ElasticLoadBalancingClient::DescribeLoadBalancersCallable(DescribeLoadBalancersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DescribeLoadBalancers, Aws::Client::RejectedCallOutcome<DescribeLoadBalancersOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::DescribeLoadBalancersAsync(const DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::DescribeLoadBalancersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DescribeLoadBalancersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLoadBalancersOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::DescribeLoadBalancersAsync(DescribeLoadBalancersRequest&& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DescribeLoadBalancersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLoadBalancersOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::DescribeLoadBalancersAsyncHelper(const DescribeLoadBalancersRequest& request, const DescribeLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -675,12 +855,22 @@ DescribeTagsOutcome ElasticLoadBalancingClient::DescribeTags(const DescribeTagsR
 
 DescribeTagsOutcomeCallable ElasticLoadBalancingClient::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::DescribeTags, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DescribeTags, Aws::Client::RejectedCallOutcome<DescribeTagsOutcome>(), this, request);
+}
+
+DescribeTagsOutcomeCallable ElasticLoadBalancingClient::DescribeTagsCallable(DescribeTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DescribeTags, Aws::Client::RejectedCallOutcome<DescribeTagsOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::DescribeTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DescribeTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTagsOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::DescribeTagsAsync(DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DescribeTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -705,12 +895,22 @@ DetachLoadBalancerFromSubnetsOutcome ElasticLoadBalancingClient::DetachLoadBalan
 
 DetachLoadBalancerFromSubnetsOutcomeCallable ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsCallable(const DetachLoadBalancerFromSubnetsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::DetachLoadBalancerFromSubnets, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DetachLoadBalancerFromSubnets, Aws::Client::RejectedCallOutcome<DetachLoadBalancerFromSubnetsOutcome>(), this, request);
+}
+
+DetachLoadBalancerFromSubnetsOutcomeCallable ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsCallable(DetachLoadBalancerFromSubnetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DetachLoadBalancerFromSubnets, Aws::Client::RejectedCallOutcome<DetachLoadBalancerFromSubnetsOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsAsync(const DetachLoadBalancerFromSubnetsRequest& request, const DetachLoadBalancerFromSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsAsyncHelper, Aws::Client::RejectedAsyncCall<DetachLoadBalancerFromSubnetsOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsAsync(DetachLoadBalancerFromSubnetsRequest&& request, const DetachLoadBalancerFromSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsAsyncHelper, Aws::Client::RejectedAsyncCall<DetachLoadBalancerFromSubnetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::DetachLoadBalancerFromSubnetsAsyncHelper(const DetachLoadBalancerFromSubnetsRequest& request, const DetachLoadBalancerFromSubnetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -735,12 +935,22 @@ DisableAvailabilityZonesForLoadBalancerOutcome ElasticLoadBalancingClient::Disab
 
 DisableAvailabilityZonesForLoadBalancerOutcomeCallable ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerCallable(const DisableAvailabilityZonesForLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancer, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancer, Aws::Client::RejectedCallOutcome<DisableAvailabilityZonesForLoadBalancerOutcome>(), this, request);
+}
+
+DisableAvailabilityZonesForLoadBalancerOutcomeCallable ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerCallable(DisableAvailabilityZonesForLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancer, Aws::Client::RejectedCallOutcome<DisableAvailabilityZonesForLoadBalancerOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerAsync(const DisableAvailabilityZonesForLoadBalancerRequest& request, const DisableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<DisableAvailabilityZonesForLoadBalancerOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerAsync(DisableAvailabilityZonesForLoadBalancerRequest&& request, const DisableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<DisableAvailabilityZonesForLoadBalancerOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::DisableAvailabilityZonesForLoadBalancerAsyncHelper(const DisableAvailabilityZonesForLoadBalancerRequest& request, const DisableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -765,12 +975,22 @@ EnableAvailabilityZonesForLoadBalancerOutcome ElasticLoadBalancingClient::Enable
 
 EnableAvailabilityZonesForLoadBalancerOutcomeCallable ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerCallable(const EnableAvailabilityZonesForLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancer, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancer, Aws::Client::RejectedCallOutcome<EnableAvailabilityZonesForLoadBalancerOutcome>(), this, request);
+}
+
+EnableAvailabilityZonesForLoadBalancerOutcomeCallable ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerCallable(EnableAvailabilityZonesForLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancer, Aws::Client::RejectedCallOutcome<EnableAvailabilityZonesForLoadBalancerOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerAsync(const EnableAvailabilityZonesForLoadBalancerRequest& request, const EnableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<EnableAvailabilityZonesForLoadBalancerOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerAsync(EnableAvailabilityZonesForLoadBalancerRequest&& request, const EnableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<EnableAvailabilityZonesForLoadBalancerOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::EnableAvailabilityZonesForLoadBalancerAsyncHelper(const EnableAvailabilityZonesForLoadBalancerRequest& request, const EnableAvailabilityZonesForLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -795,12 +1015,22 @@ ModifyLoadBalancerAttributesOutcome ElasticLoadBalancingClient::ModifyLoadBalanc
 
 ModifyLoadBalancerAttributesOutcomeCallable ElasticLoadBalancingClient::ModifyLoadBalancerAttributesCallable(const ModifyLoadBalancerAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::ModifyLoadBalancerAttributes, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::ModifyLoadBalancerAttributes, Aws::Client::RejectedCallOutcome<ModifyLoadBalancerAttributesOutcome>(), this, request);
+}
+
+ModifyLoadBalancerAttributesOutcomeCallable ElasticLoadBalancingClient::ModifyLoadBalancerAttributesCallable(ModifyLoadBalancerAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::ModifyLoadBalancerAttributes, Aws::Client::RejectedCallOutcome<ModifyLoadBalancerAttributesOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::ModifyLoadBalancerAttributesAsync(const ModifyLoadBalancerAttributesRequest& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::ModifyLoadBalancerAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::ModifyLoadBalancerAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyLoadBalancerAttributesOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::ModifyLoadBalancerAttributesAsync(ModifyLoadBalancerAttributesRequest&& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::ModifyLoadBalancerAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyLoadBalancerAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::ModifyLoadBalancerAttributesAsyncHelper(const ModifyLoadBalancerAttributesRequest& request, const ModifyLoadBalancerAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -825,12 +1055,22 @@ RegisterInstancesWithLoadBalancerOutcome ElasticLoadBalancingClient::RegisterIns
 
 RegisterInstancesWithLoadBalancerOutcomeCallable ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerCallable(const RegisterInstancesWithLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancer, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancer, Aws::Client::RejectedCallOutcome<RegisterInstancesWithLoadBalancerOutcome>(), this, request);
+}
+
+RegisterInstancesWithLoadBalancerOutcomeCallable ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerCallable(RegisterInstancesWithLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancer, Aws::Client::RejectedCallOutcome<RegisterInstancesWithLoadBalancerOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerAsync(const RegisterInstancesWithLoadBalancerRequest& request, const RegisterInstancesWithLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterInstancesWithLoadBalancerOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerAsync(RegisterInstancesWithLoadBalancerRequest&& request, const RegisterInstancesWithLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterInstancesWithLoadBalancerOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::RegisterInstancesWithLoadBalancerAsyncHelper(const RegisterInstancesWithLoadBalancerRequest& request, const RegisterInstancesWithLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -855,12 +1095,22 @@ RemoveTagsOutcome ElasticLoadBalancingClient::RemoveTags(const RemoveTagsRequest
 
 RemoveTagsOutcomeCallable ElasticLoadBalancingClient::RemoveTagsCallable(const RemoveTagsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::RemoveTags, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::RemoveTags, Aws::Client::RejectedCallOutcome<RemoveTagsOutcome>(), this, request);
+}
+
+RemoveTagsOutcomeCallable ElasticLoadBalancingClient::RemoveTagsCallable(RemoveTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::RemoveTags, Aws::Client::RejectedCallOutcome<RemoveTagsOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::RemoveTagsAsync(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::RemoveTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::RemoveTagsAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::RemoveTagsAsync(RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::RemoveTagsAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::RemoveTagsAsyncHelper(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -885,12 +1135,22 @@ SetLoadBalancerListenerSSLCertificateOutcome ElasticLoadBalancingClient::SetLoad
 
 SetLoadBalancerListenerSSLCertificateOutcomeCallable ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateCallable(const SetLoadBalancerListenerSSLCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificate, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificate, Aws::Client::RejectedCallOutcome<SetLoadBalancerListenerSSLCertificateOutcome>(), this, request);
+}
+
+SetLoadBalancerListenerSSLCertificateOutcomeCallable ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateCallable(SetLoadBalancerListenerSSLCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificate, Aws::Client::RejectedCallOutcome<SetLoadBalancerListenerSSLCertificateOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateAsync(const SetLoadBalancerListenerSSLCertificateRequest& request, const SetLoadBalancerListenerSSLCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<SetLoadBalancerListenerSSLCertificateOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateAsync(SetLoadBalancerListenerSSLCertificateRequest&& request, const SetLoadBalancerListenerSSLCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<SetLoadBalancerListenerSSLCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::SetLoadBalancerListenerSSLCertificateAsyncHelper(const SetLoadBalancerListenerSSLCertificateRequest& request, const SetLoadBalancerListenerSSLCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -915,12 +1175,22 @@ SetLoadBalancerPoliciesForBackendServerOutcome ElasticLoadBalancingClient::SetLo
 
 SetLoadBalancerPoliciesForBackendServerOutcomeCallable ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerCallable(const SetLoadBalancerPoliciesForBackendServerRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServer, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServer, Aws::Client::RejectedCallOutcome<SetLoadBalancerPoliciesForBackendServerOutcome>(), this, request);
+}
+
+SetLoadBalancerPoliciesForBackendServerOutcomeCallable ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerCallable(SetLoadBalancerPoliciesForBackendServerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServer, Aws::Client::RejectedCallOutcome<SetLoadBalancerPoliciesForBackendServerOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerAsync(const SetLoadBalancerPoliciesForBackendServerRequest& request, const SetLoadBalancerPoliciesForBackendServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerAsyncHelper, Aws::Client::RejectedAsyncCall<SetLoadBalancerPoliciesForBackendServerOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerAsync(SetLoadBalancerPoliciesForBackendServerRequest&& request, const SetLoadBalancerPoliciesForBackendServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerAsyncHelper, Aws::Client::RejectedAsyncCall<SetLoadBalancerPoliciesForBackendServerOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::SetLoadBalancerPoliciesForBackendServerAsyncHelper(const SetLoadBalancerPoliciesForBackendServerRequest& request, const SetLoadBalancerPoliciesForBackendServerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -945,12 +1215,22 @@ SetLoadBalancerPoliciesOfListenerOutcome ElasticLoadBalancingClient::SetLoadBala
 
 SetLoadBalancerPoliciesOfListenerOutcomeCallable ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerCallable(const SetLoadBalancerPoliciesOfListenerRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListener, this, request);
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListener, Aws::Client::RejectedCallOutcome<SetLoadBalancerPoliciesOfListenerOutcome>(), this, request);
+}
+
+SetLoadBalancerPoliciesOfListenerOutcomeCallable ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerCallable(SetLoadBalancerPoliciesOfListenerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListener, Aws::Client::RejectedCallOutcome<SetLoadBalancerPoliciesOfListenerOutcome>(), this, std::move(request));
 }
 
 void ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerAsync(const SetLoadBalancerPoliciesOfListenerRequest& request, const SetLoadBalancerPoliciesOfListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerAsyncHelper, Aws::Client::RejectedAsyncCall<SetLoadBalancerPoliciesOfListenerOutcome>(), this, request, handler, context);
+}
+
+void ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerAsync(SetLoadBalancerPoliciesOfListenerRequest&& request, const SetLoadBalancerPoliciesOfListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerAsyncHelper, Aws::Client::RejectedAsyncCall<SetLoadBalancerPoliciesOfListenerOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticLoadBalancingClient::SetLoadBalancerPoliciesOfListenerAsyncHelper(const SetLoadBalancerPoliciesOfListenerRequest& request, const SetLoadBalancerPoliciesOfListenerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -35,6 +35,26 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/elasticmapreduce/model/AddInstanceGroupsRequest.h>
+#include <aws/elasticmapreduce/model/AddJobFlowStepsRequest.h>
+#include <aws/elasticmapreduce/model/AddTagsRequest.h>
+#include <aws/elasticmapreduce/model/DescribeClusterRequest.h>
+#include <aws/elasticmapreduce/model/DescribeStepRequest.h>
+#include <aws/elasticmapreduce/model/ListBootstrapActionsRequest.h>
+#include <aws/elasticmapreduce/model/ListClustersRequest.h>
+#include <aws/elasticmapreduce/model/ListInstanceGroupsRequest.h>
+#include <aws/elasticmapreduce/model/ListInstancesRequest.h>
+#include <aws/elasticmapreduce/model/ListStepsRequest.h>
+#include <aws/elasticmapreduce/model/ModifyInstanceGroupsRequest.h>
+#include <aws/elasticmapreduce/model/RemoveTagsRequest.h>
+#include <aws/elasticmapreduce/model/RunJobFlowRequest.h>
+#include <aws/elasticmapreduce/model/SetTerminationProtectionRequest.h>
+#include <aws/elasticmapreduce/model/SetVisibleToAllUsersRequest.h>
+#include <aws/elasticmapreduce/model/TerminateJobFlowsRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -195,6 +215,11 @@ namespace Model
          */
         virtual Model::AddInstanceGroupsOutcomeCallable AddInstanceGroupsCallable(const Model::AddInstanceGroupsRequest& request) const;
 
+        /**
+         * Same as AddInstanceGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddInstanceGroupsOutcomeCallable AddInstanceGroupsCallable(Model::AddInstanceGroupsRequest&& request) const;
+
         /**
          * <p>AddInstanceGroups adds an instance group to a running cluster.</p>
          *
@@ -202,6 +227,11 @@ namespace Model
          */
         virtual void AddInstanceGroupsAsync(const Model::AddInstanceGroupsRequest& request, const AddInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddInstanceGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddInstanceGroupsAsync(Model::AddInstanceGroupsRequest&& request, const AddInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> AddJobFlowSteps adds new steps to a running job flow. A maximum of 256 steps
          * are allowed in each job flow. </p> <p>If your job flow is long-running (such as
@@ -250,6 +280,11 @@ namespace Model
          */
         virtual Model::AddJobFlowStepsOutcomeCallable AddJobFlowStepsCallable(const Model::AddJobFlowStepsRequest& request) const;
 
+        /**
+         * Same as AddJobFlowStepsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddJobFlowStepsOutcomeCallable AddJobFlowStepsCallable(Model::AddJobFlowStepsRequest&& request) const;
+
         /**
          * <p> AddJobFlowSteps adds new steps to a running job flow. A maximum of 256 steps
          * are allowed in each job flow. </p> <p>If your job flow is long-running (such as
@@ -275,6 +310,11 @@ namespace Model
          */
         virtual void AddJobFlowStepsAsync(const Model::AddJobFlowStepsRequest& request, const AddJobFlowStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddJobFlowStepsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddJobFlowStepsAsync(Model::AddJobFlowStepsRequest&& request, const AddJobFlowStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds tags to an Amazon EMR resource. Tags make it easier to associate
          * clusters in various ways, such as grouping clusters to track your Amazon EMR
@@ -295,6 +335,11 @@ namespace Model
          */
         virtual Model::AddTagsOutcomeCallable AddTagsCallable(const Model::AddTagsRequest& request) const;
 
+        /**
+         * Same as AddTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddTagsOutcomeCallable AddTagsCallable(Model::AddTagsRequest&& request) const;
+
         /**
          * <p>Adds tags to an Amazon EMR resource. Tags make it easier to associate
          * clusters in various ways, such as grouping clusters to track your Amazon EMR
@@ -306,6 +351,11 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddTagsAsync(Model::AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides cluster-level details including status, hardware and software
          * configuration, VPC settings, and so on. For information about the cluster steps,
@@ -322,6 +372,11 @@ namespace Model
          */
         virtual Model::DescribeClusterOutcomeCallable DescribeClusterCallable(const Model::DescribeClusterRequest& request) const;
 
+        /**
+         * Same as DescribeClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeClusterOutcomeCallable DescribeClusterCallable(Model::DescribeClusterRequest&& request) const;
+
         /**
          * <p>Provides cluster-level details including status, hardware and software
          * configuration, VPC settings, and so on. For information about the cluster steps,
@@ -331,6 +386,11 @@ namespace Model
          */
         virtual void DescribeClusterAsync(const Model::DescribeClusterRequest& request, const DescribeClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeClusterAsync(Model::DescribeClusterRequest&& request, const DescribeClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides more detail about the cluster step.</p>
          */
@@ -343,6 +403,11 @@ namespace Model
          */
         virtual Model::DescribeStepOutcomeCallable DescribeStepCallable(const Model::DescribeStepRequest& request) const;
 
+        /**
+         * Same as DescribeStepCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeStepOutcomeCallable DescribeStepCallable(Model::DescribeStepRequest&& request) const;
+
         /**
          * <p>Provides more detail about the cluster step.</p>
          *
@@ -350,6 +415,11 @@ namespace Model
          */
         virtual void DescribeStepAsync(const Model::DescribeStepRequest& request, const DescribeStepResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStepAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeStepAsync(Model::DescribeStepRequest&& request, const DescribeStepResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides information about the bootstrap actions associated with a
          * cluster.</p>
@@ -364,6 +434,11 @@ namespace Model
          */
         virtual Model::ListBootstrapActionsOutcomeCallable ListBootstrapActionsCallable(const Model::ListBootstrapActionsRequest& request) const;
 
+        /**
+         * Same as ListBootstrapActionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListBootstrapActionsOutcomeCallable ListBootstrapActionsCallable(Model::ListBootstrapActionsRequest&& request) const;
+
         /**
          * <p>Provides information about the bootstrap actions associated with a
          * cluster.</p>
@@ -372,6 +447,11 @@ namespace Model
          */
         virtual void ListBootstrapActionsAsync(const Model::ListBootstrapActionsRequest& request, const ListBootstrapActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListBootstrapActionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListBootstrapActionsAsync(Model::ListBootstrapActionsRequest&& request, const ListBootstrapActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides the status of all clusters visible to this AWS account. Allows you
          * to filter the list of clusters based on certain criteria; for example, filtering
@@ -392,6 +472,11 @@ namespace Model
          */
         virtual Model::ListClustersOutcomeCallable ListClustersCallable(const Model::ListClustersRequest& request) const;
 
+        /**
+         * Same as ListClustersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListClustersOutcomeCallable ListClustersCallable(Model::ListClustersRequest&& request) const;
+
         /**
          * <p>Provides the status of all clusters visible to this AWS account. Allows you
          * to filter the list of clusters based on certain criteria; for example, filtering
@@ -403,6 +488,11 @@ namespace Model
          */
         virtual void ListClustersAsync(const Model::ListClustersRequest& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListClustersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListClustersAsync(Model::ListClustersRequest&& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides all available details about the instance groups in a cluster.</p>
          */
@@ -415,6 +505,11 @@ namespace Model
          */
         virtual Model::ListInstanceGroupsOutcomeCallable ListInstanceGroupsCallable(const Model::ListInstanceGroupsRequest& request) const;
 
+        /**
+         * Same as ListInstanceGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListInstanceGroupsOutcomeCallable ListInstanceGroupsCallable(Model::ListInstanceGroupsRequest&& request) const;
+
         /**
          * <p>Provides all available details about the instance groups in a cluster.</p>
          *
@@ -422,6 +517,11 @@ namespace Model
          */
         virtual void ListInstanceGroupsAsync(const Model::ListInstanceGroupsRequest& request, const ListInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListInstanceGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListInstanceGroupsAsync(Model::ListInstanceGroupsRequest&& request, const ListInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides information about the cluster instances that Amazon EMR provisions
          * on behalf of a user when it creates the cluster. For example, this operation
@@ -442,6 +542,11 @@ namespace Model
          */
         virtual Model::ListInstancesOutcomeCallable ListInstancesCallable(const Model::ListInstancesRequest& request) const;
 
+        /**
+         * Same as ListInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListInstancesOutcomeCallable ListInstancesCallable(Model::ListInstancesRequest&& request) const;
+
         /**
          * <p>Provides information about the cluster instances that Amazon EMR provisions
          * on behalf of a user when it creates the cluster. For example, this operation
@@ -453,6 +558,11 @@ namespace Model
          */
         virtual void ListInstancesAsync(const Model::ListInstancesRequest& request, const ListInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListInstancesAsync(Model::ListInstancesRequest&& request, const ListInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides a list of steps for the cluster. </p>
          */
@@ -465,6 +575,11 @@ namespace Model
          */
         virtual Model::ListStepsOutcomeCallable ListStepsCallable(const Model::ListStepsRequest& request) const;
 
+        /**
+         * Same as ListStepsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListStepsOutcomeCallable ListStepsCallable(Model::ListStepsRequest&& request) const;
+
         /**
          * <p>Provides a list of steps for the cluster. </p>
          *
@@ -472,6 +587,11 @@ namespace Model
          */
         virtual void ListStepsAsync(const Model::ListStepsRequest& request, const ListStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListStepsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListStepsAsync(Model::ListStepsRequest&& request, const ListStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>ModifyInstanceGroups modifies the number of nodes and configuration settings
          * of an instance group. The input parameters include the new target instance count
@@ -490,6 +610,11 @@ namespace Model
          */
         virtual Model::ModifyInstanceGroupsOutcomeCallable ModifyInstanceGroupsCallable(const Model::ModifyInstanceGroupsRequest& request) const;
 
+        /**
+         * Same as ModifyInstanceGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyInstanceGroupsOutcomeCallable ModifyInstanceGroupsCallable(Model::ModifyInstanceGroupsRequest&& request) const;
+
         /**
          * <p>ModifyInstanceGroups modifies the number of nodes and configuration settings
          * of an instance group. The input parameters include the new target instance count
@@ -500,6 +625,11 @@ namespace Model
          */
         virtual void ModifyInstanceGroupsAsync(const Model::ModifyInstanceGroupsRequest& request, const ModifyInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyInstanceGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyInstanceGroupsAsync(Model::ModifyInstanceGroupsRequest&& request, const ModifyInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes tags from an Amazon EMR resource. Tags make it easier to associate
          * clusters in various ways, such as grouping clusters to track your Amazon EMR
@@ -522,6 +652,11 @@ namespace Model
          */
         virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(const Model::RemoveTagsRequest& request) const;
 
+        /**
+         * Same as RemoveTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(Model::RemoveTagsRequest&& request) const;
+
         /**
          * <p>Removes tags from an Amazon EMR resource. Tags make it easier to associate
          * clusters in various ways, such as grouping clusters to track your Amazon EMR
@@ -534,6 +669,11 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveTagsAsync(Model::RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> RunJobFlow creates and starts running a new job flow. The job flow will run
          * the steps specified. Once the job flow completes, the cluster is stopped and the
@@ -584,6 +724,11 @@ namespace Model
          */
         virtual Model::RunJobFlowOutcomeCallable RunJobFlowCallable(const Model::RunJobFlowRequest& request) const;
 
+        /**
+         * Same as RunJobFlowCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RunJobFlowOutcomeCallable RunJobFlowCallable(Model::RunJobFlowRequest&& request) const;
+
         /**
          * <p> RunJobFlow creates and starts running a new job flow. The job flow will run
          * the steps specified. Once the job flow completes, the cluster is stopped and the
@@ -610,6 +755,11 @@ namespace Model
          */
         virtual void RunJobFlowAsync(const Model::RunJobFlowRequest& request, const RunJobFlowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RunJobFlowAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RunJobFlowAsync(Model::RunJobFlowRequest&& request, const RunJobFlowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> SetTerminationProtection locks a job flow so the Amazon EC2 instances in the
          * cluster cannot be terminated by user intervention, an API call, or in the event
@@ -650,6 +800,11 @@ namespace Model
          */
         virtual Model::SetTerminationProtectionOutcomeCallable SetTerminationProtectionCallable(const Model::SetTerminationProtectionRequest& request) const;
 
+        /**
+         * Same as SetTerminationProtectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetTerminationProtectionOutcomeCallable SetTerminationProtectionCallable(Model::SetTerminationProtectionRequest&& request) const;
+
         /**
          * <p> SetTerminationProtection locks a job flow so the Amazon EC2 instances in the
          * cluster cannot be terminated by user intervention, an API call, or in the event
@@ -671,6 +826,11 @@ namespace Model
          */
         virtual void SetTerminationProtectionAsync(const Model::SetTerminationProtectionRequest& request, const SetTerminationProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetTerminationProtectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetTerminationProtectionAsync(Model::SetTerminationProtectionRequest&& request, const SetTerminationProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets whether all AWS Identity and Access Management (IAM) users under your
          * account can access the specified job flows. This action works on running job
@@ -693,6 +853,11 @@ namespace Model
          */
         virtual Model::SetVisibleToAllUsersOutcomeCallable SetVisibleToAllUsersCallable(const Model::SetVisibleToAllUsersRequest& request) const;
 
+        /**
+         * Same as SetVisibleToAllUsersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetVisibleToAllUsersOutcomeCallable SetVisibleToAllUsersCallable(Model::SetVisibleToAllUsersRequest&& request) const;
+
         /**
          * <p>Sets whether all AWS Identity and Access Management (IAM) users under your
          * account can access the specified job flows. This action works on running job
@@ -705,6 +870,11 @@ namespace Model
          */
         virtual void SetVisibleToAllUsersAsync(const Model::SetVisibleToAllUsersRequest& request, const SetVisibleToAllUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetVisibleToAllUsersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetVisibleToAllUsersAsync(Model::SetVisibleToAllUsersRequest&& request, const SetVisibleToAllUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> TerminateJobFlows shuts a list of job flows down. When a job flow is shut
          * down, any step not yet completed is canceled and the EC2 instances on which the
@@ -731,6 +901,11 @@ namespace Model
          */
         virtual Model::TerminateJobFlowsOutcomeCallable TerminateJobFlowsCallable(const Model::TerminateJobFlowsRequest& request) const;
 
+        /**
+         * Same as TerminateJobFlowsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::TerminateJobFlowsOutcomeCallable TerminateJobFlowsCallable(Model::TerminateJobFlowsRequest&& request) const;
+
         /**
          * <p> TerminateJobFlows shuts a list of job flows down. When a job flow is shut
          * down, any step not yet completed is canceled and the EC2 instances on which the
@@ -745,6 +920,50 @@ namespace Model
          */
         virtual void TerminateJobFlowsAsync(const Model::TerminateJobFlowsRequest& request, const TerminateJobFlowsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TerminateJobFlowsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void TerminateJobFlowsAsync(Model::TerminateJobFlowsRequest&& request, const TerminateJobFlowsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AddInstanceGroupsOutcome> AddInstanceGroupsAwaitable(const Model::AddInstanceGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::AddInstanceGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddInstanceGroupsOutcome> AddInstanceGroupsAwaitable(Model::AddInstanceGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::AddInstanceGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddJobFlowStepsOutcome> AddJobFlowStepsAwaitable(const Model::AddJobFlowStepsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::AddJobFlowSteps, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddJobFlowStepsOutcome> AddJobFlowStepsAwaitable(Model::AddJobFlowStepsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::AddJobFlowSteps, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsOutcome> AddTagsAwaitable(const Model::AddTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::AddTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsOutcome> AddTagsAwaitable(Model::AddTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::AddTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClusterOutcome> DescribeClusterAwaitable(const Model::DescribeClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::DescribeCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClusterOutcome> DescribeClusterAwaitable(Model::DescribeClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::DescribeCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStepOutcome> DescribeStepAwaitable(const Model::DescribeStepRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::DescribeStep, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStepOutcome> DescribeStepAwaitable(Model::DescribeStepRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::DescribeStep, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListBootstrapActionsOutcome> ListBootstrapActionsAwaitable(const Model::ListBootstrapActionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::ListBootstrapActions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListBootstrapActionsOutcome> ListBootstrapActionsAwaitable(Model::ListBootstrapActionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::ListBootstrapActions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListClustersOutcome> ListClustersAwaitable(const Model::ListClustersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::ListClusters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListClustersOutcome> ListClustersAwaitable(Model::ListClustersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::ListClusters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListInstanceGroupsOutcome> ListInstanceGroupsAwaitable(const Model::ListInstanceGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::ListInstanceGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListInstanceGroupsOutcome> ListInstanceGroupsAwaitable(Model::ListInstanceGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::ListInstanceGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListInstancesOutcome> ListInstancesAwaitable(const Model::ListInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::ListInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListInstancesOutcome> ListInstancesAwaitable(Model::ListInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::ListInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListStepsOutcome> ListStepsAwaitable(const Model::ListStepsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::ListSteps, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListStepsOutcome> ListStepsAwaitable(Model::ListStepsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::ListSteps, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyInstanceGroupsOutcome> ModifyInstanceGroupsAwaitable(const Model::ModifyInstanceGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::ModifyInstanceGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyInstanceGroupsOutcome> ModifyInstanceGroupsAwaitable(Model::ModifyInstanceGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::ModifyInstanceGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(const Model::RemoveTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::RemoveTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(Model::RemoveTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::RemoveTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RunJobFlowOutcome> RunJobFlowAwaitable(const Model::RunJobFlowRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::RunJobFlow, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RunJobFlowOutcome> RunJobFlowAwaitable(Model::RunJobFlowRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::RunJobFlow, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetTerminationProtectionOutcome> SetTerminationProtectionAwaitable(const Model::SetTerminationProtectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::SetTerminationProtection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetTerminationProtectionOutcome> SetTerminationProtectionAwaitable(Model::SetTerminationProtectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::SetTerminationProtection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetVisibleToAllUsersOutcome> SetVisibleToAllUsersAwaitable(const Model::SetVisibleToAllUsersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::SetVisibleToAllUsers, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetVisibleToAllUsersOutcome> SetVisibleToAllUsersAwaitable(Model::SetVisibleToAllUsersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::SetVisibleToAllUsers, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TerminateJobFlowsOutcome> TerminateJobFlowsAwaitable(const Model::TerminateJobFlowsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::TerminateJobFlows, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TerminateJobFlowsOutcome> TerminateJobFlowsAwaitable(Model::TerminateJobFlowsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &EMRClient::TerminateJobFlows, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
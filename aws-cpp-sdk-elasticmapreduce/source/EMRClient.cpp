@@ -123,12 +123,22 @@ AddInstanceGroupsOutcome EMRClient::AddInstanceGroups(const AddInstanceGroupsReq
 
 AddInstanceGroupsOutcomeCallable EMRClient::AddInstanceGroupsCallable(const AddInstanceGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::AddInstanceGroups, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::AddInstanceGroups, Aws::Client::RejectedCallOutcome<AddInstanceGroupsOutcome>(), this, request);
+}
+
+AddInstanceGroupsOutcomeCallable EMRClient::AddInstanceGroupsCallable(AddInstanceGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::AddInstanceGroups, Aws::Client::RejectedCallOutcome<AddInstanceGroupsOutcome>(), this, std::move(request));
 }
 
 void EMRClient::AddInstanceGroupsAsync(const AddInstanceGroupsRequest& request, const AddInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::AddInstanceGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::AddInstanceGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<AddInstanceGroupsOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::AddInstanceGroupsAsync(AddInstanceGroupsRequest&& request, const AddInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::AddInstanceGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<AddInstanceGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::AddInstanceGroupsAsyncHelper(const AddInstanceGroupsRequest& request, const AddInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -154,12 +164,22 @@ AddJobFlowStepsOutcome EMRClient::AddJobFlowSteps(const AddJobFlowStepsRequest&
 
 AddJobFlowStepsOutcomeCallable EMRClient::AddJobFlowStepsCallable(const AddJobFlowStepsRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::AddJobFlowSteps, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::AddJobFlowSteps, Aws::Client::RejectedCallOutcome<AddJobFlowStepsOutcome>(), this, request);
+}
+
+AddJobFlowStepsOutcomeCallable EMRClient::AddJobFlowStepsCallable(AddJobFlowStepsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::AddJobFlowSteps, Aws::Client::RejectedCallOutcome<AddJobFlowStepsOutcome>(), this, std::move(request));
 }
 
 void EMRClient::AddJobFlowStepsAsync(const AddJobFlowStepsRequest& request, const AddJobFlowStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::AddJobFlowStepsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::AddJobFlowStepsAsyncHelper, Aws::Client::RejectedAsyncCall<AddJobFlowStepsOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::AddJobFlowStepsAsync(AddJobFlowStepsRequest&& request, const AddJobFlowStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::AddJobFlowStepsAsyncHelper, Aws::Client::RejectedAsyncCall<AddJobFlowStepsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::AddJobFlowStepsAsyncHelper(const AddJobFlowStepsRequest& request, const AddJobFlowStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -185,12 +205,22 @@ AddTagsOutcome EMRClient::AddTags(const AddTagsRequest& request) const
 
 AddTagsOutcomeCallable EMRClient::AddTagsCallable(const AddTagsRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::AddTags, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::AddTags, Aws::Client::RejectedCallOutcome<AddTagsOutcome>(), this, request);
+}
+
+AddTagsOutcomeCallable EMRClient::AddTagsCallable(AddTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::AddTags, Aws::Client::RejectedCallOutcome<AddTagsOutcome>(), this, std::move(request));
 }
 
 void EMRClient::AddTagsAsync(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::AddTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::AddTagsAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::AddTagsAsync(AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::AddTagsAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::AddTagsAsyncHelper(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -216,12 +246,22 @@ DescribeClusterOutcome EMRClient::DescribeCluster(const DescribeClusterRequest&
 
 DescribeClusterOutcomeCallable EMRClient::DescribeClusterCallable(const DescribeClusterRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::DescribeCluster, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::DescribeCluster, Aws::Client::RejectedCallOutcome<DescribeClusterOutcome>(), this, request);
+}
+
+DescribeClusterOutcomeCallable EMRClient::DescribeClusterCallable(DescribeClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::DescribeCluster, Aws::Client::RejectedCallOutcome<DescribeClusterOutcome>(), this, std::move(request));
 }
 
 void EMRClient::DescribeClusterAsync(const DescribeClusterRequest& request, const DescribeClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::DescribeClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::DescribeClusterAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClusterOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::DescribeClusterAsync(DescribeClusterRequest&& request, const DescribeClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::DescribeClusterAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::DescribeClusterAsyncHelper(const DescribeClusterRequest& request, const DescribeClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -247,12 +287,22 @@ DescribeStepOutcome EMRClient::DescribeStep(const DescribeStepRequest& request)
 
 DescribeStepOutcomeCallable EMRClient::DescribeStepCallable(const DescribeStepRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::DescribeStep, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::DescribeStep, Aws::Client::RejectedCallOutcome<DescribeStepOutcome>(), this, request);
+}
+
+DescribeStepOutcomeCallable EMRClient::DescribeStepCallable(DescribeStepRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::DescribeStep, Aws::Client::RejectedCallOutcome<DescribeStepOutcome>(), this, std::move(request));
 }
 
 void EMRClient::DescribeStepAsync(const DescribeStepRequest& request, const DescribeStepResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::DescribeStepAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::DescribeStepAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStepOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::DescribeStepAsync(DescribeStepRequest&& request, const DescribeStepResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::DescribeStepAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStepOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::DescribeStepAsyncHelper(const DescribeStepRequest& request, const DescribeStepResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -278,12 +328,22 @@ ListBootstrapActionsOutcome EMRClient::ListBootstrapActions(const ListBootstrapA
 
 ListBootstrapActionsOutcomeCallable EMRClient::ListBootstrapActionsCallable(const ListBootstrapActionsRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::ListBootstrapActions, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::ListBootstrapActions, Aws::Client::RejectedCallOutcome<ListBootstrapActionsOutcome>(), this, request);
+}
+
+ListBootstrapActionsOutcomeCallable EMRClient::ListBootstrapActionsCallable(ListBootstrapActionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::ListBootstrapActions, Aws::Client::RejectedCallOutcome<ListBootstrapActionsOutcome>(), this, std::move(request));
 }
 
 void EMRClient::ListBootstrapActionsAsync(const ListBootstrapActionsRequest& request, const ListBootstrapActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::ListBootstrapActionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::ListBootstrapActionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListBootstrapActionsOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::ListBootstrapActionsAsync(ListBootstrapActionsRequest&& request, const ListBootstrapActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::ListBootstrapActionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListBootstrapActionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::ListBootstrapActionsAsyncHelper(const ListBootstrapActionsRequest& request, const ListBootstrapActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -309,12 +369,22 @@ ListClustersOutcome EMRClient::ListClusters(const ListClustersRequest& request)
 
 ListClustersOutcomeCallable EMRClient::ListClustersCallable(const ListClustersRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::ListClusters, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::ListClusters, Aws::Client::RejectedCallOutcome<ListClustersOutcome>(), this, request);
+}
+
+ListClustersOutcomeCallable EMRClient::ListClustersCallable(ListClustersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::ListClusters, Aws::Client::RejectedCallOutcome<ListClustersOutcome>(), this, std::move(request));
 }
 
 void EMRClient::ListClustersAsync(const ListClustersRequest& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::ListClustersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::ListClustersAsyncHelper, Aws::Client::RejectedAsyncCall<ListClustersOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::ListClustersAsync(ListClustersRequest&& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::ListClustersAsyncHelper, Aws::Client::RejectedAsyncCall<ListClustersOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::ListClustersAsyncHelper(const ListClustersRequest& request, const ListClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -340,12 +410,22 @@ ListInstanceGroupsOutcome EMRClient::ListInstanceGroups(const ListInstanceGroups
 
 ListInstanceGroupsOutcomeCallable EMRClient::ListInstanceGroupsCallable(const ListInstanceGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::ListInstanceGroups, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::ListInstanceGroups, Aws::Client::RejectedCallOutcome<ListInstanceGroupsOutcome>(), this, request);
+}
+
+ListInstanceGroupsOutcomeCallable EMRClient::ListInstanceGroupsCallable(ListInstanceGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::ListInstanceGroups, Aws::Client::RejectedCallOutcome<ListInstanceGroupsOutcome>(), this, std::move(request));
 }
 
 void EMRClient::ListInstanceGroupsAsync(const ListInstanceGroupsRequest& request, const ListInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::ListInstanceGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::ListInstanceGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<ListInstanceGroupsOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::ListInstanceGroupsAsync(ListInstanceGroupsRequest&& request, const ListInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::ListInstanceGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<ListInstanceGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::ListInstanceGroupsAsyncHelper(const ListInstanceGroupsRequest& request, const ListInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -371,12 +451,22 @@ ListInstancesOutcome EMRClient::ListInstances(const ListInstancesRequest& reques
 
 ListInstancesOutcomeCallable EMRClient::ListInstancesCallable(const ListInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::ListInstances, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::ListInstances, Aws::Client::RejectedCallOutcome<ListInstancesOutcome>(), this, request);
+}
+
+ListInstancesOutcomeCallable EMRClient::ListInstancesCallable(ListInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::ListInstances, Aws::Client::RejectedCallOutcome<ListInstancesOutcome>(), this, std::move(request));
 }
 
 void EMRClient::ListInstancesAsync(const ListInstancesRequest& request, const ListInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::ListInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::ListInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<ListInstancesOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::ListInstancesAsync(ListInstancesRequest&& request, const ListInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::ListInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<ListInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::ListInstancesAsyncHelper(const ListInstancesRequest& request, const ListInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -402,12 +492,22 @@ ListStepsOutcome EMRClient::ListSteps(const ListStepsRequest& request) const
 
 ListStepsOutcomeCallable EMRClient::ListStepsCallable(const ListStepsRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::ListSteps, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::ListSteps, Aws::Client::RejectedCallOutcome<ListStepsOutcome>(), this, request);
+}
+
+ListStepsOutcomeCallable EMRClient::ListStepsCallable(ListStepsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::ListSteps, Aws::Client::RejectedCallOutcome<ListStepsOutcome>(), this, std::move(request));
 }
 
 void EMRClient::ListStepsAsync(const ListStepsRequest& request, const ListStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::ListStepsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::ListStepsAsyncHelper, Aws::Client::RejectedAsyncCall<ListStepsOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::ListStepsAsync(ListStepsRequest&& request, const ListStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::ListStepsAsyncHelper, Aws::Client::RejectedAsyncCall<ListStepsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::ListStepsAsyncHelper(const ListStepsRequest& request, const ListStepsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -433,12 +533,22 @@ ModifyInstanceGroupsOutcome EMRClient::ModifyInstanceGroups(const ModifyInstance
 
 ModifyInstanceGroupsOutcomeCallable EMRClient::ModifyInstanceGroupsCallable(const ModifyInstanceGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::ModifyInstanceGroups, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::ModifyInstanceGroups, Aws::Client::RejectedCallOutcome<ModifyInstanceGroupsOutcome>(), this, request);
+}
+
+ModifyInstanceGroupsOutcomeCallable EMRClient::ModifyInstanceGroupsCallable(ModifyInstanceGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::ModifyInstanceGroups, Aws::Client::RejectedCallOutcome<ModifyInstanceGroupsOutcome>(), this, std::move(request));
 }
 
 void EMRClient::ModifyInstanceGroupsAsync(const ModifyInstanceGroupsRequest& request, const ModifyInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::ModifyInstanceGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::ModifyInstanceGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyInstanceGroupsOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::ModifyInstanceGroupsAsync(ModifyInstanceGroupsRequest&& request, const ModifyInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::ModifyInstanceGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyInstanceGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::ModifyInstanceGroupsAsyncHelper(const ModifyInstanceGroupsRequest& request, const ModifyInstanceGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -464,12 +574,22 @@ RemoveTagsOutcome EMRClient::RemoveTags(const RemoveTagsRequest& request) const
 
 RemoveTagsOutcomeCallable EMRClient::RemoveTagsCallable(const RemoveTagsRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::RemoveTags, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::RemoveTags, Aws::Client::RejectedCallOutcome<RemoveTagsOutcome>(), this, request);
+}
+
+RemoveTagsOutcomeCallable EMRClient::RemoveTagsCallable(RemoveTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::RemoveTags, Aws::Client::RejectedCallOutcome<RemoveTagsOutcome>(), this, std::move(request));
 }
 
 void EMRClient::RemoveTagsAsync(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::RemoveTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::RemoveTagsAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::RemoveTagsAsync(RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::RemoveTagsAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::RemoveTagsAsyncHelper(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -495,12 +615,22 @@ RunJobFlowOutcome EMRClient::RunJobFlow(const RunJobFlowRequest& request) const
 
 RunJobFlowOutcomeCallable EMRClient::RunJobFlowCallable(const RunJobFlowRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::RunJobFlow, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::RunJobFlow, Aws::Client::RejectedCallOutcome<RunJobFlowOutcome>(), this, request);
+}
+
+RunJobFlowOutcomeCallable EMRClient::RunJobFlowCallable(RunJobFlowRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::RunJobFlow, Aws::Client::RejectedCallOutcome<RunJobFlowOutcome>(), this, std::move(request));
 }
 
 void EMRClient::RunJobFlowAsync(const RunJobFlowRequest& request, const RunJobFlowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::RunJobFlowAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::RunJobFlowAsyncHelper, Aws::Client::RejectedAsyncCall<RunJobFlowOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::RunJobFlowAsync(RunJobFlowRequest&& request, const RunJobFlowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::RunJobFlowAsyncHelper, Aws::Client::RejectedAsyncCall<RunJobFlowOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::RunJobFlowAsyncHelper(const RunJobFlowRequest& request, const RunJobFlowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -526,12 +656,22 @@ SetTerminationProtectionOutcome EMRClient::SetTerminationProtection(const SetTer
 
 SetTerminationProtectionOutcomeCallable EMRClient::SetTerminationProtectionCallable(const SetTerminationProtectionRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::SetTerminationProtection, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::SetTerminationProtection, Aws::Client::RejectedCallOutcome<SetTerminationProtectionOutcome>(), this, request);
+}
+
+SetTerminationProtectionOutcomeCallable EMRClient::SetTerminationProtectionCallable(SetTerminationProtectionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::SetTerminationProtection, Aws::Client::RejectedCallOutcome<SetTerminationProtectionOutcome>(), this, std::move(request));
 }
 
 void EMRClient::SetTerminationProtectionAsync(const SetTerminationProtectionRequest& request, const SetTerminationProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::SetTerminationProtectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::SetTerminationProtectionAsyncHelper, Aws::Client::RejectedAsyncCall<SetTerminationProtectionOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::SetTerminationProtectionAsync(SetTerminationProtectionRequest&& request, const SetTerminationProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::SetTerminationProtectionAsyncHelper, Aws::Client::RejectedAsyncCall<SetTerminationProtectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::SetTerminationProtectionAsyncHelper(const SetTerminationProtectionRequest& request, const SetTerminationProtectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -557,12 +697,22 @@ SetVisibleToAllUsersOutcome EMRClient::SetVisibleToAllUsers(const SetVisibleToAl
 
 SetVisibleToAllUsersOutcomeCallable EMRClient::SetVisibleToAllUsersCallable(const SetVisibleToAllUsersRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::SetVisibleToAllUsers, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::SetVisibleToAllUsers, Aws::Client::RejectedCallOutcome<SetVisibleToAllUsersOutcome>(), this, request);
+}
+
+SetVisibleToAllUsersOutcomeCallable EMRClient::SetVisibleToAllUsersCallable(SetVisibleToAllUsersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::SetVisibleToAllUsers, Aws::Client::RejectedCallOutcome<SetVisibleToAllUsersOutcome>(), this, std::move(request));
 }
 
 void EMRClient::SetVisibleToAllUsersAsync(const SetVisibleToAllUsersRequest& request, const SetVisibleToAllUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::SetVisibleToAllUsersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::SetVisibleToAllUsersAsyncHelper, Aws::Client::RejectedAsyncCall<SetVisibleToAllUsersOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::SetVisibleToAllUsersAsync(SetVisibleToAllUsersRequest&& request, const SetVisibleToAllUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::SetVisibleToAllUsersAsyncHelper, Aws::Client::RejectedAsyncCall<SetVisibleToAllUsersOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::SetVisibleToAllUsersAsyncHelper(const SetVisibleToAllUsersRequest& request, const SetVisibleToAllUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -588,12 +738,22 @@ TerminateJobFlowsOutcome EMRClient::TerminateJobFlows(const TerminateJobFlowsReq
 
 TerminateJobFlowsOutcomeCallable EMRClient::TerminateJobFlowsCallable(const TerminateJobFlowsRequest& request) const
 {
-  return std::async(std::launch::async, &EMRClient::TerminateJobFlows, this, request);
+  return m_executor->SubmitWithFuture(&EMRClient::TerminateJobFlows, Aws::Client::RejectedCallOutcome<TerminateJobFlowsOutcome>(), this, request);
+}
+
+TerminateJobFlowsOutcomeCallable EMRClient::TerminateJobFlowsCallable(TerminateJobFlowsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&EMRClient::TerminateJobFlows, Aws::Client::RejectedCallOutcome<TerminateJobFlowsOutcome>(), this, std::move(request));
 }
 
 void EMRClient::TerminateJobFlowsAsync(const TerminateJobFlowsRequest& request, const TerminateJobFlowsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&EMRClient::TerminateJobFlowsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&EMRClient::TerminateJobFlowsAsyncHelper, Aws::Client::RejectedAsyncCall<TerminateJobFlowsOutcome>(), this, request, handler, context);
+}
+
+void EMRClient::TerminateJobFlowsAsync(TerminateJobFlowsRequest&& request, const TerminateJobFlowsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&EMRClient::TerminateJobFlowsAsyncHelper, Aws::Client::RejectedAsyncCall<TerminateJobFlowsOutcome>(), this, std::move(request), handler, context);
 }
 
 void EMRClient::TerminateJobFlowsAsyncHelper(const TerminateJobFlowsRequest& request, const TerminateJobFlowsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
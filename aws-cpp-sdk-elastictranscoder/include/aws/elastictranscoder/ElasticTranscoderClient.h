@@ -39,6 +39,27 @@
 #include <aws/elastictranscoder/model/UpdatePipelineStatusResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/elastictranscoder/model/CancelJobRequest.h>
+#include <aws/elastictranscoder/model/CreateJobRequest.h>
+#include <aws/elastictranscoder/model/CreatePipelineRequest.h>
+#include <aws/elastictranscoder/model/CreatePresetRequest.h>
+#include <aws/elastictranscoder/model/DeletePipelineRequest.h>
+#include <aws/elastictranscoder/model/DeletePresetRequest.h>
+#include <aws/elastictranscoder/model/ListJobsByPipelineRequest.h>
+#include <aws/elastictranscoder/model/ListJobsByStatusRequest.h>
+#include <aws/elastictranscoder/model/ListPipelinesRequest.h>
+#include <aws/elastictranscoder/model/ListPresetsRequest.h>
+#include <aws/elastictranscoder/model/ReadJobRequest.h>
+#include <aws/elastictranscoder/model/ReadPipelineRequest.h>
+#include <aws/elastictranscoder/model/ReadPresetRequest.h>
+#include <aws/elastictranscoder/model/TestRoleRequest.h>
+#include <aws/elastictranscoder/model/UpdatePipelineRequest.h>
+#include <aws/elastictranscoder/model/UpdatePipelineNotificationsRequest.h>
+#include <aws/elastictranscoder/model/UpdatePipelineStatusRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -206,6 +227,11 @@ namespace Model
          */
         virtual Model::CancelJobOutcomeCallable CancelJobCallable(const Model::CancelJobRequest& request) const;
 
+        /**
+         * Same as CancelJobCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelJobOutcomeCallable CancelJobCallable(Model::CancelJobRequest&& request) const;
+
         /**
          * <p>The CancelJob operation cancels an unfinished job.</p> <note>You can only
          * cancel a job that has a status of <code>Submitted</code>. To prevent a pipeline
@@ -216,6 +242,11 @@ namespace Model
          */
         virtual void CancelJobAsync(const Model::CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelJobAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelJobAsync(Model::CancelJobRequest&& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> When you create a job, Elastic Transcoder returns JSON data that includes
          * the values that you specified plus information about the job that is created.
@@ -238,6 +269,11 @@ namespace Model
          */
         virtual Model::CreateJobOutcomeCallable CreateJobCallable(const Model::CreateJobRequest& request) const;
 
+        /**
+         * Same as CreateJobCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateJobOutcomeCallable CreateJobCallable(Model::CreateJobRequest&& request) const;
+
         /**
          * <p> When you create a job, Elastic Transcoder returns JSON data that includes
          * the values that you specified plus information about the job that is created.
@@ -250,6 +286,11 @@ namespace Model
          */
         virtual void CreateJobAsync(const Model::CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateJobAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateJobAsync(Model::CreateJobRequest&& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The CreatePipeline operation creates a pipeline with settings that you
          * specify.</p>
@@ -264,6 +305,11 @@ namespace Model
          */
         virtual Model::CreatePipelineOutcomeCallable CreatePipelineCallable(const Model::CreatePipelineRequest& request) const;
 
+        /**
+         * Same as CreatePipelineCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePipelineOutcomeCallable CreatePipelineCallable(Model::CreatePipelineRequest&& request) const;
+
         /**
          * <p>The CreatePipeline operation creates a pipeline with settings that you
          * specify.</p>
@@ -272,6 +318,11 @@ namespace Model
          */
         virtual void CreatePipelineAsync(const Model::CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePipelineAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePipelineAsync(Model::CreatePipelineRequest&& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The CreatePreset operation creates a preset with settings that you
          * specify.</p> <important>Elastic Transcoder checks the CreatePreset settings to
@@ -310,6 +361,11 @@ namespace Model
          */
         virtual Model::CreatePresetOutcomeCallable CreatePresetCallable(const Model::CreatePresetRequest& request) const;
 
+        /**
+         * Same as CreatePresetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePresetOutcomeCallable CreatePresetCallable(Model::CreatePresetRequest&& request) const;
+
         /**
          * <p>The CreatePreset operation creates a preset with settings that you
          * specify.</p> <important>Elastic Transcoder checks the CreatePreset settings to
@@ -330,6 +386,11 @@ namespace Model
          */
         virtual void CreatePresetAsync(const Model::CreatePresetRequest& request, const CreatePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePresetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePresetAsync(Model::CreatePresetRequest&& request, const CreatePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The DeletePipeline operation removes a pipeline.</p> <p> You can only delete
          * a pipeline that has never been used or that is not currently in use (doesn't
@@ -348,6 +409,11 @@ namespace Model
          */
         virtual Model::DeletePipelineOutcomeCallable DeletePipelineCallable(const Model::DeletePipelineRequest& request) const;
 
+        /**
+         * Same as DeletePipelineCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeletePipelineOutcomeCallable DeletePipelineCallable(Model::DeletePipelineRequest&& request) const;
+
         /**
          * <p>The DeletePipeline operation removes a pipeline.</p> <p> You can only delete
          * a pipeline that has never been used or that is not currently in use (doesn't
@@ -358,6 +424,11 @@ namespace Model
          */
         virtual void DeletePipelineAsync(const Model::DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePipelineAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeletePipelineAsync(Model::DeletePipelineRequest&& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The DeletePreset operation removes a preset that you've added in an AWS
          * region.</p> <note> <p>You can't delete the default presets that are included
@@ -374,6 +445,11 @@ namespace Model
          */
         virtual Model::DeletePresetOutcomeCallable DeletePresetCallable(const Model::DeletePresetRequest& request) const;
 
+        /**
+         * Same as DeletePresetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeletePresetOutcomeCallable DeletePresetCallable(Model::DeletePresetRequest&& request) const;
+
         /**
          * <p>The DeletePreset operation removes a preset that you've added in an AWS
          * region.</p> <note> <p>You can't delete the default presets that are included
@@ -383,6 +459,11 @@ namespace Model
          */
         virtual void DeletePresetAsync(const Model::DeletePresetRequest& request, const DeletePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePresetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeletePresetAsync(Model::DeletePresetRequest&& request, const DeletePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The ListJobsByPipeline operation gets a list of the jobs currently in a
          * pipeline.</p> <p>Elastic Transcoder returns all of the jobs currently in the
@@ -401,6 +482,11 @@ namespace Model
          */
         virtual Model::ListJobsByPipelineOutcomeCallable ListJobsByPipelineCallable(const Model::ListJobsByPipelineRequest& request) const;
 
+        /**
+         * Same as ListJobsByPipelineCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListJobsByPipelineOutcomeCallable ListJobsByPipelineCallable(Model::ListJobsByPipelineRequest&& request) const;
+
         /**
          * <p>The ListJobsByPipeline operation gets a list of the jobs currently in a
          * pipeline.</p> <p>Elastic Transcoder returns all of the jobs currently in the
@@ -411,6 +497,11 @@ namespace Model
          */
         virtual void ListJobsByPipelineAsync(const Model::ListJobsByPipelineRequest& request, const ListJobsByPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListJobsByPipelineAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListJobsByPipelineAsync(Model::ListJobsByPipelineRequest&& request, const ListJobsByPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The ListJobsByStatus operation gets a list of jobs that have a specified
          * status. The response body contains one element for each job that satisfies the
@@ -427,6 +518,11 @@ namespace Model
          */
         virtual Model::ListJobsByStatusOutcomeCallable ListJobsByStatusCallable(const Model::ListJobsByStatusRequest& request) const;
 
+        /**
+         * Same as ListJobsByStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListJobsByStatusOutcomeCallable ListJobsByStatusCallable(Model::ListJobsByStatusRequest&& request) const;
+
         /**
          * <p>The ListJobsByStatus operation gets a list of jobs that have a specified
          * status. The response body contains one element for each job that satisfies the
@@ -436,6 +532,11 @@ namespace Model
          */
         virtual void ListJobsByStatusAsync(const Model::ListJobsByStatusRequest& request, const ListJobsByStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListJobsByStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListJobsByStatusAsync(Model::ListJobsByStatusRequest&& request, const ListJobsByStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The ListPipelines operation gets a list of the pipelines associated with the
          * current AWS account.</p>
@@ -450,6 +551,11 @@ namespace Model
          */
         virtual Model::ListPipelinesOutcomeCallable ListPipelinesCallable(const Model::ListPipelinesRequest& request) const;
 
+        /**
+         * Same as ListPipelinesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListPipelinesOutcomeCallable ListPipelinesCallable(Model::ListPipelinesRequest&& request) const;
+
         /**
          * <p>The ListPipelines operation gets a list of the pipelines associated with the
          * current AWS account.</p>
@@ -458,6 +564,11 @@ namespace Model
          */
         virtual void ListPipelinesAsync(const Model::ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPipelinesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListPipelinesAsync(Model::ListPipelinesRequest&& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The ListPresets operation gets a list of the default presets included with
          * Elastic Transcoder and the presets that you've added in an AWS region.</p>
@@ -472,6 +583,11 @@ namespace Model
          */
         virtual Model::ListPresetsOutcomeCallable ListPresetsCallable(const Model::ListPresetsRequest& request) const;
 
+        /**
+         * Same as ListPresetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListPresetsOutcomeCallable ListPresetsCallable(Model::ListPresetsRequest&& request) const;
+
         /**
          * <p>The ListPresets operation gets a list of the default presets included with
          * Elastic Transcoder and the presets that you've added in an AWS region.</p>
@@ -480,6 +596,11 @@ namespace Model
          */
         virtual void ListPresetsAsync(const Model::ListPresetsRequest& request, const ListPresetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPresetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListPresetsAsync(Model::ListPresetsRequest&& request, const ListPresetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The ReadJob operation returns detailed information about a job.</p>
          */
@@ -492,6 +613,11 @@ namespace Model
          */
         virtual Model::ReadJobOutcomeCallable ReadJobCallable(const Model::ReadJobRequest& request) const;
 
+        /**
+         * Same as ReadJobCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReadJobOutcomeCallable ReadJobCallable(Model::ReadJobRequest&& request) const;
+
         /**
          * <p>The ReadJob operation returns detailed information about a job.</p>
          *
@@ -499,6 +625,11 @@ namespace Model
          */
         virtual void ReadJobAsync(const Model::ReadJobRequest& request, const ReadJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReadJobAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReadJobAsync(Model::ReadJobRequest&& request, const ReadJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The ReadPipeline operation gets detailed information about a pipeline.</p>
          */
@@ -511,6 +642,11 @@ namespace Model
          */
         virtual Model::ReadPipelineOutcomeCallable ReadPipelineCallable(const Model::ReadPipelineRequest& request) const;
 
+        /**
+         * Same as ReadPipelineCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReadPipelineOutcomeCallable ReadPipelineCallable(Model::ReadPipelineRequest&& request) const;
+
         /**
          * <p>The ReadPipeline operation gets detailed information about a pipeline.</p>
          *
@@ -518,6 +654,11 @@ namespace Model
          */
         virtual void ReadPipelineAsync(const Model::ReadPipelineRequest& request, const ReadPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReadPipelineAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReadPipelineAsync(Model::ReadPipelineRequest&& request, const ReadPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The ReadPreset operation gets detailed information about a preset.</p>
          */
@@ -530,6 +671,11 @@ namespace Model
          */
         virtual Model::ReadPresetOutcomeCallable ReadPresetCallable(const Model::ReadPresetRequest& request) const;
 
+        /**
+         * Same as ReadPresetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReadPresetOutcomeCallable ReadPresetCallable(Model::ReadPresetRequest&& request) const;
+
         /**
          * <p>The ReadPreset operation gets detailed information about a preset.</p>
          *
@@ -537,6 +683,11 @@ namespace Model
          */
         virtual void ReadPresetAsync(const Model::ReadPresetRequest& request, const ReadPresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReadPresetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReadPresetAsync(Model::ReadPresetRequest&& request, const ReadPresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The TestRole operation tests the IAM role used to create the pipeline.</p>
          * <p>The <code>TestRole</code> action lets you determine whether the IAM role you
@@ -559,6 +710,11 @@ namespace Model
          */
         virtual Model::TestRoleOutcomeCallable TestRoleCallable(const Model::TestRoleRequest& request) const;
 
+        /**
+         * Same as TestRoleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::TestRoleOutcomeCallable TestRoleCallable(Model::TestRoleRequest&& request) const;
+
         /**
          * <p>The TestRole operation tests the IAM role used to create the pipeline.</p>
          * <p>The <code>TestRole</code> action lets you determine whether the IAM role you
@@ -571,6 +727,11 @@ namespace Model
          */
         virtual void TestRoleAsync(const Model::TestRoleRequest& request, const TestRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TestRoleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void TestRoleAsync(Model::TestRoleRequest&& request, const TestRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Use the <code>UpdatePipeline</code> operation to update settings for a
          * pipeline. <important>When you change pipeline settings, your changes take effect
@@ -591,6 +752,11 @@ namespace Model
          */
         virtual Model::UpdatePipelineOutcomeCallable UpdatePipelineCallable(const Model::UpdatePipelineRequest& request) const;
 
+        /**
+         * Same as UpdatePipelineCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdatePipelineOutcomeCallable UpdatePipelineCallable(Model::UpdatePipelineRequest&& request) const;
+
         /**
          * <p> Use the <code>UpdatePipeline</code> operation to update settings for a
          * pipeline. <important>When you change pipeline settings, your changes take effect
@@ -602,6 +768,11 @@ namespace Model
          */
         virtual void UpdatePipelineAsync(const Model::UpdatePipelineRequest& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdatePipelineAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdatePipelineAsync(Model::UpdatePipelineRequest&& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>With the UpdatePipelineNotifications operation, you can update Amazon Simple
          * Notification Service (Amazon SNS) notifications for a pipeline.</p> <p>When you
@@ -620,6 +791,11 @@ namespace Model
          */
         virtual Model::UpdatePipelineNotificationsOutcomeCallable UpdatePipelineNotificationsCallable(const Model::UpdatePipelineNotificationsRequest& request) const;
 
+        /**
+         * Same as UpdatePipelineNotificationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdatePipelineNotificationsOutcomeCallable UpdatePipelineNotificationsCallable(Model::UpdatePipelineNotificationsRequest&& request) const;
+
         /**
          * <p>With the UpdatePipelineNotifications operation, you can update Amazon Simple
          * Notification Service (Amazon SNS) notifications for a pipeline.</p> <p>When you
@@ -630,6 +806,11 @@ namespace Model
          */
         virtual void UpdatePipelineNotificationsAsync(const Model::UpdatePipelineNotificationsRequest& request, const UpdatePipelineNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdatePipelineNotificationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdatePipelineNotificationsAsync(Model::UpdatePipelineNotificationsRequest&& request, const UpdatePipelineNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The UpdatePipelineStatus operation pauses or reactivates a pipeline, so that
          * the pipeline stops or restarts the processing of jobs.</p> <p>Changing the
@@ -654,6 +835,11 @@ namespace Model
          */
         virtual Model::UpdatePipelineStatusOutcomeCallable UpdatePipelineStatusCallable(const Model::UpdatePipelineStatusRequest& request) const;
 
+        /**
+         * Same as UpdatePipelineStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdatePipelineStatusOutcomeCallable UpdatePipelineStatusCallable(Model::UpdatePipelineStatusRequest&& request) const;
+
         /**
          * <p>The UpdatePipelineStatus operation pauses or reactivates a pipeline, so that
          * the pipeline stops or restarts the processing of jobs.</p> <p>Changing the
@@ -667,6 +853,52 @@ namespace Model
          */
         virtual void UpdatePipelineStatusAsync(const Model::UpdatePipelineStatusRequest& request, const UpdatePipelineStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdatePipelineStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdatePipelineStatusAsync(Model::UpdatePipelineStatusRequest&& request, const UpdatePipelineStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelJobOutcome> CancelJobAwaitable(const Model::CancelJobRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::CancelJob, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelJobOutcome> CancelJobAwaitable(Model::CancelJobRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::CancelJob, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateJobOutcome> CreateJobAwaitable(const Model::CreateJobRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::CreateJob, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateJobOutcome> CreateJobAwaitable(Model::CreateJobRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::CreateJob, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePipelineOutcome> CreatePipelineAwaitable(const Model::CreatePipelineRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::CreatePipeline, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePipelineOutcome> CreatePipelineAwaitable(Model::CreatePipelineRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::CreatePipeline, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePresetOutcome> CreatePresetAwaitable(const Model::CreatePresetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::CreatePreset, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePresetOutcome> CreatePresetAwaitable(Model::CreatePresetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::CreatePreset, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePipelineOutcome> DeletePipelineAwaitable(const Model::DeletePipelineRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::DeletePipeline, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePipelineOutcome> DeletePipelineAwaitable(Model::DeletePipelineRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::DeletePipeline, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePresetOutcome> DeletePresetAwaitable(const Model::DeletePresetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::DeletePreset, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePresetOutcome> DeletePresetAwaitable(Model::DeletePresetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::DeletePreset, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListJobsByPipelineOutcome> ListJobsByPipelineAwaitable(const Model::ListJobsByPipelineRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::ListJobsByPipeline, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListJobsByPipelineOutcome> ListJobsByPipelineAwaitable(Model::ListJobsByPipelineRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::ListJobsByPipeline, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListJobsByStatusOutcome> ListJobsByStatusAwaitable(const Model::ListJobsByStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::ListJobsByStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListJobsByStatusOutcome> ListJobsByStatusAwaitable(Model::ListJobsByStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::ListJobsByStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPipelinesOutcome> ListPipelinesAwaitable(const Model::ListPipelinesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::ListPipelines, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPipelinesOutcome> ListPipelinesAwaitable(Model::ListPipelinesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::ListPipelines, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPresetsOutcome> ListPresetsAwaitable(const Model::ListPresetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::ListPresets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPresetsOutcome> ListPresetsAwaitable(Model::ListPresetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::ListPresets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReadJobOutcome> ReadJobAwaitable(const Model::ReadJobRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::ReadJob, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReadJobOutcome> ReadJobAwaitable(Model::ReadJobRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::ReadJob, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReadPipelineOutcome> ReadPipelineAwaitable(const Model::ReadPipelineRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::ReadPipeline, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReadPipelineOutcome> ReadPipelineAwaitable(Model::ReadPipelineRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::ReadPipeline, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReadPresetOutcome> ReadPresetAwaitable(const Model::ReadPresetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::ReadPreset, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReadPresetOutcome> ReadPresetAwaitable(Model::ReadPresetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::ReadPreset, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TestRoleOutcome> TestRoleAwaitable(const Model::TestRoleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::TestRole, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TestRoleOutcome> TestRoleAwaitable(Model::TestRoleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::TestRole, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdatePipelineOutcome> UpdatePipelineAwaitable(const Model::UpdatePipelineRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::UpdatePipeline, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdatePipelineOutcome> UpdatePipelineAwaitable(Model::UpdatePipelineRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::UpdatePipeline, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdatePipelineNotificationsOutcome> UpdatePipelineNotificationsAwaitable(const Model::UpdatePipelineNotificationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::UpdatePipelineNotifications, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdatePipelineNotificationsOutcome> UpdatePipelineNotificationsAwaitable(Model::UpdatePipelineNotificationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::UpdatePipelineNotifications, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdatePipelineStatusOutcome> UpdatePipelineStatusAwaitable(const Model::UpdatePipelineStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::UpdatePipelineStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdatePipelineStatusOutcome> UpdatePipelineStatusAwaitable(Model::UpdatePipelineStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticTranscoderClient::UpdatePipelineStatus, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -125,12 +125,22 @@ CancelJobOutcome ElasticTranscoderClient::CancelJob(const CancelJobRequest& requ
 
 CancelJobOutcomeCallable ElasticTranscoderClient::CancelJobCallable(const CancelJobRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::CancelJob, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::CancelJob, Aws::Client::RejectedCallOutcome<CancelJobOutcome>(), this, request);
+}
+
+CancelJobOutcomeCallable ElasticTranscoderClient::CancelJobCallable(CancelJobRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::CancelJob, Aws::Client::RejectedCallOutcome<CancelJobOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::CancelJobAsync(const CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::CancelJobAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::CancelJobAsyncHelper, Aws::Client::RejectedAsyncCall<CancelJobOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::CancelJobAsync(CancelJobRequest&& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::CancelJobAsyncHelper, Aws::Client::RejectedAsyncCall<CancelJobOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::CancelJobAsyncHelper(const CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -156,12 +166,22 @@ CreateJobOutcome ElasticTranscoderClient::CreateJob(const CreateJobRequest& requ
 
 CreateJobOutcomeCallable ElasticTranscoderClient::CreateJobCallable(const CreateJobRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::CreateJob, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::CreateJob, Aws::Client::RejectedCallOutcome<CreateJobOutcome>(), this, request);
+}
+
+CreateJobOutcomeCallable ElasticTranscoderClient::CreateJobCallable(CreateJobRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::CreateJob, Aws::Client::RejectedCallOutcome<CreateJobOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::CreateJobAsync(const CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::CreateJobAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::CreateJobAsyncHelper, Aws::Client::RejectedAsyncCall<CreateJobOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::CreateJobAsync(CreateJobRequest&& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::CreateJobAsyncHelper, Aws::Client::RejectedAsyncCall<CreateJobOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::CreateJobAsyncHelper(const CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -187,12 +207,22 @@ CreatePipelineOutcome ElasticTranscoderClient::CreatePipeline(const CreatePipeli
 
 CreatePipelineOutcomeCallable ElasticTranscoderClient::CreatePipelineCallable(const CreatePipelineRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::CreatePipeline, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::CreatePipeline, Aws::Client::RejectedCallOutcome<CreatePipelineOutcome>(), this, request);
+}
+
+CreatePipelineOutcomeCallable ElasticTranscoderClient::CreatePipelineCallable(CreatePipelineRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::CreatePipeline, Aws::Client::RejectedCallOutcome<CreatePipelineOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::CreatePipelineAsync(const CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::CreatePipelineAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::CreatePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePipelineOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::CreatePipelineAsync(CreatePipelineRequest&& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::CreatePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePipelineOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::CreatePipelineAsyncHelper(const CreatePipelineRequest& request, const CreatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -218,12 +248,22 @@ CreatePresetOutcome ElasticTranscoderClient::CreatePreset(const CreatePresetRequ
 
 CreatePresetOutcomeCallable ElasticTranscoderClient::CreatePresetCallable(const CreatePresetRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::CreatePreset, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::CreatePreset, Aws::Client::RejectedCallOutcome<CreatePresetOutcome>(), this, request);
+}
+
+CreatePresetOutcomeCallable ElasticTranscoderClient::CreatePresetCallable(CreatePresetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::CreatePreset, Aws::Client::RejectedCallOutcome<CreatePresetOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::CreatePresetAsync(const CreatePresetRequest& request, const CreatePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::CreatePresetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::CreatePresetAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePresetOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::CreatePresetAsync(CreatePresetRequest&& request, const CreatePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::CreatePresetAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePresetOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::CreatePresetAsyncHelper(const CreatePresetRequest& request, const CreatePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -250,12 +290,22 @@ DeletePipelineOutcome ElasticTranscoderClient::DeletePipeline(const DeletePipeli
 
 DeletePipelineOutcomeCallable ElasticTranscoderClient::DeletePipelineCallable(const DeletePipelineRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::DeletePipeline, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::DeletePipeline, Aws::Client::RejectedCallOutcome<DeletePipelineOutcome>(), this, request);
+}
+
+DeletePipelineOutcomeCallable ElasticTranscoderClient::DeletePipelineCallable(DeletePipelineRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::DeletePipeline, Aws::Client::RejectedCallOutcome<DeletePipelineOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::DeletePipelineAsync(const DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::DeletePipelineAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::DeletePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePipelineOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::DeletePipelineAsync(DeletePipelineRequest&& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::DeletePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePipelineOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::DeletePipelineAsyncHelper(const DeletePipelineRequest& request, const DeletePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -282,12 +332,22 @@ DeletePresetOutcome ElasticTranscoderClient::DeletePreset(const DeletePresetRequ
 
 DeletePresetOutcomeCallable ElasticTranscoderClient::DeletePresetCallable(const DeletePresetRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::DeletePreset, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::DeletePreset, Aws::Client::RejectedCallOutcome<DeletePresetOutcome>(), this, request);
+}
+
+DeletePresetOutcomeCallable ElasticTranscoderClient::DeletePresetCallable(DeletePresetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::DeletePreset, Aws::Client::RejectedCallOutcome<DeletePresetOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::DeletePresetAsync(const DeletePresetRequest& request, const DeletePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::DeletePresetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::DeletePresetAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePresetOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::DeletePresetAsync(DeletePresetRequest&& request, const DeletePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::DeletePresetAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePresetOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::DeletePresetAsyncHelper(const DeletePresetRequest& request, const DeletePresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -314,12 +374,22 @@ ListJobsByPipelineOutcome ElasticTranscoderClient::ListJobsByPipeline(const List
 
 ListJobsByPipelineOutcomeCallable ElasticTranscoderClient::ListJobsByPipelineCallable(const ListJobsByPipelineRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::ListJobsByPipeline, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::ListJobsByPipeline, Aws::Client::RejectedCallOutcome<ListJobsByPipelineOutcome>(), this, request);
+}
+
+ListJobsByPipelineOutcomeCallable ElasticTranscoderClient::ListJobsByPipelineCallable(ListJobsByPipelineRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::ListJobsByPipeline, Aws::Client::RejectedCallOutcome<ListJobsByPipelineOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::ListJobsByPipelineAsync(const ListJobsByPipelineRequest& request, const ListJobsByPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::ListJobsByPipelineAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::ListJobsByPipelineAsyncHelper, Aws::Client::RejectedAsyncCall<ListJobsByPipelineOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::ListJobsByPipelineAsync(ListJobsByPipelineRequest&& request, const ListJobsByPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::ListJobsByPipelineAsyncHelper, Aws::Client::RejectedAsyncCall<ListJobsByPipelineOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::ListJobsByPipelineAsyncHelper(const ListJobsByPipelineRequest& request, const ListJobsByPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -346,12 +416,22 @@ ListJobsByStatusOutcome ElasticTranscoderClient::ListJobsByStatus(const ListJobs
 
 ListJobsByStatusOutcomeCallable ElasticTranscoderClient::ListJobsByStatusCallable(const ListJobsByStatusRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::ListJobsByStatus, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::ListJobsByStatus, Aws::Client::RejectedCallOutcome<ListJobsByStatusOutcome>(), this, request);
+}
+
+ListJobsByStatusOutcomeCallable ElasticTranscoderClient::ListJobsByStatusCallable(ListJobsByStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::ListJobsByStatus, Aws::Client::RejectedCallOutcome<ListJobsByStatusOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::ListJobsByStatusAsync(const ListJobsByStatusRequest& request, const ListJobsByStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::ListJobsByStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::ListJobsByStatusAsyncHelper, Aws::Client::RejectedAsyncCall<ListJobsByStatusOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::ListJobsByStatusAsync(ListJobsByStatusRequest&& request, const ListJobsByStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::ListJobsByStatusAsyncHelper, Aws::Client::RejectedAsyncCall<ListJobsByStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::ListJobsByStatusAsyncHelper(const ListJobsByStatusRequest& request, const ListJobsByStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -377,12 +457,22 @@ ListPipelinesOutcome ElasticTranscoderClient::ListPipelines(const ListPipelinesR
 
 ListPipelinesOutcomeCallable ElasticTranscoderClient::ListPipelinesCallable(const ListPipelinesRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::ListPipelines, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::ListPipelines, Aws::Client::RejectedCallOutcome<ListPipelinesOutcome>(), this, request);
+}
+
+ListPipelinesOutcomeCallable ElasticTranscoderClient::ListPipelinesCallable(ListPipelinesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::ListPipelines, Aws::Client::RejectedCallOutcome<ListPipelinesOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::ListPipelinesAsync(const ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::ListPipelinesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::ListPipelinesAsyncHelper, Aws::Client::RejectedAsyncCall<ListPipelinesOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::ListPipelinesAsync(ListPipelinesRequest&& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::ListPipelinesAsyncHelper, Aws::Client::RejectedAsyncCall<ListPipelinesOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::ListPipelinesAsyncHelper(const ListPipelinesRequest& request, const ListPipelinesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -408,12 +498,22 @@ ListPresetsOutcome ElasticTranscoderClient::ListPresets(const ListPresetsRequest
 
 ListPresetsOutcomeCallable ElasticTranscoderClient::ListPresetsCallable(const ListPresetsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::ListPresets, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::ListPresets, Aws::Client::RejectedCallOutcome<ListPresetsOutcome>(), this, request);
+}
+
+ListPresetsOutcomeCallable ElasticTranscoderClient::ListPresetsCallable(ListPresetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::ListPresets, Aws::Client::RejectedCallOutcome<ListPresetsOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::ListPresetsAsync(const ListPresetsRequest& request, const ListPresetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::ListPresetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::ListPresetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListPresetsOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::ListPresetsAsync(ListPresetsRequest&& request, const ListPresetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::ListPresetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListPresetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::ListPresetsAsyncHelper(const ListPresetsRequest& request, const ListPresetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -440,12 +540,22 @@ ReadJobOutcome ElasticTranscoderClient::ReadJob(const ReadJobRequest& request) c
 
 ReadJobOutcomeCallable ElasticTranscoderClient::ReadJobCallable(const ReadJobRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::ReadJob, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::ReadJob, Aws::Client::RejectedCallOutcome<ReadJobOutcome>(), this, request);
+}
+
+ReadJobOutcomeCallable ElasticTranscoderClient::ReadJobCallable(ReadJobRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::ReadJob, Aws::Client::RejectedCallOutcome<ReadJobOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::ReadJobAsync(const ReadJobRequest& request, const ReadJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::ReadJobAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::ReadJobAsyncHelper, Aws::Client::RejectedAsyncCall<ReadJobOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::ReadJobAsync(ReadJobRequest&& request, const ReadJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::ReadJobAsyncHelper, Aws::Client::RejectedAsyncCall<ReadJobOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::ReadJobAsyncHelper(const ReadJobRequest& request, const ReadJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -472,12 +582,22 @@ ReadPipelineOutcome ElasticTranscoderClient::ReadPipeline(const ReadPipelineRequ
 
 ReadPipelineOutcomeCallable ElasticTranscoderClient::ReadPipelineCallable(const ReadPipelineRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::ReadPipeline, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::ReadPipeline, Aws::Client::RejectedCallOutcome<ReadPipelineOutcome>(), this, request);
+}
+
+ReadPipelineOutcomeCallable ElasticTranscoderClient::ReadPipelineCallable(ReadPipelineRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::ReadPipeline, Aws::Client::RejectedCallOutcome<ReadPipelineOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::ReadPipelineAsync(const ReadPipelineRequest& request, const ReadPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::ReadPipelineAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::ReadPipelineAsyncHelper, Aws::Client::RejectedAsyncCall<ReadPipelineOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::ReadPipelineAsync(ReadPipelineRequest&& request, const ReadPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::ReadPipelineAsyncHelper, Aws::Client::RejectedAsyncCall<ReadPipelineOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::ReadPipelineAsyncHelper(const ReadPipelineRequest& request, const ReadPipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -504,12 +624,22 @@ ReadPresetOutcome ElasticTranscoderClient::ReadPreset(const ReadPresetRequest& r
 
 ReadPresetOutcomeCallable ElasticTranscoderClient::ReadPresetCallable(const ReadPresetRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::ReadPreset, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::ReadPreset, Aws::Client::RejectedCallOutcome<ReadPresetOutcome>(), this, request);
+}
+
+ReadPresetOutcomeCallable ElasticTranscoderClient::ReadPresetCallable(ReadPresetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::ReadPreset, Aws::Client::RejectedCallOutcome<ReadPresetOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::ReadPresetAsync(const ReadPresetRequest& request, const ReadPresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::ReadPresetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::ReadPresetAsyncHelper, Aws::Client::RejectedAsyncCall<ReadPresetOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::ReadPresetAsync(ReadPresetRequest&& request, const ReadPresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::ReadPresetAsyncHelper, Aws::Client::RejectedAsyncCall<ReadPresetOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::ReadPresetAsyncHelper(const ReadPresetRequest& request, const ReadPresetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -535,12 +665,22 @@ TestRoleOutcome ElasticTranscoderClient::TestRole(const TestRoleRequest& request
 
 TestRoleOutcomeCallable ElasticTranscoderClient::TestRoleCallable(const TestRoleRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::TestRole, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::TestRole, Aws::Client::RejectedCallOutcome<TestRoleOutcome>(), this, request);
+}
+
+TestRoleOutcomeCallable ElasticTranscoderClient::TestRoleCallable(TestRoleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::TestRole, Aws::Client::RejectedCallOutcome<TestRoleOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::TestRoleAsync(const TestRoleRequest& request, const TestRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::TestRoleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::TestRoleAsyncHelper, Aws::Client::RejectedAsyncCall<TestRoleOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::TestRoleAsync(TestRoleRequest&& request, const TestRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::TestRoleAsyncHelper, Aws::Client::RejectedAsyncCall<TestRoleOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::TestRoleAsyncHelper(const TestRoleRequest& request, const TestRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -567,12 +707,22 @@ UpdatePipelineOutcome ElasticTranscoderClient::UpdatePipeline(const UpdatePipeli
 
 UpdatePipelineOutcomeCallable ElasticTranscoderClient::UpdatePipelineCallable(const UpdatePipelineRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::UpdatePipeline, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::UpdatePipeline, Aws::Client::RejectedCallOutcome<UpdatePipelineOutcome>(), this, request);
+}
+
+UpdatePipelineOutcomeCallable ElasticTranscoderClient::UpdatePipelineCallable(UpdatePipelineRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::UpdatePipeline, Aws::Client::RejectedCallOutcome<UpdatePipelineOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::UpdatePipelineAsync(const UpdatePipelineRequest& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::UpdatePipelineAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::UpdatePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<UpdatePipelineOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::UpdatePipelineAsync(UpdatePipelineRequest&& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::UpdatePipelineAsyncHelper, Aws::Client::RejectedAsyncCall<UpdatePipelineOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::UpdatePipelineAsyncHelper(const UpdatePipelineRequest& request, const UpdatePipelineResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -600,12 +750,22 @@ UpdatePipelineNotificationsOutcome ElasticTranscoderClient::UpdatePipelineNotifi
 
 UpdatePipelineNotificationsOutcomeCallable ElasticTranscoderClient::UpdatePipelineNotificationsCallable(const UpdatePipelineNotificationsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::UpdatePipelineNotifications, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::UpdatePipelineNotifications, Aws::Client::RejectedCallOutcome<UpdatePipelineNotificationsOutcome>(), this, request);
+}
+
+UpdatePipelineNotificationsOutcomeCallable ElasticTranscoderClient::UpdatePipelineNotificationsCallable(UpdatePipelineNotificationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::UpdatePipelineNotifications, Aws::Client::RejectedCallOutcome<UpdatePipelineNotificationsOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::UpdatePipelineNotificationsAsync(const UpdatePipelineNotificationsRequest& request, const UpdatePipelineNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::UpdatePipelineNotificationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::UpdatePipelineNotificationsAsyncHelper, Aws::Client::RejectedAsyncCall<UpdatePipelineNotificationsOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::UpdatePipelineNotificationsAsync(UpdatePipelineNotificationsRequest&& request, const UpdatePipelineNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::UpdatePipelineNotificationsAsyncHelper, Aws::Client::RejectedAsyncCall<UpdatePipelineNotificationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::UpdatePipelineNotificationsAsyncHelper(const UpdatePipelineNotificationsRequest& request, const UpdatePipelineNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -633,12 +793,22 @@ UpdatePipelineStatusOutcome ElasticTranscoderClient::UpdatePipelineStatus(const
 
 UpdatePipelineStatusOutcomeCallable ElasticTranscoderClient::UpdatePipelineStatusCallable(const UpdatePipelineStatusRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticTranscoderClient::UpdatePipelineStatus, this, request);
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::UpdatePipelineStatus, Aws::Client::RejectedCallOutcome<UpdatePipelineStatusOutcome>(), this, request);
+}
+
+UpdatePipelineStatusOutcomeCallable ElasticTranscoderClient::UpdatePipelineStatusCallable(UpdatePipelineStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticTranscoderClient::UpdatePipelineStatus, Aws::Client::RejectedCallOutcome<UpdatePipelineStatusOutcome>(), this, std::move(request));
 }
 
 void ElasticTranscoderClient::UpdatePipelineStatusAsync(const UpdatePipelineStatusRequest& request, const UpdatePipelineStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticTranscoderClient::UpdatePipelineStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::UpdatePipelineStatusAsyncHelper, Aws::Client::RejectedAsyncCall<UpdatePipelineStatusOutcome>(), this, request, handler, context);
+}
+
+void ElasticTranscoderClient::UpdatePipelineStatusAsync(UpdatePipelineStatusRequest&& request, const UpdatePipelineStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticTranscoderClient::UpdatePipelineStatusAsyncHelper, Aws::Client::RejectedAsyncCall<UpdatePipelineStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticTranscoderClient::UpdatePipelineStatusAsyncHelper(const UpdatePipelineStatusRequest& request, const UpdatePipelineStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -60,6 +60,49 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/email/model/CloneReceiptRuleSetRequest.h>
+#include <aws/email/model/CreateReceiptFilterRequest.h>
+#include <aws/email/model/CreateReceiptRuleRequest.h>
+#include <aws/email/model/CreateReceiptRuleSetRequest.h>
+#include <aws/email/model/DeleteIdentityRequest.h>
+#include <aws/email/model/DeleteIdentityPolicyRequest.h>
+#include <aws/email/model/DeleteReceiptFilterRequest.h>
+#include <aws/email/model/DeleteReceiptRuleRequest.h>
+#include <aws/email/model/DeleteReceiptRuleSetRequest.h>
+#include <aws/email/model/DeleteVerifiedEmailAddressRequest.h>
+#include <aws/email/model/DescribeActiveReceiptRuleSetRequest.h>
+#include <aws/email/model/DescribeReceiptRuleRequest.h>
+#include <aws/email/model/DescribeReceiptRuleSetRequest.h>
+#include <aws/email/model/GetIdentityDkimAttributesRequest.h>
+#include <aws/email/model/GetIdentityNotificationAttributesRequest.h>
+#include <aws/email/model/GetIdentityPoliciesRequest.h>
+#include <aws/email/model/GetIdentityVerificationAttributesRequest.h>
+#include <aws/email/model/GetSendQuotaRequest.h>
+#include <aws/email/model/GetSendStatisticsRequest.h>
+#include <aws/email/model/ListIdentitiesRequest.h>
+#include <aws/email/model/ListIdentityPoliciesRequest.h>
+#include <aws/email/model/ListReceiptFiltersRequest.h>
+#include <aws/email/model/ListReceiptRuleSetsRequest.h>
+#include <aws/email/model/ListVerifiedEmailAddressesRequest.h>
+#include <aws/email/model/PutIdentityPolicyRequest.h>
+#include <aws/email/model/ReorderReceiptRuleSetRequest.h>
+#include <aws/email/model/SendBounceRequest.h>
+#include <aws/email/model/SendEmailRequest.h>
+#include <aws/email/model/SendRawEmailRequest.h>
+#include <aws/email/model/SetActiveReceiptRuleSetRequest.h>
+#include <aws/email/model/SetIdentityDkimEnabledRequest.h>
+#include <aws/email/model/SetIdentityFeedbackForwardingEnabledRequest.h>
+#include <aws/email/model/SetIdentityNotificationTopicRequest.h>
+#include <aws/email/model/SetReceiptRulePositionRequest.h>
+#include <aws/email/model/UpdateReceiptRuleRequest.h>
+#include <aws/email/model/VerifyDomainDkimRequest.h>
+#include <aws/email/model/VerifyDomainIdentityRequest.h>
+#include <aws/email/model/VerifyEmailAddressRequest.h>
+#include <aws/email/model/VerifyEmailIdentityRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -327,6 +370,11 @@ namespace Model
          */
         virtual Model::CloneReceiptRuleSetOutcomeCallable CloneReceiptRuleSetCallable(const Model::CloneReceiptRuleSetRequest& request) const;
 
+        /**
+         * Same as CloneReceiptRuleSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CloneReceiptRuleSetOutcomeCallable CloneReceiptRuleSetCallable(Model::CloneReceiptRuleSetRequest&& request) const;
+
         /**
          * <p>Creates a receipt rule set by cloning an existing one. All receipt rules and
          * configurations are copied to the new receipt rule set and are completely
@@ -340,6 +388,11 @@ namespace Model
          */
         virtual void CloneReceiptRuleSetAsync(const Model::CloneReceiptRuleSetRequest& request, const CloneReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CloneReceiptRuleSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CloneReceiptRuleSetAsync(Model::CloneReceiptRuleSetRequest&& request, const CloneReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new IP address filter.</p> <p>For information about setting up IP
          * address filters, see the <a
@@ -360,6 +413,11 @@ namespace Model
          */
         virtual Model::CreateReceiptFilterOutcomeCallable CreateReceiptFilterCallable(const Model::CreateReceiptFilterRequest& request) const;
 
+        /**
+         * Same as CreateReceiptFilterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateReceiptFilterOutcomeCallable CreateReceiptFilterCallable(Model::CreateReceiptFilterRequest&& request) const;
+
         /**
          * <p>Creates a new IP address filter.</p> <p>For information about setting up IP
          * address filters, see the <a
@@ -371,6 +429,11 @@ namespace Model
          */
         virtual void CreateReceiptFilterAsync(const Model::CreateReceiptFilterRequest& request, const CreateReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReceiptFilterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateReceiptFilterAsync(Model::CreateReceiptFilterRequest&& request, const CreateReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a receipt rule.</p> <p>For information about setting up receipt
          * rules, see the <a
@@ -391,6 +454,11 @@ namespace Model
          */
         virtual Model::CreateReceiptRuleOutcomeCallable CreateReceiptRuleCallable(const Model::CreateReceiptRuleRequest& request) const;
 
+        /**
+         * Same as CreateReceiptRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateReceiptRuleOutcomeCallable CreateReceiptRuleCallable(Model::CreateReceiptRuleRequest&& request) const;
+
         /**
          * <p>Creates a receipt rule.</p> <p>For information about setting up receipt
          * rules, see the <a
@@ -402,6 +470,11 @@ namespace Model
          */
         virtual void CreateReceiptRuleAsync(const Model::CreateReceiptRuleRequest& request, const CreateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReceiptRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateReceiptRuleAsync(Model::CreateReceiptRuleRequest&& request, const CreateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an empty receipt rule set.</p> <p>For information about setting up
          * receipt rule sets, see the <a
@@ -422,6 +495,11 @@ namespace Model
          */
         virtual Model::CreateReceiptRuleSetOutcomeCallable CreateReceiptRuleSetCallable(const Model::CreateReceiptRuleSetRequest& request) const;
 
+        /**
+         * Same as CreateReceiptRuleSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateReceiptRuleSetOutcomeCallable CreateReceiptRuleSetCallable(Model::CreateReceiptRuleSetRequest&& request) const;
+
         /**
          * <p>Creates an empty receipt rule set.</p> <p>For information about setting up
          * receipt rule sets, see the <a
@@ -433,6 +511,11 @@ namespace Model
          */
         virtual void CreateReceiptRuleSetAsync(const Model::CreateReceiptRuleSetRequest& request, const CreateReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReceiptRuleSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateReceiptRuleSetAsync(Model::CreateReceiptRuleSetRequest&& request, const CreateReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified identity (email address or domain) from the list of
          * verified identities.</p> <p>This action is throttled at one request per
@@ -449,6 +532,11 @@ namespace Model
          */
         virtual Model::DeleteIdentityOutcomeCallable DeleteIdentityCallable(const Model::DeleteIdentityRequest& request) const;
 
+        /**
+         * Same as DeleteIdentityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteIdentityOutcomeCallable DeleteIdentityCallable(Model::DeleteIdentityRequest&& request) const;
+
         /**
          * <p>Deletes the specified identity (email address or domain) from the list of
          * verified identities.</p> <p>This action is throttled at one request per
@@ -458,6 +546,11 @@ namespace Model
          */
         virtual void DeleteIdentityAsync(const Model::DeleteIdentityRequest& request, const DeleteIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIdentityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteIdentityAsync(Model::DeleteIdentityRequest&& request, const DeleteIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified sending authorization policy for the given identity
          * (email address or domain). This API returns successfully even if a policy with
@@ -488,6 +581,11 @@ namespace Model
          */
         virtual Model::DeleteIdentityPolicyOutcomeCallable DeleteIdentityPolicyCallable(const Model::DeleteIdentityPolicyRequest& request) const;
 
+        /**
+         * Same as DeleteIdentityPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteIdentityPolicyOutcomeCallable DeleteIdentityPolicyCallable(Model::DeleteIdentityPolicyRequest&& request) const;
+
         /**
          * <p>Deletes the specified sending authorization policy for the given identity
          * (email address or domain). This API returns successfully even if a policy with
@@ -504,6 +602,11 @@ namespace Model
          */
         virtual void DeleteIdentityPolicyAsync(const Model::DeleteIdentityPolicyRequest& request, const DeleteIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIdentityPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteIdentityPolicyAsync(Model::DeleteIdentityPolicyRequest&& request, const DeleteIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified IP address filter.</p> <p>For information about
          * managing IP address filters, see the <a
@@ -524,6 +627,11 @@ namespace Model
          */
         virtual Model::DeleteReceiptFilterOutcomeCallable DeleteReceiptFilterCallable(const Model::DeleteReceiptFilterRequest& request) const;
 
+        /**
+         * Same as DeleteReceiptFilterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteReceiptFilterOutcomeCallable DeleteReceiptFilterCallable(Model::DeleteReceiptFilterRequest&& request) const;
+
         /**
          * <p>Deletes the specified IP address filter.</p> <p>For information about
          * managing IP address filters, see the <a
@@ -535,6 +643,11 @@ namespace Model
          */
         virtual void DeleteReceiptFilterAsync(const Model::DeleteReceiptFilterRequest& request, const DeleteReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteReceiptFilterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteReceiptFilterAsync(Model::DeleteReceiptFilterRequest&& request, const DeleteReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified receipt rule.</p> <p>For information about managing
          * receipt rules, see the <a
@@ -555,6 +668,11 @@ namespace Model
          */
         virtual Model::DeleteReceiptRuleOutcomeCallable DeleteReceiptRuleCallable(const Model::DeleteReceiptRuleRequest& request) const;
 
+        /**
+         * Same as DeleteReceiptRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteReceiptRuleOutcomeCallable DeleteReceiptRuleCallable(Model::DeleteReceiptRuleRequest&& request) const;
+
         /**
          * <p>Deletes the specified receipt rule.</p> <p>For information about managing
          * receipt rules, see the <a
@@ -566,6 +684,11 @@ namespace Model
          */
         virtual void DeleteReceiptRuleAsync(const Model::DeleteReceiptRuleRequest& request, const DeleteReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteReceiptRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteReceiptRuleAsync(Model::DeleteReceiptRuleRequest&& request, const DeleteReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified receipt rule set and all of the receipt rules it
          * contains.</p> <note>The currently active rule set cannot be deleted.</note>
@@ -588,6 +711,11 @@ namespace Model
          */
         virtual Model::DeleteReceiptRuleSetOutcomeCallable DeleteReceiptRuleSetCallable(const Model::DeleteReceiptRuleSetRequest& request) const;
 
+        /**
+         * Same as DeleteReceiptRuleSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteReceiptRuleSetOutcomeCallable DeleteReceiptRuleSetCallable(Model::DeleteReceiptRuleSetRequest&& request) const;
+
         /**
          * <p>Deletes the specified receipt rule set and all of the receipt rules it
          * contains.</p> <note>The currently active rule set cannot be deleted.</note>
@@ -600,6 +728,11 @@ namespace Model
          */
         virtual void DeleteReceiptRuleSetAsync(const Model::DeleteReceiptRuleSetRequest& request, const DeleteReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteReceiptRuleSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteReceiptRuleSetAsync(Model::DeleteReceiptRuleSetRequest&& request, const DeleteReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified email address from the list of verified addresses.</p>
          * <important>The DeleteVerifiedEmailAddress action is deprecated as of the May 15,
@@ -620,6 +753,11 @@ namespace Model
          */
         virtual Model::DeleteVerifiedEmailAddressOutcomeCallable DeleteVerifiedEmailAddressCallable(const Model::DeleteVerifiedEmailAddressRequest& request) const;
 
+        /**
+         * Same as DeleteVerifiedEmailAddressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteVerifiedEmailAddressOutcomeCallable DeleteVerifiedEmailAddressCallable(Model::DeleteVerifiedEmailAddressRequest&& request) const;
+
         /**
          * <p>Deletes the specified email address from the list of verified addresses.</p>
          * <important>The DeleteVerifiedEmailAddress action is deprecated as of the May 15,
@@ -631,6 +769,11 @@ namespace Model
          */
         virtual void DeleteVerifiedEmailAddressAsync(const Model::DeleteVerifiedEmailAddressRequest& request, const DeleteVerifiedEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVerifiedEmailAddressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteVerifiedEmailAddressAsync(Model::DeleteVerifiedEmailAddressRequest&& request, const DeleteVerifiedEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the metadata and receipt rules for the receipt rule set that is
          * currently active.</p> <p>For information about setting up receipt rule sets, see
@@ -653,6 +796,11 @@ namespace Model
          */
         virtual Model::DescribeActiveReceiptRuleSetOutcomeCallable DescribeActiveReceiptRuleSetCallable(const Model::DescribeActiveReceiptRuleSetRequest& request) const;
 
+        /**
+         * Same as DescribeActiveReceiptRuleSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeActiveReceiptRuleSetOutcomeCallable DescribeActiveReceiptRuleSetCallable(Model::DescribeActiveReceiptRuleSetRequest&& request) const;
+
         /**
          * <p>Returns the metadata and receipt rules for the receipt rule set that is
          * currently active.</p> <p>For information about setting up receipt rule sets, see
@@ -665,6 +813,11 @@ namespace Model
          */
         virtual void DescribeActiveReceiptRuleSetAsync(const Model::DescribeActiveReceiptRuleSetRequest& request, const DescribeActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeActiveReceiptRuleSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeActiveReceiptRuleSetAsync(Model::DescribeActiveReceiptRuleSetRequest&& request, const DescribeActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the details of the specified receipt rule.</p> <p>For information
          * about setting up receipt rules, see the <a
@@ -685,6 +838,11 @@ namespace Model
          */
         virtual Model::DescribeReceiptRuleOutcomeCallable DescribeReceiptRuleCallable(const Model::DescribeReceiptRuleRequest& request) const;
 
+        /**
+         * Same as DescribeReceiptRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeReceiptRuleOutcomeCallable DescribeReceiptRuleCallable(Model::DescribeReceiptRuleRequest&& request) const;
+
         /**
          * <p>Returns the details of the specified receipt rule.</p> <p>For information
          * about setting up receipt rules, see the <a
@@ -696,6 +854,11 @@ namespace Model
          */
         virtual void DescribeReceiptRuleAsync(const Model::DescribeReceiptRuleRequest& request, const DescribeReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReceiptRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeReceiptRuleAsync(Model::DescribeReceiptRuleRequest&& request, const DescribeReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the details of the specified receipt rule set.</p> <p>For information
          * about managing receipt rule sets, see the <a
@@ -716,6 +879,11 @@ namespace Model
          */
         virtual Model::DescribeReceiptRuleSetOutcomeCallable DescribeReceiptRuleSetCallable(const Model::DescribeReceiptRuleSetRequest& request) const;
 
+        /**
+         * Same as DescribeReceiptRuleSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeReceiptRuleSetOutcomeCallable DescribeReceiptRuleSetCallable(Model::DescribeReceiptRuleSetRequest&& request) const;
+
         /**
          * <p>Returns the details of the specified receipt rule set.</p> <p>For information
          * about managing receipt rule sets, see the <a
@@ -727,6 +895,11 @@ namespace Model
          */
         virtual void DescribeReceiptRuleSetAsync(const Model::DescribeReceiptRuleSetRequest& request, const DescribeReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReceiptRuleSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeReceiptRuleSetAsync(Model::DescribeReceiptRuleSetRequest&& request, const DescribeReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the current status of Easy DKIM signing for an entity. For domain
          * name identities, this action also returns the DKIM tokens that are required for
@@ -767,6 +940,11 @@ namespace Model
          */
         virtual Model::GetIdentityDkimAttributesOutcomeCallable GetIdentityDkimAttributesCallable(const Model::GetIdentityDkimAttributesRequest& request) const;
 
+        /**
+         * Same as GetIdentityDkimAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetIdentityDkimAttributesOutcomeCallable GetIdentityDkimAttributesCallable(Model::GetIdentityDkimAttributesRequest&& request) const;
+
         /**
          * <p>Returns the current status of Easy DKIM signing for an entity. For domain
          * name identities, this action also returns the DKIM tokens that are required for
@@ -788,6 +966,11 @@ namespace Model
          */
         virtual void GetIdentityDkimAttributesAsync(const Model::GetIdentityDkimAttributesRequest& request, const GetIdentityDkimAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdentityDkimAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetIdentityDkimAttributesAsync(Model::GetIdentityDkimAttributesRequest&& request, const GetIdentityDkimAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Given a list of verified identities (email addresses and/or domains), returns
          * a structure describing identity notification attributes.</p> <p>This action is
@@ -812,6 +995,11 @@ namespace Model
          */
         virtual Model::GetIdentityNotificationAttributesOutcomeCallable GetIdentityNotificationAttributesCallable(const Model::GetIdentityNotificationAttributesRequest& request) const;
 
+        /**
+         * Same as GetIdentityNotificationAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetIdentityNotificationAttributesOutcomeCallable GetIdentityNotificationAttributesCallable(Model::GetIdentityNotificationAttributesRequest&& request) const;
+
         /**
          * <p>Given a list of verified identities (email addresses and/or domains), returns
          * a structure describing identity notification attributes.</p> <p>This action is
@@ -825,6 +1013,11 @@ namespace Model
          */
         virtual void GetIdentityNotificationAttributesAsync(const Model::GetIdentityNotificationAttributesRequest& request, const GetIdentityNotificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdentityNotificationAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetIdentityNotificationAttributesAsync(Model::GetIdentityNotificationAttributesRequest&& request, const GetIdentityNotificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the requested sending authorization policies for the given identity
          * (email address or domain). The policies are returned as a map of policy names to
@@ -855,6 +1048,11 @@ namespace Model
          */
         virtual Model::GetIdentityPoliciesOutcomeCallable GetIdentityPoliciesCallable(const Model::GetIdentityPoliciesRequest& request) const;
 
+        /**
+         * Same as GetIdentityPoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetIdentityPoliciesOutcomeCallable GetIdentityPoliciesCallable(Model::GetIdentityPoliciesRequest&& request) const;
+
         /**
          * <p>Returns the requested sending authorization policies for the given identity
          * (email address or domain). The policies are returned as a map of policy names to
@@ -871,6 +1069,11 @@ namespace Model
          */
         virtual void GetIdentityPoliciesAsync(const Model::GetIdentityPoliciesRequest& request, const GetIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdentityPoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetIdentityPoliciesAsync(Model::GetIdentityPoliciesRequest&& request, const GetIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Given a list of identities (email addresses and/or domains), returns the
          * verification status and (for domain identities) the verification token for each
@@ -889,6 +1092,11 @@ namespace Model
          */
         virtual Model::GetIdentityVerificationAttributesOutcomeCallable GetIdentityVerificationAttributesCallable(const Model::GetIdentityVerificationAttributesRequest& request) const;
 
+        /**
+         * Same as GetIdentityVerificationAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetIdentityVerificationAttributesOutcomeCallable GetIdentityVerificationAttributesCallable(Model::GetIdentityVerificationAttributesRequest&& request) const;
+
         /**
          * <p>Given a list of identities (email addresses and/or domains), returns the
          * verification status and (for domain identities) the verification token for each
@@ -899,6 +1107,11 @@ namespace Model
          */
         virtual void GetIdentityVerificationAttributesAsync(const Model::GetIdentityVerificationAttributesRequest& request, const GetIdentityVerificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIdentityVerificationAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetIdentityVerificationAttributesAsync(Model::GetIdentityVerificationAttributesRequest&& request, const GetIdentityVerificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the user's current sending limits.</p> <p>This action is throttled at
          * one request per second.</p>
@@ -913,6 +1126,11 @@ namespace Model
          */
         virtual Model::GetSendQuotaOutcomeCallable GetSendQuotaCallable(const Model::GetSendQuotaRequest& request) const;
 
+        /**
+         * Same as GetSendQuotaCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetSendQuotaOutcomeCallable GetSendQuotaCallable(Model::GetSendQuotaRequest&& request) const;
+
         /**
          * <p>Returns the user's current sending limits.</p> <p>This action is throttled at
          * one request per second.</p>
@@ -921,6 +1139,11 @@ namespace Model
          */
         virtual void GetSendQuotaAsync(const Model::GetSendQuotaRequest& request, const GetSendQuotaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSendQuotaAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetSendQuotaAsync(Model::GetSendQuotaRequest&& request, const GetSendQuotaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the user's sending statistics. The result is a list of data points,
          * representing the last two weeks of sending activity. </p> <p>Each data point in
@@ -939,6 +1162,11 @@ namespace Model
          */
         virtual Model::GetSendStatisticsOutcomeCallable GetSendStatisticsCallable(const Model::GetSendStatisticsRequest& request) const;
 
+        /**
+         * Same as GetSendStatisticsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetSendStatisticsOutcomeCallable GetSendStatisticsCallable(Model::GetSendStatisticsRequest&& request) const;
+
         /**
          * <p>Returns the user's sending statistics. The result is a list of data points,
          * representing the last two weeks of sending activity. </p> <p>Each data point in
@@ -949,6 +1177,11 @@ namespace Model
          */
         virtual void GetSendStatisticsAsync(const Model::GetSendStatisticsRequest& request, const GetSendStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSendStatisticsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetSendStatisticsAsync(Model::GetSendStatisticsRequest&& request, const GetSendStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list containing all of the identities (email addresses and domains)
          * for a specific AWS Account, regardless of verification status.</p> <p>This
@@ -965,6 +1198,11 @@ namespace Model
          */
         virtual Model::ListIdentitiesOutcomeCallable ListIdentitiesCallable(const Model::ListIdentitiesRequest& request) const;
 
+        /**
+         * Same as ListIdentitiesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListIdentitiesOutcomeCallable ListIdentitiesCallable(Model::ListIdentitiesRequest&& request) const;
+
         /**
          * <p>Returns a list containing all of the identities (email addresses and domains)
          * for a specific AWS Account, regardless of verification status.</p> <p>This
@@ -974,6 +1212,11 @@ namespace Model
          */
         virtual void ListIdentitiesAsync(const Model::ListIdentitiesRequest& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListIdentitiesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListIdentitiesAsync(Model::ListIdentitiesRequest&& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of sending authorization policies that are attached to the
          * given identity (email address or domain). This API returns only a list. If you
@@ -1006,6 +1249,11 @@ namespace Model
          */
         virtual Model::ListIdentityPoliciesOutcomeCallable ListIdentityPoliciesCallable(const Model::ListIdentityPoliciesRequest& request) const;
 
+        /**
+         * Same as ListIdentityPoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListIdentityPoliciesOutcomeCallable ListIdentityPoliciesCallable(Model::ListIdentityPoliciesRequest&& request) const;
+
         /**
          * <p>Returns a list of sending authorization policies that are attached to the
          * given identity (email address or domain). This API returns only a list. If you
@@ -1023,6 +1271,11 @@ namespace Model
          */
         virtual void ListIdentityPoliciesAsync(const Model::ListIdentityPoliciesRequest& request, const ListIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListIdentityPoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListIdentityPoliciesAsync(Model::ListIdentityPoliciesRequest&& request, const ListIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the IP address filters associated with your account.</p> <p>For
          * information about managing IP address filters, see the <a
@@ -1043,6 +1296,11 @@ namespace Model
          */
         virtual Model::ListReceiptFiltersOutcomeCallable ListReceiptFiltersCallable(const Model::ListReceiptFiltersRequest& request) const;
 
+        /**
+         * Same as ListReceiptFiltersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListReceiptFiltersOutcomeCallable ListReceiptFiltersCallable(Model::ListReceiptFiltersRequest&& request) const;
+
         /**
          * <p>Lists the IP address filters associated with your account.</p> <p>For
          * information about managing IP address filters, see the <a
@@ -1054,6 +1312,11 @@ namespace Model
          */
         virtual void ListReceiptFiltersAsync(const Model::ListReceiptFiltersRequest& request, const ListReceiptFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListReceiptFiltersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListReceiptFiltersAsync(Model::ListReceiptFiltersRequest&& request, const ListReceiptFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the receipt rule sets that exist under your AWS account. If there are
          * additional receipt rule sets to be retrieved, you will receive a
@@ -1080,6 +1343,11 @@ namespace Model
          */
         virtual Model::ListReceiptRuleSetsOutcomeCallable ListReceiptRuleSetsCallable(const Model::ListReceiptRuleSetsRequest& request) const;
 
+        /**
+         * Same as ListReceiptRuleSetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListReceiptRuleSetsOutcomeCallable ListReceiptRuleSetsCallable(Model::ListReceiptRuleSetsRequest&& request) const;
+
         /**
          * <p>Lists the receipt rule sets that exist under your AWS account. If there are
          * additional receipt rule sets to be retrieved, you will receive a
@@ -1094,6 +1362,11 @@ namespace Model
          */
         virtual void ListReceiptRuleSetsAsync(const Model::ListReceiptRuleSetsRequest& request, const ListReceiptRuleSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListReceiptRuleSetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListReceiptRuleSetsAsync(Model::ListReceiptRuleSetsRequest&& request, const ListReceiptRuleSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list containing all of the email addresses that have been
          * verified.</p> <important>The ListVerifiedEmailAddresses action is deprecated as
@@ -1114,6 +1387,11 @@ namespace Model
          */
         virtual Model::ListVerifiedEmailAddressesOutcomeCallable ListVerifiedEmailAddressesCallable(const Model::ListVerifiedEmailAddressesRequest& request) const;
 
+        /**
+         * Same as ListVerifiedEmailAddressesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListVerifiedEmailAddressesOutcomeCallable ListVerifiedEmailAddressesCallable(Model::ListVerifiedEmailAddressesRequest&& request) const;
+
         /**
          * <p>Returns a list containing all of the email addresses that have been
          * verified.</p> <important>The ListVerifiedEmailAddresses action is deprecated as
@@ -1125,6 +1403,11 @@ namespace Model
          */
         virtual void ListVerifiedEmailAddressesAsync(const Model::ListVerifiedEmailAddressesRequest& request, const ListVerifiedEmailAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListVerifiedEmailAddressesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListVerifiedEmailAddressesAsync(Model::ListVerifiedEmailAddressesRequest&& request, const ListVerifiedEmailAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds or updates a sending authorization policy for the specified identity
          * (email address or domain).</p> <note>This API is for the identity owner only. If
@@ -1153,6 +1436,11 @@ namespace Model
          */
         virtual Model::PutIdentityPolicyOutcomeCallable PutIdentityPolicyCallable(const Model::PutIdentityPolicyRequest& request) const;
 
+        /**
+         * Same as PutIdentityPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutIdentityPolicyOutcomeCallable PutIdentityPolicyCallable(Model::PutIdentityPolicyRequest&& request) const;
+
         /**
          * <p>Adds or updates a sending authorization policy for the specified identity
          * (email address or domain).</p> <note>This API is for the identity owner only. If
@@ -1168,6 +1456,11 @@ namespace Model
          */
         virtual void PutIdentityPolicyAsync(const Model::PutIdentityPolicyRequest& request, const PutIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutIdentityPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutIdentityPolicyAsync(Model::PutIdentityPolicyRequest&& request, const PutIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Reorders the receipt rules within a receipt rule set.</p> <note>All of the
          * rules in the rule set must be represented in this request. That is, this API
@@ -1194,6 +1487,11 @@ namespace Model
          */
         virtual Model::ReorderReceiptRuleSetOutcomeCallable ReorderReceiptRuleSetCallable(const Model::ReorderReceiptRuleSetRequest& request) const;
 
+        /**
+         * Same as ReorderReceiptRuleSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReorderReceiptRuleSetOutcomeCallable ReorderReceiptRuleSetCallable(Model::ReorderReceiptRuleSetRequest&& request) const;
+
         /**
          * <p>Reorders the receipt rules within a receipt rule set.</p> <note>All of the
          * rules in the rule set must be represented in this request. That is, this API
@@ -1208,6 +1506,11 @@ namespace Model
          */
         virtual void ReorderReceiptRuleSetAsync(const Model::ReorderReceiptRuleSetRequest& request, const ReorderReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReorderReceiptRuleSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReorderReceiptRuleSetAsync(Model::ReorderReceiptRuleSetRequest&& request, const ReorderReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates and sends a bounce message to the sender of an email you received
          * through Amazon SES. You can only use this API on an email up to 24 hours after
@@ -1234,6 +1537,11 @@ namespace Model
          */
         virtual Model::SendBounceOutcomeCallable SendBounceCallable(const Model::SendBounceRequest& request) const;
 
+        /**
+         * Same as SendBounceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SendBounceOutcomeCallable SendBounceCallable(Model::SendBounceRequest&& request) const;
+
         /**
          * <p>Generates and sends a bounce message to the sender of an email you received
          * through Amazon SES. You can only use this API on an email up to 24 hours after
@@ -1248,6 +1556,11 @@ namespace Model
          */
         virtual void SendBounceAsync(const Model::SendBounceRequest& request, const SendBounceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SendBounceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SendBounceAsync(Model::SendBounceRequest&& request, const SendBounceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Composes an email message based on input data, and then immediately queues
          * the message for sending. </p> <p>There are several important points to know
@@ -1298,6 +1611,11 @@ namespace Model
          */
         virtual Model::SendEmailOutcomeCallable SendEmailCallable(const Model::SendEmailRequest& request) const;
 
+        /**
+         * Same as SendEmailCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SendEmailOutcomeCallable SendEmailCallable(Model::SendEmailRequest&& request) const;
+
         /**
          * <p>Composes an email message based on input data, and then immediately queues
          * the message for sending. </p> <p>There are several important points to know
@@ -1324,6 +1642,11 @@ namespace Model
          */
         virtual void SendEmailAsync(const Model::SendEmailRequest& request, const SendEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SendEmailAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SendEmailAsync(Model::SendEmailRequest&& request, const SendEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sends an email message, with header and content specified by the client. The
          * <code>SendRawEmail</code> action is useful for sending multipart MIME emails.
@@ -1422,6 +1745,11 @@ namespace Model
          */
         virtual Model::SendRawEmailOutcomeCallable SendRawEmailCallable(const Model::SendRawEmailRequest& request) const;
 
+        /**
+         * Same as SendRawEmailCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SendRawEmailOutcomeCallable SendRawEmailCallable(Model::SendRawEmailRequest&& request) const;
+
         /**
          * <p>Sends an email message, with header and content specified by the client. The
          * <code>SendRawEmail</code> action is useful for sending multipart MIME emails.
@@ -1472,6 +1800,11 @@ namespace Model
          */
         virtual void SendRawEmailAsync(const Model::SendRawEmailRequest& request, const SendRawEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SendRawEmailAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SendRawEmailAsync(Model::SendRawEmailRequest&& request, const SendRawEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the specified receipt rule set as the active receipt rule set.</p>
          * <note>To disable your email-receiving through Amazon SES completely, you can
@@ -1496,6 +1829,11 @@ namespace Model
          */
         virtual Model::SetActiveReceiptRuleSetOutcomeCallable SetActiveReceiptRuleSetCallable(const Model::SetActiveReceiptRuleSetRequest& request) const;
 
+        /**
+         * Same as SetActiveReceiptRuleSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetActiveReceiptRuleSetOutcomeCallable SetActiveReceiptRuleSetCallable(Model::SetActiveReceiptRuleSetRequest&& request) const;
+
         /**
          * <p>Sets the specified receipt rule set as the active receipt rule set.</p>
          * <note>To disable your email-receiving through Amazon SES completely, you can
@@ -1509,6 +1847,11 @@ namespace Model
          */
         virtual void SetActiveReceiptRuleSetAsync(const Model::SetActiveReceiptRuleSetRequest& request, const SetActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetActiveReceiptRuleSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetActiveReceiptRuleSetAsync(Model::SetActiveReceiptRuleSetRequest&& request, const SetActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables or disables Easy DKIM signing of email sent from an identity:</p>
          * <ul> <li>If Easy DKIM signing is enabled for a domain name identity (e.g.,
@@ -1545,6 +1888,11 @@ namespace Model
          */
         virtual Model::SetIdentityDkimEnabledOutcomeCallable SetIdentityDkimEnabledCallable(const Model::SetIdentityDkimEnabledRequest& request) const;
 
+        /**
+         * Same as SetIdentityDkimEnabledCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetIdentityDkimEnabledOutcomeCallable SetIdentityDkimEnabledCallable(Model::SetIdentityDkimEnabledRequest&& request) const;
+
         /**
          * <p>Enables or disables Easy DKIM signing of email sent from an identity:</p>
          * <ul> <li>If Easy DKIM signing is enabled for a domain name identity (e.g.,
@@ -1564,6 +1912,11 @@ namespace Model
          */
         virtual void SetIdentityDkimEnabledAsync(const Model::SetIdentityDkimEnabledRequest& request, const SetIdentityDkimEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetIdentityDkimEnabledAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetIdentityDkimEnabledAsync(Model::SetIdentityDkimEnabledRequest&& request, const SetIdentityDkimEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Given an identity (email address or domain), enables or disables whether
          * Amazon SES forwards bounce and complaint notifications as email. Feedback
@@ -1594,6 +1947,11 @@ namespace Model
          */
         virtual Model::SetIdentityFeedbackForwardingEnabledOutcomeCallable SetIdentityFeedbackForwardingEnabledCallable(const Model::SetIdentityFeedbackForwardingEnabledRequest& request) const;
 
+        /**
+         * Same as SetIdentityFeedbackForwardingEnabledCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetIdentityFeedbackForwardingEnabledOutcomeCallable SetIdentityFeedbackForwardingEnabledCallable(Model::SetIdentityFeedbackForwardingEnabledRequest&& request) const;
+
         /**
          * <p>Given an identity (email address or domain), enables or disables whether
          * Amazon SES forwards bounce and complaint notifications as email. Feedback
@@ -1610,6 +1968,11 @@ namespace Model
          */
         virtual void SetIdentityFeedbackForwardingEnabledAsync(const Model::SetIdentityFeedbackForwardingEnabledRequest& request, const SetIdentityFeedbackForwardingEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetIdentityFeedbackForwardingEnabledAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetIdentityFeedbackForwardingEnabledAsync(Model::SetIdentityFeedbackForwardingEnabledRequest&& request, const SetIdentityFeedbackForwardingEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Given an identity (email address or domain), sets the Amazon Simple
          * Notification Service (Amazon SNS) topic to which Amazon SES will publish bounce,
@@ -1640,6 +2003,11 @@ namespace Model
          */
         virtual Model::SetIdentityNotificationTopicOutcomeCallable SetIdentityNotificationTopicCallable(const Model::SetIdentityNotificationTopicRequest& request) const;
 
+        /**
+         * Same as SetIdentityNotificationTopicCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetIdentityNotificationTopicOutcomeCallable SetIdentityNotificationTopicCallable(Model::SetIdentityNotificationTopicRequest&& request) const;
+
         /**
          * <p>Given an identity (email address or domain), sets the Amazon Simple
          * Notification Service (Amazon SNS) topic to which Amazon SES will publish bounce,
@@ -1656,6 +2024,11 @@ namespace Model
          */
         virtual void SetIdentityNotificationTopicAsync(const Model::SetIdentityNotificationTopicRequest& request, const SetIdentityNotificationTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetIdentityNotificationTopicAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetIdentityNotificationTopicAsync(Model::SetIdentityNotificationTopicRequest&& request, const SetIdentityNotificationTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the position of the specified receipt rule in the receipt rule set.</p>
          * <p>For information about managing receipt rules, see the <a
@@ -1676,6 +2049,11 @@ namespace Model
          */
         virtual Model::SetReceiptRulePositionOutcomeCallable SetReceiptRulePositionCallable(const Model::SetReceiptRulePositionRequest& request) const;
 
+        /**
+         * Same as SetReceiptRulePositionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetReceiptRulePositionOutcomeCallable SetReceiptRulePositionCallable(Model::SetReceiptRulePositionRequest&& request) const;
+
         /**
          * <p>Sets the position of the specified receipt rule in the receipt rule set.</p>
          * <p>For information about managing receipt rules, see the <a
@@ -1687,6 +2065,11 @@ namespace Model
          */
         virtual void SetReceiptRulePositionAsync(const Model::SetReceiptRulePositionRequest& request, const SetReceiptRulePositionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetReceiptRulePositionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetReceiptRulePositionAsync(Model::SetReceiptRulePositionRequest&& request, const SetReceiptRulePositionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a receipt rule.</p> <p>For information about managing receipt rules,
          * see the <a
@@ -1707,6 +2090,11 @@ namespace Model
          */
         virtual Model::UpdateReceiptRuleOutcomeCallable UpdateReceiptRuleCallable(const Model::UpdateReceiptRuleRequest& request) const;
 
+        /**
+         * Same as UpdateReceiptRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateReceiptRuleOutcomeCallable UpdateReceiptRuleCallable(Model::UpdateReceiptRuleRequest&& request) const;
+
         /**
          * <p>Updates a receipt rule.</p> <p>For information about managing receipt rules,
          * see the <a
@@ -1718,6 +2106,11 @@ namespace Model
          */
         virtual void UpdateReceiptRuleAsync(const Model::UpdateReceiptRuleRequest& request, const UpdateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateReceiptRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateReceiptRuleAsync(Model::UpdateReceiptRuleRequest&& request, const UpdateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a set of DKIM tokens for a domain. DKIM <i>tokens</i> are character
          * strings that represent your domain's identity. Using these tokens, you will need
@@ -1752,6 +2145,11 @@ namespace Model
          */
         virtual Model::VerifyDomainDkimOutcomeCallable VerifyDomainDkimCallable(const Model::VerifyDomainDkimRequest& request) const;
 
+        /**
+         * Same as VerifyDomainDkimCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::VerifyDomainDkimOutcomeCallable VerifyDomainDkimCallable(Model::VerifyDomainDkimRequest&& request) const;
+
         /**
          * <p>Returns a set of DKIM tokens for a domain. DKIM <i>tokens</i> are character
          * strings that represent your domain's identity. Using these tokens, you will need
@@ -1770,6 +2168,11 @@ namespace Model
          */
         virtual void VerifyDomainDkimAsync(const Model::VerifyDomainDkimRequest& request, const VerifyDomainDkimResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as VerifyDomainDkimAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void VerifyDomainDkimAsync(Model::VerifyDomainDkimRequest&& request, const VerifyDomainDkimResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Verifies a domain.</p> <p>This action is throttled at one request per
          * second.</p>
@@ -1784,6 +2187,11 @@ namespace Model
          */
         virtual Model::VerifyDomainIdentityOutcomeCallable VerifyDomainIdentityCallable(const Model::VerifyDomainIdentityRequest& request) const;
 
+        /**
+         * Same as VerifyDomainIdentityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::VerifyDomainIdentityOutcomeCallable VerifyDomainIdentityCallable(Model::VerifyDomainIdentityRequest&& request) const;
+
         /**
          * <p>Verifies a domain.</p> <p>This action is throttled at one request per
          * second.</p>
@@ -1792,6 +2200,11 @@ namespace Model
          */
         virtual void VerifyDomainIdentityAsync(const Model::VerifyDomainIdentityRequest& request, const VerifyDomainIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as VerifyDomainIdentityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void VerifyDomainIdentityAsync(Model::VerifyDomainIdentityRequest&& request, const VerifyDomainIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Verifies an email address. This action causes a confirmation email message to
          * be sent to the specified address.</p> <important>The VerifyEmailAddress action
@@ -1812,6 +2225,11 @@ namespace Model
          */
         virtual Model::VerifyEmailAddressOutcomeCallable VerifyEmailAddressCallable(const Model::VerifyEmailAddressRequest& request) const;
 
+        /**
+         * Same as VerifyEmailAddressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::VerifyEmailAddressOutcomeCallable VerifyEmailAddressCallable(Model::VerifyEmailAddressRequest&& request) const;
+
         /**
          * <p>Verifies an email address. This action causes a confirmation email message to
          * be sent to the specified address.</p> <important>The VerifyEmailAddress action
@@ -1823,6 +2241,11 @@ namespace Model
          */
         virtual void VerifyEmailAddressAsync(const Model::VerifyEmailAddressRequest& request, const VerifyEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as VerifyEmailAddressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void VerifyEmailAddressAsync(Model::VerifyEmailAddressRequest&& request, const VerifyEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Verifies an email address. This action causes a confirmation email message to
          * be sent to the specified address.</p> <p>This action is throttled at one request
@@ -1839,6 +2262,11 @@ namespace Model
          */
         virtual Model::VerifyEmailIdentityOutcomeCallable VerifyEmailIdentityCallable(const Model::VerifyEmailIdentityRequest& request) const;
 
+        /**
+         * Same as VerifyEmailIdentityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::VerifyEmailIdentityOutcomeCallable VerifyEmailIdentityCallable(Model::VerifyEmailIdentityRequest&& request) const;
+
         /**
          * <p>Verifies an email address. This action causes a confirmation email message to
          * be sent to the specified address.</p> <p>This action is throttled at one request
@@ -1848,6 +2276,96 @@ namespace Model
          */
         virtual void VerifyEmailIdentityAsync(const Model::VerifyEmailIdentityRequest& request, const VerifyEmailIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as VerifyEmailIdentityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void VerifyEmailIdentityAsync(Model::VerifyEmailIdentityRequest&& request, const VerifyEmailIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CloneReceiptRuleSetOutcome> CloneReceiptRuleSetAwaitable(const Model::CloneReceiptRuleSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::CloneReceiptRuleSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CloneReceiptRuleSetOutcome> CloneReceiptRuleSetAwaitable(Model::CloneReceiptRuleSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::CloneReceiptRuleSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateReceiptFilterOutcome> CreateReceiptFilterAwaitable(const Model::CreateReceiptFilterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::CreateReceiptFilter, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateReceiptFilterOutcome> CreateReceiptFilterAwaitable(Model::CreateReceiptFilterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::CreateReceiptFilter, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateReceiptRuleOutcome> CreateReceiptRuleAwaitable(const Model::CreateReceiptRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::CreateReceiptRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateReceiptRuleOutcome> CreateReceiptRuleAwaitable(Model::CreateReceiptRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::CreateReceiptRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateReceiptRuleSetOutcome> CreateReceiptRuleSetAwaitable(const Model::CreateReceiptRuleSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::CreateReceiptRuleSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateReceiptRuleSetOutcome> CreateReceiptRuleSetAwaitable(Model::CreateReceiptRuleSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::CreateReceiptRuleSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIdentityOutcome> DeleteIdentityAwaitable(const Model::DeleteIdentityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DeleteIdentity, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIdentityOutcome> DeleteIdentityAwaitable(Model::DeleteIdentityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DeleteIdentity, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIdentityPolicyOutcome> DeleteIdentityPolicyAwaitable(const Model::DeleteIdentityPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DeleteIdentityPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIdentityPolicyOutcome> DeleteIdentityPolicyAwaitable(Model::DeleteIdentityPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DeleteIdentityPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteReceiptFilterOutcome> DeleteReceiptFilterAwaitable(const Model::DeleteReceiptFilterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DeleteReceiptFilter, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteReceiptFilterOutcome> DeleteReceiptFilterAwaitable(Model::DeleteReceiptFilterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DeleteReceiptFilter, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteReceiptRuleOutcome> DeleteReceiptRuleAwaitable(const Model::DeleteReceiptRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DeleteReceiptRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteReceiptRuleOutcome> DeleteReceiptRuleAwaitable(Model::DeleteReceiptRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DeleteReceiptRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteReceiptRuleSetOutcome> DeleteReceiptRuleSetAwaitable(const Model::DeleteReceiptRuleSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DeleteReceiptRuleSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteReceiptRuleSetOutcome> DeleteReceiptRuleSetAwaitable(Model::DeleteReceiptRuleSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DeleteReceiptRuleSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVerifiedEmailAddressOutcome> DeleteVerifiedEmailAddressAwaitable(const Model::DeleteVerifiedEmailAddressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DeleteVerifiedEmailAddress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVerifiedEmailAddressOutcome> DeleteVerifiedEmailAddressAwaitable(Model::DeleteVerifiedEmailAddressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DeleteVerifiedEmailAddress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeActiveReceiptRuleSetOutcome> DescribeActiveReceiptRuleSetAwaitable(const Model::DescribeActiveReceiptRuleSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DescribeActiveReceiptRuleSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeActiveReceiptRuleSetOutcome> DescribeActiveReceiptRuleSetAwaitable(Model::DescribeActiveReceiptRuleSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DescribeActiveReceiptRuleSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReceiptRuleOutcome> DescribeReceiptRuleAwaitable(const Model::DescribeReceiptRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DescribeReceiptRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReceiptRuleOutcome> DescribeReceiptRuleAwaitable(Model::DescribeReceiptRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DescribeReceiptRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReceiptRuleSetOutcome> DescribeReceiptRuleSetAwaitable(const Model::DescribeReceiptRuleSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DescribeReceiptRuleSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReceiptRuleSetOutcome> DescribeReceiptRuleSetAwaitable(Model::DescribeReceiptRuleSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::DescribeReceiptRuleSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIdentityDkimAttributesOutcome> GetIdentityDkimAttributesAwaitable(const Model::GetIdentityDkimAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::GetIdentityDkimAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIdentityDkimAttributesOutcome> GetIdentityDkimAttributesAwaitable(Model::GetIdentityDkimAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::GetIdentityDkimAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIdentityNotificationAttributesOutcome> GetIdentityNotificationAttributesAwaitable(const Model::GetIdentityNotificationAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::GetIdentityNotificationAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIdentityNotificationAttributesOutcome> GetIdentityNotificationAttributesAwaitable(Model::GetIdentityNotificationAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::GetIdentityNotificationAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIdentityPoliciesOutcome> GetIdentityPoliciesAwaitable(const Model::GetIdentityPoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::GetIdentityPolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIdentityPoliciesOutcome> GetIdentityPoliciesAwaitable(Model::GetIdentityPoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::GetIdentityPolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIdentityVerificationAttributesOutcome> GetIdentityVerificationAttributesAwaitable(const Model::GetIdentityVerificationAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::GetIdentityVerificationAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIdentityVerificationAttributesOutcome> GetIdentityVerificationAttributesAwaitable(Model::GetIdentityVerificationAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::GetIdentityVerificationAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSendQuotaOutcome> GetSendQuotaAwaitable(const Model::GetSendQuotaRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::GetSendQuota, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSendQuotaOutcome> GetSendQuotaAwaitable(Model::GetSendQuotaRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::GetSendQuota, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSendStatisticsOutcome> GetSendStatisticsAwaitable(const Model::GetSendStatisticsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::GetSendStatistics, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSendStatisticsOutcome> GetSendStatisticsAwaitable(Model::GetSendStatisticsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::GetSendStatistics, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListIdentitiesOutcome> ListIdentitiesAwaitable(const Model::ListIdentitiesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::ListIdentities, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListIdentitiesOutcome> ListIdentitiesAwaitable(Model::ListIdentitiesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::ListIdentities, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListIdentityPoliciesOutcome> ListIdentityPoliciesAwaitable(const Model::ListIdentityPoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::ListIdentityPolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListIdentityPoliciesOutcome> ListIdentityPoliciesAwaitable(Model::ListIdentityPoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::ListIdentityPolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListReceiptFiltersOutcome> ListReceiptFiltersAwaitable(const Model::ListReceiptFiltersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::ListReceiptFilters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListReceiptFiltersOutcome> ListReceiptFiltersAwaitable(Model::ListReceiptFiltersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::ListReceiptFilters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListReceiptRuleSetsOutcome> ListReceiptRuleSetsAwaitable(const Model::ListReceiptRuleSetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::ListReceiptRuleSets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListReceiptRuleSetsOutcome> ListReceiptRuleSetsAwaitable(Model::ListReceiptRuleSetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::ListReceiptRuleSets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListVerifiedEmailAddressesOutcome> ListVerifiedEmailAddressesAwaitable(const Model::ListVerifiedEmailAddressesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::ListVerifiedEmailAddresses, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListVerifiedEmailAddressesOutcome> ListVerifiedEmailAddressesAwaitable(Model::ListVerifiedEmailAddressesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::ListVerifiedEmailAddresses, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutIdentityPolicyOutcome> PutIdentityPolicyAwaitable(const Model::PutIdentityPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::PutIdentityPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutIdentityPolicyOutcome> PutIdentityPolicyAwaitable(Model::PutIdentityPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::PutIdentityPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReorderReceiptRuleSetOutcome> ReorderReceiptRuleSetAwaitable(const Model::ReorderReceiptRuleSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::ReorderReceiptRuleSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReorderReceiptRuleSetOutcome> ReorderReceiptRuleSetAwaitable(Model::ReorderReceiptRuleSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::ReorderReceiptRuleSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SendBounceOutcome> SendBounceAwaitable(const Model::SendBounceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SendBounce, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SendBounceOutcome> SendBounceAwaitable(Model::SendBounceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SendBounce, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SendEmailOutcome> SendEmailAwaitable(const Model::SendEmailRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SendEmail, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SendEmailOutcome> SendEmailAwaitable(Model::SendEmailRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SendEmail, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SendRawEmailOutcome> SendRawEmailAwaitable(const Model::SendRawEmailRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SendRawEmail, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SendRawEmailOutcome> SendRawEmailAwaitable(Model::SendRawEmailRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SendRawEmail, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetActiveReceiptRuleSetOutcome> SetActiveReceiptRuleSetAwaitable(const Model::SetActiveReceiptRuleSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SetActiveReceiptRuleSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetActiveReceiptRuleSetOutcome> SetActiveReceiptRuleSetAwaitable(Model::SetActiveReceiptRuleSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SetActiveReceiptRuleSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetIdentityDkimEnabledOutcome> SetIdentityDkimEnabledAwaitable(const Model::SetIdentityDkimEnabledRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SetIdentityDkimEnabled, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetIdentityDkimEnabledOutcome> SetIdentityDkimEnabledAwaitable(Model::SetIdentityDkimEnabledRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SetIdentityDkimEnabled, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetIdentityFeedbackForwardingEnabledOutcome> SetIdentityFeedbackForwardingEnabledAwaitable(const Model::SetIdentityFeedbackForwardingEnabledRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SetIdentityFeedbackForwardingEnabled, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetIdentityFeedbackForwardingEnabledOutcome> SetIdentityFeedbackForwardingEnabledAwaitable(Model::SetIdentityFeedbackForwardingEnabledRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SetIdentityFeedbackForwardingEnabled, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetIdentityNotificationTopicOutcome> SetIdentityNotificationTopicAwaitable(const Model::SetIdentityNotificationTopicRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SetIdentityNotificationTopic, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetIdentityNotificationTopicOutcome> SetIdentityNotificationTopicAwaitable(Model::SetIdentityNotificationTopicRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SetIdentityNotificationTopic, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetReceiptRulePositionOutcome> SetReceiptRulePositionAwaitable(const Model::SetReceiptRulePositionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SetReceiptRulePosition, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetReceiptRulePositionOutcome> SetReceiptRulePositionAwaitable(Model::SetReceiptRulePositionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::SetReceiptRulePosition, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateReceiptRuleOutcome> UpdateReceiptRuleAwaitable(const Model::UpdateReceiptRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::UpdateReceiptRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateReceiptRuleOutcome> UpdateReceiptRuleAwaitable(Model::UpdateReceiptRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::UpdateReceiptRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::VerifyDomainDkimOutcome> VerifyDomainDkimAwaitable(const Model::VerifyDomainDkimRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::VerifyDomainDkim, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::VerifyDomainDkimOutcome> VerifyDomainDkimAwaitable(Model::VerifyDomainDkimRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::VerifyDomainDkim, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::VerifyDomainIdentityOutcome> VerifyDomainIdentityAwaitable(const Model::VerifyDomainIdentityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::VerifyDomainIdentity, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::VerifyDomainIdentityOutcome> VerifyDomainIdentityAwaitable(Model::VerifyDomainIdentityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::VerifyDomainIdentity, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::VerifyEmailAddressOutcome> VerifyEmailAddressAwaitable(const Model::VerifyEmailAddressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::VerifyEmailAddress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::VerifyEmailAddressOutcome> VerifyEmailAddressAwaitable(Model::VerifyEmailAddressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::VerifyEmailAddress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::VerifyEmailIdentityOutcome> VerifyEmailIdentityAwaitable(const Model::VerifyEmailIdentityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::VerifyEmailIdentity, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::VerifyEmailIdentityOutcome> VerifyEmailIdentityAwaitable(Model::VerifyEmailIdentityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SESClient::VerifyEmailIdentity, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
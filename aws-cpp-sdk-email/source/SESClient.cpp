@@ -146,12 +146,22 @@ CloneReceiptRuleSetOutcome SESClient::CloneReceiptRuleSet(const CloneReceiptRule
 
 CloneReceiptRuleSetOutcomeCallable SESClient::CloneReceiptRuleSetCallable(const CloneReceiptRuleSetRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::CloneReceiptRuleSet, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::CloneReceiptRuleSet, Aws::Client::RejectedCallOutcome<CloneReceiptRuleSetOutcome>(), this, request);
+}
+
+CloneReceiptRuleSetOutcomeCallable SESClient::CloneReceiptRuleSetCallable(CloneReceiptRuleSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::CloneReceiptRuleSet, Aws::Client::RejectedCallOutcome<CloneReceiptRuleSetOutcome>(), this, std::move(request));
 }
 
 void SESClient::CloneReceiptRuleSetAsync(const CloneReceiptRuleSetRequest& request, const CloneReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::CloneReceiptRuleSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::CloneReceiptRuleSetAsyncHelper, Aws::Client::RejectedAsyncCall<CloneReceiptRuleSetOutcome>(), this, request, handler, context);
+}
+
+void SESClient::CloneReceiptRuleSetAsync(CloneReceiptRuleSetRequest&& request, const CloneReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::CloneReceiptRuleSetAsyncHelper, Aws::Client::RejectedAsyncCall<CloneReceiptRuleSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::CloneReceiptRuleSetAsyncHelper(const CloneReceiptRuleSetRequest& request, const CloneReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -176,12 +186,22 @@ CreateReceiptFilterOutcome SESClient::CreateReceiptFilter(const CreateReceiptFil
 
 CreateReceiptFilterOutcomeCallable SESClient::CreateReceiptFilterCallable(const CreateReceiptFilterRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::CreateReceiptFilter, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::CreateReceiptFilter, Aws::Client::RejectedCallOutcome<CreateReceiptFilterOutcome>(), this, request);
+}
+
+CreateReceiptFilterOutcomeCallable SESClient::CreateReceiptFilterCallable(CreateReceiptFilterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::CreateReceiptFilter, Aws::Client::RejectedCallOutcome<CreateReceiptFilterOutcome>(), this, std::move(request));
 }
 
 void SESClient::CreateReceiptFilterAsync(const CreateReceiptFilterRequest& request, const CreateReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::CreateReceiptFilterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::CreateReceiptFilterAsyncHelper, Aws::Client::RejectedAsyncCall<CreateReceiptFilterOutcome>(), this, request, handler, context);
+}
+
+void SESClient::CreateReceiptFilterAsync(CreateReceiptFilterRequest&& request, const CreateReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::CreateReceiptFilterAsyncHelper, Aws::Client::RejectedAsyncCall<CreateReceiptFilterOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::CreateReceiptFilterAsyncHelper(const CreateReceiptFilterRequest& request, const CreateReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -206,12 +226,22 @@ CreateReceiptRuleOutcome SESClient::CreateReceiptRule(const CreateReceiptRuleReq
 
 CreateReceiptRuleOutcomeCallable SESClient::CreateReceiptRuleCallable(const CreateReceiptRuleRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::CreateReceiptRule, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::CreateReceiptRule, Aws::Client::RejectedCallOutcome<CreateReceiptRuleOutcome>(), this, request);
+}
+
+CreateReceiptRuleOutcomeCallable SESClient::CreateReceiptRuleCallable(CreateReceiptRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::CreateReceiptRule, Aws::Client::RejectedCallOutcome<CreateReceiptRuleOutcome>(), this, std::move(request));
 }
 
 void SESClient::CreateReceiptRuleAsync(const CreateReceiptRuleRequest& request, const CreateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::CreateReceiptRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::CreateReceiptRuleAsyncHelper, Aws::Client::RejectedAsyncCall<CreateReceiptRuleOutcome>(), this, request, handler, context);
+}
+
+void SESClient::CreateReceiptRuleAsync(CreateReceiptRuleRequest&& request, const CreateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::CreateReceiptRuleAsyncHelper, Aws::Client::RejectedAsyncCall<CreateReceiptRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::CreateReceiptRuleAsyncHelper(const CreateReceiptRuleRequest& request, const CreateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -236,12 +266,22 @@ CreateReceiptRuleSetOutcome SESClient::CreateReceiptRuleSet(const CreateReceiptR
 
 CreateReceiptRuleSetOutcomeCallable SESClient::CreateReceiptRuleSetCallable(const CreateReceiptRuleSetRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::CreateReceiptRuleSet, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::CreateReceiptRuleSet, Aws::Client::RejectedCallOutcome<CreateReceiptRuleSetOutcome>(), this, request);
+}
+
+CreateReceiptRuleSetOutcomeCallable SESClient::CreateReceiptRuleSetCallable(CreateReceiptRuleSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::CreateReceiptRuleSet, Aws::Client::RejectedCallOutcome<CreateReceiptRuleSetOutcome>(), this, std::move(request));
 }
 
 void SESClient::CreateReceiptRuleSetAsync(const CreateReceiptRuleSetRequest& request, const CreateReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::CreateReceiptRuleSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::CreateReceiptRuleSetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateReceiptRuleSetOutcome>(), this, request, handler, context);
+}
+
+void SESClient::CreateReceiptRuleSetAsync(CreateReceiptRuleSetRequest&& request, const CreateReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::CreateReceiptRuleSetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateReceiptRuleSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::CreateReceiptRuleSetAsyncHelper(const CreateReceiptRuleSetRequest& request, const CreateReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -266,12 +306,22 @@ DeleteIdentityOutcome SESClient::DeleteIdentity(const DeleteIdentityRequest& req
 
 DeleteIdentityOutcomeCallable SESClient::DeleteIdentityCallable(const DeleteIdentityRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::DeleteIdentity, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::DeleteIdentity, Aws::Client::RejectedCallOutcome<DeleteIdentityOutcome>(), this, request);
+}
+
+DeleteIdentityOutcomeCallable SESClient::DeleteIdentityCallable(DeleteIdentityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::DeleteIdentity, Aws::Client::RejectedCallOutcome<DeleteIdentityOutcome>(), this, std::move(request));
 }
 
 void SESClient::DeleteIdentityAsync(const DeleteIdentityRequest& request, const DeleteIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::DeleteIdentityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::DeleteIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIdentityOutcome>(), this, request, handler, context);
+}
+
+void SESClient::DeleteIdentityAsync(DeleteIdentityRequest&& request, const DeleteIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::DeleteIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIdentityOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::DeleteIdentityAsyncHelper(const DeleteIdentityRequest& request, const DeleteIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -296,12 +346,22 @@ DeleteIdentityPolicyOutcome SESClient::DeleteIdentityPolicy(const DeleteIdentity
 
 DeleteIdentityPolicyOutcomeCallable SESClient::DeleteIdentityPolicyCallable(const DeleteIdentityPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::DeleteIdentityPolicy, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::DeleteIdentityPolicy, Aws::Client::RejectedCallOutcome<DeleteIdentityPolicyOutcome>(), this, request);
+}
+
+DeleteIdentityPolicyOutcomeCallable SESClient::DeleteIdentityPolicyCallable(DeleteIdentityPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::DeleteIdentityPolicy, Aws::Client::RejectedCallOutcome<DeleteIdentityPolicyOutcome>(), this, std::move(request));
 }
 
 void SESClient::DeleteIdentityPolicyAsync(const DeleteIdentityPolicyRequest& request, const DeleteIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::DeleteIdentityPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::DeleteIdentityPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIdentityPolicyOutcome>(), this, request, handler, context);
+}
+
+void SESClient::DeleteIdentityPolicyAsync(DeleteIdentityPolicyRequest&& request, const DeleteIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::DeleteIdentityPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIdentityPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::DeleteIdentityPolicyAsyncHelper(const DeleteIdentityPolicyRequest& request, const DeleteIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -326,12 +386,22 @@ DeleteReceiptFilterOutcome SESClient::DeleteReceiptFilter(const DeleteReceiptFil
 
 DeleteReceiptFilterOutcomeCallable SESClient::DeleteReceiptFilterCallable(const DeleteReceiptFilterRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::DeleteReceiptFilter, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::DeleteReceiptFilter, Aws::Client::RejectedCallOutcome<DeleteReceiptFilterOutcome>(), this, request);
+}
+
+DeleteReceiptFilterOutcomeCallable SESClient::DeleteReceiptFilterCallable(DeleteReceiptFilterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::DeleteReceiptFilter, Aws::Client::RejectedCallOutcome<DeleteReceiptFilterOutcome>(), this, std::move(request));
 }
 
 void SESClient::DeleteReceiptFilterAsync(const DeleteReceiptFilterRequest& request, const DeleteReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::DeleteReceiptFilterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::DeleteReceiptFilterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteReceiptFilterOutcome>(), this, request, handler, context);
+}
+
+void SESClient::DeleteReceiptFilterAsync(DeleteReceiptFilterRequest&& request, const DeleteReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::DeleteReceiptFilterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteReceiptFilterOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::DeleteReceiptFilterAsyncHelper(const DeleteReceiptFilterRequest& request, const DeleteReceiptFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -356,12 +426,22 @@ DeleteReceiptRuleOutcome SESClient::DeleteReceiptRule(const DeleteReceiptRuleReq
 
 DeleteReceiptRuleOutcomeCallable SESClient::DeleteReceiptRuleCallable(const DeleteReceiptRuleRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::DeleteReceiptRule, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::DeleteReceiptRule, Aws::Client::RejectedCallOutcome<DeleteReceiptRuleOutcome>(), this, request);
+}
+
+DeleteReceiptRuleOutcomeCallable SESClient::DeleteReceiptRuleCallable(DeleteReceiptRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::DeleteReceiptRule, Aws::Client::RejectedCallOutcome<DeleteReceiptRuleOutcome>(), this, std::move(request));
 }
 
 void SESClient::DeleteReceiptRuleAsync(const DeleteReceiptRuleRequest& request, const DeleteReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::DeleteReceiptRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::DeleteReceiptRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteReceiptRuleOutcome>(), this, request, handler, context);
+}
+
+void SESClient::DeleteReceiptRuleAsync(DeleteReceiptRuleRequest&& request, const DeleteReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::DeleteReceiptRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteReceiptRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::DeleteReceiptRuleAsyncHelper(const DeleteReceiptRuleRequest& request, const DeleteReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -386,12 +466,22 @@ DeleteReceiptRuleSetOutcome SESClient::DeleteReceiptRuleSet(const DeleteReceiptR
 
 DeleteReceiptRuleSetOutcomeCallable SESClient::DeleteReceiptRuleSetCallable(const DeleteReceiptRuleSetRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::DeleteReceiptRuleSet, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::DeleteReceiptRuleSet, Aws::Client::RejectedCallOutcome<DeleteReceiptRuleSetOutcome>(), this, request);
+}
+
+DeleteReceiptRuleSetOutcomeCallable SESClient::DeleteReceiptRuleSetCallable(DeleteReceiptRuleSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::DeleteReceiptRuleSet, Aws::Client::RejectedCallOutcome<DeleteReceiptRuleSetOutcome>(), this, std::move(request));
 }
 
 void SESClient::DeleteReceiptRuleSetAsync(const DeleteReceiptRuleSetRequest& request, const DeleteReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::DeleteReceiptRuleSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::DeleteReceiptRuleSetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteReceiptRuleSetOutcome>(), this, request, handler, context);
+}
+
+void SESClient::DeleteReceiptRuleSetAsync(DeleteReceiptRuleSetRequest&& request, const DeleteReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::DeleteReceiptRuleSetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteReceiptRuleSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::DeleteReceiptRuleSetAsyncHelper(const DeleteReceiptRuleSetRequest& request, const DeleteReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -416,12 +506,22 @@ DeleteVerifiedEmailAddressOutcome SESClient::DeleteVerifiedEmailAddress(const De
 
 DeleteVerifiedEmailAddressOutcomeCallable SESClient::DeleteVerifiedEmailAddressCallable(const DeleteVerifiedEmailAddressRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::DeleteVerifiedEmailAddress, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::DeleteVerifiedEmailAddress, Aws::Client::RejectedCallOutcome<DeleteVerifiedEmailAddressOutcome>(), this, request);
+}
+
+DeleteVerifiedEmailAddressOutcomeCallable SESClient::DeleteVerifiedEmailAddressCallable(DeleteVerifiedEmailAddressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::DeleteVerifiedEmailAddress, Aws::Client::RejectedCallOutcome<DeleteVerifiedEmailAddressOutcome>(), this, std::move(request));
 }
 
 void SESClient::DeleteVerifiedEmailAddressAsync(const DeleteVerifiedEmailAddressRequest& request, const DeleteVerifiedEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::DeleteVerifiedEmailAddressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::DeleteVerifiedEmailAddressAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVerifiedEmailAddressOutcome>(), this, request, handler, context);
+}
+
+void SESClient::DeleteVerifiedEmailAddressAsync(DeleteVerifiedEmailAddressRequest&& request, const DeleteVerifiedEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::DeleteVerifiedEmailAddressAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVerifiedEmailAddressOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::DeleteVerifiedEmailAddressAsyncHelper(const DeleteVerifiedEmailAddressRequest& request, const DeleteVerifiedEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -446,12 +546,22 @@ DescribeActiveReceiptRuleSetOutcome SESClient::DescribeActiveReceiptRuleSet(cons
 
 DescribeActiveReceiptRuleSetOutcomeCallable SESClient::DescribeActiveReceiptRuleSetCallable(const DescribeActiveReceiptRuleSetRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::DescribeActiveReceiptRuleSet, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::DescribeActiveReceiptRuleSet, Aws::Client::RejectedCallOutcome<DescribeActiveReceiptRuleSetOutcome>(), this, request);
+}
+
+DescribeActiveReceiptRuleSetOutcomeCallable SESClient::DescribeActiveReceiptRuleSetCallable(DescribeActiveReceiptRuleSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::DescribeActiveReceiptRuleSet, Aws::Client::RejectedCallOutcome<DescribeActiveReceiptRuleSetOutcome>(), this, std::move(request));
 }
 
 void SESClient::DescribeActiveReceiptRuleSetAsync(const DescribeActiveReceiptRuleSetRequest& request, const DescribeActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::DescribeActiveReceiptRuleSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::DescribeActiveReceiptRuleSetAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeActiveReceiptRuleSetOutcome>(), this, request, handler, context);
+}
+
+void SESClient::DescribeActiveReceiptRuleSetAsync(DescribeActiveReceiptRuleSetRequest&& request, const DescribeActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::DescribeActiveReceiptRuleSetAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeActiveReceiptRuleSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::DescribeActiveReceiptRuleSetAsyncHelper(const DescribeActiveReceiptRuleSetRequest& request, const DescribeActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -476,12 +586,22 @@ DescribeReceiptRuleOutcome SESClient::DescribeReceiptRule(const DescribeReceiptR
 
 DescribeReceiptRuleOutcomeCallable SESClient::DescribeReceiptRuleCallable(const DescribeReceiptRuleRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::DescribeReceiptRule, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::DescribeReceiptRule, Aws::Client::RejectedCallOutcome<DescribeReceiptRuleOutcome>(), this, request);
+}
+
+DescribeReceiptRuleOutcomeCallable SESClient::DescribeReceiptRuleCallable(DescribeReceiptRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::DescribeReceiptRule, Aws::Client::RejectedCallOutcome<DescribeReceiptRuleOutcome>(), this, std::move(request));
 }
 
 void SESClient::DescribeReceiptRuleAsync(const DescribeReceiptRuleRequest& request, const DescribeReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::DescribeReceiptRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::DescribeReceiptRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReceiptRuleOutcome>(), this, request, handler, context);
+}
+
+void SESClient::DescribeReceiptRuleAsync(DescribeReceiptRuleRequest&& request, const DescribeReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::DescribeReceiptRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReceiptRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::DescribeReceiptRuleAsyncHelper(const DescribeReceiptRuleRequest& request, const DescribeReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -506,12 +626,22 @@ DescribeReceiptRuleSetOutcome SESClient::DescribeReceiptRuleSet(const DescribeRe
 
 DescribeReceiptRuleSetOutcomeCallable SESClient::DescribeReceiptRuleSetCallable(const DescribeReceiptRuleSetRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::DescribeReceiptRuleSet, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::DescribeReceiptRuleSet, Aws::Client::RejectedCallOutcome<DescribeReceiptRuleSetOutcome>(), this, request);
+}
+
+DescribeReceiptRuleSetOutcomeCallable SESClient::DescribeReceiptRuleSetCallable(DescribeReceiptRuleSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::DescribeReceiptRuleSet, Aws::Client::RejectedCallOutcome<DescribeReceiptRuleSetOutcome>(), this, std::move(request));
 }
 
 void SESClient::DescribeReceiptRuleSetAsync(const DescribeReceiptRuleSetRequest& request, const DescribeReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::DescribeReceiptRuleSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::DescribeReceiptRuleSetAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReceiptRuleSetOutcome>(), this, request, handler, context);
+}
+
+void SESClient::DescribeReceiptRuleSetAsync(DescribeReceiptRuleSetRequest&& request, const DescribeReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::DescribeReceiptRuleSetAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReceiptRuleSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::DescribeReceiptRuleSetAsyncHelper(const DescribeReceiptRuleSetRequest& request, const DescribeReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -536,12 +666,22 @@ GetIdentityDkimAttributesOutcome SESClient::GetIdentityDkimAttributes(const GetI
 
 GetIdentityDkimAttributesOutcomeCallable SESClient::GetIdentityDkimAttributesCallable(const GetIdentityDkimAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::GetIdentityDkimAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::GetIdentityDkimAttributes, Aws::Client::RejectedCallOutcome<GetIdentityDkimAttributesOutcome>(), this, request);
+}
+
+GetIdentityDkimAttributesOutcomeCallable SESClient::GetIdentityDkimAttributesCallable(GetIdentityDkimAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::GetIdentityDkimAttributes, Aws::Client::RejectedCallOutcome<GetIdentityDkimAttributesOutcome>(), this, std::move(request));
 }
 
 void SESClient::GetIdentityDkimAttributesAsync(const GetIdentityDkimAttributesRequest& request, const GetIdentityDkimAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::GetIdentityDkimAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::GetIdentityDkimAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetIdentityDkimAttributesOutcome>(), this, request, handler, context);
+}
+
+void SESClient::GetIdentityDkimAttributesAsync(GetIdentityDkimAttributesRequest&& request, const GetIdentityDkimAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::GetIdentityDkimAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetIdentityDkimAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::GetIdentityDkimAttributesAsyncHelper(const GetIdentityDkimAttributesRequest& request, const GetIdentityDkimAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -566,12 +706,22 @@ GetIdentityNotificationAttributesOutcome SESClient::GetIdentityNotificationAttri
 
 GetIdentityNotificationAttributesOutcomeCallable SESClient::GetIdentityNotificationAttributesCallable(const GetIdentityNotificationAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::GetIdentityNotificationAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::GetIdentityNotificationAttributes, Aws::Client::RejectedCallOutcome<GetIdentityNotificationAttributesOutcome>(), this, request);
+}
+
+GetIdentityNotificationAttributesOutcomeCallable SESClient::GetIdentityNotificationAttributesCallable(GetIdentityNotificationAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::GetIdentityNotificationAttributes, Aws::Client::RejectedCallOutcome<GetIdentityNotificationAttributesOutcome>(), this, std::move(request));
 }
 
 void SESClient::GetIdentityNotificationAttributesAsync(const GetIdentityNotificationAttributesRequest& request, const GetIdentityNotificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::GetIdentityNotificationAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::GetIdentityNotificationAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetIdentityNotificationAttributesOutcome>(), this, request, handler, context);
+}
+
+void SESClient::GetIdentityNotificationAttributesAsync(GetIdentityNotificationAttributesRequest&& request, const GetIdentityNotificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::GetIdentityNotificationAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetIdentityNotificationAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::GetIdentityNotificationAttributesAsyncHelper(const GetIdentityNotificationAttributesRequest& request, const GetIdentityNotificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -596,12 +746,22 @@ GetIdentityPoliciesOutcome SESClient::GetIdentityPolicies(const GetIdentityPolic
 
 GetIdentityPoliciesOutcomeCallable SESClient::GetIdentityPoliciesCallable(const GetIdentityPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::GetIdentityPolicies, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::GetIdentityPolicies, Aws::Client::RejectedCallOutcome<GetIdentityPoliciesOutcome>(), this, request);
+}
+
+GetIdentityPoliciesOutcomeCallable SESClient::GetIdentityPoliciesCallable(GetIdentityPoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::GetIdentityPolicies, Aws::Client::RejectedCallOutcome<GetIdentityPoliciesOutcome>(), this, std::move(request));
 }
 
 void SESClient::GetIdentityPoliciesAsync(const GetIdentityPoliciesRequest& request, const GetIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::GetIdentityPoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::GetIdentityPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<GetIdentityPoliciesOutcome>(), this, request, handler, context);
+}
+
+void SESClient::GetIdentityPoliciesAsync(GetIdentityPoliciesRequest&& request, const GetIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::GetIdentityPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<GetIdentityPoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::GetIdentityPoliciesAsyncHelper(const GetIdentityPoliciesRequest& request, const GetIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -626,12 +786,22 @@ GetIdentityVerificationAttributesOutcome SESClient::GetIdentityVerificationAttri
 
 GetIdentityVerificationAttributesOutcomeCallable SESClient::GetIdentityVerificationAttributesCallable(const GetIdentityVerificationAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::GetIdentityVerificationAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::GetIdentityVerificationAttributes, Aws::Client::RejectedCallOutcome<GetIdentityVerificationAttributesOutcome>(), this, request);
+}
+
+GetIdentityVerificationAttributesOutcomeCallable SESClient::GetIdentityVerificationAttributesCallable(GetIdentityVerificationAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::GetIdentityVerificationAttributes, Aws::Client::RejectedCallOutcome<GetIdentityVerificationAttributesOutcome>(), this, std::move(request));
 }
 
 void SESClient::GetIdentityVerificationAttributesAsync(const GetIdentityVerificationAttributesRequest& request, const GetIdentityVerificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::GetIdentityVerificationAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::GetIdentityVerificationAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetIdentityVerificationAttributesOutcome>(), this, request, handler, context);
+}
+
+void SESClient::GetIdentityVerificationAttributesAsync(GetIdentityVerificationAttributesRequest&& request, const GetIdentityVerificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::GetIdentityVerificationAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetIdentityVerificationAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::GetIdentityVerificationAttributesAsyncHelper(const GetIdentityVerificationAttributesRequest& request, const GetIdentityVerificationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -656,12 +826,22 @@ GetSendQuotaOutcome SESClient::GetSendQuota(const GetSendQuotaRequest& request)
 
 GetSendQuotaOutcomeCallable SESClient::GetSendQuotaCallable(const GetSendQuotaRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::GetSendQuota, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::GetSendQuota, Aws::Client::RejectedCallOutcome<GetSendQuotaOutcome>(), this, request);
+}
+
+GetSendQuotaOutcomeCallable SESClient::GetSendQuotaCallable(GetSendQuotaRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::GetSendQuota, Aws::Client::RejectedCallOutcome<GetSendQuotaOutcome>(), this, std::move(request));
 }
 
 void SESClient::GetSendQuotaAsync(const GetSendQuotaRequest& request, const GetSendQuotaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::GetSendQuotaAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::GetSendQuotaAsyncHelper, Aws::Client::RejectedAsyncCall<GetSendQuotaOutcome>(), this, request, handler, context);
+}
+
+void SESClient::GetSendQuotaAsync(GetSendQuotaRequest&& request, const GetSendQuotaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::GetSendQuotaAsyncHelper, Aws::Client::RejectedAsyncCall<GetSendQuotaOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::GetSendQuotaAsyncHelper(const GetSendQuotaRequest& request, const GetSendQuotaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -686,12 +866,22 @@ GetSendStatisticsOutcome SESClient::GetSendStatistics(const GetSendStatisticsReq
 
 GetSendStatisticsOutcomeCallable SESClient::GetSendStatisticsCallable(const GetSendStatisticsRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::GetSendStatistics, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::GetSendStatistics, Aws::Client::RejectedCallOutcome<GetSendStatisticsOutcome>(), this, request);
+}
+
+GetSendStatisticsOutcomeCallable SESClient::GetSendStatisticsCallable(GetSendStatisticsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::GetSendStatistics, Aws::Client::RejectedCallOutcome<GetSendStatisticsOutcome>(), this, std::move(request));
 }
 
 void SESClient::GetSendStatisticsAsync(const GetSendStatisticsRequest& request, const GetSendStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::GetSendStatisticsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::GetSendStatisticsAsyncHelper, Aws::Client::RejectedAsyncCall<GetSendStatisticsOutcome>(), this, request, handler, context);
+}
+
+void SESClient::GetSendStatisticsAsync(GetSendStatisticsRequest&& request, const GetSendStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::GetSendStatisticsAsyncHelper, Aws::Client::RejectedAsyncCall<GetSendStatisticsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::GetSendStatisticsAsyncHelper(const GetSendStatisticsRequest& request, const GetSendStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -716,12 +906,22 @@ ListIdentitiesOutcome SESClient::ListIdentities(const ListIdentitiesRequest& req
 
 ListIdentitiesOutcomeCallable SESClient::ListIdentitiesCallable(const ListIdentitiesRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::ListIdentities, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::ListIdentities, Aws::Client::RejectedCallOutcome<ListIdentitiesOutcome>(), this, request);
+}
+
+ListIdentitiesOutcomeCallable SESClient::ListIdentitiesCallable(ListIdentitiesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::ListIdentities, Aws::Client::RejectedCallOutcome<ListIdentitiesOutcome>(), this, std::move(request));
 }
 
 void SESClient::ListIdentitiesAsync(const ListIdentitiesRequest& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::ListIdentitiesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::ListIdentitiesAsyncHelper, Aws::Client::RejectedAsyncCall<ListIdentitiesOutcome>(), this, request, handler, context);
+}
+
+void SESClient::ListIdentitiesAsync(ListIdentitiesRequest&& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::ListIdentitiesAsyncHelper, Aws::Client::RejectedAsyncCall<ListIdentitiesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::ListIdentitiesAsyncHelper(const ListIdentitiesRequest& request, const ListIdentitiesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -746,12 +946,22 @@ ListIdentityPoliciesOutcome SESClient::ListIdentityPolicies(const ListIdentityPo
 
 ListIdentityPoliciesOutcomeCallable SESClient::ListIdentityPoliciesCallable(const ListIdentityPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::ListIdentityPolicies, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::ListIdentityPolicies, Aws::Client::RejectedCallOutcome<ListIdentityPoliciesOutcome>(), this, request);
+}
+
+ListIdentityPoliciesOutcomeCallable SESClient::ListIdentityPoliciesCallable(ListIdentityPoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::ListIdentityPolicies, Aws::Client::RejectedCallOutcome<ListIdentityPoliciesOutcome>(), this, std::move(request));
 }
 
 void SESClient::ListIdentityPoliciesAsync(const ListIdentityPoliciesRequest& request, const ListIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::ListIdentityPoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::ListIdentityPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListIdentityPoliciesOutcome>(), this, request, handler, context);
+}
+
+void SESClient::ListIdentityPoliciesAsync(ListIdentityPoliciesRequest&& request, const ListIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::ListIdentityPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListIdentityPoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::ListIdentityPoliciesAsyncHelper(const ListIdentityPoliciesRequest& request, const ListIdentityPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -776,12 +986,22 @@ ListReceiptFiltersOutcome SESClient::ListReceiptFilters(const ListReceiptFilters
 
 ListReceiptFiltersOutcomeCallable SESClient::ListReceiptFiltersCallable(const ListReceiptFiltersRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::ListReceiptFilters, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::ListReceiptFilters, Aws::Client::RejectedCallOutcome<ListReceiptFiltersOutcome>(), this, request);
+}
+
+ListReceiptFiltersOutcomeCallable SESClient::ListReceiptFiltersCallable(ListReceiptFiltersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::ListReceiptFilters, Aws::Client::RejectedCallOutcome<ListReceiptFiltersOutcome>(), this, std::move(request));
 }
 
 void SESClient::ListReceiptFiltersAsync(const ListReceiptFiltersRequest& request, const ListReceiptFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::ListReceiptFiltersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::ListReceiptFiltersAsyncHelper, Aws::Client::RejectedAsyncCall<ListReceiptFiltersOutcome>(), this, request, handler, context);
+}
+
+void SESClient::ListReceiptFiltersAsync(ListReceiptFiltersRequest&& request, const ListReceiptFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::ListReceiptFiltersAsyncHelper, Aws::Client::RejectedAsyncCall<ListReceiptFiltersOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::ListReceiptFiltersAsyncHelper(const ListReceiptFiltersRequest& request, const ListReceiptFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -806,12 +1026,22 @@ ListReceiptRuleSetsOutcome SESClient::ListReceiptRuleSets(const ListReceiptRuleS
 
 ListReceiptRuleSetsOutcomeCallable SESClient::ListReceiptRuleSetsCallable(const ListReceiptRuleSetsRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::ListReceiptRuleSets, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::ListReceiptRuleSets, Aws::Client::RejectedCallOutcome<ListReceiptRuleSetsOutcome>(), this, request);
+}
+
+ListReceiptRuleSetsOutcomeCallable SESClient::ListReceiptRuleSetsCallable(ListReceiptRuleSetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::ListReceiptRuleSets, Aws::Client::RejectedCallOutcome<ListReceiptRuleSetsOutcome>(), this, std::move(request));
 }
 
 void SESClient::ListReceiptRuleSetsAsync(const ListReceiptRuleSetsRequest& request, const ListReceiptRuleSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::ListReceiptRuleSetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::ListReceiptRuleSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListReceiptRuleSetsOutcome>(), this, request, handler, context);
+}
+
+void SESClient::ListReceiptRuleSetsAsync(ListReceiptRuleSetsRequest&& request, const ListReceiptRuleSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::ListReceiptRuleSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListReceiptRuleSetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::ListReceiptRuleSetsAsyncHelper(const ListReceiptRuleSetsRequest& request, const ListReceiptRuleSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -836,12 +1066,22 @@ ListVerifiedEmailAddressesOutcome SESClient::ListVerifiedEmailAddresses(const Li
 
 ListVerifiedEmailAddressesOutcomeCallable SESClient::ListVerifiedEmailAddressesCallable(const ListVerifiedEmailAddressesRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::ListVerifiedEmailAddresses, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::ListVerifiedEmailAddresses, Aws::Client::RejectedCallOutcome<ListVerifiedEmailAddressesOutcome>(), this, request);
+}
+
+ListVerifiedEmailAddressesOutcomeCallable SESClient::ListVerifiedEmailAddressesCallable(ListVerifiedEmailAddressesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::ListVerifiedEmailAddresses, Aws::Client::RejectedCallOutcome<ListVerifiedEmailAddressesOutcome>(), this, std::move(request));
 }
 
 void SESClient::ListVerifiedEmailAddressesAsync(const ListVerifiedEmailAddressesRequest& request, const ListVerifiedEmailAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::ListVerifiedEmailAddressesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::ListVerifiedEmailAddressesAsyncHelper, Aws::Client::RejectedAsyncCall<ListVerifiedEmailAddressesOutcome>(), this, request, handler, context);
+}
+
+void SESClient::ListVerifiedEmailAddressesAsync(ListVerifiedEmailAddressesRequest&& request, const ListVerifiedEmailAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::ListVerifiedEmailAddressesAsyncHelper, Aws::Client::RejectedAsyncCall<ListVerifiedEmailAddressesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::ListVerifiedEmailAddressesAsyncHelper(const ListVerifiedEmailAddressesRequest& request, const ListVerifiedEmailAddressesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -866,12 +1106,22 @@ PutIdentityPolicyOutcome SESClient::PutIdentityPolicy(const PutIdentityPolicyReq
 
 PutIdentityPolicyOutcomeCallable SESClient::PutIdentityPolicyCallable(const PutIdentityPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::PutIdentityPolicy, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::PutIdentityPolicy, Aws::Client::RejectedCallOutcome<PutIdentityPolicyOutcome>(), this, request);
+}
+
+PutIdentityPolicyOutcomeCallable SESClient::PutIdentityPolicyCallable(PutIdentityPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::PutIdentityPolicy, Aws::Client::RejectedCallOutcome<PutIdentityPolicyOutcome>(), this, std::move(request));
 }
 
 void SESClient::PutIdentityPolicyAsync(const PutIdentityPolicyRequest& request, const PutIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::PutIdentityPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::PutIdentityPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutIdentityPolicyOutcome>(), this, request, handler, context);
+}
+
+void SESClient::PutIdentityPolicyAsync(PutIdentityPolicyRequest&& request, const PutIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::PutIdentityPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutIdentityPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::PutIdentityPolicyAsyncHelper(const PutIdentityPolicyRequest& request, const PutIdentityPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -896,12 +1146,22 @@ ReorderReceiptRuleSetOutcome SESClient::ReorderReceiptRuleSet(const ReorderRecei
 
 ReorderReceiptRuleSetOutcomeCallable SESClient::ReorderReceiptRuleSetCallable(const ReorderReceiptRuleSetRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::ReorderReceiptRuleSet, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::ReorderReceiptRuleSet, Aws::Client::RejectedCallOutcome<ReorderReceiptRuleSetOutcome>(), this, request);
+}
+
+ReorderReceiptRuleSetOutcomeCallable SESClient::ReorderReceiptRuleSetCallable(ReorderReceiptRuleSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::ReorderReceiptRuleSet, Aws::Client::RejectedCallOutcome<ReorderReceiptRuleSetOutcome>(), this, std::move(request));
 }
 
 void SESClient::ReorderReceiptRuleSetAsync(const ReorderReceiptRuleSetRequest& request, const ReorderReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::ReorderReceiptRuleSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::ReorderReceiptRuleSetAsyncHelper, Aws::Client::RejectedAsyncCall<ReorderReceiptRuleSetOutcome>(), this, request, handler, context);
+}
+
+void SESClient::ReorderReceiptRuleSetAsync(ReorderReceiptRuleSetRequest&& request, const ReorderReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::ReorderReceiptRuleSetAsyncHelper, Aws::Client::RejectedAsyncCall<ReorderReceiptRuleSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::ReorderReceiptRuleSetAsyncHelper(const ReorderReceiptRuleSetRequest& request, const ReorderReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -926,12 +1186,22 @@ SendBounceOutcome SESClient::SendBounce(const SendBounceRequest& request) const
 
 SendBounceOutcomeCallable SESClient::SendBounceCallable(const SendBounceRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::SendBounce, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::SendBounce, Aws::Client::RejectedCallOutcome<SendBounceOutcome>(), this, request);
+}
+
+SendBounceOutcomeCallable SESClient::SendBounceCallable(SendBounceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::SendBounce, Aws::Client::RejectedCallOutcome<SendBounceOutcome>(), this, std::move(request));
 }
 
 void SESClient::SendBounceAsync(const SendBounceRequest& request, const SendBounceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::SendBounceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::SendBounceAsyncHelper, Aws::Client::RejectedAsyncCall<SendBounceOutcome>(), this, request, handler, context);
+}
+
+void SESClient::SendBounceAsync(SendBounceRequest&& request, const SendBounceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::SendBounceAsyncHelper, Aws::Client::RejectedAsyncCall<SendBounceOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::SendBounceAsyncHelper(const SendBounceRequest& request, const SendBounceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -956,12 +1226,22 @@ SendEmailOutcome SESClient::SendEmail(const SendEmailRequest& request) const
 
 SendEmailOutcomeCallable SESClient::SendEmailCallable(const SendEmailRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::SendEmail, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::SendEmail, Aws::Client::RejectedCallOutcome<SendEmailOutcome>(), this, request);
+}
+
+SendEmailOutcomeCallable SESClient::SendEmailCallable(SendEmailRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::SendEmail, Aws::Client::RejectedCallOutcome<SendEmailOutcome>(), this, std::move(request));
 }
 
 void SESClient::SendEmailAsync(const SendEmailRequest& request, const SendEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::SendEmailAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::SendEmailAsyncHelper, Aws::Client::RejectedAsyncCall<SendEmailOutcome>(), this, request, handler, context);
+}
+
+void SESClient::SendEmailAsync(SendEmailRequest&& request, const SendEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::SendEmailAsyncHelper, Aws::Client::RejectedAsyncCall<SendEmailOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::SendEmailAsyncHelper(const SendEmailRequest& request, const SendEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -986,12 +1266,22 @@ SendRawEmailOutcome SESClient::SendRawEmail(const SendRawEmailRequest& request)
 
 SendRawEmailOutcomeCallable SESClient::SendRawEmailCallable(const SendRawEmailRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::SendRawEmail, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::SendRawEmail, Aws::Client::RejectedCallOutcome<SendRawEmailOutcome>(), this, request);
+}
+
+SendRawEmailOutcomeCallable SESClient::SendRawEmailCallable(SendRawEmailRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::SendRawEmail, Aws::Client::RejectedCallOutcome<SendRawEmailOutcome>(), this, std::move(request));
 }
 
 void SESClient::SendRawEmailAsync(const SendRawEmailRequest& request, const SendRawEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::SendRawEmailAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::SendRawEmailAsyncHelper, Aws::Client::RejectedAsyncCall<SendRawEmailOutcome>(), this, request, handler, context);
+}
+
+void SESClient::SendRawEmailAsync(SendRawEmailRequest&& request, const SendRawEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::SendRawEmailAsyncHelper, Aws::Client::RejectedAsyncCall<SendRawEmailOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::SendRawEmailAsyncHelper(const SendRawEmailRequest& request, const SendRawEmailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1016,12 +1306,22 @@ SetActiveReceiptRuleSetOutcome SESClient::SetActiveReceiptRuleSet(const SetActiv
 
 SetActiveReceiptRuleSetOutcomeCallable SESClient::SetActiveReceiptRuleSetCallable(const SetActiveReceiptRuleSetRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::SetActiveReceiptRuleSet, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::SetActiveReceiptRuleSet, Aws::Client::RejectedCallOutcome<SetActiveReceiptRuleSetOutcome>(), this, request);
+}
+
+SetActiveReceiptRuleSetOutcomeCallable SESClient::SetActiveReceiptRuleSetCallable(SetActiveReceiptRuleSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::SetActiveReceiptRuleSet, Aws::Client::RejectedCallOutcome<SetActiveReceiptRuleSetOutcome>(), this, std::move(request));
 }
 
 void SESClient::SetActiveReceiptRuleSetAsync(const SetActiveReceiptRuleSetRequest& request, const SetActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::SetActiveReceiptRuleSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::SetActiveReceiptRuleSetAsyncHelper, Aws::Client::RejectedAsyncCall<SetActiveReceiptRuleSetOutcome>(), this, request, handler, context);
+}
+
+void SESClient::SetActiveReceiptRuleSetAsync(SetActiveReceiptRuleSetRequest&& request, const SetActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::SetActiveReceiptRuleSetAsyncHelper, Aws::Client::RejectedAsyncCall<SetActiveReceiptRuleSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::SetActiveReceiptRuleSetAsyncHelper(const SetActiveReceiptRuleSetRequest& request, const SetActiveReceiptRuleSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1046,12 +1346,22 @@ SetIdentityDkimEnabledOutcome SESClient::SetIdentityDkimEnabled(const SetIdentit
 
 SetIdentityDkimEnabledOutcomeCallable SESClient::SetIdentityDkimEnabledCallable(const SetIdentityDkimEnabledRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::SetIdentityDkimEnabled, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::SetIdentityDkimEnabled, Aws::Client::RejectedCallOutcome<SetIdentityDkimEnabledOutcome>(), this, request);
+}
+
+SetIdentityDkimEnabledOutcomeCallable SESClient::SetIdentityDkimEnabledCallable(SetIdentityDkimEnabledRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::SetIdentityDkimEnabled, Aws::Client::RejectedCallOutcome<SetIdentityDkimEnabledOutcome>(), this, std::move(request));
 }
 
 void SESClient::SetIdentityDkimEnabledAsync(const SetIdentityDkimEnabledRequest& request, const SetIdentityDkimEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::SetIdentityDkimEnabledAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::SetIdentityDkimEnabledAsyncHelper, Aws::Client::RejectedAsyncCall<SetIdentityDkimEnabledOutcome>(), this, request, handler, context);
+}
+
+void SESClient::SetIdentityDkimEnabledAsync(SetIdentityDkimEnabledRequest&& request, const SetIdentityDkimEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::SetIdentityDkimEnabledAsyncHelper, Aws::Client::RejectedAsyncCall<SetIdentityDkimEnabledOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::SetIdentityDkimEnabledAsyncHelper(const SetIdentityDkimEnabledRequest& request, const SetIdentityDkimEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1076,12 +1386,22 @@ SetIdentityFeedbackForwardingEnabledOutcome SESClient::SetIdentityFeedbackForwar
 
 SetIdentityFeedbackForwardingEnabledOutcomeCallable SESClient::SetIdentityFeedbackForwardingEnabledCallable(const SetIdentityFeedbackForwardingEnabledRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::SetIdentityFeedbackForwardingEnabled, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::SetIdentityFeedbackForwardingEnabled, Aws::Client::RejectedCallOutcome<SetIdentityFeedbackForwardingEnabledOutcome>(), this, request);
+}
+
+SetIdentityFeedbackForwardingEnabledOutcomeCallable SESClient::SetIdentityFeedbackForwardingEnabledCallable(SetIdentityFeedbackForwardingEnabledRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::SetIdentityFeedbackForwardingEnabled, Aws::Client::RejectedCallOutcome<SetIdentityFeedbackForwardingEnabledOutcome>(), this, std::move(request));
 }
 
 void SESClient::SetIdentityFeedbackForwardingEnabledAsync(const SetIdentityFeedbackForwardingEnabledRequest& request, const SetIdentityFeedbackForwardingEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::SetIdentityFeedbackForwardingEnabledAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::SetIdentityFeedbackForwardingEnabledAsyncHelper, Aws::Client::RejectedAsyncCall<SetIdentityFeedbackForwardingEnabledOutcome>(), this, request, handler, context);
+}
+
+void SESClient::SetIdentityFeedbackForwardingEnabledAsync(SetIdentityFeedbackForwardingEnabledRequest&& request, const SetIdentityFeedbackForwardingEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::SetIdentityFeedbackForwardingEnabledAsyncHelper, Aws::Client::RejectedAsyncCall<SetIdentityFeedbackForwardingEnabledOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::SetIdentityFeedbackForwardingEnabledAsyncHelper(const SetIdentityFeedbackForwardingEnabledRequest& request, const SetIdentityFeedbackForwardingEnabledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1106,12 +1426,22 @@ SetIdentityNotificationTopicOutcome SESClient::SetIdentityNotificationTopic(cons
 
 SetIdentityNotificationTopicOutcomeCallable SESClient::SetIdentityNotificationTopicCallable(const SetIdentityNotificationTopicRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::SetIdentityNotificationTopic, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::SetIdentityNotificationTopic, Aws::Client::RejectedCallOutcome<SetIdentityNotificationTopicOutcome>(), this, request);
+}
+
+SetIdentityNotificationTopicOutcomeCallable SESClient::SetIdentityNotificationTopicCallable(SetIdentityNotificationTopicRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::SetIdentityNotificationTopic, Aws::Client::RejectedCallOutcome<SetIdentityNotificationTopicOutcome>(), this, std::move(request));
 }
 
 void SESClient::SetIdentityNotificationTopicAsync(const SetIdentityNotificationTopicRequest& request, const SetIdentityNotificationTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::SetIdentityNotificationTopicAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::SetIdentityNotificationTopicAsyncHelper, Aws::Client::RejectedAsyncCall<SetIdentityNotificationTopicOutcome>(), this, request, handler, context);
+}
+
+void SESClient::SetIdentityNotificationTopicAsync(SetIdentityNotificationTopicRequest&& request, const SetIdentityNotificationTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::SetIdentityNotificationTopicAsyncHelper, Aws::Client::RejectedAsyncCall<SetIdentityNotificationTopicOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::SetIdentityNotificationTopicAsyncHelper(const SetIdentityNotificationTopicRequest& request, const SetIdentityNotificationTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1136,12 +1466,22 @@ SetReceiptRulePositionOutcome SESClient::SetReceiptRulePosition(const SetReceipt
 
 SetReceiptRulePositionOutcomeCallable SESClient::SetReceiptRulePositionCallable(const SetReceiptRulePositionRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::SetReceiptRulePosition, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::SetReceiptRulePosition, Aws::Client::RejectedCallOutcome<SetReceiptRulePositionOutcome>(), this, request);
+}
+
+SetReceiptRulePositionOutcomeCallable SESClient::SetReceiptRulePositionCallable(SetReceiptRulePositionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::SetReceiptRulePosition, Aws::Client::RejectedCallOutcome<SetReceiptRulePositionOutcome>(), this, std::move(request));
 }
 
 void SESClient::SetReceiptRulePositionAsync(const SetReceiptRulePositionRequest& request, const SetReceiptRulePositionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::SetReceiptRulePositionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::SetReceiptRulePositionAsyncHelper, Aws::Client::RejectedAsyncCall<SetReceiptRulePositionOutcome>(), this, request, handler, context);
+}
+
+void SESClient::SetReceiptRulePositionAsync(SetReceiptRulePositionRequest&& request, const SetReceiptRulePositionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::SetReceiptRulePositionAsyncHelper, Aws::Client::RejectedAsyncCall<SetReceiptRulePositionOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::SetReceiptRulePositionAsyncHelper(const SetReceiptRulePositionRequest& request, const SetReceiptRulePositionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1166,12 +1506,22 @@ UpdateReceiptRuleOutcome SESClient::UpdateReceiptRule(const UpdateReceiptRuleReq
 
 UpdateReceiptRuleOutcomeCallable SESClient::UpdateReceiptRuleCallable(const UpdateReceiptRuleRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::UpdateReceiptRule, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::UpdateReceiptRule, Aws::Client::RejectedCallOutcome<UpdateReceiptRuleOutcome>(), this, request);
+}
+
+UpdateReceiptRuleOutcomeCallable SESClient::UpdateReceiptRuleCallable(UpdateReceiptRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::UpdateReceiptRule, Aws::Client::RejectedCallOutcome<UpdateReceiptRuleOutcome>(), this, std::move(request));
 }
 
 void SESClient::UpdateReceiptRuleAsync(const UpdateReceiptRuleRequest& request, const UpdateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::UpdateReceiptRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::UpdateReceiptRuleAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateReceiptRuleOutcome>(), this, request, handler, context);
+}
+
+void SESClient::UpdateReceiptRuleAsync(UpdateReceiptRuleRequest&& request, const UpdateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::UpdateReceiptRuleAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateReceiptRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::UpdateReceiptRuleAsyncHelper(const UpdateReceiptRuleRequest& request, const UpdateReceiptRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1196,12 +1546,22 @@ VerifyDomainDkimOutcome SESClient::VerifyDomainDkim(const VerifyDomainDkimReques
 
 VerifyDomainDkimOutcomeCallable SESClient::VerifyDomainDkimCallable(const VerifyDomainDkimRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::VerifyDomainDkim, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::VerifyDomainDkim, Aws::Client::RejectedCallOutcome<VerifyDomainDkimOutcome>(), this, request);
+}
+
+VerifyDomainDkimOutcomeCallable SESClient::VerifyDomainDkimCallable(VerifyDomainDkimRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::VerifyDomainDkim, Aws::Client::RejectedCallOutcome<VerifyDomainDkimOutcome>(), this, std::move(request));
 }
 
 void SESClient::VerifyDomainDkimAsync(const VerifyDomainDkimRequest& request, const VerifyDomainDkimResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::VerifyDomainDkimAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::VerifyDomainDkimAsyncHelper, Aws::Client::RejectedAsyncCall<VerifyDomainDkimOutcome>(), this, request, handler, context);
+}
+
+void SESClient::VerifyDomainDkimAsync(VerifyDomainDkimRequest&& request, const VerifyDomainDkimResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::VerifyDomainDkimAsyncHelper, Aws::Client::RejectedAsyncCall<VerifyDomainDkimOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::VerifyDomainDkimAsyncHelper(const VerifyDomainDkimRequest& request, const VerifyDomainDkimResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1226,12 +1586,22 @@ VerifyDomainIdentityOutcome SESClient::VerifyDomainIdentity(const VerifyDomainId
 
 VerifyDomainIdentityOutcomeCallable SESClient::VerifyDomainIdentityCallable(const VerifyDomainIdentityRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::VerifyDomainIdentity, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::VerifyDomainIdentity, Aws::Client::RejectedCallOutcome<VerifyDomainIdentityOutcome>(), this, request);
+}
+
+VerifyDomainIdentityOutcomeCallable SESClient::VerifyDomainIdentityCallable(VerifyDomainIdentityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::VerifyDomainIdentity, Aws::Client::RejectedCallOutcome<VerifyDomainIdentityOutcome>(), this, std::move(request));
 }
 
 void SESClient::VerifyDomainIdentityAsync(const VerifyDomainIdentityRequest& request, const VerifyDomainIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::VerifyDomainIdentityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::VerifyDomainIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<VerifyDomainIdentityOutcome>(), this, request, handler, context);
+}
+
+void SESClient::VerifyDomainIdentityAsync(VerifyDomainIdentityRequest&& request, const VerifyDomainIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::VerifyDomainIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<VerifyDomainIdentityOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::VerifyDomainIdentityAsyncHelper(const VerifyDomainIdentityRequest& request, const VerifyDomainIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1256,12 +1626,22 @@ VerifyEmailAddressOutcome SESClient::VerifyEmailAddress(const VerifyEmailAddress
 
 VerifyEmailAddressOutcomeCallable SESClient::VerifyEmailAddressCallable(const VerifyEmailAddressRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::VerifyEmailAddress, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::VerifyEmailAddress, Aws::Client::RejectedCallOutcome<VerifyEmailAddressOutcome>(), this, request);
+}
+
+VerifyEmailAddressOutcomeCallable SESClient::VerifyEmailAddressCallable(VerifyEmailAddressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::VerifyEmailAddress, Aws::Client::RejectedCallOutcome<VerifyEmailAddressOutcome>(), this, std::move(request));
 }
 
 void SESClient::VerifyEmailAddressAsync(const VerifyEmailAddressRequest& request, const VerifyEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::VerifyEmailAddressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::VerifyEmailAddressAsyncHelper, Aws::Client::RejectedAsyncCall<VerifyEmailAddressOutcome>(), this, request, handler, context);
+}
+
+void SESClient::VerifyEmailAddressAsync(VerifyEmailAddressRequest&& request, const VerifyEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::VerifyEmailAddressAsyncHelper, Aws::Client::RejectedAsyncCall<VerifyEmailAddressOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::VerifyEmailAddressAsyncHelper(const VerifyEmailAddressRequest& request, const VerifyEmailAddressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1286,12 +1666,22 @@ VerifyEmailIdentityOutcome SESClient::VerifyEmailIdentity(const VerifyEmailIdent
 
 VerifyEmailIdentityOutcomeCallable SESClient::VerifyEmailIdentityCallable(const VerifyEmailIdentityRequest& request) const
 {
-  return std::async(std::launch::async, &SESClient::VerifyEmailIdentity, this, request);
+  return m_executor->SubmitWithFuture(&SESClient::VerifyEmailIdentity, Aws::Client::RejectedCallOutcome<VerifyEmailIdentityOutcome>(), this, request);
+}
+
+VerifyEmailIdentityOutcomeCallable SESClient::VerifyEmailIdentityCallable(VerifyEmailIdentityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SESClient::VerifyEmailIdentity, Aws::Client::RejectedCallOutcome<VerifyEmailIdentityOutcome>(), this, std::move(request));
 }
 
 void SESClient::VerifyEmailIdentityAsync(const VerifyEmailIdentityRequest& request, const VerifyEmailIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SESClient::VerifyEmailIdentityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SESClient::VerifyEmailIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<VerifyEmailIdentityOutcome>(), this, request, handler, context);
+}
+
+void SESClient::VerifyEmailIdentityAsync(VerifyEmailIdentityRequest&& request, const VerifyEmailIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SESClient::VerifyEmailIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<VerifyEmailIdentityOutcome>(), this, std::move(request), handler, context);
 }
 
 void SESClient::VerifyEmailIdentityAsyncHelper(const VerifyEmailIdentityRequest& request, const VerifyEmailIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
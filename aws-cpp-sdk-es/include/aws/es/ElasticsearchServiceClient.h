@@ -31,6 +31,19 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/es/model/AddTagsRequest.h>
+#include <aws/es/model/CreateElasticsearchDomainRequest.h>
+#include <aws/es/model/DeleteElasticsearchDomainRequest.h>
+#include <aws/es/model/DescribeElasticsearchDomainRequest.h>
+#include <aws/es/model/DescribeElasticsearchDomainConfigRequest.h>
+#include <aws/es/model/DescribeElasticsearchDomainsRequest.h>
+#include <aws/es/model/ListTagsRequest.h>
+#include <aws/es/model/RemoveTagsRequest.h>
+#include <aws/es/model/UpdateElasticsearchDomainConfigRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -179,6 +192,11 @@ namespace Model
          */
         virtual Model::AddTagsOutcomeCallable AddTagsCallable(const Model::AddTagsRequest& request) const;
 
+        /**
+         * Same as AddTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddTagsOutcomeCallable AddTagsCallable(Model::AddTagsRequest&& request) const;
+
         /**
          * <p>Attaches tags to an existing Elasticsearch domain. Tags are a set of
          * case-sensitive key value pairs. An Elasticsearch domain may have up to 10 tags.
@@ -191,6 +209,11 @@ namespace Model
          */
         virtual void AddTagsAsync(const Model::AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddTagsAsync(Model::AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new Elasticsearch domain. For more information, see <a
          * href="http://docs.aws.amazon.com/elasticsearch-service/latest/developerguide/es-createupdatedomains.html#es-createdomains"
@@ -209,6 +232,11 @@ namespace Model
          */
         virtual Model::CreateElasticsearchDomainOutcomeCallable CreateElasticsearchDomainCallable(const Model::CreateElasticsearchDomainRequest& request) const;
 
+        /**
+         * Same as CreateElasticsearchDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateElasticsearchDomainOutcomeCallable CreateElasticsearchDomainCallable(Model::CreateElasticsearchDomainRequest&& request) const;
+
         /**
          * <p>Creates a new Elasticsearch domain. For more information, see <a
          * href="http://docs.aws.amazon.com/elasticsearch-service/latest/developerguide/es-createupdatedomains.html#es-createdomains"
@@ -219,6 +247,11 @@ namespace Model
          */
         virtual void CreateElasticsearchDomainAsync(const Model::CreateElasticsearchDomainRequest& request, const CreateElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateElasticsearchDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateElasticsearchDomainAsync(Model::CreateElasticsearchDomainRequest&& request, const CreateElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes the specified Elasticsearch domain and all of its data.
          * Once a domain is deleted, it cannot be recovered.</p>
@@ -233,6 +266,11 @@ namespace Model
          */
         virtual Model::DeleteElasticsearchDomainOutcomeCallable DeleteElasticsearchDomainCallable(const Model::DeleteElasticsearchDomainRequest& request) const;
 
+        /**
+         * Same as DeleteElasticsearchDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteElasticsearchDomainOutcomeCallable DeleteElasticsearchDomainCallable(Model::DeleteElasticsearchDomainRequest&& request) const;
+
         /**
          * <p>Permanently deletes the specified Elasticsearch domain and all of its data.
          * Once a domain is deleted, it cannot be recovered.</p>
@@ -241,6 +279,11 @@ namespace Model
          */
         virtual void DeleteElasticsearchDomainAsync(const Model::DeleteElasticsearchDomainRequest& request, const DeleteElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteElasticsearchDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteElasticsearchDomainAsync(Model::DeleteElasticsearchDomainRequest&& request, const DeleteElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns domain configuration information about the specified Elasticsearch
          * domain, including the domain ID, domain endpoint, and domain ARN.</p>
@@ -255,6 +298,11 @@ namespace Model
          */
         virtual Model::DescribeElasticsearchDomainOutcomeCallable DescribeElasticsearchDomainCallable(const Model::DescribeElasticsearchDomainRequest& request) const;
 
+        /**
+         * Same as DescribeElasticsearchDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeElasticsearchDomainOutcomeCallable DescribeElasticsearchDomainCallable(Model::DescribeElasticsearchDomainRequest&& request) const;
+
         /**
          * <p>Returns domain configuration information about the specified Elasticsearch
          * domain, including the domain ID, domain endpoint, and domain ARN.</p>
@@ -263,6 +311,11 @@ namespace Model
          */
         virtual void DescribeElasticsearchDomainAsync(const Model::DescribeElasticsearchDomainRequest& request, const DescribeElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeElasticsearchDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeElasticsearchDomainAsync(Model::DescribeElasticsearchDomainRequest&& request, const DescribeElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides cluster configuration information about the specified Elasticsearch
          * domain, such as the state, creation date, update version, and update date for
@@ -279,6 +332,11 @@ namespace Model
          */
         virtual Model::DescribeElasticsearchDomainConfigOutcomeCallable DescribeElasticsearchDomainConfigCallable(const Model::DescribeElasticsearchDomainConfigRequest& request) const;
 
+        /**
+         * Same as DescribeElasticsearchDomainConfigCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeElasticsearchDomainConfigOutcomeCallable DescribeElasticsearchDomainConfigCallable(Model::DescribeElasticsearchDomainConfigRequest&& request) const;
+
         /**
          * <p>Provides cluster configuration information about the specified Elasticsearch
          * domain, such as the state, creation date, update version, and update date for
@@ -288,6 +346,11 @@ namespace Model
          */
         virtual void DescribeElasticsearchDomainConfigAsync(const Model::DescribeElasticsearchDomainConfigRequest& request, const DescribeElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeElasticsearchDomainConfigAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeElasticsearchDomainConfigAsync(Model::DescribeElasticsearchDomainConfigRequest&& request, const DescribeElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns domain configuration information about the specified Elasticsearch
          * domains, including the domain ID, domain endpoint, and domain ARN.</p>
@@ -302,6 +365,11 @@ namespace Model
          */
         virtual Model::DescribeElasticsearchDomainsOutcomeCallable DescribeElasticsearchDomainsCallable(const Model::DescribeElasticsearchDomainsRequest& request) const;
 
+        /**
+         * Same as DescribeElasticsearchDomainsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeElasticsearchDomainsOutcomeCallable DescribeElasticsearchDomainsCallable(Model::DescribeElasticsearchDomainsRequest&& request) const;
+
         /**
          * <p>Returns domain configuration information about the specified Elasticsearch
          * domains, including the domain ID, domain endpoint, and domain ARN.</p>
@@ -310,6 +378,11 @@ namespace Model
          */
         virtual void DescribeElasticsearchDomainsAsync(const Model::DescribeElasticsearchDomainsRequest& request, const DescribeElasticsearchDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeElasticsearchDomainsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeElasticsearchDomainsAsync(Model::DescribeElasticsearchDomainsRequest&& request, const DescribeElasticsearchDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the name of all Elasticsearch domains owned by the current user's
          * account. </p>
@@ -343,6 +416,11 @@ namespace Model
          */
         virtual Model::ListTagsOutcomeCallable ListTagsCallable(const Model::ListTagsRequest& request) const;
 
+        /**
+         * Same as ListTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTagsOutcomeCallable ListTagsCallable(Model::ListTagsRequest&& request) const;
+
         /**
          * <p>Returns all tags for the given Elasticsearch domain.</p>
          *
@@ -350,6 +428,11 @@ namespace Model
          */
         virtual void ListTagsAsync(const Model::ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTagsAsync(Model::ListTagsRequest&& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified set of tags from the specified Elasticsearch
          * domain.</p>
@@ -364,6 +447,11 @@ namespace Model
          */
         virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(const Model::RemoveTagsRequest& request) const;
 
+        /**
+         * Same as RemoveTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveTagsOutcomeCallable RemoveTagsCallable(Model::RemoveTagsRequest&& request) const;
+
         /**
          * <p>Removes the specified set of tags from the specified Elasticsearch
          * domain.</p>
@@ -372,6 +460,11 @@ namespace Model
          */
         virtual void RemoveTagsAsync(const Model::RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveTagsAsync(Model::RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies the cluster configuration of the specified Elasticsearch domain,
          * setting as setting the instance type and the number of instances. </p>
@@ -386,6 +479,11 @@ namespace Model
          */
         virtual Model::UpdateElasticsearchDomainConfigOutcomeCallable UpdateElasticsearchDomainConfigCallable(const Model::UpdateElasticsearchDomainConfigRequest& request) const;
 
+        /**
+         * Same as UpdateElasticsearchDomainConfigCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateElasticsearchDomainConfigOutcomeCallable UpdateElasticsearchDomainConfigCallable(Model::UpdateElasticsearchDomainConfigRequest&& request) const;
+
         /**
          * <p>Modifies the cluster configuration of the specified Elasticsearch domain,
          * setting as setting the instance type and the number of instances. </p>
@@ -394,6 +492,37 @@ namespace Model
          */
         virtual void UpdateElasticsearchDomainConfigAsync(const Model::UpdateElasticsearchDomainConfigRequest& request, const UpdateElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateElasticsearchDomainConfigAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateElasticsearchDomainConfigAsync(Model::UpdateElasticsearchDomainConfigRequest&& request, const UpdateElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsOutcome> AddTagsAwaitable(const Model::AddTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::AddTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsOutcome> AddTagsAwaitable(Model::AddTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::AddTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateElasticsearchDomainOutcome> CreateElasticsearchDomainAwaitable(const Model::CreateElasticsearchDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::CreateElasticsearchDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateElasticsearchDomainOutcome> CreateElasticsearchDomainAwaitable(Model::CreateElasticsearchDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::CreateElasticsearchDomain, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteElasticsearchDomainOutcome> DeleteElasticsearchDomainAwaitable(const Model::DeleteElasticsearchDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::DeleteElasticsearchDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteElasticsearchDomainOutcome> DeleteElasticsearchDomainAwaitable(Model::DeleteElasticsearchDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::DeleteElasticsearchDomain, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeElasticsearchDomainOutcome> DescribeElasticsearchDomainAwaitable(const Model::DescribeElasticsearchDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::DescribeElasticsearchDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeElasticsearchDomainOutcome> DescribeElasticsearchDomainAwaitable(Model::DescribeElasticsearchDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::DescribeElasticsearchDomain, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeElasticsearchDomainConfigOutcome> DescribeElasticsearchDomainConfigAwaitable(const Model::DescribeElasticsearchDomainConfigRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::DescribeElasticsearchDomainConfig, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeElasticsearchDomainConfigOutcome> DescribeElasticsearchDomainConfigAwaitable(Model::DescribeElasticsearchDomainConfigRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::DescribeElasticsearchDomainConfig, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeElasticsearchDomainsOutcome> DescribeElasticsearchDomainsAwaitable(const Model::DescribeElasticsearchDomainsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::DescribeElasticsearchDomains, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeElasticsearchDomainsOutcome> DescribeElasticsearchDomainsAwaitable(Model::DescribeElasticsearchDomainsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::DescribeElasticsearchDomains, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDomainNamesOutcome> ListDomainNamesAwaitable() const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::ListDomainNames, this); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsOutcome> ListTagsAwaitable(const Model::ListTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::ListTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsOutcome> ListTagsAwaitable(Model::ListTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::ListTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(const Model::RemoveTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::RemoveTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsOutcome> RemoveTagsAwaitable(Model::RemoveTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::RemoveTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateElasticsearchDomainConfigOutcome> UpdateElasticsearchDomainConfigAwaitable(const Model::UpdateElasticsearchDomainConfigRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::UpdateElasticsearchDomainConfig, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateElasticsearchDomainConfigOutcome> UpdateElasticsearchDomainConfigAwaitable(Model::UpdateElasticsearchDomainConfigRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ElasticsearchServiceClient::UpdateElasticsearchDomainConfig, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
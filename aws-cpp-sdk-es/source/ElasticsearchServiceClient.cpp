@@ -116,12 +116,22 @@ AddTagsOutcome ElasticsearchServiceClient::AddTags(const AddTagsRequest& request
 
 AddTagsOutcomeCallable ElasticsearchServiceClient::AddTagsCallable(const AddTagsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticsearchServiceClient::AddTags, this, request);
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::AddTags, Aws::Client::RejectedCallOutcome<AddTagsOutcome>(), this, request);
+}
+
+AddTagsOutcomeCallable ElasticsearchServiceClient::AddTagsCallable(AddTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::AddTags, Aws::Client::RejectedCallOutcome<AddTagsOutcome>(), this, std::move(request));
 }
 
 void ElasticsearchServiceClient::AddTagsAsync(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticsearchServiceClient::AddTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::AddTagsAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsOutcome>(), this, request, handler, context);
+}
+
+void ElasticsearchServiceClient::AddTagsAsync(AddTagsRequest&& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::AddTagsAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticsearchServiceClient::AddTagsAsyncHelper(const AddTagsRequest& request, const AddTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -147,12 +157,22 @@ CreateElasticsearchDomainOutcome ElasticsearchServiceClient::CreateElasticsearch
 
 CreateElasticsearchDomainOutcomeCallable ElasticsearchServiceClient::CreateElasticsearchDomainCallable(const CreateElasticsearchDomainRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticsearchServiceClient::CreateElasticsearchDomain, this, request);
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::CreateElasticsearchDomain, Aws::Client::RejectedCallOutcome<CreateElasticsearchDomainOutcome>(), this, request);
+}
+
+CreateElasticsearchDomainOutcomeCallable ElasticsearchServiceClient::CreateElasticsearchDomainCallable(CreateElasticsearchDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::CreateElasticsearchDomain, Aws::Client::RejectedCallOutcome<CreateElasticsearchDomainOutcome>(), this, std::move(request));
 }
 
 void ElasticsearchServiceClient::CreateElasticsearchDomainAsync(const CreateElasticsearchDomainRequest& request, const CreateElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticsearchServiceClient::CreateElasticsearchDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::CreateElasticsearchDomainAsyncHelper, Aws::Client::RejectedAsyncCall<CreateElasticsearchDomainOutcome>(), this, request, handler, context);
+}
+
+void ElasticsearchServiceClient::CreateElasticsearchDomainAsync(CreateElasticsearchDomainRequest&& request, const CreateElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::CreateElasticsearchDomainAsyncHelper, Aws::Client::RejectedAsyncCall<CreateElasticsearchDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticsearchServiceClient::CreateElasticsearchDomainAsyncHelper(const CreateElasticsearchDomainRequest& request, const CreateElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -179,12 +199,22 @@ DeleteElasticsearchDomainOutcome ElasticsearchServiceClient::DeleteElasticsearch
 
 DeleteElasticsearchDomainOutcomeCallable ElasticsearchServiceClient::DeleteElasticsearchDomainCallable(const DeleteElasticsearchDomainRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticsearchServiceClient::DeleteElasticsearchDomain, this, request);
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::DeleteElasticsearchDomain, Aws::Client::RejectedCallOutcome<DeleteElasticsearchDomainOutcome>(), this, request);
+}
+
+DeleteElasticsearchDomainOutcomeCallable ElasticsearchServiceClient::DeleteElasticsearchDomainCallable(DeleteElasticsearchDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::DeleteElasticsearchDomain, Aws::Client::RejectedCallOutcome<DeleteElasticsearchDomainOutcome>(), this, std::move(request));
 }
 
 void ElasticsearchServiceClient::DeleteElasticsearchDomainAsync(const DeleteElasticsearchDomainRequest& request, const DeleteElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticsearchServiceClient::DeleteElasticsearchDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::DeleteElasticsearchDomainAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteElasticsearchDomainOutcome>(), this, request, handler, context);
+}
+
+void ElasticsearchServiceClient::DeleteElasticsearchDomainAsync(DeleteElasticsearchDomainRequest&& request, const DeleteElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::DeleteElasticsearchDomainAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteElasticsearchDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticsearchServiceClient::DeleteElasticsearchDomainAsyncHelper(const DeleteElasticsearchDomainRequest& request, const DeleteElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -211,12 +241,22 @@ DescribeElasticsearchDomainOutcome ElasticsearchServiceClient::DescribeElasticse
 
 DescribeElasticsearchDomainOutcomeCallable ElasticsearchServiceClient::DescribeElasticsearchDomainCallable(const DescribeElasticsearchDomainRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticsearchServiceClient::DescribeElasticsearchDomain, this, request);
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::DescribeElasticsearchDomain, Aws::Client::RejectedCallOutcome<DescribeElasticsearchDomainOutcome>(), this, request);
+}
+
+DescribeElasticsearchDomainOutcomeCallable ElasticsearchServiceClient::DescribeElasticsearchDomainCallable(DescribeElasticsearchDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::DescribeElasticsearchDomain, Aws::Client::RejectedCallOutcome<DescribeElasticsearchDomainOutcome>(), this, std::move(request));
 }
 
 void ElasticsearchServiceClient::DescribeElasticsearchDomainAsync(const DescribeElasticsearchDomainRequest& request, const DescribeElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticsearchServiceClient::DescribeElasticsearchDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::DescribeElasticsearchDomainAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeElasticsearchDomainOutcome>(), this, request, handler, context);
+}
+
+void ElasticsearchServiceClient::DescribeElasticsearchDomainAsync(DescribeElasticsearchDomainRequest&& request, const DescribeElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::DescribeElasticsearchDomainAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeElasticsearchDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticsearchServiceClient::DescribeElasticsearchDomainAsyncHelper(const DescribeElasticsearchDomainRequest& request, const DescribeElasticsearchDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -244,12 +284,22 @@ DescribeElasticsearchDomainConfigOutcome ElasticsearchServiceClient::DescribeEla
 
 DescribeElasticsearchDomainConfigOutcomeCallable ElasticsearchServiceClient::DescribeElasticsearchDomainConfigCallable(const DescribeElasticsearchDomainConfigRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticsearchServiceClient::DescribeElasticsearchDomainConfig, this, request);
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::DescribeElasticsearchDomainConfig, Aws::Client::RejectedCallOutcome<DescribeElasticsearchDomainConfigOutcome>(), this, request);
+}
+
+DescribeElasticsearchDomainConfigOutcomeCallable ElasticsearchServiceClient::DescribeElasticsearchDomainConfigCallable(DescribeElasticsearchDomainConfigRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::DescribeElasticsearchDomainConfig, Aws::Client::RejectedCallOutcome<DescribeElasticsearchDomainConfigOutcome>(), this, std::move(request));
 }
 
 void ElasticsearchServiceClient::DescribeElasticsearchDomainConfigAsync(const DescribeElasticsearchDomainConfigRequest& request, const DescribeElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticsearchServiceClient::DescribeElasticsearchDomainConfigAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::DescribeElasticsearchDomainConfigAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeElasticsearchDomainConfigOutcome>(), this, request, handler, context);
+}
+
+void ElasticsearchServiceClient::DescribeElasticsearchDomainConfigAsync(DescribeElasticsearchDomainConfigRequest&& request, const DescribeElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::DescribeElasticsearchDomainConfigAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeElasticsearchDomainConfigOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticsearchServiceClient::DescribeElasticsearchDomainConfigAsyncHelper(const DescribeElasticsearchDomainConfigRequest& request, const DescribeElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -275,12 +325,22 @@ DescribeElasticsearchDomainsOutcome ElasticsearchServiceClient::DescribeElastics
 
 DescribeElasticsearchDomainsOutcomeCallable ElasticsearchServiceClient::DescribeElasticsearchDomainsCallable(const DescribeElasticsearchDomainsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticsearchServiceClient::DescribeElasticsearchDomains, this, request);
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::DescribeElasticsearchDomains, Aws::Client::RejectedCallOutcome<DescribeElasticsearchDomainsOutcome>(), this, request);
+}
+
+DescribeElasticsearchDomainsOutcomeCallable ElasticsearchServiceClient::DescribeElasticsearchDomainsCallable(DescribeElasticsearchDomainsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::DescribeElasticsearchDomains, Aws::Client::RejectedCallOutcome<DescribeElasticsearchDomainsOutcome>(), this, std::move(request));
 }
 
 void ElasticsearchServiceClient::DescribeElasticsearchDomainsAsync(const DescribeElasticsearchDomainsRequest& request, const DescribeElasticsearchDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticsearchServiceClient::DescribeElasticsearchDomainsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::DescribeElasticsearchDomainsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeElasticsearchDomainsOutcome>(), this, request, handler, context);
+}
+
+void ElasticsearchServiceClient::DescribeElasticsearchDomainsAsync(DescribeElasticsearchDomainsRequest&& request, const DescribeElasticsearchDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::DescribeElasticsearchDomainsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeElasticsearchDomainsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticsearchServiceClient::DescribeElasticsearchDomainsAsyncHelper(const DescribeElasticsearchDomainsRequest& request, const DescribeElasticsearchDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -306,12 +366,12 @@ ListDomainNamesOutcome ElasticsearchServiceClient::ListDomainNames() const
 
 ListDomainNamesOutcomeCallable ElasticsearchServiceClient::ListDomainNamesCallable() const
 {
-  return std::async(std::launch::async, &ElasticsearchServiceClient::ListDomainNames, this);
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::ListDomainNames, Aws::Client::RejectedCallOutcome<ListDomainNamesOutcome>(), this);
 }
 
 void ElasticsearchServiceClient::ListDomainNamesAsync(const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticsearchServiceClient::ListDomainNamesAsyncHelper, this, handler, context);
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::ListDomainNamesAsyncHelper, Aws::Client::RejectedAsyncCall<ListDomainNamesOutcome>(), this, handler, context);
 }
 
 void ElasticsearchServiceClient::ListDomainNamesAsyncHelper(const ListDomainNamesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -337,12 +397,22 @@ ListTagsOutcome ElasticsearchServiceClient::ListTags(const ListTagsRequest& requ
 
 ListTagsOutcomeCallable ElasticsearchServiceClient::ListTagsCallable(const ListTagsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticsearchServiceClient::ListTags, this, request);
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::ListTags, Aws::Client::RejectedCallOutcome<ListTagsOutcome>(), this, request);
+}
+
+ListTagsOutcomeCallable ElasticsearchServiceClient::ListTagsCallable(ListTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::ListTags, Aws::Client::RejectedCallOutcome<ListTagsOutcome>(), this, std::move(request));
 }
 
 void ElasticsearchServiceClient::ListTagsAsync(const ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticsearchServiceClient::ListTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::ListTagsAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsOutcome>(), this, request, handler, context);
+}
+
+void ElasticsearchServiceClient::ListTagsAsync(ListTagsRequest&& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::ListTagsAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticsearchServiceClient::ListTagsAsyncHelper(const ListTagsRequest& request, const ListTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -368,12 +438,22 @@ RemoveTagsOutcome ElasticsearchServiceClient::RemoveTags(const RemoveTagsRequest
 
 RemoveTagsOutcomeCallable ElasticsearchServiceClient::RemoveTagsCallable(const RemoveTagsRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticsearchServiceClient::RemoveTags, this, request);
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::RemoveTags, Aws::Client::RejectedCallOutcome<RemoveTagsOutcome>(), this, request);
+}
+
+RemoveTagsOutcomeCallable ElasticsearchServiceClient::RemoveTagsCallable(RemoveTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::RemoveTags, Aws::Client::RejectedCallOutcome<RemoveTagsOutcome>(), this, std::move(request));
 }
 
 void ElasticsearchServiceClient::RemoveTagsAsync(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticsearchServiceClient::RemoveTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::RemoveTagsAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsOutcome>(), this, request, handler, context);
+}
+
+void ElasticsearchServiceClient::RemoveTagsAsync(RemoveTagsRequest&& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::RemoveTagsAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticsearchServiceClient::RemoveTagsAsyncHelper(const RemoveTagsRequest& request, const RemoveTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -401,12 +481,22 @@ UpdateElasticsearchDomainConfigOutcome ElasticsearchServiceClient::UpdateElastic
 
 UpdateElasticsearchDomainConfigOutcomeCallable ElasticsearchServiceClient::UpdateElasticsearchDomainConfigCallable(const UpdateElasticsearchDomainConfigRequest& request) const
 {
-  return std::async(std::launch::async, &ElasticsearchServiceClient::UpdateElasticsearchDomainConfig, this, request);
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::UpdateElasticsearchDomainConfig, Aws::Client::RejectedCallOutcome<UpdateElasticsearchDomainConfigOutcome>(), this, request);
+}
+
+UpdateElasticsearchDomainConfigOutcomeCallable ElasticsearchServiceClient::UpdateElasticsearchDomainConfigCallable(UpdateElasticsearchDomainConfigRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ElasticsearchServiceClient::UpdateElasticsearchDomainConfig, Aws::Client::RejectedCallOutcome<UpdateElasticsearchDomainConfigOutcome>(), this, std::move(request));
 }
 
 void ElasticsearchServiceClient::UpdateElasticsearchDomainConfigAsync(const UpdateElasticsearchDomainConfigRequest& request, const UpdateElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ElasticsearchServiceClient::UpdateElasticsearchDomainConfigAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::UpdateElasticsearchDomainConfigAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateElasticsearchDomainConfigOutcome>(), this, request, handler, context);
+}
+
+void ElasticsearchServiceClient::UpdateElasticsearchDomainConfigAsync(UpdateElasticsearchDomainConfigRequest&& request, const UpdateElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ElasticsearchServiceClient::UpdateElasticsearchDomainConfigAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateElasticsearchDomainConfigOutcome>(), this, std::move(request), handler, context);
 }
 
 void ElasticsearchServiceClient::UpdateElasticsearchDomainConfigAsyncHelper(const UpdateElasticsearchDomainConfigRequest& request, const UpdateElasticsearchDomainConfigResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -32,6 +32,22 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/events/model/DeleteRuleRequest.h>
+#include <aws/events/model/DescribeRuleRequest.h>
+#include <aws/events/model/DisableRuleRequest.h>
+#include <aws/events/model/EnableRuleRequest.h>
+#include <aws/events/model/ListRuleNamesByTargetRequest.h>
+#include <aws/events/model/ListRulesRequest.h>
+#include <aws/events/model/ListTargetsByRuleRequest.h>
+#include <aws/events/model/PutEventsRequest.h>
+#include <aws/events/model/PutRuleRequest.h>
+#include <aws/events/model/PutTargetsRequest.h>
+#include <aws/events/model/RemoveTargetsRequest.h>
+#include <aws/events/model/TestEventPatternRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -191,6 +207,11 @@ namespace Model
          */
         virtual Model::DeleteRuleOutcomeCallable DeleteRuleCallable(const Model::DeleteRuleRequest& request) const;
 
+        /**
+         * Same as DeleteRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteRuleOutcomeCallable DeleteRuleCallable(Model::DeleteRuleRequest&& request) const;
+
         /**
          * <p>Deletes a rule. You must remove all targets from a rule using
          * <a>RemoveTargets</a> before you can delete the rule.</p> <p> <b>Note:</b> When
@@ -201,6 +222,11 @@ namespace Model
          */
         virtual void DeleteRuleAsync(const Model::DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteRuleAsync(Model::DeleteRuleRequest&& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the details of the specified rule.</p>
          */
@@ -213,6 +239,11 @@ namespace Model
          */
         virtual Model::DescribeRuleOutcomeCallable DescribeRuleCallable(const Model::DescribeRuleRequest& request) const;
 
+        /**
+         * Same as DescribeRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeRuleOutcomeCallable DescribeRuleCallable(Model::DescribeRuleRequest&& request) const;
+
         /**
          * <p>Describes the details of the specified rule.</p>
          *
@@ -220,6 +251,11 @@ namespace Model
          */
         virtual void DescribeRuleAsync(const Model::DescribeRuleRequest& request, const DescribeRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeRuleAsync(Model::DescribeRuleRequest&& request, const DescribeRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables a rule. A disabled rule won't match any events, and won't
          * self-trigger if it has a schedule expression.</p> <p> <b>Note:</b> When you
@@ -238,6 +274,11 @@ namespace Model
          */
         virtual Model::DisableRuleOutcomeCallable DisableRuleCallable(const Model::DisableRuleRequest& request) const;
 
+        /**
+         * Same as DisableRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableRuleOutcomeCallable DisableRuleCallable(Model::DisableRuleRequest&& request) const;
+
         /**
          * <p>Disables a rule. A disabled rule won't match any events, and won't
          * self-trigger if it has a schedule expression.</p> <p> <b>Note:</b> When you
@@ -248,6 +289,11 @@ namespace Model
          */
         virtual void DisableRuleAsync(const Model::DisableRuleRequest& request, const DisableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableRuleAsync(Model::DisableRuleRequest&& request, const DisableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables a rule. If the rule does not exist, the operation fails.</p> <p>
          * <b>Note:</b> When you enable a rule, incoming events might not immediately start
@@ -266,6 +312,11 @@ namespace Model
          */
         virtual Model::EnableRuleOutcomeCallable EnableRuleCallable(const Model::EnableRuleRequest& request) const;
 
+        /**
+         * Same as EnableRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableRuleOutcomeCallable EnableRuleCallable(Model::EnableRuleRequest&& request) const;
+
         /**
          * <p>Enables a rule. If the rule does not exist, the operation fails.</p> <p>
          * <b>Note:</b> When you enable a rule, incoming events might not immediately start
@@ -276,6 +327,11 @@ namespace Model
          */
         virtual void EnableRuleAsync(const Model::EnableRuleRequest& request, const EnableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableRuleAsync(Model::EnableRuleRequest&& request, const EnableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the names of the rules that the given target is put to. You can see
          * which of the rules in Amazon CloudWatch Events can invoke a specific target in
@@ -298,6 +354,11 @@ namespace Model
          */
         virtual Model::ListRuleNamesByTargetOutcomeCallable ListRuleNamesByTargetCallable(const Model::ListRuleNamesByTargetRequest& request) const;
 
+        /**
+         * Same as ListRuleNamesByTargetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListRuleNamesByTargetOutcomeCallable ListRuleNamesByTargetCallable(Model::ListRuleNamesByTargetRequest&& request) const;
+
         /**
          * <p>Lists the names of the rules that the given target is put to. You can see
          * which of the rules in Amazon CloudWatch Events can invoke a specific target in
@@ -310,6 +371,11 @@ namespace Model
          */
         virtual void ListRuleNamesByTargetAsync(const Model::ListRuleNamesByTargetRequest& request, const ListRuleNamesByTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRuleNamesByTargetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListRuleNamesByTargetAsync(Model::ListRuleNamesByTargetRequest&& request, const ListRuleNamesByTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the Amazon CloudWatch Events rules in your account. You can either list
          * all the rules or you can provide a prefix to match to the rule names. If you
@@ -330,6 +396,11 @@ namespace Model
          */
         virtual Model::ListRulesOutcomeCallable ListRulesCallable(const Model::ListRulesRequest& request) const;
 
+        /**
+         * Same as ListRulesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListRulesOutcomeCallable ListRulesCallable(Model::ListRulesRequest&& request) const;
+
         /**
          * <p>Lists the Amazon CloudWatch Events rules in your account. You can either list
          * all the rules or you can provide a prefix to match to the rule names. If you
@@ -341,6 +412,11 @@ namespace Model
          */
         virtual void ListRulesAsync(const Model::ListRulesRequest& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRulesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListRulesAsync(Model::ListRulesRequest&& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists of targets assigned to the rule.</p>
          */
@@ -353,6 +429,11 @@ namespace Model
          */
         virtual Model::ListTargetsByRuleOutcomeCallable ListTargetsByRuleCallable(const Model::ListTargetsByRuleRequest& request) const;
 
+        /**
+         * Same as ListTargetsByRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTargetsByRuleOutcomeCallable ListTargetsByRuleCallable(Model::ListTargetsByRuleRequest&& request) const;
+
         /**
          * <p>Lists of targets assigned to the rule.</p>
          *
@@ -360,6 +441,11 @@ namespace Model
          */
         virtual void ListTargetsByRuleAsync(const Model::ListTargetsByRuleRequest& request, const ListTargetsByRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTargetsByRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTargetsByRuleAsync(Model::ListTargetsByRuleRequest&& request, const ListTargetsByRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sends custom events to Amazon CloudWatch Events so that they can be matched
          * to rules.</p>
@@ -374,6 +460,11 @@ namespace Model
          */
         virtual Model::PutEventsOutcomeCallable PutEventsCallable(const Model::PutEventsRequest& request) const;
 
+        /**
+         * Same as PutEventsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutEventsOutcomeCallable PutEventsCallable(Model::PutEventsRequest&& request) const;
+
         /**
          * <p>Sends custom events to Amazon CloudWatch Events so that they can be matched
          * to rules.</p>
@@ -382,6 +473,11 @@ namespace Model
          */
         virtual void PutEventsAsync(const Model::PutEventsRequest& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutEventsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutEventsAsync(Model::PutEventsRequest&& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates or updates a rule. Rules are enabled by default, or based on value of
          * the State parameter. You can disable a rule using <a>DisableRule</a>.</p> <p>
@@ -420,6 +516,11 @@ namespace Model
          */
         virtual Model::PutRuleOutcomeCallable PutRuleCallable(const Model::PutRuleRequest& request) const;
 
+        /**
+         * Same as PutRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutRuleOutcomeCallable PutRuleCallable(Model::PutRuleRequest&& request) const;
+
         /**
          * <p>Creates or updates a rule. Rules are enabled by default, or based on value of
          * the State parameter. You can disable a rule using <a>DisableRule</a>.</p> <p>
@@ -440,6 +541,11 @@ namespace Model
          */
         virtual void PutRuleAsync(const Model::PutRuleRequest& request, const PutRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutRuleAsync(Model::PutRuleRequest&& request, const PutRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds target(s) to a rule. Targets are the resources that can be invoked when
          * a rule is triggered. For example, AWS Lambda functions, Amazon Kinesis streams,
@@ -496,6 +602,11 @@ namespace Model
          */
         virtual Model::PutTargetsOutcomeCallable PutTargetsCallable(const Model::PutTargetsRequest& request) const;
 
+        /**
+         * Same as PutTargetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutTargetsOutcomeCallable PutTargetsCallable(Model::PutTargetsRequest&& request) const;
+
         /**
          * <p>Adds target(s) to a rule. Targets are the resources that can be invoked when
          * a rule is triggered. For example, AWS Lambda functions, Amazon Kinesis streams,
@@ -525,6 +636,11 @@ namespace Model
          */
         virtual void PutTargetsAsync(const Model::PutTargetsRequest& request, const PutTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutTargetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutTargetsAsync(Model::PutTargetsRequest&& request, const PutTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes target(s) from a rule so that when the rule is triggered, those
          * targets will no longer be invoked.</p> <p> <b>Note:</b> When you remove a
@@ -545,6 +661,11 @@ namespace Model
          */
         virtual Model::RemoveTargetsOutcomeCallable RemoveTargetsCallable(const Model::RemoveTargetsRequest& request) const;
 
+        /**
+         * Same as RemoveTargetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveTargetsOutcomeCallable RemoveTargetsCallable(Model::RemoveTargetsRequest&& request) const;
+
         /**
          * <p>Removes target(s) from a rule so that when the rule is triggered, those
          * targets will no longer be invoked.</p> <p> <b>Note:</b> When you remove a
@@ -556,6 +677,11 @@ namespace Model
          */
         virtual void RemoveTargetsAsync(const Model::RemoveTargetsRequest& request, const RemoveTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTargetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveTargetsAsync(Model::RemoveTargetsRequest&& request, const RemoveTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Tests whether an event pattern matches the provided event.</p> <p>
          * <b>Note:</b> Most services in AWS treat : or / as the same character in Amazon
@@ -578,6 +704,11 @@ namespace Model
          */
         virtual Model::TestEventPatternOutcomeCallable TestEventPatternCallable(const Model::TestEventPatternRequest& request) const;
 
+        /**
+         * Same as TestEventPatternCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::TestEventPatternOutcomeCallable TestEventPatternCallable(Model::TestEventPatternRequest&& request) const;
+
         /**
          * <p>Tests whether an event pattern matches the provided event.</p> <p>
          * <b>Note:</b> Most services in AWS treat : or / as the same character in Amazon
@@ -590,6 +721,42 @@ namespace Model
          */
         virtual void TestEventPatternAsync(const Model::TestEventPatternRequest& request, const TestEventPatternResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TestEventPatternAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void TestEventPatternAsync(Model::TestEventPatternRequest&& request, const TestEventPatternResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRuleOutcome> DeleteRuleAwaitable(const Model::DeleteRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::DeleteRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRuleOutcome> DeleteRuleAwaitable(Model::DeleteRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::DeleteRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRuleOutcome> DescribeRuleAwaitable(const Model::DescribeRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::DescribeRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRuleOutcome> DescribeRuleAwaitable(Model::DescribeRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::DescribeRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableRuleOutcome> DisableRuleAwaitable(const Model::DisableRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::DisableRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableRuleOutcome> DisableRuleAwaitable(Model::DisableRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::DisableRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableRuleOutcome> EnableRuleAwaitable(const Model::EnableRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::EnableRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableRuleOutcome> EnableRuleAwaitable(Model::EnableRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::EnableRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRuleNamesByTargetOutcome> ListRuleNamesByTargetAwaitable(const Model::ListRuleNamesByTargetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::ListRuleNamesByTarget, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRuleNamesByTargetOutcome> ListRuleNamesByTargetAwaitable(Model::ListRuleNamesByTargetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::ListRuleNamesByTarget, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRulesOutcome> ListRulesAwaitable(const Model::ListRulesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::ListRules, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRulesOutcome> ListRulesAwaitable(Model::ListRulesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::ListRules, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTargetsByRuleOutcome> ListTargetsByRuleAwaitable(const Model::ListTargetsByRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::ListTargetsByRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTargetsByRuleOutcome> ListTargetsByRuleAwaitable(Model::ListTargetsByRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::ListTargetsByRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutEventsOutcome> PutEventsAwaitable(const Model::PutEventsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::PutEvents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutEventsOutcome> PutEventsAwaitable(Model::PutEventsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::PutEvents, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRuleOutcome> PutRuleAwaitable(const Model::PutRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::PutRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRuleOutcome> PutRuleAwaitable(Model::PutRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::PutRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutTargetsOutcome> PutTargetsAwaitable(const Model::PutTargetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::PutTargets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutTargetsOutcome> PutTargetsAwaitable(Model::PutTargetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::PutTargets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTargetsOutcome> RemoveTargetsAwaitable(const Model::RemoveTargetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::RemoveTargets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTargetsOutcome> RemoveTargetsAwaitable(Model::RemoveTargetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::RemoveTargets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TestEventPatternOutcome> TestEventPatternAwaitable(const Model::TestEventPatternRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::TestEventPattern, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TestEventPatternOutcome> TestEventPatternAwaitable(Model::TestEventPatternRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchEventsClient::TestEventPattern, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
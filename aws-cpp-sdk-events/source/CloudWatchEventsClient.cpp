@@ -119,12 +119,22 @@ DeleteRuleOutcome CloudWatchEventsClient::DeleteRule(const DeleteRuleRequest& re
 
 DeleteRuleOutcomeCallable CloudWatchEventsClient::DeleteRuleCallable(const DeleteRuleRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchEventsClient::DeleteRule, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::DeleteRule, Aws::Client::RejectedCallOutcome<DeleteRuleOutcome>(), this, request);
+}
+
+DeleteRuleOutcomeCallable CloudWatchEventsClient::DeleteRuleCallable(DeleteRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::DeleteRule, Aws::Client::RejectedCallOutcome<DeleteRuleOutcome>(), this, std::move(request));
 }
 
 void CloudWatchEventsClient::DeleteRuleAsync(const DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchEventsClient::DeleteRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::DeleteRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRuleOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchEventsClient::DeleteRuleAsync(DeleteRuleRequest&& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::DeleteRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchEventsClient::DeleteRuleAsyncHelper(const DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -150,12 +160,22 @@ DescribeRuleOutcome CloudWatchEventsClient::DescribeRule(const DescribeRuleReque
 
 DescribeRuleOutcomeCallable CloudWatchEventsClient::DescribeRuleCallable(const DescribeRuleRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchEventsClient::DescribeRule, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::DescribeRule, Aws::Client::RejectedCallOutcome<DescribeRuleOutcome>(), this, request);
+}
+
+DescribeRuleOutcomeCallable CloudWatchEventsClient::DescribeRuleCallable(DescribeRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::DescribeRule, Aws::Client::RejectedCallOutcome<DescribeRuleOutcome>(), this, std::move(request));
 }
 
 void CloudWatchEventsClient::DescribeRuleAsync(const DescribeRuleRequest& request, const DescribeRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchEventsClient::DescribeRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::DescribeRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRuleOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchEventsClient::DescribeRuleAsync(DescribeRuleRequest&& request, const DescribeRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::DescribeRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchEventsClient::DescribeRuleAsyncHelper(const DescribeRuleRequest& request, const DescribeRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -181,12 +201,22 @@ DisableRuleOutcome CloudWatchEventsClient::DisableRule(const DisableRuleRequest&
 
 DisableRuleOutcomeCallable CloudWatchEventsClient::DisableRuleCallable(const DisableRuleRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchEventsClient::DisableRule, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::DisableRule, Aws::Client::RejectedCallOutcome<DisableRuleOutcome>(), this, request);
+}
+
+DisableRuleOutcomeCallable CloudWatchEventsClient::DisableRuleCallable(DisableRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::DisableRule, Aws::Client::RejectedCallOutcome<DisableRuleOutcome>(), this, std::move(request));
 }
 
 void CloudWatchEventsClient::DisableRuleAsync(const DisableRuleRequest& request, const DisableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchEventsClient::DisableRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::DisableRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DisableRuleOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchEventsClient::DisableRuleAsync(DisableRuleRequest&& request, const DisableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::DisableRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DisableRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchEventsClient::DisableRuleAsyncHelper(const DisableRuleRequest& request, const DisableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -212,12 +242,22 @@ EnableRuleOutcome CloudWatchEventsClient::EnableRule(const EnableRuleRequest& re
 
 EnableRuleOutcomeCallable CloudWatchEventsClient::EnableRuleCallable(const EnableRuleRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchEventsClient::EnableRule, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::EnableRule, Aws::Client::RejectedCallOutcome<EnableRuleOutcome>(), this, request);
+}
+
+EnableRuleOutcomeCallable CloudWatchEventsClient::EnableRuleCallable(EnableRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::EnableRule, Aws::Client::RejectedCallOutcome<EnableRuleOutcome>(), this, std::move(request));
 }
 
 void CloudWatchEventsClient::EnableRuleAsync(const EnableRuleRequest& request, const EnableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchEventsClient::EnableRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::EnableRuleAsyncHelper, Aws::Client::RejectedAsyncCall<EnableRuleOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchEventsClient::EnableRuleAsync(EnableRuleRequest&& request, const EnableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::EnableRuleAsyncHelper, Aws::Client::RejectedAsyncCall<EnableRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchEventsClient::EnableRuleAsyncHelper(const EnableRuleRequest& request, const EnableRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -243,12 +283,22 @@ ListRuleNamesByTargetOutcome CloudWatchEventsClient::ListRuleNamesByTarget(const
 
 ListRuleNamesByTargetOutcomeCallable CloudWatchEventsClient::ListRuleNamesByTargetCallable(const ListRuleNamesByTargetRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchEventsClient::ListRuleNamesByTarget, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::ListRuleNamesByTarget, Aws::Client::RejectedCallOutcome<ListRuleNamesByTargetOutcome>(), this, request);
+}
+
+ListRuleNamesByTargetOutcomeCallable CloudWatchEventsClient::ListRuleNamesByTargetCallable(ListRuleNamesByTargetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::ListRuleNamesByTarget, Aws::Client::RejectedCallOutcome<ListRuleNamesByTargetOutcome>(), this, std::move(request));
 }
 
 void CloudWatchEventsClient::ListRuleNamesByTargetAsync(const ListRuleNamesByTargetRequest& request, const ListRuleNamesByTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchEventsClient::ListRuleNamesByTargetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::ListRuleNamesByTargetAsyncHelper, Aws::Client::RejectedAsyncCall<ListRuleNamesByTargetOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchEventsClient::ListRuleNamesByTargetAsync(ListRuleNamesByTargetRequest&& request, const ListRuleNamesByTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::ListRuleNamesByTargetAsyncHelper, Aws::Client::RejectedAsyncCall<ListRuleNamesByTargetOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchEventsClient::ListRuleNamesByTargetAsyncHelper(const ListRuleNamesByTargetRequest& request, const ListRuleNamesByTargetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -274,12 +324,22 @@ ListRulesOutcome CloudWatchEventsClient::ListRules(const ListRulesRequest& reque
 
 ListRulesOutcomeCallable CloudWatchEventsClient::ListRulesCallable(const ListRulesRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchEventsClient::ListRules, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::ListRules, Aws::Client::RejectedCallOutcome<ListRulesOutcome>(), this, request);
+}
+
+ListRulesOutcomeCallable CloudWatchEventsClient::ListRulesCallable(ListRulesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::ListRules, Aws::Client::RejectedCallOutcome<ListRulesOutcome>(), this, std::move(request));
 }
 
 void CloudWatchEventsClient::ListRulesAsync(const ListRulesRequest& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchEventsClient::ListRulesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::ListRulesAsyncHelper, Aws::Client::RejectedAsyncCall<ListRulesOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchEventsClient::ListRulesAsync(ListRulesRequest&& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::ListRulesAsyncHelper, Aws::Client::RejectedAsyncCall<ListRulesOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchEventsClient::ListRulesAsyncHelper(const ListRulesRequest& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -305,12 +365,22 @@ ListTargetsByRuleOutcome CloudWatchEventsClient::ListTargetsByRule(const ListTar
 
 ListTargetsByRuleOutcomeCallable CloudWatchEventsClient::ListTargetsByRuleCallable(const ListTargetsByRuleRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchEventsClient::ListTargetsByRule, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::ListTargetsByRule, Aws::Client::RejectedCallOutcome<ListTargetsByRuleOutcome>(), this, request);
+}
+
+ListTargetsByRuleOutcomeCallable CloudWatchEventsClient::ListTargetsByRuleCallable(ListTargetsByRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::ListTargetsByRule, Aws::Client::RejectedCallOutcome<ListTargetsByRuleOutcome>(), this, std::move(request));
 }
 
 void CloudWatchEventsClient::ListTargetsByRuleAsync(const ListTargetsByRuleRequest& request, const ListTargetsByRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchEventsClient::ListTargetsByRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::ListTargetsByRuleAsyncHelper, Aws::Client::RejectedAsyncCall<ListTargetsByRuleOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchEventsClient::ListTargetsByRuleAsync(ListTargetsByRuleRequest&& request, const ListTargetsByRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::ListTargetsByRuleAsyncHelper, Aws::Client::RejectedAsyncCall<ListTargetsByRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchEventsClient::ListTargetsByRuleAsyncHelper(const ListTargetsByRuleRequest& request, const ListTargetsByRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -336,12 +406,22 @@ PutEventsOutcome CloudWatchEventsClient::PutEvents(const PutEventsRequest& reque
 
 PutEventsOutcomeCallable CloudWatchEventsClient::PutEventsCallable(const PutEventsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchEventsClient::PutEvents, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::PutEvents, Aws::Client::RejectedCallOutcome<PutEventsOutcome>(), this, request);
+}
+
+PutEventsOutcomeCallable CloudWatchEventsClient::PutEventsCallable(PutEventsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::PutEvents, Aws::Client::RejectedCallOutcome<PutEventsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchEventsClient::PutEventsAsync(const PutEventsRequest& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchEventsClient::PutEventsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::PutEventsAsyncHelper, Aws::Client::RejectedAsyncCall<PutEventsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchEventsClient::PutEventsAsync(PutEventsRequest&& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::PutEventsAsyncHelper, Aws::Client::RejectedAsyncCall<PutEventsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchEventsClient::PutEventsAsyncHelper(const PutEventsRequest& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -367,12 +447,22 @@ PutRuleOutcome CloudWatchEventsClient::PutRule(const PutRuleRequest& request) co
 
 PutRuleOutcomeCallable CloudWatchEventsClient::PutRuleCallable(const PutRuleRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchEventsClient::PutRule, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::PutRule, Aws::Client::RejectedCallOutcome<PutRuleOutcome>(), this, request);
+}
+
+PutRuleOutcomeCallable CloudWatchEventsClient::PutRuleCallable(PutRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::PutRule, Aws::Client::RejectedCallOutcome<PutRuleOutcome>(), this, std::move(request));
 }
 
 void CloudWatchEventsClient::PutRuleAsync(const PutRuleRequest& request, const PutRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchEventsClient::PutRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::PutRuleAsyncHelper, Aws::Client::RejectedAsyncCall<PutRuleOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchEventsClient::PutRuleAsync(PutRuleRequest&& request, const PutRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::PutRuleAsyncHelper, Aws::Client::RejectedAsyncCall<PutRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchEventsClient::PutRuleAsyncHelper(const PutRuleRequest& request, const PutRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -398,12 +488,22 @@ PutTargetsOutcome CloudWatchEventsClient::PutTargets(const PutTargetsRequest& re
 
 PutTargetsOutcomeCallable CloudWatchEventsClient::PutTargetsCallable(const PutTargetsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchEventsClient::PutTargets, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::PutTargets, Aws::Client::RejectedCallOutcome<PutTargetsOutcome>(), this, request);
+}
+
+PutTargetsOutcomeCallable CloudWatchEventsClient::PutTargetsCallable(PutTargetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::PutTargets, Aws::Client::RejectedCallOutcome<PutTargetsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchEventsClient::PutTargetsAsync(const PutTargetsRequest& request, const PutTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchEventsClient::PutTargetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::PutTargetsAsyncHelper, Aws::Client::RejectedAsyncCall<PutTargetsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchEventsClient::PutTargetsAsync(PutTargetsRequest&& request, const PutTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::PutTargetsAsyncHelper, Aws::Client::RejectedAsyncCall<PutTargetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchEventsClient::PutTargetsAsyncHelper(const PutTargetsRequest& request, const PutTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -429,12 +529,22 @@ RemoveTargetsOutcome CloudWatchEventsClient::RemoveTargets(const RemoveTargetsRe
 
 RemoveTargetsOutcomeCallable CloudWatchEventsClient::RemoveTargetsCallable(const RemoveTargetsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchEventsClient::RemoveTargets, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::RemoveTargets, Aws::Client::RejectedCallOutcome<RemoveTargetsOutcome>(), this, request);
+}
+
+RemoveTargetsOutcomeCallable CloudWatchEventsClient::RemoveTargetsCallable(RemoveTargetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::RemoveTargets, Aws::Client::RejectedCallOutcome<RemoveTargetsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchEventsClient::RemoveTargetsAsync(const RemoveTargetsRequest& request, const RemoveTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchEventsClient::RemoveTargetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::RemoveTargetsAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTargetsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchEventsClient::RemoveTargetsAsync(RemoveTargetsRequest&& request, const RemoveTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::RemoveTargetsAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTargetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchEventsClient::RemoveTargetsAsyncHelper(const RemoveTargetsRequest& request, const RemoveTargetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -460,12 +570,22 @@ TestEventPatternOutcome CloudWatchEventsClient::TestEventPattern(const TestEvent
 
 TestEventPatternOutcomeCallable CloudWatchEventsClient::TestEventPatternCallable(const TestEventPatternRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchEventsClient::TestEventPattern, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::TestEventPattern, Aws::Client::RejectedCallOutcome<TestEventPatternOutcome>(), this, request);
+}
+
+TestEventPatternOutcomeCallable CloudWatchEventsClient::TestEventPatternCallable(TestEventPatternRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchEventsClient::TestEventPattern, Aws::Client::RejectedCallOutcome<TestEventPatternOutcome>(), this, std::move(request));
 }
 
 void CloudWatchEventsClient::TestEventPatternAsync(const TestEventPatternRequest& request, const TestEventPatternResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchEventsClient::TestEventPatternAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::TestEventPatternAsyncHelper, Aws::Client::RejectedAsyncCall<TestEventPatternOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchEventsClient::TestEventPatternAsync(TestEventPatternRequest&& request, const TestEventPatternResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchEventsClient::TestEventPatternAsyncHelper, Aws::Client::RejectedAsyncCall<TestEventPatternOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchEventsClient::TestEventPatternAsyncHelper(const TestEventPatternRequest& request, const TestEventPatternResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
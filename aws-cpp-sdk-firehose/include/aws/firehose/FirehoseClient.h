@@ -29,6 +29,17 @@
 #include <aws/firehose/model/UpdateDestinationResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/firehose/model/CreateDeliveryStreamRequest.h>
+#include <aws/firehose/model/DeleteDeliveryStreamRequest.h>
+#include <aws/firehose/model/DescribeDeliveryStreamRequest.h>
+#include <aws/firehose/model/ListDeliveryStreamsRequest.h>
+#include <aws/firehose/model/PutRecordRequest.h>
+#include <aws/firehose/model/PutRecordBatchRequest.h>
+#include <aws/firehose/model/UpdateDestinationRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -237,6 +248,11 @@ namespace Model
          */
         virtual Model::CreateDeliveryStreamOutcomeCallable CreateDeliveryStreamCallable(const Model::CreateDeliveryStreamRequest& request) const;
 
+        /**
+         * Same as CreateDeliveryStreamCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDeliveryStreamOutcomeCallable CreateDeliveryStreamCallable(Model::CreateDeliveryStreamRequest&& request) const;
+
         /**
          * <p>Creates a delivery stream.</p> <p><a>CreateDeliveryStream</a> is an
          * asynchronous operation that immediately returns. The initial status of the
@@ -287,6 +303,11 @@ namespace Model
          */
         virtual void CreateDeliveryStreamAsync(const Model::CreateDeliveryStreamRequest& request, const CreateDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDeliveryStreamAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDeliveryStreamAsync(Model::CreateDeliveryStreamRequest&& request, const CreateDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a delivery stream and its data.</p> <p>You can delete a delivery
          * stream only if it is in <code>ACTIVE</code> or <code>DELETING</code> state, and
@@ -317,6 +338,11 @@ namespace Model
          */
         virtual Model::DeleteDeliveryStreamOutcomeCallable DeleteDeliveryStreamCallable(const Model::DeleteDeliveryStreamRequest& request) const;
 
+        /**
+         * Same as DeleteDeliveryStreamCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDeliveryStreamOutcomeCallable DeleteDeliveryStreamCallable(Model::DeleteDeliveryStreamRequest&& request) const;
+
         /**
          * <p>Deletes a delivery stream and its data.</p> <p>You can delete a delivery
          * stream only if it is in <code>ACTIVE</code> or <code>DELETING</code> state, and
@@ -333,6 +359,11 @@ namespace Model
          */
         virtual void DeleteDeliveryStreamAsync(const Model::DeleteDeliveryStreamRequest& request, const DeleteDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDeliveryStreamAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDeliveryStreamAsync(Model::DeleteDeliveryStreamRequest&& request, const DeleteDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified delivery stream and gets the status. For example,
          * after your delivery stream is created, call <a>DescribeDeliveryStream</a> to see
@@ -351,6 +382,11 @@ namespace Model
          */
         virtual Model::DescribeDeliveryStreamOutcomeCallable DescribeDeliveryStreamCallable(const Model::DescribeDeliveryStreamRequest& request) const;
 
+        /**
+         * Same as DescribeDeliveryStreamCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDeliveryStreamOutcomeCallable DescribeDeliveryStreamCallable(Model::DescribeDeliveryStreamRequest&& request) const;
+
         /**
          * <p>Describes the specified delivery stream and gets the status. For example,
          * after your delivery stream is created, call <a>DescribeDeliveryStream</a> to see
@@ -361,6 +397,11 @@ namespace Model
          */
         virtual void DescribeDeliveryStreamAsync(const Model::DescribeDeliveryStreamRequest& request, const DescribeDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDeliveryStreamAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDeliveryStreamAsync(Model::DescribeDeliveryStreamRequest&& request, const DescribeDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists your delivery streams.</p> <p>The number of delivery streams might be
          * too large to return using a single call to <a>ListDeliveryStreams</a>. You can
@@ -389,6 +430,11 @@ namespace Model
          */
         virtual Model::ListDeliveryStreamsOutcomeCallable ListDeliveryStreamsCallable(const Model::ListDeliveryStreamsRequest& request) const;
 
+        /**
+         * Same as ListDeliveryStreamsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDeliveryStreamsOutcomeCallable ListDeliveryStreamsCallable(Model::ListDeliveryStreamsRequest&& request) const;
+
         /**
          * <p>Lists your delivery streams.</p> <p>The number of delivery streams might be
          * too large to return using a single call to <a>ListDeliveryStreams</a>. You can
@@ -404,6 +450,11 @@ namespace Model
          */
         virtual void ListDeliveryStreamsAsync(const Model::ListDeliveryStreamsRequest& request, const ListDeliveryStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDeliveryStreamsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDeliveryStreamsAsync(Model::ListDeliveryStreamsRequest&& request, const ListDeliveryStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Writes a single data record into an Amazon Kinesis Firehose delivery stream.
          * To write multiple data records into a delivery stream, use
@@ -476,6 +527,11 @@ namespace Model
          */
         virtual Model::PutRecordOutcomeCallable PutRecordCallable(const Model::PutRecordRequest& request) const;
 
+        /**
+         * Same as PutRecordCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutRecordOutcomeCallable PutRecordCallable(Model::PutRecordRequest&& request) const;
+
         /**
          * <p>Writes a single data record into an Amazon Kinesis Firehose delivery stream.
          * To write multiple data records into a delivery stream, use
@@ -513,6 +569,11 @@ namespace Model
          */
         virtual void PutRecordAsync(const Model::PutRecordRequest& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRecordAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutRecordAsync(Model::PutRecordRequest&& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Writes multiple data records into a delivery stream in a single call, which
          * can achieve higher throughput per producer than when writing single records. To
@@ -625,6 +686,11 @@ namespace Model
          */
         virtual Model::PutRecordBatchOutcomeCallable PutRecordBatchCallable(const Model::PutRecordBatchRequest& request) const;
 
+        /**
+         * Same as PutRecordBatchCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutRecordBatchOutcomeCallable PutRecordBatchCallable(Model::PutRecordBatchRequest&& request) const;
+
         /**
          * <p>Writes multiple data records into a delivery stream in a single call, which
          * can achieve higher throughput per producer than when writing single records. To
@@ -682,6 +748,11 @@ namespace Model
          */
         virtual void PutRecordBatchAsync(const Model::PutRecordBatchRequest& request, const PutRecordBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRecordBatchAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutRecordBatchAsync(Model::PutRecordBatchRequest&& request, const PutRecordBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the specified destination of the specified delivery stream. </p>
          * <p>This operation can be used to change the destination type (for example, to
@@ -744,6 +815,11 @@ namespace Model
          */
         virtual Model::UpdateDestinationOutcomeCallable UpdateDestinationCallable(const Model::UpdateDestinationRequest& request) const;
 
+        /**
+         * Same as UpdateDestinationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateDestinationOutcomeCallable UpdateDestinationCallable(Model::UpdateDestinationRequest&& request) const;
+
         /**
          * <p>Updates the specified destination of the specified delivery stream. </p>
          * <p>This operation can be used to change the destination type (for example, to
@@ -776,6 +852,32 @@ namespace Model
          */
         virtual void UpdateDestinationAsync(const Model::UpdateDestinationRequest& request, const UpdateDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDestinationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateDestinationAsync(Model::UpdateDestinationRequest&& request, const UpdateDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDeliveryStreamOutcome> CreateDeliveryStreamAwaitable(const Model::CreateDeliveryStreamRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &FirehoseClient::CreateDeliveryStream, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDeliveryStreamOutcome> CreateDeliveryStreamAwaitable(Model::CreateDeliveryStreamRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &FirehoseClient::CreateDeliveryStream, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDeliveryStreamOutcome> DeleteDeliveryStreamAwaitable(const Model::DeleteDeliveryStreamRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &FirehoseClient::DeleteDeliveryStream, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDeliveryStreamOutcome> DeleteDeliveryStreamAwaitable(Model::DeleteDeliveryStreamRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &FirehoseClient::DeleteDeliveryStream, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDeliveryStreamOutcome> DescribeDeliveryStreamAwaitable(const Model::DescribeDeliveryStreamRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &FirehoseClient::DescribeDeliveryStream, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDeliveryStreamOutcome> DescribeDeliveryStreamAwaitable(Model::DescribeDeliveryStreamRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &FirehoseClient::DescribeDeliveryStream, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDeliveryStreamsOutcome> ListDeliveryStreamsAwaitable(const Model::ListDeliveryStreamsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &FirehoseClient::ListDeliveryStreams, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDeliveryStreamsOutcome> ListDeliveryStreamsAwaitable(Model::ListDeliveryStreamsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &FirehoseClient::ListDeliveryStreams, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRecordOutcome> PutRecordAwaitable(const Model::PutRecordRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &FirehoseClient::PutRecord, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRecordOutcome> PutRecordAwaitable(Model::PutRecordRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &FirehoseClient::PutRecord, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRecordBatchOutcome> PutRecordBatchAwaitable(const Model::PutRecordBatchRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &FirehoseClient::PutRecordBatch, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRecordBatchOutcome> PutRecordBatchAwaitable(Model::PutRecordBatchRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &FirehoseClient::PutRecordBatch, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDestinationOutcome> UpdateDestinationAwaitable(const Model::UpdateDestinationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &FirehoseClient::UpdateDestination, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDestinationOutcome> UpdateDestinationAwaitable(Model::UpdateDestinationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &FirehoseClient::UpdateDestination, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -114,12 +114,22 @@ CreateDeliveryStreamOutcome FirehoseClient::CreateDeliveryStream(const CreateDel
 
 CreateDeliveryStreamOutcomeCallable FirehoseClient::CreateDeliveryStreamCallable(const CreateDeliveryStreamRequest& request) const
 {
-  return std::async(std::launch::async, &FirehoseClient::CreateDeliveryStream, this, request);
+  return m_executor->SubmitWithFuture(&FirehoseClient::CreateDeliveryStream, Aws::Client::RejectedCallOutcome<CreateDeliveryStreamOutcome>(), this, request);
+}
+
+CreateDeliveryStreamOutcomeCallable FirehoseClient::CreateDeliveryStreamCallable(CreateDeliveryStreamRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&FirehoseClient::CreateDeliveryStream, Aws::Client::RejectedCallOutcome<CreateDeliveryStreamOutcome>(), this, std::move(request));
 }
 
 void FirehoseClient::CreateDeliveryStreamAsync(const CreateDeliveryStreamRequest& request, const CreateDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&FirehoseClient::CreateDeliveryStreamAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&FirehoseClient::CreateDeliveryStreamAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDeliveryStreamOutcome>(), this, request, handler, context);
+}
+
+void FirehoseClient::CreateDeliveryStreamAsync(CreateDeliveryStreamRequest&& request, const CreateDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&FirehoseClient::CreateDeliveryStreamAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDeliveryStreamOutcome>(), this, std::move(request), handler, context);
 }
 
 void FirehoseClient::CreateDeliveryStreamAsyncHelper(const CreateDeliveryStreamRequest& request, const CreateDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -145,12 +155,22 @@ DeleteDeliveryStreamOutcome FirehoseClient::DeleteDeliveryStream(const DeleteDel
 
 DeleteDeliveryStreamOutcomeCallable FirehoseClient::DeleteDeliveryStreamCallable(const DeleteDeliveryStreamRequest& request) const
 {
-  return std::async(std::launch::async, &FirehoseClient::DeleteDeliveryStream, this, request);
+  return m_executor->SubmitWithFuture(&FirehoseClient::DeleteDeliveryStream, Aws::Client::RejectedCallOutcome<DeleteDeliveryStreamOutcome>(), this, request);
+}
+
+DeleteDeliveryStreamOutcomeCallable FirehoseClient::DeleteDeliveryStreamCallable(DeleteDeliveryStreamRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&FirehoseClient::DeleteDeliveryStream, Aws::Client::RejectedCallOutcome<DeleteDeliveryStreamOutcome>(), this, std::move(request));
 }
 
 void FirehoseClient::DeleteDeliveryStreamAsync(const DeleteDeliveryStreamRequest& request, const DeleteDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&FirehoseClient::DeleteDeliveryStreamAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&FirehoseClient::DeleteDeliveryStreamAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDeliveryStreamOutcome>(), this, request, handler, context);
+}
+
+void FirehoseClient::DeleteDeliveryStreamAsync(DeleteDeliveryStreamRequest&& request, const DeleteDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&FirehoseClient::DeleteDeliveryStreamAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDeliveryStreamOutcome>(), this, std::move(request), handler, context);
 }
 
 void FirehoseClient::DeleteDeliveryStreamAsyncHelper(const DeleteDeliveryStreamRequest& request, const DeleteDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -176,12 +196,22 @@ DescribeDeliveryStreamOutcome FirehoseClient::DescribeDeliveryStream(const Descr
 
 DescribeDeliveryStreamOutcomeCallable FirehoseClient::DescribeDeliveryStreamCallable(const DescribeDeliveryStreamRequest& request) const
 {
-  return std::async(std::launch::async, &FirehoseClient::DescribeDeliveryStream, this, request);
+  return m_executor->SubmitWithFuture(&FirehoseClient::DescribeDeliveryStream, Aws::Client::RejectedCallOutcome<DescribeDeliveryStreamOutcome>(), this, request);
+}
+
+DescribeDeliveryStreamOutcomeCallable FirehoseClient::DescribeDeliveryStreamCallable(DescribeDeliveryStreamRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&FirehoseClient::DescribeDeliveryStream, Aws::Client::RejectedCallOutcome<DescribeDeliveryStreamOutcome>(), this, std::move(request));
 }
 
 void FirehoseClient::DescribeDeliveryStreamAsync(const DescribeDeliveryStreamRequest& request, const DescribeDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&FirehoseClient::DescribeDeliveryStreamAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&FirehoseClient::DescribeDeliveryStreamAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDeliveryStreamOutcome>(), this, request, handler, context);
+}
+
+void FirehoseClient::DescribeDeliveryStreamAsync(DescribeDeliveryStreamRequest&& request, const DescribeDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&FirehoseClient::DescribeDeliveryStreamAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDeliveryStreamOutcome>(), this, std::move(request), handler, context);
 }
 
 void FirehoseClient::DescribeDeliveryStreamAsyncHelper(const DescribeDeliveryStreamRequest& request, const DescribeDeliveryStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -207,12 +237,22 @@ ListDeliveryStreamsOutcome FirehoseClient::ListDeliveryStreams(const ListDeliver
 
 ListDeliveryStreamsOutcomeCallable FirehoseClient::ListDeliveryStreamsCallable(const ListDeliveryStreamsRequest& request) const
 {
-  return std::async(std::launch::async, &FirehoseClient::ListDeliveryStreams, this, request);
+  return m_executor->SubmitWithFuture(&FirehoseClient::ListDeliveryStreams, Aws::Client::RejectedCallOutcome<ListDeliveryStreamsOutcome>(), this, request);
+}
+
+ListDeliveryStreamsOutcomeCallable FirehoseClient::ListDeliveryStreamsCallable(ListDeliveryStreamsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&FirehoseClient::ListDeliveryStreams, Aws::Client::RejectedCallOutcome<ListDeliveryStreamsOutcome>(), this, std::move(request));
 }
 
 void FirehoseClient::ListDeliveryStreamsAsync(const ListDeliveryStreamsRequest& request, const ListDeliveryStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&FirehoseClient::ListDeliveryStreamsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&FirehoseClient::ListDeliveryStreamsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDeliveryStreamsOutcome>(), this, request, handler, context);
+}
+
+void FirehoseClient::ListDeliveryStreamsAsync(ListDeliveryStreamsRequest&& request, const ListDeliveryStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&FirehoseClient::ListDeliveryStreamsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDeliveryStreamsOutcome>(), this, std::move(request), handler, context);
 }
 
 void FirehoseClient::ListDeliveryStreamsAsyncHelper(const ListDeliveryStreamsRequest& request, const ListDeliveryStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -238,12 +278,22 @@ PutRecordOutcome FirehoseClient::PutRecord(const PutRecordRequest& request) cons
 
 PutRecordOutcomeCallable FirehoseClient::PutRecordCallable(const PutRecordRequest& request) const
 {
-  return std::async(std::launch::async, &FirehoseClient::PutRecord, this, request);
+  return m_executor->SubmitWithFuture(&FirehoseClient::PutRecord, Aws::Client::RejectedCallOutcome<PutRecordOutcome>(), this, request);
+}
+
+PutRecordOutcomeCallable FirehoseClient::PutRecordCallable(PutRecordRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&FirehoseClient::PutRecord, Aws::Client::RejectedCallOutcome<PutRecordOutcome>(), this, std::move(request));
 }
 
 void FirehoseClient::PutRecordAsync(const PutRecordRequest& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&FirehoseClient::PutRecordAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&FirehoseClient::PutRecordAsyncHelper, Aws::Client::RejectedAsyncCall<PutRecordOutcome>(), this, request, handler, context);
+}
+
+void FirehoseClient::PutRecordAsync(PutRecordRequest&& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&FirehoseClient::PutRecordAsyncHelper, Aws::Client::RejectedAsyncCall<PutRecordOutcome>(), this, std::move(request), handler, context);
 }
 
 void FirehoseClient::PutRecordAsyncHelper(const PutRecordRequest& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -269,12 +319,22 @@ PutRecordBatchOutcome FirehoseClient::PutRecordBatch(const PutRecordBatchRequest
 
 PutRecordBatchOutcomeCallable FirehoseClient::PutRecordBatchCallable(const PutRecordBatchRequest& request) const
 {
-  return std::async(std::launch::async, &FirehoseClient::PutRecordBatch, this, request);
+  return m_executor->SubmitWithFuture(&FirehoseClient::PutRecordBatch, Aws::Client::RejectedCallOutcome<PutRecordBatchOutcome>(), this, request);
+}
+
+PutRecordBatchOutcomeCallable FirehoseClient::PutRecordBatchCallable(PutRecordBatchRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&FirehoseClient::PutRecordBatch, Aws::Client::RejectedCallOutcome<PutRecordBatchOutcome>(), this, std::move(request));
 }
 
 void FirehoseClient::PutRecordBatchAsync(const PutRecordBatchRequest& request, const PutRecordBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&FirehoseClient::PutRecordBatchAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&FirehoseClient::PutRecordBatchAsyncHelper, Aws::Client::RejectedAsyncCall<PutRecordBatchOutcome>(), this, request, handler, context);
+}
+
+void FirehoseClient::PutRecordBatchAsync(PutRecordBatchRequest&& request, const PutRecordBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&FirehoseClient::PutRecordBatchAsyncHelper, Aws::Client::RejectedAsyncCall<PutRecordBatchOutcome>(), this, std::move(request), handler, context);
 }
 
 void FirehoseClient::PutRecordBatchAsyncHelper(const PutRecordBatchRequest& request, const PutRecordBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -300,12 +360,22 @@ UpdateDestinationOutcome FirehoseClient::UpdateDestination(const UpdateDestinati
 
 UpdateDestinationOutcomeCallable FirehoseClient::UpdateDestinationCallable(const UpdateDestinationRequest& request) const
 {
-  return std::async(std::launch::async, &FirehoseClient::UpdateDestination, this, request);
+  return m_executor->SubmitWithFuture(&FirehoseClient::UpdateDestination, Aws::Client::RejectedCallOutcome<UpdateDestinationOutcome>(), this, request);
+}
+
+UpdateDestinationOutcomeCallable FirehoseClient::UpdateDestinationCallable(UpdateDestinationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&FirehoseClient::UpdateDestination, Aws::Client::RejectedCallOutcome<UpdateDestinationOutcome>(), this, std::move(request));
 }
 
 void FirehoseClient::UpdateDestinationAsync(const UpdateDestinationRequest& request, const UpdateDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&FirehoseClient::UpdateDestinationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&FirehoseClient::UpdateDestinationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDestinationOutcome>(), this, request, handler, context);
+}
+
+void FirehoseClient::UpdateDestinationAsync(UpdateDestinationRequest&& request, const UpdateDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&FirehoseClient::UpdateDestinationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDestinationOutcome>(), this, std::move(request), handler, context);
 }
 
 void FirehoseClient::UpdateDestinationAsyncHelper(const UpdateDestinationRequest& request, const UpdateDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
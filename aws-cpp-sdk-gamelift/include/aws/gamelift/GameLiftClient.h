@@ -51,6 +51,41 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/gamelift/model/CreateAliasRequest.h>
+#include <aws/gamelift/model/CreateBuildRequest.h>
+#include <aws/gamelift/model/CreateFleetRequest.h>
+#include <aws/gamelift/model/CreateGameSessionRequest.h>
+#include <aws/gamelift/model/CreatePlayerSessionRequest.h>
+#include <aws/gamelift/model/CreatePlayerSessionsRequest.h>
+#include <aws/gamelift/model/DeleteAliasRequest.h>
+#include <aws/gamelift/model/DeleteBuildRequest.h>
+#include <aws/gamelift/model/DeleteFleetRequest.h>
+#include <aws/gamelift/model/DescribeAliasRequest.h>
+#include <aws/gamelift/model/DescribeBuildRequest.h>
+#include <aws/gamelift/model/DescribeEC2InstanceLimitsRequest.h>
+#include <aws/gamelift/model/DescribeFleetAttributesRequest.h>
+#include <aws/gamelift/model/DescribeFleetCapacityRequest.h>
+#include <aws/gamelift/model/DescribeFleetEventsRequest.h>
+#include <aws/gamelift/model/DescribeFleetPortSettingsRequest.h>
+#include <aws/gamelift/model/DescribeFleetUtilizationRequest.h>
+#include <aws/gamelift/model/DescribeGameSessionsRequest.h>
+#include <aws/gamelift/model/DescribePlayerSessionsRequest.h>
+#include <aws/gamelift/model/GetGameSessionLogUrlRequest.h>
+#include <aws/gamelift/model/ListAliasesRequest.h>
+#include <aws/gamelift/model/ListBuildsRequest.h>
+#include <aws/gamelift/model/ListFleetsRequest.h>
+#include <aws/gamelift/model/RequestUploadCredentialsRequest.h>
+#include <aws/gamelift/model/ResolveAliasRequest.h>
+#include <aws/gamelift/model/UpdateAliasRequest.h>
+#include <aws/gamelift/model/UpdateBuildRequest.h>
+#include <aws/gamelift/model/UpdateFleetAttributesRequest.h>
+#include <aws/gamelift/model/UpdateFleetCapacityRequest.h>
+#include <aws/gamelift/model/UpdateFleetPortSettingsRequest.h>
+#include <aws/gamelift/model/UpdateGameSessionRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -329,6 +364,11 @@ namespace Model
          */
         virtual Model::CreateAliasOutcomeCallable CreateAliasCallable(const Model::CreateAliasRequest& request) const;
 
+        /**
+         * Same as CreateAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateAliasOutcomeCallable CreateAliasCallable(Model::CreateAliasRequest&& request) const;
+
         /**
          * <p>Creates an alias for a fleet. You can use an alias to anonymize your fleet by
          * referencing an alias instead of a specific fleet when you create game sessions.
@@ -346,6 +386,11 @@ namespace Model
          */
         virtual void CreateAliasAsync(const Model::CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateAliasAsync(Model::CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Initializes a new build record and generates information required to upload a
          * game build to Amazon GameLift. Once the build record has been created and is in
@@ -386,6 +431,11 @@ namespace Model
          */
         virtual Model::CreateBuildOutcomeCallable CreateBuildCallable(const Model::CreateBuildRequest& request) const;
 
+        /**
+         * Same as CreateBuildCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateBuildOutcomeCallable CreateBuildCallable(Model::CreateBuildRequest&& request) const;
+
         /**
          * <p>Initializes a new build record and generates information required to upload a
          * game build to Amazon GameLift. Once the build record has been created and is in
@@ -407,6 +457,11 @@ namespace Model
          */
         virtual void CreateBuildAsync(const Model::CreateBuildRequest& request, const CreateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateBuildAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateBuildAsync(Model::CreateBuildRequest&& request, const CreateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new fleet to host game servers. A fleet consists of a set of Amazon
          * Elastic Compute Cloud (Amazon EC2) instances of a certain type, which defines
@@ -469,6 +524,11 @@ namespace Model
          */
         virtual Model::CreateFleetOutcomeCallable CreateFleetCallable(const Model::CreateFleetRequest& request) const;
 
+        /**
+         * Same as CreateFleetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateFleetOutcomeCallable CreateFleetCallable(Model::CreateFleetRequest&& request) const;
+
         /**
          * <p>Creates a new fleet to host game servers. A fleet consists of a set of Amazon
          * Elastic Compute Cloud (Amazon EC2) instances of a certain type, which defines
@@ -501,6 +561,11 @@ namespace Model
          */
         virtual void CreateFleetAsync(const Model::CreateFleetRequest& request, const CreateFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateFleetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateFleetAsync(Model::CreateFleetRequest&& request, const CreateFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a multiplayer game session for players. This action creates a game
          * session record and assigns the new session to an instance in the specified
@@ -533,6 +598,11 @@ namespace Model
          */
         virtual Model::CreateGameSessionOutcomeCallable CreateGameSessionCallable(const Model::CreateGameSessionRequest& request) const;
 
+        /**
+         * Same as CreateGameSessionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateGameSessionOutcomeCallable CreateGameSessionCallable(Model::CreateGameSessionRequest&& request) const;
+
         /**
          * <p>Creates a multiplayer game session for players. This action creates a game
          * session record and assigns the new session to an instance in the specified
@@ -550,6 +620,11 @@ namespace Model
          */
         virtual void CreateGameSessionAsync(const Model::CreateGameSessionRequest& request, const CreateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateGameSessionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateGameSessionAsync(Model::CreateGameSessionRequest&& request, const CreateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds a player to a game session and creates a player session record. A game
          * session must be in an ACTIVE state, have a creation policy of ALLOW_ALL, and
@@ -572,6 +647,11 @@ namespace Model
          */
         virtual Model::CreatePlayerSessionOutcomeCallable CreatePlayerSessionCallable(const Model::CreatePlayerSessionRequest& request) const;
 
+        /**
+         * Same as CreatePlayerSessionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePlayerSessionOutcomeCallable CreatePlayerSessionCallable(Model::CreatePlayerSessionRequest&& request) const;
+
         /**
          * <p>Adds a player to a game session and creates a player session record. A game
          * session must be in an ACTIVE state, have a creation policy of ALLOW_ALL, and
@@ -584,6 +664,11 @@ namespace Model
          */
         virtual void CreatePlayerSessionAsync(const Model::CreatePlayerSessionRequest& request, const CreatePlayerSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePlayerSessionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePlayerSessionAsync(Model::CreatePlayerSessionRequest&& request, const CreatePlayerSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds a group of players to a game session. Similar to
          * <a>CreatePlayerSession</a>, this action allows you to add multiple players in a
@@ -610,6 +695,11 @@ namespace Model
          */
         virtual Model::CreatePlayerSessionsOutcomeCallable CreatePlayerSessionsCallable(const Model::CreatePlayerSessionsRequest& request) const;
 
+        /**
+         * Same as CreatePlayerSessionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePlayerSessionsOutcomeCallable CreatePlayerSessionsCallable(Model::CreatePlayerSessionsRequest&& request) const;
+
         /**
          * <p>Adds a group of players to a game session. Similar to
          * <a>CreatePlayerSession</a>, this action allows you to add multiple players in a
@@ -624,6 +714,11 @@ namespace Model
          */
         virtual void CreatePlayerSessionsAsync(const Model::CreatePlayerSessionsRequest& request, const CreatePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePlayerSessionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePlayerSessionsAsync(Model::CreatePlayerSessionsRequest&& request, const CreatePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an alias. This action removes all record of the alias; game clients
          * attempting to access a game server using the deleted alias receive an error. To
@@ -640,6 +735,11 @@ namespace Model
          */
         virtual Model::DeleteAliasOutcomeCallable DeleteAliasCallable(const Model::DeleteAliasRequest& request) const;
 
+        /**
+         * Same as DeleteAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteAliasOutcomeCallable DeleteAliasCallable(Model::DeleteAliasRequest&& request) const;
+
         /**
          * <p>Deletes an alias. This action removes all record of the alias; game clients
          * attempting to access a game server using the deleted alias receive an error. To
@@ -649,6 +749,11 @@ namespace Model
          */
         virtual void DeleteAliasAsync(const Model::DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteAliasAsync(Model::DeleteAliasRequest&& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a build. This action permanently deletes the build record and any
          * uploaded build files.</p> <p>To delete a build, specify its ID. Deleting a build
@@ -667,6 +772,11 @@ namespace Model
          */
         virtual Model::DeleteBuildOutcomeCallable DeleteBuildCallable(const Model::DeleteBuildRequest& request) const;
 
+        /**
+         * Same as DeleteBuildCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteBuildOutcomeCallable DeleteBuildCallable(Model::DeleteBuildRequest&& request) const;
+
         /**
          * <p>Deletes a build. This action permanently deletes the build record and any
          * uploaded build files.</p> <p>To delete a build, specify its ID. Deleting a build
@@ -677,6 +787,11 @@ namespace Model
          */
         virtual void DeleteBuildAsync(const Model::DeleteBuildRequest& request, const DeleteBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBuildAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteBuildAsync(Model::DeleteBuildRequest&& request, const DeleteBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes everything related to a fleet. Before deleting a fleet, you must set
          * the fleet's desired capacity to zero. See <a>UpdateFleetCapacity</a>.</p>
@@ -695,6 +810,11 @@ namespace Model
          */
         virtual Model::DeleteFleetOutcomeCallable DeleteFleetCallable(const Model::DeleteFleetRequest& request) const;
 
+        /**
+         * Same as DeleteFleetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteFleetOutcomeCallable DeleteFleetCallable(Model::DeleteFleetRequest&& request) const;
+
         /**
          * <p>Deletes everything related to a fleet. Before deleting a fleet, you must set
          * the fleet's desired capacity to zero. See <a>UpdateFleetCapacity</a>.</p>
@@ -705,6 +825,11 @@ namespace Model
          */
         virtual void DeleteFleetAsync(const Model::DeleteFleetRequest& request, const DeleteFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteFleetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteFleetAsync(Model::DeleteFleetRequest&& request, const DeleteFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves properties for a specified alias. To get the alias, specify an
          * alias ID. If successful, an <a>Alias</a> object is returned.</p>
@@ -719,6 +844,11 @@ namespace Model
          */
         virtual Model::DescribeAliasOutcomeCallable DescribeAliasCallable(const Model::DescribeAliasRequest& request) const;
 
+        /**
+         * Same as DescribeAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAliasOutcomeCallable DescribeAliasCallable(Model::DescribeAliasRequest&& request) const;
+
         /**
          * <p>Retrieves properties for a specified alias. To get the alias, specify an
          * alias ID. If successful, an <a>Alias</a> object is returned.</p>
@@ -727,6 +857,11 @@ namespace Model
          */
         virtual void DescribeAliasAsync(const Model::DescribeAliasRequest& request, const DescribeAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAliasAsync(Model::DescribeAliasRequest&& request, const DescribeAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves properties for a build. To get a build record, specify a build ID.
          * If successful, an object containing the build properties is returned.</p>
@@ -741,6 +876,11 @@ namespace Model
          */
         virtual Model::DescribeBuildOutcomeCallable DescribeBuildCallable(const Model::DescribeBuildRequest& request) const;
 
+        /**
+         * Same as DescribeBuildCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeBuildOutcomeCallable DescribeBuildCallable(Model::DescribeBuildRequest&& request) const;
+
         /**
          * <p>Retrieves properties for a build. To get a build record, specify a build ID.
          * If successful, an object containing the build properties is returned.</p>
@@ -749,6 +889,11 @@ namespace Model
          */
         virtual void DescribeBuildAsync(const Model::DescribeBuildRequest& request, const DescribeBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeBuildAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeBuildAsync(Model::DescribeBuildRequest&& request, const DescribeBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the maximum number of instances allowed, per AWS account, for each
          * specified EC2 instance type. The current usage level for the AWS account is also
@@ -765,6 +910,11 @@ namespace Model
          */
         virtual Model::DescribeEC2InstanceLimitsOutcomeCallable DescribeEC2InstanceLimitsCallable(const Model::DescribeEC2InstanceLimitsRequest& request) const;
 
+        /**
+         * Same as DescribeEC2InstanceLimitsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEC2InstanceLimitsOutcomeCallable DescribeEC2InstanceLimitsCallable(Model::DescribeEC2InstanceLimitsRequest&& request) const;
+
         /**
          * <p>Retrieves the maximum number of instances allowed, per AWS account, for each
          * specified EC2 instance type. The current usage level for the AWS account is also
@@ -774,6 +924,11 @@ namespace Model
          */
         virtual void DescribeEC2InstanceLimitsAsync(const Model::DescribeEC2InstanceLimitsRequest& request, const DescribeEC2InstanceLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEC2InstanceLimitsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEC2InstanceLimitsAsync(Model::DescribeEC2InstanceLimitsRequest&& request, const DescribeEC2InstanceLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves fleet properties, including metadata, status, and configuration,
          * for one or more fleets. You can request attributes for all fleets, or specify a
@@ -802,6 +957,11 @@ namespace Model
          */
         virtual Model::DescribeFleetAttributesOutcomeCallable DescribeFleetAttributesCallable(const Model::DescribeFleetAttributesRequest& request) const;
 
+        /**
+         * Same as DescribeFleetAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeFleetAttributesOutcomeCallable DescribeFleetAttributesCallable(Model::DescribeFleetAttributesRequest&& request) const;
+
         /**
          * <p>Retrieves fleet properties, including metadata, status, and configuration,
          * for one or more fleets. You can request attributes for all fleets, or specify a
@@ -817,6 +977,11 @@ namespace Model
          */
         virtual void DescribeFleetAttributesAsync(const Model::DescribeFleetAttributesRequest& request, const DescribeFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFleetAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeFleetAttributesAsync(Model::DescribeFleetAttributesRequest&& request, const DescribeFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the current status of fleet capacity for one or more fleets. This
          * information includes the number of instances that have been requested for the
@@ -847,6 +1012,11 @@ namespace Model
          */
         virtual Model::DescribeFleetCapacityOutcomeCallable DescribeFleetCapacityCallable(const Model::DescribeFleetCapacityRequest& request) const;
 
+        /**
+         * Same as DescribeFleetCapacityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeFleetCapacityOutcomeCallable DescribeFleetCapacityCallable(Model::DescribeFleetCapacityRequest&& request) const;
+
         /**
          * <p>Retrieves the current status of fleet capacity for one or more fleets. This
          * information includes the number of instances that have been requested for the
@@ -863,6 +1033,11 @@ namespace Model
          */
         virtual void DescribeFleetCapacityAsync(const Model::DescribeFleetCapacityRequest& request, const DescribeFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFleetCapacityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeFleetCapacityAsync(Model::DescribeFleetCapacityRequest&& request, const DescribeFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves entries from the fleet event log. You can specify a time range to
          * limit the result set. Use the pagination parameters to retrieve results as a set
@@ -881,6 +1056,11 @@ namespace Model
          */
         virtual Model::DescribeFleetEventsOutcomeCallable DescribeFleetEventsCallable(const Model::DescribeFleetEventsRequest& request) const;
 
+        /**
+         * Same as DescribeFleetEventsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeFleetEventsOutcomeCallable DescribeFleetEventsCallable(Model::DescribeFleetEventsRequest&& request) const;
+
         /**
          * <p>Retrieves entries from the fleet event log. You can specify a time range to
          * limit the result set. Use the pagination parameters to retrieve results as a set
@@ -891,6 +1071,11 @@ namespace Model
          */
         virtual void DescribeFleetEventsAsync(const Model::DescribeFleetEventsRequest& request, const DescribeFleetEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFleetEventsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeFleetEventsAsync(Model::DescribeFleetEventsRequest&& request, const DescribeFleetEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the port settings for a fleet. Port settings are used to limit
          * incoming traffic access to game servers in the fleet. To get a fleet's port
@@ -911,6 +1096,11 @@ namespace Model
          */
         virtual Model::DescribeFleetPortSettingsOutcomeCallable DescribeFleetPortSettingsCallable(const Model::DescribeFleetPortSettingsRequest& request) const;
 
+        /**
+         * Same as DescribeFleetPortSettingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeFleetPortSettingsOutcomeCallable DescribeFleetPortSettingsCallable(Model::DescribeFleetPortSettingsRequest&& request) const;
+
         /**
          * <p>Retrieves the port settings for a fleet. Port settings are used to limit
          * incoming traffic access to game servers in the fleet. To get a fleet's port
@@ -922,6 +1112,11 @@ namespace Model
          */
         virtual void DescribeFleetPortSettingsAsync(const Model::DescribeFleetPortSettingsRequest& request, const DescribeFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFleetPortSettingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeFleetPortSettingsAsync(Model::DescribeFleetPortSettingsRequest&& request, const DescribeFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves utilization statistics for one or more fleets. You can request
          * utilization data for all fleets, or specify a list of one or more fleet IDs.
@@ -950,6 +1145,11 @@ namespace Model
          */
         virtual Model::DescribeFleetUtilizationOutcomeCallable DescribeFleetUtilizationCallable(const Model::DescribeFleetUtilizationRequest& request) const;
 
+        /**
+         * Same as DescribeFleetUtilizationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeFleetUtilizationOutcomeCallable DescribeFleetUtilizationCallable(Model::DescribeFleetUtilizationRequest&& request) const;
+
         /**
          * <p>Retrieves utilization statistics for one or more fleets. You can request
          * utilization data for all fleets, or specify a list of one or more fleet IDs.
@@ -965,6 +1165,11 @@ namespace Model
          */
         virtual void DescribeFleetUtilizationAsync(const Model::DescribeFleetUtilizationRequest& request, const DescribeFleetUtilizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFleetUtilizationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeFleetUtilizationAsync(Model::DescribeFleetUtilizationRequest&& request, const DescribeFleetUtilizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves properties for one or more game sessions. This action can be used
          * in several ways: (1) provide a <i>GameSessionId</i> parameter to request
@@ -993,6 +1198,11 @@ namespace Model
          */
         virtual Model::DescribeGameSessionsOutcomeCallable DescribeGameSessionsCallable(const Model::DescribeGameSessionsRequest& request) const;
 
+        /**
+         * Same as DescribeGameSessionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeGameSessionsOutcomeCallable DescribeGameSessionsCallable(Model::DescribeGameSessionsRequest&& request) const;
+
         /**
          * <p>Retrieves properties for one or more game sessions. This action can be used
          * in several ways: (1) provide a <i>GameSessionId</i> parameter to request
@@ -1008,6 +1218,11 @@ namespace Model
          */
         virtual void DescribeGameSessionsAsync(const Model::DescribeGameSessionsRequest& request, const DescribeGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeGameSessionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeGameSessionsAsync(Model::DescribeGameSessionsRequest&& request, const DescribeGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves properties for one or more player sessions. This action can be used
          * in several ways: (1) provide a <i>PlayerSessionId</i> parameter to request
@@ -1040,6 +1255,11 @@ namespace Model
          */
         virtual Model::DescribePlayerSessionsOutcomeCallable DescribePlayerSessionsCallable(const Model::DescribePlayerSessionsRequest& request) const;
 
+        /**
+         * Same as DescribePlayerSessionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribePlayerSessionsOutcomeCallable DescribePlayerSessionsCallable(Model::DescribePlayerSessionsRequest&& request) const;
+
         /**
          * <p>Retrieves properties for one or more player sessions. This action can be used
          * in several ways: (1) provide a <i>PlayerSessionId</i> parameter to request
@@ -1057,6 +1277,11 @@ namespace Model
          */
         virtual void DescribePlayerSessionsAsync(const Model::DescribePlayerSessionsRequest& request, const DescribePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribePlayerSessionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribePlayerSessionsAsync(Model::DescribePlayerSessionsRequest&& request, const DescribePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the location of stored game session logs for a specified game
          * session. When a game session is terminated, Amazon GameLift automatically stores
@@ -1081,6 +1306,11 @@ namespace Model
          */
         virtual Model::GetGameSessionLogUrlOutcomeCallable GetGameSessionLogUrlCallable(const Model::GetGameSessionLogUrlRequest& request) const;
 
+        /**
+         * Same as GetGameSessionLogUrlCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetGameSessionLogUrlOutcomeCallable GetGameSessionLogUrlCallable(Model::GetGameSessionLogUrlRequest&& request) const;
+
         /**
          * <p>Retrieves the location of stored game session logs for a specified game
          * session. When a game session is terminated, Amazon GameLift automatically stores
@@ -1094,6 +1324,11 @@ namespace Model
          */
         virtual void GetGameSessionLogUrlAsync(const Model::GetGameSessionLogUrlRequest& request, const GetGameSessionLogUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetGameSessionLogUrlAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetGameSessionLogUrlAsync(Model::GetGameSessionLogUrlRequest&& request, const GetGameSessionLogUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a collection of alias records for this AWS account. You can filter
          * the result set by alias name and/or routing strategy type. Use the pagination
@@ -1112,6 +1347,11 @@ namespace Model
          */
         virtual Model::ListAliasesOutcomeCallable ListAliasesCallable(const Model::ListAliasesRequest& request) const;
 
+        /**
+         * Same as ListAliasesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAliasesOutcomeCallable ListAliasesCallable(Model::ListAliasesRequest&& request) const;
+
         /**
          * <p>Retrieves a collection of alias records for this AWS account. You can filter
          * the result set by alias name and/or routing strategy type. Use the pagination
@@ -1122,6 +1362,11 @@ namespace Model
          */
         virtual void ListAliasesAsync(const Model::ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAliasesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAliasesAsync(Model::ListAliasesRequest&& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves build records for all builds associated with an AWS account. You
          * can filter the result set by build status. Use the pagination parameters to
@@ -1140,6 +1385,11 @@ namespace Model
          */
         virtual Model::ListBuildsOutcomeCallable ListBuildsCallable(const Model::ListBuildsRequest& request) const;
 
+        /**
+         * Same as ListBuildsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListBuildsOutcomeCallable ListBuildsCallable(Model::ListBuildsRequest&& request) const;
+
         /**
          * <p>Retrieves build records for all builds associated with an AWS account. You
          * can filter the result set by build status. Use the pagination parameters to
@@ -1150,6 +1400,11 @@ namespace Model
          */
         virtual void ListBuildsAsync(const Model::ListBuildsRequest& request, const ListBuildsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListBuildsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListBuildsAsync(Model::ListBuildsRequest&& request, const ListBuildsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a collection of fleet records for this AWS account. You can filter
          * the result set by build ID. Use the pagination parameters to retrieve results in
@@ -1168,6 +1423,11 @@ namespace Model
          */
         virtual Model::ListFleetsOutcomeCallable ListFleetsCallable(const Model::ListFleetsRequest& request) const;
 
+        /**
+         * Same as ListFleetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListFleetsOutcomeCallable ListFleetsCallable(Model::ListFleetsRequest&& request) const;
+
         /**
          * <p>Retrieves a collection of fleet records for this AWS account. You can filter
          * the result set by build ID. Use the pagination parameters to retrieve results in
@@ -1178,6 +1438,11 @@ namespace Model
          */
         virtual void ListFleetsAsync(const Model::ListFleetsRequest& request, const ListFleetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListFleetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListFleetsAsync(Model::ListFleetsRequest&& request, const ListFleetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a fresh set of upload credentials and the assigned Amazon S3
          * storage location for a specific build. Valid credentials are required to upload
@@ -1208,6 +1473,11 @@ namespace Model
          */
         virtual Model::RequestUploadCredentialsOutcomeCallable RequestUploadCredentialsCallable(const Model::RequestUploadCredentialsRequest& request) const;
 
+        /**
+         * Same as RequestUploadCredentialsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RequestUploadCredentialsOutcomeCallable RequestUploadCredentialsCallable(Model::RequestUploadCredentialsRequest&& request) const;
+
         /**
          * <p>Retrieves a fresh set of upload credentials and the assigned Amazon S3
          * storage location for a specific build. Valid credentials are required to upload
@@ -1224,6 +1494,11 @@ namespace Model
          */
         virtual void RequestUploadCredentialsAsync(const Model::RequestUploadCredentialsRequest& request, const RequestUploadCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RequestUploadCredentialsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RequestUploadCredentialsAsync(Model::RequestUploadCredentialsRequest&& request, const RequestUploadCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the fleet ID that a specified alias is currently pointing to. </p>
          */
@@ -1236,6 +1511,11 @@ namespace Model
          */
         virtual Model::ResolveAliasOutcomeCallable ResolveAliasCallable(const Model::ResolveAliasRequest& request) const;
 
+        /**
+         * Same as ResolveAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ResolveAliasOutcomeCallable ResolveAliasCallable(Model::ResolveAliasRequest&& request) const;
+
         /**
          * <p>Retrieves the fleet ID that a specified alias is currently pointing to. </p>
          *
@@ -1243,6 +1523,11 @@ namespace Model
          */
         virtual void ResolveAliasAsync(const Model::ResolveAliasRequest& request, const ResolveAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResolveAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ResolveAliasAsync(Model::ResolveAliasRequest&& request, const ResolveAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates properties for an alias. To update properties, specify the alias ID
          * to be updated and provide the information to be changed. To reassign an alias to
@@ -1261,6 +1546,11 @@ namespace Model
          */
         virtual Model::UpdateAliasOutcomeCallable UpdateAliasCallable(const Model::UpdateAliasRequest& request) const;
 
+        /**
+         * Same as UpdateAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateAliasOutcomeCallable UpdateAliasCallable(Model::UpdateAliasRequest&& request) const;
+
         /**
          * <p>Updates properties for an alias. To update properties, specify the alias ID
          * to be updated and provide the information to be changed. To reassign an alias to
@@ -1271,6 +1561,11 @@ namespace Model
          */
         virtual void UpdateAliasAsync(const Model::UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateAliasAsync(Model::UpdateAliasRequest&& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates metadata in a build record, including the build name and version. To
          * update the metadata, specify the build ID to update and provide the new values.
@@ -1287,6 +1582,11 @@ namespace Model
          */
         virtual Model::UpdateBuildOutcomeCallable UpdateBuildCallable(const Model::UpdateBuildRequest& request) const;
 
+        /**
+         * Same as UpdateBuildCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateBuildOutcomeCallable UpdateBuildCallable(Model::UpdateBuildRequest&& request) const;
+
         /**
          * <p>Updates metadata in a build record, including the build name and version. To
          * update the metadata, specify the build ID to update and provide the new values.
@@ -1296,6 +1596,11 @@ namespace Model
          */
         virtual void UpdateBuildAsync(const Model::UpdateBuildRequest& request, const UpdateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateBuildAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateBuildAsync(Model::UpdateBuildRequest&& request, const UpdateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates fleet properties, including name and description, for a fleet. To
          * update metadata, specify the fleet ID and the property values you want to
@@ -1312,6 +1617,11 @@ namespace Model
          */
         virtual Model::UpdateFleetAttributesOutcomeCallable UpdateFleetAttributesCallable(const Model::UpdateFleetAttributesRequest& request) const;
 
+        /**
+         * Same as UpdateFleetAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateFleetAttributesOutcomeCallable UpdateFleetAttributesCallable(Model::UpdateFleetAttributesRequest&& request) const;
+
         /**
          * <p>Updates fleet properties, including name and description, for a fleet. To
          * update metadata, specify the fleet ID and the property values you want to
@@ -1321,6 +1631,11 @@ namespace Model
          */
         virtual void UpdateFleetAttributesAsync(const Model::UpdateFleetAttributesRequest& request, const UpdateFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateFleetAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateFleetAttributesAsync(Model::UpdateFleetAttributesRequest&& request, const UpdateFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates capacity settings for a fleet. Use this action to specify the number
          * of EC2 instances (hosts) you want this fleet to contain. Before calling this
@@ -1351,6 +1666,11 @@ namespace Model
          */
         virtual Model::UpdateFleetCapacityOutcomeCallable UpdateFleetCapacityCallable(const Model::UpdateFleetCapacityRequest& request) const;
 
+        /**
+         * Same as UpdateFleetCapacityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateFleetCapacityOutcomeCallable UpdateFleetCapacityCallable(Model::UpdateFleetCapacityRequest&& request) const;
+
         /**
          * <p>Updates capacity settings for a fleet. Use this action to specify the number
          * of EC2 instances (hosts) you want this fleet to contain. Before calling this
@@ -1367,6 +1687,11 @@ namespace Model
          */
         virtual void UpdateFleetCapacityAsync(const Model::UpdateFleetCapacityRequest& request, const UpdateFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateFleetCapacityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateFleetCapacityAsync(Model::UpdateFleetCapacityRequest&& request, const UpdateFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates port settings for a fleet. To update settings, specify the fleet ID
          * to be updated and list the permissions you want to update. List the permissions
@@ -1389,6 +1714,11 @@ namespace Model
          */
         virtual Model::UpdateFleetPortSettingsOutcomeCallable UpdateFleetPortSettingsCallable(const Model::UpdateFleetPortSettingsRequest& request) const;
 
+        /**
+         * Same as UpdateFleetPortSettingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateFleetPortSettingsOutcomeCallable UpdateFleetPortSettingsCallable(Model::UpdateFleetPortSettingsRequest&& request) const;
+
         /**
          * <p>Updates port settings for a fleet. To update settings, specify the fleet ID
          * to be updated and list the permissions you want to update. List the permissions
@@ -1401,6 +1731,11 @@ namespace Model
          */
         virtual void UpdateFleetPortSettingsAsync(const Model::UpdateFleetPortSettingsRequest& request, const UpdateFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateFleetPortSettingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateFleetPortSettingsAsync(Model::UpdateFleetPortSettingsRequest&& request, const UpdateFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates game session properties. This includes the session name, maximum
          * player count and the player session creation policy, which either allows or
@@ -1421,6 +1756,11 @@ namespace Model
          */
         virtual Model::UpdateGameSessionOutcomeCallable UpdateGameSessionCallable(const Model::UpdateGameSessionRequest& request) const;
 
+        /**
+         * Same as UpdateGameSessionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateGameSessionOutcomeCallable UpdateGameSessionCallable(Model::UpdateGameSessionRequest&& request) const;
+
         /**
          * <p>Updates game session properties. This includes the session name, maximum
          * player count and the player session creation policy, which either allows or
@@ -1432,6 +1772,80 @@ namespace Model
          */
         virtual void UpdateGameSessionAsync(const Model::UpdateGameSessionRequest& request, const UpdateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateGameSessionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateGameSessionAsync(Model::UpdateGameSessionRequest&& request, const UpdateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAliasOutcome> CreateAliasAwaitable(const Model::CreateAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::CreateAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAliasOutcome> CreateAliasAwaitable(Model::CreateAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::CreateAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateBuildOutcome> CreateBuildAwaitable(const Model::CreateBuildRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::CreateBuild, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateBuildOutcome> CreateBuildAwaitable(Model::CreateBuildRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::CreateBuild, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateFleetOutcome> CreateFleetAwaitable(const Model::CreateFleetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::CreateFleet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateFleetOutcome> CreateFleetAwaitable(Model::CreateFleetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::CreateFleet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateGameSessionOutcome> CreateGameSessionAwaitable(const Model::CreateGameSessionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::CreateGameSession, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateGameSessionOutcome> CreateGameSessionAwaitable(Model::CreateGameSessionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::CreateGameSession, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePlayerSessionOutcome> CreatePlayerSessionAwaitable(const Model::CreatePlayerSessionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::CreatePlayerSession, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePlayerSessionOutcome> CreatePlayerSessionAwaitable(Model::CreatePlayerSessionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::CreatePlayerSession, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePlayerSessionsOutcome> CreatePlayerSessionsAwaitable(const Model::CreatePlayerSessionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::CreatePlayerSessions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePlayerSessionsOutcome> CreatePlayerSessionsAwaitable(Model::CreatePlayerSessionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::CreatePlayerSessions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAliasOutcome> DeleteAliasAwaitable(const Model::DeleteAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DeleteAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAliasOutcome> DeleteAliasAwaitable(Model::DeleteAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DeleteAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBuildOutcome> DeleteBuildAwaitable(const Model::DeleteBuildRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DeleteBuild, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBuildOutcome> DeleteBuildAwaitable(Model::DeleteBuildRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DeleteBuild, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteFleetOutcome> DeleteFleetAwaitable(const Model::DeleteFleetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DeleteFleet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteFleetOutcome> DeleteFleetAwaitable(Model::DeleteFleetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DeleteFleet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAliasOutcome> DescribeAliasAwaitable(const Model::DescribeAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAliasOutcome> DescribeAliasAwaitable(Model::DescribeAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeBuildOutcome> DescribeBuildAwaitable(const Model::DescribeBuildRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeBuild, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeBuildOutcome> DescribeBuildAwaitable(Model::DescribeBuildRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeBuild, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEC2InstanceLimitsOutcome> DescribeEC2InstanceLimitsAwaitable(const Model::DescribeEC2InstanceLimitsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeEC2InstanceLimits, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEC2InstanceLimitsOutcome> DescribeEC2InstanceLimitsAwaitable(Model::DescribeEC2InstanceLimitsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeEC2InstanceLimits, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFleetAttributesOutcome> DescribeFleetAttributesAwaitable(const Model::DescribeFleetAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeFleetAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFleetAttributesOutcome> DescribeFleetAttributesAwaitable(Model::DescribeFleetAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeFleetAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFleetCapacityOutcome> DescribeFleetCapacityAwaitable(const Model::DescribeFleetCapacityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeFleetCapacity, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFleetCapacityOutcome> DescribeFleetCapacityAwaitable(Model::DescribeFleetCapacityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeFleetCapacity, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFleetEventsOutcome> DescribeFleetEventsAwaitable(const Model::DescribeFleetEventsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeFleetEvents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFleetEventsOutcome> DescribeFleetEventsAwaitable(Model::DescribeFleetEventsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeFleetEvents, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFleetPortSettingsOutcome> DescribeFleetPortSettingsAwaitable(const Model::DescribeFleetPortSettingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeFleetPortSettings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFleetPortSettingsOutcome> DescribeFleetPortSettingsAwaitable(Model::DescribeFleetPortSettingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeFleetPortSettings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFleetUtilizationOutcome> DescribeFleetUtilizationAwaitable(const Model::DescribeFleetUtilizationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeFleetUtilization, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFleetUtilizationOutcome> DescribeFleetUtilizationAwaitable(Model::DescribeFleetUtilizationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeFleetUtilization, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeGameSessionsOutcome> DescribeGameSessionsAwaitable(const Model::DescribeGameSessionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeGameSessions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeGameSessionsOutcome> DescribeGameSessionsAwaitable(Model::DescribeGameSessionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribeGameSessions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribePlayerSessionsOutcome> DescribePlayerSessionsAwaitable(const Model::DescribePlayerSessionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribePlayerSessions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribePlayerSessionsOutcome> DescribePlayerSessionsAwaitable(Model::DescribePlayerSessionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::DescribePlayerSessions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetGameSessionLogUrlOutcome> GetGameSessionLogUrlAwaitable(const Model::GetGameSessionLogUrlRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::GetGameSessionLogUrl, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetGameSessionLogUrlOutcome> GetGameSessionLogUrlAwaitable(Model::GetGameSessionLogUrlRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::GetGameSessionLogUrl, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAliasesOutcome> ListAliasesAwaitable(const Model::ListAliasesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::ListAliases, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAliasesOutcome> ListAliasesAwaitable(Model::ListAliasesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::ListAliases, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListBuildsOutcome> ListBuildsAwaitable(const Model::ListBuildsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::ListBuilds, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListBuildsOutcome> ListBuildsAwaitable(Model::ListBuildsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::ListBuilds, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListFleetsOutcome> ListFleetsAwaitable(const Model::ListFleetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::ListFleets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListFleetsOutcome> ListFleetsAwaitable(Model::ListFleetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::ListFleets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RequestUploadCredentialsOutcome> RequestUploadCredentialsAwaitable(const Model::RequestUploadCredentialsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::RequestUploadCredentials, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RequestUploadCredentialsOutcome> RequestUploadCredentialsAwaitable(Model::RequestUploadCredentialsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::RequestUploadCredentials, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResolveAliasOutcome> ResolveAliasAwaitable(const Model::ResolveAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::ResolveAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResolveAliasOutcome> ResolveAliasAwaitable(Model::ResolveAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::ResolveAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAliasOutcome> UpdateAliasAwaitable(const Model::UpdateAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::UpdateAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAliasOutcome> UpdateAliasAwaitable(Model::UpdateAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::UpdateAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateBuildOutcome> UpdateBuildAwaitable(const Model::UpdateBuildRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::UpdateBuild, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateBuildOutcome> UpdateBuildAwaitable(Model::UpdateBuildRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::UpdateBuild, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateFleetAttributesOutcome> UpdateFleetAttributesAwaitable(const Model::UpdateFleetAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::UpdateFleetAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateFleetAttributesOutcome> UpdateFleetAttributesAwaitable(Model::UpdateFleetAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::UpdateFleetAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateFleetCapacityOutcome> UpdateFleetCapacityAwaitable(const Model::UpdateFleetCapacityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::UpdateFleetCapacity, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateFleetCapacityOutcome> UpdateFleetCapacityAwaitable(Model::UpdateFleetCapacityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::UpdateFleetCapacity, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateFleetPortSettingsOutcome> UpdateFleetPortSettingsAwaitable(const Model::UpdateFleetPortSettingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::UpdateFleetPortSettings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateFleetPortSettingsOutcome> UpdateFleetPortSettingsAwaitable(Model::UpdateFleetPortSettingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::UpdateFleetPortSettings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateGameSessionOutcome> UpdateGameSessionAwaitable(const Model::UpdateGameSessionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::UpdateGameSession, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateGameSessionOutcome> UpdateGameSessionAwaitable(Model::UpdateGameSessionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GameLiftClient::UpdateGameSession, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
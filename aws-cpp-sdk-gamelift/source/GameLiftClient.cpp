@@ -138,12 +138,22 @@ CreateAliasOutcome GameLiftClient::CreateAlias(const CreateAliasRequest& request
 
 CreateAliasOutcomeCallable GameLiftClient::CreateAliasCallable(const CreateAliasRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::CreateAlias, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::CreateAlias, Aws::Client::RejectedCallOutcome<CreateAliasOutcome>(), this, request);
+}
+
+CreateAliasOutcomeCallable GameLiftClient::CreateAliasCallable(CreateAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::CreateAlias, Aws::Client::RejectedCallOutcome<CreateAliasOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::CreateAliasAsync(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::CreateAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::CreateAliasAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAliasOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::CreateAliasAsync(CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::CreateAliasAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::CreateAliasAsyncHelper(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -169,12 +179,22 @@ CreateBuildOutcome GameLiftClient::CreateBuild(const CreateBuildRequest& request
 
 CreateBuildOutcomeCallable GameLiftClient::CreateBuildCallable(const CreateBuildRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::CreateBuild, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::CreateBuild, Aws::Client::RejectedCallOutcome<CreateBuildOutcome>(), this, request);
+}
+
+CreateBuildOutcomeCallable GameLiftClient::CreateBuildCallable(CreateBuildRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::CreateBuild, Aws::Client::RejectedCallOutcome<CreateBuildOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::CreateBuildAsync(const CreateBuildRequest& request, const CreateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::CreateBuildAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::CreateBuildAsyncHelper, Aws::Client::RejectedAsyncCall<CreateBuildOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::CreateBuildAsync(CreateBuildRequest&& request, const CreateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::CreateBuildAsyncHelper, Aws::Client::RejectedAsyncCall<CreateBuildOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::CreateBuildAsyncHelper(const CreateBuildRequest& request, const CreateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -200,12 +220,22 @@ CreateFleetOutcome GameLiftClient::CreateFleet(const CreateFleetRequest& request
 
 CreateFleetOutcomeCallable GameLiftClient::CreateFleetCallable(const CreateFleetRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::CreateFleet, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::CreateFleet, Aws::Client::RejectedCallOutcome<CreateFleetOutcome>(), this, request);
+}
+
+CreateFleetOutcomeCallable GameLiftClient::CreateFleetCallable(CreateFleetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::CreateFleet, Aws::Client::RejectedCallOutcome<CreateFleetOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::CreateFleetAsync(const CreateFleetRequest& request, const CreateFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::CreateFleetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::CreateFleetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateFleetOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::CreateFleetAsync(CreateFleetRequest&& request, const CreateFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::CreateFleetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateFleetOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::CreateFleetAsyncHelper(const CreateFleetRequest& request, const CreateFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -231,12 +261,22 @@ CreateGameSessionOutcome GameLiftClient::CreateGameSession(const CreateGameSessi
 
 CreateGameSessionOutcomeCallable GameLiftClient::CreateGameSessionCallable(const CreateGameSessionRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::CreateGameSession, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::CreateGameSession, Aws::Client::RejectedCallOutcome<CreateGameSessionOutcome>(), this, request);
+}
+
+CreateGameSessionOutcomeCallable GameLiftClient::CreateGameSessionCallable(CreateGameSessionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::CreateGameSession, Aws::Client::RejectedCallOutcome<CreateGameSessionOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::CreateGameSessionAsync(const CreateGameSessionRequest& request, const CreateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::CreateGameSessionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::CreateGameSessionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateGameSessionOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::CreateGameSessionAsync(CreateGameSessionRequest&& request, const CreateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::CreateGameSessionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateGameSessionOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::CreateGameSessionAsyncHelper(const CreateGameSessionRequest& request, const CreateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -262,12 +302,22 @@ CreatePlayerSessionOutcome GameLiftClient::CreatePlayerSession(const CreatePlaye
 
 CreatePlayerSessionOutcomeCallable GameLiftClient::CreatePlayerSessionCallable(const CreatePlayerSessionRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::CreatePlayerSession, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::CreatePlayerSession, Aws::Client::RejectedCallOutcome<CreatePlayerSessionOutcome>(), this, request);
+}
+
+CreatePlayerSessionOutcomeCallable GameLiftClient::CreatePlayerSessionCallable(CreatePlayerSessionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::CreatePlayerSession, Aws::Client::RejectedCallOutcome<CreatePlayerSessionOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::CreatePlayerSessionAsync(const CreatePlayerSessionRequest& request, const CreatePlayerSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::CreatePlayerSessionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::CreatePlayerSessionAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePlayerSessionOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::CreatePlayerSessionAsync(CreatePlayerSessionRequest&& request, const CreatePlayerSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::CreatePlayerSessionAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePlayerSessionOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::CreatePlayerSessionAsyncHelper(const CreatePlayerSessionRequest& request, const CreatePlayerSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -293,12 +343,22 @@ CreatePlayerSessionsOutcome GameLiftClient::CreatePlayerSessions(const CreatePla
 
 CreatePlayerSessionsOutcomeCallable GameLiftClient::CreatePlayerSessionsCallable(const CreatePlayerSessionsRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::CreatePlayerSessions, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::CreatePlayerSessions, Aws::Client::RejectedCallOutcome<CreatePlayerSessionsOutcome>(), this, request);
+}
+
+CreatePlayerSessionsOutcomeCallable GameLiftClient::CreatePlayerSessionsCallable(CreatePlayerSessionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::CreatePlayerSessions, Aws::Client::RejectedCallOutcome<CreatePlayerSessionsOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::CreatePlayerSessionsAsync(const CreatePlayerSessionsRequest& request, const CreatePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::CreatePlayerSessionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::CreatePlayerSessionsAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePlayerSessionsOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::CreatePlayerSessionsAsync(CreatePlayerSessionsRequest&& request, const CreatePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::CreatePlayerSessionsAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePlayerSessionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::CreatePlayerSessionsAsyncHelper(const CreatePlayerSessionsRequest& request, const CreatePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -324,12 +384,22 @@ DeleteAliasOutcome GameLiftClient::DeleteAlias(const DeleteAliasRequest& request
 
 DeleteAliasOutcomeCallable GameLiftClient::DeleteAliasCallable(const DeleteAliasRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::DeleteAlias, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::DeleteAlias, Aws::Client::RejectedCallOutcome<DeleteAliasOutcome>(), this, request);
+}
+
+DeleteAliasOutcomeCallable GameLiftClient::DeleteAliasCallable(DeleteAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::DeleteAlias, Aws::Client::RejectedCallOutcome<DeleteAliasOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::DeleteAliasAsync(const DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::DeleteAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::DeleteAliasAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAliasOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::DeleteAliasAsync(DeleteAliasRequest&& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::DeleteAliasAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::DeleteAliasAsyncHelper(const DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -355,12 +425,22 @@ DeleteBuildOutcome GameLiftClient::DeleteBuild(const DeleteBuildRequest& request
 
 DeleteBuildOutcomeCallable GameLiftClient::DeleteBuildCallable(const DeleteBuildRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::DeleteBuild, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::DeleteBuild, Aws::Client::RejectedCallOutcome<DeleteBuildOutcome>(), this, request);
+}
+
+DeleteBuildOutcomeCallable GameLiftClient::DeleteBuildCallable(DeleteBuildRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::DeleteBuild, Aws::Client::RejectedCallOutcome<DeleteBuildOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::DeleteBuildAsync(const DeleteBuildRequest& request, const DeleteBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::DeleteBuildAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::DeleteBuildAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBuildOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::DeleteBuildAsync(DeleteBuildRequest&& request, const DeleteBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::DeleteBuildAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBuildOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::DeleteBuildAsyncHelper(const DeleteBuildRequest& request, const DeleteBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -386,12 +466,22 @@ DeleteFleetOutcome GameLiftClient::DeleteFleet(const DeleteFleetRequest& request
 
 DeleteFleetOutcomeCallable GameLiftClient::DeleteFleetCallable(const DeleteFleetRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::DeleteFleet, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::DeleteFleet, Aws::Client::RejectedCallOutcome<DeleteFleetOutcome>(), this, request);
+}
+
+DeleteFleetOutcomeCallable GameLiftClient::DeleteFleetCallable(DeleteFleetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::DeleteFleet, Aws::Client::RejectedCallOutcome<DeleteFleetOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::DeleteFleetAsync(const DeleteFleetRequest& request, const DeleteFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::DeleteFleetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::DeleteFleetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteFleetOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::DeleteFleetAsync(DeleteFleetRequest&& request, const DeleteFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::DeleteFleetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteFleetOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::DeleteFleetAsyncHelper(const DeleteFleetRequest& request, const DeleteFleetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -417,12 +507,22 @@ DescribeAliasOutcome GameLiftClient::DescribeAlias(const DescribeAliasRequest& r
 
 DescribeAliasOutcomeCallable GameLiftClient::DescribeAliasCallable(const DescribeAliasRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::DescribeAlias, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeAlias, Aws::Client::RejectedCallOutcome<DescribeAliasOutcome>(), this, request);
+}
+
+DescribeAliasOutcomeCallable GameLiftClient::DescribeAliasCallable(DescribeAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeAlias, Aws::Client::RejectedCallOutcome<DescribeAliasOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::DescribeAliasAsync(const DescribeAliasRequest& request, const DescribeAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::DescribeAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeAliasAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAliasOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::DescribeAliasAsync(DescribeAliasRequest&& request, const DescribeAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeAliasAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::DescribeAliasAsyncHelper(const DescribeAliasRequest& request, const DescribeAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -448,12 +548,22 @@ DescribeBuildOutcome GameLiftClient::DescribeBuild(const DescribeBuildRequest& r
 
 DescribeBuildOutcomeCallable GameLiftClient::DescribeBuildCallable(const DescribeBuildRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::DescribeBuild, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeBuild, Aws::Client::RejectedCallOutcome<DescribeBuildOutcome>(), this, request);
+}
+
+DescribeBuildOutcomeCallable GameLiftClient::DescribeBuildCallable(DescribeBuildRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeBuild, Aws::Client::RejectedCallOutcome<DescribeBuildOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::DescribeBuildAsync(const DescribeBuildRequest& request, const DescribeBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::DescribeBuildAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeBuildAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeBuildOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::DescribeBuildAsync(DescribeBuildRequest&& request, const DescribeBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeBuildAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeBuildOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::DescribeBuildAsyncHelper(const DescribeBuildRequest& request, const DescribeBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -479,12 +589,22 @@ DescribeEC2InstanceLimitsOutcome GameLiftClient::DescribeEC2InstanceLimits(const
 
 DescribeEC2InstanceLimitsOutcomeCallable GameLiftClient::DescribeEC2InstanceLimitsCallable(const DescribeEC2InstanceLimitsRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::DescribeEC2InstanceLimits, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeEC2InstanceLimits, Aws::Client::RejectedCallOutcome<DescribeEC2InstanceLimitsOutcome>(), this, request);
+}
+
+DescribeEC2InstanceLimitsOutcomeCallable GameLiftClient::DescribeEC2InstanceLimitsCallable(DescribeEC2InstanceLimitsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeEC2InstanceLimits, Aws::Client::RejectedCallOutcome<DescribeEC2InstanceLimitsOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::DescribeEC2InstanceLimitsAsync(const DescribeEC2InstanceLimitsRequest& request, const DescribeEC2InstanceLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::DescribeEC2InstanceLimitsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeEC2InstanceLimitsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEC2InstanceLimitsOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::DescribeEC2InstanceLimitsAsync(DescribeEC2InstanceLimitsRequest&& request, const DescribeEC2InstanceLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeEC2InstanceLimitsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEC2InstanceLimitsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::DescribeEC2InstanceLimitsAsyncHelper(const DescribeEC2InstanceLimitsRequest& request, const DescribeEC2InstanceLimitsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -510,12 +630,22 @@ DescribeFleetAttributesOutcome GameLiftClient::DescribeFleetAttributes(const Des
 
 DescribeFleetAttributesOutcomeCallable GameLiftClient::DescribeFleetAttributesCallable(const DescribeFleetAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::DescribeFleetAttributes, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeFleetAttributes, Aws::Client::RejectedCallOutcome<DescribeFleetAttributesOutcome>(), this, request);
+}
+
+DescribeFleetAttributesOutcomeCallable GameLiftClient::DescribeFleetAttributesCallable(DescribeFleetAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeFleetAttributes, Aws::Client::RejectedCallOutcome<DescribeFleetAttributesOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::DescribeFleetAttributesAsync(const DescribeFleetAttributesRequest& request, const DescribeFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::DescribeFleetAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeFleetAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFleetAttributesOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::DescribeFleetAttributesAsync(DescribeFleetAttributesRequest&& request, const DescribeFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeFleetAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFleetAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::DescribeFleetAttributesAsyncHelper(const DescribeFleetAttributesRequest& request, const DescribeFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -541,12 +671,22 @@ DescribeFleetCapacityOutcome GameLiftClient::DescribeFleetCapacity(const Describ
 
 DescribeFleetCapacityOutcomeCallable GameLiftClient::DescribeFleetCapacityCallable(const DescribeFleetCapacityRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::DescribeFleetCapacity, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeFleetCapacity, Aws::Client::RejectedCallOutcome<DescribeFleetCapacityOutcome>(), this, request);
+}
+
+DescribeFleetCapacityOutcomeCallable GameLiftClient::DescribeFleetCapacityCallable(DescribeFleetCapacityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeFleetCapacity, Aws::Client::RejectedCallOutcome<DescribeFleetCapacityOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::DescribeFleetCapacityAsync(const DescribeFleetCapacityRequest& request, const DescribeFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::DescribeFleetCapacityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeFleetCapacityAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFleetCapacityOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::DescribeFleetCapacityAsync(DescribeFleetCapacityRequest&& request, const DescribeFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeFleetCapacityAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFleetCapacityOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::DescribeFleetCapacityAsyncHelper(const DescribeFleetCapacityRequest& request, const DescribeFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -572,12 +712,22 @@ DescribeFleetEventsOutcome GameLiftClient::DescribeFleetEvents(const DescribeFle
 
 DescribeFleetEventsOutcomeCallable GameLiftClient::DescribeFleetEventsCallable(const DescribeFleetEventsRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::DescribeFleetEvents, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeFleetEvents, Aws::Client::RejectedCallOutcome<DescribeFleetEventsOutcome>(), this, request);
+}
+
+DescribeFleetEventsOutcomeCallable GameLiftClient::DescribeFleetEventsCallable(DescribeFleetEventsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeFleetEvents, Aws::Client::RejectedCallOutcome<DescribeFleetEventsOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::DescribeFleetEventsAsync(const DescribeFleetEventsRequest& request, const DescribeFleetEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::DescribeFleetEventsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeFleetEventsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFleetEventsOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::DescribeFleetEventsAsync(DescribeFleetEventsRequest&& request, const DescribeFleetEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeFleetEventsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFleetEventsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::DescribeFleetEventsAsyncHelper(const DescribeFleetEventsRequest& request, const DescribeFleetEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -603,12 +753,22 @@ DescribeFleetPortSettingsOutcome GameLiftClient::DescribeFleetPortSettings(const
 
 DescribeFleetPortSettingsOutcomeCallable GameLiftClient::DescribeFleetPortSettingsCallable(const DescribeFleetPortSettingsRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::DescribeFleetPortSettings, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeFleetPortSettings, Aws::Client::RejectedCallOutcome<DescribeFleetPortSettingsOutcome>(), this, request);
+}
+
+DescribeFleetPortSettingsOutcomeCallable GameLiftClient::DescribeFleetPortSettingsCallable(DescribeFleetPortSettingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeFleetPortSettings, Aws::Client::RejectedCallOutcome<DescribeFleetPortSettingsOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::DescribeFleetPortSettingsAsync(const DescribeFleetPortSettingsRequest& request, const DescribeFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::DescribeFleetPortSettingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeFleetPortSettingsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFleetPortSettingsOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::DescribeFleetPortSettingsAsync(DescribeFleetPortSettingsRequest&& request, const DescribeFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeFleetPortSettingsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFleetPortSettingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::DescribeFleetPortSettingsAsyncHelper(const DescribeFleetPortSettingsRequest& request, const DescribeFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -634,12 +794,22 @@ DescribeFleetUtilizationOutcome GameLiftClient::DescribeFleetUtilization(const D
 
 DescribeFleetUtilizationOutcomeCallable GameLiftClient::DescribeFleetUtilizationCallable(const DescribeFleetUtilizationRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::DescribeFleetUtilization, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeFleetUtilization, Aws::Client::RejectedCallOutcome<DescribeFleetUtilizationOutcome>(), this, request);
+}
+
+DescribeFleetUtilizationOutcomeCallable GameLiftClient::DescribeFleetUtilizationCallable(DescribeFleetUtilizationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeFleetUtilization, Aws::Client::RejectedCallOutcome<DescribeFleetUtilizationOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::DescribeFleetUtilizationAsync(const DescribeFleetUtilizationRequest& request, const DescribeFleetUtilizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::DescribeFleetUtilizationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeFleetUtilizationAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFleetUtilizationOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::DescribeFleetUtilizationAsync(DescribeFleetUtilizationRequest&& request, const DescribeFleetUtilizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeFleetUtilizationAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFleetUtilizationOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::DescribeFleetUtilizationAsyncHelper(const DescribeFleetUtilizationRequest& request, const DescribeFleetUtilizationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -665,12 +835,22 @@ DescribeGameSessionsOutcome GameLiftClient::DescribeGameSessions(const DescribeG
 
 DescribeGameSessionsOutcomeCallable GameLiftClient::DescribeGameSessionsCallable(const DescribeGameSessionsRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::DescribeGameSessions, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeGameSessions, Aws::Client::RejectedCallOutcome<DescribeGameSessionsOutcome>(), this, request);
+}
+
+DescribeGameSessionsOutcomeCallable GameLiftClient::DescribeGameSessionsCallable(DescribeGameSessionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribeGameSessions, Aws::Client::RejectedCallOutcome<DescribeGameSessionsOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::DescribeGameSessionsAsync(const DescribeGameSessionsRequest& request, const DescribeGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::DescribeGameSessionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeGameSessionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeGameSessionsOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::DescribeGameSessionsAsync(DescribeGameSessionsRequest&& request, const DescribeGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::DescribeGameSessionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeGameSessionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::DescribeGameSessionsAsyncHelper(const DescribeGameSessionsRequest& request, const DescribeGameSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -696,12 +876,22 @@ DescribePlayerSessionsOutcome GameLiftClient::DescribePlayerSessions(const Descr
 
 DescribePlayerSessionsOutcomeCallable GameLiftClient::DescribePlayerSessionsCallable(const DescribePlayerSessionsRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::DescribePlayerSessions, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribePlayerSessions, Aws::Client::RejectedCallOutcome<DescribePlayerSessionsOutcome>(), this, request);
+}
+
+DescribePlayerSessionsOutcomeCallable GameLiftClient::DescribePlayerSessionsCallable(DescribePlayerSessionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::DescribePlayerSessions, Aws::Client::RejectedCallOutcome<DescribePlayerSessionsOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::DescribePlayerSessionsAsync(const DescribePlayerSessionsRequest& request, const DescribePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::DescribePlayerSessionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::DescribePlayerSessionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribePlayerSessionsOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::DescribePlayerSessionsAsync(DescribePlayerSessionsRequest&& request, const DescribePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::DescribePlayerSessionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribePlayerSessionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::DescribePlayerSessionsAsyncHelper(const DescribePlayerSessionsRequest& request, const DescribePlayerSessionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -727,12 +917,22 @@ GetGameSessionLogUrlOutcome GameLiftClient::GetGameSessionLogUrl(const GetGameSe
 
 GetGameSessionLogUrlOutcomeCallable GameLiftClient::GetGameSessionLogUrlCallable(const GetGameSessionLogUrlRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::GetGameSessionLogUrl, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::GetGameSessionLogUrl, Aws::Client::RejectedCallOutcome<GetGameSessionLogUrlOutcome>(), this, request);
+}
+
+GetGameSessionLogUrlOutcomeCallable GameLiftClient::GetGameSessionLogUrlCallable(GetGameSessionLogUrlRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::GetGameSessionLogUrl, Aws::Client::RejectedCallOutcome<GetGameSessionLogUrlOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::GetGameSessionLogUrlAsync(const GetGameSessionLogUrlRequest& request, const GetGameSessionLogUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::GetGameSessionLogUrlAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::GetGameSessionLogUrlAsyncHelper, Aws::Client::RejectedAsyncCall<GetGameSessionLogUrlOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::GetGameSessionLogUrlAsync(GetGameSessionLogUrlRequest&& request, const GetGameSessionLogUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::GetGameSessionLogUrlAsyncHelper, Aws::Client::RejectedAsyncCall<GetGameSessionLogUrlOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::GetGameSessionLogUrlAsyncHelper(const GetGameSessionLogUrlRequest& request, const GetGameSessionLogUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -758,12 +958,22 @@ ListAliasesOutcome GameLiftClient::ListAliases(const ListAliasesRequest& request
 
 ListAliasesOutcomeCallable GameLiftClient::ListAliasesCallable(const ListAliasesRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::ListAliases, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::ListAliases, Aws::Client::RejectedCallOutcome<ListAliasesOutcome>(), this, request);
+}
+
+ListAliasesOutcomeCallable GameLiftClient::ListAliasesCallable(ListAliasesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::ListAliases, Aws::Client::RejectedCallOutcome<ListAliasesOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::ListAliasesAsync(const ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::ListAliasesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::ListAliasesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAliasesOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::ListAliasesAsync(ListAliasesRequest&& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::ListAliasesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAliasesOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::ListAliasesAsyncHelper(const ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -789,12 +999,22 @@ ListBuildsOutcome GameLiftClient::ListBuilds(const ListBuildsRequest& request) c
 
 ListBuildsOutcomeCallable GameLiftClient::ListBuildsCallable(const ListBuildsRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::ListBuilds, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::ListBuilds, Aws::Client::RejectedCallOutcome<ListBuildsOutcome>(), this, request);
+}
+
+ListBuildsOutcomeCallable GameLiftClient::ListBuildsCallable(ListBuildsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::ListBuilds, Aws::Client::RejectedCallOutcome<ListBuildsOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::ListBuildsAsync(const ListBuildsRequest& request, const ListBuildsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::ListBuildsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::ListBuildsAsyncHelper, Aws::Client::RejectedAsyncCall<ListBuildsOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::ListBuildsAsync(ListBuildsRequest&& request, const ListBuildsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::ListBuildsAsyncHelper, Aws::Client::RejectedAsyncCall<ListBuildsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::ListBuildsAsyncHelper(const ListBuildsRequest& request, const ListBuildsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -820,12 +1040,22 @@ ListFleetsOutcome GameLiftClient::ListFleets(const ListFleetsRequest& request) c
 
 ListFleetsOutcomeCallable GameLiftClient::ListFleetsCallable(const ListFleetsRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::ListFleets, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::ListFleets, Aws::Client::RejectedCallOutcome<ListFleetsOutcome>(), this, request);
+}
+
+ListFleetsOutcomeCallable GameLiftClient::ListFleetsCallable(ListFleetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::ListFleets, Aws::Client::RejectedCallOutcome<ListFleetsOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::ListFleetsAsync(const ListFleetsRequest& request, const ListFleetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::ListFleetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::ListFleetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListFleetsOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::ListFleetsAsync(ListFleetsRequest&& request, const ListFleetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::ListFleetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListFleetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::ListFleetsAsyncHelper(const ListFleetsRequest& request, const ListFleetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -851,12 +1081,22 @@ RequestUploadCredentialsOutcome GameLiftClient::RequestUploadCredentials(const R
 
 RequestUploadCredentialsOutcomeCallable GameLiftClient::RequestUploadCredentialsCallable(const RequestUploadCredentialsRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::RequestUploadCredentials, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::RequestUploadCredentials, Aws::Client::RejectedCallOutcome<RequestUploadCredentialsOutcome>(), this, request);
+}
+
+RequestUploadCredentialsOutcomeCallable GameLiftClient::RequestUploadCredentialsCallable(RequestUploadCredentialsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::RequestUploadCredentials, Aws::Client::RejectedCallOutcome<RequestUploadCredentialsOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::RequestUploadCredentialsAsync(const RequestUploadCredentialsRequest& request, const RequestUploadCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::RequestUploadCredentialsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::RequestUploadCredentialsAsyncHelper, Aws::Client::RejectedAsyncCall<RequestUploadCredentialsOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::RequestUploadCredentialsAsync(RequestUploadCredentialsRequest&& request, const RequestUploadCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::RequestUploadCredentialsAsyncHelper, Aws::Client::RejectedAsyncCall<RequestUploadCredentialsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::RequestUploadCredentialsAsyncHelper(const RequestUploadCredentialsRequest& request, const RequestUploadCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -882,12 +1122,22 @@ ResolveAliasOutcome GameLiftClient::ResolveAlias(const ResolveAliasRequest& requ
 
 ResolveAliasOutcomeCallable GameLiftClient::ResolveAliasCallable(const ResolveAliasRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::ResolveAlias, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::ResolveAlias, Aws::Client::RejectedCallOutcome<ResolveAliasOutcome>(), this, request);
+}
+
+ResolveAliasOutcomeCallable GameLiftClient::ResolveAliasCallable(ResolveAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::ResolveAlias, Aws::Client::RejectedCallOutcome<ResolveAliasOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::ResolveAliasAsync(const ResolveAliasRequest& request, const ResolveAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::ResolveAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::ResolveAliasAsyncHelper, Aws::Client::RejectedAsyncCall<ResolveAliasOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::ResolveAliasAsync(ResolveAliasRequest&& request, const ResolveAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::ResolveAliasAsyncHelper, Aws::Client::RejectedAsyncCall<ResolveAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::ResolveAliasAsyncHelper(const ResolveAliasRequest& request, const ResolveAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -913,12 +1163,22 @@ UpdateAliasOutcome GameLiftClient::UpdateAlias(const UpdateAliasRequest& request
 
 UpdateAliasOutcomeCallable GameLiftClient::UpdateAliasCallable(const UpdateAliasRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::UpdateAlias, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::UpdateAlias, Aws::Client::RejectedCallOutcome<UpdateAliasOutcome>(), this, request);
+}
+
+UpdateAliasOutcomeCallable GameLiftClient::UpdateAliasCallable(UpdateAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::UpdateAlias, Aws::Client::RejectedCallOutcome<UpdateAliasOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::UpdateAliasAsync(const UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::UpdateAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::UpdateAliasAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAliasOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::UpdateAliasAsync(UpdateAliasRequest&& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::UpdateAliasAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::UpdateAliasAsyncHelper(const UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -944,12 +1204,22 @@ UpdateBuildOutcome GameLiftClient::UpdateBuild(const UpdateBuildRequest& request
 
 UpdateBuildOutcomeCallable GameLiftClient::UpdateBuildCallable(const UpdateBuildRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::UpdateBuild, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::UpdateBuild, Aws::Client::RejectedCallOutcome<UpdateBuildOutcome>(), this, request);
+}
+
+UpdateBuildOutcomeCallable GameLiftClient::UpdateBuildCallable(UpdateBuildRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::UpdateBuild, Aws::Client::RejectedCallOutcome<UpdateBuildOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::UpdateBuildAsync(const UpdateBuildRequest& request, const UpdateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::UpdateBuildAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::UpdateBuildAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateBuildOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::UpdateBuildAsync(UpdateBuildRequest&& request, const UpdateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::UpdateBuildAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateBuildOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::UpdateBuildAsyncHelper(const UpdateBuildRequest& request, const UpdateBuildResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -975,12 +1245,22 @@ UpdateFleetAttributesOutcome GameLiftClient::UpdateFleetAttributes(const UpdateF
 
 UpdateFleetAttributesOutcomeCallable GameLiftClient::UpdateFleetAttributesCallable(const UpdateFleetAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::UpdateFleetAttributes, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::UpdateFleetAttributes, Aws::Client::RejectedCallOutcome<UpdateFleetAttributesOutcome>(), this, request);
+}
+
+UpdateFleetAttributesOutcomeCallable GameLiftClient::UpdateFleetAttributesCallable(UpdateFleetAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::UpdateFleetAttributes, Aws::Client::RejectedCallOutcome<UpdateFleetAttributesOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::UpdateFleetAttributesAsync(const UpdateFleetAttributesRequest& request, const UpdateFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::UpdateFleetAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::UpdateFleetAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateFleetAttributesOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::UpdateFleetAttributesAsync(UpdateFleetAttributesRequest&& request, const UpdateFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::UpdateFleetAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateFleetAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::UpdateFleetAttributesAsyncHelper(const UpdateFleetAttributesRequest& request, const UpdateFleetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1006,12 +1286,22 @@ UpdateFleetCapacityOutcome GameLiftClient::UpdateFleetCapacity(const UpdateFleet
 
 UpdateFleetCapacityOutcomeCallable GameLiftClient::UpdateFleetCapacityCallable(const UpdateFleetCapacityRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::UpdateFleetCapacity, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::UpdateFleetCapacity, Aws::Client::RejectedCallOutcome<UpdateFleetCapacityOutcome>(), this, request);
+}
+
+UpdateFleetCapacityOutcomeCallable GameLiftClient::UpdateFleetCapacityCallable(UpdateFleetCapacityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::UpdateFleetCapacity, Aws::Client::RejectedCallOutcome<UpdateFleetCapacityOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::UpdateFleetCapacityAsync(const UpdateFleetCapacityRequest& request, const UpdateFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::UpdateFleetCapacityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::UpdateFleetCapacityAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateFleetCapacityOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::UpdateFleetCapacityAsync(UpdateFleetCapacityRequest&& request, const UpdateFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::UpdateFleetCapacityAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateFleetCapacityOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::UpdateFleetCapacityAsyncHelper(const UpdateFleetCapacityRequest& request, const UpdateFleetCapacityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1037,12 +1327,22 @@ UpdateFleetPortSettingsOutcome GameLiftClient::UpdateFleetPortSettings(const Upd
 
 UpdateFleetPortSettingsOutcomeCallable GameLiftClient::UpdateFleetPortSettingsCallable(const UpdateFleetPortSettingsRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::UpdateFleetPortSettings, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::UpdateFleetPortSettings, Aws::Client::RejectedCallOutcome<UpdateFleetPortSettingsOutcome>(), this, request);
+}
+
+UpdateFleetPortSettingsOutcomeCallable GameLiftClient::UpdateFleetPortSettingsCallable(UpdateFleetPortSettingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::UpdateFleetPortSettings, Aws::Client::RejectedCallOutcome<UpdateFleetPortSettingsOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::UpdateFleetPortSettingsAsync(const UpdateFleetPortSettingsRequest& request, const UpdateFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::UpdateFleetPortSettingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::UpdateFleetPortSettingsAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateFleetPortSettingsOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::UpdateFleetPortSettingsAsync(UpdateFleetPortSettingsRequest&& request, const UpdateFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::UpdateFleetPortSettingsAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateFleetPortSettingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::UpdateFleetPortSettingsAsyncHelper(const UpdateFleetPortSettingsRequest& request, const UpdateFleetPortSettingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1068,12 +1368,22 @@ UpdateGameSessionOutcome GameLiftClient::UpdateGameSession(const UpdateGameSessi
 
 UpdateGameSessionOutcomeCallable GameLiftClient::UpdateGameSessionCallable(const UpdateGameSessionRequest& request) const
 {
-  return std::async(std::launch::async, &GameLiftClient::UpdateGameSession, this, request);
+  return m_executor->SubmitWithFuture(&GameLiftClient::UpdateGameSession, Aws::Client::RejectedCallOutcome<UpdateGameSessionOutcome>(), this, request);
+}
+
+UpdateGameSessionOutcomeCallable GameLiftClient::UpdateGameSessionCallable(UpdateGameSessionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GameLiftClient::UpdateGameSession, Aws::Client::RejectedCallOutcome<UpdateGameSessionOutcome>(), this, std::move(request));
 }
 
 void GameLiftClient::UpdateGameSessionAsync(const UpdateGameSessionRequest& request, const UpdateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GameLiftClient::UpdateGameSessionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GameLiftClient::UpdateGameSessionAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateGameSessionOutcome>(), this, request, handler, context);
+}
+
+void GameLiftClient::UpdateGameSessionAsync(UpdateGameSessionRequest&& request, const UpdateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GameLiftClient::UpdateGameSessionAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateGameSessionOutcome>(), this, std::move(request), handler, context);
 }
 
 void GameLiftClient::UpdateGameSessionAsyncHelper(const UpdateGameSessionRequest& request, const UpdateGameSessionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -42,6 +42,41 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/glacier/model/AbortMultipartUploadRequest.h>
+#include <aws/glacier/model/AbortVaultLockRequest.h>
+#include <aws/glacier/model/AddTagsToVaultRequest.h>
+#include <aws/glacier/model/CompleteMultipartUploadRequest.h>
+#include <aws/glacier/model/CompleteVaultLockRequest.h>
+#include <aws/glacier/model/CreateVaultRequest.h>
+#include <aws/glacier/model/DeleteArchiveRequest.h>
+#include <aws/glacier/model/DeleteVaultRequest.h>
+#include <aws/glacier/model/DeleteVaultAccessPolicyRequest.h>
+#include <aws/glacier/model/DeleteVaultNotificationsRequest.h>
+#include <aws/glacier/model/DescribeJobRequest.h>
+#include <aws/glacier/model/DescribeVaultRequest.h>
+#include <aws/glacier/model/GetDataRetrievalPolicyRequest.h>
+#include <aws/glacier/model/GetJobOutputRequest.h>
+#include <aws/glacier/model/GetVaultAccessPolicyRequest.h>
+#include <aws/glacier/model/GetVaultLockRequest.h>
+#include <aws/glacier/model/GetVaultNotificationsRequest.h>
+#include <aws/glacier/model/InitiateJobRequest.h>
+#include <aws/glacier/model/InitiateMultipartUploadRequest.h>
+#include <aws/glacier/model/InitiateVaultLockRequest.h>
+#include <aws/glacier/model/ListJobsRequest.h>
+#include <aws/glacier/model/ListMultipartUploadsRequest.h>
+#include <aws/glacier/model/ListPartsRequest.h>
+#include <aws/glacier/model/ListTagsForVaultRequest.h>
+#include <aws/glacier/model/ListVaultsRequest.h>
+#include <aws/glacier/model/RemoveTagsFromVaultRequest.h>
+#include <aws/glacier/model/SetDataRetrievalPolicyRequest.h>
+#include <aws/glacier/model/SetVaultAccessPolicyRequest.h>
+#include <aws/glacier/model/SetVaultNotificationsRequest.h>
+#include <aws/glacier/model/UploadArchiveRequest.h>
+#include <aws/glacier/model/UploadMultipartPartRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -316,6 +351,11 @@ namespace Model
          */
         virtual Model::AbortMultipartUploadOutcomeCallable AbortMultipartUploadCallable(const Model::AbortMultipartUploadRequest& request) const;
 
+        /**
+         * Same as AbortMultipartUploadCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AbortMultipartUploadOutcomeCallable AbortMultipartUploadCallable(Model::AbortMultipartUploadRequest&& request) const;
+
         /**
          * <p>This operation aborts a multipart upload identified by the upload ID.</p>
          * <p>After the Abort Multipart Upload request succeeds, you cannot upload any more
@@ -340,6 +380,11 @@ namespace Model
          */
         virtual void AbortMultipartUploadAsync(const Model::AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AbortMultipartUploadAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AbortMultipartUploadAsync(Model::AbortMultipartUploadRequest&& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation aborts the vault locking process if the vault lock is not in
          * the <code>Locked</code> state. If the vault lock is in the <code>Locked</code>
@@ -384,6 +429,11 @@ namespace Model
          */
         virtual Model::AbortVaultLockOutcomeCallable AbortVaultLockCallable(const Model::AbortVaultLockRequest& request) const;
 
+        /**
+         * Same as AbortVaultLockCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AbortVaultLockOutcomeCallable AbortVaultLockCallable(Model::AbortVaultLockRequest&& request) const;
+
         /**
          * <p>This operation aborts the vault locking process if the vault lock is not in
          * the <code>Locked</code> state. If the vault lock is in the <code>Locked</code>
@@ -407,6 +457,11 @@ namespace Model
          */
         virtual void AbortVaultLockAsync(const Model::AbortVaultLockRequest& request, const AbortVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AbortVaultLockAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AbortVaultLockAsync(Model::AbortVaultLockRequest&& request, const AbortVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation adds the specified tags to a vault. Each tag is composed of a
          * key and a value. Each vault can have up to 10 tags. If your request would cause
@@ -433,6 +488,11 @@ namespace Model
          */
         virtual Model::AddTagsToVaultOutcomeCallable AddTagsToVaultCallable(const Model::AddTagsToVaultRequest& request) const;
 
+        /**
+         * Same as AddTagsToVaultCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddTagsToVaultOutcomeCallable AddTagsToVaultCallable(Model::AddTagsToVaultRequest&& request) const;
+
         /**
          * <p>This operation adds the specified tags to a vault. Each tag is composed of a
          * key and a value. Each vault can have up to 10 tags. If your request would cause
@@ -447,6 +507,11 @@ namespace Model
          */
         virtual void AddTagsToVaultAsync(const Model::AddTagsToVaultRequest& request, const AddTagsToVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToVaultAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddTagsToVaultAsync(Model::AddTagsToVaultRequest&& request, const AddTagsToVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>You call this operation to inform Amazon Glacier that all the archive parts
          * have been uploaded and that Amazon Glacier can now assemble the archive from the
@@ -535,6 +600,11 @@ namespace Model
          */
         virtual Model::CompleteMultipartUploadOutcomeCallable CompleteMultipartUploadCallable(const Model::CompleteMultipartUploadRequest& request) const;
 
+        /**
+         * Same as CompleteMultipartUploadCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CompleteMultipartUploadOutcomeCallable CompleteMultipartUploadCallable(Model::CompleteMultipartUploadRequest&& request) const;
+
         /**
          * <p>You call this operation to inform Amazon Glacier that all the archive parts
          * have been uploaded and that Amazon Glacier can now assemble the archive from the
@@ -580,6 +650,11 @@ namespace Model
          */
         virtual void CompleteMultipartUploadAsync(const Model::CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CompleteMultipartUploadAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CompleteMultipartUploadAsync(Model::CompleteMultipartUploadRequest&& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation completes the vault locking process by transitioning the vault
          * lock from the <code>InProgress</code> state to the <code>Locked</code> state,
@@ -620,6 +695,11 @@ namespace Model
          */
         virtual Model::CompleteVaultLockOutcomeCallable CompleteVaultLockCallable(const Model::CompleteVaultLockRequest& request) const;
 
+        /**
+         * Same as CompleteVaultLockCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CompleteVaultLockOutcomeCallable CompleteVaultLockCallable(Model::CompleteVaultLockRequest&& request) const;
+
         /**
          * <p>This operation completes the vault locking process by transitioning the vault
          * lock from the <code>InProgress</code> state to the <code>Locked</code> state,
@@ -641,6 +721,11 @@ namespace Model
          */
         virtual void CompleteVaultLockAsync(const Model::CompleteVaultLockRequest& request, const CompleteVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CompleteVaultLockAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CompleteVaultLockAsync(Model::CompleteVaultLockRequest&& request, const CompleteVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation creates a new vault with the specified name. The name of the
          * vault must be unique within a region for an AWS account. You can create up to
@@ -687,6 +772,11 @@ namespace Model
          */
         virtual Model::CreateVaultOutcomeCallable CreateVaultCallable(const Model::CreateVaultRequest& request) const;
 
+        /**
+         * Same as CreateVaultCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateVaultOutcomeCallable CreateVaultCallable(Model::CreateVaultRequest&& request) const;
+
         /**
          * <p>This operation creates a new vault with the specified name. The name of the
          * vault must be unique within a region for an AWS account. You can create up to
@@ -711,6 +801,11 @@ namespace Model
          */
         virtual void CreateVaultAsync(const Model::CreateVaultRequest& request, const CreateVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVaultAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateVaultAsync(Model::CreateVaultRequest&& request, const CreateVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation deletes an archive from a vault. Subsequent requests to
          * initiate a retrieval of this archive will fail. Archive retrievals that are in
@@ -761,6 +856,11 @@ namespace Model
          */
         virtual Model::DeleteArchiveOutcomeCallable DeleteArchiveCallable(const Model::DeleteArchiveRequest& request) const;
 
+        /**
+         * Same as DeleteArchiveCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteArchiveOutcomeCallable DeleteArchiveCallable(Model::DeleteArchiveRequest&& request) const;
+
         /**
          * <p>This operation deletes an archive from a vault. Subsequent requests to
          * initiate a retrieval of this archive will fail. Archive retrievals that are in
@@ -787,6 +887,11 @@ namespace Model
          */
         virtual void DeleteArchiveAsync(const Model::DeleteArchiveRequest& request, const DeleteArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteArchiveAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteArchiveAsync(Model::DeleteArchiveRequest&& request, const DeleteArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation deletes a vault. Amazon Glacier will delete a vault only if
          * there are no archives in the vault as of the last inventory and there have been
@@ -841,6 +946,11 @@ namespace Model
          */
         virtual Model::DeleteVaultOutcomeCallable DeleteVaultCallable(const Model::DeleteVaultRequest& request) const;
 
+        /**
+         * Same as DeleteVaultCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteVaultOutcomeCallable DeleteVaultCallable(Model::DeleteVaultRequest&& request) const;
+
         /**
          * <p>This operation deletes a vault. Amazon Glacier will delete a vault only if
          * there are no archives in the vault as of the last inventory and there have been
@@ -869,6 +979,11 @@ namespace Model
          */
         virtual void DeleteVaultAsync(const Model::DeleteVaultRequest& request, const DeleteVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVaultAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteVaultAsync(Model::DeleteVaultRequest&& request, const DeleteVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation deletes the access policy associated with the specified vault.
          * The operation is eventually consistent; that is, it might take some time for
@@ -897,6 +1012,11 @@ namespace Model
          */
         virtual Model::DeleteVaultAccessPolicyOutcomeCallable DeleteVaultAccessPolicyCallable(const Model::DeleteVaultAccessPolicyRequest& request) const;
 
+        /**
+         * Same as DeleteVaultAccessPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteVaultAccessPolicyOutcomeCallable DeleteVaultAccessPolicyCallable(Model::DeleteVaultAccessPolicyRequest&& request) const;
+
         /**
          * <p>This operation deletes the access policy associated with the specified vault.
          * The operation is eventually consistent; that is, it might take some time for
@@ -912,6 +1032,11 @@ namespace Model
          */
         virtual void DeleteVaultAccessPolicyAsync(const Model::DeleteVaultAccessPolicyRequest& request, const DeleteVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVaultAccessPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteVaultAccessPolicyAsync(Model::DeleteVaultAccessPolicyRequest&& request, const DeleteVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation deletes the notification configuration set for a vault. The
          * operation is eventually consistent; that is, it might take some time for Amazon
@@ -954,6 +1079,11 @@ namespace Model
          */
         virtual Model::DeleteVaultNotificationsOutcomeCallable DeleteVaultNotificationsCallable(const Model::DeleteVaultNotificationsRequest& request) const;
 
+        /**
+         * Same as DeleteVaultNotificationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteVaultNotificationsOutcomeCallable DeleteVaultNotificationsCallable(Model::DeleteVaultNotificationsRequest&& request) const;
+
         /**
          * <p>This operation deletes the notification configuration set for a vault. The
          * operation is eventually consistent; that is, it might take some time for Amazon
@@ -976,6 +1106,11 @@ namespace Model
          */
         virtual void DeleteVaultNotificationsAsync(const Model::DeleteVaultNotificationsRequest& request, const DeleteVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVaultNotificationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteVaultNotificationsAsync(Model::DeleteVaultNotificationsRequest&& request, const DeleteVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns information about a job you previously initiated,
          * including the job initiation date, the user who initiated the job, the job
@@ -1024,6 +1159,11 @@ namespace Model
          */
         virtual Model::DescribeJobOutcomeCallable DescribeJobCallable(const Model::DescribeJobRequest& request) const;
 
+        /**
+         * Same as DescribeJobCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeJobOutcomeCallable DescribeJobCallable(Model::DescribeJobRequest&& request) const;
+
         /**
          * <p>This operation returns information about a job you previously initiated,
          * including the job initiation date, the user who initiated the job, the job
@@ -1049,6 +1189,11 @@ namespace Model
          */
         virtual void DescribeJobAsync(const Model::DescribeJobRequest& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeJobAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeJobAsync(Model::DescribeJobRequest&& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns information about a vault, including the vault's
          * Amazon Resource Name (ARN), the date the vault was created, the number of
@@ -1103,6 +1248,11 @@ namespace Model
          */
         virtual Model::DescribeVaultOutcomeCallable DescribeVaultCallable(const Model::DescribeVaultRequest& request) const;
 
+        /**
+         * Same as DescribeVaultCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVaultOutcomeCallable DescribeVaultCallable(Model::DescribeVaultRequest&& request) const;
+
         /**
          * <p>This operation returns information about a vault, including the vault's
          * Amazon Resource Name (ARN), the date the vault was created, the number of
@@ -1131,6 +1281,11 @@ namespace Model
          */
         virtual void DescribeVaultAsync(const Model::DescribeVaultRequest& request, const DescribeVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVaultAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVaultAsync(Model::DescribeVaultRequest&& request, const DescribeVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns the current data retrieval policy for the account and
          * region specified in the GET request. For more information about data retrieval
@@ -1151,6 +1306,11 @@ namespace Model
          */
         virtual Model::GetDataRetrievalPolicyOutcomeCallable GetDataRetrievalPolicyCallable(const Model::GetDataRetrievalPolicyRequest& request) const;
 
+        /**
+         * Same as GetDataRetrievalPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDataRetrievalPolicyOutcomeCallable GetDataRetrievalPolicyCallable(Model::GetDataRetrievalPolicyRequest&& request) const;
+
         /**
          * <p>This operation returns the current data retrieval policy for the account and
          * region specified in the GET request. For more information about data retrieval
@@ -1162,6 +1322,11 @@ namespace Model
          */
         virtual void GetDataRetrievalPolicyAsync(const Model::GetDataRetrievalPolicyRequest& request, const GetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDataRetrievalPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDataRetrievalPolicyAsync(Model::GetDataRetrievalPolicyRequest&& request, const GetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation downloads the output of the job you initiated using
          * <a>InitiateJob</a>. Depending on the job type you specified when you initiated
@@ -1246,6 +1411,11 @@ namespace Model
          */
         virtual Model::GetJobOutputOutcomeCallable GetJobOutputCallable(const Model::GetJobOutputRequest& request) const;
 
+        /**
+         * Same as GetJobOutputCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetJobOutputOutcomeCallable GetJobOutputCallable(Model::GetJobOutputRequest&& request) const;
+
         /**
          * <p>This operation downloads the output of the job you initiated using
          * <a>InitiateJob</a>. Depending on the job type you specified when you initiated
@@ -1289,6 +1459,11 @@ namespace Model
          */
         virtual void GetJobOutputAsync(const Model::GetJobOutputRequest& request, const GetJobOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetJobOutputAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetJobOutputAsync(Model::GetJobOutputRequest&& request, const GetJobOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation retrieves the <code>access-policy</code> subresource set on
          * the vault; for more information on setting this subresource, see <a
@@ -1315,6 +1490,11 @@ namespace Model
          */
         virtual Model::GetVaultAccessPolicyOutcomeCallable GetVaultAccessPolicyCallable(const Model::GetVaultAccessPolicyRequest& request) const;
 
+        /**
+         * Same as GetVaultAccessPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetVaultAccessPolicyOutcomeCallable GetVaultAccessPolicyCallable(Model::GetVaultAccessPolicyRequest&& request) const;
+
         /**
          * <p>This operation retrieves the <code>access-policy</code> subresource set on
          * the vault; for more information on setting this subresource, see <a
@@ -1329,6 +1509,11 @@ namespace Model
          */
         virtual void GetVaultAccessPolicyAsync(const Model::GetVaultAccessPolicyRequest& request, const GetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetVaultAccessPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetVaultAccessPolicyAsync(Model::GetVaultAccessPolicyRequest&& request, const GetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation retrieves the following attributes from the
          * <code>lock-policy</code> subresource set on the specified vault: <ul> <li>
@@ -1375,6 +1560,11 @@ namespace Model
          */
         virtual Model::GetVaultLockOutcomeCallable GetVaultLockCallable(const Model::GetVaultLockRequest& request) const;
 
+        /**
+         * Same as GetVaultLockCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetVaultLockOutcomeCallable GetVaultLockCallable(Model::GetVaultLockRequest&& request) const;
+
         /**
          * <p>This operation retrieves the following attributes from the
          * <code>lock-policy</code> subresource set on the specified vault: <ul> <li>
@@ -1399,6 +1589,11 @@ namespace Model
          */
         virtual void GetVaultLockAsync(const Model::GetVaultLockRequest& request, const GetVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetVaultLockAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetVaultLockAsync(Model::GetVaultLockRequest&& request, const GetVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation retrieves the <code
          * class="code">notification-configuration</code> subresource of the specified
@@ -1449,6 +1644,11 @@ namespace Model
          */
         virtual Model::GetVaultNotificationsOutcomeCallable GetVaultNotificationsCallable(const Model::GetVaultNotificationsRequest& request) const;
 
+        /**
+         * Same as GetVaultNotificationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetVaultNotificationsOutcomeCallable GetVaultNotificationsCallable(Model::GetVaultNotificationsRequest&& request) const;
+
         /**
          * <p>This operation retrieves the <code
          * class="code">notification-configuration</code> subresource of the specified
@@ -1475,6 +1675,11 @@ namespace Model
          */
         virtual void GetVaultNotificationsAsync(const Model::GetVaultNotificationsRequest& request, const GetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetVaultNotificationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetVaultNotificationsAsync(Model::GetVaultNotificationsRequest&& request, const GetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation initiates a job of the specified type. In this release, you
          * can initiate a job to retrieve either an archive or a vault inventory (a list of
@@ -1675,6 +1880,11 @@ namespace Model
          */
         virtual Model::InitiateJobOutcomeCallable InitiateJobCallable(const Model::InitiateJobRequest& request) const;
 
+        /**
+         * Same as InitiateJobCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::InitiateJobOutcomeCallable InitiateJobCallable(Model::InitiateJobRequest&& request) const;
+
         /**
          * <p>This operation initiates a job of the specified type. In this release, you
          * can initiate a job to retrieve either an archive or a vault inventory (a list of
@@ -1776,6 +1986,11 @@ namespace Model
          */
         virtual void InitiateJobAsync(const Model::InitiateJobRequest& request, const InitiateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as InitiateJobAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void InitiateJobAsync(Model::InitiateJobRequest&& request, const InitiateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation initiates a multipart upload. Amazon Glacier creates a
          * multipart upload resource and returns its ID in the response. The multipart
@@ -1844,6 +2059,11 @@ namespace Model
          */
         virtual Model::InitiateMultipartUploadOutcomeCallable InitiateMultipartUploadCallable(const Model::InitiateMultipartUploadRequest& request) const;
 
+        /**
+         * Same as InitiateMultipartUploadCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::InitiateMultipartUploadOutcomeCallable InitiateMultipartUploadCallable(Model::InitiateMultipartUploadRequest&& request) const;
+
         /**
          * <p>This operation initiates a multipart upload. Amazon Glacier creates a
          * multipart upload resource and returns its ID in the response. The multipart
@@ -1879,6 +2099,11 @@ namespace Model
          */
         virtual void InitiateMultipartUploadAsync(const Model::InitiateMultipartUploadRequest& request, const InitiateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as InitiateMultipartUploadAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void InitiateMultipartUploadAsync(Model::InitiateMultipartUploadRequest&& request, const InitiateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation initiates the vault locking process by doing the following:
          * <ul> <li> <p>Installing a vault lock policy on the specified vault.</p> </li>
@@ -1939,6 +2164,11 @@ namespace Model
          */
         virtual Model::InitiateVaultLockOutcomeCallable InitiateVaultLockCallable(const Model::InitiateVaultLockRequest& request) const;
 
+        /**
+         * Same as InitiateVaultLockCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::InitiateVaultLockOutcomeCallable InitiateVaultLockCallable(Model::InitiateVaultLockRequest&& request) const;
+
         /**
          * <p>This operation initiates the vault locking process by doing the following:
          * <ul> <li> <p>Installing a vault lock policy on the specified vault.</p> </li>
@@ -1970,6 +2200,11 @@ namespace Model
          */
         virtual void InitiateVaultLockAsync(const Model::InitiateVaultLockRequest& request, const InitiateVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as InitiateVaultLockAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void InitiateVaultLockAsync(Model::InitiateVaultLockRequest&& request, const InitiateVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists jobs for a vault, including jobs that are in-progress
          * and jobs that have recently finished. </p> <note><p>Amazon Glacier retains
@@ -2054,6 +2289,11 @@ namespace Model
          */
         virtual Model::ListJobsOutcomeCallable ListJobsCallable(const Model::ListJobsRequest& request) const;
 
+        /**
+         * Same as ListJobsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListJobsOutcomeCallable ListJobsCallable(Model::ListJobsRequest&& request) const;
+
         /**
          * <p>This operation lists jobs for a vault, including jobs that are in-progress
          * and jobs that have recently finished. </p> <note><p>Amazon Glacier retains
@@ -2097,6 +2337,11 @@ namespace Model
          */
         virtual void ListJobsAsync(const Model::ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListJobsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListJobsAsync(Model::ListJobsRequest&& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists in-progress multipart uploads for the specified vault.
          * An in-progress multipart upload is a multipart upload that has been initiated by
@@ -2161,6 +2406,11 @@ namespace Model
          */
         virtual Model::ListMultipartUploadsOutcomeCallable ListMultipartUploadsCallable(const Model::ListMultipartUploadsRequest& request) const;
 
+        /**
+         * Same as ListMultipartUploadsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListMultipartUploadsOutcomeCallable ListMultipartUploadsCallable(Model::ListMultipartUploadsRequest&& request) const;
+
         /**
          * <p>This operation lists in-progress multipart uploads for the specified vault.
          * An in-progress multipart upload is a multipart upload that has been initiated by
@@ -2194,6 +2444,11 @@ namespace Model
          */
         virtual void ListMultipartUploadsAsync(const Model::ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListMultipartUploadsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListMultipartUploadsAsync(Model::ListMultipartUploadsRequest&& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists the parts of an archive that have been uploaded in a
          * specific multipart upload. You can make this request at any time during an
@@ -2252,6 +2507,11 @@ namespace Model
          */
         virtual Model::ListPartsOutcomeCallable ListPartsCallable(const Model::ListPartsRequest& request) const;
 
+        /**
+         * Same as ListPartsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListPartsOutcomeCallable ListPartsCallable(Model::ListPartsRequest&& request) const;
+
         /**
          * <p>This operation lists the parts of an archive that have been uploaded in a
          * specific multipart upload. You can make this request at any time during an
@@ -2282,6 +2542,11 @@ namespace Model
          */
         virtual void ListPartsAsync(const Model::ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPartsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListPartsAsync(Model::ListPartsRequest&& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists all the tags attached to a vault. The operation returns
          * an empty map if there are no tags. For more information about tags, see <a
@@ -2300,6 +2565,11 @@ namespace Model
          */
         virtual Model::ListTagsForVaultOutcomeCallable ListTagsForVaultCallable(const Model::ListTagsForVaultRequest& request) const;
 
+        /**
+         * Same as ListTagsForVaultCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTagsForVaultOutcomeCallable ListTagsForVaultCallable(Model::ListTagsForVaultRequest&& request) const;
+
         /**
          * <p>This operation lists all the tags attached to a vault. The operation returns
          * an empty map if there are no tags. For more information about tags, see <a
@@ -2310,6 +2580,11 @@ namespace Model
          */
         virtual void ListTagsForVaultAsync(const Model::ListTagsForVaultRequest& request, const ListTagsForVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForVaultAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTagsForVaultAsync(Model::ListTagsForVaultRequest&& request, const ListTagsForVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists all vaults owned by the calling user's account. The list
          * returned in the response is ASCII-sorted by vault name. </p> <p>By default, this
@@ -2364,6 +2639,11 @@ namespace Model
          */
         virtual Model::ListVaultsOutcomeCallable ListVaultsCallable(const Model::ListVaultsRequest& request) const;
 
+        /**
+         * Same as ListVaultsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListVaultsOutcomeCallable ListVaultsCallable(Model::ListVaultsRequest&& request) const;
+
         /**
          * <p>This operation lists all vaults owned by the calling user's account. The list
          * returned in the response is ASCII-sorted by vault name. </p> <p>By default, this
@@ -2392,6 +2672,11 @@ namespace Model
          */
         virtual void ListVaultsAsync(const Model::ListVaultsRequest& request, const ListVaultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListVaultsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListVaultsAsync(Model::ListVaultsRequest&& request, const ListVaultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation removes one or more tags from the set of tags attached to a
          * vault. For more information about tags, see <a
@@ -2412,6 +2697,11 @@ namespace Model
          */
         virtual Model::RemoveTagsFromVaultOutcomeCallable RemoveTagsFromVaultCallable(const Model::RemoveTagsFromVaultRequest& request) const;
 
+        /**
+         * Same as RemoveTagsFromVaultCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveTagsFromVaultOutcomeCallable RemoveTagsFromVaultCallable(Model::RemoveTagsFromVaultRequest&& request) const;
+
         /**
          * <p>This operation removes one or more tags from the set of tags attached to a
          * vault. For more information about tags, see <a
@@ -2423,6 +2713,11 @@ namespace Model
          */
         virtual void RemoveTagsFromVaultAsync(const Model::RemoveTagsFromVaultRequest& request, const RemoveTagsFromVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromVaultAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveTagsFromVaultAsync(Model::RemoveTagsFromVaultRequest&& request, const RemoveTagsFromVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation sets and then enacts a data retrieval policy in the region
          * specified in the PUT request. You can set one policy per region for an AWS
@@ -2449,6 +2744,11 @@ namespace Model
          */
         virtual Model::SetDataRetrievalPolicyOutcomeCallable SetDataRetrievalPolicyCallable(const Model::SetDataRetrievalPolicyRequest& request) const;
 
+        /**
+         * Same as SetDataRetrievalPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetDataRetrievalPolicyOutcomeCallable SetDataRetrievalPolicyCallable(Model::SetDataRetrievalPolicyRequest&& request) const;
+
         /**
          * <p>This operation sets and then enacts a data retrieval policy in the region
          * specified in the PUT request. You can set one policy per region for an AWS
@@ -2463,6 +2763,11 @@ namespace Model
          */
         virtual void SetDataRetrievalPolicyAsync(const Model::SetDataRetrievalPolicyRequest& request, const SetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetDataRetrievalPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetDataRetrievalPolicyAsync(Model::SetDataRetrievalPolicyRequest&& request, const SetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation configures an access policy for a vault and will overwrite an
          * existing policy. To configure a vault access policy, send a PUT request to the
@@ -2489,6 +2794,11 @@ namespace Model
          */
         virtual Model::SetVaultAccessPolicyOutcomeCallable SetVaultAccessPolicyCallable(const Model::SetVaultAccessPolicyRequest& request) const;
 
+        /**
+         * Same as SetVaultAccessPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetVaultAccessPolicyOutcomeCallable SetVaultAccessPolicyCallable(Model::SetVaultAccessPolicyRequest&& request) const;
+
         /**
          * <p>This operation configures an access policy for a vault and will overwrite an
          * existing policy. To configure a vault access policy, send a PUT request to the
@@ -2503,6 +2813,11 @@ namespace Model
          */
         virtual void SetVaultAccessPolicyAsync(const Model::SetVaultAccessPolicyRequest& request, const SetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetVaultAccessPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetVaultAccessPolicyAsync(Model::SetVaultAccessPolicyRequest&& request, const SetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation configures notifications that will be sent when specific
          * events happen to a vault. By default, you don't get any notifications. </p>
@@ -2571,6 +2886,11 @@ namespace Model
          */
         virtual Model::SetVaultNotificationsOutcomeCallable SetVaultNotificationsCallable(const Model::SetVaultNotificationsRequest& request) const;
 
+        /**
+         * Same as SetVaultNotificationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetVaultNotificationsOutcomeCallable SetVaultNotificationsCallable(Model::SetVaultNotificationsRequest&& request) const;
+
         /**
          * <p>This operation configures notifications that will be sent when specific
          * events happen to a vault. By default, you don't get any notifications. </p>
@@ -2606,6 +2926,11 @@ namespace Model
          */
         virtual void SetVaultNotificationsAsync(const Model::SetVaultNotificationsRequest& request, const SetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetVaultNotificationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetVaultNotificationsAsync(Model::SetVaultNotificationsRequest&& request, const SetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation adds an archive to a vault. This is a synchronous operation,
          * and for a successful upload, your data is durably persisted. Amazon Glacier
@@ -2680,6 +3005,11 @@ namespace Model
          */
         virtual Model::UploadArchiveOutcomeCallable UploadArchiveCallable(const Model::UploadArchiveRequest& request) const;
 
+        /**
+         * Same as UploadArchiveCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UploadArchiveOutcomeCallable UploadArchiveCallable(Model::UploadArchiveRequest&& request) const;
+
         /**
          * <p>This operation adds an archive to a vault. This is a synchronous operation,
          * and for a successful upload, your data is durably persisted. Amazon Glacier
@@ -2718,6 +3048,11 @@ namespace Model
          */
         virtual void UploadArchiveAsync(const Model::UploadArchiveRequest& request, const UploadArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadArchiveAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UploadArchiveAsync(Model::UploadArchiveRequest&& request, const UploadArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation uploads a part of an archive. You can upload archive parts in
          * any order. You can also upload them in parallel. You can upload up to 10,000
@@ -2800,6 +3135,11 @@ namespace Model
          */
         virtual Model::UploadMultipartPartOutcomeCallable UploadMultipartPartCallable(const Model::UploadMultipartPartRequest& request) const;
 
+        /**
+         * Same as UploadMultipartPartCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UploadMultipartPartOutcomeCallable UploadMultipartPartCallable(Model::UploadMultipartPartRequest&& request) const;
+
         /**
          * <p>This operation uploads a part of an archive. You can upload archive parts in
          * any order. You can also upload them in parallel. You can upload up to 10,000
@@ -2842,6 +3182,80 @@ namespace Model
          */
         virtual void UploadMultipartPartAsync(const Model::UploadMultipartPartRequest& request, const UploadMultipartPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadMultipartPartAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UploadMultipartPartAsync(Model::UploadMultipartPartRequest&& request, const UploadMultipartPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AbortMultipartUploadOutcome> AbortMultipartUploadAwaitable(const Model::AbortMultipartUploadRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::AbortMultipartUpload, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AbortMultipartUploadOutcome> AbortMultipartUploadAwaitable(Model::AbortMultipartUploadRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::AbortMultipartUpload, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AbortVaultLockOutcome> AbortVaultLockAwaitable(const Model::AbortVaultLockRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::AbortVaultLock, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AbortVaultLockOutcome> AbortVaultLockAwaitable(Model::AbortVaultLockRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::AbortVaultLock, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsToVaultOutcome> AddTagsToVaultAwaitable(const Model::AddTagsToVaultRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::AddTagsToVault, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsToVaultOutcome> AddTagsToVaultAwaitable(Model::AddTagsToVaultRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::AddTagsToVault, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CompleteMultipartUploadOutcome> CompleteMultipartUploadAwaitable(const Model::CompleteMultipartUploadRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::CompleteMultipartUpload, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CompleteMultipartUploadOutcome> CompleteMultipartUploadAwaitable(Model::CompleteMultipartUploadRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::CompleteMultipartUpload, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CompleteVaultLockOutcome> CompleteVaultLockAwaitable(const Model::CompleteVaultLockRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::CompleteVaultLock, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CompleteVaultLockOutcome> CompleteVaultLockAwaitable(Model::CompleteVaultLockRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::CompleteVaultLock, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVaultOutcome> CreateVaultAwaitable(const Model::CreateVaultRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::CreateVault, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVaultOutcome> CreateVaultAwaitable(Model::CreateVaultRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::CreateVault, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteArchiveOutcome> DeleteArchiveAwaitable(const Model::DeleteArchiveRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::DeleteArchive, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteArchiveOutcome> DeleteArchiveAwaitable(Model::DeleteArchiveRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::DeleteArchive, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVaultOutcome> DeleteVaultAwaitable(const Model::DeleteVaultRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::DeleteVault, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVaultOutcome> DeleteVaultAwaitable(Model::DeleteVaultRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::DeleteVault, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVaultAccessPolicyOutcome> DeleteVaultAccessPolicyAwaitable(const Model::DeleteVaultAccessPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::DeleteVaultAccessPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVaultAccessPolicyOutcome> DeleteVaultAccessPolicyAwaitable(Model::DeleteVaultAccessPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::DeleteVaultAccessPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVaultNotificationsOutcome> DeleteVaultNotificationsAwaitable(const Model::DeleteVaultNotificationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::DeleteVaultNotifications, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVaultNotificationsOutcome> DeleteVaultNotificationsAwaitable(Model::DeleteVaultNotificationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::DeleteVaultNotifications, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeJobOutcome> DescribeJobAwaitable(const Model::DescribeJobRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::DescribeJob, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeJobOutcome> DescribeJobAwaitable(Model::DescribeJobRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::DescribeJob, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVaultOutcome> DescribeVaultAwaitable(const Model::DescribeVaultRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::DescribeVault, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVaultOutcome> DescribeVaultAwaitable(Model::DescribeVaultRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::DescribeVault, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDataRetrievalPolicyOutcome> GetDataRetrievalPolicyAwaitable(const Model::GetDataRetrievalPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::GetDataRetrievalPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDataRetrievalPolicyOutcome> GetDataRetrievalPolicyAwaitable(Model::GetDataRetrievalPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::GetDataRetrievalPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetJobOutputOutcome> GetJobOutputAwaitable(const Model::GetJobOutputRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::GetJobOutput, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetJobOutputOutcome> GetJobOutputAwaitable(Model::GetJobOutputRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::GetJobOutput, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetVaultAccessPolicyOutcome> GetVaultAccessPolicyAwaitable(const Model::GetVaultAccessPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::GetVaultAccessPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetVaultAccessPolicyOutcome> GetVaultAccessPolicyAwaitable(Model::GetVaultAccessPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::GetVaultAccessPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetVaultLockOutcome> GetVaultLockAwaitable(const Model::GetVaultLockRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::GetVaultLock, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetVaultLockOutcome> GetVaultLockAwaitable(Model::GetVaultLockRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::GetVaultLock, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetVaultNotificationsOutcome> GetVaultNotificationsAwaitable(const Model::GetVaultNotificationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::GetVaultNotifications, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetVaultNotificationsOutcome> GetVaultNotificationsAwaitable(Model::GetVaultNotificationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::GetVaultNotifications, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::InitiateJobOutcome> InitiateJobAwaitable(const Model::InitiateJobRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::InitiateJob, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::InitiateJobOutcome> InitiateJobAwaitable(Model::InitiateJobRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::InitiateJob, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::InitiateMultipartUploadOutcome> InitiateMultipartUploadAwaitable(const Model::InitiateMultipartUploadRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::InitiateMultipartUpload, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::InitiateMultipartUploadOutcome> InitiateMultipartUploadAwaitable(Model::InitiateMultipartUploadRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::InitiateMultipartUpload, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::InitiateVaultLockOutcome> InitiateVaultLockAwaitable(const Model::InitiateVaultLockRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::InitiateVaultLock, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::InitiateVaultLockOutcome> InitiateVaultLockAwaitable(Model::InitiateVaultLockRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::InitiateVaultLock, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListJobsOutcome> ListJobsAwaitable(const Model::ListJobsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::ListJobs, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListJobsOutcome> ListJobsAwaitable(Model::ListJobsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::ListJobs, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListMultipartUploadsOutcome> ListMultipartUploadsAwaitable(const Model::ListMultipartUploadsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::ListMultipartUploads, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListMultipartUploadsOutcome> ListMultipartUploadsAwaitable(Model::ListMultipartUploadsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::ListMultipartUploads, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPartsOutcome> ListPartsAwaitable(const Model::ListPartsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::ListParts, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPartsOutcome> ListPartsAwaitable(Model::ListPartsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::ListParts, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForVaultOutcome> ListTagsForVaultAwaitable(const Model::ListTagsForVaultRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::ListTagsForVault, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForVaultOutcome> ListTagsForVaultAwaitable(Model::ListTagsForVaultRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::ListTagsForVault, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListVaultsOutcome> ListVaultsAwaitable(const Model::ListVaultsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::ListVaults, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListVaultsOutcome> ListVaultsAwaitable(Model::ListVaultsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::ListVaults, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsFromVaultOutcome> RemoveTagsFromVaultAwaitable(const Model::RemoveTagsFromVaultRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::RemoveTagsFromVault, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsFromVaultOutcome> RemoveTagsFromVaultAwaitable(Model::RemoveTagsFromVaultRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::RemoveTagsFromVault, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetDataRetrievalPolicyOutcome> SetDataRetrievalPolicyAwaitable(const Model::SetDataRetrievalPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::SetDataRetrievalPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetDataRetrievalPolicyOutcome> SetDataRetrievalPolicyAwaitable(Model::SetDataRetrievalPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::SetDataRetrievalPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetVaultAccessPolicyOutcome> SetVaultAccessPolicyAwaitable(const Model::SetVaultAccessPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::SetVaultAccessPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetVaultAccessPolicyOutcome> SetVaultAccessPolicyAwaitable(Model::SetVaultAccessPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::SetVaultAccessPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetVaultNotificationsOutcome> SetVaultNotificationsAwaitable(const Model::SetVaultNotificationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::SetVaultNotifications, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetVaultNotificationsOutcome> SetVaultNotificationsAwaitable(Model::SetVaultNotificationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::SetVaultNotifications, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadArchiveOutcome> UploadArchiveAwaitable(const Model::UploadArchiveRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::UploadArchive, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadArchiveOutcome> UploadArchiveAwaitable(Model::UploadArchiveRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::UploadArchive, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadMultipartPartOutcome> UploadMultipartPartAwaitable(const Model::UploadMultipartPartRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::UploadMultipartPart, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadMultipartPartOutcome> UploadMultipartPartAwaitable(Model::UploadMultipartPartRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &GlacierClient::UploadMultipartPart, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
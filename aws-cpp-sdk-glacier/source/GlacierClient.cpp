@@ -143,12 +143,22 @@ AbortMultipartUploadOutcome GlacierClient::AbortMultipartUpload(const AbortMulti
 
 AbortMultipartUploadOutcomeCallable GlacierClient::AbortMultipartUploadCallable(const AbortMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::AbortMultipartUpload, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::AbortMultipartUpload, Aws::Client::RejectedCallOutcome<AbortMultipartUploadOutcome>(), this, request);
+}
+
+AbortMultipartUploadOutcomeCallable GlacierClient::AbortMultipartUploadCallable(AbortMultipartUploadRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::AbortMultipartUpload, Aws::Client::RejectedCallOutcome<AbortMultipartUploadOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::AbortMultipartUploadAsync(const AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::AbortMultipartUploadAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::AbortMultipartUploadAsyncHelper, Aws::Client::RejectedAsyncCall<AbortMultipartUploadOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::AbortMultipartUploadAsync(AbortMultipartUploadRequest&& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::AbortMultipartUploadAsyncHelper, Aws::Client::RejectedAsyncCall<AbortMultipartUploadOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::AbortMultipartUploadAsyncHelper(const AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -178,12 +188,22 @@ AbortVaultLockOutcome GlacierClient::AbortVaultLock(const AbortVaultLockRequest&
 
 AbortVaultLockOutcomeCallable GlacierClient::AbortVaultLockCallable(const AbortVaultLockRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::AbortVaultLock, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::AbortVaultLock, Aws::Client::RejectedCallOutcome<AbortVaultLockOutcome>(), this, request);
+}
+
+AbortVaultLockOutcomeCallable GlacierClient::AbortVaultLockCallable(AbortVaultLockRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::AbortVaultLock, Aws::Client::RejectedCallOutcome<AbortVaultLockOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::AbortVaultLockAsync(const AbortVaultLockRequest& request, const AbortVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::AbortVaultLockAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::AbortVaultLockAsyncHelper, Aws::Client::RejectedAsyncCall<AbortVaultLockOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::AbortVaultLockAsync(AbortVaultLockRequest&& request, const AbortVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::AbortVaultLockAsyncHelper, Aws::Client::RejectedAsyncCall<AbortVaultLockOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::AbortVaultLockAsyncHelper(const AbortVaultLockRequest& request, const AbortVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -213,12 +233,22 @@ AddTagsToVaultOutcome GlacierClient::AddTagsToVault(const AddTagsToVaultRequest&
 
 AddTagsToVaultOutcomeCallable GlacierClient::AddTagsToVaultCallable(const AddTagsToVaultRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::AddTagsToVault, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::AddTagsToVault, Aws::Client::RejectedCallOutcome<AddTagsToVaultOutcome>(), this, request);
+}
+
+AddTagsToVaultOutcomeCallable GlacierClient::AddTagsToVaultCallable(AddTagsToVaultRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::AddTagsToVault, Aws::Client::RejectedCallOutcome<AddTagsToVaultOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::AddTagsToVaultAsync(const AddTagsToVaultRequest& request, const AddTagsToVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::AddTagsToVaultAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::AddTagsToVaultAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsToVaultOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::AddTagsToVaultAsync(AddTagsToVaultRequest&& request, const AddTagsToVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::AddTagsToVaultAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsToVaultOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::AddTagsToVaultAsyncHelper(const AddTagsToVaultRequest& request, const AddTagsToVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -249,12 +279,22 @@ CompleteMultipartUploadOutcome GlacierClient::CompleteMultipartUpload(const Comp
 
 CompleteMultipartUploadOutcomeCallable GlacierClient::CompleteMultipartUploadCallable(const CompleteMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::CompleteMultipartUpload, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::CompleteMultipartUpload, Aws::Client::RejectedCallOutcome<CompleteMultipartUploadOutcome>(), this, request);
+}
+
+CompleteMultipartUploadOutcomeCallable GlacierClient::CompleteMultipartUploadCallable(CompleteMultipartUploadRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::CompleteMultipartUpload, Aws::Client::RejectedCallOutcome<CompleteMultipartUploadOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::CompleteMultipartUploadAsync(const CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::CompleteMultipartUploadAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::CompleteMultipartUploadAsyncHelper, Aws::Client::RejectedAsyncCall<CompleteMultipartUploadOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::CompleteMultipartUploadAsync(CompleteMultipartUploadRequest&& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::CompleteMultipartUploadAsyncHelper, Aws::Client::RejectedAsyncCall<CompleteMultipartUploadOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::CompleteMultipartUploadAsyncHelper(const CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -285,12 +325,22 @@ CompleteVaultLockOutcome GlacierClient::CompleteVaultLock(const CompleteVaultLoc
 
 CompleteVaultLockOutcomeCallable GlacierClient::CompleteVaultLockCallable(const CompleteVaultLockRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::CompleteVaultLock, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::CompleteVaultLock, Aws::Client::RejectedCallOutcome<CompleteVaultLockOutcome>(), this, request);
+}
+
+CompleteVaultLockOutcomeCallable GlacierClient::CompleteVaultLockCallable(CompleteVaultLockRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::CompleteVaultLock, Aws::Client::RejectedCallOutcome<CompleteVaultLockOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::CompleteVaultLockAsync(const CompleteVaultLockRequest& request, const CompleteVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::CompleteVaultLockAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::CompleteVaultLockAsyncHelper, Aws::Client::RejectedAsyncCall<CompleteVaultLockOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::CompleteVaultLockAsync(CompleteVaultLockRequest&& request, const CompleteVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::CompleteVaultLockAsyncHelper, Aws::Client::RejectedAsyncCall<CompleteVaultLockOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::CompleteVaultLockAsyncHelper(const CompleteVaultLockRequest& request, const CompleteVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -319,12 +369,22 @@ CreateVaultOutcome GlacierClient::CreateVault(const CreateVaultRequest& request)
 
 CreateVaultOutcomeCallable GlacierClient::CreateVaultCallable(const CreateVaultRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::CreateVault, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::CreateVault, Aws::Client::RejectedCallOutcome<CreateVaultOutcome>(), this, request);
+}
+
+CreateVaultOutcomeCallable GlacierClient::CreateVaultCallable(CreateVaultRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::CreateVault, Aws::Client::RejectedCallOutcome<CreateVaultOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::CreateVaultAsync(const CreateVaultRequest& request, const CreateVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::CreateVaultAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::CreateVaultAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVaultOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::CreateVaultAsync(CreateVaultRequest&& request, const CreateVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::CreateVaultAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVaultOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::CreateVaultAsyncHelper(const CreateVaultRequest& request, const CreateVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -355,12 +415,22 @@ DeleteArchiveOutcome GlacierClient::DeleteArchive(const DeleteArchiveRequest& re
 
 DeleteArchiveOutcomeCallable GlacierClient::DeleteArchiveCallable(const DeleteArchiveRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::DeleteArchive, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::DeleteArchive, Aws::Client::RejectedCallOutcome<DeleteArchiveOutcome>(), this, request);
+}
+
+DeleteArchiveOutcomeCallable GlacierClient::DeleteArchiveCallable(DeleteArchiveRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::DeleteArchive, Aws::Client::RejectedCallOutcome<DeleteArchiveOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::DeleteArchiveAsync(const DeleteArchiveRequest& request, const DeleteArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::DeleteArchiveAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::DeleteArchiveAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteArchiveOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::DeleteArchiveAsync(DeleteArchiveRequest&& request, const DeleteArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::DeleteArchiveAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteArchiveOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::DeleteArchiveAsyncHelper(const DeleteArchiveRequest& request, const DeleteArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -389,12 +459,22 @@ DeleteVaultOutcome GlacierClient::DeleteVault(const DeleteVaultRequest& request)
 
 DeleteVaultOutcomeCallable GlacierClient::DeleteVaultCallable(const DeleteVaultRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::DeleteVault, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::DeleteVault, Aws::Client::RejectedCallOutcome<DeleteVaultOutcome>(), this, request);
+}
+
+DeleteVaultOutcomeCallable GlacierClient::DeleteVaultCallable(DeleteVaultRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::DeleteVault, Aws::Client::RejectedCallOutcome<DeleteVaultOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::DeleteVaultAsync(const DeleteVaultRequest& request, const DeleteVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::DeleteVaultAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::DeleteVaultAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVaultOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::DeleteVaultAsync(DeleteVaultRequest&& request, const DeleteVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::DeleteVaultAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVaultOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::DeleteVaultAsyncHelper(const DeleteVaultRequest& request, const DeleteVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -424,12 +504,22 @@ DeleteVaultAccessPolicyOutcome GlacierClient::DeleteVaultAccessPolicy(const Dele
 
 DeleteVaultAccessPolicyOutcomeCallable GlacierClient::DeleteVaultAccessPolicyCallable(const DeleteVaultAccessPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::DeleteVaultAccessPolicy, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::DeleteVaultAccessPolicy, Aws::Client::RejectedCallOutcome<DeleteVaultAccessPolicyOutcome>(), this, request);
+}
+
+DeleteVaultAccessPolicyOutcomeCallable GlacierClient::DeleteVaultAccessPolicyCallable(DeleteVaultAccessPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::DeleteVaultAccessPolicy, Aws::Client::RejectedCallOutcome<DeleteVaultAccessPolicyOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::DeleteVaultAccessPolicyAsync(const DeleteVaultAccessPolicyRequest& request, const DeleteVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::DeleteVaultAccessPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::DeleteVaultAccessPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVaultAccessPolicyOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::DeleteVaultAccessPolicyAsync(DeleteVaultAccessPolicyRequest&& request, const DeleteVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::DeleteVaultAccessPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVaultAccessPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::DeleteVaultAccessPolicyAsyncHelper(const DeleteVaultAccessPolicyRequest& request, const DeleteVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -459,12 +549,22 @@ DeleteVaultNotificationsOutcome GlacierClient::DeleteVaultNotifications(const De
 
 DeleteVaultNotificationsOutcomeCallable GlacierClient::DeleteVaultNotificationsCallable(const DeleteVaultNotificationsRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::DeleteVaultNotifications, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::DeleteVaultNotifications, Aws::Client::RejectedCallOutcome<DeleteVaultNotificationsOutcome>(), this, request);
+}
+
+DeleteVaultNotificationsOutcomeCallable GlacierClient::DeleteVaultNotificationsCallable(DeleteVaultNotificationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::DeleteVaultNotifications, Aws::Client::RejectedCallOutcome<DeleteVaultNotificationsOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::DeleteVaultNotificationsAsync(const DeleteVaultNotificationsRequest& request, const DeleteVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::DeleteVaultNotificationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::DeleteVaultNotificationsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVaultNotificationsOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::DeleteVaultNotificationsAsync(DeleteVaultNotificationsRequest&& request, const DeleteVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::DeleteVaultNotificationsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVaultNotificationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::DeleteVaultNotificationsAsyncHelper(const DeleteVaultNotificationsRequest& request, const DeleteVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -495,12 +595,22 @@ DescribeJobOutcome GlacierClient::DescribeJob(const DescribeJobRequest& request)
 
 DescribeJobOutcomeCallable GlacierClient::DescribeJobCallable(const DescribeJobRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::DescribeJob, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::DescribeJob, Aws::Client::RejectedCallOutcome<DescribeJobOutcome>(), this, request);
+}
+
+DescribeJobOutcomeCallable GlacierClient::DescribeJobCallable(DescribeJobRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::DescribeJob, Aws::Client::RejectedCallOutcome<DescribeJobOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::DescribeJobAsync(const DescribeJobRequest& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::DescribeJobAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::DescribeJobAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeJobOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::DescribeJobAsync(DescribeJobRequest&& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::DescribeJobAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeJobOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::DescribeJobAsyncHelper(const DescribeJobRequest& request, const DescribeJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -529,12 +639,22 @@ DescribeVaultOutcome GlacierClient::DescribeVault(const DescribeVaultRequest& re
 
 DescribeVaultOutcomeCallable GlacierClient::DescribeVaultCallable(const DescribeVaultRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::DescribeVault, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::DescribeVault, Aws::Client::RejectedCallOutcome<DescribeVaultOutcome>(), this, request);
+}
+
+DescribeVaultOutcomeCallable GlacierClient::DescribeVaultCallable(DescribeVaultRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::DescribeVault, Aws::Client::RejectedCallOutcome<DescribeVaultOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::DescribeVaultAsync(const DescribeVaultRequest& request, const DescribeVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::DescribeVaultAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::DescribeVaultAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVaultOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::DescribeVaultAsync(DescribeVaultRequest&& request, const DescribeVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::DescribeVaultAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVaultOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::DescribeVaultAsyncHelper(const DescribeVaultRequest& request, const DescribeVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -562,12 +682,22 @@ GetDataRetrievalPolicyOutcome GlacierClient::GetDataRetrievalPolicy(const GetDat
 
 GetDataRetrievalPolicyOutcomeCallable GlacierClient::GetDataRetrievalPolicyCallable(const GetDataRetrievalPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::GetDataRetrievalPolicy, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::GetDataRetrievalPolicy, Aws::Client::RejectedCallOutcome<GetDataRetrievalPolicyOutcome>(), this, request);
+}
+
+GetDataRetrievalPolicyOutcomeCallable GlacierClient::GetDataRetrievalPolicyCallable(GetDataRetrievalPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::GetDataRetrievalPolicy, Aws::Client::RejectedCallOutcome<GetDataRetrievalPolicyOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::GetDataRetrievalPolicyAsync(const GetDataRetrievalPolicyRequest& request, const GetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::GetDataRetrievalPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::GetDataRetrievalPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetDataRetrievalPolicyOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::GetDataRetrievalPolicyAsync(GetDataRetrievalPolicyRequest&& request, const GetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::GetDataRetrievalPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetDataRetrievalPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::GetDataRetrievalPolicyAsyncHelper(const GetDataRetrievalPolicyRequest& request, const GetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -599,12 +729,22 @@ GetJobOutputOutcome GlacierClient::GetJobOutput(const GetJobOutputRequest& reque
 
 GetJobOutputOutcomeCallable GlacierClient::GetJobOutputCallable(const GetJobOutputRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::GetJobOutput, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::GetJobOutput, Aws::Client::RejectedCallOutcome<GetJobOutputOutcome>(), this, request);
+}
+
+GetJobOutputOutcomeCallable GlacierClient::GetJobOutputCallable(GetJobOutputRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::GetJobOutput, Aws::Client::RejectedCallOutcome<GetJobOutputOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::GetJobOutputAsync(const GetJobOutputRequest& request, const GetJobOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::GetJobOutputAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::GetJobOutputAsyncHelper, Aws::Client::RejectedAsyncCall<GetJobOutputOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::GetJobOutputAsync(GetJobOutputRequest&& request, const GetJobOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::GetJobOutputAsyncHelper, Aws::Client::RejectedAsyncCall<GetJobOutputOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::GetJobOutputAsyncHelper(const GetJobOutputRequest& request, const GetJobOutputResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -634,12 +774,22 @@ GetVaultAccessPolicyOutcome GlacierClient::GetVaultAccessPolicy(const GetVaultAc
 
 GetVaultAccessPolicyOutcomeCallable GlacierClient::GetVaultAccessPolicyCallable(const GetVaultAccessPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::GetVaultAccessPolicy, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::GetVaultAccessPolicy, Aws::Client::RejectedCallOutcome<GetVaultAccessPolicyOutcome>(), this, request);
+}
+
+GetVaultAccessPolicyOutcomeCallable GlacierClient::GetVaultAccessPolicyCallable(GetVaultAccessPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::GetVaultAccessPolicy, Aws::Client::RejectedCallOutcome<GetVaultAccessPolicyOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::GetVaultAccessPolicyAsync(const GetVaultAccessPolicyRequest& request, const GetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::GetVaultAccessPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::GetVaultAccessPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetVaultAccessPolicyOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::GetVaultAccessPolicyAsync(GetVaultAccessPolicyRequest&& request, const GetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::GetVaultAccessPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetVaultAccessPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::GetVaultAccessPolicyAsyncHelper(const GetVaultAccessPolicyRequest& request, const GetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -669,12 +819,22 @@ GetVaultLockOutcome GlacierClient::GetVaultLock(const GetVaultLockRequest& reque
 
 GetVaultLockOutcomeCallable GlacierClient::GetVaultLockCallable(const GetVaultLockRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::GetVaultLock, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::GetVaultLock, Aws::Client::RejectedCallOutcome<GetVaultLockOutcome>(), this, request);
+}
+
+GetVaultLockOutcomeCallable GlacierClient::GetVaultLockCallable(GetVaultLockRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::GetVaultLock, Aws::Client::RejectedCallOutcome<GetVaultLockOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::GetVaultLockAsync(const GetVaultLockRequest& request, const GetVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::GetVaultLockAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::GetVaultLockAsyncHelper, Aws::Client::RejectedAsyncCall<GetVaultLockOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::GetVaultLockAsync(GetVaultLockRequest&& request, const GetVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::GetVaultLockAsyncHelper, Aws::Client::RejectedAsyncCall<GetVaultLockOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::GetVaultLockAsyncHelper(const GetVaultLockRequest& request, const GetVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -704,12 +864,22 @@ GetVaultNotificationsOutcome GlacierClient::GetVaultNotifications(const GetVault
 
 GetVaultNotificationsOutcomeCallable GlacierClient::GetVaultNotificationsCallable(const GetVaultNotificationsRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::GetVaultNotifications, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::GetVaultNotifications, Aws::Client::RejectedCallOutcome<GetVaultNotificationsOutcome>(), this, request);
+}
+
+GetVaultNotificationsOutcomeCallable GlacierClient::GetVaultNotificationsCallable(GetVaultNotificationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::GetVaultNotifications, Aws::Client::RejectedCallOutcome<GetVaultNotificationsOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::GetVaultNotificationsAsync(const GetVaultNotificationsRequest& request, const GetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::GetVaultNotificationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::GetVaultNotificationsAsyncHelper, Aws::Client::RejectedAsyncCall<GetVaultNotificationsOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::GetVaultNotificationsAsync(GetVaultNotificationsRequest&& request, const GetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::GetVaultNotificationsAsyncHelper, Aws::Client::RejectedAsyncCall<GetVaultNotificationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::GetVaultNotificationsAsyncHelper(const GetVaultNotificationsRequest& request, const GetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -739,12 +909,22 @@ InitiateJobOutcome GlacierClient::InitiateJob(const InitiateJobRequest& request)
 
 InitiateJobOutcomeCallable GlacierClient::InitiateJobCallable(const InitiateJobRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::InitiateJob, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::InitiateJob, Aws::Client::RejectedCallOutcome<InitiateJobOutcome>(), this, request);
+}
+
+InitiateJobOutcomeCallable GlacierClient::InitiateJobCallable(InitiateJobRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::InitiateJob, Aws::Client::RejectedCallOutcome<InitiateJobOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::InitiateJobAsync(const InitiateJobRequest& request, const InitiateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::InitiateJobAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::InitiateJobAsyncHelper, Aws::Client::RejectedAsyncCall<InitiateJobOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::InitiateJobAsync(InitiateJobRequest&& request, const InitiateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::InitiateJobAsyncHelper, Aws::Client::RejectedAsyncCall<InitiateJobOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::InitiateJobAsyncHelper(const InitiateJobRequest& request, const InitiateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -774,12 +954,22 @@ InitiateMultipartUploadOutcome GlacierClient::InitiateMultipartUpload(const Init
 
 InitiateMultipartUploadOutcomeCallable GlacierClient::InitiateMultipartUploadCallable(const InitiateMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::InitiateMultipartUpload, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::InitiateMultipartUpload, Aws::Client::RejectedCallOutcome<InitiateMultipartUploadOutcome>(), this, request);
+}
+
+InitiateMultipartUploadOutcomeCallable GlacierClient::InitiateMultipartUploadCallable(InitiateMultipartUploadRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::InitiateMultipartUpload, Aws::Client::RejectedCallOutcome<InitiateMultipartUploadOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::InitiateMultipartUploadAsync(const InitiateMultipartUploadRequest& request, const InitiateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::InitiateMultipartUploadAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::InitiateMultipartUploadAsyncHelper, Aws::Client::RejectedAsyncCall<InitiateMultipartUploadOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::InitiateMultipartUploadAsync(InitiateMultipartUploadRequest&& request, const InitiateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::InitiateMultipartUploadAsyncHelper, Aws::Client::RejectedAsyncCall<InitiateMultipartUploadOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::InitiateMultipartUploadAsyncHelper(const InitiateMultipartUploadRequest& request, const InitiateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -809,12 +999,22 @@ InitiateVaultLockOutcome GlacierClient::InitiateVaultLock(const InitiateVaultLoc
 
 InitiateVaultLockOutcomeCallable GlacierClient::InitiateVaultLockCallable(const InitiateVaultLockRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::InitiateVaultLock, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::InitiateVaultLock, Aws::Client::RejectedCallOutcome<InitiateVaultLockOutcome>(), this, request);
+}
+
+InitiateVaultLockOutcomeCallable GlacierClient::InitiateVaultLockCallable(InitiateVaultLockRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::InitiateVaultLock, Aws::Client::RejectedCallOutcome<InitiateVaultLockOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::InitiateVaultLockAsync(const InitiateVaultLockRequest& request, const InitiateVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::InitiateVaultLockAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::InitiateVaultLockAsyncHelper, Aws::Client::RejectedAsyncCall<InitiateVaultLockOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::InitiateVaultLockAsync(InitiateVaultLockRequest&& request, const InitiateVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::InitiateVaultLockAsyncHelper, Aws::Client::RejectedAsyncCall<InitiateVaultLockOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::InitiateVaultLockAsyncHelper(const InitiateVaultLockRequest& request, const InitiateVaultLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -844,12 +1044,22 @@ ListJobsOutcome GlacierClient::ListJobs(const ListJobsRequest& request) const
 
 ListJobsOutcomeCallable GlacierClient::ListJobsCallable(const ListJobsRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::ListJobs, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::ListJobs, Aws::Client::RejectedCallOutcome<ListJobsOutcome>(), this, request);
+}
+
+ListJobsOutcomeCallable GlacierClient::ListJobsCallable(ListJobsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::ListJobs, Aws::Client::RejectedCallOutcome<ListJobsOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::ListJobsAsync(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::ListJobsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::ListJobsAsyncHelper, Aws::Client::RejectedAsyncCall<ListJobsOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::ListJobsAsync(ListJobsRequest&& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::ListJobsAsyncHelper, Aws::Client::RejectedAsyncCall<ListJobsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::ListJobsAsyncHelper(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -879,12 +1089,22 @@ ListMultipartUploadsOutcome GlacierClient::ListMultipartUploads(const ListMultip
 
 ListMultipartUploadsOutcomeCallable GlacierClient::ListMultipartUploadsCallable(const ListMultipartUploadsRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::ListMultipartUploads, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::ListMultipartUploads, Aws::Client::RejectedCallOutcome<ListMultipartUploadsOutcome>(), this, request);
+}
+
+ListMultipartUploadsOutcomeCallable GlacierClient::ListMultipartUploadsCallable(ListMultipartUploadsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::ListMultipartUploads, Aws::Client::RejectedCallOutcome<ListMultipartUploadsOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::ListMultipartUploadsAsync(const ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::ListMultipartUploadsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::ListMultipartUploadsAsyncHelper, Aws::Client::RejectedAsyncCall<ListMultipartUploadsOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::ListMultipartUploadsAsync(ListMultipartUploadsRequest&& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::ListMultipartUploadsAsyncHelper, Aws::Client::RejectedAsyncCall<ListMultipartUploadsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::ListMultipartUploadsAsyncHelper(const ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -915,12 +1135,22 @@ ListPartsOutcome GlacierClient::ListParts(const ListPartsRequest& request) const
 
 ListPartsOutcomeCallable GlacierClient::ListPartsCallable(const ListPartsRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::ListParts, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::ListParts, Aws::Client::RejectedCallOutcome<ListPartsOutcome>(), this, request);
+}
+
+ListPartsOutcomeCallable GlacierClient::ListPartsCallable(ListPartsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::ListParts, Aws::Client::RejectedCallOutcome<ListPartsOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::ListPartsAsync(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::ListPartsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::ListPartsAsyncHelper, Aws::Client::RejectedAsyncCall<ListPartsOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::ListPartsAsync(ListPartsRequest&& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::ListPartsAsyncHelper, Aws::Client::RejectedAsyncCall<ListPartsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::ListPartsAsyncHelper(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -950,12 +1180,22 @@ ListTagsForVaultOutcome GlacierClient::ListTagsForVault(const ListTagsForVaultRe
 
 ListTagsForVaultOutcomeCallable GlacierClient::ListTagsForVaultCallable(const ListTagsForVaultRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::ListTagsForVault, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::ListTagsForVault, Aws::Client::RejectedCallOutcome<ListTagsForVaultOutcome>(), this, request);
+}
+
+ListTagsForVaultOutcomeCallable GlacierClient::ListTagsForVaultCallable(ListTagsForVaultRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::ListTagsForVault, Aws::Client::RejectedCallOutcome<ListTagsForVaultOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::ListTagsForVaultAsync(const ListTagsForVaultRequest& request, const ListTagsForVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::ListTagsForVaultAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::ListTagsForVaultAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForVaultOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::ListTagsForVaultAsync(ListTagsForVaultRequest&& request, const ListTagsForVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::ListTagsForVaultAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForVaultOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::ListTagsForVaultAsyncHelper(const ListTagsForVaultRequest& request, const ListTagsForVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -983,12 +1223,22 @@ ListVaultsOutcome GlacierClient::ListVaults(const ListVaultsRequest& request) co
 
 ListVaultsOutcomeCallable GlacierClient::ListVaultsCallable(const ListVaultsRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::ListVaults, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::ListVaults, Aws::Client::RejectedCallOutcome<ListVaultsOutcome>(), this, request);
+}
+
+ListVaultsOutcomeCallable GlacierClient::ListVaultsCallable(ListVaultsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::ListVaults, Aws::Client::RejectedCallOutcome<ListVaultsOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::ListVaultsAsync(const ListVaultsRequest& request, const ListVaultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::ListVaultsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::ListVaultsAsyncHelper, Aws::Client::RejectedAsyncCall<ListVaultsOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::ListVaultsAsync(ListVaultsRequest&& request, const ListVaultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::ListVaultsAsyncHelper, Aws::Client::RejectedAsyncCall<ListVaultsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::ListVaultsAsyncHelper(const ListVaultsRequest& request, const ListVaultsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1018,12 +1268,22 @@ RemoveTagsFromVaultOutcome GlacierClient::RemoveTagsFromVault(const RemoveTagsFr
 
 RemoveTagsFromVaultOutcomeCallable GlacierClient::RemoveTagsFromVaultCallable(const RemoveTagsFromVaultRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::RemoveTagsFromVault, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::RemoveTagsFromVault, Aws::Client::RejectedCallOutcome<RemoveTagsFromVaultOutcome>(), this, request);
+}
+
+RemoveTagsFromVaultOutcomeCallable GlacierClient::RemoveTagsFromVaultCallable(RemoveTagsFromVaultRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::RemoveTagsFromVault, Aws::Client::RejectedCallOutcome<RemoveTagsFromVaultOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::RemoveTagsFromVaultAsync(const RemoveTagsFromVaultRequest& request, const RemoveTagsFromVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::RemoveTagsFromVaultAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::RemoveTagsFromVaultAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsFromVaultOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::RemoveTagsFromVaultAsync(RemoveTagsFromVaultRequest&& request, const RemoveTagsFromVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::RemoveTagsFromVaultAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsFromVaultOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::RemoveTagsFromVaultAsyncHelper(const RemoveTagsFromVaultRequest& request, const RemoveTagsFromVaultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1051,12 +1311,22 @@ SetDataRetrievalPolicyOutcome GlacierClient::SetDataRetrievalPolicy(const SetDat
 
 SetDataRetrievalPolicyOutcomeCallable GlacierClient::SetDataRetrievalPolicyCallable(const SetDataRetrievalPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::SetDataRetrievalPolicy, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::SetDataRetrievalPolicy, Aws::Client::RejectedCallOutcome<SetDataRetrievalPolicyOutcome>(), this, request);
+}
+
+SetDataRetrievalPolicyOutcomeCallable GlacierClient::SetDataRetrievalPolicyCallable(SetDataRetrievalPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::SetDataRetrievalPolicy, Aws::Client::RejectedCallOutcome<SetDataRetrievalPolicyOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::SetDataRetrievalPolicyAsync(const SetDataRetrievalPolicyRequest& request, const SetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::SetDataRetrievalPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::SetDataRetrievalPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<SetDataRetrievalPolicyOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::SetDataRetrievalPolicyAsync(SetDataRetrievalPolicyRequest&& request, const SetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::SetDataRetrievalPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<SetDataRetrievalPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::SetDataRetrievalPolicyAsyncHelper(const SetDataRetrievalPolicyRequest& request, const SetDataRetrievalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1086,12 +1356,22 @@ SetVaultAccessPolicyOutcome GlacierClient::SetVaultAccessPolicy(const SetVaultAc
 
 SetVaultAccessPolicyOutcomeCallable GlacierClient::SetVaultAccessPolicyCallable(const SetVaultAccessPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::SetVaultAccessPolicy, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::SetVaultAccessPolicy, Aws::Client::RejectedCallOutcome<SetVaultAccessPolicyOutcome>(), this, request);
+}
+
+SetVaultAccessPolicyOutcomeCallable GlacierClient::SetVaultAccessPolicyCallable(SetVaultAccessPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::SetVaultAccessPolicy, Aws::Client::RejectedCallOutcome<SetVaultAccessPolicyOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::SetVaultAccessPolicyAsync(const SetVaultAccessPolicyRequest& request, const SetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::SetVaultAccessPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::SetVaultAccessPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<SetVaultAccessPolicyOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::SetVaultAccessPolicyAsync(SetVaultAccessPolicyRequest&& request, const SetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::SetVaultAccessPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<SetVaultAccessPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::SetVaultAccessPolicyAsyncHelper(const SetVaultAccessPolicyRequest& request, const SetVaultAccessPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1121,12 +1401,22 @@ SetVaultNotificationsOutcome GlacierClient::SetVaultNotifications(const SetVault
 
 SetVaultNotificationsOutcomeCallable GlacierClient::SetVaultNotificationsCallable(const SetVaultNotificationsRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::SetVaultNotifications, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::SetVaultNotifications, Aws::Client::RejectedCallOutcome<SetVaultNotificationsOutcome>(), this, request);
+}
+
+SetVaultNotificationsOutcomeCallable GlacierClient::SetVaultNotificationsCallable(SetVaultNotificationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::SetVaultNotifications, Aws::Client::RejectedCallOutcome<SetVaultNotificationsOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::SetVaultNotificationsAsync(const SetVaultNotificationsRequest& request, const SetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::SetVaultNotificationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::SetVaultNotificationsAsyncHelper, Aws::Client::RejectedAsyncCall<SetVaultNotificationsOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::SetVaultNotificationsAsync(SetVaultNotificationsRequest&& request, const SetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::SetVaultNotificationsAsyncHelper, Aws::Client::RejectedAsyncCall<SetVaultNotificationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::SetVaultNotificationsAsyncHelper(const SetVaultNotificationsRequest& request, const SetVaultNotificationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1156,12 +1446,22 @@ UploadArchiveOutcome GlacierClient::UploadArchive(const UploadArchiveRequest& re
 
 UploadArchiveOutcomeCallable GlacierClient::UploadArchiveCallable(const UploadArchiveRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::UploadArchive, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::UploadArchive, Aws::Client::RejectedCallOutcome<UploadArchiveOutcome>(), this, request);
+}
+
+UploadArchiveOutcomeCallable GlacierClient::UploadArchiveCallable(UploadArchiveRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::UploadArchive, Aws::Client::RejectedCallOutcome<UploadArchiveOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::UploadArchiveAsync(const UploadArchiveRequest& request, const UploadArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::UploadArchiveAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::UploadArchiveAsyncHelper, Aws::Client::RejectedAsyncCall<UploadArchiveOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::UploadArchiveAsync(UploadArchiveRequest&& request, const UploadArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::UploadArchiveAsyncHelper, Aws::Client::RejectedAsyncCall<UploadArchiveOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::UploadArchiveAsyncHelper(const UploadArchiveRequest& request, const UploadArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1192,12 +1492,22 @@ UploadMultipartPartOutcome GlacierClient::UploadMultipartPart(const UploadMultip
 
 UploadMultipartPartOutcomeCallable GlacierClient::UploadMultipartPartCallable(const UploadMultipartPartRequest& request) const
 {
-  return std::async(std::launch::async, &GlacierClient::UploadMultipartPart, this, request);
+  return m_executor->SubmitWithFuture(&GlacierClient::UploadMultipartPart, Aws::Client::RejectedCallOutcome<UploadMultipartPartOutcome>(), this, request);
+}
+
+UploadMultipartPartOutcomeCallable GlacierClient::UploadMultipartPartCallable(UploadMultipartPartRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&GlacierClient::UploadMultipartPart, Aws::Client::RejectedCallOutcome<UploadMultipartPartOutcome>(), this, std::move(request));
 }
 
 void GlacierClient::UploadMultipartPartAsync(const UploadMultipartPartRequest& request, const UploadMultipartPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&GlacierClient::UploadMultipartPartAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&GlacierClient::UploadMultipartPartAsyncHelper, Aws::Client::RejectedAsyncCall<UploadMultipartPartOutcome>(), this, request, handler, context);
+}
+
+void GlacierClient::UploadMultipartPartAsync(UploadMultipartPartRequest&& request, const UploadMultipartPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&GlacierClient::UploadMultipartPartAsyncHelper, Aws::Client::RejectedAsyncCall<UploadMultipartPartOutcome>(), this, std::move(request), handler, context);
 }
 
 void GlacierClient::UploadMultipartPartAsyncHelper(const UploadMultipartPartRequest& request, const UploadMultipartPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -86,6 +86,123 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/iam/model/AddClientIDToOpenIDConnectProviderRequest.h>
+#include <aws/iam/model/AddRoleToInstanceProfileRequest.h>
+#include <aws/iam/model/AddUserToGroupRequest.h>
+#include <aws/iam/model/AttachGroupPolicyRequest.h>
+#include <aws/iam/model/AttachRolePolicyRequest.h>
+#include <aws/iam/model/AttachUserPolicyRequest.h>
+#include <aws/iam/model/ChangePasswordRequest.h>
+#include <aws/iam/model/CreateAccessKeyRequest.h>
+#include <aws/iam/model/CreateAccountAliasRequest.h>
+#include <aws/iam/model/CreateGroupRequest.h>
+#include <aws/iam/model/CreateInstanceProfileRequest.h>
+#include <aws/iam/model/CreateLoginProfileRequest.h>
+#include <aws/iam/model/CreateOpenIDConnectProviderRequest.h>
+#include <aws/iam/model/CreatePolicyRequest.h>
+#include <aws/iam/model/CreatePolicyVersionRequest.h>
+#include <aws/iam/model/CreateRoleRequest.h>
+#include <aws/iam/model/CreateSAMLProviderRequest.h>
+#include <aws/iam/model/CreateUserRequest.h>
+#include <aws/iam/model/CreateVirtualMFADeviceRequest.h>
+#include <aws/iam/model/DeactivateMFADeviceRequest.h>
+#include <aws/iam/model/DeleteAccessKeyRequest.h>
+#include <aws/iam/model/DeleteAccountAliasRequest.h>
+#include <aws/iam/model/DeleteAccountPasswordPolicyRequest.h>
+#include <aws/iam/model/DeleteGroupRequest.h>
+#include <aws/iam/model/DeleteGroupPolicyRequest.h>
+#include <aws/iam/model/DeleteInstanceProfileRequest.h>
+#include <aws/iam/model/DeleteLoginProfileRequest.h>
+#include <aws/iam/model/DeleteOpenIDConnectProviderRequest.h>
+#include <aws/iam/model/DeletePolicyRequest.h>
+#include <aws/iam/model/DeletePolicyVersionRequest.h>
+#include <aws/iam/model/DeleteRoleRequest.h>
+#include <aws/iam/model/DeleteRolePolicyRequest.h>
+#include <aws/iam/model/DeleteSAMLProviderRequest.h>
+#include <aws/iam/model/DeleteSSHPublicKeyRequest.h>
+#include <aws/iam/model/DeleteServerCertificateRequest.h>
+#include <aws/iam/model/DeleteSigningCertificateRequest.h>
+#include <aws/iam/model/DeleteUserRequest.h>
+#include <aws/iam/model/DeleteUserPolicyRequest.h>
+#include <aws/iam/model/DeleteVirtualMFADeviceRequest.h>
+#include <aws/iam/model/DetachGroupPolicyRequest.h>
+#include <aws/iam/model/DetachRolePolicyRequest.h>
+#include <aws/iam/model/DetachUserPolicyRequest.h>
+#include <aws/iam/model/EnableMFADeviceRequest.h>
+#include <aws/iam/model/GenerateCredentialReportRequest.h>
+#include <aws/iam/model/GetAccessKeyLastUsedRequest.h>
+#include <aws/iam/model/GetAccountAuthorizationDetailsRequest.h>
+#include <aws/iam/model/GetAccountPasswordPolicyRequest.h>
+#include <aws/iam/model/GetAccountSummaryRequest.h>
+#include <aws/iam/model/GetContextKeysForCustomPolicyRequest.h>
+#include <aws/iam/model/GetContextKeysForPrincipalPolicyRequest.h>
+#include <aws/iam/model/GetCredentialReportRequest.h>
+#include <aws/iam/model/GetGroupRequest.h>
+#include <aws/iam/model/GetGroupPolicyRequest.h>
+#include <aws/iam/model/GetInstanceProfileRequest.h>
+#include <aws/iam/model/GetLoginProfileRequest.h>
+#include <aws/iam/model/GetOpenIDConnectProviderRequest.h>
+#include <aws/iam/model/GetPolicyRequest.h>
+#include <aws/iam/model/GetPolicyVersionRequest.h>
+#include <aws/iam/model/GetRoleRequest.h>
+#include <aws/iam/model/GetRolePolicyRequest.h>
+#include <aws/iam/model/GetSAMLProviderRequest.h>
+#include <aws/iam/model/GetSSHPublicKeyRequest.h>
+#include <aws/iam/model/GetServerCertificateRequest.h>
+#include <aws/iam/model/GetUserRequest.h>
+#include <aws/iam/model/GetUserPolicyRequest.h>
+#include <aws/iam/model/ListAccessKeysRequest.h>
+#include <aws/iam/model/ListAccountAliasesRequest.h>
+#include <aws/iam/model/ListAttachedGroupPoliciesRequest.h>
+#include <aws/iam/model/ListAttachedRolePoliciesRequest.h>
+#include <aws/iam/model/ListAttachedUserPoliciesRequest.h>
+#include <aws/iam/model/ListEntitiesForPolicyRequest.h>
+#include <aws/iam/model/ListGroupPoliciesRequest.h>
+#include <aws/iam/model/ListGroupsRequest.h>
+#include <aws/iam/model/ListGroupsForUserRequest.h>
+#include <aws/iam/model/ListInstanceProfilesRequest.h>
+#include <aws/iam/model/ListInstanceProfilesForRoleRequest.h>
+#include <aws/iam/model/ListMFADevicesRequest.h>
+#include <aws/iam/model/ListOpenIDConnectProvidersRequest.h>
+#include <aws/iam/model/ListPoliciesRequest.h>
+#include <aws/iam/model/ListPolicyVersionsRequest.h>
+#include <aws/iam/model/ListRolePoliciesRequest.h>
+#include <aws/iam/model/ListRolesRequest.h>
+#include <aws/iam/model/ListSAMLProvidersRequest.h>
+#include <aws/iam/model/ListSSHPublicKeysRequest.h>
+#include <aws/iam/model/ListServerCertificatesRequest.h>
+#include <aws/iam/model/ListSigningCertificatesRequest.h>
+#include <aws/iam/model/ListUserPoliciesRequest.h>
+#include <aws/iam/model/ListUsersRequest.h>
+#include <aws/iam/model/ListVirtualMFADevicesRequest.h>
+#include <aws/iam/model/PutGroupPolicyRequest.h>
+#include <aws/iam/model/PutRolePolicyRequest.h>
+#include <aws/iam/model/PutUserPolicyRequest.h>
+#include <aws/iam/model/RemoveClientIDFromOpenIDConnectProviderRequest.h>
+#include <aws/iam/model/RemoveRoleFromInstanceProfileRequest.h>
+#include <aws/iam/model/RemoveUserFromGroupRequest.h>
+#include <aws/iam/model/ResyncMFADeviceRequest.h>
+#include <aws/iam/model/SetDefaultPolicyVersionRequest.h>
+#include <aws/iam/model/SimulateCustomPolicyRequest.h>
+#include <aws/iam/model/SimulatePrincipalPolicyRequest.h>
+#include <aws/iam/model/UpdateAccessKeyRequest.h>
+#include <aws/iam/model/UpdateAccountPasswordPolicyRequest.h>
+#include <aws/iam/model/UpdateAssumeRolePolicyRequest.h>
+#include <aws/iam/model/UpdateGroupRequest.h>
+#include <aws/iam/model/UpdateLoginProfileRequest.h>
+#include <aws/iam/model/UpdateOpenIDConnectProviderThumbprintRequest.h>
+#include <aws/iam/model/UpdateSAMLProviderRequest.h>
+#include <aws/iam/model/UpdateSSHPublicKeyRequest.h>
+#include <aws/iam/model/UpdateServerCertificateRequest.h>
+#include <aws/iam/model/UpdateSigningCertificateRequest.h>
+#include <aws/iam/model/UpdateUserRequest.h>
+#include <aws/iam/model/UploadSSHPublicKeyRequest.h>
+#include <aws/iam/model/UploadServerCertificateRequest.h>
+#include <aws/iam/model/UploadSigningCertificateRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -679,6 +796,11 @@ namespace Model
          */
         virtual Model::AddClientIDToOpenIDConnectProviderOutcomeCallable AddClientIDToOpenIDConnectProviderCallable(const Model::AddClientIDToOpenIDConnectProviderRequest& request) const;
 
+        /**
+         * Same as AddClientIDToOpenIDConnectProviderCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddClientIDToOpenIDConnectProviderOutcomeCallable AddClientIDToOpenIDConnectProviderCallable(Model::AddClientIDToOpenIDConnectProviderRequest&& request) const;
+
         /**
          * <p>Adds a new client ID (also known as audience) to the list of client IDs
          * already registered for the specified IAM OpenID Connect provider.</p> <p>This
@@ -689,6 +811,11 @@ namespace Model
          */
         virtual void AddClientIDToOpenIDConnectProviderAsync(const Model::AddClientIDToOpenIDConnectProviderRequest& request, const AddClientIDToOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddClientIDToOpenIDConnectProviderAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddClientIDToOpenIDConnectProviderAsync(Model::AddClientIDToOpenIDConnectProviderRequest&& request, const AddClientIDToOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds the specified role to the specified instance profile. For more
          * information about roles, go to <a
@@ -711,6 +838,11 @@ namespace Model
          */
         virtual Model::AddRoleToInstanceProfileOutcomeCallable AddRoleToInstanceProfileCallable(const Model::AddRoleToInstanceProfileRequest& request) const;
 
+        /**
+         * Same as AddRoleToInstanceProfileCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddRoleToInstanceProfileOutcomeCallable AddRoleToInstanceProfileCallable(Model::AddRoleToInstanceProfileRequest&& request) const;
+
         /**
          * <p>Adds the specified role to the specified instance profile. For more
          * information about roles, go to <a
@@ -723,6 +855,11 @@ namespace Model
          */
         virtual void AddRoleToInstanceProfileAsync(const Model::AddRoleToInstanceProfileRequest& request, const AddRoleToInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddRoleToInstanceProfileAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddRoleToInstanceProfileAsync(Model::AddRoleToInstanceProfileRequest&& request, const AddRoleToInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds the specified user to the specified group.</p>
          */
@@ -735,6 +872,11 @@ namespace Model
          */
         virtual Model::AddUserToGroupOutcomeCallable AddUserToGroupCallable(const Model::AddUserToGroupRequest& request) const;
 
+        /**
+         * Same as AddUserToGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddUserToGroupOutcomeCallable AddUserToGroupCallable(Model::AddUserToGroupRequest&& request) const;
+
         /**
          * <p>Adds the specified user to the specified group.</p>
          *
@@ -742,6 +884,11 @@ namespace Model
          */
         virtual void AddUserToGroupAsync(const Model::AddUserToGroupRequest& request, const AddUserToGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddUserToGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddUserToGroupAsync(Model::AddUserToGroupRequest&& request, const AddUserToGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches the specified managed policy to the specified group.</p> <p>You use
          * this API to attach a managed policy to a group. To embed an inline policy in a
@@ -764,6 +911,11 @@ namespace Model
          */
         virtual Model::AttachGroupPolicyOutcomeCallable AttachGroupPolicyCallable(const Model::AttachGroupPolicyRequest& request) const;
 
+        /**
+         * Same as AttachGroupPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachGroupPolicyOutcomeCallable AttachGroupPolicyCallable(Model::AttachGroupPolicyRequest&& request) const;
+
         /**
          * <p>Attaches the specified managed policy to the specified group.</p> <p>You use
          * this API to attach a managed policy to a group. To embed an inline policy in a
@@ -776,6 +928,11 @@ namespace Model
          */
         virtual void AttachGroupPolicyAsync(const Model::AttachGroupPolicyRequest& request, const AttachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachGroupPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachGroupPolicyAsync(Model::AttachGroupPolicyRequest&& request, const AttachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches the specified managed policy to the specified role.</p> <p>When you
          * attach a managed policy to a role, the managed policy is used as the role's
@@ -806,6 +963,11 @@ namespace Model
          */
         virtual Model::AttachRolePolicyOutcomeCallable AttachRolePolicyCallable(const Model::AttachRolePolicyRequest& request) const;
 
+        /**
+         * Same as AttachRolePolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachRolePolicyOutcomeCallable AttachRolePolicyCallable(Model::AttachRolePolicyRequest&& request) const;
+
         /**
          * <p>Attaches the specified managed policy to the specified role.</p> <p>When you
          * attach a managed policy to a role, the managed policy is used as the role's
@@ -822,6 +984,11 @@ namespace Model
          */
         virtual void AttachRolePolicyAsync(const Model::AttachRolePolicyRequest& request, const AttachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachRolePolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachRolePolicyAsync(Model::AttachRolePolicyRequest&& request, const AttachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches the specified managed policy to the specified user.</p> <p>You use
          * this API to attach a managed policy to a user. To embed an inline policy in a
@@ -844,6 +1011,11 @@ namespace Model
          */
         virtual Model::AttachUserPolicyOutcomeCallable AttachUserPolicyCallable(const Model::AttachUserPolicyRequest& request) const;
 
+        /**
+         * Same as AttachUserPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachUserPolicyOutcomeCallable AttachUserPolicyCallable(Model::AttachUserPolicyRequest&& request) const;
+
         /**
          * <p>Attaches the specified managed policy to the specified user.</p> <p>You use
          * this API to attach a managed policy to a user. To embed an inline policy in a
@@ -856,6 +1028,11 @@ namespace Model
          */
         virtual void AttachUserPolicyAsync(const Model::AttachUserPolicyRequest& request, const AttachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachUserPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachUserPolicyAsync(Model::AttachUserPolicyRequest&& request, const AttachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the password of the IAM user who is calling this action. The root
          * account password is not affected by this action. </p> <p>To change the password
@@ -878,6 +1055,11 @@ namespace Model
          */
         virtual Model::ChangePasswordOutcomeCallable ChangePasswordCallable(const Model::ChangePasswordRequest& request) const;
 
+        /**
+         * Same as ChangePasswordCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ChangePasswordOutcomeCallable ChangePasswordCallable(Model::ChangePasswordRequest&& request) const;
+
         /**
          * <p>Changes the password of the IAM user who is calling this action. The root
          * account password is not affected by this action. </p> <p>To change the password
@@ -890,6 +1072,11 @@ namespace Model
          */
         virtual void ChangePasswordAsync(const Model::ChangePasswordRequest& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ChangePasswordAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ChangePasswordAsync(Model::ChangePasswordRequest&& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new AWS secret access key and corresponding AWS access key ID for
          * the specified user. The default status for new keys is <code>Active</code>. </p>
@@ -926,6 +1113,11 @@ namespace Model
          */
         virtual Model::CreateAccessKeyOutcomeCallable CreateAccessKeyCallable(const Model::CreateAccessKeyRequest& request) const;
 
+        /**
+         * Same as CreateAccessKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateAccessKeyOutcomeCallable CreateAccessKeyCallable(Model::CreateAccessKeyRequest&& request) const;
+
         /**
          * <p> Creates a new AWS secret access key and corresponding AWS access key ID for
          * the specified user. The default status for new keys is <code>Active</code>. </p>
@@ -945,6 +1137,11 @@ namespace Model
          */
         virtual void CreateAccessKeyAsync(const Model::CreateAccessKeyRequest& request, const CreateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAccessKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateAccessKeyAsync(Model::CreateAccessKeyRequest&& request, const CreateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an alias for your AWS account. For information about using an AWS
          * account alias, see <a
@@ -963,6 +1160,11 @@ namespace Model
          */
         virtual Model::CreateAccountAliasOutcomeCallable CreateAccountAliasCallable(const Model::CreateAccountAliasRequest& request) const;
 
+        /**
+         * Same as CreateAccountAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateAccountAliasOutcomeCallable CreateAccountAliasCallable(Model::CreateAccountAliasRequest&& request) const;
+
         /**
          * <p>Creates an alias for your AWS account. For information about using an AWS
          * account alias, see <a
@@ -973,6 +1175,11 @@ namespace Model
          */
         virtual void CreateAccountAliasAsync(const Model::CreateAccountAliasRequest& request, const CreateAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAccountAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateAccountAliasAsync(Model::CreateAccountAliasRequest&& request, const CreateAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new group.</p> <p> For information about the number of groups you
          * can create, see <a
@@ -991,6 +1198,11 @@ namespace Model
          */
         virtual Model::CreateGroupOutcomeCallable CreateGroupCallable(const Model::CreateGroupRequest& request) const;
 
+        /**
+         * Same as CreateGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateGroupOutcomeCallable CreateGroupCallable(Model::CreateGroupRequest&& request) const;
+
         /**
          * <p>Creates a new group.</p> <p> For information about the number of groups you
          * can create, see <a
@@ -1001,6 +1213,11 @@ namespace Model
          */
         virtual void CreateGroupAsync(const Model::CreateGroupRequest& request, const CreateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateGroupAsync(Model::CreateGroupRequest&& request, const CreateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new instance profile. For information about instance profiles, go
          * to <a
@@ -1025,6 +1242,11 @@ namespace Model
          */
         virtual Model::CreateInstanceProfileOutcomeCallable CreateInstanceProfileCallable(const Model::CreateInstanceProfileRequest& request) const;
 
+        /**
+         * Same as CreateInstanceProfileCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateInstanceProfileOutcomeCallable CreateInstanceProfileCallable(Model::CreateInstanceProfileRequest&& request) const;
+
         /**
          * <p> Creates a new instance profile. For information about instance profiles, go
          * to <a
@@ -1038,6 +1260,11 @@ namespace Model
          */
         virtual void CreateInstanceProfileAsync(const Model::CreateInstanceProfileRequest& request, const CreateInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateInstanceProfileAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateInstanceProfileAsync(Model::CreateInstanceProfileRequest&& request, const CreateInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a password for the specified user, giving the user the ability to
          * access AWS services through the AWS Management Console. For more information
@@ -1058,6 +1285,11 @@ namespace Model
          */
         virtual Model::CreateLoginProfileOutcomeCallable CreateLoginProfileCallable(const Model::CreateLoginProfileRequest& request) const;
 
+        /**
+         * Same as CreateLoginProfileCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateLoginProfileOutcomeCallable CreateLoginProfileCallable(Model::CreateLoginProfileRequest&& request) const;
+
         /**
          * <p> Creates a password for the specified user, giving the user the ability to
          * access AWS services through the AWS Management Console. For more information
@@ -1069,6 +1301,11 @@ namespace Model
          */
         virtual void CreateLoginProfileAsync(const Model::CreateLoginProfileRequest& request, const CreateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLoginProfileAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateLoginProfileAsync(Model::CreateLoginProfileRequest&& request, const CreateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an IAM entity to describe an identity provider (IdP) that supports <a
          * href="http://openid.net/connect/">OpenID Connect (OIDC)</a>. </p> <p>The OIDC
@@ -1105,6 +1342,11 @@ namespace Model
          */
         virtual Model::CreateOpenIDConnectProviderOutcomeCallable CreateOpenIDConnectProviderCallable(const Model::CreateOpenIDConnectProviderRequest& request) const;
 
+        /**
+         * Same as CreateOpenIDConnectProviderCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateOpenIDConnectProviderOutcomeCallable CreateOpenIDConnectProviderCallable(Model::CreateOpenIDConnectProviderRequest&& request) const;
+
         /**
          * <p>Creates an IAM entity to describe an identity provider (IdP) that supports <a
          * href="http://openid.net/connect/">OpenID Connect (OIDC)</a>. </p> <p>The OIDC
@@ -1124,6 +1366,11 @@ namespace Model
          */
         virtual void CreateOpenIDConnectProviderAsync(const Model::CreateOpenIDConnectProviderRequest& request, const CreateOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateOpenIDConnectProviderAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateOpenIDConnectProviderAsync(Model::CreateOpenIDConnectProviderRequest&& request, const CreateOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new managed policy for your AWS account. </p> <p>This operation
          * creates a policy version with a version identifier of <code>v1</code> and sets
@@ -1152,6 +1399,11 @@ namespace Model
          */
         virtual Model::CreatePolicyOutcomeCallable CreatePolicyCallable(const Model::CreatePolicyRequest& request) const;
 
+        /**
+         * Same as CreatePolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePolicyOutcomeCallable CreatePolicyCallable(Model::CreatePolicyRequest&& request) const;
+
         /**
          * <p>Creates a new managed policy for your AWS account. </p> <p>This operation
          * creates a policy version with a version identifier of <code>v1</code> and sets
@@ -1167,6 +1419,11 @@ namespace Model
          */
         virtual void CreatePolicyAsync(const Model::CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePolicyAsync(Model::CreatePolicyRequest&& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new version of the specified managed policy. To update a managed
          * policy, you create a new policy version. A managed policy can have up to five
@@ -1197,6 +1454,11 @@ namespace Model
          */
         virtual Model::CreatePolicyVersionOutcomeCallable CreatePolicyVersionCallable(const Model::CreatePolicyVersionRequest& request) const;
 
+        /**
+         * Same as CreatePolicyVersionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePolicyVersionOutcomeCallable CreatePolicyVersionCallable(Model::CreatePolicyVersionRequest&& request) const;
+
         /**
          * <p>Creates a new version of the specified managed policy. To update a managed
          * policy, you create a new policy version. A managed policy can have up to five
@@ -1213,6 +1475,11 @@ namespace Model
          */
         virtual void CreatePolicyVersionAsync(const Model::CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePolicyVersionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePolicyVersionAsync(Model::CreatePolicyVersionRequest&& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new role for your AWS account. For more information about roles, go
          * to <a
@@ -1237,6 +1504,11 @@ namespace Model
          */
         virtual Model::CreateRoleOutcomeCallable CreateRoleCallable(const Model::CreateRoleRequest& request) const;
 
+        /**
+         * Same as CreateRoleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateRoleOutcomeCallable CreateRoleCallable(Model::CreateRoleRequest&& request) const;
+
         /**
          * <p>Creates a new role for your AWS account. For more information about roles, go
          * to <a
@@ -1250,6 +1522,11 @@ namespace Model
          */
         virtual void CreateRoleAsync(const Model::CreateRoleRequest& request, const CreateRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRoleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateRoleAsync(Model::CreateRoleRequest&& request, const CreateRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an IAM entity to describe an identity provider (IdP) that supports
          * SAML 2.0.</p> <p> The SAML provider that you create with this operation can be
@@ -1294,6 +1571,11 @@ namespace Model
          */
         virtual Model::CreateSAMLProviderOutcomeCallable CreateSAMLProviderCallable(const Model::CreateSAMLProviderRequest& request) const;
 
+        /**
+         * Same as CreateSAMLProviderCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateSAMLProviderOutcomeCallable CreateSAMLProviderCallable(Model::CreateSAMLProviderRequest&& request) const;
+
         /**
          * <p>Creates an IAM entity to describe an identity provider (IdP) that supports
          * SAML 2.0.</p> <p> The SAML provider that you create with this operation can be
@@ -1317,6 +1599,11 @@ namespace Model
          */
         virtual void CreateSAMLProviderAsync(const Model::CreateSAMLProviderRequest& request, const CreateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSAMLProviderAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateSAMLProviderAsync(Model::CreateSAMLProviderRequest&& request, const CreateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new user for your AWS account.</p> <p> For information about
          * limitations on the number of users you can create, see <a
@@ -1335,6 +1622,11 @@ namespace Model
          */
         virtual Model::CreateUserOutcomeCallable CreateUserCallable(const Model::CreateUserRequest& request) const;
 
+        /**
+         * Same as CreateUserCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateUserOutcomeCallable CreateUserCallable(Model::CreateUserRequest&& request) const;
+
         /**
          * <p>Creates a new user for your AWS account.</p> <p> For information about
          * limitations on the number of users you can create, see <a
@@ -1345,6 +1637,11 @@ namespace Model
          */
         virtual void CreateUserAsync(const Model::CreateUserRequest& request, const CreateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateUserAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateUserAsync(Model::CreateUserRequest&& request, const CreateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new virtual MFA device for the AWS account. After creating the
          * virtual MFA, use <a>EnableMFADevice</a> to attach the MFA device to an IAM user.
@@ -1381,6 +1678,11 @@ namespace Model
          */
         virtual Model::CreateVirtualMFADeviceOutcomeCallable CreateVirtualMFADeviceCallable(const Model::CreateVirtualMFADeviceRequest& request) const;
 
+        /**
+         * Same as CreateVirtualMFADeviceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateVirtualMFADeviceOutcomeCallable CreateVirtualMFADeviceCallable(Model::CreateVirtualMFADeviceRequest&& request) const;
+
         /**
          * <p>Creates a new virtual MFA device for the AWS account. After creating the
          * virtual MFA, use <a>EnableMFADevice</a> to attach the MFA device to an IAM user.
@@ -1400,6 +1702,11 @@ namespace Model
          */
         virtual void CreateVirtualMFADeviceAsync(const Model::CreateVirtualMFADeviceRequest& request, const CreateVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateVirtualMFADeviceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateVirtualMFADeviceAsync(Model::CreateVirtualMFADeviceRequest&& request, const CreateVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deactivates the specified MFA device and removes it from association with the
          * user name for which it was originally enabled. </p> <p>For more information
@@ -1420,6 +1727,11 @@ namespace Model
          */
         virtual Model::DeactivateMFADeviceOutcomeCallable DeactivateMFADeviceCallable(const Model::DeactivateMFADeviceRequest& request) const;
 
+        /**
+         * Same as DeactivateMFADeviceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeactivateMFADeviceOutcomeCallable DeactivateMFADeviceCallable(Model::DeactivateMFADeviceRequest&& request) const;
+
         /**
          * <p>Deactivates the specified MFA device and removes it from association with the
          * user name for which it was originally enabled. </p> <p>For more information
@@ -1431,6 +1743,11 @@ namespace Model
          */
         virtual void DeactivateMFADeviceAsync(const Model::DeactivateMFADeviceRequest& request, const DeactivateMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeactivateMFADeviceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeactivateMFADeviceAsync(Model::DeactivateMFADeviceRequest&& request, const DeactivateMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the access key associated with the specified user.</p> <p> If you do
          * not specify a user name, IAM determines the user name implicitly based on the
@@ -1451,6 +1768,11 @@ namespace Model
          */
         virtual Model::DeleteAccessKeyOutcomeCallable DeleteAccessKeyCallable(const Model::DeleteAccessKeyRequest& request) const;
 
+        /**
+         * Same as DeleteAccessKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteAccessKeyOutcomeCallable DeleteAccessKeyCallable(Model::DeleteAccessKeyRequest&& request) const;
+
         /**
          * <p>Deletes the access key associated with the specified user.</p> <p> If you do
          * not specify a user name, IAM determines the user name implicitly based on the
@@ -1462,6 +1784,11 @@ namespace Model
          */
         virtual void DeleteAccessKeyAsync(const Model::DeleteAccessKeyRequest& request, const DeleteAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAccessKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteAccessKeyAsync(Model::DeleteAccessKeyRequest&& request, const DeleteAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the specified AWS account alias. For information about using an AWS
          * account alias, see <a
@@ -1480,6 +1807,11 @@ namespace Model
          */
         virtual Model::DeleteAccountAliasOutcomeCallable DeleteAccountAliasCallable(const Model::DeleteAccountAliasRequest& request) const;
 
+        /**
+         * Same as DeleteAccountAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteAccountAliasOutcomeCallable DeleteAccountAliasCallable(Model::DeleteAccountAliasRequest&& request) const;
+
         /**
          * <p> Deletes the specified AWS account alias. For information about using an AWS
          * account alias, see <a
@@ -1490,6 +1822,11 @@ namespace Model
          */
         virtual void DeleteAccountAliasAsync(const Model::DeleteAccountAliasRequest& request, const DeleteAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAccountAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteAccountAliasAsync(Model::DeleteAccountAliasRequest&& request, const DeleteAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the password policy for the AWS account.</p>
          */
@@ -1502,6 +1839,11 @@ namespace Model
          */
         virtual Model::DeleteAccountPasswordPolicyOutcomeCallable DeleteAccountPasswordPolicyCallable(const Model::DeleteAccountPasswordPolicyRequest& request) const;
 
+        /**
+         * Same as DeleteAccountPasswordPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteAccountPasswordPolicyOutcomeCallable DeleteAccountPasswordPolicyCallable(Model::DeleteAccountPasswordPolicyRequest&& request) const;
+
         /**
          * <p>Deletes the password policy for the AWS account.</p>
          *
@@ -1509,6 +1851,11 @@ namespace Model
          */
         virtual void DeleteAccountPasswordPolicyAsync(const Model::DeleteAccountPasswordPolicyRequest& request, const DeleteAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAccountPasswordPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteAccountPasswordPolicyAsync(Model::DeleteAccountPasswordPolicyRequest&& request, const DeleteAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the specified group. The group must not contain any users or have
          * any attached policies. </p>
@@ -1523,6 +1870,11 @@ namespace Model
          */
         virtual Model::DeleteGroupOutcomeCallable DeleteGroupCallable(const Model::DeleteGroupRequest& request) const;
 
+        /**
+         * Same as DeleteGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteGroupOutcomeCallable DeleteGroupCallable(Model::DeleteGroupRequest&& request) const;
+
         /**
          * <p> Deletes the specified group. The group must not contain any users or have
          * any attached policies. </p>
@@ -1531,6 +1883,11 @@ namespace Model
          */
         virtual void DeleteGroupAsync(const Model::DeleteGroupRequest& request, const DeleteGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteGroupAsync(Model::DeleteGroupRequest&& request, const DeleteGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified inline policy that is embedded in the specified
          * group.</p> <p>A group can also have managed policies attached to it. To detach a
@@ -1553,6 +1910,11 @@ namespace Model
          */
         virtual Model::DeleteGroupPolicyOutcomeCallable DeleteGroupPolicyCallable(const Model::DeleteGroupPolicyRequest& request) const;
 
+        /**
+         * Same as DeleteGroupPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteGroupPolicyOutcomeCallable DeleteGroupPolicyCallable(Model::DeleteGroupPolicyRequest&& request) const;
+
         /**
          * <p>Deletes the specified inline policy that is embedded in the specified
          * group.</p> <p>A group can also have managed policies attached to it. To detach a
@@ -1565,6 +1927,11 @@ namespace Model
          */
         virtual void DeleteGroupPolicyAsync(const Model::DeleteGroupPolicyRequest& request, const DeleteGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteGroupPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteGroupPolicyAsync(Model::DeleteGroupPolicyRequest&& request, const DeleteGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified instance profile. The instance profile must not have an
          * associated role. </p> <important> Make sure you do not have any Amazon EC2
@@ -1591,6 +1958,11 @@ namespace Model
          */
         virtual Model::DeleteInstanceProfileOutcomeCallable DeleteInstanceProfileCallable(const Model::DeleteInstanceProfileRequest& request) const;
 
+        /**
+         * Same as DeleteInstanceProfileCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteInstanceProfileOutcomeCallable DeleteInstanceProfileCallable(Model::DeleteInstanceProfileRequest&& request) const;
+
         /**
          * <p>Deletes the specified instance profile. The instance profile must not have an
          * associated role. </p> <important> Make sure you do not have any Amazon EC2
@@ -1605,6 +1977,11 @@ namespace Model
          */
         virtual void DeleteInstanceProfileAsync(const Model::DeleteInstanceProfileRequest& request, const DeleteInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteInstanceProfileAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteInstanceProfileAsync(Model::DeleteInstanceProfileRequest&& request, const DeleteInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the password for the specified user, which terminates the user's
          * ability to access AWS services through the AWS Management Console. </p>
@@ -1629,6 +2006,11 @@ namespace Model
          */
         virtual Model::DeleteLoginProfileOutcomeCallable DeleteLoginProfileCallable(const Model::DeleteLoginProfileRequest& request) const;
 
+        /**
+         * Same as DeleteLoginProfileCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteLoginProfileOutcomeCallable DeleteLoginProfileCallable(Model::DeleteLoginProfileRequest&& request) const;
+
         /**
          * <p> Deletes the password for the specified user, which terminates the user's
          * ability to access AWS services through the AWS Management Console. </p>
@@ -1642,6 +2024,11 @@ namespace Model
          */
         virtual void DeleteLoginProfileAsync(const Model::DeleteLoginProfileRequest& request, const DeleteLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLoginProfileAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteLoginProfileAsync(Model::DeleteLoginProfileRequest&& request, const DeleteLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an IAM OpenID Connect identity provider.</p> <p>Deleting an OIDC
          * provider does not update any roles that reference the provider as a principal in
@@ -1664,6 +2051,11 @@ namespace Model
          */
         virtual Model::DeleteOpenIDConnectProviderOutcomeCallable DeleteOpenIDConnectProviderCallable(const Model::DeleteOpenIDConnectProviderRequest& request) const;
 
+        /**
+         * Same as DeleteOpenIDConnectProviderCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteOpenIDConnectProviderOutcomeCallable DeleteOpenIDConnectProviderCallable(Model::DeleteOpenIDConnectProviderRequest&& request) const;
+
         /**
          * <p>Deletes an IAM OpenID Connect identity provider.</p> <p>Deleting an OIDC
          * provider does not update any roles that reference the provider as a principal in
@@ -1676,6 +2068,11 @@ namespace Model
          */
         virtual void DeleteOpenIDConnectProviderAsync(const Model::DeleteOpenIDConnectProviderRequest& request, const DeleteOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteOpenIDConnectProviderAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteOpenIDConnectProviderAsync(Model::DeleteOpenIDConnectProviderRequest&& request, const DeleteOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified managed policy.</p> <p>Before you can delete a managed
          * policy, you must detach the policy from all users, groups, and roles that it is
@@ -1720,6 +2117,11 @@ namespace Model
          */
         virtual Model::DeletePolicyOutcomeCallable DeletePolicyCallable(const Model::DeletePolicyRequest& request) const;
 
+        /**
+         * Same as DeletePolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeletePolicyOutcomeCallable DeletePolicyCallable(Model::DeletePolicyRequest&& request) const;
+
         /**
          * <p>Deletes the specified managed policy.</p> <p>Before you can delete a managed
          * policy, you must detach the policy from all users, groups, and roles that it is
@@ -1743,6 +2145,11 @@ namespace Model
          */
         virtual void DeletePolicyAsync(const Model::DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeletePolicyAsync(Model::DeletePolicyRequest&& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified version of the specified managed policy.</p> <p>You
          * cannot delete the default version of a policy using this API. To delete the
@@ -1767,6 +2174,11 @@ namespace Model
          */
         virtual Model::DeletePolicyVersionOutcomeCallable DeletePolicyVersionCallable(const Model::DeletePolicyVersionRequest& request) const;
 
+        /**
+         * Same as DeletePolicyVersionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeletePolicyVersionOutcomeCallable DeletePolicyVersionCallable(Model::DeletePolicyVersionRequest&& request) const;
+
         /**
          * <p>Deletes the specified version of the specified managed policy.</p> <p>You
          * cannot delete the default version of a policy using this API. To delete the
@@ -1780,6 +2192,11 @@ namespace Model
          */
         virtual void DeletePolicyVersionAsync(const Model::DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePolicyVersionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeletePolicyVersionAsync(Model::DeletePolicyVersionRequest&& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified role. The role must not have any policies attached. For
          * more information about roles, go to <a
@@ -1804,6 +2221,11 @@ namespace Model
          */
         virtual Model::DeleteRoleOutcomeCallable DeleteRoleCallable(const Model::DeleteRoleRequest& request) const;
 
+        /**
+         * Same as DeleteRoleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteRoleOutcomeCallable DeleteRoleCallable(Model::DeleteRoleRequest&& request) const;
+
         /**
          * <p>Deletes the specified role. The role must not have any policies attached. For
          * more information about roles, go to <a
@@ -1817,6 +2239,11 @@ namespace Model
          */
         virtual void DeleteRoleAsync(const Model::DeleteRoleRequest& request, const DeleteRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRoleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteRoleAsync(Model::DeleteRoleRequest&& request, const DeleteRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified inline policy that is embedded in the specified
          * role.</p> <p>A role can also have managed policies attached to it. To detach a
@@ -1839,6 +2266,11 @@ namespace Model
          */
         virtual Model::DeleteRolePolicyOutcomeCallable DeleteRolePolicyCallable(const Model::DeleteRolePolicyRequest& request) const;
 
+        /**
+         * Same as DeleteRolePolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteRolePolicyOutcomeCallable DeleteRolePolicyCallable(Model::DeleteRolePolicyRequest&& request) const;
+
         /**
          * <p>Deletes the specified inline policy that is embedded in the specified
          * role.</p> <p>A role can also have managed policies attached to it. To detach a
@@ -1851,6 +2283,11 @@ namespace Model
          */
         virtual void DeleteRolePolicyAsync(const Model::DeleteRolePolicyRequest& request, const DeleteRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRolePolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteRolePolicyAsync(Model::DeleteRolePolicyRequest&& request, const DeleteRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a SAML provider.</p> <p> Deleting the provider does not update any
          * roles that reference the SAML provider as a principal in their trust policies.
@@ -1873,6 +2310,11 @@ namespace Model
          */
         virtual Model::DeleteSAMLProviderOutcomeCallable DeleteSAMLProviderCallable(const Model::DeleteSAMLProviderRequest& request) const;
 
+        /**
+         * Same as DeleteSAMLProviderCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSAMLProviderOutcomeCallable DeleteSAMLProviderCallable(Model::DeleteSAMLProviderRequest&& request) const;
+
         /**
          * <p>Deletes a SAML provider.</p> <p> Deleting the provider does not update any
          * roles that reference the SAML provider as a principal in their trust policies.
@@ -1885,6 +2327,11 @@ namespace Model
          */
         virtual void DeleteSAMLProviderAsync(const Model::DeleteSAMLProviderRequest& request, const DeleteSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSAMLProviderAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSAMLProviderAsync(Model::DeleteSAMLProviderRequest&& request, const DeleteSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified SSH public key.</p> <p>The SSH public key deleted by
          * this action is used only for authenticating the associated IAM user to an AWS
@@ -1909,6 +2356,11 @@ namespace Model
          */
         virtual Model::DeleteSSHPublicKeyOutcomeCallable DeleteSSHPublicKeyCallable(const Model::DeleteSSHPublicKeyRequest& request) const;
 
+        /**
+         * Same as DeleteSSHPublicKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSSHPublicKeyOutcomeCallable DeleteSSHPublicKeyCallable(Model::DeleteSSHPublicKeyRequest&& request) const;
+
         /**
          * <p>Deletes the specified SSH public key.</p> <p>The SSH public key deleted by
          * this action is used only for authenticating the associated IAM user to an AWS
@@ -1922,6 +2374,11 @@ namespace Model
          */
         virtual void DeleteSSHPublicKeyAsync(const Model::DeleteSSHPublicKeyRequest& request, const DeleteSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSSHPublicKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSSHPublicKeyAsync(Model::DeleteSSHPublicKeyRequest&& request, const DeleteSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified server certificate.</p> <p>For more information about
          * working with server certificates, including a list of AWS services that can use
@@ -1960,6 +2417,11 @@ namespace Model
          */
         virtual Model::DeleteServerCertificateOutcomeCallable DeleteServerCertificateCallable(const Model::DeleteServerCertificateRequest& request) const;
 
+        /**
+         * Same as DeleteServerCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteServerCertificateOutcomeCallable DeleteServerCertificateCallable(Model::DeleteServerCertificateRequest&& request) const;
+
         /**
          * <p>Deletes the specified server certificate.</p> <p>For more information about
          * working with server certificates, including a list of AWS services that can use
@@ -1980,6 +2442,11 @@ namespace Model
          */
         virtual void DeleteServerCertificateAsync(const Model::DeleteServerCertificateRequest& request, const DeleteServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteServerCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteServerCertificateAsync(Model::DeleteServerCertificateRequest&& request, const DeleteServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified signing certificate associated with the specified
          * user.</p> <p>If you do not specify a user name, IAM determines the user name
@@ -2000,6 +2467,11 @@ namespace Model
          */
         virtual Model::DeleteSigningCertificateOutcomeCallable DeleteSigningCertificateCallable(const Model::DeleteSigningCertificateRequest& request) const;
 
+        /**
+         * Same as DeleteSigningCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSigningCertificateOutcomeCallable DeleteSigningCertificateCallable(Model::DeleteSigningCertificateRequest&& request) const;
+
         /**
          * <p>Deletes the specified signing certificate associated with the specified
          * user.</p> <p>If you do not specify a user name, IAM determines the user name
@@ -2011,6 +2483,11 @@ namespace Model
          */
         virtual void DeleteSigningCertificateAsync(const Model::DeleteSigningCertificateRequest& request, const DeleteSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSigningCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSigningCertificateAsync(Model::DeleteSigningCertificateRequest&& request, const DeleteSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the specified user. The user must not belong to any groups, have any
          * keys or signing certificates, or have any attached policies. </p>
@@ -2025,6 +2502,11 @@ namespace Model
          */
         virtual Model::DeleteUserOutcomeCallable DeleteUserCallable(const Model::DeleteUserRequest& request) const;
 
+        /**
+         * Same as DeleteUserCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteUserOutcomeCallable DeleteUserCallable(Model::DeleteUserRequest&& request) const;
+
         /**
          * <p> Deletes the specified user. The user must not belong to any groups, have any
          * keys or signing certificates, or have any attached policies. </p>
@@ -2033,6 +2515,11 @@ namespace Model
          */
         virtual void DeleteUserAsync(const Model::DeleteUserRequest& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteUserAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteUserAsync(Model::DeleteUserRequest&& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified inline policy that is embedded in the specified
          * user.</p> <p>A user can also have managed policies attached to it. To detach a
@@ -2055,6 +2542,11 @@ namespace Model
          */
         virtual Model::DeleteUserPolicyOutcomeCallable DeleteUserPolicyCallable(const Model::DeleteUserPolicyRequest& request) const;
 
+        /**
+         * Same as DeleteUserPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteUserPolicyOutcomeCallable DeleteUserPolicyCallable(Model::DeleteUserPolicyRequest&& request) const;
+
         /**
          * <p>Deletes the specified inline policy that is embedded in the specified
          * user.</p> <p>A user can also have managed policies attached to it. To detach a
@@ -2067,6 +2559,11 @@ namespace Model
          */
         virtual void DeleteUserPolicyAsync(const Model::DeleteUserPolicyRequest& request, const DeleteUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteUserPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteUserPolicyAsync(Model::DeleteUserPolicyRequest&& request, const DeleteUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a virtual MFA device.</p> <note> You must deactivate a user's virtual
          * MFA device before you can delete it. For information about deactivating MFA
@@ -2083,6 +2580,11 @@ namespace Model
          */
         virtual Model::DeleteVirtualMFADeviceOutcomeCallable DeleteVirtualMFADeviceCallable(const Model::DeleteVirtualMFADeviceRequest& request) const;
 
+        /**
+         * Same as DeleteVirtualMFADeviceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteVirtualMFADeviceOutcomeCallable DeleteVirtualMFADeviceCallable(Model::DeleteVirtualMFADeviceRequest&& request) const;
+
         /**
          * <p>Deletes a virtual MFA device.</p> <note> You must deactivate a user's virtual
          * MFA device before you can delete it. For information about deactivating MFA
@@ -2092,6 +2594,11 @@ namespace Model
          */
         virtual void DeleteVirtualMFADeviceAsync(const Model::DeleteVirtualMFADeviceRequest& request, const DeleteVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVirtualMFADeviceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteVirtualMFADeviceAsync(Model::DeleteVirtualMFADeviceRequest&& request, const DeleteVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified managed policy from the specified group. </p> <p>A
          * group can also have inline policies embedded with it. To delete an inline
@@ -2114,6 +2621,11 @@ namespace Model
          */
         virtual Model::DetachGroupPolicyOutcomeCallable DetachGroupPolicyCallable(const Model::DetachGroupPolicyRequest& request) const;
 
+        /**
+         * Same as DetachGroupPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachGroupPolicyOutcomeCallable DetachGroupPolicyCallable(Model::DetachGroupPolicyRequest&& request) const;
+
         /**
          * <p>Removes the specified managed policy from the specified group. </p> <p>A
          * group can also have inline policies embedded with it. To delete an inline
@@ -2126,6 +2638,11 @@ namespace Model
          */
         virtual void DetachGroupPolicyAsync(const Model::DetachGroupPolicyRequest& request, const DetachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachGroupPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachGroupPolicyAsync(Model::DetachGroupPolicyRequest&& request, const DetachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified managed policy from the specified role. </p> <p>A role
          * can also have inline policies embedded with it. To delete an inline policy, use
@@ -2146,6 +2663,11 @@ namespace Model
          */
         virtual Model::DetachRolePolicyOutcomeCallable DetachRolePolicyCallable(const Model::DetachRolePolicyRequest& request) const;
 
+        /**
+         * Same as DetachRolePolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachRolePolicyOutcomeCallable DetachRolePolicyCallable(Model::DetachRolePolicyRequest&& request) const;
+
         /**
          * <p>Removes the specified managed policy from the specified role. </p> <p>A role
          * can also have inline policies embedded with it. To delete an inline policy, use
@@ -2157,6 +2679,11 @@ namespace Model
          */
         virtual void DetachRolePolicyAsync(const Model::DetachRolePolicyRequest& request, const DetachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachRolePolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachRolePolicyAsync(Model::DetachRolePolicyRequest&& request, const DetachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified managed policy from the specified user. </p> <p>A user
          * can also have inline policies embedded with it. To delete an inline policy, use
@@ -2177,6 +2704,11 @@ namespace Model
          */
         virtual Model::DetachUserPolicyOutcomeCallable DetachUserPolicyCallable(const Model::DetachUserPolicyRequest& request) const;
 
+        /**
+         * Same as DetachUserPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachUserPolicyOutcomeCallable DetachUserPolicyCallable(Model::DetachUserPolicyRequest&& request) const;
+
         /**
          * <p>Removes the specified managed policy from the specified user. </p> <p>A user
          * can also have inline policies embedded with it. To delete an inline policy, use
@@ -2188,6 +2720,11 @@ namespace Model
          */
         virtual void DetachUserPolicyAsync(const Model::DetachUserPolicyRequest& request, const DetachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachUserPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachUserPolicyAsync(Model::DetachUserPolicyRequest&& request, const DetachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Enables the specified MFA device and associates it with the specified user
          * name. When enabled, the MFA device is required for every subsequent login by the
@@ -2204,6 +2741,11 @@ namespace Model
          */
         virtual Model::EnableMFADeviceOutcomeCallable EnableMFADeviceCallable(const Model::EnableMFADeviceRequest& request) const;
 
+        /**
+         * Same as EnableMFADeviceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableMFADeviceOutcomeCallable EnableMFADeviceCallable(Model::EnableMFADeviceRequest&& request) const;
+
         /**
          * <p> Enables the specified MFA device and associates it with the specified user
          * name. When enabled, the MFA device is required for every subsequent login by the
@@ -2213,6 +2755,11 @@ namespace Model
          */
         virtual void EnableMFADeviceAsync(const Model::EnableMFADeviceRequest& request, const EnableMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableMFADeviceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableMFADeviceAsync(Model::EnableMFADeviceRequest&& request, const EnableMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Generates a credential report for the AWS account. For more information
          * about the credential report, see <a
@@ -2231,6 +2778,11 @@ namespace Model
          */
         virtual Model::GenerateCredentialReportOutcomeCallable GenerateCredentialReportCallable(const Model::GenerateCredentialReportRequest& request) const;
 
+        /**
+         * Same as GenerateCredentialReportCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GenerateCredentialReportOutcomeCallable GenerateCredentialReportCallable(Model::GenerateCredentialReportRequest&& request) const;
+
         /**
          * <p> Generates a credential report for the AWS account. For more information
          * about the credential report, see <a
@@ -2241,6 +2793,11 @@ namespace Model
          */
         virtual void GenerateCredentialReportAsync(const Model::GenerateCredentialReportRequest& request, const GenerateCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GenerateCredentialReportAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GenerateCredentialReportAsync(Model::GenerateCredentialReportRequest&& request, const GenerateCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about when the specified access key was last used. The
          * information includes the date and time of last use, along with the AWS service
@@ -2257,6 +2814,11 @@ namespace Model
          */
         virtual Model::GetAccessKeyLastUsedOutcomeCallable GetAccessKeyLastUsedCallable(const Model::GetAccessKeyLastUsedRequest& request) const;
 
+        /**
+         * Same as GetAccessKeyLastUsedCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetAccessKeyLastUsedOutcomeCallable GetAccessKeyLastUsedCallable(Model::GetAccessKeyLastUsedRequest&& request) const;
+
         /**
          * <p>Retrieves information about when the specified access key was last used. The
          * information includes the date and time of last use, along with the AWS service
@@ -2266,6 +2828,11 @@ namespace Model
          */
         virtual void GetAccessKeyLastUsedAsync(const Model::GetAccessKeyLastUsedRequest& request, const GetAccessKeyLastUsedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAccessKeyLastUsedAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetAccessKeyLastUsedAsync(Model::GetAccessKeyLastUsedRequest&& request, const GetAccessKeyLastUsedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about all IAM users, groups, roles, and policies in
          * your account, including their relationships to one another. Use this API to
@@ -2288,6 +2855,11 @@ namespace Model
          */
         virtual Model::GetAccountAuthorizationDetailsOutcomeCallable GetAccountAuthorizationDetailsCallable(const Model::GetAccountAuthorizationDetailsRequest& request) const;
 
+        /**
+         * Same as GetAccountAuthorizationDetailsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetAccountAuthorizationDetailsOutcomeCallable GetAccountAuthorizationDetailsCallable(Model::GetAccountAuthorizationDetailsRequest&& request) const;
+
         /**
          * <p>Retrieves information about all IAM users, groups, roles, and policies in
          * your account, including their relationships to one another. Use this API to
@@ -2300,6 +2872,11 @@ namespace Model
          */
         virtual void GetAccountAuthorizationDetailsAsync(const Model::GetAccountAuthorizationDetailsRequest& request, const GetAccountAuthorizationDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAccountAuthorizationDetailsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetAccountAuthorizationDetailsAsync(Model::GetAccountAuthorizationDetailsRequest&& request, const GetAccountAuthorizationDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the password policy for the AWS account. For more information about
          * using a password policy, go to <a
@@ -2318,6 +2895,11 @@ namespace Model
          */
         virtual Model::GetAccountPasswordPolicyOutcomeCallable GetAccountPasswordPolicyCallable(const Model::GetAccountPasswordPolicyRequest& request) const;
 
+        /**
+         * Same as GetAccountPasswordPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetAccountPasswordPolicyOutcomeCallable GetAccountPasswordPolicyCallable(Model::GetAccountPasswordPolicyRequest&& request) const;
+
         /**
          * <p>Retrieves the password policy for the AWS account. For more information about
          * using a password policy, go to <a
@@ -2328,6 +2910,11 @@ namespace Model
          */
         virtual void GetAccountPasswordPolicyAsync(const Model::GetAccountPasswordPolicyRequest& request, const GetAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAccountPasswordPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetAccountPasswordPolicyAsync(Model::GetAccountPasswordPolicyRequest&& request, const GetAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about IAM entity usage and IAM quotas in the AWS
          * account.</p> <p> For information about limitations on IAM entities, see <a
@@ -2346,6 +2933,11 @@ namespace Model
          */
         virtual Model::GetAccountSummaryOutcomeCallable GetAccountSummaryCallable(const Model::GetAccountSummaryRequest& request) const;
 
+        /**
+         * Same as GetAccountSummaryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetAccountSummaryOutcomeCallable GetAccountSummaryCallable(Model::GetAccountSummaryRequest&& request) const;
+
         /**
          * <p>Retrieves information about IAM entity usage and IAM quotas in the AWS
          * account.</p> <p> For information about limitations on IAM entities, see <a
@@ -2356,6 +2948,11 @@ namespace Model
          */
         virtual void GetAccountSummaryAsync(const Model::GetAccountSummaryRequest& request, const GetAccountSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAccountSummaryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetAccountSummaryAsync(Model::GetAccountSummaryRequest&& request, const GetAccountSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a list of all of the context keys referenced in <code>Condition</code>
          * elements in the input policies. The policies are supplied as a list of one or
@@ -2388,6 +2985,11 @@ namespace Model
          */
         virtual Model::GetContextKeysForCustomPolicyOutcomeCallable GetContextKeysForCustomPolicyCallable(const Model::GetContextKeysForCustomPolicyRequest& request) const;
 
+        /**
+         * Same as GetContextKeysForCustomPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetContextKeysForCustomPolicyOutcomeCallable GetContextKeysForCustomPolicyCallable(Model::GetContextKeysForCustomPolicyRequest&& request) const;
+
         /**
          * <p>Gets a list of all of the context keys referenced in <code>Condition</code>
          * elements in the input policies. The policies are supplied as a list of one or
@@ -2405,6 +3007,11 @@ namespace Model
          */
         virtual void GetContextKeysForCustomPolicyAsync(const Model::GetContextKeysForCustomPolicyRequest& request, const GetContextKeysForCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetContextKeysForCustomPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetContextKeysForCustomPolicyAsync(Model::GetContextKeysForCustomPolicyRequest&& request, const GetContextKeysForCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a list of all of the context keys referenced in <code>Condition</code>
          * elements in all of the IAM policies attached to the specified IAM entity. The
@@ -2445,6 +3052,11 @@ namespace Model
          */
         virtual Model::GetContextKeysForPrincipalPolicyOutcomeCallable GetContextKeysForPrincipalPolicyCallable(const Model::GetContextKeysForPrincipalPolicyRequest& request) const;
 
+        /**
+         * Same as GetContextKeysForPrincipalPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetContextKeysForPrincipalPolicyOutcomeCallable GetContextKeysForPrincipalPolicyCallable(Model::GetContextKeysForPrincipalPolicyRequest&& request) const;
+
         /**
          * <p>Gets a list of all of the context keys referenced in <code>Condition</code>
          * elements in all of the IAM policies attached to the specified IAM entity. The
@@ -2466,6 +3078,11 @@ namespace Model
          */
         virtual void GetContextKeysForPrincipalPolicyAsync(const Model::GetContextKeysForPrincipalPolicyRequest& request, const GetContextKeysForPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetContextKeysForPrincipalPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetContextKeysForPrincipalPolicyAsync(Model::GetContextKeysForPrincipalPolicyRequest&& request, const GetContextKeysForPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Retrieves a credential report for the AWS account. For more information
          * about the credential report, see <a
@@ -2484,6 +3101,11 @@ namespace Model
          */
         virtual Model::GetCredentialReportOutcomeCallable GetCredentialReportCallable(const Model::GetCredentialReportRequest& request) const;
 
+        /**
+         * Same as GetCredentialReportCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetCredentialReportOutcomeCallable GetCredentialReportCallable(Model::GetCredentialReportRequest&& request) const;
+
         /**
          * <p> Retrieves a credential report for the AWS account. For more information
          * about the credential report, see <a
@@ -2494,6 +3116,11 @@ namespace Model
          */
         virtual void GetCredentialReportAsync(const Model::GetCredentialReportRequest& request, const GetCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCredentialReportAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetCredentialReportAsync(Model::GetCredentialReportRequest&& request, const GetCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of users that are in the specified group. You can paginate
          * the results using the <code>MaxItems</code> and <code>Marker</code> parameters.
@@ -2510,6 +3137,11 @@ namespace Model
          */
         virtual Model::GetGroupOutcomeCallable GetGroupCallable(const Model::GetGroupRequest& request) const;
 
+        /**
+         * Same as GetGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetGroupOutcomeCallable GetGroupCallable(Model::GetGroupRequest&& request) const;
+
         /**
          * <p> Returns a list of users that are in the specified group. You can paginate
          * the results using the <code>MaxItems</code> and <code>Marker</code> parameters.
@@ -2519,6 +3151,11 @@ namespace Model
          */
         virtual void GetGroupAsync(const Model::GetGroupRequest& request, const GetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetGroupAsync(Model::GetGroupRequest&& request, const GetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the specified inline policy document that is embedded in the
          * specified group. </p> <p>A group can also have managed policies attached to it.
@@ -2545,6 +3182,11 @@ namespace Model
          */
         virtual Model::GetGroupPolicyOutcomeCallable GetGroupPolicyCallable(const Model::GetGroupPolicyRequest& request) const;
 
+        /**
+         * Same as GetGroupPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetGroupPolicyOutcomeCallable GetGroupPolicyCallable(Model::GetGroupPolicyRequest&& request) const;
+
         /**
          * <p>Retrieves the specified inline policy document that is embedded in the
          * specified group. </p> <p>A group can also have managed policies attached to it.
@@ -2559,6 +3201,11 @@ namespace Model
          */
         virtual void GetGroupPolicyAsync(const Model::GetGroupPolicyRequest& request, const GetGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetGroupPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetGroupPolicyAsync(Model::GetGroupPolicyRequest&& request, const GetGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Retrieves information about the specified instance profile, including the
          * instance profile's path, GUID, ARN, and role. For more information about
@@ -2583,6 +3230,11 @@ namespace Model
          */
         virtual Model::GetInstanceProfileOutcomeCallable GetInstanceProfileCallable(const Model::GetInstanceProfileRequest& request) const;
 
+        /**
+         * Same as GetInstanceProfileCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetInstanceProfileOutcomeCallable GetInstanceProfileCallable(Model::GetInstanceProfileRequest&& request) const;
+
         /**
          * <p> Retrieves information about the specified instance profile, including the
          * instance profile's path, GUID, ARN, and role. For more information about
@@ -2596,6 +3248,11 @@ namespace Model
          */
         virtual void GetInstanceProfileAsync(const Model::GetInstanceProfileRequest& request, const GetInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetInstanceProfileAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetInstanceProfileAsync(Model::GetInstanceProfileRequest&& request, const GetInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the user name and password-creation date for the specified user. If
          * the user has not been assigned a password, the action returns a 404
@@ -2612,6 +3269,11 @@ namespace Model
          */
         virtual Model::GetLoginProfileOutcomeCallable GetLoginProfileCallable(const Model::GetLoginProfileRequest& request) const;
 
+        /**
+         * Same as GetLoginProfileCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetLoginProfileOutcomeCallable GetLoginProfileCallable(Model::GetLoginProfileRequest&& request) const;
+
         /**
          * <p>Retrieves the user name and password-creation date for the specified user. If
          * the user has not been assigned a password, the action returns a 404
@@ -2621,6 +3283,11 @@ namespace Model
          */
         virtual void GetLoginProfileAsync(const Model::GetLoginProfileRequest& request, const GetLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetLoginProfileAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetLoginProfileAsync(Model::GetLoginProfileRequest&& request, const GetLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the specified OpenID Connect provider.</p>
          */
@@ -2633,6 +3300,11 @@ namespace Model
          */
         virtual Model::GetOpenIDConnectProviderOutcomeCallable GetOpenIDConnectProviderCallable(const Model::GetOpenIDConnectProviderRequest& request) const;
 
+        /**
+         * Same as GetOpenIDConnectProviderCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetOpenIDConnectProviderOutcomeCallable GetOpenIDConnectProviderCallable(Model::GetOpenIDConnectProviderRequest&& request) const;
+
         /**
          * <p>Returns information about the specified OpenID Connect provider.</p>
          *
@@ -2640,6 +3312,11 @@ namespace Model
          */
         virtual void GetOpenIDConnectProviderAsync(const Model::GetOpenIDConnectProviderRequest& request, const GetOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetOpenIDConnectProviderAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetOpenIDConnectProviderAsync(Model::GetOpenIDConnectProviderRequest&& request, const GetOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about the specified managed policy, including the
          * policy's default version and the total number of users, groups, and roles that
@@ -2674,6 +3351,11 @@ namespace Model
          */
         virtual Model::GetPolicyOutcomeCallable GetPolicyCallable(const Model::GetPolicyRequest& request) const;
 
+        /**
+         * Same as GetPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetPolicyOutcomeCallable GetPolicyCallable(Model::GetPolicyRequest&& request) const;
+
         /**
          * <p>Retrieves information about the specified managed policy, including the
          * policy's default version and the total number of users, groups, and roles that
@@ -2692,6 +3374,11 @@ namespace Model
          */
         virtual void GetPolicyAsync(const Model::GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetPolicyAsync(Model::GetPolicyRequest&& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about the specified version of the specified managed
          * policy, including the policy document. </p> <p>To list the available versions
@@ -2720,6 +3407,11 @@ namespace Model
          */
         virtual Model::GetPolicyVersionOutcomeCallable GetPolicyVersionCallable(const Model::GetPolicyVersionRequest& request) const;
 
+        /**
+         * Same as GetPolicyVersionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetPolicyVersionOutcomeCallable GetPolicyVersionCallable(Model::GetPolicyVersionRequest&& request) const;
+
         /**
          * <p>Retrieves information about the specified version of the specified managed
          * policy, including the policy document. </p> <p>To list the available versions
@@ -2735,6 +3427,11 @@ namespace Model
          */
         virtual void GetPolicyVersionAsync(const Model::GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPolicyVersionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetPolicyVersionAsync(Model::GetPolicyVersionRequest&& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about the specified role, including the role's path,
          * GUID, ARN, and the policy granting permission to assume the role. For more
@@ -2759,6 +3456,11 @@ namespace Model
          */
         virtual Model::GetRoleOutcomeCallable GetRoleCallable(const Model::GetRoleRequest& request) const;
 
+        /**
+         * Same as GetRoleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetRoleOutcomeCallable GetRoleCallable(Model::GetRoleRequest&& request) const;
+
         /**
          * <p>Retrieves information about the specified role, including the role's path,
          * GUID, ARN, and the policy granting permission to assume the role. For more
@@ -2772,6 +3474,11 @@ namespace Model
          */
         virtual void GetRoleAsync(const Model::GetRoleRequest& request, const GetRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRoleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetRoleAsync(Model::GetRoleRequest&& request, const GetRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the specified inline policy document that is embedded with the
          * specified role. </p> <p>A role can also have managed policies attached to it. To
@@ -2804,6 +3511,11 @@ namespace Model
          */
         virtual Model::GetRolePolicyOutcomeCallable GetRolePolicyCallable(const Model::GetRolePolicyRequest& request) const;
 
+        /**
+         * Same as GetRolePolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetRolePolicyOutcomeCallable GetRolePolicyCallable(Model::GetRolePolicyRequest&& request) const;
+
         /**
          * <p>Retrieves the specified inline policy document that is embedded with the
          * specified role. </p> <p>A role can also have managed policies attached to it. To
@@ -2821,6 +3533,11 @@ namespace Model
          */
         virtual void GetRolePolicyAsync(const Model::GetRolePolicyRequest& request, const GetRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRolePolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetRolePolicyAsync(Model::GetRolePolicyRequest&& request, const GetRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the SAML provider metadocument that was uploaded when the provider
          * was created or updated. </p> <note>This operation requires <a
@@ -2839,6 +3556,11 @@ namespace Model
          */
         virtual Model::GetSAMLProviderOutcomeCallable GetSAMLProviderCallable(const Model::GetSAMLProviderRequest& request) const;
 
+        /**
+         * Same as GetSAMLProviderCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetSAMLProviderOutcomeCallable GetSAMLProviderCallable(Model::GetSAMLProviderRequest&& request) const;
+
         /**
          * <p>Returns the SAML provider metadocument that was uploaded when the provider
          * was created or updated. </p> <note>This operation requires <a
@@ -2849,6 +3571,11 @@ namespace Model
          */
         virtual void GetSAMLProviderAsync(const Model::GetSAMLProviderRequest& request, const GetSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSAMLProviderAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetSAMLProviderAsync(Model::GetSAMLProviderRequest&& request, const GetSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the specified SSH public key, including metadata about the key.</p>
          * <p>The SSH public key retrieved by this action is used only for authenticating
@@ -2873,6 +3600,11 @@ namespace Model
          */
         virtual Model::GetSSHPublicKeyOutcomeCallable GetSSHPublicKeyCallable(const Model::GetSSHPublicKeyRequest& request) const;
 
+        /**
+         * Same as GetSSHPublicKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetSSHPublicKeyOutcomeCallable GetSSHPublicKeyCallable(Model::GetSSHPublicKeyRequest&& request) const;
+
         /**
          * <p>Retrieves the specified SSH public key, including metadata about the key.</p>
          * <p>The SSH public key retrieved by this action is used only for authenticating
@@ -2886,6 +3618,11 @@ namespace Model
          */
         virtual void GetSSHPublicKeyAsync(const Model::GetSSHPublicKeyRequest& request, const GetSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSSHPublicKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetSSHPublicKeyAsync(Model::GetSSHPublicKeyRequest&& request, const GetSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about the specified server certificate.</p> <p>For more
          * information about working with server certificates, including a list of AWS
@@ -2906,6 +3643,11 @@ namespace Model
          */
         virtual Model::GetServerCertificateOutcomeCallable GetServerCertificateCallable(const Model::GetServerCertificateRequest& request) const;
 
+        /**
+         * Same as GetServerCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetServerCertificateOutcomeCallable GetServerCertificateCallable(Model::GetServerCertificateRequest&& request) const;
+
         /**
          * <p>Retrieves information about the specified server certificate.</p> <p>For more
          * information about working with server certificates, including a list of AWS
@@ -2917,6 +3659,11 @@ namespace Model
          */
         virtual void GetServerCertificateAsync(const Model::GetServerCertificateRequest& request, const GetServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetServerCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetServerCertificateAsync(Model::GetServerCertificateRequest&& request, const GetServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about the specified user, including the user's creation
          * date, path, unique ID, and ARN. </p> <p>If you do not specify a user name, IAM
@@ -2935,6 +3682,11 @@ namespace Model
          */
         virtual Model::GetUserOutcomeCallable GetUserCallable(const Model::GetUserRequest& request) const;
 
+        /**
+         * Same as GetUserCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetUserOutcomeCallable GetUserCallable(Model::GetUserRequest&& request) const;
+
         /**
          * <p>Retrieves information about the specified user, including the user's creation
          * date, path, unique ID, and ARN. </p> <p>If you do not specify a user name, IAM
@@ -2945,6 +3697,11 @@ namespace Model
          */
         virtual void GetUserAsync(const Model::GetUserRequest& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetUserAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetUserAsync(Model::GetUserRequest&& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the specified inline policy document that is embedded in the
          * specified user. </p> <p>A user can also have managed policies attached to it. To
@@ -2971,6 +3728,11 @@ namespace Model
          */
         virtual Model::GetUserPolicyOutcomeCallable GetUserPolicyCallable(const Model::GetUserPolicyRequest& request) const;
 
+        /**
+         * Same as GetUserPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetUserPolicyOutcomeCallable GetUserPolicyCallable(Model::GetUserPolicyRequest&& request) const;
+
         /**
          * <p>Retrieves the specified inline policy document that is embedded in the
          * specified user. </p> <p>A user can also have managed policies attached to it. To
@@ -2985,6 +3747,11 @@ namespace Model
          */
         virtual void GetUserPolicyAsync(const Model::GetUserPolicyRequest& request, const GetUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetUserPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetUserPolicyAsync(Model::GetUserPolicyRequest&& request, const GetUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the access key IDs associated with the specified
          * user. If there are none, the action returns an empty list. </p> <p>Although each
@@ -3015,6 +3782,11 @@ namespace Model
          */
         virtual Model::ListAccessKeysOutcomeCallable ListAccessKeysCallable(const Model::ListAccessKeysRequest& request) const;
 
+        /**
+         * Same as ListAccessKeysCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAccessKeysOutcomeCallable ListAccessKeysCallable(Model::ListAccessKeysRequest&& request) const;
+
         /**
          * <p>Returns information about the access key IDs associated with the specified
          * user. If there are none, the action returns an empty list. </p> <p>Although each
@@ -3031,6 +3803,11 @@ namespace Model
          */
         virtual void ListAccessKeysAsync(const Model::ListAccessKeysRequest& request, const ListAccessKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAccessKeysAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAccessKeysAsync(Model::ListAccessKeysRequest&& request, const ListAccessKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Lists the account alias associated with the account (Note: you can have only
          * one). For information about using an AWS account alias, see <a
@@ -3049,6 +3826,11 @@ namespace Model
          */
         virtual Model::ListAccountAliasesOutcomeCallable ListAccountAliasesCallable(const Model::ListAccountAliasesRequest& request) const;
 
+        /**
+         * Same as ListAccountAliasesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAccountAliasesOutcomeCallable ListAccountAliasesCallable(Model::ListAccountAliasesRequest&& request) const;
+
         /**
          * <p> Lists the account alias associated with the account (Note: you can have only
          * one). For information about using an AWS account alias, see <a
@@ -3059,6 +3841,11 @@ namespace Model
          */
         virtual void ListAccountAliasesAsync(const Model::ListAccountAliasesRequest& request, const ListAccountAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAccountAliasesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAccountAliasesAsync(Model::ListAccountAliasesRequest&& request, const ListAccountAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all managed policies that are attached to the specified group.</p> <p>A
          * group can also have inline policies embedded with it. To list the inline
@@ -3091,6 +3878,11 @@ namespace Model
          */
         virtual Model::ListAttachedGroupPoliciesOutcomeCallable ListAttachedGroupPoliciesCallable(const Model::ListAttachedGroupPoliciesRequest& request) const;
 
+        /**
+         * Same as ListAttachedGroupPoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAttachedGroupPoliciesOutcomeCallable ListAttachedGroupPoliciesCallable(Model::ListAttachedGroupPoliciesRequest&& request) const;
+
         /**
          * <p>Lists all managed policies that are attached to the specified group.</p> <p>A
          * group can also have inline policies embedded with it. To list the inline
@@ -3108,6 +3900,11 @@ namespace Model
          */
         virtual void ListAttachedGroupPoliciesAsync(const Model::ListAttachedGroupPoliciesRequest& request, const ListAttachedGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAttachedGroupPoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAttachedGroupPoliciesAsync(Model::ListAttachedGroupPoliciesRequest&& request, const ListAttachedGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all managed policies that are attached to the specified role. </p> <p>A
          * role can also have inline policies embedded with it. To list the inline policies
@@ -3140,6 +3937,11 @@ namespace Model
          */
         virtual Model::ListAttachedRolePoliciesOutcomeCallable ListAttachedRolePoliciesCallable(const Model::ListAttachedRolePoliciesRequest& request) const;
 
+        /**
+         * Same as ListAttachedRolePoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAttachedRolePoliciesOutcomeCallable ListAttachedRolePoliciesCallable(Model::ListAttachedRolePoliciesRequest&& request) const;
+
         /**
          * <p>Lists all managed policies that are attached to the specified role. </p> <p>A
          * role can also have inline policies embedded with it. To list the inline policies
@@ -3157,6 +3959,11 @@ namespace Model
          */
         virtual void ListAttachedRolePoliciesAsync(const Model::ListAttachedRolePoliciesRequest& request, const ListAttachedRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAttachedRolePoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAttachedRolePoliciesAsync(Model::ListAttachedRolePoliciesRequest&& request, const ListAttachedRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all managed policies that are attached to the specified user. </p> <p>A
          * user can also have inline policies embedded with it. To list the inline policies
@@ -3189,6 +3996,11 @@ namespace Model
          */
         virtual Model::ListAttachedUserPoliciesOutcomeCallable ListAttachedUserPoliciesCallable(const Model::ListAttachedUserPoliciesRequest& request) const;
 
+        /**
+         * Same as ListAttachedUserPoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAttachedUserPoliciesOutcomeCallable ListAttachedUserPoliciesCallable(Model::ListAttachedUserPoliciesRequest&& request) const;
+
         /**
          * <p>Lists all managed policies that are attached to the specified user. </p> <p>A
          * user can also have inline policies embedded with it. To list the inline policies
@@ -3206,6 +4018,11 @@ namespace Model
          */
         virtual void ListAttachedUserPoliciesAsync(const Model::ListAttachedUserPoliciesRequest& request, const ListAttachedUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAttachedUserPoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAttachedUserPoliciesAsync(Model::ListAttachedUserPoliciesRequest&& request, const ListAttachedUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all users, groups, and roles that the specified managed policy is
          * attached to. </p> <p>You can use the optional <code>EntityFilter</code>
@@ -3230,6 +4047,11 @@ namespace Model
          */
         virtual Model::ListEntitiesForPolicyOutcomeCallable ListEntitiesForPolicyCallable(const Model::ListEntitiesForPolicyRequest& request) const;
 
+        /**
+         * Same as ListEntitiesForPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListEntitiesForPolicyOutcomeCallable ListEntitiesForPolicyCallable(Model::ListEntitiesForPolicyRequest&& request) const;
+
         /**
          * <p>Lists all users, groups, and roles that the specified managed policy is
          * attached to. </p> <p>You can use the optional <code>EntityFilter</code>
@@ -3243,6 +4065,11 @@ namespace Model
          */
         virtual void ListEntitiesForPolicyAsync(const Model::ListEntitiesForPolicyRequest& request, const ListEntitiesForPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListEntitiesForPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListEntitiesForPolicyAsync(Model::ListEntitiesForPolicyRequest&& request, const ListEntitiesForPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the names of the inline policies that are embedded in the specified
          * group. </p> <p>A group can also have managed policies attached to it. To list
@@ -3273,6 +4100,11 @@ namespace Model
          */
         virtual Model::ListGroupPoliciesOutcomeCallable ListGroupPoliciesCallable(const Model::ListGroupPoliciesRequest& request) const;
 
+        /**
+         * Same as ListGroupPoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListGroupPoliciesOutcomeCallable ListGroupPoliciesCallable(Model::ListGroupPoliciesRequest&& request) const;
+
         /**
          * <p>Lists the names of the inline policies that are embedded in the specified
          * group. </p> <p>A group can also have managed policies attached to it. To list
@@ -3289,6 +4121,11 @@ namespace Model
          */
         virtual void ListGroupPoliciesAsync(const Model::ListGroupPoliciesRequest& request, const ListGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListGroupPoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListGroupPoliciesAsync(Model::ListGroupPoliciesRequest&& request, const ListGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the groups that have the specified path prefix.</p> <p> You can
          * paginate the results using the <code>MaxItems</code> and <code>Marker</code>
@@ -3305,6 +4142,11 @@ namespace Model
          */
         virtual Model::ListGroupsOutcomeCallable ListGroupsCallable(const Model::ListGroupsRequest& request) const;
 
+        /**
+         * Same as ListGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListGroupsOutcomeCallable ListGroupsCallable(Model::ListGroupsRequest&& request) const;
+
         /**
          * <p>Lists the groups that have the specified path prefix.</p> <p> You can
          * paginate the results using the <code>MaxItems</code> and <code>Marker</code>
@@ -3314,6 +4156,11 @@ namespace Model
          */
         virtual void ListGroupsAsync(const Model::ListGroupsRequest& request, const ListGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListGroupsAsync(Model::ListGroupsRequest&& request, const ListGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the groups the specified user belongs to.</p> <p>You can paginate the
          * results using the <code>MaxItems</code> and <code>Marker</code> parameters. </p>
@@ -3328,6 +4175,11 @@ namespace Model
          */
         virtual Model::ListGroupsForUserOutcomeCallable ListGroupsForUserCallable(const Model::ListGroupsForUserRequest& request) const;
 
+        /**
+         * Same as ListGroupsForUserCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListGroupsForUserOutcomeCallable ListGroupsForUserCallable(Model::ListGroupsForUserRequest&& request) const;
+
         /**
          * <p>Lists the groups the specified user belongs to.</p> <p>You can paginate the
          * results using the <code>MaxItems</code> and <code>Marker</code> parameters. </p>
@@ -3336,6 +4188,11 @@ namespace Model
          */
         virtual void ListGroupsForUserAsync(const Model::ListGroupsForUserRequest& request, const ListGroupsForUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListGroupsForUserAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListGroupsForUserAsync(Model::ListGroupsForUserRequest&& request, const ListGroupsForUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the instance profiles that have the specified path prefix. If there are
          * none, the action returns an empty list. For more information about instance
@@ -3358,6 +4215,11 @@ namespace Model
          */
         virtual Model::ListInstanceProfilesOutcomeCallable ListInstanceProfilesCallable(const Model::ListInstanceProfilesRequest& request) const;
 
+        /**
+         * Same as ListInstanceProfilesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListInstanceProfilesOutcomeCallable ListInstanceProfilesCallable(Model::ListInstanceProfilesRequest&& request) const;
+
         /**
          * <p>Lists the instance profiles that have the specified path prefix. If there are
          * none, the action returns an empty list. For more information about instance
@@ -3370,6 +4232,11 @@ namespace Model
          */
         virtual void ListInstanceProfilesAsync(const Model::ListInstanceProfilesRequest& request, const ListInstanceProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListInstanceProfilesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListInstanceProfilesAsync(Model::ListInstanceProfilesRequest&& request, const ListInstanceProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the instance profiles that have the specified associated role. If there
          * are none, the action returns an empty list. For more information about instance
@@ -3392,6 +4259,11 @@ namespace Model
          */
         virtual Model::ListInstanceProfilesForRoleOutcomeCallable ListInstanceProfilesForRoleCallable(const Model::ListInstanceProfilesForRoleRequest& request) const;
 
+        /**
+         * Same as ListInstanceProfilesForRoleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListInstanceProfilesForRoleOutcomeCallable ListInstanceProfilesForRoleCallable(Model::ListInstanceProfilesForRoleRequest&& request) const;
+
         /**
          * <p>Lists the instance profiles that have the specified associated role. If there
          * are none, the action returns an empty list. For more information about instance
@@ -3404,6 +4276,11 @@ namespace Model
          */
         virtual void ListInstanceProfilesForRoleAsync(const Model::ListInstanceProfilesForRoleRequest& request, const ListInstanceProfilesForRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListInstanceProfilesForRoleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListInstanceProfilesForRoleAsync(Model::ListInstanceProfilesForRoleRequest&& request, const ListInstanceProfilesForRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the MFA devices. If the request includes the user name, then this
          * action lists all the MFA devices associated with the specified user name. If you
@@ -3424,6 +4301,11 @@ namespace Model
          */
         virtual Model::ListMFADevicesOutcomeCallable ListMFADevicesCallable(const Model::ListMFADevicesRequest& request) const;
 
+        /**
+         * Same as ListMFADevicesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListMFADevicesOutcomeCallable ListMFADevicesCallable(Model::ListMFADevicesRequest&& request) const;
+
         /**
          * <p>Lists the MFA devices. If the request includes the user name, then this
          * action lists all the MFA devices associated with the specified user name. If you
@@ -3435,6 +4317,11 @@ namespace Model
          */
         virtual void ListMFADevicesAsync(const Model::ListMFADevicesRequest& request, const ListMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListMFADevicesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListMFADevicesAsync(Model::ListMFADevicesRequest&& request, const ListMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists information about the OpenID Connect providers in the AWS account. </p>
          */
@@ -3447,6 +4334,11 @@ namespace Model
          */
         virtual Model::ListOpenIDConnectProvidersOutcomeCallable ListOpenIDConnectProvidersCallable(const Model::ListOpenIDConnectProvidersRequest& request) const;
 
+        /**
+         * Same as ListOpenIDConnectProvidersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListOpenIDConnectProvidersOutcomeCallable ListOpenIDConnectProvidersCallable(Model::ListOpenIDConnectProvidersRequest&& request) const;
+
         /**
          * <p>Lists information about the OpenID Connect providers in the AWS account. </p>
          *
@@ -3454,6 +4346,11 @@ namespace Model
          */
         virtual void ListOpenIDConnectProvidersAsync(const Model::ListOpenIDConnectProvidersRequest& request, const ListOpenIDConnectProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListOpenIDConnectProvidersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListOpenIDConnectProvidersAsync(Model::ListOpenIDConnectProvidersRequest&& request, const ListOpenIDConnectProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all the managed policies that are available to your account, including
          * your own customer managed policies and all AWS managed policies. </p> <p>You can
@@ -3486,6 +4383,11 @@ namespace Model
          */
         virtual Model::ListPoliciesOutcomeCallable ListPoliciesCallable(const Model::ListPoliciesRequest& request) const;
 
+        /**
+         * Same as ListPoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListPoliciesOutcomeCallable ListPoliciesCallable(Model::ListPoliciesRequest&& request) const;
+
         /**
          * <p>Lists all the managed policies that are available to your account, including
          * your own customer managed policies and all AWS managed policies. </p> <p>You can
@@ -3503,6 +4405,11 @@ namespace Model
          */
         virtual void ListPoliciesAsync(const Model::ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListPoliciesAsync(Model::ListPoliciesRequest&& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists information about the versions of the specified managed policy,
          * including the version that is set as the policy's default version. </p> <p>For
@@ -3523,6 +4430,11 @@ namespace Model
          */
         virtual Model::ListPolicyVersionsOutcomeCallable ListPolicyVersionsCallable(const Model::ListPolicyVersionsRequest& request) const;
 
+        /**
+         * Same as ListPolicyVersionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListPolicyVersionsOutcomeCallable ListPolicyVersionsCallable(Model::ListPolicyVersionsRequest&& request) const;
+
         /**
          * <p>Lists information about the versions of the specified managed policy,
          * including the version that is set as the policy's default version. </p> <p>For
@@ -3534,6 +4446,11 @@ namespace Model
          */
         virtual void ListPolicyVersionsAsync(const Model::ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPolicyVersionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListPolicyVersionsAsync(Model::ListPolicyVersionsRequest&& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the names of the inline policies that are embedded in the specified
          * role. </p> <p>A role can also have managed policies attached to it. To list the
@@ -3564,6 +4481,11 @@ namespace Model
          */
         virtual Model::ListRolePoliciesOutcomeCallable ListRolePoliciesCallable(const Model::ListRolePoliciesRequest& request) const;
 
+        /**
+         * Same as ListRolePoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListRolePoliciesOutcomeCallable ListRolePoliciesCallable(Model::ListRolePoliciesRequest&& request) const;
+
         /**
          * <p>Lists the names of the inline policies that are embedded in the specified
          * role. </p> <p>A role can also have managed policies attached to it. To list the
@@ -3580,6 +4502,11 @@ namespace Model
          */
         virtual void ListRolePoliciesAsync(const Model::ListRolePoliciesRequest& request, const ListRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRolePoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListRolePoliciesAsync(Model::ListRolePoliciesRequest&& request, const ListRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the roles that have the specified path prefix. If there are none, the
          * action returns an empty list. For more information about roles, go to <a
@@ -3600,6 +4527,11 @@ namespace Model
          */
         virtual Model::ListRolesOutcomeCallable ListRolesCallable(const Model::ListRolesRequest& request) const;
 
+        /**
+         * Same as ListRolesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListRolesOutcomeCallable ListRolesCallable(Model::ListRolesRequest&& request) const;
+
         /**
          * <p>Lists the roles that have the specified path prefix. If there are none, the
          * action returns an empty list. For more information about roles, go to <a
@@ -3611,6 +4543,11 @@ namespace Model
          */
         virtual void ListRolesAsync(const Model::ListRolesRequest& request, const ListRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRolesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListRolesAsync(Model::ListRolesRequest&& request, const ListRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the SAML providers in the account.</p> <note> This operation requires
          * <a
@@ -3629,6 +4566,11 @@ namespace Model
          */
         virtual Model::ListSAMLProvidersOutcomeCallable ListSAMLProvidersCallable(const Model::ListSAMLProvidersRequest& request) const;
 
+        /**
+         * Same as ListSAMLProvidersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListSAMLProvidersOutcomeCallable ListSAMLProvidersCallable(Model::ListSAMLProvidersRequest&& request) const;
+
         /**
          * <p>Lists the SAML providers in the account.</p> <note> This operation requires
          * <a
@@ -3639,6 +4581,11 @@ namespace Model
          */
         virtual void ListSAMLProvidersAsync(const Model::ListSAMLProvidersRequest& request, const ListSAMLProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSAMLProvidersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListSAMLProvidersAsync(Model::ListSAMLProvidersRequest&& request, const ListSAMLProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the SSH public keys associated with the specified
          * IAM user. If there are none, the action returns an empty list.</p> <p>The SSH
@@ -3669,6 +4616,11 @@ namespace Model
          */
         virtual Model::ListSSHPublicKeysOutcomeCallable ListSSHPublicKeysCallable(const Model::ListSSHPublicKeysRequest& request) const;
 
+        /**
+         * Same as ListSSHPublicKeysCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListSSHPublicKeysOutcomeCallable ListSSHPublicKeysCallable(Model::ListSSHPublicKeysRequest&& request) const;
+
         /**
          * <p>Returns information about the SSH public keys associated with the specified
          * IAM user. If there are none, the action returns an empty list.</p> <p>The SSH
@@ -3685,6 +4637,11 @@ namespace Model
          */
         virtual void ListSSHPublicKeysAsync(const Model::ListSSHPublicKeysRequest& request, const ListSSHPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSSHPublicKeysAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListSSHPublicKeysAsync(Model::ListSSHPublicKeysRequest&& request, const ListSSHPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Lists the server certificates that have the specified path prefix. If none
          * exist, the action returns an empty list. </p> <p> You can paginate the results
@@ -3709,6 +4666,11 @@ namespace Model
          */
         virtual Model::ListServerCertificatesOutcomeCallable ListServerCertificatesCallable(const Model::ListServerCertificatesRequest& request) const;
 
+        /**
+         * Same as ListServerCertificatesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListServerCertificatesOutcomeCallable ListServerCertificatesCallable(Model::ListServerCertificatesRequest&& request) const;
+
         /**
          * <p> Lists the server certificates that have the specified path prefix. If none
          * exist, the action returns an empty list. </p> <p> You can paginate the results
@@ -3722,6 +4684,11 @@ namespace Model
          */
         virtual void ListServerCertificatesAsync(const Model::ListServerCertificatesRequest& request, const ListServerCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListServerCertificatesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListServerCertificatesAsync(Model::ListServerCertificatesRequest&& request, const ListServerCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the signing certificates associated with the
          * specified user. If there are none, the action returns an empty list. </p>
@@ -3750,6 +4717,11 @@ namespace Model
          */
         virtual Model::ListSigningCertificatesOutcomeCallable ListSigningCertificatesCallable(const Model::ListSigningCertificatesRequest& request) const;
 
+        /**
+         * Same as ListSigningCertificatesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListSigningCertificatesOutcomeCallable ListSigningCertificatesCallable(Model::ListSigningCertificatesRequest&& request) const;
+
         /**
          * <p>Returns information about the signing certificates associated with the
          * specified user. If there are none, the action returns an empty list. </p>
@@ -3765,6 +4737,11 @@ namespace Model
          */
         virtual void ListSigningCertificatesAsync(const Model::ListSigningCertificatesRequest& request, const ListSigningCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSigningCertificatesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListSigningCertificatesAsync(Model::ListSigningCertificatesRequest&& request, const ListSigningCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the names of the inline policies embedded in the specified user. </p>
          * <p>A user can also have managed policies attached to it. To list the managed
@@ -3793,6 +4770,11 @@ namespace Model
          */
         virtual Model::ListUserPoliciesOutcomeCallable ListUserPoliciesCallable(const Model::ListUserPoliciesRequest& request) const;
 
+        /**
+         * Same as ListUserPoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListUserPoliciesOutcomeCallable ListUserPoliciesCallable(Model::ListUserPoliciesRequest&& request) const;
+
         /**
          * <p>Lists the names of the inline policies embedded in the specified user. </p>
          * <p>A user can also have managed policies attached to it. To list the managed
@@ -3808,6 +4790,11 @@ namespace Model
          */
         virtual void ListUserPoliciesAsync(const Model::ListUserPoliciesRequest& request, const ListUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListUserPoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListUserPoliciesAsync(Model::ListUserPoliciesRequest&& request, const ListUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the IAM users that have the specified path prefix. If no path prefix is
          * specified, the action returns all users in the AWS account. If there are none,
@@ -3826,6 +4813,11 @@ namespace Model
          */
         virtual Model::ListUsersOutcomeCallable ListUsersCallable(const Model::ListUsersRequest& request) const;
 
+        /**
+         * Same as ListUsersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListUsersOutcomeCallable ListUsersCallable(Model::ListUsersRequest&& request) const;
+
         /**
          * <p>Lists the IAM users that have the specified path prefix. If no path prefix is
          * specified, the action returns all users in the AWS account. If there are none,
@@ -3836,6 +4828,11 @@ namespace Model
          */
         virtual void ListUsersAsync(const Model::ListUsersRequest& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListUsersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListUsersAsync(Model::ListUsersRequest&& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the virtual MFA devices under the AWS account by assignment status. If
          * you do not specify an assignment status, the action returns a list of all
@@ -3856,6 +4853,11 @@ namespace Model
          */
         virtual Model::ListVirtualMFADevicesOutcomeCallable ListVirtualMFADevicesCallable(const Model::ListVirtualMFADevicesRequest& request) const;
 
+        /**
+         * Same as ListVirtualMFADevicesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListVirtualMFADevicesOutcomeCallable ListVirtualMFADevicesCallable(Model::ListVirtualMFADevicesRequest&& request) const;
+
         /**
          * <p>Lists the virtual MFA devices under the AWS account by assignment status. If
          * you do not specify an assignment status, the action returns a list of all
@@ -3867,6 +4869,11 @@ namespace Model
          */
         virtual void ListVirtualMFADevicesAsync(const Model::ListVirtualMFADevicesRequest& request, const ListVirtualMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListVirtualMFADevicesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListVirtualMFADevicesAsync(Model::ListVirtualMFADevicesRequest&& request, const ListVirtualMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds (or updates) an inline policy document that is embedded in the specified
          * group. </p> <p>A user can also have managed policies attached to it. To attach a
@@ -3907,6 +4914,11 @@ namespace Model
          */
         virtual Model::PutGroupPolicyOutcomeCallable PutGroupPolicyCallable(const Model::PutGroupPolicyRequest& request) const;
 
+        /**
+         * Same as PutGroupPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutGroupPolicyOutcomeCallable PutGroupPolicyCallable(Model::PutGroupPolicyRequest&& request) const;
+
         /**
          * <p>Adds (or updates) an inline policy document that is embedded in the specified
          * group. </p> <p>A user can also have managed policies attached to it. To attach a
@@ -3928,6 +4940,11 @@ namespace Model
          */
         virtual void PutGroupPolicyAsync(const Model::PutGroupPolicyRequest& request, const PutGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutGroupPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutGroupPolicyAsync(Model::PutGroupPolicyRequest&& request, const PutGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds (or updates) an inline policy document that is embedded in the specified
          * role. </p> <p>When you embed an inline policy in a role, the inline policy is
@@ -3982,6 +4999,11 @@ namespace Model
          */
         virtual Model::PutRolePolicyOutcomeCallable PutRolePolicyCallable(const Model::PutRolePolicyRequest& request) const;
 
+        /**
+         * Same as PutRolePolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutRolePolicyOutcomeCallable PutRolePolicyCallable(Model::PutRolePolicyRequest&& request) const;
+
         /**
          * <p>Adds (or updates) an inline policy document that is embedded in the specified
          * role. </p> <p>When you embed an inline policy in a role, the inline policy is
@@ -4010,6 +5032,11 @@ namespace Model
          */
         virtual void PutRolePolicyAsync(const Model::PutRolePolicyRequest& request, const PutRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRolePolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutRolePolicyAsync(Model::PutRolePolicyRequest&& request, const PutRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds (or updates) an inline policy document that is embedded in the specified
          * user. </p> <p>A user can also have a managed policy attached to it. To attach a
@@ -4050,6 +5077,11 @@ namespace Model
          */
         virtual Model::PutUserPolicyOutcomeCallable PutUserPolicyCallable(const Model::PutUserPolicyRequest& request) const;
 
+        /**
+         * Same as PutUserPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutUserPolicyOutcomeCallable PutUserPolicyCallable(Model::PutUserPolicyRequest&& request) const;
+
         /**
          * <p>Adds (or updates) an inline policy document that is embedded in the specified
          * user. </p> <p>A user can also have a managed policy attached to it. To attach a
@@ -4071,6 +5103,11 @@ namespace Model
          */
         virtual void PutUserPolicyAsync(const Model::PutUserPolicyRequest& request, const PutUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutUserPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutUserPolicyAsync(Model::PutUserPolicyRequest&& request, const PutUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified client ID (also known as audience) from the list of
          * client IDs registered for the specified IAM OpenID Connect provider.</p> <p>This
@@ -4089,6 +5126,11 @@ namespace Model
          */
         virtual Model::RemoveClientIDFromOpenIDConnectProviderOutcomeCallable RemoveClientIDFromOpenIDConnectProviderCallable(const Model::RemoveClientIDFromOpenIDConnectProviderRequest& request) const;
 
+        /**
+         * Same as RemoveClientIDFromOpenIDConnectProviderCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveClientIDFromOpenIDConnectProviderOutcomeCallable RemoveClientIDFromOpenIDConnectProviderCallable(Model::RemoveClientIDFromOpenIDConnectProviderRequest&& request) const;
+
         /**
          * <p>Removes the specified client ID (also known as audience) from the list of
          * client IDs registered for the specified IAM OpenID Connect provider.</p> <p>This
@@ -4099,6 +5141,11 @@ namespace Model
          */
         virtual void RemoveClientIDFromOpenIDConnectProviderAsync(const Model::RemoveClientIDFromOpenIDConnectProviderRequest& request, const RemoveClientIDFromOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveClientIDFromOpenIDConnectProviderAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveClientIDFromOpenIDConnectProviderAsync(Model::RemoveClientIDFromOpenIDConnectProviderRequest&& request, const RemoveClientIDFromOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified role from the specified instance profile.</p>
          * <important> Make sure you do not have any Amazon EC2 instances running with the
@@ -4129,6 +5176,11 @@ namespace Model
          */
         virtual Model::RemoveRoleFromInstanceProfileOutcomeCallable RemoveRoleFromInstanceProfileCallable(const Model::RemoveRoleFromInstanceProfileRequest& request) const;
 
+        /**
+         * Same as RemoveRoleFromInstanceProfileCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveRoleFromInstanceProfileOutcomeCallable RemoveRoleFromInstanceProfileCallable(Model::RemoveRoleFromInstanceProfileRequest&& request) const;
+
         /**
          * <p>Removes the specified role from the specified instance profile.</p>
          * <important> Make sure you do not have any Amazon EC2 instances running with the
@@ -4145,6 +5197,11 @@ namespace Model
          */
         virtual void RemoveRoleFromInstanceProfileAsync(const Model::RemoveRoleFromInstanceProfileRequest& request, const RemoveRoleFromInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveRoleFromInstanceProfileAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveRoleFromInstanceProfileAsync(Model::RemoveRoleFromInstanceProfileRequest&& request, const RemoveRoleFromInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified user from the specified group.</p>
          */
@@ -4157,6 +5214,11 @@ namespace Model
          */
         virtual Model::RemoveUserFromGroupOutcomeCallable RemoveUserFromGroupCallable(const Model::RemoveUserFromGroupRequest& request) const;
 
+        /**
+         * Same as RemoveUserFromGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveUserFromGroupOutcomeCallable RemoveUserFromGroupCallable(Model::RemoveUserFromGroupRequest&& request) const;
+
         /**
          * <p>Removes the specified user from the specified group.</p>
          *
@@ -4164,6 +5226,11 @@ namespace Model
          */
         virtual void RemoveUserFromGroupAsync(const Model::RemoveUserFromGroupRequest& request, const RemoveUserFromGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveUserFromGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveUserFromGroupAsync(Model::RemoveUserFromGroupRequest&& request, const RemoveUserFromGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Synchronizes the specified MFA device with AWS servers.</p> <p>For more
          * information about creating and working with virtual MFA devices, go to <a
@@ -4182,6 +5249,11 @@ namespace Model
          */
         virtual Model::ResyncMFADeviceOutcomeCallable ResyncMFADeviceCallable(const Model::ResyncMFADeviceRequest& request) const;
 
+        /**
+         * Same as ResyncMFADeviceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ResyncMFADeviceOutcomeCallable ResyncMFADeviceCallable(Model::ResyncMFADeviceRequest&& request) const;
+
         /**
          * <p>Synchronizes the specified MFA device with AWS servers.</p> <p>For more
          * information about creating and working with virtual MFA devices, go to <a
@@ -4192,6 +5264,11 @@ namespace Model
          */
         virtual void ResyncMFADeviceAsync(const Model::ResyncMFADeviceRequest& request, const ResyncMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResyncMFADeviceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ResyncMFADeviceAsync(Model::ResyncMFADeviceRequest&& request, const ResyncMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the specified version of the specified policy as the policy's default
          * (operative) version. </p> <p>This action affects all users, groups, and roles
@@ -4216,6 +5293,11 @@ namespace Model
          */
         virtual Model::SetDefaultPolicyVersionOutcomeCallable SetDefaultPolicyVersionCallable(const Model::SetDefaultPolicyVersionRequest& request) const;
 
+        /**
+         * Same as SetDefaultPolicyVersionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetDefaultPolicyVersionOutcomeCallable SetDefaultPolicyVersionCallable(Model::SetDefaultPolicyVersionRequest&& request) const;
+
         /**
          * <p>Sets the specified version of the specified policy as the policy's default
          * (operative) version. </p> <p>This action affects all users, groups, and roles
@@ -4229,6 +5311,11 @@ namespace Model
          */
         virtual void SetDefaultPolicyVersionAsync(const Model::SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetDefaultPolicyVersionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetDefaultPolicyVersionAsync(Model::SetDefaultPolicyVersionRequest&& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Simulate how a set of IAM policies and optionally a resource-based policy
          * works with a list of API actions and AWS resources to determine the policies'
@@ -4267,6 +5354,11 @@ namespace Model
          */
         virtual Model::SimulateCustomPolicyOutcomeCallable SimulateCustomPolicyCallable(const Model::SimulateCustomPolicyRequest& request) const;
 
+        /**
+         * Same as SimulateCustomPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SimulateCustomPolicyOutcomeCallable SimulateCustomPolicyCallable(Model::SimulateCustomPolicyRequest&& request) const;
+
         /**
          * <p>Simulate how a set of IAM policies and optionally a resource-based policy
          * works with a list of API actions and AWS resources to determine the policies'
@@ -4287,6 +5379,11 @@ namespace Model
          */
         virtual void SimulateCustomPolicyAsync(const Model::SimulateCustomPolicyRequest& request, const SimulateCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SimulateCustomPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SimulateCustomPolicyAsync(Model::SimulateCustomPolicyRequest&& request, const SimulateCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Simulate how a set of IAM policies attached to an IAM entity works with a
          * list of API actions and AWS resources to determine the policies' effective
@@ -4339,6 +5436,11 @@ namespace Model
          */
         virtual Model::SimulatePrincipalPolicyOutcomeCallable SimulatePrincipalPolicyCallable(const Model::SimulatePrincipalPolicyRequest& request) const;
 
+        /**
+         * Same as SimulatePrincipalPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SimulatePrincipalPolicyOutcomeCallable SimulatePrincipalPolicyCallable(Model::SimulatePrincipalPolicyRequest&& request) const;
+
         /**
          * <p>Simulate how a set of IAM policies attached to an IAM entity works with a
          * list of API actions and AWS resources to determine the policies' effective
@@ -4366,6 +5468,11 @@ namespace Model
          */
         virtual void SimulatePrincipalPolicyAsync(const Model::SimulatePrincipalPolicyRequest& request, const SimulatePrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SimulatePrincipalPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SimulatePrincipalPolicyAsync(Model::SimulatePrincipalPolicyRequest&& request, const SimulatePrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the status of the specified access key from Active to Inactive, or
          * vice versa. This action can be used to disable a user's key as part of a key
@@ -4396,6 +5503,11 @@ namespace Model
          */
         virtual Model::UpdateAccessKeyOutcomeCallable UpdateAccessKeyCallable(const Model::UpdateAccessKeyRequest& request) const;
 
+        /**
+         * Same as UpdateAccessKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateAccessKeyOutcomeCallable UpdateAccessKeyCallable(Model::UpdateAccessKeyRequest&& request) const;
+
         /**
          * <p>Changes the status of the specified access key from Active to Inactive, or
          * vice versa. This action can be used to disable a user's key as part of a key
@@ -4412,6 +5524,11 @@ namespace Model
          */
         virtual void UpdateAccessKeyAsync(const Model::UpdateAccessKeyRequest& request, const UpdateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAccessKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateAccessKeyAsync(Model::UpdateAccessKeyRequest&& request, const UpdateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the password policy settings for the AWS account.</p> <note> <p>This
          * action does not support partial updates. No parameters are required, but if you
@@ -4436,6 +5553,11 @@ namespace Model
          */
         virtual Model::UpdateAccountPasswordPolicyOutcomeCallable UpdateAccountPasswordPolicyCallable(const Model::UpdateAccountPasswordPolicyRequest& request) const;
 
+        /**
+         * Same as UpdateAccountPasswordPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateAccountPasswordPolicyOutcomeCallable UpdateAccountPasswordPolicyCallable(Model::UpdateAccountPasswordPolicyRequest&& request) const;
+
         /**
          * <p>Updates the password policy settings for the AWS account.</p> <note> <p>This
          * action does not support partial updates. No parameters are required, but if you
@@ -4449,6 +5571,11 @@ namespace Model
          */
         virtual void UpdateAccountPasswordPolicyAsync(const Model::UpdateAccountPasswordPolicyRequest& request, const UpdateAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAccountPasswordPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateAccountPasswordPolicyAsync(Model::UpdateAccountPasswordPolicyRequest&& request, const UpdateAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Updates the policy that grants an entity permission to assume a role. For
          * more information about roles, go to <a
@@ -4467,6 +5594,11 @@ namespace Model
          */
         virtual Model::UpdateAssumeRolePolicyOutcomeCallable UpdateAssumeRolePolicyCallable(const Model::UpdateAssumeRolePolicyRequest& request) const;
 
+        /**
+         * Same as UpdateAssumeRolePolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateAssumeRolePolicyOutcomeCallable UpdateAssumeRolePolicyCallable(Model::UpdateAssumeRolePolicyRequest&& request) const;
+
         /**
          * <p> Updates the policy that grants an entity permission to assume a role. For
          * more information about roles, go to <a
@@ -4477,6 +5609,11 @@ namespace Model
          */
         virtual void UpdateAssumeRolePolicyAsync(const Model::UpdateAssumeRolePolicyRequest& request, const UpdateAssumeRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAssumeRolePolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateAssumeRolePolicyAsync(Model::UpdateAssumeRolePolicyRequest&& request, const UpdateAssumeRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the name and/or the path of the specified group.</p> <important> You
          * should understand the implications of changing a group's path or name. For more
@@ -4509,6 +5646,11 @@ namespace Model
          */
         virtual Model::UpdateGroupOutcomeCallable UpdateGroupCallable(const Model::UpdateGroupRequest& request) const;
 
+        /**
+         * Same as UpdateGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateGroupOutcomeCallable UpdateGroupCallable(Model::UpdateGroupRequest&& request) const;
+
         /**
          * <p>Updates the name and/or the path of the specified group.</p> <important> You
          * should understand the implications of changing a group's path or name. For more
@@ -4526,6 +5668,11 @@ namespace Model
          */
         virtual void UpdateGroupAsync(const Model::UpdateGroupRequest& request, const UpdateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateGroupAsync(Model::UpdateGroupRequest&& request, const UpdateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the password for the specified user.</p> <p>Users can change their
          * own passwords by calling <a>ChangePassword</a>. For more information about
@@ -4546,6 +5693,11 @@ namespace Model
          */
         virtual Model::UpdateLoginProfileOutcomeCallable UpdateLoginProfileCallable(const Model::UpdateLoginProfileRequest& request) const;
 
+        /**
+         * Same as UpdateLoginProfileCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateLoginProfileOutcomeCallable UpdateLoginProfileCallable(Model::UpdateLoginProfileRequest&& request) const;
+
         /**
          * <p>Changes the password for the specified user.</p> <p>Users can change their
          * own passwords by calling <a>ChangePassword</a>. For more information about
@@ -4557,6 +5709,11 @@ namespace Model
          */
         virtual void UpdateLoginProfileAsync(const Model::UpdateLoginProfileRequest& request, const UpdateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateLoginProfileAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateLoginProfileAsync(Model::UpdateLoginProfileRequest&& request, const UpdateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Replaces the existing list of server certificate thumbprints with a new list.
          * </p> <p>The list that you pass with this action completely replaces the existing
@@ -4589,6 +5746,11 @@ namespace Model
          */
         virtual Model::UpdateOpenIDConnectProviderThumbprintOutcomeCallable UpdateOpenIDConnectProviderThumbprintCallable(const Model::UpdateOpenIDConnectProviderThumbprintRequest& request) const;
 
+        /**
+         * Same as UpdateOpenIDConnectProviderThumbprintCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateOpenIDConnectProviderThumbprintOutcomeCallable UpdateOpenIDConnectProviderThumbprintCallable(Model::UpdateOpenIDConnectProviderThumbprintRequest&& request) const;
+
         /**
          * <p>Replaces the existing list of server certificate thumbprints with a new list.
          * </p> <p>The list that you pass with this action completely replaces the existing
@@ -4606,6 +5768,11 @@ namespace Model
          */
         virtual void UpdateOpenIDConnectProviderThumbprintAsync(const Model::UpdateOpenIDConnectProviderThumbprintRequest& request, const UpdateOpenIDConnectProviderThumbprintResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateOpenIDConnectProviderThumbprintAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateOpenIDConnectProviderThumbprintAsync(Model::UpdateOpenIDConnectProviderThumbprintRequest&& request, const UpdateOpenIDConnectProviderThumbprintResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the metadata document for an existing SAML provider.</p> <note>This
          * operation requires <a
@@ -4624,6 +5791,11 @@ namespace Model
          */
         virtual Model::UpdateSAMLProviderOutcomeCallable UpdateSAMLProviderCallable(const Model::UpdateSAMLProviderRequest& request) const;
 
+        /**
+         * Same as UpdateSAMLProviderCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateSAMLProviderOutcomeCallable UpdateSAMLProviderCallable(Model::UpdateSAMLProviderRequest&& request) const;
+
         /**
          * <p>Updates the metadata document for an existing SAML provider.</p> <note>This
          * operation requires <a
@@ -4634,6 +5806,11 @@ namespace Model
          */
         virtual void UpdateSAMLProviderAsync(const Model::UpdateSAMLProviderRequest& request, const UpdateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateSAMLProviderAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateSAMLProviderAsync(Model::UpdateSAMLProviderRequest&& request, const UpdateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the status of the specified SSH public key to active or inactive. SSH
          * public keys that are inactive cannot be used for authentication. This action can
@@ -4664,6 +5841,11 @@ namespace Model
          */
         virtual Model::UpdateSSHPublicKeyOutcomeCallable UpdateSSHPublicKeyCallable(const Model::UpdateSSHPublicKeyRequest& request) const;
 
+        /**
+         * Same as UpdateSSHPublicKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateSSHPublicKeyOutcomeCallable UpdateSSHPublicKeyCallable(Model::UpdateSSHPublicKeyRequest&& request) const;
+
         /**
          * <p>Sets the status of the specified SSH public key to active or inactive. SSH
          * public keys that are inactive cannot be used for authentication. This action can
@@ -4680,6 +5862,11 @@ namespace Model
          */
         virtual void UpdateSSHPublicKeyAsync(const Model::UpdateSSHPublicKeyRequest& request, const UpdateSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateSSHPublicKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateSSHPublicKeyAsync(Model::UpdateSSHPublicKeyRequest&& request, const UpdateSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the name and/or the path of the specified server certificate.</p>
          * <p>For more information about working with server certificates, including a list
@@ -4724,6 +5911,11 @@ namespace Model
          */
         virtual Model::UpdateServerCertificateOutcomeCallable UpdateServerCertificateCallable(const Model::UpdateServerCertificateRequest& request) const;
 
+        /**
+         * Same as UpdateServerCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateServerCertificateOutcomeCallable UpdateServerCertificateCallable(Model::UpdateServerCertificateRequest&& request) const;
+
         /**
          * <p>Updates the name and/or the path of the specified server certificate.</p>
          * <p>For more information about working with server certificates, including a list
@@ -4747,6 +5939,11 @@ namespace Model
          */
         virtual void UpdateServerCertificateAsync(const Model::UpdateServerCertificateRequest& request, const UpdateServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateServerCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateServerCertificateAsync(Model::UpdateServerCertificateRequest&& request, const UpdateServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the status of the specified signing certificate from active to
          * disabled, or vice versa. This action can be used to disable a user's signing
@@ -4771,6 +5968,11 @@ namespace Model
          */
         virtual Model::UpdateSigningCertificateOutcomeCallable UpdateSigningCertificateCallable(const Model::UpdateSigningCertificateRequest& request) const;
 
+        /**
+         * Same as UpdateSigningCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateSigningCertificateOutcomeCallable UpdateSigningCertificateCallable(Model::UpdateSigningCertificateRequest&& request) const;
+
         /**
          * <p>Changes the status of the specified signing certificate from active to
          * disabled, or vice versa. This action can be used to disable a user's signing
@@ -4784,6 +5986,11 @@ namespace Model
          */
         virtual void UpdateSigningCertificateAsync(const Model::UpdateSigningCertificateRequest& request, const UpdateSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateSigningCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateSigningCertificateAsync(Model::UpdateSigningCertificateRequest&& request, const UpdateSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the name and/or the path of the specified user.</p> <important> You
          * should understand the implications of changing a user's path or name. For more
@@ -4820,6 +6027,11 @@ namespace Model
          */
         virtual Model::UpdateUserOutcomeCallable UpdateUserCallable(const Model::UpdateUserRequest& request) const;
 
+        /**
+         * Same as UpdateUserCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateUserOutcomeCallable UpdateUserCallable(Model::UpdateUserRequest&& request) const;
+
         /**
          * <p>Updates the name and/or the path of the specified user.</p> <important> You
          * should understand the implications of changing a user's path or name. For more
@@ -4839,6 +6051,11 @@ namespace Model
          */
         virtual void UpdateUserAsync(const Model::UpdateUserRequest& request, const UpdateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateUserAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateUserAsync(Model::UpdateUserRequest&& request, const UpdateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Uploads an SSH public key and associates it with the specified IAM user.</p>
          * <p>The SSH public key uploaded by this action can be used only for
@@ -4865,6 +6082,11 @@ namespace Model
          */
         virtual Model::UploadSSHPublicKeyOutcomeCallable UploadSSHPublicKeyCallable(const Model::UploadSSHPublicKeyRequest& request) const;
 
+        /**
+         * Same as UploadSSHPublicKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UploadSSHPublicKeyOutcomeCallable UploadSSHPublicKeyCallable(Model::UploadSSHPublicKeyRequest&& request) const;
+
         /**
          * <p>Uploads an SSH public key and associates it with the specified IAM user.</p>
          * <p>The SSH public key uploaded by this action can be used only for
@@ -4879,6 +6101,11 @@ namespace Model
          */
         virtual void UploadSSHPublicKeyAsync(const Model::UploadSSHPublicKeyRequest& request, const UploadSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadSSHPublicKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UploadSSHPublicKeyAsync(Model::UploadSSHPublicKeyRequest&& request, const UploadSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Uploads a server certificate entity for the AWS account. The server
          * certificate entity includes a public key certificate, a private key, and an
@@ -4927,6 +6154,11 @@ namespace Model
          */
         virtual Model::UploadServerCertificateOutcomeCallable UploadServerCertificateCallable(const Model::UploadServerCertificateRequest& request) const;
 
+        /**
+         * Same as UploadServerCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UploadServerCertificateOutcomeCallable UploadServerCertificateCallable(Model::UploadServerCertificateRequest&& request) const;
+
         /**
          * <p>Uploads a server certificate entity for the AWS account. The server
          * certificate entity includes a public key certificate, a private key, and an
@@ -4952,6 +6184,11 @@ namespace Model
          */
         virtual void UploadServerCertificateAsync(const Model::UploadServerCertificateRequest& request, const UploadServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadServerCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UploadServerCertificateAsync(Model::UploadServerCertificateRequest&& request, const UploadServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Uploads an X.509 signing certificate and associates it with the specified
          * user. Some AWS services use X.509 signing certificates to validate requests that
@@ -4994,6 +6231,11 @@ namespace Model
          */
         virtual Model::UploadSigningCertificateOutcomeCallable UploadSigningCertificateCallable(const Model::UploadSigningCertificateRequest& request) const;
 
+        /**
+         * Same as UploadSigningCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UploadSigningCertificateOutcomeCallable UploadSigningCertificateCallable(Model::UploadSigningCertificateRequest&& request) const;
+
         /**
          * <p>Uploads an X.509 signing certificate and associates it with the specified
          * user. Some AWS services use X.509 signing certificates to validate requests that
@@ -5016,6 +6258,244 @@ namespace Model
          */
         virtual void UploadSigningCertificateAsync(const Model::UploadSigningCertificateRequest& request, const UploadSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadSigningCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UploadSigningCertificateAsync(Model::UploadSigningCertificateRequest&& request, const UploadSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AddClientIDToOpenIDConnectProviderOutcome> AddClientIDToOpenIDConnectProviderAwaitable(const Model::AddClientIDToOpenIDConnectProviderRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::AddClientIDToOpenIDConnectProvider, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddClientIDToOpenIDConnectProviderOutcome> AddClientIDToOpenIDConnectProviderAwaitable(Model::AddClientIDToOpenIDConnectProviderRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::AddClientIDToOpenIDConnectProvider, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddRoleToInstanceProfileOutcome> AddRoleToInstanceProfileAwaitable(const Model::AddRoleToInstanceProfileRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::AddRoleToInstanceProfile, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddRoleToInstanceProfileOutcome> AddRoleToInstanceProfileAwaitable(Model::AddRoleToInstanceProfileRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::AddRoleToInstanceProfile, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddUserToGroupOutcome> AddUserToGroupAwaitable(const Model::AddUserToGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::AddUserToGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddUserToGroupOutcome> AddUserToGroupAwaitable(Model::AddUserToGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::AddUserToGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachGroupPolicyOutcome> AttachGroupPolicyAwaitable(const Model::AttachGroupPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::AttachGroupPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachGroupPolicyOutcome> AttachGroupPolicyAwaitable(Model::AttachGroupPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::AttachGroupPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachRolePolicyOutcome> AttachRolePolicyAwaitable(const Model::AttachRolePolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::AttachRolePolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachRolePolicyOutcome> AttachRolePolicyAwaitable(Model::AttachRolePolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::AttachRolePolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachUserPolicyOutcome> AttachUserPolicyAwaitable(const Model::AttachUserPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::AttachUserPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachUserPolicyOutcome> AttachUserPolicyAwaitable(Model::AttachUserPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::AttachUserPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ChangePasswordOutcome> ChangePasswordAwaitable(const Model::ChangePasswordRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ChangePassword, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ChangePasswordOutcome> ChangePasswordAwaitable(Model::ChangePasswordRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ChangePassword, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAccessKeyOutcome> CreateAccessKeyAwaitable(const Model::CreateAccessKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateAccessKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAccessKeyOutcome> CreateAccessKeyAwaitable(Model::CreateAccessKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateAccessKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAccountAliasOutcome> CreateAccountAliasAwaitable(const Model::CreateAccountAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateAccountAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAccountAliasOutcome> CreateAccountAliasAwaitable(Model::CreateAccountAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateAccountAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateGroupOutcome> CreateGroupAwaitable(const Model::CreateGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateGroupOutcome> CreateGroupAwaitable(Model::CreateGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateInstanceProfileOutcome> CreateInstanceProfileAwaitable(const Model::CreateInstanceProfileRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateInstanceProfile, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateInstanceProfileOutcome> CreateInstanceProfileAwaitable(Model::CreateInstanceProfileRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateInstanceProfile, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLoginProfileOutcome> CreateLoginProfileAwaitable(const Model::CreateLoginProfileRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateLoginProfile, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLoginProfileOutcome> CreateLoginProfileAwaitable(Model::CreateLoginProfileRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateLoginProfile, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateOpenIDConnectProviderOutcome> CreateOpenIDConnectProviderAwaitable(const Model::CreateOpenIDConnectProviderRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateOpenIDConnectProvider, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateOpenIDConnectProviderOutcome> CreateOpenIDConnectProviderAwaitable(Model::CreateOpenIDConnectProviderRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateOpenIDConnectProvider, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePolicyOutcome> CreatePolicyAwaitable(const Model::CreatePolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreatePolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePolicyOutcome> CreatePolicyAwaitable(Model::CreatePolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreatePolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePolicyVersionOutcome> CreatePolicyVersionAwaitable(const Model::CreatePolicyVersionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreatePolicyVersion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePolicyVersionOutcome> CreatePolicyVersionAwaitable(Model::CreatePolicyVersionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreatePolicyVersion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRoleOutcome> CreateRoleAwaitable(const Model::CreateRoleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateRole, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRoleOutcome> CreateRoleAwaitable(Model::CreateRoleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateRole, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSAMLProviderOutcome> CreateSAMLProviderAwaitable(const Model::CreateSAMLProviderRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateSAMLProvider, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSAMLProviderOutcome> CreateSAMLProviderAwaitable(Model::CreateSAMLProviderRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateSAMLProvider, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateUserOutcome> CreateUserAwaitable(const Model::CreateUserRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateUser, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateUserOutcome> CreateUserAwaitable(Model::CreateUserRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateUser, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVirtualMFADeviceOutcome> CreateVirtualMFADeviceAwaitable(const Model::CreateVirtualMFADeviceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateVirtualMFADevice, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateVirtualMFADeviceOutcome> CreateVirtualMFADeviceAwaitable(Model::CreateVirtualMFADeviceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::CreateVirtualMFADevice, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeactivateMFADeviceOutcome> DeactivateMFADeviceAwaitable(const Model::DeactivateMFADeviceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeactivateMFADevice, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeactivateMFADeviceOutcome> DeactivateMFADeviceAwaitable(Model::DeactivateMFADeviceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeactivateMFADevice, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAccessKeyOutcome> DeleteAccessKeyAwaitable(const Model::DeleteAccessKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteAccessKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAccessKeyOutcome> DeleteAccessKeyAwaitable(Model::DeleteAccessKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteAccessKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAccountAliasOutcome> DeleteAccountAliasAwaitable(const Model::DeleteAccountAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteAccountAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAccountAliasOutcome> DeleteAccountAliasAwaitable(Model::DeleteAccountAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteAccountAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAccountPasswordPolicyOutcome> DeleteAccountPasswordPolicyAwaitable(const Model::DeleteAccountPasswordPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteAccountPasswordPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAccountPasswordPolicyOutcome> DeleteAccountPasswordPolicyAwaitable(Model::DeleteAccountPasswordPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteAccountPasswordPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteGroupOutcome> DeleteGroupAwaitable(const Model::DeleteGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteGroupOutcome> DeleteGroupAwaitable(Model::DeleteGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteGroupPolicyOutcome> DeleteGroupPolicyAwaitable(const Model::DeleteGroupPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteGroupPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteGroupPolicyOutcome> DeleteGroupPolicyAwaitable(Model::DeleteGroupPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteGroupPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteInstanceProfileOutcome> DeleteInstanceProfileAwaitable(const Model::DeleteInstanceProfileRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteInstanceProfile, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteInstanceProfileOutcome> DeleteInstanceProfileAwaitable(Model::DeleteInstanceProfileRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteInstanceProfile, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLoginProfileOutcome> DeleteLoginProfileAwaitable(const Model::DeleteLoginProfileRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteLoginProfile, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLoginProfileOutcome> DeleteLoginProfileAwaitable(Model::DeleteLoginProfileRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteLoginProfile, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteOpenIDConnectProviderOutcome> DeleteOpenIDConnectProviderAwaitable(const Model::DeleteOpenIDConnectProviderRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteOpenIDConnectProvider, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteOpenIDConnectProviderOutcome> DeleteOpenIDConnectProviderAwaitable(Model::DeleteOpenIDConnectProviderRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteOpenIDConnectProvider, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePolicyOutcome> DeletePolicyAwaitable(const Model::DeletePolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeletePolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePolicyOutcome> DeletePolicyAwaitable(Model::DeletePolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeletePolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePolicyVersionOutcome> DeletePolicyVersionAwaitable(const Model::DeletePolicyVersionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeletePolicyVersion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePolicyVersionOutcome> DeletePolicyVersionAwaitable(Model::DeletePolicyVersionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeletePolicyVersion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRoleOutcome> DeleteRoleAwaitable(const Model::DeleteRoleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteRole, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRoleOutcome> DeleteRoleAwaitable(Model::DeleteRoleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteRole, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRolePolicyOutcome> DeleteRolePolicyAwaitable(const Model::DeleteRolePolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteRolePolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRolePolicyOutcome> DeleteRolePolicyAwaitable(Model::DeleteRolePolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteRolePolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSAMLProviderOutcome> DeleteSAMLProviderAwaitable(const Model::DeleteSAMLProviderRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteSAMLProvider, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSAMLProviderOutcome> DeleteSAMLProviderAwaitable(Model::DeleteSAMLProviderRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteSAMLProvider, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSSHPublicKeyOutcome> DeleteSSHPublicKeyAwaitable(const Model::DeleteSSHPublicKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteSSHPublicKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSSHPublicKeyOutcome> DeleteSSHPublicKeyAwaitable(Model::DeleteSSHPublicKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteSSHPublicKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteServerCertificateOutcome> DeleteServerCertificateAwaitable(const Model::DeleteServerCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteServerCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteServerCertificateOutcome> DeleteServerCertificateAwaitable(Model::DeleteServerCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteServerCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSigningCertificateOutcome> DeleteSigningCertificateAwaitable(const Model::DeleteSigningCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteSigningCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSigningCertificateOutcome> DeleteSigningCertificateAwaitable(Model::DeleteSigningCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteSigningCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteUserOutcome> DeleteUserAwaitable(const Model::DeleteUserRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteUser, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteUserOutcome> DeleteUserAwaitable(Model::DeleteUserRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteUser, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteUserPolicyOutcome> DeleteUserPolicyAwaitable(const Model::DeleteUserPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteUserPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteUserPolicyOutcome> DeleteUserPolicyAwaitable(Model::DeleteUserPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteUserPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVirtualMFADeviceOutcome> DeleteVirtualMFADeviceAwaitable(const Model::DeleteVirtualMFADeviceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteVirtualMFADevice, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVirtualMFADeviceOutcome> DeleteVirtualMFADeviceAwaitable(Model::DeleteVirtualMFADeviceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DeleteVirtualMFADevice, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachGroupPolicyOutcome> DetachGroupPolicyAwaitable(const Model::DetachGroupPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DetachGroupPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachGroupPolicyOutcome> DetachGroupPolicyAwaitable(Model::DetachGroupPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DetachGroupPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachRolePolicyOutcome> DetachRolePolicyAwaitable(const Model::DetachRolePolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DetachRolePolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachRolePolicyOutcome> DetachRolePolicyAwaitable(Model::DetachRolePolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DetachRolePolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachUserPolicyOutcome> DetachUserPolicyAwaitable(const Model::DetachUserPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DetachUserPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachUserPolicyOutcome> DetachUserPolicyAwaitable(Model::DetachUserPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::DetachUserPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableMFADeviceOutcome> EnableMFADeviceAwaitable(const Model::EnableMFADeviceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::EnableMFADevice, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableMFADeviceOutcome> EnableMFADeviceAwaitable(Model::EnableMFADeviceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::EnableMFADevice, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GenerateCredentialReportOutcome> GenerateCredentialReportAwaitable(const Model::GenerateCredentialReportRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GenerateCredentialReport, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GenerateCredentialReportOutcome> GenerateCredentialReportAwaitable(Model::GenerateCredentialReportRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GenerateCredentialReport, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAccessKeyLastUsedOutcome> GetAccessKeyLastUsedAwaitable(const Model::GetAccessKeyLastUsedRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetAccessKeyLastUsed, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAccessKeyLastUsedOutcome> GetAccessKeyLastUsedAwaitable(Model::GetAccessKeyLastUsedRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetAccessKeyLastUsed, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAccountAuthorizationDetailsOutcome> GetAccountAuthorizationDetailsAwaitable(const Model::GetAccountAuthorizationDetailsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetAccountAuthorizationDetails, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAccountAuthorizationDetailsOutcome> GetAccountAuthorizationDetailsAwaitable(Model::GetAccountAuthorizationDetailsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetAccountAuthorizationDetails, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAccountPasswordPolicyOutcome> GetAccountPasswordPolicyAwaitable(const Model::GetAccountPasswordPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetAccountPasswordPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAccountPasswordPolicyOutcome> GetAccountPasswordPolicyAwaitable(Model::GetAccountPasswordPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetAccountPasswordPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAccountSummaryOutcome> GetAccountSummaryAwaitable(const Model::GetAccountSummaryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetAccountSummary, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAccountSummaryOutcome> GetAccountSummaryAwaitable(Model::GetAccountSummaryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetAccountSummary, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetContextKeysForCustomPolicyOutcome> GetContextKeysForCustomPolicyAwaitable(const Model::GetContextKeysForCustomPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetContextKeysForCustomPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetContextKeysForCustomPolicyOutcome> GetContextKeysForCustomPolicyAwaitable(Model::GetContextKeysForCustomPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetContextKeysForCustomPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetContextKeysForPrincipalPolicyOutcome> GetContextKeysForPrincipalPolicyAwaitable(const Model::GetContextKeysForPrincipalPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetContextKeysForPrincipalPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetContextKeysForPrincipalPolicyOutcome> GetContextKeysForPrincipalPolicyAwaitable(Model::GetContextKeysForPrincipalPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetContextKeysForPrincipalPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCredentialReportOutcome> GetCredentialReportAwaitable(const Model::GetCredentialReportRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetCredentialReport, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCredentialReportOutcome> GetCredentialReportAwaitable(Model::GetCredentialReportRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetCredentialReport, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetGroupOutcome> GetGroupAwaitable(const Model::GetGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetGroupOutcome> GetGroupAwaitable(Model::GetGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetGroupPolicyOutcome> GetGroupPolicyAwaitable(const Model::GetGroupPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetGroupPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetGroupPolicyOutcome> GetGroupPolicyAwaitable(Model::GetGroupPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetGroupPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetInstanceProfileOutcome> GetInstanceProfileAwaitable(const Model::GetInstanceProfileRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetInstanceProfile, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetInstanceProfileOutcome> GetInstanceProfileAwaitable(Model::GetInstanceProfileRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetInstanceProfile, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetLoginProfileOutcome> GetLoginProfileAwaitable(const Model::GetLoginProfileRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetLoginProfile, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetLoginProfileOutcome> GetLoginProfileAwaitable(Model::GetLoginProfileRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetLoginProfile, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetOpenIDConnectProviderOutcome> GetOpenIDConnectProviderAwaitable(const Model::GetOpenIDConnectProviderRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetOpenIDConnectProvider, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetOpenIDConnectProviderOutcome> GetOpenIDConnectProviderAwaitable(Model::GetOpenIDConnectProviderRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetOpenIDConnectProvider, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPolicyOutcome> GetPolicyAwaitable(const Model::GetPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPolicyOutcome> GetPolicyAwaitable(Model::GetPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPolicyVersionOutcome> GetPolicyVersionAwaitable(const Model::GetPolicyVersionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetPolicyVersion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPolicyVersionOutcome> GetPolicyVersionAwaitable(Model::GetPolicyVersionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetPolicyVersion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRoleOutcome> GetRoleAwaitable(const Model::GetRoleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetRole, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRoleOutcome> GetRoleAwaitable(Model::GetRoleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetRole, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRolePolicyOutcome> GetRolePolicyAwaitable(const Model::GetRolePolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetRolePolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRolePolicyOutcome> GetRolePolicyAwaitable(Model::GetRolePolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetRolePolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSAMLProviderOutcome> GetSAMLProviderAwaitable(const Model::GetSAMLProviderRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetSAMLProvider, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSAMLProviderOutcome> GetSAMLProviderAwaitable(Model::GetSAMLProviderRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetSAMLProvider, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSSHPublicKeyOutcome> GetSSHPublicKeyAwaitable(const Model::GetSSHPublicKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetSSHPublicKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSSHPublicKeyOutcome> GetSSHPublicKeyAwaitable(Model::GetSSHPublicKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetSSHPublicKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetServerCertificateOutcome> GetServerCertificateAwaitable(const Model::GetServerCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetServerCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetServerCertificateOutcome> GetServerCertificateAwaitable(Model::GetServerCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetServerCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetUserOutcome> GetUserAwaitable(const Model::GetUserRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetUser, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetUserOutcome> GetUserAwaitable(Model::GetUserRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetUser, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetUserPolicyOutcome> GetUserPolicyAwaitable(const Model::GetUserPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetUserPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetUserPolicyOutcome> GetUserPolicyAwaitable(Model::GetUserPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::GetUserPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAccessKeysOutcome> ListAccessKeysAwaitable(const Model::ListAccessKeysRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListAccessKeys, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAccessKeysOutcome> ListAccessKeysAwaitable(Model::ListAccessKeysRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListAccessKeys, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAccountAliasesOutcome> ListAccountAliasesAwaitable(const Model::ListAccountAliasesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListAccountAliases, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAccountAliasesOutcome> ListAccountAliasesAwaitable(Model::ListAccountAliasesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListAccountAliases, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAttachedGroupPoliciesOutcome> ListAttachedGroupPoliciesAwaitable(const Model::ListAttachedGroupPoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListAttachedGroupPolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAttachedGroupPoliciesOutcome> ListAttachedGroupPoliciesAwaitable(Model::ListAttachedGroupPoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListAttachedGroupPolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAttachedRolePoliciesOutcome> ListAttachedRolePoliciesAwaitable(const Model::ListAttachedRolePoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListAttachedRolePolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAttachedRolePoliciesOutcome> ListAttachedRolePoliciesAwaitable(Model::ListAttachedRolePoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListAttachedRolePolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAttachedUserPoliciesOutcome> ListAttachedUserPoliciesAwaitable(const Model::ListAttachedUserPoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListAttachedUserPolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAttachedUserPoliciesOutcome> ListAttachedUserPoliciesAwaitable(Model::ListAttachedUserPoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListAttachedUserPolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListEntitiesForPolicyOutcome> ListEntitiesForPolicyAwaitable(const Model::ListEntitiesForPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListEntitiesForPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListEntitiesForPolicyOutcome> ListEntitiesForPolicyAwaitable(Model::ListEntitiesForPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListEntitiesForPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListGroupPoliciesOutcome> ListGroupPoliciesAwaitable(const Model::ListGroupPoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListGroupPolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListGroupPoliciesOutcome> ListGroupPoliciesAwaitable(Model::ListGroupPoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListGroupPolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListGroupsOutcome> ListGroupsAwaitable(const Model::ListGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListGroupsOutcome> ListGroupsAwaitable(Model::ListGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListGroupsForUserOutcome> ListGroupsForUserAwaitable(const Model::ListGroupsForUserRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListGroupsForUser, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListGroupsForUserOutcome> ListGroupsForUserAwaitable(Model::ListGroupsForUserRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListGroupsForUser, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListInstanceProfilesOutcome> ListInstanceProfilesAwaitable(const Model::ListInstanceProfilesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListInstanceProfiles, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListInstanceProfilesOutcome> ListInstanceProfilesAwaitable(Model::ListInstanceProfilesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListInstanceProfiles, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListInstanceProfilesForRoleOutcome> ListInstanceProfilesForRoleAwaitable(const Model::ListInstanceProfilesForRoleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListInstanceProfilesForRole, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListInstanceProfilesForRoleOutcome> ListInstanceProfilesForRoleAwaitable(Model::ListInstanceProfilesForRoleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListInstanceProfilesForRole, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListMFADevicesOutcome> ListMFADevicesAwaitable(const Model::ListMFADevicesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListMFADevices, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListMFADevicesOutcome> ListMFADevicesAwaitable(Model::ListMFADevicesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListMFADevices, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListOpenIDConnectProvidersOutcome> ListOpenIDConnectProvidersAwaitable(const Model::ListOpenIDConnectProvidersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListOpenIDConnectProviders, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListOpenIDConnectProvidersOutcome> ListOpenIDConnectProvidersAwaitable(Model::ListOpenIDConnectProvidersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListOpenIDConnectProviders, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPoliciesOutcome> ListPoliciesAwaitable(const Model::ListPoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListPolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPoliciesOutcome> ListPoliciesAwaitable(Model::ListPoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListPolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPolicyVersionsOutcome> ListPolicyVersionsAwaitable(const Model::ListPolicyVersionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListPolicyVersions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPolicyVersionsOutcome> ListPolicyVersionsAwaitable(Model::ListPolicyVersionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListPolicyVersions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRolePoliciesOutcome> ListRolePoliciesAwaitable(const Model::ListRolePoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListRolePolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRolePoliciesOutcome> ListRolePoliciesAwaitable(Model::ListRolePoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListRolePolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRolesOutcome> ListRolesAwaitable(const Model::ListRolesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListRoles, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRolesOutcome> ListRolesAwaitable(Model::ListRolesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListRoles, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSAMLProvidersOutcome> ListSAMLProvidersAwaitable(const Model::ListSAMLProvidersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListSAMLProviders, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSAMLProvidersOutcome> ListSAMLProvidersAwaitable(Model::ListSAMLProvidersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListSAMLProviders, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSSHPublicKeysOutcome> ListSSHPublicKeysAwaitable(const Model::ListSSHPublicKeysRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListSSHPublicKeys, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSSHPublicKeysOutcome> ListSSHPublicKeysAwaitable(Model::ListSSHPublicKeysRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListSSHPublicKeys, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListServerCertificatesOutcome> ListServerCertificatesAwaitable(const Model::ListServerCertificatesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListServerCertificates, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListServerCertificatesOutcome> ListServerCertificatesAwaitable(Model::ListServerCertificatesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListServerCertificates, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSigningCertificatesOutcome> ListSigningCertificatesAwaitable(const Model::ListSigningCertificatesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListSigningCertificates, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSigningCertificatesOutcome> ListSigningCertificatesAwaitable(Model::ListSigningCertificatesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListSigningCertificates, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListUserPoliciesOutcome> ListUserPoliciesAwaitable(const Model::ListUserPoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListUserPolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListUserPoliciesOutcome> ListUserPoliciesAwaitable(Model::ListUserPoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListUserPolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListUsersOutcome> ListUsersAwaitable(const Model::ListUsersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListUsers, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListUsersOutcome> ListUsersAwaitable(Model::ListUsersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListUsers, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListVirtualMFADevicesOutcome> ListVirtualMFADevicesAwaitable(const Model::ListVirtualMFADevicesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListVirtualMFADevices, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListVirtualMFADevicesOutcome> ListVirtualMFADevicesAwaitable(Model::ListVirtualMFADevicesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ListVirtualMFADevices, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutGroupPolicyOutcome> PutGroupPolicyAwaitable(const Model::PutGroupPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::PutGroupPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutGroupPolicyOutcome> PutGroupPolicyAwaitable(Model::PutGroupPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::PutGroupPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRolePolicyOutcome> PutRolePolicyAwaitable(const Model::PutRolePolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::PutRolePolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRolePolicyOutcome> PutRolePolicyAwaitable(Model::PutRolePolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::PutRolePolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutUserPolicyOutcome> PutUserPolicyAwaitable(const Model::PutUserPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::PutUserPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutUserPolicyOutcome> PutUserPolicyAwaitable(Model::PutUserPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::PutUserPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveClientIDFromOpenIDConnectProviderOutcome> RemoveClientIDFromOpenIDConnectProviderAwaitable(const Model::RemoveClientIDFromOpenIDConnectProviderRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::RemoveClientIDFromOpenIDConnectProvider, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveClientIDFromOpenIDConnectProviderOutcome> RemoveClientIDFromOpenIDConnectProviderAwaitable(Model::RemoveClientIDFromOpenIDConnectProviderRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::RemoveClientIDFromOpenIDConnectProvider, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveRoleFromInstanceProfileOutcome> RemoveRoleFromInstanceProfileAwaitable(const Model::RemoveRoleFromInstanceProfileRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::RemoveRoleFromInstanceProfile, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveRoleFromInstanceProfileOutcome> RemoveRoleFromInstanceProfileAwaitable(Model::RemoveRoleFromInstanceProfileRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::RemoveRoleFromInstanceProfile, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveUserFromGroupOutcome> RemoveUserFromGroupAwaitable(const Model::RemoveUserFromGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::RemoveUserFromGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveUserFromGroupOutcome> RemoveUserFromGroupAwaitable(Model::RemoveUserFromGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::RemoveUserFromGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResyncMFADeviceOutcome> ResyncMFADeviceAwaitable(const Model::ResyncMFADeviceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ResyncMFADevice, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResyncMFADeviceOutcome> ResyncMFADeviceAwaitable(Model::ResyncMFADeviceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::ResyncMFADevice, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetDefaultPolicyVersionOutcome> SetDefaultPolicyVersionAwaitable(const Model::SetDefaultPolicyVersionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::SetDefaultPolicyVersion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetDefaultPolicyVersionOutcome> SetDefaultPolicyVersionAwaitable(Model::SetDefaultPolicyVersionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::SetDefaultPolicyVersion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SimulateCustomPolicyOutcome> SimulateCustomPolicyAwaitable(const Model::SimulateCustomPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::SimulateCustomPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SimulateCustomPolicyOutcome> SimulateCustomPolicyAwaitable(Model::SimulateCustomPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::SimulateCustomPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SimulatePrincipalPolicyOutcome> SimulatePrincipalPolicyAwaitable(const Model::SimulatePrincipalPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::SimulatePrincipalPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SimulatePrincipalPolicyOutcome> SimulatePrincipalPolicyAwaitable(Model::SimulatePrincipalPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::SimulatePrincipalPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAccessKeyOutcome> UpdateAccessKeyAwaitable(const Model::UpdateAccessKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateAccessKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAccessKeyOutcome> UpdateAccessKeyAwaitable(Model::UpdateAccessKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateAccessKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAccountPasswordPolicyOutcome> UpdateAccountPasswordPolicyAwaitable(const Model::UpdateAccountPasswordPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateAccountPasswordPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAccountPasswordPolicyOutcome> UpdateAccountPasswordPolicyAwaitable(Model::UpdateAccountPasswordPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateAccountPasswordPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAssumeRolePolicyOutcome> UpdateAssumeRolePolicyAwaitable(const Model::UpdateAssumeRolePolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateAssumeRolePolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAssumeRolePolicyOutcome> UpdateAssumeRolePolicyAwaitable(Model::UpdateAssumeRolePolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateAssumeRolePolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateGroupOutcome> UpdateGroupAwaitable(const Model::UpdateGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateGroupOutcome> UpdateGroupAwaitable(Model::UpdateGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateLoginProfileOutcome> UpdateLoginProfileAwaitable(const Model::UpdateLoginProfileRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateLoginProfile, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateLoginProfileOutcome> UpdateLoginProfileAwaitable(Model::UpdateLoginProfileRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateLoginProfile, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateOpenIDConnectProviderThumbprintOutcome> UpdateOpenIDConnectProviderThumbprintAwaitable(const Model::UpdateOpenIDConnectProviderThumbprintRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateOpenIDConnectProviderThumbprint, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateOpenIDConnectProviderThumbprintOutcome> UpdateOpenIDConnectProviderThumbprintAwaitable(Model::UpdateOpenIDConnectProviderThumbprintRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateOpenIDConnectProviderThumbprint, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateSAMLProviderOutcome> UpdateSAMLProviderAwaitable(const Model::UpdateSAMLProviderRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateSAMLProvider, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateSAMLProviderOutcome> UpdateSAMLProviderAwaitable(Model::UpdateSAMLProviderRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateSAMLProvider, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateSSHPublicKeyOutcome> UpdateSSHPublicKeyAwaitable(const Model::UpdateSSHPublicKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateSSHPublicKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateSSHPublicKeyOutcome> UpdateSSHPublicKeyAwaitable(Model::UpdateSSHPublicKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateSSHPublicKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateServerCertificateOutcome> UpdateServerCertificateAwaitable(const Model::UpdateServerCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateServerCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateServerCertificateOutcome> UpdateServerCertificateAwaitable(Model::UpdateServerCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateServerCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateSigningCertificateOutcome> UpdateSigningCertificateAwaitable(const Model::UpdateSigningCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateSigningCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateSigningCertificateOutcome> UpdateSigningCertificateAwaitable(Model::UpdateSigningCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateSigningCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateUserOutcome> UpdateUserAwaitable(const Model::UpdateUserRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateUser, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateUserOutcome> UpdateUserAwaitable(Model::UpdateUserRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UpdateUser, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadSSHPublicKeyOutcome> UploadSSHPublicKeyAwaitable(const Model::UploadSSHPublicKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UploadSSHPublicKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadSSHPublicKeyOutcome> UploadSSHPublicKeyAwaitable(Model::UploadSSHPublicKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UploadSSHPublicKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadServerCertificateOutcome> UploadServerCertificateAwaitable(const Model::UploadServerCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UploadServerCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadServerCertificateOutcome> UploadServerCertificateAwaitable(Model::UploadServerCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UploadServerCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadSigningCertificateOutcome> UploadSigningCertificateAwaitable(const Model::UploadSigningCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UploadSigningCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadSigningCertificateOutcome> UploadSigningCertificateAwaitable(Model::UploadSigningCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IAMClient::UploadSigningCertificate, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
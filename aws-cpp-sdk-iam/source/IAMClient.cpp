@@ -220,12 +220,22 @@ AddClientIDToOpenIDConnectProviderOutcome IAMClient::AddClientIDToOpenIDConnectP
 
 AddClientIDToOpenIDConnectProviderOutcomeCallable IAMClient::AddClientIDToOpenIDConnectProviderCallable(const AddClientIDToOpenIDConnectProviderRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::AddClientIDToOpenIDConnectProvider, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::AddClientIDToOpenIDConnectProvider, Aws::Client::RejectedCallOutcome<AddClientIDToOpenIDConnectProviderOutcome>(), this, request);
+}
+
+AddClientIDToOpenIDConnectProviderOutcomeCallable IAMClient::AddClientIDToOpenIDConnectProviderCallable(AddClientIDToOpenIDConnectProviderRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::AddClientIDToOpenIDConnectProvider, Aws::Client::RejectedCallOutcome<AddClientIDToOpenIDConnectProviderOutcome>(), this, std::move(request));
 }
 
 void IAMClient::AddClientIDToOpenIDConnectProviderAsync(const AddClientIDToOpenIDConnectProviderRequest& request, const AddClientIDToOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::AddClientIDToOpenIDConnectProviderAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::AddClientIDToOpenIDConnectProviderAsyncHelper, Aws::Client::RejectedAsyncCall<AddClientIDToOpenIDConnectProviderOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::AddClientIDToOpenIDConnectProviderAsync(AddClientIDToOpenIDConnectProviderRequest&& request, const AddClientIDToOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::AddClientIDToOpenIDConnectProviderAsyncHelper, Aws::Client::RejectedAsyncCall<AddClientIDToOpenIDConnectProviderOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::AddClientIDToOpenIDConnectProviderAsyncHelper(const AddClientIDToOpenIDConnectProviderRequest& request, const AddClientIDToOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -250,12 +260,22 @@ AddRoleToInstanceProfileOutcome IAMClient::AddRoleToInstanceProfile(const AddRol
 
 AddRoleToInstanceProfileOutcomeCallable IAMClient::AddRoleToInstanceProfileCallable(const AddRoleToInstanceProfileRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::AddRoleToInstanceProfile, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::AddRoleToInstanceProfile, Aws::Client::RejectedCallOutcome<AddRoleToInstanceProfileOutcome>(), this, request);
+}
+
+AddRoleToInstanceProfileOutcomeCallable IAMClient::AddRoleToInstanceProfileCallable(AddRoleToInstanceProfileRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::AddRoleToInstanceProfile, Aws::Client::RejectedCallOutcome<AddRoleToInstanceProfileOutcome>(), this, std::move(request));
 }
 
 void IAMClient::AddRoleToInstanceProfileAsync(const AddRoleToInstanceProfileRequest& request, const AddRoleToInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::AddRoleToInstanceProfileAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::AddRoleToInstanceProfileAsyncHelper, Aws::Client::RejectedAsyncCall<AddRoleToInstanceProfileOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::AddRoleToInstanceProfileAsync(AddRoleToInstanceProfileRequest&& request, const AddRoleToInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::AddRoleToInstanceProfileAsyncHelper, Aws::Client::RejectedAsyncCall<AddRoleToInstanceProfileOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::AddRoleToInstanceProfileAsyncHelper(const AddRoleToInstanceProfileRequest& request, const AddRoleToInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -280,12 +300,22 @@ AddUserToGroupOutcome IAMClient::AddUserToGroup(const AddUserToGroupRequest& req
 
 AddUserToGroupOutcomeCallable IAMClient::AddUserToGroupCallable(const AddUserToGroupRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::AddUserToGroup, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::AddUserToGroup, Aws::Client::RejectedCallOutcome<AddUserToGroupOutcome>(), this, request);
+}
+
+AddUserToGroupOutcomeCallable IAMClient::AddUserToGroupCallable(AddUserToGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::AddUserToGroup, Aws::Client::RejectedCallOutcome<AddUserToGroupOutcome>(), this, std::move(request));
 }
 
 void IAMClient::AddUserToGroupAsync(const AddUserToGroupRequest& request, const AddUserToGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::AddUserToGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::AddUserToGroupAsyncHelper, Aws::Client::RejectedAsyncCall<AddUserToGroupOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::AddUserToGroupAsync(AddUserToGroupRequest&& request, const AddUserToGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::AddUserToGroupAsyncHelper, Aws::Client::RejectedAsyncCall<AddUserToGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::AddUserToGroupAsyncHelper(const AddUserToGroupRequest& request, const AddUserToGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -310,12 +340,22 @@ AttachGroupPolicyOutcome IAMClient::AttachGroupPolicy(const AttachGroupPolicyReq
 
 AttachGroupPolicyOutcomeCallable IAMClient::AttachGroupPolicyCallable(const AttachGroupPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::AttachGroupPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::AttachGroupPolicy, Aws::Client::RejectedCallOutcome<AttachGroupPolicyOutcome>(), this, request);
+}
+
+AttachGroupPolicyOutcomeCallable IAMClient::AttachGroupPolicyCallable(AttachGroupPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::AttachGroupPolicy, Aws::Client::RejectedCallOutcome<AttachGroupPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::AttachGroupPolicyAsync(const AttachGroupPolicyRequest& request, const AttachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::AttachGroupPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::AttachGroupPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<AttachGroupPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::AttachGroupPolicyAsync(AttachGroupPolicyRequest&& request, const AttachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::AttachGroupPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<AttachGroupPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::AttachGroupPolicyAsyncHelper(const AttachGroupPolicyRequest& request, const AttachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -340,12 +380,22 @@ AttachRolePolicyOutcome IAMClient::AttachRolePolicy(const AttachRolePolicyReques
 
 AttachRolePolicyOutcomeCallable IAMClient::AttachRolePolicyCallable(const AttachRolePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::AttachRolePolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::AttachRolePolicy, Aws::Client::RejectedCallOutcome<AttachRolePolicyOutcome>(), this, request);
+}
+
+AttachRolePolicyOutcomeCallable IAMClient::AttachRolePolicyCallable(AttachRolePolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::AttachRolePolicy, Aws::Client::RejectedCallOutcome<AttachRolePolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::AttachRolePolicyAsync(const AttachRolePolicyRequest& request, const AttachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::AttachRolePolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::AttachRolePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<AttachRolePolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::AttachRolePolicyAsync(AttachRolePolicyRequest&& request, const AttachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::AttachRolePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<AttachRolePolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::AttachRolePolicyAsyncHelper(const AttachRolePolicyRequest& request, const AttachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -370,12 +420,22 @@ AttachUserPolicyOutcome IAMClient::AttachUserPolicy(const AttachUserPolicyReques
 
 AttachUserPolicyOutcomeCallable IAMClient::AttachUserPolicyCallable(const AttachUserPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::AttachUserPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::AttachUserPolicy, Aws::Client::RejectedCallOutcome<AttachUserPolicyOutcome>(), this, request);
+}
+
+AttachUserPolicyOutcomeCallable IAMClient::AttachUserPolicyCallable(AttachUserPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::AttachUserPolicy, Aws::Client::RejectedCallOutcome<AttachUserPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::AttachUserPolicyAsync(const AttachUserPolicyRequest& request, const AttachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::AttachUserPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::AttachUserPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<AttachUserPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::AttachUserPolicyAsync(AttachUserPolicyRequest&& request, const AttachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::AttachUserPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<AttachUserPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::AttachUserPolicyAsyncHelper(const AttachUserPolicyRequest& request, const AttachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -400,12 +460,22 @@ ChangePasswordOutcome IAMClient::ChangePassword(const ChangePasswordRequest& req
 
 ChangePasswordOutcomeCallable IAMClient::ChangePasswordCallable(const ChangePasswordRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ChangePassword, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ChangePassword, Aws::Client::RejectedCallOutcome<ChangePasswordOutcome>(), this, request);
+}
+
+ChangePasswordOutcomeCallable IAMClient::ChangePasswordCallable(ChangePasswordRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ChangePassword, Aws::Client::RejectedCallOutcome<ChangePasswordOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ChangePasswordAsync(const ChangePasswordRequest& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ChangePasswordAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ChangePasswordAsyncHelper, Aws::Client::RejectedAsyncCall<ChangePasswordOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ChangePasswordAsync(ChangePasswordRequest&& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ChangePasswordAsyncHelper, Aws::Client::RejectedAsyncCall<ChangePasswordOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ChangePasswordAsyncHelper(const ChangePasswordRequest& request, const ChangePasswordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -430,12 +500,22 @@ CreateAccessKeyOutcome IAMClient::CreateAccessKey(const CreateAccessKeyRequest&
 
 CreateAccessKeyOutcomeCallable IAMClient::CreateAccessKeyCallable(const CreateAccessKeyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::CreateAccessKey, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::CreateAccessKey, Aws::Client::RejectedCallOutcome<CreateAccessKeyOutcome>(), this, request);
+}
+
+CreateAccessKeyOutcomeCallable IAMClient::CreateAccessKeyCallable(CreateAccessKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::CreateAccessKey, Aws::Client::RejectedCallOutcome<CreateAccessKeyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::CreateAccessKeyAsync(const CreateAccessKeyRequest& request, const CreateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::CreateAccessKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::CreateAccessKeyAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAccessKeyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::CreateAccessKeyAsync(CreateAccessKeyRequest&& request, const CreateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::CreateAccessKeyAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAccessKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::CreateAccessKeyAsyncHelper(const CreateAccessKeyRequest& request, const CreateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -460,12 +540,22 @@ CreateAccountAliasOutcome IAMClient::CreateAccountAlias(const CreateAccountAlias
 
 CreateAccountAliasOutcomeCallable IAMClient::CreateAccountAliasCallable(const CreateAccountAliasRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::CreateAccountAlias, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::CreateAccountAlias, Aws::Client::RejectedCallOutcome<CreateAccountAliasOutcome>(), this, request);
+}
+
+CreateAccountAliasOutcomeCallable IAMClient::CreateAccountAliasCallable(CreateAccountAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::CreateAccountAlias, Aws::Client::RejectedCallOutcome<CreateAccountAliasOutcome>(), this, std::move(request));
 }
 
 void IAMClient::CreateAccountAliasAsync(const CreateAccountAliasRequest& request, const CreateAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::CreateAccountAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::CreateAccountAliasAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAccountAliasOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::CreateAccountAliasAsync(CreateAccountAliasRequest&& request, const CreateAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::CreateAccountAliasAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAccountAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::CreateAccountAliasAsyncHelper(const CreateAccountAliasRequest& request, const CreateAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -490,12 +580,22 @@ CreateGroupOutcome IAMClient::CreateGroup(const CreateGroupRequest& request) con
 
 CreateGroupOutcomeCallable IAMClient::CreateGroupCallable(const CreateGroupRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::CreateGroup, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::CreateGroup, Aws::Client::RejectedCallOutcome<CreateGroupOutcome>(), this, request);
+}
+
+CreateGroupOutcomeCallable IAMClient::CreateGroupCallable(CreateGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::CreateGroup, Aws::Client::RejectedCallOutcome<CreateGroupOutcome>(), this, std::move(request));
 }
 
 void IAMClient::CreateGroupAsync(const CreateGroupRequest& request, const CreateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::CreateGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::CreateGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateGroupOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::CreateGroupAsync(CreateGroupRequest&& request, const CreateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::CreateGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::CreateGroupAsyncHelper(const CreateGroupRequest& request, const CreateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -520,12 +620,22 @@ CreateInstanceProfileOutcome IAMClient::CreateInstanceProfile(const CreateInstan
 
 CreateInstanceProfileOutcomeCallable IAMClient::CreateInstanceProfileCallable(const CreateInstanceProfileRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::CreateInstanceProfile, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::CreateInstanceProfile, Aws::Client::RejectedCallOutcome<CreateInstanceProfileOutcome>(), this, request);
+}
+
+CreateInstanceProfileOutcomeCallable IAMClient::CreateInstanceProfileCallable(CreateInstanceProfileRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::CreateInstanceProfile, Aws::Client::RejectedCallOutcome<CreateInstanceProfileOutcome>(), this, std::move(request));
 }
 
 void IAMClient::CreateInstanceProfileAsync(const CreateInstanceProfileRequest& request, const CreateInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::CreateInstanceProfileAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::CreateInstanceProfileAsyncHelper, Aws::Client::RejectedAsyncCall<CreateInstanceProfileOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::CreateInstanceProfileAsync(CreateInstanceProfileRequest&& request, const CreateInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::CreateInstanceProfileAsyncHelper, Aws::Client::RejectedAsyncCall<CreateInstanceProfileOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::CreateInstanceProfileAsyncHelper(const CreateInstanceProfileRequest& request, const CreateInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -550,12 +660,22 @@ CreateLoginProfileOutcome IAMClient::CreateLoginProfile(const CreateLoginProfile
 
 CreateLoginProfileOutcomeCallable IAMClient::CreateLoginProfileCallable(const CreateLoginProfileRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::CreateLoginProfile, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::CreateLoginProfile, Aws::Client::RejectedCallOutcome<CreateLoginProfileOutcome>(), this, request);
+}
+
+CreateLoginProfileOutcomeCallable IAMClient::CreateLoginProfileCallable(CreateLoginProfileRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::CreateLoginProfile, Aws::Client::RejectedCallOutcome<CreateLoginProfileOutcome>(), this, std::move(request));
 }
 
 void IAMClient::CreateLoginProfileAsync(const CreateLoginProfileRequest& request, const CreateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::CreateLoginProfileAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::CreateLoginProfileAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLoginProfileOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::CreateLoginProfileAsync(CreateLoginProfileRequest&& request, const CreateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::CreateLoginProfileAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLoginProfileOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::CreateLoginProfileAsyncHelper(const CreateLoginProfileRequest& request, const CreateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -580,12 +700,22 @@ CreateOpenIDConnectProviderOutcome IAMClient::CreateOpenIDConnectProvider(const
 
 CreateOpenIDConnectProviderOutcomeCallable IAMClient::CreateOpenIDConnectProviderCallable(const CreateOpenIDConnectProviderRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::CreateOpenIDConnectProvider, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::CreateOpenIDConnectProvider, Aws::Client::RejectedCallOutcome<CreateOpenIDConnectProviderOutcome>(), this, request);
+}
+
+CreateOpenIDConnectProviderOutcomeCallable IAMClient::CreateOpenIDConnectProviderCallable(CreateOpenIDConnectProviderRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::CreateOpenIDConnectProvider, Aws::Client::RejectedCallOutcome<CreateOpenIDConnectProviderOutcome>(), this, std::move(request));
 }
 
 void IAMClient::CreateOpenIDConnectProviderAsync(const CreateOpenIDConnectProviderRequest& request, const CreateOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::CreateOpenIDConnectProviderAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::CreateOpenIDConnectProviderAsyncHelper, Aws::Client::RejectedAsyncCall<CreateOpenIDConnectProviderOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::CreateOpenIDConnectProviderAsync(CreateOpenIDConnectProviderRequest&& request, const CreateOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::CreateOpenIDConnectProviderAsyncHelper, Aws::Client::RejectedAsyncCall<CreateOpenIDConnectProviderOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::CreateOpenIDConnectProviderAsyncHelper(const CreateOpenIDConnectProviderRequest& request, const CreateOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -610,12 +740,22 @@ CreatePolicyOutcome IAMClient::CreatePolicy(const CreatePolicyRequest& request)
 
 CreatePolicyOutcomeCallable IAMClient::CreatePolicyCallable(const CreatePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::CreatePolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::CreatePolicy, Aws::Client::RejectedCallOutcome<CreatePolicyOutcome>(), this, request);
+}
+
+CreatePolicyOutcomeCallable IAMClient::CreatePolicyCallable(CreatePolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::CreatePolicy, Aws::Client::RejectedCallOutcome<CreatePolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::CreatePolicyAsync(const CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::CreatePolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::CreatePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::CreatePolicyAsync(CreatePolicyRequest&& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::CreatePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::CreatePolicyAsyncHelper(const CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -640,12 +780,22 @@ CreatePolicyVersionOutcome IAMClient::CreatePolicyVersion(const CreatePolicyVers
 
 CreatePolicyVersionOutcomeCallable IAMClient::CreatePolicyVersionCallable(const CreatePolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::CreatePolicyVersion, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::CreatePolicyVersion, Aws::Client::RejectedCallOutcome<CreatePolicyVersionOutcome>(), this, request);
+}
+
+CreatePolicyVersionOutcomeCallable IAMClient::CreatePolicyVersionCallable(CreatePolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::CreatePolicyVersion, Aws::Client::RejectedCallOutcome<CreatePolicyVersionOutcome>(), this, std::move(request));
 }
 
 void IAMClient::CreatePolicyVersionAsync(const CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::CreatePolicyVersionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::CreatePolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePolicyVersionOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::CreatePolicyVersionAsync(CreatePolicyVersionRequest&& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::CreatePolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePolicyVersionOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::CreatePolicyVersionAsyncHelper(const CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -670,12 +820,22 @@ CreateRoleOutcome IAMClient::CreateRole(const CreateRoleRequest& request) const
 
 CreateRoleOutcomeCallable IAMClient::CreateRoleCallable(const CreateRoleRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::CreateRole, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::CreateRole, Aws::Client::RejectedCallOutcome<CreateRoleOutcome>(), this, request);
+}
+
+CreateRoleOutcomeCallable IAMClient::CreateRoleCallable(CreateRoleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::CreateRole, Aws::Client::RejectedCallOutcome<CreateRoleOutcome>(), this, std::move(request));
 }
 
 void IAMClient::CreateRoleAsync(const CreateRoleRequest& request, const CreateRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::CreateRoleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::CreateRoleAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRoleOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::CreateRoleAsync(CreateRoleRequest&& request, const CreateRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::CreateRoleAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRoleOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::CreateRoleAsyncHelper(const CreateRoleRequest& request, const CreateRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -700,12 +860,22 @@ CreateSAMLProviderOutcome IAMClient::CreateSAMLProvider(const CreateSAMLProvider
 
 CreateSAMLProviderOutcomeCallable IAMClient::CreateSAMLProviderCallable(const CreateSAMLProviderRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::CreateSAMLProvider, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::CreateSAMLProvider, Aws::Client::RejectedCallOutcome<CreateSAMLProviderOutcome>(), this, request);
+}
+
+CreateSAMLProviderOutcomeCallable IAMClient::CreateSAMLProviderCallable(CreateSAMLProviderRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::CreateSAMLProvider, Aws::Client::RejectedCallOutcome<CreateSAMLProviderOutcome>(), this, std::move(request));
 }
 
 void IAMClient::CreateSAMLProviderAsync(const CreateSAMLProviderRequest& request, const CreateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::CreateSAMLProviderAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::CreateSAMLProviderAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSAMLProviderOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::CreateSAMLProviderAsync(CreateSAMLProviderRequest&& request, const CreateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::CreateSAMLProviderAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSAMLProviderOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::CreateSAMLProviderAsyncHelper(const CreateSAMLProviderRequest& request, const CreateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -730,12 +900,22 @@ CreateUserOutcome IAMClient::CreateUser(const CreateUserRequest& request) const
 
 CreateUserOutcomeCallable IAMClient::CreateUserCallable(const CreateUserRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::CreateUser, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::CreateUser, Aws::Client::RejectedCallOutcome<CreateUserOutcome>(), this, request);
+}
+
+CreateUserOutcomeCallable IAMClient::CreateUserCallable(CreateUserRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::CreateUser, Aws::Client::RejectedCallOutcome<CreateUserOutcome>(), this, std::move(request));
 }
 
 void IAMClient::CreateUserAsync(const CreateUserRequest& request, const CreateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::CreateUserAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::CreateUserAsyncHelper, Aws::Client::RejectedAsyncCall<CreateUserOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::CreateUserAsync(CreateUserRequest&& request, const CreateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::CreateUserAsyncHelper, Aws::Client::RejectedAsyncCall<CreateUserOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::CreateUserAsyncHelper(const CreateUserRequest& request, const CreateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -760,12 +940,22 @@ CreateVirtualMFADeviceOutcome IAMClient::CreateVirtualMFADevice(const CreateVirt
 
 CreateVirtualMFADeviceOutcomeCallable IAMClient::CreateVirtualMFADeviceCallable(const CreateVirtualMFADeviceRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::CreateVirtualMFADevice, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::CreateVirtualMFADevice, Aws::Client::RejectedCallOutcome<CreateVirtualMFADeviceOutcome>(), this, request);
+}
+
+CreateVirtualMFADeviceOutcomeCallable IAMClient::CreateVirtualMFADeviceCallable(CreateVirtualMFADeviceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::CreateVirtualMFADevice, Aws::Client::RejectedCallOutcome<CreateVirtualMFADeviceOutcome>(), this, std::move(request));
 }
 
 void IAMClient::CreateVirtualMFADeviceAsync(const CreateVirtualMFADeviceRequest& request, const CreateVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::CreateVirtualMFADeviceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::CreateVirtualMFADeviceAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVirtualMFADeviceOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::CreateVirtualMFADeviceAsync(CreateVirtualMFADeviceRequest&& request, const CreateVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::CreateVirtualMFADeviceAsyncHelper, Aws::Client::RejectedAsyncCall<CreateVirtualMFADeviceOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::CreateVirtualMFADeviceAsyncHelper(const CreateVirtualMFADeviceRequest& request, const CreateVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -790,12 +980,22 @@ DeactivateMFADeviceOutcome IAMClient::DeactivateMFADevice(const DeactivateMFADev
 
 DeactivateMFADeviceOutcomeCallable IAMClient::DeactivateMFADeviceCallable(const DeactivateMFADeviceRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeactivateMFADevice, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeactivateMFADevice, Aws::Client::RejectedCallOutcome<DeactivateMFADeviceOutcome>(), this, request);
+}
+
+DeactivateMFADeviceOutcomeCallable IAMClient::DeactivateMFADeviceCallable(DeactivateMFADeviceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeactivateMFADevice, Aws::Client::RejectedCallOutcome<DeactivateMFADeviceOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeactivateMFADeviceAsync(const DeactivateMFADeviceRequest& request, const DeactivateMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeactivateMFADeviceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeactivateMFADeviceAsyncHelper, Aws::Client::RejectedAsyncCall<DeactivateMFADeviceOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeactivateMFADeviceAsync(DeactivateMFADeviceRequest&& request, const DeactivateMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeactivateMFADeviceAsyncHelper, Aws::Client::RejectedAsyncCall<DeactivateMFADeviceOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeactivateMFADeviceAsyncHelper(const DeactivateMFADeviceRequest& request, const DeactivateMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -820,12 +1020,22 @@ DeleteAccessKeyOutcome IAMClient::DeleteAccessKey(const DeleteAccessKeyRequest&
 
 DeleteAccessKeyOutcomeCallable IAMClient::DeleteAccessKeyCallable(const DeleteAccessKeyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteAccessKey, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteAccessKey, Aws::Client::RejectedCallOutcome<DeleteAccessKeyOutcome>(), this, request);
+}
+
+DeleteAccessKeyOutcomeCallable IAMClient::DeleteAccessKeyCallable(DeleteAccessKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteAccessKey, Aws::Client::RejectedCallOutcome<DeleteAccessKeyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteAccessKeyAsync(const DeleteAccessKeyRequest& request, const DeleteAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteAccessKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteAccessKeyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAccessKeyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteAccessKeyAsync(DeleteAccessKeyRequest&& request, const DeleteAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteAccessKeyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAccessKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteAccessKeyAsyncHelper(const DeleteAccessKeyRequest& request, const DeleteAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -850,12 +1060,22 @@ DeleteAccountAliasOutcome IAMClient::DeleteAccountAlias(const DeleteAccountAlias
 
 DeleteAccountAliasOutcomeCallable IAMClient::DeleteAccountAliasCallable(const DeleteAccountAliasRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteAccountAlias, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteAccountAlias, Aws::Client::RejectedCallOutcome<DeleteAccountAliasOutcome>(), this, request);
+}
+
+DeleteAccountAliasOutcomeCallable IAMClient::DeleteAccountAliasCallable(DeleteAccountAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteAccountAlias, Aws::Client::RejectedCallOutcome<DeleteAccountAliasOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteAccountAliasAsync(const DeleteAccountAliasRequest& request, const DeleteAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteAccountAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteAccountAliasAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAccountAliasOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteAccountAliasAsync(DeleteAccountAliasRequest&& request, const DeleteAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteAccountAliasAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAccountAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteAccountAliasAsyncHelper(const DeleteAccountAliasRequest& request, const DeleteAccountAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -880,12 +1100,22 @@ DeleteAccountPasswordPolicyOutcome IAMClient::DeleteAccountPasswordPolicy(const
 
 DeleteAccountPasswordPolicyOutcomeCallable IAMClient::DeleteAccountPasswordPolicyCallable(const DeleteAccountPasswordPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteAccountPasswordPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteAccountPasswordPolicy, Aws::Client::RejectedCallOutcome<DeleteAccountPasswordPolicyOutcome>(), this, request);
+}
+
+DeleteAccountPasswordPolicyOutcomeCallable IAMClient::DeleteAccountPasswordPolicyCallable(DeleteAccountPasswordPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteAccountPasswordPolicy, Aws::Client::RejectedCallOutcome<DeleteAccountPasswordPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteAccountPasswordPolicyAsync(const DeleteAccountPasswordPolicyRequest& request, const DeleteAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteAccountPasswordPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteAccountPasswordPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAccountPasswordPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteAccountPasswordPolicyAsync(DeleteAccountPasswordPolicyRequest&& request, const DeleteAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteAccountPasswordPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAccountPasswordPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteAccountPasswordPolicyAsyncHelper(const DeleteAccountPasswordPolicyRequest& request, const DeleteAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -910,12 +1140,22 @@ DeleteGroupOutcome IAMClient::DeleteGroup(const DeleteGroupRequest& request) con
 
 DeleteGroupOutcomeCallable IAMClient::DeleteGroupCallable(const DeleteGroupRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteGroup, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteGroup, Aws::Client::RejectedCallOutcome<DeleteGroupOutcome>(), this, request);
+}
+
+DeleteGroupOutcomeCallable IAMClient::DeleteGroupCallable(DeleteGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteGroup, Aws::Client::RejectedCallOutcome<DeleteGroupOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteGroupAsync(const DeleteGroupRequest& request, const DeleteGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteGroupOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteGroupAsync(DeleteGroupRequest&& request, const DeleteGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteGroupAsyncHelper(const DeleteGroupRequest& request, const DeleteGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -940,12 +1180,22 @@ DeleteGroupPolicyOutcome IAMClient::DeleteGroupPolicy(const DeleteGroupPolicyReq
 
 DeleteGroupPolicyOutcomeCallable IAMClient::DeleteGroupPolicyCallable(const DeleteGroupPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteGroupPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteGroupPolicy, Aws::Client::RejectedCallOutcome<DeleteGroupPolicyOutcome>(), this, request);
+}
+
+DeleteGroupPolicyOutcomeCallable IAMClient::DeleteGroupPolicyCallable(DeleteGroupPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteGroupPolicy, Aws::Client::RejectedCallOutcome<DeleteGroupPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteGroupPolicyAsync(const DeleteGroupPolicyRequest& request, const DeleteGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteGroupPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteGroupPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteGroupPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteGroupPolicyAsync(DeleteGroupPolicyRequest&& request, const DeleteGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteGroupPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteGroupPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteGroupPolicyAsyncHelper(const DeleteGroupPolicyRequest& request, const DeleteGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -970,12 +1220,22 @@ DeleteInstanceProfileOutcome IAMClient::DeleteInstanceProfile(const DeleteInstan
 
 DeleteInstanceProfileOutcomeCallable IAMClient::DeleteInstanceProfileCallable(const DeleteInstanceProfileRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteInstanceProfile, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteInstanceProfile, Aws::Client::RejectedCallOutcome<DeleteInstanceProfileOutcome>(), this, request);
+}
+
+DeleteInstanceProfileOutcomeCallable IAMClient::DeleteInstanceProfileCallable(DeleteInstanceProfileRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteInstanceProfile, Aws::Client::RejectedCallOutcome<DeleteInstanceProfileOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteInstanceProfileAsync(const DeleteInstanceProfileRequest& request, const DeleteInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteInstanceProfileAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteInstanceProfileAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteInstanceProfileOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteInstanceProfileAsync(DeleteInstanceProfileRequest&& request, const DeleteInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteInstanceProfileAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteInstanceProfileOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteInstanceProfileAsyncHelper(const DeleteInstanceProfileRequest& request, const DeleteInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1000,12 +1260,22 @@ DeleteLoginProfileOutcome IAMClient::DeleteLoginProfile(const DeleteLoginProfile
 
 DeleteLoginProfileOutcomeCallable IAMClient::DeleteLoginProfileCallable(const DeleteLoginProfileRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteLoginProfile, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteLoginProfile, Aws::Client::RejectedCallOutcome<DeleteLoginProfileOutcome>(), this, request);
+}
+
+DeleteLoginProfileOutcomeCallable IAMClient::DeleteLoginProfileCallable(DeleteLoginProfileRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteLoginProfile, Aws::Client::RejectedCallOutcome<DeleteLoginProfileOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteLoginProfileAsync(const DeleteLoginProfileRequest& request, const DeleteLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteLoginProfileAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteLoginProfileAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLoginProfileOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteLoginProfileAsync(DeleteLoginProfileRequest&& request, const DeleteLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteLoginProfileAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLoginProfileOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteLoginProfileAsyncHelper(const DeleteLoginProfileRequest& request, const DeleteLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1030,12 +1300,22 @@ DeleteOpenIDConnectProviderOutcome IAMClient::DeleteOpenIDConnectProvider(const
 
 DeleteOpenIDConnectProviderOutcomeCallable IAMClient::DeleteOpenIDConnectProviderCallable(const DeleteOpenIDConnectProviderRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteOpenIDConnectProvider, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteOpenIDConnectProvider, Aws::Client::RejectedCallOutcome<DeleteOpenIDConnectProviderOutcome>(), this, request);
+}
+
+DeleteOpenIDConnectProviderOutcomeCallable IAMClient::DeleteOpenIDConnectProviderCallable(DeleteOpenIDConnectProviderRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteOpenIDConnectProvider, Aws::Client::RejectedCallOutcome<DeleteOpenIDConnectProviderOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteOpenIDConnectProviderAsync(const DeleteOpenIDConnectProviderRequest& request, const DeleteOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteOpenIDConnectProviderAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteOpenIDConnectProviderAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteOpenIDConnectProviderOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteOpenIDConnectProviderAsync(DeleteOpenIDConnectProviderRequest&& request, const DeleteOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteOpenIDConnectProviderAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteOpenIDConnectProviderOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteOpenIDConnectProviderAsyncHelper(const DeleteOpenIDConnectProviderRequest& request, const DeleteOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1060,12 +1340,22 @@ DeletePolicyOutcome IAMClient::DeletePolicy(const DeletePolicyRequest& request)
 
 DeletePolicyOutcomeCallable IAMClient::DeletePolicyCallable(const DeletePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeletePolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeletePolicy, Aws::Client::RejectedCallOutcome<DeletePolicyOutcome>(), this, request);
+}
+
+DeletePolicyOutcomeCallable IAMClient::DeletePolicyCallable(DeletePolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeletePolicy, Aws::Client::RejectedCallOutcome<DeletePolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeletePolicyAsync(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeletePolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeletePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeletePolicyAsync(DeletePolicyRequest&& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeletePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeletePolicyAsyncHelper(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1090,12 +1380,22 @@ DeletePolicyVersionOutcome IAMClient::DeletePolicyVersion(const DeletePolicyVers
 
 DeletePolicyVersionOutcomeCallable IAMClient::DeletePolicyVersionCallable(const DeletePolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeletePolicyVersion, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeletePolicyVersion, Aws::Client::RejectedCallOutcome<DeletePolicyVersionOutcome>(), this, request);
+}
+
+DeletePolicyVersionOutcomeCallable IAMClient::DeletePolicyVersionCallable(DeletePolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeletePolicyVersion, Aws::Client::RejectedCallOutcome<DeletePolicyVersionOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeletePolicyVersionAsync(const DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeletePolicyVersionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeletePolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePolicyVersionOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeletePolicyVersionAsync(DeletePolicyVersionRequest&& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeletePolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePolicyVersionOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeletePolicyVersionAsyncHelper(const DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1120,12 +1420,22 @@ DeleteRoleOutcome IAMClient::DeleteRole(const DeleteRoleRequest& request) const
 
 DeleteRoleOutcomeCallable IAMClient::DeleteRoleCallable(const DeleteRoleRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteRole, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteRole, Aws::Client::RejectedCallOutcome<DeleteRoleOutcome>(), this, request);
+}
+
+DeleteRoleOutcomeCallable IAMClient::DeleteRoleCallable(DeleteRoleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteRole, Aws::Client::RejectedCallOutcome<DeleteRoleOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteRoleAsync(const DeleteRoleRequest& request, const DeleteRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteRoleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteRoleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRoleOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteRoleAsync(DeleteRoleRequest&& request, const DeleteRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteRoleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRoleOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteRoleAsyncHelper(const DeleteRoleRequest& request, const DeleteRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1150,12 +1460,22 @@ DeleteRolePolicyOutcome IAMClient::DeleteRolePolicy(const DeleteRolePolicyReques
 
 DeleteRolePolicyOutcomeCallable IAMClient::DeleteRolePolicyCallable(const DeleteRolePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteRolePolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteRolePolicy, Aws::Client::RejectedCallOutcome<DeleteRolePolicyOutcome>(), this, request);
+}
+
+DeleteRolePolicyOutcomeCallable IAMClient::DeleteRolePolicyCallable(DeleteRolePolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteRolePolicy, Aws::Client::RejectedCallOutcome<DeleteRolePolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteRolePolicyAsync(const DeleteRolePolicyRequest& request, const DeleteRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteRolePolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteRolePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRolePolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteRolePolicyAsync(DeleteRolePolicyRequest&& request, const DeleteRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteRolePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRolePolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteRolePolicyAsyncHelper(const DeleteRolePolicyRequest& request, const DeleteRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1180,12 +1500,22 @@ DeleteSAMLProviderOutcome IAMClient::DeleteSAMLProvider(const DeleteSAMLProvider
 
 DeleteSAMLProviderOutcomeCallable IAMClient::DeleteSAMLProviderCallable(const DeleteSAMLProviderRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteSAMLProvider, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteSAMLProvider, Aws::Client::RejectedCallOutcome<DeleteSAMLProviderOutcome>(), this, request);
+}
+
+DeleteSAMLProviderOutcomeCallable IAMClient::DeleteSAMLProviderCallable(DeleteSAMLProviderRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteSAMLProvider, Aws::Client::RejectedCallOutcome<DeleteSAMLProviderOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteSAMLProviderAsync(const DeleteSAMLProviderRequest& request, const DeleteSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteSAMLProviderAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteSAMLProviderAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSAMLProviderOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteSAMLProviderAsync(DeleteSAMLProviderRequest&& request, const DeleteSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteSAMLProviderAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSAMLProviderOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteSAMLProviderAsyncHelper(const DeleteSAMLProviderRequest& request, const DeleteSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1210,12 +1540,22 @@ DeleteSSHPublicKeyOutcome IAMClient::DeleteSSHPublicKey(const DeleteSSHPublicKey
 
 DeleteSSHPublicKeyOutcomeCallable IAMClient::DeleteSSHPublicKeyCallable(const DeleteSSHPublicKeyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteSSHPublicKey, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteSSHPublicKey, Aws::Client::RejectedCallOutcome<DeleteSSHPublicKeyOutcome>(), this, request);
+}
+
+DeleteSSHPublicKeyOutcomeCallable IAMClient::DeleteSSHPublicKeyCallable(DeleteSSHPublicKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteSSHPublicKey, Aws::Client::RejectedCallOutcome<DeleteSSHPublicKeyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteSSHPublicKeyAsync(const DeleteSSHPublicKeyRequest& request, const DeleteSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteSSHPublicKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteSSHPublicKeyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSSHPublicKeyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteSSHPublicKeyAsync(DeleteSSHPublicKeyRequest&& request, const DeleteSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteSSHPublicKeyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSSHPublicKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteSSHPublicKeyAsyncHelper(const DeleteSSHPublicKeyRequest& request, const DeleteSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1240,12 +1580,22 @@ DeleteServerCertificateOutcome IAMClient::DeleteServerCertificate(const DeleteSe
 
 DeleteServerCertificateOutcomeCallable IAMClient::DeleteServerCertificateCallable(const DeleteServerCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteServerCertificate, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteServerCertificate, Aws::Client::RejectedCallOutcome<DeleteServerCertificateOutcome>(), this, request);
+}
+
+DeleteServerCertificateOutcomeCallable IAMClient::DeleteServerCertificateCallable(DeleteServerCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteServerCertificate, Aws::Client::RejectedCallOutcome<DeleteServerCertificateOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteServerCertificateAsync(const DeleteServerCertificateRequest& request, const DeleteServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteServerCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteServerCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteServerCertificateOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteServerCertificateAsync(DeleteServerCertificateRequest&& request, const DeleteServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteServerCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteServerCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteServerCertificateAsyncHelper(const DeleteServerCertificateRequest& request, const DeleteServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1270,12 +1620,22 @@ DeleteSigningCertificateOutcome IAMClient::DeleteSigningCertificate(const Delete
 
 DeleteSigningCertificateOutcomeCallable IAMClient::DeleteSigningCertificateCallable(const DeleteSigningCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteSigningCertificate, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteSigningCertificate, Aws::Client::RejectedCallOutcome<DeleteSigningCertificateOutcome>(), this, request);
+}
+
+DeleteSigningCertificateOutcomeCallable IAMClient::DeleteSigningCertificateCallable(DeleteSigningCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteSigningCertificate, Aws::Client::RejectedCallOutcome<DeleteSigningCertificateOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteSigningCertificateAsync(const DeleteSigningCertificateRequest& request, const DeleteSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteSigningCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteSigningCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSigningCertificateOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteSigningCertificateAsync(DeleteSigningCertificateRequest&& request, const DeleteSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteSigningCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSigningCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteSigningCertificateAsyncHelper(const DeleteSigningCertificateRequest& request, const DeleteSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1300,12 +1660,22 @@ DeleteUserOutcome IAMClient::DeleteUser(const DeleteUserRequest& request) const
 
 DeleteUserOutcomeCallable IAMClient::DeleteUserCallable(const DeleteUserRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteUser, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteUser, Aws::Client::RejectedCallOutcome<DeleteUserOutcome>(), this, request);
+}
+
+DeleteUserOutcomeCallable IAMClient::DeleteUserCallable(DeleteUserRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteUser, Aws::Client::RejectedCallOutcome<DeleteUserOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteUserAsync(const DeleteUserRequest& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteUserAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteUserAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteUserOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteUserAsync(DeleteUserRequest&& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteUserAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteUserOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteUserAsyncHelper(const DeleteUserRequest& request, const DeleteUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1330,12 +1700,22 @@ DeleteUserPolicyOutcome IAMClient::DeleteUserPolicy(const DeleteUserPolicyReques
 
 DeleteUserPolicyOutcomeCallable IAMClient::DeleteUserPolicyCallable(const DeleteUserPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteUserPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteUserPolicy, Aws::Client::RejectedCallOutcome<DeleteUserPolicyOutcome>(), this, request);
+}
+
+DeleteUserPolicyOutcomeCallable IAMClient::DeleteUserPolicyCallable(DeleteUserPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteUserPolicy, Aws::Client::RejectedCallOutcome<DeleteUserPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteUserPolicyAsync(const DeleteUserPolicyRequest& request, const DeleteUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteUserPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteUserPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteUserPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteUserPolicyAsync(DeleteUserPolicyRequest&& request, const DeleteUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteUserPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteUserPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteUserPolicyAsyncHelper(const DeleteUserPolicyRequest& request, const DeleteUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1360,12 +1740,22 @@ DeleteVirtualMFADeviceOutcome IAMClient::DeleteVirtualMFADevice(const DeleteVirt
 
 DeleteVirtualMFADeviceOutcomeCallable IAMClient::DeleteVirtualMFADeviceCallable(const DeleteVirtualMFADeviceRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DeleteVirtualMFADevice, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteVirtualMFADevice, Aws::Client::RejectedCallOutcome<DeleteVirtualMFADeviceOutcome>(), this, request);
+}
+
+DeleteVirtualMFADeviceOutcomeCallable IAMClient::DeleteVirtualMFADeviceCallable(DeleteVirtualMFADeviceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DeleteVirtualMFADevice, Aws::Client::RejectedCallOutcome<DeleteVirtualMFADeviceOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DeleteVirtualMFADeviceAsync(const DeleteVirtualMFADeviceRequest& request, const DeleteVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DeleteVirtualMFADeviceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DeleteVirtualMFADeviceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVirtualMFADeviceOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DeleteVirtualMFADeviceAsync(DeleteVirtualMFADeviceRequest&& request, const DeleteVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DeleteVirtualMFADeviceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVirtualMFADeviceOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DeleteVirtualMFADeviceAsyncHelper(const DeleteVirtualMFADeviceRequest& request, const DeleteVirtualMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1390,12 +1780,22 @@ DetachGroupPolicyOutcome IAMClient::DetachGroupPolicy(const DetachGroupPolicyReq
 
 DetachGroupPolicyOutcomeCallable IAMClient::DetachGroupPolicyCallable(const DetachGroupPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DetachGroupPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DetachGroupPolicy, Aws::Client::RejectedCallOutcome<DetachGroupPolicyOutcome>(), this, request);
+}
+
+DetachGroupPolicyOutcomeCallable IAMClient::DetachGroupPolicyCallable(DetachGroupPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DetachGroupPolicy, Aws::Client::RejectedCallOutcome<DetachGroupPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DetachGroupPolicyAsync(const DetachGroupPolicyRequest& request, const DetachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DetachGroupPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DetachGroupPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DetachGroupPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DetachGroupPolicyAsync(DetachGroupPolicyRequest&& request, const DetachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DetachGroupPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DetachGroupPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DetachGroupPolicyAsyncHelper(const DetachGroupPolicyRequest& request, const DetachGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1420,12 +1820,22 @@ DetachRolePolicyOutcome IAMClient::DetachRolePolicy(const DetachRolePolicyReques
 
 DetachRolePolicyOutcomeCallable IAMClient::DetachRolePolicyCallable(const DetachRolePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DetachRolePolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DetachRolePolicy, Aws::Client::RejectedCallOutcome<DetachRolePolicyOutcome>(), this, request);
+}
+
+DetachRolePolicyOutcomeCallable IAMClient::DetachRolePolicyCallable(DetachRolePolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DetachRolePolicy, Aws::Client::RejectedCallOutcome<DetachRolePolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DetachRolePolicyAsync(const DetachRolePolicyRequest& request, const DetachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DetachRolePolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DetachRolePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DetachRolePolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DetachRolePolicyAsync(DetachRolePolicyRequest&& request, const DetachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DetachRolePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DetachRolePolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DetachRolePolicyAsyncHelper(const DetachRolePolicyRequest& request, const DetachRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1450,12 +1860,22 @@ DetachUserPolicyOutcome IAMClient::DetachUserPolicy(const DetachUserPolicyReques
 
 DetachUserPolicyOutcomeCallable IAMClient::DetachUserPolicyCallable(const DetachUserPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::DetachUserPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::DetachUserPolicy, Aws::Client::RejectedCallOutcome<DetachUserPolicyOutcome>(), this, request);
+}
+
+DetachUserPolicyOutcomeCallable IAMClient::DetachUserPolicyCallable(DetachUserPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::DetachUserPolicy, Aws::Client::RejectedCallOutcome<DetachUserPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::DetachUserPolicyAsync(const DetachUserPolicyRequest& request, const DetachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::DetachUserPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::DetachUserPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DetachUserPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::DetachUserPolicyAsync(DetachUserPolicyRequest&& request, const DetachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::DetachUserPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DetachUserPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::DetachUserPolicyAsyncHelper(const DetachUserPolicyRequest& request, const DetachUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1480,12 +1900,22 @@ EnableMFADeviceOutcome IAMClient::EnableMFADevice(const EnableMFADeviceRequest&
 
 EnableMFADeviceOutcomeCallable IAMClient::EnableMFADeviceCallable(const EnableMFADeviceRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::EnableMFADevice, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::EnableMFADevice, Aws::Client::RejectedCallOutcome<EnableMFADeviceOutcome>(), this, request);
+}
+
+EnableMFADeviceOutcomeCallable IAMClient::EnableMFADeviceCallable(EnableMFADeviceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::EnableMFADevice, Aws::Client::RejectedCallOutcome<EnableMFADeviceOutcome>(), this, std::move(request));
 }
 
 void IAMClient::EnableMFADeviceAsync(const EnableMFADeviceRequest& request, const EnableMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::EnableMFADeviceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::EnableMFADeviceAsyncHelper, Aws::Client::RejectedAsyncCall<EnableMFADeviceOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::EnableMFADeviceAsync(EnableMFADeviceRequest&& request, const EnableMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::EnableMFADeviceAsyncHelper, Aws::Client::RejectedAsyncCall<EnableMFADeviceOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::EnableMFADeviceAsyncHelper(const EnableMFADeviceRequest& request, const EnableMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1510,12 +1940,22 @@ GenerateCredentialReportOutcome IAMClient::GenerateCredentialReport(const Genera
 
 GenerateCredentialReportOutcomeCallable IAMClient::GenerateCredentialReportCallable(const GenerateCredentialReportRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GenerateCredentialReport, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GenerateCredentialReport, Aws::Client::RejectedCallOutcome<GenerateCredentialReportOutcome>(), this, request);
+}
+
+GenerateCredentialReportOutcomeCallable IAMClient::GenerateCredentialReportCallable(GenerateCredentialReportRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GenerateCredentialReport, Aws::Client::RejectedCallOutcome<GenerateCredentialReportOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GenerateCredentialReportAsync(const GenerateCredentialReportRequest& request, const GenerateCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GenerateCredentialReportAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GenerateCredentialReportAsyncHelper, Aws::Client::RejectedAsyncCall<GenerateCredentialReportOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GenerateCredentialReportAsync(GenerateCredentialReportRequest&& request, const GenerateCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GenerateCredentialReportAsyncHelper, Aws::Client::RejectedAsyncCall<GenerateCredentialReportOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GenerateCredentialReportAsyncHelper(const GenerateCredentialReportRequest& request, const GenerateCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1540,12 +1980,22 @@ GetAccessKeyLastUsedOutcome IAMClient::GetAccessKeyLastUsed(const GetAccessKeyLa
 
 GetAccessKeyLastUsedOutcomeCallable IAMClient::GetAccessKeyLastUsedCallable(const GetAccessKeyLastUsedRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetAccessKeyLastUsed, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetAccessKeyLastUsed, Aws::Client::RejectedCallOutcome<GetAccessKeyLastUsedOutcome>(), this, request);
+}
+
+GetAccessKeyLastUsedOutcomeCallable IAMClient::GetAccessKeyLastUsedCallable(GetAccessKeyLastUsedRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetAccessKeyLastUsed, Aws::Client::RejectedCallOutcome<GetAccessKeyLastUsedOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetAccessKeyLastUsedAsync(const GetAccessKeyLastUsedRequest& request, const GetAccessKeyLastUsedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetAccessKeyLastUsedAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetAccessKeyLastUsedAsyncHelper, Aws::Client::RejectedAsyncCall<GetAccessKeyLastUsedOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetAccessKeyLastUsedAsync(GetAccessKeyLastUsedRequest&& request, const GetAccessKeyLastUsedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetAccessKeyLastUsedAsyncHelper, Aws::Client::RejectedAsyncCall<GetAccessKeyLastUsedOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetAccessKeyLastUsedAsyncHelper(const GetAccessKeyLastUsedRequest& request, const GetAccessKeyLastUsedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1570,12 +2020,22 @@ GetAccountAuthorizationDetailsOutcome IAMClient::GetAccountAuthorizationDetails(
 
 GetAccountAuthorizationDetailsOutcomeCallable IAMClient::GetAccountAuthorizationDetailsCallable(const GetAccountAuthorizationDetailsRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetAccountAuthorizationDetails, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetAccountAuthorizationDetails, Aws::Client::RejectedCallOutcome<GetAccountAuthorizationDetailsOutcome>(), this, request);
+}
+
+GetAccountAuthorizationDetailsOutcomeCallable IAMClient::GetAccountAuthorizationDetailsCallable(GetAccountAuthorizationDetailsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetAccountAuthorizationDetails, Aws::Client::RejectedCallOutcome<GetAccountAuthorizationDetailsOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetAccountAuthorizationDetailsAsync(const GetAccountAuthorizationDetailsRequest& request, const GetAccountAuthorizationDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetAccountAuthorizationDetailsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetAccountAuthorizationDetailsAsyncHelper, Aws::Client::RejectedAsyncCall<GetAccountAuthorizationDetailsOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetAccountAuthorizationDetailsAsync(GetAccountAuthorizationDetailsRequest&& request, const GetAccountAuthorizationDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetAccountAuthorizationDetailsAsyncHelper, Aws::Client::RejectedAsyncCall<GetAccountAuthorizationDetailsOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetAccountAuthorizationDetailsAsyncHelper(const GetAccountAuthorizationDetailsRequest& request, const GetAccountAuthorizationDetailsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1600,12 +2060,22 @@ GetAccountPasswordPolicyOutcome IAMClient::GetAccountPasswordPolicy(const GetAcc
 
 GetAccountPasswordPolicyOutcomeCallable IAMClient::GetAccountPasswordPolicyCallable(const GetAccountPasswordPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetAccountPasswordPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetAccountPasswordPolicy, Aws::Client::RejectedCallOutcome<GetAccountPasswordPolicyOutcome>(), this, request);
+}
+
+GetAccountPasswordPolicyOutcomeCallable IAMClient::GetAccountPasswordPolicyCallable(GetAccountPasswordPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetAccountPasswordPolicy, Aws::Client::RejectedCallOutcome<GetAccountPasswordPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetAccountPasswordPolicyAsync(const GetAccountPasswordPolicyRequest& request, const GetAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetAccountPasswordPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetAccountPasswordPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetAccountPasswordPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetAccountPasswordPolicyAsync(GetAccountPasswordPolicyRequest&& request, const GetAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetAccountPasswordPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetAccountPasswordPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetAccountPasswordPolicyAsyncHelper(const GetAccountPasswordPolicyRequest& request, const GetAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1630,12 +2100,22 @@ GetAccountSummaryOutcome IAMClient::GetAccountSummary(const GetAccountSummaryReq
 
 GetAccountSummaryOutcomeCallable IAMClient::GetAccountSummaryCallable(const GetAccountSummaryRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetAccountSummary, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetAccountSummary, Aws::Client::RejectedCallOutcome<GetAccountSummaryOutcome>(), this, request);
+}
+
+GetAccountSummaryOutcomeCallable IAMClient::GetAccountSummaryCallable(GetAccountSummaryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetAccountSummary, Aws::Client::RejectedCallOutcome<GetAccountSummaryOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetAccountSummaryAsync(const GetAccountSummaryRequest& request, const GetAccountSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetAccountSummaryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetAccountSummaryAsyncHelper, Aws::Client::RejectedAsyncCall<GetAccountSummaryOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetAccountSummaryAsync(GetAccountSummaryRequest&& request, const GetAccountSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetAccountSummaryAsyncHelper, Aws::Client::RejectedAsyncCall<GetAccountSummaryOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetAccountSummaryAsyncHelper(const GetAccountSummaryRequest& request, const GetAccountSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1660,12 +2140,22 @@ GetContextKeysForCustomPolicyOutcome IAMClient::GetContextKeysForCustomPolicy(co
 
 GetContextKeysForCustomPolicyOutcomeCallable IAMClient::GetContextKeysForCustomPolicyCallable(const GetContextKeysForCustomPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetContextKeysForCustomPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetContextKeysForCustomPolicy, Aws::Client::RejectedCallOutcome<GetContextKeysForCustomPolicyOutcome>(), this, request);
+}
+
+GetContextKeysForCustomPolicyOutcomeCallable IAMClient::GetContextKeysForCustomPolicyCallable(GetContextKeysForCustomPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetContextKeysForCustomPolicy, Aws::Client::RejectedCallOutcome<GetContextKeysForCustomPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetContextKeysForCustomPolicyAsync(const GetContextKeysForCustomPolicyRequest& request, const GetContextKeysForCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetContextKeysForCustomPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetContextKeysForCustomPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetContextKeysForCustomPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetContextKeysForCustomPolicyAsync(GetContextKeysForCustomPolicyRequest&& request, const GetContextKeysForCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetContextKeysForCustomPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetContextKeysForCustomPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetContextKeysForCustomPolicyAsyncHelper(const GetContextKeysForCustomPolicyRequest& request, const GetContextKeysForCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1690,12 +2180,22 @@ GetContextKeysForPrincipalPolicyOutcome IAMClient::GetContextKeysForPrincipalPol
 
 GetContextKeysForPrincipalPolicyOutcomeCallable IAMClient::GetContextKeysForPrincipalPolicyCallable(const GetContextKeysForPrincipalPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetContextKeysForPrincipalPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetContextKeysForPrincipalPolicy, Aws::Client::RejectedCallOutcome<GetContextKeysForPrincipalPolicyOutcome>(), this, request);
+}
+
+GetContextKeysForPrincipalPolicyOutcomeCallable IAMClient::GetContextKeysForPrincipalPolicyCallable(GetContextKeysForPrincipalPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetContextKeysForPrincipalPolicy, Aws::Client::RejectedCallOutcome<GetContextKeysForPrincipalPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetContextKeysForPrincipalPolicyAsync(const GetContextKeysForPrincipalPolicyRequest& request, const GetContextKeysForPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetContextKeysForPrincipalPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetContextKeysForPrincipalPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetContextKeysForPrincipalPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetContextKeysForPrincipalPolicyAsync(GetContextKeysForPrincipalPolicyRequest&& request, const GetContextKeysForPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetContextKeysForPrincipalPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetContextKeysForPrincipalPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetContextKeysForPrincipalPolicyAsyncHelper(const GetContextKeysForPrincipalPolicyRequest& request, const GetContextKeysForPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1720,12 +2220,22 @@ GetCredentialReportOutcome IAMClient::GetCredentialReport(const GetCredentialRep
 
 GetCredentialReportOutcomeCallable IAMClient::GetCredentialReportCallable(const GetCredentialReportRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetCredentialReport, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetCredentialReport, Aws::Client::RejectedCallOutcome<GetCredentialReportOutcome>(), this, request);
+}
+
+GetCredentialReportOutcomeCallable IAMClient::GetCredentialReportCallable(GetCredentialReportRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetCredentialReport, Aws::Client::RejectedCallOutcome<GetCredentialReportOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetCredentialReportAsync(const GetCredentialReportRequest& request, const GetCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetCredentialReportAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetCredentialReportAsyncHelper, Aws::Client::RejectedAsyncCall<GetCredentialReportOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetCredentialReportAsync(GetCredentialReportRequest&& request, const GetCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetCredentialReportAsyncHelper, Aws::Client::RejectedAsyncCall<GetCredentialReportOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetCredentialReportAsyncHelper(const GetCredentialReportRequest& request, const GetCredentialReportResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1750,12 +2260,22 @@ GetGroupOutcome IAMClient::GetGroup(const GetGroupRequest& request) const
 
 GetGroupOutcomeCallable IAMClient::GetGroupCallable(const GetGroupRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetGroup, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetGroup, Aws::Client::RejectedCallOutcome<GetGroupOutcome>(), this, request);
+}
+
+GetGroupOutcomeCallable IAMClient::GetGroupCallable(GetGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetGroup, Aws::Client::RejectedCallOutcome<GetGroupOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetGroupAsync(const GetGroupRequest& request, const GetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<GetGroupOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetGroupAsync(GetGroupRequest&& request, const GetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<GetGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetGroupAsyncHelper(const GetGroupRequest& request, const GetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1780,12 +2300,22 @@ GetGroupPolicyOutcome IAMClient::GetGroupPolicy(const GetGroupPolicyRequest& req
 
 GetGroupPolicyOutcomeCallable IAMClient::GetGroupPolicyCallable(const GetGroupPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetGroupPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetGroupPolicy, Aws::Client::RejectedCallOutcome<GetGroupPolicyOutcome>(), this, request);
+}
+
+GetGroupPolicyOutcomeCallable IAMClient::GetGroupPolicyCallable(GetGroupPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetGroupPolicy, Aws::Client::RejectedCallOutcome<GetGroupPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetGroupPolicyAsync(const GetGroupPolicyRequest& request, const GetGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetGroupPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetGroupPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetGroupPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetGroupPolicyAsync(GetGroupPolicyRequest&& request, const GetGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetGroupPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetGroupPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetGroupPolicyAsyncHelper(const GetGroupPolicyRequest& request, const GetGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1810,12 +2340,22 @@ GetInstanceProfileOutcome IAMClient::GetInstanceProfile(const GetInstanceProfile
 
 GetInstanceProfileOutcomeCallable IAMClient::GetInstanceProfileCallable(const GetInstanceProfileRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetInstanceProfile, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetInstanceProfile, Aws::Client::RejectedCallOutcome<GetInstanceProfileOutcome>(), this, request);
+}
+
+GetInstanceProfileOutcomeCallable IAMClient::GetInstanceProfileCallable(GetInstanceProfileRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetInstanceProfile, Aws::Client::RejectedCallOutcome<GetInstanceProfileOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetInstanceProfileAsync(const GetInstanceProfileRequest& request, const GetInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetInstanceProfileAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetInstanceProfileAsyncHelper, Aws::Client::RejectedAsyncCall<GetInstanceProfileOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetInstanceProfileAsync(GetInstanceProfileRequest&& request, const GetInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetInstanceProfileAsyncHelper, Aws::Client::RejectedAsyncCall<GetInstanceProfileOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetInstanceProfileAsyncHelper(const GetInstanceProfileRequest& request, const GetInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1840,12 +2380,22 @@ GetLoginProfileOutcome IAMClient::GetLoginProfile(const GetLoginProfileRequest&
 
 GetLoginProfileOutcomeCallable IAMClient::GetLoginProfileCallable(const GetLoginProfileRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetLoginProfile, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetLoginProfile, Aws::Client::RejectedCallOutcome<GetLoginProfileOutcome>(), this, request);
+}
+
+GetLoginProfileOutcomeCallable IAMClient::GetLoginProfileCallable(GetLoginProfileRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetLoginProfile, Aws::Client::RejectedCallOutcome<GetLoginProfileOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetLoginProfileAsync(const GetLoginProfileRequest& request, const GetLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetLoginProfileAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetLoginProfileAsyncHelper, Aws::Client::RejectedAsyncCall<GetLoginProfileOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetLoginProfileAsync(GetLoginProfileRequest&& request, const GetLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetLoginProfileAsyncHelper, Aws::Client::RejectedAsyncCall<GetLoginProfileOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetLoginProfileAsyncHelper(const GetLoginProfileRequest& request, const GetLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1870,12 +2420,22 @@ GetOpenIDConnectProviderOutcome IAMClient::GetOpenIDConnectProvider(const GetOpe
 
 GetOpenIDConnectProviderOutcomeCallable IAMClient::GetOpenIDConnectProviderCallable(const GetOpenIDConnectProviderRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetOpenIDConnectProvider, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetOpenIDConnectProvider, Aws::Client::RejectedCallOutcome<GetOpenIDConnectProviderOutcome>(), this, request);
+}
+
+GetOpenIDConnectProviderOutcomeCallable IAMClient::GetOpenIDConnectProviderCallable(GetOpenIDConnectProviderRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetOpenIDConnectProvider, Aws::Client::RejectedCallOutcome<GetOpenIDConnectProviderOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetOpenIDConnectProviderAsync(const GetOpenIDConnectProviderRequest& request, const GetOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetOpenIDConnectProviderAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetOpenIDConnectProviderAsyncHelper, Aws::Client::RejectedAsyncCall<GetOpenIDConnectProviderOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetOpenIDConnectProviderAsync(GetOpenIDConnectProviderRequest&& request, const GetOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetOpenIDConnectProviderAsyncHelper, Aws::Client::RejectedAsyncCall<GetOpenIDConnectProviderOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetOpenIDConnectProviderAsyncHelper(const GetOpenIDConnectProviderRequest& request, const GetOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1900,12 +2460,22 @@ GetPolicyOutcome IAMClient::GetPolicy(const GetPolicyRequest& request) const
 
 GetPolicyOutcomeCallable IAMClient::GetPolicyCallable(const GetPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetPolicy, Aws::Client::RejectedCallOutcome<GetPolicyOutcome>(), this, request);
+}
+
+GetPolicyOutcomeCallable IAMClient::GetPolicyCallable(GetPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetPolicy, Aws::Client::RejectedCallOutcome<GetPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetPolicyAsync(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetPolicyAsync(GetPolicyRequest&& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetPolicyAsyncHelper(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1930,12 +2500,22 @@ GetPolicyVersionOutcome IAMClient::GetPolicyVersion(const GetPolicyVersionReques
 
 GetPolicyVersionOutcomeCallable IAMClient::GetPolicyVersionCallable(const GetPolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetPolicyVersion, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetPolicyVersion, Aws::Client::RejectedCallOutcome<GetPolicyVersionOutcome>(), this, request);
+}
+
+GetPolicyVersionOutcomeCallable IAMClient::GetPolicyVersionCallable(GetPolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetPolicyVersion, Aws::Client::RejectedCallOutcome<GetPolicyVersionOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetPolicyVersionAsync(const GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetPolicyVersionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetPolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<GetPolicyVersionOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetPolicyVersionAsync(GetPolicyVersionRequest&& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetPolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<GetPolicyVersionOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetPolicyVersionAsyncHelper(const GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1960,12 +2540,22 @@ GetRoleOutcome IAMClient::GetRole(const GetRoleRequest& request) const
 
 GetRoleOutcomeCallable IAMClient::GetRoleCallable(const GetRoleRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetRole, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetRole, Aws::Client::RejectedCallOutcome<GetRoleOutcome>(), this, request);
+}
+
+GetRoleOutcomeCallable IAMClient::GetRoleCallable(GetRoleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetRole, Aws::Client::RejectedCallOutcome<GetRoleOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetRoleAsync(const GetRoleRequest& request, const GetRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetRoleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetRoleAsyncHelper, Aws::Client::RejectedAsyncCall<GetRoleOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetRoleAsync(GetRoleRequest&& request, const GetRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetRoleAsyncHelper, Aws::Client::RejectedAsyncCall<GetRoleOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetRoleAsyncHelper(const GetRoleRequest& request, const GetRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1990,12 +2580,22 @@ GetRolePolicyOutcome IAMClient::GetRolePolicy(const GetRolePolicyRequest& reques
 
 GetRolePolicyOutcomeCallable IAMClient::GetRolePolicyCallable(const GetRolePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetRolePolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetRolePolicy, Aws::Client::RejectedCallOutcome<GetRolePolicyOutcome>(), this, request);
+}
+
+GetRolePolicyOutcomeCallable IAMClient::GetRolePolicyCallable(GetRolePolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetRolePolicy, Aws::Client::RejectedCallOutcome<GetRolePolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetRolePolicyAsync(const GetRolePolicyRequest& request, const GetRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetRolePolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetRolePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetRolePolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetRolePolicyAsync(GetRolePolicyRequest&& request, const GetRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetRolePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetRolePolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetRolePolicyAsyncHelper(const GetRolePolicyRequest& request, const GetRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2020,12 +2620,22 @@ GetSAMLProviderOutcome IAMClient::GetSAMLProvider(const GetSAMLProviderRequest&
 
 GetSAMLProviderOutcomeCallable IAMClient::GetSAMLProviderCallable(const GetSAMLProviderRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetSAMLProvider, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetSAMLProvider, Aws::Client::RejectedCallOutcome<GetSAMLProviderOutcome>(), this, request);
+}
+
+GetSAMLProviderOutcomeCallable IAMClient::GetSAMLProviderCallable(GetSAMLProviderRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetSAMLProvider, Aws::Client::RejectedCallOutcome<GetSAMLProviderOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetSAMLProviderAsync(const GetSAMLProviderRequest& request, const GetSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetSAMLProviderAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetSAMLProviderAsyncHelper, Aws::Client::RejectedAsyncCall<GetSAMLProviderOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetSAMLProviderAsync(GetSAMLProviderRequest&& request, const GetSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetSAMLProviderAsyncHelper, Aws::Client::RejectedAsyncCall<GetSAMLProviderOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetSAMLProviderAsyncHelper(const GetSAMLProviderRequest& request, const GetSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2050,12 +2660,22 @@ GetSSHPublicKeyOutcome IAMClient::GetSSHPublicKey(const GetSSHPublicKeyRequest&
 
 GetSSHPublicKeyOutcomeCallable IAMClient::GetSSHPublicKeyCallable(const GetSSHPublicKeyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetSSHPublicKey, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetSSHPublicKey, Aws::Client::RejectedCallOutcome<GetSSHPublicKeyOutcome>(), this, request);
+}
+
+GetSSHPublicKeyOutcomeCallable IAMClient::GetSSHPublicKeyCallable(GetSSHPublicKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetSSHPublicKey, Aws::Client::RejectedCallOutcome<GetSSHPublicKeyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetSSHPublicKeyAsync(const GetSSHPublicKeyRequest& request, const GetSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetSSHPublicKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetSSHPublicKeyAsyncHelper, Aws::Client::RejectedAsyncCall<GetSSHPublicKeyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetSSHPublicKeyAsync(GetSSHPublicKeyRequest&& request, const GetSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetSSHPublicKeyAsyncHelper, Aws::Client::RejectedAsyncCall<GetSSHPublicKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetSSHPublicKeyAsyncHelper(const GetSSHPublicKeyRequest& request, const GetSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2080,12 +2700,22 @@ GetServerCertificateOutcome IAMClient::GetServerCertificate(const GetServerCerti
 
 GetServerCertificateOutcomeCallable IAMClient::GetServerCertificateCallable(const GetServerCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetServerCertificate, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetServerCertificate, Aws::Client::RejectedCallOutcome<GetServerCertificateOutcome>(), this, request);
+}
+
+GetServerCertificateOutcomeCallable IAMClient::GetServerCertificateCallable(GetServerCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetServerCertificate, Aws::Client::RejectedCallOutcome<GetServerCertificateOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetServerCertificateAsync(const GetServerCertificateRequest& request, const GetServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetServerCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetServerCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<GetServerCertificateOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetServerCertificateAsync(GetServerCertificateRequest&& request, const GetServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetServerCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<GetServerCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetServerCertificateAsyncHelper(const GetServerCertificateRequest& request, const GetServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2110,12 +2740,22 @@ GetUserOutcome IAMClient::GetUser(const GetUserRequest& request) const
 
 GetUserOutcomeCallable IAMClient::GetUserCallable(const GetUserRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetUser, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetUser, Aws::Client::RejectedCallOutcome<GetUserOutcome>(), this, request);
+}
+
+GetUserOutcomeCallable IAMClient::GetUserCallable(GetUserRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetUser, Aws::Client::RejectedCallOutcome<GetUserOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetUserAsync(const GetUserRequest& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetUserAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetUserAsyncHelper, Aws::Client::RejectedAsyncCall<GetUserOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetUserAsync(GetUserRequest&& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetUserAsyncHelper, Aws::Client::RejectedAsyncCall<GetUserOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetUserAsyncHelper(const GetUserRequest& request, const GetUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2140,12 +2780,22 @@ GetUserPolicyOutcome IAMClient::GetUserPolicy(const GetUserPolicyRequest& reques
 
 GetUserPolicyOutcomeCallable IAMClient::GetUserPolicyCallable(const GetUserPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::GetUserPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::GetUserPolicy, Aws::Client::RejectedCallOutcome<GetUserPolicyOutcome>(), this, request);
+}
+
+GetUserPolicyOutcomeCallable IAMClient::GetUserPolicyCallable(GetUserPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::GetUserPolicy, Aws::Client::RejectedCallOutcome<GetUserPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::GetUserPolicyAsync(const GetUserPolicyRequest& request, const GetUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::GetUserPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::GetUserPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetUserPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::GetUserPolicyAsync(GetUserPolicyRequest&& request, const GetUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::GetUserPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetUserPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::GetUserPolicyAsyncHelper(const GetUserPolicyRequest& request, const GetUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2170,12 +2820,22 @@ ListAccessKeysOutcome IAMClient::ListAccessKeys(const ListAccessKeysRequest& req
 
 ListAccessKeysOutcomeCallable IAMClient::ListAccessKeysCallable(const ListAccessKeysRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListAccessKeys, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListAccessKeys, Aws::Client::RejectedCallOutcome<ListAccessKeysOutcome>(), this, request);
+}
+
+ListAccessKeysOutcomeCallable IAMClient::ListAccessKeysCallable(ListAccessKeysRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListAccessKeys, Aws::Client::RejectedCallOutcome<ListAccessKeysOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListAccessKeysAsync(const ListAccessKeysRequest& request, const ListAccessKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListAccessKeysAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListAccessKeysAsyncHelper, Aws::Client::RejectedAsyncCall<ListAccessKeysOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListAccessKeysAsync(ListAccessKeysRequest&& request, const ListAccessKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListAccessKeysAsyncHelper, Aws::Client::RejectedAsyncCall<ListAccessKeysOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListAccessKeysAsyncHelper(const ListAccessKeysRequest& request, const ListAccessKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2200,12 +2860,22 @@ ListAccountAliasesOutcome IAMClient::ListAccountAliases(const ListAccountAliases
 
 ListAccountAliasesOutcomeCallable IAMClient::ListAccountAliasesCallable(const ListAccountAliasesRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListAccountAliases, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListAccountAliases, Aws::Client::RejectedCallOutcome<ListAccountAliasesOutcome>(), this, request);
+}
+
+ListAccountAliasesOutcomeCallable IAMClient::ListAccountAliasesCallable(ListAccountAliasesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListAccountAliases, Aws::Client::RejectedCallOutcome<ListAccountAliasesOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListAccountAliasesAsync(const ListAccountAliasesRequest& request, const ListAccountAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListAccountAliasesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListAccountAliasesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAccountAliasesOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListAccountAliasesAsync(ListAccountAliasesRequest&& request, const ListAccountAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListAccountAliasesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAccountAliasesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListAccountAliasesAsyncHelper(const ListAccountAliasesRequest& request, const ListAccountAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2230,12 +2900,22 @@ ListAttachedGroupPoliciesOutcome IAMClient::ListAttachedGroupPolicies(const List
 
 ListAttachedGroupPoliciesOutcomeCallable IAMClient::ListAttachedGroupPoliciesCallable(const ListAttachedGroupPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListAttachedGroupPolicies, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListAttachedGroupPolicies, Aws::Client::RejectedCallOutcome<ListAttachedGroupPoliciesOutcome>(), this, request);
+}
+
+ListAttachedGroupPoliciesOutcomeCallable IAMClient::ListAttachedGroupPoliciesCallable(ListAttachedGroupPoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListAttachedGroupPolicies, Aws::Client::RejectedCallOutcome<ListAttachedGroupPoliciesOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListAttachedGroupPoliciesAsync(const ListAttachedGroupPoliciesRequest& request, const ListAttachedGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListAttachedGroupPoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListAttachedGroupPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAttachedGroupPoliciesOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListAttachedGroupPoliciesAsync(ListAttachedGroupPoliciesRequest&& request, const ListAttachedGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListAttachedGroupPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAttachedGroupPoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListAttachedGroupPoliciesAsyncHelper(const ListAttachedGroupPoliciesRequest& request, const ListAttachedGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2260,12 +2940,22 @@ ListAttachedRolePoliciesOutcome IAMClient::ListAttachedRolePolicies(const ListAt
 
 ListAttachedRolePoliciesOutcomeCallable IAMClient::ListAttachedRolePoliciesCallable(const ListAttachedRolePoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListAttachedRolePolicies, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListAttachedRolePolicies, Aws::Client::RejectedCallOutcome<ListAttachedRolePoliciesOutcome>(), this, request);
+}
+
+ListAttachedRolePoliciesOutcomeCallable IAMClient::ListAttachedRolePoliciesCallable(ListAttachedRolePoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListAttachedRolePolicies, Aws::Client::RejectedCallOutcome<ListAttachedRolePoliciesOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListAttachedRolePoliciesAsync(const ListAttachedRolePoliciesRequest& request, const ListAttachedRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListAttachedRolePoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListAttachedRolePoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAttachedRolePoliciesOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListAttachedRolePoliciesAsync(ListAttachedRolePoliciesRequest&& request, const ListAttachedRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListAttachedRolePoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAttachedRolePoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListAttachedRolePoliciesAsyncHelper(const ListAttachedRolePoliciesRequest& request, const ListAttachedRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2290,12 +2980,22 @@ ListAttachedUserPoliciesOutcome IAMClient::ListAttachedUserPolicies(const ListAt
 
 ListAttachedUserPoliciesOutcomeCallable IAMClient::ListAttachedUserPoliciesCallable(const ListAttachedUserPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListAttachedUserPolicies, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListAttachedUserPolicies, Aws::Client::RejectedCallOutcome<ListAttachedUserPoliciesOutcome>(), this, request);
+}
+
+ListAttachedUserPoliciesOutcomeCallable IAMClient::ListAttachedUserPoliciesCallable(ListAttachedUserPoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListAttachedUserPolicies, Aws::Client::RejectedCallOutcome<ListAttachedUserPoliciesOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListAttachedUserPoliciesAsync(const ListAttachedUserPoliciesRequest& request, const ListAttachedUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListAttachedUserPoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListAttachedUserPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAttachedUserPoliciesOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListAttachedUserPoliciesAsync(ListAttachedUserPoliciesRequest&& request, const ListAttachedUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListAttachedUserPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAttachedUserPoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListAttachedUserPoliciesAsyncHelper(const ListAttachedUserPoliciesRequest& request, const ListAttachedUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2318,14 +3018,24 @@ ListEntitiesForPolicyOutcome IAMClient::ListEntitiesForPolicy(const ListEntities
   }
 }
 
-ListEntitiesForPolicyOutcomeCallable IAMClient::ListEntitiesForPolicyCallable(const ListEntitiesForPolicyRequest& request) const
+ListEntitiesForPolicyOutcomeCallable IAMClient::ListEntitiesForPolicyCallable(const ListEntitiesForPolicyRequest& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListEntitiesForPolicy, Aws::Client::RejectedCallOutcome<ListEntitiesForPolicyOutcome>(), this, request);
+}
+
+ListEntitiesForPolicyOutcomeCallable IAMClient::ListEntitiesForPolicyCallable(ListEntitiesForPolicyRequest&& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListEntitiesForPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListEntitiesForPolicy, Aws::Client::RejectedCallOutcome<ListEntitiesForPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListEntitiesForPolicyAsync(const ListEntitiesForPolicyRequest& request, const ListEntitiesForPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListEntitiesForPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListEntitiesForPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<ListEntitiesForPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListEntitiesForPolicyAsync(ListEntitiesForPolicyRequest&& request, const ListEntitiesForPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListEntitiesForPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<ListEntitiesForPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListEntitiesForPolicyAsyncHelper(const ListEntitiesForPolicyRequest& request, const ListEntitiesForPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2350,12 +3060,22 @@ ListGroupPoliciesOutcome IAMClient::ListGroupPolicies(const ListGroupPoliciesReq
 
 ListGroupPoliciesOutcomeCallable IAMClient::ListGroupPoliciesCallable(const ListGroupPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListGroupPolicies, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListGroupPolicies, Aws::Client::RejectedCallOutcome<ListGroupPoliciesOutcome>(), this, request);
+}
+
+ListGroupPoliciesOutcomeCallable IAMClient::ListGroupPoliciesCallable(ListGroupPoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListGroupPolicies, Aws::Client::RejectedCallOutcome<ListGroupPoliciesOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListGroupPoliciesAsync(const ListGroupPoliciesRequest& request, const ListGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListGroupPoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListGroupPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListGroupPoliciesOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListGroupPoliciesAsync(ListGroupPoliciesRequest&& request, const ListGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListGroupPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListGroupPoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListGroupPoliciesAsyncHelper(const ListGroupPoliciesRequest& request, const ListGroupPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2380,12 +3100,22 @@ ListGroupsOutcome IAMClient::ListGroups(const ListGroupsRequest& request) const
 
 ListGroupsOutcomeCallable IAMClient::ListGroupsCallable(const ListGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListGroups, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListGroups, Aws::Client::RejectedCallOutcome<ListGroupsOutcome>(), this, request);
+}
+
+ListGroupsOutcomeCallable IAMClient::ListGroupsCallable(ListGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListGroups, Aws::Client::RejectedCallOutcome<ListGroupsOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListGroupsAsync(const ListGroupsRequest& request, const ListGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<ListGroupsOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListGroupsAsync(ListGroupsRequest&& request, const ListGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<ListGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListGroupsAsyncHelper(const ListGroupsRequest& request, const ListGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2410,12 +3140,22 @@ ListGroupsForUserOutcome IAMClient::ListGroupsForUser(const ListGroupsForUserReq
 
 ListGroupsForUserOutcomeCallable IAMClient::ListGroupsForUserCallable(const ListGroupsForUserRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListGroupsForUser, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListGroupsForUser, Aws::Client::RejectedCallOutcome<ListGroupsForUserOutcome>(), this, request);
+}
+
+ListGroupsForUserOutcomeCallable IAMClient::ListGroupsForUserCallable(ListGroupsForUserRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListGroupsForUser, Aws::Client::RejectedCallOutcome<ListGroupsForUserOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListGroupsForUserAsync(const ListGroupsForUserRequest& request, const ListGroupsForUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListGroupsForUserAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListGroupsForUserAsyncHelper, Aws::Client::RejectedAsyncCall<ListGroupsForUserOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListGroupsForUserAsync(ListGroupsForUserRequest&& request, const ListGroupsForUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListGroupsForUserAsyncHelper, Aws::Client::RejectedAsyncCall<ListGroupsForUserOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListGroupsForUserAsyncHelper(const ListGroupsForUserRequest& request, const ListGroupsForUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2440,12 +3180,22 @@ ListInstanceProfilesOutcome IAMClient::ListInstanceProfiles(const ListInstancePr
 
 ListInstanceProfilesOutcomeCallable IAMClient::ListInstanceProfilesCallable(const ListInstanceProfilesRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListInstanceProfiles, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListInstanceProfiles, Aws::Client::RejectedCallOutcome<ListInstanceProfilesOutcome>(), this, request);
+}
+
+ListInstanceProfilesOutcomeCallable IAMClient::ListInstanceProfilesCallable(ListInstanceProfilesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListInstanceProfiles, Aws::Client::RejectedCallOutcome<ListInstanceProfilesOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListInstanceProfilesAsync(const ListInstanceProfilesRequest& request, const ListInstanceProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListInstanceProfilesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListInstanceProfilesAsyncHelper, Aws::Client::RejectedAsyncCall<ListInstanceProfilesOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListInstanceProfilesAsync(ListInstanceProfilesRequest&& request, const ListInstanceProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListInstanceProfilesAsyncHelper, Aws::Client::RejectedAsyncCall<ListInstanceProfilesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListInstanceProfilesAsyncHelper(const ListInstanceProfilesRequest& request, const ListInstanceProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2470,12 +3220,22 @@ ListInstanceProfilesForRoleOutcome IAMClient::ListInstanceProfilesForRole(const
 
 ListInstanceProfilesForRoleOutcomeCallable IAMClient::ListInstanceProfilesForRoleCallable(const ListInstanceProfilesForRoleRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListInstanceProfilesForRole, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListInstanceProfilesForRole, Aws::Client::RejectedCallOutcome<ListInstanceProfilesForRoleOutcome>(), this, request);
+}
+
+ListInstanceProfilesForRoleOutcomeCallable IAMClient::ListInstanceProfilesForRoleCallable(ListInstanceProfilesForRoleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListInstanceProfilesForRole, Aws::Client::RejectedCallOutcome<ListInstanceProfilesForRoleOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListInstanceProfilesForRoleAsync(const ListInstanceProfilesForRoleRequest& request, const ListInstanceProfilesForRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListInstanceProfilesForRoleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListInstanceProfilesForRoleAsyncHelper, Aws::Client::RejectedAsyncCall<ListInstanceProfilesForRoleOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListInstanceProfilesForRoleAsync(ListInstanceProfilesForRoleRequest&& request, const ListInstanceProfilesForRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListInstanceProfilesForRoleAsyncHelper, Aws::Client::RejectedAsyncCall<ListInstanceProfilesForRoleOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListInstanceProfilesForRoleAsyncHelper(const ListInstanceProfilesForRoleRequest& request, const ListInstanceProfilesForRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2500,12 +3260,22 @@ ListMFADevicesOutcome IAMClient::ListMFADevices(const ListMFADevicesRequest& req
 
 ListMFADevicesOutcomeCallable IAMClient::ListMFADevicesCallable(const ListMFADevicesRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListMFADevices, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListMFADevices, Aws::Client::RejectedCallOutcome<ListMFADevicesOutcome>(), this, request);
+}
+
+ListMFADevicesOutcomeCallable IAMClient::ListMFADevicesCallable(ListMFADevicesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListMFADevices, Aws::Client::RejectedCallOutcome<ListMFADevicesOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListMFADevicesAsync(const ListMFADevicesRequest& request, const ListMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListMFADevicesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListMFADevicesAsyncHelper, Aws::Client::RejectedAsyncCall<ListMFADevicesOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListMFADevicesAsync(ListMFADevicesRequest&& request, const ListMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListMFADevicesAsyncHelper, Aws::Client::RejectedAsyncCall<ListMFADevicesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListMFADevicesAsyncHelper(const ListMFADevicesRequest& request, const ListMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2530,12 +3300,22 @@ ListOpenIDConnectProvidersOutcome IAMClient::ListOpenIDConnectProviders(const Li
 
 ListOpenIDConnectProvidersOutcomeCallable IAMClient::ListOpenIDConnectProvidersCallable(const ListOpenIDConnectProvidersRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListOpenIDConnectProviders, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListOpenIDConnectProviders, Aws::Client::RejectedCallOutcome<ListOpenIDConnectProvidersOutcome>(), this, request);
+}
+
+ListOpenIDConnectProvidersOutcomeCallable IAMClient::ListOpenIDConnectProvidersCallable(ListOpenIDConnectProvidersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListOpenIDConnectProviders, Aws::Client::RejectedCallOutcome<ListOpenIDConnectProvidersOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListOpenIDConnectProvidersAsync(const ListOpenIDConnectProvidersRequest& request, const ListOpenIDConnectProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListOpenIDConnectProvidersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListOpenIDConnectProvidersAsyncHelper, Aws::Client::RejectedAsyncCall<ListOpenIDConnectProvidersOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListOpenIDConnectProvidersAsync(ListOpenIDConnectProvidersRequest&& request, const ListOpenIDConnectProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListOpenIDConnectProvidersAsyncHelper, Aws::Client::RejectedAsyncCall<ListOpenIDConnectProvidersOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListOpenIDConnectProvidersAsyncHelper(const ListOpenIDConnectProvidersRequest& request, const ListOpenIDConnectProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2560,12 +3340,22 @@ ListPoliciesOutcome IAMClient::ListPolicies(const ListPoliciesRequest& request)
 
 ListPoliciesOutcomeCallable IAMClient::ListPoliciesCallable(const ListPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListPolicies, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListPolicies, Aws::Client::RejectedCallOutcome<ListPoliciesOutcome>(), this, request);
+}
+
+ListPoliciesOutcomeCallable IAMClient::ListPoliciesCallable(ListPoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListPolicies, Aws::Client::RejectedCallOutcome<ListPoliciesOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListPoliciesAsync(const ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListPoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListPoliciesOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListPoliciesAsync(ListPoliciesRequest&& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListPoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListPoliciesAsyncHelper(const ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2590,12 +3380,22 @@ ListPolicyVersionsOutcome IAMClient::ListPolicyVersions(const ListPolicyVersions
 
 ListPolicyVersionsOutcomeCallable IAMClient::ListPolicyVersionsCallable(const ListPolicyVersionsRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListPolicyVersions, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListPolicyVersions, Aws::Client::RejectedCallOutcome<ListPolicyVersionsOutcome>(), this, request);
+}
+
+ListPolicyVersionsOutcomeCallable IAMClient::ListPolicyVersionsCallable(ListPolicyVersionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListPolicyVersions, Aws::Client::RejectedCallOutcome<ListPolicyVersionsOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListPolicyVersionsAsync(const ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListPolicyVersionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListPolicyVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListPolicyVersionsOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListPolicyVersionsAsync(ListPolicyVersionsRequest&& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListPolicyVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListPolicyVersionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListPolicyVersionsAsyncHelper(const ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2620,12 +3420,22 @@ ListRolePoliciesOutcome IAMClient::ListRolePolicies(const ListRolePoliciesReques
 
 ListRolePoliciesOutcomeCallable IAMClient::ListRolePoliciesCallable(const ListRolePoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListRolePolicies, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListRolePolicies, Aws::Client::RejectedCallOutcome<ListRolePoliciesOutcome>(), this, request);
+}
+
+ListRolePoliciesOutcomeCallable IAMClient::ListRolePoliciesCallable(ListRolePoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListRolePolicies, Aws::Client::RejectedCallOutcome<ListRolePoliciesOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListRolePoliciesAsync(const ListRolePoliciesRequest& request, const ListRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListRolePoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListRolePoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListRolePoliciesOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListRolePoliciesAsync(ListRolePoliciesRequest&& request, const ListRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListRolePoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListRolePoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListRolePoliciesAsyncHelper(const ListRolePoliciesRequest& request, const ListRolePoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2650,12 +3460,22 @@ ListRolesOutcome IAMClient::ListRoles(const ListRolesRequest& request) const
 
 ListRolesOutcomeCallable IAMClient::ListRolesCallable(const ListRolesRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListRoles, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListRoles, Aws::Client::RejectedCallOutcome<ListRolesOutcome>(), this, request);
+}
+
+ListRolesOutcomeCallable IAMClient::ListRolesCallable(ListRolesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListRoles, Aws::Client::RejectedCallOutcome<ListRolesOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListRolesAsync(const ListRolesRequest& request, const ListRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListRolesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListRolesAsyncHelper, Aws::Client::RejectedAsyncCall<ListRolesOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListRolesAsync(ListRolesRequest&& request, const ListRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListRolesAsyncHelper, Aws::Client::RejectedAsyncCall<ListRolesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListRolesAsyncHelper(const ListRolesRequest& request, const ListRolesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2680,12 +3500,22 @@ ListSAMLProvidersOutcome IAMClient::ListSAMLProviders(const ListSAMLProvidersReq
 
 ListSAMLProvidersOutcomeCallable IAMClient::ListSAMLProvidersCallable(const ListSAMLProvidersRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListSAMLProviders, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListSAMLProviders, Aws::Client::RejectedCallOutcome<ListSAMLProvidersOutcome>(), this, request);
+}
+
+ListSAMLProvidersOutcomeCallable IAMClient::ListSAMLProvidersCallable(ListSAMLProvidersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListSAMLProviders, Aws::Client::RejectedCallOutcome<ListSAMLProvidersOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListSAMLProvidersAsync(const ListSAMLProvidersRequest& request, const ListSAMLProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListSAMLProvidersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListSAMLProvidersAsyncHelper, Aws::Client::RejectedAsyncCall<ListSAMLProvidersOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListSAMLProvidersAsync(ListSAMLProvidersRequest&& request, const ListSAMLProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListSAMLProvidersAsyncHelper, Aws::Client::RejectedAsyncCall<ListSAMLProvidersOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListSAMLProvidersAsyncHelper(const ListSAMLProvidersRequest& request, const ListSAMLProvidersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2710,12 +3540,22 @@ ListSSHPublicKeysOutcome IAMClient::ListSSHPublicKeys(const ListSSHPublicKeysReq
 
 ListSSHPublicKeysOutcomeCallable IAMClient::ListSSHPublicKeysCallable(const ListSSHPublicKeysRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListSSHPublicKeys, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListSSHPublicKeys, Aws::Client::RejectedCallOutcome<ListSSHPublicKeysOutcome>(), this, request);
+}
+
+ListSSHPublicKeysOutcomeCallable IAMClient::ListSSHPublicKeysCallable(ListSSHPublicKeysRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListSSHPublicKeys, Aws::Client::RejectedCallOutcome<ListSSHPublicKeysOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListSSHPublicKeysAsync(const ListSSHPublicKeysRequest& request, const ListSSHPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListSSHPublicKeysAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListSSHPublicKeysAsyncHelper, Aws::Client::RejectedAsyncCall<ListSSHPublicKeysOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListSSHPublicKeysAsync(ListSSHPublicKeysRequest&& request, const ListSSHPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListSSHPublicKeysAsyncHelper, Aws::Client::RejectedAsyncCall<ListSSHPublicKeysOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListSSHPublicKeysAsyncHelper(const ListSSHPublicKeysRequest& request, const ListSSHPublicKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2740,12 +3580,22 @@ ListServerCertificatesOutcome IAMClient::ListServerCertificates(const ListServer
 
 ListServerCertificatesOutcomeCallable IAMClient::ListServerCertificatesCallable(const ListServerCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListServerCertificates, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListServerCertificates, Aws::Client::RejectedCallOutcome<ListServerCertificatesOutcome>(), this, request);
+}
+
+ListServerCertificatesOutcomeCallable IAMClient::ListServerCertificatesCallable(ListServerCertificatesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListServerCertificates, Aws::Client::RejectedCallOutcome<ListServerCertificatesOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListServerCertificatesAsync(const ListServerCertificatesRequest& request, const ListServerCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListServerCertificatesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListServerCertificatesAsyncHelper, Aws::Client::RejectedAsyncCall<ListServerCertificatesOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListServerCertificatesAsync(ListServerCertificatesRequest&& request, const ListServerCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListServerCertificatesAsyncHelper, Aws::Client::RejectedAsyncCall<ListServerCertificatesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListServerCertificatesAsyncHelper(const ListServerCertificatesRequest& request, const ListServerCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2770,12 +3620,22 @@ ListSigningCertificatesOutcome IAMClient::ListSigningCertificates(const ListSign
 
 ListSigningCertificatesOutcomeCallable IAMClient::ListSigningCertificatesCallable(const ListSigningCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListSigningCertificates, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListSigningCertificates, Aws::Client::RejectedCallOutcome<ListSigningCertificatesOutcome>(), this, request);
+}
+
+ListSigningCertificatesOutcomeCallable IAMClient::ListSigningCertificatesCallable(ListSigningCertificatesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListSigningCertificates, Aws::Client::RejectedCallOutcome<ListSigningCertificatesOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListSigningCertificatesAsync(const ListSigningCertificatesRequest& request, const ListSigningCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListSigningCertificatesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListSigningCertificatesAsyncHelper, Aws::Client::RejectedAsyncCall<ListSigningCertificatesOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListSigningCertificatesAsync(ListSigningCertificatesRequest&& request, const ListSigningCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListSigningCertificatesAsyncHelper, Aws::Client::RejectedAsyncCall<ListSigningCertificatesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListSigningCertificatesAsyncHelper(const ListSigningCertificatesRequest& request, const ListSigningCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2800,12 +3660,22 @@ ListUserPoliciesOutcome IAMClient::ListUserPolicies(const ListUserPoliciesReques
 
 ListUserPoliciesOutcomeCallable IAMClient::ListUserPoliciesCallable(const ListUserPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListUserPolicies, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListUserPolicies, Aws::Client::RejectedCallOutcome<ListUserPoliciesOutcome>(), this, request);
+}
+
+ListUserPoliciesOutcomeCallable IAMClient::ListUserPoliciesCallable(ListUserPoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListUserPolicies, Aws::Client::RejectedCallOutcome<ListUserPoliciesOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListUserPoliciesAsync(const ListUserPoliciesRequest& request, const ListUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListUserPoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListUserPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListUserPoliciesOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListUserPoliciesAsync(ListUserPoliciesRequest&& request, const ListUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListUserPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListUserPoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListUserPoliciesAsyncHelper(const ListUserPoliciesRequest& request, const ListUserPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2830,12 +3700,22 @@ ListUsersOutcome IAMClient::ListUsers(const ListUsersRequest& request) const
 
 ListUsersOutcomeCallable IAMClient::ListUsersCallable(const ListUsersRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListUsers, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListUsers, Aws::Client::RejectedCallOutcome<ListUsersOutcome>(), this, request);
+}
+
+ListUsersOutcomeCallable IAMClient::ListUsersCallable(ListUsersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListUsers, Aws::Client::RejectedCallOutcome<ListUsersOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListUsersAsync(const ListUsersRequest& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListUsersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListUsersAsyncHelper, Aws::Client::RejectedAsyncCall<ListUsersOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListUsersAsync(ListUsersRequest&& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListUsersAsyncHelper, Aws::Client::RejectedAsyncCall<ListUsersOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListUsersAsyncHelper(const ListUsersRequest& request, const ListUsersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2860,12 +3740,22 @@ ListVirtualMFADevicesOutcome IAMClient::ListVirtualMFADevices(const ListVirtualM
 
 ListVirtualMFADevicesOutcomeCallable IAMClient::ListVirtualMFADevicesCallable(const ListVirtualMFADevicesRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ListVirtualMFADevices, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ListVirtualMFADevices, Aws::Client::RejectedCallOutcome<ListVirtualMFADevicesOutcome>(), this, request);
+}
+
+ListVirtualMFADevicesOutcomeCallable IAMClient::ListVirtualMFADevicesCallable(ListVirtualMFADevicesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ListVirtualMFADevices, Aws::Client::RejectedCallOutcome<ListVirtualMFADevicesOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ListVirtualMFADevicesAsync(const ListVirtualMFADevicesRequest& request, const ListVirtualMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ListVirtualMFADevicesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ListVirtualMFADevicesAsyncHelper, Aws::Client::RejectedAsyncCall<ListVirtualMFADevicesOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ListVirtualMFADevicesAsync(ListVirtualMFADevicesRequest&& request, const ListVirtualMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ListVirtualMFADevicesAsyncHelper, Aws::Client::RejectedAsyncCall<ListVirtualMFADevicesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ListVirtualMFADevicesAsyncHelper(const ListVirtualMFADevicesRequest& request, const ListVirtualMFADevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2890,12 +3780,22 @@ PutGroupPolicyOutcome IAMClient::PutGroupPolicy(const PutGroupPolicyRequest& req
 
 PutGroupPolicyOutcomeCallable IAMClient::PutGroupPolicyCallable(const PutGroupPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::PutGroupPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::PutGroupPolicy, Aws::Client::RejectedCallOutcome<PutGroupPolicyOutcome>(), this, request);
+}
+
+PutGroupPolicyOutcomeCallable IAMClient::PutGroupPolicyCallable(PutGroupPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::PutGroupPolicy, Aws::Client::RejectedCallOutcome<PutGroupPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::PutGroupPolicyAsync(const PutGroupPolicyRequest& request, const PutGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::PutGroupPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::PutGroupPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutGroupPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::PutGroupPolicyAsync(PutGroupPolicyRequest&& request, const PutGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::PutGroupPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutGroupPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::PutGroupPolicyAsyncHelper(const PutGroupPolicyRequest& request, const PutGroupPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2920,12 +3820,22 @@ PutRolePolicyOutcome IAMClient::PutRolePolicy(const PutRolePolicyRequest& reques
 
 PutRolePolicyOutcomeCallable IAMClient::PutRolePolicyCallable(const PutRolePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::PutRolePolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::PutRolePolicy, Aws::Client::RejectedCallOutcome<PutRolePolicyOutcome>(), this, request);
+}
+
+PutRolePolicyOutcomeCallable IAMClient::PutRolePolicyCallable(PutRolePolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::PutRolePolicy, Aws::Client::RejectedCallOutcome<PutRolePolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::PutRolePolicyAsync(const PutRolePolicyRequest& request, const PutRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::PutRolePolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::PutRolePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutRolePolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::PutRolePolicyAsync(PutRolePolicyRequest&& request, const PutRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::PutRolePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutRolePolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::PutRolePolicyAsyncHelper(const PutRolePolicyRequest& request, const PutRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2950,12 +3860,22 @@ PutUserPolicyOutcome IAMClient::PutUserPolicy(const PutUserPolicyRequest& reques
 
 PutUserPolicyOutcomeCallable IAMClient::PutUserPolicyCallable(const PutUserPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::PutUserPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::PutUserPolicy, Aws::Client::RejectedCallOutcome<PutUserPolicyOutcome>(), this, request);
+}
+
+PutUserPolicyOutcomeCallable IAMClient::PutUserPolicyCallable(PutUserPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::PutUserPolicy, Aws::Client::RejectedCallOutcome<PutUserPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::PutUserPolicyAsync(const PutUserPolicyRequest& request, const PutUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::PutUserPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::PutUserPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutUserPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::PutUserPolicyAsync(PutUserPolicyRequest&& request, const PutUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::PutUserPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutUserPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::PutUserPolicyAsyncHelper(const PutUserPolicyRequest& request, const PutUserPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2980,12 +3900,22 @@ RemoveClientIDFromOpenIDConnectProviderOutcome IAMClient::RemoveClientIDFromOpen
 
 RemoveClientIDFromOpenIDConnectProviderOutcomeCallable IAMClient::RemoveClientIDFromOpenIDConnectProviderCallable(const RemoveClientIDFromOpenIDConnectProviderRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::RemoveClientIDFromOpenIDConnectProvider, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::RemoveClientIDFromOpenIDConnectProvider, Aws::Client::RejectedCallOutcome<RemoveClientIDFromOpenIDConnectProviderOutcome>(), this, request);
+}
+
+RemoveClientIDFromOpenIDConnectProviderOutcomeCallable IAMClient::RemoveClientIDFromOpenIDConnectProviderCallable(RemoveClientIDFromOpenIDConnectProviderRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::RemoveClientIDFromOpenIDConnectProvider, Aws::Client::RejectedCallOutcome<RemoveClientIDFromOpenIDConnectProviderOutcome>(), this, std::move(request));
 }
 
 void IAMClient::RemoveClientIDFromOpenIDConnectProviderAsync(const RemoveClientIDFromOpenIDConnectProviderRequest& request, const RemoveClientIDFromOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::RemoveClientIDFromOpenIDConnectProviderAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::RemoveClientIDFromOpenIDConnectProviderAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveClientIDFromOpenIDConnectProviderOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::RemoveClientIDFromOpenIDConnectProviderAsync(RemoveClientIDFromOpenIDConnectProviderRequest&& request, const RemoveClientIDFromOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::RemoveClientIDFromOpenIDConnectProviderAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveClientIDFromOpenIDConnectProviderOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::RemoveClientIDFromOpenIDConnectProviderAsyncHelper(const RemoveClientIDFromOpenIDConnectProviderRequest& request, const RemoveClientIDFromOpenIDConnectProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3010,12 +3940,22 @@ RemoveRoleFromInstanceProfileOutcome IAMClient::RemoveRoleFromInstanceProfile(co
 
 RemoveRoleFromInstanceProfileOutcomeCallable IAMClient::RemoveRoleFromInstanceProfileCallable(const RemoveRoleFromInstanceProfileRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::RemoveRoleFromInstanceProfile, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::RemoveRoleFromInstanceProfile, Aws::Client::RejectedCallOutcome<RemoveRoleFromInstanceProfileOutcome>(), this, request);
+}
+
+RemoveRoleFromInstanceProfileOutcomeCallable IAMClient::RemoveRoleFromInstanceProfileCallable(RemoveRoleFromInstanceProfileRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::RemoveRoleFromInstanceProfile, Aws::Client::RejectedCallOutcome<RemoveRoleFromInstanceProfileOutcome>(), this, std::move(request));
 }
 
 void IAMClient::RemoveRoleFromInstanceProfileAsync(const RemoveRoleFromInstanceProfileRequest& request, const RemoveRoleFromInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::RemoveRoleFromInstanceProfileAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::RemoveRoleFromInstanceProfileAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveRoleFromInstanceProfileOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::RemoveRoleFromInstanceProfileAsync(RemoveRoleFromInstanceProfileRequest&& request, const RemoveRoleFromInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::RemoveRoleFromInstanceProfileAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveRoleFromInstanceProfileOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::RemoveRoleFromInstanceProfileAsyncHelper(const RemoveRoleFromInstanceProfileRequest& request, const RemoveRoleFromInstanceProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3040,12 +3980,22 @@ RemoveUserFromGroupOutcome IAMClient::RemoveUserFromGroup(const RemoveUserFromGr
 
 RemoveUserFromGroupOutcomeCallable IAMClient::RemoveUserFromGroupCallable(const RemoveUserFromGroupRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::RemoveUserFromGroup, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::RemoveUserFromGroup, Aws::Client::RejectedCallOutcome<RemoveUserFromGroupOutcome>(), this, request);
+}
+
+RemoveUserFromGroupOutcomeCallable IAMClient::RemoveUserFromGroupCallable(RemoveUserFromGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::RemoveUserFromGroup, Aws::Client::RejectedCallOutcome<RemoveUserFromGroupOutcome>(), this, std::move(request));
 }
 
 void IAMClient::RemoveUserFromGroupAsync(const RemoveUserFromGroupRequest& request, const RemoveUserFromGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::RemoveUserFromGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::RemoveUserFromGroupAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveUserFromGroupOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::RemoveUserFromGroupAsync(RemoveUserFromGroupRequest&& request, const RemoveUserFromGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::RemoveUserFromGroupAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveUserFromGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::RemoveUserFromGroupAsyncHelper(const RemoveUserFromGroupRequest& request, const RemoveUserFromGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3070,12 +4020,22 @@ ResyncMFADeviceOutcome IAMClient::ResyncMFADevice(const ResyncMFADeviceRequest&
 
 ResyncMFADeviceOutcomeCallable IAMClient::ResyncMFADeviceCallable(const ResyncMFADeviceRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::ResyncMFADevice, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::ResyncMFADevice, Aws::Client::RejectedCallOutcome<ResyncMFADeviceOutcome>(), this, request);
+}
+
+ResyncMFADeviceOutcomeCallable IAMClient::ResyncMFADeviceCallable(ResyncMFADeviceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::ResyncMFADevice, Aws::Client::RejectedCallOutcome<ResyncMFADeviceOutcome>(), this, std::move(request));
 }
 
 void IAMClient::ResyncMFADeviceAsync(const ResyncMFADeviceRequest& request, const ResyncMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::ResyncMFADeviceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::ResyncMFADeviceAsyncHelper, Aws::Client::RejectedAsyncCall<ResyncMFADeviceOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::ResyncMFADeviceAsync(ResyncMFADeviceRequest&& request, const ResyncMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::ResyncMFADeviceAsyncHelper, Aws::Client::RejectedAsyncCall<ResyncMFADeviceOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::ResyncMFADeviceAsyncHelper(const ResyncMFADeviceRequest& request, const ResyncMFADeviceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3100,12 +4060,22 @@ SetDefaultPolicyVersionOutcome IAMClient::SetDefaultPolicyVersion(const SetDefau
 
 SetDefaultPolicyVersionOutcomeCallable IAMClient::SetDefaultPolicyVersionCallable(const SetDefaultPolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::SetDefaultPolicyVersion, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::SetDefaultPolicyVersion, Aws::Client::RejectedCallOutcome<SetDefaultPolicyVersionOutcome>(), this, request);
+}
+
+SetDefaultPolicyVersionOutcomeCallable IAMClient::SetDefaultPolicyVersionCallable(SetDefaultPolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::SetDefaultPolicyVersion, Aws::Client::RejectedCallOutcome<SetDefaultPolicyVersionOutcome>(), this, std::move(request));
 }
 
 void IAMClient::SetDefaultPolicyVersionAsync(const SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::SetDefaultPolicyVersionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::SetDefaultPolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<SetDefaultPolicyVersionOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::SetDefaultPolicyVersionAsync(SetDefaultPolicyVersionRequest&& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::SetDefaultPolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<SetDefaultPolicyVersionOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::SetDefaultPolicyVersionAsyncHelper(const SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3130,12 +4100,22 @@ SimulateCustomPolicyOutcome IAMClient::SimulateCustomPolicy(const SimulateCustom
 
 SimulateCustomPolicyOutcomeCallable IAMClient::SimulateCustomPolicyCallable(const SimulateCustomPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::SimulateCustomPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::SimulateCustomPolicy, Aws::Client::RejectedCallOutcome<SimulateCustomPolicyOutcome>(), this, request);
+}
+
+SimulateCustomPolicyOutcomeCallable IAMClient::SimulateCustomPolicyCallable(SimulateCustomPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::SimulateCustomPolicy, Aws::Client::RejectedCallOutcome<SimulateCustomPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::SimulateCustomPolicyAsync(const SimulateCustomPolicyRequest& request, const SimulateCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::SimulateCustomPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::SimulateCustomPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<SimulateCustomPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::SimulateCustomPolicyAsync(SimulateCustomPolicyRequest&& request, const SimulateCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::SimulateCustomPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<SimulateCustomPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::SimulateCustomPolicyAsyncHelper(const SimulateCustomPolicyRequest& request, const SimulateCustomPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3160,12 +4140,22 @@ SimulatePrincipalPolicyOutcome IAMClient::SimulatePrincipalPolicy(const Simulate
 
 SimulatePrincipalPolicyOutcomeCallable IAMClient::SimulatePrincipalPolicyCallable(const SimulatePrincipalPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::SimulatePrincipalPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::SimulatePrincipalPolicy, Aws::Client::RejectedCallOutcome<SimulatePrincipalPolicyOutcome>(), this, request);
+}
+
+SimulatePrincipalPolicyOutcomeCallable IAMClient::SimulatePrincipalPolicyCallable(SimulatePrincipalPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::SimulatePrincipalPolicy, Aws::Client::RejectedCallOutcome<SimulatePrincipalPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::SimulatePrincipalPolicyAsync(const SimulatePrincipalPolicyRequest& request, const SimulatePrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::SimulatePrincipalPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::SimulatePrincipalPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<SimulatePrincipalPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::SimulatePrincipalPolicyAsync(SimulatePrincipalPolicyRequest&& request, const SimulatePrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::SimulatePrincipalPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<SimulatePrincipalPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::SimulatePrincipalPolicyAsyncHelper(const SimulatePrincipalPolicyRequest& request, const SimulatePrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3190,12 +4180,22 @@ UpdateAccessKeyOutcome IAMClient::UpdateAccessKey(const UpdateAccessKeyRequest&
 
 UpdateAccessKeyOutcomeCallable IAMClient::UpdateAccessKeyCallable(const UpdateAccessKeyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::UpdateAccessKey, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateAccessKey, Aws::Client::RejectedCallOutcome<UpdateAccessKeyOutcome>(), this, request);
+}
+
+UpdateAccessKeyOutcomeCallable IAMClient::UpdateAccessKeyCallable(UpdateAccessKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateAccessKey, Aws::Client::RejectedCallOutcome<UpdateAccessKeyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::UpdateAccessKeyAsync(const UpdateAccessKeyRequest& request, const UpdateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::UpdateAccessKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::UpdateAccessKeyAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAccessKeyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::UpdateAccessKeyAsync(UpdateAccessKeyRequest&& request, const UpdateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::UpdateAccessKeyAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAccessKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::UpdateAccessKeyAsyncHelper(const UpdateAccessKeyRequest& request, const UpdateAccessKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3220,12 +4220,22 @@ UpdateAccountPasswordPolicyOutcome IAMClient::UpdateAccountPasswordPolicy(const
 
 UpdateAccountPasswordPolicyOutcomeCallable IAMClient::UpdateAccountPasswordPolicyCallable(const UpdateAccountPasswordPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::UpdateAccountPasswordPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateAccountPasswordPolicy, Aws::Client::RejectedCallOutcome<UpdateAccountPasswordPolicyOutcome>(), this, request);
+}
+
+UpdateAccountPasswordPolicyOutcomeCallable IAMClient::UpdateAccountPasswordPolicyCallable(UpdateAccountPasswordPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateAccountPasswordPolicy, Aws::Client::RejectedCallOutcome<UpdateAccountPasswordPolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::UpdateAccountPasswordPolicyAsync(const UpdateAccountPasswordPolicyRequest& request, const UpdateAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::UpdateAccountPasswordPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::UpdateAccountPasswordPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAccountPasswordPolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::UpdateAccountPasswordPolicyAsync(UpdateAccountPasswordPolicyRequest&& request, const UpdateAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::UpdateAccountPasswordPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAccountPasswordPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::UpdateAccountPasswordPolicyAsyncHelper(const UpdateAccountPasswordPolicyRequest& request, const UpdateAccountPasswordPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3250,12 +4260,22 @@ UpdateAssumeRolePolicyOutcome IAMClient::UpdateAssumeRolePolicy(const UpdateAssu
 
 UpdateAssumeRolePolicyOutcomeCallable IAMClient::UpdateAssumeRolePolicyCallable(const UpdateAssumeRolePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::UpdateAssumeRolePolicy, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateAssumeRolePolicy, Aws::Client::RejectedCallOutcome<UpdateAssumeRolePolicyOutcome>(), this, request);
+}
+
+UpdateAssumeRolePolicyOutcomeCallable IAMClient::UpdateAssumeRolePolicyCallable(UpdateAssumeRolePolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateAssumeRolePolicy, Aws::Client::RejectedCallOutcome<UpdateAssumeRolePolicyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::UpdateAssumeRolePolicyAsync(const UpdateAssumeRolePolicyRequest& request, const UpdateAssumeRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::UpdateAssumeRolePolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::UpdateAssumeRolePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAssumeRolePolicyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::UpdateAssumeRolePolicyAsync(UpdateAssumeRolePolicyRequest&& request, const UpdateAssumeRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::UpdateAssumeRolePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAssumeRolePolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::UpdateAssumeRolePolicyAsyncHelper(const UpdateAssumeRolePolicyRequest& request, const UpdateAssumeRolePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3280,12 +4300,22 @@ UpdateGroupOutcome IAMClient::UpdateGroup(const UpdateGroupRequest& request) con
 
 UpdateGroupOutcomeCallable IAMClient::UpdateGroupCallable(const UpdateGroupRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::UpdateGroup, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateGroup, Aws::Client::RejectedCallOutcome<UpdateGroupOutcome>(), this, request);
+}
+
+UpdateGroupOutcomeCallable IAMClient::UpdateGroupCallable(UpdateGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateGroup, Aws::Client::RejectedCallOutcome<UpdateGroupOutcome>(), this, std::move(request));
 }
 
 void IAMClient::UpdateGroupAsync(const UpdateGroupRequest& request, const UpdateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::UpdateGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::UpdateGroupAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateGroupOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::UpdateGroupAsync(UpdateGroupRequest&& request, const UpdateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::UpdateGroupAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::UpdateGroupAsyncHelper(const UpdateGroupRequest& request, const UpdateGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3310,12 +4340,22 @@ UpdateLoginProfileOutcome IAMClient::UpdateLoginProfile(const UpdateLoginProfile
 
 UpdateLoginProfileOutcomeCallable IAMClient::UpdateLoginProfileCallable(const UpdateLoginProfileRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::UpdateLoginProfile, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateLoginProfile, Aws::Client::RejectedCallOutcome<UpdateLoginProfileOutcome>(), this, request);
+}
+
+UpdateLoginProfileOutcomeCallable IAMClient::UpdateLoginProfileCallable(UpdateLoginProfileRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateLoginProfile, Aws::Client::RejectedCallOutcome<UpdateLoginProfileOutcome>(), this, std::move(request));
 }
 
 void IAMClient::UpdateLoginProfileAsync(const UpdateLoginProfileRequest& request, const UpdateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::UpdateLoginProfileAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::UpdateLoginProfileAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateLoginProfileOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::UpdateLoginProfileAsync(UpdateLoginProfileRequest&& request, const UpdateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::UpdateLoginProfileAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateLoginProfileOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::UpdateLoginProfileAsyncHelper(const UpdateLoginProfileRequest& request, const UpdateLoginProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3340,12 +4380,22 @@ UpdateOpenIDConnectProviderThumbprintOutcome IAMClient::UpdateOpenIDConnectProvi
 
 UpdateOpenIDConnectProviderThumbprintOutcomeCallable IAMClient::UpdateOpenIDConnectProviderThumbprintCallable(const UpdateOpenIDConnectProviderThumbprintRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::UpdateOpenIDConnectProviderThumbprint, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateOpenIDConnectProviderThumbprint, Aws::Client::RejectedCallOutcome<UpdateOpenIDConnectProviderThumbprintOutcome>(), this, request);
+}
+
+UpdateOpenIDConnectProviderThumbprintOutcomeCallable IAMClient::UpdateOpenIDConnectProviderThumbprintCallable(UpdateOpenIDConnectProviderThumbprintRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateOpenIDConnectProviderThumbprint, Aws::Client::RejectedCallOutcome<UpdateOpenIDConnectProviderThumbprintOutcome>(), this, std::move(request));
 }
 
 void IAMClient::UpdateOpenIDConnectProviderThumbprintAsync(const UpdateOpenIDConnectProviderThumbprintRequest& request, const UpdateOpenIDConnectProviderThumbprintResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::UpdateOpenIDConnectProviderThumbprintAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::UpdateOpenIDConnectProviderThumbprintAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateOpenIDConnectProviderThumbprintOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::UpdateOpenIDConnectProviderThumbprintAsync(UpdateOpenIDConnectProviderThumbprintRequest&& request, const UpdateOpenIDConnectProviderThumbprintResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::UpdateOpenIDConnectProviderThumbprintAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateOpenIDConnectProviderThumbprintOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::UpdateOpenIDConnectProviderThumbprintAsyncHelper(const UpdateOpenIDConnectProviderThumbprintRequest& request, const UpdateOpenIDConnectProviderThumbprintResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3370,12 +4420,22 @@ UpdateSAMLProviderOutcome IAMClient::UpdateSAMLProvider(const UpdateSAMLProvider
 
 UpdateSAMLProviderOutcomeCallable IAMClient::UpdateSAMLProviderCallable(const UpdateSAMLProviderRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::UpdateSAMLProvider, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateSAMLProvider, Aws::Client::RejectedCallOutcome<UpdateSAMLProviderOutcome>(), this, request);
+}
+
+UpdateSAMLProviderOutcomeCallable IAMClient::UpdateSAMLProviderCallable(UpdateSAMLProviderRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateSAMLProvider, Aws::Client::RejectedCallOutcome<UpdateSAMLProviderOutcome>(), this, std::move(request));
 }
 
 void IAMClient::UpdateSAMLProviderAsync(const UpdateSAMLProviderRequest& request, const UpdateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::UpdateSAMLProviderAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::UpdateSAMLProviderAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateSAMLProviderOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::UpdateSAMLProviderAsync(UpdateSAMLProviderRequest&& request, const UpdateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::UpdateSAMLProviderAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateSAMLProviderOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::UpdateSAMLProviderAsyncHelper(const UpdateSAMLProviderRequest& request, const UpdateSAMLProviderResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3400,12 +4460,22 @@ UpdateSSHPublicKeyOutcome IAMClient::UpdateSSHPublicKey(const UpdateSSHPublicKey
 
 UpdateSSHPublicKeyOutcomeCallable IAMClient::UpdateSSHPublicKeyCallable(const UpdateSSHPublicKeyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::UpdateSSHPublicKey, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateSSHPublicKey, Aws::Client::RejectedCallOutcome<UpdateSSHPublicKeyOutcome>(), this, request);
+}
+
+UpdateSSHPublicKeyOutcomeCallable IAMClient::UpdateSSHPublicKeyCallable(UpdateSSHPublicKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateSSHPublicKey, Aws::Client::RejectedCallOutcome<UpdateSSHPublicKeyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::UpdateSSHPublicKeyAsync(const UpdateSSHPublicKeyRequest& request, const UpdateSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::UpdateSSHPublicKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::UpdateSSHPublicKeyAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateSSHPublicKeyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::UpdateSSHPublicKeyAsync(UpdateSSHPublicKeyRequest&& request, const UpdateSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::UpdateSSHPublicKeyAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateSSHPublicKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::UpdateSSHPublicKeyAsyncHelper(const UpdateSSHPublicKeyRequest& request, const UpdateSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3430,12 +4500,22 @@ UpdateServerCertificateOutcome IAMClient::UpdateServerCertificate(const UpdateSe
 
 UpdateServerCertificateOutcomeCallable IAMClient::UpdateServerCertificateCallable(const UpdateServerCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::UpdateServerCertificate, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateServerCertificate, Aws::Client::RejectedCallOutcome<UpdateServerCertificateOutcome>(), this, request);
+}
+
+UpdateServerCertificateOutcomeCallable IAMClient::UpdateServerCertificateCallable(UpdateServerCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateServerCertificate, Aws::Client::RejectedCallOutcome<UpdateServerCertificateOutcome>(), this, std::move(request));
 }
 
 void IAMClient::UpdateServerCertificateAsync(const UpdateServerCertificateRequest& request, const UpdateServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::UpdateServerCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::UpdateServerCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateServerCertificateOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::UpdateServerCertificateAsync(UpdateServerCertificateRequest&& request, const UpdateServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::UpdateServerCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateServerCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::UpdateServerCertificateAsyncHelper(const UpdateServerCertificateRequest& request, const UpdateServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3460,12 +4540,22 @@ UpdateSigningCertificateOutcome IAMClient::UpdateSigningCertificate(const Update
 
 UpdateSigningCertificateOutcomeCallable IAMClient::UpdateSigningCertificateCallable(const UpdateSigningCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::UpdateSigningCertificate, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateSigningCertificate, Aws::Client::RejectedCallOutcome<UpdateSigningCertificateOutcome>(), this, request);
+}
+
+UpdateSigningCertificateOutcomeCallable IAMClient::UpdateSigningCertificateCallable(UpdateSigningCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateSigningCertificate, Aws::Client::RejectedCallOutcome<UpdateSigningCertificateOutcome>(), this, std::move(request));
 }
 
 void IAMClient::UpdateSigningCertificateAsync(const UpdateSigningCertificateRequest& request, const UpdateSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::UpdateSigningCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::UpdateSigningCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateSigningCertificateOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::UpdateSigningCertificateAsync(UpdateSigningCertificateRequest&& request, const UpdateSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::UpdateSigningCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateSigningCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::UpdateSigningCertificateAsyncHelper(const UpdateSigningCertificateRequest& request, const UpdateSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3490,12 +4580,22 @@ UpdateUserOutcome IAMClient::UpdateUser(const UpdateUserRequest& request) const
 
 UpdateUserOutcomeCallable IAMClient::UpdateUserCallable(const UpdateUserRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::UpdateUser, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateUser, Aws::Client::RejectedCallOutcome<UpdateUserOutcome>(), this, request);
+}
+
+UpdateUserOutcomeCallable IAMClient::UpdateUserCallable(UpdateUserRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::UpdateUser, Aws::Client::RejectedCallOutcome<UpdateUserOutcome>(), this, std::move(request));
 }
 
 void IAMClient::UpdateUserAsync(const UpdateUserRequest& request, const UpdateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::UpdateUserAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::UpdateUserAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateUserOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::UpdateUserAsync(UpdateUserRequest&& request, const UpdateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::UpdateUserAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateUserOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::UpdateUserAsyncHelper(const UpdateUserRequest& request, const UpdateUserResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3520,12 +4620,22 @@ UploadSSHPublicKeyOutcome IAMClient::UploadSSHPublicKey(const UploadSSHPublicKey
 
 UploadSSHPublicKeyOutcomeCallable IAMClient::UploadSSHPublicKeyCallable(const UploadSSHPublicKeyRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::UploadSSHPublicKey, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::UploadSSHPublicKey, Aws::Client::RejectedCallOutcome<UploadSSHPublicKeyOutcome>(), this, request);
+}
+
+UploadSSHPublicKeyOutcomeCallable IAMClient::UploadSSHPublicKeyCallable(UploadSSHPublicKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::UploadSSHPublicKey, Aws::Client::RejectedCallOutcome<UploadSSHPublicKeyOutcome>(), this, std::move(request));
 }
 
 void IAMClient::UploadSSHPublicKeyAsync(const UploadSSHPublicKeyRequest& request, const UploadSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::UploadSSHPublicKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::UploadSSHPublicKeyAsyncHelper, Aws::Client::RejectedAsyncCall<UploadSSHPublicKeyOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::UploadSSHPublicKeyAsync(UploadSSHPublicKeyRequest&& request, const UploadSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::UploadSSHPublicKeyAsyncHelper, Aws::Client::RejectedAsyncCall<UploadSSHPublicKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::UploadSSHPublicKeyAsyncHelper(const UploadSSHPublicKeyRequest& request, const UploadSSHPublicKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3550,12 +4660,22 @@ UploadServerCertificateOutcome IAMClient::UploadServerCertificate(const UploadSe
 
 UploadServerCertificateOutcomeCallable IAMClient::UploadServerCertificateCallable(const UploadServerCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::UploadServerCertificate, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::UploadServerCertificate, Aws::Client::RejectedCallOutcome<UploadServerCertificateOutcome>(), this, request);
+}
+
+UploadServerCertificateOutcomeCallable IAMClient::UploadServerCertificateCallable(UploadServerCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::UploadServerCertificate, Aws::Client::RejectedCallOutcome<UploadServerCertificateOutcome>(), this, std::move(request));
 }
 
 void IAMClient::UploadServerCertificateAsync(const UploadServerCertificateRequest& request, const UploadServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::UploadServerCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::UploadServerCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<UploadServerCertificateOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::UploadServerCertificateAsync(UploadServerCertificateRequest&& request, const UploadServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::UploadServerCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<UploadServerCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::UploadServerCertificateAsyncHelper(const UploadServerCertificateRequest& request, const UploadServerCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -3580,12 +4700,22 @@ UploadSigningCertificateOutcome IAMClient::UploadSigningCertificate(const Upload
 
 UploadSigningCertificateOutcomeCallable IAMClient::UploadSigningCertificateCallable(const UploadSigningCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IAMClient::UploadSigningCertificate, this, request);
+  return m_executor->SubmitWithFuture(&IAMClient::UploadSigningCertificate, Aws::Client::RejectedCallOutcome<UploadSigningCertificateOutcome>(), this, request);
+}
+
+UploadSigningCertificateOutcomeCallable IAMClient::UploadSigningCertificateCallable(UploadSigningCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IAMClient::UploadSigningCertificate, Aws::Client::RejectedCallOutcome<UploadSigningCertificateOutcome>(), this, std::move(request));
 }
 
 void IAMClient::UploadSigningCertificateAsync(const UploadSigningCertificateRequest& request, const UploadSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IAMClient::UploadSigningCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IAMClient::UploadSigningCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<UploadSigningCertificateOutcome>(), this, request, handler, context);
+}
+
+void IAMClient::UploadSigningCertificateAsync(UploadSigningCertificateRequest&& request, const UploadSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IAMClient::UploadSigningCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<UploadSigningCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void IAMClient::UploadSigningCertificateAsyncHelper(const UploadSigningCertificateRequest& request, const UploadSigningCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -0,0 +1,232 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#if ENABLE_CURL_CLIENT && !defined(_WIN32)
+
+#include <aws/external/gtest.h>
+#include <aws/identity-management/auth/STSAssumeRoleCredentialsProvider.h>
+#include <aws/sts/STSClient.h>
+#include <aws/core/client/ClientConfiguration.h>
+#include <aws/core/utils/DateTime.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/testing/mocks/http/MockHttpServer.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <ctime>
+#include <future>
+#include <mutex>
+#include <thread>
+
+using namespace Aws::Auth;
+using namespace Aws::Client;
+using namespace Aws::STS;
+using namespace Aws::Utils;
+
+static const char* ALLOCATION_TAG = "STSAssumeRoleCredentialsProviderTest";
+static const char* ROLE_ARN = "arn:aws:iam::123456789012:role/test-role";
+
+/**
+ * Stands in for STS. Answers AssumeRole with the configured access key, or with an AccessDenied error,
+ * and can be told to hold requests until it is released.
+ */
+class STSStub
+{
+public:
+    STSStub() : m_accessKey("firstAccessKey"), m_fail(false), m_hang(false), m_hungRequests(0) {}
+
+    Aws::String Handle(const MockHttpServer::Request& request)
+    {
+        std::unique_lock<std::mutex> locker(m_mutex);
+        m_lastBody = request.body;
+        if (m_hang)
+        {
+            ++m_hungRequests;
+            m_signal.wait(locker, [this] { return !m_hang; });
+        }
+
+        if (m_fail)
+        {
+            return MockHttpServer::MakeResponse(403, "<ErrorResponse><Error><Type>Sender</Type><Code>AccessDenied</Code>"
+                "<Message>Not authorized to assume the role</Message></Error><RequestId>request-id</RequestId></ErrorResponse>");
+        }
+
+        Aws::StringStream body;
+        body << "<AssumeRoleResponse xmlns=\"https://sts.amazonaws.com/doc/2011-06-15/\"><AssumeRoleResult><Credentials>"
+             << "<AccessKeyId>" << m_accessKey << "</AccessKeyId><SecretAccessKey>sessionSecretKey</SecretAccessKey>"
+             << "<SessionToken>sessionToken</SessionToken><Expiration>"
+             << DateTime::CalculateGmtTimestampAsString(std::time(nullptr) + 3600, "%Y-%m-%dT%H:%M:%SZ") << "</Expiration>"
+             << "</Credentials><AssumedRoleUser><Arn>" << ROLE_ARN << "/session</Arn><AssumedRoleId>id:session</AssumedRoleId>"
+             << "</AssumedRoleUser></AssumeRoleResult><ResponseMetadata><RequestId>request-id</RequestId></ResponseMetadata>"
+             << "</AssumeRoleResponse>";
+        return MockHttpServer::MakeResponse(200, body.str());
+    }
+
+    void SetAccessKey(const Aws::String& accessKey)
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_accessKey = accessKey;
+    }
+
+    void SetFail(bool fail)
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        m_fail = fail;
+    }
+
+    void SetHang(bool hang)
+    {
+        {
+            std::lock_guard<std::mutex> locker(m_mutex);
+            m_hang = hang;
+        }
+        m_signal.notify_all();
+    }
+
+    Aws::String GetLastBody()
+    {
+        std::lock_guard<std::mutex> locker(m_mutex);
+        return m_lastBody;
+    }
+
+    unsigned GetHungRequests() const { return m_hungRequests; }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_signal;
+    Aws::String m_accessKey;
+    Aws::String m_lastBody;
+    bool m_fail;
+    bool m_hang;
+    std::atomic<unsigned> m_hungRequests;
+};
+
+static std::shared_ptr<STSClient> CreateSTSClient(const MockHttpServer& server)
+{
+    ClientConfiguration config;
+    config.scheme = Aws::Http::Scheme::HTTP;
+    config.endpointOverride = server.GetEndpoint();
+    return Aws::MakeShared<STSClient>(ALLOCATION_TAG, AWSCredentials("baseAccessKey", "baseSecretKey"), config);
+}
+
+static bool WaitForAccessKey(STSAssumeRoleCredentialsProvider& provider, const Aws::String& accessKey)
+{
+    for (int i = 0; i < 500; ++i)
+    {
+        if (provider.GetAWSCredentialsSnapshot()->GetAWSAccessKeyId() == accessKey)
+        {
+            return true;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return false;
+}
+
+TEST(STSAssumeRoleCredentialsProviderTest, TestAssumesRoleAndCachesSessionCredentials)
+{
+    STSStub sts;
+    MockHttpServer server([&sts](const MockHttpServer::Request& request) { return sts.Handle(request); });
+    ASSERT_TRUE(server.IsRunning());
+
+    STSAssumeRoleCredentialsProvider provider(ROLE_ARN, "session", "externalId", 3600, CreateSTSClient(server));
+    auto credentials = provider.GetAWSCredentialsSnapshot();
+    ASSERT_EQ("firstAccessKey", credentials->GetAWSAccessKeyId());
+    ASSERT_EQ("sessionSecretKey", credentials->GetAWSSecretKey());
+    ASSERT_EQ("sessionToken", credentials->GetSessionToken());
+
+    for (int i = 0; i < 100; ++i)
+    {
+        ASSERT_EQ(credentials, provider.GetAWSCredentialsSnapshot());
+    }
+    ASSERT_EQ(1u, server.GetRequestCount());
+
+    Aws::String body = sts.GetLastBody();
+    ASSERT_NE(Aws::String::npos, body.find("Action=AssumeRole"));
+    ASSERT_NE(Aws::String::npos, body.find("RoleSessionName=session"));
+    ASSERT_NE(Aws::String::npos, body.find("ExternalId=externalId"));
+    ASSERT_NE(Aws::String::npos, body.find("DurationSeconds=3600"));
+}
+
+TEST(STSAssumeRoleCredentialsProviderTest, TestRefreshesAheadOfExpiration)
+{
+    STSStub sts;
+    MockHttpServer server([&sts](const MockHttpServer::Request& request) { return sts.Handle(request); });
+    ASSERT_TRUE(server.IsRunning());
+
+    //a two second session is refreshed halfway through, well before the hour the stub advertises.
+    STSAssumeRoleCredentialsProvider provider(ROLE_ARN, "session", "", 2, CreateSTSClient(server));
+    ASSERT_EQ("firstAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    sts.SetAccessKey("rotatedAccessKey");
+    ASSERT_TRUE(WaitForAccessKey(provider, "rotatedAccessKey"));
+    ASSERT_EQ(Aws::String::npos, sts.GetLastBody().find("ExternalId"));
+}
+
+TEST(STSAssumeRoleCredentialsProviderTest, TestServesLastGoodCredentialsWhileStsHangsOrFails)
+{
+    STSStub sts;
+    MockHttpServer server([&sts](const MockHttpServer::Request& request) { return sts.Handle(request); });
+    ASSERT_TRUE(server.IsRunning());
+
+    STSAssumeRoleCredentialsProvider provider(ROLE_ARN, "session", "", 2, CreateSTSClient(server));
+    ASSERT_EQ("firstAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    sts.SetHang(true);
+    for (int i = 0; i < 500 && sts.GetHungRequests() == 0; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+
+    //every client in the process shares the provider; none of them may wait on the refresh stuck in STS.
+    Aws::Vector<std::future<bool>> readers;
+    for (int thread = 0; thread < 4; ++thread)
+    {
+        readers.push_back(std::async(std::launch::async, [&provider]
+        {
+            bool allFirst = true;
+            for (int i = 0; i < 5000; ++i)
+            {
+                allFirst = allFirst && provider.GetAWSCredentialsSnapshot()->GetAWSAccessKeyId() == "firstAccessKey";
+            }
+            return allFirst;
+        }));
+    }
+
+    bool readersFinished = true;
+    for (auto& reader : readers)
+    {
+        readersFinished = readersFinished && reader.wait_for(std::chrono::seconds(2)) == std::future_status::ready;
+    }
+    unsigned hungRequests = sts.GetHungRequests();
+
+    //the stuck refresh fails once released, and the old session keeps being served until a retry succeeds.
+    sts.SetFail(true);
+    sts.SetHang(false);
+    ASSERT_EQ(1u, hungRequests);
+    ASSERT_TRUE(readersFinished);
+    for (auto& reader : readers)
+    {
+        ASSERT_TRUE(reader.get());
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    ASSERT_EQ("firstAccessKey", provider.GetAWSCredentials().GetAWSAccessKeyId());
+
+    sts.SetAccessKey("secondAccessKey");
+    sts.SetFail(false);
+    ASSERT_TRUE(WaitForAccessKey(provider, "secondAccessKey"));
+}
+
+#endif // ENABLE_CURL_CLIENT && !defined(_WIN32)
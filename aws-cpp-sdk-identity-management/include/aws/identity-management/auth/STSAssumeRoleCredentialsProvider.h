@@ -0,0 +1,104 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#include <aws/core/auth/AWSCredentialsProvider.h>
+#include <aws/identity-management/IdentityManagment_EXPORTS.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <thread>
+
+namespace Aws
+{
+    namespace STS
+    {
+        class STSClient;
+    } // namespace STS
+
+    namespace Auth
+    {
+        static const long DEFAULT_ASSUME_ROLE_DURATION_SECONDS = 3600;
+
+        /**
+         * Credentials provider that assumes an IAM role through STS and hands out the resulting session credentials.
+         *
+         * Only the first call waits for STS. After that a background thread assumes the role again ahead of Expiration,
+         * at a randomly jittered point so that many processes sharing a role don't all call STS at once. Readers are served
+         * the cached snapshot without locking, and keep getting the last good credentials while a refresh is in flight or
+         * if it fails. One instance can be shared by every client in the process.
+         */
+        class AWS_IDENTITY_MANAGEMENT_API STSAssumeRoleCredentialsProvider : public AWSCredentialsProvider
+        {
+        public:
+            /**
+             * roleArn and sessionName are passed to AssumeRole as is, externalId only if it isn't empty.
+             * If stsClient is null, one is created with the default credentials provider chain and client configuration.
+             */
+            STSAssumeRoleCredentialsProvider(const Aws::String& roleArn, const Aws::String& sessionName, const Aws::String& externalId = "",
+                                             long durationSeconds = DEFAULT_ASSUME_ROLE_DURATION_SECONDS,
+                                             const std::shared_ptr<STS::STSClient>& stsClient = nullptr);
+
+            /**
+             * Stops the background refresh. If an AssumeRole call is in flight, this waits for it to finish or time out.
+             */
+            ~STSAssumeRoleCredentialsProvider();
+
+            /**
+             * Retrieves the session credentials, or an empty credential set if the role couldn't be assumed yet.
+             */
+            AWSCredentials GetAWSCredentials() override;
+
+            /**
+             * Returns the cached session credentials without taking a lock, once the first AssumeRole call has completed.
+             */
+            std::shared_ptr<const AWSCredentials> GetAWSCredentialsSnapshot() override;
+
+        private:
+            STSAssumeRoleCredentialsProvider(const STSAssumeRoleCredentialsProvider&) = delete;
+            STSAssumeRoleCredentialsProvider& operator=(const STSAssumeRoleCredentialsProvider&) = delete;
+
+            /**
+             * Assumes the role and publishes the session credentials. Keeps the previous credentials if the call fails.
+             * Callers must hold m_reloadMutex.
+             */
+            void Reload();
+            void RefreshLoop();
+
+            Aws::String m_roleArn;
+            Aws::String m_sessionName;
+            Aws::String m_externalId;
+            long m_durationSeconds;
+            std::shared_ptr<STS::STSClient> m_stsClient;
+
+            //only ever replaced as a whole with std::atomic_store, readers go through std::atomic_load.
+            std::shared_ptr<const AWSCredentials> m_credentials;
+            //when the session behind m_credentials expires, 0 until a role has been assumed.
+            long long m_expirationMs;
+            long long m_nextRefreshMs;
+            unsigned m_failedRefreshes;
+            std::default_random_engine m_jitterEngine;
+            std::mutex m_reloadMutex;
+
+            std::mutex m_refreshMutex;
+            std::condition_variable m_refreshSignal;
+            bool m_stopRefreshing;
+            std::thread m_refreshThread;
+        };
+    } // namespace Auth
+} // namespace Aws
@@ -0,0 +1,183 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#include <aws/identity-management/auth/STSAssumeRoleCredentialsProvider.h>
+#include <aws/sts/STSClient.h>
+#include <aws/sts/model/AssumeRoleRequest.h>
+#include <aws/core/utils/Outcome.h>
+#include <aws/core/utils/logging/LogMacros.h>
+
+#include <algorithm>
+#include <chrono>
+
+using namespace Aws::Auth;
+using namespace Aws::STS;
+using namespace Aws::STS::Model;
+
+static const char* LOG_TAG = "STSAssumeRoleCredentialsProvider";
+static const char* MEM_TAG = "STSAssumeRoleCredentialsProvider";
+
+//start assuming the role again at least this long before the session expires...
+static const long long EXPIRATION_GRACE_PERIOD_MS = 1000 * 60 * 5;
+//...plus a random share of this window, so processes that started together don't refresh together.
+static const long long REFRESH_JITTER_WINDOW_MS = 1000 * 60 * 5;
+static const long long MINIMUM_REFRESH_DELAY_MS = 1000;
+static const long long MAXIMUM_RETRY_DELAY_MS = 1000 * 60;
+
+static long long GetCurrentTimeMs()
+{
+    using namespace std::chrono;
+    return duration_cast<milliseconds>(system_clock::now().time_since_epoch()).count();
+}
+
+STSAssumeRoleCredentialsProvider::STSAssumeRoleCredentialsProvider(const Aws::String& roleArn, const Aws::String& sessionName,
+        const Aws::String& externalId, long durationSeconds, const std::shared_ptr<STSClient>& stsClient) :
+    m_roleArn(roleArn),
+    m_sessionName(sessionName),
+    m_externalId(externalId),
+    m_durationSeconds(durationSeconds),
+    m_stsClient(stsClient != nullptr ? stsClient : Aws::MakeShared<STSClient>(MEM_TAG)),
+    m_credentials(nullptr),
+    m_expirationMs(0),
+    m_nextRefreshMs(0),
+    m_failedRefreshes(0),
+    m_jitterEngine(std::random_device()()),
+    m_stopRefreshing(false)
+{
+    AWS_LOGSTREAM_INFO(LOG_TAG, "Creating provider for role " << m_roleArn << " with session " << m_sessionName);
+}
+
+STSAssumeRoleCredentialsProvider::~STSAssumeRoleCredentialsProvider()
+{
+    {
+        std::lock_guard<std::mutex> locker(m_refreshMutex);
+        m_stopRefreshing = true;
+    }
+    m_refreshSignal.notify_all();
+
+    if (m_refreshThread.joinable())
+    {
+        m_refreshThread.join();
+    }
+}
+
+AWSCredentials STSAssumeRoleCredentialsProvider::GetAWSCredentials()
+{
+    return *GetAWSCredentialsSnapshot();
+}
+
+std::shared_ptr<const AWSCredentials> STSAssumeRoleCredentialsProvider::GetAWSCredentialsSnapshot()
+{
+    auto credentials = std::atomic_load(&m_credentials);
+    if (credentials)
+    {
+        return credentials;
+    }
+
+    std::lock_guard<std::mutex> locker(m_reloadMutex);
+    credentials = std::atomic_load(&m_credentials);
+    if (!credentials)
+    {
+        Reload();
+        m_refreshThread = std::thread(&STSAssumeRoleCredentialsProvider::RefreshLoop, this);
+        credentials = std::atomic_load(&m_credentials);
+    }
+
+    return credentials;
+}
+
+void STSAssumeRoleCredentialsProvider::RefreshLoop()
+{
+    std::unique_lock<std::mutex> locker(m_refreshMutex);
+    while (!m_refreshSignal.wait_for(locker, std::chrono::milliseconds((std::max)(m_nextRefreshMs - GetCurrentTimeMs(), 0LL)),
+                                     [this] { return m_stopRefreshing; }))
+    {
+        if (GetCurrentTimeMs() < m_nextRefreshMs)
+        {
+            continue;
+        }
+
+        //don't hold m_refreshMutex across the STS call, or the destructor couldn't signal us.
+        locker.unlock();
+        {
+            std::lock_guard<std::mutex> reloadLocker(m_reloadMutex);
+            Reload();
+        }
+        locker.lock();
+    }
+}
+
+void STSAssumeRoleCredentialsProvider::Reload()
+{
+    AWS_LOGSTREAM_INFO(LOG_TAG, "Assuming role " << m_roleArn);
+
+    AssumeRoleRequest request;
+    request.SetRoleArn(m_roleArn);
+    request.SetRoleSessionName(m_sessionName);
+    request.SetDurationSeconds(m_durationSeconds);
+    if (!m_externalId.empty())
+    {
+        request.SetExternalId(m_externalId);
+    }
+
+    long long requestedAtMs = GetCurrentTimeMs();
+    auto outcome = m_stsClient->AssumeRole(request);
+    long long now = GetCurrentTimeMs();
+
+    if (!outcome.IsSuccess() || outcome.GetResult().GetCredentials().GetAccessKeyId().empty())
+    {
+        //back off exponentially up to MAXIMUM_RETRY_DELAY_MS. Retries carry on past the session's expiration, until then
+        //callers keep getting the last credentials that were assumed.
+        long long retryDelay = (std::min)(MINIMUM_REFRESH_DELAY_MS << (std::min)(m_failedRefreshes, 6u), MAXIMUM_RETRY_DELAY_MS);
+        ++m_failedRefreshes;
+        m_nextRefreshMs = now + retryDelay;
+
+        AWS_LOGSTREAM_ERROR(LOG_TAG, "Failed to assume role " << m_roleArn << ": " << outcome.GetError().GetMessage()
+                                     << ", retrying in " << retryDelay << "ms");
+        if (m_expirationMs > 0 && now >= m_expirationMs)
+        {
+            AWS_LOGSTREAM_ERROR(LOG_TAG, "The session for role " << m_roleArn << " expired " << now - m_expirationMs
+                                         << "ms ago, requests signed with its credentials will be rejected until the role is assumed again");
+        }
+        if (!std::atomic_load(&m_credentials))
+        {
+            std::atomic_store(&m_credentials, std::shared_ptr<const AWSCredentials>(Aws::MakeShared<AWSCredentials>(MEM_TAG, "", "")));
+        }
+        return;
+    }
+
+    const auto& sessionCredentials = outcome.GetResult().GetCredentials();
+
+    //the query protocol model reads Expiration with StringUtils::ConvertToDouble, which doesn't understand the ISO-8601 STS sends.
+    //sessions last exactly the requested duration, so fall back to that when the parsed value isn't a plausible epoch time.
+    long long expirationMs = requestedAtMs + static_cast<long long>(m_durationSeconds) * 1000;
+    if (sessionCredentials.GetExpiration() > 1000000000.0)
+    {
+        expirationMs = static_cast<long long>(sessionCredentials.GetExpiration() * 1000);
+    }
+
+    //short sessions still get to use at least half of their lifetime.
+    long long lifetime = expirationMs - now;
+    std::uniform_int_distribution<long long> jitter(0, REFRESH_JITTER_WINDOW_MS);
+    long long lead = (std::min)(EXPIRATION_GRACE_PERIOD_MS + jitter(m_jitterEngine), lifetime / 2);
+    m_nextRefreshMs = now + (std::max)(lifetime - lead, MINIMUM_REFRESH_DELAY_MS);
+    m_expirationMs = expirationMs;
+    m_failedRefreshes = 0;
+
+    AWS_LOGSTREAM_INFO(LOG_TAG, "Assumed role " << m_roleArn << " with access key " << sessionCredentials.GetAccessKeyId()
+                                << ", refreshing in " << m_nextRefreshMs - now << "ms");
+    std::atomic_store(&m_credentials, std::shared_ptr<const AWSCredentials>(Aws::MakeShared<AWSCredentials>(MEM_TAG,
+        sessionCredentials.GetAccessKeyId(), sessionCredentials.GetSecretAccessKey(), sessionCredentials.GetSessionToken())));
+}
@@ -28,6 +28,16 @@
 #include <aws/importexport/model/UpdateJobResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/importexport/model/CancelJobRequest.h>
+#include <aws/importexport/model/CreateJobRequest.h>
+#include <aws/importexport/model/GetShippingLabelRequest.h>
+#include <aws/importexport/model/GetStatusRequest.h>
+#include <aws/importexport/model/ListJobsRequest.h>
+#include <aws/importexport/model/UpdateJobRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -151,6 +161,11 @@ namespace Model
          */
         virtual Model::CancelJobOutcomeCallable CancelJobCallable(const Model::CancelJobRequest& request) const;
 
+        /**
+         * Same as CancelJobCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelJobOutcomeCallable CancelJobCallable(Model::CancelJobRequest&& request) const;
+
         /**
          * This operation cancels a specified job. Only the job owner can cancel it. The
          * operation fails if the job has already started or is complete.
@@ -159,6 +174,11 @@ namespace Model
          */
         virtual void CancelJobAsync(const Model::CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelJobAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelJobAsync(Model::CancelJobRequest&& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * This operation initiates the process of scheduling an upload or download of your
          * data. You include in the request a manifest that describes the data transfer
@@ -179,6 +199,11 @@ namespace Model
          */
         virtual Model::CreateJobOutcomeCallable CreateJobCallable(const Model::CreateJobRequest& request) const;
 
+        /**
+         * Same as CreateJobCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateJobOutcomeCallable CreateJobCallable(Model::CreateJobRequest&& request) const;
+
         /**
          * This operation initiates the process of scheduling an upload or download of your
          * data. You include in the request a manifest that describes the data transfer
@@ -190,6 +215,11 @@ namespace Model
          */
         virtual void CreateJobAsync(const Model::CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateJobAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateJobAsync(Model::CreateJobRequest&& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * This operation returns information about a job, including where the job is in
          * the processing pipeline, the status of the results, and the signature value
@@ -206,6 +236,11 @@ namespace Model
          */
         virtual Model::GetShippingLabelOutcomeCallable GetShippingLabelCallable(const Model::GetShippingLabelRequest& request) const;
 
+        /**
+         * Same as GetShippingLabelCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetShippingLabelOutcomeCallable GetShippingLabelCallable(Model::GetShippingLabelRequest&& request) const;
+
         /**
          * This operation returns information about a job, including where the job is in
          * the processing pipeline, the status of the results, and the signature value
@@ -215,6 +250,11 @@ namespace Model
          */
         virtual void GetShippingLabelAsync(const Model::GetShippingLabelRequest& request, const GetShippingLabelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetShippingLabelAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetShippingLabelAsync(Model::GetShippingLabelRequest&& request, const GetShippingLabelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * This operation returns information about a job, including where the job is in
          * the processing pipeline, the status of the results, and the signature value
@@ -231,6 +271,11 @@ namespace Model
          */
         virtual Model::GetStatusOutcomeCallable GetStatusCallable(const Model::GetStatusRequest& request) const;
 
+        /**
+         * Same as GetStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetStatusOutcomeCallable GetStatusCallable(Model::GetStatusRequest&& request) const;
+
         /**
          * This operation returns information about a job, including where the job is in
          * the processing pipeline, the status of the results, and the signature value
@@ -240,6 +285,11 @@ namespace Model
          */
         virtual void GetStatusAsync(const Model::GetStatusRequest& request, const GetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetStatusAsync(Model::GetStatusRequest&& request, const GetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * This operation returns the jobs associated with the requester. AWS Import/Export
          * lists the jobs in reverse chronological order based on the date of creation. For
@@ -258,6 +308,11 @@ namespace Model
          */
         virtual Model::ListJobsOutcomeCallable ListJobsCallable(const Model::ListJobsRequest& request) const;
 
+        /**
+         * Same as ListJobsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListJobsOutcomeCallable ListJobsCallable(Model::ListJobsRequest&& request) const;
+
         /**
          * This operation returns the jobs associated with the requester. AWS Import/Export
          * lists the jobs in reverse chronological order based on the date of creation. For
@@ -268,6 +323,11 @@ namespace Model
          */
         virtual void ListJobsAsync(const Model::ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListJobsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListJobsAsync(Model::ListJobsRequest&& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * You use this operation to change the parameters specified in the original
          * manifest file by supplying a new manifest file. The manifest file attached to
@@ -288,6 +348,11 @@ namespace Model
          */
         virtual Model::UpdateJobOutcomeCallable UpdateJobCallable(const Model::UpdateJobRequest& request) const;
 
+        /**
+         * Same as UpdateJobCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateJobOutcomeCallable UpdateJobCallable(Model::UpdateJobRequest&& request) const;
+
         /**
          * You use this operation to change the parameters specified in the original
          * manifest file by supplying a new manifest file. The manifest file attached to
@@ -299,6 +364,30 @@ namespace Model
          */
         virtual void UpdateJobAsync(const Model::UpdateJobRequest& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateJobAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateJobAsync(Model::UpdateJobRequest&& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelJobOutcome> CancelJobAwaitable(const Model::CancelJobRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ImportExportClient::CancelJob, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelJobOutcome> CancelJobAwaitable(Model::CancelJobRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ImportExportClient::CancelJob, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateJobOutcome> CreateJobAwaitable(const Model::CreateJobRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ImportExportClient::CreateJob, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateJobOutcome> CreateJobAwaitable(Model::CreateJobRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ImportExportClient::CreateJob, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetShippingLabelOutcome> GetShippingLabelAwaitable(const Model::GetShippingLabelRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ImportExportClient::GetShippingLabel, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetShippingLabelOutcome> GetShippingLabelAwaitable(Model::GetShippingLabelRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ImportExportClient::GetShippingLabel, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetStatusOutcome> GetStatusAwaitable(const Model::GetStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ImportExportClient::GetStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetStatusOutcome> GetStatusAwaitable(Model::GetStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ImportExportClient::GetStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListJobsOutcome> ListJobsAwaitable(const Model::ListJobsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ImportExportClient::ListJobs, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListJobsOutcome> ListJobsAwaitable(Model::ListJobsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ImportExportClient::ListJobs, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateJobOutcome> UpdateJobAwaitable(const Model::UpdateJobRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ImportExportClient::UpdateJob, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateJobOutcome> UpdateJobAwaitable(Model::UpdateJobRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &ImportExportClient::UpdateJob, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -113,12 +113,22 @@ CancelJobOutcome ImportExportClient::CancelJob(const CancelJobRequest& request)
 
 CancelJobOutcomeCallable ImportExportClient::CancelJobCallable(const CancelJobRequest& request) const
 {
-  return std::async(std::launch::async, &ImportExportClient::CancelJob, this, request);
+  return m_executor->SubmitWithFuture(&ImportExportClient::CancelJob, Aws::Client::RejectedCallOutcome<CancelJobOutcome>(), this, request);
+}
+
+CancelJobOutcomeCallable ImportExportClient::CancelJobCallable(CancelJobRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ImportExportClient::CancelJob, Aws::Client::RejectedCallOutcome<CancelJobOutcome>(), this, std::move(request));
 }
 
 void ImportExportClient::CancelJobAsync(const CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ImportExportClient::CancelJobAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ImportExportClient::CancelJobAsyncHelper, Aws::Client::RejectedAsyncCall<CancelJobOutcome>(), this, request, handler, context);
+}
+
+void ImportExportClient::CancelJobAsync(CancelJobRequest&& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ImportExportClient::CancelJobAsyncHelper, Aws::Client::RejectedAsyncCall<CancelJobOutcome>(), this, std::move(request), handler, context);
 }
 
 void ImportExportClient::CancelJobAsyncHelper(const CancelJobRequest& request, const CancelJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -143,12 +153,22 @@ CreateJobOutcome ImportExportClient::CreateJob(const CreateJobRequest& request)
 
 CreateJobOutcomeCallable ImportExportClient::CreateJobCallable(const CreateJobRequest& request) const
 {
-  return std::async(std::launch::async, &ImportExportClient::CreateJob, this, request);
+  return m_executor->SubmitWithFuture(&ImportExportClient::CreateJob, Aws::Client::RejectedCallOutcome<CreateJobOutcome>(), this, request);
+}
+
+CreateJobOutcomeCallable ImportExportClient::CreateJobCallable(CreateJobRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ImportExportClient::CreateJob, Aws::Client::RejectedCallOutcome<CreateJobOutcome>(), this, std::move(request));
 }
 
 void ImportExportClient::CreateJobAsync(const CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ImportExportClient::CreateJobAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ImportExportClient::CreateJobAsyncHelper, Aws::Client::RejectedAsyncCall<CreateJobOutcome>(), this, request, handler, context);
+}
+
+void ImportExportClient::CreateJobAsync(CreateJobRequest&& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ImportExportClient::CreateJobAsyncHelper, Aws::Client::RejectedAsyncCall<CreateJobOutcome>(), this, std::move(request), handler, context);
 }
 
 void ImportExportClient::CreateJobAsyncHelper(const CreateJobRequest& request, const CreateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -173,12 +193,22 @@ GetShippingLabelOutcome ImportExportClient::GetShippingLabel(const GetShippingLa
 
 GetShippingLabelOutcomeCallable ImportExportClient::GetShippingLabelCallable(const GetShippingLabelRequest& request) const
 {
-  return std::async(std::launch::async, &ImportExportClient::GetShippingLabel, this, request);
+  return m_executor->SubmitWithFuture(&ImportExportClient::GetShippingLabel, Aws::Client::RejectedCallOutcome<GetShippingLabelOutcome>(), this, request);
+}
+
+GetShippingLabelOutcomeCallable ImportExportClient::GetShippingLabelCallable(GetShippingLabelRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ImportExportClient::GetShippingLabel, Aws::Client::RejectedCallOutcome<GetShippingLabelOutcome>(), this, std::move(request));
 }
 
 void ImportExportClient::GetShippingLabelAsync(const GetShippingLabelRequest& request, const GetShippingLabelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ImportExportClient::GetShippingLabelAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ImportExportClient::GetShippingLabelAsyncHelper, Aws::Client::RejectedAsyncCall<GetShippingLabelOutcome>(), this, request, handler, context);
+}
+
+void ImportExportClient::GetShippingLabelAsync(GetShippingLabelRequest&& request, const GetShippingLabelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ImportExportClient::GetShippingLabelAsyncHelper, Aws::Client::RejectedAsyncCall<GetShippingLabelOutcome>(), this, std::move(request), handler, context);
 }
 
 void ImportExportClient::GetShippingLabelAsyncHelper(const GetShippingLabelRequest& request, const GetShippingLabelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -203,12 +233,22 @@ GetStatusOutcome ImportExportClient::GetStatus(const GetStatusRequest& request)
 
 GetStatusOutcomeCallable ImportExportClient::GetStatusCallable(const GetStatusRequest& request) const
 {
-  return std::async(std::launch::async, &ImportExportClient::GetStatus, this, request);
+  return m_executor->SubmitWithFuture(&ImportExportClient::GetStatus, Aws::Client::RejectedCallOutcome<GetStatusOutcome>(), this, request);
+}
+
+GetStatusOutcomeCallable ImportExportClient::GetStatusCallable(GetStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ImportExportClient::GetStatus, Aws::Client::RejectedCallOutcome<GetStatusOutcome>(), this, std::move(request));
 }
 
 void ImportExportClient::GetStatusAsync(const GetStatusRequest& request, const GetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ImportExportClient::GetStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ImportExportClient::GetStatusAsyncHelper, Aws::Client::RejectedAsyncCall<GetStatusOutcome>(), this, request, handler, context);
+}
+
+void ImportExportClient::GetStatusAsync(GetStatusRequest&& request, const GetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ImportExportClient::GetStatusAsyncHelper, Aws::Client::RejectedAsyncCall<GetStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void ImportExportClient::GetStatusAsyncHelper(const GetStatusRequest& request, const GetStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -233,12 +273,22 @@ ListJobsOutcome ImportExportClient::ListJobs(const ListJobsRequest& request) con
 
 ListJobsOutcomeCallable ImportExportClient::ListJobsCallable(const ListJobsRequest& request) const
 {
-  return std::async(std::launch::async, &ImportExportClient::ListJobs, this, request);
+  return m_executor->SubmitWithFuture(&ImportExportClient::ListJobs, Aws::Client::RejectedCallOutcome<ListJobsOutcome>(), this, request);
+}
+
+ListJobsOutcomeCallable ImportExportClient::ListJobsCallable(ListJobsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ImportExportClient::ListJobs, Aws::Client::RejectedCallOutcome<ListJobsOutcome>(), this, std::move(request));
 }
 
 void ImportExportClient::ListJobsAsync(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ImportExportClient::ListJobsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ImportExportClient::ListJobsAsyncHelper, Aws::Client::RejectedAsyncCall<ListJobsOutcome>(), this, request, handler, context);
+}
+
+void ImportExportClient::ListJobsAsync(ListJobsRequest&& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ImportExportClient::ListJobsAsyncHelper, Aws::Client::RejectedAsyncCall<ListJobsOutcome>(), this, std::move(request), handler, context);
 }
 
 void ImportExportClient::ListJobsAsyncHelper(const ListJobsRequest& request, const ListJobsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -263,12 +313,22 @@ UpdateJobOutcome ImportExportClient::UpdateJob(const UpdateJobRequest& request)
 
 UpdateJobOutcomeCallable ImportExportClient::UpdateJobCallable(const UpdateJobRequest& request) const
 {
-  return std::async(std::launch::async, &ImportExportClient::UpdateJob, this, request);
+  return m_executor->SubmitWithFuture(&ImportExportClient::UpdateJob, Aws::Client::RejectedCallOutcome<UpdateJobOutcome>(), this, request);
+}
+
+UpdateJobOutcomeCallable ImportExportClient::UpdateJobCallable(UpdateJobRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&ImportExportClient::UpdateJob, Aws::Client::RejectedCallOutcome<UpdateJobOutcome>(), this, std::move(request));
 }
 
 void ImportExportClient::UpdateJobAsync(const UpdateJobRequest& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&ImportExportClient::UpdateJobAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&ImportExportClient::UpdateJobAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateJobOutcome>(), this, request, handler, context);
+}
+
+void ImportExportClient::UpdateJobAsync(UpdateJobRequest&& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&ImportExportClient::UpdateJobAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateJobOutcome>(), this, std::move(request), handler, context);
 }
 
 void ImportExportClient::UpdateJobAsyncHelper(const UpdateJobRequest& request, const UpdateJobResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
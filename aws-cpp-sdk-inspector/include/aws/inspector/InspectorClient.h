@@ -58,6 +58,45 @@
 #include <aws/inspector/model/UpdateAssessmentResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/inspector/model/AddAttributesToFindingsRequest.h>
+#include <aws/inspector/model/AttachAssessmentAndRulesPackageRequest.h>
+#include <aws/inspector/model/CreateApplicationRequest.h>
+#include <aws/inspector/model/CreateAssessmentRequest.h>
+#include <aws/inspector/model/CreateResourceGroupRequest.h>
+#include <aws/inspector/model/DeleteApplicationRequest.h>
+#include <aws/inspector/model/DeleteAssessmentRequest.h>
+#include <aws/inspector/model/DeleteRunRequest.h>
+#include <aws/inspector/model/DescribeApplicationRequest.h>
+#include <aws/inspector/model/DescribeAssessmentRequest.h>
+#include <aws/inspector/model/DescribeFindingRequest.h>
+#include <aws/inspector/model/DescribeResourceGroupRequest.h>
+#include <aws/inspector/model/DescribeRulesPackageRequest.h>
+#include <aws/inspector/model/DescribeRunRequest.h>
+#include <aws/inspector/model/DetachAssessmentAndRulesPackageRequest.h>
+#include <aws/inspector/model/GetAssessmentTelemetryRequest.h>
+#include <aws/inspector/model/ListApplicationsRequest.h>
+#include <aws/inspector/model/ListAssessmentAgentsRequest.h>
+#include <aws/inspector/model/ListAssessmentsRequest.h>
+#include <aws/inspector/model/ListAttachedAssessmentsRequest.h>
+#include <aws/inspector/model/ListAttachedRulesPackagesRequest.h>
+#include <aws/inspector/model/ListFindingsRequest.h>
+#include <aws/inspector/model/ListRulesPackagesRequest.h>
+#include <aws/inspector/model/ListRunsRequest.h>
+#include <aws/inspector/model/ListTagsForResourceRequest.h>
+#include <aws/inspector/model/LocalizeTextRequest.h>
+#include <aws/inspector/model/PreviewAgentsForResourceGroupRequest.h>
+#include <aws/inspector/model/RegisterCrossAccountAccessRoleRequest.h>
+#include <aws/inspector/model/RemoveAttributesFromFindingsRequest.h>
+#include <aws/inspector/model/RunAssessmentRequest.h>
+#include <aws/inspector/model/SetTagsForResourceRequest.h>
+#include <aws/inspector/model/StartDataCollectionRequest.h>
+#include <aws/inspector/model/StopDataCollectionRequest.h>
+#include <aws/inspector/model/UpdateApplicationRequest.h>
+#include <aws/inspector/model/UpdateAssessmentRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -299,6 +338,11 @@ namespace Model
          */
         virtual Model::AddAttributesToFindingsOutcomeCallable AddAttributesToFindingsCallable(const Model::AddAttributesToFindingsRequest& request) const;
 
+        /**
+         * Same as AddAttributesToFindingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddAttributesToFindingsOutcomeCallable AddAttributesToFindingsCallable(Model::AddAttributesToFindingsRequest&& request) const;
+
         /**
          * <p>Assigns attributes (key and value pair) to the findings specified by the
          * findings' ARNs.</p>
@@ -307,6 +351,11 @@ namespace Model
          */
         virtual void AddAttributesToFindingsAsync(const Model::AddAttributesToFindingsRequest& request, const AddAttributesToFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddAttributesToFindingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddAttributesToFindingsAsync(Model::AddAttributesToFindingsRequest&& request, const AddAttributesToFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches the rules package specified by the rules package ARN to the
          * assessment specified by the assessment ARN.</p>
@@ -321,6 +370,11 @@ namespace Model
          */
         virtual Model::AttachAssessmentAndRulesPackageOutcomeCallable AttachAssessmentAndRulesPackageCallable(const Model::AttachAssessmentAndRulesPackageRequest& request) const;
 
+        /**
+         * Same as AttachAssessmentAndRulesPackageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachAssessmentAndRulesPackageOutcomeCallable AttachAssessmentAndRulesPackageCallable(Model::AttachAssessmentAndRulesPackageRequest&& request) const;
+
         /**
          * <p>Attaches the rules package specified by the rules package ARN to the
          * assessment specified by the assessment ARN.</p>
@@ -329,6 +383,11 @@ namespace Model
          */
         virtual void AttachAssessmentAndRulesPackageAsync(const Model::AttachAssessmentAndRulesPackageRequest& request, const AttachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachAssessmentAndRulesPackageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachAssessmentAndRulesPackageAsync(Model::AttachAssessmentAndRulesPackageRequest&& request, const AttachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new application using the resource group ARN generated by
          * <a>CreateResourceGroup</a>. You can create up to 50 applications per AWS
@@ -351,6 +410,11 @@ namespace Model
          */
         virtual Model::CreateApplicationOutcomeCallable CreateApplicationCallable(const Model::CreateApplicationRequest& request) const;
 
+        /**
+         * Same as CreateApplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateApplicationOutcomeCallable CreateApplicationCallable(Model::CreateApplicationRequest&& request) const;
+
         /**
          * <p>Creates a new application using the resource group ARN generated by
          * <a>CreateResourceGroup</a>. You can create up to 50 applications per AWS
@@ -363,6 +427,11 @@ namespace Model
          */
         virtual void CreateApplicationAsync(const Model::CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateApplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateApplicationAsync(Model::CreateApplicationRequest&& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an assessment for the application specified by the application ARN.
          * You can create up to 500 assessments per AWS account.</p>
@@ -377,6 +446,11 @@ namespace Model
          */
         virtual Model::CreateAssessmentOutcomeCallable CreateAssessmentCallable(const Model::CreateAssessmentRequest& request) const;
 
+        /**
+         * Same as CreateAssessmentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateAssessmentOutcomeCallable CreateAssessmentCallable(Model::CreateAssessmentRequest&& request) const;
+
         /**
          * <p>Creates an assessment for the application specified by the application ARN.
          * You can create up to 500 assessments per AWS account.</p>
@@ -385,6 +459,11 @@ namespace Model
          */
         virtual void CreateAssessmentAsync(const Model::CreateAssessmentRequest& request, const CreateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAssessmentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateAssessmentAsync(Model::CreateAssessmentRequest&& request, const CreateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a resource group using the specified set of tags (key and value
          * pairs) that are used to select the EC2 instances to be included in an Inspector
@@ -403,6 +482,11 @@ namespace Model
          */
         virtual Model::CreateResourceGroupOutcomeCallable CreateResourceGroupCallable(const Model::CreateResourceGroupRequest& request) const;
 
+        /**
+         * Same as CreateResourceGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateResourceGroupOutcomeCallable CreateResourceGroupCallable(Model::CreateResourceGroupRequest&& request) const;
+
         /**
          * <p>Creates a resource group using the specified set of tags (key and value
          * pairs) that are used to select the EC2 instances to be included in an Inspector
@@ -413,6 +497,11 @@ namespace Model
          */
         virtual void CreateResourceGroupAsync(const Model::CreateResourceGroupRequest& request, const CreateResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateResourceGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateResourceGroupAsync(Model::CreateResourceGroupRequest&& request, const CreateResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the application specified by the application ARN.</p>
          */
@@ -425,6 +514,11 @@ namespace Model
          */
         virtual Model::DeleteApplicationOutcomeCallable DeleteApplicationCallable(const Model::DeleteApplicationRequest& request) const;
 
+        /**
+         * Same as DeleteApplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteApplicationOutcomeCallable DeleteApplicationCallable(Model::DeleteApplicationRequest&& request) const;
+
         /**
          * <p>Deletes the application specified by the application ARN.</p>
          *
@@ -432,6 +526,11 @@ namespace Model
          */
         virtual void DeleteApplicationAsync(const Model::DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteApplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteApplicationAsync(Model::DeleteApplicationRequest&& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the assessment specified by the assessment ARN.</p>
          */
@@ -444,6 +543,11 @@ namespace Model
          */
         virtual Model::DeleteAssessmentOutcomeCallable DeleteAssessmentCallable(const Model::DeleteAssessmentRequest& request) const;
 
+        /**
+         * Same as DeleteAssessmentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteAssessmentOutcomeCallable DeleteAssessmentCallable(Model::DeleteAssessmentRequest&& request) const;
+
         /**
          * <p>Deletes the assessment specified by the assessment ARN.</p>
          *
@@ -451,6 +555,11 @@ namespace Model
          */
         virtual void DeleteAssessmentAsync(const Model::DeleteAssessmentRequest& request, const DeleteAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAssessmentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteAssessmentAsync(Model::DeleteAssessmentRequest&& request, const DeleteAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the assessment run specified by the run ARN.</p>
          */
@@ -463,6 +572,11 @@ namespace Model
          */
         virtual Model::DeleteRunOutcomeCallable DeleteRunCallable(const Model::DeleteRunRequest& request) const;
 
+        /**
+         * Same as DeleteRunCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteRunOutcomeCallable DeleteRunCallable(Model::DeleteRunRequest&& request) const;
+
         /**
          * <p>Deletes the assessment run specified by the run ARN.</p>
          *
@@ -470,6 +584,11 @@ namespace Model
          */
         virtual void DeleteRunAsync(const Model::DeleteRunRequest& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRunAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteRunAsync(Model::DeleteRunRequest&& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the application specified by the application ARN.</p>
          */
@@ -482,6 +601,11 @@ namespace Model
          */
         virtual Model::DescribeApplicationOutcomeCallable DescribeApplicationCallable(const Model::DescribeApplicationRequest& request) const;
 
+        /**
+         * Same as DescribeApplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeApplicationOutcomeCallable DescribeApplicationCallable(Model::DescribeApplicationRequest&& request) const;
+
         /**
          * <p>Describes the application specified by the application ARN.</p>
          *
@@ -489,6 +613,11 @@ namespace Model
          */
         virtual void DescribeApplicationAsync(const Model::DescribeApplicationRequest& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeApplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeApplicationAsync(Model::DescribeApplicationRequest&& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the assessment specified by the assessment ARN.</p>
          */
@@ -501,6 +630,11 @@ namespace Model
          */
         virtual Model::DescribeAssessmentOutcomeCallable DescribeAssessmentCallable(const Model::DescribeAssessmentRequest& request) const;
 
+        /**
+         * Same as DescribeAssessmentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAssessmentOutcomeCallable DescribeAssessmentCallable(Model::DescribeAssessmentRequest&& request) const;
+
         /**
          * <p>Describes the assessment specified by the assessment ARN.</p>
          *
@@ -508,6 +642,11 @@ namespace Model
          */
         virtual void DescribeAssessmentAsync(const Model::DescribeAssessmentRequest& request, const DescribeAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAssessmentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAssessmentAsync(Model::DescribeAssessmentRequest&& request, const DescribeAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the IAM role that enables Inspector to access your AWS account.</p>
          */
@@ -538,6 +677,11 @@ namespace Model
          */
         virtual Model::DescribeFindingOutcomeCallable DescribeFindingCallable(const Model::DescribeFindingRequest& request) const;
 
+        /**
+         * Same as DescribeFindingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeFindingOutcomeCallable DescribeFindingCallable(Model::DescribeFindingRequest&& request) const;
+
         /**
          * <p>Describes the finding specified by the finding ARN.</p>
          *
@@ -545,6 +689,11 @@ namespace Model
          */
         virtual void DescribeFindingAsync(const Model::DescribeFindingRequest& request, const DescribeFindingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeFindingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeFindingAsync(Model::DescribeFindingRequest&& request, const DescribeFindingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the resource group specified by the resource group ARN.</p>
          */
@@ -557,6 +706,11 @@ namespace Model
          */
         virtual Model::DescribeResourceGroupOutcomeCallable DescribeResourceGroupCallable(const Model::DescribeResourceGroupRequest& request) const;
 
+        /**
+         * Same as DescribeResourceGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeResourceGroupOutcomeCallable DescribeResourceGroupCallable(Model::DescribeResourceGroupRequest&& request) const;
+
         /**
          * <p>Describes the resource group specified by the resource group ARN.</p>
          *
@@ -564,6 +718,11 @@ namespace Model
          */
         virtual void DescribeResourceGroupAsync(const Model::DescribeResourceGroupRequest& request, const DescribeResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeResourceGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeResourceGroupAsync(Model::DescribeResourceGroupRequest&& request, const DescribeResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the rules package specified by the rules package ARN.</p>
          */
@@ -576,6 +735,11 @@ namespace Model
          */
         virtual Model::DescribeRulesPackageOutcomeCallable DescribeRulesPackageCallable(const Model::DescribeRulesPackageRequest& request) const;
 
+        /**
+         * Same as DescribeRulesPackageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeRulesPackageOutcomeCallable DescribeRulesPackageCallable(Model::DescribeRulesPackageRequest&& request) const;
+
         /**
          * <p>Describes the rules package specified by the rules package ARN.</p>
          *
@@ -583,6 +747,11 @@ namespace Model
          */
         virtual void DescribeRulesPackageAsync(const Model::DescribeRulesPackageRequest& request, const DescribeRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRulesPackageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeRulesPackageAsync(Model::DescribeRulesPackageRequest&& request, const DescribeRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the assessment run specified by the run ARN.</p>
          */
@@ -595,6 +764,11 @@ namespace Model
          */
         virtual Model::DescribeRunOutcomeCallable DescribeRunCallable(const Model::DescribeRunRequest& request) const;
 
+        /**
+         * Same as DescribeRunCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeRunOutcomeCallable DescribeRunCallable(Model::DescribeRunRequest&& request) const;
+
         /**
          * <p>Describes the assessment run specified by the run ARN.</p>
          *
@@ -602,6 +776,11 @@ namespace Model
          */
         virtual void DescribeRunAsync(const Model::DescribeRunRequest& request, const DescribeRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRunAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeRunAsync(Model::DescribeRunRequest&& request, const DescribeRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches the rules package specified by the rules package ARN from the
          * assessment specified by the assessment ARN.</p>
@@ -616,6 +795,11 @@ namespace Model
          */
         virtual Model::DetachAssessmentAndRulesPackageOutcomeCallable DetachAssessmentAndRulesPackageCallable(const Model::DetachAssessmentAndRulesPackageRequest& request) const;
 
+        /**
+         * Same as DetachAssessmentAndRulesPackageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachAssessmentAndRulesPackageOutcomeCallable DetachAssessmentAndRulesPackageCallable(Model::DetachAssessmentAndRulesPackageRequest&& request) const;
+
         /**
          * <p>Detaches the rules package specified by the rules package ARN from the
          * assessment specified by the assessment ARN.</p>
@@ -624,6 +808,11 @@ namespace Model
          */
         virtual void DetachAssessmentAndRulesPackageAsync(const Model::DetachAssessmentAndRulesPackageRequest& request, const DetachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachAssessmentAndRulesPackageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachAssessmentAndRulesPackageAsync(Model::DetachAssessmentAndRulesPackageRequest&& request, const DetachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the metadata about the telemetry (application behavioral data) for
          * the assessment specified by the assessment ARN.</p>
@@ -638,6 +827,11 @@ namespace Model
          */
         virtual Model::GetAssessmentTelemetryOutcomeCallable GetAssessmentTelemetryCallable(const Model::GetAssessmentTelemetryRequest& request) const;
 
+        /**
+         * Same as GetAssessmentTelemetryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetAssessmentTelemetryOutcomeCallable GetAssessmentTelemetryCallable(Model::GetAssessmentTelemetryRequest&& request) const;
+
         /**
          * <p>Returns the metadata about the telemetry (application behavioral data) for
          * the assessment specified by the assessment ARN.</p>
@@ -646,6 +840,11 @@ namespace Model
          */
         virtual void GetAssessmentTelemetryAsync(const Model::GetAssessmentTelemetryRequest& request, const GetAssessmentTelemetryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAssessmentTelemetryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetAssessmentTelemetryAsync(Model::GetAssessmentTelemetryRequest&& request, const GetAssessmentTelemetryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the ARNs of the applications within this AWS account. For more
          * information about applications, see <a
@@ -664,6 +863,11 @@ namespace Model
          */
         virtual Model::ListApplicationsOutcomeCallable ListApplicationsCallable(const Model::ListApplicationsRequest& request) const;
 
+        /**
+         * Same as ListApplicationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListApplicationsOutcomeCallable ListApplicationsCallable(Model::ListApplicationsRequest&& request) const;
+
         /**
          * <p>Lists the ARNs of the applications within this AWS account. For more
          * information about applications, see <a
@@ -674,6 +878,11 @@ namespace Model
          */
         virtual void ListApplicationsAsync(const Model::ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListApplicationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListApplicationsAsync(Model::ListApplicationsRequest&& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the agents of the assessment specified by the assessment ARN.</p>
          */
@@ -686,6 +895,11 @@ namespace Model
          */
         virtual Model::ListAssessmentAgentsOutcomeCallable ListAssessmentAgentsCallable(const Model::ListAssessmentAgentsRequest& request) const;
 
+        /**
+         * Same as ListAssessmentAgentsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAssessmentAgentsOutcomeCallable ListAssessmentAgentsCallable(Model::ListAssessmentAgentsRequest&& request) const;
+
         /**
          * <p>Lists the agents of the assessment specified by the assessment ARN.</p>
          *
@@ -693,6 +907,11 @@ namespace Model
          */
         virtual void ListAssessmentAgentsAsync(const Model::ListAssessmentAgentsRequest& request, const ListAssessmentAgentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAssessmentAgentsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAssessmentAgentsAsync(Model::ListAssessmentAgentsRequest&& request, const ListAssessmentAgentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the assessments corresponding to applications specified by the
          * applications' ARNs.</p>
@@ -707,6 +926,11 @@ namespace Model
          */
         virtual Model::ListAssessmentsOutcomeCallable ListAssessmentsCallable(const Model::ListAssessmentsRequest& request) const;
 
+        /**
+         * Same as ListAssessmentsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAssessmentsOutcomeCallable ListAssessmentsCallable(Model::ListAssessmentsRequest&& request) const;
+
         /**
          * <p>Lists the assessments corresponding to applications specified by the
          * applications' ARNs.</p>
@@ -715,6 +939,11 @@ namespace Model
          */
         virtual void ListAssessmentsAsync(const Model::ListAssessmentsRequest& request, const ListAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAssessmentsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAssessmentsAsync(Model::ListAssessmentsRequest&& request, const ListAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the assessments attached to the rules package specified by the rules
          * package ARN.</p>
@@ -729,6 +958,11 @@ namespace Model
          */
         virtual Model::ListAttachedAssessmentsOutcomeCallable ListAttachedAssessmentsCallable(const Model::ListAttachedAssessmentsRequest& request) const;
 
+        /**
+         * Same as ListAttachedAssessmentsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAttachedAssessmentsOutcomeCallable ListAttachedAssessmentsCallable(Model::ListAttachedAssessmentsRequest&& request) const;
+
         /**
          * <p>Lists the assessments attached to the rules package specified by the rules
          * package ARN.</p>
@@ -737,6 +971,11 @@ namespace Model
          */
         virtual void ListAttachedAssessmentsAsync(const Model::ListAttachedAssessmentsRequest& request, const ListAttachedAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAttachedAssessmentsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAttachedAssessmentsAsync(Model::ListAttachedAssessmentsRequest&& request, const ListAttachedAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the rules packages attached to the assessment specified by the
          * assessment ARN.</p>
@@ -751,6 +990,11 @@ namespace Model
          */
         virtual Model::ListAttachedRulesPackagesOutcomeCallable ListAttachedRulesPackagesCallable(const Model::ListAttachedRulesPackagesRequest& request) const;
 
+        /**
+         * Same as ListAttachedRulesPackagesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAttachedRulesPackagesOutcomeCallable ListAttachedRulesPackagesCallable(Model::ListAttachedRulesPackagesRequest&& request) const;
+
         /**
          * <p>Lists the rules packages attached to the assessment specified by the
          * assessment ARN.</p>
@@ -759,6 +1003,11 @@ namespace Model
          */
         virtual void ListAttachedRulesPackagesAsync(const Model::ListAttachedRulesPackagesRequest& request, const ListAttachedRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAttachedRulesPackagesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAttachedRulesPackagesAsync(Model::ListAttachedRulesPackagesRequest&& request, const ListAttachedRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists findings generated by the assessment run specified by the run ARNs.</p>
          */
@@ -771,6 +1020,11 @@ namespace Model
          */
         virtual Model::ListFindingsOutcomeCallable ListFindingsCallable(const Model::ListFindingsRequest& request) const;
 
+        /**
+         * Same as ListFindingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListFindingsOutcomeCallable ListFindingsCallable(Model::ListFindingsRequest&& request) const;
+
         /**
          * <p>Lists findings generated by the assessment run specified by the run ARNs.</p>
          *
@@ -778,6 +1032,11 @@ namespace Model
          */
         virtual void ListFindingsAsync(const Model::ListFindingsRequest& request, const ListFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListFindingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListFindingsAsync(Model::ListFindingsRequest&& request, const ListFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all available Inspector rules packages.</p>
          */
@@ -790,6 +1049,11 @@ namespace Model
          */
         virtual Model::ListRulesPackagesOutcomeCallable ListRulesPackagesCallable(const Model::ListRulesPackagesRequest& request) const;
 
+        /**
+         * Same as ListRulesPackagesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListRulesPackagesOutcomeCallable ListRulesPackagesCallable(Model::ListRulesPackagesRequest&& request) const;
+
         /**
          * <p>Lists all available Inspector rules packages.</p>
          *
@@ -797,6 +1061,11 @@ namespace Model
          */
         virtual void ListRulesPackagesAsync(const Model::ListRulesPackagesRequest& request, const ListRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRulesPackagesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListRulesPackagesAsync(Model::ListRulesPackagesRequest&& request, const ListRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the assessment runs associated with the assessments specified by the
          * assessment ARNs.</p>
@@ -811,6 +1080,11 @@ namespace Model
          */
         virtual Model::ListRunsOutcomeCallable ListRunsCallable(const Model::ListRunsRequest& request) const;
 
+        /**
+         * Same as ListRunsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListRunsOutcomeCallable ListRunsCallable(Model::ListRunsRequest&& request) const;
+
         /**
          * <p>Lists the assessment runs associated with the assessments specified by the
          * assessment ARNs.</p>
@@ -819,6 +1093,11 @@ namespace Model
          */
         virtual void ListRunsAsync(const Model::ListRunsRequest& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRunsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListRunsAsync(Model::ListRunsRequest&& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all tags associated with a resource.</p>
          */
@@ -831,6 +1110,11 @@ namespace Model
          */
         virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(const Model::ListTagsForResourceRequest& request) const;
 
+        /**
+         * Same as ListTagsForResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(Model::ListTagsForResourceRequest&& request) const;
+
         /**
          * <p>Lists all tags associated with a resource.</p>
          *
@@ -838,6 +1122,11 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTagsForResourceAsync(Model::ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Translates a textual identifier into a user-readable text in a specified
          * locale.</p>
@@ -852,6 +1141,11 @@ namespace Model
          */
         virtual Model::LocalizeTextOutcomeCallable LocalizeTextCallable(const Model::LocalizeTextRequest& request) const;
 
+        /**
+         * Same as LocalizeTextCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::LocalizeTextOutcomeCallable LocalizeTextCallable(Model::LocalizeTextRequest&& request) const;
+
         /**
          * <p>Translates a textual identifier into a user-readable text in a specified
          * locale.</p>
@@ -860,6 +1154,11 @@ namespace Model
          */
         virtual void LocalizeTextAsync(const Model::LocalizeTextRequest& request, const LocalizeTextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as LocalizeTextAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void LocalizeTextAsync(Model::LocalizeTextRequest&& request, const LocalizeTextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Previews the agents installed on the EC2 instances that are included in the
          * application created with the specified resource group.</p>
@@ -874,6 +1173,11 @@ namespace Model
          */
         virtual Model::PreviewAgentsForResourceGroupOutcomeCallable PreviewAgentsForResourceGroupCallable(const Model::PreviewAgentsForResourceGroupRequest& request) const;
 
+        /**
+         * Same as PreviewAgentsForResourceGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PreviewAgentsForResourceGroupOutcomeCallable PreviewAgentsForResourceGroupCallable(Model::PreviewAgentsForResourceGroupRequest&& request) const;
+
         /**
          * <p>Previews the agents installed on the EC2 instances that are included in the
          * application created with the specified resource group.</p>
@@ -882,6 +1186,11 @@ namespace Model
          */
         virtual void PreviewAgentsForResourceGroupAsync(const Model::PreviewAgentsForResourceGroupRequest& request, const PreviewAgentsForResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PreviewAgentsForResourceGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PreviewAgentsForResourceGroupAsync(Model::PreviewAgentsForResourceGroupRequest&& request, const PreviewAgentsForResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Register the role that Inspector uses to list your EC2 instances during the
          * assessment.</p>
@@ -896,6 +1205,11 @@ namespace Model
          */
         virtual Model::RegisterCrossAccountAccessRoleOutcomeCallable RegisterCrossAccountAccessRoleCallable(const Model::RegisterCrossAccountAccessRoleRequest& request) const;
 
+        /**
+         * Same as RegisterCrossAccountAccessRoleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterCrossAccountAccessRoleOutcomeCallable RegisterCrossAccountAccessRoleCallable(Model::RegisterCrossAccountAccessRoleRequest&& request) const;
+
         /**
          * <p>Register the role that Inspector uses to list your EC2 instances during the
          * assessment.</p>
@@ -904,6 +1218,11 @@ namespace Model
          */
         virtual void RegisterCrossAccountAccessRoleAsync(const Model::RegisterCrossAccountAccessRoleRequest& request, const RegisterCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterCrossAccountAccessRoleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterCrossAccountAccessRoleAsync(Model::RegisterCrossAccountAccessRoleRequest&& request, const RegisterCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the entire attribute (key and value pair) from the findings specified
          * by the finding ARNs where an attribute with the specified key exists.</p>
@@ -918,6 +1237,11 @@ namespace Model
          */
         virtual Model::RemoveAttributesFromFindingsOutcomeCallable RemoveAttributesFromFindingsCallable(const Model::RemoveAttributesFromFindingsRequest& request) const;
 
+        /**
+         * Same as RemoveAttributesFromFindingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveAttributesFromFindingsOutcomeCallable RemoveAttributesFromFindingsCallable(Model::RemoveAttributesFromFindingsRequest&& request) const;
+
         /**
          * <p>Removes the entire attribute (key and value pair) from the findings specified
          * by the finding ARNs where an attribute with the specified key exists.</p>
@@ -926,6 +1250,11 @@ namespace Model
          */
         virtual void RemoveAttributesFromFindingsAsync(const Model::RemoveAttributesFromFindingsRequest& request, const RemoveAttributesFromFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveAttributesFromFindingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveAttributesFromFindingsAsync(Model::RemoveAttributesFromFindingsRequest&& request, const RemoveAttributesFromFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts the analysis of the application’s behavior against selected rule
          * packages for the assessment specified by the assessment ARN.</p>
@@ -940,6 +1269,11 @@ namespace Model
          */
         virtual Model::RunAssessmentOutcomeCallable RunAssessmentCallable(const Model::RunAssessmentRequest& request) const;
 
+        /**
+         * Same as RunAssessmentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RunAssessmentOutcomeCallable RunAssessmentCallable(Model::RunAssessmentRequest&& request) const;
+
         /**
          * <p>Starts the analysis of the application’s behavior against selected rule
          * packages for the assessment specified by the assessment ARN.</p>
@@ -948,6 +1282,11 @@ namespace Model
          */
         virtual void RunAssessmentAsync(const Model::RunAssessmentRequest& request, const RunAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RunAssessmentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RunAssessmentAsync(Model::RunAssessmentRequest&& request, const RunAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets tags (key and value pairs) to the assessment specified by the assessment
          * ARN.</p>
@@ -962,6 +1301,11 @@ namespace Model
          */
         virtual Model::SetTagsForResourceOutcomeCallable SetTagsForResourceCallable(const Model::SetTagsForResourceRequest& request) const;
 
+        /**
+         * Same as SetTagsForResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetTagsForResourceOutcomeCallable SetTagsForResourceCallable(Model::SetTagsForResourceRequest&& request) const;
+
         /**
          * <p>Sets tags (key and value pairs) to the assessment specified by the assessment
          * ARN.</p>
@@ -970,6 +1314,11 @@ namespace Model
          */
         virtual void SetTagsForResourceAsync(const Model::SetTagsForResourceRequest& request, const SetTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetTagsForResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetTagsForResourceAsync(Model::SetTagsForResourceRequest&& request, const SetTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts data collection for the assessment specified by the assessment ARN.
          * For this API to function properly, you must not exceed the limit of running up
@@ -986,6 +1335,11 @@ namespace Model
          */
         virtual Model::StartDataCollectionOutcomeCallable StartDataCollectionCallable(const Model::StartDataCollectionRequest& request) const;
 
+        /**
+         * Same as StartDataCollectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StartDataCollectionOutcomeCallable StartDataCollectionCallable(Model::StartDataCollectionRequest&& request) const;
+
         /**
          * <p>Starts data collection for the assessment specified by the assessment ARN.
          * For this API to function properly, you must not exceed the limit of running up
@@ -995,6 +1349,11 @@ namespace Model
          */
         virtual void StartDataCollectionAsync(const Model::StartDataCollectionRequest& request, const StartDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartDataCollectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StartDataCollectionAsync(Model::StartDataCollectionRequest&& request, const StartDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stop data collection for the assessment specified by the assessment ARN.</p>
          */
@@ -1007,6 +1366,11 @@ namespace Model
          */
         virtual Model::StopDataCollectionOutcomeCallable StopDataCollectionCallable(const Model::StopDataCollectionRequest& request) const;
 
+        /**
+         * Same as StopDataCollectionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StopDataCollectionOutcomeCallable StopDataCollectionCallable(Model::StopDataCollectionRequest&& request) const;
+
         /**
          * <p>Stop data collection for the assessment specified by the assessment ARN.</p>
          *
@@ -1014,6 +1378,11 @@ namespace Model
          */
         virtual void StopDataCollectionAsync(const Model::StopDataCollectionRequest& request, const StopDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopDataCollectionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StopDataCollectionAsync(Model::StopDataCollectionRequest&& request, const StopDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates application specified by the application ARN.</p>
          */
@@ -1026,6 +1395,11 @@ namespace Model
          */
         virtual Model::UpdateApplicationOutcomeCallable UpdateApplicationCallable(const Model::UpdateApplicationRequest& request) const;
 
+        /**
+         * Same as UpdateApplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateApplicationOutcomeCallable UpdateApplicationCallable(Model::UpdateApplicationRequest&& request) const;
+
         /**
          * <p>Updates application specified by the application ARN.</p>
          *
@@ -1033,6 +1407,11 @@ namespace Model
          */
         virtual void UpdateApplicationAsync(const Model::UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateApplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateApplicationAsync(Model::UpdateApplicationRequest&& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the assessment specified by the assessment ARN.</p>
          */
@@ -1045,6 +1424,11 @@ namespace Model
          */
         virtual Model::UpdateAssessmentOutcomeCallable UpdateAssessmentCallable(const Model::UpdateAssessmentRequest& request) const;
 
+        /**
+         * Same as UpdateAssessmentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateAssessmentOutcomeCallable UpdateAssessmentCallable(Model::UpdateAssessmentRequest&& request) const;
+
         /**
          * <p>Updates the assessment specified by the assessment ARN.</p>
          *
@@ -1052,6 +1436,89 @@ namespace Model
          */
         virtual void UpdateAssessmentAsync(const Model::UpdateAssessmentRequest& request, const UpdateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAssessmentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateAssessmentAsync(Model::UpdateAssessmentRequest&& request, const UpdateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AddAttributesToFindingsOutcome> AddAttributesToFindingsAwaitable(const Model::AddAttributesToFindingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::AddAttributesToFindings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddAttributesToFindingsOutcome> AddAttributesToFindingsAwaitable(Model::AddAttributesToFindingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::AddAttributesToFindings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachAssessmentAndRulesPackageOutcome> AttachAssessmentAndRulesPackageAwaitable(const Model::AttachAssessmentAndRulesPackageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::AttachAssessmentAndRulesPackage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachAssessmentAndRulesPackageOutcome> AttachAssessmentAndRulesPackageAwaitable(Model::AttachAssessmentAndRulesPackageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::AttachAssessmentAndRulesPackage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateApplicationOutcome> CreateApplicationAwaitable(const Model::CreateApplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::CreateApplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateApplicationOutcome> CreateApplicationAwaitable(Model::CreateApplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::CreateApplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAssessmentOutcome> CreateAssessmentAwaitable(const Model::CreateAssessmentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::CreateAssessment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAssessmentOutcome> CreateAssessmentAwaitable(Model::CreateAssessmentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::CreateAssessment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateResourceGroupOutcome> CreateResourceGroupAwaitable(const Model::CreateResourceGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::CreateResourceGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateResourceGroupOutcome> CreateResourceGroupAwaitable(Model::CreateResourceGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::CreateResourceGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteApplicationOutcome> DeleteApplicationAwaitable(const Model::DeleteApplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DeleteApplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteApplicationOutcome> DeleteApplicationAwaitable(Model::DeleteApplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DeleteApplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAssessmentOutcome> DeleteAssessmentAwaitable(const Model::DeleteAssessmentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DeleteAssessment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAssessmentOutcome> DeleteAssessmentAwaitable(Model::DeleteAssessmentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DeleteAssessment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRunOutcome> DeleteRunAwaitable(const Model::DeleteRunRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DeleteRun, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRunOutcome> DeleteRunAwaitable(Model::DeleteRunRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DeleteRun, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeApplicationOutcome> DescribeApplicationAwaitable(const Model::DescribeApplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DescribeApplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeApplicationOutcome> DescribeApplicationAwaitable(Model::DescribeApplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DescribeApplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAssessmentOutcome> DescribeAssessmentAwaitable(const Model::DescribeAssessmentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DescribeAssessment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAssessmentOutcome> DescribeAssessmentAwaitable(Model::DescribeAssessmentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DescribeAssessment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCrossAccountAccessRoleOutcome> DescribeCrossAccountAccessRoleAwaitable() const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DescribeCrossAccountAccessRole, this); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFindingOutcome> DescribeFindingAwaitable(const Model::DescribeFindingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DescribeFinding, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeFindingOutcome> DescribeFindingAwaitable(Model::DescribeFindingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DescribeFinding, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeResourceGroupOutcome> DescribeResourceGroupAwaitable(const Model::DescribeResourceGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DescribeResourceGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeResourceGroupOutcome> DescribeResourceGroupAwaitable(Model::DescribeResourceGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DescribeResourceGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRulesPackageOutcome> DescribeRulesPackageAwaitable(const Model::DescribeRulesPackageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DescribeRulesPackage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRulesPackageOutcome> DescribeRulesPackageAwaitable(Model::DescribeRulesPackageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DescribeRulesPackage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRunOutcome> DescribeRunAwaitable(const Model::DescribeRunRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DescribeRun, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRunOutcome> DescribeRunAwaitable(Model::DescribeRunRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DescribeRun, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachAssessmentAndRulesPackageOutcome> DetachAssessmentAndRulesPackageAwaitable(const Model::DetachAssessmentAndRulesPackageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DetachAssessmentAndRulesPackage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachAssessmentAndRulesPackageOutcome> DetachAssessmentAndRulesPackageAwaitable(Model::DetachAssessmentAndRulesPackageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::DetachAssessmentAndRulesPackage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAssessmentTelemetryOutcome> GetAssessmentTelemetryAwaitable(const Model::GetAssessmentTelemetryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::GetAssessmentTelemetry, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAssessmentTelemetryOutcome> GetAssessmentTelemetryAwaitable(Model::GetAssessmentTelemetryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::GetAssessmentTelemetry, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListApplicationsOutcome> ListApplicationsAwaitable(const Model::ListApplicationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListApplications, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListApplicationsOutcome> ListApplicationsAwaitable(Model::ListApplicationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListApplications, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAssessmentAgentsOutcome> ListAssessmentAgentsAwaitable(const Model::ListAssessmentAgentsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListAssessmentAgents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAssessmentAgentsOutcome> ListAssessmentAgentsAwaitable(Model::ListAssessmentAgentsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListAssessmentAgents, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAssessmentsOutcome> ListAssessmentsAwaitable(const Model::ListAssessmentsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListAssessments, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAssessmentsOutcome> ListAssessmentsAwaitable(Model::ListAssessmentsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListAssessments, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAttachedAssessmentsOutcome> ListAttachedAssessmentsAwaitable(const Model::ListAttachedAssessmentsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListAttachedAssessments, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAttachedAssessmentsOutcome> ListAttachedAssessmentsAwaitable(Model::ListAttachedAssessmentsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListAttachedAssessments, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAttachedRulesPackagesOutcome> ListAttachedRulesPackagesAwaitable(const Model::ListAttachedRulesPackagesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListAttachedRulesPackages, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAttachedRulesPackagesOutcome> ListAttachedRulesPackagesAwaitable(Model::ListAttachedRulesPackagesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListAttachedRulesPackages, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListFindingsOutcome> ListFindingsAwaitable(const Model::ListFindingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListFindings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListFindingsOutcome> ListFindingsAwaitable(Model::ListFindingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListFindings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRulesPackagesOutcome> ListRulesPackagesAwaitable(const Model::ListRulesPackagesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListRulesPackages, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRulesPackagesOutcome> ListRulesPackagesAwaitable(Model::ListRulesPackagesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListRulesPackages, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRunsOutcome> ListRunsAwaitable(const Model::ListRunsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListRuns, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRunsOutcome> ListRunsAwaitable(Model::ListRunsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListRuns, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(const Model::ListTagsForResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListTagsForResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(Model::ListTagsForResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::ListTagsForResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::LocalizeTextOutcome> LocalizeTextAwaitable(const Model::LocalizeTextRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::LocalizeText, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::LocalizeTextOutcome> LocalizeTextAwaitable(Model::LocalizeTextRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::LocalizeText, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PreviewAgentsForResourceGroupOutcome> PreviewAgentsForResourceGroupAwaitable(const Model::PreviewAgentsForResourceGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::PreviewAgentsForResourceGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PreviewAgentsForResourceGroupOutcome> PreviewAgentsForResourceGroupAwaitable(Model::PreviewAgentsForResourceGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::PreviewAgentsForResourceGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterCrossAccountAccessRoleOutcome> RegisterCrossAccountAccessRoleAwaitable(const Model::RegisterCrossAccountAccessRoleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::RegisterCrossAccountAccessRole, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterCrossAccountAccessRoleOutcome> RegisterCrossAccountAccessRoleAwaitable(Model::RegisterCrossAccountAccessRoleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::RegisterCrossAccountAccessRole, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveAttributesFromFindingsOutcome> RemoveAttributesFromFindingsAwaitable(const Model::RemoveAttributesFromFindingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::RemoveAttributesFromFindings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveAttributesFromFindingsOutcome> RemoveAttributesFromFindingsAwaitable(Model::RemoveAttributesFromFindingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::RemoveAttributesFromFindings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RunAssessmentOutcome> RunAssessmentAwaitable(const Model::RunAssessmentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::RunAssessment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RunAssessmentOutcome> RunAssessmentAwaitable(Model::RunAssessmentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::RunAssessment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetTagsForResourceOutcome> SetTagsForResourceAwaitable(const Model::SetTagsForResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::SetTagsForResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetTagsForResourceOutcome> SetTagsForResourceAwaitable(Model::SetTagsForResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::SetTagsForResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartDataCollectionOutcome> StartDataCollectionAwaitable(const Model::StartDataCollectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::StartDataCollection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartDataCollectionOutcome> StartDataCollectionAwaitable(Model::StartDataCollectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::StartDataCollection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopDataCollectionOutcome> StopDataCollectionAwaitable(const Model::StopDataCollectionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::StopDataCollection, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopDataCollectionOutcome> StopDataCollectionAwaitable(Model::StopDataCollectionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::StopDataCollection, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateApplicationOutcome> UpdateApplicationAwaitable(const Model::UpdateApplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::UpdateApplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateApplicationOutcome> UpdateApplicationAwaitable(Model::UpdateApplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::UpdateApplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAssessmentOutcome> UpdateAssessmentAwaitable(const Model::UpdateAssessmentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::UpdateAssessment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAssessmentOutcome> UpdateAssessmentAwaitable(Model::UpdateAssessmentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &InspectorClient::UpdateAssessment, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -142,12 +142,22 @@ AddAttributesToFindingsOutcome InspectorClient::AddAttributesToFindings(const Ad
 
 AddAttributesToFindingsOutcomeCallable InspectorClient::AddAttributesToFindingsCallable(const AddAttributesToFindingsRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::AddAttributesToFindings, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::AddAttributesToFindings, Aws::Client::RejectedCallOutcome<AddAttributesToFindingsOutcome>(), this, request);
+}
+
+AddAttributesToFindingsOutcomeCallable InspectorClient::AddAttributesToFindingsCallable(AddAttributesToFindingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::AddAttributesToFindings, Aws::Client::RejectedCallOutcome<AddAttributesToFindingsOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::AddAttributesToFindingsAsync(const AddAttributesToFindingsRequest& request, const AddAttributesToFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::AddAttributesToFindingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::AddAttributesToFindingsAsyncHelper, Aws::Client::RejectedAsyncCall<AddAttributesToFindingsOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::AddAttributesToFindingsAsync(AddAttributesToFindingsRequest&& request, const AddAttributesToFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::AddAttributesToFindingsAsyncHelper, Aws::Client::RejectedAsyncCall<AddAttributesToFindingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::AddAttributesToFindingsAsyncHelper(const AddAttributesToFindingsRequest& request, const AddAttributesToFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -173,12 +183,22 @@ AttachAssessmentAndRulesPackageOutcome InspectorClient::AttachAssessmentAndRules
 
 AttachAssessmentAndRulesPackageOutcomeCallable InspectorClient::AttachAssessmentAndRulesPackageCallable(const AttachAssessmentAndRulesPackageRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::AttachAssessmentAndRulesPackage, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::AttachAssessmentAndRulesPackage, Aws::Client::RejectedCallOutcome<AttachAssessmentAndRulesPackageOutcome>(), this, request);
+}
+
+AttachAssessmentAndRulesPackageOutcomeCallable InspectorClient::AttachAssessmentAndRulesPackageCallable(AttachAssessmentAndRulesPackageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::AttachAssessmentAndRulesPackage, Aws::Client::RejectedCallOutcome<AttachAssessmentAndRulesPackageOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::AttachAssessmentAndRulesPackageAsync(const AttachAssessmentAndRulesPackageRequest& request, const AttachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::AttachAssessmentAndRulesPackageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::AttachAssessmentAndRulesPackageAsyncHelper, Aws::Client::RejectedAsyncCall<AttachAssessmentAndRulesPackageOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::AttachAssessmentAndRulesPackageAsync(AttachAssessmentAndRulesPackageRequest&& request, const AttachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::AttachAssessmentAndRulesPackageAsyncHelper, Aws::Client::RejectedAsyncCall<AttachAssessmentAndRulesPackageOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::AttachAssessmentAndRulesPackageAsyncHelper(const AttachAssessmentAndRulesPackageRequest& request, const AttachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -204,12 +224,22 @@ CreateApplicationOutcome InspectorClient::CreateApplication(const CreateApplicat
 
 CreateApplicationOutcomeCallable InspectorClient::CreateApplicationCallable(const CreateApplicationRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::CreateApplication, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::CreateApplication, Aws::Client::RejectedCallOutcome<CreateApplicationOutcome>(), this, request);
+}
+
+CreateApplicationOutcomeCallable InspectorClient::CreateApplicationCallable(CreateApplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::CreateApplication, Aws::Client::RejectedCallOutcome<CreateApplicationOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::CreateApplicationAsync(const CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::CreateApplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::CreateApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateApplicationOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::CreateApplicationAsync(CreateApplicationRequest&& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::CreateApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateApplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::CreateApplicationAsyncHelper(const CreateApplicationRequest& request, const CreateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -235,12 +265,22 @@ CreateAssessmentOutcome InspectorClient::CreateAssessment(const CreateAssessment
 
 CreateAssessmentOutcomeCallable InspectorClient::CreateAssessmentCallable(const CreateAssessmentRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::CreateAssessment, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::CreateAssessment, Aws::Client::RejectedCallOutcome<CreateAssessmentOutcome>(), this, request);
+}
+
+CreateAssessmentOutcomeCallable InspectorClient::CreateAssessmentCallable(CreateAssessmentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::CreateAssessment, Aws::Client::RejectedCallOutcome<CreateAssessmentOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::CreateAssessmentAsync(const CreateAssessmentRequest& request, const CreateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::CreateAssessmentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::CreateAssessmentAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAssessmentOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::CreateAssessmentAsync(CreateAssessmentRequest&& request, const CreateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::CreateAssessmentAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAssessmentOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::CreateAssessmentAsyncHelper(const CreateAssessmentRequest& request, const CreateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -266,12 +306,22 @@ CreateResourceGroupOutcome InspectorClient::CreateResourceGroup(const CreateReso
 
 CreateResourceGroupOutcomeCallable InspectorClient::CreateResourceGroupCallable(const CreateResourceGroupRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::CreateResourceGroup, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::CreateResourceGroup, Aws::Client::RejectedCallOutcome<CreateResourceGroupOutcome>(), this, request);
+}
+
+CreateResourceGroupOutcomeCallable InspectorClient::CreateResourceGroupCallable(CreateResourceGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::CreateResourceGroup, Aws::Client::RejectedCallOutcome<CreateResourceGroupOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::CreateResourceGroupAsync(const CreateResourceGroupRequest& request, const CreateResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::CreateResourceGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::CreateResourceGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateResourceGroupOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::CreateResourceGroupAsync(CreateResourceGroupRequest&& request, const CreateResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::CreateResourceGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateResourceGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::CreateResourceGroupAsyncHelper(const CreateResourceGroupRequest& request, const CreateResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -297,12 +347,22 @@ DeleteApplicationOutcome InspectorClient::DeleteApplication(const DeleteApplicat
 
 DeleteApplicationOutcomeCallable InspectorClient::DeleteApplicationCallable(const DeleteApplicationRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::DeleteApplication, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::DeleteApplication, Aws::Client::RejectedCallOutcome<DeleteApplicationOutcome>(), this, request);
+}
+
+DeleteApplicationOutcomeCallable InspectorClient::DeleteApplicationCallable(DeleteApplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::DeleteApplication, Aws::Client::RejectedCallOutcome<DeleteApplicationOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::DeleteApplicationAsync(const DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::DeleteApplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::DeleteApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteApplicationOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::DeleteApplicationAsync(DeleteApplicationRequest&& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::DeleteApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteApplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::DeleteApplicationAsyncHelper(const DeleteApplicationRequest& request, const DeleteApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -328,12 +388,22 @@ DeleteAssessmentOutcome InspectorClient::DeleteAssessment(const DeleteAssessment
 
 DeleteAssessmentOutcomeCallable InspectorClient::DeleteAssessmentCallable(const DeleteAssessmentRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::DeleteAssessment, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::DeleteAssessment, Aws::Client::RejectedCallOutcome<DeleteAssessmentOutcome>(), this, request);
+}
+
+DeleteAssessmentOutcomeCallable InspectorClient::DeleteAssessmentCallable(DeleteAssessmentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::DeleteAssessment, Aws::Client::RejectedCallOutcome<DeleteAssessmentOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::DeleteAssessmentAsync(const DeleteAssessmentRequest& request, const DeleteAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::DeleteAssessmentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::DeleteAssessmentAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAssessmentOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::DeleteAssessmentAsync(DeleteAssessmentRequest&& request, const DeleteAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::DeleteAssessmentAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAssessmentOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::DeleteAssessmentAsyncHelper(const DeleteAssessmentRequest& request, const DeleteAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -359,12 +429,22 @@ DeleteRunOutcome InspectorClient::DeleteRun(const DeleteRunRequest& request) con
 
 DeleteRunOutcomeCallable InspectorClient::DeleteRunCallable(const DeleteRunRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::DeleteRun, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::DeleteRun, Aws::Client::RejectedCallOutcome<DeleteRunOutcome>(), this, request);
+}
+
+DeleteRunOutcomeCallable InspectorClient::DeleteRunCallable(DeleteRunRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::DeleteRun, Aws::Client::RejectedCallOutcome<DeleteRunOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::DeleteRunAsync(const DeleteRunRequest& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::DeleteRunAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::DeleteRunAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRunOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::DeleteRunAsync(DeleteRunRequest&& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::DeleteRunAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRunOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::DeleteRunAsyncHelper(const DeleteRunRequest& request, const DeleteRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -390,12 +470,22 @@ DescribeApplicationOutcome InspectorClient::DescribeApplication(const DescribeAp
 
 DescribeApplicationOutcomeCallable InspectorClient::DescribeApplicationCallable(const DescribeApplicationRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::DescribeApplication, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::DescribeApplication, Aws::Client::RejectedCallOutcome<DescribeApplicationOutcome>(), this, request);
+}
+
+DescribeApplicationOutcomeCallable InspectorClient::DescribeApplicationCallable(DescribeApplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::DescribeApplication, Aws::Client::RejectedCallOutcome<DescribeApplicationOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::DescribeApplicationAsync(const DescribeApplicationRequest& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::DescribeApplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::DescribeApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeApplicationOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::DescribeApplicationAsync(DescribeApplicationRequest&& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::DescribeApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeApplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::DescribeApplicationAsyncHelper(const DescribeApplicationRequest& request, const DescribeApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -421,12 +511,22 @@ DescribeAssessmentOutcome InspectorClient::DescribeAssessment(const DescribeAsse
 
 DescribeAssessmentOutcomeCallable InspectorClient::DescribeAssessmentCallable(const DescribeAssessmentRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::DescribeAssessment, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::DescribeAssessment, Aws::Client::RejectedCallOutcome<DescribeAssessmentOutcome>(), this, request);
+}
+
+DescribeAssessmentOutcomeCallable InspectorClient::DescribeAssessmentCallable(DescribeAssessmentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::DescribeAssessment, Aws::Client::RejectedCallOutcome<DescribeAssessmentOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::DescribeAssessmentAsync(const DescribeAssessmentRequest& request, const DescribeAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::DescribeAssessmentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::DescribeAssessmentAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAssessmentOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::DescribeAssessmentAsync(DescribeAssessmentRequest&& request, const DescribeAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::DescribeAssessmentAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAssessmentOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::DescribeAssessmentAsyncHelper(const DescribeAssessmentRequest& request, const DescribeAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -452,12 +552,12 @@ DescribeCrossAccountAccessRoleOutcome InspectorClient::DescribeCrossAccountAcces
 
 DescribeCrossAccountAccessRoleOutcomeCallable InspectorClient::DescribeCrossAccountAccessRoleCallable() const
 {
-  return std::async(std::launch::async, &InspectorClient::DescribeCrossAccountAccessRole, this);
+  return m_executor->SubmitWithFuture(&InspectorClient::DescribeCrossAccountAccessRole, Aws::Client::RejectedCallOutcome<DescribeCrossAccountAccessRoleOutcome>(), this);
 }
 
 void InspectorClient::DescribeCrossAccountAccessRoleAsync(const DescribeCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::DescribeCrossAccountAccessRoleAsyncHelper, this, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::DescribeCrossAccountAccessRoleAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCrossAccountAccessRoleOutcome>(), this, handler, context);
 }
 
 void InspectorClient::DescribeCrossAccountAccessRoleAsyncHelper(const DescribeCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -483,12 +583,22 @@ DescribeFindingOutcome InspectorClient::DescribeFinding(const DescribeFindingReq
 
 DescribeFindingOutcomeCallable InspectorClient::DescribeFindingCallable(const DescribeFindingRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::DescribeFinding, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::DescribeFinding, Aws::Client::RejectedCallOutcome<DescribeFindingOutcome>(), this, request);
+}
+
+DescribeFindingOutcomeCallable InspectorClient::DescribeFindingCallable(DescribeFindingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::DescribeFinding, Aws::Client::RejectedCallOutcome<DescribeFindingOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::DescribeFindingAsync(const DescribeFindingRequest& request, const DescribeFindingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::DescribeFindingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::DescribeFindingAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFindingOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::DescribeFindingAsync(DescribeFindingRequest&& request, const DescribeFindingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::DescribeFindingAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeFindingOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::DescribeFindingAsyncHelper(const DescribeFindingRequest& request, const DescribeFindingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -514,12 +624,22 @@ DescribeResourceGroupOutcome InspectorClient::DescribeResourceGroup(const Descri
 
 DescribeResourceGroupOutcomeCallable InspectorClient::DescribeResourceGroupCallable(const DescribeResourceGroupRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::DescribeResourceGroup, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::DescribeResourceGroup, Aws::Client::RejectedCallOutcome<DescribeResourceGroupOutcome>(), this, request);
+}
+
+DescribeResourceGroupOutcomeCallable InspectorClient::DescribeResourceGroupCallable(DescribeResourceGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::DescribeResourceGroup, Aws::Client::RejectedCallOutcome<DescribeResourceGroupOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::DescribeResourceGroupAsync(const DescribeResourceGroupRequest& request, const DescribeResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::DescribeResourceGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::DescribeResourceGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeResourceGroupOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::DescribeResourceGroupAsync(DescribeResourceGroupRequest&& request, const DescribeResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::DescribeResourceGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeResourceGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::DescribeResourceGroupAsyncHelper(const DescribeResourceGroupRequest& request, const DescribeResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -545,12 +665,22 @@ DescribeRulesPackageOutcome InspectorClient::DescribeRulesPackage(const Describe
 
 DescribeRulesPackageOutcomeCallable InspectorClient::DescribeRulesPackageCallable(const DescribeRulesPackageRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::DescribeRulesPackage, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::DescribeRulesPackage, Aws::Client::RejectedCallOutcome<DescribeRulesPackageOutcome>(), this, request);
+}
+
+DescribeRulesPackageOutcomeCallable InspectorClient::DescribeRulesPackageCallable(DescribeRulesPackageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::DescribeRulesPackage, Aws::Client::RejectedCallOutcome<DescribeRulesPackageOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::DescribeRulesPackageAsync(const DescribeRulesPackageRequest& request, const DescribeRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::DescribeRulesPackageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::DescribeRulesPackageAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRulesPackageOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::DescribeRulesPackageAsync(DescribeRulesPackageRequest&& request, const DescribeRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::DescribeRulesPackageAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRulesPackageOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::DescribeRulesPackageAsyncHelper(const DescribeRulesPackageRequest& request, const DescribeRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -576,12 +706,22 @@ DescribeRunOutcome InspectorClient::DescribeRun(const DescribeRunRequest& reques
 
 DescribeRunOutcomeCallable InspectorClient::DescribeRunCallable(const DescribeRunRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::DescribeRun, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::DescribeRun, Aws::Client::RejectedCallOutcome<DescribeRunOutcome>(), this, request);
+}
+
+DescribeRunOutcomeCallable InspectorClient::DescribeRunCallable(DescribeRunRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::DescribeRun, Aws::Client::RejectedCallOutcome<DescribeRunOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::DescribeRunAsync(const DescribeRunRequest& request, const DescribeRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::DescribeRunAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::DescribeRunAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRunOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::DescribeRunAsync(DescribeRunRequest&& request, const DescribeRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::DescribeRunAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRunOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::DescribeRunAsyncHelper(const DescribeRunRequest& request, const DescribeRunResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -607,12 +747,22 @@ DetachAssessmentAndRulesPackageOutcome InspectorClient::DetachAssessmentAndRules
 
 DetachAssessmentAndRulesPackageOutcomeCallable InspectorClient::DetachAssessmentAndRulesPackageCallable(const DetachAssessmentAndRulesPackageRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::DetachAssessmentAndRulesPackage, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::DetachAssessmentAndRulesPackage, Aws::Client::RejectedCallOutcome<DetachAssessmentAndRulesPackageOutcome>(), this, request);
+}
+
+DetachAssessmentAndRulesPackageOutcomeCallable InspectorClient::DetachAssessmentAndRulesPackageCallable(DetachAssessmentAndRulesPackageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::DetachAssessmentAndRulesPackage, Aws::Client::RejectedCallOutcome<DetachAssessmentAndRulesPackageOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::DetachAssessmentAndRulesPackageAsync(const DetachAssessmentAndRulesPackageRequest& request, const DetachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::DetachAssessmentAndRulesPackageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::DetachAssessmentAndRulesPackageAsyncHelper, Aws::Client::RejectedAsyncCall<DetachAssessmentAndRulesPackageOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::DetachAssessmentAndRulesPackageAsync(DetachAssessmentAndRulesPackageRequest&& request, const DetachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::DetachAssessmentAndRulesPackageAsyncHelper, Aws::Client::RejectedAsyncCall<DetachAssessmentAndRulesPackageOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::DetachAssessmentAndRulesPackageAsyncHelper(const DetachAssessmentAndRulesPackageRequest& request, const DetachAssessmentAndRulesPackageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -638,12 +788,22 @@ GetAssessmentTelemetryOutcome InspectorClient::GetAssessmentTelemetry(const GetA
 
 GetAssessmentTelemetryOutcomeCallable InspectorClient::GetAssessmentTelemetryCallable(const GetAssessmentTelemetryRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::GetAssessmentTelemetry, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::GetAssessmentTelemetry, Aws::Client::RejectedCallOutcome<GetAssessmentTelemetryOutcome>(), this, request);
+}
+
+GetAssessmentTelemetryOutcomeCallable InspectorClient::GetAssessmentTelemetryCallable(GetAssessmentTelemetryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::GetAssessmentTelemetry, Aws::Client::RejectedCallOutcome<GetAssessmentTelemetryOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::GetAssessmentTelemetryAsync(const GetAssessmentTelemetryRequest& request, const GetAssessmentTelemetryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::GetAssessmentTelemetryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::GetAssessmentTelemetryAsyncHelper, Aws::Client::RejectedAsyncCall<GetAssessmentTelemetryOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::GetAssessmentTelemetryAsync(GetAssessmentTelemetryRequest&& request, const GetAssessmentTelemetryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::GetAssessmentTelemetryAsyncHelper, Aws::Client::RejectedAsyncCall<GetAssessmentTelemetryOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::GetAssessmentTelemetryAsyncHelper(const GetAssessmentTelemetryRequest& request, const GetAssessmentTelemetryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -669,12 +829,22 @@ ListApplicationsOutcome InspectorClient::ListApplications(const ListApplications
 
 ListApplicationsOutcomeCallable InspectorClient::ListApplicationsCallable(const ListApplicationsRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::ListApplications, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::ListApplications, Aws::Client::RejectedCallOutcome<ListApplicationsOutcome>(), this, request);
+}
+
+ListApplicationsOutcomeCallable InspectorClient::ListApplicationsCallable(ListApplicationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::ListApplications, Aws::Client::RejectedCallOutcome<ListApplicationsOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::ListApplicationsAsync(const ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::ListApplicationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::ListApplicationsAsyncHelper, Aws::Client::RejectedAsyncCall<ListApplicationsOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::ListApplicationsAsync(ListApplicationsRequest&& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::ListApplicationsAsyncHelper, Aws::Client::RejectedAsyncCall<ListApplicationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::ListApplicationsAsyncHelper(const ListApplicationsRequest& request, const ListApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -700,12 +870,22 @@ ListAssessmentAgentsOutcome InspectorClient::ListAssessmentAgents(const ListAsse
 
 ListAssessmentAgentsOutcomeCallable InspectorClient::ListAssessmentAgentsCallable(const ListAssessmentAgentsRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::ListAssessmentAgents, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::ListAssessmentAgents, Aws::Client::RejectedCallOutcome<ListAssessmentAgentsOutcome>(), this, request);
+}
+
+ListAssessmentAgentsOutcomeCallable InspectorClient::ListAssessmentAgentsCallable(ListAssessmentAgentsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::ListAssessmentAgents, Aws::Client::RejectedCallOutcome<ListAssessmentAgentsOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::ListAssessmentAgentsAsync(const ListAssessmentAgentsRequest& request, const ListAssessmentAgentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::ListAssessmentAgentsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::ListAssessmentAgentsAsyncHelper, Aws::Client::RejectedAsyncCall<ListAssessmentAgentsOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::ListAssessmentAgentsAsync(ListAssessmentAgentsRequest&& request, const ListAssessmentAgentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::ListAssessmentAgentsAsyncHelper, Aws::Client::RejectedAsyncCall<ListAssessmentAgentsOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::ListAssessmentAgentsAsyncHelper(const ListAssessmentAgentsRequest& request, const ListAssessmentAgentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -731,12 +911,22 @@ ListAssessmentsOutcome InspectorClient::ListAssessments(const ListAssessmentsReq
 
 ListAssessmentsOutcomeCallable InspectorClient::ListAssessmentsCallable(const ListAssessmentsRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::ListAssessments, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::ListAssessments, Aws::Client::RejectedCallOutcome<ListAssessmentsOutcome>(), this, request);
+}
+
+ListAssessmentsOutcomeCallable InspectorClient::ListAssessmentsCallable(ListAssessmentsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::ListAssessments, Aws::Client::RejectedCallOutcome<ListAssessmentsOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::ListAssessmentsAsync(const ListAssessmentsRequest& request, const ListAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::ListAssessmentsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::ListAssessmentsAsyncHelper, Aws::Client::RejectedAsyncCall<ListAssessmentsOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::ListAssessmentsAsync(ListAssessmentsRequest&& request, const ListAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::ListAssessmentsAsyncHelper, Aws::Client::RejectedAsyncCall<ListAssessmentsOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::ListAssessmentsAsyncHelper(const ListAssessmentsRequest& request, const ListAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -762,12 +952,22 @@ ListAttachedAssessmentsOutcome InspectorClient::ListAttachedAssessments(const Li
 
 ListAttachedAssessmentsOutcomeCallable InspectorClient::ListAttachedAssessmentsCallable(const ListAttachedAssessmentsRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::ListAttachedAssessments, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::ListAttachedAssessments, Aws::Client::RejectedCallOutcome<ListAttachedAssessmentsOutcome>(), this, request);
+}
+
+ListAttachedAssessmentsOutcomeCallable InspectorClient::ListAttachedAssessmentsCallable(ListAttachedAssessmentsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::ListAttachedAssessments, Aws::Client::RejectedCallOutcome<ListAttachedAssessmentsOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::ListAttachedAssessmentsAsync(const ListAttachedAssessmentsRequest& request, const ListAttachedAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::ListAttachedAssessmentsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::ListAttachedAssessmentsAsyncHelper, Aws::Client::RejectedAsyncCall<ListAttachedAssessmentsOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::ListAttachedAssessmentsAsync(ListAttachedAssessmentsRequest&& request, const ListAttachedAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::ListAttachedAssessmentsAsyncHelper, Aws::Client::RejectedAsyncCall<ListAttachedAssessmentsOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::ListAttachedAssessmentsAsyncHelper(const ListAttachedAssessmentsRequest& request, const ListAttachedAssessmentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -793,12 +993,22 @@ ListAttachedRulesPackagesOutcome InspectorClient::ListAttachedRulesPackages(cons
 
 ListAttachedRulesPackagesOutcomeCallable InspectorClient::ListAttachedRulesPackagesCallable(const ListAttachedRulesPackagesRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::ListAttachedRulesPackages, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::ListAttachedRulesPackages, Aws::Client::RejectedCallOutcome<ListAttachedRulesPackagesOutcome>(), this, request);
+}
+
+ListAttachedRulesPackagesOutcomeCallable InspectorClient::ListAttachedRulesPackagesCallable(ListAttachedRulesPackagesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::ListAttachedRulesPackages, Aws::Client::RejectedCallOutcome<ListAttachedRulesPackagesOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::ListAttachedRulesPackagesAsync(const ListAttachedRulesPackagesRequest& request, const ListAttachedRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::ListAttachedRulesPackagesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::ListAttachedRulesPackagesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAttachedRulesPackagesOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::ListAttachedRulesPackagesAsync(ListAttachedRulesPackagesRequest&& request, const ListAttachedRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::ListAttachedRulesPackagesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAttachedRulesPackagesOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::ListAttachedRulesPackagesAsyncHelper(const ListAttachedRulesPackagesRequest& request, const ListAttachedRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -824,12 +1034,22 @@ ListFindingsOutcome InspectorClient::ListFindings(const ListFindingsRequest& req
 
 ListFindingsOutcomeCallable InspectorClient::ListFindingsCallable(const ListFindingsRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::ListFindings, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::ListFindings, Aws::Client::RejectedCallOutcome<ListFindingsOutcome>(), this, request);
+}
+
+ListFindingsOutcomeCallable InspectorClient::ListFindingsCallable(ListFindingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::ListFindings, Aws::Client::RejectedCallOutcome<ListFindingsOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::ListFindingsAsync(const ListFindingsRequest& request, const ListFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::ListFindingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::ListFindingsAsyncHelper, Aws::Client::RejectedAsyncCall<ListFindingsOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::ListFindingsAsync(ListFindingsRequest&& request, const ListFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::ListFindingsAsyncHelper, Aws::Client::RejectedAsyncCall<ListFindingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::ListFindingsAsyncHelper(const ListFindingsRequest& request, const ListFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -855,12 +1075,22 @@ ListRulesPackagesOutcome InspectorClient::ListRulesPackages(const ListRulesPacka
 
 ListRulesPackagesOutcomeCallable InspectorClient::ListRulesPackagesCallable(const ListRulesPackagesRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::ListRulesPackages, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::ListRulesPackages, Aws::Client::RejectedCallOutcome<ListRulesPackagesOutcome>(), this, request);
+}
+
+ListRulesPackagesOutcomeCallable InspectorClient::ListRulesPackagesCallable(ListRulesPackagesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::ListRulesPackages, Aws::Client::RejectedCallOutcome<ListRulesPackagesOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::ListRulesPackagesAsync(const ListRulesPackagesRequest& request, const ListRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::ListRulesPackagesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::ListRulesPackagesAsyncHelper, Aws::Client::RejectedAsyncCall<ListRulesPackagesOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::ListRulesPackagesAsync(ListRulesPackagesRequest&& request, const ListRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::ListRulesPackagesAsyncHelper, Aws::Client::RejectedAsyncCall<ListRulesPackagesOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::ListRulesPackagesAsyncHelper(const ListRulesPackagesRequest& request, const ListRulesPackagesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -886,12 +1116,22 @@ ListRunsOutcome InspectorClient::ListRuns(const ListRunsRequest& request) const
 
 ListRunsOutcomeCallable InspectorClient::ListRunsCallable(const ListRunsRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::ListRuns, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::ListRuns, Aws::Client::RejectedCallOutcome<ListRunsOutcome>(), this, request);
+}
+
+ListRunsOutcomeCallable InspectorClient::ListRunsCallable(ListRunsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::ListRuns, Aws::Client::RejectedCallOutcome<ListRunsOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::ListRunsAsync(const ListRunsRequest& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::ListRunsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::ListRunsAsyncHelper, Aws::Client::RejectedAsyncCall<ListRunsOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::ListRunsAsync(ListRunsRequest&& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::ListRunsAsyncHelper, Aws::Client::RejectedAsyncCall<ListRunsOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::ListRunsAsyncHelper(const ListRunsRequest& request, const ListRunsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -917,12 +1157,22 @@ ListTagsForResourceOutcome InspectorClient::ListTagsForResource(const ListTagsFo
 
 ListTagsForResourceOutcomeCallable InspectorClient::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::ListTagsForResource, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::ListTagsForResource, Aws::Client::RejectedCallOutcome<ListTagsForResourceOutcome>(), this, request);
+}
+
+ListTagsForResourceOutcomeCallable InspectorClient::ListTagsForResourceCallable(ListTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::ListTagsForResource, Aws::Client::RejectedCallOutcome<ListTagsForResourceOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::ListTagsForResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::ListTagsForResourceAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForResourceOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::ListTagsForResourceAsync(ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::ListTagsForResourceAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -948,12 +1198,22 @@ LocalizeTextOutcome InspectorClient::LocalizeText(const LocalizeTextRequest& req
 
 LocalizeTextOutcomeCallable InspectorClient::LocalizeTextCallable(const LocalizeTextRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::LocalizeText, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::LocalizeText, Aws::Client::RejectedCallOutcome<LocalizeTextOutcome>(), this, request);
+}
+
+LocalizeTextOutcomeCallable InspectorClient::LocalizeTextCallable(LocalizeTextRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::LocalizeText, Aws::Client::RejectedCallOutcome<LocalizeTextOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::LocalizeTextAsync(const LocalizeTextRequest& request, const LocalizeTextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::LocalizeTextAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::LocalizeTextAsyncHelper, Aws::Client::RejectedAsyncCall<LocalizeTextOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::LocalizeTextAsync(LocalizeTextRequest&& request, const LocalizeTextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::LocalizeTextAsyncHelper, Aws::Client::RejectedAsyncCall<LocalizeTextOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::LocalizeTextAsyncHelper(const LocalizeTextRequest& request, const LocalizeTextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -979,12 +1239,22 @@ PreviewAgentsForResourceGroupOutcome InspectorClient::PreviewAgentsForResourceGr
 
 PreviewAgentsForResourceGroupOutcomeCallable InspectorClient::PreviewAgentsForResourceGroupCallable(const PreviewAgentsForResourceGroupRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::PreviewAgentsForResourceGroup, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::PreviewAgentsForResourceGroup, Aws::Client::RejectedCallOutcome<PreviewAgentsForResourceGroupOutcome>(), this, request);
+}
+
+PreviewAgentsForResourceGroupOutcomeCallable InspectorClient::PreviewAgentsForResourceGroupCallable(PreviewAgentsForResourceGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::PreviewAgentsForResourceGroup, Aws::Client::RejectedCallOutcome<PreviewAgentsForResourceGroupOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::PreviewAgentsForResourceGroupAsync(const PreviewAgentsForResourceGroupRequest& request, const PreviewAgentsForResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::PreviewAgentsForResourceGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::PreviewAgentsForResourceGroupAsyncHelper, Aws::Client::RejectedAsyncCall<PreviewAgentsForResourceGroupOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::PreviewAgentsForResourceGroupAsync(PreviewAgentsForResourceGroupRequest&& request, const PreviewAgentsForResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::PreviewAgentsForResourceGroupAsyncHelper, Aws::Client::RejectedAsyncCall<PreviewAgentsForResourceGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::PreviewAgentsForResourceGroupAsyncHelper(const PreviewAgentsForResourceGroupRequest& request, const PreviewAgentsForResourceGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1010,12 +1280,22 @@ RegisterCrossAccountAccessRoleOutcome InspectorClient::RegisterCrossAccountAcces
 
 RegisterCrossAccountAccessRoleOutcomeCallable InspectorClient::RegisterCrossAccountAccessRoleCallable(const RegisterCrossAccountAccessRoleRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::RegisterCrossAccountAccessRole, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::RegisterCrossAccountAccessRole, Aws::Client::RejectedCallOutcome<RegisterCrossAccountAccessRoleOutcome>(), this, request);
+}
+
+RegisterCrossAccountAccessRoleOutcomeCallable InspectorClient::RegisterCrossAccountAccessRoleCallable(RegisterCrossAccountAccessRoleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::RegisterCrossAccountAccessRole, Aws::Client::RejectedCallOutcome<RegisterCrossAccountAccessRoleOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::RegisterCrossAccountAccessRoleAsync(const RegisterCrossAccountAccessRoleRequest& request, const RegisterCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::RegisterCrossAccountAccessRoleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::RegisterCrossAccountAccessRoleAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterCrossAccountAccessRoleOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::RegisterCrossAccountAccessRoleAsync(RegisterCrossAccountAccessRoleRequest&& request, const RegisterCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::RegisterCrossAccountAccessRoleAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterCrossAccountAccessRoleOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::RegisterCrossAccountAccessRoleAsyncHelper(const RegisterCrossAccountAccessRoleRequest& request, const RegisterCrossAccountAccessRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1041,12 +1321,22 @@ RemoveAttributesFromFindingsOutcome InspectorClient::RemoveAttributesFromFinding
 
 RemoveAttributesFromFindingsOutcomeCallable InspectorClient::RemoveAttributesFromFindingsCallable(const RemoveAttributesFromFindingsRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::RemoveAttributesFromFindings, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::RemoveAttributesFromFindings, Aws::Client::RejectedCallOutcome<RemoveAttributesFromFindingsOutcome>(), this, request);
+}
+
+RemoveAttributesFromFindingsOutcomeCallable InspectorClient::RemoveAttributesFromFindingsCallable(RemoveAttributesFromFindingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::RemoveAttributesFromFindings, Aws::Client::RejectedCallOutcome<RemoveAttributesFromFindingsOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::RemoveAttributesFromFindingsAsync(const RemoveAttributesFromFindingsRequest& request, const RemoveAttributesFromFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::RemoveAttributesFromFindingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::RemoveAttributesFromFindingsAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveAttributesFromFindingsOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::RemoveAttributesFromFindingsAsync(RemoveAttributesFromFindingsRequest&& request, const RemoveAttributesFromFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::RemoveAttributesFromFindingsAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveAttributesFromFindingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::RemoveAttributesFromFindingsAsyncHelper(const RemoveAttributesFromFindingsRequest& request, const RemoveAttributesFromFindingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1072,12 +1362,22 @@ RunAssessmentOutcome InspectorClient::RunAssessment(const RunAssessmentRequest&
 
 RunAssessmentOutcomeCallable InspectorClient::RunAssessmentCallable(const RunAssessmentRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::RunAssessment, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::RunAssessment, Aws::Client::RejectedCallOutcome<RunAssessmentOutcome>(), this, request);
+}
+
+RunAssessmentOutcomeCallable InspectorClient::RunAssessmentCallable(RunAssessmentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::RunAssessment, Aws::Client::RejectedCallOutcome<RunAssessmentOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::RunAssessmentAsync(const RunAssessmentRequest& request, const RunAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::RunAssessmentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::RunAssessmentAsyncHelper, Aws::Client::RejectedAsyncCall<RunAssessmentOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::RunAssessmentAsync(RunAssessmentRequest&& request, const RunAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::RunAssessmentAsyncHelper, Aws::Client::RejectedAsyncCall<RunAssessmentOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::RunAssessmentAsyncHelper(const RunAssessmentRequest& request, const RunAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1103,12 +1403,22 @@ SetTagsForResourceOutcome InspectorClient::SetTagsForResource(const SetTagsForRe
 
 SetTagsForResourceOutcomeCallable InspectorClient::SetTagsForResourceCallable(const SetTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::SetTagsForResource, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::SetTagsForResource, Aws::Client::RejectedCallOutcome<SetTagsForResourceOutcome>(), this, request);
+}
+
+SetTagsForResourceOutcomeCallable InspectorClient::SetTagsForResourceCallable(SetTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::SetTagsForResource, Aws::Client::RejectedCallOutcome<SetTagsForResourceOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::SetTagsForResourceAsync(const SetTagsForResourceRequest& request, const SetTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::SetTagsForResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::SetTagsForResourceAsyncHelper, Aws::Client::RejectedAsyncCall<SetTagsForResourceOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::SetTagsForResourceAsync(SetTagsForResourceRequest&& request, const SetTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::SetTagsForResourceAsyncHelper, Aws::Client::RejectedAsyncCall<SetTagsForResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::SetTagsForResourceAsyncHelper(const SetTagsForResourceRequest& request, const SetTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1134,12 +1444,22 @@ StartDataCollectionOutcome InspectorClient::StartDataCollection(const StartDataC
 
 StartDataCollectionOutcomeCallable InspectorClient::StartDataCollectionCallable(const StartDataCollectionRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::StartDataCollection, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::StartDataCollection, Aws::Client::RejectedCallOutcome<StartDataCollectionOutcome>(), this, request);
+}
+
+StartDataCollectionOutcomeCallable InspectorClient::StartDataCollectionCallable(StartDataCollectionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::StartDataCollection, Aws::Client::RejectedCallOutcome<StartDataCollectionOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::StartDataCollectionAsync(const StartDataCollectionRequest& request, const StartDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::StartDataCollectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::StartDataCollectionAsyncHelper, Aws::Client::RejectedAsyncCall<StartDataCollectionOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::StartDataCollectionAsync(StartDataCollectionRequest&& request, const StartDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::StartDataCollectionAsyncHelper, Aws::Client::RejectedAsyncCall<StartDataCollectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::StartDataCollectionAsyncHelper(const StartDataCollectionRequest& request, const StartDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1165,12 +1485,22 @@ StopDataCollectionOutcome InspectorClient::StopDataCollection(const StopDataColl
 
 StopDataCollectionOutcomeCallable InspectorClient::StopDataCollectionCallable(const StopDataCollectionRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::StopDataCollection, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::StopDataCollection, Aws::Client::RejectedCallOutcome<StopDataCollectionOutcome>(), this, request);
+}
+
+StopDataCollectionOutcomeCallable InspectorClient::StopDataCollectionCallable(StopDataCollectionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::StopDataCollection, Aws::Client::RejectedCallOutcome<StopDataCollectionOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::StopDataCollectionAsync(const StopDataCollectionRequest& request, const StopDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::StopDataCollectionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::StopDataCollectionAsyncHelper, Aws::Client::RejectedAsyncCall<StopDataCollectionOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::StopDataCollectionAsync(StopDataCollectionRequest&& request, const StopDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::StopDataCollectionAsyncHelper, Aws::Client::RejectedAsyncCall<StopDataCollectionOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::StopDataCollectionAsyncHelper(const StopDataCollectionRequest& request, const StopDataCollectionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1196,12 +1526,22 @@ UpdateApplicationOutcome InspectorClient::UpdateApplication(const UpdateApplicat
 
 UpdateApplicationOutcomeCallable InspectorClient::UpdateApplicationCallable(const UpdateApplicationRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::UpdateApplication, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::UpdateApplication, Aws::Client::RejectedCallOutcome<UpdateApplicationOutcome>(), this, request);
+}
+
+UpdateApplicationOutcomeCallable InspectorClient::UpdateApplicationCallable(UpdateApplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::UpdateApplication, Aws::Client::RejectedCallOutcome<UpdateApplicationOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::UpdateApplicationAsync(const UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::UpdateApplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::UpdateApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateApplicationOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::UpdateApplicationAsync(UpdateApplicationRequest&& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::UpdateApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateApplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::UpdateApplicationAsyncHelper(const UpdateApplicationRequest& request, const UpdateApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1227,12 +1567,22 @@ UpdateAssessmentOutcome InspectorClient::UpdateAssessment(const UpdateAssessment
 
 UpdateAssessmentOutcomeCallable InspectorClient::UpdateAssessmentCallable(const UpdateAssessmentRequest& request) const
 {
-  return std::async(std::launch::async, &InspectorClient::UpdateAssessment, this, request);
+  return m_executor->SubmitWithFuture(&InspectorClient::UpdateAssessment, Aws::Client::RejectedCallOutcome<UpdateAssessmentOutcome>(), this, request);
+}
+
+UpdateAssessmentOutcomeCallable InspectorClient::UpdateAssessmentCallable(UpdateAssessmentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&InspectorClient::UpdateAssessment, Aws::Client::RejectedCallOutcome<UpdateAssessmentOutcome>(), this, std::move(request));
 }
 
 void InspectorClient::UpdateAssessmentAsync(const UpdateAssessmentRequest& request, const UpdateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&InspectorClient::UpdateAssessmentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&InspectorClient::UpdateAssessmentAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAssessmentOutcome>(), this, request, handler, context);
+}
+
+void InspectorClient::UpdateAssessmentAsync(UpdateAssessmentRequest&& request, const UpdateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&InspectorClient::UpdateAssessmentAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAssessmentOutcome>(), this, std::move(request), handler, context);
 }
 
 void InspectorClient::UpdateAssessmentAsyncHelper(const UpdateAssessmentRequest& request, const UpdateAssessmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -48,6 +48,51 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/iot/model/AcceptCertificateTransferRequest.h>
+#include <aws/iot/model/AttachPrincipalPolicyRequest.h>
+#include <aws/iot/model/AttachThingPrincipalRequest.h>
+#include <aws/iot/model/CancelCertificateTransferRequest.h>
+#include <aws/iot/model/CreateCertificateFromCsrRequest.h>
+#include <aws/iot/model/CreateKeysAndCertificateRequest.h>
+#include <aws/iot/model/CreatePolicyRequest.h>
+#include <aws/iot/model/CreatePolicyVersionRequest.h>
+#include <aws/iot/model/CreateThingRequest.h>
+#include <aws/iot/model/CreateTopicRuleRequest.h>
+#include <aws/iot/model/DeleteCertificateRequest.h>
+#include <aws/iot/model/DeletePolicyRequest.h>
+#include <aws/iot/model/DeletePolicyVersionRequest.h>
+#include <aws/iot/model/DeleteThingRequest.h>
+#include <aws/iot/model/DeleteTopicRuleRequest.h>
+#include <aws/iot/model/DescribeCertificateRequest.h>
+#include <aws/iot/model/DescribeEndpointRequest.h>
+#include <aws/iot/model/DescribeThingRequest.h>
+#include <aws/iot/model/DetachPrincipalPolicyRequest.h>
+#include <aws/iot/model/DetachThingPrincipalRequest.h>
+#include <aws/iot/model/DisableTopicRuleRequest.h>
+#include <aws/iot/model/EnableTopicRuleRequest.h>
+#include <aws/iot/model/GetLoggingOptionsRequest.h>
+#include <aws/iot/model/GetPolicyRequest.h>
+#include <aws/iot/model/GetPolicyVersionRequest.h>
+#include <aws/iot/model/GetTopicRuleRequest.h>
+#include <aws/iot/model/ListCertificatesRequest.h>
+#include <aws/iot/model/ListPoliciesRequest.h>
+#include <aws/iot/model/ListPolicyVersionsRequest.h>
+#include <aws/iot/model/ListPrincipalPoliciesRequest.h>
+#include <aws/iot/model/ListPrincipalThingsRequest.h>
+#include <aws/iot/model/ListThingPrincipalsRequest.h>
+#include <aws/iot/model/ListThingsRequest.h>
+#include <aws/iot/model/ListTopicRulesRequest.h>
+#include <aws/iot/model/RejectCertificateTransferRequest.h>
+#include <aws/iot/model/ReplaceTopicRuleRequest.h>
+#include <aws/iot/model/SetDefaultPolicyVersionRequest.h>
+#include <aws/iot/model/SetLoggingOptionsRequest.h>
+#include <aws/iot/model/TransferCertificateRequest.h>
+#include <aws/iot/model/UpdateCertificateRequest.h>
+#include <aws/iot/model/UpdateThingRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -317,6 +362,11 @@ namespace Model
          */
         virtual Model::AcceptCertificateTransferOutcomeCallable AcceptCertificateTransferCallable(const Model::AcceptCertificateTransferRequest& request) const;
 
+        /**
+         * Same as AcceptCertificateTransferCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AcceptCertificateTransferOutcomeCallable AcceptCertificateTransferCallable(Model::AcceptCertificateTransferRequest&& request) const;
+
         /**
          * <p>Accepts a pending certificate transfer. The default state of the certificate
          * is INACTIVE.</p> <p>To check for pending certificate transfers, call
@@ -326,6 +376,11 @@ namespace Model
          */
         virtual void AcceptCertificateTransferAsync(const Model::AcceptCertificateTransferRequest& request, const AcceptCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AcceptCertificateTransferAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AcceptCertificateTransferAsync(Model::AcceptCertificateTransferRequest&& request, const AcceptCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches the specified policy to the specified principal (certificate or
          * other credential).</p>
@@ -340,6 +395,11 @@ namespace Model
          */
         virtual Model::AttachPrincipalPolicyOutcomeCallable AttachPrincipalPolicyCallable(const Model::AttachPrincipalPolicyRequest& request) const;
 
+        /**
+         * Same as AttachPrincipalPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachPrincipalPolicyOutcomeCallable AttachPrincipalPolicyCallable(Model::AttachPrincipalPolicyRequest&& request) const;
+
         /**
          * <p>Attaches the specified policy to the specified principal (certificate or
          * other credential).</p>
@@ -348,6 +408,11 @@ namespace Model
          */
         virtual void AttachPrincipalPolicyAsync(const Model::AttachPrincipalPolicyRequest& request, const AttachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachPrincipalPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachPrincipalPolicyAsync(Model::AttachPrincipalPolicyRequest&& request, const AttachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches the specified principal to the specified thing.</p>
          */
@@ -360,6 +425,11 @@ namespace Model
          */
         virtual Model::AttachThingPrincipalOutcomeCallable AttachThingPrincipalCallable(const Model::AttachThingPrincipalRequest& request) const;
 
+        /**
+         * Same as AttachThingPrincipalCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachThingPrincipalOutcomeCallable AttachThingPrincipalCallable(Model::AttachThingPrincipalRequest&& request) const;
+
         /**
          * <p>Attaches the specified principal to the specified thing.</p>
          *
@@ -367,6 +437,11 @@ namespace Model
          */
         virtual void AttachThingPrincipalAsync(const Model::AttachThingPrincipalRequest& request, const AttachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachThingPrincipalAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachThingPrincipalAsync(Model::AttachThingPrincipalRequest&& request, const AttachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels a pending transfer for the specified certificate.</p> <p><b>Note</b>
          * Only the transfer source account can use this operation to cancel a transfer
@@ -391,6 +466,11 @@ namespace Model
          */
         virtual Model::CancelCertificateTransferOutcomeCallable CancelCertificateTransferCallable(const Model::CancelCertificateTransferRequest& request) const;
 
+        /**
+         * Same as CancelCertificateTransferCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelCertificateTransferOutcomeCallable CancelCertificateTransferCallable(Model::CancelCertificateTransferRequest&& request) const;
+
         /**
          * <p>Cancels a pending transfer for the specified certificate.</p> <p><b>Note</b>
          * Only the transfer source account can use this operation to cancel a transfer
@@ -404,6 +484,11 @@ namespace Model
          */
         virtual void CancelCertificateTransferAsync(const Model::CancelCertificateTransferRequest& request, const CancelCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelCertificateTransferAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelCertificateTransferAsync(Model::CancelCertificateTransferRequest&& request, const CancelCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an X.509 certificate using the specified certificate signing
          * request.</p> <p><b>Note</b> Reusing the same certificate signing request (CSR)
@@ -460,6 +545,11 @@ namespace Model
          */
         virtual Model::CreateCertificateFromCsrOutcomeCallable CreateCertificateFromCsrCallable(const Model::CreateCertificateFromCsrRequest& request) const;
 
+        /**
+         * Same as CreateCertificateFromCsrCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateCertificateFromCsrOutcomeCallable CreateCertificateFromCsrCallable(Model::CreateCertificateFromCsrRequest&& request) const;
+
         /**
          * <p>Creates an X.509 certificate using the specified certificate signing
          * request.</p> <p><b>Note</b> Reusing the same certificate signing request (CSR)
@@ -489,6 +579,11 @@ namespace Model
          */
         virtual void CreateCertificateFromCsrAsync(const Model::CreateCertificateFromCsrRequest& request, const CreateCertificateFromCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCertificateFromCsrAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateCertificateFromCsrAsync(Model::CreateCertificateFromCsrRequest&& request, const CreateCertificateFromCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a 2048 bit RSA key pair and issues an X.509 certificate using the
          * issued public key.</p> <p><b>Note</b> This is the only time AWS IoT issues the
@@ -507,6 +602,11 @@ namespace Model
          */
         virtual Model::CreateKeysAndCertificateOutcomeCallable CreateKeysAndCertificateCallable(const Model::CreateKeysAndCertificateRequest& request) const;
 
+        /**
+         * Same as CreateKeysAndCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateKeysAndCertificateOutcomeCallable CreateKeysAndCertificateCallable(Model::CreateKeysAndCertificateRequest&& request) const;
+
         /**
          * <p>Creates a 2048 bit RSA key pair and issues an X.509 certificate using the
          * issued public key.</p> <p><b>Note</b> This is the only time AWS IoT issues the
@@ -517,6 +617,11 @@ namespace Model
          */
         virtual void CreateKeysAndCertificateAsync(const Model::CreateKeysAndCertificateRequest& request, const CreateKeysAndCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateKeysAndCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateKeysAndCertificateAsync(Model::CreateKeysAndCertificateRequest&& request, const CreateKeysAndCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an AWS IoT policy.</p> <p>The created policy is the default version
          * for the policy. This operation creates a policy version with a version
@@ -533,6 +638,11 @@ namespace Model
          */
         virtual Model::CreatePolicyOutcomeCallable CreatePolicyCallable(const Model::CreatePolicyRequest& request) const;
 
+        /**
+         * Same as CreatePolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePolicyOutcomeCallable CreatePolicyCallable(Model::CreatePolicyRequest&& request) const;
+
         /**
          * <p>Creates an AWS IoT policy.</p> <p>The created policy is the default version
          * for the policy. This operation creates a policy version with a version
@@ -542,6 +652,11 @@ namespace Model
          */
         virtual void CreatePolicyAsync(const Model::CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePolicyAsync(Model::CreatePolicyRequest&& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new version of the specified AWS IoT policy. To update a policy,
          * create a new policy version. A managed policy can have up to five versions. If
@@ -566,6 +681,11 @@ namespace Model
          */
         virtual Model::CreatePolicyVersionOutcomeCallable CreatePolicyVersionCallable(const Model::CreatePolicyVersionRequest& request) const;
 
+        /**
+         * Same as CreatePolicyVersionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePolicyVersionOutcomeCallable CreatePolicyVersionCallable(Model::CreatePolicyVersionRequest&& request) const;
+
         /**
          * <p>Creates a new version of the specified AWS IoT policy. To update a policy,
          * create a new policy version. A managed policy can have up to five versions. If
@@ -579,6 +699,11 @@ namespace Model
          */
         virtual void CreatePolicyVersionAsync(const Model::CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePolicyVersionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePolicyVersionAsync(Model::CreatePolicyVersionRequest&& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a thing in the thing registry.</p>
          */
@@ -591,6 +716,11 @@ namespace Model
          */
         virtual Model::CreateThingOutcomeCallable CreateThingCallable(const Model::CreateThingRequest& request) const;
 
+        /**
+         * Same as CreateThingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateThingOutcomeCallable CreateThingCallable(Model::CreateThingRequest&& request) const;
+
         /**
          * <p>Creates a thing in the thing registry.</p>
          *
@@ -598,6 +728,11 @@ namespace Model
          */
         virtual void CreateThingAsync(const Model::CreateThingRequest& request, const CreateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateThingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateThingAsync(Model::CreateThingRequest&& request, const CreateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a rule.</p>
          */
@@ -610,6 +745,11 @@ namespace Model
          */
         virtual Model::CreateTopicRuleOutcomeCallable CreateTopicRuleCallable(const Model::CreateTopicRuleRequest& request) const;
 
+        /**
+         * Same as CreateTopicRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateTopicRuleOutcomeCallable CreateTopicRuleCallable(Model::CreateTopicRuleRequest&& request) const;
+
         /**
          * <p>Creates a rule.</p>
          *
@@ -617,6 +757,11 @@ namespace Model
          */
         virtual void CreateTopicRuleAsync(const Model::CreateTopicRuleRequest& request, const CreateTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTopicRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateTopicRuleAsync(Model::CreateTopicRuleRequest&& request, const CreateTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified certificate.</p> <p>A certificate cannot be deleted if
          * it has a policy attached to it or if its status is set to ACTIVE. To delete a
@@ -637,6 +782,11 @@ namespace Model
          */
         virtual Model::DeleteCertificateOutcomeCallable DeleteCertificateCallable(const Model::DeleteCertificateRequest& request) const;
 
+        /**
+         * Same as DeleteCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteCertificateOutcomeCallable DeleteCertificateCallable(Model::DeleteCertificateRequest&& request) const;
+
         /**
          * <p>Deletes the specified certificate.</p> <p>A certificate cannot be deleted if
          * it has a policy attached to it or if its status is set to ACTIVE. To delete a
@@ -648,6 +798,11 @@ namespace Model
          */
         virtual void DeleteCertificateAsync(const Model::DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteCertificateAsync(Model::DeleteCertificateRequest&& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified policy.</p> <p>A policy cannot be deleted if it has
          * non-default versions and/or it is attached to any certificate.</p> <p>To delete
@@ -672,6 +827,11 @@ namespace Model
          */
         virtual Model::DeletePolicyOutcomeCallable DeletePolicyCallable(const Model::DeletePolicyRequest& request) const;
 
+        /**
+         * Same as DeletePolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeletePolicyOutcomeCallable DeletePolicyCallable(Model::DeletePolicyRequest&& request) const;
+
         /**
          * <p>Deletes the specified policy.</p> <p>A policy cannot be deleted if it has
          * non-default versions and/or it is attached to any certificate.</p> <p>To delete
@@ -685,6 +845,11 @@ namespace Model
          */
         virtual void DeletePolicyAsync(const Model::DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeletePolicyAsync(Model::DeletePolicyRequest&& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified version of the specified policy. You cannot delete the
          * default version of a policy using this API. To delete the default version of a
@@ -703,6 +868,11 @@ namespace Model
          */
         virtual Model::DeletePolicyVersionOutcomeCallable DeletePolicyVersionCallable(const Model::DeletePolicyVersionRequest& request) const;
 
+        /**
+         * Same as DeletePolicyVersionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeletePolicyVersionOutcomeCallable DeletePolicyVersionCallable(Model::DeletePolicyVersionRequest&& request) const;
+
         /**
          * <p>Deletes the specified version of the specified policy. You cannot delete the
          * default version of a policy using this API. To delete the default version of a
@@ -713,6 +883,11 @@ namespace Model
          */
         virtual void DeletePolicyVersionAsync(const Model::DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePolicyVersionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeletePolicyVersionAsync(Model::DeletePolicyVersionRequest&& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified thing from the Thing Registry.</p>
          */
@@ -725,6 +900,11 @@ namespace Model
          */
         virtual Model::DeleteThingOutcomeCallable DeleteThingCallable(const Model::DeleteThingRequest& request) const;
 
+        /**
+         * Same as DeleteThingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteThingOutcomeCallable DeleteThingCallable(Model::DeleteThingRequest&& request) const;
+
         /**
          * <p>Deletes the specified thing from the Thing Registry.</p>
          *
@@ -732,6 +912,11 @@ namespace Model
          */
         virtual void DeleteThingAsync(const Model::DeleteThingRequest& request, const DeleteThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteThingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteThingAsync(Model::DeleteThingRequest&& request, const DeleteThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified rule.</p>
          */
@@ -744,6 +929,11 @@ namespace Model
          */
         virtual Model::DeleteTopicRuleOutcomeCallable DeleteTopicRuleCallable(const Model::DeleteTopicRuleRequest& request) const;
 
+        /**
+         * Same as DeleteTopicRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteTopicRuleOutcomeCallable DeleteTopicRuleCallable(Model::DeleteTopicRuleRequest&& request) const;
+
         /**
          * <p>Deletes the specified rule.</p>
          *
@@ -751,6 +941,11 @@ namespace Model
          */
         virtual void DeleteTopicRuleAsync(const Model::DeleteTopicRuleRequest& request, const DeleteTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTopicRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteTopicRuleAsync(Model::DeleteTopicRuleRequest&& request, const DeleteTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the specified certificate.</p>
          */
@@ -763,6 +958,11 @@ namespace Model
          */
         virtual Model::DescribeCertificateOutcomeCallable DescribeCertificateCallable(const Model::DescribeCertificateRequest& request) const;
 
+        /**
+         * Same as DescribeCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCertificateOutcomeCallable DescribeCertificateCallable(Model::DescribeCertificateRequest&& request) const;
+
         /**
          * <p>Gets information about the specified certificate.</p>
          *
@@ -770,6 +970,11 @@ namespace Model
          */
         virtual void DescribeCertificateAsync(const Model::DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCertificateAsync(Model::DescribeCertificateRequest&& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a unique endpoint specific to the AWS account making the call. You
          * specify the following URI when updating state information for your thing:
@@ -786,6 +991,11 @@ namespace Model
          */
         virtual Model::DescribeEndpointOutcomeCallable DescribeEndpointCallable(const Model::DescribeEndpointRequest& request) const;
 
+        /**
+         * Same as DescribeEndpointCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEndpointOutcomeCallable DescribeEndpointCallable(Model::DescribeEndpointRequest&& request) const;
+
         /**
          * <p>Returns a unique endpoint specific to the AWS account making the call. You
          * specify the following URI when updating state information for your thing:
@@ -795,6 +1005,11 @@ namespace Model
          */
         virtual void DescribeEndpointAsync(const Model::DescribeEndpointRequest& request, const DescribeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEndpointAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEndpointAsync(Model::DescribeEndpointRequest&& request, const DescribeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the specified thing.</p>
          */
@@ -807,6 +1022,11 @@ namespace Model
          */
         virtual Model::DescribeThingOutcomeCallable DescribeThingCallable(const Model::DescribeThingRequest& request) const;
 
+        /**
+         * Same as DescribeThingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeThingOutcomeCallable DescribeThingCallable(Model::DescribeThingRequest&& request) const;
+
         /**
          * <p>Gets information about the specified thing.</p>
          *
@@ -814,6 +1034,11 @@ namespace Model
          */
         virtual void DescribeThingAsync(const Model::DescribeThingRequest& request, const DescribeThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeThingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeThingAsync(Model::DescribeThingRequest&& request, const DescribeThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes the specified policy from the specified certificate.</p>
          */
@@ -826,6 +1051,11 @@ namespace Model
          */
         virtual Model::DetachPrincipalPolicyOutcomeCallable DetachPrincipalPolicyCallable(const Model::DetachPrincipalPolicyRequest& request) const;
 
+        /**
+         * Same as DetachPrincipalPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachPrincipalPolicyOutcomeCallable DetachPrincipalPolicyCallable(Model::DetachPrincipalPolicyRequest&& request) const;
+
         /**
          * <p>Removes the specified policy from the specified certificate.</p>
          *
@@ -833,6 +1063,11 @@ namespace Model
          */
         virtual void DetachPrincipalPolicyAsync(const Model::DetachPrincipalPolicyRequest& request, const DetachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachPrincipalPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachPrincipalPolicyAsync(Model::DetachPrincipalPolicyRequest&& request, const DetachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches the specified principal from the specified thing.</p>
          */
@@ -845,6 +1080,11 @@ namespace Model
          */
         virtual Model::DetachThingPrincipalOutcomeCallable DetachThingPrincipalCallable(const Model::DetachThingPrincipalRequest& request) const;
 
+        /**
+         * Same as DetachThingPrincipalCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachThingPrincipalOutcomeCallable DetachThingPrincipalCallable(Model::DetachThingPrincipalRequest&& request) const;
+
         /**
          * <p>Detaches the specified principal from the specified thing.</p>
          *
@@ -852,6 +1092,11 @@ namespace Model
          */
         virtual void DetachThingPrincipalAsync(const Model::DetachThingPrincipalRequest& request, const DetachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachThingPrincipalAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachThingPrincipalAsync(Model::DetachThingPrincipalRequest&& request, const DetachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables the specified rule</p>
          */
@@ -864,6 +1109,11 @@ namespace Model
          */
         virtual Model::DisableTopicRuleOutcomeCallable DisableTopicRuleCallable(const Model::DisableTopicRuleRequest& request) const;
 
+        /**
+         * Same as DisableTopicRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableTopicRuleOutcomeCallable DisableTopicRuleCallable(Model::DisableTopicRuleRequest&& request) const;
+
         /**
          * <p>Disables the specified rule</p>
          *
@@ -871,6 +1121,11 @@ namespace Model
          */
         virtual void DisableTopicRuleAsync(const Model::DisableTopicRuleRequest& request, const DisableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableTopicRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableTopicRuleAsync(Model::DisableTopicRuleRequest&& request, const DisableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables the specified rule.</p>
          */
@@ -883,6 +1138,11 @@ namespace Model
          */
         virtual Model::EnableTopicRuleOutcomeCallable EnableTopicRuleCallable(const Model::EnableTopicRuleRequest& request) const;
 
+        /**
+         * Same as EnableTopicRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableTopicRuleOutcomeCallable EnableTopicRuleCallable(Model::EnableTopicRuleRequest&& request) const;
+
         /**
          * <p>Enables the specified rule.</p>
          *
@@ -890,6 +1150,11 @@ namespace Model
          */
         virtual void EnableTopicRuleAsync(const Model::EnableTopicRuleRequest& request, const EnableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableTopicRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableTopicRuleAsync(Model::EnableTopicRuleRequest&& request, const EnableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the logging options.</p>
          */
@@ -902,6 +1167,11 @@ namespace Model
          */
         virtual Model::GetLoggingOptionsOutcomeCallable GetLoggingOptionsCallable(const Model::GetLoggingOptionsRequest& request) const;
 
+        /**
+         * Same as GetLoggingOptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetLoggingOptionsOutcomeCallable GetLoggingOptionsCallable(Model::GetLoggingOptionsRequest&& request) const;
+
         /**
          * <p>Gets the logging options.</p>
          *
@@ -909,6 +1179,11 @@ namespace Model
          */
         virtual void GetLoggingOptionsAsync(const Model::GetLoggingOptionsRequest& request, const GetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetLoggingOptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetLoggingOptionsAsync(Model::GetLoggingOptionsRequest&& request, const GetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the specified policy with the policy document of the
          * default version.</p>
@@ -923,6 +1198,11 @@ namespace Model
          */
         virtual Model::GetPolicyOutcomeCallable GetPolicyCallable(const Model::GetPolicyRequest& request) const;
 
+        /**
+         * Same as GetPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetPolicyOutcomeCallable GetPolicyCallable(Model::GetPolicyRequest&& request) const;
+
         /**
          * <p>Gets information about the specified policy with the policy document of the
          * default version.</p>
@@ -931,6 +1211,11 @@ namespace Model
          */
         virtual void GetPolicyAsync(const Model::GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetPolicyAsync(Model::GetPolicyRequest&& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the specified policy version.</p>
          */
@@ -943,6 +1228,11 @@ namespace Model
          */
         virtual Model::GetPolicyVersionOutcomeCallable GetPolicyVersionCallable(const Model::GetPolicyVersionRequest& request) const;
 
+        /**
+         * Same as GetPolicyVersionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetPolicyVersionOutcomeCallable GetPolicyVersionCallable(Model::GetPolicyVersionRequest&& request) const;
+
         /**
          * <p>Gets information about the specified policy version.</p>
          *
@@ -950,6 +1240,11 @@ namespace Model
          */
         virtual void GetPolicyVersionAsync(const Model::GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPolicyVersionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetPolicyVersionAsync(Model::GetPolicyVersionRequest&& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the specified rule.</p>
          */
@@ -962,6 +1257,11 @@ namespace Model
          */
         virtual Model::GetTopicRuleOutcomeCallable GetTopicRuleCallable(const Model::GetTopicRuleRequest& request) const;
 
+        /**
+         * Same as GetTopicRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetTopicRuleOutcomeCallable GetTopicRuleCallable(Model::GetTopicRuleRequest&& request) const;
+
         /**
          * <p>Gets information about the specified rule.</p>
          *
@@ -969,6 +1269,11 @@ namespace Model
          */
         virtual void GetTopicRuleAsync(const Model::GetTopicRuleRequest& request, const GetTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTopicRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetTopicRuleAsync(Model::GetTopicRuleRequest&& request, const GetTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists your certificates.</p> <p>The results are paginated with a default page
          * size of 25. You can retrieve additional results using the returned marker.</p>
@@ -983,6 +1288,11 @@ namespace Model
          */
         virtual Model::ListCertificatesOutcomeCallable ListCertificatesCallable(const Model::ListCertificatesRequest& request) const;
 
+        /**
+         * Same as ListCertificatesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListCertificatesOutcomeCallable ListCertificatesCallable(Model::ListCertificatesRequest&& request) const;
+
         /**
          * <p>Lists your certificates.</p> <p>The results are paginated with a default page
          * size of 25. You can retrieve additional results using the returned marker.</p>
@@ -991,6 +1301,11 @@ namespace Model
          */
         virtual void ListCertificatesAsync(const Model::ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListCertificatesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListCertificatesAsync(Model::ListCertificatesRequest&& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists your policies.</p>
          */
@@ -1003,6 +1318,11 @@ namespace Model
          */
         virtual Model::ListPoliciesOutcomeCallable ListPoliciesCallable(const Model::ListPoliciesRequest& request) const;
 
+        /**
+         * Same as ListPoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListPoliciesOutcomeCallable ListPoliciesCallable(Model::ListPoliciesRequest&& request) const;
+
         /**
          * <p>Lists your policies.</p>
          *
@@ -1010,6 +1330,11 @@ namespace Model
          */
         virtual void ListPoliciesAsync(const Model::ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListPoliciesAsync(Model::ListPoliciesRequest&& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the versions of the specified policy, and identifies the default
          * version.</p>
@@ -1024,6 +1349,11 @@ namespace Model
          */
         virtual Model::ListPolicyVersionsOutcomeCallable ListPolicyVersionsCallable(const Model::ListPolicyVersionsRequest& request) const;
 
+        /**
+         * Same as ListPolicyVersionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListPolicyVersionsOutcomeCallable ListPolicyVersionsCallable(Model::ListPolicyVersionsRequest&& request) const;
+
         /**
          * <p>Lists the versions of the specified policy, and identifies the default
          * version.</p>
@@ -1032,6 +1362,11 @@ namespace Model
          */
         virtual void ListPolicyVersionsAsync(const Model::ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPolicyVersionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListPolicyVersionsAsync(Model::ListPolicyVersionsRequest&& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the policies attached to the specified principal. If you use an Amazon
          * Cognito identity, the ID needs to be in <a
@@ -1050,6 +1385,11 @@ namespace Model
          */
         virtual Model::ListPrincipalPoliciesOutcomeCallable ListPrincipalPoliciesCallable(const Model::ListPrincipalPoliciesRequest& request) const;
 
+        /**
+         * Same as ListPrincipalPoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListPrincipalPoliciesOutcomeCallable ListPrincipalPoliciesCallable(Model::ListPrincipalPoliciesRequest&& request) const;
+
         /**
          * <p>Lists the policies attached to the specified principal. If you use an Amazon
          * Cognito identity, the ID needs to be in <a
@@ -1060,6 +1400,11 @@ namespace Model
          */
         virtual void ListPrincipalPoliciesAsync(const Model::ListPrincipalPoliciesRequest& request, const ListPrincipalPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPrincipalPoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListPrincipalPoliciesAsync(Model::ListPrincipalPoliciesRequest&& request, const ListPrincipalPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the things associated with the specified principal.</p>
          */
@@ -1072,6 +1417,11 @@ namespace Model
          */
         virtual Model::ListPrincipalThingsOutcomeCallable ListPrincipalThingsCallable(const Model::ListPrincipalThingsRequest& request) const;
 
+        /**
+         * Same as ListPrincipalThingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListPrincipalThingsOutcomeCallable ListPrincipalThingsCallable(Model::ListPrincipalThingsRequest&& request) const;
+
         /**
          * <p>Lists the things associated with the specified principal.</p>
          *
@@ -1079,6 +1429,11 @@ namespace Model
          */
         virtual void ListPrincipalThingsAsync(const Model::ListPrincipalThingsRequest& request, const ListPrincipalThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPrincipalThingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListPrincipalThingsAsync(Model::ListPrincipalThingsRequest&& request, const ListPrincipalThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the principals associated with the specified thing.</p>
          */
@@ -1091,6 +1446,11 @@ namespace Model
          */
         virtual Model::ListThingPrincipalsOutcomeCallable ListThingPrincipalsCallable(const Model::ListThingPrincipalsRequest& request) const;
 
+        /**
+         * Same as ListThingPrincipalsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListThingPrincipalsOutcomeCallable ListThingPrincipalsCallable(Model::ListThingPrincipalsRequest&& request) const;
+
         /**
          * <p>Lists the principals associated with the specified thing.</p>
          *
@@ -1098,6 +1458,11 @@ namespace Model
          */
         virtual void ListThingPrincipalsAsync(const Model::ListThingPrincipalsRequest& request, const ListThingPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListThingPrincipalsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListThingPrincipalsAsync(Model::ListThingPrincipalsRequest&& request, const ListThingPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists your things. You can pass an AttributeName and/or AttributeValue to
          * filter your things. For example: "ListThings where AttributeName=Color and
@@ -1114,6 +1479,11 @@ namespace Model
          */
         virtual Model::ListThingsOutcomeCallable ListThingsCallable(const Model::ListThingsRequest& request) const;
 
+        /**
+         * Same as ListThingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListThingsOutcomeCallable ListThingsCallable(Model::ListThingsRequest&& request) const;
+
         /**
          * <p>Lists your things. You can pass an AttributeName and/or AttributeValue to
          * filter your things. For example: "ListThings where AttributeName=Color and
@@ -1123,6 +1493,11 @@ namespace Model
          */
         virtual void ListThingsAsync(const Model::ListThingsRequest& request, const ListThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListThingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListThingsAsync(Model::ListThingsRequest&& request, const ListThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the rules for the specific topic.</p>
          */
@@ -1135,6 +1510,11 @@ namespace Model
          */
         virtual Model::ListTopicRulesOutcomeCallable ListTopicRulesCallable(const Model::ListTopicRulesRequest& request) const;
 
+        /**
+         * Same as ListTopicRulesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTopicRulesOutcomeCallable ListTopicRulesCallable(Model::ListTopicRulesRequest&& request) const;
+
         /**
          * <p>Lists the rules for the specific topic.</p>
          *
@@ -1142,6 +1522,11 @@ namespace Model
          */
         virtual void ListTopicRulesAsync(const Model::ListTopicRulesRequest& request, const ListTopicRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTopicRulesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTopicRulesAsync(Model::ListTopicRulesRequest&& request, const ListTopicRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Rejects a pending certificate transfer. After AWS IoT rejects a certificate
          * transfer, the certificate status changes from <b>PENDING_TRANFER</b> to
@@ -1164,6 +1549,11 @@ namespace Model
          */
         virtual Model::RejectCertificateTransferOutcomeCallable RejectCertificateTransferCallable(const Model::RejectCertificateTransferRequest& request) const;
 
+        /**
+         * Same as RejectCertificateTransferCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RejectCertificateTransferOutcomeCallable RejectCertificateTransferCallable(Model::RejectCertificateTransferRequest&& request) const;
+
         /**
          * <p>Rejects a pending certificate transfer. After AWS IoT rejects a certificate
          * transfer, the certificate status changes from <b>PENDING_TRANFER</b> to
@@ -1176,6 +1566,11 @@ namespace Model
          */
         virtual void RejectCertificateTransferAsync(const Model::RejectCertificateTransferRequest& request, const RejectCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RejectCertificateTransferAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RejectCertificateTransferAsync(Model::RejectCertificateTransferRequest&& request, const RejectCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Replaces the specified rule. You must specify all parameters for the new
          * rule.</p>
@@ -1190,6 +1585,11 @@ namespace Model
          */
         virtual Model::ReplaceTopicRuleOutcomeCallable ReplaceTopicRuleCallable(const Model::ReplaceTopicRuleRequest& request) const;
 
+        /**
+         * Same as ReplaceTopicRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReplaceTopicRuleOutcomeCallable ReplaceTopicRuleCallable(Model::ReplaceTopicRuleRequest&& request) const;
+
         /**
          * <p>Replaces the specified rule. You must specify all parameters for the new
          * rule.</p>
@@ -1198,6 +1598,11 @@ namespace Model
          */
         virtual void ReplaceTopicRuleAsync(const Model::ReplaceTopicRuleRequest& request, const ReplaceTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReplaceTopicRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReplaceTopicRuleAsync(Model::ReplaceTopicRuleRequest&& request, const ReplaceTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the specified version of the specified policy as the policy's default
          * (operative) version. This action affects all certificates that the policy is
@@ -1216,6 +1621,11 @@ namespace Model
          */
         virtual Model::SetDefaultPolicyVersionOutcomeCallable SetDefaultPolicyVersionCallable(const Model::SetDefaultPolicyVersionRequest& request) const;
 
+        /**
+         * Same as SetDefaultPolicyVersionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetDefaultPolicyVersionOutcomeCallable SetDefaultPolicyVersionCallable(Model::SetDefaultPolicyVersionRequest&& request) const;
+
         /**
          * <p>Sets the specified version of the specified policy as the policy's default
          * (operative) version. This action affects all certificates that the policy is
@@ -1226,6 +1636,11 @@ namespace Model
          */
         virtual void SetDefaultPolicyVersionAsync(const Model::SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetDefaultPolicyVersionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetDefaultPolicyVersionAsync(Model::SetDefaultPolicyVersionRequest&& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the logging options.</p>
          */
@@ -1238,6 +1653,11 @@ namespace Model
          */
         virtual Model::SetLoggingOptionsOutcomeCallable SetLoggingOptionsCallable(const Model::SetLoggingOptionsRequest& request) const;
 
+        /**
+         * Same as SetLoggingOptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetLoggingOptionsOutcomeCallable SetLoggingOptionsCallable(Model::SetLoggingOptionsRequest&& request) const;
+
         /**
          * <p>Sets the logging options.</p>
          *
@@ -1245,6 +1665,11 @@ namespace Model
          */
         virtual void SetLoggingOptionsAsync(const Model::SetLoggingOptionsRequest& request, const SetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetLoggingOptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetLoggingOptionsAsync(Model::SetLoggingOptionsRequest&& request, const SetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Transfers the specified certificate to the specified AWS account.</p> <p>You
          * can cancel the transfer until it is acknowledged by the recipient.</p> <p>No
@@ -1269,6 +1694,11 @@ namespace Model
          */
         virtual Model::TransferCertificateOutcomeCallable TransferCertificateCallable(const Model::TransferCertificateRequest& request) const;
 
+        /**
+         * Same as TransferCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::TransferCertificateOutcomeCallable TransferCertificateCallable(Model::TransferCertificateRequest&& request) const;
+
         /**
          * <p>Transfers the specified certificate to the specified AWS account.</p> <p>You
          * can cancel the transfer until it is acknowledged by the recipient.</p> <p>No
@@ -1282,6 +1712,11 @@ namespace Model
          */
         virtual void TransferCertificateAsync(const Model::TransferCertificateRequest& request, const TransferCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TransferCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void TransferCertificateAsync(Model::TransferCertificateRequest&& request, const TransferCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the status of the specified certificate. This operation is
          * idempotent.</p> <p>Moving a cert from the ACTIVE state (including REVOKED) will
@@ -1302,6 +1737,11 @@ namespace Model
          */
         virtual Model::UpdateCertificateOutcomeCallable UpdateCertificateCallable(const Model::UpdateCertificateRequest& request) const;
 
+        /**
+         * Same as UpdateCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateCertificateOutcomeCallable UpdateCertificateCallable(Model::UpdateCertificateRequest&& request) const;
+
         /**
          * <p>Updates the status of the specified certificate. This operation is
          * idempotent.</p> <p>Moving a cert from the ACTIVE state (including REVOKED) will
@@ -1313,6 +1753,11 @@ namespace Model
          */
         virtual void UpdateCertificateAsync(const Model::UpdateCertificateRequest& request, const UpdateCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateCertificateAsync(Model::UpdateCertificateRequest&& request, const UpdateCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the data for a thing.</p>
          */
@@ -1325,6 +1770,11 @@ namespace Model
          */
         virtual Model::UpdateThingOutcomeCallable UpdateThingCallable(const Model::UpdateThingRequest& request) const;
 
+        /**
+         * Same as UpdateThingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateThingOutcomeCallable UpdateThingCallable(Model::UpdateThingRequest&& request) const;
+
         /**
          * <p>Updates the data for a thing.</p>
          *
@@ -1332,6 +1782,100 @@ namespace Model
          */
         virtual void UpdateThingAsync(const Model::UpdateThingRequest& request, const UpdateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateThingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateThingAsync(Model::UpdateThingRequest&& request, const UpdateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AcceptCertificateTransferOutcome> AcceptCertificateTransferAwaitable(const Model::AcceptCertificateTransferRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::AcceptCertificateTransfer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AcceptCertificateTransferOutcome> AcceptCertificateTransferAwaitable(Model::AcceptCertificateTransferRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::AcceptCertificateTransfer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachPrincipalPolicyOutcome> AttachPrincipalPolicyAwaitable(const Model::AttachPrincipalPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::AttachPrincipalPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachPrincipalPolicyOutcome> AttachPrincipalPolicyAwaitable(Model::AttachPrincipalPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::AttachPrincipalPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachThingPrincipalOutcome> AttachThingPrincipalAwaitable(const Model::AttachThingPrincipalRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::AttachThingPrincipal, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachThingPrincipalOutcome> AttachThingPrincipalAwaitable(Model::AttachThingPrincipalRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::AttachThingPrincipal, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelCertificateTransferOutcome> CancelCertificateTransferAwaitable(const Model::CancelCertificateTransferRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::CancelCertificateTransfer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelCertificateTransferOutcome> CancelCertificateTransferAwaitable(Model::CancelCertificateTransferRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::CancelCertificateTransfer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCertificateFromCsrOutcome> CreateCertificateFromCsrAwaitable(const Model::CreateCertificateFromCsrRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::CreateCertificateFromCsr, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCertificateFromCsrOutcome> CreateCertificateFromCsrAwaitable(Model::CreateCertificateFromCsrRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::CreateCertificateFromCsr, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateKeysAndCertificateOutcome> CreateKeysAndCertificateAwaitable(const Model::CreateKeysAndCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::CreateKeysAndCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateKeysAndCertificateOutcome> CreateKeysAndCertificateAwaitable(Model::CreateKeysAndCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::CreateKeysAndCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePolicyOutcome> CreatePolicyAwaitable(const Model::CreatePolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::CreatePolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePolicyOutcome> CreatePolicyAwaitable(Model::CreatePolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::CreatePolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePolicyVersionOutcome> CreatePolicyVersionAwaitable(const Model::CreatePolicyVersionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::CreatePolicyVersion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePolicyVersionOutcome> CreatePolicyVersionAwaitable(Model::CreatePolicyVersionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::CreatePolicyVersion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateThingOutcome> CreateThingAwaitable(const Model::CreateThingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::CreateThing, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateThingOutcome> CreateThingAwaitable(Model::CreateThingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::CreateThing, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTopicRuleOutcome> CreateTopicRuleAwaitable(const Model::CreateTopicRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::CreateTopicRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTopicRuleOutcome> CreateTopicRuleAwaitable(Model::CreateTopicRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::CreateTopicRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCertificateOutcome> DeleteCertificateAwaitable(const Model::DeleteCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DeleteCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteCertificateOutcome> DeleteCertificateAwaitable(Model::DeleteCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DeleteCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePolicyOutcome> DeletePolicyAwaitable(const Model::DeletePolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DeletePolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePolicyOutcome> DeletePolicyAwaitable(Model::DeletePolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DeletePolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePolicyVersionOutcome> DeletePolicyVersionAwaitable(const Model::DeletePolicyVersionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DeletePolicyVersion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePolicyVersionOutcome> DeletePolicyVersionAwaitable(Model::DeletePolicyVersionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DeletePolicyVersion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteThingOutcome> DeleteThingAwaitable(const Model::DeleteThingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DeleteThing, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteThingOutcome> DeleteThingAwaitable(Model::DeleteThingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DeleteThing, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTopicRuleOutcome> DeleteTopicRuleAwaitable(const Model::DeleteTopicRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DeleteTopicRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTopicRuleOutcome> DeleteTopicRuleAwaitable(Model::DeleteTopicRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DeleteTopicRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCertificateOutcome> DescribeCertificateAwaitable(const Model::DescribeCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DescribeCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCertificateOutcome> DescribeCertificateAwaitable(Model::DescribeCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DescribeCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEndpointOutcome> DescribeEndpointAwaitable(const Model::DescribeEndpointRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DescribeEndpoint, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEndpointOutcome> DescribeEndpointAwaitable(Model::DescribeEndpointRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DescribeEndpoint, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeThingOutcome> DescribeThingAwaitable(const Model::DescribeThingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DescribeThing, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeThingOutcome> DescribeThingAwaitable(Model::DescribeThingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DescribeThing, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachPrincipalPolicyOutcome> DetachPrincipalPolicyAwaitable(const Model::DetachPrincipalPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DetachPrincipalPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachPrincipalPolicyOutcome> DetachPrincipalPolicyAwaitable(Model::DetachPrincipalPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DetachPrincipalPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachThingPrincipalOutcome> DetachThingPrincipalAwaitable(const Model::DetachThingPrincipalRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DetachThingPrincipal, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachThingPrincipalOutcome> DetachThingPrincipalAwaitable(Model::DetachThingPrincipalRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DetachThingPrincipal, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableTopicRuleOutcome> DisableTopicRuleAwaitable(const Model::DisableTopicRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DisableTopicRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableTopicRuleOutcome> DisableTopicRuleAwaitable(Model::DisableTopicRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::DisableTopicRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableTopicRuleOutcome> EnableTopicRuleAwaitable(const Model::EnableTopicRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::EnableTopicRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableTopicRuleOutcome> EnableTopicRuleAwaitable(Model::EnableTopicRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::EnableTopicRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetLoggingOptionsOutcome> GetLoggingOptionsAwaitable(const Model::GetLoggingOptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::GetLoggingOptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetLoggingOptionsOutcome> GetLoggingOptionsAwaitable(Model::GetLoggingOptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::GetLoggingOptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPolicyOutcome> GetPolicyAwaitable(const Model::GetPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::GetPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPolicyOutcome> GetPolicyAwaitable(Model::GetPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::GetPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPolicyVersionOutcome> GetPolicyVersionAwaitable(const Model::GetPolicyVersionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::GetPolicyVersion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPolicyVersionOutcome> GetPolicyVersionAwaitable(Model::GetPolicyVersionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::GetPolicyVersion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTopicRuleOutcome> GetTopicRuleAwaitable(const Model::GetTopicRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::GetTopicRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTopicRuleOutcome> GetTopicRuleAwaitable(Model::GetTopicRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::GetTopicRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListCertificatesOutcome> ListCertificatesAwaitable(const Model::ListCertificatesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListCertificates, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListCertificatesOutcome> ListCertificatesAwaitable(Model::ListCertificatesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListCertificates, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPoliciesOutcome> ListPoliciesAwaitable(const Model::ListPoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListPolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPoliciesOutcome> ListPoliciesAwaitable(Model::ListPoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListPolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPolicyVersionsOutcome> ListPolicyVersionsAwaitable(const Model::ListPolicyVersionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListPolicyVersions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPolicyVersionsOutcome> ListPolicyVersionsAwaitable(Model::ListPolicyVersionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListPolicyVersions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPrincipalPoliciesOutcome> ListPrincipalPoliciesAwaitable(const Model::ListPrincipalPoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListPrincipalPolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPrincipalPoliciesOutcome> ListPrincipalPoliciesAwaitable(Model::ListPrincipalPoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListPrincipalPolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPrincipalThingsOutcome> ListPrincipalThingsAwaitable(const Model::ListPrincipalThingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListPrincipalThings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPrincipalThingsOutcome> ListPrincipalThingsAwaitable(Model::ListPrincipalThingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListPrincipalThings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListThingPrincipalsOutcome> ListThingPrincipalsAwaitable(const Model::ListThingPrincipalsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListThingPrincipals, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListThingPrincipalsOutcome> ListThingPrincipalsAwaitable(Model::ListThingPrincipalsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListThingPrincipals, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListThingsOutcome> ListThingsAwaitable(const Model::ListThingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListThings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListThingsOutcome> ListThingsAwaitable(Model::ListThingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListThings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTopicRulesOutcome> ListTopicRulesAwaitable(const Model::ListTopicRulesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListTopicRules, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTopicRulesOutcome> ListTopicRulesAwaitable(Model::ListTopicRulesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ListTopicRules, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RejectCertificateTransferOutcome> RejectCertificateTransferAwaitable(const Model::RejectCertificateTransferRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::RejectCertificateTransfer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RejectCertificateTransferOutcome> RejectCertificateTransferAwaitable(Model::RejectCertificateTransferRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::RejectCertificateTransfer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReplaceTopicRuleOutcome> ReplaceTopicRuleAwaitable(const Model::ReplaceTopicRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ReplaceTopicRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReplaceTopicRuleOutcome> ReplaceTopicRuleAwaitable(Model::ReplaceTopicRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::ReplaceTopicRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetDefaultPolicyVersionOutcome> SetDefaultPolicyVersionAwaitable(const Model::SetDefaultPolicyVersionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::SetDefaultPolicyVersion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetDefaultPolicyVersionOutcome> SetDefaultPolicyVersionAwaitable(Model::SetDefaultPolicyVersionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::SetDefaultPolicyVersion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetLoggingOptionsOutcome> SetLoggingOptionsAwaitable(const Model::SetLoggingOptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::SetLoggingOptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetLoggingOptionsOutcome> SetLoggingOptionsAwaitable(Model::SetLoggingOptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::SetLoggingOptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TransferCertificateOutcome> TransferCertificateAwaitable(const Model::TransferCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::TransferCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TransferCertificateOutcome> TransferCertificateAwaitable(Model::TransferCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::TransferCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateCertificateOutcome> UpdateCertificateAwaitable(const Model::UpdateCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::UpdateCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateCertificateOutcome> UpdateCertificateAwaitable(Model::UpdateCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::UpdateCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateThingOutcome> UpdateThingAwaitable(const Model::UpdateThingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::UpdateThing, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateThingOutcome> UpdateThingAwaitable(Model::UpdateThingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &IoTClient::UpdateThing, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -149,12 +149,22 @@ AcceptCertificateTransferOutcome IoTClient::AcceptCertificateTransfer(const Acce
 
 AcceptCertificateTransferOutcomeCallable IoTClient::AcceptCertificateTransferCallable(const AcceptCertificateTransferRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::AcceptCertificateTransfer, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::AcceptCertificateTransfer, Aws::Client::RejectedCallOutcome<AcceptCertificateTransferOutcome>(), this, request);
+}
+
+AcceptCertificateTransferOutcomeCallable IoTClient::AcceptCertificateTransferCallable(AcceptCertificateTransferRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::AcceptCertificateTransfer, Aws::Client::RejectedCallOutcome<AcceptCertificateTransferOutcome>(), this, std::move(request));
 }
 
 void IoTClient::AcceptCertificateTransferAsync(const AcceptCertificateTransferRequest& request, const AcceptCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::AcceptCertificateTransferAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::AcceptCertificateTransferAsyncHelper, Aws::Client::RejectedAsyncCall<AcceptCertificateTransferOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::AcceptCertificateTransferAsync(AcceptCertificateTransferRequest&& request, const AcceptCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::AcceptCertificateTransferAsyncHelper, Aws::Client::RejectedAsyncCall<AcceptCertificateTransferOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::AcceptCertificateTransferAsyncHelper(const AcceptCertificateTransferRequest& request, const AcceptCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -181,12 +191,22 @@ AttachPrincipalPolicyOutcome IoTClient::AttachPrincipalPolicy(const AttachPrinci
 
 AttachPrincipalPolicyOutcomeCallable IoTClient::AttachPrincipalPolicyCallable(const AttachPrincipalPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::AttachPrincipalPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::AttachPrincipalPolicy, Aws::Client::RejectedCallOutcome<AttachPrincipalPolicyOutcome>(), this, request);
+}
+
+AttachPrincipalPolicyOutcomeCallable IoTClient::AttachPrincipalPolicyCallable(AttachPrincipalPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::AttachPrincipalPolicy, Aws::Client::RejectedCallOutcome<AttachPrincipalPolicyOutcome>(), this, std::move(request));
 }
 
 void IoTClient::AttachPrincipalPolicyAsync(const AttachPrincipalPolicyRequest& request, const AttachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::AttachPrincipalPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::AttachPrincipalPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<AttachPrincipalPolicyOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::AttachPrincipalPolicyAsync(AttachPrincipalPolicyRequest&& request, const AttachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::AttachPrincipalPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<AttachPrincipalPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::AttachPrincipalPolicyAsyncHelper(const AttachPrincipalPolicyRequest& request, const AttachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -214,12 +234,22 @@ AttachThingPrincipalOutcome IoTClient::AttachThingPrincipal(const AttachThingPri
 
 AttachThingPrincipalOutcomeCallable IoTClient::AttachThingPrincipalCallable(const AttachThingPrincipalRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::AttachThingPrincipal, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::AttachThingPrincipal, Aws::Client::RejectedCallOutcome<AttachThingPrincipalOutcome>(), this, request);
+}
+
+AttachThingPrincipalOutcomeCallable IoTClient::AttachThingPrincipalCallable(AttachThingPrincipalRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::AttachThingPrincipal, Aws::Client::RejectedCallOutcome<AttachThingPrincipalOutcome>(), this, std::move(request));
 }
 
 void IoTClient::AttachThingPrincipalAsync(const AttachThingPrincipalRequest& request, const AttachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::AttachThingPrincipalAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::AttachThingPrincipalAsyncHelper, Aws::Client::RejectedAsyncCall<AttachThingPrincipalOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::AttachThingPrincipalAsync(AttachThingPrincipalRequest&& request, const AttachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::AttachThingPrincipalAsyncHelper, Aws::Client::RejectedAsyncCall<AttachThingPrincipalOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::AttachThingPrincipalAsyncHelper(const AttachThingPrincipalRequest& request, const AttachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -246,12 +276,22 @@ CancelCertificateTransferOutcome IoTClient::CancelCertificateTransfer(const Canc
 
 CancelCertificateTransferOutcomeCallable IoTClient::CancelCertificateTransferCallable(const CancelCertificateTransferRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::CancelCertificateTransfer, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::CancelCertificateTransfer, Aws::Client::RejectedCallOutcome<CancelCertificateTransferOutcome>(), this, request);
+}
+
+CancelCertificateTransferOutcomeCallable IoTClient::CancelCertificateTransferCallable(CancelCertificateTransferRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::CancelCertificateTransfer, Aws::Client::RejectedCallOutcome<CancelCertificateTransferOutcome>(), this, std::move(request));
 }
 
 void IoTClient::CancelCertificateTransferAsync(const CancelCertificateTransferRequest& request, const CancelCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::CancelCertificateTransferAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::CancelCertificateTransferAsyncHelper, Aws::Client::RejectedAsyncCall<CancelCertificateTransferOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::CancelCertificateTransferAsync(CancelCertificateTransferRequest&& request, const CancelCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::CancelCertificateTransferAsyncHelper, Aws::Client::RejectedAsyncCall<CancelCertificateTransferOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::CancelCertificateTransferAsyncHelper(const CancelCertificateTransferRequest& request, const CancelCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -277,12 +317,22 @@ CreateCertificateFromCsrOutcome IoTClient::CreateCertificateFromCsr(const Create
 
 CreateCertificateFromCsrOutcomeCallable IoTClient::CreateCertificateFromCsrCallable(const CreateCertificateFromCsrRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::CreateCertificateFromCsr, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::CreateCertificateFromCsr, Aws::Client::RejectedCallOutcome<CreateCertificateFromCsrOutcome>(), this, request);
+}
+
+CreateCertificateFromCsrOutcomeCallable IoTClient::CreateCertificateFromCsrCallable(CreateCertificateFromCsrRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::CreateCertificateFromCsr, Aws::Client::RejectedCallOutcome<CreateCertificateFromCsrOutcome>(), this, std::move(request));
 }
 
 void IoTClient::CreateCertificateFromCsrAsync(const CreateCertificateFromCsrRequest& request, const CreateCertificateFromCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::CreateCertificateFromCsrAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::CreateCertificateFromCsrAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCertificateFromCsrOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::CreateCertificateFromCsrAsync(CreateCertificateFromCsrRequest&& request, const CreateCertificateFromCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::CreateCertificateFromCsrAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCertificateFromCsrOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::CreateCertificateFromCsrAsyncHelper(const CreateCertificateFromCsrRequest& request, const CreateCertificateFromCsrResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -308,12 +358,22 @@ CreateKeysAndCertificateOutcome IoTClient::CreateKeysAndCertificate(const Create
 
 CreateKeysAndCertificateOutcomeCallable IoTClient::CreateKeysAndCertificateCallable(const CreateKeysAndCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::CreateKeysAndCertificate, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::CreateKeysAndCertificate, Aws::Client::RejectedCallOutcome<CreateKeysAndCertificateOutcome>(), this, request);
+}
+
+CreateKeysAndCertificateOutcomeCallable IoTClient::CreateKeysAndCertificateCallable(CreateKeysAndCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::CreateKeysAndCertificate, Aws::Client::RejectedCallOutcome<CreateKeysAndCertificateOutcome>(), this, std::move(request));
 }
 
 void IoTClient::CreateKeysAndCertificateAsync(const CreateKeysAndCertificateRequest& request, const CreateKeysAndCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::CreateKeysAndCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::CreateKeysAndCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<CreateKeysAndCertificateOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::CreateKeysAndCertificateAsync(CreateKeysAndCertificateRequest&& request, const CreateKeysAndCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::CreateKeysAndCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<CreateKeysAndCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::CreateKeysAndCertificateAsyncHelper(const CreateKeysAndCertificateRequest& request, const CreateKeysAndCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -340,12 +400,22 @@ CreatePolicyOutcome IoTClient::CreatePolicy(const CreatePolicyRequest& request)
 
 CreatePolicyOutcomeCallable IoTClient::CreatePolicyCallable(const CreatePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::CreatePolicy, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::CreatePolicy, Aws::Client::RejectedCallOutcome<CreatePolicyOutcome>(), this, request);
+}
+
+CreatePolicyOutcomeCallable IoTClient::CreatePolicyCallable(CreatePolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::CreatePolicy, Aws::Client::RejectedCallOutcome<CreatePolicyOutcome>(), this, std::move(request));
 }
 
 void IoTClient::CreatePolicyAsync(const CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::CreatePolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::CreatePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePolicyOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::CreatePolicyAsync(CreatePolicyRequest&& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::CreatePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::CreatePolicyAsyncHelper(const CreatePolicyRequest& request, const CreatePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -373,12 +443,22 @@ CreatePolicyVersionOutcome IoTClient::CreatePolicyVersion(const CreatePolicyVers
 
 CreatePolicyVersionOutcomeCallable IoTClient::CreatePolicyVersionCallable(const CreatePolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::CreatePolicyVersion, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::CreatePolicyVersion, Aws::Client::RejectedCallOutcome<CreatePolicyVersionOutcome>(), this, request);
+}
+
+CreatePolicyVersionOutcomeCallable IoTClient::CreatePolicyVersionCallable(CreatePolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::CreatePolicyVersion, Aws::Client::RejectedCallOutcome<CreatePolicyVersionOutcome>(), this, std::move(request));
 }
 
 void IoTClient::CreatePolicyVersionAsync(const CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::CreatePolicyVersionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::CreatePolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePolicyVersionOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::CreatePolicyVersionAsync(CreatePolicyVersionRequest&& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::CreatePolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePolicyVersionOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::CreatePolicyVersionAsyncHelper(const CreatePolicyVersionRequest& request, const CreatePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -405,12 +485,22 @@ CreateThingOutcome IoTClient::CreateThing(const CreateThingRequest& request) con
 
 CreateThingOutcomeCallable IoTClient::CreateThingCallable(const CreateThingRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::CreateThing, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::CreateThing, Aws::Client::RejectedCallOutcome<CreateThingOutcome>(), this, request);
+}
+
+CreateThingOutcomeCallable IoTClient::CreateThingCallable(CreateThingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::CreateThing, Aws::Client::RejectedCallOutcome<CreateThingOutcome>(), this, std::move(request));
 }
 
 void IoTClient::CreateThingAsync(const CreateThingRequest& request, const CreateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::CreateThingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::CreateThingAsyncHelper, Aws::Client::RejectedAsyncCall<CreateThingOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::CreateThingAsync(CreateThingRequest&& request, const CreateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::CreateThingAsyncHelper, Aws::Client::RejectedAsyncCall<CreateThingOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::CreateThingAsyncHelper(const CreateThingRequest& request, const CreateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -437,12 +527,22 @@ CreateTopicRuleOutcome IoTClient::CreateTopicRule(const CreateTopicRuleRequest&
 
 CreateTopicRuleOutcomeCallable IoTClient::CreateTopicRuleCallable(const CreateTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::CreateTopicRule, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::CreateTopicRule, Aws::Client::RejectedCallOutcome<CreateTopicRuleOutcome>(), this, request);
+}
+
+CreateTopicRuleOutcomeCallable IoTClient::CreateTopicRuleCallable(CreateTopicRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::CreateTopicRule, Aws::Client::RejectedCallOutcome<CreateTopicRuleOutcome>(), this, std::move(request));
 }
 
 void IoTClient::CreateTopicRuleAsync(const CreateTopicRuleRequest& request, const CreateTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::CreateTopicRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::CreateTopicRuleAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTopicRuleOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::CreateTopicRuleAsync(CreateTopicRuleRequest&& request, const CreateTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::CreateTopicRuleAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTopicRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::CreateTopicRuleAsyncHelper(const CreateTopicRuleRequest& request, const CreateTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -469,12 +569,22 @@ DeleteCertificateOutcome IoTClient::DeleteCertificate(const DeleteCertificateReq
 
 DeleteCertificateOutcomeCallable IoTClient::DeleteCertificateCallable(const DeleteCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DeleteCertificate, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::DeleteCertificate, Aws::Client::RejectedCallOutcome<DeleteCertificateOutcome>(), this, request);
+}
+
+DeleteCertificateOutcomeCallable IoTClient::DeleteCertificateCallable(DeleteCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::DeleteCertificate, Aws::Client::RejectedCallOutcome<DeleteCertificateOutcome>(), this, std::move(request));
 }
 
 void IoTClient::DeleteCertificateAsync(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DeleteCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::DeleteCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCertificateOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::DeleteCertificateAsync(DeleteCertificateRequest&& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::DeleteCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::DeleteCertificateAsyncHelper(const DeleteCertificateRequest& request, const DeleteCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -501,12 +611,22 @@ DeletePolicyOutcome IoTClient::DeletePolicy(const DeletePolicyRequest& request)
 
 DeletePolicyOutcomeCallable IoTClient::DeletePolicyCallable(const DeletePolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DeletePolicy, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::DeletePolicy, Aws::Client::RejectedCallOutcome<DeletePolicyOutcome>(), this, request);
+}
+
+DeletePolicyOutcomeCallable IoTClient::DeletePolicyCallable(DeletePolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::DeletePolicy, Aws::Client::RejectedCallOutcome<DeletePolicyOutcome>(), this, std::move(request));
 }
 
 void IoTClient::DeletePolicyAsync(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DeletePolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::DeletePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePolicyOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::DeletePolicyAsync(DeletePolicyRequest&& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::DeletePolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::DeletePolicyAsyncHelper(const DeletePolicyRequest& request, const DeletePolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -535,12 +655,22 @@ DeletePolicyVersionOutcome IoTClient::DeletePolicyVersion(const DeletePolicyVers
 
 DeletePolicyVersionOutcomeCallable IoTClient::DeletePolicyVersionCallable(const DeletePolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DeletePolicyVersion, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::DeletePolicyVersion, Aws::Client::RejectedCallOutcome<DeletePolicyVersionOutcome>(), this, request);
+}
+
+DeletePolicyVersionOutcomeCallable IoTClient::DeletePolicyVersionCallable(DeletePolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::DeletePolicyVersion, Aws::Client::RejectedCallOutcome<DeletePolicyVersionOutcome>(), this, std::move(request));
 }
 
 void IoTClient::DeletePolicyVersionAsync(const DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DeletePolicyVersionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::DeletePolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePolicyVersionOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::DeletePolicyVersionAsync(DeletePolicyVersionRequest&& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::DeletePolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePolicyVersionOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::DeletePolicyVersionAsyncHelper(const DeletePolicyVersionRequest& request, const DeletePolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -567,12 +697,22 @@ DeleteThingOutcome IoTClient::DeleteThing(const DeleteThingRequest& request) con
 
 DeleteThingOutcomeCallable IoTClient::DeleteThingCallable(const DeleteThingRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DeleteThing, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::DeleteThing, Aws::Client::RejectedCallOutcome<DeleteThingOutcome>(), this, request);
+}
+
+DeleteThingOutcomeCallable IoTClient::DeleteThingCallable(DeleteThingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::DeleteThing, Aws::Client::RejectedCallOutcome<DeleteThingOutcome>(), this, std::move(request));
 }
 
 void IoTClient::DeleteThingAsync(const DeleteThingRequest& request, const DeleteThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DeleteThingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::DeleteThingAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteThingOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::DeleteThingAsync(DeleteThingRequest&& request, const DeleteThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::DeleteThingAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteThingOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::DeleteThingAsyncHelper(const DeleteThingRequest& request, const DeleteThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -599,12 +739,22 @@ DeleteTopicRuleOutcome IoTClient::DeleteTopicRule(const DeleteTopicRuleRequest&
 
 DeleteTopicRuleOutcomeCallable IoTClient::DeleteTopicRuleCallable(const DeleteTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DeleteTopicRule, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::DeleteTopicRule, Aws::Client::RejectedCallOutcome<DeleteTopicRuleOutcome>(), this, request);
+}
+
+DeleteTopicRuleOutcomeCallable IoTClient::DeleteTopicRuleCallable(DeleteTopicRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::DeleteTopicRule, Aws::Client::RejectedCallOutcome<DeleteTopicRuleOutcome>(), this, std::move(request));
 }
 
 void IoTClient::DeleteTopicRuleAsync(const DeleteTopicRuleRequest& request, const DeleteTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DeleteTopicRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::DeleteTopicRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTopicRuleOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::DeleteTopicRuleAsync(DeleteTopicRuleRequest&& request, const DeleteTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::DeleteTopicRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTopicRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::DeleteTopicRuleAsyncHelper(const DeleteTopicRuleRequest& request, const DeleteTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -631,12 +781,22 @@ DescribeCertificateOutcome IoTClient::DescribeCertificate(const DescribeCertific
 
 DescribeCertificateOutcomeCallable IoTClient::DescribeCertificateCallable(const DescribeCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DescribeCertificate, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::DescribeCertificate, Aws::Client::RejectedCallOutcome<DescribeCertificateOutcome>(), this, request);
+}
+
+DescribeCertificateOutcomeCallable IoTClient::DescribeCertificateCallable(DescribeCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::DescribeCertificate, Aws::Client::RejectedCallOutcome<DescribeCertificateOutcome>(), this, std::move(request));
 }
 
 void IoTClient::DescribeCertificateAsync(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DescribeCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::DescribeCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCertificateOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::DescribeCertificateAsync(DescribeCertificateRequest&& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::DescribeCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::DescribeCertificateAsyncHelper(const DescribeCertificateRequest& request, const DescribeCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -662,12 +822,22 @@ DescribeEndpointOutcome IoTClient::DescribeEndpoint(const DescribeEndpointReques
 
 DescribeEndpointOutcomeCallable IoTClient::DescribeEndpointCallable(const DescribeEndpointRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DescribeEndpoint, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::DescribeEndpoint, Aws::Client::RejectedCallOutcome<DescribeEndpointOutcome>(), this, request);
+}
+
+DescribeEndpointOutcomeCallable IoTClient::DescribeEndpointCallable(DescribeEndpointRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::DescribeEndpoint, Aws::Client::RejectedCallOutcome<DescribeEndpointOutcome>(), this, std::move(request));
 }
 
 void IoTClient::DescribeEndpointAsync(const DescribeEndpointRequest& request, const DescribeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DescribeEndpointAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::DescribeEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEndpointOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::DescribeEndpointAsync(DescribeEndpointRequest&& request, const DescribeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::DescribeEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEndpointOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::DescribeEndpointAsyncHelper(const DescribeEndpointRequest& request, const DescribeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -694,12 +864,22 @@ DescribeThingOutcome IoTClient::DescribeThing(const DescribeThingRequest& reques
 
 DescribeThingOutcomeCallable IoTClient::DescribeThingCallable(const DescribeThingRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DescribeThing, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::DescribeThing, Aws::Client::RejectedCallOutcome<DescribeThingOutcome>(), this, request);
+}
+
+DescribeThingOutcomeCallable IoTClient::DescribeThingCallable(DescribeThingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::DescribeThing, Aws::Client::RejectedCallOutcome<DescribeThingOutcome>(), this, std::move(request));
 }
 
 void IoTClient::DescribeThingAsync(const DescribeThingRequest& request, const DescribeThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DescribeThingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::DescribeThingAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeThingOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::DescribeThingAsync(DescribeThingRequest&& request, const DescribeThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::DescribeThingAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeThingOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::DescribeThingAsyncHelper(const DescribeThingRequest& request, const DescribeThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -726,12 +906,22 @@ DetachPrincipalPolicyOutcome IoTClient::DetachPrincipalPolicy(const DetachPrinci
 
 DetachPrincipalPolicyOutcomeCallable IoTClient::DetachPrincipalPolicyCallable(const DetachPrincipalPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DetachPrincipalPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::DetachPrincipalPolicy, Aws::Client::RejectedCallOutcome<DetachPrincipalPolicyOutcome>(), this, request);
+}
+
+DetachPrincipalPolicyOutcomeCallable IoTClient::DetachPrincipalPolicyCallable(DetachPrincipalPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::DetachPrincipalPolicy, Aws::Client::RejectedCallOutcome<DetachPrincipalPolicyOutcome>(), this, std::move(request));
 }
 
 void IoTClient::DetachPrincipalPolicyAsync(const DetachPrincipalPolicyRequest& request, const DetachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DetachPrincipalPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::DetachPrincipalPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DetachPrincipalPolicyOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::DetachPrincipalPolicyAsync(DetachPrincipalPolicyRequest&& request, const DetachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::DetachPrincipalPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DetachPrincipalPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::DetachPrincipalPolicyAsyncHelper(const DetachPrincipalPolicyRequest& request, const DetachPrincipalPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -759,12 +949,22 @@ DetachThingPrincipalOutcome IoTClient::DetachThingPrincipal(const DetachThingPri
 
 DetachThingPrincipalOutcomeCallable IoTClient::DetachThingPrincipalCallable(const DetachThingPrincipalRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DetachThingPrincipal, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::DetachThingPrincipal, Aws::Client::RejectedCallOutcome<DetachThingPrincipalOutcome>(), this, request);
+}
+
+DetachThingPrincipalOutcomeCallable IoTClient::DetachThingPrincipalCallable(DetachThingPrincipalRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::DetachThingPrincipal, Aws::Client::RejectedCallOutcome<DetachThingPrincipalOutcome>(), this, std::move(request));
 }
 
 void IoTClient::DetachThingPrincipalAsync(const DetachThingPrincipalRequest& request, const DetachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DetachThingPrincipalAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::DetachThingPrincipalAsyncHelper, Aws::Client::RejectedAsyncCall<DetachThingPrincipalOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::DetachThingPrincipalAsync(DetachThingPrincipalRequest&& request, const DetachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::DetachThingPrincipalAsyncHelper, Aws::Client::RejectedAsyncCall<DetachThingPrincipalOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::DetachThingPrincipalAsyncHelper(const DetachThingPrincipalRequest& request, const DetachThingPrincipalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -792,12 +992,22 @@ DisableTopicRuleOutcome IoTClient::DisableTopicRule(const DisableTopicRuleReques
 
 DisableTopicRuleOutcomeCallable IoTClient::DisableTopicRuleCallable(const DisableTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::DisableTopicRule, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::DisableTopicRule, Aws::Client::RejectedCallOutcome<DisableTopicRuleOutcome>(), this, request);
+}
+
+DisableTopicRuleOutcomeCallable IoTClient::DisableTopicRuleCallable(DisableTopicRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::DisableTopicRule, Aws::Client::RejectedCallOutcome<DisableTopicRuleOutcome>(), this, std::move(request));
 }
 
 void IoTClient::DisableTopicRuleAsync(const DisableTopicRuleRequest& request, const DisableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::DisableTopicRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::DisableTopicRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DisableTopicRuleOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::DisableTopicRuleAsync(DisableTopicRuleRequest&& request, const DisableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::DisableTopicRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DisableTopicRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::DisableTopicRuleAsyncHelper(const DisableTopicRuleRequest& request, const DisableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -825,12 +1035,22 @@ EnableTopicRuleOutcome IoTClient::EnableTopicRule(const EnableTopicRuleRequest&
 
 EnableTopicRuleOutcomeCallable IoTClient::EnableTopicRuleCallable(const EnableTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::EnableTopicRule, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::EnableTopicRule, Aws::Client::RejectedCallOutcome<EnableTopicRuleOutcome>(), this, request);
+}
+
+EnableTopicRuleOutcomeCallable IoTClient::EnableTopicRuleCallable(EnableTopicRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::EnableTopicRule, Aws::Client::RejectedCallOutcome<EnableTopicRuleOutcome>(), this, std::move(request));
 }
 
 void IoTClient::EnableTopicRuleAsync(const EnableTopicRuleRequest& request, const EnableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::EnableTopicRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::EnableTopicRuleAsyncHelper, Aws::Client::RejectedAsyncCall<EnableTopicRuleOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::EnableTopicRuleAsync(EnableTopicRuleRequest&& request, const EnableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::EnableTopicRuleAsyncHelper, Aws::Client::RejectedAsyncCall<EnableTopicRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::EnableTopicRuleAsyncHelper(const EnableTopicRuleRequest& request, const EnableTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -856,12 +1076,22 @@ GetLoggingOptionsOutcome IoTClient::GetLoggingOptions(const GetLoggingOptionsReq
 
 GetLoggingOptionsOutcomeCallable IoTClient::GetLoggingOptionsCallable(const GetLoggingOptionsRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::GetLoggingOptions, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::GetLoggingOptions, Aws::Client::RejectedCallOutcome<GetLoggingOptionsOutcome>(), this, request);
+}
+
+GetLoggingOptionsOutcomeCallable IoTClient::GetLoggingOptionsCallable(GetLoggingOptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::GetLoggingOptions, Aws::Client::RejectedCallOutcome<GetLoggingOptionsOutcome>(), this, std::move(request));
 }
 
 void IoTClient::GetLoggingOptionsAsync(const GetLoggingOptionsRequest& request, const GetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::GetLoggingOptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::GetLoggingOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<GetLoggingOptionsOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::GetLoggingOptionsAsync(GetLoggingOptionsRequest&& request, const GetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::GetLoggingOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<GetLoggingOptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::GetLoggingOptionsAsyncHelper(const GetLoggingOptionsRequest& request, const GetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -888,12 +1118,22 @@ GetPolicyOutcome IoTClient::GetPolicy(const GetPolicyRequest& request) const
 
 GetPolicyOutcomeCallable IoTClient::GetPolicyCallable(const GetPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::GetPolicy, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::GetPolicy, Aws::Client::RejectedCallOutcome<GetPolicyOutcome>(), this, request);
+}
+
+GetPolicyOutcomeCallable IoTClient::GetPolicyCallable(GetPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::GetPolicy, Aws::Client::RejectedCallOutcome<GetPolicyOutcome>(), this, std::move(request));
 }
 
 void IoTClient::GetPolicyAsync(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::GetPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::GetPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetPolicyOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::GetPolicyAsync(GetPolicyRequest&& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::GetPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::GetPolicyAsyncHelper(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -922,12 +1162,22 @@ GetPolicyVersionOutcome IoTClient::GetPolicyVersion(const GetPolicyVersionReques
 
 GetPolicyVersionOutcomeCallable IoTClient::GetPolicyVersionCallable(const GetPolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::GetPolicyVersion, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::GetPolicyVersion, Aws::Client::RejectedCallOutcome<GetPolicyVersionOutcome>(), this, request);
+}
+
+GetPolicyVersionOutcomeCallable IoTClient::GetPolicyVersionCallable(GetPolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::GetPolicyVersion, Aws::Client::RejectedCallOutcome<GetPolicyVersionOutcome>(), this, std::move(request));
 }
 
 void IoTClient::GetPolicyVersionAsync(const GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::GetPolicyVersionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::GetPolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<GetPolicyVersionOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::GetPolicyVersionAsync(GetPolicyVersionRequest&& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::GetPolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<GetPolicyVersionOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::GetPolicyVersionAsyncHelper(const GetPolicyVersionRequest& request, const GetPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -954,12 +1204,22 @@ GetTopicRuleOutcome IoTClient::GetTopicRule(const GetTopicRuleRequest& request)
 
 GetTopicRuleOutcomeCallable IoTClient::GetTopicRuleCallable(const GetTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::GetTopicRule, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::GetTopicRule, Aws::Client::RejectedCallOutcome<GetTopicRuleOutcome>(), this, request);
+}
+
+GetTopicRuleOutcomeCallable IoTClient::GetTopicRuleCallable(GetTopicRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::GetTopicRule, Aws::Client::RejectedCallOutcome<GetTopicRuleOutcome>(), this, std::move(request));
 }
 
 void IoTClient::GetTopicRuleAsync(const GetTopicRuleRequest& request, const GetTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::GetTopicRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::GetTopicRuleAsyncHelper, Aws::Client::RejectedAsyncCall<GetTopicRuleOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::GetTopicRuleAsync(GetTopicRuleRequest&& request, const GetTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::GetTopicRuleAsyncHelper, Aws::Client::RejectedAsyncCall<GetTopicRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::GetTopicRuleAsyncHelper(const GetTopicRuleRequest& request, const GetTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -985,12 +1245,22 @@ ListCertificatesOutcome IoTClient::ListCertificates(const ListCertificatesReques
 
 ListCertificatesOutcomeCallable IoTClient::ListCertificatesCallable(const ListCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListCertificates, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::ListCertificates, Aws::Client::RejectedCallOutcome<ListCertificatesOutcome>(), this, request);
+}
+
+ListCertificatesOutcomeCallable IoTClient::ListCertificatesCallable(ListCertificatesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::ListCertificates, Aws::Client::RejectedCallOutcome<ListCertificatesOutcome>(), this, std::move(request));
 }
 
 void IoTClient::ListCertificatesAsync(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListCertificatesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::ListCertificatesAsyncHelper, Aws::Client::RejectedAsyncCall<ListCertificatesOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::ListCertificatesAsync(ListCertificatesRequest&& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::ListCertificatesAsyncHelper, Aws::Client::RejectedAsyncCall<ListCertificatesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::ListCertificatesAsyncHelper(const ListCertificatesRequest& request, const ListCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1016,12 +1286,22 @@ ListPoliciesOutcome IoTClient::ListPolicies(const ListPoliciesRequest& request)
 
 ListPoliciesOutcomeCallable IoTClient::ListPoliciesCallable(const ListPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListPolicies, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::ListPolicies, Aws::Client::RejectedCallOutcome<ListPoliciesOutcome>(), this, request);
+}
+
+ListPoliciesOutcomeCallable IoTClient::ListPoliciesCallable(ListPoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::ListPolicies, Aws::Client::RejectedCallOutcome<ListPoliciesOutcome>(), this, std::move(request));
 }
 
 void IoTClient::ListPoliciesAsync(const ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListPoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::ListPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListPoliciesOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::ListPoliciesAsync(ListPoliciesRequest&& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::ListPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListPoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::ListPoliciesAsyncHelper(const ListPoliciesRequest& request, const ListPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1049,12 +1329,22 @@ ListPolicyVersionsOutcome IoTClient::ListPolicyVersions(const ListPolicyVersions
 
 ListPolicyVersionsOutcomeCallable IoTClient::ListPolicyVersionsCallable(const ListPolicyVersionsRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListPolicyVersions, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::ListPolicyVersions, Aws::Client::RejectedCallOutcome<ListPolicyVersionsOutcome>(), this, request);
+}
+
+ListPolicyVersionsOutcomeCallable IoTClient::ListPolicyVersionsCallable(ListPolicyVersionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::ListPolicyVersions, Aws::Client::RejectedCallOutcome<ListPolicyVersionsOutcome>(), this, std::move(request));
 }
 
 void IoTClient::ListPolicyVersionsAsync(const ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListPolicyVersionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::ListPolicyVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListPolicyVersionsOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::ListPolicyVersionsAsync(ListPolicyVersionsRequest&& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::ListPolicyVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListPolicyVersionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::ListPolicyVersionsAsyncHelper(const ListPolicyVersionsRequest& request, const ListPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1080,12 +1370,22 @@ ListPrincipalPoliciesOutcome IoTClient::ListPrincipalPolicies(const ListPrincipa
 
 ListPrincipalPoliciesOutcomeCallable IoTClient::ListPrincipalPoliciesCallable(const ListPrincipalPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListPrincipalPolicies, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::ListPrincipalPolicies, Aws::Client::RejectedCallOutcome<ListPrincipalPoliciesOutcome>(), this, request);
+}
+
+ListPrincipalPoliciesOutcomeCallable IoTClient::ListPrincipalPoliciesCallable(ListPrincipalPoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::ListPrincipalPolicies, Aws::Client::RejectedCallOutcome<ListPrincipalPoliciesOutcome>(), this, std::move(request));
 }
 
 void IoTClient::ListPrincipalPoliciesAsync(const ListPrincipalPoliciesRequest& request, const ListPrincipalPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListPrincipalPoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::ListPrincipalPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListPrincipalPoliciesOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::ListPrincipalPoliciesAsync(ListPrincipalPoliciesRequest&& request, const ListPrincipalPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::ListPrincipalPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListPrincipalPoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::ListPrincipalPoliciesAsyncHelper(const ListPrincipalPoliciesRequest& request, const ListPrincipalPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1111,12 +1411,22 @@ ListPrincipalThingsOutcome IoTClient::ListPrincipalThings(const ListPrincipalThi
 
 ListPrincipalThingsOutcomeCallable IoTClient::ListPrincipalThingsCallable(const ListPrincipalThingsRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListPrincipalThings, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::ListPrincipalThings, Aws::Client::RejectedCallOutcome<ListPrincipalThingsOutcome>(), this, request);
+}
+
+ListPrincipalThingsOutcomeCallable IoTClient::ListPrincipalThingsCallable(ListPrincipalThingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::ListPrincipalThings, Aws::Client::RejectedCallOutcome<ListPrincipalThingsOutcome>(), this, std::move(request));
 }
 
 void IoTClient::ListPrincipalThingsAsync(const ListPrincipalThingsRequest& request, const ListPrincipalThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListPrincipalThingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::ListPrincipalThingsAsyncHelper, Aws::Client::RejectedAsyncCall<ListPrincipalThingsOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::ListPrincipalThingsAsync(ListPrincipalThingsRequest&& request, const ListPrincipalThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::ListPrincipalThingsAsyncHelper, Aws::Client::RejectedAsyncCall<ListPrincipalThingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::ListPrincipalThingsAsyncHelper(const ListPrincipalThingsRequest& request, const ListPrincipalThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1144,12 +1454,22 @@ ListThingPrincipalsOutcome IoTClient::ListThingPrincipals(const ListThingPrincip
 
 ListThingPrincipalsOutcomeCallable IoTClient::ListThingPrincipalsCallable(const ListThingPrincipalsRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListThingPrincipals, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::ListThingPrincipals, Aws::Client::RejectedCallOutcome<ListThingPrincipalsOutcome>(), this, request);
+}
+
+ListThingPrincipalsOutcomeCallable IoTClient::ListThingPrincipalsCallable(ListThingPrincipalsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::ListThingPrincipals, Aws::Client::RejectedCallOutcome<ListThingPrincipalsOutcome>(), this, std::move(request));
 }
 
 void IoTClient::ListThingPrincipalsAsync(const ListThingPrincipalsRequest& request, const ListThingPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListThingPrincipalsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::ListThingPrincipalsAsyncHelper, Aws::Client::RejectedAsyncCall<ListThingPrincipalsOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::ListThingPrincipalsAsync(ListThingPrincipalsRequest&& request, const ListThingPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::ListThingPrincipalsAsyncHelper, Aws::Client::RejectedAsyncCall<ListThingPrincipalsOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::ListThingPrincipalsAsyncHelper(const ListThingPrincipalsRequest& request, const ListThingPrincipalsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1175,12 +1495,22 @@ ListThingsOutcome IoTClient::ListThings(const ListThingsRequest& request) const
 
 ListThingsOutcomeCallable IoTClient::ListThingsCallable(const ListThingsRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListThings, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::ListThings, Aws::Client::RejectedCallOutcome<ListThingsOutcome>(), this, request);
+}
+
+ListThingsOutcomeCallable IoTClient::ListThingsCallable(ListThingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::ListThings, Aws::Client::RejectedCallOutcome<ListThingsOutcome>(), this, std::move(request));
 }
 
 void IoTClient::ListThingsAsync(const ListThingsRequest& request, const ListThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListThingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::ListThingsAsyncHelper, Aws::Client::RejectedAsyncCall<ListThingsOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::ListThingsAsync(ListThingsRequest&& request, const ListThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::ListThingsAsyncHelper, Aws::Client::RejectedAsyncCall<ListThingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::ListThingsAsyncHelper(const ListThingsRequest& request, const ListThingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1206,12 +1536,22 @@ ListTopicRulesOutcome IoTClient::ListTopicRules(const ListTopicRulesRequest& req
 
 ListTopicRulesOutcomeCallable IoTClient::ListTopicRulesCallable(const ListTopicRulesRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ListTopicRules, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::ListTopicRules, Aws::Client::RejectedCallOutcome<ListTopicRulesOutcome>(), this, request);
+}
+
+ListTopicRulesOutcomeCallable IoTClient::ListTopicRulesCallable(ListTopicRulesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::ListTopicRules, Aws::Client::RejectedCallOutcome<ListTopicRulesOutcome>(), this, std::move(request));
 }
 
 void IoTClient::ListTopicRulesAsync(const ListTopicRulesRequest& request, const ListTopicRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ListTopicRulesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::ListTopicRulesAsyncHelper, Aws::Client::RejectedAsyncCall<ListTopicRulesOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::ListTopicRulesAsync(ListTopicRulesRequest&& request, const ListTopicRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::ListTopicRulesAsyncHelper, Aws::Client::RejectedAsyncCall<ListTopicRulesOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::ListTopicRulesAsyncHelper(const ListTopicRulesRequest& request, const ListTopicRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1238,12 +1578,22 @@ RejectCertificateTransferOutcome IoTClient::RejectCertificateTransfer(const Reje
 
 RejectCertificateTransferOutcomeCallable IoTClient::RejectCertificateTransferCallable(const RejectCertificateTransferRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::RejectCertificateTransfer, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::RejectCertificateTransfer, Aws::Client::RejectedCallOutcome<RejectCertificateTransferOutcome>(), this, request);
+}
+
+RejectCertificateTransferOutcomeCallable IoTClient::RejectCertificateTransferCallable(RejectCertificateTransferRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::RejectCertificateTransfer, Aws::Client::RejectedCallOutcome<RejectCertificateTransferOutcome>(), this, std::move(request));
 }
 
 void IoTClient::RejectCertificateTransferAsync(const RejectCertificateTransferRequest& request, const RejectCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::RejectCertificateTransferAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::RejectCertificateTransferAsyncHelper, Aws::Client::RejectedAsyncCall<RejectCertificateTransferOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::RejectCertificateTransferAsync(RejectCertificateTransferRequest&& request, const RejectCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::RejectCertificateTransferAsyncHelper, Aws::Client::RejectedAsyncCall<RejectCertificateTransferOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::RejectCertificateTransferAsyncHelper(const RejectCertificateTransferRequest& request, const RejectCertificateTransferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1270,12 +1620,22 @@ ReplaceTopicRuleOutcome IoTClient::ReplaceTopicRule(const ReplaceTopicRuleReques
 
 ReplaceTopicRuleOutcomeCallable IoTClient::ReplaceTopicRuleCallable(const ReplaceTopicRuleRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::ReplaceTopicRule, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::ReplaceTopicRule, Aws::Client::RejectedCallOutcome<ReplaceTopicRuleOutcome>(), this, request);
+}
+
+ReplaceTopicRuleOutcomeCallable IoTClient::ReplaceTopicRuleCallable(ReplaceTopicRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::ReplaceTopicRule, Aws::Client::RejectedCallOutcome<ReplaceTopicRuleOutcome>(), this, std::move(request));
 }
 
 void IoTClient::ReplaceTopicRuleAsync(const ReplaceTopicRuleRequest& request, const ReplaceTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::ReplaceTopicRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::ReplaceTopicRuleAsyncHelper, Aws::Client::RejectedAsyncCall<ReplaceTopicRuleOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::ReplaceTopicRuleAsync(ReplaceTopicRuleRequest&& request, const ReplaceTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::ReplaceTopicRuleAsyncHelper, Aws::Client::RejectedAsyncCall<ReplaceTopicRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::ReplaceTopicRuleAsyncHelper(const ReplaceTopicRuleRequest& request, const ReplaceTopicRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1304,12 +1664,22 @@ SetDefaultPolicyVersionOutcome IoTClient::SetDefaultPolicyVersion(const SetDefau
 
 SetDefaultPolicyVersionOutcomeCallable IoTClient::SetDefaultPolicyVersionCallable(const SetDefaultPolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::SetDefaultPolicyVersion, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::SetDefaultPolicyVersion, Aws::Client::RejectedCallOutcome<SetDefaultPolicyVersionOutcome>(), this, request);
+}
+
+SetDefaultPolicyVersionOutcomeCallable IoTClient::SetDefaultPolicyVersionCallable(SetDefaultPolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::SetDefaultPolicyVersion, Aws::Client::RejectedCallOutcome<SetDefaultPolicyVersionOutcome>(), this, std::move(request));
 }
 
 void IoTClient::SetDefaultPolicyVersionAsync(const SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::SetDefaultPolicyVersionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::SetDefaultPolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<SetDefaultPolicyVersionOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::SetDefaultPolicyVersionAsync(SetDefaultPolicyVersionRequest&& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::SetDefaultPolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<SetDefaultPolicyVersionOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::SetDefaultPolicyVersionAsyncHelper(const SetDefaultPolicyVersionRequest& request, const SetDefaultPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1335,12 +1705,22 @@ SetLoggingOptionsOutcome IoTClient::SetLoggingOptions(const SetLoggingOptionsReq
 
 SetLoggingOptionsOutcomeCallable IoTClient::SetLoggingOptionsCallable(const SetLoggingOptionsRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::SetLoggingOptions, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::SetLoggingOptions, Aws::Client::RejectedCallOutcome<SetLoggingOptionsOutcome>(), this, request);
+}
+
+SetLoggingOptionsOutcomeCallable IoTClient::SetLoggingOptionsCallable(SetLoggingOptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::SetLoggingOptions, Aws::Client::RejectedCallOutcome<SetLoggingOptionsOutcome>(), this, std::move(request));
 }
 
 void IoTClient::SetLoggingOptionsAsync(const SetLoggingOptionsRequest& request, const SetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::SetLoggingOptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::SetLoggingOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<SetLoggingOptionsOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::SetLoggingOptionsAsync(SetLoggingOptionsRequest&& request, const SetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::SetLoggingOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<SetLoggingOptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::SetLoggingOptionsAsyncHelper(const SetLoggingOptionsRequest& request, const SetLoggingOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1367,12 +1747,22 @@ TransferCertificateOutcome IoTClient::TransferCertificate(const TransferCertific
 
 TransferCertificateOutcomeCallable IoTClient::TransferCertificateCallable(const TransferCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::TransferCertificate, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::TransferCertificate, Aws::Client::RejectedCallOutcome<TransferCertificateOutcome>(), this, request);
+}
+
+TransferCertificateOutcomeCallable IoTClient::TransferCertificateCallable(TransferCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::TransferCertificate, Aws::Client::RejectedCallOutcome<TransferCertificateOutcome>(), this, std::move(request));
 }
 
 void IoTClient::TransferCertificateAsync(const TransferCertificateRequest& request, const TransferCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::TransferCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::TransferCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<TransferCertificateOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::TransferCertificateAsync(TransferCertificateRequest&& request, const TransferCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::TransferCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<TransferCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::TransferCertificateAsyncHelper(const TransferCertificateRequest& request, const TransferCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1399,12 +1789,22 @@ UpdateCertificateOutcome IoTClient::UpdateCertificate(const UpdateCertificateReq
 
 UpdateCertificateOutcomeCallable IoTClient::UpdateCertificateCallable(const UpdateCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::UpdateCertificate, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::UpdateCertificate, Aws::Client::RejectedCallOutcome<UpdateCertificateOutcome>(), this, request);
+}
+
+UpdateCertificateOutcomeCallable IoTClient::UpdateCertificateCallable(UpdateCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::UpdateCertificate, Aws::Client::RejectedCallOutcome<UpdateCertificateOutcome>(), this, std::move(request));
 }
 
 void IoTClient::UpdateCertificateAsync(const UpdateCertificateRequest& request, const UpdateCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::UpdateCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::UpdateCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateCertificateOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::UpdateCertificateAsync(UpdateCertificateRequest&& request, const UpdateCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::UpdateCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::UpdateCertificateAsyncHelper(const UpdateCertificateRequest& request, const UpdateCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1431,12 +1831,22 @@ UpdateThingOutcome IoTClient::UpdateThing(const UpdateThingRequest& request) con
 
 UpdateThingOutcomeCallable IoTClient::UpdateThingCallable(const UpdateThingRequest& request) const
 {
-  return std::async(std::launch::async, &IoTClient::UpdateThing, this, request);
+  return m_executor->SubmitWithFuture(&IoTClient::UpdateThing, Aws::Client::RejectedCallOutcome<UpdateThingOutcome>(), this, request);
+}
+
+UpdateThingOutcomeCallable IoTClient::UpdateThingCallable(UpdateThingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&IoTClient::UpdateThing, Aws::Client::RejectedCallOutcome<UpdateThingOutcome>(), this, std::move(request));
 }
 
 void IoTClient::UpdateThingAsync(const UpdateThingRequest& request, const UpdateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&IoTClient::UpdateThingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&IoTClient::UpdateThingAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateThingOutcome>(), this, request, handler, context);
+}
+
+void IoTClient::UpdateThingAsync(UpdateThingRequest&& request, const UpdateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&IoTClient::UpdateThingAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateThingOutcome>(), this, std::move(request), handler, context);
 }
 
 void IoTClient::UpdateThingAsyncHelper(const UpdateThingRequest& request, const UpdateThingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -30,6 +30,25 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/kinesis/model/AddTagsToStreamRequest.h>
+#include <aws/kinesis/model/CreateStreamRequest.h>
+#include <aws/kinesis/model/DecreaseStreamRetentionPeriodRequest.h>
+#include <aws/kinesis/model/DeleteStreamRequest.h>
+#include <aws/kinesis/model/DescribeStreamRequest.h>
+#include <aws/kinesis/model/GetRecordsRequest.h>
+#include <aws/kinesis/model/GetShardIteratorRequest.h>
+#include <aws/kinesis/model/IncreaseStreamRetentionPeriodRequest.h>
+#include <aws/kinesis/model/ListStreamsRequest.h>
+#include <aws/kinesis/model/ListTagsForStreamRequest.h>
+#include <aws/kinesis/model/MergeShardsRequest.h>
+#include <aws/kinesis/model/PutRecordRequest.h>
+#include <aws/kinesis/model/PutRecordsRequest.h>
+#include <aws/kinesis/model/RemoveTagsFromStreamRequest.h>
+#include <aws/kinesis/model/SplitShardRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -190,6 +209,11 @@ namespace Model
          */
         virtual Model::AddTagsToStreamOutcomeCallable AddTagsToStreamCallable(const Model::AddTagsToStreamRequest& request) const;
 
+        /**
+         * Same as AddTagsToStreamCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddTagsToStreamOutcomeCallable AddTagsToStreamCallable(Model::AddTagsToStreamRequest&& request) const;
+
         /**
          * <p>Adds or updates tags for the specified Amazon Kinesis stream. Each stream can
          * have up to 10 tags. </p> <p>If tags have already been assigned to the stream,
@@ -200,6 +224,11 @@ namespace Model
          */
         virtual void AddTagsToStreamAsync(const Model::AddTagsToStreamRequest& request, const AddTagsToStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToStreamAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddTagsToStreamAsync(Model::AddTagsToStreamRequest&& request, const AddTagsToStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a Amazon Kinesis stream. A stream captures and transports data
          * records that are continuously emitted from different data sources or
@@ -270,6 +299,11 @@ namespace Model
          */
         virtual Model::CreateStreamOutcomeCallable CreateStreamCallable(const Model::CreateStreamRequest& request) const;
 
+        /**
+         * Same as CreateStreamCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateStreamOutcomeCallable CreateStreamCallable(Model::CreateStreamRequest&& request) const;
+
         /**
          * <p>Creates a Amazon Kinesis stream. A stream captures and transports data
          * records that are continuously emitted from different data sources or
@@ -306,6 +340,11 @@ namespace Model
          */
         virtual void CreateStreamAsync(const Model::CreateStreamRequest& request, const CreateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateStreamAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateStreamAsync(Model::CreateStreamRequest&& request, const CreateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Decreases the stream's retention period, which is the length of time data
          * records are accessible after they are added to the stream. The minimum value of
@@ -328,6 +367,11 @@ namespace Model
          */
         virtual Model::DecreaseStreamRetentionPeriodOutcomeCallable DecreaseStreamRetentionPeriodCallable(const Model::DecreaseStreamRetentionPeriodRequest& request) const;
 
+        /**
+         * Same as DecreaseStreamRetentionPeriodCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DecreaseStreamRetentionPeriodOutcomeCallable DecreaseStreamRetentionPeriodCallable(Model::DecreaseStreamRetentionPeriodRequest&& request) const;
+
         /**
          * <p>Decreases the stream's retention period, which is the length of time data
          * records are accessible after they are added to the stream. The minimum value of
@@ -340,6 +384,11 @@ namespace Model
          */
         virtual void DecreaseStreamRetentionPeriodAsync(const Model::DecreaseStreamRetentionPeriodRequest& request, const DecreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DecreaseStreamRetentionPeriodAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DecreaseStreamRetentionPeriodAsync(Model::DecreaseStreamRetentionPeriodRequest&& request, const DecreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a stream and all its shards and data. You must shut down any
          * applications that are operating on the stream before you delete the stream. If
@@ -380,6 +429,11 @@ namespace Model
          */
         virtual Model::DeleteStreamOutcomeCallable DeleteStreamCallable(const Model::DeleteStreamRequest& request) const;
 
+        /**
+         * Same as DeleteStreamCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteStreamOutcomeCallable DeleteStreamCallable(Model::DeleteStreamRequest&& request) const;
+
         /**
          * <p>Deletes a stream and all its shards and data. You must shut down any
          * applications that are operating on the stream before you delete the stream. If
@@ -401,6 +455,11 @@ namespace Model
          */
         virtual void DeleteStreamAsync(const Model::DeleteStreamRequest& request, const DeleteStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteStreamAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteStreamAsync(Model::DeleteStreamRequest&& request, const DeleteStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified stream.</p> <p>The information about the stream
          * includes its current status, its Amazon Resource Name (ARN), and an array of
@@ -447,6 +506,11 @@ namespace Model
          */
         virtual Model::DescribeStreamOutcomeCallable DescribeStreamCallable(const Model::DescribeStreamRequest& request) const;
 
+        /**
+         * Same as DescribeStreamCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeStreamOutcomeCallable DescribeStreamCallable(Model::DescribeStreamRequest&& request) const;
+
         /**
          * <p>Describes the specified stream.</p> <p>The information about the stream
          * includes its current status, its Amazon Resource Name (ARN), and an array of
@@ -471,6 +535,11 @@ namespace Model
          */
         virtual void DescribeStreamAsync(const Model::DescribeStreamRequest& request, const DescribeStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStreamAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeStreamAsync(Model::DescribeStreamRequest&& request, const DescribeStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets data records from a shard.</p> <p>Specify a shard iterator using the
          * <code>ShardIterator</code> parameter. The shard iterator specifies the position
@@ -575,6 +644,11 @@ namespace Model
          */
         virtual Model::GetRecordsOutcomeCallable GetRecordsCallable(const Model::GetRecordsRequest& request) const;
 
+        /**
+         * Same as GetRecordsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetRecordsOutcomeCallable GetRecordsCallable(Model::GetRecordsRequest&& request) const;
+
         /**
          * <p>Gets data records from a shard.</p> <p>Specify a shard iterator using the
          * <code>ShardIterator</code> parameter. The shard iterator specifies the position
@@ -628,6 +702,11 @@ namespace Model
          */
         virtual void GetRecordsAsync(const Model::GetRecordsRequest& request, const GetRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRecordsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetRecordsAsync(Model::GetRecordsRequest&& request, const GetRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a shard iterator. A shard iterator expires five minutes after it is
          * returned to the requester.</p> <p>A shard iterator specifies the position in the
@@ -702,6 +781,11 @@ namespace Model
          */
         virtual Model::GetShardIteratorOutcomeCallable GetShardIteratorCallable(const Model::GetShardIteratorRequest& request) const;
 
+        /**
+         * Same as GetShardIteratorCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetShardIteratorOutcomeCallable GetShardIteratorCallable(Model::GetShardIteratorRequest&& request) const;
+
         /**
          * <p>Gets a shard iterator. A shard iterator expires five minutes after it is
          * returned to the requester.</p> <p>A shard iterator specifies the position in the
@@ -740,6 +824,11 @@ namespace Model
          */
         virtual void GetShardIteratorAsync(const Model::GetShardIteratorRequest& request, const GetShardIteratorResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetShardIteratorAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetShardIteratorAsync(Model::GetShardIteratorRequest&& request, const GetShardIteratorResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Increases the stream's retention period, which is the length of time data
          * records are accessible after they are added to the stream. The maximum value of
@@ -768,6 +857,11 @@ namespace Model
          */
         virtual Model::IncreaseStreamRetentionPeriodOutcomeCallable IncreaseStreamRetentionPeriodCallable(const Model::IncreaseStreamRetentionPeriodRequest& request) const;
 
+        /**
+         * Same as IncreaseStreamRetentionPeriodCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::IncreaseStreamRetentionPeriodOutcomeCallable IncreaseStreamRetentionPeriodCallable(Model::IncreaseStreamRetentionPeriodRequest&& request) const;
+
         /**
          * <p>Increases the stream's retention period, which is the length of time data
          * records are accessible after they are added to the stream. The maximum value of
@@ -783,6 +877,11 @@ namespace Model
          */
         virtual void IncreaseStreamRetentionPeriodAsync(const Model::IncreaseStreamRetentionPeriodRequest& request, const IncreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as IncreaseStreamRetentionPeriodAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void IncreaseStreamRetentionPeriodAsync(Model::IncreaseStreamRetentionPeriodRequest&& request, const IncreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Lists your streams.</p> <p> The number of streams may be too large to return
          * from a single call to <code>ListStreams</code>. You can limit the number of
@@ -821,6 +920,11 @@ namespace Model
          */
         virtual Model::ListStreamsOutcomeCallable ListStreamsCallable(const Model::ListStreamsRequest& request) const;
 
+        /**
+         * Same as ListStreamsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListStreamsOutcomeCallable ListStreamsCallable(Model::ListStreamsRequest&& request) const;
+
         /**
          * <p> Lists your streams.</p> <p> The number of streams may be too large to return
          * from a single call to <code>ListStreams</code>. You can limit the number of
@@ -841,6 +945,11 @@ namespace Model
          */
         virtual void ListStreamsAsync(const Model::ListStreamsRequest& request, const ListStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListStreamsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListStreamsAsync(Model::ListStreamsRequest&& request, const ListStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the tags for the specified Amazon Kinesis stream.</p>
          */
@@ -853,6 +962,11 @@ namespace Model
          */
         virtual Model::ListTagsForStreamOutcomeCallable ListTagsForStreamCallable(const Model::ListTagsForStreamRequest& request) const;
 
+        /**
+         * Same as ListTagsForStreamCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTagsForStreamOutcomeCallable ListTagsForStreamCallable(Model::ListTagsForStreamRequest&& request) const;
+
         /**
          * <p>Lists the tags for the specified Amazon Kinesis stream.</p>
          *
@@ -860,6 +974,11 @@ namespace Model
          */
         virtual void ListTagsForStreamAsync(const Model::ListTagsForStreamRequest& request, const ListTagsForStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForStreamAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTagsForStreamAsync(Model::ListTagsForStreamRequest&& request, const ListTagsForStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Merges two adjacent shards in a stream and combines them into a single shard
          * to reduce the stream's capacity to ingest and transport data. Two shards are
@@ -936,6 +1055,11 @@ namespace Model
          */
         virtual Model::MergeShardsOutcomeCallable MergeShardsCallable(const Model::MergeShardsRequest& request) const;
 
+        /**
+         * Same as MergeShardsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::MergeShardsOutcomeCallable MergeShardsCallable(Model::MergeShardsRequest&& request) const;
+
         /**
          * <p>Merges two adjacent shards in a stream and combines them into a single shard
          * to reduce the stream's capacity to ingest and transport data. Two shards are
@@ -975,6 +1099,11 @@ namespace Model
          */
         virtual void MergeShardsAsync(const Model::MergeShardsRequest& request, const MergeShardsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as MergeShardsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void MergeShardsAsync(Model::MergeShardsRequest&& request, const MergeShardsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Writes a single data record from a producer into an Amazon Kinesis stream.
          * Call <code>PutRecord</code> to send data from the producer into the Amazon
@@ -1055,6 +1184,11 @@ namespace Model
          */
         virtual Model::PutRecordOutcomeCallable PutRecordCallable(const Model::PutRecordRequest& request) const;
 
+        /**
+         * Same as PutRecordCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutRecordOutcomeCallable PutRecordCallable(Model::PutRecordRequest&& request) const;
+
         /**
          * <p>Writes a single data record from a producer into an Amazon Kinesis stream.
          * Call <code>PutRecord</code> to send data from the producer into the Amazon
@@ -1096,6 +1230,11 @@ namespace Model
          */
         virtual void PutRecordAsync(const Model::PutRecordRequest& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRecordAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutRecordAsync(Model::PutRecordRequest&& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Writes multiple data records from a producer into an Amazon Kinesis stream in
          * a single call (also referred to as a <code>PutRecords</code> request). Use this
@@ -1214,6 +1353,11 @@ namespace Model
          */
         virtual Model::PutRecordsOutcomeCallable PutRecordsCallable(const Model::PutRecordsRequest& request) const;
 
+        /**
+         * Same as PutRecordsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutRecordsOutcomeCallable PutRecordsCallable(Model::PutRecordsRequest&& request) const;
+
         /**
          * <p>Writes multiple data records from a producer into an Amazon Kinesis stream in
          * a single call (also referred to as a <code>PutRecords</code> request). Use this
@@ -1274,6 +1418,11 @@ namespace Model
          */
         virtual void PutRecordsAsync(const Model::PutRecordsRequest& request, const PutRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRecordsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutRecordsAsync(Model::PutRecordsRequest&& request, const PutRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes tags from the specified Amazon Kinesis stream.</p> <p>If you specify
          * a tag that does not exist, it is ignored.</p>
@@ -1288,6 +1437,11 @@ namespace Model
          */
         virtual Model::RemoveTagsFromStreamOutcomeCallable RemoveTagsFromStreamCallable(const Model::RemoveTagsFromStreamRequest& request) const;
 
+        /**
+         * Same as RemoveTagsFromStreamCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveTagsFromStreamOutcomeCallable RemoveTagsFromStreamCallable(Model::RemoveTagsFromStreamRequest&& request) const;
+
         /**
          * <p>Deletes tags from the specified Amazon Kinesis stream.</p> <p>If you specify
          * a tag that does not exist, it is ignored.</p>
@@ -1296,6 +1450,11 @@ namespace Model
          */
         virtual void RemoveTagsFromStreamAsync(const Model::RemoveTagsFromStreamRequest& request, const RemoveTagsFromStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromStreamAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveTagsFromStreamAsync(Model::RemoveTagsFromStreamRequest&& request, const RemoveTagsFromStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Splits a shard into two new shards in the stream, to increase the stream's
          * capacity to ingest and transport data. <code>SplitShard</code> is called when
@@ -1392,6 +1551,11 @@ namespace Model
          */
         virtual Model::SplitShardOutcomeCallable SplitShardCallable(const Model::SplitShardRequest& request) const;
 
+        /**
+         * Same as SplitShardCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SplitShardOutcomeCallable SplitShardCallable(Model::SplitShardRequest&& request) const;
+
         /**
          * <p>Splits a shard into two new shards in the stream, to increase the stream's
          * capacity to ingest and transport data. <code>SplitShard</code> is called when
@@ -1441,6 +1605,48 @@ namespace Model
          */
         virtual void SplitShardAsync(const Model::SplitShardRequest& request, const SplitShardResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SplitShardAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SplitShardAsync(Model::SplitShardRequest&& request, const SplitShardResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsToStreamOutcome> AddTagsToStreamAwaitable(const Model::AddTagsToStreamRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::AddTagsToStream, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsToStreamOutcome> AddTagsToStreamAwaitable(Model::AddTagsToStreamRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::AddTagsToStream, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateStreamOutcome> CreateStreamAwaitable(const Model::CreateStreamRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::CreateStream, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateStreamOutcome> CreateStreamAwaitable(Model::CreateStreamRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::CreateStream, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DecreaseStreamRetentionPeriodOutcome> DecreaseStreamRetentionPeriodAwaitable(const Model::DecreaseStreamRetentionPeriodRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::DecreaseStreamRetentionPeriod, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DecreaseStreamRetentionPeriodOutcome> DecreaseStreamRetentionPeriodAwaitable(Model::DecreaseStreamRetentionPeriodRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::DecreaseStreamRetentionPeriod, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteStreamOutcome> DeleteStreamAwaitable(const Model::DeleteStreamRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::DeleteStream, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteStreamOutcome> DeleteStreamAwaitable(Model::DeleteStreamRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::DeleteStream, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStreamOutcome> DescribeStreamAwaitable(const Model::DescribeStreamRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::DescribeStream, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStreamOutcome> DescribeStreamAwaitable(Model::DescribeStreamRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::DescribeStream, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRecordsOutcome> GetRecordsAwaitable(const Model::GetRecordsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::GetRecords, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRecordsOutcome> GetRecordsAwaitable(Model::GetRecordsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::GetRecords, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetShardIteratorOutcome> GetShardIteratorAwaitable(const Model::GetShardIteratorRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::GetShardIterator, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetShardIteratorOutcome> GetShardIteratorAwaitable(Model::GetShardIteratorRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::GetShardIterator, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::IncreaseStreamRetentionPeriodOutcome> IncreaseStreamRetentionPeriodAwaitable(const Model::IncreaseStreamRetentionPeriodRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::IncreaseStreamRetentionPeriod, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::IncreaseStreamRetentionPeriodOutcome> IncreaseStreamRetentionPeriodAwaitable(Model::IncreaseStreamRetentionPeriodRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::IncreaseStreamRetentionPeriod, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListStreamsOutcome> ListStreamsAwaitable(const Model::ListStreamsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::ListStreams, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListStreamsOutcome> ListStreamsAwaitable(Model::ListStreamsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::ListStreams, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForStreamOutcome> ListTagsForStreamAwaitable(const Model::ListTagsForStreamRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::ListTagsForStream, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForStreamOutcome> ListTagsForStreamAwaitable(Model::ListTagsForStreamRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::ListTagsForStream, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::MergeShardsOutcome> MergeShardsAwaitable(const Model::MergeShardsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::MergeShards, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::MergeShardsOutcome> MergeShardsAwaitable(Model::MergeShardsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::MergeShards, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRecordOutcome> PutRecordAwaitable(const Model::PutRecordRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::PutRecord, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRecordOutcome> PutRecordAwaitable(Model::PutRecordRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::PutRecord, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRecordsOutcome> PutRecordsAwaitable(const Model::PutRecordsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::PutRecords, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRecordsOutcome> PutRecordsAwaitable(Model::PutRecordsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::PutRecords, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsFromStreamOutcome> RemoveTagsFromStreamAwaitable(const Model::RemoveTagsFromStreamRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::RemoveTagsFromStream, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsFromStreamOutcome> RemoveTagsFromStreamAwaitable(Model::RemoveTagsFromStreamRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::RemoveTagsFromStream, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SplitShardOutcome> SplitShardAwaitable(const Model::SplitShardRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::SplitShard, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SplitShardOutcome> SplitShardAwaitable(Model::SplitShardRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KinesisClient::SplitShard, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -122,12 +122,22 @@ AddTagsToStreamOutcome KinesisClient::AddTagsToStream(const AddTagsToStreamReque
 
 AddTagsToStreamOutcomeCallable KinesisClient::AddTagsToStreamCallable(const AddTagsToStreamRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::AddTagsToStream, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::AddTagsToStream, Aws::Client::RejectedCallOutcome<AddTagsToStreamOutcome>(), this, request);
+}
+
+AddTagsToStreamOutcomeCallable KinesisClient::AddTagsToStreamCallable(AddTagsToStreamRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::AddTagsToStream, Aws::Client::RejectedCallOutcome<AddTagsToStreamOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::AddTagsToStreamAsync(const AddTagsToStreamRequest& request, const AddTagsToStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::AddTagsToStreamAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::AddTagsToStreamAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsToStreamOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::AddTagsToStreamAsync(AddTagsToStreamRequest&& request, const AddTagsToStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::AddTagsToStreamAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsToStreamOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::AddTagsToStreamAsyncHelper(const AddTagsToStreamRequest& request, const AddTagsToStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -153,12 +163,22 @@ CreateStreamOutcome KinesisClient::CreateStream(const CreateStreamRequest& reque
 
 CreateStreamOutcomeCallable KinesisClient::CreateStreamCallable(const CreateStreamRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::CreateStream, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::CreateStream, Aws::Client::RejectedCallOutcome<CreateStreamOutcome>(), this, request);
+}
+
+CreateStreamOutcomeCallable KinesisClient::CreateStreamCallable(CreateStreamRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::CreateStream, Aws::Client::RejectedCallOutcome<CreateStreamOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::CreateStreamAsync(const CreateStreamRequest& request, const CreateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::CreateStreamAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::CreateStreamAsyncHelper, Aws::Client::RejectedAsyncCall<CreateStreamOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::CreateStreamAsync(CreateStreamRequest&& request, const CreateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::CreateStreamAsyncHelper, Aws::Client::RejectedAsyncCall<CreateStreamOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::CreateStreamAsyncHelper(const CreateStreamRequest& request, const CreateStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -184,12 +204,22 @@ DecreaseStreamRetentionPeriodOutcome KinesisClient::DecreaseStreamRetentionPerio
 
 DecreaseStreamRetentionPeriodOutcomeCallable KinesisClient::DecreaseStreamRetentionPeriodCallable(const DecreaseStreamRetentionPeriodRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::DecreaseStreamRetentionPeriod, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::DecreaseStreamRetentionPeriod, Aws::Client::RejectedCallOutcome<DecreaseStreamRetentionPeriodOutcome>(), this, request);
+}
+
+DecreaseStreamRetentionPeriodOutcomeCallable KinesisClient::DecreaseStreamRetentionPeriodCallable(DecreaseStreamRetentionPeriodRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::DecreaseStreamRetentionPeriod, Aws::Client::RejectedCallOutcome<DecreaseStreamRetentionPeriodOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::DecreaseStreamRetentionPeriodAsync(const DecreaseStreamRetentionPeriodRequest& request, const DecreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::DecreaseStreamRetentionPeriodAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::DecreaseStreamRetentionPeriodAsyncHelper, Aws::Client::RejectedAsyncCall<DecreaseStreamRetentionPeriodOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::DecreaseStreamRetentionPeriodAsync(DecreaseStreamRetentionPeriodRequest&& request, const DecreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::DecreaseStreamRetentionPeriodAsyncHelper, Aws::Client::RejectedAsyncCall<DecreaseStreamRetentionPeriodOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::DecreaseStreamRetentionPeriodAsyncHelper(const DecreaseStreamRetentionPeriodRequest& request, const DecreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -215,12 +245,22 @@ DeleteStreamOutcome KinesisClient::DeleteStream(const DeleteStreamRequest& reque
 
 DeleteStreamOutcomeCallable KinesisClient::DeleteStreamCallable(const DeleteStreamRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::DeleteStream, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::DeleteStream, Aws::Client::RejectedCallOutcome<DeleteStreamOutcome>(), this, request);
+}
+
+DeleteStreamOutcomeCallable KinesisClient::DeleteStreamCallable(DeleteStreamRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::DeleteStream, Aws::Client::RejectedCallOutcome<DeleteStreamOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::DeleteStreamAsync(const DeleteStreamRequest& request, const DeleteStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::DeleteStreamAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::DeleteStreamAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteStreamOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::DeleteStreamAsync(DeleteStreamRequest&& request, const DeleteStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::DeleteStreamAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteStreamOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::DeleteStreamAsyncHelper(const DeleteStreamRequest& request, const DeleteStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -246,12 +286,22 @@ DescribeStreamOutcome KinesisClient::DescribeStream(const DescribeStreamRequest&
 
 DescribeStreamOutcomeCallable KinesisClient::DescribeStreamCallable(const DescribeStreamRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::DescribeStream, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::DescribeStream, Aws::Client::RejectedCallOutcome<DescribeStreamOutcome>(), this, request);
+}
+
+DescribeStreamOutcomeCallable KinesisClient::DescribeStreamCallable(DescribeStreamRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::DescribeStream, Aws::Client::RejectedCallOutcome<DescribeStreamOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::DescribeStreamAsync(const DescribeStreamRequest& request, const DescribeStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::DescribeStreamAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::DescribeStreamAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStreamOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::DescribeStreamAsync(DescribeStreamRequest&& request, const DescribeStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::DescribeStreamAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStreamOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::DescribeStreamAsyncHelper(const DescribeStreamRequest& request, const DescribeStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -277,12 +327,22 @@ GetRecordsOutcome KinesisClient::GetRecords(const GetRecordsRequest& request) co
 
 GetRecordsOutcomeCallable KinesisClient::GetRecordsCallable(const GetRecordsRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::GetRecords, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::GetRecords, Aws::Client::RejectedCallOutcome<GetRecordsOutcome>(), this, request);
+}
+
+GetRecordsOutcomeCallable KinesisClient::GetRecordsCallable(GetRecordsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::GetRecords, Aws::Client::RejectedCallOutcome<GetRecordsOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::GetRecordsAsync(const GetRecordsRequest& request, const GetRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::GetRecordsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::GetRecordsAsyncHelper, Aws::Client::RejectedAsyncCall<GetRecordsOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::GetRecordsAsync(GetRecordsRequest&& request, const GetRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::GetRecordsAsyncHelper, Aws::Client::RejectedAsyncCall<GetRecordsOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::GetRecordsAsyncHelper(const GetRecordsRequest& request, const GetRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -308,12 +368,22 @@ GetShardIteratorOutcome KinesisClient::GetShardIterator(const GetShardIteratorRe
 
 GetShardIteratorOutcomeCallable KinesisClient::GetShardIteratorCallable(const GetShardIteratorRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::GetShardIterator, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::GetShardIterator, Aws::Client::RejectedCallOutcome<GetShardIteratorOutcome>(), this, request);
+}
+
+GetShardIteratorOutcomeCallable KinesisClient::GetShardIteratorCallable(GetShardIteratorRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::GetShardIterator, Aws::Client::RejectedCallOutcome<GetShardIteratorOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::GetShardIteratorAsync(const GetShardIteratorRequest& request, const GetShardIteratorResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::GetShardIteratorAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::GetShardIteratorAsyncHelper, Aws::Client::RejectedAsyncCall<GetShardIteratorOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::GetShardIteratorAsync(GetShardIteratorRequest&& request, const GetShardIteratorResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::GetShardIteratorAsyncHelper, Aws::Client::RejectedAsyncCall<GetShardIteratorOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::GetShardIteratorAsyncHelper(const GetShardIteratorRequest& request, const GetShardIteratorResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -339,12 +409,22 @@ IncreaseStreamRetentionPeriodOutcome KinesisClient::IncreaseStreamRetentionPerio
 
 IncreaseStreamRetentionPeriodOutcomeCallable KinesisClient::IncreaseStreamRetentionPeriodCallable(const IncreaseStreamRetentionPeriodRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::IncreaseStreamRetentionPeriod, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::IncreaseStreamRetentionPeriod, Aws::Client::RejectedCallOutcome<IncreaseStreamRetentionPeriodOutcome>(), this, request);
+}
+
+IncreaseStreamRetentionPeriodOutcomeCallable KinesisClient::IncreaseStreamRetentionPeriodCallable(IncreaseStreamRetentionPeriodRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::IncreaseStreamRetentionPeriod, Aws::Client::RejectedCallOutcome<IncreaseStreamRetentionPeriodOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::IncreaseStreamRetentionPeriodAsync(const IncreaseStreamRetentionPeriodRequest& request, const IncreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::IncreaseStreamRetentionPeriodAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::IncreaseStreamRetentionPeriodAsyncHelper, Aws::Client::RejectedAsyncCall<IncreaseStreamRetentionPeriodOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::IncreaseStreamRetentionPeriodAsync(IncreaseStreamRetentionPeriodRequest&& request, const IncreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::IncreaseStreamRetentionPeriodAsyncHelper, Aws::Client::RejectedAsyncCall<IncreaseStreamRetentionPeriodOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::IncreaseStreamRetentionPeriodAsyncHelper(const IncreaseStreamRetentionPeriodRequest& request, const IncreaseStreamRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -370,12 +450,22 @@ ListStreamsOutcome KinesisClient::ListStreams(const ListStreamsRequest& request)
 
 ListStreamsOutcomeCallable KinesisClient::ListStreamsCallable(const ListStreamsRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::ListStreams, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::ListStreams, Aws::Client::RejectedCallOutcome<ListStreamsOutcome>(), this, request);
+}
+
+ListStreamsOutcomeCallable KinesisClient::ListStreamsCallable(ListStreamsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::ListStreams, Aws::Client::RejectedCallOutcome<ListStreamsOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::ListStreamsAsync(const ListStreamsRequest& request, const ListStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::ListStreamsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::ListStreamsAsyncHelper, Aws::Client::RejectedAsyncCall<ListStreamsOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::ListStreamsAsync(ListStreamsRequest&& request, const ListStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::ListStreamsAsyncHelper, Aws::Client::RejectedAsyncCall<ListStreamsOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::ListStreamsAsyncHelper(const ListStreamsRequest& request, const ListStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -401,12 +491,22 @@ ListTagsForStreamOutcome KinesisClient::ListTagsForStream(const ListTagsForStrea
 
 ListTagsForStreamOutcomeCallable KinesisClient::ListTagsForStreamCallable(const ListTagsForStreamRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::ListTagsForStream, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::ListTagsForStream, Aws::Client::RejectedCallOutcome<ListTagsForStreamOutcome>(), this, request);
+}
+
+ListTagsForStreamOutcomeCallable KinesisClient::ListTagsForStreamCallable(ListTagsForStreamRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::ListTagsForStream, Aws::Client::RejectedCallOutcome<ListTagsForStreamOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::ListTagsForStreamAsync(const ListTagsForStreamRequest& request, const ListTagsForStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::ListTagsForStreamAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::ListTagsForStreamAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForStreamOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::ListTagsForStreamAsync(ListTagsForStreamRequest&& request, const ListTagsForStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::ListTagsForStreamAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForStreamOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::ListTagsForStreamAsyncHelper(const ListTagsForStreamRequest& request, const ListTagsForStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -432,12 +532,22 @@ MergeShardsOutcome KinesisClient::MergeShards(const MergeShardsRequest& request)
 
 MergeShardsOutcomeCallable KinesisClient::MergeShardsCallable(const MergeShardsRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::MergeShards, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::MergeShards, Aws::Client::RejectedCallOutcome<MergeShardsOutcome>(), this, request);
+}
+
+MergeShardsOutcomeCallable KinesisClient::MergeShardsCallable(MergeShardsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::MergeShards, Aws::Client::RejectedCallOutcome<MergeShardsOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::MergeShardsAsync(const MergeShardsRequest& request, const MergeShardsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::MergeShardsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::MergeShardsAsyncHelper, Aws::Client::RejectedAsyncCall<MergeShardsOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::MergeShardsAsync(MergeShardsRequest&& request, const MergeShardsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::MergeShardsAsyncHelper, Aws::Client::RejectedAsyncCall<MergeShardsOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::MergeShardsAsyncHelper(const MergeShardsRequest& request, const MergeShardsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -463,12 +573,22 @@ PutRecordOutcome KinesisClient::PutRecord(const PutRecordRequest& request) const
 
 PutRecordOutcomeCallable KinesisClient::PutRecordCallable(const PutRecordRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::PutRecord, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::PutRecord, Aws::Client::RejectedCallOutcome<PutRecordOutcome>(), this, request);
+}
+
+PutRecordOutcomeCallable KinesisClient::PutRecordCallable(PutRecordRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::PutRecord, Aws::Client::RejectedCallOutcome<PutRecordOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::PutRecordAsync(const PutRecordRequest& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::PutRecordAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::PutRecordAsyncHelper, Aws::Client::RejectedAsyncCall<PutRecordOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::PutRecordAsync(PutRecordRequest&& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::PutRecordAsyncHelper, Aws::Client::RejectedAsyncCall<PutRecordOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::PutRecordAsyncHelper(const PutRecordRequest& request, const PutRecordResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -494,12 +614,22 @@ PutRecordsOutcome KinesisClient::PutRecords(const PutRecordsRequest& request) co
 
 PutRecordsOutcomeCallable KinesisClient::PutRecordsCallable(const PutRecordsRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::PutRecords, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::PutRecords, Aws::Client::RejectedCallOutcome<PutRecordsOutcome>(), this, request);
+}
+
+PutRecordsOutcomeCallable KinesisClient::PutRecordsCallable(PutRecordsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::PutRecords, Aws::Client::RejectedCallOutcome<PutRecordsOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::PutRecordsAsync(const PutRecordsRequest& request, const PutRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::PutRecordsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::PutRecordsAsyncHelper, Aws::Client::RejectedAsyncCall<PutRecordsOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::PutRecordsAsync(PutRecordsRequest&& request, const PutRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::PutRecordsAsyncHelper, Aws::Client::RejectedAsyncCall<PutRecordsOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::PutRecordsAsyncHelper(const PutRecordsRequest& request, const PutRecordsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -525,12 +655,22 @@ RemoveTagsFromStreamOutcome KinesisClient::RemoveTagsFromStream(const RemoveTags
 
 RemoveTagsFromStreamOutcomeCallable KinesisClient::RemoveTagsFromStreamCallable(const RemoveTagsFromStreamRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::RemoveTagsFromStream, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::RemoveTagsFromStream, Aws::Client::RejectedCallOutcome<RemoveTagsFromStreamOutcome>(), this, request);
+}
+
+RemoveTagsFromStreamOutcomeCallable KinesisClient::RemoveTagsFromStreamCallable(RemoveTagsFromStreamRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::RemoveTagsFromStream, Aws::Client::RejectedCallOutcome<RemoveTagsFromStreamOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::RemoveTagsFromStreamAsync(const RemoveTagsFromStreamRequest& request, const RemoveTagsFromStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::RemoveTagsFromStreamAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::RemoveTagsFromStreamAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsFromStreamOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::RemoveTagsFromStreamAsync(RemoveTagsFromStreamRequest&& request, const RemoveTagsFromStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::RemoveTagsFromStreamAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsFromStreamOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::RemoveTagsFromStreamAsyncHelper(const RemoveTagsFromStreamRequest& request, const RemoveTagsFromStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -556,12 +696,22 @@ SplitShardOutcome KinesisClient::SplitShard(const SplitShardRequest& request) co
 
 SplitShardOutcomeCallable KinesisClient::SplitShardCallable(const SplitShardRequest& request) const
 {
-  return std::async(std::launch::async, &KinesisClient::SplitShard, this, request);
+  return m_executor->SubmitWithFuture(&KinesisClient::SplitShard, Aws::Client::RejectedCallOutcome<SplitShardOutcome>(), this, request);
+}
+
+SplitShardOutcomeCallable KinesisClient::SplitShardCallable(SplitShardRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KinesisClient::SplitShard, Aws::Client::RejectedCallOutcome<SplitShardOutcome>(), this, std::move(request));
 }
 
 void KinesisClient::SplitShardAsync(const SplitShardRequest& request, const SplitShardResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KinesisClient::SplitShardAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KinesisClient::SplitShardAsyncHelper, Aws::Client::RejectedAsyncCall<SplitShardOutcome>(), this, request, handler, context);
+}
+
+void KinesisClient::SplitShardAsync(SplitShardRequest&& request, const SplitShardResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KinesisClient::SplitShardAsyncHelper, Aws::Client::RejectedAsyncCall<SplitShardOutcome>(), this, std::move(request), handler, context);
 }
 
 void KinesisClient::SplitShardAsyncHelper(const SplitShardRequest& request, const SplitShardResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -41,6 +41,39 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/kms/model/CancelKeyDeletionRequest.h>
+#include <aws/kms/model/CreateAliasRequest.h>
+#include <aws/kms/model/CreateGrantRequest.h>
+#include <aws/kms/model/CreateKeyRequest.h>
+#include <aws/kms/model/DecryptRequest.h>
+#include <aws/kms/model/DeleteAliasRequest.h>
+#include <aws/kms/model/DescribeKeyRequest.h>
+#include <aws/kms/model/DisableKeyRequest.h>
+#include <aws/kms/model/DisableKeyRotationRequest.h>
+#include <aws/kms/model/EnableKeyRequest.h>
+#include <aws/kms/model/EnableKeyRotationRequest.h>
+#include <aws/kms/model/EncryptRequest.h>
+#include <aws/kms/model/GenerateDataKeyRequest.h>
+#include <aws/kms/model/GenerateDataKeyWithoutPlaintextRequest.h>
+#include <aws/kms/model/GenerateRandomRequest.h>
+#include <aws/kms/model/GetKeyPolicyRequest.h>
+#include <aws/kms/model/GetKeyRotationStatusRequest.h>
+#include <aws/kms/model/ListAliasesRequest.h>
+#include <aws/kms/model/ListGrantsRequest.h>
+#include <aws/kms/model/ListKeyPoliciesRequest.h>
+#include <aws/kms/model/ListKeysRequest.h>
+#include <aws/kms/model/ListRetirableGrantsRequest.h>
+#include <aws/kms/model/PutKeyPolicyRequest.h>
+#include <aws/kms/model/ReEncryptRequest.h>
+#include <aws/kms/model/RetireGrantRequest.h>
+#include <aws/kms/model/RevokeGrantRequest.h>
+#include <aws/kms/model/ScheduleKeyDeletionRequest.h>
+#include <aws/kms/model/UpdateAliasRequest.h>
+#include <aws/kms/model/UpdateKeyDescriptionRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -311,6 +344,11 @@ namespace Model
          */
         virtual Model::CancelKeyDeletionOutcomeCallable CancelKeyDeletionCallable(const Model::CancelKeyDeletionRequest& request) const;
 
+        /**
+         * Same as CancelKeyDeletionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelKeyDeletionOutcomeCallable CancelKeyDeletionCallable(Model::CancelKeyDeletionRequest&& request) const;
+
         /**
          * <p>Cancels the deletion of a customer master key (CMK). When this operation is
          * successful, the CMK is set to the <code>Disabled</code> state. To enable a CMK,
@@ -324,6 +362,11 @@ namespace Model
          */
         virtual void CancelKeyDeletionAsync(const Model::CancelKeyDeletionRequest& request, const CancelKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelKeyDeletionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelKeyDeletionAsync(Model::CancelKeyDeletionRequest&& request, const CancelKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a display name for a customer master key. An alias can be used to
          * identify a key and should be unique. The console enforces a one-to-one mapping
@@ -352,6 +395,11 @@ namespace Model
          */
         virtual Model::CreateAliasOutcomeCallable CreateAliasCallable(const Model::CreateAliasRequest& request) const;
 
+        /**
+         * Same as CreateAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateAliasOutcomeCallable CreateAliasCallable(Model::CreateAliasRequest&& request) const;
+
         /**
          * <p>Creates a display name for a customer master key. An alias can be used to
          * identify a key and should be unique. The console enforces a one-to-one mapping
@@ -367,6 +415,11 @@ namespace Model
          */
         virtual void CreateAliasAsync(const Model::CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateAliasAsync(Model::CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds a grant to a key to specify who can use the key and under what
          * conditions. Grants are alternate permission mechanisms to key policies.</p>
@@ -387,6 +440,11 @@ namespace Model
          */
         virtual Model::CreateGrantOutcomeCallable CreateGrantCallable(const Model::CreateGrantRequest& request) const;
 
+        /**
+         * Same as CreateGrantCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateGrantOutcomeCallable CreateGrantCallable(Model::CreateGrantRequest&& request) const;
+
         /**
          * <p>Adds a grant to a key to specify who can use the key and under what
          * conditions. Grants are alternate permission mechanisms to key policies.</p>
@@ -398,6 +456,11 @@ namespace Model
          */
         virtual void CreateGrantAsync(const Model::CreateGrantRequest& request, const CreateGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateGrantAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateGrantAsync(Model::CreateGrantRequest&& request, const CreateGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a customer master key. Customer master keys can be used to encrypt
          * small amounts of data (less than 4K) directly, but they are most commonly used
@@ -418,6 +481,11 @@ namespace Model
          */
         virtual Model::CreateKeyOutcomeCallable CreateKeyCallable(const Model::CreateKeyRequest& request) const;
 
+        /**
+         * Same as CreateKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateKeyOutcomeCallable CreateKeyCallable(Model::CreateKeyRequest&& request) const;
+
         /**
          * <p>Creates a customer master key. Customer master keys can be used to encrypt
          * small amounts of data (less than 4K) directly, but they are most commonly used
@@ -429,6 +497,11 @@ namespace Model
          */
         virtual void CreateKeyAsync(const Model::CreateKeyRequest& request, const CreateKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateKeyAsync(Model::CreateKeyRequest&& request, const CreateKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Decrypts ciphertext. Ciphertext is plaintext that has been previously
          * encrypted by using any of the following functions: <ul>
@@ -463,6 +536,11 @@ namespace Model
          */
         virtual Model::DecryptOutcomeCallable DecryptCallable(const Model::DecryptRequest& request) const;
 
+        /**
+         * Same as DecryptCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DecryptOutcomeCallable DecryptCallable(Model::DecryptRequest&& request) const;
+
         /**
          * <p>Decrypts ciphertext. Ciphertext is plaintext that has been previously
          * encrypted by using any of the following functions: <ul>
@@ -481,6 +559,11 @@ namespace Model
          */
         virtual void DecryptAsync(const Model::DecryptRequest& request, const DecryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DecryptAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DecryptAsync(Model::DecryptRequest&& request, const DecryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified alias. To map an alias to a different key, call
          * <a>UpdateAlias</a>.</p>
@@ -495,6 +578,11 @@ namespace Model
          */
         virtual Model::DeleteAliasOutcomeCallable DeleteAliasCallable(const Model::DeleteAliasRequest& request) const;
 
+        /**
+         * Same as DeleteAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteAliasOutcomeCallable DeleteAliasCallable(Model::DeleteAliasRequest&& request) const;
+
         /**
          * <p>Deletes the specified alias. To map an alias to a different key, call
          * <a>UpdateAlias</a>.</p>
@@ -503,6 +591,11 @@ namespace Model
          */
         virtual void DeleteAliasAsync(const Model::DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteAliasAsync(Model::DeleteAliasRequest&& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Provides detailed information about the specified customer master key.</p>
          */
@@ -515,6 +608,11 @@ namespace Model
          */
         virtual Model::DescribeKeyOutcomeCallable DescribeKeyCallable(const Model::DescribeKeyRequest& request) const;
 
+        /**
+         * Same as DescribeKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeKeyOutcomeCallable DescribeKeyCallable(Model::DescribeKeyRequest&& request) const;
+
         /**
          * <p>Provides detailed information about the specified customer master key.</p>
          *
@@ -522,6 +620,11 @@ namespace Model
          */
         virtual void DescribeKeyAsync(const Model::DescribeKeyRequest& request, const DescribeKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeKeyAsync(Model::DescribeKeyRequest&& request, const DescribeKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the state of a master key to disabled, thereby preventing its use for
          * cryptographic operations. For more information about how key state affects the
@@ -544,6 +647,11 @@ namespace Model
          */
         virtual Model::DisableKeyOutcomeCallable DisableKeyCallable(const Model::DisableKeyRequest& request) const;
 
+        /**
+         * Same as DisableKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableKeyOutcomeCallable DisableKeyCallable(Model::DisableKeyRequest&& request) const;
+
         /**
          * <p>Sets the state of a master key to disabled, thereby preventing its use for
          * cryptographic operations. For more information about how key state affects the
@@ -556,6 +664,11 @@ namespace Model
          */
         virtual void DisableKeyAsync(const Model::DisableKeyRequest& request, const DisableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableKeyAsync(Model::DisableKeyRequest&& request, const DisableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables rotation of the specified key.</p>
          */
@@ -568,6 +681,11 @@ namespace Model
          */
         virtual Model::DisableKeyRotationOutcomeCallable DisableKeyRotationCallable(const Model::DisableKeyRotationRequest& request) const;
 
+        /**
+         * Same as DisableKeyRotationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableKeyRotationOutcomeCallable DisableKeyRotationCallable(Model::DisableKeyRotationRequest&& request) const;
+
         /**
          * <p>Disables rotation of the specified key.</p>
          *
@@ -575,6 +693,11 @@ namespace Model
          */
         virtual void DisableKeyRotationAsync(const Model::DisableKeyRotationRequest& request, const DisableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableKeyRotationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableKeyRotationAsync(Model::DisableKeyRotationRequest&& request, const DisableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Marks a key as enabled, thereby permitting its use.</p>
          */
@@ -587,6 +710,11 @@ namespace Model
          */
         virtual Model::EnableKeyOutcomeCallable EnableKeyCallable(const Model::EnableKeyRequest& request) const;
 
+        /**
+         * Same as EnableKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableKeyOutcomeCallable EnableKeyCallable(Model::EnableKeyRequest&& request) const;
+
         /**
          * <p>Marks a key as enabled, thereby permitting its use.</p>
          *
@@ -594,6 +722,11 @@ namespace Model
          */
         virtual void EnableKeyAsync(const Model::EnableKeyRequest& request, const EnableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableKeyAsync(Model::EnableKeyRequest&& request, const EnableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables rotation of the specified customer master key.</p>
          */
@@ -606,6 +739,11 @@ namespace Model
          */
         virtual Model::EnableKeyRotationOutcomeCallable EnableKeyRotationCallable(const Model::EnableKeyRotationRequest& request) const;
 
+        /**
+         * Same as EnableKeyRotationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableKeyRotationOutcomeCallable EnableKeyRotationCallable(Model::EnableKeyRotationRequest&& request) const;
+
         /**
          * <p>Enables rotation of the specified customer master key.</p>
          *
@@ -613,6 +751,11 @@ namespace Model
          */
         virtual void EnableKeyRotationAsync(const Model::EnableKeyRotationRequest& request, const EnableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableKeyRotationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableKeyRotationAsync(Model::EnableKeyRotationRequest&& request, const EnableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Encrypts plaintext into ciphertext by using a customer master key. The
          * <code>Encrypt</code> function has two primary use cases: <ul> <li>You can
@@ -655,6 +798,11 @@ namespace Model
          */
         virtual Model::EncryptOutcomeCallable EncryptCallable(const Model::EncryptRequest& request) const;
 
+        /**
+         * Same as EncryptCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EncryptOutcomeCallable EncryptCallable(Model::EncryptRequest&& request) const;
+
         /**
          * <p>Encrypts plaintext into ciphertext by using a customer master key. The
          * <code>Encrypt</code> function has two primary use cases: <ul> <li>You can
@@ -677,6 +825,11 @@ namespace Model
          */
         virtual void EncryptAsync(const Model::EncryptRequest& request, const EncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EncryptAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EncryptAsync(Model::EncryptRequest&& request, const EncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates a data key that you can use in your application to locally encrypt
          * data. This call returns a plaintext version of the key in the
@@ -745,6 +898,11 @@ namespace Model
          */
         virtual Model::GenerateDataKeyOutcomeCallable GenerateDataKeyCallable(const Model::GenerateDataKeyRequest& request) const;
 
+        /**
+         * Same as GenerateDataKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GenerateDataKeyOutcomeCallable GenerateDataKeyCallable(Model::GenerateDataKeyRequest&& request) const;
+
         /**
          * <p>Generates a data key that you can use in your application to locally encrypt
          * data. This call returns a plaintext version of the key in the
@@ -780,6 +938,11 @@ namespace Model
          */
         virtual void GenerateDataKeyAsync(const Model::GenerateDataKeyRequest& request, const GenerateDataKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GenerateDataKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GenerateDataKeyAsync(Model::GenerateDataKeyRequest&& request, const GenerateDataKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a data key encrypted by a customer master key without the plaintext
          * copy of that key. Otherwise, this API functions exactly like
@@ -800,6 +963,11 @@ namespace Model
          */
         virtual Model::GenerateDataKeyWithoutPlaintextOutcomeCallable GenerateDataKeyWithoutPlaintextCallable(const Model::GenerateDataKeyWithoutPlaintextRequest& request) const;
 
+        /**
+         * Same as GenerateDataKeyWithoutPlaintextCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GenerateDataKeyWithoutPlaintextOutcomeCallable GenerateDataKeyWithoutPlaintextCallable(Model::GenerateDataKeyWithoutPlaintextRequest&& request) const;
+
         /**
          * <p>Returns a data key encrypted by a customer master key without the plaintext
          * copy of that key. Otherwise, this API functions exactly like
@@ -811,6 +979,11 @@ namespace Model
          */
         virtual void GenerateDataKeyWithoutPlaintextAsync(const Model::GenerateDataKeyWithoutPlaintextRequest& request, const GenerateDataKeyWithoutPlaintextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GenerateDataKeyWithoutPlaintextAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GenerateDataKeyWithoutPlaintextAsync(Model::GenerateDataKeyWithoutPlaintextRequest&& request, const GenerateDataKeyWithoutPlaintextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates an unpredictable byte string. </p>
          */
@@ -823,6 +996,11 @@ namespace Model
          */
         virtual Model::GenerateRandomOutcomeCallable GenerateRandomCallable(const Model::GenerateRandomRequest& request) const;
 
+        /**
+         * Same as GenerateRandomCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GenerateRandomOutcomeCallable GenerateRandomCallable(Model::GenerateRandomRequest&& request) const;
+
         /**
          * <p>Generates an unpredictable byte string. </p>
          *
@@ -830,6 +1008,11 @@ namespace Model
          */
         virtual void GenerateRandomAsync(const Model::GenerateRandomRequest& request, const GenerateRandomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GenerateRandomAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GenerateRandomAsync(Model::GenerateRandomRequest&& request, const GenerateRandomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a policy attached to the specified key.</p>
          */
@@ -842,6 +1025,11 @@ namespace Model
          */
         virtual Model::GetKeyPolicyOutcomeCallable GetKeyPolicyCallable(const Model::GetKeyPolicyRequest& request) const;
 
+        /**
+         * Same as GetKeyPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetKeyPolicyOutcomeCallable GetKeyPolicyCallable(Model::GetKeyPolicyRequest&& request) const;
+
         /**
          * <p>Retrieves a policy attached to the specified key.</p>
          *
@@ -849,6 +1037,11 @@ namespace Model
          */
         virtual void GetKeyPolicyAsync(const Model::GetKeyPolicyRequest& request, const GetKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetKeyPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetKeyPolicyAsync(Model::GetKeyPolicyRequest&& request, const GetKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a Boolean value that indicates whether key rotation is enabled for
          * the specified key.</p>
@@ -863,6 +1056,11 @@ namespace Model
          */
         virtual Model::GetKeyRotationStatusOutcomeCallable GetKeyRotationStatusCallable(const Model::GetKeyRotationStatusRequest& request) const;
 
+        /**
+         * Same as GetKeyRotationStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetKeyRotationStatusOutcomeCallable GetKeyRotationStatusCallable(Model::GetKeyRotationStatusRequest&& request) const;
+
         /**
          * <p>Retrieves a Boolean value that indicates whether key rotation is enabled for
          * the specified key.</p>
@@ -871,6 +1069,11 @@ namespace Model
          */
         virtual void GetKeyRotationStatusAsync(const Model::GetKeyRotationStatusRequest& request, const GetKeyRotationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetKeyRotationStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetKeyRotationStatusAsync(Model::GetKeyRotationStatusRequest&& request, const GetKeyRotationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all of the key aliases in the account.</p>
          */
@@ -883,6 +1086,11 @@ namespace Model
          */
         virtual Model::ListAliasesOutcomeCallable ListAliasesCallable(const Model::ListAliasesRequest& request) const;
 
+        /**
+         * Same as ListAliasesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAliasesOutcomeCallable ListAliasesCallable(Model::ListAliasesRequest&& request) const;
+
         /**
          * <p>Lists all of the key aliases in the account.</p>
          *
@@ -890,6 +1098,11 @@ namespace Model
          */
         virtual void ListAliasesAsync(const Model::ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAliasesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAliasesAsync(Model::ListAliasesRequest&& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>List the grants for a specified key.</p>
          */
@@ -902,6 +1115,11 @@ namespace Model
          */
         virtual Model::ListGrantsOutcomeCallable ListGrantsCallable(const Model::ListGrantsRequest& request) const;
 
+        /**
+         * Same as ListGrantsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListGrantsOutcomeCallable ListGrantsCallable(Model::ListGrantsRequest&& request) const;
+
         /**
          * <p>List the grants for a specified key.</p>
          *
@@ -909,6 +1127,11 @@ namespace Model
          */
         virtual void ListGrantsAsync(const Model::ListGrantsRequest& request, const ListGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListGrantsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListGrantsAsync(Model::ListGrantsRequest&& request, const ListGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves a list of policies attached to a key.</p>
          */
@@ -921,6 +1144,11 @@ namespace Model
          */
         virtual Model::ListKeyPoliciesOutcomeCallable ListKeyPoliciesCallable(const Model::ListKeyPoliciesRequest& request) const;
 
+        /**
+         * Same as ListKeyPoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListKeyPoliciesOutcomeCallable ListKeyPoliciesCallable(Model::ListKeyPoliciesRequest&& request) const;
+
         /**
          * <p>Retrieves a list of policies attached to a key.</p>
          *
@@ -928,6 +1156,11 @@ namespace Model
          */
         virtual void ListKeyPoliciesAsync(const Model::ListKeyPoliciesRequest& request, const ListKeyPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListKeyPoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListKeyPoliciesAsync(Model::ListKeyPoliciesRequest&& request, const ListKeyPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the customer master keys.</p>
          */
@@ -940,6 +1173,11 @@ namespace Model
          */
         virtual Model::ListKeysOutcomeCallable ListKeysCallable(const Model::ListKeysRequest& request) const;
 
+        /**
+         * Same as ListKeysCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListKeysOutcomeCallable ListKeysCallable(Model::ListKeysRequest&& request) const;
+
         /**
          * <p>Lists the customer master keys.</p>
          *
@@ -947,6 +1185,11 @@ namespace Model
          */
         virtual void ListKeysAsync(const Model::ListKeysRequest& request, const ListKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListKeysAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListKeysAsync(Model::ListKeysRequest&& request, const ListKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of all grants for which the grant's
          * <code>RetiringPrincipal</code> matches the one specified.</p> <p>A typical use
@@ -965,6 +1208,11 @@ namespace Model
          */
         virtual Model::ListRetirableGrantsOutcomeCallable ListRetirableGrantsCallable(const Model::ListRetirableGrantsRequest& request) const;
 
+        /**
+         * Same as ListRetirableGrantsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListRetirableGrantsOutcomeCallable ListRetirableGrantsCallable(Model::ListRetirableGrantsRequest&& request) const;
+
         /**
          * <p>Returns a list of all grants for which the grant's
          * <code>RetiringPrincipal</code> matches the one specified.</p> <p>A typical use
@@ -975,6 +1223,11 @@ namespace Model
          */
         virtual void ListRetirableGrantsAsync(const Model::ListRetirableGrantsRequest& request, const ListRetirableGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRetirableGrantsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListRetirableGrantsAsync(Model::ListRetirableGrantsRequest&& request, const ListRetirableGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches a policy to the specified key.</p>
          */
@@ -987,6 +1240,11 @@ namespace Model
          */
         virtual Model::PutKeyPolicyOutcomeCallable PutKeyPolicyCallable(const Model::PutKeyPolicyRequest& request) const;
 
+        /**
+         * Same as PutKeyPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutKeyPolicyOutcomeCallable PutKeyPolicyCallable(Model::PutKeyPolicyRequest&& request) const;
+
         /**
          * <p>Attaches a policy to the specified key.</p>
          *
@@ -994,6 +1252,11 @@ namespace Model
          */
         virtual void PutKeyPolicyAsync(const Model::PutKeyPolicyRequest& request, const PutKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutKeyPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutKeyPolicyAsync(Model::PutKeyPolicyRequest&& request, const PutKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Encrypts data on the server side with a new customer master key without
          * exposing the plaintext of the data on the client side. The data is first
@@ -1026,6 +1289,11 @@ namespace Model
          */
         virtual Model::ReEncryptOutcomeCallable ReEncryptCallable(const Model::ReEncryptRequest& request) const;
 
+        /**
+         * Same as ReEncryptCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReEncryptOutcomeCallable ReEncryptCallable(Model::ReEncryptRequest&& request) const;
+
         /**
          * <p>Encrypts data on the server side with a new customer master key without
          * exposing the plaintext of the data on the client side. The data is first
@@ -1043,6 +1311,11 @@ namespace Model
          */
         virtual void ReEncryptAsync(const Model::ReEncryptRequest& request, const ReEncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReEncryptAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReEncryptAsync(Model::ReEncryptRequest&& request, const ReEncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retires a grant. You can retire a grant when you're done using it to clean
          * up. You should revoke a grant when you intend to actively deny operations that
@@ -1073,6 +1346,11 @@ namespace Model
          */
         virtual Model::RetireGrantOutcomeCallable RetireGrantCallable(const Model::RetireGrantRequest& request) const;
 
+        /**
+         * Same as RetireGrantCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RetireGrantOutcomeCallable RetireGrantCallable(Model::RetireGrantRequest&& request) const;
+
         /**
          * <p>Retires a grant. You can retire a grant when you're done using it to clean
          * up. You should revoke a grant when you intend to actively deny operations that
@@ -1089,6 +1367,11 @@ namespace Model
          */
         virtual void RetireGrantAsync(const Model::RetireGrantRequest& request, const RetireGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RetireGrantAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RetireGrantAsync(Model::RetireGrantRequest&& request, const RetireGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Revokes a grant. You can revoke a grant to actively deny operations that
          * depend on it.</p>
@@ -1103,6 +1386,11 @@ namespace Model
          */
         virtual Model::RevokeGrantOutcomeCallable RevokeGrantCallable(const Model::RevokeGrantRequest& request) const;
 
+        /**
+         * Same as RevokeGrantCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RevokeGrantOutcomeCallable RevokeGrantCallable(Model::RevokeGrantRequest&& request) const;
+
         /**
          * <p>Revokes a grant. You can revoke a grant to actively deny operations that
          * depend on it.</p>
@@ -1111,6 +1399,11 @@ namespace Model
          */
         virtual void RevokeGrantAsync(const Model::RevokeGrantRequest& request, const RevokeGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RevokeGrantAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RevokeGrantAsync(Model::RevokeGrantRequest&& request, const RevokeGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Schedules the deletion of a customer master key (CMK). You may provide a
          * waiting period, specified in days, before deletion occurs. If you do not provide
@@ -1151,6 +1444,11 @@ namespace Model
          */
         virtual Model::ScheduleKeyDeletionOutcomeCallable ScheduleKeyDeletionCallable(const Model::ScheduleKeyDeletionRequest& request) const;
 
+        /**
+         * Same as ScheduleKeyDeletionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ScheduleKeyDeletionOutcomeCallable ScheduleKeyDeletionCallable(Model::ScheduleKeyDeletionRequest&& request) const;
+
         /**
          * <p>Schedules the deletion of a customer master key (CMK). You may provide a
          * waiting period, specified in days, before deletion occurs. If you do not provide
@@ -1172,6 +1470,11 @@ namespace Model
          */
         virtual void ScheduleKeyDeletionAsync(const Model::ScheduleKeyDeletionRequest& request, const ScheduleKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ScheduleKeyDeletionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ScheduleKeyDeletionAsync(Model::ScheduleKeyDeletionRequest&& request, const ScheduleKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates an alias to map it to a different key.</p> <p>An alias is not a
          * property of a key. Therefore, an alias can be mapped to and unmapped from an
@@ -1198,6 +1501,11 @@ namespace Model
          */
         virtual Model::UpdateAliasOutcomeCallable UpdateAliasCallable(const Model::UpdateAliasRequest& request) const;
 
+        /**
+         * Same as UpdateAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateAliasOutcomeCallable UpdateAliasCallable(Model::UpdateAliasRequest&& request) const;
+
         /**
          * <p>Updates an alias to map it to a different key.</p> <p>An alias is not a
          * property of a key. Therefore, an alias can be mapped to and unmapped from an
@@ -1212,6 +1520,11 @@ namespace Model
          */
         virtual void UpdateAliasAsync(const Model::UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateAliasAsync(Model::UpdateAliasRequest&& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the description of a key.</p>
          */
@@ -1224,6 +1537,11 @@ namespace Model
          */
         virtual Model::UpdateKeyDescriptionOutcomeCallable UpdateKeyDescriptionCallable(const Model::UpdateKeyDescriptionRequest& request) const;
 
+        /**
+         * Same as UpdateKeyDescriptionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateKeyDescriptionOutcomeCallable UpdateKeyDescriptionCallable(Model::UpdateKeyDescriptionRequest&& request) const;
+
         /**
          * <p>Updates the description of a key.</p>
          *
@@ -1231,6 +1549,76 @@ namespace Model
          */
         virtual void UpdateKeyDescriptionAsync(const Model::UpdateKeyDescriptionRequest& request, const UpdateKeyDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateKeyDescriptionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateKeyDescriptionAsync(Model::UpdateKeyDescriptionRequest&& request, const UpdateKeyDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelKeyDeletionOutcome> CancelKeyDeletionAwaitable(const Model::CancelKeyDeletionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::CancelKeyDeletion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelKeyDeletionOutcome> CancelKeyDeletionAwaitable(Model::CancelKeyDeletionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::CancelKeyDeletion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAliasOutcome> CreateAliasAwaitable(const Model::CreateAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::CreateAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAliasOutcome> CreateAliasAwaitable(Model::CreateAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::CreateAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateGrantOutcome> CreateGrantAwaitable(const Model::CreateGrantRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::CreateGrant, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateGrantOutcome> CreateGrantAwaitable(Model::CreateGrantRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::CreateGrant, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateKeyOutcome> CreateKeyAwaitable(const Model::CreateKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::CreateKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateKeyOutcome> CreateKeyAwaitable(Model::CreateKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::CreateKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DecryptOutcome> DecryptAwaitable(const Model::DecryptRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::Decrypt, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DecryptOutcome> DecryptAwaitable(Model::DecryptRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::Decrypt, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAliasOutcome> DeleteAliasAwaitable(const Model::DeleteAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::DeleteAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAliasOutcome> DeleteAliasAwaitable(Model::DeleteAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::DeleteAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeKeyOutcome> DescribeKeyAwaitable(const Model::DescribeKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::DescribeKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeKeyOutcome> DescribeKeyAwaitable(Model::DescribeKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::DescribeKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableKeyOutcome> DisableKeyAwaitable(const Model::DisableKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::DisableKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableKeyOutcome> DisableKeyAwaitable(Model::DisableKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::DisableKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableKeyRotationOutcome> DisableKeyRotationAwaitable(const Model::DisableKeyRotationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::DisableKeyRotation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableKeyRotationOutcome> DisableKeyRotationAwaitable(Model::DisableKeyRotationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::DisableKeyRotation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableKeyOutcome> EnableKeyAwaitable(const Model::EnableKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::EnableKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableKeyOutcome> EnableKeyAwaitable(Model::EnableKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::EnableKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableKeyRotationOutcome> EnableKeyRotationAwaitable(const Model::EnableKeyRotationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::EnableKeyRotation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableKeyRotationOutcome> EnableKeyRotationAwaitable(Model::EnableKeyRotationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::EnableKeyRotation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EncryptOutcome> EncryptAwaitable(const Model::EncryptRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::Encrypt, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EncryptOutcome> EncryptAwaitable(Model::EncryptRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::Encrypt, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GenerateDataKeyOutcome> GenerateDataKeyAwaitable(const Model::GenerateDataKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::GenerateDataKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GenerateDataKeyOutcome> GenerateDataKeyAwaitable(Model::GenerateDataKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::GenerateDataKey, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GenerateDataKeyWithoutPlaintextOutcome> GenerateDataKeyWithoutPlaintextAwaitable(const Model::GenerateDataKeyWithoutPlaintextRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::GenerateDataKeyWithoutPlaintext, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GenerateDataKeyWithoutPlaintextOutcome> GenerateDataKeyWithoutPlaintextAwaitable(Model::GenerateDataKeyWithoutPlaintextRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::GenerateDataKeyWithoutPlaintext, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GenerateRandomOutcome> GenerateRandomAwaitable(const Model::GenerateRandomRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::GenerateRandom, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GenerateRandomOutcome> GenerateRandomAwaitable(Model::GenerateRandomRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::GenerateRandom, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetKeyPolicyOutcome> GetKeyPolicyAwaitable(const Model::GetKeyPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::GetKeyPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetKeyPolicyOutcome> GetKeyPolicyAwaitable(Model::GetKeyPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::GetKeyPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetKeyRotationStatusOutcome> GetKeyRotationStatusAwaitable(const Model::GetKeyRotationStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::GetKeyRotationStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetKeyRotationStatusOutcome> GetKeyRotationStatusAwaitable(Model::GetKeyRotationStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::GetKeyRotationStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAliasesOutcome> ListAliasesAwaitable(const Model::ListAliasesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::ListAliases, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAliasesOutcome> ListAliasesAwaitable(Model::ListAliasesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::ListAliases, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListGrantsOutcome> ListGrantsAwaitable(const Model::ListGrantsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::ListGrants, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListGrantsOutcome> ListGrantsAwaitable(Model::ListGrantsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::ListGrants, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListKeyPoliciesOutcome> ListKeyPoliciesAwaitable(const Model::ListKeyPoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::ListKeyPolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListKeyPoliciesOutcome> ListKeyPoliciesAwaitable(Model::ListKeyPoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::ListKeyPolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListKeysOutcome> ListKeysAwaitable(const Model::ListKeysRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::ListKeys, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListKeysOutcome> ListKeysAwaitable(Model::ListKeysRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::ListKeys, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRetirableGrantsOutcome> ListRetirableGrantsAwaitable(const Model::ListRetirableGrantsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::ListRetirableGrants, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRetirableGrantsOutcome> ListRetirableGrantsAwaitable(Model::ListRetirableGrantsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::ListRetirableGrants, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutKeyPolicyOutcome> PutKeyPolicyAwaitable(const Model::PutKeyPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::PutKeyPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutKeyPolicyOutcome> PutKeyPolicyAwaitable(Model::PutKeyPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::PutKeyPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReEncryptOutcome> ReEncryptAwaitable(const Model::ReEncryptRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::ReEncrypt, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReEncryptOutcome> ReEncryptAwaitable(Model::ReEncryptRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::ReEncrypt, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RetireGrantOutcome> RetireGrantAwaitable(const Model::RetireGrantRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::RetireGrant, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RetireGrantOutcome> RetireGrantAwaitable(Model::RetireGrantRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::RetireGrant, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RevokeGrantOutcome> RevokeGrantAwaitable(const Model::RevokeGrantRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::RevokeGrant, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RevokeGrantOutcome> RevokeGrantAwaitable(Model::RevokeGrantRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::RevokeGrant, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ScheduleKeyDeletionOutcome> ScheduleKeyDeletionAwaitable(const Model::ScheduleKeyDeletionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::ScheduleKeyDeletion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ScheduleKeyDeletionOutcome> ScheduleKeyDeletionAwaitable(Model::ScheduleKeyDeletionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::ScheduleKeyDeletion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAliasOutcome> UpdateAliasAwaitable(const Model::UpdateAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::UpdateAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAliasOutcome> UpdateAliasAwaitable(Model::UpdateAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::UpdateAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateKeyDescriptionOutcome> UpdateKeyDescriptionAwaitable(const Model::UpdateKeyDescriptionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::UpdateKeyDescription, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateKeyDescriptionOutcome> UpdateKeyDescriptionAwaitable(Model::UpdateKeyDescriptionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &KMSClient::UpdateKeyDescription, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
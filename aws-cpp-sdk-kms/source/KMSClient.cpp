@@ -136,12 +136,22 @@ CancelKeyDeletionOutcome KMSClient::CancelKeyDeletion(const CancelKeyDeletionReq
 
 CancelKeyDeletionOutcomeCallable KMSClient::CancelKeyDeletionCallable(const CancelKeyDeletionRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::CancelKeyDeletion, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::CancelKeyDeletion, Aws::Client::RejectedCallOutcome<CancelKeyDeletionOutcome>(), this, request);
+}
+
+CancelKeyDeletionOutcomeCallable KMSClient::CancelKeyDeletionCallable(CancelKeyDeletionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::CancelKeyDeletion, Aws::Client::RejectedCallOutcome<CancelKeyDeletionOutcome>(), this, std::move(request));
 }
 
 void KMSClient::CancelKeyDeletionAsync(const CancelKeyDeletionRequest& request, const CancelKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::CancelKeyDeletionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::CancelKeyDeletionAsyncHelper, Aws::Client::RejectedAsyncCall<CancelKeyDeletionOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::CancelKeyDeletionAsync(CancelKeyDeletionRequest&& request, const CancelKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::CancelKeyDeletionAsyncHelper, Aws::Client::RejectedAsyncCall<CancelKeyDeletionOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::CancelKeyDeletionAsyncHelper(const CancelKeyDeletionRequest& request, const CancelKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -167,12 +177,22 @@ CreateAliasOutcome KMSClient::CreateAlias(const CreateAliasRequest& request) con
 
 CreateAliasOutcomeCallable KMSClient::CreateAliasCallable(const CreateAliasRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::CreateAlias, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::CreateAlias, Aws::Client::RejectedCallOutcome<CreateAliasOutcome>(), this, request);
+}
+
+CreateAliasOutcomeCallable KMSClient::CreateAliasCallable(CreateAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::CreateAlias, Aws::Client::RejectedCallOutcome<CreateAliasOutcome>(), this, std::move(request));
 }
 
 void KMSClient::CreateAliasAsync(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::CreateAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::CreateAliasAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAliasOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::CreateAliasAsync(CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::CreateAliasAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::CreateAliasAsyncHelper(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -198,12 +218,22 @@ CreateGrantOutcome KMSClient::CreateGrant(const CreateGrantRequest& request) con
 
 CreateGrantOutcomeCallable KMSClient::CreateGrantCallable(const CreateGrantRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::CreateGrant, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::CreateGrant, Aws::Client::RejectedCallOutcome<CreateGrantOutcome>(), this, request);
+}
+
+CreateGrantOutcomeCallable KMSClient::CreateGrantCallable(CreateGrantRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::CreateGrant, Aws::Client::RejectedCallOutcome<CreateGrantOutcome>(), this, std::move(request));
 }
 
 void KMSClient::CreateGrantAsync(const CreateGrantRequest& request, const CreateGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::CreateGrantAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::CreateGrantAsyncHelper, Aws::Client::RejectedAsyncCall<CreateGrantOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::CreateGrantAsync(CreateGrantRequest&& request, const CreateGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::CreateGrantAsyncHelper, Aws::Client::RejectedAsyncCall<CreateGrantOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::CreateGrantAsyncHelper(const CreateGrantRequest& request, const CreateGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -229,12 +259,22 @@ CreateKeyOutcome KMSClient::CreateKey(const CreateKeyRequest& request) const
 
 CreateKeyOutcomeCallable KMSClient::CreateKeyCallable(const CreateKeyRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::CreateKey, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::CreateKey, Aws::Client::RejectedCallOutcome<CreateKeyOutcome>(), this, request);
+}
+
+CreateKeyOutcomeCallable KMSClient::CreateKeyCallable(CreateKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::CreateKey, Aws::Client::RejectedCallOutcome<CreateKeyOutcome>(), this, std::move(request));
 }
 
 void KMSClient::CreateKeyAsync(const CreateKeyRequest& request, const CreateKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::CreateKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::CreateKeyAsyncHelper, Aws::Client::RejectedAsyncCall<CreateKeyOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::CreateKeyAsync(CreateKeyRequest&& request, const CreateKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::CreateKeyAsyncHelper, Aws::Client::RejectedAsyncCall<CreateKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::CreateKeyAsyncHelper(const CreateKeyRequest& request, const CreateKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -260,12 +300,22 @@ DecryptOutcome KMSClient::Decrypt(const DecryptRequest& request) const
 
 DecryptOutcomeCallable KMSClient::DecryptCallable(const DecryptRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::Decrypt, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::Decrypt, Aws::Client::RejectedCallOutcome<DecryptOutcome>(), this, request);
+}
+
+DecryptOutcomeCallable KMSClient::DecryptCallable(DecryptRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::Decrypt, Aws::Client::RejectedCallOutcome<DecryptOutcome>(), this, std::move(request));
 }
 
 void KMSClient::DecryptAsync(const DecryptRequest& request, const DecryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::DecryptAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::DecryptAsyncHelper, Aws::Client::RejectedAsyncCall<DecryptOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::DecryptAsync(DecryptRequest&& request, const DecryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::DecryptAsyncHelper, Aws::Client::RejectedAsyncCall<DecryptOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::DecryptAsyncHelper(const DecryptRequest& request, const DecryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -291,12 +341,22 @@ DeleteAliasOutcome KMSClient::DeleteAlias(const DeleteAliasRequest& request) con
 
 DeleteAliasOutcomeCallable KMSClient::DeleteAliasCallable(const DeleteAliasRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::DeleteAlias, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::DeleteAlias, Aws::Client::RejectedCallOutcome<DeleteAliasOutcome>(), this, request);
+}
+
+DeleteAliasOutcomeCallable KMSClient::DeleteAliasCallable(DeleteAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::DeleteAlias, Aws::Client::RejectedCallOutcome<DeleteAliasOutcome>(), this, std::move(request));
 }
 
 void KMSClient::DeleteAliasAsync(const DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::DeleteAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::DeleteAliasAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAliasOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::DeleteAliasAsync(DeleteAliasRequest&& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::DeleteAliasAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::DeleteAliasAsyncHelper(const DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -322,12 +382,22 @@ DescribeKeyOutcome KMSClient::DescribeKey(const DescribeKeyRequest& request) con
 
 DescribeKeyOutcomeCallable KMSClient::DescribeKeyCallable(const DescribeKeyRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::DescribeKey, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::DescribeKey, Aws::Client::RejectedCallOutcome<DescribeKeyOutcome>(), this, request);
+}
+
+DescribeKeyOutcomeCallable KMSClient::DescribeKeyCallable(DescribeKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::DescribeKey, Aws::Client::RejectedCallOutcome<DescribeKeyOutcome>(), this, std::move(request));
 }
 
 void KMSClient::DescribeKeyAsync(const DescribeKeyRequest& request, const DescribeKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::DescribeKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::DescribeKeyAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeKeyOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::DescribeKeyAsync(DescribeKeyRequest&& request, const DescribeKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::DescribeKeyAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::DescribeKeyAsyncHelper(const DescribeKeyRequest& request, const DescribeKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -353,12 +423,22 @@ DisableKeyOutcome KMSClient::DisableKey(const DisableKeyRequest& request) const
 
 DisableKeyOutcomeCallable KMSClient::DisableKeyCallable(const DisableKeyRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::DisableKey, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::DisableKey, Aws::Client::RejectedCallOutcome<DisableKeyOutcome>(), this, request);
+}
+
+DisableKeyOutcomeCallable KMSClient::DisableKeyCallable(DisableKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::DisableKey, Aws::Client::RejectedCallOutcome<DisableKeyOutcome>(), this, std::move(request));
 }
 
 void KMSClient::DisableKeyAsync(const DisableKeyRequest& request, const DisableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::DisableKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::DisableKeyAsyncHelper, Aws::Client::RejectedAsyncCall<DisableKeyOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::DisableKeyAsync(DisableKeyRequest&& request, const DisableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::DisableKeyAsyncHelper, Aws::Client::RejectedAsyncCall<DisableKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::DisableKeyAsyncHelper(const DisableKeyRequest& request, const DisableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -384,12 +464,22 @@ DisableKeyRotationOutcome KMSClient::DisableKeyRotation(const DisableKeyRotation
 
 DisableKeyRotationOutcomeCallable KMSClient::DisableKeyRotationCallable(const DisableKeyRotationRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::DisableKeyRotation, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::DisableKeyRotation, Aws::Client::RejectedCallOutcome<DisableKeyRotationOutcome>(), this, request);
+}
+
+DisableKeyRotationOutcomeCallable KMSClient::DisableKeyRotationCallable(DisableKeyRotationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::DisableKeyRotation, Aws::Client::RejectedCallOutcome<DisableKeyRotationOutcome>(), this, std::move(request));
 }
 
 void KMSClient::DisableKeyRotationAsync(const DisableKeyRotationRequest& request, const DisableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::DisableKeyRotationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::DisableKeyRotationAsyncHelper, Aws::Client::RejectedAsyncCall<DisableKeyRotationOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::DisableKeyRotationAsync(DisableKeyRotationRequest&& request, const DisableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::DisableKeyRotationAsyncHelper, Aws::Client::RejectedAsyncCall<DisableKeyRotationOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::DisableKeyRotationAsyncHelper(const DisableKeyRotationRequest& request, const DisableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -415,12 +505,22 @@ EnableKeyOutcome KMSClient::EnableKey(const EnableKeyRequest& request) const
 
 EnableKeyOutcomeCallable KMSClient::EnableKeyCallable(const EnableKeyRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::EnableKey, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::EnableKey, Aws::Client::RejectedCallOutcome<EnableKeyOutcome>(), this, request);
+}
+
+EnableKeyOutcomeCallable KMSClient::EnableKeyCallable(EnableKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::EnableKey, Aws::Client::RejectedCallOutcome<EnableKeyOutcome>(), this, std::move(request));
 }
 
 void KMSClient::EnableKeyAsync(const EnableKeyRequest& request, const EnableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::EnableKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::EnableKeyAsyncHelper, Aws::Client::RejectedAsyncCall<EnableKeyOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::EnableKeyAsync(EnableKeyRequest&& request, const EnableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::EnableKeyAsyncHelper, Aws::Client::RejectedAsyncCall<EnableKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::EnableKeyAsyncHelper(const EnableKeyRequest& request, const EnableKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -446,12 +546,22 @@ EnableKeyRotationOutcome KMSClient::EnableKeyRotation(const EnableKeyRotationReq
 
 EnableKeyRotationOutcomeCallable KMSClient::EnableKeyRotationCallable(const EnableKeyRotationRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::EnableKeyRotation, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::EnableKeyRotation, Aws::Client::RejectedCallOutcome<EnableKeyRotationOutcome>(), this, request);
+}
+
+EnableKeyRotationOutcomeCallable KMSClient::EnableKeyRotationCallable(EnableKeyRotationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::EnableKeyRotation, Aws::Client::RejectedCallOutcome<EnableKeyRotationOutcome>(), this, std::move(request));
 }
 
 void KMSClient::EnableKeyRotationAsync(const EnableKeyRotationRequest& request, const EnableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::EnableKeyRotationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::EnableKeyRotationAsyncHelper, Aws::Client::RejectedAsyncCall<EnableKeyRotationOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::EnableKeyRotationAsync(EnableKeyRotationRequest&& request, const EnableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::EnableKeyRotationAsyncHelper, Aws::Client::RejectedAsyncCall<EnableKeyRotationOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::EnableKeyRotationAsyncHelper(const EnableKeyRotationRequest& request, const EnableKeyRotationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -477,12 +587,22 @@ EncryptOutcome KMSClient::Encrypt(const EncryptRequest& request) const
 
 EncryptOutcomeCallable KMSClient::EncryptCallable(const EncryptRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::Encrypt, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::Encrypt, Aws::Client::RejectedCallOutcome<EncryptOutcome>(), this, request);
+}
+
+EncryptOutcomeCallable KMSClient::EncryptCallable(EncryptRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::Encrypt, Aws::Client::RejectedCallOutcome<EncryptOutcome>(), this, std::move(request));
 }
 
 void KMSClient::EncryptAsync(const EncryptRequest& request, const EncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::EncryptAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::EncryptAsyncHelper, Aws::Client::RejectedAsyncCall<EncryptOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::EncryptAsync(EncryptRequest&& request, const EncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::EncryptAsyncHelper, Aws::Client::RejectedAsyncCall<EncryptOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::EncryptAsyncHelper(const EncryptRequest& request, const EncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -508,12 +628,22 @@ GenerateDataKeyOutcome KMSClient::GenerateDataKey(const GenerateDataKeyRequest&
 
 GenerateDataKeyOutcomeCallable KMSClient::GenerateDataKeyCallable(const GenerateDataKeyRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::GenerateDataKey, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::GenerateDataKey, Aws::Client::RejectedCallOutcome<GenerateDataKeyOutcome>(), this, request);
+}
+
+GenerateDataKeyOutcomeCallable KMSClient::GenerateDataKeyCallable(GenerateDataKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::GenerateDataKey, Aws::Client::RejectedCallOutcome<GenerateDataKeyOutcome>(), this, std::move(request));
 }
 
 void KMSClient::GenerateDataKeyAsync(const GenerateDataKeyRequest& request, const GenerateDataKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::GenerateDataKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::GenerateDataKeyAsyncHelper, Aws::Client::RejectedAsyncCall<GenerateDataKeyOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::GenerateDataKeyAsync(GenerateDataKeyRequest&& request, const GenerateDataKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::GenerateDataKeyAsyncHelper, Aws::Client::RejectedAsyncCall<GenerateDataKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::GenerateDataKeyAsyncHelper(const GenerateDataKeyRequest& request, const GenerateDataKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -539,12 +669,22 @@ GenerateDataKeyWithoutPlaintextOutcome KMSClient::GenerateDataKeyWithoutPlaintex
 
 GenerateDataKeyWithoutPlaintextOutcomeCallable KMSClient::GenerateDataKeyWithoutPlaintextCallable(const GenerateDataKeyWithoutPlaintextRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::GenerateDataKeyWithoutPlaintext, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::GenerateDataKeyWithoutPlaintext, Aws::Client::RejectedCallOutcome<GenerateDataKeyWithoutPlaintextOutcome>(), this, request);
+}
+
+GenerateDataKeyWithoutPlaintextOutcomeCallable KMSClient::GenerateDataKeyWithoutPlaintextCallable(GenerateDataKeyWithoutPlaintextRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::GenerateDataKeyWithoutPlaintext, Aws::Client::RejectedCallOutcome<GenerateDataKeyWithoutPlaintextOutcome>(), this, std::move(request));
 }
 
 void KMSClient::GenerateDataKeyWithoutPlaintextAsync(const GenerateDataKeyWithoutPlaintextRequest& request, const GenerateDataKeyWithoutPlaintextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::GenerateDataKeyWithoutPlaintextAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::GenerateDataKeyWithoutPlaintextAsyncHelper, Aws::Client::RejectedAsyncCall<GenerateDataKeyWithoutPlaintextOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::GenerateDataKeyWithoutPlaintextAsync(GenerateDataKeyWithoutPlaintextRequest&& request, const GenerateDataKeyWithoutPlaintextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::GenerateDataKeyWithoutPlaintextAsyncHelper, Aws::Client::RejectedAsyncCall<GenerateDataKeyWithoutPlaintextOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::GenerateDataKeyWithoutPlaintextAsyncHelper(const GenerateDataKeyWithoutPlaintextRequest& request, const GenerateDataKeyWithoutPlaintextResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -570,12 +710,22 @@ GenerateRandomOutcome KMSClient::GenerateRandom(const GenerateRandomRequest& req
 
 GenerateRandomOutcomeCallable KMSClient::GenerateRandomCallable(const GenerateRandomRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::GenerateRandom, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::GenerateRandom, Aws::Client::RejectedCallOutcome<GenerateRandomOutcome>(), this, request);
+}
+
+GenerateRandomOutcomeCallable KMSClient::GenerateRandomCallable(GenerateRandomRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::GenerateRandom, Aws::Client::RejectedCallOutcome<GenerateRandomOutcome>(), this, std::move(request));
 }
 
 void KMSClient::GenerateRandomAsync(const GenerateRandomRequest& request, const GenerateRandomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::GenerateRandomAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::GenerateRandomAsyncHelper, Aws::Client::RejectedAsyncCall<GenerateRandomOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::GenerateRandomAsync(GenerateRandomRequest&& request, const GenerateRandomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::GenerateRandomAsyncHelper, Aws::Client::RejectedAsyncCall<GenerateRandomOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::GenerateRandomAsyncHelper(const GenerateRandomRequest& request, const GenerateRandomResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -601,12 +751,22 @@ GetKeyPolicyOutcome KMSClient::GetKeyPolicy(const GetKeyPolicyRequest& request)
 
 GetKeyPolicyOutcomeCallable KMSClient::GetKeyPolicyCallable(const GetKeyPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::GetKeyPolicy, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::GetKeyPolicy, Aws::Client::RejectedCallOutcome<GetKeyPolicyOutcome>(), this, request);
+}
+
+GetKeyPolicyOutcomeCallable KMSClient::GetKeyPolicyCallable(GetKeyPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::GetKeyPolicy, Aws::Client::RejectedCallOutcome<GetKeyPolicyOutcome>(), this, std::move(request));
 }
 
 void KMSClient::GetKeyPolicyAsync(const GetKeyPolicyRequest& request, const GetKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::GetKeyPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::GetKeyPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetKeyPolicyOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::GetKeyPolicyAsync(GetKeyPolicyRequest&& request, const GetKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::GetKeyPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetKeyPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::GetKeyPolicyAsyncHelper(const GetKeyPolicyRequest& request, const GetKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -632,12 +792,22 @@ GetKeyRotationStatusOutcome KMSClient::GetKeyRotationStatus(const GetKeyRotation
 
 GetKeyRotationStatusOutcomeCallable KMSClient::GetKeyRotationStatusCallable(const GetKeyRotationStatusRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::GetKeyRotationStatus, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::GetKeyRotationStatus, Aws::Client::RejectedCallOutcome<GetKeyRotationStatusOutcome>(), this, request);
+}
+
+GetKeyRotationStatusOutcomeCallable KMSClient::GetKeyRotationStatusCallable(GetKeyRotationStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::GetKeyRotationStatus, Aws::Client::RejectedCallOutcome<GetKeyRotationStatusOutcome>(), this, std::move(request));
 }
 
 void KMSClient::GetKeyRotationStatusAsync(const GetKeyRotationStatusRequest& request, const GetKeyRotationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::GetKeyRotationStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::GetKeyRotationStatusAsyncHelper, Aws::Client::RejectedAsyncCall<GetKeyRotationStatusOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::GetKeyRotationStatusAsync(GetKeyRotationStatusRequest&& request, const GetKeyRotationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::GetKeyRotationStatusAsyncHelper, Aws::Client::RejectedAsyncCall<GetKeyRotationStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::GetKeyRotationStatusAsyncHelper(const GetKeyRotationStatusRequest& request, const GetKeyRotationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -663,12 +833,22 @@ ListAliasesOutcome KMSClient::ListAliases(const ListAliasesRequest& request) con
 
 ListAliasesOutcomeCallable KMSClient::ListAliasesCallable(const ListAliasesRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::ListAliases, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::ListAliases, Aws::Client::RejectedCallOutcome<ListAliasesOutcome>(), this, request);
+}
+
+ListAliasesOutcomeCallable KMSClient::ListAliasesCallable(ListAliasesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::ListAliases, Aws::Client::RejectedCallOutcome<ListAliasesOutcome>(), this, std::move(request));
 }
 
 void KMSClient::ListAliasesAsync(const ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::ListAliasesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::ListAliasesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAliasesOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::ListAliasesAsync(ListAliasesRequest&& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::ListAliasesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAliasesOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::ListAliasesAsyncHelper(const ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -694,12 +874,22 @@ ListGrantsOutcome KMSClient::ListGrants(const ListGrantsRequest& request) const
 
 ListGrantsOutcomeCallable KMSClient::ListGrantsCallable(const ListGrantsRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::ListGrants, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::ListGrants, Aws::Client::RejectedCallOutcome<ListGrantsOutcome>(), this, request);
+}
+
+ListGrantsOutcomeCallable KMSClient::ListGrantsCallable(ListGrantsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::ListGrants, Aws::Client::RejectedCallOutcome<ListGrantsOutcome>(), this, std::move(request));
 }
 
 void KMSClient::ListGrantsAsync(const ListGrantsRequest& request, const ListGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::ListGrantsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::ListGrantsAsyncHelper, Aws::Client::RejectedAsyncCall<ListGrantsOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::ListGrantsAsync(ListGrantsRequest&& request, const ListGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::ListGrantsAsyncHelper, Aws::Client::RejectedAsyncCall<ListGrantsOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::ListGrantsAsyncHelper(const ListGrantsRequest& request, const ListGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -725,12 +915,22 @@ ListKeyPoliciesOutcome KMSClient::ListKeyPolicies(const ListKeyPoliciesRequest&
 
 ListKeyPoliciesOutcomeCallable KMSClient::ListKeyPoliciesCallable(const ListKeyPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::ListKeyPolicies, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::ListKeyPolicies, Aws::Client::RejectedCallOutcome<ListKeyPoliciesOutcome>(), this, request);
+}
+
+ListKeyPoliciesOutcomeCallable KMSClient::ListKeyPoliciesCallable(ListKeyPoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::ListKeyPolicies, Aws::Client::RejectedCallOutcome<ListKeyPoliciesOutcome>(), this, std::move(request));
 }
 
 void KMSClient::ListKeyPoliciesAsync(const ListKeyPoliciesRequest& request, const ListKeyPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::ListKeyPoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::ListKeyPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListKeyPoliciesOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::ListKeyPoliciesAsync(ListKeyPoliciesRequest&& request, const ListKeyPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::ListKeyPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListKeyPoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::ListKeyPoliciesAsyncHelper(const ListKeyPoliciesRequest& request, const ListKeyPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -756,12 +956,22 @@ ListKeysOutcome KMSClient::ListKeys(const ListKeysRequest& request) const
 
 ListKeysOutcomeCallable KMSClient::ListKeysCallable(const ListKeysRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::ListKeys, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::ListKeys, Aws::Client::RejectedCallOutcome<ListKeysOutcome>(), this, request);
+}
+
+ListKeysOutcomeCallable KMSClient::ListKeysCallable(ListKeysRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::ListKeys, Aws::Client::RejectedCallOutcome<ListKeysOutcome>(), this, std::move(request));
 }
 
 void KMSClient::ListKeysAsync(const ListKeysRequest& request, const ListKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::ListKeysAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::ListKeysAsyncHelper, Aws::Client::RejectedAsyncCall<ListKeysOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::ListKeysAsync(ListKeysRequest&& request, const ListKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::ListKeysAsyncHelper, Aws::Client::RejectedAsyncCall<ListKeysOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::ListKeysAsyncHelper(const ListKeysRequest& request, const ListKeysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -787,12 +997,22 @@ ListRetirableGrantsOutcome KMSClient::ListRetirableGrants(const ListRetirableGra
 
 ListRetirableGrantsOutcomeCallable KMSClient::ListRetirableGrantsCallable(const ListRetirableGrantsRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::ListRetirableGrants, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::ListRetirableGrants, Aws::Client::RejectedCallOutcome<ListRetirableGrantsOutcome>(), this, request);
+}
+
+ListRetirableGrantsOutcomeCallable KMSClient::ListRetirableGrantsCallable(ListRetirableGrantsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::ListRetirableGrants, Aws::Client::RejectedCallOutcome<ListRetirableGrantsOutcome>(), this, std::move(request));
 }
 
 void KMSClient::ListRetirableGrantsAsync(const ListRetirableGrantsRequest& request, const ListRetirableGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::ListRetirableGrantsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::ListRetirableGrantsAsyncHelper, Aws::Client::RejectedAsyncCall<ListRetirableGrantsOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::ListRetirableGrantsAsync(ListRetirableGrantsRequest&& request, const ListRetirableGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::ListRetirableGrantsAsyncHelper, Aws::Client::RejectedAsyncCall<ListRetirableGrantsOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::ListRetirableGrantsAsyncHelper(const ListRetirableGrantsRequest& request, const ListRetirableGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -818,12 +1038,22 @@ PutKeyPolicyOutcome KMSClient::PutKeyPolicy(const PutKeyPolicyRequest& request)
 
 PutKeyPolicyOutcomeCallable KMSClient::PutKeyPolicyCallable(const PutKeyPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::PutKeyPolicy, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::PutKeyPolicy, Aws::Client::RejectedCallOutcome<PutKeyPolicyOutcome>(), this, request);
+}
+
+PutKeyPolicyOutcomeCallable KMSClient::PutKeyPolicyCallable(PutKeyPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::PutKeyPolicy, Aws::Client::RejectedCallOutcome<PutKeyPolicyOutcome>(), this, std::move(request));
 }
 
 void KMSClient::PutKeyPolicyAsync(const PutKeyPolicyRequest& request, const PutKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::PutKeyPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::PutKeyPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutKeyPolicyOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::PutKeyPolicyAsync(PutKeyPolicyRequest&& request, const PutKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::PutKeyPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutKeyPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::PutKeyPolicyAsyncHelper(const PutKeyPolicyRequest& request, const PutKeyPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -849,12 +1079,22 @@ ReEncryptOutcome KMSClient::ReEncrypt(const ReEncryptRequest& request) const
 
 ReEncryptOutcomeCallable KMSClient::ReEncryptCallable(const ReEncryptRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::ReEncrypt, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::ReEncrypt, Aws::Client::RejectedCallOutcome<ReEncryptOutcome>(), this, request);
+}
+
+ReEncryptOutcomeCallable KMSClient::ReEncryptCallable(ReEncryptRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::ReEncrypt, Aws::Client::RejectedCallOutcome<ReEncryptOutcome>(), this, std::move(request));
 }
 
 void KMSClient::ReEncryptAsync(const ReEncryptRequest& request, const ReEncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::ReEncryptAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::ReEncryptAsyncHelper, Aws::Client::RejectedAsyncCall<ReEncryptOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::ReEncryptAsync(ReEncryptRequest&& request, const ReEncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::ReEncryptAsyncHelper, Aws::Client::RejectedAsyncCall<ReEncryptOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::ReEncryptAsyncHelper(const ReEncryptRequest& request, const ReEncryptResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -880,12 +1120,22 @@ RetireGrantOutcome KMSClient::RetireGrant(const RetireGrantRequest& request) con
 
 RetireGrantOutcomeCallable KMSClient::RetireGrantCallable(const RetireGrantRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::RetireGrant, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::RetireGrant, Aws::Client::RejectedCallOutcome<RetireGrantOutcome>(), this, request);
+}
+
+RetireGrantOutcomeCallable KMSClient::RetireGrantCallable(RetireGrantRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::RetireGrant, Aws::Client::RejectedCallOutcome<RetireGrantOutcome>(), this, std::move(request));
 }
 
 void KMSClient::RetireGrantAsync(const RetireGrantRequest& request, const RetireGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::RetireGrantAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::RetireGrantAsyncHelper, Aws::Client::RejectedAsyncCall<RetireGrantOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::RetireGrantAsync(RetireGrantRequest&& request, const RetireGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::RetireGrantAsyncHelper, Aws::Client::RejectedAsyncCall<RetireGrantOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::RetireGrantAsyncHelper(const RetireGrantRequest& request, const RetireGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -911,12 +1161,22 @@ RevokeGrantOutcome KMSClient::RevokeGrant(const RevokeGrantRequest& request) con
 
 RevokeGrantOutcomeCallable KMSClient::RevokeGrantCallable(const RevokeGrantRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::RevokeGrant, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::RevokeGrant, Aws::Client::RejectedCallOutcome<RevokeGrantOutcome>(), this, request);
+}
+
+RevokeGrantOutcomeCallable KMSClient::RevokeGrantCallable(RevokeGrantRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::RevokeGrant, Aws::Client::RejectedCallOutcome<RevokeGrantOutcome>(), this, std::move(request));
 }
 
 void KMSClient::RevokeGrantAsync(const RevokeGrantRequest& request, const RevokeGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::RevokeGrantAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::RevokeGrantAsyncHelper, Aws::Client::RejectedAsyncCall<RevokeGrantOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::RevokeGrantAsync(RevokeGrantRequest&& request, const RevokeGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::RevokeGrantAsyncHelper, Aws::Client::RejectedAsyncCall<RevokeGrantOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::RevokeGrantAsyncHelper(const RevokeGrantRequest& request, const RevokeGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -942,12 +1202,22 @@ ScheduleKeyDeletionOutcome KMSClient::ScheduleKeyDeletion(const ScheduleKeyDelet
 
 ScheduleKeyDeletionOutcomeCallable KMSClient::ScheduleKeyDeletionCallable(const ScheduleKeyDeletionRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::ScheduleKeyDeletion, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::ScheduleKeyDeletion, Aws::Client::RejectedCallOutcome<ScheduleKeyDeletionOutcome>(), this, request);
+}
+
+ScheduleKeyDeletionOutcomeCallable KMSClient::ScheduleKeyDeletionCallable(ScheduleKeyDeletionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::ScheduleKeyDeletion, Aws::Client::RejectedCallOutcome<ScheduleKeyDeletionOutcome>(), this, std::move(request));
 }
 
 void KMSClient::ScheduleKeyDeletionAsync(const ScheduleKeyDeletionRequest& request, const ScheduleKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::ScheduleKeyDeletionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::ScheduleKeyDeletionAsyncHelper, Aws::Client::RejectedAsyncCall<ScheduleKeyDeletionOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::ScheduleKeyDeletionAsync(ScheduleKeyDeletionRequest&& request, const ScheduleKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::ScheduleKeyDeletionAsyncHelper, Aws::Client::RejectedAsyncCall<ScheduleKeyDeletionOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::ScheduleKeyDeletionAsyncHelper(const ScheduleKeyDeletionRequest& request, const ScheduleKeyDeletionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -973,12 +1243,22 @@ UpdateAliasOutcome KMSClient::UpdateAlias(const UpdateAliasRequest& request) con
 
 UpdateAliasOutcomeCallable KMSClient::UpdateAliasCallable(const UpdateAliasRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::UpdateAlias, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::UpdateAlias, Aws::Client::RejectedCallOutcome<UpdateAliasOutcome>(), this, request);
+}
+
+UpdateAliasOutcomeCallable KMSClient::UpdateAliasCallable(UpdateAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::UpdateAlias, Aws::Client::RejectedCallOutcome<UpdateAliasOutcome>(), this, std::move(request));
 }
 
 void KMSClient::UpdateAliasAsync(const UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::UpdateAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::UpdateAliasAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAliasOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::UpdateAliasAsync(UpdateAliasRequest&& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::UpdateAliasAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::UpdateAliasAsyncHelper(const UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1004,12 +1284,22 @@ UpdateKeyDescriptionOutcome KMSClient::UpdateKeyDescription(const UpdateKeyDescr
 
 UpdateKeyDescriptionOutcomeCallable KMSClient::UpdateKeyDescriptionCallable(const UpdateKeyDescriptionRequest& request) const
 {
-  return std::async(std::launch::async, &KMSClient::UpdateKeyDescription, this, request);
+  return m_executor->SubmitWithFuture(&KMSClient::UpdateKeyDescription, Aws::Client::RejectedCallOutcome<UpdateKeyDescriptionOutcome>(), this, request);
+}
+
+UpdateKeyDescriptionOutcomeCallable KMSClient::UpdateKeyDescriptionCallable(UpdateKeyDescriptionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&KMSClient::UpdateKeyDescription, Aws::Client::RejectedCallOutcome<UpdateKeyDescriptionOutcome>(), this, std::move(request));
 }
 
 void KMSClient::UpdateKeyDescriptionAsync(const UpdateKeyDescriptionRequest& request, const UpdateKeyDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&KMSClient::UpdateKeyDescriptionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&KMSClient::UpdateKeyDescriptionAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateKeyDescriptionOutcome>(), this, request, handler, context);
+}
+
+void KMSClient::UpdateKeyDescriptionAsync(UpdateKeyDescriptionRequest&& request, const UpdateKeyDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&KMSClient::UpdateKeyDescriptionAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateKeyDescriptionOutcome>(), this, std::move(request), handler, context);
 }
 
 void KMSClient::UpdateKeyDescriptionAsyncHelper(const UpdateKeyDescriptionRequest& request, const UpdateKeyDescriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
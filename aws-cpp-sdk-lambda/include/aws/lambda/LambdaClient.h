@@ -43,6 +43,33 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/lambda/model/AddPermissionRequest.h>
+#include <aws/lambda/model/CreateAliasRequest.h>
+#include <aws/lambda/model/CreateEventSourceMappingRequest.h>
+#include <aws/lambda/model/CreateFunctionRequest.h>
+#include <aws/lambda/model/DeleteAliasRequest.h>
+#include <aws/lambda/model/DeleteEventSourceMappingRequest.h>
+#include <aws/lambda/model/DeleteFunctionRequest.h>
+#include <aws/lambda/model/GetAliasRequest.h>
+#include <aws/lambda/model/GetEventSourceMappingRequest.h>
+#include <aws/lambda/model/GetFunctionRequest.h>
+#include <aws/lambda/model/GetFunctionConfigurationRequest.h>
+#include <aws/lambda/model/GetPolicyRequest.h>
+#include <aws/lambda/model/InvokeRequest.h>
+#include <aws/lambda/model/ListAliasesRequest.h>
+#include <aws/lambda/model/ListEventSourceMappingsRequest.h>
+#include <aws/lambda/model/ListFunctionsRequest.h>
+#include <aws/lambda/model/ListVersionsByFunctionRequest.h>
+#include <aws/lambda/model/PublishVersionRequest.h>
+#include <aws/lambda/model/RemovePermissionRequest.h>
+#include <aws/lambda/model/UpdateAliasRequest.h>
+#include <aws/lambda/model/UpdateEventSourceMappingRequest.h>
+#include <aws/lambda/model/UpdateFunctionCodeRequest.h>
+#include <aws/lambda/model/UpdateFunctionConfigurationRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -259,6 +286,11 @@ namespace Model
          */
         virtual Model::AddPermissionOutcomeCallable AddPermissionCallable(const Model::AddPermissionRequest& request) const;
 
+        /**
+         * Same as AddPermissionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddPermissionOutcomeCallable AddPermissionCallable(Model::AddPermissionRequest&& request) const;
+
         /**
          * <p>Adds a permission to the resource policy associated with the specified AWS
          * Lambda function. You use resource policies to grant permissions to event sources
@@ -279,6 +311,11 @@ namespace Model
          */
         virtual void AddPermissionAsync(const Model::AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddPermissionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddPermissionAsync(Model::AddPermissionRequest&& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an alias that points to the specified Lambda function version. For
          * more information, see <a
@@ -299,6 +336,11 @@ namespace Model
          */
         virtual Model::CreateAliasOutcomeCallable CreateAliasCallable(const Model::CreateAliasRequest& request) const;
 
+        /**
+         * Same as CreateAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateAliasOutcomeCallable CreateAliasCallable(Model::CreateAliasRequest&& request) const;
+
         /**
          * <p>Creates an alias that points to the specified Lambda function version. For
          * more information, see <a
@@ -310,6 +352,11 @@ namespace Model
          */
         virtual void CreateAliasAsync(const Model::CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateAliasAsync(Model::CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Identifies a stream as an event source for a Lambda function. It can be
          * either an Amazon Kinesis stream or an Amazon DynamoDB stream. AWS Lambda invokes
@@ -358,6 +405,11 @@ namespace Model
          */
         virtual Model::CreateEventSourceMappingOutcomeCallable CreateEventSourceMappingCallable(const Model::CreateEventSourceMappingRequest& request) const;
 
+        /**
+         * Same as CreateEventSourceMappingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateEventSourceMappingOutcomeCallable CreateEventSourceMappingCallable(Model::CreateEventSourceMappingRequest&& request) const;
+
         /**
          * <p>Identifies a stream as an event source for a Lambda function. It can be
          * either an Amazon Kinesis stream or an Amazon DynamoDB stream. AWS Lambda invokes
@@ -383,6 +435,11 @@ namespace Model
          */
         virtual void CreateEventSourceMappingAsync(const Model::CreateEventSourceMappingRequest& request, const CreateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateEventSourceMappingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateEventSourceMappingAsync(Model::CreateEventSourceMappingRequest&& request, const CreateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new Lambda function. The function metadata is created from the
          * request parameters, and the code for the function is provided by a .zip file in
@@ -413,6 +470,11 @@ namespace Model
          */
         virtual Model::CreateFunctionOutcomeCallable CreateFunctionCallable(const Model::CreateFunctionRequest& request) const;
 
+        /**
+         * Same as CreateFunctionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateFunctionOutcomeCallable CreateFunctionCallable(Model::CreateFunctionRequest&& request) const;
+
         /**
          * <p>Creates a new Lambda function. The function metadata is created from the
          * request parameters, and the code for the function is provided by a .zip file in
@@ -429,6 +491,11 @@ namespace Model
          */
         virtual void CreateFunctionAsync(const Model::CreateFunctionRequest& request, const CreateFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateFunctionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateFunctionAsync(Model::CreateFunctionRequest&& request, const CreateFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified Lambda function alias. For more information, see <a
          * href="http://docs.aws.amazon.com/lambda/latest/dg/aliases-intro.html">Introduction
@@ -447,6 +514,11 @@ namespace Model
          */
         virtual Model::DeleteAliasOutcomeCallable DeleteAliasCallable(const Model::DeleteAliasRequest& request) const;
 
+        /**
+         * Same as DeleteAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteAliasOutcomeCallable DeleteAliasCallable(Model::DeleteAliasRequest&& request) const;
+
         /**
          * <p>Deletes the specified Lambda function alias. For more information, see <a
          * href="http://docs.aws.amazon.com/lambda/latest/dg/aliases-intro.html">Introduction
@@ -457,6 +529,11 @@ namespace Model
          */
         virtual void DeleteAliasAsync(const Model::DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteAliasAsync(Model::DeleteAliasRequest&& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes an event source mapping. This means AWS Lambda will no longer invoke
          * the function for events in the associated source.</p> <p>This operation requires
@@ -473,6 +550,11 @@ namespace Model
          */
         virtual Model::DeleteEventSourceMappingOutcomeCallable DeleteEventSourceMappingCallable(const Model::DeleteEventSourceMappingRequest& request) const;
 
+        /**
+         * Same as DeleteEventSourceMappingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteEventSourceMappingOutcomeCallable DeleteEventSourceMappingCallable(Model::DeleteEventSourceMappingRequest&& request) const;
+
         /**
          * <p>Removes an event source mapping. This means AWS Lambda will no longer invoke
          * the function for events in the associated source.</p> <p>This operation requires
@@ -482,6 +564,11 @@ namespace Model
          */
         virtual void DeleteEventSourceMappingAsync(const Model::DeleteEventSourceMappingRequest& request, const DeleteEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteEventSourceMappingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteEventSourceMappingAsync(Model::DeleteEventSourceMappingRequest&& request, const DeleteEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified Lambda function code and configuration.</p> <p>If you
          * are using the versioning feature and you don't specify a function version in
@@ -516,6 +603,11 @@ namespace Model
          */
         virtual Model::DeleteFunctionOutcomeCallable DeleteFunctionCallable(const Model::DeleteFunctionRequest& request) const;
 
+        /**
+         * Same as DeleteFunctionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteFunctionOutcomeCallable DeleteFunctionCallable(Model::DeleteFunctionRequest&& request) const;
+
         /**
          * <p>Deletes the specified Lambda function code and configuration.</p> <p>If you
          * are using the versioning feature and you don't specify a function version in
@@ -534,6 +626,11 @@ namespace Model
          */
         virtual void DeleteFunctionAsync(const Model::DeleteFunctionRequest& request, const DeleteFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteFunctionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteFunctionAsync(Model::DeleteFunctionRequest&& request, const DeleteFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the specified alias information such as the alias ARN, description,
          * and function version it is pointing to. For more information, see <a
@@ -554,6 +651,11 @@ namespace Model
          */
         virtual Model::GetAliasOutcomeCallable GetAliasCallable(const Model::GetAliasRequest& request) const;
 
+        /**
+         * Same as GetAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetAliasOutcomeCallable GetAliasCallable(Model::GetAliasRequest&& request) const;
+
         /**
          * <p>Returns the specified alias information such as the alias ARN, description,
          * and function version it is pointing to. For more information, see <a
@@ -565,6 +667,11 @@ namespace Model
          */
         virtual void GetAliasAsync(const Model::GetAliasRequest& request, const GetAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetAliasAsync(Model::GetAliasRequest&& request, const GetAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns configuration information for the specified event source mapping (see
          * <a>CreateEventSourceMapping</a>).</p> <p>This operation requires permission for
@@ -581,6 +688,11 @@ namespace Model
          */
         virtual Model::GetEventSourceMappingOutcomeCallable GetEventSourceMappingCallable(const Model::GetEventSourceMappingRequest& request) const;
 
+        /**
+         * Same as GetEventSourceMappingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetEventSourceMappingOutcomeCallable GetEventSourceMappingCallable(Model::GetEventSourceMappingRequest&& request) const;
+
         /**
          * <p>Returns configuration information for the specified event source mapping (see
          * <a>CreateEventSourceMapping</a>).</p> <p>This operation requires permission for
@@ -590,6 +702,11 @@ namespace Model
          */
         virtual void GetEventSourceMappingAsync(const Model::GetEventSourceMappingRequest& request, const GetEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetEventSourceMappingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetEventSourceMappingAsync(Model::GetEventSourceMappingRequest&& request, const GetEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the configuration information of the Lambda function and a presigned
          * URL link to the .zip file you uploaded with <a>CreateFunction</a> so you can
@@ -624,6 +741,11 @@ namespace Model
          */
         virtual Model::GetFunctionOutcomeCallable GetFunctionCallable(const Model::GetFunctionRequest& request) const;
 
+        /**
+         * Same as GetFunctionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetFunctionOutcomeCallable GetFunctionCallable(Model::GetFunctionRequest&& request) const;
+
         /**
          * <p>Returns the configuration information of the Lambda function and a presigned
          * URL link to the .zip file you uploaded with <a>CreateFunction</a> so you can
@@ -642,6 +764,11 @@ namespace Model
          */
         virtual void GetFunctionAsync(const Model::GetFunctionRequest& request, const GetFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetFunctionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetFunctionAsync(Model::GetFunctionRequest&& request, const GetFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the configuration information of the Lambda function. This the same
          * information you provided as parameters when uploading the function by using
@@ -674,6 +801,11 @@ namespace Model
          */
         virtual Model::GetFunctionConfigurationOutcomeCallable GetFunctionConfigurationCallable(const Model::GetFunctionConfigurationRequest& request) const;
 
+        /**
+         * Same as GetFunctionConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetFunctionConfigurationOutcomeCallable GetFunctionConfigurationCallable(Model::GetFunctionConfigurationRequest&& request) const;
+
         /**
          * <p>Returns the configuration information of the Lambda function. This the same
          * information you provided as parameters when uploading the function by using
@@ -691,6 +823,11 @@ namespace Model
          */
         virtual void GetFunctionConfigurationAsync(const Model::GetFunctionConfigurationRequest& request, const GetFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetFunctionConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetFunctionConfigurationAsync(Model::GetFunctionConfigurationRequest&& request, const GetFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the resource policy associated with the specified Lambda
          * function.</p> <p> If you are using the versioning feature, you can get the
@@ -719,6 +856,11 @@ namespace Model
          */
         virtual Model::GetPolicyOutcomeCallable GetPolicyCallable(const Model::GetPolicyRequest& request) const;
 
+        /**
+         * Same as GetPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetPolicyOutcomeCallable GetPolicyCallable(Model::GetPolicyRequest&& request) const;
+
         /**
          * <p>Returns the resource policy associated with the specified Lambda
          * function.</p> <p> If you are using the versioning feature, you can get the
@@ -734,6 +876,11 @@ namespace Model
          */
         virtual void GetPolicyAsync(const Model::GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetPolicyAsync(Model::GetPolicyRequest&& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Invokes a specific Lambda function. </p> <p>If you are using the versioning
          * feature, you can invoke the specific function version by providing function
@@ -762,6 +909,11 @@ namespace Model
          */
         virtual Model::InvokeOutcomeCallable InvokeCallable(const Model::InvokeRequest& request) const;
 
+        /**
+         * Same as InvokeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::InvokeOutcomeCallable InvokeCallable(Model::InvokeRequest&& request) const;
+
         /**
          * <p> Invokes a specific Lambda function. </p> <p>If you are using the versioning
          * feature, you can invoke the specific function version by providing function
@@ -777,6 +929,11 @@ namespace Model
          */
         virtual void InvokeAsync(const Model::InvokeRequest& request, const InvokeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as InvokeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void InvokeAsync(Model::InvokeRequest&& request, const InvokeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns list of aliases created for a Lambda function. For each alias, the
          * response includes information such as the alias ARN, description, alias name,
@@ -799,6 +956,11 @@ namespace Model
          */
         virtual Model::ListAliasesOutcomeCallable ListAliasesCallable(const Model::ListAliasesRequest& request) const;
 
+        /**
+         * Same as ListAliasesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAliasesOutcomeCallable ListAliasesCallable(Model::ListAliasesRequest&& request) const;
+
         /**
          * <p>Returns list of aliases created for a Lambda function. For each alias, the
          * response includes information such as the alias ARN, description, alias name,
@@ -811,6 +973,11 @@ namespace Model
          */
         virtual void ListAliasesAsync(const Model::ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAliasesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAliasesAsync(Model::ListAliasesRequest&& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of event source mappings you created using the
          * <code>CreateEventSourceMapping</code> (see <a>CreateEventSourceMapping</a>).
@@ -843,6 +1010,11 @@ namespace Model
          */
         virtual Model::ListEventSourceMappingsOutcomeCallable ListEventSourceMappingsCallable(const Model::ListEventSourceMappingsRequest& request) const;
 
+        /**
+         * Same as ListEventSourceMappingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListEventSourceMappingsOutcomeCallable ListEventSourceMappingsCallable(Model::ListEventSourceMappingsRequest&& request) const;
+
         /**
          * <p>Returns a list of event source mappings you created using the
          * <code>CreateEventSourceMapping</code> (see <a>CreateEventSourceMapping</a>).
@@ -860,6 +1032,11 @@ namespace Model
          */
         virtual void ListEventSourceMappingsAsync(const Model::ListEventSourceMappingsRequest& request, const ListEventSourceMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListEventSourceMappingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListEventSourceMappingsAsync(Model::ListEventSourceMappingsRequest&& request, const ListEventSourceMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of your Lambda functions. For each function, the response
          * includes the function configuration information. You must use <a>GetFunction</a>
@@ -886,6 +1063,11 @@ namespace Model
          */
         virtual Model::ListFunctionsOutcomeCallable ListFunctionsCallable(const Model::ListFunctionsRequest& request) const;
 
+        /**
+         * Same as ListFunctionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListFunctionsOutcomeCallable ListFunctionsCallable(Model::ListFunctionsRequest&& request) const;
+
         /**
          * <p>Returns a list of your Lambda functions. For each function, the response
          * includes the function configuration information. You must use <a>GetFunction</a>
@@ -900,6 +1082,11 @@ namespace Model
          */
         virtual void ListFunctionsAsync(const Model::ListFunctionsRequest& request, const ListFunctionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListFunctionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListFunctionsAsync(Model::ListFunctionsRequest&& request, const ListFunctionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>List all versions of a function. For information about the versioning
          * feature, see <a
@@ -918,6 +1105,11 @@ namespace Model
          */
         virtual Model::ListVersionsByFunctionOutcomeCallable ListVersionsByFunctionCallable(const Model::ListVersionsByFunctionRequest& request) const;
 
+        /**
+         * Same as ListVersionsByFunctionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListVersionsByFunctionOutcomeCallable ListVersionsByFunctionCallable(Model::ListVersionsByFunctionRequest&& request) const;
+
         /**
          * <p>List all versions of a function. For information about the versioning
          * feature, see <a
@@ -928,6 +1120,11 @@ namespace Model
          */
         virtual void ListVersionsByFunctionAsync(const Model::ListVersionsByFunctionRequest& request, const ListVersionsByFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListVersionsByFunctionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListVersionsByFunctionAsync(Model::ListVersionsByFunctionRequest&& request, const ListVersionsByFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Publishes a version of your function from the current snapshot of $LATEST.
          * That is, AWS Lambda takes a snapshot of the function code and configuration
@@ -952,6 +1149,11 @@ namespace Model
          */
         virtual Model::PublishVersionOutcomeCallable PublishVersionCallable(const Model::PublishVersionRequest& request) const;
 
+        /**
+         * Same as PublishVersionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PublishVersionOutcomeCallable PublishVersionCallable(Model::PublishVersionRequest&& request) const;
+
         /**
          * <p>Publishes a version of your function from the current snapshot of $LATEST.
          * That is, AWS Lambda takes a snapshot of the function code and configuration
@@ -965,6 +1167,11 @@ namespace Model
          */
         virtual void PublishVersionAsync(const Model::PublishVersionRequest& request, const PublishVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PublishVersionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PublishVersionAsync(Model::PublishVersionRequest&& request, const PublishVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>You can remove individual permissions from an resource policy associated with
          * a Lambda function by providing a statement ID that you provided when you added
@@ -997,6 +1204,11 @@ namespace Model
          */
         virtual Model::RemovePermissionOutcomeCallable RemovePermissionCallable(const Model::RemovePermissionRequest& request) const;
 
+        /**
+         * Same as RemovePermissionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemovePermissionOutcomeCallable RemovePermissionCallable(Model::RemovePermissionRequest&& request) const;
+
         /**
          * <p>You can remove individual permissions from an resource policy associated with
          * a Lambda function by providing a statement ID that you provided when you added
@@ -1014,6 +1226,11 @@ namespace Model
          */
         virtual void RemovePermissionAsync(const Model::RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemovePermissionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemovePermissionAsync(Model::RemovePermissionRequest&& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Using this API you can update the function version to which the alias points
          * and the alias description. For more information, see <a
@@ -1034,6 +1251,11 @@ namespace Model
          */
         virtual Model::UpdateAliasOutcomeCallable UpdateAliasCallable(const Model::UpdateAliasRequest& request) const;
 
+        /**
+         * Same as UpdateAliasCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateAliasOutcomeCallable UpdateAliasCallable(Model::UpdateAliasRequest&& request) const;
+
         /**
          * <p>Using this API you can update the function version to which the alias points
          * and the alias description. For more information, see <a
@@ -1045,6 +1267,11 @@ namespace Model
          */
         virtual void UpdateAliasAsync(const Model::UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAliasAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateAliasAsync(Model::UpdateAliasRequest&& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>You can update an event source mapping. This is useful if you want to change
          * the parameters of the existing mapping without losing your position in the
@@ -1085,6 +1312,11 @@ namespace Model
          */
         virtual Model::UpdateEventSourceMappingOutcomeCallable UpdateEventSourceMappingCallable(const Model::UpdateEventSourceMappingRequest& request) const;
 
+        /**
+         * Same as UpdateEventSourceMappingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateEventSourceMappingOutcomeCallable UpdateEventSourceMappingCallable(Model::UpdateEventSourceMappingRequest&& request) const;
+
         /**
          * <p>You can update an event source mapping. This is useful if you want to change
          * the parameters of the existing mapping without losing your position in the
@@ -1106,6 +1338,11 @@ namespace Model
          */
         virtual void UpdateEventSourceMappingAsync(const Model::UpdateEventSourceMappingRequest& request, const UpdateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateEventSourceMappingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateEventSourceMappingAsync(Model::UpdateEventSourceMappingRequest&& request, const UpdateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Updates the code for the specified Lambda function. This operation must only
          * be used on an existing Lambda function and cannot be used to update the function
@@ -1132,6 +1369,11 @@ namespace Model
          */
         virtual Model::UpdateFunctionCodeOutcomeCallable UpdateFunctionCodeCallable(const Model::UpdateFunctionCodeRequest& request) const;
 
+        /**
+         * Same as UpdateFunctionCodeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateFunctionCodeOutcomeCallable UpdateFunctionCodeCallable(Model::UpdateFunctionCodeRequest&& request) const;
+
         /**
          * <p> Updates the code for the specified Lambda function. This operation must only
          * be used on an existing Lambda function and cannot be used to update the function
@@ -1146,6 +1388,11 @@ namespace Model
          */
         virtual void UpdateFunctionCodeAsync(const Model::UpdateFunctionCodeRequest& request, const UpdateFunctionCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateFunctionCodeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateFunctionCodeAsync(Model::UpdateFunctionCodeRequest&& request, const UpdateFunctionCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the configuration parameters for the specified Lambda function by
          * using the values provided in the request. You provide only the parameters you
@@ -1174,6 +1421,11 @@ namespace Model
          */
         virtual Model::UpdateFunctionConfigurationOutcomeCallable UpdateFunctionConfigurationCallable(const Model::UpdateFunctionConfigurationRequest& request) const;
 
+        /**
+         * Same as UpdateFunctionConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateFunctionConfigurationOutcomeCallable UpdateFunctionConfigurationCallable(Model::UpdateFunctionConfigurationRequest&& request) const;
+
         /**
          * <p>Updates the configuration parameters for the specified Lambda function by
          * using the values provided in the request. You provide only the parameters you
@@ -1189,6 +1441,64 @@ namespace Model
          */
         virtual void UpdateFunctionConfigurationAsync(const Model::UpdateFunctionConfigurationRequest& request, const UpdateFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateFunctionConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateFunctionConfigurationAsync(Model::UpdateFunctionConfigurationRequest&& request, const UpdateFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AddPermissionOutcome> AddPermissionAwaitable(const Model::AddPermissionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::AddPermission, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddPermissionOutcome> AddPermissionAwaitable(Model::AddPermissionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::AddPermission, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAliasOutcome> CreateAliasAwaitable(const Model::CreateAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::CreateAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAliasOutcome> CreateAliasAwaitable(Model::CreateAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::CreateAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateEventSourceMappingOutcome> CreateEventSourceMappingAwaitable(const Model::CreateEventSourceMappingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::CreateEventSourceMapping, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateEventSourceMappingOutcome> CreateEventSourceMappingAwaitable(Model::CreateEventSourceMappingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::CreateEventSourceMapping, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateFunctionOutcome> CreateFunctionAwaitable(const Model::CreateFunctionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::CreateFunction, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateFunctionOutcome> CreateFunctionAwaitable(Model::CreateFunctionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::CreateFunction, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAliasOutcome> DeleteAliasAwaitable(const Model::DeleteAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::DeleteAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAliasOutcome> DeleteAliasAwaitable(Model::DeleteAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::DeleteAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteEventSourceMappingOutcome> DeleteEventSourceMappingAwaitable(const Model::DeleteEventSourceMappingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::DeleteEventSourceMapping, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteEventSourceMappingOutcome> DeleteEventSourceMappingAwaitable(Model::DeleteEventSourceMappingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::DeleteEventSourceMapping, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteFunctionOutcome> DeleteFunctionAwaitable(const Model::DeleteFunctionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::DeleteFunction, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteFunctionOutcome> DeleteFunctionAwaitable(Model::DeleteFunctionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::DeleteFunction, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAliasOutcome> GetAliasAwaitable(const Model::GetAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::GetAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAliasOutcome> GetAliasAwaitable(Model::GetAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::GetAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetEventSourceMappingOutcome> GetEventSourceMappingAwaitable(const Model::GetEventSourceMappingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::GetEventSourceMapping, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetEventSourceMappingOutcome> GetEventSourceMappingAwaitable(Model::GetEventSourceMappingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::GetEventSourceMapping, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetFunctionOutcome> GetFunctionAwaitable(const Model::GetFunctionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::GetFunction, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetFunctionOutcome> GetFunctionAwaitable(Model::GetFunctionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::GetFunction, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetFunctionConfigurationOutcome> GetFunctionConfigurationAwaitable(const Model::GetFunctionConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::GetFunctionConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetFunctionConfigurationOutcome> GetFunctionConfigurationAwaitable(Model::GetFunctionConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::GetFunctionConfiguration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPolicyOutcome> GetPolicyAwaitable(const Model::GetPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::GetPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPolicyOutcome> GetPolicyAwaitable(Model::GetPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::GetPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::InvokeOutcome> InvokeAwaitable(const Model::InvokeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::Invoke, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::InvokeOutcome> InvokeAwaitable(Model::InvokeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::Invoke, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAliasesOutcome> ListAliasesAwaitable(const Model::ListAliasesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::ListAliases, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAliasesOutcome> ListAliasesAwaitable(Model::ListAliasesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::ListAliases, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListEventSourceMappingsOutcome> ListEventSourceMappingsAwaitable(const Model::ListEventSourceMappingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::ListEventSourceMappings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListEventSourceMappingsOutcome> ListEventSourceMappingsAwaitable(Model::ListEventSourceMappingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::ListEventSourceMappings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListFunctionsOutcome> ListFunctionsAwaitable(const Model::ListFunctionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::ListFunctions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListFunctionsOutcome> ListFunctionsAwaitable(Model::ListFunctionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::ListFunctions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListVersionsByFunctionOutcome> ListVersionsByFunctionAwaitable(const Model::ListVersionsByFunctionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::ListVersionsByFunction, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListVersionsByFunctionOutcome> ListVersionsByFunctionAwaitable(Model::ListVersionsByFunctionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::ListVersionsByFunction, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PublishVersionOutcome> PublishVersionAwaitable(const Model::PublishVersionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::PublishVersion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PublishVersionOutcome> PublishVersionAwaitable(Model::PublishVersionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::PublishVersion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemovePermissionOutcome> RemovePermissionAwaitable(const Model::RemovePermissionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::RemovePermission, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemovePermissionOutcome> RemovePermissionAwaitable(Model::RemovePermissionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::RemovePermission, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAliasOutcome> UpdateAliasAwaitable(const Model::UpdateAliasRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::UpdateAlias, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAliasOutcome> UpdateAliasAwaitable(Model::UpdateAliasRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::UpdateAlias, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateEventSourceMappingOutcome> UpdateEventSourceMappingAwaitable(const Model::UpdateEventSourceMappingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::UpdateEventSourceMapping, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateEventSourceMappingOutcome> UpdateEventSourceMappingAwaitable(Model::UpdateEventSourceMappingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::UpdateEventSourceMapping, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateFunctionCodeOutcome> UpdateFunctionCodeAwaitable(const Model::UpdateFunctionCodeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::UpdateFunctionCode, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateFunctionCodeOutcome> UpdateFunctionCodeAwaitable(Model::UpdateFunctionCodeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::UpdateFunctionCode, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateFunctionConfigurationOutcome> UpdateFunctionConfigurationAwaitable(const Model::UpdateFunctionConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::UpdateFunctionConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateFunctionConfigurationOutcome> UpdateFunctionConfigurationAwaitable(Model::UpdateFunctionConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &LambdaClient::UpdateFunctionConfiguration, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -132,12 +132,22 @@ AddPermissionOutcome LambdaClient::AddPermission(const AddPermissionRequest& req
 
 AddPermissionOutcomeCallable LambdaClient::AddPermissionCallable(const AddPermissionRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::AddPermission, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::AddPermission, Aws::Client::RejectedCallOutcome<AddPermissionOutcome>(), this, request);
+}
+
+AddPermissionOutcomeCallable LambdaClient::AddPermissionCallable(AddPermissionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::AddPermission, Aws::Client::RejectedCallOutcome<AddPermissionOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::AddPermissionAsync(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::AddPermissionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::AddPermissionAsyncHelper, Aws::Client::RejectedAsyncCall<AddPermissionOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::AddPermissionAsync(AddPermissionRequest&& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::AddPermissionAsyncHelper, Aws::Client::RejectedAsyncCall<AddPermissionOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::AddPermissionAsyncHelper(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -165,12 +175,22 @@ CreateAliasOutcome LambdaClient::CreateAlias(const CreateAliasRequest& request)
 
 CreateAliasOutcomeCallable LambdaClient::CreateAliasCallable(const CreateAliasRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::CreateAlias, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::CreateAlias, Aws::Client::RejectedCallOutcome<CreateAliasOutcome>(), this, request);
+}
+
+CreateAliasOutcomeCallable LambdaClient::CreateAliasCallable(CreateAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::CreateAlias, Aws::Client::RejectedCallOutcome<CreateAliasOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::CreateAliasAsync(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::CreateAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::CreateAliasAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAliasOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::CreateAliasAsync(CreateAliasRequest&& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::CreateAliasAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::CreateAliasAsyncHelper(const CreateAliasRequest& request, const CreateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -196,12 +216,22 @@ CreateEventSourceMappingOutcome LambdaClient::CreateEventSourceMapping(const Cre
 
 CreateEventSourceMappingOutcomeCallable LambdaClient::CreateEventSourceMappingCallable(const CreateEventSourceMappingRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::CreateEventSourceMapping, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::CreateEventSourceMapping, Aws::Client::RejectedCallOutcome<CreateEventSourceMappingOutcome>(), this, request);
+}
+
+CreateEventSourceMappingOutcomeCallable LambdaClient::CreateEventSourceMappingCallable(CreateEventSourceMappingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::CreateEventSourceMapping, Aws::Client::RejectedCallOutcome<CreateEventSourceMappingOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::CreateEventSourceMappingAsync(const CreateEventSourceMappingRequest& request, const CreateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::CreateEventSourceMappingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::CreateEventSourceMappingAsyncHelper, Aws::Client::RejectedAsyncCall<CreateEventSourceMappingOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::CreateEventSourceMappingAsync(CreateEventSourceMappingRequest&& request, const CreateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::CreateEventSourceMappingAsyncHelper, Aws::Client::RejectedAsyncCall<CreateEventSourceMappingOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::CreateEventSourceMappingAsyncHelper(const CreateEventSourceMappingRequest& request, const CreateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -227,12 +257,22 @@ CreateFunctionOutcome LambdaClient::CreateFunction(const CreateFunctionRequest&
 
 CreateFunctionOutcomeCallable LambdaClient::CreateFunctionCallable(const CreateFunctionRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::CreateFunction, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::CreateFunction, Aws::Client::RejectedCallOutcome<CreateFunctionOutcome>(), this, request);
+}
+
+CreateFunctionOutcomeCallable LambdaClient::CreateFunctionCallable(CreateFunctionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::CreateFunction, Aws::Client::RejectedCallOutcome<CreateFunctionOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::CreateFunctionAsync(const CreateFunctionRequest& request, const CreateFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::CreateFunctionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::CreateFunctionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateFunctionOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::CreateFunctionAsync(CreateFunctionRequest&& request, const CreateFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::CreateFunctionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateFunctionOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::CreateFunctionAsyncHelper(const CreateFunctionRequest& request, const CreateFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -261,12 +301,22 @@ DeleteAliasOutcome LambdaClient::DeleteAlias(const DeleteAliasRequest& request)
 
 DeleteAliasOutcomeCallable LambdaClient::DeleteAliasCallable(const DeleteAliasRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::DeleteAlias, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::DeleteAlias, Aws::Client::RejectedCallOutcome<DeleteAliasOutcome>(), this, request);
+}
+
+DeleteAliasOutcomeCallable LambdaClient::DeleteAliasCallable(DeleteAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::DeleteAlias, Aws::Client::RejectedCallOutcome<DeleteAliasOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::DeleteAliasAsync(const DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::DeleteAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::DeleteAliasAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAliasOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::DeleteAliasAsync(DeleteAliasRequest&& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::DeleteAliasAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::DeleteAliasAsyncHelper(const DeleteAliasRequest& request, const DeleteAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -293,12 +343,22 @@ DeleteEventSourceMappingOutcome LambdaClient::DeleteEventSourceMapping(const Del
 
 DeleteEventSourceMappingOutcomeCallable LambdaClient::DeleteEventSourceMappingCallable(const DeleteEventSourceMappingRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::DeleteEventSourceMapping, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::DeleteEventSourceMapping, Aws::Client::RejectedCallOutcome<DeleteEventSourceMappingOutcome>(), this, request);
+}
+
+DeleteEventSourceMappingOutcomeCallable LambdaClient::DeleteEventSourceMappingCallable(DeleteEventSourceMappingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::DeleteEventSourceMapping, Aws::Client::RejectedCallOutcome<DeleteEventSourceMappingOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::DeleteEventSourceMappingAsync(const DeleteEventSourceMappingRequest& request, const DeleteEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::DeleteEventSourceMappingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::DeleteEventSourceMappingAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteEventSourceMappingOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::DeleteEventSourceMappingAsync(DeleteEventSourceMappingRequest&& request, const DeleteEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::DeleteEventSourceMappingAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteEventSourceMappingOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::DeleteEventSourceMappingAsyncHelper(const DeleteEventSourceMappingRequest& request, const DeleteEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -325,12 +385,22 @@ DeleteFunctionOutcome LambdaClient::DeleteFunction(const DeleteFunctionRequest&
 
 DeleteFunctionOutcomeCallable LambdaClient::DeleteFunctionCallable(const DeleteFunctionRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::DeleteFunction, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::DeleteFunction, Aws::Client::RejectedCallOutcome<DeleteFunctionOutcome>(), this, request);
+}
+
+DeleteFunctionOutcomeCallable LambdaClient::DeleteFunctionCallable(DeleteFunctionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::DeleteFunction, Aws::Client::RejectedCallOutcome<DeleteFunctionOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::DeleteFunctionAsync(const DeleteFunctionRequest& request, const DeleteFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::DeleteFunctionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::DeleteFunctionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteFunctionOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::DeleteFunctionAsync(DeleteFunctionRequest&& request, const DeleteFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::DeleteFunctionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteFunctionOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::DeleteFunctionAsyncHelper(const DeleteFunctionRequest& request, const DeleteFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -359,12 +429,22 @@ GetAliasOutcome LambdaClient::GetAlias(const GetAliasRequest& request) const
 
 GetAliasOutcomeCallable LambdaClient::GetAliasCallable(const GetAliasRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::GetAlias, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::GetAlias, Aws::Client::RejectedCallOutcome<GetAliasOutcome>(), this, request);
+}
+
+GetAliasOutcomeCallable LambdaClient::GetAliasCallable(GetAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::GetAlias, Aws::Client::RejectedCallOutcome<GetAliasOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::GetAliasAsync(const GetAliasRequest& request, const GetAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::GetAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::GetAliasAsyncHelper, Aws::Client::RejectedAsyncCall<GetAliasOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::GetAliasAsync(GetAliasRequest&& request, const GetAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::GetAliasAsyncHelper, Aws::Client::RejectedAsyncCall<GetAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::GetAliasAsyncHelper(const GetAliasRequest& request, const GetAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -391,12 +471,22 @@ GetEventSourceMappingOutcome LambdaClient::GetEventSourceMapping(const GetEventS
 
 GetEventSourceMappingOutcomeCallable LambdaClient::GetEventSourceMappingCallable(const GetEventSourceMappingRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::GetEventSourceMapping, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::GetEventSourceMapping, Aws::Client::RejectedCallOutcome<GetEventSourceMappingOutcome>(), this, request);
+}
+
+GetEventSourceMappingOutcomeCallable LambdaClient::GetEventSourceMappingCallable(GetEventSourceMappingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::GetEventSourceMapping, Aws::Client::RejectedCallOutcome<GetEventSourceMappingOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::GetEventSourceMappingAsync(const GetEventSourceMappingRequest& request, const GetEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::GetEventSourceMappingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::GetEventSourceMappingAsyncHelper, Aws::Client::RejectedAsyncCall<GetEventSourceMappingOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::GetEventSourceMappingAsync(GetEventSourceMappingRequest&& request, const GetEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::GetEventSourceMappingAsyncHelper, Aws::Client::RejectedAsyncCall<GetEventSourceMappingOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::GetEventSourceMappingAsyncHelper(const GetEventSourceMappingRequest& request, const GetEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -423,12 +513,22 @@ GetFunctionOutcome LambdaClient::GetFunction(const GetFunctionRequest& request)
 
 GetFunctionOutcomeCallable LambdaClient::GetFunctionCallable(const GetFunctionRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::GetFunction, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::GetFunction, Aws::Client::RejectedCallOutcome<GetFunctionOutcome>(), this, request);
+}
+
+GetFunctionOutcomeCallable LambdaClient::GetFunctionCallable(GetFunctionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::GetFunction, Aws::Client::RejectedCallOutcome<GetFunctionOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::GetFunctionAsync(const GetFunctionRequest& request, const GetFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::GetFunctionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::GetFunctionAsyncHelper, Aws::Client::RejectedAsyncCall<GetFunctionOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::GetFunctionAsync(GetFunctionRequest&& request, const GetFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::GetFunctionAsyncHelper, Aws::Client::RejectedAsyncCall<GetFunctionOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::GetFunctionAsyncHelper(const GetFunctionRequest& request, const GetFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -456,12 +556,22 @@ GetFunctionConfigurationOutcome LambdaClient::GetFunctionConfiguration(const Get
 
 GetFunctionConfigurationOutcomeCallable LambdaClient::GetFunctionConfigurationCallable(const GetFunctionConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::GetFunctionConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::GetFunctionConfiguration, Aws::Client::RejectedCallOutcome<GetFunctionConfigurationOutcome>(), this, request);
+}
+
+GetFunctionConfigurationOutcomeCallable LambdaClient::GetFunctionConfigurationCallable(GetFunctionConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::GetFunctionConfiguration, Aws::Client::RejectedCallOutcome<GetFunctionConfigurationOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::GetFunctionConfigurationAsync(const GetFunctionConfigurationRequest& request, const GetFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::GetFunctionConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::GetFunctionConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<GetFunctionConfigurationOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::GetFunctionConfigurationAsync(GetFunctionConfigurationRequest&& request, const GetFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::GetFunctionConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<GetFunctionConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::GetFunctionConfigurationAsyncHelper(const GetFunctionConfigurationRequest& request, const GetFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -489,12 +599,22 @@ GetPolicyOutcome LambdaClient::GetPolicy(const GetPolicyRequest& request) const
 
 GetPolicyOutcomeCallable LambdaClient::GetPolicyCallable(const GetPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::GetPolicy, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::GetPolicy, Aws::Client::RejectedCallOutcome<GetPolicyOutcome>(), this, request);
+}
+
+GetPolicyOutcomeCallable LambdaClient::GetPolicyCallable(GetPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::GetPolicy, Aws::Client::RejectedCallOutcome<GetPolicyOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::GetPolicyAsync(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::GetPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::GetPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetPolicyOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::GetPolicyAsync(GetPolicyRequest&& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::GetPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::GetPolicyAsyncHelper(const GetPolicyRequest& request, const GetPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -522,12 +642,22 @@ InvokeOutcome LambdaClient::Invoke(const InvokeRequest& request) const
 
 InvokeOutcomeCallable LambdaClient::InvokeCallable(const InvokeRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::Invoke, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::Invoke, Aws::Client::RejectedCallOutcome<InvokeOutcome>(), this, request);
+}
+
+InvokeOutcomeCallable LambdaClient::InvokeCallable(InvokeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::Invoke, Aws::Client::RejectedCallOutcome<InvokeOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::InvokeAsync(const InvokeRequest& request, const InvokeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::InvokeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::InvokeAsyncHelper, Aws::Client::RejectedAsyncCall<InvokeOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::InvokeAsync(InvokeRequest&& request, const InvokeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::InvokeAsyncHelper, Aws::Client::RejectedAsyncCall<InvokeOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::InvokeAsyncHelper(const InvokeRequest& request, const InvokeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -555,12 +685,22 @@ ListAliasesOutcome LambdaClient::ListAliases(const ListAliasesRequest& request)
 
 ListAliasesOutcomeCallable LambdaClient::ListAliasesCallable(const ListAliasesRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::ListAliases, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::ListAliases, Aws::Client::RejectedCallOutcome<ListAliasesOutcome>(), this, request);
+}
+
+ListAliasesOutcomeCallable LambdaClient::ListAliasesCallable(ListAliasesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::ListAliases, Aws::Client::RejectedCallOutcome<ListAliasesOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::ListAliasesAsync(const ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::ListAliasesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::ListAliasesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAliasesOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::ListAliasesAsync(ListAliasesRequest&& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::ListAliasesAsyncHelper, Aws::Client::RejectedAsyncCall<ListAliasesOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::ListAliasesAsyncHelper(const ListAliasesRequest& request, const ListAliasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -586,12 +726,22 @@ ListEventSourceMappingsOutcome LambdaClient::ListEventSourceMappings(const ListE
 
 ListEventSourceMappingsOutcomeCallable LambdaClient::ListEventSourceMappingsCallable(const ListEventSourceMappingsRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::ListEventSourceMappings, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::ListEventSourceMappings, Aws::Client::RejectedCallOutcome<ListEventSourceMappingsOutcome>(), this, request);
+}
+
+ListEventSourceMappingsOutcomeCallable LambdaClient::ListEventSourceMappingsCallable(ListEventSourceMappingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::ListEventSourceMappings, Aws::Client::RejectedCallOutcome<ListEventSourceMappingsOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::ListEventSourceMappingsAsync(const ListEventSourceMappingsRequest& request, const ListEventSourceMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::ListEventSourceMappingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::ListEventSourceMappingsAsyncHelper, Aws::Client::RejectedAsyncCall<ListEventSourceMappingsOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::ListEventSourceMappingsAsync(ListEventSourceMappingsRequest&& request, const ListEventSourceMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::ListEventSourceMappingsAsyncHelper, Aws::Client::RejectedAsyncCall<ListEventSourceMappingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::ListEventSourceMappingsAsyncHelper(const ListEventSourceMappingsRequest& request, const ListEventSourceMappingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -617,12 +767,22 @@ ListFunctionsOutcome LambdaClient::ListFunctions(const ListFunctionsRequest& req
 
 ListFunctionsOutcomeCallable LambdaClient::ListFunctionsCallable(const ListFunctionsRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::ListFunctions, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::ListFunctions, Aws::Client::RejectedCallOutcome<ListFunctionsOutcome>(), this, request);
+}
+
+ListFunctionsOutcomeCallable LambdaClient::ListFunctionsCallable(ListFunctionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::ListFunctions, Aws::Client::RejectedCallOutcome<ListFunctionsOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::ListFunctionsAsync(const ListFunctionsRequest& request, const ListFunctionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::ListFunctionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::ListFunctionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListFunctionsOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::ListFunctionsAsync(ListFunctionsRequest&& request, const ListFunctionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::ListFunctionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListFunctionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::ListFunctionsAsyncHelper(const ListFunctionsRequest& request, const ListFunctionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -650,12 +810,22 @@ ListVersionsByFunctionOutcome LambdaClient::ListVersionsByFunction(const ListVer
 
 ListVersionsByFunctionOutcomeCallable LambdaClient::ListVersionsByFunctionCallable(const ListVersionsByFunctionRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::ListVersionsByFunction, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::ListVersionsByFunction, Aws::Client::RejectedCallOutcome<ListVersionsByFunctionOutcome>(), this, request);
+}
+
+ListVersionsByFunctionOutcomeCallable LambdaClient::ListVersionsByFunctionCallable(ListVersionsByFunctionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::ListVersionsByFunction, Aws::Client::RejectedCallOutcome<ListVersionsByFunctionOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::ListVersionsByFunctionAsync(const ListVersionsByFunctionRequest& request, const ListVersionsByFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::ListVersionsByFunctionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::ListVersionsByFunctionAsyncHelper, Aws::Client::RejectedAsyncCall<ListVersionsByFunctionOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::ListVersionsByFunctionAsync(ListVersionsByFunctionRequest&& request, const ListVersionsByFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::ListVersionsByFunctionAsyncHelper, Aws::Client::RejectedAsyncCall<ListVersionsByFunctionOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::ListVersionsByFunctionAsyncHelper(const ListVersionsByFunctionRequest& request, const ListVersionsByFunctionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -683,12 +853,22 @@ PublishVersionOutcome LambdaClient::PublishVersion(const PublishVersionRequest&
 
 PublishVersionOutcomeCallable LambdaClient::PublishVersionCallable(const PublishVersionRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::PublishVersion, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::PublishVersion, Aws::Client::RejectedCallOutcome<PublishVersionOutcome>(), this, request);
+}
+
+PublishVersionOutcomeCallable LambdaClient::PublishVersionCallable(PublishVersionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::PublishVersion, Aws::Client::RejectedCallOutcome<PublishVersionOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::PublishVersionAsync(const PublishVersionRequest& request, const PublishVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::PublishVersionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::PublishVersionAsyncHelper, Aws::Client::RejectedAsyncCall<PublishVersionOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::PublishVersionAsync(PublishVersionRequest&& request, const PublishVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::PublishVersionAsyncHelper, Aws::Client::RejectedAsyncCall<PublishVersionOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::PublishVersionAsyncHelper(const PublishVersionRequest& request, const PublishVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -717,12 +897,22 @@ RemovePermissionOutcome LambdaClient::RemovePermission(const RemovePermissionReq
 
 RemovePermissionOutcomeCallable LambdaClient::RemovePermissionCallable(const RemovePermissionRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::RemovePermission, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::RemovePermission, Aws::Client::RejectedCallOutcome<RemovePermissionOutcome>(), this, request);
+}
+
+RemovePermissionOutcomeCallable LambdaClient::RemovePermissionCallable(RemovePermissionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::RemovePermission, Aws::Client::RejectedCallOutcome<RemovePermissionOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::RemovePermissionAsync(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::RemovePermissionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::RemovePermissionAsyncHelper, Aws::Client::RejectedAsyncCall<RemovePermissionOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::RemovePermissionAsync(RemovePermissionRequest&& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::RemovePermissionAsyncHelper, Aws::Client::RejectedAsyncCall<RemovePermissionOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::RemovePermissionAsyncHelper(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -751,12 +941,22 @@ UpdateAliasOutcome LambdaClient::UpdateAlias(const UpdateAliasRequest& request)
 
 UpdateAliasOutcomeCallable LambdaClient::UpdateAliasCallable(const UpdateAliasRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::UpdateAlias, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::UpdateAlias, Aws::Client::RejectedCallOutcome<UpdateAliasOutcome>(), this, request);
+}
+
+UpdateAliasOutcomeCallable LambdaClient::UpdateAliasCallable(UpdateAliasRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::UpdateAlias, Aws::Client::RejectedCallOutcome<UpdateAliasOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::UpdateAliasAsync(const UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::UpdateAliasAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::UpdateAliasAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAliasOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::UpdateAliasAsync(UpdateAliasRequest&& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::UpdateAliasAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAliasOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::UpdateAliasAsyncHelper(const UpdateAliasRequest& request, const UpdateAliasResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -783,12 +983,22 @@ UpdateEventSourceMappingOutcome LambdaClient::UpdateEventSourceMapping(const Upd
 
 UpdateEventSourceMappingOutcomeCallable LambdaClient::UpdateEventSourceMappingCallable(const UpdateEventSourceMappingRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::UpdateEventSourceMapping, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::UpdateEventSourceMapping, Aws::Client::RejectedCallOutcome<UpdateEventSourceMappingOutcome>(), this, request);
+}
+
+UpdateEventSourceMappingOutcomeCallable LambdaClient::UpdateEventSourceMappingCallable(UpdateEventSourceMappingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::UpdateEventSourceMapping, Aws::Client::RejectedCallOutcome<UpdateEventSourceMappingOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::UpdateEventSourceMappingAsync(const UpdateEventSourceMappingRequest& request, const UpdateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::UpdateEventSourceMappingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::UpdateEventSourceMappingAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateEventSourceMappingOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::UpdateEventSourceMappingAsync(UpdateEventSourceMappingRequest&& request, const UpdateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::UpdateEventSourceMappingAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateEventSourceMappingOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::UpdateEventSourceMappingAsyncHelper(const UpdateEventSourceMappingRequest& request, const UpdateEventSourceMappingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -816,12 +1026,22 @@ UpdateFunctionCodeOutcome LambdaClient::UpdateFunctionCode(const UpdateFunctionC
 
 UpdateFunctionCodeOutcomeCallable LambdaClient::UpdateFunctionCodeCallable(const UpdateFunctionCodeRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::UpdateFunctionCode, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::UpdateFunctionCode, Aws::Client::RejectedCallOutcome<UpdateFunctionCodeOutcome>(), this, request);
+}
+
+UpdateFunctionCodeOutcomeCallable LambdaClient::UpdateFunctionCodeCallable(UpdateFunctionCodeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::UpdateFunctionCode, Aws::Client::RejectedCallOutcome<UpdateFunctionCodeOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::UpdateFunctionCodeAsync(const UpdateFunctionCodeRequest& request, const UpdateFunctionCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::UpdateFunctionCodeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::UpdateFunctionCodeAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateFunctionCodeOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::UpdateFunctionCodeAsync(UpdateFunctionCodeRequest&& request, const UpdateFunctionCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::UpdateFunctionCodeAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateFunctionCodeOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::UpdateFunctionCodeAsyncHelper(const UpdateFunctionCodeRequest& request, const UpdateFunctionCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -849,12 +1069,22 @@ UpdateFunctionConfigurationOutcome LambdaClient::UpdateFunctionConfiguration(con
 
 UpdateFunctionConfigurationOutcomeCallable LambdaClient::UpdateFunctionConfigurationCallable(const UpdateFunctionConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &LambdaClient::UpdateFunctionConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&LambdaClient::UpdateFunctionConfiguration, Aws::Client::RejectedCallOutcome<UpdateFunctionConfigurationOutcome>(), this, request);
+}
+
+UpdateFunctionConfigurationOutcomeCallable LambdaClient::UpdateFunctionConfigurationCallable(UpdateFunctionConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&LambdaClient::UpdateFunctionConfiguration, Aws::Client::RejectedCallOutcome<UpdateFunctionConfigurationOutcome>(), this, std::move(request));
 }
 
 void LambdaClient::UpdateFunctionConfigurationAsync(const UpdateFunctionConfigurationRequest& request, const UpdateFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&LambdaClient::UpdateFunctionConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&LambdaClient::UpdateFunctionConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateFunctionConfigurationOutcome>(), this, request, handler, context);
+}
+
+void LambdaClient::UpdateFunctionConfigurationAsync(UpdateFunctionConfigurationRequest&& request, const UpdateFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&LambdaClient::UpdateFunctionConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateFunctionConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void LambdaClient::UpdateFunctionConfigurationAsyncHelper(const UpdateFunctionConfigurationRequest& request, const UpdateFunctionConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -35,6 +35,35 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/logs/model/CancelExportTaskRequest.h>
+#include <aws/logs/model/CreateExportTaskRequest.h>
+#include <aws/logs/model/CreateLogGroupRequest.h>
+#include <aws/logs/model/CreateLogStreamRequest.h>
+#include <aws/logs/model/DeleteDestinationRequest.h>
+#include <aws/logs/model/DeleteLogGroupRequest.h>
+#include <aws/logs/model/DeleteLogStreamRequest.h>
+#include <aws/logs/model/DeleteMetricFilterRequest.h>
+#include <aws/logs/model/DeleteRetentionPolicyRequest.h>
+#include <aws/logs/model/DeleteSubscriptionFilterRequest.h>
+#include <aws/logs/model/DescribeDestinationsRequest.h>
+#include <aws/logs/model/DescribeExportTasksRequest.h>
+#include <aws/logs/model/DescribeLogGroupsRequest.h>
+#include <aws/logs/model/DescribeLogStreamsRequest.h>
+#include <aws/logs/model/DescribeMetricFiltersRequest.h>
+#include <aws/logs/model/DescribeSubscriptionFiltersRequest.h>
+#include <aws/logs/model/FilterLogEventsRequest.h>
+#include <aws/logs/model/GetLogEventsRequest.h>
+#include <aws/logs/model/PutDestinationRequest.h>
+#include <aws/logs/model/PutDestinationPolicyRequest.h>
+#include <aws/logs/model/PutLogEventsRequest.h>
+#include <aws/logs/model/PutMetricFilterRequest.h>
+#include <aws/logs/model/PutRetentionPolicyRequest.h>
+#include <aws/logs/model/PutSubscriptionFilterRequest.h>
+#include <aws/logs/model/TestMetricFilterRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -253,6 +282,11 @@ namespace Model
          */
         virtual Model::CancelExportTaskOutcomeCallable CancelExportTaskCallable(const Model::CancelExportTaskRequest& request) const;
 
+        /**
+         * Same as CancelExportTaskCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelExportTaskOutcomeCallable CancelExportTaskCallable(Model::CancelExportTaskRequest&& request) const;
+
         /**
          * <p> Cancels an export task if it is in <code>PENDING</code> or
          * <code>RUNNING</code> state. </p>
@@ -261,6 +295,11 @@ namespace Model
          */
         virtual void CancelExportTaskAsync(const Model::CancelExportTaskRequest& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelExportTaskAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelExportTaskAsync(Model::CancelExportTaskRequest&& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates an <code>ExportTask</code> which allows you to efficiently export
          * data from a Log Group to your Amazon S3 bucket. </p> <p> This is an asynchronous
@@ -293,6 +332,11 @@ namespace Model
          */
         virtual Model::CreateExportTaskOutcomeCallable CreateExportTaskCallable(const Model::CreateExportTaskRequest& request) const;
 
+        /**
+         * Same as CreateExportTaskCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateExportTaskOutcomeCallable CreateExportTaskCallable(Model::CreateExportTaskRequest&& request) const;
+
         /**
          * <p> Creates an <code>ExportTask</code> which allows you to efficiently export
          * data from a Log Group to your Amazon S3 bucket. </p> <p> This is an asynchronous
@@ -310,6 +354,11 @@ namespace Model
          */
         virtual void CreateExportTaskAsync(const Model::CreateExportTaskRequest& request, const CreateExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateExportTaskAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateExportTaskAsync(Model::CreateExportTaskRequest&& request, const CreateExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new log group with the specified name. The name of the log group
          * must be unique within a region for an AWS account. You can create up to 500 log
@@ -332,6 +381,11 @@ namespace Model
          */
         virtual Model::CreateLogGroupOutcomeCallable CreateLogGroupCallable(const Model::CreateLogGroupRequest& request) const;
 
+        /**
+         * Same as CreateLogGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateLogGroupOutcomeCallable CreateLogGroupCallable(Model::CreateLogGroupRequest&& request) const;
+
         /**
          * <p> Creates a new log group with the specified name. The name of the log group
          * must be unique within a region for an AWS account. You can create up to 500 log
@@ -344,6 +398,11 @@ namespace Model
          */
         virtual void CreateLogGroupAsync(const Model::CreateLogGroupRequest& request, const CreateLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLogGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateLogGroupAsync(Model::CreateLogGroupRequest&& request, const CreateLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new log stream in the specified log group. The name of the log
          * stream must be unique within the log group. There is no limit on the number of
@@ -366,6 +425,11 @@ namespace Model
          */
         virtual Model::CreateLogStreamOutcomeCallable CreateLogStreamCallable(const Model::CreateLogStreamRequest& request) const;
 
+        /**
+         * Same as CreateLogStreamCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateLogStreamOutcomeCallable CreateLogStreamCallable(Model::CreateLogStreamRequest&& request) const;
+
         /**
          * <p> Creates a new log stream in the specified log group. The name of the log
          * stream must be unique within the log group. There is no limit on the number of
@@ -378,6 +442,11 @@ namespace Model
          */
         virtual void CreateLogStreamAsync(const Model::CreateLogStreamRequest& request, const CreateLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLogStreamAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateLogStreamAsync(Model::CreateLogStreamRequest&& request, const CreateLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the destination with the specified name and eventually disables all
          * the subscription filters that publish to it. This will not delete the physical
@@ -394,6 +463,11 @@ namespace Model
          */
         virtual Model::DeleteDestinationOutcomeCallable DeleteDestinationCallable(const Model::DeleteDestinationRequest& request) const;
 
+        /**
+         * Same as DeleteDestinationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDestinationOutcomeCallable DeleteDestinationCallable(Model::DeleteDestinationRequest&& request) const;
+
         /**
          * <p> Deletes the destination with the specified name and eventually disables all
          * the subscription filters that publish to it. This will not delete the physical
@@ -403,6 +477,11 @@ namespace Model
          */
         virtual void DeleteDestinationAsync(const Model::DeleteDestinationRequest& request, const DeleteDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDestinationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDestinationAsync(Model::DeleteDestinationRequest&& request, const DeleteDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the log group with the specified name and permanently deletes all
          * the archived log events associated with it. </p>
@@ -417,6 +496,11 @@ namespace Model
          */
         virtual Model::DeleteLogGroupOutcomeCallable DeleteLogGroupCallable(const Model::DeleteLogGroupRequest& request) const;
 
+        /**
+         * Same as DeleteLogGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteLogGroupOutcomeCallable DeleteLogGroupCallable(Model::DeleteLogGroupRequest&& request) const;
+
         /**
          * <p> Deletes the log group with the specified name and permanently deletes all
          * the archived log events associated with it. </p>
@@ -425,6 +509,11 @@ namespace Model
          */
         virtual void DeleteLogGroupAsync(const Model::DeleteLogGroupRequest& request, const DeleteLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLogGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteLogGroupAsync(Model::DeleteLogGroupRequest&& request, const DeleteLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a log stream and permanently deletes all the archived log events
          * associated with it. </p>
@@ -439,6 +528,11 @@ namespace Model
          */
         virtual Model::DeleteLogStreamOutcomeCallable DeleteLogStreamCallable(const Model::DeleteLogStreamRequest& request) const;
 
+        /**
+         * Same as DeleteLogStreamCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteLogStreamOutcomeCallable DeleteLogStreamCallable(Model::DeleteLogStreamRequest&& request) const;
+
         /**
          * <p> Deletes a log stream and permanently deletes all the archived log events
          * associated with it. </p>
@@ -447,6 +541,11 @@ namespace Model
          */
         virtual void DeleteLogStreamAsync(const Model::DeleteLogStreamRequest& request, const DeleteLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLogStreamAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteLogStreamAsync(Model::DeleteLogStreamRequest&& request, const DeleteLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a metric filter associated with the specified log group. </p>
          */
@@ -459,6 +558,11 @@ namespace Model
          */
         virtual Model::DeleteMetricFilterOutcomeCallable DeleteMetricFilterCallable(const Model::DeleteMetricFilterRequest& request) const;
 
+        /**
+         * Same as DeleteMetricFilterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteMetricFilterOutcomeCallable DeleteMetricFilterCallable(Model::DeleteMetricFilterRequest&& request) const;
+
         /**
          * <p> Deletes a metric filter associated with the specified log group. </p>
          *
@@ -466,6 +570,11 @@ namespace Model
          */
         virtual void DeleteMetricFilterAsync(const Model::DeleteMetricFilterRequest& request, const DeleteMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteMetricFilterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteMetricFilterAsync(Model::DeleteMetricFilterRequest&& request, const DeleteMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the retention policy of the specified log group. Log events would
          * not expire if they belong to log groups without a retention policy. </p>
@@ -480,6 +589,11 @@ namespace Model
          */
         virtual Model::DeleteRetentionPolicyOutcomeCallable DeleteRetentionPolicyCallable(const Model::DeleteRetentionPolicyRequest& request) const;
 
+        /**
+         * Same as DeleteRetentionPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteRetentionPolicyOutcomeCallable DeleteRetentionPolicyCallable(Model::DeleteRetentionPolicyRequest&& request) const;
+
         /**
          * <p> Deletes the retention policy of the specified log group. Log events would
          * not expire if they belong to log groups without a retention policy. </p>
@@ -488,6 +602,11 @@ namespace Model
          */
         virtual void DeleteRetentionPolicyAsync(const Model::DeleteRetentionPolicyRequest& request, const DeleteRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRetentionPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteRetentionPolicyAsync(Model::DeleteRetentionPolicyRequest&& request, const DeleteRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a subscription filter associated with the specified log group. </p>
          */
@@ -500,6 +619,11 @@ namespace Model
          */
         virtual Model::DeleteSubscriptionFilterOutcomeCallable DeleteSubscriptionFilterCallable(const Model::DeleteSubscriptionFilterRequest& request) const;
 
+        /**
+         * Same as DeleteSubscriptionFilterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSubscriptionFilterOutcomeCallable DeleteSubscriptionFilterCallable(Model::DeleteSubscriptionFilterRequest&& request) const;
+
         /**
          * <p> Deletes a subscription filter associated with the specified log group. </p>
          *
@@ -507,6 +631,11 @@ namespace Model
          */
         virtual void DeleteSubscriptionFilterAsync(const Model::DeleteSubscriptionFilterRequest& request, const DeleteSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSubscriptionFilterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSubscriptionFilterAsync(Model::DeleteSubscriptionFilterRequest&& request, const DeleteSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns all the destinations that are associated with the AWS account making
          * the request. The list returned in the response is ASCII-sorted by destination
@@ -531,6 +660,11 @@ namespace Model
          */
         virtual Model::DescribeDestinationsOutcomeCallable DescribeDestinationsCallable(const Model::DescribeDestinationsRequest& request) const;
 
+        /**
+         * Same as DescribeDestinationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDestinationsOutcomeCallable DescribeDestinationsCallable(Model::DescribeDestinationsRequest&& request) const;
+
         /**
          * <p> Returns all the destinations that are associated with the AWS account making
          * the request. The list returned in the response is ASCII-sorted by destination
@@ -544,6 +678,11 @@ namespace Model
          */
         virtual void DescribeDestinationsAsync(const Model::DescribeDestinationsRequest& request, const DescribeDestinationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDestinationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDestinationsAsync(Model::DescribeDestinationsRequest&& request, const DescribeDestinationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns all the export tasks that are associated with the AWS account making
          * the request. The export tasks can be filtered based on <code>TaskId</code> or
@@ -570,6 +709,11 @@ namespace Model
          */
         virtual Model::DescribeExportTasksOutcomeCallable DescribeExportTasksCallable(const Model::DescribeExportTasksRequest& request) const;
 
+        /**
+         * Same as DescribeExportTasksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeExportTasksOutcomeCallable DescribeExportTasksCallable(Model::DescribeExportTasksRequest&& request) const;
+
         /**
          * <p> Returns all the export tasks that are associated with the AWS account making
          * the request. The export tasks can be filtered based on <code>TaskId</code> or
@@ -584,6 +728,11 @@ namespace Model
          */
         virtual void DescribeExportTasksAsync(const Model::DescribeExportTasksRequest& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeExportTasksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeExportTasksAsync(Model::DescribeExportTasksRequest&& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns all the log groups that are associated with the AWS account making
          * the request. The list returned in the response is ASCII-sorted by log group
@@ -608,6 +757,11 @@ namespace Model
          */
         virtual Model::DescribeLogGroupsOutcomeCallable DescribeLogGroupsCallable(const Model::DescribeLogGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeLogGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLogGroupsOutcomeCallable DescribeLogGroupsCallable(Model::DescribeLogGroupsRequest&& request) const;
+
         /**
          * <p> Returns all the log groups that are associated with the AWS account making
          * the request. The list returned in the response is ASCII-sorted by log group
@@ -621,6 +775,11 @@ namespace Model
          */
         virtual void DescribeLogGroupsAsync(const Model::DescribeLogGroupsRequest& request, const DescribeLogGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLogGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLogGroupsAsync(Model::DescribeLogGroupsRequest&& request, const DescribeLogGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns all the log streams that are associated with the specified log
          * group. The list returned in the response is ASCII-sorted by log stream name.
@@ -647,6 +806,11 @@ namespace Model
          */
         virtual Model::DescribeLogStreamsOutcomeCallable DescribeLogStreamsCallable(const Model::DescribeLogStreamsRequest& request) const;
 
+        /**
+         * Same as DescribeLogStreamsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLogStreamsOutcomeCallable DescribeLogStreamsCallable(Model::DescribeLogStreamsRequest&& request) const;
+
         /**
          * <p> Returns all the log streams that are associated with the specified log
          * group. The list returned in the response is ASCII-sorted by log stream name.
@@ -661,6 +825,11 @@ namespace Model
          */
         virtual void DescribeLogStreamsAsync(const Model::DescribeLogStreamsRequest& request, const DescribeLogStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLogStreamsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLogStreamsAsync(Model::DescribeLogStreamsRequest&& request, const DescribeLogStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns all the metrics filters associated with the specified log group. The
          * list returned in the response is ASCII-sorted by filter name. </p> <p> By
@@ -685,6 +854,11 @@ namespace Model
          */
         virtual Model::DescribeMetricFiltersOutcomeCallable DescribeMetricFiltersCallable(const Model::DescribeMetricFiltersRequest& request) const;
 
+        /**
+         * Same as DescribeMetricFiltersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeMetricFiltersOutcomeCallable DescribeMetricFiltersCallable(Model::DescribeMetricFiltersRequest&& request) const;
+
         /**
          * <p> Returns all the metrics filters associated with the specified log group. The
          * list returned in the response is ASCII-sorted by filter name. </p> <p> By
@@ -698,6 +872,11 @@ namespace Model
          */
         virtual void DescribeMetricFiltersAsync(const Model::DescribeMetricFiltersRequest& request, const DescribeMetricFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeMetricFiltersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeMetricFiltersAsync(Model::DescribeMetricFiltersRequest&& request, const DescribeMetricFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns all the subscription filters associated with the specified log
          * group. The list returned in the response is ASCII-sorted by filter name. </p>
@@ -722,6 +901,11 @@ namespace Model
          */
         virtual Model::DescribeSubscriptionFiltersOutcomeCallable DescribeSubscriptionFiltersCallable(const Model::DescribeSubscriptionFiltersRequest& request) const;
 
+        /**
+         * Same as DescribeSubscriptionFiltersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSubscriptionFiltersOutcomeCallable DescribeSubscriptionFiltersCallable(Model::DescribeSubscriptionFiltersRequest&& request) const;
+
         /**
          * <p> Returns all the subscription filters associated with the specified log
          * group. The list returned in the response is ASCII-sorted by filter name. </p>
@@ -735,6 +919,11 @@ namespace Model
          */
         virtual void DescribeSubscriptionFiltersAsync(const Model::DescribeSubscriptionFiltersRequest& request, const DescribeSubscriptionFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSubscriptionFiltersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSubscriptionFiltersAsync(Model::DescribeSubscriptionFiltersRequest&& request, const DescribeSubscriptionFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Retrieves log events, optionally filtered by a filter pattern from the
          * specified log group. You can provide an optional time range to filter the
@@ -775,6 +964,11 @@ namespace Model
          */
         virtual Model::FilterLogEventsOutcomeCallable FilterLogEventsCallable(const Model::FilterLogEventsRequest& request) const;
 
+        /**
+         * Same as FilterLogEventsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::FilterLogEventsOutcomeCallable FilterLogEventsCallable(Model::FilterLogEventsRequest&& request) const;
+
         /**
          * <p> Retrieves log events, optionally filtered by a filter pattern from the
          * specified log group. You can provide an optional time range to filter the
@@ -796,6 +990,11 @@ namespace Model
          */
         virtual void FilterLogEventsAsync(const Model::FilterLogEventsRequest& request, const FilterLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as FilterLogEventsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void FilterLogEventsAsync(Model::FilterLogEventsRequest&& request, const FilterLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Retrieves log events from the specified log stream. You can provide an
          * optional time range to filter the results on the event <code
@@ -826,6 +1025,11 @@ namespace Model
          */
         virtual Model::GetLogEventsOutcomeCallable GetLogEventsCallable(const Model::GetLogEventsRequest& request) const;
 
+        /**
+         * Same as GetLogEventsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetLogEventsOutcomeCallable GetLogEventsCallable(Model::GetLogEventsRequest&& request) const;
+
         /**
          * <p> Retrieves log events from the specified log stream. You can provide an
          * optional time range to filter the results on the event <code
@@ -842,6 +1046,11 @@ namespace Model
          */
         virtual void GetLogEventsAsync(const Model::GetLogEventsRequest& request, const GetLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetLogEventsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetLogEventsAsync(Model::GetLogEventsRequest&& request, const GetLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates or updates a <code>Destination</code>. A destination encapsulates a
          * physical resource (such as a Kinesis stream) and allows you to subscribe to a
@@ -874,6 +1083,11 @@ namespace Model
          */
         virtual Model::PutDestinationOutcomeCallable PutDestinationCallable(const Model::PutDestinationRequest& request) const;
 
+        /**
+         * Same as PutDestinationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutDestinationOutcomeCallable PutDestinationCallable(Model::PutDestinationRequest&& request) const;
+
         /**
          * <p> Creates or updates a <code>Destination</code>. A destination encapsulates a
          * physical resource (such as a Kinesis stream) and allows you to subscribe to a
@@ -891,6 +1105,11 @@ namespace Model
          */
         virtual void PutDestinationAsync(const Model::PutDestinationRequest& request, const PutDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutDestinationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutDestinationAsync(Model::PutDestinationRequest&& request, const PutDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates or updates an access policy associated with an existing
          * <code>Destination</code>. An access policy is an <a
@@ -911,6 +1130,11 @@ namespace Model
          */
         virtual Model::PutDestinationPolicyOutcomeCallable PutDestinationPolicyCallable(const Model::PutDestinationPolicyRequest& request) const;
 
+        /**
+         * Same as PutDestinationPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutDestinationPolicyOutcomeCallable PutDestinationPolicyCallable(Model::PutDestinationPolicyRequest&& request) const;
+
         /**
          * <p> Creates or updates an access policy associated with an existing
          * <code>Destination</code>. An access policy is an <a
@@ -922,6 +1146,11 @@ namespace Model
          */
         virtual void PutDestinationPolicyAsync(const Model::PutDestinationPolicyRequest& request, const PutDestinationPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutDestinationPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutDestinationPolicyAsync(Model::PutDestinationPolicyRequest&& request, const PutDestinationPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Uploads a batch of log events to the specified log stream. </p> <p> Every
          * PutLogEvents request must include the <code class="code">sequenceToken</code>
@@ -960,6 +1189,11 @@ namespace Model
          */
         virtual Model::PutLogEventsOutcomeCallable PutLogEventsCallable(const Model::PutLogEventsRequest& request) const;
 
+        /**
+         * Same as PutLogEventsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutLogEventsOutcomeCallable PutLogEventsCallable(Model::PutLogEventsRequest&& request) const;
+
         /**
          * <p> Uploads a batch of log events to the specified log stream. </p> <p> Every
          * PutLogEvents request must include the <code class="code">sequenceToken</code>
@@ -980,6 +1214,11 @@ namespace Model
          */
         virtual void PutLogEventsAsync(const Model::PutLogEventsRequest& request, const PutLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutLogEventsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutLogEventsAsync(Model::PutLogEventsRequest&& request, const PutLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates or updates a metric filter and associates it with the specified log
          * group. Metric filters allow you to configure rules to extract metric data from
@@ -1000,6 +1239,11 @@ namespace Model
          */
         virtual Model::PutMetricFilterOutcomeCallable PutMetricFilterCallable(const Model::PutMetricFilterRequest& request) const;
 
+        /**
+         * Same as PutMetricFilterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutMetricFilterOutcomeCallable PutMetricFilterCallable(Model::PutMetricFilterRequest&& request) const;
+
         /**
          * <p> Creates or updates a metric filter and associates it with the specified log
          * group. Metric filters allow you to configure rules to extract metric data from
@@ -1011,6 +1255,11 @@ namespace Model
          */
         virtual void PutMetricFilterAsync(const Model::PutMetricFilterRequest& request, const PutMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutMetricFilterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutMetricFilterAsync(Model::PutMetricFilterRequest&& request, const PutMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Sets the retention of the specified log group. A retention policy allows you
          * to configure the number of days you want to retain log events in the specified
@@ -1027,6 +1276,11 @@ namespace Model
          */
         virtual Model::PutRetentionPolicyOutcomeCallable PutRetentionPolicyCallable(const Model::PutRetentionPolicyRequest& request) const;
 
+        /**
+         * Same as PutRetentionPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutRetentionPolicyOutcomeCallable PutRetentionPolicyCallable(Model::PutRetentionPolicyRequest&& request) const;
+
         /**
          * <p> Sets the retention of the specified log group. A retention policy allows you
          * to configure the number of days you want to retain log events in the specified
@@ -1036,6 +1290,11 @@ namespace Model
          */
         virtual void PutRetentionPolicyAsync(const Model::PutRetentionPolicyRequest& request, const PutRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutRetentionPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutRetentionPolicyAsync(Model::PutRetentionPolicyRequest&& request, const PutRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates or updates a subscription filter and associates it with the
          * specified log group. Subscription filters allow you to subscribe to a real-time
@@ -1072,6 +1331,11 @@ namespace Model
          */
         virtual Model::PutSubscriptionFilterOutcomeCallable PutSubscriptionFilterCallable(const Model::PutSubscriptionFilterRequest& request) const;
 
+        /**
+         * Same as PutSubscriptionFilterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutSubscriptionFilterOutcomeCallable PutSubscriptionFilterCallable(Model::PutSubscriptionFilterRequest&& request) const;
+
         /**
          * <p> Creates or updates a subscription filter and associates it with the
          * specified log group. Subscription filters allow you to subscribe to a real-time
@@ -1091,6 +1355,11 @@ namespace Model
          */
         virtual void PutSubscriptionFilterAsync(const Model::PutSubscriptionFilterRequest& request, const PutSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutSubscriptionFilterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutSubscriptionFilterAsync(Model::PutSubscriptionFilterRequest&& request, const PutSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Tests the filter pattern of a metric filter against a sample of log event
          * messages. You can use this operation to validate the correctness of a metric
@@ -1107,6 +1376,11 @@ namespace Model
          */
         virtual Model::TestMetricFilterOutcomeCallable TestMetricFilterCallable(const Model::TestMetricFilterRequest& request) const;
 
+        /**
+         * Same as TestMetricFilterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::TestMetricFilterOutcomeCallable TestMetricFilterCallable(Model::TestMetricFilterRequest&& request) const;
+
         /**
          * <p> Tests the filter pattern of a metric filter against a sample of log event
          * messages. You can use this operation to validate the correctness of a metric
@@ -1116,6 +1390,68 @@ namespace Model
          */
         virtual void TestMetricFilterAsync(const Model::TestMetricFilterRequest& request, const TestMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TestMetricFilterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void TestMetricFilterAsync(Model::TestMetricFilterRequest&& request, const TestMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelExportTaskOutcome> CancelExportTaskAwaitable(const Model::CancelExportTaskRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::CancelExportTask, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelExportTaskOutcome> CancelExportTaskAwaitable(Model::CancelExportTaskRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::CancelExportTask, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateExportTaskOutcome> CreateExportTaskAwaitable(const Model::CreateExportTaskRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::CreateExportTask, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateExportTaskOutcome> CreateExportTaskAwaitable(Model::CreateExportTaskRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::CreateExportTask, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLogGroupOutcome> CreateLogGroupAwaitable(const Model::CreateLogGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::CreateLogGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLogGroupOutcome> CreateLogGroupAwaitable(Model::CreateLogGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::CreateLogGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLogStreamOutcome> CreateLogStreamAwaitable(const Model::CreateLogStreamRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::CreateLogStream, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLogStreamOutcome> CreateLogStreamAwaitable(Model::CreateLogStreamRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::CreateLogStream, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDestinationOutcome> DeleteDestinationAwaitable(const Model::DeleteDestinationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DeleteDestination, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDestinationOutcome> DeleteDestinationAwaitable(Model::DeleteDestinationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DeleteDestination, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLogGroupOutcome> DeleteLogGroupAwaitable(const Model::DeleteLogGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DeleteLogGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLogGroupOutcome> DeleteLogGroupAwaitable(Model::DeleteLogGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DeleteLogGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLogStreamOutcome> DeleteLogStreamAwaitable(const Model::DeleteLogStreamRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DeleteLogStream, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLogStreamOutcome> DeleteLogStreamAwaitable(Model::DeleteLogStreamRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DeleteLogStream, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteMetricFilterOutcome> DeleteMetricFilterAwaitable(const Model::DeleteMetricFilterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DeleteMetricFilter, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteMetricFilterOutcome> DeleteMetricFilterAwaitable(Model::DeleteMetricFilterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DeleteMetricFilter, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRetentionPolicyOutcome> DeleteRetentionPolicyAwaitable(const Model::DeleteRetentionPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DeleteRetentionPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRetentionPolicyOutcome> DeleteRetentionPolicyAwaitable(Model::DeleteRetentionPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DeleteRetentionPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSubscriptionFilterOutcome> DeleteSubscriptionFilterAwaitable(const Model::DeleteSubscriptionFilterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DeleteSubscriptionFilter, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSubscriptionFilterOutcome> DeleteSubscriptionFilterAwaitable(Model::DeleteSubscriptionFilterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DeleteSubscriptionFilter, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDestinationsOutcome> DescribeDestinationsAwaitable(const Model::DescribeDestinationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DescribeDestinations, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDestinationsOutcome> DescribeDestinationsAwaitable(Model::DescribeDestinationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DescribeDestinations, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeExportTasksOutcome> DescribeExportTasksAwaitable(const Model::DescribeExportTasksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DescribeExportTasks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeExportTasksOutcome> DescribeExportTasksAwaitable(Model::DescribeExportTasksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DescribeExportTasks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLogGroupsOutcome> DescribeLogGroupsAwaitable(const Model::DescribeLogGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DescribeLogGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLogGroupsOutcome> DescribeLogGroupsAwaitable(Model::DescribeLogGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DescribeLogGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLogStreamsOutcome> DescribeLogStreamsAwaitable(const Model::DescribeLogStreamsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DescribeLogStreams, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLogStreamsOutcome> DescribeLogStreamsAwaitable(Model::DescribeLogStreamsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DescribeLogStreams, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMetricFiltersOutcome> DescribeMetricFiltersAwaitable(const Model::DescribeMetricFiltersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DescribeMetricFilters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMetricFiltersOutcome> DescribeMetricFiltersAwaitable(Model::DescribeMetricFiltersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DescribeMetricFilters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSubscriptionFiltersOutcome> DescribeSubscriptionFiltersAwaitable(const Model::DescribeSubscriptionFiltersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DescribeSubscriptionFilters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSubscriptionFiltersOutcome> DescribeSubscriptionFiltersAwaitable(Model::DescribeSubscriptionFiltersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::DescribeSubscriptionFilters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::FilterLogEventsOutcome> FilterLogEventsAwaitable(const Model::FilterLogEventsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::FilterLogEvents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::FilterLogEventsOutcome> FilterLogEventsAwaitable(Model::FilterLogEventsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::FilterLogEvents, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetLogEventsOutcome> GetLogEventsAwaitable(const Model::GetLogEventsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::GetLogEvents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetLogEventsOutcome> GetLogEventsAwaitable(Model::GetLogEventsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::GetLogEvents, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutDestinationOutcome> PutDestinationAwaitable(const Model::PutDestinationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::PutDestination, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutDestinationOutcome> PutDestinationAwaitable(Model::PutDestinationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::PutDestination, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutDestinationPolicyOutcome> PutDestinationPolicyAwaitable(const Model::PutDestinationPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::PutDestinationPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutDestinationPolicyOutcome> PutDestinationPolicyAwaitable(Model::PutDestinationPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::PutDestinationPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutLogEventsOutcome> PutLogEventsAwaitable(const Model::PutLogEventsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::PutLogEvents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutLogEventsOutcome> PutLogEventsAwaitable(Model::PutLogEventsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::PutLogEvents, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutMetricFilterOutcome> PutMetricFilterAwaitable(const Model::PutMetricFilterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::PutMetricFilter, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutMetricFilterOutcome> PutMetricFilterAwaitable(Model::PutMetricFilterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::PutMetricFilter, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRetentionPolicyOutcome> PutRetentionPolicyAwaitable(const Model::PutRetentionPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::PutRetentionPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutRetentionPolicyOutcome> PutRetentionPolicyAwaitable(Model::PutRetentionPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::PutRetentionPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutSubscriptionFilterOutcome> PutSubscriptionFilterAwaitable(const Model::PutSubscriptionFilterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::PutSubscriptionFilter, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutSubscriptionFilterOutcome> PutSubscriptionFilterAwaitable(Model::PutSubscriptionFilterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::PutSubscriptionFilter, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TestMetricFilterOutcome> TestMetricFilterAwaitable(const Model::TestMetricFilterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::TestMetricFilter, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TestMetricFilterOutcome> TestMetricFilterAwaitable(Model::TestMetricFilterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchLogsClient::TestMetricFilter, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -132,12 +132,22 @@ CancelExportTaskOutcome CloudWatchLogsClient::CancelExportTask(const CancelExpor
 
 CancelExportTaskOutcomeCallable CloudWatchLogsClient::CancelExportTaskCallable(const CancelExportTaskRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::CancelExportTask, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::CancelExportTask, Aws::Client::RejectedCallOutcome<CancelExportTaskOutcome>(), this, request);
+}
+
+CancelExportTaskOutcomeCallable CloudWatchLogsClient::CancelExportTaskCallable(CancelExportTaskRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::CancelExportTask, Aws::Client::RejectedCallOutcome<CancelExportTaskOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::CancelExportTaskAsync(const CancelExportTaskRequest& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::CancelExportTaskAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::CancelExportTaskAsyncHelper, Aws::Client::RejectedAsyncCall<CancelExportTaskOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::CancelExportTaskAsync(CancelExportTaskRequest&& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::CancelExportTaskAsyncHelper, Aws::Client::RejectedAsyncCall<CancelExportTaskOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::CancelExportTaskAsyncHelper(const CancelExportTaskRequest& request, const CancelExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -163,12 +173,22 @@ CreateExportTaskOutcome CloudWatchLogsClient::CreateExportTask(const CreateExpor
 
 CreateExportTaskOutcomeCallable CloudWatchLogsClient::CreateExportTaskCallable(const CreateExportTaskRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::CreateExportTask, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::CreateExportTask, Aws::Client::RejectedCallOutcome<CreateExportTaskOutcome>(), this, request);
+}
+
+CreateExportTaskOutcomeCallable CloudWatchLogsClient::CreateExportTaskCallable(CreateExportTaskRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::CreateExportTask, Aws::Client::RejectedCallOutcome<CreateExportTaskOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::CreateExportTaskAsync(const CreateExportTaskRequest& request, const CreateExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::CreateExportTaskAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::CreateExportTaskAsyncHelper, Aws::Client::RejectedAsyncCall<CreateExportTaskOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::CreateExportTaskAsync(CreateExportTaskRequest&& request, const CreateExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::CreateExportTaskAsyncHelper, Aws::Client::RejectedAsyncCall<CreateExportTaskOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::CreateExportTaskAsyncHelper(const CreateExportTaskRequest& request, const CreateExportTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -194,12 +214,22 @@ CreateLogGroupOutcome CloudWatchLogsClient::CreateLogGroup(const CreateLogGroupR
 
 CreateLogGroupOutcomeCallable CloudWatchLogsClient::CreateLogGroupCallable(const CreateLogGroupRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::CreateLogGroup, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::CreateLogGroup, Aws::Client::RejectedCallOutcome<CreateLogGroupOutcome>(), this, request);
+}
+
+CreateLogGroupOutcomeCallable CloudWatchLogsClient::CreateLogGroupCallable(CreateLogGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::CreateLogGroup, Aws::Client::RejectedCallOutcome<CreateLogGroupOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::CreateLogGroupAsync(const CreateLogGroupRequest& request, const CreateLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::CreateLogGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::CreateLogGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLogGroupOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::CreateLogGroupAsync(CreateLogGroupRequest&& request, const CreateLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::CreateLogGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLogGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::CreateLogGroupAsyncHelper(const CreateLogGroupRequest& request, const CreateLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -225,12 +255,22 @@ CreateLogStreamOutcome CloudWatchLogsClient::CreateLogStream(const CreateLogStre
 
 CreateLogStreamOutcomeCallable CloudWatchLogsClient::CreateLogStreamCallable(const CreateLogStreamRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::CreateLogStream, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::CreateLogStream, Aws::Client::RejectedCallOutcome<CreateLogStreamOutcome>(), this, request);
+}
+
+CreateLogStreamOutcomeCallable CloudWatchLogsClient::CreateLogStreamCallable(CreateLogStreamRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::CreateLogStream, Aws::Client::RejectedCallOutcome<CreateLogStreamOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::CreateLogStreamAsync(const CreateLogStreamRequest& request, const CreateLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::CreateLogStreamAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::CreateLogStreamAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLogStreamOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::CreateLogStreamAsync(CreateLogStreamRequest&& request, const CreateLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::CreateLogStreamAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLogStreamOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::CreateLogStreamAsyncHelper(const CreateLogStreamRequest& request, const CreateLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -256,12 +296,22 @@ DeleteDestinationOutcome CloudWatchLogsClient::DeleteDestination(const DeleteDes
 
 DeleteDestinationOutcomeCallable CloudWatchLogsClient::DeleteDestinationCallable(const DeleteDestinationRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::DeleteDestination, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DeleteDestination, Aws::Client::RejectedCallOutcome<DeleteDestinationOutcome>(), this, request);
+}
+
+DeleteDestinationOutcomeCallable CloudWatchLogsClient::DeleteDestinationCallable(DeleteDestinationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DeleteDestination, Aws::Client::RejectedCallOutcome<DeleteDestinationOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::DeleteDestinationAsync(const DeleteDestinationRequest& request, const DeleteDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::DeleteDestinationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DeleteDestinationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDestinationOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::DeleteDestinationAsync(DeleteDestinationRequest&& request, const DeleteDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DeleteDestinationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDestinationOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::DeleteDestinationAsyncHelper(const DeleteDestinationRequest& request, const DeleteDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -287,12 +337,22 @@ DeleteLogGroupOutcome CloudWatchLogsClient::DeleteLogGroup(const DeleteLogGroupR
 
 DeleteLogGroupOutcomeCallable CloudWatchLogsClient::DeleteLogGroupCallable(const DeleteLogGroupRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::DeleteLogGroup, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DeleteLogGroup, Aws::Client::RejectedCallOutcome<DeleteLogGroupOutcome>(), this, request);
+}
+
+DeleteLogGroupOutcomeCallable CloudWatchLogsClient::DeleteLogGroupCallable(DeleteLogGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DeleteLogGroup, Aws::Client::RejectedCallOutcome<DeleteLogGroupOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::DeleteLogGroupAsync(const DeleteLogGroupRequest& request, const DeleteLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::DeleteLogGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DeleteLogGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLogGroupOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::DeleteLogGroupAsync(DeleteLogGroupRequest&& request, const DeleteLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DeleteLogGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLogGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::DeleteLogGroupAsyncHelper(const DeleteLogGroupRequest& request, const DeleteLogGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -318,12 +378,22 @@ DeleteLogStreamOutcome CloudWatchLogsClient::DeleteLogStream(const DeleteLogStre
 
 DeleteLogStreamOutcomeCallable CloudWatchLogsClient::DeleteLogStreamCallable(const DeleteLogStreamRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::DeleteLogStream, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DeleteLogStream, Aws::Client::RejectedCallOutcome<DeleteLogStreamOutcome>(), this, request);
+}
+
+DeleteLogStreamOutcomeCallable CloudWatchLogsClient::DeleteLogStreamCallable(DeleteLogStreamRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DeleteLogStream, Aws::Client::RejectedCallOutcome<DeleteLogStreamOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::DeleteLogStreamAsync(const DeleteLogStreamRequest& request, const DeleteLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::DeleteLogStreamAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DeleteLogStreamAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLogStreamOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::DeleteLogStreamAsync(DeleteLogStreamRequest&& request, const DeleteLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DeleteLogStreamAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLogStreamOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::DeleteLogStreamAsyncHelper(const DeleteLogStreamRequest& request, const DeleteLogStreamResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -349,12 +419,22 @@ DeleteMetricFilterOutcome CloudWatchLogsClient::DeleteMetricFilter(const DeleteM
 
 DeleteMetricFilterOutcomeCallable CloudWatchLogsClient::DeleteMetricFilterCallable(const DeleteMetricFilterRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::DeleteMetricFilter, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DeleteMetricFilter, Aws::Client::RejectedCallOutcome<DeleteMetricFilterOutcome>(), this, request);
+}
+
+DeleteMetricFilterOutcomeCallable CloudWatchLogsClient::DeleteMetricFilterCallable(DeleteMetricFilterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DeleteMetricFilter, Aws::Client::RejectedCallOutcome<DeleteMetricFilterOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::DeleteMetricFilterAsync(const DeleteMetricFilterRequest& request, const DeleteMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::DeleteMetricFilterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DeleteMetricFilterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteMetricFilterOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::DeleteMetricFilterAsync(DeleteMetricFilterRequest&& request, const DeleteMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DeleteMetricFilterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteMetricFilterOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::DeleteMetricFilterAsyncHelper(const DeleteMetricFilterRequest& request, const DeleteMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -380,12 +460,22 @@ DeleteRetentionPolicyOutcome CloudWatchLogsClient::DeleteRetentionPolicy(const D
 
 DeleteRetentionPolicyOutcomeCallable CloudWatchLogsClient::DeleteRetentionPolicyCallable(const DeleteRetentionPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::DeleteRetentionPolicy, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DeleteRetentionPolicy, Aws::Client::RejectedCallOutcome<DeleteRetentionPolicyOutcome>(), this, request);
+}
+
+DeleteRetentionPolicyOutcomeCallable CloudWatchLogsClient::DeleteRetentionPolicyCallable(DeleteRetentionPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DeleteRetentionPolicy, Aws::Client::RejectedCallOutcome<DeleteRetentionPolicyOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::DeleteRetentionPolicyAsync(const DeleteRetentionPolicyRequest& request, const DeleteRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::DeleteRetentionPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DeleteRetentionPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRetentionPolicyOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::DeleteRetentionPolicyAsync(DeleteRetentionPolicyRequest&& request, const DeleteRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DeleteRetentionPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRetentionPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::DeleteRetentionPolicyAsyncHelper(const DeleteRetentionPolicyRequest& request, const DeleteRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -411,12 +501,22 @@ DeleteSubscriptionFilterOutcome CloudWatchLogsClient::DeleteSubscriptionFilter(c
 
 DeleteSubscriptionFilterOutcomeCallable CloudWatchLogsClient::DeleteSubscriptionFilterCallable(const DeleteSubscriptionFilterRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::DeleteSubscriptionFilter, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DeleteSubscriptionFilter, Aws::Client::RejectedCallOutcome<DeleteSubscriptionFilterOutcome>(), this, request);
+}
+
+DeleteSubscriptionFilterOutcomeCallable CloudWatchLogsClient::DeleteSubscriptionFilterCallable(DeleteSubscriptionFilterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DeleteSubscriptionFilter, Aws::Client::RejectedCallOutcome<DeleteSubscriptionFilterOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::DeleteSubscriptionFilterAsync(const DeleteSubscriptionFilterRequest& request, const DeleteSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::DeleteSubscriptionFilterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DeleteSubscriptionFilterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSubscriptionFilterOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::DeleteSubscriptionFilterAsync(DeleteSubscriptionFilterRequest&& request, const DeleteSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DeleteSubscriptionFilterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSubscriptionFilterOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::DeleteSubscriptionFilterAsyncHelper(const DeleteSubscriptionFilterRequest& request, const DeleteSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -442,12 +542,22 @@ DescribeDestinationsOutcome CloudWatchLogsClient::DescribeDestinations(const Des
 
 DescribeDestinationsOutcomeCallable CloudWatchLogsClient::DescribeDestinationsCallable(const DescribeDestinationsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::DescribeDestinations, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DescribeDestinations, Aws::Client::RejectedCallOutcome<DescribeDestinationsOutcome>(), this, request);
+}
+
+DescribeDestinationsOutcomeCallable CloudWatchLogsClient::DescribeDestinationsCallable(DescribeDestinationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DescribeDestinations, Aws::Client::RejectedCallOutcome<DescribeDestinationsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::DescribeDestinationsAsync(const DescribeDestinationsRequest& request, const DescribeDestinationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::DescribeDestinationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DescribeDestinationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDestinationsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::DescribeDestinationsAsync(DescribeDestinationsRequest&& request, const DescribeDestinationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DescribeDestinationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDestinationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::DescribeDestinationsAsyncHelper(const DescribeDestinationsRequest& request, const DescribeDestinationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -473,12 +583,22 @@ DescribeExportTasksOutcome CloudWatchLogsClient::DescribeExportTasks(const Descr
 
 DescribeExportTasksOutcomeCallable CloudWatchLogsClient::DescribeExportTasksCallable(const DescribeExportTasksRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::DescribeExportTasks, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DescribeExportTasks, Aws::Client::RejectedCallOutcome<DescribeExportTasksOutcome>(), this, request);
+}
+
+DescribeExportTasksOutcomeCallable CloudWatchLogsClient::DescribeExportTasksCallable(DescribeExportTasksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DescribeExportTasks, Aws::Client::RejectedCallOutcome<DescribeExportTasksOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::DescribeExportTasksAsync(const DescribeExportTasksRequest& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::DescribeExportTasksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DescribeExportTasksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeExportTasksOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::DescribeExportTasksAsync(DescribeExportTasksRequest&& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DescribeExportTasksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeExportTasksOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::DescribeExportTasksAsyncHelper(const DescribeExportTasksRequest& request, const DescribeExportTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -504,12 +624,22 @@ DescribeLogGroupsOutcome CloudWatchLogsClient::DescribeLogGroups(const DescribeL
 
 DescribeLogGroupsOutcomeCallable CloudWatchLogsClient::DescribeLogGroupsCallable(const DescribeLogGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::DescribeLogGroups, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DescribeLogGroups, Aws::Client::RejectedCallOutcome<DescribeLogGroupsOutcome>(), this, request);
+}
+
+DescribeLogGroupsOutcomeCallable CloudWatchLogsClient::DescribeLogGroupsCallable(DescribeLogGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DescribeLogGroups, Aws::Client::RejectedCallOutcome<DescribeLogGroupsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::DescribeLogGroupsAsync(const DescribeLogGroupsRequest& request, const DescribeLogGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::DescribeLogGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DescribeLogGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLogGroupsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::DescribeLogGroupsAsync(DescribeLogGroupsRequest&& request, const DescribeLogGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DescribeLogGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLogGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::DescribeLogGroupsAsyncHelper(const DescribeLogGroupsRequest& request, const DescribeLogGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -535,12 +665,22 @@ DescribeLogStreamsOutcome CloudWatchLogsClient::DescribeLogStreams(const Describ
 
 DescribeLogStreamsOutcomeCallable CloudWatchLogsClient::DescribeLogStreamsCallable(const DescribeLogStreamsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::DescribeLogStreams, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DescribeLogStreams, Aws::Client::RejectedCallOutcome<DescribeLogStreamsOutcome>(), this, request);
+}
+
+DescribeLogStreamsOutcomeCallable CloudWatchLogsClient::DescribeLogStreamsCallable(DescribeLogStreamsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DescribeLogStreams, Aws::Client::RejectedCallOutcome<DescribeLogStreamsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::DescribeLogStreamsAsync(const DescribeLogStreamsRequest& request, const DescribeLogStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::DescribeLogStreamsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DescribeLogStreamsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLogStreamsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::DescribeLogStreamsAsync(DescribeLogStreamsRequest&& request, const DescribeLogStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DescribeLogStreamsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLogStreamsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::DescribeLogStreamsAsyncHelper(const DescribeLogStreamsRequest& request, const DescribeLogStreamsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -566,12 +706,22 @@ DescribeMetricFiltersOutcome CloudWatchLogsClient::DescribeMetricFilters(const D
 
 DescribeMetricFiltersOutcomeCallable CloudWatchLogsClient::DescribeMetricFiltersCallable(const DescribeMetricFiltersRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::DescribeMetricFilters, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DescribeMetricFilters, Aws::Client::RejectedCallOutcome<DescribeMetricFiltersOutcome>(), this, request);
+}
+
+DescribeMetricFiltersOutcomeCallable CloudWatchLogsClient::DescribeMetricFiltersCallable(DescribeMetricFiltersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DescribeMetricFilters, Aws::Client::RejectedCallOutcome<DescribeMetricFiltersOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::DescribeMetricFiltersAsync(const DescribeMetricFiltersRequest& request, const DescribeMetricFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::DescribeMetricFiltersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DescribeMetricFiltersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMetricFiltersOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::DescribeMetricFiltersAsync(DescribeMetricFiltersRequest&& request, const DescribeMetricFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DescribeMetricFiltersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMetricFiltersOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::DescribeMetricFiltersAsyncHelper(const DescribeMetricFiltersRequest& request, const DescribeMetricFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -597,12 +747,22 @@ DescribeSubscriptionFiltersOutcome CloudWatchLogsClient::DescribeSubscriptionFil
 
 DescribeSubscriptionFiltersOutcomeCallable CloudWatchLogsClient::DescribeSubscriptionFiltersCallable(const DescribeSubscriptionFiltersRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::DescribeSubscriptionFilters, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DescribeSubscriptionFilters, Aws::Client::RejectedCallOutcome<DescribeSubscriptionFiltersOutcome>(), this, request);
+}
+
+DescribeSubscriptionFiltersOutcomeCallable CloudWatchLogsClient::DescribeSubscriptionFiltersCallable(DescribeSubscriptionFiltersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::DescribeSubscriptionFilters, Aws::Client::RejectedCallOutcome<DescribeSubscriptionFiltersOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::DescribeSubscriptionFiltersAsync(const DescribeSubscriptionFiltersRequest& request, const DescribeSubscriptionFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::DescribeSubscriptionFiltersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DescribeSubscriptionFiltersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSubscriptionFiltersOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::DescribeSubscriptionFiltersAsync(DescribeSubscriptionFiltersRequest&& request, const DescribeSubscriptionFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::DescribeSubscriptionFiltersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSubscriptionFiltersOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::DescribeSubscriptionFiltersAsyncHelper(const DescribeSubscriptionFiltersRequest& request, const DescribeSubscriptionFiltersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -628,12 +788,22 @@ FilterLogEventsOutcome CloudWatchLogsClient::FilterLogEvents(const FilterLogEven
 
 FilterLogEventsOutcomeCallable CloudWatchLogsClient::FilterLogEventsCallable(const FilterLogEventsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::FilterLogEvents, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::FilterLogEvents, Aws::Client::RejectedCallOutcome<FilterLogEventsOutcome>(), this, request);
+}
+
+FilterLogEventsOutcomeCallable CloudWatchLogsClient::FilterLogEventsCallable(FilterLogEventsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::FilterLogEvents, Aws::Client::RejectedCallOutcome<FilterLogEventsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::FilterLogEventsAsync(const FilterLogEventsRequest& request, const FilterLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::FilterLogEventsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::FilterLogEventsAsyncHelper, Aws::Client::RejectedAsyncCall<FilterLogEventsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::FilterLogEventsAsync(FilterLogEventsRequest&& request, const FilterLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::FilterLogEventsAsyncHelper, Aws::Client::RejectedAsyncCall<FilterLogEventsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::FilterLogEventsAsyncHelper(const FilterLogEventsRequest& request, const FilterLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -659,12 +829,22 @@ GetLogEventsOutcome CloudWatchLogsClient::GetLogEvents(const GetLogEventsRequest
 
 GetLogEventsOutcomeCallable CloudWatchLogsClient::GetLogEventsCallable(const GetLogEventsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::GetLogEvents, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::GetLogEvents, Aws::Client::RejectedCallOutcome<GetLogEventsOutcome>(), this, request);
+}
+
+GetLogEventsOutcomeCallable CloudWatchLogsClient::GetLogEventsCallable(GetLogEventsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::GetLogEvents, Aws::Client::RejectedCallOutcome<GetLogEventsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::GetLogEventsAsync(const GetLogEventsRequest& request, const GetLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::GetLogEventsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::GetLogEventsAsyncHelper, Aws::Client::RejectedAsyncCall<GetLogEventsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::GetLogEventsAsync(GetLogEventsRequest&& request, const GetLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::GetLogEventsAsyncHelper, Aws::Client::RejectedAsyncCall<GetLogEventsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::GetLogEventsAsyncHelper(const GetLogEventsRequest& request, const GetLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -690,12 +870,22 @@ PutDestinationOutcome CloudWatchLogsClient::PutDestination(const PutDestinationR
 
 PutDestinationOutcomeCallable CloudWatchLogsClient::PutDestinationCallable(const PutDestinationRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::PutDestination, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::PutDestination, Aws::Client::RejectedCallOutcome<PutDestinationOutcome>(), this, request);
+}
+
+PutDestinationOutcomeCallable CloudWatchLogsClient::PutDestinationCallable(PutDestinationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::PutDestination, Aws::Client::RejectedCallOutcome<PutDestinationOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::PutDestinationAsync(const PutDestinationRequest& request, const PutDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::PutDestinationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::PutDestinationAsyncHelper, Aws::Client::RejectedAsyncCall<PutDestinationOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::PutDestinationAsync(PutDestinationRequest&& request, const PutDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::PutDestinationAsyncHelper, Aws::Client::RejectedAsyncCall<PutDestinationOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::PutDestinationAsyncHelper(const PutDestinationRequest& request, const PutDestinationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -721,12 +911,22 @@ PutDestinationPolicyOutcome CloudWatchLogsClient::PutDestinationPolicy(const Put
 
 PutDestinationPolicyOutcomeCallable CloudWatchLogsClient::PutDestinationPolicyCallable(const PutDestinationPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::PutDestinationPolicy, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::PutDestinationPolicy, Aws::Client::RejectedCallOutcome<PutDestinationPolicyOutcome>(), this, request);
+}
+
+PutDestinationPolicyOutcomeCallable CloudWatchLogsClient::PutDestinationPolicyCallable(PutDestinationPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::PutDestinationPolicy, Aws::Client::RejectedCallOutcome<PutDestinationPolicyOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::PutDestinationPolicyAsync(const PutDestinationPolicyRequest& request, const PutDestinationPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::PutDestinationPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::PutDestinationPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutDestinationPolicyOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::PutDestinationPolicyAsync(PutDestinationPolicyRequest&& request, const PutDestinationPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::PutDestinationPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutDestinationPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::PutDestinationPolicyAsyncHelper(const PutDestinationPolicyRequest& request, const PutDestinationPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -752,12 +952,22 @@ PutLogEventsOutcome CloudWatchLogsClient::PutLogEvents(const PutLogEventsRequest
 
 PutLogEventsOutcomeCallable CloudWatchLogsClient::PutLogEventsCallable(const PutLogEventsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::PutLogEvents, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::PutLogEvents, Aws::Client::RejectedCallOutcome<PutLogEventsOutcome>(), this, request);
+}
+
+PutLogEventsOutcomeCallable CloudWatchLogsClient::PutLogEventsCallable(PutLogEventsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::PutLogEvents, Aws::Client::RejectedCallOutcome<PutLogEventsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::PutLogEventsAsync(const PutLogEventsRequest& request, const PutLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::PutLogEventsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::PutLogEventsAsyncHelper, Aws::Client::RejectedAsyncCall<PutLogEventsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::PutLogEventsAsync(PutLogEventsRequest&& request, const PutLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::PutLogEventsAsyncHelper, Aws::Client::RejectedAsyncCall<PutLogEventsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::PutLogEventsAsyncHelper(const PutLogEventsRequest& request, const PutLogEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -783,12 +993,22 @@ PutMetricFilterOutcome CloudWatchLogsClient::PutMetricFilter(const PutMetricFilt
 
 PutMetricFilterOutcomeCallable CloudWatchLogsClient::PutMetricFilterCallable(const PutMetricFilterRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::PutMetricFilter, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::PutMetricFilter, Aws::Client::RejectedCallOutcome<PutMetricFilterOutcome>(), this, request);
+}
+
+PutMetricFilterOutcomeCallable CloudWatchLogsClient::PutMetricFilterCallable(PutMetricFilterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::PutMetricFilter, Aws::Client::RejectedCallOutcome<PutMetricFilterOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::PutMetricFilterAsync(const PutMetricFilterRequest& request, const PutMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::PutMetricFilterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::PutMetricFilterAsyncHelper, Aws::Client::RejectedAsyncCall<PutMetricFilterOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::PutMetricFilterAsync(PutMetricFilterRequest&& request, const PutMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::PutMetricFilterAsyncHelper, Aws::Client::RejectedAsyncCall<PutMetricFilterOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::PutMetricFilterAsyncHelper(const PutMetricFilterRequest& request, const PutMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -814,12 +1034,22 @@ PutRetentionPolicyOutcome CloudWatchLogsClient::PutRetentionPolicy(const PutRete
 
 PutRetentionPolicyOutcomeCallable CloudWatchLogsClient::PutRetentionPolicyCallable(const PutRetentionPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::PutRetentionPolicy, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::PutRetentionPolicy, Aws::Client::RejectedCallOutcome<PutRetentionPolicyOutcome>(), this, request);
+}
+
+PutRetentionPolicyOutcomeCallable CloudWatchLogsClient::PutRetentionPolicyCallable(PutRetentionPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::PutRetentionPolicy, Aws::Client::RejectedCallOutcome<PutRetentionPolicyOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::PutRetentionPolicyAsync(const PutRetentionPolicyRequest& request, const PutRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::PutRetentionPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::PutRetentionPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutRetentionPolicyOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::PutRetentionPolicyAsync(PutRetentionPolicyRequest&& request, const PutRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::PutRetentionPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutRetentionPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::PutRetentionPolicyAsyncHelper(const PutRetentionPolicyRequest& request, const PutRetentionPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -845,12 +1075,22 @@ PutSubscriptionFilterOutcome CloudWatchLogsClient::PutSubscriptionFilter(const P
 
 PutSubscriptionFilterOutcomeCallable CloudWatchLogsClient::PutSubscriptionFilterCallable(const PutSubscriptionFilterRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::PutSubscriptionFilter, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::PutSubscriptionFilter, Aws::Client::RejectedCallOutcome<PutSubscriptionFilterOutcome>(), this, request);
+}
+
+PutSubscriptionFilterOutcomeCallable CloudWatchLogsClient::PutSubscriptionFilterCallable(PutSubscriptionFilterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::PutSubscriptionFilter, Aws::Client::RejectedCallOutcome<PutSubscriptionFilterOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::PutSubscriptionFilterAsync(const PutSubscriptionFilterRequest& request, const PutSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::PutSubscriptionFilterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::PutSubscriptionFilterAsyncHelper, Aws::Client::RejectedAsyncCall<PutSubscriptionFilterOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::PutSubscriptionFilterAsync(PutSubscriptionFilterRequest&& request, const PutSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::PutSubscriptionFilterAsyncHelper, Aws::Client::RejectedAsyncCall<PutSubscriptionFilterOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::PutSubscriptionFilterAsyncHelper(const PutSubscriptionFilterRequest& request, const PutSubscriptionFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -876,12 +1116,22 @@ TestMetricFilterOutcome CloudWatchLogsClient::TestMetricFilter(const TestMetricF
 
 TestMetricFilterOutcomeCallable CloudWatchLogsClient::TestMetricFilterCallable(const TestMetricFilterRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchLogsClient::TestMetricFilter, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::TestMetricFilter, Aws::Client::RejectedCallOutcome<TestMetricFilterOutcome>(), this, request);
+}
+
+TestMetricFilterOutcomeCallable CloudWatchLogsClient::TestMetricFilterCallable(TestMetricFilterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchLogsClient::TestMetricFilter, Aws::Client::RejectedCallOutcome<TestMetricFilterOutcome>(), this, std::move(request));
 }
 
 void CloudWatchLogsClient::TestMetricFilterAsync(const TestMetricFilterRequest& request, const TestMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchLogsClient::TestMetricFilterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::TestMetricFilterAsyncHelper, Aws::Client::RejectedAsyncCall<TestMetricFilterOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchLogsClient::TestMetricFilterAsync(TestMetricFilterRequest&& request, const TestMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchLogsClient::TestMetricFilterAsyncHelper, Aws::Client::RejectedAsyncCall<TestMetricFilterOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchLogsClient::TestMetricFilterAsyncHelper(const TestMetricFilterRequest& request, const TestMetricFilterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -47,6 +47,35 @@
 #include <aws/machinelearning/model/UpdateMLModelResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/machinelearning/model/CreateBatchPredictionRequest.h>
+#include <aws/machinelearning/model/CreateDataSourceFromRDSRequest.h>
+#include <aws/machinelearning/model/CreateDataSourceFromRedshiftRequest.h>
+#include <aws/machinelearning/model/CreateDataSourceFromS3Request.h>
+#include <aws/machinelearning/model/CreateEvaluationRequest.h>
+#include <aws/machinelearning/model/CreateMLModelRequest.h>
+#include <aws/machinelearning/model/CreateRealtimeEndpointRequest.h>
+#include <aws/machinelearning/model/DeleteBatchPredictionRequest.h>
+#include <aws/machinelearning/model/DeleteDataSourceRequest.h>
+#include <aws/machinelearning/model/DeleteEvaluationRequest.h>
+#include <aws/machinelearning/model/DeleteMLModelRequest.h>
+#include <aws/machinelearning/model/DeleteRealtimeEndpointRequest.h>
+#include <aws/machinelearning/model/DescribeBatchPredictionsRequest.h>
+#include <aws/machinelearning/model/DescribeDataSourcesRequest.h>
+#include <aws/machinelearning/model/DescribeEvaluationsRequest.h>
+#include <aws/machinelearning/model/DescribeMLModelsRequest.h>
+#include <aws/machinelearning/model/GetBatchPredictionRequest.h>
+#include <aws/machinelearning/model/GetDataSourceRequest.h>
+#include <aws/machinelearning/model/GetEvaluationRequest.h>
+#include <aws/machinelearning/model/GetMLModelRequest.h>
+#include <aws/machinelearning/model/PredictRequest.h>
+#include <aws/machinelearning/model/UpdateBatchPredictionRequest.h>
+#include <aws/machinelearning/model/UpdateDataSourceRequest.h>
+#include <aws/machinelearning/model/UpdateEvaluationRequest.h>
+#include <aws/machinelearning/model/UpdateMLModelRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -265,6 +294,11 @@ namespace Model
          */
         virtual Model::CreateBatchPredictionOutcomeCallable CreateBatchPredictionCallable(const Model::CreateBatchPredictionRequest& request) const;
 
+        /**
+         * Same as CreateBatchPredictionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateBatchPredictionOutcomeCallable CreateBatchPredictionCallable(Model::CreateBatchPredictionRequest&& request) const;
+
         /**
          * <p>Generates predictions for a group of observations. The observations to
          * process exist in one or more data files referenced by a <code>DataSource</code>.
@@ -285,6 +319,11 @@ namespace Model
          */
         virtual void CreateBatchPredictionAsync(const Model::CreateBatchPredictionRequest& request, const CreateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateBatchPredictionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateBatchPredictionAsync(Model::CreateBatchPredictionRequest&& request, const CreateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <code>DataSource</code> object from an <a
          * href="http://aws.amazon.com/rds/"> Amazon Relational Database Service</a>
@@ -327,6 +366,11 @@ namespace Model
          */
         virtual Model::CreateDataSourceFromRDSOutcomeCallable CreateDataSourceFromRDSCallable(const Model::CreateDataSourceFromRDSRequest& request) const;
 
+        /**
+         * Same as CreateDataSourceFromRDSCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDataSourceFromRDSOutcomeCallable CreateDataSourceFromRDSCallable(Model::CreateDataSourceFromRDSRequest&& request) const;
+
         /**
          * <p>Creates a <code>DataSource</code> object from an <a
          * href="http://aws.amazon.com/rds/"> Amazon Relational Database Service</a>
@@ -349,6 +393,11 @@ namespace Model
          */
         virtual void CreateDataSourceFromRDSAsync(const Model::CreateDataSourceFromRDSRequest& request, const CreateDataSourceFromRDSResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDataSourceFromRDSAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDataSourceFromRDSAsync(Model::CreateDataSourceFromRDSRequest&& request, const CreateDataSourceFromRDSResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <code>DataSource</code> from <a
          * href="http://aws.amazon.com/redshift/">Amazon Redshift</a>. A
@@ -421,6 +470,11 @@ namespace Model
          */
         virtual Model::CreateDataSourceFromRedshiftOutcomeCallable CreateDataSourceFromRedshiftCallable(const Model::CreateDataSourceFromRedshiftRequest& request) const;
 
+        /**
+         * Same as CreateDataSourceFromRedshiftCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDataSourceFromRedshiftOutcomeCallable CreateDataSourceFromRedshiftCallable(Model::CreateDataSourceFromRedshiftRequest&& request) const;
+
         /**
          * <p>Creates a <code>DataSource</code> from <a
          * href="http://aws.amazon.com/redshift/">Amazon Redshift</a>. A
@@ -458,6 +512,11 @@ namespace Model
          */
         virtual void CreateDataSourceFromRedshiftAsync(const Model::CreateDataSourceFromRedshiftRequest& request, const CreateDataSourceFromRedshiftResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDataSourceFromRedshiftAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDataSourceFromRedshiftAsync(Model::CreateDataSourceFromRedshiftRequest&& request, const CreateDataSourceFromRedshiftResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <code>DataSource</code> object. A <code>DataSource</code>
          * references data that can be used to perform <a>CreateMLModel</a>,
@@ -530,6 +589,11 @@ namespace Model
          */
         virtual Model::CreateDataSourceFromS3OutcomeCallable CreateDataSourceFromS3Callable(const Model::CreateDataSourceFromS3Request& request) const;
 
+        /**
+         * Same as CreateDataSourceFromS3Callable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDataSourceFromS3OutcomeCallable CreateDataSourceFromS3Callable(Model::CreateDataSourceFromS3Request&& request) const;
+
         /**
          * <p>Creates a <code>DataSource</code> object. A <code>DataSource</code>
          * references data that can be used to perform <a>CreateMLModel</a>,
@@ -567,6 +631,11 @@ namespace Model
          */
         virtual void CreateDataSourceFromS3Async(const Model::CreateDataSourceFromS3Request& request, const CreateDataSourceFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDataSourceFromS3Async, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDataSourceFromS3Async(Model::CreateDataSourceFromS3Request&& request, const CreateDataSourceFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new <code>Evaluation</code> of an <code>MLModel</code>. An
          * <code>MLModel</code> is evaluated on a set of observations associated to a
@@ -611,6 +680,11 @@ namespace Model
          */
         virtual Model::CreateEvaluationOutcomeCallable CreateEvaluationCallable(const Model::CreateEvaluationRequest& request) const;
 
+        /**
+         * Same as CreateEvaluationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateEvaluationOutcomeCallable CreateEvaluationCallable(Model::CreateEvaluationRequest&& request) const;
+
         /**
          * <p>Creates a new <code>Evaluation</code> of an <code>MLModel</code>. An
          * <code>MLModel</code> is evaluated on a set of observations associated to a
@@ -634,6 +708,11 @@ namespace Model
          */
         virtual void CreateEvaluationAsync(const Model::CreateEvaluationRequest& request, const CreateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateEvaluationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateEvaluationAsync(Model::CreateEvaluationRequest&& request, const CreateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new <code>MLModel</code> using the data files and the recipe as
          * information sources. </p> <p>An <code>MLModel</code> is nearly immutable. Users
@@ -674,6 +753,11 @@ namespace Model
          */
         virtual Model::CreateMLModelOutcomeCallable CreateMLModelCallable(const Model::CreateMLModelRequest& request) const;
 
+        /**
+         * Same as CreateMLModelCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateMLModelOutcomeCallable CreateMLModelCallable(Model::CreateMLModelRequest&& request) const;
+
         /**
          * <p>Creates a new <code>MLModel</code> using the data files and the recipe as
          * information sources. </p> <p>An <code>MLModel</code> is nearly immutable. Users
@@ -695,6 +779,11 @@ namespace Model
          */
         virtual void CreateMLModelAsync(const Model::CreateMLModelRequest& request, const CreateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateMLModelAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateMLModelAsync(Model::CreateMLModelRequest&& request, const CreateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a real-time endpoint for the <code>MLModel</code>. The endpoint
          * contains the URI of the <code>MLModel</code>; that is, the location to send
@@ -711,6 +800,11 @@ namespace Model
          */
         virtual Model::CreateRealtimeEndpointOutcomeCallable CreateRealtimeEndpointCallable(const Model::CreateRealtimeEndpointRequest& request) const;
 
+        /**
+         * Same as CreateRealtimeEndpointCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateRealtimeEndpointOutcomeCallable CreateRealtimeEndpointCallable(Model::CreateRealtimeEndpointRequest&& request) const;
+
         /**
          * <p>Creates a real-time endpoint for the <code>MLModel</code>. The endpoint
          * contains the URI of the <code>MLModel</code>; that is, the location to send
@@ -720,6 +814,11 @@ namespace Model
          */
         virtual void CreateRealtimeEndpointAsync(const Model::CreateRealtimeEndpointRequest& request, const CreateRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRealtimeEndpointAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateRealtimeEndpointAsync(Model::CreateRealtimeEndpointRequest&& request, const CreateRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Assigns the DELETED status to a <code>BatchPrediction</code>, rendering it
          * unusable.</p> <p>After using the <code>DeleteBatchPrediction</code> operation,
@@ -740,6 +839,11 @@ namespace Model
          */
         virtual Model::DeleteBatchPredictionOutcomeCallable DeleteBatchPredictionCallable(const Model::DeleteBatchPredictionRequest& request) const;
 
+        /**
+         * Same as DeleteBatchPredictionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteBatchPredictionOutcomeCallable DeleteBatchPredictionCallable(Model::DeleteBatchPredictionRequest&& request) const;
+
         /**
          * <p>Assigns the DELETED status to a <code>BatchPrediction</code>, rendering it
          * unusable.</p> <p>After using the <code>DeleteBatchPrediction</code> operation,
@@ -751,6 +855,11 @@ namespace Model
          */
         virtual void DeleteBatchPredictionAsync(const Model::DeleteBatchPredictionRequest& request, const DeleteBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBatchPredictionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteBatchPredictionAsync(Model::DeleteBatchPredictionRequest&& request, const DeleteBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Assigns the DELETED status to a <code>DataSource</code>, rendering it
          * unusable.</p> <p>After using the <code>DeleteDataSource</code> operation, you
@@ -771,6 +880,11 @@ namespace Model
          */
         virtual Model::DeleteDataSourceOutcomeCallable DeleteDataSourceCallable(const Model::DeleteDataSourceRequest& request) const;
 
+        /**
+         * Same as DeleteDataSourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDataSourceOutcomeCallable DeleteDataSourceCallable(Model::DeleteDataSourceRequest&& request) const;
+
         /**
          * <p>Assigns the DELETED status to a <code>DataSource</code>, rendering it
          * unusable.</p> <p>After using the <code>DeleteDataSource</code> operation, you
@@ -782,6 +896,11 @@ namespace Model
          */
         virtual void DeleteDataSourceAsync(const Model::DeleteDataSourceRequest& request, const DeleteDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDataSourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDataSourceAsync(Model::DeleteDataSourceRequest&& request, const DeleteDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Assigns the <code>DELETED</code> status to an <code>Evaluation</code>,
          * rendering it unusable.</p> <p>After invoking the <code>DeleteEvaluation</code>
@@ -804,6 +923,11 @@ namespace Model
          */
         virtual Model::DeleteEvaluationOutcomeCallable DeleteEvaluationCallable(const Model::DeleteEvaluationRequest& request) const;
 
+        /**
+         * Same as DeleteEvaluationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteEvaluationOutcomeCallable DeleteEvaluationCallable(Model::DeleteEvaluationRequest&& request) const;
+
         /**
          * <p>Assigns the <code>DELETED</code> status to an <code>Evaluation</code>,
          * rendering it unusable.</p> <p>After invoking the <code>DeleteEvaluation</code>
@@ -816,6 +940,11 @@ namespace Model
          */
         virtual void DeleteEvaluationAsync(const Model::DeleteEvaluationRequest& request, const DeleteEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteEvaluationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteEvaluationAsync(Model::DeleteEvaluationRequest&& request, const DeleteEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Assigns the DELETED status to an <code>MLModel</code>, rendering it
          * unusable.</p> <p>After using the <code>DeleteMLModel</code> operation, you can
@@ -836,6 +965,11 @@ namespace Model
          */
         virtual Model::DeleteMLModelOutcomeCallable DeleteMLModelCallable(const Model::DeleteMLModelRequest& request) const;
 
+        /**
+         * Same as DeleteMLModelCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteMLModelOutcomeCallable DeleteMLModelCallable(Model::DeleteMLModelRequest&& request) const;
+
         /**
          * <p>Assigns the DELETED status to an <code>MLModel</code>, rendering it
          * unusable.</p> <p>After using the <code>DeleteMLModel</code> operation, you can
@@ -847,6 +981,11 @@ namespace Model
          */
         virtual void DeleteMLModelAsync(const Model::DeleteMLModelRequest& request, const DeleteMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteMLModelAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteMLModelAsync(Model::DeleteMLModelRequest&& request, const DeleteMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a real time endpoint of an <code>MLModel</code>.</p>
          */
@@ -859,6 +998,11 @@ namespace Model
          */
         virtual Model::DeleteRealtimeEndpointOutcomeCallable DeleteRealtimeEndpointCallable(const Model::DeleteRealtimeEndpointRequest& request) const;
 
+        /**
+         * Same as DeleteRealtimeEndpointCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteRealtimeEndpointOutcomeCallable DeleteRealtimeEndpointCallable(Model::DeleteRealtimeEndpointRequest&& request) const;
+
         /**
          * <p>Deletes a real time endpoint of an <code>MLModel</code>.</p>
          *
@@ -866,6 +1010,11 @@ namespace Model
          */
         virtual void DeleteRealtimeEndpointAsync(const Model::DeleteRealtimeEndpointRequest& request, const DeleteRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRealtimeEndpointAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteRealtimeEndpointAsync(Model::DeleteRealtimeEndpointRequest&& request, const DeleteRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of <code>BatchPrediction</code> operations that match the
          * search criteria in the request.</p>
@@ -880,6 +1029,11 @@ namespace Model
          */
         virtual Model::DescribeBatchPredictionsOutcomeCallable DescribeBatchPredictionsCallable(const Model::DescribeBatchPredictionsRequest& request) const;
 
+        /**
+         * Same as DescribeBatchPredictionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeBatchPredictionsOutcomeCallable DescribeBatchPredictionsCallable(Model::DescribeBatchPredictionsRequest&& request) const;
+
         /**
          * <p>Returns a list of <code>BatchPrediction</code> operations that match the
          * search criteria in the request.</p>
@@ -888,6 +1042,11 @@ namespace Model
          */
         virtual void DescribeBatchPredictionsAsync(const Model::DescribeBatchPredictionsRequest& request, const DescribeBatchPredictionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeBatchPredictionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeBatchPredictionsAsync(Model::DescribeBatchPredictionsRequest&& request, const DescribeBatchPredictionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of <code>DataSource</code> that match the search criteria in
          * the request.</p>
@@ -902,6 +1061,11 @@ namespace Model
          */
         virtual Model::DescribeDataSourcesOutcomeCallable DescribeDataSourcesCallable(const Model::DescribeDataSourcesRequest& request) const;
 
+        /**
+         * Same as DescribeDataSourcesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDataSourcesOutcomeCallable DescribeDataSourcesCallable(Model::DescribeDataSourcesRequest&& request) const;
+
         /**
          * <p>Returns a list of <code>DataSource</code> that match the search criteria in
          * the request.</p>
@@ -910,6 +1074,11 @@ namespace Model
          */
         virtual void DescribeDataSourcesAsync(const Model::DescribeDataSourcesRequest& request, const DescribeDataSourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDataSourcesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDataSourcesAsync(Model::DescribeDataSourcesRequest&& request, const DescribeDataSourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of <code>DescribeEvaluations</code> that match the search
          * criteria in the request.</p>
@@ -924,6 +1093,11 @@ namespace Model
          */
         virtual Model::DescribeEvaluationsOutcomeCallable DescribeEvaluationsCallable(const Model::DescribeEvaluationsRequest& request) const;
 
+        /**
+         * Same as DescribeEvaluationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEvaluationsOutcomeCallable DescribeEvaluationsCallable(Model::DescribeEvaluationsRequest&& request) const;
+
         /**
          * <p>Returns a list of <code>DescribeEvaluations</code> that match the search
          * criteria in the request.</p>
@@ -932,6 +1106,11 @@ namespace Model
          */
         virtual void DescribeEvaluationsAsync(const Model::DescribeEvaluationsRequest& request, const DescribeEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEvaluationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEvaluationsAsync(Model::DescribeEvaluationsRequest&& request, const DescribeEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of <code>MLModel</code> that match the search criteria in the
          * request.</p>
@@ -946,6 +1125,11 @@ namespace Model
          */
         virtual Model::DescribeMLModelsOutcomeCallable DescribeMLModelsCallable(const Model::DescribeMLModelsRequest& request) const;
 
+        /**
+         * Same as DescribeMLModelsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeMLModelsOutcomeCallable DescribeMLModelsCallable(Model::DescribeMLModelsRequest&& request) const;
+
         /**
          * <p>Returns a list of <code>MLModel</code> that match the search criteria in the
          * request.</p>
@@ -954,6 +1138,11 @@ namespace Model
          */
         virtual void DescribeMLModelsAsync(const Model::DescribeMLModelsRequest& request, const DescribeMLModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeMLModelsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeMLModelsAsync(Model::DescribeMLModelsRequest&& request, const DescribeMLModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a <code>BatchPrediction</code> that includes detailed metadata,
          * status, and data file information for a <code>Batch Prediction</code>
@@ -970,6 +1159,11 @@ namespace Model
          */
         virtual Model::GetBatchPredictionOutcomeCallable GetBatchPredictionCallable(const Model::GetBatchPredictionRequest& request) const;
 
+        /**
+         * Same as GetBatchPredictionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBatchPredictionOutcomeCallable GetBatchPredictionCallable(Model::GetBatchPredictionRequest&& request) const;
+
         /**
          * <p>Returns a <code>BatchPrediction</code> that includes detailed metadata,
          * status, and data file information for a <code>Batch Prediction</code>
@@ -979,6 +1173,11 @@ namespace Model
          */
         virtual void GetBatchPredictionAsync(const Model::GetBatchPredictionRequest& request, const GetBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBatchPredictionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBatchPredictionAsync(Model::GetBatchPredictionRequest&& request, const GetBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a <code>DataSource</code> that includes metadata and data file
          * information, as well as the current status of the <code>DataSource</code>.</p>
@@ -999,6 +1198,11 @@ namespace Model
          */
         virtual Model::GetDataSourceOutcomeCallable GetDataSourceCallable(const Model::GetDataSourceRequest& request) const;
 
+        /**
+         * Same as GetDataSourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDataSourceOutcomeCallable GetDataSourceCallable(Model::GetDataSourceRequest&& request) const;
+
         /**
          * <p>Returns a <code>DataSource</code> that includes metadata and data file
          * information, as well as the current status of the <code>DataSource</code>.</p>
@@ -1010,6 +1214,11 @@ namespace Model
          */
         virtual void GetDataSourceAsync(const Model::GetDataSourceRequest& request, const GetDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDataSourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDataSourceAsync(Model::GetDataSourceRequest&& request, const GetDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an <code>Evaluation</code> that includes metadata as well as the
          * current status of the <code>Evaluation</code>.</p>
@@ -1024,6 +1233,11 @@ namespace Model
          */
         virtual Model::GetEvaluationOutcomeCallable GetEvaluationCallable(const Model::GetEvaluationRequest& request) const;
 
+        /**
+         * Same as GetEvaluationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetEvaluationOutcomeCallable GetEvaluationCallable(Model::GetEvaluationRequest&& request) const;
+
         /**
          * <p>Returns an <code>Evaluation</code> that includes metadata as well as the
          * current status of the <code>Evaluation</code>.</p>
@@ -1032,6 +1246,11 @@ namespace Model
          */
         virtual void GetEvaluationAsync(const Model::GetEvaluationRequest& request, const GetEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetEvaluationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetEvaluationAsync(Model::GetEvaluationRequest&& request, const GetEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an <code>MLModel</code> that includes detailed metadata, and data
          * source information as well as the current status of the
@@ -1050,6 +1269,11 @@ namespace Model
          */
         virtual Model::GetMLModelOutcomeCallable GetMLModelCallable(const Model::GetMLModelRequest& request) const;
 
+        /**
+         * Same as GetMLModelCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetMLModelOutcomeCallable GetMLModelCallable(Model::GetMLModelRequest&& request) const;
+
         /**
          * <p>Returns an <code>MLModel</code> that includes detailed metadata, and data
          * source information as well as the current status of the
@@ -1060,6 +1284,11 @@ namespace Model
          */
         virtual void GetMLModelAsync(const Model::GetMLModelRequest& request, const GetMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetMLModelAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetMLModelAsync(Model::GetMLModelRequest&& request, const GetMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Generates a prediction for the observation using the specified <code>ML
          * Model</code>.</p> <note><title>Note</title> <p>Not all response parameters will
@@ -1078,6 +1307,11 @@ namespace Model
          */
         virtual Model::PredictOutcomeCallable PredictCallable(const Model::PredictRequest& request) const;
 
+        /**
+         * Same as PredictCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PredictOutcomeCallable PredictCallable(Model::PredictRequest&& request) const;
+
         /**
          * <p>Generates a prediction for the observation using the specified <code>ML
          * Model</code>.</p> <note><title>Note</title> <p>Not all response parameters will
@@ -1088,6 +1322,11 @@ namespace Model
          */
         virtual void PredictAsync(const Model::PredictRequest& request, const PredictResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PredictAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PredictAsync(Model::PredictRequest&& request, const PredictResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the <code>BatchPredictionName</code> of a
          * <code>BatchPrediction</code>.</p> <p>You can use the <a>GetBatchPrediction</a>
@@ -1104,6 +1343,11 @@ namespace Model
          */
         virtual Model::UpdateBatchPredictionOutcomeCallable UpdateBatchPredictionCallable(const Model::UpdateBatchPredictionRequest& request) const;
 
+        /**
+         * Same as UpdateBatchPredictionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateBatchPredictionOutcomeCallable UpdateBatchPredictionCallable(Model::UpdateBatchPredictionRequest&& request) const;
+
         /**
          * <p>Updates the <code>BatchPredictionName</code> of a
          * <code>BatchPrediction</code>.</p> <p>You can use the <a>GetBatchPrediction</a>
@@ -1113,6 +1357,11 @@ namespace Model
          */
         virtual void UpdateBatchPredictionAsync(const Model::UpdateBatchPredictionRequest& request, const UpdateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateBatchPredictionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateBatchPredictionAsync(Model::UpdateBatchPredictionRequest&& request, const UpdateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the <code>DataSourceName</code> of a <code>DataSource</code>.</p>
          * <p>You can use the <a>GetDataSource</a> operation to view the contents of the
@@ -1129,6 +1378,11 @@ namespace Model
          */
         virtual Model::UpdateDataSourceOutcomeCallable UpdateDataSourceCallable(const Model::UpdateDataSourceRequest& request) const;
 
+        /**
+         * Same as UpdateDataSourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateDataSourceOutcomeCallable UpdateDataSourceCallable(Model::UpdateDataSourceRequest&& request) const;
+
         /**
          * <p>Updates the <code>DataSourceName</code> of a <code>DataSource</code>.</p>
          * <p>You can use the <a>GetDataSource</a> operation to view the contents of the
@@ -1138,6 +1392,11 @@ namespace Model
          */
         virtual void UpdateDataSourceAsync(const Model::UpdateDataSourceRequest& request, const UpdateDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDataSourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateDataSourceAsync(Model::UpdateDataSourceRequest&& request, const UpdateDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the <code>EvaluationName</code> of an <code>Evaluation</code>.</p>
          * <p>You can use the <a>GetEvaluation</a> operation to view the contents of the
@@ -1154,6 +1413,11 @@ namespace Model
          */
         virtual Model::UpdateEvaluationOutcomeCallable UpdateEvaluationCallable(const Model::UpdateEvaluationRequest& request) const;
 
+        /**
+         * Same as UpdateEvaluationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateEvaluationOutcomeCallable UpdateEvaluationCallable(Model::UpdateEvaluationRequest&& request) const;
+
         /**
          * <p>Updates the <code>EvaluationName</code> of an <code>Evaluation</code>.</p>
          * <p>You can use the <a>GetEvaluation</a> operation to view the contents of the
@@ -1163,6 +1427,11 @@ namespace Model
          */
         virtual void UpdateEvaluationAsync(const Model::UpdateEvaluationRequest& request, const UpdateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateEvaluationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateEvaluationAsync(Model::UpdateEvaluationRequest&& request, const UpdateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the <code>MLModelName</code> and the <code>ScoreThreshold</code> of
          * an <code>MLModel</code>.</p> <p>You can use the <a>GetMLModel</a> operation to
@@ -1179,6 +1448,11 @@ namespace Model
          */
         virtual Model::UpdateMLModelOutcomeCallable UpdateMLModelCallable(const Model::UpdateMLModelRequest& request) const;
 
+        /**
+         * Same as UpdateMLModelCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateMLModelOutcomeCallable UpdateMLModelCallable(Model::UpdateMLModelRequest&& request) const;
+
         /**
          * <p>Updates the <code>MLModelName</code> and the <code>ScoreThreshold</code> of
          * an <code>MLModel</code>.</p> <p>You can use the <a>GetMLModel</a> operation to
@@ -1188,6 +1462,68 @@ namespace Model
          */
         virtual void UpdateMLModelAsync(const Model::UpdateMLModelRequest& request, const UpdateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateMLModelAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateMLModelAsync(Model::UpdateMLModelRequest&& request, const UpdateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateBatchPredictionOutcome> CreateBatchPredictionAwaitable(const Model::CreateBatchPredictionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::CreateBatchPrediction, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateBatchPredictionOutcome> CreateBatchPredictionAwaitable(Model::CreateBatchPredictionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::CreateBatchPrediction, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDataSourceFromRDSOutcome> CreateDataSourceFromRDSAwaitable(const Model::CreateDataSourceFromRDSRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::CreateDataSourceFromRDS, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDataSourceFromRDSOutcome> CreateDataSourceFromRDSAwaitable(Model::CreateDataSourceFromRDSRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::CreateDataSourceFromRDS, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDataSourceFromRedshiftOutcome> CreateDataSourceFromRedshiftAwaitable(const Model::CreateDataSourceFromRedshiftRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::CreateDataSourceFromRedshift, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDataSourceFromRedshiftOutcome> CreateDataSourceFromRedshiftAwaitable(Model::CreateDataSourceFromRedshiftRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::CreateDataSourceFromRedshift, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDataSourceFromS3Outcome> CreateDataSourceFromS3Awaitable(const Model::CreateDataSourceFromS3Request& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::CreateDataSourceFromS3, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDataSourceFromS3Outcome> CreateDataSourceFromS3Awaitable(Model::CreateDataSourceFromS3Request&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::CreateDataSourceFromS3, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateEvaluationOutcome> CreateEvaluationAwaitable(const Model::CreateEvaluationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::CreateEvaluation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateEvaluationOutcome> CreateEvaluationAwaitable(Model::CreateEvaluationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::CreateEvaluation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateMLModelOutcome> CreateMLModelAwaitable(const Model::CreateMLModelRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::CreateMLModel, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateMLModelOutcome> CreateMLModelAwaitable(Model::CreateMLModelRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::CreateMLModel, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRealtimeEndpointOutcome> CreateRealtimeEndpointAwaitable(const Model::CreateRealtimeEndpointRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::CreateRealtimeEndpoint, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRealtimeEndpointOutcome> CreateRealtimeEndpointAwaitable(Model::CreateRealtimeEndpointRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::CreateRealtimeEndpoint, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBatchPredictionOutcome> DeleteBatchPredictionAwaitable(const Model::DeleteBatchPredictionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DeleteBatchPrediction, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBatchPredictionOutcome> DeleteBatchPredictionAwaitable(Model::DeleteBatchPredictionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DeleteBatchPrediction, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDataSourceOutcome> DeleteDataSourceAwaitable(const Model::DeleteDataSourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DeleteDataSource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDataSourceOutcome> DeleteDataSourceAwaitable(Model::DeleteDataSourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DeleteDataSource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteEvaluationOutcome> DeleteEvaluationAwaitable(const Model::DeleteEvaluationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DeleteEvaluation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteEvaluationOutcome> DeleteEvaluationAwaitable(Model::DeleteEvaluationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DeleteEvaluation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteMLModelOutcome> DeleteMLModelAwaitable(const Model::DeleteMLModelRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DeleteMLModel, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteMLModelOutcome> DeleteMLModelAwaitable(Model::DeleteMLModelRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DeleteMLModel, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRealtimeEndpointOutcome> DeleteRealtimeEndpointAwaitable(const Model::DeleteRealtimeEndpointRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DeleteRealtimeEndpoint, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRealtimeEndpointOutcome> DeleteRealtimeEndpointAwaitable(Model::DeleteRealtimeEndpointRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DeleteRealtimeEndpoint, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeBatchPredictionsOutcome> DescribeBatchPredictionsAwaitable(const Model::DescribeBatchPredictionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DescribeBatchPredictions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeBatchPredictionsOutcome> DescribeBatchPredictionsAwaitable(Model::DescribeBatchPredictionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DescribeBatchPredictions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDataSourcesOutcome> DescribeDataSourcesAwaitable(const Model::DescribeDataSourcesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DescribeDataSources, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDataSourcesOutcome> DescribeDataSourcesAwaitable(Model::DescribeDataSourcesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DescribeDataSources, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEvaluationsOutcome> DescribeEvaluationsAwaitable(const Model::DescribeEvaluationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DescribeEvaluations, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEvaluationsOutcome> DescribeEvaluationsAwaitable(Model::DescribeEvaluationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DescribeEvaluations, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMLModelsOutcome> DescribeMLModelsAwaitable(const Model::DescribeMLModelsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DescribeMLModels, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMLModelsOutcome> DescribeMLModelsAwaitable(Model::DescribeMLModelsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::DescribeMLModels, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBatchPredictionOutcome> GetBatchPredictionAwaitable(const Model::GetBatchPredictionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::GetBatchPrediction, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBatchPredictionOutcome> GetBatchPredictionAwaitable(Model::GetBatchPredictionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::GetBatchPrediction, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDataSourceOutcome> GetDataSourceAwaitable(const Model::GetDataSourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::GetDataSource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDataSourceOutcome> GetDataSourceAwaitable(Model::GetDataSourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::GetDataSource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetEvaluationOutcome> GetEvaluationAwaitable(const Model::GetEvaluationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::GetEvaluation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetEvaluationOutcome> GetEvaluationAwaitable(Model::GetEvaluationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::GetEvaluation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetMLModelOutcome> GetMLModelAwaitable(const Model::GetMLModelRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::GetMLModel, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetMLModelOutcome> GetMLModelAwaitable(Model::GetMLModelRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::GetMLModel, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PredictOutcome> PredictAwaitable(const Model::PredictRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::Predict, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PredictOutcome> PredictAwaitable(Model::PredictRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::Predict, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateBatchPredictionOutcome> UpdateBatchPredictionAwaitable(const Model::UpdateBatchPredictionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::UpdateBatchPrediction, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateBatchPredictionOutcome> UpdateBatchPredictionAwaitable(Model::UpdateBatchPredictionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::UpdateBatchPrediction, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDataSourceOutcome> UpdateDataSourceAwaitable(const Model::UpdateDataSourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::UpdateDataSource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDataSourceOutcome> UpdateDataSourceAwaitable(Model::UpdateDataSourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::UpdateDataSource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateEvaluationOutcome> UpdateEvaluationAwaitable(const Model::UpdateEvaluationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::UpdateEvaluation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateEvaluationOutcome> UpdateEvaluationAwaitable(Model::UpdateEvaluationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::UpdateEvaluation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateMLModelOutcome> UpdateMLModelAwaitable(const Model::UpdateMLModelRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::UpdateMLModel, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateMLModelOutcome> UpdateMLModelAwaitable(Model::UpdateMLModelRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MachineLearningClient::UpdateMLModel, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -132,12 +132,22 @@ CreateBatchPredictionOutcome MachineLearningClient::CreateBatchPrediction(const
 
 CreateBatchPredictionOutcomeCallable MachineLearningClient::CreateBatchPredictionCallable(const CreateBatchPredictionRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::CreateBatchPrediction, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::CreateBatchPrediction, Aws::Client::RejectedCallOutcome<CreateBatchPredictionOutcome>(), this, request);
+}
+
+CreateBatchPredictionOutcomeCallable MachineLearningClient::CreateBatchPredictionCallable(CreateBatchPredictionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::CreateBatchPrediction, Aws::Client::RejectedCallOutcome<CreateBatchPredictionOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::CreateBatchPredictionAsync(const CreateBatchPredictionRequest& request, const CreateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::CreateBatchPredictionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::CreateBatchPredictionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateBatchPredictionOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::CreateBatchPredictionAsync(CreateBatchPredictionRequest&& request, const CreateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::CreateBatchPredictionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateBatchPredictionOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::CreateBatchPredictionAsyncHelper(const CreateBatchPredictionRequest& request, const CreateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -163,12 +173,22 @@ CreateDataSourceFromRDSOutcome MachineLearningClient::CreateDataSourceFromRDS(co
 
 CreateDataSourceFromRDSOutcomeCallable MachineLearningClient::CreateDataSourceFromRDSCallable(const CreateDataSourceFromRDSRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::CreateDataSourceFromRDS, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::CreateDataSourceFromRDS, Aws::Client::RejectedCallOutcome<CreateDataSourceFromRDSOutcome>(), this, request);
+}
+
+CreateDataSourceFromRDSOutcomeCallable MachineLearningClient::CreateDataSourceFromRDSCallable(CreateDataSourceFromRDSRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::CreateDataSourceFromRDS, Aws::Client::RejectedCallOutcome<CreateDataSourceFromRDSOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::CreateDataSourceFromRDSAsync(const CreateDataSourceFromRDSRequest& request, const CreateDataSourceFromRDSResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::CreateDataSourceFromRDSAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::CreateDataSourceFromRDSAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDataSourceFromRDSOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::CreateDataSourceFromRDSAsync(CreateDataSourceFromRDSRequest&& request, const CreateDataSourceFromRDSResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::CreateDataSourceFromRDSAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDataSourceFromRDSOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::CreateDataSourceFromRDSAsyncHelper(const CreateDataSourceFromRDSRequest& request, const CreateDataSourceFromRDSResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -194,12 +214,22 @@ CreateDataSourceFromRedshiftOutcome MachineLearningClient::CreateDataSourceFromR
 
 CreateDataSourceFromRedshiftOutcomeCallable MachineLearningClient::CreateDataSourceFromRedshiftCallable(const CreateDataSourceFromRedshiftRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::CreateDataSourceFromRedshift, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::CreateDataSourceFromRedshift, Aws::Client::RejectedCallOutcome<CreateDataSourceFromRedshiftOutcome>(), this, request);
+}
+
+CreateDataSourceFromRedshiftOutcomeCallable MachineLearningClient::CreateDataSourceFromRedshiftCallable(CreateDataSourceFromRedshiftRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::CreateDataSourceFromRedshift, Aws::Client::RejectedCallOutcome<CreateDataSourceFromRedshiftOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::CreateDataSourceFromRedshiftAsync(const CreateDataSourceFromRedshiftRequest& request, const CreateDataSourceFromRedshiftResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::CreateDataSourceFromRedshiftAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::CreateDataSourceFromRedshiftAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDataSourceFromRedshiftOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::CreateDataSourceFromRedshiftAsync(CreateDataSourceFromRedshiftRequest&& request, const CreateDataSourceFromRedshiftResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::CreateDataSourceFromRedshiftAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDataSourceFromRedshiftOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::CreateDataSourceFromRedshiftAsyncHelper(const CreateDataSourceFromRedshiftRequest& request, const CreateDataSourceFromRedshiftResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -225,12 +255,22 @@ CreateDataSourceFromS3Outcome MachineLearningClient::CreateDataSourceFromS3(cons
 
 CreateDataSourceFromS3OutcomeCallable MachineLearningClient::CreateDataSourceFromS3Callable(const CreateDataSourceFromS3Request& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::CreateDataSourceFromS3, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::CreateDataSourceFromS3, Aws::Client::RejectedCallOutcome<CreateDataSourceFromS3Outcome>(), this, request);
+}
+
+CreateDataSourceFromS3OutcomeCallable MachineLearningClient::CreateDataSourceFromS3Callable(CreateDataSourceFromS3Request&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::CreateDataSourceFromS3, Aws::Client::RejectedCallOutcome<CreateDataSourceFromS3Outcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::CreateDataSourceFromS3Async(const CreateDataSourceFromS3Request& request, const CreateDataSourceFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::CreateDataSourceFromS3AsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::CreateDataSourceFromS3AsyncHelper, Aws::Client::RejectedAsyncCall<CreateDataSourceFromS3Outcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::CreateDataSourceFromS3Async(CreateDataSourceFromS3Request&& request, const CreateDataSourceFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::CreateDataSourceFromS3AsyncHelper, Aws::Client::RejectedAsyncCall<CreateDataSourceFromS3Outcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::CreateDataSourceFromS3AsyncHelper(const CreateDataSourceFromS3Request& request, const CreateDataSourceFromS3ResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -256,12 +296,22 @@ CreateEvaluationOutcome MachineLearningClient::CreateEvaluation(const CreateEval
 
 CreateEvaluationOutcomeCallable MachineLearningClient::CreateEvaluationCallable(const CreateEvaluationRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::CreateEvaluation, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::CreateEvaluation, Aws::Client::RejectedCallOutcome<CreateEvaluationOutcome>(), this, request);
+}
+
+CreateEvaluationOutcomeCallable MachineLearningClient::CreateEvaluationCallable(CreateEvaluationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::CreateEvaluation, Aws::Client::RejectedCallOutcome<CreateEvaluationOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::CreateEvaluationAsync(const CreateEvaluationRequest& request, const CreateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::CreateEvaluationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::CreateEvaluationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateEvaluationOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::CreateEvaluationAsync(CreateEvaluationRequest&& request, const CreateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::CreateEvaluationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateEvaluationOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::CreateEvaluationAsyncHelper(const CreateEvaluationRequest& request, const CreateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -287,12 +337,22 @@ CreateMLModelOutcome MachineLearningClient::CreateMLModel(const CreateMLModelReq
 
 CreateMLModelOutcomeCallable MachineLearningClient::CreateMLModelCallable(const CreateMLModelRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::CreateMLModel, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::CreateMLModel, Aws::Client::RejectedCallOutcome<CreateMLModelOutcome>(), this, request);
+}
+
+CreateMLModelOutcomeCallable MachineLearningClient::CreateMLModelCallable(CreateMLModelRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::CreateMLModel, Aws::Client::RejectedCallOutcome<CreateMLModelOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::CreateMLModelAsync(const CreateMLModelRequest& request, const CreateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::CreateMLModelAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::CreateMLModelAsyncHelper, Aws::Client::RejectedAsyncCall<CreateMLModelOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::CreateMLModelAsync(CreateMLModelRequest&& request, const CreateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::CreateMLModelAsyncHelper, Aws::Client::RejectedAsyncCall<CreateMLModelOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::CreateMLModelAsyncHelper(const CreateMLModelRequest& request, const CreateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -318,12 +378,22 @@ CreateRealtimeEndpointOutcome MachineLearningClient::CreateRealtimeEndpoint(cons
 
 CreateRealtimeEndpointOutcomeCallable MachineLearningClient::CreateRealtimeEndpointCallable(const CreateRealtimeEndpointRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::CreateRealtimeEndpoint, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::CreateRealtimeEndpoint, Aws::Client::RejectedCallOutcome<CreateRealtimeEndpointOutcome>(), this, request);
+}
+
+CreateRealtimeEndpointOutcomeCallable MachineLearningClient::CreateRealtimeEndpointCallable(CreateRealtimeEndpointRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::CreateRealtimeEndpoint, Aws::Client::RejectedCallOutcome<CreateRealtimeEndpointOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::CreateRealtimeEndpointAsync(const CreateRealtimeEndpointRequest& request, const CreateRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::CreateRealtimeEndpointAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::CreateRealtimeEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRealtimeEndpointOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::CreateRealtimeEndpointAsync(CreateRealtimeEndpointRequest&& request, const CreateRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::CreateRealtimeEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRealtimeEndpointOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::CreateRealtimeEndpointAsyncHelper(const CreateRealtimeEndpointRequest& request, const CreateRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -349,12 +419,22 @@ DeleteBatchPredictionOutcome MachineLearningClient::DeleteBatchPrediction(const
 
 DeleteBatchPredictionOutcomeCallable MachineLearningClient::DeleteBatchPredictionCallable(const DeleteBatchPredictionRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::DeleteBatchPrediction, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DeleteBatchPrediction, Aws::Client::RejectedCallOutcome<DeleteBatchPredictionOutcome>(), this, request);
+}
+
+DeleteBatchPredictionOutcomeCallable MachineLearningClient::DeleteBatchPredictionCallable(DeleteBatchPredictionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DeleteBatchPrediction, Aws::Client::RejectedCallOutcome<DeleteBatchPredictionOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::DeleteBatchPredictionAsync(const DeleteBatchPredictionRequest& request, const DeleteBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::DeleteBatchPredictionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::DeleteBatchPredictionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBatchPredictionOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::DeleteBatchPredictionAsync(DeleteBatchPredictionRequest&& request, const DeleteBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::DeleteBatchPredictionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBatchPredictionOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::DeleteBatchPredictionAsyncHelper(const DeleteBatchPredictionRequest& request, const DeleteBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -380,12 +460,22 @@ DeleteDataSourceOutcome MachineLearningClient::DeleteDataSource(const DeleteData
 
 DeleteDataSourceOutcomeCallable MachineLearningClient::DeleteDataSourceCallable(const DeleteDataSourceRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::DeleteDataSource, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DeleteDataSource, Aws::Client::RejectedCallOutcome<DeleteDataSourceOutcome>(), this, request);
+}
+
+DeleteDataSourceOutcomeCallable MachineLearningClient::DeleteDataSourceCallable(DeleteDataSourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DeleteDataSource, Aws::Client::RejectedCallOutcome<DeleteDataSourceOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::DeleteDataSourceAsync(const DeleteDataSourceRequest& request, const DeleteDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::DeleteDataSourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::DeleteDataSourceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDataSourceOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::DeleteDataSourceAsync(DeleteDataSourceRequest&& request, const DeleteDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::DeleteDataSourceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDataSourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::DeleteDataSourceAsyncHelper(const DeleteDataSourceRequest& request, const DeleteDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -411,12 +501,22 @@ DeleteEvaluationOutcome MachineLearningClient::DeleteEvaluation(const DeleteEval
 
 DeleteEvaluationOutcomeCallable MachineLearningClient::DeleteEvaluationCallable(const DeleteEvaluationRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::DeleteEvaluation, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DeleteEvaluation, Aws::Client::RejectedCallOutcome<DeleteEvaluationOutcome>(), this, request);
+}
+
+DeleteEvaluationOutcomeCallable MachineLearningClient::DeleteEvaluationCallable(DeleteEvaluationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DeleteEvaluation, Aws::Client::RejectedCallOutcome<DeleteEvaluationOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::DeleteEvaluationAsync(const DeleteEvaluationRequest& request, const DeleteEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::DeleteEvaluationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::DeleteEvaluationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteEvaluationOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::DeleteEvaluationAsync(DeleteEvaluationRequest&& request, const DeleteEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::DeleteEvaluationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteEvaluationOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::DeleteEvaluationAsyncHelper(const DeleteEvaluationRequest& request, const DeleteEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -442,12 +542,22 @@ DeleteMLModelOutcome MachineLearningClient::DeleteMLModel(const DeleteMLModelReq
 
 DeleteMLModelOutcomeCallable MachineLearningClient::DeleteMLModelCallable(const DeleteMLModelRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::DeleteMLModel, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DeleteMLModel, Aws::Client::RejectedCallOutcome<DeleteMLModelOutcome>(), this, request);
+}
+
+DeleteMLModelOutcomeCallable MachineLearningClient::DeleteMLModelCallable(DeleteMLModelRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DeleteMLModel, Aws::Client::RejectedCallOutcome<DeleteMLModelOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::DeleteMLModelAsync(const DeleteMLModelRequest& request, const DeleteMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::DeleteMLModelAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::DeleteMLModelAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteMLModelOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::DeleteMLModelAsync(DeleteMLModelRequest&& request, const DeleteMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::DeleteMLModelAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteMLModelOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::DeleteMLModelAsyncHelper(const DeleteMLModelRequest& request, const DeleteMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -473,12 +583,22 @@ DeleteRealtimeEndpointOutcome MachineLearningClient::DeleteRealtimeEndpoint(cons
 
 DeleteRealtimeEndpointOutcomeCallable MachineLearningClient::DeleteRealtimeEndpointCallable(const DeleteRealtimeEndpointRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::DeleteRealtimeEndpoint, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DeleteRealtimeEndpoint, Aws::Client::RejectedCallOutcome<DeleteRealtimeEndpointOutcome>(), this, request);
+}
+
+DeleteRealtimeEndpointOutcomeCallable MachineLearningClient::DeleteRealtimeEndpointCallable(DeleteRealtimeEndpointRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DeleteRealtimeEndpoint, Aws::Client::RejectedCallOutcome<DeleteRealtimeEndpointOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::DeleteRealtimeEndpointAsync(const DeleteRealtimeEndpointRequest& request, const DeleteRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::DeleteRealtimeEndpointAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::DeleteRealtimeEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRealtimeEndpointOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::DeleteRealtimeEndpointAsync(DeleteRealtimeEndpointRequest&& request, const DeleteRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::DeleteRealtimeEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRealtimeEndpointOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::DeleteRealtimeEndpointAsyncHelper(const DeleteRealtimeEndpointRequest& request, const DeleteRealtimeEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -504,12 +624,22 @@ DescribeBatchPredictionsOutcome MachineLearningClient::DescribeBatchPredictions(
 
 DescribeBatchPredictionsOutcomeCallable MachineLearningClient::DescribeBatchPredictionsCallable(const DescribeBatchPredictionsRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::DescribeBatchPredictions, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DescribeBatchPredictions, Aws::Client::RejectedCallOutcome<DescribeBatchPredictionsOutcome>(), this, request);
+}
+
+DescribeBatchPredictionsOutcomeCallable MachineLearningClient::DescribeBatchPredictionsCallable(DescribeBatchPredictionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DescribeBatchPredictions, Aws::Client::RejectedCallOutcome<DescribeBatchPredictionsOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::DescribeBatchPredictionsAsync(const DescribeBatchPredictionsRequest& request, const DescribeBatchPredictionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::DescribeBatchPredictionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::DescribeBatchPredictionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeBatchPredictionsOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::DescribeBatchPredictionsAsync(DescribeBatchPredictionsRequest&& request, const DescribeBatchPredictionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::DescribeBatchPredictionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeBatchPredictionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::DescribeBatchPredictionsAsyncHelper(const DescribeBatchPredictionsRequest& request, const DescribeBatchPredictionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -535,12 +665,22 @@ DescribeDataSourcesOutcome MachineLearningClient::DescribeDataSources(const Desc
 
 DescribeDataSourcesOutcomeCallable MachineLearningClient::DescribeDataSourcesCallable(const DescribeDataSourcesRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::DescribeDataSources, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DescribeDataSources, Aws::Client::RejectedCallOutcome<DescribeDataSourcesOutcome>(), this, request);
+}
+
+DescribeDataSourcesOutcomeCallable MachineLearningClient::DescribeDataSourcesCallable(DescribeDataSourcesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DescribeDataSources, Aws::Client::RejectedCallOutcome<DescribeDataSourcesOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::DescribeDataSourcesAsync(const DescribeDataSourcesRequest& request, const DescribeDataSourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::DescribeDataSourcesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::DescribeDataSourcesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDataSourcesOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::DescribeDataSourcesAsync(DescribeDataSourcesRequest&& request, const DescribeDataSourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::DescribeDataSourcesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDataSourcesOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::DescribeDataSourcesAsyncHelper(const DescribeDataSourcesRequest& request, const DescribeDataSourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -566,12 +706,22 @@ DescribeEvaluationsOutcome MachineLearningClient::DescribeEvaluations(const Desc
 
 DescribeEvaluationsOutcomeCallable MachineLearningClient::DescribeEvaluationsCallable(const DescribeEvaluationsRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::DescribeEvaluations, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DescribeEvaluations, Aws::Client::RejectedCallOutcome<DescribeEvaluationsOutcome>(), this, request);
+}
+
+DescribeEvaluationsOutcomeCallable MachineLearningClient::DescribeEvaluationsCallable(DescribeEvaluationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DescribeEvaluations, Aws::Client::RejectedCallOutcome<DescribeEvaluationsOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::DescribeEvaluationsAsync(const DescribeEvaluationsRequest& request, const DescribeEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::DescribeEvaluationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::DescribeEvaluationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEvaluationsOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::DescribeEvaluationsAsync(DescribeEvaluationsRequest&& request, const DescribeEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::DescribeEvaluationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEvaluationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::DescribeEvaluationsAsyncHelper(const DescribeEvaluationsRequest& request, const DescribeEvaluationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -597,12 +747,22 @@ DescribeMLModelsOutcome MachineLearningClient::DescribeMLModels(const DescribeML
 
 DescribeMLModelsOutcomeCallable MachineLearningClient::DescribeMLModelsCallable(const DescribeMLModelsRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::DescribeMLModels, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DescribeMLModels, Aws::Client::RejectedCallOutcome<DescribeMLModelsOutcome>(), this, request);
+}
+
+DescribeMLModelsOutcomeCallable MachineLearningClient::DescribeMLModelsCallable(DescribeMLModelsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::DescribeMLModels, Aws::Client::RejectedCallOutcome<DescribeMLModelsOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::DescribeMLModelsAsync(const DescribeMLModelsRequest& request, const DescribeMLModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::DescribeMLModelsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::DescribeMLModelsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMLModelsOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::DescribeMLModelsAsync(DescribeMLModelsRequest&& request, const DescribeMLModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::DescribeMLModelsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMLModelsOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::DescribeMLModelsAsyncHelper(const DescribeMLModelsRequest& request, const DescribeMLModelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -628,12 +788,22 @@ GetBatchPredictionOutcome MachineLearningClient::GetBatchPrediction(const GetBat
 
 GetBatchPredictionOutcomeCallable MachineLearningClient::GetBatchPredictionCallable(const GetBatchPredictionRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::GetBatchPrediction, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::GetBatchPrediction, Aws::Client::RejectedCallOutcome<GetBatchPredictionOutcome>(), this, request);
+}
+
+GetBatchPredictionOutcomeCallable MachineLearningClient::GetBatchPredictionCallable(GetBatchPredictionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::GetBatchPrediction, Aws::Client::RejectedCallOutcome<GetBatchPredictionOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::GetBatchPredictionAsync(const GetBatchPredictionRequest& request, const GetBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::GetBatchPredictionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::GetBatchPredictionAsyncHelper, Aws::Client::RejectedAsyncCall<GetBatchPredictionOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::GetBatchPredictionAsync(GetBatchPredictionRequest&& request, const GetBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::GetBatchPredictionAsyncHelper, Aws::Client::RejectedAsyncCall<GetBatchPredictionOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::GetBatchPredictionAsyncHelper(const GetBatchPredictionRequest& request, const GetBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -659,12 +829,22 @@ GetDataSourceOutcome MachineLearningClient::GetDataSource(const GetDataSourceReq
 
 GetDataSourceOutcomeCallable MachineLearningClient::GetDataSourceCallable(const GetDataSourceRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::GetDataSource, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::GetDataSource, Aws::Client::RejectedCallOutcome<GetDataSourceOutcome>(), this, request);
+}
+
+GetDataSourceOutcomeCallable MachineLearningClient::GetDataSourceCallable(GetDataSourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::GetDataSource, Aws::Client::RejectedCallOutcome<GetDataSourceOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::GetDataSourceAsync(const GetDataSourceRequest& request, const GetDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::GetDataSourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::GetDataSourceAsyncHelper, Aws::Client::RejectedAsyncCall<GetDataSourceOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::GetDataSourceAsync(GetDataSourceRequest&& request, const GetDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::GetDataSourceAsyncHelper, Aws::Client::RejectedAsyncCall<GetDataSourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::GetDataSourceAsyncHelper(const GetDataSourceRequest& request, const GetDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -690,12 +870,22 @@ GetEvaluationOutcome MachineLearningClient::GetEvaluation(const GetEvaluationReq
 
 GetEvaluationOutcomeCallable MachineLearningClient::GetEvaluationCallable(const GetEvaluationRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::GetEvaluation, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::GetEvaluation, Aws::Client::RejectedCallOutcome<GetEvaluationOutcome>(), this, request);
+}
+
+GetEvaluationOutcomeCallable MachineLearningClient::GetEvaluationCallable(GetEvaluationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::GetEvaluation, Aws::Client::RejectedCallOutcome<GetEvaluationOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::GetEvaluationAsync(const GetEvaluationRequest& request, const GetEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::GetEvaluationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::GetEvaluationAsyncHelper, Aws::Client::RejectedAsyncCall<GetEvaluationOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::GetEvaluationAsync(GetEvaluationRequest&& request, const GetEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::GetEvaluationAsyncHelper, Aws::Client::RejectedAsyncCall<GetEvaluationOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::GetEvaluationAsyncHelper(const GetEvaluationRequest& request, const GetEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -721,12 +911,22 @@ GetMLModelOutcome MachineLearningClient::GetMLModel(const GetMLModelRequest& req
 
 GetMLModelOutcomeCallable MachineLearningClient::GetMLModelCallable(const GetMLModelRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::GetMLModel, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::GetMLModel, Aws::Client::RejectedCallOutcome<GetMLModelOutcome>(), this, request);
+}
+
+GetMLModelOutcomeCallable MachineLearningClient::GetMLModelCallable(GetMLModelRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::GetMLModel, Aws::Client::RejectedCallOutcome<GetMLModelOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::GetMLModelAsync(const GetMLModelRequest& request, const GetMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::GetMLModelAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::GetMLModelAsyncHelper, Aws::Client::RejectedAsyncCall<GetMLModelOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::GetMLModelAsync(GetMLModelRequest&& request, const GetMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::GetMLModelAsyncHelper, Aws::Client::RejectedAsyncCall<GetMLModelOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::GetMLModelAsyncHelper(const GetMLModelRequest& request, const GetMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -752,12 +952,22 @@ PredictOutcome MachineLearningClient::Predict(const PredictRequest& request) con
 
 PredictOutcomeCallable MachineLearningClient::PredictCallable(const PredictRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::Predict, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::Predict, Aws::Client::RejectedCallOutcome<PredictOutcome>(), this, request);
+}
+
+PredictOutcomeCallable MachineLearningClient::PredictCallable(PredictRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::Predict, Aws::Client::RejectedCallOutcome<PredictOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::PredictAsync(const PredictRequest& request, const PredictResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::PredictAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::PredictAsyncHelper, Aws::Client::RejectedAsyncCall<PredictOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::PredictAsync(PredictRequest&& request, const PredictResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::PredictAsyncHelper, Aws::Client::RejectedAsyncCall<PredictOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::PredictAsyncHelper(const PredictRequest& request, const PredictResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -783,12 +993,22 @@ UpdateBatchPredictionOutcome MachineLearningClient::UpdateBatchPrediction(const
 
 UpdateBatchPredictionOutcomeCallable MachineLearningClient::UpdateBatchPredictionCallable(const UpdateBatchPredictionRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::UpdateBatchPrediction, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::UpdateBatchPrediction, Aws::Client::RejectedCallOutcome<UpdateBatchPredictionOutcome>(), this, request);
+}
+
+UpdateBatchPredictionOutcomeCallable MachineLearningClient::UpdateBatchPredictionCallable(UpdateBatchPredictionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::UpdateBatchPrediction, Aws::Client::RejectedCallOutcome<UpdateBatchPredictionOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::UpdateBatchPredictionAsync(const UpdateBatchPredictionRequest& request, const UpdateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::UpdateBatchPredictionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::UpdateBatchPredictionAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateBatchPredictionOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::UpdateBatchPredictionAsync(UpdateBatchPredictionRequest&& request, const UpdateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::UpdateBatchPredictionAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateBatchPredictionOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::UpdateBatchPredictionAsyncHelper(const UpdateBatchPredictionRequest& request, const UpdateBatchPredictionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -814,12 +1034,22 @@ UpdateDataSourceOutcome MachineLearningClient::UpdateDataSource(const UpdateData
 
 UpdateDataSourceOutcomeCallable MachineLearningClient::UpdateDataSourceCallable(const UpdateDataSourceRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::UpdateDataSource, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::UpdateDataSource, Aws::Client::RejectedCallOutcome<UpdateDataSourceOutcome>(), this, request);
+}
+
+UpdateDataSourceOutcomeCallable MachineLearningClient::UpdateDataSourceCallable(UpdateDataSourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::UpdateDataSource, Aws::Client::RejectedCallOutcome<UpdateDataSourceOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::UpdateDataSourceAsync(const UpdateDataSourceRequest& request, const UpdateDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::UpdateDataSourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::UpdateDataSourceAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDataSourceOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::UpdateDataSourceAsync(UpdateDataSourceRequest&& request, const UpdateDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::UpdateDataSourceAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDataSourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::UpdateDataSourceAsyncHelper(const UpdateDataSourceRequest& request, const UpdateDataSourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -845,12 +1075,22 @@ UpdateEvaluationOutcome MachineLearningClient::UpdateEvaluation(const UpdateEval
 
 UpdateEvaluationOutcomeCallable MachineLearningClient::UpdateEvaluationCallable(const UpdateEvaluationRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::UpdateEvaluation, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::UpdateEvaluation, Aws::Client::RejectedCallOutcome<UpdateEvaluationOutcome>(), this, request);
+}
+
+UpdateEvaluationOutcomeCallable MachineLearningClient::UpdateEvaluationCallable(UpdateEvaluationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::UpdateEvaluation, Aws::Client::RejectedCallOutcome<UpdateEvaluationOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::UpdateEvaluationAsync(const UpdateEvaluationRequest& request, const UpdateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::UpdateEvaluationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::UpdateEvaluationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateEvaluationOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::UpdateEvaluationAsync(UpdateEvaluationRequest&& request, const UpdateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::UpdateEvaluationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateEvaluationOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::UpdateEvaluationAsyncHelper(const UpdateEvaluationRequest& request, const UpdateEvaluationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -876,12 +1116,22 @@ UpdateMLModelOutcome MachineLearningClient::UpdateMLModel(const UpdateMLModelReq
 
 UpdateMLModelOutcomeCallable MachineLearningClient::UpdateMLModelCallable(const UpdateMLModelRequest& request) const
 {
-  return std::async(std::launch::async, &MachineLearningClient::UpdateMLModel, this, request);
+  return m_executor->SubmitWithFuture(&MachineLearningClient::UpdateMLModel, Aws::Client::RejectedCallOutcome<UpdateMLModelOutcome>(), this, request);
+}
+
+UpdateMLModelOutcomeCallable MachineLearningClient::UpdateMLModelCallable(UpdateMLModelRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MachineLearningClient::UpdateMLModel, Aws::Client::RejectedCallOutcome<UpdateMLModelOutcome>(), this, std::move(request));
 }
 
 void MachineLearningClient::UpdateMLModelAsync(const UpdateMLModelRequest& request, const UpdateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MachineLearningClient::UpdateMLModelAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MachineLearningClient::UpdateMLModelAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateMLModelOutcome>(), this, request, handler, context);
+}
+
+void MachineLearningClient::UpdateMLModelAsync(UpdateMLModelRequest&& request, const UpdateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MachineLearningClient::UpdateMLModelAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateMLModelOutcome>(), this, std::move(request), handler, context);
 }
 
 void MachineLearningClient::UpdateMLModelAsyncHelper(const UpdateMLModelRequest& request, const UpdateMLModelResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -23,6 +23,11 @@
 #include <aws/marketplacecommerceanalytics/model/GenerateDataSetResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/marketplacecommerceanalytics/model/GenerateDataSetRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -137,6 +142,11 @@ namespace Model
          */
         virtual Model::GenerateDataSetOutcomeCallable GenerateDataSetCallable(const Model::GenerateDataSetRequest& request) const;
 
+        /**
+         * Same as GenerateDataSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GenerateDataSetOutcomeCallable GenerateDataSetCallable(Model::GenerateDataSetRequest&& request) const;
+
         /**
          * Given a data set type and data set publication date, asynchronously publishes
          * the requested data set to the specified S3 bucket and notifies the specified SNS
@@ -153,6 +163,20 @@ namespace Model
          */
         virtual void GenerateDataSetAsync(const Model::GenerateDataSetRequest& request, const GenerateDataSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GenerateDataSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GenerateDataSetAsync(Model::GenerateDataSetRequest&& request, const GenerateDataSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::GenerateDataSetOutcome> GenerateDataSetAwaitable(const Model::GenerateDataSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MarketplaceCommerceAnalyticsClient::GenerateDataSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GenerateDataSetOutcome> GenerateDataSetAwaitable(Model::GenerateDataSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MarketplaceCommerceAnalyticsClient::GenerateDataSet, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -108,12 +108,22 @@ GenerateDataSetOutcome MarketplaceCommerceAnalyticsClient::GenerateDataSet(const
 
 GenerateDataSetOutcomeCallable MarketplaceCommerceAnalyticsClient::GenerateDataSetCallable(const GenerateDataSetRequest& request) const
 {
-  return std::async(std::launch::async, &MarketplaceCommerceAnalyticsClient::GenerateDataSet, this, request);
+  return m_executor->SubmitWithFuture(&MarketplaceCommerceAnalyticsClient::GenerateDataSet, Aws::Client::RejectedCallOutcome<GenerateDataSetOutcome>(), this, request);
+}
+
+GenerateDataSetOutcomeCallable MarketplaceCommerceAnalyticsClient::GenerateDataSetCallable(GenerateDataSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MarketplaceCommerceAnalyticsClient::GenerateDataSet, Aws::Client::RejectedCallOutcome<GenerateDataSetOutcome>(), this, std::move(request));
 }
 
 void MarketplaceCommerceAnalyticsClient::GenerateDataSetAsync(const GenerateDataSetRequest& request, const GenerateDataSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MarketplaceCommerceAnalyticsClient::GenerateDataSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MarketplaceCommerceAnalyticsClient::GenerateDataSetAsyncHelper, Aws::Client::RejectedAsyncCall<GenerateDataSetOutcome>(), this, request, handler, context);
+}
+
+void MarketplaceCommerceAnalyticsClient::GenerateDataSetAsync(GenerateDataSetRequest&& request, const GenerateDataSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MarketplaceCommerceAnalyticsClient::GenerateDataSetAsyncHelper, Aws::Client::RejectedAsyncCall<GenerateDataSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void MarketplaceCommerceAnalyticsClient::GenerateDataSetAsyncHelper(const GenerateDataSetRequest& request, const GenerateDataSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
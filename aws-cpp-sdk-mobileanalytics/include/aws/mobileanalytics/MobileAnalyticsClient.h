@@ -23,6 +23,11 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/mobileanalytics/model/PutEventsRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -124,6 +129,11 @@ namespace Model
          */
         virtual Model::PutEventsOutcomeCallable PutEventsCallable(const Model::PutEventsRequest& request) const;
 
+        /**
+         * Same as PutEventsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutEventsOutcomeCallable PutEventsCallable(Model::PutEventsRequest&& request) const;
+
         /**
          * <p>The PutEvents operation records one or more events. You can have up to 1,500
          * unique custom events per app, any combination of up to 40 attributes and metrics
@@ -133,6 +143,20 @@ namespace Model
          */
         virtual void PutEventsAsync(const Model::PutEventsRequest& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutEventsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutEventsAsync(Model::PutEventsRequest&& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::PutEventsOutcome> PutEventsAwaitable(const Model::PutEventsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MobileAnalyticsClient::PutEvents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutEventsOutcome> PutEventsAwaitable(Model::PutEventsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &MobileAnalyticsClient::PutEvents, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
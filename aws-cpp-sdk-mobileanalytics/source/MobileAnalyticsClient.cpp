@@ -108,12 +108,22 @@ PutEventsOutcome MobileAnalyticsClient::PutEvents(const PutEventsRequest& reques
 
 PutEventsOutcomeCallable MobileAnalyticsClient::PutEventsCallable(const PutEventsRequest& request) const
 {
-  return std::async(std::launch::async, &MobileAnalyticsClient::PutEvents, this, request);
+  return m_executor->SubmitWithFuture(&MobileAnalyticsClient::PutEvents, Aws::Client::RejectedCallOutcome<PutEventsOutcome>(), this, request);
+}
+
+PutEventsOutcomeCallable MobileAnalyticsClient::PutEventsCallable(PutEventsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&MobileAnalyticsClient::PutEvents, Aws::Client::RejectedCallOutcome<PutEventsOutcome>(), this, std::move(request));
 }
 
 void MobileAnalyticsClient::PutEventsAsync(const PutEventsRequest& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&MobileAnalyticsClient::PutEventsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&MobileAnalyticsClient::PutEventsAsyncHelper, Aws::Client::RejectedAsyncCall<PutEventsOutcome>(), this, request, handler, context);
+}
+
+void MobileAnalyticsClient::PutEventsAsync(PutEventsRequest&& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&MobileAnalyticsClient::PutEventsAsyncHelper, Aws::Client::RejectedAsyncCall<PutEventsOutcome>(), this, std::move(request), handler, context);
 }
 
 void MobileAnalyticsClient::PutEventsAsyncHelper(const PutEventsRequest& request, const PutEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
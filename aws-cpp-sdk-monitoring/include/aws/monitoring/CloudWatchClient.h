@@ -28,6 +28,21 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/monitoring/model/DeleteAlarmsRequest.h>
+#include <aws/monitoring/model/DescribeAlarmHistoryRequest.h>
+#include <aws/monitoring/model/DescribeAlarmsRequest.h>
+#include <aws/monitoring/model/DescribeAlarmsForMetricRequest.h>
+#include <aws/monitoring/model/DisableAlarmActionsRequest.h>
+#include <aws/monitoring/model/EnableAlarmActionsRequest.h>
+#include <aws/monitoring/model/GetMetricStatisticsRequest.h>
+#include <aws/monitoring/model/ListMetricsRequest.h>
+#include <aws/monitoring/model/PutMetricAlarmRequest.h>
+#include <aws/monitoring/model/PutMetricDataRequest.h>
+#include <aws/monitoring/model/SetAlarmStateRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -178,6 +193,11 @@ namespace Model
          */
         virtual Model::DeleteAlarmsOutcomeCallable DeleteAlarmsCallable(const Model::DeleteAlarmsRequest& request) const;
 
+        /**
+         * Same as DeleteAlarmsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteAlarmsOutcomeCallable DeleteAlarmsCallable(Model::DeleteAlarmsRequest&& request) const;
+
         /**
          * <p> Deletes all specified alarms. In the event of an error, no alarms are
          * deleted. </p>
@@ -186,6 +206,11 @@ namespace Model
          */
         virtual void DeleteAlarmsAsync(const Model::DeleteAlarmsRequest& request, const DeleteAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAlarmsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteAlarmsAsync(Model::DeleteAlarmsRequest&& request, const DeleteAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Retrieves history for the specified alarm. Filter alarms by date range or
          * item type. If an alarm name is not specified, Amazon CloudWatch returns
@@ -206,6 +231,11 @@ namespace Model
          */
         virtual Model::DescribeAlarmHistoryOutcomeCallable DescribeAlarmHistoryCallable(const Model::DescribeAlarmHistoryRequest& request) const;
 
+        /**
+         * Same as DescribeAlarmHistoryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAlarmHistoryOutcomeCallable DescribeAlarmHistoryCallable(Model::DescribeAlarmHistoryRequest&& request) const;
+
         /**
          * <p> Retrieves history for the specified alarm. Filter alarms by date range or
          * item type. If an alarm name is not specified, Amazon CloudWatch returns
@@ -217,6 +247,11 @@ namespace Model
          */
         virtual void DescribeAlarmHistoryAsync(const Model::DescribeAlarmHistoryRequest& request, const DescribeAlarmHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAlarmHistoryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAlarmHistoryAsync(Model::DescribeAlarmHistoryRequest&& request, const DescribeAlarmHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Retrieves alarms with the specified names. If no name is specified, all
          * alarms for the user are returned. Alarms can be retrieved by using only a prefix
@@ -233,6 +268,11 @@ namespace Model
          */
         virtual Model::DescribeAlarmsOutcomeCallable DescribeAlarmsCallable(const Model::DescribeAlarmsRequest& request) const;
 
+        /**
+         * Same as DescribeAlarmsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAlarmsOutcomeCallable DescribeAlarmsCallable(Model::DescribeAlarmsRequest&& request) const;
+
         /**
          * <p> Retrieves alarms with the specified names. If no name is specified, all
          * alarms for the user are returned. Alarms can be retrieved by using only a prefix
@@ -242,6 +282,11 @@ namespace Model
          */
         virtual void DescribeAlarmsAsync(const Model::DescribeAlarmsRequest& request, const DescribeAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAlarmsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAlarmsAsync(Model::DescribeAlarmsRequest&& request, const DescribeAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Retrieves all alarms for a single metric. Specify a statistic, period, or
          * unit to filter the set of alarms further. </p>
@@ -256,6 +301,11 @@ namespace Model
          */
         virtual Model::DescribeAlarmsForMetricOutcomeCallable DescribeAlarmsForMetricCallable(const Model::DescribeAlarmsForMetricRequest& request) const;
 
+        /**
+         * Same as DescribeAlarmsForMetricCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAlarmsForMetricOutcomeCallable DescribeAlarmsForMetricCallable(Model::DescribeAlarmsForMetricRequest&& request) const;
+
         /**
          * <p> Retrieves all alarms for a single metric. Specify a statistic, period, or
          * unit to filter the set of alarms further. </p>
@@ -264,6 +314,11 @@ namespace Model
          */
         virtual void DescribeAlarmsForMetricAsync(const Model::DescribeAlarmsForMetricRequest& request, const DescribeAlarmsForMetricResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAlarmsForMetricAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAlarmsForMetricAsync(Model::DescribeAlarmsForMetricRequest&& request, const DescribeAlarmsForMetricResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Disables actions for the specified alarms. When an alarm's actions are
          * disabled the alarm's state may change, but none of the alarm's actions will
@@ -280,6 +335,11 @@ namespace Model
          */
         virtual Model::DisableAlarmActionsOutcomeCallable DisableAlarmActionsCallable(const Model::DisableAlarmActionsRequest& request) const;
 
+        /**
+         * Same as DisableAlarmActionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableAlarmActionsOutcomeCallable DisableAlarmActionsCallable(Model::DisableAlarmActionsRequest&& request) const;
+
         /**
          * <p> Disables actions for the specified alarms. When an alarm's actions are
          * disabled the alarm's state may change, but none of the alarm's actions will
@@ -289,6 +349,11 @@ namespace Model
          */
         virtual void DisableAlarmActionsAsync(const Model::DisableAlarmActionsRequest& request, const DisableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableAlarmActionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableAlarmActionsAsync(Model::DisableAlarmActionsRequest&& request, const DisableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Enables actions for the specified alarms. </p>
          */
@@ -301,6 +366,11 @@ namespace Model
          */
         virtual Model::EnableAlarmActionsOutcomeCallable EnableAlarmActionsCallable(const Model::EnableAlarmActionsRequest& request) const;
 
+        /**
+         * Same as EnableAlarmActionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableAlarmActionsOutcomeCallable EnableAlarmActionsCallable(Model::EnableAlarmActionsRequest&& request) const;
+
         /**
          * <p> Enables actions for the specified alarms. </p>
          *
@@ -308,6 +378,11 @@ namespace Model
          */
         virtual void EnableAlarmActionsAsync(const Model::EnableAlarmActionsRequest& request, const EnableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableAlarmActionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableAlarmActionsAsync(Model::EnableAlarmActionsRequest&& request, const EnableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Gets statistics for the specified metric. </p> <p> The maximum number of
          * data points that can be queried is 50,850, whereas the maximum number of data
@@ -366,6 +441,11 @@ namespace Model
          */
         virtual Model::GetMetricStatisticsOutcomeCallable GetMetricStatisticsCallable(const Model::GetMetricStatisticsRequest& request) const;
 
+        /**
+         * Same as GetMetricStatisticsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetMetricStatisticsOutcomeCallable GetMetricStatisticsCallable(Model::GetMetricStatisticsRequest&& request) const;
+
         /**
          * <p> Gets statistics for the specified metric. </p> <p> The maximum number of
          * data points that can be queried is 50,850, whereas the maximum number of data
@@ -396,6 +476,11 @@ namespace Model
          */
         virtual void GetMetricStatisticsAsync(const Model::GetMetricStatisticsRequest& request, const GetMetricStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetMetricStatisticsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetMetricStatisticsAsync(Model::GetMetricStatisticsRequest&& request, const GetMetricStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of valid metrics stored for the AWS account owner. Returned
          * metrics can be used with <a>GetMetricStatistics</a> to obtain statistical data
@@ -424,6 +509,11 @@ namespace Model
          */
         virtual Model::ListMetricsOutcomeCallable ListMetricsCallable(const Model::ListMetricsRequest& request) const;
 
+        /**
+         * Same as ListMetricsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListMetricsOutcomeCallable ListMetricsCallable(Model::ListMetricsRequest&& request) const;
+
         /**
          * <p> Returns a list of valid metrics stored for the AWS account owner. Returned
          * metrics can be used with <a>GetMetricStatistics</a> to obtain statistical data
@@ -439,6 +529,11 @@ namespace Model
          */
         virtual void ListMetricsAsync(const Model::ListMetricsRequest& request, const ListMetricsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListMetricsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListMetricsAsync(Model::ListMetricsRequest&& request, const ListMetricsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates or updates an alarm and associates it with the specified Amazon
          * CloudWatch metric. Optionally, this operation can associate one or more Amazon
@@ -507,6 +602,11 @@ namespace Model
          */
         virtual Model::PutMetricAlarmOutcomeCallable PutMetricAlarmCallable(const Model::PutMetricAlarmRequest& request) const;
 
+        /**
+         * Same as PutMetricAlarmCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutMetricAlarmOutcomeCallable PutMetricAlarmCallable(Model::PutMetricAlarmRequest&& request) const;
+
         /**
          * <p> Creates or updates an alarm and associates it with the specified Amazon
          * CloudWatch metric. Optionally, this operation can associate one or more Amazon
@@ -542,6 +642,11 @@ namespace Model
          */
         virtual void PutMetricAlarmAsync(const Model::PutMetricAlarmRequest& request, const PutMetricAlarmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutMetricAlarmAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutMetricAlarmAsync(Model::PutMetricAlarmRequest&& request, const PutMetricAlarmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Publishes metric data points to Amazon CloudWatch. Amazon CloudWatch
          * associates the data points with the specified metric. If the specified metric
@@ -580,6 +685,11 @@ namespace Model
          */
         virtual Model::PutMetricDataOutcomeCallable PutMetricDataCallable(const Model::PutMetricDataRequest& request) const;
 
+        /**
+         * Same as PutMetricDataCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutMetricDataOutcomeCallable PutMetricDataCallable(Model::PutMetricDataRequest&& request) const;
+
         /**
          * <p> Publishes metric data points to Amazon CloudWatch. Amazon CloudWatch
          * associates the data points with the specified metric. If the specified metric
@@ -600,6 +710,11 @@ namespace Model
          */
         virtual void PutMetricDataAsync(const Model::PutMetricDataRequest& request, const PutMetricDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutMetricDataAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutMetricDataAsync(Model::PutMetricDataRequest&& request, const PutMetricDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Temporarily sets the state of an alarm. When the updated
          * <code>StateValue</code> differs from the previous value, the action configured
@@ -628,6 +743,11 @@ namespace Model
          */
         virtual Model::SetAlarmStateOutcomeCallable SetAlarmStateCallable(const Model::SetAlarmStateRequest& request) const;
 
+        /**
+         * Same as SetAlarmStateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetAlarmStateOutcomeCallable SetAlarmStateCallable(Model::SetAlarmStateRequest&& request) const;
+
         /**
          * <p> Temporarily sets the state of an alarm. When the updated
          * <code>StateValue</code> differs from the previous value, the action configured
@@ -643,6 +763,40 @@ namespace Model
          */
         virtual void SetAlarmStateAsync(const Model::SetAlarmStateRequest& request, const SetAlarmStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetAlarmStateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetAlarmStateAsync(Model::SetAlarmStateRequest&& request, const SetAlarmStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAlarmsOutcome> DeleteAlarmsAwaitable(const Model::DeleteAlarmsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::DeleteAlarms, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAlarmsOutcome> DeleteAlarmsAwaitable(Model::DeleteAlarmsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::DeleteAlarms, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAlarmHistoryOutcome> DescribeAlarmHistoryAwaitable(const Model::DescribeAlarmHistoryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::DescribeAlarmHistory, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAlarmHistoryOutcome> DescribeAlarmHistoryAwaitable(Model::DescribeAlarmHistoryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::DescribeAlarmHistory, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAlarmsOutcome> DescribeAlarmsAwaitable(const Model::DescribeAlarmsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::DescribeAlarms, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAlarmsOutcome> DescribeAlarmsAwaitable(Model::DescribeAlarmsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::DescribeAlarms, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAlarmsForMetricOutcome> DescribeAlarmsForMetricAwaitable(const Model::DescribeAlarmsForMetricRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::DescribeAlarmsForMetric, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAlarmsForMetricOutcome> DescribeAlarmsForMetricAwaitable(Model::DescribeAlarmsForMetricRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::DescribeAlarmsForMetric, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableAlarmActionsOutcome> DisableAlarmActionsAwaitable(const Model::DisableAlarmActionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::DisableAlarmActions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableAlarmActionsOutcome> DisableAlarmActionsAwaitable(Model::DisableAlarmActionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::DisableAlarmActions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableAlarmActionsOutcome> EnableAlarmActionsAwaitable(const Model::EnableAlarmActionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::EnableAlarmActions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableAlarmActionsOutcome> EnableAlarmActionsAwaitable(Model::EnableAlarmActionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::EnableAlarmActions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetMetricStatisticsOutcome> GetMetricStatisticsAwaitable(const Model::GetMetricStatisticsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::GetMetricStatistics, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetMetricStatisticsOutcome> GetMetricStatisticsAwaitable(Model::GetMetricStatisticsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::GetMetricStatistics, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListMetricsOutcome> ListMetricsAwaitable(const Model::ListMetricsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::ListMetrics, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListMetricsOutcome> ListMetricsAwaitable(Model::ListMetricsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::ListMetrics, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutMetricAlarmOutcome> PutMetricAlarmAwaitable(const Model::PutMetricAlarmRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::PutMetricAlarm, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutMetricAlarmOutcome> PutMetricAlarmAwaitable(Model::PutMetricAlarmRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::PutMetricAlarm, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutMetricDataOutcome> PutMetricDataAwaitable(const Model::PutMetricDataRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::PutMetricData, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutMetricDataOutcome> PutMetricDataAwaitable(Model::PutMetricDataRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::PutMetricData, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetAlarmStateOutcome> SetAlarmStateAwaitable(const Model::SetAlarmStateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::SetAlarmState, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetAlarmStateOutcome> SetAlarmStateAwaitable(Model::SetAlarmStateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &CloudWatchClient::SetAlarmState, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
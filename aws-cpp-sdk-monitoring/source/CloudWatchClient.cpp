@@ -118,12 +118,22 @@ DeleteAlarmsOutcome CloudWatchClient::DeleteAlarms(const DeleteAlarmsRequest& re
 
 DeleteAlarmsOutcomeCallable CloudWatchClient::DeleteAlarmsCallable(const DeleteAlarmsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchClient::DeleteAlarms, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchClient::DeleteAlarms, Aws::Client::RejectedCallOutcome<DeleteAlarmsOutcome>(), this, request);
+}
+
+DeleteAlarmsOutcomeCallable CloudWatchClient::DeleteAlarmsCallable(DeleteAlarmsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchClient::DeleteAlarms, Aws::Client::RejectedCallOutcome<DeleteAlarmsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchClient::DeleteAlarmsAsync(const DeleteAlarmsRequest& request, const DeleteAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchClient::DeleteAlarmsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchClient::DeleteAlarmsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAlarmsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchClient::DeleteAlarmsAsync(DeleteAlarmsRequest&& request, const DeleteAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchClient::DeleteAlarmsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAlarmsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchClient::DeleteAlarmsAsyncHelper(const DeleteAlarmsRequest& request, const DeleteAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -148,12 +158,22 @@ DescribeAlarmHistoryOutcome CloudWatchClient::DescribeAlarmHistory(const Describ
 
 DescribeAlarmHistoryOutcomeCallable CloudWatchClient::DescribeAlarmHistoryCallable(const DescribeAlarmHistoryRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchClient::DescribeAlarmHistory, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchClient::DescribeAlarmHistory, Aws::Client::RejectedCallOutcome<DescribeAlarmHistoryOutcome>(), this, request);
+}
+
+DescribeAlarmHistoryOutcomeCallable CloudWatchClient::DescribeAlarmHistoryCallable(DescribeAlarmHistoryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchClient::DescribeAlarmHistory, Aws::Client::RejectedCallOutcome<DescribeAlarmHistoryOutcome>(), this, std::move(request));
 }
 
 void CloudWatchClient::DescribeAlarmHistoryAsync(const DescribeAlarmHistoryRequest& request, const DescribeAlarmHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchClient::DescribeAlarmHistoryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchClient::DescribeAlarmHistoryAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAlarmHistoryOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchClient::DescribeAlarmHistoryAsync(DescribeAlarmHistoryRequest&& request, const DescribeAlarmHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchClient::DescribeAlarmHistoryAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAlarmHistoryOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchClient::DescribeAlarmHistoryAsyncHelper(const DescribeAlarmHistoryRequest& request, const DescribeAlarmHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -178,12 +198,22 @@ DescribeAlarmsOutcome CloudWatchClient::DescribeAlarms(const DescribeAlarmsReque
 
 DescribeAlarmsOutcomeCallable CloudWatchClient::DescribeAlarmsCallable(const DescribeAlarmsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchClient::DescribeAlarms, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchClient::DescribeAlarms, Aws::Client::RejectedCallOutcome<DescribeAlarmsOutcome>(), this, request);
+}
+
+DescribeAlarmsOutcomeCallable CloudWatchClient::DescribeAlarmsCallable(DescribeAlarmsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchClient::DescribeAlarms, Aws::Client::RejectedCallOutcome<DescribeAlarmsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchClient::DescribeAlarmsAsync(const DescribeAlarmsRequest& request, const DescribeAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchClient::DescribeAlarmsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchClient::DescribeAlarmsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAlarmsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchClient::DescribeAlarmsAsync(DescribeAlarmsRequest&& request, const DescribeAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchClient::DescribeAlarmsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAlarmsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchClient::DescribeAlarmsAsyncHelper(const DescribeAlarmsRequest& request, const DescribeAlarmsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -208,12 +238,22 @@ DescribeAlarmsForMetricOutcome CloudWatchClient::DescribeAlarmsForMetric(const D
 
 DescribeAlarmsForMetricOutcomeCallable CloudWatchClient::DescribeAlarmsForMetricCallable(const DescribeAlarmsForMetricRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchClient::DescribeAlarmsForMetric, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchClient::DescribeAlarmsForMetric, Aws::Client::RejectedCallOutcome<DescribeAlarmsForMetricOutcome>(), this, request);
+}
+
+DescribeAlarmsForMetricOutcomeCallable CloudWatchClient::DescribeAlarmsForMetricCallable(DescribeAlarmsForMetricRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchClient::DescribeAlarmsForMetric, Aws::Client::RejectedCallOutcome<DescribeAlarmsForMetricOutcome>(), this, std::move(request));
 }
 
 void CloudWatchClient::DescribeAlarmsForMetricAsync(const DescribeAlarmsForMetricRequest& request, const DescribeAlarmsForMetricResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchClient::DescribeAlarmsForMetricAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchClient::DescribeAlarmsForMetricAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAlarmsForMetricOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchClient::DescribeAlarmsForMetricAsync(DescribeAlarmsForMetricRequest&& request, const DescribeAlarmsForMetricResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchClient::DescribeAlarmsForMetricAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAlarmsForMetricOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchClient::DescribeAlarmsForMetricAsyncHelper(const DescribeAlarmsForMetricRequest& request, const DescribeAlarmsForMetricResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -238,12 +278,22 @@ DisableAlarmActionsOutcome CloudWatchClient::DisableAlarmActions(const DisableAl
 
 DisableAlarmActionsOutcomeCallable CloudWatchClient::DisableAlarmActionsCallable(const DisableAlarmActionsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchClient::DisableAlarmActions, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchClient::DisableAlarmActions, Aws::Client::RejectedCallOutcome<DisableAlarmActionsOutcome>(), this, request);
+}
+
+DisableAlarmActionsOutcomeCallable CloudWatchClient::DisableAlarmActionsCallable(DisableAlarmActionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchClient::DisableAlarmActions, Aws::Client::RejectedCallOutcome<DisableAlarmActionsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchClient::DisableAlarmActionsAsync(const DisableAlarmActionsRequest& request, const DisableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchClient::DisableAlarmActionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchClient::DisableAlarmActionsAsyncHelper, Aws::Client::RejectedAsyncCall<DisableAlarmActionsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchClient::DisableAlarmActionsAsync(DisableAlarmActionsRequest&& request, const DisableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchClient::DisableAlarmActionsAsyncHelper, Aws::Client::RejectedAsyncCall<DisableAlarmActionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchClient::DisableAlarmActionsAsyncHelper(const DisableAlarmActionsRequest& request, const DisableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -268,12 +318,22 @@ EnableAlarmActionsOutcome CloudWatchClient::EnableAlarmActions(const EnableAlarm
 
 EnableAlarmActionsOutcomeCallable CloudWatchClient::EnableAlarmActionsCallable(const EnableAlarmActionsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchClient::EnableAlarmActions, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchClient::EnableAlarmActions, Aws::Client::RejectedCallOutcome<EnableAlarmActionsOutcome>(), this, request);
+}
+
+EnableAlarmActionsOutcomeCallable CloudWatchClient::EnableAlarmActionsCallable(EnableAlarmActionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchClient::EnableAlarmActions, Aws::Client::RejectedCallOutcome<EnableAlarmActionsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchClient::EnableAlarmActionsAsync(const EnableAlarmActionsRequest& request, const EnableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchClient::EnableAlarmActionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchClient::EnableAlarmActionsAsyncHelper, Aws::Client::RejectedAsyncCall<EnableAlarmActionsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchClient::EnableAlarmActionsAsync(EnableAlarmActionsRequest&& request, const EnableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchClient::EnableAlarmActionsAsyncHelper, Aws::Client::RejectedAsyncCall<EnableAlarmActionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchClient::EnableAlarmActionsAsyncHelper(const EnableAlarmActionsRequest& request, const EnableAlarmActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -298,12 +358,22 @@ GetMetricStatisticsOutcome CloudWatchClient::GetMetricStatistics(const GetMetric
 
 GetMetricStatisticsOutcomeCallable CloudWatchClient::GetMetricStatisticsCallable(const GetMetricStatisticsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchClient::GetMetricStatistics, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchClient::GetMetricStatistics, Aws::Client::RejectedCallOutcome<GetMetricStatisticsOutcome>(), this, request);
+}
+
+GetMetricStatisticsOutcomeCallable CloudWatchClient::GetMetricStatisticsCallable(GetMetricStatisticsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchClient::GetMetricStatistics, Aws::Client::RejectedCallOutcome<GetMetricStatisticsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchClient::GetMetricStatisticsAsync(const GetMetricStatisticsRequest& request, const GetMetricStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchClient::GetMetricStatisticsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchClient::GetMetricStatisticsAsyncHelper, Aws::Client::RejectedAsyncCall<GetMetricStatisticsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchClient::GetMetricStatisticsAsync(GetMetricStatisticsRequest&& request, const GetMetricStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchClient::GetMetricStatisticsAsyncHelper, Aws::Client::RejectedAsyncCall<GetMetricStatisticsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchClient::GetMetricStatisticsAsyncHelper(const GetMetricStatisticsRequest& request, const GetMetricStatisticsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -328,12 +398,22 @@ ListMetricsOutcome CloudWatchClient::ListMetrics(const ListMetricsRequest& reque
 
 ListMetricsOutcomeCallable CloudWatchClient::ListMetricsCallable(const ListMetricsRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchClient::ListMetrics, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchClient::ListMetrics, Aws::Client::RejectedCallOutcome<ListMetricsOutcome>(), this, request);
+}
+
+ListMetricsOutcomeCallable CloudWatchClient::ListMetricsCallable(ListMetricsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchClient::ListMetrics, Aws::Client::RejectedCallOutcome<ListMetricsOutcome>(), this, std::move(request));
 }
 
 void CloudWatchClient::ListMetricsAsync(const ListMetricsRequest& request, const ListMetricsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchClient::ListMetricsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchClient::ListMetricsAsyncHelper, Aws::Client::RejectedAsyncCall<ListMetricsOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchClient::ListMetricsAsync(ListMetricsRequest&& request, const ListMetricsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchClient::ListMetricsAsyncHelper, Aws::Client::RejectedAsyncCall<ListMetricsOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchClient::ListMetricsAsyncHelper(const ListMetricsRequest& request, const ListMetricsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -358,12 +438,22 @@ PutMetricAlarmOutcome CloudWatchClient::PutMetricAlarm(const PutMetricAlarmReque
 
 PutMetricAlarmOutcomeCallable CloudWatchClient::PutMetricAlarmCallable(const PutMetricAlarmRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchClient::PutMetricAlarm, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchClient::PutMetricAlarm, Aws::Client::RejectedCallOutcome<PutMetricAlarmOutcome>(), this, request);
+}
+
+PutMetricAlarmOutcomeCallable CloudWatchClient::PutMetricAlarmCallable(PutMetricAlarmRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchClient::PutMetricAlarm, Aws::Client::RejectedCallOutcome<PutMetricAlarmOutcome>(), this, std::move(request));
 }
 
 void CloudWatchClient::PutMetricAlarmAsync(const PutMetricAlarmRequest& request, const PutMetricAlarmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchClient::PutMetricAlarmAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchClient::PutMetricAlarmAsyncHelper, Aws::Client::RejectedAsyncCall<PutMetricAlarmOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchClient::PutMetricAlarmAsync(PutMetricAlarmRequest&& request, const PutMetricAlarmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchClient::PutMetricAlarmAsyncHelper, Aws::Client::RejectedAsyncCall<PutMetricAlarmOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchClient::PutMetricAlarmAsyncHelper(const PutMetricAlarmRequest& request, const PutMetricAlarmResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -388,12 +478,22 @@ PutMetricDataOutcome CloudWatchClient::PutMetricData(const PutMetricDataRequest&
 
 PutMetricDataOutcomeCallable CloudWatchClient::PutMetricDataCallable(const PutMetricDataRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchClient::PutMetricData, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchClient::PutMetricData, Aws::Client::RejectedCallOutcome<PutMetricDataOutcome>(), this, request);
+}
+
+PutMetricDataOutcomeCallable CloudWatchClient::PutMetricDataCallable(PutMetricDataRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchClient::PutMetricData, Aws::Client::RejectedCallOutcome<PutMetricDataOutcome>(), this, std::move(request));
 }
 
 void CloudWatchClient::PutMetricDataAsync(const PutMetricDataRequest& request, const PutMetricDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchClient::PutMetricDataAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchClient::PutMetricDataAsyncHelper, Aws::Client::RejectedAsyncCall<PutMetricDataOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchClient::PutMetricDataAsync(PutMetricDataRequest&& request, const PutMetricDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchClient::PutMetricDataAsyncHelper, Aws::Client::RejectedAsyncCall<PutMetricDataOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchClient::PutMetricDataAsyncHelper(const PutMetricDataRequest& request, const PutMetricDataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -418,12 +518,22 @@ SetAlarmStateOutcome CloudWatchClient::SetAlarmState(const SetAlarmStateRequest&
 
 SetAlarmStateOutcomeCallable CloudWatchClient::SetAlarmStateCallable(const SetAlarmStateRequest& request) const
 {
-  return std::async(std::launch::async, &CloudWatchClient::SetAlarmState, this, request);
+  return m_executor->SubmitWithFuture(&CloudWatchClient::SetAlarmState, Aws::Client::RejectedCallOutcome<SetAlarmStateOutcome>(), this, request);
+}
+
+SetAlarmStateOutcomeCallable CloudWatchClient::SetAlarmStateCallable(SetAlarmStateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&CloudWatchClient::SetAlarmState, Aws::Client::RejectedCallOutcome<SetAlarmStateOutcome>(), this, std::move(request));
 }
 
 void CloudWatchClient::SetAlarmStateAsync(const SetAlarmStateRequest& request, const SetAlarmStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&CloudWatchClient::SetAlarmStateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&CloudWatchClient::SetAlarmStateAsyncHelper, Aws::Client::RejectedAsyncCall<SetAlarmStateOutcome>(), this, request, handler, context);
+}
+
+void CloudWatchClient::SetAlarmStateAsync(SetAlarmStateRequest&& request, const SetAlarmStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&CloudWatchClient::SetAlarmStateAsyncHelper, Aws::Client::RejectedAsyncCall<SetAlarmStateOutcome>(), this, std::move(request), handler, context);
 }
 
 void CloudWatchClient::SetAlarmStateAsyncHelper(const SetAlarmStateRequest& request, const SetAlarmStateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -57,6 +57,79 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/opsworks/model/AssignInstanceRequest.h>
+#include <aws/opsworks/model/AssignVolumeRequest.h>
+#include <aws/opsworks/model/AssociateElasticIpRequest.h>
+#include <aws/opsworks/model/AttachElasticLoadBalancerRequest.h>
+#include <aws/opsworks/model/CloneStackRequest.h>
+#include <aws/opsworks/model/CreateAppRequest.h>
+#include <aws/opsworks/model/CreateDeploymentRequest.h>
+#include <aws/opsworks/model/CreateInstanceRequest.h>
+#include <aws/opsworks/model/CreateLayerRequest.h>
+#include <aws/opsworks/model/CreateStackRequest.h>
+#include <aws/opsworks/model/CreateUserProfileRequest.h>
+#include <aws/opsworks/model/DeleteAppRequest.h>
+#include <aws/opsworks/model/DeleteInstanceRequest.h>
+#include <aws/opsworks/model/DeleteLayerRequest.h>
+#include <aws/opsworks/model/DeleteStackRequest.h>
+#include <aws/opsworks/model/DeleteUserProfileRequest.h>
+#include <aws/opsworks/model/DeregisterEcsClusterRequest.h>
+#include <aws/opsworks/model/DeregisterElasticIpRequest.h>
+#include <aws/opsworks/model/DeregisterInstanceRequest.h>
+#include <aws/opsworks/model/DeregisterRdsDbInstanceRequest.h>
+#include <aws/opsworks/model/DeregisterVolumeRequest.h>
+#include <aws/opsworks/model/DescribeAgentVersionsRequest.h>
+#include <aws/opsworks/model/DescribeAppsRequest.h>
+#include <aws/opsworks/model/DescribeCommandsRequest.h>
+#include <aws/opsworks/model/DescribeDeploymentsRequest.h>
+#include <aws/opsworks/model/DescribeEcsClustersRequest.h>
+#include <aws/opsworks/model/DescribeElasticIpsRequest.h>
+#include <aws/opsworks/model/DescribeElasticLoadBalancersRequest.h>
+#include <aws/opsworks/model/DescribeInstancesRequest.h>
+#include <aws/opsworks/model/DescribeLayersRequest.h>
+#include <aws/opsworks/model/DescribeLoadBasedAutoScalingRequest.h>
+#include <aws/opsworks/model/DescribePermissionsRequest.h>
+#include <aws/opsworks/model/DescribeRaidArraysRequest.h>
+#include <aws/opsworks/model/DescribeRdsDbInstancesRequest.h>
+#include <aws/opsworks/model/DescribeServiceErrorsRequest.h>
+#include <aws/opsworks/model/DescribeStackProvisioningParametersRequest.h>
+#include <aws/opsworks/model/DescribeStackSummaryRequest.h>
+#include <aws/opsworks/model/DescribeStacksRequest.h>
+#include <aws/opsworks/model/DescribeTimeBasedAutoScalingRequest.h>
+#include <aws/opsworks/model/DescribeUserProfilesRequest.h>
+#include <aws/opsworks/model/DescribeVolumesRequest.h>
+#include <aws/opsworks/model/DetachElasticLoadBalancerRequest.h>
+#include <aws/opsworks/model/DisassociateElasticIpRequest.h>
+#include <aws/opsworks/model/GetHostnameSuggestionRequest.h>
+#include <aws/opsworks/model/GrantAccessRequest.h>
+#include <aws/opsworks/model/RebootInstanceRequest.h>
+#include <aws/opsworks/model/RegisterEcsClusterRequest.h>
+#include <aws/opsworks/model/RegisterElasticIpRequest.h>
+#include <aws/opsworks/model/RegisterInstanceRequest.h>
+#include <aws/opsworks/model/RegisterRdsDbInstanceRequest.h>
+#include <aws/opsworks/model/RegisterVolumeRequest.h>
+#include <aws/opsworks/model/SetLoadBasedAutoScalingRequest.h>
+#include <aws/opsworks/model/SetPermissionRequest.h>
+#include <aws/opsworks/model/SetTimeBasedAutoScalingRequest.h>
+#include <aws/opsworks/model/StartInstanceRequest.h>
+#include <aws/opsworks/model/StartStackRequest.h>
+#include <aws/opsworks/model/StopInstanceRequest.h>
+#include <aws/opsworks/model/StopStackRequest.h>
+#include <aws/opsworks/model/UnassignInstanceRequest.h>
+#include <aws/opsworks/model/UnassignVolumeRequest.h>
+#include <aws/opsworks/model/UpdateAppRequest.h>
+#include <aws/opsworks/model/UpdateElasticIpRequest.h>
+#include <aws/opsworks/model/UpdateInstanceRequest.h>
+#include <aws/opsworks/model/UpdateLayerRequest.h>
+#include <aws/opsworks/model/UpdateMyUserProfileRequest.h>
+#include <aws/opsworks/model/UpdateRdsDbInstanceRequest.h>
+#include <aws/opsworks/model/UpdateStackRequest.h>
+#include <aws/opsworks/model/UpdateUserProfileRequest.h>
+#include <aws/opsworks/model/UpdateVolumeRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -481,6 +554,11 @@ namespace Model
          */
         virtual Model::AssignInstanceOutcomeCallable AssignInstanceCallable(const Model::AssignInstanceRequest& request) const;
 
+        /**
+         * Same as AssignInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AssignInstanceOutcomeCallable AssignInstanceCallable(Model::AssignInstanceRequest&& request) const;
+
         /**
          * <p>Assign a registered instance to a layer.</p> <ul> <li>You can assign
          * registered on-premises instances to any layer type.</li> <li>You can assign
@@ -497,6 +575,11 @@ namespace Model
          */
         virtual void AssignInstanceAsync(const Model::AssignInstanceRequest& request, const AssignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssignInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AssignInstanceAsync(Model::AssignInstanceRequest&& request, const AssignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Assigns one of the stack's registered Amazon EBS volumes to a specified
          * instance. The volume must first be registered with the stack by calling
@@ -531,6 +614,11 @@ namespace Model
          */
         virtual Model::AssignVolumeOutcomeCallable AssignVolumeCallable(const Model::AssignVolumeRequest& request) const;
 
+        /**
+         * Same as AssignVolumeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AssignVolumeOutcomeCallable AssignVolumeCallable(Model::AssignVolumeRequest&& request) const;
+
         /**
          * <p>Assigns one of the stack's registered Amazon EBS volumes to a specified
          * instance. The volume must first be registered with the stack by calling
@@ -549,6 +637,11 @@ namespace Model
          */
         virtual void AssignVolumeAsync(const Model::AssignVolumeRequest& request, const AssignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssignVolumeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AssignVolumeAsync(Model::AssignVolumeRequest&& request, const AssignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates one of the stack's registered Elastic IP addresses with a
          * specified instance. The address must first be registered with the stack by
@@ -579,6 +672,11 @@ namespace Model
          */
         virtual Model::AssociateElasticIpOutcomeCallable AssociateElasticIpCallable(const Model::AssociateElasticIpRequest& request) const;
 
+        /**
+         * Same as AssociateElasticIpCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AssociateElasticIpOutcomeCallable AssociateElasticIpCallable(Model::AssociateElasticIpRequest&& request) const;
+
         /**
          * <p>Associates one of the stack's registered Elastic IP addresses with a
          * specified instance. The address must first be registered with the stack by
@@ -595,6 +693,11 @@ namespace Model
          */
         virtual void AssociateElasticIpAsync(const Model::AssociateElasticIpRequest& request, const AssociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssociateElasticIpAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AssociateElasticIpAsync(Model::AssociateElasticIpRequest&& request, const AssociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Attaches an Elastic Load Balancing load balancer to a specified layer. For
          * more information, see <a
@@ -631,6 +734,11 @@ namespace Model
          */
         virtual Model::AttachElasticLoadBalancerOutcomeCallable AttachElasticLoadBalancerCallable(const Model::AttachElasticLoadBalancerRequest& request) const;
 
+        /**
+         * Same as AttachElasticLoadBalancerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AttachElasticLoadBalancerOutcomeCallable AttachElasticLoadBalancerCallable(Model::AttachElasticLoadBalancerRequest&& request) const;
+
         /**
          * <p>Attaches an Elastic Load Balancing load balancer to a specified layer. For
          * more information, see <a
@@ -650,6 +758,11 @@ namespace Model
          */
         virtual void AttachElasticLoadBalancerAsync(const Model::AttachElasticLoadBalancerRequest& request, const AttachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AttachElasticLoadBalancerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AttachElasticLoadBalancerAsync(Model::AttachElasticLoadBalancerRequest&& request, const AttachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a clone of a specified stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingstacks-cloning.html">Clone
@@ -676,6 +789,11 @@ namespace Model
          */
         virtual Model::CloneStackOutcomeCallable CloneStackCallable(const Model::CloneStackRequest& request) const;
 
+        /**
+         * Same as CloneStackCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CloneStackOutcomeCallable CloneStackCallable(Model::CloneStackRequest&& request) const;
+
         /**
          * <p>Creates a clone of a specified stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingstacks-cloning.html">Clone
@@ -690,6 +808,11 @@ namespace Model
          */
         virtual void CloneStackAsync(const Model::CloneStackRequest& request, const CloneStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CloneStackAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CloneStackAsync(Model::CloneStackRequest&& request, const CloneStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an app for a specified stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingapps-creating.html">Creating
@@ -714,6 +837,11 @@ namespace Model
          */
         virtual Model::CreateAppOutcomeCallable CreateAppCallable(const Model::CreateAppRequest& request) const;
 
+        /**
+         * Same as CreateAppCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateAppOutcomeCallable CreateAppCallable(Model::CreateAppRequest&& request) const;
+
         /**
          * <p>Creates an app for a specified stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingapps-creating.html">Creating
@@ -727,6 +855,11 @@ namespace Model
          */
         virtual void CreateAppAsync(const Model::CreateAppRequest& request, const CreateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAppAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateAppAsync(Model::CreateAppRequest&& request, const CreateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Runs deployment or stack commands. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingapps-deploying.html">Deploying
@@ -757,6 +890,11 @@ namespace Model
          */
         virtual Model::CreateDeploymentOutcomeCallable CreateDeploymentCallable(const Model::CreateDeploymentRequest& request) const;
 
+        /**
+         * Same as CreateDeploymentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDeploymentOutcomeCallable CreateDeploymentCallable(Model::CreateDeploymentRequest&& request) const;
+
         /**
          * <p>Runs deployment or stack commands. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingapps-deploying.html">Deploying
@@ -773,6 +911,11 @@ namespace Model
          */
         virtual void CreateDeploymentAsync(const Model::CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDeploymentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDeploymentAsync(Model::CreateDeploymentRequest&& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an instance in a specified stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-add.html">Adding
@@ -799,6 +942,11 @@ namespace Model
          */
         virtual Model::CreateInstanceOutcomeCallable CreateInstanceCallable(const Model::CreateInstanceRequest& request) const;
 
+        /**
+         * Same as CreateInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateInstanceOutcomeCallable CreateInstanceCallable(Model::CreateInstanceRequest&& request) const;
+
         /**
          * <p>Creates an instance in a specified stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-add.html">Adding
@@ -813,6 +961,11 @@ namespace Model
          */
         virtual void CreateInstanceAsync(const Model::CreateInstanceRequest& request, const CreateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateInstanceAsync(Model::CreateInstanceRequest&& request, const CreateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a layer. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinglayers-basics-create.html">How
@@ -849,6 +1002,11 @@ namespace Model
          */
         virtual Model::CreateLayerOutcomeCallable CreateLayerCallable(const Model::CreateLayerRequest& request) const;
 
+        /**
+         * Same as CreateLayerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateLayerOutcomeCallable CreateLayerCallable(Model::CreateLayerRequest&& request) const;
+
         /**
          * <p>Creates a layer. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinglayers-basics-create.html">How
@@ -868,6 +1026,11 @@ namespace Model
          */
         virtual void CreateLayerAsync(const Model::CreateLayerRequest& request, const CreateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateLayerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateLayerAsync(Model::CreateLayerRequest&& request, const CreateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingstacks-edit.html">Create
@@ -892,6 +1055,11 @@ namespace Model
          */
         virtual Model::CreateStackOutcomeCallable CreateStackCallable(const Model::CreateStackRequest& request) const;
 
+        /**
+         * Same as CreateStackCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateStackOutcomeCallable CreateStackCallable(Model::CreateStackRequest&& request) const;
+
         /**
          * <p>Creates a new stack. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingstacks-edit.html">Create
@@ -905,6 +1073,11 @@ namespace Model
          */
         virtual void CreateStackAsync(const Model::CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateStackAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateStackAsync(Model::CreateStackRequest&& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new user profile.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have an attached policy that explicitly grants
@@ -925,6 +1098,11 @@ namespace Model
          */
         virtual Model::CreateUserProfileOutcomeCallable CreateUserProfileCallable(const Model::CreateUserProfileRequest& request) const;
 
+        /**
+         * Same as CreateUserProfileCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateUserProfileOutcomeCallable CreateUserProfileCallable(Model::CreateUserProfileRequest&& request) const;
+
         /**
          * <p>Creates a new user profile.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have an attached policy that explicitly grants
@@ -936,6 +1114,11 @@ namespace Model
          */
         virtual void CreateUserProfileAsync(const Model::CreateUserProfileRequest& request, const CreateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateUserProfileAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateUserProfileAsync(Model::CreateUserProfileRequest&& request, const CreateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a specified app.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -958,6 +1141,11 @@ namespace Model
          */
         virtual Model::DeleteAppOutcomeCallable DeleteAppCallable(const Model::DeleteAppRequest& request) const;
 
+        /**
+         * Same as DeleteAppCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteAppOutcomeCallable DeleteAppCallable(Model::DeleteAppRequest&& request) const;
+
         /**
          * <p>Deletes a specified app.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -970,6 +1158,11 @@ namespace Model
          */
         virtual void DeleteAppAsync(const Model::DeleteAppRequest& request, const DeleteAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAppAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteAppAsync(Model::DeleteAppRequest&& request, const DeleteAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a specified instance, which terminates the associated Amazon EC2
          * instance. You must stop an instance before you can delete it.</p> <p>For more
@@ -1000,6 +1193,11 @@ namespace Model
          */
         virtual Model::DeleteInstanceOutcomeCallable DeleteInstanceCallable(const Model::DeleteInstanceRequest& request) const;
 
+        /**
+         * Same as DeleteInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteInstanceOutcomeCallable DeleteInstanceCallable(Model::DeleteInstanceRequest&& request) const;
+
         /**
          * <p>Deletes a specified instance, which terminates the associated Amazon EC2
          * instance. You must stop an instance before you can delete it.</p> <p>For more
@@ -1016,6 +1214,11 @@ namespace Model
          */
         virtual void DeleteInstanceAsync(const Model::DeleteInstanceRequest& request, const DeleteInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteInstanceAsync(Model::DeleteInstanceRequest&& request, const DeleteInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a specified layer. You must first stop and then delete all associated
          * instances or unassign registered instances. For more information, see <a
@@ -1044,6 +1247,11 @@ namespace Model
          */
         virtual Model::DeleteLayerOutcomeCallable DeleteLayerCallable(const Model::DeleteLayerRequest& request) const;
 
+        /**
+         * Same as DeleteLayerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteLayerOutcomeCallable DeleteLayerCallable(Model::DeleteLayerRequest&& request) const;
+
         /**
          * <p>Deletes a specified layer. You must first stop and then delete all associated
          * instances or unassign registered instances. For more information, see <a
@@ -1059,6 +1267,11 @@ namespace Model
          */
         virtual void DeleteLayerAsync(const Model::DeleteLayerRequest& request, const DeleteLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteLayerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteLayerAsync(Model::DeleteLayerRequest&& request, const DeleteLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a specified stack. You must first delete all instances, layers, and
          * apps or deregister registered instances. For more information, see <a
@@ -1087,6 +1300,11 @@ namespace Model
          */
         virtual Model::DeleteStackOutcomeCallable DeleteStackCallable(const Model::DeleteStackRequest& request) const;
 
+        /**
+         * Same as DeleteStackCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteStackOutcomeCallable DeleteStackCallable(Model::DeleteStackRequest&& request) const;
+
         /**
          * <p>Deletes a specified stack. You must first delete all instances, layers, and
          * apps or deregister registered instances. For more information, see <a
@@ -1102,6 +1320,11 @@ namespace Model
          */
         virtual void DeleteStackAsync(const Model::DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteStackAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteStackAsync(Model::DeleteStackRequest&& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a user profile.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have an attached policy that explicitly grants
@@ -1122,6 +1345,11 @@ namespace Model
          */
         virtual Model::DeleteUserProfileOutcomeCallable DeleteUserProfileCallable(const Model::DeleteUserProfileRequest& request) const;
 
+        /**
+         * Same as DeleteUserProfileCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteUserProfileOutcomeCallable DeleteUserProfileCallable(Model::DeleteUserProfileRequest&& request) const;
+
         /**
          * <p>Deletes a user profile.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have an attached policy that explicitly grants
@@ -1133,6 +1361,11 @@ namespace Model
          */
         virtual void DeleteUserProfileAsync(const Model::DeleteUserProfileRequest& request, const DeleteUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteUserProfileAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteUserProfileAsync(Model::DeleteUserProfileRequest&& request, const DeleteUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters a specified Amazon ECS cluster from a stack. For more
          * information, see <a
@@ -1159,6 +1392,11 @@ namespace Model
          */
         virtual Model::DeregisterEcsClusterOutcomeCallable DeregisterEcsClusterCallable(const Model::DeregisterEcsClusterRequest& request) const;
 
+        /**
+         * Same as DeregisterEcsClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeregisterEcsClusterOutcomeCallable DeregisterEcsClusterCallable(Model::DeregisterEcsClusterRequest&& request) const;
+
         /**
          * <p>Deregisters a specified Amazon ECS cluster from a stack. For more
          * information, see <a
@@ -1173,6 +1411,11 @@ namespace Model
          */
         virtual void DeregisterEcsClusterAsync(const Model::DeregisterEcsClusterRequest& request, const DeregisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterEcsClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeregisterEcsClusterAsync(Model::DeregisterEcsClusterRequest&& request, const DeregisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters a specified Elastic IP address. The address can then be
          * registered by another stack. For more information, see <a
@@ -1201,6 +1444,11 @@ namespace Model
          */
         virtual Model::DeregisterElasticIpOutcomeCallable DeregisterElasticIpCallable(const Model::DeregisterElasticIpRequest& request) const;
 
+        /**
+         * Same as DeregisterElasticIpCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeregisterElasticIpOutcomeCallable DeregisterElasticIpCallable(Model::DeregisterElasticIpRequest&& request) const;
+
         /**
          * <p>Deregisters a specified Elastic IP address. The address can then be
          * registered by another stack. For more information, see <a
@@ -1216,6 +1464,11 @@ namespace Model
          */
         virtual void DeregisterElasticIpAsync(const Model::DeregisterElasticIpRequest& request, const DeregisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterElasticIpAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeregisterElasticIpAsync(Model::DeregisterElasticIpRequest&& request, const DeregisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregister a registered Amazon EC2 or on-premises instance. This action
          * removes the instance from the stack and returns it to your control. This action
@@ -1242,6 +1495,11 @@ namespace Model
          */
         virtual Model::DeregisterInstanceOutcomeCallable DeregisterInstanceCallable(const Model::DeregisterInstanceRequest& request) const;
 
+        /**
+         * Same as DeregisterInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeregisterInstanceOutcomeCallable DeregisterInstanceCallable(Model::DeregisterInstanceRequest&& request) const;
+
         /**
          * <p>Deregister a registered Amazon EC2 or on-premises instance. This action
          * removes the instance from the stack and returns it to your control. This action
@@ -1256,6 +1514,11 @@ namespace Model
          */
         virtual void DeregisterInstanceAsync(const Model::DeregisterInstanceRequest& request, const DeregisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeregisterInstanceAsync(Model::DeregisterInstanceRequest&& request, const DeregisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters an Amazon RDS instance.</p> <p><b>Required Permissions</b>: To
          * use this action, an IAM user must have a Manage permissions level for the stack,
@@ -1278,6 +1541,11 @@ namespace Model
          */
         virtual Model::DeregisterRdsDbInstanceOutcomeCallable DeregisterRdsDbInstanceCallable(const Model::DeregisterRdsDbInstanceRequest& request) const;
 
+        /**
+         * Same as DeregisterRdsDbInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeregisterRdsDbInstanceOutcomeCallable DeregisterRdsDbInstanceCallable(Model::DeregisterRdsDbInstanceRequest&& request) const;
+
         /**
          * <p>Deregisters an Amazon RDS instance.</p> <p><b>Required Permissions</b>: To
          * use this action, an IAM user must have a Manage permissions level for the stack,
@@ -1290,6 +1558,11 @@ namespace Model
          */
         virtual void DeregisterRdsDbInstanceAsync(const Model::DeregisterRdsDbInstanceRequest& request, const DeregisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterRdsDbInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeregisterRdsDbInstanceAsync(Model::DeregisterRdsDbInstanceRequest&& request, const DeregisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deregisters an Amazon EBS volume. The volume can then be registered by
          * another stack. For more information, see <a
@@ -1318,6 +1591,11 @@ namespace Model
          */
         virtual Model::DeregisterVolumeOutcomeCallable DeregisterVolumeCallable(const Model::DeregisterVolumeRequest& request) const;
 
+        /**
+         * Same as DeregisterVolumeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeregisterVolumeOutcomeCallable DeregisterVolumeCallable(Model::DeregisterVolumeRequest&& request) const;
+
         /**
          * <p>Deregisters an Amazon EBS volume. The volume can then be registered by
          * another stack. For more information, see <a
@@ -1333,6 +1611,11 @@ namespace Model
          */
         virtual void DeregisterVolumeAsync(const Model::DeregisterVolumeRequest& request, const DeregisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeregisterVolumeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeregisterVolumeAsync(Model::DeregisterVolumeRequest&& request, const DeregisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the available AWS OpsWorks agent versions. You must specify a stack
          * ID or a configuration manager. <code>DescribeAgentVersions</code> returns a list
@@ -1351,6 +1634,11 @@ namespace Model
          */
         virtual Model::DescribeAgentVersionsOutcomeCallable DescribeAgentVersionsCallable(const Model::DescribeAgentVersionsRequest& request) const;
 
+        /**
+         * Same as DescribeAgentVersionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAgentVersionsOutcomeCallable DescribeAgentVersionsCallable(Model::DescribeAgentVersionsRequest&& request) const;
+
         /**
          * <p>Describes the available AWS OpsWorks agent versions. You must specify a stack
          * ID or a configuration manager. <code>DescribeAgentVersions</code> returns a list
@@ -1361,6 +1649,11 @@ namespace Model
          */
         virtual void DescribeAgentVersionsAsync(const Model::DescribeAgentVersionsRequest& request, const DescribeAgentVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAgentVersionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAgentVersionsAsync(Model::DescribeAgentVersionsRequest&& request, const DescribeAgentVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a description of a specified set of apps.</p> <note> <p>You must
          * specify at least one of the parameters.</p> </note> <p><b>Required
@@ -1385,6 +1678,11 @@ namespace Model
          */
         virtual Model::DescribeAppsOutcomeCallable DescribeAppsCallable(const Model::DescribeAppsRequest& request) const;
 
+        /**
+         * Same as DescribeAppsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAppsOutcomeCallable DescribeAppsCallable(Model::DescribeAppsRequest&& request) const;
+
         /**
          * <p>Requests a description of a specified set of apps.</p> <note> <p>You must
          * specify at least one of the parameters.</p> </note> <p><b>Required
@@ -1398,6 +1696,11 @@ namespace Model
          */
         virtual void DescribeAppsAsync(const Model::DescribeAppsRequest& request, const DescribeAppsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAppsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAppsAsync(Model::DescribeAppsRequest&& request, const DescribeAppsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the results of specified commands.</p> <note> <p>You must specify
          * at least one of the parameters.</p> </note> <p><b>Required Permissions</b>: To
@@ -1422,6 +1725,11 @@ namespace Model
          */
         virtual Model::DescribeCommandsOutcomeCallable DescribeCommandsCallable(const Model::DescribeCommandsRequest& request) const;
 
+        /**
+         * Same as DescribeCommandsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCommandsOutcomeCallable DescribeCommandsCallable(Model::DescribeCommandsRequest&& request) const;
+
         /**
          * <p>Describes the results of specified commands.</p> <note> <p>You must specify
          * at least one of the parameters.</p> </note> <p><b>Required Permissions</b>: To
@@ -1435,6 +1743,11 @@ namespace Model
          */
         virtual void DescribeCommandsAsync(const Model::DescribeCommandsRequest& request, const DescribeCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCommandsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCommandsAsync(Model::DescribeCommandsRequest&& request, const DescribeCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a description of a specified set of deployments.</p> <note> <p>You
          * must specify at least one of the parameters.</p> </note> <p><b>Required
@@ -1459,6 +1772,11 @@ namespace Model
          */
         virtual Model::DescribeDeploymentsOutcomeCallable DescribeDeploymentsCallable(const Model::DescribeDeploymentsRequest& request) const;
 
+        /**
+         * Same as DescribeDeploymentsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDeploymentsOutcomeCallable DescribeDeploymentsCallable(Model::DescribeDeploymentsRequest&& request) const;
+
         /**
          * <p>Requests a description of a specified set of deployments.</p> <note> <p>You
          * must specify at least one of the parameters.</p> </note> <p><b>Required
@@ -1472,6 +1790,11 @@ namespace Model
          */
         virtual void DescribeDeploymentsAsync(const Model::DescribeDeploymentsRequest& request, const DescribeDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDeploymentsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDeploymentsAsync(Model::DescribeDeploymentsRequest&& request, const DescribeDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes Amazon ECS clusters that are registered with a stack. If you
          * specify only a stack ID, you can use the <code>MaxResults</code> and
@@ -1502,6 +1825,11 @@ namespace Model
          */
         virtual Model::DescribeEcsClustersOutcomeCallable DescribeEcsClustersCallable(const Model::DescribeEcsClustersRequest& request) const;
 
+        /**
+         * Same as DescribeEcsClustersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEcsClustersOutcomeCallable DescribeEcsClustersCallable(Model::DescribeEcsClustersRequest&& request) const;
+
         /**
          * <p>Describes Amazon ECS clusters that are registered with a stack. If you
          * specify only a stack ID, you can use the <code>MaxResults</code> and
@@ -1518,6 +1846,11 @@ namespace Model
          */
         virtual void DescribeEcsClustersAsync(const Model::DescribeEcsClustersRequest& request, const DescribeEcsClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEcsClustersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEcsClustersAsync(Model::DescribeEcsClustersRequest&& request, const DescribeEcsClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes <a
          * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/elastic-ip-addresses-eip.html">Elastic
@@ -1546,6 +1879,11 @@ namespace Model
          */
         virtual Model::DescribeElasticIpsOutcomeCallable DescribeElasticIpsCallable(const Model::DescribeElasticIpsRequest& request) const;
 
+        /**
+         * Same as DescribeElasticIpsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeElasticIpsOutcomeCallable DescribeElasticIpsCallable(Model::DescribeElasticIpsRequest&& request) const;
+
         /**
          * <p>Describes <a
          * href="http://docs.aws.amazon.com/AWSEC2/latest/UserGuide/elastic-ip-addresses-eip.html">Elastic
@@ -1561,6 +1899,11 @@ namespace Model
          */
         virtual void DescribeElasticIpsAsync(const Model::DescribeElasticIpsRequest& request, const DescribeElasticIpsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeElasticIpsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeElasticIpsAsync(Model::DescribeElasticIpsRequest&& request, const DescribeElasticIpsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes a stack's Elastic Load Balancing instances.</p> <note> <p>You must
          * specify at least one of the parameters.</p> </note> <p><b>Required
@@ -1585,6 +1928,11 @@ namespace Model
          */
         virtual Model::DescribeElasticLoadBalancersOutcomeCallable DescribeElasticLoadBalancersCallable(const Model::DescribeElasticLoadBalancersRequest& request) const;
 
+        /**
+         * Same as DescribeElasticLoadBalancersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeElasticLoadBalancersOutcomeCallable DescribeElasticLoadBalancersCallable(Model::DescribeElasticLoadBalancersRequest&& request) const;
+
         /**
          * <p>Describes a stack's Elastic Load Balancing instances.</p> <note> <p>You must
          * specify at least one of the parameters.</p> </note> <p><b>Required
@@ -1598,6 +1946,11 @@ namespace Model
          */
         virtual void DescribeElasticLoadBalancersAsync(const Model::DescribeElasticLoadBalancersRequest& request, const DescribeElasticLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeElasticLoadBalancersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeElasticLoadBalancersAsync(Model::DescribeElasticLoadBalancersRequest&& request, const DescribeElasticLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a description of a set of instances.</p> <note> <p>You must specify
          * at least one of the parameters.</p> </note> <p><b>Required Permissions</b>: To
@@ -1622,6 +1975,11 @@ namespace Model
          */
         virtual Model::DescribeInstancesOutcomeCallable DescribeInstancesCallable(const Model::DescribeInstancesRequest& request) const;
 
+        /**
+         * Same as DescribeInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeInstancesOutcomeCallable DescribeInstancesCallable(Model::DescribeInstancesRequest&& request) const;
+
         /**
          * <p>Requests a description of a set of instances.</p> <note> <p>You must specify
          * at least one of the parameters.</p> </note> <p><b>Required Permissions</b>: To
@@ -1635,6 +1993,11 @@ namespace Model
          */
         virtual void DescribeInstancesAsync(const Model::DescribeInstancesRequest& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeInstancesAsync(Model::DescribeInstancesRequest&& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a description of one or more layers in a specified stack.</p> <note>
          * <p>You must specify at least one of the parameters.</p> </note> <p><b>Required
@@ -1659,6 +2022,11 @@ namespace Model
          */
         virtual Model::DescribeLayersOutcomeCallable DescribeLayersCallable(const Model::DescribeLayersRequest& request) const;
 
+        /**
+         * Same as DescribeLayersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLayersOutcomeCallable DescribeLayersCallable(Model::DescribeLayersRequest&& request) const;
+
         /**
          * <p>Requests a description of one or more layers in a specified stack.</p> <note>
          * <p>You must specify at least one of the parameters.</p> </note> <p><b>Required
@@ -1672,6 +2040,11 @@ namespace Model
          */
         virtual void DescribeLayersAsync(const Model::DescribeLayersRequest& request, const DescribeLayersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLayersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLayersAsync(Model::DescribeLayersRequest&& request, const DescribeLayersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes load-based auto scaling configurations for specified layers.</p>
          * <note> <p>You must specify at least one of the parameters.</p> </note>
@@ -1698,6 +2071,11 @@ namespace Model
          */
         virtual Model::DescribeLoadBasedAutoScalingOutcomeCallable DescribeLoadBasedAutoScalingCallable(const Model::DescribeLoadBasedAutoScalingRequest& request) const;
 
+        /**
+         * Same as DescribeLoadBasedAutoScalingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLoadBasedAutoScalingOutcomeCallable DescribeLoadBasedAutoScalingCallable(Model::DescribeLoadBasedAutoScalingRequest&& request) const;
+
         /**
          * <p>Describes load-based auto scaling configurations for specified layers.</p>
          * <note> <p>You must specify at least one of the parameters.</p> </note>
@@ -1712,6 +2090,11 @@ namespace Model
          */
         virtual void DescribeLoadBasedAutoScalingAsync(const Model::DescribeLoadBasedAutoScalingRequest& request, const DescribeLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoadBasedAutoScalingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLoadBasedAutoScalingAsync(Model::DescribeLoadBasedAutoScalingRequest&& request, const DescribeLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes a user's SSH information.</p> <p><b>Required Permissions</b>: To
          * use this action, an IAM user must have self-management enabled or an attached
@@ -1767,6 +2150,11 @@ namespace Model
          */
         virtual Model::DescribePermissionsOutcomeCallable DescribePermissionsCallable(const Model::DescribePermissionsRequest& request) const;
 
+        /**
+         * Same as DescribePermissionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribePermissionsOutcomeCallable DescribePermissionsCallable(Model::DescribePermissionsRequest&& request) const;
+
         /**
          * <p>Describes the permissions for a specified stack.</p> <p><b>Required
          * Permissions</b>: To use this action, an IAM user must have a Manage permissions
@@ -1779,6 +2167,11 @@ namespace Model
          */
         virtual void DescribePermissionsAsync(const Model::DescribePermissionsRequest& request, const DescribePermissionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribePermissionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribePermissionsAsync(Model::DescribePermissionsRequest&& request, const DescribePermissionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describe an instance's RAID arrays.</p> <note> <p>You must specify at least
          * one of the parameters.</p> </note> <p><b>Required Permissions</b>: To use this
@@ -1803,6 +2196,11 @@ namespace Model
          */
         virtual Model::DescribeRaidArraysOutcomeCallable DescribeRaidArraysCallable(const Model::DescribeRaidArraysRequest& request) const;
 
+        /**
+         * Same as DescribeRaidArraysCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeRaidArraysOutcomeCallable DescribeRaidArraysCallable(Model::DescribeRaidArraysRequest&& request) const;
+
         /**
          * <p>Describe an instance's RAID arrays.</p> <note> <p>You must specify at least
          * one of the parameters.</p> </note> <p><b>Required Permissions</b>: To use this
@@ -1816,6 +2214,11 @@ namespace Model
          */
         virtual void DescribeRaidArraysAsync(const Model::DescribeRaidArraysRequest& request, const DescribeRaidArraysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRaidArraysAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeRaidArraysAsync(Model::DescribeRaidArraysRequest&& request, const DescribeRaidArraysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes Amazon RDS instances.</p> <p><b>Required Permissions</b>: To use
          * this action, an IAM user must have a Show, Deploy, or Manage permissions level
@@ -1838,6 +2241,11 @@ namespace Model
          */
         virtual Model::DescribeRdsDbInstancesOutcomeCallable DescribeRdsDbInstancesCallable(const Model::DescribeRdsDbInstancesRequest& request) const;
 
+        /**
+         * Same as DescribeRdsDbInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeRdsDbInstancesOutcomeCallable DescribeRdsDbInstancesCallable(Model::DescribeRdsDbInstancesRequest&& request) const;
+
         /**
          * <p>Describes Amazon RDS instances.</p> <p><b>Required Permissions</b>: To use
          * this action, an IAM user must have a Show, Deploy, or Manage permissions level
@@ -1850,6 +2258,11 @@ namespace Model
          */
         virtual void DescribeRdsDbInstancesAsync(const Model::DescribeRdsDbInstancesRequest& request, const DescribeRdsDbInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeRdsDbInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeRdsDbInstancesAsync(Model::DescribeRdsDbInstancesRequest&& request, const DescribeRdsDbInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes AWS OpsWorks service errors.</p> <p><b>Required Permissions</b>: To
          * use this action, an IAM user must have a Show, Deploy, or Manage permissions
@@ -1872,6 +2285,11 @@ namespace Model
          */
         virtual Model::DescribeServiceErrorsOutcomeCallable DescribeServiceErrorsCallable(const Model::DescribeServiceErrorsRequest& request) const;
 
+        /**
+         * Same as DescribeServiceErrorsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeServiceErrorsOutcomeCallable DescribeServiceErrorsCallable(Model::DescribeServiceErrorsRequest&& request) const;
+
         /**
          * <p>Describes AWS OpsWorks service errors.</p> <p><b>Required Permissions</b>: To
          * use this action, an IAM user must have a Show, Deploy, or Manage permissions
@@ -1884,6 +2302,11 @@ namespace Model
          */
         virtual void DescribeServiceErrorsAsync(const Model::DescribeServiceErrorsRequest& request, const DescribeServiceErrorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeServiceErrorsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeServiceErrorsAsync(Model::DescribeServiceErrorsRequest&& request, const DescribeServiceErrorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a description of a stack's provisioning parameters.</p>
          * <p><b>Required Permissions</b>: To use this action, an IAM user must have a
@@ -1908,6 +2331,11 @@ namespace Model
          */
         virtual Model::DescribeStackProvisioningParametersOutcomeCallable DescribeStackProvisioningParametersCallable(const Model::DescribeStackProvisioningParametersRequest& request) const;
 
+        /**
+         * Same as DescribeStackProvisioningParametersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeStackProvisioningParametersOutcomeCallable DescribeStackProvisioningParametersCallable(Model::DescribeStackProvisioningParametersRequest&& request) const;
+
         /**
          * <p>Requests a description of a stack's provisioning parameters.</p>
          * <p><b>Required Permissions</b>: To use this action, an IAM user must have a
@@ -1921,6 +2349,11 @@ namespace Model
          */
         virtual void DescribeStackProvisioningParametersAsync(const Model::DescribeStackProvisioningParametersRequest& request, const DescribeStackProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStackProvisioningParametersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeStackProvisioningParametersAsync(Model::DescribeStackProvisioningParametersRequest&& request, const DescribeStackProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the number of layers and apps in a specified stack, and the number
          * of instances in each state, such as <code>running_setup</code> or
@@ -1947,6 +2380,11 @@ namespace Model
          */
         virtual Model::DescribeStackSummaryOutcomeCallable DescribeStackSummaryCallable(const Model::DescribeStackSummaryRequest& request) const;
 
+        /**
+         * Same as DescribeStackSummaryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeStackSummaryOutcomeCallable DescribeStackSummaryCallable(Model::DescribeStackSummaryRequest&& request) const;
+
         /**
          * <p>Describes the number of layers and apps in a specified stack, and the number
          * of instances in each state, such as <code>running_setup</code> or
@@ -1961,6 +2399,11 @@ namespace Model
          */
         virtual void DescribeStackSummaryAsync(const Model::DescribeStackSummaryRequest& request, const DescribeStackSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStackSummaryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeStackSummaryAsync(Model::DescribeStackSummaryRequest&& request, const DescribeStackSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a description of one or more stacks.</p> <p><b>Required
          * Permissions</b>: To use this action, an IAM user must have a Show, Deploy, or
@@ -1983,6 +2426,11 @@ namespace Model
          */
         virtual Model::DescribeStacksOutcomeCallable DescribeStacksCallable(const Model::DescribeStacksRequest& request) const;
 
+        /**
+         * Same as DescribeStacksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeStacksOutcomeCallable DescribeStacksCallable(Model::DescribeStacksRequest&& request) const;
+
         /**
          * <p>Requests a description of one or more stacks.</p> <p><b>Required
          * Permissions</b>: To use this action, an IAM user must have a Show, Deploy, or
@@ -1995,6 +2443,11 @@ namespace Model
          */
         virtual void DescribeStacksAsync(const Model::DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStacksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeStacksAsync(Model::DescribeStacksRequest&& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes time-based auto scaling configurations for specified instances.</p>
          * <note> <p>You must specify at least one of the parameters.</p> </note>
@@ -2021,6 +2474,11 @@ namespace Model
          */
         virtual Model::DescribeTimeBasedAutoScalingOutcomeCallable DescribeTimeBasedAutoScalingCallable(const Model::DescribeTimeBasedAutoScalingRequest& request) const;
 
+        /**
+         * Same as DescribeTimeBasedAutoScalingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTimeBasedAutoScalingOutcomeCallable DescribeTimeBasedAutoScalingCallable(Model::DescribeTimeBasedAutoScalingRequest&& request) const;
+
         /**
          * <p>Describes time-based auto scaling configurations for specified instances.</p>
          * <note> <p>You must specify at least one of the parameters.</p> </note>
@@ -2035,6 +2493,11 @@ namespace Model
          */
         virtual void DescribeTimeBasedAutoScalingAsync(const Model::DescribeTimeBasedAutoScalingRequest& request, const DescribeTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTimeBasedAutoScalingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTimeBasedAutoScalingAsync(Model::DescribeTimeBasedAutoScalingRequest&& request, const DescribeTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describe specified users.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have an attached policy that explicitly grants
@@ -2055,6 +2518,11 @@ namespace Model
          */
         virtual Model::DescribeUserProfilesOutcomeCallable DescribeUserProfilesCallable(const Model::DescribeUserProfilesRequest& request) const;
 
+        /**
+         * Same as DescribeUserProfilesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeUserProfilesOutcomeCallable DescribeUserProfilesCallable(Model::DescribeUserProfilesRequest&& request) const;
+
         /**
          * <p>Describe specified users.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have an attached policy that explicitly grants
@@ -2066,6 +2534,11 @@ namespace Model
          */
         virtual void DescribeUserProfilesAsync(const Model::DescribeUserProfilesRequest& request, const DescribeUserProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeUserProfilesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeUserProfilesAsync(Model::DescribeUserProfilesRequest&& request, const DescribeUserProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes an instance's Amazon EBS volumes.</p> <note> <p>You must specify at
          * least one of the parameters.</p> </note> <p><b>Required Permissions</b>: To use
@@ -2090,6 +2563,11 @@ namespace Model
          */
         virtual Model::DescribeVolumesOutcomeCallable DescribeVolumesCallable(const Model::DescribeVolumesRequest& request) const;
 
+        /**
+         * Same as DescribeVolumesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVolumesOutcomeCallable DescribeVolumesCallable(Model::DescribeVolumesRequest&& request) const;
+
         /**
          * <p>Describes an instance's Amazon EBS volumes.</p> <note> <p>You must specify at
          * least one of the parameters.</p> </note> <p><b>Required Permissions</b>: To use
@@ -2103,6 +2581,11 @@ namespace Model
          */
         virtual void DescribeVolumesAsync(const Model::DescribeVolumesRequest& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVolumesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVolumesAsync(Model::DescribeVolumesRequest&& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Detaches a specified Elastic Load Balancing instance from its layer.</p>
          * <p><b>Required Permissions</b>: To use this action, an IAM user must have a
@@ -2125,6 +2608,11 @@ namespace Model
          */
         virtual Model::DetachElasticLoadBalancerOutcomeCallable DetachElasticLoadBalancerCallable(const Model::DetachElasticLoadBalancerRequest& request) const;
 
+        /**
+         * Same as DetachElasticLoadBalancerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DetachElasticLoadBalancerOutcomeCallable DetachElasticLoadBalancerCallable(Model::DetachElasticLoadBalancerRequest&& request) const;
+
         /**
          * <p>Detaches a specified Elastic Load Balancing instance from its layer.</p>
          * <p><b>Required Permissions</b>: To use this action, an IAM user must have a
@@ -2137,6 +2625,11 @@ namespace Model
          */
         virtual void DetachElasticLoadBalancerAsync(const Model::DetachElasticLoadBalancerRequest& request, const DetachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DetachElasticLoadBalancerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DetachElasticLoadBalancerAsync(Model::DetachElasticLoadBalancerRequest&& request, const DetachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disassociates an Elastic IP address from its instance. The address remains
          * registered with the stack. For more information, see <a
@@ -2165,6 +2658,11 @@ namespace Model
          */
         virtual Model::DisassociateElasticIpOutcomeCallable DisassociateElasticIpCallable(const Model::DisassociateElasticIpRequest& request) const;
 
+        /**
+         * Same as DisassociateElasticIpCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisassociateElasticIpOutcomeCallable DisassociateElasticIpCallable(Model::DisassociateElasticIpRequest&& request) const;
+
         /**
          * <p>Disassociates an Elastic IP address from its instance. The address remains
          * registered with the stack. For more information, see <a
@@ -2180,6 +2678,11 @@ namespace Model
          */
         virtual void DisassociateElasticIpAsync(const Model::DisassociateElasticIpRequest& request, const DisassociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisassociateElasticIpAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisassociateElasticIpAsync(Model::DisassociateElasticIpRequest&& request, const DisassociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets a generated host name for the specified layer, based on the current host
          * name theme.</p> <p><b>Required Permissions</b>: To use this action, an IAM user
@@ -2202,6 +2705,11 @@ namespace Model
          */
         virtual Model::GetHostnameSuggestionOutcomeCallable GetHostnameSuggestionCallable(const Model::GetHostnameSuggestionRequest& request) const;
 
+        /**
+         * Same as GetHostnameSuggestionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetHostnameSuggestionOutcomeCallable GetHostnameSuggestionCallable(Model::GetHostnameSuggestionRequest&& request) const;
+
         /**
          * <p>Gets a generated host name for the specified layer, based on the current host
          * name theme.</p> <p><b>Required Permissions</b>: To use this action, an IAM user
@@ -2214,6 +2722,11 @@ namespace Model
          */
         virtual void GetHostnameSuggestionAsync(const Model::GetHostnameSuggestionRequest& request, const GetHostnameSuggestionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetHostnameSuggestionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetHostnameSuggestionAsync(Model::GetHostnameSuggestionRequest&& request, const GetHostnameSuggestionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <note>This action can be used only with Windows stacks.</note> <p>Grants RDP
          * access to a Windows instance for a specified time period.</p>
@@ -2228,6 +2741,11 @@ namespace Model
          */
         virtual Model::GrantAccessOutcomeCallable GrantAccessCallable(const Model::GrantAccessRequest& request) const;
 
+        /**
+         * Same as GrantAccessCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GrantAccessOutcomeCallable GrantAccessCallable(Model::GrantAccessRequest&& request) const;
+
         /**
          * <note>This action can be used only with Windows stacks.</note> <p>Grants RDP
          * access to a Windows instance for a specified time period.</p>
@@ -2236,6 +2754,11 @@ namespace Model
          */
         virtual void GrantAccessAsync(const Model::GrantAccessRequest& request, const GrantAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GrantAccessAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GrantAccessAsync(Model::GrantAccessRequest&& request, const GrantAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Reboots a specified instance. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-starting.html">Starting,
@@ -2262,6 +2785,11 @@ namespace Model
          */
         virtual Model::RebootInstanceOutcomeCallable RebootInstanceCallable(const Model::RebootInstanceRequest& request) const;
 
+        /**
+         * Same as RebootInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RebootInstanceOutcomeCallable RebootInstanceCallable(Model::RebootInstanceRequest&& request) const;
+
         /**
          * <p>Reboots a specified instance. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-starting.html">Starting,
@@ -2276,6 +2804,11 @@ namespace Model
          */
         virtual void RebootInstanceAsync(const Model::RebootInstanceRequest& request, const RebootInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebootInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RebootInstanceAsync(Model::RebootInstanceRequest&& request, const RebootInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers a specified Amazon ECS cluster with a stack. You can register only
          * one cluster with a stack. A cluster can be registered with only one stack. For
@@ -2306,6 +2839,11 @@ namespace Model
          */
         virtual Model::RegisterEcsClusterOutcomeCallable RegisterEcsClusterCallable(const Model::RegisterEcsClusterRequest& request) const;
 
+        /**
+         * Same as RegisterEcsClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterEcsClusterOutcomeCallable RegisterEcsClusterCallable(Model::RegisterEcsClusterRequest&& request) const;
+
         /**
          * <p>Registers a specified Amazon ECS cluster with a stack. You can register only
          * one cluster with a stack. A cluster can be registered with only one stack. For
@@ -2322,6 +2860,11 @@ namespace Model
          */
         virtual void RegisterEcsClusterAsync(const Model::RegisterEcsClusterRequest& request, const RegisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterEcsClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterEcsClusterAsync(Model::RegisterEcsClusterRequest&& request, const RegisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers an Elastic IP address with a specified stack. An address can be
          * registered with only one stack at a time. If the address is already registered,
@@ -2354,6 +2897,11 @@ namespace Model
          */
         virtual Model::RegisterElasticIpOutcomeCallable RegisterElasticIpCallable(const Model::RegisterElasticIpRequest& request) const;
 
+        /**
+         * Same as RegisterElasticIpCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterElasticIpOutcomeCallable RegisterElasticIpCallable(Model::RegisterElasticIpRequest&& request) const;
+
         /**
          * <p>Registers an Elastic IP address with a specified stack. An address can be
          * registered with only one stack at a time. If the address is already registered,
@@ -2371,6 +2919,11 @@ namespace Model
          */
         virtual void RegisterElasticIpAsync(const Model::RegisterElasticIpRequest& request, const RegisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterElasticIpAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterElasticIpAsync(Model::RegisterElasticIpRequest&& request, const RegisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers instances with a specified stack that were created outside of AWS
          * OpsWorks.</p> <note>We do not recommend using this action to register instances.
@@ -2409,6 +2962,11 @@ namespace Model
          */
         virtual Model::RegisterInstanceOutcomeCallable RegisterInstanceCallable(const Model::RegisterInstanceRequest& request) const;
 
+        /**
+         * Same as RegisterInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterInstanceOutcomeCallable RegisterInstanceCallable(Model::RegisterInstanceRequest&& request) const;
+
         /**
          * <p>Registers instances with a specified stack that were created outside of AWS
          * OpsWorks.</p> <note>We do not recommend using this action to register instances.
@@ -2429,6 +2987,11 @@ namespace Model
          */
         virtual void RegisterInstanceAsync(const Model::RegisterInstanceRequest& request, const RegisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterInstanceAsync(Model::RegisterInstanceRequest&& request, const RegisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers an Amazon RDS instance with a stack.</p> <p><b>Required
          * Permissions</b>: To use this action, an IAM user must have a Manage permissions
@@ -2451,6 +3014,11 @@ namespace Model
          */
         virtual Model::RegisterRdsDbInstanceOutcomeCallable RegisterRdsDbInstanceCallable(const Model::RegisterRdsDbInstanceRequest& request) const;
 
+        /**
+         * Same as RegisterRdsDbInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterRdsDbInstanceOutcomeCallable RegisterRdsDbInstanceCallable(Model::RegisterRdsDbInstanceRequest&& request) const;
+
         /**
          * <p>Registers an Amazon RDS instance with a stack.</p> <p><b>Required
          * Permissions</b>: To use this action, an IAM user must have a Manage permissions
@@ -2463,6 +3031,11 @@ namespace Model
          */
         virtual void RegisterRdsDbInstanceAsync(const Model::RegisterRdsDbInstanceRequest& request, const RegisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterRdsDbInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterRdsDbInstanceAsync(Model::RegisterRdsDbInstanceRequest&& request, const RegisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers an Amazon EBS volume with a specified stack. A volume can be
          * registered with only one stack at a time. If the volume is already registered,
@@ -2495,6 +3068,11 @@ namespace Model
          */
         virtual Model::RegisterVolumeOutcomeCallable RegisterVolumeCallable(const Model::RegisterVolumeRequest& request) const;
 
+        /**
+         * Same as RegisterVolumeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterVolumeOutcomeCallable RegisterVolumeCallable(Model::RegisterVolumeRequest&& request) const;
+
         /**
          * <p>Registers an Amazon EBS volume with a specified stack. A volume can be
          * registered with only one stack at a time. If the volume is already registered,
@@ -2512,6 +3090,11 @@ namespace Model
          */
         virtual void RegisterVolumeAsync(const Model::RegisterVolumeRequest& request, const RegisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterVolumeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterVolumeAsync(Model::RegisterVolumeRequest&& request, const RegisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Specify the load-based auto scaling configuration for a specified layer. For
          * more information, see <a
@@ -2548,6 +3131,11 @@ namespace Model
          */
         virtual Model::SetLoadBasedAutoScalingOutcomeCallable SetLoadBasedAutoScalingCallable(const Model::SetLoadBasedAutoScalingRequest& request) const;
 
+        /**
+         * Same as SetLoadBasedAutoScalingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetLoadBasedAutoScalingOutcomeCallable SetLoadBasedAutoScalingCallable(Model::SetLoadBasedAutoScalingRequest&& request) const;
+
         /**
          * <p>Specify the load-based auto scaling configuration for a specified layer. For
          * more information, see <a
@@ -2567,6 +3155,11 @@ namespace Model
          */
         virtual void SetLoadBasedAutoScalingAsync(const Model::SetLoadBasedAutoScalingRequest& request, const SetLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetLoadBasedAutoScalingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetLoadBasedAutoScalingAsync(Model::SetLoadBasedAutoScalingRequest&& request, const SetLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Specifies a user's permissions. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingsecurity.html">Security
@@ -2593,6 +3186,11 @@ namespace Model
          */
         virtual Model::SetPermissionOutcomeCallable SetPermissionCallable(const Model::SetPermissionRequest& request) const;
 
+        /**
+         * Same as SetPermissionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetPermissionOutcomeCallable SetPermissionCallable(Model::SetPermissionRequest&& request) const;
+
         /**
          * <p>Specifies a user's permissions. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workingsecurity.html">Security
@@ -2607,6 +3205,11 @@ namespace Model
          */
         virtual void SetPermissionAsync(const Model::SetPermissionRequest& request, const SetPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetPermissionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetPermissionAsync(Model::SetPermissionRequest&& request, const SetPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Specify the time-based auto scaling configuration for a specified instance.
          * For more information, see <a
@@ -2635,6 +3238,11 @@ namespace Model
          */
         virtual Model::SetTimeBasedAutoScalingOutcomeCallable SetTimeBasedAutoScalingCallable(const Model::SetTimeBasedAutoScalingRequest& request) const;
 
+        /**
+         * Same as SetTimeBasedAutoScalingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetTimeBasedAutoScalingOutcomeCallable SetTimeBasedAutoScalingCallable(Model::SetTimeBasedAutoScalingRequest&& request) const;
+
         /**
          * <p>Specify the time-based auto scaling configuration for a specified instance.
          * For more information, see <a
@@ -2650,6 +3258,11 @@ namespace Model
          */
         virtual void SetTimeBasedAutoScalingAsync(const Model::SetTimeBasedAutoScalingRequest& request, const SetTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetTimeBasedAutoScalingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetTimeBasedAutoScalingAsync(Model::SetTimeBasedAutoScalingRequest&& request, const SetTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts a specified instance. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-starting.html">Starting,
@@ -2676,6 +3289,11 @@ namespace Model
          */
         virtual Model::StartInstanceOutcomeCallable StartInstanceCallable(const Model::StartInstanceRequest& request) const;
 
+        /**
+         * Same as StartInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StartInstanceOutcomeCallable StartInstanceCallable(Model::StartInstanceRequest&& request) const;
+
         /**
          * <p>Starts a specified instance. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/workinginstances-starting.html">Starting,
@@ -2690,6 +3308,11 @@ namespace Model
          */
         virtual void StartInstanceAsync(const Model::StartInstanceRequest& request, const StartInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StartInstanceAsync(Model::StartInstanceRequest&& request, const StartInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts a stack's instances. </p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -2712,6 +3335,11 @@ namespace Model
          */
         virtual Model::StartStackOutcomeCallable StartStackCallable(const Model::StartStackRequest& request) const;
 
+        /**
+         * Same as StartStackCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StartStackOutcomeCallable StartStackCallable(Model::StartStackRequest&& request) const;
+
         /**
          * <p>Starts a stack's instances. </p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -2724,6 +3352,11 @@ namespace Model
          */
         virtual void StartStackAsync(const Model::StartStackRequest& request, const StartStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartStackAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StartStackAsync(Model::StartStackRequest&& request, const StartStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stops a specified instance. When you stop a standard instance, the data
          * disappears and must be reinstalled when you restart the instance. You can stop
@@ -2754,6 +3387,11 @@ namespace Model
          */
         virtual Model::StopInstanceOutcomeCallable StopInstanceCallable(const Model::StopInstanceRequest& request) const;
 
+        /**
+         * Same as StopInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StopInstanceOutcomeCallable StopInstanceCallable(Model::StopInstanceRequest&& request) const;
+
         /**
          * <p>Stops a specified instance. When you stop a standard instance, the data
          * disappears and must be reinstalled when you restart the instance. You can stop
@@ -2770,6 +3408,11 @@ namespace Model
          */
         virtual void StopInstanceAsync(const Model::StopInstanceRequest& request, const StopInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StopInstanceAsync(Model::StopInstanceRequest&& request, const StopInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stops a specified stack.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -2792,6 +3435,11 @@ namespace Model
          */
         virtual Model::StopStackOutcomeCallable StopStackCallable(const Model::StopStackRequest& request) const;
 
+        /**
+         * Same as StopStackCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StopStackOutcomeCallable StopStackCallable(Model::StopStackRequest&& request) const;
+
         /**
          * <p>Stops a specified stack.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -2804,6 +3452,11 @@ namespace Model
          */
         virtual void StopStackAsync(const Model::StopStackRequest& request, const StopStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StopStackAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StopStackAsync(Model::StopStackRequest&& request, const StopStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Unassigns a registered instance from all of it's layers. The instance remains
          * in the stack as an unassigned instance and can be assigned to another layer, as
@@ -2830,6 +3483,11 @@ namespace Model
          */
         virtual Model::UnassignInstanceOutcomeCallable UnassignInstanceCallable(const Model::UnassignInstanceRequest& request) const;
 
+        /**
+         * Same as UnassignInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UnassignInstanceOutcomeCallable UnassignInstanceCallable(Model::UnassignInstanceRequest&& request) const;
+
         /**
          * <p>Unassigns a registered instance from all of it's layers. The instance remains
          * in the stack as an unassigned instance and can be assigned to another layer, as
@@ -2844,6 +3502,11 @@ namespace Model
          */
         virtual void UnassignInstanceAsync(const Model::UnassignInstanceRequest& request, const UnassignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnassignInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UnassignInstanceAsync(Model::UnassignInstanceRequest&& request, const UnassignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Unassigns an assigned Amazon EBS volume. The volume remains registered with
          * the stack. For more information, see <a
@@ -2872,6 +3535,11 @@ namespace Model
          */
         virtual Model::UnassignVolumeOutcomeCallable UnassignVolumeCallable(const Model::UnassignVolumeRequest& request) const;
 
+        /**
+         * Same as UnassignVolumeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UnassignVolumeOutcomeCallable UnassignVolumeCallable(Model::UnassignVolumeRequest&& request) const;
+
         /**
          * <p>Unassigns an assigned Amazon EBS volume. The volume remains registered with
          * the stack. For more information, see <a
@@ -2887,6 +3555,11 @@ namespace Model
          */
         virtual void UnassignVolumeAsync(const Model::UnassignVolumeRequest& request, const UnassignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnassignVolumeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UnassignVolumeAsync(Model::UnassignVolumeRequest&& request, const UnassignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a specified app.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Deploy or Manage permissions level for the
@@ -2909,6 +3582,11 @@ namespace Model
          */
         virtual Model::UpdateAppOutcomeCallable UpdateAppCallable(const Model::UpdateAppRequest& request) const;
 
+        /**
+         * Same as UpdateAppCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateAppOutcomeCallable UpdateAppCallable(Model::UpdateAppRequest&& request) const;
+
         /**
          * <p>Updates a specified app.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Deploy or Manage permissions level for the
@@ -2921,6 +3599,11 @@ namespace Model
          */
         virtual void UpdateAppAsync(const Model::UpdateAppRequest& request, const UpdateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAppAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateAppAsync(Model::UpdateAppRequest&& request, const UpdateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a registered Elastic IP address's name. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/resources.html">Resource
@@ -2947,6 +3630,11 @@ namespace Model
          */
         virtual Model::UpdateElasticIpOutcomeCallable UpdateElasticIpCallable(const Model::UpdateElasticIpRequest& request) const;
 
+        /**
+         * Same as UpdateElasticIpCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateElasticIpOutcomeCallable UpdateElasticIpCallable(Model::UpdateElasticIpRequest&& request) const;
+
         /**
          * <p>Updates a registered Elastic IP address's name. For more information, see <a
          * href="http://docs.aws.amazon.com/opsworks/latest/userguide/resources.html">Resource
@@ -2961,6 +3649,11 @@ namespace Model
          */
         virtual void UpdateElasticIpAsync(const Model::UpdateElasticIpRequest& request, const UpdateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateElasticIpAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateElasticIpAsync(Model::UpdateElasticIpRequest&& request, const UpdateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a specified instance.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -2983,6 +3676,11 @@ namespace Model
          */
         virtual Model::UpdateInstanceOutcomeCallable UpdateInstanceCallable(const Model::UpdateInstanceRequest& request) const;
 
+        /**
+         * Same as UpdateInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateInstanceOutcomeCallable UpdateInstanceCallable(Model::UpdateInstanceRequest&& request) const;
+
         /**
          * <p>Updates a specified instance.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -2995,6 +3693,11 @@ namespace Model
          */
         virtual void UpdateInstanceAsync(const Model::UpdateInstanceRequest& request, const UpdateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateInstanceAsync(Model::UpdateInstanceRequest&& request, const UpdateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a specified layer.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -3017,6 +3720,11 @@ namespace Model
          */
         virtual Model::UpdateLayerOutcomeCallable UpdateLayerCallable(const Model::UpdateLayerRequest& request) const;
 
+        /**
+         * Same as UpdateLayerCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateLayerOutcomeCallable UpdateLayerCallable(Model::UpdateLayerRequest&& request) const;
+
         /**
          * <p>Updates a specified layer.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -3029,6 +3737,11 @@ namespace Model
          */
         virtual void UpdateLayerAsync(const Model::UpdateLayerRequest& request, const UpdateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateLayerAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateLayerAsync(Model::UpdateLayerRequest&& request, const UpdateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a user's SSH public key.</p> <p><b>Required Permissions</b>: To use
          * this action, an IAM user must have self-management enabled or an attached policy
@@ -3051,6 +3764,11 @@ namespace Model
          */
         virtual Model::UpdateMyUserProfileOutcomeCallable UpdateMyUserProfileCallable(const Model::UpdateMyUserProfileRequest& request) const;
 
+        /**
+         * Same as UpdateMyUserProfileCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateMyUserProfileOutcomeCallable UpdateMyUserProfileCallable(Model::UpdateMyUserProfileRequest&& request) const;
+
         /**
          * <p>Updates a user's SSH public key.</p> <p><b>Required Permissions</b>: To use
          * this action, an IAM user must have self-management enabled or an attached policy
@@ -3063,6 +3781,11 @@ namespace Model
          */
         virtual void UpdateMyUserProfileAsync(const Model::UpdateMyUserProfileRequest& request, const UpdateMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateMyUserProfileAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateMyUserProfileAsync(Model::UpdateMyUserProfileRequest&& request, const UpdateMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates an Amazon RDS instance.</p> <p><b>Required Permissions</b>: To use
          * this action, an IAM user must have a Manage permissions level for the stack, or
@@ -3085,6 +3808,11 @@ namespace Model
          */
         virtual Model::UpdateRdsDbInstanceOutcomeCallable UpdateRdsDbInstanceCallable(const Model::UpdateRdsDbInstanceRequest& request) const;
 
+        /**
+         * Same as UpdateRdsDbInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateRdsDbInstanceOutcomeCallable UpdateRdsDbInstanceCallable(Model::UpdateRdsDbInstanceRequest&& request) const;
+
         /**
          * <p>Updates an Amazon RDS instance.</p> <p><b>Required Permissions</b>: To use
          * this action, an IAM user must have a Manage permissions level for the stack, or
@@ -3097,6 +3825,11 @@ namespace Model
          */
         virtual void UpdateRdsDbInstanceAsync(const Model::UpdateRdsDbInstanceRequest& request, const UpdateRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRdsDbInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateRdsDbInstanceAsync(Model::UpdateRdsDbInstanceRequest&& request, const UpdateRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a specified stack.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -3119,6 +3852,11 @@ namespace Model
          */
         virtual Model::UpdateStackOutcomeCallable UpdateStackCallable(const Model::UpdateStackRequest& request) const;
 
+        /**
+         * Same as UpdateStackCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateStackOutcomeCallable UpdateStackCallable(Model::UpdateStackRequest&& request) const;
+
         /**
          * <p>Updates a specified stack.</p> <p><b>Required Permissions</b>: To use this
          * action, an IAM user must have a Manage permissions level for the stack, or an
@@ -3131,6 +3869,11 @@ namespace Model
          */
         virtual void UpdateStackAsync(const Model::UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateStackAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateStackAsync(Model::UpdateStackRequest&& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates a specified user profile.</p> <p><b>Required Permissions</b>: To use
          * this action, an IAM user must have an attached policy that explicitly grants
@@ -3151,6 +3894,11 @@ namespace Model
          */
         virtual Model::UpdateUserProfileOutcomeCallable UpdateUserProfileCallable(const Model::UpdateUserProfileRequest& request) const;
 
+        /**
+         * Same as UpdateUserProfileCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateUserProfileOutcomeCallable UpdateUserProfileCallable(Model::UpdateUserProfileRequest&& request) const;
+
         /**
          * <p>Updates a specified user profile.</p> <p><b>Required Permissions</b>: To use
          * this action, an IAM user must have an attached policy that explicitly grants
@@ -3162,6 +3910,11 @@ namespace Model
          */
         virtual void UpdateUserProfileAsync(const Model::UpdateUserProfileRequest& request, const UpdateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateUserProfileAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateUserProfileAsync(Model::UpdateUserProfileRequest&& request, const UpdateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates an Amazon EBS volume's name or mount point. For more information, see
          * <a
@@ -3190,6 +3943,11 @@ namespace Model
          */
         virtual Model::UpdateVolumeOutcomeCallable UpdateVolumeCallable(const Model::UpdateVolumeRequest& request) const;
 
+        /**
+         * Same as UpdateVolumeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateVolumeOutcomeCallable UpdateVolumeCallable(Model::UpdateVolumeRequest&& request) const;
+
         /**
          * <p>Updates an Amazon EBS volume's name or mount point. For more information, see
          * <a
@@ -3205,6 +3963,157 @@ namespace Model
          */
         virtual void UpdateVolumeAsync(const Model::UpdateVolumeRequest& request, const UpdateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateVolumeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateVolumeAsync(Model::UpdateVolumeRequest&& request, const UpdateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AssignInstanceOutcome> AssignInstanceAwaitable(const Model::AssignInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::AssignInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssignInstanceOutcome> AssignInstanceAwaitable(Model::AssignInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::AssignInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssignVolumeOutcome> AssignVolumeAwaitable(const Model::AssignVolumeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::AssignVolume, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssignVolumeOutcome> AssignVolumeAwaitable(Model::AssignVolumeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::AssignVolume, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssociateElasticIpOutcome> AssociateElasticIpAwaitable(const Model::AssociateElasticIpRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::AssociateElasticIp, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssociateElasticIpOutcome> AssociateElasticIpAwaitable(Model::AssociateElasticIpRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::AssociateElasticIp, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachElasticLoadBalancerOutcome> AttachElasticLoadBalancerAwaitable(const Model::AttachElasticLoadBalancerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::AttachElasticLoadBalancer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AttachElasticLoadBalancerOutcome> AttachElasticLoadBalancerAwaitable(Model::AttachElasticLoadBalancerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::AttachElasticLoadBalancer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CloneStackOutcome> CloneStackAwaitable(const Model::CloneStackRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::CloneStack, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CloneStackOutcome> CloneStackAwaitable(Model::CloneStackRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::CloneStack, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAppOutcome> CreateAppAwaitable(const Model::CreateAppRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::CreateApp, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAppOutcome> CreateAppAwaitable(Model::CreateAppRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::CreateApp, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDeploymentOutcome> CreateDeploymentAwaitable(const Model::CreateDeploymentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::CreateDeployment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDeploymentOutcome> CreateDeploymentAwaitable(Model::CreateDeploymentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::CreateDeployment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateInstanceOutcome> CreateInstanceAwaitable(const Model::CreateInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::CreateInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateInstanceOutcome> CreateInstanceAwaitable(Model::CreateInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::CreateInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLayerOutcome> CreateLayerAwaitable(const Model::CreateLayerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::CreateLayer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateLayerOutcome> CreateLayerAwaitable(Model::CreateLayerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::CreateLayer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateStackOutcome> CreateStackAwaitable(const Model::CreateStackRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::CreateStack, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateStackOutcome> CreateStackAwaitable(Model::CreateStackRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::CreateStack, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateUserProfileOutcome> CreateUserProfileAwaitable(const Model::CreateUserProfileRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::CreateUserProfile, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateUserProfileOutcome> CreateUserProfileAwaitable(Model::CreateUserProfileRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::CreateUserProfile, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAppOutcome> DeleteAppAwaitable(const Model::DeleteAppRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeleteApp, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAppOutcome> DeleteAppAwaitable(Model::DeleteAppRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeleteApp, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteInstanceOutcome> DeleteInstanceAwaitable(const Model::DeleteInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeleteInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteInstanceOutcome> DeleteInstanceAwaitable(Model::DeleteInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeleteInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLayerOutcome> DeleteLayerAwaitable(const Model::DeleteLayerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeleteLayer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteLayerOutcome> DeleteLayerAwaitable(Model::DeleteLayerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeleteLayer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteStackOutcome> DeleteStackAwaitable(const Model::DeleteStackRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeleteStack, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteStackOutcome> DeleteStackAwaitable(Model::DeleteStackRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeleteStack, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteUserProfileOutcome> DeleteUserProfileAwaitable(const Model::DeleteUserProfileRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeleteUserProfile, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteUserProfileOutcome> DeleteUserProfileAwaitable(Model::DeleteUserProfileRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeleteUserProfile, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterEcsClusterOutcome> DeregisterEcsClusterAwaitable(const Model::DeregisterEcsClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeregisterEcsCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterEcsClusterOutcome> DeregisterEcsClusterAwaitable(Model::DeregisterEcsClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeregisterEcsCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterElasticIpOutcome> DeregisterElasticIpAwaitable(const Model::DeregisterElasticIpRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeregisterElasticIp, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterElasticIpOutcome> DeregisterElasticIpAwaitable(Model::DeregisterElasticIpRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeregisterElasticIp, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterInstanceOutcome> DeregisterInstanceAwaitable(const Model::DeregisterInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeregisterInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterInstanceOutcome> DeregisterInstanceAwaitable(Model::DeregisterInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeregisterInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterRdsDbInstanceOutcome> DeregisterRdsDbInstanceAwaitable(const Model::DeregisterRdsDbInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeregisterRdsDbInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterRdsDbInstanceOutcome> DeregisterRdsDbInstanceAwaitable(Model::DeregisterRdsDbInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeregisterRdsDbInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterVolumeOutcome> DeregisterVolumeAwaitable(const Model::DeregisterVolumeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeregisterVolume, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeregisterVolumeOutcome> DeregisterVolumeAwaitable(Model::DeregisterVolumeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DeregisterVolume, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAgentVersionsOutcome> DescribeAgentVersionsAwaitable(const Model::DescribeAgentVersionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeAgentVersions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAgentVersionsOutcome> DescribeAgentVersionsAwaitable(Model::DescribeAgentVersionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeAgentVersions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAppsOutcome> DescribeAppsAwaitable(const Model::DescribeAppsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeApps, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAppsOutcome> DescribeAppsAwaitable(Model::DescribeAppsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeApps, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCommandsOutcome> DescribeCommandsAwaitable(const Model::DescribeCommandsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeCommands, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCommandsOutcome> DescribeCommandsAwaitable(Model::DescribeCommandsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeCommands, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDeploymentsOutcome> DescribeDeploymentsAwaitable(const Model::DescribeDeploymentsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeDeployments, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDeploymentsOutcome> DescribeDeploymentsAwaitable(Model::DescribeDeploymentsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeDeployments, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEcsClustersOutcome> DescribeEcsClustersAwaitable(const Model::DescribeEcsClustersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeEcsClusters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEcsClustersOutcome> DescribeEcsClustersAwaitable(Model::DescribeEcsClustersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeEcsClusters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeElasticIpsOutcome> DescribeElasticIpsAwaitable(const Model::DescribeElasticIpsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeElasticIps, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeElasticIpsOutcome> DescribeElasticIpsAwaitable(Model::DescribeElasticIpsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeElasticIps, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeElasticLoadBalancersOutcome> DescribeElasticLoadBalancersAwaitable(const Model::DescribeElasticLoadBalancersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeElasticLoadBalancers, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeElasticLoadBalancersOutcome> DescribeElasticLoadBalancersAwaitable(Model::DescribeElasticLoadBalancersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeElasticLoadBalancers, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInstancesOutcome> DescribeInstancesAwaitable(const Model::DescribeInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInstancesOutcome> DescribeInstancesAwaitable(Model::DescribeInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLayersOutcome> DescribeLayersAwaitable(const Model::DescribeLayersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeLayers, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLayersOutcome> DescribeLayersAwaitable(Model::DescribeLayersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeLayers, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLoadBasedAutoScalingOutcome> DescribeLoadBasedAutoScalingAwaitable(const Model::DescribeLoadBasedAutoScalingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeLoadBasedAutoScaling, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLoadBasedAutoScalingOutcome> DescribeLoadBasedAutoScalingAwaitable(Model::DescribeLoadBasedAutoScalingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeLoadBasedAutoScaling, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMyUserProfileOutcome> DescribeMyUserProfileAwaitable() const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeMyUserProfile, this); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribePermissionsOutcome> DescribePermissionsAwaitable(const Model::DescribePermissionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribePermissions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribePermissionsOutcome> DescribePermissionsAwaitable(Model::DescribePermissionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribePermissions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRaidArraysOutcome> DescribeRaidArraysAwaitable(const Model::DescribeRaidArraysRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeRaidArrays, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRaidArraysOutcome> DescribeRaidArraysAwaitable(Model::DescribeRaidArraysRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeRaidArrays, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRdsDbInstancesOutcome> DescribeRdsDbInstancesAwaitable(const Model::DescribeRdsDbInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeRdsDbInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeRdsDbInstancesOutcome> DescribeRdsDbInstancesAwaitable(Model::DescribeRdsDbInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeRdsDbInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeServiceErrorsOutcome> DescribeServiceErrorsAwaitable(const Model::DescribeServiceErrorsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeServiceErrors, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeServiceErrorsOutcome> DescribeServiceErrorsAwaitable(Model::DescribeServiceErrorsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeServiceErrors, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStackProvisioningParametersOutcome> DescribeStackProvisioningParametersAwaitable(const Model::DescribeStackProvisioningParametersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeStackProvisioningParameters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStackProvisioningParametersOutcome> DescribeStackProvisioningParametersAwaitable(Model::DescribeStackProvisioningParametersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeStackProvisioningParameters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStackSummaryOutcome> DescribeStackSummaryAwaitable(const Model::DescribeStackSummaryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeStackSummary, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStackSummaryOutcome> DescribeStackSummaryAwaitable(Model::DescribeStackSummaryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeStackSummary, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStacksOutcome> DescribeStacksAwaitable(const Model::DescribeStacksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeStacks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStacksOutcome> DescribeStacksAwaitable(Model::DescribeStacksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeStacks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTimeBasedAutoScalingOutcome> DescribeTimeBasedAutoScalingAwaitable(const Model::DescribeTimeBasedAutoScalingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeTimeBasedAutoScaling, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTimeBasedAutoScalingOutcome> DescribeTimeBasedAutoScalingAwaitable(Model::DescribeTimeBasedAutoScalingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeTimeBasedAutoScaling, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeUserProfilesOutcome> DescribeUserProfilesAwaitable(const Model::DescribeUserProfilesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeUserProfiles, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeUserProfilesOutcome> DescribeUserProfilesAwaitable(Model::DescribeUserProfilesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeUserProfiles, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVolumesOutcome> DescribeVolumesAwaitable(const Model::DescribeVolumesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeVolumes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVolumesOutcome> DescribeVolumesAwaitable(Model::DescribeVolumesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DescribeVolumes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachElasticLoadBalancerOutcome> DetachElasticLoadBalancerAwaitable(const Model::DetachElasticLoadBalancerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DetachElasticLoadBalancer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DetachElasticLoadBalancerOutcome> DetachElasticLoadBalancerAwaitable(Model::DetachElasticLoadBalancerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DetachElasticLoadBalancer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisassociateElasticIpOutcome> DisassociateElasticIpAwaitable(const Model::DisassociateElasticIpRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DisassociateElasticIp, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisassociateElasticIpOutcome> DisassociateElasticIpAwaitable(Model::DisassociateElasticIpRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::DisassociateElasticIp, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetHostnameSuggestionOutcome> GetHostnameSuggestionAwaitable(const Model::GetHostnameSuggestionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::GetHostnameSuggestion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetHostnameSuggestionOutcome> GetHostnameSuggestionAwaitable(Model::GetHostnameSuggestionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::GetHostnameSuggestion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GrantAccessOutcome> GrantAccessAwaitable(const Model::GrantAccessRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::GrantAccess, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GrantAccessOutcome> GrantAccessAwaitable(Model::GrantAccessRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::GrantAccess, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebootInstanceOutcome> RebootInstanceAwaitable(const Model::RebootInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::RebootInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebootInstanceOutcome> RebootInstanceAwaitable(Model::RebootInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::RebootInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterEcsClusterOutcome> RegisterEcsClusterAwaitable(const Model::RegisterEcsClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::RegisterEcsCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterEcsClusterOutcome> RegisterEcsClusterAwaitable(Model::RegisterEcsClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::RegisterEcsCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterElasticIpOutcome> RegisterElasticIpAwaitable(const Model::RegisterElasticIpRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::RegisterElasticIp, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterElasticIpOutcome> RegisterElasticIpAwaitable(Model::RegisterElasticIpRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::RegisterElasticIp, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterInstanceOutcome> RegisterInstanceAwaitable(const Model::RegisterInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::RegisterInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterInstanceOutcome> RegisterInstanceAwaitable(Model::RegisterInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::RegisterInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterRdsDbInstanceOutcome> RegisterRdsDbInstanceAwaitable(const Model::RegisterRdsDbInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::RegisterRdsDbInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterRdsDbInstanceOutcome> RegisterRdsDbInstanceAwaitable(Model::RegisterRdsDbInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::RegisterRdsDbInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterVolumeOutcome> RegisterVolumeAwaitable(const Model::RegisterVolumeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::RegisterVolume, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterVolumeOutcome> RegisterVolumeAwaitable(Model::RegisterVolumeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::RegisterVolume, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetLoadBasedAutoScalingOutcome> SetLoadBasedAutoScalingAwaitable(const Model::SetLoadBasedAutoScalingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::SetLoadBasedAutoScaling, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetLoadBasedAutoScalingOutcome> SetLoadBasedAutoScalingAwaitable(Model::SetLoadBasedAutoScalingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::SetLoadBasedAutoScaling, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetPermissionOutcome> SetPermissionAwaitable(const Model::SetPermissionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::SetPermission, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetPermissionOutcome> SetPermissionAwaitable(Model::SetPermissionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::SetPermission, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetTimeBasedAutoScalingOutcome> SetTimeBasedAutoScalingAwaitable(const Model::SetTimeBasedAutoScalingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::SetTimeBasedAutoScaling, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetTimeBasedAutoScalingOutcome> SetTimeBasedAutoScalingAwaitable(Model::SetTimeBasedAutoScalingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::SetTimeBasedAutoScaling, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartInstanceOutcome> StartInstanceAwaitable(const Model::StartInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::StartInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartInstanceOutcome> StartInstanceAwaitable(Model::StartInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::StartInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartStackOutcome> StartStackAwaitable(const Model::StartStackRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::StartStack, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartStackOutcome> StartStackAwaitable(Model::StartStackRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::StartStack, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopInstanceOutcome> StopInstanceAwaitable(const Model::StopInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::StopInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopInstanceOutcome> StopInstanceAwaitable(Model::StopInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::StopInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopStackOutcome> StopStackAwaitable(const Model::StopStackRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::StopStack, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StopStackOutcome> StopStackAwaitable(Model::StopStackRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::StopStack, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnassignInstanceOutcome> UnassignInstanceAwaitable(const Model::UnassignInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UnassignInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnassignInstanceOutcome> UnassignInstanceAwaitable(Model::UnassignInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UnassignInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnassignVolumeOutcome> UnassignVolumeAwaitable(const Model::UnassignVolumeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UnassignVolume, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnassignVolumeOutcome> UnassignVolumeAwaitable(Model::UnassignVolumeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UnassignVolume, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAppOutcome> UpdateAppAwaitable(const Model::UpdateAppRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateApp, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAppOutcome> UpdateAppAwaitable(Model::UpdateAppRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateApp, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateElasticIpOutcome> UpdateElasticIpAwaitable(const Model::UpdateElasticIpRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateElasticIp, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateElasticIpOutcome> UpdateElasticIpAwaitable(Model::UpdateElasticIpRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateElasticIp, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateInstanceOutcome> UpdateInstanceAwaitable(const Model::UpdateInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateInstanceOutcome> UpdateInstanceAwaitable(Model::UpdateInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateLayerOutcome> UpdateLayerAwaitable(const Model::UpdateLayerRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateLayer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateLayerOutcome> UpdateLayerAwaitable(Model::UpdateLayerRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateLayer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateMyUserProfileOutcome> UpdateMyUserProfileAwaitable(const Model::UpdateMyUserProfileRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateMyUserProfile, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateMyUserProfileOutcome> UpdateMyUserProfileAwaitable(Model::UpdateMyUserProfileRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateMyUserProfile, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateRdsDbInstanceOutcome> UpdateRdsDbInstanceAwaitable(const Model::UpdateRdsDbInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateRdsDbInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateRdsDbInstanceOutcome> UpdateRdsDbInstanceAwaitable(Model::UpdateRdsDbInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateRdsDbInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateStackOutcome> UpdateStackAwaitable(const Model::UpdateStackRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateStack, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateStackOutcome> UpdateStackAwaitable(Model::UpdateStackRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateStack, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateUserProfileOutcome> UpdateUserProfileAwaitable(const Model::UpdateUserProfileRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateUserProfile, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateUserProfileOutcome> UpdateUserProfileAwaitable(Model::UpdateUserProfileRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateUserProfile, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateVolumeOutcome> UpdateVolumeAwaitable(const Model::UpdateVolumeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateVolume, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateVolumeOutcome> UpdateVolumeAwaitable(Model::UpdateVolumeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &OpsWorksClient::UpdateVolume, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
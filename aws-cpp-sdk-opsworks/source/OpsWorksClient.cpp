@@ -176,12 +176,22 @@ AssignInstanceOutcome OpsWorksClient::AssignInstance(const AssignInstanceRequest
 
 AssignInstanceOutcomeCallable OpsWorksClient::AssignInstanceCallable(const AssignInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::AssignInstance, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::AssignInstance, Aws::Client::RejectedCallOutcome<AssignInstanceOutcome>(), this, request);
+}
+
+AssignInstanceOutcomeCallable OpsWorksClient::AssignInstanceCallable(AssignInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::AssignInstance, Aws::Client::RejectedCallOutcome<AssignInstanceOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::AssignInstanceAsync(const AssignInstanceRequest& request, const AssignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::AssignInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::AssignInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<AssignInstanceOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::AssignInstanceAsync(AssignInstanceRequest&& request, const AssignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::AssignInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<AssignInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::AssignInstanceAsyncHelper(const AssignInstanceRequest& request, const AssignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -207,12 +217,22 @@ AssignVolumeOutcome OpsWorksClient::AssignVolume(const AssignVolumeRequest& requ
 
 AssignVolumeOutcomeCallable OpsWorksClient::AssignVolumeCallable(const AssignVolumeRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::AssignVolume, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::AssignVolume, Aws::Client::RejectedCallOutcome<AssignVolumeOutcome>(), this, request);
+}
+
+AssignVolumeOutcomeCallable OpsWorksClient::AssignVolumeCallable(AssignVolumeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::AssignVolume, Aws::Client::RejectedCallOutcome<AssignVolumeOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::AssignVolumeAsync(const AssignVolumeRequest& request, const AssignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::AssignVolumeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::AssignVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<AssignVolumeOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::AssignVolumeAsync(AssignVolumeRequest&& request, const AssignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::AssignVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<AssignVolumeOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::AssignVolumeAsyncHelper(const AssignVolumeRequest& request, const AssignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -238,12 +258,22 @@ AssociateElasticIpOutcome OpsWorksClient::AssociateElasticIp(const AssociateElas
 
 AssociateElasticIpOutcomeCallable OpsWorksClient::AssociateElasticIpCallable(const AssociateElasticIpRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::AssociateElasticIp, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::AssociateElasticIp, Aws::Client::RejectedCallOutcome<AssociateElasticIpOutcome>(), this, request);
+}
+
+AssociateElasticIpOutcomeCallable OpsWorksClient::AssociateElasticIpCallable(AssociateElasticIpRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::AssociateElasticIp, Aws::Client::RejectedCallOutcome<AssociateElasticIpOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::AssociateElasticIpAsync(const AssociateElasticIpRequest& request, const AssociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::AssociateElasticIpAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::AssociateElasticIpAsyncHelper, Aws::Client::RejectedAsyncCall<AssociateElasticIpOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::AssociateElasticIpAsync(AssociateElasticIpRequest&& request, const AssociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::AssociateElasticIpAsyncHelper, Aws::Client::RejectedAsyncCall<AssociateElasticIpOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::AssociateElasticIpAsyncHelper(const AssociateElasticIpRequest& request, const AssociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -269,12 +299,22 @@ AttachElasticLoadBalancerOutcome OpsWorksClient::AttachElasticLoadBalancer(const
 
 AttachElasticLoadBalancerOutcomeCallable OpsWorksClient::AttachElasticLoadBalancerCallable(const AttachElasticLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::AttachElasticLoadBalancer, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::AttachElasticLoadBalancer, Aws::Client::RejectedCallOutcome<AttachElasticLoadBalancerOutcome>(), this, request);
+}
+
+AttachElasticLoadBalancerOutcomeCallable OpsWorksClient::AttachElasticLoadBalancerCallable(AttachElasticLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::AttachElasticLoadBalancer, Aws::Client::RejectedCallOutcome<AttachElasticLoadBalancerOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::AttachElasticLoadBalancerAsync(const AttachElasticLoadBalancerRequest& request, const AttachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::AttachElasticLoadBalancerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::AttachElasticLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<AttachElasticLoadBalancerOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::AttachElasticLoadBalancerAsync(AttachElasticLoadBalancerRequest&& request, const AttachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::AttachElasticLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<AttachElasticLoadBalancerOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::AttachElasticLoadBalancerAsyncHelper(const AttachElasticLoadBalancerRequest& request, const AttachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -300,12 +340,22 @@ CloneStackOutcome OpsWorksClient::CloneStack(const CloneStackRequest& request) c
 
 CloneStackOutcomeCallable OpsWorksClient::CloneStackCallable(const CloneStackRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::CloneStack, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::CloneStack, Aws::Client::RejectedCallOutcome<CloneStackOutcome>(), this, request);
+}
+
+CloneStackOutcomeCallable OpsWorksClient::CloneStackCallable(CloneStackRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::CloneStack, Aws::Client::RejectedCallOutcome<CloneStackOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::CloneStackAsync(const CloneStackRequest& request, const CloneStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::CloneStackAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::CloneStackAsyncHelper, Aws::Client::RejectedAsyncCall<CloneStackOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::CloneStackAsync(CloneStackRequest&& request, const CloneStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::CloneStackAsyncHelper, Aws::Client::RejectedAsyncCall<CloneStackOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::CloneStackAsyncHelper(const CloneStackRequest& request, const CloneStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -331,12 +381,22 @@ CreateAppOutcome OpsWorksClient::CreateApp(const CreateAppRequest& request) cons
 
 CreateAppOutcomeCallable OpsWorksClient::CreateAppCallable(const CreateAppRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::CreateApp, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::CreateApp, Aws::Client::RejectedCallOutcome<CreateAppOutcome>(), this, request);
+}
+
+CreateAppOutcomeCallable OpsWorksClient::CreateAppCallable(CreateAppRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::CreateApp, Aws::Client::RejectedCallOutcome<CreateAppOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::CreateAppAsync(const CreateAppRequest& request, const CreateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::CreateAppAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::CreateAppAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAppOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::CreateAppAsync(CreateAppRequest&& request, const CreateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::CreateAppAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAppOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::CreateAppAsyncHelper(const CreateAppRequest& request, const CreateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -362,12 +422,22 @@ CreateDeploymentOutcome OpsWorksClient::CreateDeployment(const CreateDeploymentR
 
 CreateDeploymentOutcomeCallable OpsWorksClient::CreateDeploymentCallable(const CreateDeploymentRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::CreateDeployment, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::CreateDeployment, Aws::Client::RejectedCallOutcome<CreateDeploymentOutcome>(), this, request);
+}
+
+CreateDeploymentOutcomeCallable OpsWorksClient::CreateDeploymentCallable(CreateDeploymentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::CreateDeployment, Aws::Client::RejectedCallOutcome<CreateDeploymentOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::CreateDeploymentAsync(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::CreateDeploymentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::CreateDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDeploymentOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::CreateDeploymentAsync(CreateDeploymentRequest&& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::CreateDeploymentAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDeploymentOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::CreateDeploymentAsyncHelper(const CreateDeploymentRequest& request, const CreateDeploymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -393,12 +463,22 @@ CreateInstanceOutcome OpsWorksClient::CreateInstance(const CreateInstanceRequest
 
 CreateInstanceOutcomeCallable OpsWorksClient::CreateInstanceCallable(const CreateInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::CreateInstance, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::CreateInstance, Aws::Client::RejectedCallOutcome<CreateInstanceOutcome>(), this, request);
+}
+
+CreateInstanceOutcomeCallable OpsWorksClient::CreateInstanceCallable(CreateInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::CreateInstance, Aws::Client::RejectedCallOutcome<CreateInstanceOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::CreateInstanceAsync(const CreateInstanceRequest& request, const CreateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::CreateInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::CreateInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<CreateInstanceOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::CreateInstanceAsync(CreateInstanceRequest&& request, const CreateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::CreateInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<CreateInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::CreateInstanceAsyncHelper(const CreateInstanceRequest& request, const CreateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -424,12 +504,22 @@ CreateLayerOutcome OpsWorksClient::CreateLayer(const CreateLayerRequest& request
 
 CreateLayerOutcomeCallable OpsWorksClient::CreateLayerCallable(const CreateLayerRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::CreateLayer, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::CreateLayer, Aws::Client::RejectedCallOutcome<CreateLayerOutcome>(), this, request);
+}
+
+CreateLayerOutcomeCallable OpsWorksClient::CreateLayerCallable(CreateLayerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::CreateLayer, Aws::Client::RejectedCallOutcome<CreateLayerOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::CreateLayerAsync(const CreateLayerRequest& request, const CreateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::CreateLayerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::CreateLayerAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLayerOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::CreateLayerAsync(CreateLayerRequest&& request, const CreateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::CreateLayerAsyncHelper, Aws::Client::RejectedAsyncCall<CreateLayerOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::CreateLayerAsyncHelper(const CreateLayerRequest& request, const CreateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -455,12 +545,22 @@ CreateStackOutcome OpsWorksClient::CreateStack(const CreateStackRequest& request
 
 CreateStackOutcomeCallable OpsWorksClient::CreateStackCallable(const CreateStackRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::CreateStack, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::CreateStack, Aws::Client::RejectedCallOutcome<CreateStackOutcome>(), this, request);
+}
+
+CreateStackOutcomeCallable OpsWorksClient::CreateStackCallable(CreateStackRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::CreateStack, Aws::Client::RejectedCallOutcome<CreateStackOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::CreateStackAsync(const CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::CreateStackAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::CreateStackAsyncHelper, Aws::Client::RejectedAsyncCall<CreateStackOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::CreateStackAsync(CreateStackRequest&& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::CreateStackAsyncHelper, Aws::Client::RejectedAsyncCall<CreateStackOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::CreateStackAsyncHelper(const CreateStackRequest& request, const CreateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -486,12 +586,22 @@ CreateUserProfileOutcome OpsWorksClient::CreateUserProfile(const CreateUserProfi
 
 CreateUserProfileOutcomeCallable OpsWorksClient::CreateUserProfileCallable(const CreateUserProfileRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::CreateUserProfile, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::CreateUserProfile, Aws::Client::RejectedCallOutcome<CreateUserProfileOutcome>(), this, request);
+}
+
+CreateUserProfileOutcomeCallable OpsWorksClient::CreateUserProfileCallable(CreateUserProfileRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::CreateUserProfile, Aws::Client::RejectedCallOutcome<CreateUserProfileOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::CreateUserProfileAsync(const CreateUserProfileRequest& request, const CreateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::CreateUserProfileAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::CreateUserProfileAsyncHelper, Aws::Client::RejectedAsyncCall<CreateUserProfileOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::CreateUserProfileAsync(CreateUserProfileRequest&& request, const CreateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::CreateUserProfileAsyncHelper, Aws::Client::RejectedAsyncCall<CreateUserProfileOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::CreateUserProfileAsyncHelper(const CreateUserProfileRequest& request, const CreateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -517,12 +627,22 @@ DeleteAppOutcome OpsWorksClient::DeleteApp(const DeleteAppRequest& request) cons
 
 DeleteAppOutcomeCallable OpsWorksClient::DeleteAppCallable(const DeleteAppRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DeleteApp, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeleteApp, Aws::Client::RejectedCallOutcome<DeleteAppOutcome>(), this, request);
+}
+
+DeleteAppOutcomeCallable OpsWorksClient::DeleteAppCallable(DeleteAppRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeleteApp, Aws::Client::RejectedCallOutcome<DeleteAppOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DeleteAppAsync(const DeleteAppRequest& request, const DeleteAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DeleteAppAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DeleteAppAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAppOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DeleteAppAsync(DeleteAppRequest&& request, const DeleteAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DeleteAppAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAppOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DeleteAppAsyncHelper(const DeleteAppRequest& request, const DeleteAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -548,12 +668,22 @@ DeleteInstanceOutcome OpsWorksClient::DeleteInstance(const DeleteInstanceRequest
 
 DeleteInstanceOutcomeCallable OpsWorksClient::DeleteInstanceCallable(const DeleteInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DeleteInstance, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeleteInstance, Aws::Client::RejectedCallOutcome<DeleteInstanceOutcome>(), this, request);
+}
+
+DeleteInstanceOutcomeCallable OpsWorksClient::DeleteInstanceCallable(DeleteInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeleteInstance, Aws::Client::RejectedCallOutcome<DeleteInstanceOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DeleteInstanceAsync(const DeleteInstanceRequest& request, const DeleteInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DeleteInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DeleteInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteInstanceOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DeleteInstanceAsync(DeleteInstanceRequest&& request, const DeleteInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DeleteInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DeleteInstanceAsyncHelper(const DeleteInstanceRequest& request, const DeleteInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -579,12 +709,22 @@ DeleteLayerOutcome OpsWorksClient::DeleteLayer(const DeleteLayerRequest& request
 
 DeleteLayerOutcomeCallable OpsWorksClient::DeleteLayerCallable(const DeleteLayerRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DeleteLayer, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeleteLayer, Aws::Client::RejectedCallOutcome<DeleteLayerOutcome>(), this, request);
+}
+
+DeleteLayerOutcomeCallable OpsWorksClient::DeleteLayerCallable(DeleteLayerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeleteLayer, Aws::Client::RejectedCallOutcome<DeleteLayerOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DeleteLayerAsync(const DeleteLayerRequest& request, const DeleteLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DeleteLayerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DeleteLayerAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLayerOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DeleteLayerAsync(DeleteLayerRequest&& request, const DeleteLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DeleteLayerAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteLayerOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DeleteLayerAsyncHelper(const DeleteLayerRequest& request, const DeleteLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -610,12 +750,22 @@ DeleteStackOutcome OpsWorksClient::DeleteStack(const DeleteStackRequest& request
 
 DeleteStackOutcomeCallable OpsWorksClient::DeleteStackCallable(const DeleteStackRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DeleteStack, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeleteStack, Aws::Client::RejectedCallOutcome<DeleteStackOutcome>(), this, request);
+}
+
+DeleteStackOutcomeCallable OpsWorksClient::DeleteStackCallable(DeleteStackRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeleteStack, Aws::Client::RejectedCallOutcome<DeleteStackOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DeleteStackAsync(const DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DeleteStackAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DeleteStackAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteStackOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DeleteStackAsync(DeleteStackRequest&& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DeleteStackAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteStackOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DeleteStackAsyncHelper(const DeleteStackRequest& request, const DeleteStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -641,12 +791,22 @@ DeleteUserProfileOutcome OpsWorksClient::DeleteUserProfile(const DeleteUserProfi
 
 DeleteUserProfileOutcomeCallable OpsWorksClient::DeleteUserProfileCallable(const DeleteUserProfileRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DeleteUserProfile, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeleteUserProfile, Aws::Client::RejectedCallOutcome<DeleteUserProfileOutcome>(), this, request);
+}
+
+DeleteUserProfileOutcomeCallable OpsWorksClient::DeleteUserProfileCallable(DeleteUserProfileRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeleteUserProfile, Aws::Client::RejectedCallOutcome<DeleteUserProfileOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DeleteUserProfileAsync(const DeleteUserProfileRequest& request, const DeleteUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DeleteUserProfileAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DeleteUserProfileAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteUserProfileOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DeleteUserProfileAsync(DeleteUserProfileRequest&& request, const DeleteUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DeleteUserProfileAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteUserProfileOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DeleteUserProfileAsyncHelper(const DeleteUserProfileRequest& request, const DeleteUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -672,12 +832,22 @@ DeregisterEcsClusterOutcome OpsWorksClient::DeregisterEcsCluster(const Deregiste
 
 DeregisterEcsClusterOutcomeCallable OpsWorksClient::DeregisterEcsClusterCallable(const DeregisterEcsClusterRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DeregisterEcsCluster, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeregisterEcsCluster, Aws::Client::RejectedCallOutcome<DeregisterEcsClusterOutcome>(), this, request);
+}
+
+DeregisterEcsClusterOutcomeCallable OpsWorksClient::DeregisterEcsClusterCallable(DeregisterEcsClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeregisterEcsCluster, Aws::Client::RejectedCallOutcome<DeregisterEcsClusterOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DeregisterEcsClusterAsync(const DeregisterEcsClusterRequest& request, const DeregisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DeregisterEcsClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DeregisterEcsClusterAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterEcsClusterOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DeregisterEcsClusterAsync(DeregisterEcsClusterRequest&& request, const DeregisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DeregisterEcsClusterAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterEcsClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DeregisterEcsClusterAsyncHelper(const DeregisterEcsClusterRequest& request, const DeregisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -703,12 +873,22 @@ DeregisterElasticIpOutcome OpsWorksClient::DeregisterElasticIp(const DeregisterE
 
 DeregisterElasticIpOutcomeCallable OpsWorksClient::DeregisterElasticIpCallable(const DeregisterElasticIpRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DeregisterElasticIp, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeregisterElasticIp, Aws::Client::RejectedCallOutcome<DeregisterElasticIpOutcome>(), this, request);
+}
+
+DeregisterElasticIpOutcomeCallable OpsWorksClient::DeregisterElasticIpCallable(DeregisterElasticIpRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeregisterElasticIp, Aws::Client::RejectedCallOutcome<DeregisterElasticIpOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DeregisterElasticIpAsync(const DeregisterElasticIpRequest& request, const DeregisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DeregisterElasticIpAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DeregisterElasticIpAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterElasticIpOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DeregisterElasticIpAsync(DeregisterElasticIpRequest&& request, const DeregisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DeregisterElasticIpAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterElasticIpOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DeregisterElasticIpAsyncHelper(const DeregisterElasticIpRequest& request, const DeregisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -734,12 +914,22 @@ DeregisterInstanceOutcome OpsWorksClient::DeregisterInstance(const DeregisterIns
 
 DeregisterInstanceOutcomeCallable OpsWorksClient::DeregisterInstanceCallable(const DeregisterInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DeregisterInstance, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeregisterInstance, Aws::Client::RejectedCallOutcome<DeregisterInstanceOutcome>(), this, request);
+}
+
+DeregisterInstanceOutcomeCallable OpsWorksClient::DeregisterInstanceCallable(DeregisterInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeregisterInstance, Aws::Client::RejectedCallOutcome<DeregisterInstanceOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DeregisterInstanceAsync(const DeregisterInstanceRequest& request, const DeregisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DeregisterInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DeregisterInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterInstanceOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DeregisterInstanceAsync(DeregisterInstanceRequest&& request, const DeregisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DeregisterInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DeregisterInstanceAsyncHelper(const DeregisterInstanceRequest& request, const DeregisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -765,12 +955,22 @@ DeregisterRdsDbInstanceOutcome OpsWorksClient::DeregisterRdsDbInstance(const Der
 
 DeregisterRdsDbInstanceOutcomeCallable OpsWorksClient::DeregisterRdsDbInstanceCallable(const DeregisterRdsDbInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DeregisterRdsDbInstance, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeregisterRdsDbInstance, Aws::Client::RejectedCallOutcome<DeregisterRdsDbInstanceOutcome>(), this, request);
+}
+
+DeregisterRdsDbInstanceOutcomeCallable OpsWorksClient::DeregisterRdsDbInstanceCallable(DeregisterRdsDbInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeregisterRdsDbInstance, Aws::Client::RejectedCallOutcome<DeregisterRdsDbInstanceOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DeregisterRdsDbInstanceAsync(const DeregisterRdsDbInstanceRequest& request, const DeregisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DeregisterRdsDbInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DeregisterRdsDbInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterRdsDbInstanceOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DeregisterRdsDbInstanceAsync(DeregisterRdsDbInstanceRequest&& request, const DeregisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DeregisterRdsDbInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterRdsDbInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DeregisterRdsDbInstanceAsyncHelper(const DeregisterRdsDbInstanceRequest& request, const DeregisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -796,12 +996,22 @@ DeregisterVolumeOutcome OpsWorksClient::DeregisterVolume(const DeregisterVolumeR
 
 DeregisterVolumeOutcomeCallable OpsWorksClient::DeregisterVolumeCallable(const DeregisterVolumeRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DeregisterVolume, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeregisterVolume, Aws::Client::RejectedCallOutcome<DeregisterVolumeOutcome>(), this, request);
+}
+
+DeregisterVolumeOutcomeCallable OpsWorksClient::DeregisterVolumeCallable(DeregisterVolumeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DeregisterVolume, Aws::Client::RejectedCallOutcome<DeregisterVolumeOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DeregisterVolumeAsync(const DeregisterVolumeRequest& request, const DeregisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DeregisterVolumeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DeregisterVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterVolumeOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DeregisterVolumeAsync(DeregisterVolumeRequest&& request, const DeregisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DeregisterVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<DeregisterVolumeOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DeregisterVolumeAsyncHelper(const DeregisterVolumeRequest& request, const DeregisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -827,12 +1037,22 @@ DescribeAgentVersionsOutcome OpsWorksClient::DescribeAgentVersions(const Describ
 
 DescribeAgentVersionsOutcomeCallable OpsWorksClient::DescribeAgentVersionsCallable(const DescribeAgentVersionsRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeAgentVersions, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeAgentVersions, Aws::Client::RejectedCallOutcome<DescribeAgentVersionsOutcome>(), this, request);
+}
+
+DescribeAgentVersionsOutcomeCallable OpsWorksClient::DescribeAgentVersionsCallable(DescribeAgentVersionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeAgentVersions, Aws::Client::RejectedCallOutcome<DescribeAgentVersionsOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeAgentVersionsAsync(const DescribeAgentVersionsRequest& request, const DescribeAgentVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeAgentVersionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeAgentVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAgentVersionsOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeAgentVersionsAsync(DescribeAgentVersionsRequest&& request, const DescribeAgentVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeAgentVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAgentVersionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeAgentVersionsAsyncHelper(const DescribeAgentVersionsRequest& request, const DescribeAgentVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -858,12 +1078,22 @@ DescribeAppsOutcome OpsWorksClient::DescribeApps(const DescribeAppsRequest& requ
 
 DescribeAppsOutcomeCallable OpsWorksClient::DescribeAppsCallable(const DescribeAppsRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeApps, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeApps, Aws::Client::RejectedCallOutcome<DescribeAppsOutcome>(), this, request);
+}
+
+DescribeAppsOutcomeCallable OpsWorksClient::DescribeAppsCallable(DescribeAppsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeApps, Aws::Client::RejectedCallOutcome<DescribeAppsOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeAppsAsync(const DescribeAppsRequest& request, const DescribeAppsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeAppsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeAppsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAppsOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeAppsAsync(DescribeAppsRequest&& request, const DescribeAppsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeAppsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAppsOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeAppsAsyncHelper(const DescribeAppsRequest& request, const DescribeAppsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -889,12 +1119,22 @@ DescribeCommandsOutcome OpsWorksClient::DescribeCommands(const DescribeCommandsR
 
 DescribeCommandsOutcomeCallable OpsWorksClient::DescribeCommandsCallable(const DescribeCommandsRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeCommands, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeCommands, Aws::Client::RejectedCallOutcome<DescribeCommandsOutcome>(), this, request);
+}
+
+DescribeCommandsOutcomeCallable OpsWorksClient::DescribeCommandsCallable(DescribeCommandsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeCommands, Aws::Client::RejectedCallOutcome<DescribeCommandsOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeCommandsAsync(const DescribeCommandsRequest& request, const DescribeCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeCommandsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeCommandsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCommandsOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeCommandsAsync(DescribeCommandsRequest&& request, const DescribeCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeCommandsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCommandsOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeCommandsAsyncHelper(const DescribeCommandsRequest& request, const DescribeCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -920,12 +1160,22 @@ DescribeDeploymentsOutcome OpsWorksClient::DescribeDeployments(const DescribeDep
 
 DescribeDeploymentsOutcomeCallable OpsWorksClient::DescribeDeploymentsCallable(const DescribeDeploymentsRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeDeployments, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeDeployments, Aws::Client::RejectedCallOutcome<DescribeDeploymentsOutcome>(), this, request);
+}
+
+DescribeDeploymentsOutcomeCallable OpsWorksClient::DescribeDeploymentsCallable(DescribeDeploymentsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeDeployments, Aws::Client::RejectedCallOutcome<DescribeDeploymentsOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeDeploymentsAsync(const DescribeDeploymentsRequest& request, const DescribeDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeDeploymentsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeDeploymentsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDeploymentsOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeDeploymentsAsync(DescribeDeploymentsRequest&& request, const DescribeDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeDeploymentsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDeploymentsOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeDeploymentsAsyncHelper(const DescribeDeploymentsRequest& request, const DescribeDeploymentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -951,12 +1201,22 @@ DescribeEcsClustersOutcome OpsWorksClient::DescribeEcsClusters(const DescribeEcs
 
 DescribeEcsClustersOutcomeCallable OpsWorksClient::DescribeEcsClustersCallable(const DescribeEcsClustersRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeEcsClusters, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeEcsClusters, Aws::Client::RejectedCallOutcome<DescribeEcsClustersOutcome>(), this, request);
+}
+
+DescribeEcsClustersOutcomeCallable OpsWorksClient::DescribeEcsClustersCallable(DescribeEcsClustersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeEcsClusters, Aws::Client::RejectedCallOutcome<DescribeEcsClustersOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeEcsClustersAsync(const DescribeEcsClustersRequest& request, const DescribeEcsClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeEcsClustersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeEcsClustersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEcsClustersOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeEcsClustersAsync(DescribeEcsClustersRequest&& request, const DescribeEcsClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeEcsClustersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEcsClustersOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeEcsClustersAsyncHelper(const DescribeEcsClustersRequest& request, const DescribeEcsClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -982,12 +1242,22 @@ DescribeElasticIpsOutcome OpsWorksClient::DescribeElasticIps(const DescribeElast
 
 DescribeElasticIpsOutcomeCallable OpsWorksClient::DescribeElasticIpsCallable(const DescribeElasticIpsRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeElasticIps, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeElasticIps, Aws::Client::RejectedCallOutcome<DescribeElasticIpsOutcome>(), this, request);
+}
+
+DescribeElasticIpsOutcomeCallable OpsWorksClient::DescribeElasticIpsCallable(DescribeElasticIpsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeElasticIps, Aws::Client::RejectedCallOutcome<DescribeElasticIpsOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeElasticIpsAsync(const DescribeElasticIpsRequest& request, const DescribeElasticIpsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeElasticIpsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeElasticIpsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeElasticIpsOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeElasticIpsAsync(DescribeElasticIpsRequest&& request, const DescribeElasticIpsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeElasticIpsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeElasticIpsOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeElasticIpsAsyncHelper(const DescribeElasticIpsRequest& request, const DescribeElasticIpsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1013,12 +1283,22 @@ DescribeElasticLoadBalancersOutcome OpsWorksClient::DescribeElasticLoadBalancers
 
 DescribeElasticLoadBalancersOutcomeCallable OpsWorksClient::DescribeElasticLoadBalancersCallable(const DescribeElasticLoadBalancersRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeElasticLoadBalancers, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeElasticLoadBalancers, Aws::Client::RejectedCallOutcome<DescribeElasticLoadBalancersOutcome>(), this, request);
+}
+
+DescribeElasticLoadBalancersOutcomeCallable OpsWorksClient::DescribeElasticLoadBalancersCallable(DescribeElasticLoadBalancersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeElasticLoadBalancers, Aws::Client::RejectedCallOutcome<DescribeElasticLoadBalancersOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeElasticLoadBalancersAsync(const DescribeElasticLoadBalancersRequest& request, const DescribeElasticLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeElasticLoadBalancersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeElasticLoadBalancersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeElasticLoadBalancersOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeElasticLoadBalancersAsync(DescribeElasticLoadBalancersRequest&& request, const DescribeElasticLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeElasticLoadBalancersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeElasticLoadBalancersOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeElasticLoadBalancersAsyncHelper(const DescribeElasticLoadBalancersRequest& request, const DescribeElasticLoadBalancersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1044,12 +1324,22 @@ DescribeInstancesOutcome OpsWorksClient::DescribeInstances(const DescribeInstanc
 
 DescribeInstancesOutcomeCallable OpsWorksClient::DescribeInstancesCallable(const DescribeInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeInstances, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeInstances, Aws::Client::RejectedCallOutcome<DescribeInstancesOutcome>(), this, request);
+}
+
+DescribeInstancesOutcomeCallable OpsWorksClient::DescribeInstancesCallable(DescribeInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeInstances, Aws::Client::RejectedCallOutcome<DescribeInstancesOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeInstancesAsync(const DescribeInstancesRequest& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInstancesOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeInstancesAsync(DescribeInstancesRequest&& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeInstancesAsyncHelper(const DescribeInstancesRequest& request, const DescribeInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1075,12 +1365,22 @@ DescribeLayersOutcome OpsWorksClient::DescribeLayers(const DescribeLayersRequest
 
 DescribeLayersOutcomeCallable OpsWorksClient::DescribeLayersCallable(const DescribeLayersRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeLayers, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeLayers, Aws::Client::RejectedCallOutcome<DescribeLayersOutcome>(), this, request);
+}
+
+DescribeLayersOutcomeCallable OpsWorksClient::DescribeLayersCallable(DescribeLayersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeLayers, Aws::Client::RejectedCallOutcome<DescribeLayersOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeLayersAsync(const DescribeLayersRequest& request, const DescribeLayersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeLayersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeLayersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLayersOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeLayersAsync(DescribeLayersRequest&& request, const DescribeLayersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeLayersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLayersOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeLayersAsyncHelper(const DescribeLayersRequest& request, const DescribeLayersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1106,12 +1406,22 @@ DescribeLoadBasedAutoScalingOutcome OpsWorksClient::DescribeLoadBasedAutoScaling
 
 DescribeLoadBasedAutoScalingOutcomeCallable OpsWorksClient::DescribeLoadBasedAutoScalingCallable(const DescribeLoadBasedAutoScalingRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeLoadBasedAutoScaling, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeLoadBasedAutoScaling, Aws::Client::RejectedCallOutcome<DescribeLoadBasedAutoScalingOutcome>(), this, request);
+}
+
+DescribeLoadBasedAutoScalingOutcomeCallable OpsWorksClient::DescribeLoadBasedAutoScalingCallable(DescribeLoadBasedAutoScalingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeLoadBasedAutoScaling, Aws::Client::RejectedCallOutcome<DescribeLoadBasedAutoScalingOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeLoadBasedAutoScalingAsync(const DescribeLoadBasedAutoScalingRequest& request, const DescribeLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeLoadBasedAutoScalingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeLoadBasedAutoScalingAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLoadBasedAutoScalingOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeLoadBasedAutoScalingAsync(DescribeLoadBasedAutoScalingRequest&& request, const DescribeLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeLoadBasedAutoScalingAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLoadBasedAutoScalingOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeLoadBasedAutoScalingAsyncHelper(const DescribeLoadBasedAutoScalingRequest& request, const DescribeLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1137,12 +1447,12 @@ DescribeMyUserProfileOutcome OpsWorksClient::DescribeMyUserProfile() const
 
 DescribeMyUserProfileOutcomeCallable OpsWorksClient::DescribeMyUserProfileCallable() const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeMyUserProfile, this);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeMyUserProfile, Aws::Client::RejectedCallOutcome<DescribeMyUserProfileOutcome>(), this);
 }
 
 void OpsWorksClient::DescribeMyUserProfileAsync(const DescribeMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeMyUserProfileAsyncHelper, this, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeMyUserProfileAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMyUserProfileOutcome>(), this, handler, context);
 }
 
 void OpsWorksClient::DescribeMyUserProfileAsyncHelper(const DescribeMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1168,12 +1478,22 @@ DescribePermissionsOutcome OpsWorksClient::DescribePermissions(const DescribePer
 
 DescribePermissionsOutcomeCallable OpsWorksClient::DescribePermissionsCallable(const DescribePermissionsRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribePermissions, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribePermissions, Aws::Client::RejectedCallOutcome<DescribePermissionsOutcome>(), this, request);
+}
+
+DescribePermissionsOutcomeCallable OpsWorksClient::DescribePermissionsCallable(DescribePermissionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribePermissions, Aws::Client::RejectedCallOutcome<DescribePermissionsOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribePermissionsAsync(const DescribePermissionsRequest& request, const DescribePermissionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribePermissionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribePermissionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribePermissionsOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribePermissionsAsync(DescribePermissionsRequest&& request, const DescribePermissionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribePermissionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribePermissionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribePermissionsAsyncHelper(const DescribePermissionsRequest& request, const DescribePermissionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1199,12 +1519,22 @@ DescribeRaidArraysOutcome OpsWorksClient::DescribeRaidArrays(const DescribeRaidA
 
 DescribeRaidArraysOutcomeCallable OpsWorksClient::DescribeRaidArraysCallable(const DescribeRaidArraysRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeRaidArrays, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeRaidArrays, Aws::Client::RejectedCallOutcome<DescribeRaidArraysOutcome>(), this, request);
+}
+
+DescribeRaidArraysOutcomeCallable OpsWorksClient::DescribeRaidArraysCallable(DescribeRaidArraysRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeRaidArrays, Aws::Client::RejectedCallOutcome<DescribeRaidArraysOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeRaidArraysAsync(const DescribeRaidArraysRequest& request, const DescribeRaidArraysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeRaidArraysAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeRaidArraysAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRaidArraysOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeRaidArraysAsync(DescribeRaidArraysRequest&& request, const DescribeRaidArraysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeRaidArraysAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRaidArraysOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeRaidArraysAsyncHelper(const DescribeRaidArraysRequest& request, const DescribeRaidArraysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1230,12 +1560,22 @@ DescribeRdsDbInstancesOutcome OpsWorksClient::DescribeRdsDbInstances(const Descr
 
 DescribeRdsDbInstancesOutcomeCallable OpsWorksClient::DescribeRdsDbInstancesCallable(const DescribeRdsDbInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeRdsDbInstances, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeRdsDbInstances, Aws::Client::RejectedCallOutcome<DescribeRdsDbInstancesOutcome>(), this, request);
+}
+
+DescribeRdsDbInstancesOutcomeCallable OpsWorksClient::DescribeRdsDbInstancesCallable(DescribeRdsDbInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeRdsDbInstances, Aws::Client::RejectedCallOutcome<DescribeRdsDbInstancesOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeRdsDbInstancesAsync(const DescribeRdsDbInstancesRequest& request, const DescribeRdsDbInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeRdsDbInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeRdsDbInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRdsDbInstancesOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeRdsDbInstancesAsync(DescribeRdsDbInstancesRequest&& request, const DescribeRdsDbInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeRdsDbInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeRdsDbInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeRdsDbInstancesAsyncHelper(const DescribeRdsDbInstancesRequest& request, const DescribeRdsDbInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1261,12 +1601,22 @@ DescribeServiceErrorsOutcome OpsWorksClient::DescribeServiceErrors(const Describ
 
 DescribeServiceErrorsOutcomeCallable OpsWorksClient::DescribeServiceErrorsCallable(const DescribeServiceErrorsRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeServiceErrors, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeServiceErrors, Aws::Client::RejectedCallOutcome<DescribeServiceErrorsOutcome>(), this, request);
+}
+
+DescribeServiceErrorsOutcomeCallable OpsWorksClient::DescribeServiceErrorsCallable(DescribeServiceErrorsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeServiceErrors, Aws::Client::RejectedCallOutcome<DescribeServiceErrorsOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeServiceErrorsAsync(const DescribeServiceErrorsRequest& request, const DescribeServiceErrorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeServiceErrorsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeServiceErrorsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeServiceErrorsOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeServiceErrorsAsync(DescribeServiceErrorsRequest&& request, const DescribeServiceErrorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeServiceErrorsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeServiceErrorsOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeServiceErrorsAsyncHelper(const DescribeServiceErrorsRequest& request, const DescribeServiceErrorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1292,12 +1642,22 @@ DescribeStackProvisioningParametersOutcome OpsWorksClient::DescribeStackProvisio
 
 DescribeStackProvisioningParametersOutcomeCallable OpsWorksClient::DescribeStackProvisioningParametersCallable(const DescribeStackProvisioningParametersRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeStackProvisioningParameters, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeStackProvisioningParameters, Aws::Client::RejectedCallOutcome<DescribeStackProvisioningParametersOutcome>(), this, request);
+}
+
+DescribeStackProvisioningParametersOutcomeCallable OpsWorksClient::DescribeStackProvisioningParametersCallable(DescribeStackProvisioningParametersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeStackProvisioningParameters, Aws::Client::RejectedCallOutcome<DescribeStackProvisioningParametersOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeStackProvisioningParametersAsync(const DescribeStackProvisioningParametersRequest& request, const DescribeStackProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeStackProvisioningParametersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeStackProvisioningParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStackProvisioningParametersOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeStackProvisioningParametersAsync(DescribeStackProvisioningParametersRequest&& request, const DescribeStackProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeStackProvisioningParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStackProvisioningParametersOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeStackProvisioningParametersAsyncHelper(const DescribeStackProvisioningParametersRequest& request, const DescribeStackProvisioningParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1323,12 +1683,22 @@ DescribeStackSummaryOutcome OpsWorksClient::DescribeStackSummary(const DescribeS
 
 DescribeStackSummaryOutcomeCallable OpsWorksClient::DescribeStackSummaryCallable(const DescribeStackSummaryRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeStackSummary, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeStackSummary, Aws::Client::RejectedCallOutcome<DescribeStackSummaryOutcome>(), this, request);
+}
+
+DescribeStackSummaryOutcomeCallable OpsWorksClient::DescribeStackSummaryCallable(DescribeStackSummaryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeStackSummary, Aws::Client::RejectedCallOutcome<DescribeStackSummaryOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeStackSummaryAsync(const DescribeStackSummaryRequest& request, const DescribeStackSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeStackSummaryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeStackSummaryAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStackSummaryOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeStackSummaryAsync(DescribeStackSummaryRequest&& request, const DescribeStackSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeStackSummaryAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStackSummaryOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeStackSummaryAsyncHelper(const DescribeStackSummaryRequest& request, const DescribeStackSummaryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1354,12 +1724,22 @@ DescribeStacksOutcome OpsWorksClient::DescribeStacks(const DescribeStacksRequest
 
 DescribeStacksOutcomeCallable OpsWorksClient::DescribeStacksCallable(const DescribeStacksRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeStacks, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeStacks, Aws::Client::RejectedCallOutcome<DescribeStacksOutcome>(), this, request);
+}
+
+DescribeStacksOutcomeCallable OpsWorksClient::DescribeStacksCallable(DescribeStacksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeStacks, Aws::Client::RejectedCallOutcome<DescribeStacksOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeStacksAsync(const DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeStacksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeStacksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStacksOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeStacksAsync(DescribeStacksRequest&& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeStacksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStacksOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeStacksAsyncHelper(const DescribeStacksRequest& request, const DescribeStacksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1385,12 +1765,22 @@ DescribeTimeBasedAutoScalingOutcome OpsWorksClient::DescribeTimeBasedAutoScaling
 
 DescribeTimeBasedAutoScalingOutcomeCallable OpsWorksClient::DescribeTimeBasedAutoScalingCallable(const DescribeTimeBasedAutoScalingRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeTimeBasedAutoScaling, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeTimeBasedAutoScaling, Aws::Client::RejectedCallOutcome<DescribeTimeBasedAutoScalingOutcome>(), this, request);
+}
+
+DescribeTimeBasedAutoScalingOutcomeCallable OpsWorksClient::DescribeTimeBasedAutoScalingCallable(DescribeTimeBasedAutoScalingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeTimeBasedAutoScaling, Aws::Client::RejectedCallOutcome<DescribeTimeBasedAutoScalingOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeTimeBasedAutoScalingAsync(const DescribeTimeBasedAutoScalingRequest& request, const DescribeTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeTimeBasedAutoScalingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeTimeBasedAutoScalingAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTimeBasedAutoScalingOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeTimeBasedAutoScalingAsync(DescribeTimeBasedAutoScalingRequest&& request, const DescribeTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeTimeBasedAutoScalingAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTimeBasedAutoScalingOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeTimeBasedAutoScalingAsyncHelper(const DescribeTimeBasedAutoScalingRequest& request, const DescribeTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1416,12 +1806,22 @@ DescribeUserProfilesOutcome OpsWorksClient::DescribeUserProfiles(const DescribeU
 
 DescribeUserProfilesOutcomeCallable OpsWorksClient::DescribeUserProfilesCallable(const DescribeUserProfilesRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeUserProfiles, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeUserProfiles, Aws::Client::RejectedCallOutcome<DescribeUserProfilesOutcome>(), this, request);
+}
+
+DescribeUserProfilesOutcomeCallable OpsWorksClient::DescribeUserProfilesCallable(DescribeUserProfilesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeUserProfiles, Aws::Client::RejectedCallOutcome<DescribeUserProfilesOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeUserProfilesAsync(const DescribeUserProfilesRequest& request, const DescribeUserProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeUserProfilesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeUserProfilesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeUserProfilesOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeUserProfilesAsync(DescribeUserProfilesRequest&& request, const DescribeUserProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeUserProfilesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeUserProfilesOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeUserProfilesAsyncHelper(const DescribeUserProfilesRequest& request, const DescribeUserProfilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1447,12 +1847,22 @@ DescribeVolumesOutcome OpsWorksClient::DescribeVolumes(const DescribeVolumesRequ
 
 DescribeVolumesOutcomeCallable OpsWorksClient::DescribeVolumesCallable(const DescribeVolumesRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DescribeVolumes, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeVolumes, Aws::Client::RejectedCallOutcome<DescribeVolumesOutcome>(), this, request);
+}
+
+DescribeVolumesOutcomeCallable OpsWorksClient::DescribeVolumesCallable(DescribeVolumesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DescribeVolumes, Aws::Client::RejectedCallOutcome<DescribeVolumesOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DescribeVolumesAsync(const DescribeVolumesRequest& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DescribeVolumesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeVolumesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVolumesOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DescribeVolumesAsync(DescribeVolumesRequest&& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DescribeVolumesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVolumesOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DescribeVolumesAsyncHelper(const DescribeVolumesRequest& request, const DescribeVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1478,12 +1888,22 @@ DetachElasticLoadBalancerOutcome OpsWorksClient::DetachElasticLoadBalancer(const
 
 DetachElasticLoadBalancerOutcomeCallable OpsWorksClient::DetachElasticLoadBalancerCallable(const DetachElasticLoadBalancerRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DetachElasticLoadBalancer, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DetachElasticLoadBalancer, Aws::Client::RejectedCallOutcome<DetachElasticLoadBalancerOutcome>(), this, request);
+}
+
+DetachElasticLoadBalancerOutcomeCallable OpsWorksClient::DetachElasticLoadBalancerCallable(DetachElasticLoadBalancerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DetachElasticLoadBalancer, Aws::Client::RejectedCallOutcome<DetachElasticLoadBalancerOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DetachElasticLoadBalancerAsync(const DetachElasticLoadBalancerRequest& request, const DetachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DetachElasticLoadBalancerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DetachElasticLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<DetachElasticLoadBalancerOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DetachElasticLoadBalancerAsync(DetachElasticLoadBalancerRequest&& request, const DetachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DetachElasticLoadBalancerAsyncHelper, Aws::Client::RejectedAsyncCall<DetachElasticLoadBalancerOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DetachElasticLoadBalancerAsyncHelper(const DetachElasticLoadBalancerRequest& request, const DetachElasticLoadBalancerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1509,12 +1929,22 @@ DisassociateElasticIpOutcome OpsWorksClient::DisassociateElasticIp(const Disasso
 
 DisassociateElasticIpOutcomeCallable OpsWorksClient::DisassociateElasticIpCallable(const DisassociateElasticIpRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::DisassociateElasticIp, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DisassociateElasticIp, Aws::Client::RejectedCallOutcome<DisassociateElasticIpOutcome>(), this, request);
+}
+
+DisassociateElasticIpOutcomeCallable OpsWorksClient::DisassociateElasticIpCallable(DisassociateElasticIpRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::DisassociateElasticIp, Aws::Client::RejectedCallOutcome<DisassociateElasticIpOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::DisassociateElasticIpAsync(const DisassociateElasticIpRequest& request, const DisassociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::DisassociateElasticIpAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::DisassociateElasticIpAsyncHelper, Aws::Client::RejectedAsyncCall<DisassociateElasticIpOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::DisassociateElasticIpAsync(DisassociateElasticIpRequest&& request, const DisassociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::DisassociateElasticIpAsyncHelper, Aws::Client::RejectedAsyncCall<DisassociateElasticIpOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::DisassociateElasticIpAsyncHelper(const DisassociateElasticIpRequest& request, const DisassociateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1540,12 +1970,22 @@ GetHostnameSuggestionOutcome OpsWorksClient::GetHostnameSuggestion(const GetHost
 
 GetHostnameSuggestionOutcomeCallable OpsWorksClient::GetHostnameSuggestionCallable(const GetHostnameSuggestionRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::GetHostnameSuggestion, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::GetHostnameSuggestion, Aws::Client::RejectedCallOutcome<GetHostnameSuggestionOutcome>(), this, request);
+}
+
+GetHostnameSuggestionOutcomeCallable OpsWorksClient::GetHostnameSuggestionCallable(GetHostnameSuggestionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::GetHostnameSuggestion, Aws::Client::RejectedCallOutcome<GetHostnameSuggestionOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::GetHostnameSuggestionAsync(const GetHostnameSuggestionRequest& request, const GetHostnameSuggestionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::GetHostnameSuggestionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::GetHostnameSuggestionAsyncHelper, Aws::Client::RejectedAsyncCall<GetHostnameSuggestionOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::GetHostnameSuggestionAsync(GetHostnameSuggestionRequest&& request, const GetHostnameSuggestionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::GetHostnameSuggestionAsyncHelper, Aws::Client::RejectedAsyncCall<GetHostnameSuggestionOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::GetHostnameSuggestionAsyncHelper(const GetHostnameSuggestionRequest& request, const GetHostnameSuggestionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1571,12 +2011,22 @@ GrantAccessOutcome OpsWorksClient::GrantAccess(const GrantAccessRequest& request
 
 GrantAccessOutcomeCallable OpsWorksClient::GrantAccessCallable(const GrantAccessRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::GrantAccess, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::GrantAccess, Aws::Client::RejectedCallOutcome<GrantAccessOutcome>(), this, request);
+}
+
+GrantAccessOutcomeCallable OpsWorksClient::GrantAccessCallable(GrantAccessRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::GrantAccess, Aws::Client::RejectedCallOutcome<GrantAccessOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::GrantAccessAsync(const GrantAccessRequest& request, const GrantAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::GrantAccessAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::GrantAccessAsyncHelper, Aws::Client::RejectedAsyncCall<GrantAccessOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::GrantAccessAsync(GrantAccessRequest&& request, const GrantAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::GrantAccessAsyncHelper, Aws::Client::RejectedAsyncCall<GrantAccessOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::GrantAccessAsyncHelper(const GrantAccessRequest& request, const GrantAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1602,12 +2052,22 @@ RebootInstanceOutcome OpsWorksClient::RebootInstance(const RebootInstanceRequest
 
 RebootInstanceOutcomeCallable OpsWorksClient::RebootInstanceCallable(const RebootInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::RebootInstance, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::RebootInstance, Aws::Client::RejectedCallOutcome<RebootInstanceOutcome>(), this, request);
+}
+
+RebootInstanceOutcomeCallable OpsWorksClient::RebootInstanceCallable(RebootInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::RebootInstance, Aws::Client::RejectedCallOutcome<RebootInstanceOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::RebootInstanceAsync(const RebootInstanceRequest& request, const RebootInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::RebootInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::RebootInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<RebootInstanceOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::RebootInstanceAsync(RebootInstanceRequest&& request, const RebootInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::RebootInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<RebootInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::RebootInstanceAsyncHelper(const RebootInstanceRequest& request, const RebootInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1633,12 +2093,22 @@ RegisterEcsClusterOutcome OpsWorksClient::RegisterEcsCluster(const RegisterEcsCl
 
 RegisterEcsClusterOutcomeCallable OpsWorksClient::RegisterEcsClusterCallable(const RegisterEcsClusterRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::RegisterEcsCluster, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::RegisterEcsCluster, Aws::Client::RejectedCallOutcome<RegisterEcsClusterOutcome>(), this, request);
+}
+
+RegisterEcsClusterOutcomeCallable OpsWorksClient::RegisterEcsClusterCallable(RegisterEcsClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::RegisterEcsCluster, Aws::Client::RejectedCallOutcome<RegisterEcsClusterOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::RegisterEcsClusterAsync(const RegisterEcsClusterRequest& request, const RegisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::RegisterEcsClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::RegisterEcsClusterAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterEcsClusterOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::RegisterEcsClusterAsync(RegisterEcsClusterRequest&& request, const RegisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::RegisterEcsClusterAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterEcsClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::RegisterEcsClusterAsyncHelper(const RegisterEcsClusterRequest& request, const RegisterEcsClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1664,12 +2134,22 @@ RegisterElasticIpOutcome OpsWorksClient::RegisterElasticIp(const RegisterElastic
 
 RegisterElasticIpOutcomeCallable OpsWorksClient::RegisterElasticIpCallable(const RegisterElasticIpRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::RegisterElasticIp, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::RegisterElasticIp, Aws::Client::RejectedCallOutcome<RegisterElasticIpOutcome>(), this, request);
+}
+
+RegisterElasticIpOutcomeCallable OpsWorksClient::RegisterElasticIpCallable(RegisterElasticIpRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::RegisterElasticIp, Aws::Client::RejectedCallOutcome<RegisterElasticIpOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::RegisterElasticIpAsync(const RegisterElasticIpRequest& request, const RegisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::RegisterElasticIpAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::RegisterElasticIpAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterElasticIpOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::RegisterElasticIpAsync(RegisterElasticIpRequest&& request, const RegisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::RegisterElasticIpAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterElasticIpOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::RegisterElasticIpAsyncHelper(const RegisterElasticIpRequest& request, const RegisterElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1695,12 +2175,22 @@ RegisterInstanceOutcome OpsWorksClient::RegisterInstance(const RegisterInstanceR
 
 RegisterInstanceOutcomeCallable OpsWorksClient::RegisterInstanceCallable(const RegisterInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::RegisterInstance, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::RegisterInstance, Aws::Client::RejectedCallOutcome<RegisterInstanceOutcome>(), this, request);
+}
+
+RegisterInstanceOutcomeCallable OpsWorksClient::RegisterInstanceCallable(RegisterInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::RegisterInstance, Aws::Client::RejectedCallOutcome<RegisterInstanceOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::RegisterInstanceAsync(const RegisterInstanceRequest& request, const RegisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::RegisterInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::RegisterInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterInstanceOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::RegisterInstanceAsync(RegisterInstanceRequest&& request, const RegisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::RegisterInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::RegisterInstanceAsyncHelper(const RegisterInstanceRequest& request, const RegisterInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1726,12 +2216,22 @@ RegisterRdsDbInstanceOutcome OpsWorksClient::RegisterRdsDbInstance(const Registe
 
 RegisterRdsDbInstanceOutcomeCallable OpsWorksClient::RegisterRdsDbInstanceCallable(const RegisterRdsDbInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::RegisterRdsDbInstance, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::RegisterRdsDbInstance, Aws::Client::RejectedCallOutcome<RegisterRdsDbInstanceOutcome>(), this, request);
+}
+
+RegisterRdsDbInstanceOutcomeCallable OpsWorksClient::RegisterRdsDbInstanceCallable(RegisterRdsDbInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::RegisterRdsDbInstance, Aws::Client::RejectedCallOutcome<RegisterRdsDbInstanceOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::RegisterRdsDbInstanceAsync(const RegisterRdsDbInstanceRequest& request, const RegisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::RegisterRdsDbInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::RegisterRdsDbInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterRdsDbInstanceOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::RegisterRdsDbInstanceAsync(RegisterRdsDbInstanceRequest&& request, const RegisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::RegisterRdsDbInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterRdsDbInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::RegisterRdsDbInstanceAsyncHelper(const RegisterRdsDbInstanceRequest& request, const RegisterRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1757,12 +2257,22 @@ RegisterVolumeOutcome OpsWorksClient::RegisterVolume(const RegisterVolumeRequest
 
 RegisterVolumeOutcomeCallable OpsWorksClient::RegisterVolumeCallable(const RegisterVolumeRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::RegisterVolume, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::RegisterVolume, Aws::Client::RejectedCallOutcome<RegisterVolumeOutcome>(), this, request);
+}
+
+RegisterVolumeOutcomeCallable OpsWorksClient::RegisterVolumeCallable(RegisterVolumeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::RegisterVolume, Aws::Client::RejectedCallOutcome<RegisterVolumeOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::RegisterVolumeAsync(const RegisterVolumeRequest& request, const RegisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::RegisterVolumeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::RegisterVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterVolumeOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::RegisterVolumeAsync(RegisterVolumeRequest&& request, const RegisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::RegisterVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterVolumeOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::RegisterVolumeAsyncHelper(const RegisterVolumeRequest& request, const RegisterVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1788,12 +2298,22 @@ SetLoadBasedAutoScalingOutcome OpsWorksClient::SetLoadBasedAutoScaling(const Set
 
 SetLoadBasedAutoScalingOutcomeCallable OpsWorksClient::SetLoadBasedAutoScalingCallable(const SetLoadBasedAutoScalingRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::SetLoadBasedAutoScaling, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::SetLoadBasedAutoScaling, Aws::Client::RejectedCallOutcome<SetLoadBasedAutoScalingOutcome>(), this, request);
+}
+
+SetLoadBasedAutoScalingOutcomeCallable OpsWorksClient::SetLoadBasedAutoScalingCallable(SetLoadBasedAutoScalingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::SetLoadBasedAutoScaling, Aws::Client::RejectedCallOutcome<SetLoadBasedAutoScalingOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::SetLoadBasedAutoScalingAsync(const SetLoadBasedAutoScalingRequest& request, const SetLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::SetLoadBasedAutoScalingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::SetLoadBasedAutoScalingAsyncHelper, Aws::Client::RejectedAsyncCall<SetLoadBasedAutoScalingOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::SetLoadBasedAutoScalingAsync(SetLoadBasedAutoScalingRequest&& request, const SetLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::SetLoadBasedAutoScalingAsyncHelper, Aws::Client::RejectedAsyncCall<SetLoadBasedAutoScalingOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::SetLoadBasedAutoScalingAsyncHelper(const SetLoadBasedAutoScalingRequest& request, const SetLoadBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1819,12 +2339,22 @@ SetPermissionOutcome OpsWorksClient::SetPermission(const SetPermissionRequest& r
 
 SetPermissionOutcomeCallable OpsWorksClient::SetPermissionCallable(const SetPermissionRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::SetPermission, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::SetPermission, Aws::Client::RejectedCallOutcome<SetPermissionOutcome>(), this, request);
+}
+
+SetPermissionOutcomeCallable OpsWorksClient::SetPermissionCallable(SetPermissionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::SetPermission, Aws::Client::RejectedCallOutcome<SetPermissionOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::SetPermissionAsync(const SetPermissionRequest& request, const SetPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::SetPermissionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::SetPermissionAsyncHelper, Aws::Client::RejectedAsyncCall<SetPermissionOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::SetPermissionAsync(SetPermissionRequest&& request, const SetPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::SetPermissionAsyncHelper, Aws::Client::RejectedAsyncCall<SetPermissionOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::SetPermissionAsyncHelper(const SetPermissionRequest& request, const SetPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1850,12 +2380,22 @@ SetTimeBasedAutoScalingOutcome OpsWorksClient::SetTimeBasedAutoScaling(const Set
 
 SetTimeBasedAutoScalingOutcomeCallable OpsWorksClient::SetTimeBasedAutoScalingCallable(const SetTimeBasedAutoScalingRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::SetTimeBasedAutoScaling, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::SetTimeBasedAutoScaling, Aws::Client::RejectedCallOutcome<SetTimeBasedAutoScalingOutcome>(), this, request);
+}
+
+SetTimeBasedAutoScalingOutcomeCallable OpsWorksClient::SetTimeBasedAutoScalingCallable(SetTimeBasedAutoScalingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::SetTimeBasedAutoScaling, Aws::Client::RejectedCallOutcome<SetTimeBasedAutoScalingOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::SetTimeBasedAutoScalingAsync(const SetTimeBasedAutoScalingRequest& request, const SetTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::SetTimeBasedAutoScalingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::SetTimeBasedAutoScalingAsyncHelper, Aws::Client::RejectedAsyncCall<SetTimeBasedAutoScalingOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::SetTimeBasedAutoScalingAsync(SetTimeBasedAutoScalingRequest&& request, const SetTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::SetTimeBasedAutoScalingAsyncHelper, Aws::Client::RejectedAsyncCall<SetTimeBasedAutoScalingOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::SetTimeBasedAutoScalingAsyncHelper(const SetTimeBasedAutoScalingRequest& request, const SetTimeBasedAutoScalingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1881,12 +2421,22 @@ StartInstanceOutcome OpsWorksClient::StartInstance(const StartInstanceRequest& r
 
 StartInstanceOutcomeCallable OpsWorksClient::StartInstanceCallable(const StartInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::StartInstance, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::StartInstance, Aws::Client::RejectedCallOutcome<StartInstanceOutcome>(), this, request);
+}
+
+StartInstanceOutcomeCallable OpsWorksClient::StartInstanceCallable(StartInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::StartInstance, Aws::Client::RejectedCallOutcome<StartInstanceOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::StartInstanceAsync(const StartInstanceRequest& request, const StartInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::StartInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::StartInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<StartInstanceOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::StartInstanceAsync(StartInstanceRequest&& request, const StartInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::StartInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<StartInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::StartInstanceAsyncHelper(const StartInstanceRequest& request, const StartInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1912,12 +2462,22 @@ StartStackOutcome OpsWorksClient::StartStack(const StartStackRequest& request) c
 
 StartStackOutcomeCallable OpsWorksClient::StartStackCallable(const StartStackRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::StartStack, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::StartStack, Aws::Client::RejectedCallOutcome<StartStackOutcome>(), this, request);
+}
+
+StartStackOutcomeCallable OpsWorksClient::StartStackCallable(StartStackRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::StartStack, Aws::Client::RejectedCallOutcome<StartStackOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::StartStackAsync(const StartStackRequest& request, const StartStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::StartStackAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::StartStackAsyncHelper, Aws::Client::RejectedAsyncCall<StartStackOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::StartStackAsync(StartStackRequest&& request, const StartStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::StartStackAsyncHelper, Aws::Client::RejectedAsyncCall<StartStackOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::StartStackAsyncHelper(const StartStackRequest& request, const StartStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1943,12 +2503,22 @@ StopInstanceOutcome OpsWorksClient::StopInstance(const StopInstanceRequest& requ
 
 StopInstanceOutcomeCallable OpsWorksClient::StopInstanceCallable(const StopInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::StopInstance, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::StopInstance, Aws::Client::RejectedCallOutcome<StopInstanceOutcome>(), this, request);
+}
+
+StopInstanceOutcomeCallable OpsWorksClient::StopInstanceCallable(StopInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::StopInstance, Aws::Client::RejectedCallOutcome<StopInstanceOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::StopInstanceAsync(const StopInstanceRequest& request, const StopInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::StopInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::StopInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<StopInstanceOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::StopInstanceAsync(StopInstanceRequest&& request, const StopInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::StopInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<StopInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::StopInstanceAsyncHelper(const StopInstanceRequest& request, const StopInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1974,12 +2544,22 @@ StopStackOutcome OpsWorksClient::StopStack(const StopStackRequest& request) cons
 
 StopStackOutcomeCallable OpsWorksClient::StopStackCallable(const StopStackRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::StopStack, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::StopStack, Aws::Client::RejectedCallOutcome<StopStackOutcome>(), this, request);
+}
+
+StopStackOutcomeCallable OpsWorksClient::StopStackCallable(StopStackRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::StopStack, Aws::Client::RejectedCallOutcome<StopStackOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::StopStackAsync(const StopStackRequest& request, const StopStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::StopStackAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::StopStackAsyncHelper, Aws::Client::RejectedAsyncCall<StopStackOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::StopStackAsync(StopStackRequest&& request, const StopStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::StopStackAsyncHelper, Aws::Client::RejectedAsyncCall<StopStackOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::StopStackAsyncHelper(const StopStackRequest& request, const StopStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2005,12 +2585,22 @@ UnassignInstanceOutcome OpsWorksClient::UnassignInstance(const UnassignInstanceR
 
 UnassignInstanceOutcomeCallable OpsWorksClient::UnassignInstanceCallable(const UnassignInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::UnassignInstance, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UnassignInstance, Aws::Client::RejectedCallOutcome<UnassignInstanceOutcome>(), this, request);
+}
+
+UnassignInstanceOutcomeCallable OpsWorksClient::UnassignInstanceCallable(UnassignInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UnassignInstance, Aws::Client::RejectedCallOutcome<UnassignInstanceOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::UnassignInstanceAsync(const UnassignInstanceRequest& request, const UnassignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::UnassignInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::UnassignInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<UnassignInstanceOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::UnassignInstanceAsync(UnassignInstanceRequest&& request, const UnassignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::UnassignInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<UnassignInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::UnassignInstanceAsyncHelper(const UnassignInstanceRequest& request, const UnassignInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2036,12 +2626,22 @@ UnassignVolumeOutcome OpsWorksClient::UnassignVolume(const UnassignVolumeRequest
 
 UnassignVolumeOutcomeCallable OpsWorksClient::UnassignVolumeCallable(const UnassignVolumeRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::UnassignVolume, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UnassignVolume, Aws::Client::RejectedCallOutcome<UnassignVolumeOutcome>(), this, request);
+}
+
+UnassignVolumeOutcomeCallable OpsWorksClient::UnassignVolumeCallable(UnassignVolumeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UnassignVolume, Aws::Client::RejectedCallOutcome<UnassignVolumeOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::UnassignVolumeAsync(const UnassignVolumeRequest& request, const UnassignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::UnassignVolumeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::UnassignVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<UnassignVolumeOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::UnassignVolumeAsync(UnassignVolumeRequest&& request, const UnassignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::UnassignVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<UnassignVolumeOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::UnassignVolumeAsyncHelper(const UnassignVolumeRequest& request, const UnassignVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2067,12 +2667,22 @@ UpdateAppOutcome OpsWorksClient::UpdateApp(const UpdateAppRequest& request) cons
 
 UpdateAppOutcomeCallable OpsWorksClient::UpdateAppCallable(const UpdateAppRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::UpdateApp, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateApp, Aws::Client::RejectedCallOutcome<UpdateAppOutcome>(), this, request);
+}
+
+UpdateAppOutcomeCallable OpsWorksClient::UpdateAppCallable(UpdateAppRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateApp, Aws::Client::RejectedCallOutcome<UpdateAppOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::UpdateAppAsync(const UpdateAppRequest& request, const UpdateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::UpdateAppAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateAppAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAppOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::UpdateAppAsync(UpdateAppRequest&& request, const UpdateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateAppAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAppOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::UpdateAppAsyncHelper(const UpdateAppRequest& request, const UpdateAppResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2098,12 +2708,22 @@ UpdateElasticIpOutcome OpsWorksClient::UpdateElasticIp(const UpdateElasticIpRequ
 
 UpdateElasticIpOutcomeCallable OpsWorksClient::UpdateElasticIpCallable(const UpdateElasticIpRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::UpdateElasticIp, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateElasticIp, Aws::Client::RejectedCallOutcome<UpdateElasticIpOutcome>(), this, request);
+}
+
+UpdateElasticIpOutcomeCallable OpsWorksClient::UpdateElasticIpCallable(UpdateElasticIpRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateElasticIp, Aws::Client::RejectedCallOutcome<UpdateElasticIpOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::UpdateElasticIpAsync(const UpdateElasticIpRequest& request, const UpdateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::UpdateElasticIpAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateElasticIpAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateElasticIpOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::UpdateElasticIpAsync(UpdateElasticIpRequest&& request, const UpdateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateElasticIpAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateElasticIpOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::UpdateElasticIpAsyncHelper(const UpdateElasticIpRequest& request, const UpdateElasticIpResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2129,12 +2749,22 @@ UpdateInstanceOutcome OpsWorksClient::UpdateInstance(const UpdateInstanceRequest
 
 UpdateInstanceOutcomeCallable OpsWorksClient::UpdateInstanceCallable(const UpdateInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::UpdateInstance, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateInstance, Aws::Client::RejectedCallOutcome<UpdateInstanceOutcome>(), this, request);
+}
+
+UpdateInstanceOutcomeCallable OpsWorksClient::UpdateInstanceCallable(UpdateInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateInstance, Aws::Client::RejectedCallOutcome<UpdateInstanceOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::UpdateInstanceAsync(const UpdateInstanceRequest& request, const UpdateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::UpdateInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateInstanceOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::UpdateInstanceAsync(UpdateInstanceRequest&& request, const UpdateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::UpdateInstanceAsyncHelper(const UpdateInstanceRequest& request, const UpdateInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2160,12 +2790,22 @@ UpdateLayerOutcome OpsWorksClient::UpdateLayer(const UpdateLayerRequest& request
 
 UpdateLayerOutcomeCallable OpsWorksClient::UpdateLayerCallable(const UpdateLayerRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::UpdateLayer, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateLayer, Aws::Client::RejectedCallOutcome<UpdateLayerOutcome>(), this, request);
+}
+
+UpdateLayerOutcomeCallable OpsWorksClient::UpdateLayerCallable(UpdateLayerRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateLayer, Aws::Client::RejectedCallOutcome<UpdateLayerOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::UpdateLayerAsync(const UpdateLayerRequest& request, const UpdateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::UpdateLayerAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateLayerAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateLayerOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::UpdateLayerAsync(UpdateLayerRequest&& request, const UpdateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateLayerAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateLayerOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::UpdateLayerAsyncHelper(const UpdateLayerRequest& request, const UpdateLayerResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2191,12 +2831,22 @@ UpdateMyUserProfileOutcome OpsWorksClient::UpdateMyUserProfile(const UpdateMyUse
 
 UpdateMyUserProfileOutcomeCallable OpsWorksClient::UpdateMyUserProfileCallable(const UpdateMyUserProfileRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::UpdateMyUserProfile, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateMyUserProfile, Aws::Client::RejectedCallOutcome<UpdateMyUserProfileOutcome>(), this, request);
+}
+
+UpdateMyUserProfileOutcomeCallable OpsWorksClient::UpdateMyUserProfileCallable(UpdateMyUserProfileRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateMyUserProfile, Aws::Client::RejectedCallOutcome<UpdateMyUserProfileOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::UpdateMyUserProfileAsync(const UpdateMyUserProfileRequest& request, const UpdateMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::UpdateMyUserProfileAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateMyUserProfileAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateMyUserProfileOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::UpdateMyUserProfileAsync(UpdateMyUserProfileRequest&& request, const UpdateMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateMyUserProfileAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateMyUserProfileOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::UpdateMyUserProfileAsyncHelper(const UpdateMyUserProfileRequest& request, const UpdateMyUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2222,12 +2872,22 @@ UpdateRdsDbInstanceOutcome OpsWorksClient::UpdateRdsDbInstance(const UpdateRdsDb
 
 UpdateRdsDbInstanceOutcomeCallable OpsWorksClient::UpdateRdsDbInstanceCallable(const UpdateRdsDbInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::UpdateRdsDbInstance, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateRdsDbInstance, Aws::Client::RejectedCallOutcome<UpdateRdsDbInstanceOutcome>(), this, request);
+}
+
+UpdateRdsDbInstanceOutcomeCallable OpsWorksClient::UpdateRdsDbInstanceCallable(UpdateRdsDbInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateRdsDbInstance, Aws::Client::RejectedCallOutcome<UpdateRdsDbInstanceOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::UpdateRdsDbInstanceAsync(const UpdateRdsDbInstanceRequest& request, const UpdateRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::UpdateRdsDbInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateRdsDbInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateRdsDbInstanceOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::UpdateRdsDbInstanceAsync(UpdateRdsDbInstanceRequest&& request, const UpdateRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateRdsDbInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateRdsDbInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::UpdateRdsDbInstanceAsyncHelper(const UpdateRdsDbInstanceRequest& request, const UpdateRdsDbInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2253,12 +2913,22 @@ UpdateStackOutcome OpsWorksClient::UpdateStack(const UpdateStackRequest& request
 
 UpdateStackOutcomeCallable OpsWorksClient::UpdateStackCallable(const UpdateStackRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::UpdateStack, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateStack, Aws::Client::RejectedCallOutcome<UpdateStackOutcome>(), this, request);
+}
+
+UpdateStackOutcomeCallable OpsWorksClient::UpdateStackCallable(UpdateStackRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateStack, Aws::Client::RejectedCallOutcome<UpdateStackOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::UpdateStackAsync(const UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::UpdateStackAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateStackAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateStackOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::UpdateStackAsync(UpdateStackRequest&& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateStackAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateStackOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::UpdateStackAsyncHelper(const UpdateStackRequest& request, const UpdateStackResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2284,12 +2954,22 @@ UpdateUserProfileOutcome OpsWorksClient::UpdateUserProfile(const UpdateUserProfi
 
 UpdateUserProfileOutcomeCallable OpsWorksClient::UpdateUserProfileCallable(const UpdateUserProfileRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::UpdateUserProfile, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateUserProfile, Aws::Client::RejectedCallOutcome<UpdateUserProfileOutcome>(), this, request);
+}
+
+UpdateUserProfileOutcomeCallable OpsWorksClient::UpdateUserProfileCallable(UpdateUserProfileRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateUserProfile, Aws::Client::RejectedCallOutcome<UpdateUserProfileOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::UpdateUserProfileAsync(const UpdateUserProfileRequest& request, const UpdateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::UpdateUserProfileAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateUserProfileAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateUserProfileOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::UpdateUserProfileAsync(UpdateUserProfileRequest&& request, const UpdateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateUserProfileAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateUserProfileOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::UpdateUserProfileAsyncHelper(const UpdateUserProfileRequest& request, const UpdateUserProfileResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2315,12 +2995,22 @@ UpdateVolumeOutcome OpsWorksClient::UpdateVolume(const UpdateVolumeRequest& requ
 
 UpdateVolumeOutcomeCallable OpsWorksClient::UpdateVolumeCallable(const UpdateVolumeRequest& request) const
 {
-  return std::async(std::launch::async, &OpsWorksClient::UpdateVolume, this, request);
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateVolume, Aws::Client::RejectedCallOutcome<UpdateVolumeOutcome>(), this, request);
+}
+
+UpdateVolumeOutcomeCallable OpsWorksClient::UpdateVolumeCallable(UpdateVolumeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&OpsWorksClient::UpdateVolume, Aws::Client::RejectedCallOutcome<UpdateVolumeOutcome>(), this, std::move(request));
 }
 
 void OpsWorksClient::UpdateVolumeAsync(const UpdateVolumeRequest& request, const UpdateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&OpsWorksClient::UpdateVolumeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateVolumeOutcome>(), this, request, handler, context);
+}
+
+void OpsWorksClient::UpdateVolumeAsync(UpdateVolumeRequest&& request, const UpdateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&OpsWorksClient::UpdateVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateVolumeOutcome>(), this, std::move(request), handler, context);
 }
 
 void OpsWorksClient::UpdateVolumeAsyncHelper(const UpdateVolumeRequest& request, const UpdateVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
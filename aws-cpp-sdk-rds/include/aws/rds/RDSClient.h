@@ -94,6 +94,88 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/rds/model/AddSourceIdentifierToSubscriptionRequest.h>
+#include <aws/rds/model/AddTagsToResourceRequest.h>
+#include <aws/rds/model/ApplyPendingMaintenanceActionRequest.h>
+#include <aws/rds/model/AuthorizeDBSecurityGroupIngressRequest.h>
+#include <aws/rds/model/CopyDBClusterSnapshotRequest.h>
+#include <aws/rds/model/CopyDBParameterGroupRequest.h>
+#include <aws/rds/model/CopyDBSnapshotRequest.h>
+#include <aws/rds/model/CopyOptionGroupRequest.h>
+#include <aws/rds/model/CreateDBClusterRequest.h>
+#include <aws/rds/model/CreateDBClusterParameterGroupRequest.h>
+#include <aws/rds/model/CreateDBClusterSnapshotRequest.h>
+#include <aws/rds/model/CreateDBInstanceRequest.h>
+#include <aws/rds/model/CreateDBInstanceReadReplicaRequest.h>
+#include <aws/rds/model/CreateDBParameterGroupRequest.h>
+#include <aws/rds/model/CreateDBSecurityGroupRequest.h>
+#include <aws/rds/model/CreateDBSnapshotRequest.h>
+#include <aws/rds/model/CreateDBSubnetGroupRequest.h>
+#include <aws/rds/model/CreateEventSubscriptionRequest.h>
+#include <aws/rds/model/CreateOptionGroupRequest.h>
+#include <aws/rds/model/DeleteDBClusterRequest.h>
+#include <aws/rds/model/DeleteDBClusterParameterGroupRequest.h>
+#include <aws/rds/model/DeleteDBClusterSnapshotRequest.h>
+#include <aws/rds/model/DeleteDBInstanceRequest.h>
+#include <aws/rds/model/DeleteDBParameterGroupRequest.h>
+#include <aws/rds/model/DeleteDBSecurityGroupRequest.h>
+#include <aws/rds/model/DeleteDBSnapshotRequest.h>
+#include <aws/rds/model/DeleteDBSubnetGroupRequest.h>
+#include <aws/rds/model/DeleteEventSubscriptionRequest.h>
+#include <aws/rds/model/DeleteOptionGroupRequest.h>
+#include <aws/rds/model/DescribeAccountAttributesRequest.h>
+#include <aws/rds/model/DescribeCertificatesRequest.h>
+#include <aws/rds/model/DescribeDBClusterParameterGroupsRequest.h>
+#include <aws/rds/model/DescribeDBClusterParametersRequest.h>
+#include <aws/rds/model/DescribeDBClusterSnapshotsRequest.h>
+#include <aws/rds/model/DescribeDBClustersRequest.h>
+#include <aws/rds/model/DescribeDBEngineVersionsRequest.h>
+#include <aws/rds/model/DescribeDBInstancesRequest.h>
+#include <aws/rds/model/DescribeDBLogFilesRequest.h>
+#include <aws/rds/model/DescribeDBParameterGroupsRequest.h>
+#include <aws/rds/model/DescribeDBParametersRequest.h>
+#include <aws/rds/model/DescribeDBSecurityGroupsRequest.h>
+#include <aws/rds/model/DescribeDBSnapshotAttributesRequest.h>
+#include <aws/rds/model/DescribeDBSnapshotsRequest.h>
+#include <aws/rds/model/DescribeDBSubnetGroupsRequest.h>
+#include <aws/rds/model/DescribeEngineDefaultClusterParametersRequest.h>
+#include <aws/rds/model/DescribeEngineDefaultParametersRequest.h>
+#include <aws/rds/model/DescribeEventCategoriesRequest.h>
+#include <aws/rds/model/DescribeEventSubscriptionsRequest.h>
+#include <aws/rds/model/DescribeEventsRequest.h>
+#include <aws/rds/model/DescribeOptionGroupOptionsRequest.h>
+#include <aws/rds/model/DescribeOptionGroupsRequest.h>
+#include <aws/rds/model/DescribeOrderableDBInstanceOptionsRequest.h>
+#include <aws/rds/model/DescribePendingMaintenanceActionsRequest.h>
+#include <aws/rds/model/DescribeReservedDBInstancesRequest.h>
+#include <aws/rds/model/DescribeReservedDBInstancesOfferingsRequest.h>
+#include <aws/rds/model/DownloadDBLogFilePortionRequest.h>
+#include <aws/rds/model/FailoverDBClusterRequest.h>
+#include <aws/rds/model/ListTagsForResourceRequest.h>
+#include <aws/rds/model/ModifyDBClusterRequest.h>
+#include <aws/rds/model/ModifyDBClusterParameterGroupRequest.h>
+#include <aws/rds/model/ModifyDBInstanceRequest.h>
+#include <aws/rds/model/ModifyDBParameterGroupRequest.h>
+#include <aws/rds/model/ModifyDBSnapshotAttributeRequest.h>
+#include <aws/rds/model/ModifyDBSubnetGroupRequest.h>
+#include <aws/rds/model/ModifyEventSubscriptionRequest.h>
+#include <aws/rds/model/ModifyOptionGroupRequest.h>
+#include <aws/rds/model/PromoteReadReplicaRequest.h>
+#include <aws/rds/model/PurchaseReservedDBInstancesOfferingRequest.h>
+#include <aws/rds/model/RebootDBInstanceRequest.h>
+#include <aws/rds/model/RemoveSourceIdentifierFromSubscriptionRequest.h>
+#include <aws/rds/model/RemoveTagsFromResourceRequest.h>
+#include <aws/rds/model/ResetDBClusterParameterGroupRequest.h>
+#include <aws/rds/model/ResetDBParameterGroupRequest.h>
+#include <aws/rds/model/RestoreDBClusterFromSnapshotRequest.h>
+#include <aws/rds/model/RestoreDBClusterToPointInTimeRequest.h>
+#include <aws/rds/model/RestoreDBInstanceFromDBSnapshotRequest.h>
+#include <aws/rds/model/RestoreDBInstanceToPointInTimeRequest.h>
+#include <aws/rds/model/RevokeDBSecurityGroupIngressRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -523,6 +605,11 @@ namespace Model
          */
         virtual Model::AddSourceIdentifierToSubscriptionOutcomeCallable AddSourceIdentifierToSubscriptionCallable(const Model::AddSourceIdentifierToSubscriptionRequest& request) const;
 
+        /**
+         * Same as AddSourceIdentifierToSubscriptionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddSourceIdentifierToSubscriptionOutcomeCallable AddSourceIdentifierToSubscriptionCallable(Model::AddSourceIdentifierToSubscriptionRequest&& request) const;
+
         /**
          * <p>Adds a source identifier to an existing RDS event notification
          * subscription.</p>
@@ -531,6 +618,11 @@ namespace Model
          */
         virtual void AddSourceIdentifierToSubscriptionAsync(const Model::AddSourceIdentifierToSubscriptionRequest& request, const AddSourceIdentifierToSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddSourceIdentifierToSubscriptionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddSourceIdentifierToSubscriptionAsync(Model::AddSourceIdentifierToSubscriptionRequest&& request, const AddSourceIdentifierToSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Adds metadata tags to an Amazon RDS resource. These tags can also be used
          * with cost allocation reporting to track cost associated with Amazon RDS
@@ -553,6 +645,11 @@ namespace Model
          */
         virtual Model::AddTagsToResourceOutcomeCallable AddTagsToResourceCallable(const Model::AddTagsToResourceRequest& request) const;
 
+        /**
+         * Same as AddTagsToResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddTagsToResourceOutcomeCallable AddTagsToResourceCallable(Model::AddTagsToResourceRequest&& request) const;
+
         /**
          * <p> Adds metadata tags to an Amazon RDS resource. These tags can also be used
          * with cost allocation reporting to track cost associated with Amazon RDS
@@ -565,6 +662,11 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddTagsToResourceAsync(Model::AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Applies a pending maintenance action to a resource (for example, to a DB
          * instance).</p>
@@ -579,6 +681,11 @@ namespace Model
          */
         virtual Model::ApplyPendingMaintenanceActionOutcomeCallable ApplyPendingMaintenanceActionCallable(const Model::ApplyPendingMaintenanceActionRequest& request) const;
 
+        /**
+         * Same as ApplyPendingMaintenanceActionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ApplyPendingMaintenanceActionOutcomeCallable ApplyPendingMaintenanceActionCallable(Model::ApplyPendingMaintenanceActionRequest&& request) const;
+
         /**
          * <p>Applies a pending maintenance action to a resource (for example, to a DB
          * instance).</p>
@@ -587,6 +694,11 @@ namespace Model
          */
         virtual void ApplyPendingMaintenanceActionAsync(const Model::ApplyPendingMaintenanceActionRequest& request, const ApplyPendingMaintenanceActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ApplyPendingMaintenanceActionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ApplyPendingMaintenanceActionAsync(Model::ApplyPendingMaintenanceActionRequest&& request, const ApplyPendingMaintenanceActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Enables ingress to a DBSecurityGroup using one of two forms of
          * authorization. First, EC2 or VPC security groups can be added to the
@@ -623,6 +735,11 @@ namespace Model
          */
         virtual Model::AuthorizeDBSecurityGroupIngressOutcomeCallable AuthorizeDBSecurityGroupIngressCallable(const Model::AuthorizeDBSecurityGroupIngressRequest& request) const;
 
+        /**
+         * Same as AuthorizeDBSecurityGroupIngressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AuthorizeDBSecurityGroupIngressOutcomeCallable AuthorizeDBSecurityGroupIngressCallable(Model::AuthorizeDBSecurityGroupIngressRequest&& request) const;
+
         /**
          * <p> Enables ingress to a DBSecurityGroup using one of two forms of
          * authorization. First, EC2 or VPC security groups can be added to the
@@ -642,6 +759,11 @@ namespace Model
          */
         virtual void AuthorizeDBSecurityGroupIngressAsync(const Model::AuthorizeDBSecurityGroupIngressRequest& request, const AuthorizeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AuthorizeDBSecurityGroupIngressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AuthorizeDBSecurityGroupIngressAsync(Model::AuthorizeDBSecurityGroupIngressRequest&& request, const AuthorizeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a snapshot of a DB cluster. For more information on Amazon Aurora,
          * see <a
@@ -660,6 +782,11 @@ namespace Model
          */
         virtual Model::CopyDBClusterSnapshotOutcomeCallable CopyDBClusterSnapshotCallable(const Model::CopyDBClusterSnapshotRequest& request) const;
 
+        /**
+         * Same as CopyDBClusterSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CopyDBClusterSnapshotOutcomeCallable CopyDBClusterSnapshotCallable(Model::CopyDBClusterSnapshotRequest&& request) const;
+
         /**
          * <p>Creates a snapshot of a DB cluster. For more information on Amazon Aurora,
          * see <a
@@ -670,6 +797,11 @@ namespace Model
          */
         virtual void CopyDBClusterSnapshotAsync(const Model::CopyDBClusterSnapshotRequest& request, const CopyDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyDBClusterSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CopyDBClusterSnapshotAsync(Model::CopyDBClusterSnapshotRequest&& request, const CopyDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Copies the specified DB parameter group. </p>
          */
@@ -682,6 +814,11 @@ namespace Model
          */
         virtual Model::CopyDBParameterGroupOutcomeCallable CopyDBParameterGroupCallable(const Model::CopyDBParameterGroupRequest& request) const;
 
+        /**
+         * Same as CopyDBParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CopyDBParameterGroupOutcomeCallable CopyDBParameterGroupCallable(Model::CopyDBParameterGroupRequest&& request) const;
+
         /**
          * <p> Copies the specified DB parameter group. </p>
          *
@@ -689,6 +826,11 @@ namespace Model
          */
         virtual void CopyDBParameterGroupAsync(const Model::CopyDBParameterGroupRequest& request, const CopyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyDBParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CopyDBParameterGroupAsync(Model::CopyDBParameterGroupRequest&& request, const CopyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Copies the specified DBSnapshot. The source DB snapshot must be in the
          * "available" state. </p> <p>If you are copying from a shared manual DB snapshot,
@@ -707,6 +849,11 @@ namespace Model
          */
         virtual Model::CopyDBSnapshotOutcomeCallable CopyDBSnapshotCallable(const Model::CopyDBSnapshotRequest& request) const;
 
+        /**
+         * Same as CopyDBSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CopyDBSnapshotOutcomeCallable CopyDBSnapshotCallable(Model::CopyDBSnapshotRequest&& request) const;
+
         /**
          * <p> Copies the specified DBSnapshot. The source DB snapshot must be in the
          * "available" state. </p> <p>If you are copying from a shared manual DB snapshot,
@@ -717,6 +864,11 @@ namespace Model
          */
         virtual void CopyDBSnapshotAsync(const Model::CopyDBSnapshotRequest& request, const CopyDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyDBSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CopyDBSnapshotAsync(Model::CopyDBSnapshotRequest&& request, const CopyDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Copies the specified option group. </p>
          */
@@ -729,6 +881,11 @@ namespace Model
          */
         virtual Model::CopyOptionGroupOutcomeCallable CopyOptionGroupCallable(const Model::CopyOptionGroupRequest& request) const;
 
+        /**
+         * Same as CopyOptionGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CopyOptionGroupOutcomeCallable CopyOptionGroupCallable(Model::CopyOptionGroupRequest&& request) const;
+
         /**
          * <p>Copies the specified option group. </p>
          *
@@ -736,6 +893,11 @@ namespace Model
          */
         virtual void CopyOptionGroupAsync(const Model::CopyOptionGroupRequest& request, const CopyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyOptionGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CopyOptionGroupAsync(Model::CopyOptionGroupRequest&& request, const CopyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new Amazon Aurora DB cluster. For more information on Amazon
          * Aurora, see <a
@@ -754,6 +916,11 @@ namespace Model
          */
         virtual Model::CreateDBClusterOutcomeCallable CreateDBClusterCallable(const Model::CreateDBClusterRequest& request) const;
 
+        /**
+         * Same as CreateDBClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDBClusterOutcomeCallable CreateDBClusterCallable(Model::CreateDBClusterRequest&& request) const;
+
         /**
          * <p>Creates a new Amazon Aurora DB cluster. For more information on Amazon
          * Aurora, see <a
@@ -764,6 +931,11 @@ namespace Model
          */
         virtual void CreateDBClusterAsync(const Model::CreateDBClusterRequest& request, const CreateDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDBClusterAsync(Model::CreateDBClusterRequest&& request, const CreateDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new DB cluster parameter group. </p> <p> Parameters in a DB
          * cluster parameter group apply to all of the instances in a DB cluster. </p> <p>
@@ -822,6 +994,11 @@ namespace Model
          */
         virtual Model::CreateDBClusterParameterGroupOutcomeCallable CreateDBClusterParameterGroupCallable(const Model::CreateDBClusterParameterGroupRequest& request) const;
 
+        /**
+         * Same as CreateDBClusterParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDBClusterParameterGroupOutcomeCallable CreateDBClusterParameterGroupCallable(Model::CreateDBClusterParameterGroupRequest&& request) const;
+
         /**
          * <p> Creates a new DB cluster parameter group. </p> <p> Parameters in a DB
          * cluster parameter group apply to all of the instances in a DB cluster. </p> <p>
@@ -852,6 +1029,11 @@ namespace Model
          */
         virtual void CreateDBClusterParameterGroupAsync(const Model::CreateDBClusterParameterGroupRequest& request, const CreateDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBClusterParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDBClusterParameterGroupAsync(Model::CreateDBClusterParameterGroupRequest&& request, const CreateDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a snapshot of a DB cluster. For more information on Amazon Aurora,
          * see <a
@@ -870,6 +1052,11 @@ namespace Model
          */
         virtual Model::CreateDBClusterSnapshotOutcomeCallable CreateDBClusterSnapshotCallable(const Model::CreateDBClusterSnapshotRequest& request) const;
 
+        /**
+         * Same as CreateDBClusterSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDBClusterSnapshotOutcomeCallable CreateDBClusterSnapshotCallable(Model::CreateDBClusterSnapshotRequest&& request) const;
+
         /**
          * <p>Creates a snapshot of a DB cluster. For more information on Amazon Aurora,
          * see <a
@@ -880,6 +1067,11 @@ namespace Model
          */
         virtual void CreateDBClusterSnapshotAsync(const Model::CreateDBClusterSnapshotRequest& request, const CreateDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBClusterSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDBClusterSnapshotAsync(Model::CreateDBClusterSnapshotRequest&& request, const CreateDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new DB instance. </p>
          */
@@ -892,6 +1084,11 @@ namespace Model
          */
         virtual Model::CreateDBInstanceOutcomeCallable CreateDBInstanceCallable(const Model::CreateDBInstanceRequest& request) const;
 
+        /**
+         * Same as CreateDBInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDBInstanceOutcomeCallable CreateDBInstanceCallable(Model::CreateDBInstanceRequest&& request) const;
+
         /**
          * <p> Creates a new DB instance. </p>
          *
@@ -899,6 +1096,11 @@ namespace Model
          */
         virtual void CreateDBInstanceAsync(const Model::CreateDBInstanceRequest& request, const CreateDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDBInstanceAsync(Model::CreateDBInstanceRequest&& request, const CreateDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a DB instance for a DB instance running MySQL, MariaDB, or
          * PostgreSQL that acts as a Read Replica of a source DB instance. </p> <p> All
@@ -923,6 +1125,11 @@ namespace Model
          */
         virtual Model::CreateDBInstanceReadReplicaOutcomeCallable CreateDBInstanceReadReplicaCallable(const Model::CreateDBInstanceReadReplicaRequest& request) const;
 
+        /**
+         * Same as CreateDBInstanceReadReplicaCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDBInstanceReadReplicaOutcomeCallable CreateDBInstanceReadReplicaCallable(Model::CreateDBInstanceReadReplicaRequest&& request) const;
+
         /**
          * <p> Creates a DB instance for a DB instance running MySQL, MariaDB, or
          * PostgreSQL that acts as a Read Replica of a source DB instance. </p> <p> All
@@ -936,6 +1143,11 @@ namespace Model
          */
         virtual void CreateDBInstanceReadReplicaAsync(const Model::CreateDBInstanceReadReplicaRequest& request, const CreateDBInstanceReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBInstanceReadReplicaAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDBInstanceReadReplicaAsync(Model::CreateDBInstanceReadReplicaRequest&& request, const CreateDBInstanceReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new DB parameter group. </p> <p> A DB parameter group is initially
          * created with the default parameters for the database engine used by the DB
@@ -984,6 +1196,11 @@ namespace Model
          */
         virtual Model::CreateDBParameterGroupOutcomeCallable CreateDBParameterGroupCallable(const Model::CreateDBParameterGroupRequest& request) const;
 
+        /**
+         * Same as CreateDBParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDBParameterGroupOutcomeCallable CreateDBParameterGroupCallable(Model::CreateDBParameterGroupRequest&& request) const;
+
         /**
          * <p> Creates a new DB parameter group. </p> <p> A DB parameter group is initially
          * created with the default parameters for the database engine used by the DB
@@ -1009,6 +1226,11 @@ namespace Model
          */
         virtual void CreateDBParameterGroupAsync(const Model::CreateDBParameterGroupRequest& request, const CreateDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDBParameterGroupAsync(Model::CreateDBParameterGroupRequest&& request, const CreateDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new DB security group. DB security groups control access to a DB
          * instance. </p>
@@ -1023,6 +1245,11 @@ namespace Model
          */
         virtual Model::CreateDBSecurityGroupOutcomeCallable CreateDBSecurityGroupCallable(const Model::CreateDBSecurityGroupRequest& request) const;
 
+        /**
+         * Same as CreateDBSecurityGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDBSecurityGroupOutcomeCallable CreateDBSecurityGroupCallable(Model::CreateDBSecurityGroupRequest&& request) const;
+
         /**
          * <p> Creates a new DB security group. DB security groups control access to a DB
          * instance. </p>
@@ -1031,6 +1258,11 @@ namespace Model
          */
         virtual void CreateDBSecurityGroupAsync(const Model::CreateDBSecurityGroupRequest& request, const CreateDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBSecurityGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDBSecurityGroupAsync(Model::CreateDBSecurityGroupRequest&& request, const CreateDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a DBSnapshot. The source DBInstance must be in "available" state.
          * </p>
@@ -1045,6 +1277,11 @@ namespace Model
          */
         virtual Model::CreateDBSnapshotOutcomeCallable CreateDBSnapshotCallable(const Model::CreateDBSnapshotRequest& request) const;
 
+        /**
+         * Same as CreateDBSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDBSnapshotOutcomeCallable CreateDBSnapshotCallable(Model::CreateDBSnapshotRequest&& request) const;
+
         /**
          * <p> Creates a DBSnapshot. The source DBInstance must be in "available" state.
          * </p>
@@ -1053,6 +1290,11 @@ namespace Model
          */
         virtual void CreateDBSnapshotAsync(const Model::CreateDBSnapshotRequest& request, const CreateDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDBSnapshotAsync(Model::CreateDBSnapshotRequest&& request, const CreateDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new DB subnet group. DB subnet groups must contain at least one
          * subnet in at least two AZs in the region. </p>
@@ -1067,6 +1309,11 @@ namespace Model
          */
         virtual Model::CreateDBSubnetGroupOutcomeCallable CreateDBSubnetGroupCallable(const Model::CreateDBSubnetGroupRequest& request) const;
 
+        /**
+         * Same as CreateDBSubnetGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDBSubnetGroupOutcomeCallable CreateDBSubnetGroupCallable(Model::CreateDBSubnetGroupRequest&& request) const;
+
         /**
          * <p> Creates a new DB subnet group. DB subnet groups must contain at least one
          * subnet in at least two AZs in the region. </p>
@@ -1075,6 +1322,11 @@ namespace Model
          */
         virtual void CreateDBSubnetGroupAsync(const Model::CreateDBSubnetGroupRequest& request, const CreateDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDBSubnetGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDBSubnetGroupAsync(Model::CreateDBSubnetGroupRequest&& request, const CreateDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an RDS event notification subscription. This action requires a topic
          * ARN (Amazon Resource Name) created by either the RDS console, the SNS console,
@@ -1117,6 +1369,11 @@ namespace Model
          */
         virtual Model::CreateEventSubscriptionOutcomeCallable CreateEventSubscriptionCallable(const Model::CreateEventSubscriptionRequest& request) const;
 
+        /**
+         * Same as CreateEventSubscriptionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateEventSubscriptionOutcomeCallable CreateEventSubscriptionCallable(Model::CreateEventSubscriptionRequest&& request) const;
+
         /**
          * <p>Creates an RDS event notification subscription. This action requires a topic
          * ARN (Amazon Resource Name) created by either the RDS console, the SNS console,
@@ -1139,6 +1396,11 @@ namespace Model
          */
         virtual void CreateEventSubscriptionAsync(const Model::CreateEventSubscriptionRequest& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateEventSubscriptionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateEventSubscriptionAsync(Model::CreateEventSubscriptionRequest&& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new option group. You can create up to 20 option groups. </p>
          */
@@ -1151,6 +1413,11 @@ namespace Model
          */
         virtual Model::CreateOptionGroupOutcomeCallable CreateOptionGroupCallable(const Model::CreateOptionGroupRequest& request) const;
 
+        /**
+         * Same as CreateOptionGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateOptionGroupOutcomeCallable CreateOptionGroupCallable(Model::CreateOptionGroupRequest&& request) const;
+
         /**
          * <p> Creates a new option group. You can create up to 20 option groups. </p>
          *
@@ -1158,6 +1425,11 @@ namespace Model
          */
         virtual void CreateOptionGroupAsync(const Model::CreateOptionGroupRequest& request, const CreateOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateOptionGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateOptionGroupAsync(Model::CreateOptionGroupRequest&& request, const CreateOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>The DeleteDBCluster action deletes a previously provisioned DB cluster. A
          * successful response from the web service indicates the request was received
@@ -1184,6 +1456,11 @@ namespace Model
          */
         virtual Model::DeleteDBClusterOutcomeCallable DeleteDBClusterCallable(const Model::DeleteDBClusterRequest& request) const;
 
+        /**
+         * Same as DeleteDBClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDBClusterOutcomeCallable DeleteDBClusterCallable(Model::DeleteDBClusterRequest&& request) const;
+
         /**
          * <p>The DeleteDBCluster action deletes a previously provisioned DB cluster. A
          * successful response from the web service indicates the request was received
@@ -1198,6 +1475,11 @@ namespace Model
          */
         virtual void DeleteDBClusterAsync(const Model::DeleteDBClusterRequest& request, const DeleteDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDBClusterAsync(Model::DeleteDBClusterRequest&& request, const DeleteDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a specified DB cluster parameter group. The DB cluster parameter
          * group to be deleted cannot be associated with any DB clusters. </p> <p>For more
@@ -1218,6 +1500,11 @@ namespace Model
          */
         virtual Model::DeleteDBClusterParameterGroupOutcomeCallable DeleteDBClusterParameterGroupCallable(const Model::DeleteDBClusterParameterGroupRequest& request) const;
 
+        /**
+         * Same as DeleteDBClusterParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDBClusterParameterGroupOutcomeCallable DeleteDBClusterParameterGroupCallable(Model::DeleteDBClusterParameterGroupRequest&& request) const;
+
         /**
          * <p> Deletes a specified DB cluster parameter group. The DB cluster parameter
          * group to be deleted cannot be associated with any DB clusters. </p> <p>For more
@@ -1229,6 +1516,11 @@ namespace Model
          */
         virtual void DeleteDBClusterParameterGroupAsync(const Model::DeleteDBClusterParameterGroupRequest& request, const DeleteDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBClusterParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDBClusterParameterGroupAsync(Model::DeleteDBClusterParameterGroupRequest&& request, const DeleteDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a DB cluster snapshot. If the snapshot is being copied, the copy
          * operation is terminated. </p> <note>The DB cluster snapshot must be in the
@@ -1251,6 +1543,11 @@ namespace Model
          */
         virtual Model::DeleteDBClusterSnapshotOutcomeCallable DeleteDBClusterSnapshotCallable(const Model::DeleteDBClusterSnapshotRequest& request) const;
 
+        /**
+         * Same as DeleteDBClusterSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDBClusterSnapshotOutcomeCallable DeleteDBClusterSnapshotCallable(Model::DeleteDBClusterSnapshotRequest&& request) const;
+
         /**
          * <p>Deletes a DB cluster snapshot. If the snapshot is being copied, the copy
          * operation is terminated. </p> <note>The DB cluster snapshot must be in the
@@ -1263,6 +1560,11 @@ namespace Model
          */
         virtual void DeleteDBClusterSnapshotAsync(const Model::DeleteDBClusterSnapshotRequest& request, const DeleteDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBClusterSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDBClusterSnapshotAsync(Model::DeleteDBClusterSnapshotRequest&& request, const DeleteDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> The DeleteDBInstance action deletes a previously provisioned DB instance. A
          * successful response from the web service indicates the request was received
@@ -1295,6 +1597,11 @@ namespace Model
          */
         virtual Model::DeleteDBInstanceOutcomeCallable DeleteDBInstanceCallable(const Model::DeleteDBInstanceRequest& request) const;
 
+        /**
+         * Same as DeleteDBInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDBInstanceOutcomeCallable DeleteDBInstanceCallable(Model::DeleteDBInstanceRequest&& request) const;
+
         /**
          * <p> The DeleteDBInstance action deletes a previously provisioned DB instance. A
          * successful response from the web service indicates the request was received
@@ -1312,6 +1619,11 @@ namespace Model
          */
         virtual void DeleteDBInstanceAsync(const Model::DeleteDBInstanceRequest& request, const DeleteDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDBInstanceAsync(Model::DeleteDBInstanceRequest&& request, const DeleteDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a specified DBParameterGroup. The DBParameterGroup to be deleted
          * cannot be associated with any DB instances. </p>
@@ -1326,6 +1638,11 @@ namespace Model
          */
         virtual Model::DeleteDBParameterGroupOutcomeCallable DeleteDBParameterGroupCallable(const Model::DeleteDBParameterGroupRequest& request) const;
 
+        /**
+         * Same as DeleteDBParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDBParameterGroupOutcomeCallable DeleteDBParameterGroupCallable(Model::DeleteDBParameterGroupRequest&& request) const;
+
         /**
          * <p> Deletes a specified DBParameterGroup. The DBParameterGroup to be deleted
          * cannot be associated with any DB instances. </p>
@@ -1334,6 +1651,11 @@ namespace Model
          */
         virtual void DeleteDBParameterGroupAsync(const Model::DeleteDBParameterGroupRequest& request, const DeleteDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDBParameterGroupAsync(Model::DeleteDBParameterGroupRequest&& request, const DeleteDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a DB security group. </p> <note>The specified DB security group must
          * not be associated with any DB instances.</note>
@@ -1348,6 +1670,11 @@ namespace Model
          */
         virtual Model::DeleteDBSecurityGroupOutcomeCallable DeleteDBSecurityGroupCallable(const Model::DeleteDBSecurityGroupRequest& request) const;
 
+        /**
+         * Same as DeleteDBSecurityGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDBSecurityGroupOutcomeCallable DeleteDBSecurityGroupCallable(Model::DeleteDBSecurityGroupRequest&& request) const;
+
         /**
          * <p> Deletes a DB security group. </p> <note>The specified DB security group must
          * not be associated with any DB instances.</note>
@@ -1356,6 +1683,11 @@ namespace Model
          */
         virtual void DeleteDBSecurityGroupAsync(const Model::DeleteDBSecurityGroupRequest& request, const DeleteDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBSecurityGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDBSecurityGroupAsync(Model::DeleteDBSecurityGroupRequest&& request, const DeleteDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a DBSnapshot. If the snapshot is being copied, the copy operation is
          * terminated. </p> <note>The DBSnapshot must be in the <code>available</code>
@@ -1372,6 +1704,11 @@ namespace Model
          */
         virtual Model::DeleteDBSnapshotOutcomeCallable DeleteDBSnapshotCallable(const Model::DeleteDBSnapshotRequest& request) const;
 
+        /**
+         * Same as DeleteDBSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDBSnapshotOutcomeCallable DeleteDBSnapshotCallable(Model::DeleteDBSnapshotRequest&& request) const;
+
         /**
          * <p> Deletes a DBSnapshot. If the snapshot is being copied, the copy operation is
          * terminated. </p> <note>The DBSnapshot must be in the <code>available</code>
@@ -1381,6 +1718,11 @@ namespace Model
          */
         virtual void DeleteDBSnapshotAsync(const Model::DeleteDBSnapshotRequest& request, const DeleteDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDBSnapshotAsync(Model::DeleteDBSnapshotRequest&& request, const DeleteDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a DB subnet group. </p> <note>The specified database subnet group
          * must not be associated with any DB instances.</note>
@@ -1395,6 +1737,11 @@ namespace Model
          */
         virtual Model::DeleteDBSubnetGroupOutcomeCallable DeleteDBSubnetGroupCallable(const Model::DeleteDBSubnetGroupRequest& request) const;
 
+        /**
+         * Same as DeleteDBSubnetGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDBSubnetGroupOutcomeCallable DeleteDBSubnetGroupCallable(Model::DeleteDBSubnetGroupRequest&& request) const;
+
         /**
          * <p> Deletes a DB subnet group. </p> <note>The specified database subnet group
          * must not be associated with any DB instances.</note>
@@ -1403,6 +1750,11 @@ namespace Model
          */
         virtual void DeleteDBSubnetGroupAsync(const Model::DeleteDBSubnetGroupRequest& request, const DeleteDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDBSubnetGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDBSubnetGroupAsync(Model::DeleteDBSubnetGroupRequest&& request, const DeleteDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes an RDS event notification subscription.</p>
          */
@@ -1415,6 +1767,11 @@ namespace Model
          */
         virtual Model::DeleteEventSubscriptionOutcomeCallable DeleteEventSubscriptionCallable(const Model::DeleteEventSubscriptionRequest& request) const;
 
+        /**
+         * Same as DeleteEventSubscriptionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteEventSubscriptionOutcomeCallable DeleteEventSubscriptionCallable(Model::DeleteEventSubscriptionRequest&& request) const;
+
         /**
          * <p>Deletes an RDS event notification subscription.</p>
          *
@@ -1422,6 +1779,11 @@ namespace Model
          */
         virtual void DeleteEventSubscriptionAsync(const Model::DeleteEventSubscriptionRequest& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteEventSubscriptionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteEventSubscriptionAsync(Model::DeleteEventSubscriptionRequest&& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes an existing option group. </p>
          */
@@ -1434,6 +1796,11 @@ namespace Model
          */
         virtual Model::DeleteOptionGroupOutcomeCallable DeleteOptionGroupCallable(const Model::DeleteOptionGroupRequest& request) const;
 
+        /**
+         * Same as DeleteOptionGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteOptionGroupOutcomeCallable DeleteOptionGroupCallable(Model::DeleteOptionGroupRequest&& request) const;
+
         /**
          * <p> Deletes an existing option group. </p>
          *
@@ -1441,6 +1808,11 @@ namespace Model
          */
         virtual void DeleteOptionGroupAsync(const Model::DeleteOptionGroupRequest& request, const DeleteOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteOptionGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteOptionGroupAsync(Model::DeleteOptionGroupRequest&& request, const DeleteOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all of the attributes for a customer account. The attributes include
          * Amazon RDS quotas for the account, such as the number of DB instances allowed.
@@ -1461,6 +1833,11 @@ namespace Model
          */
         virtual Model::DescribeAccountAttributesOutcomeCallable DescribeAccountAttributesCallable(const Model::DescribeAccountAttributesRequest& request) const;
 
+        /**
+         * Same as DescribeAccountAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAccountAttributesOutcomeCallable DescribeAccountAttributesCallable(Model::DescribeAccountAttributesRequest&& request) const;
+
         /**
          * <p>Lists all of the attributes for a customer account. The attributes include
          * Amazon RDS quotas for the account, such as the number of DB instances allowed.
@@ -1472,6 +1849,11 @@ namespace Model
          */
         virtual void DescribeAccountAttributesAsync(const Model::DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAccountAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAccountAttributesAsync(Model::DescribeAccountAttributesRequest&& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Lists the set of CA certificates provided by Amazon RDS for this AWS
          * account. </p>
@@ -1486,6 +1868,11 @@ namespace Model
          */
         virtual Model::DescribeCertificatesOutcomeCallable DescribeCertificatesCallable(const Model::DescribeCertificatesRequest& request) const;
 
+        /**
+         * Same as DescribeCertificatesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCertificatesOutcomeCallable DescribeCertificatesCallable(Model::DescribeCertificatesRequest&& request) const;
+
         /**
          * <p> Lists the set of CA certificates provided by Amazon RDS for this AWS
          * account. </p>
@@ -1494,6 +1881,11 @@ namespace Model
          */
         virtual void DescribeCertificatesAsync(const Model::DescribeCertificatesRequest& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCertificatesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCertificatesAsync(Model::DescribeCertificatesRequest&& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of <code>DBClusterParameterGroup</code> descriptions. If a
          * <code>DBClusterParameterGroupName</code> parameter is specified, the list will
@@ -1516,6 +1908,11 @@ namespace Model
          */
         virtual Model::DescribeDBClusterParameterGroupsOutcomeCallable DescribeDBClusterParameterGroupsCallable(const Model::DescribeDBClusterParameterGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeDBClusterParameterGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDBClusterParameterGroupsOutcomeCallable DescribeDBClusterParameterGroupsCallable(Model::DescribeDBClusterParameterGroupsRequest&& request) const;
+
         /**
          * <p> Returns a list of <code>DBClusterParameterGroup</code> descriptions. If a
          * <code>DBClusterParameterGroupName</code> parameter is specified, the list will
@@ -1528,6 +1925,11 @@ namespace Model
          */
         virtual void DescribeDBClusterParameterGroupsAsync(const Model::DescribeDBClusterParameterGroupsRequest& request, const DescribeDBClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBClusterParameterGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDBClusterParameterGroupsAsync(Model::DescribeDBClusterParameterGroupsRequest&& request, const DescribeDBClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns the detailed parameter list for a particular DB cluster parameter
          * group. </p> <p>For more information on Amazon Aurora, see <a
@@ -1546,6 +1948,11 @@ namespace Model
          */
         virtual Model::DescribeDBClusterParametersOutcomeCallable DescribeDBClusterParametersCallable(const Model::DescribeDBClusterParametersRequest& request) const;
 
+        /**
+         * Same as DescribeDBClusterParametersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDBClusterParametersOutcomeCallable DescribeDBClusterParametersCallable(Model::DescribeDBClusterParametersRequest&& request) const;
+
         /**
          * <p> Returns the detailed parameter list for a particular DB cluster parameter
          * group. </p> <p>For more information on Amazon Aurora, see <a
@@ -1556,6 +1963,11 @@ namespace Model
          */
         virtual void DescribeDBClusterParametersAsync(const Model::DescribeDBClusterParametersRequest& request, const DescribeDBClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBClusterParametersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDBClusterParametersAsync(Model::DescribeDBClusterParametersRequest&& request, const DescribeDBClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about DB cluster snapshots. This API supports pagination.
          * </p> <p>For more information on Amazon Aurora, see <a
@@ -1574,6 +1986,11 @@ namespace Model
          */
         virtual Model::DescribeDBClusterSnapshotsOutcomeCallable DescribeDBClusterSnapshotsCallable(const Model::DescribeDBClusterSnapshotsRequest& request) const;
 
+        /**
+         * Same as DescribeDBClusterSnapshotsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDBClusterSnapshotsOutcomeCallable DescribeDBClusterSnapshotsCallable(Model::DescribeDBClusterSnapshotsRequest&& request) const;
+
         /**
          * <p>Returns information about DB cluster snapshots. This API supports pagination.
          * </p> <p>For more information on Amazon Aurora, see <a
@@ -1584,6 +2001,11 @@ namespace Model
          */
         virtual void DescribeDBClusterSnapshotsAsync(const Model::DescribeDBClusterSnapshotsRequest& request, const DescribeDBClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBClusterSnapshotsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDBClusterSnapshotsAsync(Model::DescribeDBClusterSnapshotsRequest&& request, const DescribeDBClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about provisioned Aurora DB clusters. This API supports
          * pagination. </p> <p>For more information on Amazon Aurora, see <a
@@ -1602,6 +2024,11 @@ namespace Model
          */
         virtual Model::DescribeDBClustersOutcomeCallable DescribeDBClustersCallable(const Model::DescribeDBClustersRequest& request) const;
 
+        /**
+         * Same as DescribeDBClustersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDBClustersOutcomeCallable DescribeDBClustersCallable(Model::DescribeDBClustersRequest&& request) const;
+
         /**
          * <p>Returns information about provisioned Aurora DB clusters. This API supports
          * pagination. </p> <p>For more information on Amazon Aurora, see <a
@@ -1612,6 +2039,11 @@ namespace Model
          */
         virtual void DescribeDBClustersAsync(const Model::DescribeDBClustersRequest& request, const DescribeDBClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBClustersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDBClustersAsync(Model::DescribeDBClustersRequest&& request, const DescribeDBClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of the available DB engines. </p>
          */
@@ -1624,6 +2056,11 @@ namespace Model
          */
         virtual Model::DescribeDBEngineVersionsOutcomeCallable DescribeDBEngineVersionsCallable(const Model::DescribeDBEngineVersionsRequest& request) const;
 
+        /**
+         * Same as DescribeDBEngineVersionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDBEngineVersionsOutcomeCallable DescribeDBEngineVersionsCallable(Model::DescribeDBEngineVersionsRequest&& request) const;
+
         /**
          * <p> Returns a list of the available DB engines. </p>
          *
@@ -1631,6 +2068,11 @@ namespace Model
          */
         virtual void DescribeDBEngineVersionsAsync(const Model::DescribeDBEngineVersionsRequest& request, const DescribeDBEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBEngineVersionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDBEngineVersionsAsync(Model::DescribeDBEngineVersionsRequest&& request, const DescribeDBEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns information about provisioned RDS instances. This API supports
          * pagination. </p>
@@ -1645,6 +2087,11 @@ namespace Model
          */
         virtual Model::DescribeDBInstancesOutcomeCallable DescribeDBInstancesCallable(const Model::DescribeDBInstancesRequest& request) const;
 
+        /**
+         * Same as DescribeDBInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDBInstancesOutcomeCallable DescribeDBInstancesCallable(Model::DescribeDBInstancesRequest&& request) const;
+
         /**
          * <p> Returns information about provisioned RDS instances. This API supports
          * pagination. </p>
@@ -1653,6 +2100,11 @@ namespace Model
          */
         virtual void DescribeDBInstancesAsync(const Model::DescribeDBInstancesRequest& request, const DescribeDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDBInstancesAsync(Model::DescribeDBInstancesRequest&& request, const DescribeDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of DB log files for the DB instance. </p>
          */
@@ -1665,6 +2117,11 @@ namespace Model
          */
         virtual Model::DescribeDBLogFilesOutcomeCallable DescribeDBLogFilesCallable(const Model::DescribeDBLogFilesRequest& request) const;
 
+        /**
+         * Same as DescribeDBLogFilesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDBLogFilesOutcomeCallable DescribeDBLogFilesCallable(Model::DescribeDBLogFilesRequest&& request) const;
+
         /**
          * <p> Returns a list of DB log files for the DB instance. </p>
          *
@@ -1672,6 +2129,11 @@ namespace Model
          */
         virtual void DescribeDBLogFilesAsync(const Model::DescribeDBLogFilesRequest& request, const DescribeDBLogFilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBLogFilesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDBLogFilesAsync(Model::DescribeDBLogFilesRequest&& request, const DescribeDBLogFilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of <code>DBParameterGroup</code> descriptions. If a
          * <code>DBParameterGroupName</code> is specified, the list will contain only the
@@ -1688,6 +2150,11 @@ namespace Model
          */
         virtual Model::DescribeDBParameterGroupsOutcomeCallable DescribeDBParameterGroupsCallable(const Model::DescribeDBParameterGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeDBParameterGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDBParameterGroupsOutcomeCallable DescribeDBParameterGroupsCallable(Model::DescribeDBParameterGroupsRequest&& request) const;
+
         /**
          * <p> Returns a list of <code>DBParameterGroup</code> descriptions. If a
          * <code>DBParameterGroupName</code> is specified, the list will contain only the
@@ -1697,6 +2164,11 @@ namespace Model
          */
         virtual void DescribeDBParameterGroupsAsync(const Model::DescribeDBParameterGroupsRequest& request, const DescribeDBParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBParameterGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDBParameterGroupsAsync(Model::DescribeDBParameterGroupsRequest&& request, const DescribeDBParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns the detailed parameter list for a particular DB parameter group.
          * </p>
@@ -1711,6 +2183,11 @@ namespace Model
          */
         virtual Model::DescribeDBParametersOutcomeCallable DescribeDBParametersCallable(const Model::DescribeDBParametersRequest& request) const;
 
+        /**
+         * Same as DescribeDBParametersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDBParametersOutcomeCallable DescribeDBParametersCallable(Model::DescribeDBParametersRequest&& request) const;
+
         /**
          * <p> Returns the detailed parameter list for a particular DB parameter group.
          * </p>
@@ -1719,6 +2196,11 @@ namespace Model
          */
         virtual void DescribeDBParametersAsync(const Model::DescribeDBParametersRequest& request, const DescribeDBParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBParametersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDBParametersAsync(Model::DescribeDBParametersRequest&& request, const DescribeDBParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of <code>DBSecurityGroup</code> descriptions. If a
          * <code>DBSecurityGroupName</code> is specified, the list will contain only the
@@ -1735,6 +2217,11 @@ namespace Model
          */
         virtual Model::DescribeDBSecurityGroupsOutcomeCallable DescribeDBSecurityGroupsCallable(const Model::DescribeDBSecurityGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeDBSecurityGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDBSecurityGroupsOutcomeCallable DescribeDBSecurityGroupsCallable(Model::DescribeDBSecurityGroupsRequest&& request) const;
+
         /**
          * <p> Returns a list of <code>DBSecurityGroup</code> descriptions. If a
          * <code>DBSecurityGroupName</code> is specified, the list will contain only the
@@ -1744,6 +2231,11 @@ namespace Model
          */
         virtual void DescribeDBSecurityGroupsAsync(const Model::DescribeDBSecurityGroupsRequest& request, const DescribeDBSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBSecurityGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDBSecurityGroupsAsync(Model::DescribeDBSecurityGroupsRequest&& request, const DescribeDBSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of DB snapshot attribute names and values for a manual DB
          * snapshot.</p> <p>When sharing snapshots with other AWS accounts,
@@ -1774,6 +2266,11 @@ namespace Model
          */
         virtual Model::DescribeDBSnapshotAttributesOutcomeCallable DescribeDBSnapshotAttributesCallable(const Model::DescribeDBSnapshotAttributesRequest& request) const;
 
+        /**
+         * Same as DescribeDBSnapshotAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDBSnapshotAttributesOutcomeCallable DescribeDBSnapshotAttributesCallable(Model::DescribeDBSnapshotAttributesRequest&& request) const;
+
         /**
          * <p>Returns a list of DB snapshot attribute names and values for a manual DB
          * snapshot.</p> <p>When sharing snapshots with other AWS accounts,
@@ -1790,6 +2287,11 @@ namespace Model
          */
         virtual void DescribeDBSnapshotAttributesAsync(const Model::DescribeDBSnapshotAttributesRequest& request, const DescribeDBSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBSnapshotAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDBSnapshotAttributesAsync(Model::DescribeDBSnapshotAttributesRequest&& request, const DescribeDBSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns information about DB snapshots. This API supports pagination. </p>
          */
@@ -1802,6 +2304,11 @@ namespace Model
          */
         virtual Model::DescribeDBSnapshotsOutcomeCallable DescribeDBSnapshotsCallable(const Model::DescribeDBSnapshotsRequest& request) const;
 
+        /**
+         * Same as DescribeDBSnapshotsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDBSnapshotsOutcomeCallable DescribeDBSnapshotsCallable(Model::DescribeDBSnapshotsRequest&& request) const;
+
         /**
          * <p> Returns information about DB snapshots. This API supports pagination. </p>
          *
@@ -1809,6 +2316,11 @@ namespace Model
          */
         virtual void DescribeDBSnapshotsAsync(const Model::DescribeDBSnapshotsRequest& request, const DescribeDBSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBSnapshotsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDBSnapshotsAsync(Model::DescribeDBSnapshotsRequest&& request, const DescribeDBSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of DBSubnetGroup descriptions. If a DBSubnetGroupName is
          * specified, the list will contain only the descriptions of the specified
@@ -1829,6 +2341,11 @@ namespace Model
          */
         virtual Model::DescribeDBSubnetGroupsOutcomeCallable DescribeDBSubnetGroupsCallable(const Model::DescribeDBSubnetGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeDBSubnetGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDBSubnetGroupsOutcomeCallable DescribeDBSubnetGroupsCallable(Model::DescribeDBSubnetGroupsRequest&& request) const;
+
         /**
          * <p> Returns a list of DBSubnetGroup descriptions. If a DBSubnetGroupName is
          * specified, the list will contain only the descriptions of the specified
@@ -1840,6 +2357,11 @@ namespace Model
          */
         virtual void DescribeDBSubnetGroupsAsync(const Model::DescribeDBSubnetGroupsRequest& request, const DescribeDBSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDBSubnetGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDBSubnetGroupsAsync(Model::DescribeDBSubnetGroupsRequest&& request, const DescribeDBSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns the default engine and system parameter information for the cluster
          * database engine. </p> <p>For more information on Amazon Aurora, see <a
@@ -1858,6 +2380,11 @@ namespace Model
          */
         virtual Model::DescribeEngineDefaultClusterParametersOutcomeCallable DescribeEngineDefaultClusterParametersCallable(const Model::DescribeEngineDefaultClusterParametersRequest& request) const;
 
+        /**
+         * Same as DescribeEngineDefaultClusterParametersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEngineDefaultClusterParametersOutcomeCallable DescribeEngineDefaultClusterParametersCallable(Model::DescribeEngineDefaultClusterParametersRequest&& request) const;
+
         /**
          * <p> Returns the default engine and system parameter information for the cluster
          * database engine. </p> <p>For more information on Amazon Aurora, see <a
@@ -1868,6 +2395,11 @@ namespace Model
          */
         virtual void DescribeEngineDefaultClusterParametersAsync(const Model::DescribeEngineDefaultClusterParametersRequest& request, const DescribeEngineDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEngineDefaultClusterParametersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEngineDefaultClusterParametersAsync(Model::DescribeEngineDefaultClusterParametersRequest&& request, const DescribeEngineDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns the default engine and system parameter information for the
          * specified database engine. </p>
@@ -1882,6 +2414,11 @@ namespace Model
          */
         virtual Model::DescribeEngineDefaultParametersOutcomeCallable DescribeEngineDefaultParametersCallable(const Model::DescribeEngineDefaultParametersRequest& request) const;
 
+        /**
+         * Same as DescribeEngineDefaultParametersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEngineDefaultParametersOutcomeCallable DescribeEngineDefaultParametersCallable(Model::DescribeEngineDefaultParametersRequest&& request) const;
+
         /**
          * <p> Returns the default engine and system parameter information for the
          * specified database engine. </p>
@@ -1890,6 +2427,11 @@ namespace Model
          */
         virtual void DescribeEngineDefaultParametersAsync(const Model::DescribeEngineDefaultParametersRequest& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEngineDefaultParametersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEngineDefaultParametersAsync(Model::DescribeEngineDefaultParametersRequest&& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Displays a list of categories for all event source types, or, if specified,
          * for a specified source type. You can see a list of the event categories and
@@ -1910,6 +2452,11 @@ namespace Model
          */
         virtual Model::DescribeEventCategoriesOutcomeCallable DescribeEventCategoriesCallable(const Model::DescribeEventCategoriesRequest& request) const;
 
+        /**
+         * Same as DescribeEventCategoriesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEventCategoriesOutcomeCallable DescribeEventCategoriesCallable(Model::DescribeEventCategoriesRequest&& request) const;
+
         /**
          * <p>Displays a list of categories for all event source types, or, if specified,
          * for a specified source type. You can see a list of the event categories and
@@ -1921,6 +2468,11 @@ namespace Model
          */
         virtual void DescribeEventCategoriesAsync(const Model::DescribeEventCategoriesRequest& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventCategoriesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEventCategoriesAsync(Model::DescribeEventCategoriesRequest&& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists all the subscription descriptions for a customer account. The
          * description for a subscription includes SubscriptionName, SNSTopicARN,
@@ -1939,6 +2491,11 @@ namespace Model
          */
         virtual Model::DescribeEventSubscriptionsOutcomeCallable DescribeEventSubscriptionsCallable(const Model::DescribeEventSubscriptionsRequest& request) const;
 
+        /**
+         * Same as DescribeEventSubscriptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEventSubscriptionsOutcomeCallable DescribeEventSubscriptionsCallable(Model::DescribeEventSubscriptionsRequest&& request) const;
+
         /**
          * <p>Lists all the subscription descriptions for a customer account. The
          * description for a subscription includes SubscriptionName, SNSTopicARN,
@@ -1949,6 +2506,11 @@ namespace Model
          */
         virtual void DescribeEventSubscriptionsAsync(const Model::DescribeEventSubscriptionsRequest& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventSubscriptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEventSubscriptionsAsync(Model::DescribeEventSubscriptionsRequest&& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns events related to DB instances, DB security groups, DB snapshots,
          * and DB parameter groups for the past 14 days. Events specific to a particular DB
@@ -1969,6 +2531,11 @@ namespace Model
          */
         virtual Model::DescribeEventsOutcomeCallable DescribeEventsCallable(const Model::DescribeEventsRequest& request) const;
 
+        /**
+         * Same as DescribeEventsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEventsOutcomeCallable DescribeEventsCallable(Model::DescribeEventsRequest&& request) const;
+
         /**
          * <p> Returns events related to DB instances, DB security groups, DB snapshots,
          * and DB parameter groups for the past 14 days. Events specific to a particular DB
@@ -1980,6 +2547,11 @@ namespace Model
          */
         virtual void DescribeEventsAsync(const Model::DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEventsAsync(Model::DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Describes all available options. </p>
          */
@@ -1992,6 +2564,11 @@ namespace Model
          */
         virtual Model::DescribeOptionGroupOptionsOutcomeCallable DescribeOptionGroupOptionsCallable(const Model::DescribeOptionGroupOptionsRequest& request) const;
 
+        /**
+         * Same as DescribeOptionGroupOptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeOptionGroupOptionsOutcomeCallable DescribeOptionGroupOptionsCallable(Model::DescribeOptionGroupOptionsRequest&& request) const;
+
         /**
          * <p> Describes all available options. </p>
          *
@@ -1999,6 +2576,11 @@ namespace Model
          */
         virtual void DescribeOptionGroupOptionsAsync(const Model::DescribeOptionGroupOptionsRequest& request, const DescribeOptionGroupOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeOptionGroupOptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeOptionGroupOptionsAsync(Model::DescribeOptionGroupOptionsRequest&& request, const DescribeOptionGroupOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Describes the available option groups. </p>
          */
@@ -2011,6 +2593,11 @@ namespace Model
          */
         virtual Model::DescribeOptionGroupsOutcomeCallable DescribeOptionGroupsCallable(const Model::DescribeOptionGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeOptionGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeOptionGroupsOutcomeCallable DescribeOptionGroupsCallable(Model::DescribeOptionGroupsRequest&& request) const;
+
         /**
          * <p> Describes the available option groups. </p>
          *
@@ -2018,6 +2605,11 @@ namespace Model
          */
         virtual void DescribeOptionGroupsAsync(const Model::DescribeOptionGroupsRequest& request, const DescribeOptionGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeOptionGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeOptionGroupsAsync(Model::DescribeOptionGroupsRequest&& request, const DescribeOptionGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of orderable DB instance options for the specified engine.
          * </p>
@@ -2032,6 +2624,11 @@ namespace Model
          */
         virtual Model::DescribeOrderableDBInstanceOptionsOutcomeCallable DescribeOrderableDBInstanceOptionsCallable(const Model::DescribeOrderableDBInstanceOptionsRequest& request) const;
 
+        /**
+         * Same as DescribeOrderableDBInstanceOptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeOrderableDBInstanceOptionsOutcomeCallable DescribeOrderableDBInstanceOptionsCallable(Model::DescribeOrderableDBInstanceOptionsRequest&& request) const;
+
         /**
          * <p> Returns a list of orderable DB instance options for the specified engine.
          * </p>
@@ -2040,6 +2637,11 @@ namespace Model
          */
         virtual void DescribeOrderableDBInstanceOptionsAsync(const Model::DescribeOrderableDBInstanceOptionsRequest& request, const DescribeOrderableDBInstanceOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeOrderableDBInstanceOptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeOrderableDBInstanceOptionsAsync(Model::DescribeOrderableDBInstanceOptionsRequest&& request, const DescribeOrderableDBInstanceOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of resources (for example, DB instances) that have at least
          * one pending maintenance action.</p>
@@ -2054,6 +2656,11 @@ namespace Model
          */
         virtual Model::DescribePendingMaintenanceActionsOutcomeCallable DescribePendingMaintenanceActionsCallable(const Model::DescribePendingMaintenanceActionsRequest& request) const;
 
+        /**
+         * Same as DescribePendingMaintenanceActionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribePendingMaintenanceActionsOutcomeCallable DescribePendingMaintenanceActionsCallable(Model::DescribePendingMaintenanceActionsRequest&& request) const;
+
         /**
          * <p>Returns a list of resources (for example, DB instances) that have at least
          * one pending maintenance action.</p>
@@ -2062,6 +2669,11 @@ namespace Model
          */
         virtual void DescribePendingMaintenanceActionsAsync(const Model::DescribePendingMaintenanceActionsRequest& request, const DescribePendingMaintenanceActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribePendingMaintenanceActionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribePendingMaintenanceActionsAsync(Model::DescribePendingMaintenanceActionsRequest&& request, const DescribePendingMaintenanceActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns information about reserved DB instances for this account, or about a
          * specified reserved DB instance. </p>
@@ -2076,6 +2688,11 @@ namespace Model
          */
         virtual Model::DescribeReservedDBInstancesOutcomeCallable DescribeReservedDBInstancesCallable(const Model::DescribeReservedDBInstancesRequest& request) const;
 
+        /**
+         * Same as DescribeReservedDBInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeReservedDBInstancesOutcomeCallable DescribeReservedDBInstancesCallable(Model::DescribeReservedDBInstancesRequest&& request) const;
+
         /**
          * <p> Returns information about reserved DB instances for this account, or about a
          * specified reserved DB instance. </p>
@@ -2084,6 +2701,11 @@ namespace Model
          */
         virtual void DescribeReservedDBInstancesAsync(const Model::DescribeReservedDBInstancesRequest& request, const DescribeReservedDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedDBInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeReservedDBInstancesAsync(Model::DescribeReservedDBInstancesRequest&& request, const DescribeReservedDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Lists available reserved DB instance offerings. </p>
          */
@@ -2096,6 +2718,11 @@ namespace Model
          */
         virtual Model::DescribeReservedDBInstancesOfferingsOutcomeCallable DescribeReservedDBInstancesOfferingsCallable(const Model::DescribeReservedDBInstancesOfferingsRequest& request) const;
 
+        /**
+         * Same as DescribeReservedDBInstancesOfferingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeReservedDBInstancesOfferingsOutcomeCallable DescribeReservedDBInstancesOfferingsCallable(Model::DescribeReservedDBInstancesOfferingsRequest&& request) const;
+
         /**
          * <p> Lists available reserved DB instance offerings. </p>
          *
@@ -2103,6 +2730,11 @@ namespace Model
          */
         virtual void DescribeReservedDBInstancesOfferingsAsync(const Model::DescribeReservedDBInstancesOfferingsRequest& request, const DescribeReservedDBInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedDBInstancesOfferingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeReservedDBInstancesOfferingsAsync(Model::DescribeReservedDBInstancesOfferingsRequest&& request, const DescribeReservedDBInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Downloads all or a portion of the specified log file, up to 1 MB in size.
          * </p>
@@ -2117,6 +2749,11 @@ namespace Model
          */
         virtual Model::DownloadDBLogFilePortionOutcomeCallable DownloadDBLogFilePortionCallable(const Model::DownloadDBLogFilePortionRequest& request) const;
 
+        /**
+         * Same as DownloadDBLogFilePortionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DownloadDBLogFilePortionOutcomeCallable DownloadDBLogFilePortionCallable(Model::DownloadDBLogFilePortionRequest&& request) const;
+
         /**
          * <p> Downloads all or a portion of the specified log file, up to 1 MB in size.
          * </p>
@@ -2125,6 +2762,11 @@ namespace Model
          */
         virtual void DownloadDBLogFilePortionAsync(const Model::DownloadDBLogFilePortionRequest& request, const DownloadDBLogFilePortionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DownloadDBLogFilePortionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DownloadDBLogFilePortionAsync(Model::DownloadDBLogFilePortionRequest&& request, const DownloadDBLogFilePortionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Forces a failover for a DB cluster.</p> <p>A failover for a DB cluster
          * promotes one of the read-only instances in the DB cluster to the master DB
@@ -2157,6 +2799,11 @@ namespace Model
          */
         virtual Model::FailoverDBClusterOutcomeCallable FailoverDBClusterCallable(const Model::FailoverDBClusterRequest& request) const;
 
+        /**
+         * Same as FailoverDBClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::FailoverDBClusterOutcomeCallable FailoverDBClusterCallable(Model::FailoverDBClusterRequest&& request) const;
+
         /**
          * <p>Forces a failover for a DB cluster.</p> <p>A failover for a DB cluster
          * promotes one of the read-only instances in the DB cluster to the master DB
@@ -2174,6 +2821,11 @@ namespace Model
          */
         virtual void FailoverDBClusterAsync(const Model::FailoverDBClusterRequest& request, const FailoverDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as FailoverDBClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void FailoverDBClusterAsync(Model::FailoverDBClusterRequest&& request, const FailoverDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Lists all tags on an Amazon RDS resource.</p> <p>For an overview on tagging
          * an Amazon RDS resource, see <a
@@ -2192,6 +2844,11 @@ namespace Model
          */
         virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(const Model::ListTagsForResourceRequest& request) const;
 
+        /**
+         * Same as ListTagsForResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(Model::ListTagsForResourceRequest&& request) const;
+
         /**
          * <p> Lists all tags on an Amazon RDS resource.</p> <p>For an overview on tagging
          * an Amazon RDS resource, see <a
@@ -2202,6 +2859,11 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTagsForResourceAsync(Model::ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modify a setting for an Amazon Aurora DB cluster. You can change one or more
          * database configuration parameters by specifying these parameters and the new
@@ -2222,6 +2884,11 @@ namespace Model
          */
         virtual Model::ModifyDBClusterOutcomeCallable ModifyDBClusterCallable(const Model::ModifyDBClusterRequest& request) const;
 
+        /**
+         * Same as ModifyDBClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyDBClusterOutcomeCallable ModifyDBClusterCallable(Model::ModifyDBClusterRequest&& request) const;
+
         /**
          * <p>Modify a setting for an Amazon Aurora DB cluster. You can change one or more
          * database configuration parameters by specifying these parameters and the new
@@ -2233,6 +2900,11 @@ namespace Model
          */
         virtual void ModifyDBClusterAsync(const Model::ModifyDBClusterRequest& request, const ModifyDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyDBClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyDBClusterAsync(Model::ModifyDBClusterRequest&& request, const ModifyDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies the parameters of a DB cluster parameter group. To modify more than
          * one parameter, submit a list of the following: <code>ParameterName</code>,
@@ -2285,6 +2957,11 @@ namespace Model
          */
         virtual Model::ModifyDBClusterParameterGroupOutcomeCallable ModifyDBClusterParameterGroupCallable(const Model::ModifyDBClusterParameterGroupRequest& request) const;
 
+        /**
+         * Same as ModifyDBClusterParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyDBClusterParameterGroupOutcomeCallable ModifyDBClusterParameterGroupCallable(Model::ModifyDBClusterParameterGroupRequest&& request) const;
+
         /**
          * <p> Modifies the parameters of a DB cluster parameter group. To modify more than
          * one parameter, submit a list of the following: <code>ParameterName</code>,
@@ -2312,6 +2989,11 @@ namespace Model
          */
         virtual void ModifyDBClusterParameterGroupAsync(const Model::ModifyDBClusterParameterGroupRequest& request, const ModifyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyDBClusterParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyDBClusterParameterGroupAsync(Model::ModifyDBClusterParameterGroupRequest&& request, const ModifyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modify settings for a DB instance. You can change one or more database
          * configuration parameters by specifying these parameters and the new values in
@@ -2328,6 +3010,11 @@ namespace Model
          */
         virtual Model::ModifyDBInstanceOutcomeCallable ModifyDBInstanceCallable(const Model::ModifyDBInstanceRequest& request) const;
 
+        /**
+         * Same as ModifyDBInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyDBInstanceOutcomeCallable ModifyDBInstanceCallable(Model::ModifyDBInstanceRequest&& request) const;
+
         /**
          * <p> Modify settings for a DB instance. You can change one or more database
          * configuration parameters by specifying these parameters and the new values in
@@ -2337,6 +3024,11 @@ namespace Model
          */
         virtual void ModifyDBInstanceAsync(const Model::ModifyDBInstanceRequest& request, const ModifyDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyDBInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyDBInstanceAsync(Model::ModifyDBInstanceRequest&& request, const ModifyDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies the parameters of a DB parameter group. To modify more than one
          * parameter, submit a list of the following: <code>ParameterName</code>,
@@ -2381,6 +3073,11 @@ namespace Model
          */
         virtual Model::ModifyDBParameterGroupOutcomeCallable ModifyDBParameterGroupCallable(const Model::ModifyDBParameterGroupRequest& request) const;
 
+        /**
+         * Same as ModifyDBParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyDBParameterGroupOutcomeCallable ModifyDBParameterGroupCallable(Model::ModifyDBParameterGroupRequest&& request) const;
+
         /**
          * <p> Modifies the parameters of a DB parameter group. To modify more than one
          * parameter, submit a list of the following: <code>ParameterName</code>,
@@ -2404,6 +3101,11 @@ namespace Model
          */
         virtual void ModifyDBParameterGroupAsync(const Model::ModifyDBParameterGroupRequest& request, const ModifyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyDBParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyDBParameterGroupAsync(Model::ModifyDBParameterGroupRequest&& request, const ModifyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds an attribute and values to, or removes an attribute and values from a
          * manual DB snapshot.</p> <p>To share a manual DB snapshot with other AWS
@@ -2438,6 +3140,11 @@ namespace Model
          */
         virtual Model::ModifyDBSnapshotAttributeOutcomeCallable ModifyDBSnapshotAttributeCallable(const Model::ModifyDBSnapshotAttributeRequest& request) const;
 
+        /**
+         * Same as ModifyDBSnapshotAttributeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyDBSnapshotAttributeOutcomeCallable ModifyDBSnapshotAttributeCallable(Model::ModifyDBSnapshotAttributeRequest&& request) const;
+
         /**
          * <p>Adds an attribute and values to, or removes an attribute and values from a
          * manual DB snapshot.</p> <p>To share a manual DB snapshot with other AWS
@@ -2456,6 +3163,11 @@ namespace Model
          */
         virtual void ModifyDBSnapshotAttributeAsync(const Model::ModifyDBSnapshotAttributeRequest& request, const ModifyDBSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyDBSnapshotAttributeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyDBSnapshotAttributeAsync(Model::ModifyDBSnapshotAttributeRequest&& request, const ModifyDBSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies an existing DB subnet group. DB subnet groups must contain at least
          * one subnet in at least two AZs in the region. </p>
@@ -2470,6 +3182,11 @@ namespace Model
          */
         virtual Model::ModifyDBSubnetGroupOutcomeCallable ModifyDBSubnetGroupCallable(const Model::ModifyDBSubnetGroupRequest& request) const;
 
+        /**
+         * Same as ModifyDBSubnetGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyDBSubnetGroupOutcomeCallable ModifyDBSubnetGroupCallable(Model::ModifyDBSubnetGroupRequest&& request) const;
+
         /**
          * <p> Modifies an existing DB subnet group. DB subnet groups must contain at least
          * one subnet in at least two AZs in the region. </p>
@@ -2478,6 +3195,11 @@ namespace Model
          */
         virtual void ModifyDBSubnetGroupAsync(const Model::ModifyDBSubnetGroupRequest& request, const ModifyDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyDBSubnetGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyDBSubnetGroupAsync(Model::ModifyDBSubnetGroupRequest&& request, const ModifyDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Modifies an existing RDS event notification subscription. Note that you
          * cannot modify the source identifiers using this call; to change source
@@ -2504,6 +3226,11 @@ namespace Model
          */
         virtual Model::ModifyEventSubscriptionOutcomeCallable ModifyEventSubscriptionCallable(const Model::ModifyEventSubscriptionRequest& request) const;
 
+        /**
+         * Same as ModifyEventSubscriptionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyEventSubscriptionOutcomeCallable ModifyEventSubscriptionCallable(Model::ModifyEventSubscriptionRequest&& request) const;
+
         /**
          * <p>Modifies an existing RDS event notification subscription. Note that you
          * cannot modify the source identifiers using this call; to change source
@@ -2518,6 +3245,11 @@ namespace Model
          */
         virtual void ModifyEventSubscriptionAsync(const Model::ModifyEventSubscriptionRequest& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyEventSubscriptionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyEventSubscriptionAsync(Model::ModifyEventSubscriptionRequest&& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies an existing option group. </p>
          */
@@ -2530,6 +3262,11 @@ namespace Model
          */
         virtual Model::ModifyOptionGroupOutcomeCallable ModifyOptionGroupCallable(const Model::ModifyOptionGroupRequest& request) const;
 
+        /**
+         * Same as ModifyOptionGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyOptionGroupOutcomeCallable ModifyOptionGroupCallable(Model::ModifyOptionGroupRequest&& request) const;
+
         /**
          * <p> Modifies an existing option group. </p>
          *
@@ -2537,6 +3274,11 @@ namespace Model
          */
         virtual void ModifyOptionGroupAsync(const Model::ModifyOptionGroupRequest& request, const ModifyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyOptionGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyOptionGroupAsync(Model::ModifyOptionGroupRequest&& request, const ModifyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Promotes a Read Replica DB instance to a standalone DB instance. </p> <note>
          * <p>We recommend that you enable automated backups on your Read Replica before
@@ -2557,6 +3299,11 @@ namespace Model
          */
         virtual Model::PromoteReadReplicaOutcomeCallable PromoteReadReplicaCallable(const Model::PromoteReadReplicaRequest& request) const;
 
+        /**
+         * Same as PromoteReadReplicaCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PromoteReadReplicaOutcomeCallable PromoteReadReplicaCallable(Model::PromoteReadReplicaRequest&& request) const;
+
         /**
          * <p> Promotes a Read Replica DB instance to a standalone DB instance. </p> <note>
          * <p>We recommend that you enable automated backups on your Read Replica before
@@ -2568,6 +3315,11 @@ namespace Model
          */
         virtual void PromoteReadReplicaAsync(const Model::PromoteReadReplicaRequest& request, const PromoteReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PromoteReadReplicaAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PromoteReadReplicaAsync(Model::PromoteReadReplicaRequest&& request, const PromoteReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Purchases a reserved DB instance offering. </p>
          */
@@ -2580,6 +3332,11 @@ namespace Model
          */
         virtual Model::PurchaseReservedDBInstancesOfferingOutcomeCallable PurchaseReservedDBInstancesOfferingCallable(const Model::PurchaseReservedDBInstancesOfferingRequest& request) const;
 
+        /**
+         * Same as PurchaseReservedDBInstancesOfferingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PurchaseReservedDBInstancesOfferingOutcomeCallable PurchaseReservedDBInstancesOfferingCallable(Model::PurchaseReservedDBInstancesOfferingRequest&& request) const;
+
         /**
          * <p> Purchases a reserved DB instance offering. </p>
          *
@@ -2587,6 +3344,11 @@ namespace Model
          */
         virtual void PurchaseReservedDBInstancesOfferingAsync(const Model::PurchaseReservedDBInstancesOfferingRequest& request, const PurchaseReservedDBInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PurchaseReservedDBInstancesOfferingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PurchaseReservedDBInstancesOfferingAsync(Model::PurchaseReservedDBInstancesOfferingRequest&& request, const PurchaseReservedDBInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Rebooting a DB instance restarts the database engine service. A reboot also
          * applies to the DB instance any modifications to the associated DB parameter
@@ -2625,6 +3387,11 @@ namespace Model
          */
         virtual Model::RebootDBInstanceOutcomeCallable RebootDBInstanceCallable(const Model::RebootDBInstanceRequest& request) const;
 
+        /**
+         * Same as RebootDBInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RebootDBInstanceOutcomeCallable RebootDBInstanceCallable(Model::RebootDBInstanceRequest&& request) const;
+
         /**
          * <p> Rebooting a DB instance restarts the database engine service. A reboot also
          * applies to the DB instance any modifications to the associated DB parameter
@@ -2645,6 +3412,11 @@ namespace Model
          */
         virtual void RebootDBInstanceAsync(const Model::RebootDBInstanceRequest& request, const RebootDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebootDBInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RebootDBInstanceAsync(Model::RebootDBInstanceRequest&& request, const RebootDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes a source identifier from an existing RDS event notification
          * subscription.</p>
@@ -2659,6 +3431,11 @@ namespace Model
          */
         virtual Model::RemoveSourceIdentifierFromSubscriptionOutcomeCallable RemoveSourceIdentifierFromSubscriptionCallable(const Model::RemoveSourceIdentifierFromSubscriptionRequest& request) const;
 
+        /**
+         * Same as RemoveSourceIdentifierFromSubscriptionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveSourceIdentifierFromSubscriptionOutcomeCallable RemoveSourceIdentifierFromSubscriptionCallable(Model::RemoveSourceIdentifierFromSubscriptionRequest&& request) const;
+
         /**
          * <p>Removes a source identifier from an existing RDS event notification
          * subscription.</p>
@@ -2667,6 +3444,11 @@ namespace Model
          */
         virtual void RemoveSourceIdentifierFromSubscriptionAsync(const Model::RemoveSourceIdentifierFromSubscriptionRequest& request, const RemoveSourceIdentifierFromSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveSourceIdentifierFromSubscriptionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveSourceIdentifierFromSubscriptionAsync(Model::RemoveSourceIdentifierFromSubscriptionRequest&& request, const RemoveSourceIdentifierFromSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Removes metadata tags from an Amazon RDS resource.</p> <p>For an overview on
          * tagging an Amazon RDS resource, see <a
@@ -2685,6 +3467,11 @@ namespace Model
          */
         virtual Model::RemoveTagsFromResourceOutcomeCallable RemoveTagsFromResourceCallable(const Model::RemoveTagsFromResourceRequest& request) const;
 
+        /**
+         * Same as RemoveTagsFromResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveTagsFromResourceOutcomeCallable RemoveTagsFromResourceCallable(Model::RemoveTagsFromResourceRequest&& request) const;
+
         /**
          * <p> Removes metadata tags from an Amazon RDS resource.</p> <p>For an overview on
          * tagging an Amazon RDS resource, see <a
@@ -2695,6 +3482,11 @@ namespace Model
          */
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveTagsFromResourceAsync(Model::RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies the parameters of a DB cluster parameter group to the default
          * value. To reset specific parameters submit a list of the following:
@@ -2731,6 +3523,11 @@ namespace Model
          */
         virtual Model::ResetDBClusterParameterGroupOutcomeCallable ResetDBClusterParameterGroupCallable(const Model::ResetDBClusterParameterGroupRequest& request) const;
 
+        /**
+         * Same as ResetDBClusterParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ResetDBClusterParameterGroupOutcomeCallable ResetDBClusterParameterGroupCallable(Model::ResetDBClusterParameterGroupRequest&& request) const;
+
         /**
          * <p> Modifies the parameters of a DB cluster parameter group to the default
          * value. To reset specific parameters submit a list of the following:
@@ -2750,6 +3547,11 @@ namespace Model
          */
         virtual void ResetDBClusterParameterGroupAsync(const Model::ResetDBClusterParameterGroupRequest& request, const ResetDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetDBClusterParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ResetDBClusterParameterGroupAsync(Model::ResetDBClusterParameterGroupRequest&& request, const ResetDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies the parameters of a DB parameter group to the engine/system default
          * value. To reset specific parameters submit a list of the following:
@@ -2776,6 +3578,11 @@ namespace Model
          */
         virtual Model::ResetDBParameterGroupOutcomeCallable ResetDBParameterGroupCallable(const Model::ResetDBParameterGroupRequest& request) const;
 
+        /**
+         * Same as ResetDBParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ResetDBParameterGroupOutcomeCallable ResetDBParameterGroupCallable(Model::ResetDBParameterGroupRequest&& request) const;
+
         /**
          * <p> Modifies the parameters of a DB parameter group to the engine/system default
          * value. To reset specific parameters submit a list of the following:
@@ -2790,6 +3597,11 @@ namespace Model
          */
         virtual void ResetDBParameterGroupAsync(const Model::ResetDBParameterGroupRequest& request, const ResetDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetDBParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ResetDBParameterGroupAsync(Model::ResetDBParameterGroupRequest&& request, const ResetDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new DB cluster from a DB cluster snapshot. The target DB cluster is
          * created from the source DB cluster restore point with the same configuration as
@@ -2814,6 +3626,11 @@ namespace Model
          */
         virtual Model::RestoreDBClusterFromSnapshotOutcomeCallable RestoreDBClusterFromSnapshotCallable(const Model::RestoreDBClusterFromSnapshotRequest& request) const;
 
+        /**
+         * Same as RestoreDBClusterFromSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RestoreDBClusterFromSnapshotOutcomeCallable RestoreDBClusterFromSnapshotCallable(Model::RestoreDBClusterFromSnapshotRequest&& request) const;
+
         /**
          * <p>Creates a new DB cluster from a DB cluster snapshot. The target DB cluster is
          * created from the source DB cluster restore point with the same configuration as
@@ -2827,6 +3644,11 @@ namespace Model
          */
         virtual void RestoreDBClusterFromSnapshotAsync(const Model::RestoreDBClusterFromSnapshotRequest& request, const RestoreDBClusterFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreDBClusterFromSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RestoreDBClusterFromSnapshotAsync(Model::RestoreDBClusterFromSnapshotRequest&& request, const RestoreDBClusterFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Restores a DB cluster to an arbitrary point in time. Users can restore to
          * any point in time before <code>LatestRestorableTime</code> for up to
@@ -2853,6 +3675,11 @@ namespace Model
          */
         virtual Model::RestoreDBClusterToPointInTimeOutcomeCallable RestoreDBClusterToPointInTimeCallable(const Model::RestoreDBClusterToPointInTimeRequest& request) const;
 
+        /**
+         * Same as RestoreDBClusterToPointInTimeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RestoreDBClusterToPointInTimeOutcomeCallable RestoreDBClusterToPointInTimeCallable(Model::RestoreDBClusterToPointInTimeRequest&& request) const;
+
         /**
          * <p> Restores a DB cluster to an arbitrary point in time. Users can restore to
          * any point in time before <code>LatestRestorableTime</code> for up to
@@ -2867,6 +3694,11 @@ namespace Model
          */
         virtual void RestoreDBClusterToPointInTimeAsync(const Model::RestoreDBClusterToPointInTimeRequest& request, const RestoreDBClusterToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreDBClusterToPointInTimeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RestoreDBClusterToPointInTimeAsync(Model::RestoreDBClusterToPointInTimeRequest&& request, const RestoreDBClusterToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new DB instance from a DB snapshot. The target database is created
          * from the source database restore point with the most of original configuration
@@ -2909,6 +3741,11 @@ namespace Model
          */
         virtual Model::RestoreDBInstanceFromDBSnapshotOutcomeCallable RestoreDBInstanceFromDBSnapshotCallable(const Model::RestoreDBInstanceFromDBSnapshotRequest& request) const;
 
+        /**
+         * Same as RestoreDBInstanceFromDBSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RestoreDBInstanceFromDBSnapshotOutcomeCallable RestoreDBInstanceFromDBSnapshotCallable(Model::RestoreDBInstanceFromDBSnapshotRequest&& request) const;
+
         /**
          * <p>Creates a new DB instance from a DB snapshot. The target database is created
          * from the source database restore point with the most of original configuration
@@ -2931,6 +3768,11 @@ namespace Model
          */
         virtual void RestoreDBInstanceFromDBSnapshotAsync(const Model::RestoreDBInstanceFromDBSnapshotRequest& request, const RestoreDBInstanceFromDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreDBInstanceFromDBSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RestoreDBInstanceFromDBSnapshotAsync(Model::RestoreDBInstanceFromDBSnapshotRequest&& request, const RestoreDBInstanceFromDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Restores a DB instance to an arbitrary point in time. You can restore to any
          * point in time before the time identified by the LatestRestorableTime property.
@@ -2961,6 +3803,11 @@ namespace Model
          */
         virtual Model::RestoreDBInstanceToPointInTimeOutcomeCallable RestoreDBInstanceToPointInTimeCallable(const Model::RestoreDBInstanceToPointInTimeRequest& request) const;
 
+        /**
+         * Same as RestoreDBInstanceToPointInTimeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RestoreDBInstanceToPointInTimeOutcomeCallable RestoreDBInstanceToPointInTimeCallable(Model::RestoreDBInstanceToPointInTimeRequest&& request) const;
+
         /**
          * <p> Restores a DB instance to an arbitrary point in time. You can restore to any
          * point in time before the time identified by the LatestRestorableTime property.
@@ -2977,6 +3824,11 @@ namespace Model
          */
         virtual void RestoreDBInstanceToPointInTimeAsync(const Model::RestoreDBInstanceToPointInTimeRequest& request, const RestoreDBInstanceToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreDBInstanceToPointInTimeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RestoreDBInstanceToPointInTimeAsync(Model::RestoreDBInstanceToPointInTimeRequest&& request, const RestoreDBInstanceToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Revokes ingress from a DBSecurityGroup for previously authorized IP ranges
          * or EC2 or VPC Security Groups. Required parameters for this API are one of
@@ -2995,6 +3847,11 @@ namespace Model
          */
         virtual Model::RevokeDBSecurityGroupIngressOutcomeCallable RevokeDBSecurityGroupIngressCallable(const Model::RevokeDBSecurityGroupIngressRequest& request) const;
 
+        /**
+         * Same as RevokeDBSecurityGroupIngressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RevokeDBSecurityGroupIngressOutcomeCallable RevokeDBSecurityGroupIngressCallable(Model::RevokeDBSecurityGroupIngressRequest&& request) const;
+
         /**
          * <p> Revokes ingress from a DBSecurityGroup for previously authorized IP ranges
          * or EC2 or VPC Security Groups. Required parameters for this API are one of
@@ -3005,6 +3862,174 @@ namespace Model
          */
         virtual void RevokeDBSecurityGroupIngressAsync(const Model::RevokeDBSecurityGroupIngressRequest& request, const RevokeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RevokeDBSecurityGroupIngressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RevokeDBSecurityGroupIngressAsync(Model::RevokeDBSecurityGroupIngressRequest&& request, const RevokeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AddSourceIdentifierToSubscriptionOutcome> AddSourceIdentifierToSubscriptionAwaitable(const Model::AddSourceIdentifierToSubscriptionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::AddSourceIdentifierToSubscription, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddSourceIdentifierToSubscriptionOutcome> AddSourceIdentifierToSubscriptionAwaitable(Model::AddSourceIdentifierToSubscriptionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::AddSourceIdentifierToSubscription, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(const Model::AddTagsToResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::AddTagsToResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(Model::AddTagsToResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::AddTagsToResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ApplyPendingMaintenanceActionOutcome> ApplyPendingMaintenanceActionAwaitable(const Model::ApplyPendingMaintenanceActionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ApplyPendingMaintenanceAction, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ApplyPendingMaintenanceActionOutcome> ApplyPendingMaintenanceActionAwaitable(Model::ApplyPendingMaintenanceActionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ApplyPendingMaintenanceAction, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AuthorizeDBSecurityGroupIngressOutcome> AuthorizeDBSecurityGroupIngressAwaitable(const Model::AuthorizeDBSecurityGroupIngressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::AuthorizeDBSecurityGroupIngress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AuthorizeDBSecurityGroupIngressOutcome> AuthorizeDBSecurityGroupIngressAwaitable(Model::AuthorizeDBSecurityGroupIngressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::AuthorizeDBSecurityGroupIngress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopyDBClusterSnapshotOutcome> CopyDBClusterSnapshotAwaitable(const Model::CopyDBClusterSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CopyDBClusterSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopyDBClusterSnapshotOutcome> CopyDBClusterSnapshotAwaitable(Model::CopyDBClusterSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CopyDBClusterSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopyDBParameterGroupOutcome> CopyDBParameterGroupAwaitable(const Model::CopyDBParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CopyDBParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopyDBParameterGroupOutcome> CopyDBParameterGroupAwaitable(Model::CopyDBParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CopyDBParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopyDBSnapshotOutcome> CopyDBSnapshotAwaitable(const Model::CopyDBSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CopyDBSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopyDBSnapshotOutcome> CopyDBSnapshotAwaitable(Model::CopyDBSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CopyDBSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopyOptionGroupOutcome> CopyOptionGroupAwaitable(const Model::CopyOptionGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CopyOptionGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopyOptionGroupOutcome> CopyOptionGroupAwaitable(Model::CopyOptionGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CopyOptionGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBClusterOutcome> CreateDBClusterAwaitable(const Model::CreateDBClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBClusterOutcome> CreateDBClusterAwaitable(Model::CreateDBClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBClusterParameterGroupOutcome> CreateDBClusterParameterGroupAwaitable(const Model::CreateDBClusterParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBClusterParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBClusterParameterGroupOutcome> CreateDBClusterParameterGroupAwaitable(Model::CreateDBClusterParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBClusterParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBClusterSnapshotOutcome> CreateDBClusterSnapshotAwaitable(const Model::CreateDBClusterSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBClusterSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBClusterSnapshotOutcome> CreateDBClusterSnapshotAwaitable(Model::CreateDBClusterSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBClusterSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBInstanceOutcome> CreateDBInstanceAwaitable(const Model::CreateDBInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBInstanceOutcome> CreateDBInstanceAwaitable(Model::CreateDBInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBInstanceReadReplicaOutcome> CreateDBInstanceReadReplicaAwaitable(const Model::CreateDBInstanceReadReplicaRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBInstanceReadReplica, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBInstanceReadReplicaOutcome> CreateDBInstanceReadReplicaAwaitable(Model::CreateDBInstanceReadReplicaRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBInstanceReadReplica, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBParameterGroupOutcome> CreateDBParameterGroupAwaitable(const Model::CreateDBParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBParameterGroupOutcome> CreateDBParameterGroupAwaitable(Model::CreateDBParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBSecurityGroupOutcome> CreateDBSecurityGroupAwaitable(const Model::CreateDBSecurityGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBSecurityGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBSecurityGroupOutcome> CreateDBSecurityGroupAwaitable(Model::CreateDBSecurityGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBSecurityGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBSnapshotOutcome> CreateDBSnapshotAwaitable(const Model::CreateDBSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBSnapshotOutcome> CreateDBSnapshotAwaitable(Model::CreateDBSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBSubnetGroupOutcome> CreateDBSubnetGroupAwaitable(const Model::CreateDBSubnetGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBSubnetGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDBSubnetGroupOutcome> CreateDBSubnetGroupAwaitable(Model::CreateDBSubnetGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateDBSubnetGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateEventSubscriptionOutcome> CreateEventSubscriptionAwaitable(const Model::CreateEventSubscriptionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateEventSubscription, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateEventSubscriptionOutcome> CreateEventSubscriptionAwaitable(Model::CreateEventSubscriptionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateEventSubscription, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateOptionGroupOutcome> CreateOptionGroupAwaitable(const Model::CreateOptionGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateOptionGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateOptionGroupOutcome> CreateOptionGroupAwaitable(Model::CreateOptionGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::CreateOptionGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBClusterOutcome> DeleteDBClusterAwaitable(const Model::DeleteDBClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBClusterOutcome> DeleteDBClusterAwaitable(Model::DeleteDBClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBClusterParameterGroupOutcome> DeleteDBClusterParameterGroupAwaitable(const Model::DeleteDBClusterParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBClusterParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBClusterParameterGroupOutcome> DeleteDBClusterParameterGroupAwaitable(Model::DeleteDBClusterParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBClusterParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBClusterSnapshotOutcome> DeleteDBClusterSnapshotAwaitable(const Model::DeleteDBClusterSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBClusterSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBClusterSnapshotOutcome> DeleteDBClusterSnapshotAwaitable(Model::DeleteDBClusterSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBClusterSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBInstanceOutcome> DeleteDBInstanceAwaitable(const Model::DeleteDBInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBInstanceOutcome> DeleteDBInstanceAwaitable(Model::DeleteDBInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBParameterGroupOutcome> DeleteDBParameterGroupAwaitable(const Model::DeleteDBParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBParameterGroupOutcome> DeleteDBParameterGroupAwaitable(Model::DeleteDBParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBSecurityGroupOutcome> DeleteDBSecurityGroupAwaitable(const Model::DeleteDBSecurityGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBSecurityGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBSecurityGroupOutcome> DeleteDBSecurityGroupAwaitable(Model::DeleteDBSecurityGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBSecurityGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBSnapshotOutcome> DeleteDBSnapshotAwaitable(const Model::DeleteDBSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBSnapshotOutcome> DeleteDBSnapshotAwaitable(Model::DeleteDBSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBSubnetGroupOutcome> DeleteDBSubnetGroupAwaitable(const Model::DeleteDBSubnetGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBSubnetGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDBSubnetGroupOutcome> DeleteDBSubnetGroupAwaitable(Model::DeleteDBSubnetGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteDBSubnetGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteEventSubscriptionOutcome> DeleteEventSubscriptionAwaitable(const Model::DeleteEventSubscriptionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteEventSubscription, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteEventSubscriptionOutcome> DeleteEventSubscriptionAwaitable(Model::DeleteEventSubscriptionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteEventSubscription, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteOptionGroupOutcome> DeleteOptionGroupAwaitable(const Model::DeleteOptionGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteOptionGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteOptionGroupOutcome> DeleteOptionGroupAwaitable(Model::DeleteOptionGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DeleteOptionGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAccountAttributesOutcome> DescribeAccountAttributesAwaitable(const Model::DescribeAccountAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeAccountAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAccountAttributesOutcome> DescribeAccountAttributesAwaitable(Model::DescribeAccountAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeAccountAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCertificatesOutcome> DescribeCertificatesAwaitable(const Model::DescribeCertificatesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeCertificates, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCertificatesOutcome> DescribeCertificatesAwaitable(Model::DescribeCertificatesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeCertificates, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBClusterParameterGroupsOutcome> DescribeDBClusterParameterGroupsAwaitable(const Model::DescribeDBClusterParameterGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBClusterParameterGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBClusterParameterGroupsOutcome> DescribeDBClusterParameterGroupsAwaitable(Model::DescribeDBClusterParameterGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBClusterParameterGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBClusterParametersOutcome> DescribeDBClusterParametersAwaitable(const Model::DescribeDBClusterParametersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBClusterParameters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBClusterParametersOutcome> DescribeDBClusterParametersAwaitable(Model::DescribeDBClusterParametersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBClusterParameters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBClusterSnapshotsOutcome> DescribeDBClusterSnapshotsAwaitable(const Model::DescribeDBClusterSnapshotsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBClusterSnapshots, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBClusterSnapshotsOutcome> DescribeDBClusterSnapshotsAwaitable(Model::DescribeDBClusterSnapshotsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBClusterSnapshots, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBClustersOutcome> DescribeDBClustersAwaitable(const Model::DescribeDBClustersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBClusters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBClustersOutcome> DescribeDBClustersAwaitable(Model::DescribeDBClustersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBClusters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBEngineVersionsOutcome> DescribeDBEngineVersionsAwaitable(const Model::DescribeDBEngineVersionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBEngineVersions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBEngineVersionsOutcome> DescribeDBEngineVersionsAwaitable(Model::DescribeDBEngineVersionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBEngineVersions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBInstancesOutcome> DescribeDBInstancesAwaitable(const Model::DescribeDBInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBInstancesOutcome> DescribeDBInstancesAwaitable(Model::DescribeDBInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBLogFilesOutcome> DescribeDBLogFilesAwaitable(const Model::DescribeDBLogFilesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBLogFiles, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBLogFilesOutcome> DescribeDBLogFilesAwaitable(Model::DescribeDBLogFilesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBLogFiles, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBParameterGroupsOutcome> DescribeDBParameterGroupsAwaitable(const Model::DescribeDBParameterGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBParameterGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBParameterGroupsOutcome> DescribeDBParameterGroupsAwaitable(Model::DescribeDBParameterGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBParameterGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBParametersOutcome> DescribeDBParametersAwaitable(const Model::DescribeDBParametersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBParameters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBParametersOutcome> DescribeDBParametersAwaitable(Model::DescribeDBParametersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBParameters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBSecurityGroupsOutcome> DescribeDBSecurityGroupsAwaitable(const Model::DescribeDBSecurityGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBSecurityGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBSecurityGroupsOutcome> DescribeDBSecurityGroupsAwaitable(Model::DescribeDBSecurityGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBSecurityGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBSnapshotAttributesOutcome> DescribeDBSnapshotAttributesAwaitable(const Model::DescribeDBSnapshotAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBSnapshotAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBSnapshotAttributesOutcome> DescribeDBSnapshotAttributesAwaitable(Model::DescribeDBSnapshotAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBSnapshotAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBSnapshotsOutcome> DescribeDBSnapshotsAwaitable(const Model::DescribeDBSnapshotsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBSnapshots, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBSnapshotsOutcome> DescribeDBSnapshotsAwaitable(Model::DescribeDBSnapshotsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBSnapshots, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBSubnetGroupsOutcome> DescribeDBSubnetGroupsAwaitable(const Model::DescribeDBSubnetGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBSubnetGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDBSubnetGroupsOutcome> DescribeDBSubnetGroupsAwaitable(Model::DescribeDBSubnetGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeDBSubnetGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEngineDefaultClusterParametersOutcome> DescribeEngineDefaultClusterParametersAwaitable(const Model::DescribeEngineDefaultClusterParametersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeEngineDefaultClusterParameters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEngineDefaultClusterParametersOutcome> DescribeEngineDefaultClusterParametersAwaitable(Model::DescribeEngineDefaultClusterParametersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeEngineDefaultClusterParameters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEngineDefaultParametersOutcome> DescribeEngineDefaultParametersAwaitable(const Model::DescribeEngineDefaultParametersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeEngineDefaultParameters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEngineDefaultParametersOutcome> DescribeEngineDefaultParametersAwaitable(Model::DescribeEngineDefaultParametersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeEngineDefaultParameters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventCategoriesOutcome> DescribeEventCategoriesAwaitable(const Model::DescribeEventCategoriesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeEventCategories, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventCategoriesOutcome> DescribeEventCategoriesAwaitable(Model::DescribeEventCategoriesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeEventCategories, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventSubscriptionsOutcome> DescribeEventSubscriptionsAwaitable(const Model::DescribeEventSubscriptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeEventSubscriptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventSubscriptionsOutcome> DescribeEventSubscriptionsAwaitable(Model::DescribeEventSubscriptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeEventSubscriptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventsOutcome> DescribeEventsAwaitable(const Model::DescribeEventsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeEvents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventsOutcome> DescribeEventsAwaitable(Model::DescribeEventsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeEvents, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeOptionGroupOptionsOutcome> DescribeOptionGroupOptionsAwaitable(const Model::DescribeOptionGroupOptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeOptionGroupOptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeOptionGroupOptionsOutcome> DescribeOptionGroupOptionsAwaitable(Model::DescribeOptionGroupOptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeOptionGroupOptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeOptionGroupsOutcome> DescribeOptionGroupsAwaitable(const Model::DescribeOptionGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeOptionGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeOptionGroupsOutcome> DescribeOptionGroupsAwaitable(Model::DescribeOptionGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeOptionGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeOrderableDBInstanceOptionsOutcome> DescribeOrderableDBInstanceOptionsAwaitable(const Model::DescribeOrderableDBInstanceOptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeOrderableDBInstanceOptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeOrderableDBInstanceOptionsOutcome> DescribeOrderableDBInstanceOptionsAwaitable(Model::DescribeOrderableDBInstanceOptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeOrderableDBInstanceOptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribePendingMaintenanceActionsOutcome> DescribePendingMaintenanceActionsAwaitable(const Model::DescribePendingMaintenanceActionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribePendingMaintenanceActions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribePendingMaintenanceActionsOutcome> DescribePendingMaintenanceActionsAwaitable(Model::DescribePendingMaintenanceActionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribePendingMaintenanceActions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedDBInstancesOutcome> DescribeReservedDBInstancesAwaitable(const Model::DescribeReservedDBInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeReservedDBInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedDBInstancesOutcome> DescribeReservedDBInstancesAwaitable(Model::DescribeReservedDBInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeReservedDBInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedDBInstancesOfferingsOutcome> DescribeReservedDBInstancesOfferingsAwaitable(const Model::DescribeReservedDBInstancesOfferingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeReservedDBInstancesOfferings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedDBInstancesOfferingsOutcome> DescribeReservedDBInstancesOfferingsAwaitable(Model::DescribeReservedDBInstancesOfferingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DescribeReservedDBInstancesOfferings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DownloadDBLogFilePortionOutcome> DownloadDBLogFilePortionAwaitable(const Model::DownloadDBLogFilePortionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DownloadDBLogFilePortion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DownloadDBLogFilePortionOutcome> DownloadDBLogFilePortionAwaitable(Model::DownloadDBLogFilePortionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::DownloadDBLogFilePortion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::FailoverDBClusterOutcome> FailoverDBClusterAwaitable(const Model::FailoverDBClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::FailoverDBCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::FailoverDBClusterOutcome> FailoverDBClusterAwaitable(Model::FailoverDBClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::FailoverDBCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(const Model::ListTagsForResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ListTagsForResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(Model::ListTagsForResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ListTagsForResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyDBClusterOutcome> ModifyDBClusterAwaitable(const Model::ModifyDBClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyDBCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyDBClusterOutcome> ModifyDBClusterAwaitable(Model::ModifyDBClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyDBCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyDBClusterParameterGroupOutcome> ModifyDBClusterParameterGroupAwaitable(const Model::ModifyDBClusterParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyDBClusterParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyDBClusterParameterGroupOutcome> ModifyDBClusterParameterGroupAwaitable(Model::ModifyDBClusterParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyDBClusterParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyDBInstanceOutcome> ModifyDBInstanceAwaitable(const Model::ModifyDBInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyDBInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyDBInstanceOutcome> ModifyDBInstanceAwaitable(Model::ModifyDBInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyDBInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyDBParameterGroupOutcome> ModifyDBParameterGroupAwaitable(const Model::ModifyDBParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyDBParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyDBParameterGroupOutcome> ModifyDBParameterGroupAwaitable(Model::ModifyDBParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyDBParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyDBSnapshotAttributeOutcome> ModifyDBSnapshotAttributeAwaitable(const Model::ModifyDBSnapshotAttributeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyDBSnapshotAttribute, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyDBSnapshotAttributeOutcome> ModifyDBSnapshotAttributeAwaitable(Model::ModifyDBSnapshotAttributeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyDBSnapshotAttribute, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyDBSubnetGroupOutcome> ModifyDBSubnetGroupAwaitable(const Model::ModifyDBSubnetGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyDBSubnetGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyDBSubnetGroupOutcome> ModifyDBSubnetGroupAwaitable(Model::ModifyDBSubnetGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyDBSubnetGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyEventSubscriptionOutcome> ModifyEventSubscriptionAwaitable(const Model::ModifyEventSubscriptionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyEventSubscription, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyEventSubscriptionOutcome> ModifyEventSubscriptionAwaitable(Model::ModifyEventSubscriptionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyEventSubscription, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyOptionGroupOutcome> ModifyOptionGroupAwaitable(const Model::ModifyOptionGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyOptionGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyOptionGroupOutcome> ModifyOptionGroupAwaitable(Model::ModifyOptionGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ModifyOptionGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PromoteReadReplicaOutcome> PromoteReadReplicaAwaitable(const Model::PromoteReadReplicaRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::PromoteReadReplica, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PromoteReadReplicaOutcome> PromoteReadReplicaAwaitable(Model::PromoteReadReplicaRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::PromoteReadReplica, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PurchaseReservedDBInstancesOfferingOutcome> PurchaseReservedDBInstancesOfferingAwaitable(const Model::PurchaseReservedDBInstancesOfferingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::PurchaseReservedDBInstancesOffering, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PurchaseReservedDBInstancesOfferingOutcome> PurchaseReservedDBInstancesOfferingAwaitable(Model::PurchaseReservedDBInstancesOfferingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::PurchaseReservedDBInstancesOffering, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebootDBInstanceOutcome> RebootDBInstanceAwaitable(const Model::RebootDBInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RebootDBInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebootDBInstanceOutcome> RebootDBInstanceAwaitable(Model::RebootDBInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RebootDBInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveSourceIdentifierFromSubscriptionOutcome> RemoveSourceIdentifierFromSubscriptionAwaitable(const Model::RemoveSourceIdentifierFromSubscriptionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RemoveSourceIdentifierFromSubscription, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveSourceIdentifierFromSubscriptionOutcome> RemoveSourceIdentifierFromSubscriptionAwaitable(Model::RemoveSourceIdentifierFromSubscriptionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RemoveSourceIdentifierFromSubscription, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(const Model::RemoveTagsFromResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RemoveTagsFromResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(Model::RemoveTagsFromResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RemoveTagsFromResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetDBClusterParameterGroupOutcome> ResetDBClusterParameterGroupAwaitable(const Model::ResetDBClusterParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ResetDBClusterParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetDBClusterParameterGroupOutcome> ResetDBClusterParameterGroupAwaitable(Model::ResetDBClusterParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ResetDBClusterParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetDBParameterGroupOutcome> ResetDBParameterGroupAwaitable(const Model::ResetDBParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ResetDBParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetDBParameterGroupOutcome> ResetDBParameterGroupAwaitable(Model::ResetDBParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::ResetDBParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreDBClusterFromSnapshotOutcome> RestoreDBClusterFromSnapshotAwaitable(const Model::RestoreDBClusterFromSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RestoreDBClusterFromSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreDBClusterFromSnapshotOutcome> RestoreDBClusterFromSnapshotAwaitable(Model::RestoreDBClusterFromSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RestoreDBClusterFromSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreDBClusterToPointInTimeOutcome> RestoreDBClusterToPointInTimeAwaitable(const Model::RestoreDBClusterToPointInTimeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RestoreDBClusterToPointInTime, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreDBClusterToPointInTimeOutcome> RestoreDBClusterToPointInTimeAwaitable(Model::RestoreDBClusterToPointInTimeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RestoreDBClusterToPointInTime, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreDBInstanceFromDBSnapshotOutcome> RestoreDBInstanceFromDBSnapshotAwaitable(const Model::RestoreDBInstanceFromDBSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RestoreDBInstanceFromDBSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreDBInstanceFromDBSnapshotOutcome> RestoreDBInstanceFromDBSnapshotAwaitable(Model::RestoreDBInstanceFromDBSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RestoreDBInstanceFromDBSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreDBInstanceToPointInTimeOutcome> RestoreDBInstanceToPointInTimeAwaitable(const Model::RestoreDBInstanceToPointInTimeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RestoreDBInstanceToPointInTime, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreDBInstanceToPointInTimeOutcome> RestoreDBInstanceToPointInTimeAwaitable(Model::RestoreDBInstanceToPointInTimeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RestoreDBInstanceToPointInTime, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RevokeDBSecurityGroupIngressOutcome> RevokeDBSecurityGroupIngressAwaitable(const Model::RevokeDBSecurityGroupIngressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RevokeDBSecurityGroupIngress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RevokeDBSecurityGroupIngressOutcome> RevokeDBSecurityGroupIngressAwaitable(Model::RevokeDBSecurityGroupIngressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RDSClient::RevokeDBSecurityGroupIngress, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
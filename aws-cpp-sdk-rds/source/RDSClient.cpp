@@ -185,12 +185,22 @@ AddSourceIdentifierToSubscriptionOutcome RDSClient::AddSourceIdentifierToSubscri
 
 AddSourceIdentifierToSubscriptionOutcomeCallable RDSClient::AddSourceIdentifierToSubscriptionCallable(const AddSourceIdentifierToSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::AddSourceIdentifierToSubscription, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::AddSourceIdentifierToSubscription, Aws::Client::RejectedCallOutcome<AddSourceIdentifierToSubscriptionOutcome>(), this, request);
+}
+
+AddSourceIdentifierToSubscriptionOutcomeCallable RDSClient::AddSourceIdentifierToSubscriptionCallable(AddSourceIdentifierToSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::AddSourceIdentifierToSubscription, Aws::Client::RejectedCallOutcome<AddSourceIdentifierToSubscriptionOutcome>(), this, std::move(request));
 }
 
 void RDSClient::AddSourceIdentifierToSubscriptionAsync(const AddSourceIdentifierToSubscriptionRequest& request, const AddSourceIdentifierToSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::AddSourceIdentifierToSubscriptionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::AddSourceIdentifierToSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<AddSourceIdentifierToSubscriptionOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::AddSourceIdentifierToSubscriptionAsync(AddSourceIdentifierToSubscriptionRequest&& request, const AddSourceIdentifierToSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::AddSourceIdentifierToSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<AddSourceIdentifierToSubscriptionOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::AddSourceIdentifierToSubscriptionAsyncHelper(const AddSourceIdentifierToSubscriptionRequest& request, const AddSourceIdentifierToSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -215,12 +225,22 @@ AddTagsToResourceOutcome RDSClient::AddTagsToResource(const AddTagsToResourceReq
 
 AddTagsToResourceOutcomeCallable RDSClient::AddTagsToResourceCallable(const AddTagsToResourceRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::AddTagsToResource, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::AddTagsToResource, Aws::Client::RejectedCallOutcome<AddTagsToResourceOutcome>(), this, request);
+}
+
+AddTagsToResourceOutcomeCallable RDSClient::AddTagsToResourceCallable(AddTagsToResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::AddTagsToResource, Aws::Client::RejectedCallOutcome<AddTagsToResourceOutcome>(), this, std::move(request));
 }
 
 void RDSClient::AddTagsToResourceAsync(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::AddTagsToResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::AddTagsToResourceAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsToResourceOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::AddTagsToResourceAsync(AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::AddTagsToResourceAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsToResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::AddTagsToResourceAsyncHelper(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -245,12 +265,22 @@ ApplyPendingMaintenanceActionOutcome RDSClient::ApplyPendingMaintenanceAction(co
 
 ApplyPendingMaintenanceActionOutcomeCallable RDSClient::ApplyPendingMaintenanceActionCallable(const ApplyPendingMaintenanceActionRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::ApplyPendingMaintenanceAction, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::ApplyPendingMaintenanceAction, Aws::Client::RejectedCallOutcome<ApplyPendingMaintenanceActionOutcome>(), this, request);
+}
+
+ApplyPendingMaintenanceActionOutcomeCallable RDSClient::ApplyPendingMaintenanceActionCallable(ApplyPendingMaintenanceActionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::ApplyPendingMaintenanceAction, Aws::Client::RejectedCallOutcome<ApplyPendingMaintenanceActionOutcome>(), this, std::move(request));
 }
 
 void RDSClient::ApplyPendingMaintenanceActionAsync(const ApplyPendingMaintenanceActionRequest& request, const ApplyPendingMaintenanceActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::ApplyPendingMaintenanceActionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::ApplyPendingMaintenanceActionAsyncHelper, Aws::Client::RejectedAsyncCall<ApplyPendingMaintenanceActionOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::ApplyPendingMaintenanceActionAsync(ApplyPendingMaintenanceActionRequest&& request, const ApplyPendingMaintenanceActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::ApplyPendingMaintenanceActionAsyncHelper, Aws::Client::RejectedAsyncCall<ApplyPendingMaintenanceActionOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::ApplyPendingMaintenanceActionAsyncHelper(const ApplyPendingMaintenanceActionRequest& request, const ApplyPendingMaintenanceActionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -275,12 +305,22 @@ AuthorizeDBSecurityGroupIngressOutcome RDSClient::AuthorizeDBSecurityGroupIngres
 
 AuthorizeDBSecurityGroupIngressOutcomeCallable RDSClient::AuthorizeDBSecurityGroupIngressCallable(const AuthorizeDBSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::AuthorizeDBSecurityGroupIngress, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::AuthorizeDBSecurityGroupIngress, Aws::Client::RejectedCallOutcome<AuthorizeDBSecurityGroupIngressOutcome>(), this, request);
+}
+
+AuthorizeDBSecurityGroupIngressOutcomeCallable RDSClient::AuthorizeDBSecurityGroupIngressCallable(AuthorizeDBSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::AuthorizeDBSecurityGroupIngress, Aws::Client::RejectedCallOutcome<AuthorizeDBSecurityGroupIngressOutcome>(), this, std::move(request));
 }
 
 void RDSClient::AuthorizeDBSecurityGroupIngressAsync(const AuthorizeDBSecurityGroupIngressRequest& request, const AuthorizeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::AuthorizeDBSecurityGroupIngressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::AuthorizeDBSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<AuthorizeDBSecurityGroupIngressOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::AuthorizeDBSecurityGroupIngressAsync(AuthorizeDBSecurityGroupIngressRequest&& request, const AuthorizeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::AuthorizeDBSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<AuthorizeDBSecurityGroupIngressOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::AuthorizeDBSecurityGroupIngressAsyncHelper(const AuthorizeDBSecurityGroupIngressRequest& request, const AuthorizeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -305,12 +345,22 @@ CopyDBClusterSnapshotOutcome RDSClient::CopyDBClusterSnapshot(const CopyDBCluste
 
 CopyDBClusterSnapshotOutcomeCallable RDSClient::CopyDBClusterSnapshotCallable(const CopyDBClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CopyDBClusterSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CopyDBClusterSnapshot, Aws::Client::RejectedCallOutcome<CopyDBClusterSnapshotOutcome>(), this, request);
+}
+
+CopyDBClusterSnapshotOutcomeCallable RDSClient::CopyDBClusterSnapshotCallable(CopyDBClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CopyDBClusterSnapshot, Aws::Client::RejectedCallOutcome<CopyDBClusterSnapshotOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CopyDBClusterSnapshotAsync(const CopyDBClusterSnapshotRequest& request, const CopyDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CopyDBClusterSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CopyDBClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CopyDBClusterSnapshotOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CopyDBClusterSnapshotAsync(CopyDBClusterSnapshotRequest&& request, const CopyDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CopyDBClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CopyDBClusterSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CopyDBClusterSnapshotAsyncHelper(const CopyDBClusterSnapshotRequest& request, const CopyDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -335,12 +385,22 @@ CopyDBParameterGroupOutcome RDSClient::CopyDBParameterGroup(const CopyDBParamete
 
 CopyDBParameterGroupOutcomeCallable RDSClient::CopyDBParameterGroupCallable(const CopyDBParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CopyDBParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CopyDBParameterGroup, Aws::Client::RejectedCallOutcome<CopyDBParameterGroupOutcome>(), this, request);
+}
+
+CopyDBParameterGroupOutcomeCallable RDSClient::CopyDBParameterGroupCallable(CopyDBParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CopyDBParameterGroup, Aws::Client::RejectedCallOutcome<CopyDBParameterGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CopyDBParameterGroupAsync(const CopyDBParameterGroupRequest& request, const CopyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CopyDBParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CopyDBParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CopyDBParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CopyDBParameterGroupAsync(CopyDBParameterGroupRequest&& request, const CopyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CopyDBParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CopyDBParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CopyDBParameterGroupAsyncHelper(const CopyDBParameterGroupRequest& request, const CopyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -365,12 +425,22 @@ CopyDBSnapshotOutcome RDSClient::CopyDBSnapshot(const CopyDBSnapshotRequest& req
 
 CopyDBSnapshotOutcomeCallable RDSClient::CopyDBSnapshotCallable(const CopyDBSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CopyDBSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CopyDBSnapshot, Aws::Client::RejectedCallOutcome<CopyDBSnapshotOutcome>(), this, request);
+}
+
+CopyDBSnapshotOutcomeCallable RDSClient::CopyDBSnapshotCallable(CopyDBSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CopyDBSnapshot, Aws::Client::RejectedCallOutcome<CopyDBSnapshotOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CopyDBSnapshotAsync(const CopyDBSnapshotRequest& request, const CopyDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CopyDBSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CopyDBSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CopyDBSnapshotOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CopyDBSnapshotAsync(CopyDBSnapshotRequest&& request, const CopyDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CopyDBSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CopyDBSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CopyDBSnapshotAsyncHelper(const CopyDBSnapshotRequest& request, const CopyDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -395,12 +465,22 @@ CopyOptionGroupOutcome RDSClient::CopyOptionGroup(const CopyOptionGroupRequest&
 
 CopyOptionGroupOutcomeCallable RDSClient::CopyOptionGroupCallable(const CopyOptionGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CopyOptionGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CopyOptionGroup, Aws::Client::RejectedCallOutcome<CopyOptionGroupOutcome>(), this, request);
+}
+
+CopyOptionGroupOutcomeCallable RDSClient::CopyOptionGroupCallable(CopyOptionGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CopyOptionGroup, Aws::Client::RejectedCallOutcome<CopyOptionGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CopyOptionGroupAsync(const CopyOptionGroupRequest& request, const CopyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CopyOptionGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CopyOptionGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CopyOptionGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CopyOptionGroupAsync(CopyOptionGroupRequest&& request, const CopyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CopyOptionGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CopyOptionGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CopyOptionGroupAsyncHelper(const CopyOptionGroupRequest& request, const CopyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -425,12 +505,22 @@ CreateDBClusterOutcome RDSClient::CreateDBCluster(const CreateDBClusterRequest&
 
 CreateDBClusterOutcomeCallable RDSClient::CreateDBClusterCallable(const CreateDBClusterRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CreateDBCluster, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBCluster, Aws::Client::RejectedCallOutcome<CreateDBClusterOutcome>(), this, request);
+}
+
+CreateDBClusterOutcomeCallable RDSClient::CreateDBClusterCallable(CreateDBClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBCluster, Aws::Client::RejectedCallOutcome<CreateDBClusterOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CreateDBClusterAsync(const CreateDBClusterRequest& request, const CreateDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CreateDBClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CreateDBClusterAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBClusterOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CreateDBClusterAsync(CreateDBClusterRequest&& request, const CreateDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CreateDBClusterAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CreateDBClusterAsyncHelper(const CreateDBClusterRequest& request, const CreateDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -455,12 +545,22 @@ CreateDBClusterParameterGroupOutcome RDSClient::CreateDBClusterParameterGroup(co
 
 CreateDBClusterParameterGroupOutcomeCallable RDSClient::CreateDBClusterParameterGroupCallable(const CreateDBClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CreateDBClusterParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBClusterParameterGroup, Aws::Client::RejectedCallOutcome<CreateDBClusterParameterGroupOutcome>(), this, request);
+}
+
+CreateDBClusterParameterGroupOutcomeCallable RDSClient::CreateDBClusterParameterGroupCallable(CreateDBClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBClusterParameterGroup, Aws::Client::RejectedCallOutcome<CreateDBClusterParameterGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CreateDBClusterParameterGroupAsync(const CreateDBClusterParameterGroupRequest& request, const CreateDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CreateDBClusterParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CreateDBClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBClusterParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CreateDBClusterParameterGroupAsync(CreateDBClusterParameterGroupRequest&& request, const CreateDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CreateDBClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBClusterParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CreateDBClusterParameterGroupAsyncHelper(const CreateDBClusterParameterGroupRequest& request, const CreateDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -485,12 +585,22 @@ CreateDBClusterSnapshotOutcome RDSClient::CreateDBClusterSnapshot(const CreateDB
 
 CreateDBClusterSnapshotOutcomeCallable RDSClient::CreateDBClusterSnapshotCallable(const CreateDBClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CreateDBClusterSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBClusterSnapshot, Aws::Client::RejectedCallOutcome<CreateDBClusterSnapshotOutcome>(), this, request);
+}
+
+CreateDBClusterSnapshotOutcomeCallable RDSClient::CreateDBClusterSnapshotCallable(CreateDBClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBClusterSnapshot, Aws::Client::RejectedCallOutcome<CreateDBClusterSnapshotOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CreateDBClusterSnapshotAsync(const CreateDBClusterSnapshotRequest& request, const CreateDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CreateDBClusterSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CreateDBClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBClusterSnapshotOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CreateDBClusterSnapshotAsync(CreateDBClusterSnapshotRequest&& request, const CreateDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CreateDBClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBClusterSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CreateDBClusterSnapshotAsyncHelper(const CreateDBClusterSnapshotRequest& request, const CreateDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -515,12 +625,22 @@ CreateDBInstanceOutcome RDSClient::CreateDBInstance(const CreateDBInstanceReques
 
 CreateDBInstanceOutcomeCallable RDSClient::CreateDBInstanceCallable(const CreateDBInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CreateDBInstance, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBInstance, Aws::Client::RejectedCallOutcome<CreateDBInstanceOutcome>(), this, request);
+}
+
+CreateDBInstanceOutcomeCallable RDSClient::CreateDBInstanceCallable(CreateDBInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBInstance, Aws::Client::RejectedCallOutcome<CreateDBInstanceOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CreateDBInstanceAsync(const CreateDBInstanceRequest& request, const CreateDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CreateDBInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CreateDBInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBInstanceOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CreateDBInstanceAsync(CreateDBInstanceRequest&& request, const CreateDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CreateDBInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CreateDBInstanceAsyncHelper(const CreateDBInstanceRequest& request, const CreateDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -545,12 +665,22 @@ CreateDBInstanceReadReplicaOutcome RDSClient::CreateDBInstanceReadReplica(const
 
 CreateDBInstanceReadReplicaOutcomeCallable RDSClient::CreateDBInstanceReadReplicaCallable(const CreateDBInstanceReadReplicaRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CreateDBInstanceReadReplica, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBInstanceReadReplica, Aws::Client::RejectedCallOutcome<CreateDBInstanceReadReplicaOutcome>(), this, request);
+}
+
+CreateDBInstanceReadReplicaOutcomeCallable RDSClient::CreateDBInstanceReadReplicaCallable(CreateDBInstanceReadReplicaRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBInstanceReadReplica, Aws::Client::RejectedCallOutcome<CreateDBInstanceReadReplicaOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CreateDBInstanceReadReplicaAsync(const CreateDBInstanceReadReplicaRequest& request, const CreateDBInstanceReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CreateDBInstanceReadReplicaAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CreateDBInstanceReadReplicaAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBInstanceReadReplicaOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CreateDBInstanceReadReplicaAsync(CreateDBInstanceReadReplicaRequest&& request, const CreateDBInstanceReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CreateDBInstanceReadReplicaAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBInstanceReadReplicaOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CreateDBInstanceReadReplicaAsyncHelper(const CreateDBInstanceReadReplicaRequest& request, const CreateDBInstanceReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -575,12 +705,22 @@ CreateDBParameterGroupOutcome RDSClient::CreateDBParameterGroup(const CreateDBPa
 
 CreateDBParameterGroupOutcomeCallable RDSClient::CreateDBParameterGroupCallable(const CreateDBParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CreateDBParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBParameterGroup, Aws::Client::RejectedCallOutcome<CreateDBParameterGroupOutcome>(), this, request);
+}
+
+CreateDBParameterGroupOutcomeCallable RDSClient::CreateDBParameterGroupCallable(CreateDBParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBParameterGroup, Aws::Client::RejectedCallOutcome<CreateDBParameterGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CreateDBParameterGroupAsync(const CreateDBParameterGroupRequest& request, const CreateDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CreateDBParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CreateDBParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CreateDBParameterGroupAsync(CreateDBParameterGroupRequest&& request, const CreateDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CreateDBParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CreateDBParameterGroupAsyncHelper(const CreateDBParameterGroupRequest& request, const CreateDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -605,12 +745,22 @@ CreateDBSecurityGroupOutcome RDSClient::CreateDBSecurityGroup(const CreateDBSecu
 
 CreateDBSecurityGroupOutcomeCallable RDSClient::CreateDBSecurityGroupCallable(const CreateDBSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CreateDBSecurityGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBSecurityGroup, Aws::Client::RejectedCallOutcome<CreateDBSecurityGroupOutcome>(), this, request);
+}
+
+CreateDBSecurityGroupOutcomeCallable RDSClient::CreateDBSecurityGroupCallable(CreateDBSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBSecurityGroup, Aws::Client::RejectedCallOutcome<CreateDBSecurityGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CreateDBSecurityGroupAsync(const CreateDBSecurityGroupRequest& request, const CreateDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CreateDBSecurityGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CreateDBSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBSecurityGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CreateDBSecurityGroupAsync(CreateDBSecurityGroupRequest&& request, const CreateDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CreateDBSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBSecurityGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CreateDBSecurityGroupAsyncHelper(const CreateDBSecurityGroupRequest& request, const CreateDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -635,12 +785,22 @@ CreateDBSnapshotOutcome RDSClient::CreateDBSnapshot(const CreateDBSnapshotReques
 
 CreateDBSnapshotOutcomeCallable RDSClient::CreateDBSnapshotCallable(const CreateDBSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CreateDBSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBSnapshot, Aws::Client::RejectedCallOutcome<CreateDBSnapshotOutcome>(), this, request);
+}
+
+CreateDBSnapshotOutcomeCallable RDSClient::CreateDBSnapshotCallable(CreateDBSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBSnapshot, Aws::Client::RejectedCallOutcome<CreateDBSnapshotOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CreateDBSnapshotAsync(const CreateDBSnapshotRequest& request, const CreateDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CreateDBSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CreateDBSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBSnapshotOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CreateDBSnapshotAsync(CreateDBSnapshotRequest&& request, const CreateDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CreateDBSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CreateDBSnapshotAsyncHelper(const CreateDBSnapshotRequest& request, const CreateDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -665,12 +825,22 @@ CreateDBSubnetGroupOutcome RDSClient::CreateDBSubnetGroup(const CreateDBSubnetGr
 
 CreateDBSubnetGroupOutcomeCallable RDSClient::CreateDBSubnetGroupCallable(const CreateDBSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CreateDBSubnetGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBSubnetGroup, Aws::Client::RejectedCallOutcome<CreateDBSubnetGroupOutcome>(), this, request);
+}
+
+CreateDBSubnetGroupOutcomeCallable RDSClient::CreateDBSubnetGroupCallable(CreateDBSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CreateDBSubnetGroup, Aws::Client::RejectedCallOutcome<CreateDBSubnetGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CreateDBSubnetGroupAsync(const CreateDBSubnetGroupRequest& request, const CreateDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CreateDBSubnetGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CreateDBSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBSubnetGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CreateDBSubnetGroupAsync(CreateDBSubnetGroupRequest&& request, const CreateDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CreateDBSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDBSubnetGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CreateDBSubnetGroupAsyncHelper(const CreateDBSubnetGroupRequest& request, const CreateDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -695,12 +865,22 @@ CreateEventSubscriptionOutcome RDSClient::CreateEventSubscription(const CreateEv
 
 CreateEventSubscriptionOutcomeCallable RDSClient::CreateEventSubscriptionCallable(const CreateEventSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CreateEventSubscription, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CreateEventSubscription, Aws::Client::RejectedCallOutcome<CreateEventSubscriptionOutcome>(), this, request);
+}
+
+CreateEventSubscriptionOutcomeCallable RDSClient::CreateEventSubscriptionCallable(CreateEventSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CreateEventSubscription, Aws::Client::RejectedCallOutcome<CreateEventSubscriptionOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CreateEventSubscriptionAsync(const CreateEventSubscriptionRequest& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CreateEventSubscriptionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CreateEventSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateEventSubscriptionOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CreateEventSubscriptionAsync(CreateEventSubscriptionRequest&& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CreateEventSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateEventSubscriptionOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CreateEventSubscriptionAsyncHelper(const CreateEventSubscriptionRequest& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -725,12 +905,22 @@ CreateOptionGroupOutcome RDSClient::CreateOptionGroup(const CreateOptionGroupReq
 
 CreateOptionGroupOutcomeCallable RDSClient::CreateOptionGroupCallable(const CreateOptionGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::CreateOptionGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::CreateOptionGroup, Aws::Client::RejectedCallOutcome<CreateOptionGroupOutcome>(), this, request);
+}
+
+CreateOptionGroupOutcomeCallable RDSClient::CreateOptionGroupCallable(CreateOptionGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::CreateOptionGroup, Aws::Client::RejectedCallOutcome<CreateOptionGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::CreateOptionGroupAsync(const CreateOptionGroupRequest& request, const CreateOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::CreateOptionGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::CreateOptionGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateOptionGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::CreateOptionGroupAsync(CreateOptionGroupRequest&& request, const CreateOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::CreateOptionGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateOptionGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::CreateOptionGroupAsyncHelper(const CreateOptionGroupRequest& request, const CreateOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -755,12 +945,22 @@ DeleteDBClusterOutcome RDSClient::DeleteDBCluster(const DeleteDBClusterRequest&
 
 DeleteDBClusterOutcomeCallable RDSClient::DeleteDBClusterCallable(const DeleteDBClusterRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DeleteDBCluster, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBCluster, Aws::Client::RejectedCallOutcome<DeleteDBClusterOutcome>(), this, request);
+}
+
+DeleteDBClusterOutcomeCallable RDSClient::DeleteDBClusterCallable(DeleteDBClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBCluster, Aws::Client::RejectedCallOutcome<DeleteDBClusterOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DeleteDBClusterAsync(const DeleteDBClusterRequest& request, const DeleteDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DeleteDBClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBClusterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBClusterOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DeleteDBClusterAsync(DeleteDBClusterRequest&& request, const DeleteDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBClusterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DeleteDBClusterAsyncHelper(const DeleteDBClusterRequest& request, const DeleteDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -785,12 +985,22 @@ DeleteDBClusterParameterGroupOutcome RDSClient::DeleteDBClusterParameterGroup(co
 
 DeleteDBClusterParameterGroupOutcomeCallable RDSClient::DeleteDBClusterParameterGroupCallable(const DeleteDBClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DeleteDBClusterParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBClusterParameterGroup, Aws::Client::RejectedCallOutcome<DeleteDBClusterParameterGroupOutcome>(), this, request);
+}
+
+DeleteDBClusterParameterGroupOutcomeCallable RDSClient::DeleteDBClusterParameterGroupCallable(DeleteDBClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBClusterParameterGroup, Aws::Client::RejectedCallOutcome<DeleteDBClusterParameterGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DeleteDBClusterParameterGroupAsync(const DeleteDBClusterParameterGroupRequest& request, const DeleteDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DeleteDBClusterParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBClusterParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DeleteDBClusterParameterGroupAsync(DeleteDBClusterParameterGroupRequest&& request, const DeleteDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBClusterParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DeleteDBClusterParameterGroupAsyncHelper(const DeleteDBClusterParameterGroupRequest& request, const DeleteDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -815,12 +1025,22 @@ DeleteDBClusterSnapshotOutcome RDSClient::DeleteDBClusterSnapshot(const DeleteDB
 
 DeleteDBClusterSnapshotOutcomeCallable RDSClient::DeleteDBClusterSnapshotCallable(const DeleteDBClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DeleteDBClusterSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBClusterSnapshot, Aws::Client::RejectedCallOutcome<DeleteDBClusterSnapshotOutcome>(), this, request);
+}
+
+DeleteDBClusterSnapshotOutcomeCallable RDSClient::DeleteDBClusterSnapshotCallable(DeleteDBClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBClusterSnapshot, Aws::Client::RejectedCallOutcome<DeleteDBClusterSnapshotOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DeleteDBClusterSnapshotAsync(const DeleteDBClusterSnapshotRequest& request, const DeleteDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DeleteDBClusterSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBClusterSnapshotOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DeleteDBClusterSnapshotAsync(DeleteDBClusterSnapshotRequest&& request, const DeleteDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBClusterSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DeleteDBClusterSnapshotAsyncHelper(const DeleteDBClusterSnapshotRequest& request, const DeleteDBClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -845,12 +1065,22 @@ DeleteDBInstanceOutcome RDSClient::DeleteDBInstance(const DeleteDBInstanceReques
 
 DeleteDBInstanceOutcomeCallable RDSClient::DeleteDBInstanceCallable(const DeleteDBInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DeleteDBInstance, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBInstance, Aws::Client::RejectedCallOutcome<DeleteDBInstanceOutcome>(), this, request);
+}
+
+DeleteDBInstanceOutcomeCallable RDSClient::DeleteDBInstanceCallable(DeleteDBInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBInstance, Aws::Client::RejectedCallOutcome<DeleteDBInstanceOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DeleteDBInstanceAsync(const DeleteDBInstanceRequest& request, const DeleteDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DeleteDBInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBInstanceOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DeleteDBInstanceAsync(DeleteDBInstanceRequest&& request, const DeleteDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DeleteDBInstanceAsyncHelper(const DeleteDBInstanceRequest& request, const DeleteDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -875,12 +1105,22 @@ DeleteDBParameterGroupOutcome RDSClient::DeleteDBParameterGroup(const DeleteDBPa
 
 DeleteDBParameterGroupOutcomeCallable RDSClient::DeleteDBParameterGroupCallable(const DeleteDBParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DeleteDBParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBParameterGroup, Aws::Client::RejectedCallOutcome<DeleteDBParameterGroupOutcome>(), this, request);
+}
+
+DeleteDBParameterGroupOutcomeCallable RDSClient::DeleteDBParameterGroupCallable(DeleteDBParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBParameterGroup, Aws::Client::RejectedCallOutcome<DeleteDBParameterGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DeleteDBParameterGroupAsync(const DeleteDBParameterGroupRequest& request, const DeleteDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DeleteDBParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DeleteDBParameterGroupAsync(DeleteDBParameterGroupRequest&& request, const DeleteDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DeleteDBParameterGroupAsyncHelper(const DeleteDBParameterGroupRequest& request, const DeleteDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -905,12 +1145,22 @@ DeleteDBSecurityGroupOutcome RDSClient::DeleteDBSecurityGroup(const DeleteDBSecu
 
 DeleteDBSecurityGroupOutcomeCallable RDSClient::DeleteDBSecurityGroupCallable(const DeleteDBSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DeleteDBSecurityGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBSecurityGroup, Aws::Client::RejectedCallOutcome<DeleteDBSecurityGroupOutcome>(), this, request);
+}
+
+DeleteDBSecurityGroupOutcomeCallable RDSClient::DeleteDBSecurityGroupCallable(DeleteDBSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBSecurityGroup, Aws::Client::RejectedCallOutcome<DeleteDBSecurityGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DeleteDBSecurityGroupAsync(const DeleteDBSecurityGroupRequest& request, const DeleteDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DeleteDBSecurityGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBSecurityGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DeleteDBSecurityGroupAsync(DeleteDBSecurityGroupRequest&& request, const DeleteDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBSecurityGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DeleteDBSecurityGroupAsyncHelper(const DeleteDBSecurityGroupRequest& request, const DeleteDBSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -935,12 +1185,22 @@ DeleteDBSnapshotOutcome RDSClient::DeleteDBSnapshot(const DeleteDBSnapshotReques
 
 DeleteDBSnapshotOutcomeCallable RDSClient::DeleteDBSnapshotCallable(const DeleteDBSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DeleteDBSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBSnapshot, Aws::Client::RejectedCallOutcome<DeleteDBSnapshotOutcome>(), this, request);
+}
+
+DeleteDBSnapshotOutcomeCallable RDSClient::DeleteDBSnapshotCallable(DeleteDBSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBSnapshot, Aws::Client::RejectedCallOutcome<DeleteDBSnapshotOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DeleteDBSnapshotAsync(const DeleteDBSnapshotRequest& request, const DeleteDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DeleteDBSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBSnapshotOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DeleteDBSnapshotAsync(DeleteDBSnapshotRequest&& request, const DeleteDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DeleteDBSnapshotAsyncHelper(const DeleteDBSnapshotRequest& request, const DeleteDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -965,12 +1225,22 @@ DeleteDBSubnetGroupOutcome RDSClient::DeleteDBSubnetGroup(const DeleteDBSubnetGr
 
 DeleteDBSubnetGroupOutcomeCallable RDSClient::DeleteDBSubnetGroupCallable(const DeleteDBSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DeleteDBSubnetGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBSubnetGroup, Aws::Client::RejectedCallOutcome<DeleteDBSubnetGroupOutcome>(), this, request);
+}
+
+DeleteDBSubnetGroupOutcomeCallable RDSClient::DeleteDBSubnetGroupCallable(DeleteDBSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteDBSubnetGroup, Aws::Client::RejectedCallOutcome<DeleteDBSubnetGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DeleteDBSubnetGroupAsync(const DeleteDBSubnetGroupRequest& request, const DeleteDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DeleteDBSubnetGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBSubnetGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DeleteDBSubnetGroupAsync(DeleteDBSubnetGroupRequest&& request, const DeleteDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DeleteDBSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDBSubnetGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DeleteDBSubnetGroupAsyncHelper(const DeleteDBSubnetGroupRequest& request, const DeleteDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -995,12 +1265,22 @@ DeleteEventSubscriptionOutcome RDSClient::DeleteEventSubscription(const DeleteEv
 
 DeleteEventSubscriptionOutcomeCallable RDSClient::DeleteEventSubscriptionCallable(const DeleteEventSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DeleteEventSubscription, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteEventSubscription, Aws::Client::RejectedCallOutcome<DeleteEventSubscriptionOutcome>(), this, request);
+}
+
+DeleteEventSubscriptionOutcomeCallable RDSClient::DeleteEventSubscriptionCallable(DeleteEventSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteEventSubscription, Aws::Client::RejectedCallOutcome<DeleteEventSubscriptionOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DeleteEventSubscriptionAsync(const DeleteEventSubscriptionRequest& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DeleteEventSubscriptionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DeleteEventSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteEventSubscriptionOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DeleteEventSubscriptionAsync(DeleteEventSubscriptionRequest&& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DeleteEventSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteEventSubscriptionOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DeleteEventSubscriptionAsyncHelper(const DeleteEventSubscriptionRequest& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1025,12 +1305,22 @@ DeleteOptionGroupOutcome RDSClient::DeleteOptionGroup(const DeleteOptionGroupReq
 
 DeleteOptionGroupOutcomeCallable RDSClient::DeleteOptionGroupCallable(const DeleteOptionGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DeleteOptionGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteOptionGroup, Aws::Client::RejectedCallOutcome<DeleteOptionGroupOutcome>(), this, request);
+}
+
+DeleteOptionGroupOutcomeCallable RDSClient::DeleteOptionGroupCallable(DeleteOptionGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DeleteOptionGroup, Aws::Client::RejectedCallOutcome<DeleteOptionGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DeleteOptionGroupAsync(const DeleteOptionGroupRequest& request, const DeleteOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DeleteOptionGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DeleteOptionGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteOptionGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DeleteOptionGroupAsync(DeleteOptionGroupRequest&& request, const DeleteOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DeleteOptionGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteOptionGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DeleteOptionGroupAsyncHelper(const DeleteOptionGroupRequest& request, const DeleteOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1055,12 +1345,22 @@ DescribeAccountAttributesOutcome RDSClient::DescribeAccountAttributes(const Desc
 
 DescribeAccountAttributesOutcomeCallable RDSClient::DescribeAccountAttributesCallable(const DescribeAccountAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeAccountAttributes, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeAccountAttributes, Aws::Client::RejectedCallOutcome<DescribeAccountAttributesOutcome>(), this, request);
+}
+
+DescribeAccountAttributesOutcomeCallable RDSClient::DescribeAccountAttributesCallable(DescribeAccountAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeAccountAttributes, Aws::Client::RejectedCallOutcome<DescribeAccountAttributesOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeAccountAttributesAsync(const DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeAccountAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeAccountAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAccountAttributesOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeAccountAttributesAsync(DescribeAccountAttributesRequest&& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeAccountAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAccountAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeAccountAttributesAsyncHelper(const DescribeAccountAttributesRequest& request, const DescribeAccountAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1085,12 +1385,22 @@ DescribeCertificatesOutcome RDSClient::DescribeCertificates(const DescribeCertif
 
 DescribeCertificatesOutcomeCallable RDSClient::DescribeCertificatesCallable(const DescribeCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeCertificates, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeCertificates, Aws::Client::RejectedCallOutcome<DescribeCertificatesOutcome>(), this, request);
+}
+
+DescribeCertificatesOutcomeCallable RDSClient::DescribeCertificatesCallable(DescribeCertificatesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeCertificates, Aws::Client::RejectedCallOutcome<DescribeCertificatesOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeCertificatesAsync(const DescribeCertificatesRequest& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeCertificatesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeCertificatesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCertificatesOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeCertificatesAsync(DescribeCertificatesRequest&& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeCertificatesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCertificatesOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeCertificatesAsyncHelper(const DescribeCertificatesRequest& request, const DescribeCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1115,12 +1425,22 @@ DescribeDBClusterParameterGroupsOutcome RDSClient::DescribeDBClusterParameterGro
 
 DescribeDBClusterParameterGroupsOutcomeCallable RDSClient::DescribeDBClusterParameterGroupsCallable(const DescribeDBClusterParameterGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeDBClusterParameterGroups, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBClusterParameterGroups, Aws::Client::RejectedCallOutcome<DescribeDBClusterParameterGroupsOutcome>(), this, request);
+}
+
+DescribeDBClusterParameterGroupsOutcomeCallable RDSClient::DescribeDBClusterParameterGroupsCallable(DescribeDBClusterParameterGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBClusterParameterGroups, Aws::Client::RejectedCallOutcome<DescribeDBClusterParameterGroupsOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeDBClusterParameterGroupsAsync(const DescribeDBClusterParameterGroupsRequest& request, const DescribeDBClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeDBClusterParameterGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBClusterParameterGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBClusterParameterGroupsOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeDBClusterParameterGroupsAsync(DescribeDBClusterParameterGroupsRequest&& request, const DescribeDBClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBClusterParameterGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBClusterParameterGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeDBClusterParameterGroupsAsyncHelper(const DescribeDBClusterParameterGroupsRequest& request, const DescribeDBClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1145,12 +1465,22 @@ DescribeDBClusterParametersOutcome RDSClient::DescribeDBClusterParameters(const
 
 DescribeDBClusterParametersOutcomeCallable RDSClient::DescribeDBClusterParametersCallable(const DescribeDBClusterParametersRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeDBClusterParameters, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBClusterParameters, Aws::Client::RejectedCallOutcome<DescribeDBClusterParametersOutcome>(), this, request);
+}
+
+DescribeDBClusterParametersOutcomeCallable RDSClient::DescribeDBClusterParametersCallable(DescribeDBClusterParametersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBClusterParameters, Aws::Client::RejectedCallOutcome<DescribeDBClusterParametersOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeDBClusterParametersAsync(const DescribeDBClusterParametersRequest& request, const DescribeDBClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeDBClusterParametersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBClusterParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBClusterParametersOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeDBClusterParametersAsync(DescribeDBClusterParametersRequest&& request, const DescribeDBClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBClusterParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBClusterParametersOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeDBClusterParametersAsyncHelper(const DescribeDBClusterParametersRequest& request, const DescribeDBClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1175,12 +1505,22 @@ DescribeDBClusterSnapshotsOutcome RDSClient::DescribeDBClusterSnapshots(const De
 
 DescribeDBClusterSnapshotsOutcomeCallable RDSClient::DescribeDBClusterSnapshotsCallable(const DescribeDBClusterSnapshotsRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeDBClusterSnapshots, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBClusterSnapshots, Aws::Client::RejectedCallOutcome<DescribeDBClusterSnapshotsOutcome>(), this, request);
+}
+
+DescribeDBClusterSnapshotsOutcomeCallable RDSClient::DescribeDBClusterSnapshotsCallable(DescribeDBClusterSnapshotsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBClusterSnapshots, Aws::Client::RejectedCallOutcome<DescribeDBClusterSnapshotsOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeDBClusterSnapshotsAsync(const DescribeDBClusterSnapshotsRequest& request, const DescribeDBClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeDBClusterSnapshotsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBClusterSnapshotsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBClusterSnapshotsOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeDBClusterSnapshotsAsync(DescribeDBClusterSnapshotsRequest&& request, const DescribeDBClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBClusterSnapshotsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBClusterSnapshotsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeDBClusterSnapshotsAsyncHelper(const DescribeDBClusterSnapshotsRequest& request, const DescribeDBClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1205,12 +1545,22 @@ DescribeDBClustersOutcome RDSClient::DescribeDBClusters(const DescribeDBClusters
 
 DescribeDBClustersOutcomeCallable RDSClient::DescribeDBClustersCallable(const DescribeDBClustersRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeDBClusters, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBClusters, Aws::Client::RejectedCallOutcome<DescribeDBClustersOutcome>(), this, request);
+}
+
+DescribeDBClustersOutcomeCallable RDSClient::DescribeDBClustersCallable(DescribeDBClustersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBClusters, Aws::Client::RejectedCallOutcome<DescribeDBClustersOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeDBClustersAsync(const DescribeDBClustersRequest& request, const DescribeDBClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeDBClustersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBClustersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBClustersOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeDBClustersAsync(DescribeDBClustersRequest&& request, const DescribeDBClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBClustersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBClustersOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeDBClustersAsyncHelper(const DescribeDBClustersRequest& request, const DescribeDBClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1235,12 +1585,22 @@ DescribeDBEngineVersionsOutcome RDSClient::DescribeDBEngineVersions(const Descri
 
 DescribeDBEngineVersionsOutcomeCallable RDSClient::DescribeDBEngineVersionsCallable(const DescribeDBEngineVersionsRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeDBEngineVersions, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBEngineVersions, Aws::Client::RejectedCallOutcome<DescribeDBEngineVersionsOutcome>(), this, request);
+}
+
+DescribeDBEngineVersionsOutcomeCallable RDSClient::DescribeDBEngineVersionsCallable(DescribeDBEngineVersionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBEngineVersions, Aws::Client::RejectedCallOutcome<DescribeDBEngineVersionsOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeDBEngineVersionsAsync(const DescribeDBEngineVersionsRequest& request, const DescribeDBEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeDBEngineVersionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBEngineVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBEngineVersionsOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeDBEngineVersionsAsync(DescribeDBEngineVersionsRequest&& request, const DescribeDBEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBEngineVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBEngineVersionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeDBEngineVersionsAsyncHelper(const DescribeDBEngineVersionsRequest& request, const DescribeDBEngineVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1265,12 +1625,22 @@ DescribeDBInstancesOutcome RDSClient::DescribeDBInstances(const DescribeDBInstan
 
 DescribeDBInstancesOutcomeCallable RDSClient::DescribeDBInstancesCallable(const DescribeDBInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeDBInstances, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBInstances, Aws::Client::RejectedCallOutcome<DescribeDBInstancesOutcome>(), this, request);
+}
+
+DescribeDBInstancesOutcomeCallable RDSClient::DescribeDBInstancesCallable(DescribeDBInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBInstances, Aws::Client::RejectedCallOutcome<DescribeDBInstancesOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeDBInstancesAsync(const DescribeDBInstancesRequest& request, const DescribeDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeDBInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBInstancesOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeDBInstancesAsync(DescribeDBInstancesRequest&& request, const DescribeDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeDBInstancesAsyncHelper(const DescribeDBInstancesRequest& request, const DescribeDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1295,12 +1665,22 @@ DescribeDBLogFilesOutcome RDSClient::DescribeDBLogFiles(const DescribeDBLogFiles
 
 DescribeDBLogFilesOutcomeCallable RDSClient::DescribeDBLogFilesCallable(const DescribeDBLogFilesRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeDBLogFiles, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBLogFiles, Aws::Client::RejectedCallOutcome<DescribeDBLogFilesOutcome>(), this, request);
+}
+
+DescribeDBLogFilesOutcomeCallable RDSClient::DescribeDBLogFilesCallable(DescribeDBLogFilesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBLogFiles, Aws::Client::RejectedCallOutcome<DescribeDBLogFilesOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeDBLogFilesAsync(const DescribeDBLogFilesRequest& request, const DescribeDBLogFilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeDBLogFilesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBLogFilesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBLogFilesOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeDBLogFilesAsync(DescribeDBLogFilesRequest&& request, const DescribeDBLogFilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBLogFilesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBLogFilesOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeDBLogFilesAsyncHelper(const DescribeDBLogFilesRequest& request, const DescribeDBLogFilesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1325,12 +1705,22 @@ DescribeDBParameterGroupsOutcome RDSClient::DescribeDBParameterGroups(const Desc
 
 DescribeDBParameterGroupsOutcomeCallable RDSClient::DescribeDBParameterGroupsCallable(const DescribeDBParameterGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeDBParameterGroups, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBParameterGroups, Aws::Client::RejectedCallOutcome<DescribeDBParameterGroupsOutcome>(), this, request);
+}
+
+DescribeDBParameterGroupsOutcomeCallable RDSClient::DescribeDBParameterGroupsCallable(DescribeDBParameterGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBParameterGroups, Aws::Client::RejectedCallOutcome<DescribeDBParameterGroupsOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeDBParameterGroupsAsync(const DescribeDBParameterGroupsRequest& request, const DescribeDBParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeDBParameterGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBParameterGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBParameterGroupsOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeDBParameterGroupsAsync(DescribeDBParameterGroupsRequest&& request, const DescribeDBParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBParameterGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBParameterGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeDBParameterGroupsAsyncHelper(const DescribeDBParameterGroupsRequest& request, const DescribeDBParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1355,12 +1745,22 @@ DescribeDBParametersOutcome RDSClient::DescribeDBParameters(const DescribeDBPara
 
 DescribeDBParametersOutcomeCallable RDSClient::DescribeDBParametersCallable(const DescribeDBParametersRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeDBParameters, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBParameters, Aws::Client::RejectedCallOutcome<DescribeDBParametersOutcome>(), this, request);
+}
+
+DescribeDBParametersOutcomeCallable RDSClient::DescribeDBParametersCallable(DescribeDBParametersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBParameters, Aws::Client::RejectedCallOutcome<DescribeDBParametersOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeDBParametersAsync(const DescribeDBParametersRequest& request, const DescribeDBParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeDBParametersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBParametersOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeDBParametersAsync(DescribeDBParametersRequest&& request, const DescribeDBParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBParametersOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeDBParametersAsyncHelper(const DescribeDBParametersRequest& request, const DescribeDBParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1385,12 +1785,22 @@ DescribeDBSecurityGroupsOutcome RDSClient::DescribeDBSecurityGroups(const Descri
 
 DescribeDBSecurityGroupsOutcomeCallable RDSClient::DescribeDBSecurityGroupsCallable(const DescribeDBSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeDBSecurityGroups, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBSecurityGroups, Aws::Client::RejectedCallOutcome<DescribeDBSecurityGroupsOutcome>(), this, request);
+}
+
+DescribeDBSecurityGroupsOutcomeCallable RDSClient::DescribeDBSecurityGroupsCallable(DescribeDBSecurityGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBSecurityGroups, Aws::Client::RejectedCallOutcome<DescribeDBSecurityGroupsOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeDBSecurityGroupsAsync(const DescribeDBSecurityGroupsRequest& request, const DescribeDBSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeDBSecurityGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBSecurityGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBSecurityGroupsOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeDBSecurityGroupsAsync(DescribeDBSecurityGroupsRequest&& request, const DescribeDBSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBSecurityGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBSecurityGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeDBSecurityGroupsAsyncHelper(const DescribeDBSecurityGroupsRequest& request, const DescribeDBSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1415,12 +1825,22 @@ DescribeDBSnapshotAttributesOutcome RDSClient::DescribeDBSnapshotAttributes(cons
 
 DescribeDBSnapshotAttributesOutcomeCallable RDSClient::DescribeDBSnapshotAttributesCallable(const DescribeDBSnapshotAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeDBSnapshotAttributes, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBSnapshotAttributes, Aws::Client::RejectedCallOutcome<DescribeDBSnapshotAttributesOutcome>(), this, request);
+}
+
+DescribeDBSnapshotAttributesOutcomeCallable RDSClient::DescribeDBSnapshotAttributesCallable(DescribeDBSnapshotAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBSnapshotAttributes, Aws::Client::RejectedCallOutcome<DescribeDBSnapshotAttributesOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeDBSnapshotAttributesAsync(const DescribeDBSnapshotAttributesRequest& request, const DescribeDBSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeDBSnapshotAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBSnapshotAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBSnapshotAttributesOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeDBSnapshotAttributesAsync(DescribeDBSnapshotAttributesRequest&& request, const DescribeDBSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBSnapshotAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBSnapshotAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeDBSnapshotAttributesAsyncHelper(const DescribeDBSnapshotAttributesRequest& request, const DescribeDBSnapshotAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1445,12 +1865,22 @@ DescribeDBSnapshotsOutcome RDSClient::DescribeDBSnapshots(const DescribeDBSnapsh
 
 DescribeDBSnapshotsOutcomeCallable RDSClient::DescribeDBSnapshotsCallable(const DescribeDBSnapshotsRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeDBSnapshots, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBSnapshots, Aws::Client::RejectedCallOutcome<DescribeDBSnapshotsOutcome>(), this, request);
+}
+
+DescribeDBSnapshotsOutcomeCallable RDSClient::DescribeDBSnapshotsCallable(DescribeDBSnapshotsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBSnapshots, Aws::Client::RejectedCallOutcome<DescribeDBSnapshotsOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeDBSnapshotsAsync(const DescribeDBSnapshotsRequest& request, const DescribeDBSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeDBSnapshotsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBSnapshotsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBSnapshotsOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeDBSnapshotsAsync(DescribeDBSnapshotsRequest&& request, const DescribeDBSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBSnapshotsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBSnapshotsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeDBSnapshotsAsyncHelper(const DescribeDBSnapshotsRequest& request, const DescribeDBSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1475,12 +1905,22 @@ DescribeDBSubnetGroupsOutcome RDSClient::DescribeDBSubnetGroups(const DescribeDB
 
 DescribeDBSubnetGroupsOutcomeCallable RDSClient::DescribeDBSubnetGroupsCallable(const DescribeDBSubnetGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeDBSubnetGroups, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBSubnetGroups, Aws::Client::RejectedCallOutcome<DescribeDBSubnetGroupsOutcome>(), this, request);
+}
+
+DescribeDBSubnetGroupsOutcomeCallable RDSClient::DescribeDBSubnetGroupsCallable(DescribeDBSubnetGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeDBSubnetGroups, Aws::Client::RejectedCallOutcome<DescribeDBSubnetGroupsOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeDBSubnetGroupsAsync(const DescribeDBSubnetGroupsRequest& request, const DescribeDBSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeDBSubnetGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBSubnetGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBSubnetGroupsOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeDBSubnetGroupsAsync(DescribeDBSubnetGroupsRequest&& request, const DescribeDBSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeDBSubnetGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDBSubnetGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeDBSubnetGroupsAsyncHelper(const DescribeDBSubnetGroupsRequest& request, const DescribeDBSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1505,12 +1945,22 @@ DescribeEngineDefaultClusterParametersOutcome RDSClient::DescribeEngineDefaultCl
 
 DescribeEngineDefaultClusterParametersOutcomeCallable RDSClient::DescribeEngineDefaultClusterParametersCallable(const DescribeEngineDefaultClusterParametersRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeEngineDefaultClusterParameters, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeEngineDefaultClusterParameters, Aws::Client::RejectedCallOutcome<DescribeEngineDefaultClusterParametersOutcome>(), this, request);
+}
+
+DescribeEngineDefaultClusterParametersOutcomeCallable RDSClient::DescribeEngineDefaultClusterParametersCallable(DescribeEngineDefaultClusterParametersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeEngineDefaultClusterParameters, Aws::Client::RejectedCallOutcome<DescribeEngineDefaultClusterParametersOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeEngineDefaultClusterParametersAsync(const DescribeEngineDefaultClusterParametersRequest& request, const DescribeEngineDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeEngineDefaultClusterParametersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeEngineDefaultClusterParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEngineDefaultClusterParametersOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeEngineDefaultClusterParametersAsync(DescribeEngineDefaultClusterParametersRequest&& request, const DescribeEngineDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeEngineDefaultClusterParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEngineDefaultClusterParametersOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeEngineDefaultClusterParametersAsyncHelper(const DescribeEngineDefaultClusterParametersRequest& request, const DescribeEngineDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1535,12 +1985,22 @@ DescribeEngineDefaultParametersOutcome RDSClient::DescribeEngineDefaultParameter
 
 DescribeEngineDefaultParametersOutcomeCallable RDSClient::DescribeEngineDefaultParametersCallable(const DescribeEngineDefaultParametersRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeEngineDefaultParameters, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeEngineDefaultParameters, Aws::Client::RejectedCallOutcome<DescribeEngineDefaultParametersOutcome>(), this, request);
+}
+
+DescribeEngineDefaultParametersOutcomeCallable RDSClient::DescribeEngineDefaultParametersCallable(DescribeEngineDefaultParametersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeEngineDefaultParameters, Aws::Client::RejectedCallOutcome<DescribeEngineDefaultParametersOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeEngineDefaultParametersAsync(const DescribeEngineDefaultParametersRequest& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeEngineDefaultParametersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeEngineDefaultParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEngineDefaultParametersOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeEngineDefaultParametersAsync(DescribeEngineDefaultParametersRequest&& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeEngineDefaultParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEngineDefaultParametersOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeEngineDefaultParametersAsyncHelper(const DescribeEngineDefaultParametersRequest& request, const DescribeEngineDefaultParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1565,12 +2025,22 @@ DescribeEventCategoriesOutcome RDSClient::DescribeEventCategories(const Describe
 
 DescribeEventCategoriesOutcomeCallable RDSClient::DescribeEventCategoriesCallable(const DescribeEventCategoriesRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeEventCategories, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeEventCategories, Aws::Client::RejectedCallOutcome<DescribeEventCategoriesOutcome>(), this, request);
+}
+
+DescribeEventCategoriesOutcomeCallable RDSClient::DescribeEventCategoriesCallable(DescribeEventCategoriesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeEventCategories, Aws::Client::RejectedCallOutcome<DescribeEventCategoriesOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeEventCategoriesAsync(const DescribeEventCategoriesRequest& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeEventCategoriesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeEventCategoriesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventCategoriesOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeEventCategoriesAsync(DescribeEventCategoriesRequest&& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeEventCategoriesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventCategoriesOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeEventCategoriesAsyncHelper(const DescribeEventCategoriesRequest& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1595,12 +2065,22 @@ DescribeEventSubscriptionsOutcome RDSClient::DescribeEventSubscriptions(const De
 
 DescribeEventSubscriptionsOutcomeCallable RDSClient::DescribeEventSubscriptionsCallable(const DescribeEventSubscriptionsRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeEventSubscriptions, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeEventSubscriptions, Aws::Client::RejectedCallOutcome<DescribeEventSubscriptionsOutcome>(), this, request);
+}
+
+DescribeEventSubscriptionsOutcomeCallable RDSClient::DescribeEventSubscriptionsCallable(DescribeEventSubscriptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeEventSubscriptions, Aws::Client::RejectedCallOutcome<DescribeEventSubscriptionsOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeEventSubscriptionsAsync(const DescribeEventSubscriptionsRequest& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeEventSubscriptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeEventSubscriptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventSubscriptionsOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeEventSubscriptionsAsync(DescribeEventSubscriptionsRequest&& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeEventSubscriptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventSubscriptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeEventSubscriptionsAsyncHelper(const DescribeEventSubscriptionsRequest& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1625,12 +2105,22 @@ DescribeEventsOutcome RDSClient::DescribeEvents(const DescribeEventsRequest& req
 
 DescribeEventsOutcomeCallable RDSClient::DescribeEventsCallable(const DescribeEventsRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeEvents, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeEvents, Aws::Client::RejectedCallOutcome<DescribeEventsOutcome>(), this, request);
+}
+
+DescribeEventsOutcomeCallable RDSClient::DescribeEventsCallable(DescribeEventsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeEvents, Aws::Client::RejectedCallOutcome<DescribeEventsOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeEventsAsync(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeEventsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeEventsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventsOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeEventsAsync(DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeEventsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeEventsAsyncHelper(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1655,12 +2145,22 @@ DescribeOptionGroupOptionsOutcome RDSClient::DescribeOptionGroupOptions(const De
 
 DescribeOptionGroupOptionsOutcomeCallable RDSClient::DescribeOptionGroupOptionsCallable(const DescribeOptionGroupOptionsRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeOptionGroupOptions, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeOptionGroupOptions, Aws::Client::RejectedCallOutcome<DescribeOptionGroupOptionsOutcome>(), this, request);
+}
+
+DescribeOptionGroupOptionsOutcomeCallable RDSClient::DescribeOptionGroupOptionsCallable(DescribeOptionGroupOptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeOptionGroupOptions, Aws::Client::RejectedCallOutcome<DescribeOptionGroupOptionsOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeOptionGroupOptionsAsync(const DescribeOptionGroupOptionsRequest& request, const DescribeOptionGroupOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeOptionGroupOptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeOptionGroupOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeOptionGroupOptionsOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeOptionGroupOptionsAsync(DescribeOptionGroupOptionsRequest&& request, const DescribeOptionGroupOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeOptionGroupOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeOptionGroupOptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeOptionGroupOptionsAsyncHelper(const DescribeOptionGroupOptionsRequest& request, const DescribeOptionGroupOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1685,12 +2185,22 @@ DescribeOptionGroupsOutcome RDSClient::DescribeOptionGroups(const DescribeOption
 
 DescribeOptionGroupsOutcomeCallable RDSClient::DescribeOptionGroupsCallable(const DescribeOptionGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeOptionGroups, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeOptionGroups, Aws::Client::RejectedCallOutcome<DescribeOptionGroupsOutcome>(), this, request);
+}
+
+DescribeOptionGroupsOutcomeCallable RDSClient::DescribeOptionGroupsCallable(DescribeOptionGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeOptionGroups, Aws::Client::RejectedCallOutcome<DescribeOptionGroupsOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeOptionGroupsAsync(const DescribeOptionGroupsRequest& request, const DescribeOptionGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeOptionGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeOptionGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeOptionGroupsOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeOptionGroupsAsync(DescribeOptionGroupsRequest&& request, const DescribeOptionGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeOptionGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeOptionGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeOptionGroupsAsyncHelper(const DescribeOptionGroupsRequest& request, const DescribeOptionGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1715,12 +2225,22 @@ DescribeOrderableDBInstanceOptionsOutcome RDSClient::DescribeOrderableDBInstance
 
 DescribeOrderableDBInstanceOptionsOutcomeCallable RDSClient::DescribeOrderableDBInstanceOptionsCallable(const DescribeOrderableDBInstanceOptionsRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeOrderableDBInstanceOptions, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeOrderableDBInstanceOptions, Aws::Client::RejectedCallOutcome<DescribeOrderableDBInstanceOptionsOutcome>(), this, request);
+}
+
+DescribeOrderableDBInstanceOptionsOutcomeCallable RDSClient::DescribeOrderableDBInstanceOptionsCallable(DescribeOrderableDBInstanceOptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeOrderableDBInstanceOptions, Aws::Client::RejectedCallOutcome<DescribeOrderableDBInstanceOptionsOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeOrderableDBInstanceOptionsAsync(const DescribeOrderableDBInstanceOptionsRequest& request, const DescribeOrderableDBInstanceOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeOrderableDBInstanceOptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeOrderableDBInstanceOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeOrderableDBInstanceOptionsOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeOrderableDBInstanceOptionsAsync(DescribeOrderableDBInstanceOptionsRequest&& request, const DescribeOrderableDBInstanceOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeOrderableDBInstanceOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeOrderableDBInstanceOptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeOrderableDBInstanceOptionsAsyncHelper(const DescribeOrderableDBInstanceOptionsRequest& request, const DescribeOrderableDBInstanceOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1745,12 +2265,22 @@ DescribePendingMaintenanceActionsOutcome RDSClient::DescribePendingMaintenanceAc
 
 DescribePendingMaintenanceActionsOutcomeCallable RDSClient::DescribePendingMaintenanceActionsCallable(const DescribePendingMaintenanceActionsRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribePendingMaintenanceActions, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribePendingMaintenanceActions, Aws::Client::RejectedCallOutcome<DescribePendingMaintenanceActionsOutcome>(), this, request);
+}
+
+DescribePendingMaintenanceActionsOutcomeCallable RDSClient::DescribePendingMaintenanceActionsCallable(DescribePendingMaintenanceActionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribePendingMaintenanceActions, Aws::Client::RejectedCallOutcome<DescribePendingMaintenanceActionsOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribePendingMaintenanceActionsAsync(const DescribePendingMaintenanceActionsRequest& request, const DescribePendingMaintenanceActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribePendingMaintenanceActionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribePendingMaintenanceActionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribePendingMaintenanceActionsOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribePendingMaintenanceActionsAsync(DescribePendingMaintenanceActionsRequest&& request, const DescribePendingMaintenanceActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribePendingMaintenanceActionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribePendingMaintenanceActionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribePendingMaintenanceActionsAsyncHelper(const DescribePendingMaintenanceActionsRequest& request, const DescribePendingMaintenanceActionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1775,12 +2305,22 @@ DescribeReservedDBInstancesOutcome RDSClient::DescribeReservedDBInstances(const
 
 DescribeReservedDBInstancesOutcomeCallable RDSClient::DescribeReservedDBInstancesCallable(const DescribeReservedDBInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeReservedDBInstances, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeReservedDBInstances, Aws::Client::RejectedCallOutcome<DescribeReservedDBInstancesOutcome>(), this, request);
+}
+
+DescribeReservedDBInstancesOutcomeCallable RDSClient::DescribeReservedDBInstancesCallable(DescribeReservedDBInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeReservedDBInstances, Aws::Client::RejectedCallOutcome<DescribeReservedDBInstancesOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeReservedDBInstancesAsync(const DescribeReservedDBInstancesRequest& request, const DescribeReservedDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeReservedDBInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeReservedDBInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedDBInstancesOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeReservedDBInstancesAsync(DescribeReservedDBInstancesRequest&& request, const DescribeReservedDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeReservedDBInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedDBInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeReservedDBInstancesAsyncHelper(const DescribeReservedDBInstancesRequest& request, const DescribeReservedDBInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1805,12 +2345,22 @@ DescribeReservedDBInstancesOfferingsOutcome RDSClient::DescribeReservedDBInstanc
 
 DescribeReservedDBInstancesOfferingsOutcomeCallable RDSClient::DescribeReservedDBInstancesOfferingsCallable(const DescribeReservedDBInstancesOfferingsRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DescribeReservedDBInstancesOfferings, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeReservedDBInstancesOfferings, Aws::Client::RejectedCallOutcome<DescribeReservedDBInstancesOfferingsOutcome>(), this, request);
+}
+
+DescribeReservedDBInstancesOfferingsOutcomeCallable RDSClient::DescribeReservedDBInstancesOfferingsCallable(DescribeReservedDBInstancesOfferingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DescribeReservedDBInstancesOfferings, Aws::Client::RejectedCallOutcome<DescribeReservedDBInstancesOfferingsOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DescribeReservedDBInstancesOfferingsAsync(const DescribeReservedDBInstancesOfferingsRequest& request, const DescribeReservedDBInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DescribeReservedDBInstancesOfferingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DescribeReservedDBInstancesOfferingsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedDBInstancesOfferingsOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DescribeReservedDBInstancesOfferingsAsync(DescribeReservedDBInstancesOfferingsRequest&& request, const DescribeReservedDBInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DescribeReservedDBInstancesOfferingsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedDBInstancesOfferingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DescribeReservedDBInstancesOfferingsAsyncHelper(const DescribeReservedDBInstancesOfferingsRequest& request, const DescribeReservedDBInstancesOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1835,12 +2385,22 @@ DownloadDBLogFilePortionOutcome RDSClient::DownloadDBLogFilePortion(const Downlo
 
 DownloadDBLogFilePortionOutcomeCallable RDSClient::DownloadDBLogFilePortionCallable(const DownloadDBLogFilePortionRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::DownloadDBLogFilePortion, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::DownloadDBLogFilePortion, Aws::Client::RejectedCallOutcome<DownloadDBLogFilePortionOutcome>(), this, request);
+}
+
+DownloadDBLogFilePortionOutcomeCallable RDSClient::DownloadDBLogFilePortionCallable(DownloadDBLogFilePortionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::DownloadDBLogFilePortion, Aws::Client::RejectedCallOutcome<DownloadDBLogFilePortionOutcome>(), this, std::move(request));
 }
 
 void RDSClient::DownloadDBLogFilePortionAsync(const DownloadDBLogFilePortionRequest& request, const DownloadDBLogFilePortionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::DownloadDBLogFilePortionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::DownloadDBLogFilePortionAsyncHelper, Aws::Client::RejectedAsyncCall<DownloadDBLogFilePortionOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::DownloadDBLogFilePortionAsync(DownloadDBLogFilePortionRequest&& request, const DownloadDBLogFilePortionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::DownloadDBLogFilePortionAsyncHelper, Aws::Client::RejectedAsyncCall<DownloadDBLogFilePortionOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::DownloadDBLogFilePortionAsyncHelper(const DownloadDBLogFilePortionRequest& request, const DownloadDBLogFilePortionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1865,12 +2425,22 @@ FailoverDBClusterOutcome RDSClient::FailoverDBCluster(const FailoverDBClusterReq
 
 FailoverDBClusterOutcomeCallable RDSClient::FailoverDBClusterCallable(const FailoverDBClusterRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::FailoverDBCluster, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::FailoverDBCluster, Aws::Client::RejectedCallOutcome<FailoverDBClusterOutcome>(), this, request);
+}
+
+FailoverDBClusterOutcomeCallable RDSClient::FailoverDBClusterCallable(FailoverDBClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::FailoverDBCluster, Aws::Client::RejectedCallOutcome<FailoverDBClusterOutcome>(), this, std::move(request));
 }
 
 void RDSClient::FailoverDBClusterAsync(const FailoverDBClusterRequest& request, const FailoverDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::FailoverDBClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::FailoverDBClusterAsyncHelper, Aws::Client::RejectedAsyncCall<FailoverDBClusterOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::FailoverDBClusterAsync(FailoverDBClusterRequest&& request, const FailoverDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::FailoverDBClusterAsyncHelper, Aws::Client::RejectedAsyncCall<FailoverDBClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::FailoverDBClusterAsyncHelper(const FailoverDBClusterRequest& request, const FailoverDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1895,12 +2465,22 @@ ListTagsForResourceOutcome RDSClient::ListTagsForResource(const ListTagsForResou
 
 ListTagsForResourceOutcomeCallable RDSClient::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::ListTagsForResource, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::ListTagsForResource, Aws::Client::RejectedCallOutcome<ListTagsForResourceOutcome>(), this, request);
+}
+
+ListTagsForResourceOutcomeCallable RDSClient::ListTagsForResourceCallable(ListTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::ListTagsForResource, Aws::Client::RejectedCallOutcome<ListTagsForResourceOutcome>(), this, std::move(request));
 }
 
 void RDSClient::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::ListTagsForResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::ListTagsForResourceAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForResourceOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::ListTagsForResourceAsync(ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::ListTagsForResourceAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1925,12 +2505,22 @@ ModifyDBClusterOutcome RDSClient::ModifyDBCluster(const ModifyDBClusterRequest&
 
 ModifyDBClusterOutcomeCallable RDSClient::ModifyDBClusterCallable(const ModifyDBClusterRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::ModifyDBCluster, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyDBCluster, Aws::Client::RejectedCallOutcome<ModifyDBClusterOutcome>(), this, request);
+}
+
+ModifyDBClusterOutcomeCallable RDSClient::ModifyDBClusterCallable(ModifyDBClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyDBCluster, Aws::Client::RejectedCallOutcome<ModifyDBClusterOutcome>(), this, std::move(request));
 }
 
 void RDSClient::ModifyDBClusterAsync(const ModifyDBClusterRequest& request, const ModifyDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::ModifyDBClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::ModifyDBClusterAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyDBClusterOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::ModifyDBClusterAsync(ModifyDBClusterRequest&& request, const ModifyDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::ModifyDBClusterAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyDBClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::ModifyDBClusterAsyncHelper(const ModifyDBClusterRequest& request, const ModifyDBClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1955,12 +2545,22 @@ ModifyDBClusterParameterGroupOutcome RDSClient::ModifyDBClusterParameterGroup(co
 
 ModifyDBClusterParameterGroupOutcomeCallable RDSClient::ModifyDBClusterParameterGroupCallable(const ModifyDBClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::ModifyDBClusterParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyDBClusterParameterGroup, Aws::Client::RejectedCallOutcome<ModifyDBClusterParameterGroupOutcome>(), this, request);
+}
+
+ModifyDBClusterParameterGroupOutcomeCallable RDSClient::ModifyDBClusterParameterGroupCallable(ModifyDBClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyDBClusterParameterGroup, Aws::Client::RejectedCallOutcome<ModifyDBClusterParameterGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::ModifyDBClusterParameterGroupAsync(const ModifyDBClusterParameterGroupRequest& request, const ModifyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::ModifyDBClusterParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::ModifyDBClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyDBClusterParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::ModifyDBClusterParameterGroupAsync(ModifyDBClusterParameterGroupRequest&& request, const ModifyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::ModifyDBClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyDBClusterParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::ModifyDBClusterParameterGroupAsyncHelper(const ModifyDBClusterParameterGroupRequest& request, const ModifyDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1985,12 +2585,22 @@ ModifyDBInstanceOutcome RDSClient::ModifyDBInstance(const ModifyDBInstanceReques
 
 ModifyDBInstanceOutcomeCallable RDSClient::ModifyDBInstanceCallable(const ModifyDBInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::ModifyDBInstance, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyDBInstance, Aws::Client::RejectedCallOutcome<ModifyDBInstanceOutcome>(), this, request);
+}
+
+ModifyDBInstanceOutcomeCallable RDSClient::ModifyDBInstanceCallable(ModifyDBInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyDBInstance, Aws::Client::RejectedCallOutcome<ModifyDBInstanceOutcome>(), this, std::move(request));
 }
 
 void RDSClient::ModifyDBInstanceAsync(const ModifyDBInstanceRequest& request, const ModifyDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::ModifyDBInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::ModifyDBInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyDBInstanceOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::ModifyDBInstanceAsync(ModifyDBInstanceRequest&& request, const ModifyDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::ModifyDBInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyDBInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::ModifyDBInstanceAsyncHelper(const ModifyDBInstanceRequest& request, const ModifyDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2015,12 +2625,22 @@ ModifyDBParameterGroupOutcome RDSClient::ModifyDBParameterGroup(const ModifyDBPa
 
 ModifyDBParameterGroupOutcomeCallable RDSClient::ModifyDBParameterGroupCallable(const ModifyDBParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::ModifyDBParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyDBParameterGroup, Aws::Client::RejectedCallOutcome<ModifyDBParameterGroupOutcome>(), this, request);
+}
+
+ModifyDBParameterGroupOutcomeCallable RDSClient::ModifyDBParameterGroupCallable(ModifyDBParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyDBParameterGroup, Aws::Client::RejectedCallOutcome<ModifyDBParameterGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::ModifyDBParameterGroupAsync(const ModifyDBParameterGroupRequest& request, const ModifyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::ModifyDBParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::ModifyDBParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyDBParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::ModifyDBParameterGroupAsync(ModifyDBParameterGroupRequest&& request, const ModifyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::ModifyDBParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyDBParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::ModifyDBParameterGroupAsyncHelper(const ModifyDBParameterGroupRequest& request, const ModifyDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2045,12 +2665,22 @@ ModifyDBSnapshotAttributeOutcome RDSClient::ModifyDBSnapshotAttribute(const Modi
 
 ModifyDBSnapshotAttributeOutcomeCallable RDSClient::ModifyDBSnapshotAttributeCallable(const ModifyDBSnapshotAttributeRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::ModifyDBSnapshotAttribute, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyDBSnapshotAttribute, Aws::Client::RejectedCallOutcome<ModifyDBSnapshotAttributeOutcome>(), this, request);
+}
+
+ModifyDBSnapshotAttributeOutcomeCallable RDSClient::ModifyDBSnapshotAttributeCallable(ModifyDBSnapshotAttributeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyDBSnapshotAttribute, Aws::Client::RejectedCallOutcome<ModifyDBSnapshotAttributeOutcome>(), this, std::move(request));
 }
 
 void RDSClient::ModifyDBSnapshotAttributeAsync(const ModifyDBSnapshotAttributeRequest& request, const ModifyDBSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::ModifyDBSnapshotAttributeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::ModifyDBSnapshotAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyDBSnapshotAttributeOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::ModifyDBSnapshotAttributeAsync(ModifyDBSnapshotAttributeRequest&& request, const ModifyDBSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::ModifyDBSnapshotAttributeAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyDBSnapshotAttributeOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::ModifyDBSnapshotAttributeAsyncHelper(const ModifyDBSnapshotAttributeRequest& request, const ModifyDBSnapshotAttributeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2075,12 +2705,22 @@ ModifyDBSubnetGroupOutcome RDSClient::ModifyDBSubnetGroup(const ModifyDBSubnetGr
 
 ModifyDBSubnetGroupOutcomeCallable RDSClient::ModifyDBSubnetGroupCallable(const ModifyDBSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::ModifyDBSubnetGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyDBSubnetGroup, Aws::Client::RejectedCallOutcome<ModifyDBSubnetGroupOutcome>(), this, request);
+}
+
+ModifyDBSubnetGroupOutcomeCallable RDSClient::ModifyDBSubnetGroupCallable(ModifyDBSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyDBSubnetGroup, Aws::Client::RejectedCallOutcome<ModifyDBSubnetGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::ModifyDBSubnetGroupAsync(const ModifyDBSubnetGroupRequest& request, const ModifyDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::ModifyDBSubnetGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::ModifyDBSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyDBSubnetGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::ModifyDBSubnetGroupAsync(ModifyDBSubnetGroupRequest&& request, const ModifyDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::ModifyDBSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyDBSubnetGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::ModifyDBSubnetGroupAsyncHelper(const ModifyDBSubnetGroupRequest& request, const ModifyDBSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2105,12 +2745,22 @@ ModifyEventSubscriptionOutcome RDSClient::ModifyEventSubscription(const ModifyEv
 
 ModifyEventSubscriptionOutcomeCallable RDSClient::ModifyEventSubscriptionCallable(const ModifyEventSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::ModifyEventSubscription, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyEventSubscription, Aws::Client::RejectedCallOutcome<ModifyEventSubscriptionOutcome>(), this, request);
+}
+
+ModifyEventSubscriptionOutcomeCallable RDSClient::ModifyEventSubscriptionCallable(ModifyEventSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyEventSubscription, Aws::Client::RejectedCallOutcome<ModifyEventSubscriptionOutcome>(), this, std::move(request));
 }
 
 void RDSClient::ModifyEventSubscriptionAsync(const ModifyEventSubscriptionRequest& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::ModifyEventSubscriptionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::ModifyEventSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyEventSubscriptionOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::ModifyEventSubscriptionAsync(ModifyEventSubscriptionRequest&& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::ModifyEventSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyEventSubscriptionOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::ModifyEventSubscriptionAsyncHelper(const ModifyEventSubscriptionRequest& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2135,12 +2785,22 @@ ModifyOptionGroupOutcome RDSClient::ModifyOptionGroup(const ModifyOptionGroupReq
 
 ModifyOptionGroupOutcomeCallable RDSClient::ModifyOptionGroupCallable(const ModifyOptionGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::ModifyOptionGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyOptionGroup, Aws::Client::RejectedCallOutcome<ModifyOptionGroupOutcome>(), this, request);
+}
+
+ModifyOptionGroupOutcomeCallable RDSClient::ModifyOptionGroupCallable(ModifyOptionGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::ModifyOptionGroup, Aws::Client::RejectedCallOutcome<ModifyOptionGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::ModifyOptionGroupAsync(const ModifyOptionGroupRequest& request, const ModifyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::ModifyOptionGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::ModifyOptionGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyOptionGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::ModifyOptionGroupAsync(ModifyOptionGroupRequest&& request, const ModifyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::ModifyOptionGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyOptionGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::ModifyOptionGroupAsyncHelper(const ModifyOptionGroupRequest& request, const ModifyOptionGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2165,12 +2825,22 @@ PromoteReadReplicaOutcome RDSClient::PromoteReadReplica(const PromoteReadReplica
 
 PromoteReadReplicaOutcomeCallable RDSClient::PromoteReadReplicaCallable(const PromoteReadReplicaRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::PromoteReadReplica, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::PromoteReadReplica, Aws::Client::RejectedCallOutcome<PromoteReadReplicaOutcome>(), this, request);
+}
+
+PromoteReadReplicaOutcomeCallable RDSClient::PromoteReadReplicaCallable(PromoteReadReplicaRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::PromoteReadReplica, Aws::Client::RejectedCallOutcome<PromoteReadReplicaOutcome>(), this, std::move(request));
 }
 
 void RDSClient::PromoteReadReplicaAsync(const PromoteReadReplicaRequest& request, const PromoteReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::PromoteReadReplicaAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::PromoteReadReplicaAsyncHelper, Aws::Client::RejectedAsyncCall<PromoteReadReplicaOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::PromoteReadReplicaAsync(PromoteReadReplicaRequest&& request, const PromoteReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::PromoteReadReplicaAsyncHelper, Aws::Client::RejectedAsyncCall<PromoteReadReplicaOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::PromoteReadReplicaAsyncHelper(const PromoteReadReplicaRequest& request, const PromoteReadReplicaResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2195,12 +2865,22 @@ PurchaseReservedDBInstancesOfferingOutcome RDSClient::PurchaseReservedDBInstance
 
 PurchaseReservedDBInstancesOfferingOutcomeCallable RDSClient::PurchaseReservedDBInstancesOfferingCallable(const PurchaseReservedDBInstancesOfferingRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::PurchaseReservedDBInstancesOffering, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::PurchaseReservedDBInstancesOffering, Aws::Client::RejectedCallOutcome<PurchaseReservedDBInstancesOfferingOutcome>(), this, request);
+}
+
+PurchaseReservedDBInstancesOfferingOutcomeCallable RDSClient::PurchaseReservedDBInstancesOfferingCallable(PurchaseReservedDBInstancesOfferingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::PurchaseReservedDBInstancesOffering, Aws::Client::RejectedCallOutcome<PurchaseReservedDBInstancesOfferingOutcome>(), this, std::move(request));
 }
 
 void RDSClient::PurchaseReservedDBInstancesOfferingAsync(const PurchaseReservedDBInstancesOfferingRequest& request, const PurchaseReservedDBInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::PurchaseReservedDBInstancesOfferingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::PurchaseReservedDBInstancesOfferingAsyncHelper, Aws::Client::RejectedAsyncCall<PurchaseReservedDBInstancesOfferingOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::PurchaseReservedDBInstancesOfferingAsync(PurchaseReservedDBInstancesOfferingRequest&& request, const PurchaseReservedDBInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::PurchaseReservedDBInstancesOfferingAsyncHelper, Aws::Client::RejectedAsyncCall<PurchaseReservedDBInstancesOfferingOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::PurchaseReservedDBInstancesOfferingAsyncHelper(const PurchaseReservedDBInstancesOfferingRequest& request, const PurchaseReservedDBInstancesOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2225,12 +2905,22 @@ RebootDBInstanceOutcome RDSClient::RebootDBInstance(const RebootDBInstanceReques
 
 RebootDBInstanceOutcomeCallable RDSClient::RebootDBInstanceCallable(const RebootDBInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::RebootDBInstance, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::RebootDBInstance, Aws::Client::RejectedCallOutcome<RebootDBInstanceOutcome>(), this, request);
+}
+
+RebootDBInstanceOutcomeCallable RDSClient::RebootDBInstanceCallable(RebootDBInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::RebootDBInstance, Aws::Client::RejectedCallOutcome<RebootDBInstanceOutcome>(), this, std::move(request));
 }
 
 void RDSClient::RebootDBInstanceAsync(const RebootDBInstanceRequest& request, const RebootDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::RebootDBInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::RebootDBInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<RebootDBInstanceOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::RebootDBInstanceAsync(RebootDBInstanceRequest&& request, const RebootDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::RebootDBInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<RebootDBInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::RebootDBInstanceAsyncHelper(const RebootDBInstanceRequest& request, const RebootDBInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2255,12 +2945,22 @@ RemoveSourceIdentifierFromSubscriptionOutcome RDSClient::RemoveSourceIdentifierF
 
 RemoveSourceIdentifierFromSubscriptionOutcomeCallable RDSClient::RemoveSourceIdentifierFromSubscriptionCallable(const RemoveSourceIdentifierFromSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::RemoveSourceIdentifierFromSubscription, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::RemoveSourceIdentifierFromSubscription, Aws::Client::RejectedCallOutcome<RemoveSourceIdentifierFromSubscriptionOutcome>(), this, request);
+}
+
+RemoveSourceIdentifierFromSubscriptionOutcomeCallable RDSClient::RemoveSourceIdentifierFromSubscriptionCallable(RemoveSourceIdentifierFromSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::RemoveSourceIdentifierFromSubscription, Aws::Client::RejectedCallOutcome<RemoveSourceIdentifierFromSubscriptionOutcome>(), this, std::move(request));
 }
 
 void RDSClient::RemoveSourceIdentifierFromSubscriptionAsync(const RemoveSourceIdentifierFromSubscriptionRequest& request, const RemoveSourceIdentifierFromSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::RemoveSourceIdentifierFromSubscriptionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::RemoveSourceIdentifierFromSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveSourceIdentifierFromSubscriptionOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::RemoveSourceIdentifierFromSubscriptionAsync(RemoveSourceIdentifierFromSubscriptionRequest&& request, const RemoveSourceIdentifierFromSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::RemoveSourceIdentifierFromSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveSourceIdentifierFromSubscriptionOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::RemoveSourceIdentifierFromSubscriptionAsyncHelper(const RemoveSourceIdentifierFromSubscriptionRequest& request, const RemoveSourceIdentifierFromSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2285,12 +2985,22 @@ RemoveTagsFromResourceOutcome RDSClient::RemoveTagsFromResource(const RemoveTags
 
 RemoveTagsFromResourceOutcomeCallable RDSClient::RemoveTagsFromResourceCallable(const RemoveTagsFromResourceRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::RemoveTagsFromResource, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::RemoveTagsFromResource, Aws::Client::RejectedCallOutcome<RemoveTagsFromResourceOutcome>(), this, request);
+}
+
+RemoveTagsFromResourceOutcomeCallable RDSClient::RemoveTagsFromResourceCallable(RemoveTagsFromResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::RemoveTagsFromResource, Aws::Client::RejectedCallOutcome<RemoveTagsFromResourceOutcome>(), this, std::move(request));
 }
 
 void RDSClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::RemoveTagsFromResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::RemoveTagsFromResourceAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsFromResourceOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::RemoveTagsFromResourceAsync(RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::RemoveTagsFromResourceAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsFromResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::RemoveTagsFromResourceAsyncHelper(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2315,12 +3025,22 @@ ResetDBClusterParameterGroupOutcome RDSClient::ResetDBClusterParameterGroup(cons
 
 ResetDBClusterParameterGroupOutcomeCallable RDSClient::ResetDBClusterParameterGroupCallable(const ResetDBClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::ResetDBClusterParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::ResetDBClusterParameterGroup, Aws::Client::RejectedCallOutcome<ResetDBClusterParameterGroupOutcome>(), this, request);
+}
+
+ResetDBClusterParameterGroupOutcomeCallable RDSClient::ResetDBClusterParameterGroupCallable(ResetDBClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::ResetDBClusterParameterGroup, Aws::Client::RejectedCallOutcome<ResetDBClusterParameterGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::ResetDBClusterParameterGroupAsync(const ResetDBClusterParameterGroupRequest& request, const ResetDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::ResetDBClusterParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::ResetDBClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ResetDBClusterParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::ResetDBClusterParameterGroupAsync(ResetDBClusterParameterGroupRequest&& request, const ResetDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::ResetDBClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ResetDBClusterParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::ResetDBClusterParameterGroupAsyncHelper(const ResetDBClusterParameterGroupRequest& request, const ResetDBClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2345,12 +3065,22 @@ ResetDBParameterGroupOutcome RDSClient::ResetDBParameterGroup(const ResetDBParam
 
 ResetDBParameterGroupOutcomeCallable RDSClient::ResetDBParameterGroupCallable(const ResetDBParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::ResetDBParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::ResetDBParameterGroup, Aws::Client::RejectedCallOutcome<ResetDBParameterGroupOutcome>(), this, request);
+}
+
+ResetDBParameterGroupOutcomeCallable RDSClient::ResetDBParameterGroupCallable(ResetDBParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::ResetDBParameterGroup, Aws::Client::RejectedCallOutcome<ResetDBParameterGroupOutcome>(), this, std::move(request));
 }
 
 void RDSClient::ResetDBParameterGroupAsync(const ResetDBParameterGroupRequest& request, const ResetDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::ResetDBParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::ResetDBParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ResetDBParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::ResetDBParameterGroupAsync(ResetDBParameterGroupRequest&& request, const ResetDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::ResetDBParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ResetDBParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::ResetDBParameterGroupAsyncHelper(const ResetDBParameterGroupRequest& request, const ResetDBParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2375,12 +3105,22 @@ RestoreDBClusterFromSnapshotOutcome RDSClient::RestoreDBClusterFromSnapshot(cons
 
 RestoreDBClusterFromSnapshotOutcomeCallable RDSClient::RestoreDBClusterFromSnapshotCallable(const RestoreDBClusterFromSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::RestoreDBClusterFromSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::RestoreDBClusterFromSnapshot, Aws::Client::RejectedCallOutcome<RestoreDBClusterFromSnapshotOutcome>(), this, request);
+}
+
+RestoreDBClusterFromSnapshotOutcomeCallable RDSClient::RestoreDBClusterFromSnapshotCallable(RestoreDBClusterFromSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::RestoreDBClusterFromSnapshot, Aws::Client::RejectedCallOutcome<RestoreDBClusterFromSnapshotOutcome>(), this, std::move(request));
 }
 
 void RDSClient::RestoreDBClusterFromSnapshotAsync(const RestoreDBClusterFromSnapshotRequest& request, const RestoreDBClusterFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::RestoreDBClusterFromSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::RestoreDBClusterFromSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreDBClusterFromSnapshotOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::RestoreDBClusterFromSnapshotAsync(RestoreDBClusterFromSnapshotRequest&& request, const RestoreDBClusterFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::RestoreDBClusterFromSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreDBClusterFromSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::RestoreDBClusterFromSnapshotAsyncHelper(const RestoreDBClusterFromSnapshotRequest& request, const RestoreDBClusterFromSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2405,12 +3145,22 @@ RestoreDBClusterToPointInTimeOutcome RDSClient::RestoreDBClusterToPointInTime(co
 
 RestoreDBClusterToPointInTimeOutcomeCallable RDSClient::RestoreDBClusterToPointInTimeCallable(const RestoreDBClusterToPointInTimeRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::RestoreDBClusterToPointInTime, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::RestoreDBClusterToPointInTime, Aws::Client::RejectedCallOutcome<RestoreDBClusterToPointInTimeOutcome>(), this, request);
+}
+
+RestoreDBClusterToPointInTimeOutcomeCallable RDSClient::RestoreDBClusterToPointInTimeCallable(RestoreDBClusterToPointInTimeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::RestoreDBClusterToPointInTime, Aws::Client::RejectedCallOutcome<RestoreDBClusterToPointInTimeOutcome>(), this, std::move(request));
 }
 
 void RDSClient::RestoreDBClusterToPointInTimeAsync(const RestoreDBClusterToPointInTimeRequest& request, const RestoreDBClusterToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::RestoreDBClusterToPointInTimeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::RestoreDBClusterToPointInTimeAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreDBClusterToPointInTimeOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::RestoreDBClusterToPointInTimeAsync(RestoreDBClusterToPointInTimeRequest&& request, const RestoreDBClusterToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::RestoreDBClusterToPointInTimeAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreDBClusterToPointInTimeOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::RestoreDBClusterToPointInTimeAsyncHelper(const RestoreDBClusterToPointInTimeRequest& request, const RestoreDBClusterToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2435,12 +3185,22 @@ RestoreDBInstanceFromDBSnapshotOutcome RDSClient::RestoreDBInstanceFromDBSnapsho
 
 RestoreDBInstanceFromDBSnapshotOutcomeCallable RDSClient::RestoreDBInstanceFromDBSnapshotCallable(const RestoreDBInstanceFromDBSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::RestoreDBInstanceFromDBSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::RestoreDBInstanceFromDBSnapshot, Aws::Client::RejectedCallOutcome<RestoreDBInstanceFromDBSnapshotOutcome>(), this, request);
+}
+
+RestoreDBInstanceFromDBSnapshotOutcomeCallable RDSClient::RestoreDBInstanceFromDBSnapshotCallable(RestoreDBInstanceFromDBSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::RestoreDBInstanceFromDBSnapshot, Aws::Client::RejectedCallOutcome<RestoreDBInstanceFromDBSnapshotOutcome>(), this, std::move(request));
 }
 
 void RDSClient::RestoreDBInstanceFromDBSnapshotAsync(const RestoreDBInstanceFromDBSnapshotRequest& request, const RestoreDBInstanceFromDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::RestoreDBInstanceFromDBSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::RestoreDBInstanceFromDBSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreDBInstanceFromDBSnapshotOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::RestoreDBInstanceFromDBSnapshotAsync(RestoreDBInstanceFromDBSnapshotRequest&& request, const RestoreDBInstanceFromDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::RestoreDBInstanceFromDBSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreDBInstanceFromDBSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::RestoreDBInstanceFromDBSnapshotAsyncHelper(const RestoreDBInstanceFromDBSnapshotRequest& request, const RestoreDBInstanceFromDBSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2465,12 +3225,22 @@ RestoreDBInstanceToPointInTimeOutcome RDSClient::RestoreDBInstanceToPointInTime(
 
 RestoreDBInstanceToPointInTimeOutcomeCallable RDSClient::RestoreDBInstanceToPointInTimeCallable(const RestoreDBInstanceToPointInTimeRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::RestoreDBInstanceToPointInTime, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::RestoreDBInstanceToPointInTime, Aws::Client::RejectedCallOutcome<RestoreDBInstanceToPointInTimeOutcome>(), this, request);
+}
+
+RestoreDBInstanceToPointInTimeOutcomeCallable RDSClient::RestoreDBInstanceToPointInTimeCallable(RestoreDBInstanceToPointInTimeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::RestoreDBInstanceToPointInTime, Aws::Client::RejectedCallOutcome<RestoreDBInstanceToPointInTimeOutcome>(), this, std::move(request));
 }
 
 void RDSClient::RestoreDBInstanceToPointInTimeAsync(const RestoreDBInstanceToPointInTimeRequest& request, const RestoreDBInstanceToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::RestoreDBInstanceToPointInTimeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::RestoreDBInstanceToPointInTimeAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreDBInstanceToPointInTimeOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::RestoreDBInstanceToPointInTimeAsync(RestoreDBInstanceToPointInTimeRequest&& request, const RestoreDBInstanceToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::RestoreDBInstanceToPointInTimeAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreDBInstanceToPointInTimeOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::RestoreDBInstanceToPointInTimeAsyncHelper(const RestoreDBInstanceToPointInTimeRequest& request, const RestoreDBInstanceToPointInTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -2495,12 +3265,22 @@ RevokeDBSecurityGroupIngressOutcome RDSClient::RevokeDBSecurityGroupIngress(cons
 
 RevokeDBSecurityGroupIngressOutcomeCallable RDSClient::RevokeDBSecurityGroupIngressCallable(const RevokeDBSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, &RDSClient::RevokeDBSecurityGroupIngress, this, request);
+  return m_executor->SubmitWithFuture(&RDSClient::RevokeDBSecurityGroupIngress, Aws::Client::RejectedCallOutcome<RevokeDBSecurityGroupIngressOutcome>(), this, request);
+}
+
+RevokeDBSecurityGroupIngressOutcomeCallable RDSClient::RevokeDBSecurityGroupIngressCallable(RevokeDBSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RDSClient::RevokeDBSecurityGroupIngress, Aws::Client::RejectedCallOutcome<RevokeDBSecurityGroupIngressOutcome>(), this, std::move(request));
 }
 
 void RDSClient::RevokeDBSecurityGroupIngressAsync(const RevokeDBSecurityGroupIngressRequest& request, const RevokeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RDSClient::RevokeDBSecurityGroupIngressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RDSClient::RevokeDBSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<RevokeDBSecurityGroupIngressOutcome>(), this, request, handler, context);
+}
+
+void RDSClient::RevokeDBSecurityGroupIngressAsync(RevokeDBSecurityGroupIngressRequest&& request, const RevokeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RDSClient::RevokeDBSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<RevokeDBSecurityGroupIngressOutcome>(), this, std::move(request), handler, context);
 }
 
 void RDSClient::RevokeDBSecurityGroupIngressAsyncHelper(const RevokeDBSecurityGroupIngressRequest& request, const RevokeDBSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
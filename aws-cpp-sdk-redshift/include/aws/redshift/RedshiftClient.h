@@ -75,6 +75,71 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/redshift/model/AuthorizeClusterSecurityGroupIngressRequest.h>
+#include <aws/redshift/model/AuthorizeSnapshotAccessRequest.h>
+#include <aws/redshift/model/CopyClusterSnapshotRequest.h>
+#include <aws/redshift/model/CreateClusterRequest.h>
+#include <aws/redshift/model/CreateClusterParameterGroupRequest.h>
+#include <aws/redshift/model/CreateClusterSecurityGroupRequest.h>
+#include <aws/redshift/model/CreateClusterSnapshotRequest.h>
+#include <aws/redshift/model/CreateClusterSubnetGroupRequest.h>
+#include <aws/redshift/model/CreateEventSubscriptionRequest.h>
+#include <aws/redshift/model/CreateHsmClientCertificateRequest.h>
+#include <aws/redshift/model/CreateHsmConfigurationRequest.h>
+#include <aws/redshift/model/CreateSnapshotCopyGrantRequest.h>
+#include <aws/redshift/model/CreateTagsRequest.h>
+#include <aws/redshift/model/DeleteClusterRequest.h>
+#include <aws/redshift/model/DeleteClusterParameterGroupRequest.h>
+#include <aws/redshift/model/DeleteClusterSecurityGroupRequest.h>
+#include <aws/redshift/model/DeleteClusterSnapshotRequest.h>
+#include <aws/redshift/model/DeleteClusterSubnetGroupRequest.h>
+#include <aws/redshift/model/DeleteEventSubscriptionRequest.h>
+#include <aws/redshift/model/DeleteHsmClientCertificateRequest.h>
+#include <aws/redshift/model/DeleteHsmConfigurationRequest.h>
+#include <aws/redshift/model/DeleteSnapshotCopyGrantRequest.h>
+#include <aws/redshift/model/DeleteTagsRequest.h>
+#include <aws/redshift/model/DescribeClusterParameterGroupsRequest.h>
+#include <aws/redshift/model/DescribeClusterParametersRequest.h>
+#include <aws/redshift/model/DescribeClusterSecurityGroupsRequest.h>
+#include <aws/redshift/model/DescribeClusterSnapshotsRequest.h>
+#include <aws/redshift/model/DescribeClusterSubnetGroupsRequest.h>
+#include <aws/redshift/model/DescribeClusterVersionsRequest.h>
+#include <aws/redshift/model/DescribeClustersRequest.h>
+#include <aws/redshift/model/DescribeDefaultClusterParametersRequest.h>
+#include <aws/redshift/model/DescribeEventCategoriesRequest.h>
+#include <aws/redshift/model/DescribeEventSubscriptionsRequest.h>
+#include <aws/redshift/model/DescribeEventsRequest.h>
+#include <aws/redshift/model/DescribeHsmClientCertificatesRequest.h>
+#include <aws/redshift/model/DescribeHsmConfigurationsRequest.h>
+#include <aws/redshift/model/DescribeLoggingStatusRequest.h>
+#include <aws/redshift/model/DescribeOrderableClusterOptionsRequest.h>
+#include <aws/redshift/model/DescribeReservedNodeOfferingsRequest.h>
+#include <aws/redshift/model/DescribeReservedNodesRequest.h>
+#include <aws/redshift/model/DescribeResizeRequest.h>
+#include <aws/redshift/model/DescribeSnapshotCopyGrantsRequest.h>
+#include <aws/redshift/model/DescribeTableRestoreStatusRequest.h>
+#include <aws/redshift/model/DescribeTagsRequest.h>
+#include <aws/redshift/model/DisableLoggingRequest.h>
+#include <aws/redshift/model/DisableSnapshotCopyRequest.h>
+#include <aws/redshift/model/EnableLoggingRequest.h>
+#include <aws/redshift/model/EnableSnapshotCopyRequest.h>
+#include <aws/redshift/model/ModifyClusterRequest.h>
+#include <aws/redshift/model/ModifyClusterParameterGroupRequest.h>
+#include <aws/redshift/model/ModifyClusterSubnetGroupRequest.h>
+#include <aws/redshift/model/ModifyEventSubscriptionRequest.h>
+#include <aws/redshift/model/ModifySnapshotCopyRetentionPeriodRequest.h>
+#include <aws/redshift/model/PurchaseReservedNodeOfferingRequest.h>
+#include <aws/redshift/model/RebootClusterRequest.h>
+#include <aws/redshift/model/ResetClusterParameterGroupRequest.h>
+#include <aws/redshift/model/RestoreFromClusterSnapshotRequest.h>
+#include <aws/redshift/model/RestoreTableFromClusterSnapshotRequest.h>
+#include <aws/redshift/model/RevokeClusterSecurityGroupIngressRequest.h>
+#include <aws/redshift/model/RevokeSnapshotAccessRequest.h>
+#include <aws/redshift/model/RotateEncryptionKeyRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -468,6 +533,11 @@ namespace Model
          */
         virtual Model::AuthorizeClusterSecurityGroupIngressOutcomeCallable AuthorizeClusterSecurityGroupIngressCallable(const Model::AuthorizeClusterSecurityGroupIngressRequest& request) const;
 
+        /**
+         * Same as AuthorizeClusterSecurityGroupIngressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AuthorizeClusterSecurityGroupIngressOutcomeCallable AuthorizeClusterSecurityGroupIngressCallable(Model::AuthorizeClusterSecurityGroupIngressRequest&& request) const;
+
         /**
          * <p> Adds an inbound (ingress) rule to an Amazon Redshift security group.
          * Depending on whether the application accessing your cluster is running on the
@@ -493,6 +563,11 @@ namespace Model
          */
         virtual void AuthorizeClusterSecurityGroupIngressAsync(const Model::AuthorizeClusterSecurityGroupIngressRequest& request, const AuthorizeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AuthorizeClusterSecurityGroupIngressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AuthorizeClusterSecurityGroupIngressAsync(Model::AuthorizeClusterSecurityGroupIngressRequest&& request, const AuthorizeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Authorizes the specified AWS customer account to restore the specified
          * snapshot. </p> <p> For more information about working with snapshots, go to <a
@@ -513,6 +588,11 @@ namespace Model
          */
         virtual Model::AuthorizeSnapshotAccessOutcomeCallable AuthorizeSnapshotAccessCallable(const Model::AuthorizeSnapshotAccessRequest& request) const;
 
+        /**
+         * Same as AuthorizeSnapshotAccessCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AuthorizeSnapshotAccessOutcomeCallable AuthorizeSnapshotAccessCallable(Model::AuthorizeSnapshotAccessRequest&& request) const;
+
         /**
          * <p> Authorizes the specified AWS customer account to restore the specified
          * snapshot. </p> <p> For more information about working with snapshots, go to <a
@@ -524,6 +604,11 @@ namespace Model
          */
         virtual void AuthorizeSnapshotAccessAsync(const Model::AuthorizeSnapshotAccessRequest& request, const AuthorizeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AuthorizeSnapshotAccessAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AuthorizeSnapshotAccessAsync(Model::AuthorizeSnapshotAccessRequest&& request, const AuthorizeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Copies the specified automated cluster snapshot to a new manual cluster
          * snapshot. The source must be an automated snapshot and it must be in the
@@ -556,6 +641,11 @@ namespace Model
          */
         virtual Model::CopyClusterSnapshotOutcomeCallable CopyClusterSnapshotCallable(const Model::CopyClusterSnapshotRequest& request) const;
 
+        /**
+         * Same as CopyClusterSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CopyClusterSnapshotOutcomeCallable CopyClusterSnapshotCallable(Model::CopyClusterSnapshotRequest&& request) const;
+
         /**
          * <p> Copies the specified automated cluster snapshot to a new manual cluster
          * snapshot. The source must be an automated snapshot and it must be in the
@@ -573,6 +663,11 @@ namespace Model
          */
         virtual void CopyClusterSnapshotAsync(const Model::CopyClusterSnapshotRequest& request, const CopyClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyClusterSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CopyClusterSnapshotAsync(Model::CopyClusterSnapshotRequest&& request, const CopyClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new cluster. To create the cluster in virtual private cloud (VPC),
          * you must provide cluster subnet group name. If you don't provide a cluster
@@ -599,6 +694,11 @@ namespace Model
          */
         virtual Model::CreateClusterOutcomeCallable CreateClusterCallable(const Model::CreateClusterRequest& request) const;
 
+        /**
+         * Same as CreateClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateClusterOutcomeCallable CreateClusterCallable(Model::CreateClusterRequest&& request) const;
+
         /**
          * <p> Creates a new cluster. To create the cluster in virtual private cloud (VPC),
          * you must provide cluster subnet group name. If you don't provide a cluster
@@ -613,6 +713,11 @@ namespace Model
          */
         virtual void CreateClusterAsync(const Model::CreateClusterRequest& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateClusterAsync(Model::CreateClusterRequest&& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates an Amazon Redshift parameter group. </p> <p>Creating parameter
          * groups is independent of creating clusters. You can associate a cluster with a
@@ -643,6 +748,11 @@ namespace Model
          */
         virtual Model::CreateClusterParameterGroupOutcomeCallable CreateClusterParameterGroupCallable(const Model::CreateClusterParameterGroupRequest& request) const;
 
+        /**
+         * Same as CreateClusterParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateClusterParameterGroupOutcomeCallable CreateClusterParameterGroupCallable(Model::CreateClusterParameterGroupRequest&& request) const;
+
         /**
          * <p> Creates an Amazon Redshift parameter group. </p> <p>Creating parameter
          * groups is independent of creating clusters. You can associate a cluster with a
@@ -659,6 +769,11 @@ namespace Model
          */
         virtual void CreateClusterParameterGroupAsync(const Model::CreateClusterParameterGroupRequest& request, const CreateClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateClusterParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateClusterParameterGroupAsync(Model::CreateClusterParameterGroupRequest&& request, const CreateClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new Amazon Redshift security group. You use security groups to
          * control access to non-VPC clusters. </p> <p> For information about managing
@@ -681,6 +796,11 @@ namespace Model
          */
         virtual Model::CreateClusterSecurityGroupOutcomeCallable CreateClusterSecurityGroupCallable(const Model::CreateClusterSecurityGroupRequest& request) const;
 
+        /**
+         * Same as CreateClusterSecurityGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateClusterSecurityGroupOutcomeCallable CreateClusterSecurityGroupCallable(Model::CreateClusterSecurityGroupRequest&& request) const;
+
         /**
          * <p> Creates a new Amazon Redshift security group. You use security groups to
          * control access to non-VPC clusters. </p> <p> For information about managing
@@ -693,6 +813,11 @@ namespace Model
          */
         virtual void CreateClusterSecurityGroupAsync(const Model::CreateClusterSecurityGroupRequest& request, const CreateClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateClusterSecurityGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateClusterSecurityGroupAsync(Model::CreateClusterSecurityGroupRequest&& request, const CreateClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a manual snapshot of the specified cluster. The cluster must be in
          * the <code>available</code> state. </p> <p> For more information about working
@@ -715,6 +840,11 @@ namespace Model
          */
         virtual Model::CreateClusterSnapshotOutcomeCallable CreateClusterSnapshotCallable(const Model::CreateClusterSnapshotRequest& request) const;
 
+        /**
+         * Same as CreateClusterSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateClusterSnapshotOutcomeCallable CreateClusterSnapshotCallable(Model::CreateClusterSnapshotRequest&& request) const;
+
         /**
          * <p> Creates a manual snapshot of the specified cluster. The cluster must be in
          * the <code>available</code> state. </p> <p> For more information about working
@@ -727,6 +857,11 @@ namespace Model
          */
         virtual void CreateClusterSnapshotAsync(const Model::CreateClusterSnapshotRequest& request, const CreateClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateClusterSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateClusterSnapshotAsync(Model::CreateClusterSnapshotRequest&& request, const CreateClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new Amazon Redshift subnet group. You must provide a list of one
          * or more subnets in your existing Amazon Virtual Private Cloud (Amazon VPC) when
@@ -751,6 +886,11 @@ namespace Model
          */
         virtual Model::CreateClusterSubnetGroupOutcomeCallable CreateClusterSubnetGroupCallable(const Model::CreateClusterSubnetGroupRequest& request) const;
 
+        /**
+         * Same as CreateClusterSubnetGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateClusterSubnetGroupOutcomeCallable CreateClusterSubnetGroupCallable(Model::CreateClusterSubnetGroupRequest&& request) const;
+
         /**
          * <p> Creates a new Amazon Redshift subnet group. You must provide a list of one
          * or more subnets in your existing Amazon Virtual Private Cloud (Amazon VPC) when
@@ -764,6 +904,11 @@ namespace Model
          */
         virtual void CreateClusterSubnetGroupAsync(const Model::CreateClusterSubnetGroupRequest& request, const CreateClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateClusterSubnetGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateClusterSubnetGroupAsync(Model::CreateClusterSubnetGroupRequest&& request, const CreateClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates an Amazon Redshift event notification subscription. This action
          * requires an ARN (Amazon Resource Name) of an Amazon SNS topic created by either
@@ -812,6 +957,11 @@ namespace Model
          */
         virtual Model::CreateEventSubscriptionOutcomeCallable CreateEventSubscriptionCallable(const Model::CreateEventSubscriptionRequest& request) const;
 
+        /**
+         * Same as CreateEventSubscriptionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateEventSubscriptionOutcomeCallable CreateEventSubscriptionCallable(Model::CreateEventSubscriptionRequest&& request) const;
+
         /**
          * <p> Creates an Amazon Redshift event notification subscription. This action
          * requires an ARN (Amazon Resource Name) of an Amazon SNS topic created by either
@@ -837,6 +987,11 @@ namespace Model
          */
         virtual void CreateEventSubscriptionAsync(const Model::CreateEventSubscriptionRequest& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateEventSubscriptionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateEventSubscriptionAsync(Model::CreateEventSubscriptionRequest&& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an HSM client certificate that an Amazon Redshift cluster will use to
          * connect to the client's HSM in order to store and retrieve the keys used to
@@ -865,6 +1020,11 @@ namespace Model
          */
         virtual Model::CreateHsmClientCertificateOutcomeCallable CreateHsmClientCertificateCallable(const Model::CreateHsmClientCertificateRequest& request) const;
 
+        /**
+         * Same as CreateHsmClientCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateHsmClientCertificateOutcomeCallable CreateHsmClientCertificateCallable(Model::CreateHsmClientCertificateRequest&& request) const;
+
         /**
          * <p>Creates an HSM client certificate that an Amazon Redshift cluster will use to
          * connect to the client's HSM in order to store and retrieve the keys used to
@@ -880,6 +1040,11 @@ namespace Model
          */
         virtual void CreateHsmClientCertificateAsync(const Model::CreateHsmClientCertificateRequest& request, const CreateHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateHsmClientCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateHsmClientCertificateAsync(Model::CreateHsmClientCertificateRequest&& request, const CreateHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an HSM configuration that contains the information required by an
          * Amazon Redshift cluster to store and use database encryption keys in a Hardware
@@ -906,6 +1071,11 @@ namespace Model
          */
         virtual Model::CreateHsmConfigurationOutcomeCallable CreateHsmConfigurationCallable(const Model::CreateHsmConfigurationRequest& request) const;
 
+        /**
+         * Same as CreateHsmConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateHsmConfigurationOutcomeCallable CreateHsmConfigurationCallable(Model::CreateHsmConfigurationRequest&& request) const;
+
         /**
          * <p>Creates an HSM configuration that contains the information required by an
          * Amazon Redshift cluster to store and use database encryption keys in a Hardware
@@ -920,6 +1090,11 @@ namespace Model
          */
         virtual void CreateHsmConfigurationAsync(const Model::CreateHsmConfigurationRequest& request, const CreateHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateHsmConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateHsmConfigurationAsync(Model::CreateHsmConfigurationRequest&& request, const CreateHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a snapshot copy grant that permits Amazon Redshift to use a customer
          * master key (CMK) from AWS Key Management Service (AWS KMS) to encrypt copied
@@ -944,6 +1119,11 @@ namespace Model
          */
         virtual Model::CreateSnapshotCopyGrantOutcomeCallable CreateSnapshotCopyGrantCallable(const Model::CreateSnapshotCopyGrantRequest& request) const;
 
+        /**
+         * Same as CreateSnapshotCopyGrantCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateSnapshotCopyGrantOutcomeCallable CreateSnapshotCopyGrantCallable(Model::CreateSnapshotCopyGrantRequest&& request) const;
+
         /**
          * <p>Creates a snapshot copy grant that permits Amazon Redshift to use a customer
          * master key (CMK) from AWS Key Management Service (AWS KMS) to encrypt copied
@@ -957,6 +1137,11 @@ namespace Model
          */
         virtual void CreateSnapshotCopyGrantAsync(const Model::CreateSnapshotCopyGrantRequest& request, const CreateSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSnapshotCopyGrantAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateSnapshotCopyGrantAsync(Model::CreateSnapshotCopyGrantRequest&& request, const CreateSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Adds one or more tags to a specified resource. </p> <p> A resource can have
          * up to 10 tags. If you try to create more than 10 tags for a resource, you will
@@ -977,6 +1162,11 @@ namespace Model
          */
         virtual Model::CreateTagsOutcomeCallable CreateTagsCallable(const Model::CreateTagsRequest& request) const;
 
+        /**
+         * Same as CreateTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateTagsOutcomeCallable CreateTagsCallable(Model::CreateTagsRequest&& request) const;
+
         /**
          * <p> Adds one or more tags to a specified resource. </p> <p> A resource can have
          * up to 10 tags. If you try to create more than 10 tags for a resource, you will
@@ -988,6 +1178,11 @@ namespace Model
          */
         virtual void CreateTagsAsync(const Model::CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateTagsAsync(Model::CreateTagsRequest&& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a previously provisioned cluster. A successful response from the web
          * service indicates that the request was received correctly. Use
@@ -1032,6 +1227,11 @@ namespace Model
          */
         virtual Model::DeleteClusterOutcomeCallable DeleteClusterCallable(const Model::DeleteClusterRequest& request) const;
 
+        /**
+         * Same as DeleteClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteClusterOutcomeCallable DeleteClusterCallable(Model::DeleteClusterRequest&& request) const;
+
         /**
          * <p> Deletes a previously provisioned cluster. A successful response from the web
          * service indicates that the request was received correctly. Use
@@ -1055,6 +1255,11 @@ namespace Model
          */
         virtual void DeleteClusterAsync(const Model::DeleteClusterRequest& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteClusterAsync(Model::DeleteClusterRequest&& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a specified Amazon Redshift parameter group. <note>You cannot delete
          * a parameter group if it is associated with a cluster.</note> </p>
@@ -1069,6 +1274,11 @@ namespace Model
          */
         virtual Model::DeleteClusterParameterGroupOutcomeCallable DeleteClusterParameterGroupCallable(const Model::DeleteClusterParameterGroupRequest& request) const;
 
+        /**
+         * Same as DeleteClusterParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteClusterParameterGroupOutcomeCallable DeleteClusterParameterGroupCallable(Model::DeleteClusterParameterGroupRequest&& request) const;
+
         /**
          * <p> Deletes a specified Amazon Redshift parameter group. <note>You cannot delete
          * a parameter group if it is associated with a cluster.</note> </p>
@@ -1077,6 +1287,11 @@ namespace Model
          */
         virtual void DeleteClusterParameterGroupAsync(const Model::DeleteClusterParameterGroupRequest& request, const DeleteClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteClusterParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteClusterParameterGroupAsync(Model::DeleteClusterParameterGroupRequest&& request, const DeleteClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes an Amazon Redshift security group. </p> <note>You cannot delete a
          * security group that is associated with any clusters. You cannot delete the
@@ -1101,6 +1316,11 @@ namespace Model
          */
         virtual Model::DeleteClusterSecurityGroupOutcomeCallable DeleteClusterSecurityGroupCallable(const Model::DeleteClusterSecurityGroupRequest& request) const;
 
+        /**
+         * Same as DeleteClusterSecurityGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteClusterSecurityGroupOutcomeCallable DeleteClusterSecurityGroupCallable(Model::DeleteClusterSecurityGroupRequest&& request) const;
+
         /**
          * <p> Deletes an Amazon Redshift security group. </p> <note>You cannot delete a
          * security group that is associated with any clusters. You cannot delete the
@@ -1114,6 +1334,11 @@ namespace Model
          */
         virtual void DeleteClusterSecurityGroupAsync(const Model::DeleteClusterSecurityGroupRequest& request, const DeleteClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteClusterSecurityGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteClusterSecurityGroupAsync(Model::DeleteClusterSecurityGroupRequest&& request, const DeleteClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the specified manual snapshot. The snapshot must be in the
          * <code>available</code> state, with no other users authorized to access the
@@ -1138,6 +1363,11 @@ namespace Model
          */
         virtual Model::DeleteClusterSnapshotOutcomeCallable DeleteClusterSnapshotCallable(const Model::DeleteClusterSnapshotRequest& request) const;
 
+        /**
+         * Same as DeleteClusterSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteClusterSnapshotOutcomeCallable DeleteClusterSnapshotCallable(Model::DeleteClusterSnapshotRequest&& request) const;
+
         /**
          * <p> Deletes the specified manual snapshot. The snapshot must be in the
          * <code>available</code> state, with no other users authorized to access the
@@ -1151,6 +1381,11 @@ namespace Model
          */
         virtual void DeleteClusterSnapshotAsync(const Model::DeleteClusterSnapshotRequest& request, const DeleteClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteClusterSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteClusterSnapshotAsync(Model::DeleteClusterSnapshotRequest&& request, const DeleteClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the specified cluster subnet group. </p>
          */
@@ -1163,6 +1398,11 @@ namespace Model
          */
         virtual Model::DeleteClusterSubnetGroupOutcomeCallable DeleteClusterSubnetGroupCallable(const Model::DeleteClusterSubnetGroupRequest& request) const;
 
+        /**
+         * Same as DeleteClusterSubnetGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteClusterSubnetGroupOutcomeCallable DeleteClusterSubnetGroupCallable(Model::DeleteClusterSubnetGroupRequest&& request) const;
+
         /**
          * <p> Deletes the specified cluster subnet group. </p>
          *
@@ -1170,6 +1410,11 @@ namespace Model
          */
         virtual void DeleteClusterSubnetGroupAsync(const Model::DeleteClusterSubnetGroupRequest& request, const DeleteClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteClusterSubnetGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteClusterSubnetGroupAsync(Model::DeleteClusterSubnetGroupRequest&& request, const DeleteClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes an Amazon Redshift event notification subscription. </p>
          */
@@ -1182,6 +1427,11 @@ namespace Model
          */
         virtual Model::DeleteEventSubscriptionOutcomeCallable DeleteEventSubscriptionCallable(const Model::DeleteEventSubscriptionRequest& request) const;
 
+        /**
+         * Same as DeleteEventSubscriptionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteEventSubscriptionOutcomeCallable DeleteEventSubscriptionCallable(Model::DeleteEventSubscriptionRequest&& request) const;
+
         /**
          * <p> Deletes an Amazon Redshift event notification subscription. </p>
          *
@@ -1189,6 +1439,11 @@ namespace Model
          */
         virtual void DeleteEventSubscriptionAsync(const Model::DeleteEventSubscriptionRequest& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteEventSubscriptionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteEventSubscriptionAsync(Model::DeleteEventSubscriptionRequest&& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified HSM client certificate.</p>
          */
@@ -1201,6 +1456,11 @@ namespace Model
          */
         virtual Model::DeleteHsmClientCertificateOutcomeCallable DeleteHsmClientCertificateCallable(const Model::DeleteHsmClientCertificateRequest& request) const;
 
+        /**
+         * Same as DeleteHsmClientCertificateCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteHsmClientCertificateOutcomeCallable DeleteHsmClientCertificateCallable(Model::DeleteHsmClientCertificateRequest&& request) const;
+
         /**
          * <p>Deletes the specified HSM client certificate.</p>
          *
@@ -1208,6 +1468,11 @@ namespace Model
          */
         virtual void DeleteHsmClientCertificateAsync(const Model::DeleteHsmClientCertificateRequest& request, const DeleteHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteHsmClientCertificateAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteHsmClientCertificateAsync(Model::DeleteHsmClientCertificateRequest&& request, const DeleteHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified Amazon Redshift HSM configuration.</p>
          */
@@ -1220,6 +1485,11 @@ namespace Model
          */
         virtual Model::DeleteHsmConfigurationOutcomeCallable DeleteHsmConfigurationCallable(const Model::DeleteHsmConfigurationRequest& request) const;
 
+        /**
+         * Same as DeleteHsmConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteHsmConfigurationOutcomeCallable DeleteHsmConfigurationCallable(Model::DeleteHsmConfigurationRequest&& request) const;
+
         /**
          * <p>Deletes the specified Amazon Redshift HSM configuration.</p>
          *
@@ -1227,6 +1497,11 @@ namespace Model
          */
         virtual void DeleteHsmConfigurationAsync(const Model::DeleteHsmConfigurationRequest& request, const DeleteHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteHsmConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteHsmConfigurationAsync(Model::DeleteHsmConfigurationRequest&& request, const DeleteHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified snapshot copy grant.</p>
          */
@@ -1239,6 +1514,11 @@ namespace Model
          */
         virtual Model::DeleteSnapshotCopyGrantOutcomeCallable DeleteSnapshotCopyGrantCallable(const Model::DeleteSnapshotCopyGrantRequest& request) const;
 
+        /**
+         * Same as DeleteSnapshotCopyGrantCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSnapshotCopyGrantOutcomeCallable DeleteSnapshotCopyGrantCallable(Model::DeleteSnapshotCopyGrantRequest&& request) const;
+
         /**
          * <p>Deletes the specified snapshot copy grant.</p>
          *
@@ -1246,6 +1526,11 @@ namespace Model
          */
         virtual void DeleteSnapshotCopyGrantAsync(const Model::DeleteSnapshotCopyGrantRequest& request, const DeleteSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSnapshotCopyGrantAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSnapshotCopyGrantAsync(Model::DeleteSnapshotCopyGrantRequest&& request, const DeleteSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes a tag or tags from a resource. You must provide the ARN of the
          * resource from which you want to delete the tag or tags.</p>
@@ -1260,6 +1545,11 @@ namespace Model
          */
         virtual Model::DeleteTagsOutcomeCallable DeleteTagsCallable(const Model::DeleteTagsRequest& request) const;
 
+        /**
+         * Same as DeleteTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteTagsOutcomeCallable DeleteTagsCallable(Model::DeleteTagsRequest&& request) const;
+
         /**
          * <p> Deletes a tag or tags from a resource. You must provide the ARN of the
          * resource from which you want to delete the tag or tags.</p>
@@ -1268,6 +1558,11 @@ namespace Model
          */
         virtual void DeleteTagsAsync(const Model::DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteTagsAsync(Model::DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of Amazon Redshift parameter groups, including parameter
          * groups you created and the default parameter group. For each parameter group,
@@ -1310,6 +1605,11 @@ namespace Model
          */
         virtual Model::DescribeClusterParameterGroupsOutcomeCallable DescribeClusterParameterGroupsCallable(const Model::DescribeClusterParameterGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeClusterParameterGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeClusterParameterGroupsOutcomeCallable DescribeClusterParameterGroupsCallable(Model::DescribeClusterParameterGroupsRequest&& request) const;
+
         /**
          * <p> Returns a list of Amazon Redshift parameter groups, including parameter
          * groups you created and the default parameter group. For each parameter group,
@@ -1332,6 +1632,11 @@ namespace Model
          */
         virtual void DescribeClusterParameterGroupsAsync(const Model::DescribeClusterParameterGroupsRequest& request, const DescribeClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClusterParameterGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeClusterParameterGroupsAsync(Model::DescribeClusterParameterGroupsRequest&& request, const DescribeClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a detailed list of parameters contained within the specified Amazon
          * Redshift parameter group. For each parameter the response includes information
@@ -1366,6 +1671,11 @@ namespace Model
          */
         virtual Model::DescribeClusterParametersOutcomeCallable DescribeClusterParametersCallable(const Model::DescribeClusterParametersRequest& request) const;
 
+        /**
+         * Same as DescribeClusterParametersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeClusterParametersOutcomeCallable DescribeClusterParametersCallable(Model::DescribeClusterParametersRequest&& request) const;
+
         /**
          * <p> Returns a detailed list of parameters contained within the specified Amazon
          * Redshift parameter group. For each parameter the response includes information
@@ -1384,6 +1694,11 @@ namespace Model
          */
         virtual void DescribeClusterParametersAsync(const Model::DescribeClusterParametersRequest& request, const DescribeClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClusterParametersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeClusterParametersAsync(Model::DescribeClusterParametersRequest&& request, const DescribeClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns information about Amazon Redshift security groups. If the name of a
          * security group is specified, the response will contain only information about
@@ -1422,6 +1737,11 @@ namespace Model
          */
         virtual Model::DescribeClusterSecurityGroupsOutcomeCallable DescribeClusterSecurityGroupsCallable(const Model::DescribeClusterSecurityGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeClusterSecurityGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeClusterSecurityGroupsOutcomeCallable DescribeClusterSecurityGroupsCallable(Model::DescribeClusterSecurityGroupsRequest&& request) const;
+
         /**
          * <p> Returns information about Amazon Redshift security groups. If the name of a
          * security group is specified, the response will contain only information about
@@ -1442,6 +1762,11 @@ namespace Model
          */
         virtual void DescribeClusterSecurityGroupsAsync(const Model::DescribeClusterSecurityGroupsRequest& request, const DescribeClusterSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClusterSecurityGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeClusterSecurityGroupsAsync(Model::DescribeClusterSecurityGroupsRequest&& request, const DescribeClusterSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns one or more snapshot objects, which contain metadata about your
          * cluster snapshots. By default, this operation returns information about all
@@ -1480,6 +1805,11 @@ namespace Model
          */
         virtual Model::DescribeClusterSnapshotsOutcomeCallable DescribeClusterSnapshotsCallable(const Model::DescribeClusterSnapshotsRequest& request) const;
 
+        /**
+         * Same as DescribeClusterSnapshotsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeClusterSnapshotsOutcomeCallable DescribeClusterSnapshotsCallable(Model::DescribeClusterSnapshotsRequest&& request) const;
+
         /**
          * <p> Returns one or more snapshot objects, which contain metadata about your
          * cluster snapshots. By default, this operation returns information about all
@@ -1500,6 +1830,11 @@ namespace Model
          */
         virtual void DescribeClusterSnapshotsAsync(const Model::DescribeClusterSnapshotsRequest& request, const DescribeClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClusterSnapshotsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeClusterSnapshotsAsync(Model::DescribeClusterSnapshotsRequest&& request, const DescribeClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns one or more cluster subnet group objects, which contain metadata
          * about your cluster subnet groups. By default, this operation returns information
@@ -1532,6 +1867,11 @@ namespace Model
          */
         virtual Model::DescribeClusterSubnetGroupsOutcomeCallable DescribeClusterSubnetGroupsCallable(const Model::DescribeClusterSubnetGroupsRequest& request) const;
 
+        /**
+         * Same as DescribeClusterSubnetGroupsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeClusterSubnetGroupsOutcomeCallable DescribeClusterSubnetGroupsCallable(Model::DescribeClusterSubnetGroupsRequest&& request) const;
+
         /**
          * <p> Returns one or more cluster subnet group objects, which contain metadata
          * about your cluster subnet groups. By default, this operation returns information
@@ -1549,6 +1889,11 @@ namespace Model
          */
         virtual void DescribeClusterSubnetGroupsAsync(const Model::DescribeClusterSubnetGroupsRequest& request, const DescribeClusterSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClusterSubnetGroupsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeClusterSubnetGroupsAsync(Model::DescribeClusterSubnetGroupsRequest&& request, const DescribeClusterSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns descriptions of the available Amazon Redshift cluster versions. You
          * can call this operation even before creating any clusters to learn more about
@@ -1573,6 +1918,11 @@ namespace Model
          */
         virtual Model::DescribeClusterVersionsOutcomeCallable DescribeClusterVersionsCallable(const Model::DescribeClusterVersionsRequest& request) const;
 
+        /**
+         * Same as DescribeClusterVersionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeClusterVersionsOutcomeCallable DescribeClusterVersionsCallable(Model::DescribeClusterVersionsRequest&& request) const;
+
         /**
          * <p> Returns descriptions of the available Amazon Redshift cluster versions. You
          * can call this operation even before creating any clusters to learn more about
@@ -1586,6 +1936,11 @@ namespace Model
          */
         virtual void DescribeClusterVersionsAsync(const Model::DescribeClusterVersionsRequest& request, const DescribeClusterVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClusterVersionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeClusterVersionsAsync(Model::DescribeClusterVersionsRequest&& request, const DescribeClusterVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns properties of provisioned clusters including general cluster
          * properties, cluster database properties, maintenance and backup properties, and
@@ -1624,6 +1979,11 @@ namespace Model
          */
         virtual Model::DescribeClustersOutcomeCallable DescribeClustersCallable(const Model::DescribeClustersRequest& request) const;
 
+        /**
+         * Same as DescribeClustersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeClustersOutcomeCallable DescribeClustersCallable(Model::DescribeClustersRequest&& request) const;
+
         /**
          * <p> Returns properties of provisioned clusters including general cluster
          * properties, cluster database properties, maintenance and backup properties, and
@@ -1644,6 +2004,11 @@ namespace Model
          */
         virtual void DescribeClustersAsync(const Model::DescribeClustersRequest& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeClustersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeClustersAsync(Model::DescribeClustersRequest&& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of parameter settings for the specified parameter group
          * family. </p> <p> For more information about parameters and parameter groups, go
@@ -1666,6 +2031,11 @@ namespace Model
          */
         virtual Model::DescribeDefaultClusterParametersOutcomeCallable DescribeDefaultClusterParametersCallable(const Model::DescribeDefaultClusterParametersRequest& request) const;
 
+        /**
+         * Same as DescribeDefaultClusterParametersCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDefaultClusterParametersOutcomeCallable DescribeDefaultClusterParametersCallable(Model::DescribeDefaultClusterParametersRequest&& request) const;
+
         /**
          * <p> Returns a list of parameter settings for the specified parameter group
          * family. </p> <p> For more information about parameters and parameter groups, go
@@ -1678,6 +2048,11 @@ namespace Model
          */
         virtual void DescribeDefaultClusterParametersAsync(const Model::DescribeDefaultClusterParametersRequest& request, const DescribeDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDefaultClusterParametersAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDefaultClusterParametersAsync(Model::DescribeDefaultClusterParametersRequest&& request, const DescribeDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Displays a list of event categories for all event source types, or for a
          * specified source type. For a list of the event categories and source types, go
@@ -1698,6 +2073,11 @@ namespace Model
          */
         virtual Model::DescribeEventCategoriesOutcomeCallable DescribeEventCategoriesCallable(const Model::DescribeEventCategoriesRequest& request) const;
 
+        /**
+         * Same as DescribeEventCategoriesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEventCategoriesOutcomeCallable DescribeEventCategoriesCallable(Model::DescribeEventCategoriesRequest&& request) const;
+
         /**
          * <p>Displays a list of event categories for all event source types, or for a
          * specified source type. For a list of the event categories and source types, go
@@ -1709,6 +2089,11 @@ namespace Model
          */
         virtual void DescribeEventCategoriesAsync(const Model::DescribeEventCategoriesRequest& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventCategoriesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEventCategoriesAsync(Model::DescribeEventCategoriesRequest&& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Lists descriptions of all the Amazon Redshift event notifications
          * subscription for a customer account. If you specify a subscription name, lists
@@ -1725,6 +2110,11 @@ namespace Model
          */
         virtual Model::DescribeEventSubscriptionsOutcomeCallable DescribeEventSubscriptionsCallable(const Model::DescribeEventSubscriptionsRequest& request) const;
 
+        /**
+         * Same as DescribeEventSubscriptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEventSubscriptionsOutcomeCallable DescribeEventSubscriptionsCallable(Model::DescribeEventSubscriptionsRequest&& request) const;
+
         /**
          * <p> Lists descriptions of all the Amazon Redshift event notifications
          * subscription for a customer account. If you specify a subscription name, lists
@@ -1734,6 +2124,11 @@ namespace Model
          */
         virtual void DescribeEventSubscriptionsAsync(const Model::DescribeEventSubscriptionsRequest& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventSubscriptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEventSubscriptionsAsync(Model::DescribeEventSubscriptionsRequest&& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns events related to clusters, security groups, snapshots, and
          * parameter groups for the past 14 days. Events specific to a particular cluster,
@@ -1752,6 +2147,11 @@ namespace Model
          */
         virtual Model::DescribeEventsOutcomeCallable DescribeEventsCallable(const Model::DescribeEventsRequest& request) const;
 
+        /**
+         * Same as DescribeEventsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeEventsOutcomeCallable DescribeEventsCallable(Model::DescribeEventsRequest&& request) const;
+
         /**
          * <p> Returns events related to clusters, security groups, snapshots, and
          * parameter groups for the past 14 days. Events specific to a particular cluster,
@@ -1762,6 +2162,11 @@ namespace Model
          */
         virtual void DescribeEventsAsync(const Model::DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeEventsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeEventsAsync(Model::DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the specified HSM client certificate. If no
          * certificate ID is specified, returns information about all the HSM certificates
@@ -1794,6 +2199,11 @@ namespace Model
          */
         virtual Model::DescribeHsmClientCertificatesOutcomeCallable DescribeHsmClientCertificatesCallable(const Model::DescribeHsmClientCertificatesRequest& request) const;
 
+        /**
+         * Same as DescribeHsmClientCertificatesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeHsmClientCertificatesOutcomeCallable DescribeHsmClientCertificatesCallable(Model::DescribeHsmClientCertificatesRequest&& request) const;
+
         /**
          * <p>Returns information about the specified HSM client certificate. If no
          * certificate ID is specified, returns information about all the HSM certificates
@@ -1811,6 +2221,11 @@ namespace Model
          */
         virtual void DescribeHsmClientCertificatesAsync(const Model::DescribeHsmClientCertificatesRequest& request, const DescribeHsmClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeHsmClientCertificatesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeHsmClientCertificatesAsync(Model::DescribeHsmClientCertificatesRequest&& request, const DescribeHsmClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the specified Amazon Redshift HSM configuration. If
          * no configuration ID is specified, returns information about all the HSM
@@ -1843,6 +2258,11 @@ namespace Model
          */
         virtual Model::DescribeHsmConfigurationsOutcomeCallable DescribeHsmConfigurationsCallable(const Model::DescribeHsmConfigurationsRequest& request) const;
 
+        /**
+         * Same as DescribeHsmConfigurationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeHsmConfigurationsOutcomeCallable DescribeHsmConfigurationsCallable(Model::DescribeHsmConfigurationsRequest&& request) const;
+
         /**
          * <p>Returns information about the specified Amazon Redshift HSM configuration. If
          * no configuration ID is specified, returns information about all the HSM
@@ -1860,6 +2280,11 @@ namespace Model
          */
         virtual void DescribeHsmConfigurationsAsync(const Model::DescribeHsmConfigurationsRequest& request, const DescribeHsmConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeHsmConfigurationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeHsmConfigurationsAsync(Model::DescribeHsmConfigurationsRequest&& request, const DescribeHsmConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes whether information, such as queries and connection attempts, is
          * being logged for the specified Amazon Redshift cluster.</p>
@@ -1874,6 +2299,11 @@ namespace Model
          */
         virtual Model::DescribeLoggingStatusOutcomeCallable DescribeLoggingStatusCallable(const Model::DescribeLoggingStatusRequest& request) const;
 
+        /**
+         * Same as DescribeLoggingStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeLoggingStatusOutcomeCallable DescribeLoggingStatusCallable(Model::DescribeLoggingStatusRequest&& request) const;
+
         /**
          * <p>Describes whether information, such as queries and connection attempts, is
          * being logged for the specified Amazon Redshift cluster.</p>
@@ -1882,6 +2312,11 @@ namespace Model
          */
         virtual void DescribeLoggingStatusAsync(const Model::DescribeLoggingStatusRequest& request, const DescribeLoggingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeLoggingStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeLoggingStatusAsync(Model::DescribeLoggingStatusRequest&& request, const DescribeLoggingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of orderable cluster options. Before you create a new cluster
          * you can use this operation to find what options are available, such as the EC2
@@ -1912,6 +2347,11 @@ namespace Model
          */
         virtual Model::DescribeOrderableClusterOptionsOutcomeCallable DescribeOrderableClusterOptionsCallable(const Model::DescribeOrderableClusterOptionsRequest& request) const;
 
+        /**
+         * Same as DescribeOrderableClusterOptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeOrderableClusterOptionsOutcomeCallable DescribeOrderableClusterOptionsCallable(Model::DescribeOrderableClusterOptionsRequest&& request) const;
+
         /**
          * <p> Returns a list of orderable cluster options. Before you create a new cluster
          * you can use this operation to find what options are available, such as the EC2
@@ -1928,6 +2368,11 @@ namespace Model
          */
         virtual void DescribeOrderableClusterOptionsAsync(const Model::DescribeOrderableClusterOptionsRequest& request, const DescribeOrderableClusterOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeOrderableClusterOptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeOrderableClusterOptionsAsync(Model::DescribeOrderableClusterOptionsRequest&& request, const DescribeOrderableClusterOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of the available reserved node offerings by Amazon Redshift
          * with their descriptions including the node type, the fixed and recurring costs
@@ -1958,6 +2403,11 @@ namespace Model
          */
         virtual Model::DescribeReservedNodeOfferingsOutcomeCallable DescribeReservedNodeOfferingsCallable(const Model::DescribeReservedNodeOfferingsRequest& request) const;
 
+        /**
+         * Same as DescribeReservedNodeOfferingsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeReservedNodeOfferingsOutcomeCallable DescribeReservedNodeOfferingsCallable(Model::DescribeReservedNodeOfferingsRequest&& request) const;
+
         /**
          * <p> Returns a list of the available reserved node offerings by Amazon Redshift
          * with their descriptions including the node type, the fixed and recurring costs
@@ -1974,6 +2424,11 @@ namespace Model
          */
         virtual void DescribeReservedNodeOfferingsAsync(const Model::DescribeReservedNodeOfferingsRequest& request, const DescribeReservedNodeOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedNodeOfferingsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeReservedNodeOfferingsAsync(Model::DescribeReservedNodeOfferingsRequest&& request, const DescribeReservedNodeOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns the descriptions of the reserved nodes. </p>
          */
@@ -1986,6 +2441,11 @@ namespace Model
          */
         virtual Model::DescribeReservedNodesOutcomeCallable DescribeReservedNodesCallable(const Model::DescribeReservedNodesRequest& request) const;
 
+        /**
+         * Same as DescribeReservedNodesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeReservedNodesOutcomeCallable DescribeReservedNodesCallable(Model::DescribeReservedNodesRequest&& request) const;
+
         /**
          * <p> Returns the descriptions of the reserved nodes. </p>
          *
@@ -1993,6 +2453,11 @@ namespace Model
          */
         virtual void DescribeReservedNodesAsync(const Model::DescribeReservedNodesRequest& request, const DescribeReservedNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeReservedNodesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeReservedNodesAsync(Model::DescribeReservedNodesRequest&& request, const DescribeReservedNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns information about the last resize operation for the specified
          * cluster. If no resize operation has ever been initiated for the specified
@@ -2017,6 +2482,11 @@ namespace Model
          */
         virtual Model::DescribeResizeOutcomeCallable DescribeResizeCallable(const Model::DescribeResizeRequest& request) const;
 
+        /**
+         * Same as DescribeResizeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeResizeOutcomeCallable DescribeResizeCallable(Model::DescribeResizeRequest&& request) const;
+
         /**
          * <p> Returns information about the last resize operation for the specified
          * cluster. If no resize operation has ever been initiated for the specified
@@ -2030,6 +2500,11 @@ namespace Model
          */
         virtual void DescribeResizeAsync(const Model::DescribeResizeRequest& request, const DescribeResizeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeResizeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeResizeAsync(Model::DescribeResizeRequest&& request, const DescribeResizeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of snapshot copy grants owned by the AWS account in the
          * destination region.</p> <p> For more information about managing snapshot copy
@@ -2052,6 +2527,11 @@ namespace Model
          */
         virtual Model::DescribeSnapshotCopyGrantsOutcomeCallable DescribeSnapshotCopyGrantsCallable(const Model::DescribeSnapshotCopyGrantsRequest& request) const;
 
+        /**
+         * Same as DescribeSnapshotCopyGrantsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSnapshotCopyGrantsOutcomeCallable DescribeSnapshotCopyGrantsCallable(Model::DescribeSnapshotCopyGrantsRequest&& request) const;
+
         /**
          * <p>Returns a list of snapshot copy grants owned by the AWS account in the
          * destination region.</p> <p> For more information about managing snapshot copy
@@ -2064,6 +2544,11 @@ namespace Model
          */
         virtual void DescribeSnapshotCopyGrantsAsync(const Model::DescribeSnapshotCopyGrantsRequest& request, const DescribeSnapshotCopyGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSnapshotCopyGrantsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSnapshotCopyGrantsAsync(Model::DescribeSnapshotCopyGrantsRequest&& request, const DescribeSnapshotCopyGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the status of one or more table restore requests made using the
          * <a>RestoreTableFromClusterSnapshot</a> API action. If you don't specify a value
@@ -2088,6 +2573,11 @@ namespace Model
          */
         virtual Model::DescribeTableRestoreStatusOutcomeCallable DescribeTableRestoreStatusCallable(const Model::DescribeTableRestoreStatusRequest& request) const;
 
+        /**
+         * Same as DescribeTableRestoreStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTableRestoreStatusOutcomeCallable DescribeTableRestoreStatusCallable(Model::DescribeTableRestoreStatusRequest&& request) const;
+
         /**
          * <p>Lists the status of one or more table restore requests made using the
          * <a>RestoreTableFromClusterSnapshot</a> API action. If you don't specify a value
@@ -2101,6 +2591,11 @@ namespace Model
          */
         virtual void DescribeTableRestoreStatusAsync(const Model::DescribeTableRestoreStatusRequest& request, const DescribeTableRestoreStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTableRestoreStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTableRestoreStatusAsync(Model::DescribeTableRestoreStatusRequest&& request, const DescribeTableRestoreStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns a list of tags. You can return tags from a specific resource by
          * specifying an ARN, or you can return all tags for a given type of resource, such
@@ -2141,6 +2636,11 @@ namespace Model
          */
         virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(const Model::DescribeTagsRequest& request) const;
 
+        /**
+         * Same as DescribeTagsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTagsOutcomeCallable DescribeTagsCallable(Model::DescribeTagsRequest&& request) const;
+
         /**
          * <p> Returns a list of tags. You can return tags from a specific resource by
          * specifying an ARN, or you can return all tags for a given type of resource, such
@@ -2162,6 +2662,11 @@ namespace Model
          */
         virtual void DescribeTagsAsync(const Model::DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTagsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTagsAsync(Model::DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Stops logging information, such as queries and connection attempts, for the
          * specified Amazon Redshift cluster.</p>
@@ -2176,6 +2681,11 @@ namespace Model
          */
         virtual Model::DisableLoggingOutcomeCallable DisableLoggingCallable(const Model::DisableLoggingRequest& request) const;
 
+        /**
+         * Same as DisableLoggingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableLoggingOutcomeCallable DisableLoggingCallable(Model::DisableLoggingRequest&& request) const;
+
         /**
          * <p>Stops logging information, such as queries and connection attempts, for the
          * specified Amazon Redshift cluster.</p>
@@ -2184,6 +2694,11 @@ namespace Model
          */
         virtual void DisableLoggingAsync(const Model::DisableLoggingRequest& request, const DisableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableLoggingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableLoggingAsync(Model::DisableLoggingRequest&& request, const DisableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables the automatic copying of snapshots from one region to another region
          * for a specified cluster.</p> <p>If your cluster and its snapshots are encrypted
@@ -2204,6 +2719,11 @@ namespace Model
          */
         virtual Model::DisableSnapshotCopyOutcomeCallable DisableSnapshotCopyCallable(const Model::DisableSnapshotCopyRequest& request) const;
 
+        /**
+         * Same as DisableSnapshotCopyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableSnapshotCopyOutcomeCallable DisableSnapshotCopyCallable(Model::DisableSnapshotCopyRequest&& request) const;
+
         /**
          * <p>Disables the automatic copying of snapshots from one region to another region
          * for a specified cluster.</p> <p>If your cluster and its snapshots are encrypted
@@ -2215,6 +2735,11 @@ namespace Model
          */
         virtual void DisableSnapshotCopyAsync(const Model::DisableSnapshotCopyRequest& request, const DisableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableSnapshotCopyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableSnapshotCopyAsync(Model::DisableSnapshotCopyRequest&& request, const DisableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts logging information, such as queries and connection attempts, for the
          * specified Amazon Redshift cluster.</p>
@@ -2229,6 +2754,11 @@ namespace Model
          */
         virtual Model::EnableLoggingOutcomeCallable EnableLoggingCallable(const Model::EnableLoggingRequest& request) const;
 
+        /**
+         * Same as EnableLoggingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableLoggingOutcomeCallable EnableLoggingCallable(Model::EnableLoggingRequest&& request) const;
+
         /**
          * <p>Starts logging information, such as queries and connection attempts, for the
          * specified Amazon Redshift cluster.</p>
@@ -2237,6 +2767,11 @@ namespace Model
          */
         virtual void EnableLoggingAsync(const Model::EnableLoggingRequest& request, const EnableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableLoggingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableLoggingAsync(Model::EnableLoggingRequest&& request, const EnableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Enables the automatic copy of snapshots from one region to another region for
          * a specified cluster.</p>
@@ -2251,6 +2786,11 @@ namespace Model
          */
         virtual Model::EnableSnapshotCopyOutcomeCallable EnableSnapshotCopyCallable(const Model::EnableSnapshotCopyRequest& request) const;
 
+        /**
+         * Same as EnableSnapshotCopyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableSnapshotCopyOutcomeCallable EnableSnapshotCopyCallable(Model::EnableSnapshotCopyRequest&& request) const;
+
         /**
          * <p>Enables the automatic copy of snapshots from one region to another region for
          * a specified cluster.</p>
@@ -2259,6 +2799,11 @@ namespace Model
          */
         virtual void EnableSnapshotCopyAsync(const Model::EnableSnapshotCopyRequest& request, const EnableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableSnapshotCopyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableSnapshotCopyAsync(Model::EnableSnapshotCopyRequest&& request, const EnableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies the settings for a cluster. For example, you can add another
          * security or parameter group, update the preferred maintenance window, or change
@@ -2291,6 +2836,11 @@ namespace Model
          */
         virtual Model::ModifyClusterOutcomeCallable ModifyClusterCallable(const Model::ModifyClusterRequest& request) const;
 
+        /**
+         * Same as ModifyClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyClusterOutcomeCallable ModifyClusterCallable(Model::ModifyClusterRequest&& request) const;
+
         /**
          * <p> Modifies the settings for a cluster. For example, you can add another
          * security or parameter group, update the preferred maintenance window, or change
@@ -2308,6 +2858,11 @@ namespace Model
          */
         virtual void ModifyClusterAsync(const Model::ModifyClusterRequest& request, const ModifyClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyClusterAsync(Model::ModifyClusterRequest&& request, const ModifyClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies the parameters of a parameter group. </p> <p> For more information
          * about parameters and parameter groups, go to <a
@@ -2328,6 +2883,11 @@ namespace Model
          */
         virtual Model::ModifyClusterParameterGroupOutcomeCallable ModifyClusterParameterGroupCallable(const Model::ModifyClusterParameterGroupRequest& request) const;
 
+        /**
+         * Same as ModifyClusterParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyClusterParameterGroupOutcomeCallable ModifyClusterParameterGroupCallable(Model::ModifyClusterParameterGroupRequest&& request) const;
+
         /**
          * <p> Modifies the parameters of a parameter group. </p> <p> For more information
          * about parameters and parameter groups, go to <a
@@ -2339,6 +2899,11 @@ namespace Model
          */
         virtual void ModifyClusterParameterGroupAsync(const Model::ModifyClusterParameterGroupRequest& request, const ModifyClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyClusterParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyClusterParameterGroupAsync(Model::ModifyClusterParameterGroupRequest&& request, const ModifyClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies a cluster subnet group to include the specified list of VPC
          * subnets. The operation replaces the existing list of subnets with the new list
@@ -2355,6 +2920,11 @@ namespace Model
          */
         virtual Model::ModifyClusterSubnetGroupOutcomeCallable ModifyClusterSubnetGroupCallable(const Model::ModifyClusterSubnetGroupRequest& request) const;
 
+        /**
+         * Same as ModifyClusterSubnetGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyClusterSubnetGroupOutcomeCallable ModifyClusterSubnetGroupCallable(Model::ModifyClusterSubnetGroupRequest&& request) const;
+
         /**
          * <p> Modifies a cluster subnet group to include the specified list of VPC
          * subnets. The operation replaces the existing list of subnets with the new list
@@ -2364,6 +2934,11 @@ namespace Model
          */
         virtual void ModifyClusterSubnetGroupAsync(const Model::ModifyClusterSubnetGroupRequest& request, const ModifyClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyClusterSubnetGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyClusterSubnetGroupAsync(Model::ModifyClusterSubnetGroupRequest&& request, const ModifyClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies an existing Amazon Redshift event notification subscription. </p>
          */
@@ -2376,6 +2951,11 @@ namespace Model
          */
         virtual Model::ModifyEventSubscriptionOutcomeCallable ModifyEventSubscriptionCallable(const Model::ModifyEventSubscriptionRequest& request) const;
 
+        /**
+         * Same as ModifyEventSubscriptionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifyEventSubscriptionOutcomeCallable ModifyEventSubscriptionCallable(Model::ModifyEventSubscriptionRequest&& request) const;
+
         /**
          * <p> Modifies an existing Amazon Redshift event notification subscription. </p>
          *
@@ -2383,6 +2963,11 @@ namespace Model
          */
         virtual void ModifyEventSubscriptionAsync(const Model::ModifyEventSubscriptionRequest& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifyEventSubscriptionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifyEventSubscriptionAsync(Model::ModifyEventSubscriptionRequest&& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Modifies the number of days to retain automated snapshots in the destination
          * region after they are copied from the source region. </p>
@@ -2397,6 +2982,11 @@ namespace Model
          */
         virtual Model::ModifySnapshotCopyRetentionPeriodOutcomeCallable ModifySnapshotCopyRetentionPeriodCallable(const Model::ModifySnapshotCopyRetentionPeriodRequest& request) const;
 
+        /**
+         * Same as ModifySnapshotCopyRetentionPeriodCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ModifySnapshotCopyRetentionPeriodOutcomeCallable ModifySnapshotCopyRetentionPeriodCallable(Model::ModifySnapshotCopyRetentionPeriodRequest&& request) const;
+
         /**
          * <p> Modifies the number of days to retain automated snapshots in the destination
          * region after they are copied from the source region. </p>
@@ -2405,6 +2995,11 @@ namespace Model
          */
         virtual void ModifySnapshotCopyRetentionPeriodAsync(const Model::ModifySnapshotCopyRetentionPeriodRequest& request, const ModifySnapshotCopyRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ModifySnapshotCopyRetentionPeriodAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ModifySnapshotCopyRetentionPeriodAsync(Model::ModifySnapshotCopyRetentionPeriodRequest&& request, const ModifySnapshotCopyRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Allows you to purchase reserved nodes. Amazon Redshift offers a predefined
          * set of reserved node offerings. You can purchase one or more of the offerings.
@@ -2431,6 +3026,11 @@ namespace Model
          */
         virtual Model::PurchaseReservedNodeOfferingOutcomeCallable PurchaseReservedNodeOfferingCallable(const Model::PurchaseReservedNodeOfferingRequest& request) const;
 
+        /**
+         * Same as PurchaseReservedNodeOfferingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PurchaseReservedNodeOfferingOutcomeCallable PurchaseReservedNodeOfferingCallable(Model::PurchaseReservedNodeOfferingRequest&& request) const;
+
         /**
          * <p> Allows you to purchase reserved nodes. Amazon Redshift offers a predefined
          * set of reserved node offerings. You can purchase one or more of the offerings.
@@ -2445,6 +3045,11 @@ namespace Model
          */
         virtual void PurchaseReservedNodeOfferingAsync(const Model::PurchaseReservedNodeOfferingRequest& request, const PurchaseReservedNodeOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PurchaseReservedNodeOfferingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PurchaseReservedNodeOfferingAsync(Model::PurchaseReservedNodeOfferingRequest&& request, const PurchaseReservedNodeOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Reboots a cluster. This action is taken as soon as possible. It results in a
          * momentary outage to the cluster, during which the cluster status is set to
@@ -2471,6 +3076,11 @@ namespace Model
          */
         virtual Model::RebootClusterOutcomeCallable RebootClusterCallable(const Model::RebootClusterRequest& request) const;
 
+        /**
+         * Same as RebootClusterCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RebootClusterOutcomeCallable RebootClusterCallable(Model::RebootClusterRequest&& request) const;
+
         /**
          * <p> Reboots a cluster. This action is taken as soon as possible. It results in a
          * momentary outage to the cluster, during which the cluster status is set to
@@ -2485,6 +3095,11 @@ namespace Model
          */
         virtual void RebootClusterAsync(const Model::RebootClusterRequest& request, const RebootClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebootClusterAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RebootClusterAsync(Model::RebootClusterRequest&& request, const RebootClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Sets one or more parameters of the specified parameter group to their
          * default values and sets the source values of the parameters to "engine-default".
@@ -2505,6 +3120,11 @@ namespace Model
          */
         virtual Model::ResetClusterParameterGroupOutcomeCallable ResetClusterParameterGroupCallable(const Model::ResetClusterParameterGroupRequest& request) const;
 
+        /**
+         * Same as ResetClusterParameterGroupCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ResetClusterParameterGroupOutcomeCallable ResetClusterParameterGroupCallable(Model::ResetClusterParameterGroupRequest&& request) const;
+
         /**
          * <p> Sets one or more parameters of the specified parameter group to their
          * default values and sets the source values of the parameters to "engine-default".
@@ -2516,6 +3136,11 @@ namespace Model
          */
         virtual void ResetClusterParameterGroupAsync(const Model::ResetClusterParameterGroupRequest& request, const ResetClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetClusterParameterGroupAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ResetClusterParameterGroupAsync(Model::ResetClusterParameterGroupRequest&& request, const ResetClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Creates a new cluster from a snapshot. By default, Amazon Redshift creates
          * the resulting cluster with the same configuration as the original cluster from
@@ -2552,6 +3177,11 @@ namespace Model
          */
         virtual Model::RestoreFromClusterSnapshotOutcomeCallable RestoreFromClusterSnapshotCallable(const Model::RestoreFromClusterSnapshotRequest& request) const;
 
+        /**
+         * Same as RestoreFromClusterSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RestoreFromClusterSnapshotOutcomeCallable RestoreFromClusterSnapshotCallable(Model::RestoreFromClusterSnapshotRequest&& request) const;
+
         /**
          * <p> Creates a new cluster from a snapshot. By default, Amazon Redshift creates
          * the resulting cluster with the same configuration as the original cluster from
@@ -2571,6 +3201,11 @@ namespace Model
          */
         virtual void RestoreFromClusterSnapshotAsync(const Model::RestoreFromClusterSnapshotRequest& request, const RestoreFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreFromClusterSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RestoreFromClusterSnapshotAsync(Model::RestoreFromClusterSnapshotRequest&& request, const RestoreFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new table from a table in an Amazon Redshift cluster snapshot. You
          * must create the new table within the Amazon Redshift cluster that the snapshot
@@ -2605,6 +3240,11 @@ namespace Model
          */
         virtual Model::RestoreTableFromClusterSnapshotOutcomeCallable RestoreTableFromClusterSnapshotCallable(const Model::RestoreTableFromClusterSnapshotRequest& request) const;
 
+        /**
+         * Same as RestoreTableFromClusterSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RestoreTableFromClusterSnapshotOutcomeCallable RestoreTableFromClusterSnapshotCallable(Model::RestoreTableFromClusterSnapshotRequest&& request) const;
+
         /**
          * <p>Creates a new table from a table in an Amazon Redshift cluster snapshot. You
          * must create the new table within the Amazon Redshift cluster that the snapshot
@@ -2623,6 +3263,11 @@ namespace Model
          */
         virtual void RestoreTableFromClusterSnapshotAsync(const Model::RestoreTableFromClusterSnapshotRequest& request, const RestoreTableFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreTableFromClusterSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RestoreTableFromClusterSnapshotAsync(Model::RestoreTableFromClusterSnapshotRequest&& request, const RestoreTableFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Revokes an ingress rule in an Amazon Redshift security group for a
          * previously authorized IP range or Amazon EC2 security group. To add an ingress
@@ -2647,6 +3292,11 @@ namespace Model
          */
         virtual Model::RevokeClusterSecurityGroupIngressOutcomeCallable RevokeClusterSecurityGroupIngressCallable(const Model::RevokeClusterSecurityGroupIngressRequest& request) const;
 
+        /**
+         * Same as RevokeClusterSecurityGroupIngressCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RevokeClusterSecurityGroupIngressOutcomeCallable RevokeClusterSecurityGroupIngressCallable(Model::RevokeClusterSecurityGroupIngressRequest&& request) const;
+
         /**
          * <p> Revokes an ingress rule in an Amazon Redshift security group for a
          * previously authorized IP range or Amazon EC2 security group. To add an ingress
@@ -2660,6 +3310,11 @@ namespace Model
          */
         virtual void RevokeClusterSecurityGroupIngressAsync(const Model::RevokeClusterSecurityGroupIngressRequest& request, const RevokeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RevokeClusterSecurityGroupIngressAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RevokeClusterSecurityGroupIngressAsync(Model::RevokeClusterSecurityGroupIngressRequest&& request, const RevokeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Removes the ability of the specified AWS customer account to restore the
          * specified snapshot. If the account is currently restoring the snapshot, the
@@ -2684,6 +3339,11 @@ namespace Model
          */
         virtual Model::RevokeSnapshotAccessOutcomeCallable RevokeSnapshotAccessCallable(const Model::RevokeSnapshotAccessRequest& request) const;
 
+        /**
+         * Same as RevokeSnapshotAccessCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RevokeSnapshotAccessOutcomeCallable RevokeSnapshotAccessCallable(Model::RevokeSnapshotAccessRequest&& request) const;
+
         /**
          * <p> Removes the ability of the specified AWS customer account to restore the
          * specified snapshot. If the account is currently restoring the snapshot, the
@@ -2697,6 +3357,11 @@ namespace Model
          */
         virtual void RevokeSnapshotAccessAsync(const Model::RevokeSnapshotAccessRequest& request, const RevokeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RevokeSnapshotAccessAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RevokeSnapshotAccessAsync(Model::RevokeSnapshotAccessRequest&& request, const RevokeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Rotates the encryption keys for a cluster. </p>
          */
@@ -2709,6 +3374,11 @@ namespace Model
          */
         virtual Model::RotateEncryptionKeyOutcomeCallable RotateEncryptionKeyCallable(const Model::RotateEncryptionKeyRequest& request) const;
 
+        /**
+         * Same as RotateEncryptionKeyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RotateEncryptionKeyOutcomeCallable RotateEncryptionKeyCallable(Model::RotateEncryptionKeyRequest&& request) const;
+
         /**
          * <p> Rotates the encryption keys for a cluster. </p>
          *
@@ -2716,6 +3386,140 @@ namespace Model
          */
         virtual void RotateEncryptionKeyAsync(const Model::RotateEncryptionKeyRequest& request, const RotateEncryptionKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RotateEncryptionKeyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RotateEncryptionKeyAsync(Model::RotateEncryptionKeyRequest&& request, const RotateEncryptionKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AuthorizeClusterSecurityGroupIngressOutcome> AuthorizeClusterSecurityGroupIngressAwaitable(const Model::AuthorizeClusterSecurityGroupIngressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::AuthorizeClusterSecurityGroupIngress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AuthorizeClusterSecurityGroupIngressOutcome> AuthorizeClusterSecurityGroupIngressAwaitable(Model::AuthorizeClusterSecurityGroupIngressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::AuthorizeClusterSecurityGroupIngress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AuthorizeSnapshotAccessOutcome> AuthorizeSnapshotAccessAwaitable(const Model::AuthorizeSnapshotAccessRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::AuthorizeSnapshotAccess, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AuthorizeSnapshotAccessOutcome> AuthorizeSnapshotAccessAwaitable(Model::AuthorizeSnapshotAccessRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::AuthorizeSnapshotAccess, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopyClusterSnapshotOutcome> CopyClusterSnapshotAwaitable(const Model::CopyClusterSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CopyClusterSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopyClusterSnapshotOutcome> CopyClusterSnapshotAwaitable(Model::CopyClusterSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CopyClusterSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateClusterOutcome> CreateClusterAwaitable(const Model::CreateClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateClusterOutcome> CreateClusterAwaitable(Model::CreateClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateClusterParameterGroupOutcome> CreateClusterParameterGroupAwaitable(const Model::CreateClusterParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateClusterParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateClusterParameterGroupOutcome> CreateClusterParameterGroupAwaitable(Model::CreateClusterParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateClusterParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateClusterSecurityGroupOutcome> CreateClusterSecurityGroupAwaitable(const Model::CreateClusterSecurityGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateClusterSecurityGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateClusterSecurityGroupOutcome> CreateClusterSecurityGroupAwaitable(Model::CreateClusterSecurityGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateClusterSecurityGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateClusterSnapshotOutcome> CreateClusterSnapshotAwaitable(const Model::CreateClusterSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateClusterSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateClusterSnapshotOutcome> CreateClusterSnapshotAwaitable(Model::CreateClusterSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateClusterSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateClusterSubnetGroupOutcome> CreateClusterSubnetGroupAwaitable(const Model::CreateClusterSubnetGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateClusterSubnetGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateClusterSubnetGroupOutcome> CreateClusterSubnetGroupAwaitable(Model::CreateClusterSubnetGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateClusterSubnetGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateEventSubscriptionOutcome> CreateEventSubscriptionAwaitable(const Model::CreateEventSubscriptionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateEventSubscription, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateEventSubscriptionOutcome> CreateEventSubscriptionAwaitable(Model::CreateEventSubscriptionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateEventSubscription, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateHsmClientCertificateOutcome> CreateHsmClientCertificateAwaitable(const Model::CreateHsmClientCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateHsmClientCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateHsmClientCertificateOutcome> CreateHsmClientCertificateAwaitable(Model::CreateHsmClientCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateHsmClientCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateHsmConfigurationOutcome> CreateHsmConfigurationAwaitable(const Model::CreateHsmConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateHsmConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateHsmConfigurationOutcome> CreateHsmConfigurationAwaitable(Model::CreateHsmConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateHsmConfiguration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSnapshotCopyGrantOutcome> CreateSnapshotCopyGrantAwaitable(const Model::CreateSnapshotCopyGrantRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateSnapshotCopyGrant, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSnapshotCopyGrantOutcome> CreateSnapshotCopyGrantAwaitable(Model::CreateSnapshotCopyGrantRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateSnapshotCopyGrant, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTagsOutcome> CreateTagsAwaitable(const Model::CreateTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTagsOutcome> CreateTagsAwaitable(Model::CreateTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::CreateTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteClusterOutcome> DeleteClusterAwaitable(const Model::DeleteClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteClusterOutcome> DeleteClusterAwaitable(Model::DeleteClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteClusterParameterGroupOutcome> DeleteClusterParameterGroupAwaitable(const Model::DeleteClusterParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteClusterParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteClusterParameterGroupOutcome> DeleteClusterParameterGroupAwaitable(Model::DeleteClusterParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteClusterParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteClusterSecurityGroupOutcome> DeleteClusterSecurityGroupAwaitable(const Model::DeleteClusterSecurityGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteClusterSecurityGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteClusterSecurityGroupOutcome> DeleteClusterSecurityGroupAwaitable(Model::DeleteClusterSecurityGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteClusterSecurityGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteClusterSnapshotOutcome> DeleteClusterSnapshotAwaitable(const Model::DeleteClusterSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteClusterSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteClusterSnapshotOutcome> DeleteClusterSnapshotAwaitable(Model::DeleteClusterSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteClusterSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteClusterSubnetGroupOutcome> DeleteClusterSubnetGroupAwaitable(const Model::DeleteClusterSubnetGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteClusterSubnetGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteClusterSubnetGroupOutcome> DeleteClusterSubnetGroupAwaitable(Model::DeleteClusterSubnetGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteClusterSubnetGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteEventSubscriptionOutcome> DeleteEventSubscriptionAwaitable(const Model::DeleteEventSubscriptionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteEventSubscription, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteEventSubscriptionOutcome> DeleteEventSubscriptionAwaitable(Model::DeleteEventSubscriptionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteEventSubscription, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteHsmClientCertificateOutcome> DeleteHsmClientCertificateAwaitable(const Model::DeleteHsmClientCertificateRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteHsmClientCertificate, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteHsmClientCertificateOutcome> DeleteHsmClientCertificateAwaitable(Model::DeleteHsmClientCertificateRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteHsmClientCertificate, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteHsmConfigurationOutcome> DeleteHsmConfigurationAwaitable(const Model::DeleteHsmConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteHsmConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteHsmConfigurationOutcome> DeleteHsmConfigurationAwaitable(Model::DeleteHsmConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteHsmConfiguration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSnapshotCopyGrantOutcome> DeleteSnapshotCopyGrantAwaitable(const Model::DeleteSnapshotCopyGrantRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteSnapshotCopyGrant, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSnapshotCopyGrantOutcome> DeleteSnapshotCopyGrantAwaitable(Model::DeleteSnapshotCopyGrantRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteSnapshotCopyGrant, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTagsOutcome> DeleteTagsAwaitable(const Model::DeleteTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTagsOutcome> DeleteTagsAwaitable(Model::DeleteTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DeleteTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClusterParameterGroupsOutcome> DescribeClusterParameterGroupsAwaitable(const Model::DescribeClusterParameterGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeClusterParameterGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClusterParameterGroupsOutcome> DescribeClusterParameterGroupsAwaitable(Model::DescribeClusterParameterGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeClusterParameterGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClusterParametersOutcome> DescribeClusterParametersAwaitable(const Model::DescribeClusterParametersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeClusterParameters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClusterParametersOutcome> DescribeClusterParametersAwaitable(Model::DescribeClusterParametersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeClusterParameters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClusterSecurityGroupsOutcome> DescribeClusterSecurityGroupsAwaitable(const Model::DescribeClusterSecurityGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeClusterSecurityGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClusterSecurityGroupsOutcome> DescribeClusterSecurityGroupsAwaitable(Model::DescribeClusterSecurityGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeClusterSecurityGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClusterSnapshotsOutcome> DescribeClusterSnapshotsAwaitable(const Model::DescribeClusterSnapshotsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeClusterSnapshots, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClusterSnapshotsOutcome> DescribeClusterSnapshotsAwaitable(Model::DescribeClusterSnapshotsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeClusterSnapshots, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClusterSubnetGroupsOutcome> DescribeClusterSubnetGroupsAwaitable(const Model::DescribeClusterSubnetGroupsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeClusterSubnetGroups, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClusterSubnetGroupsOutcome> DescribeClusterSubnetGroupsAwaitable(Model::DescribeClusterSubnetGroupsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeClusterSubnetGroups, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClusterVersionsOutcome> DescribeClusterVersionsAwaitable(const Model::DescribeClusterVersionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeClusterVersions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClusterVersionsOutcome> DescribeClusterVersionsAwaitable(Model::DescribeClusterVersionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeClusterVersions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClustersOutcome> DescribeClustersAwaitable(const Model::DescribeClustersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeClusters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeClustersOutcome> DescribeClustersAwaitable(Model::DescribeClustersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeClusters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDefaultClusterParametersOutcome> DescribeDefaultClusterParametersAwaitable(const Model::DescribeDefaultClusterParametersRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeDefaultClusterParameters, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDefaultClusterParametersOutcome> DescribeDefaultClusterParametersAwaitable(Model::DescribeDefaultClusterParametersRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeDefaultClusterParameters, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventCategoriesOutcome> DescribeEventCategoriesAwaitable(const Model::DescribeEventCategoriesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeEventCategories, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventCategoriesOutcome> DescribeEventCategoriesAwaitable(Model::DescribeEventCategoriesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeEventCategories, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventSubscriptionsOutcome> DescribeEventSubscriptionsAwaitable(const Model::DescribeEventSubscriptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeEventSubscriptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventSubscriptionsOutcome> DescribeEventSubscriptionsAwaitable(Model::DescribeEventSubscriptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeEventSubscriptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventsOutcome> DescribeEventsAwaitable(const Model::DescribeEventsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeEvents, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeEventsOutcome> DescribeEventsAwaitable(Model::DescribeEventsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeEvents, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeHsmClientCertificatesOutcome> DescribeHsmClientCertificatesAwaitable(const Model::DescribeHsmClientCertificatesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeHsmClientCertificates, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeHsmClientCertificatesOutcome> DescribeHsmClientCertificatesAwaitable(Model::DescribeHsmClientCertificatesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeHsmClientCertificates, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeHsmConfigurationsOutcome> DescribeHsmConfigurationsAwaitable(const Model::DescribeHsmConfigurationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeHsmConfigurations, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeHsmConfigurationsOutcome> DescribeHsmConfigurationsAwaitable(Model::DescribeHsmConfigurationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeHsmConfigurations, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLoggingStatusOutcome> DescribeLoggingStatusAwaitable(const Model::DescribeLoggingStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeLoggingStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeLoggingStatusOutcome> DescribeLoggingStatusAwaitable(Model::DescribeLoggingStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeLoggingStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeOrderableClusterOptionsOutcome> DescribeOrderableClusterOptionsAwaitable(const Model::DescribeOrderableClusterOptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeOrderableClusterOptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeOrderableClusterOptionsOutcome> DescribeOrderableClusterOptionsAwaitable(Model::DescribeOrderableClusterOptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeOrderableClusterOptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedNodeOfferingsOutcome> DescribeReservedNodeOfferingsAwaitable(const Model::DescribeReservedNodeOfferingsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeReservedNodeOfferings, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedNodeOfferingsOutcome> DescribeReservedNodeOfferingsAwaitable(Model::DescribeReservedNodeOfferingsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeReservedNodeOfferings, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedNodesOutcome> DescribeReservedNodesAwaitable(const Model::DescribeReservedNodesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeReservedNodes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeReservedNodesOutcome> DescribeReservedNodesAwaitable(Model::DescribeReservedNodesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeReservedNodes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeResizeOutcome> DescribeResizeAwaitable(const Model::DescribeResizeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeResize, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeResizeOutcome> DescribeResizeAwaitable(Model::DescribeResizeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeResize, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSnapshotCopyGrantsOutcome> DescribeSnapshotCopyGrantsAwaitable(const Model::DescribeSnapshotCopyGrantsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeSnapshotCopyGrants, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSnapshotCopyGrantsOutcome> DescribeSnapshotCopyGrantsAwaitable(Model::DescribeSnapshotCopyGrantsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeSnapshotCopyGrants, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTableRestoreStatusOutcome> DescribeTableRestoreStatusAwaitable(const Model::DescribeTableRestoreStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeTableRestoreStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTableRestoreStatusOutcome> DescribeTableRestoreStatusAwaitable(Model::DescribeTableRestoreStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeTableRestoreStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTagsOutcome> DescribeTagsAwaitable(const Model::DescribeTagsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeTags, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTagsOutcome> DescribeTagsAwaitable(Model::DescribeTagsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DescribeTags, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableLoggingOutcome> DisableLoggingAwaitable(const Model::DisableLoggingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DisableLogging, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableLoggingOutcome> DisableLoggingAwaitable(Model::DisableLoggingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DisableLogging, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableSnapshotCopyOutcome> DisableSnapshotCopyAwaitable(const Model::DisableSnapshotCopyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DisableSnapshotCopy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableSnapshotCopyOutcome> DisableSnapshotCopyAwaitable(Model::DisableSnapshotCopyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::DisableSnapshotCopy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableLoggingOutcome> EnableLoggingAwaitable(const Model::EnableLoggingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::EnableLogging, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableLoggingOutcome> EnableLoggingAwaitable(Model::EnableLoggingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::EnableLogging, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableSnapshotCopyOutcome> EnableSnapshotCopyAwaitable(const Model::EnableSnapshotCopyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::EnableSnapshotCopy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableSnapshotCopyOutcome> EnableSnapshotCopyAwaitable(Model::EnableSnapshotCopyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::EnableSnapshotCopy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyClusterOutcome> ModifyClusterAwaitable(const Model::ModifyClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::ModifyCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyClusterOutcome> ModifyClusterAwaitable(Model::ModifyClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::ModifyCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyClusterParameterGroupOutcome> ModifyClusterParameterGroupAwaitable(const Model::ModifyClusterParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::ModifyClusterParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyClusterParameterGroupOutcome> ModifyClusterParameterGroupAwaitable(Model::ModifyClusterParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::ModifyClusterParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyClusterSubnetGroupOutcome> ModifyClusterSubnetGroupAwaitable(const Model::ModifyClusterSubnetGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::ModifyClusterSubnetGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyClusterSubnetGroupOutcome> ModifyClusterSubnetGroupAwaitable(Model::ModifyClusterSubnetGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::ModifyClusterSubnetGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyEventSubscriptionOutcome> ModifyEventSubscriptionAwaitable(const Model::ModifyEventSubscriptionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::ModifyEventSubscription, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifyEventSubscriptionOutcome> ModifyEventSubscriptionAwaitable(Model::ModifyEventSubscriptionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::ModifyEventSubscription, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifySnapshotCopyRetentionPeriodOutcome> ModifySnapshotCopyRetentionPeriodAwaitable(const Model::ModifySnapshotCopyRetentionPeriodRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::ModifySnapshotCopyRetentionPeriod, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ModifySnapshotCopyRetentionPeriodOutcome> ModifySnapshotCopyRetentionPeriodAwaitable(Model::ModifySnapshotCopyRetentionPeriodRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::ModifySnapshotCopyRetentionPeriod, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PurchaseReservedNodeOfferingOutcome> PurchaseReservedNodeOfferingAwaitable(const Model::PurchaseReservedNodeOfferingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::PurchaseReservedNodeOffering, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PurchaseReservedNodeOfferingOutcome> PurchaseReservedNodeOfferingAwaitable(Model::PurchaseReservedNodeOfferingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::PurchaseReservedNodeOffering, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebootClusterOutcome> RebootClusterAwaitable(const Model::RebootClusterRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::RebootCluster, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebootClusterOutcome> RebootClusterAwaitable(Model::RebootClusterRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::RebootCluster, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetClusterParameterGroupOutcome> ResetClusterParameterGroupAwaitable(const Model::ResetClusterParameterGroupRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::ResetClusterParameterGroup, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetClusterParameterGroupOutcome> ResetClusterParameterGroupAwaitable(Model::ResetClusterParameterGroupRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::ResetClusterParameterGroup, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreFromClusterSnapshotOutcome> RestoreFromClusterSnapshotAwaitable(const Model::RestoreFromClusterSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::RestoreFromClusterSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreFromClusterSnapshotOutcome> RestoreFromClusterSnapshotAwaitable(Model::RestoreFromClusterSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::RestoreFromClusterSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreTableFromClusterSnapshotOutcome> RestoreTableFromClusterSnapshotAwaitable(const Model::RestoreTableFromClusterSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::RestoreTableFromClusterSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreTableFromClusterSnapshotOutcome> RestoreTableFromClusterSnapshotAwaitable(Model::RestoreTableFromClusterSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::RestoreTableFromClusterSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RevokeClusterSecurityGroupIngressOutcome> RevokeClusterSecurityGroupIngressAwaitable(const Model::RevokeClusterSecurityGroupIngressRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::RevokeClusterSecurityGroupIngress, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RevokeClusterSecurityGroupIngressOutcome> RevokeClusterSecurityGroupIngressAwaitable(Model::RevokeClusterSecurityGroupIngressRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::RevokeClusterSecurityGroupIngress, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RevokeSnapshotAccessOutcome> RevokeSnapshotAccessAwaitable(const Model::RevokeSnapshotAccessRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::RevokeSnapshotAccess, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RevokeSnapshotAccessOutcome> RevokeSnapshotAccessAwaitable(Model::RevokeSnapshotAccessRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::RevokeSnapshotAccess, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RotateEncryptionKeyOutcome> RotateEncryptionKeyAwaitable(const Model::RotateEncryptionKeyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::RotateEncryptionKey, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RotateEncryptionKeyOutcome> RotateEncryptionKeyAwaitable(Model::RotateEncryptionKeyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &RedshiftClient::RotateEncryptionKey, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -168,12 +168,22 @@ AuthorizeClusterSecurityGroupIngressOutcome RedshiftClient::AuthorizeClusterSecu
 
 AuthorizeClusterSecurityGroupIngressOutcomeCallable RedshiftClient::AuthorizeClusterSecurityGroupIngressCallable(const AuthorizeClusterSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::AuthorizeClusterSecurityGroupIngress, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::AuthorizeClusterSecurityGroupIngress, Aws::Client::RejectedCallOutcome<AuthorizeClusterSecurityGroupIngressOutcome>(), this, request);
+}
+
+AuthorizeClusterSecurityGroupIngressOutcomeCallable RedshiftClient::AuthorizeClusterSecurityGroupIngressCallable(AuthorizeClusterSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::AuthorizeClusterSecurityGroupIngress, Aws::Client::RejectedCallOutcome<AuthorizeClusterSecurityGroupIngressOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::AuthorizeClusterSecurityGroupIngressAsync(const AuthorizeClusterSecurityGroupIngressRequest& request, const AuthorizeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::AuthorizeClusterSecurityGroupIngressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::AuthorizeClusterSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<AuthorizeClusterSecurityGroupIngressOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::AuthorizeClusterSecurityGroupIngressAsync(AuthorizeClusterSecurityGroupIngressRequest&& request, const AuthorizeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::AuthorizeClusterSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<AuthorizeClusterSecurityGroupIngressOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::AuthorizeClusterSecurityGroupIngressAsyncHelper(const AuthorizeClusterSecurityGroupIngressRequest& request, const AuthorizeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -198,12 +208,22 @@ AuthorizeSnapshotAccessOutcome RedshiftClient::AuthorizeSnapshotAccess(const Aut
 
 AuthorizeSnapshotAccessOutcomeCallable RedshiftClient::AuthorizeSnapshotAccessCallable(const AuthorizeSnapshotAccessRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::AuthorizeSnapshotAccess, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::AuthorizeSnapshotAccess, Aws::Client::RejectedCallOutcome<AuthorizeSnapshotAccessOutcome>(), this, request);
+}
+
+AuthorizeSnapshotAccessOutcomeCallable RedshiftClient::AuthorizeSnapshotAccessCallable(AuthorizeSnapshotAccessRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::AuthorizeSnapshotAccess, Aws::Client::RejectedCallOutcome<AuthorizeSnapshotAccessOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::AuthorizeSnapshotAccessAsync(const AuthorizeSnapshotAccessRequest& request, const AuthorizeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::AuthorizeSnapshotAccessAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::AuthorizeSnapshotAccessAsyncHelper, Aws::Client::RejectedAsyncCall<AuthorizeSnapshotAccessOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::AuthorizeSnapshotAccessAsync(AuthorizeSnapshotAccessRequest&& request, const AuthorizeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::AuthorizeSnapshotAccessAsyncHelper, Aws::Client::RejectedAsyncCall<AuthorizeSnapshotAccessOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::AuthorizeSnapshotAccessAsyncHelper(const AuthorizeSnapshotAccessRequest& request, const AuthorizeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -228,12 +248,22 @@ CopyClusterSnapshotOutcome RedshiftClient::CopyClusterSnapshot(const CopyCluster
 
 CopyClusterSnapshotOutcomeCallable RedshiftClient::CopyClusterSnapshotCallable(const CopyClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::CopyClusterSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::CopyClusterSnapshot, Aws::Client::RejectedCallOutcome<CopyClusterSnapshotOutcome>(), this, request);
+}
+
+CopyClusterSnapshotOutcomeCallable RedshiftClient::CopyClusterSnapshotCallable(CopyClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::CopyClusterSnapshot, Aws::Client::RejectedCallOutcome<CopyClusterSnapshotOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::CopyClusterSnapshotAsync(const CopyClusterSnapshotRequest& request, const CopyClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::CopyClusterSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::CopyClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CopyClusterSnapshotOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::CopyClusterSnapshotAsync(CopyClusterSnapshotRequest&& request, const CopyClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::CopyClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CopyClusterSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::CopyClusterSnapshotAsyncHelper(const CopyClusterSnapshotRequest& request, const CopyClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -258,12 +288,22 @@ CreateClusterOutcome RedshiftClient::CreateCluster(const CreateClusterRequest& r
 
 CreateClusterOutcomeCallable RedshiftClient::CreateClusterCallable(const CreateClusterRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::CreateCluster, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateCluster, Aws::Client::RejectedCallOutcome<CreateClusterOutcome>(), this, request);
+}
+
+CreateClusterOutcomeCallable RedshiftClient::CreateClusterCallable(CreateClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateCluster, Aws::Client::RejectedCallOutcome<CreateClusterOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::CreateClusterAsync(const CreateClusterRequest& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::CreateClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::CreateClusterAsyncHelper, Aws::Client::RejectedAsyncCall<CreateClusterOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::CreateClusterAsync(CreateClusterRequest&& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::CreateClusterAsyncHelper, Aws::Client::RejectedAsyncCall<CreateClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::CreateClusterAsyncHelper(const CreateClusterRequest& request, const CreateClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -288,12 +328,22 @@ CreateClusterParameterGroupOutcome RedshiftClient::CreateClusterParameterGroup(c
 
 CreateClusterParameterGroupOutcomeCallable RedshiftClient::CreateClusterParameterGroupCallable(const CreateClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::CreateClusterParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateClusterParameterGroup, Aws::Client::RejectedCallOutcome<CreateClusterParameterGroupOutcome>(), this, request);
+}
+
+CreateClusterParameterGroupOutcomeCallable RedshiftClient::CreateClusterParameterGroupCallable(CreateClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateClusterParameterGroup, Aws::Client::RejectedCallOutcome<CreateClusterParameterGroupOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::CreateClusterParameterGroupAsync(const CreateClusterParameterGroupRequest& request, const CreateClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::CreateClusterParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::CreateClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateClusterParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::CreateClusterParameterGroupAsync(CreateClusterParameterGroupRequest&& request, const CreateClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::CreateClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateClusterParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::CreateClusterParameterGroupAsyncHelper(const CreateClusterParameterGroupRequest& request, const CreateClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -318,12 +368,22 @@ CreateClusterSecurityGroupOutcome RedshiftClient::CreateClusterSecurityGroup(con
 
 CreateClusterSecurityGroupOutcomeCallable RedshiftClient::CreateClusterSecurityGroupCallable(const CreateClusterSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::CreateClusterSecurityGroup, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateClusterSecurityGroup, Aws::Client::RejectedCallOutcome<CreateClusterSecurityGroupOutcome>(), this, request);
+}
+
+CreateClusterSecurityGroupOutcomeCallable RedshiftClient::CreateClusterSecurityGroupCallable(CreateClusterSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateClusterSecurityGroup, Aws::Client::RejectedCallOutcome<CreateClusterSecurityGroupOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::CreateClusterSecurityGroupAsync(const CreateClusterSecurityGroupRequest& request, const CreateClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::CreateClusterSecurityGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::CreateClusterSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateClusterSecurityGroupOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::CreateClusterSecurityGroupAsync(CreateClusterSecurityGroupRequest&& request, const CreateClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::CreateClusterSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateClusterSecurityGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::CreateClusterSecurityGroupAsyncHelper(const CreateClusterSecurityGroupRequest& request, const CreateClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -348,12 +408,22 @@ CreateClusterSnapshotOutcome RedshiftClient::CreateClusterSnapshot(const CreateC
 
 CreateClusterSnapshotOutcomeCallable RedshiftClient::CreateClusterSnapshotCallable(const CreateClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::CreateClusterSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateClusterSnapshot, Aws::Client::RejectedCallOutcome<CreateClusterSnapshotOutcome>(), this, request);
+}
+
+CreateClusterSnapshotOutcomeCallable RedshiftClient::CreateClusterSnapshotCallable(CreateClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateClusterSnapshot, Aws::Client::RejectedCallOutcome<CreateClusterSnapshotOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::CreateClusterSnapshotAsync(const CreateClusterSnapshotRequest& request, const CreateClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::CreateClusterSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::CreateClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CreateClusterSnapshotOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::CreateClusterSnapshotAsync(CreateClusterSnapshotRequest&& request, const CreateClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::CreateClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CreateClusterSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::CreateClusterSnapshotAsyncHelper(const CreateClusterSnapshotRequest& request, const CreateClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -378,12 +448,22 @@ CreateClusterSubnetGroupOutcome RedshiftClient::CreateClusterSubnetGroup(const C
 
 CreateClusterSubnetGroupOutcomeCallable RedshiftClient::CreateClusterSubnetGroupCallable(const CreateClusterSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::CreateClusterSubnetGroup, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateClusterSubnetGroup, Aws::Client::RejectedCallOutcome<CreateClusterSubnetGroupOutcome>(), this, request);
+}
+
+CreateClusterSubnetGroupOutcomeCallable RedshiftClient::CreateClusterSubnetGroupCallable(CreateClusterSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateClusterSubnetGroup, Aws::Client::RejectedCallOutcome<CreateClusterSubnetGroupOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::CreateClusterSubnetGroupAsync(const CreateClusterSubnetGroupRequest& request, const CreateClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::CreateClusterSubnetGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::CreateClusterSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateClusterSubnetGroupOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::CreateClusterSubnetGroupAsync(CreateClusterSubnetGroupRequest&& request, const CreateClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::CreateClusterSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<CreateClusterSubnetGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::CreateClusterSubnetGroupAsyncHelper(const CreateClusterSubnetGroupRequest& request, const CreateClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -408,12 +488,22 @@ CreateEventSubscriptionOutcome RedshiftClient::CreateEventSubscription(const Cre
 
 CreateEventSubscriptionOutcomeCallable RedshiftClient::CreateEventSubscriptionCallable(const CreateEventSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::CreateEventSubscription, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateEventSubscription, Aws::Client::RejectedCallOutcome<CreateEventSubscriptionOutcome>(), this, request);
+}
+
+CreateEventSubscriptionOutcomeCallable RedshiftClient::CreateEventSubscriptionCallable(CreateEventSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateEventSubscription, Aws::Client::RejectedCallOutcome<CreateEventSubscriptionOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::CreateEventSubscriptionAsync(const CreateEventSubscriptionRequest& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::CreateEventSubscriptionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::CreateEventSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateEventSubscriptionOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::CreateEventSubscriptionAsync(CreateEventSubscriptionRequest&& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::CreateEventSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateEventSubscriptionOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::CreateEventSubscriptionAsyncHelper(const CreateEventSubscriptionRequest& request, const CreateEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -438,12 +528,22 @@ CreateHsmClientCertificateOutcome RedshiftClient::CreateHsmClientCertificate(con
 
 CreateHsmClientCertificateOutcomeCallable RedshiftClient::CreateHsmClientCertificateCallable(const CreateHsmClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::CreateHsmClientCertificate, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateHsmClientCertificate, Aws::Client::RejectedCallOutcome<CreateHsmClientCertificateOutcome>(), this, request);
+}
+
+CreateHsmClientCertificateOutcomeCallable RedshiftClient::CreateHsmClientCertificateCallable(CreateHsmClientCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateHsmClientCertificate, Aws::Client::RejectedCallOutcome<CreateHsmClientCertificateOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::CreateHsmClientCertificateAsync(const CreateHsmClientCertificateRequest& request, const CreateHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::CreateHsmClientCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::CreateHsmClientCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<CreateHsmClientCertificateOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::CreateHsmClientCertificateAsync(CreateHsmClientCertificateRequest&& request, const CreateHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::CreateHsmClientCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<CreateHsmClientCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::CreateHsmClientCertificateAsyncHelper(const CreateHsmClientCertificateRequest& request, const CreateHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -468,12 +568,22 @@ CreateHsmConfigurationOutcome RedshiftClient::CreateHsmConfiguration(const Creat
 
 CreateHsmConfigurationOutcomeCallable RedshiftClient::CreateHsmConfigurationCallable(const CreateHsmConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::CreateHsmConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateHsmConfiguration, Aws::Client::RejectedCallOutcome<CreateHsmConfigurationOutcome>(), this, request);
+}
+
+CreateHsmConfigurationOutcomeCallable RedshiftClient::CreateHsmConfigurationCallable(CreateHsmConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateHsmConfiguration, Aws::Client::RejectedCallOutcome<CreateHsmConfigurationOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::CreateHsmConfigurationAsync(const CreateHsmConfigurationRequest& request, const CreateHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::CreateHsmConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::CreateHsmConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateHsmConfigurationOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::CreateHsmConfigurationAsync(CreateHsmConfigurationRequest&& request, const CreateHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::CreateHsmConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateHsmConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::CreateHsmConfigurationAsyncHelper(const CreateHsmConfigurationRequest& request, const CreateHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -498,12 +608,22 @@ CreateSnapshotCopyGrantOutcome RedshiftClient::CreateSnapshotCopyGrant(const Cre
 
 CreateSnapshotCopyGrantOutcomeCallable RedshiftClient::CreateSnapshotCopyGrantCallable(const CreateSnapshotCopyGrantRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::CreateSnapshotCopyGrant, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateSnapshotCopyGrant, Aws::Client::RejectedCallOutcome<CreateSnapshotCopyGrantOutcome>(), this, request);
+}
+
+CreateSnapshotCopyGrantOutcomeCallable RedshiftClient::CreateSnapshotCopyGrantCallable(CreateSnapshotCopyGrantRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateSnapshotCopyGrant, Aws::Client::RejectedCallOutcome<CreateSnapshotCopyGrantOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::CreateSnapshotCopyGrantAsync(const CreateSnapshotCopyGrantRequest& request, const CreateSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::CreateSnapshotCopyGrantAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::CreateSnapshotCopyGrantAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSnapshotCopyGrantOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::CreateSnapshotCopyGrantAsync(CreateSnapshotCopyGrantRequest&& request, const CreateSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::CreateSnapshotCopyGrantAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSnapshotCopyGrantOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::CreateSnapshotCopyGrantAsyncHelper(const CreateSnapshotCopyGrantRequest& request, const CreateSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -528,12 +648,22 @@ CreateTagsOutcome RedshiftClient::CreateTags(const CreateTagsRequest& request) c
 
 CreateTagsOutcomeCallable RedshiftClient::CreateTagsCallable(const CreateTagsRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::CreateTags, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateTags, Aws::Client::RejectedCallOutcome<CreateTagsOutcome>(), this, request);
+}
+
+CreateTagsOutcomeCallable RedshiftClient::CreateTagsCallable(CreateTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::CreateTags, Aws::Client::RejectedCallOutcome<CreateTagsOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::CreateTagsAsync(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::CreateTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::CreateTagsAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTagsOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::CreateTagsAsync(CreateTagsRequest&& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::CreateTagsAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::CreateTagsAsyncHelper(const CreateTagsRequest& request, const CreateTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -558,12 +688,22 @@ DeleteClusterOutcome RedshiftClient::DeleteCluster(const DeleteClusterRequest& r
 
 DeleteClusterOutcomeCallable RedshiftClient::DeleteClusterCallable(const DeleteClusterRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DeleteCluster, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteCluster, Aws::Client::RejectedCallOutcome<DeleteClusterOutcome>(), this, request);
+}
+
+DeleteClusterOutcomeCallable RedshiftClient::DeleteClusterCallable(DeleteClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteCluster, Aws::Client::RejectedCallOutcome<DeleteClusterOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DeleteClusterAsync(const DeleteClusterRequest& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DeleteClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteClusterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteClusterOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DeleteClusterAsync(DeleteClusterRequest&& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteClusterAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DeleteClusterAsyncHelper(const DeleteClusterRequest& request, const DeleteClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -588,12 +728,22 @@ DeleteClusterParameterGroupOutcome RedshiftClient::DeleteClusterParameterGroup(c
 
 DeleteClusterParameterGroupOutcomeCallable RedshiftClient::DeleteClusterParameterGroupCallable(const DeleteClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DeleteClusterParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteClusterParameterGroup, Aws::Client::RejectedCallOutcome<DeleteClusterParameterGroupOutcome>(), this, request);
+}
+
+DeleteClusterParameterGroupOutcomeCallable RedshiftClient::DeleteClusterParameterGroupCallable(DeleteClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteClusterParameterGroup, Aws::Client::RejectedCallOutcome<DeleteClusterParameterGroupOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DeleteClusterParameterGroupAsync(const DeleteClusterParameterGroupRequest& request, const DeleteClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DeleteClusterParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteClusterParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DeleteClusterParameterGroupAsync(DeleteClusterParameterGroupRequest&& request, const DeleteClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteClusterParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DeleteClusterParameterGroupAsyncHelper(const DeleteClusterParameterGroupRequest& request, const DeleteClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -618,12 +768,22 @@ DeleteClusterSecurityGroupOutcome RedshiftClient::DeleteClusterSecurityGroup(con
 
 DeleteClusterSecurityGroupOutcomeCallable RedshiftClient::DeleteClusterSecurityGroupCallable(const DeleteClusterSecurityGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DeleteClusterSecurityGroup, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteClusterSecurityGroup, Aws::Client::RejectedCallOutcome<DeleteClusterSecurityGroupOutcome>(), this, request);
+}
+
+DeleteClusterSecurityGroupOutcomeCallable RedshiftClient::DeleteClusterSecurityGroupCallable(DeleteClusterSecurityGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteClusterSecurityGroup, Aws::Client::RejectedCallOutcome<DeleteClusterSecurityGroupOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DeleteClusterSecurityGroupAsync(const DeleteClusterSecurityGroupRequest& request, const DeleteClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DeleteClusterSecurityGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteClusterSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteClusterSecurityGroupOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DeleteClusterSecurityGroupAsync(DeleteClusterSecurityGroupRequest&& request, const DeleteClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteClusterSecurityGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteClusterSecurityGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DeleteClusterSecurityGroupAsyncHelper(const DeleteClusterSecurityGroupRequest& request, const DeleteClusterSecurityGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -648,12 +808,22 @@ DeleteClusterSnapshotOutcome RedshiftClient::DeleteClusterSnapshot(const DeleteC
 
 DeleteClusterSnapshotOutcomeCallable RedshiftClient::DeleteClusterSnapshotCallable(const DeleteClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DeleteClusterSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteClusterSnapshot, Aws::Client::RejectedCallOutcome<DeleteClusterSnapshotOutcome>(), this, request);
+}
+
+DeleteClusterSnapshotOutcomeCallable RedshiftClient::DeleteClusterSnapshotCallable(DeleteClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteClusterSnapshot, Aws::Client::RejectedCallOutcome<DeleteClusterSnapshotOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DeleteClusterSnapshotAsync(const DeleteClusterSnapshotRequest& request, const DeleteClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DeleteClusterSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteClusterSnapshotOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DeleteClusterSnapshotAsync(DeleteClusterSnapshotRequest&& request, const DeleteClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteClusterSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DeleteClusterSnapshotAsyncHelper(const DeleteClusterSnapshotRequest& request, const DeleteClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -678,12 +848,22 @@ DeleteClusterSubnetGroupOutcome RedshiftClient::DeleteClusterSubnetGroup(const D
 
 DeleteClusterSubnetGroupOutcomeCallable RedshiftClient::DeleteClusterSubnetGroupCallable(const DeleteClusterSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DeleteClusterSubnetGroup, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteClusterSubnetGroup, Aws::Client::RejectedCallOutcome<DeleteClusterSubnetGroupOutcome>(), this, request);
+}
+
+DeleteClusterSubnetGroupOutcomeCallable RedshiftClient::DeleteClusterSubnetGroupCallable(DeleteClusterSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteClusterSubnetGroup, Aws::Client::RejectedCallOutcome<DeleteClusterSubnetGroupOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DeleteClusterSubnetGroupAsync(const DeleteClusterSubnetGroupRequest& request, const DeleteClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DeleteClusterSubnetGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteClusterSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteClusterSubnetGroupOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DeleteClusterSubnetGroupAsync(DeleteClusterSubnetGroupRequest&& request, const DeleteClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteClusterSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteClusterSubnetGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DeleteClusterSubnetGroupAsyncHelper(const DeleteClusterSubnetGroupRequest& request, const DeleteClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -708,12 +888,22 @@ DeleteEventSubscriptionOutcome RedshiftClient::DeleteEventSubscription(const Del
 
 DeleteEventSubscriptionOutcomeCallable RedshiftClient::DeleteEventSubscriptionCallable(const DeleteEventSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DeleteEventSubscription, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteEventSubscription, Aws::Client::RejectedCallOutcome<DeleteEventSubscriptionOutcome>(), this, request);
+}
+
+DeleteEventSubscriptionOutcomeCallable RedshiftClient::DeleteEventSubscriptionCallable(DeleteEventSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteEventSubscription, Aws::Client::RejectedCallOutcome<DeleteEventSubscriptionOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DeleteEventSubscriptionAsync(const DeleteEventSubscriptionRequest& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DeleteEventSubscriptionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteEventSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteEventSubscriptionOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DeleteEventSubscriptionAsync(DeleteEventSubscriptionRequest&& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteEventSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteEventSubscriptionOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DeleteEventSubscriptionAsyncHelper(const DeleteEventSubscriptionRequest& request, const DeleteEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -738,12 +928,22 @@ DeleteHsmClientCertificateOutcome RedshiftClient::DeleteHsmClientCertificate(con
 
 DeleteHsmClientCertificateOutcomeCallable RedshiftClient::DeleteHsmClientCertificateCallable(const DeleteHsmClientCertificateRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DeleteHsmClientCertificate, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteHsmClientCertificate, Aws::Client::RejectedCallOutcome<DeleteHsmClientCertificateOutcome>(), this, request);
+}
+
+DeleteHsmClientCertificateOutcomeCallable RedshiftClient::DeleteHsmClientCertificateCallable(DeleteHsmClientCertificateRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteHsmClientCertificate, Aws::Client::RejectedCallOutcome<DeleteHsmClientCertificateOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DeleteHsmClientCertificateAsync(const DeleteHsmClientCertificateRequest& request, const DeleteHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DeleteHsmClientCertificateAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteHsmClientCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteHsmClientCertificateOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DeleteHsmClientCertificateAsync(DeleteHsmClientCertificateRequest&& request, const DeleteHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteHsmClientCertificateAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteHsmClientCertificateOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DeleteHsmClientCertificateAsyncHelper(const DeleteHsmClientCertificateRequest& request, const DeleteHsmClientCertificateResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -768,12 +968,22 @@ DeleteHsmConfigurationOutcome RedshiftClient::DeleteHsmConfiguration(const Delet
 
 DeleteHsmConfigurationOutcomeCallable RedshiftClient::DeleteHsmConfigurationCallable(const DeleteHsmConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DeleteHsmConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteHsmConfiguration, Aws::Client::RejectedCallOutcome<DeleteHsmConfigurationOutcome>(), this, request);
+}
+
+DeleteHsmConfigurationOutcomeCallable RedshiftClient::DeleteHsmConfigurationCallable(DeleteHsmConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteHsmConfiguration, Aws::Client::RejectedCallOutcome<DeleteHsmConfigurationOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DeleteHsmConfigurationAsync(const DeleteHsmConfigurationRequest& request, const DeleteHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DeleteHsmConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteHsmConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteHsmConfigurationOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DeleteHsmConfigurationAsync(DeleteHsmConfigurationRequest&& request, const DeleteHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteHsmConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteHsmConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DeleteHsmConfigurationAsyncHelper(const DeleteHsmConfigurationRequest& request, const DeleteHsmConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -798,12 +1008,22 @@ DeleteSnapshotCopyGrantOutcome RedshiftClient::DeleteSnapshotCopyGrant(const Del
 
 DeleteSnapshotCopyGrantOutcomeCallable RedshiftClient::DeleteSnapshotCopyGrantCallable(const DeleteSnapshotCopyGrantRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DeleteSnapshotCopyGrant, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteSnapshotCopyGrant, Aws::Client::RejectedCallOutcome<DeleteSnapshotCopyGrantOutcome>(), this, request);
+}
+
+DeleteSnapshotCopyGrantOutcomeCallable RedshiftClient::DeleteSnapshotCopyGrantCallable(DeleteSnapshotCopyGrantRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteSnapshotCopyGrant, Aws::Client::RejectedCallOutcome<DeleteSnapshotCopyGrantOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DeleteSnapshotCopyGrantAsync(const DeleteSnapshotCopyGrantRequest& request, const DeleteSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DeleteSnapshotCopyGrantAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteSnapshotCopyGrantAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSnapshotCopyGrantOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DeleteSnapshotCopyGrantAsync(DeleteSnapshotCopyGrantRequest&& request, const DeleteSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteSnapshotCopyGrantAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSnapshotCopyGrantOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DeleteSnapshotCopyGrantAsyncHelper(const DeleteSnapshotCopyGrantRequest& request, const DeleteSnapshotCopyGrantResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -828,12 +1048,22 @@ DeleteTagsOutcome RedshiftClient::DeleteTags(const DeleteTagsRequest& request) c
 
 DeleteTagsOutcomeCallable RedshiftClient::DeleteTagsCallable(const DeleteTagsRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DeleteTags, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteTags, Aws::Client::RejectedCallOutcome<DeleteTagsOutcome>(), this, request);
+}
+
+DeleteTagsOutcomeCallable RedshiftClient::DeleteTagsCallable(DeleteTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DeleteTags, Aws::Client::RejectedCallOutcome<DeleteTagsOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DeleteTagsAsync(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DeleteTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTagsOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DeleteTagsAsync(DeleteTagsRequest&& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DeleteTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DeleteTagsAsyncHelper(const DeleteTagsRequest& request, const DeleteTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -858,12 +1088,22 @@ DescribeClusterParameterGroupsOutcome RedshiftClient::DescribeClusterParameterGr
 
 DescribeClusterParameterGroupsOutcomeCallable RedshiftClient::DescribeClusterParameterGroupsCallable(const DescribeClusterParameterGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeClusterParameterGroups, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeClusterParameterGroups, Aws::Client::RejectedCallOutcome<DescribeClusterParameterGroupsOutcome>(), this, request);
+}
+
+DescribeClusterParameterGroupsOutcomeCallable RedshiftClient::DescribeClusterParameterGroupsCallable(DescribeClusterParameterGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeClusterParameterGroups, Aws::Client::RejectedCallOutcome<DescribeClusterParameterGroupsOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeClusterParameterGroupsAsync(const DescribeClusterParameterGroupsRequest& request, const DescribeClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeClusterParameterGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeClusterParameterGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClusterParameterGroupsOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeClusterParameterGroupsAsync(DescribeClusterParameterGroupsRequest&& request, const DescribeClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeClusterParameterGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClusterParameterGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeClusterParameterGroupsAsyncHelper(const DescribeClusterParameterGroupsRequest& request, const DescribeClusterParameterGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -888,12 +1128,22 @@ DescribeClusterParametersOutcome RedshiftClient::DescribeClusterParameters(const
 
 DescribeClusterParametersOutcomeCallable RedshiftClient::DescribeClusterParametersCallable(const DescribeClusterParametersRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeClusterParameters, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeClusterParameters, Aws::Client::RejectedCallOutcome<DescribeClusterParametersOutcome>(), this, request);
+}
+
+DescribeClusterParametersOutcomeCallable RedshiftClient::DescribeClusterParametersCallable(DescribeClusterParametersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeClusterParameters, Aws::Client::RejectedCallOutcome<DescribeClusterParametersOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeClusterParametersAsync(const DescribeClusterParametersRequest& request, const DescribeClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeClusterParametersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeClusterParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClusterParametersOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeClusterParametersAsync(DescribeClusterParametersRequest&& request, const DescribeClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeClusterParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClusterParametersOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeClusterParametersAsyncHelper(const DescribeClusterParametersRequest& request, const DescribeClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -918,12 +1168,22 @@ DescribeClusterSecurityGroupsOutcome RedshiftClient::DescribeClusterSecurityGrou
 
 DescribeClusterSecurityGroupsOutcomeCallable RedshiftClient::DescribeClusterSecurityGroupsCallable(const DescribeClusterSecurityGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeClusterSecurityGroups, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeClusterSecurityGroups, Aws::Client::RejectedCallOutcome<DescribeClusterSecurityGroupsOutcome>(), this, request);
+}
+
+DescribeClusterSecurityGroupsOutcomeCallable RedshiftClient::DescribeClusterSecurityGroupsCallable(DescribeClusterSecurityGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeClusterSecurityGroups, Aws::Client::RejectedCallOutcome<DescribeClusterSecurityGroupsOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeClusterSecurityGroupsAsync(const DescribeClusterSecurityGroupsRequest& request, const DescribeClusterSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeClusterSecurityGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeClusterSecurityGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClusterSecurityGroupsOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeClusterSecurityGroupsAsync(DescribeClusterSecurityGroupsRequest&& request, const DescribeClusterSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeClusterSecurityGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClusterSecurityGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeClusterSecurityGroupsAsyncHelper(const DescribeClusterSecurityGroupsRequest& request, const DescribeClusterSecurityGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -948,12 +1208,22 @@ DescribeClusterSnapshotsOutcome RedshiftClient::DescribeClusterSnapshots(const D
 
 DescribeClusterSnapshotsOutcomeCallable RedshiftClient::DescribeClusterSnapshotsCallable(const DescribeClusterSnapshotsRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeClusterSnapshots, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeClusterSnapshots, Aws::Client::RejectedCallOutcome<DescribeClusterSnapshotsOutcome>(), this, request);
+}
+
+DescribeClusterSnapshotsOutcomeCallable RedshiftClient::DescribeClusterSnapshotsCallable(DescribeClusterSnapshotsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeClusterSnapshots, Aws::Client::RejectedCallOutcome<DescribeClusterSnapshotsOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeClusterSnapshotsAsync(const DescribeClusterSnapshotsRequest& request, const DescribeClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeClusterSnapshotsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeClusterSnapshotsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClusterSnapshotsOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeClusterSnapshotsAsync(DescribeClusterSnapshotsRequest&& request, const DescribeClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeClusterSnapshotsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClusterSnapshotsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeClusterSnapshotsAsyncHelper(const DescribeClusterSnapshotsRequest& request, const DescribeClusterSnapshotsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -978,12 +1248,22 @@ DescribeClusterSubnetGroupsOutcome RedshiftClient::DescribeClusterSubnetGroups(c
 
 DescribeClusterSubnetGroupsOutcomeCallable RedshiftClient::DescribeClusterSubnetGroupsCallable(const DescribeClusterSubnetGroupsRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeClusterSubnetGroups, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeClusterSubnetGroups, Aws::Client::RejectedCallOutcome<DescribeClusterSubnetGroupsOutcome>(), this, request);
+}
+
+DescribeClusterSubnetGroupsOutcomeCallable RedshiftClient::DescribeClusterSubnetGroupsCallable(DescribeClusterSubnetGroupsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeClusterSubnetGroups, Aws::Client::RejectedCallOutcome<DescribeClusterSubnetGroupsOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeClusterSubnetGroupsAsync(const DescribeClusterSubnetGroupsRequest& request, const DescribeClusterSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeClusterSubnetGroupsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeClusterSubnetGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClusterSubnetGroupsOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeClusterSubnetGroupsAsync(DescribeClusterSubnetGroupsRequest&& request, const DescribeClusterSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeClusterSubnetGroupsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClusterSubnetGroupsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeClusterSubnetGroupsAsyncHelper(const DescribeClusterSubnetGroupsRequest& request, const DescribeClusterSubnetGroupsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1008,12 +1288,22 @@ DescribeClusterVersionsOutcome RedshiftClient::DescribeClusterVersions(const Des
 
 DescribeClusterVersionsOutcomeCallable RedshiftClient::DescribeClusterVersionsCallable(const DescribeClusterVersionsRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeClusterVersions, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeClusterVersions, Aws::Client::RejectedCallOutcome<DescribeClusterVersionsOutcome>(), this, request);
+}
+
+DescribeClusterVersionsOutcomeCallable RedshiftClient::DescribeClusterVersionsCallable(DescribeClusterVersionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeClusterVersions, Aws::Client::RejectedCallOutcome<DescribeClusterVersionsOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeClusterVersionsAsync(const DescribeClusterVersionsRequest& request, const DescribeClusterVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeClusterVersionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeClusterVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClusterVersionsOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeClusterVersionsAsync(DescribeClusterVersionsRequest&& request, const DescribeClusterVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeClusterVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClusterVersionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeClusterVersionsAsyncHelper(const DescribeClusterVersionsRequest& request, const DescribeClusterVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1038,12 +1328,22 @@ DescribeClustersOutcome RedshiftClient::DescribeClusters(const DescribeClustersR
 
 DescribeClustersOutcomeCallable RedshiftClient::DescribeClustersCallable(const DescribeClustersRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeClusters, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeClusters, Aws::Client::RejectedCallOutcome<DescribeClustersOutcome>(), this, request);
+}
+
+DescribeClustersOutcomeCallable RedshiftClient::DescribeClustersCallable(DescribeClustersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeClusters, Aws::Client::RejectedCallOutcome<DescribeClustersOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeClustersAsync(const DescribeClustersRequest& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeClustersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeClustersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClustersOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeClustersAsync(DescribeClustersRequest&& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeClustersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeClustersOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeClustersAsyncHelper(const DescribeClustersRequest& request, const DescribeClustersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1068,12 +1368,22 @@ DescribeDefaultClusterParametersOutcome RedshiftClient::DescribeDefaultClusterPa
 
 DescribeDefaultClusterParametersOutcomeCallable RedshiftClient::DescribeDefaultClusterParametersCallable(const DescribeDefaultClusterParametersRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeDefaultClusterParameters, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeDefaultClusterParameters, Aws::Client::RejectedCallOutcome<DescribeDefaultClusterParametersOutcome>(), this, request);
+}
+
+DescribeDefaultClusterParametersOutcomeCallable RedshiftClient::DescribeDefaultClusterParametersCallable(DescribeDefaultClusterParametersRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeDefaultClusterParameters, Aws::Client::RejectedCallOutcome<DescribeDefaultClusterParametersOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeDefaultClusterParametersAsync(const DescribeDefaultClusterParametersRequest& request, const DescribeDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeDefaultClusterParametersAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeDefaultClusterParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDefaultClusterParametersOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeDefaultClusterParametersAsync(DescribeDefaultClusterParametersRequest&& request, const DescribeDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeDefaultClusterParametersAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDefaultClusterParametersOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeDefaultClusterParametersAsyncHelper(const DescribeDefaultClusterParametersRequest& request, const DescribeDefaultClusterParametersResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1098,12 +1408,22 @@ DescribeEventCategoriesOutcome RedshiftClient::DescribeEventCategories(const Des
 
 DescribeEventCategoriesOutcomeCallable RedshiftClient::DescribeEventCategoriesCallable(const DescribeEventCategoriesRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeEventCategories, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeEventCategories, Aws::Client::RejectedCallOutcome<DescribeEventCategoriesOutcome>(), this, request);
+}
+
+DescribeEventCategoriesOutcomeCallable RedshiftClient::DescribeEventCategoriesCallable(DescribeEventCategoriesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeEventCategories, Aws::Client::RejectedCallOutcome<DescribeEventCategoriesOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeEventCategoriesAsync(const DescribeEventCategoriesRequest& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeEventCategoriesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeEventCategoriesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventCategoriesOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeEventCategoriesAsync(DescribeEventCategoriesRequest&& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeEventCategoriesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventCategoriesOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeEventCategoriesAsyncHelper(const DescribeEventCategoriesRequest& request, const DescribeEventCategoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1128,12 +1448,22 @@ DescribeEventSubscriptionsOutcome RedshiftClient::DescribeEventSubscriptions(con
 
 DescribeEventSubscriptionsOutcomeCallable RedshiftClient::DescribeEventSubscriptionsCallable(const DescribeEventSubscriptionsRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeEventSubscriptions, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeEventSubscriptions, Aws::Client::RejectedCallOutcome<DescribeEventSubscriptionsOutcome>(), this, request);
+}
+
+DescribeEventSubscriptionsOutcomeCallable RedshiftClient::DescribeEventSubscriptionsCallable(DescribeEventSubscriptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeEventSubscriptions, Aws::Client::RejectedCallOutcome<DescribeEventSubscriptionsOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeEventSubscriptionsAsync(const DescribeEventSubscriptionsRequest& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeEventSubscriptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeEventSubscriptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventSubscriptionsOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeEventSubscriptionsAsync(DescribeEventSubscriptionsRequest&& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeEventSubscriptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventSubscriptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeEventSubscriptionsAsyncHelper(const DescribeEventSubscriptionsRequest& request, const DescribeEventSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1158,12 +1488,22 @@ DescribeEventsOutcome RedshiftClient::DescribeEvents(const DescribeEventsRequest
 
 DescribeEventsOutcomeCallable RedshiftClient::DescribeEventsCallable(const DescribeEventsRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeEvents, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeEvents, Aws::Client::RejectedCallOutcome<DescribeEventsOutcome>(), this, request);
+}
+
+DescribeEventsOutcomeCallable RedshiftClient::DescribeEventsCallable(DescribeEventsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeEvents, Aws::Client::RejectedCallOutcome<DescribeEventsOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeEventsAsync(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeEventsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeEventsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventsOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeEventsAsync(DescribeEventsRequest&& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeEventsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeEventsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeEventsAsyncHelper(const DescribeEventsRequest& request, const DescribeEventsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1188,12 +1528,22 @@ DescribeHsmClientCertificatesOutcome RedshiftClient::DescribeHsmClientCertificat
 
 DescribeHsmClientCertificatesOutcomeCallable RedshiftClient::DescribeHsmClientCertificatesCallable(const DescribeHsmClientCertificatesRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeHsmClientCertificates, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeHsmClientCertificates, Aws::Client::RejectedCallOutcome<DescribeHsmClientCertificatesOutcome>(), this, request);
+}
+
+DescribeHsmClientCertificatesOutcomeCallable RedshiftClient::DescribeHsmClientCertificatesCallable(DescribeHsmClientCertificatesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeHsmClientCertificates, Aws::Client::RejectedCallOutcome<DescribeHsmClientCertificatesOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeHsmClientCertificatesAsync(const DescribeHsmClientCertificatesRequest& request, const DescribeHsmClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeHsmClientCertificatesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeHsmClientCertificatesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeHsmClientCertificatesOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeHsmClientCertificatesAsync(DescribeHsmClientCertificatesRequest&& request, const DescribeHsmClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeHsmClientCertificatesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeHsmClientCertificatesOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeHsmClientCertificatesAsyncHelper(const DescribeHsmClientCertificatesRequest& request, const DescribeHsmClientCertificatesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1218,12 +1568,22 @@ DescribeHsmConfigurationsOutcome RedshiftClient::DescribeHsmConfigurations(const
 
 DescribeHsmConfigurationsOutcomeCallable RedshiftClient::DescribeHsmConfigurationsCallable(const DescribeHsmConfigurationsRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeHsmConfigurations, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeHsmConfigurations, Aws::Client::RejectedCallOutcome<DescribeHsmConfigurationsOutcome>(), this, request);
+}
+
+DescribeHsmConfigurationsOutcomeCallable RedshiftClient::DescribeHsmConfigurationsCallable(DescribeHsmConfigurationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeHsmConfigurations, Aws::Client::RejectedCallOutcome<DescribeHsmConfigurationsOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeHsmConfigurationsAsync(const DescribeHsmConfigurationsRequest& request, const DescribeHsmConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeHsmConfigurationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeHsmConfigurationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeHsmConfigurationsOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeHsmConfigurationsAsync(DescribeHsmConfigurationsRequest&& request, const DescribeHsmConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeHsmConfigurationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeHsmConfigurationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeHsmConfigurationsAsyncHelper(const DescribeHsmConfigurationsRequest& request, const DescribeHsmConfigurationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1248,12 +1608,22 @@ DescribeLoggingStatusOutcome RedshiftClient::DescribeLoggingStatus(const Describ
 
 DescribeLoggingStatusOutcomeCallable RedshiftClient::DescribeLoggingStatusCallable(const DescribeLoggingStatusRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeLoggingStatus, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeLoggingStatus, Aws::Client::RejectedCallOutcome<DescribeLoggingStatusOutcome>(), this, request);
+}
+
+DescribeLoggingStatusOutcomeCallable RedshiftClient::DescribeLoggingStatusCallable(DescribeLoggingStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeLoggingStatus, Aws::Client::RejectedCallOutcome<DescribeLoggingStatusOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeLoggingStatusAsync(const DescribeLoggingStatusRequest& request, const DescribeLoggingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeLoggingStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeLoggingStatusAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLoggingStatusOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeLoggingStatusAsync(DescribeLoggingStatusRequest&& request, const DescribeLoggingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeLoggingStatusAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeLoggingStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeLoggingStatusAsyncHelper(const DescribeLoggingStatusRequest& request, const DescribeLoggingStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1278,12 +1648,22 @@ DescribeOrderableClusterOptionsOutcome RedshiftClient::DescribeOrderableClusterO
 
 DescribeOrderableClusterOptionsOutcomeCallable RedshiftClient::DescribeOrderableClusterOptionsCallable(const DescribeOrderableClusterOptionsRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeOrderableClusterOptions, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeOrderableClusterOptions, Aws::Client::RejectedCallOutcome<DescribeOrderableClusterOptionsOutcome>(), this, request);
+}
+
+DescribeOrderableClusterOptionsOutcomeCallable RedshiftClient::DescribeOrderableClusterOptionsCallable(DescribeOrderableClusterOptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeOrderableClusterOptions, Aws::Client::RejectedCallOutcome<DescribeOrderableClusterOptionsOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeOrderableClusterOptionsAsync(const DescribeOrderableClusterOptionsRequest& request, const DescribeOrderableClusterOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeOrderableClusterOptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeOrderableClusterOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeOrderableClusterOptionsOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeOrderableClusterOptionsAsync(DescribeOrderableClusterOptionsRequest&& request, const DescribeOrderableClusterOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeOrderableClusterOptionsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeOrderableClusterOptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeOrderableClusterOptionsAsyncHelper(const DescribeOrderableClusterOptionsRequest& request, const DescribeOrderableClusterOptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1308,12 +1688,22 @@ DescribeReservedNodeOfferingsOutcome RedshiftClient::DescribeReservedNodeOfferin
 
 DescribeReservedNodeOfferingsOutcomeCallable RedshiftClient::DescribeReservedNodeOfferingsCallable(const DescribeReservedNodeOfferingsRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeReservedNodeOfferings, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeReservedNodeOfferings, Aws::Client::RejectedCallOutcome<DescribeReservedNodeOfferingsOutcome>(), this, request);
+}
+
+DescribeReservedNodeOfferingsOutcomeCallable RedshiftClient::DescribeReservedNodeOfferingsCallable(DescribeReservedNodeOfferingsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeReservedNodeOfferings, Aws::Client::RejectedCallOutcome<DescribeReservedNodeOfferingsOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeReservedNodeOfferingsAsync(const DescribeReservedNodeOfferingsRequest& request, const DescribeReservedNodeOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeReservedNodeOfferingsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeReservedNodeOfferingsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedNodeOfferingsOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeReservedNodeOfferingsAsync(DescribeReservedNodeOfferingsRequest&& request, const DescribeReservedNodeOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeReservedNodeOfferingsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedNodeOfferingsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeReservedNodeOfferingsAsyncHelper(const DescribeReservedNodeOfferingsRequest& request, const DescribeReservedNodeOfferingsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1338,12 +1728,22 @@ DescribeReservedNodesOutcome RedshiftClient::DescribeReservedNodes(const Describ
 
 DescribeReservedNodesOutcomeCallable RedshiftClient::DescribeReservedNodesCallable(const DescribeReservedNodesRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeReservedNodes, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeReservedNodes, Aws::Client::RejectedCallOutcome<DescribeReservedNodesOutcome>(), this, request);
+}
+
+DescribeReservedNodesOutcomeCallable RedshiftClient::DescribeReservedNodesCallable(DescribeReservedNodesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeReservedNodes, Aws::Client::RejectedCallOutcome<DescribeReservedNodesOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeReservedNodesAsync(const DescribeReservedNodesRequest& request, const DescribeReservedNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeReservedNodesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeReservedNodesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedNodesOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeReservedNodesAsync(DescribeReservedNodesRequest&& request, const DescribeReservedNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeReservedNodesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeReservedNodesOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeReservedNodesAsyncHelper(const DescribeReservedNodesRequest& request, const DescribeReservedNodesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1368,12 +1768,22 @@ DescribeResizeOutcome RedshiftClient::DescribeResize(const DescribeResizeRequest
 
 DescribeResizeOutcomeCallable RedshiftClient::DescribeResizeCallable(const DescribeResizeRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeResize, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeResize, Aws::Client::RejectedCallOutcome<DescribeResizeOutcome>(), this, request);
+}
+
+DescribeResizeOutcomeCallable RedshiftClient::DescribeResizeCallable(DescribeResizeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeResize, Aws::Client::RejectedCallOutcome<DescribeResizeOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeResizeAsync(const DescribeResizeRequest& request, const DescribeResizeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeResizeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeResizeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeResizeOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeResizeAsync(DescribeResizeRequest&& request, const DescribeResizeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeResizeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeResizeOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeResizeAsyncHelper(const DescribeResizeRequest& request, const DescribeResizeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1398,12 +1808,22 @@ DescribeSnapshotCopyGrantsOutcome RedshiftClient::DescribeSnapshotCopyGrants(con
 
 DescribeSnapshotCopyGrantsOutcomeCallable RedshiftClient::DescribeSnapshotCopyGrantsCallable(const DescribeSnapshotCopyGrantsRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeSnapshotCopyGrants, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeSnapshotCopyGrants, Aws::Client::RejectedCallOutcome<DescribeSnapshotCopyGrantsOutcome>(), this, request);
+}
+
+DescribeSnapshotCopyGrantsOutcomeCallable RedshiftClient::DescribeSnapshotCopyGrantsCallable(DescribeSnapshotCopyGrantsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeSnapshotCopyGrants, Aws::Client::RejectedCallOutcome<DescribeSnapshotCopyGrantsOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeSnapshotCopyGrantsAsync(const DescribeSnapshotCopyGrantsRequest& request, const DescribeSnapshotCopyGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeSnapshotCopyGrantsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeSnapshotCopyGrantsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSnapshotCopyGrantsOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeSnapshotCopyGrantsAsync(DescribeSnapshotCopyGrantsRequest&& request, const DescribeSnapshotCopyGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeSnapshotCopyGrantsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSnapshotCopyGrantsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeSnapshotCopyGrantsAsyncHelper(const DescribeSnapshotCopyGrantsRequest& request, const DescribeSnapshotCopyGrantsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1428,12 +1848,22 @@ DescribeTableRestoreStatusOutcome RedshiftClient::DescribeTableRestoreStatus(con
 
 DescribeTableRestoreStatusOutcomeCallable RedshiftClient::DescribeTableRestoreStatusCallable(const DescribeTableRestoreStatusRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeTableRestoreStatus, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeTableRestoreStatus, Aws::Client::RejectedCallOutcome<DescribeTableRestoreStatusOutcome>(), this, request);
+}
+
+DescribeTableRestoreStatusOutcomeCallable RedshiftClient::DescribeTableRestoreStatusCallable(DescribeTableRestoreStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeTableRestoreStatus, Aws::Client::RejectedCallOutcome<DescribeTableRestoreStatusOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeTableRestoreStatusAsync(const DescribeTableRestoreStatusRequest& request, const DescribeTableRestoreStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeTableRestoreStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeTableRestoreStatusAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTableRestoreStatusOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeTableRestoreStatusAsync(DescribeTableRestoreStatusRequest&& request, const DescribeTableRestoreStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeTableRestoreStatusAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTableRestoreStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeTableRestoreStatusAsyncHelper(const DescribeTableRestoreStatusRequest& request, const DescribeTableRestoreStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1458,12 +1888,22 @@ DescribeTagsOutcome RedshiftClient::DescribeTags(const DescribeTagsRequest& requ
 
 DescribeTagsOutcomeCallable RedshiftClient::DescribeTagsCallable(const DescribeTagsRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DescribeTags, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeTags, Aws::Client::RejectedCallOutcome<DescribeTagsOutcome>(), this, request);
+}
+
+DescribeTagsOutcomeCallable RedshiftClient::DescribeTagsCallable(DescribeTagsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DescribeTags, Aws::Client::RejectedCallOutcome<DescribeTagsOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DescribeTagsAsync(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DescribeTagsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTagsOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DescribeTagsAsync(DescribeTagsRequest&& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DescribeTagsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTagsOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DescribeTagsAsyncHelper(const DescribeTagsRequest& request, const DescribeTagsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1488,12 +1928,22 @@ DisableLoggingOutcome RedshiftClient::DisableLogging(const DisableLoggingRequest
 
 DisableLoggingOutcomeCallable RedshiftClient::DisableLoggingCallable(const DisableLoggingRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DisableLogging, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DisableLogging, Aws::Client::RejectedCallOutcome<DisableLoggingOutcome>(), this, request);
+}
+
+DisableLoggingOutcomeCallable RedshiftClient::DisableLoggingCallable(DisableLoggingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DisableLogging, Aws::Client::RejectedCallOutcome<DisableLoggingOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DisableLoggingAsync(const DisableLoggingRequest& request, const DisableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DisableLoggingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DisableLoggingAsyncHelper, Aws::Client::RejectedAsyncCall<DisableLoggingOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DisableLoggingAsync(DisableLoggingRequest&& request, const DisableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DisableLoggingAsyncHelper, Aws::Client::RejectedAsyncCall<DisableLoggingOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DisableLoggingAsyncHelper(const DisableLoggingRequest& request, const DisableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1518,12 +1968,22 @@ DisableSnapshotCopyOutcome RedshiftClient::DisableSnapshotCopy(const DisableSnap
 
 DisableSnapshotCopyOutcomeCallable RedshiftClient::DisableSnapshotCopyCallable(const DisableSnapshotCopyRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::DisableSnapshotCopy, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::DisableSnapshotCopy, Aws::Client::RejectedCallOutcome<DisableSnapshotCopyOutcome>(), this, request);
+}
+
+DisableSnapshotCopyOutcomeCallable RedshiftClient::DisableSnapshotCopyCallable(DisableSnapshotCopyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::DisableSnapshotCopy, Aws::Client::RejectedCallOutcome<DisableSnapshotCopyOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::DisableSnapshotCopyAsync(const DisableSnapshotCopyRequest& request, const DisableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::DisableSnapshotCopyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::DisableSnapshotCopyAsyncHelper, Aws::Client::RejectedAsyncCall<DisableSnapshotCopyOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::DisableSnapshotCopyAsync(DisableSnapshotCopyRequest&& request, const DisableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::DisableSnapshotCopyAsyncHelper, Aws::Client::RejectedAsyncCall<DisableSnapshotCopyOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::DisableSnapshotCopyAsyncHelper(const DisableSnapshotCopyRequest& request, const DisableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1548,12 +2008,22 @@ EnableLoggingOutcome RedshiftClient::EnableLogging(const EnableLoggingRequest& r
 
 EnableLoggingOutcomeCallable RedshiftClient::EnableLoggingCallable(const EnableLoggingRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::EnableLogging, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::EnableLogging, Aws::Client::RejectedCallOutcome<EnableLoggingOutcome>(), this, request);
+}
+
+EnableLoggingOutcomeCallable RedshiftClient::EnableLoggingCallable(EnableLoggingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::EnableLogging, Aws::Client::RejectedCallOutcome<EnableLoggingOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::EnableLoggingAsync(const EnableLoggingRequest& request, const EnableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::EnableLoggingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::EnableLoggingAsyncHelper, Aws::Client::RejectedAsyncCall<EnableLoggingOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::EnableLoggingAsync(EnableLoggingRequest&& request, const EnableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::EnableLoggingAsyncHelper, Aws::Client::RejectedAsyncCall<EnableLoggingOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::EnableLoggingAsyncHelper(const EnableLoggingRequest& request, const EnableLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1578,12 +2048,22 @@ EnableSnapshotCopyOutcome RedshiftClient::EnableSnapshotCopy(const EnableSnapsho
 
 EnableSnapshotCopyOutcomeCallable RedshiftClient::EnableSnapshotCopyCallable(const EnableSnapshotCopyRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::EnableSnapshotCopy, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::EnableSnapshotCopy, Aws::Client::RejectedCallOutcome<EnableSnapshotCopyOutcome>(), this, request);
+}
+
+EnableSnapshotCopyOutcomeCallable RedshiftClient::EnableSnapshotCopyCallable(EnableSnapshotCopyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::EnableSnapshotCopy, Aws::Client::RejectedCallOutcome<EnableSnapshotCopyOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::EnableSnapshotCopyAsync(const EnableSnapshotCopyRequest& request, const EnableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::EnableSnapshotCopyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::EnableSnapshotCopyAsyncHelper, Aws::Client::RejectedAsyncCall<EnableSnapshotCopyOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::EnableSnapshotCopyAsync(EnableSnapshotCopyRequest&& request, const EnableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::EnableSnapshotCopyAsyncHelper, Aws::Client::RejectedAsyncCall<EnableSnapshotCopyOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::EnableSnapshotCopyAsyncHelper(const EnableSnapshotCopyRequest& request, const EnableSnapshotCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1608,12 +2088,22 @@ ModifyClusterOutcome RedshiftClient::ModifyCluster(const ModifyClusterRequest& r
 
 ModifyClusterOutcomeCallable RedshiftClient::ModifyClusterCallable(const ModifyClusterRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::ModifyCluster, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::ModifyCluster, Aws::Client::RejectedCallOutcome<ModifyClusterOutcome>(), this, request);
+}
+
+ModifyClusterOutcomeCallable RedshiftClient::ModifyClusterCallable(ModifyClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::ModifyCluster, Aws::Client::RejectedCallOutcome<ModifyClusterOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::ModifyClusterAsync(const ModifyClusterRequest& request, const ModifyClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::ModifyClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::ModifyClusterAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyClusterOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::ModifyClusterAsync(ModifyClusterRequest&& request, const ModifyClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::ModifyClusterAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::ModifyClusterAsyncHelper(const ModifyClusterRequest& request, const ModifyClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1638,12 +2128,22 @@ ModifyClusterParameterGroupOutcome RedshiftClient::ModifyClusterParameterGroup(c
 
 ModifyClusterParameterGroupOutcomeCallable RedshiftClient::ModifyClusterParameterGroupCallable(const ModifyClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::ModifyClusterParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::ModifyClusterParameterGroup, Aws::Client::RejectedCallOutcome<ModifyClusterParameterGroupOutcome>(), this, request);
+}
+
+ModifyClusterParameterGroupOutcomeCallable RedshiftClient::ModifyClusterParameterGroupCallable(ModifyClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::ModifyClusterParameterGroup, Aws::Client::RejectedCallOutcome<ModifyClusterParameterGroupOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::ModifyClusterParameterGroupAsync(const ModifyClusterParameterGroupRequest& request, const ModifyClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::ModifyClusterParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::ModifyClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyClusterParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::ModifyClusterParameterGroupAsync(ModifyClusterParameterGroupRequest&& request, const ModifyClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::ModifyClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyClusterParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::ModifyClusterParameterGroupAsyncHelper(const ModifyClusterParameterGroupRequest& request, const ModifyClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1668,12 +2168,22 @@ ModifyClusterSubnetGroupOutcome RedshiftClient::ModifyClusterSubnetGroup(const M
 
 ModifyClusterSubnetGroupOutcomeCallable RedshiftClient::ModifyClusterSubnetGroupCallable(const ModifyClusterSubnetGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::ModifyClusterSubnetGroup, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::ModifyClusterSubnetGroup, Aws::Client::RejectedCallOutcome<ModifyClusterSubnetGroupOutcome>(), this, request);
+}
+
+ModifyClusterSubnetGroupOutcomeCallable RedshiftClient::ModifyClusterSubnetGroupCallable(ModifyClusterSubnetGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::ModifyClusterSubnetGroup, Aws::Client::RejectedCallOutcome<ModifyClusterSubnetGroupOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::ModifyClusterSubnetGroupAsync(const ModifyClusterSubnetGroupRequest& request, const ModifyClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::ModifyClusterSubnetGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::ModifyClusterSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyClusterSubnetGroupOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::ModifyClusterSubnetGroupAsync(ModifyClusterSubnetGroupRequest&& request, const ModifyClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::ModifyClusterSubnetGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyClusterSubnetGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::ModifyClusterSubnetGroupAsyncHelper(const ModifyClusterSubnetGroupRequest& request, const ModifyClusterSubnetGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1698,12 +2208,22 @@ ModifyEventSubscriptionOutcome RedshiftClient::ModifyEventSubscription(const Mod
 
 ModifyEventSubscriptionOutcomeCallable RedshiftClient::ModifyEventSubscriptionCallable(const ModifyEventSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::ModifyEventSubscription, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::ModifyEventSubscription, Aws::Client::RejectedCallOutcome<ModifyEventSubscriptionOutcome>(), this, request);
+}
+
+ModifyEventSubscriptionOutcomeCallable RedshiftClient::ModifyEventSubscriptionCallable(ModifyEventSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::ModifyEventSubscription, Aws::Client::RejectedCallOutcome<ModifyEventSubscriptionOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::ModifyEventSubscriptionAsync(const ModifyEventSubscriptionRequest& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::ModifyEventSubscriptionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::ModifyEventSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyEventSubscriptionOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::ModifyEventSubscriptionAsync(ModifyEventSubscriptionRequest&& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::ModifyEventSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<ModifyEventSubscriptionOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::ModifyEventSubscriptionAsyncHelper(const ModifyEventSubscriptionRequest& request, const ModifyEventSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1728,12 +2248,22 @@ ModifySnapshotCopyRetentionPeriodOutcome RedshiftClient::ModifySnapshotCopyReten
 
 ModifySnapshotCopyRetentionPeriodOutcomeCallable RedshiftClient::ModifySnapshotCopyRetentionPeriodCallable(const ModifySnapshotCopyRetentionPeriodRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::ModifySnapshotCopyRetentionPeriod, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::ModifySnapshotCopyRetentionPeriod, Aws::Client::RejectedCallOutcome<ModifySnapshotCopyRetentionPeriodOutcome>(), this, request);
+}
+
+ModifySnapshotCopyRetentionPeriodOutcomeCallable RedshiftClient::ModifySnapshotCopyRetentionPeriodCallable(ModifySnapshotCopyRetentionPeriodRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::ModifySnapshotCopyRetentionPeriod, Aws::Client::RejectedCallOutcome<ModifySnapshotCopyRetentionPeriodOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::ModifySnapshotCopyRetentionPeriodAsync(const ModifySnapshotCopyRetentionPeriodRequest& request, const ModifySnapshotCopyRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::ModifySnapshotCopyRetentionPeriodAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::ModifySnapshotCopyRetentionPeriodAsyncHelper, Aws::Client::RejectedAsyncCall<ModifySnapshotCopyRetentionPeriodOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::ModifySnapshotCopyRetentionPeriodAsync(ModifySnapshotCopyRetentionPeriodRequest&& request, const ModifySnapshotCopyRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::ModifySnapshotCopyRetentionPeriodAsyncHelper, Aws::Client::RejectedAsyncCall<ModifySnapshotCopyRetentionPeriodOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::ModifySnapshotCopyRetentionPeriodAsyncHelper(const ModifySnapshotCopyRetentionPeriodRequest& request, const ModifySnapshotCopyRetentionPeriodResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1758,12 +2288,22 @@ PurchaseReservedNodeOfferingOutcome RedshiftClient::PurchaseReservedNodeOffering
 
 PurchaseReservedNodeOfferingOutcomeCallable RedshiftClient::PurchaseReservedNodeOfferingCallable(const PurchaseReservedNodeOfferingRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::PurchaseReservedNodeOffering, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::PurchaseReservedNodeOffering, Aws::Client::RejectedCallOutcome<PurchaseReservedNodeOfferingOutcome>(), this, request);
+}
+
+PurchaseReservedNodeOfferingOutcomeCallable RedshiftClient::PurchaseReservedNodeOfferingCallable(PurchaseReservedNodeOfferingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::PurchaseReservedNodeOffering, Aws::Client::RejectedCallOutcome<PurchaseReservedNodeOfferingOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::PurchaseReservedNodeOfferingAsync(const PurchaseReservedNodeOfferingRequest& request, const PurchaseReservedNodeOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::PurchaseReservedNodeOfferingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::PurchaseReservedNodeOfferingAsyncHelper, Aws::Client::RejectedAsyncCall<PurchaseReservedNodeOfferingOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::PurchaseReservedNodeOfferingAsync(PurchaseReservedNodeOfferingRequest&& request, const PurchaseReservedNodeOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::PurchaseReservedNodeOfferingAsyncHelper, Aws::Client::RejectedAsyncCall<PurchaseReservedNodeOfferingOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::PurchaseReservedNodeOfferingAsyncHelper(const PurchaseReservedNodeOfferingRequest& request, const PurchaseReservedNodeOfferingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1788,12 +2328,22 @@ RebootClusterOutcome RedshiftClient::RebootCluster(const RebootClusterRequest& r
 
 RebootClusterOutcomeCallable RedshiftClient::RebootClusterCallable(const RebootClusterRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::RebootCluster, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::RebootCluster, Aws::Client::RejectedCallOutcome<RebootClusterOutcome>(), this, request);
+}
+
+RebootClusterOutcomeCallable RedshiftClient::RebootClusterCallable(RebootClusterRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::RebootCluster, Aws::Client::RejectedCallOutcome<RebootClusterOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::RebootClusterAsync(const RebootClusterRequest& request, const RebootClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::RebootClusterAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::RebootClusterAsyncHelper, Aws::Client::RejectedAsyncCall<RebootClusterOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::RebootClusterAsync(RebootClusterRequest&& request, const RebootClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::RebootClusterAsyncHelper, Aws::Client::RejectedAsyncCall<RebootClusterOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::RebootClusterAsyncHelper(const RebootClusterRequest& request, const RebootClusterResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1818,12 +2368,22 @@ ResetClusterParameterGroupOutcome RedshiftClient::ResetClusterParameterGroup(con
 
 ResetClusterParameterGroupOutcomeCallable RedshiftClient::ResetClusterParameterGroupCallable(const ResetClusterParameterGroupRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::ResetClusterParameterGroup, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::ResetClusterParameterGroup, Aws::Client::RejectedCallOutcome<ResetClusterParameterGroupOutcome>(), this, request);
+}
+
+ResetClusterParameterGroupOutcomeCallable RedshiftClient::ResetClusterParameterGroupCallable(ResetClusterParameterGroupRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::ResetClusterParameterGroup, Aws::Client::RejectedCallOutcome<ResetClusterParameterGroupOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::ResetClusterParameterGroupAsync(const ResetClusterParameterGroupRequest& request, const ResetClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::ResetClusterParameterGroupAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::ResetClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ResetClusterParameterGroupOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::ResetClusterParameterGroupAsync(ResetClusterParameterGroupRequest&& request, const ResetClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::ResetClusterParameterGroupAsyncHelper, Aws::Client::RejectedAsyncCall<ResetClusterParameterGroupOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::ResetClusterParameterGroupAsyncHelper(const ResetClusterParameterGroupRequest& request, const ResetClusterParameterGroupResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1848,12 +2408,22 @@ RestoreFromClusterSnapshotOutcome RedshiftClient::RestoreFromClusterSnapshot(con
 
 RestoreFromClusterSnapshotOutcomeCallable RedshiftClient::RestoreFromClusterSnapshotCallable(const RestoreFromClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::RestoreFromClusterSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::RestoreFromClusterSnapshot, Aws::Client::RejectedCallOutcome<RestoreFromClusterSnapshotOutcome>(), this, request);
+}
+
+RestoreFromClusterSnapshotOutcomeCallable RedshiftClient::RestoreFromClusterSnapshotCallable(RestoreFromClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::RestoreFromClusterSnapshot, Aws::Client::RejectedCallOutcome<RestoreFromClusterSnapshotOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::RestoreFromClusterSnapshotAsync(const RestoreFromClusterSnapshotRequest& request, const RestoreFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::RestoreFromClusterSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::RestoreFromClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreFromClusterSnapshotOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::RestoreFromClusterSnapshotAsync(RestoreFromClusterSnapshotRequest&& request, const RestoreFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::RestoreFromClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreFromClusterSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::RestoreFromClusterSnapshotAsyncHelper(const RestoreFromClusterSnapshotRequest& request, const RestoreFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1878,12 +2448,22 @@ RestoreTableFromClusterSnapshotOutcome RedshiftClient::RestoreTableFromClusterSn
 
 RestoreTableFromClusterSnapshotOutcomeCallable RedshiftClient::RestoreTableFromClusterSnapshotCallable(const RestoreTableFromClusterSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::RestoreTableFromClusterSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::RestoreTableFromClusterSnapshot, Aws::Client::RejectedCallOutcome<RestoreTableFromClusterSnapshotOutcome>(), this, request);
+}
+
+RestoreTableFromClusterSnapshotOutcomeCallable RedshiftClient::RestoreTableFromClusterSnapshotCallable(RestoreTableFromClusterSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::RestoreTableFromClusterSnapshot, Aws::Client::RejectedCallOutcome<RestoreTableFromClusterSnapshotOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::RestoreTableFromClusterSnapshotAsync(const RestoreTableFromClusterSnapshotRequest& request, const RestoreTableFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::RestoreTableFromClusterSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::RestoreTableFromClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreTableFromClusterSnapshotOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::RestoreTableFromClusterSnapshotAsync(RestoreTableFromClusterSnapshotRequest&& request, const RestoreTableFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::RestoreTableFromClusterSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreTableFromClusterSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::RestoreTableFromClusterSnapshotAsyncHelper(const RestoreTableFromClusterSnapshotRequest& request, const RestoreTableFromClusterSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1908,12 +2488,22 @@ RevokeClusterSecurityGroupIngressOutcome RedshiftClient::RevokeClusterSecurityGr
 
 RevokeClusterSecurityGroupIngressOutcomeCallable RedshiftClient::RevokeClusterSecurityGroupIngressCallable(const RevokeClusterSecurityGroupIngressRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::RevokeClusterSecurityGroupIngress, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::RevokeClusterSecurityGroupIngress, Aws::Client::RejectedCallOutcome<RevokeClusterSecurityGroupIngressOutcome>(), this, request);
+}
+
+RevokeClusterSecurityGroupIngressOutcomeCallable RedshiftClient::RevokeClusterSecurityGroupIngressCallable(RevokeClusterSecurityGroupIngressRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::RevokeClusterSecurityGroupIngress, Aws::Client::RejectedCallOutcome<RevokeClusterSecurityGroupIngressOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::RevokeClusterSecurityGroupIngressAsync(const RevokeClusterSecurityGroupIngressRequest& request, const RevokeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::RevokeClusterSecurityGroupIngressAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::RevokeClusterSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<RevokeClusterSecurityGroupIngressOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::RevokeClusterSecurityGroupIngressAsync(RevokeClusterSecurityGroupIngressRequest&& request, const RevokeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::RevokeClusterSecurityGroupIngressAsyncHelper, Aws::Client::RejectedAsyncCall<RevokeClusterSecurityGroupIngressOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::RevokeClusterSecurityGroupIngressAsyncHelper(const RevokeClusterSecurityGroupIngressRequest& request, const RevokeClusterSecurityGroupIngressResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1938,12 +2528,22 @@ RevokeSnapshotAccessOutcome RedshiftClient::RevokeSnapshotAccess(const RevokeSna
 
 RevokeSnapshotAccessOutcomeCallable RedshiftClient::RevokeSnapshotAccessCallable(const RevokeSnapshotAccessRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::RevokeSnapshotAccess, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::RevokeSnapshotAccess, Aws::Client::RejectedCallOutcome<RevokeSnapshotAccessOutcome>(), this, request);
+}
+
+RevokeSnapshotAccessOutcomeCallable RedshiftClient::RevokeSnapshotAccessCallable(RevokeSnapshotAccessRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::RevokeSnapshotAccess, Aws::Client::RejectedCallOutcome<RevokeSnapshotAccessOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::RevokeSnapshotAccessAsync(const RevokeSnapshotAccessRequest& request, const RevokeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::RevokeSnapshotAccessAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::RevokeSnapshotAccessAsyncHelper, Aws::Client::RejectedAsyncCall<RevokeSnapshotAccessOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::RevokeSnapshotAccessAsync(RevokeSnapshotAccessRequest&& request, const RevokeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::RevokeSnapshotAccessAsyncHelper, Aws::Client::RejectedAsyncCall<RevokeSnapshotAccessOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::RevokeSnapshotAccessAsyncHelper(const RevokeSnapshotAccessRequest& request, const RevokeSnapshotAccessResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1968,12 +2568,22 @@ RotateEncryptionKeyOutcome RedshiftClient::RotateEncryptionKey(const RotateEncry
 
 RotateEncryptionKeyOutcomeCallable RedshiftClient::RotateEncryptionKeyCallable(const RotateEncryptionKeyRequest& request) const
 {
-  return std::async(std::launch::async, &RedshiftClient::RotateEncryptionKey, this, request);
+  return m_executor->SubmitWithFuture(&RedshiftClient::RotateEncryptionKey, Aws::Client::RejectedCallOutcome<RotateEncryptionKeyOutcome>(), this, request);
+}
+
+RotateEncryptionKeyOutcomeCallable RedshiftClient::RotateEncryptionKeyCallable(RotateEncryptionKeyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&RedshiftClient::RotateEncryptionKey, Aws::Client::RejectedCallOutcome<RotateEncryptionKeyOutcome>(), this, std::move(request));
 }
 
 void RedshiftClient::RotateEncryptionKeyAsync(const RotateEncryptionKeyRequest& request, const RotateEncryptionKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&RedshiftClient::RotateEncryptionKeyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&RedshiftClient::RotateEncryptionKeyAsyncHelper, Aws::Client::RejectedAsyncCall<RotateEncryptionKeyOutcome>(), this, request, handler, context);
+}
+
+void RedshiftClient::RotateEncryptionKeyAsync(RotateEncryptionKeyRequest&& request, const RotateEncryptionKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&RedshiftClient::RotateEncryptionKeyAsyncHelper, Aws::Client::RejectedAsyncCall<RotateEncryptionKeyOutcome>(), this, std::move(request), handler, context);
 }
 
 void RedshiftClient::RotateEncryptionKeyAsyncHelper(const RotateEncryptionKeyRequest& request, const RotateEncryptionKeyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -67,6 +67,55 @@
 #include <aws/route53/model/UpdateTrafficPolicyInstanceResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/route53/model/AssociateVPCWithHostedZoneRequest.h>
+#include <aws/route53/model/ChangeResourceRecordSetsRequest.h>
+#include <aws/route53/model/ChangeTagsForResourceRequest.h>
+#include <aws/route53/model/CreateHealthCheckRequest.h>
+#include <aws/route53/model/CreateHostedZoneRequest.h>
+#include <aws/route53/model/CreateReusableDelegationSetRequest.h>
+#include <aws/route53/model/CreateTrafficPolicyRequest.h>
+#include <aws/route53/model/CreateTrafficPolicyInstanceRequest.h>
+#include <aws/route53/model/CreateTrafficPolicyVersionRequest.h>
+#include <aws/route53/model/DeleteHealthCheckRequest.h>
+#include <aws/route53/model/DeleteHostedZoneRequest.h>
+#include <aws/route53/model/DeleteReusableDelegationSetRequest.h>
+#include <aws/route53/model/DeleteTrafficPolicyRequest.h>
+#include <aws/route53/model/DeleteTrafficPolicyInstanceRequest.h>
+#include <aws/route53/model/DisassociateVPCFromHostedZoneRequest.h>
+#include <aws/route53/model/GetChangeRequest.h>
+#include <aws/route53/model/GetCheckerIpRangesRequest.h>
+#include <aws/route53/model/GetGeoLocationRequest.h>
+#include <aws/route53/model/GetHealthCheckRequest.h>
+#include <aws/route53/model/GetHealthCheckCountRequest.h>
+#include <aws/route53/model/GetHealthCheckLastFailureReasonRequest.h>
+#include <aws/route53/model/GetHealthCheckStatusRequest.h>
+#include <aws/route53/model/GetHostedZoneRequest.h>
+#include <aws/route53/model/GetHostedZoneCountRequest.h>
+#include <aws/route53/model/GetReusableDelegationSetRequest.h>
+#include <aws/route53/model/GetTrafficPolicyRequest.h>
+#include <aws/route53/model/GetTrafficPolicyInstanceRequest.h>
+#include <aws/route53/model/GetTrafficPolicyInstanceCountRequest.h>
+#include <aws/route53/model/ListGeoLocationsRequest.h>
+#include <aws/route53/model/ListHealthChecksRequest.h>
+#include <aws/route53/model/ListHostedZonesRequest.h>
+#include <aws/route53/model/ListHostedZonesByNameRequest.h>
+#include <aws/route53/model/ListResourceRecordSetsRequest.h>
+#include <aws/route53/model/ListReusableDelegationSetsRequest.h>
+#include <aws/route53/model/ListTagsForResourceRequest.h>
+#include <aws/route53/model/ListTagsForResourcesRequest.h>
+#include <aws/route53/model/ListTrafficPoliciesRequest.h>
+#include <aws/route53/model/ListTrafficPolicyInstancesRequest.h>
+#include <aws/route53/model/ListTrafficPolicyInstancesByHostedZoneRequest.h>
+#include <aws/route53/model/ListTrafficPolicyInstancesByPolicyRequest.h>
+#include <aws/route53/model/ListTrafficPolicyVersionsRequest.h>
+#include <aws/route53/model/UpdateHealthCheckRequest.h>
+#include <aws/route53/model/UpdateHostedZoneCommentRequest.h>
+#include <aws/route53/model/UpdateTrafficPolicyCommentRequest.h>
+#include <aws/route53/model/UpdateTrafficPolicyInstanceRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -354,6 +403,11 @@ namespace Model
          */
         virtual Model::AssociateVPCWithHostedZoneOutcomeCallable AssociateVPCWithHostedZoneCallable(const Model::AssociateVPCWithHostedZoneRequest& request) const;
 
+        /**
+         * Same as AssociateVPCWithHostedZoneCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AssociateVPCWithHostedZoneOutcomeCallable AssociateVPCWithHostedZoneCallable(Model::AssociateVPCWithHostedZoneRequest&& request) const;
+
         /**
          * <p>This action associates a VPC with an hosted zone. </p> <p>To associate a VPC
          * with an hosted zone, send a <code>POST</code> request to the <code>/<i>Route 53
@@ -370,6 +424,11 @@ namespace Model
          */
         virtual void AssociateVPCWithHostedZoneAsync(const Model::AssociateVPCWithHostedZoneRequest& request, const AssociateVPCWithHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssociateVPCWithHostedZoneAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AssociateVPCWithHostedZoneAsync(Model::AssociateVPCWithHostedZoneRequest&& request, const AssociateVPCWithHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Use this action to create or change your authoritative DNS information. To
          * use this action, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -426,6 +485,11 @@ namespace Model
          */
         virtual Model::ChangeResourceRecordSetsOutcomeCallable ChangeResourceRecordSetsCallable(const Model::ChangeResourceRecordSetsRequest& request) const;
 
+        /**
+         * Same as ChangeResourceRecordSetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ChangeResourceRecordSetsOutcomeCallable ChangeResourceRecordSetsCallable(Model::ChangeResourceRecordSetsRequest&& request) const;
+
         /**
          * <p>Use this action to create or change your authoritative DNS information. To
          * use this action, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -455,6 +519,11 @@ namespace Model
          */
         virtual void ChangeResourceRecordSetsAsync(const Model::ChangeResourceRecordSetsRequest& request, const ChangeResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ChangeResourceRecordSetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ChangeResourceRecordSetsAsync(Model::ChangeResourceRecordSetsRequest&& request, const ChangeResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -467,6 +536,11 @@ namespace Model
          */
         virtual Model::ChangeTagsForResourceOutcomeCallable ChangeTagsForResourceCallable(const Model::ChangeTagsForResourceRequest& request) const;
 
+        /**
+         * Same as ChangeTagsForResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ChangeTagsForResourceOutcomeCallable ChangeTagsForResourceCallable(Model::ChangeTagsForResourceRequest&& request) const;
+
         /**
          * 
          *
@@ -474,6 +548,11 @@ namespace Model
          */
         virtual void ChangeTagsForResourceAsync(const Model::ChangeTagsForResourceRequest& request, const ChangeTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ChangeTagsForResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ChangeTagsForResourceAsync(Model::ChangeTagsForResourceRequest&& request, const ChangeTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action creates a new health check.</p> <p>To create a new health check,
          * send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -496,6 +575,11 @@ namespace Model
          */
         virtual Model::CreateHealthCheckOutcomeCallable CreateHealthCheckCallable(const Model::CreateHealthCheckRequest& request) const;
 
+        /**
+         * Same as CreateHealthCheckCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateHealthCheckOutcomeCallable CreateHealthCheckCallable(Model::CreateHealthCheckRequest&& request) const;
+
         /**
          * <p>This action creates a new health check.</p> <p>To create a new health check,
          * send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -508,6 +592,11 @@ namespace Model
          */
         virtual void CreateHealthCheckAsync(const Model::CreateHealthCheckRequest& request, const CreateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateHealthCheckAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateHealthCheckAsync(Model::CreateHealthCheckRequest&& request, const CreateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action creates a new hosted zone.</p> <p>To create a new hosted zone,
          * send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -554,6 +643,11 @@ namespace Model
          */
         virtual Model::CreateHostedZoneOutcomeCallable CreateHostedZoneCallable(const Model::CreateHostedZoneRequest& request) const;
 
+        /**
+         * Same as CreateHostedZoneCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateHostedZoneOutcomeCallable CreateHostedZoneCallable(Model::CreateHostedZoneRequest&& request) const;
+
         /**
          * <p>This action creates a new hosted zone.</p> <p>To create a new hosted zone,
          * send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -578,6 +672,11 @@ namespace Model
          */
         virtual void CreateHostedZoneAsync(const Model::CreateHostedZoneRequest& request, const CreateHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateHostedZoneAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateHostedZoneAsync(Model::CreateHostedZoneRequest&& request, const CreateHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action creates a reusable delegationSet.</p> <p>To create a new reusable
          * delegationSet, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -604,6 +703,11 @@ namespace Model
          */
         virtual Model::CreateReusableDelegationSetOutcomeCallable CreateReusableDelegationSetCallable(const Model::CreateReusableDelegationSetRequest& request) const;
 
+        /**
+         * Same as CreateReusableDelegationSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateReusableDelegationSetOutcomeCallable CreateReusableDelegationSetCallable(Model::CreateReusableDelegationSetRequest&& request) const;
+
         /**
          * <p>This action creates a reusable delegationSet.</p> <p>To create a new reusable
          * delegationSet, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -618,6 +722,11 @@ namespace Model
          */
         virtual void CreateReusableDelegationSetAsync(const Model::CreateReusableDelegationSetRequest& request, const CreateReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateReusableDelegationSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateReusableDelegationSetAsync(Model::CreateReusableDelegationSetRequest&& request, const CreateReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a traffic policy, which you use to create multiple DNS resource
          * record sets for one domain name (such as example.com) or one subdomain name
@@ -644,6 +753,11 @@ namespace Model
          */
         virtual Model::CreateTrafficPolicyOutcomeCallable CreateTrafficPolicyCallable(const Model::CreateTrafficPolicyRequest& request) const;
 
+        /**
+         * Same as CreateTrafficPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateTrafficPolicyOutcomeCallable CreateTrafficPolicyCallable(Model::CreateTrafficPolicyRequest&& request) const;
+
         /**
          * <p>Creates a traffic policy, which you use to create multiple DNS resource
          * record sets for one domain name (such as example.com) or one subdomain name
@@ -658,6 +772,11 @@ namespace Model
          */
         virtual void CreateTrafficPolicyAsync(const Model::CreateTrafficPolicyRequest& request, const CreateTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTrafficPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateTrafficPolicyAsync(Model::CreateTrafficPolicyRequest&& request, const CreateTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates resource record sets in a specified hosted zone based on the settings
          * in a specified traffic policy version. In addition,
@@ -692,6 +811,11 @@ namespace Model
          */
         virtual Model::CreateTrafficPolicyInstanceOutcomeCallable CreateTrafficPolicyInstanceCallable(const Model::CreateTrafficPolicyInstanceRequest& request) const;
 
+        /**
+         * Same as CreateTrafficPolicyInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateTrafficPolicyInstanceOutcomeCallable CreateTrafficPolicyInstanceCallable(Model::CreateTrafficPolicyInstanceRequest&& request) const;
+
         /**
          * <p>Creates resource record sets in a specified hosted zone based on the settings
          * in a specified traffic policy version. In addition,
@@ -710,6 +834,11 @@ namespace Model
          */
         virtual void CreateTrafficPolicyInstanceAsync(const Model::CreateTrafficPolicyInstanceRequest& request, const CreateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTrafficPolicyInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateTrafficPolicyInstanceAsync(Model::CreateTrafficPolicyInstanceRequest&& request, const CreateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new version of an existing traffic policy. When you create a new
          * version of a traffic policy, you specify the ID of the traffic policy that you
@@ -742,6 +871,11 @@ namespace Model
          */
         virtual Model::CreateTrafficPolicyVersionOutcomeCallable CreateTrafficPolicyVersionCallable(const Model::CreateTrafficPolicyVersionRequest& request) const;
 
+        /**
+         * Same as CreateTrafficPolicyVersionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateTrafficPolicyVersionOutcomeCallable CreateTrafficPolicyVersionCallable(Model::CreateTrafficPolicyVersionRequest&& request) const;
+
         /**
          * <p>Creates a new version of an existing traffic policy. When you create a new
          * version of a traffic policy, you specify the ID of the traffic policy that you
@@ -759,6 +893,11 @@ namespace Model
          */
         virtual void CreateTrafficPolicyVersionAsync(const Model::CreateTrafficPolicyVersionRequest& request, const CreateTrafficPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTrafficPolicyVersionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateTrafficPolicyVersionAsync(Model::CreateTrafficPolicyVersionRequest&& request, const CreateTrafficPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action deletes a health check. To delete a health check, send a
          * <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -789,6 +928,11 @@ namespace Model
          */
         virtual Model::DeleteHealthCheckOutcomeCallable DeleteHealthCheckCallable(const Model::DeleteHealthCheckRequest& request) const;
 
+        /**
+         * Same as DeleteHealthCheckCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteHealthCheckOutcomeCallable DeleteHealthCheckCallable(Model::DeleteHealthCheckRequest&& request) const;
+
         /**
          * <p>This action deletes a health check. To delete a health check, send a
          * <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -805,6 +949,11 @@ namespace Model
          */
         virtual void DeleteHealthCheckAsync(const Model::DeleteHealthCheckRequest& request, const DeleteHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteHealthCheckAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteHealthCheckAsync(Model::DeleteHealthCheckRequest&& request, const DeleteHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action deletes a hosted zone. To delete a hosted zone, send a
          * <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -841,6 +990,11 @@ namespace Model
          */
         virtual Model::DeleteHostedZoneOutcomeCallable DeleteHostedZoneCallable(const Model::DeleteHostedZoneRequest& request) const;
 
+        /**
+         * Same as DeleteHostedZoneCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteHostedZoneOutcomeCallable DeleteHostedZoneCallable(Model::DeleteHostedZoneRequest&& request) const;
+
         /**
          * <p>This action deletes a hosted zone. To delete a hosted zone, send a
          * <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -860,6 +1014,11 @@ namespace Model
          */
         virtual void DeleteHostedZoneAsync(const Model::DeleteHostedZoneRequest& request, const DeleteHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteHostedZoneAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteHostedZoneAsync(Model::DeleteHostedZoneRequest&& request, const DeleteHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action deletes a reusable delegation set. To delete a reusable
          * delegation set, send a <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -888,6 +1047,11 @@ namespace Model
          */
         virtual Model::DeleteReusableDelegationSetOutcomeCallable DeleteReusableDelegationSetCallable(const Model::DeleteReusableDelegationSetRequest& request) const;
 
+        /**
+         * Same as DeleteReusableDelegationSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteReusableDelegationSetOutcomeCallable DeleteReusableDelegationSetCallable(Model::DeleteReusableDelegationSetRequest&& request) const;
+
         /**
          * <p>This action deletes a reusable delegation set. To delete a reusable
          * delegation set, send a <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -903,6 +1067,11 @@ namespace Model
          */
         virtual void DeleteReusableDelegationSetAsync(const Model::DeleteReusableDelegationSetRequest& request, const DeleteReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteReusableDelegationSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteReusableDelegationSetAsync(Model::DeleteReusableDelegationSetRequest&& request, const DeleteReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a traffic policy. To delete a traffic policy, send a
          * <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -919,6 +1088,11 @@ namespace Model
          */
         virtual Model::DeleteTrafficPolicyOutcomeCallable DeleteTrafficPolicyCallable(const Model::DeleteTrafficPolicyRequest& request) const;
 
+        /**
+         * Same as DeleteTrafficPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteTrafficPolicyOutcomeCallable DeleteTrafficPolicyCallable(Model::DeleteTrafficPolicyRequest&& request) const;
+
         /**
          * <p>Deletes a traffic policy. To delete a traffic policy, send a
          * <code>DELETE</code> request to the <code>/<i>Route 53 API
@@ -928,6 +1102,11 @@ namespace Model
          */
         virtual void DeleteTrafficPolicyAsync(const Model::DeleteTrafficPolicyRequest& request, const DeleteTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTrafficPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteTrafficPolicyAsync(Model::DeleteTrafficPolicyRequest&& request, const DeleteTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a traffic policy instance and all of the resource record sets that
          * Amazon Route 53 created when you created the instance.</p> <p>To delete a
@@ -952,6 +1131,11 @@ namespace Model
          */
         virtual Model::DeleteTrafficPolicyInstanceOutcomeCallable DeleteTrafficPolicyInstanceCallable(const Model::DeleteTrafficPolicyInstanceRequest& request) const;
 
+        /**
+         * Same as DeleteTrafficPolicyInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteTrafficPolicyInstanceOutcomeCallable DeleteTrafficPolicyInstanceCallable(Model::DeleteTrafficPolicyInstanceRequest&& request) const;
+
         /**
          * <p>Deletes a traffic policy instance and all of the resource record sets that
          * Amazon Route 53 created when you created the instance.</p> <p>To delete a
@@ -965,6 +1149,11 @@ namespace Model
          */
         virtual void DeleteTrafficPolicyInstanceAsync(const Model::DeleteTrafficPolicyInstanceRequest& request, const DeleteTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTrafficPolicyInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteTrafficPolicyInstanceAsync(Model::DeleteTrafficPolicyInstanceRequest&& request, const DeleteTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action disassociates a VPC from an hosted zone. </p> <p>To disassociate
          * a VPC to a hosted zone, send a <code>POST</code> request to the <code>/<i>Route
@@ -995,6 +1184,11 @@ namespace Model
          */
         virtual Model::DisassociateVPCFromHostedZoneOutcomeCallable DisassociateVPCFromHostedZoneCallable(const Model::DisassociateVPCFromHostedZoneRequest& request) const;
 
+        /**
+         * Same as DisassociateVPCFromHostedZoneCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisassociateVPCFromHostedZoneOutcomeCallable DisassociateVPCFromHostedZoneCallable(Model::DisassociateVPCFromHostedZoneRequest&& request) const;
+
         /**
          * <p>This action disassociates a VPC from an hosted zone. </p> <p>To disassociate
          * a VPC to a hosted zone, send a <code>POST</code> request to the <code>/<i>Route
@@ -1011,6 +1205,11 @@ namespace Model
          */
         virtual void DisassociateVPCFromHostedZoneAsync(const Model::DisassociateVPCFromHostedZoneRequest& request, const DisassociateVPCFromHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisassociateVPCFromHostedZoneAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisassociateVPCFromHostedZoneAsync(Model::DisassociateVPCFromHostedZoneRequest&& request, const DisassociateVPCFromHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action returns the current status of a change batch request. The status
          * is one of the following values:</p> <p>- <code>PENDING</code> indicates that the
@@ -1033,6 +1232,11 @@ namespace Model
          */
         virtual Model::GetChangeOutcomeCallable GetChangeCallable(const Model::GetChangeRequest& request) const;
 
+        /**
+         * Same as GetChangeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetChangeOutcomeCallable GetChangeCallable(Model::GetChangeRequest&& request) const;
+
         /**
          * <p>This action returns the current status of a change batch request. The status
          * is one of the following values:</p> <p>- <code>PENDING</code> indicates that the
@@ -1045,6 +1249,11 @@ namespace Model
          */
         virtual void GetChangeAsync(const Model::GetChangeRequest& request, const GetChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetChangeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetChangeAsync(Model::GetChangeRequest&& request, const GetChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a list of the IP ranges used by Amazon Route 53 health checkers
          * to check the health of your resources, send a <code>GET</code> request to the
@@ -1065,6 +1274,11 @@ namespace Model
          */
         virtual Model::GetCheckerIpRangesOutcomeCallable GetCheckerIpRangesCallable(const Model::GetCheckerIpRangesRequest& request) const;
 
+        /**
+         * Same as GetCheckerIpRangesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetCheckerIpRangesOutcomeCallable GetCheckerIpRangesCallable(Model::GetCheckerIpRangesRequest&& request) const;
+
         /**
          * <p>To retrieve a list of the IP ranges used by Amazon Route 53 health checkers
          * to check the health of your resources, send a <code>GET</code> request to the
@@ -1076,6 +1290,11 @@ namespace Model
          */
         virtual void GetCheckerIpRangesAsync(const Model::GetCheckerIpRangesRequest& request, const GetCheckerIpRangesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetCheckerIpRangesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetCheckerIpRangesAsync(Model::GetCheckerIpRangesRequest&& request, const GetCheckerIpRangesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a single geo location, send a <code>GET</code> request to the
          * <code>/<i>Route 53 API version</i>/geolocation</code> resource with one of these
@@ -1092,6 +1311,11 @@ namespace Model
          */
         virtual Model::GetGeoLocationOutcomeCallable GetGeoLocationCallable(const Model::GetGeoLocationRequest& request) const;
 
+        /**
+         * Same as GetGeoLocationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetGeoLocationOutcomeCallable GetGeoLocationCallable(Model::GetGeoLocationRequest&& request) const;
+
         /**
          * <p>To retrieve a single geo location, send a <code>GET</code> request to the
          * <code>/<i>Route 53 API version</i>/geolocation</code> resource with one of these
@@ -1101,6 +1325,11 @@ namespace Model
          */
         virtual void GetGeoLocationAsync(const Model::GetGeoLocationRequest& request, const GetGeoLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetGeoLocationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetGeoLocationAsync(Model::GetGeoLocationRequest&& request, const GetGeoLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve the health check, send a <code>GET</code> request to the
          * <code>/<i>Route 53 API version</i>/healthcheck/<i>health check ID</i></code>
@@ -1117,6 +1346,11 @@ namespace Model
          */
         virtual Model::GetHealthCheckOutcomeCallable GetHealthCheckCallable(const Model::GetHealthCheckRequest& request) const;
 
+        /**
+         * Same as GetHealthCheckCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetHealthCheckOutcomeCallable GetHealthCheckCallable(Model::GetHealthCheckRequest&& request) const;
+
         /**
          * <p>To retrieve the health check, send a <code>GET</code> request to the
          * <code>/<i>Route 53 API version</i>/healthcheck/<i>health check ID</i></code>
@@ -1126,6 +1360,11 @@ namespace Model
          */
         virtual void GetHealthCheckAsync(const Model::GetHealthCheckRequest& request, const GetHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetHealthCheckAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetHealthCheckAsync(Model::GetHealthCheckRequest&& request, const GetHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a count of all your health checks, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/healthcheckcount</code>
@@ -1142,6 +1381,11 @@ namespace Model
          */
         virtual Model::GetHealthCheckCountOutcomeCallable GetHealthCheckCountCallable(const Model::GetHealthCheckCountRequest& request) const;
 
+        /**
+         * Same as GetHealthCheckCountCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetHealthCheckCountOutcomeCallable GetHealthCheckCountCallable(Model::GetHealthCheckCountRequest&& request) const;
+
         /**
          * <p>To retrieve a count of all your health checks, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/healthcheckcount</code>
@@ -1151,6 +1395,11 @@ namespace Model
          */
         virtual void GetHealthCheckCountAsync(const Model::GetHealthCheckCountRequest& request, const GetHealthCheckCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetHealthCheckCountAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetHealthCheckCountAsync(Model::GetHealthCheckCountRequest&& request, const GetHealthCheckCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>If you want to learn why a health check is currently failing or why it failed
          * most recently (if at all), you can get the failure reason for the most recent
@@ -1171,6 +1420,11 @@ namespace Model
          */
         virtual Model::GetHealthCheckLastFailureReasonOutcomeCallable GetHealthCheckLastFailureReasonCallable(const Model::GetHealthCheckLastFailureReasonRequest& request) const;
 
+        /**
+         * Same as GetHealthCheckLastFailureReasonCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetHealthCheckLastFailureReasonOutcomeCallable GetHealthCheckLastFailureReasonCallable(Model::GetHealthCheckLastFailureReasonRequest&& request) const;
+
         /**
          * <p>If you want to learn why a health check is currently failing or why it failed
          * most recently (if at all), you can get the failure reason for the most recent
@@ -1182,6 +1436,11 @@ namespace Model
          */
         virtual void GetHealthCheckLastFailureReasonAsync(const Model::GetHealthCheckLastFailureReasonRequest& request, const GetHealthCheckLastFailureReasonResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetHealthCheckLastFailureReasonAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetHealthCheckLastFailureReasonAsync(Model::GetHealthCheckLastFailureReasonRequest&& request, const GetHealthCheckLastFailureReasonResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve the health check status, send a <code>GET</code> request to the
          * <code>/<i>Route 53 API version</i>/healthcheck/<i>health check
@@ -1200,6 +1459,11 @@ namespace Model
          */
         virtual Model::GetHealthCheckStatusOutcomeCallable GetHealthCheckStatusCallable(const Model::GetHealthCheckStatusRequest& request) const;
 
+        /**
+         * Same as GetHealthCheckStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetHealthCheckStatusOutcomeCallable GetHealthCheckStatusCallable(Model::GetHealthCheckStatusRequest&& request) const;
+
         /**
          * <p>To retrieve the health check status, send a <code>GET</code> request to the
          * <code>/<i>Route 53 API version</i>/healthcheck/<i>health check
@@ -1210,6 +1474,11 @@ namespace Model
          */
         virtual void GetHealthCheckStatusAsync(const Model::GetHealthCheckStatusRequest& request, const GetHealthCheckStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetHealthCheckStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetHealthCheckStatusAsync(Model::GetHealthCheckStatusRequest&& request, const GetHealthCheckStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve the delegation set for a hosted zone, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/hostedzone/<i>hosted zone
@@ -1228,6 +1497,11 @@ namespace Model
          */
         virtual Model::GetHostedZoneOutcomeCallable GetHostedZoneCallable(const Model::GetHostedZoneRequest& request) const;
 
+        /**
+         * Same as GetHostedZoneCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetHostedZoneOutcomeCallable GetHostedZoneCallable(Model::GetHostedZoneRequest&& request) const;
+
         /**
          * <p>To retrieve the delegation set for a hosted zone, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/hostedzone/<i>hosted zone
@@ -1238,6 +1512,11 @@ namespace Model
          */
         virtual void GetHostedZoneAsync(const Model::GetHostedZoneRequest& request, const GetHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetHostedZoneAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetHostedZoneAsync(Model::GetHostedZoneRequest&& request, const GetHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a count of all your hosted zones, send a <code>GET</code> request
          * to the <code>/<i>Route 53 API version</i>/hostedzonecount</code> resource.</p>
@@ -1252,6 +1531,11 @@ namespace Model
          */
         virtual Model::GetHostedZoneCountOutcomeCallable GetHostedZoneCountCallable(const Model::GetHostedZoneCountRequest& request) const;
 
+        /**
+         * Same as GetHostedZoneCountCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetHostedZoneCountOutcomeCallable GetHostedZoneCountCallable(Model::GetHostedZoneCountRequest&& request) const;
+
         /**
          * <p>To retrieve a count of all your hosted zones, send a <code>GET</code> request
          * to the <code>/<i>Route 53 API version</i>/hostedzonecount</code> resource.</p>
@@ -1260,6 +1544,11 @@ namespace Model
          */
         virtual void GetHostedZoneCountAsync(const Model::GetHostedZoneCountRequest& request, const GetHostedZoneCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetHostedZoneCountAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetHostedZoneCountAsync(Model::GetHostedZoneCountRequest&& request, const GetHostedZoneCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve the reusable delegation set, send a <code>GET</code> request to
          * the <code>/<i>Route 53 API version</i>/delegationset/<i>delegation set
@@ -1276,6 +1565,11 @@ namespace Model
          */
         virtual Model::GetReusableDelegationSetOutcomeCallable GetReusableDelegationSetCallable(const Model::GetReusableDelegationSetRequest& request) const;
 
+        /**
+         * Same as GetReusableDelegationSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetReusableDelegationSetOutcomeCallable GetReusableDelegationSetCallable(Model::GetReusableDelegationSetRequest&& request) const;
+
         /**
          * <p>To retrieve the reusable delegation set, send a <code>GET</code> request to
          * the <code>/<i>Route 53 API version</i>/delegationset/<i>delegation set
@@ -1285,6 +1579,11 @@ namespace Model
          */
         virtual void GetReusableDelegationSetAsync(const Model::GetReusableDelegationSetRequest& request, const GetReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetReusableDelegationSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetReusableDelegationSetAsync(Model::GetReusableDelegationSetRequest&& request, const GetReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a specific traffic policy version. To get the
          * information, send a <code>GET</code> request to the <code>/<i>Route 53 API
@@ -1301,6 +1600,11 @@ namespace Model
          */
         virtual Model::GetTrafficPolicyOutcomeCallable GetTrafficPolicyCallable(const Model::GetTrafficPolicyRequest& request) const;
 
+        /**
+         * Same as GetTrafficPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetTrafficPolicyOutcomeCallable GetTrafficPolicyCallable(Model::GetTrafficPolicyRequest&& request) const;
+
         /**
          * <p>Gets information about a specific traffic policy version. To get the
          * information, send a <code>GET</code> request to the <code>/<i>Route 53 API
@@ -1310,6 +1614,11 @@ namespace Model
          */
         virtual void GetTrafficPolicyAsync(const Model::GetTrafficPolicyRequest& request, const GetTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTrafficPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetTrafficPolicyAsync(Model::GetTrafficPolicyRequest&& request, const GetTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about a specified traffic policy instance.</p> <p>To get
          * information about the traffic policy instance, send a <code>GET</code> request
@@ -1336,6 +1645,11 @@ namespace Model
          */
         virtual Model::GetTrafficPolicyInstanceOutcomeCallable GetTrafficPolicyInstanceCallable(const Model::GetTrafficPolicyInstanceRequest& request) const;
 
+        /**
+         * Same as GetTrafficPolicyInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetTrafficPolicyInstanceOutcomeCallable GetTrafficPolicyInstanceCallable(Model::GetTrafficPolicyInstanceRequest&& request) const;
+
         /**
          * <p>Gets information about a specified traffic policy instance.</p> <p>To get
          * information about the traffic policy instance, send a <code>GET</code> request
@@ -1350,6 +1664,11 @@ namespace Model
          */
         virtual void GetTrafficPolicyInstanceAsync(const Model::GetTrafficPolicyInstanceRequest& request, const GetTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTrafficPolicyInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetTrafficPolicyInstanceAsync(Model::GetTrafficPolicyInstanceRequest&& request, const GetTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the number of traffic policy instances that are associated with the
          * current AWS account.</p> <p>To get the number of traffic policy instances, send
@@ -1368,6 +1687,11 @@ namespace Model
          */
         virtual Model::GetTrafficPolicyInstanceCountOutcomeCallable GetTrafficPolicyInstanceCountCallable(const Model::GetTrafficPolicyInstanceCountRequest& request) const;
 
+        /**
+         * Same as GetTrafficPolicyInstanceCountCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetTrafficPolicyInstanceCountOutcomeCallable GetTrafficPolicyInstanceCountCallable(Model::GetTrafficPolicyInstanceCountRequest&& request) const;
+
         /**
          * <p>Gets the number of traffic policy instances that are associated with the
          * current AWS account.</p> <p>To get the number of traffic policy instances, send
@@ -1378,6 +1702,11 @@ namespace Model
          */
         virtual void GetTrafficPolicyInstanceCountAsync(const Model::GetTrafficPolicyInstanceCountRequest& request, const GetTrafficPolicyInstanceCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTrafficPolicyInstanceCountAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetTrafficPolicyInstanceCountAsync(Model::GetTrafficPolicyInstanceCountRequest&& request, const GetTrafficPolicyInstanceCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a list of supported geo locations, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/geolocations</code> resource.
@@ -1414,6 +1743,11 @@ namespace Model
          */
         virtual Model::ListGeoLocationsOutcomeCallable ListGeoLocationsCallable(const Model::ListGeoLocationsRequest& request) const;
 
+        /**
+         * Same as ListGeoLocationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListGeoLocationsOutcomeCallable ListGeoLocationsCallable(Model::ListGeoLocationsRequest&& request) const;
+
         /**
          * <p>To retrieve a list of supported geo locations, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/geolocations</code> resource.
@@ -1433,6 +1767,11 @@ namespace Model
          */
         virtual void ListGeoLocationsAsync(const Model::ListGeoLocationsRequest& request, const ListGeoLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListGeoLocationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListGeoLocationsAsync(Model::ListGeoLocationsRequest&& request, const ListGeoLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a list of your health checks, send a <code>GET</code> request to
          * the <code>/<i>Route 53 API version</i>/healthcheck</code> resource. The response
@@ -1463,6 +1802,11 @@ namespace Model
          */
         virtual Model::ListHealthChecksOutcomeCallable ListHealthChecksCallable(const Model::ListHealthChecksRequest& request) const;
 
+        /**
+         * Same as ListHealthChecksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListHealthChecksOutcomeCallable ListHealthChecksCallable(Model::ListHealthChecksRequest&& request) const;
+
         /**
          * <p>To retrieve a list of your health checks, send a <code>GET</code> request to
          * the <code>/<i>Route 53 API version</i>/healthcheck</code> resource. The response
@@ -1479,6 +1823,11 @@ namespace Model
          */
         virtual void ListHealthChecksAsync(const Model::ListHealthChecksRequest& request, const ListHealthChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListHealthChecksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListHealthChecksAsync(Model::ListHealthChecksRequest&& request, const ListHealthChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a list of your hosted zones, send a <code>GET</code> request to
          * the <code>/<i>Route 53 API version</i>/hostedzone</code> resource. The response
@@ -1509,6 +1858,11 @@ namespace Model
          */
         virtual Model::ListHostedZonesOutcomeCallable ListHostedZonesCallable(const Model::ListHostedZonesRequest& request) const;
 
+        /**
+         * Same as ListHostedZonesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListHostedZonesOutcomeCallable ListHostedZonesCallable(Model::ListHostedZonesRequest&& request) const;
+
         /**
          * <p>To retrieve a list of your hosted zones, send a <code>GET</code> request to
          * the <code>/<i>Route 53 API version</i>/hostedzone</code> resource. The response
@@ -1525,6 +1879,11 @@ namespace Model
          */
         virtual void ListHostedZonesAsync(const Model::ListHostedZonesRequest& request, const ListHostedZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListHostedZonesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListHostedZonesAsync(Model::ListHostedZonesRequest&& request, const ListHostedZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a list of your hosted zones in lexicographic order, send a
          * <code>GET</code> request to the <code>/<i>Route 53 API
@@ -1557,6 +1916,11 @@ namespace Model
          */
         virtual Model::ListHostedZonesByNameOutcomeCallable ListHostedZonesByNameCallable(const Model::ListHostedZonesByNameRequest& request) const;
 
+        /**
+         * Same as ListHostedZonesByNameCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListHostedZonesByNameOutcomeCallable ListHostedZonesByNameCallable(Model::ListHostedZonesByNameRequest&& request) const;
+
         /**
          * <p>To retrieve a list of your hosted zones in lexicographic order, send a
          * <code>GET</code> request to the <code>/<i>Route 53 API
@@ -1574,6 +1938,11 @@ namespace Model
          */
         virtual void ListHostedZonesByNameAsync(const Model::ListHostedZonesByNameRequest& request, const ListHostedZonesByNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListHostedZonesByNameAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListHostedZonesByNameAsync(Model::ListHostedZonesByNameRequest&& request, const ListHostedZonesByNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Imagine all the resource record sets in a zone listed out in front of you.
          * Imagine them sorted lexicographically first by DNS name (with the labels
@@ -1646,6 +2015,11 @@ namespace Model
          */
         virtual Model::ListResourceRecordSetsOutcomeCallable ListResourceRecordSetsCallable(const Model::ListResourceRecordSetsRequest& request) const;
 
+        /**
+         * Same as ListResourceRecordSetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListResourceRecordSetsOutcomeCallable ListResourceRecordSetsCallable(Model::ListResourceRecordSetsRequest&& request) const;
+
         /**
          * <p>Imagine all the resource record sets in a zone listed out in front of you.
          * Imagine them sorted lexicographically first by DNS name (with the labels
@@ -1683,6 +2057,11 @@ namespace Model
          */
         virtual void ListResourceRecordSetsAsync(const Model::ListResourceRecordSetsRequest& request, const ListResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListResourceRecordSetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListResourceRecordSetsAsync(Model::ListResourceRecordSetsRequest&& request, const ListResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To retrieve a list of your reusable delegation sets, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/delegationset</code> resource.
@@ -1713,6 +2092,11 @@ namespace Model
          */
         virtual Model::ListReusableDelegationSetsOutcomeCallable ListReusableDelegationSetsCallable(const Model::ListReusableDelegationSetsRequest& request) const;
 
+        /**
+         * Same as ListReusableDelegationSetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListReusableDelegationSetsOutcomeCallable ListReusableDelegationSetsCallable(Model::ListReusableDelegationSetsRequest&& request) const;
+
         /**
          * <p>To retrieve a list of your reusable delegation sets, send a <code>GET</code>
          * request to the <code>/<i>Route 53 API version</i>/delegationset</code> resource.
@@ -1729,6 +2113,11 @@ namespace Model
          */
         virtual void ListReusableDelegationSetsAsync(const Model::ListReusableDelegationSetsRequest& request, const ListReusableDelegationSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListReusableDelegationSetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListReusableDelegationSetsAsync(Model::ListReusableDelegationSetsRequest&& request, const ListReusableDelegationSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -1741,6 +2130,11 @@ namespace Model
          */
         virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(const Model::ListTagsForResourceRequest& request) const;
 
+        /**
+         * Same as ListTagsForResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(Model::ListTagsForResourceRequest&& request) const;
+
         /**
          * 
          *
@@ -1748,6 +2142,11 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTagsForResourceAsync(Model::ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * 
          */
@@ -1760,6 +2159,11 @@ namespace Model
          */
         virtual Model::ListTagsForResourcesOutcomeCallable ListTagsForResourcesCallable(const Model::ListTagsForResourcesRequest& request) const;
 
+        /**
+         * Same as ListTagsForResourcesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTagsForResourcesOutcomeCallable ListTagsForResourcesCallable(Model::ListTagsForResourcesRequest&& request) const;
+
         /**
          * 
          *
@@ -1767,6 +2171,11 @@ namespace Model
          */
         virtual void ListTagsForResourcesAsync(const Model::ListTagsForResourcesRequest& request, const ListTagsForResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourcesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTagsForResourcesAsync(Model::ListTagsForResourcesRequest&& request, const ListTagsForResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the latest version for every traffic policy that is
          * associated with the current AWS account. To get the information, send a
@@ -1825,6 +2234,11 @@ namespace Model
          */
         virtual Model::ListTrafficPoliciesOutcomeCallable ListTrafficPoliciesCallable(const Model::ListTrafficPoliciesRequest& request) const;
 
+        /**
+         * Same as ListTrafficPoliciesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTrafficPoliciesOutcomeCallable ListTrafficPoliciesCallable(Model::ListTrafficPoliciesRequest&& request) const;
+
         /**
          * <p>Gets information about the latest version for every traffic policy that is
          * associated with the current AWS account. To get the information, send a
@@ -1855,6 +2269,11 @@ namespace Model
          */
         virtual void ListTrafficPoliciesAsync(const Model::ListTrafficPoliciesRequest& request, const ListTrafficPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTrafficPoliciesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTrafficPoliciesAsync(Model::ListTrafficPoliciesRequest&& request, const ListTrafficPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the traffic policy instances that you created by using
          * the current AWS account.</p> <note>After you submit an
@@ -1921,6 +2340,11 @@ namespace Model
          */
         virtual Model::ListTrafficPolicyInstancesOutcomeCallable ListTrafficPolicyInstancesCallable(const Model::ListTrafficPolicyInstancesRequest& request) const;
 
+        /**
+         * Same as ListTrafficPolicyInstancesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTrafficPolicyInstancesOutcomeCallable ListTrafficPolicyInstancesCallable(Model::ListTrafficPolicyInstancesRequest&& request) const;
+
         /**
          * <p>Gets information about the traffic policy instances that you created by using
          * the current AWS account.</p> <note>After you submit an
@@ -1955,6 +2379,11 @@ namespace Model
          */
         virtual void ListTrafficPolicyInstancesAsync(const Model::ListTrafficPolicyInstancesRequest& request, const ListTrafficPolicyInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTrafficPolicyInstancesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTrafficPolicyInstancesAsync(Model::ListTrafficPolicyInstancesRequest&& request, const ListTrafficPolicyInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the traffic policy instances that you created in a
          * specified hosted zone.</p> <note>After you submit an
@@ -2021,6 +2450,11 @@ namespace Model
          */
         virtual Model::ListTrafficPolicyInstancesByHostedZoneOutcomeCallable ListTrafficPolicyInstancesByHostedZoneCallable(const Model::ListTrafficPolicyInstancesByHostedZoneRequest& request) const;
 
+        /**
+         * Same as ListTrafficPolicyInstancesByHostedZoneCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTrafficPolicyInstancesByHostedZoneOutcomeCallable ListTrafficPolicyInstancesByHostedZoneCallable(Model::ListTrafficPolicyInstancesByHostedZoneRequest&& request) const;
+
         /**
          * <p>Gets information about the traffic policy instances that you created in a
          * specified hosted zone.</p> <note>After you submit an
@@ -2055,6 +2489,11 @@ namespace Model
          */
         virtual void ListTrafficPolicyInstancesByHostedZoneAsync(const Model::ListTrafficPolicyInstancesByHostedZoneRequest& request, const ListTrafficPolicyInstancesByHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTrafficPolicyInstancesByHostedZoneAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTrafficPolicyInstancesByHostedZoneAsync(Model::ListTrafficPolicyInstancesByHostedZoneRequest&& request, const ListTrafficPolicyInstancesByHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about the traffic policy instances that you created by using
          * a specify traffic policy version.</p> <note>After you submit a
@@ -2127,6 +2566,11 @@ namespace Model
          */
         virtual Model::ListTrafficPolicyInstancesByPolicyOutcomeCallable ListTrafficPolicyInstancesByPolicyCallable(const Model::ListTrafficPolicyInstancesByPolicyRequest& request) const;
 
+        /**
+         * Same as ListTrafficPolicyInstancesByPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTrafficPolicyInstancesByPolicyOutcomeCallable ListTrafficPolicyInstancesByPolicyCallable(Model::ListTrafficPolicyInstancesByPolicyRequest&& request) const;
+
         /**
          * <p>Gets information about the traffic policy instances that you created by using
          * a specify traffic policy version.</p> <note>After you submit a
@@ -2164,6 +2608,11 @@ namespace Model
          */
         virtual void ListTrafficPolicyInstancesByPolicyAsync(const Model::ListTrafficPolicyInstancesByPolicyRequest& request, const ListTrafficPolicyInstancesByPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTrafficPolicyInstancesByPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTrafficPolicyInstancesByPolicyAsync(Model::ListTrafficPolicyInstancesByPolicyRequest&& request, const ListTrafficPolicyInstancesByPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets information about all of the versions for a specified traffic policy.
          * <code>ListTrafficPolicyVersions</code> lists only versions that have not been
@@ -2220,6 +2669,11 @@ namespace Model
          */
         virtual Model::ListTrafficPolicyVersionsOutcomeCallable ListTrafficPolicyVersionsCallable(const Model::ListTrafficPolicyVersionsRequest& request) const;
 
+        /**
+         * Same as ListTrafficPolicyVersionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTrafficPolicyVersionsOutcomeCallable ListTrafficPolicyVersionsCallable(Model::ListTrafficPolicyVersionsRequest&& request) const;
+
         /**
          * <p>Gets information about all of the versions for a specified traffic policy.
          * <code>ListTrafficPolicyVersions</code> lists only versions that have not been
@@ -2249,6 +2703,11 @@ namespace Model
          */
         virtual void ListTrafficPolicyVersionsAsync(const Model::ListTrafficPolicyVersionsRequest& request, const ListTrafficPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTrafficPolicyVersionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTrafficPolicyVersionsAsync(Model::ListTrafficPolicyVersionsRequest&& request, const ListTrafficPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This action updates an existing health check.</p> <p>To update a health
          * check, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -2271,6 +2730,11 @@ namespace Model
          */
         virtual Model::UpdateHealthCheckOutcomeCallable UpdateHealthCheckCallable(const Model::UpdateHealthCheckRequest& request) const;
 
+        /**
+         * Same as UpdateHealthCheckCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateHealthCheckOutcomeCallable UpdateHealthCheckCallable(Model::UpdateHealthCheckRequest&& request) const;
+
         /**
          * <p>This action updates an existing health check.</p> <p>To update a health
          * check, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -2283,6 +2747,11 @@ namespace Model
          */
         virtual void UpdateHealthCheckAsync(const Model::UpdateHealthCheckRequest& request, const UpdateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateHealthCheckAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateHealthCheckAsync(Model::UpdateHealthCheckRequest&& request, const UpdateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>To update the hosted zone comment, send a <code>POST</code> request to the
          * <code>/<i>Route 53 API version</i>/hostedzone/<i>hosted zone ID</i></code>
@@ -2305,6 +2774,11 @@ namespace Model
          */
         virtual Model::UpdateHostedZoneCommentOutcomeCallable UpdateHostedZoneCommentCallable(const Model::UpdateHostedZoneCommentRequest& request) const;
 
+        /**
+         * Same as UpdateHostedZoneCommentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateHostedZoneCommentOutcomeCallable UpdateHostedZoneCommentCallable(Model::UpdateHostedZoneCommentRequest&& request) const;
+
         /**
          * <p>To update the hosted zone comment, send a <code>POST</code> request to the
          * <code>/<i>Route 53 API version</i>/hostedzone/<i>hosted zone ID</i></code>
@@ -2317,6 +2791,11 @@ namespace Model
          */
         virtual void UpdateHostedZoneCommentAsync(const Model::UpdateHostedZoneCommentRequest& request, const UpdateHostedZoneCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateHostedZoneCommentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateHostedZoneCommentAsync(Model::UpdateHostedZoneCommentRequest&& request, const UpdateHostedZoneCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the comment for a specified traffic policy version.</p> <p>To update
          * the comment, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -2335,6 +2814,11 @@ namespace Model
          */
         virtual Model::UpdateTrafficPolicyCommentOutcomeCallable UpdateTrafficPolicyCommentCallable(const Model::UpdateTrafficPolicyCommentRequest& request) const;
 
+        /**
+         * Same as UpdateTrafficPolicyCommentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateTrafficPolicyCommentOutcomeCallable UpdateTrafficPolicyCommentCallable(Model::UpdateTrafficPolicyCommentRequest&& request) const;
+
         /**
          * <p>Updates the comment for a specified traffic policy version.</p> <p>To update
          * the comment, send a <code>POST</code> request to the <code>/<i>Route 53 API
@@ -2345,6 +2829,11 @@ namespace Model
          */
         virtual void UpdateTrafficPolicyCommentAsync(const Model::UpdateTrafficPolicyCommentRequest& request, const UpdateTrafficPolicyCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateTrafficPolicyCommentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateTrafficPolicyCommentAsync(Model::UpdateTrafficPolicyCommentRequest&& request, const UpdateTrafficPolicyCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the resource record sets in a specified hosted zone that were created
          * based on the settings in a specified traffic policy version.</p> <important>The
@@ -2397,6 +2886,11 @@ namespace Model
          */
         virtual Model::UpdateTrafficPolicyInstanceOutcomeCallable UpdateTrafficPolicyInstanceCallable(const Model::UpdateTrafficPolicyInstanceRequest& request) const;
 
+        /**
+         * Same as UpdateTrafficPolicyInstanceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateTrafficPolicyInstanceOutcomeCallable UpdateTrafficPolicyInstanceCallable(Model::UpdateTrafficPolicyInstanceRequest&& request) const;
+
         /**
          * <p>Updates the resource record sets in a specified hosted zone that were created
          * based on the settings in a specified traffic policy version.</p> <important>The
@@ -2424,6 +2918,108 @@ namespace Model
          */
         virtual void UpdateTrafficPolicyInstanceAsync(const Model::UpdateTrafficPolicyInstanceRequest& request, const UpdateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateTrafficPolicyInstanceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateTrafficPolicyInstanceAsync(Model::UpdateTrafficPolicyInstanceRequest&& request, const UpdateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AssociateVPCWithHostedZoneOutcome> AssociateVPCWithHostedZoneAwaitable(const Model::AssociateVPCWithHostedZoneRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::AssociateVPCWithHostedZone, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssociateVPCWithHostedZoneOutcome> AssociateVPCWithHostedZoneAwaitable(Model::AssociateVPCWithHostedZoneRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::AssociateVPCWithHostedZone, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ChangeResourceRecordSetsOutcome> ChangeResourceRecordSetsAwaitable(const Model::ChangeResourceRecordSetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ChangeResourceRecordSets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ChangeResourceRecordSetsOutcome> ChangeResourceRecordSetsAwaitable(Model::ChangeResourceRecordSetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ChangeResourceRecordSets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ChangeTagsForResourceOutcome> ChangeTagsForResourceAwaitable(const Model::ChangeTagsForResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ChangeTagsForResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ChangeTagsForResourceOutcome> ChangeTagsForResourceAwaitable(Model::ChangeTagsForResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ChangeTagsForResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateHealthCheckOutcome> CreateHealthCheckAwaitable(const Model::CreateHealthCheckRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::CreateHealthCheck, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateHealthCheckOutcome> CreateHealthCheckAwaitable(Model::CreateHealthCheckRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::CreateHealthCheck, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateHostedZoneOutcome> CreateHostedZoneAwaitable(const Model::CreateHostedZoneRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::CreateHostedZone, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateHostedZoneOutcome> CreateHostedZoneAwaitable(Model::CreateHostedZoneRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::CreateHostedZone, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateReusableDelegationSetOutcome> CreateReusableDelegationSetAwaitable(const Model::CreateReusableDelegationSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::CreateReusableDelegationSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateReusableDelegationSetOutcome> CreateReusableDelegationSetAwaitable(Model::CreateReusableDelegationSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::CreateReusableDelegationSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTrafficPolicyOutcome> CreateTrafficPolicyAwaitable(const Model::CreateTrafficPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::CreateTrafficPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTrafficPolicyOutcome> CreateTrafficPolicyAwaitable(Model::CreateTrafficPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::CreateTrafficPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTrafficPolicyInstanceOutcome> CreateTrafficPolicyInstanceAwaitable(const Model::CreateTrafficPolicyInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::CreateTrafficPolicyInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTrafficPolicyInstanceOutcome> CreateTrafficPolicyInstanceAwaitable(Model::CreateTrafficPolicyInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::CreateTrafficPolicyInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTrafficPolicyVersionOutcome> CreateTrafficPolicyVersionAwaitable(const Model::CreateTrafficPolicyVersionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::CreateTrafficPolicyVersion, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTrafficPolicyVersionOutcome> CreateTrafficPolicyVersionAwaitable(Model::CreateTrafficPolicyVersionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::CreateTrafficPolicyVersion, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteHealthCheckOutcome> DeleteHealthCheckAwaitable(const Model::DeleteHealthCheckRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::DeleteHealthCheck, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteHealthCheckOutcome> DeleteHealthCheckAwaitable(Model::DeleteHealthCheckRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::DeleteHealthCheck, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteHostedZoneOutcome> DeleteHostedZoneAwaitable(const Model::DeleteHostedZoneRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::DeleteHostedZone, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteHostedZoneOutcome> DeleteHostedZoneAwaitable(Model::DeleteHostedZoneRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::DeleteHostedZone, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteReusableDelegationSetOutcome> DeleteReusableDelegationSetAwaitable(const Model::DeleteReusableDelegationSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::DeleteReusableDelegationSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteReusableDelegationSetOutcome> DeleteReusableDelegationSetAwaitable(Model::DeleteReusableDelegationSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::DeleteReusableDelegationSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTrafficPolicyOutcome> DeleteTrafficPolicyAwaitable(const Model::DeleteTrafficPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::DeleteTrafficPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTrafficPolicyOutcome> DeleteTrafficPolicyAwaitable(Model::DeleteTrafficPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::DeleteTrafficPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTrafficPolicyInstanceOutcome> DeleteTrafficPolicyInstanceAwaitable(const Model::DeleteTrafficPolicyInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::DeleteTrafficPolicyInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTrafficPolicyInstanceOutcome> DeleteTrafficPolicyInstanceAwaitable(Model::DeleteTrafficPolicyInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::DeleteTrafficPolicyInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisassociateVPCFromHostedZoneOutcome> DisassociateVPCFromHostedZoneAwaitable(const Model::DisassociateVPCFromHostedZoneRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::DisassociateVPCFromHostedZone, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisassociateVPCFromHostedZoneOutcome> DisassociateVPCFromHostedZoneAwaitable(Model::DisassociateVPCFromHostedZoneRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::DisassociateVPCFromHostedZone, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetChangeOutcome> GetChangeAwaitable(const Model::GetChangeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetChange, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetChangeOutcome> GetChangeAwaitable(Model::GetChangeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetChange, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCheckerIpRangesOutcome> GetCheckerIpRangesAwaitable(const Model::GetCheckerIpRangesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetCheckerIpRanges, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetCheckerIpRangesOutcome> GetCheckerIpRangesAwaitable(Model::GetCheckerIpRangesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetCheckerIpRanges, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetGeoLocationOutcome> GetGeoLocationAwaitable(const Model::GetGeoLocationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetGeoLocation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetGeoLocationOutcome> GetGeoLocationAwaitable(Model::GetGeoLocationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetGeoLocation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetHealthCheckOutcome> GetHealthCheckAwaitable(const Model::GetHealthCheckRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetHealthCheck, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetHealthCheckOutcome> GetHealthCheckAwaitable(Model::GetHealthCheckRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetHealthCheck, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetHealthCheckCountOutcome> GetHealthCheckCountAwaitable(const Model::GetHealthCheckCountRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetHealthCheckCount, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetHealthCheckCountOutcome> GetHealthCheckCountAwaitable(Model::GetHealthCheckCountRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetHealthCheckCount, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetHealthCheckLastFailureReasonOutcome> GetHealthCheckLastFailureReasonAwaitable(const Model::GetHealthCheckLastFailureReasonRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetHealthCheckLastFailureReason, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetHealthCheckLastFailureReasonOutcome> GetHealthCheckLastFailureReasonAwaitable(Model::GetHealthCheckLastFailureReasonRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetHealthCheckLastFailureReason, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetHealthCheckStatusOutcome> GetHealthCheckStatusAwaitable(const Model::GetHealthCheckStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetHealthCheckStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetHealthCheckStatusOutcome> GetHealthCheckStatusAwaitable(Model::GetHealthCheckStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetHealthCheckStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetHostedZoneOutcome> GetHostedZoneAwaitable(const Model::GetHostedZoneRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetHostedZone, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetHostedZoneOutcome> GetHostedZoneAwaitable(Model::GetHostedZoneRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetHostedZone, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetHostedZoneCountOutcome> GetHostedZoneCountAwaitable(const Model::GetHostedZoneCountRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetHostedZoneCount, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetHostedZoneCountOutcome> GetHostedZoneCountAwaitable(Model::GetHostedZoneCountRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetHostedZoneCount, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetReusableDelegationSetOutcome> GetReusableDelegationSetAwaitable(const Model::GetReusableDelegationSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetReusableDelegationSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetReusableDelegationSetOutcome> GetReusableDelegationSetAwaitable(Model::GetReusableDelegationSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetReusableDelegationSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTrafficPolicyOutcome> GetTrafficPolicyAwaitable(const Model::GetTrafficPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetTrafficPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTrafficPolicyOutcome> GetTrafficPolicyAwaitable(Model::GetTrafficPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetTrafficPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTrafficPolicyInstanceOutcome> GetTrafficPolicyInstanceAwaitable(const Model::GetTrafficPolicyInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetTrafficPolicyInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTrafficPolicyInstanceOutcome> GetTrafficPolicyInstanceAwaitable(Model::GetTrafficPolicyInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetTrafficPolicyInstance, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTrafficPolicyInstanceCountOutcome> GetTrafficPolicyInstanceCountAwaitable(const Model::GetTrafficPolicyInstanceCountRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetTrafficPolicyInstanceCount, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTrafficPolicyInstanceCountOutcome> GetTrafficPolicyInstanceCountAwaitable(Model::GetTrafficPolicyInstanceCountRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::GetTrafficPolicyInstanceCount, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListGeoLocationsOutcome> ListGeoLocationsAwaitable(const Model::ListGeoLocationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListGeoLocations, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListGeoLocationsOutcome> ListGeoLocationsAwaitable(Model::ListGeoLocationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListGeoLocations, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListHealthChecksOutcome> ListHealthChecksAwaitable(const Model::ListHealthChecksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListHealthChecks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListHealthChecksOutcome> ListHealthChecksAwaitable(Model::ListHealthChecksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListHealthChecks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListHostedZonesOutcome> ListHostedZonesAwaitable(const Model::ListHostedZonesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListHostedZones, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListHostedZonesOutcome> ListHostedZonesAwaitable(Model::ListHostedZonesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListHostedZones, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListHostedZonesByNameOutcome> ListHostedZonesByNameAwaitable(const Model::ListHostedZonesByNameRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListHostedZonesByName, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListHostedZonesByNameOutcome> ListHostedZonesByNameAwaitable(Model::ListHostedZonesByNameRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListHostedZonesByName, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListResourceRecordSetsOutcome> ListResourceRecordSetsAwaitable(const Model::ListResourceRecordSetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListResourceRecordSets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListResourceRecordSetsOutcome> ListResourceRecordSetsAwaitable(Model::ListResourceRecordSetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListResourceRecordSets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListReusableDelegationSetsOutcome> ListReusableDelegationSetsAwaitable(const Model::ListReusableDelegationSetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListReusableDelegationSets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListReusableDelegationSetsOutcome> ListReusableDelegationSetsAwaitable(Model::ListReusableDelegationSetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListReusableDelegationSets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(const Model::ListTagsForResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListTagsForResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(Model::ListTagsForResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListTagsForResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForResourcesOutcome> ListTagsForResourcesAwaitable(const Model::ListTagsForResourcesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListTagsForResources, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForResourcesOutcome> ListTagsForResourcesAwaitable(Model::ListTagsForResourcesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListTagsForResources, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTrafficPoliciesOutcome> ListTrafficPoliciesAwaitable(const Model::ListTrafficPoliciesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListTrafficPolicies, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTrafficPoliciesOutcome> ListTrafficPoliciesAwaitable(Model::ListTrafficPoliciesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListTrafficPolicies, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTrafficPolicyInstancesOutcome> ListTrafficPolicyInstancesAwaitable(const Model::ListTrafficPolicyInstancesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListTrafficPolicyInstances, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTrafficPolicyInstancesOutcome> ListTrafficPolicyInstancesAwaitable(Model::ListTrafficPolicyInstancesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListTrafficPolicyInstances, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTrafficPolicyInstancesByHostedZoneOutcome> ListTrafficPolicyInstancesByHostedZoneAwaitable(const Model::ListTrafficPolicyInstancesByHostedZoneRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListTrafficPolicyInstancesByHostedZone, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTrafficPolicyInstancesByHostedZoneOutcome> ListTrafficPolicyInstancesByHostedZoneAwaitable(Model::ListTrafficPolicyInstancesByHostedZoneRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListTrafficPolicyInstancesByHostedZone, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTrafficPolicyInstancesByPolicyOutcome> ListTrafficPolicyInstancesByPolicyAwaitable(const Model::ListTrafficPolicyInstancesByPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListTrafficPolicyInstancesByPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTrafficPolicyInstancesByPolicyOutcome> ListTrafficPolicyInstancesByPolicyAwaitable(Model::ListTrafficPolicyInstancesByPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListTrafficPolicyInstancesByPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTrafficPolicyVersionsOutcome> ListTrafficPolicyVersionsAwaitable(const Model::ListTrafficPolicyVersionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListTrafficPolicyVersions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTrafficPolicyVersionsOutcome> ListTrafficPolicyVersionsAwaitable(Model::ListTrafficPolicyVersionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::ListTrafficPolicyVersions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateHealthCheckOutcome> UpdateHealthCheckAwaitable(const Model::UpdateHealthCheckRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::UpdateHealthCheck, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateHealthCheckOutcome> UpdateHealthCheckAwaitable(Model::UpdateHealthCheckRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::UpdateHealthCheck, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateHostedZoneCommentOutcome> UpdateHostedZoneCommentAwaitable(const Model::UpdateHostedZoneCommentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::UpdateHostedZoneComment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateHostedZoneCommentOutcome> UpdateHostedZoneCommentAwaitable(Model::UpdateHostedZoneCommentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::UpdateHostedZoneComment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateTrafficPolicyCommentOutcome> UpdateTrafficPolicyCommentAwaitable(const Model::UpdateTrafficPolicyCommentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::UpdateTrafficPolicyComment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateTrafficPolicyCommentOutcome> UpdateTrafficPolicyCommentAwaitable(Model::UpdateTrafficPolicyCommentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::UpdateTrafficPolicyComment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateTrafficPolicyInstanceOutcome> UpdateTrafficPolicyInstanceAwaitable(const Model::UpdateTrafficPolicyInstanceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::UpdateTrafficPolicyInstance, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateTrafficPolicyInstanceOutcome> UpdateTrafficPolicyInstanceAwaitable(Model::UpdateTrafficPolicyInstanceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53Client::UpdateTrafficPolicyInstance, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
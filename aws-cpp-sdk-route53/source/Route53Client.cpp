@@ -22,6 +22,7 @@
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/StringBuilder.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/route53/Route53Client.h>
 #include <aws/route53/Route53Endpoint.h>
@@ -137,11 +138,11 @@ void Route53Client::init(const ClientConfiguration& config)
 }
 AssociateVPCWithHostedZoneOutcome Route53Client::AssociateVPCWithHostedZone(const AssociateVPCWithHostedZoneRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/hostedzone/";
-  ss << request.GetHostedZoneId();
-  ss << "/associatevpc";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/hostedzone/");
+  uri.Append(request.GetHostedZoneId());
+  uri.Append("/associatevpc");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return AssociateVPCWithHostedZoneOutcome(AssociateVPCWithHostedZoneResult(outcome.GetResult()));
@@ -154,12 +155,22 @@ AssociateVPCWithHostedZoneOutcome Route53Client::AssociateVPCWithHostedZone(cons
 
 AssociateVPCWithHostedZoneOutcomeCallable Route53Client::AssociateVPCWithHostedZoneCallable(const AssociateVPCWithHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::AssociateVPCWithHostedZone, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::AssociateVPCWithHostedZone, Aws::Client::RejectedCallOutcome<AssociateVPCWithHostedZoneOutcome>(), this, request);
+}
+
+AssociateVPCWithHostedZoneOutcomeCallable Route53Client::AssociateVPCWithHostedZoneCallable(AssociateVPCWithHostedZoneRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::AssociateVPCWithHostedZone, Aws::Client::RejectedCallOutcome<AssociateVPCWithHostedZoneOutcome>(), this, std::move(request));
 }
 
 void Route53Client::AssociateVPCWithHostedZoneAsync(const AssociateVPCWithHostedZoneRequest& request, const AssociateVPCWithHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::AssociateVPCWithHostedZoneAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::AssociateVPCWithHostedZoneAsyncHelper, Aws::Client::RejectedAsyncCall<AssociateVPCWithHostedZoneOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::AssociateVPCWithHostedZoneAsync(AssociateVPCWithHostedZoneRequest&& request, const AssociateVPCWithHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::AssociateVPCWithHostedZoneAsyncHelper, Aws::Client::RejectedAsyncCall<AssociateVPCWithHostedZoneOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::AssociateVPCWithHostedZoneAsyncHelper(const AssociateVPCWithHostedZoneRequest& request, const AssociateVPCWithHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -169,11 +180,11 @@ void Route53Client::AssociateVPCWithHostedZoneAsyncHelper(const AssociateVPCWith
 
 ChangeResourceRecordSetsOutcome Route53Client::ChangeResourceRecordSets(const ChangeResourceRecordSetsRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/hostedzone/";
-  ss << request.GetHostedZoneId();
-  ss << "/rrset/";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/hostedzone/");
+  uri.Append(request.GetHostedZoneId());
+  uri.Append("/rrset/");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return ChangeResourceRecordSetsOutcome(ChangeResourceRecordSetsResult(outcome.GetResult()));
@@ -186,12 +197,22 @@ ChangeResourceRecordSetsOutcome Route53Client::ChangeResourceRecordSets(const Ch
 
 ChangeResourceRecordSetsOutcomeCallable Route53Client::ChangeResourceRecordSetsCallable(const ChangeResourceRecordSetsRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ChangeResourceRecordSets, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ChangeResourceRecordSets, Aws::Client::RejectedCallOutcome<ChangeResourceRecordSetsOutcome>(), this, request);
+}
+
+ChangeResourceRecordSetsOutcomeCallable Route53Client::ChangeResourceRecordSetsCallable(ChangeResourceRecordSetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ChangeResourceRecordSets, Aws::Client::RejectedCallOutcome<ChangeResourceRecordSetsOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ChangeResourceRecordSetsAsync(const ChangeResourceRecordSetsRequest& request, const ChangeResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ChangeResourceRecordSetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ChangeResourceRecordSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ChangeResourceRecordSetsOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ChangeResourceRecordSetsAsync(ChangeResourceRecordSetsRequest&& request, const ChangeResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ChangeResourceRecordSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ChangeResourceRecordSetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ChangeResourceRecordSetsAsyncHelper(const ChangeResourceRecordSetsRequest& request, const ChangeResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -201,12 +222,12 @@ void Route53Client::ChangeResourceRecordSetsAsyncHelper(const ChangeResourceReco
 
 ChangeTagsForResourceOutcome Route53Client::ChangeTagsForResource(const ChangeTagsForResourceRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/tags/";
-  ss << TagResourceTypeMapper::GetNameForTagResourceType(request.GetResourceType());
-  ss << "/";
-  ss << request.GetResourceId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/tags/");
+  uri.Append(TagResourceTypeMapper::GetNameForTagResourceType(request.GetResourceType()));
+  uri.Append("/");
+  uri.Append(request.GetResourceId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return ChangeTagsForResourceOutcome(ChangeTagsForResourceResult(outcome.GetResult()));
@@ -219,12 +240,22 @@ ChangeTagsForResourceOutcome Route53Client::ChangeTagsForResource(const ChangeTa
 
 ChangeTagsForResourceOutcomeCallable Route53Client::ChangeTagsForResourceCallable(const ChangeTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ChangeTagsForResource, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ChangeTagsForResource, Aws::Client::RejectedCallOutcome<ChangeTagsForResourceOutcome>(), this, request);
+}
+
+ChangeTagsForResourceOutcomeCallable Route53Client::ChangeTagsForResourceCallable(ChangeTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ChangeTagsForResource, Aws::Client::RejectedCallOutcome<ChangeTagsForResourceOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ChangeTagsForResourceAsync(const ChangeTagsForResourceRequest& request, const ChangeTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ChangeTagsForResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ChangeTagsForResourceAsyncHelper, Aws::Client::RejectedAsyncCall<ChangeTagsForResourceOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ChangeTagsForResourceAsync(ChangeTagsForResourceRequest&& request, const ChangeTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ChangeTagsForResourceAsyncHelper, Aws::Client::RejectedAsyncCall<ChangeTagsForResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ChangeTagsForResourceAsyncHelper(const ChangeTagsForResourceRequest& request, const ChangeTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -234,9 +265,9 @@ void Route53Client::ChangeTagsForResourceAsyncHelper(const ChangeTagsForResource
 
 CreateHealthCheckOutcome Route53Client::CreateHealthCheck(const CreateHealthCheckRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/healthcheck";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/healthcheck");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return CreateHealthCheckOutcome(CreateHealthCheckResult(outcome.GetResult()));
@@ -249,12 +280,22 @@ CreateHealthCheckOutcome Route53Client::CreateHealthCheck(const CreateHealthChec
 
 CreateHealthCheckOutcomeCallable Route53Client::CreateHealthCheckCallable(const CreateHealthCheckRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::CreateHealthCheck, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::CreateHealthCheck, Aws::Client::RejectedCallOutcome<CreateHealthCheckOutcome>(), this, request);
+}
+
+CreateHealthCheckOutcomeCallable Route53Client::CreateHealthCheckCallable(CreateHealthCheckRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::CreateHealthCheck, Aws::Client::RejectedCallOutcome<CreateHealthCheckOutcome>(), this, std::move(request));
 }
 
 void Route53Client::CreateHealthCheckAsync(const CreateHealthCheckRequest& request, const CreateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::CreateHealthCheckAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::CreateHealthCheckAsyncHelper, Aws::Client::RejectedAsyncCall<CreateHealthCheckOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::CreateHealthCheckAsync(CreateHealthCheckRequest&& request, const CreateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::CreateHealthCheckAsyncHelper, Aws::Client::RejectedAsyncCall<CreateHealthCheckOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::CreateHealthCheckAsyncHelper(const CreateHealthCheckRequest& request, const CreateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -264,9 +305,9 @@ void Route53Client::CreateHealthCheckAsyncHelper(const CreateHealthCheckRequest&
 
 CreateHostedZoneOutcome Route53Client::CreateHostedZone(const CreateHostedZoneRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/hostedzone";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/hostedzone");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return CreateHostedZoneOutcome(CreateHostedZoneResult(outcome.GetResult()));
@@ -279,12 +320,22 @@ CreateHostedZoneOutcome Route53Client::CreateHostedZone(const CreateHostedZoneRe
 
 CreateHostedZoneOutcomeCallable Route53Client::CreateHostedZoneCallable(const CreateHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::CreateHostedZone, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::CreateHostedZone, Aws::Client::RejectedCallOutcome<CreateHostedZoneOutcome>(), this, request);
+}
+
+CreateHostedZoneOutcomeCallable Route53Client::CreateHostedZoneCallable(CreateHostedZoneRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::CreateHostedZone, Aws::Client::RejectedCallOutcome<CreateHostedZoneOutcome>(), this, std::move(request));
 }
 
 void Route53Client::CreateHostedZoneAsync(const CreateHostedZoneRequest& request, const CreateHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::CreateHostedZoneAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::CreateHostedZoneAsyncHelper, Aws::Client::RejectedAsyncCall<CreateHostedZoneOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::CreateHostedZoneAsync(CreateHostedZoneRequest&& request, const CreateHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::CreateHostedZoneAsyncHelper, Aws::Client::RejectedAsyncCall<CreateHostedZoneOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::CreateHostedZoneAsyncHelper(const CreateHostedZoneRequest& request, const CreateHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -294,9 +345,9 @@ void Route53Client::CreateHostedZoneAsyncHelper(const CreateHostedZoneRequest& r
 
 CreateReusableDelegationSetOutcome Route53Client::CreateReusableDelegationSet(const CreateReusableDelegationSetRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/delegationset";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/delegationset");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return CreateReusableDelegationSetOutcome(CreateReusableDelegationSetResult(outcome.GetResult()));
@@ -309,12 +360,22 @@ CreateReusableDelegationSetOutcome Route53Client::CreateReusableDelegationSet(co
 
 CreateReusableDelegationSetOutcomeCallable Route53Client::CreateReusableDelegationSetCallable(const CreateReusableDelegationSetRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::CreateReusableDelegationSet, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::CreateReusableDelegationSet, Aws::Client::RejectedCallOutcome<CreateReusableDelegationSetOutcome>(), this, request);
+}
+
+CreateReusableDelegationSetOutcomeCallable Route53Client::CreateReusableDelegationSetCallable(CreateReusableDelegationSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::CreateReusableDelegationSet, Aws::Client::RejectedCallOutcome<CreateReusableDelegationSetOutcome>(), this, std::move(request));
 }
 
 void Route53Client::CreateReusableDelegationSetAsync(const CreateReusableDelegationSetRequest& request, const CreateReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::CreateReusableDelegationSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::CreateReusableDelegationSetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateReusableDelegationSetOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::CreateReusableDelegationSetAsync(CreateReusableDelegationSetRequest&& request, const CreateReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::CreateReusableDelegationSetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateReusableDelegationSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::CreateReusableDelegationSetAsyncHelper(const CreateReusableDelegationSetRequest& request, const CreateReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -324,9 +385,9 @@ void Route53Client::CreateReusableDelegationSetAsyncHelper(const CreateReusableD
 
 CreateTrafficPolicyOutcome Route53Client::CreateTrafficPolicy(const CreateTrafficPolicyRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicy";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicy");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return CreateTrafficPolicyOutcome(CreateTrafficPolicyResult(outcome.GetResult()));
@@ -339,12 +400,22 @@ CreateTrafficPolicyOutcome Route53Client::CreateTrafficPolicy(const CreateTraffi
 
 CreateTrafficPolicyOutcomeCallable Route53Client::CreateTrafficPolicyCallable(const CreateTrafficPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::CreateTrafficPolicy, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::CreateTrafficPolicy, Aws::Client::RejectedCallOutcome<CreateTrafficPolicyOutcome>(), this, request);
+}
+
+CreateTrafficPolicyOutcomeCallable Route53Client::CreateTrafficPolicyCallable(CreateTrafficPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::CreateTrafficPolicy, Aws::Client::RejectedCallOutcome<CreateTrafficPolicyOutcome>(), this, std::move(request));
 }
 
 void Route53Client::CreateTrafficPolicyAsync(const CreateTrafficPolicyRequest& request, const CreateTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::CreateTrafficPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::CreateTrafficPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTrafficPolicyOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::CreateTrafficPolicyAsync(CreateTrafficPolicyRequest&& request, const CreateTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::CreateTrafficPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTrafficPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::CreateTrafficPolicyAsyncHelper(const CreateTrafficPolicyRequest& request, const CreateTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -354,9 +425,9 @@ void Route53Client::CreateTrafficPolicyAsyncHelper(const CreateTrafficPolicyRequ
 
 CreateTrafficPolicyInstanceOutcome Route53Client::CreateTrafficPolicyInstance(const CreateTrafficPolicyInstanceRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicyinstance";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicyinstance");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return CreateTrafficPolicyInstanceOutcome(CreateTrafficPolicyInstanceResult(outcome.GetResult()));
@@ -369,12 +440,22 @@ CreateTrafficPolicyInstanceOutcome Route53Client::CreateTrafficPolicyInstance(co
 
 CreateTrafficPolicyInstanceOutcomeCallable Route53Client::CreateTrafficPolicyInstanceCallable(const CreateTrafficPolicyInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::CreateTrafficPolicyInstance, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::CreateTrafficPolicyInstance, Aws::Client::RejectedCallOutcome<CreateTrafficPolicyInstanceOutcome>(), this, request);
+}
+
+CreateTrafficPolicyInstanceOutcomeCallable Route53Client::CreateTrafficPolicyInstanceCallable(CreateTrafficPolicyInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::CreateTrafficPolicyInstance, Aws::Client::RejectedCallOutcome<CreateTrafficPolicyInstanceOutcome>(), this, std::move(request));
 }
 
 void Route53Client::CreateTrafficPolicyInstanceAsync(const CreateTrafficPolicyInstanceRequest& request, const CreateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::CreateTrafficPolicyInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::CreateTrafficPolicyInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTrafficPolicyInstanceOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::CreateTrafficPolicyInstanceAsync(CreateTrafficPolicyInstanceRequest&& request, const CreateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::CreateTrafficPolicyInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTrafficPolicyInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::CreateTrafficPolicyInstanceAsyncHelper(const CreateTrafficPolicyInstanceRequest& request, const CreateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -384,10 +465,10 @@ void Route53Client::CreateTrafficPolicyInstanceAsyncHelper(const CreateTrafficPo
 
 CreateTrafficPolicyVersionOutcome Route53Client::CreateTrafficPolicyVersion(const CreateTrafficPolicyVersionRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicy/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicy/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return CreateTrafficPolicyVersionOutcome(CreateTrafficPolicyVersionResult(outcome.GetResult()));
@@ -400,12 +481,22 @@ CreateTrafficPolicyVersionOutcome Route53Client::CreateTrafficPolicyVersion(cons
 
 CreateTrafficPolicyVersionOutcomeCallable Route53Client::CreateTrafficPolicyVersionCallable(const CreateTrafficPolicyVersionRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::CreateTrafficPolicyVersion, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::CreateTrafficPolicyVersion, Aws::Client::RejectedCallOutcome<CreateTrafficPolicyVersionOutcome>(), this, request);
+}
+
+CreateTrafficPolicyVersionOutcomeCallable Route53Client::CreateTrafficPolicyVersionCallable(CreateTrafficPolicyVersionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::CreateTrafficPolicyVersion, Aws::Client::RejectedCallOutcome<CreateTrafficPolicyVersionOutcome>(), this, std::move(request));
 }
 
 void Route53Client::CreateTrafficPolicyVersionAsync(const CreateTrafficPolicyVersionRequest& request, const CreateTrafficPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::CreateTrafficPolicyVersionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::CreateTrafficPolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTrafficPolicyVersionOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::CreateTrafficPolicyVersionAsync(CreateTrafficPolicyVersionRequest&& request, const CreateTrafficPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::CreateTrafficPolicyVersionAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTrafficPolicyVersionOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::CreateTrafficPolicyVersionAsyncHelper(const CreateTrafficPolicyVersionRequest& request, const CreateTrafficPolicyVersionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -415,10 +506,10 @@ void Route53Client::CreateTrafficPolicyVersionAsyncHelper(const CreateTrafficPol
 
 DeleteHealthCheckOutcome Route53Client::DeleteHealthCheck(const DeleteHealthCheckRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/healthcheck/";
-  ss << request.GetHealthCheckId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/healthcheck/");
+  uri.Append(request.GetHealthCheckId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteHealthCheckOutcome(DeleteHealthCheckResult(outcome.GetResult()));
@@ -431,12 +522,22 @@ DeleteHealthCheckOutcome Route53Client::DeleteHealthCheck(const DeleteHealthChec
 
 DeleteHealthCheckOutcomeCallable Route53Client::DeleteHealthCheckCallable(const DeleteHealthCheckRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::DeleteHealthCheck, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::DeleteHealthCheck, Aws::Client::RejectedCallOutcome<DeleteHealthCheckOutcome>(), this, request);
+}
+
+DeleteHealthCheckOutcomeCallable Route53Client::DeleteHealthCheckCallable(DeleteHealthCheckRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::DeleteHealthCheck, Aws::Client::RejectedCallOutcome<DeleteHealthCheckOutcome>(), this, std::move(request));
 }
 
 void Route53Client::DeleteHealthCheckAsync(const DeleteHealthCheckRequest& request, const DeleteHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::DeleteHealthCheckAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::DeleteHealthCheckAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteHealthCheckOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::DeleteHealthCheckAsync(DeleteHealthCheckRequest&& request, const DeleteHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::DeleteHealthCheckAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteHealthCheckOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::DeleteHealthCheckAsyncHelper(const DeleteHealthCheckRequest& request, const DeleteHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -446,10 +547,10 @@ void Route53Client::DeleteHealthCheckAsyncHelper(const DeleteHealthCheckRequest&
 
 DeleteHostedZoneOutcome Route53Client::DeleteHostedZone(const DeleteHostedZoneRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/hostedzone/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/hostedzone/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteHostedZoneOutcome(DeleteHostedZoneResult(outcome.GetResult()));
@@ -462,12 +563,22 @@ DeleteHostedZoneOutcome Route53Client::DeleteHostedZone(const DeleteHostedZoneRe
 
 DeleteHostedZoneOutcomeCallable Route53Client::DeleteHostedZoneCallable(const DeleteHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::DeleteHostedZone, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::DeleteHostedZone, Aws::Client::RejectedCallOutcome<DeleteHostedZoneOutcome>(), this, request);
+}
+
+DeleteHostedZoneOutcomeCallable Route53Client::DeleteHostedZoneCallable(DeleteHostedZoneRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::DeleteHostedZone, Aws::Client::RejectedCallOutcome<DeleteHostedZoneOutcome>(), this, std::move(request));
 }
 
 void Route53Client::DeleteHostedZoneAsync(const DeleteHostedZoneRequest& request, const DeleteHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::DeleteHostedZoneAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::DeleteHostedZoneAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteHostedZoneOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::DeleteHostedZoneAsync(DeleteHostedZoneRequest&& request, const DeleteHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::DeleteHostedZoneAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteHostedZoneOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::DeleteHostedZoneAsyncHelper(const DeleteHostedZoneRequest& request, const DeleteHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -477,10 +588,10 @@ void Route53Client::DeleteHostedZoneAsyncHelper(const DeleteHostedZoneRequest& r
 
 DeleteReusableDelegationSetOutcome Route53Client::DeleteReusableDelegationSet(const DeleteReusableDelegationSetRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/delegationset/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/delegationset/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteReusableDelegationSetOutcome(DeleteReusableDelegationSetResult(outcome.GetResult()));
@@ -493,12 +604,22 @@ DeleteReusableDelegationSetOutcome Route53Client::DeleteReusableDelegationSet(co
 
 DeleteReusableDelegationSetOutcomeCallable Route53Client::DeleteReusableDelegationSetCallable(const DeleteReusableDelegationSetRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::DeleteReusableDelegationSet, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::DeleteReusableDelegationSet, Aws::Client::RejectedCallOutcome<DeleteReusableDelegationSetOutcome>(), this, request);
+}
+
+DeleteReusableDelegationSetOutcomeCallable Route53Client::DeleteReusableDelegationSetCallable(DeleteReusableDelegationSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::DeleteReusableDelegationSet, Aws::Client::RejectedCallOutcome<DeleteReusableDelegationSetOutcome>(), this, std::move(request));
 }
 
 void Route53Client::DeleteReusableDelegationSetAsync(const DeleteReusableDelegationSetRequest& request, const DeleteReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::DeleteReusableDelegationSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::DeleteReusableDelegationSetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteReusableDelegationSetOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::DeleteReusableDelegationSetAsync(DeleteReusableDelegationSetRequest&& request, const DeleteReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::DeleteReusableDelegationSetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteReusableDelegationSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::DeleteReusableDelegationSetAsyncHelper(const DeleteReusableDelegationSetRequest& request, const DeleteReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -508,12 +629,12 @@ void Route53Client::DeleteReusableDelegationSetAsyncHelper(const DeleteReusableD
 
 DeleteTrafficPolicyOutcome Route53Client::DeleteTrafficPolicy(const DeleteTrafficPolicyRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicy/";
-  ss << request.GetId();
-  ss << "/";
-  ss << request.GetVersion();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicy/");
+  uri.Append(request.GetId());
+  uri.Append("/");
+  uri.Append(request.GetVersion());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteTrafficPolicyOutcome(DeleteTrafficPolicyResult(outcome.GetResult()));
@@ -526,12 +647,22 @@ DeleteTrafficPolicyOutcome Route53Client::DeleteTrafficPolicy(const DeleteTraffi
 
 DeleteTrafficPolicyOutcomeCallable Route53Client::DeleteTrafficPolicyCallable(const DeleteTrafficPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::DeleteTrafficPolicy, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::DeleteTrafficPolicy, Aws::Client::RejectedCallOutcome<DeleteTrafficPolicyOutcome>(), this, request);
+}
+
+DeleteTrafficPolicyOutcomeCallable Route53Client::DeleteTrafficPolicyCallable(DeleteTrafficPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::DeleteTrafficPolicy, Aws::Client::RejectedCallOutcome<DeleteTrafficPolicyOutcome>(), this, std::move(request));
 }
 
 void Route53Client::DeleteTrafficPolicyAsync(const DeleteTrafficPolicyRequest& request, const DeleteTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::DeleteTrafficPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::DeleteTrafficPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTrafficPolicyOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::DeleteTrafficPolicyAsync(DeleteTrafficPolicyRequest&& request, const DeleteTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::DeleteTrafficPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTrafficPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::DeleteTrafficPolicyAsyncHelper(const DeleteTrafficPolicyRequest& request, const DeleteTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -541,10 +672,10 @@ void Route53Client::DeleteTrafficPolicyAsyncHelper(const DeleteTrafficPolicyRequ
 
 DeleteTrafficPolicyInstanceOutcome Route53Client::DeleteTrafficPolicyInstance(const DeleteTrafficPolicyInstanceRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicyinstance/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicyinstance/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteTrafficPolicyInstanceOutcome(DeleteTrafficPolicyInstanceResult(outcome.GetResult()));
@@ -557,12 +688,22 @@ DeleteTrafficPolicyInstanceOutcome Route53Client::DeleteTrafficPolicyInstance(co
 
 DeleteTrafficPolicyInstanceOutcomeCallable Route53Client::DeleteTrafficPolicyInstanceCallable(const DeleteTrafficPolicyInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::DeleteTrafficPolicyInstance, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::DeleteTrafficPolicyInstance, Aws::Client::RejectedCallOutcome<DeleteTrafficPolicyInstanceOutcome>(), this, request);
+}
+
+DeleteTrafficPolicyInstanceOutcomeCallable Route53Client::DeleteTrafficPolicyInstanceCallable(DeleteTrafficPolicyInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::DeleteTrafficPolicyInstance, Aws::Client::RejectedCallOutcome<DeleteTrafficPolicyInstanceOutcome>(), this, std::move(request));
 }
 
 void Route53Client::DeleteTrafficPolicyInstanceAsync(const DeleteTrafficPolicyInstanceRequest& request, const DeleteTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::DeleteTrafficPolicyInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::DeleteTrafficPolicyInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTrafficPolicyInstanceOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::DeleteTrafficPolicyInstanceAsync(DeleteTrafficPolicyInstanceRequest&& request, const DeleteTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::DeleteTrafficPolicyInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTrafficPolicyInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::DeleteTrafficPolicyInstanceAsyncHelper(const DeleteTrafficPolicyInstanceRequest& request, const DeleteTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -572,11 +713,11 @@ void Route53Client::DeleteTrafficPolicyInstanceAsyncHelper(const DeleteTrafficPo
 
 DisassociateVPCFromHostedZoneOutcome Route53Client::DisassociateVPCFromHostedZone(const DisassociateVPCFromHostedZoneRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/hostedzone/";
-  ss << request.GetHostedZoneId();
-  ss << "/disassociatevpc";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/hostedzone/");
+  uri.Append(request.GetHostedZoneId());
+  uri.Append("/disassociatevpc");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return DisassociateVPCFromHostedZoneOutcome(DisassociateVPCFromHostedZoneResult(outcome.GetResult()));
@@ -589,12 +730,22 @@ DisassociateVPCFromHostedZoneOutcome Route53Client::DisassociateVPCFromHostedZon
 
 DisassociateVPCFromHostedZoneOutcomeCallable Route53Client::DisassociateVPCFromHostedZoneCallable(const DisassociateVPCFromHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::DisassociateVPCFromHostedZone, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::DisassociateVPCFromHostedZone, Aws::Client::RejectedCallOutcome<DisassociateVPCFromHostedZoneOutcome>(), this, request);
+}
+
+DisassociateVPCFromHostedZoneOutcomeCallable Route53Client::DisassociateVPCFromHostedZoneCallable(DisassociateVPCFromHostedZoneRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::DisassociateVPCFromHostedZone, Aws::Client::RejectedCallOutcome<DisassociateVPCFromHostedZoneOutcome>(), this, std::move(request));
 }
 
 void Route53Client::DisassociateVPCFromHostedZoneAsync(const DisassociateVPCFromHostedZoneRequest& request, const DisassociateVPCFromHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::DisassociateVPCFromHostedZoneAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::DisassociateVPCFromHostedZoneAsyncHelper, Aws::Client::RejectedAsyncCall<DisassociateVPCFromHostedZoneOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::DisassociateVPCFromHostedZoneAsync(DisassociateVPCFromHostedZoneRequest&& request, const DisassociateVPCFromHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::DisassociateVPCFromHostedZoneAsyncHelper, Aws::Client::RejectedAsyncCall<DisassociateVPCFromHostedZoneOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::DisassociateVPCFromHostedZoneAsyncHelper(const DisassociateVPCFromHostedZoneRequest& request, const DisassociateVPCFromHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -604,10 +755,10 @@ void Route53Client::DisassociateVPCFromHostedZoneAsyncHelper(const DisassociateV
 
 GetChangeOutcome Route53Client::GetChange(const GetChangeRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/change/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/change/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetChangeOutcome(GetChangeResult(outcome.GetResult()));
@@ -620,12 +771,22 @@ GetChangeOutcome Route53Client::GetChange(const GetChangeRequest& request) const
 
 GetChangeOutcomeCallable Route53Client::GetChangeCallable(const GetChangeRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetChange, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::GetChange, Aws::Client::RejectedCallOutcome<GetChangeOutcome>(), this, request);
+}
+
+GetChangeOutcomeCallable Route53Client::GetChangeCallable(GetChangeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::GetChange, Aws::Client::RejectedCallOutcome<GetChangeOutcome>(), this, std::move(request));
 }
 
 void Route53Client::GetChangeAsync(const GetChangeRequest& request, const GetChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetChangeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::GetChangeAsyncHelper, Aws::Client::RejectedAsyncCall<GetChangeOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::GetChangeAsync(GetChangeRequest&& request, const GetChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::GetChangeAsyncHelper, Aws::Client::RejectedAsyncCall<GetChangeOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::GetChangeAsyncHelper(const GetChangeRequest& request, const GetChangeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -635,9 +796,9 @@ void Route53Client::GetChangeAsyncHelper(const GetChangeRequest& request, const
 
 GetCheckerIpRangesOutcome Route53Client::GetCheckerIpRanges(const GetCheckerIpRangesRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/checkeripranges";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/checkeripranges");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetCheckerIpRangesOutcome(GetCheckerIpRangesResult(outcome.GetResult()));
@@ -650,12 +811,22 @@ GetCheckerIpRangesOutcome Route53Client::GetCheckerIpRanges(const GetCheckerIpRa
 
 GetCheckerIpRangesOutcomeCallable Route53Client::GetCheckerIpRangesCallable(const GetCheckerIpRangesRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetCheckerIpRanges, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::GetCheckerIpRanges, Aws::Client::RejectedCallOutcome<GetCheckerIpRangesOutcome>(), this, request);
+}
+
+GetCheckerIpRangesOutcomeCallable Route53Client::GetCheckerIpRangesCallable(GetCheckerIpRangesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::GetCheckerIpRanges, Aws::Client::RejectedCallOutcome<GetCheckerIpRangesOutcome>(), this, std::move(request));
 }
 
 void Route53Client::GetCheckerIpRangesAsync(const GetCheckerIpRangesRequest& request, const GetCheckerIpRangesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetCheckerIpRangesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::GetCheckerIpRangesAsyncHelper, Aws::Client::RejectedAsyncCall<GetCheckerIpRangesOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::GetCheckerIpRangesAsync(GetCheckerIpRangesRequest&& request, const GetCheckerIpRangesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::GetCheckerIpRangesAsyncHelper, Aws::Client::RejectedAsyncCall<GetCheckerIpRangesOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::GetCheckerIpRangesAsyncHelper(const GetCheckerIpRangesRequest& request, const GetCheckerIpRangesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -665,9 +836,9 @@ void Route53Client::GetCheckerIpRangesAsyncHelper(const GetCheckerIpRangesReques
 
 GetGeoLocationOutcome Route53Client::GetGeoLocation(const GetGeoLocationRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/geolocation";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/geolocation");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetGeoLocationOutcome(GetGeoLocationResult(outcome.GetResult()));
@@ -680,12 +851,22 @@ GetGeoLocationOutcome Route53Client::GetGeoLocation(const GetGeoLocationRequest&
 
 GetGeoLocationOutcomeCallable Route53Client::GetGeoLocationCallable(const GetGeoLocationRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetGeoLocation, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::GetGeoLocation, Aws::Client::RejectedCallOutcome<GetGeoLocationOutcome>(), this, request);
+}
+
+GetGeoLocationOutcomeCallable Route53Client::GetGeoLocationCallable(GetGeoLocationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::GetGeoLocation, Aws::Client::RejectedCallOutcome<GetGeoLocationOutcome>(), this, std::move(request));
 }
 
 void Route53Client::GetGeoLocationAsync(const GetGeoLocationRequest& request, const GetGeoLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetGeoLocationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::GetGeoLocationAsyncHelper, Aws::Client::RejectedAsyncCall<GetGeoLocationOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::GetGeoLocationAsync(GetGeoLocationRequest&& request, const GetGeoLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::GetGeoLocationAsyncHelper, Aws::Client::RejectedAsyncCall<GetGeoLocationOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::GetGeoLocationAsyncHelper(const GetGeoLocationRequest& request, const GetGeoLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -695,10 +876,10 @@ void Route53Client::GetGeoLocationAsyncHelper(const GetGeoLocationRequest& reque
 
 GetHealthCheckOutcome Route53Client::GetHealthCheck(const GetHealthCheckRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/healthcheck/";
-  ss << request.GetHealthCheckId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/healthcheck/");
+  uri.Append(request.GetHealthCheckId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetHealthCheckOutcome(GetHealthCheckResult(outcome.GetResult()));
@@ -711,12 +892,22 @@ GetHealthCheckOutcome Route53Client::GetHealthCheck(const GetHealthCheckRequest&
 
 GetHealthCheckOutcomeCallable Route53Client::GetHealthCheckCallable(const GetHealthCheckRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetHealthCheck, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::GetHealthCheck, Aws::Client::RejectedCallOutcome<GetHealthCheckOutcome>(), this, request);
+}
+
+GetHealthCheckOutcomeCallable Route53Client::GetHealthCheckCallable(GetHealthCheckRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::GetHealthCheck, Aws::Client::RejectedCallOutcome<GetHealthCheckOutcome>(), this, std::move(request));
 }
 
 void Route53Client::GetHealthCheckAsync(const GetHealthCheckRequest& request, const GetHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetHealthCheckAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::GetHealthCheckAsyncHelper, Aws::Client::RejectedAsyncCall<GetHealthCheckOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::GetHealthCheckAsync(GetHealthCheckRequest&& request, const GetHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::GetHealthCheckAsyncHelper, Aws::Client::RejectedAsyncCall<GetHealthCheckOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::GetHealthCheckAsyncHelper(const GetHealthCheckRequest& request, const GetHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -726,9 +917,9 @@ void Route53Client::GetHealthCheckAsyncHelper(const GetHealthCheckRequest& reque
 
 GetHealthCheckCountOutcome Route53Client::GetHealthCheckCount(const GetHealthCheckCountRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/healthcheckcount";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/healthcheckcount");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetHealthCheckCountOutcome(GetHealthCheckCountResult(outcome.GetResult()));
@@ -741,12 +932,22 @@ GetHealthCheckCountOutcome Route53Client::GetHealthCheckCount(const GetHealthChe
 
 GetHealthCheckCountOutcomeCallable Route53Client::GetHealthCheckCountCallable(const GetHealthCheckCountRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetHealthCheckCount, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::GetHealthCheckCount, Aws::Client::RejectedCallOutcome<GetHealthCheckCountOutcome>(), this, request);
+}
+
+GetHealthCheckCountOutcomeCallable Route53Client::GetHealthCheckCountCallable(GetHealthCheckCountRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::GetHealthCheckCount, Aws::Client::RejectedCallOutcome<GetHealthCheckCountOutcome>(), this, std::move(request));
 }
 
 void Route53Client::GetHealthCheckCountAsync(const GetHealthCheckCountRequest& request, const GetHealthCheckCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetHealthCheckCountAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::GetHealthCheckCountAsyncHelper, Aws::Client::RejectedAsyncCall<GetHealthCheckCountOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::GetHealthCheckCountAsync(GetHealthCheckCountRequest&& request, const GetHealthCheckCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::GetHealthCheckCountAsyncHelper, Aws::Client::RejectedAsyncCall<GetHealthCheckCountOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::GetHealthCheckCountAsyncHelper(const GetHealthCheckCountRequest& request, const GetHealthCheckCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -756,11 +957,11 @@ void Route53Client::GetHealthCheckCountAsyncHelper(const GetHealthCheckCountRequ
 
 GetHealthCheckLastFailureReasonOutcome Route53Client::GetHealthCheckLastFailureReason(const GetHealthCheckLastFailureReasonRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/healthcheck/";
-  ss << request.GetHealthCheckId();
-  ss << "/lastfailurereason";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/healthcheck/");
+  uri.Append(request.GetHealthCheckId());
+  uri.Append("/lastfailurereason");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetHealthCheckLastFailureReasonOutcome(GetHealthCheckLastFailureReasonResult(outcome.GetResult()));
@@ -773,12 +974,22 @@ GetHealthCheckLastFailureReasonOutcome Route53Client::GetHealthCheckLastFailureR
 
 GetHealthCheckLastFailureReasonOutcomeCallable Route53Client::GetHealthCheckLastFailureReasonCallable(const GetHealthCheckLastFailureReasonRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetHealthCheckLastFailureReason, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::GetHealthCheckLastFailureReason, Aws::Client::RejectedCallOutcome<GetHealthCheckLastFailureReasonOutcome>(), this, request);
+}
+
+GetHealthCheckLastFailureReasonOutcomeCallable Route53Client::GetHealthCheckLastFailureReasonCallable(GetHealthCheckLastFailureReasonRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::GetHealthCheckLastFailureReason, Aws::Client::RejectedCallOutcome<GetHealthCheckLastFailureReasonOutcome>(), this, std::move(request));
 }
 
 void Route53Client::GetHealthCheckLastFailureReasonAsync(const GetHealthCheckLastFailureReasonRequest& request, const GetHealthCheckLastFailureReasonResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetHealthCheckLastFailureReasonAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::GetHealthCheckLastFailureReasonAsyncHelper, Aws::Client::RejectedAsyncCall<GetHealthCheckLastFailureReasonOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::GetHealthCheckLastFailureReasonAsync(GetHealthCheckLastFailureReasonRequest&& request, const GetHealthCheckLastFailureReasonResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::GetHealthCheckLastFailureReasonAsyncHelper, Aws::Client::RejectedAsyncCall<GetHealthCheckLastFailureReasonOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::GetHealthCheckLastFailureReasonAsyncHelper(const GetHealthCheckLastFailureReasonRequest& request, const GetHealthCheckLastFailureReasonResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -788,11 +999,11 @@ void Route53Client::GetHealthCheckLastFailureReasonAsyncHelper(const GetHealthCh
 
 GetHealthCheckStatusOutcome Route53Client::GetHealthCheckStatus(const GetHealthCheckStatusRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/healthcheck/";
-  ss << request.GetHealthCheckId();
-  ss << "/status";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/healthcheck/");
+  uri.Append(request.GetHealthCheckId());
+  uri.Append("/status");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetHealthCheckStatusOutcome(GetHealthCheckStatusResult(outcome.GetResult()));
@@ -805,12 +1016,22 @@ GetHealthCheckStatusOutcome Route53Client::GetHealthCheckStatus(const GetHealthC
 
 GetHealthCheckStatusOutcomeCallable Route53Client::GetHealthCheckStatusCallable(const GetHealthCheckStatusRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetHealthCheckStatus, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::GetHealthCheckStatus, Aws::Client::RejectedCallOutcome<GetHealthCheckStatusOutcome>(), this, request);
+}
+
+GetHealthCheckStatusOutcomeCallable Route53Client::GetHealthCheckStatusCallable(GetHealthCheckStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::GetHealthCheckStatus, Aws::Client::RejectedCallOutcome<GetHealthCheckStatusOutcome>(), this, std::move(request));
 }
 
 void Route53Client::GetHealthCheckStatusAsync(const GetHealthCheckStatusRequest& request, const GetHealthCheckStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetHealthCheckStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::GetHealthCheckStatusAsyncHelper, Aws::Client::RejectedAsyncCall<GetHealthCheckStatusOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::GetHealthCheckStatusAsync(GetHealthCheckStatusRequest&& request, const GetHealthCheckStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::GetHealthCheckStatusAsyncHelper, Aws::Client::RejectedAsyncCall<GetHealthCheckStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::GetHealthCheckStatusAsyncHelper(const GetHealthCheckStatusRequest& request, const GetHealthCheckStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -820,10 +1041,10 @@ void Route53Client::GetHealthCheckStatusAsyncHelper(const GetHealthCheckStatusRe
 
 GetHostedZoneOutcome Route53Client::GetHostedZone(const GetHostedZoneRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/hostedzone/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/hostedzone/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetHostedZoneOutcome(GetHostedZoneResult(outcome.GetResult()));
@@ -836,12 +1057,22 @@ GetHostedZoneOutcome Route53Client::GetHostedZone(const GetHostedZoneRequest& re
 
 GetHostedZoneOutcomeCallable Route53Client::GetHostedZoneCallable(const GetHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetHostedZone, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::GetHostedZone, Aws::Client::RejectedCallOutcome<GetHostedZoneOutcome>(), this, request);
+}
+
+GetHostedZoneOutcomeCallable Route53Client::GetHostedZoneCallable(GetHostedZoneRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::GetHostedZone, Aws::Client::RejectedCallOutcome<GetHostedZoneOutcome>(), this, std::move(request));
 }
 
 void Route53Client::GetHostedZoneAsync(const GetHostedZoneRequest& request, const GetHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetHostedZoneAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::GetHostedZoneAsyncHelper, Aws::Client::RejectedAsyncCall<GetHostedZoneOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::GetHostedZoneAsync(GetHostedZoneRequest&& request, const GetHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::GetHostedZoneAsyncHelper, Aws::Client::RejectedAsyncCall<GetHostedZoneOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::GetHostedZoneAsyncHelper(const GetHostedZoneRequest& request, const GetHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -851,9 +1082,9 @@ void Route53Client::GetHostedZoneAsyncHelper(const GetHostedZoneRequest& request
 
 GetHostedZoneCountOutcome Route53Client::GetHostedZoneCount(const GetHostedZoneCountRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/hostedzonecount";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/hostedzonecount");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetHostedZoneCountOutcome(GetHostedZoneCountResult(outcome.GetResult()));
@@ -866,12 +1097,22 @@ GetHostedZoneCountOutcome Route53Client::GetHostedZoneCount(const GetHostedZoneC
 
 GetHostedZoneCountOutcomeCallable Route53Client::GetHostedZoneCountCallable(const GetHostedZoneCountRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetHostedZoneCount, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::GetHostedZoneCount, Aws::Client::RejectedCallOutcome<GetHostedZoneCountOutcome>(), this, request);
+}
+
+GetHostedZoneCountOutcomeCallable Route53Client::GetHostedZoneCountCallable(GetHostedZoneCountRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::GetHostedZoneCount, Aws::Client::RejectedCallOutcome<GetHostedZoneCountOutcome>(), this, std::move(request));
 }
 
 void Route53Client::GetHostedZoneCountAsync(const GetHostedZoneCountRequest& request, const GetHostedZoneCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetHostedZoneCountAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::GetHostedZoneCountAsyncHelper, Aws::Client::RejectedAsyncCall<GetHostedZoneCountOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::GetHostedZoneCountAsync(GetHostedZoneCountRequest&& request, const GetHostedZoneCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::GetHostedZoneCountAsyncHelper, Aws::Client::RejectedAsyncCall<GetHostedZoneCountOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::GetHostedZoneCountAsyncHelper(const GetHostedZoneCountRequest& request, const GetHostedZoneCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -881,10 +1122,10 @@ void Route53Client::GetHostedZoneCountAsyncHelper(const GetHostedZoneCountReques
 
 GetReusableDelegationSetOutcome Route53Client::GetReusableDelegationSet(const GetReusableDelegationSetRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/delegationset/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/delegationset/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetReusableDelegationSetOutcome(GetReusableDelegationSetResult(outcome.GetResult()));
@@ -897,12 +1138,22 @@ GetReusableDelegationSetOutcome Route53Client::GetReusableDelegationSet(const Ge
 
 GetReusableDelegationSetOutcomeCallable Route53Client::GetReusableDelegationSetCallable(const GetReusableDelegationSetRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetReusableDelegationSet, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::GetReusableDelegationSet, Aws::Client::RejectedCallOutcome<GetReusableDelegationSetOutcome>(), this, request);
+}
+
+GetReusableDelegationSetOutcomeCallable Route53Client::GetReusableDelegationSetCallable(GetReusableDelegationSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::GetReusableDelegationSet, Aws::Client::RejectedCallOutcome<GetReusableDelegationSetOutcome>(), this, std::move(request));
 }
 
 void Route53Client::GetReusableDelegationSetAsync(const GetReusableDelegationSetRequest& request, const GetReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetReusableDelegationSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::GetReusableDelegationSetAsyncHelper, Aws::Client::RejectedAsyncCall<GetReusableDelegationSetOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::GetReusableDelegationSetAsync(GetReusableDelegationSetRequest&& request, const GetReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::GetReusableDelegationSetAsyncHelper, Aws::Client::RejectedAsyncCall<GetReusableDelegationSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::GetReusableDelegationSetAsyncHelper(const GetReusableDelegationSetRequest& request, const GetReusableDelegationSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -912,12 +1163,12 @@ void Route53Client::GetReusableDelegationSetAsyncHelper(const GetReusableDelegat
 
 GetTrafficPolicyOutcome Route53Client::GetTrafficPolicy(const GetTrafficPolicyRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicy/";
-  ss << request.GetId();
-  ss << "/";
-  ss << request.GetVersion();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicy/");
+  uri.Append(request.GetId());
+  uri.Append("/");
+  uri.Append(request.GetVersion());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetTrafficPolicyOutcome(GetTrafficPolicyResult(outcome.GetResult()));
@@ -930,12 +1181,22 @@ GetTrafficPolicyOutcome Route53Client::GetTrafficPolicy(const GetTrafficPolicyRe
 
 GetTrafficPolicyOutcomeCallable Route53Client::GetTrafficPolicyCallable(const GetTrafficPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetTrafficPolicy, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::GetTrafficPolicy, Aws::Client::RejectedCallOutcome<GetTrafficPolicyOutcome>(), this, request);
+}
+
+GetTrafficPolicyOutcomeCallable Route53Client::GetTrafficPolicyCallable(GetTrafficPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::GetTrafficPolicy, Aws::Client::RejectedCallOutcome<GetTrafficPolicyOutcome>(), this, std::move(request));
 }
 
 void Route53Client::GetTrafficPolicyAsync(const GetTrafficPolicyRequest& request, const GetTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetTrafficPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::GetTrafficPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetTrafficPolicyOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::GetTrafficPolicyAsync(GetTrafficPolicyRequest&& request, const GetTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::GetTrafficPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetTrafficPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::GetTrafficPolicyAsyncHelper(const GetTrafficPolicyRequest& request, const GetTrafficPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -945,10 +1206,10 @@ void Route53Client::GetTrafficPolicyAsyncHelper(const GetTrafficPolicyRequest& r
 
 GetTrafficPolicyInstanceOutcome Route53Client::GetTrafficPolicyInstance(const GetTrafficPolicyInstanceRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicyinstance/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicyinstance/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetTrafficPolicyInstanceOutcome(GetTrafficPolicyInstanceResult(outcome.GetResult()));
@@ -961,12 +1222,22 @@ GetTrafficPolicyInstanceOutcome Route53Client::GetTrafficPolicyInstance(const Ge
 
 GetTrafficPolicyInstanceOutcomeCallable Route53Client::GetTrafficPolicyInstanceCallable(const GetTrafficPolicyInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetTrafficPolicyInstance, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::GetTrafficPolicyInstance, Aws::Client::RejectedCallOutcome<GetTrafficPolicyInstanceOutcome>(), this, request);
+}
+
+GetTrafficPolicyInstanceOutcomeCallable Route53Client::GetTrafficPolicyInstanceCallable(GetTrafficPolicyInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::GetTrafficPolicyInstance, Aws::Client::RejectedCallOutcome<GetTrafficPolicyInstanceOutcome>(), this, std::move(request));
 }
 
 void Route53Client::GetTrafficPolicyInstanceAsync(const GetTrafficPolicyInstanceRequest& request, const GetTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetTrafficPolicyInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::GetTrafficPolicyInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<GetTrafficPolicyInstanceOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::GetTrafficPolicyInstanceAsync(GetTrafficPolicyInstanceRequest&& request, const GetTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::GetTrafficPolicyInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<GetTrafficPolicyInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::GetTrafficPolicyInstanceAsyncHelper(const GetTrafficPolicyInstanceRequest& request, const GetTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -976,9 +1247,9 @@ void Route53Client::GetTrafficPolicyInstanceAsyncHelper(const GetTrafficPolicyIn
 
 GetTrafficPolicyInstanceCountOutcome Route53Client::GetTrafficPolicyInstanceCount(const GetTrafficPolicyInstanceCountRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicyinstancecount";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicyinstancecount");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetTrafficPolicyInstanceCountOutcome(GetTrafficPolicyInstanceCountResult(outcome.GetResult()));
@@ -991,12 +1262,22 @@ GetTrafficPolicyInstanceCountOutcome Route53Client::GetTrafficPolicyInstanceCoun
 
 GetTrafficPolicyInstanceCountOutcomeCallable Route53Client::GetTrafficPolicyInstanceCountCallable(const GetTrafficPolicyInstanceCountRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::GetTrafficPolicyInstanceCount, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::GetTrafficPolicyInstanceCount, Aws::Client::RejectedCallOutcome<GetTrafficPolicyInstanceCountOutcome>(), this, request);
+}
+
+GetTrafficPolicyInstanceCountOutcomeCallable Route53Client::GetTrafficPolicyInstanceCountCallable(GetTrafficPolicyInstanceCountRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::GetTrafficPolicyInstanceCount, Aws::Client::RejectedCallOutcome<GetTrafficPolicyInstanceCountOutcome>(), this, std::move(request));
 }
 
 void Route53Client::GetTrafficPolicyInstanceCountAsync(const GetTrafficPolicyInstanceCountRequest& request, const GetTrafficPolicyInstanceCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::GetTrafficPolicyInstanceCountAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::GetTrafficPolicyInstanceCountAsyncHelper, Aws::Client::RejectedAsyncCall<GetTrafficPolicyInstanceCountOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::GetTrafficPolicyInstanceCountAsync(GetTrafficPolicyInstanceCountRequest&& request, const GetTrafficPolicyInstanceCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::GetTrafficPolicyInstanceCountAsyncHelper, Aws::Client::RejectedAsyncCall<GetTrafficPolicyInstanceCountOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::GetTrafficPolicyInstanceCountAsyncHelper(const GetTrafficPolicyInstanceCountRequest& request, const GetTrafficPolicyInstanceCountResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1006,9 +1287,9 @@ void Route53Client::GetTrafficPolicyInstanceCountAsyncHelper(const GetTrafficPol
 
 ListGeoLocationsOutcome Route53Client::ListGeoLocations(const ListGeoLocationsRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/geolocations";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/geolocations");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListGeoLocationsOutcome(ListGeoLocationsResult(outcome.GetResult()));
@@ -1021,12 +1302,22 @@ ListGeoLocationsOutcome Route53Client::ListGeoLocations(const ListGeoLocationsRe
 
 ListGeoLocationsOutcomeCallable Route53Client::ListGeoLocationsCallable(const ListGeoLocationsRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListGeoLocations, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ListGeoLocations, Aws::Client::RejectedCallOutcome<ListGeoLocationsOutcome>(), this, request);
+}
+
+ListGeoLocationsOutcomeCallable Route53Client::ListGeoLocationsCallable(ListGeoLocationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ListGeoLocations, Aws::Client::RejectedCallOutcome<ListGeoLocationsOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ListGeoLocationsAsync(const ListGeoLocationsRequest& request, const ListGeoLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListGeoLocationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ListGeoLocationsAsyncHelper, Aws::Client::RejectedAsyncCall<ListGeoLocationsOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ListGeoLocationsAsync(ListGeoLocationsRequest&& request, const ListGeoLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ListGeoLocationsAsyncHelper, Aws::Client::RejectedAsyncCall<ListGeoLocationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ListGeoLocationsAsyncHelper(const ListGeoLocationsRequest& request, const ListGeoLocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1036,9 +1327,9 @@ void Route53Client::ListGeoLocationsAsyncHelper(const ListGeoLocationsRequest& r
 
 ListHealthChecksOutcome Route53Client::ListHealthChecks(const ListHealthChecksRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/healthcheck";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/healthcheck");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListHealthChecksOutcome(ListHealthChecksResult(outcome.GetResult()));
@@ -1051,12 +1342,22 @@ ListHealthChecksOutcome Route53Client::ListHealthChecks(const ListHealthChecksRe
 
 ListHealthChecksOutcomeCallable Route53Client::ListHealthChecksCallable(const ListHealthChecksRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListHealthChecks, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ListHealthChecks, Aws::Client::RejectedCallOutcome<ListHealthChecksOutcome>(), this, request);
+}
+
+ListHealthChecksOutcomeCallable Route53Client::ListHealthChecksCallable(ListHealthChecksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ListHealthChecks, Aws::Client::RejectedCallOutcome<ListHealthChecksOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ListHealthChecksAsync(const ListHealthChecksRequest& request, const ListHealthChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListHealthChecksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ListHealthChecksAsyncHelper, Aws::Client::RejectedAsyncCall<ListHealthChecksOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ListHealthChecksAsync(ListHealthChecksRequest&& request, const ListHealthChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ListHealthChecksAsyncHelper, Aws::Client::RejectedAsyncCall<ListHealthChecksOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ListHealthChecksAsyncHelper(const ListHealthChecksRequest& request, const ListHealthChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1066,9 +1367,9 @@ void Route53Client::ListHealthChecksAsyncHelper(const ListHealthChecksRequest& r
 
 ListHostedZonesOutcome Route53Client::ListHostedZones(const ListHostedZonesRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/hostedzone";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/hostedzone");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListHostedZonesOutcome(ListHostedZonesResult(outcome.GetResult()));
@@ -1081,12 +1382,22 @@ ListHostedZonesOutcome Route53Client::ListHostedZones(const ListHostedZonesReque
 
 ListHostedZonesOutcomeCallable Route53Client::ListHostedZonesCallable(const ListHostedZonesRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListHostedZones, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ListHostedZones, Aws::Client::RejectedCallOutcome<ListHostedZonesOutcome>(), this, request);
+}
+
+ListHostedZonesOutcomeCallable Route53Client::ListHostedZonesCallable(ListHostedZonesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ListHostedZones, Aws::Client::RejectedCallOutcome<ListHostedZonesOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ListHostedZonesAsync(const ListHostedZonesRequest& request, const ListHostedZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListHostedZonesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ListHostedZonesAsyncHelper, Aws::Client::RejectedAsyncCall<ListHostedZonesOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ListHostedZonesAsync(ListHostedZonesRequest&& request, const ListHostedZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ListHostedZonesAsyncHelper, Aws::Client::RejectedAsyncCall<ListHostedZonesOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ListHostedZonesAsyncHelper(const ListHostedZonesRequest& request, const ListHostedZonesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1096,9 +1407,9 @@ void Route53Client::ListHostedZonesAsyncHelper(const ListHostedZonesRequest& req
 
 ListHostedZonesByNameOutcome Route53Client::ListHostedZonesByName(const ListHostedZonesByNameRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/hostedzonesbyname";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/hostedzonesbyname");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListHostedZonesByNameOutcome(ListHostedZonesByNameResult(outcome.GetResult()));
@@ -1111,12 +1422,22 @@ ListHostedZonesByNameOutcome Route53Client::ListHostedZonesByName(const ListHost
 
 ListHostedZonesByNameOutcomeCallable Route53Client::ListHostedZonesByNameCallable(const ListHostedZonesByNameRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListHostedZonesByName, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ListHostedZonesByName, Aws::Client::RejectedCallOutcome<ListHostedZonesByNameOutcome>(), this, request);
+}
+
+ListHostedZonesByNameOutcomeCallable Route53Client::ListHostedZonesByNameCallable(ListHostedZonesByNameRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ListHostedZonesByName, Aws::Client::RejectedCallOutcome<ListHostedZonesByNameOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ListHostedZonesByNameAsync(const ListHostedZonesByNameRequest& request, const ListHostedZonesByNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListHostedZonesByNameAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ListHostedZonesByNameAsyncHelper, Aws::Client::RejectedAsyncCall<ListHostedZonesByNameOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ListHostedZonesByNameAsync(ListHostedZonesByNameRequest&& request, const ListHostedZonesByNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ListHostedZonesByNameAsyncHelper, Aws::Client::RejectedAsyncCall<ListHostedZonesByNameOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ListHostedZonesByNameAsyncHelper(const ListHostedZonesByNameRequest& request, const ListHostedZonesByNameResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1126,11 +1447,11 @@ void Route53Client::ListHostedZonesByNameAsyncHelper(const ListHostedZonesByName
 
 ListResourceRecordSetsOutcome Route53Client::ListResourceRecordSets(const ListResourceRecordSetsRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/hostedzone/";
-  ss << request.GetHostedZoneId();
-  ss << "/rrset";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/hostedzone/");
+  uri.Append(request.GetHostedZoneId());
+  uri.Append("/rrset");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListResourceRecordSetsOutcome(ListResourceRecordSetsResult(outcome.GetResult()));
@@ -1143,12 +1464,22 @@ ListResourceRecordSetsOutcome Route53Client::ListResourceRecordSets(const ListRe
 
 ListResourceRecordSetsOutcomeCallable Route53Client::ListResourceRecordSetsCallable(const ListResourceRecordSetsRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListResourceRecordSets, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ListResourceRecordSets, Aws::Client::RejectedCallOutcome<ListResourceRecordSetsOutcome>(), this, request);
+}
+
+ListResourceRecordSetsOutcomeCallable Route53Client::ListResourceRecordSetsCallable(ListResourceRecordSetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ListResourceRecordSets, Aws::Client::RejectedCallOutcome<ListResourceRecordSetsOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ListResourceRecordSetsAsync(const ListResourceRecordSetsRequest& request, const ListResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListResourceRecordSetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ListResourceRecordSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListResourceRecordSetsOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ListResourceRecordSetsAsync(ListResourceRecordSetsRequest&& request, const ListResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ListResourceRecordSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListResourceRecordSetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ListResourceRecordSetsAsyncHelper(const ListResourceRecordSetsRequest& request, const ListResourceRecordSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1158,9 +1489,9 @@ void Route53Client::ListResourceRecordSetsAsyncHelper(const ListResourceRecordSe
 
 ListReusableDelegationSetsOutcome Route53Client::ListReusableDelegationSets(const ListReusableDelegationSetsRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/delegationset";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/delegationset");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListReusableDelegationSetsOutcome(ListReusableDelegationSetsResult(outcome.GetResult()));
@@ -1173,12 +1504,22 @@ ListReusableDelegationSetsOutcome Route53Client::ListReusableDelegationSets(cons
 
 ListReusableDelegationSetsOutcomeCallable Route53Client::ListReusableDelegationSetsCallable(const ListReusableDelegationSetsRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListReusableDelegationSets, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ListReusableDelegationSets, Aws::Client::RejectedCallOutcome<ListReusableDelegationSetsOutcome>(), this, request);
+}
+
+ListReusableDelegationSetsOutcomeCallable Route53Client::ListReusableDelegationSetsCallable(ListReusableDelegationSetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ListReusableDelegationSets, Aws::Client::RejectedCallOutcome<ListReusableDelegationSetsOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ListReusableDelegationSetsAsync(const ListReusableDelegationSetsRequest& request, const ListReusableDelegationSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListReusableDelegationSetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ListReusableDelegationSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListReusableDelegationSetsOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ListReusableDelegationSetsAsync(ListReusableDelegationSetsRequest&& request, const ListReusableDelegationSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ListReusableDelegationSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListReusableDelegationSetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ListReusableDelegationSetsAsyncHelper(const ListReusableDelegationSetsRequest& request, const ListReusableDelegationSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1188,12 +1529,12 @@ void Route53Client::ListReusableDelegationSetsAsyncHelper(const ListReusableDele
 
 ListTagsForResourceOutcome Route53Client::ListTagsForResource(const ListTagsForResourceRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/tags/";
-  ss << TagResourceTypeMapper::GetNameForTagResourceType(request.GetResourceType());
-  ss << "/";
-  ss << request.GetResourceId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/tags/");
+  uri.Append(TagResourceTypeMapper::GetNameForTagResourceType(request.GetResourceType()));
+  uri.Append("/");
+  uri.Append(request.GetResourceId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListTagsForResourceOutcome(ListTagsForResourceResult(outcome.GetResult()));
@@ -1206,12 +1547,22 @@ ListTagsForResourceOutcome Route53Client::ListTagsForResource(const ListTagsForR
 
 ListTagsForResourceOutcomeCallable Route53Client::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListTagsForResource, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ListTagsForResource, Aws::Client::RejectedCallOutcome<ListTagsForResourceOutcome>(), this, request);
+}
+
+ListTagsForResourceOutcomeCallable Route53Client::ListTagsForResourceCallable(ListTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ListTagsForResource, Aws::Client::RejectedCallOutcome<ListTagsForResourceOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListTagsForResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ListTagsForResourceAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForResourceOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ListTagsForResourceAsync(ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ListTagsForResourceAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1221,10 +1572,10 @@ void Route53Client::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequ
 
 ListTagsForResourcesOutcome Route53Client::ListTagsForResources(const ListTagsForResourcesRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/tags/";
-  ss << TagResourceTypeMapper::GetNameForTagResourceType(request.GetResourceType());
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/tags/");
+  uri.Append(TagResourceTypeMapper::GetNameForTagResourceType(request.GetResourceType()));
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return ListTagsForResourcesOutcome(ListTagsForResourcesResult(outcome.GetResult()));
@@ -1237,12 +1588,22 @@ ListTagsForResourcesOutcome Route53Client::ListTagsForResources(const ListTagsFo
 
 ListTagsForResourcesOutcomeCallable Route53Client::ListTagsForResourcesCallable(const ListTagsForResourcesRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListTagsForResources, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ListTagsForResources, Aws::Client::RejectedCallOutcome<ListTagsForResourcesOutcome>(), this, request);
+}
+
+ListTagsForResourcesOutcomeCallable Route53Client::ListTagsForResourcesCallable(ListTagsForResourcesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ListTagsForResources, Aws::Client::RejectedCallOutcome<ListTagsForResourcesOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ListTagsForResourcesAsync(const ListTagsForResourcesRequest& request, const ListTagsForResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListTagsForResourcesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ListTagsForResourcesAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForResourcesOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ListTagsForResourcesAsync(ListTagsForResourcesRequest&& request, const ListTagsForResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ListTagsForResourcesAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForResourcesOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ListTagsForResourcesAsyncHelper(const ListTagsForResourcesRequest& request, const ListTagsForResourcesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1252,9 +1613,9 @@ void Route53Client::ListTagsForResourcesAsyncHelper(const ListTagsForResourcesRe
 
 ListTrafficPoliciesOutcome Route53Client::ListTrafficPolicies(const ListTrafficPoliciesRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicies";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicies");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListTrafficPoliciesOutcome(ListTrafficPoliciesResult(outcome.GetResult()));
@@ -1267,12 +1628,22 @@ ListTrafficPoliciesOutcome Route53Client::ListTrafficPolicies(const ListTrafficP
 
 ListTrafficPoliciesOutcomeCallable Route53Client::ListTrafficPoliciesCallable(const ListTrafficPoliciesRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListTrafficPolicies, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ListTrafficPolicies, Aws::Client::RejectedCallOutcome<ListTrafficPoliciesOutcome>(), this, request);
+}
+
+ListTrafficPoliciesOutcomeCallable Route53Client::ListTrafficPoliciesCallable(ListTrafficPoliciesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ListTrafficPolicies, Aws::Client::RejectedCallOutcome<ListTrafficPoliciesOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ListTrafficPoliciesAsync(const ListTrafficPoliciesRequest& request, const ListTrafficPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListTrafficPoliciesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ListTrafficPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListTrafficPoliciesOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ListTrafficPoliciesAsync(ListTrafficPoliciesRequest&& request, const ListTrafficPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ListTrafficPoliciesAsyncHelper, Aws::Client::RejectedAsyncCall<ListTrafficPoliciesOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ListTrafficPoliciesAsyncHelper(const ListTrafficPoliciesRequest& request, const ListTrafficPoliciesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1282,9 +1653,9 @@ void Route53Client::ListTrafficPoliciesAsyncHelper(const ListTrafficPoliciesRequ
 
 ListTrafficPolicyInstancesOutcome Route53Client::ListTrafficPolicyInstances(const ListTrafficPolicyInstancesRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicyinstances";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicyinstances");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListTrafficPolicyInstancesOutcome(ListTrafficPolicyInstancesResult(outcome.GetResult()));
@@ -1297,12 +1668,22 @@ ListTrafficPolicyInstancesOutcome Route53Client::ListTrafficPolicyInstances(cons
 
 ListTrafficPolicyInstancesOutcomeCallable Route53Client::ListTrafficPolicyInstancesCallable(const ListTrafficPolicyInstancesRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListTrafficPolicyInstances, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ListTrafficPolicyInstances, Aws::Client::RejectedCallOutcome<ListTrafficPolicyInstancesOutcome>(), this, request);
+}
+
+ListTrafficPolicyInstancesOutcomeCallable Route53Client::ListTrafficPolicyInstancesCallable(ListTrafficPolicyInstancesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ListTrafficPolicyInstances, Aws::Client::RejectedCallOutcome<ListTrafficPolicyInstancesOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ListTrafficPolicyInstancesAsync(const ListTrafficPolicyInstancesRequest& request, const ListTrafficPolicyInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListTrafficPolicyInstancesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ListTrafficPolicyInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<ListTrafficPolicyInstancesOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ListTrafficPolicyInstancesAsync(ListTrafficPolicyInstancesRequest&& request, const ListTrafficPolicyInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ListTrafficPolicyInstancesAsyncHelper, Aws::Client::RejectedAsyncCall<ListTrafficPolicyInstancesOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ListTrafficPolicyInstancesAsyncHelper(const ListTrafficPolicyInstancesRequest& request, const ListTrafficPolicyInstancesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1312,9 +1693,9 @@ void Route53Client::ListTrafficPolicyInstancesAsyncHelper(const ListTrafficPolic
 
 ListTrafficPolicyInstancesByHostedZoneOutcome Route53Client::ListTrafficPolicyInstancesByHostedZone(const ListTrafficPolicyInstancesByHostedZoneRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicyinstances/hostedzone";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicyinstances/hostedzone");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListTrafficPolicyInstancesByHostedZoneOutcome(ListTrafficPolicyInstancesByHostedZoneResult(outcome.GetResult()));
@@ -1327,12 +1708,22 @@ ListTrafficPolicyInstancesByHostedZoneOutcome Route53Client::ListTrafficPolicyIn
 
 ListTrafficPolicyInstancesByHostedZoneOutcomeCallable Route53Client::ListTrafficPolicyInstancesByHostedZoneCallable(const ListTrafficPolicyInstancesByHostedZoneRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListTrafficPolicyInstancesByHostedZone, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ListTrafficPolicyInstancesByHostedZone, Aws::Client::RejectedCallOutcome<ListTrafficPolicyInstancesByHostedZoneOutcome>(), this, request);
+}
+
+ListTrafficPolicyInstancesByHostedZoneOutcomeCallable Route53Client::ListTrafficPolicyInstancesByHostedZoneCallable(ListTrafficPolicyInstancesByHostedZoneRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ListTrafficPolicyInstancesByHostedZone, Aws::Client::RejectedCallOutcome<ListTrafficPolicyInstancesByHostedZoneOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ListTrafficPolicyInstancesByHostedZoneAsync(const ListTrafficPolicyInstancesByHostedZoneRequest& request, const ListTrafficPolicyInstancesByHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListTrafficPolicyInstancesByHostedZoneAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ListTrafficPolicyInstancesByHostedZoneAsyncHelper, Aws::Client::RejectedAsyncCall<ListTrafficPolicyInstancesByHostedZoneOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ListTrafficPolicyInstancesByHostedZoneAsync(ListTrafficPolicyInstancesByHostedZoneRequest&& request, const ListTrafficPolicyInstancesByHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ListTrafficPolicyInstancesByHostedZoneAsyncHelper, Aws::Client::RejectedAsyncCall<ListTrafficPolicyInstancesByHostedZoneOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ListTrafficPolicyInstancesByHostedZoneAsyncHelper(const ListTrafficPolicyInstancesByHostedZoneRequest& request, const ListTrafficPolicyInstancesByHostedZoneResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1342,9 +1733,9 @@ void Route53Client::ListTrafficPolicyInstancesByHostedZoneAsyncHelper(const List
 
 ListTrafficPolicyInstancesByPolicyOutcome Route53Client::ListTrafficPolicyInstancesByPolicy(const ListTrafficPolicyInstancesByPolicyRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicyinstances/trafficpolicy";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicyinstances/trafficpolicy");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListTrafficPolicyInstancesByPolicyOutcome(ListTrafficPolicyInstancesByPolicyResult(outcome.GetResult()));
@@ -1357,12 +1748,22 @@ ListTrafficPolicyInstancesByPolicyOutcome Route53Client::ListTrafficPolicyInstan
 
 ListTrafficPolicyInstancesByPolicyOutcomeCallable Route53Client::ListTrafficPolicyInstancesByPolicyCallable(const ListTrafficPolicyInstancesByPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListTrafficPolicyInstancesByPolicy, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ListTrafficPolicyInstancesByPolicy, Aws::Client::RejectedCallOutcome<ListTrafficPolicyInstancesByPolicyOutcome>(), this, request);
+}
+
+ListTrafficPolicyInstancesByPolicyOutcomeCallable Route53Client::ListTrafficPolicyInstancesByPolicyCallable(ListTrafficPolicyInstancesByPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ListTrafficPolicyInstancesByPolicy, Aws::Client::RejectedCallOutcome<ListTrafficPolicyInstancesByPolicyOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ListTrafficPolicyInstancesByPolicyAsync(const ListTrafficPolicyInstancesByPolicyRequest& request, const ListTrafficPolicyInstancesByPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListTrafficPolicyInstancesByPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ListTrafficPolicyInstancesByPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<ListTrafficPolicyInstancesByPolicyOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ListTrafficPolicyInstancesByPolicyAsync(ListTrafficPolicyInstancesByPolicyRequest&& request, const ListTrafficPolicyInstancesByPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ListTrafficPolicyInstancesByPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<ListTrafficPolicyInstancesByPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ListTrafficPolicyInstancesByPolicyAsyncHelper(const ListTrafficPolicyInstancesByPolicyRequest& request, const ListTrafficPolicyInstancesByPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1372,11 +1773,11 @@ void Route53Client::ListTrafficPolicyInstancesByPolicyAsyncHelper(const ListTraf
 
 ListTrafficPolicyVersionsOutcome Route53Client::ListTrafficPolicyVersions(const ListTrafficPolicyVersionsRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicies/";
-  ss << request.GetId();
-  ss << "/versions";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicies/");
+  uri.Append(request.GetId());
+  uri.Append("/versions");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListTrafficPolicyVersionsOutcome(ListTrafficPolicyVersionsResult(outcome.GetResult()));
@@ -1389,12 +1790,22 @@ ListTrafficPolicyVersionsOutcome Route53Client::ListTrafficPolicyVersions(const
 
 ListTrafficPolicyVersionsOutcomeCallable Route53Client::ListTrafficPolicyVersionsCallable(const ListTrafficPolicyVersionsRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::ListTrafficPolicyVersions, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::ListTrafficPolicyVersions, Aws::Client::RejectedCallOutcome<ListTrafficPolicyVersionsOutcome>(), this, request);
+}
+
+ListTrafficPolicyVersionsOutcomeCallable Route53Client::ListTrafficPolicyVersionsCallable(ListTrafficPolicyVersionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::ListTrafficPolicyVersions, Aws::Client::RejectedCallOutcome<ListTrafficPolicyVersionsOutcome>(), this, std::move(request));
 }
 
 void Route53Client::ListTrafficPolicyVersionsAsync(const ListTrafficPolicyVersionsRequest& request, const ListTrafficPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::ListTrafficPolicyVersionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::ListTrafficPolicyVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListTrafficPolicyVersionsOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::ListTrafficPolicyVersionsAsync(ListTrafficPolicyVersionsRequest&& request, const ListTrafficPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::ListTrafficPolicyVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListTrafficPolicyVersionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::ListTrafficPolicyVersionsAsyncHelper(const ListTrafficPolicyVersionsRequest& request, const ListTrafficPolicyVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1404,10 +1815,10 @@ void Route53Client::ListTrafficPolicyVersionsAsyncHelper(const ListTrafficPolicy
 
 UpdateHealthCheckOutcome Route53Client::UpdateHealthCheck(const UpdateHealthCheckRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/healthcheck/";
-  ss << request.GetHealthCheckId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/healthcheck/");
+  uri.Append(request.GetHealthCheckId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return UpdateHealthCheckOutcome(UpdateHealthCheckResult(outcome.GetResult()));
@@ -1420,12 +1831,22 @@ UpdateHealthCheckOutcome Route53Client::UpdateHealthCheck(const UpdateHealthChec
 
 UpdateHealthCheckOutcomeCallable Route53Client::UpdateHealthCheckCallable(const UpdateHealthCheckRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::UpdateHealthCheck, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::UpdateHealthCheck, Aws::Client::RejectedCallOutcome<UpdateHealthCheckOutcome>(), this, request);
+}
+
+UpdateHealthCheckOutcomeCallable Route53Client::UpdateHealthCheckCallable(UpdateHealthCheckRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::UpdateHealthCheck, Aws::Client::RejectedCallOutcome<UpdateHealthCheckOutcome>(), this, std::move(request));
 }
 
 void Route53Client::UpdateHealthCheckAsync(const UpdateHealthCheckRequest& request, const UpdateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::UpdateHealthCheckAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::UpdateHealthCheckAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateHealthCheckOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::UpdateHealthCheckAsync(UpdateHealthCheckRequest&& request, const UpdateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::UpdateHealthCheckAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateHealthCheckOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::UpdateHealthCheckAsyncHelper(const UpdateHealthCheckRequest& request, const UpdateHealthCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1435,10 +1856,10 @@ void Route53Client::UpdateHealthCheckAsyncHelper(const UpdateHealthCheckRequest&
 
 UpdateHostedZoneCommentOutcome Route53Client::UpdateHostedZoneComment(const UpdateHostedZoneCommentRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/hostedzone/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/hostedzone/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return UpdateHostedZoneCommentOutcome(UpdateHostedZoneCommentResult(outcome.GetResult()));
@@ -1451,12 +1872,22 @@ UpdateHostedZoneCommentOutcome Route53Client::UpdateHostedZoneComment(const Upda
 
 UpdateHostedZoneCommentOutcomeCallable Route53Client::UpdateHostedZoneCommentCallable(const UpdateHostedZoneCommentRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::UpdateHostedZoneComment, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::UpdateHostedZoneComment, Aws::Client::RejectedCallOutcome<UpdateHostedZoneCommentOutcome>(), this, request);
+}
+
+UpdateHostedZoneCommentOutcomeCallable Route53Client::UpdateHostedZoneCommentCallable(UpdateHostedZoneCommentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::UpdateHostedZoneComment, Aws::Client::RejectedCallOutcome<UpdateHostedZoneCommentOutcome>(), this, std::move(request));
 }
 
 void Route53Client::UpdateHostedZoneCommentAsync(const UpdateHostedZoneCommentRequest& request, const UpdateHostedZoneCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::UpdateHostedZoneCommentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::UpdateHostedZoneCommentAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateHostedZoneCommentOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::UpdateHostedZoneCommentAsync(UpdateHostedZoneCommentRequest&& request, const UpdateHostedZoneCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::UpdateHostedZoneCommentAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateHostedZoneCommentOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::UpdateHostedZoneCommentAsyncHelper(const UpdateHostedZoneCommentRequest& request, const UpdateHostedZoneCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1466,12 +1897,12 @@ void Route53Client::UpdateHostedZoneCommentAsyncHelper(const UpdateHostedZoneCom
 
 UpdateTrafficPolicyCommentOutcome Route53Client::UpdateTrafficPolicyComment(const UpdateTrafficPolicyCommentRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicy/";
-  ss << request.GetId();
-  ss << "/";
-  ss << request.GetVersion();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicy/");
+  uri.Append(request.GetId());
+  uri.Append("/");
+  uri.Append(request.GetVersion());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return UpdateTrafficPolicyCommentOutcome(UpdateTrafficPolicyCommentResult(outcome.GetResult()));
@@ -1484,12 +1915,22 @@ UpdateTrafficPolicyCommentOutcome Route53Client::UpdateTrafficPolicyComment(cons
 
 UpdateTrafficPolicyCommentOutcomeCallable Route53Client::UpdateTrafficPolicyCommentCallable(const UpdateTrafficPolicyCommentRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::UpdateTrafficPolicyComment, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::UpdateTrafficPolicyComment, Aws::Client::RejectedCallOutcome<UpdateTrafficPolicyCommentOutcome>(), this, request);
+}
+
+UpdateTrafficPolicyCommentOutcomeCallable Route53Client::UpdateTrafficPolicyCommentCallable(UpdateTrafficPolicyCommentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::UpdateTrafficPolicyComment, Aws::Client::RejectedCallOutcome<UpdateTrafficPolicyCommentOutcome>(), this, std::move(request));
 }
 
 void Route53Client::UpdateTrafficPolicyCommentAsync(const UpdateTrafficPolicyCommentRequest& request, const UpdateTrafficPolicyCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::UpdateTrafficPolicyCommentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::UpdateTrafficPolicyCommentAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateTrafficPolicyCommentOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::UpdateTrafficPolicyCommentAsync(UpdateTrafficPolicyCommentRequest&& request, const UpdateTrafficPolicyCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::UpdateTrafficPolicyCommentAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateTrafficPolicyCommentOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::UpdateTrafficPolicyCommentAsyncHelper(const UpdateTrafficPolicyCommentRequest& request, const UpdateTrafficPolicyCommentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1499,10 +1940,10 @@ void Route53Client::UpdateTrafficPolicyCommentAsyncHelper(const UpdateTrafficPol
 
 UpdateTrafficPolicyInstanceOutcome Route53Client::UpdateTrafficPolicyInstance(const UpdateTrafficPolicyInstanceRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/2013-04-01/trafficpolicyinstance/";
-  ss << request.GetId();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/2013-04-01/trafficpolicyinstance/");
+  uri.Append(request.GetId());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return UpdateTrafficPolicyInstanceOutcome(UpdateTrafficPolicyInstanceResult(outcome.GetResult()));
@@ -1515,12 +1956,22 @@ UpdateTrafficPolicyInstanceOutcome Route53Client::UpdateTrafficPolicyInstance(co
 
 UpdateTrafficPolicyInstanceOutcomeCallable Route53Client::UpdateTrafficPolicyInstanceCallable(const UpdateTrafficPolicyInstanceRequest& request) const
 {
-  return std::async(std::launch::async, &Route53Client::UpdateTrafficPolicyInstance, this, request);
+  return m_executor->SubmitWithFuture(&Route53Client::UpdateTrafficPolicyInstance, Aws::Client::RejectedCallOutcome<UpdateTrafficPolicyInstanceOutcome>(), this, request);
+}
+
+UpdateTrafficPolicyInstanceOutcomeCallable Route53Client::UpdateTrafficPolicyInstanceCallable(UpdateTrafficPolicyInstanceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53Client::UpdateTrafficPolicyInstance, Aws::Client::RejectedCallOutcome<UpdateTrafficPolicyInstanceOutcome>(), this, std::move(request));
 }
 
 void Route53Client::UpdateTrafficPolicyInstanceAsync(const UpdateTrafficPolicyInstanceRequest& request, const UpdateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53Client::UpdateTrafficPolicyInstanceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53Client::UpdateTrafficPolicyInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateTrafficPolicyInstanceOutcome>(), this, request, handler, context);
+}
+
+void Route53Client::UpdateTrafficPolicyInstanceAsync(UpdateTrafficPolicyInstanceRequest&& request, const UpdateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53Client::UpdateTrafficPolicyInstanceAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateTrafficPolicyInstanceOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53Client::UpdateTrafficPolicyInstanceAsyncHelper(const UpdateTrafficPolicyInstanceRequest& request, const UpdateTrafficPolicyInstanceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -40,6 +40,28 @@
 #include <aws/route53domains/model/UpdateTagsForDomainResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/route53domains/model/CheckDomainAvailabilityRequest.h>
+#include <aws/route53domains/model/DeleteTagsForDomainRequest.h>
+#include <aws/route53domains/model/DisableDomainAutoRenewRequest.h>
+#include <aws/route53domains/model/DisableDomainTransferLockRequest.h>
+#include <aws/route53domains/model/EnableDomainAutoRenewRequest.h>
+#include <aws/route53domains/model/EnableDomainTransferLockRequest.h>
+#include <aws/route53domains/model/GetDomainDetailRequest.h>
+#include <aws/route53domains/model/GetOperationDetailRequest.h>
+#include <aws/route53domains/model/ListDomainsRequest.h>
+#include <aws/route53domains/model/ListOperationsRequest.h>
+#include <aws/route53domains/model/ListTagsForDomainRequest.h>
+#include <aws/route53domains/model/RegisterDomainRequest.h>
+#include <aws/route53domains/model/RetrieveDomainAuthCodeRequest.h>
+#include <aws/route53domains/model/TransferDomainRequest.h>
+#include <aws/route53domains/model/UpdateDomainContactRequest.h>
+#include <aws/route53domains/model/UpdateDomainContactPrivacyRequest.h>
+#include <aws/route53domains/model/UpdateDomainNameserversRequest.h>
+#include <aws/route53domains/model/UpdateTagsForDomainRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -207,6 +229,11 @@ namespace Model
          */
         virtual Model::CheckDomainAvailabilityOutcomeCallable CheckDomainAvailabilityCallable(const Model::CheckDomainAvailabilityRequest& request) const;
 
+        /**
+         * Same as CheckDomainAvailabilityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CheckDomainAvailabilityOutcomeCallable CheckDomainAvailabilityCallable(Model::CheckDomainAvailabilityRequest&& request) const;
+
         /**
          * <p>This operation checks the availability of one domain name. You can access
          * this API without authenticating. Note that if the availability status of a
@@ -217,6 +244,11 @@ namespace Model
          */
         virtual void CheckDomainAvailabilityAsync(const Model::CheckDomainAvailabilityRequest& request, const CheckDomainAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CheckDomainAvailabilityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CheckDomainAvailabilityAsync(Model::CheckDomainAvailabilityRequest&& request, const CheckDomainAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation deletes the specified tags for a domain.</p> <p>All tag
          * operations are eventually consistent; subsequent operations may not immediately
@@ -233,6 +265,11 @@ namespace Model
          */
         virtual Model::DeleteTagsForDomainOutcomeCallable DeleteTagsForDomainCallable(const Model::DeleteTagsForDomainRequest& request) const;
 
+        /**
+         * Same as DeleteTagsForDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteTagsForDomainOutcomeCallable DeleteTagsForDomainCallable(Model::DeleteTagsForDomainRequest&& request) const;
+
         /**
          * <p>This operation deletes the specified tags for a domain.</p> <p>All tag
          * operations are eventually consistent; subsequent operations may not immediately
@@ -242,6 +279,11 @@ namespace Model
          */
         virtual void DeleteTagsForDomainAsync(const Model::DeleteTagsForDomainRequest& request, const DeleteTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTagsForDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteTagsForDomainAsync(Model::DeleteTagsForDomainRequest&& request, const DeleteTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation disables automatic renewal of domain registration for the
          * specified domain.</p> <note>Caution! Amazon Route 53 doesn't have a manual
@@ -262,6 +304,11 @@ namespace Model
          */
         virtual Model::DisableDomainAutoRenewOutcomeCallable DisableDomainAutoRenewCallable(const Model::DisableDomainAutoRenewRequest& request) const;
 
+        /**
+         * Same as DisableDomainAutoRenewCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableDomainAutoRenewOutcomeCallable DisableDomainAutoRenewCallable(Model::DisableDomainAutoRenewRequest&& request) const;
+
         /**
          * <p>This operation disables automatic renewal of domain registration for the
          * specified domain.</p> <note>Caution! Amazon Route 53 doesn't have a manual
@@ -273,6 +320,11 @@ namespace Model
          */
         virtual void DisableDomainAutoRenewAsync(const Model::DisableDomainAutoRenewRequest& request, const DisableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableDomainAutoRenewAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableDomainAutoRenewAsync(Model::DisableDomainAutoRenewRequest&& request, const DisableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation removes the transfer lock on the domain (specifically the
          * <code>clientTransferProhibited</code> status) to allow domain transfers. We
@@ -297,6 +349,11 @@ namespace Model
          */
         virtual Model::DisableDomainTransferLockOutcomeCallable DisableDomainTransferLockCallable(const Model::DisableDomainTransferLockRequest& request) const;
 
+        /**
+         * Same as DisableDomainTransferLockCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableDomainTransferLockOutcomeCallable DisableDomainTransferLockCallable(Model::DisableDomainTransferLockRequest&& request) const;
+
         /**
          * <p>This operation removes the transfer lock on the domain (specifically the
          * <code>clientTransferProhibited</code> status) to allow domain transfers. We
@@ -310,6 +367,11 @@ namespace Model
          */
         virtual void DisableDomainTransferLockAsync(const Model::DisableDomainTransferLockRequest& request, const DisableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableDomainTransferLockAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableDomainTransferLockAsync(Model::DisableDomainTransferLockRequest&& request, const DisableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation configures Amazon Route 53 to automatically renew the
          * specified domain before the domain registration expires. The cost of renewing
@@ -340,6 +402,11 @@ namespace Model
          */
         virtual Model::EnableDomainAutoRenewOutcomeCallable EnableDomainAutoRenewCallable(const Model::EnableDomainAutoRenewRequest& request) const;
 
+        /**
+         * Same as EnableDomainAutoRenewCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableDomainAutoRenewOutcomeCallable EnableDomainAutoRenewCallable(Model::EnableDomainAutoRenewRequest&& request) const;
+
         /**
          * <p>This operation configures Amazon Route 53 to automatically renew the
          * specified domain before the domain registration expires. The cost of renewing
@@ -356,6 +423,11 @@ namespace Model
          */
         virtual void EnableDomainAutoRenewAsync(const Model::EnableDomainAutoRenewRequest& request, const EnableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableDomainAutoRenewAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableDomainAutoRenewAsync(Model::EnableDomainAutoRenewRequest&& request, const EnableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation sets the transfer lock on the domain (specifically the
          * <code>clientTransferProhibited</code> status) to prevent domain transfers.
@@ -376,6 +448,11 @@ namespace Model
          */
         virtual Model::EnableDomainTransferLockOutcomeCallable EnableDomainTransferLockCallable(const Model::EnableDomainTransferLockRequest& request) const;
 
+        /**
+         * Same as EnableDomainTransferLockCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::EnableDomainTransferLockOutcomeCallable EnableDomainTransferLockCallable(Model::EnableDomainTransferLockRequest&& request) const;
+
         /**
          * <p>This operation sets the transfer lock on the domain (specifically the
          * <code>clientTransferProhibited</code> status) to prevent domain transfers.
@@ -387,6 +464,11 @@ namespace Model
          */
         virtual void EnableDomainTransferLockAsync(const Model::EnableDomainTransferLockRequest& request, const EnableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as EnableDomainTransferLockAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void EnableDomainTransferLockAsync(Model::EnableDomainTransferLockRequest&& request, const EnableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns detailed information about the domain. The domain's
          * contact information is also returned as part of the output.</p>
@@ -401,6 +483,11 @@ namespace Model
          */
         virtual Model::GetDomainDetailOutcomeCallable GetDomainDetailCallable(const Model::GetDomainDetailRequest& request) const;
 
+        /**
+         * Same as GetDomainDetailCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDomainDetailOutcomeCallable GetDomainDetailCallable(Model::GetDomainDetailRequest&& request) const;
+
         /**
          * <p>This operation returns detailed information about the domain. The domain's
          * contact information is also returned as part of the output.</p>
@@ -409,6 +496,11 @@ namespace Model
          */
         virtual void GetDomainDetailAsync(const Model::GetDomainDetailRequest& request, const GetDomainDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDomainDetailAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDomainDetailAsync(Model::GetDomainDetailRequest&& request, const GetDomainDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns the current status of an operation that is not
          * completed.</p>
@@ -423,6 +515,11 @@ namespace Model
          */
         virtual Model::GetOperationDetailOutcomeCallable GetOperationDetailCallable(const Model::GetOperationDetailRequest& request) const;
 
+        /**
+         * Same as GetOperationDetailCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetOperationDetailOutcomeCallable GetOperationDetailCallable(Model::GetOperationDetailRequest&& request) const;
+
         /**
          * <p>This operation returns the current status of an operation that is not
          * completed.</p>
@@ -431,6 +528,11 @@ namespace Model
          */
         virtual void GetOperationDetailAsync(const Model::GetOperationDetailRequest& request, const GetOperationDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetOperationDetailAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetOperationDetailAsync(Model::GetOperationDetailRequest&& request, const GetOperationDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns all the domain names registered with Amazon Route 53
          * for the current AWS account.</p>
@@ -445,6 +547,11 @@ namespace Model
          */
         virtual Model::ListDomainsOutcomeCallable ListDomainsCallable(const Model::ListDomainsRequest& request) const;
 
+        /**
+         * Same as ListDomainsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDomainsOutcomeCallable ListDomainsCallable(Model::ListDomainsRequest&& request) const;
+
         /**
          * <p>This operation returns all the domain names registered with Amazon Route 53
          * for the current AWS account.</p>
@@ -453,6 +560,11 @@ namespace Model
          */
         virtual void ListDomainsAsync(const Model::ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDomainsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDomainsAsync(Model::ListDomainsRequest&& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns the operation IDs of operations that are not yet
          * complete.</p>
@@ -467,6 +579,11 @@ namespace Model
          */
         virtual Model::ListOperationsOutcomeCallable ListOperationsCallable(const Model::ListOperationsRequest& request) const;
 
+        /**
+         * Same as ListOperationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListOperationsOutcomeCallable ListOperationsCallable(Model::ListOperationsRequest&& request) const;
+
         /**
          * <p>This operation returns the operation IDs of operations that are not yet
          * complete.</p>
@@ -475,6 +592,11 @@ namespace Model
          */
         virtual void ListOperationsAsync(const Model::ListOperationsRequest& request, const ListOperationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListOperationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListOperationsAsync(Model::ListOperationsRequest&& request, const ListOperationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns all of the tags that are associated with the specified
          * domain.</p> <p>All tag operations are eventually consistent; subsequent
@@ -491,6 +613,11 @@ namespace Model
          */
         virtual Model::ListTagsForDomainOutcomeCallable ListTagsForDomainCallable(const Model::ListTagsForDomainRequest& request) const;
 
+        /**
+         * Same as ListTagsForDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTagsForDomainOutcomeCallable ListTagsForDomainCallable(Model::ListTagsForDomainRequest&& request) const;
+
         /**
          * <p>This operation returns all of the tags that are associated with the specified
          * domain.</p> <p>All tag operations are eventually consistent; subsequent
@@ -500,6 +627,11 @@ namespace Model
          */
         virtual void ListTagsForDomainAsync(const Model::ListTagsForDomainRequest& request, const ListTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTagsForDomainAsync(Model::ListTagsForDomainRequest&& request, const ListTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation registers a domain. Domains are registered by the AWS
          * registrar partner, Gandi. For some top-level domains (TLDs), this operation
@@ -546,6 +678,11 @@ namespace Model
          */
         virtual Model::RegisterDomainOutcomeCallable RegisterDomainCallable(const Model::RegisterDomainRequest& request) const;
 
+        /**
+         * Same as RegisterDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterDomainOutcomeCallable RegisterDomainCallable(Model::RegisterDomainRequest&& request) const;
+
         /**
          * <p>This operation registers a domain. Domains are registered by the AWS
          * registrar partner, Gandi. For some top-level domains (TLDs), this operation
@@ -570,6 +707,11 @@ namespace Model
          */
         virtual void RegisterDomainAsync(const Model::RegisterDomainRequest& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterDomainAsync(Model::RegisterDomainRequest&& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns the AuthCode for the domain. To transfer a domain to
          * another registrar, you provide this value to the new registrar.</p>
@@ -584,6 +726,11 @@ namespace Model
          */
         virtual Model::RetrieveDomainAuthCodeOutcomeCallable RetrieveDomainAuthCodeCallable(const Model::RetrieveDomainAuthCodeRequest& request) const;
 
+        /**
+         * Same as RetrieveDomainAuthCodeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RetrieveDomainAuthCodeOutcomeCallable RetrieveDomainAuthCodeCallable(Model::RetrieveDomainAuthCodeRequest&& request) const;
+
         /**
          * <p>This operation returns the AuthCode for the domain. To transfer a domain to
          * another registrar, you provide this value to the new registrar.</p>
@@ -592,6 +739,11 @@ namespace Model
          */
         virtual void RetrieveDomainAuthCodeAsync(const Model::RetrieveDomainAuthCodeRequest& request, const RetrieveDomainAuthCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RetrieveDomainAuthCodeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RetrieveDomainAuthCodeAsync(Model::RetrieveDomainAuthCodeRequest&& request, const RetrieveDomainAuthCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation transfers a domain from another registrar to Amazon Route 53.
          * When the transfer is complete, the domain is registered with the AWS registrar
@@ -640,6 +792,11 @@ namespace Model
          */
         virtual Model::TransferDomainOutcomeCallable TransferDomainCallable(const Model::TransferDomainRequest& request) const;
 
+        /**
+         * Same as TransferDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::TransferDomainOutcomeCallable TransferDomainCallable(Model::TransferDomainRequest&& request) const;
+
         /**
          * <p>This operation transfers a domain from another registrar to Amazon Route 53.
          * When the transfer is complete, the domain is registered with the AWS registrar
@@ -665,6 +822,11 @@ namespace Model
          */
         virtual void TransferDomainAsync(const Model::TransferDomainRequest& request, const TransferDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TransferDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void TransferDomainAsync(Model::TransferDomainRequest&& request, const TransferDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation updates the contact information for a particular domain.
          * Information for at least one contact (registrant, administrator, or technical)
@@ -687,6 +849,11 @@ namespace Model
          */
         virtual Model::UpdateDomainContactOutcomeCallable UpdateDomainContactCallable(const Model::UpdateDomainContactRequest& request) const;
 
+        /**
+         * Same as UpdateDomainContactCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateDomainContactOutcomeCallable UpdateDomainContactCallable(Model::UpdateDomainContactRequest&& request) const;
+
         /**
          * <p>This operation updates the contact information for a particular domain.
          * Information for at least one contact (registrant, administrator, or technical)
@@ -699,6 +866,11 @@ namespace Model
          */
         virtual void UpdateDomainContactAsync(const Model::UpdateDomainContactRequest& request, const UpdateDomainContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDomainContactAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateDomainContactAsync(Model::UpdateDomainContactRequest&& request, const UpdateDomainContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation updates the specified domain contact's privacy setting. When
          * the privacy option is enabled, personal information such as postal or email
@@ -729,6 +901,11 @@ namespace Model
          */
         virtual Model::UpdateDomainContactPrivacyOutcomeCallable UpdateDomainContactPrivacyCallable(const Model::UpdateDomainContactPrivacyRequest& request) const;
 
+        /**
+         * Same as UpdateDomainContactPrivacyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateDomainContactPrivacyOutcomeCallable UpdateDomainContactPrivacyCallable(Model::UpdateDomainContactPrivacyRequest&& request) const;
+
         /**
          * <p>This operation updates the specified domain contact's privacy setting. When
          * the privacy option is enabled, personal information such as postal or email
@@ -745,6 +922,11 @@ namespace Model
          */
         virtual void UpdateDomainContactPrivacyAsync(const Model::UpdateDomainContactPrivacyRequest& request, const UpdateDomainContactPrivacyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDomainContactPrivacyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateDomainContactPrivacyAsync(Model::UpdateDomainContactPrivacyRequest&& request, const UpdateDomainContactPrivacyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation replaces the current set of name servers for the domain with
          * the specified set of name servers. If you use Amazon Route 53 as your DNS
@@ -769,6 +951,11 @@ namespace Model
          */
         virtual Model::UpdateDomainNameserversOutcomeCallable UpdateDomainNameserversCallable(const Model::UpdateDomainNameserversRequest& request) const;
 
+        /**
+         * Same as UpdateDomainNameserversCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateDomainNameserversOutcomeCallable UpdateDomainNameserversCallable(Model::UpdateDomainNameserversRequest&& request) const;
+
         /**
          * <p>This operation replaces the current set of name servers for the domain with
          * the specified set of name servers. If you use Amazon Route 53 as your DNS
@@ -782,6 +969,11 @@ namespace Model
          */
         virtual void UpdateDomainNameserversAsync(const Model::UpdateDomainNameserversRequest& request, const UpdateDomainNameserversResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateDomainNameserversAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateDomainNameserversAsync(Model::UpdateDomainNameserversRequest&& request, const UpdateDomainNameserversResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation adds or updates tags for a specified domain.</p> <p>All tag
          * operations are eventually consistent; subsequent operations may not immediately
@@ -798,6 +990,11 @@ namespace Model
          */
         virtual Model::UpdateTagsForDomainOutcomeCallable UpdateTagsForDomainCallable(const Model::UpdateTagsForDomainRequest& request) const;
 
+        /**
+         * Same as UpdateTagsForDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateTagsForDomainOutcomeCallable UpdateTagsForDomainCallable(Model::UpdateTagsForDomainRequest&& request) const;
+
         /**
          * <p>This operation adds or updates tags for a specified domain.</p> <p>All tag
          * operations are eventually consistent; subsequent operations may not immediately
@@ -807,6 +1004,54 @@ namespace Model
          */
         virtual void UpdateTagsForDomainAsync(const Model::UpdateTagsForDomainRequest& request, const UpdateTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateTagsForDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateTagsForDomainAsync(Model::UpdateTagsForDomainRequest&& request, const UpdateTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CheckDomainAvailabilityOutcome> CheckDomainAvailabilityAwaitable(const Model::CheckDomainAvailabilityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::CheckDomainAvailability, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CheckDomainAvailabilityOutcome> CheckDomainAvailabilityAwaitable(Model::CheckDomainAvailabilityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::CheckDomainAvailability, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTagsForDomainOutcome> DeleteTagsForDomainAwaitable(const Model::DeleteTagsForDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::DeleteTagsForDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTagsForDomainOutcome> DeleteTagsForDomainAwaitable(Model::DeleteTagsForDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::DeleteTagsForDomain, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableDomainAutoRenewOutcome> DisableDomainAutoRenewAwaitable(const Model::DisableDomainAutoRenewRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::DisableDomainAutoRenew, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableDomainAutoRenewOutcome> DisableDomainAutoRenewAwaitable(Model::DisableDomainAutoRenewRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::DisableDomainAutoRenew, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableDomainTransferLockOutcome> DisableDomainTransferLockAwaitable(const Model::DisableDomainTransferLockRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::DisableDomainTransferLock, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableDomainTransferLockOutcome> DisableDomainTransferLockAwaitable(Model::DisableDomainTransferLockRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::DisableDomainTransferLock, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableDomainAutoRenewOutcome> EnableDomainAutoRenewAwaitable(const Model::EnableDomainAutoRenewRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::EnableDomainAutoRenew, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableDomainAutoRenewOutcome> EnableDomainAutoRenewAwaitable(Model::EnableDomainAutoRenewRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::EnableDomainAutoRenew, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableDomainTransferLockOutcome> EnableDomainTransferLockAwaitable(const Model::EnableDomainTransferLockRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::EnableDomainTransferLock, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::EnableDomainTransferLockOutcome> EnableDomainTransferLockAwaitable(Model::EnableDomainTransferLockRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::EnableDomainTransferLock, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDomainDetailOutcome> GetDomainDetailAwaitable(const Model::GetDomainDetailRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::GetDomainDetail, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDomainDetailOutcome> GetDomainDetailAwaitable(Model::GetDomainDetailRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::GetDomainDetail, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetOperationDetailOutcome> GetOperationDetailAwaitable(const Model::GetOperationDetailRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::GetOperationDetail, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetOperationDetailOutcome> GetOperationDetailAwaitable(Model::GetOperationDetailRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::GetOperationDetail, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDomainsOutcome> ListDomainsAwaitable(const Model::ListDomainsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::ListDomains, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDomainsOutcome> ListDomainsAwaitable(Model::ListDomainsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::ListDomains, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListOperationsOutcome> ListOperationsAwaitable(const Model::ListOperationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::ListOperations, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListOperationsOutcome> ListOperationsAwaitable(Model::ListOperationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::ListOperations, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForDomainOutcome> ListTagsForDomainAwaitable(const Model::ListTagsForDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::ListTagsForDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForDomainOutcome> ListTagsForDomainAwaitable(Model::ListTagsForDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::ListTagsForDomain, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterDomainOutcome> RegisterDomainAwaitable(const Model::RegisterDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::RegisterDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterDomainOutcome> RegisterDomainAwaitable(Model::RegisterDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::RegisterDomain, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RetrieveDomainAuthCodeOutcome> RetrieveDomainAuthCodeAwaitable(const Model::RetrieveDomainAuthCodeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::RetrieveDomainAuthCode, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RetrieveDomainAuthCodeOutcome> RetrieveDomainAuthCodeAwaitable(Model::RetrieveDomainAuthCodeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::RetrieveDomainAuthCode, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TransferDomainOutcome> TransferDomainAwaitable(const Model::TransferDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::TransferDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TransferDomainOutcome> TransferDomainAwaitable(Model::TransferDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::TransferDomain, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDomainContactOutcome> UpdateDomainContactAwaitable(const Model::UpdateDomainContactRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::UpdateDomainContact, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDomainContactOutcome> UpdateDomainContactAwaitable(Model::UpdateDomainContactRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::UpdateDomainContact, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDomainContactPrivacyOutcome> UpdateDomainContactPrivacyAwaitable(const Model::UpdateDomainContactPrivacyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::UpdateDomainContactPrivacy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDomainContactPrivacyOutcome> UpdateDomainContactPrivacyAwaitable(Model::UpdateDomainContactPrivacyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::UpdateDomainContactPrivacy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDomainNameserversOutcome> UpdateDomainNameserversAwaitable(const Model::UpdateDomainNameserversRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::UpdateDomainNameservers, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateDomainNameserversOutcome> UpdateDomainNameserversAwaitable(Model::UpdateDomainNameserversRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::UpdateDomainNameservers, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateTagsForDomainOutcome> UpdateTagsForDomainAwaitable(const Model::UpdateTagsForDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::UpdateTagsForDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateTagsForDomainOutcome> UpdateTagsForDomainAwaitable(Model::UpdateTagsForDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &Route53DomainsClient::UpdateTagsForDomain, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -125,12 +125,22 @@ CheckDomainAvailabilityOutcome Route53DomainsClient::CheckDomainAvailability(con
 
 CheckDomainAvailabilityOutcomeCallable Route53DomainsClient::CheckDomainAvailabilityCallable(const CheckDomainAvailabilityRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::CheckDomainAvailability, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::CheckDomainAvailability, Aws::Client::RejectedCallOutcome<CheckDomainAvailabilityOutcome>(), this, request);
+}
+
+CheckDomainAvailabilityOutcomeCallable Route53DomainsClient::CheckDomainAvailabilityCallable(CheckDomainAvailabilityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::CheckDomainAvailability, Aws::Client::RejectedCallOutcome<CheckDomainAvailabilityOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::CheckDomainAvailabilityAsync(const CheckDomainAvailabilityRequest& request, const CheckDomainAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::CheckDomainAvailabilityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::CheckDomainAvailabilityAsyncHelper, Aws::Client::RejectedAsyncCall<CheckDomainAvailabilityOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::CheckDomainAvailabilityAsync(CheckDomainAvailabilityRequest&& request, const CheckDomainAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::CheckDomainAvailabilityAsyncHelper, Aws::Client::RejectedAsyncCall<CheckDomainAvailabilityOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::CheckDomainAvailabilityAsyncHelper(const CheckDomainAvailabilityRequest& request, const CheckDomainAvailabilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -156,12 +166,22 @@ DeleteTagsForDomainOutcome Route53DomainsClient::DeleteTagsForDomain(const Delet
 
 DeleteTagsForDomainOutcomeCallable Route53DomainsClient::DeleteTagsForDomainCallable(const DeleteTagsForDomainRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::DeleteTagsForDomain, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::DeleteTagsForDomain, Aws::Client::RejectedCallOutcome<DeleteTagsForDomainOutcome>(), this, request);
+}
+
+DeleteTagsForDomainOutcomeCallable Route53DomainsClient::DeleteTagsForDomainCallable(DeleteTagsForDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::DeleteTagsForDomain, Aws::Client::RejectedCallOutcome<DeleteTagsForDomainOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::DeleteTagsForDomainAsync(const DeleteTagsForDomainRequest& request, const DeleteTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::DeleteTagsForDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::DeleteTagsForDomainAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTagsForDomainOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::DeleteTagsForDomainAsync(DeleteTagsForDomainRequest&& request, const DeleteTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::DeleteTagsForDomainAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTagsForDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::DeleteTagsForDomainAsyncHelper(const DeleteTagsForDomainRequest& request, const DeleteTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -187,12 +207,22 @@ DisableDomainAutoRenewOutcome Route53DomainsClient::DisableDomainAutoRenew(const
 
 DisableDomainAutoRenewOutcomeCallable Route53DomainsClient::DisableDomainAutoRenewCallable(const DisableDomainAutoRenewRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::DisableDomainAutoRenew, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::DisableDomainAutoRenew, Aws::Client::RejectedCallOutcome<DisableDomainAutoRenewOutcome>(), this, request);
+}
+
+DisableDomainAutoRenewOutcomeCallable Route53DomainsClient::DisableDomainAutoRenewCallable(DisableDomainAutoRenewRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::DisableDomainAutoRenew, Aws::Client::RejectedCallOutcome<DisableDomainAutoRenewOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::DisableDomainAutoRenewAsync(const DisableDomainAutoRenewRequest& request, const DisableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::DisableDomainAutoRenewAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::DisableDomainAutoRenewAsyncHelper, Aws::Client::RejectedAsyncCall<DisableDomainAutoRenewOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::DisableDomainAutoRenewAsync(DisableDomainAutoRenewRequest&& request, const DisableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::DisableDomainAutoRenewAsyncHelper, Aws::Client::RejectedAsyncCall<DisableDomainAutoRenewOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::DisableDomainAutoRenewAsyncHelper(const DisableDomainAutoRenewRequest& request, const DisableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -218,12 +248,22 @@ DisableDomainTransferLockOutcome Route53DomainsClient::DisableDomainTransferLock
 
 DisableDomainTransferLockOutcomeCallable Route53DomainsClient::DisableDomainTransferLockCallable(const DisableDomainTransferLockRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::DisableDomainTransferLock, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::DisableDomainTransferLock, Aws::Client::RejectedCallOutcome<DisableDomainTransferLockOutcome>(), this, request);
+}
+
+DisableDomainTransferLockOutcomeCallable Route53DomainsClient::DisableDomainTransferLockCallable(DisableDomainTransferLockRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::DisableDomainTransferLock, Aws::Client::RejectedCallOutcome<DisableDomainTransferLockOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::DisableDomainTransferLockAsync(const DisableDomainTransferLockRequest& request, const DisableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::DisableDomainTransferLockAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::DisableDomainTransferLockAsyncHelper, Aws::Client::RejectedAsyncCall<DisableDomainTransferLockOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::DisableDomainTransferLockAsync(DisableDomainTransferLockRequest&& request, const DisableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::DisableDomainTransferLockAsyncHelper, Aws::Client::RejectedAsyncCall<DisableDomainTransferLockOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::DisableDomainTransferLockAsyncHelper(const DisableDomainTransferLockRequest& request, const DisableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -249,12 +289,22 @@ EnableDomainAutoRenewOutcome Route53DomainsClient::EnableDomainAutoRenew(const E
 
 EnableDomainAutoRenewOutcomeCallable Route53DomainsClient::EnableDomainAutoRenewCallable(const EnableDomainAutoRenewRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::EnableDomainAutoRenew, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::EnableDomainAutoRenew, Aws::Client::RejectedCallOutcome<EnableDomainAutoRenewOutcome>(), this, request);
+}
+
+EnableDomainAutoRenewOutcomeCallable Route53DomainsClient::EnableDomainAutoRenewCallable(EnableDomainAutoRenewRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::EnableDomainAutoRenew, Aws::Client::RejectedCallOutcome<EnableDomainAutoRenewOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::EnableDomainAutoRenewAsync(const EnableDomainAutoRenewRequest& request, const EnableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::EnableDomainAutoRenewAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::EnableDomainAutoRenewAsyncHelper, Aws::Client::RejectedAsyncCall<EnableDomainAutoRenewOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::EnableDomainAutoRenewAsync(EnableDomainAutoRenewRequest&& request, const EnableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::EnableDomainAutoRenewAsyncHelper, Aws::Client::RejectedAsyncCall<EnableDomainAutoRenewOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::EnableDomainAutoRenewAsyncHelper(const EnableDomainAutoRenewRequest& request, const EnableDomainAutoRenewResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -280,12 +330,22 @@ EnableDomainTransferLockOutcome Route53DomainsClient::EnableDomainTransferLock(c
 
 EnableDomainTransferLockOutcomeCallable Route53DomainsClient::EnableDomainTransferLockCallable(const EnableDomainTransferLockRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::EnableDomainTransferLock, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::EnableDomainTransferLock, Aws::Client::RejectedCallOutcome<EnableDomainTransferLockOutcome>(), this, request);
+}
+
+EnableDomainTransferLockOutcomeCallable Route53DomainsClient::EnableDomainTransferLockCallable(EnableDomainTransferLockRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::EnableDomainTransferLock, Aws::Client::RejectedCallOutcome<EnableDomainTransferLockOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::EnableDomainTransferLockAsync(const EnableDomainTransferLockRequest& request, const EnableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::EnableDomainTransferLockAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::EnableDomainTransferLockAsyncHelper, Aws::Client::RejectedAsyncCall<EnableDomainTransferLockOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::EnableDomainTransferLockAsync(EnableDomainTransferLockRequest&& request, const EnableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::EnableDomainTransferLockAsyncHelper, Aws::Client::RejectedAsyncCall<EnableDomainTransferLockOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::EnableDomainTransferLockAsyncHelper(const EnableDomainTransferLockRequest& request, const EnableDomainTransferLockResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -311,12 +371,22 @@ GetDomainDetailOutcome Route53DomainsClient::GetDomainDetail(const GetDomainDeta
 
 GetDomainDetailOutcomeCallable Route53DomainsClient::GetDomainDetailCallable(const GetDomainDetailRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::GetDomainDetail, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::GetDomainDetail, Aws::Client::RejectedCallOutcome<GetDomainDetailOutcome>(), this, request);
+}
+
+GetDomainDetailOutcomeCallable Route53DomainsClient::GetDomainDetailCallable(GetDomainDetailRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::GetDomainDetail, Aws::Client::RejectedCallOutcome<GetDomainDetailOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::GetDomainDetailAsync(const GetDomainDetailRequest& request, const GetDomainDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::GetDomainDetailAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::GetDomainDetailAsyncHelper, Aws::Client::RejectedAsyncCall<GetDomainDetailOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::GetDomainDetailAsync(GetDomainDetailRequest&& request, const GetDomainDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::GetDomainDetailAsyncHelper, Aws::Client::RejectedAsyncCall<GetDomainDetailOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::GetDomainDetailAsyncHelper(const GetDomainDetailRequest& request, const GetDomainDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -342,12 +412,22 @@ GetOperationDetailOutcome Route53DomainsClient::GetOperationDetail(const GetOper
 
 GetOperationDetailOutcomeCallable Route53DomainsClient::GetOperationDetailCallable(const GetOperationDetailRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::GetOperationDetail, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::GetOperationDetail, Aws::Client::RejectedCallOutcome<GetOperationDetailOutcome>(), this, request);
+}
+
+GetOperationDetailOutcomeCallable Route53DomainsClient::GetOperationDetailCallable(GetOperationDetailRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::GetOperationDetail, Aws::Client::RejectedCallOutcome<GetOperationDetailOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::GetOperationDetailAsync(const GetOperationDetailRequest& request, const GetOperationDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::GetOperationDetailAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::GetOperationDetailAsyncHelper, Aws::Client::RejectedAsyncCall<GetOperationDetailOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::GetOperationDetailAsync(GetOperationDetailRequest&& request, const GetOperationDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::GetOperationDetailAsyncHelper, Aws::Client::RejectedAsyncCall<GetOperationDetailOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::GetOperationDetailAsyncHelper(const GetOperationDetailRequest& request, const GetOperationDetailResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -373,12 +453,22 @@ ListDomainsOutcome Route53DomainsClient::ListDomains(const ListDomainsRequest& r
 
 ListDomainsOutcomeCallable Route53DomainsClient::ListDomainsCallable(const ListDomainsRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::ListDomains, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::ListDomains, Aws::Client::RejectedCallOutcome<ListDomainsOutcome>(), this, request);
+}
+
+ListDomainsOutcomeCallable Route53DomainsClient::ListDomainsCallable(ListDomainsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::ListDomains, Aws::Client::RejectedCallOutcome<ListDomainsOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::ListDomainsAsync(const ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::ListDomainsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::ListDomainsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDomainsOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::ListDomainsAsync(ListDomainsRequest&& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::ListDomainsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDomainsOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::ListDomainsAsyncHelper(const ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -404,12 +494,22 @@ ListOperationsOutcome Route53DomainsClient::ListOperations(const ListOperationsR
 
 ListOperationsOutcomeCallable Route53DomainsClient::ListOperationsCallable(const ListOperationsRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::ListOperations, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::ListOperations, Aws::Client::RejectedCallOutcome<ListOperationsOutcome>(), this, request);
+}
+
+ListOperationsOutcomeCallable Route53DomainsClient::ListOperationsCallable(ListOperationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::ListOperations, Aws::Client::RejectedCallOutcome<ListOperationsOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::ListOperationsAsync(const ListOperationsRequest& request, const ListOperationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::ListOperationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::ListOperationsAsyncHelper, Aws::Client::RejectedAsyncCall<ListOperationsOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::ListOperationsAsync(ListOperationsRequest&& request, const ListOperationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::ListOperationsAsyncHelper, Aws::Client::RejectedAsyncCall<ListOperationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::ListOperationsAsyncHelper(const ListOperationsRequest& request, const ListOperationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -435,12 +535,22 @@ ListTagsForDomainOutcome Route53DomainsClient::ListTagsForDomain(const ListTagsF
 
 ListTagsForDomainOutcomeCallable Route53DomainsClient::ListTagsForDomainCallable(const ListTagsForDomainRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::ListTagsForDomain, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::ListTagsForDomain, Aws::Client::RejectedCallOutcome<ListTagsForDomainOutcome>(), this, request);
+}
+
+ListTagsForDomainOutcomeCallable Route53DomainsClient::ListTagsForDomainCallable(ListTagsForDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::ListTagsForDomain, Aws::Client::RejectedCallOutcome<ListTagsForDomainOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::ListTagsForDomainAsync(const ListTagsForDomainRequest& request, const ListTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::ListTagsForDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::ListTagsForDomainAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForDomainOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::ListTagsForDomainAsync(ListTagsForDomainRequest&& request, const ListTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::ListTagsForDomainAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::ListTagsForDomainAsyncHelper(const ListTagsForDomainRequest& request, const ListTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -466,12 +576,22 @@ RegisterDomainOutcome Route53DomainsClient::RegisterDomain(const RegisterDomainR
 
 RegisterDomainOutcomeCallable Route53DomainsClient::RegisterDomainCallable(const RegisterDomainRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::RegisterDomain, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::RegisterDomain, Aws::Client::RejectedCallOutcome<RegisterDomainOutcome>(), this, request);
+}
+
+RegisterDomainOutcomeCallable Route53DomainsClient::RegisterDomainCallable(RegisterDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::RegisterDomain, Aws::Client::RejectedCallOutcome<RegisterDomainOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::RegisterDomainAsync(const RegisterDomainRequest& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::RegisterDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::RegisterDomainAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterDomainOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::RegisterDomainAsync(RegisterDomainRequest&& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::RegisterDomainAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::RegisterDomainAsyncHelper(const RegisterDomainRequest& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -497,12 +617,22 @@ RetrieveDomainAuthCodeOutcome Route53DomainsClient::RetrieveDomainAuthCode(const
 
 RetrieveDomainAuthCodeOutcomeCallable Route53DomainsClient::RetrieveDomainAuthCodeCallable(const RetrieveDomainAuthCodeRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::RetrieveDomainAuthCode, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::RetrieveDomainAuthCode, Aws::Client::RejectedCallOutcome<RetrieveDomainAuthCodeOutcome>(), this, request);
+}
+
+RetrieveDomainAuthCodeOutcomeCallable Route53DomainsClient::RetrieveDomainAuthCodeCallable(RetrieveDomainAuthCodeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::RetrieveDomainAuthCode, Aws::Client::RejectedCallOutcome<RetrieveDomainAuthCodeOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::RetrieveDomainAuthCodeAsync(const RetrieveDomainAuthCodeRequest& request, const RetrieveDomainAuthCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::RetrieveDomainAuthCodeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::RetrieveDomainAuthCodeAsyncHelper, Aws::Client::RejectedAsyncCall<RetrieveDomainAuthCodeOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::RetrieveDomainAuthCodeAsync(RetrieveDomainAuthCodeRequest&& request, const RetrieveDomainAuthCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::RetrieveDomainAuthCodeAsyncHelper, Aws::Client::RejectedAsyncCall<RetrieveDomainAuthCodeOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::RetrieveDomainAuthCodeAsyncHelper(const RetrieveDomainAuthCodeRequest& request, const RetrieveDomainAuthCodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -528,12 +658,22 @@ TransferDomainOutcome Route53DomainsClient::TransferDomain(const TransferDomainR
 
 TransferDomainOutcomeCallable Route53DomainsClient::TransferDomainCallable(const TransferDomainRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::TransferDomain, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::TransferDomain, Aws::Client::RejectedCallOutcome<TransferDomainOutcome>(), this, request);
+}
+
+TransferDomainOutcomeCallable Route53DomainsClient::TransferDomainCallable(TransferDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::TransferDomain, Aws::Client::RejectedCallOutcome<TransferDomainOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::TransferDomainAsync(const TransferDomainRequest& request, const TransferDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::TransferDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::TransferDomainAsyncHelper, Aws::Client::RejectedAsyncCall<TransferDomainOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::TransferDomainAsync(TransferDomainRequest&& request, const TransferDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::TransferDomainAsyncHelper, Aws::Client::RejectedAsyncCall<TransferDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::TransferDomainAsyncHelper(const TransferDomainRequest& request, const TransferDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -559,12 +699,22 @@ UpdateDomainContactOutcome Route53DomainsClient::UpdateDomainContact(const Updat
 
 UpdateDomainContactOutcomeCallable Route53DomainsClient::UpdateDomainContactCallable(const UpdateDomainContactRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::UpdateDomainContact, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::UpdateDomainContact, Aws::Client::RejectedCallOutcome<UpdateDomainContactOutcome>(), this, request);
+}
+
+UpdateDomainContactOutcomeCallable Route53DomainsClient::UpdateDomainContactCallable(UpdateDomainContactRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::UpdateDomainContact, Aws::Client::RejectedCallOutcome<UpdateDomainContactOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::UpdateDomainContactAsync(const UpdateDomainContactRequest& request, const UpdateDomainContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::UpdateDomainContactAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::UpdateDomainContactAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDomainContactOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::UpdateDomainContactAsync(UpdateDomainContactRequest&& request, const UpdateDomainContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::UpdateDomainContactAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDomainContactOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::UpdateDomainContactAsyncHelper(const UpdateDomainContactRequest& request, const UpdateDomainContactResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -590,12 +740,22 @@ UpdateDomainContactPrivacyOutcome Route53DomainsClient::UpdateDomainContactPriva
 
 UpdateDomainContactPrivacyOutcomeCallable Route53DomainsClient::UpdateDomainContactPrivacyCallable(const UpdateDomainContactPrivacyRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::UpdateDomainContactPrivacy, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::UpdateDomainContactPrivacy, Aws::Client::RejectedCallOutcome<UpdateDomainContactPrivacyOutcome>(), this, request);
+}
+
+UpdateDomainContactPrivacyOutcomeCallable Route53DomainsClient::UpdateDomainContactPrivacyCallable(UpdateDomainContactPrivacyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::UpdateDomainContactPrivacy, Aws::Client::RejectedCallOutcome<UpdateDomainContactPrivacyOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::UpdateDomainContactPrivacyAsync(const UpdateDomainContactPrivacyRequest& request, const UpdateDomainContactPrivacyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::UpdateDomainContactPrivacyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::UpdateDomainContactPrivacyAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDomainContactPrivacyOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::UpdateDomainContactPrivacyAsync(UpdateDomainContactPrivacyRequest&& request, const UpdateDomainContactPrivacyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::UpdateDomainContactPrivacyAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDomainContactPrivacyOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::UpdateDomainContactPrivacyAsyncHelper(const UpdateDomainContactPrivacyRequest& request, const UpdateDomainContactPrivacyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -621,12 +781,22 @@ UpdateDomainNameserversOutcome Route53DomainsClient::UpdateDomainNameservers(con
 
 UpdateDomainNameserversOutcomeCallable Route53DomainsClient::UpdateDomainNameserversCallable(const UpdateDomainNameserversRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::UpdateDomainNameservers, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::UpdateDomainNameservers, Aws::Client::RejectedCallOutcome<UpdateDomainNameserversOutcome>(), this, request);
+}
+
+UpdateDomainNameserversOutcomeCallable Route53DomainsClient::UpdateDomainNameserversCallable(UpdateDomainNameserversRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::UpdateDomainNameservers, Aws::Client::RejectedCallOutcome<UpdateDomainNameserversOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::UpdateDomainNameserversAsync(const UpdateDomainNameserversRequest& request, const UpdateDomainNameserversResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::UpdateDomainNameserversAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::UpdateDomainNameserversAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDomainNameserversOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::UpdateDomainNameserversAsync(UpdateDomainNameserversRequest&& request, const UpdateDomainNameserversResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::UpdateDomainNameserversAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateDomainNameserversOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::UpdateDomainNameserversAsyncHelper(const UpdateDomainNameserversRequest& request, const UpdateDomainNameserversResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -652,12 +822,22 @@ UpdateTagsForDomainOutcome Route53DomainsClient::UpdateTagsForDomain(const Updat
 
 UpdateTagsForDomainOutcomeCallable Route53DomainsClient::UpdateTagsForDomainCallable(const UpdateTagsForDomainRequest& request) const
 {
-  return std::async(std::launch::async, &Route53DomainsClient::UpdateTagsForDomain, this, request);
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::UpdateTagsForDomain, Aws::Client::RejectedCallOutcome<UpdateTagsForDomainOutcome>(), this, request);
+}
+
+UpdateTagsForDomainOutcomeCallable Route53DomainsClient::UpdateTagsForDomainCallable(UpdateTagsForDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&Route53DomainsClient::UpdateTagsForDomain, Aws::Client::RejectedCallOutcome<UpdateTagsForDomainOutcome>(), this, std::move(request));
 }
 
 void Route53DomainsClient::UpdateTagsForDomainAsync(const UpdateTagsForDomainRequest& request, const UpdateTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&Route53DomainsClient::UpdateTagsForDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&Route53DomainsClient::UpdateTagsForDomainAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateTagsForDomainOutcome>(), this, request, handler, context);
+}
+
+void Route53DomainsClient::UpdateTagsForDomainAsync(UpdateTagsForDomainRequest&& request, const UpdateTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&Route53DomainsClient::UpdateTagsForDomainAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateTagsForDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void Route53DomainsClient::UpdateTagsForDomainAsyncHelper(const UpdateTagsForDomainRequest& request, const UpdateTagsForDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -56,6 +56,61 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/s3/model/AbortMultipartUploadRequest.h>
+#include <aws/s3/model/CompleteMultipartUploadRequest.h>
+#include <aws/s3/model/CopyObjectRequest.h>
+#include <aws/s3/model/CreateBucketRequest.h>
+#include <aws/s3/model/CreateMultipartUploadRequest.h>
+#include <aws/s3/model/DeleteBucketRequest.h>
+#include <aws/s3/model/DeleteBucketCorsRequest.h>
+#include <aws/s3/model/DeleteBucketLifecycleRequest.h>
+#include <aws/s3/model/DeleteBucketPolicyRequest.h>
+#include <aws/s3/model/DeleteBucketReplicationRequest.h>
+#include <aws/s3/model/DeleteBucketTaggingRequest.h>
+#include <aws/s3/model/DeleteBucketWebsiteRequest.h>
+#include <aws/s3/model/DeleteObjectRequest.h>
+#include <aws/s3/model/DeleteObjectsRequest.h>
+#include <aws/s3/model/GetBucketAclRequest.h>
+#include <aws/s3/model/GetBucketCorsRequest.h>
+#include <aws/s3/model/GetBucketLifecycleConfigurationRequest.h>
+#include <aws/s3/model/GetBucketLocationRequest.h>
+#include <aws/s3/model/GetBucketLoggingRequest.h>
+#include <aws/s3/model/GetBucketNotificationConfigurationRequest.h>
+#include <aws/s3/model/GetBucketPolicyRequest.h>
+#include <aws/s3/model/GetBucketReplicationRequest.h>
+#include <aws/s3/model/GetBucketRequestPaymentRequest.h>
+#include <aws/s3/model/GetBucketTaggingRequest.h>
+#include <aws/s3/model/GetBucketVersioningRequest.h>
+#include <aws/s3/model/GetBucketWebsiteRequest.h>
+#include <aws/s3/model/GetObjectRequest.h>
+#include <aws/s3/model/GetObjectAclRequest.h>
+#include <aws/s3/model/GetObjectTorrentRequest.h>
+#include <aws/s3/model/HeadBucketRequest.h>
+#include <aws/s3/model/HeadObjectRequest.h>
+#include <aws/s3/model/ListMultipartUploadsRequest.h>
+#include <aws/s3/model/ListObjectVersionsRequest.h>
+#include <aws/s3/model/ListObjectsRequest.h>
+#include <aws/s3/model/ListPartsRequest.h>
+#include <aws/s3/model/PutBucketAclRequest.h>
+#include <aws/s3/model/PutBucketCorsRequest.h>
+#include <aws/s3/model/PutBucketLifecycleConfigurationRequest.h>
+#include <aws/s3/model/PutBucketLoggingRequest.h>
+#include <aws/s3/model/PutBucketNotificationConfigurationRequest.h>
+#include <aws/s3/model/PutBucketPolicyRequest.h>
+#include <aws/s3/model/PutBucketReplicationRequest.h>
+#include <aws/s3/model/PutBucketRequestPaymentRequest.h>
+#include <aws/s3/model/PutBucketTaggingRequest.h>
+#include <aws/s3/model/PutBucketVersioningRequest.h>
+#include <aws/s3/model/PutBucketWebsiteRequest.h>
+#include <aws/s3/model/PutObjectRequest.h>
+#include <aws/s3/model/PutObjectAclRequest.h>
+#include <aws/s3/model/RestoreObjectRequest.h>
+#include <aws/s3/model/UploadPartRequest.h>
+#include <aws/s3/model/UploadPartCopyRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -358,6 +413,11 @@ namespace Aws
          */
         virtual Model::AbortMultipartUploadOutcomeCallable AbortMultipartUploadCallable(const Model::AbortMultipartUploadRequest& request) const;
 
+        /**
+         * Same as AbortMultipartUploadCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AbortMultipartUploadOutcomeCallable AbortMultipartUploadCallable(Model::AbortMultipartUploadRequest&& request) const;
+
         /**
          * <p>Aborts a multipart upload.</p><p>To verify that all parts have been removed,
          * so you don't get charged for the part storage, you should call the List Parts
@@ -367,6 +427,11 @@ namespace Aws
          */
         virtual void AbortMultipartUploadAsync(const Model::AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AbortMultipartUploadAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AbortMultipartUploadAsync(Model::AbortMultipartUploadRequest&& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Completes a multipart upload by assembling previously uploaded parts.
          */
@@ -379,6 +444,11 @@ namespace Aws
          */
         virtual Model::CompleteMultipartUploadOutcomeCallable CompleteMultipartUploadCallable(const Model::CompleteMultipartUploadRequest& request) const;
 
+        /**
+         * Same as CompleteMultipartUploadCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CompleteMultipartUploadOutcomeCallable CompleteMultipartUploadCallable(Model::CompleteMultipartUploadRequest&& request) const;
+
         /**
          * Completes a multipart upload by assembling previously uploaded parts.
          *
@@ -386,6 +456,11 @@ namespace Aws
          */
         virtual void CompleteMultipartUploadAsync(const Model::CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CompleteMultipartUploadAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CompleteMultipartUploadAsync(Model::CompleteMultipartUploadRequest&& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Creates a copy of an object that is already stored in Amazon S3.
          */
@@ -398,6 +473,11 @@ namespace Aws
          */
         virtual Model::CopyObjectOutcomeCallable CopyObjectCallable(const Model::CopyObjectRequest& request) const;
 
+        /**
+         * Same as CopyObjectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CopyObjectOutcomeCallable CopyObjectCallable(Model::CopyObjectRequest&& request) const;
+
         /**
          * Creates a copy of an object that is already stored in Amazon S3.
          *
@@ -405,6 +485,11 @@ namespace Aws
          */
         virtual void CopyObjectAsync(const Model::CopyObjectRequest& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CopyObjectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CopyObjectAsync(Model::CopyObjectRequest&& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Creates a new bucket.
          */
@@ -417,6 +502,11 @@ namespace Aws
          */
         virtual Model::CreateBucketOutcomeCallable CreateBucketCallable(const Model::CreateBucketRequest& request) const;
 
+        /**
+         * Same as CreateBucketCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateBucketOutcomeCallable CreateBucketCallable(Model::CreateBucketRequest&& request) const;
+
         /**
          * Creates a new bucket.
          *
@@ -424,6 +514,11 @@ namespace Aws
          */
         virtual void CreateBucketAsync(const Model::CreateBucketRequest& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateBucketAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateBucketAsync(Model::CreateBucketRequest&& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Initiates a multipart upload and returns an upload ID.</p><p><b>Note:</b>
          * After you initiate multipart upload and upload one or more parts, you must
@@ -446,6 +541,11 @@ namespace Aws
          */
         virtual Model::CreateMultipartUploadOutcomeCallable CreateMultipartUploadCallable(const Model::CreateMultipartUploadRequest& request) const;
 
+        /**
+         * Same as CreateMultipartUploadCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateMultipartUploadOutcomeCallable CreateMultipartUploadCallable(Model::CreateMultipartUploadRequest&& request) const;
+
         /**
          * <p>Initiates a multipart upload and returns an upload ID.</p><p><b>Note:</b>
          * After you initiate multipart upload and upload one or more parts, you must
@@ -458,6 +558,11 @@ namespace Aws
          */
         virtual void CreateMultipartUploadAsync(const Model::CreateMultipartUploadRequest& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateMultipartUploadAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateMultipartUploadAsync(Model::CreateMultipartUploadRequest&& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Deletes the bucket. All objects (including all object versions and Delete
          * Markers) in the bucket must be deleted before the bucket itself can be deleted.
@@ -472,6 +577,11 @@ namespace Aws
          */
         virtual Model::DeleteBucketOutcomeCallable DeleteBucketCallable(const Model::DeleteBucketRequest& request) const;
 
+        /**
+         * Same as DeleteBucketCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteBucketOutcomeCallable DeleteBucketCallable(Model::DeleteBucketRequest&& request) const;
+
         /**
          * Deletes the bucket. All objects (including all object versions and Delete
          * Markers) in the bucket must be deleted before the bucket itself can be deleted.
@@ -480,6 +590,11 @@ namespace Aws
          */
         virtual void DeleteBucketAsync(const Model::DeleteBucketRequest& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBucketAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteBucketAsync(Model::DeleteBucketRequest&& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Deletes the cors configuration information set for the bucket.
          */
@@ -492,6 +607,11 @@ namespace Aws
          */
         virtual Model::DeleteBucketCorsOutcomeCallable DeleteBucketCorsCallable(const Model::DeleteBucketCorsRequest& request) const;
 
+        /**
+         * Same as DeleteBucketCorsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteBucketCorsOutcomeCallable DeleteBucketCorsCallable(Model::DeleteBucketCorsRequest&& request) const;
+
         /**
          * Deletes the cors configuration information set for the bucket.
          *
@@ -499,6 +619,11 @@ namespace Aws
          */
         virtual void DeleteBucketCorsAsync(const Model::DeleteBucketCorsRequest& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBucketCorsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteBucketCorsAsync(Model::DeleteBucketCorsRequest&& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Deletes the lifecycle configuration from the bucket.
          */
@@ -511,6 +636,11 @@ namespace Aws
          */
         virtual Model::DeleteBucketLifecycleOutcomeCallable DeleteBucketLifecycleCallable(const Model::DeleteBucketLifecycleRequest& request) const;
 
+        /**
+         * Same as DeleteBucketLifecycleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteBucketLifecycleOutcomeCallable DeleteBucketLifecycleCallable(Model::DeleteBucketLifecycleRequest&& request) const;
+
         /**
          * Deletes the lifecycle configuration from the bucket.
          *
@@ -518,6 +648,11 @@ namespace Aws
          */
         virtual void DeleteBucketLifecycleAsync(const Model::DeleteBucketLifecycleRequest& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBucketLifecycleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteBucketLifecycleAsync(Model::DeleteBucketLifecycleRequest&& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Deletes the policy from the bucket.
          */
@@ -530,6 +665,11 @@ namespace Aws
          */
         virtual Model::DeleteBucketPolicyOutcomeCallable DeleteBucketPolicyCallable(const Model::DeleteBucketPolicyRequest& request) const;
 
+        /**
+         * Same as DeleteBucketPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteBucketPolicyOutcomeCallable DeleteBucketPolicyCallable(Model::DeleteBucketPolicyRequest&& request) const;
+
         /**
          * Deletes the policy from the bucket.
          *
@@ -537,6 +677,11 @@ namespace Aws
          */
         virtual void DeleteBucketPolicyAsync(const Model::DeleteBucketPolicyRequest& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBucketPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteBucketPolicyAsync(Model::DeleteBucketPolicyRequest&& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Deletes the replication configuration for the given Amazon S3 bucket.
          */
@@ -549,6 +694,11 @@ namespace Aws
          */
         virtual Model::DeleteBucketReplicationOutcomeCallable DeleteBucketReplicationCallable(const Model::DeleteBucketReplicationRequest& request) const;
 
+        /**
+         * Same as DeleteBucketReplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteBucketReplicationOutcomeCallable DeleteBucketReplicationCallable(Model::DeleteBucketReplicationRequest&& request) const;
+
         /**
          * Deletes the replication configuration for the given Amazon S3 bucket.
          *
@@ -556,6 +706,11 @@ namespace Aws
          */
         virtual void DeleteBucketReplicationAsync(const Model::DeleteBucketReplicationRequest& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBucketReplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteBucketReplicationAsync(Model::DeleteBucketReplicationRequest&& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Deletes the tags from the bucket.
          */
@@ -568,6 +723,11 @@ namespace Aws
          */
         virtual Model::DeleteBucketTaggingOutcomeCallable DeleteBucketTaggingCallable(const Model::DeleteBucketTaggingRequest& request) const;
 
+        /**
+         * Same as DeleteBucketTaggingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteBucketTaggingOutcomeCallable DeleteBucketTaggingCallable(Model::DeleteBucketTaggingRequest&& request) const;
+
         /**
          * Deletes the tags from the bucket.
          *
@@ -575,6 +735,11 @@ namespace Aws
          */
         virtual void DeleteBucketTaggingAsync(const Model::DeleteBucketTaggingRequest& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBucketTaggingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteBucketTaggingAsync(Model::DeleteBucketTaggingRequest&& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * This operation removes the website configuration from the bucket.
          */
@@ -587,6 +752,11 @@ namespace Aws
          */
         virtual Model::DeleteBucketWebsiteOutcomeCallable DeleteBucketWebsiteCallable(const Model::DeleteBucketWebsiteRequest& request) const;
 
+        /**
+         * Same as DeleteBucketWebsiteCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteBucketWebsiteOutcomeCallable DeleteBucketWebsiteCallable(Model::DeleteBucketWebsiteRequest&& request) const;
+
         /**
          * This operation removes the website configuration from the bucket.
          *
@@ -594,6 +764,11 @@ namespace Aws
          */
         virtual void DeleteBucketWebsiteAsync(const Model::DeleteBucketWebsiteRequest& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBucketWebsiteAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteBucketWebsiteAsync(Model::DeleteBucketWebsiteRequest&& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Removes the null version (if there is one) of an object and inserts a delete
          * marker, which becomes the latest version of the object. If there isn't a null
@@ -610,6 +785,11 @@ namespace Aws
          */
         virtual Model::DeleteObjectOutcomeCallable DeleteObjectCallable(const Model::DeleteObjectRequest& request) const;
 
+        /**
+         * Same as DeleteObjectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteObjectOutcomeCallable DeleteObjectCallable(Model::DeleteObjectRequest&& request) const;
+
         /**
          * Removes the null version (if there is one) of an object and inserts a delete
          * marker, which becomes the latest version of the object. If there isn't a null
@@ -619,6 +799,11 @@ namespace Aws
          */
         virtual void DeleteObjectAsync(const Model::DeleteObjectRequest& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteObjectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteObjectAsync(Model::DeleteObjectRequest&& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * This operation enables you to delete multiple objects from a bucket using a
          * single HTTP request. You may specify up to 1000 keys.
@@ -633,6 +818,11 @@ namespace Aws
          */
         virtual Model::DeleteObjectsOutcomeCallable DeleteObjectsCallable(const Model::DeleteObjectsRequest& request) const;
 
+        /**
+         * Same as DeleteObjectsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteObjectsOutcomeCallable DeleteObjectsCallable(Model::DeleteObjectsRequest&& request) const;
+
         /**
          * This operation enables you to delete multiple objects from a bucket using a
          * single HTTP request. You may specify up to 1000 keys.
@@ -641,6 +831,11 @@ namespace Aws
          */
         virtual void DeleteObjectsAsync(const Model::DeleteObjectsRequest& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteObjectsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteObjectsAsync(Model::DeleteObjectsRequest&& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Gets the access control policy for the bucket.
          */
@@ -653,6 +848,11 @@ namespace Aws
          */
         virtual Model::GetBucketAclOutcomeCallable GetBucketAclCallable(const Model::GetBucketAclRequest& request) const;
 
+        /**
+         * Same as GetBucketAclCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBucketAclOutcomeCallable GetBucketAclCallable(Model::GetBucketAclRequest&& request) const;
+
         /**
          * Gets the access control policy for the bucket.
          *
@@ -660,6 +860,11 @@ namespace Aws
          */
         virtual void GetBucketAclAsync(const Model::GetBucketAclRequest& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketAclAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBucketAclAsync(Model::GetBucketAclRequest&& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the cors configuration for the bucket.
          */
@@ -672,6 +877,11 @@ namespace Aws
          */
         virtual Model::GetBucketCorsOutcomeCallable GetBucketCorsCallable(const Model::GetBucketCorsRequest& request) const;
 
+        /**
+         * Same as GetBucketCorsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBucketCorsOutcomeCallable GetBucketCorsCallable(Model::GetBucketCorsRequest&& request) const;
+
         /**
          * Returns the cors configuration for the bucket.
          *
@@ -679,6 +889,11 @@ namespace Aws
          */
         virtual void GetBucketCorsAsync(const Model::GetBucketCorsRequest& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketCorsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBucketCorsAsync(Model::GetBucketCorsRequest&& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the lifecycle configuration information set on the bucket.
          */
@@ -691,6 +906,11 @@ namespace Aws
          */
         virtual Model::GetBucketLifecycleConfigurationOutcomeCallable GetBucketLifecycleConfigurationCallable(const Model::GetBucketLifecycleConfigurationRequest& request) const;
 
+        /**
+         * Same as GetBucketLifecycleConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBucketLifecycleConfigurationOutcomeCallable GetBucketLifecycleConfigurationCallable(Model::GetBucketLifecycleConfigurationRequest&& request) const;
+
         /**
          * Returns the lifecycle configuration information set on the bucket.
          *
@@ -698,6 +918,11 @@ namespace Aws
          */
         virtual void GetBucketLifecycleConfigurationAsync(const Model::GetBucketLifecycleConfigurationRequest& request, const GetBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketLifecycleConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBucketLifecycleConfigurationAsync(Model::GetBucketLifecycleConfigurationRequest&& request, const GetBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the region the bucket resides in.
          */
@@ -710,6 +935,11 @@ namespace Aws
          */
         virtual Model::GetBucketLocationOutcomeCallable GetBucketLocationCallable(const Model::GetBucketLocationRequest& request) const;
 
+        /**
+         * Same as GetBucketLocationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBucketLocationOutcomeCallable GetBucketLocationCallable(Model::GetBucketLocationRequest&& request) const;
+
         /**
          * Returns the region the bucket resides in.
          *
@@ -717,6 +947,11 @@ namespace Aws
          */
         virtual void GetBucketLocationAsync(const Model::GetBucketLocationRequest& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketLocationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBucketLocationAsync(Model::GetBucketLocationRequest&& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the logging status of a bucket and the permissions users have to view
          * and modify that status. To use GET, you must be the bucket owner.
@@ -731,6 +966,11 @@ namespace Aws
          */
         virtual Model::GetBucketLoggingOutcomeCallable GetBucketLoggingCallable(const Model::GetBucketLoggingRequest& request) const;
 
+        /**
+         * Same as GetBucketLoggingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBucketLoggingOutcomeCallable GetBucketLoggingCallable(Model::GetBucketLoggingRequest&& request) const;
+
         /**
          * Returns the logging status of a bucket and the permissions users have to view
          * and modify that status. To use GET, you must be the bucket owner.
@@ -739,6 +979,11 @@ namespace Aws
          */
         virtual void GetBucketLoggingAsync(const Model::GetBucketLoggingRequest& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketLoggingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBucketLoggingAsync(Model::GetBucketLoggingRequest&& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the notification configuration of a bucket.
          */
@@ -751,6 +996,11 @@ namespace Aws
          */
         virtual Model::GetBucketNotificationConfigurationOutcomeCallable GetBucketNotificationConfigurationCallable(const Model::GetBucketNotificationConfigurationRequest& request) const;
 
+        /**
+         * Same as GetBucketNotificationConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBucketNotificationConfigurationOutcomeCallable GetBucketNotificationConfigurationCallable(Model::GetBucketNotificationConfigurationRequest&& request) const;
+
         /**
          * Returns the notification configuration of a bucket.
          *
@@ -758,6 +1008,11 @@ namespace Aws
          */
         virtual void GetBucketNotificationConfigurationAsync(const Model::GetBucketNotificationConfigurationRequest& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketNotificationConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBucketNotificationConfigurationAsync(Model::GetBucketNotificationConfigurationRequest&& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the policy of a specified bucket.
          */
@@ -770,6 +1025,11 @@ namespace Aws
          */
         virtual Model::GetBucketPolicyOutcomeCallable GetBucketPolicyCallable(const Model::GetBucketPolicyRequest& request) const;
 
+        /**
+         * Same as GetBucketPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBucketPolicyOutcomeCallable GetBucketPolicyCallable(Model::GetBucketPolicyRequest&& request) const;
+
         /**
          * Returns the policy of a specified bucket.
          *
@@ -777,6 +1037,11 @@ namespace Aws
          */
         virtual void GetBucketPolicyAsync(const Model::GetBucketPolicyRequest& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBucketPolicyAsync(Model::GetBucketPolicyRequest&& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Retrieves the replication configuration for the given Amazon S3 bucket.
          */
@@ -789,6 +1054,11 @@ namespace Aws
          */
         virtual Model::GetBucketReplicationOutcomeCallable GetBucketReplicationCallable(const Model::GetBucketReplicationRequest& request) const;
 
+        /**
+         * Same as GetBucketReplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBucketReplicationOutcomeCallable GetBucketReplicationCallable(Model::GetBucketReplicationRequest&& request) const;
+
         /**
          * Retrieves the replication configuration for the given Amazon S3 bucket.
          *
@@ -796,6 +1066,11 @@ namespace Aws
          */
         virtual void GetBucketReplicationAsync(const Model::GetBucketReplicationRequest& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketReplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBucketReplicationAsync(Model::GetBucketReplicationRequest&& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the request payment configuration of a bucket.
          */
@@ -808,6 +1083,11 @@ namespace Aws
          */
         virtual Model::GetBucketRequestPaymentOutcomeCallable GetBucketRequestPaymentCallable(const Model::GetBucketRequestPaymentRequest& request) const;
 
+        /**
+         * Same as GetBucketRequestPaymentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBucketRequestPaymentOutcomeCallable GetBucketRequestPaymentCallable(Model::GetBucketRequestPaymentRequest&& request) const;
+
         /**
          * Returns the request payment configuration of a bucket.
          *
@@ -815,6 +1095,11 @@ namespace Aws
          */
         virtual void GetBucketRequestPaymentAsync(const Model::GetBucketRequestPaymentRequest& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketRequestPaymentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBucketRequestPaymentAsync(Model::GetBucketRequestPaymentRequest&& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the tag set associated with the bucket.
          */
@@ -827,6 +1112,11 @@ namespace Aws
          */
         virtual Model::GetBucketTaggingOutcomeCallable GetBucketTaggingCallable(const Model::GetBucketTaggingRequest& request) const;
 
+        /**
+         * Same as GetBucketTaggingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBucketTaggingOutcomeCallable GetBucketTaggingCallable(Model::GetBucketTaggingRequest&& request) const;
+
         /**
          * Returns the tag set associated with the bucket.
          *
@@ -834,6 +1124,11 @@ namespace Aws
          */
         virtual void GetBucketTaggingAsync(const Model::GetBucketTaggingRequest& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketTaggingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBucketTaggingAsync(Model::GetBucketTaggingRequest&& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the versioning state of a bucket.
          */
@@ -846,6 +1141,11 @@ namespace Aws
          */
         virtual Model::GetBucketVersioningOutcomeCallable GetBucketVersioningCallable(const Model::GetBucketVersioningRequest& request) const;
 
+        /**
+         * Same as GetBucketVersioningCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBucketVersioningOutcomeCallable GetBucketVersioningCallable(Model::GetBucketVersioningRequest&& request) const;
+
         /**
          * Returns the versioning state of a bucket.
          *
@@ -853,6 +1153,11 @@ namespace Aws
          */
         virtual void GetBucketVersioningAsync(const Model::GetBucketVersioningRequest& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketVersioningAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBucketVersioningAsync(Model::GetBucketVersioningRequest&& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the website configuration for a bucket.
          */
@@ -865,6 +1170,11 @@ namespace Aws
          */
         virtual Model::GetBucketWebsiteOutcomeCallable GetBucketWebsiteCallable(const Model::GetBucketWebsiteRequest& request) const;
 
+        /**
+         * Same as GetBucketWebsiteCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetBucketWebsiteOutcomeCallable GetBucketWebsiteCallable(Model::GetBucketWebsiteRequest&& request) const;
+
         /**
          * Returns the website configuration for a bucket.
          *
@@ -872,6 +1182,11 @@ namespace Aws
          */
         virtual void GetBucketWebsiteAsync(const Model::GetBucketWebsiteRequest& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetBucketWebsiteAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetBucketWebsiteAsync(Model::GetBucketWebsiteRequest&& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Retrieves objects from Amazon S3.
          */
@@ -884,6 +1199,11 @@ namespace Aws
          */
         virtual Model::GetObjectOutcomeCallable GetObjectCallable(const Model::GetObjectRequest& request) const;
 
+        /**
+         * Same as GetObjectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetObjectOutcomeCallable GetObjectCallable(Model::GetObjectRequest&& request) const;
+
         /**
          * Retrieves objects from Amazon S3.
          *
@@ -891,6 +1211,11 @@ namespace Aws
          */
         virtual void GetObjectAsync(const Model::GetObjectRequest& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetObjectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetObjectAsync(Model::GetObjectRequest&& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns the access control list (ACL) of an object.
          */
@@ -903,6 +1228,11 @@ namespace Aws
          */
         virtual Model::GetObjectAclOutcomeCallable GetObjectAclCallable(const Model::GetObjectAclRequest& request) const;
 
+        /**
+         * Same as GetObjectAclCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetObjectAclOutcomeCallable GetObjectAclCallable(Model::GetObjectAclRequest&& request) const;
+
         /**
          * Returns the access control list (ACL) of an object.
          *
@@ -910,6 +1240,11 @@ namespace Aws
          */
         virtual void GetObjectAclAsync(const Model::GetObjectAclRequest& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetObjectAclAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetObjectAclAsync(Model::GetObjectAclRequest&& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Return torrent files from a bucket.
          */
@@ -922,6 +1257,11 @@ namespace Aws
          */
         virtual Model::GetObjectTorrentOutcomeCallable GetObjectTorrentCallable(const Model::GetObjectTorrentRequest& request) const;
 
+        /**
+         * Same as GetObjectTorrentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetObjectTorrentOutcomeCallable GetObjectTorrentCallable(Model::GetObjectTorrentRequest&& request) const;
+
         /**
          * Return torrent files from a bucket.
          *
@@ -929,6 +1269,11 @@ namespace Aws
          */
         virtual void GetObjectTorrentAsync(const Model::GetObjectTorrentRequest& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetObjectTorrentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetObjectTorrentAsync(Model::GetObjectTorrentRequest&& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * This operation is useful to determine if a bucket exists and you have permission
          * to access it.
@@ -943,6 +1288,11 @@ namespace Aws
          */
         virtual Model::HeadBucketOutcomeCallable HeadBucketCallable(const Model::HeadBucketRequest& request) const;
 
+        /**
+         * Same as HeadBucketCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::HeadBucketOutcomeCallable HeadBucketCallable(Model::HeadBucketRequest&& request) const;
+
         /**
          * This operation is useful to determine if a bucket exists and you have permission
          * to access it.
@@ -951,6 +1301,11 @@ namespace Aws
          */
         virtual void HeadBucketAsync(const Model::HeadBucketRequest& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as HeadBucketAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void HeadBucketAsync(Model::HeadBucketRequest&& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * The HEAD operation retrieves metadata from an object without returning the
          * object itself. This operation is useful if you're only interested in an object's
@@ -967,6 +1322,11 @@ namespace Aws
          */
         virtual Model::HeadObjectOutcomeCallable HeadObjectCallable(const Model::HeadObjectRequest& request) const;
 
+        /**
+         * Same as HeadObjectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::HeadObjectOutcomeCallable HeadObjectCallable(Model::HeadObjectRequest&& request) const;
+
         /**
          * The HEAD operation retrieves metadata from an object without returning the
          * object itself. This operation is useful if you're only interested in an object's
@@ -976,6 +1336,11 @@ namespace Aws
          */
         virtual void HeadObjectAsync(const Model::HeadObjectRequest& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as HeadObjectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void HeadObjectAsync(Model::HeadObjectRequest&& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns a list of all buckets owned by the authenticated sender of the request.
          */
@@ -1006,6 +1371,11 @@ namespace Aws
          */
         virtual Model::ListMultipartUploadsOutcomeCallable ListMultipartUploadsCallable(const Model::ListMultipartUploadsRequest& request) const;
 
+        /**
+         * Same as ListMultipartUploadsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListMultipartUploadsOutcomeCallable ListMultipartUploadsCallable(Model::ListMultipartUploadsRequest&& request) const;
+
         /**
          * This operation lists in-progress multipart uploads.
          *
@@ -1013,6 +1383,11 @@ namespace Aws
          */
         virtual void ListMultipartUploadsAsync(const Model::ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListMultipartUploadsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListMultipartUploadsAsync(Model::ListMultipartUploadsRequest&& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns metadata about all of the versions of objects in a bucket.
          */
@@ -1025,6 +1400,11 @@ namespace Aws
          */
         virtual Model::ListObjectVersionsOutcomeCallable ListObjectVersionsCallable(const Model::ListObjectVersionsRequest& request) const;
 
+        /**
+         * Same as ListObjectVersionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListObjectVersionsOutcomeCallable ListObjectVersionsCallable(Model::ListObjectVersionsRequest&& request) const;
+
         /**
          * Returns metadata about all of the versions of objects in a bucket.
          *
@@ -1032,6 +1412,11 @@ namespace Aws
          */
         virtual void ListObjectVersionsAsync(const Model::ListObjectVersionsRequest& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListObjectVersionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListObjectVersionsAsync(Model::ListObjectVersionsRequest&& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Returns some or all (up to 1000) of the objects in a bucket. You can use the
          * request parameters as selection criteria to return a subset of the objects in a
@@ -1048,6 +1433,11 @@ namespace Aws
          */
         virtual Model::ListObjectsOutcomeCallable ListObjectsCallable(const Model::ListObjectsRequest& request) const;
 
+        /**
+         * Same as ListObjectsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListObjectsOutcomeCallable ListObjectsCallable(Model::ListObjectsRequest&& request) const;
+
         /**
          * Returns some or all (up to 1000) of the objects in a bucket. You can use the
          * request parameters as selection criteria to return a subset of the objects in a
@@ -1057,6 +1447,11 @@ namespace Aws
          */
         virtual void ListObjectsAsync(const Model::ListObjectsRequest& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListObjectsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListObjectsAsync(Model::ListObjectsRequest&& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Lists the parts that have been uploaded for a specific multipart upload.
          */
@@ -1069,6 +1464,11 @@ namespace Aws
          */
         virtual Model::ListPartsOutcomeCallable ListPartsCallable(const Model::ListPartsRequest& request) const;
 
+        /**
+         * Same as ListPartsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListPartsOutcomeCallable ListPartsCallable(Model::ListPartsRequest&& request) const;
+
         /**
          * Lists the parts that have been uploaded for a specific multipart upload.
          *
@@ -1076,6 +1476,11 @@ namespace Aws
          */
         virtual void ListPartsAsync(const Model::ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPartsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListPartsAsync(Model::ListPartsRequest&& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Sets the permissions on a bucket using access control lists (ACL).
          */
@@ -1088,6 +1493,11 @@ namespace Aws
          */
         virtual Model::PutBucketAclOutcomeCallable PutBucketAclCallable(const Model::PutBucketAclRequest& request) const;
 
+        /**
+         * Same as PutBucketAclCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutBucketAclOutcomeCallable PutBucketAclCallable(Model::PutBucketAclRequest&& request) const;
+
         /**
          * Sets the permissions on a bucket using access control lists (ACL).
          *
@@ -1095,6 +1505,11 @@ namespace Aws
          */
         virtual void PutBucketAclAsync(const Model::PutBucketAclRequest& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketAclAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutBucketAclAsync(Model::PutBucketAclRequest&& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Sets the cors configuration for a bucket.
          */
@@ -1107,6 +1522,11 @@ namespace Aws
          */
         virtual Model::PutBucketCorsOutcomeCallable PutBucketCorsCallable(const Model::PutBucketCorsRequest& request) const;
 
+        /**
+         * Same as PutBucketCorsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutBucketCorsOutcomeCallable PutBucketCorsCallable(Model::PutBucketCorsRequest&& request) const;
+
         /**
          * Sets the cors configuration for a bucket.
          *
@@ -1114,6 +1534,11 @@ namespace Aws
          */
         virtual void PutBucketCorsAsync(const Model::PutBucketCorsRequest& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketCorsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutBucketCorsAsync(Model::PutBucketCorsRequest&& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Sets lifecycle configuration for your bucket. If a lifecycle configuration
          * exists, it replaces it.
@@ -1128,6 +1553,11 @@ namespace Aws
          */
         virtual Model::PutBucketLifecycleConfigurationOutcomeCallable PutBucketLifecycleConfigurationCallable(const Model::PutBucketLifecycleConfigurationRequest& request) const;
 
+        /**
+         * Same as PutBucketLifecycleConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutBucketLifecycleConfigurationOutcomeCallable PutBucketLifecycleConfigurationCallable(Model::PutBucketLifecycleConfigurationRequest&& request) const;
+
         /**
          * Sets lifecycle configuration for your bucket. If a lifecycle configuration
          * exists, it replaces it.
@@ -1136,6 +1566,11 @@ namespace Aws
          */
         virtual void PutBucketLifecycleConfigurationAsync(const Model::PutBucketLifecycleConfigurationRequest& request, const PutBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketLifecycleConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutBucketLifecycleConfigurationAsync(Model::PutBucketLifecycleConfigurationRequest&& request, const PutBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Set the logging parameters for a bucket and to specify permissions for who can
          * view and modify the logging parameters. To set the logging status of a bucket,
@@ -1152,6 +1587,11 @@ namespace Aws
          */
         virtual Model::PutBucketLoggingOutcomeCallable PutBucketLoggingCallable(const Model::PutBucketLoggingRequest& request) const;
 
+        /**
+         * Same as PutBucketLoggingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutBucketLoggingOutcomeCallable PutBucketLoggingCallable(Model::PutBucketLoggingRequest&& request) const;
+
         /**
          * Set the logging parameters for a bucket and to specify permissions for who can
          * view and modify the logging parameters. To set the logging status of a bucket,
@@ -1161,6 +1601,11 @@ namespace Aws
          */
         virtual void PutBucketLoggingAsync(const Model::PutBucketLoggingRequest& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketLoggingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutBucketLoggingAsync(Model::PutBucketLoggingRequest&& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Enables notifications of specified events for a bucket.
          */
@@ -1173,6 +1618,11 @@ namespace Aws
          */
         virtual Model::PutBucketNotificationConfigurationOutcomeCallable PutBucketNotificationConfigurationCallable(const Model::PutBucketNotificationConfigurationRequest& request) const;
 
+        /**
+         * Same as PutBucketNotificationConfigurationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutBucketNotificationConfigurationOutcomeCallable PutBucketNotificationConfigurationCallable(Model::PutBucketNotificationConfigurationRequest&& request) const;
+
         /**
          * Enables notifications of specified events for a bucket.
          *
@@ -1180,6 +1630,11 @@ namespace Aws
          */
         virtual void PutBucketNotificationConfigurationAsync(const Model::PutBucketNotificationConfigurationRequest& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketNotificationConfigurationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutBucketNotificationConfigurationAsync(Model::PutBucketNotificationConfigurationRequest&& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Replaces a policy on a bucket. If the bucket already has a policy, the one in
          * this request completely replaces it.
@@ -1194,6 +1649,11 @@ namespace Aws
          */
         virtual Model::PutBucketPolicyOutcomeCallable PutBucketPolicyCallable(const Model::PutBucketPolicyRequest& request) const;
 
+        /**
+         * Same as PutBucketPolicyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutBucketPolicyOutcomeCallable PutBucketPolicyCallable(Model::PutBucketPolicyRequest&& request) const;
+
         /**
          * Replaces a policy on a bucket. If the bucket already has a policy, the one in
          * this request completely replaces it.
@@ -1202,6 +1662,11 @@ namespace Aws
          */
         virtual void PutBucketPolicyAsync(const Model::PutBucketPolicyRequest& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketPolicyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutBucketPolicyAsync(Model::PutBucketPolicyRequest&& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Creates a new replication configuration (or replaces an existing one, if
          * present).
@@ -1216,6 +1681,11 @@ namespace Aws
          */
         virtual Model::PutBucketReplicationOutcomeCallable PutBucketReplicationCallable(const Model::PutBucketReplicationRequest& request) const;
 
+        /**
+         * Same as PutBucketReplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutBucketReplicationOutcomeCallable PutBucketReplicationCallable(Model::PutBucketReplicationRequest&& request) const;
+
         /**
          * Creates a new replication configuration (or replaces an existing one, if
          * present).
@@ -1224,6 +1694,11 @@ namespace Aws
          */
         virtual void PutBucketReplicationAsync(const Model::PutBucketReplicationRequest& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketReplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutBucketReplicationAsync(Model::PutBucketReplicationRequest&& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Sets the request payment configuration for a bucket. By default, the bucket
          * owner pays for downloads from the bucket. This configuration parameter enables
@@ -1246,6 +1721,11 @@ namespace Aws
          */
         virtual Model::PutBucketRequestPaymentOutcomeCallable PutBucketRequestPaymentCallable(const Model::PutBucketRequestPaymentRequest& request) const;
 
+        /**
+         * Same as PutBucketRequestPaymentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutBucketRequestPaymentOutcomeCallable PutBucketRequestPaymentCallable(Model::PutBucketRequestPaymentRequest&& request) const;
+
         /**
          * Sets the request payment configuration for a bucket. By default, the bucket
          * owner pays for downloads from the bucket. This configuration parameter enables
@@ -1258,6 +1738,11 @@ namespace Aws
          */
         virtual void PutBucketRequestPaymentAsync(const Model::PutBucketRequestPaymentRequest& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketRequestPaymentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutBucketRequestPaymentAsync(Model::PutBucketRequestPaymentRequest&& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Sets the tags for a bucket.
          */
@@ -1270,6 +1755,11 @@ namespace Aws
          */
         virtual Model::PutBucketTaggingOutcomeCallable PutBucketTaggingCallable(const Model::PutBucketTaggingRequest& request) const;
 
+        /**
+         * Same as PutBucketTaggingCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutBucketTaggingOutcomeCallable PutBucketTaggingCallable(Model::PutBucketTaggingRequest&& request) const;
+
         /**
          * Sets the tags for a bucket.
          *
@@ -1277,6 +1767,11 @@ namespace Aws
          */
         virtual void PutBucketTaggingAsync(const Model::PutBucketTaggingRequest& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketTaggingAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutBucketTaggingAsync(Model::PutBucketTaggingRequest&& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Sets the versioning state of an existing bucket. To set the versioning state,
          * you must be the bucket owner.
@@ -1291,6 +1786,11 @@ namespace Aws
          */
         virtual Model::PutBucketVersioningOutcomeCallable PutBucketVersioningCallable(const Model::PutBucketVersioningRequest& request) const;
 
+        /**
+         * Same as PutBucketVersioningCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutBucketVersioningOutcomeCallable PutBucketVersioningCallable(Model::PutBucketVersioningRequest&& request) const;
+
         /**
          * Sets the versioning state of an existing bucket. To set the versioning state,
          * you must be the bucket owner.
@@ -1299,6 +1799,11 @@ namespace Aws
          */
         virtual void PutBucketVersioningAsync(const Model::PutBucketVersioningRequest& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketVersioningAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutBucketVersioningAsync(Model::PutBucketVersioningRequest&& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Set the website configuration for a bucket.
          */
@@ -1311,6 +1816,11 @@ namespace Aws
          */
         virtual Model::PutBucketWebsiteOutcomeCallable PutBucketWebsiteCallable(const Model::PutBucketWebsiteRequest& request) const;
 
+        /**
+         * Same as PutBucketWebsiteCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutBucketWebsiteOutcomeCallable PutBucketWebsiteCallable(Model::PutBucketWebsiteRequest&& request) const;
+
         /**
          * Set the website configuration for a bucket.
          *
@@ -1318,6 +1828,11 @@ namespace Aws
          */
         virtual void PutBucketWebsiteAsync(const Model::PutBucketWebsiteRequest& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutBucketWebsiteAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutBucketWebsiteAsync(Model::PutBucketWebsiteRequest&& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Adds an object to a bucket.
          */
@@ -1330,6 +1845,11 @@ namespace Aws
          */
         virtual Model::PutObjectOutcomeCallable PutObjectCallable(const Model::PutObjectRequest& request) const;
 
+        /**
+         * Same as PutObjectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutObjectOutcomeCallable PutObjectCallable(Model::PutObjectRequest&& request) const;
+
         /**
          * Adds an object to a bucket.
          *
@@ -1337,6 +1857,11 @@ namespace Aws
          */
         virtual void PutObjectAsync(const Model::PutObjectRequest& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutObjectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutObjectAsync(Model::PutObjectRequest&& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * uses the acl subresource to set the access control list (ACL) permissions for an
          * object that already exists in a bucket
@@ -1351,6 +1876,11 @@ namespace Aws
          */
         virtual Model::PutObjectAclOutcomeCallable PutObjectAclCallable(const Model::PutObjectAclRequest& request) const;
 
+        /**
+         * Same as PutObjectAclCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutObjectAclOutcomeCallable PutObjectAclCallable(Model::PutObjectAclRequest&& request) const;
+
         /**
          * uses the acl subresource to set the access control list (ACL) permissions for an
          * object that already exists in a bucket
@@ -1359,6 +1889,11 @@ namespace Aws
          */
         virtual void PutObjectAclAsync(const Model::PutObjectAclRequest& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutObjectAclAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutObjectAclAsync(Model::PutObjectAclRequest&& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Restores an archived copy of an object back into Amazon S3
          */
@@ -1371,6 +1906,11 @@ namespace Aws
          */
         virtual Model::RestoreObjectOutcomeCallable RestoreObjectCallable(const Model::RestoreObjectRequest& request) const;
 
+        /**
+         * Same as RestoreObjectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RestoreObjectOutcomeCallable RestoreObjectCallable(Model::RestoreObjectRequest&& request) const;
+
         /**
          * Restores an archived copy of an object back into Amazon S3
          *
@@ -1378,6 +1918,11 @@ namespace Aws
          */
         virtual void RestoreObjectAsync(const Model::RestoreObjectRequest& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RestoreObjectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RestoreObjectAsync(Model::RestoreObjectRequest&& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Uploads a part in a multipart upload.</p><p><b>Note:</b> After you initiate
          * multipart upload and upload one or more parts, you must either complete or abort
@@ -1398,6 +1943,11 @@ namespace Aws
          */
         virtual Model::UploadPartOutcomeCallable UploadPartCallable(const Model::UploadPartRequest& request) const;
 
+        /**
+         * Same as UploadPartCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UploadPartOutcomeCallable UploadPartCallable(Model::UploadPartRequest&& request) const;
+
         /**
          * <p>Uploads a part in a multipart upload.</p><p><b>Note:</b> After you initiate
          * multipart upload and upload one or more parts, you must either complete or abort
@@ -1409,6 +1959,11 @@ namespace Aws
          */
         virtual void UploadPartAsync(const Model::UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadPartAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UploadPartAsync(Model::UploadPartRequest&& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Uploads a part by copying data from an existing object as data source.
          */
@@ -1421,6 +1976,11 @@ namespace Aws
          */
         virtual Model::UploadPartCopyOutcomeCallable UploadPartCopyCallable(const Model::UploadPartCopyRequest& request) const;
 
+        /**
+         * Same as UploadPartCopyCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UploadPartCopyOutcomeCallable UploadPartCopyCallable(Model::UploadPartCopyRequest&& request) const;
+
         /**
          * Uploads a part by copying data from an existing object as data source.
          *
@@ -1428,9 +1988,131 @@ namespace Aws
          */
         virtual void UploadPartCopyAsync(const Model::UploadPartCopyRequest& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UploadPartCopyAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UploadPartCopyAsync(Model::UploadPartCopyRequest&& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AbortMultipartUploadOutcome> AbortMultipartUploadAwaitable(const Model::AbortMultipartUploadRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::AbortMultipartUpload, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AbortMultipartUploadOutcome> AbortMultipartUploadAwaitable(Model::AbortMultipartUploadRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::AbortMultipartUpload, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CompleteMultipartUploadOutcome> CompleteMultipartUploadAwaitable(const Model::CompleteMultipartUploadRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::CompleteMultipartUpload, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CompleteMultipartUploadOutcome> CompleteMultipartUploadAwaitable(Model::CompleteMultipartUploadRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::CompleteMultipartUpload, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopyObjectOutcome> CopyObjectAwaitable(const Model::CopyObjectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::CopyObject, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CopyObjectOutcome> CopyObjectAwaitable(Model::CopyObjectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::CopyObject, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateBucketOutcome> CreateBucketAwaitable(const Model::CreateBucketRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::CreateBucket, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateBucketOutcome> CreateBucketAwaitable(Model::CreateBucketRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::CreateBucket, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateMultipartUploadOutcome> CreateMultipartUploadAwaitable(const Model::CreateMultipartUploadRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::CreateMultipartUpload, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateMultipartUploadOutcome> CreateMultipartUploadAwaitable(Model::CreateMultipartUploadRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::CreateMultipartUpload, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBucketOutcome> DeleteBucketAwaitable(const Model::DeleteBucketRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteBucket, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBucketOutcome> DeleteBucketAwaitable(Model::DeleteBucketRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteBucket, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBucketCorsOutcome> DeleteBucketCorsAwaitable(const Model::DeleteBucketCorsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteBucketCors, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBucketCorsOutcome> DeleteBucketCorsAwaitable(Model::DeleteBucketCorsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteBucketCors, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBucketLifecycleOutcome> DeleteBucketLifecycleAwaitable(const Model::DeleteBucketLifecycleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteBucketLifecycle, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBucketLifecycleOutcome> DeleteBucketLifecycleAwaitable(Model::DeleteBucketLifecycleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteBucketLifecycle, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBucketPolicyOutcome> DeleteBucketPolicyAwaitable(const Model::DeleteBucketPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteBucketPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBucketPolicyOutcome> DeleteBucketPolicyAwaitable(Model::DeleteBucketPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteBucketPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBucketReplicationOutcome> DeleteBucketReplicationAwaitable(const Model::DeleteBucketReplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteBucketReplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBucketReplicationOutcome> DeleteBucketReplicationAwaitable(Model::DeleteBucketReplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteBucketReplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBucketTaggingOutcome> DeleteBucketTaggingAwaitable(const Model::DeleteBucketTaggingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteBucketTagging, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBucketTaggingOutcome> DeleteBucketTaggingAwaitable(Model::DeleteBucketTaggingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteBucketTagging, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBucketWebsiteOutcome> DeleteBucketWebsiteAwaitable(const Model::DeleteBucketWebsiteRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteBucketWebsite, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBucketWebsiteOutcome> DeleteBucketWebsiteAwaitable(Model::DeleteBucketWebsiteRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteBucketWebsite, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteObjectOutcome> DeleteObjectAwaitable(const Model::DeleteObjectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteObject, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteObjectOutcome> DeleteObjectAwaitable(Model::DeleteObjectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteObject, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteObjectsOutcome> DeleteObjectsAwaitable(const Model::DeleteObjectsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteObjects, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteObjectsOutcome> DeleteObjectsAwaitable(Model::DeleteObjectsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::DeleteObjects, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketAclOutcome> GetBucketAclAwaitable(const Model::GetBucketAclRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketAcl, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketAclOutcome> GetBucketAclAwaitable(Model::GetBucketAclRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketAcl, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketCorsOutcome> GetBucketCorsAwaitable(const Model::GetBucketCorsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketCors, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketCorsOutcome> GetBucketCorsAwaitable(Model::GetBucketCorsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketCors, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketLifecycleConfigurationOutcome> GetBucketLifecycleConfigurationAwaitable(const Model::GetBucketLifecycleConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketLifecycleConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketLifecycleConfigurationOutcome> GetBucketLifecycleConfigurationAwaitable(Model::GetBucketLifecycleConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketLifecycleConfiguration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketLocationOutcome> GetBucketLocationAwaitable(const Model::GetBucketLocationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketLocation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketLocationOutcome> GetBucketLocationAwaitable(Model::GetBucketLocationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketLocation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketLoggingOutcome> GetBucketLoggingAwaitable(const Model::GetBucketLoggingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketLogging, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketLoggingOutcome> GetBucketLoggingAwaitable(Model::GetBucketLoggingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketLogging, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketNotificationConfigurationOutcome> GetBucketNotificationConfigurationAwaitable(const Model::GetBucketNotificationConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketNotificationConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketNotificationConfigurationOutcome> GetBucketNotificationConfigurationAwaitable(Model::GetBucketNotificationConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketNotificationConfiguration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketPolicyOutcome> GetBucketPolicyAwaitable(const Model::GetBucketPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketPolicyOutcome> GetBucketPolicyAwaitable(Model::GetBucketPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketReplicationOutcome> GetBucketReplicationAwaitable(const Model::GetBucketReplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketReplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketReplicationOutcome> GetBucketReplicationAwaitable(Model::GetBucketReplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketReplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketRequestPaymentOutcome> GetBucketRequestPaymentAwaitable(const Model::GetBucketRequestPaymentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketRequestPayment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketRequestPaymentOutcome> GetBucketRequestPaymentAwaitable(Model::GetBucketRequestPaymentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketRequestPayment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketTaggingOutcome> GetBucketTaggingAwaitable(const Model::GetBucketTaggingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketTagging, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketTaggingOutcome> GetBucketTaggingAwaitable(Model::GetBucketTaggingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketTagging, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketVersioningOutcome> GetBucketVersioningAwaitable(const Model::GetBucketVersioningRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketVersioning, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketVersioningOutcome> GetBucketVersioningAwaitable(Model::GetBucketVersioningRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketVersioning, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketWebsiteOutcome> GetBucketWebsiteAwaitable(const Model::GetBucketWebsiteRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketWebsite, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetBucketWebsiteOutcome> GetBucketWebsiteAwaitable(Model::GetBucketWebsiteRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetBucketWebsite, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetObjectOutcome> GetObjectAwaitable(const Model::GetObjectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetObject, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetObjectOutcome> GetObjectAwaitable(Model::GetObjectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetObject, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetObjectAclOutcome> GetObjectAclAwaitable(const Model::GetObjectAclRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetObjectAcl, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetObjectAclOutcome> GetObjectAclAwaitable(Model::GetObjectAclRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetObjectAcl, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetObjectTorrentOutcome> GetObjectTorrentAwaitable(const Model::GetObjectTorrentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetObjectTorrent, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetObjectTorrentOutcome> GetObjectTorrentAwaitable(Model::GetObjectTorrentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::GetObjectTorrent, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::HeadBucketOutcome> HeadBucketAwaitable(const Model::HeadBucketRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::HeadBucket, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::HeadBucketOutcome> HeadBucketAwaitable(Model::HeadBucketRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::HeadBucket, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::HeadObjectOutcome> HeadObjectAwaitable(const Model::HeadObjectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::HeadObject, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::HeadObjectOutcome> HeadObjectAwaitable(Model::HeadObjectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::HeadObject, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListBucketsOutcome> ListBucketsAwaitable() const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::ListBuckets, this); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListMultipartUploadsOutcome> ListMultipartUploadsAwaitable(const Model::ListMultipartUploadsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::ListMultipartUploads, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListMultipartUploadsOutcome> ListMultipartUploadsAwaitable(Model::ListMultipartUploadsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::ListMultipartUploads, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListObjectVersionsOutcome> ListObjectVersionsAwaitable(const Model::ListObjectVersionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::ListObjectVersions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListObjectVersionsOutcome> ListObjectVersionsAwaitable(Model::ListObjectVersionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::ListObjectVersions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListObjectsOutcome> ListObjectsAwaitable(const Model::ListObjectsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::ListObjects, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListObjectsOutcome> ListObjectsAwaitable(Model::ListObjectsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::ListObjects, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPartsOutcome> ListPartsAwaitable(const Model::ListPartsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::ListParts, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPartsOutcome> ListPartsAwaitable(Model::ListPartsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::ListParts, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketAclOutcome> PutBucketAclAwaitable(const Model::PutBucketAclRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketAcl, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketAclOutcome> PutBucketAclAwaitable(Model::PutBucketAclRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketAcl, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketCorsOutcome> PutBucketCorsAwaitable(const Model::PutBucketCorsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketCors, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketCorsOutcome> PutBucketCorsAwaitable(Model::PutBucketCorsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketCors, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketLifecycleConfigurationOutcome> PutBucketLifecycleConfigurationAwaitable(const Model::PutBucketLifecycleConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketLifecycleConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketLifecycleConfigurationOutcome> PutBucketLifecycleConfigurationAwaitable(Model::PutBucketLifecycleConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketLifecycleConfiguration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketLoggingOutcome> PutBucketLoggingAwaitable(const Model::PutBucketLoggingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketLogging, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketLoggingOutcome> PutBucketLoggingAwaitable(Model::PutBucketLoggingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketLogging, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketNotificationConfigurationOutcome> PutBucketNotificationConfigurationAwaitable(const Model::PutBucketNotificationConfigurationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketNotificationConfiguration, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketNotificationConfigurationOutcome> PutBucketNotificationConfigurationAwaitable(Model::PutBucketNotificationConfigurationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketNotificationConfiguration, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketPolicyOutcome> PutBucketPolicyAwaitable(const Model::PutBucketPolicyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketPolicy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketPolicyOutcome> PutBucketPolicyAwaitable(Model::PutBucketPolicyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketPolicy, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketReplicationOutcome> PutBucketReplicationAwaitable(const Model::PutBucketReplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketReplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketReplicationOutcome> PutBucketReplicationAwaitable(Model::PutBucketReplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketReplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketRequestPaymentOutcome> PutBucketRequestPaymentAwaitable(const Model::PutBucketRequestPaymentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketRequestPayment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketRequestPaymentOutcome> PutBucketRequestPaymentAwaitable(Model::PutBucketRequestPaymentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketRequestPayment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketTaggingOutcome> PutBucketTaggingAwaitable(const Model::PutBucketTaggingRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketTagging, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketTaggingOutcome> PutBucketTaggingAwaitable(Model::PutBucketTaggingRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketTagging, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketVersioningOutcome> PutBucketVersioningAwaitable(const Model::PutBucketVersioningRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketVersioning, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketVersioningOutcome> PutBucketVersioningAwaitable(Model::PutBucketVersioningRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketVersioning, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketWebsiteOutcome> PutBucketWebsiteAwaitable(const Model::PutBucketWebsiteRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketWebsite, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutBucketWebsiteOutcome> PutBucketWebsiteAwaitable(Model::PutBucketWebsiteRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutBucketWebsite, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutObjectOutcome> PutObjectAwaitable(const Model::PutObjectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutObject, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutObjectOutcome> PutObjectAwaitable(Model::PutObjectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutObject, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutObjectAclOutcome> PutObjectAclAwaitable(const Model::PutObjectAclRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutObjectAcl, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutObjectAclOutcome> PutObjectAclAwaitable(Model::PutObjectAclRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::PutObjectAcl, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreObjectOutcome> RestoreObjectAwaitable(const Model::RestoreObjectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::RestoreObject, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RestoreObjectOutcome> RestoreObjectAwaitable(Model::RestoreObjectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::RestoreObject, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadPartOutcome> UploadPartAwaitable(const Model::UploadPartRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::UploadPart, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadPartOutcome> UploadPartAwaitable(Model::UploadPartRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::UploadPart, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadPartCopyOutcome> UploadPartCopyAwaitable(const Model::UploadPartCopyRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::UploadPartCopy, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UploadPartCopyOutcome> UploadPartCopyAwaitable(Model::UploadPartCopyRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &S3Client::UploadPartCopy, this, std::move(request)); }
+#endif
 
         Aws::String GeneratePresignedUrl(const Aws::String& bucketName, const Aws::String& key, Http::HttpMethod method, long long expirationInSeconds = MAX_EXPIRATION_SECONDS);
 
+        /**
+         * Presigned urls for many keys of the same bucket, with the same method and expiration, in the order of keys.
+         * Much cheaper per url than GeneratePresignedUrl, and large batches are signed in parallel on the client's executor.
+         * Returns an empty vector if signing failed.
+         */
+        Aws::Vector<Aws::String> GeneratePresignedUrls(const Aws::String& bucketName, const Aws::Vector<Aws::String>& keys, Http::HttpMethod method, long long expirationInSeconds = MAX_EXPIRATION_SECONDS);
+
     private:
         void init(const Client::ClientConfiguration& clientConfiguration);
 
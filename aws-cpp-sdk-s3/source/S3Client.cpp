@@ -22,6 +22,7 @@
 #include <aws/core/auth/AWSCredentialsProviderChain.h>
 #include <aws/core/utils/xml/XmlSerializer.h>
 #include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/StringBuilder.h>
 #include <aws/core/utils/threading/Executor.h>
 #include <aws/s3/S3Client.h>
 #include <aws/s3/S3Endpoint.h>
@@ -143,12 +144,12 @@ void S3Client::init(const ClientConfiguration& config)
 }
 AbortMultipartUploadOutcome S3Client::AbortMultipartUpload(const AbortMultipartUploadRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return AbortMultipartUploadOutcome(AbortMultipartUploadResult(outcome.GetResult()));
@@ -161,12 +162,22 @@ AbortMultipartUploadOutcome S3Client::AbortMultipartUpload(const AbortMultipartU
 
 AbortMultipartUploadOutcomeCallable S3Client::AbortMultipartUploadCallable(const AbortMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::AbortMultipartUpload, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::AbortMultipartUpload, Aws::Client::RejectedCallOutcome<AbortMultipartUploadOutcome>(), this, request);
+}
+
+AbortMultipartUploadOutcomeCallable S3Client::AbortMultipartUploadCallable(AbortMultipartUploadRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::AbortMultipartUpload, Aws::Client::RejectedCallOutcome<AbortMultipartUploadOutcome>(), this, std::move(request));
 }
 
 void S3Client::AbortMultipartUploadAsync(const AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::AbortMultipartUploadAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::AbortMultipartUploadAsyncHelper, Aws::Client::RejectedAsyncCall<AbortMultipartUploadOutcome>(), this, request, handler, context);
+}
+
+void S3Client::AbortMultipartUploadAsync(AbortMultipartUploadRequest&& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::AbortMultipartUploadAsyncHelper, Aws::Client::RejectedAsyncCall<AbortMultipartUploadOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::AbortMultipartUploadAsyncHelper(const AbortMultipartUploadRequest& request, const AbortMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -176,12 +187,12 @@ void S3Client::AbortMultipartUploadAsyncHelper(const AbortMultipartUploadRequest
 
 CompleteMultipartUploadOutcome S3Client::CompleteMultipartUpload(const CompleteMultipartUploadRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return CompleteMultipartUploadOutcome(CompleteMultipartUploadResult(outcome.GetResult()));
@@ -194,12 +205,22 @@ CompleteMultipartUploadOutcome S3Client::CompleteMultipartUpload(const CompleteM
 
 CompleteMultipartUploadOutcomeCallable S3Client::CompleteMultipartUploadCallable(const CompleteMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::CompleteMultipartUpload, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::CompleteMultipartUpload, Aws::Client::RejectedCallOutcome<CompleteMultipartUploadOutcome>(), this, request);
+}
+
+CompleteMultipartUploadOutcomeCallable S3Client::CompleteMultipartUploadCallable(CompleteMultipartUploadRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::CompleteMultipartUpload, Aws::Client::RejectedCallOutcome<CompleteMultipartUploadOutcome>(), this, std::move(request));
 }
 
 void S3Client::CompleteMultipartUploadAsync(const CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::CompleteMultipartUploadAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::CompleteMultipartUploadAsyncHelper, Aws::Client::RejectedAsyncCall<CompleteMultipartUploadOutcome>(), this, request, handler, context);
+}
+
+void S3Client::CompleteMultipartUploadAsync(CompleteMultipartUploadRequest&& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::CompleteMultipartUploadAsyncHelper, Aws::Client::RejectedAsyncCall<CompleteMultipartUploadOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::CompleteMultipartUploadAsyncHelper(const CompleteMultipartUploadRequest& request, const CompleteMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -209,12 +230,12 @@ void S3Client::CompleteMultipartUploadAsyncHelper(const CompleteMultipartUploadR
 
 CopyObjectOutcome S3Client::CopyObject(const CopyObjectRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return CopyObjectOutcome(CopyObjectResult(outcome.GetResult()));
@@ -227,12 +248,22 @@ CopyObjectOutcome S3Client::CopyObject(const CopyObjectRequest& request) const
 
 CopyObjectOutcomeCallable S3Client::CopyObjectCallable(const CopyObjectRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::CopyObject, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::CopyObject, Aws::Client::RejectedCallOutcome<CopyObjectOutcome>(), this, request);
+}
+
+CopyObjectOutcomeCallable S3Client::CopyObjectCallable(CopyObjectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::CopyObject, Aws::Client::RejectedCallOutcome<CopyObjectOutcome>(), this, std::move(request));
 }
 
 void S3Client::CopyObjectAsync(const CopyObjectRequest& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::CopyObjectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::CopyObjectAsyncHelper, Aws::Client::RejectedAsyncCall<CopyObjectOutcome>(), this, request, handler, context);
+}
+
+void S3Client::CopyObjectAsync(CopyObjectRequest&& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::CopyObjectAsyncHelper, Aws::Client::RejectedAsyncCall<CopyObjectOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::CopyObjectAsyncHelper(const CopyObjectRequest& request, const CopyObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -242,10 +273,10 @@ void S3Client::CopyObjectAsyncHelper(const CopyObjectRequest& request, const Cop
 
 CreateBucketOutcome S3Client::CreateBucket(const CreateBucketRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return CreateBucketOutcome(CreateBucketResult(outcome.GetResult()));
@@ -258,12 +289,22 @@ CreateBucketOutcome S3Client::CreateBucket(const CreateBucketRequest& request) c
 
 CreateBucketOutcomeCallable S3Client::CreateBucketCallable(const CreateBucketRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::CreateBucket, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::CreateBucket, Aws::Client::RejectedCallOutcome<CreateBucketOutcome>(), this, request);
+}
+
+CreateBucketOutcomeCallable S3Client::CreateBucketCallable(CreateBucketRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::CreateBucket, Aws::Client::RejectedCallOutcome<CreateBucketOutcome>(), this, std::move(request));
 }
 
 void S3Client::CreateBucketAsync(const CreateBucketRequest& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::CreateBucketAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::CreateBucketAsyncHelper, Aws::Client::RejectedAsyncCall<CreateBucketOutcome>(), this, request, handler, context);
+}
+
+void S3Client::CreateBucketAsync(CreateBucketRequest&& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::CreateBucketAsyncHelper, Aws::Client::RejectedAsyncCall<CreateBucketOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::CreateBucketAsyncHelper(const CreateBucketRequest& request, const CreateBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -273,13 +314,13 @@ void S3Client::CreateBucketAsyncHelper(const CreateBucketRequest& request, const
 
 CreateMultipartUploadOutcome S3Client::CreateMultipartUpload(const CreateMultipartUploadRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  ss << "?uploads";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  uri.Append("?uploads");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return CreateMultipartUploadOutcome(CreateMultipartUploadResult(outcome.GetResult()));
@@ -292,12 +333,22 @@ CreateMultipartUploadOutcome S3Client::CreateMultipartUpload(const CreateMultipa
 
 CreateMultipartUploadOutcomeCallable S3Client::CreateMultipartUploadCallable(const CreateMultipartUploadRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::CreateMultipartUpload, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::CreateMultipartUpload, Aws::Client::RejectedCallOutcome<CreateMultipartUploadOutcome>(), this, request);
+}
+
+CreateMultipartUploadOutcomeCallable S3Client::CreateMultipartUploadCallable(CreateMultipartUploadRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::CreateMultipartUpload, Aws::Client::RejectedCallOutcome<CreateMultipartUploadOutcome>(), this, std::move(request));
 }
 
 void S3Client::CreateMultipartUploadAsync(const CreateMultipartUploadRequest& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::CreateMultipartUploadAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::CreateMultipartUploadAsyncHelper, Aws::Client::RejectedAsyncCall<CreateMultipartUploadOutcome>(), this, request, handler, context);
+}
+
+void S3Client::CreateMultipartUploadAsync(CreateMultipartUploadRequest&& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::CreateMultipartUploadAsyncHelper, Aws::Client::RejectedAsyncCall<CreateMultipartUploadOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::CreateMultipartUploadAsyncHelper(const CreateMultipartUploadRequest& request, const CreateMultipartUploadResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -307,10 +358,10 @@ void S3Client::CreateMultipartUploadAsyncHelper(const CreateMultipartUploadReque
 
 DeleteBucketOutcome S3Client::DeleteBucket(const DeleteBucketRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteBucketOutcome(NoResult());
@@ -323,12 +374,22 @@ DeleteBucketOutcome S3Client::DeleteBucket(const DeleteBucketRequest& request) c
 
 DeleteBucketOutcomeCallable S3Client::DeleteBucketCallable(const DeleteBucketRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteBucket, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::DeleteBucket, Aws::Client::RejectedCallOutcome<DeleteBucketOutcome>(), this, request);
+}
+
+DeleteBucketOutcomeCallable S3Client::DeleteBucketCallable(DeleteBucketRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::DeleteBucket, Aws::Client::RejectedCallOutcome<DeleteBucketOutcome>(), this, std::move(request));
 }
 
 void S3Client::DeleteBucketAsync(const DeleteBucketRequest& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::DeleteBucketAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBucketOutcome>(), this, request, handler, context);
+}
+
+void S3Client::DeleteBucketAsync(DeleteBucketRequest&& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::DeleteBucketAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBucketOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::DeleteBucketAsyncHelper(const DeleteBucketRequest& request, const DeleteBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -338,11 +399,11 @@ void S3Client::DeleteBucketAsyncHelper(const DeleteBucketRequest& request, const
 
 DeleteBucketCorsOutcome S3Client::DeleteBucketCors(const DeleteBucketCorsRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?cors";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?cors");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteBucketCorsOutcome(NoResult());
@@ -355,12 +416,22 @@ DeleteBucketCorsOutcome S3Client::DeleteBucketCors(const DeleteBucketCorsRequest
 
 DeleteBucketCorsOutcomeCallable S3Client::DeleteBucketCorsCallable(const DeleteBucketCorsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteBucketCors, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::DeleteBucketCors, Aws::Client::RejectedCallOutcome<DeleteBucketCorsOutcome>(), this, request);
+}
+
+DeleteBucketCorsOutcomeCallable S3Client::DeleteBucketCorsCallable(DeleteBucketCorsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::DeleteBucketCors, Aws::Client::RejectedCallOutcome<DeleteBucketCorsOutcome>(), this, std::move(request));
 }
 
 void S3Client::DeleteBucketCorsAsync(const DeleteBucketCorsRequest& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketCorsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::DeleteBucketCorsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBucketCorsOutcome>(), this, request, handler, context);
+}
+
+void S3Client::DeleteBucketCorsAsync(DeleteBucketCorsRequest&& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::DeleteBucketCorsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBucketCorsOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::DeleteBucketCorsAsyncHelper(const DeleteBucketCorsRequest& request, const DeleteBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -370,11 +441,11 @@ void S3Client::DeleteBucketCorsAsyncHelper(const DeleteBucketCorsRequest& reques
 
 DeleteBucketLifecycleOutcome S3Client::DeleteBucketLifecycle(const DeleteBucketLifecycleRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?lifecycle";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?lifecycle");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteBucketLifecycleOutcome(NoResult());
@@ -387,12 +458,22 @@ DeleteBucketLifecycleOutcome S3Client::DeleteBucketLifecycle(const DeleteBucketL
 
 DeleteBucketLifecycleOutcomeCallable S3Client::DeleteBucketLifecycleCallable(const DeleteBucketLifecycleRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteBucketLifecycle, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::DeleteBucketLifecycle, Aws::Client::RejectedCallOutcome<DeleteBucketLifecycleOutcome>(), this, request);
+}
+
+DeleteBucketLifecycleOutcomeCallable S3Client::DeleteBucketLifecycleCallable(DeleteBucketLifecycleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::DeleteBucketLifecycle, Aws::Client::RejectedCallOutcome<DeleteBucketLifecycleOutcome>(), this, std::move(request));
 }
 
 void S3Client::DeleteBucketLifecycleAsync(const DeleteBucketLifecycleRequest& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketLifecycleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::DeleteBucketLifecycleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBucketLifecycleOutcome>(), this, request, handler, context);
+}
+
+void S3Client::DeleteBucketLifecycleAsync(DeleteBucketLifecycleRequest&& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::DeleteBucketLifecycleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBucketLifecycleOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::DeleteBucketLifecycleAsyncHelper(const DeleteBucketLifecycleRequest& request, const DeleteBucketLifecycleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -402,11 +483,11 @@ void S3Client::DeleteBucketLifecycleAsyncHelper(const DeleteBucketLifecycleReque
 
 DeleteBucketPolicyOutcome S3Client::DeleteBucketPolicy(const DeleteBucketPolicyRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?policy";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?policy");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteBucketPolicyOutcome(NoResult());
@@ -419,12 +500,22 @@ DeleteBucketPolicyOutcome S3Client::DeleteBucketPolicy(const DeleteBucketPolicyR
 
 DeleteBucketPolicyOutcomeCallable S3Client::DeleteBucketPolicyCallable(const DeleteBucketPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteBucketPolicy, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::DeleteBucketPolicy, Aws::Client::RejectedCallOutcome<DeleteBucketPolicyOutcome>(), this, request);
+}
+
+DeleteBucketPolicyOutcomeCallable S3Client::DeleteBucketPolicyCallable(DeleteBucketPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::DeleteBucketPolicy, Aws::Client::RejectedCallOutcome<DeleteBucketPolicyOutcome>(), this, std::move(request));
 }
 
 void S3Client::DeleteBucketPolicyAsync(const DeleteBucketPolicyRequest& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::DeleteBucketPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBucketPolicyOutcome>(), this, request, handler, context);
+}
+
+void S3Client::DeleteBucketPolicyAsync(DeleteBucketPolicyRequest&& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::DeleteBucketPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBucketPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::DeleteBucketPolicyAsyncHelper(const DeleteBucketPolicyRequest& request, const DeleteBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -434,11 +525,11 @@ void S3Client::DeleteBucketPolicyAsyncHelper(const DeleteBucketPolicyRequest& re
 
 DeleteBucketReplicationOutcome S3Client::DeleteBucketReplication(const DeleteBucketReplicationRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?replication";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?replication");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteBucketReplicationOutcome(NoResult());
@@ -451,12 +542,22 @@ DeleteBucketReplicationOutcome S3Client::DeleteBucketReplication(const DeleteBuc
 
 DeleteBucketReplicationOutcomeCallable S3Client::DeleteBucketReplicationCallable(const DeleteBucketReplicationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteBucketReplication, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::DeleteBucketReplication, Aws::Client::RejectedCallOutcome<DeleteBucketReplicationOutcome>(), this, request);
+}
+
+DeleteBucketReplicationOutcomeCallable S3Client::DeleteBucketReplicationCallable(DeleteBucketReplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::DeleteBucketReplication, Aws::Client::RejectedCallOutcome<DeleteBucketReplicationOutcome>(), this, std::move(request));
 }
 
 void S3Client::DeleteBucketReplicationAsync(const DeleteBucketReplicationRequest& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketReplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::DeleteBucketReplicationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBucketReplicationOutcome>(), this, request, handler, context);
+}
+
+void S3Client::DeleteBucketReplicationAsync(DeleteBucketReplicationRequest&& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::DeleteBucketReplicationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBucketReplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::DeleteBucketReplicationAsyncHelper(const DeleteBucketReplicationRequest& request, const DeleteBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -466,11 +567,11 @@ void S3Client::DeleteBucketReplicationAsyncHelper(const DeleteBucketReplicationR
 
 DeleteBucketTaggingOutcome S3Client::DeleteBucketTagging(const DeleteBucketTaggingRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?tagging";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?tagging");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteBucketTaggingOutcome(NoResult());
@@ -483,12 +584,22 @@ DeleteBucketTaggingOutcome S3Client::DeleteBucketTagging(const DeleteBucketTaggi
 
 DeleteBucketTaggingOutcomeCallable S3Client::DeleteBucketTaggingCallable(const DeleteBucketTaggingRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteBucketTagging, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::DeleteBucketTagging, Aws::Client::RejectedCallOutcome<DeleteBucketTaggingOutcome>(), this, request);
+}
+
+DeleteBucketTaggingOutcomeCallable S3Client::DeleteBucketTaggingCallable(DeleteBucketTaggingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::DeleteBucketTagging, Aws::Client::RejectedCallOutcome<DeleteBucketTaggingOutcome>(), this, std::move(request));
 }
 
 void S3Client::DeleteBucketTaggingAsync(const DeleteBucketTaggingRequest& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketTaggingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::DeleteBucketTaggingAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBucketTaggingOutcome>(), this, request, handler, context);
+}
+
+void S3Client::DeleteBucketTaggingAsync(DeleteBucketTaggingRequest&& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::DeleteBucketTaggingAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBucketTaggingOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::DeleteBucketTaggingAsyncHelper(const DeleteBucketTaggingRequest& request, const DeleteBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -498,11 +609,11 @@ void S3Client::DeleteBucketTaggingAsyncHelper(const DeleteBucketTaggingRequest&
 
 DeleteBucketWebsiteOutcome S3Client::DeleteBucketWebsite(const DeleteBucketWebsiteRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?website";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?website");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteBucketWebsiteOutcome(NoResult());
@@ -515,12 +626,22 @@ DeleteBucketWebsiteOutcome S3Client::DeleteBucketWebsite(const DeleteBucketWebsi
 
 DeleteBucketWebsiteOutcomeCallable S3Client::DeleteBucketWebsiteCallable(const DeleteBucketWebsiteRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteBucketWebsite, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::DeleteBucketWebsite, Aws::Client::RejectedCallOutcome<DeleteBucketWebsiteOutcome>(), this, request);
+}
+
+DeleteBucketWebsiteOutcomeCallable S3Client::DeleteBucketWebsiteCallable(DeleteBucketWebsiteRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::DeleteBucketWebsite, Aws::Client::RejectedCallOutcome<DeleteBucketWebsiteOutcome>(), this, std::move(request));
 }
 
 void S3Client::DeleteBucketWebsiteAsync(const DeleteBucketWebsiteRequest& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteBucketWebsiteAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::DeleteBucketWebsiteAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBucketWebsiteOutcome>(), this, request, handler, context);
+}
+
+void S3Client::DeleteBucketWebsiteAsync(DeleteBucketWebsiteRequest&& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::DeleteBucketWebsiteAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBucketWebsiteOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::DeleteBucketWebsiteAsyncHelper(const DeleteBucketWebsiteRequest& request, const DeleteBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -530,12 +651,12 @@ void S3Client::DeleteBucketWebsiteAsyncHelper(const DeleteBucketWebsiteRequest&
 
 DeleteObjectOutcome S3Client::DeleteObject(const DeleteObjectRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_DELETE);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_DELETE);
   if(outcome.IsSuccess())
   {
     return DeleteObjectOutcome(DeleteObjectResult(outcome.GetResult()));
@@ -548,12 +669,22 @@ DeleteObjectOutcome S3Client::DeleteObject(const DeleteObjectRequest& request) c
 
 DeleteObjectOutcomeCallable S3Client::DeleteObjectCallable(const DeleteObjectRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteObject, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::DeleteObject, Aws::Client::RejectedCallOutcome<DeleteObjectOutcome>(), this, request);
+}
+
+DeleteObjectOutcomeCallable S3Client::DeleteObjectCallable(DeleteObjectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::DeleteObject, Aws::Client::RejectedCallOutcome<DeleteObjectOutcome>(), this, std::move(request));
 }
 
 void S3Client::DeleteObjectAsync(const DeleteObjectRequest& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteObjectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::DeleteObjectAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteObjectOutcome>(), this, request, handler, context);
+}
+
+void S3Client::DeleteObjectAsync(DeleteObjectRequest&& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::DeleteObjectAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteObjectOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::DeleteObjectAsyncHelper(const DeleteObjectRequest& request, const DeleteObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -563,11 +694,11 @@ void S3Client::DeleteObjectAsyncHelper(const DeleteObjectRequest& request, const
 
 DeleteObjectsOutcome S3Client::DeleteObjects(const DeleteObjectsRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?delete";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?delete");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return DeleteObjectsOutcome(DeleteObjectsResult(outcome.GetResult()));
@@ -580,12 +711,22 @@ DeleteObjectsOutcome S3Client::DeleteObjects(const DeleteObjectsRequest& request
 
 DeleteObjectsOutcomeCallable S3Client::DeleteObjectsCallable(const DeleteObjectsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::DeleteObjects, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::DeleteObjects, Aws::Client::RejectedCallOutcome<DeleteObjectsOutcome>(), this, request);
+}
+
+DeleteObjectsOutcomeCallable S3Client::DeleteObjectsCallable(DeleteObjectsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::DeleteObjects, Aws::Client::RejectedCallOutcome<DeleteObjectsOutcome>(), this, std::move(request));
 }
 
 void S3Client::DeleteObjectsAsync(const DeleteObjectsRequest& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::DeleteObjectsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::DeleteObjectsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteObjectsOutcome>(), this, request, handler, context);
+}
+
+void S3Client::DeleteObjectsAsync(DeleteObjectsRequest&& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::DeleteObjectsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteObjectsOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::DeleteObjectsAsyncHelper(const DeleteObjectsRequest& request, const DeleteObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -595,11 +736,11 @@ void S3Client::DeleteObjectsAsyncHelper(const DeleteObjectsRequest& request, con
 
 GetBucketAclOutcome S3Client::GetBucketAcl(const GetBucketAclRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?acl";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?acl");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetBucketAclOutcome(GetBucketAclResult(outcome.GetResult()));
@@ -612,12 +753,22 @@ GetBucketAclOutcome S3Client::GetBucketAcl(const GetBucketAclRequest& request) c
 
 GetBucketAclOutcomeCallable S3Client::GetBucketAclCallable(const GetBucketAclRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketAcl, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketAcl, Aws::Client::RejectedCallOutcome<GetBucketAclOutcome>(), this, request);
+}
+
+GetBucketAclOutcomeCallable S3Client::GetBucketAclCallable(GetBucketAclRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketAcl, Aws::Client::RejectedCallOutcome<GetBucketAclOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetBucketAclAsync(const GetBucketAclRequest& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketAclAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetBucketAclAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketAclOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetBucketAclAsync(GetBucketAclRequest&& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetBucketAclAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketAclOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetBucketAclAsyncHelper(const GetBucketAclRequest& request, const GetBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -627,11 +778,11 @@ void S3Client::GetBucketAclAsyncHelper(const GetBucketAclRequest& request, const
 
 GetBucketCorsOutcome S3Client::GetBucketCors(const GetBucketCorsRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?cors";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?cors");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetBucketCorsOutcome(GetBucketCorsResult(outcome.GetResult()));
@@ -644,12 +795,22 @@ GetBucketCorsOutcome S3Client::GetBucketCors(const GetBucketCorsRequest& request
 
 GetBucketCorsOutcomeCallable S3Client::GetBucketCorsCallable(const GetBucketCorsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketCors, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketCors, Aws::Client::RejectedCallOutcome<GetBucketCorsOutcome>(), this, request);
+}
+
+GetBucketCorsOutcomeCallable S3Client::GetBucketCorsCallable(GetBucketCorsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketCors, Aws::Client::RejectedCallOutcome<GetBucketCorsOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetBucketCorsAsync(const GetBucketCorsRequest& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketCorsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetBucketCorsAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketCorsOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetBucketCorsAsync(GetBucketCorsRequest&& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetBucketCorsAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketCorsOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetBucketCorsAsyncHelper(const GetBucketCorsRequest& request, const GetBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -659,11 +820,11 @@ void S3Client::GetBucketCorsAsyncHelper(const GetBucketCorsRequest& request, con
 
 GetBucketLifecycleConfigurationOutcome S3Client::GetBucketLifecycleConfiguration(const GetBucketLifecycleConfigurationRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?lifecycle";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?lifecycle");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetBucketLifecycleConfigurationOutcome(GetBucketLifecycleConfigurationResult(outcome.GetResult()));
@@ -676,12 +837,22 @@ GetBucketLifecycleConfigurationOutcome S3Client::GetBucketLifecycleConfiguration
 
 GetBucketLifecycleConfigurationOutcomeCallable S3Client::GetBucketLifecycleConfigurationCallable(const GetBucketLifecycleConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketLifecycleConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketLifecycleConfiguration, Aws::Client::RejectedCallOutcome<GetBucketLifecycleConfigurationOutcome>(), this, request);
+}
+
+GetBucketLifecycleConfigurationOutcomeCallable S3Client::GetBucketLifecycleConfigurationCallable(GetBucketLifecycleConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketLifecycleConfiguration, Aws::Client::RejectedCallOutcome<GetBucketLifecycleConfigurationOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetBucketLifecycleConfigurationAsync(const GetBucketLifecycleConfigurationRequest& request, const GetBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketLifecycleConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetBucketLifecycleConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketLifecycleConfigurationOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetBucketLifecycleConfigurationAsync(GetBucketLifecycleConfigurationRequest&& request, const GetBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetBucketLifecycleConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketLifecycleConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetBucketLifecycleConfigurationAsyncHelper(const GetBucketLifecycleConfigurationRequest& request, const GetBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -691,11 +862,11 @@ void S3Client::GetBucketLifecycleConfigurationAsyncHelper(const GetBucketLifecyc
 
 GetBucketLocationOutcome S3Client::GetBucketLocation(const GetBucketLocationRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?location";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?location");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetBucketLocationOutcome(GetBucketLocationResult(outcome.GetResult()));
@@ -708,12 +879,22 @@ GetBucketLocationOutcome S3Client::GetBucketLocation(const GetBucketLocationRequ
 
 GetBucketLocationOutcomeCallable S3Client::GetBucketLocationCallable(const GetBucketLocationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketLocation, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketLocation, Aws::Client::RejectedCallOutcome<GetBucketLocationOutcome>(), this, request);
+}
+
+GetBucketLocationOutcomeCallable S3Client::GetBucketLocationCallable(GetBucketLocationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketLocation, Aws::Client::RejectedCallOutcome<GetBucketLocationOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetBucketLocationAsync(const GetBucketLocationRequest& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketLocationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetBucketLocationAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketLocationOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetBucketLocationAsync(GetBucketLocationRequest&& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetBucketLocationAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketLocationOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetBucketLocationAsyncHelper(const GetBucketLocationRequest& request, const GetBucketLocationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -723,11 +904,11 @@ void S3Client::GetBucketLocationAsyncHelper(const GetBucketLocationRequest& requ
 
 GetBucketLoggingOutcome S3Client::GetBucketLogging(const GetBucketLoggingRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?logging";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?logging");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetBucketLoggingOutcome(GetBucketLoggingResult(outcome.GetResult()));
@@ -740,12 +921,22 @@ GetBucketLoggingOutcome S3Client::GetBucketLogging(const GetBucketLoggingRequest
 
 GetBucketLoggingOutcomeCallable S3Client::GetBucketLoggingCallable(const GetBucketLoggingRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketLogging, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketLogging, Aws::Client::RejectedCallOutcome<GetBucketLoggingOutcome>(), this, request);
+}
+
+GetBucketLoggingOutcomeCallable S3Client::GetBucketLoggingCallable(GetBucketLoggingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketLogging, Aws::Client::RejectedCallOutcome<GetBucketLoggingOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetBucketLoggingAsync(const GetBucketLoggingRequest& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketLoggingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetBucketLoggingAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketLoggingOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetBucketLoggingAsync(GetBucketLoggingRequest&& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetBucketLoggingAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketLoggingOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetBucketLoggingAsyncHelper(const GetBucketLoggingRequest& request, const GetBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -755,11 +946,11 @@ void S3Client::GetBucketLoggingAsyncHelper(const GetBucketLoggingRequest& reques
 
 GetBucketNotificationConfigurationOutcome S3Client::GetBucketNotificationConfiguration(const GetBucketNotificationConfigurationRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?notification";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?notification");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetBucketNotificationConfigurationOutcome(GetBucketNotificationConfigurationResult(outcome.GetResult()));
@@ -772,12 +963,22 @@ GetBucketNotificationConfigurationOutcome S3Client::GetBucketNotificationConfigu
 
 GetBucketNotificationConfigurationOutcomeCallable S3Client::GetBucketNotificationConfigurationCallable(const GetBucketNotificationConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketNotificationConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketNotificationConfiguration, Aws::Client::RejectedCallOutcome<GetBucketNotificationConfigurationOutcome>(), this, request);
+}
+
+GetBucketNotificationConfigurationOutcomeCallable S3Client::GetBucketNotificationConfigurationCallable(GetBucketNotificationConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketNotificationConfiguration, Aws::Client::RejectedCallOutcome<GetBucketNotificationConfigurationOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetBucketNotificationConfigurationAsync(const GetBucketNotificationConfigurationRequest& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketNotificationConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetBucketNotificationConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketNotificationConfigurationOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetBucketNotificationConfigurationAsync(GetBucketNotificationConfigurationRequest&& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetBucketNotificationConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketNotificationConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetBucketNotificationConfigurationAsyncHelper(const GetBucketNotificationConfigurationRequest& request, const GetBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -787,11 +988,11 @@ void S3Client::GetBucketNotificationConfigurationAsyncHelper(const GetBucketNoti
 
 GetBucketPolicyOutcome S3Client::GetBucketPolicy(const GetBucketPolicyRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?policy";
-  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?policy");
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetBucketPolicyOutcome(GetBucketPolicyResult(outcome.GetResultWithOwnership()));
@@ -804,12 +1005,22 @@ GetBucketPolicyOutcome S3Client::GetBucketPolicy(const GetBucketPolicyRequest& r
 
 GetBucketPolicyOutcomeCallable S3Client::GetBucketPolicyCallable(const GetBucketPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketPolicy, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketPolicy, Aws::Client::RejectedCallOutcome<GetBucketPolicyOutcome>(), this, request);
+}
+
+GetBucketPolicyOutcomeCallable S3Client::GetBucketPolicyCallable(GetBucketPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketPolicy, Aws::Client::RejectedCallOutcome<GetBucketPolicyOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetBucketPolicyAsync(const GetBucketPolicyRequest& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetBucketPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketPolicyOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetBucketPolicyAsync(GetBucketPolicyRequest&& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetBucketPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetBucketPolicyAsyncHelper(const GetBucketPolicyRequest& request, const GetBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -819,11 +1030,11 @@ void S3Client::GetBucketPolicyAsyncHelper(const GetBucketPolicyRequest& request,
 
 GetBucketReplicationOutcome S3Client::GetBucketReplication(const GetBucketReplicationRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?replication";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?replication");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetBucketReplicationOutcome(GetBucketReplicationResult(outcome.GetResult()));
@@ -836,12 +1047,22 @@ GetBucketReplicationOutcome S3Client::GetBucketReplication(const GetBucketReplic
 
 GetBucketReplicationOutcomeCallable S3Client::GetBucketReplicationCallable(const GetBucketReplicationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketReplication, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketReplication, Aws::Client::RejectedCallOutcome<GetBucketReplicationOutcome>(), this, request);
+}
+
+GetBucketReplicationOutcomeCallable S3Client::GetBucketReplicationCallable(GetBucketReplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketReplication, Aws::Client::RejectedCallOutcome<GetBucketReplicationOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetBucketReplicationAsync(const GetBucketReplicationRequest& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketReplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetBucketReplicationAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketReplicationOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetBucketReplicationAsync(GetBucketReplicationRequest&& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetBucketReplicationAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketReplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetBucketReplicationAsyncHelper(const GetBucketReplicationRequest& request, const GetBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -851,11 +1072,11 @@ void S3Client::GetBucketReplicationAsyncHelper(const GetBucketReplicationRequest
 
 GetBucketRequestPaymentOutcome S3Client::GetBucketRequestPayment(const GetBucketRequestPaymentRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?requestPayment";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?requestPayment");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetBucketRequestPaymentOutcome(GetBucketRequestPaymentResult(outcome.GetResult()));
@@ -868,12 +1089,22 @@ GetBucketRequestPaymentOutcome S3Client::GetBucketRequestPayment(const GetBucket
 
 GetBucketRequestPaymentOutcomeCallable S3Client::GetBucketRequestPaymentCallable(const GetBucketRequestPaymentRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketRequestPayment, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketRequestPayment, Aws::Client::RejectedCallOutcome<GetBucketRequestPaymentOutcome>(), this, request);
+}
+
+GetBucketRequestPaymentOutcomeCallable S3Client::GetBucketRequestPaymentCallable(GetBucketRequestPaymentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketRequestPayment, Aws::Client::RejectedCallOutcome<GetBucketRequestPaymentOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetBucketRequestPaymentAsync(const GetBucketRequestPaymentRequest& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketRequestPaymentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetBucketRequestPaymentAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketRequestPaymentOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetBucketRequestPaymentAsync(GetBucketRequestPaymentRequest&& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetBucketRequestPaymentAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketRequestPaymentOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetBucketRequestPaymentAsyncHelper(const GetBucketRequestPaymentRequest& request, const GetBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -883,11 +1114,11 @@ void S3Client::GetBucketRequestPaymentAsyncHelper(const GetBucketRequestPaymentR
 
 GetBucketTaggingOutcome S3Client::GetBucketTagging(const GetBucketTaggingRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?tagging";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?tagging");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetBucketTaggingOutcome(GetBucketTaggingResult(outcome.GetResult()));
@@ -900,12 +1131,22 @@ GetBucketTaggingOutcome S3Client::GetBucketTagging(const GetBucketTaggingRequest
 
 GetBucketTaggingOutcomeCallable S3Client::GetBucketTaggingCallable(const GetBucketTaggingRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketTagging, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketTagging, Aws::Client::RejectedCallOutcome<GetBucketTaggingOutcome>(), this, request);
+}
+
+GetBucketTaggingOutcomeCallable S3Client::GetBucketTaggingCallable(GetBucketTaggingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketTagging, Aws::Client::RejectedCallOutcome<GetBucketTaggingOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetBucketTaggingAsync(const GetBucketTaggingRequest& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketTaggingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetBucketTaggingAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketTaggingOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetBucketTaggingAsync(GetBucketTaggingRequest&& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetBucketTaggingAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketTaggingOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetBucketTaggingAsyncHelper(const GetBucketTaggingRequest& request, const GetBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -915,11 +1156,11 @@ void S3Client::GetBucketTaggingAsyncHelper(const GetBucketTaggingRequest& reques
 
 GetBucketVersioningOutcome S3Client::GetBucketVersioning(const GetBucketVersioningRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?versioning";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?versioning");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetBucketVersioningOutcome(GetBucketVersioningResult(outcome.GetResult()));
@@ -932,12 +1173,22 @@ GetBucketVersioningOutcome S3Client::GetBucketVersioning(const GetBucketVersioni
 
 GetBucketVersioningOutcomeCallable S3Client::GetBucketVersioningCallable(const GetBucketVersioningRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketVersioning, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketVersioning, Aws::Client::RejectedCallOutcome<GetBucketVersioningOutcome>(), this, request);
+}
+
+GetBucketVersioningOutcomeCallable S3Client::GetBucketVersioningCallable(GetBucketVersioningRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketVersioning, Aws::Client::RejectedCallOutcome<GetBucketVersioningOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetBucketVersioningAsync(const GetBucketVersioningRequest& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketVersioningAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetBucketVersioningAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketVersioningOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetBucketVersioningAsync(GetBucketVersioningRequest&& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetBucketVersioningAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketVersioningOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetBucketVersioningAsyncHelper(const GetBucketVersioningRequest& request, const GetBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -947,11 +1198,11 @@ void S3Client::GetBucketVersioningAsyncHelper(const GetBucketVersioningRequest&
 
 GetBucketWebsiteOutcome S3Client::GetBucketWebsite(const GetBucketWebsiteRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?website";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?website");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetBucketWebsiteOutcome(GetBucketWebsiteResult(outcome.GetResult()));
@@ -964,12 +1215,22 @@ GetBucketWebsiteOutcome S3Client::GetBucketWebsite(const GetBucketWebsiteRequest
 
 GetBucketWebsiteOutcomeCallable S3Client::GetBucketWebsiteCallable(const GetBucketWebsiteRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetBucketWebsite, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketWebsite, Aws::Client::RejectedCallOutcome<GetBucketWebsiteOutcome>(), this, request);
+}
+
+GetBucketWebsiteOutcomeCallable S3Client::GetBucketWebsiteCallable(GetBucketWebsiteRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetBucketWebsite, Aws::Client::RejectedCallOutcome<GetBucketWebsiteOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetBucketWebsiteAsync(const GetBucketWebsiteRequest& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetBucketWebsiteAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetBucketWebsiteAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketWebsiteOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetBucketWebsiteAsync(GetBucketWebsiteRequest&& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetBucketWebsiteAsyncHelper, Aws::Client::RejectedAsyncCall<GetBucketWebsiteOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetBucketWebsiteAsyncHelper(const GetBucketWebsiteRequest& request, const GetBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -979,12 +1240,12 @@ void S3Client::GetBucketWebsiteAsyncHelper(const GetBucketWebsiteRequest& reques
 
 GetObjectOutcome S3Client::GetObject(const GetObjectRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetObjectOutcome(GetObjectResult(outcome.GetResultWithOwnership()));
@@ -997,12 +1258,22 @@ GetObjectOutcome S3Client::GetObject(const GetObjectRequest& request) const
 
 GetObjectOutcomeCallable S3Client::GetObjectCallable(const GetObjectRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetObject, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetObject, Aws::Client::RejectedCallOutcome<GetObjectOutcome>(), this, request);
+}
+
+GetObjectOutcomeCallable S3Client::GetObjectCallable(GetObjectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetObject, Aws::Client::RejectedCallOutcome<GetObjectOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetObjectAsync(const GetObjectRequest& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetObjectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetObjectAsyncHelper, Aws::Client::RejectedAsyncCall<GetObjectOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetObjectAsync(GetObjectRequest&& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetObjectAsyncHelper, Aws::Client::RejectedAsyncCall<GetObjectOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetObjectAsyncHelper(const GetObjectRequest& request, const GetObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1012,13 +1283,13 @@ void S3Client::GetObjectAsyncHelper(const GetObjectRequest& request, const GetOb
 
 GetObjectAclOutcome S3Client::GetObjectAcl(const GetObjectAclRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  ss << "?acl";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  uri.Append("?acl");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetObjectAclOutcome(GetObjectAclResult(outcome.GetResult()));
@@ -1031,12 +1302,22 @@ GetObjectAclOutcome S3Client::GetObjectAcl(const GetObjectAclRequest& request) c
 
 GetObjectAclOutcomeCallable S3Client::GetObjectAclCallable(const GetObjectAclRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetObjectAcl, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetObjectAcl, Aws::Client::RejectedCallOutcome<GetObjectAclOutcome>(), this, request);
+}
+
+GetObjectAclOutcomeCallable S3Client::GetObjectAclCallable(GetObjectAclRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetObjectAcl, Aws::Client::RejectedCallOutcome<GetObjectAclOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetObjectAclAsync(const GetObjectAclRequest& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetObjectAclAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetObjectAclAsyncHelper, Aws::Client::RejectedAsyncCall<GetObjectAclOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetObjectAclAsync(GetObjectAclRequest&& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetObjectAclAsyncHelper, Aws::Client::RejectedAsyncCall<GetObjectAclOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetObjectAclAsyncHelper(const GetObjectAclRequest& request, const GetObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1046,13 +1327,13 @@ void S3Client::GetObjectAclAsyncHelper(const GetObjectAclRequest& request, const
 
 GetObjectTorrentOutcome S3Client::GetObjectTorrent(const GetObjectTorrentRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  ss << "?torrent";
-  StreamOutcome outcome = MakeRequestWithUnparsedResponse(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  uri.Append("?torrent");
+  StreamOutcome outcome = MakeRequestWithUnparsedResponse(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return GetObjectTorrentOutcome(GetObjectTorrentResult(outcome.GetResultWithOwnership()));
@@ -1065,12 +1346,22 @@ GetObjectTorrentOutcome S3Client::GetObjectTorrent(const GetObjectTorrentRequest
 
 GetObjectTorrentOutcomeCallable S3Client::GetObjectTorrentCallable(const GetObjectTorrentRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::GetObjectTorrent, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::GetObjectTorrent, Aws::Client::RejectedCallOutcome<GetObjectTorrentOutcome>(), this, request);
+}
+
+GetObjectTorrentOutcomeCallable S3Client::GetObjectTorrentCallable(GetObjectTorrentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::GetObjectTorrent, Aws::Client::RejectedCallOutcome<GetObjectTorrentOutcome>(), this, std::move(request));
 }
 
 void S3Client::GetObjectTorrentAsync(const GetObjectTorrentRequest& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::GetObjectTorrentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::GetObjectTorrentAsyncHelper, Aws::Client::RejectedAsyncCall<GetObjectTorrentOutcome>(), this, request, handler, context);
+}
+
+void S3Client::GetObjectTorrentAsync(GetObjectTorrentRequest&& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::GetObjectTorrentAsyncHelper, Aws::Client::RejectedAsyncCall<GetObjectTorrentOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::GetObjectTorrentAsyncHelper(const GetObjectTorrentRequest& request, const GetObjectTorrentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1080,10 +1371,10 @@ void S3Client::GetObjectTorrentAsyncHelper(const GetObjectTorrentRequest& reques
 
 HeadBucketOutcome S3Client::HeadBucket(const HeadBucketRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_HEAD);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_HEAD);
   if(outcome.IsSuccess())
   {
     return HeadBucketOutcome(NoResult());
@@ -1096,12 +1387,22 @@ HeadBucketOutcome S3Client::HeadBucket(const HeadBucketRequest& request) const
 
 HeadBucketOutcomeCallable S3Client::HeadBucketCallable(const HeadBucketRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::HeadBucket, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::HeadBucket, Aws::Client::RejectedCallOutcome<HeadBucketOutcome>(), this, request);
+}
+
+HeadBucketOutcomeCallable S3Client::HeadBucketCallable(HeadBucketRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::HeadBucket, Aws::Client::RejectedCallOutcome<HeadBucketOutcome>(), this, std::move(request));
 }
 
 void S3Client::HeadBucketAsync(const HeadBucketRequest& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::HeadBucketAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::HeadBucketAsyncHelper, Aws::Client::RejectedAsyncCall<HeadBucketOutcome>(), this, request, handler, context);
+}
+
+void S3Client::HeadBucketAsync(HeadBucketRequest&& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::HeadBucketAsyncHelper, Aws::Client::RejectedAsyncCall<HeadBucketOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::HeadBucketAsyncHelper(const HeadBucketRequest& request, const HeadBucketResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1111,12 +1412,12 @@ void S3Client::HeadBucketAsyncHelper(const HeadBucketRequest& request, const Hea
 
 HeadObjectOutcome S3Client::HeadObject(const HeadObjectRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_HEAD);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_HEAD);
   if(outcome.IsSuccess())
   {
     return HeadObjectOutcome(HeadObjectResult(outcome.GetResult()));
@@ -1129,12 +1430,22 @@ HeadObjectOutcome S3Client::HeadObject(const HeadObjectRequest& request) const
 
 HeadObjectOutcomeCallable S3Client::HeadObjectCallable(const HeadObjectRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::HeadObject, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::HeadObject, Aws::Client::RejectedCallOutcome<HeadObjectOutcome>(), this, request);
+}
+
+HeadObjectOutcomeCallable S3Client::HeadObjectCallable(HeadObjectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::HeadObject, Aws::Client::RejectedCallOutcome<HeadObjectOutcome>(), this, std::move(request));
 }
 
 void S3Client::HeadObjectAsync(const HeadObjectRequest& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::HeadObjectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::HeadObjectAsyncHelper, Aws::Client::RejectedAsyncCall<HeadObjectOutcome>(), this, request, handler, context);
+}
+
+void S3Client::HeadObjectAsync(HeadObjectRequest&& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::HeadObjectAsyncHelper, Aws::Client::RejectedAsyncCall<HeadObjectOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::HeadObjectAsyncHelper(const HeadObjectRequest& request, const HeadObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1144,9 +1455,9 @@ void S3Client::HeadObjectAsyncHelper(const HeadObjectRequest& request, const Hea
 
 ListBucketsOutcome S3Client::ListBuckets() const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  XmlOutcome outcome = MakeRequest(ss.str(), HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListBucketsOutcome(ListBucketsResult(outcome.GetResult()));
@@ -1159,12 +1470,12 @@ ListBucketsOutcome S3Client::ListBuckets() const
 
 ListBucketsOutcomeCallable S3Client::ListBucketsCallable() const
 {
-  return std::async(std::launch::async, &S3Client::ListBuckets, this);
+  return m_executor->SubmitWithFuture(&S3Client::ListBuckets, Aws::Client::RejectedCallOutcome<ListBucketsOutcome>(), this);
 }
 
 void S3Client::ListBucketsAsync(const ListBucketsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::ListBucketsAsyncHelper, this, handler, context);
+  m_executor->SubmitOrReject(&S3Client::ListBucketsAsyncHelper, Aws::Client::RejectedAsyncCall<ListBucketsOutcome>(), this, handler, context);
 }
 
 void S3Client::ListBucketsAsyncHelper(const ListBucketsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1174,11 +1485,11 @@ void S3Client::ListBucketsAsyncHelper(const ListBucketsResponseReceivedHandler&
 
 ListMultipartUploadsOutcome S3Client::ListMultipartUploads(const ListMultipartUploadsRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?uploads";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?uploads");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListMultipartUploadsOutcome(ListMultipartUploadsResult(outcome.GetResult()));
@@ -1191,12 +1502,22 @@ ListMultipartUploadsOutcome S3Client::ListMultipartUploads(const ListMultipartUp
 
 ListMultipartUploadsOutcomeCallable S3Client::ListMultipartUploadsCallable(const ListMultipartUploadsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::ListMultipartUploads, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::ListMultipartUploads, Aws::Client::RejectedCallOutcome<ListMultipartUploadsOutcome>(), this, request);
+}
+
+ListMultipartUploadsOutcomeCallable S3Client::ListMultipartUploadsCallable(ListMultipartUploadsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::ListMultipartUploads, Aws::Client::RejectedCallOutcome<ListMultipartUploadsOutcome>(), this, std::move(request));
 }
 
 void S3Client::ListMultipartUploadsAsync(const ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::ListMultipartUploadsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::ListMultipartUploadsAsyncHelper, Aws::Client::RejectedAsyncCall<ListMultipartUploadsOutcome>(), this, request, handler, context);
+}
+
+void S3Client::ListMultipartUploadsAsync(ListMultipartUploadsRequest&& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::ListMultipartUploadsAsyncHelper, Aws::Client::RejectedAsyncCall<ListMultipartUploadsOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::ListMultipartUploadsAsyncHelper(const ListMultipartUploadsRequest& request, const ListMultipartUploadsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1206,11 +1527,11 @@ void S3Client::ListMultipartUploadsAsyncHelper(const ListMultipartUploadsRequest
 
 ListObjectVersionsOutcome S3Client::ListObjectVersions(const ListObjectVersionsRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?versions";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?versions");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListObjectVersionsOutcome(ListObjectVersionsResult(outcome.GetResult()));
@@ -1223,12 +1544,22 @@ ListObjectVersionsOutcome S3Client::ListObjectVersions(const ListObjectVersionsR
 
 ListObjectVersionsOutcomeCallable S3Client::ListObjectVersionsCallable(const ListObjectVersionsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::ListObjectVersions, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::ListObjectVersions, Aws::Client::RejectedCallOutcome<ListObjectVersionsOutcome>(), this, request);
+}
+
+ListObjectVersionsOutcomeCallable S3Client::ListObjectVersionsCallable(ListObjectVersionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::ListObjectVersions, Aws::Client::RejectedCallOutcome<ListObjectVersionsOutcome>(), this, std::move(request));
 }
 
 void S3Client::ListObjectVersionsAsync(const ListObjectVersionsRequest& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::ListObjectVersionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::ListObjectVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListObjectVersionsOutcome>(), this, request, handler, context);
+}
+
+void S3Client::ListObjectVersionsAsync(ListObjectVersionsRequest&& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::ListObjectVersionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListObjectVersionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::ListObjectVersionsAsyncHelper(const ListObjectVersionsRequest& request, const ListObjectVersionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1238,10 +1569,10 @@ void S3Client::ListObjectVersionsAsyncHelper(const ListObjectVersionsRequest& re
 
 ListObjectsOutcome S3Client::ListObjects(const ListObjectsRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListObjectsOutcome(ListObjectsResult(outcome.GetResult()));
@@ -1254,12 +1585,22 @@ ListObjectsOutcome S3Client::ListObjects(const ListObjectsRequest& request) cons
 
 ListObjectsOutcomeCallable S3Client::ListObjectsCallable(const ListObjectsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::ListObjects, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::ListObjects, Aws::Client::RejectedCallOutcome<ListObjectsOutcome>(), this, request);
+}
+
+ListObjectsOutcomeCallable S3Client::ListObjectsCallable(ListObjectsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::ListObjects, Aws::Client::RejectedCallOutcome<ListObjectsOutcome>(), this, std::move(request));
 }
 
 void S3Client::ListObjectsAsync(const ListObjectsRequest& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::ListObjectsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::ListObjectsAsyncHelper, Aws::Client::RejectedAsyncCall<ListObjectsOutcome>(), this, request, handler, context);
+}
+
+void S3Client::ListObjectsAsync(ListObjectsRequest&& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::ListObjectsAsyncHelper, Aws::Client::RejectedAsyncCall<ListObjectsOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::ListObjectsAsyncHelper(const ListObjectsRequest& request, const ListObjectsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1269,12 +1610,12 @@ void S3Client::ListObjectsAsyncHelper(const ListObjectsRequest& request, const L
 
 ListPartsOutcome S3Client::ListParts(const ListPartsRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_GET);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_GET);
   if(outcome.IsSuccess())
   {
     return ListPartsOutcome(ListPartsResult(outcome.GetResult()));
@@ -1287,12 +1628,22 @@ ListPartsOutcome S3Client::ListParts(const ListPartsRequest& request) const
 
 ListPartsOutcomeCallable S3Client::ListPartsCallable(const ListPartsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::ListParts, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::ListParts, Aws::Client::RejectedCallOutcome<ListPartsOutcome>(), this, request);
+}
+
+ListPartsOutcomeCallable S3Client::ListPartsCallable(ListPartsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::ListParts, Aws::Client::RejectedCallOutcome<ListPartsOutcome>(), this, std::move(request));
 }
 
 void S3Client::ListPartsAsync(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::ListPartsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::ListPartsAsyncHelper, Aws::Client::RejectedAsyncCall<ListPartsOutcome>(), this, request, handler, context);
+}
+
+void S3Client::ListPartsAsync(ListPartsRequest&& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::ListPartsAsyncHelper, Aws::Client::RejectedAsyncCall<ListPartsOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::ListPartsAsyncHelper(const ListPartsRequest& request, const ListPartsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1302,11 +1653,11 @@ void S3Client::ListPartsAsyncHelper(const ListPartsRequest& request, const ListP
 
 PutBucketAclOutcome S3Client::PutBucketAcl(const PutBucketAclRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?acl";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?acl");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return PutBucketAclOutcome(NoResult());
@@ -1319,12 +1670,22 @@ PutBucketAclOutcome S3Client::PutBucketAcl(const PutBucketAclRequest& request) c
 
 PutBucketAclOutcomeCallable S3Client::PutBucketAclCallable(const PutBucketAclRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketAcl, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketAcl, Aws::Client::RejectedCallOutcome<PutBucketAclOutcome>(), this, request);
+}
+
+PutBucketAclOutcomeCallable S3Client::PutBucketAclCallable(PutBucketAclRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketAcl, Aws::Client::RejectedCallOutcome<PutBucketAclOutcome>(), this, std::move(request));
 }
 
 void S3Client::PutBucketAclAsync(const PutBucketAclRequest& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketAclAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::PutBucketAclAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketAclOutcome>(), this, request, handler, context);
+}
+
+void S3Client::PutBucketAclAsync(PutBucketAclRequest&& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::PutBucketAclAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketAclOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::PutBucketAclAsyncHelper(const PutBucketAclRequest& request, const PutBucketAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1334,11 +1695,11 @@ void S3Client::PutBucketAclAsyncHelper(const PutBucketAclRequest& request, const
 
 PutBucketCorsOutcome S3Client::PutBucketCors(const PutBucketCorsRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?cors";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?cors");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return PutBucketCorsOutcome(NoResult());
@@ -1351,12 +1712,22 @@ PutBucketCorsOutcome S3Client::PutBucketCors(const PutBucketCorsRequest& request
 
 PutBucketCorsOutcomeCallable S3Client::PutBucketCorsCallable(const PutBucketCorsRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketCors, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketCors, Aws::Client::RejectedCallOutcome<PutBucketCorsOutcome>(), this, request);
+}
+
+PutBucketCorsOutcomeCallable S3Client::PutBucketCorsCallable(PutBucketCorsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketCors, Aws::Client::RejectedCallOutcome<PutBucketCorsOutcome>(), this, std::move(request));
 }
 
 void S3Client::PutBucketCorsAsync(const PutBucketCorsRequest& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketCorsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::PutBucketCorsAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketCorsOutcome>(), this, request, handler, context);
+}
+
+void S3Client::PutBucketCorsAsync(PutBucketCorsRequest&& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::PutBucketCorsAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketCorsOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::PutBucketCorsAsyncHelper(const PutBucketCorsRequest& request, const PutBucketCorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1366,11 +1737,11 @@ void S3Client::PutBucketCorsAsyncHelper(const PutBucketCorsRequest& request, con
 
 PutBucketLifecycleConfigurationOutcome S3Client::PutBucketLifecycleConfiguration(const PutBucketLifecycleConfigurationRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?lifecycle";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?lifecycle");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return PutBucketLifecycleConfigurationOutcome(NoResult());
@@ -1383,12 +1754,22 @@ PutBucketLifecycleConfigurationOutcome S3Client::PutBucketLifecycleConfiguration
 
 PutBucketLifecycleConfigurationOutcomeCallable S3Client::PutBucketLifecycleConfigurationCallable(const PutBucketLifecycleConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketLifecycleConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketLifecycleConfiguration, Aws::Client::RejectedCallOutcome<PutBucketLifecycleConfigurationOutcome>(), this, request);
+}
+
+PutBucketLifecycleConfigurationOutcomeCallable S3Client::PutBucketLifecycleConfigurationCallable(PutBucketLifecycleConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketLifecycleConfiguration, Aws::Client::RejectedCallOutcome<PutBucketLifecycleConfigurationOutcome>(), this, std::move(request));
 }
 
 void S3Client::PutBucketLifecycleConfigurationAsync(const PutBucketLifecycleConfigurationRequest& request, const PutBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketLifecycleConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::PutBucketLifecycleConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketLifecycleConfigurationOutcome>(), this, request, handler, context);
+}
+
+void S3Client::PutBucketLifecycleConfigurationAsync(PutBucketLifecycleConfigurationRequest&& request, const PutBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::PutBucketLifecycleConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketLifecycleConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::PutBucketLifecycleConfigurationAsyncHelper(const PutBucketLifecycleConfigurationRequest& request, const PutBucketLifecycleConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1398,11 +1779,11 @@ void S3Client::PutBucketLifecycleConfigurationAsyncHelper(const PutBucketLifecyc
 
 PutBucketLoggingOutcome S3Client::PutBucketLogging(const PutBucketLoggingRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?logging";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?logging");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return PutBucketLoggingOutcome(NoResult());
@@ -1415,12 +1796,22 @@ PutBucketLoggingOutcome S3Client::PutBucketLogging(const PutBucketLoggingRequest
 
 PutBucketLoggingOutcomeCallable S3Client::PutBucketLoggingCallable(const PutBucketLoggingRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketLogging, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketLogging, Aws::Client::RejectedCallOutcome<PutBucketLoggingOutcome>(), this, request);
+}
+
+PutBucketLoggingOutcomeCallable S3Client::PutBucketLoggingCallable(PutBucketLoggingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketLogging, Aws::Client::RejectedCallOutcome<PutBucketLoggingOutcome>(), this, std::move(request));
 }
 
 void S3Client::PutBucketLoggingAsync(const PutBucketLoggingRequest& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketLoggingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::PutBucketLoggingAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketLoggingOutcome>(), this, request, handler, context);
+}
+
+void S3Client::PutBucketLoggingAsync(PutBucketLoggingRequest&& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::PutBucketLoggingAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketLoggingOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::PutBucketLoggingAsyncHelper(const PutBucketLoggingRequest& request, const PutBucketLoggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1430,11 +1821,11 @@ void S3Client::PutBucketLoggingAsyncHelper(const PutBucketLoggingRequest& reques
 
 PutBucketNotificationConfigurationOutcome S3Client::PutBucketNotificationConfiguration(const PutBucketNotificationConfigurationRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?notification";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?notification");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return PutBucketNotificationConfigurationOutcome(NoResult());
@@ -1447,12 +1838,22 @@ PutBucketNotificationConfigurationOutcome S3Client::PutBucketNotificationConfigu
 
 PutBucketNotificationConfigurationOutcomeCallable S3Client::PutBucketNotificationConfigurationCallable(const PutBucketNotificationConfigurationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketNotificationConfiguration, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketNotificationConfiguration, Aws::Client::RejectedCallOutcome<PutBucketNotificationConfigurationOutcome>(), this, request);
+}
+
+PutBucketNotificationConfigurationOutcomeCallable S3Client::PutBucketNotificationConfigurationCallable(PutBucketNotificationConfigurationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketNotificationConfiguration, Aws::Client::RejectedCallOutcome<PutBucketNotificationConfigurationOutcome>(), this, std::move(request));
 }
 
 void S3Client::PutBucketNotificationConfigurationAsync(const PutBucketNotificationConfigurationRequest& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketNotificationConfigurationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::PutBucketNotificationConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketNotificationConfigurationOutcome>(), this, request, handler, context);
+}
+
+void S3Client::PutBucketNotificationConfigurationAsync(PutBucketNotificationConfigurationRequest&& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::PutBucketNotificationConfigurationAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketNotificationConfigurationOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::PutBucketNotificationConfigurationAsyncHelper(const PutBucketNotificationConfigurationRequest& request, const PutBucketNotificationConfigurationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1462,11 +1863,11 @@ void S3Client::PutBucketNotificationConfigurationAsyncHelper(const PutBucketNoti
 
 PutBucketPolicyOutcome S3Client::PutBucketPolicy(const PutBucketPolicyRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?policy";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?policy");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return PutBucketPolicyOutcome(NoResult());
@@ -1479,12 +1880,22 @@ PutBucketPolicyOutcome S3Client::PutBucketPolicy(const PutBucketPolicyRequest& r
 
 PutBucketPolicyOutcomeCallable S3Client::PutBucketPolicyCallable(const PutBucketPolicyRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketPolicy, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketPolicy, Aws::Client::RejectedCallOutcome<PutBucketPolicyOutcome>(), this, request);
+}
+
+PutBucketPolicyOutcomeCallable S3Client::PutBucketPolicyCallable(PutBucketPolicyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketPolicy, Aws::Client::RejectedCallOutcome<PutBucketPolicyOutcome>(), this, std::move(request));
 }
 
 void S3Client::PutBucketPolicyAsync(const PutBucketPolicyRequest& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketPolicyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::PutBucketPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketPolicyOutcome>(), this, request, handler, context);
+}
+
+void S3Client::PutBucketPolicyAsync(PutBucketPolicyRequest&& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::PutBucketPolicyAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketPolicyOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::PutBucketPolicyAsyncHelper(const PutBucketPolicyRequest& request, const PutBucketPolicyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1494,11 +1905,11 @@ void S3Client::PutBucketPolicyAsyncHelper(const PutBucketPolicyRequest& request,
 
 PutBucketReplicationOutcome S3Client::PutBucketReplication(const PutBucketReplicationRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?replication";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?replication");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return PutBucketReplicationOutcome(NoResult());
@@ -1511,12 +1922,22 @@ PutBucketReplicationOutcome S3Client::PutBucketReplication(const PutBucketReplic
 
 PutBucketReplicationOutcomeCallable S3Client::PutBucketReplicationCallable(const PutBucketReplicationRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketReplication, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketReplication, Aws::Client::RejectedCallOutcome<PutBucketReplicationOutcome>(), this, request);
+}
+
+PutBucketReplicationOutcomeCallable S3Client::PutBucketReplicationCallable(PutBucketReplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketReplication, Aws::Client::RejectedCallOutcome<PutBucketReplicationOutcome>(), this, std::move(request));
 }
 
 void S3Client::PutBucketReplicationAsync(const PutBucketReplicationRequest& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketReplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::PutBucketReplicationAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketReplicationOutcome>(), this, request, handler, context);
+}
+
+void S3Client::PutBucketReplicationAsync(PutBucketReplicationRequest&& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::PutBucketReplicationAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketReplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::PutBucketReplicationAsyncHelper(const PutBucketReplicationRequest& request, const PutBucketReplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1526,11 +1947,11 @@ void S3Client::PutBucketReplicationAsyncHelper(const PutBucketReplicationRequest
 
 PutBucketRequestPaymentOutcome S3Client::PutBucketRequestPayment(const PutBucketRequestPaymentRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?requestPayment";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?requestPayment");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return PutBucketRequestPaymentOutcome(NoResult());
@@ -1543,12 +1964,22 @@ PutBucketRequestPaymentOutcome S3Client::PutBucketRequestPayment(const PutBucket
 
 PutBucketRequestPaymentOutcomeCallable S3Client::PutBucketRequestPaymentCallable(const PutBucketRequestPaymentRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketRequestPayment, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketRequestPayment, Aws::Client::RejectedCallOutcome<PutBucketRequestPaymentOutcome>(), this, request);
+}
+
+PutBucketRequestPaymentOutcomeCallable S3Client::PutBucketRequestPaymentCallable(PutBucketRequestPaymentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketRequestPayment, Aws::Client::RejectedCallOutcome<PutBucketRequestPaymentOutcome>(), this, std::move(request));
 }
 
 void S3Client::PutBucketRequestPaymentAsync(const PutBucketRequestPaymentRequest& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketRequestPaymentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::PutBucketRequestPaymentAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketRequestPaymentOutcome>(), this, request, handler, context);
+}
+
+void S3Client::PutBucketRequestPaymentAsync(PutBucketRequestPaymentRequest&& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::PutBucketRequestPaymentAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketRequestPaymentOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::PutBucketRequestPaymentAsyncHelper(const PutBucketRequestPaymentRequest& request, const PutBucketRequestPaymentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1558,11 +1989,11 @@ void S3Client::PutBucketRequestPaymentAsyncHelper(const PutBucketRequestPaymentR
 
 PutBucketTaggingOutcome S3Client::PutBucketTagging(const PutBucketTaggingRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?tagging";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?tagging");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return PutBucketTaggingOutcome(NoResult());
@@ -1575,12 +2006,22 @@ PutBucketTaggingOutcome S3Client::PutBucketTagging(const PutBucketTaggingRequest
 
 PutBucketTaggingOutcomeCallable S3Client::PutBucketTaggingCallable(const PutBucketTaggingRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketTagging, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketTagging, Aws::Client::RejectedCallOutcome<PutBucketTaggingOutcome>(), this, request);
+}
+
+PutBucketTaggingOutcomeCallable S3Client::PutBucketTaggingCallable(PutBucketTaggingRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketTagging, Aws::Client::RejectedCallOutcome<PutBucketTaggingOutcome>(), this, std::move(request));
 }
 
 void S3Client::PutBucketTaggingAsync(const PutBucketTaggingRequest& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketTaggingAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::PutBucketTaggingAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketTaggingOutcome>(), this, request, handler, context);
+}
+
+void S3Client::PutBucketTaggingAsync(PutBucketTaggingRequest&& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::PutBucketTaggingAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketTaggingOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::PutBucketTaggingAsyncHelper(const PutBucketTaggingRequest& request, const PutBucketTaggingResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1590,11 +2031,11 @@ void S3Client::PutBucketTaggingAsyncHelper(const PutBucketTaggingRequest& reques
 
 PutBucketVersioningOutcome S3Client::PutBucketVersioning(const PutBucketVersioningRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?versioning";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?versioning");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return PutBucketVersioningOutcome(NoResult());
@@ -1607,12 +2048,22 @@ PutBucketVersioningOutcome S3Client::PutBucketVersioning(const PutBucketVersioni
 
 PutBucketVersioningOutcomeCallable S3Client::PutBucketVersioningCallable(const PutBucketVersioningRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketVersioning, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketVersioning, Aws::Client::RejectedCallOutcome<PutBucketVersioningOutcome>(), this, request);
+}
+
+PutBucketVersioningOutcomeCallable S3Client::PutBucketVersioningCallable(PutBucketVersioningRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketVersioning, Aws::Client::RejectedCallOutcome<PutBucketVersioningOutcome>(), this, std::move(request));
 }
 
 void S3Client::PutBucketVersioningAsync(const PutBucketVersioningRequest& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketVersioningAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::PutBucketVersioningAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketVersioningOutcome>(), this, request, handler, context);
+}
+
+void S3Client::PutBucketVersioningAsync(PutBucketVersioningRequest&& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::PutBucketVersioningAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketVersioningOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::PutBucketVersioningAsyncHelper(const PutBucketVersioningRequest& request, const PutBucketVersioningResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1622,11 +2073,11 @@ void S3Client::PutBucketVersioningAsyncHelper(const PutBucketVersioningRequest&
 
 PutBucketWebsiteOutcome S3Client::PutBucketWebsite(const PutBucketWebsiteRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "?website";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("?website");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return PutBucketWebsiteOutcome(NoResult());
@@ -1639,12 +2090,22 @@ PutBucketWebsiteOutcome S3Client::PutBucketWebsite(const PutBucketWebsiteRequest
 
 PutBucketWebsiteOutcomeCallable S3Client::PutBucketWebsiteCallable(const PutBucketWebsiteRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutBucketWebsite, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketWebsite, Aws::Client::RejectedCallOutcome<PutBucketWebsiteOutcome>(), this, request);
+}
+
+PutBucketWebsiteOutcomeCallable S3Client::PutBucketWebsiteCallable(PutBucketWebsiteRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::PutBucketWebsite, Aws::Client::RejectedCallOutcome<PutBucketWebsiteOutcome>(), this, std::move(request));
 }
 
 void S3Client::PutBucketWebsiteAsync(const PutBucketWebsiteRequest& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutBucketWebsiteAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::PutBucketWebsiteAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketWebsiteOutcome>(), this, request, handler, context);
+}
+
+void S3Client::PutBucketWebsiteAsync(PutBucketWebsiteRequest&& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::PutBucketWebsiteAsyncHelper, Aws::Client::RejectedAsyncCall<PutBucketWebsiteOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::PutBucketWebsiteAsyncHelper(const PutBucketWebsiteRequest& request, const PutBucketWebsiteResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1654,12 +2115,12 @@ void S3Client::PutBucketWebsiteAsyncHelper(const PutBucketWebsiteRequest& reques
 
 PutObjectOutcome S3Client::PutObject(const PutObjectRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return PutObjectOutcome(PutObjectResult(outcome.GetResult()));
@@ -1672,12 +2133,22 @@ PutObjectOutcome S3Client::PutObject(const PutObjectRequest& request) const
 
 PutObjectOutcomeCallable S3Client::PutObjectCallable(const PutObjectRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutObject, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::PutObject, Aws::Client::RejectedCallOutcome<PutObjectOutcome>(), this, request);
+}
+
+PutObjectOutcomeCallable S3Client::PutObjectCallable(PutObjectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::PutObject, Aws::Client::RejectedCallOutcome<PutObjectOutcome>(), this, std::move(request));
 }
 
 void S3Client::PutObjectAsync(const PutObjectRequest& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutObjectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::PutObjectAsyncHelper, Aws::Client::RejectedAsyncCall<PutObjectOutcome>(), this, request, handler, context);
+}
+
+void S3Client::PutObjectAsync(PutObjectRequest&& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::PutObjectAsyncHelper, Aws::Client::RejectedAsyncCall<PutObjectOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::PutObjectAsyncHelper(const PutObjectRequest& request, const PutObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1687,13 +2158,13 @@ void S3Client::PutObjectAsyncHelper(const PutObjectRequest& request, const PutOb
 
 PutObjectAclOutcome S3Client::PutObjectAcl(const PutObjectAclRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  ss << "?acl";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  uri.Append("?acl");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return PutObjectAclOutcome(PutObjectAclResult(outcome.GetResult()));
@@ -1706,12 +2177,22 @@ PutObjectAclOutcome S3Client::PutObjectAcl(const PutObjectAclRequest& request) c
 
 PutObjectAclOutcomeCallable S3Client::PutObjectAclCallable(const PutObjectAclRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::PutObjectAcl, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::PutObjectAcl, Aws::Client::RejectedCallOutcome<PutObjectAclOutcome>(), this, request);
+}
+
+PutObjectAclOutcomeCallable S3Client::PutObjectAclCallable(PutObjectAclRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::PutObjectAcl, Aws::Client::RejectedCallOutcome<PutObjectAclOutcome>(), this, std::move(request));
 }
 
 void S3Client::PutObjectAclAsync(const PutObjectAclRequest& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::PutObjectAclAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::PutObjectAclAsyncHelper, Aws::Client::RejectedAsyncCall<PutObjectAclOutcome>(), this, request, handler, context);
+}
+
+void S3Client::PutObjectAclAsync(PutObjectAclRequest&& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::PutObjectAclAsyncHelper, Aws::Client::RejectedAsyncCall<PutObjectAclOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::PutObjectAclAsyncHelper(const PutObjectAclRequest& request, const PutObjectAclResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1721,13 +2202,13 @@ void S3Client::PutObjectAclAsyncHelper(const PutObjectAclRequest& request, const
 
 RestoreObjectOutcome S3Client::RestoreObject(const RestoreObjectRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  ss << "?restore";
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_POST);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  uri.Append("?restore");
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_POST);
   if(outcome.IsSuccess())
   {
     return RestoreObjectOutcome(RestoreObjectResult(outcome.GetResult()));
@@ -1740,12 +2221,22 @@ RestoreObjectOutcome S3Client::RestoreObject(const RestoreObjectRequest& request
 
 RestoreObjectOutcomeCallable S3Client::RestoreObjectCallable(const RestoreObjectRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::RestoreObject, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::RestoreObject, Aws::Client::RejectedCallOutcome<RestoreObjectOutcome>(), this, request);
+}
+
+RestoreObjectOutcomeCallable S3Client::RestoreObjectCallable(RestoreObjectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::RestoreObject, Aws::Client::RejectedCallOutcome<RestoreObjectOutcome>(), this, std::move(request));
 }
 
 void S3Client::RestoreObjectAsync(const RestoreObjectRequest& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::RestoreObjectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::RestoreObjectAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreObjectOutcome>(), this, request, handler, context);
+}
+
+void S3Client::RestoreObjectAsync(RestoreObjectRequest&& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::RestoreObjectAsyncHelper, Aws::Client::RejectedAsyncCall<RestoreObjectOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::RestoreObjectAsyncHelper(const RestoreObjectRequest& request, const RestoreObjectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1755,12 +2246,12 @@ void S3Client::RestoreObjectAsyncHelper(const RestoreObjectRequest& request, con
 
 UploadPartOutcome S3Client::UploadPart(const UploadPartRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return UploadPartOutcome(UploadPartResult(outcome.GetResult()));
@@ -1773,12 +2264,22 @@ UploadPartOutcome S3Client::UploadPart(const UploadPartRequest& request) const
 
 UploadPartOutcomeCallable S3Client::UploadPartCallable(const UploadPartRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::UploadPart, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::UploadPart, Aws::Client::RejectedCallOutcome<UploadPartOutcome>(), this, request);
+}
+
+UploadPartOutcomeCallable S3Client::UploadPartCallable(UploadPartRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::UploadPart, Aws::Client::RejectedCallOutcome<UploadPartOutcome>(), this, std::move(request));
 }
 
 void S3Client::UploadPartAsync(const UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::UploadPartAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::UploadPartAsyncHelper, Aws::Client::RejectedAsyncCall<UploadPartOutcome>(), this, request, handler, context);
+}
+
+void S3Client::UploadPartAsync(UploadPartRequest&& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::UploadPartAsyncHelper, Aws::Client::RejectedAsyncCall<UploadPartOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::UploadPartAsyncHelper(const UploadPartRequest& request, const UploadPartResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1788,12 +2289,12 @@ void S3Client::UploadPartAsyncHelper(const UploadPartRequest& request, const Upl
 
 UploadPartCopyOutcome S3Client::UploadPartCopy(const UploadPartCopyRequest& request) const
 {
-  Aws::StringStream ss;
-  ss << m_uri << "/";
-  ss << request.GetBucket();
-  ss << "/";
-  ss << request.GetKey();
-  XmlOutcome outcome = MakeRequest(ss.str(), request, HttpMethod::HTTP_PUT);
+  Aws::Utils::StringBuilder<> uri;
+  uri.Append(m_uri).Append("/");
+  uri.Append(request.GetBucket());
+  uri.Append("/");
+  uri.Append(request.GetKey());
+  XmlOutcome outcome = MakeRequest(uri.ToString(), request, HttpMethod::HTTP_PUT);
   if(outcome.IsSuccess())
   {
     return UploadPartCopyOutcome(UploadPartCopyResult(outcome.GetResult()));
@@ -1806,12 +2307,22 @@ UploadPartCopyOutcome S3Client::UploadPartCopy(const UploadPartCopyRequest& requ
 
 UploadPartCopyOutcomeCallable S3Client::UploadPartCopyCallable(const UploadPartCopyRequest& request) const
 {
-  return std::async(std::launch::async, &S3Client::UploadPartCopy, this, request);
+  return m_executor->SubmitWithFuture(&S3Client::UploadPartCopy, Aws::Client::RejectedCallOutcome<UploadPartCopyOutcome>(), this, request);
+}
+
+UploadPartCopyOutcomeCallable S3Client::UploadPartCopyCallable(UploadPartCopyRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&S3Client::UploadPartCopy, Aws::Client::RejectedCallOutcome<UploadPartCopyOutcome>(), this, std::move(request));
 }
 
 void S3Client::UploadPartCopyAsync(const UploadPartCopyRequest& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&S3Client::UploadPartCopyAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&S3Client::UploadPartCopyAsyncHelper, Aws::Client::RejectedAsyncCall<UploadPartCopyOutcome>(), this, request, handler, context);
+}
+
+void S3Client::UploadPartCopyAsync(UploadPartCopyRequest&& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&S3Client::UploadPartCopyAsyncHelper, Aws::Client::RejectedAsyncCall<UploadPartCopyOutcome>(), this, std::move(request), handler, context);
 }
 
 void S3Client::UploadPartCopyAsyncHelper(const UploadPartCopyRequest& request, const UploadPartCopyResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1822,8 +2333,22 @@ void S3Client::UploadPartCopyAsyncHelper(const UploadPartCopyRequest& request, c
 
 Aws::String S3Client::GeneratePresignedUrl(const Aws::String& bucketName, const Aws::String& key, Http::HttpMethod method, long long expirationInSeconds)
 {
-    Aws::StringStream ss;
-    ss << m_uri << "/" << bucketName << "/" << key;
-    URI uri(ss.str());
+    Aws::Utils::StringBuilder<> uriString;
+    uriString.Append(m_uri).Append("/").Append(bucketName).Append("/").Append(key);
+    URI uri(uriString.ToString());
     return AWSClient::GeneratePresignedUrl(uri, method, expirationInSeconds);
 }
+
+Aws::Vector<Aws::String> S3Client::GeneratePresignedUrls(const Aws::String& bucketName, const Aws::Vector<Aws::String>& keys, Http::HttpMethod method, long long expirationInSeconds)
+{
+    Aws::String bucketPath = "/" + bucketName + "/";
+    Aws::Vector<Aws::String> paths;
+    paths.reserve(keys.size());
+    for (const auto& key : keys)
+    {
+        paths.push_back(bucketPath + key);
+    }
+
+    URI uri(m_uri);
+    return AWSClient::GeneratePresignedUrls(uri, paths, method, expirationInSeconds, m_executor.get());
+}
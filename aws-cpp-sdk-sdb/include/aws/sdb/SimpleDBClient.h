@@ -27,6 +27,20 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/sdb/model/BatchDeleteAttributesRequest.h>
+#include <aws/sdb/model/BatchPutAttributesRequest.h>
+#include <aws/sdb/model/CreateDomainRequest.h>
+#include <aws/sdb/model/DeleteAttributesRequest.h>
+#include <aws/sdb/model/DeleteDomainRequest.h>
+#include <aws/sdb/model/DomainMetadataRequest.h>
+#include <aws/sdb/model/GetAttributesRequest.h>
+#include <aws/sdb/model/ListDomainsRequest.h>
+#include <aws/sdb/model/PutAttributesRequest.h>
+#include <aws/sdb/model/SelectRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -180,6 +194,11 @@ namespace Model
          */
         virtual Model::BatchDeleteAttributesOutcomeCallable BatchDeleteAttributesCallable(const Model::BatchDeleteAttributesRequest& request) const;
 
+        /**
+         * Same as BatchDeleteAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BatchDeleteAttributesOutcomeCallable BatchDeleteAttributesCallable(Model::BatchDeleteAttributesRequest&& request) const;
+
         /**
          * <p> Performs multiple DeleteAttributes operations in a single call, which
          * reduces round trips and latencies. This enables Amazon SimpleDB to optimize
@@ -191,6 +210,11 @@ namespace Model
          */
         virtual void BatchDeleteAttributesAsync(const Model::BatchDeleteAttributesRequest& request, const BatchDeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchDeleteAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BatchDeleteAttributesAsync(Model::BatchDeleteAttributesRequest&& request, const BatchDeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> The <code>BatchPutAttributes</code> operation creates or replaces attributes
          * within one or more items. By using this operation, the client can perform
@@ -277,6 +301,11 @@ namespace Model
          */
         virtual Model::BatchPutAttributesOutcomeCallable BatchPutAttributesCallable(const Model::BatchPutAttributesRequest& request) const;
 
+        /**
+         * Same as BatchPutAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::BatchPutAttributesOutcomeCallable BatchPutAttributesCallable(Model::BatchPutAttributesRequest&& request) const;
+
         /**
          * <p> The <code>BatchPutAttributes</code> operation creates or replaces attributes
          * within one or more items. By using this operation, the client can perform
@@ -321,6 +350,11 @@ namespace Model
          */
         virtual void BatchPutAttributesAsync(const Model::BatchPutAttributesRequest& request, const BatchPutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as BatchPutAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void BatchPutAttributesAsync(Model::BatchPutAttributesRequest&& request, const BatchPutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> The <code>CreateDomain</code> operation creates a new domain. The domain
          * name should be unique among the domains associated with the Access Key ID
@@ -345,6 +379,11 @@ namespace Model
          */
         virtual Model::CreateDomainOutcomeCallable CreateDomainCallable(const Model::CreateDomainRequest& request) const;
 
+        /**
+         * Same as CreateDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDomainOutcomeCallable CreateDomainCallable(Model::CreateDomainRequest&& request) const;
+
         /**
          * <p> The <code>CreateDomain</code> operation creates a new domain. The domain
          * name should be unique among the domains associated with the Access Key ID
@@ -358,6 +397,11 @@ namespace Model
          */
         virtual void CreateDomainAsync(const Model::CreateDomainRequest& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDomainAsync(Model::CreateDomainRequest&& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes one or more attributes associated with an item. If all attributes of
          * the item are deleted, the item is deleted. </p> <p>
@@ -386,6 +430,11 @@ namespace Model
          */
         virtual Model::DeleteAttributesOutcomeCallable DeleteAttributesCallable(const Model::DeleteAttributesRequest& request) const;
 
+        /**
+         * Same as DeleteAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteAttributesOutcomeCallable DeleteAttributesCallable(Model::DeleteAttributesRequest&& request) const;
+
         /**
          * <p> Deletes one or more attributes associated with an item. If all attributes of
          * the item are deleted, the item is deleted. </p> <p>
@@ -401,6 +450,11 @@ namespace Model
          */
         virtual void DeleteAttributesAsync(const Model::DeleteAttributesRequest& request, const DeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteAttributesAsync(Model::DeleteAttributesRequest&& request, const DeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> The <code>DeleteDomain</code> operation deletes a domain. Any items (and
          * their attributes) in the domain are deleted as well. The
@@ -419,6 +473,11 @@ namespace Model
          */
         virtual Model::DeleteDomainOutcomeCallable DeleteDomainCallable(const Model::DeleteDomainRequest& request) const;
 
+        /**
+         * Same as DeleteDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDomainOutcomeCallable DeleteDomainCallable(Model::DeleteDomainRequest&& request) const;
+
         /**
          * <p> The <code>DeleteDomain</code> operation deletes a domain. Any items (and
          * their attributes) in the domain are deleted as well. The
@@ -429,6 +488,11 @@ namespace Model
          */
         virtual void DeleteDomainAsync(const Model::DeleteDomainRequest& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDomainAsync(Model::DeleteDomainRequest&& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns information about the domain, including when the domain was created,
          * the number of items and attributes in the domain, and the size of the attribute
@@ -445,6 +509,11 @@ namespace Model
          */
         virtual Model::DomainMetadataOutcomeCallable DomainMetadataCallable(const Model::DomainMetadataRequest& request) const;
 
+        /**
+         * Same as DomainMetadataCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DomainMetadataOutcomeCallable DomainMetadataCallable(Model::DomainMetadataRequest&& request) const;
+
         /**
          * <p> Returns information about the domain, including when the domain was created,
          * the number of items and attributes in the domain, and the size of the attribute
@@ -454,6 +523,11 @@ namespace Model
          */
         virtual void DomainMetadataAsync(const Model::DomainMetadataRequest& request, const DomainMetadataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DomainMetadataAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DomainMetadataAsync(Model::DomainMetadataRequest&& request, const DomainMetadataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns all of the attributes associated with the specified item.
          * Optionally, the attributes returned can be limited to one or more attributes by
@@ -476,6 +550,11 @@ namespace Model
          */
         virtual Model::GetAttributesOutcomeCallable GetAttributesCallable(const Model::GetAttributesRequest& request) const;
 
+        /**
+         * Same as GetAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetAttributesOutcomeCallable GetAttributesCallable(Model::GetAttributesRequest&& request) const;
+
         /**
          * <p> Returns all of the attributes associated with the specified item.
          * Optionally, the attributes returned can be limited to one or more attributes by
@@ -488,6 +567,11 @@ namespace Model
          */
         virtual void GetAttributesAsync(const Model::GetAttributesRequest& request, const GetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetAttributesAsync(Model::GetAttributesRequest&& request, const GetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> The <code>ListDomains</code> operation lists all domains associated with the
          * Access Key ID. It returns domain names up to the limit set by <a
@@ -514,6 +598,11 @@ namespace Model
          */
         virtual Model::ListDomainsOutcomeCallable ListDomainsCallable(const Model::ListDomainsRequest& request) const;
 
+        /**
+         * Same as ListDomainsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDomainsOutcomeCallable ListDomainsCallable(Model::ListDomainsRequest&& request) const;
+
         /**
          * <p> The <code>ListDomains</code> operation lists all domains associated with the
          * Access Key ID. It returns domain names up to the limit set by <a
@@ -528,6 +617,11 @@ namespace Model
          */
         virtual void ListDomainsAsync(const Model::ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDomainsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDomainsAsync(Model::ListDomainsRequest&& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> The PutAttributes operation creates or replaces attributes in an item. The
          * client may specify new attributes using a combination of the
@@ -596,6 +690,11 @@ namespace Model
          */
         virtual Model::PutAttributesOutcomeCallable PutAttributesCallable(const Model::PutAttributesRequest& request) const;
 
+        /**
+         * Same as PutAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PutAttributesOutcomeCallable PutAttributesCallable(Model::PutAttributesRequest&& request) const;
+
         /**
          * <p> The PutAttributes operation creates or replaces attributes in an item. The
          * client may specify new attributes using a combination of the
@@ -631,6 +730,11 @@ namespace Model
          */
         virtual void PutAttributesAsync(const Model::PutAttributesRequest& request, const PutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PutAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PutAttributesAsync(Model::PutAttributesRequest&& request, const PutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> The <code>Select</code> operation returns a set of attributes for
          * <code>ItemNames</code> that match the select expression. <code>Select</code> is
@@ -661,6 +765,11 @@ namespace Model
          */
         virtual Model::SelectOutcomeCallable SelectCallable(const Model::SelectRequest& request) const;
 
+        /**
+         * Same as SelectCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SelectOutcomeCallable SelectCallable(Model::SelectRequest&& request) const;
+
         /**
          * <p> The <code>Select</code> operation returns a set of attributes for
          * <code>ItemNames</code> that match the select expression. <code>Select</code> is
@@ -677,6 +786,38 @@ namespace Model
          */
         virtual void SelectAsync(const Model::SelectRequest& request, const SelectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SelectAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SelectAsync(Model::SelectRequest&& request, const SelectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchDeleteAttributesOutcome> BatchDeleteAttributesAwaitable(const Model::BatchDeleteAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::BatchDeleteAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchDeleteAttributesOutcome> BatchDeleteAttributesAwaitable(Model::BatchDeleteAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::BatchDeleteAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchPutAttributesOutcome> BatchPutAttributesAwaitable(const Model::BatchPutAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::BatchPutAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::BatchPutAttributesOutcome> BatchPutAttributesAwaitable(Model::BatchPutAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::BatchPutAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDomainOutcome> CreateDomainAwaitable(const Model::CreateDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::CreateDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDomainOutcome> CreateDomainAwaitable(Model::CreateDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::CreateDomain, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAttributesOutcome> DeleteAttributesAwaitable(const Model::DeleteAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::DeleteAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAttributesOutcome> DeleteAttributesAwaitable(Model::DeleteAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::DeleteAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDomainOutcome> DeleteDomainAwaitable(const Model::DeleteDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::DeleteDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDomainOutcome> DeleteDomainAwaitable(Model::DeleteDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::DeleteDomain, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DomainMetadataOutcome> DomainMetadataAwaitable(const Model::DomainMetadataRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::DomainMetadata, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DomainMetadataOutcome> DomainMetadataAwaitable(Model::DomainMetadataRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::DomainMetadata, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAttributesOutcome> GetAttributesAwaitable(const Model::GetAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::GetAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetAttributesOutcome> GetAttributesAwaitable(Model::GetAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::GetAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDomainsOutcome> ListDomainsAwaitable(const Model::ListDomainsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::ListDomains, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDomainsOutcome> ListDomainsAwaitable(Model::ListDomainsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::ListDomains, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutAttributesOutcome> PutAttributesAwaitable(const Model::PutAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::PutAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PutAttributesOutcome> PutAttributesAwaitable(Model::PutAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::PutAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SelectOutcome> SelectAwaitable(const Model::SelectRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::Select, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SelectOutcome> SelectAwaitable(Model::SelectRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SimpleDBClient::Select, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -117,12 +117,22 @@ BatchDeleteAttributesOutcome SimpleDBClient::BatchDeleteAttributes(const BatchDe
 
 BatchDeleteAttributesOutcomeCallable SimpleDBClient::BatchDeleteAttributesCallable(const BatchDeleteAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SimpleDBClient::BatchDeleteAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SimpleDBClient::BatchDeleteAttributes, Aws::Client::RejectedCallOutcome<BatchDeleteAttributesOutcome>(), this, request);
+}
+
+BatchDeleteAttributesOutcomeCallable SimpleDBClient::BatchDeleteAttributesCallable(BatchDeleteAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SimpleDBClient::BatchDeleteAttributes, Aws::Client::RejectedCallOutcome<BatchDeleteAttributesOutcome>(), this, std::move(request));
 }
 
 void SimpleDBClient::BatchDeleteAttributesAsync(const BatchDeleteAttributesRequest& request, const BatchDeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SimpleDBClient::BatchDeleteAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SimpleDBClient::BatchDeleteAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<BatchDeleteAttributesOutcome>(), this, request, handler, context);
+}
+
+void SimpleDBClient::BatchDeleteAttributesAsync(BatchDeleteAttributesRequest&& request, const BatchDeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SimpleDBClient::BatchDeleteAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<BatchDeleteAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SimpleDBClient::BatchDeleteAttributesAsyncHelper(const BatchDeleteAttributesRequest& request, const BatchDeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -147,12 +157,22 @@ BatchPutAttributesOutcome SimpleDBClient::BatchPutAttributes(const BatchPutAttri
 
 BatchPutAttributesOutcomeCallable SimpleDBClient::BatchPutAttributesCallable(const BatchPutAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SimpleDBClient::BatchPutAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SimpleDBClient::BatchPutAttributes, Aws::Client::RejectedCallOutcome<BatchPutAttributesOutcome>(), this, request);
+}
+
+BatchPutAttributesOutcomeCallable SimpleDBClient::BatchPutAttributesCallable(BatchPutAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SimpleDBClient::BatchPutAttributes, Aws::Client::RejectedCallOutcome<BatchPutAttributesOutcome>(), this, std::move(request));
 }
 
 void SimpleDBClient::BatchPutAttributesAsync(const BatchPutAttributesRequest& request, const BatchPutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SimpleDBClient::BatchPutAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SimpleDBClient::BatchPutAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<BatchPutAttributesOutcome>(), this, request, handler, context);
+}
+
+void SimpleDBClient::BatchPutAttributesAsync(BatchPutAttributesRequest&& request, const BatchPutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SimpleDBClient::BatchPutAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<BatchPutAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SimpleDBClient::BatchPutAttributesAsyncHelper(const BatchPutAttributesRequest& request, const BatchPutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -177,12 +197,22 @@ CreateDomainOutcome SimpleDBClient::CreateDomain(const CreateDomainRequest& requ
 
 CreateDomainOutcomeCallable SimpleDBClient::CreateDomainCallable(const CreateDomainRequest& request) const
 {
-  return std::async(std::launch::async, &SimpleDBClient::CreateDomain, this, request);
+  return m_executor->SubmitWithFuture(&SimpleDBClient::CreateDomain, Aws::Client::RejectedCallOutcome<CreateDomainOutcome>(), this, request);
+}
+
+CreateDomainOutcomeCallable SimpleDBClient::CreateDomainCallable(CreateDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SimpleDBClient::CreateDomain, Aws::Client::RejectedCallOutcome<CreateDomainOutcome>(), this, std::move(request));
 }
 
 void SimpleDBClient::CreateDomainAsync(const CreateDomainRequest& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SimpleDBClient::CreateDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SimpleDBClient::CreateDomainAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDomainOutcome>(), this, request, handler, context);
+}
+
+void SimpleDBClient::CreateDomainAsync(CreateDomainRequest&& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SimpleDBClient::CreateDomainAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void SimpleDBClient::CreateDomainAsyncHelper(const CreateDomainRequest& request, const CreateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -207,12 +237,22 @@ DeleteAttributesOutcome SimpleDBClient::DeleteAttributes(const DeleteAttributesR
 
 DeleteAttributesOutcomeCallable SimpleDBClient::DeleteAttributesCallable(const DeleteAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SimpleDBClient::DeleteAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SimpleDBClient::DeleteAttributes, Aws::Client::RejectedCallOutcome<DeleteAttributesOutcome>(), this, request);
+}
+
+DeleteAttributesOutcomeCallable SimpleDBClient::DeleteAttributesCallable(DeleteAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SimpleDBClient::DeleteAttributes, Aws::Client::RejectedCallOutcome<DeleteAttributesOutcome>(), this, std::move(request));
 }
 
 void SimpleDBClient::DeleteAttributesAsync(const DeleteAttributesRequest& request, const DeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SimpleDBClient::DeleteAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SimpleDBClient::DeleteAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAttributesOutcome>(), this, request, handler, context);
+}
+
+void SimpleDBClient::DeleteAttributesAsync(DeleteAttributesRequest&& request, const DeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SimpleDBClient::DeleteAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SimpleDBClient::DeleteAttributesAsyncHelper(const DeleteAttributesRequest& request, const DeleteAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -237,12 +277,22 @@ DeleteDomainOutcome SimpleDBClient::DeleteDomain(const DeleteDomainRequest& requ
 
 DeleteDomainOutcomeCallable SimpleDBClient::DeleteDomainCallable(const DeleteDomainRequest& request) const
 {
-  return std::async(std::launch::async, &SimpleDBClient::DeleteDomain, this, request);
+  return m_executor->SubmitWithFuture(&SimpleDBClient::DeleteDomain, Aws::Client::RejectedCallOutcome<DeleteDomainOutcome>(), this, request);
+}
+
+DeleteDomainOutcomeCallable SimpleDBClient::DeleteDomainCallable(DeleteDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SimpleDBClient::DeleteDomain, Aws::Client::RejectedCallOutcome<DeleteDomainOutcome>(), this, std::move(request));
 }
 
 void SimpleDBClient::DeleteDomainAsync(const DeleteDomainRequest& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SimpleDBClient::DeleteDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SimpleDBClient::DeleteDomainAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDomainOutcome>(), this, request, handler, context);
+}
+
+void SimpleDBClient::DeleteDomainAsync(DeleteDomainRequest&& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SimpleDBClient::DeleteDomainAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void SimpleDBClient::DeleteDomainAsyncHelper(const DeleteDomainRequest& request, const DeleteDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -267,12 +317,22 @@ DomainMetadataOutcome SimpleDBClient::DomainMetadata(const DomainMetadataRequest
 
 DomainMetadataOutcomeCallable SimpleDBClient::DomainMetadataCallable(const DomainMetadataRequest& request) const
 {
-  return std::async(std::launch::async, &SimpleDBClient::DomainMetadata, this, request);
+  return m_executor->SubmitWithFuture(&SimpleDBClient::DomainMetadata, Aws::Client::RejectedCallOutcome<DomainMetadataOutcome>(), this, request);
+}
+
+DomainMetadataOutcomeCallable SimpleDBClient::DomainMetadataCallable(DomainMetadataRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SimpleDBClient::DomainMetadata, Aws::Client::RejectedCallOutcome<DomainMetadataOutcome>(), this, std::move(request));
 }
 
 void SimpleDBClient::DomainMetadataAsync(const DomainMetadataRequest& request, const DomainMetadataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SimpleDBClient::DomainMetadataAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SimpleDBClient::DomainMetadataAsyncHelper, Aws::Client::RejectedAsyncCall<DomainMetadataOutcome>(), this, request, handler, context);
+}
+
+void SimpleDBClient::DomainMetadataAsync(DomainMetadataRequest&& request, const DomainMetadataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SimpleDBClient::DomainMetadataAsyncHelper, Aws::Client::RejectedAsyncCall<DomainMetadataOutcome>(), this, std::move(request), handler, context);
 }
 
 void SimpleDBClient::DomainMetadataAsyncHelper(const DomainMetadataRequest& request, const DomainMetadataResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -297,12 +357,22 @@ GetAttributesOutcome SimpleDBClient::GetAttributes(const GetAttributesRequest& r
 
 GetAttributesOutcomeCallable SimpleDBClient::GetAttributesCallable(const GetAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SimpleDBClient::GetAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SimpleDBClient::GetAttributes, Aws::Client::RejectedCallOutcome<GetAttributesOutcome>(), this, request);
+}
+
+GetAttributesOutcomeCallable SimpleDBClient::GetAttributesCallable(GetAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SimpleDBClient::GetAttributes, Aws::Client::RejectedCallOutcome<GetAttributesOutcome>(), this, std::move(request));
 }
 
 void SimpleDBClient::GetAttributesAsync(const GetAttributesRequest& request, const GetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SimpleDBClient::GetAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SimpleDBClient::GetAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetAttributesOutcome>(), this, request, handler, context);
+}
+
+void SimpleDBClient::GetAttributesAsync(GetAttributesRequest&& request, const GetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SimpleDBClient::GetAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SimpleDBClient::GetAttributesAsyncHelper(const GetAttributesRequest& request, const GetAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -327,12 +397,22 @@ ListDomainsOutcome SimpleDBClient::ListDomains(const ListDomainsRequest& request
 
 ListDomainsOutcomeCallable SimpleDBClient::ListDomainsCallable(const ListDomainsRequest& request) const
 {
-  return std::async(std::launch::async, &SimpleDBClient::ListDomains, this, request);
+  return m_executor->SubmitWithFuture(&SimpleDBClient::ListDomains, Aws::Client::RejectedCallOutcome<ListDomainsOutcome>(), this, request);
+}
+
+ListDomainsOutcomeCallable SimpleDBClient::ListDomainsCallable(ListDomainsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SimpleDBClient::ListDomains, Aws::Client::RejectedCallOutcome<ListDomainsOutcome>(), this, std::move(request));
 }
 
 void SimpleDBClient::ListDomainsAsync(const ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SimpleDBClient::ListDomainsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SimpleDBClient::ListDomainsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDomainsOutcome>(), this, request, handler, context);
+}
+
+void SimpleDBClient::ListDomainsAsync(ListDomainsRequest&& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SimpleDBClient::ListDomainsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDomainsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SimpleDBClient::ListDomainsAsyncHelper(const ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -357,12 +437,22 @@ PutAttributesOutcome SimpleDBClient::PutAttributes(const PutAttributesRequest& r
 
 PutAttributesOutcomeCallable SimpleDBClient::PutAttributesCallable(const PutAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SimpleDBClient::PutAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SimpleDBClient::PutAttributes, Aws::Client::RejectedCallOutcome<PutAttributesOutcome>(), this, request);
+}
+
+PutAttributesOutcomeCallable SimpleDBClient::PutAttributesCallable(PutAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SimpleDBClient::PutAttributes, Aws::Client::RejectedCallOutcome<PutAttributesOutcome>(), this, std::move(request));
 }
 
 void SimpleDBClient::PutAttributesAsync(const PutAttributesRequest& request, const PutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SimpleDBClient::PutAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SimpleDBClient::PutAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<PutAttributesOutcome>(), this, request, handler, context);
+}
+
+void SimpleDBClient::PutAttributesAsync(PutAttributesRequest&& request, const PutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SimpleDBClient::PutAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<PutAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SimpleDBClient::PutAttributesAsyncHelper(const PutAttributesRequest& request, const PutAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -387,12 +477,22 @@ SelectOutcome SimpleDBClient::Select(const SelectRequest& request) const
 
 SelectOutcomeCallable SimpleDBClient::SelectCallable(const SelectRequest& request) const
 {
-  return std::async(std::launch::async, &SimpleDBClient::Select, this, request);
+  return m_executor->SubmitWithFuture(&SimpleDBClient::Select, Aws::Client::RejectedCallOutcome<SelectOutcome>(), this, request);
+}
+
+SelectOutcomeCallable SimpleDBClient::SelectCallable(SelectRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SimpleDBClient::Select, Aws::Client::RejectedCallOutcome<SelectOutcome>(), this, std::move(request));
 }
 
 void SimpleDBClient::SelectAsync(const SelectRequest& request, const SelectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SimpleDBClient::SelectAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SimpleDBClient::SelectAsyncHelper, Aws::Client::RejectedAsyncCall<SelectOutcome>(), this, request, handler, context);
+}
+
+void SimpleDBClient::SelectAsync(SelectRequest&& request, const SelectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SimpleDBClient::SelectAsyncHelper, Aws::Client::RejectedAsyncCall<SelectOutcome>(), this, std::move(request), handler, context);
 }
 
 void SimpleDBClient::SelectAsyncHelper(const SelectRequest& request, const SelectResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -38,6 +38,35 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/sns/model/AddPermissionRequest.h>
+#include <aws/sns/model/ConfirmSubscriptionRequest.h>
+#include <aws/sns/model/CreatePlatformApplicationRequest.h>
+#include <aws/sns/model/CreatePlatformEndpointRequest.h>
+#include <aws/sns/model/CreateTopicRequest.h>
+#include <aws/sns/model/DeleteEndpointRequest.h>
+#include <aws/sns/model/DeletePlatformApplicationRequest.h>
+#include <aws/sns/model/DeleteTopicRequest.h>
+#include <aws/sns/model/GetEndpointAttributesRequest.h>
+#include <aws/sns/model/GetPlatformApplicationAttributesRequest.h>
+#include <aws/sns/model/GetSubscriptionAttributesRequest.h>
+#include <aws/sns/model/GetTopicAttributesRequest.h>
+#include <aws/sns/model/ListEndpointsByPlatformApplicationRequest.h>
+#include <aws/sns/model/ListPlatformApplicationsRequest.h>
+#include <aws/sns/model/ListSubscriptionsRequest.h>
+#include <aws/sns/model/ListSubscriptionsByTopicRequest.h>
+#include <aws/sns/model/ListTopicsRequest.h>
+#include <aws/sns/model/PublishRequest.h>
+#include <aws/sns/model/RemovePermissionRequest.h>
+#include <aws/sns/model/SetEndpointAttributesRequest.h>
+#include <aws/sns/model/SetPlatformApplicationAttributesRequest.h>
+#include <aws/sns/model/SetSubscriptionAttributesRequest.h>
+#include <aws/sns/model/SetTopicAttributesRequest.h>
+#include <aws/sns/model/SubscribeRequest.h>
+#include <aws/sns/model/UnsubscribeRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -339,6 +368,11 @@ namespace Model
          */
         virtual Model::AddPermissionOutcomeCallable AddPermissionCallable(const Model::AddPermissionRequest& request) const;
 
+        /**
+         * Same as AddPermissionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddPermissionOutcomeCallable AddPermissionCallable(Model::AddPermissionRequest&& request) const;
+
         /**
          * <p>Adds a statement to a topic's access control policy, granting access for the
          * specified AWS accounts to the specified actions.</p>
@@ -388,6 +422,11 @@ namespace Model
          */
         virtual void AddPermissionAsync(const Model::AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddPermissionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddPermissionAsync(Model::AddPermissionRequest&& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Verifies an endpoint owner's intent to receive messages by validating
      
@@ -502,6 +541,11 @@ namespace Model
          */
         virtual Model::ConfirmSubscriptionOutcomeCallable ConfirmSubscriptionCallable(const Model::ConfirmSubscriptionRequest& request) const;
 
+        /**
+         * Same as ConfirmSubscriptionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ConfirmSubscriptionOutcomeCallable ConfirmSubscriptionCallable(Model::ConfirmSubscriptionRequest&& request) const;
+
         /**
          * <p>Verifies an endpoint owner's intent to receive messages by validating
      
@@ -560,6 +604,11 @@ namespace Model
          */
         virtual void ConfirmSubscriptionAsync(const Model::ConfirmSubscriptionRequest& request, const ConfirmSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ConfirmSubscriptionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ConfirmSubscriptionAsync(Model::ConfirmSubscriptionRequest&& request, const ConfirmSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a platform application object for one of the supported push
          * notification services, 
@@ -708,6 +757,11 @@ HTTP/1.1 200
          */
         virtual Model::CreatePlatformApplicationOutcomeCallable CreatePlatformApplicationCallable(const Model::CreatePlatformApplicationRequest& request) const;
 
+        /**
+         * Same as CreatePlatformApplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePlatformApplicationOutcomeCallable CreatePlatformApplicationCallable(Model::CreatePlatformApplicationRequest&& request) const;
+
         /**
          * <p>Creates a platform application object for one of the supported push
          * notification services, 
@@ -783,6 +837,11 @@ HTTP/1.1 200
          */
         virtual void CreatePlatformApplicationAsync(const Model::CreatePlatformApplicationRequest& request, const CreatePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePlatformApplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePlatformApplicationAsync(Model::CreatePlatformApplicationRequest&& request, const CreatePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an endpoint for a device and mobile app on one of the supported push
          * notification services, such as GCM and APNS. 
@@ -933,6 +992,11 @@ HTTP/1.1 200
          */
         virtual Model::CreatePlatformEndpointOutcomeCallable CreatePlatformEndpointCallable(const Model::CreatePlatformEndpointRequest& request) const;
 
+        /**
+         * Same as CreatePlatformEndpointCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreatePlatformEndpointOutcomeCallable CreatePlatformEndpointCallable(Model::CreatePlatformEndpointRequest&& request) const;
+
         /**
          * <p>Creates an endpoint for a device and mobile app on one of the supported push
          * notification services, such as GCM and APNS. 
@@ -1009,6 +1073,11 @@ HTTP/1.1 200
          */
         virtual void CreatePlatformEndpointAsync(const Model::CreatePlatformEndpointRequest& request, const CreatePlatformEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreatePlatformEndpointAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreatePlatformEndpointAsync(Model::CreatePlatformEndpointRequest&& request, const CreatePlatformEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a topic to which notifications can be published. Users can create
    
@@ -1113,6 +1182,11 @@ HTTP/1.1 200
          */
         virtual Model::CreateTopicOutcomeCallable CreateTopicCallable(const Model::CreateTopicRequest& request) const;
 
+        /**
+         * Same as CreateTopicCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateTopicOutcomeCallable CreateTopicCallable(Model::CreateTopicRequest&& request) const;
+
         /**
          * <p>Creates a topic to which notifications can be published. Users can create
    
@@ -1166,6 +1240,11 @@ HTTP/1.1 200
          */
         virtual void CreateTopicAsync(const Model::CreateTopicRequest& request, const CreateTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTopicAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateTopicAsync(Model::CreateTopicRequest&& request, const CreateTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the endpoint from Amazon SNS. This action is idempotent. 
       For
@@ -1258,6 +1337,11 @@ HTTP/1.1 200
          */
         virtual Model::DeleteEndpointOutcomeCallable DeleteEndpointCallable(const Model::DeleteEndpointRequest& request) const;
 
+        /**
+         * Same as DeleteEndpointCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteEndpointOutcomeCallable DeleteEndpointCallable(Model::DeleteEndpointRequest&& request) const;
+
         /**
          * <p>Deletes the endpoint from Amazon SNS. This action is idempotent. 
       For
@@ -1305,6 +1389,11 @@ HTTP/1.1 200
          */
         virtual void DeleteEndpointAsync(const Model::DeleteEndpointRequest& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteEndpointAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteEndpointAsync(Model::DeleteEndpointRequest&& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a platform application object for one of the supported push
          * notification services, 
@@ -1399,6 +1488,11 @@ HTTP/1.1 200
          */
         virtual Model::DeletePlatformApplicationOutcomeCallable DeletePlatformApplicationCallable(const Model::DeletePlatformApplicationRequest& request) const;
 
+        /**
+         * Same as DeletePlatformApplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeletePlatformApplicationOutcomeCallable DeletePlatformApplicationCallable(Model::DeletePlatformApplicationRequest&& request) const;
+
         /**
          * <p>Deletes a platform application object for one of the supported push
          * notification services, 
@@ -1447,6 +1541,11 @@ HTTP/1.1 200
          */
         virtual void DeletePlatformApplicationAsync(const Model::DeletePlatformApplicationRequest& request, const DeletePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeletePlatformApplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeletePlatformApplicationAsync(Model::DeletePlatformApplicationRequest&& request, const DeletePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a topic and all its subscriptions. Deleting a topic might
      
@@ -1535,6 +1634,11 @@ HTTP/1.1 200
          */
         virtual Model::DeleteTopicOutcomeCallable DeleteTopicCallable(const Model::DeleteTopicRequest& request) const;
 
+        /**
+         * Same as DeleteTopicCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteTopicOutcomeCallable DeleteTopicCallable(Model::DeleteTopicRequest&& request) const;
+
         /**
          * <p>Deletes a topic and all its subscriptions. Deleting a topic might
      
@@ -1580,6 +1684,11 @@ HTTP/1.1 200
          */
         virtual void DeleteTopicAsync(const Model::DeleteTopicRequest& request, const DeleteTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTopicAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteTopicAsync(Model::DeleteTopicRequest&& request, const DeleteTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the endpoint attributes for a device on one of the supported push
          * notification services, such as GCM and APNS. 
@@ -1722,6 +1831,11 @@ HTTP/1.1 200
          */
         virtual Model::GetEndpointAttributesOutcomeCallable GetEndpointAttributesCallable(const Model::GetEndpointAttributesRequest& request) const;
 
+        /**
+         * Same as GetEndpointAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetEndpointAttributesOutcomeCallable GetEndpointAttributesCallable(Model::GetEndpointAttributesRequest&& request) const;
+
         /**
          * <p>Retrieves the endpoint attributes for a device on one of the supported push
          * notification services, such as GCM and APNS. 
@@ -1794,6 +1908,11 @@ HTTP/1.1 200
          */
         virtual void GetEndpointAttributesAsync(const Model::GetEndpointAttributesRequest& request, const GetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetEndpointAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetEndpointAttributesAsync(Model::GetEndpointAttributesRequest&& request, const GetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the attributes of the platform application object for the supported
          * push notification services, 
@@ -1914,6 +2033,11 @@ HTTP/1.1 200
          */
         virtual Model::GetPlatformApplicationAttributesOutcomeCallable GetPlatformApplicationAttributesCallable(const Model::GetPlatformApplicationAttributesRequest& request) const;
 
+        /**
+         * Same as GetPlatformApplicationAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetPlatformApplicationAttributesOutcomeCallable GetPlatformApplicationAttributesCallable(Model::GetPlatformApplicationAttributesRequest&& request) const;
+
         /**
          * <p>Retrieves the attributes of the platform application object for the supported
          * push notification services, 
@@ -1975,6 +2099,11 @@ HTTP/1.1 200
          */
         virtual void GetPlatformApplicationAttributesAsync(const Model::GetPlatformApplicationAttributesRequest& request, const GetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetPlatformApplicationAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetPlatformApplicationAttributesAsync(Model::GetPlatformApplicationAttributesRequest&& request, const GetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns all of the properties of a subscription.</p>
 <examples>
@@ -2107,6 +2236,11 @@ HTTP/1.1 200
          */
         virtual Model::GetSubscriptionAttributesOutcomeCallable GetSubscriptionAttributesCallable(const Model::GetSubscriptionAttributesRequest& request) const;
 
+        /**
+         * Same as GetSubscriptionAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetSubscriptionAttributesOutcomeCallable GetSubscriptionAttributesCallable(Model::GetSubscriptionAttributesRequest&& request) const;
+
         /**
          * <p>Returns all of the properties of a subscription.</p>
 <examples>
@@ -2174,6 +2308,11 @@ HTTP/1.1 200
          */
         virtual void GetSubscriptionAttributesAsync(const Model::GetSubscriptionAttributesRequest& request, const GetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSubscriptionAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetSubscriptionAttributesAsync(Model::GetSubscriptionAttributesRequest&& request, const GetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns all of the properties of a topic. 
     Topic properties returned
@@ -2320,6 +2459,11 @@ HTTP/1.1 200
          */
         virtual Model::GetTopicAttributesOutcomeCallable GetTopicAttributesCallable(const Model::GetTopicAttributesRequest& request) const;
 
+        /**
+         * Same as GetTopicAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetTopicAttributesOutcomeCallable GetTopicAttributesCallable(Model::GetTopicAttributesRequest&& request) const;
+
         /**
          * <p>Returns all of the properties of a topic. 
     Topic properties returned
@@ -2394,6 +2538,11 @@ HTTP/1.1 200
          */
         virtual void GetTopicAttributesAsync(const Model::GetTopicAttributesRequest& request, const GetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetTopicAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetTopicAttributesAsync(Model::GetTopicAttributesRequest&& request, const GetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the endpoints and endpoint attributes for devices in a supported push
          * notification service, such as GCM and APNS. 
@@ -2576,6 +2725,11 @@ HTTP/1.1 200
          */
         virtual Model::ListEndpointsByPlatformApplicationOutcomeCallable ListEndpointsByPlatformApplicationCallable(const Model::ListEndpointsByPlatformApplicationRequest& request) const;
 
+        /**
+         * Same as ListEndpointsByPlatformApplicationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListEndpointsByPlatformApplicationOutcomeCallable ListEndpointsByPlatformApplicationCallable(Model::ListEndpointsByPlatformApplicationRequest&& request) const;
+
         /**
          * <p>Lists the endpoints and endpoint attributes for devices in a supported push
          * notification service, such as GCM and APNS. 
@@ -2668,6 +2822,11 @@ HTTP/1.1 200
          */
         virtual void ListEndpointsByPlatformApplicationAsync(const Model::ListEndpointsByPlatformApplicationRequest& request, const ListEndpointsByPlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListEndpointsByPlatformApplicationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListEndpointsByPlatformApplicationAsync(Model::ListEndpointsByPlatformApplicationRequest&& request, const ListEndpointsByPlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the platform application objects for the supported push notification
          * services, 
@@ -2850,6 +3009,11 @@ HTTP/1.1 200
          */
         virtual Model::ListPlatformApplicationsOutcomeCallable ListPlatformApplicationsCallable(const Model::ListPlatformApplicationsRequest& request) const;
 
+        /**
+         * Same as ListPlatformApplicationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListPlatformApplicationsOutcomeCallable ListPlatformApplicationsCallable(Model::ListPlatformApplicationsRequest&& request) const;
+
         /**
          * <p>Lists the platform application objects for the supported push notification
          * services, 
@@ -2942,6 +3106,11 @@ HTTP/1.1 200
          */
         virtual void ListPlatformApplicationsAsync(const Model::ListPlatformApplicationsRequest& request, const ListPlatformApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListPlatformApplicationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListPlatformApplicationsAsync(Model::ListPlatformApplicationsRequest&& request, const ListPlatformApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of the requester's subscriptions. Each call returns a limited
          * list
@@ -3066,6 +3235,11 @@ HTTP/1.1 200
          */
         virtual Model::ListSubscriptionsOutcomeCallable ListSubscriptionsCallable(const Model::ListSubscriptionsRequest& request) const;
 
+        /**
+         * Same as ListSubscriptionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListSubscriptionsOutcomeCallable ListSubscriptionsCallable(Model::ListSubscriptionsRequest&& request) const;
+
         /**
          * <p>Returns a list of the requester's subscriptions. Each call returns a limited
          * list
@@ -3129,6 +3303,11 @@ HTTP/1.1 200
          */
         virtual void ListSubscriptionsAsync(const Model::ListSubscriptionsRequest& request, const ListSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSubscriptionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListSubscriptionsAsync(Model::ListSubscriptionsRequest&& request, const ListSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of the subscriptions to a specific topic. Each call returns 
  
@@ -3263,6 +3442,11 @@ HTTP/1.1 200
          */
         virtual Model::ListSubscriptionsByTopicOutcomeCallable ListSubscriptionsByTopicCallable(const Model::ListSubscriptionsByTopicRequest& request) const;
 
+        /**
+         * Same as ListSubscriptionsByTopicCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListSubscriptionsByTopicOutcomeCallable ListSubscriptionsByTopicCallable(Model::ListSubscriptionsByTopicRequest&& request) const;
+
         /**
          * <p>Returns a list of the subscriptions to a specific topic. Each call returns 
  
@@ -3331,6 +3515,11 @@ HTTP/1.1 200
          */
         virtual void ListSubscriptionsByTopicAsync(const Model::ListSubscriptionsByTopicRequest& request, const ListSubscriptionsByTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSubscriptionsByTopicAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListSubscriptionsByTopicAsync(Model::ListSubscriptionsByTopicRequest&& request, const ListSubscriptionsByTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of the requester's topics. Each call returns a limited list of
          * topics, up to 100. If
@@ -3437,6 +3626,11 @@ HTTP/1.1 200
          */
         virtual Model::ListTopicsOutcomeCallable ListTopicsCallable(const Model::ListTopicsRequest& request) const;
 
+        /**
+         * Same as ListTopicsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTopicsOutcomeCallable ListTopicsCallable(Model::ListTopicsRequest&& request) const;
+
         /**
          * <p>Returns a list of the requester's topics. Each call returns a limited list of
          * topics, up to 100. If
@@ -3491,6 +3685,11 @@ HTTP/1.1 200
          */
         virtual void ListTopicsAsync(const Model::ListTopicsRequest& request, const ListTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTopicsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTopicsAsync(Model::ListTopicsRequest&& request, const ListTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sends a message to all of a topic's subscribed endpoints. When a
    
@@ -3735,6 +3934,11 @@ HTTP/1.1 200
          */
         virtual Model::PublishOutcomeCallable PublishCallable(const Model::PublishRequest& request) const;
 
+        /**
+         * Same as PublishCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PublishOutcomeCallable PublishCallable(Model::PublishRequest&& request) const;
+
         /**
          * <p>Sends a message to all of a topic's subscribed endpoints. When a
    
@@ -3858,6 +4062,11 @@ HTTP/1.1 200
          */
         virtual void PublishAsync(const Model::PublishRequest& request, const PublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PublishAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PublishAsync(Model::PublishRequest&& request, const PublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Removes a statement from a topic's access control policy.</p>
 <examples>
@@ -3940,6 +4149,11 @@ HTTP/1.1 200
          */
         virtual Model::RemovePermissionOutcomeCallable RemovePermissionCallable(const Model::RemovePermissionRequest& request) const;
 
+        /**
+         * Same as RemovePermissionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemovePermissionOutcomeCallable RemovePermissionCallable(Model::RemovePermissionRequest&& request) const;
+
         /**
          * <p>Removes a statement from a topic's access control policy.</p>
 <examples>
@@ -3982,6 +4196,11 @@ HTTP/1.1 200
          */
         virtual void RemovePermissionAsync(const Model::RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemovePermissionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemovePermissionAsync(Model::RemovePermissionRequest&& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the attributes for an endpoint for a device on one of the supported push
          * notification services, such as GCM and APNS.
@@ -4078,6 +4297,11 @@ HTTP/1.1 200
          */
         virtual Model::SetEndpointAttributesOutcomeCallable SetEndpointAttributesCallable(const Model::SetEndpointAttributesRequest& request) const;
 
+        /**
+         * Same as SetEndpointAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetEndpointAttributesOutcomeCallable SetEndpointAttributesCallable(Model::SetEndpointAttributesRequest&& request) const;
+
         /**
          * <p>Sets the attributes for an endpoint for a device on one of the supported push
          * notification services, such as GCM and APNS.
@@ -4127,6 +4351,11 @@ HTTP/1.1 200
          */
         virtual void SetEndpointAttributesAsync(const Model::SetEndpointAttributesRequest& request, const SetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetEndpointAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetEndpointAttributesAsync(Model::SetEndpointAttributesRequest&& request, const SetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the attributes of the platform application object for the supported push
          * notification services, 
@@ -4223,6 +4452,11 @@ HTTP/1.1 200
          */
         virtual Model::SetPlatformApplicationAttributesOutcomeCallable SetPlatformApplicationAttributesCallable(const Model::SetPlatformApplicationAttributesRequest& request) const;
 
+        /**
+         * Same as SetPlatformApplicationAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetPlatformApplicationAttributesOutcomeCallable SetPlatformApplicationAttributesCallable(Model::SetPlatformApplicationAttributesRequest&& request) const;
+
         /**
          * <p>Sets the attributes of the platform application object for the supported push
          * notification services, 
@@ -4272,6 +4506,11 @@ HTTP/1.1 200
          */
         virtual void SetPlatformApplicationAttributesAsync(const Model::SetPlatformApplicationAttributesRequest& request, const SetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetPlatformApplicationAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetPlatformApplicationAttributesAsync(Model::SetPlatformApplicationAttributesRequest&& request, const SetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Allows a subscription owner to set an attribute of the topic to a new
          * value.</p>
@@ -4406,6 +4645,11 @@ The
          */
         virtual Model::SetSubscriptionAttributesOutcomeCallable SetSubscriptionAttributesCallable(const Model::SetSubscriptionAttributesRequest& request) const;
 
+        /**
+         * Same as SetSubscriptionAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetSubscriptionAttributesOutcomeCallable SetSubscriptionAttributesCallable(Model::SetSubscriptionAttributesRequest&& request) const;
+
         /**
          * <p>Allows a subscription owner to set an attribute of the topic to a new
          * value.</p>
@@ -4474,6 +4718,11 @@ The
          */
         virtual void SetSubscriptionAttributesAsync(const Model::SetSubscriptionAttributesRequest& request, const SetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetSubscriptionAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetSubscriptionAttributesAsync(Model::SetSubscriptionAttributesRequest&& request, const SetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Allows a topic owner to set an attribute of the topic to a new
          * value.</p>
@@ -4654,6 +4903,11 @@ The JSON format for the DeliveryPolicy AttributeValue (linebreaks added for
          */
         virtual Model::SetTopicAttributesOutcomeCallable SetTopicAttributesCallable(const Model::SetTopicAttributesRequest& request) const;
 
+        /**
+         * Same as SetTopicAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetTopicAttributesOutcomeCallable SetTopicAttributesCallable(Model::SetTopicAttributesRequest&& request) const;
+
         /**
          * <p>Allows a topic owner to set an attribute of the topic to a new
          * value.</p>
@@ -4745,6 +4999,11 @@ The JSON format for the DeliveryPolicy AttributeValue (linebreaks added for
          */
         virtual void SetTopicAttributesAsync(const Model::SetTopicAttributesRequest& request, const SetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetTopicAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetTopicAttributesAsync(Model::SetTopicAttributesRequest&& request, const SetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Prepares to subscribe an endpoint by sending the endpoint a confirmation
          * message. To actually create a
@@ -4867,6 +5126,11 @@ The JSON format for the DeliveryPolicy AttributeValue (linebreaks added for
          */
         virtual Model::SubscribeOutcomeCallable SubscribeCallable(const Model::SubscribeRequest& request) const;
 
+        /**
+         * Same as SubscribeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SubscribeOutcomeCallable SubscribeCallable(Model::SubscribeRequest&& request) const;
+
         /**
          * <p>Prepares to subscribe an endpoint by sending the endpoint a confirmation
          * message. To actually create a
@@ -4929,6 +5193,11 @@ The JSON format for the DeliveryPolicy AttributeValue (linebreaks added for
          */
         virtual void SubscribeAsync(const Model::SubscribeRequest& request, const SubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SubscribeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SubscribeAsync(Model::SubscribeRequest&& request, const SubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes a subscription. If the subscription requires authentication for 
     
@@ -5033,6 +5302,11 @@ The JSON format for the DeliveryPolicy AttributeValue (linebreaks added for
          */
         virtual Model::UnsubscribeOutcomeCallable UnsubscribeCallable(const Model::UnsubscribeRequest& request) const;
 
+        /**
+         * Same as UnsubscribeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UnsubscribeOutcomeCallable UnsubscribeCallable(Model::UnsubscribeRequest&& request) const;
+
         /**
          * <p>Deletes a subscription. If the subscription requires authentication for 
     
@@ -5086,6 +5360,68 @@ The JSON format for the DeliveryPolicy AttributeValue (linebreaks added for
          */
         virtual void UnsubscribeAsync(const Model::UnsubscribeRequest& request, const UnsubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UnsubscribeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UnsubscribeAsync(Model::UnsubscribeRequest&& request, const UnsubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AddPermissionOutcome> AddPermissionAwaitable(const Model::AddPermissionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::AddPermission, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddPermissionOutcome> AddPermissionAwaitable(Model::AddPermissionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::AddPermission, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ConfirmSubscriptionOutcome> ConfirmSubscriptionAwaitable(const Model::ConfirmSubscriptionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::ConfirmSubscription, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ConfirmSubscriptionOutcome> ConfirmSubscriptionAwaitable(Model::ConfirmSubscriptionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::ConfirmSubscription, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePlatformApplicationOutcome> CreatePlatformApplicationAwaitable(const Model::CreatePlatformApplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::CreatePlatformApplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePlatformApplicationOutcome> CreatePlatformApplicationAwaitable(Model::CreatePlatformApplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::CreatePlatformApplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePlatformEndpointOutcome> CreatePlatformEndpointAwaitable(const Model::CreatePlatformEndpointRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::CreatePlatformEndpoint, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreatePlatformEndpointOutcome> CreatePlatformEndpointAwaitable(Model::CreatePlatformEndpointRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::CreatePlatformEndpoint, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTopicOutcome> CreateTopicAwaitable(const Model::CreateTopicRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::CreateTopic, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTopicOutcome> CreateTopicAwaitable(Model::CreateTopicRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::CreateTopic, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteEndpointOutcome> DeleteEndpointAwaitable(const Model::DeleteEndpointRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::DeleteEndpoint, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteEndpointOutcome> DeleteEndpointAwaitable(Model::DeleteEndpointRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::DeleteEndpoint, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePlatformApplicationOutcome> DeletePlatformApplicationAwaitable(const Model::DeletePlatformApplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::DeletePlatformApplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeletePlatformApplicationOutcome> DeletePlatformApplicationAwaitable(Model::DeletePlatformApplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::DeletePlatformApplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTopicOutcome> DeleteTopicAwaitable(const Model::DeleteTopicRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::DeleteTopic, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTopicOutcome> DeleteTopicAwaitable(Model::DeleteTopicRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::DeleteTopic, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetEndpointAttributesOutcome> GetEndpointAttributesAwaitable(const Model::GetEndpointAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::GetEndpointAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetEndpointAttributesOutcome> GetEndpointAttributesAwaitable(Model::GetEndpointAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::GetEndpointAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPlatformApplicationAttributesOutcome> GetPlatformApplicationAttributesAwaitable(const Model::GetPlatformApplicationAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::GetPlatformApplicationAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetPlatformApplicationAttributesOutcome> GetPlatformApplicationAttributesAwaitable(Model::GetPlatformApplicationAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::GetPlatformApplicationAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSubscriptionAttributesOutcome> GetSubscriptionAttributesAwaitable(const Model::GetSubscriptionAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::GetSubscriptionAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSubscriptionAttributesOutcome> GetSubscriptionAttributesAwaitable(Model::GetSubscriptionAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::GetSubscriptionAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTopicAttributesOutcome> GetTopicAttributesAwaitable(const Model::GetTopicAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::GetTopicAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetTopicAttributesOutcome> GetTopicAttributesAwaitable(Model::GetTopicAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::GetTopicAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListEndpointsByPlatformApplicationOutcome> ListEndpointsByPlatformApplicationAwaitable(const Model::ListEndpointsByPlatformApplicationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::ListEndpointsByPlatformApplication, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListEndpointsByPlatformApplicationOutcome> ListEndpointsByPlatformApplicationAwaitable(Model::ListEndpointsByPlatformApplicationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::ListEndpointsByPlatformApplication, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPlatformApplicationsOutcome> ListPlatformApplicationsAwaitable(const Model::ListPlatformApplicationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::ListPlatformApplications, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListPlatformApplicationsOutcome> ListPlatformApplicationsAwaitable(Model::ListPlatformApplicationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::ListPlatformApplications, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSubscriptionsOutcome> ListSubscriptionsAwaitable(const Model::ListSubscriptionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::ListSubscriptions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSubscriptionsOutcome> ListSubscriptionsAwaitable(Model::ListSubscriptionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::ListSubscriptions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSubscriptionsByTopicOutcome> ListSubscriptionsByTopicAwaitable(const Model::ListSubscriptionsByTopicRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::ListSubscriptionsByTopic, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSubscriptionsByTopicOutcome> ListSubscriptionsByTopicAwaitable(Model::ListSubscriptionsByTopicRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::ListSubscriptionsByTopic, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTopicsOutcome> ListTopicsAwaitable(const Model::ListTopicsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::ListTopics, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTopicsOutcome> ListTopicsAwaitable(Model::ListTopicsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::ListTopics, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PublishOutcome> PublishAwaitable(const Model::PublishRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::Publish, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PublishOutcome> PublishAwaitable(Model::PublishRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::Publish, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemovePermissionOutcome> RemovePermissionAwaitable(const Model::RemovePermissionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::RemovePermission, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemovePermissionOutcome> RemovePermissionAwaitable(Model::RemovePermissionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::RemovePermission, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetEndpointAttributesOutcome> SetEndpointAttributesAwaitable(const Model::SetEndpointAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::SetEndpointAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetEndpointAttributesOutcome> SetEndpointAttributesAwaitable(Model::SetEndpointAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::SetEndpointAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetPlatformApplicationAttributesOutcome> SetPlatformApplicationAttributesAwaitable(const Model::SetPlatformApplicationAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::SetPlatformApplicationAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetPlatformApplicationAttributesOutcome> SetPlatformApplicationAttributesAwaitable(Model::SetPlatformApplicationAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::SetPlatformApplicationAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetSubscriptionAttributesOutcome> SetSubscriptionAttributesAwaitable(const Model::SetSubscriptionAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::SetSubscriptionAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetSubscriptionAttributesOutcome> SetSubscriptionAttributesAwaitable(Model::SetSubscriptionAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::SetSubscriptionAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetTopicAttributesOutcome> SetTopicAttributesAwaitable(const Model::SetTopicAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::SetTopicAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetTopicAttributesOutcome> SetTopicAttributesAwaitable(Model::SetTopicAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::SetTopicAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SubscribeOutcome> SubscribeAwaitable(const Model::SubscribeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::Subscribe, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SubscribeOutcome> SubscribeAwaitable(Model::SubscribeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::Subscribe, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnsubscribeOutcome> UnsubscribeAwaitable(const Model::UnsubscribeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::Unsubscribe, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UnsubscribeOutcome> UnsubscribeAwaitable(Model::UnsubscribeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SNSClient::Unsubscribe, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -132,12 +132,22 @@ AddPermissionOutcome SNSClient::AddPermission(const AddPermissionRequest& reques
 
 AddPermissionOutcomeCallable SNSClient::AddPermissionCallable(const AddPermissionRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::AddPermission, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::AddPermission, Aws::Client::RejectedCallOutcome<AddPermissionOutcome>(), this, request);
+}
+
+AddPermissionOutcomeCallable SNSClient::AddPermissionCallable(AddPermissionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::AddPermission, Aws::Client::RejectedCallOutcome<AddPermissionOutcome>(), this, std::move(request));
 }
 
 void SNSClient::AddPermissionAsync(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::AddPermissionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::AddPermissionAsyncHelper, Aws::Client::RejectedAsyncCall<AddPermissionOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::AddPermissionAsync(AddPermissionRequest&& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::AddPermissionAsyncHelper, Aws::Client::RejectedAsyncCall<AddPermissionOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::AddPermissionAsyncHelper(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -162,12 +172,22 @@ ConfirmSubscriptionOutcome SNSClient::ConfirmSubscription(const ConfirmSubscript
 
 ConfirmSubscriptionOutcomeCallable SNSClient::ConfirmSubscriptionCallable(const ConfirmSubscriptionRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::ConfirmSubscription, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::ConfirmSubscription, Aws::Client::RejectedCallOutcome<ConfirmSubscriptionOutcome>(), this, request);
+}
+
+ConfirmSubscriptionOutcomeCallable SNSClient::ConfirmSubscriptionCallable(ConfirmSubscriptionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::ConfirmSubscription, Aws::Client::RejectedCallOutcome<ConfirmSubscriptionOutcome>(), this, std::move(request));
 }
 
 void SNSClient::ConfirmSubscriptionAsync(const ConfirmSubscriptionRequest& request, const ConfirmSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::ConfirmSubscriptionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::ConfirmSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<ConfirmSubscriptionOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::ConfirmSubscriptionAsync(ConfirmSubscriptionRequest&& request, const ConfirmSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::ConfirmSubscriptionAsyncHelper, Aws::Client::RejectedAsyncCall<ConfirmSubscriptionOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::ConfirmSubscriptionAsyncHelper(const ConfirmSubscriptionRequest& request, const ConfirmSubscriptionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -192,12 +212,22 @@ CreatePlatformApplicationOutcome SNSClient::CreatePlatformApplication(const Crea
 
 CreatePlatformApplicationOutcomeCallable SNSClient::CreatePlatformApplicationCallable(const CreatePlatformApplicationRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::CreatePlatformApplication, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::CreatePlatformApplication, Aws::Client::RejectedCallOutcome<CreatePlatformApplicationOutcome>(), this, request);
+}
+
+CreatePlatformApplicationOutcomeCallable SNSClient::CreatePlatformApplicationCallable(CreatePlatformApplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::CreatePlatformApplication, Aws::Client::RejectedCallOutcome<CreatePlatformApplicationOutcome>(), this, std::move(request));
 }
 
 void SNSClient::CreatePlatformApplicationAsync(const CreatePlatformApplicationRequest& request, const CreatePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::CreatePlatformApplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::CreatePlatformApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePlatformApplicationOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::CreatePlatformApplicationAsync(CreatePlatformApplicationRequest&& request, const CreatePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::CreatePlatformApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePlatformApplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::CreatePlatformApplicationAsyncHelper(const CreatePlatformApplicationRequest& request, const CreatePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -222,12 +252,22 @@ CreatePlatformEndpointOutcome SNSClient::CreatePlatformEndpoint(const CreatePlat
 
 CreatePlatformEndpointOutcomeCallable SNSClient::CreatePlatformEndpointCallable(const CreatePlatformEndpointRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::CreatePlatformEndpoint, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::CreatePlatformEndpoint, Aws::Client::RejectedCallOutcome<CreatePlatformEndpointOutcome>(), this, request);
+}
+
+CreatePlatformEndpointOutcomeCallable SNSClient::CreatePlatformEndpointCallable(CreatePlatformEndpointRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::CreatePlatformEndpoint, Aws::Client::RejectedCallOutcome<CreatePlatformEndpointOutcome>(), this, std::move(request));
 }
 
 void SNSClient::CreatePlatformEndpointAsync(const CreatePlatformEndpointRequest& request, const CreatePlatformEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::CreatePlatformEndpointAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::CreatePlatformEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePlatformEndpointOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::CreatePlatformEndpointAsync(CreatePlatformEndpointRequest&& request, const CreatePlatformEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::CreatePlatformEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<CreatePlatformEndpointOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::CreatePlatformEndpointAsyncHelper(const CreatePlatformEndpointRequest& request, const CreatePlatformEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -252,12 +292,22 @@ CreateTopicOutcome SNSClient::CreateTopic(const CreateTopicRequest& request) con
 
 CreateTopicOutcomeCallable SNSClient::CreateTopicCallable(const CreateTopicRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::CreateTopic, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::CreateTopic, Aws::Client::RejectedCallOutcome<CreateTopicOutcome>(), this, request);
+}
+
+CreateTopicOutcomeCallable SNSClient::CreateTopicCallable(CreateTopicRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::CreateTopic, Aws::Client::RejectedCallOutcome<CreateTopicOutcome>(), this, std::move(request));
 }
 
 void SNSClient::CreateTopicAsync(const CreateTopicRequest& request, const CreateTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::CreateTopicAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::CreateTopicAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTopicOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::CreateTopicAsync(CreateTopicRequest&& request, const CreateTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::CreateTopicAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTopicOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::CreateTopicAsyncHelper(const CreateTopicRequest& request, const CreateTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -282,12 +332,22 @@ DeleteEndpointOutcome SNSClient::DeleteEndpoint(const DeleteEndpointRequest& req
 
 DeleteEndpointOutcomeCallable SNSClient::DeleteEndpointCallable(const DeleteEndpointRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::DeleteEndpoint, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::DeleteEndpoint, Aws::Client::RejectedCallOutcome<DeleteEndpointOutcome>(), this, request);
+}
+
+DeleteEndpointOutcomeCallable SNSClient::DeleteEndpointCallable(DeleteEndpointRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::DeleteEndpoint, Aws::Client::RejectedCallOutcome<DeleteEndpointOutcome>(), this, std::move(request));
 }
 
 void SNSClient::DeleteEndpointAsync(const DeleteEndpointRequest& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::DeleteEndpointAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::DeleteEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteEndpointOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::DeleteEndpointAsync(DeleteEndpointRequest&& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::DeleteEndpointAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteEndpointOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::DeleteEndpointAsyncHelper(const DeleteEndpointRequest& request, const DeleteEndpointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -312,12 +372,22 @@ DeletePlatformApplicationOutcome SNSClient::DeletePlatformApplication(const Dele
 
 DeletePlatformApplicationOutcomeCallable SNSClient::DeletePlatformApplicationCallable(const DeletePlatformApplicationRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::DeletePlatformApplication, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::DeletePlatformApplication, Aws::Client::RejectedCallOutcome<DeletePlatformApplicationOutcome>(), this, request);
+}
+
+DeletePlatformApplicationOutcomeCallable SNSClient::DeletePlatformApplicationCallable(DeletePlatformApplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::DeletePlatformApplication, Aws::Client::RejectedCallOutcome<DeletePlatformApplicationOutcome>(), this, std::move(request));
 }
 
 void SNSClient::DeletePlatformApplicationAsync(const DeletePlatformApplicationRequest& request, const DeletePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::DeletePlatformApplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::DeletePlatformApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePlatformApplicationOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::DeletePlatformApplicationAsync(DeletePlatformApplicationRequest&& request, const DeletePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::DeletePlatformApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<DeletePlatformApplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::DeletePlatformApplicationAsyncHelper(const DeletePlatformApplicationRequest& request, const DeletePlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -342,12 +412,22 @@ DeleteTopicOutcome SNSClient::DeleteTopic(const DeleteTopicRequest& request) con
 
 DeleteTopicOutcomeCallable SNSClient::DeleteTopicCallable(const DeleteTopicRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::DeleteTopic, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::DeleteTopic, Aws::Client::RejectedCallOutcome<DeleteTopicOutcome>(), this, request);
+}
+
+DeleteTopicOutcomeCallable SNSClient::DeleteTopicCallable(DeleteTopicRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::DeleteTopic, Aws::Client::RejectedCallOutcome<DeleteTopicOutcome>(), this, std::move(request));
 }
 
 void SNSClient::DeleteTopicAsync(const DeleteTopicRequest& request, const DeleteTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::DeleteTopicAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::DeleteTopicAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTopicOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::DeleteTopicAsync(DeleteTopicRequest&& request, const DeleteTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::DeleteTopicAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTopicOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::DeleteTopicAsyncHelper(const DeleteTopicRequest& request, const DeleteTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -372,12 +452,22 @@ GetEndpointAttributesOutcome SNSClient::GetEndpointAttributes(const GetEndpointA
 
 GetEndpointAttributesOutcomeCallable SNSClient::GetEndpointAttributesCallable(const GetEndpointAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::GetEndpointAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::GetEndpointAttributes, Aws::Client::RejectedCallOutcome<GetEndpointAttributesOutcome>(), this, request);
+}
+
+GetEndpointAttributesOutcomeCallable SNSClient::GetEndpointAttributesCallable(GetEndpointAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::GetEndpointAttributes, Aws::Client::RejectedCallOutcome<GetEndpointAttributesOutcome>(), this, std::move(request));
 }
 
 void SNSClient::GetEndpointAttributesAsync(const GetEndpointAttributesRequest& request, const GetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::GetEndpointAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::GetEndpointAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetEndpointAttributesOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::GetEndpointAttributesAsync(GetEndpointAttributesRequest&& request, const GetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::GetEndpointAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetEndpointAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::GetEndpointAttributesAsyncHelper(const GetEndpointAttributesRequest& request, const GetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -402,12 +492,22 @@ GetPlatformApplicationAttributesOutcome SNSClient::GetPlatformApplicationAttribu
 
 GetPlatformApplicationAttributesOutcomeCallable SNSClient::GetPlatformApplicationAttributesCallable(const GetPlatformApplicationAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::GetPlatformApplicationAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::GetPlatformApplicationAttributes, Aws::Client::RejectedCallOutcome<GetPlatformApplicationAttributesOutcome>(), this, request);
+}
+
+GetPlatformApplicationAttributesOutcomeCallable SNSClient::GetPlatformApplicationAttributesCallable(GetPlatformApplicationAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::GetPlatformApplicationAttributes, Aws::Client::RejectedCallOutcome<GetPlatformApplicationAttributesOutcome>(), this, std::move(request));
 }
 
 void SNSClient::GetPlatformApplicationAttributesAsync(const GetPlatformApplicationAttributesRequest& request, const GetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::GetPlatformApplicationAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::GetPlatformApplicationAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetPlatformApplicationAttributesOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::GetPlatformApplicationAttributesAsync(GetPlatformApplicationAttributesRequest&& request, const GetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::GetPlatformApplicationAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetPlatformApplicationAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::GetPlatformApplicationAttributesAsyncHelper(const GetPlatformApplicationAttributesRequest& request, const GetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -432,12 +532,22 @@ GetSubscriptionAttributesOutcome SNSClient::GetSubscriptionAttributes(const GetS
 
 GetSubscriptionAttributesOutcomeCallable SNSClient::GetSubscriptionAttributesCallable(const GetSubscriptionAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::GetSubscriptionAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::GetSubscriptionAttributes, Aws::Client::RejectedCallOutcome<GetSubscriptionAttributesOutcome>(), this, request);
+}
+
+GetSubscriptionAttributesOutcomeCallable SNSClient::GetSubscriptionAttributesCallable(GetSubscriptionAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::GetSubscriptionAttributes, Aws::Client::RejectedCallOutcome<GetSubscriptionAttributesOutcome>(), this, std::move(request));
 }
 
 void SNSClient::GetSubscriptionAttributesAsync(const GetSubscriptionAttributesRequest& request, const GetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::GetSubscriptionAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::GetSubscriptionAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetSubscriptionAttributesOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::GetSubscriptionAttributesAsync(GetSubscriptionAttributesRequest&& request, const GetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::GetSubscriptionAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetSubscriptionAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::GetSubscriptionAttributesAsyncHelper(const GetSubscriptionAttributesRequest& request, const GetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -462,12 +572,22 @@ GetTopicAttributesOutcome SNSClient::GetTopicAttributes(const GetTopicAttributes
 
 GetTopicAttributesOutcomeCallable SNSClient::GetTopicAttributesCallable(const GetTopicAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::GetTopicAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::GetTopicAttributes, Aws::Client::RejectedCallOutcome<GetTopicAttributesOutcome>(), this, request);
+}
+
+GetTopicAttributesOutcomeCallable SNSClient::GetTopicAttributesCallable(GetTopicAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::GetTopicAttributes, Aws::Client::RejectedCallOutcome<GetTopicAttributesOutcome>(), this, std::move(request));
 }
 
 void SNSClient::GetTopicAttributesAsync(const GetTopicAttributesRequest& request, const GetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::GetTopicAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::GetTopicAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetTopicAttributesOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::GetTopicAttributesAsync(GetTopicAttributesRequest&& request, const GetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::GetTopicAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetTopicAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::GetTopicAttributesAsyncHelper(const GetTopicAttributesRequest& request, const GetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -492,12 +612,22 @@ ListEndpointsByPlatformApplicationOutcome SNSClient::ListEndpointsByPlatformAppl
 
 ListEndpointsByPlatformApplicationOutcomeCallable SNSClient::ListEndpointsByPlatformApplicationCallable(const ListEndpointsByPlatformApplicationRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::ListEndpointsByPlatformApplication, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::ListEndpointsByPlatformApplication, Aws::Client::RejectedCallOutcome<ListEndpointsByPlatformApplicationOutcome>(), this, request);
+}
+
+ListEndpointsByPlatformApplicationOutcomeCallable SNSClient::ListEndpointsByPlatformApplicationCallable(ListEndpointsByPlatformApplicationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::ListEndpointsByPlatformApplication, Aws::Client::RejectedCallOutcome<ListEndpointsByPlatformApplicationOutcome>(), this, std::move(request));
 }
 
 void SNSClient::ListEndpointsByPlatformApplicationAsync(const ListEndpointsByPlatformApplicationRequest& request, const ListEndpointsByPlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::ListEndpointsByPlatformApplicationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::ListEndpointsByPlatformApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<ListEndpointsByPlatformApplicationOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::ListEndpointsByPlatformApplicationAsync(ListEndpointsByPlatformApplicationRequest&& request, const ListEndpointsByPlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::ListEndpointsByPlatformApplicationAsyncHelper, Aws::Client::RejectedAsyncCall<ListEndpointsByPlatformApplicationOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::ListEndpointsByPlatformApplicationAsyncHelper(const ListEndpointsByPlatformApplicationRequest& request, const ListEndpointsByPlatformApplicationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -522,12 +652,22 @@ ListPlatformApplicationsOutcome SNSClient::ListPlatformApplications(const ListPl
 
 ListPlatformApplicationsOutcomeCallable SNSClient::ListPlatformApplicationsCallable(const ListPlatformApplicationsRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::ListPlatformApplications, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::ListPlatformApplications, Aws::Client::RejectedCallOutcome<ListPlatformApplicationsOutcome>(), this, request);
+}
+
+ListPlatformApplicationsOutcomeCallable SNSClient::ListPlatformApplicationsCallable(ListPlatformApplicationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::ListPlatformApplications, Aws::Client::RejectedCallOutcome<ListPlatformApplicationsOutcome>(), this, std::move(request));
 }
 
 void SNSClient::ListPlatformApplicationsAsync(const ListPlatformApplicationsRequest& request, const ListPlatformApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::ListPlatformApplicationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::ListPlatformApplicationsAsyncHelper, Aws::Client::RejectedAsyncCall<ListPlatformApplicationsOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::ListPlatformApplicationsAsync(ListPlatformApplicationsRequest&& request, const ListPlatformApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::ListPlatformApplicationsAsyncHelper, Aws::Client::RejectedAsyncCall<ListPlatformApplicationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::ListPlatformApplicationsAsyncHelper(const ListPlatformApplicationsRequest& request, const ListPlatformApplicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -552,12 +692,22 @@ ListSubscriptionsOutcome SNSClient::ListSubscriptions(const ListSubscriptionsReq
 
 ListSubscriptionsOutcomeCallable SNSClient::ListSubscriptionsCallable(const ListSubscriptionsRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::ListSubscriptions, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::ListSubscriptions, Aws::Client::RejectedCallOutcome<ListSubscriptionsOutcome>(), this, request);
+}
+
+ListSubscriptionsOutcomeCallable SNSClient::ListSubscriptionsCallable(ListSubscriptionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::ListSubscriptions, Aws::Client::RejectedCallOutcome<ListSubscriptionsOutcome>(), this, std::move(request));
 }
 
 void SNSClient::ListSubscriptionsAsync(const ListSubscriptionsRequest& request, const ListSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::ListSubscriptionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::ListSubscriptionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListSubscriptionsOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::ListSubscriptionsAsync(ListSubscriptionsRequest&& request, const ListSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::ListSubscriptionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListSubscriptionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::ListSubscriptionsAsyncHelper(const ListSubscriptionsRequest& request, const ListSubscriptionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -582,12 +732,22 @@ ListSubscriptionsByTopicOutcome SNSClient::ListSubscriptionsByTopic(const ListSu
 
 ListSubscriptionsByTopicOutcomeCallable SNSClient::ListSubscriptionsByTopicCallable(const ListSubscriptionsByTopicRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::ListSubscriptionsByTopic, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::ListSubscriptionsByTopic, Aws::Client::RejectedCallOutcome<ListSubscriptionsByTopicOutcome>(), this, request);
+}
+
+ListSubscriptionsByTopicOutcomeCallable SNSClient::ListSubscriptionsByTopicCallable(ListSubscriptionsByTopicRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::ListSubscriptionsByTopic, Aws::Client::RejectedCallOutcome<ListSubscriptionsByTopicOutcome>(), this, std::move(request));
 }
 
 void SNSClient::ListSubscriptionsByTopicAsync(const ListSubscriptionsByTopicRequest& request, const ListSubscriptionsByTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::ListSubscriptionsByTopicAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::ListSubscriptionsByTopicAsyncHelper, Aws::Client::RejectedAsyncCall<ListSubscriptionsByTopicOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::ListSubscriptionsByTopicAsync(ListSubscriptionsByTopicRequest&& request, const ListSubscriptionsByTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::ListSubscriptionsByTopicAsyncHelper, Aws::Client::RejectedAsyncCall<ListSubscriptionsByTopicOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::ListSubscriptionsByTopicAsyncHelper(const ListSubscriptionsByTopicRequest& request, const ListSubscriptionsByTopicResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -612,12 +772,22 @@ ListTopicsOutcome SNSClient::ListTopics(const ListTopicsRequest& request) const
 
 ListTopicsOutcomeCallable SNSClient::ListTopicsCallable(const ListTopicsRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::ListTopics, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::ListTopics, Aws::Client::RejectedCallOutcome<ListTopicsOutcome>(), this, request);
+}
+
+ListTopicsOutcomeCallable SNSClient::ListTopicsCallable(ListTopicsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::ListTopics, Aws::Client::RejectedCallOutcome<ListTopicsOutcome>(), this, std::move(request));
 }
 
 void SNSClient::ListTopicsAsync(const ListTopicsRequest& request, const ListTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::ListTopicsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::ListTopicsAsyncHelper, Aws::Client::RejectedAsyncCall<ListTopicsOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::ListTopicsAsync(ListTopicsRequest&& request, const ListTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::ListTopicsAsyncHelper, Aws::Client::RejectedAsyncCall<ListTopicsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::ListTopicsAsyncHelper(const ListTopicsRequest& request, const ListTopicsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -642,12 +812,22 @@ PublishOutcome SNSClient::Publish(const PublishRequest& request) const
 
 PublishOutcomeCallable SNSClient::PublishCallable(const PublishRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::Publish, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::Publish, Aws::Client::RejectedCallOutcome<PublishOutcome>(), this, request);
+}
+
+PublishOutcomeCallable SNSClient::PublishCallable(PublishRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::Publish, Aws::Client::RejectedCallOutcome<PublishOutcome>(), this, std::move(request));
 }
 
 void SNSClient::PublishAsync(const PublishRequest& request, const PublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::PublishAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::PublishAsyncHelper, Aws::Client::RejectedAsyncCall<PublishOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::PublishAsync(PublishRequest&& request, const PublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::PublishAsyncHelper, Aws::Client::RejectedAsyncCall<PublishOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::PublishAsyncHelper(const PublishRequest& request, const PublishResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -672,12 +852,22 @@ RemovePermissionOutcome SNSClient::RemovePermission(const RemovePermissionReques
 
 RemovePermissionOutcomeCallable SNSClient::RemovePermissionCallable(const RemovePermissionRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::RemovePermission, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::RemovePermission, Aws::Client::RejectedCallOutcome<RemovePermissionOutcome>(), this, request);
+}
+
+RemovePermissionOutcomeCallable SNSClient::RemovePermissionCallable(RemovePermissionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::RemovePermission, Aws::Client::RejectedCallOutcome<RemovePermissionOutcome>(), this, std::move(request));
 }
 
 void SNSClient::RemovePermissionAsync(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::RemovePermissionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::RemovePermissionAsyncHelper, Aws::Client::RejectedAsyncCall<RemovePermissionOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::RemovePermissionAsync(RemovePermissionRequest&& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::RemovePermissionAsyncHelper, Aws::Client::RejectedAsyncCall<RemovePermissionOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::RemovePermissionAsyncHelper(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -702,12 +892,22 @@ SetEndpointAttributesOutcome SNSClient::SetEndpointAttributes(const SetEndpointA
 
 SetEndpointAttributesOutcomeCallable SNSClient::SetEndpointAttributesCallable(const SetEndpointAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::SetEndpointAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::SetEndpointAttributes, Aws::Client::RejectedCallOutcome<SetEndpointAttributesOutcome>(), this, request);
+}
+
+SetEndpointAttributesOutcomeCallable SNSClient::SetEndpointAttributesCallable(SetEndpointAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::SetEndpointAttributes, Aws::Client::RejectedCallOutcome<SetEndpointAttributesOutcome>(), this, std::move(request));
 }
 
 void SNSClient::SetEndpointAttributesAsync(const SetEndpointAttributesRequest& request, const SetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::SetEndpointAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::SetEndpointAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<SetEndpointAttributesOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::SetEndpointAttributesAsync(SetEndpointAttributesRequest&& request, const SetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::SetEndpointAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<SetEndpointAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::SetEndpointAttributesAsyncHelper(const SetEndpointAttributesRequest& request, const SetEndpointAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -732,12 +932,22 @@ SetPlatformApplicationAttributesOutcome SNSClient::SetPlatformApplicationAttribu
 
 SetPlatformApplicationAttributesOutcomeCallable SNSClient::SetPlatformApplicationAttributesCallable(const SetPlatformApplicationAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::SetPlatformApplicationAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::SetPlatformApplicationAttributes, Aws::Client::RejectedCallOutcome<SetPlatformApplicationAttributesOutcome>(), this, request);
+}
+
+SetPlatformApplicationAttributesOutcomeCallable SNSClient::SetPlatformApplicationAttributesCallable(SetPlatformApplicationAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::SetPlatformApplicationAttributes, Aws::Client::RejectedCallOutcome<SetPlatformApplicationAttributesOutcome>(), this, std::move(request));
 }
 
 void SNSClient::SetPlatformApplicationAttributesAsync(const SetPlatformApplicationAttributesRequest& request, const SetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::SetPlatformApplicationAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::SetPlatformApplicationAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<SetPlatformApplicationAttributesOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::SetPlatformApplicationAttributesAsync(SetPlatformApplicationAttributesRequest&& request, const SetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::SetPlatformApplicationAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<SetPlatformApplicationAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::SetPlatformApplicationAttributesAsyncHelper(const SetPlatformApplicationAttributesRequest& request, const SetPlatformApplicationAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -762,12 +972,22 @@ SetSubscriptionAttributesOutcome SNSClient::SetSubscriptionAttributes(const SetS
 
 SetSubscriptionAttributesOutcomeCallable SNSClient::SetSubscriptionAttributesCallable(const SetSubscriptionAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::SetSubscriptionAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::SetSubscriptionAttributes, Aws::Client::RejectedCallOutcome<SetSubscriptionAttributesOutcome>(), this, request);
+}
+
+SetSubscriptionAttributesOutcomeCallable SNSClient::SetSubscriptionAttributesCallable(SetSubscriptionAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::SetSubscriptionAttributes, Aws::Client::RejectedCallOutcome<SetSubscriptionAttributesOutcome>(), this, std::move(request));
 }
 
 void SNSClient::SetSubscriptionAttributesAsync(const SetSubscriptionAttributesRequest& request, const SetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::SetSubscriptionAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::SetSubscriptionAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<SetSubscriptionAttributesOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::SetSubscriptionAttributesAsync(SetSubscriptionAttributesRequest&& request, const SetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::SetSubscriptionAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<SetSubscriptionAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::SetSubscriptionAttributesAsyncHelper(const SetSubscriptionAttributesRequest& request, const SetSubscriptionAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -792,12 +1012,22 @@ SetTopicAttributesOutcome SNSClient::SetTopicAttributes(const SetTopicAttributes
 
 SetTopicAttributesOutcomeCallable SNSClient::SetTopicAttributesCallable(const SetTopicAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::SetTopicAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::SetTopicAttributes, Aws::Client::RejectedCallOutcome<SetTopicAttributesOutcome>(), this, request);
+}
+
+SetTopicAttributesOutcomeCallable SNSClient::SetTopicAttributesCallable(SetTopicAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::SetTopicAttributes, Aws::Client::RejectedCallOutcome<SetTopicAttributesOutcome>(), this, std::move(request));
 }
 
 void SNSClient::SetTopicAttributesAsync(const SetTopicAttributesRequest& request, const SetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::SetTopicAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::SetTopicAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<SetTopicAttributesOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::SetTopicAttributesAsync(SetTopicAttributesRequest&& request, const SetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::SetTopicAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<SetTopicAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::SetTopicAttributesAsyncHelper(const SetTopicAttributesRequest& request, const SetTopicAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -822,12 +1052,22 @@ SubscribeOutcome SNSClient::Subscribe(const SubscribeRequest& request) const
 
 SubscribeOutcomeCallable SNSClient::SubscribeCallable(const SubscribeRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::Subscribe, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::Subscribe, Aws::Client::RejectedCallOutcome<SubscribeOutcome>(), this, request);
+}
+
+SubscribeOutcomeCallable SNSClient::SubscribeCallable(SubscribeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::Subscribe, Aws::Client::RejectedCallOutcome<SubscribeOutcome>(), this, std::move(request));
 }
 
 void SNSClient::SubscribeAsync(const SubscribeRequest& request, const SubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::SubscribeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::SubscribeAsyncHelper, Aws::Client::RejectedAsyncCall<SubscribeOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::SubscribeAsync(SubscribeRequest&& request, const SubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::SubscribeAsyncHelper, Aws::Client::RejectedAsyncCall<SubscribeOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::SubscribeAsyncHelper(const SubscribeRequest& request, const SubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -852,12 +1092,22 @@ UnsubscribeOutcome SNSClient::Unsubscribe(const UnsubscribeRequest& request) con
 
 UnsubscribeOutcomeCallable SNSClient::UnsubscribeCallable(const UnsubscribeRequest& request) const
 {
-  return std::async(std::launch::async, &SNSClient::Unsubscribe, this, request);
+  return m_executor->SubmitWithFuture(&SNSClient::Unsubscribe, Aws::Client::RejectedCallOutcome<UnsubscribeOutcome>(), this, request);
+}
+
+UnsubscribeOutcomeCallable SNSClient::UnsubscribeCallable(UnsubscribeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SNSClient::Unsubscribe, Aws::Client::RejectedCallOutcome<UnsubscribeOutcome>(), this, std::move(request));
 }
 
 void SNSClient::UnsubscribeAsync(const UnsubscribeRequest& request, const UnsubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SNSClient::UnsubscribeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SNSClient::UnsubscribeAsyncHelper, Aws::Client::RejectedAsyncCall<UnsubscribeOutcome>(), this, request, handler, context);
+}
+
+void SNSClient::UnsubscribeAsync(UnsubscribeRequest&& request, const UnsubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SNSClient::UnsubscribeAsyncHelper, Aws::Client::RejectedAsyncCall<UnsubscribeOutcome>(), this, std::move(request), handler, context);
 }
 
 void SNSClient::UnsubscribeAsyncHelper(const UnsubscribeRequest& request, const UnsubscribeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
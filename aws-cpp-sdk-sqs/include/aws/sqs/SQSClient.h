@@ -33,6 +33,27 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/sqs/model/AddPermissionRequest.h>
+#include <aws/sqs/model/ChangeMessageVisibilityRequest.h>
+#include <aws/sqs/model/ChangeMessageVisibilityBatchRequest.h>
+#include <aws/sqs/model/CreateQueueRequest.h>
+#include <aws/sqs/model/DeleteMessageRequest.h>
+#include <aws/sqs/model/DeleteMessageBatchRequest.h>
+#include <aws/sqs/model/DeleteQueueRequest.h>
+#include <aws/sqs/model/GetQueueAttributesRequest.h>
+#include <aws/sqs/model/GetQueueUrlRequest.h>
+#include <aws/sqs/model/ListDeadLetterSourceQueuesRequest.h>
+#include <aws/sqs/model/ListQueuesRequest.h>
+#include <aws/sqs/model/PurgeQueueRequest.h>
+#include <aws/sqs/model/ReceiveMessageRequest.h>
+#include <aws/sqs/model/RemovePermissionRequest.h>
+#include <aws/sqs/model/SendMessageRequest.h>
+#include <aws/sqs/model/SendMessageBatchRequest.h>
+#include <aws/sqs/model/SetQueueAttributesRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -251,6 +272,11 @@ namespace Model
          */
         virtual Model::AddPermissionOutcomeCallable AddPermissionCallable(const Model::AddPermissionRequest& request) const;
 
+        /**
+         * Same as AddPermissionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddPermissionOutcomeCallable AddPermissionCallable(Model::AddPermissionRequest&& request) const;
+
         /**
          * <p>Adds a permission to a queue for a specific <a
          * href="http://docs.aws.amazon.com/general/latest/gr/glos-chap.html#P">principal</a>.
@@ -275,6 +301,11 @@ namespace Model
          */
         virtual void AddPermissionAsync(const Model::AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddPermissionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddPermissionAsync(Model::AddPermissionRequest&& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the visibility timeout of a specified message in a queue to a new
          * value. The maximum allowed timeout value you can set the value to is 12 hours.
@@ -341,6 +372,11 @@ namespace Model
          */
         virtual Model::ChangeMessageVisibilityOutcomeCallable ChangeMessageVisibilityCallable(const Model::ChangeMessageVisibilityRequest& request) const;
 
+        /**
+         * Same as ChangeMessageVisibilityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ChangeMessageVisibilityOutcomeCallable ChangeMessageVisibilityCallable(Model::ChangeMessageVisibilityRequest&& request) const;
+
         /**
          * <p>Changes the visibility timeout of a specified message in a queue to a new
          * value. The maximum allowed timeout value you can set the value to is 12 hours.
@@ -375,6 +411,11 @@ namespace Model
          */
         virtual void ChangeMessageVisibilityAsync(const Model::ChangeMessageVisibilityRequest& request, const ChangeMessageVisibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ChangeMessageVisibilityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ChangeMessageVisibilityAsync(Model::ChangeMessageVisibilityRequest&& request, const ChangeMessageVisibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Changes the visibility timeout of multiple messages. This is a batch version
          * of <a>ChangeMessageVisibility</a>. The result of the action on each message is
@@ -409,6 +450,11 @@ namespace Model
          */
         virtual Model::ChangeMessageVisibilityBatchOutcomeCallable ChangeMessageVisibilityBatchCallable(const Model::ChangeMessageVisibilityBatchRequest& request) const;
 
+        /**
+         * Same as ChangeMessageVisibilityBatchCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ChangeMessageVisibilityBatchOutcomeCallable ChangeMessageVisibilityBatchCallable(Model::ChangeMessageVisibilityBatchRequest&& request) const;
+
         /**
          * <p>Changes the visibility timeout of multiple messages. This is a batch version
          * of <a>ChangeMessageVisibility</a>. The result of the action on each message is
@@ -427,6 +473,11 @@ namespace Model
          */
         virtual void ChangeMessageVisibilityBatchAsync(const Model::ChangeMessageVisibilityBatchRequest& request, const ChangeMessageVisibilityBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ChangeMessageVisibilityBatchAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ChangeMessageVisibilityBatchAsync(Model::ChangeMessageVisibilityBatchRequest&& request, const ChangeMessageVisibilityBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new queue, or returns the URL of an existing one. When you request
          * <code>CreateQueue</code>, you provide a name for the queue. To successfully
@@ -475,6 +526,11 @@ namespace Model
          */
         virtual Model::CreateQueueOutcomeCallable CreateQueueCallable(const Model::CreateQueueRequest& request) const;
 
+        /**
+         * Same as CreateQueueCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateQueueOutcomeCallable CreateQueueCallable(Model::CreateQueueRequest&& request) const;
+
         /**
          * <p>Creates a new queue, or returns the URL of an existing one. When you request
          * <code>CreateQueue</code>, you provide a name for the queue. To successfully
@@ -500,6 +556,11 @@ namespace Model
          */
         virtual void CreateQueueAsync(const Model::CreateQueueRequest& request, const CreateQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateQueueAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateQueueAsync(Model::CreateQueueRequest&& request, const CreateQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the specified message from the specified queue. You specify the
          * message by using the message's <code>receipt handle</code> and not the
@@ -546,6 +607,11 @@ namespace Model
          */
         virtual Model::DeleteMessageOutcomeCallable DeleteMessageCallable(const Model::DeleteMessageRequest& request) const;
 
+        /**
+         * Same as DeleteMessageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteMessageOutcomeCallable DeleteMessageCallable(Model::DeleteMessageRequest&& request) const;
+
         /**
          * <p> Deletes the specified message from the specified queue. You specify the
          * message by using the message's <code>receipt handle</code> and not the
@@ -570,6 +636,11 @@ namespace Model
          */
         virtual void DeleteMessageAsync(const Model::DeleteMessageRequest& request, const DeleteMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteMessageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteMessageAsync(Model::DeleteMessageRequest&& request, const DeleteMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes up to ten messages from the specified queue. This is a batch version
          * of <a>DeleteMessage</a>. The result of the delete action on each message is
@@ -600,6 +671,11 @@ namespace Model
          */
         virtual Model::DeleteMessageBatchOutcomeCallable DeleteMessageBatchCallable(const Model::DeleteMessageBatchRequest& request) const;
 
+        /**
+         * Same as DeleteMessageBatchCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteMessageBatchOutcomeCallable DeleteMessageBatchCallable(Model::DeleteMessageBatchRequest&& request) const;
+
         /**
          * <p>Deletes up to ten messages from the specified queue. This is a batch version
          * of <a>DeleteMessage</a>. The result of the delete action on each message is
@@ -616,6 +692,11 @@ namespace Model
          */
         virtual void DeleteMessageBatchAsync(const Model::DeleteMessageBatchRequest& request, const DeleteMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteMessageBatchAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteMessageBatchAsync(Model::DeleteMessageBatchRequest&& request, const DeleteMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Deletes the queue specified by the <b>queue URL</b>, regardless of whether
          * the queue is empty. If the specified queue does not exist, Amazon SQS returns a
@@ -652,6 +733,11 @@ namespace Model
          */
         virtual Model::DeleteQueueOutcomeCallable DeleteQueueCallable(const Model::DeleteQueueRequest& request) const;
 
+        /**
+         * Same as DeleteQueueCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteQueueOutcomeCallable DeleteQueueCallable(Model::DeleteQueueRequest&& request) const;
+
         /**
          * <p> Deletes the queue specified by the <b>queue URL</b>, regardless of whether
          * the queue is empty. If the specified queue does not exist, Amazon SQS returns a
@@ -671,6 +757,11 @@ namespace Model
          */
         virtual void DeleteQueueAsync(const Model::DeleteQueueRequest& request, const DeleteQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteQueueAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteQueueAsync(Model::DeleteQueueRequest&& request, const DeleteQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets attributes for the specified queue. The following attributes are
          * supported: <ul> <li> <code>All</code> - returns all values.</li> <li>
@@ -763,6 +854,11 @@ namespace Model
          */
         virtual Model::GetQueueAttributesOutcomeCallable GetQueueAttributesCallable(const Model::GetQueueAttributesRequest& request) const;
 
+        /**
+         * Same as GetQueueAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetQueueAttributesOutcomeCallable GetQueueAttributesCallable(Model::GetQueueAttributesRequest&& request) const;
+
         /**
          * <p>Gets attributes for the specified queue. The following attributes are
          * supported: <ul> <li> <code>All</code> - returns all values.</li> <li>
@@ -810,6 +906,11 @@ namespace Model
          */
         virtual void GetQueueAttributesAsync(const Model::GetQueueAttributesRequest& request, const GetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetQueueAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetQueueAttributesAsync(Model::GetQueueAttributesRequest&& request, const GetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Returns the URL of an existing queue. This action provides a simple way to
          * retrieve the URL of an Amazon SQS queue. </p> <p> To access a queue that belongs
@@ -836,6 +937,11 @@ namespace Model
          */
         virtual Model::GetQueueUrlOutcomeCallable GetQueueUrlCallable(const Model::GetQueueUrlRequest& request) const;
 
+        /**
+         * Same as GetQueueUrlCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetQueueUrlOutcomeCallable GetQueueUrlCallable(Model::GetQueueUrlRequest&& request) const;
+
         /**
          * <p> Returns the URL of an existing queue. This action provides a simple way to
          * retrieve the URL of an Amazon SQS queue. </p> <p> To access a queue that belongs
@@ -850,6 +956,11 @@ namespace Model
          */
         virtual void GetQueueUrlAsync(const Model::GetQueueUrlRequest& request, const GetQueueUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetQueueUrlAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetQueueUrlAsync(Model::GetQueueUrlRequest&& request, const GetQueueUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of your queues that have the RedrivePolicy queue attribute
          * configured with a dead letter queue.</p> <p>For more information about using
@@ -870,6 +981,11 @@ namespace Model
          */
         virtual Model::ListDeadLetterSourceQueuesOutcomeCallable ListDeadLetterSourceQueuesCallable(const Model::ListDeadLetterSourceQueuesRequest& request) const;
 
+        /**
+         * Same as ListDeadLetterSourceQueuesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDeadLetterSourceQueuesOutcomeCallable ListDeadLetterSourceQueuesCallable(Model::ListDeadLetterSourceQueuesRequest&& request) const;
+
         /**
          * <p>Returns a list of your queues that have the RedrivePolicy queue attribute
          * configured with a dead letter queue.</p> <p>For more information about using
@@ -881,6 +997,11 @@ namespace Model
          */
         virtual void ListDeadLetterSourceQueuesAsync(const Model::ListDeadLetterSourceQueuesRequest& request, const ListDeadLetterSourceQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDeadLetterSourceQueuesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDeadLetterSourceQueuesAsync(Model::ListDeadLetterSourceQueuesRequest&& request, const ListDeadLetterSourceQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of your queues. The maximum number of queues that can be
          * returned is 1000. If you specify a value for the optional
@@ -899,6 +1020,11 @@ namespace Model
          */
         virtual Model::ListQueuesOutcomeCallable ListQueuesCallable(const Model::ListQueuesRequest& request) const;
 
+        /**
+         * Same as ListQueuesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListQueuesOutcomeCallable ListQueuesCallable(Model::ListQueuesRequest&& request) const;
+
         /**
          * <p>Returns a list of your queues. The maximum number of queues that can be
          * returned is 1000. If you specify a value for the optional
@@ -909,6 +1035,11 @@ namespace Model
          */
         virtual void ListQueuesAsync(const Model::ListQueuesRequest& request, const ListQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListQueuesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListQueuesAsync(Model::ListQueuesRequest&& request, const ListQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the messages in a queue specified by the <b>queue URL</b>.</p>
          * <important>When you use the <code>PurgeQueue</code> API, the deleted messages in
@@ -935,6 +1066,11 @@ namespace Model
          */
         virtual Model::PurgeQueueOutcomeCallable PurgeQueueCallable(const Model::PurgeQueueRequest& request) const;
 
+        /**
+         * Same as PurgeQueueCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PurgeQueueOutcomeCallable PurgeQueueCallable(Model::PurgeQueueRequest&& request) const;
+
         /**
          * <p>Deletes the messages in a queue specified by the <b>queue URL</b>.</p>
          * <important>When you use the <code>PurgeQueue</code> API, the deleted messages in
@@ -949,6 +1085,11 @@ namespace Model
          */
         virtual void PurgeQueueAsync(const Model::PurgeQueueRequest& request, const PurgeQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PurgeQueueAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PurgeQueueAsync(Model::PurgeQueueRequest&& request, const PurgeQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Retrieves one or more messages, with a maximum limit of 10 messages, from
          * the specified queue. Long poll support is enabled by using the
@@ -1023,6 +1164,11 @@ namespace Model
          */
         virtual Model::ReceiveMessageOutcomeCallable ReceiveMessageCallable(const Model::ReceiveMessageRequest& request) const;
 
+        /**
+         * Same as ReceiveMessageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ReceiveMessageOutcomeCallable ReceiveMessageCallable(Model::ReceiveMessageRequest&& request) const;
+
         /**
          * <p> Retrieves one or more messages, with a maximum limit of 10 messages, from
          * the specified queue. Long poll support is enabled by using the
@@ -1061,6 +1207,11 @@ namespace Model
          */
         virtual void ReceiveMessageAsync(const Model::ReceiveMessageRequest& request, const ReceiveMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ReceiveMessageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ReceiveMessageAsync(Model::ReceiveMessageRequest&& request, const ReceiveMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Revokes any permissions in the queue policy that matches the specified
          * <code>Label</code> parameter. Only the owner of the queue can remove
@@ -1077,6 +1228,11 @@ namespace Model
          */
         virtual Model::RemovePermissionOutcomeCallable RemovePermissionCallable(const Model::RemovePermissionRequest& request) const;
 
+        /**
+         * Same as RemovePermissionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemovePermissionOutcomeCallable RemovePermissionCallable(Model::RemovePermissionRequest&& request) const;
+
         /**
          * <p>Revokes any permissions in the queue policy that matches the specified
          * <code>Label</code> parameter. Only the owner of the queue can remove
@@ -1086,6 +1242,11 @@ namespace Model
          */
         virtual void RemovePermissionAsync(const Model::RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemovePermissionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemovePermissionAsync(Model::RemovePermissionRequest&& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> Delivers a message to the specified queue. With Amazon SQS, you now have the
          * ability to send large payload messages that are up to 256KB (262,144 bytes) in
@@ -1118,6 +1279,11 @@ namespace Model
          */
         virtual Model::SendMessageOutcomeCallable SendMessageCallable(const Model::SendMessageRequest& request) const;
 
+        /**
+         * Same as SendMessageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SendMessageOutcomeCallable SendMessageCallable(Model::SendMessageRequest&& request) const;
+
         /**
          * <p> Delivers a message to the specified queue. With Amazon SQS, you now have the
          * ability to send large payload messages that are up to 256KB (262,144 bytes) in
@@ -1135,6 +1301,11 @@ namespace Model
          */
         virtual void SendMessageAsync(const Model::SendMessageRequest& request, const SendMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SendMessageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SendMessageAsync(Model::SendMessageRequest&& request, const SendMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Delivers up to ten messages to the specified queue. This is a batch version
          * of <a>SendMessage</a>. The result of the send action on each message is reported
@@ -1185,6 +1356,11 @@ namespace Model
          */
         virtual Model::SendMessageBatchOutcomeCallable SendMessageBatchCallable(const Model::SendMessageBatchRequest& request) const;
 
+        /**
+         * Same as SendMessageBatchCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SendMessageBatchOutcomeCallable SendMessageBatchCallable(Model::SendMessageBatchRequest&& request) const;
+
         /**
          * <p>Delivers up to ten messages to the specified queue. This is a batch version
          * of <a>SendMessage</a>. The result of the send action on each message is reported
@@ -1211,6 +1387,11 @@ namespace Model
          */
         virtual void SendMessageBatchAsync(const Model::SendMessageBatchRequest& request, const SendMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SendMessageBatchAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SendMessageBatchAsync(Model::SendMessageBatchRequest&& request, const SendMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Sets the value of one or more queue attributes. When you change a queue's
          * attributes, the change can take up to 60 seconds for most of the attributes to
@@ -1235,6 +1416,11 @@ namespace Model
          */
         virtual Model::SetQueueAttributesOutcomeCallable SetQueueAttributesCallable(const Model::SetQueueAttributesRequest& request) const;
 
+        /**
+         * Same as SetQueueAttributesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SetQueueAttributesOutcomeCallable SetQueueAttributesCallable(Model::SetQueueAttributesRequest&& request) const;
+
         /**
          * <p>Sets the value of one or more queue attributes. When you change a queue's
          * attributes, the change can take up to 60 seconds for most of the attributes to
@@ -1248,6 +1434,52 @@ namespace Model
          */
         virtual void SetQueueAttributesAsync(const Model::SetQueueAttributesRequest& request, const SetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SetQueueAttributesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SetQueueAttributesAsync(Model::SetQueueAttributesRequest&& request, const SetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AddPermissionOutcome> AddPermissionAwaitable(const Model::AddPermissionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::AddPermission, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddPermissionOutcome> AddPermissionAwaitable(Model::AddPermissionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::AddPermission, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ChangeMessageVisibilityOutcome> ChangeMessageVisibilityAwaitable(const Model::ChangeMessageVisibilityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::ChangeMessageVisibility, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ChangeMessageVisibilityOutcome> ChangeMessageVisibilityAwaitable(Model::ChangeMessageVisibilityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::ChangeMessageVisibility, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ChangeMessageVisibilityBatchOutcome> ChangeMessageVisibilityBatchAwaitable(const Model::ChangeMessageVisibilityBatchRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::ChangeMessageVisibilityBatch, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ChangeMessageVisibilityBatchOutcome> ChangeMessageVisibilityBatchAwaitable(Model::ChangeMessageVisibilityBatchRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::ChangeMessageVisibilityBatch, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateQueueOutcome> CreateQueueAwaitable(const Model::CreateQueueRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::CreateQueue, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateQueueOutcome> CreateQueueAwaitable(Model::CreateQueueRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::CreateQueue, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteMessageOutcome> DeleteMessageAwaitable(const Model::DeleteMessageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::DeleteMessage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteMessageOutcome> DeleteMessageAwaitable(Model::DeleteMessageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::DeleteMessage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteMessageBatchOutcome> DeleteMessageBatchAwaitable(const Model::DeleteMessageBatchRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::DeleteMessageBatch, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteMessageBatchOutcome> DeleteMessageBatchAwaitable(Model::DeleteMessageBatchRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::DeleteMessageBatch, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteQueueOutcome> DeleteQueueAwaitable(const Model::DeleteQueueRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::DeleteQueue, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteQueueOutcome> DeleteQueueAwaitable(Model::DeleteQueueRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::DeleteQueue, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetQueueAttributesOutcome> GetQueueAttributesAwaitable(const Model::GetQueueAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::GetQueueAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetQueueAttributesOutcome> GetQueueAttributesAwaitable(Model::GetQueueAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::GetQueueAttributes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetQueueUrlOutcome> GetQueueUrlAwaitable(const Model::GetQueueUrlRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::GetQueueUrl, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetQueueUrlOutcome> GetQueueUrlAwaitable(Model::GetQueueUrlRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::GetQueueUrl, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDeadLetterSourceQueuesOutcome> ListDeadLetterSourceQueuesAwaitable(const Model::ListDeadLetterSourceQueuesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::ListDeadLetterSourceQueues, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDeadLetterSourceQueuesOutcome> ListDeadLetterSourceQueuesAwaitable(Model::ListDeadLetterSourceQueuesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::ListDeadLetterSourceQueues, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListQueuesOutcome> ListQueuesAwaitable(const Model::ListQueuesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::ListQueues, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListQueuesOutcome> ListQueuesAwaitable(Model::ListQueuesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::ListQueues, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PurgeQueueOutcome> PurgeQueueAwaitable(const Model::PurgeQueueRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::PurgeQueue, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PurgeQueueOutcome> PurgeQueueAwaitable(Model::PurgeQueueRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::PurgeQueue, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReceiveMessageOutcome> ReceiveMessageAwaitable(const Model::ReceiveMessageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::ReceiveMessage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ReceiveMessageOutcome> ReceiveMessageAwaitable(Model::ReceiveMessageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::ReceiveMessage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemovePermissionOutcome> RemovePermissionAwaitable(const Model::RemovePermissionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::RemovePermission, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemovePermissionOutcome> RemovePermissionAwaitable(Model::RemovePermissionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::RemovePermission, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SendMessageOutcome> SendMessageAwaitable(const Model::SendMessageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::SendMessage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SendMessageOutcome> SendMessageAwaitable(Model::SendMessageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::SendMessage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SendMessageBatchOutcome> SendMessageBatchAwaitable(const Model::SendMessageBatchRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::SendMessageBatch, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SendMessageBatchOutcome> SendMessageBatchAwaitable(Model::SendMessageBatchRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::SendMessageBatch, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetQueueAttributesOutcome> SetQueueAttributesAwaitable(const Model::SetQueueAttributesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::SetQueueAttributes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SetQueueAttributesOutcome> SetQueueAttributesAwaitable(Model::SetQueueAttributesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SQSClient::SetQueueAttributes, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
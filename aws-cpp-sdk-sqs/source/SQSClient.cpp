@@ -122,12 +122,22 @@ AddPermissionOutcome SQSClient::AddPermission(const AddPermissionRequest& reques
 
 AddPermissionOutcomeCallable SQSClient::AddPermissionCallable(const AddPermissionRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::AddPermission, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::AddPermission, Aws::Client::RejectedCallOutcome<AddPermissionOutcome>(), this, request);
+}
+
+AddPermissionOutcomeCallable SQSClient::AddPermissionCallable(AddPermissionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::AddPermission, Aws::Client::RejectedCallOutcome<AddPermissionOutcome>(), this, std::move(request));
 }
 
 void SQSClient::AddPermissionAsync(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::AddPermissionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::AddPermissionAsyncHelper, Aws::Client::RejectedAsyncCall<AddPermissionOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::AddPermissionAsync(AddPermissionRequest&& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::AddPermissionAsyncHelper, Aws::Client::RejectedAsyncCall<AddPermissionOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::AddPermissionAsyncHelper(const AddPermissionRequest& request, const AddPermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -150,12 +160,22 @@ ChangeMessageVisibilityOutcome SQSClient::ChangeMessageVisibility(const ChangeMe
 
 ChangeMessageVisibilityOutcomeCallable SQSClient::ChangeMessageVisibilityCallable(const ChangeMessageVisibilityRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::ChangeMessageVisibility, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::ChangeMessageVisibility, Aws::Client::RejectedCallOutcome<ChangeMessageVisibilityOutcome>(), this, request);
+}
+
+ChangeMessageVisibilityOutcomeCallable SQSClient::ChangeMessageVisibilityCallable(ChangeMessageVisibilityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::ChangeMessageVisibility, Aws::Client::RejectedCallOutcome<ChangeMessageVisibilityOutcome>(), this, std::move(request));
 }
 
 void SQSClient::ChangeMessageVisibilityAsync(const ChangeMessageVisibilityRequest& request, const ChangeMessageVisibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::ChangeMessageVisibilityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::ChangeMessageVisibilityAsyncHelper, Aws::Client::RejectedAsyncCall<ChangeMessageVisibilityOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::ChangeMessageVisibilityAsync(ChangeMessageVisibilityRequest&& request, const ChangeMessageVisibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::ChangeMessageVisibilityAsyncHelper, Aws::Client::RejectedAsyncCall<ChangeMessageVisibilityOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::ChangeMessageVisibilityAsyncHelper(const ChangeMessageVisibilityRequest& request, const ChangeMessageVisibilityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -178,12 +198,22 @@ ChangeMessageVisibilityBatchOutcome SQSClient::ChangeMessageVisibilityBatch(cons
 
 ChangeMessageVisibilityBatchOutcomeCallable SQSClient::ChangeMessageVisibilityBatchCallable(const ChangeMessageVisibilityBatchRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::ChangeMessageVisibilityBatch, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::ChangeMessageVisibilityBatch, Aws::Client::RejectedCallOutcome<ChangeMessageVisibilityBatchOutcome>(), this, request);
+}
+
+ChangeMessageVisibilityBatchOutcomeCallable SQSClient::ChangeMessageVisibilityBatchCallable(ChangeMessageVisibilityBatchRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::ChangeMessageVisibilityBatch, Aws::Client::RejectedCallOutcome<ChangeMessageVisibilityBatchOutcome>(), this, std::move(request));
 }
 
 void SQSClient::ChangeMessageVisibilityBatchAsync(const ChangeMessageVisibilityBatchRequest& request, const ChangeMessageVisibilityBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::ChangeMessageVisibilityBatchAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::ChangeMessageVisibilityBatchAsyncHelper, Aws::Client::RejectedAsyncCall<ChangeMessageVisibilityBatchOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::ChangeMessageVisibilityBatchAsync(ChangeMessageVisibilityBatchRequest&& request, const ChangeMessageVisibilityBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::ChangeMessageVisibilityBatchAsyncHelper, Aws::Client::RejectedAsyncCall<ChangeMessageVisibilityBatchOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::ChangeMessageVisibilityBatchAsyncHelper(const ChangeMessageVisibilityBatchRequest& request, const ChangeMessageVisibilityBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -210,12 +240,22 @@ CreateQueueOutcome SQSClient::CreateQueue(const CreateQueueRequest& request) con
 
 CreateQueueOutcomeCallable SQSClient::CreateQueueCallable(const CreateQueueRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::CreateQueue, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::CreateQueue, Aws::Client::RejectedCallOutcome<CreateQueueOutcome>(), this, request);
+}
+
+CreateQueueOutcomeCallable SQSClient::CreateQueueCallable(CreateQueueRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::CreateQueue, Aws::Client::RejectedCallOutcome<CreateQueueOutcome>(), this, std::move(request));
 }
 
 void SQSClient::CreateQueueAsync(const CreateQueueRequest& request, const CreateQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::CreateQueueAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::CreateQueueAsyncHelper, Aws::Client::RejectedAsyncCall<CreateQueueOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::CreateQueueAsync(CreateQueueRequest&& request, const CreateQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::CreateQueueAsyncHelper, Aws::Client::RejectedAsyncCall<CreateQueueOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::CreateQueueAsyncHelper(const CreateQueueRequest& request, const CreateQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -238,12 +278,22 @@ DeleteMessageOutcome SQSClient::DeleteMessage(const DeleteMessageRequest& reques
 
 DeleteMessageOutcomeCallable SQSClient::DeleteMessageCallable(const DeleteMessageRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::DeleteMessage, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::DeleteMessage, Aws::Client::RejectedCallOutcome<DeleteMessageOutcome>(), this, request);
+}
+
+DeleteMessageOutcomeCallable SQSClient::DeleteMessageCallable(DeleteMessageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::DeleteMessage, Aws::Client::RejectedCallOutcome<DeleteMessageOutcome>(), this, std::move(request));
 }
 
 void SQSClient::DeleteMessageAsync(const DeleteMessageRequest& request, const DeleteMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::DeleteMessageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::DeleteMessageAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteMessageOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::DeleteMessageAsync(DeleteMessageRequest&& request, const DeleteMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::DeleteMessageAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteMessageOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::DeleteMessageAsyncHelper(const DeleteMessageRequest& request, const DeleteMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -266,12 +316,22 @@ DeleteMessageBatchOutcome SQSClient::DeleteMessageBatch(const DeleteMessageBatch
 
 DeleteMessageBatchOutcomeCallable SQSClient::DeleteMessageBatchCallable(const DeleteMessageBatchRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::DeleteMessageBatch, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::DeleteMessageBatch, Aws::Client::RejectedCallOutcome<DeleteMessageBatchOutcome>(), this, request);
+}
+
+DeleteMessageBatchOutcomeCallable SQSClient::DeleteMessageBatchCallable(DeleteMessageBatchRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::DeleteMessageBatch, Aws::Client::RejectedCallOutcome<DeleteMessageBatchOutcome>(), this, std::move(request));
 }
 
 void SQSClient::DeleteMessageBatchAsync(const DeleteMessageBatchRequest& request, const DeleteMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::DeleteMessageBatchAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::DeleteMessageBatchAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteMessageBatchOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::DeleteMessageBatchAsync(DeleteMessageBatchRequest&& request, const DeleteMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::DeleteMessageBatchAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteMessageBatchOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::DeleteMessageBatchAsyncHelper(const DeleteMessageBatchRequest& request, const DeleteMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -294,12 +354,22 @@ DeleteQueueOutcome SQSClient::DeleteQueue(const DeleteQueueRequest& request) con
 
 DeleteQueueOutcomeCallable SQSClient::DeleteQueueCallable(const DeleteQueueRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::DeleteQueue, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::DeleteQueue, Aws::Client::RejectedCallOutcome<DeleteQueueOutcome>(), this, request);
+}
+
+DeleteQueueOutcomeCallable SQSClient::DeleteQueueCallable(DeleteQueueRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::DeleteQueue, Aws::Client::RejectedCallOutcome<DeleteQueueOutcome>(), this, std::move(request));
 }
 
 void SQSClient::DeleteQueueAsync(const DeleteQueueRequest& request, const DeleteQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::DeleteQueueAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::DeleteQueueAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteQueueOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::DeleteQueueAsync(DeleteQueueRequest&& request, const DeleteQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::DeleteQueueAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteQueueOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::DeleteQueueAsyncHelper(const DeleteQueueRequest& request, const DeleteQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -322,12 +392,22 @@ GetQueueAttributesOutcome SQSClient::GetQueueAttributes(const GetQueueAttributes
 
 GetQueueAttributesOutcomeCallable SQSClient::GetQueueAttributesCallable(const GetQueueAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::GetQueueAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::GetQueueAttributes, Aws::Client::RejectedCallOutcome<GetQueueAttributesOutcome>(), this, request);
+}
+
+GetQueueAttributesOutcomeCallable SQSClient::GetQueueAttributesCallable(GetQueueAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::GetQueueAttributes, Aws::Client::RejectedCallOutcome<GetQueueAttributesOutcome>(), this, std::move(request));
 }
 
 void SQSClient::GetQueueAttributesAsync(const GetQueueAttributesRequest& request, const GetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::GetQueueAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::GetQueueAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetQueueAttributesOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::GetQueueAttributesAsync(GetQueueAttributesRequest&& request, const GetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::GetQueueAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<GetQueueAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::GetQueueAttributesAsyncHelper(const GetQueueAttributesRequest& request, const GetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -354,12 +434,22 @@ GetQueueUrlOutcome SQSClient::GetQueueUrl(const GetQueueUrlRequest& request) con
 
 GetQueueUrlOutcomeCallable SQSClient::GetQueueUrlCallable(const GetQueueUrlRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::GetQueueUrl, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::GetQueueUrl, Aws::Client::RejectedCallOutcome<GetQueueUrlOutcome>(), this, request);
+}
+
+GetQueueUrlOutcomeCallable SQSClient::GetQueueUrlCallable(GetQueueUrlRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::GetQueueUrl, Aws::Client::RejectedCallOutcome<GetQueueUrlOutcome>(), this, std::move(request));
 }
 
 void SQSClient::GetQueueUrlAsync(const GetQueueUrlRequest& request, const GetQueueUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::GetQueueUrlAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::GetQueueUrlAsyncHelper, Aws::Client::RejectedAsyncCall<GetQueueUrlOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::GetQueueUrlAsync(GetQueueUrlRequest&& request, const GetQueueUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::GetQueueUrlAsyncHelper, Aws::Client::RejectedAsyncCall<GetQueueUrlOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::GetQueueUrlAsyncHelper(const GetQueueUrlRequest& request, const GetQueueUrlResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -382,12 +472,22 @@ ListDeadLetterSourceQueuesOutcome SQSClient::ListDeadLetterSourceQueues(const Li
 
 ListDeadLetterSourceQueuesOutcomeCallable SQSClient::ListDeadLetterSourceQueuesCallable(const ListDeadLetterSourceQueuesRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::ListDeadLetterSourceQueues, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::ListDeadLetterSourceQueues, Aws::Client::RejectedCallOutcome<ListDeadLetterSourceQueuesOutcome>(), this, request);
+}
+
+ListDeadLetterSourceQueuesOutcomeCallable SQSClient::ListDeadLetterSourceQueuesCallable(ListDeadLetterSourceQueuesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::ListDeadLetterSourceQueues, Aws::Client::RejectedCallOutcome<ListDeadLetterSourceQueuesOutcome>(), this, std::move(request));
 }
 
 void SQSClient::ListDeadLetterSourceQueuesAsync(const ListDeadLetterSourceQueuesRequest& request, const ListDeadLetterSourceQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::ListDeadLetterSourceQueuesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::ListDeadLetterSourceQueuesAsyncHelper, Aws::Client::RejectedAsyncCall<ListDeadLetterSourceQueuesOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::ListDeadLetterSourceQueuesAsync(ListDeadLetterSourceQueuesRequest&& request, const ListDeadLetterSourceQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::ListDeadLetterSourceQueuesAsyncHelper, Aws::Client::RejectedAsyncCall<ListDeadLetterSourceQueuesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::ListDeadLetterSourceQueuesAsyncHelper(const ListDeadLetterSourceQueuesRequest& request, const ListDeadLetterSourceQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -414,12 +514,22 @@ ListQueuesOutcome SQSClient::ListQueues(const ListQueuesRequest& request) const
 
 ListQueuesOutcomeCallable SQSClient::ListQueuesCallable(const ListQueuesRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::ListQueues, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::ListQueues, Aws::Client::RejectedCallOutcome<ListQueuesOutcome>(), this, request);
+}
+
+ListQueuesOutcomeCallable SQSClient::ListQueuesCallable(ListQueuesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::ListQueues, Aws::Client::RejectedCallOutcome<ListQueuesOutcome>(), this, std::move(request));
 }
 
 void SQSClient::ListQueuesAsync(const ListQueuesRequest& request, const ListQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::ListQueuesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::ListQueuesAsyncHelper, Aws::Client::RejectedAsyncCall<ListQueuesOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::ListQueuesAsync(ListQueuesRequest&& request, const ListQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::ListQueuesAsyncHelper, Aws::Client::RejectedAsyncCall<ListQueuesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::ListQueuesAsyncHelper(const ListQueuesRequest& request, const ListQueuesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -442,12 +552,22 @@ PurgeQueueOutcome SQSClient::PurgeQueue(const PurgeQueueRequest& request) const
 
 PurgeQueueOutcomeCallable SQSClient::PurgeQueueCallable(const PurgeQueueRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::PurgeQueue, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::PurgeQueue, Aws::Client::RejectedCallOutcome<PurgeQueueOutcome>(), this, request);
+}
+
+PurgeQueueOutcomeCallable SQSClient::PurgeQueueCallable(PurgeQueueRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::PurgeQueue, Aws::Client::RejectedCallOutcome<PurgeQueueOutcome>(), this, std::move(request));
 }
 
 void SQSClient::PurgeQueueAsync(const PurgeQueueRequest& request, const PurgeQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::PurgeQueueAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::PurgeQueueAsyncHelper, Aws::Client::RejectedAsyncCall<PurgeQueueOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::PurgeQueueAsync(PurgeQueueRequest&& request, const PurgeQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::PurgeQueueAsyncHelper, Aws::Client::RejectedAsyncCall<PurgeQueueOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::PurgeQueueAsyncHelper(const PurgeQueueRequest& request, const PurgeQueueResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -470,12 +590,22 @@ ReceiveMessageOutcome SQSClient::ReceiveMessage(const ReceiveMessageRequest& req
 
 ReceiveMessageOutcomeCallable SQSClient::ReceiveMessageCallable(const ReceiveMessageRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::ReceiveMessage, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::ReceiveMessage, Aws::Client::RejectedCallOutcome<ReceiveMessageOutcome>(), this, request);
+}
+
+ReceiveMessageOutcomeCallable SQSClient::ReceiveMessageCallable(ReceiveMessageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::ReceiveMessage, Aws::Client::RejectedCallOutcome<ReceiveMessageOutcome>(), this, std::move(request));
 }
 
 void SQSClient::ReceiveMessageAsync(const ReceiveMessageRequest& request, const ReceiveMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::ReceiveMessageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::ReceiveMessageAsyncHelper, Aws::Client::RejectedAsyncCall<ReceiveMessageOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::ReceiveMessageAsync(ReceiveMessageRequest&& request, const ReceiveMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::ReceiveMessageAsyncHelper, Aws::Client::RejectedAsyncCall<ReceiveMessageOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::ReceiveMessageAsyncHelper(const ReceiveMessageRequest& request, const ReceiveMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -498,12 +628,22 @@ RemovePermissionOutcome SQSClient::RemovePermission(const RemovePermissionReques
 
 RemovePermissionOutcomeCallable SQSClient::RemovePermissionCallable(const RemovePermissionRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::RemovePermission, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::RemovePermission, Aws::Client::RejectedCallOutcome<RemovePermissionOutcome>(), this, request);
+}
+
+RemovePermissionOutcomeCallable SQSClient::RemovePermissionCallable(RemovePermissionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::RemovePermission, Aws::Client::RejectedCallOutcome<RemovePermissionOutcome>(), this, std::move(request));
 }
 
 void SQSClient::RemovePermissionAsync(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::RemovePermissionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::RemovePermissionAsyncHelper, Aws::Client::RejectedAsyncCall<RemovePermissionOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::RemovePermissionAsync(RemovePermissionRequest&& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::RemovePermissionAsyncHelper, Aws::Client::RejectedAsyncCall<RemovePermissionOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::RemovePermissionAsyncHelper(const RemovePermissionRequest& request, const RemovePermissionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -526,12 +666,22 @@ SendMessageOutcome SQSClient::SendMessage(const SendMessageRequest& request) con
 
 SendMessageOutcomeCallable SQSClient::SendMessageCallable(const SendMessageRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::SendMessage, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::SendMessage, Aws::Client::RejectedCallOutcome<SendMessageOutcome>(), this, request);
+}
+
+SendMessageOutcomeCallable SQSClient::SendMessageCallable(SendMessageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::SendMessage, Aws::Client::RejectedCallOutcome<SendMessageOutcome>(), this, std::move(request));
 }
 
 void SQSClient::SendMessageAsync(const SendMessageRequest& request, const SendMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::SendMessageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::SendMessageAsyncHelper, Aws::Client::RejectedAsyncCall<SendMessageOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::SendMessageAsync(SendMessageRequest&& request, const SendMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::SendMessageAsyncHelper, Aws::Client::RejectedAsyncCall<SendMessageOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::SendMessageAsyncHelper(const SendMessageRequest& request, const SendMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -554,12 +704,22 @@ SendMessageBatchOutcome SQSClient::SendMessageBatch(const SendMessageBatchReques
 
 SendMessageBatchOutcomeCallable SQSClient::SendMessageBatchCallable(const SendMessageBatchRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::SendMessageBatch, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::SendMessageBatch, Aws::Client::RejectedCallOutcome<SendMessageBatchOutcome>(), this, request);
+}
+
+SendMessageBatchOutcomeCallable SQSClient::SendMessageBatchCallable(SendMessageBatchRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::SendMessageBatch, Aws::Client::RejectedCallOutcome<SendMessageBatchOutcome>(), this, std::move(request));
 }
 
 void SQSClient::SendMessageBatchAsync(const SendMessageBatchRequest& request, const SendMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::SendMessageBatchAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::SendMessageBatchAsyncHelper, Aws::Client::RejectedAsyncCall<SendMessageBatchOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::SendMessageBatchAsync(SendMessageBatchRequest&& request, const SendMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::SendMessageBatchAsyncHelper, Aws::Client::RejectedAsyncCall<SendMessageBatchOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::SendMessageBatchAsyncHelper(const SendMessageBatchRequest& request, const SendMessageBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -582,12 +742,22 @@ SetQueueAttributesOutcome SQSClient::SetQueueAttributes(const SetQueueAttributes
 
 SetQueueAttributesOutcomeCallable SQSClient::SetQueueAttributesCallable(const SetQueueAttributesRequest& request) const
 {
-  return std::async(std::launch::async, &SQSClient::SetQueueAttributes, this, request);
+  return m_executor->SubmitWithFuture(&SQSClient::SetQueueAttributes, Aws::Client::RejectedCallOutcome<SetQueueAttributesOutcome>(), this, request);
+}
+
+SetQueueAttributesOutcomeCallable SQSClient::SetQueueAttributesCallable(SetQueueAttributesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SQSClient::SetQueueAttributes, Aws::Client::RejectedCallOutcome<SetQueueAttributesOutcome>(), this, std::move(request));
 }
 
 void SQSClient::SetQueueAttributesAsync(const SetQueueAttributesRequest& request, const SetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SQSClient::SetQueueAttributesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SQSClient::SetQueueAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<SetQueueAttributesOutcome>(), this, request, handler, context);
+}
+
+void SQSClient::SetQueueAttributesAsync(SetQueueAttributesRequest&& request, const SetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SQSClient::SetQueueAttributesAsyncHelper, Aws::Client::RejectedAsyncCall<SetQueueAttributesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SQSClient::SetQueueAttributesAsyncHelper(const SetQueueAttributesRequest& request, const SetQueueAttributesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -38,6 +38,26 @@
 #include <aws/ssm/model/UpdateAssociationStatusResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/ssm/model/CancelCommandRequest.h>
+#include <aws/ssm/model/CreateAssociationRequest.h>
+#include <aws/ssm/model/CreateAssociationBatchRequest.h>
+#include <aws/ssm/model/CreateDocumentRequest.h>
+#include <aws/ssm/model/DeleteAssociationRequest.h>
+#include <aws/ssm/model/DeleteDocumentRequest.h>
+#include <aws/ssm/model/DescribeAssociationRequest.h>
+#include <aws/ssm/model/DescribeDocumentRequest.h>
+#include <aws/ssm/model/DescribeInstanceInformationRequest.h>
+#include <aws/ssm/model/GetDocumentRequest.h>
+#include <aws/ssm/model/ListAssociationsRequest.h>
+#include <aws/ssm/model/ListCommandInvocationsRequest.h>
+#include <aws/ssm/model/ListCommandsRequest.h>
+#include <aws/ssm/model/ListDocumentsRequest.h>
+#include <aws/ssm/model/SendCommandRequest.h>
+#include <aws/ssm/model/UpdateAssociationStatusRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -274,6 +294,11 @@ namespace Model
          */
         virtual Model::CancelCommandOutcomeCallable CancelCommandCallable(const Model::CancelCommandRequest& request) const;
 
+        /**
+         * Same as CancelCommandCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelCommandOutcomeCallable CancelCommandCallable(Model::CancelCommandRequest&& request) const;
+
         /**
          * <p>Attempts to cancel the command specified by the Command ID. There is no
          * guarantee that the command will be terminated and the underlying process
@@ -283,6 +308,11 @@ namespace Model
          */
         virtual void CancelCommandAsync(const Model::CancelCommandRequest& request, const CancelCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelCommandAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelCommandAsync(Model::CancelCommandRequest&& request, const CancelCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates the specified SSM document with the specified instance.</p>
          * <p>When you associate an SSM document with an instance, the configuration agent
@@ -305,6 +335,11 @@ namespace Model
          */
         virtual Model::CreateAssociationOutcomeCallable CreateAssociationCallable(const Model::CreateAssociationRequest& request) const;
 
+        /**
+         * Same as CreateAssociationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateAssociationOutcomeCallable CreateAssociationCallable(Model::CreateAssociationRequest&& request) const;
+
         /**
          * <p>Associates the specified SSM document with the specified instance.</p>
          * <p>When you associate an SSM document with an instance, the configuration agent
@@ -317,6 +352,11 @@ namespace Model
          */
         virtual void CreateAssociationAsync(const Model::CreateAssociationRequest& request, const CreateAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAssociationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateAssociationAsync(Model::CreateAssociationRequest&& request, const CreateAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Associates the specified SSM document with the specified instances.</p>
          * <p>When you associate an SSM document with an instance, the configuration agent
@@ -339,6 +379,11 @@ namespace Model
          */
         virtual Model::CreateAssociationBatchOutcomeCallable CreateAssociationBatchCallable(const Model::CreateAssociationBatchRequest& request) const;
 
+        /**
+         * Same as CreateAssociationBatchCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateAssociationBatchOutcomeCallable CreateAssociationBatchCallable(Model::CreateAssociationBatchRequest&& request) const;
+
         /**
          * <p>Associates the specified SSM document with the specified instances.</p>
          * <p>When you associate an SSM document with an instance, the configuration agent
@@ -351,6 +396,11 @@ namespace Model
          */
         virtual void CreateAssociationBatchAsync(const Model::CreateAssociationBatchRequest& request, const CreateAssociationBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateAssociationBatchAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateAssociationBatchAsync(Model::CreateAssociationBatchRequest&& request, const CreateAssociationBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an SSM document.</p> <p>After you create an SSM document, you can use
          * <a>CreateAssociation</a> to associate it with one or more running instances.</p>
@@ -365,6 +415,11 @@ namespace Model
          */
         virtual Model::CreateDocumentOutcomeCallable CreateDocumentCallable(const Model::CreateDocumentRequest& request) const;
 
+        /**
+         * Same as CreateDocumentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateDocumentOutcomeCallable CreateDocumentCallable(Model::CreateDocumentRequest&& request) const;
+
         /**
          * <p>Creates an SSM document.</p> <p>After you create an SSM document, you can use
          * <a>CreateAssociation</a> to associate it with one or more running instances.</p>
@@ -373,6 +428,11 @@ namespace Model
          */
         virtual void CreateDocumentAsync(const Model::CreateDocumentRequest& request, const CreateDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateDocumentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateDocumentAsync(Model::CreateDocumentRequest&& request, const CreateDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disassociates the specified SSM document from the specified instance.</p>
          * <p>When you disassociate an SSM document from an instance, it does not change
@@ -393,6 +453,11 @@ namespace Model
          */
         virtual Model::DeleteAssociationOutcomeCallable DeleteAssociationCallable(const Model::DeleteAssociationRequest& request) const;
 
+        /**
+         * Same as DeleteAssociationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteAssociationOutcomeCallable DeleteAssociationCallable(Model::DeleteAssociationRequest&& request) const;
+
         /**
          * <p>Disassociates the specified SSM document from the specified instance.</p>
          * <p>When you disassociate an SSM document from an instance, it does not change
@@ -404,6 +469,11 @@ namespace Model
          */
         virtual void DeleteAssociationAsync(const Model::DeleteAssociationRequest& request, const DeleteAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteAssociationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteAssociationAsync(Model::DeleteAssociationRequest&& request, const DeleteAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the SSM document and all instance associations to the document.</p>
          * <p>Before you delete the SSM document, we recommend that you use
@@ -422,6 +492,11 @@ namespace Model
          */
         virtual Model::DeleteDocumentOutcomeCallable DeleteDocumentCallable(const Model::DeleteDocumentRequest& request) const;
 
+        /**
+         * Same as DeleteDocumentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteDocumentOutcomeCallable DeleteDocumentCallable(Model::DeleteDocumentRequest&& request) const;
+
         /**
          * <p>Deletes the SSM document and all instance associations to the document.</p>
          * <p>Before you delete the SSM document, we recommend that you use
@@ -432,6 +507,11 @@ namespace Model
          */
         virtual void DeleteDocumentAsync(const Model::DeleteDocumentRequest& request, const DeleteDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteDocumentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteDocumentAsync(Model::DeleteDocumentRequest&& request, const DeleteDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the associations for the specified SSM document or instance.</p>
          */
@@ -444,6 +524,11 @@ namespace Model
          */
         virtual Model::DescribeAssociationOutcomeCallable DescribeAssociationCallable(const Model::DescribeAssociationRequest& request) const;
 
+        /**
+         * Same as DescribeAssociationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAssociationOutcomeCallable DescribeAssociationCallable(Model::DescribeAssociationRequest&& request) const;
+
         /**
          * <p>Describes the associations for the specified SSM document or instance.</p>
          *
@@ -451,6 +536,11 @@ namespace Model
          */
         virtual void DescribeAssociationAsync(const Model::DescribeAssociationRequest& request, const DescribeAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAssociationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAssociationAsync(Model::DescribeAssociationRequest&& request, const DescribeAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes the specified SSM document.</p>
          */
@@ -463,6 +553,11 @@ namespace Model
          */
         virtual Model::DescribeDocumentOutcomeCallable DescribeDocumentCallable(const Model::DescribeDocumentRequest& request) const;
 
+        /**
+         * Same as DescribeDocumentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDocumentOutcomeCallable DescribeDocumentCallable(Model::DescribeDocumentRequest&& request) const;
+
         /**
          * <p>Describes the specified SSM document.</p>
          *
@@ -470,6 +565,11 @@ namespace Model
          */
         virtual void DescribeDocumentAsync(const Model::DescribeDocumentRequest& request, const DescribeDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDocumentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDocumentAsync(Model::DescribeDocumentRequest&& request, const DescribeDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Describes one or more of your instances. You can use this to get information
          * about instances like the operating system platform, the SSM agent version,
@@ -492,6 +592,11 @@ namespace Model
          */
         virtual Model::DescribeInstanceInformationOutcomeCallable DescribeInstanceInformationCallable(const Model::DescribeInstanceInformationRequest& request) const;
 
+        /**
+         * Same as DescribeInstanceInformationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeInstanceInformationOutcomeCallable DescribeInstanceInformationCallable(Model::DescribeInstanceInformationRequest&& request) const;
+
         /**
          * Describes one or more of your instances. You can use this to get information
          * about instances like the operating system platform, the SSM agent version,
@@ -504,6 +609,11 @@ namespace Model
          */
         virtual void DescribeInstanceInformationAsync(const Model::DescribeInstanceInformationRequest& request, const DescribeInstanceInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeInstanceInformationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeInstanceInformationAsync(Model::DescribeInstanceInformationRequest&& request, const DescribeInstanceInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets the contents of the specified SSM document.</p>
          */
@@ -516,6 +626,11 @@ namespace Model
          */
         virtual Model::GetDocumentOutcomeCallable GetDocumentCallable(const Model::GetDocumentRequest& request) const;
 
+        /**
+         * Same as GetDocumentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetDocumentOutcomeCallable GetDocumentCallable(Model::GetDocumentRequest&& request) const;
+
         /**
          * <p>Gets the contents of the specified SSM document.</p>
          *
@@ -523,6 +638,11 @@ namespace Model
          */
         virtual void GetDocumentAsync(const Model::GetDocumentRequest& request, const GetDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetDocumentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetDocumentAsync(Model::GetDocumentRequest&& request, const GetDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the associations for the specified SSM document or instance.</p>
          */
@@ -535,6 +655,11 @@ namespace Model
          */
         virtual Model::ListAssociationsOutcomeCallable ListAssociationsCallable(const Model::ListAssociationsRequest& request) const;
 
+        /**
+         * Same as ListAssociationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListAssociationsOutcomeCallable ListAssociationsCallable(Model::ListAssociationsRequest&& request) const;
+
         /**
          * <p>Lists the associations for the specified SSM document or instance.</p>
          *
@@ -542,6 +667,11 @@ namespace Model
          */
         virtual void ListAssociationsAsync(const Model::ListAssociationsRequest& request, const ListAssociationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListAssociationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListAssociationsAsync(Model::ListAssociationsRequest&& request, const ListAssociationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * An invocation is copy of a command sent to a specific instance. A command can
          * apply to one or more instances. A command invocation applies to one instance.
@@ -562,6 +692,11 @@ namespace Model
          */
         virtual Model::ListCommandInvocationsOutcomeCallable ListCommandInvocationsCallable(const Model::ListCommandInvocationsRequest& request) const;
 
+        /**
+         * Same as ListCommandInvocationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListCommandInvocationsOutcomeCallable ListCommandInvocationsCallable(Model::ListCommandInvocationsRequest&& request) const;
+
         /**
          * An invocation is copy of a command sent to a specific instance. A command can
          * apply to one or more instances. A command invocation applies to one instance.
@@ -573,6 +708,11 @@ namespace Model
          */
         virtual void ListCommandInvocationsAsync(const Model::ListCommandInvocationsRequest& request, const ListCommandInvocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListCommandInvocationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListCommandInvocationsAsync(Model::ListCommandInvocationsRequest&& request, const ListCommandInvocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Lists the commands requested by users of the AWS account.</p>
          */
@@ -585,6 +725,11 @@ namespace Model
          */
         virtual Model::ListCommandsOutcomeCallable ListCommandsCallable(const Model::ListCommandsRequest& request) const;
 
+        /**
+         * Same as ListCommandsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListCommandsOutcomeCallable ListCommandsCallable(Model::ListCommandsRequest&& request) const;
+
         /**
          * <p>Lists the commands requested by users of the AWS account.</p>
          *
@@ -592,6 +737,11 @@ namespace Model
          */
         virtual void ListCommandsAsync(const Model::ListCommandsRequest& request, const ListCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListCommandsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListCommandsAsync(Model::ListCommandsRequest&& request, const ListCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Describes one or more of your SSM documents.</p>
          */
@@ -604,6 +754,11 @@ namespace Model
          */
         virtual Model::ListDocumentsOutcomeCallable ListDocumentsCallable(const Model::ListDocumentsRequest& request) const;
 
+        /**
+         * Same as ListDocumentsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDocumentsOutcomeCallable ListDocumentsCallable(Model::ListDocumentsRequest&& request) const;
+
         /**
          * <p>Describes one or more of your SSM documents.</p>
          *
@@ -611,6 +766,11 @@ namespace Model
          */
         virtual void ListDocumentsAsync(const Model::ListDocumentsRequest& request, const ListDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDocumentsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDocumentsAsync(Model::ListDocumentsRequest&& request, const ListDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * Executes commands on one or more remote instances.
          */
@@ -623,6 +783,11 @@ namespace Model
          */
         virtual Model::SendCommandOutcomeCallable SendCommandCallable(const Model::SendCommandRequest& request) const;
 
+        /**
+         * Same as SendCommandCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SendCommandOutcomeCallable SendCommandCallable(Model::SendCommandRequest&& request) const;
+
         /**
          * Executes commands on one or more remote instances.
          *
@@ -630,6 +795,11 @@ namespace Model
          */
         virtual void SendCommandAsync(const Model::SendCommandRequest& request, const SendCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SendCommandAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SendCommandAsync(Model::SendCommandRequest&& request, const SendCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Updates the status of the SSM document associated with the specified
          * instance.</p>
@@ -644,6 +814,11 @@ namespace Model
          */
         virtual Model::UpdateAssociationStatusOutcomeCallable UpdateAssociationStatusCallable(const Model::UpdateAssociationStatusRequest& request) const;
 
+        /**
+         * Same as UpdateAssociationStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateAssociationStatusOutcomeCallable UpdateAssociationStatusCallable(Model::UpdateAssociationStatusRequest&& request) const;
+
         /**
          * <p>Updates the status of the SSM document associated with the specified
          * instance.</p>
@@ -652,6 +827,50 @@ namespace Model
          */
         virtual void UpdateAssociationStatusAsync(const Model::UpdateAssociationStatusRequest& request, const UpdateAssociationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateAssociationStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateAssociationStatusAsync(Model::UpdateAssociationStatusRequest&& request, const UpdateAssociationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelCommandOutcome> CancelCommandAwaitable(const Model::CancelCommandRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::CancelCommand, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelCommandOutcome> CancelCommandAwaitable(Model::CancelCommandRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::CancelCommand, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAssociationOutcome> CreateAssociationAwaitable(const Model::CreateAssociationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::CreateAssociation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAssociationOutcome> CreateAssociationAwaitable(Model::CreateAssociationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::CreateAssociation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAssociationBatchOutcome> CreateAssociationBatchAwaitable(const Model::CreateAssociationBatchRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::CreateAssociationBatch, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateAssociationBatchOutcome> CreateAssociationBatchAwaitable(Model::CreateAssociationBatchRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::CreateAssociationBatch, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDocumentOutcome> CreateDocumentAwaitable(const Model::CreateDocumentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::CreateDocument, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateDocumentOutcome> CreateDocumentAwaitable(Model::CreateDocumentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::CreateDocument, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAssociationOutcome> DeleteAssociationAwaitable(const Model::DeleteAssociationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::DeleteAssociation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteAssociationOutcome> DeleteAssociationAwaitable(Model::DeleteAssociationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::DeleteAssociation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDocumentOutcome> DeleteDocumentAwaitable(const Model::DeleteDocumentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::DeleteDocument, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteDocumentOutcome> DeleteDocumentAwaitable(Model::DeleteDocumentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::DeleteDocument, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAssociationOutcome> DescribeAssociationAwaitable(const Model::DescribeAssociationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::DescribeAssociation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAssociationOutcome> DescribeAssociationAwaitable(Model::DescribeAssociationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::DescribeAssociation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDocumentOutcome> DescribeDocumentAwaitable(const Model::DescribeDocumentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::DescribeDocument, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDocumentOutcome> DescribeDocumentAwaitable(Model::DescribeDocumentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::DescribeDocument, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInstanceInformationOutcome> DescribeInstanceInformationAwaitable(const Model::DescribeInstanceInformationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::DescribeInstanceInformation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeInstanceInformationOutcome> DescribeInstanceInformationAwaitable(Model::DescribeInstanceInformationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::DescribeInstanceInformation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDocumentOutcome> GetDocumentAwaitable(const Model::GetDocumentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::GetDocument, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetDocumentOutcome> GetDocumentAwaitable(Model::GetDocumentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::GetDocument, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAssociationsOutcome> ListAssociationsAwaitable(const Model::ListAssociationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::ListAssociations, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListAssociationsOutcome> ListAssociationsAwaitable(Model::ListAssociationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::ListAssociations, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListCommandInvocationsOutcome> ListCommandInvocationsAwaitable(const Model::ListCommandInvocationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::ListCommandInvocations, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListCommandInvocationsOutcome> ListCommandInvocationsAwaitable(Model::ListCommandInvocationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::ListCommandInvocations, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListCommandsOutcome> ListCommandsAwaitable(const Model::ListCommandsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::ListCommands, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListCommandsOutcome> ListCommandsAwaitable(Model::ListCommandsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::ListCommands, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDocumentsOutcome> ListDocumentsAwaitable(const Model::ListDocumentsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::ListDocuments, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDocumentsOutcome> ListDocumentsAwaitable(Model::ListDocumentsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::ListDocuments, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SendCommandOutcome> SendCommandAwaitable(const Model::SendCommandRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::SendCommand, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SendCommandOutcome> SendCommandAwaitable(Model::SendCommandRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::SendCommand, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAssociationStatusOutcome> UpdateAssociationStatusAwaitable(const Model::UpdateAssociationStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::UpdateAssociationStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateAssociationStatusOutcome> UpdateAssociationStatusAwaitable(Model::UpdateAssociationStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SSMClient::UpdateAssociationStatus, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
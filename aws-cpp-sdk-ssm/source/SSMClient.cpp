@@ -123,12 +123,22 @@ CancelCommandOutcome SSMClient::CancelCommand(const CancelCommandRequest& reques
 
 CancelCommandOutcomeCallable SSMClient::CancelCommandCallable(const CancelCommandRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::CancelCommand, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::CancelCommand, Aws::Client::RejectedCallOutcome<CancelCommandOutcome>(), this, request);
+}
+
+CancelCommandOutcomeCallable SSMClient::CancelCommandCallable(CancelCommandRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::CancelCommand, Aws::Client::RejectedCallOutcome<CancelCommandOutcome>(), this, std::move(request));
 }
 
 void SSMClient::CancelCommandAsync(const CancelCommandRequest& request, const CancelCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::CancelCommandAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::CancelCommandAsyncHelper, Aws::Client::RejectedAsyncCall<CancelCommandOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::CancelCommandAsync(CancelCommandRequest&& request, const CancelCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::CancelCommandAsyncHelper, Aws::Client::RejectedAsyncCall<CancelCommandOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::CancelCommandAsyncHelper(const CancelCommandRequest& request, const CancelCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -154,12 +164,22 @@ CreateAssociationOutcome SSMClient::CreateAssociation(const CreateAssociationReq
 
 CreateAssociationOutcomeCallable SSMClient::CreateAssociationCallable(const CreateAssociationRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::CreateAssociation, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::CreateAssociation, Aws::Client::RejectedCallOutcome<CreateAssociationOutcome>(), this, request);
+}
+
+CreateAssociationOutcomeCallable SSMClient::CreateAssociationCallable(CreateAssociationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::CreateAssociation, Aws::Client::RejectedCallOutcome<CreateAssociationOutcome>(), this, std::move(request));
 }
 
 void SSMClient::CreateAssociationAsync(const CreateAssociationRequest& request, const CreateAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::CreateAssociationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::CreateAssociationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAssociationOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::CreateAssociationAsync(CreateAssociationRequest&& request, const CreateAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::CreateAssociationAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAssociationOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::CreateAssociationAsyncHelper(const CreateAssociationRequest& request, const CreateAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -185,12 +205,22 @@ CreateAssociationBatchOutcome SSMClient::CreateAssociationBatch(const CreateAsso
 
 CreateAssociationBatchOutcomeCallable SSMClient::CreateAssociationBatchCallable(const CreateAssociationBatchRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::CreateAssociationBatch, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::CreateAssociationBatch, Aws::Client::RejectedCallOutcome<CreateAssociationBatchOutcome>(), this, request);
+}
+
+CreateAssociationBatchOutcomeCallable SSMClient::CreateAssociationBatchCallable(CreateAssociationBatchRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::CreateAssociationBatch, Aws::Client::RejectedCallOutcome<CreateAssociationBatchOutcome>(), this, std::move(request));
 }
 
 void SSMClient::CreateAssociationBatchAsync(const CreateAssociationBatchRequest& request, const CreateAssociationBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::CreateAssociationBatchAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::CreateAssociationBatchAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAssociationBatchOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::CreateAssociationBatchAsync(CreateAssociationBatchRequest&& request, const CreateAssociationBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::CreateAssociationBatchAsyncHelper, Aws::Client::RejectedAsyncCall<CreateAssociationBatchOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::CreateAssociationBatchAsyncHelper(const CreateAssociationBatchRequest& request, const CreateAssociationBatchResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -216,12 +246,22 @@ CreateDocumentOutcome SSMClient::CreateDocument(const CreateDocumentRequest& req
 
 CreateDocumentOutcomeCallable SSMClient::CreateDocumentCallable(const CreateDocumentRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::CreateDocument, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::CreateDocument, Aws::Client::RejectedCallOutcome<CreateDocumentOutcome>(), this, request);
+}
+
+CreateDocumentOutcomeCallable SSMClient::CreateDocumentCallable(CreateDocumentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::CreateDocument, Aws::Client::RejectedCallOutcome<CreateDocumentOutcome>(), this, std::move(request));
 }
 
 void SSMClient::CreateDocumentAsync(const CreateDocumentRequest& request, const CreateDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::CreateDocumentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::CreateDocumentAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDocumentOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::CreateDocumentAsync(CreateDocumentRequest&& request, const CreateDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::CreateDocumentAsyncHelper, Aws::Client::RejectedAsyncCall<CreateDocumentOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::CreateDocumentAsyncHelper(const CreateDocumentRequest& request, const CreateDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -247,12 +287,22 @@ DeleteAssociationOutcome SSMClient::DeleteAssociation(const DeleteAssociationReq
 
 DeleteAssociationOutcomeCallable SSMClient::DeleteAssociationCallable(const DeleteAssociationRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::DeleteAssociation, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::DeleteAssociation, Aws::Client::RejectedCallOutcome<DeleteAssociationOutcome>(), this, request);
+}
+
+DeleteAssociationOutcomeCallable SSMClient::DeleteAssociationCallable(DeleteAssociationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::DeleteAssociation, Aws::Client::RejectedCallOutcome<DeleteAssociationOutcome>(), this, std::move(request));
 }
 
 void SSMClient::DeleteAssociationAsync(const DeleteAssociationRequest& request, const DeleteAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::DeleteAssociationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::DeleteAssociationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAssociationOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::DeleteAssociationAsync(DeleteAssociationRequest&& request, const DeleteAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::DeleteAssociationAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteAssociationOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::DeleteAssociationAsyncHelper(const DeleteAssociationRequest& request, const DeleteAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -278,12 +328,22 @@ DeleteDocumentOutcome SSMClient::DeleteDocument(const DeleteDocumentRequest& req
 
 DeleteDocumentOutcomeCallable SSMClient::DeleteDocumentCallable(const DeleteDocumentRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::DeleteDocument, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::DeleteDocument, Aws::Client::RejectedCallOutcome<DeleteDocumentOutcome>(), this, request);
+}
+
+DeleteDocumentOutcomeCallable SSMClient::DeleteDocumentCallable(DeleteDocumentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::DeleteDocument, Aws::Client::RejectedCallOutcome<DeleteDocumentOutcome>(), this, std::move(request));
 }
 
 void SSMClient::DeleteDocumentAsync(const DeleteDocumentRequest& request, const DeleteDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::DeleteDocumentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::DeleteDocumentAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDocumentOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::DeleteDocumentAsync(DeleteDocumentRequest&& request, const DeleteDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::DeleteDocumentAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteDocumentOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::DeleteDocumentAsyncHelper(const DeleteDocumentRequest& request, const DeleteDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -309,12 +369,22 @@ DescribeAssociationOutcome SSMClient::DescribeAssociation(const DescribeAssociat
 
 DescribeAssociationOutcomeCallable SSMClient::DescribeAssociationCallable(const DescribeAssociationRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::DescribeAssociation, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::DescribeAssociation, Aws::Client::RejectedCallOutcome<DescribeAssociationOutcome>(), this, request);
+}
+
+DescribeAssociationOutcomeCallable SSMClient::DescribeAssociationCallable(DescribeAssociationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::DescribeAssociation, Aws::Client::RejectedCallOutcome<DescribeAssociationOutcome>(), this, std::move(request));
 }
 
 void SSMClient::DescribeAssociationAsync(const DescribeAssociationRequest& request, const DescribeAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::DescribeAssociationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::DescribeAssociationAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAssociationOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::DescribeAssociationAsync(DescribeAssociationRequest&& request, const DescribeAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::DescribeAssociationAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAssociationOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::DescribeAssociationAsyncHelper(const DescribeAssociationRequest& request, const DescribeAssociationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -340,12 +410,22 @@ DescribeDocumentOutcome SSMClient::DescribeDocument(const DescribeDocumentReques
 
 DescribeDocumentOutcomeCallable SSMClient::DescribeDocumentCallable(const DescribeDocumentRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::DescribeDocument, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::DescribeDocument, Aws::Client::RejectedCallOutcome<DescribeDocumentOutcome>(), this, request);
+}
+
+DescribeDocumentOutcomeCallable SSMClient::DescribeDocumentCallable(DescribeDocumentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::DescribeDocument, Aws::Client::RejectedCallOutcome<DescribeDocumentOutcome>(), this, std::move(request));
 }
 
 void SSMClient::DescribeDocumentAsync(const DescribeDocumentRequest& request, const DescribeDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::DescribeDocumentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::DescribeDocumentAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDocumentOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::DescribeDocumentAsync(DescribeDocumentRequest&& request, const DescribeDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::DescribeDocumentAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDocumentOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::DescribeDocumentAsyncHelper(const DescribeDocumentRequest& request, const DescribeDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -371,12 +451,22 @@ DescribeInstanceInformationOutcome SSMClient::DescribeInstanceInformation(const
 
 DescribeInstanceInformationOutcomeCallable SSMClient::DescribeInstanceInformationCallable(const DescribeInstanceInformationRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::DescribeInstanceInformation, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::DescribeInstanceInformation, Aws::Client::RejectedCallOutcome<DescribeInstanceInformationOutcome>(), this, request);
+}
+
+DescribeInstanceInformationOutcomeCallable SSMClient::DescribeInstanceInformationCallable(DescribeInstanceInformationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::DescribeInstanceInformation, Aws::Client::RejectedCallOutcome<DescribeInstanceInformationOutcome>(), this, std::move(request));
 }
 
 void SSMClient::DescribeInstanceInformationAsync(const DescribeInstanceInformationRequest& request, const DescribeInstanceInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::DescribeInstanceInformationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::DescribeInstanceInformationAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInstanceInformationOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::DescribeInstanceInformationAsync(DescribeInstanceInformationRequest&& request, const DescribeInstanceInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::DescribeInstanceInformationAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeInstanceInformationOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::DescribeInstanceInformationAsyncHelper(const DescribeInstanceInformationRequest& request, const DescribeInstanceInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -402,12 +492,22 @@ GetDocumentOutcome SSMClient::GetDocument(const GetDocumentRequest& request) con
 
 GetDocumentOutcomeCallable SSMClient::GetDocumentCallable(const GetDocumentRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::GetDocument, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::GetDocument, Aws::Client::RejectedCallOutcome<GetDocumentOutcome>(), this, request);
+}
+
+GetDocumentOutcomeCallable SSMClient::GetDocumentCallable(GetDocumentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::GetDocument, Aws::Client::RejectedCallOutcome<GetDocumentOutcome>(), this, std::move(request));
 }
 
 void SSMClient::GetDocumentAsync(const GetDocumentRequest& request, const GetDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::GetDocumentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::GetDocumentAsyncHelper, Aws::Client::RejectedAsyncCall<GetDocumentOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::GetDocumentAsync(GetDocumentRequest&& request, const GetDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::GetDocumentAsyncHelper, Aws::Client::RejectedAsyncCall<GetDocumentOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::GetDocumentAsyncHelper(const GetDocumentRequest& request, const GetDocumentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -433,12 +533,22 @@ ListAssociationsOutcome SSMClient::ListAssociations(const ListAssociationsReques
 
 ListAssociationsOutcomeCallable SSMClient::ListAssociationsCallable(const ListAssociationsRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::ListAssociations, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::ListAssociations, Aws::Client::RejectedCallOutcome<ListAssociationsOutcome>(), this, request);
+}
+
+ListAssociationsOutcomeCallable SSMClient::ListAssociationsCallable(ListAssociationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::ListAssociations, Aws::Client::RejectedCallOutcome<ListAssociationsOutcome>(), this, std::move(request));
 }
 
 void SSMClient::ListAssociationsAsync(const ListAssociationsRequest& request, const ListAssociationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::ListAssociationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::ListAssociationsAsyncHelper, Aws::Client::RejectedAsyncCall<ListAssociationsOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::ListAssociationsAsync(ListAssociationsRequest&& request, const ListAssociationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::ListAssociationsAsyncHelper, Aws::Client::RejectedAsyncCall<ListAssociationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::ListAssociationsAsyncHelper(const ListAssociationsRequest& request, const ListAssociationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -464,12 +574,22 @@ ListCommandInvocationsOutcome SSMClient::ListCommandInvocations(const ListComman
 
 ListCommandInvocationsOutcomeCallable SSMClient::ListCommandInvocationsCallable(const ListCommandInvocationsRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::ListCommandInvocations, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::ListCommandInvocations, Aws::Client::RejectedCallOutcome<ListCommandInvocationsOutcome>(), this, request);
+}
+
+ListCommandInvocationsOutcomeCallable SSMClient::ListCommandInvocationsCallable(ListCommandInvocationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::ListCommandInvocations, Aws::Client::RejectedCallOutcome<ListCommandInvocationsOutcome>(), this, std::move(request));
 }
 
 void SSMClient::ListCommandInvocationsAsync(const ListCommandInvocationsRequest& request, const ListCommandInvocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::ListCommandInvocationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::ListCommandInvocationsAsyncHelper, Aws::Client::RejectedAsyncCall<ListCommandInvocationsOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::ListCommandInvocationsAsync(ListCommandInvocationsRequest&& request, const ListCommandInvocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::ListCommandInvocationsAsyncHelper, Aws::Client::RejectedAsyncCall<ListCommandInvocationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::ListCommandInvocationsAsyncHelper(const ListCommandInvocationsRequest& request, const ListCommandInvocationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -495,12 +615,22 @@ ListCommandsOutcome SSMClient::ListCommands(const ListCommandsRequest& request)
 
 ListCommandsOutcomeCallable SSMClient::ListCommandsCallable(const ListCommandsRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::ListCommands, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::ListCommands, Aws::Client::RejectedCallOutcome<ListCommandsOutcome>(), this, request);
+}
+
+ListCommandsOutcomeCallable SSMClient::ListCommandsCallable(ListCommandsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::ListCommands, Aws::Client::RejectedCallOutcome<ListCommandsOutcome>(), this, std::move(request));
 }
 
 void SSMClient::ListCommandsAsync(const ListCommandsRequest& request, const ListCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::ListCommandsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::ListCommandsAsyncHelper, Aws::Client::RejectedAsyncCall<ListCommandsOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::ListCommandsAsync(ListCommandsRequest&& request, const ListCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::ListCommandsAsyncHelper, Aws::Client::RejectedAsyncCall<ListCommandsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::ListCommandsAsyncHelper(const ListCommandsRequest& request, const ListCommandsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -526,12 +656,22 @@ ListDocumentsOutcome SSMClient::ListDocuments(const ListDocumentsRequest& reques
 
 ListDocumentsOutcomeCallable SSMClient::ListDocumentsCallable(const ListDocumentsRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::ListDocuments, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::ListDocuments, Aws::Client::RejectedCallOutcome<ListDocumentsOutcome>(), this, request);
+}
+
+ListDocumentsOutcomeCallable SSMClient::ListDocumentsCallable(ListDocumentsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::ListDocuments, Aws::Client::RejectedCallOutcome<ListDocumentsOutcome>(), this, std::move(request));
 }
 
 void SSMClient::ListDocumentsAsync(const ListDocumentsRequest& request, const ListDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::ListDocumentsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::ListDocumentsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDocumentsOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::ListDocumentsAsync(ListDocumentsRequest&& request, const ListDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::ListDocumentsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDocumentsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::ListDocumentsAsyncHelper(const ListDocumentsRequest& request, const ListDocumentsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -557,12 +697,22 @@ SendCommandOutcome SSMClient::SendCommand(const SendCommandRequest& request) con
 
 SendCommandOutcomeCallable SSMClient::SendCommandCallable(const SendCommandRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::SendCommand, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::SendCommand, Aws::Client::RejectedCallOutcome<SendCommandOutcome>(), this, request);
+}
+
+SendCommandOutcomeCallable SSMClient::SendCommandCallable(SendCommandRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::SendCommand, Aws::Client::RejectedCallOutcome<SendCommandOutcome>(), this, std::move(request));
 }
 
 void SSMClient::SendCommandAsync(const SendCommandRequest& request, const SendCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::SendCommandAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::SendCommandAsyncHelper, Aws::Client::RejectedAsyncCall<SendCommandOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::SendCommandAsync(SendCommandRequest&& request, const SendCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::SendCommandAsyncHelper, Aws::Client::RejectedAsyncCall<SendCommandOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::SendCommandAsyncHelper(const SendCommandRequest& request, const SendCommandResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -588,12 +738,22 @@ UpdateAssociationStatusOutcome SSMClient::UpdateAssociationStatus(const UpdateAs
 
 UpdateAssociationStatusOutcomeCallable SSMClient::UpdateAssociationStatusCallable(const UpdateAssociationStatusRequest& request) const
 {
-  return std::async(std::launch::async, &SSMClient::UpdateAssociationStatus, this, request);
+  return m_executor->SubmitWithFuture(&SSMClient::UpdateAssociationStatus, Aws::Client::RejectedCallOutcome<UpdateAssociationStatusOutcome>(), this, request);
+}
+
+UpdateAssociationStatusOutcomeCallable SSMClient::UpdateAssociationStatusCallable(UpdateAssociationStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SSMClient::UpdateAssociationStatus, Aws::Client::RejectedCallOutcome<UpdateAssociationStatusOutcome>(), this, std::move(request));
 }
 
 void SSMClient::UpdateAssociationStatusAsync(const UpdateAssociationStatusRequest& request, const UpdateAssociationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SSMClient::UpdateAssociationStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SSMClient::UpdateAssociationStatusAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAssociationStatusOutcome>(), this, request, handler, context);
+}
+
+void SSMClient::UpdateAssociationStatusAsync(UpdateAssociationStatusRequest&& request, const UpdateAssociationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SSMClient::UpdateAssociationStatusAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateAssociationStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void SSMClient::UpdateAssociationStatusAsyncHelper(const UpdateAssociationStatusRequest& request, const UpdateAssociationStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
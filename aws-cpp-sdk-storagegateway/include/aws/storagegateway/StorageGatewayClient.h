@@ -76,6 +76,64 @@
 #include <aws/storagegateway/model/UpdateVTLDeviceTypeResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/storagegateway/model/ActivateGatewayRequest.h>
+#include <aws/storagegateway/model/AddCacheRequest.h>
+#include <aws/storagegateway/model/AddTagsToResourceRequest.h>
+#include <aws/storagegateway/model/AddUploadBufferRequest.h>
+#include <aws/storagegateway/model/AddWorkingStorageRequest.h>
+#include <aws/storagegateway/model/CancelArchivalRequest.h>
+#include <aws/storagegateway/model/CancelRetrievalRequest.h>
+#include <aws/storagegateway/model/CreateCachediSCSIVolumeRequest.h>
+#include <aws/storagegateway/model/CreateSnapshotRequest.h>
+#include <aws/storagegateway/model/CreateSnapshotFromVolumeRecoveryPointRequest.h>
+#include <aws/storagegateway/model/CreateStorediSCSIVolumeRequest.h>
+#include <aws/storagegateway/model/CreateTapeWithBarcodeRequest.h>
+#include <aws/storagegateway/model/CreateTapesRequest.h>
+#include <aws/storagegateway/model/DeleteBandwidthRateLimitRequest.h>
+#include <aws/storagegateway/model/DeleteChapCredentialsRequest.h>
+#include <aws/storagegateway/model/DeleteGatewayRequest.h>
+#include <aws/storagegateway/model/DeleteSnapshotScheduleRequest.h>
+#include <aws/storagegateway/model/DeleteTapeRequest.h>
+#include <aws/storagegateway/model/DeleteTapeArchiveRequest.h>
+#include <aws/storagegateway/model/DeleteVolumeRequest.h>
+#include <aws/storagegateway/model/DescribeBandwidthRateLimitRequest.h>
+#include <aws/storagegateway/model/DescribeCacheRequest.h>
+#include <aws/storagegateway/model/DescribeCachediSCSIVolumesRequest.h>
+#include <aws/storagegateway/model/DescribeChapCredentialsRequest.h>
+#include <aws/storagegateway/model/DescribeGatewayInformationRequest.h>
+#include <aws/storagegateway/model/DescribeMaintenanceStartTimeRequest.h>
+#include <aws/storagegateway/model/DescribeSnapshotScheduleRequest.h>
+#include <aws/storagegateway/model/DescribeStorediSCSIVolumesRequest.h>
+#include <aws/storagegateway/model/DescribeTapeArchivesRequest.h>
+#include <aws/storagegateway/model/DescribeTapeRecoveryPointsRequest.h>
+#include <aws/storagegateway/model/DescribeTapesRequest.h>
+#include <aws/storagegateway/model/DescribeUploadBufferRequest.h>
+#include <aws/storagegateway/model/DescribeVTLDevicesRequest.h>
+#include <aws/storagegateway/model/DescribeWorkingStorageRequest.h>
+#include <aws/storagegateway/model/DisableGatewayRequest.h>
+#include <aws/storagegateway/model/ListGatewaysRequest.h>
+#include <aws/storagegateway/model/ListLocalDisksRequest.h>
+#include <aws/storagegateway/model/ListTagsForResourceRequest.h>
+#include <aws/storagegateway/model/ListVolumeInitiatorsRequest.h>
+#include <aws/storagegateway/model/ListVolumeRecoveryPointsRequest.h>
+#include <aws/storagegateway/model/ListVolumesRequest.h>
+#include <aws/storagegateway/model/RemoveTagsFromResourceRequest.h>
+#include <aws/storagegateway/model/ResetCacheRequest.h>
+#include <aws/storagegateway/model/RetrieveTapeArchiveRequest.h>
+#include <aws/storagegateway/model/RetrieveTapeRecoveryPointRequest.h>
+#include <aws/storagegateway/model/ShutdownGatewayRequest.h>
+#include <aws/storagegateway/model/StartGatewayRequest.h>
+#include <aws/storagegateway/model/UpdateBandwidthRateLimitRequest.h>
+#include <aws/storagegateway/model/UpdateChapCredentialsRequest.h>
+#include <aws/storagegateway/model/UpdateGatewayInformationRequest.h>
+#include <aws/storagegateway/model/UpdateGatewaySoftwareNowRequest.h>
+#include <aws/storagegateway/model/UpdateMaintenanceStartTimeRequest.h>
+#include <aws/storagegateway/model/UpdateSnapshotScheduleRequest.h>
+#include <aws/storagegateway/model/UpdateVTLDeviceTypeRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -430,6 +488,11 @@ namespace Model
          */
         virtual Model::ActivateGatewayOutcomeCallable ActivateGatewayCallable(const Model::ActivateGatewayRequest& request) const;
 
+        /**
+         * Same as ActivateGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ActivateGatewayOutcomeCallable ActivateGatewayCallable(Model::ActivateGatewayRequest&& request) const;
+
         /**
          * <p>This operation activates the gateway you previously deployed on your host.
          * For more information, see <a
@@ -446,6 +509,11 @@ namespace Model
          */
         virtual void ActivateGatewayAsync(const Model::ActivateGatewayRequest& request, const ActivateGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ActivateGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ActivateGatewayAsync(Model::ActivateGatewayRequest&& request, const ActivateGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation configures one or more gateway local disks as cache for a
          * cached-volume gateway. This operation is supported only for the gateway-cached
@@ -470,6 +538,11 @@ namespace Model
          */
         virtual Model::AddCacheOutcomeCallable AddCacheCallable(const Model::AddCacheRequest& request) const;
 
+        /**
+         * Same as AddCacheCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddCacheOutcomeCallable AddCacheCallable(Model::AddCacheRequest&& request) const;
+
         /**
          * <p>This operation configures one or more gateway local disks as cache for a
          * cached-volume gateway. This operation is supported only for the gateway-cached
@@ -483,6 +556,11 @@ namespace Model
          */
         virtual void AddCacheAsync(const Model::AddCacheRequest& request, const AddCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddCacheAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddCacheAsync(Model::AddCacheRequest&& request, const AddCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation adds one or more tags to the specified resource. You use tags
          * to add metadata to resources, which you can use to categorize these resources.
@@ -511,6 +589,11 @@ namespace Model
          */
         virtual Model::AddTagsToResourceOutcomeCallable AddTagsToResourceCallable(const Model::AddTagsToResourceRequest& request) const;
 
+        /**
+         * Same as AddTagsToResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddTagsToResourceOutcomeCallable AddTagsToResourceCallable(Model::AddTagsToResourceRequest&& request) const;
+
         /**
          * <p>This operation adds one or more tags to the specified resource. You use tags
          * to add metadata to resources, which you can use to categorize these resources.
@@ -526,6 +609,11 @@ namespace Model
          */
         virtual void AddTagsToResourceAsync(const Model::AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddTagsToResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddTagsToResourceAsync(Model::AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation configures one or more gateway local disks as upload buffer
          * for a specified gateway. This operation is supported for both the gateway-stored
@@ -546,6 +634,11 @@ namespace Model
          */
         virtual Model::AddUploadBufferOutcomeCallable AddUploadBufferCallable(const Model::AddUploadBufferRequest& request) const;
 
+        /**
+         * Same as AddUploadBufferCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddUploadBufferOutcomeCallable AddUploadBufferCallable(Model::AddUploadBufferRequest&& request) const;
+
         /**
          * <p>This operation configures one or more gateway local disks as upload buffer
          * for a specified gateway. This operation is supported for both the gateway-stored
@@ -557,6 +650,11 @@ namespace Model
          */
         virtual void AddUploadBufferAsync(const Model::AddUploadBufferRequest& request, const AddUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddUploadBufferAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddUploadBufferAsync(Model::AddUploadBufferRequest&& request, const AddUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation configures one or more gateway local disks as working storage
          * for a gateway. This operation is supported only for the gateway-stored volume
@@ -585,6 +683,11 @@ namespace Model
          */
         virtual Model::AddWorkingStorageOutcomeCallable AddWorkingStorageCallable(const Model::AddWorkingStorageRequest& request) const;
 
+        /**
+         * Same as AddWorkingStorageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddWorkingStorageOutcomeCallable AddWorkingStorageCallable(Model::AddWorkingStorageRequest&& request) const;
+
         /**
          * <p>This operation configures one or more gateway local disks as working storage
          * for a gateway. This operation is supported only for the gateway-stored volume
@@ -600,6 +703,11 @@ namespace Model
          */
         virtual void AddWorkingStorageAsync(const Model::AddWorkingStorageRequest& request, const AddWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddWorkingStorageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddWorkingStorageAsync(Model::AddWorkingStorageRequest&& request, const AddWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels archiving of a virtual tape to the virtual tape shelf (VTS) after the
          * archiving process is initiated. </p>
@@ -614,6 +722,11 @@ namespace Model
          */
         virtual Model::CancelArchivalOutcomeCallable CancelArchivalCallable(const Model::CancelArchivalRequest& request) const;
 
+        /**
+         * Same as CancelArchivalCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelArchivalOutcomeCallable CancelArchivalCallable(Model::CancelArchivalRequest&& request) const;
+
         /**
          * <p>Cancels archiving of a virtual tape to the virtual tape shelf (VTS) after the
          * archiving process is initiated. </p>
@@ -622,6 +735,11 @@ namespace Model
          */
         virtual void CancelArchivalAsync(const Model::CancelArchivalRequest& request, const CancelArchivalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelArchivalAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelArchivalAsync(Model::CancelArchivalRequest&& request, const CancelArchivalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Cancels retrieval of a virtual tape from the virtual tape shelf (VTS) to a
          * gateway after the retrieval process is initiated. The virtual tape is returned
@@ -638,6 +756,11 @@ namespace Model
          */
         virtual Model::CancelRetrievalOutcomeCallable CancelRetrievalCallable(const Model::CancelRetrievalRequest& request) const;
 
+        /**
+         * Same as CancelRetrievalCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CancelRetrievalOutcomeCallable CancelRetrievalCallable(Model::CancelRetrievalRequest&& request) const;
+
         /**
          * <p>Cancels retrieval of a virtual tape from the virtual tape shelf (VTS) to a
          * gateway after the retrieval process is initiated. The virtual tape is returned
@@ -647,6 +770,11 @@ namespace Model
          */
         virtual void CancelRetrievalAsync(const Model::CancelRetrievalRequest& request, const CancelRetrievalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CancelRetrievalAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CancelRetrievalAsync(Model::CancelRetrievalRequest&& request, const CancelRetrievalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation creates a cached volume on a specified cached gateway. This
          * operation is supported only for the gateway-cached volume architecture.</p>
@@ -677,6 +805,11 @@ namespace Model
          */
         virtual Model::CreateCachediSCSIVolumeOutcomeCallable CreateCachediSCSIVolumeCallable(const Model::CreateCachediSCSIVolumeRequest& request) const;
 
+        /**
+         * Same as CreateCachediSCSIVolumeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateCachediSCSIVolumeOutcomeCallable CreateCachediSCSIVolumeCallable(Model::CreateCachediSCSIVolumeRequest&& request) const;
+
         /**
          * <p>This operation creates a cached volume on a specified cached gateway. This
          * operation is supported only for the gateway-cached volume architecture.</p>
@@ -693,6 +826,11 @@ namespace Model
          */
         virtual void CreateCachediSCSIVolumeAsync(const Model::CreateCachediSCSIVolumeRequest& request, const CreateCachediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCachediSCSIVolumeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateCachediSCSIVolumeAsync(Model::CreateCachediSCSIVolumeRequest&& request, const CreateCachediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation initiates a snapshot of a volume.</p> <p>AWS Storage Gateway
          * provides the ability to back up point-in-time snapshots of your data to Amazon
@@ -741,6 +879,11 @@ namespace Model
          */
         virtual Model::CreateSnapshotOutcomeCallable CreateSnapshotCallable(const Model::CreateSnapshotRequest& request) const;
 
+        /**
+         * Same as CreateSnapshotCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateSnapshotOutcomeCallable CreateSnapshotCallable(Model::CreateSnapshotRequest&& request) const;
+
         /**
          * <p>This operation initiates a snapshot of a volume.</p> <p>AWS Storage Gateway
          * provides the ability to back up point-in-time snapshots of your data to Amazon
@@ -766,6 +909,11 @@ namespace Model
          */
         virtual void CreateSnapshotAsync(const Model::CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSnapshotAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateSnapshotAsync(Model::CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation initiates a snapshot of a gateway from a volume recovery
          * point. This operation is supported only for the gateway-cached volume
@@ -806,6 +954,11 @@ namespace Model
          */
         virtual Model::CreateSnapshotFromVolumeRecoveryPointOutcomeCallable CreateSnapshotFromVolumeRecoveryPointCallable(const Model::CreateSnapshotFromVolumeRecoveryPointRequest& request) const;
 
+        /**
+         * Same as CreateSnapshotFromVolumeRecoveryPointCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateSnapshotFromVolumeRecoveryPointOutcomeCallable CreateSnapshotFromVolumeRecoveryPointCallable(Model::CreateSnapshotFromVolumeRecoveryPointRequest&& request) const;
+
         /**
          * <p>This operation initiates a snapshot of a gateway from a volume recovery
          * point. This operation is supported only for the gateway-cached volume
@@ -827,6 +980,11 @@ namespace Model
          */
         virtual void CreateSnapshotFromVolumeRecoveryPointAsync(const Model::CreateSnapshotFromVolumeRecoveryPointRequest& request, const CreateSnapshotFromVolumeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSnapshotFromVolumeRecoveryPointAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateSnapshotFromVolumeRecoveryPointAsync(Model::CreateSnapshotFromVolumeRecoveryPointRequest&& request, const CreateSnapshotFromVolumeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation creates a volume on a specified gateway. This operation is
          * supported only for the gateway-stored volume architecture. </p> <p>The size of
@@ -857,6 +1015,11 @@ namespace Model
          */
         virtual Model::CreateStorediSCSIVolumeOutcomeCallable CreateStorediSCSIVolumeCallable(const Model::CreateStorediSCSIVolumeRequest& request) const;
 
+        /**
+         * Same as CreateStorediSCSIVolumeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateStorediSCSIVolumeOutcomeCallable CreateStorediSCSIVolumeCallable(Model::CreateStorediSCSIVolumeRequest&& request) const;
+
         /**
          * <p>This operation creates a volume on a specified gateway. This operation is
          * supported only for the gateway-stored volume architecture. </p> <p>The size of
@@ -873,6 +1036,11 @@ namespace Model
          */
         virtual void CreateStorediSCSIVolumeAsync(const Model::CreateStorediSCSIVolumeRequest& request, const CreateStorediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateStorediSCSIVolumeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateStorediSCSIVolumeAsync(Model::CreateStorediSCSIVolumeRequest&& request, const CreateStorediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a virtual tape by using your own barcode. You write data to the
          * virtual tape and then archive the tape.</p> <note>Cache storage must be
@@ -891,6 +1059,11 @@ namespace Model
          */
         virtual Model::CreateTapeWithBarcodeOutcomeCallable CreateTapeWithBarcodeCallable(const Model::CreateTapeWithBarcodeRequest& request) const;
 
+        /**
+         * Same as CreateTapeWithBarcodeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateTapeWithBarcodeOutcomeCallable CreateTapeWithBarcodeCallable(Model::CreateTapeWithBarcodeRequest&& request) const;
+
         /**
          * <p>Creates a virtual tape by using your own barcode. You write data to the
          * virtual tape and then archive the tape.</p> <note>Cache storage must be
@@ -901,6 +1074,11 @@ namespace Model
          */
         virtual void CreateTapeWithBarcodeAsync(const Model::CreateTapeWithBarcodeRequest& request, const CreateTapeWithBarcodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTapeWithBarcodeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateTapeWithBarcodeAsync(Model::CreateTapeWithBarcodeRequest&& request, const CreateTapeWithBarcodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates one or more virtual tapes. You write data to the virtual tapes and
          * then archive the tapes.</p> <note>Cache storage must be allocated to the gateway
@@ -919,6 +1097,11 @@ namespace Model
          */
         virtual Model::CreateTapesOutcomeCallable CreateTapesCallable(const Model::CreateTapesRequest& request) const;
 
+        /**
+         * Same as CreateTapesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateTapesOutcomeCallable CreateTapesCallable(Model::CreateTapesRequest&& request) const;
+
         /**
          * <p>Creates one or more virtual tapes. You write data to the virtual tapes and
          * then archive the tapes.</p> <note>Cache storage must be allocated to the gateway
@@ -929,6 +1112,11 @@ namespace Model
          */
         virtual void CreateTapesAsync(const Model::CreateTapesRequest& request, const CreateTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateTapesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateTapesAsync(Model::CreateTapesRequest&& request, const CreateTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation deletes the bandwidth rate limits of a gateway. You can delete
          * either the upload and download bandwidth rate limit, or you can delete both. If
@@ -949,6 +1137,11 @@ namespace Model
          */
         virtual Model::DeleteBandwidthRateLimitOutcomeCallable DeleteBandwidthRateLimitCallable(const Model::DeleteBandwidthRateLimitRequest& request) const;
 
+        /**
+         * Same as DeleteBandwidthRateLimitCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteBandwidthRateLimitOutcomeCallable DeleteBandwidthRateLimitCallable(Model::DeleteBandwidthRateLimitRequest&& request) const;
+
         /**
          * <p>This operation deletes the bandwidth rate limits of a gateway. You can delete
          * either the upload and download bandwidth rate limit, or you can delete both. If
@@ -960,6 +1153,11 @@ namespace Model
          */
         virtual void DeleteBandwidthRateLimitAsync(const Model::DeleteBandwidthRateLimitRequest& request, const DeleteBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteBandwidthRateLimitAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteBandwidthRateLimitAsync(Model::DeleteBandwidthRateLimitRequest&& request, const DeleteBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation deletes Challenge-Handshake Authentication Protocol (CHAP)
          * credentials for a specified iSCSI target and initiator pair.</p>
@@ -974,6 +1172,11 @@ namespace Model
          */
         virtual Model::DeleteChapCredentialsOutcomeCallable DeleteChapCredentialsCallable(const Model::DeleteChapCredentialsRequest& request) const;
 
+        /**
+         * Same as DeleteChapCredentialsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteChapCredentialsOutcomeCallable DeleteChapCredentialsCallable(Model::DeleteChapCredentialsRequest&& request) const;
+
         /**
          * <p>This operation deletes Challenge-Handshake Authentication Protocol (CHAP)
          * credentials for a specified iSCSI target and initiator pair.</p>
@@ -982,6 +1185,11 @@ namespace Model
          */
         virtual void DeleteChapCredentialsAsync(const Model::DeleteChapCredentialsRequest& request, const DeleteChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteChapCredentialsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteChapCredentialsAsync(Model::DeleteChapCredentialsRequest&& request, const DeleteChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation deletes a gateway. To specify which gateway to delete, use the
          * Amazon Resource Name (ARN) of the gateway in your request. The operation deletes
@@ -1022,6 +1230,11 @@ namespace Model
          */
         virtual Model::DeleteGatewayOutcomeCallable DeleteGatewayCallable(const Model::DeleteGatewayRequest& request) const;
 
+        /**
+         * Same as DeleteGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteGatewayOutcomeCallable DeleteGatewayCallable(Model::DeleteGatewayRequest&& request) const;
+
         /**
          * <p>This operation deletes a gateway. To specify which gateway to delete, use the
          * Amazon Resource Name (ARN) of the gateway in your request. The operation deletes
@@ -1043,6 +1256,11 @@ namespace Model
          */
         virtual void DeleteGatewayAsync(const Model::DeleteGatewayRequest& request, const DeleteGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteGatewayAsync(Model::DeleteGatewayRequest&& request, const DeleteGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p> This operation deletes a snapshot of a volume. </p> <p> You can take
          * snapshots of your gateway volumes on a scheduled or ad-hoc basis. This API
@@ -1071,6 +1289,11 @@ namespace Model
          */
         virtual Model::DeleteSnapshotScheduleOutcomeCallable DeleteSnapshotScheduleCallable(const Model::DeleteSnapshotScheduleRequest& request) const;
 
+        /**
+         * Same as DeleteSnapshotScheduleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSnapshotScheduleOutcomeCallable DeleteSnapshotScheduleCallable(Model::DeleteSnapshotScheduleRequest&& request) const;
+
         /**
          * <p> This operation deletes a snapshot of a volume. </p> <p> You can take
          * snapshots of your gateway volumes on a scheduled or ad-hoc basis. This API
@@ -1086,6 +1309,11 @@ namespace Model
          */
         virtual void DeleteSnapshotScheduleAsync(const Model::DeleteSnapshotScheduleRequest& request, const DeleteSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSnapshotScheduleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSnapshotScheduleAsync(Model::DeleteSnapshotScheduleRequest&& request, const DeleteSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified virtual tape.</p>
          */
@@ -1098,6 +1326,11 @@ namespace Model
          */
         virtual Model::DeleteTapeOutcomeCallable DeleteTapeCallable(const Model::DeleteTapeRequest& request) const;
 
+        /**
+         * Same as DeleteTapeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteTapeOutcomeCallable DeleteTapeCallable(Model::DeleteTapeRequest&& request) const;
+
         /**
          * <p>Deletes the specified virtual tape.</p>
          *
@@ -1105,6 +1338,11 @@ namespace Model
          */
         virtual void DeleteTapeAsync(const Model::DeleteTapeRequest& request, const DeleteTapeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTapeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteTapeAsync(Model::DeleteTapeRequest&& request, const DeleteTapeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deletes the specified virtual tape from the virtual tape shelf (VTS).</p>
          */
@@ -1117,6 +1355,11 @@ namespace Model
          */
         virtual Model::DeleteTapeArchiveOutcomeCallable DeleteTapeArchiveCallable(const Model::DeleteTapeArchiveRequest& request) const;
 
+        /**
+         * Same as DeleteTapeArchiveCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteTapeArchiveOutcomeCallable DeleteTapeArchiveCallable(Model::DeleteTapeArchiveRequest&& request) const;
+
         /**
          * <p>Deletes the specified virtual tape from the virtual tape shelf (VTS).</p>
          *
@@ -1124,6 +1367,11 @@ namespace Model
          */
         virtual void DeleteTapeArchiveAsync(const Model::DeleteTapeArchiveRequest& request, const DeleteTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteTapeArchiveAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteTapeArchiveAsync(Model::DeleteTapeArchiveRequest&& request, const DeleteTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation deletes the specified gateway volume that you previously
          * created using the <a>CreateCachediSCSIVolume</a> or
@@ -1160,6 +1408,11 @@ namespace Model
          */
         virtual Model::DeleteVolumeOutcomeCallable DeleteVolumeCallable(const Model::DeleteVolumeRequest& request) const;
 
+        /**
+         * Same as DeleteVolumeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteVolumeOutcomeCallable DeleteVolumeCallable(Model::DeleteVolumeRequest&& request) const;
+
         /**
          * <p>This operation deletes the specified gateway volume that you previously
          * created using the <a>CreateCachediSCSIVolume</a> or
@@ -1179,6 +1432,11 @@ namespace Model
          */
         virtual void DeleteVolumeAsync(const Model::DeleteVolumeRequest& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteVolumeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteVolumeAsync(Model::DeleteVolumeRequest&& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns the bandwidth rate limits of a gateway. By default,
          * these limits are not set, which means no bandwidth rate limiting is in
@@ -1203,6 +1461,11 @@ namespace Model
          */
         virtual Model::DescribeBandwidthRateLimitOutcomeCallable DescribeBandwidthRateLimitCallable(const Model::DescribeBandwidthRateLimitRequest& request) const;
 
+        /**
+         * Same as DescribeBandwidthRateLimitCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeBandwidthRateLimitOutcomeCallable DescribeBandwidthRateLimitCallable(Model::DescribeBandwidthRateLimitRequest&& request) const;
+
         /**
          * <p>This operation returns the bandwidth rate limits of a gateway. By default,
          * these limits are not set, which means no bandwidth rate limiting is in
@@ -1216,6 +1479,11 @@ namespace Model
          */
         virtual void DescribeBandwidthRateLimitAsync(const Model::DescribeBandwidthRateLimitRequest& request, const DescribeBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeBandwidthRateLimitAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeBandwidthRateLimitAsync(Model::DescribeBandwidthRateLimitRequest&& request, const DescribeBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns information about the cache of a gateway. This
          * operation is supported only for the gateway-cached volume architecture. </p> <p>
@@ -1234,6 +1502,11 @@ namespace Model
          */
         virtual Model::DescribeCacheOutcomeCallable DescribeCacheCallable(const Model::DescribeCacheRequest& request) const;
 
+        /**
+         * Same as DescribeCacheCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCacheOutcomeCallable DescribeCacheCallable(Model::DescribeCacheRequest&& request) const;
+
         /**
          * <p>This operation returns information about the cache of a gateway. This
          * operation is supported only for the gateway-cached volume architecture. </p> <p>
@@ -1244,6 +1517,11 @@ namespace Model
          */
         virtual void DescribeCacheAsync(const Model::DescribeCacheRequest& request, const DescribeCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCacheAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCacheAsync(Model::DescribeCacheRequest&& request, const DescribeCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns a description of the gateway volumes specified in the
          * request. This operation is supported only for the gateway-cached volume
@@ -1264,6 +1542,11 @@ namespace Model
          */
         virtual Model::DescribeCachediSCSIVolumesOutcomeCallable DescribeCachediSCSIVolumesCallable(const Model::DescribeCachediSCSIVolumesRequest& request) const;
 
+        /**
+         * Same as DescribeCachediSCSIVolumesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCachediSCSIVolumesOutcomeCallable DescribeCachediSCSIVolumesCallable(Model::DescribeCachediSCSIVolumesRequest&& request) const;
+
         /**
          * <p>This operation returns a description of the gateway volumes specified in the
          * request. This operation is supported only for the gateway-cached volume
@@ -1275,6 +1558,11 @@ namespace Model
          */
         virtual void DescribeCachediSCSIVolumesAsync(const Model::DescribeCachediSCSIVolumesRequest& request, const DescribeCachediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCachediSCSIVolumesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCachediSCSIVolumesAsync(Model::DescribeCachediSCSIVolumesRequest&& request, const DescribeCachediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns an array of Challenge-Handshake Authentication
          * Protocol (CHAP) credentials information for a specified iSCSI target, one for
@@ -1291,6 +1579,11 @@ namespace Model
          */
         virtual Model::DescribeChapCredentialsOutcomeCallable DescribeChapCredentialsCallable(const Model::DescribeChapCredentialsRequest& request) const;
 
+        /**
+         * Same as DescribeChapCredentialsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeChapCredentialsOutcomeCallable DescribeChapCredentialsCallable(Model::DescribeChapCredentialsRequest&& request) const;
+
         /**
          * <p>This operation returns an array of Challenge-Handshake Authentication
          * Protocol (CHAP) credentials information for a specified iSCSI target, one for
@@ -1300,6 +1593,11 @@ namespace Model
          */
         virtual void DescribeChapCredentialsAsync(const Model::DescribeChapCredentialsRequest& request, const DescribeChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeChapCredentialsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeChapCredentialsAsync(Model::DescribeChapCredentialsRequest&& request, const DescribeChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns metadata about a gateway such as its name, network
          * interfaces, configured time zone, and the state (whether the gateway is running
@@ -1318,6 +1616,11 @@ namespace Model
          */
         virtual Model::DescribeGatewayInformationOutcomeCallable DescribeGatewayInformationCallable(const Model::DescribeGatewayInformationRequest& request) const;
 
+        /**
+         * Same as DescribeGatewayInformationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeGatewayInformationOutcomeCallable DescribeGatewayInformationCallable(Model::DescribeGatewayInformationRequest&& request) const;
+
         /**
          * <p>This operation returns metadata about a gateway such as its name, network
          * interfaces, configured time zone, and the state (whether the gateway is running
@@ -1328,6 +1631,11 @@ namespace Model
          */
         virtual void DescribeGatewayInformationAsync(const Model::DescribeGatewayInformationRequest& request, const DescribeGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeGatewayInformationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeGatewayInformationAsync(Model::DescribeGatewayInformationRequest&& request, const DescribeGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns your gateway's weekly maintenance start time including
          * the day and time of the week. Note that values are in terms of the gateway's
@@ -1344,6 +1652,11 @@ namespace Model
          */
         virtual Model::DescribeMaintenanceStartTimeOutcomeCallable DescribeMaintenanceStartTimeCallable(const Model::DescribeMaintenanceStartTimeRequest& request) const;
 
+        /**
+         * Same as DescribeMaintenanceStartTimeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeMaintenanceStartTimeOutcomeCallable DescribeMaintenanceStartTimeCallable(Model::DescribeMaintenanceStartTimeRequest&& request) const;
+
         /**
          * <p>This operation returns your gateway's weekly maintenance start time including
          * the day and time of the week. Note that values are in terms of the gateway's
@@ -1353,6 +1666,11 @@ namespace Model
          */
         virtual void DescribeMaintenanceStartTimeAsync(const Model::DescribeMaintenanceStartTimeRequest& request, const DescribeMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeMaintenanceStartTimeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeMaintenanceStartTimeAsync(Model::DescribeMaintenanceStartTimeRequest&& request, const DescribeMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation describes the snapshot schedule for the specified gateway
          * volume. The snapshot schedule information includes intervals at which snapshots
@@ -1369,6 +1687,11 @@ namespace Model
          */
         virtual Model::DescribeSnapshotScheduleOutcomeCallable DescribeSnapshotScheduleCallable(const Model::DescribeSnapshotScheduleRequest& request) const;
 
+        /**
+         * Same as DescribeSnapshotScheduleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSnapshotScheduleOutcomeCallable DescribeSnapshotScheduleCallable(Model::DescribeSnapshotScheduleRequest&& request) const;
+
         /**
          * <p>This operation describes the snapshot schedule for the specified gateway
          * volume. The snapshot schedule information includes intervals at which snapshots
@@ -1378,6 +1701,11 @@ namespace Model
          */
         virtual void DescribeSnapshotScheduleAsync(const Model::DescribeSnapshotScheduleRequest& request, const DescribeSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSnapshotScheduleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSnapshotScheduleAsync(Model::DescribeSnapshotScheduleRequest&& request, const DescribeSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns the description of the gateway volumes specified in
          * the request. The list of gateway volumes in the request must be from one
@@ -1396,6 +1724,11 @@ namespace Model
          */
         virtual Model::DescribeStorediSCSIVolumesOutcomeCallable DescribeStorediSCSIVolumesCallable(const Model::DescribeStorediSCSIVolumesRequest& request) const;
 
+        /**
+         * Same as DescribeStorediSCSIVolumesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeStorediSCSIVolumesOutcomeCallable DescribeStorediSCSIVolumesCallable(Model::DescribeStorediSCSIVolumesRequest&& request) const;
+
         /**
          * <p>This operation returns the description of the gateway volumes specified in
          * the request. The list of gateway volumes in the request must be from one
@@ -1406,6 +1739,11 @@ namespace Model
          */
         virtual void DescribeStorediSCSIVolumesAsync(const Model::DescribeStorediSCSIVolumesRequest& request, const DescribeStorediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeStorediSCSIVolumesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeStorediSCSIVolumesAsync(Model::DescribeStorediSCSIVolumesRequest&& request, const DescribeStorediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a description of specified virtual tapes in the virtual tape shelf
          * (VTS). </p> <p>If a specific <code>TapeARN</code> is not specified, AWS Storage
@@ -1424,6 +1762,11 @@ namespace Model
          */
         virtual Model::DescribeTapeArchivesOutcomeCallable DescribeTapeArchivesCallable(const Model::DescribeTapeArchivesRequest& request) const;
 
+        /**
+         * Same as DescribeTapeArchivesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTapeArchivesOutcomeCallable DescribeTapeArchivesCallable(Model::DescribeTapeArchivesRequest&& request) const;
+
         /**
          * <p>Returns a description of specified virtual tapes in the virtual tape shelf
          * (VTS). </p> <p>If a specific <code>TapeARN</code> is not specified, AWS Storage
@@ -1434,6 +1777,11 @@ namespace Model
          */
         virtual void DescribeTapeArchivesAsync(const Model::DescribeTapeArchivesRequest& request, const DescribeTapeArchivesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTapeArchivesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTapeArchivesAsync(Model::DescribeTapeArchivesRequest&& request, const DescribeTapeArchivesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of virtual tape recovery points that are available for the
          * specified gateway-VTL.</p> <p>A recovery point is a point in time view of a
@@ -1454,6 +1802,11 @@ namespace Model
          */
         virtual Model::DescribeTapeRecoveryPointsOutcomeCallable DescribeTapeRecoveryPointsCallable(const Model::DescribeTapeRecoveryPointsRequest& request) const;
 
+        /**
+         * Same as DescribeTapeRecoveryPointsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTapeRecoveryPointsOutcomeCallable DescribeTapeRecoveryPointsCallable(Model::DescribeTapeRecoveryPointsRequest&& request) const;
+
         /**
          * <p>Returns a list of virtual tape recovery points that are available for the
          * specified gateway-VTL.</p> <p>A recovery point is a point in time view of a
@@ -1465,6 +1818,11 @@ namespace Model
          */
         virtual void DescribeTapeRecoveryPointsAsync(const Model::DescribeTapeRecoveryPointsRequest& request, const DescribeTapeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTapeRecoveryPointsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTapeRecoveryPointsAsync(Model::DescribeTapeRecoveryPointsRequest&& request, const DescribeTapeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a description of the specified Amazon Resource Name (ARN) of virtual
          * tapes. If a <code>TapeARN</code> is not specified, returns a description of all
@@ -1481,6 +1839,11 @@ namespace Model
          */
         virtual Model::DescribeTapesOutcomeCallable DescribeTapesCallable(const Model::DescribeTapesRequest& request) const;
 
+        /**
+         * Same as DescribeTapesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTapesOutcomeCallable DescribeTapesCallable(Model::DescribeTapesRequest&& request) const;
+
         /**
          * <p>Returns a description of the specified Amazon Resource Name (ARN) of virtual
          * tapes. If a <code>TapeARN</code> is not specified, returns a description of all
@@ -1490,6 +1853,11 @@ namespace Model
          */
         virtual void DescribeTapesAsync(const Model::DescribeTapesRequest& request, const DescribeTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTapesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTapesAsync(Model::DescribeTapesRequest&& request, const DescribeTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns information about the upload buffer of a gateway. This
          * operation is supported for both the gateway-stored and gateway-cached volume
@@ -1510,6 +1878,11 @@ namespace Model
          */
         virtual Model::DescribeUploadBufferOutcomeCallable DescribeUploadBufferCallable(const Model::DescribeUploadBufferRequest& request) const;
 
+        /**
+         * Same as DescribeUploadBufferCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeUploadBufferOutcomeCallable DescribeUploadBufferCallable(Model::DescribeUploadBufferRequest&& request) const;
+
         /**
          * <p>This operation returns information about the upload buffer of a gateway. This
          * operation is supported for both the gateway-stored and gateway-cached volume
@@ -1521,6 +1894,11 @@ namespace Model
          */
         virtual void DescribeUploadBufferAsync(const Model::DescribeUploadBufferRequest& request, const DescribeUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeUploadBufferAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeUploadBufferAsync(Model::DescribeUploadBufferRequest&& request, const DescribeUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a description of virtual tape library (VTL) devices for the specified
          * gateway. In the response, AWS Storage Gateway returns VTL device information.
@@ -1537,6 +1915,11 @@ namespace Model
          */
         virtual Model::DescribeVTLDevicesOutcomeCallable DescribeVTLDevicesCallable(const Model::DescribeVTLDevicesRequest& request) const;
 
+        /**
+         * Same as DescribeVTLDevicesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeVTLDevicesOutcomeCallable DescribeVTLDevicesCallable(Model::DescribeVTLDevicesRequest&& request) const;
+
         /**
          * <p>Returns a description of virtual tape library (VTL) devices for the specified
          * gateway. In the response, AWS Storage Gateway returns VTL device information.
@@ -1546,6 +1929,11 @@ namespace Model
          */
         virtual void DescribeVTLDevicesAsync(const Model::DescribeVTLDevicesRequest& request, const DescribeVTLDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeVTLDevicesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeVTLDevicesAsync(Model::DescribeVTLDevicesRequest&& request, const DescribeVTLDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns information about the working storage of a gateway.
          * This operation is supported only for the gateway-stored volume architecture.
@@ -1572,6 +1960,11 @@ namespace Model
          */
         virtual Model::DescribeWorkingStorageOutcomeCallable DescribeWorkingStorageCallable(const Model::DescribeWorkingStorageRequest& request) const;
 
+        /**
+         * Same as DescribeWorkingStorageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeWorkingStorageOutcomeCallable DescribeWorkingStorageCallable(Model::DescribeWorkingStorageRequest&& request) const;
+
         /**
          * <p>This operation returns information about the working storage of a gateway.
          * This operation is supported only for the gateway-stored volume architecture.
@@ -1586,6 +1979,11 @@ namespace Model
          */
         virtual void DescribeWorkingStorageAsync(const Model::DescribeWorkingStorageRequest& request, const DescribeWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeWorkingStorageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeWorkingStorageAsync(Model::DescribeWorkingStorageRequest&& request, const DescribeWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Disables a gateway when the gateway is no longer functioning. For example, if
          * your gateway VM is damaged, you can disable the gateway so you can recover
@@ -1606,6 +2004,11 @@ namespace Model
          */
         virtual Model::DisableGatewayOutcomeCallable DisableGatewayCallable(const Model::DisableGatewayRequest& request) const;
 
+        /**
+         * Same as DisableGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DisableGatewayOutcomeCallable DisableGatewayCallable(Model::DisableGatewayRequest&& request) const;
+
         /**
          * <p>Disables a gateway when the gateway is no longer functioning. For example, if
          * your gateway VM is damaged, you can disable the gateway so you can recover
@@ -1617,6 +2020,11 @@ namespace Model
          */
         virtual void DisableGatewayAsync(const Model::DisableGatewayRequest& request, const DisableGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DisableGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DisableGatewayAsync(Model::DisableGatewayRequest&& request, const DisableGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists gateways owned by an AWS account in a region specified
          * in the request. The returned list is ordered by gateway Amazon Resource Name
@@ -1643,6 +2051,11 @@ namespace Model
          */
         virtual Model::ListGatewaysOutcomeCallable ListGatewaysCallable(const Model::ListGatewaysRequest& request) const;
 
+        /**
+         * Same as ListGatewaysCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListGatewaysOutcomeCallable ListGatewaysCallable(Model::ListGatewaysRequest&& request) const;
+
         /**
          * <p>This operation lists gateways owned by an AWS account in a region specified
          * in the request. The returned list is ordered by gateway Amazon Resource Name
@@ -1657,6 +2070,11 @@ namespace Model
          */
         virtual void ListGatewaysAsync(const Model::ListGatewaysRequest& request, const ListGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListGatewaysAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListGatewaysAsync(Model::ListGatewaysRequest&& request, const ListGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation returns a list of the gateway's local disks. To specify which
          * gateway to describe, you use the Amazon Resource Name (ARN) of the gateway in
@@ -1685,6 +2103,11 @@ namespace Model
          */
         virtual Model::ListLocalDisksOutcomeCallable ListLocalDisksCallable(const Model::ListLocalDisksRequest& request) const;
 
+        /**
+         * Same as ListLocalDisksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListLocalDisksOutcomeCallable ListLocalDisksCallable(Model::ListLocalDisksRequest&& request) const;
+
         /**
          * <p>This operation returns a list of the gateway's local disks. To specify which
          * gateway to describe, you use the Amazon Resource Name (ARN) of the gateway in
@@ -1700,6 +2123,11 @@ namespace Model
          */
         virtual void ListLocalDisksAsync(const Model::ListLocalDisksRequest& request, const ListLocalDisksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListLocalDisksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListLocalDisksAsync(Model::ListLocalDisksRequest&& request, const ListLocalDisksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists the tags that have been added to the specified resource.
          * </p>
@@ -1714,6 +2142,11 @@ namespace Model
          */
         virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(const Model::ListTagsForResourceRequest& request) const;
 
+        /**
+         * Same as ListTagsForResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListTagsForResourceOutcomeCallable ListTagsForResourceCallable(Model::ListTagsForResourceRequest&& request) const;
+
         /**
          * <p>This operation lists the tags that have been added to the specified resource.
          * </p>
@@ -1722,6 +2155,11 @@ namespace Model
          */
         virtual void ListTagsForResourceAsync(const Model::ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListTagsForResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListTagsForResourceAsync(Model::ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists iSCSI initiators that are connected to a volume. You can
          * use this operation to determine whether a volume is being used or not.</p>
@@ -1736,6 +2174,11 @@ namespace Model
          */
         virtual Model::ListVolumeInitiatorsOutcomeCallable ListVolumeInitiatorsCallable(const Model::ListVolumeInitiatorsRequest& request) const;
 
+        /**
+         * Same as ListVolumeInitiatorsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListVolumeInitiatorsOutcomeCallable ListVolumeInitiatorsCallable(Model::ListVolumeInitiatorsRequest&& request) const;
+
         /**
          * <p>This operation lists iSCSI initiators that are connected to a volume. You can
          * use this operation to determine whether a volume is being used or not.</p>
@@ -1744,6 +2187,11 @@ namespace Model
          */
         virtual void ListVolumeInitiatorsAsync(const Model::ListVolumeInitiatorsRequest& request, const ListVolumeInitiatorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListVolumeInitiatorsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListVolumeInitiatorsAsync(Model::ListVolumeInitiatorsRequest&& request, const ListVolumeInitiatorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists the recovery points for a specified gateway. This
          * operation is supported only for the gateway-cached volume architecture.</p>
@@ -1766,6 +2214,11 @@ namespace Model
          */
         virtual Model::ListVolumeRecoveryPointsOutcomeCallable ListVolumeRecoveryPointsCallable(const Model::ListVolumeRecoveryPointsRequest& request) const;
 
+        /**
+         * Same as ListVolumeRecoveryPointsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListVolumeRecoveryPointsOutcomeCallable ListVolumeRecoveryPointsCallable(Model::ListVolumeRecoveryPointsRequest&& request) const;
+
         /**
          * <p>This operation lists the recovery points for a specified gateway. This
          * operation is supported only for the gateway-cached volume architecture.</p>
@@ -1778,6 +2231,11 @@ namespace Model
          */
         virtual void ListVolumeRecoveryPointsAsync(const Model::ListVolumeRecoveryPointsRequest& request, const ListVolumeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListVolumeRecoveryPointsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListVolumeRecoveryPointsAsync(Model::ListVolumeRecoveryPointsRequest&& request, const ListVolumeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation lists the iSCSI stored volumes of a gateway. Results are
          * sorted by volume ARN. The response includes only the volume ARNs. If you want
@@ -1806,6 +2264,11 @@ namespace Model
          */
         virtual Model::ListVolumesOutcomeCallable ListVolumesCallable(const Model::ListVolumesRequest& request) const;
 
+        /**
+         * Same as ListVolumesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListVolumesOutcomeCallable ListVolumesCallable(Model::ListVolumesRequest&& request) const;
+
         /**
          * <p>This operation lists the iSCSI stored volumes of a gateway. Results are
          * sorted by volume ARN. The response includes only the volume ARNs. If you want
@@ -1821,6 +2284,11 @@ namespace Model
          */
         virtual void ListVolumesAsync(const Model::ListVolumesRequest& request, const ListVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListVolumesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListVolumesAsync(Model::ListVolumesRequest&& request, const ListVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation removes one or more tags from the specified resource.</p>
          */
@@ -1833,6 +2301,11 @@ namespace Model
          */
         virtual Model::RemoveTagsFromResourceOutcomeCallable RemoveTagsFromResourceCallable(const Model::RemoveTagsFromResourceRequest& request) const;
 
+        /**
+         * Same as RemoveTagsFromResourceCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RemoveTagsFromResourceOutcomeCallable RemoveTagsFromResourceCallable(Model::RemoveTagsFromResourceRequest&& request) const;
+
         /**
          * <p>This operation removes one or more tags from the specified resource.</p>
          *
@@ -1840,6 +2313,11 @@ namespace Model
          */
         virtual void RemoveTagsFromResourceAsync(const Model::RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RemoveTagsFromResourceAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RemoveTagsFromResourceAsync(Model::RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation resets all cache disks that have encountered a error and makes
          * the disks available for reconfiguration as cache storage. If your cache disk
@@ -1872,6 +2350,11 @@ namespace Model
          */
         virtual Model::ResetCacheOutcomeCallable ResetCacheCallable(const Model::ResetCacheRequest& request) const;
 
+        /**
+         * Same as ResetCacheCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ResetCacheOutcomeCallable ResetCacheCallable(Model::ResetCacheRequest&& request) const;
+
         /**
          * <p>This operation resets all cache disks that have encountered a error and makes
          * the disks available for reconfiguration as cache storage. If your cache disk
@@ -1889,6 +2372,11 @@ namespace Model
          */
         virtual void ResetCacheAsync(const Model::ResetCacheRequest& request, const ResetCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResetCacheAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ResetCacheAsync(Model::ResetCacheRequest&& request, const ResetCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves an archived virtual tape from the virtual tape shelf (VTS) to a
          * gateway-VTL. Virtual tapes archived in the VTS are not associated with any
@@ -1911,6 +2399,11 @@ namespace Model
          */
         virtual Model::RetrieveTapeArchiveOutcomeCallable RetrieveTapeArchiveCallable(const Model::RetrieveTapeArchiveRequest& request) const;
 
+        /**
+         * Same as RetrieveTapeArchiveCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RetrieveTapeArchiveOutcomeCallable RetrieveTapeArchiveCallable(Model::RetrieveTapeArchiveRequest&& request) const;
+
         /**
          * <p>Retrieves an archived virtual tape from the virtual tape shelf (VTS) to a
          * gateway-VTL. Virtual tapes archived in the VTS are not associated with any
@@ -1923,6 +2416,11 @@ namespace Model
          */
         virtual void RetrieveTapeArchiveAsync(const Model::RetrieveTapeArchiveRequest& request, const RetrieveTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RetrieveTapeArchiveAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RetrieveTapeArchiveAsync(Model::RetrieveTapeArchiveRequest&& request, const RetrieveTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves the recovery point for the specified virtual tape.</p> <p>A
          * recovery point is a point in time view of a virtual tape at which all the data
@@ -1947,6 +2445,11 @@ namespace Model
          */
         virtual Model::RetrieveTapeRecoveryPointOutcomeCallable RetrieveTapeRecoveryPointCallable(const Model::RetrieveTapeRecoveryPointRequest& request) const;
 
+        /**
+         * Same as RetrieveTapeRecoveryPointCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RetrieveTapeRecoveryPointOutcomeCallable RetrieveTapeRecoveryPointCallable(Model::RetrieveTapeRecoveryPointRequest&& request) const;
+
         /**
          * <p>Retrieves the recovery point for the specified virtual tape.</p> <p>A
          * recovery point is a point in time view of a virtual tape at which all the data
@@ -1960,6 +2463,11 @@ namespace Model
          */
         virtual void RetrieveTapeRecoveryPointAsync(const Model::RetrieveTapeRecoveryPointRequest& request, const RetrieveTapeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RetrieveTapeRecoveryPointAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RetrieveTapeRecoveryPointAsync(Model::RetrieveTapeRecoveryPointRequest&& request, const RetrieveTapeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation shuts down a gateway. To specify which gateway to shut down,
          * use the Amazon Resource Name (ARN) of the gateway in the body of your
@@ -2004,6 +2512,11 @@ namespace Model
          */
         virtual Model::ShutdownGatewayOutcomeCallable ShutdownGatewayCallable(const Model::ShutdownGatewayRequest& request) const;
 
+        /**
+         * Same as ShutdownGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ShutdownGatewayOutcomeCallable ShutdownGatewayCallable(Model::ShutdownGatewayRequest&& request) const;
+
         /**
          * <p>This operation shuts down a gateway. To specify which gateway to shut down,
          * use the Amazon Resource Name (ARN) of the gateway in the body of your
@@ -2027,6 +2540,11 @@ namespace Model
          */
         virtual void ShutdownGatewayAsync(const Model::ShutdownGatewayRequest& request, const ShutdownGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ShutdownGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ShutdownGatewayAsync(Model::ShutdownGatewayRequest&& request, const ShutdownGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation starts a gateway that you previously shut down (see
          * <a>ShutdownGateway</a>). After the gateway starts, you can then make other API
@@ -2057,6 +2575,11 @@ namespace Model
          */
         virtual Model::StartGatewayOutcomeCallable StartGatewayCallable(const Model::StartGatewayRequest& request) const;
 
+        /**
+         * Same as StartGatewayCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StartGatewayOutcomeCallable StartGatewayCallable(Model::StartGatewayRequest&& request) const;
+
         /**
          * <p>This operation starts a gateway that you previously shut down (see
          * <a>ShutdownGateway</a>). After the gateway starts, you can then make other API
@@ -2073,6 +2596,11 @@ namespace Model
          */
         virtual void StartGatewayAsync(const Model::StartGatewayRequest& request, const StartGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartGatewayAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StartGatewayAsync(Model::StartGatewayRequest&& request, const StartGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation updates the bandwidth rate limits of a gateway. You can update
          * both the upload and download bandwidth rate limit or specify only one of the
@@ -2099,6 +2627,11 @@ namespace Model
          */
         virtual Model::UpdateBandwidthRateLimitOutcomeCallable UpdateBandwidthRateLimitCallable(const Model::UpdateBandwidthRateLimitRequest& request) const;
 
+        /**
+         * Same as UpdateBandwidthRateLimitCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateBandwidthRateLimitOutcomeCallable UpdateBandwidthRateLimitCallable(Model::UpdateBandwidthRateLimitRequest&& request) const;
+
         /**
          * <p>This operation updates the bandwidth rate limits of a gateway. You can update
          * both the upload and download bandwidth rate limit or specify only one of the
@@ -2113,6 +2646,11 @@ namespace Model
          */
         virtual void UpdateBandwidthRateLimitAsync(const Model::UpdateBandwidthRateLimitRequest& request, const UpdateBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateBandwidthRateLimitAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateBandwidthRateLimitAsync(Model::UpdateBandwidthRateLimitRequest&& request, const UpdateBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation updates the Challenge-Handshake Authentication Protocol (CHAP)
          * credentials for a specified iSCSI target. By default, a gateway does not have
@@ -2133,6 +2671,11 @@ namespace Model
          */
         virtual Model::UpdateChapCredentialsOutcomeCallable UpdateChapCredentialsCallable(const Model::UpdateChapCredentialsRequest& request) const;
 
+        /**
+         * Same as UpdateChapCredentialsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateChapCredentialsOutcomeCallable UpdateChapCredentialsCallable(Model::UpdateChapCredentialsRequest&& request) const;
+
         /**
          * <p>This operation updates the Challenge-Handshake Authentication Protocol (CHAP)
          * credentials for a specified iSCSI target. By default, a gateway does not have
@@ -2144,6 +2687,11 @@ namespace Model
          */
         virtual void UpdateChapCredentialsAsync(const Model::UpdateChapCredentialsRequest& request, const UpdateChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateChapCredentialsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateChapCredentialsAsync(Model::UpdateChapCredentialsRequest&& request, const UpdateChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation updates a gateway's metadata, which includes the gateway's
          * name and time zone. To specify which gateway to update, use the Amazon Resource
@@ -2166,6 +2714,11 @@ namespace Model
          */
         virtual Model::UpdateGatewayInformationOutcomeCallable UpdateGatewayInformationCallable(const Model::UpdateGatewayInformationRequest& request) const;
 
+        /**
+         * Same as UpdateGatewayInformationCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateGatewayInformationOutcomeCallable UpdateGatewayInformationCallable(Model::UpdateGatewayInformationRequest&& request) const;
+
         /**
          * <p>This operation updates a gateway's metadata, which includes the gateway's
          * name and time zone. To specify which gateway to update, use the Amazon Resource
@@ -2178,6 +2731,11 @@ namespace Model
          */
         virtual void UpdateGatewayInformationAsync(const Model::UpdateGatewayInformationRequest& request, const UpdateGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateGatewayInformationAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateGatewayInformationAsync(Model::UpdateGatewayInformationRequest&& request, const UpdateGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation updates the gateway virtual machine (VM) software. The request
          * immediately triggers the software update. </p> <note>When you make this request,
@@ -2216,6 +2774,11 @@ namespace Model
          */
         virtual Model::UpdateGatewaySoftwareNowOutcomeCallable UpdateGatewaySoftwareNowCallable(const Model::UpdateGatewaySoftwareNowRequest& request) const;
 
+        /**
+         * Same as UpdateGatewaySoftwareNowCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateGatewaySoftwareNowOutcomeCallable UpdateGatewaySoftwareNowCallable(Model::UpdateGatewaySoftwareNowRequest&& request) const;
+
         /**
          * <p>This operation updates the gateway virtual machine (VM) software. The request
          * immediately triggers the software update. </p> <note>When you make this request,
@@ -2236,6 +2799,11 @@ namespace Model
          */
         virtual void UpdateGatewaySoftwareNowAsync(const Model::UpdateGatewaySoftwareNowRequest& request, const UpdateGatewaySoftwareNowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateGatewaySoftwareNowAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateGatewaySoftwareNowAsync(Model::UpdateGatewaySoftwareNowRequest&& request, const UpdateGatewaySoftwareNowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation updates a gateway's weekly maintenance start time information,
          * including day and time of the week. The maintenance time is the time in your
@@ -2252,6 +2820,11 @@ namespace Model
          */
         virtual Model::UpdateMaintenanceStartTimeOutcomeCallable UpdateMaintenanceStartTimeCallable(const Model::UpdateMaintenanceStartTimeRequest& request) const;
 
+        /**
+         * Same as UpdateMaintenanceStartTimeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateMaintenanceStartTimeOutcomeCallable UpdateMaintenanceStartTimeCallable(Model::UpdateMaintenanceStartTimeRequest&& request) const;
+
         /**
          * <p>This operation updates a gateway's weekly maintenance start time information,
          * including day and time of the week. The maintenance time is the time in your
@@ -2261,6 +2834,11 @@ namespace Model
          */
         virtual void UpdateMaintenanceStartTimeAsync(const Model::UpdateMaintenanceStartTimeRequest& request, const UpdateMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateMaintenanceStartTimeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateMaintenanceStartTimeAsync(Model::UpdateMaintenanceStartTimeRequest&& request, const UpdateMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation updates a snapshot schedule configured for a gateway
          * volume.</p> <p>The default snapshot schedule for volume is once every 24 hours,
@@ -2285,6 +2863,11 @@ namespace Model
          */
         virtual Model::UpdateSnapshotScheduleOutcomeCallable UpdateSnapshotScheduleCallable(const Model::UpdateSnapshotScheduleRequest& request) const;
 
+        /**
+         * Same as UpdateSnapshotScheduleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateSnapshotScheduleOutcomeCallable UpdateSnapshotScheduleCallable(Model::UpdateSnapshotScheduleRequest&& request) const;
+
         /**
          * <p>This operation updates a snapshot schedule configured for a gateway
          * volume.</p> <p>The default snapshot schedule for volume is once every 24 hours,
@@ -2298,6 +2881,11 @@ namespace Model
          */
         virtual void UpdateSnapshotScheduleAsync(const Model::UpdateSnapshotScheduleRequest& request, const UpdateSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateSnapshotScheduleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateSnapshotScheduleAsync(Model::UpdateSnapshotScheduleRequest&& request, const UpdateSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>This operation updates the type of medium changer in a gateway-VTL. When you
          * activate a gateway-VTL, you select a medium changer type for the gateway-VTL.
@@ -2316,6 +2904,11 @@ namespace Model
          */
         virtual Model::UpdateVTLDeviceTypeOutcomeCallable UpdateVTLDeviceTypeCallable(const Model::UpdateVTLDeviceTypeRequest& request) const;
 
+        /**
+         * Same as UpdateVTLDeviceTypeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateVTLDeviceTypeOutcomeCallable UpdateVTLDeviceTypeCallable(Model::UpdateVTLDeviceTypeRequest&& request) const;
+
         /**
          * <p>This operation updates the type of medium changer in a gateway-VTL. When you
          * activate a gateway-VTL, you select a medium changer type for the gateway-VTL.
@@ -2326,6 +2919,126 @@ namespace Model
          */
         virtual void UpdateVTLDeviceTypeAsync(const Model::UpdateVTLDeviceTypeRequest& request, const UpdateVTLDeviceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateVTLDeviceTypeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateVTLDeviceTypeAsync(Model::UpdateVTLDeviceTypeRequest&& request, const UpdateVTLDeviceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::ActivateGatewayOutcome> ActivateGatewayAwaitable(const Model::ActivateGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ActivateGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ActivateGatewayOutcome> ActivateGatewayAwaitable(Model::ActivateGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ActivateGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddCacheOutcome> AddCacheAwaitable(const Model::AddCacheRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::AddCache, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddCacheOutcome> AddCacheAwaitable(Model::AddCacheRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::AddCache, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(const Model::AddTagsToResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::AddTagsToResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddTagsToResourceOutcome> AddTagsToResourceAwaitable(Model::AddTagsToResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::AddTagsToResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddUploadBufferOutcome> AddUploadBufferAwaitable(const Model::AddUploadBufferRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::AddUploadBuffer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddUploadBufferOutcome> AddUploadBufferAwaitable(Model::AddUploadBufferRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::AddUploadBuffer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddWorkingStorageOutcome> AddWorkingStorageAwaitable(const Model::AddWorkingStorageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::AddWorkingStorage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddWorkingStorageOutcome> AddWorkingStorageAwaitable(Model::AddWorkingStorageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::AddWorkingStorage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelArchivalOutcome> CancelArchivalAwaitable(const Model::CancelArchivalRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CancelArchival, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelArchivalOutcome> CancelArchivalAwaitable(Model::CancelArchivalRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CancelArchival, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelRetrievalOutcome> CancelRetrievalAwaitable(const Model::CancelRetrievalRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CancelRetrieval, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CancelRetrievalOutcome> CancelRetrievalAwaitable(Model::CancelRetrievalRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CancelRetrieval, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCachediSCSIVolumeOutcome> CreateCachediSCSIVolumeAwaitable(const Model::CreateCachediSCSIVolumeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CreateCachediSCSIVolume, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCachediSCSIVolumeOutcome> CreateCachediSCSIVolumeAwaitable(Model::CreateCachediSCSIVolumeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CreateCachediSCSIVolume, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(const Model::CreateSnapshotRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CreateSnapshot, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSnapshotOutcome> CreateSnapshotAwaitable(Model::CreateSnapshotRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CreateSnapshot, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSnapshotFromVolumeRecoveryPointOutcome> CreateSnapshotFromVolumeRecoveryPointAwaitable(const Model::CreateSnapshotFromVolumeRecoveryPointRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPoint, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSnapshotFromVolumeRecoveryPointOutcome> CreateSnapshotFromVolumeRecoveryPointAwaitable(Model::CreateSnapshotFromVolumeRecoveryPointRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPoint, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateStorediSCSIVolumeOutcome> CreateStorediSCSIVolumeAwaitable(const Model::CreateStorediSCSIVolumeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CreateStorediSCSIVolume, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateStorediSCSIVolumeOutcome> CreateStorediSCSIVolumeAwaitable(Model::CreateStorediSCSIVolumeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CreateStorediSCSIVolume, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTapeWithBarcodeOutcome> CreateTapeWithBarcodeAwaitable(const Model::CreateTapeWithBarcodeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CreateTapeWithBarcode, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTapeWithBarcodeOutcome> CreateTapeWithBarcodeAwaitable(Model::CreateTapeWithBarcodeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CreateTapeWithBarcode, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTapesOutcome> CreateTapesAwaitable(const Model::CreateTapesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CreateTapes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateTapesOutcome> CreateTapesAwaitable(Model::CreateTapesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::CreateTapes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBandwidthRateLimitOutcome> DeleteBandwidthRateLimitAwaitable(const Model::DeleteBandwidthRateLimitRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DeleteBandwidthRateLimit, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteBandwidthRateLimitOutcome> DeleteBandwidthRateLimitAwaitable(Model::DeleteBandwidthRateLimitRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DeleteBandwidthRateLimit, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteChapCredentialsOutcome> DeleteChapCredentialsAwaitable(const Model::DeleteChapCredentialsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DeleteChapCredentials, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteChapCredentialsOutcome> DeleteChapCredentialsAwaitable(Model::DeleteChapCredentialsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DeleteChapCredentials, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteGatewayOutcome> DeleteGatewayAwaitable(const Model::DeleteGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DeleteGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteGatewayOutcome> DeleteGatewayAwaitable(Model::DeleteGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DeleteGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSnapshotScheduleOutcome> DeleteSnapshotScheduleAwaitable(const Model::DeleteSnapshotScheduleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DeleteSnapshotSchedule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSnapshotScheduleOutcome> DeleteSnapshotScheduleAwaitable(Model::DeleteSnapshotScheduleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DeleteSnapshotSchedule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTapeOutcome> DeleteTapeAwaitable(const Model::DeleteTapeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DeleteTape, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTapeOutcome> DeleteTapeAwaitable(Model::DeleteTapeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DeleteTape, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTapeArchiveOutcome> DeleteTapeArchiveAwaitable(const Model::DeleteTapeArchiveRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DeleteTapeArchive, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteTapeArchiveOutcome> DeleteTapeArchiveAwaitable(Model::DeleteTapeArchiveRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DeleteTapeArchive, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVolumeOutcome> DeleteVolumeAwaitable(const Model::DeleteVolumeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DeleteVolume, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteVolumeOutcome> DeleteVolumeAwaitable(Model::DeleteVolumeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DeleteVolume, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeBandwidthRateLimitOutcome> DescribeBandwidthRateLimitAwaitable(const Model::DescribeBandwidthRateLimitRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeBandwidthRateLimit, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeBandwidthRateLimitOutcome> DescribeBandwidthRateLimitAwaitable(Model::DescribeBandwidthRateLimitRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeBandwidthRateLimit, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCacheOutcome> DescribeCacheAwaitable(const Model::DescribeCacheRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeCache, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCacheOutcome> DescribeCacheAwaitable(Model::DescribeCacheRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeCache, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCachediSCSIVolumesOutcome> DescribeCachediSCSIVolumesAwaitable(const Model::DescribeCachediSCSIVolumesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeCachediSCSIVolumes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCachediSCSIVolumesOutcome> DescribeCachediSCSIVolumesAwaitable(Model::DescribeCachediSCSIVolumesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeCachediSCSIVolumes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeChapCredentialsOutcome> DescribeChapCredentialsAwaitable(const Model::DescribeChapCredentialsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeChapCredentials, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeChapCredentialsOutcome> DescribeChapCredentialsAwaitable(Model::DescribeChapCredentialsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeChapCredentials, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeGatewayInformationOutcome> DescribeGatewayInformationAwaitable(const Model::DescribeGatewayInformationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeGatewayInformation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeGatewayInformationOutcome> DescribeGatewayInformationAwaitable(Model::DescribeGatewayInformationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeGatewayInformation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMaintenanceStartTimeOutcome> DescribeMaintenanceStartTimeAwaitable(const Model::DescribeMaintenanceStartTimeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeMaintenanceStartTime, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeMaintenanceStartTimeOutcome> DescribeMaintenanceStartTimeAwaitable(Model::DescribeMaintenanceStartTimeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeMaintenanceStartTime, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSnapshotScheduleOutcome> DescribeSnapshotScheduleAwaitable(const Model::DescribeSnapshotScheduleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeSnapshotSchedule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSnapshotScheduleOutcome> DescribeSnapshotScheduleAwaitable(Model::DescribeSnapshotScheduleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeSnapshotSchedule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStorediSCSIVolumesOutcome> DescribeStorediSCSIVolumesAwaitable(const Model::DescribeStorediSCSIVolumesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeStorediSCSIVolumes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeStorediSCSIVolumesOutcome> DescribeStorediSCSIVolumesAwaitable(Model::DescribeStorediSCSIVolumesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeStorediSCSIVolumes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTapeArchivesOutcome> DescribeTapeArchivesAwaitable(const Model::DescribeTapeArchivesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeTapeArchives, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTapeArchivesOutcome> DescribeTapeArchivesAwaitable(Model::DescribeTapeArchivesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeTapeArchives, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTapeRecoveryPointsOutcome> DescribeTapeRecoveryPointsAwaitable(const Model::DescribeTapeRecoveryPointsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeTapeRecoveryPoints, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTapeRecoveryPointsOutcome> DescribeTapeRecoveryPointsAwaitable(Model::DescribeTapeRecoveryPointsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeTapeRecoveryPoints, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTapesOutcome> DescribeTapesAwaitable(const Model::DescribeTapesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeTapes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTapesOutcome> DescribeTapesAwaitable(Model::DescribeTapesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeTapes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeUploadBufferOutcome> DescribeUploadBufferAwaitable(const Model::DescribeUploadBufferRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeUploadBuffer, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeUploadBufferOutcome> DescribeUploadBufferAwaitable(Model::DescribeUploadBufferRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeUploadBuffer, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVTLDevicesOutcome> DescribeVTLDevicesAwaitable(const Model::DescribeVTLDevicesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeVTLDevices, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeVTLDevicesOutcome> DescribeVTLDevicesAwaitable(Model::DescribeVTLDevicesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeVTLDevices, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeWorkingStorageOutcome> DescribeWorkingStorageAwaitable(const Model::DescribeWorkingStorageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeWorkingStorage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeWorkingStorageOutcome> DescribeWorkingStorageAwaitable(Model::DescribeWorkingStorageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DescribeWorkingStorage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableGatewayOutcome> DisableGatewayAwaitable(const Model::DisableGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DisableGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DisableGatewayOutcome> DisableGatewayAwaitable(Model::DisableGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::DisableGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListGatewaysOutcome> ListGatewaysAwaitable(const Model::ListGatewaysRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ListGateways, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListGatewaysOutcome> ListGatewaysAwaitable(Model::ListGatewaysRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ListGateways, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListLocalDisksOutcome> ListLocalDisksAwaitable(const Model::ListLocalDisksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ListLocalDisks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListLocalDisksOutcome> ListLocalDisksAwaitable(Model::ListLocalDisksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ListLocalDisks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(const Model::ListTagsForResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ListTagsForResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListTagsForResourceOutcome> ListTagsForResourceAwaitable(Model::ListTagsForResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ListTagsForResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListVolumeInitiatorsOutcome> ListVolumeInitiatorsAwaitable(const Model::ListVolumeInitiatorsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ListVolumeInitiators, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListVolumeInitiatorsOutcome> ListVolumeInitiatorsAwaitable(Model::ListVolumeInitiatorsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ListVolumeInitiators, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListVolumeRecoveryPointsOutcome> ListVolumeRecoveryPointsAwaitable(const Model::ListVolumeRecoveryPointsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ListVolumeRecoveryPoints, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListVolumeRecoveryPointsOutcome> ListVolumeRecoveryPointsAwaitable(Model::ListVolumeRecoveryPointsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ListVolumeRecoveryPoints, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListVolumesOutcome> ListVolumesAwaitable(const Model::ListVolumesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ListVolumes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListVolumesOutcome> ListVolumesAwaitable(Model::ListVolumesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ListVolumes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(const Model::RemoveTagsFromResourceRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::RemoveTagsFromResource, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RemoveTagsFromResourceOutcome> RemoveTagsFromResourceAwaitable(Model::RemoveTagsFromResourceRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::RemoveTagsFromResource, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetCacheOutcome> ResetCacheAwaitable(const Model::ResetCacheRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ResetCache, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResetCacheOutcome> ResetCacheAwaitable(Model::ResetCacheRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ResetCache, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RetrieveTapeArchiveOutcome> RetrieveTapeArchiveAwaitable(const Model::RetrieveTapeArchiveRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::RetrieveTapeArchive, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RetrieveTapeArchiveOutcome> RetrieveTapeArchiveAwaitable(Model::RetrieveTapeArchiveRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::RetrieveTapeArchive, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RetrieveTapeRecoveryPointOutcome> RetrieveTapeRecoveryPointAwaitable(const Model::RetrieveTapeRecoveryPointRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::RetrieveTapeRecoveryPoint, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RetrieveTapeRecoveryPointOutcome> RetrieveTapeRecoveryPointAwaitable(Model::RetrieveTapeRecoveryPointRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::RetrieveTapeRecoveryPoint, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ShutdownGatewayOutcome> ShutdownGatewayAwaitable(const Model::ShutdownGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ShutdownGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ShutdownGatewayOutcome> ShutdownGatewayAwaitable(Model::ShutdownGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::ShutdownGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartGatewayOutcome> StartGatewayAwaitable(const Model::StartGatewayRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::StartGateway, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartGatewayOutcome> StartGatewayAwaitable(Model::StartGatewayRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::StartGateway, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateBandwidthRateLimitOutcome> UpdateBandwidthRateLimitAwaitable(const Model::UpdateBandwidthRateLimitRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::UpdateBandwidthRateLimit, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateBandwidthRateLimitOutcome> UpdateBandwidthRateLimitAwaitable(Model::UpdateBandwidthRateLimitRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::UpdateBandwidthRateLimit, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateChapCredentialsOutcome> UpdateChapCredentialsAwaitable(const Model::UpdateChapCredentialsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::UpdateChapCredentials, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateChapCredentialsOutcome> UpdateChapCredentialsAwaitable(Model::UpdateChapCredentialsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::UpdateChapCredentials, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateGatewayInformationOutcome> UpdateGatewayInformationAwaitable(const Model::UpdateGatewayInformationRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::UpdateGatewayInformation, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateGatewayInformationOutcome> UpdateGatewayInformationAwaitable(Model::UpdateGatewayInformationRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::UpdateGatewayInformation, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateGatewaySoftwareNowOutcome> UpdateGatewaySoftwareNowAwaitable(const Model::UpdateGatewaySoftwareNowRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::UpdateGatewaySoftwareNow, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateGatewaySoftwareNowOutcome> UpdateGatewaySoftwareNowAwaitable(Model::UpdateGatewaySoftwareNowRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::UpdateGatewaySoftwareNow, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateMaintenanceStartTimeOutcome> UpdateMaintenanceStartTimeAwaitable(const Model::UpdateMaintenanceStartTimeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::UpdateMaintenanceStartTime, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateMaintenanceStartTimeOutcome> UpdateMaintenanceStartTimeAwaitable(Model::UpdateMaintenanceStartTimeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::UpdateMaintenanceStartTime, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateSnapshotScheduleOutcome> UpdateSnapshotScheduleAwaitable(const Model::UpdateSnapshotScheduleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::UpdateSnapshotSchedule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateSnapshotScheduleOutcome> UpdateSnapshotScheduleAwaitable(Model::UpdateSnapshotScheduleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::UpdateSnapshotSchedule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateVTLDeviceTypeOutcome> UpdateVTLDeviceTypeAwaitable(const Model::UpdateVTLDeviceTypeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::UpdateVTLDeviceType, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateVTLDeviceTypeOutcome> UpdateVTLDeviceTypeAwaitable(Model::UpdateVTLDeviceTypeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &StorageGatewayClient::UpdateVTLDeviceType, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
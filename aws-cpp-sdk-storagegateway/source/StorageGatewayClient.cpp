@@ -161,12 +161,22 @@ ActivateGatewayOutcome StorageGatewayClient::ActivateGateway(const ActivateGatew
 
 ActivateGatewayOutcomeCallable StorageGatewayClient::ActivateGatewayCallable(const ActivateGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::ActivateGateway, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ActivateGateway, Aws::Client::RejectedCallOutcome<ActivateGatewayOutcome>(), this, request);
+}
+
+ActivateGatewayOutcomeCallable StorageGatewayClient::ActivateGatewayCallable(ActivateGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ActivateGateway, Aws::Client::RejectedCallOutcome<ActivateGatewayOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::ActivateGatewayAsync(const ActivateGatewayRequest& request, const ActivateGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::ActivateGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::ActivateGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<ActivateGatewayOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::ActivateGatewayAsync(ActivateGatewayRequest&& request, const ActivateGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::ActivateGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<ActivateGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::ActivateGatewayAsyncHelper(const ActivateGatewayRequest& request, const ActivateGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -192,12 +202,22 @@ AddCacheOutcome StorageGatewayClient::AddCache(const AddCacheRequest& request) c
 
 AddCacheOutcomeCallable StorageGatewayClient::AddCacheCallable(const AddCacheRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::AddCache, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::AddCache, Aws::Client::RejectedCallOutcome<AddCacheOutcome>(), this, request);
+}
+
+AddCacheOutcomeCallable StorageGatewayClient::AddCacheCallable(AddCacheRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::AddCache, Aws::Client::RejectedCallOutcome<AddCacheOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::AddCacheAsync(const AddCacheRequest& request, const AddCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::AddCacheAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::AddCacheAsyncHelper, Aws::Client::RejectedAsyncCall<AddCacheOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::AddCacheAsync(AddCacheRequest&& request, const AddCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::AddCacheAsyncHelper, Aws::Client::RejectedAsyncCall<AddCacheOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::AddCacheAsyncHelper(const AddCacheRequest& request, const AddCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -223,12 +243,22 @@ AddTagsToResourceOutcome StorageGatewayClient::AddTagsToResource(const AddTagsTo
 
 AddTagsToResourceOutcomeCallable StorageGatewayClient::AddTagsToResourceCallable(const AddTagsToResourceRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::AddTagsToResource, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::AddTagsToResource, Aws::Client::RejectedCallOutcome<AddTagsToResourceOutcome>(), this, request);
+}
+
+AddTagsToResourceOutcomeCallable StorageGatewayClient::AddTagsToResourceCallable(AddTagsToResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::AddTagsToResource, Aws::Client::RejectedCallOutcome<AddTagsToResourceOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::AddTagsToResourceAsync(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::AddTagsToResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::AddTagsToResourceAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsToResourceOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::AddTagsToResourceAsync(AddTagsToResourceRequest&& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::AddTagsToResourceAsyncHelper, Aws::Client::RejectedAsyncCall<AddTagsToResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::AddTagsToResourceAsyncHelper(const AddTagsToResourceRequest& request, const AddTagsToResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -254,12 +284,22 @@ AddUploadBufferOutcome StorageGatewayClient::AddUploadBuffer(const AddUploadBuff
 
 AddUploadBufferOutcomeCallable StorageGatewayClient::AddUploadBufferCallable(const AddUploadBufferRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::AddUploadBuffer, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::AddUploadBuffer, Aws::Client::RejectedCallOutcome<AddUploadBufferOutcome>(), this, request);
+}
+
+AddUploadBufferOutcomeCallable StorageGatewayClient::AddUploadBufferCallable(AddUploadBufferRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::AddUploadBuffer, Aws::Client::RejectedCallOutcome<AddUploadBufferOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::AddUploadBufferAsync(const AddUploadBufferRequest& request, const AddUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::AddUploadBufferAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::AddUploadBufferAsyncHelper, Aws::Client::RejectedAsyncCall<AddUploadBufferOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::AddUploadBufferAsync(AddUploadBufferRequest&& request, const AddUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::AddUploadBufferAsyncHelper, Aws::Client::RejectedAsyncCall<AddUploadBufferOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::AddUploadBufferAsyncHelper(const AddUploadBufferRequest& request, const AddUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -285,12 +325,22 @@ AddWorkingStorageOutcome StorageGatewayClient::AddWorkingStorage(const AddWorkin
 
 AddWorkingStorageOutcomeCallable StorageGatewayClient::AddWorkingStorageCallable(const AddWorkingStorageRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::AddWorkingStorage, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::AddWorkingStorage, Aws::Client::RejectedCallOutcome<AddWorkingStorageOutcome>(), this, request);
+}
+
+AddWorkingStorageOutcomeCallable StorageGatewayClient::AddWorkingStorageCallable(AddWorkingStorageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::AddWorkingStorage, Aws::Client::RejectedCallOutcome<AddWorkingStorageOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::AddWorkingStorageAsync(const AddWorkingStorageRequest& request, const AddWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::AddWorkingStorageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::AddWorkingStorageAsyncHelper, Aws::Client::RejectedAsyncCall<AddWorkingStorageOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::AddWorkingStorageAsync(AddWorkingStorageRequest&& request, const AddWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::AddWorkingStorageAsyncHelper, Aws::Client::RejectedAsyncCall<AddWorkingStorageOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::AddWorkingStorageAsyncHelper(const AddWorkingStorageRequest& request, const AddWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -316,12 +366,22 @@ CancelArchivalOutcome StorageGatewayClient::CancelArchival(const CancelArchivalR
 
 CancelArchivalOutcomeCallable StorageGatewayClient::CancelArchivalCallable(const CancelArchivalRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::CancelArchival, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CancelArchival, Aws::Client::RejectedCallOutcome<CancelArchivalOutcome>(), this, request);
+}
+
+CancelArchivalOutcomeCallable StorageGatewayClient::CancelArchivalCallable(CancelArchivalRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CancelArchival, Aws::Client::RejectedCallOutcome<CancelArchivalOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::CancelArchivalAsync(const CancelArchivalRequest& request, const CancelArchivalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::CancelArchivalAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::CancelArchivalAsyncHelper, Aws::Client::RejectedAsyncCall<CancelArchivalOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::CancelArchivalAsync(CancelArchivalRequest&& request, const CancelArchivalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::CancelArchivalAsyncHelper, Aws::Client::RejectedAsyncCall<CancelArchivalOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::CancelArchivalAsyncHelper(const CancelArchivalRequest& request, const CancelArchivalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -347,12 +407,22 @@ CancelRetrievalOutcome StorageGatewayClient::CancelRetrieval(const CancelRetriev
 
 CancelRetrievalOutcomeCallable StorageGatewayClient::CancelRetrievalCallable(const CancelRetrievalRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::CancelRetrieval, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CancelRetrieval, Aws::Client::RejectedCallOutcome<CancelRetrievalOutcome>(), this, request);
+}
+
+CancelRetrievalOutcomeCallable StorageGatewayClient::CancelRetrievalCallable(CancelRetrievalRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CancelRetrieval, Aws::Client::RejectedCallOutcome<CancelRetrievalOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::CancelRetrievalAsync(const CancelRetrievalRequest& request, const CancelRetrievalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::CancelRetrievalAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::CancelRetrievalAsyncHelper, Aws::Client::RejectedAsyncCall<CancelRetrievalOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::CancelRetrievalAsync(CancelRetrievalRequest&& request, const CancelRetrievalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::CancelRetrievalAsyncHelper, Aws::Client::RejectedAsyncCall<CancelRetrievalOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::CancelRetrievalAsyncHelper(const CancelRetrievalRequest& request, const CancelRetrievalResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -378,12 +448,22 @@ CreateCachediSCSIVolumeOutcome StorageGatewayClient::CreateCachediSCSIVolume(con
 
 CreateCachediSCSIVolumeOutcomeCallable StorageGatewayClient::CreateCachediSCSIVolumeCallable(const CreateCachediSCSIVolumeRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::CreateCachediSCSIVolume, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CreateCachediSCSIVolume, Aws::Client::RejectedCallOutcome<CreateCachediSCSIVolumeOutcome>(), this, request);
+}
+
+CreateCachediSCSIVolumeOutcomeCallable StorageGatewayClient::CreateCachediSCSIVolumeCallable(CreateCachediSCSIVolumeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CreateCachediSCSIVolume, Aws::Client::RejectedCallOutcome<CreateCachediSCSIVolumeOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::CreateCachediSCSIVolumeAsync(const CreateCachediSCSIVolumeRequest& request, const CreateCachediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::CreateCachediSCSIVolumeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::CreateCachediSCSIVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCachediSCSIVolumeOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::CreateCachediSCSIVolumeAsync(CreateCachediSCSIVolumeRequest&& request, const CreateCachediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::CreateCachediSCSIVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCachediSCSIVolumeOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::CreateCachediSCSIVolumeAsyncHelper(const CreateCachediSCSIVolumeRequest& request, const CreateCachediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -409,12 +489,22 @@ CreateSnapshotOutcome StorageGatewayClient::CreateSnapshot(const CreateSnapshotR
 
 CreateSnapshotOutcomeCallable StorageGatewayClient::CreateSnapshotCallable(const CreateSnapshotRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::CreateSnapshot, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CreateSnapshot, Aws::Client::RejectedCallOutcome<CreateSnapshotOutcome>(), this, request);
+}
+
+CreateSnapshotOutcomeCallable StorageGatewayClient::CreateSnapshotCallable(CreateSnapshotRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CreateSnapshot, Aws::Client::RejectedCallOutcome<CreateSnapshotOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::CreateSnapshotAsync(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::CreateSnapshotAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::CreateSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSnapshotOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::CreateSnapshotAsync(CreateSnapshotRequest&& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::CreateSnapshotAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSnapshotOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::CreateSnapshotAsyncHelper(const CreateSnapshotRequest& request, const CreateSnapshotResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -440,12 +530,22 @@ CreateSnapshotFromVolumeRecoveryPointOutcome StorageGatewayClient::CreateSnapsho
 
 CreateSnapshotFromVolumeRecoveryPointOutcomeCallable StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointCallable(const CreateSnapshotFromVolumeRecoveryPointRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPoint, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPoint, Aws::Client::RejectedCallOutcome<CreateSnapshotFromVolumeRecoveryPointOutcome>(), this, request);
+}
+
+CreateSnapshotFromVolumeRecoveryPointOutcomeCallable StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointCallable(CreateSnapshotFromVolumeRecoveryPointRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPoint, Aws::Client::RejectedCallOutcome<CreateSnapshotFromVolumeRecoveryPointOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointAsync(const CreateSnapshotFromVolumeRecoveryPointRequest& request, const CreateSnapshotFromVolumeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSnapshotFromVolumeRecoveryPointOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointAsync(CreateSnapshotFromVolumeRecoveryPointRequest&& request, const CreateSnapshotFromVolumeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSnapshotFromVolumeRecoveryPointOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::CreateSnapshotFromVolumeRecoveryPointAsyncHelper(const CreateSnapshotFromVolumeRecoveryPointRequest& request, const CreateSnapshotFromVolumeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -471,12 +571,22 @@ CreateStorediSCSIVolumeOutcome StorageGatewayClient::CreateStorediSCSIVolume(con
 
 CreateStorediSCSIVolumeOutcomeCallable StorageGatewayClient::CreateStorediSCSIVolumeCallable(const CreateStorediSCSIVolumeRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::CreateStorediSCSIVolume, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CreateStorediSCSIVolume, Aws::Client::RejectedCallOutcome<CreateStorediSCSIVolumeOutcome>(), this, request);
+}
+
+CreateStorediSCSIVolumeOutcomeCallable StorageGatewayClient::CreateStorediSCSIVolumeCallable(CreateStorediSCSIVolumeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CreateStorediSCSIVolume, Aws::Client::RejectedCallOutcome<CreateStorediSCSIVolumeOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::CreateStorediSCSIVolumeAsync(const CreateStorediSCSIVolumeRequest& request, const CreateStorediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::CreateStorediSCSIVolumeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::CreateStorediSCSIVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<CreateStorediSCSIVolumeOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::CreateStorediSCSIVolumeAsync(CreateStorediSCSIVolumeRequest&& request, const CreateStorediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::CreateStorediSCSIVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<CreateStorediSCSIVolumeOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::CreateStorediSCSIVolumeAsyncHelper(const CreateStorediSCSIVolumeRequest& request, const CreateStorediSCSIVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -502,12 +612,22 @@ CreateTapeWithBarcodeOutcome StorageGatewayClient::CreateTapeWithBarcode(const C
 
 CreateTapeWithBarcodeOutcomeCallable StorageGatewayClient::CreateTapeWithBarcodeCallable(const CreateTapeWithBarcodeRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::CreateTapeWithBarcode, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CreateTapeWithBarcode, Aws::Client::RejectedCallOutcome<CreateTapeWithBarcodeOutcome>(), this, request);
+}
+
+CreateTapeWithBarcodeOutcomeCallable StorageGatewayClient::CreateTapeWithBarcodeCallable(CreateTapeWithBarcodeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CreateTapeWithBarcode, Aws::Client::RejectedCallOutcome<CreateTapeWithBarcodeOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::CreateTapeWithBarcodeAsync(const CreateTapeWithBarcodeRequest& request, const CreateTapeWithBarcodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::CreateTapeWithBarcodeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::CreateTapeWithBarcodeAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTapeWithBarcodeOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::CreateTapeWithBarcodeAsync(CreateTapeWithBarcodeRequest&& request, const CreateTapeWithBarcodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::CreateTapeWithBarcodeAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTapeWithBarcodeOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::CreateTapeWithBarcodeAsyncHelper(const CreateTapeWithBarcodeRequest& request, const CreateTapeWithBarcodeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -533,12 +653,22 @@ CreateTapesOutcome StorageGatewayClient::CreateTapes(const CreateTapesRequest& r
 
 CreateTapesOutcomeCallable StorageGatewayClient::CreateTapesCallable(const CreateTapesRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::CreateTapes, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CreateTapes, Aws::Client::RejectedCallOutcome<CreateTapesOutcome>(), this, request);
+}
+
+CreateTapesOutcomeCallable StorageGatewayClient::CreateTapesCallable(CreateTapesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::CreateTapes, Aws::Client::RejectedCallOutcome<CreateTapesOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::CreateTapesAsync(const CreateTapesRequest& request, const CreateTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::CreateTapesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::CreateTapesAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTapesOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::CreateTapesAsync(CreateTapesRequest&& request, const CreateTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::CreateTapesAsyncHelper, Aws::Client::RejectedAsyncCall<CreateTapesOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::CreateTapesAsyncHelper(const CreateTapesRequest& request, const CreateTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -564,12 +694,22 @@ DeleteBandwidthRateLimitOutcome StorageGatewayClient::DeleteBandwidthRateLimit(c
 
 DeleteBandwidthRateLimitOutcomeCallable StorageGatewayClient::DeleteBandwidthRateLimitCallable(const DeleteBandwidthRateLimitRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DeleteBandwidthRateLimit, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DeleteBandwidthRateLimit, Aws::Client::RejectedCallOutcome<DeleteBandwidthRateLimitOutcome>(), this, request);
+}
+
+DeleteBandwidthRateLimitOutcomeCallable StorageGatewayClient::DeleteBandwidthRateLimitCallable(DeleteBandwidthRateLimitRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DeleteBandwidthRateLimit, Aws::Client::RejectedCallOutcome<DeleteBandwidthRateLimitOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DeleteBandwidthRateLimitAsync(const DeleteBandwidthRateLimitRequest& request, const DeleteBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DeleteBandwidthRateLimitAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DeleteBandwidthRateLimitAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBandwidthRateLimitOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DeleteBandwidthRateLimitAsync(DeleteBandwidthRateLimitRequest&& request, const DeleteBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DeleteBandwidthRateLimitAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteBandwidthRateLimitOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DeleteBandwidthRateLimitAsyncHelper(const DeleteBandwidthRateLimitRequest& request, const DeleteBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -595,12 +735,22 @@ DeleteChapCredentialsOutcome StorageGatewayClient::DeleteChapCredentials(const D
 
 DeleteChapCredentialsOutcomeCallable StorageGatewayClient::DeleteChapCredentialsCallable(const DeleteChapCredentialsRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DeleteChapCredentials, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DeleteChapCredentials, Aws::Client::RejectedCallOutcome<DeleteChapCredentialsOutcome>(), this, request);
+}
+
+DeleteChapCredentialsOutcomeCallable StorageGatewayClient::DeleteChapCredentialsCallable(DeleteChapCredentialsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DeleteChapCredentials, Aws::Client::RejectedCallOutcome<DeleteChapCredentialsOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DeleteChapCredentialsAsync(const DeleteChapCredentialsRequest& request, const DeleteChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DeleteChapCredentialsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DeleteChapCredentialsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteChapCredentialsOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DeleteChapCredentialsAsync(DeleteChapCredentialsRequest&& request, const DeleteChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DeleteChapCredentialsAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteChapCredentialsOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DeleteChapCredentialsAsyncHelper(const DeleteChapCredentialsRequest& request, const DeleteChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -626,12 +776,22 @@ DeleteGatewayOutcome StorageGatewayClient::DeleteGateway(const DeleteGatewayRequ
 
 DeleteGatewayOutcomeCallable StorageGatewayClient::DeleteGatewayCallable(const DeleteGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DeleteGateway, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DeleteGateway, Aws::Client::RejectedCallOutcome<DeleteGatewayOutcome>(), this, request);
+}
+
+DeleteGatewayOutcomeCallable StorageGatewayClient::DeleteGatewayCallable(DeleteGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DeleteGateway, Aws::Client::RejectedCallOutcome<DeleteGatewayOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DeleteGatewayAsync(const DeleteGatewayRequest& request, const DeleteGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DeleteGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DeleteGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteGatewayOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DeleteGatewayAsync(DeleteGatewayRequest&& request, const DeleteGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DeleteGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DeleteGatewayAsyncHelper(const DeleteGatewayRequest& request, const DeleteGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -657,12 +817,22 @@ DeleteSnapshotScheduleOutcome StorageGatewayClient::DeleteSnapshotSchedule(const
 
 DeleteSnapshotScheduleOutcomeCallable StorageGatewayClient::DeleteSnapshotScheduleCallable(const DeleteSnapshotScheduleRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DeleteSnapshotSchedule, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DeleteSnapshotSchedule, Aws::Client::RejectedCallOutcome<DeleteSnapshotScheduleOutcome>(), this, request);
+}
+
+DeleteSnapshotScheduleOutcomeCallable StorageGatewayClient::DeleteSnapshotScheduleCallable(DeleteSnapshotScheduleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DeleteSnapshotSchedule, Aws::Client::RejectedCallOutcome<DeleteSnapshotScheduleOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DeleteSnapshotScheduleAsync(const DeleteSnapshotScheduleRequest& request, const DeleteSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DeleteSnapshotScheduleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DeleteSnapshotScheduleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSnapshotScheduleOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DeleteSnapshotScheduleAsync(DeleteSnapshotScheduleRequest&& request, const DeleteSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DeleteSnapshotScheduleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSnapshotScheduleOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DeleteSnapshotScheduleAsyncHelper(const DeleteSnapshotScheduleRequest& request, const DeleteSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -688,12 +858,22 @@ DeleteTapeOutcome StorageGatewayClient::DeleteTape(const DeleteTapeRequest& requ
 
 DeleteTapeOutcomeCallable StorageGatewayClient::DeleteTapeCallable(const DeleteTapeRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DeleteTape, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DeleteTape, Aws::Client::RejectedCallOutcome<DeleteTapeOutcome>(), this, request);
+}
+
+DeleteTapeOutcomeCallable StorageGatewayClient::DeleteTapeCallable(DeleteTapeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DeleteTape, Aws::Client::RejectedCallOutcome<DeleteTapeOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DeleteTapeAsync(const DeleteTapeRequest& request, const DeleteTapeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DeleteTapeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DeleteTapeAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTapeOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DeleteTapeAsync(DeleteTapeRequest&& request, const DeleteTapeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DeleteTapeAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTapeOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DeleteTapeAsyncHelper(const DeleteTapeRequest& request, const DeleteTapeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -719,12 +899,22 @@ DeleteTapeArchiveOutcome StorageGatewayClient::DeleteTapeArchive(const DeleteTap
 
 DeleteTapeArchiveOutcomeCallable StorageGatewayClient::DeleteTapeArchiveCallable(const DeleteTapeArchiveRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DeleteTapeArchive, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DeleteTapeArchive, Aws::Client::RejectedCallOutcome<DeleteTapeArchiveOutcome>(), this, request);
+}
+
+DeleteTapeArchiveOutcomeCallable StorageGatewayClient::DeleteTapeArchiveCallable(DeleteTapeArchiveRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DeleteTapeArchive, Aws::Client::RejectedCallOutcome<DeleteTapeArchiveOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DeleteTapeArchiveAsync(const DeleteTapeArchiveRequest& request, const DeleteTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DeleteTapeArchiveAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DeleteTapeArchiveAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTapeArchiveOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DeleteTapeArchiveAsync(DeleteTapeArchiveRequest&& request, const DeleteTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DeleteTapeArchiveAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteTapeArchiveOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DeleteTapeArchiveAsyncHelper(const DeleteTapeArchiveRequest& request, const DeleteTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -750,12 +940,22 @@ DeleteVolumeOutcome StorageGatewayClient::DeleteVolume(const DeleteVolumeRequest
 
 DeleteVolumeOutcomeCallable StorageGatewayClient::DeleteVolumeCallable(const DeleteVolumeRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DeleteVolume, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DeleteVolume, Aws::Client::RejectedCallOutcome<DeleteVolumeOutcome>(), this, request);
+}
+
+DeleteVolumeOutcomeCallable StorageGatewayClient::DeleteVolumeCallable(DeleteVolumeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DeleteVolume, Aws::Client::RejectedCallOutcome<DeleteVolumeOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DeleteVolumeAsync(const DeleteVolumeRequest& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DeleteVolumeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DeleteVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVolumeOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DeleteVolumeAsync(DeleteVolumeRequest&& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DeleteVolumeAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteVolumeOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DeleteVolumeAsyncHelper(const DeleteVolumeRequest& request, const DeleteVolumeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -781,12 +981,22 @@ DescribeBandwidthRateLimitOutcome StorageGatewayClient::DescribeBandwidthRateLim
 
 DescribeBandwidthRateLimitOutcomeCallable StorageGatewayClient::DescribeBandwidthRateLimitCallable(const DescribeBandwidthRateLimitRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DescribeBandwidthRateLimit, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeBandwidthRateLimit, Aws::Client::RejectedCallOutcome<DescribeBandwidthRateLimitOutcome>(), this, request);
+}
+
+DescribeBandwidthRateLimitOutcomeCallable StorageGatewayClient::DescribeBandwidthRateLimitCallable(DescribeBandwidthRateLimitRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeBandwidthRateLimit, Aws::Client::RejectedCallOutcome<DescribeBandwidthRateLimitOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DescribeBandwidthRateLimitAsync(const DescribeBandwidthRateLimitRequest& request, const DescribeBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DescribeBandwidthRateLimitAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeBandwidthRateLimitAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeBandwidthRateLimitOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DescribeBandwidthRateLimitAsync(DescribeBandwidthRateLimitRequest&& request, const DescribeBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeBandwidthRateLimitAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeBandwidthRateLimitOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DescribeBandwidthRateLimitAsyncHelper(const DescribeBandwidthRateLimitRequest& request, const DescribeBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -812,12 +1022,22 @@ DescribeCacheOutcome StorageGatewayClient::DescribeCache(const DescribeCacheRequ
 
 DescribeCacheOutcomeCallable StorageGatewayClient::DescribeCacheCallable(const DescribeCacheRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DescribeCache, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeCache, Aws::Client::RejectedCallOutcome<DescribeCacheOutcome>(), this, request);
+}
+
+DescribeCacheOutcomeCallable StorageGatewayClient::DescribeCacheCallable(DescribeCacheRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeCache, Aws::Client::RejectedCallOutcome<DescribeCacheOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DescribeCacheAsync(const DescribeCacheRequest& request, const DescribeCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DescribeCacheAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeCacheAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCacheOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DescribeCacheAsync(DescribeCacheRequest&& request, const DescribeCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeCacheAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCacheOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DescribeCacheAsyncHelper(const DescribeCacheRequest& request, const DescribeCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -843,12 +1063,22 @@ DescribeCachediSCSIVolumesOutcome StorageGatewayClient::DescribeCachediSCSIVolum
 
 DescribeCachediSCSIVolumesOutcomeCallable StorageGatewayClient::DescribeCachediSCSIVolumesCallable(const DescribeCachediSCSIVolumesRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DescribeCachediSCSIVolumes, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeCachediSCSIVolumes, Aws::Client::RejectedCallOutcome<DescribeCachediSCSIVolumesOutcome>(), this, request);
+}
+
+DescribeCachediSCSIVolumesOutcomeCallable StorageGatewayClient::DescribeCachediSCSIVolumesCallable(DescribeCachediSCSIVolumesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeCachediSCSIVolumes, Aws::Client::RejectedCallOutcome<DescribeCachediSCSIVolumesOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DescribeCachediSCSIVolumesAsync(const DescribeCachediSCSIVolumesRequest& request, const DescribeCachediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DescribeCachediSCSIVolumesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeCachediSCSIVolumesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCachediSCSIVolumesOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DescribeCachediSCSIVolumesAsync(DescribeCachediSCSIVolumesRequest&& request, const DescribeCachediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeCachediSCSIVolumesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCachediSCSIVolumesOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DescribeCachediSCSIVolumesAsyncHelper(const DescribeCachediSCSIVolumesRequest& request, const DescribeCachediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -874,12 +1104,22 @@ DescribeChapCredentialsOutcome StorageGatewayClient::DescribeChapCredentials(con
 
 DescribeChapCredentialsOutcomeCallable StorageGatewayClient::DescribeChapCredentialsCallable(const DescribeChapCredentialsRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DescribeChapCredentials, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeChapCredentials, Aws::Client::RejectedCallOutcome<DescribeChapCredentialsOutcome>(), this, request);
+}
+
+DescribeChapCredentialsOutcomeCallable StorageGatewayClient::DescribeChapCredentialsCallable(DescribeChapCredentialsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeChapCredentials, Aws::Client::RejectedCallOutcome<DescribeChapCredentialsOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DescribeChapCredentialsAsync(const DescribeChapCredentialsRequest& request, const DescribeChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DescribeChapCredentialsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeChapCredentialsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeChapCredentialsOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DescribeChapCredentialsAsync(DescribeChapCredentialsRequest&& request, const DescribeChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeChapCredentialsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeChapCredentialsOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DescribeChapCredentialsAsyncHelper(const DescribeChapCredentialsRequest& request, const DescribeChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -905,12 +1145,22 @@ DescribeGatewayInformationOutcome StorageGatewayClient::DescribeGatewayInformati
 
 DescribeGatewayInformationOutcomeCallable StorageGatewayClient::DescribeGatewayInformationCallable(const DescribeGatewayInformationRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DescribeGatewayInformation, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeGatewayInformation, Aws::Client::RejectedCallOutcome<DescribeGatewayInformationOutcome>(), this, request);
+}
+
+DescribeGatewayInformationOutcomeCallable StorageGatewayClient::DescribeGatewayInformationCallable(DescribeGatewayInformationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeGatewayInformation, Aws::Client::RejectedCallOutcome<DescribeGatewayInformationOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DescribeGatewayInformationAsync(const DescribeGatewayInformationRequest& request, const DescribeGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DescribeGatewayInformationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeGatewayInformationAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeGatewayInformationOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DescribeGatewayInformationAsync(DescribeGatewayInformationRequest&& request, const DescribeGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeGatewayInformationAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeGatewayInformationOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DescribeGatewayInformationAsyncHelper(const DescribeGatewayInformationRequest& request, const DescribeGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -936,12 +1186,22 @@ DescribeMaintenanceStartTimeOutcome StorageGatewayClient::DescribeMaintenanceSta
 
 DescribeMaintenanceStartTimeOutcomeCallable StorageGatewayClient::DescribeMaintenanceStartTimeCallable(const DescribeMaintenanceStartTimeRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DescribeMaintenanceStartTime, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeMaintenanceStartTime, Aws::Client::RejectedCallOutcome<DescribeMaintenanceStartTimeOutcome>(), this, request);
+}
+
+DescribeMaintenanceStartTimeOutcomeCallable StorageGatewayClient::DescribeMaintenanceStartTimeCallable(DescribeMaintenanceStartTimeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeMaintenanceStartTime, Aws::Client::RejectedCallOutcome<DescribeMaintenanceStartTimeOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DescribeMaintenanceStartTimeAsync(const DescribeMaintenanceStartTimeRequest& request, const DescribeMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DescribeMaintenanceStartTimeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeMaintenanceStartTimeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMaintenanceStartTimeOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DescribeMaintenanceStartTimeAsync(DescribeMaintenanceStartTimeRequest&& request, const DescribeMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeMaintenanceStartTimeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeMaintenanceStartTimeOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DescribeMaintenanceStartTimeAsyncHelper(const DescribeMaintenanceStartTimeRequest& request, const DescribeMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -967,12 +1227,22 @@ DescribeSnapshotScheduleOutcome StorageGatewayClient::DescribeSnapshotSchedule(c
 
 DescribeSnapshotScheduleOutcomeCallable StorageGatewayClient::DescribeSnapshotScheduleCallable(const DescribeSnapshotScheduleRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DescribeSnapshotSchedule, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeSnapshotSchedule, Aws::Client::RejectedCallOutcome<DescribeSnapshotScheduleOutcome>(), this, request);
+}
+
+DescribeSnapshotScheduleOutcomeCallable StorageGatewayClient::DescribeSnapshotScheduleCallable(DescribeSnapshotScheduleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeSnapshotSchedule, Aws::Client::RejectedCallOutcome<DescribeSnapshotScheduleOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DescribeSnapshotScheduleAsync(const DescribeSnapshotScheduleRequest& request, const DescribeSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DescribeSnapshotScheduleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeSnapshotScheduleAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSnapshotScheduleOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DescribeSnapshotScheduleAsync(DescribeSnapshotScheduleRequest&& request, const DescribeSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeSnapshotScheduleAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSnapshotScheduleOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DescribeSnapshotScheduleAsyncHelper(const DescribeSnapshotScheduleRequest& request, const DescribeSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -998,12 +1268,22 @@ DescribeStorediSCSIVolumesOutcome StorageGatewayClient::DescribeStorediSCSIVolum
 
 DescribeStorediSCSIVolumesOutcomeCallable StorageGatewayClient::DescribeStorediSCSIVolumesCallable(const DescribeStorediSCSIVolumesRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DescribeStorediSCSIVolumes, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeStorediSCSIVolumes, Aws::Client::RejectedCallOutcome<DescribeStorediSCSIVolumesOutcome>(), this, request);
+}
+
+DescribeStorediSCSIVolumesOutcomeCallable StorageGatewayClient::DescribeStorediSCSIVolumesCallable(DescribeStorediSCSIVolumesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeStorediSCSIVolumes, Aws::Client::RejectedCallOutcome<DescribeStorediSCSIVolumesOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DescribeStorediSCSIVolumesAsync(const DescribeStorediSCSIVolumesRequest& request, const DescribeStorediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DescribeStorediSCSIVolumesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeStorediSCSIVolumesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStorediSCSIVolumesOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DescribeStorediSCSIVolumesAsync(DescribeStorediSCSIVolumesRequest&& request, const DescribeStorediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeStorediSCSIVolumesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeStorediSCSIVolumesOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DescribeStorediSCSIVolumesAsyncHelper(const DescribeStorediSCSIVolumesRequest& request, const DescribeStorediSCSIVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1029,12 +1309,22 @@ DescribeTapeArchivesOutcome StorageGatewayClient::DescribeTapeArchives(const Des
 
 DescribeTapeArchivesOutcomeCallable StorageGatewayClient::DescribeTapeArchivesCallable(const DescribeTapeArchivesRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DescribeTapeArchives, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeTapeArchives, Aws::Client::RejectedCallOutcome<DescribeTapeArchivesOutcome>(), this, request);
+}
+
+DescribeTapeArchivesOutcomeCallable StorageGatewayClient::DescribeTapeArchivesCallable(DescribeTapeArchivesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeTapeArchives, Aws::Client::RejectedCallOutcome<DescribeTapeArchivesOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DescribeTapeArchivesAsync(const DescribeTapeArchivesRequest& request, const DescribeTapeArchivesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DescribeTapeArchivesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeTapeArchivesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTapeArchivesOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DescribeTapeArchivesAsync(DescribeTapeArchivesRequest&& request, const DescribeTapeArchivesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeTapeArchivesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTapeArchivesOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DescribeTapeArchivesAsyncHelper(const DescribeTapeArchivesRequest& request, const DescribeTapeArchivesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1060,12 +1350,22 @@ DescribeTapeRecoveryPointsOutcome StorageGatewayClient::DescribeTapeRecoveryPoin
 
 DescribeTapeRecoveryPointsOutcomeCallable StorageGatewayClient::DescribeTapeRecoveryPointsCallable(const DescribeTapeRecoveryPointsRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DescribeTapeRecoveryPoints, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeTapeRecoveryPoints, Aws::Client::RejectedCallOutcome<DescribeTapeRecoveryPointsOutcome>(), this, request);
+}
+
+DescribeTapeRecoveryPointsOutcomeCallable StorageGatewayClient::DescribeTapeRecoveryPointsCallable(DescribeTapeRecoveryPointsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeTapeRecoveryPoints, Aws::Client::RejectedCallOutcome<DescribeTapeRecoveryPointsOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DescribeTapeRecoveryPointsAsync(const DescribeTapeRecoveryPointsRequest& request, const DescribeTapeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DescribeTapeRecoveryPointsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeTapeRecoveryPointsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTapeRecoveryPointsOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DescribeTapeRecoveryPointsAsync(DescribeTapeRecoveryPointsRequest&& request, const DescribeTapeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeTapeRecoveryPointsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTapeRecoveryPointsOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DescribeTapeRecoveryPointsAsyncHelper(const DescribeTapeRecoveryPointsRequest& request, const DescribeTapeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1091,12 +1391,22 @@ DescribeTapesOutcome StorageGatewayClient::DescribeTapes(const DescribeTapesRequ
 
 DescribeTapesOutcomeCallable StorageGatewayClient::DescribeTapesCallable(const DescribeTapesRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DescribeTapes, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeTapes, Aws::Client::RejectedCallOutcome<DescribeTapesOutcome>(), this, request);
+}
+
+DescribeTapesOutcomeCallable StorageGatewayClient::DescribeTapesCallable(DescribeTapesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeTapes, Aws::Client::RejectedCallOutcome<DescribeTapesOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DescribeTapesAsync(const DescribeTapesRequest& request, const DescribeTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DescribeTapesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeTapesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTapesOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DescribeTapesAsync(DescribeTapesRequest&& request, const DescribeTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeTapesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTapesOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DescribeTapesAsyncHelper(const DescribeTapesRequest& request, const DescribeTapesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1122,12 +1432,22 @@ DescribeUploadBufferOutcome StorageGatewayClient::DescribeUploadBuffer(const Des
 
 DescribeUploadBufferOutcomeCallable StorageGatewayClient::DescribeUploadBufferCallable(const DescribeUploadBufferRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DescribeUploadBuffer, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeUploadBuffer, Aws::Client::RejectedCallOutcome<DescribeUploadBufferOutcome>(), this, request);
+}
+
+DescribeUploadBufferOutcomeCallable StorageGatewayClient::DescribeUploadBufferCallable(DescribeUploadBufferRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeUploadBuffer, Aws::Client::RejectedCallOutcome<DescribeUploadBufferOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DescribeUploadBufferAsync(const DescribeUploadBufferRequest& request, const DescribeUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DescribeUploadBufferAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeUploadBufferAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeUploadBufferOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DescribeUploadBufferAsync(DescribeUploadBufferRequest&& request, const DescribeUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeUploadBufferAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeUploadBufferOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DescribeUploadBufferAsyncHelper(const DescribeUploadBufferRequest& request, const DescribeUploadBufferResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1153,12 +1473,22 @@ DescribeVTLDevicesOutcome StorageGatewayClient::DescribeVTLDevices(const Describ
 
 DescribeVTLDevicesOutcomeCallable StorageGatewayClient::DescribeVTLDevicesCallable(const DescribeVTLDevicesRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DescribeVTLDevices, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeVTLDevices, Aws::Client::RejectedCallOutcome<DescribeVTLDevicesOutcome>(), this, request);
+}
+
+DescribeVTLDevicesOutcomeCallable StorageGatewayClient::DescribeVTLDevicesCallable(DescribeVTLDevicesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeVTLDevices, Aws::Client::RejectedCallOutcome<DescribeVTLDevicesOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DescribeVTLDevicesAsync(const DescribeVTLDevicesRequest& request, const DescribeVTLDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DescribeVTLDevicesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeVTLDevicesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVTLDevicesOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DescribeVTLDevicesAsync(DescribeVTLDevicesRequest&& request, const DescribeVTLDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeVTLDevicesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeVTLDevicesOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DescribeVTLDevicesAsyncHelper(const DescribeVTLDevicesRequest& request, const DescribeVTLDevicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1184,12 +1514,22 @@ DescribeWorkingStorageOutcome StorageGatewayClient::DescribeWorkingStorage(const
 
 DescribeWorkingStorageOutcomeCallable StorageGatewayClient::DescribeWorkingStorageCallable(const DescribeWorkingStorageRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DescribeWorkingStorage, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeWorkingStorage, Aws::Client::RejectedCallOutcome<DescribeWorkingStorageOutcome>(), this, request);
+}
+
+DescribeWorkingStorageOutcomeCallable StorageGatewayClient::DescribeWorkingStorageCallable(DescribeWorkingStorageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DescribeWorkingStorage, Aws::Client::RejectedCallOutcome<DescribeWorkingStorageOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DescribeWorkingStorageAsync(const DescribeWorkingStorageRequest& request, const DescribeWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DescribeWorkingStorageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeWorkingStorageAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeWorkingStorageOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DescribeWorkingStorageAsync(DescribeWorkingStorageRequest&& request, const DescribeWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DescribeWorkingStorageAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeWorkingStorageOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DescribeWorkingStorageAsyncHelper(const DescribeWorkingStorageRequest& request, const DescribeWorkingStorageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1215,12 +1555,22 @@ DisableGatewayOutcome StorageGatewayClient::DisableGateway(const DisableGatewayR
 
 DisableGatewayOutcomeCallable StorageGatewayClient::DisableGatewayCallable(const DisableGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::DisableGateway, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DisableGateway, Aws::Client::RejectedCallOutcome<DisableGatewayOutcome>(), this, request);
+}
+
+DisableGatewayOutcomeCallable StorageGatewayClient::DisableGatewayCallable(DisableGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::DisableGateway, Aws::Client::RejectedCallOutcome<DisableGatewayOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::DisableGatewayAsync(const DisableGatewayRequest& request, const DisableGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::DisableGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::DisableGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DisableGatewayOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::DisableGatewayAsync(DisableGatewayRequest&& request, const DisableGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::DisableGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<DisableGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::DisableGatewayAsyncHelper(const DisableGatewayRequest& request, const DisableGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1246,12 +1596,22 @@ ListGatewaysOutcome StorageGatewayClient::ListGateways(const ListGatewaysRequest
 
 ListGatewaysOutcomeCallable StorageGatewayClient::ListGatewaysCallable(const ListGatewaysRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::ListGateways, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ListGateways, Aws::Client::RejectedCallOutcome<ListGatewaysOutcome>(), this, request);
+}
+
+ListGatewaysOutcomeCallable StorageGatewayClient::ListGatewaysCallable(ListGatewaysRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ListGateways, Aws::Client::RejectedCallOutcome<ListGatewaysOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::ListGatewaysAsync(const ListGatewaysRequest& request, const ListGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::ListGatewaysAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::ListGatewaysAsyncHelper, Aws::Client::RejectedAsyncCall<ListGatewaysOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::ListGatewaysAsync(ListGatewaysRequest&& request, const ListGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::ListGatewaysAsyncHelper, Aws::Client::RejectedAsyncCall<ListGatewaysOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::ListGatewaysAsyncHelper(const ListGatewaysRequest& request, const ListGatewaysResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1277,12 +1637,22 @@ ListLocalDisksOutcome StorageGatewayClient::ListLocalDisks(const ListLocalDisksR
 
 ListLocalDisksOutcomeCallable StorageGatewayClient::ListLocalDisksCallable(const ListLocalDisksRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::ListLocalDisks, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ListLocalDisks, Aws::Client::RejectedCallOutcome<ListLocalDisksOutcome>(), this, request);
+}
+
+ListLocalDisksOutcomeCallable StorageGatewayClient::ListLocalDisksCallable(ListLocalDisksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ListLocalDisks, Aws::Client::RejectedCallOutcome<ListLocalDisksOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::ListLocalDisksAsync(const ListLocalDisksRequest& request, const ListLocalDisksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::ListLocalDisksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::ListLocalDisksAsyncHelper, Aws::Client::RejectedAsyncCall<ListLocalDisksOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::ListLocalDisksAsync(ListLocalDisksRequest&& request, const ListLocalDisksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::ListLocalDisksAsyncHelper, Aws::Client::RejectedAsyncCall<ListLocalDisksOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::ListLocalDisksAsyncHelper(const ListLocalDisksRequest& request, const ListLocalDisksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1308,12 +1678,22 @@ ListTagsForResourceOutcome StorageGatewayClient::ListTagsForResource(const ListT
 
 ListTagsForResourceOutcomeCallable StorageGatewayClient::ListTagsForResourceCallable(const ListTagsForResourceRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::ListTagsForResource, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ListTagsForResource, Aws::Client::RejectedCallOutcome<ListTagsForResourceOutcome>(), this, request);
+}
+
+ListTagsForResourceOutcomeCallable StorageGatewayClient::ListTagsForResourceCallable(ListTagsForResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ListTagsForResource, Aws::Client::RejectedCallOutcome<ListTagsForResourceOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::ListTagsForResourceAsync(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::ListTagsForResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::ListTagsForResourceAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForResourceOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::ListTagsForResourceAsync(ListTagsForResourceRequest&& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::ListTagsForResourceAsyncHelper, Aws::Client::RejectedAsyncCall<ListTagsForResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::ListTagsForResourceAsyncHelper(const ListTagsForResourceRequest& request, const ListTagsForResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1339,12 +1719,22 @@ ListVolumeInitiatorsOutcome StorageGatewayClient::ListVolumeInitiators(const Lis
 
 ListVolumeInitiatorsOutcomeCallable StorageGatewayClient::ListVolumeInitiatorsCallable(const ListVolumeInitiatorsRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::ListVolumeInitiators, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ListVolumeInitiators, Aws::Client::RejectedCallOutcome<ListVolumeInitiatorsOutcome>(), this, request);
+}
+
+ListVolumeInitiatorsOutcomeCallable StorageGatewayClient::ListVolumeInitiatorsCallable(ListVolumeInitiatorsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ListVolumeInitiators, Aws::Client::RejectedCallOutcome<ListVolumeInitiatorsOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::ListVolumeInitiatorsAsync(const ListVolumeInitiatorsRequest& request, const ListVolumeInitiatorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::ListVolumeInitiatorsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::ListVolumeInitiatorsAsyncHelper, Aws::Client::RejectedAsyncCall<ListVolumeInitiatorsOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::ListVolumeInitiatorsAsync(ListVolumeInitiatorsRequest&& request, const ListVolumeInitiatorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::ListVolumeInitiatorsAsyncHelper, Aws::Client::RejectedAsyncCall<ListVolumeInitiatorsOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::ListVolumeInitiatorsAsyncHelper(const ListVolumeInitiatorsRequest& request, const ListVolumeInitiatorsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1370,12 +1760,22 @@ ListVolumeRecoveryPointsOutcome StorageGatewayClient::ListVolumeRecoveryPoints(c
 
 ListVolumeRecoveryPointsOutcomeCallable StorageGatewayClient::ListVolumeRecoveryPointsCallable(const ListVolumeRecoveryPointsRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::ListVolumeRecoveryPoints, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ListVolumeRecoveryPoints, Aws::Client::RejectedCallOutcome<ListVolumeRecoveryPointsOutcome>(), this, request);
+}
+
+ListVolumeRecoveryPointsOutcomeCallable StorageGatewayClient::ListVolumeRecoveryPointsCallable(ListVolumeRecoveryPointsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ListVolumeRecoveryPoints, Aws::Client::RejectedCallOutcome<ListVolumeRecoveryPointsOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::ListVolumeRecoveryPointsAsync(const ListVolumeRecoveryPointsRequest& request, const ListVolumeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::ListVolumeRecoveryPointsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::ListVolumeRecoveryPointsAsyncHelper, Aws::Client::RejectedAsyncCall<ListVolumeRecoveryPointsOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::ListVolumeRecoveryPointsAsync(ListVolumeRecoveryPointsRequest&& request, const ListVolumeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::ListVolumeRecoveryPointsAsyncHelper, Aws::Client::RejectedAsyncCall<ListVolumeRecoveryPointsOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::ListVolumeRecoveryPointsAsyncHelper(const ListVolumeRecoveryPointsRequest& request, const ListVolumeRecoveryPointsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1401,12 +1801,22 @@ ListVolumesOutcome StorageGatewayClient::ListVolumes(const ListVolumesRequest& r
 
 ListVolumesOutcomeCallable StorageGatewayClient::ListVolumesCallable(const ListVolumesRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::ListVolumes, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ListVolumes, Aws::Client::RejectedCallOutcome<ListVolumesOutcome>(), this, request);
+}
+
+ListVolumesOutcomeCallable StorageGatewayClient::ListVolumesCallable(ListVolumesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ListVolumes, Aws::Client::RejectedCallOutcome<ListVolumesOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::ListVolumesAsync(const ListVolumesRequest& request, const ListVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::ListVolumesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::ListVolumesAsyncHelper, Aws::Client::RejectedAsyncCall<ListVolumesOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::ListVolumesAsync(ListVolumesRequest&& request, const ListVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::ListVolumesAsyncHelper, Aws::Client::RejectedAsyncCall<ListVolumesOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::ListVolumesAsyncHelper(const ListVolumesRequest& request, const ListVolumesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1432,12 +1842,22 @@ RemoveTagsFromResourceOutcome StorageGatewayClient::RemoveTagsFromResource(const
 
 RemoveTagsFromResourceOutcomeCallable StorageGatewayClient::RemoveTagsFromResourceCallable(const RemoveTagsFromResourceRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::RemoveTagsFromResource, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::RemoveTagsFromResource, Aws::Client::RejectedCallOutcome<RemoveTagsFromResourceOutcome>(), this, request);
+}
+
+RemoveTagsFromResourceOutcomeCallable StorageGatewayClient::RemoveTagsFromResourceCallable(RemoveTagsFromResourceRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::RemoveTagsFromResource, Aws::Client::RejectedCallOutcome<RemoveTagsFromResourceOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::RemoveTagsFromResourceAsync(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::RemoveTagsFromResourceAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::RemoveTagsFromResourceAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsFromResourceOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::RemoveTagsFromResourceAsync(RemoveTagsFromResourceRequest&& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::RemoveTagsFromResourceAsyncHelper, Aws::Client::RejectedAsyncCall<RemoveTagsFromResourceOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::RemoveTagsFromResourceAsyncHelper(const RemoveTagsFromResourceRequest& request, const RemoveTagsFromResourceResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1463,12 +1883,22 @@ ResetCacheOutcome StorageGatewayClient::ResetCache(const ResetCacheRequest& requ
 
 ResetCacheOutcomeCallable StorageGatewayClient::ResetCacheCallable(const ResetCacheRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::ResetCache, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ResetCache, Aws::Client::RejectedCallOutcome<ResetCacheOutcome>(), this, request);
+}
+
+ResetCacheOutcomeCallable StorageGatewayClient::ResetCacheCallable(ResetCacheRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ResetCache, Aws::Client::RejectedCallOutcome<ResetCacheOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::ResetCacheAsync(const ResetCacheRequest& request, const ResetCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::ResetCacheAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::ResetCacheAsyncHelper, Aws::Client::RejectedAsyncCall<ResetCacheOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::ResetCacheAsync(ResetCacheRequest&& request, const ResetCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::ResetCacheAsyncHelper, Aws::Client::RejectedAsyncCall<ResetCacheOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::ResetCacheAsyncHelper(const ResetCacheRequest& request, const ResetCacheResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1494,12 +1924,22 @@ RetrieveTapeArchiveOutcome StorageGatewayClient::RetrieveTapeArchive(const Retri
 
 RetrieveTapeArchiveOutcomeCallable StorageGatewayClient::RetrieveTapeArchiveCallable(const RetrieveTapeArchiveRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::RetrieveTapeArchive, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::RetrieveTapeArchive, Aws::Client::RejectedCallOutcome<RetrieveTapeArchiveOutcome>(), this, request);
+}
+
+RetrieveTapeArchiveOutcomeCallable StorageGatewayClient::RetrieveTapeArchiveCallable(RetrieveTapeArchiveRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::RetrieveTapeArchive, Aws::Client::RejectedCallOutcome<RetrieveTapeArchiveOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::RetrieveTapeArchiveAsync(const RetrieveTapeArchiveRequest& request, const RetrieveTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::RetrieveTapeArchiveAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::RetrieveTapeArchiveAsyncHelper, Aws::Client::RejectedAsyncCall<RetrieveTapeArchiveOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::RetrieveTapeArchiveAsync(RetrieveTapeArchiveRequest&& request, const RetrieveTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::RetrieveTapeArchiveAsyncHelper, Aws::Client::RejectedAsyncCall<RetrieveTapeArchiveOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::RetrieveTapeArchiveAsyncHelper(const RetrieveTapeArchiveRequest& request, const RetrieveTapeArchiveResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1525,12 +1965,22 @@ RetrieveTapeRecoveryPointOutcome StorageGatewayClient::RetrieveTapeRecoveryPoint
 
 RetrieveTapeRecoveryPointOutcomeCallable StorageGatewayClient::RetrieveTapeRecoveryPointCallable(const RetrieveTapeRecoveryPointRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::RetrieveTapeRecoveryPoint, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::RetrieveTapeRecoveryPoint, Aws::Client::RejectedCallOutcome<RetrieveTapeRecoveryPointOutcome>(), this, request);
+}
+
+RetrieveTapeRecoveryPointOutcomeCallable StorageGatewayClient::RetrieveTapeRecoveryPointCallable(RetrieveTapeRecoveryPointRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::RetrieveTapeRecoveryPoint, Aws::Client::RejectedCallOutcome<RetrieveTapeRecoveryPointOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::RetrieveTapeRecoveryPointAsync(const RetrieveTapeRecoveryPointRequest& request, const RetrieveTapeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::RetrieveTapeRecoveryPointAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::RetrieveTapeRecoveryPointAsyncHelper, Aws::Client::RejectedAsyncCall<RetrieveTapeRecoveryPointOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::RetrieveTapeRecoveryPointAsync(RetrieveTapeRecoveryPointRequest&& request, const RetrieveTapeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::RetrieveTapeRecoveryPointAsyncHelper, Aws::Client::RejectedAsyncCall<RetrieveTapeRecoveryPointOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::RetrieveTapeRecoveryPointAsyncHelper(const RetrieveTapeRecoveryPointRequest& request, const RetrieveTapeRecoveryPointResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1556,12 +2006,22 @@ ShutdownGatewayOutcome StorageGatewayClient::ShutdownGateway(const ShutdownGatew
 
 ShutdownGatewayOutcomeCallable StorageGatewayClient::ShutdownGatewayCallable(const ShutdownGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::ShutdownGateway, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ShutdownGateway, Aws::Client::RejectedCallOutcome<ShutdownGatewayOutcome>(), this, request);
+}
+
+ShutdownGatewayOutcomeCallable StorageGatewayClient::ShutdownGatewayCallable(ShutdownGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::ShutdownGateway, Aws::Client::RejectedCallOutcome<ShutdownGatewayOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::ShutdownGatewayAsync(const ShutdownGatewayRequest& request, const ShutdownGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::ShutdownGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::ShutdownGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<ShutdownGatewayOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::ShutdownGatewayAsync(ShutdownGatewayRequest&& request, const ShutdownGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::ShutdownGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<ShutdownGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::ShutdownGatewayAsyncHelper(const ShutdownGatewayRequest& request, const ShutdownGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1587,12 +2047,22 @@ StartGatewayOutcome StorageGatewayClient::StartGateway(const StartGatewayRequest
 
 StartGatewayOutcomeCallable StorageGatewayClient::StartGatewayCallable(const StartGatewayRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::StartGateway, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::StartGateway, Aws::Client::RejectedCallOutcome<StartGatewayOutcome>(), this, request);
+}
+
+StartGatewayOutcomeCallable StorageGatewayClient::StartGatewayCallable(StartGatewayRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::StartGateway, Aws::Client::RejectedCallOutcome<StartGatewayOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::StartGatewayAsync(const StartGatewayRequest& request, const StartGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::StartGatewayAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::StartGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<StartGatewayOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::StartGatewayAsync(StartGatewayRequest&& request, const StartGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::StartGatewayAsyncHelper, Aws::Client::RejectedAsyncCall<StartGatewayOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::StartGatewayAsyncHelper(const StartGatewayRequest& request, const StartGatewayResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1618,12 +2088,22 @@ UpdateBandwidthRateLimitOutcome StorageGatewayClient::UpdateBandwidthRateLimit(c
 
 UpdateBandwidthRateLimitOutcomeCallable StorageGatewayClient::UpdateBandwidthRateLimitCallable(const UpdateBandwidthRateLimitRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::UpdateBandwidthRateLimit, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::UpdateBandwidthRateLimit, Aws::Client::RejectedCallOutcome<UpdateBandwidthRateLimitOutcome>(), this, request);
+}
+
+UpdateBandwidthRateLimitOutcomeCallable StorageGatewayClient::UpdateBandwidthRateLimitCallable(UpdateBandwidthRateLimitRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::UpdateBandwidthRateLimit, Aws::Client::RejectedCallOutcome<UpdateBandwidthRateLimitOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::UpdateBandwidthRateLimitAsync(const UpdateBandwidthRateLimitRequest& request, const UpdateBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::UpdateBandwidthRateLimitAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::UpdateBandwidthRateLimitAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateBandwidthRateLimitOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::UpdateBandwidthRateLimitAsync(UpdateBandwidthRateLimitRequest&& request, const UpdateBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::UpdateBandwidthRateLimitAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateBandwidthRateLimitOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::UpdateBandwidthRateLimitAsyncHelper(const UpdateBandwidthRateLimitRequest& request, const UpdateBandwidthRateLimitResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1649,12 +2129,22 @@ UpdateChapCredentialsOutcome StorageGatewayClient::UpdateChapCredentials(const U
 
 UpdateChapCredentialsOutcomeCallable StorageGatewayClient::UpdateChapCredentialsCallable(const UpdateChapCredentialsRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::UpdateChapCredentials, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::UpdateChapCredentials, Aws::Client::RejectedCallOutcome<UpdateChapCredentialsOutcome>(), this, request);
+}
+
+UpdateChapCredentialsOutcomeCallable StorageGatewayClient::UpdateChapCredentialsCallable(UpdateChapCredentialsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::UpdateChapCredentials, Aws::Client::RejectedCallOutcome<UpdateChapCredentialsOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::UpdateChapCredentialsAsync(const UpdateChapCredentialsRequest& request, const UpdateChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::UpdateChapCredentialsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::UpdateChapCredentialsAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateChapCredentialsOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::UpdateChapCredentialsAsync(UpdateChapCredentialsRequest&& request, const UpdateChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::UpdateChapCredentialsAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateChapCredentialsOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::UpdateChapCredentialsAsyncHelper(const UpdateChapCredentialsRequest& request, const UpdateChapCredentialsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1680,12 +2170,22 @@ UpdateGatewayInformationOutcome StorageGatewayClient::UpdateGatewayInformation(c
 
 UpdateGatewayInformationOutcomeCallable StorageGatewayClient::UpdateGatewayInformationCallable(const UpdateGatewayInformationRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::UpdateGatewayInformation, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::UpdateGatewayInformation, Aws::Client::RejectedCallOutcome<UpdateGatewayInformationOutcome>(), this, request);
+}
+
+UpdateGatewayInformationOutcomeCallable StorageGatewayClient::UpdateGatewayInformationCallable(UpdateGatewayInformationRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::UpdateGatewayInformation, Aws::Client::RejectedCallOutcome<UpdateGatewayInformationOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::UpdateGatewayInformationAsync(const UpdateGatewayInformationRequest& request, const UpdateGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::UpdateGatewayInformationAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::UpdateGatewayInformationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateGatewayInformationOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::UpdateGatewayInformationAsync(UpdateGatewayInformationRequest&& request, const UpdateGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::UpdateGatewayInformationAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateGatewayInformationOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::UpdateGatewayInformationAsyncHelper(const UpdateGatewayInformationRequest& request, const UpdateGatewayInformationResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1711,12 +2211,22 @@ UpdateGatewaySoftwareNowOutcome StorageGatewayClient::UpdateGatewaySoftwareNow(c
 
 UpdateGatewaySoftwareNowOutcomeCallable StorageGatewayClient::UpdateGatewaySoftwareNowCallable(const UpdateGatewaySoftwareNowRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::UpdateGatewaySoftwareNow, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::UpdateGatewaySoftwareNow, Aws::Client::RejectedCallOutcome<UpdateGatewaySoftwareNowOutcome>(), this, request);
+}
+
+UpdateGatewaySoftwareNowOutcomeCallable StorageGatewayClient::UpdateGatewaySoftwareNowCallable(UpdateGatewaySoftwareNowRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::UpdateGatewaySoftwareNow, Aws::Client::RejectedCallOutcome<UpdateGatewaySoftwareNowOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::UpdateGatewaySoftwareNowAsync(const UpdateGatewaySoftwareNowRequest& request, const UpdateGatewaySoftwareNowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::UpdateGatewaySoftwareNowAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::UpdateGatewaySoftwareNowAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateGatewaySoftwareNowOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::UpdateGatewaySoftwareNowAsync(UpdateGatewaySoftwareNowRequest&& request, const UpdateGatewaySoftwareNowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::UpdateGatewaySoftwareNowAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateGatewaySoftwareNowOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::UpdateGatewaySoftwareNowAsyncHelper(const UpdateGatewaySoftwareNowRequest& request, const UpdateGatewaySoftwareNowResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1742,12 +2252,22 @@ UpdateMaintenanceStartTimeOutcome StorageGatewayClient::UpdateMaintenanceStartTi
 
 UpdateMaintenanceStartTimeOutcomeCallable StorageGatewayClient::UpdateMaintenanceStartTimeCallable(const UpdateMaintenanceStartTimeRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::UpdateMaintenanceStartTime, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::UpdateMaintenanceStartTime, Aws::Client::RejectedCallOutcome<UpdateMaintenanceStartTimeOutcome>(), this, request);
+}
+
+UpdateMaintenanceStartTimeOutcomeCallable StorageGatewayClient::UpdateMaintenanceStartTimeCallable(UpdateMaintenanceStartTimeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::UpdateMaintenanceStartTime, Aws::Client::RejectedCallOutcome<UpdateMaintenanceStartTimeOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::UpdateMaintenanceStartTimeAsync(const UpdateMaintenanceStartTimeRequest& request, const UpdateMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::UpdateMaintenanceStartTimeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::UpdateMaintenanceStartTimeAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateMaintenanceStartTimeOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::UpdateMaintenanceStartTimeAsync(UpdateMaintenanceStartTimeRequest&& request, const UpdateMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::UpdateMaintenanceStartTimeAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateMaintenanceStartTimeOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::UpdateMaintenanceStartTimeAsyncHelper(const UpdateMaintenanceStartTimeRequest& request, const UpdateMaintenanceStartTimeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1773,12 +2293,22 @@ UpdateSnapshotScheduleOutcome StorageGatewayClient::UpdateSnapshotSchedule(const
 
 UpdateSnapshotScheduleOutcomeCallable StorageGatewayClient::UpdateSnapshotScheduleCallable(const UpdateSnapshotScheduleRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::UpdateSnapshotSchedule, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::UpdateSnapshotSchedule, Aws::Client::RejectedCallOutcome<UpdateSnapshotScheduleOutcome>(), this, request);
+}
+
+UpdateSnapshotScheduleOutcomeCallable StorageGatewayClient::UpdateSnapshotScheduleCallable(UpdateSnapshotScheduleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::UpdateSnapshotSchedule, Aws::Client::RejectedCallOutcome<UpdateSnapshotScheduleOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::UpdateSnapshotScheduleAsync(const UpdateSnapshotScheduleRequest& request, const UpdateSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::UpdateSnapshotScheduleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::UpdateSnapshotScheduleAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateSnapshotScheduleOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::UpdateSnapshotScheduleAsync(UpdateSnapshotScheduleRequest&& request, const UpdateSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::UpdateSnapshotScheduleAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateSnapshotScheduleOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::UpdateSnapshotScheduleAsyncHelper(const UpdateSnapshotScheduleRequest& request, const UpdateSnapshotScheduleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1804,12 +2334,22 @@ UpdateVTLDeviceTypeOutcome StorageGatewayClient::UpdateVTLDeviceType(const Updat
 
 UpdateVTLDeviceTypeOutcomeCallable StorageGatewayClient::UpdateVTLDeviceTypeCallable(const UpdateVTLDeviceTypeRequest& request) const
 {
-  return std::async(std::launch::async, &StorageGatewayClient::UpdateVTLDeviceType, this, request);
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::UpdateVTLDeviceType, Aws::Client::RejectedCallOutcome<UpdateVTLDeviceTypeOutcome>(), this, request);
+}
+
+UpdateVTLDeviceTypeOutcomeCallable StorageGatewayClient::UpdateVTLDeviceTypeCallable(UpdateVTLDeviceTypeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&StorageGatewayClient::UpdateVTLDeviceType, Aws::Client::RejectedCallOutcome<UpdateVTLDeviceTypeOutcome>(), this, std::move(request));
 }
 
 void StorageGatewayClient::UpdateVTLDeviceTypeAsync(const UpdateVTLDeviceTypeRequest& request, const UpdateVTLDeviceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&StorageGatewayClient::UpdateVTLDeviceTypeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&StorageGatewayClient::UpdateVTLDeviceTypeAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateVTLDeviceTypeOutcome>(), this, request, handler, context);
+}
+
+void StorageGatewayClient::UpdateVTLDeviceTypeAsync(UpdateVTLDeviceTypeRequest&& request, const UpdateVTLDeviceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&StorageGatewayClient::UpdateVTLDeviceTypeAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateVTLDeviceTypeOutcome>(), this, std::move(request), handler, context);
 }
 
 void StorageGatewayClient::UpdateVTLDeviceTypeAsyncHelper(const UpdateVTLDeviceTypeRequest& request, const UpdateVTLDeviceTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
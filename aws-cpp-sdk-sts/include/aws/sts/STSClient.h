@@ -28,6 +28,16 @@
 #include <aws/sts/model/GetSessionTokenResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/sts/model/AssumeRoleRequest.h>
+#include <aws/sts/model/AssumeRoleWithSAMLRequest.h>
+#include <aws/sts/model/AssumeRoleWithWebIdentityRequest.h>
+#include <aws/sts/model/DecodeAuthorizationMessageRequest.h>
+#include <aws/sts/model/GetFederationTokenRequest.h>
+#include <aws/sts/model/GetSessionTokenRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -322,6 +332,11 @@ namespace Model
          */
         virtual Model::AssumeRoleOutcomeCallable AssumeRoleCallable(const Model::AssumeRoleRequest& request) const;
 
+        /**
+         * Same as AssumeRoleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AssumeRoleOutcomeCallable AssumeRoleCallable(Model::AssumeRoleRequest&& request) const;
+
         /**
          * <p>Returns a set of temporary security credentials (consisting of an access key
          * ID, a secret access key, and a security token) that you can use to access AWS
@@ -395,6 +410,11 @@ namespace Model
          */
         virtual void AssumeRoleAsync(const Model::AssumeRoleRequest& request, const AssumeRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssumeRoleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AssumeRoleAsync(Model::AssumeRoleRequest&& request, const AssumeRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a set of temporary security credentials for users who have been
          * authenticated via a SAML authentication response. This operation provides a
@@ -503,6 +523,11 @@ namespace Model
          */
         virtual Model::AssumeRoleWithSAMLOutcomeCallable AssumeRoleWithSAMLCallable(const Model::AssumeRoleWithSAMLRequest& request) const;
 
+        /**
+         * Same as AssumeRoleWithSAMLCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AssumeRoleWithSAMLOutcomeCallable AssumeRoleWithSAMLCallable(Model::AssumeRoleWithSAMLRequest&& request) const;
+
         /**
          * <p>Returns a set of temporary security credentials for users who have been
          * authenticated via a SAML authentication response. This operation provides a
@@ -558,6 +583,11 @@ namespace Model
          */
         virtual void AssumeRoleWithSAMLAsync(const Model::AssumeRoleWithSAMLRequest& request, const AssumeRoleWithSAMLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssumeRoleWithSAMLAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AssumeRoleWithSAMLAsync(Model::AssumeRoleWithSAMLRequest&& request, const AssumeRoleWithSAMLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a set of temporary security credentials for users who have been
          * authenticated in a mobile or web application with a web identity provider, such
@@ -698,6 +728,11 @@ namespace Model
          */
         virtual Model::AssumeRoleWithWebIdentityOutcomeCallable AssumeRoleWithWebIdentityCallable(const Model::AssumeRoleWithWebIdentityRequest& request) const;
 
+        /**
+         * Same as AssumeRoleWithWebIdentityCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AssumeRoleWithWebIdentityOutcomeCallable AssumeRoleWithWebIdentityCallable(Model::AssumeRoleWithWebIdentityRequest&& request) const;
+
         /**
          * <p>Returns a set of temporary security credentials for users who have been
          * authenticated in a mobile or web application with a web identity provider, such
@@ -769,6 +804,11 @@ namespace Model
          */
         virtual void AssumeRoleWithWebIdentityAsync(const Model::AssumeRoleWithWebIdentityRequest& request, const AssumeRoleWithWebIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AssumeRoleWithWebIdentityAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AssumeRoleWithWebIdentityAsync(Model::AssumeRoleWithWebIdentityRequest&& request, const AssumeRoleWithWebIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Decodes additional information about the authorization status of a request
          * from an encoded message returned in response to an AWS request. </p> <p>For
@@ -823,6 +863,11 @@ namespace Model
          */
         virtual Model::DecodeAuthorizationMessageOutcomeCallable DecodeAuthorizationMessageCallable(const Model::DecodeAuthorizationMessageRequest& request) const;
 
+        /**
+         * Same as DecodeAuthorizationMessageCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DecodeAuthorizationMessageOutcomeCallable DecodeAuthorizationMessageCallable(Model::DecodeAuthorizationMessageRequest&& request) const;
+
         /**
          * <p>Decodes additional information about the authorization status of a request
          * from an encoded message returned in response to an AWS request. </p> <p>For
@@ -851,6 +896,11 @@ namespace Model
          */
         virtual void DecodeAuthorizationMessageAsync(const Model::DecodeAuthorizationMessageRequest& request, const DecodeAuthorizationMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DecodeAuthorizationMessageAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DecodeAuthorizationMessageAsync(Model::DecodeAuthorizationMessageRequest&& request, const DecodeAuthorizationMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a set of temporary security credentials (consisting of an access key
          * ID, a secret access key, and a security token) for a federated user. A typical
@@ -979,6 +1029,11 @@ namespace Model
          */
         virtual Model::GetFederationTokenOutcomeCallable GetFederationTokenCallable(const Model::GetFederationTokenRequest& request) const;
 
+        /**
+         * Same as GetFederationTokenCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetFederationTokenOutcomeCallable GetFederationTokenCallable(Model::GetFederationTokenRequest&& request) const;
+
         /**
          * <p>Returns a set of temporary security credentials (consisting of an access key
          * ID, a secret access key, and a security token) for a federated user. A typical
@@ -1044,6 +1099,11 @@ namespace Model
          */
         virtual void GetFederationTokenAsync(const Model::GetFederationTokenRequest& request, const GetFederationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetFederationTokenAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetFederationTokenAsync(Model::GetFederationTokenRequest&& request, const GetFederationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a set of temporary credentials for an AWS account or IAM user. The
          * credentials consist of an access key ID, a secret access key, and a security
@@ -1118,6 +1178,11 @@ namespace Model
          */
         virtual Model::GetSessionTokenOutcomeCallable GetSessionTokenCallable(const Model::GetSessionTokenRequest& request) const;
 
+        /**
+         * Same as GetSessionTokenCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetSessionTokenOutcomeCallable GetSessionTokenCallable(Model::GetSessionTokenRequest&& request) const;
+
         /**
          * <p>Returns a set of temporary credentials for an AWS account or IAM user. The
          * credentials consist of an access key ID, a secret access key, and a security
@@ -1156,6 +1221,30 @@ namespace Model
          */
         virtual void GetSessionTokenAsync(const Model::GetSessionTokenRequest& request, const GetSessionTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSessionTokenAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetSessionTokenAsync(Model::GetSessionTokenRequest&& request, const GetSessionTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AssumeRoleOutcome> AssumeRoleAwaitable(const Model::AssumeRoleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &STSClient::AssumeRole, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssumeRoleOutcome> AssumeRoleAwaitable(Model::AssumeRoleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &STSClient::AssumeRole, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssumeRoleWithSAMLOutcome> AssumeRoleWithSAMLAwaitable(const Model::AssumeRoleWithSAMLRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &STSClient::AssumeRoleWithSAML, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssumeRoleWithSAMLOutcome> AssumeRoleWithSAMLAwaitable(Model::AssumeRoleWithSAMLRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &STSClient::AssumeRoleWithSAML, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssumeRoleWithWebIdentityOutcome> AssumeRoleWithWebIdentityAwaitable(const Model::AssumeRoleWithWebIdentityRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &STSClient::AssumeRoleWithWebIdentity, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AssumeRoleWithWebIdentityOutcome> AssumeRoleWithWebIdentityAwaitable(Model::AssumeRoleWithWebIdentityRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &STSClient::AssumeRoleWithWebIdentity, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DecodeAuthorizationMessageOutcome> DecodeAuthorizationMessageAwaitable(const Model::DecodeAuthorizationMessageRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &STSClient::DecodeAuthorizationMessage, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DecodeAuthorizationMessageOutcome> DecodeAuthorizationMessageAwaitable(Model::DecodeAuthorizationMessageRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &STSClient::DecodeAuthorizationMessage, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetFederationTokenOutcome> GetFederationTokenAwaitable(const Model::GetFederationTokenRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &STSClient::GetFederationToken, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetFederationTokenOutcome> GetFederationTokenAwaitable(Model::GetFederationTokenRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &STSClient::GetFederationToken, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSessionTokenOutcome> GetSessionTokenAwaitable(const Model::GetSessionTokenRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &STSClient::GetSessionToken, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSessionTokenOutcome> GetSessionTokenAwaitable(Model::GetSessionTokenRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &STSClient::GetSessionToken, this, std::move(request)); }
+#endif
 
   private:
     void init(const Client::ClientConfiguration& clientConfiguration);
@@ -113,12 +113,22 @@ AssumeRoleOutcome STSClient::AssumeRole(const AssumeRoleRequest& request) const
 
 AssumeRoleOutcomeCallable STSClient::AssumeRoleCallable(const AssumeRoleRequest& request) const
 {
-  return std::async(std::launch::async, &STSClient::AssumeRole, this, request);
+  return m_executor->SubmitWithFuture(&STSClient::AssumeRole, Aws::Client::RejectedCallOutcome<AssumeRoleOutcome>(), this, request);
+}
+
+AssumeRoleOutcomeCallable STSClient::AssumeRoleCallable(AssumeRoleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&STSClient::AssumeRole, Aws::Client::RejectedCallOutcome<AssumeRoleOutcome>(), this, std::move(request));
 }
 
 void STSClient::AssumeRoleAsync(const AssumeRoleRequest& request, const AssumeRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&STSClient::AssumeRoleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&STSClient::AssumeRoleAsyncHelper, Aws::Client::RejectedAsyncCall<AssumeRoleOutcome>(), this, request, handler, context);
+}
+
+void STSClient::AssumeRoleAsync(AssumeRoleRequest&& request, const AssumeRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&STSClient::AssumeRoleAsyncHelper, Aws::Client::RejectedAsyncCall<AssumeRoleOutcome>(), this, std::move(request), handler, context);
 }
 
 void STSClient::AssumeRoleAsyncHelper(const AssumeRoleRequest& request, const AssumeRoleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -143,12 +153,22 @@ AssumeRoleWithSAMLOutcome STSClient::AssumeRoleWithSAML(const AssumeRoleWithSAML
 
 AssumeRoleWithSAMLOutcomeCallable STSClient::AssumeRoleWithSAMLCallable(const AssumeRoleWithSAMLRequest& request) const
 {
-  return std::async(std::launch::async, &STSClient::AssumeRoleWithSAML, this, request);
+  return m_executor->SubmitWithFuture(&STSClient::AssumeRoleWithSAML, Aws::Client::RejectedCallOutcome<AssumeRoleWithSAMLOutcome>(), this, request);
+}
+
+AssumeRoleWithSAMLOutcomeCallable STSClient::AssumeRoleWithSAMLCallable(AssumeRoleWithSAMLRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&STSClient::AssumeRoleWithSAML, Aws::Client::RejectedCallOutcome<AssumeRoleWithSAMLOutcome>(), this, std::move(request));
 }
 
 void STSClient::AssumeRoleWithSAMLAsync(const AssumeRoleWithSAMLRequest& request, const AssumeRoleWithSAMLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&STSClient::AssumeRoleWithSAMLAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&STSClient::AssumeRoleWithSAMLAsyncHelper, Aws::Client::RejectedAsyncCall<AssumeRoleWithSAMLOutcome>(), this, request, handler, context);
+}
+
+void STSClient::AssumeRoleWithSAMLAsync(AssumeRoleWithSAMLRequest&& request, const AssumeRoleWithSAMLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&STSClient::AssumeRoleWithSAMLAsyncHelper, Aws::Client::RejectedAsyncCall<AssumeRoleWithSAMLOutcome>(), this, std::move(request), handler, context);
 }
 
 void STSClient::AssumeRoleWithSAMLAsyncHelper(const AssumeRoleWithSAMLRequest& request, const AssumeRoleWithSAMLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -173,12 +193,22 @@ AssumeRoleWithWebIdentityOutcome STSClient::AssumeRoleWithWebIdentity(const Assu
 
 AssumeRoleWithWebIdentityOutcomeCallable STSClient::AssumeRoleWithWebIdentityCallable(const AssumeRoleWithWebIdentityRequest& request) const
 {
-  return std::async(std::launch::async, &STSClient::AssumeRoleWithWebIdentity, this, request);
+  return m_executor->SubmitWithFuture(&STSClient::AssumeRoleWithWebIdentity, Aws::Client::RejectedCallOutcome<AssumeRoleWithWebIdentityOutcome>(), this, request);
+}
+
+AssumeRoleWithWebIdentityOutcomeCallable STSClient::AssumeRoleWithWebIdentityCallable(AssumeRoleWithWebIdentityRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&STSClient::AssumeRoleWithWebIdentity, Aws::Client::RejectedCallOutcome<AssumeRoleWithWebIdentityOutcome>(), this, std::move(request));
 }
 
 void STSClient::AssumeRoleWithWebIdentityAsync(const AssumeRoleWithWebIdentityRequest& request, const AssumeRoleWithWebIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&STSClient::AssumeRoleWithWebIdentityAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&STSClient::AssumeRoleWithWebIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<AssumeRoleWithWebIdentityOutcome>(), this, request, handler, context);
+}
+
+void STSClient::AssumeRoleWithWebIdentityAsync(AssumeRoleWithWebIdentityRequest&& request, const AssumeRoleWithWebIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&STSClient::AssumeRoleWithWebIdentityAsyncHelper, Aws::Client::RejectedAsyncCall<AssumeRoleWithWebIdentityOutcome>(), this, std::move(request), handler, context);
 }
 
 void STSClient::AssumeRoleWithWebIdentityAsyncHelper(const AssumeRoleWithWebIdentityRequest& request, const AssumeRoleWithWebIdentityResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -203,12 +233,22 @@ DecodeAuthorizationMessageOutcome STSClient::DecodeAuthorizationMessage(const De
 
 DecodeAuthorizationMessageOutcomeCallable STSClient::DecodeAuthorizationMessageCallable(const DecodeAuthorizationMessageRequest& request) const
 {
-  return std::async(std::launch::async, &STSClient::DecodeAuthorizationMessage, this, request);
+  return m_executor->SubmitWithFuture(&STSClient::DecodeAuthorizationMessage, Aws::Client::RejectedCallOutcome<DecodeAuthorizationMessageOutcome>(), this, request);
+}
+
+DecodeAuthorizationMessageOutcomeCallable STSClient::DecodeAuthorizationMessageCallable(DecodeAuthorizationMessageRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&STSClient::DecodeAuthorizationMessage, Aws::Client::RejectedCallOutcome<DecodeAuthorizationMessageOutcome>(), this, std::move(request));
 }
 
 void STSClient::DecodeAuthorizationMessageAsync(const DecodeAuthorizationMessageRequest& request, const DecodeAuthorizationMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&STSClient::DecodeAuthorizationMessageAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&STSClient::DecodeAuthorizationMessageAsyncHelper, Aws::Client::RejectedAsyncCall<DecodeAuthorizationMessageOutcome>(), this, request, handler, context);
+}
+
+void STSClient::DecodeAuthorizationMessageAsync(DecodeAuthorizationMessageRequest&& request, const DecodeAuthorizationMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&STSClient::DecodeAuthorizationMessageAsyncHelper, Aws::Client::RejectedAsyncCall<DecodeAuthorizationMessageOutcome>(), this, std::move(request), handler, context);
 }
 
 void STSClient::DecodeAuthorizationMessageAsyncHelper(const DecodeAuthorizationMessageRequest& request, const DecodeAuthorizationMessageResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -233,12 +273,22 @@ GetFederationTokenOutcome STSClient::GetFederationToken(const GetFederationToken
 
 GetFederationTokenOutcomeCallable STSClient::GetFederationTokenCallable(const GetFederationTokenRequest& request) const
 {
-  return std::async(std::launch::async, &STSClient::GetFederationToken, this, request);
+  return m_executor->SubmitWithFuture(&STSClient::GetFederationToken, Aws::Client::RejectedCallOutcome<GetFederationTokenOutcome>(), this, request);
+}
+
+GetFederationTokenOutcomeCallable STSClient::GetFederationTokenCallable(GetFederationTokenRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&STSClient::GetFederationToken, Aws::Client::RejectedCallOutcome<GetFederationTokenOutcome>(), this, std::move(request));
 }
 
 void STSClient::GetFederationTokenAsync(const GetFederationTokenRequest& request, const GetFederationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&STSClient::GetFederationTokenAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&STSClient::GetFederationTokenAsyncHelper, Aws::Client::RejectedAsyncCall<GetFederationTokenOutcome>(), this, request, handler, context);
+}
+
+void STSClient::GetFederationTokenAsync(GetFederationTokenRequest&& request, const GetFederationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&STSClient::GetFederationTokenAsyncHelper, Aws::Client::RejectedAsyncCall<GetFederationTokenOutcome>(), this, std::move(request), handler, context);
 }
 
 void STSClient::GetFederationTokenAsyncHelper(const GetFederationTokenRequest& request, const GetFederationTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -263,12 +313,22 @@ GetSessionTokenOutcome STSClient::GetSessionToken(const GetSessionTokenRequest&
 
 GetSessionTokenOutcomeCallable STSClient::GetSessionTokenCallable(const GetSessionTokenRequest& request) const
 {
-  return std::async(std::launch::async, &STSClient::GetSessionToken, this, request);
+  return m_executor->SubmitWithFuture(&STSClient::GetSessionToken, Aws::Client::RejectedCallOutcome<GetSessionTokenOutcome>(), this, request);
+}
+
+GetSessionTokenOutcomeCallable STSClient::GetSessionTokenCallable(GetSessionTokenRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&STSClient::GetSessionToken, Aws::Client::RejectedCallOutcome<GetSessionTokenOutcome>(), this, std::move(request));
 }
 
 void STSClient::GetSessionTokenAsync(const GetSessionTokenRequest& request, const GetSessionTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&STSClient::GetSessionTokenAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&STSClient::GetSessionTokenAsyncHelper, Aws::Client::RejectedAsyncCall<GetSessionTokenOutcome>(), this, request, handler, context);
+}
+
+void STSClient::GetSessionTokenAsync(GetSessionTokenRequest&& request, const GetSessionTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&STSClient::GetSessionTokenAsyncHelper, Aws::Client::RejectedAsyncCall<GetSessionTokenOutcome>(), this, std::move(request), handler, context);
 }
 
 void STSClient::GetSessionTokenAsyncHelper(const GetSessionTokenRequest& request, const GetSessionTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
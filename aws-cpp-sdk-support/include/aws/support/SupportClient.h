@@ -36,6 +36,24 @@
 #include <aws/support/model/ResolveCaseResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/support/model/AddAttachmentsToSetRequest.h>
+#include <aws/support/model/AddCommunicationToCaseRequest.h>
+#include <aws/support/model/CreateCaseRequest.h>
+#include <aws/support/model/DescribeAttachmentRequest.h>
+#include <aws/support/model/DescribeCasesRequest.h>
+#include <aws/support/model/DescribeCommunicationsRequest.h>
+#include <aws/support/model/DescribeServicesRequest.h>
+#include <aws/support/model/DescribeSeverityLevelsRequest.h>
+#include <aws/support/model/DescribeTrustedAdvisorCheckRefreshStatusesRequest.h>
+#include <aws/support/model/DescribeTrustedAdvisorCheckResultRequest.h>
+#include <aws/support/model/DescribeTrustedAdvisorCheckSummariesRequest.h>
+#include <aws/support/model/DescribeTrustedAdvisorChecksRequest.h>
+#include <aws/support/model/RefreshTrustedAdvisorCheckRequest.h>
+#include <aws/support/model/ResolveCaseRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -238,6 +256,11 @@ namespace Model
          */
         virtual Model::AddAttachmentsToSetOutcomeCallable AddAttachmentsToSetCallable(const Model::AddAttachmentsToSetRequest& request) const;
 
+        /**
+         * Same as AddAttachmentsToSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddAttachmentsToSetOutcomeCallable AddAttachmentsToSetCallable(Model::AddAttachmentsToSetRequest&& request) const;
+
         /**
          * <p>Adds one or more attachments to an attachment set. If an
          * <code>AttachmentSetId</code> is not specified, a new attachment set is created,
@@ -254,6 +277,11 @@ namespace Model
          */
         virtual void AddAttachmentsToSetAsync(const Model::AddAttachmentsToSetRequest& request, const AddAttachmentsToSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddAttachmentsToSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddAttachmentsToSetAsync(Model::AddAttachmentsToSetRequest&& request, const AddAttachmentsToSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Adds additional customer communication to an AWS Support case. You use the
          * <code>CaseId</code> value to identify the case to add communication to. You can
@@ -278,6 +306,11 @@ namespace Model
          */
         virtual Model::AddCommunicationToCaseOutcomeCallable AddCommunicationToCaseCallable(const Model::AddCommunicationToCaseRequest& request) const;
 
+        /**
+         * Same as AddCommunicationToCaseCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::AddCommunicationToCaseOutcomeCallable AddCommunicationToCaseCallable(Model::AddCommunicationToCaseRequest&& request) const;
+
         /**
          * <p>Adds additional customer communication to an AWS Support case. You use the
          * <code>CaseId</code> value to identify the case to add communication to. You can
@@ -291,6 +324,11 @@ namespace Model
          */
         virtual void AddCommunicationToCaseAsync(const Model::AddCommunicationToCaseRequest& request, const AddCommunicationToCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as AddCommunicationToCaseAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void AddCommunicationToCaseAsync(Model::AddCommunicationToCaseRequest&& request, const AddCommunicationToCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a new case in the AWS Support Center. This operation is modeled on
          * the behavior of the AWS Support Center <a
@@ -371,6 +409,11 @@ namespace Model
          */
         virtual Model::CreateCaseOutcomeCallable CreateCaseCallable(const Model::CreateCaseRequest& request) const;
 
+        /**
+         * Same as CreateCaseCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateCaseOutcomeCallable CreateCaseCallable(Model::CreateCaseRequest&& request) const;
+
         /**
          * <p>Creates a new case in the AWS Support Center. This operation is modeled on
          * the behavior of the AWS Support Center <a
@@ -412,6 +455,11 @@ namespace Model
          */
         virtual void CreateCaseAsync(const Model::CreateCaseRequest& request, const CreateCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateCaseAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateCaseAsync(Model::CreateCaseRequest&& request, const CreateCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the attachment that has the specified ID. Attachment IDs are
          * generated by the case management system when you add an attachment to a case or
@@ -430,6 +478,11 @@ namespace Model
          */
         virtual Model::DescribeAttachmentOutcomeCallable DescribeAttachmentCallable(const Model::DescribeAttachmentRequest& request) const;
 
+        /**
+         * Same as DescribeAttachmentCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeAttachmentOutcomeCallable DescribeAttachmentCallable(Model::DescribeAttachmentRequest&& request) const;
+
         /**
          * <p>Returns the attachment that has the specified ID. Attachment IDs are
          * generated by the case management system when you add an attachment to a case or
@@ -440,6 +493,11 @@ namespace Model
          */
         virtual void DescribeAttachmentAsync(const Model::DescribeAttachmentRequest& request, const DescribeAttachmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeAttachmentAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeAttachmentAsync(Model::DescribeAttachmentRequest&& request, const DescribeAttachmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of cases that you specify by passing one or more case IDs. In
          * addition, you can filter the cases by date by setting values for the
@@ -472,6 +530,11 @@ namespace Model
          */
         virtual Model::DescribeCasesOutcomeCallable DescribeCasesCallable(const Model::DescribeCasesRequest& request) const;
 
+        /**
+         * Same as DescribeCasesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCasesOutcomeCallable DescribeCasesCallable(Model::DescribeCasesRequest&& request) const;
+
         /**
          * <p>Returns a list of cases that you specify by passing one or more case IDs. In
          * addition, you can filter the cases by date by setting values for the
@@ -489,6 +552,11 @@ namespace Model
          */
         virtual void DescribeCasesAsync(const Model::DescribeCasesRequest& request, const DescribeCasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCasesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCasesAsync(Model::DescribeCasesRequest&& request, const DescribeCasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns communications (and attachments) for one or more support cases. You
          * can use the <code>AfterTime</code> and <code>BeforeTime</code> parameters to
@@ -519,6 +587,11 @@ namespace Model
          */
         virtual Model::DescribeCommunicationsOutcomeCallable DescribeCommunicationsCallable(const Model::DescribeCommunicationsRequest& request) const;
 
+        /**
+         * Same as DescribeCommunicationsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeCommunicationsOutcomeCallable DescribeCommunicationsCallable(Model::DescribeCommunicationsRequest&& request) const;
+
         /**
          * <p>Returns communications (and attachments) for one or more support cases. You
          * can use the <code>AfterTime</code> and <code>BeforeTime</code> parameters to
@@ -535,6 +608,11 @@ namespace Model
          */
         virtual void DescribeCommunicationsAsync(const Model::DescribeCommunicationsRequest& request, const DescribeCommunicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeCommunicationsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeCommunicationsAsync(Model::DescribeCommunicationsRequest&& request, const DescribeCommunicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the current list of AWS services and a list of service categories
          * that applies to each one. You then use service names and categories in your
@@ -569,6 +647,11 @@ namespace Model
          */
         virtual Model::DescribeServicesOutcomeCallable DescribeServicesCallable(const Model::DescribeServicesRequest& request) const;
 
+        /**
+         * Same as DescribeServicesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeServicesOutcomeCallable DescribeServicesCallable(Model::DescribeServicesRequest&& request) const;
+
         /**
          * <p>Returns the current list of AWS services and a list of service categories
          * that applies to each one. You then use service names and categories in your
@@ -587,6 +670,11 @@ namespace Model
          */
         virtual void DescribeServicesAsync(const Model::DescribeServicesRequest& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeServicesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeServicesAsync(Model::DescribeServicesRequest&& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the list of severity levels that you can assign to an AWS Support
          * case. The severity level for a case is also a field in the <a>CaseDetails</a>
@@ -603,6 +691,11 @@ namespace Model
          */
         virtual Model::DescribeSeverityLevelsOutcomeCallable DescribeSeverityLevelsCallable(const Model::DescribeSeverityLevelsRequest& request) const;
 
+        /**
+         * Same as DescribeSeverityLevelsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeSeverityLevelsOutcomeCallable DescribeSeverityLevelsCallable(Model::DescribeSeverityLevelsRequest&& request) const;
+
         /**
          * <p>Returns the list of severity levels that you can assign to an AWS Support
          * case. The severity level for a case is also a field in the <a>CaseDetails</a>
@@ -612,6 +705,11 @@ namespace Model
          */
         virtual void DescribeSeverityLevelsAsync(const Model::DescribeSeverityLevelsRequest& request, const DescribeSeverityLevelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeSeverityLevelsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeSeverityLevelsAsync(Model::DescribeSeverityLevelsRequest&& request, const DescribeSeverityLevelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the refresh status of the Trusted Advisor checks that have the
          * specified check IDs. Check IDs can be obtained by calling
@@ -628,6 +726,11 @@ namespace Model
          */
         virtual Model::DescribeTrustedAdvisorCheckRefreshStatusesOutcomeCallable DescribeTrustedAdvisorCheckRefreshStatusesCallable(const Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest& request) const;
 
+        /**
+         * Same as DescribeTrustedAdvisorCheckRefreshStatusesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTrustedAdvisorCheckRefreshStatusesOutcomeCallable DescribeTrustedAdvisorCheckRefreshStatusesCallable(Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest&& request) const;
+
         /**
          * <p>Returns the refresh status of the Trusted Advisor checks that have the
          * specified check IDs. Check IDs can be obtained by calling
@@ -637,6 +740,11 @@ namespace Model
          */
         virtual void DescribeTrustedAdvisorCheckRefreshStatusesAsync(const Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest& request, const DescribeTrustedAdvisorCheckRefreshStatusesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTrustedAdvisorCheckRefreshStatusesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTrustedAdvisorCheckRefreshStatusesAsync(Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest&& request, const DescribeTrustedAdvisorCheckRefreshStatusesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the results of the Trusted Advisor check that has the specified check
          * ID. Check IDs can be obtained by calling
@@ -669,6 +777,11 @@ namespace Model
          */
         virtual Model::DescribeTrustedAdvisorCheckResultOutcomeCallable DescribeTrustedAdvisorCheckResultCallable(const Model::DescribeTrustedAdvisorCheckResultRequest& request) const;
 
+        /**
+         * Same as DescribeTrustedAdvisorCheckResultCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTrustedAdvisorCheckResultOutcomeCallable DescribeTrustedAdvisorCheckResultCallable(Model::DescribeTrustedAdvisorCheckResultRequest&& request) const;
+
         /**
          * <p>Returns the results of the Trusted Advisor check that has the specified check
          * ID. Check IDs can be obtained by calling
@@ -686,6 +799,11 @@ namespace Model
          */
         virtual void DescribeTrustedAdvisorCheckResultAsync(const Model::DescribeTrustedAdvisorCheckResultRequest& request, const DescribeTrustedAdvisorCheckResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTrustedAdvisorCheckResultAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTrustedAdvisorCheckResultAsync(Model::DescribeTrustedAdvisorCheckResultRequest&& request, const DescribeTrustedAdvisorCheckResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the summaries of the results of the Trusted Advisor checks that have
          * the specified check IDs. Check IDs can be obtained by calling
@@ -704,6 +822,11 @@ namespace Model
          */
         virtual Model::DescribeTrustedAdvisorCheckSummariesOutcomeCallable DescribeTrustedAdvisorCheckSummariesCallable(const Model::DescribeTrustedAdvisorCheckSummariesRequest& request) const;
 
+        /**
+         * Same as DescribeTrustedAdvisorCheckSummariesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTrustedAdvisorCheckSummariesOutcomeCallable DescribeTrustedAdvisorCheckSummariesCallable(Model::DescribeTrustedAdvisorCheckSummariesRequest&& request) const;
+
         /**
          * <p>Returns the summaries of the results of the Trusted Advisor checks that have
          * the specified check IDs. Check IDs can be obtained by calling
@@ -714,6 +837,11 @@ namespace Model
          */
         virtual void DescribeTrustedAdvisorCheckSummariesAsync(const Model::DescribeTrustedAdvisorCheckSummariesRequest& request, const DescribeTrustedAdvisorCheckSummariesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTrustedAdvisorCheckSummariesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTrustedAdvisorCheckSummariesAsync(Model::DescribeTrustedAdvisorCheckSummariesRequest&& request, const DescribeTrustedAdvisorCheckSummariesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about all available Trusted Advisor checks, including
          * name, ID, category, description, and metadata. You must specify a language code;
@@ -732,6 +860,11 @@ namespace Model
          */
         virtual Model::DescribeTrustedAdvisorChecksOutcomeCallable DescribeTrustedAdvisorChecksCallable(const Model::DescribeTrustedAdvisorChecksRequest& request) const;
 
+        /**
+         * Same as DescribeTrustedAdvisorChecksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeTrustedAdvisorChecksOutcomeCallable DescribeTrustedAdvisorChecksCallable(Model::DescribeTrustedAdvisorChecksRequest&& request) const;
+
         /**
          * <p>Returns information about all available Trusted Advisor checks, including
          * name, ID, category, description, and metadata. You must specify a language code;
@@ -742,6 +875,11 @@ namespace Model
          */
         virtual void DescribeTrustedAdvisorChecksAsync(const Model::DescribeTrustedAdvisorChecksRequest& request, const DescribeTrustedAdvisorChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeTrustedAdvisorChecksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeTrustedAdvisorChecksAsync(Model::DescribeTrustedAdvisorChecksRequest&& request, const DescribeTrustedAdvisorChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Requests a refresh of the Trusted Advisor check that has the specified check
          * ID. Check IDs can be obtained by calling
@@ -770,6 +908,11 @@ namespace Model
          */
         virtual Model::RefreshTrustedAdvisorCheckOutcomeCallable RefreshTrustedAdvisorCheckCallable(const Model::RefreshTrustedAdvisorCheckRequest& request) const;
 
+        /**
+         * Same as RefreshTrustedAdvisorCheckCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RefreshTrustedAdvisorCheckOutcomeCallable RefreshTrustedAdvisorCheckCallable(Model::RefreshTrustedAdvisorCheckRequest&& request) const;
+
         /**
          * <p>Requests a refresh of the Trusted Advisor check that has the specified check
          * ID. Check IDs can be obtained by calling
@@ -785,6 +928,11 @@ namespace Model
          */
         virtual void RefreshTrustedAdvisorCheckAsync(const Model::RefreshTrustedAdvisorCheckRequest& request, const RefreshTrustedAdvisorCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RefreshTrustedAdvisorCheckAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RefreshTrustedAdvisorCheckAsync(Model::RefreshTrustedAdvisorCheckRequest&& request, const RefreshTrustedAdvisorCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Takes a <code>CaseId</code> and returns the initial state of the case along
          * with the state of the case after the call to <a>ResolveCase</a> completed.</p>
@@ -799,6 +947,11 @@ namespace Model
          */
         virtual Model::ResolveCaseOutcomeCallable ResolveCaseCallable(const Model::ResolveCaseRequest& request) const;
 
+        /**
+         * Same as ResolveCaseCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ResolveCaseOutcomeCallable ResolveCaseCallable(Model::ResolveCaseRequest&& request) const;
+
         /**
          * <p>Takes a <code>CaseId</code> and returns the initial state of the case along
          * with the state of the case after the call to <a>ResolveCase</a> completed.</p>
@@ -807,6 +960,46 @@ namespace Model
          */
         virtual void ResolveCaseAsync(const Model::ResolveCaseRequest& request, const ResolveCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ResolveCaseAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ResolveCaseAsync(Model::ResolveCaseRequest&& request, const ResolveCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::AddAttachmentsToSetOutcome> AddAttachmentsToSetAwaitable(const Model::AddAttachmentsToSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::AddAttachmentsToSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddAttachmentsToSetOutcome> AddAttachmentsToSetAwaitable(Model::AddAttachmentsToSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::AddAttachmentsToSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddCommunicationToCaseOutcome> AddCommunicationToCaseAwaitable(const Model::AddCommunicationToCaseRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::AddCommunicationToCase, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::AddCommunicationToCaseOutcome> AddCommunicationToCaseAwaitable(Model::AddCommunicationToCaseRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::AddCommunicationToCase, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCaseOutcome> CreateCaseAwaitable(const Model::CreateCaseRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::CreateCase, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateCaseOutcome> CreateCaseAwaitable(Model::CreateCaseRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::CreateCase, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAttachmentOutcome> DescribeAttachmentAwaitable(const Model::DescribeAttachmentRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeAttachment, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeAttachmentOutcome> DescribeAttachmentAwaitable(Model::DescribeAttachmentRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeAttachment, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCasesOutcome> DescribeCasesAwaitable(const Model::DescribeCasesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeCases, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCasesOutcome> DescribeCasesAwaitable(Model::DescribeCasesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeCases, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCommunicationsOutcome> DescribeCommunicationsAwaitable(const Model::DescribeCommunicationsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeCommunications, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeCommunicationsOutcome> DescribeCommunicationsAwaitable(Model::DescribeCommunicationsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeCommunications, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeServicesOutcome> DescribeServicesAwaitable(const Model::DescribeServicesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeServices, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeServicesOutcome> DescribeServicesAwaitable(Model::DescribeServicesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeServices, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSeverityLevelsOutcome> DescribeSeverityLevelsAwaitable(const Model::DescribeSeverityLevelsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeSeverityLevels, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeSeverityLevelsOutcome> DescribeSeverityLevelsAwaitable(Model::DescribeSeverityLevelsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeSeverityLevels, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTrustedAdvisorCheckRefreshStatusesOutcome> DescribeTrustedAdvisorCheckRefreshStatusesAwaitable(const Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeTrustedAdvisorCheckRefreshStatuses, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTrustedAdvisorCheckRefreshStatusesOutcome> DescribeTrustedAdvisorCheckRefreshStatusesAwaitable(Model::DescribeTrustedAdvisorCheckRefreshStatusesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeTrustedAdvisorCheckRefreshStatuses, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTrustedAdvisorCheckResultOutcome> DescribeTrustedAdvisorCheckResultAwaitable(const Model::DescribeTrustedAdvisorCheckResultRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeTrustedAdvisorCheckResult, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTrustedAdvisorCheckResultOutcome> DescribeTrustedAdvisorCheckResultAwaitable(Model::DescribeTrustedAdvisorCheckResultRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeTrustedAdvisorCheckResult, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTrustedAdvisorCheckSummariesOutcome> DescribeTrustedAdvisorCheckSummariesAwaitable(const Model::DescribeTrustedAdvisorCheckSummariesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeTrustedAdvisorCheckSummaries, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTrustedAdvisorCheckSummariesOutcome> DescribeTrustedAdvisorCheckSummariesAwaitable(Model::DescribeTrustedAdvisorCheckSummariesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeTrustedAdvisorCheckSummaries, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTrustedAdvisorChecksOutcome> DescribeTrustedAdvisorChecksAwaitable(const Model::DescribeTrustedAdvisorChecksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeTrustedAdvisorChecks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeTrustedAdvisorChecksOutcome> DescribeTrustedAdvisorChecksAwaitable(Model::DescribeTrustedAdvisorChecksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::DescribeTrustedAdvisorChecks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RefreshTrustedAdvisorCheckOutcome> RefreshTrustedAdvisorCheckAwaitable(const Model::RefreshTrustedAdvisorCheckRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::RefreshTrustedAdvisorCheck, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RefreshTrustedAdvisorCheckOutcome> RefreshTrustedAdvisorCheckAwaitable(Model::RefreshTrustedAdvisorCheckRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::RefreshTrustedAdvisorCheck, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResolveCaseOutcome> ResolveCaseAwaitable(const Model::ResolveCaseRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::ResolveCase, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ResolveCaseOutcome> ResolveCaseAwaitable(Model::ResolveCaseRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SupportClient::ResolveCase, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
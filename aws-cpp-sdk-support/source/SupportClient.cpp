@@ -121,12 +121,22 @@ AddAttachmentsToSetOutcome SupportClient::AddAttachmentsToSet(const AddAttachmen
 
 AddAttachmentsToSetOutcomeCallable SupportClient::AddAttachmentsToSetCallable(const AddAttachmentsToSetRequest& request) const
 {
-  return std::async(std::launch::async, &SupportClient::AddAttachmentsToSet, this, request);
+  return m_executor->SubmitWithFuture(&SupportClient::AddAttachmentsToSet, Aws::Client::RejectedCallOutcome<AddAttachmentsToSetOutcome>(), this, request);
+}
+
+AddAttachmentsToSetOutcomeCallable SupportClient::AddAttachmentsToSetCallable(AddAttachmentsToSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SupportClient::AddAttachmentsToSet, Aws::Client::RejectedCallOutcome<AddAttachmentsToSetOutcome>(), this, std::move(request));
 }
 
 void SupportClient::AddAttachmentsToSetAsync(const AddAttachmentsToSetRequest& request, const AddAttachmentsToSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SupportClient::AddAttachmentsToSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SupportClient::AddAttachmentsToSetAsyncHelper, Aws::Client::RejectedAsyncCall<AddAttachmentsToSetOutcome>(), this, request, handler, context);
+}
+
+void SupportClient::AddAttachmentsToSetAsync(AddAttachmentsToSetRequest&& request, const AddAttachmentsToSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SupportClient::AddAttachmentsToSetAsyncHelper, Aws::Client::RejectedAsyncCall<AddAttachmentsToSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void SupportClient::AddAttachmentsToSetAsyncHelper(const AddAttachmentsToSetRequest& request, const AddAttachmentsToSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -152,12 +162,22 @@ AddCommunicationToCaseOutcome SupportClient::AddCommunicationToCase(const AddCom
 
 AddCommunicationToCaseOutcomeCallable SupportClient::AddCommunicationToCaseCallable(const AddCommunicationToCaseRequest& request) const
 {
-  return std::async(std::launch::async, &SupportClient::AddCommunicationToCase, this, request);
+  return m_executor->SubmitWithFuture(&SupportClient::AddCommunicationToCase, Aws::Client::RejectedCallOutcome<AddCommunicationToCaseOutcome>(), this, request);
+}
+
+AddCommunicationToCaseOutcomeCallable SupportClient::AddCommunicationToCaseCallable(AddCommunicationToCaseRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SupportClient::AddCommunicationToCase, Aws::Client::RejectedCallOutcome<AddCommunicationToCaseOutcome>(), this, std::move(request));
 }
 
 void SupportClient::AddCommunicationToCaseAsync(const AddCommunicationToCaseRequest& request, const AddCommunicationToCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SupportClient::AddCommunicationToCaseAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SupportClient::AddCommunicationToCaseAsyncHelper, Aws::Client::RejectedAsyncCall<AddCommunicationToCaseOutcome>(), this, request, handler, context);
+}
+
+void SupportClient::AddCommunicationToCaseAsync(AddCommunicationToCaseRequest&& request, const AddCommunicationToCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SupportClient::AddCommunicationToCaseAsyncHelper, Aws::Client::RejectedAsyncCall<AddCommunicationToCaseOutcome>(), this, std::move(request), handler, context);
 }
 
 void SupportClient::AddCommunicationToCaseAsyncHelper(const AddCommunicationToCaseRequest& request, const AddCommunicationToCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -183,12 +203,22 @@ CreateCaseOutcome SupportClient::CreateCase(const CreateCaseRequest& request) co
 
 CreateCaseOutcomeCallable SupportClient::CreateCaseCallable(const CreateCaseRequest& request) const
 {
-  return std::async(std::launch::async, &SupportClient::CreateCase, this, request);
+  return m_executor->SubmitWithFuture(&SupportClient::CreateCase, Aws::Client::RejectedCallOutcome<CreateCaseOutcome>(), this, request);
+}
+
+CreateCaseOutcomeCallable SupportClient::CreateCaseCallable(CreateCaseRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SupportClient::CreateCase, Aws::Client::RejectedCallOutcome<CreateCaseOutcome>(), this, std::move(request));
 }
 
 void SupportClient::CreateCaseAsync(const CreateCaseRequest& request, const CreateCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SupportClient::CreateCaseAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SupportClient::CreateCaseAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCaseOutcome>(), this, request, handler, context);
+}
+
+void SupportClient::CreateCaseAsync(CreateCaseRequest&& request, const CreateCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SupportClient::CreateCaseAsyncHelper, Aws::Client::RejectedAsyncCall<CreateCaseOutcome>(), this, std::move(request), handler, context);
 }
 
 void SupportClient::CreateCaseAsyncHelper(const CreateCaseRequest& request, const CreateCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -214,12 +244,22 @@ DescribeAttachmentOutcome SupportClient::DescribeAttachment(const DescribeAttach
 
 DescribeAttachmentOutcomeCallable SupportClient::DescribeAttachmentCallable(const DescribeAttachmentRequest& request) const
 {
-  return std::async(std::launch::async, &SupportClient::DescribeAttachment, this, request);
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeAttachment, Aws::Client::RejectedCallOutcome<DescribeAttachmentOutcome>(), this, request);
+}
+
+DescribeAttachmentOutcomeCallable SupportClient::DescribeAttachmentCallable(DescribeAttachmentRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeAttachment, Aws::Client::RejectedCallOutcome<DescribeAttachmentOutcome>(), this, std::move(request));
 }
 
 void SupportClient::DescribeAttachmentAsync(const DescribeAttachmentRequest& request, const DescribeAttachmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SupportClient::DescribeAttachmentAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SupportClient::DescribeAttachmentAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAttachmentOutcome>(), this, request, handler, context);
+}
+
+void SupportClient::DescribeAttachmentAsync(DescribeAttachmentRequest&& request, const DescribeAttachmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SupportClient::DescribeAttachmentAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeAttachmentOutcome>(), this, std::move(request), handler, context);
 }
 
 void SupportClient::DescribeAttachmentAsyncHelper(const DescribeAttachmentRequest& request, const DescribeAttachmentResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -245,12 +285,22 @@ DescribeCasesOutcome SupportClient::DescribeCases(const DescribeCasesRequest& re
 
 DescribeCasesOutcomeCallable SupportClient::DescribeCasesCallable(const DescribeCasesRequest& request) const
 {
-  return std::async(std::launch::async, &SupportClient::DescribeCases, this, request);
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeCases, Aws::Client::RejectedCallOutcome<DescribeCasesOutcome>(), this, request);
+}
+
+DescribeCasesOutcomeCallable SupportClient::DescribeCasesCallable(DescribeCasesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeCases, Aws::Client::RejectedCallOutcome<DescribeCasesOutcome>(), this, std::move(request));
 }
 
 void SupportClient::DescribeCasesAsync(const DescribeCasesRequest& request, const DescribeCasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SupportClient::DescribeCasesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SupportClient::DescribeCasesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCasesOutcome>(), this, request, handler, context);
+}
+
+void SupportClient::DescribeCasesAsync(DescribeCasesRequest&& request, const DescribeCasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SupportClient::DescribeCasesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCasesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SupportClient::DescribeCasesAsyncHelper(const DescribeCasesRequest& request, const DescribeCasesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -276,12 +326,22 @@ DescribeCommunicationsOutcome SupportClient::DescribeCommunications(const Descri
 
 DescribeCommunicationsOutcomeCallable SupportClient::DescribeCommunicationsCallable(const DescribeCommunicationsRequest& request) const
 {
-  return std::async(std::launch::async, &SupportClient::DescribeCommunications, this, request);
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeCommunications, Aws::Client::RejectedCallOutcome<DescribeCommunicationsOutcome>(), this, request);
+}
+
+DescribeCommunicationsOutcomeCallable SupportClient::DescribeCommunicationsCallable(DescribeCommunicationsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeCommunications, Aws::Client::RejectedCallOutcome<DescribeCommunicationsOutcome>(), this, std::move(request));
 }
 
 void SupportClient::DescribeCommunicationsAsync(const DescribeCommunicationsRequest& request, const DescribeCommunicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SupportClient::DescribeCommunicationsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SupportClient::DescribeCommunicationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCommunicationsOutcome>(), this, request, handler, context);
+}
+
+void SupportClient::DescribeCommunicationsAsync(DescribeCommunicationsRequest&& request, const DescribeCommunicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SupportClient::DescribeCommunicationsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeCommunicationsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SupportClient::DescribeCommunicationsAsyncHelper(const DescribeCommunicationsRequest& request, const DescribeCommunicationsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -307,12 +367,22 @@ DescribeServicesOutcome SupportClient::DescribeServices(const DescribeServicesRe
 
 DescribeServicesOutcomeCallable SupportClient::DescribeServicesCallable(const DescribeServicesRequest& request) const
 {
-  return std::async(std::launch::async, &SupportClient::DescribeServices, this, request);
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeServices, Aws::Client::RejectedCallOutcome<DescribeServicesOutcome>(), this, request);
+}
+
+DescribeServicesOutcomeCallable SupportClient::DescribeServicesCallable(DescribeServicesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeServices, Aws::Client::RejectedCallOutcome<DescribeServicesOutcome>(), this, std::move(request));
 }
 
 void SupportClient::DescribeServicesAsync(const DescribeServicesRequest& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SupportClient::DescribeServicesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SupportClient::DescribeServicesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeServicesOutcome>(), this, request, handler, context);
+}
+
+void SupportClient::DescribeServicesAsync(DescribeServicesRequest&& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SupportClient::DescribeServicesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeServicesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SupportClient::DescribeServicesAsyncHelper(const DescribeServicesRequest& request, const DescribeServicesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -338,12 +408,22 @@ DescribeSeverityLevelsOutcome SupportClient::DescribeSeverityLevels(const Descri
 
 DescribeSeverityLevelsOutcomeCallable SupportClient::DescribeSeverityLevelsCallable(const DescribeSeverityLevelsRequest& request) const
 {
-  return std::async(std::launch::async, &SupportClient::DescribeSeverityLevels, this, request);
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeSeverityLevels, Aws::Client::RejectedCallOutcome<DescribeSeverityLevelsOutcome>(), this, request);
+}
+
+DescribeSeverityLevelsOutcomeCallable SupportClient::DescribeSeverityLevelsCallable(DescribeSeverityLevelsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeSeverityLevels, Aws::Client::RejectedCallOutcome<DescribeSeverityLevelsOutcome>(), this, std::move(request));
 }
 
 void SupportClient::DescribeSeverityLevelsAsync(const DescribeSeverityLevelsRequest& request, const DescribeSeverityLevelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SupportClient::DescribeSeverityLevelsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SupportClient::DescribeSeverityLevelsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSeverityLevelsOutcome>(), this, request, handler, context);
+}
+
+void SupportClient::DescribeSeverityLevelsAsync(DescribeSeverityLevelsRequest&& request, const DescribeSeverityLevelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SupportClient::DescribeSeverityLevelsAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeSeverityLevelsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SupportClient::DescribeSeverityLevelsAsyncHelper(const DescribeSeverityLevelsRequest& request, const DescribeSeverityLevelsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -369,12 +449,22 @@ DescribeTrustedAdvisorCheckRefreshStatusesOutcome SupportClient::DescribeTrusted
 
 DescribeTrustedAdvisorCheckRefreshStatusesOutcomeCallable SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesCallable(const DescribeTrustedAdvisorCheckRefreshStatusesRequest& request) const
 {
-  return std::async(std::launch::async, &SupportClient::DescribeTrustedAdvisorCheckRefreshStatuses, this, request);
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeTrustedAdvisorCheckRefreshStatuses, Aws::Client::RejectedCallOutcome<DescribeTrustedAdvisorCheckRefreshStatusesOutcome>(), this, request);
+}
+
+DescribeTrustedAdvisorCheckRefreshStatusesOutcomeCallable SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesCallable(DescribeTrustedAdvisorCheckRefreshStatusesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeTrustedAdvisorCheckRefreshStatuses, Aws::Client::RejectedCallOutcome<DescribeTrustedAdvisorCheckRefreshStatusesOutcome>(), this, std::move(request));
 }
 
 void SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesAsync(const DescribeTrustedAdvisorCheckRefreshStatusesRequest& request, const DescribeTrustedAdvisorCheckRefreshStatusesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTrustedAdvisorCheckRefreshStatusesOutcome>(), this, request, handler, context);
+}
+
+void SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesAsync(DescribeTrustedAdvisorCheckRefreshStatusesRequest&& request, const DescribeTrustedAdvisorCheckRefreshStatusesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTrustedAdvisorCheckRefreshStatusesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SupportClient::DescribeTrustedAdvisorCheckRefreshStatusesAsyncHelper(const DescribeTrustedAdvisorCheckRefreshStatusesRequest& request, const DescribeTrustedAdvisorCheckRefreshStatusesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -400,12 +490,22 @@ DescribeTrustedAdvisorCheckResultOutcome SupportClient::DescribeTrustedAdvisorCh
 
 DescribeTrustedAdvisorCheckResultOutcomeCallable SupportClient::DescribeTrustedAdvisorCheckResultCallable(const DescribeTrustedAdvisorCheckResultRequest& request) const
 {
-  return std::async(std::launch::async, &SupportClient::DescribeTrustedAdvisorCheckResult, this, request);
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeTrustedAdvisorCheckResult, Aws::Client::RejectedCallOutcome<DescribeTrustedAdvisorCheckResultOutcome>(), this, request);
+}
+
+DescribeTrustedAdvisorCheckResultOutcomeCallable SupportClient::DescribeTrustedAdvisorCheckResultCallable(DescribeTrustedAdvisorCheckResultRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeTrustedAdvisorCheckResult, Aws::Client::RejectedCallOutcome<DescribeTrustedAdvisorCheckResultOutcome>(), this, std::move(request));
 }
 
 void SupportClient::DescribeTrustedAdvisorCheckResultAsync(const DescribeTrustedAdvisorCheckResultRequest& request, const DescribeTrustedAdvisorCheckResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SupportClient::DescribeTrustedAdvisorCheckResultAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SupportClient::DescribeTrustedAdvisorCheckResultAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTrustedAdvisorCheckResultOutcome>(), this, request, handler, context);
+}
+
+void SupportClient::DescribeTrustedAdvisorCheckResultAsync(DescribeTrustedAdvisorCheckResultRequest&& request, const DescribeTrustedAdvisorCheckResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SupportClient::DescribeTrustedAdvisorCheckResultAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTrustedAdvisorCheckResultOutcome>(), this, std::move(request), handler, context);
 }
 
 void SupportClient::DescribeTrustedAdvisorCheckResultAsyncHelper(const DescribeTrustedAdvisorCheckResultRequest& request, const DescribeTrustedAdvisorCheckResultResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -431,12 +531,22 @@ DescribeTrustedAdvisorCheckSummariesOutcome SupportClient::DescribeTrustedAdviso
 
 DescribeTrustedAdvisorCheckSummariesOutcomeCallable SupportClient::DescribeTrustedAdvisorCheckSummariesCallable(const DescribeTrustedAdvisorCheckSummariesRequest& request) const
 {
-  return std::async(std::launch::async, &SupportClient::DescribeTrustedAdvisorCheckSummaries, this, request);
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeTrustedAdvisorCheckSummaries, Aws::Client::RejectedCallOutcome<DescribeTrustedAdvisorCheckSummariesOutcome>(), this, request);
+}
+
+DescribeTrustedAdvisorCheckSummariesOutcomeCallable SupportClient::DescribeTrustedAdvisorCheckSummariesCallable(DescribeTrustedAdvisorCheckSummariesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeTrustedAdvisorCheckSummaries, Aws::Client::RejectedCallOutcome<DescribeTrustedAdvisorCheckSummariesOutcome>(), this, std::move(request));
 }
 
 void SupportClient::DescribeTrustedAdvisorCheckSummariesAsync(const DescribeTrustedAdvisorCheckSummariesRequest& request, const DescribeTrustedAdvisorCheckSummariesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SupportClient::DescribeTrustedAdvisorCheckSummariesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SupportClient::DescribeTrustedAdvisorCheckSummariesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTrustedAdvisorCheckSummariesOutcome>(), this, request, handler, context);
+}
+
+void SupportClient::DescribeTrustedAdvisorCheckSummariesAsync(DescribeTrustedAdvisorCheckSummariesRequest&& request, const DescribeTrustedAdvisorCheckSummariesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SupportClient::DescribeTrustedAdvisorCheckSummariesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTrustedAdvisorCheckSummariesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SupportClient::DescribeTrustedAdvisorCheckSummariesAsyncHelper(const DescribeTrustedAdvisorCheckSummariesRequest& request, const DescribeTrustedAdvisorCheckSummariesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -462,12 +572,22 @@ DescribeTrustedAdvisorChecksOutcome SupportClient::DescribeTrustedAdvisorChecks(
 
 DescribeTrustedAdvisorChecksOutcomeCallable SupportClient::DescribeTrustedAdvisorChecksCallable(const DescribeTrustedAdvisorChecksRequest& request) const
 {
-  return std::async(std::launch::async, &SupportClient::DescribeTrustedAdvisorChecks, this, request);
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeTrustedAdvisorChecks, Aws::Client::RejectedCallOutcome<DescribeTrustedAdvisorChecksOutcome>(), this, request);
+}
+
+DescribeTrustedAdvisorChecksOutcomeCallable SupportClient::DescribeTrustedAdvisorChecksCallable(DescribeTrustedAdvisorChecksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SupportClient::DescribeTrustedAdvisorChecks, Aws::Client::RejectedCallOutcome<DescribeTrustedAdvisorChecksOutcome>(), this, std::move(request));
 }
 
 void SupportClient::DescribeTrustedAdvisorChecksAsync(const DescribeTrustedAdvisorChecksRequest& request, const DescribeTrustedAdvisorChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SupportClient::DescribeTrustedAdvisorChecksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SupportClient::DescribeTrustedAdvisorChecksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTrustedAdvisorChecksOutcome>(), this, request, handler, context);
+}
+
+void SupportClient::DescribeTrustedAdvisorChecksAsync(DescribeTrustedAdvisorChecksRequest&& request, const DescribeTrustedAdvisorChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SupportClient::DescribeTrustedAdvisorChecksAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeTrustedAdvisorChecksOutcome>(), this, std::move(request), handler, context);
 }
 
 void SupportClient::DescribeTrustedAdvisorChecksAsyncHelper(const DescribeTrustedAdvisorChecksRequest& request, const DescribeTrustedAdvisorChecksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -493,12 +613,22 @@ RefreshTrustedAdvisorCheckOutcome SupportClient::RefreshTrustedAdvisorCheck(cons
 
 RefreshTrustedAdvisorCheckOutcomeCallable SupportClient::RefreshTrustedAdvisorCheckCallable(const RefreshTrustedAdvisorCheckRequest& request) const
 {
-  return std::async(std::launch::async, &SupportClient::RefreshTrustedAdvisorCheck, this, request);
+  return m_executor->SubmitWithFuture(&SupportClient::RefreshTrustedAdvisorCheck, Aws::Client::RejectedCallOutcome<RefreshTrustedAdvisorCheckOutcome>(), this, request);
+}
+
+RefreshTrustedAdvisorCheckOutcomeCallable SupportClient::RefreshTrustedAdvisorCheckCallable(RefreshTrustedAdvisorCheckRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SupportClient::RefreshTrustedAdvisorCheck, Aws::Client::RejectedCallOutcome<RefreshTrustedAdvisorCheckOutcome>(), this, std::move(request));
 }
 
 void SupportClient::RefreshTrustedAdvisorCheckAsync(const RefreshTrustedAdvisorCheckRequest& request, const RefreshTrustedAdvisorCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SupportClient::RefreshTrustedAdvisorCheckAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SupportClient::RefreshTrustedAdvisorCheckAsyncHelper, Aws::Client::RejectedAsyncCall<RefreshTrustedAdvisorCheckOutcome>(), this, request, handler, context);
+}
+
+void SupportClient::RefreshTrustedAdvisorCheckAsync(RefreshTrustedAdvisorCheckRequest&& request, const RefreshTrustedAdvisorCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SupportClient::RefreshTrustedAdvisorCheckAsyncHelper, Aws::Client::RejectedAsyncCall<RefreshTrustedAdvisorCheckOutcome>(), this, std::move(request), handler, context);
 }
 
 void SupportClient::RefreshTrustedAdvisorCheckAsyncHelper(const RefreshTrustedAdvisorCheckRequest& request, const RefreshTrustedAdvisorCheckResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -524,12 +654,22 @@ ResolveCaseOutcome SupportClient::ResolveCase(const ResolveCaseRequest& request)
 
 ResolveCaseOutcomeCallable SupportClient::ResolveCaseCallable(const ResolveCaseRequest& request) const
 {
-  return std::async(std::launch::async, &SupportClient::ResolveCase, this, request);
+  return m_executor->SubmitWithFuture(&SupportClient::ResolveCase, Aws::Client::RejectedCallOutcome<ResolveCaseOutcome>(), this, request);
+}
+
+ResolveCaseOutcomeCallable SupportClient::ResolveCaseCallable(ResolveCaseRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SupportClient::ResolveCase, Aws::Client::RejectedCallOutcome<ResolveCaseOutcome>(), this, std::move(request));
 }
 
 void SupportClient::ResolveCaseAsync(const ResolveCaseRequest& request, const ResolveCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SupportClient::ResolveCaseAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SupportClient::ResolveCaseAsyncHelper, Aws::Client::RejectedAsyncCall<ResolveCaseOutcome>(), this, request, handler, context);
+}
+
+void SupportClient::ResolveCaseAsync(ResolveCaseRequest&& request, const ResolveCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SupportClient::ResolveCaseAsyncHelper, Aws::Client::RejectedAsyncCall<ResolveCaseOutcome>(), this, std::move(request), handler, context);
 }
 
 void SupportClient::ResolveCaseAsyncHelper(const ResolveCaseRequest& request, const ResolveCaseResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
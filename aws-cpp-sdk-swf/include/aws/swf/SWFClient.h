@@ -41,6 +41,41 @@
 #include <aws/core/NoResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/swf/model/CountClosedWorkflowExecutionsRequest.h>
+#include <aws/swf/model/CountOpenWorkflowExecutionsRequest.h>
+#include <aws/swf/model/CountPendingActivityTasksRequest.h>
+#include <aws/swf/model/CountPendingDecisionTasksRequest.h>
+#include <aws/swf/model/DeprecateActivityTypeRequest.h>
+#include <aws/swf/model/DeprecateDomainRequest.h>
+#include <aws/swf/model/DeprecateWorkflowTypeRequest.h>
+#include <aws/swf/model/DescribeActivityTypeRequest.h>
+#include <aws/swf/model/DescribeDomainRequest.h>
+#include <aws/swf/model/DescribeWorkflowExecutionRequest.h>
+#include <aws/swf/model/DescribeWorkflowTypeRequest.h>
+#include <aws/swf/model/GetWorkflowExecutionHistoryRequest.h>
+#include <aws/swf/model/ListActivityTypesRequest.h>
+#include <aws/swf/model/ListClosedWorkflowExecutionsRequest.h>
+#include <aws/swf/model/ListDomainsRequest.h>
+#include <aws/swf/model/ListOpenWorkflowExecutionsRequest.h>
+#include <aws/swf/model/ListWorkflowTypesRequest.h>
+#include <aws/swf/model/PollForActivityTaskRequest.h>
+#include <aws/swf/model/PollForDecisionTaskRequest.h>
+#include <aws/swf/model/RecordActivityTaskHeartbeatRequest.h>
+#include <aws/swf/model/RegisterActivityTypeRequest.h>
+#include <aws/swf/model/RegisterDomainRequest.h>
+#include <aws/swf/model/RegisterWorkflowTypeRequest.h>
+#include <aws/swf/model/RequestCancelWorkflowExecutionRequest.h>
+#include <aws/swf/model/RespondActivityTaskCanceledRequest.h>
+#include <aws/swf/model/RespondActivityTaskCompletedRequest.h>
+#include <aws/swf/model/RespondActivityTaskFailedRequest.h>
+#include <aws/swf/model/RespondDecisionTaskCompletedRequest.h>
+#include <aws/swf/model/SignalWorkflowExecutionRequest.h>
+#include <aws/swf/model/StartWorkflowExecutionRequest.h>
+#include <aws/swf/model/TerminateWorkflowExecutionRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -307,6 +342,11 @@ namespace Model
          */
         virtual Model::CountClosedWorkflowExecutionsOutcomeCallable CountClosedWorkflowExecutionsCallable(const Model::CountClosedWorkflowExecutionsRequest& request) const;
 
+        /**
+         * Same as CountClosedWorkflowExecutionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CountClosedWorkflowExecutionsOutcomeCallable CountClosedWorkflowExecutionsCallable(Model::CountClosedWorkflowExecutionsRequest&& request) const;
+
         /**
          * <p>Returns the number of closed workflow executions within the given domain that
          * meet the specified filtering criteria.</p> <note>This operation is eventually
@@ -333,6 +373,11 @@ namespace Model
          */
         virtual void CountClosedWorkflowExecutionsAsync(const Model::CountClosedWorkflowExecutionsRequest& request, const CountClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CountClosedWorkflowExecutionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CountClosedWorkflowExecutionsAsync(Model::CountClosedWorkflowExecutionsRequest&& request, const CountClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the number of open workflow executions within the given domain that
          * meet the specified filtering criteria.</p> <note>This operation is eventually
@@ -383,6 +428,11 @@ namespace Model
          */
         virtual Model::CountOpenWorkflowExecutionsOutcomeCallable CountOpenWorkflowExecutionsCallable(const Model::CountOpenWorkflowExecutionsRequest& request) const;
 
+        /**
+         * Same as CountOpenWorkflowExecutionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CountOpenWorkflowExecutionsOutcomeCallable CountOpenWorkflowExecutionsCallable(Model::CountOpenWorkflowExecutionsRequest&& request) const;
+
         /**
          * <p>Returns the number of open workflow executions within the given domain that
          * meet the specified filtering criteria.</p> <note>This operation is eventually
@@ -409,6 +459,11 @@ namespace Model
          */
         virtual void CountOpenWorkflowExecutionsAsync(const Model::CountOpenWorkflowExecutionsRequest& request, const CountOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CountOpenWorkflowExecutionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CountOpenWorkflowExecutionsAsync(Model::CountOpenWorkflowExecutionsRequest&& request, const CountOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the estimated number of activity tasks in the specified task list.
          * The count returned is an approximation and is not guaranteed to be exact. If you
@@ -453,6 +508,11 @@ namespace Model
          */
         virtual Model::CountPendingActivityTasksOutcomeCallable CountPendingActivityTasksCallable(const Model::CountPendingActivityTasksRequest& request) const;
 
+        /**
+         * Same as CountPendingActivityTasksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CountPendingActivityTasksOutcomeCallable CountPendingActivityTasksCallable(Model::CountPendingActivityTasksRequest&& request) const;
+
         /**
          * <p>Returns the estimated number of activity tasks in the specified task list.
          * The count returned is an approximation and is not guaranteed to be exact. If you
@@ -476,6 +536,11 @@ namespace Model
          */
         virtual void CountPendingActivityTasksAsync(const Model::CountPendingActivityTasksRequest& request, const CountPendingActivityTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CountPendingActivityTasksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CountPendingActivityTasksAsync(Model::CountPendingActivityTasksRequest&& request, const CountPendingActivityTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the estimated number of decision tasks in the specified task list.
          * The count returned is an approximation and is not guaranteed to be exact. If you
@@ -520,6 +585,11 @@ namespace Model
          */
         virtual Model::CountPendingDecisionTasksOutcomeCallable CountPendingDecisionTasksCallable(const Model::CountPendingDecisionTasksRequest& request) const;
 
+        /**
+         * Same as CountPendingDecisionTasksCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CountPendingDecisionTasksOutcomeCallable CountPendingDecisionTasksCallable(Model::CountPendingDecisionTasksRequest&& request) const;
+
         /**
          * <p>Returns the estimated number of decision tasks in the specified task list.
          * The count returned is an approximation and is not guaranteed to be exact. If you
@@ -543,6 +613,11 @@ namespace Model
          */
         virtual void CountPendingDecisionTasksAsync(const Model::CountPendingDecisionTasksRequest& request, const CountPendingDecisionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CountPendingDecisionTasksAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CountPendingDecisionTasksAsync(Model::CountPendingDecisionTasksRequest&& request, const CountPendingDecisionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deprecates the specified <i>activity type</i>. After an activity type has
          * been deprecated, you cannot create new tasks of that activity type. Tasks of
@@ -593,6 +668,11 @@ namespace Model
          */
         virtual Model::DeprecateActivityTypeOutcomeCallable DeprecateActivityTypeCallable(const Model::DeprecateActivityTypeRequest& request) const;
 
+        /**
+         * Same as DeprecateActivityTypeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeprecateActivityTypeOutcomeCallable DeprecateActivityTypeCallable(Model::DeprecateActivityTypeRequest&& request) const;
+
         /**
          * <p>Deprecates the specified <i>activity type</i>. After an activity type has
          * been deprecated, you cannot create new tasks of that activity type. Tasks of
@@ -619,6 +699,11 @@ namespace Model
          */
         virtual void DeprecateActivityTypeAsync(const Model::DeprecateActivityTypeRequest& request, const DeprecateActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeprecateActivityTypeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeprecateActivityTypeAsync(Model::DeprecateActivityTypeRequest&& request, const DeprecateActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deprecates the specified domain. After a domain has been deprecated it cannot
          * be used to create new workflow executions or register new types. However, you
@@ -667,6 +752,11 @@ namespace Model
          */
         virtual Model::DeprecateDomainOutcomeCallable DeprecateDomainCallable(const Model::DeprecateDomainRequest& request) const;
 
+        /**
+         * Same as DeprecateDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeprecateDomainOutcomeCallable DeprecateDomainCallable(Model::DeprecateDomainRequest&& request) const;
+
         /**
          * <p>Deprecates the specified domain. After a domain has been deprecated it cannot
          * be used to create new workflow executions or register new types. However, you
@@ -692,6 +782,11 @@ namespace Model
          */
         virtual void DeprecateDomainAsync(const Model::DeprecateDomainRequest& request, const DeprecateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeprecateDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeprecateDomainAsync(Model::DeprecateDomainRequest&& request, const DeprecateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Deprecates the specified <i>workflow type</i>. After a workflow type has been
          * deprecated, you cannot create new executions of that type. Executions that were
@@ -744,6 +839,11 @@ namespace Model
          */
         virtual Model::DeprecateWorkflowTypeOutcomeCallable DeprecateWorkflowTypeCallable(const Model::DeprecateWorkflowTypeRequest& request) const;
 
+        /**
+         * Same as DeprecateWorkflowTypeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeprecateWorkflowTypeOutcomeCallable DeprecateWorkflowTypeCallable(Model::DeprecateWorkflowTypeRequest&& request) const;
+
         /**
          * <p>Deprecates the specified <i>workflow type</i>. After a workflow type has been
          * deprecated, you cannot create new executions of that type. Executions that were
@@ -771,6 +871,11 @@ namespace Model
          */
         virtual void DeprecateWorkflowTypeAsync(const Model::DeprecateWorkflowTypeRequest& request, const DeprecateWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeprecateWorkflowTypeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeprecateWorkflowTypeAsync(Model::DeprecateWorkflowTypeRequest&& request, const DeprecateWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the specified activity type. This includes
          * configuration settings provided when the type was registered and other general
@@ -815,6 +920,11 @@ namespace Model
          */
         virtual Model::DescribeActivityTypeOutcomeCallable DescribeActivityTypeCallable(const Model::DescribeActivityTypeRequest& request) const;
 
+        /**
+         * Same as DescribeActivityTypeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeActivityTypeOutcomeCallable DescribeActivityTypeCallable(Model::DescribeActivityTypeRequest&& request) const;
+
         /**
          * <p>Returns information about the specified activity type. This includes
          * configuration settings provided when the type was registered and other general
@@ -838,6 +948,11 @@ namespace Model
          */
         virtual void DescribeActivityTypeAsync(const Model::DescribeActivityTypeRequest& request, const DescribeActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeActivityTypeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeActivityTypeAsync(Model::DescribeActivityTypeRequest&& request, const DescribeActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the specified domain, including description and
          * status.</p> <p><b>Access Control</b></p> <p>You can use IAM policies to control
@@ -874,6 +989,11 @@ namespace Model
          */
         virtual Model::DescribeDomainOutcomeCallable DescribeDomainCallable(const Model::DescribeDomainRequest& request) const;
 
+        /**
+         * Same as DescribeDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeDomainOutcomeCallable DescribeDomainCallable(Model::DescribeDomainRequest&& request) const;
+
         /**
          * <p>Returns information about the specified domain, including description and
          * status.</p> <p><b>Access Control</b></p> <p>You can use IAM policies to control
@@ -893,6 +1013,11 @@ namespace Model
          */
         virtual void DescribeDomainAsync(const Model::DescribeDomainRequest& request, const DescribeDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeDomainAsync(Model::DescribeDomainRequest&& request, const DescribeDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the specified workflow execution including its type
          * and some statistics.</p> <note>This operation is eventually consistent. The
@@ -933,6 +1058,11 @@ namespace Model
          */
         virtual Model::DescribeWorkflowExecutionOutcomeCallable DescribeWorkflowExecutionCallable(const Model::DescribeWorkflowExecutionRequest& request) const;
 
+        /**
+         * Same as DescribeWorkflowExecutionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeWorkflowExecutionOutcomeCallable DescribeWorkflowExecutionCallable(Model::DescribeWorkflowExecutionRequest&& request) const;
+
         /**
          * <p>Returns information about the specified workflow execution including its type
          * and some statistics.</p> <note>This operation is eventually consistent. The
@@ -954,6 +1084,11 @@ namespace Model
          */
         virtual void DescribeWorkflowExecutionAsync(const Model::DescribeWorkflowExecutionRequest& request, const DescribeWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeWorkflowExecutionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeWorkflowExecutionAsync(Model::DescribeWorkflowExecutionRequest&& request, const DescribeWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about the specified <i>workflow type</i>. This includes
          * configuration settings specified when the type was registered and other
@@ -1000,6 +1135,11 @@ namespace Model
          */
         virtual Model::DescribeWorkflowTypeOutcomeCallable DescribeWorkflowTypeCallable(const Model::DescribeWorkflowTypeRequest& request) const;
 
+        /**
+         * Same as DescribeWorkflowTypeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeWorkflowTypeOutcomeCallable DescribeWorkflowTypeCallable(Model::DescribeWorkflowTypeRequest&& request) const;
+
         /**
          * <p>Returns information about the specified <i>workflow type</i>. This includes
          * configuration settings specified when the type was registered and other
@@ -1024,6 +1164,11 @@ namespace Model
          */
         virtual void DescribeWorkflowTypeAsync(const Model::DescribeWorkflowTypeRequest& request, const DescribeWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeWorkflowTypeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeWorkflowTypeAsync(Model::DescribeWorkflowTypeRequest&& request, const DescribeWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the history of the specified workflow execution. The results may be
          * split into multiple pages. To retrieve subsequent pages, make the call again
@@ -1068,6 +1213,11 @@ namespace Model
          */
         virtual Model::GetWorkflowExecutionHistoryOutcomeCallable GetWorkflowExecutionHistoryCallable(const Model::GetWorkflowExecutionHistoryRequest& request) const;
 
+        /**
+         * Same as GetWorkflowExecutionHistoryCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetWorkflowExecutionHistoryOutcomeCallable GetWorkflowExecutionHistoryCallable(Model::GetWorkflowExecutionHistoryRequest&& request) const;
+
         /**
          * <p>Returns the history of the specified workflow execution. The results may be
          * split into multiple pages. To retrieve subsequent pages, make the call again
@@ -1091,6 +1241,11 @@ namespace Model
          */
         virtual void GetWorkflowExecutionHistoryAsync(const Model::GetWorkflowExecutionHistoryRequest& request, const GetWorkflowExecutionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetWorkflowExecutionHistoryAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetWorkflowExecutionHistoryAsync(Model::GetWorkflowExecutionHistoryRequest&& request, const GetWorkflowExecutionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about all activities registered in the specified domain
          * that match the specified name and registration status. The result includes
@@ -1135,6 +1290,11 @@ namespace Model
          */
         virtual Model::ListActivityTypesOutcomeCallable ListActivityTypesCallable(const Model::ListActivityTypesRequest& request) const;
 
+        /**
+         * Same as ListActivityTypesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListActivityTypesOutcomeCallable ListActivityTypesCallable(Model::ListActivityTypesRequest&& request) const;
+
         /**
          * <p>Returns information about all activities registered in the specified domain
          * that match the specified name and registration status. The result includes
@@ -1158,6 +1318,11 @@ namespace Model
          */
         virtual void ListActivityTypesAsync(const Model::ListActivityTypesRequest& request, const ListActivityTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListActivityTypesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListActivityTypesAsync(Model::ListActivityTypesRequest&& request, const ListActivityTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of closed workflow executions in the specified domain that
          * meet the filtering criteria. The results may be split into multiple pages. To
@@ -1212,6 +1377,11 @@ namespace Model
          */
         virtual Model::ListClosedWorkflowExecutionsOutcomeCallable ListClosedWorkflowExecutionsCallable(const Model::ListClosedWorkflowExecutionsRequest& request) const;
 
+        /**
+         * Same as ListClosedWorkflowExecutionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListClosedWorkflowExecutionsOutcomeCallable ListClosedWorkflowExecutionsCallable(Model::ListClosedWorkflowExecutionsRequest&& request) const;
+
         /**
          * <p>Returns a list of closed workflow executions in the specified domain that
          * meet the filtering criteria. The results may be split into multiple pages. To
@@ -1240,6 +1410,11 @@ namespace Model
          */
         virtual void ListClosedWorkflowExecutionsAsync(const Model::ListClosedWorkflowExecutionsRequest& request, const ListClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListClosedWorkflowExecutionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListClosedWorkflowExecutionsAsync(Model::ListClosedWorkflowExecutionsRequest&& request, const ListClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the list of domains registered in the account. The results may be
          * split into multiple pages. To retrieve subsequent pages, make the call again
@@ -1286,6 +1461,11 @@ namespace Model
          */
         virtual Model::ListDomainsOutcomeCallable ListDomainsCallable(const Model::ListDomainsRequest& request) const;
 
+        /**
+         * Same as ListDomainsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListDomainsOutcomeCallable ListDomainsCallable(Model::ListDomainsRequest&& request) const;
+
         /**
          * <p>Returns the list of domains registered in the account. The results may be
          * split into multiple pages. To retrieve subsequent pages, make the call again
@@ -1310,6 +1490,11 @@ namespace Model
          */
         virtual void ListDomainsAsync(const Model::ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListDomainsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListDomainsAsync(Model::ListDomainsRequest&& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns a list of open workflow executions in the specified domain that meet
          * the filtering criteria. The results may be split into multiple pages. To
@@ -1364,6 +1549,11 @@ namespace Model
          */
         virtual Model::ListOpenWorkflowExecutionsOutcomeCallable ListOpenWorkflowExecutionsCallable(const Model::ListOpenWorkflowExecutionsRequest& request) const;
 
+        /**
+         * Same as ListOpenWorkflowExecutionsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListOpenWorkflowExecutionsOutcomeCallable ListOpenWorkflowExecutionsCallable(Model::ListOpenWorkflowExecutionsRequest&& request) const;
+
         /**
          * <p>Returns a list of open workflow executions in the specified domain that meet
          * the filtering criteria. The results may be split into multiple pages. To
@@ -1392,6 +1582,11 @@ namespace Model
          */
         virtual void ListOpenWorkflowExecutionsAsync(const Model::ListOpenWorkflowExecutionsRequest& request, const ListOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListOpenWorkflowExecutionsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListOpenWorkflowExecutionsAsync(Model::ListOpenWorkflowExecutionsRequest&& request, const ListOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns information about workflow types in the specified domain. The results
          * may be split into multiple pages that can be retrieved by making the call
@@ -1430,6 +1625,11 @@ namespace Model
          */
         virtual Model::ListWorkflowTypesOutcomeCallable ListWorkflowTypesCallable(const Model::ListWorkflowTypesRequest& request) const;
 
+        /**
+         * Same as ListWorkflowTypesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListWorkflowTypesOutcomeCallable ListWorkflowTypesCallable(Model::ListWorkflowTypesRequest&& request) const;
+
         /**
          * <p>Returns information about workflow types in the specified domain. The results
          * may be split into multiple pages that can be retrieved by making the call
@@ -1450,6 +1650,11 @@ namespace Model
          */
         virtual void ListWorkflowTypesAsync(const Model::ListWorkflowTypesRequest& request, const ListWorkflowTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListWorkflowTypesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListWorkflowTypesAsync(Model::ListWorkflowTypesRequest&& request, const ListWorkflowTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by workers to get an <a>ActivityTask</a> from the specified activity
          * <code>taskList</code>. This initiates a long poll, where the service holds the
@@ -1508,6 +1713,11 @@ namespace Model
          */
         virtual Model::PollForActivityTaskOutcomeCallable PollForActivityTaskCallable(const Model::PollForActivityTaskRequest& request) const;
 
+        /**
+         * Same as PollForActivityTaskCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PollForActivityTaskOutcomeCallable PollForActivityTaskCallable(Model::PollForActivityTaskRequest&& request) const;
+
         /**
          * <p>Used by workers to get an <a>ActivityTask</a> from the specified activity
          * <code>taskList</code>. This initiates a long poll, where the service holds the
@@ -1538,6 +1748,11 @@ namespace Model
          */
         virtual void PollForActivityTaskAsync(const Model::PollForActivityTaskRequest& request, const PollForActivityTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PollForActivityTaskAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PollForActivityTaskAsync(Model::PollForActivityTaskRequest&& request, const PollForActivityTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by deciders to get a <a>DecisionTask</a> from the specified decision
          * <code>taskList</code>. A decision task may be returned for any open workflow
@@ -1612,6 +1827,11 @@ namespace Model
          */
         virtual Model::PollForDecisionTaskOutcomeCallable PollForDecisionTaskCallable(const Model::PollForDecisionTaskRequest& request) const;
 
+        /**
+         * Same as PollForDecisionTaskCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::PollForDecisionTaskOutcomeCallable PollForDecisionTaskCallable(Model::PollForDecisionTaskRequest&& request) const;
+
         /**
          * <p>Used by deciders to get a <a>DecisionTask</a> from the specified decision
          * <code>taskList</code>. A decision task may be returned for any open workflow
@@ -1650,6 +1870,11 @@ namespace Model
          */
         virtual void PollForDecisionTaskAsync(const Model::PollForDecisionTaskRequest& request, const PollForDecisionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as PollForDecisionTaskAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void PollForDecisionTaskAsync(Model::PollForDecisionTaskRequest&& request, const PollForDecisionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by activity workers to report to the service that the
          * <a>ActivityTask</a> represented by the specified <code>taskToken</code> is still
@@ -1734,6 +1959,11 @@ namespace Model
          */
         virtual Model::RecordActivityTaskHeartbeatOutcomeCallable RecordActivityTaskHeartbeatCallable(const Model::RecordActivityTaskHeartbeatRequest& request) const;
 
+        /**
+         * Same as RecordActivityTaskHeartbeatCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RecordActivityTaskHeartbeatOutcomeCallable RecordActivityTaskHeartbeatCallable(Model::RecordActivityTaskHeartbeatRequest&& request) const;
+
         /**
          * <p>Used by activity workers to report to the service that the
          * <a>ActivityTask</a> represented by the specified <code>taskToken</code> is still
@@ -1777,6 +2007,11 @@ namespace Model
          */
         virtual void RecordActivityTaskHeartbeatAsync(const Model::RecordActivityTaskHeartbeatRequest& request, const RecordActivityTaskHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RecordActivityTaskHeartbeatAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RecordActivityTaskHeartbeatAsync(Model::RecordActivityTaskHeartbeatRequest&& request, const RecordActivityTaskHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers a new <i>activity type</i> along with its configuration settings in
          * the specified domain.</p> <important>A <code>TypeAlreadyExists</code> fault is
@@ -1829,6 +2064,11 @@ namespace Model
          */
         virtual Model::RegisterActivityTypeOutcomeCallable RegisterActivityTypeCallable(const Model::RegisterActivityTypeRequest& request) const;
 
+        /**
+         * Same as RegisterActivityTypeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterActivityTypeOutcomeCallable RegisterActivityTypeCallable(Model::RegisterActivityTypeRequest&& request) const;
+
         /**
          * <p>Registers a new <i>activity type</i> along with its configuration settings in
          * the specified domain.</p> <important>A <code>TypeAlreadyExists</code> fault is
@@ -1856,6 +2096,11 @@ namespace Model
          */
         virtual void RegisterActivityTypeAsync(const Model::RegisterActivityTypeRequest& request, const RegisterActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterActivityTypeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterActivityTypeAsync(Model::RegisterActivityTypeRequest&& request, const RegisterActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers a new domain.</p> <p><b>Access Control</b></p> <p>You can use IAM
          * policies to control this action's access to Amazon SWF resources as follows:</p>
@@ -1892,6 +2137,11 @@ namespace Model
          */
         virtual Model::RegisterDomainOutcomeCallable RegisterDomainCallable(const Model::RegisterDomainRequest& request) const;
 
+        /**
+         * Same as RegisterDomainCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterDomainOutcomeCallable RegisterDomainCallable(Model::RegisterDomainRequest&& request) const;
+
         /**
          * <p>Registers a new domain.</p> <p><b>Access Control</b></p> <p>You can use IAM
          * policies to control this action's access to Amazon SWF resources as follows:</p>
@@ -1911,6 +2161,11 @@ namespace Model
          */
         virtual void RegisterDomainAsync(const Model::RegisterDomainRequest& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterDomainAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterDomainAsync(Model::RegisterDomainRequest&& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Registers a new <i>workflow type</i> and its configuration settings in the
          * specified domain.</p> <p>The retention period for the workflow history is set by
@@ -1965,6 +2220,11 @@ namespace Model
          */
         virtual Model::RegisterWorkflowTypeOutcomeCallable RegisterWorkflowTypeCallable(const Model::RegisterWorkflowTypeRequest& request) const;
 
+        /**
+         * Same as RegisterWorkflowTypeCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RegisterWorkflowTypeOutcomeCallable RegisterWorkflowTypeCallable(Model::RegisterWorkflowTypeRequest&& request) const;
+
         /**
          * <p>Registers a new <i>workflow type</i> and its configuration settings in the
          * specified domain.</p> <p>The retention period for the workflow history is set by
@@ -1993,6 +2253,11 @@ namespace Model
          */
         virtual void RegisterWorkflowTypeAsync(const Model::RegisterWorkflowTypeRequest& request, const RegisterWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RegisterWorkflowTypeAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RegisterWorkflowTypeAsync(Model::RegisterWorkflowTypeRequest&& request, const RegisterWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Records a <code>WorkflowExecutionCancelRequested</code> event in the
          * currently running workflow execution identified by the given domain, workflowId,
@@ -2047,6 +2312,11 @@ namespace Model
          */
         virtual Model::RequestCancelWorkflowExecutionOutcomeCallable RequestCancelWorkflowExecutionCallable(const Model::RequestCancelWorkflowExecutionRequest& request) const;
 
+        /**
+         * Same as RequestCancelWorkflowExecutionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RequestCancelWorkflowExecutionOutcomeCallable RequestCancelWorkflowExecutionCallable(Model::RequestCancelWorkflowExecutionRequest&& request) const;
+
         /**
          * <p>Records a <code>WorkflowExecutionCancelRequested</code> event in the
          * currently running workflow execution identified by the given domain, workflowId,
@@ -2075,6 +2345,11 @@ namespace Model
          */
         virtual void RequestCancelWorkflowExecutionAsync(const Model::RequestCancelWorkflowExecutionRequest& request, const RequestCancelWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RequestCancelWorkflowExecutionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RequestCancelWorkflowExecutionAsync(Model::RequestCancelWorkflowExecutionRequest&& request, const RequestCancelWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
          * by the <code>taskToken</code> was successfully canceled. Additional
@@ -2137,6 +2412,11 @@ namespace Model
          */
         virtual Model::RespondActivityTaskCanceledOutcomeCallable RespondActivityTaskCanceledCallable(const Model::RespondActivityTaskCanceledRequest& request) const;
 
+        /**
+         * Same as RespondActivityTaskCanceledCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RespondActivityTaskCanceledOutcomeCallable RespondActivityTaskCanceledCallable(Model::RespondActivityTaskCanceledRequest&& request) const;
+
         /**
          * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
          * by the <code>taskToken</code> was successfully canceled. Additional
@@ -2169,6 +2449,11 @@ namespace Model
          */
         virtual void RespondActivityTaskCanceledAsync(const Model::RespondActivityTaskCanceledRequest& request, const RespondActivityTaskCanceledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RespondActivityTaskCanceledAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RespondActivityTaskCanceledAsync(Model::RespondActivityTaskCanceledRequest&& request, const RespondActivityTaskCanceledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
          * by the <code>taskToken</code> completed successfully with a <code>result</code>
@@ -2233,6 +2518,11 @@ namespace Model
          */
         virtual Model::RespondActivityTaskCompletedOutcomeCallable RespondActivityTaskCompletedCallable(const Model::RespondActivityTaskCompletedRequest& request) const;
 
+        /**
+         * Same as RespondActivityTaskCompletedCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RespondActivityTaskCompletedOutcomeCallable RespondActivityTaskCompletedCallable(Model::RespondActivityTaskCompletedRequest&& request) const;
+
         /**
          * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
          * by the <code>taskToken</code> completed successfully with a <code>result</code>
@@ -2266,6 +2556,11 @@ namespace Model
          */
         virtual void RespondActivityTaskCompletedAsync(const Model::RespondActivityTaskCompletedRequest& request, const RespondActivityTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RespondActivityTaskCompletedAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RespondActivityTaskCompletedAsync(Model::RespondActivityTaskCompletedRequest&& request, const RespondActivityTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
          * by the <code>taskToken</code> has failed with <code>reason</code> (if
@@ -2320,6 +2615,11 @@ namespace Model
          */
         virtual Model::RespondActivityTaskFailedOutcomeCallable RespondActivityTaskFailedCallable(const Model::RespondActivityTaskFailedRequest& request) const;
 
+        /**
+         * Same as RespondActivityTaskFailedCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RespondActivityTaskFailedOutcomeCallable RespondActivityTaskFailedCallable(Model::RespondActivityTaskFailedRequest&& request) const;
+
         /**
          * <p>Used by workers to tell the service that the <a>ActivityTask</a> identified
          * by the <code>taskToken</code> has failed with <code>reason</code> (if
@@ -2348,6 +2648,11 @@ namespace Model
          */
         virtual void RespondActivityTaskFailedAsync(const Model::RespondActivityTaskFailedRequest& request, const RespondActivityTaskFailedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RespondActivityTaskFailedAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RespondActivityTaskFailedAsync(Model::RespondActivityTaskFailedRequest&& request, const RespondActivityTaskFailedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Used by deciders to tell the service that the <a>DecisionTask</a> identified
          * by the <code>taskToken</code> has successfully completed. The
@@ -2388,6 +2693,11 @@ namespace Model
          */
         virtual Model::RespondDecisionTaskCompletedOutcomeCallable RespondDecisionTaskCompletedCallable(const Model::RespondDecisionTaskCompletedRequest& request) const;
 
+        /**
+         * Same as RespondDecisionTaskCompletedCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RespondDecisionTaskCompletedOutcomeCallable RespondDecisionTaskCompletedCallable(Model::RespondDecisionTaskCompletedRequest&& request) const;
+
         /**
          * <p>Used by deciders to tell the service that the <a>DecisionTask</a> identified
          * by the <code>taskToken</code> has successfully completed. The
@@ -2409,6 +2719,11 @@ namespace Model
          */
         virtual void RespondDecisionTaskCompletedAsync(const Model::RespondDecisionTaskCompletedRequest& request, const RespondDecisionTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RespondDecisionTaskCompletedAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RespondDecisionTaskCompletedAsync(Model::RespondDecisionTaskCompletedRequest&& request, const RespondDecisionTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Records a <code>WorkflowExecutionSignaled</code> event in the workflow
          * execution history and creates a decision task for the workflow execution
@@ -2459,6 +2774,11 @@ namespace Model
          */
         virtual Model::SignalWorkflowExecutionOutcomeCallable SignalWorkflowExecutionCallable(const Model::SignalWorkflowExecutionRequest& request) const;
 
+        /**
+         * Same as SignalWorkflowExecutionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::SignalWorkflowExecutionOutcomeCallable SignalWorkflowExecutionCallable(Model::SignalWorkflowExecutionRequest&& request) const;
+
         /**
          * <p>Records a <code>WorkflowExecutionSignaled</code> event in the workflow
          * execution history and creates a decision task for the workflow execution
@@ -2485,6 +2805,11 @@ namespace Model
          */
         virtual void SignalWorkflowExecutionAsync(const Model::SignalWorkflowExecutionRequest& request, const SignalWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as SignalWorkflowExecutionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void SignalWorkflowExecutionAsync(Model::SignalWorkflowExecutionRequest&& request, const SignalWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Starts an execution of the workflow type in the specified domain using the
          * provided <code>workflowId</code> and input data.</p> <p>This action returns the
@@ -2549,6 +2874,11 @@ namespace Model
          */
         virtual Model::StartWorkflowExecutionOutcomeCallable StartWorkflowExecutionCallable(const Model::StartWorkflowExecutionRequest& request) const;
 
+        /**
+         * Same as StartWorkflowExecutionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::StartWorkflowExecutionOutcomeCallable StartWorkflowExecutionCallable(Model::StartWorkflowExecutionRequest&& request) const;
+
         /**
          * <p>Starts an execution of the workflow type in the specified domain using the
          * provided <code>workflowId</code> and input data.</p> <p>This action returns the
@@ -2582,6 +2912,11 @@ namespace Model
          */
         virtual void StartWorkflowExecutionAsync(const Model::StartWorkflowExecutionRequest& request, const StartWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as StartWorkflowExecutionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void StartWorkflowExecutionAsync(Model::StartWorkflowExecutionRequest&& request, const StartWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Records a <code>WorkflowExecutionTerminated</code> event and forces closure
          * of the workflow execution identified by the given domain, runId, and workflowId.
@@ -2638,6 +2973,11 @@ namespace Model
          */
         virtual Model::TerminateWorkflowExecutionOutcomeCallable TerminateWorkflowExecutionCallable(const Model::TerminateWorkflowExecutionRequest& request) const;
 
+        /**
+         * Same as TerminateWorkflowExecutionCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::TerminateWorkflowExecutionOutcomeCallable TerminateWorkflowExecutionCallable(Model::TerminateWorkflowExecutionRequest&& request) const;
+
         /**
          * <p>Records a <code>WorkflowExecutionTerminated</code> event and forces closure
          * of the workflow execution identified by the given domain, runId, and workflowId.
@@ -2667,6 +3007,80 @@ namespace Model
          */
         virtual void TerminateWorkflowExecutionAsync(const Model::TerminateWorkflowExecutionRequest& request, const TerminateWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TerminateWorkflowExecutionAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void TerminateWorkflowExecutionAsync(Model::TerminateWorkflowExecutionRequest&& request, const TerminateWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CountClosedWorkflowExecutionsOutcome> CountClosedWorkflowExecutionsAwaitable(const Model::CountClosedWorkflowExecutionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::CountClosedWorkflowExecutions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CountClosedWorkflowExecutionsOutcome> CountClosedWorkflowExecutionsAwaitable(Model::CountClosedWorkflowExecutionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::CountClosedWorkflowExecutions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CountOpenWorkflowExecutionsOutcome> CountOpenWorkflowExecutionsAwaitable(const Model::CountOpenWorkflowExecutionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::CountOpenWorkflowExecutions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CountOpenWorkflowExecutionsOutcome> CountOpenWorkflowExecutionsAwaitable(Model::CountOpenWorkflowExecutionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::CountOpenWorkflowExecutions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CountPendingActivityTasksOutcome> CountPendingActivityTasksAwaitable(const Model::CountPendingActivityTasksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::CountPendingActivityTasks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CountPendingActivityTasksOutcome> CountPendingActivityTasksAwaitable(Model::CountPendingActivityTasksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::CountPendingActivityTasks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CountPendingDecisionTasksOutcome> CountPendingDecisionTasksAwaitable(const Model::CountPendingDecisionTasksRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::CountPendingDecisionTasks, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CountPendingDecisionTasksOutcome> CountPendingDecisionTasksAwaitable(Model::CountPendingDecisionTasksRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::CountPendingDecisionTasks, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeprecateActivityTypeOutcome> DeprecateActivityTypeAwaitable(const Model::DeprecateActivityTypeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::DeprecateActivityType, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeprecateActivityTypeOutcome> DeprecateActivityTypeAwaitable(Model::DeprecateActivityTypeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::DeprecateActivityType, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeprecateDomainOutcome> DeprecateDomainAwaitable(const Model::DeprecateDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::DeprecateDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeprecateDomainOutcome> DeprecateDomainAwaitable(Model::DeprecateDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::DeprecateDomain, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeprecateWorkflowTypeOutcome> DeprecateWorkflowTypeAwaitable(const Model::DeprecateWorkflowTypeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::DeprecateWorkflowType, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeprecateWorkflowTypeOutcome> DeprecateWorkflowTypeAwaitable(Model::DeprecateWorkflowTypeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::DeprecateWorkflowType, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeActivityTypeOutcome> DescribeActivityTypeAwaitable(const Model::DescribeActivityTypeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::DescribeActivityType, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeActivityTypeOutcome> DescribeActivityTypeAwaitable(Model::DescribeActivityTypeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::DescribeActivityType, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDomainOutcome> DescribeDomainAwaitable(const Model::DescribeDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::DescribeDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeDomainOutcome> DescribeDomainAwaitable(Model::DescribeDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::DescribeDomain, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeWorkflowExecutionOutcome> DescribeWorkflowExecutionAwaitable(const Model::DescribeWorkflowExecutionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::DescribeWorkflowExecution, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeWorkflowExecutionOutcome> DescribeWorkflowExecutionAwaitable(Model::DescribeWorkflowExecutionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::DescribeWorkflowExecution, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeWorkflowTypeOutcome> DescribeWorkflowTypeAwaitable(const Model::DescribeWorkflowTypeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::DescribeWorkflowType, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeWorkflowTypeOutcome> DescribeWorkflowTypeAwaitable(Model::DescribeWorkflowTypeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::DescribeWorkflowType, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetWorkflowExecutionHistoryOutcome> GetWorkflowExecutionHistoryAwaitable(const Model::GetWorkflowExecutionHistoryRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::GetWorkflowExecutionHistory, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetWorkflowExecutionHistoryOutcome> GetWorkflowExecutionHistoryAwaitable(Model::GetWorkflowExecutionHistoryRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::GetWorkflowExecutionHistory, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListActivityTypesOutcome> ListActivityTypesAwaitable(const Model::ListActivityTypesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::ListActivityTypes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListActivityTypesOutcome> ListActivityTypesAwaitable(Model::ListActivityTypesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::ListActivityTypes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListClosedWorkflowExecutionsOutcome> ListClosedWorkflowExecutionsAwaitable(const Model::ListClosedWorkflowExecutionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::ListClosedWorkflowExecutions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListClosedWorkflowExecutionsOutcome> ListClosedWorkflowExecutionsAwaitable(Model::ListClosedWorkflowExecutionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::ListClosedWorkflowExecutions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDomainsOutcome> ListDomainsAwaitable(const Model::ListDomainsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::ListDomains, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListDomainsOutcome> ListDomainsAwaitable(Model::ListDomainsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::ListDomains, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListOpenWorkflowExecutionsOutcome> ListOpenWorkflowExecutionsAwaitable(const Model::ListOpenWorkflowExecutionsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::ListOpenWorkflowExecutions, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListOpenWorkflowExecutionsOutcome> ListOpenWorkflowExecutionsAwaitable(Model::ListOpenWorkflowExecutionsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::ListOpenWorkflowExecutions, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListWorkflowTypesOutcome> ListWorkflowTypesAwaitable(const Model::ListWorkflowTypesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::ListWorkflowTypes, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListWorkflowTypesOutcome> ListWorkflowTypesAwaitable(Model::ListWorkflowTypesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::ListWorkflowTypes, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PollForActivityTaskOutcome> PollForActivityTaskAwaitable(const Model::PollForActivityTaskRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::PollForActivityTask, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PollForActivityTaskOutcome> PollForActivityTaskAwaitable(Model::PollForActivityTaskRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::PollForActivityTask, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PollForDecisionTaskOutcome> PollForDecisionTaskAwaitable(const Model::PollForDecisionTaskRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::PollForDecisionTask, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::PollForDecisionTaskOutcome> PollForDecisionTaskAwaitable(Model::PollForDecisionTaskRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::PollForDecisionTask, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RecordActivityTaskHeartbeatOutcome> RecordActivityTaskHeartbeatAwaitable(const Model::RecordActivityTaskHeartbeatRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RecordActivityTaskHeartbeat, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RecordActivityTaskHeartbeatOutcome> RecordActivityTaskHeartbeatAwaitable(Model::RecordActivityTaskHeartbeatRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RecordActivityTaskHeartbeat, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterActivityTypeOutcome> RegisterActivityTypeAwaitable(const Model::RegisterActivityTypeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RegisterActivityType, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterActivityTypeOutcome> RegisterActivityTypeAwaitable(Model::RegisterActivityTypeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RegisterActivityType, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterDomainOutcome> RegisterDomainAwaitable(const Model::RegisterDomainRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RegisterDomain, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterDomainOutcome> RegisterDomainAwaitable(Model::RegisterDomainRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RegisterDomain, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterWorkflowTypeOutcome> RegisterWorkflowTypeAwaitable(const Model::RegisterWorkflowTypeRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RegisterWorkflowType, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RegisterWorkflowTypeOutcome> RegisterWorkflowTypeAwaitable(Model::RegisterWorkflowTypeRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RegisterWorkflowType, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RequestCancelWorkflowExecutionOutcome> RequestCancelWorkflowExecutionAwaitable(const Model::RequestCancelWorkflowExecutionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RequestCancelWorkflowExecution, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RequestCancelWorkflowExecutionOutcome> RequestCancelWorkflowExecutionAwaitable(Model::RequestCancelWorkflowExecutionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RequestCancelWorkflowExecution, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RespondActivityTaskCanceledOutcome> RespondActivityTaskCanceledAwaitable(const Model::RespondActivityTaskCanceledRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RespondActivityTaskCanceled, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RespondActivityTaskCanceledOutcome> RespondActivityTaskCanceledAwaitable(Model::RespondActivityTaskCanceledRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RespondActivityTaskCanceled, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RespondActivityTaskCompletedOutcome> RespondActivityTaskCompletedAwaitable(const Model::RespondActivityTaskCompletedRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RespondActivityTaskCompleted, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RespondActivityTaskCompletedOutcome> RespondActivityTaskCompletedAwaitable(Model::RespondActivityTaskCompletedRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RespondActivityTaskCompleted, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RespondActivityTaskFailedOutcome> RespondActivityTaskFailedAwaitable(const Model::RespondActivityTaskFailedRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RespondActivityTaskFailed, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RespondActivityTaskFailedOutcome> RespondActivityTaskFailedAwaitable(Model::RespondActivityTaskFailedRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RespondActivityTaskFailed, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RespondDecisionTaskCompletedOutcome> RespondDecisionTaskCompletedAwaitable(const Model::RespondDecisionTaskCompletedRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RespondDecisionTaskCompleted, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RespondDecisionTaskCompletedOutcome> RespondDecisionTaskCompletedAwaitable(Model::RespondDecisionTaskCompletedRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::RespondDecisionTaskCompleted, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SignalWorkflowExecutionOutcome> SignalWorkflowExecutionAwaitable(const Model::SignalWorkflowExecutionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::SignalWorkflowExecution, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::SignalWorkflowExecutionOutcome> SignalWorkflowExecutionAwaitable(Model::SignalWorkflowExecutionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::SignalWorkflowExecution, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartWorkflowExecutionOutcome> StartWorkflowExecutionAwaitable(const Model::StartWorkflowExecutionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::StartWorkflowExecution, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::StartWorkflowExecutionOutcome> StartWorkflowExecutionAwaitable(Model::StartWorkflowExecutionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::StartWorkflowExecution, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TerminateWorkflowExecutionOutcome> TerminateWorkflowExecutionAwaitable(const Model::TerminateWorkflowExecutionRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::TerminateWorkflowExecution, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TerminateWorkflowExecutionOutcome> TerminateWorkflowExecutionAwaitable(Model::TerminateWorkflowExecutionRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &SWFClient::TerminateWorkflowExecution, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -138,12 +138,22 @@ CountClosedWorkflowExecutionsOutcome SWFClient::CountClosedWorkflowExecutions(co
 
 CountClosedWorkflowExecutionsOutcomeCallable SWFClient::CountClosedWorkflowExecutionsCallable(const CountClosedWorkflowExecutionsRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::CountClosedWorkflowExecutions, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::CountClosedWorkflowExecutions, Aws::Client::RejectedCallOutcome<CountClosedWorkflowExecutionsOutcome>(), this, request);
+}
+
+CountClosedWorkflowExecutionsOutcomeCallable SWFClient::CountClosedWorkflowExecutionsCallable(CountClosedWorkflowExecutionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::CountClosedWorkflowExecutions, Aws::Client::RejectedCallOutcome<CountClosedWorkflowExecutionsOutcome>(), this, std::move(request));
 }
 
 void SWFClient::CountClosedWorkflowExecutionsAsync(const CountClosedWorkflowExecutionsRequest& request, const CountClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::CountClosedWorkflowExecutionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::CountClosedWorkflowExecutionsAsyncHelper, Aws::Client::RejectedAsyncCall<CountClosedWorkflowExecutionsOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::CountClosedWorkflowExecutionsAsync(CountClosedWorkflowExecutionsRequest&& request, const CountClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::CountClosedWorkflowExecutionsAsyncHelper, Aws::Client::RejectedAsyncCall<CountClosedWorkflowExecutionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::CountClosedWorkflowExecutionsAsyncHelper(const CountClosedWorkflowExecutionsRequest& request, const CountClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -169,12 +179,22 @@ CountOpenWorkflowExecutionsOutcome SWFClient::CountOpenWorkflowExecutions(const
 
 CountOpenWorkflowExecutionsOutcomeCallable SWFClient::CountOpenWorkflowExecutionsCallable(const CountOpenWorkflowExecutionsRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::CountOpenWorkflowExecutions, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::CountOpenWorkflowExecutions, Aws::Client::RejectedCallOutcome<CountOpenWorkflowExecutionsOutcome>(), this, request);
+}
+
+CountOpenWorkflowExecutionsOutcomeCallable SWFClient::CountOpenWorkflowExecutionsCallable(CountOpenWorkflowExecutionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::CountOpenWorkflowExecutions, Aws::Client::RejectedCallOutcome<CountOpenWorkflowExecutionsOutcome>(), this, std::move(request));
 }
 
 void SWFClient::CountOpenWorkflowExecutionsAsync(const CountOpenWorkflowExecutionsRequest& request, const CountOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::CountOpenWorkflowExecutionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::CountOpenWorkflowExecutionsAsyncHelper, Aws::Client::RejectedAsyncCall<CountOpenWorkflowExecutionsOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::CountOpenWorkflowExecutionsAsync(CountOpenWorkflowExecutionsRequest&& request, const CountOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::CountOpenWorkflowExecutionsAsyncHelper, Aws::Client::RejectedAsyncCall<CountOpenWorkflowExecutionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::CountOpenWorkflowExecutionsAsyncHelper(const CountOpenWorkflowExecutionsRequest& request, const CountOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -200,12 +220,22 @@ CountPendingActivityTasksOutcome SWFClient::CountPendingActivityTasks(const Coun
 
 CountPendingActivityTasksOutcomeCallable SWFClient::CountPendingActivityTasksCallable(const CountPendingActivityTasksRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::CountPendingActivityTasks, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::CountPendingActivityTasks, Aws::Client::RejectedCallOutcome<CountPendingActivityTasksOutcome>(), this, request);
+}
+
+CountPendingActivityTasksOutcomeCallable SWFClient::CountPendingActivityTasksCallable(CountPendingActivityTasksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::CountPendingActivityTasks, Aws::Client::RejectedCallOutcome<CountPendingActivityTasksOutcome>(), this, std::move(request));
 }
 
 void SWFClient::CountPendingActivityTasksAsync(const CountPendingActivityTasksRequest& request, const CountPendingActivityTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::CountPendingActivityTasksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::CountPendingActivityTasksAsyncHelper, Aws::Client::RejectedAsyncCall<CountPendingActivityTasksOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::CountPendingActivityTasksAsync(CountPendingActivityTasksRequest&& request, const CountPendingActivityTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::CountPendingActivityTasksAsyncHelper, Aws::Client::RejectedAsyncCall<CountPendingActivityTasksOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::CountPendingActivityTasksAsyncHelper(const CountPendingActivityTasksRequest& request, const CountPendingActivityTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -231,12 +261,22 @@ CountPendingDecisionTasksOutcome SWFClient::CountPendingDecisionTasks(const Coun
 
 CountPendingDecisionTasksOutcomeCallable SWFClient::CountPendingDecisionTasksCallable(const CountPendingDecisionTasksRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::CountPendingDecisionTasks, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::CountPendingDecisionTasks, Aws::Client::RejectedCallOutcome<CountPendingDecisionTasksOutcome>(), this, request);
+}
+
+CountPendingDecisionTasksOutcomeCallable SWFClient::CountPendingDecisionTasksCallable(CountPendingDecisionTasksRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::CountPendingDecisionTasks, Aws::Client::RejectedCallOutcome<CountPendingDecisionTasksOutcome>(), this, std::move(request));
 }
 
 void SWFClient::CountPendingDecisionTasksAsync(const CountPendingDecisionTasksRequest& request, const CountPendingDecisionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::CountPendingDecisionTasksAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::CountPendingDecisionTasksAsyncHelper, Aws::Client::RejectedAsyncCall<CountPendingDecisionTasksOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::CountPendingDecisionTasksAsync(CountPendingDecisionTasksRequest&& request, const CountPendingDecisionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::CountPendingDecisionTasksAsyncHelper, Aws::Client::RejectedAsyncCall<CountPendingDecisionTasksOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::CountPendingDecisionTasksAsyncHelper(const CountPendingDecisionTasksRequest& request, const CountPendingDecisionTasksResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -262,12 +302,22 @@ DeprecateActivityTypeOutcome SWFClient::DeprecateActivityType(const DeprecateAct
 
 DeprecateActivityTypeOutcomeCallable SWFClient::DeprecateActivityTypeCallable(const DeprecateActivityTypeRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::DeprecateActivityType, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::DeprecateActivityType, Aws::Client::RejectedCallOutcome<DeprecateActivityTypeOutcome>(), this, request);
+}
+
+DeprecateActivityTypeOutcomeCallable SWFClient::DeprecateActivityTypeCallable(DeprecateActivityTypeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::DeprecateActivityType, Aws::Client::RejectedCallOutcome<DeprecateActivityTypeOutcome>(), this, std::move(request));
 }
 
 void SWFClient::DeprecateActivityTypeAsync(const DeprecateActivityTypeRequest& request, const DeprecateActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::DeprecateActivityTypeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::DeprecateActivityTypeAsyncHelper, Aws::Client::RejectedAsyncCall<DeprecateActivityTypeOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::DeprecateActivityTypeAsync(DeprecateActivityTypeRequest&& request, const DeprecateActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::DeprecateActivityTypeAsyncHelper, Aws::Client::RejectedAsyncCall<DeprecateActivityTypeOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::DeprecateActivityTypeAsyncHelper(const DeprecateActivityTypeRequest& request, const DeprecateActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -293,12 +343,22 @@ DeprecateDomainOutcome SWFClient::DeprecateDomain(const DeprecateDomainRequest&
 
 DeprecateDomainOutcomeCallable SWFClient::DeprecateDomainCallable(const DeprecateDomainRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::DeprecateDomain, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::DeprecateDomain, Aws::Client::RejectedCallOutcome<DeprecateDomainOutcome>(), this, request);
+}
+
+DeprecateDomainOutcomeCallable SWFClient::DeprecateDomainCallable(DeprecateDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::DeprecateDomain, Aws::Client::RejectedCallOutcome<DeprecateDomainOutcome>(), this, std::move(request));
 }
 
 void SWFClient::DeprecateDomainAsync(const DeprecateDomainRequest& request, const DeprecateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::DeprecateDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::DeprecateDomainAsyncHelper, Aws::Client::RejectedAsyncCall<DeprecateDomainOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::DeprecateDomainAsync(DeprecateDomainRequest&& request, const DeprecateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::DeprecateDomainAsyncHelper, Aws::Client::RejectedAsyncCall<DeprecateDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::DeprecateDomainAsyncHelper(const DeprecateDomainRequest& request, const DeprecateDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -324,12 +384,22 @@ DeprecateWorkflowTypeOutcome SWFClient::DeprecateWorkflowType(const DeprecateWor
 
 DeprecateWorkflowTypeOutcomeCallable SWFClient::DeprecateWorkflowTypeCallable(const DeprecateWorkflowTypeRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::DeprecateWorkflowType, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::DeprecateWorkflowType, Aws::Client::RejectedCallOutcome<DeprecateWorkflowTypeOutcome>(), this, request);
+}
+
+DeprecateWorkflowTypeOutcomeCallable SWFClient::DeprecateWorkflowTypeCallable(DeprecateWorkflowTypeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::DeprecateWorkflowType, Aws::Client::RejectedCallOutcome<DeprecateWorkflowTypeOutcome>(), this, std::move(request));
 }
 
 void SWFClient::DeprecateWorkflowTypeAsync(const DeprecateWorkflowTypeRequest& request, const DeprecateWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::DeprecateWorkflowTypeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::DeprecateWorkflowTypeAsyncHelper, Aws::Client::RejectedAsyncCall<DeprecateWorkflowTypeOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::DeprecateWorkflowTypeAsync(DeprecateWorkflowTypeRequest&& request, const DeprecateWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::DeprecateWorkflowTypeAsyncHelper, Aws::Client::RejectedAsyncCall<DeprecateWorkflowTypeOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::DeprecateWorkflowTypeAsyncHelper(const DeprecateWorkflowTypeRequest& request, const DeprecateWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -355,12 +425,22 @@ DescribeActivityTypeOutcome SWFClient::DescribeActivityType(const DescribeActivi
 
 DescribeActivityTypeOutcomeCallable SWFClient::DescribeActivityTypeCallable(const DescribeActivityTypeRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::DescribeActivityType, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::DescribeActivityType, Aws::Client::RejectedCallOutcome<DescribeActivityTypeOutcome>(), this, request);
+}
+
+DescribeActivityTypeOutcomeCallable SWFClient::DescribeActivityTypeCallable(DescribeActivityTypeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::DescribeActivityType, Aws::Client::RejectedCallOutcome<DescribeActivityTypeOutcome>(), this, std::move(request));
 }
 
 void SWFClient::DescribeActivityTypeAsync(const DescribeActivityTypeRequest& request, const DescribeActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::DescribeActivityTypeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::DescribeActivityTypeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeActivityTypeOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::DescribeActivityTypeAsync(DescribeActivityTypeRequest&& request, const DescribeActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::DescribeActivityTypeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeActivityTypeOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::DescribeActivityTypeAsyncHelper(const DescribeActivityTypeRequest& request, const DescribeActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -386,12 +466,22 @@ DescribeDomainOutcome SWFClient::DescribeDomain(const DescribeDomainRequest& req
 
 DescribeDomainOutcomeCallable SWFClient::DescribeDomainCallable(const DescribeDomainRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::DescribeDomain, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::DescribeDomain, Aws::Client::RejectedCallOutcome<DescribeDomainOutcome>(), this, request);
+}
+
+DescribeDomainOutcomeCallable SWFClient::DescribeDomainCallable(DescribeDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::DescribeDomain, Aws::Client::RejectedCallOutcome<DescribeDomainOutcome>(), this, std::move(request));
 }
 
 void SWFClient::DescribeDomainAsync(const DescribeDomainRequest& request, const DescribeDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::DescribeDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::DescribeDomainAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDomainOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::DescribeDomainAsync(DescribeDomainRequest&& request, const DescribeDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::DescribeDomainAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::DescribeDomainAsyncHelper(const DescribeDomainRequest& request, const DescribeDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -417,12 +507,22 @@ DescribeWorkflowExecutionOutcome SWFClient::DescribeWorkflowExecution(const Desc
 
 DescribeWorkflowExecutionOutcomeCallable SWFClient::DescribeWorkflowExecutionCallable(const DescribeWorkflowExecutionRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::DescribeWorkflowExecution, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::DescribeWorkflowExecution, Aws::Client::RejectedCallOutcome<DescribeWorkflowExecutionOutcome>(), this, request);
+}
+
+DescribeWorkflowExecutionOutcomeCallable SWFClient::DescribeWorkflowExecutionCallable(DescribeWorkflowExecutionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::DescribeWorkflowExecution, Aws::Client::RejectedCallOutcome<DescribeWorkflowExecutionOutcome>(), this, std::move(request));
 }
 
 void SWFClient::DescribeWorkflowExecutionAsync(const DescribeWorkflowExecutionRequest& request, const DescribeWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::DescribeWorkflowExecutionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::DescribeWorkflowExecutionAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeWorkflowExecutionOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::DescribeWorkflowExecutionAsync(DescribeWorkflowExecutionRequest&& request, const DescribeWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::DescribeWorkflowExecutionAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeWorkflowExecutionOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::DescribeWorkflowExecutionAsyncHelper(const DescribeWorkflowExecutionRequest& request, const DescribeWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -448,12 +548,22 @@ DescribeWorkflowTypeOutcome SWFClient::DescribeWorkflowType(const DescribeWorkfl
 
 DescribeWorkflowTypeOutcomeCallable SWFClient::DescribeWorkflowTypeCallable(const DescribeWorkflowTypeRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::DescribeWorkflowType, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::DescribeWorkflowType, Aws::Client::RejectedCallOutcome<DescribeWorkflowTypeOutcome>(), this, request);
+}
+
+DescribeWorkflowTypeOutcomeCallable SWFClient::DescribeWorkflowTypeCallable(DescribeWorkflowTypeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::DescribeWorkflowType, Aws::Client::RejectedCallOutcome<DescribeWorkflowTypeOutcome>(), this, std::move(request));
 }
 
 void SWFClient::DescribeWorkflowTypeAsync(const DescribeWorkflowTypeRequest& request, const DescribeWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::DescribeWorkflowTypeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::DescribeWorkflowTypeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeWorkflowTypeOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::DescribeWorkflowTypeAsync(DescribeWorkflowTypeRequest&& request, const DescribeWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::DescribeWorkflowTypeAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeWorkflowTypeOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::DescribeWorkflowTypeAsyncHelper(const DescribeWorkflowTypeRequest& request, const DescribeWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -479,12 +589,22 @@ GetWorkflowExecutionHistoryOutcome SWFClient::GetWorkflowExecutionHistory(const
 
 GetWorkflowExecutionHistoryOutcomeCallable SWFClient::GetWorkflowExecutionHistoryCallable(const GetWorkflowExecutionHistoryRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::GetWorkflowExecutionHistory, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::GetWorkflowExecutionHistory, Aws::Client::RejectedCallOutcome<GetWorkflowExecutionHistoryOutcome>(), this, request);
+}
+
+GetWorkflowExecutionHistoryOutcomeCallable SWFClient::GetWorkflowExecutionHistoryCallable(GetWorkflowExecutionHistoryRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::GetWorkflowExecutionHistory, Aws::Client::RejectedCallOutcome<GetWorkflowExecutionHistoryOutcome>(), this, std::move(request));
 }
 
 void SWFClient::GetWorkflowExecutionHistoryAsync(const GetWorkflowExecutionHistoryRequest& request, const GetWorkflowExecutionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::GetWorkflowExecutionHistoryAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::GetWorkflowExecutionHistoryAsyncHelper, Aws::Client::RejectedAsyncCall<GetWorkflowExecutionHistoryOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::GetWorkflowExecutionHistoryAsync(GetWorkflowExecutionHistoryRequest&& request, const GetWorkflowExecutionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::GetWorkflowExecutionHistoryAsyncHelper, Aws::Client::RejectedAsyncCall<GetWorkflowExecutionHistoryOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::GetWorkflowExecutionHistoryAsyncHelper(const GetWorkflowExecutionHistoryRequest& request, const GetWorkflowExecutionHistoryResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -510,12 +630,22 @@ ListActivityTypesOutcome SWFClient::ListActivityTypes(const ListActivityTypesReq
 
 ListActivityTypesOutcomeCallable SWFClient::ListActivityTypesCallable(const ListActivityTypesRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::ListActivityTypes, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::ListActivityTypes, Aws::Client::RejectedCallOutcome<ListActivityTypesOutcome>(), this, request);
+}
+
+ListActivityTypesOutcomeCallable SWFClient::ListActivityTypesCallable(ListActivityTypesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::ListActivityTypes, Aws::Client::RejectedCallOutcome<ListActivityTypesOutcome>(), this, std::move(request));
 }
 
 void SWFClient::ListActivityTypesAsync(const ListActivityTypesRequest& request, const ListActivityTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::ListActivityTypesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::ListActivityTypesAsyncHelper, Aws::Client::RejectedAsyncCall<ListActivityTypesOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::ListActivityTypesAsync(ListActivityTypesRequest&& request, const ListActivityTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::ListActivityTypesAsyncHelper, Aws::Client::RejectedAsyncCall<ListActivityTypesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::ListActivityTypesAsyncHelper(const ListActivityTypesRequest& request, const ListActivityTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -541,12 +671,22 @@ ListClosedWorkflowExecutionsOutcome SWFClient::ListClosedWorkflowExecutions(cons
 
 ListClosedWorkflowExecutionsOutcomeCallable SWFClient::ListClosedWorkflowExecutionsCallable(const ListClosedWorkflowExecutionsRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::ListClosedWorkflowExecutions, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::ListClosedWorkflowExecutions, Aws::Client::RejectedCallOutcome<ListClosedWorkflowExecutionsOutcome>(), this, request);
+}
+
+ListClosedWorkflowExecutionsOutcomeCallable SWFClient::ListClosedWorkflowExecutionsCallable(ListClosedWorkflowExecutionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::ListClosedWorkflowExecutions, Aws::Client::RejectedCallOutcome<ListClosedWorkflowExecutionsOutcome>(), this, std::move(request));
 }
 
 void SWFClient::ListClosedWorkflowExecutionsAsync(const ListClosedWorkflowExecutionsRequest& request, const ListClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::ListClosedWorkflowExecutionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::ListClosedWorkflowExecutionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListClosedWorkflowExecutionsOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::ListClosedWorkflowExecutionsAsync(ListClosedWorkflowExecutionsRequest&& request, const ListClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::ListClosedWorkflowExecutionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListClosedWorkflowExecutionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::ListClosedWorkflowExecutionsAsyncHelper(const ListClosedWorkflowExecutionsRequest& request, const ListClosedWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -572,12 +712,22 @@ ListDomainsOutcome SWFClient::ListDomains(const ListDomainsRequest& request) con
 
 ListDomainsOutcomeCallable SWFClient::ListDomainsCallable(const ListDomainsRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::ListDomains, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::ListDomains, Aws::Client::RejectedCallOutcome<ListDomainsOutcome>(), this, request);
+}
+
+ListDomainsOutcomeCallable SWFClient::ListDomainsCallable(ListDomainsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::ListDomains, Aws::Client::RejectedCallOutcome<ListDomainsOutcome>(), this, std::move(request));
 }
 
 void SWFClient::ListDomainsAsync(const ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::ListDomainsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::ListDomainsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDomainsOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::ListDomainsAsync(ListDomainsRequest&& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::ListDomainsAsyncHelper, Aws::Client::RejectedAsyncCall<ListDomainsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::ListDomainsAsyncHelper(const ListDomainsRequest& request, const ListDomainsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -603,12 +753,22 @@ ListOpenWorkflowExecutionsOutcome SWFClient::ListOpenWorkflowExecutions(const Li
 
 ListOpenWorkflowExecutionsOutcomeCallable SWFClient::ListOpenWorkflowExecutionsCallable(const ListOpenWorkflowExecutionsRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::ListOpenWorkflowExecutions, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::ListOpenWorkflowExecutions, Aws::Client::RejectedCallOutcome<ListOpenWorkflowExecutionsOutcome>(), this, request);
+}
+
+ListOpenWorkflowExecutionsOutcomeCallable SWFClient::ListOpenWorkflowExecutionsCallable(ListOpenWorkflowExecutionsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::ListOpenWorkflowExecutions, Aws::Client::RejectedCallOutcome<ListOpenWorkflowExecutionsOutcome>(), this, std::move(request));
 }
 
 void SWFClient::ListOpenWorkflowExecutionsAsync(const ListOpenWorkflowExecutionsRequest& request, const ListOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::ListOpenWorkflowExecutionsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::ListOpenWorkflowExecutionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListOpenWorkflowExecutionsOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::ListOpenWorkflowExecutionsAsync(ListOpenWorkflowExecutionsRequest&& request, const ListOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::ListOpenWorkflowExecutionsAsyncHelper, Aws::Client::RejectedAsyncCall<ListOpenWorkflowExecutionsOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::ListOpenWorkflowExecutionsAsyncHelper(const ListOpenWorkflowExecutionsRequest& request, const ListOpenWorkflowExecutionsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -634,12 +794,22 @@ ListWorkflowTypesOutcome SWFClient::ListWorkflowTypes(const ListWorkflowTypesReq
 
 ListWorkflowTypesOutcomeCallable SWFClient::ListWorkflowTypesCallable(const ListWorkflowTypesRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::ListWorkflowTypes, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::ListWorkflowTypes, Aws::Client::RejectedCallOutcome<ListWorkflowTypesOutcome>(), this, request);
+}
+
+ListWorkflowTypesOutcomeCallable SWFClient::ListWorkflowTypesCallable(ListWorkflowTypesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::ListWorkflowTypes, Aws::Client::RejectedCallOutcome<ListWorkflowTypesOutcome>(), this, std::move(request));
 }
 
 void SWFClient::ListWorkflowTypesAsync(const ListWorkflowTypesRequest& request, const ListWorkflowTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::ListWorkflowTypesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::ListWorkflowTypesAsyncHelper, Aws::Client::RejectedAsyncCall<ListWorkflowTypesOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::ListWorkflowTypesAsync(ListWorkflowTypesRequest&& request, const ListWorkflowTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::ListWorkflowTypesAsyncHelper, Aws::Client::RejectedAsyncCall<ListWorkflowTypesOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::ListWorkflowTypesAsyncHelper(const ListWorkflowTypesRequest& request, const ListWorkflowTypesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -665,12 +835,22 @@ PollForActivityTaskOutcome SWFClient::PollForActivityTask(const PollForActivityT
 
 PollForActivityTaskOutcomeCallable SWFClient::PollForActivityTaskCallable(const PollForActivityTaskRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::PollForActivityTask, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::PollForActivityTask, Aws::Client::RejectedCallOutcome<PollForActivityTaskOutcome>(), this, request);
+}
+
+PollForActivityTaskOutcomeCallable SWFClient::PollForActivityTaskCallable(PollForActivityTaskRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::PollForActivityTask, Aws::Client::RejectedCallOutcome<PollForActivityTaskOutcome>(), this, std::move(request));
 }
 
 void SWFClient::PollForActivityTaskAsync(const PollForActivityTaskRequest& request, const PollForActivityTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::PollForActivityTaskAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::PollForActivityTaskAsyncHelper, Aws::Client::RejectedAsyncCall<PollForActivityTaskOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::PollForActivityTaskAsync(PollForActivityTaskRequest&& request, const PollForActivityTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::PollForActivityTaskAsyncHelper, Aws::Client::RejectedAsyncCall<PollForActivityTaskOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::PollForActivityTaskAsyncHelper(const PollForActivityTaskRequest& request, const PollForActivityTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -696,12 +876,22 @@ PollForDecisionTaskOutcome SWFClient::PollForDecisionTask(const PollForDecisionT
 
 PollForDecisionTaskOutcomeCallable SWFClient::PollForDecisionTaskCallable(const PollForDecisionTaskRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::PollForDecisionTask, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::PollForDecisionTask, Aws::Client::RejectedCallOutcome<PollForDecisionTaskOutcome>(), this, request);
+}
+
+PollForDecisionTaskOutcomeCallable SWFClient::PollForDecisionTaskCallable(PollForDecisionTaskRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::PollForDecisionTask, Aws::Client::RejectedCallOutcome<PollForDecisionTaskOutcome>(), this, std::move(request));
 }
 
 void SWFClient::PollForDecisionTaskAsync(const PollForDecisionTaskRequest& request, const PollForDecisionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::PollForDecisionTaskAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::PollForDecisionTaskAsyncHelper, Aws::Client::RejectedAsyncCall<PollForDecisionTaskOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::PollForDecisionTaskAsync(PollForDecisionTaskRequest&& request, const PollForDecisionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::PollForDecisionTaskAsyncHelper, Aws::Client::RejectedAsyncCall<PollForDecisionTaskOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::PollForDecisionTaskAsyncHelper(const PollForDecisionTaskRequest& request, const PollForDecisionTaskResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -727,12 +917,22 @@ RecordActivityTaskHeartbeatOutcome SWFClient::RecordActivityTaskHeartbeat(const
 
 RecordActivityTaskHeartbeatOutcomeCallable SWFClient::RecordActivityTaskHeartbeatCallable(const RecordActivityTaskHeartbeatRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::RecordActivityTaskHeartbeat, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::RecordActivityTaskHeartbeat, Aws::Client::RejectedCallOutcome<RecordActivityTaskHeartbeatOutcome>(), this, request);
+}
+
+RecordActivityTaskHeartbeatOutcomeCallable SWFClient::RecordActivityTaskHeartbeatCallable(RecordActivityTaskHeartbeatRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::RecordActivityTaskHeartbeat, Aws::Client::RejectedCallOutcome<RecordActivityTaskHeartbeatOutcome>(), this, std::move(request));
 }
 
 void SWFClient::RecordActivityTaskHeartbeatAsync(const RecordActivityTaskHeartbeatRequest& request, const RecordActivityTaskHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::RecordActivityTaskHeartbeatAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::RecordActivityTaskHeartbeatAsyncHelper, Aws::Client::RejectedAsyncCall<RecordActivityTaskHeartbeatOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::RecordActivityTaskHeartbeatAsync(RecordActivityTaskHeartbeatRequest&& request, const RecordActivityTaskHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::RecordActivityTaskHeartbeatAsyncHelper, Aws::Client::RejectedAsyncCall<RecordActivityTaskHeartbeatOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::RecordActivityTaskHeartbeatAsyncHelper(const RecordActivityTaskHeartbeatRequest& request, const RecordActivityTaskHeartbeatResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -758,12 +958,22 @@ RegisterActivityTypeOutcome SWFClient::RegisterActivityType(const RegisterActivi
 
 RegisterActivityTypeOutcomeCallable SWFClient::RegisterActivityTypeCallable(const RegisterActivityTypeRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::RegisterActivityType, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::RegisterActivityType, Aws::Client::RejectedCallOutcome<RegisterActivityTypeOutcome>(), this, request);
+}
+
+RegisterActivityTypeOutcomeCallable SWFClient::RegisterActivityTypeCallable(RegisterActivityTypeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::RegisterActivityType, Aws::Client::RejectedCallOutcome<RegisterActivityTypeOutcome>(), this, std::move(request));
 }
 
 void SWFClient::RegisterActivityTypeAsync(const RegisterActivityTypeRequest& request, const RegisterActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::RegisterActivityTypeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::RegisterActivityTypeAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterActivityTypeOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::RegisterActivityTypeAsync(RegisterActivityTypeRequest&& request, const RegisterActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::RegisterActivityTypeAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterActivityTypeOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::RegisterActivityTypeAsyncHelper(const RegisterActivityTypeRequest& request, const RegisterActivityTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -789,12 +999,22 @@ RegisterDomainOutcome SWFClient::RegisterDomain(const RegisterDomainRequest& req
 
 RegisterDomainOutcomeCallable SWFClient::RegisterDomainCallable(const RegisterDomainRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::RegisterDomain, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::RegisterDomain, Aws::Client::RejectedCallOutcome<RegisterDomainOutcome>(), this, request);
+}
+
+RegisterDomainOutcomeCallable SWFClient::RegisterDomainCallable(RegisterDomainRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::RegisterDomain, Aws::Client::RejectedCallOutcome<RegisterDomainOutcome>(), this, std::move(request));
 }
 
 void SWFClient::RegisterDomainAsync(const RegisterDomainRequest& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::RegisterDomainAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::RegisterDomainAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterDomainOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::RegisterDomainAsync(RegisterDomainRequest&& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::RegisterDomainAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterDomainOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::RegisterDomainAsyncHelper(const RegisterDomainRequest& request, const RegisterDomainResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -820,12 +1040,22 @@ RegisterWorkflowTypeOutcome SWFClient::RegisterWorkflowType(const RegisterWorkfl
 
 RegisterWorkflowTypeOutcomeCallable SWFClient::RegisterWorkflowTypeCallable(const RegisterWorkflowTypeRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::RegisterWorkflowType, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::RegisterWorkflowType, Aws::Client::RejectedCallOutcome<RegisterWorkflowTypeOutcome>(), this, request);
+}
+
+RegisterWorkflowTypeOutcomeCallable SWFClient::RegisterWorkflowTypeCallable(RegisterWorkflowTypeRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::RegisterWorkflowType, Aws::Client::RejectedCallOutcome<RegisterWorkflowTypeOutcome>(), this, std::move(request));
 }
 
 void SWFClient::RegisterWorkflowTypeAsync(const RegisterWorkflowTypeRequest& request, const RegisterWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::RegisterWorkflowTypeAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::RegisterWorkflowTypeAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterWorkflowTypeOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::RegisterWorkflowTypeAsync(RegisterWorkflowTypeRequest&& request, const RegisterWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::RegisterWorkflowTypeAsyncHelper, Aws::Client::RejectedAsyncCall<RegisterWorkflowTypeOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::RegisterWorkflowTypeAsyncHelper(const RegisterWorkflowTypeRequest& request, const RegisterWorkflowTypeResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -851,12 +1081,22 @@ RequestCancelWorkflowExecutionOutcome SWFClient::RequestCancelWorkflowExecution(
 
 RequestCancelWorkflowExecutionOutcomeCallable SWFClient::RequestCancelWorkflowExecutionCallable(const RequestCancelWorkflowExecutionRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::RequestCancelWorkflowExecution, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::RequestCancelWorkflowExecution, Aws::Client::RejectedCallOutcome<RequestCancelWorkflowExecutionOutcome>(), this, request);
+}
+
+RequestCancelWorkflowExecutionOutcomeCallable SWFClient::RequestCancelWorkflowExecutionCallable(RequestCancelWorkflowExecutionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::RequestCancelWorkflowExecution, Aws::Client::RejectedCallOutcome<RequestCancelWorkflowExecutionOutcome>(), this, std::move(request));
 }
 
 void SWFClient::RequestCancelWorkflowExecutionAsync(const RequestCancelWorkflowExecutionRequest& request, const RequestCancelWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::RequestCancelWorkflowExecutionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::RequestCancelWorkflowExecutionAsyncHelper, Aws::Client::RejectedAsyncCall<RequestCancelWorkflowExecutionOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::RequestCancelWorkflowExecutionAsync(RequestCancelWorkflowExecutionRequest&& request, const RequestCancelWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::RequestCancelWorkflowExecutionAsyncHelper, Aws::Client::RejectedAsyncCall<RequestCancelWorkflowExecutionOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::RequestCancelWorkflowExecutionAsyncHelper(const RequestCancelWorkflowExecutionRequest& request, const RequestCancelWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -882,12 +1122,22 @@ RespondActivityTaskCanceledOutcome SWFClient::RespondActivityTaskCanceled(const
 
 RespondActivityTaskCanceledOutcomeCallable SWFClient::RespondActivityTaskCanceledCallable(const RespondActivityTaskCanceledRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::RespondActivityTaskCanceled, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::RespondActivityTaskCanceled, Aws::Client::RejectedCallOutcome<RespondActivityTaskCanceledOutcome>(), this, request);
+}
+
+RespondActivityTaskCanceledOutcomeCallable SWFClient::RespondActivityTaskCanceledCallable(RespondActivityTaskCanceledRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::RespondActivityTaskCanceled, Aws::Client::RejectedCallOutcome<RespondActivityTaskCanceledOutcome>(), this, std::move(request));
 }
 
 void SWFClient::RespondActivityTaskCanceledAsync(const RespondActivityTaskCanceledRequest& request, const RespondActivityTaskCanceledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::RespondActivityTaskCanceledAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::RespondActivityTaskCanceledAsyncHelper, Aws::Client::RejectedAsyncCall<RespondActivityTaskCanceledOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::RespondActivityTaskCanceledAsync(RespondActivityTaskCanceledRequest&& request, const RespondActivityTaskCanceledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::RespondActivityTaskCanceledAsyncHelper, Aws::Client::RejectedAsyncCall<RespondActivityTaskCanceledOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::RespondActivityTaskCanceledAsyncHelper(const RespondActivityTaskCanceledRequest& request, const RespondActivityTaskCanceledResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -913,12 +1163,22 @@ RespondActivityTaskCompletedOutcome SWFClient::RespondActivityTaskCompleted(cons
 
 RespondActivityTaskCompletedOutcomeCallable SWFClient::RespondActivityTaskCompletedCallable(const RespondActivityTaskCompletedRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::RespondActivityTaskCompleted, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::RespondActivityTaskCompleted, Aws::Client::RejectedCallOutcome<RespondActivityTaskCompletedOutcome>(), this, request);
+}
+
+RespondActivityTaskCompletedOutcomeCallable SWFClient::RespondActivityTaskCompletedCallable(RespondActivityTaskCompletedRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::RespondActivityTaskCompleted, Aws::Client::RejectedCallOutcome<RespondActivityTaskCompletedOutcome>(), this, std::move(request));
 }
 
 void SWFClient::RespondActivityTaskCompletedAsync(const RespondActivityTaskCompletedRequest& request, const RespondActivityTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::RespondActivityTaskCompletedAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::RespondActivityTaskCompletedAsyncHelper, Aws::Client::RejectedAsyncCall<RespondActivityTaskCompletedOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::RespondActivityTaskCompletedAsync(RespondActivityTaskCompletedRequest&& request, const RespondActivityTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::RespondActivityTaskCompletedAsyncHelper, Aws::Client::RejectedAsyncCall<RespondActivityTaskCompletedOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::RespondActivityTaskCompletedAsyncHelper(const RespondActivityTaskCompletedRequest& request, const RespondActivityTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -944,12 +1204,22 @@ RespondActivityTaskFailedOutcome SWFClient::RespondActivityTaskFailed(const Resp
 
 RespondActivityTaskFailedOutcomeCallable SWFClient::RespondActivityTaskFailedCallable(const RespondActivityTaskFailedRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::RespondActivityTaskFailed, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::RespondActivityTaskFailed, Aws::Client::RejectedCallOutcome<RespondActivityTaskFailedOutcome>(), this, request);
+}
+
+RespondActivityTaskFailedOutcomeCallable SWFClient::RespondActivityTaskFailedCallable(RespondActivityTaskFailedRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::RespondActivityTaskFailed, Aws::Client::RejectedCallOutcome<RespondActivityTaskFailedOutcome>(), this, std::move(request));
 }
 
 void SWFClient::RespondActivityTaskFailedAsync(const RespondActivityTaskFailedRequest& request, const RespondActivityTaskFailedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::RespondActivityTaskFailedAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::RespondActivityTaskFailedAsyncHelper, Aws::Client::RejectedAsyncCall<RespondActivityTaskFailedOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::RespondActivityTaskFailedAsync(RespondActivityTaskFailedRequest&& request, const RespondActivityTaskFailedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::RespondActivityTaskFailedAsyncHelper, Aws::Client::RejectedAsyncCall<RespondActivityTaskFailedOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::RespondActivityTaskFailedAsyncHelper(const RespondActivityTaskFailedRequest& request, const RespondActivityTaskFailedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -975,12 +1245,22 @@ RespondDecisionTaskCompletedOutcome SWFClient::RespondDecisionTaskCompleted(cons
 
 RespondDecisionTaskCompletedOutcomeCallable SWFClient::RespondDecisionTaskCompletedCallable(const RespondDecisionTaskCompletedRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::RespondDecisionTaskCompleted, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::RespondDecisionTaskCompleted, Aws::Client::RejectedCallOutcome<RespondDecisionTaskCompletedOutcome>(), this, request);
+}
+
+RespondDecisionTaskCompletedOutcomeCallable SWFClient::RespondDecisionTaskCompletedCallable(RespondDecisionTaskCompletedRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::RespondDecisionTaskCompleted, Aws::Client::RejectedCallOutcome<RespondDecisionTaskCompletedOutcome>(), this, std::move(request));
 }
 
 void SWFClient::RespondDecisionTaskCompletedAsync(const RespondDecisionTaskCompletedRequest& request, const RespondDecisionTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::RespondDecisionTaskCompletedAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::RespondDecisionTaskCompletedAsyncHelper, Aws::Client::RejectedAsyncCall<RespondDecisionTaskCompletedOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::RespondDecisionTaskCompletedAsync(RespondDecisionTaskCompletedRequest&& request, const RespondDecisionTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::RespondDecisionTaskCompletedAsyncHelper, Aws::Client::RejectedAsyncCall<RespondDecisionTaskCompletedOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::RespondDecisionTaskCompletedAsyncHelper(const RespondDecisionTaskCompletedRequest& request, const RespondDecisionTaskCompletedResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1006,12 +1286,22 @@ SignalWorkflowExecutionOutcome SWFClient::SignalWorkflowExecution(const SignalWo
 
 SignalWorkflowExecutionOutcomeCallable SWFClient::SignalWorkflowExecutionCallable(const SignalWorkflowExecutionRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::SignalWorkflowExecution, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::SignalWorkflowExecution, Aws::Client::RejectedCallOutcome<SignalWorkflowExecutionOutcome>(), this, request);
+}
+
+SignalWorkflowExecutionOutcomeCallable SWFClient::SignalWorkflowExecutionCallable(SignalWorkflowExecutionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::SignalWorkflowExecution, Aws::Client::RejectedCallOutcome<SignalWorkflowExecutionOutcome>(), this, std::move(request));
 }
 
 void SWFClient::SignalWorkflowExecutionAsync(const SignalWorkflowExecutionRequest& request, const SignalWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::SignalWorkflowExecutionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::SignalWorkflowExecutionAsyncHelper, Aws::Client::RejectedAsyncCall<SignalWorkflowExecutionOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::SignalWorkflowExecutionAsync(SignalWorkflowExecutionRequest&& request, const SignalWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::SignalWorkflowExecutionAsyncHelper, Aws::Client::RejectedAsyncCall<SignalWorkflowExecutionOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::SignalWorkflowExecutionAsyncHelper(const SignalWorkflowExecutionRequest& request, const SignalWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1037,12 +1327,22 @@ StartWorkflowExecutionOutcome SWFClient::StartWorkflowExecution(const StartWorkf
 
 StartWorkflowExecutionOutcomeCallable SWFClient::StartWorkflowExecutionCallable(const StartWorkflowExecutionRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::StartWorkflowExecution, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::StartWorkflowExecution, Aws::Client::RejectedCallOutcome<StartWorkflowExecutionOutcome>(), this, request);
+}
+
+StartWorkflowExecutionOutcomeCallable SWFClient::StartWorkflowExecutionCallable(StartWorkflowExecutionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::StartWorkflowExecution, Aws::Client::RejectedCallOutcome<StartWorkflowExecutionOutcome>(), this, std::move(request));
 }
 
 void SWFClient::StartWorkflowExecutionAsync(const StartWorkflowExecutionRequest& request, const StartWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::StartWorkflowExecutionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::StartWorkflowExecutionAsyncHelper, Aws::Client::RejectedAsyncCall<StartWorkflowExecutionOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::StartWorkflowExecutionAsync(StartWorkflowExecutionRequest&& request, const StartWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::StartWorkflowExecutionAsyncHelper, Aws::Client::RejectedAsyncCall<StartWorkflowExecutionOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::StartWorkflowExecutionAsyncHelper(const StartWorkflowExecutionRequest& request, const StartWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1068,12 +1368,22 @@ TerminateWorkflowExecutionOutcome SWFClient::TerminateWorkflowExecution(const Te
 
 TerminateWorkflowExecutionOutcomeCallable SWFClient::TerminateWorkflowExecutionCallable(const TerminateWorkflowExecutionRequest& request) const
 {
-  return std::async(std::launch::async, &SWFClient::TerminateWorkflowExecution, this, request);
+  return m_executor->SubmitWithFuture(&SWFClient::TerminateWorkflowExecution, Aws::Client::RejectedCallOutcome<TerminateWorkflowExecutionOutcome>(), this, request);
+}
+
+TerminateWorkflowExecutionOutcomeCallable SWFClient::TerminateWorkflowExecutionCallable(TerminateWorkflowExecutionRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&SWFClient::TerminateWorkflowExecution, Aws::Client::RejectedCallOutcome<TerminateWorkflowExecutionOutcome>(), this, std::move(request));
 }
 
 void SWFClient::TerminateWorkflowExecutionAsync(const TerminateWorkflowExecutionRequest& request, const TerminateWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&SWFClient::TerminateWorkflowExecutionAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&SWFClient::TerminateWorkflowExecutionAsyncHelper, Aws::Client::RejectedAsyncCall<TerminateWorkflowExecutionOutcome>(), this, request, handler, context);
+}
+
+void SWFClient::TerminateWorkflowExecutionAsync(TerminateWorkflowExecutionRequest&& request, const TerminateWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&SWFClient::TerminateWorkflowExecutionAsyncHelper, Aws::Client::RejectedAsyncCall<TerminateWorkflowExecutionOutcome>(), this, std::move(request), handler, context);
 }
 
 void SWFClient::TerminateWorkflowExecutionAsyncHelper(const TerminateWorkflowExecutionRequest& request, const TerminateWorkflowExecutionResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -33,6 +33,8 @@
 #include <aws/s3/model/CompleteMultipartUploadRequest.h>
 
 #include <aws/core/utils/HashingUtils.h>
+#include <aws/core/utils/crypto/PayloadDigests.h>
+#include <aws/core/utils/stream/PreallocatedStreamBuf.h>
 
 #include <algorithm>
 
@@ -480,10 +482,8 @@ void UploadFileRequest::CreateStreamBuffer(std::shared_ptr<Aws::IOStream>& strea
     streamBuf->seekg(0);
 }
 
-uint64_t UploadFileRequest::ReadNextPart(const std::shared_ptr<UploadBuffer>& buffer, std::shared_ptr<Aws::IOStream>& streamBuf, uint32_t& partNum)
+uint64_t UploadFileRequest::ReadNextPart(const std::shared_ptr<UploadBuffer>& buffer, uint32_t& partNum)
 {
-    // This whole call is a WIP.  Big comment below, but yeah, this has to become much simpler and more efficient.
-
     uint64_t bytesRead = 0;
     {
         std::lock_guard<std::mutex> someLock(m_fileRequestMutex);
@@ -507,18 +507,24 @@ uint64_t UploadFileRequest::ReadNextPart(const std::shared_ptr<UploadBuffer>& bu
         }
     }
 
-    // This is not ideal!  You're thinking "Wait, we got this buffer up there and now we're making a copy anyway.." You are right!
-    // This needs to be done in a better way.  pubsetbuf it turns out does not work as I'd hoped.  The buffer is still essentially acting a shared
-    // resource throttle, albeit double what is intended currently with the stream copy happening.  
-    // S3Client could be made to accept a buffer.. I'm thinking we're not doing that either.
-    // At this point this is considered a not horrible solution but one we'd like to try to revisit  
-    streamBuf->write((char*)buffer->GetUnderlyingData(), bytesRead);
-
-    streamBuf->seekg(0);
-
     return bytesRead;
 }
 
+//when the client's signer needs the sha256 of the same bytes we need the md5 of, both come out of one read of the part
+//and the request carries the sha256 along to the client. Returns the md5.
+static ByteBuffer ComputePartDigests(const Aws::S3::S3Client& s3Client, Aws::AmazonWebServiceRequest& request, Aws::IOStream& body)
+{
+    unsigned digestMask = Aws::Utils::Crypto::PayloadDigests::MD5_DIGEST;
+    if (s3Client.SignsPayloadHash(request))
+    {
+        digestMask |= Aws::Utils::Crypto::PayloadDigests::SHA256_DIGEST;
+    }
+    auto digests = Aws::MakeShared<Aws::Utils::Crypto::PayloadDigests>(ALLOCATION_TAG);
+    digests->Compute(body, digestMask);
+    request.SetPayloadDigests(digests);
+    return digests->GetMD5();
+}
+
 // We have a buffer - let's fill it with data from our file and begin a multi part upload request
 bool UploadFileRequest::ProcessBuffer(const std::shared_ptr<UploadBuffer>& buffer)
 {
@@ -527,15 +533,19 @@ bool UploadFileRequest::ProcessBuffer(const std::shared_ptr<UploadBuffer>& buffe
         return false;
     }
 
-    std::shared_ptr<Aws::IOStream> streamBuf = Aws::MakeShared<Aws::StringStream>(ALLOCATION_TAG);
     uint32_t partNum = 0;
-    uint64_t bytesRead = ReadNextPart(buffer, streamBuf, partNum);
+    uint64_t bytesRead = ReadNextPart(buffer, partNum);
 
     if (!bytesRead)
     {
         return false;
     }
 
+    //the part is sent straight out of the buffer it was read into. The buffer stays with this request until every part has
+    //come back, so it outlives the upload and any retries of it.
+    std::shared_ptr<Aws::IOStream> streamBuf = Aws::MakeShared<Aws::Utils::Stream::PreallocatedIOStream>(ALLOCATION_TAG,
+        reinterpret_cast<char*>(buffer->GetUnderlyingData()), static_cast<std::size_t>(bytesRead));
+
     if (IsSinglePartUpload())
     {
         // Don't need more than one part, do everything now
@@ -548,7 +558,7 @@ bool UploadFileRequest::ProcessBuffer(const std::shared_ptr<UploadBuffer>& buffe
     thisRequest.m_partRequest.SetPartNumber(partNum);
     thisRequest.m_partRequest.SetUploadId(GetUploadId());
     thisRequest.m_partRequest.SetBody(streamBuf);
-    thisRequest.m_partMd5 = HashingUtils::CalculateMD5(*streamBuf);
+    thisRequest.m_partMd5 = ComputePartDigests(*GetS3Client(), thisRequest.m_partRequest, *streamBuf);
     thisRequest.m_partRequest.SetContentMD5(HashingUtils::Base64Encode(thisRequest.m_partMd5));
     thisRequest.m_partRequest.SetContentLength(static_cast<long>(bytesRead));
 
@@ -799,7 +809,7 @@ bool UploadFileRequest::DoSingleObjectUpload(std::shared_ptr<Aws::IOStream>& str
 
     putObjectRequest.SetBody(streamBuf);
     putObjectRequest.SetContentLength(static_cast<long>(bytesRead));
-    putObjectRequest.SetContentMD5(HashingUtils::Base64Encode(HashingUtils::CalculateMD5(*putObjectRequest.GetBody())));
+    putObjectRequest.SetContentMD5(HashingUtils::Base64Encode(ComputePartDigests(*GetS3Client(), putObjectRequest, *streamBuf)));
     if (m_contentType.length())
     {
         putObjectRequest.SetContentType(m_contentType);
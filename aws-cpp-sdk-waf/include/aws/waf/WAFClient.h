@@ -55,6 +55,43 @@
 #include <aws/waf/model/UpdateWebACLResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/waf/model/CreateByteMatchSetRequest.h>
+#include <aws/waf/model/CreateIPSetRequest.h>
+#include <aws/waf/model/CreateRuleRequest.h>
+#include <aws/waf/model/CreateSizeConstraintSetRequest.h>
+#include <aws/waf/model/CreateSqlInjectionMatchSetRequest.h>
+#include <aws/waf/model/CreateWebACLRequest.h>
+#include <aws/waf/model/DeleteByteMatchSetRequest.h>
+#include <aws/waf/model/DeleteIPSetRequest.h>
+#include <aws/waf/model/DeleteRuleRequest.h>
+#include <aws/waf/model/DeleteSizeConstraintSetRequest.h>
+#include <aws/waf/model/DeleteSqlInjectionMatchSetRequest.h>
+#include <aws/waf/model/DeleteWebACLRequest.h>
+#include <aws/waf/model/GetByteMatchSetRequest.h>
+#include <aws/waf/model/GetChangeTokenRequest.h>
+#include <aws/waf/model/GetChangeTokenStatusRequest.h>
+#include <aws/waf/model/GetIPSetRequest.h>
+#include <aws/waf/model/GetRuleRequest.h>
+#include <aws/waf/model/GetSampledRequestsRequest.h>
+#include <aws/waf/model/GetSizeConstraintSetRequest.h>
+#include <aws/waf/model/GetSqlInjectionMatchSetRequest.h>
+#include <aws/waf/model/GetWebACLRequest.h>
+#include <aws/waf/model/ListByteMatchSetsRequest.h>
+#include <aws/waf/model/ListIPSetsRequest.h>
+#include <aws/waf/model/ListRulesRequest.h>
+#include <aws/waf/model/ListSizeConstraintSetsRequest.h>
+#include <aws/waf/model/ListSqlInjectionMatchSetsRequest.h>
+#include <aws/waf/model/ListWebACLsRequest.h>
+#include <aws/waf/model/UpdateByteMatchSetRequest.h>
+#include <aws/waf/model/UpdateIPSetRequest.h>
+#include <aws/waf/model/UpdateRuleRequest.h>
+#include <aws/waf/model/UpdateSizeConstraintSetRequest.h>
+#include <aws/waf/model/UpdateSqlInjectionMatchSetRequest.h>
+#include <aws/waf/model/UpdateWebACLRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -322,6 +359,11 @@ namespace Model
          */
         virtual Model::CreateByteMatchSetOutcomeCallable CreateByteMatchSetCallable(const Model::CreateByteMatchSetRequest& request) const;
 
+        /**
+         * Same as CreateByteMatchSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateByteMatchSetOutcomeCallable CreateByteMatchSetCallable(Model::CreateByteMatchSetRequest&& request) const;
+
         /**
          * <p>Creates a <code>ByteMatchSet</code>. You then use <a>UpdateByteMatchSet</a>
          * to identify the part of a web request that you want AWS WAF to inspect, such as
@@ -348,6 +390,11 @@ namespace Model
          */
         virtual void CreateByteMatchSetAsync(const Model::CreateByteMatchSetRequest& request, const CreateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateByteMatchSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateByteMatchSetAsync(Model::CreateByteMatchSetRequest&& request, const CreateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates an <a>IPSet</a>, which you use to specify which web requests you want
          * to allow or block based on the IP addresses that the requests originate from.
@@ -392,6 +439,11 @@ namespace Model
          */
         virtual Model::CreateIPSetOutcomeCallable CreateIPSetCallable(const Model::CreateIPSetRequest& request) const;
 
+        /**
+         * Same as CreateIPSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateIPSetOutcomeCallable CreateIPSetCallable(Model::CreateIPSetRequest&& request) const;
+
         /**
          * <p>Creates an <a>IPSet</a>, which you use to specify which web requests you want
          * to allow or block based on the IP addresses that the requests originate from.
@@ -415,6 +467,11 @@ namespace Model
          */
         virtual void CreateIPSetAsync(const Model::CreateIPSetRequest& request, const CreateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateIPSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateIPSetAsync(Model::CreateIPSetRequest&& request, const CreateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <code>Rule</code>, which contains the <code>IPSet</code> objects,
          * <code>ByteMatchSet</code> objects, and other predicates that identify the
@@ -481,6 +538,11 @@ namespace Model
          */
         virtual Model::CreateRuleOutcomeCallable CreateRuleCallable(const Model::CreateRuleRequest& request) const;
 
+        /**
+         * Same as CreateRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateRuleOutcomeCallable CreateRuleCallable(Model::CreateRuleRequest&& request) const;
+
         /**
          * <p>Creates a <code>Rule</code>, which contains the <code>IPSet</code> objects,
          * <code>ByteMatchSet</code> objects, and other predicates that identify the
@@ -515,6 +577,11 @@ namespace Model
          */
         virtual void CreateRuleAsync(const Model::CreateRuleRequest& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateRuleAsync(Model::CreateRuleRequest&& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <code>SizeConstraintSet</code>. You then use
          * <a>UpdateSizeConstraintSet</a> to identify the part of a web request that you
@@ -565,6 +632,11 @@ namespace Model
          */
         virtual Model::CreateSizeConstraintSetOutcomeCallable CreateSizeConstraintSetCallable(const Model::CreateSizeConstraintSetRequest& request) const;
 
+        /**
+         * Same as CreateSizeConstraintSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateSizeConstraintSetOutcomeCallable CreateSizeConstraintSetCallable(Model::CreateSizeConstraintSetRequest&& request) const;
+
         /**
          * <p>Creates a <code>SizeConstraintSet</code>. You then use
          * <a>UpdateSizeConstraintSet</a> to identify the part of a web request that you
@@ -591,6 +663,11 @@ namespace Model
          */
         virtual void CreateSizeConstraintSetAsync(const Model::CreateSizeConstraintSetRequest& request, const CreateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSizeConstraintSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateSizeConstraintSetAsync(Model::CreateSizeConstraintSetRequest&& request, const CreateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <a>SqlInjectionMatchSet</a>, which you use to allow, block, or
          * count requests that contain snippets of SQL code in a specified part of web
@@ -633,6 +710,11 @@ namespace Model
          */
         virtual Model::CreateSqlInjectionMatchSetOutcomeCallable CreateSqlInjectionMatchSetCallable(const Model::CreateSqlInjectionMatchSetRequest& request) const;
 
+        /**
+         * Same as CreateSqlInjectionMatchSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateSqlInjectionMatchSetOutcomeCallable CreateSqlInjectionMatchSetCallable(Model::CreateSqlInjectionMatchSetRequest&& request) const;
+
         /**
          * <p>Creates a <a>SqlInjectionMatchSet</a>, which you use to allow, block, or
          * count requests that contain snippets of SQL code in a specified part of web
@@ -655,6 +737,11 @@ namespace Model
          */
         virtual void CreateSqlInjectionMatchSetAsync(const Model::CreateSqlInjectionMatchSetRequest& request, const CreateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateSqlInjectionMatchSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateSqlInjectionMatchSetAsync(Model::CreateSqlInjectionMatchSetRequest&& request, const CreateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Creates a <code>WebACL</code>, which contains the <code>Rules</code> that
          * identify the CloudFront web requests that you want to allow, block, or count.
@@ -717,6 +804,11 @@ namespace Model
          */
         virtual Model::CreateWebACLOutcomeCallable CreateWebACLCallable(const Model::CreateWebACLRequest& request) const;
 
+        /**
+         * Same as CreateWebACLCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateWebACLOutcomeCallable CreateWebACLCallable(Model::CreateWebACLRequest&& request) const;
+
         /**
          * <p>Creates a <code>WebACL</code>, which contains the <code>Rules</code> that
          * identify the CloudFront web requests that you want to allow, block, or count.
@@ -749,6 +841,11 @@ namespace Model
          */
         virtual void CreateWebACLAsync(const Model::CreateWebACLRequest& request, const CreateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateWebACLAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateWebACLAsync(Model::CreateWebACLRequest&& request, const CreateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes a <a>ByteMatchSet</a>. You can't delete a
          * <code>ByteMatchSet</code> if it's still used in any <code>Rules</code> or if it
@@ -781,6 +878,11 @@ namespace Model
          */
         virtual Model::DeleteByteMatchSetOutcomeCallable DeleteByteMatchSetCallable(const Model::DeleteByteMatchSetRequest& request) const;
 
+        /**
+         * Same as DeleteByteMatchSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteByteMatchSetOutcomeCallable DeleteByteMatchSetCallable(Model::DeleteByteMatchSetRequest&& request) const;
+
         /**
          * <p>Permanently deletes a <a>ByteMatchSet</a>. You can't delete a
          * <code>ByteMatchSet</code> if it's still used in any <code>Rules</code> or if it
@@ -798,6 +900,11 @@ namespace Model
          */
         virtual void DeleteByteMatchSetAsync(const Model::DeleteByteMatchSetRequest& request, const DeleteByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteByteMatchSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteByteMatchSetAsync(Model::DeleteByteMatchSetRequest&& request, const DeleteByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes an <a>IPSet</a>. You can't delete an <code>IPSet</code>
          * if it's still used in any <code>Rules</code> or if it still includes any IP
@@ -828,6 +935,11 @@ namespace Model
          */
         virtual Model::DeleteIPSetOutcomeCallable DeleteIPSetCallable(const Model::DeleteIPSetRequest& request) const;
 
+        /**
+         * Same as DeleteIPSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteIPSetOutcomeCallable DeleteIPSetCallable(Model::DeleteIPSetRequest&& request) const;
+
         /**
          * <p>Permanently deletes an <a>IPSet</a>. You can't delete an <code>IPSet</code>
          * if it's still used in any <code>Rules</code> or if it still includes any IP
@@ -844,6 +956,11 @@ namespace Model
          */
         virtual void DeleteIPSetAsync(const Model::DeleteIPSetRequest& request, const DeleteIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteIPSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteIPSetAsync(Model::DeleteIPSetRequest&& request, const DeleteIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes a <a>Rule</a>. You can't delete a <code>Rule</code> if
          * it's still used in any <code>WebACL</code> objects or if it still includes any
@@ -874,6 +991,11 @@ namespace Model
          */
         virtual Model::DeleteRuleOutcomeCallable DeleteRuleCallable(const Model::DeleteRuleRequest& request) const;
 
+        /**
+         * Same as DeleteRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteRuleOutcomeCallable DeleteRuleCallable(Model::DeleteRuleRequest&& request) const;
+
         /**
          * <p>Permanently deletes a <a>Rule</a>. You can't delete a <code>Rule</code> if
          * it's still used in any <code>WebACL</code> objects or if it still includes any
@@ -890,6 +1012,11 @@ namespace Model
          */
         virtual void DeleteRuleAsync(const Model::DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteRuleAsync(Model::DeleteRuleRequest&& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes a <a>SizeConstraintSet</a>. You can't delete a
          * <code>SizeConstraintSet</code> if it's still used in any <code>Rules</code> or
@@ -924,6 +1051,11 @@ namespace Model
          */
         virtual Model::DeleteSizeConstraintSetOutcomeCallable DeleteSizeConstraintSetCallable(const Model::DeleteSizeConstraintSetRequest& request) const;
 
+        /**
+         * Same as DeleteSizeConstraintSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSizeConstraintSetOutcomeCallable DeleteSizeConstraintSetCallable(Model::DeleteSizeConstraintSetRequest&& request) const;
+
         /**
          * <p>Permanently deletes a <a>SizeConstraintSet</a>. You can't delete a
          * <code>SizeConstraintSet</code> if it's still used in any <code>Rules</code> or
@@ -942,6 +1074,11 @@ namespace Model
          */
         virtual void DeleteSizeConstraintSetAsync(const Model::DeleteSizeConstraintSetRequest& request, const DeleteSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSizeConstraintSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSizeConstraintSetAsync(Model::DeleteSizeConstraintSetRequest&& request, const DeleteSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes a <a>SqlInjectionMatchSet</a>. You can't delete a
          * <code>SqlInjectionMatchSet</code> if it's still used in any <code>Rules</code>
@@ -976,6 +1113,11 @@ namespace Model
          */
         virtual Model::DeleteSqlInjectionMatchSetOutcomeCallable DeleteSqlInjectionMatchSetCallable(const Model::DeleteSqlInjectionMatchSetRequest& request) const;
 
+        /**
+         * Same as DeleteSqlInjectionMatchSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteSqlInjectionMatchSetOutcomeCallable DeleteSqlInjectionMatchSetCallable(Model::DeleteSqlInjectionMatchSetRequest&& request) const;
+
         /**
          * <p>Permanently deletes a <a>SqlInjectionMatchSet</a>. You can't delete a
          * <code>SqlInjectionMatchSet</code> if it's still used in any <code>Rules</code>
@@ -994,6 +1136,11 @@ namespace Model
          */
         virtual void DeleteSqlInjectionMatchSetAsync(const Model::DeleteSqlInjectionMatchSetRequest& request, const DeleteSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteSqlInjectionMatchSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteSqlInjectionMatchSetAsync(Model::DeleteSqlInjectionMatchSetRequest&& request, const DeleteSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Permanently deletes a <a>WebACL</a>. You can't delete a <code>WebACL</code>
          * if it still contains any <code>Rules</code>.</p> <p>To delete a
@@ -1020,6 +1167,11 @@ namespace Model
          */
         virtual Model::DeleteWebACLOutcomeCallable DeleteWebACLCallable(const Model::DeleteWebACLRequest& request) const;
 
+        /**
+         * Same as DeleteWebACLCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DeleteWebACLOutcomeCallable DeleteWebACLCallable(Model::DeleteWebACLRequest&& request) const;
+
         /**
          * <p>Permanently deletes a <a>WebACL</a>. You can't delete a <code>WebACL</code>
          * if it still contains any <code>Rules</code>.</p> <p>To delete a
@@ -1034,6 +1186,11 @@ namespace Model
          */
         virtual void DeleteWebACLAsync(const Model::DeleteWebACLRequest& request, const DeleteWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DeleteWebACLAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DeleteWebACLAsync(Model::DeleteWebACLRequest&& request, const DeleteWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the <a>ByteMatchSet</a> specified by <code>ByteMatchSetId</code>.</p>
          */
@@ -1046,6 +1203,11 @@ namespace Model
          */
         virtual Model::GetByteMatchSetOutcomeCallable GetByteMatchSetCallable(const Model::GetByteMatchSetRequest& request) const;
 
+        /**
+         * Same as GetByteMatchSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetByteMatchSetOutcomeCallable GetByteMatchSetCallable(Model::GetByteMatchSetRequest&& request) const;
+
         /**
          * <p>Returns the <a>ByteMatchSet</a> specified by <code>ByteMatchSetId</code>.</p>
          *
@@ -1053,6 +1215,11 @@ namespace Model
          */
         virtual void GetByteMatchSetAsync(const Model::GetByteMatchSetRequest& request, const GetByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetByteMatchSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetByteMatchSetAsync(Model::GetByteMatchSetRequest&& request, const GetByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>When you want to create, update, or delete AWS WAF objects, get a change
          * token and include the change token in the create, update, or delete request.
@@ -1089,6 +1256,11 @@ namespace Model
          */
         virtual Model::GetChangeTokenOutcomeCallable GetChangeTokenCallable(const Model::GetChangeTokenRequest& request) const;
 
+        /**
+         * Same as GetChangeTokenCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetChangeTokenOutcomeCallable GetChangeTokenCallable(Model::GetChangeTokenRequest&& request) const;
+
         /**
          * <p>When you want to create, update, or delete AWS WAF objects, get a change
          * token and include the change token in the create, update, or delete request.
@@ -1108,6 +1280,11 @@ namespace Model
          */
         virtual void GetChangeTokenAsync(const Model::GetChangeTokenRequest& request, const GetChangeTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetChangeTokenAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetChangeTokenAsync(Model::GetChangeTokenRequest&& request, const GetChangeTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the status of a <code>ChangeToken</code> that you got by calling
          * <a>GetChangeToken</a>. <code>ChangeTokenStatus</code> is one of the following
@@ -1132,6 +1309,11 @@ namespace Model
          */
         virtual Model::GetChangeTokenStatusOutcomeCallable GetChangeTokenStatusCallable(const Model::GetChangeTokenStatusRequest& request) const;
 
+        /**
+         * Same as GetChangeTokenStatusCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetChangeTokenStatusOutcomeCallable GetChangeTokenStatusCallable(Model::GetChangeTokenStatusRequest&& request) const;
+
         /**
          * <p>Returns the status of a <code>ChangeToken</code> that you got by calling
          * <a>GetChangeToken</a>. <code>ChangeTokenStatus</code> is one of the following
@@ -1145,6 +1327,11 @@ namespace Model
          */
         virtual void GetChangeTokenStatusAsync(const Model::GetChangeTokenStatusRequest& request, const GetChangeTokenStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetChangeTokenStatusAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetChangeTokenStatusAsync(Model::GetChangeTokenStatusRequest&& request, const GetChangeTokenStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the <a>IPSet</a> that is specified by <code>IPSetId</code>.</p>
          */
@@ -1157,6 +1344,11 @@ namespace Model
          */
         virtual Model::GetIPSetOutcomeCallable GetIPSetCallable(const Model::GetIPSetRequest& request) const;
 
+        /**
+         * Same as GetIPSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetIPSetOutcomeCallable GetIPSetCallable(Model::GetIPSetRequest&& request) const;
+
         /**
          * <p>Returns the <a>IPSet</a> that is specified by <code>IPSetId</code>.</p>
          *
@@ -1164,6 +1356,11 @@ namespace Model
          */
         virtual void GetIPSetAsync(const Model::GetIPSetRequest& request, const GetIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetIPSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetIPSetAsync(Model::GetIPSetRequest&& request, const GetIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the <a>Rule</a> that is specified by the <code>RuleId</code> that you
          * included in the <code>GetRule</code> request.</p>
@@ -1178,6 +1375,11 @@ namespace Model
          */
         virtual Model::GetRuleOutcomeCallable GetRuleCallable(const Model::GetRuleRequest& request) const;
 
+        /**
+         * Same as GetRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetRuleOutcomeCallable GetRuleCallable(Model::GetRuleRequest&& request) const;
+
         /**
          * <p>Returns the <a>Rule</a> that is specified by the <code>RuleId</code> that you
          * included in the <code>GetRule</code> request.</p>
@@ -1186,6 +1388,11 @@ namespace Model
          */
         virtual void GetRuleAsync(const Model::GetRuleRequest& request, const GetRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetRuleAsync(Model::GetRuleRequest&& request, const GetRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Gets detailed information about a specified number of requests--a
          * sample--that AWS WAF randomly selects from among the first 5,000 requests that
@@ -1216,6 +1423,11 @@ namespace Model
          */
         virtual Model::GetSampledRequestsOutcomeCallable GetSampledRequestsCallable(const Model::GetSampledRequestsRequest& request) const;
 
+        /**
+         * Same as GetSampledRequestsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetSampledRequestsOutcomeCallable GetSampledRequestsCallable(Model::GetSampledRequestsRequest&& request) const;
+
         /**
          * <p>Gets detailed information about a specified number of requests--a
          * sample--that AWS WAF randomly selects from among the first 5,000 requests that
@@ -1232,6 +1444,11 @@ namespace Model
          */
         virtual void GetSampledRequestsAsync(const Model::GetSampledRequestsRequest& request, const GetSampledRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSampledRequestsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetSampledRequestsAsync(Model::GetSampledRequestsRequest&& request, const GetSampledRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the <a>SizeConstraintSet</a> specified by
          * <code>SizeConstraintSetId</code>.</p>
@@ -1246,6 +1463,11 @@ namespace Model
          */
         virtual Model::GetSizeConstraintSetOutcomeCallable GetSizeConstraintSetCallable(const Model::GetSizeConstraintSetRequest& request) const;
 
+        /**
+         * Same as GetSizeConstraintSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetSizeConstraintSetOutcomeCallable GetSizeConstraintSetCallable(Model::GetSizeConstraintSetRequest&& request) const;
+
         /**
          * <p>Returns the <a>SizeConstraintSet</a> specified by
          * <code>SizeConstraintSetId</code>.</p>
@@ -1254,6 +1476,11 @@ namespace Model
          */
         virtual void GetSizeConstraintSetAsync(const Model::GetSizeConstraintSetRequest& request, const GetSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSizeConstraintSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetSizeConstraintSetAsync(Model::GetSizeConstraintSetRequest&& request, const GetSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the <a>SqlInjectionMatchSet</a> that is specified by
          * <code>SqlInjectionMatchSetId</code>.</p>
@@ -1268,6 +1495,11 @@ namespace Model
          */
         virtual Model::GetSqlInjectionMatchSetOutcomeCallable GetSqlInjectionMatchSetCallable(const Model::GetSqlInjectionMatchSetRequest& request) const;
 
+        /**
+         * Same as GetSqlInjectionMatchSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetSqlInjectionMatchSetOutcomeCallable GetSqlInjectionMatchSetCallable(Model::GetSqlInjectionMatchSetRequest&& request) const;
+
         /**
          * <p>Returns the <a>SqlInjectionMatchSet</a> that is specified by
          * <code>SqlInjectionMatchSetId</code>.</p>
@@ -1276,6 +1508,11 @@ namespace Model
          */
         virtual void GetSqlInjectionMatchSetAsync(const Model::GetSqlInjectionMatchSetRequest& request, const GetSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetSqlInjectionMatchSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetSqlInjectionMatchSetAsync(Model::GetSqlInjectionMatchSetRequest&& request, const GetSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns the <a>WebACL</a> that is specified by <code>WebACLId</code>.</p>
          */
@@ -1288,6 +1525,11 @@ namespace Model
          */
         virtual Model::GetWebACLOutcomeCallable GetWebACLCallable(const Model::GetWebACLRequest& request) const;
 
+        /**
+         * Same as GetWebACLCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::GetWebACLOutcomeCallable GetWebACLCallable(Model::GetWebACLRequest&& request) const;
+
         /**
          * <p>Returns the <a>WebACL</a> that is specified by <code>WebACLId</code>.</p>
          *
@@ -1295,6 +1537,11 @@ namespace Model
          */
         virtual void GetWebACLAsync(const Model::GetWebACLRequest& request, const GetWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as GetWebACLAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void GetWebACLAsync(Model::GetWebACLRequest&& request, const GetWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of <a>ByteMatchSetSummary</a> objects.</p>
          */
@@ -1307,6 +1554,11 @@ namespace Model
          */
         virtual Model::ListByteMatchSetsOutcomeCallable ListByteMatchSetsCallable(const Model::ListByteMatchSetsRequest& request) const;
 
+        /**
+         * Same as ListByteMatchSetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListByteMatchSetsOutcomeCallable ListByteMatchSetsCallable(Model::ListByteMatchSetsRequest&& request) const;
+
         /**
          * <p>Returns an array of <a>ByteMatchSetSummary</a> objects.</p>
          *
@@ -1314,6 +1566,11 @@ namespace Model
          */
         virtual void ListByteMatchSetsAsync(const Model::ListByteMatchSetsRequest& request, const ListByteMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListByteMatchSetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListByteMatchSetsAsync(Model::ListByteMatchSetsRequest&& request, const ListByteMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of <a>IPSetSummary</a> objects in the response.</p>
          */
@@ -1326,6 +1583,11 @@ namespace Model
          */
         virtual Model::ListIPSetsOutcomeCallable ListIPSetsCallable(const Model::ListIPSetsRequest& request) const;
 
+        /**
+         * Same as ListIPSetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListIPSetsOutcomeCallable ListIPSetsCallable(Model::ListIPSetsRequest&& request) const;
+
         /**
          * <p>Returns an array of <a>IPSetSummary</a> objects in the response.</p>
          *
@@ -1333,6 +1595,11 @@ namespace Model
          */
         virtual void ListIPSetsAsync(const Model::ListIPSetsRequest& request, const ListIPSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListIPSetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListIPSetsAsync(Model::ListIPSetsRequest&& request, const ListIPSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of <a>RuleSummary</a> objects.</p>
          */
@@ -1345,6 +1612,11 @@ namespace Model
          */
         virtual Model::ListRulesOutcomeCallable ListRulesCallable(const Model::ListRulesRequest& request) const;
 
+        /**
+         * Same as ListRulesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListRulesOutcomeCallable ListRulesCallable(Model::ListRulesRequest&& request) const;
+
         /**
          * <p>Returns an array of <a>RuleSummary</a> objects.</p>
          *
@@ -1352,6 +1624,11 @@ namespace Model
          */
         virtual void ListRulesAsync(const Model::ListRulesRequest& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListRulesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListRulesAsync(Model::ListRulesRequest&& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of <a>SizeConstraintSetSummary</a> objects.</p>
          */
@@ -1364,6 +1641,11 @@ namespace Model
          */
         virtual Model::ListSizeConstraintSetsOutcomeCallable ListSizeConstraintSetsCallable(const Model::ListSizeConstraintSetsRequest& request) const;
 
+        /**
+         * Same as ListSizeConstraintSetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListSizeConstraintSetsOutcomeCallable ListSizeConstraintSetsCallable(Model::ListSizeConstraintSetsRequest&& request) const;
+
         /**
          * <p>Returns an array of <a>SizeConstraintSetSummary</a> objects.</p>
          *
@@ -1371,6 +1653,11 @@ namespace Model
          */
         virtual void ListSizeConstraintSetsAsync(const Model::ListSizeConstraintSetsRequest& request, const ListSizeConstraintSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSizeConstraintSetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListSizeConstraintSetsAsync(Model::ListSizeConstraintSetsRequest&& request, const ListSizeConstraintSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of <a>SqlInjectionMatchSet</a> objects.</p>
          */
@@ -1383,6 +1670,11 @@ namespace Model
          */
         virtual Model::ListSqlInjectionMatchSetsOutcomeCallable ListSqlInjectionMatchSetsCallable(const Model::ListSqlInjectionMatchSetsRequest& request) const;
 
+        /**
+         * Same as ListSqlInjectionMatchSetsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListSqlInjectionMatchSetsOutcomeCallable ListSqlInjectionMatchSetsCallable(Model::ListSqlInjectionMatchSetsRequest&& request) const;
+
         /**
          * <p>Returns an array of <a>SqlInjectionMatchSet</a> objects.</p>
          *
@@ -1390,6 +1682,11 @@ namespace Model
          */
         virtual void ListSqlInjectionMatchSetsAsync(const Model::ListSqlInjectionMatchSetsRequest& request, const ListSqlInjectionMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListSqlInjectionMatchSetsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListSqlInjectionMatchSetsAsync(Model::ListSqlInjectionMatchSetsRequest&& request, const ListSqlInjectionMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Returns an array of <a>WebACLSummary</a> objects in the response.</p>
          */
@@ -1402,6 +1699,11 @@ namespace Model
          */
         virtual Model::ListWebACLsOutcomeCallable ListWebACLsCallable(const Model::ListWebACLsRequest& request) const;
 
+        /**
+         * Same as ListWebACLsCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::ListWebACLsOutcomeCallable ListWebACLsCallable(Model::ListWebACLsRequest&& request) const;
+
         /**
          * <p>Returns an array of <a>WebACLSummary</a> objects in the response.</p>
          *
@@ -1409,6 +1711,11 @@ namespace Model
          */
         virtual void ListWebACLsAsync(const Model::ListWebACLsRequest& request, const ListWebACLsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as ListWebACLsAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void ListWebACLsAsync(Model::ListWebACLsRequest&& request, const ListWebACLsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inserts or deletes <a>ByteMatchTuple</a> objects (filters) in a
          * <a>ByteMatchSet</a>. For each <code>ByteMatchTuple</code> object, you specify
@@ -1473,6 +1780,11 @@ namespace Model
          */
         virtual Model::UpdateByteMatchSetOutcomeCallable UpdateByteMatchSetCallable(const Model::UpdateByteMatchSetRequest& request) const;
 
+        /**
+         * Same as UpdateByteMatchSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateByteMatchSetOutcomeCallable UpdateByteMatchSetCallable(Model::UpdateByteMatchSetRequest&& request) const;
+
         /**
          * <p>Inserts or deletes <a>ByteMatchTuple</a> objects (filters) in a
          * <a>ByteMatchSet</a>. For each <code>ByteMatchTuple</code> object, you specify
@@ -1506,6 +1818,11 @@ namespace Model
          */
         virtual void UpdateByteMatchSetAsync(const Model::UpdateByteMatchSetRequest& request, const UpdateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateByteMatchSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateByteMatchSetAsync(Model::UpdateByteMatchSetRequest&& request, const UpdateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inserts or deletes <a>IPSetDescriptor</a> objects in an <code>IPSet</code>.
          * For each <code>IPSetDescriptor</code> object, you specify the following values:
@@ -1576,6 +1893,11 @@ namespace Model
          */
         virtual Model::UpdateIPSetOutcomeCallable UpdateIPSetCallable(const Model::UpdateIPSetRequest& request) const;
 
+        /**
+         * Same as UpdateIPSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateIPSetOutcomeCallable UpdateIPSetCallable(Model::UpdateIPSetRequest&& request) const;
+
         /**
          * <p>Inserts or deletes <a>IPSetDescriptor</a> objects in an <code>IPSet</code>.
          * For each <code>IPSetDescriptor</code> object, you specify the following values:
@@ -1612,6 +1934,11 @@ namespace Model
          */
         virtual void UpdateIPSetAsync(const Model::UpdateIPSetRequest& request, const UpdateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateIPSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateIPSetAsync(Model::UpdateIPSetRequest&& request, const UpdateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inserts or deletes <a>Predicate</a> objects in a <code>Rule</code>. Each
          * <code>Predicate</code> object identifies a predicate, such as a
@@ -1676,6 +2003,11 @@ namespace Model
          */
         virtual Model::UpdateRuleOutcomeCallable UpdateRuleCallable(const Model::UpdateRuleRequest& request) const;
 
+        /**
+         * Same as UpdateRuleCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateRuleOutcomeCallable UpdateRuleCallable(Model::UpdateRuleRequest&& request) const;
+
         /**
          * <p>Inserts or deletes <a>Predicate</a> objects in a <code>Rule</code>. Each
          * <code>Predicate</code> object identifies a predicate, such as a
@@ -1709,6 +2041,11 @@ namespace Model
          */
         virtual void UpdateRuleAsync(const Model::UpdateRuleRequest& request, const UpdateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateRuleAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateRuleAsync(Model::UpdateRuleRequest&& request, const UpdateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inserts or deletes <a>SizeConstraint</a> objects (filters) in a
          * <a>SizeConstraintSet</a>. For each <code>SizeConstraint</code> object, you
@@ -1779,6 +2116,11 @@ namespace Model
          */
         virtual Model::UpdateSizeConstraintSetOutcomeCallable UpdateSizeConstraintSetCallable(const Model::UpdateSizeConstraintSetRequest& request) const;
 
+        /**
+         * Same as UpdateSizeConstraintSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateSizeConstraintSetOutcomeCallable UpdateSizeConstraintSetCallable(Model::UpdateSizeConstraintSetRequest&& request) const;
+
         /**
          * <p>Inserts or deletes <a>SizeConstraint</a> objects (filters) in a
          * <a>SizeConstraintSet</a>. For each <code>SizeConstraint</code> object, you
@@ -1815,6 +2157,11 @@ namespace Model
          */
         virtual void UpdateSizeConstraintSetAsync(const Model::UpdateSizeConstraintSetRequest& request, const UpdateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateSizeConstraintSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateSizeConstraintSetAsync(Model::UpdateSizeConstraintSetRequest&& request, const UpdateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inserts or deletes <a>SqlInjectionMatchTuple</a> objects (filters) in a
          * <a>SqlInjectionMatchSet</a>. For each <code>SqlInjectionMatchTuple</code>
@@ -1875,6 +2222,11 @@ namespace Model
          */
         virtual Model::UpdateSqlInjectionMatchSetOutcomeCallable UpdateSqlInjectionMatchSetCallable(const Model::UpdateSqlInjectionMatchSetRequest& request) const;
 
+        /**
+         * Same as UpdateSqlInjectionMatchSetCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateSqlInjectionMatchSetOutcomeCallable UpdateSqlInjectionMatchSetCallable(Model::UpdateSqlInjectionMatchSetRequest&& request) const;
+
         /**
          * <p>Inserts or deletes <a>SqlInjectionMatchTuple</a> objects (filters) in a
          * <a>SqlInjectionMatchSet</a>. For each <code>SqlInjectionMatchTuple</code>
@@ -1906,6 +2258,11 @@ namespace Model
          */
         virtual void UpdateSqlInjectionMatchSetAsync(const Model::UpdateSqlInjectionMatchSetRequest& request, const UpdateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateSqlInjectionMatchSetAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateSqlInjectionMatchSetAsync(Model::UpdateSqlInjectionMatchSetRequest&& request, const UpdateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Inserts or deletes <a>ActivatedRule</a> objects in a <code>WebACL</code>.
          * Each <code>Rule</code> identifies web requests that you want to allow, block, or
@@ -1994,6 +2351,11 @@ namespace Model
          */
         virtual Model::UpdateWebACLOutcomeCallable UpdateWebACLCallable(const Model::UpdateWebACLRequest& request) const;
 
+        /**
+         * Same as UpdateWebACLCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::UpdateWebACLOutcomeCallable UpdateWebACLCallable(Model::UpdateWebACLRequest&& request) const;
+
         /**
          * <p>Inserts or deletes <a>ActivatedRule</a> objects in a <code>WebACL</code>.
          * Each <code>Rule</code> identifies web requests that you want to allow, block, or
@@ -2039,6 +2401,84 @@ namespace Model
          */
         virtual void UpdateWebACLAsync(const Model::UpdateWebACLRequest& request, const UpdateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as UpdateWebACLAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void UpdateWebACLAsync(Model::UpdateWebACLRequest&& request, const UpdateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateByteMatchSetOutcome> CreateByteMatchSetAwaitable(const Model::CreateByteMatchSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::CreateByteMatchSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateByteMatchSetOutcome> CreateByteMatchSetAwaitable(Model::CreateByteMatchSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::CreateByteMatchSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateIPSetOutcome> CreateIPSetAwaitable(const Model::CreateIPSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::CreateIPSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateIPSetOutcome> CreateIPSetAwaitable(Model::CreateIPSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::CreateIPSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRuleOutcome> CreateRuleAwaitable(const Model::CreateRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::CreateRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateRuleOutcome> CreateRuleAwaitable(Model::CreateRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::CreateRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSizeConstraintSetOutcome> CreateSizeConstraintSetAwaitable(const Model::CreateSizeConstraintSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::CreateSizeConstraintSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSizeConstraintSetOutcome> CreateSizeConstraintSetAwaitable(Model::CreateSizeConstraintSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::CreateSizeConstraintSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSqlInjectionMatchSetOutcome> CreateSqlInjectionMatchSetAwaitable(const Model::CreateSqlInjectionMatchSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::CreateSqlInjectionMatchSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateSqlInjectionMatchSetOutcome> CreateSqlInjectionMatchSetAwaitable(Model::CreateSqlInjectionMatchSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::CreateSqlInjectionMatchSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateWebACLOutcome> CreateWebACLAwaitable(const Model::CreateWebACLRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::CreateWebACL, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateWebACLOutcome> CreateWebACLAwaitable(Model::CreateWebACLRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::CreateWebACL, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteByteMatchSetOutcome> DeleteByteMatchSetAwaitable(const Model::DeleteByteMatchSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::DeleteByteMatchSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteByteMatchSetOutcome> DeleteByteMatchSetAwaitable(Model::DeleteByteMatchSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::DeleteByteMatchSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIPSetOutcome> DeleteIPSetAwaitable(const Model::DeleteIPSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::DeleteIPSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteIPSetOutcome> DeleteIPSetAwaitable(Model::DeleteIPSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::DeleteIPSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRuleOutcome> DeleteRuleAwaitable(const Model::DeleteRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::DeleteRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteRuleOutcome> DeleteRuleAwaitable(Model::DeleteRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::DeleteRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSizeConstraintSetOutcome> DeleteSizeConstraintSetAwaitable(const Model::DeleteSizeConstraintSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::DeleteSizeConstraintSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSizeConstraintSetOutcome> DeleteSizeConstraintSetAwaitable(Model::DeleteSizeConstraintSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::DeleteSizeConstraintSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSqlInjectionMatchSetOutcome> DeleteSqlInjectionMatchSetAwaitable(const Model::DeleteSqlInjectionMatchSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::DeleteSqlInjectionMatchSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteSqlInjectionMatchSetOutcome> DeleteSqlInjectionMatchSetAwaitable(Model::DeleteSqlInjectionMatchSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::DeleteSqlInjectionMatchSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteWebACLOutcome> DeleteWebACLAwaitable(const Model::DeleteWebACLRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::DeleteWebACL, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DeleteWebACLOutcome> DeleteWebACLAwaitable(Model::DeleteWebACLRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::DeleteWebACL, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetByteMatchSetOutcome> GetByteMatchSetAwaitable(const Model::GetByteMatchSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetByteMatchSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetByteMatchSetOutcome> GetByteMatchSetAwaitable(Model::GetByteMatchSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetByteMatchSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetChangeTokenOutcome> GetChangeTokenAwaitable(const Model::GetChangeTokenRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetChangeToken, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetChangeTokenOutcome> GetChangeTokenAwaitable(Model::GetChangeTokenRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetChangeToken, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetChangeTokenStatusOutcome> GetChangeTokenStatusAwaitable(const Model::GetChangeTokenStatusRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetChangeTokenStatus, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetChangeTokenStatusOutcome> GetChangeTokenStatusAwaitable(Model::GetChangeTokenStatusRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetChangeTokenStatus, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIPSetOutcome> GetIPSetAwaitable(const Model::GetIPSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetIPSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetIPSetOutcome> GetIPSetAwaitable(Model::GetIPSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetIPSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRuleOutcome> GetRuleAwaitable(const Model::GetRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetRuleOutcome> GetRuleAwaitable(Model::GetRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSampledRequestsOutcome> GetSampledRequestsAwaitable(const Model::GetSampledRequestsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetSampledRequests, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSampledRequestsOutcome> GetSampledRequestsAwaitable(Model::GetSampledRequestsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetSampledRequests, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSizeConstraintSetOutcome> GetSizeConstraintSetAwaitable(const Model::GetSizeConstraintSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetSizeConstraintSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSizeConstraintSetOutcome> GetSizeConstraintSetAwaitable(Model::GetSizeConstraintSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetSizeConstraintSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSqlInjectionMatchSetOutcome> GetSqlInjectionMatchSetAwaitable(const Model::GetSqlInjectionMatchSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetSqlInjectionMatchSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetSqlInjectionMatchSetOutcome> GetSqlInjectionMatchSetAwaitable(Model::GetSqlInjectionMatchSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetSqlInjectionMatchSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetWebACLOutcome> GetWebACLAwaitable(const Model::GetWebACLRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetWebACL, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::GetWebACLOutcome> GetWebACLAwaitable(Model::GetWebACLRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::GetWebACL, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListByteMatchSetsOutcome> ListByteMatchSetsAwaitable(const Model::ListByteMatchSetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::ListByteMatchSets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListByteMatchSetsOutcome> ListByteMatchSetsAwaitable(Model::ListByteMatchSetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::ListByteMatchSets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListIPSetsOutcome> ListIPSetsAwaitable(const Model::ListIPSetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::ListIPSets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListIPSetsOutcome> ListIPSetsAwaitable(Model::ListIPSetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::ListIPSets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRulesOutcome> ListRulesAwaitable(const Model::ListRulesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::ListRules, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListRulesOutcome> ListRulesAwaitable(Model::ListRulesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::ListRules, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSizeConstraintSetsOutcome> ListSizeConstraintSetsAwaitable(const Model::ListSizeConstraintSetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::ListSizeConstraintSets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSizeConstraintSetsOutcome> ListSizeConstraintSetsAwaitable(Model::ListSizeConstraintSetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::ListSizeConstraintSets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSqlInjectionMatchSetsOutcome> ListSqlInjectionMatchSetsAwaitable(const Model::ListSqlInjectionMatchSetsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::ListSqlInjectionMatchSets, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListSqlInjectionMatchSetsOutcome> ListSqlInjectionMatchSetsAwaitable(Model::ListSqlInjectionMatchSetsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::ListSqlInjectionMatchSets, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListWebACLsOutcome> ListWebACLsAwaitable(const Model::ListWebACLsRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::ListWebACLs, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::ListWebACLsOutcome> ListWebACLsAwaitable(Model::ListWebACLsRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::ListWebACLs, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateByteMatchSetOutcome> UpdateByteMatchSetAwaitable(const Model::UpdateByteMatchSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::UpdateByteMatchSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateByteMatchSetOutcome> UpdateByteMatchSetAwaitable(Model::UpdateByteMatchSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::UpdateByteMatchSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateIPSetOutcome> UpdateIPSetAwaitable(const Model::UpdateIPSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::UpdateIPSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateIPSetOutcome> UpdateIPSetAwaitable(Model::UpdateIPSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::UpdateIPSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateRuleOutcome> UpdateRuleAwaitable(const Model::UpdateRuleRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::UpdateRule, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateRuleOutcome> UpdateRuleAwaitable(Model::UpdateRuleRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::UpdateRule, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateSizeConstraintSetOutcome> UpdateSizeConstraintSetAwaitable(const Model::UpdateSizeConstraintSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::UpdateSizeConstraintSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateSizeConstraintSetOutcome> UpdateSizeConstraintSetAwaitable(Model::UpdateSizeConstraintSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::UpdateSizeConstraintSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateSqlInjectionMatchSetOutcome> UpdateSqlInjectionMatchSetAwaitable(const Model::UpdateSqlInjectionMatchSetRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::UpdateSqlInjectionMatchSet, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateSqlInjectionMatchSetOutcome> UpdateSqlInjectionMatchSetAwaitable(Model::UpdateSqlInjectionMatchSetRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::UpdateSqlInjectionMatchSet, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateWebACLOutcome> UpdateWebACLAwaitable(const Model::UpdateWebACLRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::UpdateWebACL, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::UpdateWebACLOutcome> UpdateWebACLAwaitable(Model::UpdateWebACLRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WAFClient::UpdateWebACL, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
@@ -140,12 +140,22 @@ CreateByteMatchSetOutcome WAFClient::CreateByteMatchSet(const CreateByteMatchSet
 
 CreateByteMatchSetOutcomeCallable WAFClient::CreateByteMatchSetCallable(const CreateByteMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::CreateByteMatchSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::CreateByteMatchSet, Aws::Client::RejectedCallOutcome<CreateByteMatchSetOutcome>(), this, request);
+}
+
+CreateByteMatchSetOutcomeCallable WAFClient::CreateByteMatchSetCallable(CreateByteMatchSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::CreateByteMatchSet, Aws::Client::RejectedCallOutcome<CreateByteMatchSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::CreateByteMatchSetAsync(const CreateByteMatchSetRequest& request, const CreateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::CreateByteMatchSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::CreateByteMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateByteMatchSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::CreateByteMatchSetAsync(CreateByteMatchSetRequest&& request, const CreateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::CreateByteMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateByteMatchSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::CreateByteMatchSetAsyncHelper(const CreateByteMatchSetRequest& request, const CreateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -171,12 +181,22 @@ CreateIPSetOutcome WAFClient::CreateIPSet(const CreateIPSetRequest& request) con
 
 CreateIPSetOutcomeCallable WAFClient::CreateIPSetCallable(const CreateIPSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::CreateIPSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::CreateIPSet, Aws::Client::RejectedCallOutcome<CreateIPSetOutcome>(), this, request);
+}
+
+CreateIPSetOutcomeCallable WAFClient::CreateIPSetCallable(CreateIPSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::CreateIPSet, Aws::Client::RejectedCallOutcome<CreateIPSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::CreateIPSetAsync(const CreateIPSetRequest& request, const CreateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::CreateIPSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::CreateIPSetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateIPSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::CreateIPSetAsync(CreateIPSetRequest&& request, const CreateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::CreateIPSetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateIPSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::CreateIPSetAsyncHelper(const CreateIPSetRequest& request, const CreateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -202,12 +222,22 @@ CreateRuleOutcome WAFClient::CreateRule(const CreateRuleRequest& request) const
 
 CreateRuleOutcomeCallable WAFClient::CreateRuleCallable(const CreateRuleRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::CreateRule, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::CreateRule, Aws::Client::RejectedCallOutcome<CreateRuleOutcome>(), this, request);
+}
+
+CreateRuleOutcomeCallable WAFClient::CreateRuleCallable(CreateRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::CreateRule, Aws::Client::RejectedCallOutcome<CreateRuleOutcome>(), this, std::move(request));
 }
 
 void WAFClient::CreateRuleAsync(const CreateRuleRequest& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::CreateRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::CreateRuleAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRuleOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::CreateRuleAsync(CreateRuleRequest&& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::CreateRuleAsyncHelper, Aws::Client::RejectedAsyncCall<CreateRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::CreateRuleAsyncHelper(const CreateRuleRequest& request, const CreateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -233,12 +263,22 @@ CreateSizeConstraintSetOutcome WAFClient::CreateSizeConstraintSet(const CreateSi
 
 CreateSizeConstraintSetOutcomeCallable WAFClient::CreateSizeConstraintSetCallable(const CreateSizeConstraintSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::CreateSizeConstraintSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::CreateSizeConstraintSet, Aws::Client::RejectedCallOutcome<CreateSizeConstraintSetOutcome>(), this, request);
+}
+
+CreateSizeConstraintSetOutcomeCallable WAFClient::CreateSizeConstraintSetCallable(CreateSizeConstraintSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::CreateSizeConstraintSet, Aws::Client::RejectedCallOutcome<CreateSizeConstraintSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::CreateSizeConstraintSetAsync(const CreateSizeConstraintSetRequest& request, const CreateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::CreateSizeConstraintSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::CreateSizeConstraintSetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSizeConstraintSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::CreateSizeConstraintSetAsync(CreateSizeConstraintSetRequest&& request, const CreateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::CreateSizeConstraintSetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSizeConstraintSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::CreateSizeConstraintSetAsyncHelper(const CreateSizeConstraintSetRequest& request, const CreateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -264,12 +304,22 @@ CreateSqlInjectionMatchSetOutcome WAFClient::CreateSqlInjectionMatchSet(const Cr
 
 CreateSqlInjectionMatchSetOutcomeCallable WAFClient::CreateSqlInjectionMatchSetCallable(const CreateSqlInjectionMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::CreateSqlInjectionMatchSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::CreateSqlInjectionMatchSet, Aws::Client::RejectedCallOutcome<CreateSqlInjectionMatchSetOutcome>(), this, request);
+}
+
+CreateSqlInjectionMatchSetOutcomeCallable WAFClient::CreateSqlInjectionMatchSetCallable(CreateSqlInjectionMatchSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::CreateSqlInjectionMatchSet, Aws::Client::RejectedCallOutcome<CreateSqlInjectionMatchSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::CreateSqlInjectionMatchSetAsync(const CreateSqlInjectionMatchSetRequest& request, const CreateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::CreateSqlInjectionMatchSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::CreateSqlInjectionMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSqlInjectionMatchSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::CreateSqlInjectionMatchSetAsync(CreateSqlInjectionMatchSetRequest&& request, const CreateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::CreateSqlInjectionMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<CreateSqlInjectionMatchSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::CreateSqlInjectionMatchSetAsyncHelper(const CreateSqlInjectionMatchSetRequest& request, const CreateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -295,12 +345,22 @@ CreateWebACLOutcome WAFClient::CreateWebACL(const CreateWebACLRequest& request)
 
 CreateWebACLOutcomeCallable WAFClient::CreateWebACLCallable(const CreateWebACLRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::CreateWebACL, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::CreateWebACL, Aws::Client::RejectedCallOutcome<CreateWebACLOutcome>(), this, request);
+}
+
+CreateWebACLOutcomeCallable WAFClient::CreateWebACLCallable(CreateWebACLRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::CreateWebACL, Aws::Client::RejectedCallOutcome<CreateWebACLOutcome>(), this, std::move(request));
 }
 
 void WAFClient::CreateWebACLAsync(const CreateWebACLRequest& request, const CreateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::CreateWebACLAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::CreateWebACLAsyncHelper, Aws::Client::RejectedAsyncCall<CreateWebACLOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::CreateWebACLAsync(CreateWebACLRequest&& request, const CreateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::CreateWebACLAsyncHelper, Aws::Client::RejectedAsyncCall<CreateWebACLOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::CreateWebACLAsyncHelper(const CreateWebACLRequest& request, const CreateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -326,12 +386,22 @@ DeleteByteMatchSetOutcome WAFClient::DeleteByteMatchSet(const DeleteByteMatchSet
 
 DeleteByteMatchSetOutcomeCallable WAFClient::DeleteByteMatchSetCallable(const DeleteByteMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::DeleteByteMatchSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::DeleteByteMatchSet, Aws::Client::RejectedCallOutcome<DeleteByteMatchSetOutcome>(), this, request);
+}
+
+DeleteByteMatchSetOutcomeCallable WAFClient::DeleteByteMatchSetCallable(DeleteByteMatchSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::DeleteByteMatchSet, Aws::Client::RejectedCallOutcome<DeleteByteMatchSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::DeleteByteMatchSetAsync(const DeleteByteMatchSetRequest& request, const DeleteByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::DeleteByteMatchSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::DeleteByteMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteByteMatchSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::DeleteByteMatchSetAsync(DeleteByteMatchSetRequest&& request, const DeleteByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::DeleteByteMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteByteMatchSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::DeleteByteMatchSetAsyncHelper(const DeleteByteMatchSetRequest& request, const DeleteByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -357,12 +427,22 @@ DeleteIPSetOutcome WAFClient::DeleteIPSet(const DeleteIPSetRequest& request) con
 
 DeleteIPSetOutcomeCallable WAFClient::DeleteIPSetCallable(const DeleteIPSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::DeleteIPSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::DeleteIPSet, Aws::Client::RejectedCallOutcome<DeleteIPSetOutcome>(), this, request);
+}
+
+DeleteIPSetOutcomeCallable WAFClient::DeleteIPSetCallable(DeleteIPSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::DeleteIPSet, Aws::Client::RejectedCallOutcome<DeleteIPSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::DeleteIPSetAsync(const DeleteIPSetRequest& request, const DeleteIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::DeleteIPSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::DeleteIPSetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIPSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::DeleteIPSetAsync(DeleteIPSetRequest&& request, const DeleteIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::DeleteIPSetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteIPSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::DeleteIPSetAsyncHelper(const DeleteIPSetRequest& request, const DeleteIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -388,12 +468,22 @@ DeleteRuleOutcome WAFClient::DeleteRule(const DeleteRuleRequest& request) const
 
 DeleteRuleOutcomeCallable WAFClient::DeleteRuleCallable(const DeleteRuleRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::DeleteRule, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::DeleteRule, Aws::Client::RejectedCallOutcome<DeleteRuleOutcome>(), this, request);
+}
+
+DeleteRuleOutcomeCallable WAFClient::DeleteRuleCallable(DeleteRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::DeleteRule, Aws::Client::RejectedCallOutcome<DeleteRuleOutcome>(), this, std::move(request));
 }
 
 void WAFClient::DeleteRuleAsync(const DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::DeleteRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::DeleteRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRuleOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::DeleteRuleAsync(DeleteRuleRequest&& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::DeleteRuleAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::DeleteRuleAsyncHelper(const DeleteRuleRequest& request, const DeleteRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -419,12 +509,22 @@ DeleteSizeConstraintSetOutcome WAFClient::DeleteSizeConstraintSet(const DeleteSi
 
 DeleteSizeConstraintSetOutcomeCallable WAFClient::DeleteSizeConstraintSetCallable(const DeleteSizeConstraintSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::DeleteSizeConstraintSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::DeleteSizeConstraintSet, Aws::Client::RejectedCallOutcome<DeleteSizeConstraintSetOutcome>(), this, request);
+}
+
+DeleteSizeConstraintSetOutcomeCallable WAFClient::DeleteSizeConstraintSetCallable(DeleteSizeConstraintSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::DeleteSizeConstraintSet, Aws::Client::RejectedCallOutcome<DeleteSizeConstraintSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::DeleteSizeConstraintSetAsync(const DeleteSizeConstraintSetRequest& request, const DeleteSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::DeleteSizeConstraintSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::DeleteSizeConstraintSetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSizeConstraintSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::DeleteSizeConstraintSetAsync(DeleteSizeConstraintSetRequest&& request, const DeleteSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::DeleteSizeConstraintSetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSizeConstraintSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::DeleteSizeConstraintSetAsyncHelper(const DeleteSizeConstraintSetRequest& request, const DeleteSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -450,12 +550,22 @@ DeleteSqlInjectionMatchSetOutcome WAFClient::DeleteSqlInjectionMatchSet(const De
 
 DeleteSqlInjectionMatchSetOutcomeCallable WAFClient::DeleteSqlInjectionMatchSetCallable(const DeleteSqlInjectionMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::DeleteSqlInjectionMatchSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::DeleteSqlInjectionMatchSet, Aws::Client::RejectedCallOutcome<DeleteSqlInjectionMatchSetOutcome>(), this, request);
+}
+
+DeleteSqlInjectionMatchSetOutcomeCallable WAFClient::DeleteSqlInjectionMatchSetCallable(DeleteSqlInjectionMatchSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::DeleteSqlInjectionMatchSet, Aws::Client::RejectedCallOutcome<DeleteSqlInjectionMatchSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::DeleteSqlInjectionMatchSetAsync(const DeleteSqlInjectionMatchSetRequest& request, const DeleteSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::DeleteSqlInjectionMatchSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::DeleteSqlInjectionMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSqlInjectionMatchSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::DeleteSqlInjectionMatchSetAsync(DeleteSqlInjectionMatchSetRequest&& request, const DeleteSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::DeleteSqlInjectionMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteSqlInjectionMatchSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::DeleteSqlInjectionMatchSetAsyncHelper(const DeleteSqlInjectionMatchSetRequest& request, const DeleteSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -481,12 +591,22 @@ DeleteWebACLOutcome WAFClient::DeleteWebACL(const DeleteWebACLRequest& request)
 
 DeleteWebACLOutcomeCallable WAFClient::DeleteWebACLCallable(const DeleteWebACLRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::DeleteWebACL, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::DeleteWebACL, Aws::Client::RejectedCallOutcome<DeleteWebACLOutcome>(), this, request);
+}
+
+DeleteWebACLOutcomeCallable WAFClient::DeleteWebACLCallable(DeleteWebACLRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::DeleteWebACL, Aws::Client::RejectedCallOutcome<DeleteWebACLOutcome>(), this, std::move(request));
 }
 
 void WAFClient::DeleteWebACLAsync(const DeleteWebACLRequest& request, const DeleteWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::DeleteWebACLAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::DeleteWebACLAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteWebACLOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::DeleteWebACLAsync(DeleteWebACLRequest&& request, const DeleteWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::DeleteWebACLAsyncHelper, Aws::Client::RejectedAsyncCall<DeleteWebACLOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::DeleteWebACLAsyncHelper(const DeleteWebACLRequest& request, const DeleteWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -512,12 +632,22 @@ GetByteMatchSetOutcome WAFClient::GetByteMatchSet(const GetByteMatchSetRequest&
 
 GetByteMatchSetOutcomeCallable WAFClient::GetByteMatchSetCallable(const GetByteMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::GetByteMatchSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::GetByteMatchSet, Aws::Client::RejectedCallOutcome<GetByteMatchSetOutcome>(), this, request);
+}
+
+GetByteMatchSetOutcomeCallable WAFClient::GetByteMatchSetCallable(GetByteMatchSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::GetByteMatchSet, Aws::Client::RejectedCallOutcome<GetByteMatchSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::GetByteMatchSetAsync(const GetByteMatchSetRequest& request, const GetByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::GetByteMatchSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::GetByteMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<GetByteMatchSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::GetByteMatchSetAsync(GetByteMatchSetRequest&& request, const GetByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::GetByteMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<GetByteMatchSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::GetByteMatchSetAsyncHelper(const GetByteMatchSetRequest& request, const GetByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -543,12 +673,22 @@ GetChangeTokenOutcome WAFClient::GetChangeToken(const GetChangeTokenRequest& req
 
 GetChangeTokenOutcomeCallable WAFClient::GetChangeTokenCallable(const GetChangeTokenRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::GetChangeToken, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::GetChangeToken, Aws::Client::RejectedCallOutcome<GetChangeTokenOutcome>(), this, request);
+}
+
+GetChangeTokenOutcomeCallable WAFClient::GetChangeTokenCallable(GetChangeTokenRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::GetChangeToken, Aws::Client::RejectedCallOutcome<GetChangeTokenOutcome>(), this, std::move(request));
 }
 
 void WAFClient::GetChangeTokenAsync(const GetChangeTokenRequest& request, const GetChangeTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::GetChangeTokenAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::GetChangeTokenAsyncHelper, Aws::Client::RejectedAsyncCall<GetChangeTokenOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::GetChangeTokenAsync(GetChangeTokenRequest&& request, const GetChangeTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::GetChangeTokenAsyncHelper, Aws::Client::RejectedAsyncCall<GetChangeTokenOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::GetChangeTokenAsyncHelper(const GetChangeTokenRequest& request, const GetChangeTokenResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -574,12 +714,22 @@ GetChangeTokenStatusOutcome WAFClient::GetChangeTokenStatus(const GetChangeToken
 
 GetChangeTokenStatusOutcomeCallable WAFClient::GetChangeTokenStatusCallable(const GetChangeTokenStatusRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::GetChangeTokenStatus, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::GetChangeTokenStatus, Aws::Client::RejectedCallOutcome<GetChangeTokenStatusOutcome>(), this, request);
+}
+
+GetChangeTokenStatusOutcomeCallable WAFClient::GetChangeTokenStatusCallable(GetChangeTokenStatusRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::GetChangeTokenStatus, Aws::Client::RejectedCallOutcome<GetChangeTokenStatusOutcome>(), this, std::move(request));
 }
 
 void WAFClient::GetChangeTokenStatusAsync(const GetChangeTokenStatusRequest& request, const GetChangeTokenStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::GetChangeTokenStatusAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::GetChangeTokenStatusAsyncHelper, Aws::Client::RejectedAsyncCall<GetChangeTokenStatusOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::GetChangeTokenStatusAsync(GetChangeTokenStatusRequest&& request, const GetChangeTokenStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::GetChangeTokenStatusAsyncHelper, Aws::Client::RejectedAsyncCall<GetChangeTokenStatusOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::GetChangeTokenStatusAsyncHelper(const GetChangeTokenStatusRequest& request, const GetChangeTokenStatusResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -605,12 +755,22 @@ GetIPSetOutcome WAFClient::GetIPSet(const GetIPSetRequest& request) const
 
 GetIPSetOutcomeCallable WAFClient::GetIPSetCallable(const GetIPSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::GetIPSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::GetIPSet, Aws::Client::RejectedCallOutcome<GetIPSetOutcome>(), this, request);
+}
+
+GetIPSetOutcomeCallable WAFClient::GetIPSetCallable(GetIPSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::GetIPSet, Aws::Client::RejectedCallOutcome<GetIPSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::GetIPSetAsync(const GetIPSetRequest& request, const GetIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::GetIPSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::GetIPSetAsyncHelper, Aws::Client::RejectedAsyncCall<GetIPSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::GetIPSetAsync(GetIPSetRequest&& request, const GetIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::GetIPSetAsyncHelper, Aws::Client::RejectedAsyncCall<GetIPSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::GetIPSetAsyncHelper(const GetIPSetRequest& request, const GetIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -636,12 +796,22 @@ GetRuleOutcome WAFClient::GetRule(const GetRuleRequest& request) const
 
 GetRuleOutcomeCallable WAFClient::GetRuleCallable(const GetRuleRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::GetRule, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::GetRule, Aws::Client::RejectedCallOutcome<GetRuleOutcome>(), this, request);
+}
+
+GetRuleOutcomeCallable WAFClient::GetRuleCallable(GetRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::GetRule, Aws::Client::RejectedCallOutcome<GetRuleOutcome>(), this, std::move(request));
 }
 
 void WAFClient::GetRuleAsync(const GetRuleRequest& request, const GetRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::GetRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::GetRuleAsyncHelper, Aws::Client::RejectedAsyncCall<GetRuleOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::GetRuleAsync(GetRuleRequest&& request, const GetRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::GetRuleAsyncHelper, Aws::Client::RejectedAsyncCall<GetRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::GetRuleAsyncHelper(const GetRuleRequest& request, const GetRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -667,12 +837,22 @@ GetSampledRequestsOutcome WAFClient::GetSampledRequests(const GetSampledRequests
 
 GetSampledRequestsOutcomeCallable WAFClient::GetSampledRequestsCallable(const GetSampledRequestsRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::GetSampledRequests, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::GetSampledRequests, Aws::Client::RejectedCallOutcome<GetSampledRequestsOutcome>(), this, request);
+}
+
+GetSampledRequestsOutcomeCallable WAFClient::GetSampledRequestsCallable(GetSampledRequestsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::GetSampledRequests, Aws::Client::RejectedCallOutcome<GetSampledRequestsOutcome>(), this, std::move(request));
 }
 
 void WAFClient::GetSampledRequestsAsync(const GetSampledRequestsRequest& request, const GetSampledRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::GetSampledRequestsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::GetSampledRequestsAsyncHelper, Aws::Client::RejectedAsyncCall<GetSampledRequestsOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::GetSampledRequestsAsync(GetSampledRequestsRequest&& request, const GetSampledRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::GetSampledRequestsAsyncHelper, Aws::Client::RejectedAsyncCall<GetSampledRequestsOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::GetSampledRequestsAsyncHelper(const GetSampledRequestsRequest& request, const GetSampledRequestsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -698,12 +878,22 @@ GetSizeConstraintSetOutcome WAFClient::GetSizeConstraintSet(const GetSizeConstra
 
 GetSizeConstraintSetOutcomeCallable WAFClient::GetSizeConstraintSetCallable(const GetSizeConstraintSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::GetSizeConstraintSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::GetSizeConstraintSet, Aws::Client::RejectedCallOutcome<GetSizeConstraintSetOutcome>(), this, request);
+}
+
+GetSizeConstraintSetOutcomeCallable WAFClient::GetSizeConstraintSetCallable(GetSizeConstraintSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::GetSizeConstraintSet, Aws::Client::RejectedCallOutcome<GetSizeConstraintSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::GetSizeConstraintSetAsync(const GetSizeConstraintSetRequest& request, const GetSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::GetSizeConstraintSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::GetSizeConstraintSetAsyncHelper, Aws::Client::RejectedAsyncCall<GetSizeConstraintSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::GetSizeConstraintSetAsync(GetSizeConstraintSetRequest&& request, const GetSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::GetSizeConstraintSetAsyncHelper, Aws::Client::RejectedAsyncCall<GetSizeConstraintSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::GetSizeConstraintSetAsyncHelper(const GetSizeConstraintSetRequest& request, const GetSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -729,12 +919,22 @@ GetSqlInjectionMatchSetOutcome WAFClient::GetSqlInjectionMatchSet(const GetSqlIn
 
 GetSqlInjectionMatchSetOutcomeCallable WAFClient::GetSqlInjectionMatchSetCallable(const GetSqlInjectionMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::GetSqlInjectionMatchSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::GetSqlInjectionMatchSet, Aws::Client::RejectedCallOutcome<GetSqlInjectionMatchSetOutcome>(), this, request);
+}
+
+GetSqlInjectionMatchSetOutcomeCallable WAFClient::GetSqlInjectionMatchSetCallable(GetSqlInjectionMatchSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::GetSqlInjectionMatchSet, Aws::Client::RejectedCallOutcome<GetSqlInjectionMatchSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::GetSqlInjectionMatchSetAsync(const GetSqlInjectionMatchSetRequest& request, const GetSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::GetSqlInjectionMatchSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::GetSqlInjectionMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<GetSqlInjectionMatchSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::GetSqlInjectionMatchSetAsync(GetSqlInjectionMatchSetRequest&& request, const GetSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::GetSqlInjectionMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<GetSqlInjectionMatchSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::GetSqlInjectionMatchSetAsyncHelper(const GetSqlInjectionMatchSetRequest& request, const GetSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -760,12 +960,22 @@ GetWebACLOutcome WAFClient::GetWebACL(const GetWebACLRequest& request) const
 
 GetWebACLOutcomeCallable WAFClient::GetWebACLCallable(const GetWebACLRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::GetWebACL, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::GetWebACL, Aws::Client::RejectedCallOutcome<GetWebACLOutcome>(), this, request);
+}
+
+GetWebACLOutcomeCallable WAFClient::GetWebACLCallable(GetWebACLRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::GetWebACL, Aws::Client::RejectedCallOutcome<GetWebACLOutcome>(), this, std::move(request));
 }
 
 void WAFClient::GetWebACLAsync(const GetWebACLRequest& request, const GetWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::GetWebACLAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::GetWebACLAsyncHelper, Aws::Client::RejectedAsyncCall<GetWebACLOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::GetWebACLAsync(GetWebACLRequest&& request, const GetWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::GetWebACLAsyncHelper, Aws::Client::RejectedAsyncCall<GetWebACLOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::GetWebACLAsyncHelper(const GetWebACLRequest& request, const GetWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -791,12 +1001,22 @@ ListByteMatchSetsOutcome WAFClient::ListByteMatchSets(const ListByteMatchSetsReq
 
 ListByteMatchSetsOutcomeCallable WAFClient::ListByteMatchSetsCallable(const ListByteMatchSetsRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::ListByteMatchSets, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::ListByteMatchSets, Aws::Client::RejectedCallOutcome<ListByteMatchSetsOutcome>(), this, request);
+}
+
+ListByteMatchSetsOutcomeCallable WAFClient::ListByteMatchSetsCallable(ListByteMatchSetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::ListByteMatchSets, Aws::Client::RejectedCallOutcome<ListByteMatchSetsOutcome>(), this, std::move(request));
 }
 
 void WAFClient::ListByteMatchSetsAsync(const ListByteMatchSetsRequest& request, const ListByteMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::ListByteMatchSetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::ListByteMatchSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListByteMatchSetsOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::ListByteMatchSetsAsync(ListByteMatchSetsRequest&& request, const ListByteMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::ListByteMatchSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListByteMatchSetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::ListByteMatchSetsAsyncHelper(const ListByteMatchSetsRequest& request, const ListByteMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -822,12 +1042,22 @@ ListIPSetsOutcome WAFClient::ListIPSets(const ListIPSetsRequest& request) const
 
 ListIPSetsOutcomeCallable WAFClient::ListIPSetsCallable(const ListIPSetsRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::ListIPSets, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::ListIPSets, Aws::Client::RejectedCallOutcome<ListIPSetsOutcome>(), this, request);
+}
+
+ListIPSetsOutcomeCallable WAFClient::ListIPSetsCallable(ListIPSetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::ListIPSets, Aws::Client::RejectedCallOutcome<ListIPSetsOutcome>(), this, std::move(request));
 }
 
 void WAFClient::ListIPSetsAsync(const ListIPSetsRequest& request, const ListIPSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::ListIPSetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::ListIPSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListIPSetsOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::ListIPSetsAsync(ListIPSetsRequest&& request, const ListIPSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::ListIPSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListIPSetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::ListIPSetsAsyncHelper(const ListIPSetsRequest& request, const ListIPSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -853,12 +1083,22 @@ ListRulesOutcome WAFClient::ListRules(const ListRulesRequest& request) const
 
 ListRulesOutcomeCallable WAFClient::ListRulesCallable(const ListRulesRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::ListRules, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::ListRules, Aws::Client::RejectedCallOutcome<ListRulesOutcome>(), this, request);
+}
+
+ListRulesOutcomeCallable WAFClient::ListRulesCallable(ListRulesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::ListRules, Aws::Client::RejectedCallOutcome<ListRulesOutcome>(), this, std::move(request));
 }
 
 void WAFClient::ListRulesAsync(const ListRulesRequest& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::ListRulesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::ListRulesAsyncHelper, Aws::Client::RejectedAsyncCall<ListRulesOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::ListRulesAsync(ListRulesRequest&& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::ListRulesAsyncHelper, Aws::Client::RejectedAsyncCall<ListRulesOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::ListRulesAsyncHelper(const ListRulesRequest& request, const ListRulesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -884,12 +1124,22 @@ ListSizeConstraintSetsOutcome WAFClient::ListSizeConstraintSets(const ListSizeCo
 
 ListSizeConstraintSetsOutcomeCallable WAFClient::ListSizeConstraintSetsCallable(const ListSizeConstraintSetsRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::ListSizeConstraintSets, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::ListSizeConstraintSets, Aws::Client::RejectedCallOutcome<ListSizeConstraintSetsOutcome>(), this, request);
+}
+
+ListSizeConstraintSetsOutcomeCallable WAFClient::ListSizeConstraintSetsCallable(ListSizeConstraintSetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::ListSizeConstraintSets, Aws::Client::RejectedCallOutcome<ListSizeConstraintSetsOutcome>(), this, std::move(request));
 }
 
 void WAFClient::ListSizeConstraintSetsAsync(const ListSizeConstraintSetsRequest& request, const ListSizeConstraintSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::ListSizeConstraintSetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::ListSizeConstraintSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListSizeConstraintSetsOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::ListSizeConstraintSetsAsync(ListSizeConstraintSetsRequest&& request, const ListSizeConstraintSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::ListSizeConstraintSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListSizeConstraintSetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::ListSizeConstraintSetsAsyncHelper(const ListSizeConstraintSetsRequest& request, const ListSizeConstraintSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -915,12 +1165,22 @@ ListSqlInjectionMatchSetsOutcome WAFClient::ListSqlInjectionMatchSets(const List
 
 ListSqlInjectionMatchSetsOutcomeCallable WAFClient::ListSqlInjectionMatchSetsCallable(const ListSqlInjectionMatchSetsRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::ListSqlInjectionMatchSets, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::ListSqlInjectionMatchSets, Aws::Client::RejectedCallOutcome<ListSqlInjectionMatchSetsOutcome>(), this, request);
+}
+
+ListSqlInjectionMatchSetsOutcomeCallable WAFClient::ListSqlInjectionMatchSetsCallable(ListSqlInjectionMatchSetsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::ListSqlInjectionMatchSets, Aws::Client::RejectedCallOutcome<ListSqlInjectionMatchSetsOutcome>(), this, std::move(request));
 }
 
 void WAFClient::ListSqlInjectionMatchSetsAsync(const ListSqlInjectionMatchSetsRequest& request, const ListSqlInjectionMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::ListSqlInjectionMatchSetsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::ListSqlInjectionMatchSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListSqlInjectionMatchSetsOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::ListSqlInjectionMatchSetsAsync(ListSqlInjectionMatchSetsRequest&& request, const ListSqlInjectionMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::ListSqlInjectionMatchSetsAsyncHelper, Aws::Client::RejectedAsyncCall<ListSqlInjectionMatchSetsOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::ListSqlInjectionMatchSetsAsyncHelper(const ListSqlInjectionMatchSetsRequest& request, const ListSqlInjectionMatchSetsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -946,12 +1206,22 @@ ListWebACLsOutcome WAFClient::ListWebACLs(const ListWebACLsRequest& request) con
 
 ListWebACLsOutcomeCallable WAFClient::ListWebACLsCallable(const ListWebACLsRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::ListWebACLs, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::ListWebACLs, Aws::Client::RejectedCallOutcome<ListWebACLsOutcome>(), this, request);
+}
+
+ListWebACLsOutcomeCallable WAFClient::ListWebACLsCallable(ListWebACLsRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::ListWebACLs, Aws::Client::RejectedCallOutcome<ListWebACLsOutcome>(), this, std::move(request));
 }
 
 void WAFClient::ListWebACLsAsync(const ListWebACLsRequest& request, const ListWebACLsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::ListWebACLsAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::ListWebACLsAsyncHelper, Aws::Client::RejectedAsyncCall<ListWebACLsOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::ListWebACLsAsync(ListWebACLsRequest&& request, const ListWebACLsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::ListWebACLsAsyncHelper, Aws::Client::RejectedAsyncCall<ListWebACLsOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::ListWebACLsAsyncHelper(const ListWebACLsRequest& request, const ListWebACLsResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -977,12 +1247,22 @@ UpdateByteMatchSetOutcome WAFClient::UpdateByteMatchSet(const UpdateByteMatchSet
 
 UpdateByteMatchSetOutcomeCallable WAFClient::UpdateByteMatchSetCallable(const UpdateByteMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::UpdateByteMatchSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::UpdateByteMatchSet, Aws::Client::RejectedCallOutcome<UpdateByteMatchSetOutcome>(), this, request);
+}
+
+UpdateByteMatchSetOutcomeCallable WAFClient::UpdateByteMatchSetCallable(UpdateByteMatchSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::UpdateByteMatchSet, Aws::Client::RejectedCallOutcome<UpdateByteMatchSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::UpdateByteMatchSetAsync(const UpdateByteMatchSetRequest& request, const UpdateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::UpdateByteMatchSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::UpdateByteMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateByteMatchSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::UpdateByteMatchSetAsync(UpdateByteMatchSetRequest&& request, const UpdateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::UpdateByteMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateByteMatchSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::UpdateByteMatchSetAsyncHelper(const UpdateByteMatchSetRequest& request, const UpdateByteMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1008,12 +1288,22 @@ UpdateIPSetOutcome WAFClient::UpdateIPSet(const UpdateIPSetRequest& request) con
 
 UpdateIPSetOutcomeCallable WAFClient::UpdateIPSetCallable(const UpdateIPSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::UpdateIPSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::UpdateIPSet, Aws::Client::RejectedCallOutcome<UpdateIPSetOutcome>(), this, request);
+}
+
+UpdateIPSetOutcomeCallable WAFClient::UpdateIPSetCallable(UpdateIPSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::UpdateIPSet, Aws::Client::RejectedCallOutcome<UpdateIPSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::UpdateIPSetAsync(const UpdateIPSetRequest& request, const UpdateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::UpdateIPSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::UpdateIPSetAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateIPSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::UpdateIPSetAsync(UpdateIPSetRequest&& request, const UpdateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::UpdateIPSetAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateIPSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::UpdateIPSetAsyncHelper(const UpdateIPSetRequest& request, const UpdateIPSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1039,12 +1329,22 @@ UpdateRuleOutcome WAFClient::UpdateRule(const UpdateRuleRequest& request) const
 
 UpdateRuleOutcomeCallable WAFClient::UpdateRuleCallable(const UpdateRuleRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::UpdateRule, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::UpdateRule, Aws::Client::RejectedCallOutcome<UpdateRuleOutcome>(), this, request);
+}
+
+UpdateRuleOutcomeCallable WAFClient::UpdateRuleCallable(UpdateRuleRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::UpdateRule, Aws::Client::RejectedCallOutcome<UpdateRuleOutcome>(), this, std::move(request));
 }
 
 void WAFClient::UpdateRuleAsync(const UpdateRuleRequest& request, const UpdateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::UpdateRuleAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::UpdateRuleAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateRuleOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::UpdateRuleAsync(UpdateRuleRequest&& request, const UpdateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::UpdateRuleAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateRuleOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::UpdateRuleAsyncHelper(const UpdateRuleRequest& request, const UpdateRuleResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1070,12 +1370,22 @@ UpdateSizeConstraintSetOutcome WAFClient::UpdateSizeConstraintSet(const UpdateSi
 
 UpdateSizeConstraintSetOutcomeCallable WAFClient::UpdateSizeConstraintSetCallable(const UpdateSizeConstraintSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::UpdateSizeConstraintSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::UpdateSizeConstraintSet, Aws::Client::RejectedCallOutcome<UpdateSizeConstraintSetOutcome>(), this, request);
+}
+
+UpdateSizeConstraintSetOutcomeCallable WAFClient::UpdateSizeConstraintSetCallable(UpdateSizeConstraintSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::UpdateSizeConstraintSet, Aws::Client::RejectedCallOutcome<UpdateSizeConstraintSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::UpdateSizeConstraintSetAsync(const UpdateSizeConstraintSetRequest& request, const UpdateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::UpdateSizeConstraintSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::UpdateSizeConstraintSetAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateSizeConstraintSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::UpdateSizeConstraintSetAsync(UpdateSizeConstraintSetRequest&& request, const UpdateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::UpdateSizeConstraintSetAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateSizeConstraintSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::UpdateSizeConstraintSetAsyncHelper(const UpdateSizeConstraintSetRequest& request, const UpdateSizeConstraintSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1101,12 +1411,22 @@ UpdateSqlInjectionMatchSetOutcome WAFClient::UpdateSqlInjectionMatchSet(const Up
 
 UpdateSqlInjectionMatchSetOutcomeCallable WAFClient::UpdateSqlInjectionMatchSetCallable(const UpdateSqlInjectionMatchSetRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::UpdateSqlInjectionMatchSet, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::UpdateSqlInjectionMatchSet, Aws::Client::RejectedCallOutcome<UpdateSqlInjectionMatchSetOutcome>(), this, request);
+}
+
+UpdateSqlInjectionMatchSetOutcomeCallable WAFClient::UpdateSqlInjectionMatchSetCallable(UpdateSqlInjectionMatchSetRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::UpdateSqlInjectionMatchSet, Aws::Client::RejectedCallOutcome<UpdateSqlInjectionMatchSetOutcome>(), this, std::move(request));
 }
 
 void WAFClient::UpdateSqlInjectionMatchSetAsync(const UpdateSqlInjectionMatchSetRequest& request, const UpdateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::UpdateSqlInjectionMatchSetAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::UpdateSqlInjectionMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateSqlInjectionMatchSetOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::UpdateSqlInjectionMatchSetAsync(UpdateSqlInjectionMatchSetRequest&& request, const UpdateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::UpdateSqlInjectionMatchSetAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateSqlInjectionMatchSetOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::UpdateSqlInjectionMatchSetAsyncHelper(const UpdateSqlInjectionMatchSetRequest& request, const UpdateSqlInjectionMatchSetResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -1132,12 +1452,22 @@ UpdateWebACLOutcome WAFClient::UpdateWebACL(const UpdateWebACLRequest& request)
 
 UpdateWebACLOutcomeCallable WAFClient::UpdateWebACLCallable(const UpdateWebACLRequest& request) const
 {
-  return std::async(std::launch::async, &WAFClient::UpdateWebACL, this, request);
+  return m_executor->SubmitWithFuture(&WAFClient::UpdateWebACL, Aws::Client::RejectedCallOutcome<UpdateWebACLOutcome>(), this, request);
+}
+
+UpdateWebACLOutcomeCallable WAFClient::UpdateWebACLCallable(UpdateWebACLRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WAFClient::UpdateWebACL, Aws::Client::RejectedCallOutcome<UpdateWebACLOutcome>(), this, std::move(request));
 }
 
 void WAFClient::UpdateWebACLAsync(const UpdateWebACLRequest& request, const UpdateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WAFClient::UpdateWebACLAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WAFClient::UpdateWebACLAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateWebACLOutcome>(), this, request, handler, context);
+}
+
+void WAFClient::UpdateWebACLAsync(UpdateWebACLRequest&& request, const UpdateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WAFClient::UpdateWebACLAsyncHelper, Aws::Client::RejectedAsyncCall<UpdateWebACLOutcome>(), this, std::move(request), handler, context);
 }
 
 void WAFClient::UpdateWebACLAsyncHelper(const UpdateWebACLRequest& request, const UpdateWebACLResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -29,6 +29,17 @@
 #include <aws/workspaces/model/TerminateWorkspacesResult.h>
 #include <aws/core/client/AsyncCallerContext.h>
 #include <aws/core/http/HttpTypes.h>
+#include <aws/core/utils/threading/Coroutines.h>
+#ifdef AWS_CORE_COROUTINES
+#include <aws/core/utils/Outcome.h>
+#include <aws/workspaces/model/CreateWorkspacesRequest.h>
+#include <aws/workspaces/model/DescribeWorkspaceBundlesRequest.h>
+#include <aws/workspaces/model/DescribeWorkspaceDirectoriesRequest.h>
+#include <aws/workspaces/model/DescribeWorkspacesRequest.h>
+#include <aws/workspaces/model/RebootWorkspacesRequest.h>
+#include <aws/workspaces/model/RebuildWorkspacesRequest.h>
+#include <aws/workspaces/model/TerminateWorkspacesRequest.h>
+#endif
 #include <future>
 #include <functional>
 
@@ -153,6 +164,11 @@ namespace Model
          */
         virtual Model::CreateWorkspacesOutcomeCallable CreateWorkspacesCallable(const Model::CreateWorkspacesRequest& request) const;
 
+        /**
+         * Same as CreateWorkspacesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::CreateWorkspacesOutcomeCallable CreateWorkspacesCallable(Model::CreateWorkspacesRequest&& request) const;
+
         /**
          * <p>Creates one or more WorkSpaces.</p> <note> <p>This operation is asynchronous
          * and returns before the WorkSpaces are created.</p> </note>
@@ -161,6 +177,11 @@ namespace Model
          */
         virtual void CreateWorkspacesAsync(const Model::CreateWorkspacesRequest& request, const CreateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as CreateWorkspacesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void CreateWorkspacesAsync(Model::CreateWorkspacesRequest&& request, const CreateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains information about the WorkSpace bundles that are available to your
          * account in the specified region.</p> <p>You can filter the results with either
@@ -185,6 +206,11 @@ namespace Model
          */
         virtual Model::DescribeWorkspaceBundlesOutcomeCallable DescribeWorkspaceBundlesCallable(const Model::DescribeWorkspaceBundlesRequest& request) const;
 
+        /**
+         * Same as DescribeWorkspaceBundlesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeWorkspaceBundlesOutcomeCallable DescribeWorkspaceBundlesCallable(Model::DescribeWorkspaceBundlesRequest&& request) const;
+
         /**
          * <p>Obtains information about the WorkSpace bundles that are available to your
          * account in the specified region.</p> <p>You can filter the results with either
@@ -198,6 +224,11 @@ namespace Model
          */
         virtual void DescribeWorkspaceBundlesAsync(const Model::DescribeWorkspaceBundlesRequest& request, const DescribeWorkspaceBundlesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeWorkspaceBundlesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeWorkspaceBundlesAsync(Model::DescribeWorkspaceBundlesRequest&& request, const DescribeWorkspaceBundlesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Retrieves information about the AWS Directory Service directories in the
          * region that are registered with Amazon WorkSpaces and are available to your
@@ -220,6 +251,11 @@ namespace Model
          */
         virtual Model::DescribeWorkspaceDirectoriesOutcomeCallable DescribeWorkspaceDirectoriesCallable(const Model::DescribeWorkspaceDirectoriesRequest& request) const;
 
+        /**
+         * Same as DescribeWorkspaceDirectoriesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeWorkspaceDirectoriesOutcomeCallable DescribeWorkspaceDirectoriesCallable(Model::DescribeWorkspaceDirectoriesRequest&& request) const;
+
         /**
          * <p>Retrieves information about the AWS Directory Service directories in the
          * region that are registered with Amazon WorkSpaces and are available to your
@@ -232,6 +268,11 @@ namespace Model
          */
         virtual void DescribeWorkspaceDirectoriesAsync(const Model::DescribeWorkspaceDirectoriesRequest& request, const DescribeWorkspaceDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeWorkspaceDirectoriesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeWorkspaceDirectoriesAsync(Model::DescribeWorkspaceDirectoriesRequest&& request, const DescribeWorkspaceDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Obtains information about the specified WorkSpaces. </p> <p>Only one of the
          * filter parameters, such as <code>BundleId</code>, <code>DirectoryId</code>, or
@@ -256,6 +297,11 @@ namespace Model
          */
         virtual Model::DescribeWorkspacesOutcomeCallable DescribeWorkspacesCallable(const Model::DescribeWorkspacesRequest& request) const;
 
+        /**
+         * Same as DescribeWorkspacesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::DescribeWorkspacesOutcomeCallable DescribeWorkspacesCallable(Model::DescribeWorkspacesRequest&& request) const;
+
         /**
          * <p>Obtains information about the specified WorkSpaces. </p> <p>Only one of the
          * filter parameters, such as <code>BundleId</code>, <code>DirectoryId</code>, or
@@ -269,6 +315,11 @@ namespace Model
          */
         virtual void DescribeWorkspacesAsync(const Model::DescribeWorkspacesRequest& request, const DescribeWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as DescribeWorkspacesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void DescribeWorkspacesAsync(Model::DescribeWorkspacesRequest&& request, const DescribeWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Reboots the specified WorkSpaces.</p> <p>To be able to reboot a WorkSpace,
          * the WorkSpace must have a <b>State</b> of <code>AVAILABLE</code>,
@@ -287,6 +338,11 @@ namespace Model
          */
         virtual Model::RebootWorkspacesOutcomeCallable RebootWorkspacesCallable(const Model::RebootWorkspacesRequest& request) const;
 
+        /**
+         * Same as RebootWorkspacesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RebootWorkspacesOutcomeCallable RebootWorkspacesCallable(Model::RebootWorkspacesRequest&& request) const;
+
         /**
          * <p>Reboots the specified WorkSpaces.</p> <p>To be able to reboot a WorkSpace,
          * the WorkSpace must have a <b>State</b> of <code>AVAILABLE</code>,
@@ -297,6 +353,11 @@ namespace Model
          */
         virtual void RebootWorkspacesAsync(const Model::RebootWorkspacesRequest& request, const RebootWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebootWorkspacesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RebootWorkspacesAsync(Model::RebootWorkspacesRequest&& request, const RebootWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Rebuilds the specified WorkSpaces.</p> <p>Rebuilding a WorkSpace is a
          * potentially destructive action that can result in the loss of data. Rebuilding a
@@ -333,6 +394,11 @@ namespace Model
          */
         virtual Model::RebuildWorkspacesOutcomeCallable RebuildWorkspacesCallable(const Model::RebuildWorkspacesRequest& request) const;
 
+        /**
+         * Same as RebuildWorkspacesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::RebuildWorkspacesOutcomeCallable RebuildWorkspacesCallable(Model::RebuildWorkspacesRequest&& request) const;
+
         /**
          * <p>Rebuilds the specified WorkSpaces.</p> <p>Rebuilding a WorkSpace is a
          * potentially destructive action that can result in the loss of data. Rebuilding a
@@ -352,6 +418,11 @@ namespace Model
          */
         virtual void RebuildWorkspacesAsync(const Model::RebuildWorkspacesRequest& request, const RebuildWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as RebuildWorkspacesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void RebuildWorkspacesAsync(Model::RebuildWorkspacesRequest&& request, const RebuildWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
         /**
          * <p>Terminates the specified WorkSpaces.</p> <p>Terminating a WorkSpace is a
          * permanent action and cannot be undone. The user's data is not maintained and
@@ -376,6 +447,11 @@ namespace Model
          */
         virtual Model::TerminateWorkspacesOutcomeCallable TerminateWorkspacesCallable(const Model::TerminateWorkspacesRequest& request) const;
 
+        /**
+         * Same as TerminateWorkspacesCallable, but moves the request into the queued task instead of copying it.
+         */
+        virtual Model::TerminateWorkspacesOutcomeCallable TerminateWorkspacesCallable(Model::TerminateWorkspacesRequest&& request) const;
+
         /**
          * <p>Terminates the specified WorkSpaces.</p> <p>Terminating a WorkSpace is a
          * permanent action and cannot be undone. The user's data is not maintained and
@@ -389,6 +465,32 @@ namespace Model
          */
         virtual void TerminateWorkspacesAsync(const Model::TerminateWorkspacesRequest& request, const TerminateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
 
+        /**
+         * Same as TerminateWorkspacesAsync, but moves the request into the queued task instead of copying it.
+         */
+        virtual void TerminateWorkspacesAsync(Model::TerminateWorkspacesRequest&& request, const TerminateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context = nullptr) const;
+
+#ifdef AWS_CORE_COROUTINES
+        /**
+         * Awaitable forms of the operations above, available when the including code is built with C++20 coroutines.
+         * Each one starts the operation on the client's executor right away; co_await it for the outcome, and call
+         * ResumeOn() on it to pick the executor the awaiting coroutine is resumed on.
+         */
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateWorkspacesOutcome> CreateWorkspacesAwaitable(const Model::CreateWorkspacesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WorkSpacesClient::CreateWorkspaces, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::CreateWorkspacesOutcome> CreateWorkspacesAwaitable(Model::CreateWorkspacesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WorkSpacesClient::CreateWorkspaces, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeWorkspaceBundlesOutcome> DescribeWorkspaceBundlesAwaitable(const Model::DescribeWorkspaceBundlesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WorkSpacesClient::DescribeWorkspaceBundles, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeWorkspaceBundlesOutcome> DescribeWorkspaceBundlesAwaitable(Model::DescribeWorkspaceBundlesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WorkSpacesClient::DescribeWorkspaceBundles, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeWorkspaceDirectoriesOutcome> DescribeWorkspaceDirectoriesAwaitable(const Model::DescribeWorkspaceDirectoriesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WorkSpacesClient::DescribeWorkspaceDirectories, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeWorkspaceDirectoriesOutcome> DescribeWorkspaceDirectoriesAwaitable(Model::DescribeWorkspaceDirectoriesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WorkSpacesClient::DescribeWorkspaceDirectories, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeWorkspacesOutcome> DescribeWorkspacesAwaitable(const Model::DescribeWorkspacesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WorkSpacesClient::DescribeWorkspaces, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::DescribeWorkspacesOutcome> DescribeWorkspacesAwaitable(Model::DescribeWorkspacesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WorkSpacesClient::DescribeWorkspaces, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebootWorkspacesOutcome> RebootWorkspacesAwaitable(const Model::RebootWorkspacesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WorkSpacesClient::RebootWorkspaces, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebootWorkspacesOutcome> RebootWorkspacesAwaitable(Model::RebootWorkspacesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WorkSpacesClient::RebootWorkspaces, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebuildWorkspacesOutcome> RebuildWorkspacesAwaitable(const Model::RebuildWorkspacesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WorkSpacesClient::RebuildWorkspaces, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::RebuildWorkspacesOutcome> RebuildWorkspacesAwaitable(Model::RebuildWorkspacesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WorkSpacesClient::RebuildWorkspaces, this, std::move(request)); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TerminateWorkspacesOutcome> TerminateWorkspacesAwaitable(const Model::TerminateWorkspacesRequest& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WorkSpacesClient::TerminateWorkspaces, this, request); }
+        Aws::Utils::Threading::OperationAwaitable<Model::TerminateWorkspacesOutcome> TerminateWorkspacesAwaitable(Model::TerminateWorkspacesRequest&& request) const { return Aws::Utils::Threading::MakeAwaitable(*m_executor, &WorkSpacesClient::TerminateWorkspaces, this, std::move(request)); }
+#endif
 
     private:
       void init(const Client::ClientConfiguration& clientConfiguration);
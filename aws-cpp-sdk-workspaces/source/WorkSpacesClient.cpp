@@ -114,12 +114,22 @@ CreateWorkspacesOutcome WorkSpacesClient::CreateWorkspaces(const CreateWorkspace
 
 CreateWorkspacesOutcomeCallable WorkSpacesClient::CreateWorkspacesCallable(const CreateWorkspacesRequest& request) const
 {
-  return std::async(std::launch::async, &WorkSpacesClient::CreateWorkspaces, this, request);
+  return m_executor->SubmitWithFuture(&WorkSpacesClient::CreateWorkspaces, Aws::Client::RejectedCallOutcome<CreateWorkspacesOutcome>(), this, request);
+}
+
+CreateWorkspacesOutcomeCallable WorkSpacesClient::CreateWorkspacesCallable(CreateWorkspacesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WorkSpacesClient::CreateWorkspaces, Aws::Client::RejectedCallOutcome<CreateWorkspacesOutcome>(), this, std::move(request));
 }
 
 void WorkSpacesClient::CreateWorkspacesAsync(const CreateWorkspacesRequest& request, const CreateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WorkSpacesClient::CreateWorkspacesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WorkSpacesClient::CreateWorkspacesAsyncHelper, Aws::Client::RejectedAsyncCall<CreateWorkspacesOutcome>(), this, request, handler, context);
+}
+
+void WorkSpacesClient::CreateWorkspacesAsync(CreateWorkspacesRequest&& request, const CreateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WorkSpacesClient::CreateWorkspacesAsyncHelper, Aws::Client::RejectedAsyncCall<CreateWorkspacesOutcome>(), this, std::move(request), handler, context);
 }
 
 void WorkSpacesClient::CreateWorkspacesAsyncHelper(const CreateWorkspacesRequest& request, const CreateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -145,12 +155,22 @@ DescribeWorkspaceBundlesOutcome WorkSpacesClient::DescribeWorkspaceBundles(const
 
 DescribeWorkspaceBundlesOutcomeCallable WorkSpacesClient::DescribeWorkspaceBundlesCallable(const DescribeWorkspaceBundlesRequest& request) const
 {
-  return std::async(std::launch::async, &WorkSpacesClient::DescribeWorkspaceBundles, this, request);
+  return m_executor->SubmitWithFuture(&WorkSpacesClient::DescribeWorkspaceBundles, Aws::Client::RejectedCallOutcome<DescribeWorkspaceBundlesOutcome>(), this, request);
+}
+
+DescribeWorkspaceBundlesOutcomeCallable WorkSpacesClient::DescribeWorkspaceBundlesCallable(DescribeWorkspaceBundlesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WorkSpacesClient::DescribeWorkspaceBundles, Aws::Client::RejectedCallOutcome<DescribeWorkspaceBundlesOutcome>(), this, std::move(request));
 }
 
 void WorkSpacesClient::DescribeWorkspaceBundlesAsync(const DescribeWorkspaceBundlesRequest& request, const DescribeWorkspaceBundlesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WorkSpacesClient::DescribeWorkspaceBundlesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WorkSpacesClient::DescribeWorkspaceBundlesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeWorkspaceBundlesOutcome>(), this, request, handler, context);
+}
+
+void WorkSpacesClient::DescribeWorkspaceBundlesAsync(DescribeWorkspaceBundlesRequest&& request, const DescribeWorkspaceBundlesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WorkSpacesClient::DescribeWorkspaceBundlesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeWorkspaceBundlesOutcome>(), this, std::move(request), handler, context);
 }
 
 void WorkSpacesClient::DescribeWorkspaceBundlesAsyncHelper(const DescribeWorkspaceBundlesRequest& request, const DescribeWorkspaceBundlesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -176,12 +196,22 @@ DescribeWorkspaceDirectoriesOutcome WorkSpacesClient::DescribeWorkspaceDirectori
 
 DescribeWorkspaceDirectoriesOutcomeCallable WorkSpacesClient::DescribeWorkspaceDirectoriesCallable(const DescribeWorkspaceDirectoriesRequest& request) const
 {
-  return std::async(std::launch::async, &WorkSpacesClient::DescribeWorkspaceDirectories, this, request);
+  return m_executor->SubmitWithFuture(&WorkSpacesClient::DescribeWorkspaceDirectories, Aws::Client::RejectedCallOutcome<DescribeWorkspaceDirectoriesOutcome>(), this, request);
+}
+
+DescribeWorkspaceDirectoriesOutcomeCallable WorkSpacesClient::DescribeWorkspaceDirectoriesCallable(DescribeWorkspaceDirectoriesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WorkSpacesClient::DescribeWorkspaceDirectories, Aws::Client::RejectedCallOutcome<DescribeWorkspaceDirectoriesOutcome>(), this, std::move(request));
 }
 
 void WorkSpacesClient::DescribeWorkspaceDirectoriesAsync(const DescribeWorkspaceDirectoriesRequest& request, const DescribeWorkspaceDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WorkSpacesClient::DescribeWorkspaceDirectoriesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WorkSpacesClient::DescribeWorkspaceDirectoriesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeWorkspaceDirectoriesOutcome>(), this, request, handler, context);
+}
+
+void WorkSpacesClient::DescribeWorkspaceDirectoriesAsync(DescribeWorkspaceDirectoriesRequest&& request, const DescribeWorkspaceDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WorkSpacesClient::DescribeWorkspaceDirectoriesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeWorkspaceDirectoriesOutcome>(), this, std::move(request), handler, context);
 }
 
 void WorkSpacesClient::DescribeWorkspaceDirectoriesAsyncHelper(const DescribeWorkspaceDirectoriesRequest& request, const DescribeWorkspaceDirectoriesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -207,12 +237,22 @@ DescribeWorkspacesOutcome WorkSpacesClient::DescribeWorkspaces(const DescribeWor
 
 DescribeWorkspacesOutcomeCallable WorkSpacesClient::DescribeWorkspacesCallable(const DescribeWorkspacesRequest& request) const
 {
-  return std::async(std::launch::async, &WorkSpacesClient::DescribeWorkspaces, this, request);
+  return m_executor->SubmitWithFuture(&WorkSpacesClient::DescribeWorkspaces, Aws::Client::RejectedCallOutcome<DescribeWorkspacesOutcome>(), this, request);
+}
+
+DescribeWorkspacesOutcomeCallable WorkSpacesClient::DescribeWorkspacesCallable(DescribeWorkspacesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WorkSpacesClient::DescribeWorkspaces, Aws::Client::RejectedCallOutcome<DescribeWorkspacesOutcome>(), this, std::move(request));
 }
 
 void WorkSpacesClient::DescribeWorkspacesAsync(const DescribeWorkspacesRequest& request, const DescribeWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WorkSpacesClient::DescribeWorkspacesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WorkSpacesClient::DescribeWorkspacesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeWorkspacesOutcome>(), this, request, handler, context);
+}
+
+void WorkSpacesClient::DescribeWorkspacesAsync(DescribeWorkspacesRequest&& request, const DescribeWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WorkSpacesClient::DescribeWorkspacesAsyncHelper, Aws::Client::RejectedAsyncCall<DescribeWorkspacesOutcome>(), this, std::move(request), handler, context);
 }
 
 void WorkSpacesClient::DescribeWorkspacesAsyncHelper(const DescribeWorkspacesRequest& request, const DescribeWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -238,12 +278,22 @@ RebootWorkspacesOutcome WorkSpacesClient::RebootWorkspaces(const RebootWorkspace
 
 RebootWorkspacesOutcomeCallable WorkSpacesClient::RebootWorkspacesCallable(const RebootWorkspacesRequest& request) const
 {
-  return std::async(std::launch::async, &WorkSpacesClient::RebootWorkspaces, this, request);
+  return m_executor->SubmitWithFuture(&WorkSpacesClient::RebootWorkspaces, Aws::Client::RejectedCallOutcome<RebootWorkspacesOutcome>(), this, request);
+}
+
+RebootWorkspacesOutcomeCallable WorkSpacesClient::RebootWorkspacesCallable(RebootWorkspacesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WorkSpacesClient::RebootWorkspaces, Aws::Client::RejectedCallOutcome<RebootWorkspacesOutcome>(), this, std::move(request));
 }
 
 void WorkSpacesClient::RebootWorkspacesAsync(const RebootWorkspacesRequest& request, const RebootWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WorkSpacesClient::RebootWorkspacesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WorkSpacesClient::RebootWorkspacesAsyncHelper, Aws::Client::RejectedAsyncCall<RebootWorkspacesOutcome>(), this, request, handler, context);
+}
+
+void WorkSpacesClient::RebootWorkspacesAsync(RebootWorkspacesRequest&& request, const RebootWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WorkSpacesClient::RebootWorkspacesAsyncHelper, Aws::Client::RejectedAsyncCall<RebootWorkspacesOutcome>(), this, std::move(request), handler, context);
 }
 
 void WorkSpacesClient::RebootWorkspacesAsyncHelper(const RebootWorkspacesRequest& request, const RebootWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -269,12 +319,22 @@ RebuildWorkspacesOutcome WorkSpacesClient::RebuildWorkspaces(const RebuildWorksp
 
 RebuildWorkspacesOutcomeCallable WorkSpacesClient::RebuildWorkspacesCallable(const RebuildWorkspacesRequest& request) const
 {
-  return std::async(std::launch::async, &WorkSpacesClient::RebuildWorkspaces, this, request);
+  return m_executor->SubmitWithFuture(&WorkSpacesClient::RebuildWorkspaces, Aws::Client::RejectedCallOutcome<RebuildWorkspacesOutcome>(), this, request);
+}
+
+RebuildWorkspacesOutcomeCallable WorkSpacesClient::RebuildWorkspacesCallable(RebuildWorkspacesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WorkSpacesClient::RebuildWorkspaces, Aws::Client::RejectedCallOutcome<RebuildWorkspacesOutcome>(), this, std::move(request));
 }
 
 void WorkSpacesClient::RebuildWorkspacesAsync(const RebuildWorkspacesRequest& request, const RebuildWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WorkSpacesClient::RebuildWorkspacesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WorkSpacesClient::RebuildWorkspacesAsyncHelper, Aws::Client::RejectedAsyncCall<RebuildWorkspacesOutcome>(), this, request, handler, context);
+}
+
+void WorkSpacesClient::RebuildWorkspacesAsync(RebuildWorkspacesRequest&& request, const RebuildWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WorkSpacesClient::RebuildWorkspacesAsyncHelper, Aws::Client::RejectedAsyncCall<RebuildWorkspacesOutcome>(), this, std::move(request), handler, context);
 }
 
 void WorkSpacesClient::RebuildWorkspacesAsyncHelper(const RebuildWorkspacesRequest& request, const RebuildWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
@@ -300,12 +360,22 @@ TerminateWorkspacesOutcome WorkSpacesClient::TerminateWorkspaces(const Terminate
 
 TerminateWorkspacesOutcomeCallable WorkSpacesClient::TerminateWorkspacesCallable(const TerminateWorkspacesRequest& request) const
 {
-  return std::async(std::launch::async, &WorkSpacesClient::TerminateWorkspaces, this, request);
+  return m_executor->SubmitWithFuture(&WorkSpacesClient::TerminateWorkspaces, Aws::Client::RejectedCallOutcome<TerminateWorkspacesOutcome>(), this, request);
+}
+
+TerminateWorkspacesOutcomeCallable WorkSpacesClient::TerminateWorkspacesCallable(TerminateWorkspacesRequest&& request) const
+{
+  return m_executor->SubmitWithFuture(&WorkSpacesClient::TerminateWorkspaces, Aws::Client::RejectedCallOutcome<TerminateWorkspacesOutcome>(), this, std::move(request));
 }
 
 void WorkSpacesClient::TerminateWorkspacesAsync(const TerminateWorkspacesRequest& request, const TerminateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
 {
-  m_executor->Submit(&WorkSpacesClient::TerminateWorkspacesAsyncHelper, this, request, handler, context);
+  m_executor->SubmitOrReject(&WorkSpacesClient::TerminateWorkspacesAsyncHelper, Aws::Client::RejectedAsyncCall<TerminateWorkspacesOutcome>(), this, request, handler, context);
+}
+
+void WorkSpacesClient::TerminateWorkspacesAsync(TerminateWorkspacesRequest&& request, const TerminateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
+{
+  m_executor->SubmitOrReject(&WorkSpacesClient::TerminateWorkspacesAsyncHelper, Aws::Client::RejectedAsyncCall<TerminateWorkspacesOutcome>(), this, std::move(request), handler, context);
 }
 
 void WorkSpacesClient::TerminateWorkspacesAsyncHelper(const TerminateWorkspacesRequest& request, const TerminateWorkspacesResponseReceivedHandler& handler, const std::shared_ptr<const Aws::Client::AsyncCallerContext>& context) const
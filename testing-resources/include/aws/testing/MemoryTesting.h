@@ -138,10 +138,19 @@ class AWS_TESTING_API ExactTestMemorySystem : public BaseTestMemorySystem
 #define AWS_END_MEMORY_OVERRIDE   } \
                                   Aws::Utils::Memory::ShutdownAWSMemorySystem();
 
+// Runs the statement and checks how many allocations it made through the AWS memory system; only valid between
+// AWS_BEGIN_MEMORY_TEST and AWS_END_MEMORY_TEST. Anything the statement leaves alive is still counted.
+#define AWS_EXPECT_ALLOCATION_COUNT(expectedCount, ...)  { \
+                                      uint64_t allocationsBefore = memorySystem.GetTotalAllocationCount(); \
+                                      __VA_ARGS__; \
+                                      EXPECT_EQ(static_cast<uint64_t>(expectedCount), memorySystem.GetTotalAllocationCount() - allocationsBefore); \
+                                      }
+
 #else
 
 #define AWS_BEGIN_MEMORY_TEST(x, y)
 #define AWS_END_MEMORY_TEST
 #define AWS_END_MEMORY_OVERRIDE
+#define AWS_EXPECT_ALLOCATION_COUNT(expectedCount, ...) { __VA_ARGS__; }
 
 #endif // AWS_CUSTOM_MEMORY_MANAGEMENT
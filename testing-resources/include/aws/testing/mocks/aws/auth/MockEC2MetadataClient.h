@@ -15,19 +15,25 @@
 
 #include <aws/core/internal/EC2MetadataClient.h>
 
+#include <mutex>
+
+//InstanceProfileCredentialsProvider refreshes from a background thread, so the mocked value is guarded.
 class MockEC2MetadataClient : public Aws::Internal::EC2MetadataClient
 {
 public:
     inline Aws::String GetDefaultCredentials() const
     {
+        std::lock_guard<std::mutex> locker(m_mockedValueMutex);
         return m_mockedValue;
     }
 
     inline void SetMockedCredentialsValue(const Aws::String& mockValue)
     {
+        std::lock_guard<std::mutex> locker(m_mockedValueMutex);
         m_mockedValue = mockValue;
     }
 
 private:
+    mutable std::mutex m_mockedValueMutex;
     Aws::String m_mockedValue;
 };
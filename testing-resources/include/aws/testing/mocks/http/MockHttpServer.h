@@ -0,0 +1,279 @@
+/*
+  * Copyright 2010-2016 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+  *
+  * Licensed under the Apache License, Version 2.0 (the "License").
+  * You may not use this file except in compliance with the License.
+  * A copy of the License is located at
+  *
+  *  http://aws.amazon.com/apache2.0
+  *
+  * or in the "license" file accompanying this file. This file is distributed
+  * on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either
+  * express or implied. See the License for the specific language governing
+  * permissions and limitations under the License.
+  */
+
+#pragma once
+
+#ifndef _WIN32
+
+#include <aws/core/utils/StringUtils.h>
+#include <aws/core/utils/memory/stl/AWSString.h>
+#include <aws/core/utils/memory/stl/AWSStringStream.h>
+#include <aws/core/utils/memory/stl/AWSMap.h>
+#include <aws/core/utils/memory/stl/AWSVector.h>
+
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+/**
+ * A minimal HTTP/1.1 server bound to 127.0.0.1 on an ephemeral port, for tests that need a real socket to talk to.
+ * Every connection is served on its own thread and supports keep-alive. The handler receives the parsed request and
+ * returns the raw bytes to write back; MakeResponse builds a well formed response for the common case.
+ * Stop() shuts down every open connection, so a handler that is blocked on the test's own signal still needs to be released first.
+ */
+class MockHttpServer
+{
+public:
+    struct Request
+    {
+        Aws::String method;
+        Aws::String uri;
+        //header names are lower cased.
+        Aws::Map<Aws::String, Aws::String> headers;
+        Aws::String body;
+    };
+
+    typedef std::function<Aws::String(const Request&)> Handler;
+
+    MockHttpServer(const Handler& handler) : m_handler(handler), m_listenSocket(-1), m_port(0), m_running(false), m_requestCount(0), m_connectionCount(0)
+    {
+        m_listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+
+        int reuse = 1;
+        setsockopt(m_listenSocket, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+        struct sockaddr_in address;
+        memset(&address, 0, sizeof(address));
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        address.sin_port = 0;
+
+        socklen_t addressLength = sizeof(address);
+        if (bind(m_listenSocket, reinterpret_cast<struct sockaddr*>(&address), addressLength) == 0 &&
+            listen(m_listenSocket, 128) == 0 &&
+            getsockname(m_listenSocket, reinterpret_cast<struct sockaddr*>(&address), &addressLength) == 0)
+        {
+            m_port = ntohs(address.sin_port);
+            m_running = true;
+            m_acceptThread = std::thread(&MockHttpServer::AcceptLoop, this);
+        }
+    }
+
+    ~MockHttpServer()
+    {
+        Stop();
+    }
+
+    void Stop()
+    {
+        if (!m_running.exchange(false))
+        {
+            return;
+        }
+
+        shutdown(m_listenSocket, SHUT_RDWR);
+        close(m_listenSocket);
+        m_acceptThread.join();
+
+        Aws::Vector<std::thread> connectionThreads;
+        {
+            std::lock_guard<std::mutex> locker(m_connectionsMutex);
+            for (int connection : m_connections)
+            {
+                shutdown(connection, SHUT_RDWR);
+            }
+            connectionThreads.swap(m_connectionThreads);
+        }
+
+        for (auto& connectionThread : connectionThreads)
+        {
+            connectionThread.join();
+        }
+    }
+
+    bool IsRunning() const { return m_running; }
+    unsigned short GetPort() const { return m_port; }
+    size_t GetRequestCount() const { return m_requestCount; }
+    //number of connections accepted so far, which tells a test whether a client reused its connections.
+    size_t GetConnectionCount() const { return m_connectionCount; }
+
+    Aws::String GetEndpoint() const
+    {
+        Aws::StringStream ss;
+        ss << "127.0.0.1:" << m_port;
+        return ss.str();
+    }
+
+    static Aws::String MakeResponse(int responseCode, const Aws::String& body, const Aws::Map<Aws::String, Aws::String>& headers = Aws::Map<Aws::String, Aws::String>())
+    {
+        Aws::StringStream ss;
+        ss << "HTTP/1.1 " << responseCode << " " << (responseCode < 400 ? "OK" : "Error") << "\r\n";
+        ss << "Content-Length: " << body.size() << "\r\n";
+        for (const auto& header : headers)
+        {
+            ss << header.first << ": " << header.second << "\r\n";
+        }
+        ss << "\r\n" << body;
+        return ss.str();
+    }
+
+private:
+    void AcceptLoop()
+    {
+        while (m_running)
+        {
+            int connection = accept(m_listenSocket, nullptr, nullptr);
+            if (connection < 0)
+            {
+                continue;
+            }
+
+            std::lock_guard<std::mutex> locker(m_connectionsMutex);
+            if (!m_running)
+            {
+                close(connection);
+                break;
+            }
+            ++m_connectionCount;
+            m_connections.push_back(connection);
+            m_connectionThreads.push_back(std::thread(&MockHttpServer::ServeConnection, this, connection));
+        }
+    }
+
+    void ServeConnection(int connection)
+    {
+        Aws::String buffered;
+        Request request;
+        while (m_running && ReadRequest(connection, buffered, request))
+        {
+            ++m_requestCount;
+            Aws::String response = m_handler(request);
+            if (!WriteAll(connection, response))
+            {
+                break;
+            }
+        }
+
+        std::lock_guard<std::mutex> locker(m_connectionsMutex);
+        for (auto iter = m_connections.begin(); iter != m_connections.end(); ++iter)
+        {
+            if (*iter == connection)
+            {
+                m_connections.erase(iter);
+                break;
+            }
+        }
+        close(connection);
+    }
+
+    static bool ReadRequest(int connection, Aws::String& buffered, Request& request)
+    {
+        size_t headerEnd = Aws::String::npos;
+        while ((headerEnd = buffered.find("\r\n\r\n")) == Aws::String::npos)
+        {
+            if (!ReadMore(connection, buffered))
+            {
+                return false;
+            }
+        }
+
+        request = Request();
+        Aws::StringStream headerStream(buffered.substr(0, headerEnd));
+        Aws::String line;
+        std::getline(headerStream, line);
+        Aws::StringStream requestLine(line);
+        requestLine >> request.method >> request.uri;
+
+        while (std::getline(headerStream, line))
+        {
+            size_t colon = line.find(':');
+            if (colon != Aws::String::npos)
+            {
+                request.headers[Aws::Utils::StringUtils::ToLower(line.substr(0, colon).c_str())] = Aws::Utils::StringUtils::Trim(line.substr(colon + 1).c_str());
+            }
+        }
+
+        size_t contentLength = 0;
+        auto contentLengthIter = request.headers.find("content-length");
+        if (contentLengthIter != request.headers.end())
+        {
+            contentLength = static_cast<size_t>(Aws::Utils::StringUtils::ConvertToInt64(contentLengthIter->second.c_str()));
+        }
+
+        size_t bodyStart = headerEnd + 4;
+        while (buffered.size() < bodyStart + contentLength)
+        {
+            if (!ReadMore(connection, buffered))
+            {
+                return false;
+            }
+        }
+
+        request.body = buffered.substr(bodyStart, contentLength);
+        buffered.erase(0, bodyStart + contentLength);
+        return true;
+    }
+
+    static bool ReadMore(int connection, Aws::String& buffered)
+    {
+        char chunk[4096];
+        ssize_t bytesRead = recv(connection, chunk, sizeof(chunk), 0);
+        if (bytesRead <= 0)
+        {
+            return false;
+        }
+        buffered.append(chunk, static_cast<size_t>(bytesRead));
+        return true;
+    }
+
+    static bool WriteAll(int connection, const Aws::String& data)
+    {
+        size_t written = 0;
+        while (written < data.size())
+        {
+            ssize_t result = send(connection, data.c_str() + written, data.size() - written, MSG_NOSIGNAL);
+            if (result <= 0)
+            {
+                return false;
+            }
+            written += static_cast<size_t>(result);
+        }
+        return true;
+    }
+
+    Handler m_handler;
+    int m_listenSocket;
+    unsigned short m_port;
+    std::atomic<bool> m_running;
+    std::atomic<size_t> m_requestCount;
+    std::atomic<size_t> m_connectionCount;
+    std::thread m_acceptThread;
+    std::mutex m_connectionsMutex;
+    Aws::Vector<int> m_connections;
+    Aws::Vector<std::thread> m_connectionThreads;
+};
+
+#endif // _WIN32